@@ -0,0 +1,8326 @@
+code
+proc swapfunc 24 0
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+GTI4 $26
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CNSTI4 2
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $28
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $29
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $28
+ADDRGP4 $27
+JUMPV
+LABELV $26
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $31
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI1
+ASGNI1
+LABELV $32
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $31
+LABELV $27
+LABELV $25
+endproc swapfunc 24 0
+proc med3 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $40
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $42
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $43
+JUMPV
+LABELV $42
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GEI4 $44
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $45
+JUMPV
+LABELV $44
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $45
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $43
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $41
+JUMPV
+LABELV $40
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $46
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $47
+JUMPV
+LABELV $46
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+GEI4 $48
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $49
+JUMPV
+LABELV $48
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+ASGNP4
+LABELV $49
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $47
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+LABELV $41
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $34
+endproc med3 40 8
+export qsort
+proc qsort 124 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRU4
+ASGNU4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+LABELV $51
+ADDRLP4 52
+CNSTU4 3
+ASGNU4
+ADDRLP4 56
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CVUI4 4
+CVIU4 4
+ADDRLP4 52
+INDIRU4
+BANDU4
+ADDRLP4 56
+INDIRU4
+NEU4 $56
+ADDRFP4 8
+INDIRU4
+ADDRLP4 52
+INDIRU4
+BANDU4
+ADDRLP4 56
+INDIRU4
+EQU4 $54
+LABELV $56
+ADDRLP4 44
+CNSTI4 2
+ASGNI4
+ADDRGP4 $55
+JUMPV
+LABELV $54
+ADDRFP4 8
+INDIRU4
+CNSTU4 4
+NEU4 $57
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 $58
+JUMPV
+LABELV $57
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+LABELV $58
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $55
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRU4
+CNSTU4 7
+GEU4 $59
+ADDRLP4 32
+ADDRFP4 8
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $64
+JUMPV
+LABELV $61
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $68
+JUMPV
+LABELV $65
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $69
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $70
+JUMPV
+LABELV $69
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $70
+LABELV $66
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+LABELV $68
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $71
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+GTI4 $65
+LABELV $71
+LABELV $62
+ADDRLP4 32
+ADDRFP4 8
+INDIRU4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $64
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CVPU4 4
+LTU4 $61
+ADDRGP4 $50
+JUMPV
+LABELV $59
+ADDRLP4 32
+ADDRFP4 4
+INDIRU4
+CNSTI4 1
+RSHU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRU4
+CNSTU4 7
+LEU4 $72
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 4
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRU4
+CNSTU4 40
+LEU4 $74
+ADDRLP4 40
+ADDRFP4 4
+INDIRU4
+CNSTI4 3
+RSHU4
+ADDRFP4 8
+INDIRU4
+MULU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 88
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 100
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 100
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 104
+INDIRP4
+ASGNP4
+LABELV $74
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 72
+INDIRP4
+ASGNP4
+LABELV $72
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $76
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $77
+JUMPV
+LABELV $76
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $77
+ADDRLP4 72
+ADDRFP4 8
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRFP4 4
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $83
+JUMPV
+LABELV $82
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $85
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $87
+ADDRLP4 80
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $88
+JUMPV
+LABELV $87
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $88
+ADDRLP4 20
+ADDRFP4 8
+INDIRU4
+ADDRLP4 20
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $85
+ADDRLP4 4
+ADDRFP4 8
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $83
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+GTU4 $89
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+LEI4 $82
+LABELV $89
+ADDRGP4 $91
+JUMPV
+LABELV $90
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $93
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $95
+ADDRLP4 88
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $95
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $96
+ADDRLP4 24
+ADDRLP4 24
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+LABELV $93
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+LABELV $91
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+GTU4 $97
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GEI4 $90
+LABELV $97
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+LEU4 $98
+ADDRGP4 $80
+JUMPV
+LABELV $98
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $100
+ADDRLP4 96
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRGP4 $101
+JUMPV
+LABELV $100
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $101
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 8
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+ADDRGP4 $83
+JUMPV
+LABELV $80
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $102
+ADDRLP4 32
+ADDRFP4 8
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $107
+JUMPV
+LABELV $104
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $111
+JUMPV
+LABELV $108
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $112
+ADDRLP4 80
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $113
+LABELV $109
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+LABELV $111
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $114
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GTI4 $108
+LABELV $114
+LABELV $105
+ADDRLP4 32
+ADDRFP4 8
+INDIRU4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $107
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CVPU4 4
+LTU4 $104
+ADDRGP4 $50
+JUMPV
+LABELV $102
+ADDRLP4 36
+ADDRFP4 4
+INDIRU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 88
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 88
+INDIRU4
+SUBU4
+CVUI4 4
+GEI4 $116
+ADDRLP4 80
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $116
+ADDRLP4 80
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+LABELV $117
+ADDRLP4 12
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $118
+ADDRLP4 100
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 100
+INDIRU4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+ADDRLP4 100
+INDIRU4
+SUBU4
+CVUI4 4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+SUBU4
+GEU4 $121
+ADDRLP4 96
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ASGNU4
+ADDRGP4 $122
+JUMPV
+LABELV $121
+ADDRLP4 96
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+SUBU4
+ASGNU4
+LABELV $122
+ADDRLP4 12
+ADDRLP4 96
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $123
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $123
+ADDRLP4 108
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+LEU4 $125
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+DIVU4
+ARGU4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $125
+ADDRLP4 116
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+LEU4 $127
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+DIVU4
+ASGNU4
+ADDRGP4 $51
+JUMPV
+LABELV $127
+LABELV $50
+endproc qsort 124 16
+export strlen
+proc strlen 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $131
+JUMPV
+LABELV $130
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $131
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $130
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+RETU4
+LABELV $129
+endproc strlen 4 0
+export strcat
+proc strcat 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $135
+JUMPV
+LABELV $134
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $135
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $134
+ADDRGP4 $138
+JUMPV
+LABELV $137
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $138
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $137
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $133
+endproc strcat 16 0
+export strcpy
+proc strcpy 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $141
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $142
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $141
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $140
+endproc strcpy 16 0
+export strcmp
+proc strcmp 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $146
+JUMPV
+LABELV $145
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $146
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $149
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $149
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $145
+LABELV $149
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+SUBI4
+RETI4
+LABELV $144
+endproc strcmp 12 0
+export strchr
+proc strchr 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $152
+JUMPV
+LABELV $151
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI4
+NEI4 $154
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $150
+JUMPV
+LABELV $154
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $152
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $151
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $156
+CNSTP4 0
+RETP4
+ADDRGP4 $150
+JUMPV
+LABELV $156
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $150
+endproc strchr 0 0
+export strrchr
+proc strrchr 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $160
+JUMPV
+LABELV $159
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI4
+NEI4 $162
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $162
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $160
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $159
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $164
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $158
+JUMPV
+LABELV $164
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $158
+endproc strrchr 4 0
+export strstr
+proc strstr 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $168
+JUMPV
+LABELV $167
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $173
+JUMPV
+LABELV $170
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+EQI4 $174
+ADDRGP4 $172
+JUMPV
+LABELV $174
+LABELV $171
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $173
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $170
+LABELV $172
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $176
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $166
+JUMPV
+LABELV $176
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $168
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $167
+CNSTP4 0
+RETP4
+LABELV $166
+endproc strstr 8 0
+export tolower
+proc tolower 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $179
+ADDRFP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $179
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+LABELV $179
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $178
+endproc tolower 4 0
+export toupper
+proc toupper 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $182
+ADDRFP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $182
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -32
+ADDI4
+ASGNI4
+LABELV $182
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $181
+endproc toupper 4 0
+export memmove
+proc memmove 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $185
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+LEU4 $187
+ADDRLP4 0
+ADDRFP4 8
+INDIRU4
+ASGNU4
+LABELV $189
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+SUBU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $190
+ADDRLP4 0
+INDIRU4
+CNSTU4 0
+NEU4 $189
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRGP4 $195
+JUMPV
+LABELV $192
+ADDRLP4 0
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $193
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+LABELV $195
+ADDRLP4 0
+INDIRU4
+ADDRFP4 8
+INDIRU4
+LTU4 $192
+LABELV $188
+LABELV $185
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $184
+endproc memmove 8 0
+proc powN 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $197
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $200
+JUMPV
+LABELV $199
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 1
+NEI4 $202
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $202
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+LABELV $200
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $199
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $196
+JUMPV
+LABELV $197
+ADDRFP4 4
+INDIRI4
+CNSTI4 -2147483648
+NEI4 $204
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+DIVF4
+RETF4
+ADDRGP4 $196
+JUMPV
+LABELV $204
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+NEGI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 powN
+CALLF4
+ASGNF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+DIVF4
+RETF4
+LABELV $196
+endproc powN 8 8
+export tan
+proc tan 8 4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+RETF4
+LABELV $206
+endproc tan 8 4
+data
+align 4
+LABELV randSeed
+byte 4 0
+export srand
+code
+proc srand 0 0
+ADDRGP4 randSeed
+ADDRFP4 0
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $207
+endproc srand 0 0
+export rand
+proc rand 4 0
+ADDRLP4 0
+ADDRGP4 randSeed
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 69069
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32767
+BANDI4
+RETI4
+LABELV $208
+endproc rand 4 0
+export atof
+proc atof 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $211
+JUMPV
+LABELV $210
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $213
+CNSTF4 0
+RETF4
+ADDRGP4 $209
+JUMPV
+LABELV $213
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $211
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $210
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 43
+EQI4 $218
+ADDRLP4 12
+INDIRI4
+CNSTI4 45
+EQI4 $219
+ADDRGP4 $215
+JUMPV
+LABELV $218
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $216
+JUMPV
+LABELV $219
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+LABELV $216
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+EQI4 $220
+LABELV $222
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $227
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $225
+LABELV $227
+ADDRGP4 $221
+JUMPV
+LABELV $225
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1092616192
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $223
+ADDRGP4 $222
+JUMPV
+ADDRGP4 $221
+JUMPV
+LABELV $220
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $221
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+NEI4 $228
+ADDRLP4 20
+CNSTF4 1036831949
+ASGNF4
+LABELV $230
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $235
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $233
+LABELV $235
+ADDRGP4 $232
+JUMPV
+LABELV $233
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1036831949
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+LABELV $231
+ADDRGP4 $230
+JUMPV
+LABELV $232
+LABELV $228
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+RETF4
+LABELV $209
+endproc atof 36 0
+export _atof
+proc _atof 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 48
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $238
+JUMPV
+LABELV $237
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $240
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTF4 0
+RETF4
+ADDRGP4 $236
+JUMPV
+LABELV $240
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $238
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $237
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 43
+EQI4 $245
+ADDRLP4 16
+INDIRI4
+CNSTI4 45
+EQI4 $246
+ADDRGP4 $242
+JUMPV
+LABELV $245
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $243
+JUMPV
+LABELV $246
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $243
+JUMPV
+LABELV $242
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $243
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+EQI4 $247
+LABELV $249
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $254
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $252
+LABELV $254
+ADDRGP4 $251
+JUMPV
+LABELV $252
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1092616192
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $250
+ADDRGP4 $249
+JUMPV
+LABELV $251
+LABELV $247
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+NEI4 $255
+ADDRLP4 24
+CNSTF4 1036831949
+ASGNF4
+LABELV $257
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $262
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $260
+LABELV $262
+ADDRGP4 $259
+JUMPV
+LABELV $260
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1036831949
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+LABELV $258
+ADDRGP4 $257
+JUMPV
+LABELV $259
+LABELV $255
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+RETF4
+LABELV $236
+endproc _atof 40 0
+export strtod
+proc strtod 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $265
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+EQI4 $264
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+EQI4 $264
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+EQI4 $264
+ADDRLP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $264
+ADDRLP4 8
+INDIRI4
+CNSTI4 9
+EQI4 $264
+ADDRLP4 8
+INDIRI4
+CNSTI4 11
+EQI4 $264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $269
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $267
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $270
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ASGNP4
+LABELV $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 40
+NEI4 $272
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 strtol
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 41
+NEI4 $274
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+CNSTI4 8388607
+BANDI4
+CNSTI4 2139095040
+BORI4
+CVIU4 4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $276
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $276
+ADDRLP4 16
+INDIRF4
+RETF4
+ADDRGP4 $263
+JUMPV
+LABELV $274
+LABELV $272
+ADDRLP4 16
+CNSTU4 2147483647
+ASGNU4
+ADDRLP4 16
+INDIRF4
+RETF4
+ADDRGP4 $263
+JUMPV
+LABELV $267
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $280
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 16
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $278
+ADDRLP4 20
+CNSTU4 2139095040
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $281
+ADDRLP4 20
+INDIRF4
+RETF4
+ADDRGP4 $263
+JUMPV
+LABELV $281
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ARGP4
+ADDRGP4 $285
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 24
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $283
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ASGNP4
+LABELV $284
+ADDRLP4 20
+INDIRF4
+RETF4
+ADDRGP4 $263
+JUMPV
+LABELV $278
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $286
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $288
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $288
+LABELV $287
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $292
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $290
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $294
+JUMPV
+LABELV $293
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 48
+LTI4 $296
+ADDRLP4 32
+INDIRI4
+CNSTI4 57
+GTI4 $296
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 65
+LTI4 $298
+ADDRLP4 40
+INDIRI4
+CNSTI4 70
+GTI4 $298
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1092616192
+ADDF4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+CNSTF4 1115815936
+SUBF4
+ASGNF4
+ADDRGP4 $299
+JUMPV
+LABELV $298
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 97
+LTI4 $295
+ADDRLP4 48
+INDIRI4
+CNSTI4 102
+GTI4 $295
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 52
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1092616192
+ADDF4
+ADDRLP4 52
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+CNSTF4 1120010240
+SUBF4
+ASGNF4
+LABELV $301
+LABELV $299
+LABELV $297
+LABELV $294
+ADDRGP4 $293
+JUMPV
+LABELV $295
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $302
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $302
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $304
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+CNSTF4 1031798784
+ASGNF4
+LABELV $306
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $310
+ADDRLP4 36
+INDIRI4
+CNSTI4 57
+GTI4 $310
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 40
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 40
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 65
+LTI4 $312
+ADDRLP4 44
+INDIRI4
+CNSTI4 70
+GTI4 $312
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 48
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 65
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 97
+LTI4 $308
+ADDRLP4 52
+INDIRI4
+CNSTI4 102
+GTI4 $308
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 56
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 56
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 97
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $315
+LABELV $313
+LABELV $311
+LABELV $307
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+ASGNF4
+ADDRGP4 $306
+JUMPV
+LABELV $308
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $316
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $316
+LABELV $304
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+EQU4 $318
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 112
+NEI4 $318
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 40
+ADDRGP4 strtol
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+NEU4 $320
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $322
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $322
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $263
+JUMPV
+LABELV $320
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+LABELV $318
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $324
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $324
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $263
+JUMPV
+LABELV $290
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $329
+JUMPV
+LABELV $326
+LABELV $327
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1092616192
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+CNSTF4 1111490560
+SUBF4
+ASGNF4
+LABELV $329
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $330
+ADDRLP4 36
+INDIRI4
+CNSTI4 57
+LEI4 $326
+LABELV $330
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $331
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $331
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $333
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1036831949
+ASGNF4
+ADDRGP4 $338
+JUMPV
+LABELV $335
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $336
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+CNSTF4 1092616192
+DIVF4
+ASGNF4
+LABELV $338
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 48
+LTI4 $339
+ADDRLP4 48
+INDIRI4
+CNSTI4 57
+LEI4 $335
+LABELV $339
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $340
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $340
+LABELV $333
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+EQU4 $342
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 101
+NEI4 $342
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 48
+ADDRGP4 strtol
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+NEU4 $344
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $346
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $346
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $263
+JUMPV
+LABELV $344
+CNSTF4 1092616192
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+LABELV $342
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $348
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $348
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $263
+endproc strtod 60 12
+export atoi
+proc atoi 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $354
+CNSTI4 0
+RETI4
+ADDRGP4 $350
+JUMPV
+LABELV $354
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $352
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $351
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 43
+EQI4 $359
+ADDRLP4 12
+INDIRI4
+CNSTI4 45
+EQI4 $360
+ADDRGP4 $356
+JUMPV
+LABELV $359
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $357
+JUMPV
+LABELV $360
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $357
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $361
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $366
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $364
+LABELV $366
+ADDRGP4 $363
+JUMPV
+LABELV $364
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $362
+ADDRGP4 $361
+JUMPV
+LABELV $363
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+RETI4
+LABELV $350
+endproc atoi 28 0
+export _atoi
+proc _atoi 32 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $369
+JUMPV
+LABELV $368
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $371
+CNSTI4 0
+RETI4
+ADDRGP4 $367
+JUMPV
+LABELV $371
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $369
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $368
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 43
+EQI4 $376
+ADDRLP4 16
+INDIRI4
+CNSTI4 45
+EQI4 $377
+ADDRGP4 $373
+JUMPV
+LABELV $376
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $377
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $374
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $378
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $383
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $381
+LABELV $383
+ADDRGP4 $380
+JUMPV
+LABELV $381
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 10
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $379
+ADDRGP4 $378
+JUMPV
+LABELV $380
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+RETI4
+LABELV $367
+endproc _atoi 32 0
+export strtol
+proc strtol 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $385
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $385
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $390
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $390
+ADDRFP4 8
+INDIRI4
+CNSTI4 36
+LEI4 $392
+LABELV $390
+CNSTI4 0
+RETI4
+ADDRGP4 $384
+JUMPV
+LABELV $391
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $392
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+EQI4 $391
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+EQI4 $391
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+EQI4 $391
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+EQI4 $391
+ADDRLP4 12
+INDIRI4
+CNSTI4 9
+EQI4 $391
+ADDRLP4 12
+INDIRI4
+CNSTI4 11
+EQI4 $391
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $394
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $396
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $396
+LABELV $395
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+NEI4 $398
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $400
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $400
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 120
+EQI4 $404
+ADDRLP4 16
+INDIRI4
+CNSTI4 88
+NEI4 $402
+LABELV $404
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $405
+ADDRFP4 8
+INDIRI4
+CNSTI4 16
+EQI4 $405
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $407
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $407
+CNSTI4 0
+RETI4
+ADDRGP4 $384
+JUMPV
+LABELV $405
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 $399
+JUMPV
+LABELV $402
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $399
+ADDRFP4 8
+CNSTI4 8
+ASGNI4
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $411
+ADDRFP4 8
+CNSTI4 10
+ASGNI4
+LABELV $411
+LABELV $399
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 48
+LTI4 $416
+ADDRLP4 20
+INDIRI4
+CNSTI4 57
+GTI4 $416
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 97
+LTI4 $418
+ADDRLP4 24
+INDIRI4
+CNSTI4 122
+GTI4 $418
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 97
+SUBI4
+ASGNI4
+ADDRGP4 $419
+JUMPV
+LABELV $418
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 65
+LTI4 $415
+ADDRLP4 28
+INDIRI4
+CNSTI4 90
+GTI4 $415
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 65
+SUBI4
+ASGNI4
+LABELV $421
+LABELV $419
+LABELV $417
+ADDRLP4 16
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $422
+ADDRGP4 $415
+JUMPV
+LABELV $422
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 -2147483648
+ADDI4
+ADDRFP4 8
+INDIRI4
+DIVI4
+GEI4 $424
+ADDRLP4 0
+CNSTI4 -2147483648
+ASGNI4
+ADDRGP4 $425
+JUMPV
+LABELV $424
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $425
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $426
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $426
+LABELV $414
+ADDRGP4 $413
+JUMPV
+LABELV $415
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $428
+ADDRLP4 0
+INDIRI4
+CNSTI4 -2147483648
+NEI4 $430
+ADDRLP4 0
+CNSTI4 2147483647
+ASGNI4
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $431
+LABELV $428
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $384
+endproc strtol 32 0
+export abs
+proc abs 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $434
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $435
+JUMPV
+LABELV $434
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+LABELV $435
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $432
+endproc abs 4 0
+export fabs
+proc fabs 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $438
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $439
+JUMPV
+LABELV $438
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+LABELV $439
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $436
+endproc fabs 4 0
+proc dopr 276 32
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 48
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $442
+JUMPV
+LABELV $441
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $444
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+LABELV $444
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $447
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GTI4 $447
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $554
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $554
+address $448
+address $451
+address $461
+address $466
+address $469
+address $476
+address $487
+address $492
+address $447
+code
+LABELV $448
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 37
+NEI4 $449
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $450
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 60
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $447
+JUMPV
+LABELV $451
+ADDRLP4 64
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 72
+CNSTI4 32
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $457
+ADDRLP4 64
+INDIRI4
+CNSTI4 35
+EQI4 $458
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LTI4 $452
+LABELV $460
+ADDRLP4 64
+INDIRI4
+CNSTI4 43
+EQI4 $456
+ADDRLP4 64
+INDIRI4
+CNSTI4 45
+EQI4 $455
+ADDRLP4 64
+INDIRI4
+CNSTI4 48
+EQI4 $459
+ADDRGP4 $452
+JUMPV
+LABELV $455
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 80
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $447
+JUMPV
+LABELV $456
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $447
+JUMPV
+LABELV $457
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRLP4 92
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 92
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 92
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $447
+JUMPV
+LABELV $458
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 96
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 96
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $447
+JUMPV
+LABELV $459
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 100
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $447
+JUMPV
+LABELV $452
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $461
+ADDRLP4 80
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+CNSTI4 48
+ADDRLP4 80
+INDIRI4
+GTI4 $462
+ADDRLP4 80
+INDIRI4
+CNSTI4 57
+GTI4 $462
+ADDRLP4 16
+CNSTI4 10
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $447
+JUMPV
+LABELV $462
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $464
+ADDRLP4 88
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 88
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $464
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $466
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $467
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $447
+JUMPV
+LABELV $467
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $469
+ADDRLP4 84
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+CNSTI4 48
+ADDRLP4 84
+INDIRI4
+GTI4 $470
+ADDRLP4 84
+INDIRI4
+CNSTI4 57
+GTI4 $470
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $472
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $472
+ADDRLP4 8
+CNSTI4 10
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $447
+JUMPV
+LABELV $470
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $474
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 92
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $474
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $476
+ADDRLP4 88
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 96
+CNSTI4 104
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $480
+ADDRLP4 88
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GTI4 $484
+LABELV $483
+ADDRLP4 88
+INDIRI4
+CNSTI4 76
+EQI4 $482
+ADDRGP4 $478
+JUMPV
+LABELV $484
+ADDRLP4 88
+INDIRI4
+CNSTI4 108
+EQI4 $481
+ADDRGP4 $478
+JUMPV
+LABELV $480
+ADDRLP4 104
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 100
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $478
+JUMPV
+LABELV $481
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 108
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 108
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $478
+JUMPV
+LABELV $482
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 112
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $478
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $485
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $485
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $487
+ADDRLP4 100
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 108
+EQI4 $491
+ADDRGP4 $489
+JUMPV
+LABELV $491
+ADDRLP4 12
+CNSTI4 3
+ASGNI4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 104
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 104
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $489
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $492
+ADDRLP4 104
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 69
+EQI4 $528
+ADDRLP4 112
+CNSTI4 71
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $532
+ADDRLP4 104
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $549
+LABELV $548
+ADDRLP4 104
+INDIRI4
+CNSTI4 37
+EQI4 $546
+ADDRGP4 $494
+JUMPV
+LABELV $549
+ADDRLP4 120
+CNSTI4 88
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $517
+ADDRLP4 104
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LTI4 $494
+LABELV $550
+ADDRLP4 104
+INDIRI4
+CNSTI4 99
+LTI4 $494
+ADDRLP4 104
+INDIRI4
+CNSTI4 120
+GTI4 $494
+ADDRLP4 104
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $551-396
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $551
+address $536
+address $496
+address $529
+address $525
+address $533
+address $494
+address $496
+address $494
+address $494
+address $494
+address $494
+address $539
+address $503
+address $538
+address $494
+address $494
+address $537
+address $494
+address $510
+address $494
+address $547
+address $518
+code
+LABELV $496
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $497
+ADDRLP4 128
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 128
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+CVII2 4
+CVII4 2
+ASGNI4
+ADDRGP4 $498
+JUMPV
+LABELV $497
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $499
+ADDRLP4 132
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 132
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $500
+JUMPV
+LABELV $499
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $501
+ADDRLP4 136
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 136
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRLP4 140
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 140
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $502
+LABELV $500
+LABELV $498
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 144
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $503
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $504
+ADDRLP4 148
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 148
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $506
+ADDRLP4 152
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 152
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $508
+ADDRLP4 156
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 156
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $509
+JUMPV
+LABELV $508
+ADDRLP4 160
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 160
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $509
+LABELV $507
+LABELV $505
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 164
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $510
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $511
+ADDRLP4 168
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 168
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $512
+JUMPV
+LABELV $511
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $513
+ADDRLP4 172
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 172
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $515
+ADDRLP4 176
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 176
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRLP4 180
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 180
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $516
+LABELV $514
+LABELV $512
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 184
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $517
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $518
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $519
+ADDRLP4 188
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 188
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $520
+JUMPV
+LABELV $519
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $521
+ADDRLP4 192
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 192
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $523
+ADDRLP4 196
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 196
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $524
+JUMPV
+LABELV $523
+ADDRLP4 200
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 200
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $524
+LABELV $522
+LABELV $520
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 204
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $525
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $526
+ADDRLP4 208
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 208
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $527
+JUMPV
+LABELV $526
+ADDRLP4 212
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 212
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 212
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $527
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 216
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $528
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $529
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $530
+ADDRLP4 220
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 220
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 220
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $531
+JUMPV
+LABELV $530
+ADDRLP4 224
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 224
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 224
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $531
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 228
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $532
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $533
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $534
+ADDRLP4 232
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 232
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $535
+JUMPV
+LABELV $534
+ADDRLP4 236
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 236
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 236
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $535
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 240
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 240
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $536
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 244
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 244
+INDIRP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 248
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 248
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $537
+ADDRLP4 252
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 252
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 252
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 fmtstr
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 256
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $538
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 260
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 260
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CVUI4 4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 264
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $539
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $540
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+CVII2 4
+ASGNI2
+ADDRGP4 $494
+JUMPV
+LABELV $540
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $542
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $542
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $544
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $544
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $546
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 268
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 268
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $547
+ADDRLP4 272
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 272
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 272
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $494
+ADDRLP4 128
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 128
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+LABELV $447
+LABELV $442
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $441
+ADDRFP4 4
+INDIRU4
+CNSTU4 0
+EQU4 $555
+ADDRLP4 28
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $555
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $440
+endproc dopr 276 32
+proc fmtstr 32 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $558
+ADDRFP4 12
+ADDRGP4 $560
+ASGNP4
+LABELV $558
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $564
+JUMPV
+LABELV $561
+LABELV $562
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $564
+ADDRLP4 8
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $561
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $565
+ADDRFP4 24
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $565
+ADDRLP4 8
+ADDRFP4 24
+INDIRI4
+ASGNI4
+LABELV $565
+ADDRLP4 0
+ADDRFP4 20
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $567
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $567
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $572
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $572
+JUMPV
+LABELV $571
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 20
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $572
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $571
+ADDRGP4 $575
+JUMPV
+LABELV $574
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $575
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $577
+ADDRFP4 24
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $574
+ADDRLP4 12
+INDIRI4
+ADDRFP4 24
+INDIRI4
+LTI4 $574
+LABELV $577
+ADDRGP4 $579
+JUMPV
+LABELV $578
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 28
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $579
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $578
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $557
+endproc fmtstr 32 16
+proc fmtint 84 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $582
+ADDRFP4 24
+CNSTI4 0
+ASGNI4
+LABELV $582
+ADDRLP4 8
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRFP4 28
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $584
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $586
+ADDRLP4 48
+CNSTI4 45
+ASGNI4
+ADDRLP4 8
+ADDRFP4 12
+INDIRI4
+NEGI4
+CVIU4 4
+ASGNU4
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRFP4 28
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $588
+ADDRLP4 48
+CNSTI4 43
+ASGNI4
+ADDRGP4 $589
+JUMPV
+LABELV $588
+ADDRFP4 28
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $590
+ADDRLP4 48
+CNSTI4 32
+ASGNI4
+LABELV $590
+LABELV $589
+LABELV $587
+LABELV $584
+ADDRFP4 28
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $592
+ADDRLP4 44
+ADDRGP4 $594
+ASGNP4
+ADDRGP4 $593
+JUMPV
+LABELV $592
+ADDRLP4 44
+ADDRGP4 $595
+ASGNP4
+LABELV $593
+LABELV $596
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 8
+INDIRU4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+MODU4
+ADDRLP4 44
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+DIVU4
+ASGNU4
+LABELV $597
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $599
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 24
+LTU4 $596
+LABELV $599
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 24
+NEU4 $600
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $600
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 40
+ADDRFP4 24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $604
+ADDRLP4 52
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $605
+JUMPV
+LABELV $604
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $605
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $606
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $607
+JUMPV
+LABELV $606
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $607
+ADDRLP4 4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GEI4 $608
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $608
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $610
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $610
+ADDRFP4 28
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $612
+ADDRLP4 40
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $615
+ADDRLP4 68
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $616
+JUMPV
+LABELV $615
+ADDRLP4 68
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $616
+ADDRLP4 40
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $612
+ADDRFP4 28
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $620
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $620
+JUMPV
+LABELV $619
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 68
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $620
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $619
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $622
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 48
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $622
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $630
+ADDRGP4 $627
+JUMPV
+LABELV $626
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 48
+ARGI4
+ADDRLP4 72
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $627
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GTI4 $626
+ADDRGP4 $630
+JUMPV
+LABELV $629
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 72
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 76
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $630
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $629
+ADDRGP4 $633
+JUMPV
+LABELV $632
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 80
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $633
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $632
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $581
+endproc fmtint 84 16
+proc abs_val 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $636
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $636
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $635
+endproc abs_val 4 0
+proc round 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1056964608
+LTF4 $639
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $639
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $638
+endproc round 8 0
+proc fmtfp 136 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $642
+ADDRFP4 20
+CNSTI4 6
+ASGNI4
+LABELV $642
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 abs_val
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $644
+ADDRLP4 72
+CNSTI4 45
+ASGNI4
+ADDRGP4 $645
+JUMPV
+LABELV $644
+ADDRFP4 24
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $646
+ADDRLP4 72
+CNSTI4 43
+ASGNI4
+ADDRGP4 $647
+JUMPV
+LABELV $646
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $648
+ADDRLP4 72
+CNSTI4 32
+ASGNI4
+LABELV $648
+LABELV $647
+LABELV $645
+ADDRLP4 12
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 9
+LEI4 $650
+ADDRFP4 20
+CNSTI4 9
+ASGNI4
+LABELV $650
+CNSTF4 1092616192
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTF4 1092616192
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 92
+INDIRF4
+LTF4 $652
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTF4 1092616192
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $652
+LABELV $654
+ADDRLP4 100
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $658
+ADDRLP4 96
+ADDRGP4 $594
+ASGNP4
+ADDRGP4 $659
+JUMPV
+LABELV $658
+ADDRLP4 96
+ADDRGP4 $595
+ASGNP4
+LABELV $659
+ADDRLP4 100
+INDIRI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+ADDRLP4 96
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $655
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $660
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+LTI4 $654
+LABELV $660
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+NEI4 $661
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $661
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $663
+ADDRLP4 100
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $667
+ADDRLP4 96
+ADDRGP4 $594
+ASGNP4
+ADDRGP4 $668
+JUMPV
+LABELV $667
+ADDRLP4 96
+ADDRGP4 $595
+ASGNP4
+LABELV $668
+ADDRLP4 100
+INDIRI4
+ADDRLP4 48
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+MODI4
+ADDRLP4 96
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $664
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $669
+ADDRLP4 20
+INDIRI4
+CNSTI4 20
+LTI4 $663
+LABELV $669
+ADDRLP4 20
+INDIRI4
+CNSTI4 20
+NEI4 $670
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $670
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $673
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $674
+ADDRLP4 0
+ADDRFP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRFP4 20
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+ADDRLP4 96
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+ADDRFP4 20
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+GEI4 $675
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $675
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $677
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $677
+ADDRFP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $679
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $679
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 100
+INDIRI4
+EQI4 $689
+ADDRLP4 0
+INDIRI4
+ADDRLP4 100
+INDIRI4
+LEI4 $689
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $686
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 72
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 $686
+JUMPV
+LABELV $685
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 48
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $686
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $685
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $689
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $688
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $694
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 72
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $694
+JUMPV
+LABELV $693
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 108
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 24
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 112
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $694
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $693
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+LEI4 $705
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 46
+ARGI4
+ADDRLP4 116
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $699
+JUMPV
+LABELV $698
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 48
+ARGI4
+ADDRLP4 120
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $699
+ADDRLP4 124
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+GTI4 $698
+ADDRGP4 $702
+JUMPV
+LABELV $701
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 128
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 48
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 132
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $702
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GTI4 $701
+ADDRGP4 $705
+JUMPV
+LABELV $704
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 116
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $705
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $704
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $641
+endproc fmtfp 136 16
+proc dopr_outch 8 0
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRFP4 8
+INDIRU4
+GEU4 $708
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 12
+INDIRI1
+ASGNI1
+LABELV $708
+CNSTI4 1
+RETI4
+LABELV $707
+endproc dopr_outch 8 0
+export Q_vsnprintf
+proc Q_vsnprintf 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 dopr
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $710
+endproc Q_vsnprintf 4 16
+export sscanf
+proc sscanf 84 4
+ADDRLP4 8
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $714
+JUMPV
+LABELV $713
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 37
+EQI4 $716
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $714
+JUMPV
+LABELV $716
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $718
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+GTI4 $718
+ADDRFP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 _atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRGP4 $719
+JUMPV
+LABELV $718
+ADDRLP4 4
+CNSTU4 1023
+ASGNU4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $719
+ADDRLP4 24
+CNSTI4 100
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $722
+ADDRLP4 0
+INDIRI4
+CNSTI4 102
+EQI4 $723
+ADDRLP4 0
+INDIRI4
+CNSTI4 105
+EQI4 $722
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $720
+LABELV $733
+ADDRLP4 0
+INDIRI4
+CNSTI4 115
+EQI4 $724
+ADDRLP4 0
+INDIRI4
+CNSTI4 117
+EQI4 $722
+ADDRGP4 $720
+JUMPV
+LABELV $722
+ADDRLP4 32
+ADDRLP4 8
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 _atoi
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $721
+JUMPV
+LABELV $723
+ADDRLP4 40
+ADDRLP4 8
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 _atof
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $721
+JUMPV
+LABELV $724
+ADDRLP4 52
+ADDRLP4 8
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 52
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $726
+JUMPV
+LABELV $725
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $726
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 32
+EQI4 $725
+ADDRLP4 56
+INDIRI4
+CNSTI4 12
+EQI4 $725
+ADDRLP4 56
+INDIRI4
+CNSTI4 10
+EQI4 $725
+ADDRLP4 56
+INDIRI4
+CNSTI4 13
+EQI4 $725
+ADDRLP4 56
+INDIRI4
+CNSTI4 9
+EQI4 $725
+ADDRLP4 56
+INDIRI4
+CNSTI4 11
+EQI4 $725
+ADDRGP4 $729
+JUMPV
+LABELV $728
+ADDRLP4 60
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 48
+ADDRLP4 60
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 64
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $729
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $732
+ADDRLP4 76
+INDIRI4
+CNSTI4 32
+EQI4 $732
+ADDRLP4 76
+INDIRI4
+CNSTI4 12
+EQI4 $732
+ADDRLP4 76
+INDIRI4
+CNSTI4 10
+EQI4 $732
+ADDRLP4 76
+INDIRI4
+CNSTI4 13
+EQI4 $732
+ADDRLP4 76
+INDIRI4
+CNSTI4 9
+EQI4 $732
+ADDRLP4 76
+INDIRI4
+CNSTI4 11
+EQI4 $732
+ADDRLP4 72
+ADDRLP4 4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 72
+INDIRU4
+CNSTU4 1
+SUBU4
+ASGNU4
+ADDRLP4 72
+INDIRU4
+CNSTU4 0
+NEU4 $728
+LABELV $732
+ADDRLP4 80
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $720
+LABELV $721
+LABELV $714
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $713
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $711
+endproc sscanf 84 4
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import strncpy
+lit
+align 1
+LABELV $595
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 97
+byte 1 98
+byte 1 99
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $594
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 65
+byte 1 66
+byte 1 67
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 0
+align 1
+LABELV $560
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
+align 1
+LABELV $292
+byte 1 48
+byte 1 120
+byte 1 0
+align 1
+LABELV $285
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $280
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 0
+align 1
+LABELV $269
+byte 1 110
+byte 1 97
+byte 1 110
+byte 1 0
@@ -0,0 +1,1838 @@
+export PM_SlideMove
+code
+proc PM_SlideMove 304 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 208
+CNSTI4 4
+ASGNI4
+ADDRLP4 212
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $46
+ADDRLP4 224
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 116
+ADDRLP4 224
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 116+8
+ADDRLP4 116+8
+INDIRF4
+ADDRLP4 224
+INDIRP4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 228
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 228
+INDIRP4
+INDIRF4
+ADDRLP4 116+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 212+8
+ADDRLP4 116+8
+INDIRF4
+ASGNF4
+ADDRGP4 pml+48
+INDIRI4
+CNSTI4 0
+EQI4 $53
+ADDRLP4 232
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+LABELV $53
+LABELV $46
+ADDRLP4 188
+ADDRGP4 pml+36
+INDIRF4
+ASGNF4
+ADDRGP4 pml+48
+INDIRI4
+CNSTI4 0
+EQI4 $59
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 pml+52+24
+INDIRB
+ASGNB 12
+ADDRGP4 $60
+JUMPV
+LABELV $59
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $60
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+CNSTI4 12
+ADDRLP4 96
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 204
+CNSTI4 0
+ASGNI4
+ADDRGP4 $67
+JUMPV
+LABELV $64
+ADDRLP4 224
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 228
+ADDRLP4 224
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 192
+ADDRLP4 228
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 228
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 236
+ADDRLP4 224
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 192+4
+ADDRLP4 236
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 236
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 240
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 192+8
+ADDRLP4 240
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 240
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 244
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 248
+ADDRLP4 244
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 248
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 244
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 244
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 248
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 244
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 244
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $70
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $45
+JUMPV
+LABELV $70
+ADDRLP4 128+8
+INDIRF4
+CNSTF4 0
+LEF4 $72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 128+12
+INDIRB
+ASGNB 12
+LABELV $72
+ADDRLP4 128+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $76
+ADDRGP4 $66
+JUMPV
+LABELV $76
+ADDRLP4 128+52
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddTouchEnt
+CALLV
+pop
+ADDRLP4 188
+ADDRLP4 188
+INDIRF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 128+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 96
+INDIRI4
+CNSTI4 5
+LTI4 $81
+ADDRLP4 256
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+CNSTF4 0
+ASGNF4
+ADDRLP4 256
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRLP4 256
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRLP4 256
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $45
+JUMPV
+LABELV $81
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $86
+JUMPV
+LABELV $83
+ADDRLP4 256
+CNSTI4 12
+ADDRLP4 80
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 128+24
+INDIRF4
+ADDRLP4 256
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 128+24+4
+INDIRF4
+ADDRLP4 256
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 128+24+8
+INDIRF4
+ADDRLP4 256
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1065185444
+LEF4 $87
+ADDRLP4 260
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ADDRLP4 128+24
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 264
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ADDRLP4 128+24+4
+INDIRF4
+ADDRLP4 264
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 128+24+8
+INDIRF4
+ADDRLP4 268
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $85
+JUMPV
+LABELV $87
+LABELV $84
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $86
+ADDRLP4 80
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $83
+LABELV $85
+ADDRLP4 80
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GEI4 $101
+ADDRGP4 $65
+JUMPV
+LABELV $101
+CNSTI4 12
+ADDRLP4 96
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 128+24
+INDIRB
+ASGNB 12
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $104
+ADDRLP4 256
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+CNSTI4 12
+ADDRLP4 80
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 256
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 256
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 256
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 1036831949
+LTF4 $110
+ADDRGP4 $105
+JUMPV
+LABELV $110
+ADDRLP4 184
+INDIRF4
+NEGF4
+ADDRGP4 pml+108
+INDIRF4
+LEF4 $112
+ADDRGP4 pml+108
+ADDRLP4 184
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $112
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+CNSTI4 12
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 64
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $116
+ADDRLP4 116
+ARGP4
+CNSTI4 12
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+LABELV $116
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 $121
+JUMPV
+LABELV $118
+ADDRLP4 76
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $122
+ADDRGP4 $119
+JUMPV
+LABELV $122
+ADDRLP4 264
+CNSTI4 12
+ADDRLP4 76
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 264
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 264
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 64+8
+INDIRF4
+ADDRLP4 264
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1036831949
+LTF4 $124
+ADDRGP4 $119
+JUMPV
+LABELV $124
+ADDRLP4 64
+ARGP4
+CNSTI4 12
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 64
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $130
+ADDRLP4 104
+ARGP4
+CNSTI4 12
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+LABELV $130
+ADDRLP4 268
+CNSTI4 12
+ADDRLP4 80
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 64+8
+INDIRF4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+LTF4 $132
+ADDRGP4 $119
+JUMPV
+LABELV $132
+ADDRLP4 272
+CNSTI4 12
+ASGNI4
+ADDRLP4 272
+INDIRI4
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 272
+INDIRI4
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 84
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 276
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 100
+ADDRLP4 276
+INDIRF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 276
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $144
+ADDRLP4 288
+CNSTI4 12
+ASGNI4
+ADDRLP4 288
+INDIRI4
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 288
+INDIRI4
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 84
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 292
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 292
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 116+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 292
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ASGNF4
+LABELV $144
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $157
+JUMPV
+LABELV $154
+ADDRLP4 0
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $160
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+NEI4 $158
+LABELV $160
+ADDRGP4 $155
+JUMPV
+LABELV $158
+ADDRLP4 292
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 292
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 292
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 64+8
+INDIRF4
+ADDRLP4 292
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1036831949
+LTF4 $161
+ADDRGP4 $155
+JUMPV
+LABELV $161
+ADDRLP4 296
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 300
+CNSTF4 0
+ASGNF4
+ADDRLP4 296
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 296
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 296
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 300
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $45
+JUMPV
+LABELV $155
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $157
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $154
+LABELV $119
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $121
+ADDRLP4 76
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $118
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $106
+ADDRLP4 116
+ADDRLP4 104
+INDIRB
+ASGNB 12
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $107
+ADDRLP4 80
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $104
+LABELV $106
+LABELV $65
+ADDRLP4 204
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $67
+ADDRLP4 204
+INDIRI4
+ADDRLP4 208
+INDIRI4
+LTI4 $64
+LABELV $66
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $169
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 116
+INDIRB
+ASGNB 12
+LABELV $169
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $171
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 212
+INDIRB
+ASGNB 12
+LABELV $171
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $174
+ADDRLP4 224
+CNSTI4 1
+ASGNI4
+ADDRGP4 $175
+JUMPV
+LABELV $174
+ADDRLP4 224
+CNSTI4 0
+ASGNI4
+LABELV $175
+ADDRLP4 224
+INDIRI4
+RETI4
+LABELV $45
+endproc PM_SlideMove 304 28
+export PM_StepSlideMove
+proc PM_StepSlideMove 144 28
+ADDRLP4 108
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 108
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 92
+ADDRLP4 108
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 PM_SlideMove
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $177
+ADDRGP4 $176
+JUMPV
+LABELV $177
+ADDRLP4 80
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 80+8
+ADDRLP4 80+8
+INDIRF4
+CNSTF4 1102053376
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 116
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 116
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 120
+CNSTF4 0
+ASGNF4
+ADDRLP4 56
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRLP4 56+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $182
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $192
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1060320051
+GEF4 $182
+LABELV $192
+ADDRGP4 $176
+JUMPV
+LABELV $182
+ADDRLP4 56
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1102053376
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 124
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 124
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $194
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $176
+ADDRGP4 $198
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $176
+JUMPV
+LABELV $194
+ADDRLP4 104
+ADDRLP4 0+12+8
+INDIRF4
+ADDRLP4 68+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 92
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_SlideMove
+CALLI4
+pop
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 80+8
+ADDRLP4 80+8
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 132
+ADDRLP4 128
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $204
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+LABELV $204
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $207
+ADDRLP4 136
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+LABELV $207
+ADDRLP4 136
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 68+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+CNSTF4 1073741824
+LEF4 $212
+ADDRLP4 140
+CNSTI4 199
+ASGNI4
+ADDRLP4 136
+INDIRF4
+CNSTF4 1088421888
+GEF4 $214
+ADDRLP4 140
+CNSTI4 196
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 136
+INDIRF4
+CNSTF4 1093664768
+GEF4 $216
+ADDRLP4 140
+CNSTI4 197
+ASGNI4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRLP4 136
+INDIRF4
+CNSTF4 1097859072
+GEF4 $218
+ADDRLP4 140
+CNSTI4 198
+ASGNI4
+ADDRGP4 $219
+JUMPV
+LABELV $218
+ADDRLP4 140
+CNSTI4 199
+ASGNI4
+LABELV $219
+LABELV $217
+LABELV $215
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+LABELV $212
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $220
+ADDRGP4 $222
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $220
+LABELV $176
+endproc PM_StepSlideMove 144 28
+import PM_AddEvent
+import PM_AddTouchEnt
+import PM_ClipVelocity
+import bg_playerMaxs
+import bg_playerMins
+import c_pmove
+import pm_flightfriction
+import pm_waterfriction
+import pm_friction
+import pm_flyaccelerate
+import pm_wateraccelerate
+import pm_airaccelerate
+import pm_accelerate
+import pm_swimScale
+import pm_duckScale
+import pm_stopspeed
+import pml
+import pm
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $222
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $198
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 98
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 10
+byte 1 0
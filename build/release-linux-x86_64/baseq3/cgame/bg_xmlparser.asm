@@ -0,0 +1,1286 @@
+export BG_XMLError
+code
+proc BG_XMLError 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $53
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $51
+endproc BG_XMLError 1028 16
+export BG_XMLWarning
+proc BG_XMLWarning 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $56
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $54
+endproc BG_XMLWarning 1028 16
+export BG_XMLOpen
+proc BG_XMLOpen 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $58
+CNSTI4 0
+RETI4
+ADDRGP4 $57
+JUMPV
+LABELV $58
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $62
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $60
+LABELV $62
+CNSTI4 0
+RETI4
+ADDRGP4 $57
+JUMPV
+LABELV $60
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $57
+endproc BG_XMLOpen 16 12
+export BG_XMLParse
+proc BG_XMLParse 1204 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 1172
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 1172
+INDIRP4
+ADDRLP4 1172
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $65
+JUMPV
+LABELV $64
+ADDRLP4 1176
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 1176
+INDIRP4
+ADDRLP4 1176
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $67
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $69
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $71
+ADDRLP4 1168
+CNSTI4 1
+ASGNI4
+ADDRGP4 $65
+JUMPV
+LABELV $71
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $73
+ARGP4
+ADDRLP4 1180
+ADDRGP4 BG_XMLError
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $69
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 62
+NEI4 $74
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $76
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRLP4 1180
+ADDRGP4 BG_XMLError
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $76
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1168
+INDIRI4
+CNSTI4 0
+EQI4 $79
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $83
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 1188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+EQI4 $81
+LABELV $83
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1192
+ADDRGP4 BG_XMLError
+CALLI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $81
+CNSTI4 1
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $79
+ADDRLP4 1184
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $86
+JUMPV
+LABELV $85
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $88
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+NEI4 $90
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $92
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1196
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1196
+INDIRI4
+CNSTI4 0
+NEI4 $87
+CNSTI4 0
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $92
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1192
+ADDRGP4 BG_XMLParse
+CALLI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+CNSTI4 0
+NEI4 $87
+CNSTI4 0
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $90
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+LABELV $86
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $85
+LABELV $87
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $65
+ADDRLP4 1188
+ADDRLP4 12
+ASGNP4
+ADDRLP4 1188+4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1188+8
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1188
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 1200
+ADDRGP4 BG_XMLParse
+CALLI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+CNSTI4 0
+NEI4 $65
+CNSTI4 0
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $74
+ADDRLP4 1180
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 32
+EQI4 $107
+ADDRLP4 1180
+INDIRI4
+CNSTI4 9
+EQI4 $107
+ADDRLP4 1180
+INDIRI4
+CNSTI4 13
+NEI4 $104
+LABELV $107
+ADDRGP4 $65
+JUMPV
+LABELV $104
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $108
+ADDRLP4 1184
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 1184
+INDIRP4
+ADDRLP4 1184
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $65
+JUMPV
+LABELV $108
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+CNSTU4 127
+LTU4 $110
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $112
+ARGP4
+ADDRLP4 1184
+ADDRGP4 BG_XMLError
+CALLI4
+ASGNI4
+ADDRLP4 1184
+INDIRI4
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $110
+ADDRLP4 1188
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1188
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 4
+INDIRI1
+ASGNI1
+ADDRGP4 $65
+JUMPV
+LABELV $67
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 60
+NEI4 $113
+ADDRLP4 8
+INDIRI4
+ADDRLP4 144
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1184
+CNSTU4 0
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 1184
+INDIRU4
+EQU4 $115
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 1184
+INDIRU4
+EQU4 $115
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $117
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $119
+ARGP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_XMLWarning
+CALLV
+pop
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1188
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+NEI4 $120
+CNSTI4 0
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $120
+LABELV $118
+LABELV $115
+ADDRLP4 140
+CNSTI4 1
+ASGNI4
+ADDRLP4 1188
+CNSTI4 0
+ASGNI4
+ADDRLP4 1168
+ADDRLP4 1188
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1188
+INDIRI4
+ASGNI4
+ADDRGP4 $65
+JUMPV
+LABELV $113
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $65
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $124
+ADDRLP4 1180
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 1180
+INDIRP4
+ADDRLP4 1180
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $124
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+CNSTU4 1023
+LTU4 $126
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $128
+ARGP4
+ADDRLP4 1184
+ADDRGP4 BG_XMLError
+CALLI4
+ASGNI4
+ADDRLP4 1184
+INDIRI4
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $126
+ADDRLP4 1188
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1188
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+ADDRLP4 144
+ADDP4
+ADDRLP4 4
+INDIRI1
+ASGNI1
+LABELV $65
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $64
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $129
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $129
+CNSTI4 1
+RETI4
+LABELV $63
+endproc BG_XMLParse 1204 16
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_PC_AddGlobalDefine
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $128
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $112
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $84
+byte 1 85
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $78
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $73
+byte 1 47
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $56
+byte 1 88
+byte 1 77
+byte 1 76
+byte 1 32
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $53
+byte 1 88
+byte 1 77
+byte 1 76
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
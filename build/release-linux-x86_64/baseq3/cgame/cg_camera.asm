@@ -0,0 +1,5396 @@
+data
+align 4
+LABELV CameraPathIndexValid
+byte 4 0
+align 4
+LABELV CameraPathIndexSorted
+byte 4 0
+align 4
+LABELV CameraArcSamplesUsed
+byte 4 0
+align 4
+LABELV CameraArcGeneration
+byte 4 1
+export CG_CameraResetInternalLengths
+code
+proc CG_CameraResetInternalLengths 4 0
+ADDRLP4 0
+ADDRGP4 cg+2869076
+INDIRP4
+ASGNP4
+ADDRGP4 $153
+JUMPV
+LABELV $152
+ADDRLP4 0
+INDIRP4
+CNSTI4 1452
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $153
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $152
+ADDRGP4 CG_CameraPathChanged
+CALLV
+pop
+LABELV $150
+endproc CG_CameraResetInternalLengths 4 0
+export CG_CameraPathChanged
+proc CG_CameraPathChanged 0 0
+ADDRGP4 CameraPathIndexValid
+CNSTI4 0
+ASGNI4
+LABELV $155
+endproc CG_CameraPathChanged 0 0
+proc wolfcamCameraBuildPathIndex 32 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $160
+JUMPV
+LABELV $157
+CNSTI4 2052
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 CameraPathIndex
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $158
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $160
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 3
+LTU4 $157
+ADDRGP4 CameraPathIndexHead
+ADDRGP4 cg+2869076
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 CameraPathIndexValid
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 CameraPathIndexSorted
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+2869076
+INDIRP4
+ASGNP4
+ADDRGP4 $165
+JUMPV
+LABELV $162
+ADDRLP4 12
+INDIRI4
+CNSTI4 512
+LTI4 $167
+ADDRGP4 CameraPathIndexSorted
+CNSTI4 0
+ASGNI4
+ADDRGP4 $156
+JUMPV
+LABELV $167
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $169
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+GEF4 $169
+ADDRGP4 CameraPathIndexSorted
+CNSTI4 0
+ASGNI4
+ADDRGP4 $156
+JUMPV
+LABELV $169
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $174
+JUMPV
+LABELV $171
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $175
+ADDRLP4 8
+CNSTI4 2052
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 CameraPathIndex
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $175
+LABELV $172
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $174
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 3
+LTU4 $171
+LABELV $163
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $165
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $162
+LABELV $156
+endproc wolfcamCameraBuildPathIndex 32 0
+proc wolfcamCameraPointMatch 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $179
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $181
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $178
+LABELV $181
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $182
+ADDRFP4 8
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $185
+JUMPV
+LABELV $184
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $185
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $187
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $184
+LABELV $187
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $183
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $177
+JUMPV
+LABELV $182
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $191
+JUMPV
+LABELV $190
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $191
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $193
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $190
+LABELV $193
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $183
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $195
+JUMPV
+LABELV $194
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $195
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $197
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $194
+LABELV $197
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $201
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $200
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $201
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $203
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $200
+LABELV $203
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $177
+endproc wolfcamCameraPointMatch 16 0
+proc wolfcamCameraMatchOrigin 124 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $205
+CNSTI4 0
+RETI4
+ADDRGP4 $204
+JUMPV
+LABELV $205
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $207
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $208
+JUMPV
+LABELV $207
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $209
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 40
+CNSTI4 12
+ASGNI4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 44
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRGP4 $210
+JUMPV
+LABELV $209
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $210
+LABELV $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $211
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $213
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $212
+JUMPV
+LABELV $213
+ADDRLP4 56
+CNSTI4 4
+ASGNI4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 8
+ASGNI4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 12
+ASGNI4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $215
+ADDRLP4 56
+CNSTI4 4
+ASGNI4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 8
+ASGNI4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 12
+ASGNI4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+CNSTI4 4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 104
+CNSTI4 8
+ASGNI4
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 116
+CNSTI4 12
+ASGNI4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 56
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $216
+LABELV $212
+CNSTI4 1
+RETI4
+LABELV $204
+endproc wolfcamCameraMatchOrigin 124 0
+proc wolfcamCameraMatchAtLinear 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+2869076
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+LEF4 $222
+ADDRGP4 $227
+JUMPV
+LABELV $222
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $224
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $224
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $220
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $219
+ADDRGP4 $227
+JUMPV
+LABELV $226
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $227
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $229
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $226
+LABELV $229
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $233
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $233
+JUMPV
+LABELV $232
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $233
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $235
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $232
+LABELV $235
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $217
+endproc wolfcamCameraMatchAtLinear 20 0
+proc wolfcamCameraMatchAt 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $237
+ADDRLP4 12
+ADDRGP4 CameraPathIndex
+ASGNP4
+ADDRGP4 $238
+JUMPV
+LABELV $237
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $239
+ADDRLP4 12
+ADDRGP4 CameraPathIndex+2052
+ASGNP4
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+NEI4 $242
+ADDRLP4 12
+ADDRGP4 CameraPathIndex+4104
+ASGNP4
+ADDRGP4 $243
+JUMPV
+LABELV $242
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 wolfcamCameraMatchAtLinear
+CALLV
+pop
+ADDRGP4 $236
+JUMPV
+LABELV $243
+LABELV $240
+LABELV $238
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $245
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 CameraPathIndexValid
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $253
+ADDRGP4 CameraPathIndexHead
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+2869076
+INDIRP4
+CVPU4 4
+NEU4 $253
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $249
+LABELV $253
+ADDRGP4 wolfcamCameraBuildPathIndex
+CALLV
+pop
+LABELV $249
+ADDRGP4 CameraPathIndexSorted
+INDIRI4
+CNSTI4 0
+NEI4 $254
+ADDRGP4 $247
+JUMPV
+LABELV $254
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDRLP4 24
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+LEF4 $259
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $260
+LABELV $257
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $256
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $261
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+ADDRLP4 28
+INDIRI4
+EQI4 $263
+ADDRLP4 36
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+LEF4 $261
+LABELV $263
+ADDRGP4 $246
+JUMPV
+LABELV $261
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+GEI4 $264
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $266
+ADDRLP4 48
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+GTF4 $264
+LABELV $266
+ADDRGP4 $246
+JUMPV
+LABELV $264
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $268
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 8
+SUBI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $269
+JUMPV
+LABELV $268
+ADDRLP4 52
+CNSTP4 0
+ASGNP4
+LABELV $269
+ADDRFP4 8
+INDIRP4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $271
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRLP4 56
+CNSTP4 0
+ASGNP4
+LABELV $272
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+GEI4 $274
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $275
+JUMPV
+LABELV $274
+ADDRLP4 64
+CNSTP4 0
+ASGNP4
+LABELV $275
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+GEI4 $277
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $278
+JUMPV
+LABELV $277
+ADDRLP4 68
+CNSTP4 0
+ASGNP4
+LABELV $278
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $236
+JUMPV
+LABELV $246
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LTI4 $245
+LABELV $247
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 wolfcamCameraMatchAtLinear
+CALLV
+pop
+LABELV $236
+endproc wolfcamCameraMatchAt 72 12
+proc wolfcamCameraArcStep 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+CNSTF4 1008981770
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+GEI4 $280
+CNSTI4 -1
+RETI4
+ADDRGP4 $279
+JUMPV
+LABELV $280
+CNSTF4 0
+ARGF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 posGet
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 28
+INDIRB
+ASGNB 12
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $287
+ADDRLP4 40
+CNSTF4 1008981770
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 0
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1008981770
+LEF4 $289
+ADDRLP4 0
+CNSTF4 1008981770
+ASGNF4
+LABELV $289
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $291
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 posGet
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 52
+ADDRGP4 VectorDistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+GTF4 $295
+ADDRGP4 $293
+JUMPV
+LABELV $295
+ADDRLP4 0
+CNSTF4 1060320051
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $292
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 10
+LTI4 $291
+LABELV $293
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 48
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 44
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LTI4 $297
+CNSTI4 -1
+RETI4
+ADDRGP4 $279
+JUMPV
+LABELV $297
+ADDRLP4 44
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 56
+CNSTI4 4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRLP4 28
+INDIRB
+ASGNB 12
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $287
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+LTF4 $286
+ADDRLP4 44
+INDIRI4
+RETI4
+LABELV $279
+endproc wolfcamCameraArcStep 60 16
+proc wolfcamCameraArcTable 56 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+2121556
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1460
+DIVI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $303
+ADDRLP4 12
+INDIRI4
+CNSTI4 512
+LTI4 $301
+LABELV $303
+CNSTP4 0
+RETP4
+ADDRGP4 $299
+JUMPV
+LABELV $301
+ADDRLP4 4
+CNSTI4 68
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 CameraArcTables
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 CameraArcGeneration
+INDIRI4
+NEI4 $304
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $304
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+NEF4 $304
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 4
+INDIRP4
+RETP4
+ADDRGP4 $299
+JUMPV
+LABELV $304
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CameraArcSamplesUsed
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 CameraArcSamples
+ADDP4
+ARGP4
+CNSTI4 262144
+ADDRLP4 40
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 wolfcamCameraArcStep
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $307
+ADDRGP4 CameraArcSamplesUsed
+INDIRI4
+CNSTI4 0
+NEI4 $309
+CNSTP4 0
+RETP4
+ADDRGP4 $299
+JUMPV
+LABELV $309
+ADDRGP4 CameraArcSamplesUsed
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+ADDRGP4 CameraArcGeneration
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CameraArcSamples
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 52
+ADDRGP4 wolfcamCameraArcStep
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $311
+CNSTP4 0
+RETP4
+ADDRGP4 $299
+JUMPV
+LABELV $311
+LABELV $307
+ADDRLP4 4
+INDIRP4
+ADDRGP4 CameraArcSamplesUsed
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 CameraArcGeneration
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $313
+ADDRLP4 48
+CNSTI4 12
+ASGNI4
+ADDRLP4 52
+ADDRLP4 48
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 52
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $314
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $313
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 CameraArcSamplesUsed
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $299
+endproc wolfcamCameraArcTable 56 16
+proc wolfcamCameraPointLength 120 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 92
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 88
+CNSTF4 1008981770
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1452
+ADDP4
+INDIRF4
+CNSTF4 0
+LTF4 $319
+ADDRFP4 4
+INDIRP4
+CNSTI4 1452
+ADDP4
+INDIRF4
+RETF4
+ADDRGP4 $318
+JUMPV
+LABELV $319
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+ARGP4
+ADDRGP4 wolfcamCameraPointMatch
+CALLV
+pop
+ADDRLP4 96
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 112
+ADDRGP4 wolfcamCameraMatchOrigin
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $321
+ADDRFP4 4
+INDIRP4
+CNSTI4 1452
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTF4 0
+RETF4
+ADDRGP4 $318
+JUMPV
+LABELV $321
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $323
+ADDRGP4 $325
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+CNSTI4 2
+ASGNI4
+LABELV $323
+CNSTF4 0
+ARGF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 posGet
+CALLV
+pop
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $331
+ADDRLP4 88
+CNSTF4 1008981770
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRLP4 0
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1008981770
+LEF4 $333
+ADDRLP4 0
+CNSTF4 1008981770
+ASGNF4
+LABELV $333
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $335
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 posGet
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorDistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+GTF4 $339
+ADDRGP4 $337
+JUMPV
+LABELV $339
+ADDRLP4 0
+CNSTF4 1060320051
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $336
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+LTI4 $335
+LABELV $337
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 92
+ADDRLP4 92
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $341
+ADDRGP4 $332
+JUMPV
+LABELV $341
+LABELV $331
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+LTF4 $330
+LABELV $332
+ADDRFP4 4
+INDIRP4
+CNSTI4 1452
+ADDP4
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1452
+ADDP4
+INDIRF4
+RETF4
+LABELV $318
+endproc wolfcamCameraPointLength 120 16
+data
+align 4
+LABELV $344
+byte 4 0
+align 4
+LABELV $345
+byte 4 0
+align 4
+LABELV $346
+byte 4 0
+bss
+align 4
+LABELV $347
+skip 48
+align 4
+LABELV $348
+skip 4
+align 4
+LABELV $349
+skip 12
+align 4
+LABELV $350
+skip 4
+align 4
+LABELV $351
+skip 4
+data
+align 4
+LABELV $352
+byte 4 0
+export CG_CameraSplineOriginAt
+code
+proc CG_CameraSplineOriginAt 168 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 80
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 76
+CNSTF4 1008981770
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 88
+ARGP4
+ADDRGP4 wolfcamCameraMatchAt
+CALLV
+pop
+ADDRLP4 88+4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $353
+ADDRLP4 88+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $356
+CNSTI4 0
+RETI4
+ADDRGP4 $343
+JUMPV
+LABELV $356
+ADDRLP4 88+12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $359
+CNSTI4 0
+RETI4
+ADDRGP4 $343
+JUMPV
+LABELV $359
+ADDRLP4 88+8
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 88
+ARGP4
+ADDRGP4 wolfcamCameraPointMatch
+CALLV
+pop
+ADDRLP4 84
+CNSTF4 0
+ASGNF4
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRLP4 88+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $363
+ADDRLP4 84
+CNSTF4 0
+ASGNF4
+ADDRGP4 $364
+JUMPV
+LABELV $363
+ADDRLP4 132
+CNSTI4 40
+ASGNI4
+ADDRLP4 108+4
+ADDRLP4 88+8
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 88+4
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 88+4
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 wolfcamCameraPointLength
+CALLF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $371
+ADDRLP4 140
+CNSTI4 40
+ASGNI4
+ADDRLP4 144
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 88+4
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 wolfcamCameraPointLength
+CALLF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRGP4 $372
+JUMPV
+LABELV $371
+ADDRLP4 108
+ADDRLP4 108+4
+INDIRF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 120+4
+INDIRF4
+ASGNF4
+LABELV $372
+ADDRLP4 88+12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $376
+ADDRLP4 140
+CNSTI4 40
+ASGNI4
+ADDRLP4 108+8
+ADDRLP4 88+12
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 88+8
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 88+8
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 wolfcamCameraPointLength
+CALLF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRGP4 $377
+JUMPV
+LABELV $376
+ADDRLP4 108+8
+ADDRLP4 108+4
+INDIRF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 120+4
+INDIRF4
+ASGNF4
+LABELV $377
+ADDRFP4 0
+INDIRF4
+ADDRLP4 88+4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 120
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 dsplineCalc
+CALLF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 140
+INDIRF4
+ASGNF4
+LABELV $364
+LABELV $354
+ADDRLP4 88
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 132
+ADDRGP4 wolfcamCameraMatchOrigin
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $389
+CNSTI4 0
+RETI4
+ADDRGP4 $343
+JUMPV
+LABELV $389
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $391
+ADDRGP4 $393
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 4
+CNSTI4 2
+ASGNI4
+LABELV $391
+ADDRLP4 88+4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 136
+ADDRGP4 wolfcamCameraArcTable
+CALLP4
+ASGNP4
+ADDRLP4 104
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $395
+ADDRLP4 160
+CNSTI4 4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 104
+INDIRP4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+LSHI4
+ADDRGP4 CameraArcSamples
+ADDP4
+ASGNP4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+ADDRLP4 104
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 152
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+LEF4 $400
+ADDRLP4 148
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRLP4 144
+ADDRLP4 140
+INDIRI4
+ASGNI4
+LABELV $401
+LABELV $398
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+INDIRI4
+LTI4 $397
+ADDRLP4 164
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 164
+INDIRI4
+LSHI4
+ADDRLP4 152
+INDIRP4
+ADDP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $343
+JUMPV
+LABELV $395
+ADDRGP4 $352
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRLP4 28
+ARGP4
+ADDRGP4 $347
+ARGP4
+ADDRLP4 140
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRLP4 28+12
+ARGP4
+ADDRGP4 $347+12
+ARGP4
+ADDRLP4 144
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRLP4 28+24
+ARGP4
+ADDRGP4 $347+24
+ARGP4
+ADDRLP4 148
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRLP4 28+36
+ARGP4
+ADDRGP4 $347+36
+ARGP4
+ADDRLP4 152
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRFP4 0
+INDIRF4
+ADDRGP4 $346
+INDIRF4
+LTF4 $402
+ADDRLP4 84
+INDIRF4
+ADDRGP4 $348
+INDIRF4
+LEF4 $402
+ADDRGP4 $350
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $402
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+ADDRGP4 $351
+INDIRF4
+NEF4 $402
+ADDRLP4 24
+ADDRGP4 $345
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRGP4 $344
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRGP4 $349
+INDIRB
+ASGNB 12
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRLP4 156
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 posGet
+CALLV
+pop
+LABELV $403
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $416
+ADDRLP4 76
+CNSTF4 1008981770
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRGP4 $345
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $344
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRGP4 $349
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1008981770
+LEF4 $418
+ADDRLP4 8
+CNSTF4 1008981770
+ASGNF4
+LABELV $418
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $420
+ADDRLP4 24
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 posGet
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 160
+ADDRGP4 VectorDistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+GTF4 $424
+ADDRGP4 $422
+JUMPV
+LABELV $424
+ADDRLP4 8
+CNSTF4 1060320051
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $421
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $420
+LABELV $422
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 160
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ADDRLP4 84
+INDIRF4
+LEF4 $426
+ADDRGP4 $417
+JUMPV
+LABELV $426
+ADDRLP4 80
+ADDRLP4 80
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $416
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+LTF4 $415
+LABELV $417
+ADDRGP4 $346
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $428
+ADDRLP4 156
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ADDRGP4 $347
+ADDP4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 28
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $429
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $428
+ADDRGP4 $348
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRGP4 $350
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $351
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+ASGNF4
+ADDRLP4 156
+CNSTI4 1
+ASGNI4
+ADDRGP4 $352
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+RETI4
+LABELV $343
+endproc CG_CameraSplineOriginAt 168 16
+export CG_CameraSplineAnglesAt
+proc CG_CameraSplineAnglesAt 128 24
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 wolfcamCameraMatchAt
+CALLV
+pop
+ADDRLP4 0+4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $434
+ADDRLP4 0+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $437
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $433
+JUMPV
+LABELV $437
+CNSTI4 0
+RETI4
+ADDRGP4 $433
+JUMPV
+LABELV $434
+ADDRLP4 0+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $441
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $433
+JUMPV
+LABELV $441
+ADDRLP4 112
+CNSTI4 40
+ASGNI4
+ADDRLP4 60
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 0+4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 QuatFromAngles
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $449
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 QuatFromAnglesClosest
+CALLV
+pop
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRLP4 116
+CNSTI4 16
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+CNSTI4 20
+ASGNI4
+ADDRLP4 16+4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+CNSTI4 24
+ASGNI4
+ADDRLP4 16+8
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 QuatFromAnglesClosest
+CALLV
+pop
+LABELV $450
+ADDRLP4 0+8
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 QuatFromAnglesClosest
+CALLV
+pop
+ADDRLP4 0+12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $463
+ADDRLP4 0+12
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 QuatFromAnglesClosest
+CALLV
+pop
+ADDRGP4 $464
+JUMPV
+LABELV $463
+ADDRLP4 116
+CNSTI4 16
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+CNSTI4 20
+ASGNI4
+ADDRLP4 16+4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 124
+CNSTI4 24
+ASGNI4
+ADDRLP4 16+8
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 QuatFromAnglesClosest
+CALLV
+pop
+LABELV $464
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 64
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRGP4 QuatSquad
+CALLV
+pop
+ADDRLP4 96
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 QuatToAngles
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $433
+endproc CG_CameraSplineAnglesAt 128 24
+export CG_CameraSplineFovAt
+proc CG_CameraSplineFovAt 56 20
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 wolfcamCameraMatchAt
+CALLV
+pop
+ADDRLP4 0+4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $479
+ADDRLP4 0+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $482
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+8
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $478
+JUMPV
+LABELV $482
+CNSTI4 0
+RETI4
+ADDRGP4 $478
+JUMPV
+LABELV $479
+ADDRLP4 0+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $486
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $478
+JUMPV
+LABELV $486
+ADDRLP4 32+4
+ADDRLP4 0+4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 0+4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 32+8
+ADDRLP4 0+8
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 0+8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $498
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 52
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRLP4 32
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16+4
+INDIRI4
+ADDRLP4 16+8
+INDIRI4
+ADDRLP4 16+4
+INDIRI4
+SUBI4
+SUBI4
+ASGNI4
+LABELV $499
+ADDRLP4 0+12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $506
+ADDRLP4 32+12
+ADDRLP4 0+12
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16+12
+ADDRLP4 0+12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 32+12
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 16+12
+ADDRLP4 16+8
+INDIRI4
+ADDRLP4 16+8
+INDIRI4
+ADDRLP4 16+4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+LABELV $507
+ADDRLP4 48
+ADDRFP4 0
+INDIRF4
+ADDRLP4 16+4
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 16+8
+INDIRI4
+ADDRLP4 16+4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 VectorTimeSpline
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $478
+endproc CG_CameraSplineFovAt 56 20
+export CG_CameraAngleLongestDistanceNoRoll
+proc CG_CameraAngleLongestDistanceNoRoll 32 8
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+LEF4 $525
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 $526
+JUMPV
+LABELV $525
+ADDRLP4 8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $526
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $524
+endproc CG_CameraAngleLongestDistanceNoRoll 32 8
+export CG_CameraAngleLongestDistanceWithRoll
+proc CG_CameraAngleLongestDistanceWithRoll 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $528
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $529
+JUMPV
+LABELV $528
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $529
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LEF4 $530
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $530
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $527
+endproc CG_CameraAngleLongestDistanceWithRoll 48 8
+bss
+align 4
+LABELV CameraArcTables
+skip 34816
+align 4
+LABELV CameraArcSamples
+skip 4194304
+align 4
+LABELV CameraPathIndexHead
+skip 4
+align 4
+LABELV CameraPathIndex
+skip 6156
+import CG_Q3mmeCameraResetInternalLengths
+import CG_Q3mmeCameraParse
+import CG_Q3mmeCameraSave
+import CG_Q3mmeDemoCameraCommand_f
+import CG_Q3mmeCameraDrawPath
+import CG_Q3mmeCameraFovAt
+import CG_Q3mmeCameraAnglesAt
+import CG_Q3mmeCameraOriginAt
+import CG_Q3mmeCameraPointAdd
+import demo
+import BG_XMLParse
+import BG_XMLOpen
+import BG_XMLWarning
+import BG_XMLError
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $393
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $325
+byte 1 94
+byte 1 49
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 10
+byte 1 0
@@ -0,0 +1,65549 @@
+export CG_TargetCommand_f
+code
+proc CG_TargetCommand_f 20 12
+ADDRLP4 8
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $160
+ADDRGP4 $159
+JUMPV
+LABELV $160
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $159
+endproc CG_TargetCommand_f 20 12
+proc CG_SizeUp_f 4 8
+ADDRGP4 $165
+ARGP4
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 10
+ADDI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $163
+endproc CG_SizeUp_f 4 8
+proc CG_SizeDown_f 4 8
+ADDRGP4 $165
+ARGP4
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 10
+SUBI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $167
+endproc CG_SizeDown_f 4 8
+proc CG_Viewpos_f 0 32
+ADDRGP4 $170
+ARGP4
+ADDRGP4 cg+609412+24
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+CNSTF4 1104150528
+SUBF4
+ARGF4
+ADDRGP4 cg+609780
+INDIRF4
+ARGF4
+ADDRGP4 cg+609780+4
+INDIRF4
+ARGF4
+ADDRGP4 cg+609780+8
+INDIRF4
+ARGF4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $169
+endproc CG_Viewpos_f 0 32
+export CG_ScoresDown_f
+proc CG_ScoresDown_f 0 4
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $186
+ADDRGP4 cg+686628
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+617020
+CNSTI4 1
+ASGNI4
+LABELV $186
+ADDRGP4 cg+610840
+INDIRI4
+CNSTI4 2000
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+GEI4 $191
+ADDRGP4 cg+610840
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $197
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $198
+ADDRGP4 $201
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $198
+ADDRGP4 cg+617020
+INDIRI4
+CNSTI4 0
+NEI4 $192
+ADDRGP4 cg+617020
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $192
+ADDRGP4 cg+610844
+CNSTI4 0
+ASGNI4
+ADDRGP4 $192
+JUMPV
+LABELV $191
+ADDRGP4 cg+617020
+CNSTI4 1
+ASGNI4
+LABELV $192
+LABELV $185
+endproc CG_ScoresDown_f 0 4
+export CG_ScoresUp_f
+proc CG_ScoresUp_f 0 0
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $212
+ADDRGP4 cg+686628
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+617020
+CNSTI4 0
+ASGNI4
+ADDRGP4 $211
+JUMPV
+LABELV $212
+ADDRGP4 cg+617020
+INDIRI4
+CNSTI4 0
+EQI4 $217
+ADDRGP4 cg+617020
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+617028
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $217
+LABELV $211
+endproc CG_ScoresUp_f 0 0
+proc CG_LoadHud_f 1036 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRGP4 CG_FreeFxJitTokens
+CALLV
+pop
+ADDRGP4 Menu_Reset
+CALLV
+pop
+ADDRGP4 cg_loadDefaultMenus+12
+INDIRI4
+CNSTI4 0
+EQI4 $224
+ADDRGP4 CG_LoadDefaultMenus
+CALLV
+pop
+LABELV $224
+ADDRLP4 1028
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+GEI4 $227
+ADDRGP4 $229
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1024
+ADDRLP4 0
+ASGNP4
+ADDRGP4 $228
+JUMPV
+LABELV $227
+CNSTI4 1
+ARGI4
+ADDRLP4 1032
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1032
+INDIRP4
+ASGNP4
+LABELV $228
+ADDRLP4 1024
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $230
+ADDRLP4 1024
+ADDRGP4 $232
+ASGNP4
+LABELV $230
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadMenus
+CALLV
+pop
+ADDRGP4 cg+617032
+CNSTP4 0
+ASGNP4
+LABELV $223
+endproc CG_LoadHud_f 1036 12
+proc CG_scrollScoresDown_f 0 12
+ADDRGP4 cg+617032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $235
+ADDRGP4 cg+617024
+INDIRI4
+CNSTI4 0
+EQI4 $235
+ADDRGP4 cg+617032
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_ScrollFeeder
+CALLV
+pop
+ADDRGP4 cg+617032
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_ScrollFeeder
+CALLV
+pop
+ADDRGP4 cg+617032
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_ScrollFeeder
+CALLV
+pop
+LABELV $235
+LABELV $234
+endproc CG_scrollScoresDown_f 0 12
+proc CG_scrollScoresUp_f 0 12
+ADDRGP4 cg+617032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $243
+ADDRGP4 cg+617024
+INDIRI4
+CNSTI4 0
+EQI4 $243
+ADDRGP4 cg+617032
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_ScrollFeeder
+CALLV
+pop
+ADDRGP4 cg+617032
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_ScrollFeeder
+CALLV
+pop
+ADDRGP4 cg+617032
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_ScrollFeeder
+CALLV
+pop
+LABELV $243
+LABELV $242
+endproc CG_scrollScoresUp_f 0 12
+proc CG_TellTarget_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $251
+ADDRGP4 $250
+JUMPV
+LABELV $251
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $250
+endproc CG_TellTarget_f 264 20
+proc CG_TellAttacker_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $255
+ADDRGP4 $254
+JUMPV
+LABELV $255
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $254
+endproc CG_TellAttacker_f 264 20
+proc CG_StartOrbit_f 1028 12
+ADDRGP4 $258
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+NEI4 $259
+LABELV $259
+ADDRGP4 cg_cameraOrbit+8
+INDIRF4
+CNSTF4 0
+EQF4 $261
+ADDRGP4 $264
+ARGP4
+ADDRGP4 $265
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $266
+ARGP4
+ADDRGP4 $265
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRGP4 $264
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $266
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $269
+ARGP4
+ADDRGP4 $265
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $270
+ARGP4
+ADDRGP4 $271
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $262
+LABELV $257
+endproc CG_StartOrbit_f 1028 12
+export CG_StartidCamera
+proc CG_StartidCamera 76 12
+ADDRGP4 cg+627504
+INDIRI4
+CNSTI4 0
+EQI4 $273
+LABELV $273
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $276
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $279
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_loadCamera
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $277
+ADDRGP4 $280
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+627504
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $282
+CNSTI4 255
+ARGI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 CG_Fade
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 cg+607168
+INDIRI4
+ARGI4
+CNSTI4 1500
+ARGI4
+ADDRGP4 CG_Fade
+CALLV
+pop
+LABELV $282
+ADDRGP4 cg+607168
+INDIRI4
+ARGI4
+ADDRGP4 trap_startCamera
+CALLV
+pop
+ADDRGP4 $278
+JUMPV
+LABELV $277
+ADDRGP4 $286
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+627504
+CNSTI4 0
+ASGNI4
+LABELV $278
+LABELV $272
+endproc CG_StartidCamera 76 12
+proc CG_idCamera_f 64 12
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_StartidCamera
+CALLV
+pop
+LABELV $288
+endproc CG_idCamera_f 64 12
+proc CG_idCameraStop_f 0 0
+ADDRGP4 cg+627504
+CNSTI4 0
+ASGNI4
+LABELV $289
+endproc CG_idCameraStop_f 0 0
+lit
+align 4
+LABELV $293
+address $294
+address cg+691252
+address cg+691256
+address $297
+address cg+691832
+address cg+691836
+address $300
+address cg+692412
+address cg+692416
+address $303
+address cg+692992
+address cg+692996
+address $306
+address cg+693572
+address cg+693576
+address $309
+address cg+694152
+address cg+694156
+code
+proc CG_ListTimedItems_f 96 28
+ADDRLP4 8
+ADDRGP4 $293
+INDIRB
+ASGNB 72
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $315
+JUMPV
+LABELV $312
+ADDRGP4 $316
+ARGP4
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $321
+JUMPV
+LABELV $318
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8+8
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRGP4 $323
+ARGP4
+ADDRLP4 84
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 88
+CNSTI4 12
+ASGNI4
+ADDRLP4 92
+ADDRLP4 88
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 8+8
+ADDP4
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 8+8
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 8+8
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 8+8
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 8+8
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $319
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $321
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8+4
+ADDP4
+INDIRP4
+INDIRI4
+LTI4 $318
+LABELV $313
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $315
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+CNSTU4 6
+LTU4 $312
+LABELV $292
+endproc CG_ListTimedItems_f 96 28
+proc CG_LoadMenu_f 1028 12
+ADDRLP4 1024
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 2
+GEI4 $331
+ADDRGP4 $333
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $330
+JUMPV
+LABELV $331
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+LABELV $330
+endproc CG_LoadMenu_f 1028 12
+proc CG_FreeCam_f 176 16
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $335
+ADDRGP4 $334
+JUMPV
+LABELV $335
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $340
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $338
+ADDRGP4 $341
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $342
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $343
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $334
+JUMPV
+LABELV $338
+ADDRLP4 60
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+NEI4 $347
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $348
+JUMPV
+LABELV $347
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $348
+ADDRGP4 cg+1332116
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $349
+CNSTI4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $354
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $352
+ADDRGP4 cg+1332160
+INDIRI4
+CNSTI4 0
+EQI4 $355
+ADDRGP4 $334
+JUMPV
+LABELV $355
+LABELV $352
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $358
+ADDRGP4 cg+1332124
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332136
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRGP4 cg+1332124
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332136
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1200
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $359
+ADDRGP4 wolfcam_following
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332124
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332136
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRLP4 76
+ADDRGP4 cg+1332124+8
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+SUBF4
+ASGNF4
+CNSTI4 1
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $379
+CNSTI4 2
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 92
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 100
+INDIRF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332136
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 cg+1332124
+ADDRGP4 cg+1332124
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+4
+ADDRGP4 cg+1332124+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+8
+ADDRGP4 cg+1332124+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124
+ADDRGP4 cg+1332124
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+4
+ADDRGP4 cg+1332124+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+8
+ADDRGP4 cg+1332124+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124
+ADDRGP4 cg+1332124
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+4
+ADDRGP4 cg+1332124+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+8
+ADDRGP4 cg+1332124+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 5
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 120
+ADDRGP4 cg+1332136
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 6
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRGP4 cg+1332136+4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 7
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRGP4 cg+1332136+8
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $380
+JUMPV
+LABELV $379
+CNSTI4 1
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $426
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $424
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LEI4 $427
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332124
+ADDRLP4 100
+INDIRF4
+ASGNF4
+LABELV $427
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LEI4 $430
+CNSTI4 2
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332124+4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+LABELV $430
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LEI4 $434
+CNSTI4 3
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332124+8
+ADDRLP4 100
+INDIRF4
+ASGNF4
+LABELV $434
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $438
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332136
+ADDRLP4 100
+INDIRF4
+ASGNF4
+LABELV $438
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LEI4 $441
+CNSTI4 5
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332136+4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+LABELV $441
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LEI4 $425
+CNSTI4 6
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332136+8
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRGP4 $425
+JUMPV
+LABELV $424
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $451
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $449
+CNSTI4 2
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 112
+ADDRGP4 cg+1332124
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRGP4 cg+1332124+4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 cg+1332124+8
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 5
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRGP4 cg+1332136
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+ADDRLP4 144
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 6
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 160
+ADDRGP4 cg+1332136+4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 7
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRGP4 cg+1332136+8
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $450
+JUMPV
+LABELV $449
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 112
+ADDRGP4 cg+1332124
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 2
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRGP4 cg+1332124+4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 cg+1332124+8
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRGP4 cg+1332136
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+ADDRLP4 144
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 5
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 160
+ADDRGP4 cg+1332136+4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 6
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRGP4 cg+1332136+8
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $450
+LABELV $425
+LABELV $380
+ADDRGP4 cg+1332164
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332168
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332220
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332204
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332200
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332196
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332192
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332188
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332184
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332180
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332148
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332148+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332148+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332160
+CNSTI4 1
+ASGNI4
+ADDRGP4 $488
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRGP4 $491
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $490
+JUMPV
+LABELV $489
+CNSTI4 4524
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $492
+ADDRGP4 $497
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $493
+JUMPV
+LABELV $492
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $498
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $498
+ADDRGP4 $497
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRGP4 $502
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $499
+LABELV $493
+LABELV $490
+LABELV $350
+LABELV $334
+endproc CG_FreeCam_f 176 16
+proc CG_SetViewPos_f 60 4
+ADDRLP4 0
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+GEI4 $504
+ADDRGP4 $506
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $507
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $508
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $503
+JUMPV
+LABELV $504
+ADDRGP4 cg+1332220
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332124
+ADDRLP4 8
+INDIRF4
+ASGNF4
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332124+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332124+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg+1332124+8
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+SUBF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 7
+GEI4 $517
+ADDRGP4 $503
+JUMPV
+LABELV $517
+CNSTI4 4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332136
+ADDRLP4 40
+INDIRF4
+ASGNF4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332136+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+CNSTI4 6
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332136+8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $503
+endproc CG_SetViewPos_f 60 4
+proc CG_SetViewAngles_f 20 4
+ADDRLP4 4
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+GEI4 $525
+ADDRGP4 $527
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $524
+JUMPV
+LABELV $525
+ADDRLP4 8
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332220
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $529
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332136
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $529
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LEI4 $532
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332136+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $532
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LEI4 $536
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332136+8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $536
+LABELV $524
+endproc CG_SetViewAngles_f 20 4
+export CG_AdjustTimeForTimeouts
+proc CG_AdjustTimeForTimeouts 28 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $541
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $543
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $544
+JUMPV
+LABELV $543
+ADDRLP4 16
+ADDRGP4 trap_GetFirstServerTime
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $544
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $550
+JUMPV
+LABELV $547
+ADDRLP4 0
+CNSTI4 12
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgs+1957844
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $553
+ADDRGP4 $548
+JUMPV
+LABELV $553
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $555
+ADDRGP4 $548
+JUMPV
+LABELV $555
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $557
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GTI4 $557
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $557
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $559
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $561
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $562
+JUMPV
+LABELV $561
+ADDRGP4 $563
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $562
+LABELV $560
+LABELV $558
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $564
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $565
+JUMPV
+LABELV $564
+ADDRLP4 20
+ADDRGP4 trap_GetFirstServerTime
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $565
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $548
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $550
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cgs+1960916
+INDIRI4
+LTI4 $547
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $540
+JUMPV
+LABELV $541
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $568
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $568
+ADDRLP4 16
+ADDRGP4 trap_GetFirstServerTime
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $569
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cgs+1960916
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $575
+JUMPV
+LABELV $572
+ADDRLP4 0
+CNSTI4 12
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgs+1957844
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $578
+ADDRGP4 $573
+JUMPV
+LABELV $578
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $580
+ADDRGP4 $573
+JUMPV
+LABELV $580
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $582
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GTI4 $582
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $583
+JUMPV
+LABELV $582
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $584
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $586
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRGP4 $588
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $587
+LABELV $585
+LABELV $583
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $589
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRLP4 20
+ADDRGP4 trap_GetFirstServerTime
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 trap_GetFirstServerTime
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $590
+LABELV $573
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $575
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $572
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+RETI4
+LABELV $540
+endproc CG_AdjustTimeForTimeouts 28 4
+proc CG_SeekClock_f 64 8
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $595
+ADDRGP4 $598
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $594
+JUMPV
+LABELV $595
+ADDRLP4 32
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+GEI4 $599
+ADDRGP4 $601
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $602
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $594
+JUMPV
+LABELV $599
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 119
+EQI4 $605
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 87
+NEI4 $603
+LABELV $605
+ADDRGP4 cg+3874628
+INDIRI4
+CNSTI4 0
+NEI4 $606
+ADDRGP4 $609
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $594
+JUMPV
+LABELV $606
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $604
+JUMPV
+LABELV $603
+ADDRLP4 44
+ADDRGP4 trap_GetGameStartTime
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+GEI4 $610
+ADDRGP4 $612
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $594
+JUMPV
+LABELV $610
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $604
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 44
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $616
+JUMPV
+LABELV $613
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 58
+NEI4 $617
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $617
+LABELV $614
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $616
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $613
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $619
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 1000
+ADDRLP4 52
+INDIRI4
+MULI4
+ASGNI4
+ADDRGP4 $620
+JUMPV
+LABELV $619
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_ParseClockTime
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $620
+CNSTP4 0
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_GetCurrentTimeWithDirection
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $621
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $624
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $626
+ADDRLP4 56
+ADDRGP4 trap_GetGameStartTime
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $622
+JUMPV
+LABELV $626
+ADDRLP4 56
+ADDRGP4 trap_GetFirstServerTime
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRGP4 trap_GetGameStartTime
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $622
+JUMPV
+LABELV $624
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $630
+ADDRLP4 16
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+3874632
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $622
+JUMPV
+LABELV $630
+ADDRLP4 56
+ADDRGP4 trap_GetFirstServerTime
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+3874632
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $622
+JUMPV
+LABELV $621
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $636
+ADDRLP4 16
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+3874632
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $636
+LABELV $622
+ADDRGP4 cg+3196920
+INDIRI4
+CNSTI4 0
+EQI4 $640
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $643
+ADDRLP4 24
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_AdjustTimeForTimeouts
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $645
+ARGP4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommandNow
+CALLV
+pop
+ADDRGP4 $641
+JUMPV
+LABELV $643
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GEI4 $641
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_AdjustTimeForTimeouts
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $648
+ARGP4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommandNow
+CALLV
+pop
+ADDRGP4 $641
+JUMPV
+LABELV $640
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $649
+ADDRLP4 24
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_AdjustTimeForTimeouts
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $648
+ARGP4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommandNow
+CALLV
+pop
+ADDRGP4 $650
+JUMPV
+LABELV $649
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GEI4 $651
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_AdjustTimeForTimeouts
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $645
+ARGP4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommandNow
+CALLV
+pop
+LABELV $651
+LABELV $650
+LABELV $641
+LABELV $594
+endproc CG_SeekClock_f 64 8
+export CG_ErrorPopup
+proc CG_ErrorPopup 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 cg+1333964
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $654
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $654
+ADDRGP4 cg+1333956
+ADDRGP4 cg+607168
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1333960
+CNSTI4 3000
+ASGNI4
+ADDRGP4 cg+1333964
+CNSTI1 0
+ASGNI1
+ADDRGP4 cg+1333964
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $663
+ARGP4
+ADDRGP4 cg+1333964
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $665
+ADDRGP4 $667
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $665
+LABELV $653
+endproc CG_ErrorPopup 16 12
+proc CG_EchoPopup_f 16 12
+ADDRGP4 cg+1332908
+ADDRGP4 cg+607168
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332912
+ADDRGP4 cg_echoPopupTime+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332916
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $677
+JUMPV
+LABELV $674
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $680
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 cg+1332916
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $675
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $677
+ADDRLP4 8
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $674
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $681
+ADDRGP4 cg+1332916
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRGP4 cg+1332916
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $681
+ADDRGP4 cg+1333940
+ADDRGP4 cg_echoPopupX+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1333944
+ADDRGP4 cg_echoPopupY+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1333948
+ADDRGP4 cg_echoPopupWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1333952
+ADDRGP4 cg_echoPopupScale+8
+INDIRF4
+ASGNF4
+LABELV $668
+endproc CG_EchoPopup_f 16 12
+proc CG_EchoPopupClear_f 0 0
+ADDRGP4 cg+1332908
+CNSTI4 0
+ASGNI4
+LABELV $693
+endproc CG_EchoPopupClear_f 0 0
+proc CG_EchoPopupCvar_f 1056 12
+ADDRLP4 1024
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 2
+GEI4 $696
+ADDRGP4 $695
+JUMPV
+LABELV $696
+CNSTI4 1
+ARGI4
+ADDRLP4 1028
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1032
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1036
+CNSTI4 2
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+LEI4 $698
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $700
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $698
+CNSTI4 1
+ARGI4
+ADDRLP4 1048
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $701
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $699
+JUMPV
+LABELV $698
+ADDRGP4 $702
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $699
+LABELV $695
+endproc CG_EchoPopupCvar_f 1056 12
+proc CG_AccStatsUp_f 0 0
+ADDRGP4 cg+1332832
+CNSTI4 0
+ASGNI4
+LABELV $703
+endproc CG_AccStatsUp_f 0 0
+proc CG_AccStatsDown_f 0 0
+ADDRGP4 cg+1332832
+CNSTI4 1
+ASGNI4
+LABELV $705
+endproc CG_AccStatsDown_f 0 0
+proc CG_ViewEnt_f 48 20
+ADDRLP4 4
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+GEI4 $708
+ADDRGP4 cg+1334988
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+1335044
+CNSTI4 0
+ASGNI4
+ADDRGP4 $707
+JUMPV
+LABELV $708
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $714
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $712
+ADDRGP4 cg+1335044
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+1335060
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+1335048
+ADDRGP4 cg+1332224+20
+INDIRB
+ASGNB 12
+ADDRGP4 $707
+JUMPV
+LABELV $712
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $722
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $720
+LABELV $722
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $720
+ADDRGP4 cg+1334988
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1335012
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1335016
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1335020
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 3
+LTI4 $727
+CNSTI4 2
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1335012
+ADDRLP4 36
+INDIRF4
+ASGNF4
+LABELV $727
+ADDRLP4 32
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 4
+LTI4 $730
+CNSTI4 3
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1335016
+ADDRLP4 40
+INDIRF4
+ASGNF4
+LABELV $730
+ADDRLP4 36
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 5
+LTI4 $733
+CNSTI4 4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1335020
+ADDRLP4 44
+INDIRF4
+ASGNF4
+LABELV $733
+ADDRGP4 $736
+ARGP4
+ADDRGP4 cg+1334988
+INDIRI4
+ARGI4
+ADDRGP4 cg+1335012
+INDIRF4
+ARGF4
+ADDRGP4 cg+1335016
+INDIRF4
+ARGF4
+ADDRGP4 cg+1335020
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $707
+endproc CG_ViewEnt_f 48 20
+proc CG_Chase_f 40 20
+ADDRLP4 4
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+GEI4 $742
+ADDRGP4 cg+1334996
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+1334992
+CNSTI4 0
+ASGNI4
+ADDRGP4 $741
+JUMPV
+LABELV $742
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $748
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $746
+LABELV $748
+ADDRGP4 cg+1334996
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+1334992
+CNSTI4 0
+ASGNI4
+ADDRGP4 $741
+JUMPV
+LABELV $746
+ADDRGP4 cg+1334996
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1334992
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+1335024
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1335028
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1335032
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+LTI4 $756
+CNSTI4 2
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1335024
+ADDRLP4 28
+INDIRF4
+ASGNF4
+LABELV $756
+ADDRLP4 24
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+LTI4 $759
+CNSTI4 3
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1335028
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $759
+ADDRLP4 28
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 5
+LTI4 $762
+CNSTI4 4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1335032
+ADDRLP4 36
+INDIRF4
+ASGNF4
+LABELV $762
+ADDRGP4 $765
+ARGP4
+ADDRGP4 cg+1334996
+INDIRI4
+ARGI4
+ADDRGP4 cg+1335024
+INDIRF4
+ARGF4
+ADDRGP4 cg+1335028
+INDIRF4
+ARGF4
+ADDRGP4 cg+1335032
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $741
+endproc CG_Chase_f 40 20
+proc CG_ViewUnlockYaw_f 4 0
+ADDRGP4 cg+1335036
+INDIRI4
+CNSTI4 0
+NEI4 $774
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $775
+JUMPV
+LABELV $774
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $775
+ADDRGP4 cg+1335036
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $770
+endproc CG_ViewUnlockYaw_f 4 0
+proc CG_ViewUnlockPitch_f 4 0
+ADDRGP4 cg+1335040
+INDIRI4
+CNSTI4 0
+NEI4 $780
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $781
+JUMPV
+LABELV $780
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $781
+ADDRGP4 cg+1335040
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $776
+endproc CG_ViewUnlockPitch_f 4 0
+proc CG_TestReplaceShaderImage_f 1044 16
+ADDRLP4 1028
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+GEI4 $783
+ADDRGP4 $782
+JUMPV
+LABELV $783
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $785
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+MODI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $786
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $785
+CNSTI4 1
+ARGI4
+ADDRLP4 1032
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+CNSTI4 16
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 trap_ReplaceShaderImage
+CALLV
+pop
+LABELV $782
+endproc CG_TestReplaceShaderImage_f 1044 16
+proc CG_StopMovement_f 0 0
+ADDRGP4 cg+1332224+32
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332224+32+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332224+32+8
+CNSTF4 0
+ASGNF4
+LABELV $789
+endproc CG_StopMovement_f 0 0
+data
+align 4
+LABELV entTypes
+address $798
+address $799
+address $800
+address $801
+address $802
+address $803
+address $804
+address $805
+address $806
+address $807
+address $808
+address $809
+address $810
+address $811
+code
+proc CG_ListEntities_f 1052 28
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $813
+ADDRLP4 8
+CNSTI4 1496
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $817
+ADDRGP4 $814
+JUMPV
+LABELV $817
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $819
+ADDRLP4 1036
+ADDRGP4 $821
+ASGNP4
+ADDRGP4 $820
+JUMPV
+LABELV $819
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LTI4 $822
+ADDRLP4 1036
+ADDRGP4 $811
+ASGNP4
+ADDRGP4 $823
+JUMPV
+LABELV $822
+ADDRLP4 1036
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 entTypes
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $823
+LABELV $820
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $824
+ADDRLP4 1040
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ASGNP4
+ADDRGP4 $825
+JUMPV
+LABELV $824
+ADDRLP4 1040
+ADDRGP4 $828
+ASGNP4
+LABELV $825
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $829
+ADDRLP4 1044
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+LTI4 $831
+ADDRLP4 1044
+INDIRI4
+CNSTI4 16
+GTI4 $831
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 weapNamesCasual
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $830
+JUMPV
+LABELV $831
+ADDRGP4 $833
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $834
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $830
+JUMPV
+LABELV $829
+ADDRGP4 $834
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $830
+ADDRGP4 $835
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $814
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $813
+LABELV $812
+endproc CG_ListEntities_f 1052 28
+export CG_PrintEntityState_f
+proc CG_PrintEntityState_f 20 4
+ADDRLP4 0
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+GEI4 $837
+ADDRGP4 $836
+JUMPV
+LABELV $837
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 112
+EQI4 $841
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 80
+NEI4 $839
+LABELV $841
+ADDRGP4 cg+607704
+ARGP4
+ADDRGP4 CG_PrintEntityStatep
+CALLV
+pop
+ADDRGP4 $840
+JUMPV
+LABELV $839
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_PrintEntityState
+CALLV
+pop
+LABELV $840
+LABELV $836
+endproc CG_PrintEntityState_f 20 4
+export CG_PrintNextEntityState_f
+proc CG_PrintNextEntityState_f 12 4
+ADDRLP4 0
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+GEI4 $844
+ADDRGP4 $843
+JUMPV
+LABELV $844
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 1496
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+236
+ADDP4
+ARGP4
+ADDRGP4 CG_PrintEntityStatep
+CALLV
+pop
+LABELV $843
+endproc CG_PrintNextEntityState_f 12 4
+proc CG_ClearFragMessage_f 0 0
+ADDRGP4 cg+1330284
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1329260
+CNSTI1 0
+ASGNI1
+LABELV $847
+endproc CG_ClearFragMessage_f 0 0
+proc CG_GotoView_f 84 24
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $851
+ADDRGP4 $850
+JUMPV
+LABELV $851
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+NEI4 $854
+ADDRGP4 $850
+JUMPV
+LABELV $854
+ADDRGP4 cg+1335044
+INDIRI4
+CNSTI4 0
+EQI4 $857
+ADDRGP4 CG_GotoViewPointMark_f
+CALLV
+pop
+ADDRGP4 $850
+JUMPV
+LABELV $857
+ADDRLP4 56
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1334988
+INDIRI4
+CNSTI4 -1
+LEI4 $860
+ADDRLP4 12
+CNSTI4 1496
+ADDRGP4 cg+1334988
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRGP4 $861
+JUMPV
+LABELV $860
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $864
+ADDRLP4 60
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $865
+JUMPV
+LABELV $864
+ADDRLP4 60
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $865
+ADDRLP4 12
+CNSTI4 1496
+ADDRLP4 60
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRGP4 cg+1332120
+CNSTI4 1
+ASGNI4
+LABELV $861
+ADDRLP4 60
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LTI4 $869
+CNSTI4 1
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 68
+INDIRF4
+ASGNF4
+LABELV $869
+ADDRLP4 64
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+LTI4 $871
+CNSTI4 2
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+LABELV $871
+ADDRLP4 68
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 4
+LTI4 $873
+CNSTI4 3
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+LABELV $873
+ADDRLP4 72
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 5
+LTI4 $875
+CNSTI4 4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 80
+INDIRI4
+ASGNI4
+LABELV $875
+ADDRLP4 76
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $877
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+1332224+20
+ADDRLP4 12
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRGP4 cg+1332224+20+8
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+SUBF4
+ASGNF4
+ADDRGP4 cg+1332224+152
+ADDRLP4 12
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 cg+1332224+20
+ADDRGP4 cg+1332224+20
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332224+20+4
+ADDRGP4 cg+1332224+20+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332224+20+8
+ADDRGP4 cg+1332224+20+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332224+20
+ADDRGP4 cg+1332224+20
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332224+20+4
+ADDRGP4 cg+1332224+20+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332224+20+8
+ADDRGP4 cg+1332224+20+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332224+20
+ADDRGP4 cg+1332224+20
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332224+20+4
+ADDRGP4 cg+1332224+20+4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332224+20+8
+ADDRGP4 cg+1332224+20+8
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $939
+ADDRGP4 cg+1332224+20
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_AdjustOriginToAvoidSolid
+CALLV
+pop
+LABELV $939
+LABELV $850
+endproc CG_GotoView_f 84 24
+proc CG_ServerTime_f 0 8
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $944
+ADDRGP4 $943
+JUMPV
+LABELV $944
+ADDRGP4 $947
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $943
+endproc CG_ServerTime_f 0 8
+proc CG_DumpStats_f 32 8
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $950
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $951
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $951
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $955
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $959
+ADDRLP4 16
+ADDRGP4 cg+3196932
+ASGNP4
+ADDRLP4 24
+ADDRGP4 cg+3848208
+INDIRI4
+ASGNI4
+ADDRGP4 $960
+JUMPV
+LABELV $959
+ADDRLP4 16
+ADDRGP4 cg+3196932+5088
+ASGNP4
+ADDRLP4 24
+ADDRGP4 cg+3848212
+INDIRI4
+ASGNI4
+LABELV $960
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $967
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $968
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $969
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $970
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $971
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4544
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $972
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4548
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $973
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4556
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $974
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4576
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $975
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4580
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $976
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4584
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $977
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4588
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $978
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4592
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $979
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4596
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $980
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4600
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $981
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4604
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $982
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4560
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $983
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4564
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $984
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4568
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $988
+JUMPV
+LABELV $985
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4608
+ADDP4
+ADDP4
+ASGNP4
+ADDRGP4 $989
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $990
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 weapNamesCasual
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $991
+ARGP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $992
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $972
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $973
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $970
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $986
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $988
+ADDRLP4 0
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $985
+LABELV $956
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LTI4 $955
+ADDRGP4 $952
+JUMPV
+LABELV $951
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $993
+ADDRLP4 12
+CNSTI4 124
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3848480
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $998
+ADDRGP4 $994
+JUMPV
+LABELV $998
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1000
+ADDRGP4 $994
+JUMPV
+LABELV $1000
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $967
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $968
+ARGP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1005
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1006
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1007
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1008
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1009
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1010
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1011
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1012
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1013
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1014
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1015
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1016
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1017
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1018
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1019
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1020
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1021
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $994
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $993
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1022
+ADDRLP4 12
+CNSTI4 60
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3861920
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1027
+ADDRGP4 $1023
+JUMPV
+LABELV $1027
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1029
+ADDRGP4 $1023
+JUMPV
+LABELV $1029
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $967
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $968
+ARGP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1034
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1035
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1036
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1005
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1006
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1037
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1038
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1039
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1040
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1041
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1042
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1023
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1022
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1043
+ADDRLP4 12
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3871032
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1048
+ADDRGP4 $1044
+JUMPV
+LABELV $1048
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1050
+ADDRGP4 $1044
+JUMPV
+LABELV $1050
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $967
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $968
+ARGP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1034
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1005
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1006
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1037
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1038
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1039
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1040
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1041
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1042
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1055
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1056
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1057
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1044
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1043
+LABELV $952
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1058
+ADDRGP4 $949
+JUMPV
+LABELV $1058
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1063
+JUMPV
+LABELV $1060
+ADDRLP4 12
+CNSTI4 92
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1066
+ADDRGP4 $1061
+JUMPV
+LABELV $1066
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $967
+ARGP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $968
+ARGP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1071
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $969
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1072
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $972
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1074
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1075
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1076
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1077
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1078
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1079
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1080
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1081
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1082
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $971
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1084
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1061
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1063
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $1060
+LABELV $949
+endproc CG_DumpStats_f 32 8
+proc CG_SetLoopStart_f 12 4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1086
+ADDRGP4 $1085
+JUMPV
+LABELV $1086
+ADDRLP4 0
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $1089
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+1335064
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1090
+JUMPV
+LABELV $1089
+ADDRGP4 cg+1335064
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1090
+LABELV $1085
+endproc CG_SetLoopStart_f 12 4
+proc CG_SetLoopEnd_f 12 4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1095
+ADDRGP4 $1094
+JUMPV
+LABELV $1095
+ADDRLP4 0
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $1098
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+1335068
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1099
+JUMPV
+LABELV $1098
+ADDRGP4 cg+1335068
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1099
+LABELV $1094
+endproc CG_SetLoopEnd_f 12 4
+proc CG_Loop_f 20 4
+ADDRLP4 0
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LEI4 $1104
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+1335064
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+1335068
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $1104
+ADDRGP4 cg+1335072
+INDIRI4
+CNSTI4 0
+NEI4 $1111
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1112
+JUMPV
+LABELV $1111
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1112
+ADDRGP4 cg+1335072
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1103
+endproc CG_Loop_f 20 4
+proc CG_FragForward_f 44 8
+ADDRLP4 4
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $1114
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1116
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1114
+ADDRGP4 $1117
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+1335076
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1113
+JUMPV
+LABELV $1114
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1119
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1120
+JUMPV
+LABELV $1119
+ADDRLP4 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1120
+ADDRGP4 cg+1335076
+INDIRI4
+CNSTI4 0
+NEI4 $1126
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1127
+JUMPV
+LABELV $1126
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $1127
+ADDRGP4 cg+1335076
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $1128
+ARGP4
+ADDRGP4 cg+1335076
+INDIRI4
+CNSTI4 0
+EQI4 $1133
+ADDRLP4 24
+ADDRGP4 $1130
+ASGNP4
+ADDRGP4 $1134
+JUMPV
+LABELV $1133
+ADDRLP4 24
+ADDRGP4 $1131
+ASGNP4
+LABELV $1134
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+1335076
+INDIRI4
+CNSTI4 0
+NEI4 $1135
+ADDRGP4 $1113
+JUMPV
+LABELV $1135
+ADDRGP4 cg+1335076
+INDIRI4
+CNSTI4 0
+EQI4 $1138
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1141
+LABELV $1141
+ADDRGP4 cg+1335088
+CNSTI4 0
+ASGNI4
+ADDRGP4 wcg+24
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+SUBI4
+ASGNI4
+LABELV $1138
+ADDRLP4 28
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LEI4 $1145
+CNSTI4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1335080
+CNSTF4 1148846080
+ADDRLP4 36
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1145
+ADDRGP4 cg+1335080
+CNSTI4 5000
+ASGNI4
+LABELV $1146
+ADDRLP4 32
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LEI4 $1149
+CNSTI4 2
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1335084
+CNSTF4 1148846080
+ADDRLP4 40
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1150
+JUMPV
+LABELV $1149
+ADDRGP4 cg+1335084
+CNSTI4 3000
+ASGNI4
+LABELV $1150
+LABELV $1113
+endproc CG_FragForward_f 44 8
+proc CG_RecordPath_f 40 16
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1154
+ADDRGP4 $1153
+JUMPV
+LABELV $1154
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332752
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1161
+ADDRGP4 cg+1332740
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1157
+LABELV $1161
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 cg+1332744
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332752
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332740
+INDIRI4
+CNSTI4 0
+EQI4 $1165
+ADDRGP4 $1168
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+1332908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332740
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1153
+JUMPV
+LABELV $1165
+LABELV $1157
+ADDRGP4 cg+1332740
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+LEI4 $1172
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1177
+JUMPV
+LABELV $1174
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $1178
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1173
+JUMPV
+LABELV $1178
+LABELV $1175
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1177
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 28
+INDIRU4
+LTU4 $1174
+ADDRGP4 $1173
+JUMPV
+LABELV $1172
+ADDRLP4 4
+ADDRGP4 $1180
+ASGNP4
+LABELV $1173
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1181
+ADDRGP4 $1183
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 cg+1332744
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $1182
+JUMPV
+LABELV $1181
+ADDRGP4 $1185
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 cg+1332744
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $1182
+ADDRGP4 cg+1332744
+INDIRI4
+CNSTI4 0
+NEI4 $1187
+ADDRGP4 $1190
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+1332740
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1153
+JUMPV
+LABELV $1187
+ADDRGP4 cg+1332748
+CNSTI4 -1
+ASGNI4
+ADDRLP4 24
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRGP4 $1195
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_Cvar_Get
+CALLF4
+ASGNF4
+ADDRGP4 $1193
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $1153
+endproc CG_RecordPath_f 40 16
+proc CG_PlayPath_f 64 40
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3196784
+INDIRI4
+CNSTI4 0
+EQI4 $1198
+ADDRGP4 $1201
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1197
+JUMPV
+LABELV $1198
+ADDRGP4 cg+3196788
+INDIRI4
+CNSTI4 0
+EQI4 $1202
+ADDRGP4 $1205
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1197
+JUMPV
+LABELV $1202
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332740
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $1210
+ADDRGP4 cg+1332752
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $1206
+LABELV $1210
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 cg+1332744
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332740
+INDIRI4
+CNSTI4 0
+EQI4 $1213
+ADDRGP4 $1168
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+1332908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332740
+CNSTI4 0
+ASGNI4
+LABELV $1213
+LABELV $1206
+ADDRLP4 32
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+LEI4 $1218
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1223
+JUMPV
+LABELV $1220
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $1224
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1219
+JUMPV
+LABELV $1224
+LABELV $1221
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1223
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 40
+INDIRU4
+LTU4 $1220
+ADDRGP4 $1219
+JUMPV
+LABELV $1218
+ADDRLP4 12
+ADDRGP4 $1180
+ASGNP4
+LABELV $1219
+ADDRGP4 cg+1332752
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1227
+ADDRGP4 $1183
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 cg+1332744
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $1228
+JUMPV
+LABELV $1227
+ADDRGP4 $1185
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 cg+1332744
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $1228
+ADDRGP4 cg+1332744
+INDIRI4
+CNSTI4 0
+NEI4 $1231
+ADDRGP4 $1190
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+1332752
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1197
+JUMPV
+LABELV $1231
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1236
+LABELV $1238
+ADDRGP4 $1239
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+1332752
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1197
+JUMPV
+LABELV $1236
+ADDRGP4 $1241
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+1332752
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $1243
+ARGP4
+ADDRGP4 cg+1332756
+ARGP4
+ADDRGP4 cg+1332760
+ARGP4
+ADDRGP4 cg+1332764
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRGP4 cg+1332768
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+NEI4 $1249
+ADDRGP4 CG_FreeCam_f
+CALLV
+pop
+LABELV $1249
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1256
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 48
+INDIRI4
+EQI4 $1256
+ADDRLP4 8
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $1253
+LABELV $1256
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 cg+1332752
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1259
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1197
+JUMPV
+LABELV $1253
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $1260
+ARGP4
+ADDRGP4 cg+1332772
+ARGP4
+ADDRGP4 cg+1332776
+ARGP4
+ADDRGP4 cg+1332776+4
+ARGP4
+ADDRGP4 cg+1332776+8
+ARGP4
+ADDRGP4 cg+1332788
+ARGP4
+ADDRGP4 cg+1332788+4
+ARGP4
+ADDRGP4 cg+1332788+8
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 16
+ADDRGP4 cg_pathSkipNum+12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GTI4 $1273
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $1273
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1278
+JUMPV
+LABELV $1275
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $1276
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1278
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $1275
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1283
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 56
+INDIRI4
+EQI4 $1283
+ADDRLP4 8
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $1280
+LABELV $1283
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 cg+1332752
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1286
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1197
+JUMPV
+LABELV $1280
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $1260
+ARGP4
+ADDRGP4 cg+1332800
+ARGP4
+ADDRGP4 cg+1332804
+ARGP4
+ADDRGP4 cg+1332804+4
+ARGP4
+ADDRGP4 cg+1332804+8
+ARGP4
+ADDRGP4 cg+1332816
+ARGP4
+ADDRGP4 cg+1332816+4
+ARGP4
+ADDRGP4 cg+1332816+8
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRGP4 $1298
+ARGP4
+ADDRGP4 cg+1332772
+INDIRF4
+ADDRGP4 cg_pathRewindTime+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $1197
+endproc CG_PlayPath_f 64 40
+proc CG_StopPlayPath_f 0 4
+ADDRGP4 cg+1332752
+INDIRI4
+CNSTI4 0
+NEI4 $1302
+ADDRGP4 $1301
+JUMPV
+LABELV $1302
+ADDRGP4 cg+1332752
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 cg+1332744
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1308
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1301
+endproc CG_StopPlayPath_f 0 4
+proc CG_CenterRoll_f 0 0
+ADDRGP4 cg+1332136+8
+CNSTF4 0
+ASGNF4
+LABELV $1309
+endproc CG_CenterRoll_f 0 0
+proc CG_DrawRawPath_f 60 40
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+1332752
+INDIRI4
+CNSTI4 0
+EQI4 $1313
+ADDRGP4 $1316
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1312
+JUMPV
+LABELV $1313
+ADDRGP4 cg+1332740
+INDIRI4
+CNSTI4 0
+EQI4 $1317
+ADDRGP4 $1320
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1312
+JUMPV
+LABELV $1317
+ADDRGP4 cg+2121552
+INDIRI4
+CNSTI4 0
+EQI4 $1321
+ADDRGP4 cg+2121552
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1312
+JUMPV
+LABELV $1321
+ADDRLP4 36
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+LEI4 $1325
+CNSTI4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1330
+JUMPV
+LABELV $1327
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $1331
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1326
+JUMPV
+LABELV $1331
+LABELV $1328
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1330
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16
+INDIRI4
+CVIU4 4
+ADDRLP4 44
+INDIRU4
+LTU4 $1327
+ADDRGP4 $1326
+JUMPV
+LABELV $1325
+ADDRLP4 24
+ADDRGP4 $1180
+ASGNP4
+LABELV $1326
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1333
+ADDRGP4 $1183
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $1334
+JUMPV
+LABELV $1333
+ADDRGP4 $1185
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $1334
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1335
+ADDRGP4 $1190
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1312
+JUMPV
+LABELV $1335
+ADDRGP4 cg+2121552
+INDIRI4
+CNSTI4 0
+EQI4 $1337
+ADDRGP4 cg+2121552
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1312
+JUMPV
+LABELV $1337
+ADDRGP4 cg+2121552
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+pop
+ADDRGP4 $1343
+JUMPV
+LABELV $1342
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $1348
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1348
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+NEI4 $1345
+LABELV $1348
+ADDRGP4 $1344
+JUMPV
+LABELV $1345
+ADDRGP4 cg+2121552
+INDIRI4
+CNSTI4 32768
+LTI4 $1349
+ADDRGP4 $1344
+JUMPV
+LABELV $1349
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+MODI4
+CNSTI4 0
+NEI4 $1352
+ADDRLP4 4
+CNSTI4 24
+ADDRGP4 cg+2121552
+INDIRI4
+MULI4
+ADDRGP4 cg+1335120
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRGP4 cg+2121552
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1260
+ARGP4
+ADDRGP4 cg+1332800
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+LABELV $1352
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1343
+ADDRGP4 $1342
+JUMPV
+LABELV $1344
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $1312
+endproc CG_DrawRawPath_f 60 40
+data
+align 4
+LABELV LastAddedCameraPointPtr
+byte 4 0
+align 4
+LABELV LastAddedCameraPointSet
+byte 4 0
+code
+proc CG_AddCameraPoint_f 64 12
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+3196800
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $1361
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 1460
+ADDRGP4 cg+3196772
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 cg+3196772
+INDIRI4
+ASGNI4
+ADDRGP4 $1362
+JUMPV
+LABELV $1361
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1370
+JUMPV
+LABELV $1367
+ADDRGP4 cg+607152
+INDIRF4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+NEF4 $1372
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1369
+JUMPV
+LABELV $1372
+ADDRGP4 cg+607152
+INDIRF4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+GEF4 $1378
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 509
+LTI4 $1383
+ADDRGP4 $1386
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1358
+JUMPV
+LABELV $1383
+ADDRLP4 0
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1390
+JUMPV
+LABELV $1387
+ADDRLP4 28
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+2121556+1460
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+2121556
+ADDP4
+ARGP4
+CNSTU4 1460
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1388
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1390
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $1387
+ADDRLP4 8
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1369
+JUMPV
+LABELV $1378
+LABELV $1368
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1370
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $1367
+LABELV $1369
+LABELV $1362
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1396
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 509
+LTI4 $1398
+ADDRGP4 $1386
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1358
+JUMPV
+LABELV $1398
+ADDRLP4 8
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 cg+3196764
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+LABELV $1396
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_cameraAddUsePreviousValues+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $1404
+ADDRGP4 cg+3196764
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $1404
+ADDRGP4 LastAddedCameraPointSet
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $1404
+ADDRLP4 8
+INDIRP4
+ADDRGP4 LastAddedCameraPointPtr
+INDIRP4
+INDIRB
+ASGNB 1460
+ADDRGP4 $1405
+JUMPV
+LABELV $1404
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1460
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $1405
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_cameraAddUsePreviousValues+12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1417
+ADDRGP4 cg+3196764
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1417
+ADDRGP4 LastAddedCameraPointSet
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $1412
+LABELV $1417
+ADDRLP4 36
+ADDRGP4 cg_cameraDefaultOriginType+16
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 $1421
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $1419
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1420
+JUMPV
+LABELV $1419
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 $1424
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $1422
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1423
+JUMPV
+LABELV $1422
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 $1427
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $1425
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1426
+JUMPV
+LABELV $1425
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 $1430
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $1428
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1429
+JUMPV
+LABELV $1428
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 $1433
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $1431
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $1432
+JUMPV
+LABELV $1431
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 $1436
+ARGP4
+ADDRLP4 60
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $1434
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1435
+JUMPV
+LABELV $1434
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 4
+ASGNI4
+LABELV $1435
+LABELV $1432
+LABELV $1429
+LABELV $1426
+LABELV $1423
+LABELV $1420
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 40
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1456
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $1412
+ADDRGP4 LastAddedCameraPointSet
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1334988
+INDIRI4
+CNSTI4 -1
+LEI4 $1437
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cg+1334988
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRGP4 cg+1335012
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+1335016
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRGP4 cg+1335020
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1496
+ADDRGP4 cg+1334988
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1437
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1446
+ADDRLP4 36
+ADDRGP4 cg+3196764
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1446
+ADDRGP4 LastAddedCameraPointPtr
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1449
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 CG_UpdateCameraInfoExt
+CALLV
+pop
+ADDRGP4 $1450
+JUMPV
+LABELV $1449
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $1450
+ADDRGP4 cg+3196772
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3196776
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $1358
+endproc CG_AddCameraPoint_f 64 12
+proc CG_ClearCameraPoints_f 0 0
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196764
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196760
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+2869076
+CNSTP4 0
+ASGNP4
+ADDRGP4 CG_CameraPathChanged
+CALLV
+pop
+ADDRGP4 cg+3196772
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196776
+CNSTI4 0
+ASGNI4
+LABELV $1454
+endproc CG_ClearCameraPoints_f 0 0
+proc CG_PlayCamera_f 8 8
+ADDRGP4 cg+1332752
+INDIRI4
+CNSTI4 0
+EQI4 $1463
+ADDRGP4 $1466
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1462
+JUMPV
+LABELV $1463
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+GEI4 $1467
+ADDRGP4 $1470
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1462
+JUMPV
+LABELV $1467
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+CNSTI4 0
+EQI4 $1471
+ADDRLP4 0
+CNSTF4 1148846080
+ADDRGP4 cg_cameraRewindTime+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $1475
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $1475
+ADDRGP4 $1298
+ARGP4
+ADDRGP4 cg+2121556+40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $1471
+ADDRGP4 cg+3196784
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196796
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196812
+CNSTI4 1
+ASGNI4
+LABELV $1462
+endproc CG_PlayCamera_f 8 8
+proc CG_StopCamera_f 0 0
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+LABELV $1483
+endproc CG_StopCamera_f 0 0
+proc CG_WriteString 4 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $1486
+endproc CG_WriteString 4 12
+proc CG_SaveCamera_f 244 16
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+GEI4 $1488
+ADDRGP4 $1490
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1487
+JUMPV
+LABELV $1488
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+GEI4 $1491
+ADDRGP4 $1494
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1487
+JUMPV
+LABELV $1491
+CNSTI4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1498
+JUMPV
+LABELV $1495
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $1499
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1497
+JUMPV
+LABELV $1499
+LABELV $1496
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1498
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ADDRLP4 36
+INDIRU4
+LTU4 $1495
+LABELV $1497
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1501
+CNSTI4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1503
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $1502
+JUMPV
+LABELV $1501
+ADDRGP4 $1504
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $1502
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1505
+CNSTI4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1507
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1487
+JUMPV
+LABELV $1505
+ADDRGP4 $1508
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1512
+JUMPV
+LABELV $1509
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $1515
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1516
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1517
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1518
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1519
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1520
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1521
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1522
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1523
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1524
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1525
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1526
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1527
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1528
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1529
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1530
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1531
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1532
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1533
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1534
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1535
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1536
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1537
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1538
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 160
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1539
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1540
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 168
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1541
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 172
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1542
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1543
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 180
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1544
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1545
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1546
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 192
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1547
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 196
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1548
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1549
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1550
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1551
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1552
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1553
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 220
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1554
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1555
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRGP4 $1556
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 236
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 236
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $1557
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 240
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 240
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1558
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+LABELV $1558
+ADDRGP4 $1560
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WriteString
+CALLV
+pop
+LABELV $1510
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1512
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $1509
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $1487
+endproc CG_SaveCamera_f 244 16
+proc CG_CamtraceSave_f 1056 48
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+GEI4 $1562
+ADDRGP4 $1494
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1561
+JUMPV
+LABELV $1562
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRLP4 1036
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LTI4 $1565
+CNSTI4 1
+ARGI4
+ADDRLP4 1040
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1569
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $1567
+ADDRLP4 1032
+CNSTI4 1
+ASGNI4
+LABELV $1567
+LABELV $1565
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1573
+JUMPV
+LABELV $1570
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1575
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $1575
+ADDRLP4 1044
+ADDRGP4 cg+6747460
+INDIRI4
+ASGNI4
+ADDRGP4 $1576
+JUMPV
+LABELV $1575
+ADDRLP4 1044
+ADDRGP4 cg_fov+12
+INDIRI4
+ASGNI4
+LABELV $1576
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $1582
+ADDRGP4 $1584
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $1583
+JUMPV
+LABELV $1582
+ADDRGP4 $1585
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $1583
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1586
+ADDRGP4 $1588
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1572
+JUMPV
+LABELV $1586
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $1589
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1591
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+CNSTF4 3212836864
+NEF4 $1593
+ADDRLP4 1048
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRGP4 $1594
+JUMPV
+LABELV $1593
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $1594
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1590
+JUMPV
+LABELV $1589
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1595
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+CNSTF4 3212836864
+NEF4 $1598
+ADDRLP4 1048
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRGP4 $1599
+JUMPV
+LABELV $1598
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $1599
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $1590
+ADDRLP4 8
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1048
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $1571
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1573
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $1570
+LABELV $1572
+LABELV $1561
+endproc CG_CamtraceSave_f 1056 48
+proc CG_LoadCamera_f 236 20
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 36
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+GEI4 $1601
+ADDRGP4 $1603
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1600
+JUMPV
+LABELV $1601
+CNSTI4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1607
+JUMPV
+LABELV $1604
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $1608
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1606
+JUMPV
+LABELV $1608
+LABELV $1605
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1607
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 20
+INDIRI4
+CVIU4 4
+ADDRLP4 44
+INDIRU4
+LTU4 $1604
+LABELV $1606
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1610
+CNSTI4 1
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1503
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1611
+CNSTI4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1503
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $1611
+JUMPV
+LABELV $1610
+ADDRGP4 $1504
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1614
+ADDRGP4 $1504
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $1614
+LABELV $1611
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1616
+CNSTI4 1
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1190
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1600
+JUMPV
+LABELV $1616
+ADDRGP4 cg+3196764
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196760
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $1620
+ARGP4
+ADDRLP4 52
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 52
+INDIRU4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRGP4 $1622
+JUMPV
+LABELV $1621
+ADDRLP4 4
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1460
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1623
+LABELV $1627
+ADDRLP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1628
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1628
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 16
+INDIRI4
+CNSTI4 8
+LEI4 $1629
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRGP4 $1630
+JUMPV
+LABELV $1629
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $1630
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 92
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 96
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 100
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1628
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 108
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 112
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 112
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 116
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1628
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 124
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 132
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 140
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 144
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 148
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+GEI4 $1632
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+LABELV $1632
+ADDRLP4 16
+INDIRI4
+CNSTI4 7
+LEI4 $1634
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 160
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 164
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 168
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 172
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 176
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 180
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 184
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 184
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 188
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 192
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 196
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 200
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 204
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 208
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 212
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 212
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 216
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 216
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 220
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 220
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 224
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 224
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 228
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 228
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 232
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+LABELV $1634
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1636
+ADDRLP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+LABELV $1636
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1638
+ADDRGP4 $1640
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+3196764
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1623
+JUMPV
+LABELV $1638
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 160
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 164
+ADDRGP4 cg+3196764
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1622
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1621
+LABELV $1623
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+ADDRGP4 cg+3196772
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196776
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1645
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1600
+endproc CG_LoadCamera_f 236 20
+proc CG_SelectCameraPoint_f 56 8
+ADDRLP4 8
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+GEI4 $1647
+ADDRGP4 $1649
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1650
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1646
+JUMPV
+LABELV $1647
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1653
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1651
+ADDRGP4 cg+3196772
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196776
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1646
+JUMPV
+LABELV $1651
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1659
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1657
+ADDRLP4 24
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+LTI4 $1660
+ADDRGP4 cg+3196772
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1658
+JUMPV
+LABELV $1660
+ADDRGP4 cg+3196772
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196776
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1646
+JUMPV
+LABELV $1657
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $354
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $1665
+ADDRGP4 cg+3196772
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+3196776
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1646
+JUMPV
+LABELV $1665
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1673
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $1671
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 3
+GEI4 $1674
+ADDRGP4 $1646
+JUMPV
+LABELV $1674
+ADDRGP4 cg+3196772
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3196776
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $1672
+JUMPV
+LABELV $1671
+CNSTI4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+GEI4 $1683
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GEI4 $1680
+LABELV $1683
+ADDRGP4 $1684
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+3196772
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+3196776
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1646
+JUMPV
+LABELV $1680
+ADDRGP4 cg+3196772
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3196776
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1672
+LABELV $1658
+ADDRLP4 32
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 3
+LTI4 $1691
+CNSTI4 2
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 $354
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $1693
+ADDRGP4 cg+3196776
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1694
+JUMPV
+LABELV $1693
+CNSTI4 2
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+GEI4 $1700
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+GEI4 $1697
+LABELV $1700
+ADDRGP4 $1684
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+3196772
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+3196776
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1646
+JUMPV
+LABELV $1697
+ADDRGP4 cg+3196776
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1694
+LABELV $1691
+ADDRGP4 cg+3196772
+INDIRI4
+ADDRGP4 cg+3196776
+INDIRI4
+LEI4 $1706
+ADDRGP4 $1710
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+3196772
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+3196776
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1706
+LABELV $1646
+endproc CG_SelectCameraPoint_f 56 8
+proc CG_EditCameraPoint_f 40 12
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+GEI4 $1719
+ADDRLP4 0
+ADDRGP4 cg+3196772
+INDIRI4
+ASGNI4
+ADDRGP4 $1720
+JUMPV
+LABELV $1719
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1724
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1722
+ADDRLP4 0
+ADDRGP4 cg+3196772
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $1723
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1723
+JUMPV
+LABELV $1722
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1731
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $1729
+ADDRLP4 0
+ADDRGP4 cg+3196772
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1730
+ADDRLP4 0
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1730
+JUMPV
+LABELV $1729
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $1730
+LABELV $1723
+LABELV $1720
+ADDRLP4 16
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+LTI4 $1736
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1740
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $1738
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1738
+LABELV $1736
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1744
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $1741
+LABELV $1744
+ADDRGP4 $1684
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1715
+JUMPV
+LABELV $1741
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+LTI4 $1756
+ADDRLP4 24
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+2121556+28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1756
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+2121556+28
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1756
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+2121556+28
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $1745
+LABELV $1756
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1745
+ADDRGP4 cg+3196772
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3196776
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1759
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1761
+ADDRGP4 cg+1332224+20
+CNSTI4 12
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1236
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $1762
+JUMPV
+LABELV $1761
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+28
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1770
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 cg+1332224+20
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $1771
+JUMPV
+LABELV $1770
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1778
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 cg+1332224+20
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $1779
+JUMPV
+LABELV $1778
+ADDRGP4 cg+1332224+20
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1779
+LABELV $1771
+LABELV $1762
+ADDRGP4 cg+1332124
+ADDRGP4 cg+1332224+20
+INDIRB
+ASGNB 12
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+32
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1793
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cg+1332224+152
+ARGP4
+ADDRGP4 CG_CameraSplineAnglesAt
+CALLI4
+pop
+ADDRGP4 $1794
+JUMPV
+LABELV $1793
+ADDRGP4 cg+1332224+152
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+16
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1794
+ADDRGP4 cg+1332136
+ADDRGP4 cg+1332224+152
+INDIRB
+ASGNB 12
+ADDRGP4 $1760
+JUMPV
+LABELV $1759
+ADDRGP4 cg+1332224+20
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332124
+ADDRGP4 cg+1332224+20
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332224+152
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332136
+ADDRGP4 cg+1332224+152
+INDIRB
+ASGNB 12
+LABELV $1760
+ADDRLP4 28
+ADDRGP4 cg+1332224+20+8
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+SUBF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg+1332124+8
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+SUBF4
+ASGNF4
+ADDRGP4 cg+1332224+32
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332224+32+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332224+32+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1835
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1298
+ARGP4
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommandNow
+CALLV
+pop
+ADDRGP4 cg+3196800
+CNSTI4 1
+ASGNI4
+LABELV $1715
+endproc CG_EditCameraPoint_f 40 12
+proc CG_DeleteCameraPoint_f 16 12
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 0
+NEI4 $1842
+ADDRGP4 $1839
+JUMPV
+LABELV $1842
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1848
+JUMPV
+LABELV $1845
+ADDRGP4 $1851
+ARGP4
+ADDRGP4 cg+3196776
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 cg+3196772
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 1460
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+3196772
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+3196776
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ARGP4
+CNSTU4 1460
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1846
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1848
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRGP4 cg+3196776
+INDIRI4
+SUBI4
+LTI4 $1845
+ADDRGP4 cg+3196764
+ADDRGP4 cg+3196772
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDI4
+ADDRGP4 cg+3196776
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+3196772
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+3196776
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $1839
+endproc CG_DeleteCameraPoint_f 16 12
+proc FindQuadratic 48 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 20
+INDIRF4
+SUBF4
+MULF4
+SUBF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+SUBF4
+MULF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRFP4 28
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 24
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+SUBF4
+MULF4
+SUBF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRFP4 32
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 24
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 28
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $1866
+endproc FindQuadratic 48 0
+proc CameraCurveDistance 72 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+CNSTI4 500
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1873
+JUMPV
+LABELV $1870
+ADDRLP4 48
+CNSTI4 40
+ASGNI4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 1436
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+SUBF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+DIVF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1874
+ADDRLP4 60
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1396
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 60
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1408
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 60
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1420
+ADDP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1875
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1874
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LEI4 $1878
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 60
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1878
+ADDRLP4 28
+ADDRLP4 8
+INDIRB
+ASGNB 12
+LABELV $1871
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1873
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $1870
+ADDRLP4 40
+INDIRF4
+RETF4
+LABELV $1867
+endproc CameraCurveDistance 72 8
+proc CG_UpdateCameraInfoExt 436 36
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+GEI4 $1883
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 0
+NEI4 $1886
+ADDRGP4 cg+2869076
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1887
+JUMPV
+LABELV $1886
+ADDRGP4 cg+2869076
+ADDRGP4 cg+2121556
+ASGNP4
+ADDRGP4 cg+2121556+1448
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+2121556+1444
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+2121556+1452
+CNSTF4 3212836864
+ASGNF4
+LABELV $1887
+ADDRGP4 CG_CameraPathChanged
+CALLV
+pop
+ADDRGP4 $1880
+JUMPV
+LABELV $1883
+ADDRLP4 120
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+SUBI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+GEI4 $1898
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1899
+JUMPV
+LABELV $1898
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $1900
+ADDRGP4 $1903
+ARGP4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 cg+3196764
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1880
+JUMPV
+LABELV $1900
+LABELV $1899
+ADDRLP4 20
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $1908
+JUMPV
+LABELV $1905
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1910
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1448
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 208
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRGP4 cg+2121556+1444
+ADDP4
+ADDRLP4 208
+INDIRI4
+ADDRGP4 cg+2121556+1460
+ADDP4
+ASGNP4
+ADDRGP4 $1911
+JUMPV
+LABELV $1910
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+NEI4 $1918
+ADDRLP4 208
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRGP4 cg+2121556+1448
+ADDP4
+ADDRLP4 208
+INDIRI4
+ADDRGP4 cg+2121556-1460
+ADDP4
+ASGNP4
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1444
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1919
+JUMPV
+LABELV $1918
+ADDRLP4 208
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRGP4 cg+2121556+1448
+ADDP4
+ADDRLP4 208
+INDIRI4
+ADDRGP4 cg+2121556-1460
+ADDP4
+ASGNP4
+ADDRLP4 212
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+ADDRGP4 cg+2121556+1444
+ADDP4
+ADDRLP4 212
+INDIRI4
+ADDRGP4 cg+2121556+1460
+ADDP4
+ASGNP4
+LABELV $1919
+LABELV $1911
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1452
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+LABELV $1906
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1908
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $1905
+ADDRGP4 cg+2869076
+ADDRGP4 cg+2121556
+ASGNP4
+ADDRGP4 CG_CameraPathChanged
+CALLV
+pop
+ADDRGP4 cg+3196760
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1943
+JUMPV
+LABELV $1940
+ADDRLP4 208
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $1945
+ADDRGP4 $1941
+JUMPV
+LABELV $1945
+ADDRLP4 212
+ADDRGP4 cg+3196760
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ADDRLP4 212
+INDIRP4
+INDIRI4
+ADDRLP4 208
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1941
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1943
+ADDRLP4 20
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LTI4 $1940
+ADDRLP4 100
+CNSTF4 1020054733
+ASGNF4
+ADDRLP4 116
+ADDRGP4 cg+2869076
+INDIRP4
+ASGNP4
+ADDRGP4 $1950
+JUMPV
+LABELV $1949
+ADDRLP4 116
+ADDRLP4 116
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1950
+ADDRLP4 116
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1952
+ADDRLP4 116
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1949
+LABELV $1952
+ADDRLP4 184
+CNSTP4 0
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1953
+ADDRLP4 184
+ADDRLP4 116
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1956
+JUMPV
+LABELV $1955
+ADDRLP4 184
+ADDRLP4 184
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1956
+ADDRLP4 184
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1958
+ADDRLP4 184
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1955
+LABELV $1958
+LABELV $1953
+ADDRLP4 112
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556-1460
+ADDP4
+ASGNP4
+ADDRGP4 $1963
+JUMPV
+LABELV $1962
+ADDRLP4 112
+ADDRLP4 112
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1963
+ADDRLP4 112
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1965
+ADDRLP4 112
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1962
+LABELV $1965
+ADDRLP4 216
+CNSTU4 0
+ASGNU4
+ADDRLP4 116
+INDIRP4
+CVPU4 4
+ADDRLP4 216
+INDIRU4
+EQU4 $1969
+ADDRLP4 184
+INDIRP4
+CVPU4 4
+ADDRLP4 216
+INDIRU4
+EQU4 $1969
+ADDRLP4 112
+INDIRP4
+CVPU4 4
+ADDRLP4 216
+INDIRU4
+NEU4 $1966
+LABELV $1969
+ADDRGP4 $1970
+JUMPV
+LABELV $1966
+ADDRLP4 224
+CNSTI4 4
+ASGNI4
+ADDRLP4 228
+ADDRLP4 116
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 228
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 60
+ADDRLP4 228
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 88
+ADDRLP4 228
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 188
+ADDRLP4 228
+INDIRP4
+INDIRF4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+CNSTI4 8
+ASGNI4
+ADDRLP4 188+4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 236
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 236
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 240
+CNSTI4 12
+ASGNI4
+ADDRLP4 188+8
+ADDRLP4 116
+INDIRP4
+ADDRLP4 240
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 240
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 244
+CNSTI4 4
+ASGNI4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 244
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 244
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 248
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 252
+CNSTF4 1077936128
+CNSTF4 1065353216
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 48
+INDIRF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 252
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48+4
+ADDRLP4 48+4
+INDIRF4
+ADDRLP4 188+4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48+8
+ADDRLP4 48+8
+INDIRF4
+ADDRLP4 188+8
+INDIRF4
+CNSTF4 1077936128
+CNSTF4 1065353216
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 256
+CNSTF4 1077936128
+CNSTF4 1059648963
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 60
+INDIRF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 256
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 188+4
+INDIRF4
+ADDRLP4 256
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60+8
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 188+8
+INDIRF4
+CNSTF4 1077936128
+CNSTF4 1059648963
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 260
+CNSTF4 1077936128
+CNSTF4 1051260355
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 88
+INDIRF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 260
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88+4
+ADDRLP4 88+4
+INDIRF4
+ADDRLP4 188+4
+INDIRF4
+ADDRLP4 260
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88+8
+ADDRLP4 88+8
+INDIRF4
+ADDRLP4 188+8
+INDIRF4
+CNSTF4 1077936128
+CNSTF4 1051260355
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 264
+ADDRLP4 112
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 264
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 160
+ADDRLP4 264
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 172
+ADDRLP4 264
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+4
+ADDP4
+ADDRLP4 148
+INDIRB
+ASGNB 12
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1460+4
+ADDP4
+ADDRLP4 160
+INDIRB
+ASGNB 12
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+2920+4
+ADDP4
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $2002
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 cg+2121556+48
+ADDP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 cg+2121556+1456
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $2012
+ADDRLP4 268
+CNSTI4 1460
+ASGNI4
+ADDRLP4 268
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 cg+2121556+1448
+ADDP4
+ADDRLP4 268
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556-1460
+ADDP4
+ASGNP4
+ADDRGP4 $2013
+JUMPV
+LABELV $2012
+ADDRLP4 268
+CNSTI4 1460
+ASGNI4
+ADDRLP4 268
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 cg+2121556+1448
+ADDP4
+ADDRLP4 268
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 cg+2121556-1460
+ADDP4
+ASGNP4
+LABELV $2013
+LABELV $2003
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+LTI4 $2002
+ADDRLP4 20
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $2029
+JUMPV
+LABELV $2026
+ADDRLP4 16
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1364
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1368
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1372
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1376
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1380
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1384
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1388
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1392
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2032
+ADDRGP4 $2027
+JUMPV
+LABELV $2032
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2035
+JUMPV
+LABELV $2034
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2035
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2037
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2034
+LABELV $2037
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2038
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2041
+JUMPV
+LABELV $2040
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2041
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2043
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2040
+LABELV $2043
+LABELV $2038
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2044
+ADDRLP4 0
+INDIRP4
+CNSTI4 1236
+ADDP4
+ADDRGP4 cg+3196760
+INDIRI4
+ASGNI4
+LABELV $2044
+ADDRLP4 200
+ADDRGP4 cg+3196760
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTF4 1065353216
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+48
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2053
+JUMPV
+LABELV $2050
+ADDRLP4 272
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2054
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+ADDRLP4 4
+INDIRI4
+SUBI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 -3
+NEI4 $2058
+ADDRLP4 276
+ADDRLP4 48
+INDIRB
+ASGNB 12
+ADDRGP4 $2059
+JUMPV
+LABELV $2058
+ADDRLP4 12
+INDIRI4
+CNSTI4 -2
+NEI4 $2060
+ADDRLP4 276
+ADDRLP4 60
+INDIRB
+ASGNB 12
+ADDRGP4 $2061
+JUMPV
+LABELV $2060
+ADDRLP4 12
+INDIRI4
+CNSTI4 -1
+NEI4 $2062
+ADDRLP4 276
+ADDRLP4 88
+INDIRB
+ASGNB 12
+ADDRGP4 $2063
+JUMPV
+LABELV $2062
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $2065
+JUMPV
+LABELV $2064
+ADDRGP4 $2067
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2065
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2068
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2064
+LABELV $2068
+ADDRLP4 288
+CNSTI4 3
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $2070
+JUMPV
+LABELV $2069
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2072
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2075
+JUMPV
+LABELV $2074
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2075
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2077
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2074
+LABELV $2077
+LABELV $2072
+ADDRLP4 288
+ADDRLP4 288
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2070
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+GTI4 $2069
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2078
+ADDRLP4 276
+ADDRLP4 48
+INDIRB
+ASGNB 12
+ADDRGP4 $2079
+JUMPV
+LABELV $2078
+ADDRLP4 276
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2079
+LABELV $2063
+LABELV $2061
+LABELV $2059
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 288
+ADDRGP4 CG_CalcSpline
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 276
+INDIRF4
+ADDRLP4 288
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 292
+ADDRGP4 CG_CalcSpline
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+ADDRLP4 276+4
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 296
+ADDRGP4 CG_CalcSpline
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 276+8
+INDIRF4
+ADDRLP4 296
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2055
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $2054
+CNSTI4 12
+ADDRGP4 cg+3196760
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+CNSTI4 12
+ADDRGP4 cg+3196760
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080+4
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+CNSTI4 12
+ADDRGP4 cg+3196760
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080+8
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 cg+3196760
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3114840
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 276
+ADDRGP4 cg+3196760
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1056629064
+LEF4 $2093
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $2095
+LABELV $2095
+ADDRLP4 104
+CNSTI4 1
+ASGNI4
+LABELV $2093
+ADDRGP4 cg+3196760
+INDIRI4
+CNSTI4 20480
+LTI4 $2097
+ADDRGP4 $2100
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1970
+JUMPV
+LABELV $2097
+LABELV $2051
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2053
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065336439
+LTF4 $2050
+ADDRGP4 $2103
+ARGP4
+ADDRLP4 272
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $2101
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+GEI4 $2104
+ADDRGP4 $2107
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 cg+3196760
+INDIRI4
+ADDRLP4 200
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2104
+LABELV $2101
+LABELV $2027
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2029
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 3
+ADDI4
+LTI4 $2026
+ADDRLP4 16
+CNSTI4 1460
+ADDRLP4 120
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $2112
+JUMPV
+LABELV $2109
+ADDRLP4 16
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2114
+ADDRGP4 $2110
+JUMPV
+LABELV $2114
+ADDRLP4 288
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 4
+EQI4 $2116
+ADDRLP4 288
+INDIRI4
+CNSTI4 5
+EQI4 $2116
+ADDRGP4 $2110
+JUMPV
+LABELV $2116
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2118
+ADDRLP4 276
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2119
+JUMPV
+LABELV $2118
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2120
+ADDRLP4 276
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2121
+JUMPV
+LABELV $2120
+ADDRLP4 276
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2122
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2121
+LABELV $2119
+ADDRLP4 268
+ADDRLP4 16
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2124
+JUMPV
+LABELV $2123
+ADDRLP4 268
+ADDRLP4 268
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2124
+ADDRLP4 268
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2126
+ADDRLP4 268
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2123
+LABELV $2126
+ADDRLP4 268
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2127
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 276
+INDIRI4
+ARGI4
+CNSTI4 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2111
+JUMPV
+LABELV $2127
+ADDRLP4 300
+CNSTI4 1236
+ASGNI4
+ADDRLP4 272
+ADDRLP4 268
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 308
+CNSTI4 40
+ASGNI4
+ADDRLP4 284
+ADDRLP4 268
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 284
+INDIRF4
+ADDRLP4 272
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2133
+JUMPV
+LABELV $2130
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 280
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 276
+INDIRI4
+ARGI4
+CNSTI4 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+LABELV $2131
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2133
+ADDRLP4 20
+INDIRI4
+ADDRLP4 272
+INDIRI4
+LTI4 $2130
+LABELV $2110
+ADDRLP4 16
+ADDRLP4 16
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2112
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2109
+LABELV $2111
+LABELV $1970
+ADDRGP4 $2103
+ARGP4
+ADDRLP4 268
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $2135
+ADDRGP4 $2137
+ARGP4
+ADDRGP4 cg+3196760
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2135
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRGP4 $2142
+JUMPV
+LABELV $2139
+ADDRLP4 16
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2145
+ADDRGP4 $2140
+JUMPV
+LABELV $2145
+ADDRLP4 24
+ADDRLP4 16
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2148
+JUMPV
+LABELV $2147
+ADDRLP4 24
+ADDRLP4 24
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2148
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2150
+ADDRLP4 24
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2147
+LABELV $2150
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2151
+ADDRGP4 $2141
+JUMPV
+LABELV $2151
+ADDRLP4 280
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2153
+ADDRLP4 280
+ADDRLP4 24
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2156
+JUMPV
+LABELV $2155
+ADDRLP4 280
+ADDRLP4 280
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2156
+ADDRLP4 280
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2158
+ADDRLP4 280
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2155
+LABELV $2158
+LABELV $2153
+ADDRLP4 280
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2159
+ADDRLP4 280
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2159
+ADDRLP4 280
+CNSTP4 0
+ASGNP4
+LABELV $2159
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2161
+ADDRLP4 40
+ADDRLP4 16
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2164
+JUMPV
+LABELV $2163
+ADDRLP4 40
+ADDRLP4 40
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2164
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2166
+ADDRLP4 40
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2163
+LABELV $2166
+LABELV $2161
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2167
+ADDRLP4 40
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2167
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+LABELV $2167
+ADDRLP4 276
+CNSTP4 0
+ASGNP4
+ADDRLP4 300
+CNSTU4 0
+ASGNU4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+ADDRLP4 300
+INDIRU4
+EQU4 $2169
+ADDRLP4 40
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 300
+INDIRU4
+EQU4 $2169
+ADDRLP4 276
+ADDRLP4 40
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2172
+JUMPV
+LABELV $2171
+ADDRLP4 276
+ADDRLP4 276
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2172
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2174
+ADDRLP4 276
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2171
+LABELV $2174
+LABELV $2169
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2175
+ADDRLP4 276
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2175
+ADDRLP4 276
+CNSTP4 0
+ASGNP4
+LABELV $2175
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2177
+ADDRLP4 16
+INDIRP4
+CNSTI4 1440
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 204
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 120
+INDIRI4
+GEI4 $2179
+ADDRGP4 $2140
+JUMPV
+LABELV $2179
+ADDRLP4 280
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2181
+ADDRLP4 24
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2183
+ADDRLP4 24
+INDIRP4
+CNSTI4 1440
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+LABELV $2183
+LABELV $2181
+ADDRLP4 320
+CNSTP4 0
+ASGNP4
+ADDRLP4 312
+ADDRLP4 320
+INDIRP4
+ASGNP4
+ADDRLP4 316
+ADDRLP4 320
+INDIRP4
+ASGNP4
+ADDRLP4 308
+ADDRLP4 320
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1440
+ADDP4
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $2185
+ADDRLP4 308
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 316
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 312
+ADDRLP4 280
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2187
+ADDRLP4 40
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2187
+ADDRLP4 148
+CNSTI4 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2188
+JUMPV
+LABELV $2187
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2190
+ADDRLP4 40
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2190
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2191
+JUMPV
+LABELV $2190
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2192
+ADDRLP4 40
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2192
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2193
+JUMPV
+LABELV $2192
+ADDRLP4 148
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2193
+LABELV $2191
+LABELV $2188
+ADDRLP4 316
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2194
+ADDRLP4 160
+ADDRLP4 316
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2194
+ADDRLP4 312
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2186
+ADDRLP4 312
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2198
+ADDRLP4 172
+CNSTI4 12
+ADDRLP4 312
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2186
+JUMPV
+LABELV $2198
+ADDRLP4 312
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2201
+ADDRLP4 312
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRLP4 172
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2186
+JUMPV
+LABELV $2201
+ADDRLP4 312
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2203
+ADDRLP4 312
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 172
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2186
+JUMPV
+LABELV $2203
+ADDRLP4 172
+ADDRLP4 312
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2186
+JUMPV
+LABELV $2185
+ADDRLP4 308
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 316
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 312
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 324
+CNSTU4 0
+ASGNU4
+ADDRLP4 308
+INDIRP4
+CVPU4 4
+ADDRLP4 324
+INDIRU4
+EQU4 $2205
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+ADDRLP4 324
+INDIRU4
+EQU4 $2205
+ADDRLP4 276
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2205
+ADDRLP4 148
+CNSTI4 12
+ADDRLP4 308
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2206
+JUMPV
+LABELV $2205
+ADDRLP4 332
+CNSTU4 0
+ASGNU4
+ADDRLP4 308
+INDIRP4
+CVPU4 4
+ADDRLP4 332
+INDIRU4
+EQU4 $2208
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+ADDRLP4 332
+INDIRU4
+EQU4 $2208
+ADDRLP4 276
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2208
+ADDRLP4 308
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2209
+JUMPV
+LABELV $2208
+ADDRLP4 340
+CNSTU4 0
+ASGNU4
+ADDRLP4 308
+INDIRP4
+CVPU4 4
+ADDRLP4 340
+INDIRU4
+EQU4 $2210
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+ADDRLP4 340
+INDIRU4
+EQU4 $2210
+ADDRLP4 276
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2210
+ADDRLP4 308
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2211
+JUMPV
+LABELV $2210
+ADDRLP4 148
+ADDRLP4 308
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2211
+LABELV $2209
+LABELV $2206
+ADDRLP4 316
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2212
+ADDRLP4 160
+ADDRLP4 316
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2212
+ADDRLP4 312
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2214
+ADDRLP4 312
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2216
+ADDRLP4 172
+CNSTI4 12
+ADDRLP4 312
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2217
+JUMPV
+LABELV $2216
+ADDRLP4 312
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2219
+ADDRLP4 312
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRLP4 172
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2220
+JUMPV
+LABELV $2219
+ADDRLP4 312
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2221
+ADDRLP4 312
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 172
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2222
+JUMPV
+LABELV $2221
+ADDRLP4 172
+ADDRLP4 312
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2222
+LABELV $2220
+LABELV $2217
+LABELV $2214
+LABELV $2186
+ADDRLP4 324
+CNSTU4 0
+ASGNU4
+ADDRLP4 308
+INDIRP4
+CVPU4 4
+ADDRLP4 324
+INDIRU4
+EQU4 $2223
+ADDRLP4 316
+INDIRP4
+CVPU4 4
+ADDRLP4 324
+INDIRU4
+EQU4 $2223
+ADDRLP4 312
+INDIRP4
+CVPU4 4
+ADDRLP4 324
+INDIRU4
+EQU4 $2223
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2225
+CNSTF4 0
+ARGF4
+ADDRLP4 328
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+ADDRLP4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 332
+CNSTI4 40
+ASGNI4
+ADDRLP4 336
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 340
+ADDRLP4 308
+INDIRP4
+ADDRLP4 332
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 332
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+DIVF4
+ADDRLP4 340
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 328
+INDIRI4
+ADDRLP4 160
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 332
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+DIVF4
+ADDRLP4 340
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 328
+INDIRI4
+ADDRLP4 172
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 328
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1396
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 328
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1408
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 328
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1420
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 FindQuadratic
+CALLV
+pop
+ADDRLP4 16
+INDIRP4
+CNSTI4 1432
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2226
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $2225
+ADDRLP4 16
+INDIRP4
+CNSTI4 1436
+ADDP4
+ADDRLP4 308
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $2224
+JUMPV
+LABELV $2223
+ADDRGP4 $2229
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 308
+INDIRP4
+ARGP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 16
+INDIRP4
+CNSTI4 1432
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2224
+LABELV $2177
+ADDRLP4 20
+INDIRI4
+ADDRLP4 120
+INDIRI4
+GEI4 $2230
+ADDRGP4 $2140
+JUMPV
+LABELV $2230
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2232
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2237
+JUMPV
+LABELV $2234
+ADDRLP4 308
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+ADDRGP4 cg+2869080
+ADDP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ADDRGP4 cg+2869080+12
+ADDP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 316
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRF4
+ADDRLP4 312
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2235
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2237
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+LTI4 $2234
+ADDRLP4 312
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 320
+CNSTI4 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+ADDRGP4 cg+2869080
+ADDP4
+ARGP4
+ADDRLP4 320
+INDIRI4
+ADDRGP4 cg+2869080+12
+ADDP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 332
+CNSTI4 40
+ASGNI4
+ADDRLP4 340
+CNSTI4 1236
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 324
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 332
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 332
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 340
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 340
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+CNSTF4 981668463
+LEF4 $2244
+ADDRLP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2245
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+LEF4 $2248
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2248
+ADDRLP4 352
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 352
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 352
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 360
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2245
+JUMPV
+LABELV $2244
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2245
+ADDRLP4 344
+CNSTI4 12
+ADDRLP4 24
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+ADDRGP4 cg+2869080-12
+ADDP4
+ARGP4
+ADDRLP4 344
+INDIRI4
+ADDRGP4 cg+2869080-24
+ADDP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 356
+CNSTI4 40
+ASGNI4
+ADDRLP4 364
+CNSTI4 1236
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 348
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 356
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 356
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 364
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 364
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+CNSTF4 981668463
+LEF4 $2254
+ADDRLP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2233
+ADDRLP4 372
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ADDRLP4 372
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2233
+JUMPV
+LABELV $2254
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2233
+JUMPV
+LABELV $2232
+ADDRLP4 308
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 4
+EQI4 $2260
+ADDRLP4 308
+INDIRI4
+CNSTI4 5
+NEI4 $2258
+LABELV $2260
+ADDRLP4 320
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2261
+ADDRLP4 320
+CNSTI4 1
+ASGNI4
+LABELV $2261
+ADDRLP4 360
+CNSTI4 40
+ASGNI4
+ADDRLP4 356
+ADDRLP4 24
+INDIRP4
+ADDRLP4 360
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 360
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 356
+INDIRF4
+CNSTF4 0
+GTF4 $2263
+ADDRGP4 $2265
+ARGP4
+ADDRLP4 364
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 364
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 364
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1880
+JUMPV
+LABELV $2263
+ADDRLP4 352
+CNSTI4 40
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 1
+GTI4 $2266
+ADDRGP4 $2268
+ARGP4
+ADDRLP4 352
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2266
+ADDRLP4 348
+ADDRLP4 356
+INDIRF4
+ADDRLP4 352
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2272
+JUMPV
+LABELV $2269
+ADDRLP4 372
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 312
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 348
+INDIRF4
+MULF4
+ADDRLP4 372
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 316
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+ADDRLP4 348
+INDIRF4
+MULF4
+ADDRLP4 372
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+INDIRF4
+ARGF4
+ADDRLP4 320
+INDIRI4
+ARGI4
+ADDRLP4 324
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRLP4 316
+INDIRF4
+ARGF4
+ADDRLP4 320
+INDIRI4
+ARGI4
+ADDRLP4 336
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRLP4 324
+ARGP4
+ADDRLP4 336
+ARGP4
+ADDRLP4 376
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 380
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+ASGNP4
+ADDRLP4 380
+INDIRP4
+ADDRLP4 380
+INDIRP4
+INDIRF4
+ADDRLP4 376
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2270
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2272
+ADDRLP4 4
+INDIRI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $2269
+ADDRLP4 368
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 368
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 368
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 372
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 312
+ADDRLP4 372
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 316
+CNSTF4 1065353216
+ADDRLP4 348
+INDIRF4
+MULF4
+ADDRLP4 372
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+INDIRF4
+ARGF4
+ADDRLP4 320
+INDIRI4
+ARGI4
+ADDRLP4 324
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRLP4 316
+INDIRF4
+ARGF4
+ADDRLP4 320
+INDIRI4
+ARGI4
+ADDRLP4 336
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRLP4 324
+ARGP4
+ADDRLP4 336
+ARGP4
+ADDRLP4 376
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 376
+INDIRF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 312
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+CNSTF4 981668463
+LEF4 $2273
+ADDRLP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2274
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+LEF4 $2277
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2277
+ADDRLP4 388
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 388
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 388
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 396
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+ASGNP4
+ADDRLP4 396
+INDIRP4
+ADDRLP4 396
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2274
+JUMPV
+LABELV $2273
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2274
+ADDRLP4 388
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 312
+ADDRLP4 352
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIF4 4
+ADDRLP4 348
+INDIRF4
+MULF4
+ADDRLP4 388
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 316
+ADDRLP4 352
+INDIRI4
+CVIF4 4
+ADDRLP4 348
+INDIRF4
+MULF4
+ADDRLP4 388
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+INDIRF4
+ARGF4
+ADDRLP4 320
+INDIRI4
+ARGI4
+ADDRLP4 324
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRLP4 316
+INDIRF4
+ARGF4
+ADDRLP4 320
+INDIRI4
+ARGI4
+ADDRLP4 336
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRLP4 324
+ARGP4
+ADDRLP4 336
+ARGP4
+ADDRLP4 392
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 392
+INDIRF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 312
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+CNSTF4 981668463
+LEF4 $2279
+ADDRLP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2259
+ADDRLP4 400
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 400
+INDIRP4
+ADDRLP4 400
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2259
+JUMPV
+LABELV $2279
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2259
+JUMPV
+LABELV $2258
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2283
+ADDRLP4 16
+INDIRP4
+CNSTI4 1432
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2285
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 332
+ADDRGP4 CameraCurveDistance
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 340
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 340
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 340
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 324
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1436
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2287
+ADDRLP4 348
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+ADDRLP4 312
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 348
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1396
+ADDP4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 324
+INDIRF4
+MULF4
+ADDRLP4 348
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1408
+ADDP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2288
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $2287
+ADDRLP4 312
+ARGP4
+ADDRLP4 348
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 348
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+CNSTF4 981668463
+LEF4 $2291
+ADDRLP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2292
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+LEF4 $2295
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2295
+ADDRLP4 360
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 360
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 360
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 368
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ADDRLP4 368
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2292
+JUMPV
+LABELV $2291
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2292
+ADDRLP4 324
+ADDRLP4 24
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1436
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2297
+ADDRLP4 352
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+ADDRLP4 312
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 352
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1396
+ADDP4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 324
+INDIRF4
+MULF4
+ADDRLP4 352
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1408
+ADDP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2298
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $2297
+ADDRLP4 312
+ARGP4
+ADDRLP4 352
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+CNSTF4 981668463
+LEF4 $2301
+ADDRLP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2284
+ADDRLP4 360
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2284
+JUMPV
+LABELV $2301
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2284
+JUMPV
+LABELV $2285
+ADDRLP4 316
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+ADDRLP4 320
+INDIRF4
+ASGNF4
+ADDRLP4 328
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 328
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 328
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 336
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 336
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 336
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+CNSTF4 981668463
+LEF4 $2305
+ADDRLP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2306
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+LEF4 $2309
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2309
+ADDRLP4 348
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 348
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 348
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 356
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ADDRLP4 356
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2306
+JUMPV
+LABELV $2305
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2306
+ADDRLP4 344
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 344
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 344
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+CNSTF4 981668463
+LEF4 $2311
+ADDRLP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2284
+ADDRLP4 352
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ADDRLP4 352
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2284
+JUMPV
+LABELV $2311
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2284
+JUMPV
+LABELV $2283
+ADDRLP4 316
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+ADDRLP4 320
+INDIRF4
+ASGNF4
+ADDRLP4 328
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 328
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 328
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 336
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 336
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 336
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+CNSTF4 981668463
+LEF4 $2315
+ADDRLP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2316
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+LEF4 $2319
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2319
+ADDRLP4 348
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 348
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 348
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 356
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ADDRLP4 356
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2316
+JUMPV
+LABELV $2315
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2316
+ADDRLP4 344
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 344
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 344
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+CNSTF4 981668463
+LEF4 $2321
+ADDRLP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2322
+ADDRLP4 352
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ADDRLP4 352
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2322
+JUMPV
+LABELV $2321
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2322
+LABELV $2284
+LABELV $2259
+LABELV $2233
+LABELV $2140
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2142
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $2139
+LABELV $2141
+ADDRLP4 20
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $2328
+JUMPV
+LABELV $2325
+ADDRLP4 16
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $2331
+ADDRGP4 $2326
+JUMPV
+LABELV $2331
+ADDRLP4 24
+ADDRLP4 16
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2334
+JUMPV
+LABELV $2333
+ADDRLP4 24
+ADDRLP4 24
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2334
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2336
+ADDRLP4 24
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2333
+LABELV $2336
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2337
+ADDRGP4 $2327
+JUMPV
+LABELV $2337
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2339
+ADDRLP4 40
+ADDRLP4 16
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2342
+JUMPV
+LABELV $2341
+ADDRLP4 40
+ADDRLP4 40
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2342
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2344
+ADDRLP4 40
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2341
+LABELV $2344
+LABELV $2339
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2345
+ADDRLP4 40
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $2345
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+LABELV $2345
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $2347
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 124
+ARGP4
+ADDRGP4 CG_CameraSplineAnglesAt
+CALLI4
+pop
+ADDRLP4 24
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 136
+ARGP4
+ADDRGP4 CG_CameraSplineAnglesAt
+CALLI4
+pop
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2349
+ADDRLP4 136
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 300
+ADDRGP4 CG_CameraAngleLongestDistanceWithRoll
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1268
+ADDP4
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRGP4 $2350
+JUMPV
+LABELV $2349
+ADDRLP4 136
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 300
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1268
+ADDP4
+ADDRLP4 300
+INDIRF4
+ASGNF4
+LABELV $2350
+ADDRLP4 304
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1272
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1268
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 308
+CNSTI4 40
+ASGNI4
+ADDRLP4 312
+ADDRLP4 16
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 284
+ADDRLP4 24
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+SUBF4
+CNSTF4 1109393408
+DIVF4
+ASGNF4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+ADDRLP4 284
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 288
+ARGP4
+ADDRGP4 CG_CameraSplineAnglesAt
+CALLI4
+pop
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2351
+ADDRLP4 124
+ARGP4
+ADDRLP4 288
+ARGP4
+ADDRLP4 316
+ADDRGP4 CG_CameraAngleLongestDistanceWithRoll
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 316
+INDIRF4
+ADDRLP4 284
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2352
+JUMPV
+LABELV $2351
+ADDRLP4 124
+ARGP4
+ADDRLP4 288
+ARGP4
+ADDRLP4 316
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 316
+INDIRF4
+ADDRLP4 284
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $2352
+ADDRLP4 24
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 288
+ARGP4
+ADDRGP4 CG_CameraSplineAnglesAt
+CALLI4
+pop
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2353
+ADDRLP4 136
+ARGP4
+ADDRLP4 288
+ARGP4
+ADDRLP4 316
+ADDRGP4 CG_CameraAngleLongestDistanceWithRoll
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 316
+INDIRF4
+ADDRLP4 284
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2348
+JUMPV
+LABELV $2353
+ADDRLP4 136
+ARGP4
+ADDRLP4 288
+ARGP4
+ADDRLP4 316
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 316
+INDIRF4
+ADDRLP4 284
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $2348
+JUMPV
+LABELV $2347
+ADDRLP4 288
+CNSTI4 16
+ASGNI4
+ADDRLP4 124
+ADDRLP4 16
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRLP4 24
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $2355
+ADDRLP4 124+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 136+8
+CNSTF4 0
+ASGNF4
+LABELV $2355
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $2359
+ADDRLP4 136
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 292
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1268
+ADDP4
+ADDRLP4 292
+INDIRF4
+ASGNF4
+ADDRGP4 $2360
+JUMPV
+LABELV $2359
+ADDRLP4 136
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 292
+ADDRGP4 CG_CameraAngleLongestDistanceWithRoll
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1268
+ADDP4
+ADDRLP4 292
+INDIRF4
+ASGNF4
+LABELV $2360
+ADDRLP4 296
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1272
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1268
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $2348
+ADDRLP4 16
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2361
+ADDRLP4 16
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+MULF4
+LEF4 $2363
+ADDRLP4 16
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2363
+ADDRLP4 292
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRP4
+CNSTI4 1268
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 16
+INDIRP4
+CNSTI4 144
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 308
+ADDRLP4 16
+INDIRP4
+CNSTI4 148
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $2361
+ADDRLP4 284
+CNSTI4 92
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 292
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1284
+ADDP4
+ADDRLP4 292
+INDIRF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1288
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1284
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 304
+CNSTI4 96
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 312
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1300
+ADDP4
+ADDRLP4 312
+INDIRF4
+ASGNF4
+ADDRLP4 320
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1304
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1300
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 324
+CNSTI4 100
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 332
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1316
+ADDP4
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 340
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1320
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1316
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 340
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 340
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 344
+CNSTI4 24
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 344
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 344
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 352
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1348
+ADDP4
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRGP4 $2366
+JUMPV
+LABELV $2365
+ADDRLP4 356
+ADDRLP4 16
+INDIRP4
+CNSTI4 1348
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ADDRLP4 356
+INDIRP4
+INDIRF4
+CNSTF4 1127481344
+SUBF4
+ASGNF4
+LABELV $2366
+ADDRLP4 16
+INDIRP4
+CNSTI4 1348
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+GEF4 $2365
+ADDRLP4 360
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1352
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1348
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 360
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 360
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2368
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2373
+JUMPV
+LABELV $2370
+ADDRLP4 44
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $2376
+ADDRGP4 $2371
+JUMPV
+LABELV $2376
+ADDRLP4 44
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 6
+EQI4 $2378
+ADDRGP4 $2372
+JUMPV
+LABELV $2378
+ADDRLP4 72
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2371
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2373
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2370
+LABELV $2372
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2380
+ADDRLP4 368
+ADDRLP4 44
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 5
+EQI4 $2382
+ADDRLP4 368
+INDIRI4
+CNSTI4 7
+NEI4 $2380
+LABELV $2382
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LEI4 $2380
+ADDRGP4 $2383
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 84
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 372
+CNSTI4 1460
+ASGNI4
+ADDRLP4 124
+ADDRLP4 372
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRLP4 372
+INDIRI4
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 124
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 376
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRLP4 380
+CNSTI4 1460
+ASGNI4
+ADDRLP4 108
+CNSTF4 1148846080
+ADDRLP4 80
+INDIRF4
+ADDRLP4 380
+INDIRI4
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ADDRLP4 380
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $2395
+JUMPV
+LABELV $2392
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1364
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1368
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1268
+ADDP4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1272
+ADDP4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRGP4 $2404
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2393
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2395
+ADDRLP4 4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LTI4 $2392
+ADDRGP4 $2381
+JUMPV
+LABELV $2380
+ADDRLP4 372
+ADDRLP4 24
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 5
+EQI4 $2407
+ADDRLP4 372
+INDIRI4
+CNSTI4 7
+NEI4 $2405
+LABELV $2407
+ADDRLP4 380
+CNSTI4 52
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 380
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 380
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 384
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1268
+ADDP4
+ADDRLP4 384
+INDIRF4
+ASGNF4
+ADDRLP4 392
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1272
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1268
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 392
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 392
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $2405
+LABELV $2381
+LABELV $2368
+ADDRLP4 16
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2408
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2413
+JUMPV
+LABELV $2410
+ADDRLP4 44
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $2416
+ADDRGP4 $2411
+JUMPV
+LABELV $2416
+ADDRLP4 44
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $2418
+ADDRGP4 $2412
+JUMPV
+LABELV $2418
+ADDRLP4 72
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2411
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2413
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2410
+LABELV $2412
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2420
+ADDRLP4 368
+ADDRLP4 44
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $2422
+ADDRLP4 368
+INDIRI4
+CNSTI4 1
+NEI4 $2420
+LABELV $2422
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LEI4 $2420
+ADDRGP4 $2423
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 84
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 396
+CNSTI4 1460
+ASGNI4
+ADDRLP4 396
+INDIRI4
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+92
+ADDP4
+INDIRF4
+ADDRLP4 396
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+92
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 400
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 372
+ADDRLP4 400
+INDIRF4
+ASGNF4
+ADDRLP4 404
+CNSTI4 1460
+ASGNI4
+ADDRLP4 404
+INDIRI4
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+96
+ADDP4
+INDIRF4
+ADDRLP4 404
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+96
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 408
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 376
+ADDRLP4 408
+INDIRF4
+ASGNF4
+ADDRLP4 412
+CNSTI4 1460
+ASGNI4
+ADDRLP4 412
+INDIRI4
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+100
+ADDP4
+INDIRF4
+ADDRLP4 412
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 416
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 380
+ADDRLP4 416
+INDIRF4
+ASGNF4
+ADDRLP4 420
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 424
+CNSTI4 1460
+ASGNI4
+ADDRLP4 428
+ADDRLP4 424
+INDIRI4
+ADDRLP4 76
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 432
+ADDRLP4 424
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 384
+ADDRLP4 420
+INDIRF4
+ADDRLP4 372
+INDIRF4
+ADDRLP4 428
+INDIRI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ADDRLP4 432
+INDIRI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 388
+ADDRLP4 420
+INDIRF4
+ADDRLP4 376
+INDIRF4
+ADDRLP4 428
+INDIRI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ADDRLP4 432
+INDIRI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 392
+ADDRLP4 420
+INDIRF4
+ADDRLP4 380
+INDIRF4
+ADDRLP4 428
+INDIRI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ADDRLP4 432
+INDIRI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $2451
+JUMPV
+LABELV $2448
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1388
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1392
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1284
+ADDP4
+ADDRLP4 372
+INDIRF4
+ASGNF4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1300
+ADDP4
+ADDRLP4 376
+INDIRF4
+ASGNF4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1316
+ADDP4
+ADDRLP4 380
+INDIRF4
+ASGNF4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1288
+ADDP4
+ADDRLP4 384
+INDIRF4
+ASGNF4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1304
+ADDP4
+ADDRLP4 388
+INDIRF4
+ASGNF4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1320
+ADDP4
+ADDRLP4 392
+INDIRF4
+ASGNF4
+ADDRGP4 $2468
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2449
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2451
+ADDRLP4 4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LTI4 $2448
+LABELV $2420
+LABELV $2408
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2469
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2474
+JUMPV
+LABELV $2471
+ADDRLP4 44
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $2477
+ADDRGP4 $2472
+JUMPV
+LABELV $2477
+ADDRLP4 44
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $2479
+ADDRGP4 $2473
+JUMPV
+LABELV $2479
+ADDRLP4 72
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2472
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2474
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2471
+LABELV $2473
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2481
+ADDRLP4 368
+ADDRLP4 44
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $2484
+ADDRLP4 368
+INDIRI4
+CNSTI4 1
+EQI4 $2484
+ADDRLP4 368
+INDIRI4
+CNSTI4 3
+NEI4 $2481
+LABELV $2484
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LEI4 $2481
+ADDRGP4 $2485
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 84
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 372
+CNSTI4 1460
+ASGNI4
+ADDRLP4 372
+INDIRI4
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+16+8
+ADDP4
+INDIRF4
+ADDRLP4 372
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+16+8
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 376
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRGP4 $2493
+JUMPV
+LABELV $2492
+ADDRLP4 80
+ADDRLP4 80
+INDIRF4
+CNSTF4 1127481344
+SUBF4
+ASGNF4
+LABELV $2493
+ADDRLP4 80
+INDIRF4
+CNSTF4 1127481344
+GEF4 $2492
+ADDRLP4 380
+CNSTI4 1460
+ASGNI4
+ADDRLP4 108
+CNSTF4 1148846080
+ADDRLP4 80
+INDIRF4
+ADDRLP4 380
+INDIRI4
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ADDRLP4 380
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $2502
+JUMPV
+LABELV $2499
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1372
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1376
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1348
+ADDP4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1352
+ADDP4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRGP4 $2511
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2500
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2502
+ADDRLP4 4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LTI4 $2499
+LABELV $2481
+LABELV $2469
+LABELV $2326
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2328
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $2325
+LABELV $2327
+ADDRLP4 20
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $2515
+JUMPV
+LABELV $2512
+ADDRLP4 16
+CNSTI4 1460
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $2518
+ADDRGP4 $2513
+JUMPV
+LABELV $2518
+ADDRLP4 24
+ADDRLP4 16
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2521
+JUMPV
+LABELV $2520
+ADDRLP4 24
+ADDRLP4 24
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2521
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2523
+ADDRLP4 24
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2520
+LABELV $2523
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2524
+ADDRGP4 $2514
+JUMPV
+LABELV $2524
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2526
+ADDRLP4 40
+ADDRLP4 16
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2529
+JUMPV
+LABELV $2528
+ADDRLP4 40
+ADDRLP4 40
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2529
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2531
+ADDRLP4 40
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2528
+LABELV $2531
+LABELV $2526
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2532
+ADDRLP4 40
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $2532
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+LABELV $2532
+ADDRLP4 284
+CNSTI4 104
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 292
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1332
+ADDP4
+ADDRLP4 292
+INDIRF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1336
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1332
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2534
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2539
+JUMPV
+LABELV $2536
+ADDRLP4 44
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $2542
+ADDRGP4 $2537
+JUMPV
+LABELV $2542
+ADDRLP4 44
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $2544
+ADDRGP4 $2538
+JUMPV
+LABELV $2544
+ADDRLP4 72
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2537
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2539
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2536
+LABELV $2538
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2535
+ADDRLP4 308
+ADDRLP4 44
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 1
+EQI4 $2549
+ADDRLP4 308
+INDIRI4
+CNSTI4 2
+EQI4 $2549
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+NEI4 $2535
+LABELV $2549
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LEI4 $2535
+ADDRGP4 $2550
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 84
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+CNSTI4 1460
+ASGNI4
+ADDRLP4 312
+INDIRI4
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+104
+ADDP4
+INDIRF4
+ADDRLP4 312
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+104
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 316
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 316
+INDIRF4
+ASGNF4
+ADDRLP4 320
+CNSTI4 1460
+ASGNI4
+ADDRLP4 108
+CNSTF4 1148846080
+ADDRLP4 80
+INDIRF4
+ADDRLP4 320
+INDIRI4
+ADDRLP4 76
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ADDRLP4 320
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $2562
+JUMPV
+LABELV $2559
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1380
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1384
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1332
+ADDP4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+CNSTI4 1460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1336
+ADDP4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRGP4 $2571
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2560
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2562
+ADDRLP4 4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LTI4 $2559
+ADDRGP4 $2535
+JUMPV
+LABELV $2534
+ADDRLP4 16
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2572
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 304
+ARGP4
+ADDRLP4 312
+ADDRGP4 CG_CameraSplineFovAt
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+NEI4 $2574
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2576
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $2576
+ADDRLP4 304
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $2577
+JUMPV
+LABELV $2576
+ADDRLP4 304
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+LABELV $2577
+LABELV $2574
+ADDRLP4 24
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 308
+ARGP4
+ADDRLP4 316
+ADDRGP4 CG_CameraSplineFovAt
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+NEI4 $2582
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2584
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $2584
+ADDRLP4 308
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $2585
+JUMPV
+LABELV $2584
+ADDRLP4 308
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+LABELV $2585
+LABELV $2582
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 320
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1332
+ADDP4
+ADDRLP4 320
+INDIRF4
+ASGNF4
+ADDRLP4 328
+CNSTI4 40
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1336
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRP4
+CNSTI4 1332
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 328
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 328
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $2572
+LABELV $2535
+LABELV $2513
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2515
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $2512
+LABELV $2514
+ADDRGP4 cg+3196760
+INDIRI4
+CNSTI4 20480
+GEI4 $2590
+ADDRLP4 276
+CNSTI4 1460
+ADDRLP4 120
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $2596
+JUMPV
+LABELV $2593
+ADDRLP4 276
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2598
+ADDRGP4 $2594
+JUMPV
+LABELV $2598
+ADDRLP4 276
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $2600
+ADDRGP4 $2594
+JUMPV
+LABELV $2600
+ADDRLP4 276
+INDIRP4
+CNSTI4 1432
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2602
+CNSTI4 12
+ADDRLP4 276
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+ADDRLP4 276
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2594
+JUMPV
+LABELV $2602
+ADDRLP4 288
+ADDRLP4 276
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2606
+JUMPV
+LABELV $2605
+ADDRLP4 288
+ADDRLP4 288
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2606
+ADDRLP4 288
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2608
+ADDRLP4 288
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2605
+LABELV $2608
+ADDRLP4 288
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2609
+ADDRGP4 $2611
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2595
+JUMPV
+LABELV $2609
+ADDRLP4 308
+CNSTI4 1236
+ASGNI4
+ADDRLP4 292
+ADDRLP4 288
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 316
+CNSTI4 40
+ASGNI4
+ADDRLP4 296
+ADDRLP4 288
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 292
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 284
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2615
+JUMPV
+LABELV $2612
+ADDRLP4 280
+ADDRLP4 276
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 276
+INDIRP4
+CNSTI4 1436
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 296
+INDIRF4
+ADDRLP4 284
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 280
+INDIRF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 320
+CNSTI4 0
+ASGNI4
+LABELV $2616
+ADDRLP4 328
+ADDRLP4 320
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 12
+ADDRLP4 276
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+ADDRLP4 284
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+ADDP4
+ADDRLP4 328
+INDIRI4
+ADDRLP4 276
+INDIRP4
+CNSTI4 1396
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 280
+INDIRF4
+MULF4
+ADDRLP4 280
+INDIRF4
+MULF4
+ADDRLP4 328
+INDIRI4
+ADDRLP4 276
+INDIRP4
+CNSTI4 1408
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 280
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 328
+INDIRI4
+ADDRLP4 276
+INDIRP4
+CNSTI4 1420
+ADDP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2617
+ADDRLP4 320
+ADDRLP4 320
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 3
+LTI4 $2616
+LABELV $2613
+ADDRLP4 284
+ADDRLP4 284
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2615
+ADDRLP4 284
+INDIRI4
+ADDRLP4 292
+INDIRI4
+LTI4 $2612
+LABELV $2594
+ADDRLP4 276
+ADDRLP4 276
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2596
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2593
+LABELV $2595
+LABELV $2590
+ADDRGP4 $2621
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $1880
+endproc CG_UpdateCameraInfoExt 436 36
+proc CG_UpdateCameraInfo 0 4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_UpdateCameraInfoExt
+CALLV
+pop
+LABELV $2622
+endproc CG_UpdateCameraInfo 0 4
+proc CG_ResetCameraVelocities 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2627
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2624
+LABELV $2627
+ADDRGP4 $2623
+JUMPV
+LABELV $2624
+ADDRLP4 0
+CNSTI4 1460
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2623
+endproc CG_ResetCameraVelocities 16 0
+data
+align 4
+LABELV EcamHelpDoc
+address $2629
+code
+proc CG_ChangeSelectedCameraPoints_f 488 44
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LTI4 $2635
+CNSTI4 1
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 $340
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $2633
+LABELV $2635
+ADDRGP4 $2636
+ARGP4
+ADDRGP4 EcamHelpDoc
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2633
+CNSTI4 1
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $2637
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2643
+JUMPV
+LABELV $2640
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_ResetCameraVelocities
+CALLV
+pop
+LABELV $2641
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2643
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2640
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2637
+CNSTI4 1
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 $2647
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $2645
+ADDRLP4 88
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 3
+GEI4 $2648
+ADDRGP4 $2650
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2648
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+GEI4 $2651
+ADDRGP4 $2654
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2651
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2656
+JUMPV
+LABELV $2655
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 $2660
+ARGP4
+ADDRLP4 96
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $2658
+ADDRLP4 112
+ADDRGP4 cg+2121556+4
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112+4
+ADDRGP4 cg+2121556+4+4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112+8
+ADDRGP4 cg+2121556+4+8
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2682
+JUMPV
+LABELV $2679
+ADDRLP4 124
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 124
+INDIRI4
+ADDRGP4 cg+2121556+4
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+4
+ADDRLP4 124
+INDIRI4
+ADDRGP4 cg+2121556+4+4
+ADDP4
+INDIRF4
+ADDRLP4 112+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+8
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+4+8
+ADDP4
+INDIRF4
+ADDRLP4 112+8
+INDIRF4
+SUBF4
+ASGNF4
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+4
+ADDP4
+ADDRLP4 100
+INDIRB
+ASGNB 12
+LABELV $2680
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2682
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2679
+ADDRGP4 CG_CameraResetInternalLengths
+CALLV
+pop
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $2658
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 $2700
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $2698
+ADDRGP4 cg+2121556+16
+ARGP4
+ADDRGP4 cg+609780
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2707
+JUMPV
+LABELV $2704
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+16
+ADDP4
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+16
+ADDP4
+ADDRLP4 108
+INDIRB
+ASGNB 12
+LABELV $2705
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2707
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2704
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $2698
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 $2715
+ARGP4
+ADDRLP4 112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $2717
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 $2716
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $2713
+LABELV $2717
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+GEI4 $2718
+ADDRGP4 $2630
+JUMPV
+LABELV $2718
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRGP4 $2716
+ARGP4
+ADDRLP4 328
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+NEI4 $2721
+ADDRLP4 308
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2722
+JUMPV
+LABELV $2721
+ADDRLP4 308
+CNSTI4 0
+ASGNI4
+LABELV $2722
+ADDRGP4 cg+609780
+ARGP4
+ADDRLP4 200
+ARGP4
+ADDRLP4 212
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 200
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 212
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 188
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 248
+ADDRGP4 cg+2121556+1460+4
+INDIRF4
+ADDRGP4 cg+2121556+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 248+4
+ADDRGP4 cg+2121556+1460+4+4
+INDIRF4
+ADDRGP4 cg+2121556+4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 248+8
+ADDRGP4 cg+2121556+1460+4+8
+INDIRF4
+ADDRGP4 cg+2121556+4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 248
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 248
+ARGP4
+ADDRLP4 312
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 312
+ARGP4
+ADDRLP4 248
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 136
+ADDRGP4 cg+2121556+4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+2121556+4
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 224
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRGP4 Old
+ADDRLP4 136
+INDIRB
+ASGNB 12
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2756
+JUMPV
+LABELV $2753
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+CNSTI4 12
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 Old
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 336
+CNSTF4 0
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 336
+INDIRF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 336
+INDIRF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 336
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 248
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRGP4 ProjectPointOntoVector
+CALLV
+pop
+ADDRLP4 152
+ADDRLP4 124
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 152+4
+ADDRLP4 124+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 152+8
+ADDRLP4 124+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRGP4 ProjectPointOntoVector
+CALLV
+pop
+ADDRLP4 164
+ADDRLP4 124
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 124+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+8
+ADDRLP4 124+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRGP4 ProjectPointOntoVector
+CALLV
+pop
+ADDRLP4 176
+ADDRLP4 124
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 176+4
+ADDRLP4 124+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 176+8
+ADDRLP4 124+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 344
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 344
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 344
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 344
+INDIRF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+ADDRLP4 248
+ARGP4
+ADDRLP4 348
+ADDRGP4 VectorGetScale
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 348
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 224+4
+INDIRF4
+ADDRLP4 200+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 224+8
+INDIRF4
+ADDRLP4 200+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 352
+ADDRGP4 VectorGetScale
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 356
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ADDRLP4 356
+INDIRP4
+INDIRF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 360
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRF4
+ADDRLP4 212+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 364
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 364
+INDIRP4
+ADDRLP4 364
+INDIRP4
+INDIRF4
+ADDRLP4 212+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 176
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRLP4 368
+ADDRGP4 VectorGetScale
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRLP4 372
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ADDRLP4 372
+INDIRP4
+INDIRF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 376
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+ADDRLP4 376
+INDIRP4
+INDIRF4
+ADDRLP4 188+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 380
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 380
+INDIRP4
+ADDRLP4 380
+INDIRP4
+INDIRF4
+ADDRLP4 188+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2754
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2756
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2753
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2790
+JUMPV
+LABELV $2787
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+NEI4 $2792
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 384
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 284
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 284+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 284
+ARGP4
+ADDRLP4 356
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 368
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 356
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 408
+CNSTI4 12
+ADDRLP4 12
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 412
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 344
+ADDRLP4 408
+INDIRI4
+ADDRGP4 Old
+ADDP4
+INDIRF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 356
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 344+4
+ADDRLP4 408
+INDIRI4
+ADDRGP4 Old+4
+ADDP4
+INDIRF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 356+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 344+8
+CNSTI4 12
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 Old+8
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 356+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 416
+CNSTI4 12
+ADDRLP4 12
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 344
+INDIRF4
+ADDRLP4 416
+INDIRI4
+ADDRGP4 Old
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236+4
+ADDRLP4 344+4
+INDIRF4
+ADDRLP4 416
+INDIRI4
+ADDRGP4 Old+4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236+8
+ADDRLP4 344+8
+INDIRF4
+CNSTI4 12
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 Old+8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ARGP4
+ADDRLP4 284
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 284
+ARGP4
+ADDRLP4 420
+CNSTP4 0
+ASGNP4
+ADDRLP4 420
+INDIRP4
+ARGP4
+ADDRLP4 420
+INDIRP4
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 296
+ARGP4
+ADDRLP4 368
+ARGP4
+ADDRLP4 424
+ADDRGP4 AngleBetweenVectors
+CALLF4
+ASGNF4
+ADDRLP4 380
+ADDRLP4 424
+INDIRF4
+ASGNF4
+ADDRGP4 $2808
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 380
+INDIRF4
+ARGF4
+ADDRLP4 368
+INDIRF4
+ARGF4
+ADDRLP4 368+4
+INDIRF4
+ARGF4
+ADDRLP4 296
+INDIRF4
+ARGF4
+ADDRLP4 296+4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 428
+CNSTF4 0
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 428
+INDIRF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 428
+INDIRF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 428
+INDIRF4
+ASGNF4
+ADDRLP4 344
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 248
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRGP4 ProjectPointOntoVector
+CALLV
+pop
+ADDRLP4 152
+ADDRLP4 124
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 152+4
+ADDRLP4 124+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 152+8
+ADDRLP4 124+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 344
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRGP4 ProjectPointOntoVector
+CALLV
+pop
+ADDRLP4 164
+ADDRLP4 124
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 124+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+8
+ADDRLP4 124+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 344
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRGP4 ProjectPointOntoVector
+CALLV
+pop
+ADDRLP4 176
+ADDRLP4 124
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 176+4
+ADDRLP4 124+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 176+8
+ADDRLP4 124+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 432
+CNSTF4 0
+ASGNF4
+ADDRLP4 332+8
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 332+4
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+ADDRLP4 248
+ARGP4
+ADDRLP4 436
+ADDRGP4 VectorGetScale
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 436
+INDIRF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 224
+INDIRF4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 332+4
+ADDRLP4 224+4
+INDIRF4
+ADDRLP4 200+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 332+8
+ADDRLP4 224+8
+INDIRF4
+ADDRLP4 200+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 444
+ADDRGP4 VectorGetScale
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 444
+INDIRF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 332
+INDIRF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 332+4
+ADDRLP4 332+4
+INDIRF4
+ADDRLP4 212+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+ADDRLP4 212+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 176
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRLP4 452
+ADDRGP4 VectorGetScale
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 452
+INDIRF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 332
+INDIRF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 332+4
+ADDRLP4 332+4
+INDIRF4
+ADDRLP4 188+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+ADDRLP4 188+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 236
+ADDRLP4 332
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236+4
+ADDRLP4 332+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236+8
+ADDRLP4 332+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 464
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 464
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 468
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 464
+INDIRP4
+ADDRLP4 468
+INDIRF4
+ASGNF4
+ADDRLP4 472
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 472
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 476
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 472
+INDIRP4
+ADDRLP4 476
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 480
+CNSTP4 0
+ASGNP4
+ADDRLP4 480
+INDIRP4
+ARGP4
+ADDRLP4 480
+INDIRP4
+ARGP4
+ADDRLP4 388
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 388
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRLP4 484
+ADDRGP4 AngleBetweenVectors
+CALLF4
+ASGNF4
+ADDRLP4 400
+ADDRLP4 484
+INDIRF4
+ASGNF4
+ADDRGP4 $2855
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 380
+INDIRF4
+ARGF4
+ADDRLP4 400
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 384
+INDIRF4
+ASGNF4
+LABELV $2792
+LABELV $2788
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2790
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2787
+ADDRGP4 CG_CameraResetInternalLengths
+CALLV
+pop
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $2713
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRGP4 $2858
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $2856
+ADDRLP4 132
+ADDRGP4 cg+2121556+40
+INDIRF4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2865
+JUMPV
+LABELV $2862
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+ADDRLP4 136
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2863
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2865
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2862
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $2856
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 $2870
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2868
+ADDRLP4 140
+ADDRGP4 cg+2121556+40
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2876
+JUMPV
+LABELV $2873
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 156
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+ADDRLP4 144
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2874
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2876
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2873
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $2868
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2656
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2655
+ADDRGP4 $2630
+JUMPV
+LABELV $2645
+ADDRGP4 cg+3196772
+INDIRI4
+CNSTI4 0
+LTI4 $2884
+ADDRGP4 cg+3196776
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2879
+LABELV $2884
+ADDRGP4 $2885
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2879
+ADDRGP4 cg+3196776
+INDIRI4
+CNSTI4 0
+LTI4 $2891
+ADDRGP4 cg+3196776
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $2886
+LABELV $2891
+ADDRGP4 $2892
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2886
+CNSTI4 1
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 $2895
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $2893
+ADDRLP4 100
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 3
+GEI4 $2896
+ADDRGP4 $2898
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2896
+CNSTI4 2
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+3196772
+INDIRI4
+ASGNI4
+ADDRGP4 $2902
+JUMPV
+LABELV $2899
+ADDRLP4 112
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2900
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2902
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196776
+INDIRI4
+LTI4 $2899
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2893
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 $2909
+ARGP4
+ADDRLP4 100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $2907
+ADDRLP4 108
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+GEI4 $2910
+ADDRGP4 $2912
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2910
+CNSTI4 2
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 0
+GTF4 $2913
+ADDRGP4 $2915
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2912
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2913
+ADDRLP4 104
+CNSTF4 1065353216
+ADDRLP4 104
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+3196772
+INDIRI4
+ASGNI4
+ADDRGP4 $2919
+JUMPV
+LABELV $2916
+ADDRLP4 136
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 136
+INDIRI4
+ADDRGP4 cg+2121556+1460
+ADDP4
+ASGNP4
+ADDRLP4 140
+CNSTI4 40
+ASGNI4
+ADDRLP4 144
+ADDRLP4 8
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 132
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 0
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 124
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 124
+INDIRF4
+ADDRLP4 104
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 132
+INDIRF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2928
+JUMPV
+LABELV $2925
+ADDRLP4 152
+CNSTI4 1460
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2926
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2928
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196776
+INDIRI4
+LEI4 $2925
+LABELV $2917
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2919
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196776
+INDIRI4
+LTI4 $2916
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2907
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRGP4 $2934
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $2932
+CNSTI4 2
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRGP4 $2858
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $2932
+ADDRLP4 132
+ADDRGP4 cg+3196772
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRGP4 cg+3196776
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+LEI4 $2937
+ADDRLP4 120
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2937
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $2944
+JUMPV
+LABELV $2941
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2946
+ADDRGP4 $2942
+JUMPV
+LABELV $2946
+ADDRLP4 124
+ADDRLP4 124
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2942
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2944
+ADDRLP4 12
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LEI4 $2941
+ADDRLP4 124
+INDIRF4
+CNSTF4 0
+GTF4 $2948
+ADDRGP4 $2950
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2948
+ADDRLP4 140
+CNSTI4 1460
+ASGNI4
+ADDRLP4 144
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 140
+INDIRI4
+ADDRLP4 120
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 144
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 124
+INDIRF4
+ADDRLP4 136
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $2958
+JUMPV
+LABELV $2955
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2960
+ADDRGP4 $2956
+JUMPV
+LABELV $2960
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2963
+JUMPV
+LABELV $2962
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2963
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2965
+ADDRLP4 8
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2962
+LABELV $2965
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2966
+ADDRGP4 $2957
+JUMPV
+LABELV $2966
+ADDRLP4 176
+CNSTI4 40
+ASGNI4
+ADDRLP4 180
+ADDRLP4 8
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 164
+ADDRLP4 180
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 0
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 168
+ADDRLP4 180
+INDIRP4
+INDIRF4
+ADDRLP4 188
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 160
+INDIRF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRF4
+ADDRLP4 160
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $2969
+JUMPV
+LABELV $2968
+ADDRLP4 200
+CNSTI4 40
+ASGNI4
+ADDRLP4 204
+ADDRLP4 148
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 208
+ADDRLP4 0
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 204
+INDIRP4
+INDIRF4
+ADDRLP4 208
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 196
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 204
+INDIRP4
+ADDRLP4 208
+INDIRP4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2969
+ADDRLP4 148
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+NEU4 $2968
+ADDRLP4 156
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 8
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2972
+JUMPV
+LABELV $2971
+ADDRLP4 200
+ADDRLP4 148
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2972
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2971
+LABELV $2956
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2958
+ADDRLP4 12
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LEI4 $2955
+LABELV $2957
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $2932
+CNSTI4 1
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRGP4 $2934
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $2974
+CNSTI4 2
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 $2660
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $2974
+ADDRLP4 140
+ADDRGP4 cg+3196772
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRGP4 cg+3196776
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+GEI4 $2978
+ADDRLP4 140
+CNSTI4 1
+ASGNI4
+LABELV $2978
+ADDRLP4 136
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+LEI4 $2980
+ADDRLP4 136
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2980
+ADDRLP4 12
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $2987
+JUMPV
+LABELV $2984
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2989
+ADDRGP4 $2985
+JUMPV
+LABELV $2989
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2992
+JUMPV
+LABELV $2991
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2992
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2994
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2991
+LABELV $2994
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2996
+JUMPV
+LABELV $2995
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2996
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2998
+ADDRLP4 8
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2995
+LABELV $2998
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2999
+ADDRGP4 $3001
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2985
+JUMPV
+LABELV $2999
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3002
+ADDRGP4 $3004
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2985
+JUMPV
+LABELV $3002
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+CNSTF4 981668463
+GEF4 $3005
+ADDRGP4 $3007
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2985
+JUMPV
+LABELV $3005
+ADDRLP4 144
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3008
+ADDRLP4 160
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+ADDRLP4 144
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3009
+JUMPV
+LABELV $3008
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+ADDRLP4 144
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3009
+ADDRGP4 $3010
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $3011
+ADDRGP4 $3013
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3011
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+ADDRGP4 cg_cameraSmoothFactor+8
+INDIRF4
+MULF4
+LEF4 $3014
+ADDRGP4 $3017
+ARGP4
+ADDRGP4 cg_cameraSmoothFactor+8
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+ADDRGP4 cg_cameraSmoothFactor+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3014
+ADDRLP4 172
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $2985
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2987
+ADDRLP4 12
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LEI4 $2984
+ADDRGP4 $2630
+JUMPV
+LABELV $2974
+CNSTI4 1
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRGP4 $2934
+ARGP4
+ADDRLP4 140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $3020
+CNSTI4 2
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRGP4 $3022
+ARGP4
+ADDRLP4 148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $3020
+ADDRLP4 156
+ADDRGP4 cg+3196772
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRGP4 cg+3196776
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 1
+GEI4 $3025
+ADDRLP4 156
+CNSTI4 1
+ASGNI4
+LABELV $3025
+ADDRLP4 152
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+LEI4 $3027
+ADDRLP4 152
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $3027
+ADDRLP4 12
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $3034
+JUMPV
+LABELV $3031
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $3036
+ADDRGP4 $3032
+JUMPV
+LABELV $3036
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $3039
+JUMPV
+LABELV $3038
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $3039
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3041
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3038
+LABELV $3041
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $3043
+JUMPV
+LABELV $3042
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $3043
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3045
+ADDRLP4 8
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3042
+LABELV $3045
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3046
+ADDRGP4 $3001
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3032
+JUMPV
+LABELV $3046
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3048
+ADDRGP4 $3004
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3032
+JUMPV
+LABELV $3048
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+CNSTF4 981668463
+GEF4 $3050
+ADDRGP4 $3052
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3032
+JUMPV
+LABELV $3050
+ADDRLP4 184
+CNSTI4 0
+ASGNI4
+LABELV $3053
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ADDRGP4 cg_cameraSmoothFactor+8
+INDIRF4
+MULF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+GTF4 $3055
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 216
+CNSTI4 4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 4
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 224
+CNSTI4 8
+ASGNI4
+ADDRLP4 172+4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 228
+CNSTI4 12
+ASGNI4
+ADDRLP4 172+8
+ADDRLP4 4
+INDIRP4
+ADDRLP4 228
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 228
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 172
+ARGP4
+ADDRLP4 232
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 232
+INDIRF4
+ASGNF4
+ADDRLP4 240
+CNSTF4 1036831949
+ADDRLP4 208
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 240
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 160+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 172+4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 160+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 172+8
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 208
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $3066
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 248
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 248
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 252
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 256
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 256
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 160
+INDIRF4
+ARGF4
+ADDRLP4 160+4
+INDIRF4
+ARGF4
+ADDRLP4 160+8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 248
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 256
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3069
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cg_cameraSmoothFactor+8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 160
+INDIRB
+ASGNB 12
+ADDRLP4 264
+CNSTI4 40
+ASGNI4
+ADDRLP4 268
+ADDRLP4 8
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 272
+ADDRLP4 0
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 200
+ADDRLP4 268
+INDIRP4
+INDIRF4
+ADDRLP4 272
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 204
+ADDRLP4 272
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 268
+INDIRP4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 200
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 276
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 200
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $3072
+JUMPV
+LABELV $3071
+ADDRLP4 284
+CNSTI4 40
+ASGNI4
+ADDRLP4 288
+ADDRLP4 196
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 280
+ADDRLP4 288
+INDIRP4
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+ADDRLP4 200
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 0
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 288
+INDIRP4
+ADDRLP4 280
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 292
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 292
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3072
+ADDRLP4 196
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3074
+ADDRLP4 196
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3071
+LABELV $3074
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $3058
+LABELV $3054
+ADDRLP4 184
+ADDRLP4 184
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 30
+LTI4 $3053
+LABELV $3055
+LABELV $3032
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3034
+ADDRLP4 12
+INDIRI4
+ADDRLP4 152
+INDIRI4
+LEI4 $3031
+ADDRGP4 CG_CameraResetInternalLengths
+CALLV
+pop
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3020
+CNSTI4 1
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 $2934
+ARGP4
+ADDRLP4 156
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $3075
+CNSTI4 2
+ARGI4
+ADDRLP4 160
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRGP4 $2700
+ARGP4
+ADDRLP4 164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $3075
+ADDRLP4 172
+ADDRGP4 cg+3196772
+INDIRI4
+ASGNI4
+ADDRLP4 168
+ADDRGP4 cg+3196776
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+GEI4 $3079
+ADDRLP4 172
+CNSTI4 1
+ASGNI4
+LABELV $3079
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+LEI4 $3081
+ADDRLP4 168
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $3081
+ADDRLP4 12
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRGP4 $3088
+JUMPV
+LABELV $3085
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $3090
+ADDRGP4 $3086
+JUMPV
+LABELV $3090
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $3093
+JUMPV
+LABELV $3092
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $3093
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3095
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3092
+LABELV $3095
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $3097
+JUMPV
+LABELV $3096
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $3097
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3099
+ADDRLP4 8
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3096
+LABELV $3099
+ADDRLP4 196
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 196
+INDIRU4
+EQU4 $3102
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 196
+INDIRU4
+NEU4 $3100
+LABELV $3102
+ADDRGP4 $3086
+JUMPV
+LABELV $3100
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3103
+ADDRLP4 184
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3104
+JUMPV
+LABELV $3103
+ADDRLP4 184
+ADDRLP4 4
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3104
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3105
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3106
+JUMPV
+LABELV $3105
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3106
+ADDRLP4 176
+INDIRF4
+CNSTF4 981668463
+GTF4 $3107
+ADDRLP4 176
+CNSTF4 1008981770
+ASGNF4
+LABELV $3107
+ADDRLP4 180
+ADDRLP4 184
+INDIRF4
+ADDRLP4 176
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3109
+ADDRLP4 200
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3110
+JUMPV
+LABELV $3109
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3110
+ADDRGP4 $3010
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $3111
+ADDRGP4 $3113
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3111
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ADDRGP4 cg_cameraSmoothFactor+8
+INDIRF4
+MULF4
+LEF4 $3114
+ADDRGP4 $3117
+ARGP4
+ADDRGP4 cg_cameraSmoothFactor+8
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ADDRGP4 cg_cameraSmoothFactor+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3114
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1268
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $3086
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3088
+ADDRLP4 12
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LEI4 $3085
+ADDRGP4 $2630
+JUMPV
+LABELV $3075
+CNSTI4 1
+ARGI4
+ADDRLP4 168
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRGP4 $2934
+ARGP4
+ADDRLP4 172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $3120
+CNSTI4 2
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRGP4 $3122
+ARGP4
+ADDRLP4 180
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $3120
+ADDRLP4 192
+ADDRGP4 cg+3196772
+INDIRI4
+ASGNI4
+ADDRLP4 184
+ADDRGP4 cg+3196776
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 1
+GEI4 $3125
+ADDRLP4 192
+CNSTI4 1
+ASGNI4
+LABELV $3125
+ADDRLP4 184
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+LEI4 $3127
+ADDRLP4 184
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $3127
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+LABELV $3131
+ADDRLP4 196
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRGP4 $3138
+JUMPV
+LABELV $3135
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $3140
+ADDRGP4 $3136
+JUMPV
+LABELV $3140
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $3143
+JUMPV
+LABELV $3142
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $3143
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3145
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3142
+LABELV $3145
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $3147
+JUMPV
+LABELV $3146
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $3147
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3149
+ADDRLP4 8
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3146
+LABELV $3149
+ADDRLP4 228
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 228
+INDIRU4
+EQU4 $3152
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 228
+INDIRU4
+NEU4 $3150
+LABELV $3152
+ADDRGP4 $3136
+JUMPV
+LABELV $3150
+ADDRLP4 4
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3153
+ADDRGP4 $3136
+JUMPV
+LABELV $3153
+ADDRLP4 216
+ADDRGP4 cg_cameraSmoothFactor+8
+INDIRF4
+ASGNF4
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+LABELV $3156
+ADDRLP4 232
+CNSTI4 1272
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3158
+ADDRLP4 236
+CNSTI4 20
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 236
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 236
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 240
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRLP4 200+4
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRLP4 244
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 244
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 244
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 248
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 248
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $3163
+ADDRLP4 252
+CNSTI4 24
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 256
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRLP4 200+8
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRGP4 $3164
+JUMPV
+LABELV $3163
+ADDRLP4 200+8
+CNSTF4 0
+ASGNF4
+LABELV $3164
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $3167
+ADDRGP4 $3169
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 200+4
+INDIRF4
+ARGF4
+ADDRLP4 200
+INDIRF4
+ARGF4
+ADDRLP4 200+8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 256
+CNSTI4 1272
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 256
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 256
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3168
+JUMPV
+LABELV $3167
+ADDRGP4 $3172
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 200+4
+INDIRF4
+ARGF4
+ADDRLP4 200
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 256
+CNSTI4 1272
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 256
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 256
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3168
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 200+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $3175
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 200+8
+INDIRF4
+ASGNF4
+LABELV $3175
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 252
+CNSTI4 20
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 256
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRLP4 200+4
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRLP4 260
+CNSTI4 16
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 264
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $3179
+ADDRLP4 268
+CNSTI4 24
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 272
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRLP4 200+8
+ADDRLP4 272
+INDIRF4
+ASGNF4
+LABELV $3179
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 200+4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $3183
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 200+8
+INDIRF4
+ASGNF4
+LABELV $3183
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+ADDRLP4 196
+ADDRLP4 196
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3161
+LABELV $3157
+ADDRLP4 212
+ADDRLP4 212
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 10
+LTI4 $3156
+LABELV $3158
+LABELV $3136
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3138
+ADDRLP4 12
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LEI4 $3135
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $3186
+ADDRGP4 $3133
+JUMPV
+LABELV $3186
+LABELV $3132
+ADDRLP4 188
+ADDRLP4 188
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 10
+LTI4 $3131
+LABELV $3133
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3120
+CNSTI4 1
+ARGI4
+ADDRLP4 184
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 $2934
+ARGP4
+ADDRLP4 188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $3188
+CNSTI4 2
+ARGI4
+ADDRLP4 192
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRGP4 $3190
+ARGP4
+ADDRLP4 196
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $3188
+ADDRLP4 208
+CNSTF4 0
+ASGNF4
+ADDRLP4 212
+ADDRGP4 cg+3196772
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 212
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3194
+JUMPV
+LABELV $3193
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 212
+ADDRLP4 212
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3194
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3196
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3193
+LABELV $3196
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3197
+ADDRGP4 $3199
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3197
+ADDRLP4 200
+ADDRGP4 cg+3196776
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 200
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3203
+JUMPV
+LABELV $3202
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 200
+ADDRLP4 200
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $3203
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3205
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3202
+LABELV $3205
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3206
+ADDRGP4 $3208
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3206
+ADDRLP4 212
+INDIRI4
+ADDRLP4 200
+INDIRI4
+LTI4 $3209
+ADDRGP4 $3211
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3209
+ADDRLP4 216
+CNSTI4 0
+ASGNI4
+LABELV $3212
+ADDRLP4 208
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $3219
+JUMPV
+LABELV $3216
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $3221
+ADDRGP4 $3217
+JUMPV
+LABELV $3221
+ADDRLP4 208
+ADDRLP4 208
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3217
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3219
+ADDRLP4 12
+INDIRI4
+ADDRLP4 200
+INDIRI4
+LEI4 $3216
+ADDRLP4 208
+INDIRF4
+CNSTF4 0
+GTF4 $3223
+ADDRGP4 $2630
+JUMPV
+LABELV $3223
+ADDRLP4 228
+CNSTI4 1460
+ASGNI4
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+ADDRLP4 228
+INDIRI4
+ADDRLP4 200
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ADDRLP4 228
+INDIRI4
+ADDRLP4 212
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ASGNF4
+ADDRLP4 204
+INDIRF4
+CNSTF4 0
+GTF4 $3229
+ADDRGP4 $2630
+JUMPV
+LABELV $3229
+ADDRLP4 12
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $3234
+JUMPV
+LABELV $3231
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $3236
+ADDRGP4 $3232
+JUMPV
+LABELV $3236
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $3239
+JUMPV
+LABELV $3238
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $3239
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3241
+ADDRLP4 8
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3238
+LABELV $3241
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3242
+ADDRGP4 $3233
+JUMPV
+LABELV $3242
+ADDRLP4 248
+CNSTI4 40
+ASGNI4
+ADDRLP4 252
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 232
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 204
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 248
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+DIVF4
+MULF4
+ADDF4
+ADDRLP4 204
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 248
+INDIRI4
+ADDP4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 232
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3232
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3234
+ADDRLP4 12
+INDIRI4
+ADDRLP4 200
+INDIRI4
+LTI4 $3231
+LABELV $3233
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $3213
+ADDRLP4 216
+ADDRLP4 216
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 30
+LTI4 $3212
+ADDRLP4 12
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $3247
+JUMPV
+LABELV $3244
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $3249
+ADDRGP4 $3245
+JUMPV
+LABELV $3249
+ADDRGP4 $3251
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3245
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3247
+ADDRLP4 12
+INDIRI4
+ADDRLP4 200
+INDIRI4
+LTI4 $3244
+ADDRGP4 $2630
+JUMPV
+LABELV $3188
+CNSTI4 1
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRGP4 $2934
+ARGP4
+ADDRLP4 204
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $3252
+CNSTI4 2
+ARGI4
+ADDRLP4 208
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRGP4 $3254
+ARGP4
+ADDRLP4 212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $3252
+ADDRLP4 236
+ADDRGP4 cg+3196772
+INDIRI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+GEI4 $3256
+ADDRLP4 236
+CNSTI4 1
+ASGNI4
+LABELV $3256
+ADDRLP4 232
+ADDRGP4 cg+3196776
+INDIRI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+SUBI4
+LEI4 $3259
+ADDRLP4 232
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $3259
+ADDRLP4 12
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRGP4 $3266
+JUMPV
+LABELV $3263
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $3268
+ADDRGP4 $3264
+JUMPV
+LABELV $3268
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $3271
+JUMPV
+LABELV $3270
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $3271
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3273
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3270
+LABELV $3273
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3274
+ADDRGP4 $3265
+JUMPV
+LABELV $3274
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $3277
+JUMPV
+LABELV $3276
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $3277
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3279
+ADDRLP4 8
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3276
+LABELV $3279
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3280
+ADDRGP4 $3265
+JUMPV
+LABELV $3280
+ADDRLP4 228
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 252
+CNSTI4 40
+ASGNI4
+ADDRLP4 224
+ADDRLP4 8
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $3282
+ADDRLP4 220
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $3283
+JUMPV
+LABELV $3282
+ADDRLP4 220
+CNSTF4 0
+ASGNF4
+LABELV $3283
+ADDRLP4 220
+INDIRF4
+CNSTF4 1065353216
+LEF4 $3284
+ADDRLP4 216
+ADDRLP4 224
+INDIRF4
+ADDRLP4 220
+INDIRF4
+MULF4
+ADDRLP4 224
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3285
+JUMPV
+LABELV $3284
+ADDRLP4 220
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3286
+ADDRLP4 220
+INDIRF4
+CNSTF4 981668463
+LEF4 $3286
+ADDRLP4 216
+CNSTF4 1065353216
+ADDRLP4 220
+INDIRF4
+SUBF4
+NEGF4
+ADDRLP4 224
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3287
+JUMPV
+LABELV $3286
+ADDRLP4 216
+CNSTF4 0
+ASGNF4
+ADDRGP4 $3264
+JUMPV
+LABELV $3287
+LABELV $3285
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3291
+JUMPV
+LABELV $3288
+ADDRLP4 260
+CNSTI4 1460
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+ADDRLP4 216
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3289
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3291
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $3288
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+ADDRGP4 $3295
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 220
+INDIRF4
+ARGF4
+ADDRLP4 228
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3264
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3266
+ADDRLP4 12
+INDIRI4
+ADDRLP4 232
+INDIRI4
+LEI4 $3263
+LABELV $3265
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3299
+JUMPV
+LABELV $3296
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $3302
+ADDRGP4 $3297
+JUMPV
+LABELV $3302
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $3305
+JUMPV
+LABELV $3304
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $3305
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3307
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3304
+LABELV $3307
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3308
+ADDRGP4 $2630
+JUMPV
+LABELV $3308
+ADDRGP4 $3310
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3297
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3299
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $3296
+ADDRGP4 $2630
+JUMPV
+LABELV $3252
+CNSTI4 1
+ARGI4
+ADDRLP4 216
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 $2934
+ARGP4
+ADDRLP4 220
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+NEI4 $3311
+ADDRGP4 $3313
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3311
+ADDRLP4 12
+ADDRGP4 cg+3196772
+INDIRI4
+ASGNI4
+ADDRGP4 $3317
+JUMPV
+LABELV $3314
+ADDRLP4 0
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $3321
+ADDRLP4 4
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556-1460
+ADDP4
+ASGNP4
+ADDRGP4 $3322
+JUMPV
+LABELV $3321
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+LABELV $3322
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $3325
+ADDRLP4 8
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1460
+ADDP4
+ASGNP4
+ADDRGP4 $3326
+JUMPV
+LABELV $3325
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+LABELV $3326
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 228
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3332
+ARGP4
+ADDRLP4 232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+NEI4 $3330
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 236
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1421
+ARGP4
+ADDRLP4 240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $3333
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3331
+JUMPV
+LABELV $3333
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1424
+ARGP4
+ADDRLP4 244
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+NEI4 $3335
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3331
+JUMPV
+LABELV $3335
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1427
+ARGP4
+ADDRLP4 248
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $3337
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $3331
+JUMPV
+LABELV $3337
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1430
+ARGP4
+ADDRLP4 252
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+NEI4 $3339
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $3331
+JUMPV
+LABELV $3339
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1433
+ARGP4
+ADDRLP4 256
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $3341
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $3331
+JUMPV
+LABELV $3341
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1436
+ARGP4
+ADDRLP4 260
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $3343
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $3331
+JUMPV
+LABELV $3343
+ADDRGP4 $3345
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3346
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3330
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3349
+ARGP4
+ADDRLP4 236
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+NEI4 $3347
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 240
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 240
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3352
+ARGP4
+ADDRLP4 244
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+NEI4 $3350
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3351
+JUMPV
+LABELV $3350
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1424
+ARGP4
+ADDRLP4 248
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $3353
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3354
+JUMPV
+LABELV $3353
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3357
+ARGP4
+ADDRLP4 252
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+NEI4 $3355
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $3356
+JUMPV
+LABELV $3355
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3360
+ARGP4
+ADDRLP4 256
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $3358
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $3359
+JUMPV
+LABELV $3358
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1421
+ARGP4
+ADDRLP4 260
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $3361
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $3362
+JUMPV
+LABELV $3361
+ADDRGP4 $3363
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3364
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3365
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3366
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3362
+LABELV $3359
+LABELV $3356
+LABELV $3354
+LABELV $3351
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3367
+ADDRGP4 $3315
+JUMPV
+LABELV $3367
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3348
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $3348
+JUMPV
+LABELV $3347
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3373
+ARGP4
+ADDRLP4 240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $3371
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3375
+JUMPV
+LABELV $3374
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $680
+ARGP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3375
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3374
+ADDRGP4 $3372
+JUMPV
+LABELV $3371
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3379
+ARGP4
+ADDRLP4 244
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+NEI4 $3377
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 248
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 248
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3382
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3380
+LABELV $3382
+ADDRGP4 $3383
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3384
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3380
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+GEI4 $3385
+ADDRGP4 $3387
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3385
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRGP4 $3378
+JUMPV
+LABELV $3377
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2700
+ARGP4
+ADDRLP4 248
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $3388
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 252
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 252
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3392
+ARGP4
+ADDRLP4 256
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $3390
+ADDRGP4 cg+1335060
+INDIRI4
+CNSTI4 0
+NEI4 $3393
+ADDRGP4 $3396
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3393
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 cg+1335048
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $3389
+JUMPV
+LABELV $3390
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3400
+ARGP4
+ADDRLP4 260
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $3398
+ADDRGP4 cg+1335060
+INDIRI4
+CNSTI4 0
+NEI4 $3401
+ADDRGP4 $3396
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3401
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 cg+1335048
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRGP4 $3389
+JUMPV
+LABELV $3398
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3407
+ARGP4
+ADDRLP4 264
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $3405
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRGP4 $3389
+JUMPV
+LABELV $3405
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3410
+ARGP4
+ADDRLP4 268
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $3408
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3411
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $3389
+JUMPV
+LABELV $3411
+ADDRGP4 $3413
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3414
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3408
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1424
+ARGP4
+ADDRLP4 272
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $3415
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3389
+JUMPV
+LABELV $3415
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1421
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $3417
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $3389
+JUMPV
+LABELV $3417
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3421
+ARGP4
+ADDRLP4 280
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $3419
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3389
+JUMPV
+LABELV $3419
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3357
+ARGP4
+ADDRLP4 284
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+NEI4 $3422
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $3389
+JUMPV
+LABELV $3422
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3426
+ARGP4
+ADDRLP4 288
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $3424
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $3389
+JUMPV
+LABELV $3424
+ADDRGP4 $3427
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3428
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3388
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3431
+ARGP4
+ADDRLP4 252
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+NEI4 $3429
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 256
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1424
+ARGP4
+ADDRLP4 260
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $3432
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3433
+JUMPV
+LABELV $3432
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3357
+ARGP4
+ADDRLP4 264
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $3434
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3435
+JUMPV
+LABELV $3434
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3360
+ARGP4
+ADDRLP4 268
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $3436
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $3437
+JUMPV
+LABELV $3436
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2700
+ARGP4
+ADDRLP4 272
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $3438
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $3439
+JUMPV
+LABELV $3438
+ADDRGP4 $3440
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3441
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3442
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3443
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3439
+LABELV $3437
+LABELV $3435
+LABELV $3433
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 276
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 276
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3430
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRGP4 $3430
+JUMPV
+LABELV $3429
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3448
+ARGP4
+ADDRLP4 256
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $3446
+ADDRLP4 260
+CNSTI4 2
+ASGNI4
+ADDRGP4 $3452
+JUMPV
+LABELV $3449
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRGP4 $2660
+ARGP4
+ADDRLP4 268
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $3453
+ADDRLP4 272
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRGP4 $3454
+JUMPV
+LABELV $3453
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 $2700
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $3455
+ADDRLP4 280
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+ADDRGP4 $3456
+JUMPV
+LABELV $3455
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRGP4 $3349
+ARGP4
+ADDRLP4 284
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+NEI4 $3457
+ADDRLP4 288
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ADDRLP4 288
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRGP4 $3458
+JUMPV
+LABELV $3457
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRGP4 $2858
+ARGP4
+ADDRLP4 292
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $3459
+ADDRLP4 296
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+CNSTI4 256
+BXORI4
+ASGNI4
+ADDRGP4 $3460
+JUMPV
+LABELV $3459
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $3461
+ARGP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3460
+LABELV $3458
+LABELV $3456
+LABELV $3454
+LABELV $3450
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3452
+ADDRLP4 264
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 264
+INDIRI4
+LTI4 $3449
+ADDRGP4 $3462
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3463
+ADDRGP4 $3465
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3463
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3466
+ADDRGP4 $3468
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3466
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $3469
+ADDRGP4 $3471
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3469
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $3472
+ADDRGP4 $3474
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3472
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3447
+JUMPV
+LABELV $3446
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $451
+ARGP4
+ADDRLP4 260
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $3475
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1424
+ARGP4
+ADDRLP4 268
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $3477
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3478
+JUMPV
+LABELV $3477
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3357
+ARGP4
+ADDRLP4 272
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $3479
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3480
+JUMPV
+LABELV $3479
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3360
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $3481
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $3482
+JUMPV
+LABELV $3481
+ADDRGP4 $3483
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3484
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3485
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3486
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3482
+LABELV $3480
+LABELV $3478
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 280
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3476
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 292
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3476
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 304
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3476
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 312
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 316
+INDIRF4
+ASGNF4
+ADDRGP4 $3476
+JUMPV
+LABELV $3475
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3495
+ARGP4
+ADDRLP4 264
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $3493
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 268
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2660
+ARGP4
+ADDRLP4 272
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $3496
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 276
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 276
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3498
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3498
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 280
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $3500
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3500
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 284
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3502
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3502
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3504
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3504
+ADDRLP4 296
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3494
+JUMPV
+LABELV $3498
+ADDRGP4 $3506
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3494
+JUMPV
+LABELV $3496
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2700
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $3507
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 280
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3509
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3509
+ADDRLP4 0
+INDIRP4
+CNSTI4 1364
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $3511
+ADDRLP4 284
+CNSTI4 1460
+ASGNI4
+ADDRLP4 28
+ADDRLP4 284
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1364
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 284
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1368
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3512
+JUMPV
+LABELV $3511
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+LABELV $3512
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 284
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+NEI4 $3515
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3315
+ADDRLP4 28
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3515
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 288
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3519
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3519
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $3521
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3523
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3523
+LABELV $3521
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3525
+ADDRLP4 36
+ADDRLP4 28
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 48
+CNSTI4 1460
+ADDRLP4 0
+INDIRP4
+CNSTI4 1368
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 296
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 296
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3526
+JUMPV
+LABELV $3525
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $3529
+ADDRLP4 296
+CNSTI4 52
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 304
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 300
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3530
+JUMPV
+LABELV $3529
+ADDRLP4 292
+CNSTI4 16
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 48
+ADDRLP4 8
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 36+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 48+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 296
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 296
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3530
+LABELV $3526
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3494
+ADDRLP4 28
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 292
+CNSTI4 136
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 296
+CNSTI4 140
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3494
+JUMPV
+LABELV $3509
+ADDRGP4 $3535
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3494
+JUMPV
+LABELV $3507
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3538
+ARGP4
+ADDRLP4 280
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $3536
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 284
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3539
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3539
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $3541
+ADDRLP4 288
+CNSTI4 1460
+ASGNI4
+ADDRLP4 28
+ADDRLP4 288
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 288
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1392
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3542
+JUMPV
+LABELV $3541
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+LABELV $3542
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 288
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $3545
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3315
+ADDRLP4 28
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3545
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRLP4 292
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3549
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3549
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1288
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3551
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1288
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3551
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3553
+ADDRLP4 300
+CNSTI4 92
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 304
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 308
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3554
+JUMPV
+LABELV $3553
+ADDRLP4 300
+CNSTI4 92
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 308
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 312
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3554
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3494
+ADDRLP4 28
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 300
+CNSTI4 156
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 304
+CNSTI4 160
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3494
+JUMPV
+LABELV $3539
+ADDRGP4 $3557
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3494
+JUMPV
+LABELV $3536
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3560
+ARGP4
+ADDRLP4 284
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+NEI4 $3558
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 288
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3561
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3561
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $3563
+ADDRLP4 292
+CNSTI4 1460
+ASGNI4
+ADDRLP4 28
+ADDRLP4 292
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 292
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1392
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3564
+JUMPV
+LABELV $3563
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+LABELV $3564
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 292
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $3567
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3315
+ADDRLP4 28
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3567
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 296
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3571
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3571
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1304
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3573
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1304
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3573
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3575
+ADDRLP4 304
+CNSTI4 96
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 308
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 312
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3576
+JUMPV
+LABELV $3575
+ADDRLP4 304
+CNSTI4 96
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 312
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 316
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3576
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3494
+ADDRLP4 28
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 304
+CNSTI4 168
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 308
+CNSTI4 172
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3494
+JUMPV
+LABELV $3561
+ADDRGP4 $3579
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3494
+JUMPV
+LABELV $3558
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3582
+ARGP4
+ADDRLP4 288
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $3580
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 292
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 292
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3583
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3583
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $3585
+ADDRLP4 296
+CNSTI4 1460
+ASGNI4
+ADDRLP4 28
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1392
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3586
+JUMPV
+LABELV $3585
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+LABELV $3586
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 296
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $3589
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3315
+ADDRLP4 28
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3589
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3593
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3593
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1320
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3595
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1320
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3595
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3597
+ADDRLP4 308
+CNSTI4 100
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 312
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 316
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3598
+JUMPV
+LABELV $3597
+ADDRLP4 308
+CNSTI4 100
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 316
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 320
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 316
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3598
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3494
+ADDRLP4 28
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 308
+CNSTI4 180
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 312
+CNSTI4 184
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3494
+JUMPV
+LABELV $3583
+ADDRGP4 $3601
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3494
+JUMPV
+LABELV $3580
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3349
+ARGP4
+ADDRLP4 292
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $3602
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3604
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3604
+ADDRLP4 0
+INDIRP4
+CNSTI4 1380
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $3606
+ADDRLP4 300
+CNSTI4 1460
+ASGNI4
+ADDRLP4 28
+ADDRLP4 300
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1380
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 300
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1384
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3607
+JUMPV
+LABELV $3606
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+LABELV $3607
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 300
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $3610
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3315
+ADDRLP4 28
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3610
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 304
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3614
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3614
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1336
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3616
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1336
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3616
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3618
+ADDRLP4 312
+CNSTI4 104
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 316
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 320
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 316
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3619
+JUMPV
+LABELV $3618
+ADDRLP4 312
+CNSTI4 104
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 320
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 324
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 320
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3619
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3494
+ADDRLP4 28
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 312
+CNSTI4 192
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 316
+CNSTI4 196
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3494
+JUMPV
+LABELV $3604
+ADDRGP4 $3622
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3494
+JUMPV
+LABELV $3602
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3431
+ARGP4
+ADDRLP4 296
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $3623
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 300
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3625
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3625
+ADDRLP4 0
+INDIRP4
+CNSTI4 1372
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $3627
+ADDRLP4 304
+CNSTI4 1460
+ASGNI4
+ADDRLP4 28
+ADDRLP4 304
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1372
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 304
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1376
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3628
+JUMPV
+LABELV $3627
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+LABELV $3628
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 304
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+NEI4 $3631
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3315
+ADDRLP4 28
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3631
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 308
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3635
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3635
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1352
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3637
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1352
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3637
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3639
+ADDRLP4 316
+CNSTI4 24
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 320
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 320
+INDIRF4
+ARGF4
+ADDRLP4 324
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 328
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 324
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 328
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 328
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3640
+JUMPV
+LABELV $3639
+ADDRLP4 316
+CNSTI4 24
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 324
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 324
+INDIRF4
+ARGF4
+ADDRLP4 328
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 332
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 332
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 332
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3640
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3494
+ADDRLP4 28
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 316
+CNSTI4 204
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 320
+CNSTI4 208
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3494
+JUMPV
+LABELV $3625
+ADDRGP4 $3643
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3494
+JUMPV
+LABELV $3623
+ADDRGP4 $3644
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3645
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3646
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3493
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3649
+ARGP4
+ADDRLP4 268
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $3647
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2660
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $3650
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 280
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3652
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3652
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 284
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+NEI4 $3654
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3654
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 288
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3656
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3656
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3658
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3658
+ADDRLP4 300
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3648
+JUMPV
+LABELV $3652
+ADDRGP4 $3660
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3648
+JUMPV
+LABELV $3650
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2700
+ARGP4
+ADDRLP4 280
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $3661
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 284
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3663
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3663
+ADDRLP4 0
+INDIRP4
+CNSTI4 1364
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $3665
+ADDRLP4 288
+CNSTI4 1460
+ASGNI4
+ADDRLP4 28
+ADDRLP4 288
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1364
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 288
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1368
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3666
+JUMPV
+LABELV $3665
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+LABELV $3666
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 288
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $3669
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3315
+ADDRLP4 28
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3669
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 292
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3673
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3673
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $3675
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3677
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3677
+LABELV $3675
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3679
+ADDRLP4 36
+ADDRLP4 28
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 48
+CNSTI4 1460
+ADDRLP4 0
+INDIRP4
+CNSTI4 1368
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 300
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 304
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 300
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3680
+JUMPV
+LABELV $3679
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $3683
+ADDRLP4 300
+CNSTI4 52
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 308
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3684
+JUMPV
+LABELV $3683
+ADDRLP4 296
+CNSTI4 16
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 48
+ADDRLP4 8
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 36+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 48+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 300
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 304
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 300
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3684
+LABELV $3680
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3648
+ADDRLP4 28
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 296
+CNSTI4 136
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 140
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3648
+JUMPV
+LABELV $3663
+ADDRGP4 $3689
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3648
+JUMPV
+LABELV $3661
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3538
+ARGP4
+ADDRLP4 284
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+NEI4 $3690
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 288
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3692
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3692
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $3694
+ADDRLP4 292
+CNSTI4 1460
+ASGNI4
+ADDRLP4 28
+ADDRLP4 292
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 292
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1392
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3695
+JUMPV
+LABELV $3694
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+LABELV $3695
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 292
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $3698
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3315
+ADDRLP4 28
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3698
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 296
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3702
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3702
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1288
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3704
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1288
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3704
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3706
+ADDRLP4 304
+CNSTI4 92
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 308
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 312
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3707
+JUMPV
+LABELV $3706
+ADDRLP4 304
+CNSTI4 92
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 312
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 316
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3707
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3648
+ADDRLP4 28
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 304
+CNSTI4 156
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 308
+CNSTI4 160
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3648
+JUMPV
+LABELV $3692
+ADDRGP4 $3710
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3648
+JUMPV
+LABELV $3690
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3560
+ARGP4
+ADDRLP4 288
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $3711
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 292
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 292
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3713
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3713
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $3715
+ADDRLP4 296
+CNSTI4 1460
+ASGNI4
+ADDRLP4 28
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1392
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3716
+JUMPV
+LABELV $3715
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+LABELV $3716
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 296
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $3719
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3315
+ADDRLP4 28
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3719
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3723
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3723
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1304
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3725
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1304
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3725
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3727
+ADDRLP4 308
+CNSTI4 96
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 312
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 316
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3728
+JUMPV
+LABELV $3727
+ADDRLP4 308
+CNSTI4 96
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 316
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 320
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 316
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3728
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3648
+ADDRLP4 28
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 308
+CNSTI4 168
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 312
+CNSTI4 172
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3648
+JUMPV
+LABELV $3713
+ADDRGP4 $3731
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3648
+JUMPV
+LABELV $3711
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3582
+ARGP4
+ADDRLP4 292
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $3732
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3734
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3734
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $3736
+ADDRLP4 300
+CNSTI4 1460
+ASGNI4
+ADDRLP4 28
+ADDRLP4 300
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 300
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1392
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3737
+JUMPV
+LABELV $3736
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+LABELV $3737
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 300
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $3740
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3315
+ADDRLP4 28
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3740
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 304
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3744
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3744
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1320
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3746
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1320
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3746
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3748
+ADDRLP4 312
+CNSTI4 100
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 316
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 320
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 316
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3749
+JUMPV
+LABELV $3748
+ADDRLP4 312
+CNSTI4 100
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 320
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 324
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 320
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3749
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3648
+ADDRLP4 28
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 312
+CNSTI4 180
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 316
+CNSTI4 184
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3648
+JUMPV
+LABELV $3734
+ADDRGP4 $3752
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3648
+JUMPV
+LABELV $3732
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3349
+ARGP4
+ADDRLP4 296
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $3753
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 300
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3755
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3755
+ADDRLP4 0
+INDIRP4
+CNSTI4 1380
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $3757
+ADDRLP4 304
+CNSTI4 1460
+ASGNI4
+ADDRLP4 28
+ADDRLP4 304
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1380
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 304
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1384
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3758
+JUMPV
+LABELV $3757
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+LABELV $3758
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 304
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+NEI4 $3761
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3315
+ADDRLP4 28
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3761
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 308
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3765
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3765
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1336
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3767
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1336
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3767
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3769
+ADDRLP4 316
+CNSTI4 104
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 320
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 324
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 320
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3770
+JUMPV
+LABELV $3769
+ADDRLP4 316
+CNSTI4 104
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 324
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 328
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 324
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 328
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 328
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3770
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3648
+ADDRLP4 28
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 316
+CNSTI4 192
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 320
+CNSTI4 196
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3648
+JUMPV
+LABELV $3755
+ADDRGP4 $3773
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3648
+JUMPV
+LABELV $3753
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $3431
+ARGP4
+ADDRLP4 300
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $3774
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 304
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3776
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3776
+ADDRLP4 0
+INDIRP4
+CNSTI4 1372
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $3778
+ADDRLP4 308
+CNSTI4 1460
+ASGNI4
+ADDRLP4 28
+ADDRLP4 308
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1372
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 308
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1376
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRGP4 $3779
+JUMPV
+LABELV $3778
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+LABELV $3779
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 308
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+NEI4 $3782
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3315
+ADDRLP4 28
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3315
+JUMPV
+LABELV $3782
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 312
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+CNSTF4 0
+GTF4 $3786
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3786
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1352
+ADDP4
+INDIRF4
+MULF4
+LEF4 $3788
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 1352
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3788
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3790
+ADDRLP4 320
+CNSTI4 24
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 324
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 324
+INDIRF4
+ARGF4
+ADDRLP4 328
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 332
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 332
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 332
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3791
+JUMPV
+LABELV $3790
+ADDRLP4 320
+CNSTI4 24
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 328
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 328
+INDIRF4
+ARGF4
+ADDRLP4 332
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 336
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 336
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 336
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3791
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3648
+ADDRLP4 28
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 320
+CNSTI4 204
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 324
+CNSTI4 208
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3648
+JUMPV
+LABELV $3776
+ADDRGP4 $3794
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3648
+JUMPV
+LABELV $3774
+ADDRGP4 $3795
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3645
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3796
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3647
+ADDRGP4 $3797
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2630
+JUMPV
+LABELV $3648
+LABELV $3494
+LABELV $3476
+LABELV $3447
+LABELV $3430
+LABELV $3389
+LABELV $3378
+LABELV $3372
+LABELV $3348
+LABELV $3331
+LABELV $3315
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3317
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196776
+INDIRI4
+LEI4 $3314
+ADDRGP4 CG_CameraResetInternalLengths
+CALLV
+pop
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $2630
+endproc CG_ChangeSelectedCameraPoints_f 488 44
+proc CG_SetViewPointMark_f 0 0
+ADDRGP4 cg+1335060
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+1335048
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+LABELV $3798
+endproc CG_SetViewPointMark_f 0 0
+proc CG_GotoViewPointMark_f 4 4
+ADDRGP4 cg+1335060
+INDIRI4
+CNSTI4 0
+NEI4 $3804
+ADDRGP4 $3807
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3803
+JUMPV
+LABELV $3804
+ADDRGP4 cg+1332124
+ADDRGP4 cg+1335048
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332224+20
+ADDRGP4 cg+1335048
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 cg+1332224+20+8
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+SUBF4
+ASGNF4
+ADDRGP4 cg+1332224+32
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332224+32+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332224+32+8
+CNSTF4 0
+ASGNF4
+LABELV $3803
+endproc CG_GotoViewPointMark_f 4 4
+export CG_CleanUpFieldNumber
+proc CG_CleanUpFieldNumber 4 0
+ADDRLP4 0
+ADDRGP4 cg+3196780
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GEI4 $3826
+ADDRLP4 0
+CNSTI4 37
+ASGNI4
+ADDRGP4 $3827
+JUMPV
+LABELV $3826
+ADDRLP4 0
+INDIRI4
+CNSTI4 37
+LEI4 $3828
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+LABELV $3828
+LABELV $3827
+ADDRGP4 cg+3196780
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $3824
+endproc CG_CleanUpFieldNumber 4 0
+proc CG_SelectNextField_f 4 0
+ADDRLP4 0
+ADDRGP4 cg+3196780
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 CG_CleanUpFieldNumber
+CALLV
+pop
+LABELV $3831
+endproc CG_SelectNextField_f 4 0
+proc CG_SelectPrevField_f 4 0
+ADDRLP4 0
+ADDRGP4 cg+3196780
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 CG_CleanUpFieldNumber
+CALLV
+pop
+LABELV $3833
+endproc CG_SelectPrevField_f 4 0
+proc CG_ChangeSelectedField_f 12 4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+GEI4 $3836
+ADDRGP4 $3835
+JUMPV
+LABELV $3836
+ADDRLP4 4
+CNSTI4 1460
+ADDRGP4 cg+3196772
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+3196780
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $3842
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRGP4 $3843
+JUMPV
+LABELV $3842
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $3846
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRGP4 $3847
+JUMPV
+LABELV $3846
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $3849
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 6
+LTI4 $3850
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3850
+JUMPV
+LABELV $3849
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $3853
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 9
+LTI4 $3854
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3854
+JUMPV
+LABELV $3853
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $3857
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 4
+LTI4 $3858
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3858
+JUMPV
+LABELV $3857
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $3861
+ADDRGP4 $3863
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 $3862
+JUMPV
+LABELV $3861
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $3864
+ADDRGP4 $3866
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 $3865
+JUMPV
+LABELV $3864
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $3867
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $3868
+JUMPV
+LABELV $3867
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $3871
+ADDRGP4 cg+1334988
+INDIRI4
+CNSTI4 -1
+LEI4 $3873
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cg+1334988
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRGP4 cg+1335012
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+1335016
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRGP4 cg+1335020
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1496
+ADDRGP4 cg+1334988
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+12+12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3872
+JUMPV
+LABELV $3873
+ADDRGP4 $3883
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 $3872
+JUMPV
+LABELV $3871
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $3884
+ADDRGP4 $3886
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 $3885
+JUMPV
+LABELV $3884
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $3887
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $3888
+ADDRLP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3888
+JUMPV
+LABELV $3887
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+NEI4 $3891
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $3893
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $3893
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $3892
+JUMPV
+LABELV $3893
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+ADDRGP4 $3892
+JUMPV
+LABELV $3891
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+NEI4 $3899
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $3900
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3900
+JUMPV
+LABELV $3899
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $3903
+ADDRLP4 0
+INDIRI4
+CNSTI4 36
+GTI4 $3903
+ADDRGP4 $3905
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 $3904
+JUMPV
+LABELV $3903
+ADDRLP4 0
+INDIRI4
+CNSTI4 37
+NEI4 $3906
+ADDRGP4 $3908
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 $3907
+JUMPV
+LABELV $3906
+ADDRGP4 $3909
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3907
+LABELV $3904
+LABELV $3900
+LABELV $3892
+LABELV $3888
+LABELV $3885
+LABELV $3872
+LABELV $3868
+LABELV $3865
+LABELV $3862
+LABELV $3858
+LABELV $3854
+LABELV $3850
+LABELV $3847
+LABELV $3843
+ADDRGP4 CG_UpdateCameraInfo
+CALLV
+pop
+LABELV $3835
+endproc CG_ChangeSelectedField_f 12 4
+proc CG_FXMath_f 1048 12
+ADDRLP4 0
+CNSTI1 0
+ASGNI1
+ADDRLP4 1040
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+GEI4 $3911
+ADDRGP4 $3913
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3914
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3915
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3910
+JUMPV
+LABELV $3911
+ADDRLP4 1024
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3919
+JUMPV
+LABELV $3916
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $3920
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $3917
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3919
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3916
+ADDRLP4 0
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 1036
+ARGP4
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+pop
+ADDRGP4 $3921
+ARGP4
+ADDRLP4 1032
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3910
+endproc CG_FXMath_f 1048 12
+proc CG_Vibrate_f 16 4
+ADDRLP4 4
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+GEI4 $3923
+ADDRLP4 0
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $3924
+JUMPV
+LABELV $3923
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $3924
+ADDRGP4 cg+3196884
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+3196888
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+3196892
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 8
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $3922
+endproc CG_Vibrate_f 16 4
+proc CG_FXLoad_f 8 4
+ADDRLP4 0
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $3930
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_ReloadQ3mmeScripts
+CALLV
+pop
+ADDRGP4 $3931
+JUMPV
+LABELV $3930
+ADDRGP4 cg_fxfile+16
+ARGP4
+ADDRGP4 CG_ReloadQ3mmeScripts
+CALLV
+pop
+LABELV $3931
+LABELV $3929
+endproc CG_FXLoad_f 8 4
+proc CG_LocalEnts_f 0 0
+ADDRGP4 CG_ListLocalEntities
+CALLV
+pop
+LABELV $3933
+endproc CG_LocalEnts_f 0 0
+proc CG_ClearFX_f 16 8
+ADDRLP4 4
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+GEI4 $3935
+CNSTI4 1
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 CG_RemoveFXLocalEntities
+CALLV
+pop
+ADDRGP4 $3936
+JUMPV
+LABELV $3935
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 CG_RemoveFXLocalEntities
+CALLV
+pop
+LABELV $3936
+LABELV $3934
+endproc CG_ClearFX_f 16 8
+proc CG_GotoAdvertisement_f 40 20
+ADDRLP4 16
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+GEI4 $3938
+ADDRGP4 $3940
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3937
+JUMPV
+LABELV $3938
+ADDRGP4 cgs+1953504
+INDIRI4
+CNSTI4 0
+NEI4 $3941
+ADDRGP4 $3944
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3937
+JUMPV
+LABELV $3941
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $3945
+ADDRGP4 $3947
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3937
+JUMPV
+LABELV $3945
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cgs+1953508
+INDIRI4
+LEI4 $3948
+ADDRGP4 $3951
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 cgs+1953508
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3937
+JUMPV
+LABELV $3948
+ADDRGP4 cg+1332220
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332124
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1953632-64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332124+4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1953632+4-64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332124+8
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1953632+8-64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cgs+1953632+48-64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cgs+1953632+52-64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1953632+56-64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332124
+ADDRGP4 cg+1332124
+INDIRF4
+CNSTF4 1120403456
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+4
+ADDRGP4 cg+1332124+4
+INDIRF4
+CNSTF4 1120403456
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+8
+ADDRGP4 cg+1332124+8
+INDIRF4
+CNSTF4 1120403456
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 3212836864
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+1332136
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $3995
+ARGP4
+ADDRGP4 cg+1332124
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+1332124+4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+1332124+8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+1332136+4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $3937
+endproc CG_GotoAdvertisement_f 40 20
+export CG_ChangeConfigString
+proc CG_ChangeConfigString 20136 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20112
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20116
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs
+ADDP4
+INDIRI4
+ADDRGP4 cgs+4096
+ADDP4
+ASGNP4
+ADDRLP4 20116
+INDIRP4
+ARGP4
+ADDRLP4 20112
+INDIRP4
+ARGP4
+ADDRLP4 20120
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 20120
+INDIRI4
+CNSTI4 0
+NEI4 $4005
+ADDRGP4 $4003
+JUMPV
+LABELV $4005
+ADDRLP4 20124
+ADDRGP4 cgs
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20124
+INDIRP4
+INDIRB
+ASGNB 20100
+ADDRLP4 20124
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 20100
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cgs+20096
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4008
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $4012
+ADDRLP4 4
+ADDRLP4 20112
+INDIRP4
+ASGNP4
+ADDRGP4 $4013
+JUMPV
+LABELV $4012
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRI4
+ADDRLP4 12+4096
+ADDP4
+ASGNP4
+LABELV $4013
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4015
+ADDRGP4 $4009
+JUMPV
+LABELV $4015
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20128
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 20128
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRGP4 cgs+20096
+INDIRI4
+ADDI4
+CNSTI4 16000
+LEI4 $4017
+ADDRGP4 $4020
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cgs
+ADDRLP4 12
+INDIRB
+ASGNB 20100
+ADDRGP4 $4003
+JUMPV
+LABELV $4017
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs
+ADDP4
+ADDRGP4 cgs+20096
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+20096
+INDIRI4
+ADDRGP4 cgs+4096
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 20132
+ADDRGP4 cgs+20096
+ASGNP4
+ADDRLP4 20132
+INDIRP4
+ADDRLP4 20132
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDI4
+ASGNI4
+LABELV $4009
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4008
+LABELV $4003
+endproc CG_ChangeConfigString 20136 12
+proc CG_ClientOverrideClearClient 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4028
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $4026
+LABELV $4028
+ADDRGP4 $4029
+ARGP4
+ADDRGP4 $4030
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $4026
+ADDRLP4 0
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2172
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2192
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2216
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2220
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4032
+ADDRGP4 $4025
+JUMPV
+LABELV $4032
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+LABELV $4025
+endproc CG_ClientOverrideClearClient 8 12
+proc CG_ClientOverride_f 6064 12
+ADDRLP4 5868
+CNSTI4 -3
+ASGNI4
+ADDRLP4 5876
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4035
+ADDRGP4 $4034
+JUMPV
+LABELV $4035
+ADDRLP4 5828
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 5832
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 5836
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 5880
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 5880
+INDIRI4
+CNSTI4 1
+LEI4 $4038
+CNSTI4 1
+ARGI4
+ADDRLP4 5884
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 5884
+INDIRP4
+ARGP4
+ADDRLP4 5888
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5888
+INDIRI4
+CNSTI4 0
+NEI4 $4040
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+ADDRLP4 5896
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 5896
+INDIRI4
+CNSTI4 2
+LEI4 $4034
+CNSTI4 2
+ARGI4
+ADDRLP4 5900
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $4047
+ARGP4
+ADDRLP4 5900
+INDIRP4
+ARGP4
+ADDRLP4 5904
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5904
+INDIRI4
+CNSTI4 0
+NEI4 $4045
+ADDRLP4 5816
+CNSTI4 0
+ASGNI4
+LABELV $4048
+ADDRLP4 5816
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 5908
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4532
+ADDRLP4 5908
+INDIRP4
+ASGNP4
+ADDRLP4 4532
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4052
+ADDRGP4 $4049
+JUMPV
+LABELV $4052
+ADDRLP4 4532
+INDIRP4
+ARGP4
+ADDRGP4 $4054
+ARGP4
+ADDRLP4 5912
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 5912
+INDIRP4
+ARGP4
+ADDRLP4 5916
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 5892
+ADDRLP4 5916
+INDIRI4
+ASGNI4
+ADDRLP4 5892
+INDIRI4
+CNSTI4 1
+NEI4 $4055
+ADDRLP4 5816
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClientOverrideClearClient
+CALLV
+pop
+LABELV $4055
+LABELV $4049
+ADDRLP4 5816
+ADDRLP4 5816
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 5816
+INDIRI4
+CNSTI4 64
+LTI4 $4048
+ADDRGP4 $4034
+JUMPV
+LABELV $4045
+CNSTI4 2
+ARGI4
+ADDRLP4 5908
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $4059
+ARGP4
+ADDRLP4 5908
+INDIRP4
+ARGP4
+ADDRLP4 5912
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5912
+INDIRI4
+CNSTI4 0
+NEI4 $4057
+ADDRLP4 5816
+CNSTI4 0
+ASGNI4
+LABELV $4060
+ADDRLP4 5816
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 5916
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4532
+ADDRLP4 5916
+INDIRP4
+ASGNP4
+ADDRLP4 4532
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4064
+ADDRGP4 $4061
+JUMPV
+LABELV $4064
+ADDRLP4 4532
+INDIRP4
+ARGP4
+ADDRGP4 $4054
+ARGP4
+ADDRLP4 5920
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 5920
+INDIRP4
+ARGP4
+ADDRLP4 5924
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 5892
+ADDRLP4 5924
+INDIRI4
+ASGNI4
+ADDRLP4 5892
+INDIRI4
+CNSTI4 2
+NEI4 $4066
+ADDRLP4 5816
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClientOverrideClearClient
+CALLV
+pop
+LABELV $4066
+LABELV $4061
+ADDRLP4 5816
+ADDRLP4 5816
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 5816
+INDIRI4
+CNSTI4 64
+LTI4 $4060
+ADDRGP4 $4034
+JUMPV
+LABELV $4057
+CNSTI4 2
+ARGI4
+ADDRLP4 5916
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $4070
+ARGP4
+ADDRLP4 5916
+INDIRP4
+ARGP4
+ADDRLP4 5920
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5920
+INDIRI4
+CNSTI4 0
+NEI4 $4068
+ADDRLP4 5816
+CNSTI4 0
+ASGNI4
+LABELV $4071
+ADDRLP4 5816
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 5924
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4532
+ADDRLP4 5924
+INDIRP4
+ASGNP4
+ADDRLP4 4532
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4075
+ADDRGP4 $4072
+JUMPV
+LABELV $4075
+ADDRLP4 4532
+INDIRP4
+ARGP4
+ADDRGP4 $4054
+ARGP4
+ADDRLP4 5928
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 5928
+INDIRP4
+ARGP4
+ADDRLP4 5932
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 5892
+ADDRLP4 5932
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 5936
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 5936
+INDIRI4
+CNSTI4 0
+EQI4 $4077
+ADDRLP4 5892
+INDIRI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $4077
+ADDRLP4 5816
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClientOverrideClearClient
+CALLV
+pop
+LABELV $4077
+LABELV $4072
+ADDRLP4 5816
+ADDRLP4 5816
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 5816
+INDIRI4
+CNSTI4 64
+LTI4 $4071
+ADDRGP4 $4034
+JUMPV
+LABELV $4068
+CNSTI4 2
+ARGI4
+ADDRLP4 5924
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $4083
+ARGP4
+ADDRLP4 5924
+INDIRP4
+ARGP4
+ADDRLP4 5928
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5928
+INDIRI4
+CNSTI4 0
+NEI4 $4081
+ADDRLP4 5816
+CNSTI4 0
+ASGNI4
+LABELV $4084
+ADDRLP4 5816
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 5932
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4532
+ADDRLP4 5932
+INDIRP4
+ASGNP4
+ADDRLP4 4532
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4088
+ADDRGP4 $4085
+JUMPV
+LABELV $4088
+ADDRLP4 4532
+INDIRP4
+ARGP4
+ADDRGP4 $4054
+ARGP4
+ADDRLP4 5936
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 5936
+INDIRP4
+ARGP4
+ADDRLP4 5940
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 5892
+ADDRLP4 5940
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 5944
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 5944
+INDIRI4
+CNSTI4 0
+EQI4 $4090
+ADDRLP4 5892
+INDIRI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+NEI4 $4090
+ADDRLP4 5816
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClientOverrideClearClient
+CALLV
+pop
+LABELV $4090
+LABELV $4085
+ADDRLP4 5816
+ADDRLP4 5816
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 5816
+INDIRI4
+CNSTI4 64
+LTI4 $4084
+ADDRGP4 $4034
+JUMPV
+LABELV $4081
+CNSTI4 2
+ARGI4
+ADDRLP4 5932
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $4096
+ARGP4
+ADDRLP4 5932
+INDIRP4
+ARGP4
+ADDRLP4 5936
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5936
+INDIRI4
+CNSTI4 0
+NEI4 $4094
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClientOverrideClearClient
+CALLV
+pop
+ADDRGP4 $4034
+JUMPV
+LABELV $4094
+CNSTI4 2
+ARGI4
+ADDRLP4 5940
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1653
+ARGP4
+ADDRLP4 5940
+INDIRP4
+ARGP4
+ADDRLP4 5944
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5944
+INDIRI4
+CNSTI4 0
+NEI4 $4098
+ADDRLP4 5816
+CNSTI4 0
+ASGNI4
+LABELV $4100
+ADDRLP4 5816
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClientOverrideClearClient
+CALLV
+pop
+LABELV $4101
+ADDRLP4 5816
+ADDRLP4 5816
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 5816
+INDIRI4
+CNSTI4 64
+LTI4 $4100
+ADDRGP4 $4034
+JUMPV
+LABELV $4098
+CNSTI4 2
+ARGI4
+ADDRLP4 5952
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 5952
+INDIRP4
+ARGP4
+ADDRLP4 5956
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 5948
+ADDRLP4 5956
+INDIRI4
+ASGNI4
+ADDRLP4 5948
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClientOverrideClearClient
+CALLV
+pop
+ADDRGP4 $4034
+JUMPV
+LABELV $4040
+LABELV $4038
+ADDRLP4 5884
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 5884
+INDIRI4
+CNSTI4 4
+GEI4 $4104
+ADDRGP4 $4106
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4107
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4034
+JUMPV
+LABELV $4104
+ADDRLP4 5820
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 5888
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $4047
+ARGP4
+ADDRLP4 5888
+INDIRP4
+ARGP4
+ADDRLP4 5892
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5892
+INDIRI4
+CNSTI4 0
+NEI4 $4108
+ADDRLP4 5896
+CNSTI4 1
+ASGNI4
+ADDRLP4 5820
+ADDRLP4 5896
+INDIRI4
+ASGNI4
+ADDRLP4 5868
+ADDRLP4 5896
+INDIRI4
+ASGNI4
+ADDRGP4 $4109
+JUMPV
+LABELV $4108
+CNSTI4 1
+ARGI4
+ADDRLP4 5896
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $4059
+ARGP4
+ADDRLP4 5896
+INDIRP4
+ARGP4
+ADDRLP4 5900
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5900
+INDIRI4
+CNSTI4 0
+NEI4 $4110
+ADDRLP4 5820
+CNSTI4 1
+ASGNI4
+ADDRLP4 5868
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4111
+JUMPV
+LABELV $4110
+CNSTI4 1
+ARGI4
+ADDRLP4 5904
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $4070
+ARGP4
+ADDRLP4 5904
+INDIRP4
+ARGP4
+ADDRLP4 5908
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5908
+INDIRI4
+CNSTI4 0
+NEI4 $4112
+ADDRLP4 5820
+CNSTI4 1
+ASGNI4
+ADDRLP4 5868
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4113
+JUMPV
+LABELV $4112
+CNSTI4 1
+ARGI4
+ADDRLP4 5912
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $4083
+ARGP4
+ADDRLP4 5912
+INDIRP4
+ARGP4
+ADDRLP4 5916
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5916
+INDIRI4
+CNSTI4 0
+NEI4 $4114
+ADDRLP4 5820
+CNSTI4 1
+ASGNI4
+ADDRLP4 5868
+CNSTI4 -3
+ASGNI4
+ADDRGP4 $4115
+JUMPV
+LABELV $4114
+CNSTI4 1
+ARGI4
+ADDRLP4 5920
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1653
+ARGP4
+ADDRLP4 5920
+INDIRP4
+ARGP4
+ADDRLP4 5924
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5924
+INDIRI4
+CNSTI4 0
+NEI4 $4116
+ADDRLP4 5820
+CNSTI4 1
+ASGNI4
+ADDRLP4 5868
+CNSTI4 -2
+ASGNI4
+ADDRGP4 $4117
+JUMPV
+LABELV $4116
+CNSTI4 1
+ARGI4
+ADDRLP4 5928
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $4096
+ARGP4
+ADDRLP4 5928
+INDIRP4
+ARGP4
+ADDRLP4 5932
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5932
+INDIRI4
+CNSTI4 0
+NEI4 $4118
+ADDRLP4 5820
+CNSTI4 0
+ASGNI4
+ADDRLP4 5876
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 5876
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $4119
+ADDRGP4 $4125
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4034
+JUMPV
+LABELV $4118
+ADDRLP4 5820
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 5936
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 5936
+INDIRP4
+ARGP4
+ADDRLP4 5940
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 5876
+ADDRLP4 5940
+INDIRI4
+ASGNI4
+ADDRLP4 5876
+INDIRI4
+CNSTI4 0
+LTI4 $4128
+ADDRLP4 5876
+INDIRI4
+CNSTI4 64
+LTI4 $4126
+LABELV $4128
+ADDRGP4 $4129
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4034
+JUMPV
+LABELV $4126
+LABELV $4119
+LABELV $4117
+LABELV $4115
+LABELV $4113
+LABELV $4111
+LABELV $4109
+ADDRLP4 5816
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4133
+JUMPV
+LABELV $4130
+ADDRLP4 5816
+INDIRI4
+ARGI4
+ADDRLP4 5936
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 5624
+ARGP4
+ADDRLP4 5936
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 5816
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 5940
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 5688
+ARGP4
+ADDRLP4 5940
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 5820
+INDIRI4
+CNSTI4 0
+EQI4 $4134
+ADDRLP4 5872
+CNSTI4 0
+ASGNI4
+ADDRLP4 5824
+CNSTI4 64
+ASGNI4
+ADDRGP4 $4135
+JUMPV
+LABELV $4134
+ADDRLP4 5872
+ADDRLP4 5876
+INDIRI4
+ASGNI4
+ADDRLP4 5824
+ADDRLP4 5872
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4135
+ADDRLP4 0
+ADDRLP4 5872
+INDIRI4
+ASGNI4
+ADDRGP4 $4139
+JUMPV
+LABELV $4136
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 5948
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4532
+ADDRLP4 5948
+INDIRP4
+ASGNP4
+ADDRLP4 4532
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4140
+ADDRGP4 $4137
+JUMPV
+LABELV $4140
+ADDRLP4 5820
+INDIRI4
+CNSTI4 0
+EQI4 $4142
+ADDRLP4 4532
+INDIRP4
+ARGP4
+ADDRGP4 $4054
+ARGP4
+ADDRLP4 5952
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 5952
+INDIRP4
+ARGP4
+ADDRLP4 5956
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 5944
+ADDRLP4 5956
+INDIRI4
+ASGNI4
+ADDRLP4 5868
+INDIRI4
+CNSTI4 -3
+LTI4 $4137
+ADDRLP4 5964
+CNSTI4 2
+ASGNI4
+ADDRLP4 5868
+INDIRI4
+ADDRLP4 5964
+INDIRI4
+GTI4 $4137
+ADDRLP4 5868
+INDIRI4
+ADDRLP4 5964
+INDIRI4
+LSHI4
+ADDRGP4 $4169+12
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4169
+address $4160
+address $4145
+address $4152
+address $4137
+address $4146
+address $4149
+code
+LABELV $4146
+ADDRLP4 5944
+INDIRI4
+CNSTI4 1
+EQI4 $4145
+ADDRGP4 $4137
+JUMPV
+LABELV $4149
+ADDRLP4 5944
+INDIRI4
+CNSTI4 2
+EQI4 $4145
+ADDRGP4 $4137
+JUMPV
+LABELV $4152
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $4153
+ADDRGP4 $4137
+JUMPV
+LABELV $4153
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 5968
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 5968
+INDIRI4
+CNSTI4 0
+EQI4 $4145
+ADDRLP4 5944
+INDIRI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+NEI4 $4145
+ADDRGP4 $4137
+JUMPV
+LABELV $4160
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $4161
+ADDRGP4 $4137
+JUMPV
+LABELV $4161
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 5972
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 5972
+INDIRI4
+CNSTI4 0
+EQI4 $4145
+ADDRLP4 5944
+INDIRI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $4145
+ADDRGP4 $4137
+JUMPV
+LABELV $4145
+LABELV $4142
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 4532
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+EQI4 $4172
+ADDRLP4 4600
+CNSTI1 92
+ASGNI1
+ADDRLP4 4600+1
+ARGP4
+ADDRLP4 4532
+INDIRP4
+ARGP4
+CNSTI4 1023
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $4173
+JUMPV
+LABELV $4172
+ADDRLP4 4600
+ARGP4
+ADDRLP4 4532
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $4173
+ADDRGP4 $4177
+ARGP4
+ADDRLP4 5952
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5624
+ARGP4
+ADDRGP4 $4177
+ARGP4
+ADDRLP4 5952
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 5956
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 5956
+INDIRI4
+CNSTI4 0
+NEI4 $4175
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 5960
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 5960
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 5964
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 5964
+INDIRI4
+CNSTI4 0
+NEI4 $4178
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4176
+JUMPV
+LABELV $4178
+ADDRLP4 5688
+ARGP4
+ADDRLP4 5968
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRLP4 5864
+ADDRLP4 5968
+INDIRI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2168
+ADDP4
+ARGP4
+ADDRLP4 5864
+INDIRI4
+ARGI4
+ADDRGP4 SC_ByteVecColorFromInt
+CALLV
+pop
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2168+3
+ADDP4
+CNSTU1 255
+ASGNU1
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2164
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4176
+JUMPV
+LABELV $4175
+ADDRGP4 $4191
+ARGP4
+ADDRLP4 5960
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5624
+ARGP4
+ADDRGP4 $4191
+ARGP4
+ADDRLP4 5960
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 5964
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 5964
+INDIRI4
+CNSTI4 0
+NEI4 $4189
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 5968
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 5968
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 5972
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 5972
+INDIRI4
+CNSTI4 0
+NEI4 $4192
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2172
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4190
+JUMPV
+LABELV $4192
+ADDRLP4 5688
+ARGP4
+ADDRLP4 5976
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRLP4 5864
+ADDRLP4 5976
+INDIRI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2176
+ADDP4
+ARGP4
+ADDRLP4 5864
+INDIRI4
+ARGI4
+ADDRGP4 SC_ByteVecColorFromInt
+CALLV
+pop
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2176+3
+ADDP4
+CNSTU1 255
+ASGNU1
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2172
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4190
+JUMPV
+LABELV $4189
+ADDRGP4 $4205
+ARGP4
+ADDRLP4 5968
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5624
+ARGP4
+ADDRGP4 $4205
+ARGP4
+ADDRLP4 5968
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 5972
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 5972
+INDIRI4
+CNSTI4 0
+NEI4 $4203
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 5976
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 5976
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 5980
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 5980
+INDIRI4
+CNSTI4 0
+NEI4 $4206
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4204
+JUMPV
+LABELV $4206
+ADDRLP4 5688
+ARGP4
+ADDRLP4 5984
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRLP4 5864
+ADDRLP4 5984
+INDIRI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2184
+ADDP4
+ARGP4
+ADDRLP4 5864
+INDIRI4
+ARGI4
+ADDRGP4 SC_ByteVecColorFromInt
+CALLV
+pop
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2184+3
+ADDP4
+CNSTU1 255
+ASGNU1
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2180
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4204
+JUMPV
+LABELV $4203
+ADDRGP4 $4219
+ARGP4
+ADDRLP4 5976
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5624
+ARGP4
+ADDRGP4 $4219
+ARGP4
+ADDRLP4 5976
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 5980
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 5980
+INDIRI4
+CNSTI4 0
+NEI4 $4217
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 5984
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 5984
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 5988
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 5988
+INDIRI4
+CNSTI4 0
+NEI4 $4220
+ADDRLP4 4
+INDIRP4
+CNSTI4 2188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4218
+JUMPV
+LABELV $4220
+ADDRLP4 4
+INDIRP4
+CNSTI4 2188
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 608
+ADDP4
+ARGP4
+ADDRLP4 5688
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $4218
+JUMPV
+LABELV $4217
+ADDRGP4 $4224
+ARGP4
+ADDRLP4 5984
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5624
+ARGP4
+ADDRGP4 $4224
+ARGP4
+ADDRLP4 5984
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 5988
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 5988
+INDIRI4
+CNSTI4 0
+NEI4 $4222
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 5992
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 5992
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 5996
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 5996
+INDIRI4
+CNSTI4 0
+NEI4 $4225
+ADDRLP4 4
+INDIRP4
+CNSTI4 2192
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4223
+JUMPV
+LABELV $4225
+ADDRLP4 4
+INDIRP4
+CNSTI4 2192
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 672
+ADDP4
+ARGP4
+ADDRLP4 5688
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $4223
+JUMPV
+LABELV $4222
+ADDRGP4 $4229
+ARGP4
+ADDRLP4 5992
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5624
+ARGP4
+ADDRGP4 $4229
+ARGP4
+ADDRLP4 5992
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 5996
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 5996
+INDIRI4
+CNSTI4 0
+NEI4 $4227
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6000
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6000
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6004
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6004
+INDIRI4
+CNSTI4 0
+NEI4 $4230
+ADDRLP4 4
+INDIRP4
+CNSTI4 2196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4228
+JUMPV
+LABELV $4230
+ADDRLP4 4
+INDIRP4
+CNSTI4 2196
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 736
+ADDP4
+ARGP4
+ADDRLP4 5688
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $4228
+JUMPV
+LABELV $4227
+ADDRGP4 $4234
+ARGP4
+ADDRLP4 6000
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5624
+ARGP4
+ADDRGP4 $4234
+ARGP4
+ADDRLP4 6000
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6004
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6004
+INDIRI4
+CNSTI4 0
+NEI4 $4232
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6008
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6008
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6012
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6012
+INDIRI4
+CNSTI4 0
+NEI4 $4235
+ADDRLP4 4
+INDIRP4
+CNSTI4 2200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4233
+JUMPV
+LABELV $4235
+ADDRLP4 4
+INDIRP4
+CNSTI4 2200
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 5688
+ARGP4
+ADDRLP4 6016
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2224
+ADDP4
+ADDRLP4 6016
+INDIRF4
+ASGNF4
+ADDRGP4 $4233
+JUMPV
+LABELV $4232
+ADDRGP4 $4239
+ARGP4
+ADDRLP4 6008
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5624
+ARGP4
+ADDRGP4 $4239
+ARGP4
+ADDRLP4 6008
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6012
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6012
+INDIRI4
+CNSTI4 0
+NEI4 $4237
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6016
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6016
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6020
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6020
+INDIRI4
+CNSTI4 0
+NEI4 $4240
+ADDRLP4 4
+INDIRP4
+CNSTI4 2204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4238
+JUMPV
+LABELV $4240
+ADDRLP4 4
+INDIRP4
+CNSTI4 2204
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 5688
+ARGP4
+ADDRLP4 6024
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2228
+ADDP4
+ADDRLP4 6024
+INDIRF4
+ASGNF4
+ADDRGP4 $4238
+JUMPV
+LABELV $4237
+ADDRGP4 $4244
+ARGP4
+ADDRLP4 6016
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5624
+ARGP4
+ADDRGP4 $4244
+ARGP4
+ADDRLP4 6016
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6020
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6020
+INDIRI4
+CNSTI4 0
+NEI4 $4242
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6024
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6024
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6028
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6028
+INDIRI4
+CNSTI4 0
+NEI4 $4245
+ADDRLP4 4
+INDIRP4
+CNSTI4 2208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4243
+JUMPV
+LABELV $4245
+ADDRLP4 4
+INDIRP4
+CNSTI4 2208
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 5688
+ARGP4
+ADDRLP4 6032
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2232
+ADDP4
+ADDRLP4 6032
+INDIRF4
+ASGNF4
+ADDRGP4 $4243
+JUMPV
+LABELV $4242
+ADDRGP4 $4249
+ARGP4
+ADDRLP4 6024
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5624
+ARGP4
+ADDRGP4 $4249
+ARGP4
+ADDRLP4 6024
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6028
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6028
+INDIRI4
+CNSTI4 0
+NEI4 $4247
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6032
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6032
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6036
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6036
+INDIRI4
+CNSTI4 0
+NEI4 $4250
+ADDRLP4 4
+INDIRP4
+CNSTI4 2212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4248
+JUMPV
+LABELV $4250
+ADDRLP4 4
+INDIRP4
+CNSTI4 2212
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 5688
+ARGP4
+ADDRLP4 6040
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2236
+ADDP4
+ADDRLP4 6040
+INDIRF4
+ASGNF4
+ADDRGP4 $4248
+JUMPV
+LABELV $4247
+ADDRGP4 $4254
+ARGP4
+ADDRLP4 6032
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5624
+ARGP4
+ADDRGP4 $4254
+ARGP4
+ADDRLP4 6032
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6036
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6036
+INDIRI4
+CNSTI4 0
+NEI4 $4252
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6040
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6044
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6044
+INDIRI4
+CNSTI4 0
+NEI4 $4255
+ADDRLP4 4
+INDIRP4
+CNSTI4 2216
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4253
+JUMPV
+LABELV $4255
+ADDRLP4 4
+INDIRP4
+CNSTI4 2216
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 5688
+ARGP4
+ADDRLP4 6048
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2240
+ADDP4
+ADDRLP4 6048
+INDIRF4
+ASGNF4
+ADDRGP4 $4253
+JUMPV
+LABELV $4252
+ADDRGP4 $4259
+ARGP4
+ADDRLP4 6040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5624
+ARGP4
+ADDRGP4 $4259
+ARGP4
+ADDRLP4 6040
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6044
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6044
+INDIRI4
+CNSTI4 0
+NEI4 $4257
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 6048
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 6052
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 6052
+INDIRI4
+CNSTI4 0
+NEI4 $4260
+ADDRLP4 4
+INDIRP4
+CNSTI4 2220
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4258
+JUMPV
+LABELV $4260
+ADDRLP4 4
+INDIRP4
+CNSTI4 2220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 5688
+ARGP4
+ADDRLP4 6056
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2244
+ADDP4
+ADDRLP4 6056
+INDIRF4
+ASGNF4
+ADDRGP4 $4258
+JUMPV
+LABELV $4257
+ADDRLP4 4600
+ARGP4
+ADDRLP4 5624
+ARGP4
+ADDRLP4 5688
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $4262
+ADDRLP4 4600
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRGP4 CG_ChangeConfigString
+CALLV
+pop
+ADDRGP4 $4263
+JUMPV
+LABELV $4262
+ADDRLP4 4600
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRGP4 CG_ChangeConfigString
+CALLV
+pop
+LABELV $4263
+LABELV $4258
+LABELV $4253
+LABELV $4248
+LABELV $4243
+LABELV $4238
+LABELV $4233
+LABELV $4228
+LABELV $4223
+LABELV $4218
+LABELV $4204
+LABELV $4190
+LABELV $4176
+ADDRLP4 6048
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 5816
+INDIRI4
+CNSTI4 2
+ADDI4
+ADDRLP4 6048
+INDIRI4
+LTI4 $4265
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2164
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4267
+ADDRLP4 5840
+CNSTI4 1
+ASGNI4
+ADDRLP4 5828
+ARGP4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2168
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $4268
+JUMPV
+LABELV $4267
+ADDRLP4 5840
+CNSTI4 0
+ASGNI4
+LABELV $4268
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2172
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4273
+ADDRLP4 5844
+CNSTI4 1
+ASGNI4
+ADDRLP4 5832
+ARGP4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2176
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $4274
+JUMPV
+LABELV $4273
+ADDRLP4 5844
+CNSTI4 0
+ASGNI4
+LABELV $4274
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2180
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4279
+ADDRLP4 5848
+CNSTI4 1
+ASGNI4
+ADDRLP4 5836
+ARGP4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2184
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $4280
+JUMPV
+LABELV $4279
+ADDRLP4 5848
+CNSTI4 0
+ASGNI4
+LABELV $4280
+ADDRLP4 4
+INDIRP4
+CNSTI4 2188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4285
+ADDRLP4 5852
+CNSTI4 1
+ASGNI4
+ADDRGP4 HeadSkinName
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 608
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $4286
+JUMPV
+LABELV $4285
+ADDRLP4 5852
+CNSTI4 0
+ASGNI4
+LABELV $4286
+ADDRLP4 4
+INDIRP4
+CNSTI4 2192
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4287
+ADDRLP4 5856
+CNSTI4 1
+ASGNI4
+ADDRGP4 TorsoSkinName
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 672
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $4288
+JUMPV
+LABELV $4287
+ADDRLP4 5856
+CNSTI4 0
+ASGNI4
+LABELV $4288
+ADDRLP4 4
+INDIRP4
+CNSTI4 2196
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4289
+ADDRLP4 5860
+CNSTI4 1
+ASGNI4
+ADDRGP4 LegsSkinName
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 736
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $4290
+JUMPV
+LABELV $4289
+ADDRLP4 5860
+CNSTI4 0
+ASGNI4
+LABELV $4290
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2160
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 5840
+INDIRI4
+CNSTI4 0
+EQI4 $4295
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2168
+ADDP4
+ARGP4
+ADDRLP4 5828
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2168+3
+ADDP4
+CNSTU1 255
+ASGNU1
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2164
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $4295
+ADDRLP4 5844
+INDIRI4
+CNSTI4 0
+EQI4 $4304
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2176
+ADDP4
+ARGP4
+ADDRLP4 5832
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2176+3
+ADDP4
+CNSTU1 255
+ASGNU1
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2172
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $4304
+ADDRLP4 5848
+INDIRI4
+CNSTI4 0
+EQI4 $4313
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2184
+ADDP4
+ARGP4
+ADDRLP4 5836
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2184+3
+ADDP4
+CNSTU1 255
+ASGNU1
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2180
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $4313
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+ADDRLP4 5852
+INDIRI4
+CNSTI4 0
+EQI4 $4323
+ADDRGP4 HeadSkinName
+ARGP4
+ADDRLP4 4536
+ARGP4
+ADDRLP4 5752
+ARGP4
+ADDRGP4 CG_GetModelAndSkinName
+CALLV
+pop
+ADDRLP4 4536
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4325
+ADDRLP4 4536
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $4325
+ADDRGP4 $4327
+ARGP4
+ADDRLP4 4536
+ARGP4
+ADDRLP4 5752
+ARGP4
+ADDRLP4 6056
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 6056
+INDIRP4
+ARGP4
+ADDRLP4 6060
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRLP4 6060
+INDIRI4
+ASGNI4
+LABELV $4323
+ADDRLP4 5856
+INDIRI4
+CNSTI4 0
+EQI4 $4328
+ADDRGP4 TorsoSkinName
+ARGP4
+ADDRLP4 4536
+ARGP4
+ADDRLP4 5752
+ARGP4
+ADDRGP4 CG_GetModelAndSkinName
+CALLV
+pop
+ADDRLP4 4536
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4330
+ADDRLP4 4536
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $4330
+ADDRGP4 $4332
+ARGP4
+ADDRLP4 4536
+ARGP4
+ADDRLP4 5752
+ARGP4
+ADDRLP4 6056
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 6056
+INDIRP4
+ARGP4
+ADDRLP4 6060
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 924
+ADDP4
+ADDRLP4 6060
+INDIRI4
+ASGNI4
+LABELV $4328
+ADDRLP4 5860
+INDIRI4
+CNSTI4 0
+EQI4 $4333
+ADDRGP4 LegsSkinName
+ARGP4
+ADDRLP4 4536
+ARGP4
+ADDRLP4 5752
+ARGP4
+ADDRGP4 CG_GetModelAndSkinName
+CALLV
+pop
+ADDRLP4 4536
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4335
+ADDRLP4 4536
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $4335
+ADDRGP4 $4337
+ARGP4
+ADDRLP4 4536
+ARGP4
+ADDRLP4 5752
+ARGP4
+ADDRLP4 6056
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 6056
+INDIRP4
+ARGP4
+ADDRLP4 6060
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 904
+ADDP4
+ADDRLP4 6060
+INDIRI4
+ASGNI4
+LABELV $4333
+ADDRLP4 4
+INDIRP4
+CNSTI4 2200
+ADDP4
+ADDRLP4 8+2200
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2204
+ADDP4
+ADDRLP4 8+2204
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2208
+ADDP4
+ADDRLP4 8+2208
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2212
+ADDP4
+ADDRLP4 8+2212
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2216
+ADDP4
+ADDRLP4 8+2216
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2220
+ADDP4
+ADDRLP4 8+2220
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2224
+ADDP4
+ADDRLP4 8+2224
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2228
+ADDP4
+ADDRLP4 8+2228
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2232
+ADDP4
+ADDRLP4 8+2232
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2236
+ADDP4
+ADDRLP4 8+2236
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2240
+ADDP4
+ADDRLP4 8+2240
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2244
+ADDP4
+ADDRLP4 8+2244
+INDIRF4
+ASGNF4
+LABELV $4265
+LABELV $4137
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4139
+ADDRLP4 0
+INDIRI4
+ADDRLP4 5824
+INDIRI4
+LTI4 $4136
+LABELV $4131
+ADDRLP4 5816
+ADDRLP4 5816
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $4133
+ADDRLP4 5936
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 5816
+INDIRI4
+ADDRLP4 5936
+INDIRI4
+LTI4 $4130
+LABELV $4034
+endproc CG_ClientOverride_f 6064 12
+proc CG_TestMenu_f 12 4
+ADDRLP4 0
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $4351
+ADDRGP4 cg+3196928
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4350
+ADDRGP4 cg+3196928
+CNSTP4 0
+ASGNP4
+ADDRGP4 $4350
+JUMPV
+LABELV $4351
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+3196928
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $4350
+endproc CG_TestMenu_f 12 4
+proc CG_PrintPlayerState_f 0 0
+ADDRGP4 CG_PrintPlayerState
+CALLV
+pop
+LABELV $4358
+endproc CG_PrintPlayerState_f 0 0
+proc CG_ClearScene_f 0 0
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+LABELV $4359
+endproc CG_ClearScene_f 0 0
+proc CG_InfoDown_f 0 0
+ADDRGP4 cg+3874636
+CNSTI4 1
+ASGNI4
+LABELV $4360
+endproc CG_InfoDown_f 0 0
+proc CG_InfoUp_f 0 0
+ADDRGP4 cg+3874636
+CNSTI4 0
+ASGNI4
+LABELV $4362
+endproc CG_InfoUp_f 0 0
+proc CG_AddAtFtimeCommand 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4365
+ADDRLP4 8
+CNSTI4 1036
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+5451400
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4370
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4367
+JUMPV
+LABELV $4370
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+LEF4 $4372
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4367
+JUMPV
+LABELV $4372
+LABELV $4366
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $4365
+LABELV $4367
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $4374
+ADDRGP4 $4376
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4364
+JUMPV
+LABELV $4374
+ADDRLP4 4
+CNSTI4 126
+ASGNI4
+ADDRGP4 $4380
+JUMPV
+LABELV $4377
+ADDRLP4 16
+CNSTI4 1036
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+5451400+1036
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+5451400
+ADDP4
+INDIRB
+ASGNB 1036
+LABELV $4378
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $4380
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GEI4 $4377
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1032
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ArgsFrom
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $4364
+endproc CG_AddAtFtimeCommand 20 12
+proc CG_AddAtCommand_f 1044 12
+ADDRLP4 1028
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+GEI4 $4385
+ADDRGP4 $4387
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4388
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4389
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4390
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4391
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4384
+JUMPV
+LABELV $4385
+CNSTI4 1
+ARGI4
+ADDRLP4 1032
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $4394
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $4392
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4395
+ADDRGP4 $4398
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4384
+JUMPV
+LABELV $4395
+ADDRLP4 1024
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRGP4 $4393
+JUMPV
+LABELV $4392
+ADDRGP4 cg_levelTimerDirection+12
+INDIRI4
+CNSTI4 0
+EQI4 $4400
+ADDRGP4 cg_levelTimerDirection+12
+INDIRI4
+CNSTI4 2
+EQI4 $4400
+ADDRGP4 $4404
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4400
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 CG_GetServerTimeFromClockString
+CALLF4
+ASGNF4
+ADDRLP4 1024
+ADDRLP4 1040
+INDIRF4
+ASGNF4
+ADDRLP4 1024
+INDIRF4
+CNSTF4 0
+GEF4 $4405
+ADDRGP4 $4407
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4384
+JUMPV
+LABELV $4405
+LABELV $4393
+ADDRLP4 1024
+INDIRF4
+ARGF4
+ADDRGP4 CG_AddAtFtimeCommand
+CALLV
+pop
+LABELV $4384
+endproc CG_AddAtCommand_f 1044 12
+proc CG_ListAtCommands_f 12 20
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4409
+ADDRLP4 4
+CNSTI4 1036
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+5451400
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4414
+ADDRGP4 $4411
+JUMPV
+LABELV $4414
+ADDRGP4 $4416
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 $4417
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4410
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $4409
+LABELV $4411
+LABELV $4408
+endproc CG_ListAtCommands_f 12 20
+proc CG_ClearAtCommands_f 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4419
+CNSTI4 1036
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+5451400
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4420
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $4419
+LABELV $4418
+endproc CG_ClearAtCommands_f 4 0
+proc CG_RemoveAtCommand_f 28 8
+ADDRLP4 8
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+GEI4 $4425
+ADDRGP4 $4427
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4424
+JUMPV
+LABELV $4425
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4430
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+LTI4 $4428
+LABELV $4430
+ADDRGP4 $4431
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4424
+JUMPV
+LABELV $4428
+CNSTI4 1036
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+5451400
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4432
+ADDRGP4 $4435
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4424
+JUMPV
+LABELV $4432
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $4439
+JUMPV
+LABELV $4436
+ADDRLP4 24
+CNSTI4 1036
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+5451400
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+5451400+1036
+ADDP4
+INDIRB
+ASGNB 1036
+LABELV $4437
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4439
+ADDRLP4 0
+INDIRI4
+CNSTI4 127
+LTI4 $4436
+LABELV $4424
+endproc CG_RemoveAtCommand_f 28 8
+proc CG_SaveAtCommands_f 32 12
+ADDRGP4 cg+5451400
+INDIRI4
+CNSTI4 0
+NEI4 $4444
+ADDRGP4 $4443
+JUMPV
+LABELV $4444
+ADDRLP4 16
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+GEI4 $4447
+ADDRGP4 $4449
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $4448
+JUMPV
+LABELV $4447
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $4448
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $4450
+ADDRGP4 $4452
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4443
+JUMPV
+LABELV $4450
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $4453
+ADDRLP4 0
+CNSTI4 1036
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+5451400
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4458
+ADDRGP4 $4455
+JUMPV
+LABELV $4458
+ADDRGP4 $4460
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $4454
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+LTI4 $4453
+LABELV $4455
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $4443
+endproc CG_SaveAtCommands_f 32 12
+proc CG_ExecAtTime_f 1044 20
+ADDRLP4 1028
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+GEI4 $4462
+ADDRGP4 $4464
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4461
+JUMPV
+LABELV $4462
+CNSTI4 1
+ARGI4
+ADDRLP4 1032
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 1040
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $4465
+ARGP4
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $4461
+endproc CG_ExecAtTime_f 1044 20
+proc CG_EntityFilter_f 152 12
+ADDRLP4 8
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+GEI4 $4467
+ADDRGP4 $4469
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4466
+JUMPV
+LABELV $4467
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 16
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $4470
+ADDRGP4 cg+3874800
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+3878896
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $4466
+JUMPV
+LABELV $4470
+ADDRGP4 $1653
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $1653
+ARGP4
+ADDRLP4 24
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $4476
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4478
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3874800
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $4479
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4478
+ADDRGP4 $4477
+JUMPV
+LABELV $4476
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_isAnInteger
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $4483
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4487
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4485
+LABELV $4487
+ADDRGP4 $4488
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4466
+JUMPV
+LABELV $4485
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+3874800
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4492
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4493
+JUMPV
+LABELV $4492
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $4493
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+3874800
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $4484
+JUMPV
+LABELV $4483
+ADDRGP4 $798
+ARGP4
+ADDRLP4 36
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $798
+ARGP4
+ADDRLP4 36
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 40
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $4494
+ADDRGP4 cg+3878896
+INDIRI4
+CNSTI4 0
+NEI4 $4499
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4500
+JUMPV
+LABELV $4499
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $4500
+ADDRGP4 cg+3878896
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $4495
+JUMPV
+LABELV $4494
+ADDRGP4 $799
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $799
+ARGP4
+ADDRLP4 44
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 48
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $4501
+ADDRGP4 cg+3878896+4
+INDIRI4
+CNSTI4 0
+NEI4 $4508
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4509
+JUMPV
+LABELV $4508
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+LABELV $4509
+ADDRGP4 cg+3878896+4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $4502
+JUMPV
+LABELV $4501
+ADDRGP4 $800
+ARGP4
+ADDRLP4 52
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $800
+ARGP4
+ADDRLP4 52
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 56
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $4510
+ADDRGP4 cg+3878896+8
+INDIRI4
+CNSTI4 0
+NEI4 $4517
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4518
+JUMPV
+LABELV $4517
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $4518
+ADDRGP4 cg+3878896+8
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $4511
+JUMPV
+LABELV $4510
+ADDRGP4 $801
+ARGP4
+ADDRLP4 60
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $801
+ARGP4
+ADDRLP4 60
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 64
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $4519
+ADDRGP4 cg+3878896+12
+INDIRI4
+CNSTI4 0
+NEI4 $4526
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4527
+JUMPV
+LABELV $4526
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $4527
+ADDRGP4 cg+3878896+12
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $4520
+JUMPV
+LABELV $4519
+ADDRGP4 $802
+ARGP4
+ADDRLP4 68
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $802
+ARGP4
+ADDRLP4 68
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 72
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $4528
+ADDRGP4 cg+3878896+16
+INDIRI4
+CNSTI4 0
+NEI4 $4535
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4536
+JUMPV
+LABELV $4535
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+LABELV $4536
+ADDRGP4 cg+3878896+16
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $4529
+JUMPV
+LABELV $4528
+ADDRGP4 $803
+ARGP4
+ADDRLP4 76
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $803
+ARGP4
+ADDRLP4 76
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 80
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $4537
+ADDRGP4 cg+3878896+20
+INDIRI4
+CNSTI4 0
+NEI4 $4544
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4545
+JUMPV
+LABELV $4544
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+LABELV $4545
+ADDRGP4 cg+3878896+20
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 $4538
+JUMPV
+LABELV $4537
+ADDRGP4 $804
+ARGP4
+ADDRLP4 84
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $804
+ARGP4
+ADDRLP4 84
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 88
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $4546
+ADDRGP4 cg+3878896+24
+INDIRI4
+CNSTI4 0
+NEI4 $4553
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4554
+JUMPV
+LABELV $4553
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $4554
+ADDRGP4 cg+3878896+24
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $4547
+JUMPV
+LABELV $4546
+ADDRGP4 $805
+ARGP4
+ADDRLP4 92
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $805
+ARGP4
+ADDRLP4 92
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 96
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $4555
+ADDRGP4 cg+3878896+28
+INDIRI4
+CNSTI4 0
+NEI4 $4562
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4563
+JUMPV
+LABELV $4562
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+LABELV $4563
+ADDRGP4 cg+3878896+28
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 $4556
+JUMPV
+LABELV $4555
+ADDRGP4 $4566
+ARGP4
+ADDRLP4 100
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $4566
+ARGP4
+ADDRLP4 100
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 104
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $4564
+ADDRGP4 cg+3878896+32
+INDIRI4
+CNSTI4 0
+NEI4 $4572
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4573
+JUMPV
+LABELV $4572
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+LABELV $4573
+ADDRGP4 cg+3878896+32
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 $4565
+JUMPV
+LABELV $4564
+ADDRGP4 $4576
+ARGP4
+ADDRLP4 108
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $4576
+ARGP4
+ADDRLP4 108
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 112
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $4574
+ADDRGP4 cg+3878896+36
+INDIRI4
+CNSTI4 0
+NEI4 $4582
+ADDRLP4 116
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4583
+JUMPV
+LABELV $4582
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+LABELV $4583
+ADDRGP4 cg+3878896+36
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRGP4 $4575
+JUMPV
+LABELV $4574
+ADDRGP4 $808
+ARGP4
+ADDRLP4 116
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $808
+ARGP4
+ADDRLP4 116
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 120
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $4584
+ADDRGP4 cg+3878896+40
+INDIRI4
+CNSTI4 0
+NEI4 $4591
+ADDRLP4 124
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4592
+JUMPV
+LABELV $4591
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+LABELV $4592
+ADDRGP4 cg+3878896+40
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRGP4 $4585
+JUMPV
+LABELV $4584
+ADDRGP4 $809
+ARGP4
+ADDRLP4 124
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $809
+ARGP4
+ADDRLP4 124
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 128
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $4593
+ADDRGP4 cg+3878896+44
+INDIRI4
+CNSTI4 0
+NEI4 $4600
+ADDRLP4 132
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4601
+JUMPV
+LABELV $4600
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $4601
+ADDRGP4 cg+3878896+44
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $4594
+JUMPV
+LABELV $4593
+ADDRGP4 $810
+ARGP4
+ADDRLP4 132
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $810
+ARGP4
+ADDRLP4 132
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 136
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $4602
+ADDRGP4 cg+3878896+48
+INDIRI4
+CNSTI4 0
+NEI4 $4609
+ADDRLP4 140
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4610
+JUMPV
+LABELV $4609
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $4610
+ADDRGP4 cg+3878896+48
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $4603
+JUMPV
+LABELV $4602
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 140
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 140
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 144
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $4611
+ADDRGP4 cg+3878896+52
+INDIRI4
+CNSTI4 0
+NEI4 $4619
+ADDRLP4 148
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4620
+JUMPV
+LABELV $4619
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+LABELV $4620
+ADDRGP4 cg+3878896+52
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $4611
+LABELV $4603
+LABELV $4594
+LABELV $4585
+LABELV $4575
+LABELV $4565
+LABELV $4556
+LABELV $4547
+LABELV $4538
+LABELV $4529
+LABELV $4520
+LABELV $4511
+LABELV $4502
+LABELV $4495
+LABELV $4484
+LABELV $4477
+LABELV $4466
+endproc CG_EntityFilter_f 152 12
+proc CG_ListEntityFilter_f 12 8
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $4622
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3874800
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4626
+ADDRGP4 $4629
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4626
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+LTI4 $4630
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $4630
+LABELV $4623
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4622
+ADDRGP4 $4632
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+3878896
+INDIRI4
+CNSTI4 0
+EQI4 $4633
+ADDRGP4 $4636
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4633
+ADDRGP4 cg+3878896+4
+INDIRI4
+CNSTI4 0
+EQI4 $4637
+ADDRGP4 $4641
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4637
+ADDRGP4 cg+3878896+8
+INDIRI4
+CNSTI4 0
+EQI4 $4642
+ADDRGP4 $4646
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4642
+ADDRGP4 cg+3878896+12
+INDIRI4
+CNSTI4 0
+EQI4 $4647
+ADDRGP4 $4651
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4647
+ADDRGP4 cg+3878896+16
+INDIRI4
+CNSTI4 0
+EQI4 $4652
+ADDRGP4 $4656
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4652
+ADDRGP4 cg+3878896+20
+INDIRI4
+CNSTI4 0
+EQI4 $4657
+ADDRGP4 $4661
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4657
+ADDRGP4 cg+3878896+24
+INDIRI4
+CNSTI4 0
+EQI4 $4662
+ADDRGP4 $4666
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4662
+ADDRGP4 cg+3878896+28
+INDIRI4
+CNSTI4 0
+EQI4 $4667
+ADDRGP4 $4671
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4667
+ADDRGP4 cg+3878896+32
+INDIRI4
+CNSTI4 0
+EQI4 $4672
+ADDRGP4 $4676
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4672
+ADDRGP4 cg+3878896+36
+INDIRI4
+CNSTI4 0
+EQI4 $4677
+ADDRGP4 $4681
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4677
+ADDRGP4 cg+3878896+40
+INDIRI4
+CNSTI4 0
+EQI4 $4682
+ADDRGP4 $4686
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4682
+ADDRGP4 cg+3878896+44
+INDIRI4
+CNSTI4 0
+EQI4 $4687
+ADDRGP4 $4691
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4687
+ADDRGP4 cg+3878896+48
+INDIRI4
+CNSTI4 0
+EQI4 $4692
+ADDRGP4 $4696
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4692
+ADDRGP4 cg+3878896+52
+INDIRI4
+CNSTI4 0
+EQI4 $4697
+ADDRGP4 $4701
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4697
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4621
+endproc CG_ListEntityFilter_f 12 8
+proc CG_EntityFreeze_f 60 12
+ADDRLP4 8
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+GEI4 $4703
+ADDRGP4 $4705
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4702
+JUMPV
+LABELV $4703
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4706
+ADDRGP4 $4702
+JUMPV
+LABELV $4706
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 16
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $4709
+ADDRGP4 cg+3878952
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $4702
+JUMPV
+LABELV $4709
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_isAnInteger
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $4713
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $4717
+ADDRLP4 32
+INDIRI4
+CNSTI4 1024
+LTI4 $4715
+LABELV $4717
+ADDRGP4 $4488
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4702
+JUMPV
+LABELV $4715
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4721
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4722
+JUMPV
+LABELV $4721
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $4722
+ADDRLP4 40
+INDIRI4
+ADDRGP4 cg+3878952
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4723
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $4726
+ADDRLP4 44
+ADDRGP4 cg+607704
+ASGNP4
+ADDRGP4 cg+5414952
+ADDRGP4 cg+607196
+INDIRB
+ASGNB 508
+ADDRGP4 cg+5415460
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+5415464
+ADDRGP4 cg+627496
+INDIRF4
+ASGNF4
+ADDRGP4 cg+5415468
+ADDRGP4 cg+609304
+INDIRF4
+ASGNF4
+ADDRGP4 cg+5415472
+ADDRGP4 cg+609308
+INDIRI4
+ASGNI4
+ADDRGP4 $4727
+JUMPV
+LABELV $4726
+ADDRLP4 44
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+LABELV $4727
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+632
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 wclients+636
+ADDP4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 wclients+608
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 wclients+640
+ADDP4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 wclients+48
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 56
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 wclients+644
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 wclients+52
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+3883048
+ADDP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $4723
+LABELV $4713
+LABELV $4702
+endproc CG_EntityFreeze_f 60 12
+proc CG_ListEntityFreeze_f 12 8
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $4751
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3874800
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4755
+ADDRGP4 $4629
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4755
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+LTI4 $4758
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $4758
+LABELV $4752
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4751
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4750
+endproc CG_ListEntityFreeze_f 12 8
+proc CG_PrintJumps_f 16 8
+ADDRGP4 cg+5417524
+INDIRI4
+CNSTI4 0
+NEI4 $4761
+ADDRGP4 $4760
+JUMPV
+LABELV $4761
+ADDRLP4 8
+ADDRGP4 cg+5417524
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 256
+LTI4 $4765
+ADDRLP4 8
+CNSTI4 255
+ASGNI4
+LABELV $4765
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4767
+ADDRGP4 $4629
+ARGP4
+ADDRGP4 cg+5417524
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 256
+MODI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+5415476
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $4773
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $4773
+LABELV $4768
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4770
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $4767
+ADDRGP4 $4775
+ARGP4
+ADDRGP4 cg+5417524
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+5415476-8+4
+ADDP4
+INDIRI4
+ADDRGP4 cg+5415476+4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4760
+endproc CG_PrintJumps_f 16 8
+proc CG_ClearJumps_f 0 0
+ADDRGP4 cg+5417524
+CNSTI4 0
+ASGNI4
+LABELV $4782
+endproc CG_ClearJumps_f 0 0
+proc CG_MouseSeekDown_f 0 0
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4785
+ADDRGP4 $4784
+JUMPV
+LABELV $4785
+ADDRGP4 cg+5417588
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+1332164
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332168
+CNSTI4 0
+ASGNI4
+LABELV $4784
+endproc CG_MouseSeekDown_f 0 0
+proc CG_MouseSeekUp_f 0 0
+ADDRGP4 cg+5417588
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+5417592
+CNSTI4 0
+ASGNI4
+LABELV $4791
+endproc CG_MouseSeekUp_f 0 0
+proc CG_PrintLegsInfo 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4795
+ADDRGP4 $4794
+JUMPV
+LABELV $4795
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4800
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4798
+LABELV $4800
+ADDRGP4 $4794
+JUMPV
+LABELV $4798
+ADDRLP4 0
+CNSTI4 1496
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900
+ADDP4
+ASGNP4
+ADDRGP4 $4802
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4804
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4805
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4806
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4807
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4808
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4809
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4810
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4811
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4812
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4813
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4814
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4815
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4816
+ADDRGP4 $4818
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4816
+LABELV $4794
+endproc CG_PrintLegsInfo 8 8
+proc CG_PrintLegsInfo_f 20 4
+ADDRLP4 4
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+GEI4 $4820
+ADDRGP4 $4822
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4819
+JUMPV
+LABELV $4820
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4825
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4823
+LABELV $4825
+ADDRGP4 $4826
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4819
+JUMPV
+LABELV $4823
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_PrintLegsInfo
+CALLV
+pop
+LABELV $4819
+endproc CG_PrintLegsInfo_f 20 4
+proc CG_ChatDown_f 0 0
+ADDRGP4 cg+5417596
+CNSTI4 1
+ASGNI4
+LABELV $4827
+endproc CG_ChatDown_f 0 0
+proc CG_ChatUp_f 0 0
+ADDRGP4 cg+5417596
+CNSTI4 0
+ASGNI4
+LABELV $4829
+endproc CG_ChatUp_f 0 0
+proc CG_AddChatLine_f 4 4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_ArgsFrom
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddChatLine
+CALLV
+pop
+LABELV $4831
+endproc CG_AddChatLine_f 4 4
+proc CG_CvarInterp_f 56 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+GEI4 $4833
+ADDRGP4 $4835
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4836
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4837
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4832
+JUMPV
+LABELV $4833
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4838
+ADDRLP4 4
+CNSTI4 1048
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+5417864
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4843
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4840
+JUMPV
+LABELV $4843
+LABELV $4839
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $4838
+LABELV $4840
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $4845
+ADDRGP4 $4847
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4832
+JUMPV
+LABELV $4845
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+LEI4 $4848
+CNSTI4 5
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1740
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $4851
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4852
+JUMPV
+LABELV $4851
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $4852
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $4848
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4853
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRGP4 $4854
+JUMPV
+LABELV $4853
+ADDRLP4 24
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $4854
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1148846080
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4832
+endproc CG_CvarInterp_f 56 12
+proc CG_ClearCvarInterp_f 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4857
+CNSTI4 1048
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+5417864
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4858
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $4857
+LABELV $4856
+endproc CG_ClearCvarInterp_f 4 0
+proc CG_ChangeConfigString_f 56 12
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+GEI4 $4863
+ADDRGP4 $4865
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4866
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4867
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4868
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4869
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4870
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4871
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4862
+JUMPV
+LABELV $4863
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $4874
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $4872
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $4873
+JUMPV
+LABELV $4872
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $4875
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1653
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $4877
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4879
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+5649552
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4880
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4879
+ADDRGP4 $4862
+JUMPV
+LABELV $4877
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4884
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+5649552
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4862
+JUMPV
+LABELV $4884
+ADDRGP4 $4887
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4862
+JUMPV
+LABELV $4875
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $4890
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $4888
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4891
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+5649552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4895
+ADDRGP4 $4898
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cg+5653648
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4895
+LABELV $4892
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4891
+ADDRGP4 $4862
+JUMPV
+LABELV $4888
+LABELV $4873
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4902
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LEI4 $4900
+LABELV $4902
+ADDRGP4 $4903
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4862
+JUMPV
+LABELV $4900
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_ArgsFrom
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $4904
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+5649552
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cg+5653648
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $4904
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ChangeConfigString
+CALLV
+pop
+LABELV $4862
+endproc CG_ChangeConfigString_f 56 12
+proc CG_ConfigStrings_f 24 12
+ADDRLP4 8
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LEI4 $4910
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 $4898
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4909
+JUMPV
+LABELV $4910
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4912
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4916
+ADDRGP4 $4913
+JUMPV
+LABELV $4916
+ADDRGP4 $4898
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4913
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4912
+LABELV $4909
+endproc CG_ConfigStrings_f 24 12
+proc CG_Gfov_f 8 12
+ADDRLP4 0
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+GEI4 $4919
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $4921
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $4921
+ADDRLP4 4
+ADDRGP4 cg+6747460
+INDIRI4
+ASGNI4
+ADDRGP4 $4922
+JUMPV
+LABELV $4921
+ADDRLP4 4
+ADDRGP4 cg_fov+12
+INDIRI4
+ASGNI4
+LABELV $4922
+ADDRGP4 $4927
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 110
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4918
+JUMPV
+LABELV $4919
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $4928
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $4918
+endproc CG_Gfov_f 8 12
+proc CG_DemoScale_f 8 8
+ADDRLP4 0
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+GEI4 $4930
+ADDRGP4 $4929
+JUMPV
+LABELV $4930
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1195
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $4929
+endproc CG_DemoScale_f 8 8
+proc CG_FreecamLookAtPlayer_f 24 8
+ADDRLP4 4
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+GEI4 $4933
+ADDRGP4 cg+1335044
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4932
+JUMPV
+LABELV $4933
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4938
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $4936
+LABELV $4938
+ADDRGP4 $4129
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4932
+JUMPV
+LABELV $4936
+ADDRGP4 $4939
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $4932
+endproc CG_FreecamLookAtPlayer_f 24 8
+proc CG_RemapShader_f 284 20
+ADDRLP4 264
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 3
+GEI4 $4941
+ADDRGP4 $4943
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4940
+JUMPV
+LABELV $4941
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $4944
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRLP4 4-64
+ADDP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $4945
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $4944
+ADDRLP4 268
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 3
+LEI4 $4950
+CNSTI4 3
+ARGI4
+ADDRLP4 272
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4+128
+ARGP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $4950
+ADDRLP4 272
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 4
+LEI4 $4954
+CNSTI4 4
+ARGI4
+ADDRLP4 276
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $4955
+JUMPV
+LABELV $4954
+ADDRLP4 260
+CNSTI4 1
+ASGNI4
+LABELV $4955
+ADDRLP4 4
+ARGP4
+ADDRLP4 4+64
+ARGP4
+ADDRLP4 4+128
+ARGP4
+ADDRLP4 260
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+LABELV $4940
+endproc CG_RemapShader_f 284 20
+proc CG_ClearRemappedShader_f 72 12
+ADDRLP4 64
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+GEI4 $4959
+ADDRGP4 $4961
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4958
+JUMPV
+LABELV $4959
+CNSTI4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_ClearRemappedShader
+CALLV
+pop
+LABELV $4958
+endproc CG_ClearRemappedShader_f 72 12
+proc CG_Move_f 112 16
+ADDRLP4 48
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+GEI4 $4963
+ADDRGP4 $4965
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4962
+JUMPV
+LABELV $4963
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 56
+INDIRF4
+ASGNF4
+CNSTI4 2
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 64
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332136
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 cg+1332124
+ADDRGP4 cg+1332124
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+4
+ADDRGP4 cg+1332124+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+8
+ADDRGP4 cg+1332124+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124
+ADDRGP4 cg+1332124
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+4
+ADDRGP4 cg+1332124+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+8
+ADDRGP4 cg+1332124+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124
+ADDRGP4 cg+1332124
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+4
+ADDRGP4 cg+1332124+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332124+8
+ADDRGP4 cg+1332124+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 84
+ADDRGP4 cg+1332136
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 5
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 cg+1332136+4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 6
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRGP4 cg+1332136+8
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332220
+CNSTI4 0
+ASGNI4
+LABELV $4962
+endproc CG_Move_f 112 16
+proc CG_MoveOffset_f 64 4
+ADDRLP4 0
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+GEI4 $5010
+ADDRGP4 $5012
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5009
+JUMPV
+LABELV $5010
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332124
+ADDRLP4 8
+INDIRF4
+ASGNF4
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332124+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+1332124+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg+1332136
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cg+1332136+4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 6
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 cg+1332136+8
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332220
+CNSTI4 0
+ASGNI4
+LABELV $5009
+endproc CG_MoveOffset_f 64 4
+proc CG_AddMirrorSurface_f 44 8
+ADDRLP4 12
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+GEI4 $5025
+ADDRGP4 $5027
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5024
+JUMPV
+LABELV $5025
+ADDRGP4 cg+699348
+INDIRI4
+CNSTI4 1024
+LTI4 $5028
+ADDRGP4 $5031
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5024
+JUMPV
+LABELV $5028
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+CNSTI4 2
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+CNSTI4 12
+ADDRGP4 cg+699348
+INDIRI4
+MULI4
+ADDRGP4 cg+699352
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ADDRGP4 cg+699348
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5024
+endproc CG_AddMirrorSurface_f 44 8
+proc CG_DumpEnts_f 52 12
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+6702236
+INDIRI4
+CNSTI4 0
+EQI4 $5038
+ADDRGP4 cg+6706344
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 cg+6706344
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6706340
+CNSTI4 0
+ASGNI4
+LABELV $5038
+ADDRGP4 cg+6702236
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+LEI4 $5045
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5050
+JUMPV
+LABELV $5047
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $5051
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5046
+JUMPV
+LABELV $5051
+LABELV $5048
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5050
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 32
+INDIRU4
+LTU4 $5047
+ADDRGP4 $5046
+JUMPV
+LABELV $5045
+ADDRLP4 12
+ADDRGP4 $5053
+ASGNP4
+LABELV $5046
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $5054
+ADDRGP4 $5056
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 cg+6706344
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $5055
+JUMPV
+LABELV $5054
+ADDRGP4 $5058
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 cg+6706344
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $5055
+ADDRGP4 cg+6706344
+INDIRI4
+CNSTI4 0
+NEI4 $5060
+ADDRGP4 $1190
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5037
+JUMPV
+LABELV $5060
+ADDRGP4 cg+6702236
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+6702240
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6702244
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 28
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LEI4 $5067
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $5070
+JUMPV
+LABELV $5069
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $5074
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $5072
+ADDRGP4 cg+6702240
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5073
+JUMPV
+LABELV $5072
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1653
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $5076
+ADDRGP4 cg+6702240
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $5079
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6702244
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $5080
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $5079
+ADDRGP4 $5077
+JUMPV
+LABELV $5076
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $5084
+ADDRLP4 20
+INDIRI4
+CNSTI4 1024
+GEI4 $5084
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6702244
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $5084
+LABELV $5077
+LABELV $5073
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5070
+ADDRLP4 32
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $5069
+ADDRGP4 $5068
+JUMPV
+LABELV $5067
+ADDRGP4 cg+6702240
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $5088
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6702244
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $5089
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $5088
+LABELV $5068
+ADDRGP4 $5093
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5037
+endproc CG_DumpEnts_f 52 12
+proc CG_StopDumpEnts_f 0 4
+ADDRGP4 cg+6702236
+INDIRI4
+CNSTI4 0
+NEI4 $5095
+ADDRGP4 $5094
+JUMPV
+LABELV $5095
+ADDRGP4 cg+6706344
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 cg+6706344
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6702236
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6702240
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6706340
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5103
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5094
+endproc CG_StopDumpEnts_f 0 4
+proc CG_RunFx 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRGP4 ScriptVars+84
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 ScriptVars+60
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7788
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7772
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7784
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+316
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+316+4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+316+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+316+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5125
+JUMPV
+LABELV $5122
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 EffectScripts+8290668
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $5127
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 EffectScripts+8307052
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $5104
+JUMPV
+LABELV $5127
+LABELV $5123
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5125
+ADDRLP4 0
+INDIRI4
+ADDRGP4 EffectScripts+8308076
+INDIRI4
+LTI4 $5122
+ADDRGP4 $5131
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5104
+endproc CG_RunFx 8 8
+proc CG_RunFx_f 60 16
+ADDRLP4 48
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+GEI4 $5133
+ADDRGP4 $5135
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5136
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5132
+JUMPV
+LABELV $5133
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $5137
+ADDRLP4 4
+ADDRGP4 cg+1332224+20
+INDIRB
+ASGNB 12
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg+1332224+32
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332224+152
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 52
+CNSTP4 0
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 $5138
+JUMPV
+LABELV $5137
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5147
+ADDRLP4 40
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRGP4 $5148
+JUMPV
+LABELV $5147
+ADDRLP4 40
+ADDRGP4 cg+607704
+ASGNP4
+LABELV $5148
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 52
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 52
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 56
+CNSTP4 0
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $5138
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LEI4 $5152
+CNSTI4 2
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $5152
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LEI4 $5154
+CNSTI4 3
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $5154
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LEI4 $5157
+CNSTI4 4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $5157
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $5160
+CNSTI4 5
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $5160
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LEI4 $5162
+CNSTI4 6
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $5162
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LEI4 $5165
+CNSTI4 7
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $5165
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LEI4 $5168
+CNSTI4 8
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $5168
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+LEI4 $5170
+CNSTI4 9
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $5170
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LEI4 $5173
+CNSTI4 10
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $5173
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_RunFx
+CALLV
+pop
+LABELV $5132
+endproc CG_RunFx_f 60 16
+proc CG_RunFxAll_f 1032 12
+ADDRLP4 1024
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 2
+GEI4 $5177
+ADDRGP4 $5179
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5176
+JUMPV
+LABELV $5177
+CNSTI4 1
+ARGI4
+ADDRLP4 1028
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_RunFxAll
+CALLV
+pop
+LABELV $5176
+endproc CG_RunFxAll_f 1032 12
+proc CG_RunFxAt_f 1152 48
+ADDRLP4 1132
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GEI4 $5181
+ADDRGP4 $5183
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5136
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5180
+JUMPV
+LABELV $5181
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $5184
+ADDRLP4 4
+ADDRGP4 cg+1332224+20
+INDIRB
+ASGNB 12
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg+1332224+32
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332224+152
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 1136
+CNSTP4 0
+ASGNP4
+ADDRLP4 1136
+INDIRP4
+ARGP4
+ADDRLP4 1136
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 $5185
+JUMPV
+LABELV $5184
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5194
+ADDRLP4 1128
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRGP4 $5195
+JUMPV
+LABELV $5194
+ADDRLP4 1128
+ADDRGP4 cg+607704
+ASGNP4
+LABELV $5195
+ADDRLP4 4
+ADDRLP4 1128
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRLP4 1136
+ADDRLP4 1128
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 1136
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 1136
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 1140
+CNSTP4 0
+ASGNP4
+ADDRLP4 1140
+INDIRP4
+ARGP4
+ADDRLP4 1140
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $5185
+CNSTI4 1
+ARGI4
+ADDRLP4 1136
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 1136
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 1140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1064
+ARGP4
+ADDRLP4 1140
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LEI4 $5199
+CNSTI4 3
+ARGI4
+ADDRLP4 1144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 1148
+INDIRF4
+ASGNF4
+LABELV $5199
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LEI4 $5201
+CNSTI4 4
+ARGI4
+ADDRLP4 1144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 1148
+INDIRF4
+ASGNF4
+LABELV $5201
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $5204
+CNSTI4 5
+ARGI4
+ADDRLP4 1144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 1148
+INDIRF4
+ASGNF4
+LABELV $5204
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LEI4 $5207
+CNSTI4 6
+ARGI4
+ADDRLP4 1144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 1148
+INDIRF4
+ASGNF4
+LABELV $5207
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LEI4 $5209
+CNSTI4 7
+ARGI4
+ADDRLP4 1144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 1148
+INDIRF4
+ASGNF4
+LABELV $5209
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LEI4 $5212
+CNSTI4 8
+ARGI4
+ADDRLP4 1144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 1148
+INDIRF4
+ASGNF4
+LABELV $5212
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+LEI4 $5215
+CNSTI4 9
+ARGI4
+ADDRLP4 1144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 1148
+INDIRF4
+ASGNF4
+LABELV $5215
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LEI4 $5217
+CNSTI4 10
+ARGI4
+ADDRLP4 1144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 1148
+INDIRF4
+ASGNF4
+LABELV $5217
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LEI4 $5220
+CNSTI4 11
+ARGI4
+ADDRLP4 1144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 1148
+INDIRF4
+ASGNF4
+LABELV $5220
+ADDRGP4 $5223
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 1064
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 4+8
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 16+8
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28+4
+INDIRF4
+ARGF4
+ADDRLP4 28+8
+INDIRF4
+ARGF4
+ADDRLP4 1144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $5180
+endproc CG_RunFxAt_f 1152 48
+proc CG_ListFxScripts_f 8 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5234
+JUMPV
+LABELV $5231
+ADDRGP4 $5236
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 EffectScripts+8290668
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5232
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5234
+ADDRLP4 0
+INDIRI4
+ADDRGP4 EffectScripts+8308076
+INDIRI4
+LTI4 $5231
+LABELV $5230
+endproc CG_ListFxScripts_f 8 12
+proc CG_PrintDirVector_f 20 16
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $5239
+ADDRGP4 cg+1332224+152
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 $5240
+JUMPV
+LABELV $5239
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5244
+ADDRLP4 12
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRGP4 $5245
+JUMPV
+LABELV $5244
+ADDRLP4 12
+ADDRGP4 cg+607704
+ASGNP4
+LABELV $5245
+ADDRLP4 12
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $5240
+ADDRGP4 $5248
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5238
+endproc CG_PrintDirVector_f 20 16
+proc CG_EventFilter_f 36 8
+ADDRLP4 12
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+GEI4 $5252
+ADDRGP4 $5254
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5255
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5256
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5251
+JUMPV
+LABELV $5252
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $4042
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $5257
+ADDRGP4 cg+6743252
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5251
+JUMPV
+LABELV $5257
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5263
+JUMPV
+LABELV $5260
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6739156
+ADDP4
+INDIRI4
+EQI4 $5265
+ADDRGP4 $5261
+JUMPV
+LABELV $5265
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $5271
+JUMPV
+LABELV $5268
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cg+6739156-4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cg+6739156
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5269
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5271
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+6743252
+INDIRI4
+LTI4 $5268
+ADDRLP4 32
+ADDRGP4 cg+6743252
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $5251
+JUMPV
+LABELV $5261
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5263
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+6743252
+INDIRI4
+LTI4 $5260
+ADDRGP4 cg+6743252
+INDIRI4
+CNSTI4 1024
+LTI4 $5277
+ADDRGP4 $5251
+JUMPV
+LABELV $5277
+ADDRGP4 cg+6743252
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6739156
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cg+6743252
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5251
+endproc CG_EventFilter_f 36 8
+proc CG_ListEventFilter_f 4 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5287
+JUMPV
+LABELV $5284
+ADDRGP4 $4629
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6739156
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+MODI4
+CNSTI4 0
+EQI4 $5290
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5290
+LABELV $5285
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5287
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+6743252
+INDIRI4
+LTI4 $5284
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5283
+endproc CG_ListEventFilter_f 4 8
+proc CG_AddDecal_f 608 40
+ADDRLP4 596
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 596
+INDIRI4
+CNSTI4 2
+GEI4 $5293
+ADDRGP4 $5295
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5296
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5292
+JUMPV
+LABELV $5293
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5298
+JUMPV
+LABELV $5297
+ADDRGP4 $5300
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 600
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 600
+INDIRP4
+ARGP4
+ADDRLP4 604
+ADDRGP4 SC_Cvar_Get_String
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 604
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $5301
+ADDRGP4 $5299
+JUMPV
+LABELV $5301
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5298
+ADDRGP4 $5297
+JUMPV
+LABELV $5299
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5303
+ADDRLP4 8
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $5304
+JUMPV
+LABELV $5303
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $5307
+ADDRLP4 8
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRGP4 $5308
+JUMPV
+LABELV $5307
+ADDRLP4 8
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+LABELV $5308
+LABELV $5304
+CNSTI4 1
+ARGI4
+ADDRLP4 600
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 600
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 84
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $5300
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 340
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $5313
+ARGP4
+ADDRGP4 cg+6747368
+INDIRF4
+ARGF4
+ADDRGP4 cg+6747368+4
+INDIRF4
+ARGF4
+ADDRGP4 cg+6747368+8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8+4
+INDIRF4
+ARGF4
+ADDRLP4 8+8
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 84
+ARGP4
+ADDRLP4 340
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $5292
+endproc CG_AddDecal_f 608 40
+proc CG_PrintTime_f 4 16
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5322
+ADDRLP4 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5323
+JUMPV
+LABELV $5322
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $5323
+ADDRGP4 $5326
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5321
+endproc CG_PrintTime_f 4 16
+proc CG_KillCountReset_f 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $5330
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+2380
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $5331
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $5330
+LABELV $5329
+endproc CG_KillCountReset_f 4 0
+proc CG_PrintEntityDistance_f 52 16
+ADDRLP4 28
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+GEI4 $5336
+ADDRGP4 $5295
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5296
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5338
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5339
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5340
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5335
+JUMPV
+LABELV $5336
+ADDRLP4 32
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 3
+GEI4 $5341
+ADDRLP4 16
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRGP4 $5342
+JUMPV
+LABELV $5341
+CNSTI4 2
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $5347
+ADDRLP4 12
+INDIRI4
+CNSTI4 1024
+LTI4 $5345
+LABELV $5347
+ADDRGP4 $5348
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5335
+JUMPV
+LABELV $5345
+ADDRLP4 16
+CNSTI4 1496
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $5342
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $5352
+ADDRLP4 12
+INDIRI4
+CNSTI4 1024
+LTI4 $5350
+LABELV $5352
+ADDRGP4 $5348
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5335
+JUMPV
+LABELV $5350
+ADDRLP4 0
+CNSTI4 1496
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRGP4 $5354
+ARGP4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5355
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 16+8
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5358
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5335
+endproc CG_PrintEntityDistance_f 52 16
+proc CG_PlayQ3mmeCamera_f 12 8
+ADDRGP4 cg+1332752
+INDIRI4
+CNSTI4 0
+EQI4 $5362
+ADDRGP4 $1466
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5361
+JUMPV
+LABELV $5362
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRGP4 demo+4+64
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $5371
+ADDRGP4 demo+4+64
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $5365
+LABELV $5371
+ADDRGP4 $5372
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5361
+JUMPV
+LABELV $5365
+ADDRLP4 0
+CNSTF4 1148846080
+ADDRGP4 cg_cameraRewindTime+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $5376
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $5376
+ADDRGP4 $1298
+ARGP4
+ADDRGP4 demo+4+64
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommandNow
+CALLV
+pop
+LABELV $5373
+ADDRGP4 cg+3196788
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3196816
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3196796
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196812
+CNSTI4 1
+ASGNI4
+LABELV $5361
+endproc CG_PlayQ3mmeCamera_f 12 8
+proc CG_StopQ3mmeCamera_f 0 4
+ADDRGP4 cg+3196788
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196816
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5387
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5384
+endproc CG_StopQ3mmeCamera_f 0 4
+proc CG_SaveQ3mmeCamera_f 36 12
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+GEI4 $5389
+ADDRGP4 $5391
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5388
+JUMPV
+LABELV $5389
+ADDRGP4 demo+4+64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $5392
+ADDRGP4 $5396
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5388
+JUMPV
+LABELV $5392
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5400
+JUMPV
+LABELV $5397
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $5401
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5399
+JUMPV
+LABELV $5401
+LABELV $5398
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5400
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 24
+INDIRU4
+LTU4 $5397
+LABELV $5399
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $5403
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $5405
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $5404
+JUMPV
+LABELV $5403
+ADDRGP4 $5406
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $5404
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $5407
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $5409
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5388
+JUMPV
+LABELV $5407
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Q3mmeCameraSave
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $5388
+endproc CG_SaveQ3mmeCamera_f 36 12
+lit
+align 4
+LABELV $5411
+address $5412
+address CG_Q3mmeCameraParse
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+code
+proc CG_LoadQ3mmeCamera_f 332 16
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 288
+ADDRGP4 $5411
+INDIRB
+ASGNB 24
+ADDRLP4 312
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+GEI4 $5413
+ADDRGP4 $5415
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5410
+JUMPV
+LABELV $5413
+CNSTI4 1
+ARGI4
+ADDRLP4 316
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 316
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5419
+JUMPV
+LABELV $5416
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $5420
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5418
+JUMPV
+LABELV $5420
+LABELV $5417
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5419
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 320
+INDIRU4
+LTU4 $5416
+LABELV $5418
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $5422
+CNSTI4 1
+ARGI4
+ADDRLP4 324
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $5405
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $5423
+JUMPV
+LABELV $5422
+CNSTI4 1
+ARGI4
+ADDRLP4 324
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $5406
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $5423
+ADDRLP4 268
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 324
+ADDRGP4 BG_XMLOpen
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+NEI4 $5424
+CNSTI4 1
+ARGI4
+ADDRLP4 328
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1190
+ARGP4
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5410
+JUMPV
+LABELV $5424
+ADDRLP4 268
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 328
+ADDRGP4 BG_XMLParse
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+NEI4 $5426
+ADDRGP4 $5428
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5426
+LABELV $5410
+endproc CG_LoadQ3mmeCamera_f 332 16
+proc CG_SeekNextRound_f 28 8
+ADDRLP4 8
+CNSTF4 3309010944
+ASGNF4
+ADDRLP4 12
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+LEI4 $5430
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $5430
+ADDRLP4 4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5435
+JUMPV
+LABELV $5432
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6769132
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LEI4 $5437
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $5434
+JUMPV
+LABELV $5437
+LABELV $5433
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5435
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+6770156
+INDIRI4
+LTI4 $5432
+LABELV $5434
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+LEI4 $5441
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5443
+CNSTI4 662
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GTI4 $5444
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $5444
+JUMPV
+LABELV $5443
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $5448
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $5451
+ADDRLP4 20
+ADDRGP4 CG_CpmaIsRoundWarmup
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $5454
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5454
+LABELV $5451
+LABELV $5448
+LABELV $5444
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+6770156
+INDIRI4
+GEI4 $5456
+ADDRGP4 $1298
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6769132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $5456
+LABELV $5441
+LABELV $5429
+endproc CG_SeekNextRound_f 28 8
+proc CG_SeekPrevRound_f 20 8
+ADDRLP4 4
+CNSTF4 3309010944
+ASGNF4
+ADDRLP4 8
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LEI4 $5461
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $5461
+ADDRLP4 0
+ADDRGP4 cg+6770156
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $5466
+JUMPV
+LABELV $5463
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6769132
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+GEI4 $5468
+ADDRGP4 $1298
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6769132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $5465
+JUMPV
+LABELV $5468
+LABELV $5464
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $5466
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $5463
+LABELV $5465
+LABELV $5460
+endproc CG_SeekPrevRound_f 20 8
+proc print_int_bits 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRU4
+ASGNU4
+ADDRLP4 4
+CNSTU4 2147483648
+ASGNU4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $5474
+ADDRGP4 $5478
+ARGP4
+ADDRFP4 0
+INDIRU4
+ADDRLP4 4
+INDIRU4
+BANDU4
+CNSTU4 0
+EQU4 $5480
+ADDRLP4 8
+CNSTI4 49
+ASGNI4
+ADDRGP4 $5481
+JUMPV
+LABELV $5480
+ADDRLP4 8
+CNSTI4 48
+ASGNI4
+LABELV $5481
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $5482
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 3
+NEI4 $5482
+ADDRGP4 $3920
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5482
+ADDRLP4 4
+ADDRLP4 4
+INDIRU4
+CNSTI4 1
+RSHU4
+ASGNU4
+LABELV $5475
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $5474
+LABELV $5473
+endproc print_int_bits 16 8
+proc CG_DebugCpmaMvd_f 28 16
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $5485
+ADDRGP4 $5484
+JUMPV
+LABELV $5485
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $5488
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $5492
+ADDRGP4 $5489
+JUMPV
+LABELV $5492
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $5495
+ADDRGP4 $5489
+JUMPV
+LABELV $5495
+ADDRGP4 $5499
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5502
+ARGP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 356
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 65535
+BANDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3920
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 356
+ADDP4
+ADDP4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 print_int_bits
+CALLV
+pop
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5506
+ARGP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 420
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+CNSTU4 255
+ASGNU4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 8
+RSHU4
+ADDRLP4 24
+INDIRU4
+BANDU4
+ARGU4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 24
+RSHU4
+ADDRLP4 24
+INDIRU4
+BANDU4
+ARGU4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3920
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 print_int_bits
+CALLV
+pop
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5489
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $5488
+LABELV $5484
+endproc CG_DebugCpmaMvd_f 28 16
+data
+align 4
+LABELV commands
+address $5512
+address CG_TestGun_f
+address $5513
+address CG_TestModel_f
+address $5514
+address CG_TestModelNextFrame_f
+address $5515
+address CG_TestModelPrevFrame_f
+address $5516
+address CG_TestModelNextSkin_f
+address $5517
+address CG_TestModelPrevSkin_f
+address $5518
+address CG_Viewpos_f
+address $5519
+address CG_ScoresDown_f
+address $5520
+address CG_ScoresUp_f
+address $5521
+address CG_AccStatsDown_f
+address $5522
+address CG_AccStatsUp_f
+address $5523
+address CG_ZoomDown_f
+address $5524
+address CG_ZoomUp_f
+address $5525
+address CG_SizeUp_f
+address $5526
+address CG_SizeDown_f
+address $5527
+address CG_NextWeapon_f
+address $5528
+address CG_PrevWeapon_f
+address $5529
+address CG_Weapon_f
+address $5530
+address CG_TargetCommand_f
+address $5531
+address CG_TellTarget_f
+address $5532
+address CG_TellAttacker_f
+address $5533
+address CG_LoadHud_f
+address $5534
+address CG_scrollScoresDown_f
+address $5535
+address CG_scrollScoresUp_f
+address $5536
+address CG_StartOrbit_f
+address $5537
+address CG_idCamera_f
+address $5538
+address CG_idCameraStop_f
+address $5539
+address CG_LoadDeferredPlayers
+address $5540
+address Wolfcam_Players_f
+address $5541
+address Wolfcam_Playersw_f
+address $5542
+address Wolfcam_Follow_f
+address $5543
+address Wolfcam_Weapon_Stats_f
+address $5544
+address Wolfcam_Weapon_Statsall_f
+address $5545
+address Wolfcam_Reset_Weapon_Stats_f
+address $5546
+address Wolfcam_List_Player_Models_f
+address $5547
+address CG_ListTimedItems_f
+address $5548
+address CG_LoadMenu_f
+address $5074
+address CG_FreeCam_f
+address $5549
+address CG_SetViewPos_f
+address $5550
+address CG_SetViewPos_f
+address $5551
+address CG_SetViewAngles_f
+address $5552
+address CG_SeekClock_f
+address $5553
+address CG_EchoPopup_f
+address $5554
+address CG_EchoPopupClear_f
+address $5555
+address CG_EchoPopupCvar_f
+address $5556
+address CG_ListEntities_f
+address $5557
+address CG_FrameArenaInfo_f
+address $5558
+address CG_PrintEntityState_f
+address $5559
+address CG_PrintNextEntityState_f
+address $5560
+address CG_ClearFragMessage_f
+address $5561
+address CG_ViewEnt_f
+address $5562
+address CG_ViewUnlockYaw_f
+address $5563
+address CG_ViewUnlockPitch_f
+address $5564
+address CG_GotoView_f
+address $5565
+address CG_TestReplaceShaderImage_f
+address $5566
+address CG_StopMovement_f
+address $5567
+address CG_ServerTime_f
+address $5568
+address CG_DumpStats_f
+address $5569
+address CG_SetLoopStart_f
+address $5570
+address CG_SetLoopEnd_f
+address $5571
+address CG_Loop_f
+address $5572
+address CG_FragForward_f
+address $5573
+address CG_RecordPath_f
+address $5574
+address CG_PlayPath_f
+address $5575
+address CG_StopPlayPath_f
+address $5576
+address CG_CenterRoll_f
+address $5577
+address CG_DrawRawPath_f
+address $5578
+address CG_Chase_f
+address $5579
+address CG_AddCameraPoint_f
+address $5580
+address CG_ClearCameraPoints_f
+address $5581
+address CG_PlayCamera_f
+address $5582
+address CG_StopCamera_f
+address $5583
+address CG_SaveCamera_f
+address $5584
+address CG_CamtraceSave_f
+address $5585
+address CG_LoadCamera_f
+address $5586
+address CG_SelectCameraPoint_f
+address $5587
+address CG_DeleteCameraPoint_f
+address $5588
+address CG_EditCameraPoint_f
+address $5589
+address CG_ChangeSelectedCameraPoints_f
+address $5590
+address CG_SetViewPointMark_f
+address $5591
+address CG_GotoViewPointMark_f
+address $5592
+address CG_SelectNextField_f
+address $5593
+address CG_SelectPrevField_f
+address $5594
+address CG_ChangeSelectedField_f
+address $5595
+address CG_FXMath_f
+address $5596
+address CG_FXLoad_f
+address $5597
+address CG_Vibrate_f
+address $5598
+address CG_LocalEnts_f
+address $5599
+address CG_ClearFX_f
+address $5600
+address CG_GotoAdvertisement_f
+address $5601
+address CG_ClientOverride_f
+address $5602
+address CG_TestMenu_f
+address $5603
+address CG_PrintPlayerState_f
+address $5604
+address CG_ClearScene_f
+address $5605
+address CG_InfoDown_f
+address $5606
+address CG_InfoUp_f
+address $5607
+address CG_AddAtCommand_f
+address $5608
+address CG_ListAtCommands_f
+address $5609
+address CG_ClearAtCommands_f
+address $5610
+address CG_RemoveAtCommand_f
+address $5611
+address CG_SaveAtCommands_f
+address $5612
+address CG_ExecAtTime_f
+address $5613
+address CG_EntityFilter_f
+address $5614
+address CG_ListEntityFilter_f
+address $5615
+address CG_EntityFreeze_f
+address $5616
+address CG_ListEntityFreeze_f
+address $5617
+address CG_PrintJumps_f
+address $5618
+address CG_ClearJumps_f
+address $5619
+address CG_MouseSeekDown_f
+address $5620
+address CG_MouseSeekUp_f
+address $5621
+address CG_PrintLegsInfo_f
+address $5622
+address CG_ChatDown_f
+address $5623
+address CG_ChatUp_f
+address $5624
+address CG_AddChatLine_f
+address $5625
+address CG_CvarInterp_f
+address $5626
+address CG_ClearCvarInterp_f
+address $5627
+address CG_ChangeConfigString_f
+address $5628
+address CG_ConfigStrings_f
+address $5629
+address CG_Gfov_f
+address $5630
+address CG_DemoScale_f
+address $5631
+address CG_FreecamLookAtPlayer_f
+address $5632
+address CG_RemapShader_f
+address $5633
+address CG_ClearRemappedShader_f
+address $381
+address CG_Move_f
+address $5634
+address CG_MoveOffset_f
+address $5635
+address CG_AddMirrorSurface_f
+address $5636
+address CG_DumpEnts_f
+address $5637
+address CG_StopDumpEnts_f
+address $5638
+address CG_RunFx_f
+address $5639
+address CG_RunFxAt_f
+address $5640
+address CG_RunFxAll_f
+address $5641
+address CG_ListFxScripts_f
+address $5642
+address CG_PrintDirVector_f
+address $5643
+address CG_EventFilter_f
+address $5644
+address CG_ListEventFilter_f
+address $5645
+address CG_AddDecal_f
+address $5646
+address CG_PrintTime_f
+address $5647
+address CG_KillCountReset_f
+address $5648
+address CG_PrintEntityDistance_f
+address $5649
+address CG_Q3mmeDemoCameraCommand_f
+address $5650
+address CG_PlayQ3mmeCamera_f
+address $5651
+address CG_StopQ3mmeCamera_f
+address $5652
+address CG_SaveQ3mmeCamera_f
+address $5653
+address CG_LoadQ3mmeCamera_f
+address $5654
+address CG_SeekNextRound_f
+address $5655
+address CG_SeekPrevRound_f
+address $5656
+address CG_DebugCpmaMvd_f
+export CG_ConsoleCommand
+code
+proc CG_ConsoleCommand 16 8
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5661
+JUMPV
+LABELV $5658
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $5662
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commands+4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $5657
+JUMPV
+LABELV $5662
+LABELV $5659
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5661
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 147
+LTU4 $5658
+CNSTI4 0
+RETI4
+LABELV $5657
+endproc CG_ConsoleCommand 16 8
+export CG_InitConsoleCommands
+proc CG_InitConsoleCommands 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5669
+JUMPV
+LABELV $5666
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $5667
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5669
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 147
+LTU4 $5666
+ADDRGP4 $5670
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5671
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5672
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5673
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5674
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5675
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5676
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5677
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5678
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $810
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5542
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5679
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5680
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5681
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5682
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5549
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5683
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5684
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5685
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5686
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5687
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5688
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $5689
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $5665
+endproc CG_InitConsoleCommands 4 4
+bss
+align 1
+LABELV LegsSkinName
+skip 64
+align 1
+LABELV TorsoSkinName
+skip 64
+align 1
+LABELV HeadSkinName
+skip 64
+align 4
+LABELV Old
+skip 6144
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import Wolfcam_CalcFov
+import Wolfcam_OffsetFirstPersonView
+import Wolfcam_OffsetThirdPersonView
+import Wolfcam_LoadModels
+import CG_GetModelAndSkinName
+import CG_GetModelName
+import Wolfcam_Reset_Weapon_Stats_f
+import Wolfcam_Weapon_Statsall_f
+import Wolfcam_Weapon_Stats_f
+import Wolfcam_Server_Info_f
+import Wolfcam_Follow_f
+import Wolfcam_Playersw_f
+import Wolfcam_Players_f
+import Wolfcam_List_Player_Models_f
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import CG_SpawnRailTrail
+import CG_AddWeaponWithPowerups
+import CG_MachinegunSpinAngle
+import CG_MapTorsoToWeaponFrame
+import CG_Bullet
+import CG_GetWeaponFlashOrigin
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_OutOfAmmoChange
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_DrawWeaponSelect
+import CG_AddViewWeapon
+import CG_AddPlayerWeapon
+import CG_LightningBolt
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_SimpleRailTrail
+import CG_DrawActiveFrame
+import CG_AdjustOriginToAvoidSolid
+import CG_CalcSpline
+import CG_AddBufferedSound
+import CG_AdjustedFov
+import CG_CalcZoom
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_CalcVrect
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Q3mmeCameraResetInternalLengths
+import CG_Q3mmeCameraParse
+import CG_Q3mmeCameraSave
+import CG_Q3mmeDemoCameraCommand_f
+import CG_Q3mmeCameraDrawPath
+import CG_Q3mmeCameraFovAt
+import CG_Q3mmeCameraAnglesAt
+import CG_Q3mmeCameraOriginAt
+import CG_Q3mmeCameraPointAdd
+import demo
+import CG_PushReward
+import CG_TransitionPlayerState
+import CG_CheckChangedPredictableEvents
+import CG_Respawn
+import CG_GetAmmoWarning
+import CG_PrintPlayerState
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_GetTeamColor
+import CG_RunMenuScript
+import CG_ShowResponseHead
+import CG_KeyEvent
+import CG_EventHandling
+import CG_MouseEvent
+import CG_OwnerDraw
+import CG_GetServerTimeFromClockString
+import CG_GetLevelTimerString
+import CG_GetCurrentTimeWithDirection
+import CG_DrawWeaponBar
+import CG_Text_Paint_Align
+import CG_Text_Paint_Limit_Bottom
+import CG_Text_Paint_Limit
+import CG_Text_Length
+import CG_GameTypeString
+import CG_GetGameStatusText
+import CG_GetKillerText
+import CG_OwnerDrawVisible
+import CG_YourTeamHasFlag
+import CG_OtherTeamHasFlag
+import CG_GetValue
+import CG_SelectPrevPlayer
+import CG_SelectNextPlayer
+import CG_CheckOrderPending
+import CG_SetPrintString
+import CG_InitTeamChat
+import MenuRect
+import QLWideScreen
+import MenuWidescreen
+import CG_FrameArenaInfo_f
+import CG_ResetFrameArena
+import CG_FrameArenaRelease
+import CG_FrameArenaMark
+import CG_FrameAlloc
+import CG_FreeMem
+import CG_CallocMem
+import CG_MallocMem
+import CG_NewParticleArea
+import CG_ParticleExplosion
+import CG_AddParticles
+import CG_ClearParticles
+import CG_AddMarks
+import CG_ImpactMark
+import CG_InitMarkPolys
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_ShutdownLocalEnts
+import CG_GetStoredScriptVarsFromLE
+import CG_RunFxAll
+import CG_SmokePuff_ql
+import CG_AddRefEntityFX
+import CG_AddRefEntity
+import CG_ListLocalEntities
+import CG_RemoveFXLocalEntities
+import CG_ClearLocalFrameEntities
+import CG_CullGrid
+import CG_AddToCullGrid
+import CG_BeginCullGrid
+import CG_AddLocalEntities
+import CG_MakeLowPriorityEntity
+import CG_AllocLocalEntityRealTime
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import FxLoopSounds
+import CG_FreeFxJitTokens
+import CG_ResetFXIntervalAndDistance
+import CG_UpdatePositionData
+import CG_CopyPositionDataToScript
+import CG_CopyPositionDataToCent
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+import CG_CopyPlayerDataToScriptData
+import CG_ResetScriptVars
+import CG_ReloadQ3mmeScripts
+import CG_RunQ3mmeScript
+import CG_Q3mmeMath
+import EffectScripts
+import PlainScript
+import DistanceScript
+import EmitterScript
+import EmitterScriptVars
+import ScriptVars
+import CG_AddPacketEntities
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_SetEntitySoundPosition
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AllowedAmbientSound
+import CG_PrintEntityStatep
+import CG_PrintEntityState
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_EchoPopup
+import BG_XMLParse
+import BG_XMLOpen
+import BG_XMLWarning
+import BG_XMLError
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $5689
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $5688
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $5687
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $5686
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $5685
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $5684
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $5683
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $5682
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $5681
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $5680
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $5679
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $5678
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $5677
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $5676
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $5675
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $5674
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $5673
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $5672
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $5671
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $5670
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $5656
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 99
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 100
+byte 1 0
+align 1
+LABELV $5655
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $5654
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $5653
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $5652
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $5651
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $5650
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $5649
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $5648
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $5647
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $5646
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5645
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $5644
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $5643
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $5642
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $5641
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 102
+byte 1 120
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $5640
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 102
+byte 1 120
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $5639
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 102
+byte 1 120
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $5638
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 102
+byte 1 120
+byte 1 0
+align 1
+LABELV $5637
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $5636
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $5635
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $5634
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $5633
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $5632
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $5631
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 97
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $5630
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $5629
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $5628
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $5627
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $5626
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $5625
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $5624
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $5623
+byte 1 45
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $5622
+byte 1 43
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $5621
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $5620
+byte 1 45
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 0
+align 1
+LABELV $5619
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 0
+align 1
+LABELV $5618
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $5617
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $5616
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $5615
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $5614
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $5613
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $5612
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5611
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $5610
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $5609
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $5608
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $5607
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $5606
+byte 1 45
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $5605
+byte 1 43
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $5604
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $5603
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $5602
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $5601
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $5600
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $5599
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 102
+byte 1 120
+byte 1 0
+align 1
+LABELV $5598
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $5597
+byte 1 118
+byte 1 105
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $5596
+byte 1 102
+byte 1 120
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $5595
+byte 1 102
+byte 1 120
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $5594
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $5593
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $5592
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $5591
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $5590
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $5589
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $5588
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $5587
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $5586
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $5585
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $5584
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $5583
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $5582
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $5581
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $5580
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $5579
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $5578
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $5577
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $5576
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $5575
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $5574
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $5573
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $5572
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $5571
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $5570
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $5569
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $5568
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $5567
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5566
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $5565
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $5564
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $5563
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $5562
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $5561
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $5560
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $5559
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $5558
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $5557
+byte 1 99
+byte 1 103
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $5556
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $5555
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $5554
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $5553
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $5552
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $5551
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $5550
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $5549
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $5548
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $5547
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $5546
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $5545
+byte 1 119
+byte 1 99
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $5544
+byte 1 119
+byte 1 99
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $5543
+byte 1 119
+byte 1 99
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $5542
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $5541
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 119
+byte 1 0
+align 1
+LABELV $5540
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $5539
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $5538
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 100
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $5537
+byte 1 105
+byte 1 100
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $5536
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5535
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $5534
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $5533
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 0
+align 1
+LABELV $5532
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $5531
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $5530
+byte 1 116
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 0
+align 1
+LABELV $5529
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $5528
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $5527
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $5526
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $5525
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $5524
+byte 1 45
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $5523
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $5522
+byte 1 45
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 0
+align 1
+LABELV $5521
+byte 1 43
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 0
+align 1
+LABELV $5520
+byte 1 45
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $5519
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $5518
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $5517
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $5516
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $5515
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5514
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5513
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $5512
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $5506
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 112
+byte 1 115
+byte 1 46
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 117
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 37
+byte 1 117
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 37
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $5502
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 112
+byte 1 115
+byte 1 46
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 117
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $5499
+byte 1 94
+byte 1 53
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $5478
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $5428
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 10
+byte 1 0
+align 1
+LABELV $5415
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $5412
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $5409
+byte 1 94
+byte 1 49
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 10
+byte 1 0
+align 1
+LABELV $5406
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $5405
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $5396
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $5391
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 60
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $5387
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 10
+byte 1 0
+align 1
+LABELV $5372
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 50
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $5358
+byte 1 32
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 103
+byte 1 50
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $5355
+byte 1 32
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 103
+byte 1 49
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $5354
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $5348
+byte 1 94
+byte 1 51
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $5340
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $5339
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $5338
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 49
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 50
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $5326
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $5313
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 32
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 32
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 32
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 32
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 32
+byte 1 51
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5300
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $5296
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $5295
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $5256
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 39
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 39
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $5255
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $5254
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 60
+byte 1 39
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $5248
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $5236
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $5223
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 102
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $5183
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 102
+byte 1 120
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 39
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 39
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 102
+byte 1 120
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 48
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 48
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 49
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 50
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 48
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 49
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 50
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $5179
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 102
+byte 1 120
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 60
+byte 1 102
+byte 1 120
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $5136
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 48
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 50
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 40
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $5135
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 102
+byte 1 120
+byte 1 32
+byte 1 60
+byte 1 102
+byte 1 120
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 48
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 48
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 49
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 50
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 48
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 49
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 50
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $5131
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $5103
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $5093
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $5074
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $5058
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $5056
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $5053
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $5031
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $5027
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 120
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 121
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 122
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $5012
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 91
+byte 1 120
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 122
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $4965
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $4961
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $4943
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 60
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 48
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 107
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 32
+byte 1 48
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 44
+byte 1 32
+byte 1 49
+byte 1 58
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 41
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $4939
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4928
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $4927
+byte 1 34
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 34
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 58
+byte 1 34
+byte 1 37
+byte 1 100
+byte 1 34
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 58
+byte 1 34
+byte 1 37
+byte 1 100
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $4903
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4898
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4890
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $4887
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $4874
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $4871
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 51
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 54
+byte 1 53
+byte 1 57
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4870
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $4869
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $4868
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $4867
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 54
+byte 1 53
+byte 1 57
+byte 1 32
+byte 1 94
+byte 1 54
+byte 1 110
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4866
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 51
+byte 1 32
+byte 1 34
+byte 1 70
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $4865
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 91
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 93
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $4847
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4837
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 49
+byte 1 32
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 32
+byte 1 32
+byte 1 54
+byte 1 46
+byte 1 48
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $4836
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 48
+byte 1 46
+byte 1 55
+byte 1 32
+byte 1 50
+byte 1 46
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $4835
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 39
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 39
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 39
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $4826
+byte 1 94
+byte 1 49
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $4822
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 60
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $4818
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 76
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4815
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4814
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 60
+byte 1 37
+byte 1 112
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $4813
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4812
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4811
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $4810
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4809
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $4808
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $4807
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4806
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4805
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4804
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4802
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4775
+byte 1 10
+byte 1 10
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4705
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 39
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $4701
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $4696
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 0
+align 1
+LABELV $4691
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 0
+align 1
+LABELV $4686
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 0
+align 1
+LABELV $4681
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $4676
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $4671
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $4666
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 0
+align 1
+LABELV $4661
+byte 1 98
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 0
+align 1
+LABELV $4656
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $4651
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 0
+align 1
+LABELV $4646
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 0
+align 1
+LABELV $4641
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $4636
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 0
+align 1
+LABELV $4632
+byte 1 10
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $4629
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 0
+align 1
+LABELV $4613
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $4576
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $4566
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $4488
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $4469
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 60
+byte 1 39
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 84
+byte 1 89
+byte 1 80
+byte 1 69
+byte 1 44
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $4465
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 34
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $4464
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $4460
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $4452
+byte 1 94
+byte 1 49
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4449
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $4435
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4431
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4427
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $4417
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 45
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 45
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $4416
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $4407
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 65
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4404
+byte 1 94
+byte 1 51
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $4398
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 116
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $4394
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $4391
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 50
+byte 1 58
+byte 1 48
+byte 1 53
+byte 1 32
+byte 1 114
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 49
+byte 1 46
+byte 1 52
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 47
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 50
+byte 1 58
+byte 1 48
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $4390
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 56
+byte 1 58
+byte 1 53
+byte 1 50
+byte 1 46
+byte 1 51
+byte 1 51
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 57
+byte 1 48
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 47
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4389
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 52
+byte 1 53
+byte 1 52
+byte 1 54
+byte 1 54
+byte 1 50
+byte 1 57
+byte 1 46
+byte 1 53
+byte 1 48
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 47
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4388
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 48
+byte 1 46
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $4387
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 39
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 39
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $4376
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4337
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $4332
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $4327
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $4259
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4254
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $4249
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4244
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4239
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4234
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4229
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $4224
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $4219
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $4205
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $4191
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $4177
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $4129
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $4125
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4107
+byte 1 10
+byte 1 101
+byte 1 120
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 51
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 10
+byte 1 0
+align 1
+LABELV $4106
+byte 1 10
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 117
+byte 1 115
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 39
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4096
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $4083
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4070
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $4059
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $4054
+byte 1 116
+byte 1 0
+align 1
+LABELV $4047
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $4042
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $4030
+byte 1 99
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 99
+byte 1 58
+byte 1 53
+byte 1 57
+byte 1 55
+byte 1 57
+byte 1 0
+align 1
+LABELV $4029
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4020
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3995
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3951
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 62
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 65
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3947
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $3944
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $3940
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 60
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $3921
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3920
+byte 1 32
+byte 1 0
+align 1
+LABELV $3915
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 40
+byte 1 52
+byte 1 53
+byte 1 46
+byte 1 51
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 49
+byte 1 46
+byte 1 50
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3914
+byte 1 101
+byte 1 120
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 40
+byte 1 51
+byte 1 32
+byte 1 43
+byte 1 32
+byte 1 56
+byte 1 41
+byte 1 32
+byte 1 42
+byte 1 32
+byte 1 52
+byte 1 32
+byte 1 43
+byte 1 32
+byte 1 40
+byte 1 50
+byte 1 46
+byte 1 50
+byte 1 32
+byte 1 42
+byte 1 32
+byte 1 51
+byte 1 46
+byte 1 51
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3913
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 60
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $3909
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $3908
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 62
+byte 1 0
+align 1
+LABELV $3905
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 62
+byte 1 0
+align 1
+LABELV $3886
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 120
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 121
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 122
+byte 1 93
+byte 1 0
+align 1
+LABELV $3883
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 0
+align 1
+LABELV $3866
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 60
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 62
+byte 1 0
+align 1
+LABELV $3863
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $3807
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $3797
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3796
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 39
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $3795
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3794
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3773
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3752
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3731
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3710
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3689
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3660
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3649
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $3646
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 39
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $3645
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $3644
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3643
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3622
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3601
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3582
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $3579
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3560
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $3557
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3538
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $3535
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3506
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3495
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $3486
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $3485
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3484
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3483
+byte 1 117
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3474
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 0
+align 1
+LABELV $3471
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 0
+align 1
+LABELV $3468
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $3465
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 0
+align 1
+LABELV $3462
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $3461
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3448
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $3443
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 60
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $3442
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3441
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3440
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3431
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $3428
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $3427
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3426
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $3421
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $3414
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3413
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3410
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3407
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $3400
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3396
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $3392
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $3387
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $3384
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 60
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $3383
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3379
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3373
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $3366
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 60
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $3365
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3364
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $3363
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $3360
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $3357
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3352
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3349
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $3346
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 98
+byte 1 101
+byte 1 122
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 10
+byte 1 0
+align 1
+LABELV $3345
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $3332
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $3313
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 91
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 102
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $3310
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3295
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3254
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $3251
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3211
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $3208
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $3199
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $3190
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $3172
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3169
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3122
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 102
+byte 1 0
+align 1
+LABELV $3117
+byte 1 94
+byte 1 51
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 42
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3113
+byte 1 94
+byte 1 51
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3069
+byte 1 32
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 32
+byte 1 42
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3066
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3052
+byte 1 94
+byte 1 51
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 10
+byte 1 0
+align 1
+LABELV $3022
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 0
+align 1
+LABELV $3017
+byte 1 94
+byte 1 51
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 42
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3013
+byte 1 94
+byte 1 51
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3010
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3007
+byte 1 94
+byte 1 51
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 10
+byte 1 0
+align 1
+LABELV $3004
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $3001
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2950
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 48
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $2934
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $2915
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2912
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $2909
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2898
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 102
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $2895
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 102
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2892
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2885
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2870
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $2858
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2855
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2808
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $2716
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $2715
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $2700
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2660
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2654
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2650
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 93
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $2647
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $2639
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $2636
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2629
+byte 1 10
+byte 1 69
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 60
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 62
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 91
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 93
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 10
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 98
+byte 1 101
+byte 1 122
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 62
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 62
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 60
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 40
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 52
+byte 1 48
+byte 1 41
+byte 1 62
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 62
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 39
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 91
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 93
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 120
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 122
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 60
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 44
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 39
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 62
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 60
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 44
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 39
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 62
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 93
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 102
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 62
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 44
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 41
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 102
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 47
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 50
+byte 1 46
+byte 1 48
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 119
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 48
+byte 1 46
+byte 1 53
+byte 1 58
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 10
+byte 1 0
+align 1
+LABELV $2621
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 45
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2611
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 99
+byte 1 32
+byte 1 33
+byte 1 99
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2571
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2550
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2511
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2485
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2468
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2423
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2404
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2383
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2268
+byte 1 94
+byte 1 49
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2265
+byte 1 94
+byte 1 49
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2229
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $2137
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 40
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2122
+byte 1 94
+byte 1 49
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2107
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2103
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2100
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $2067
+byte 1 94
+byte 1 49
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1903
+byte 1 94
+byte 1 50
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $1851
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1835
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $1740
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1731
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $1724
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $1710
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1684
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1673
+byte 1 105
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1659
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1653
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1650
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 49
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1649
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 49
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 50
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1645
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $1640
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1631
+byte 1 37
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $1628
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $1620
+byte 1 87
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 0
+align 1
+LABELV $1603
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $1595
+byte 1 67
+byte 1 111
+byte 1 112
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 40
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 41
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 34
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 34
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 58
+byte 1 34
+byte 1 37
+byte 1 100
+byte 1 34
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 58
+byte 1 34
+byte 1 57
+byte 1 48
+byte 1 34
+byte 1 10
+byte 1 68
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 51
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 37
+byte 1 48
+byte 1 51
+byte 1 100
+byte 1 46
+byte 1 113
+byte 1 119
+byte 1 99
+byte 1 112
+byte 1 46
+byte 1 10
+byte 1 10
+byte 1 0
+align 1
+LABELV $1591
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 34
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 34
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 58
+byte 1 34
+byte 1 37
+byte 1 100
+byte 1 34
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 58
+byte 1 34
+byte 1 57
+byte 1 48
+byte 1 34
+byte 1 10
+byte 1 68
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 51
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 37
+byte 1 48
+byte 1 51
+byte 1 100
+byte 1 46
+byte 1 101
+byte 1 112
+byte 1 99
+byte 1 112
+byte 1 46
+byte 1 10
+byte 1 10
+byte 1 0
+align 1
+LABELV $1588
+byte 1 94
+byte 1 49
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1585
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 51
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 37
+byte 1 48
+byte 1 51
+byte 1 100
+byte 1 46
+byte 1 113
+byte 1 119
+byte 1 99
+byte 1 112
+byte 1 0
+align 1
+LABELV $1584
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 51
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 37
+byte 1 48
+byte 1 51
+byte 1 100
+byte 1 46
+byte 1 101
+byte 1 112
+byte 1 99
+byte 1 112
+byte 1 0
+align 1
+LABELV $1569
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $1560
+byte 1 10
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $1557
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $1556
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1555
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1554
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 82
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1553
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1552
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1551
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 118
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1550
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1549
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1548
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 90
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1547
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1546
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1545
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 89
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1544
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1543
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1542
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 88
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1541
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1540
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1539
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1538
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1537
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1536
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1535
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1534
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 10
+byte 1 0
+align 1
+LABELV $1533
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1532
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1531
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1530
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1529
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1528
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $1527
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1526
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1525
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $1524
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1523
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1522
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1521
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1520
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1519
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1518
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1517
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1516
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $1515
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $1508
+byte 1 87
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1507
+byte 1 94
+byte 1 49
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1504
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1503
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1494
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 50
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1490
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 60
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $1470
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 50
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1466
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $1436
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1433
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 98
+byte 1 101
+byte 1 122
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1430
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1427
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $1424
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $1421
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1386
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1320
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $1316
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $1308
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 10
+byte 1 0
+align 1
+LABELV $1298
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1286
+byte 1 94
+byte 1 49
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1260
+byte 1 37
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1259
+byte 1 94
+byte 1 49
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1243
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $1241
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1239
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1205
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 44
+byte 1 32
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $1201
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $1195
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1193
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1190
+byte 1 94
+byte 1 49
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1185
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $1183
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $1180
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1168
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 10
+byte 1 0
+align 1
+LABELV $1131
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $1130
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1128
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1117
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1116
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $1084
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1083
+byte 1 98
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1082
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1081
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1080
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1079
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1078
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1077
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1076
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1075
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1074
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1073
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1072
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1071
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1057
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1056
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1055
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1042
+byte 1 98
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1041
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1040
+byte 1 109
+byte 1 104
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1039
+byte 1 103
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1038
+byte 1 121
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1037
+byte 1 114
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1036
+byte 1 116
+byte 1 107
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1035
+byte 1 116
+byte 1 107
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1034
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1021
+byte 1 112
+byte 1 103
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1020
+byte 1 112
+byte 1 103
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1019
+byte 1 114
+byte 1 103
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1018
+byte 1 114
+byte 1 103
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1017
+byte 1 108
+byte 1 103
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1016
+byte 1 108
+byte 1 103
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1015
+byte 1 114
+byte 1 108
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1014
+byte 1 114
+byte 1 108
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1013
+byte 1 103
+byte 1 108
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1012
+byte 1 103
+byte 1 108
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1011
+byte 1 115
+byte 1 103
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1010
+byte 1 115
+byte 1 103
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1009
+byte 1 109
+byte 1 103
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1008
+byte 1 109
+byte 1 103
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1007
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1006
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 82
+byte 1 101
+byte 1 99
+byte 1 101
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1005
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 68
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $992
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $991
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $990
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $989
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $984
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $983
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $982
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 69
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $981
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $980
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $979
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $978
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $977
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $976
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $975
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $974
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $973
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $972
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $971
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $970
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $969
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $968
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $967
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $966
+byte 1 10
+byte 1 0
+align 1
+LABELV $950
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 10
+byte 1 10
+byte 1 0
+align 1
+LABELV $947
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $877
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $835
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $834
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $833
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $828
+byte 1 0
+align 1
+LABELV $821
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $811
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $810
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $809
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $808
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $807
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $806
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $805
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $804
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $803
+byte 1 98
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $802
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $801
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $800
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $799
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $798
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $765
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $736
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $714
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $702
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $701
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $700
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $680
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $667
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $663
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $648
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $645
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $612
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 102
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $609
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 102
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $602
+byte 1 101
+byte 1 120
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 49
+byte 1 48
+byte 1 58
+byte 1 50
+byte 1 49
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 119
+byte 1 49
+byte 1 50
+byte 1 58
+byte 1 53
+byte 1 51
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $601
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 60
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $598
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 102
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 10
+byte 1 0
+align 1
+LABELV $588
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $563
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $527
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $508
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 32
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $507
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 10
+byte 1 0
+align 1
+LABELV $506
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 40
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $502
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $497
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $491
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $488
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $451
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $426
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $381
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $354
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $343
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 91
+byte 1 120
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 122
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $342
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 10
+byte 1 0
+align 1
+LABELV $341
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 91
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 93
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $340
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 0
+align 1
+LABELV $333
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 60
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $323
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 32
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $316
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $309
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $306
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $303
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $300
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $297
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $294
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $286
+byte 1 94
+byte 1 49
+byte 1 85
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $280
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 10
+byte 1 0
+align 1
+LABELV $279
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $276
+byte 1 46
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $271
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $270
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $269
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $268
+byte 1 49
+byte 1 0
+align 1
+LABELV $267
+byte 1 53
+byte 1 0
+align 1
+LABELV $266
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $265
+byte 1 48
+byte 1 0
+align 1
+LABELV $264
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $258
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $253
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $232
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $229
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $201
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $197
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $170
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $165
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $164
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $162
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
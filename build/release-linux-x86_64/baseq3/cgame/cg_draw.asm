@@ -0,0 +1,58603 @@
+data
+export drawTeamOverlayModificationCount
+align 4
+LABELV drawTeamOverlayModificationCount
+byte 4 -1
+align 4
+LABELV SP_drawSelected
+byte 4 1
+code
+proc CG_SPrintInit 8 12
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 SP_x
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 SP_y
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 SP_h
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 SP_align
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 SP_scale
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 SP_color
+ADDRFP4 20
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 SP_color+4
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 SP_color+8
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 SP_color+12
+ADDRFP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 SP_selectedColor
+ARGP4
+ADDRGP4 cg_drawCameraPointInfoSelectedColor
+ARGP4
+ADDRGP4 cg_drawCameraPointInfoAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRGP4 SP_backgroundColor
+ARGP4
+ADDRGP4 cg_drawCameraPointInfoBackgroundColor
+ARGP4
+ADDRGP4 cg_drawCameraPointInfoBackgroundAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRGP4 SP_style
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 SP_font
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 SP_count
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 32
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $163
+ADDRGP4 SP_drawSelected
+CNSTI4 1
+ASGNI4
+ADDRGP4 $164
+JUMPV
+LABELV $163
+ADDRGP4 SP_drawSelected
+CNSTI4 0
+ASGNI4
+LABELV $164
+LABELV $159
+endproc CG_SPrintInit 8 12
+proc CG_SPrint 20 36
+ADDRLP4 0
+ADDRGP4 SP_x
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SP_scale
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 SP_font
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 SP_align
+INDIRI4
+CNSTI4 1
+NEI4 $166
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $167
+JUMPV
+LABELV $166
+ADDRGP4 SP_align
+INDIRI4
+CNSTI4 2
+NEI4 $168
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $168
+LABELV $167
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 SP_y
+INDIRP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 SP_h
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 SP_backgroundColor
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 SP_count
+INDIRI4
+ADDRGP4 cg+3196780
+INDIRI4
+NEI4 $170
+ADDRGP4 SP_drawSelected
+INDIRI4
+CNSTI4 0
+EQI4 $170
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 SP_y
+INDIRP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 SP_scale
+INDIRF4
+ARGF4
+ADDRGP4 SP_selectedColor
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 SP_style
+INDIRI4
+ARGI4
+ADDRGP4 SP_font
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 SP_y
+INDIRP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 SP_scale
+INDIRF4
+ARGF4
+ADDRGP4 SP_color
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 SP_style
+INDIRI4
+ARGI4
+ADDRGP4 SP_font
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $171
+ADDRLP4 12
+ADDRGP4 SP_y
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRGP4 SP_h
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 SP_count
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $165
+endproc CG_SPrint 20 36
+proc CG_DrawCameraPointInfo 224 36
+ADDRGP4 cg_drawCameraPointInfo+12
+INDIRI4
+CNSTI4 0
+NEI4 $174
+ADDRGP4 $173
+JUMPV
+LABELV $174
+ADDRGP4 cg_drawCameraPointInfo+12
+INDIRI4
+CNSTI4 3
+NEI4 $177
+ADDRGP4 CG_DrawQ3mmeCameraPointInfo
+CALLV
+pop
+ADDRGP4 $173
+JUMPV
+LABELV $177
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+GEI4 $180
+ADDRGP4 cg_drawCameraPointInfo+12
+INDIRI4
+CNSTI4 1
+NEI4 $173
+ADDRGP4 CG_DrawQ3mmeCameraPointInfo
+CALLV
+pop
+ADDRGP4 $173
+JUMPV
+LABELV $180
+ADDRLP4 36
+ARGP4
+ADDRGP4 cg_drawCameraPointInfoColor
+ARGP4
+ADDRGP4 cg_drawCameraPointInfoAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 36+12
+INDIRF4
+CNSTF4 0
+GTF4 $186
+ADDRGP4 $173
+JUMPV
+LABELV $186
+ADDRGP4 QLWideScreen
+CNSTI4 1
+ASGNI4
+ADDRLP4 116
+ADDRGP4 cg_drawCameraPointInfoAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 cg_drawCameraPointInfoScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 112
+ADDRGP4 cg_drawCameraPointInfoStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawCameraPointInfoFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $192
+ADDRLP4 56
+ADDRGP4 cgs+632912+1165544
+ASGNP4
+ADDRGP4 $193
+JUMPV
+LABELV $192
+ADDRLP4 56
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $193
+ADDRLP4 100
+ADDRGP4 cg_drawCameraPointInfoX+12
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRGP4 cg_drawCameraPointInfoY+12
+INDIRI4
+ASGNI4
+ADDRGP4 $201
+ARGP4
+ADDRLP4 52
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 1460
+ADDRGP4 cg+3196772
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRLP4 16
+ADDRLP4 16
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $205
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $207
+ADDRLP4 16
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $204
+LABELV $207
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRLP4 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $209
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $211
+ADDRLP4 12
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $208
+LABELV $211
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $213
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $215
+ADDRLP4 8
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $212
+LABELV $215
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $217
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $219
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $216
+LABELV $219
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $221
+JUMPV
+LABELV $220
+ADDRLP4 24
+ADDRLP4 24
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $221
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $223
+ADDRLP4 24
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $220
+LABELV $223
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRLP4 20
+ADDRLP4 20
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $225
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $227
+ADDRLP4 20
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $224
+LABELV $227
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 104
+ARGP4
+ADDRLP4 108
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_SPrintInit
+CALLV
+pop
+ADDRGP4 cg+3196772
+INDIRI4
+ADDRGP4 cg+3196776
+INDIRI4
+NEI4 $228
+ADDRLP4 60
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196772
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $229
+JUMPV
+LABELV $228
+ADDRLP4 60
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $234
+ARGP4
+ADDRGP4 cg+3196772
+INDIRI4
+ARGI4
+ADDRGP4 cg+3196776
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $229
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $237
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $237
+ADDRLP4 0
+INDIRP4
+CNSTI4 1440
+ADDP4
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $239
+ADDRGP4 $241
+ARGP4
+ADDRGP4 cg+3196772
+INDIRI4
+ARGI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $238
+JUMPV
+LABELV $239
+ADDRGP4 $244
+ARGP4
+ADDRGP4 cg+3196772
+INDIRI4
+ARGI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $238
+JUMPV
+LABELV $237
+ADDRGP4 $247
+ARGP4
+ADDRGP4 cg+3196772
+INDIRI4
+ARGI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $238
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+2121556+40
+INDIRF4
+GEF4 $250
+ADDRLP4 28
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $251
+JUMPV
+LABELV $250
+ADDRGP4 cg+607152
+INDIRF4
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556-1460+40
+ADDP4
+INDIRF4
+LEF4 $255
+ADDRLP4 28
+ADDRGP4 cg+3196764
+INDIRI4
+ASGNI4
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $263
+ADDRGP4 cg+607152
+INDIRF4
+CNSTI4 1460
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+GEF4 $268
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $265
+JUMPV
+LABELV $268
+LABELV $264
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $266
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $263
+LABELV $265
+LABELV $256
+LABELV $251
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GEI4 $273
+ADDRGP4 $275
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $274
+JUMPV
+LABELV $273
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $277
+ADDRGP4 $280
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $278
+JUMPV
+LABELV $277
+ADDRGP4 $283
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $278
+LABELV $274
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $285
+ADDRGP4 $287
+ARGP4
+ADDRLP4 156
+CNSTI4 40
+ASGNI4
+ADDRLP4 160
+ADDRLP4 0
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $286
+JUMPV
+LABELV $285
+ADDRGP4 $288
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $286
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 156
+CNSTU4 0
+ASGNU4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 156
+INDIRU4
+EQU4 $289
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $289
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRLP4 156
+INDIRU4
+EQU4 $289
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ADDRGP4 cg_cameraSmoothFactor+8
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+GEF4 $291
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+LABELV $291
+LABELV $289
+ADDRLP4 160
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 160
+INDIRU4
+EQU4 $294
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $294
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 160
+INDIRU4
+EQU4 $294
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ADDRGP4 cg_cameraSmoothFactor+8
+INDIRF4
+MULF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+GEF4 $296
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+LABELV $296
+LABELV $294
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $299
+ADDRGP4 $301
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 168
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRGP4 $300
+JUMPV
+LABELV $299
+ADDRGP4 $302
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 168
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 168
+INDIRP4
+ASGNP4
+LABELV $300
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $303
+ADDRGP4 $305
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 168
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRGP4 $304
+JUMPV
+LABELV $303
+ADDRGP4 $306
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 168
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 168
+INDIRP4
+ASGNP4
+LABELV $304
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $307
+ADDRGP4 $309
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $308
+JUMPV
+LABELV $307
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $310
+ADDRGP4 $312
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $313
+ADDRGP4 $315
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $314
+JUMPV
+LABELV $313
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $316
+ADDRGP4 $318
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $317
+JUMPV
+LABELV $316
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $319
+ADDRGP4 $321
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $320
+JUMPV
+LABELV $319
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $322
+ADDRGP4 $324
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $323
+JUMPV
+LABELV $322
+ADDRGP4 $325
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+LABELV $323
+LABELV $320
+LABELV $317
+LABELV $314
+LABELV $311
+LABELV $308
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $326
+ADDRGP4 $328
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $327
+JUMPV
+LABELV $326
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $329
+ADDRGP4 $331
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $330
+JUMPV
+LABELV $329
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $332
+ADDRGP4 $334
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $333
+JUMPV
+LABELV $332
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $335
+ADDRGP4 $337
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $336
+JUMPV
+LABELV $335
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $338
+ADDRGP4 $340
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $339
+JUMPV
+LABELV $338
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $341
+ADDRGP4 $343
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $342
+JUMPV
+LABELV $341
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $344
+ADDRGP4 $346
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $347
+ADDRGP4 $349
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $348
+JUMPV
+LABELV $347
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $350
+ADDRGP4 $352
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRGP4 $353
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+LABELV $351
+LABELV $348
+LABELV $345
+LABELV $342
+LABELV $339
+LABELV $336
+LABELV $333
+LABELV $330
+LABELV $327
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $354
+ADDRGP4 $356
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $357
+ADDRGP4 $359
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $358
+JUMPV
+LABELV $357
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $360
+ADDRGP4 $362
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $363
+ADDRGP4 $365
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRGP4 $364
+JUMPV
+LABELV $363
+ADDRGP4 $366
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 164
+INDIRP4
+ASGNP4
+LABELV $364
+LABELV $361
+LABELV $358
+LABELV $355
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $367
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $377
+ADDRLP4 164
+ADDRGP4 $368
+ASGNP4
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRLP4 164
+ADDRGP4 $369
+ASGNP4
+LABELV $378
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $379
+ADDRLP4 168
+ADDRGP4 $371
+ASGNP4
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRLP4 168
+ADDRGP4 $369
+ASGNP4
+LABELV $380
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 172
+ADDRGP4 $373
+ASGNP4
+ADDRGP4 $382
+JUMPV
+LABELV $381
+ADDRLP4 172
+ADDRGP4 $369
+ASGNP4
+LABELV $382
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $383
+ADDRLP4 176
+ADDRGP4 $375
+ASGNP4
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRLP4 176
+ADDRGP4 $369
+ASGNP4
+LABELV $384
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $385
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $386
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 192
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $387
+ADDRGP4 $389
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $388
+JUMPV
+LABELV $387
+ADDRGP4 $390
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 196
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $388
+ADDRGP4 $391
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $392
+ADDRGP4 $394
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $395
+ADDRGP4 $397
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $398
+ADDRGP4 $400
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRGP4 $401
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $399
+LABELV $396
+LABELV $393
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $402
+ADDRGP4 $404
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRGP4 $405
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $403
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $406
+ADDRGP4 $408
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $409
+ADDRGP4 $411
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $412
+ADDRGP4 $414
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $415
+ADDRGP4 $417
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $418
+ADDRGP4 $420
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $419
+JUMPV
+LABELV $418
+ADDRGP4 $421
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $419
+LABELV $416
+LABELV $413
+LABELV $410
+LABELV $407
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $422
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $424
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $426
+ADDRGP4 $428
+ARGP4
+ADDRLP4 208
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 212
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $425
+JUMPV
+LABELV $426
+ADDRGP4 $429
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $425
+JUMPV
+LABELV $424
+ADDRGP4 $430
+ARGP4
+ADDRLP4 208
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 212
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $425
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $431
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $433
+ADDRGP4 $435
+ARGP4
+ADDRLP4 208
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 212
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $432
+JUMPV
+LABELV $433
+ADDRGP4 $436
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRGP4 $437
+ARGP4
+ADDRLP4 208
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 212
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $432
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $438
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $440
+ADDRGP4 $442
+ARGP4
+ADDRLP4 208
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 12
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 212
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $423
+JUMPV
+LABELV $440
+ADDRGP4 $443
+ARGP4
+ADDRLP4 208
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 12
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 212
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $423
+JUMPV
+LABELV $438
+ADDRGP4 $444
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRGP4 $429
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $436
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $444
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $423
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $445
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $447
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $449
+ADDRGP4 $451
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $448
+JUMPV
+LABELV $449
+ADDRGP4 $452
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $448
+JUMPV
+LABELV $447
+ADDRGP4 $453
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $448
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $454
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $456
+ADDRGP4 $458
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $455
+JUMPV
+LABELV $456
+ADDRGP4 $459
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $455
+JUMPV
+LABELV $454
+ADDRGP4 $460
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $455
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $461
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $463
+ADDRGP4 $465
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $446
+JUMPV
+LABELV $463
+ADDRGP4 $466
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1272
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $446
+JUMPV
+LABELV $461
+ADDRGP4 $467
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRGP4 $452
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $459
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $467
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $446
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $468
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $470
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $472
+ADDRLP4 204
+CNSTI4 92
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $474
+ARGP4
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 208
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $471
+JUMPV
+LABELV $472
+ADDRGP4 $475
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $471
+JUMPV
+LABELV $470
+ADDRGP4 $474
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $471
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $476
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $478
+ADDRLP4 204
+CNSTI4 92
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $480
+ARGP4
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 208
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $477
+JUMPV
+LABELV $478
+ADDRGP4 $481
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRGP4 $480
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $477
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $482
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $484
+ADDRLP4 204
+CNSTI4 92
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $486
+ARGP4
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 208
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $469
+JUMPV
+LABELV $484
+ADDRGP4 $486
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $469
+JUMPV
+LABELV $482
+ADDRGP4 $487
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $469
+JUMPV
+LABELV $468
+ADDRGP4 $475
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $481
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $487
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $469
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $488
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $490
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $492
+ADDRLP4 204
+CNSTI4 96
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 208
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $491
+JUMPV
+LABELV $492
+ADDRGP4 $495
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $491
+JUMPV
+LABELV $490
+ADDRGP4 $494
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $491
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $496
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $498
+ADDRLP4 204
+CNSTI4 96
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $500
+ARGP4
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 208
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $498
+ADDRGP4 $501
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRGP4 $500
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $497
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $502
+ADDRLP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $504
+ADDRLP4 204
+CNSTI4 96
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 208
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $489
+JUMPV
+LABELV $504
+ADDRGP4 $506
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $489
+JUMPV
+LABELV $502
+ADDRGP4 $507
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $489
+JUMPV
+LABELV $488
+ADDRGP4 $495
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $501
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $507
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $489
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $508
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $510
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $512
+ADDRLP4 204
+CNSTI4 100
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $514
+ARGP4
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 208
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $512
+ADDRGP4 $515
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRGP4 $514
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $511
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $516
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $518
+ADDRLP4 204
+CNSTI4 100
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $520
+ARGP4
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 208
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $517
+JUMPV
+LABELV $518
+ADDRGP4 $521
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $517
+JUMPV
+LABELV $516
+ADDRGP4 $520
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $517
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $522
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $524
+ADDRLP4 204
+CNSTI4 100
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $526
+ARGP4
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 208
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $509
+JUMPV
+LABELV $524
+ADDRGP4 $526
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $509
+JUMPV
+LABELV $522
+ADDRGP4 $527
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $509
+JUMPV
+LABELV $508
+ADDRGP4 $515
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $521
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $527
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $509
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $528
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $530
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $532
+ADDRLP4 204
+CNSTI4 104
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $534
+ARGP4
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 208
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $531
+JUMPV
+LABELV $532
+ADDRGP4 $535
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $531
+JUMPV
+LABELV $530
+ADDRGP4 $534
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $531
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $536
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $538
+ADDRLP4 204
+CNSTI4 104
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $540
+ARGP4
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 208
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $537
+JUMPV
+LABELV $538
+ADDRGP4 $541
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRGP4 $540
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $537
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $542
+ADDRLP4 20
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $544
+ADDRLP4 204
+CNSTI4 104
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $546
+ARGP4
+ADDRLP4 212
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 208
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $529
+JUMPV
+LABELV $544
+ADDRGP4 $546
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $529
+JUMPV
+LABELV $542
+ADDRGP4 $547
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $529
+JUMPV
+LABELV $528
+ADDRGP4 $535
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $541
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $547
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $529
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $548
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $550
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $552
+ADDRLP4 204
+CNSTI4 24
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ARGF4
+ADDRLP4 212
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 216
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 212
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 220
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $551
+JUMPV
+LABELV $552
+ADDRGP4 $555
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $551
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $556
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $558
+ADDRLP4 204
+CNSTI4 24
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ARGF4
+ADDRLP4 212
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $560
+ARGP4
+ADDRLP4 216
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 212
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 220
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $557
+JUMPV
+LABELV $558
+ADDRGP4 $561
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $557
+JUMPV
+LABELV $556
+ADDRGP4 $560
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $557
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $562
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $564
+ADDRLP4 204
+CNSTI4 24
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ARGF4
+ADDRLP4 212
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $566
+ARGP4
+ADDRLP4 216
+CNSTI4 40
+ASGNI4
+CNSTF4 1148846080
+ADDRLP4 212
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 220
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $564
+ADDRGP4 $566
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $562
+ADDRGP4 $567
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $548
+ADDRGP4 $555
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $561
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $567
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $549
+ADDRGP4 $568
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $569
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $173
+endproc CG_DrawCameraPointInfo 224 36
+proc CG_DrawQ3mmeCameraPointInfo 148 36
+ADDRGP4 cg_drawCameraPointInfo+12
+INDIRI4
+CNSTI4 0
+NEI4 $571
+ADDRGP4 $570
+JUMPV
+LABELV $571
+ADDRGP4 demo+4+64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $574
+ADDRGP4 $570
+JUMPV
+LABELV $574
+ADDRLP4 24
+ARGP4
+ADDRGP4 cg_drawCameraPointInfoColor
+ARGP4
+ADDRGP4 cg_drawCameraPointInfoAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 24+12
+INDIRF4
+CNSTF4 0
+GTF4 $578
+ADDRGP4 $570
+JUMPV
+LABELV $578
+ADDRGP4 QLWideScreen
+CNSTI4 1
+ASGNI4
+ADDRLP4 64
+ADDRGP4 cg_drawCameraPointInfoAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 cg_drawCameraPointInfoScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 cg_drawCameraPointInfoStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawCameraPointInfoFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $584
+ADDRLP4 44
+ADDRGP4 cgs+632912+1165544
+ASGNP4
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRLP4 44
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $585
+ADDRLP4 48
+ADDRGP4 cg_drawCameraPointInfoX+12
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 cg_drawCameraPointInfoY+12
+INDIRI4
+ASGNI4
+ADDRGP4 $201
+ARGP4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $599
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+GTI4 $602
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $602
+LABELV $603
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $600
+ADDRLP4 80
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 80
+INDIRU4
+EQU4 $605
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRLP4 80
+INDIRU4
+NEU4 $599
+LABELV $605
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_SPrintInit
+CALLV
+pop
+ADDRGP4 $606
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+GEI4 $607
+ADDRGP4 $275
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $608
+JUMPV
+LABELV $607
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $611
+ADDRGP4 $614
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $612
+JUMPV
+LABELV $611
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+LEI4 $616
+ADDRGP4 $280
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $617
+JUMPV
+LABELV $616
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $620
+ADDRGP4 $623
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $621
+JUMPV
+LABELV $620
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $625
+ADDRGP4 $623
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $626
+JUMPV
+LABELV $625
+ADDRGP4 $283
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $626
+LABELV $621
+LABELV $617
+LABELV $612
+LABELV $608
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $630
+ADDRGP4 $632
+ARGP4
+ADDRLP4 92
+CNSTI4 36
+ASGNI4
+ADDRLP4 96
+ADDRLP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $631
+JUMPV
+LABELV $630
+ADDRGP4 $633
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $631
+ADDRGP4 $634
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $635
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $404
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $367
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $640
+ADDRLP4 108
+ADDRGP4 $368
+ASGNP4
+ADDRGP4 $641
+JUMPV
+LABELV $640
+ADDRLP4 108
+ADDRGP4 $369
+ASGNP4
+LABELV $641
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $642
+ADDRLP4 112
+ADDRGP4 $371
+ASGNP4
+ADDRGP4 $643
+JUMPV
+LABELV $642
+ADDRLP4 112
+ADDRGP4 $369
+ASGNP4
+LABELV $643
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $644
+ADDRLP4 116
+ADDRGP4 $373
+ASGNP4
+ADDRGP4 $645
+JUMPV
+LABELV $644
+ADDRLP4 116
+ADDRGP4 $369
+ASGNP4
+LABELV $645
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $646
+ADDRLP4 120
+ADDRGP4 $375
+ASGNP4
+ADDRGP4 $647
+JUMPV
+LABELV $646
+ADDRLP4 120
+ADDRGP4 $369
+ASGNP4
+LABELV $647
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+NEU4 $648
+ADDRGP4 $650
+ARGP4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRGP4 $649
+JUMPV
+LABELV $648
+ADDRGP4 $651
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $649
+ADDRGP4 $652
+ARGP4
+ADDRGP4 demo+4+8
+INDIRI4
+ARGI4
+ADDRGP4 demo+4+8
+INDIRI4
+CNSTI4 -1
+NEI4 $659
+ADDRLP4 128
+ADDRGP4 $657
+ASGNP4
+ADDRGP4 $660
+JUMPV
+LABELV $659
+ADDRLP4 128
+ADDRGP4 $369
+ASGNP4
+LABELV $660
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+ADDRLP4 136
+ADDRGP4 demo+4+68
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $666
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+EQI4 $668
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+EQI4 $670
+ADDRGP4 $661
+JUMPV
+LABELV $666
+ADDRLP4 68
+ADDRGP4 $667
+ASGNP4
+ADDRGP4 $662
+JUMPV
+LABELV $668
+ADDRLP4 68
+ADDRGP4 $669
+ASGNP4
+ADDRGP4 $662
+JUMPV
+LABELV $670
+ADDRLP4 68
+ADDRGP4 $671
+ASGNP4
+ADDRGP4 $662
+JUMPV
+LABELV $661
+ADDRLP4 68
+ADDRGP4 $672
+ASGNP4
+LABELV $662
+ADDRGP4 $673
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRGP4 CG_SPrint
+CALLV
+pop
+LABELV $570
+endproc CG_DrawQ3mmeCameraPointInfo 148 36
+proc Wolfcam_DrawSpeed 88 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawSpeed+12
+INDIRI4
+CNSTI4 0
+NEI4 $675
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $674
+JUMPV
+LABELV $675
+ADDRLP4 40
+ARGP4
+ADDRGP4 cg_drawSpeedColor
+ARGP4
+ADDRGP4 cg_drawSpeedAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 64
+ADDRGP4 cg_drawSpeedAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_drawSpeedScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 cg_drawSpeedStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawSpeedWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawSpeedFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $682
+ADDRLP4 28
+ADDRGP4 cgs+632912+1078840
+ASGNP4
+ADDRGP4 $683
+JUMPV
+LABELV $682
+ADDRLP4 28
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $683
+ADDRLP4 56
+ADDRGP4 cg_drawSpeedX+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawSpeedY+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $690
+ADDRFP4 0
+ADDRGP4 cg_drawSpeedY+8
+INDIRF4
+ASGNF4
+ADDRGP4 $691
+JUMPV
+LABELV $690
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $691
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $694
+ADDRGP4 cg+3196784
+INDIRI4
+CNSTI4 0
+EQI4 $696
+ADDRGP4 cg+3196836
+INDIRF4
+ADDRGP4 cg+3196836
+INDIRF4
+MULF4
+ADDRGP4 cg+3196836+4
+INDIRF4
+ADDRGP4 cg+3196836+4
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 cg+3196836+8
+INDIRF4
+ADDRGP4 cg+3196836+8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRGP4 $695
+JUMPV
+LABELV $696
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $709
+ADDRGP4 cg+1332224+32
+INDIRF4
+ADDRGP4 cg+1332224+32
+INDIRF4
+MULF4
+ADDRGP4 cg+1332224+32+4
+INDIRF4
+ADDRGP4 cg+1332224+32+4
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 cg+1332224+32+8
+INDIRF4
+ADDRGP4 cg+1332224+32+8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRGP4 $695
+JUMPV
+LABELV $709
+ADDRLP4 20
+ADDRGP4 cg+627496
+INDIRF4
+ASGNF4
+ADDRGP4 $695
+JUMPV
+LABELV $694
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $729
+ADDRLP4 68
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 72
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 76
+INDIRF4
+MULF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRGP4 $730
+JUMPV
+LABELV $729
+ADDRLP4 68
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 72
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 72
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 76
+INDIRF4
+MULF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 84
+INDIRF4
+ASGNF4
+LABELV $730
+LABELV $695
+ADDRLP4 20
+INDIRF4
+CNSTF4 1145896960
+LTF4 $735
+ADDRLP4 36
+CNSTI4 6
+ASGNI4
+ADDRGP4 $736
+JUMPV
+LABELV $735
+ADDRLP4 20
+INDIRF4
+CNSTF4 1144258560
+LTF4 $737
+ADDRLP4 36
+CNSTI4 5
+ASGNI4
+ADDRGP4 $738
+JUMPV
+LABELV $737
+ADDRLP4 20
+INDIRF4
+CNSTF4 1142620160
+LTF4 $739
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $740
+JUMPV
+LABELV $739
+ADDRLP4 20
+INDIRF4
+CNSTF4 1140981760
+LTF4 $741
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRGP4 $742
+JUMPV
+LABELV $741
+ADDRLP4 20
+INDIRF4
+CNSTF4 1137836032
+LTF4 $743
+ADDRLP4 36
+CNSTI4 3
+ASGNI4
+ADDRGP4 $744
+JUMPV
+LABELV $743
+ADDRLP4 20
+INDIRF4
+CNSTF4 1134559232
+LTF4 $745
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRGP4 $746
+JUMPV
+LABELV $745
+ADDRLP4 36
+CNSTI4 7
+ASGNI4
+LABELV $746
+LABELV $744
+LABELV $742
+LABELV $740
+LABELV $738
+LABELV $736
+ADDRGP4 cg_drawSpeedChangeColor+12
+INDIRI4
+CNSTI4 0
+NEI4 $747
+ADDRLP4 36
+CNSTI4 7
+ASGNI4
+LABELV $747
+ADDRGP4 cg_drawSpeedNoText+12
+INDIRI4
+CNSTI4 0
+EQI4 $750
+ADDRGP4 $753
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $751
+JUMPV
+LABELV $750
+ADDRGP4 $754
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 68
+INDIRP4
+ASGNP4
+LABELV $751
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 16
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+CNSTF4 1094713344
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+CNSTF4 1094713344
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $674
+endproc Wolfcam_DrawSpeed 88 36
+proc CG_DrawJumpSpeeds 1084 36
+ADDRGP4 cg+5417524
+INDIRI4
+CNSTI4 0
+NEI4 $757
+ADDRGP4 $756
+JUMPV
+LABELV $757
+ADDRLP4 1032
+ARGP4
+ADDRGP4 cg_drawJumpSpeedsColor
+ARGP4
+ADDRGP4 cg_drawJumpSpeedsAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 1032+12
+INDIRF4
+CNSTF4 0
+GTF4 $760
+ADDRGP4 $756
+JUMPV
+LABELV $760
+ADDRLP4 1064
+ADDRGP4 cg_drawJumpSpeedsAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+ADDRGP4 cg_drawJumpSpeedsScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 1072
+ADDRGP4 cg_drawJumpSpeedsStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawJumpSpeedsWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawJumpSpeedsFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $767
+ADDRLP4 1052
+ADDRGP4 cgs+632912+1187220
+ASGNP4
+ADDRGP4 $768
+JUMPV
+LABELV $767
+ADDRLP4 1052
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $768
+ADDRLP4 1060
+ADDRGP4 cg_drawJumpSpeedsX+8
+INDIRF4
+ASGNF4
+ADDRLP4 1068
+ADDRGP4 cg_drawJumpSpeedsY+8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cg_drawJumpSpeedsNoText+12
+INDIRI4
+CNSTI4 0
+NEI4 $776
+ADDRLP4 4
+ARGP4
+ADDRGP4 $779
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $776
+ADDRLP4 1028
+ADDRGP4 cg_drawJumpSpeedsMax+12
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 256
+LTI4 $781
+ADDRLP4 1028
+CNSTI4 255
+ASGNI4
+LABELV $781
+ADDRLP4 0
+ADDRGP4 cg+5417524
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $789
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $789
+JUMPV
+LABELV $786
+ADDRGP4 $791
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+MODI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+5415476
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1080
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1080
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $787
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $789
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+5417524
+INDIRI4
+LTI4 $786
+ADDRLP4 1056
+ADDRLP4 4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRLP4 1048
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 1076
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 1
+NEI4 $793
+ADDRLP4 1060
+ADDRLP4 1060
+INDIRF4
+ADDRLP4 1076
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $794
+JUMPV
+LABELV $793
+ADDRLP4 1064
+INDIRI4
+CNSTI4 2
+NEI4 $795
+ADDRLP4 1060
+ADDRLP4 1060
+INDIRF4
+ADDRLP4 1076
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $795
+LABELV $794
+ADDRLP4 1060
+INDIRF4
+ARGF4
+ADDRLP4 1068
+INDIRF4
+ARGF4
+ADDRLP4 1048
+INDIRF4
+ARGF4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1072
+INDIRI4
+ARGI4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $756
+endproc CG_DrawJumpSpeeds 1084 36
+proc CG_DrawJumpSpeedsTime 1080 36
+ADDRGP4 cg+5417524
+INDIRI4
+CNSTI4 0
+NEI4 $798
+ADDRGP4 $797
+JUMPV
+LABELV $798
+ADDRLP4 1024
+ARGP4
+ADDRGP4 cg_drawJumpSpeedsTimeColor
+ARGP4
+ADDRGP4 cg_drawJumpSpeedsTimeAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 1024+12
+INDIRF4
+CNSTF4 0
+GTF4 $801
+ADDRGP4 $797
+JUMPV
+LABELV $801
+ADDRLP4 1056
+ADDRGP4 cg_drawJumpSpeedsTimeAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRGP4 cg_drawJumpSpeedsTimeScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 1064
+ADDRGP4 cg_drawJumpSpeedsTimeStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawJumpSpeedsTimeWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawJumpSpeedsTimeFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $808
+ADDRLP4 1044
+ADDRGP4 cgs+632912+1208896
+ASGNP4
+ADDRGP4 $809
+JUMPV
+LABELV $808
+ADDRLP4 1044
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $809
+ADDRLP4 1052
+ADDRGP4 cg_drawJumpSpeedsTimeX+8
+INDIRF4
+ASGNF4
+ADDRLP4 1060
+ADDRGP4 cg_drawJumpSpeedsTimeY+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI1 0
+ASGNI1
+ADDRGP4 cg_drawJumpSpeedsTimeNoText+12
+INDIRI4
+CNSTI4 0
+NEI4 $817
+ADDRLP4 0
+ARGP4
+ADDRGP4 $820
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $817
+ADDRGP4 $821
+ARGP4
+ADDRGP4 cg+5417524
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 256
+MODI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+5415476+4
+ADDP4
+INDIRI4
+ADDRGP4 cg+5417528
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 1072
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 cg_drawJumpSpeedsTimeNoText+12
+INDIRI4
+CNSTI4 0
+NEI4 $826
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $829
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $826
+ADDRLP4 1048
+ADDRLP4 0
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 1068
+ADDRLP4 1076
+INDIRF4
+ASGNF4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 1
+NEI4 $830
+ADDRLP4 1052
+ADDRLP4 1052
+INDIRF4
+ADDRLP4 1068
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $831
+JUMPV
+LABELV $830
+ADDRLP4 1056
+INDIRI4
+CNSTI4 2
+NEI4 $832
+ADDRLP4 1052
+ADDRLP4 1052
+INDIRF4
+ADDRLP4 1068
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $832
+LABELV $831
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1060
+INDIRF4
+ARGF4
+ADDRLP4 1040
+INDIRF4
+ARGF4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $797
+endproc CG_DrawJumpSpeedsTime 1080 36
+proc CG_DrawRaceTime 76 36
+ADDRGP4 cg_qlhud+12
+INDIRI4
+CNSTI4 0
+EQI4 $835
+ADDRGP4 $834
+JUMPV
+LABELV $835
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+EQI4 $838
+ADDRGP4 $834
+JUMPV
+LABELV $838
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $841
+ADDRGP4 cg_freecam_useTeamSettings+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $841
+ADDRGP4 $834
+JUMPV
+LABELV $841
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg_drawRaceTimeColor
+ARGP4
+ADDRGP4 cg_drawRaceTimeAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 0+12
+INDIRF4
+CNSTF4 0
+GTF4 $845
+ADDRGP4 $834
+JUMPV
+LABELV $845
+ADDRLP4 32
+ADDRGP4 cg_drawRaceTimeAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg_drawRaceTimeScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg_drawRaceTimeStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawRaceTimeWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawRaceTimeFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $852
+ADDRLP4 20
+ADDRGP4 cgs+632912+1230572
+ASGNP4
+ADDRGP4 $853
+JUMPV
+LABELV $852
+ADDRLP4 20
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $853
+ADDRLP4 28
+ADDRGP4 cg_drawRaceTimeX+8
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg_drawRaceTimeY+8
+INDIRF4
+ASGNF4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $861
+ADDRLP4 68
+CNSTI4 1496
+ASGNI4
+ADDRLP4 44
+ADDRLP4 68
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 68
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 68
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $862
+JUMPV
+LABELV $861
+ADDRLP4 44
+ADDRGP4 cg+607704+900+200
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cg+607704+900+192
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRGP4 cg+607704+900+208
+INDIRI4
+ASGNI4
+LABELV $862
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LEI4 $881
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_GetTimeString
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 cg_drawRaceTimeNoText+12
+INDIRI4
+CNSTI4 0
+EQI4 $884
+ADDRLP4 24
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $882
+JUMPV
+LABELV $884
+ADDRGP4 $887
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRGP4 $882
+JUMPV
+LABELV $881
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_GetTimeString
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 cg_drawRaceTimeNoText+12
+INDIRI4
+CNSTI4 0
+EQI4 $888
+ADDRLP4 24
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $889
+JUMPV
+LABELV $888
+ADDRGP4 $891
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 72
+INDIRP4
+ASGNP4
+LABELV $889
+LABELV $882
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+NEI4 $892
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 52
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $893
+JUMPV
+LABELV $892
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+NEI4 $894
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $894
+LABELV $893
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $834
+endproc CG_DrawRaceTime 76 36
+proc Wolfcam_DrawMouseSpeed 0 0
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $896
+endproc Wolfcam_DrawMouseSpeed 0 0
+proc Wolfcam_DrawFollowing 68 36
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $898
+ADDRGP4 $897
+JUMPV
+LABELV $898
+ADDRGP4 wolfcam_drawFollowing+12
+INDIRI4
+CNSTI4 0
+NEI4 $900
+ADDRGP4 $897
+JUMPV
+LABELV $900
+ADDRLP4 40
+ARGP4
+ADDRGP4 cg_drawFollowingColor
+ARGP4
+ADDRGP4 cg_drawFollowingAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 cg_drawFollowingAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg_drawFollowingScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg_drawFollowingStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawFollowingWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawFollowingFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $907
+ADDRLP4 8
+ADDRGP4 cgs+632912+970460
+ASGNP4
+ADDRGP4 $908
+JUMPV
+LABELV $907
+ADDRLP4 8
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $908
+CNSTI4 2392
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $914
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $915
+JUMPV
+LABELV $914
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $915
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $919
+ADDRLP4 60
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $917
+LABELV $919
+ADDRLP4 24
+ADDRGP4 $920
+ASGNP4
+ADDRGP4 $918
+JUMPV
+LABELV $917
+ADDRLP4 24
+ADDRGP4 $921
+ASGNP4
+LABELV $918
+ADDRGP4 wolfcam_drawFollowing+12
+INDIRI4
+CNSTI4 2
+NEI4 $922
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 2
+NEI4 $925
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 wcg+12
+INDIRI4
+NEI4 $928
+ADDRLP4 24
+ADDRGP4 $932
+ASGNP4
+ADDRGP4 $926
+JUMPV
+LABELV $928
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 wcg+20
+INDIRI4
+NEI4 $926
+ADDRLP4 24
+ADDRGP4 $937
+ASGNP4
+ADDRGP4 $926
+JUMPV
+LABELV $925
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 3
+NEI4 $938
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 wcg+20
+INDIRI4
+NEI4 $941
+ADDRLP4 24
+ADDRGP4 $937
+ASGNP4
+ADDRGP4 $942
+JUMPV
+LABELV $941
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 wcg+12
+INDIRI4
+NEI4 $945
+ADDRLP4 24
+ADDRGP4 $932
+ASGNP4
+LABELV $945
+LABELV $942
+LABELV $938
+LABELV $926
+LABELV $922
+ADDRGP4 wolfcam_drawFollowing+12
+INDIRI4
+CNSTI4 2
+NEI4 $949
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 1
+NEI4 $949
+ADDRGP4 wcg+12
+INDIRI4
+ADDRGP4 wcg+20
+INDIRI4
+NEI4 $953
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 wcg+12
+INDIRI4
+NEI4 $953
+ADDRGP4 wcg+16
+INDIRI4
+CNSTI4 -1
+LEI4 $954
+ADDRGP4 wcg+16
+INDIRI4
+ADDRGP4 wcg+24
+INDIRI4
+GEI4 $954
+ADDRLP4 24
+ADDRGP4 $932
+ASGNP4
+ADDRGP4 $954
+JUMPV
+LABELV $953
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 wcg+12
+INDIRI4
+NEI4 $964
+ADDRLP4 24
+ADDRGP4 $932
+ASGNP4
+ADDRGP4 $965
+JUMPV
+LABELV $964
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 wcg+20
+INDIRI4
+NEI4 $968
+ADDRLP4 24
+ADDRGP4 $937
+ASGNP4
+LABELV $968
+LABELV $965
+LABELV $954
+LABELV $949
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $972
+LABELV $972
+ADDRLP4 20
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ASGNP4
+ADDRGP4 wolfcam_drawFollowingOnlyName+12
+INDIRI4
+CNSTI4 0
+EQI4 $979
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $982
+ADDRGP4 $984
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRGP4 $980
+JUMPV
+LABELV $982
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ASGNP4
+ADDRGP4 $980
+JUMPV
+LABELV $979
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $991
+ADDRGP4 $993
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRGP4 $992
+JUMPV
+LABELV $991
+ADDRGP4 $997
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+ASGNP4
+LABELV $992
+LABELV $980
+ADDRLP4 12
+ADDRGP4 cg_drawFollowingX+8
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg_drawFollowingY+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $1003
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $1004
+JUMPV
+LABELV $1003
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $1005
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1005
+LABELV $1004
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $897
+endproc Wolfcam_DrawFollowing 68 36
+proc CG_DrawCpmaMvdIndicator 56 36
+ADDRGP4 cg_drawCpmaMvdIndicator+12
+INDIRI4
+CNSTI4 0
+NEI4 $1008
+ADDRGP4 $1007
+JUMPV
+LABELV $1008
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1011
+ADDRGP4 $1007
+JUMPV
+LABELV $1011
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1013
+ADDRGP4 $1007
+JUMPV
+LABELV $1013
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRGP4 cg+4
+INDIRI4
+EQI4 $1016
+ADDRGP4 $1007
+JUMPV
+LABELV $1016
+ADDRLP4 48
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $1020
+ADDRGP4 $1007
+JUMPV
+LABELV $1020
+ADDRLP4 28
+ARGP4
+ADDRGP4 cg_drawCpmaMvdIndicatorColor
+ARGP4
+ADDRGP4 cg_drawCpmaMvdIndicatorAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 cg_drawCpmaMvdIndicatorAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg_drawCpmaMvdIndicatorScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 cg_drawCpmaMvdIndicatorStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawCpmaMvdIndicatorWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawCpmaMvdIndicatorFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1026
+ADDRLP4 8
+ADDRGP4 cgs+632912+992136
+ASGNP4
+ADDRGP4 $1027
+JUMPV
+LABELV $1026
+ADDRLP4 8
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $1027
+ADDRLP4 0
+ADDRGP4 $1033
+ASGNP4
+ADDRLP4 12
+ADDRGP4 cg_drawCpmaMvdIndicatorX+8
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 cg_drawCpmaMvdIndicatorY+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $1036
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $1037
+JUMPV
+LABELV $1036
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $1038
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1038
+LABELV $1037
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $1007
+endproc CG_DrawCpmaMvdIndicator 56 36
+lit
+align 1
+LABELV $1067
+byte 1 0
+byte 1 0
+byte 1 0
+byte 1 0
+byte 1 0
+export CG_Text_Pic_Width
+code
+proc CG_Text_Pic_Width 21864 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 cg_qlFontScaling+12
+INDIRI4
+CNSTI4 0
+EQI4 $1041
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cgDC+236+12
+CVPU4 4
+NEU4 $1041
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $1046
+ADDRLP4 0
+ADDRGP4 cgDC+236+21680
+ASGNP4
+ADDRGP4 $1047
+JUMPV
+LABELV $1046
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $1051
+ADDRLP4 0
+ADDRGP4 cgDC+236+43348
+ASGNP4
+LABELV $1051
+LABELV $1047
+LABELV $1041
+ADDRLP4 112
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1058
+ARGP4
+ADDRLP4 21784
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 21784
+INDIRI4
+CNSTI4 0
+NEI4 $1056
+ADDRLP4 112
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $1057
+JUMPV
+LABELV $1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1061
+ARGP4
+ADDRLP4 21788
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 21788
+INDIRI4
+CNSTI4 0
+NEI4 $1059
+ADDRLP4 112
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $1060
+JUMPV
+LABELV $1059
+ADDRLP4 0
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1064
+ARGP4
+ADDRLP4 21792
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 21792
+INDIRI4
+CNSTI4 0
+NEI4 $1062
+ADDRLP4 112
+CNSTF4 1073741824
+ASGNF4
+LABELV $1062
+LABELV $1060
+LABELV $1057
+ADDRLP4 108
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 21528
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 21800
+ADDRGP4 CG_ScaleFont
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 21800
+INDIRP4
+ASGNP4
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1065
+ADDRLP4 21812
+ADDRGP4 $1067
+INDIRB
+ASGNB 5
+ADDRLP4 21804
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1069
+JUMPV
+LABELV $1068
+ADDRLP4 21804
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1071
+ADDRGP4 $1070
+JUMPV
+LABELV $1071
+ADDRLP4 21828
+ADDRLP4 21804
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 21828
+INDIRI4
+CNSTI4 0
+LTI4 $1075
+ADDRLP4 21828
+INDIRI4
+CNSTI4 255
+LEI4 $1073
+LABELV $1075
+ADDRLP4 21804
+ADDRLP4 21804
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1069
+JUMPV
+LABELV $1073
+ADDRLP4 21804
+ADDRLP4 21804
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1069
+ADDRGP4 $1068
+JUMPV
+LABELV $1070
+ADDRLP4 104
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 21804
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 21828
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 21828
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 21828
+INDIRI4
+ASGNI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1076
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $1079
+ADDRLP4 100
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LTI4 $1081
+ADDRGP4 $1078
+JUMPV
+LABELV $1081
+LABELV $1079
+ADDRLP4 21832
+ADDRLP4 21804
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 21832
+INDIRI4
+CNSTI4 0
+LTI4 $1085
+ADDRLP4 21832
+INDIRI4
+CNSTI4 255
+LEI4 $1083
+LABELV $1085
+ADDRLP4 21804
+INDIRP4
+INDIRI4
+CNSTI4 256
+NEI4 $1086
+ADDRLP4 96
+ADDRLP4 96
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1087
+JUMPV
+LABELV $1086
+ADDRLP4 21804
+INDIRP4
+INDIRI4
+CNSTI4 259
+NEI4 $1088
+ADDRGP4 $1089
+JUMPV
+LABELV $1088
+ADDRLP4 21804
+INDIRP4
+INDIRI4
+CNSTI4 261
+NEI4 $1090
+ADDRLP4 21804
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+ARGP4
+ADDRLP4 21836
+ADDRGP4 trap_R_GetFontInfo
+CALLI4
+ASGNI4
+ADDRLP4 21836
+INDIRI4
+CNSTI4 0
+NEI4 $1092
+ADDRGP4 $1094
+ARGP4
+ADDRLP4 21804
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $1093
+JUMPV
+LABELV $1092
+ADDRLP4 0
+ADDRLP4 116
+ASGNP4
+LABELV $1093
+ADDRGP4 cg_qlFontScaling+12
+INDIRI4
+CNSTI4 0
+EQI4 $1095
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cgDC+236+12
+CVPU4 4
+NEU4 $1095
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $1100
+ADDRLP4 0
+ADDRGP4 cgDC+236+21680
+ASGNP4
+ADDRGP4 $1101
+JUMPV
+LABELV $1100
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $1105
+ADDRLP4 0
+ADDRGP4 cgDC+236+43348
+ASGNP4
+LABELV $1105
+LABELV $1101
+LABELV $1095
+ADDRLP4 112
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1058
+ARGP4
+ADDRLP4 21840
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 21840
+INDIRI4
+CNSTI4 0
+NEI4 $1110
+ADDRLP4 112
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $1111
+JUMPV
+LABELV $1110
+ADDRLP4 0
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1061
+ARGP4
+ADDRLP4 21844
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 21844
+INDIRI4
+CNSTI4 0
+NEI4 $1112
+ADDRLP4 112
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $1113
+JUMPV
+LABELV $1112
+ADDRLP4 0
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1064
+ARGP4
+ADDRLP4 21848
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 21848
+INDIRI4
+CNSTI4 0
+NEI4 $1114
+ADDRLP4 112
+CNSTF4 1073741824
+ASGNF4
+LABELV $1114
+LABELV $1113
+LABELV $1111
+ADDRLP4 108
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 21528
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 21856
+ADDRGP4 CG_ScaleFont
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 21856
+INDIRP4
+ASGNP4
+ADDRGP4 $1091
+JUMPV
+LABELV $1090
+ADDRLP4 21804
+INDIRP4
+INDIRI4
+CNSTI4 262
+NEI4 $1116
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 21804
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 108
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 21528
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 21840
+ADDRGP4 CG_ScaleFont
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 21840
+INDIRP4
+ASGNP4
+ADDRGP4 $1117
+JUMPV
+LABELV $1116
+ADDRLP4 21804
+INDIRP4
+INDIRI4
+CNSTI4 263
+NEI4 $1118
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ADDRLP4 21804
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1118
+LABELV $1119
+LABELV $1117
+LABELV $1091
+LABELV $1089
+LABELV $1087
+ADDRLP4 21804
+ADDRLP4 21804
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1083
+ADDRLP4 21812
+ADDRLP4 21804
+INDIRP4
+INDIRI4
+CNSTI4 255
+BANDI4
+CVII1 4
+ASGNI1
+ADDRLP4 21804
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1120
+ADDRLP4 21812+1
+ADDRLP4 21804
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 255
+BANDI4
+CVII1 4
+ASGNI1
+ADDRLP4 21804
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1123
+ADDRLP4 21812+2
+ADDRLP4 21804
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 255
+BANDI4
+CVII1 4
+ASGNI1
+ADDRLP4 21804
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1126
+ADDRLP4 21812+3
+ADDRLP4 21804
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 255
+BANDI4
+CVII1 4
+ASGNI1
+LABELV $1126
+LABELV $1123
+LABELV $1120
+ADDRLP4 21808
+CNSTI4 0
+ASGNI4
+ADDRLP4 21812
+ARGP4
+ADDRLP4 21808
+ARGP4
+ADDRLP4 21824
+ARGP4
+ADDRLP4 21840
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+ASGNI4
+ADDRLP4 21820
+ADDRLP4 21840
+INDIRI4
+ASGNI4
+ADDRLP4 21808
+INDIRI4
+CNSTI4 1
+LEI4 $1129
+LABELV $1129
+ADDRLP4 21824
+INDIRI4
+CNSTI4 0
+EQI4 $1131
+ADDRLP4 21844
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1133
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1135
+JUMPV
+LABELV $1134
+ADDRGP4 $1137
+ARGP4
+ADDRLP4 21844
+INDIRP4
+INDIRI4
+CNSTI4 255
+BANDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 21844
+ADDRLP4 21844
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+LABELV $1135
+ADDRLP4 21844
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1134
+LABELV $1131
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 21820
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_GetGlyphInfo
+CALLI4
+pop
+ADDRLP4 21804
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1138
+ADDRLP4 21804
+INDIRP4
+INDIRI4
+CNSTI4 94
+NEI4 $1138
+ADDRLP4 21848
+ADDRLP4 21804
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 21848
+INDIRI4
+CNSTI4 0
+EQI4 $1138
+ADDRLP4 21848
+INDIRI4
+CNSTI4 65
+LTI4 $1141
+ADDRLP4 21848
+INDIRI4
+CNSTI4 90
+LEI4 $1140
+LABELV $1141
+ADDRLP4 21852
+ADDRLP4 21804
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 21852
+INDIRI4
+CNSTI4 97
+LTI4 $1142
+ADDRLP4 21852
+INDIRI4
+CNSTI4 122
+LEI4 $1140
+LABELV $1142
+ADDRLP4 21856
+ADDRLP4 21804
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 21856
+INDIRI4
+CNSTI4 48
+LTI4 $1138
+ADDRLP4 21856
+INDIRI4
+CNSTI4 57
+GTI4 $1138
+LABELV $1140
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $1143
+ADDRLP4 21860
+ADDRLP4 21804
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 21860
+INDIRI4
+CNSTI4 120
+EQI4 $1148
+ADDRLP4 21860
+INDIRI4
+CNSTI4 88
+NEI4 $1146
+LABELV $1148
+ADDRLP4 21804
+ADDRLP4 21804
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1146
+ADDRLP4 21804
+ADDRLP4 21804
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1143
+ADDRLP4 21804
+ADDRLP4 21804
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1138
+ADDRLP4 96
+ADDRLP4 96
+INDIRF4
+ADDRLP4 12+20
+INDIRI4
+CVIF4 4
+ADDRLP4 108
+INDIRF4
+MULF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 21860
+ADDRLP4 21808
+INDIRI4
+ASGNI4
+ADDRLP4 21804
+ADDRLP4 21860
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 21804
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 21860
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1077
+ADDRLP4 21804
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1151
+ADDRLP4 21804
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1151
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+LTI4 $1076
+LABELV $1151
+LABELV $1078
+LABELV $1065
+ADDRLP4 96
+INDIRF4
+RETF4
+LABELV $1040
+endproc CG_Text_Pic_Width 21864 12
+proc CG_Text_Width_orig 180 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 cg_qlFontScaling+12
+INDIRI4
+CNSTI4 0
+EQI4 $1153
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRGP4 cgDC+236+12
+CVPU4 4
+NEU4 $1153
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $1158
+ADDRLP4 8
+ADDRGP4 cgDC+236+21680
+ASGNP4
+ADDRGP4 $1159
+JUMPV
+LABELV $1158
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $1163
+ADDRLP4 8
+ADDRGP4 cgDC+236+43348
+ASGNP4
+LABELV $1163
+LABELV $1159
+LABELV $1153
+ADDRLP4 112
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1058
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $1168
+ADDRLP4 112
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $1169
+JUMPV
+LABELV $1168
+ADDRLP4 8
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1061
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $1170
+ADDRLP4 112
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $1171
+JUMPV
+LABELV $1170
+ADDRLP4 8
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1064
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $1172
+ADDRLP4 112
+CNSTF4 1073741824
+ASGNF4
+LABELV $1172
+LABELV $1171
+LABELV $1169
+ADDRLP4 108
+ADDRFP4 4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 21528
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 132
+ADDRGP4 CG_ScaleFont
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 104
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1174
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16
+ADDRLP4 136
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $1177
+JUMPV
+LABELV $1176
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $1179
+ADDRLP4 12
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $1181
+ADDRGP4 $1178
+JUMPV
+LABELV $1181
+LABELV $1179
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1183
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $1183
+ADDRLP4 148
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $1183
+ADDRLP4 148
+INDIRI4
+CNSTI4 65
+LTI4 $1186
+ADDRLP4 148
+INDIRI4
+CNSTI4 90
+LEI4 $1185
+LABELV $1186
+ADDRLP4 152
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 97
+LTI4 $1187
+ADDRLP4 152
+INDIRI4
+CNSTI4 122
+LEI4 $1185
+LABELV $1187
+ADDRLP4 156
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 48
+LTI4 $1183
+ADDRLP4 156
+INDIRI4
+CNSTI4 57
+GTI4 $1183
+LABELV $1185
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $1188
+ADDRLP4 160
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 120
+EQI4 $1193
+ADDRLP4 160
+INDIRI4
+CNSTI4 88
+NEI4 $1191
+LABELV $1193
+ADDRLP4 164
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 164
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1177
+JUMPV
+LABELV $1191
+ADDRLP4 164
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 164
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1177
+JUMPV
+LABELV $1188
+ADDRLP4 160
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1177
+JUMPV
+LABELV $1183
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRLP4 172
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+LEI4 $1194
+LABELV $1194
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $1196
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1198
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1200
+JUMPV
+LABELV $1199
+ADDRGP4 $1137
+ARGP4
+ADDRLP4 176
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 176
+ADDRLP4 176
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1200
+ADDRLP4 176
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1199
+LABELV $1196
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_R_GetGlyphInfo
+CALLI4
+pop
+ADDRLP4 104
+ADDRLP4 104
+INDIRF4
+ADDRLP4 20+20
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 176
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1177
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1204
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1204
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $1176
+LABELV $1204
+LABELV $1178
+LABELV $1174
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRF4
+MULF4
+ADDRLP4 112
+INDIRF4
+MULF4
+RETF4
+LABELV $1152
+endproc CG_Text_Width_orig 180 12
+export CG_Text_Width
+proc CG_Text_Width 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 CG_Text_Width_orig
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $1205
+endproc CG_Text_Width 4 16
+export CG_Text_Width_old
+proc CG_Text_Width_old 8 16
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $1207
+ADDRLP4 0
+ADDRGP4 cgDC+236+12
+ASGNP4
+ADDRGP4 $1208
+JUMPV
+LABELV $1207
+ADDRLP4 0
+CNSTI4 21668
+ADDRFP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgDC+236+65016
+ADDP4
+ASGNP4
+LABELV $1208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $1206
+endproc CG_Text_Width_old 8 16
+proc CG_Text_Height_orig 180 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 cg_qlFontScaling+12
+INDIRI4
+CNSTI4 0
+EQI4 $1214
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRGP4 cgDC+236+12
+CVPU4 4
+NEU4 $1214
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $1219
+ADDRLP4 8
+ADDRGP4 cgDC+236+21680
+ASGNP4
+ADDRGP4 $1220
+JUMPV
+LABELV $1219
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $1224
+ADDRLP4 8
+ADDRGP4 cgDC+236+43348
+ASGNP4
+LABELV $1224
+LABELV $1220
+LABELV $1214
+ADDRLP4 112
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1058
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $1229
+ADDRLP4 112
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $1230
+JUMPV
+LABELV $1229
+ADDRLP4 8
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1061
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $1231
+ADDRGP4 $1232
+JUMPV
+LABELV $1231
+ADDRLP4 8
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1064
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $1233
+ADDRLP4 112
+CNSTF4 1077936128
+ASGNF4
+LABELV $1233
+LABELV $1232
+LABELV $1230
+ADDRLP4 108
+ADDRFP4 4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 21528
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 132
+ADDRGP4 CG_ScaleFont
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1235
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 100
+ADDRLP4 136
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $1237
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $1240
+ADDRLP4 104
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $1242
+ADDRGP4 $1239
+JUMPV
+LABELV $1242
+LABELV $1240
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1244
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $1244
+ADDRLP4 148
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $1244
+ADDRLP4 148
+INDIRI4
+CNSTI4 65
+LTI4 $1247
+ADDRLP4 148
+INDIRI4
+CNSTI4 90
+LEI4 $1246
+LABELV $1247
+ADDRLP4 152
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 97
+LTI4 $1248
+ADDRLP4 152
+INDIRI4
+CNSTI4 122
+LEI4 $1246
+LABELV $1248
+ADDRLP4 156
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 48
+LTI4 $1244
+ADDRLP4 156
+INDIRI4
+CNSTI4 57
+GTI4 $1244
+LABELV $1246
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $1249
+ADDRLP4 160
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 120
+EQI4 $1254
+ADDRLP4 160
+INDIRI4
+CNSTI4 88
+NEI4 $1252
+LABELV $1254
+ADDRLP4 164
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 164
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $1252
+ADDRLP4 164
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 164
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $1249
+ADDRLP4 160
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $1244
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRLP4 172
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $1255
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1198
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1258
+JUMPV
+LABELV $1257
+ADDRGP4 $1137
+ARGP4
+ADDRLP4 176
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 176
+ADDRLP4 176
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1258
+ADDRLP4 176
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1257
+LABELV $1255
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_GetGlyphInfo
+CALLI4
+pop
+ADDRLP4 96
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+GEF4 $1260
+ADDRLP4 96
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1260
+ADDRLP4 176
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 176
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 104
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1238
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1263
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1263
+ADDRLP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+LTI4 $1237
+LABELV $1263
+LABELV $1239
+LABELV $1235
+ADDRLP4 96
+INDIRF4
+ADDRLP4 108
+INDIRF4
+MULF4
+ADDRLP4 112
+INDIRF4
+MULF4
+RETF4
+LABELV $1213
+endproc CG_Text_Height_orig 180 12
+export CG_Text_Height
+proc CG_Text_Height 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 CG_Text_Height_orig
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $1264
+endproc CG_Text_Height 4 16
+export CG_Text_Height_old
+proc CG_Text_Height_old 8 16
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $1266
+ADDRLP4 0
+ADDRGP4 cgDC+236+12
+ASGNP4
+ADDRGP4 $1267
+JUMPV
+LABELV $1266
+ADDRLP4 0
+CNSTI4 21668
+ADDRFP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgDC+236+65016
+ADDP4
+ASGNP4
+LABELV $1267
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $1265
+endproc CG_Text_Height_old 8 16
+export CG_Text_PaintChar
+proc CG_Text_PaintChar 12 36
+ADDRLP4 8
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $1272
+endproc CG_Text_PaintChar 12 36
+export CG_Text_PaintCharScale
+proc CG_Text_PaintCharScale 8 36
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $1273
+endproc CG_Text_PaintCharScale 8 36
+bss
+align 4
+LABELV $1275
+skip 21668
+export CG_ScaleFont
+code
+proc CG_ScaleFont 28 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_autoFontScaling+12
+INDIRI4
+CNSTI4 0
+NEI4 $1276
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $1274
+JUMPV
+LABELV $1276
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1279
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $1274
+JUMPV
+LABELV $1279
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+LEF4 $1283
+ADDRLP4 4
+INDIRF4
+CNSTF4 1073741824
+LTF4 $1281
+LABELV $1283
+ADDRGP4 $1275
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 21668
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+GEI4 $1284
+ADDRLP4 8
+CNSTI4 6
+ASGNI4
+ADDRGP4 $1285
+JUMPV
+LABELV $1284
+ADDRLP4 8
+INDIRI4
+CNSTI4 24
+GEI4 $1286
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRGP4 $1287
+JUMPV
+LABELV $1286
+ADDRLP4 8
+INDIRI4
+CNSTI4 48
+GEI4 $1288
+ADDRLP4 8
+CNSTI4 24
+ASGNI4
+ADDRGP4 $1289
+JUMPV
+LABELV $1288
+ADDRLP4 8
+INDIRI4
+CNSTI4 96
+GEI4 $1290
+ADDRLP4 8
+CNSTI4 48
+ASGNI4
+ADDRGP4 $1291
+JUMPV
+LABELV $1290
+ADDRLP4 8
+INDIRI4
+CNSTI4 192
+GEI4 $1292
+ADDRLP4 8
+CNSTI4 96
+ASGNI4
+ADDRGP4 $1293
+JUMPV
+LABELV $1292
+ADDRLP4 8
+CNSTI4 192
+ASGNI4
+LABELV $1293
+LABELV $1291
+LABELV $1289
+LABELV $1287
+LABELV $1285
+ADDRLP4 0
+ADDRGP4 cg_autoFontScalingThreshold+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+GEI4 $1295
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1295
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GEI4 $1297
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1297
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1301
+ADDRLP4 20
+ADDRGP4 $1299
+ASGNP4
+ADDRGP4 $1302
+JUMPV
+LABELV $1301
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 21596
+ADDP4
+ASGNP4
+LABELV $1302
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1275
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $1275+21532
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1303
+ADDRGP4 $1306
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 21596
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1304
+JUMPV
+LABELV $1303
+ADDRFP4 0
+ADDRGP4 $1275
+ASGNP4
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+LABELV $1304
+LABELV $1281
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $1274
+endproc CG_ScaleFont 28 16
+export CG_Text_Paint
+proc CG_Text_Paint 232 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRFP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 cg_qlFontScaling+12
+INDIRI4
+CNSTI4 0
+EQI4 $1308
+ADDRLP4 104
+INDIRP4
+CVPU4 4
+ADDRGP4 cgDC+236+12
+CVPU4 4
+NEU4 $1308
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $1313
+ADDRLP4 104
+ADDRGP4 cgDC+236+21680
+ASGNP4
+ADDRGP4 $1314
+JUMPV
+LABELV $1313
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $1318
+ADDRLP4 104
+ADDRGP4 cgDC+236+43348
+ASGNP4
+LABELV $1318
+LABELV $1314
+LABELV $1308
+ADDRLP4 128
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 108
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1058
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $1323
+ADDRLP4 136
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 108
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRGP4 $1324
+JUMPV
+LABELV $1323
+ADDRLP4 104
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1061
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $1325
+ADDRLP4 108
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $1326
+JUMPV
+LABELV $1325
+ADDRLP4 104
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1064
+ARGP4
+ADDRLP4 140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $1327
+ADDRLP4 108
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 116
+CNSTF4 1077936128
+ASGNF4
+LABELV $1327
+LABELV $1326
+LABELV $1324
+ADDRLP4 84
+ADDRFP4 8
+INDIRF4
+ADDRLP4 104
+INDIRP4
+CNSTI4 21528
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 148
+ADDRGP4 CG_ScaleFont
+CALLP4
+ASGNP4
+ADDRLP4 104
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1329
+ADDRLP4 152
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 88
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 120
+ADDRLP4 156
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRGP4 $1332
+JUMPV
+LABELV $1331
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+LEI4 $1334
+ADDRLP4 124
+INDIRI4
+ADDRFP4 24
+INDIRI4
+LTI4 $1336
+ADDRGP4 $1333
+JUMPV
+LABELV $1336
+LABELV $1334
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRLP4 176
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+ASGNI4
+ADDRLP4 168
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 1
+LEI4 $1338
+LABELV $1338
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $1340
+ADDRLP4 180
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $1342
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1344
+JUMPV
+LABELV $1343
+ADDRGP4 $1137
+ARGP4
+ADDRLP4 180
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 180
+ADDRLP4 180
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1344
+ADDRLP4 180
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1343
+LABELV $1340
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_GetGlyphInfo
+CALLI4
+pop
+ADDRLP4 152
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1346
+ADDRLP4 152
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $1346
+ADDRLP4 184
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $1346
+ADDRLP4 184
+INDIRI4
+CNSTI4 65
+LTI4 $1349
+ADDRLP4 184
+INDIRI4
+CNSTI4 90
+LEI4 $1348
+LABELV $1349
+ADDRLP4 188
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 97
+LTI4 $1350
+ADDRLP4 188
+INDIRI4
+CNSTI4 122
+LEI4 $1348
+LABELV $1350
+ADDRLP4 192
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 48
+LTI4 $1346
+ADDRLP4 192
+INDIRI4
+CNSTI4 57
+GTI4 $1346
+LABELV $1348
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1351
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 CG_CpmaColorFromString
+CALLV
+pop
+ADDRGP4 $1352
+JUMPV
+LABELV $1351
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $1354
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 CG_OspColorFromString
+CALLV
+pop
+ADDRGP4 $1355
+JUMPV
+LABELV $1354
+ADDRLP4 88
+ARGP4
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1355
+LABELV $1352
+ADDRLP4 88+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 55
+NEI4 $1358
+ADDRLP4 88
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $1358
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $1360
+ADDRLP4 196
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 120
+EQI4 $1365
+ADDRLP4 196
+INDIRI4
+CNSTI4 88
+NEI4 $1363
+LABELV $1365
+ADDRLP4 200
+CNSTI4 8
+ASGNI4
+ADDRLP4 152
+ADDRLP4 152
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 112
+INDIRI4
+ADDRLP4 200
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1332
+JUMPV
+LABELV $1363
+ADDRLP4 200
+CNSTI4 2
+ASGNI4
+ADDRLP4 152
+ADDRLP4 152
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 112
+INDIRI4
+ADDRLP4 200
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1332
+JUMPV
+LABELV $1360
+ADDRLP4 196
+CNSTI4 2
+ASGNI4
+ADDRLP4 152
+ADDRLP4 152
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 112
+INDIRI4
+ADDRLP4 196
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1332
+JUMPV
+LABELV $1346
+ADDRLP4 196
+ADDRLP4 84
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 84
+INDIRF4
+ADDRLP4 108
+INDIRF4
+MULF4
+ADDRLP4 0+16
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+EQI4 $1370
+ADDRFP4 28
+INDIRI4
+CNSTI4 6
+NEI4 $1368
+LABELV $1370
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $1372
+ADDRLP4 220
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1373
+JUMPV
+LABELV $1372
+ADDRLP4 220
+CNSTI4 2
+ASGNI4
+LABELV $1373
+ADDRLP4 216
+ADDRLP4 220
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRLP4 212
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRLP4 224
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 208
+INDIRF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 108
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 212
+ADDRLP4 212
+INDIRF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $1374
+ADDRLP4 208
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1376
+ADDRLP4 208
+CNSTF4 1065353216
+ASGNF4
+LABELV $1376
+ADDRLP4 212
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1375
+ADDRLP4 212
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1375
+JUMPV
+LABELV $1374
+ADDRFP4 28
+INDIRI4
+CNSTI4 6
+NEI4 $1380
+ADDRLP4 208
+INDIRF4
+CNSTF4 1073741824
+GEF4 $1382
+ADDRLP4 208
+CNSTF4 1073741824
+ASGNF4
+LABELV $1382
+ADDRLP4 212
+INDIRF4
+CNSTF4 1073741824
+GEF4 $1384
+ADDRLP4 212
+CNSTF4 1073741824
+ASGNF4
+LABELV $1384
+LABELV $1380
+LABELV $1375
+ADDRGP4 colorBlack+12
+ADDRLP4 88+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ADDRLP4 200
+INDIRF4
+ADDF4
+ADDRLP4 208
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+ADDRLP4 212
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 0+24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0+28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 228
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 228
+INDIRF4
+ADDRLP4 108
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 228
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0+32
+INDIRF4
+ARGF4
+ADDRLP4 0+36
+INDIRF4
+ARGF4
+ADDRLP4 0+40
+INDIRF4
+ARGF4
+ADDRLP4 0+44
+INDIRF4
+ARGF4
+ADDRLP4 0+48
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintCharScale
+CALLV
+pop
+ADDRGP4 colorBlack+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1368
+ADDRFP4 0
+INDIRF4
+ADDRLP4 200
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0+24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0+28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 208
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 108
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0+32
+INDIRF4
+ARGF4
+ADDRLP4 0+36
+INDIRF4
+ARGF4
+ADDRLP4 0+40
+INDIRF4
+ARGF4
+ADDRLP4 0+44
+INDIRF4
+ARGF4
+ADDRLP4 0+48
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintCharScale
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0+20
+INDIRI4
+CVIF4 4
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDRLP4 108
+INDIRF4
+MULF4
+ADDRFP4 20
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 212
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 212
+INDIRI4
+ADDRLP4 152
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 112
+INDIRI4
+ADDRLP4 212
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1332
+ADDRLP4 152
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1405
+ADDRLP4 152
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1405
+ADDRLP4 112
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LTI4 $1331
+LABELV $1405
+LABELV $1333
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1329
+LABELV $1307
+endproc CG_Text_Paint 232 44
+export CG_PrintPicString
+proc CG_PrintPicString 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1408
+JUMPV
+LABELV $1407
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1410
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+GTI4 $1410
+ADDRGP4 $1412
+ARGP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1411
+JUMPV
+LABELV $1410
+ADDRGP4 $1413
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $1408
+JUMPV
+LABELV $1411
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+LABELV $1408
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1414
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1407
+LABELV $1414
+ADDRGP4 $1415
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1406
+endproc CG_PrintPicString 8 12
+lit
+align 1
+LABELV $1505
+byte 1 0
+byte 1 0
+byte 1 0
+byte 1 0
+byte 1 0
+export CG_Text_Pic_Paint
+code
+proc CG_Text_Pic_Paint 21904 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 132
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_qlFontScaling+12
+INDIRI4
+CNSTI4 0
+EQI4 $1417
+ADDRLP4 112
+INDIRP4
+CVPU4 4
+ADDRGP4 cgDC+236+12
+CVPU4 4
+NEU4 $1417
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $1422
+ADDRLP4 112
+ADDRGP4 cgDC+236+21680
+ASGNP4
+ADDRGP4 $1423
+JUMPV
+LABELV $1422
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $1427
+ADDRLP4 112
+ADDRGP4 cgDC+236+43348
+ASGNP4
+LABELV $1427
+LABELV $1423
+LABELV $1417
+ADDRLP4 21804
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 104
+ADDRLP4 21804
+INDIRF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 21804
+INDIRF4
+ASGNF4
+ADDRLP4 112
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1058
+ARGP4
+ADDRLP4 21808
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 21808
+INDIRI4
+CNSTI4 0
+NEI4 $1432
+ADDRLP4 21812
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 104
+ADDRLP4 21812
+INDIRF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 21812
+INDIRF4
+ASGNF4
+ADDRGP4 $1433
+JUMPV
+LABELV $1432
+ADDRLP4 112
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1061
+ARGP4
+ADDRLP4 21812
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 21812
+INDIRI4
+CNSTI4 0
+NEI4 $1434
+ADDRLP4 104
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $1435
+JUMPV
+LABELV $1434
+ADDRLP4 112
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1064
+ARGP4
+ADDRLP4 21816
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 21816
+INDIRI4
+CNSTI4 0
+NEI4 $1436
+ADDRLP4 104
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 116
+CNSTF4 1077936128
+ASGNF4
+LABELV $1436
+LABELV $1435
+LABELV $1433
+ADDRLP4 84
+ADDRFP4 8
+INDIRF4
+ADDRLP4 112
+INDIRP4
+CNSTI4 21528
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 21824
+ADDRGP4 CG_ScaleFont
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 21824
+INDIRP4
+ASGNP4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1438
+ADDRLP4 21828
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 88
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1441
+JUMPV
+LABELV $1440
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1443
+ADDRGP4 $1442
+JUMPV
+LABELV $1443
+ADDRLP4 21844
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 21844
+INDIRI4
+CNSTI4 0
+LTI4 $1447
+ADDRLP4 21844
+INDIRI4
+CNSTI4 255
+LEI4 $1445
+LABELV $1447
+ADDRLP4 21828
+ADDRLP4 21828
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 120
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $1441
+JUMPV
+LABELV $1445
+ADDRLP4 21828
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 120
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1441
+ADDRGP4 $1440
+JUMPV
+LABELV $1442
+ADDRLP4 124
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 21828
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 21844
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+ADDRLP4 21844
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 21844
+INDIRI4
+ASGNI4
+ADDRGP4 $1449
+JUMPV
+LABELV $1448
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+LEI4 $1451
+ADDRLP4 128
+INDIRI4
+ADDRFP4 24
+INDIRI4
+LTI4 $1453
+ADDRGP4 $1450
+JUMPV
+LABELV $1453
+LABELV $1451
+ADDRLP4 21848
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 21848
+INDIRI4
+CNSTI4 0
+LTI4 $1457
+ADDRLP4 21848
+INDIRI4
+CNSTI4 255
+LEI4 $1455
+LABELV $1457
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+CNSTI4 256
+NEI4 $1458
+ADDRGP4 cg_fragIconHeightFixed+12
+INDIRI4
+CNSTI4 0
+EQI4 $1460
+ADDRGP4 $1463
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 21868
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 21856
+ADDRLP4 21868
+INDIRF4
+ASGNF4
+ADDRGP4 $1461
+JUMPV
+LABELV $1460
+ADDRLP4 21856
+ADDRFP4 36
+INDIRF4
+ASGNF4
+LABELV $1461
+ADDRLP4 21864
+ADDRFP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 21852
+ADDRLP4 21856
+INDIRF4
+ADDRLP4 21864
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 21860
+ADDRLP4 21852
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 21856
+INDIRF4
+SUBF4
+ADDRLP4 21860
+INDIRF4
+ADDRLP4 21856
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 21852
+INDIRF4
+ARGF4
+ADDRLP4 21860
+INDIRF4
+ARGF4
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 21852
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1459
+JUMPV
+LABELV $1458
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+CNSTI4 257
+NEI4 $1464
+ADDRLP4 21856
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 21852
+ADDRLP4 21856
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 21852
+ADDRLP4 21852
+INDIRI4
+CNSTI4 16711680
+BANDI4
+ASGNI4
+ADDRLP4 21852
+ADDRLP4 21852
+INDIRI4
+CNSTI4 65536
+DIVI4
+ASGNI4
+ADDRLP4 21860
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 88
+ADDRLP4 21852
+INDIRI4
+CVIF4 4
+ADDRLP4 21860
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 21852
+ADDRLP4 21856
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 21852
+ADDRLP4 21852
+INDIRI4
+CNSTI4 65280
+BANDI4
+ASGNI4
+ADDRLP4 21852
+ADDRLP4 21852
+INDIRI4
+CNSTI4 256
+DIVI4
+ASGNI4
+ADDRLP4 88+4
+ADDRLP4 21852
+INDIRI4
+CVIF4 4
+ADDRLP4 21860
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 21852
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 21852
+ADDRLP4 21852
+INDIRI4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRLP4 21852
+ADDRLP4 21852
+INDIRI4
+ASGNI4
+ADDRLP4 88+8
+ADDRLP4 21852
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 88+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $1465
+JUMPV
+LABELV $1464
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+CNSTI4 259
+NEI4 $1469
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1470
+JUMPV
+LABELV $1469
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+CNSTI4 260
+NEI4 $1471
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1472
+JUMPV
+LABELV $1471
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+CNSTI4 261
+NEI4 $1473
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRLP4 21852
+ADDRGP4 trap_R_GetFontInfo
+CALLI4
+ASGNI4
+ADDRLP4 21852
+INDIRI4
+CNSTI4 0
+NEI4 $1475
+ADDRGP4 $1094
+ARGP4
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 112
+ADDRFP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $1476
+JUMPV
+LABELV $1475
+ADDRLP4 112
+ADDRLP4 136
+ASGNP4
+LABELV $1476
+ADDRGP4 cg_qlFontScaling+12
+INDIRI4
+CNSTI4 0
+EQI4 $1477
+ADDRLP4 112
+INDIRP4
+CVPU4 4
+ADDRGP4 cgDC+236+12
+CVPU4 4
+NEU4 $1477
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $1482
+ADDRLP4 112
+ADDRGP4 cgDC+236+21680
+ASGNP4
+ADDRGP4 $1483
+JUMPV
+LABELV $1482
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $1487
+ADDRLP4 112
+ADDRGP4 cgDC+236+43348
+ASGNP4
+LABELV $1487
+LABELV $1483
+LABELV $1477
+ADDRLP4 21856
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 104
+ADDRLP4 21856
+INDIRF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 21856
+INDIRF4
+ASGNF4
+ADDRLP4 112
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1058
+ARGP4
+ADDRLP4 21860
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 21860
+INDIRI4
+CNSTI4 0
+NEI4 $1492
+ADDRLP4 21864
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 104
+ADDRLP4 21864
+INDIRF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 21864
+INDIRF4
+ASGNF4
+ADDRGP4 $1493
+JUMPV
+LABELV $1492
+ADDRLP4 112
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1061
+ARGP4
+ADDRLP4 21864
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 21864
+INDIRI4
+CNSTI4 0
+NEI4 $1494
+ADDRLP4 104
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $1495
+JUMPV
+LABELV $1494
+ADDRLP4 112
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1064
+ARGP4
+ADDRLP4 21868
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 21868
+INDIRI4
+CNSTI4 0
+NEI4 $1496
+ADDRLP4 104
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 116
+CNSTF4 1077936128
+ASGNF4
+LABELV $1496
+LABELV $1495
+LABELV $1493
+ADDRLP4 84
+ADDRFP4 8
+INDIRF4
+ADDRLP4 112
+INDIRP4
+CNSTI4 21528
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 21876
+ADDRGP4 CG_ScaleFont
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 21876
+INDIRP4
+ASGNP4
+ADDRGP4 $1474
+JUMPV
+LABELV $1473
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+CNSTI4 262
+NEI4 $1498
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 8
+INDIRF4
+ADDRLP4 112
+INDIRP4
+CNSTI4 21528
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 21856
+ADDRGP4 CG_ScaleFont
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 21856
+INDIRP4
+ASGNP4
+ADDRGP4 $1499
+JUMPV
+LABELV $1498
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+CNSTI4 263
+NEI4 $1500
+ADDRFP4 40
+ADDRFP4 40
+INDIRF4
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $1501
+JUMPV
+LABELV $1500
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+CNSTI4 264
+NEI4 $1502
+ADDRFP4 28
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1503
+JUMPV
+LABELV $1502
+ADDRGP4 $1504
+ARGP4
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1503
+LABELV $1501
+LABELV $1499
+LABELV $1474
+LABELV $1472
+LABELV $1470
+LABELV $1465
+LABELV $1459
+ADDRLP4 21828
+ADDRLP4 21828
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $1449
+JUMPV
+LABELV $1455
+ADDRLP4 21852
+ADDRGP4 $1505
+INDIRB
+ASGNB 5
+ADDRLP4 21852
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+CNSTI4 255
+BANDI4
+CVII1 4
+ASGNI1
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1506
+ADDRLP4 21852+1
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 255
+BANDI4
+CVII1 4
+ASGNI1
+ADDRLP4 21828
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1509
+ADDRLP4 21852+2
+ADDRLP4 21828
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 255
+BANDI4
+CVII1 4
+ASGNI1
+ADDRLP4 21828
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1512
+ADDRLP4 21852+3
+ADDRLP4 21828
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 255
+BANDI4
+CVII1 4
+ASGNI1
+LABELV $1512
+LABELV $1509
+LABELV $1506
+ADDRLP4 21832
+CNSTI4 0
+ASGNI4
+ADDRLP4 21852
+ARGP4
+ADDRLP4 21832
+ARGP4
+ADDRLP4 21840
+ARGP4
+ADDRLP4 21864
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+ASGNI4
+ADDRLP4 21836
+ADDRLP4 21864
+INDIRI4
+ASGNI4
+ADDRLP4 21832
+INDIRI4
+CNSTI4 1
+LEI4 $1515
+LABELV $1515
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 21836
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_GetGlyphInfo
+CALLI4
+pop
+ADDRLP4 21828
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1517
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+CNSTI4 94
+NEI4 $1517
+ADDRLP4 21856
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 21856
+INDIRI4
+CNSTI4 0
+EQI4 $1517
+ADDRLP4 21856
+INDIRI4
+CNSTI4 65
+LTI4 $1520
+ADDRLP4 21856
+INDIRI4
+CNSTI4 90
+LEI4 $1519
+LABELV $1520
+ADDRLP4 21860
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 21860
+INDIRI4
+CNSTI4 97
+LTI4 $1521
+ADDRLP4 21860
+INDIRI4
+CNSTI4 122
+LEI4 $1519
+LABELV $1521
+ADDRLP4 21864
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 21864
+INDIRI4
+CNSTI4 48
+LTI4 $1517
+ADDRLP4 21864
+INDIRI4
+CNSTI4 57
+GTI4 $1517
+LABELV $1519
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1522
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 CG_CpmaColorFromPicString
+CALLV
+pop
+ADDRGP4 $1523
+JUMPV
+LABELV $1522
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $1525
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 CG_OspColorFromPicString
+CALLV
+pop
+ADDRGP4 $1526
+JUMPV
+LABELV $1525
+ADDRLP4 88
+ARGP4
+ADDRLP4 21868
+CNSTI4 4
+ASGNI4
+ADDRLP4 21828
+INDIRP4
+ADDRLP4 21868
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+ADDRLP4 21868
+INDIRI4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1526
+LABELV $1523
+ADDRLP4 88+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 55
+NEI4 $1529
+ADDRLP4 88
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $1529
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $1531
+ADDRLP4 21868
+ADDRLP4 21828
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 21868
+INDIRI4
+CNSTI4 120
+EQI4 $1536
+ADDRLP4 21868
+INDIRI4
+CNSTI4 88
+NEI4 $1534
+LABELV $1536
+ADDRLP4 21828
+ADDRLP4 21828
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRGP4 $1449
+JUMPV
+LABELV $1534
+ADDRLP4 21828
+ADDRLP4 21828
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $1449
+JUMPV
+LABELV $1531
+ADDRLP4 21828
+ADDRLP4 21828
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $1449
+JUMPV
+LABELV $1517
+ADDRLP4 21868
+ADDRLP4 84
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 21872
+ADDRLP4 84
+INDIRF4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDRLP4 0+16
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+EQI4 $1541
+ADDRFP4 28
+INDIRI4
+CNSTI4 6
+NEI4 $1539
+LABELV $1541
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $1543
+ADDRLP4 21892
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1544
+JUMPV
+LABELV $1543
+ADDRLP4 21892
+CNSTI4 2
+ASGNI4
+LABELV $1544
+ADDRLP4 21880
+ADDRLP4 21892
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 21884
+ADDRLP4 21880
+INDIRF4
+ASGNF4
+ADDRLP4 21888
+ADDRLP4 21880
+INDIRF4
+ASGNF4
+ADDRLP4 21896
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 21884
+ADDRLP4 21884
+INDIRF4
+ADDRLP4 21896
+INDIRF4
+ADDRLP4 104
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 21888
+ADDRLP4 21888
+INDIRF4
+ADDRLP4 21896
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRGP4 colorBlack+12
+ADDRLP4 88+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ADDRLP4 21872
+INDIRF4
+ADDF4
+ADDRLP4 21884
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 21868
+INDIRF4
+SUBF4
+ADDRLP4 21888
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 0+24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0+28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 21900
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 21900
+INDIRF4
+ADDRLP4 104
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 21900
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0+32
+INDIRF4
+ARGF4
+ADDRLP4 0+36
+INDIRF4
+ARGF4
+ADDRLP4 0+40
+INDIRF4
+ARGF4
+ADDRLP4 0+44
+INDIRF4
+ARGF4
+ADDRLP4 0+48
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintCharScale
+CALLV
+pop
+ADDRGP4 colorBlack+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1539
+ADDRFP4 0
+INDIRF4
+ADDRLP4 21872
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 21868
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0+24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0+28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 21880
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 21880
+INDIRF4
+ADDRLP4 104
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 21880
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0+32
+INDIRF4
+ARGF4
+ADDRLP4 0+36
+INDIRF4
+ARGF4
+ADDRLP4 0+40
+INDIRF4
+ARGF4
+ADDRLP4 0+44
+INDIRF4
+ARGF4
+ADDRLP4 0+48
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintCharScale
+CALLV
+pop
+ADDRLP4 21884
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0+20
+INDIRI4
+CVIF4 4
+ADDRLP4 21884
+INDIRF4
+MULF4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDRFP4 20
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 132
+INDIRF4
+ADDRLP4 0+20
+INDIRI4
+CVIF4 4
+ADDRLP4 21884
+INDIRF4
+MULF4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 21892
+ADDRLP4 21832
+INDIRI4
+ASGNI4
+ADDRLP4 21828
+ADDRLP4 21892
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 21828
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+ADDRLP4 21892
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1449
+ADDRLP4 21828
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1565
+ADDRLP4 21828
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1565
+ADDRLP4 108
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LTI4 $1448
+LABELV $1565
+LABELV $1450
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1438
+LABELV $1416
+endproc CG_Text_Pic_Paint 21904 44
+export CG_CreateNameSprite
+proc CG_CreateNameSprite 284 28
+ADDRGP4 cg+6747388
+INDIRI4
+CNSTI4 0
+NEI4 $1567
+ADDRGP4 $1566
+JUMPV
+LABELV $1567
+ADDRLP4 120
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+ADDRFP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 cg_qlFontScaling+12
+INDIRI4
+CNSTI4 0
+EQI4 $1570
+ADDRLP4 124
+INDIRP4
+CVPU4 4
+ADDRGP4 cgDC+236+12
+CVPU4 4
+NEU4 $1570
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $1575
+ADDRLP4 124
+ADDRGP4 cgDC+236+21680
+ASGNP4
+ADDRGP4 $1576
+JUMPV
+LABELV $1575
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $1580
+ADDRLP4 124
+ADDRGP4 cgDC+236+43348
+ASGNP4
+LABELV $1580
+LABELV $1576
+LABELV $1570
+ADDRLP4 112
+ADDRGP4 cg_drawPlayerNamesAlpha+12
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawPlayerNamesStyle+12
+INDIRI4
+CNSTI4 3
+NEI4 $1586
+ADDRLP4 132
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1587
+JUMPV
+LABELV $1586
+ADDRGP4 cg_drawPlayerNamesStyle+12
+INDIRI4
+CNSTI4 6
+NEI4 $1589
+ADDRLP4 132
+CNSTI4 2
+ASGNI4
+LABELV $1589
+LABELV $1587
+ADDRLP4 116
+CNSTI4 16384
+ASGNI4
+ADDRLP4 136
+CNSTI4 544
+ASGNI4
+ADDRGP4 imgBuff
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 35651584
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 finalImgBuff
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 35651584
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1592
+ADDRLP4 156
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 cg_drawPlayerNamesColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1594
+ADDRLP4 4
+ARGP4
+ADDRGP4 cg_drawPlayerNamesColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 4+12
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1595
+JUMPV
+LABELV $1594
+ADDRLP4 4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1595
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+ADDRLP4 160
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 164
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+LEI4 $1598
+ADDRLP4 144
+INDIRI4
+ADDRLP4 164
+INDIRI4
+LEI4 $1598
+ADDRLP4 144
+ADDRFP4 24
+INDIRI4
+ASGNI4
+LABELV $1598
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1601
+JUMPV
+LABELV $1600
+ADDRLP4 156
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1603
+ADDRLP4 156
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $1603
+ADDRLP4 172
+ADDRLP4 156
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $1603
+ADDRLP4 172
+INDIRI4
+CNSTI4 65
+LTI4 $1606
+ADDRLP4 172
+INDIRI4
+CNSTI4 90
+LEI4 $1605
+LABELV $1606
+ADDRLP4 176
+ADDRLP4 156
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 97
+LTI4 $1607
+ADDRLP4 176
+INDIRI4
+CNSTI4 122
+LEI4 $1605
+LABELV $1607
+ADDRLP4 180
+ADDRLP4 156
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 48
+LTI4 $1603
+ADDRLP4 180
+INDIRI4
+CNSTI4 57
+GTI4 $1603
+LABELV $1605
+ADDRGP4 cg_drawPlayerNamesColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1608
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1611
+ADDRLP4 156
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_CpmaColorFromString
+CALLV
+pop
+ADDRGP4 $1612
+JUMPV
+LABELV $1611
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $1614
+ADDRLP4 156
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_OspColorFromString
+CALLV
+pop
+ADDRGP4 $1615
+JUMPV
+LABELV $1614
+ADDRLP4 4
+ARGP4
+ADDRLP4 156
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1615
+LABELV $1612
+ADDRLP4 4+12
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1608
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $1618
+ADDRLP4 184
+ADDRLP4 156
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 120
+EQI4 $1623
+ADDRLP4 184
+INDIRI4
+CNSTI4 88
+NEI4 $1621
+LABELV $1623
+ADDRLP4 188
+CNSTI4 8
+ASGNI4
+ADDRLP4 156
+ADDRLP4 156
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+ADDRLP4 188
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1601
+JUMPV
+LABELV $1621
+ADDRLP4 188
+CNSTI4 2
+ASGNI4
+ADDRLP4 156
+ADDRLP4 156
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+ADDRLP4 188
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1601
+JUMPV
+LABELV $1618
+ADDRLP4 184
+CNSTI4 2
+ASGNI4
+ADDRLP4 156
+ADDRLP4 156
+INDIRP4
+ADDRLP4 184
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+ADDRLP4 184
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1601
+JUMPV
+LABELV $1603
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 196
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 188
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 156
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_R_GetGlyphInfo
+CALLI4
+pop
+ADDRLP4 20+48
+INDIRI4
+ARGI4
+ADDRGP4 fontImageWidth
+ARGP4
+ADDRGP4 fontImageHeight
+ARGP4
+ADDRGP4 trap_GetShaderImageDimensions
+CALLV
+pop
+ADDRLP4 200
+CNSTI4 512
+ASGNI4
+ADDRGP4 fontImageWidth
+INDIRI4
+ADDRLP4 200
+INDIRI4
+GTI4 $1627
+ADDRGP4 fontImageHeight
+INDIRI4
+ADDRLP4 200
+INDIRI4
+LEI4 $1625
+LABELV $1627
+ADDRGP4 $1628
+ARGP4
+ADDRGP4 fontImageWidth
+INDIRI4
+ARGI4
+ADDRGP4 fontImageHeight
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1566
+JUMPV
+LABELV $1625
+ADDRLP4 20+48
+INDIRI4
+ARGI4
+ADDRGP4 fontImageData
+ARGP4
+ADDRGP4 trap_GetShaderImageData
+CALLV
+pop
+ADDRLP4 128
+ADDRLP4 20+32
+INDIRF4
+ADDRGP4 fontImageWidth
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 20+36
+INDIRF4
+ADDRGP4 fontImageHeight
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 204
+CNSTI4 512
+ASGNI4
+ADDRLP4 20+24
+INDIRI4
+ADDRLP4 204
+INDIRI4
+GTI4 $1636
+ADDRLP4 20+28
+INDIRI4
+ADDRLP4 204
+INDIRI4
+LEI4 $1632
+LABELV $1636
+ADDRGP4 $1637
+ARGP4
+ADDRLP4 156
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20+24
+INDIRI4
+ARGI4
+ADDRLP4 20+28
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1602
+JUMPV
+LABELV $1632
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRLP4 20+24
+INDIRI4
+ADDRLP4 208
+INDIRI4
+LTI4 $1644
+ADDRLP4 20+28
+INDIRI4
+ADDRLP4 208
+INDIRI4
+GEI4 $1640
+LABELV $1644
+ADDRGP4 $1645
+ARGP4
+ADDRLP4 20+24
+INDIRI4
+ARGI4
+ADDRLP4 20+28
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1566
+JUMPV
+LABELV $1640
+ADDRLP4 104
+ADDRLP4 136
+INDIRI4
+ADDRLP4 20+4
+INDIRI4
+SUBI4
+CNSTI4 32
+SUBI4
+ADDRLP4 116
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+CNSTI4 278528
+ADDI4
+CNSTI4 35094528
+LTI4 $1649
+ADDRGP4 $1602
+JUMPV
+LABELV $1649
+ADDRLP4 212
+CNSTI4 2
+ASGNI4
+ADDRLP4 128
+ADDRLP4 152
+INDIRI4
+ADDRGP4 fontImageWidth
+INDIRI4
+MULI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRLP4 148
+INDIRI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1654
+JUMPV
+LABELV $1651
+ADDRGP4 tmpBuff
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1048576
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 1048576
+ADDRLP4 20+24
+INDIRI4
+CNSTI4 2
+LSHI4
+GEI4 $1656
+ADDRGP4 $1659
+ARGP4
+CNSTI4 1048576
+ARGI4
+ADDRLP4 20+24
+INDIRI4
+CNSTI4 2
+LSHI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1566
+JUMPV
+LABELV $1656
+ADDRGP4 tmpBuff
+ARGP4
+ADDRLP4 128
+INDIRI4
+ADDRGP4 fontImageData
+ADDP4
+ARGP4
+ADDRLP4 20+24
+INDIRI4
+CNSTI4 2
+LSHI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1665
+JUMPV
+LABELV $1662
+ADDRLP4 232
+ADDRLP4 0
+INDIRI4
+ADDRGP4 tmpBuff
+ADDP4
+ASGNP4
+ADDRLP4 236
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 216
+ADDRLP4 232
+INDIRP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 220
+ADDRLP4 0
+INDIRI4
+ADDRGP4 tmpBuff+3
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 236
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 216
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 244
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 244
+INDIRF4
+LTF4 $1669
+ADDRLP4 224
+ADDRLP4 240
+INDIRF4
+ADDRLP4 244
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1670
+JUMPV
+LABELV $1669
+ADDRLP4 224
+ADDRLP4 240
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1670
+ADDRLP4 232
+INDIRP4
+ADDRLP4 224
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 252
+CNSTF4 1132396544
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 216
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 256
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+LTF4 $1674
+ADDRLP4 248
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1675
+JUMPV
+LABELV $1674
+ADDRLP4 248
+ADDRLP4 252
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1675
+ADDRLP4 0
+INDIRI4
+ADDRGP4 tmpBuff+1
+ADDP4
+ADDRLP4 248
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 264
+CNSTF4 1132396544
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 216
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 268
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 268
+INDIRF4
+LTF4 $1679
+ADDRLP4 260
+ADDRLP4 264
+INDIRF4
+ADDRLP4 268
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1680
+JUMPV
+LABELV $1679
+ADDRLP4 260
+ADDRLP4 264
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1680
+ADDRLP4 0
+INDIRI4
+ADDRGP4 tmpBuff+2
+ADDP4
+ADDRLP4 260
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 276
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+ADDRLP4 220
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 276
+INDIRF4
+ADDRLP4 280
+INDIRF4
+LTF4 $1683
+ADDRLP4 272
+ADDRLP4 276
+INDIRF4
+ADDRLP4 280
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1684
+JUMPV
+LABELV $1683
+ADDRLP4 272
+ADDRLP4 276
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1684
+ADDRLP4 0
+INDIRI4
+ADDRGP4 tmpBuff+3
+ADDP4
+ADDRLP4 272
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $1663
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+LABELV $1665
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20+24
+INDIRI4
+CNSTI4 2
+LSHI4
+LTI4 $1662
+CNSTI4 35651584
+ADDRLP4 120
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+SUBI4
+ADDRLP4 20+24
+INDIRI4
+CNSTI4 2
+LSHI4
+GEI4 $1685
+ADDRGP4 $1688
+ARGP4
+CNSTI4 35651584
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 20+24
+INDIRI4
+CNSTI4 2
+LSHI4
+ARGI4
+ADDRLP4 20+4
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1566
+JUMPV
+LABELV $1685
+ADDRLP4 104
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 imgBuff
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 tmpBuff
+ARGP4
+ADDRLP4 20+24
+INDIRI4
+CNSTI4 2
+LSHI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 216
+CNSTI4 2
+ASGNI4
+ADDRLP4 104
+ADDRLP4 104
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDRLP4 216
+INDIRI4
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+ADDRGP4 fontImageWidth
+INDIRI4
+ADDRLP4 216
+INDIRI4
+LSHI4
+ADDI4
+ASGNI4
+LABELV $1652
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1654
+ADDRLP4 108
+INDIRI4
+ADDRLP4 20+28
+INDIRI4
+GEI4 $1692
+ADDRLP4 108
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $1651
+LABELV $1692
+ADDRLP4 120
+ADDRLP4 120
+INDIRI4
+ADDRLP4 20+20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 220
+CNSTI4 1
+ASGNI4
+ADDRLP4 156
+ADDRLP4 156
+INDIRP4
+ADDRLP4 220
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+ADDRLP4 220
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1601
+ADDRLP4 156
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1695
+ADDRLP4 156
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1695
+ADDRLP4 140
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LTI4 $1600
+LABELV $1695
+LABELV $1602
+ADDRGP4 finalImgBuff
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 35651584
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 120
+ADDRLP4 120
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1699
+JUMPV
+LABELV $1696
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $1700
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1705
+JUMPV
+LABELV $1702
+ADDRLP4 172
+ADDRLP4 108
+INDIRI4
+ADDRLP4 132
+INDIRI4
+ADDI4
+ADDRLP4 120
+INDIRI4
+MULI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 108
+INDIRI4
+ADDRLP4 120
+INDIRI4
+MULI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 4
+ADDI4
+CNSTI4 35651584
+LTI4 $1706
+ADDRGP4 $1708
+ARGP4
+CNSTI4 35651584
+ARGI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1566
+JUMPV
+LABELV $1706
+ADDRLP4 172
+INDIRI4
+ADDRGP4 finalImgBuff
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 172
+INDIRI4
+ADDRGP4 finalImgBuff+1
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 172
+INDIRI4
+ADDRGP4 finalImgBuff+2
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 108
+INDIRI4
+ADDRLP4 116
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+CNSTI4 3
+ADDI4
+CNSTI4 35651584
+LTI4 $1711
+ADDRGP4 $1713
+ARGP4
+CNSTI4 35651584
+ARGI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 116
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1566
+JUMPV
+LABELV $1711
+ADDRLP4 172
+INDIRI4
+ADDRGP4 finalImgBuff+3
+ADDP4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 116
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ADDRGP4 imgBuff+3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 108
+INDIRI4
+ADDRLP4 116
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ADDRGP4 imgBuff+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+EQI4 $1716
+ADDRLP4 176
+INDIRI4
+CNSTI4 3
+ADDI4
+CNSTI4 35651584
+LTI4 $1719
+ADDRGP4 $1721
+ARGP4
+CNSTI4 35651584
+ARGI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 116
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1566
+JUMPV
+LABELV $1719
+ADDRLP4 176
+INDIRI4
+ADDRGP4 finalImgBuff
+ADDP4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 116
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ADDRGP4 imgBuff
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 176
+INDIRI4
+ADDRGP4 finalImgBuff+1
+ADDP4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 116
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ADDRGP4 imgBuff+1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 176
+INDIRI4
+ADDRGP4 finalImgBuff+2
+ADDP4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 116
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ADDRGP4 imgBuff+2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 176
+INDIRI4
+ADDRGP4 finalImgBuff+3
+ADDP4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 116
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ADDRGP4 imgBuff+3
+ADDP4
+INDIRU1
+ASGNU1
+LABELV $1716
+LABELV $1703
+ADDRLP4 104
+ADDRLP4 104
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+LABELV $1705
+ADDRLP4 104
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LTI4 $1702
+ADDRGP4 $1701
+JUMPV
+LABELV $1700
+ADDRLP4 108
+INDIRI4
+ADDRLP4 120
+INDIRI4
+MULI4
+CNSTI4 35651584
+LTI4 $1728
+ADDRGP4 $1730
+ARGP4
+CNSTI4 35651584
+ARGI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 120
+INDIRI4
+MULI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1566
+JUMPV
+LABELV $1728
+ADDRLP4 108
+INDIRI4
+ADDRLP4 120
+INDIRI4
+MULI4
+ADDRGP4 finalImgBuff
+ADDP4
+ARGP4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 116
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRGP4 imgBuff
+ADDP4
+ARGP4
+ADDRLP4 120
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1701
+LABELV $1697
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1699
+ADDRLP4 108
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $1696
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 finalImgBuff
+ARGP4
+ADDRLP4 120
+INDIRI4
+CNSTI4 4
+DIVI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRGP4 trap_ReplaceShaderImage
+CALLV
+pop
+LABELV $1592
+LABELV $1566
+endproc CG_CreateNameSprite 284 28
+export CG_Text_Paint_Bottom
+proc CG_Text_Paint_Bottom 8 36
+ADDRGP4 $1732
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1731
+endproc CG_Text_Paint_Bottom 8 36
+export CG_Text_Paint_old
+proc CG_Text_Paint_old 8 36
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 32
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $1734
+ADDRLP4 0
+ADDRGP4 cgDC+236+12
+ASGNP4
+ADDRGP4 $1735
+JUMPV
+LABELV $1734
+ADDRLP4 0
+CNSTI4 21668
+ADDRFP4 32
+INDIRI4
+MULI4
+ADDRGP4 cgDC+236+65016
+ADDP4
+ASGNP4
+LABELV $1735
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1733
+endproc CG_Text_Paint_old 8 36
+proc CG_DrawField 64 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $1741
+ADDRGP4 $1740
+JUMPV
+LABELV $1741
+ADDRFP4 8
+INDIRI4
+CNSTI4 5
+LEI4 $1743
+ADDRFP4 8
+CNSTI4 5
+ASGNI4
+LABELV $1743
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $1745
+ADDRFP4 8
+INDIRI4
+CNSTI4 4
+GTI4 $1745
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1775-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1775
+address $1747
+address $1754
+address $1761
+address $1768
+code
+LABELV $1747
+ADDRFP4 12
+INDIRI4
+CNSTI4 9
+LEI4 $1749
+ADDRLP4 32
+CNSTI4 9
+ASGNI4
+ADDRGP4 $1750
+JUMPV
+LABELV $1749
+ADDRLP4 32
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $1750
+ADDRFP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $1752
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1753
+JUMPV
+LABELV $1752
+ADDRLP4 36
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $1753
+ADDRFP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $1746
+JUMPV
+LABELV $1754
+ADDRFP4 12
+INDIRI4
+CNSTI4 99
+LEI4 $1756
+ADDRLP4 40
+CNSTI4 99
+ASGNI4
+ADDRGP4 $1757
+JUMPV
+LABELV $1756
+ADDRLP4 40
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $1757
+ADDRFP4 12
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -9
+GEI4 $1759
+ADDRLP4 44
+CNSTI4 -9
+ASGNI4
+ADDRGP4 $1760
+JUMPV
+LABELV $1759
+ADDRLP4 44
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $1760
+ADDRFP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $1746
+JUMPV
+LABELV $1761
+ADDRFP4 12
+INDIRI4
+CNSTI4 999
+LEI4 $1763
+ADDRLP4 48
+CNSTI4 999
+ASGNI4
+ADDRGP4 $1764
+JUMPV
+LABELV $1763
+ADDRLP4 48
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $1764
+ADDRFP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -99
+GEI4 $1766
+ADDRLP4 52
+CNSTI4 -99
+ASGNI4
+ADDRGP4 $1767
+JUMPV
+LABELV $1766
+ADDRLP4 52
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $1767
+ADDRFP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $1746
+JUMPV
+LABELV $1768
+ADDRFP4 12
+INDIRI4
+CNSTI4 9999
+LEI4 $1770
+ADDRLP4 56
+CNSTI4 9999
+ASGNI4
+ADDRGP4 $1771
+JUMPV
+LABELV $1770
+ADDRLP4 56
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $1771
+ADDRFP4 12
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -999
+GEI4 $1773
+ADDRLP4 60
+CNSTI4 -999
+ASGNI4
+ADDRGP4 $1774
+JUMPV
+LABELV $1773
+ADDRLP4 60
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $1774
+ADDRFP4 12
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $1745
+LABELV $1746
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $1777
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 32
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $1778
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $1778
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 5
+LSHI4
+CNSTI4 2
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+ASGNP4
+ADDRGP4 $1781
+JUMPV
+LABELV $1780
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $1783
+ADDRLP4 8
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1784
+JUMPV
+LABELV $1783
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $1784
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1107296256
+ARGF4
+CNSTF4 1111490560
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492172
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1781
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+EQI4 $1787
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1780
+LABELV $1787
+LABELV $1740
+endproc CG_DrawField 64 20
+proc CG_Draw3DModelExt 592 16
+ADDRFP4 32
+ADDRFP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 540
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 540
+INDIRI4
+EQI4 $1793
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 540
+INDIRI4
+NEI4 $1789
+LABELV $1793
+ADDRGP4 $1788
+JUMPV
+LABELV $1789
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 368
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 368+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 368+68
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 368+8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 368+108
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 368+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 548
+CNSTF4 1132396544
+ADDRFP4 32
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 552
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+LTF4 $1801
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1802
+JUMPV
+LABELV $1801
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1802
+ADDRLP4 368+116
+ADDRLP4 544
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 560
+CNSTF4 1132396544
+ADDRFP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 564
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 560
+INDIRF4
+ADDRLP4 564
+INDIRF4
+LTF4 $1806
+ADDRLP4 556
+ADDRLP4 560
+INDIRF4
+ADDRLP4 564
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1807
+JUMPV
+LABELV $1806
+ADDRLP4 556
+ADDRLP4 560
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1807
+ADDRLP4 368+116+1
+ADDRLP4 556
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 572
+CNSTF4 1132396544
+ADDRFP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 576
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 572
+INDIRF4
+ADDRLP4 576
+INDIRF4
+LTF4 $1811
+ADDRLP4 568
+ADDRLP4 572
+INDIRF4
+ADDRLP4 576
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1812
+JUMPV
+LABELV $1811
+ADDRLP4 568
+ADDRLP4 572
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1812
+ADDRLP4 368+116+2
+ADDRLP4 568
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 584
+CNSTF4 1132396544
+ADDRFP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 588
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 584
+INDIRF4
+ADDRLP4 588
+INDIRF4
+LTF4 $1816
+ADDRLP4 580
+ADDRLP4 584
+INDIRF4
+ADDRLP4 588
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1817
+JUMPV
+LABELV $1816
+ADDRLP4 580
+ADDRLP4 584
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1817
+ADDRLP4 368+116+3
+ADDRLP4 580
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+16
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0+20
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+72
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRLP4 368
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $1788
+endproc CG_Draw3DModelExt 592 16
+lit
+align 4
+LABELV $1828
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export CG_Draw3DModel
+code
+proc CG_Draw3DModel 16 36
+ADDRLP4 0
+ADDRGP4 $1828
+INDIRB
+ASGNB 16
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModelExt
+CALLV
+pop
+LABELV $1827
+endproc CG_Draw3DModel 16 36
+export CG_DrawHead
+proc CG_DrawHead 80 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 4524
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ASGNP4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $1831
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $1834
+ADDRGP4 $1829
+JUMPV
+LABELV $1834
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 44+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 44+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1060320051
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 884
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 888
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 4524
+ADDRFP4 16
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 72
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 16
+ADDRLP4 68
+INDIRI4
+ADDRGP4 cgs+51512+2168
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRLP4 72
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 cgs+51512+2168+1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRLP4 72
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16+8
+CNSTI4 4524
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2168+2
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 16+12
+CNSTI4 4524
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2168+3
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1862
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 944
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_Draw3DModelExt
+CALLV
+pop
+ADDRGP4 $1832
+JUMPV
+LABELV $1862
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_Draw3DModelExt
+CALLV
+pop
+ADDRGP4 $1832
+JUMPV
+LABELV $1831
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $1864
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1867
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 972
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1868
+JUMPV
+LABELV $1867
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1868
+LABELV $1864
+LABELV $1832
+ADDRLP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1869
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+340
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1869
+LABELV $1829
+endproc CG_DrawHead 80 36
+export CG_DrawFlagModel
+proc CG_DrawFlagModel 72 32
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $1874
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $1874
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cgs+632912+36
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 12+8
+CNSTF4 3204448256
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1056964608
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1056964608
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1114636288
+ADDRLP4 68
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $1891
+ADDRLP4 56
+ADDRGP4 cgs+632912+36
+INDIRI4
+ASGNI4
+ADDRGP4 $1892
+JUMPV
+LABELV $1891
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $1895
+ADDRLP4 56
+ADDRGP4 cgs+632912+40
+INDIRI4
+ASGNI4
+ADDRGP4 $1896
+JUMPV
+LABELV $1895
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1873
+ADDRLP4 56
+ADDRGP4 cgs+632912+44
+INDIRI4
+ASGNI4
+LABELV $1900
+LABELV $1896
+LABELV $1892
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $1875
+JUMPV
+LABELV $1874
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $1903
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $1906
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $1907
+JUMPV
+LABELV $1906
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $1908
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $1909
+JUMPV
+LABELV $1908
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1873
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+LABELV $1911
+LABELV $1909
+LABELV $1907
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1912
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1912
+LABELV $1903
+LABELV $1875
+LABELV $1873
+endproc CG_DrawFlagModel 72 32
+proc CG_DrawStatusBarHead 68 28
+ADDRLP4 32
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $1918
+ADDRGP4 cg+627432
+INDIRF4
+CNSTF4 0
+EQF4 $1918
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+627432
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+GEF4 $1918
+ADDRLP4 0
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+627432
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 40
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 36
+INDIRF4
+CNSTF4 1069547520
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+ADDRGP4 cg+627436
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+627468
+CNSTF4 1110704128
+ADDRGP4 cg+627436
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+627456
+CNSTF4 1101004800
+ADDRLP4 52
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+627452
+CNSTF4 1084227584
+ADDRLP4 60
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+627472
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+627460
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1919
+JUMPV
+LABELV $1918
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+627460
+INDIRI4
+LTI4 $1934
+ADDRGP4 cg+627468
+ADDRGP4 cg+627456
+INDIRF4
+ASGNF4
+ADDRGP4 cg+627464
+ADDRGP4 cg+627452
+INDIRF4
+ASGNF4
+ADDRGP4 cg+627472
+ADDRGP4 cg+627460
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+627460
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+627456
+CNSTF4 1101004800
+ADDRLP4 44
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+627452
+CNSTF4 1084227584
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1934
+ADDRLP4 16
+CNSTF4 1114636288
+ASGNF4
+LABELV $1919
+ADDRGP4 cg+627472
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LEI4 $1948
+ADDRGP4 cg+627472
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $1948
+ADDRLP4 0
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+627472
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+627460
+INDIRI4
+ADDRGP4 cg+627472
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRGP4 cg+627468
+INDIRF4
+ADDRGP4 cg+627456
+INDIRF4
+ADDRGP4 cg+627468
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+627464
+INDIRF4
+ADDRGP4 cg+627452
+INDIRF4
+ADDRGP4 cg+627464
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1139802112
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1965
+ADDRLP4 24
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $1966
+JUMPV
+LABELV $1965
+ADDRLP4 24
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1966
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+LABELV $1915
+endproc CG_DrawStatusBarHead 68 28
+proc CG_DrawStatusBarFlag 4 24
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 0
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $1969
+endproc CG_DrawStatusBarFlag 4 24
+export CG_DrawTeamBackground
+proc CG_DrawTeamBackground 20 20
+ADDRGP4 cg_drawTeamBackground+12
+INDIRI4
+CNSTI4 0
+NEI4 $1971
+ADDRGP4 $1970
+JUMPV
+LABELV $1971
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $1975
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1976
+JUMPV
+LABELV $1975
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $1970
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $1980
+LABELV $1976
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+632912+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1970
+endproc CG_DrawTeamBackground 20 20
+lit
+align 4
+LABELV $1986
+byte 4 1065353216
+byte 4 1060152279
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_DrawStatusBar 112 32
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $1987
+ADDRGP4 $1985
+JUMPV
+LABELV $1987
+ADDRGP4 QLWideScreen
+CNSTI4 2
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1990
+CNSTI4 0
+ARGI4
+CNSTI4 420
+ARGI4
+CNSTI4 640
+ARGI4
+CNSTI4 60
+ARGI4
+CNSTF4 1051260355
+ARGF4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRGP4 $1991
+JUMPV
+LABELV $1990
+CNSTI4 0
+ARGI4
+CNSTI4 420
+ARGI4
+CNSTI4 640
+ARGI4
+CNSTI4 60
+ARGI4
+CNSTF4 1051260355
+ARGF4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+LABELV $1991
+ADDRLP4 48
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1997
+ADDRLP4 4
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 Wolfcam_PlayerArmor
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 Wolfcam_PlayerHealth
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $1998
+JUMPV
+LABELV $1997
+ADDRLP4 76
+CNSTI4 184
+ASGNI4
+ADDRLP4 4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 80
+CNSTI4 2
+ASGNI4
+ADDRLP4 84
+ADDRLP4 48
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRGP4 STAT_ARMOR
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LSHI4
+ADDRLP4 84
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LSHI4
+ADDRLP4 84
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1998
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 84
+INDIRI4
+EQI4 $2005
+CNSTI4 132
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+EQI4 $2005
+ADDRLP4 20
+CNSTF4 1116471296
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 8+4
+CNSTF4 1101004800
+ADDRLP4 88
+INDIRF4
+MULF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 92
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+CNSTI4 132
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $2005
+CNSTF4 1133412352
+ARGF4
+ADDRGP4 CG_DrawStatusBarHead
+CALLV
+pop
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2013
+ADDRLP4 88
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRLP4 36
+ADDRLP4 92
+INDIRI4
+ADDRLP4 96
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+LSHI4
+BANDI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 92
+INDIRI4
+ADDRLP4 96
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+LSHI4
+BANDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 92
+INDIRI4
+ADDRLP4 96
+INDIRI4
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+LSHI4
+BANDI4
+ASGNI4
+ADDRGP4 $2014
+JUMPV
+LABELV $2013
+ADDRLP4 88
+CNSTI4 2
+ASGNI4
+ADDRLP4 36
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LSHI4
+ADDRGP4 cg+607196+312
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LSHI4
+ADDRGP4 cg+607196+312
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LSHI4
+ADDRGP4 cg+607196+312
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2014
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2023
+CNSTF4 1134985216
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+ADDRGP4 $2024
+JUMPV
+LABELV $2023
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $2025
+CNSTF4 1134985216
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+ADDRGP4 $2026
+JUMPV
+LABELV $2025
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2027
+CNSTF4 1134985216
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+LABELV $2027
+LABELV $2026
+LABELV $2024
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $2029
+ADDRLP4 20
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 8+4
+CNSTI4 360
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+CNSTF4 1139474432
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 88
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+308
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $2029
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2037
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+ADDRLP4 88
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $2039
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2040
+ADDRLP4 92
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+EQI4 $2040
+ADDRLP4 92
+INDIRI4
+CNSTI4 10
+EQI4 $2040
+ADDRLP4 0
+ADDRGP4 wcg+4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTU4 255
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $2040
+JUMPV
+LABELV $2039
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $2046
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2046
+LABELV $2040
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+LEI4 $2048
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $2050
+ADDRGP4 cg+607196+148
+INDIRI4
+CNSTI4 3
+NEI4 $2050
+ADDRGP4 cg+607196+44
+INDIRI4
+CNSTI4 100
+LEI4 $2050
+ADDRLP4 72
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2051
+JUMPV
+LABELV $2050
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2056
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2057
+JUMPV
+LABELV $2056
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+LABELV $2057
+LABELV $2051
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $1986
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 0
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $2048
+ADDRLP4 92
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $2060
+ADDRLP4 92
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $2058
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+LEI4 $2058
+LABELV $2060
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 100
+INDIRI4
+NEI4 $2061
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 100
+INDIRI4
+EQI4 $2061
+ADDRLP4 104
+CNSTI4 132
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $2066
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 108
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2066
+LABELV $2061
+LABELV $2058
+LABELV $2037
+ADDRLP4 0
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LEI4 $2068
+ADDRGP4 $1986+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $2069
+JUMPV
+LABELV $2068
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+LEI4 $2071
+ADDRGP4 $1986
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $2072
+JUMPV
+LABELV $2071
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $2073
+ADDRLP4 72
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 8
+RSHI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $1986
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $2074
+JUMPV
+LABELV $2073
+ADDRGP4 $1986+16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $2074
+LABELV $2072
+LABELV $2069
+ADDRLP4 88
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $2079
+ADDRLP4 88
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $2077
+ADDRLP4 0
+INDIRI4
+CNSTI4 -9999
+EQI4 $2077
+LABELV $2079
+CNSTI4 185
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $2077
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $2080
+ADDRGP4 $1986
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 370
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $2082
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $2082
+CNSTF4 1139474432
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 100
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+312
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2082
+LABELV $2080
+LABELV $1985
+endproc CG_DrawStatusBar 112 32
+proc CG_DrawAttacker 100 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawAttacker+12
+INDIRI4
+CNSTI4 0
+NEI4 $2089
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2088
+JUMPV
+LABELV $2089
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2092
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2088
+JUMPV
+LABELV $2092
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 76
+INDIRI4
+NEI4 $2094
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+607196+184
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+GTI4 $2094
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2088
+JUMPV
+LABELV $2094
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $2098
+ADDRGP4 cg+627160
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $2098
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2088
+JUMPV
+LABELV $2098
+ADDRLP4 16
+ARGP4
+ADDRGP4 cg_drawAttackerColor
+ARGP4
+ADDRGP4 cg_drawAttackerAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRGP4 cg_drawAttackerFade+12
+INDIRI4
+CNSTI4 0
+EQI4 $2101
+ADDRGP4 cg+627160
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawAttackerFadeTime+12
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2106
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2088
+JUMPV
+LABELV $2106
+ADDRLP4 16+12
+ADDRLP4 16+12
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 68
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+LABELV $2101
+ADDRLP4 16+12
+INDIRF4
+CNSTF4 0
+GTF4 $2109
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2088
+JUMPV
+LABELV $2109
+ADDRLP4 44
+ADDRGP4 cg_drawAttackerAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg_drawAttackerScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 cg_drawAttackerStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawAttackerWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawAttackerFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2116
+ADDRLP4 48
+ADDRGP4 cgs+632912+1122192
+ASGNP4
+ADDRGP4 $2117
+JUMPV
+LABELV $2116
+ADDRLP4 48
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $2117
+ADDRLP4 4
+ADDRGP4 cg_drawAttackerX+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawAttackerY+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2124
+ADDRFP4 0
+ADDRGP4 cg_drawAttackerY+8
+INDIRF4
+ASGNF4
+LABELV $2124
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $2128
+ADDRLP4 0
+ADDRGP4 PERS_ATTACKER
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+607196+248
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2128
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2136
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $2136
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2132
+LABELV $2136
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2088
+JUMPV
+LABELV $2132
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2137
+ADDRGP4 cg+627160
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2088
+JUMPV
+LABELV $2137
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $2141
+ADDRLP4 72
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+627160
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cg_drawAttackerTime+12
+INDIRI4
+LEI4 $2145
+ADDRGP4 cg+627160
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2088
+JUMPV
+LABELV $2145
+LABELV $2141
+ADDRLP4 52
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTF4 1111490560
+ADDRGP4 cg_drawAttackerImageScale+8
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+NEI4 $2154
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $2155
+JUMPV
+LABELV $2154
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+NEI4 $2156
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2156
+LABELV $2155
+ADDRLP4 16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 cg_drawAttackerX+8
+INDIRF4
+ASGNF4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+NEI4 $2159
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $2160
+JUMPV
+LABELV $2159
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+NEI4 $2161
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2161
+LABELV $2160
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+ADDF4
+RETF4
+LABELV $2088
+endproc CG_DrawAttacker 100 36
+proc CG_DrawSnapshot 52 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawSnapshotFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2164
+ADDRLP4 32
+ADDRGP4 cgs+632912+818728
+ASGNP4
+ADDRGP4 $2165
+JUMPV
+LABELV $2164
+ADDRLP4 32
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $2165
+ADDRGP4 cg_drawSnapshotColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2171
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg_drawSnapshotColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 $2172
+JUMPV
+LABELV $2171
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $2172
+ADDRLP4 0+12
+ADDRGP4 cg_drawSnapshotAlpha+12
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 cg_drawSnapshotScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg_drawSnapshotAlign+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawSnapshotWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 $2182
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+32
+INDIRI4
+ARGI4
+ADDRGP4 cgs+39676
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+818728
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawSnapshotX+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2188
+ADDRLP4 24
+ADDRGP4 cg_drawSnapshotX+8
+INDIRF4
+ASGNF4
+ADDRGP4 $2189
+JUMPV
+LABELV $2188
+ADDRLP4 24
+CNSTF4 1142865920
+ASGNF4
+LABELV $2189
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+NEI4 $2192
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $2193
+JUMPV
+LABELV $2192
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+NEI4 $2194
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2194
+LABELV $2193
+ADDRGP4 cg_drawSnapshotY+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2196
+ADDRFP4 0
+ADDRGP4 cg_drawSnapshotY+8
+INDIRF4
+ASGNF4
+ADDRGP4 $2197
+JUMPV
+LABELV $2196
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $2197
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawSnapshotStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+818728
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $2163
+endproc CG_DrawSnapshot 52 36
+bss
+align 4
+LABELV $2204
+skip 16
+data
+align 4
+LABELV $2205
+byte 4 0
+bss
+align 4
+LABELV $2206
+skip 4
+data
+align 4
+LABELV $2207
+byte 4 0
+code
+proc CG_DrawFPS 108 36
+ADDRGP4 cg_drawFPSFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2208
+ADDRLP4 24
+ADDRGP4 cgs+632912+732012
+ASGNP4
+ADDRGP4 $2209
+JUMPV
+LABELV $2208
+ADDRLP4 24
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $2209
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawFPSWideScreen+12
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRGP4 $2206
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 92
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRGP4 $2205
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2204
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 $2205
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 4
+LEI4 $2216
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 100
+INDIRI4
+ASGNI4
+LABELV $2218
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2204
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2219
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2218
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2222
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $2222
+ADDRLP4 64
+CNSTI4 4000
+ADDRLP4 4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 cg_drawFPS+12
+INDIRI4
+CNSTI4 3
+NEI4 $2224
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LEI4 $2224
+ADDRLP4 64
+CNSTI4 1000
+ADDRLP4 20
+INDIRI4
+DIVI4
+ASGNI4
+LABELV $2224
+ADDRGP4 cg_drawFPS+12
+INDIRI4
+CNSTI4 2
+NEI4 $2227
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 $2207
+INDIRF4
+GTF4 $2230
+ADDRLP4 76
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $2231
+JUMPV
+LABELV $2230
+ADDRLP4 76
+CNSTF4 1148846080
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 $2207
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+LABELV $2231
+ADDRGP4 cg_drawFPSNoText+12
+INDIRI4
+CNSTI4 0
+EQI4 $2234
+ADDRGP4 $2237
+ARGP4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRGP4 $2228
+JUMPV
+LABELV $2234
+ADDRGP4 $2238
+ARGP4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRGP4 $2228
+JUMPV
+LABELV $2227
+ADDRGP4 cg_drawFPSNoText+12
+INDIRI4
+CNSTI4 0
+EQI4 $2239
+ADDRGP4 $2242
+ARGP4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRGP4 $2240
+JUMPV
+LABELV $2239
+ADDRGP4 $2243
+ARGP4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 104
+INDIRP4
+ASGNP4
+LABELV $2240
+LABELV $2228
+ADDRLP4 8
+ADDRGP4 cg_drawFPSScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 cg_drawFPSAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRGP4 cg_drawFPSX+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawFPSY+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2247
+ADDRFP4 0
+ADDRGP4 cg_drawFPSY+8
+INDIRF4
+ASGNF4
+ADDRGP4 $2248
+JUMPV
+LABELV $2247
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $2248
+ADDRLP4 48
+ARGP4
+ADDRGP4 cg_drawFPSColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 48+12
+ADDRGP4 cg_drawFPSAlpha+12
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 16
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 28
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+CNSTF4 1094713344
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawFPSStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $2216
+ADDRGP4 $2207
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+CNSTF4 1094713344
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $2203
+endproc CG_DrawFPS 108 36
+proc CG_DrawRedArmorTimer 60 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 44
+ADDRFP4 44
+INDIRF4
+ASGNF4
+ADDRFP4 48
+ADDRFP4 48
+INDIRP4
+ASGNP4
+ADDRFP4 52
+ADDRFP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 56
+ADDRFP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2260
+JUMPV
+LABELV $2257
+ADDRLP4 0
+CNSTI4 36
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+691256
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LEI4 $2263
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2264
+JUMPV
+LABELV $2263
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2264
+ADDRLP4 36
+CNSTI4 1000
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 36
+INDIRI4
+DIVI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 36
+INDIRI4
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -5
+GEI4 $2265
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2265
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2267
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2268
+JUMPV
+LABELV $2267
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $2268
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $2269
+ADDRLP4 44
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LTI4 $2269
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GEI4 $2269
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $2269
+ADDRLP4 4
+INDIRI4
+CNSTI4 -5
+GEI4 $2271
+ADDRGP4 cg_drawClientItemTimer+12
+INDIRI4
+CNSTI4 1
+NEI4 $2271
+ADDRLP4 8
+ADDRGP4 $2274
+ASGNP4
+ADDRGP4 $2272
+JUMPV
+LABELV $2271
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+NEI4 $2275
+ADDRGP4 cg_drawClientItemTimer+12
+INDIRI4
+CNSTI4 1
+NEI4 $2275
+ADDRGP4 $2278
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRGP4 $2276
+JUMPV
+LABELV $2275
+ADDRGP4 $2279
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $2276
+LABELV $2272
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2280
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $2280
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $2282
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $2283
+JUMPV
+LABELV $2282
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $2284
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2284
+LABELV $2283
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2286
+ADDRFP4 0
+INDIRF4
+ADDRFP4 28
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+316
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2286
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 56
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $2258
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2260
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+691252
+INDIRI4
+LTI4 $2257
+ADDRFP4 4
+INDIRF4
+RETF4
+LABELV $2256
+endproc CG_DrawRedArmorTimer 60 36
+proc CG_DrawYellowArmorTimer 60 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 44
+ADDRFP4 44
+INDIRF4
+ASGNF4
+ADDRFP4 48
+ADDRFP4 48
+INDIRP4
+ASGNP4
+ADDRFP4 52
+ADDRFP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 56
+ADDRFP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2294
+JUMPV
+LABELV $2291
+ADDRLP4 0
+CNSTI4 36
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+691836
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LEI4 $2297
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2297
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2298
+ADDRLP4 36
+CNSTI4 1000
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 36
+INDIRI4
+DIVI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 36
+INDIRI4
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -5
+GEI4 $2299
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2299
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2301
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2302
+JUMPV
+LABELV $2301
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $2302
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $2303
+ADDRLP4 44
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LTI4 $2303
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GEI4 $2303
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $2303
+ADDRLP4 4
+INDIRI4
+CNSTI4 -5
+GEI4 $2305
+ADDRGP4 cg_drawClientItemTimer+12
+INDIRI4
+CNSTI4 1
+NEI4 $2305
+ADDRLP4 8
+ADDRGP4 $2308
+ASGNP4
+ADDRGP4 $2306
+JUMPV
+LABELV $2305
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+NEI4 $2309
+ADDRGP4 cg_drawClientItemTimer+12
+INDIRI4
+CNSTI4 1
+NEI4 $2309
+ADDRGP4 $2312
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRGP4 $2310
+JUMPV
+LABELV $2309
+ADDRGP4 $2313
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $2310
+LABELV $2306
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2314
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $2314
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $2316
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $2317
+JUMPV
+LABELV $2316
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $2318
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2318
+LABELV $2317
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2320
+ADDRFP4 0
+INDIRF4
+ADDRFP4 28
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+312
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2320
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 56
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $2292
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2294
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+691832
+INDIRI4
+LTI4 $2291
+ADDRFP4 4
+INDIRF4
+RETF4
+LABELV $2290
+endproc CG_DrawYellowArmorTimer 60 36
+proc CG_DrawGreenArmorTimer 60 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 44
+ADDRFP4 44
+INDIRF4
+ASGNF4
+ADDRFP4 48
+ADDRFP4 48
+INDIRP4
+ASGNP4
+ADDRFP4 52
+ADDRFP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 56
+ADDRFP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2328
+JUMPV
+LABELV $2325
+ADDRLP4 0
+CNSTI4 36
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+692416
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LEI4 $2331
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2332
+JUMPV
+LABELV $2331
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2332
+ADDRLP4 36
+CNSTI4 1000
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 36
+INDIRI4
+DIVI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 36
+INDIRI4
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -5
+GEI4 $2333
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2333
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2335
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2336
+JUMPV
+LABELV $2335
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $2336
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $2337
+ADDRLP4 44
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LTI4 $2337
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GEI4 $2337
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $2337
+ADDRLP4 4
+INDIRI4
+CNSTI4 -5
+GEI4 $2339
+ADDRGP4 cg_drawClientItemTimer+12
+INDIRI4
+CNSTI4 1
+NEI4 $2339
+ADDRLP4 8
+ADDRGP4 $2342
+ASGNP4
+ADDRGP4 $2340
+JUMPV
+LABELV $2339
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+NEI4 $2343
+ADDRGP4 cg_drawClientItemTimer+12
+INDIRI4
+CNSTI4 1
+NEI4 $2343
+ADDRGP4 $2346
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRGP4 $2344
+JUMPV
+LABELV $2343
+ADDRGP4 $2347
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $2344
+LABELV $2340
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2348
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $2348
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $2350
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $2351
+JUMPV
+LABELV $2350
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $2352
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2352
+LABELV $2351
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2354
+ADDRFP4 0
+INDIRF4
+ADDRFP4 28
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+320
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2354
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 56
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $2326
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2328
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+692412
+INDIRI4
+LTI4 $2325
+ADDRFP4 4
+INDIRF4
+RETF4
+LABELV $2324
+endproc CG_DrawGreenArmorTimer 60 36
+proc CG_DrawMegaHealthTimer 60 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 44
+ADDRFP4 44
+INDIRF4
+ASGNF4
+ADDRFP4 48
+ADDRFP4 48
+INDIRP4
+ASGNP4
+ADDRFP4 52
+ADDRFP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 56
+ADDRFP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2362
+JUMPV
+LABELV $2359
+ADDRLP4 0
+CNSTI4 36
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+692996
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LEI4 $2365
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2366
+JUMPV
+LABELV $2365
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2366
+ADDRLP4 36
+CNSTI4 1000
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 36
+INDIRI4
+DIVI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 36
+INDIRI4
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -5
+GEI4 $2367
+ADDRGP4 cgs+1957776
+INDIRI4
+CNSTI4 0
+NEI4 $2367
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2367
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2370
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2371
+JUMPV
+LABELV $2370
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $2371
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $2372
+ADDRLP4 44
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LTI4 $2372
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GEI4 $2372
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $2372
+ADDRGP4 cgs+1957776
+INDIRI4
+CNSTI4 0
+EQI4 $2374
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2377
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $2377
+ADDRLP4 56
+CNSTI4 1000
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+DIVI4
+CNSTI4 20
+ADDI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 56
+INDIRI4
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2380
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2378
+JUMPV
+LABELV $2380
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $2378
+JUMPV
+LABELV $2377
+ADDRLP4 4
+CNSTI4 -999
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $2378
+LABELV $2374
+ADDRLP4 4
+INDIRI4
+CNSTI4 -5
+GEI4 $2382
+ADDRGP4 cg_drawClientItemTimer+12
+INDIRI4
+CNSTI4 1
+NEI4 $2382
+ADDRLP4 8
+ADDRGP4 $2385
+ASGNP4
+ADDRGP4 $2383
+JUMPV
+LABELV $2382
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+NEI4 $2386
+ADDRGP4 cg_drawClientItemTimer+12
+INDIRI4
+CNSTI4 1
+NEI4 $2386
+ADDRGP4 $2389
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRGP4 $2387
+JUMPV
+LABELV $2386
+ADDRGP4 $2390
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $2387
+LABELV $2383
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2391
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $2391
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $2393
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $2394
+JUMPV
+LABELV $2393
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $2395
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2395
+LABELV $2394
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2397
+ADDRFP4 0
+INDIRF4
+ADDRFP4 28
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+324
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2397
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 56
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $2360
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2362
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+692992
+INDIRI4
+LTI4 $2359
+ADDRFP4 4
+INDIRF4
+RETF4
+LABELV $2358
+endproc CG_DrawMegaHealthTimer 60 36
+proc CG_DrawQuadDamageTimer 40 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 44
+ADDRFP4 44
+INDIRF4
+ASGNF4
+ADDRFP4 48
+ADDRFP4 48
+INDIRP4
+ASGNP4
+ADDRFP4 52
+ADDRFP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 56
+ADDRFP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2405
+JUMPV
+LABELV $2402
+ADDRLP4 20
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 1000
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+693576+16
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+DIVI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+693576+12
+ADDP4
+INDIRI4
+ADDI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2411
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2411
+ADDRGP4 $2413
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2414
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $2414
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $2416
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $2417
+JUMPV
+LABELV $2416
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $2418
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2418
+LABELV $2417
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2420
+ADDRFP4 0
+INDIRF4
+ADDRFP4 28
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+328
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2420
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 56
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $2403
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2405
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+693572
+INDIRI4
+LTI4 $2402
+ADDRFP4 4
+INDIRF4
+RETF4
+LABELV $2401
+endproc CG_DrawQuadDamageTimer 40 36
+proc CG_DrawBattleSuitTimer 40 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 44
+ADDRFP4 44
+INDIRF4
+ASGNF4
+ADDRFP4 48
+ADDRFP4 48
+INDIRP4
+ASGNP4
+ADDRFP4 52
+ADDRFP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 56
+ADDRFP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2428
+JUMPV
+LABELV $2425
+ADDRLP4 20
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 1000
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+694156+16
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+DIVI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+694156+12
+ADDP4
+INDIRI4
+ADDI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2434
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2434
+ADDRGP4 $2436
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2437
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $2437
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $2439
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $2440
+JUMPV
+LABELV $2439
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $2441
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2441
+LABELV $2440
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2443
+ADDRFP4 0
+INDIRF4
+ADDRFP4 28
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+332
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2443
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 56
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $2426
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2428
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+694152
+INDIRI4
+LTI4 $2425
+ADDRFP4 4
+INDIRF4
+RETF4
+LABELV $2424
+endproc CG_DrawBattleSuitTimer 40 36
+proc CG_DrawClientItemTimer 136 60
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $2458
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+EQI4 $2458
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $2458
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+EQI4 $2458
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $2448
+LABELV $2458
+ADDRGP4 $2447
+JUMPV
+LABELV $2448
+ADDRLP4 44
+ADDRGP4 cg_drawClientItemTimerX+8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg_drawClientItemTimerY+8
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg_drawClientItemTimerScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 100
+ADDRGP4 cg_drawClientItemTimerAlpha+12
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 cg_drawClientItemTimerStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawClientItemTimerWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawClientItemTimerFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2465
+ADDRLP4 32
+ADDRGP4 cgs+632912+753688
+ASGNP4
+ADDRGP4 $2466
+JUMPV
+LABELV $2465
+ADDRLP4 32
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $2466
+ADDRGP4 cg_drawClientItemTimerIcon+12
+INDIRI4
+CNSTI4 0
+NEI4 $2472
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2473
+JUMPV
+LABELV $2472
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+LABELV $2473
+ADDRLP4 56
+ADDRGP4 cg_drawClientItemTimerIconSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 cg_drawClientItemTimerIconXoffset+8
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 cg_drawClientItemTimerIconYoffset+8
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 cg_drawClientItemTimerAlign+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawClientItemTimerSpacing+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2479
+ADDRLP4 24
+ADDRGP4 cg_drawClientItemTimerSpacing+12
+INDIRI4
+ASGNI4
+ADDRGP4 $2480
+JUMPV
+LABELV $2479
+ADDRGP4 $2483
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 104
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+GEI4 $2484
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2485
+JUMPV
+LABELV $2484
+ADDRLP4 24
+CNSTF4 1067450368
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $2485
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2480
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2486
+ADDRLP4 36
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $2487
+JUMPV
+LABELV $2486
+ADDRLP4 36
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2487
+ADDRLP4 104
+ADDRGP4 CG_GameTimeout
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $2490
+ADDRLP4 40
+ADDRGP4 cgs+45340
+INDIRI4
+ASGNI4
+ADDRGP4 $2491
+JUMPV
+LABELV $2490
+ADDRLP4 40
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $2491
+ADDRGP4 cg_drawClientItemTimerTextColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2494
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 cg_drawClientItemTimerTextColor
+ARGP4
+ADDRGP4 cg_drawClientItemTimerAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRGP4 $2495
+JUMPV
+LABELV $2494
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 108
+INDIRF4
+ASGNF4
+LABELV $2495
+ADDRLP4 8+12
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 96
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_drawClientItemTimerFilter+16
+ASGNP4
+ADDRGP4 $2502
+JUMPV
+LABELV $2501
+ADDRLP4 112
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 120
+CNSTI4 103
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $2510
+ADDRLP4 112
+INDIRI4
+ADDRLP4 120
+INDIRI4
+GTI4 $2526
+LABELV $2525
+ADDRLP4 112
+INDIRI4
+CNSTI4 98
+EQI4 $2507
+ADDRGP4 $2505
+JUMPV
+LABELV $2526
+ADDRLP4 128
+CNSTI4 109
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 128
+INDIRI4
+EQI4 $2513
+ADDRLP4 112
+INDIRI4
+CNSTI4 113
+EQI4 $2516
+ADDRLP4 112
+INDIRI4
+CNSTI4 114
+EQI4 $2519
+ADDRLP4 112
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LTI4 $2505
+LABELV $2527
+ADDRLP4 112
+INDIRI4
+CNSTI4 121
+EQI4 $2522
+ADDRGP4 $2505
+JUMPV
+LABELV $2507
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $2505
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_DrawBattleSuitTimer
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRGP4 $2505
+JUMPV
+LABELV $2510
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $2505
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_DrawGreenArmorTimer
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRGP4 $2505
+JUMPV
+LABELV $2513
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $2505
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_DrawMegaHealthTimer
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRGP4 $2505
+JUMPV
+LABELV $2516
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $2505
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_DrawQuadDamageTimer
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRGP4 $2505
+JUMPV
+LABELV $2519
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $2505
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_DrawRedArmorTimer
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRGP4 $2505
+JUMPV
+LABELV $2522
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $2505
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_DrawYellowArmorTimer
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+LABELV $2505
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $2502
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2501
+LABELV $2447
+endproc CG_DrawClientItemTimer 136 60
+proc CG_DrawFxDebugEntities 4 16
+ADDRGP4 QLWideScreen
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2529
+ARGP4
+ADDRGP4 cg+6747380
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+CNSTI4 410
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1086324736
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $2528
+endproc CG_DrawFxDebugEntities 4 16
+proc CG_DrawOrigin 84 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332752
+INDIRI4
+CNSTI4 0
+EQI4 $2532
+ADDRLP4 4
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRGP4 $2533
+JUMPV
+LABELV $2532
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $2538
+ADDRLP4 4
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRGP4 $2539
+JUMPV
+LABELV $2538
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2544
+ADDRLP4 72
+CNSTI4 1496
+ASGNI4
+ADDRLP4 4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+12+12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRLP4 72
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+52+12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2545
+JUMPV
+LABELV $2544
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2545
+LABELV $2539
+LABELV $2533
+ADDRLP4 44
+ARGP4
+ADDRGP4 cg_drawOriginColor
+ARGP4
+ADDRGP4 cg_drawOriginAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRGP4 $2554
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 4+8
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 16+8
+INDIRF4
+ARGF4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRGP4 cg_drawOriginAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cg_drawOriginScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 cg_drawOriginStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawOriginWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawOriginFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2564
+ADDRLP4 32
+ADDRGP4 cgs+632912+1057164
+ASGNP4
+ADDRGP4 $2565
+JUMPV
+LABELV $2564
+ADDRLP4 32
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $2565
+ADDRLP4 36
+ADDRGP4 cg_drawOriginX+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ADDRGP4 cg_drawOriginY+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+NEI4 $2573
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $2574
+JUMPV
+LABELV $2573
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+NEI4 $2575
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2575
+LABELV $2574
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+RETF4
+LABELV $2531
+endproc CG_DrawOrigin 84 36
+proc CG_DrawTimer 68 16
+ADDRGP4 cg_qlhud+12
+INDIRI4
+CNSTI4 0
+EQI4 $2578
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2577
+JUMPV
+LABELV $2578
+CNSTP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_GetCurrentTimeWithDirection
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 60
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 10
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $2581
+ADDRLP4 44
+ADDRGP4 cg_warmupTime+12
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LTI4 $2584
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+GTI4 $2584
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2595
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2595
+address $2587
+address $2589
+address $2591
+address $2593
+code
+LABELV $2587
+ADDRGP4 $2588
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $2582
+JUMPV
+LABELV $2589
+ADDRGP4 $2590
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRGP4 $2582
+JUMPV
+LABELV $2591
+ADDRGP4 $2592
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $2582
+JUMPV
+LABELV $2593
+ADDRGP4 $2594
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRGP4 $2582
+JUMPV
+LABELV $2584
+ADDRGP4 $2588
+ARGP4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRGP4 $2582
+JUMPV
+LABELV $2581
+ADDRGP4 $2594
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+ASGNP4
+LABELV $2582
+ADDRGP4 QLWideScreen
+CNSTI4 3
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 44
+INDIRF4
+ASGNF4
+CNSTF4 1142865920
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $2577
+endproc CG_DrawTimer 68 16
+proc get_player_ping 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2602
+JUMPV
+LABELV $2599
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2604
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $2598
+JUMPV
+LABELV $2604
+LABELV $2600
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2602
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $2599
+CNSTI4 0
+RETI4
+LABELV $2598
+endproc get_player_ping 4 0
+proc CG_DrawTeamOverlay 244 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+NEI4 $2610
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2609
+JUMPV
+LABELV $2610
+ADDRLP4 44
+ADDRGP4 cg_drawTeamOverlayScale+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawTeamOverlayFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2614
+ADDRLP4 48
+ADDRGP4 cgs+632912+1143868
+ASGNP4
+ADDRGP4 $2615
+JUMPV
+LABELV $2614
+ADDRLP4 48
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $2615
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawTeamOverlayWideScreen+12
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRGP4 cg_drawTeamOverlayAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 112
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $2623
+ARGP4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawTeamOverlayLineOffset+8
+INDIRF4
+CNSTF4 0
+GEF4 $2624
+ADDRLP4 120
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2625
+JUMPV
+LABELV $2624
+ADDRLP4 120
+ADDRGP4 cg_drawTeamOverlayLineOffset+8
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2625
+ADDRLP4 48
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1058
+ARGP4
+ADDRLP4 148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2628
+ADDRLP4 128
+ADDRLP4 64
+INDIRF4
+NEGF4
+CVFI4 4
+ASGNI4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2629
+JUMPV
+LABELV $2628
+ADDRLP4 48
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1061
+ARGP4
+ADDRLP4 152
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $2630
+ADDRLP4 128
+ADDRLP4 64
+INDIRF4
+NEGF4
+CVFI4 4
+ASGNI4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2631
+JUMPV
+LABELV $2630
+ADDRLP4 48
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1064
+ARGP4
+ADDRLP4 156
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $2632
+ADDRLP4 128
+ADDRLP4 64
+INDIRF4
+NEGF4
+CVFI4 4
+ASGNI4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2633
+JUMPV
+LABELV $2632
+ADDRLP4 128
+ADDRLP4 64
+INDIRF4
+CNSTF4 1082130432
+DIVF4
+NEGF4
+CVFI4 4
+ASGNI4
+LABELV $2633
+LABELV $2631
+LABELV $2629
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlayMaxPlayers+12
+INDIRI4
+ADDRLP4 160
+INDIRI4
+GEI4 $2634
+ADDRLP4 80
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+ADDRGP4 $2635
+JUMPV
+LABELV $2634
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ADDRGP4 cg_drawTeamOverlayMaxPlayers+12
+INDIRI4
+LEI4 $2640
+ADDRLP4 164
+ADDRGP4 cg_drawTeamOverlayMaxPlayers+12
+INDIRI4
+ASGNI4
+ADDRGP4 $2641
+JUMPV
+LABELV $2640
+ADDRLP4 164
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+LABELV $2641
+ADDRLP4 80
+ADDRLP4 164
+INDIRI4
+ASGNI4
+LABELV $2635
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2642
+ADDRLP4 84
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2643
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $2643
+ADDRLP4 76
+INDIRI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $2643
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2609
+JUMPV
+LABELV $2642
+ADDRLP4 84
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2643
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2662
+JUMPV
+LABELV $2659
+ADDRGP4 cg_selfOnTeamOverlay+12
+INDIRI4
+CNSTI4 0
+NEI4 $2663
+ADDRLP4 84
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+NEI4 $2663
+ADDRGP4 $2660
+JUMPV
+LABELV $2663
+ADDRLP4 8
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2667
+ADDRLP4 8
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+NEI4 $2667
+ADDRLP4 116
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 168
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $2669
+ADDRLP4 68
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $2669
+LABELV $2667
+LABELV $2660
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2662
+ADDRLP4 4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LTI4 $2659
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $2671
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2609
+JUMPV
+LABELV $2671
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+CNSTF4 1094713344
+ADDRLP4 16
+INDIRF4
+MULF4
+LEF4 $2673
+ADDRLP4 68
+CNSTF4 1094713344
+ADDRLP4 16
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $2673
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $2675
+ADDRLP4 4
+INDIRI4
+CNSTI4 593
+ADDI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2679
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2679
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 172
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $2681
+ADDRLP4 60
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $2681
+LABELV $2679
+LABELV $2676
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $2675
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+CNSTF4 1098907648
+ADDRLP4 16
+INDIRF4
+MULF4
+LEF4 $2683
+ADDRLP4 60
+CNSTF4 1098907648
+ADDRLP4 16
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $2683
+ADDRLP4 108
+ADDRLP4 68
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDI4
+CVIF4 4
+CNSTF4 1082130432
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1088421888
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 116
+INDIRI4
+CVIF4 4
+ADDRLP4 64
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 124
+INDIRF4
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIF4 4
+ADDRLP4 120
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+ADDRGP4 cg_drawTeamOverlayX+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawTeamOverlayY+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2686
+ADDRFP4 0
+ADDRGP4 cg_drawTeamOverlayY+8
+INDIRF4
+ASGNF4
+LABELV $2686
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+NEI4 $2690
+ADDRLP4 88
+ADDRLP4 88
+INDIRF4
+ADDRLP4 108
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $2691
+JUMPV
+LABELV $2690
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+NEI4 $2692
+ADDRLP4 88
+ADDRLP4 88
+INDIRF4
+ADDRLP4 108
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2692
+LABELV $2691
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2694
+ADDRLP4 136
+ADDRFP4 0
+INDIRF4
+ADDRLP4 124
+INDIRF4
+ADDF4
+CNSTF4 1094713344
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2695
+JUMPV
+LABELV $2694
+ADDRLP4 136
+ADDRFP4 0
+INDIRF4
+ADDRLP4 124
+INDIRF4
+SUBF4
+CNSTF4 1094713344
+ADDRLP4 44
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $2695
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2696
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2698
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $2699
+JUMPV
+LABELV $2698
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2699
+LABELV $2696
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+NEI4 $2700
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+12
+CNSTF4 1051260355
+ADDRLP4 112
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $2701
+JUMPV
+LABELV $2700
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28+12
+CNSTF4 1051260355
+ADDRLP4 112
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2701
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2708
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2710
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2712
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $2709
+JUMPV
+LABELV $2712
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $2709
+JUMPV
+LABELV $2710
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2718
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 124
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $2709
+JUMPV
+LABELV $2718
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 124
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $2709
+JUMPV
+LABELV $2708
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2724
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1082130432
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRGP4 cgs+632912+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $2725
+JUMPV
+LABELV $2724
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 176
+ADDRLP4 64
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 124
+INDIRF4
+SUBF4
+ADDRLP4 176
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 176
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 cgs+632912+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2725
+LABELV $2709
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $2730
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2732
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2733
+JUMPV
+LABELV $2732
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+ADDRLP4 44
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $2733
+LABELV $2730
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2737
+JUMPV
+LABELV $2734
+ADDRGP4 cg_selfOnTeamOverlay+12
+INDIRI4
+CNSTI4 0
+NEI4 $2738
+ADDRLP4 84
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+NEI4 $2738
+ADDRGP4 $2735
+JUMPV
+LABELV $2738
+ADDRLP4 196
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ASGNP4
+ADDRLP4 176
+CNSTI4 1496
+ADDRLP4 196
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 4524
+ADDRLP4 196
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 172
+ADDRLP4 8
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 8
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 8
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 8
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2742
+ADDRLP4 172
+ADDRLP4 176
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 176
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CNSTI4 32767
+LEI4 $2746
+ADDRLP4 204
+CNSTI4 65536
+ADDRLP4 176
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+SUBI4
+NEGI4
+ASGNI4
+ADDRGP4 $2747
+JUMPV
+LABELV $2746
+ADDRLP4 204
+ADDRLP4 176
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2747
+ADDRLP4 180
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 32767
+LEI4 $2749
+ADDRLP4 208
+CNSTI4 65536
+ADDRLP4 176
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+SUBI4
+NEGI4
+ASGNI4
+ADDRGP4 $2750
+JUMPV
+LABELV $2749
+ADDRLP4 208
+ADDRLP4 176
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2750
+ADDRLP4 184
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 176
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2743
+JUMPV
+LABELV $2742
+ADDRLP4 204
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $2751
+ADDRLP4 212
+CNSTI4 2
+ASGNI4
+ADDRLP4 208
+ADDRLP4 4
+INDIRI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 176
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 220
+ADDRLP4 208
+INDIRI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 220
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 8
+RSHU4
+CNSTU4 63
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 224
+CNSTI4 356
+ASGNI4
+ADDRLP4 228
+CNSTU4 255
+ASGNU4
+ADDRLP4 180
+ADDRLP4 220
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 24
+RSHU4
+ADDRLP4 228
+INDIRU4
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 220
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 16
+RSHU4
+ADDRLP4 228
+INDIRU4
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 176
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2751
+LABELV $2743
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2756
+ADDRLP4 8
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+NEI4 $2756
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 get_player_ping
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+GEI4 $2758
+ADDRLP4 28
+ADDRGP4 colorYellow
+INDIRB
+ASGNB 12
+ADDRLP4 28+12
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRGP4 $2759
+JUMPV
+LABELV $2758
+ADDRLP4 216
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRLP4 28+12
+ADDRLP4 112
+INDIRF4
+ASGNF4
+LABELV $2759
+ADDRLP4 12
+ADDRLP4 88
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Limit_Bottom
+CALLV
+pop
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $2764
+ADDRLP4 192
+INDIRI4
+CNSTI4 593
+ADDI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 224
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2768
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2766
+LABELV $2768
+ADDRLP4 24
+ADDRGP4 $672
+ASGNP4
+LABELV $2766
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 232
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $2769
+ADDRLP4 52
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $2769
+ADDRLP4 12
+ADDRLP4 88
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Limit_Bottom
+CALLV
+pop
+LABELV $2764
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 CG_FreezeTagFrozen
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+EQI4 $2771
+ADDRLP4 24
+ADDRGP4 $2773
+ASGNP4
+ADDRLP4 28
+ADDRGP4 colorBlue
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRGP4 colorBlue+4
+INDIRF4
+ASGNF4
+ADDRLP4 28+8
+ADDRGP4 colorBlue+8
+INDIRF4
+ASGNF4
+ADDRLP4 28+12
+ADDRGP4 colorBlue+12
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 88
+INDIRF4
+CNSTF4 1077936128
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Limit_Bottom
+CALLV
+pop
+ADDRGP4 $2772
+JUMPV
+LABELV $2771
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 28+12
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 92
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $2781
+ARGP4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 228
+CNSTF4 1077936128
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 88
+INDIRF4
+ADDRLP4 228
+INDIRF4
+ADDF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+ADDRLP4 228
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Limit_Bottom
+CALLV
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2782
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1077936128
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2783
+JUMPV
+LABELV $2782
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1075838976
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2783
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $2784
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 128
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+340
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $2785
+JUMPV
+LABELV $2784
+CNSTI4 132
+ADDRLP4 188
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2788
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 128
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+CNSTI4 132
+ADDRLP4 188
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $2789
+JUMPV
+LABELV $2788
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 128
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+340
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2789
+LABELV $2785
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2794
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2795
+JUMPV
+LABELV $2794
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1069547520
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2795
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+CNSTF4 1077936128
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $2781
+ARGP4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 56
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Limit_Bottom
+CALLV
+pop
+LABELV $2772
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2796
+ADDRLP4 12
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 $2797
+JUMPV
+LABELV $2796
+ADDRLP4 12
+ADDRLP4 88
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2797
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2801
+JUMPV
+LABELV $2798
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2802
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 228
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2804
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2804
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2806
+ADDRLP4 20
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $2807
+JUMPV
+LABELV $2806
+ADDRLP4 20
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+ADDRLP4 44
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2807
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2808
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $2809
+JUMPV
+LABELV $2808
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2809
+LABELV $2804
+LABELV $2802
+LABELV $2799
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2801
+ADDRLP4 0
+INDIRI4
+ADDRGP4 PW_NUM_POWERUPS
+INDIRI4
+LEI4 $2798
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2810
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $2811
+JUMPV
+LABELV $2810
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2811
+LABELV $2756
+LABELV $2735
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2737
+ADDRLP4 4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LTI4 $2734
+ADDRLP4 136
+INDIRI4
+CVIF4 4
+RETF4
+LABELV $2609
+endproc CG_DrawTeamOverlay 244 36
+proc CG_DrawUpperRight 12 12
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $2813
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 1
+NEI4 $2813
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $2813
+ADDRGP4 cg_drawSnapshot+12
+INDIRI4
+CNSTI4 0
+EQI4 $2817
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawSnapshot
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2817
+ADDRGP4 cg_drawFPS+12
+INDIRI4
+CNSTI4 0
+EQI4 $2820
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawFPS
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2820
+ADDRGP4 cg_drawSpeed+12
+INDIRI4
+CNSTI4 0
+EQI4 $2823
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Wolfcam_DrawSpeed
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2823
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Wolfcam_DrawMouseSpeed
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawTimer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2826
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawTimer
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $2826
+ADDRGP4 cg_drawAttacker+12
+INDIRI4
+CNSTI4 0
+EQI4 $2829
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawAttacker
+CALLF4
+pop
+LABELV $2829
+LABELV $2812
+endproc CG_DrawUpperRight 12 12
+proc CG_DrawUpperLeft 8 4
+ADDRLP4 0
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 cg_drawOrigin+12
+INDIRI4
+CNSTI4 0
+EQI4 $2833
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawOrigin
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2833
+LABELV $2832
+endproc CG_DrawUpperLeft 8 4
+proc CG_DrawPlayersLeft 48 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg_qlhud+12
+INDIRI4
+CNSTI4 0
+EQI4 $2837
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2836
+JUMPV
+LABELV $2837
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $2840
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $2840
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+EQI4 $2840
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $2840
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+EQI4 $2840
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2836
+JUMPV
+LABELV $2840
+ADDRGP4 QLWideScreen
+CNSTI4 3
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+NEI4 $2847
+ADDRLP4 12
+ADDRGP4 cgs+1957816
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+1957820
+INDIRI4
+ASGNI4
+ADDRGP4 $2848
+JUMPV
+LABELV $2847
+ADDRLP4 12
+ADDRGP4 cgs+43260
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+43264
+INDIRI4
+ASGNI4
+LABELV $2848
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1142947840
+ASGNF4
+ADDRGP4 $2854
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 28
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+632912+492456
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $2854
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+632912+492452
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRLP4 20
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+RETF4
+LABELV $2836
+endproc CG_DrawPlayersLeft 48 20
+proc CG_DrawScores 96 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg_qlhud+12
+INDIRI4
+CNSTI4 0
+EQI4 $2864
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $2863
+JUMPV
+LABELV $2864
+ADDRGP4 QLWideScreen
+CNSTI4 3
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2867
+ADDRLP4 40
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2868
+JUMPV
+LABELV $2867
+ADDRLP4 40
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $2873
+ADDRLP4 40
+CNSTI4 3
+ASGNI4
+LABELV $2873
+LABELV $2868
+ADDRLP4 28
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $2877
+ADDRLP4 16
+CNSTF4 1142947840
+ASGNF4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $2854
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 68
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+NEI4 $2885
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+632912+472
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2885
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $2893
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $2889
+LABELV $2893
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2894
+ADDRLP4 36
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cgs+43252
+INDIRI4
+CNSTI4 0
+LTI4 $2896
+ADDRGP4 cgs+43252
+INDIRI4
+CNSTI4 2
+GTI4 $2896
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+43252
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+76
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2896
+LABELV $2894
+LABELV $2889
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $2854
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 80
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+NEI4 $2908
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+632912+472
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2908
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $2916
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $2912
+LABELV $2916
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2917
+ADDRLP4 36
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cgs+43248
+INDIRI4
+CNSTI4 0
+LTI4 $2919
+ADDRGP4 cgs+43248
+INDIRI4
+CNSTI4 2
+GTI4 $2919
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+43248
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+64
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2919
+LABELV $2917
+LABELV $2912
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2926
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2929
+ADDRLP4 36
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 0
+LTI4 $2931
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 4
+GTI4 $2931
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+88
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2931
+LABELV $2929
+LABELV $2926
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+LTI4 $2938
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+GEI4 $2938
+ADDRLP4 52
+ADDRGP4 cgs+39716
+INDIRI4
+ASGNI4
+ADDRGP4 $2939
+JUMPV
+LABELV $2938
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $2947
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $2943
+LABELV $2947
+ADDRLP4 52
+ADDRGP4 cgs+39708
+INDIRI4
+ASGNI4
+ADDRGP4 $2944
+JUMPV
+LABELV $2943
+ADDRLP4 52
+ADDRGP4 cgs+39704
+INDIRI4
+ASGNI4
+LABELV $2944
+LABELV $2939
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $2878
+ADDRGP4 $2854
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRLP4 92
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 92
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $2878
+JUMPV
+LABELV $2877
+ADDRLP4 16
+CNSTF4 1142947840
+ASGNF4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2954
+ADDRLP4 64
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2957
+ADDRLP4 44
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2955
+JUMPV
+LABELV $2957
+ADDRLP4 44
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2955
+JUMPV
+LABELV $2954
+ADDRLP4 64
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2966
+ADDRLP4 44
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $2967
+JUMPV
+LABELV $2966
+ADDRLP4 44
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2967
+LABELV $2955
+CNSTI4 4524
+ADDRLP4 64
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2973
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2974
+JUMPV
+LABELV $2973
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $2974
+ADDRLP4 60
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $2975
+ADDRLP4 32
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $2975
+ADDRLP4 32
+INDIRI4
+CNSTI4 -9999
+EQI4 $2977
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $2979
+ADDRGP4 $2982
+ARGP4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $2980
+JUMPV
+LABELV $2979
+ADDRGP4 $2854
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+LABELV $2980
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 76
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $2985
+ADDRLP4 80
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $2985
+ADDRLP4 80
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $2985
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+632912+472
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $2986
+JUMPV
+LABELV $2985
+ADDRLP4 84
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $2986
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $2977
+ADDRLP4 28
+INDIRI4
+CNSTI4 -9999
+EQI4 $2995
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $2997
+ADDRGP4 $2982
+ARGP4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $2998
+JUMPV
+LABELV $2997
+ADDRGP4 $2854
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+LABELV $2998
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 76
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $3002
+ADDRLP4 44
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $3002
+ADDRLP4 80
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+632912+472
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $3003
+JUMPV
+LABELV $3002
+ADDRLP4 80
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $3003
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $2995
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+EQI4 $3012
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+EQI4 $3012
+ADDRGP4 cgs+39704
+INDIRI4
+CNSTI4 0
+EQI4 $3016
+ADDRGP4 $2854
+ARGP4
+ADDRGP4 cgs+39704
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 80
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $3017
+JUMPV
+LABELV $3016
+ADDRGP4 cgs+39708
+INDIRI4
+CNSTI4 0
+EQI4 $3022
+ADDRGP4 $2854
+ARGP4
+ADDRGP4 cgs+39708
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 80
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $3022
+LABELV $3017
+LABELV $3012
+LABELV $2878
+ADDRLP4 36
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+RETF4
+LABELV $2863
+endproc CG_DrawScores 96 20
+lit
+align 4
+LABELV $3029
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+align 4
+LABELV $3063
+address PW_QUAD
+address PW_BATTLESUIT
+address PW_HASTE
+address PW_INVIS
+address PW_REGEN
+address PW_FLIGHT
+address PW_INVULNERABILITY
+code
+proc CG_DrawPowerups 220 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg_qlhud+12
+INDIRI4
+CNSTI4 0
+EQI4 $3030
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $3028
+JUMPV
+LABELV $3030
+ADDRGP4 QLWideScreen
+CNSTI4 3
+ASGNI4
+ADDRLP4 172
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $3033
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 176
+INDIRI4
+NEI4 $3033
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $3028
+JUMPV
+LABELV $3033
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $3035
+ADDRLP4 156
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 156
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $3038
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $3028
+JUMPV
+LABELV $3038
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 180
+INDIRI4
+ASGNI4
+LABELV $3040
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 156
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3044
+ADDRGP4 $3041
+JUMPV
+LABELV $3044
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 156
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 2147483647
+NEI4 $3046
+ADDRGP4 $3041
+JUMPV
+LABELV $3046
+ADDRLP4 144
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 156
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GTI4 $3049
+ADDRGP4 $3041
+JUMPV
+LABELV $3049
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3054
+JUMPV
+LABELV $3051
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LTI4 $3055
+ADDRLP4 0
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $3060
+JUMPV
+LABELV $3057
+ADDRLP4 184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 68+4
+ADDP4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3058
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $3060
+ADDRLP4 0
+INDIRI4
+ADDRLP4 132
+INDIRI4
+GEI4 $3057
+ADDRGP4 $3053
+JUMPV
+LABELV $3055
+LABELV $3052
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3054
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $3051
+LABELV $3053
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3041
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 16
+LTI4 $3040
+ADDRGP4 $3036
+JUMPV
+LABELV $3035
+ADDRLP4 180
+ADDRGP4 $3063
+INDIRB
+ASGNB 28
+ADDRLP4 156
+CNSTP4 0
+ASGNP4
+ADDRLP4 208
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3066
+JUMPV
+ADDRGP4 $3068
+ARGP4
+CNSTU4 7
+ARGU4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $3028
+JUMPV
+LABELV $3066
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $3072
+JUMPV
+LABELV $3069
+ADDRLP4 208
+INDIRI4
+CNSTI4 1
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 180
+ADDP4
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $3073
+ADDRLP4 216
+CNSTI4 2
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 216
+INDIRI4
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 136
+INDIRI4
+ADDRLP4 216
+INDIRI4
+LSHI4
+ADDRLP4 180
+ADDP4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3073
+LABELV $3070
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3072
+ADDRLP4 136
+INDIRI4
+CVIU4 4
+CNSTU4 7
+LTU4 $3069
+LABELV $3036
+ADDRLP4 168
+CNSTI4 528
+ASGNI4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3078
+JUMPV
+LABELV $3075
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3079
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3079
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1111490560
+SUBF4
+ASGNF4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3081
+ADDRLP4 144
+CNSTI4 -1
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRGP4 PW_QUAD
+INDIRI4
+NEI4 $3083
+ADDRGP4 cg+693572
+INDIRI4
+CNSTI4 1
+NEI4 $3082
+ADDRLP4 144
+ADDRGP4 cg+693576+16
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRGP4 cg+693576+16
+INDIRI4
+CNSTI4 1000
+ADDRLP4 148
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $3082
+JUMPV
+LABELV $3083
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+NEI4 $3082
+ADDRGP4 cg+694152
+INDIRI4
+CNSTI4 1
+NEI4 $3082
+ADDRLP4 144
+ADDRGP4 cg+694156+16
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRGP4 cg+694156+16
+INDIRI4
+CNSTI4 1000
+ADDRLP4 148
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $3082
+JUMPV
+LABELV $3081
+ADDRLP4 184
+CNSTI4 2
+ASGNI4
+ADDRLP4 144
+ADDRLP4 136
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRLP4 156
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3082
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $3029
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $3103
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 184
+CNSTI4 2
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+LABELV $3103
+ADDRLP4 144
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $3105
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $3106
+JUMPV
+LABELV $3105
+ADDRLP4 160
+ADDRLP4 144
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 160
+INDIRF4
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 184+12
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $3106
+ADDRGP4 cg+627152
+INDIRI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+NEI4 $3112
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+627156
+INDIRI4
+SUBI4
+CNSTI4 200
+GEI4 $3112
+ADDRLP4 184
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 160
+ADDRLP4 184
+INDIRF4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+627156
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 152
+CNSTF4 1111490560
+CNSTF4 1056964608
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDRLP4 184
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $3113
+JUMPV
+LABELV $3112
+ADDRLP4 152
+CNSTF4 1111490560
+ASGNF4
+LABELV $3113
+ADDRLP4 148
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+CNSTF4 1142947840
+ADDRLP4 152
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $3079
+LABELV $3076
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3078
+ADDRLP4 136
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $3075
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $3028
+endproc CG_DrawPowerups 220 20
+proc CG_DrawLowerRight 8 12
+ADDRLP4 0
+CNSTF4 1138229248
+ASGNF4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $3120
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 2
+NEI4 $3120
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $3120
+ADDRGP4 cg_drawScores+12
+INDIRI4
+CNSTI4 0
+EQI4 $3124
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawScores
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $3124
+ADDRGP4 cg_drawPlayersLeft+12
+INDIRI4
+CNSTI4 0
+EQI4 $3127
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawPlayersLeft
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $3127
+ADDRGP4 cg_drawPowerups+12
+INDIRI4
+CNSTI4 0
+EQI4 $3130
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawPowerups
+CALLF4
+pop
+LABELV $3130
+LABELV $3119
+endproc CG_DrawLowerRight 8 12
+proc CG_DrawPickupItem 1408 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $3134
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $3133
+JUMPV
+LABELV $3134
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+627404
+INDIRI4
+SUBI4
+ADDRGP4 cg_drawItemPickupsTime+12
+INDIRI4
+LEI4 $3137
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $3133
+JUMPV
+LABELV $3137
+ADDRLP4 8
+ARGP4
+ADDRGP4 cg_drawItemPickupsColor
+ARGP4
+ADDRGP4 cg_drawItemPickupsAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRGP4 cg_drawItemPickupsFade+12
+INDIRI4
+CNSTI4 0
+EQI4 $3142
+ADDRGP4 cg+627404
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawItemPickupsFadeTime+12
+INDIRI4
+ARGI4
+ADDRLP4 340
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 184
+ADDRLP4 340
+INDIRP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3147
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $3133
+JUMPV
+LABELV $3147
+ADDRLP4 8+12
+ADDRLP4 8+12
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 184
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+LABELV $3142
+ADDRLP4 8+12
+INDIRF4
+CNSTF4 0
+GTF4 $3150
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $3133
+JUMPV
+LABELV $3150
+ADDRLP4 40
+ADDRLP4 8
+ASGNP4
+ADDRLP4 172
+ADDRGP4 cg_drawItemPickupsAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cg_drawItemPickupsScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1111490560
+ADDRGP4 cg_drawItemPickupsImageScale+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 188
+ADDRGP4 cg_drawItemPickupsStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawItemPickupsWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawItemPickupsFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3158
+ADDRLP4 32
+ADDRGP4 cgs+632912+1035488
+ASGNP4
+ADDRGP4 $3159
+JUMPV
+LABELV $3158
+ADDRLP4 32
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $3159
+ADDRLP4 36
+ADDRGP4 cg_drawItemPickupsX+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ADDRGP4 cg_drawItemPickupsY+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+627400
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $3168
+ADDRLP4 324
+ADDRGP4 cg+627408
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 324
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 344
+CNSTI4 60
+ASGNI4
+ADDRLP4 176
+ADDRLP4 24
+INDIRI4
+ADDRLP4 344
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 348
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 344
+INDIRI4
+ADDRLP4 348
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 356
+CNSTI4 10
+ASGNI4
+ADDRLP4 180
+ADDRLP4 24
+INDIRI4
+ADDRLP4 356
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 360
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 356
+INDIRI4
+ADDRLP4 360
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 196
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $2594
+ARGP4
+ADDRLP4 348
+INDIRI4
+ARGI4
+ADDRLP4 360
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 44
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $3171
+ARGP4
+ADDRGP4 cg+627416
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+627416
+INDIRI4
+CNSTI4 1
+LEI4 $3173
+ADDRGP4 $3176
+ARGP4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 364
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 336
+ADDRLP4 364
+INDIRP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 368
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 372
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 328
+ADDRLP4 372
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $3174
+JUMPV
+LABELV $3173
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRLP4 328
+CNSTI4 0
+ASGNI4
+LABELV $3174
+ADDRGP4 cg_drawItemPickups+12
+INDIRI4
+CNSTI4 1
+NEI4 $3179
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+NEI4 $3182
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 328
+INDIRI4
+ADDI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 $3183
+JUMPV
+LABELV $3182
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+NEI4 $3184
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 328
+INDIRI4
+ADDI4
+CVIF4 4
+SUBF4
+ASGNF4
+LABELV $3184
+LABELV $3183
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 364
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 364
+INDIRF4
+ARGF4
+ADDRLP4 364
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 cg+627416
+INDIRI4
+CNSTI4 1
+LEI4 $3180
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 372
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 372
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 372
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $3180
+JUMPV
+LABELV $3179
+ADDRGP4 cg_drawItemPickups+12
+INDIRI4
+CNSTI4 2
+NEI4 $3190
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+NEI4 $3194
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $3195
+JUMPV
+LABELV $3194
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+NEI4 $3196
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ADDF4
+SUBF4
+ASGNF4
+LABELV $3196
+LABELV $3195
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 368
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 368
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 368
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cg+627416
+INDIRI4
+CNSTI4 1
+LEI4 $3191
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 372
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 372
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 372
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $3191
+JUMPV
+LABELV $3190
+ADDRGP4 cg_drawItemPickups+12
+INDIRI4
+CNSTI4 3
+NEI4 $3202
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 332
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+NEI4 $3206
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $3207
+JUMPV
+LABELV $3206
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+NEI4 $3208
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ADDF4
+SUBF4
+ASGNF4
+LABELV $3208
+LABELV $3207
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 368
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 368
+INDIRF4
+ARGF4
+ADDRLP4 368
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 36
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRLP4 376
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 376
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 376
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cg+627416
+INDIRI4
+CNSTI4 1
+LEI4 $3203
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 380
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 380
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRLP4 388
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 388
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 388
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $3203
+JUMPV
+LABELV $3202
+ADDRGP4 cg_drawItemPickups+12
+INDIRI4
+CNSTI4 4
+NEI4 $3216
+ADDRLP4 196
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+NEI4 $3219
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $3220
+JUMPV
+LABELV $3219
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+NEI4 $3221
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ADDF4
+SUBF4
+ASGNF4
+LABELV $3221
+LABELV $3220
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 368
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 368
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 368
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 196
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cg+627416
+INDIRI4
+CNSTI4 1
+LEI4 $3217
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 372
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 372
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 372
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $3217
+JUMPV
+LABELV $3216
+ADDRGP4 cg_drawItemPickups+12
+INDIRI4
+CNSTI4 5
+NEI4 $3226
+ADDRLP4 196
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 332
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+NEI4 $3229
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $3230
+JUMPV
+LABELV $3229
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+NEI4 $3231
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ADDF4
+SUBF4
+ASGNF4
+LABELV $3231
+LABELV $3230
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 368
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 368
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 368
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 196
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 196
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 372
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 376
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 376
+INDIRF4
+ARGF4
+ADDRLP4 376
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 cg+627416
+INDIRI4
+CNSTI4 1
+LEI4 $3227
+ADDRLP4 380
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 380
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 380
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 388
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 388
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 388
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3226
+ADDRGP4 cg_drawItemPickups+12
+INDIRI4
+CNSTI4 6
+NEI4 $3237
+ADDRLP4 364
+ARGP4
+ADDRLP4 196
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $3240
+ARGP4
+ADDRLP4 364
+ARGP4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1388
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1388
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 1392
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 1392
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+NEI4 $3242
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $3243
+JUMPV
+LABELV $3242
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+NEI4 $3244
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ADDF4
+SUBF4
+ASGNF4
+LABELV $3244
+LABELV $3243
+ADDRGP4 $3240
+ARGP4
+ADDRLP4 364
+ARGP4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 1400
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 1400
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 1400
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 1396
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cg+627416
+INDIRI4
+CNSTI4 1
+LEI4 $3238
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 1404
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 1404
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 1404
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $3238
+JUMPV
+LABELV $3237
+ADDRGP4 cg_drawItemPickups+12
+INDIRI4
+CNSTI4 7
+NEI4 $3250
+ADDRLP4 196
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 332
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 368
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 332
+INDIRF4
+ADDRLP4 368
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+NEI4 $3254
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $3255
+JUMPV
+LABELV $3254
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+NEI4 $3256
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ADDF4
+SUBF4
+ASGNF4
+LABELV $3256
+LABELV $3255
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 372
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 372
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 372
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 196
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 196
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 376
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 380
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 380
+INDIRF4
+ARGF4
+ADDRLP4 380
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1098907648
+ADDF4
+ARGF4
+ADDRLP4 388
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 388
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 388
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cg+627416
+INDIRI4
+CNSTI4 1
+LEI4 $3260
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 392
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 392
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 396
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDRLP4 396
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDF4
+ADDRLP4 396
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $3260
+LABELV $3250
+LABELV $3238
+LABELV $3227
+LABELV $3217
+LABELV $3203
+LABELV $3191
+LABELV $3180
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $3168
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDF4
+RETF4
+LABELV $3133
+endproc CG_DrawPickupItem 1408 36
+proc CG_DrawLowerLeft 16 12
+ADDRLP4 0
+CNSTF4 1138229248
+ASGNF4
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $3265
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $3265
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $3265
+ADDRGP4 cg_drawItemPickups+12
+INDIRI4
+CNSTI4 0
+EQI4 $3269
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawPickupItem
+CALLF4
+pop
+LABELV $3269
+LABELV $3264
+endproc CG_DrawLowerLeft 16 12
+proc CG_DrawTeamInfo 48 40
+ADDRGP4 QLWideScreen
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+CNSTI4 8
+GEI4 $3273
+ADDRLP4 20
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+ASGNI4
+ADDRGP4 $3274
+JUMPV
+LABELV $3273
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+LABELV $3274
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GTI4 $3277
+ADDRGP4 $3272
+JUMPV
+LABELV $3277
+ADDRGP4 cgs+632804
+INDIRI4
+ADDRGP4 cgs+632800
+INDIRI4
+EQI4 $3279
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+632804
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632768
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg_teamChatTime+12
+INDIRI4
+LEI4 $3283
+ADDRLP4 28
+ADDRGP4 cgs+632804
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3283
+ADDRLP4 24
+ADDRGP4 cgs+632800
+INDIRI4
+ADDRGP4 cgs+632804
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+CVIF4 4
+ASGNF4
+CNSTI4 4524
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3292
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $3293
+JUMPV
+LABELV $3292
+CNSTI4 4524
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3300
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $3301
+JUMPV
+LABELV $3300
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $3301
+LABELV $3293
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 28
+ADDRLP4 24
+INDIRF4
+ASGNF4
+CNSTF4 1137836032
+ADDRLP4 28
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cgs+632800
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $3319
+JUMPV
+LABELV $3316
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 420
+ADDRGP4 cgs+632800
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+SUBI4
+ARGI4
+CNSTI4 241
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+630840
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+558644
+ARGP4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $3317
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $3319
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+632804
+INDIRI4
+GEI4 $3316
+LABELV $3279
+LABELV $3272
+endproc CG_DrawTeamInfo 48 40
+proc CG_DrawHoldableItem 8 20
+ADDRGP4 cg_qlhud+12
+INDIRI4
+CNSTI4 0
+EQI4 $3327
+ADDRGP4 $3326
+JUMPV
+LABELV $3327
+ADDRGP4 QLWideScreen
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+ADDRGP4 STAT_HOLDABLE_ITEM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $3331
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+CNSTF4 1142161408
+ARGF4
+CNSTF4 1129840640
+ARGF4
+ADDRLP4 4
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $3331
+LABELV $3326
+endproc CG_DrawHoldableItem 8 20
+proc CG_RewardAnnouncements 16 8
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+627172
+INDIRI4
+SUBI4
+ADDRGP4 cg_drawRewardsTime+12
+INDIRI4
+LTI4 $3335
+ADDRGP4 cg+627168
+INDIRI4
+CNSTI4 0
+LEI4 $3334
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3346
+JUMPV
+LABELV $3343
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+627256
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+627256+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+627216
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+627216+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+627176
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+627176+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3344
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3346
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+627168
+INDIRI4
+LTI4 $3343
+ADDRGP4 cg+627172
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+627168
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg_audioAnnouncerRewards+12
+INDIRI4
+CNSTI4 0
+EQI4 $3341
+ADDRGP4 cg+627256
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $3341
+LABELV $3335
+LABELV $3334
+endproc CG_RewardAnnouncements 16 8
+proc CG_DrawReward 188 36
+ADDRGP4 cg_drawRewards+12
+INDIRI4
+CNSTI4 0
+NEI4 $3365
+ADDRGP4 $3364
+JUMPV
+LABELV $3365
+ADDRLP4 68
+ARGP4
+ADDRGP4 cg+627172
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawRewardsTime+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawRewardsFadeTime+12
+INDIRI4
+ARGI4
+ADDRGP4 CG_FadeColorVec4
+CALLV
+pop
+ADDRLP4 68+12
+INDIRF4
+CNSTF4 0
+NEF4 $3371
+ADDRGP4 $3364
+JUMPV
+LABELV $3371
+ADDRGP4 cg_drawRewardsFade+12
+INDIRI4
+CNSTI4 0
+NEI4 $3374
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 68
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 68+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 68+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $3374
+ADDRGP4 cg_drawRewardsColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3380
+ADDRLP4 68
+ARGP4
+ADDRGP4 cg_drawRewardsColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+LABELV $3380
+ADDRGP4 cg_drawRewardsAlpha+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3383
+ADDRLP4 68+12
+ADDRGP4 cg_drawRewardsAlpha+12
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+CNSTF4 1065353216
+ADDRLP4 68+12
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+LABELV $3383
+ADDRLP4 68
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg_drawRewardsFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3389
+ADDRLP4 60
+ADDRGP4 cgs+632912+710336
+ASGNP4
+ADDRGP4 $3390
+JUMPV
+LABELV $3389
+ADDRLP4 60
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $3390
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawRewardsWideScreen+12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg_drawRewardsImageScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1111490560
+ADDRLP4 4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_drawRewards+12
+INDIRI4
+CNSTI4 3
+NEI4 $3398
+ADDRLP4 100
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 40
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 $3404
+JUMPV
+LABELV $3401
+ADDRLP4 172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 168
+ADDRLP4 172
+INDIRI4
+ADDRGP4 cg+627216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cgs+632912+492476
+INDIRI4
+NEI4 $3407
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $3411
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 100
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3402
+JUMPV
+LABELV $3411
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $3408
+JUMPV
+LABELV $3407
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cgs+632912+492480
+INDIRI4
+NEI4 $3413
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $3417
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 100
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3402
+JUMPV
+LABELV $3417
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $3414
+JUMPV
+LABELV $3413
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cgs+632912+492484
+INDIRI4
+NEI4 $3419
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $3423
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 100
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3402
+JUMPV
+LABELV $3423
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRLP4 148
+ADDRLP4 148
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $3420
+JUMPV
+LABELV $3419
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cgs+632912+492488
+INDIRI4
+NEI4 $3425
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $3429
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 100
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3402
+JUMPV
+LABELV $3429
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $3426
+JUMPV
+LABELV $3425
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cgs+632912+492492
+INDIRI4
+NEI4 $3431
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $3435
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 100
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3402
+JUMPV
+LABELV $3435
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRLP4 156
+ADDRLP4 156
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $3432
+JUMPV
+LABELV $3431
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cgs+632912+492496
+INDIRI4
+NEI4 $3437
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $3441
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 100
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3402
+JUMPV
+LABELV $3441
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRLP4 160
+ADDRLP4 160
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $3437
+LABELV $3432
+LABELV $3426
+LABELV $3420
+LABELV $3414
+LABELV $3408
+LABELV $3402
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3404
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+627168
+INDIRI4
+CNSTI4 1
+ADDI4
+LTI4 $3401
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 $3446
+JUMPV
+LABELV $3443
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3448
+ADDRGP4 $3444
+JUMPV
+LABELV $3448
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $2242
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+627176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 48
+ADDRGP4 cg_drawRewardsScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+LEF4 $3452
+ADDRLP4 64
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $3452
+ADDRLP4 44
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 8
+CNSTF4 1134559232
+ASGNF4
+ADDRGP4 cg_drawRewardsY+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3454
+ADDRLP4 44
+ADDRGP4 cg_drawRewardsY+8
+INDIRF4
+ASGNF4
+LABELV $3454
+ADDRGP4 cg_drawRewardsX+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3458
+ADDRLP4 8
+ADDRGP4 cg_drawRewardsX+8
+INDIRF4
+ASGNF4
+LABELV $3458
+ADDRGP4 cg_drawRewardsAlign+12
+INDIRI4
+CNSTI4 1
+NEI4 $3462
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 96
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 $3463
+JUMPV
+LABELV $3462
+ADDRGP4 cg_drawRewardsAlign+12
+INDIRI4
+CNSTI4 2
+NEI4 $3465
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 96
+INDIRI4
+MULI4
+CVIF4 4
+SUBF4
+ASGNF4
+LABELV $3465
+LABELV $3463
+ADDRLP4 180
+CNSTF4 1111490560
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 180
+INDIRF4
+ARGF4
+ADDRLP4 180
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+627216
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 8
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CNSTF4 1111490560
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1069547520
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 68
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawRewardsStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $3470
+ADDRGP4 $3364
+JUMPV
+LABELV $3470
+LABELV $3444
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3446
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+627168
+INDIRI4
+CNSTI4 1
+ADDI4
+LTI4 $3443
+ADDRGP4 $3364
+JUMPV
+LABELV $3398
+ADDRGP4 cg+627176
+INDIRI4
+ADDRGP4 cg_drawRewardsMax+12
+INDIRI4
+LTI4 $3472
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $2242
+ARGP4
+ADDRGP4 cg+627176
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 48
+ADDRGP4 cg_drawRewardsScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+LEF4 $3478
+ADDRLP4 64
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $3478
+ADDRLP4 44
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 8
+CNSTF4 1134559232
+ASGNF4
+ADDRGP4 cg_drawRewardsY+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3480
+ADDRLP4 44
+ADDRGP4 cg_drawRewardsY+8
+INDIRF4
+ASGNF4
+LABELV $3480
+ADDRGP4 cg_drawRewardsX+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3484
+ADDRLP4 8
+ADDRGP4 cg_drawRewardsX+8
+INDIRF4
+ASGNF4
+LABELV $3484
+ADDRGP4 cg_drawRewards+12
+INDIRI4
+CNSTI4 2
+NEI4 $3488
+ADDRGP4 cg_drawRewardsAlign+12
+INDIRI4
+CNSTI4 1
+NEI4 $3491
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 $3492
+JUMPV
+LABELV $3491
+ADDRGP4 cg_drawRewardsAlign+12
+INDIRI4
+CNSTI4 2
+NEI4 $3494
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+LABELV $3494
+LABELV $3492
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 100
+CNSTF4 1111490560
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRGP4 cg+627216
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 8
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1069547520
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 68
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawRewardsStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $3473
+JUMPV
+LABELV $3488
+ADDRGP4 cg_drawRewards+12
+INDIRI4
+CNSTI4 1
+NEI4 $3473
+ADDRGP4 cg_drawRewardsAlign+12
+INDIRI4
+CNSTI4 1
+NEI4 $3502
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+CNSTF4 1067030938
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 56
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $3503
+JUMPV
+LABELV $3502
+ADDRGP4 cg_drawRewardsAlign+12
+INDIRI4
+CNSTI4 2
+NEI4 $3505
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+CNSTF4 1067030938
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 56
+INDIRF4
+ADDF4
+SUBF4
+ASGNF4
+LABELV $3505
+LABELV $3503
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 100
+CNSTF4 1111490560
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRGP4 cg+627216
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 8
+INDIRF4
+CNSTF4 1067030938
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ADDF4
+ADDRLP4 84
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 68
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawRewardsStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $3473
+JUMPV
+LABELV $3472
+ADDRLP4 88
+ADDRGP4 cg+627176
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 8
+CNSTF4 1134559232
+ASGNF4
+ADDRGP4 cg_drawRewardsY+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3511
+ADDRLP4 44
+ADDRGP4 cg_drawRewardsY+8
+INDIRF4
+ASGNF4
+LABELV $3511
+ADDRGP4 cg_drawRewardsX+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3515
+ADDRLP4 8
+ADDRGP4 cg_drawRewardsX+8
+INDIRF4
+ASGNF4
+LABELV $3515
+ADDRGP4 cg_drawRewardsAlign+12
+INDIRI4
+CNSTI4 1
+NEI4 $3519
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+CNSTF4 1112539136
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+MULF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $3520
+JUMPV
+LABELV $3519
+ADDRGP4 cg_drawRewardsAlign+12
+INDIRI4
+CNSTI4 2
+NEI4 $3522
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+CNSTF4 1112539136
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $3522
+LABELV $3520
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3528
+JUMPV
+LABELV $3525
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 92
+CNSTF4 1111490560
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRGP4 cg+627216
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+CNSTF4 1112539136
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ADDF4
+ASGNF4
+LABELV $3526
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3528
+ADDRLP4 0
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LTI4 $3525
+LABELV $3473
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $3364
+endproc CG_DrawReward 188 36
+export CG_ResetLagometer
+proc CG_ResetLagometer 0 0
+ADDRGP4 lagometer+1540
+CNSTI4 1
+ASGNI4
+ADDRGP4 lagometer+512
+CNSTI4 1
+ASGNI4
+LABELV $3530
+endproc CG_ResetLagometer 0 0
+export CG_AddLagometerFrameInfo
+proc CG_AddLagometerFrameInfo 8 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $3534
+ADDRGP4 $3533
+JUMPV
+LABELV $3534
+ADDRLP4 0
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+36
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 lagometer+512
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3533
+endproc CG_AddLagometerFrameInfo 8 0
+export CG_AddLagometerSnapshotInfo
+proc CG_AddLagometerSnapshotInfo 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3542
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+CNSTI4 -999
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3541
+JUMPV
+LABELV $3542
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $3547
+ADDRGP4 $3541
+JUMPV
+LABELV $3547
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3541
+endproc CG_AddLagometerSnapshotInfo 4 0
+export CG_LagometerMarkNoMove
+proc CG_LagometerMarkNoMove 0 0
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 1
+GEI4 $3555
+ADDRGP4 $3554
+JUMPV
+LABELV $3555
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+CNSTI4 -1000
+ASGNI4
+LABELV $3554
+endproc CG_LagometerMarkNoMove 0 0
+proc CG_DrawDisconnect 76 20
+ADDRLP4 56
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 56
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 60
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+LEI4 $3565
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LEI4 $3561
+LABELV $3565
+ADDRGP4 $3560
+JUMPV
+LABELV $3561
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $3566
+ADDRGP4 cg_timescale+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $3566
+ADDRGP4 $3560
+JUMPV
+LABELV $3566
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $3570
+ADDRGP4 $3560
+JUMPV
+LABELV $3570
+ADDRGP4 cg+3196908
+INDIRI4
+CNSTI4 0
+EQI4 $3573
+ADDRGP4 $3560
+JUMPV
+LABELV $3573
+ADDRLP4 28
+ADDRGP4 $3576
+ASGNP4
+ADDRGP4 QLWideScreen
+CNSTI4 2
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 64
+INDIRF4
+ASGNF4
+CNSTF4 1134559232
+ADDRLP4 48
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 100
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3579
+ADDRGP4 $3560
+JUMPV
+LABELV $3579
+ADDRLP4 32
+ADDRGP4 cg_lagometerX+8
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg_lagometerY+8
+INDIRF4
+ASGNF4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_lagometerWideScreen+12
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cg_lagometerAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 cg_lagometerScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1111490560
+ADDRLP4 52
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+NEI4 $3587
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 $3588
+JUMPV
+LABELV $3587
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+NEI4 $3589
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+LABELV $3589
+LABELV $3588
+ADDRGP4 $3591
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $3560
+endproc CG_DrawDisconnect 76 20
+proc CG_DrawLagometer 212 36
+ADDRGP4 cg_lagometer+12
+INDIRI4
+CNSTI4 0
+NEI4 $3593
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+ADDRGP4 $3592
+JUMPV
+LABELV $3593
+ADDRLP4 140
+ARGP4
+ADDRGP4 cg_lagometerFontColor
+ARGP4
+ADDRGP4 cg_lagometerFontAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 136
+ADDRGP4 cg_lagometerAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRGP4 cg_lagometerAlpha+12
+INDIRI4
+ASGNI4
+ADDRLP4 116
+ADDRGP4 cg_lagometerFontAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRGP4 cg_lagometerFontScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 156
+ADDRGP4 cg_lagometerFontStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_lagometerWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_lagometerFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3602
+ADDRLP4 124
+ADDRGP4 cgs+632912+1100516
+ASGNP4
+ADDRGP4 $3603
+JUMPV
+LABELV $3602
+ADDRLP4 124
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $3603
+ADDRLP4 84
+ADDRGP4 cg_lagometerX+8
+INDIRF4
+ASGNF4
+ADDRLP4 112
+ADDRGP4 cg_lagometerY+8
+INDIRF4
+ASGNF4
+ADDRLP4 88
+ADDRGP4 cg_lagometerScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 68
+CNSTF4 1111490560
+ADDRLP4 88
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+NEI4 $3612
+ADDRLP4 84
+ADDRLP4 84
+INDIRF4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 $3613
+JUMPV
+LABELV $3612
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+NEI4 $3614
+ADDRLP4 84
+ADDRLP4 84
+INDIRF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+LABELV $3614
+LABELV $3613
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+12
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 160
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ARGF4
+ADDRLP4 160
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3621
+CNSTI4 2392
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 wclients+724
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3592
+ADDRLP4 164
+CNSTI4 2392
+ASGNI4
+ADDRLP4 128
+ADDRLP4 164
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 wclients+720
+ADDP4
+INDIRI4
+ADDRLP4 164
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 wclients+724
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 cg_lagometerFlash+12
+INDIRI4
+CNSTI4 0
+EQI4 $3631
+ADDRLP4 128
+INDIRI4
+ADDRGP4 cg_lagometerFlashValue+12
+INDIRI4
+LTI4 $3631
+ADDRLP4 168
+ADDRGP4 colorYellow
+INDIRB
+ASGNB 12
+ADDRLP4 168+12
+CNSTF4 1050253722
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 184
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+ARGF4
+ADDRLP4 184
+INDIRF4
+ARGF4
+ADDRLP4 168
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $3631
+ADDRGP4 $2242
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+NEI4 $3636
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $3637
+JUMPV
+LABELV $3636
+ADDRLP4 116
+INDIRI4
+CNSTI4 2
+NEI4 $3638
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $3638
+LABELV $3637
+ADDRGP4 cg_lagometerAveragePing+12
+INDIRI4
+CNSTI4 0
+EQI4 $3592
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRGP4 $3592
+JUMPV
+LABELV $3621
+ADDRLP4 128
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+GEI4 $3644
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+LABELV $3644
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 $3649
+JUMPV
+LABELV $3646
+ADDRLP4 168
+ADDRGP4 lagometer+1540
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+LTI4 $3653
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+ADDRLP4 168
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3653
+LABELV $3647
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3649
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+GEI4 $3655
+ADDRLP4 4
+INDIRI4
+ADDRGP4 lagometer+1540
+INDIRI4
+LTI4 $3646
+LABELV $3655
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 176
+INDIRI4
+LEI4 $3656
+ADDRGP4 cg_lagometerFlash+12
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $3656
+ADDRLP4 76
+INDIRI4
+ADDRLP4 64
+INDIRI4
+DIVI4
+ADDRGP4 cg_lagometerFlashValue+12
+INDIRI4
+LTI4 $3656
+ADDRLP4 180
+ADDRGP4 colorYellow
+INDIRB
+ASGNB 12
+ADDRLP4 180+12
+CNSTF4 1050253722
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 196
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 180
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $3656
+ADDRLP4 44
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 40
+CNSTI4 -1
+ASGNI4
+ADDRLP4 32
+ADDRLP4 52
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 56
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 32
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3664
+JUMPV
+LABELV $3661
+ADDRLP4 4
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $3666
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+EQI4 $3668
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRGP4 g_color_table+48
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 g_color_table+48+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 g_color_table+48+8
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRGP4 g_color_table+48+12
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $3668
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LEF4 $3681
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $3681
+ADDRLP4 44
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 192
+CNSTF4 0
+ASGNF4
+ADDRLP4 192
+INDIRF4
+ARGF4
+ADDRLP4 192
+INDIRF4
+ARGF4
+ADDRLP4 192
+INDIRF4
+ARGF4
+ADDRLP4 192
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $3667
+JUMPV
+LABELV $3666
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $3685
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+EQI4 $3687
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRLP4 12
+ADDRGP4 g_color_table+64
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 g_color_table+64+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 g_color_table+64+8
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRGP4 g_color_table+64+12
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $3687
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LEF4 $3700
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $3700
+ADDRLP4 44
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 188
+CNSTF4 0
+ASGNF4
+ADDRLP4 188
+INDIRF4
+ARGF4
+ADDRLP4 188
+INDIRF4
+ARGF4
+ADDRLP4 188
+INDIRF4
+ARGF4
+ADDRLP4 188
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $3685
+LABELV $3667
+LABELV $3662
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3664
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+LTF4 $3661
+ADDRLP4 32
+ADDRLP4 52
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 32
+INDIRF4
+CNSTF4 1147207680
+DIVF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3707
+JUMPV
+LABELV $3704
+ADDRLP4 4
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 188
+INDIRI4
+ADDRGP4 lagometer+1028
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 188
+INDIRI4
+ADDRGP4 lagometer+1028
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $3711
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3713
+ADDRLP4 40
+INDIRI4
+CNSTI4 5
+EQI4 $3714
+ADDRLP4 40
+CNSTI4 5
+ASGNI4
+ADDRLP4 12
+ADDRGP4 g_color_table+48
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 g_color_table+48+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 g_color_table+48+8
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRGP4 g_color_table+48+12
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $3714
+JUMPV
+LABELV $3713
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+EQI4 $3729
+ADDRLP4 40
+CNSTI4 3
+ASGNI4
+ADDRLP4 12
+ADDRGP4 g_color_table+32
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 g_color_table+32+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 g_color_table+32+8
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRGP4 g_color_table+32+12
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $3729
+LABELV $3714
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LEF4 $3742
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $3742
+ADDRLP4 44
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 196
+CNSTF4 0
+ASGNF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $3712
+JUMPV
+LABELV $3711
+ADDRLP4 36
+INDIRI4
+CNSTI4 -999
+NEI4 $3746
+ADDRLP4 40
+INDIRI4
+CNSTI4 4
+EQI4 $3748
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 g_color_table+16
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 g_color_table+16+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 g_color_table+16+8
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRGP4 g_color_table+16+12
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $3748
+ADDRLP4 44
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 196
+CNSTF4 0
+ASGNF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $3747
+JUMPV
+LABELV $3746
+ADDRLP4 36
+INDIRI4
+CNSTI4 -1000
+NEI4 $3763
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $3765
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+12
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $3765
+ADDRLP4 44
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 196
+CNSTF4 0
+ASGNF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $3764
+JUMPV
+LABELV $3763
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+GEI4 $3772
+LABELV $3772
+LABELV $3764
+LABELV $3747
+LABELV $3712
+LABELV $3705
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3707
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+LTF4 $3704
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 188
+INDIRI4
+NEI4 $3778
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $3774
+LABELV $3778
+LABELV $3774
+ADDRLP4 80
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2242
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+NEI4 $3779
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $3780
+JUMPV
+LABELV $3779
+ADDRLP4 116
+INDIRI4
+CNSTI4 2
+NEI4 $3781
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $3781
+LABELV $3780
+ADDRGP4 cg_lagometerSnapshotPing+12
+INDIRI4
+CNSTI4 0
+EQI4 $3783
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $3783
+ADDRLP4 80
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+LEI4 $3786
+ADDRLP4 200
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRGP4 $2242
+ARGP4
+ADDRLP4 204
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRGP4 $3787
+JUMPV
+LABELV $3786
+ADDRLP4 92
+ADDRGP4 $3788
+ASGNP4
+LABELV $3787
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+NEI4 $3789
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $3790
+JUMPV
+LABELV $3789
+ADDRLP4 116
+INDIRI4
+CNSTI4 2
+NEI4 $3791
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $3791
+LABELV $3790
+ADDRGP4 cg_lagometerAveragePing+12
+INDIRI4
+CNSTI4 0
+EQI4 $3793
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 112
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $3793
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+LABELV $3592
+endproc CG_DrawLagometer 212 36
+export CG_CenterPrint
+proc CG_CenterPrint 8 12
+ADDRGP4 cg+626108
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawCenterPrintWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawCenterPrintY+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3800
+ADDRFP4 4
+ADDRGP4 cg_drawCenterPrintY+8
+INDIRF4
+ASGNF4
+LABELV $3800
+ADDRGP4 cg+626096
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+626104
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+626100
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627132
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+626108
+ASGNP4
+ADDRGP4 $3811
+JUMPV
+LABELV $3810
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $3813
+ADDRLP4 4
+ADDRGP4 cg+627132
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3813
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $3811
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3810
+ADDRGP4 cg+627136
+CNSTI4 0
+ASGNI4
+LABELV $3796
+endproc CG_CenterPrint 8 12
+export CG_CenterPrintFragMessage
+proc CG_CenterPrintFragMessage 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 cg+627136
+CNSTI4 1
+ASGNI4
+LABELV $3817
+endproc CG_CenterPrintFragMessage 0 12
+proc CG_RoundAnnouncements 52 8
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+45344
+INDIRI4
+GTI4 $3820
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+45340
+INDIRI4
+SUBI4
+CNSTI4 5
+GEI4 $3819
+ADDRGP4 $3819
+JUMPV
+LABELV $3820
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $3836
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $3836
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $3836
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3828
+LABELV $3836
+CNSTI4 662
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43288
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $3838
+ADDRGP4 cgs+43280
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $3838
+ADDRGP4 cgs+39712
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $3838
+ADDRGP4 cgs+39712
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000
+DIVI4
+SUBI4
+CNSTI4 30
+GTI4 $3838
+ADDRGP4 cg_audioAnnouncerTimeLimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $3844
+ADDRGP4 cgs+632912+493308
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $3844
+ADDRGP4 cgs+43288
+CNSTI4 1
+ASGNI4
+LABELV $3838
+ADDRGP4 cgs+43284
+INDIRI4
+CNSTI4 1
+NEI4 $3850
+ADDRGP4 cgs+43280
+INDIRI4
+CNSTI4 0
+EQI4 $3850
+ADDRGP4 cg_audioAnnouncerRound+12
+INDIRI4
+CNSTI4 0
+EQI4 $3854
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $3857
+ADDRGP4 cg_attackDefendVoiceStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $3857
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3861
+ADDRLP4 8
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $3862
+JUMPV
+LABELV $3861
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3862
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $3869
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+NEI4 $3858
+LABELV $3869
+ADDRGP4 cgs+43276
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $3875
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $3874
+LABELV $3875
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRGP4 cgs+43276
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MODI4
+CNSTI4 0
+EQI4 $3870
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $3870
+LABELV $3874
+ADDRGP4 cgs+632912+493388
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3858
+JUMPV
+LABELV $3870
+ADDRGP4 cgs+632912+493392
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3858
+JUMPV
+LABELV $3857
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3880
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1960920
+INDIRI4
+CNSTI4 67108864
+BANDI4
+ADDRLP4 28
+INDIRI4
+EQI4 $3880
+ADDRGP4 cg_allowServerOverride+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $3880
+ADDRGP4 cgs+632912+492880
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3887
+ADDRLP4 32
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $3888
+JUMPV
+LABELV $3887
+ADDRLP4 32
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3888
+CNSTI4 4524
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3891
+ADDRGP4 cgs+632912+493464
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3881
+JUMPV
+LABELV $3891
+ADDRGP4 cgs+632912+493456
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3881
+JUMPV
+LABELV $3880
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $3899
+ADDRGP4 cgs+632912+493460
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3900
+JUMPV
+LABELV $3899
+ADDRGP4 cgs+632912+493456
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $3900
+LABELV $3881
+LABELV $3858
+LABELV $3854
+ADDRGP4 cgs+43284
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3819
+JUMPV
+LABELV $3850
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43280
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $3819
+ADDRGP4 cgs+43268
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $3819
+ADDRLP4 0
+ADDRGP4 cgs+43268
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 8
+GEI4 $3913
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $3913
+LABELV $3913
+ADDRLP4 36
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $3915
+ADDRGP4 cgs+43284
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $3915
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $3924
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $3924
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3918
+LABELV $3924
+ADDRGP4 cg_audioAnnouncerRound+12
+INDIRI4
+CNSTI4 0
+EQI4 $3919
+ADDRGP4 cgs+632912+493300
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3919
+JUMPV
+LABELV $3918
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $3930
+ADDRGP4 cg_audioAnnouncerRound+12
+INDIRI4
+CNSTI4 0
+EQI4 $3933
+ADDRGP4 cgs+632912+493516
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $3933
+LABELV $3930
+LABELV $3919
+ADDRGP4 cgs+43284
+CNSTI4 5
+ASGNI4
+ADDRGP4 $3819
+JUMPV
+LABELV $3915
+ADDRLP4 40
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $3939
+ADDRGP4 cgs+43284
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $3939
+ADDRGP4 cg_audioAnnouncerRound+12
+INDIRI4
+CNSTI4 0
+EQI4 $3942
+ADDRGP4 cgs+632912+493444
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $3942
+ADDRGP4 cgs+43284
+CNSTI4 3
+ASGNI4
+ADDRGP4 $3819
+JUMPV
+LABELV $3939
+ADDRLP4 44
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $3948
+ADDRGP4 cgs+43284
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $3948
+ADDRGP4 cg_audioAnnouncerRound+12
+INDIRI4
+CNSTI4 0
+EQI4 $3951
+ADDRGP4 cgs+632912+493448
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $3951
+ADDRGP4 cgs+43284
+CNSTI4 2
+ASGNI4
+ADDRGP4 $3819
+JUMPV
+LABELV $3948
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $3957
+ADDRGP4 cgs+43284
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $3957
+ADDRGP4 cg_audioAnnouncerRound+12
+INDIRI4
+CNSTI4 0
+EQI4 $3960
+ADDRGP4 cgs+632912+493452
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $3960
+ADDRGP4 cgs+43284
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3819
+JUMPV
+LABELV $3957
+ADDRGP4 cgs+43284
+INDIRI4
+CNSTI4 1
+NEI4 $3819
+ADDRGP4 cgs+43280
+INDIRI4
+CNSTI4 0
+EQI4 $3819
+LABELV $3828
+LABELV $3819
+endproc CG_RoundAnnouncements 52 8
+proc CG_DrawCenter 24 12
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+45344
+INDIRI4
+GTI4 $3971
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+45340
+INDIRI4
+SUBI4
+CNSTI4 5
+GEI4 $3975
+ADDRGP4 $3970
+JUMPV
+LABELV $3975
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $3979
+ADDRGP4 $3982
+ARGP4
+ADDRGP4 cgs+45344
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 cgs+45344
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $3985
+ADDRGP4 $369
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $3985
+LABELV $3979
+ADDRGP4 cgs+45348
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3970
+JUMPV
+LABELV $3971
+ADDRGP4 cgs+45348
+INDIRI4
+CNSTI4 0
+EQI4 $3990
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $3993
+ADDRGP4 $369
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $3993
+ADDRGP4 cgs+45348
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3970
+JUMPV
+LABELV $3990
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $4005
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $4005
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $4005
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3997
+LABELV $4005
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43284
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $4006
+ADDRGP4 cgs+43280
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $4006
+ADDRGP4 cg_drawFightMessage+12
+INDIRI4
+CNSTI4 0
+EQI4 $4010
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $4013
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1960920
+INDIRI4
+CNSTI4 67108864
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $4013
+ADDRGP4 cg_allowServerOverride+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $4013
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4018
+ADDRLP4 12
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $4019
+JUMPV
+LABELV $4018
+ADDRLP4 12
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4019
+CNSTI4 4524
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $4022
+ADDRGP4 $4026
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $4011
+JUMPV
+LABELV $4022
+CNSTI4 4524
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $4011
+ADDRGP4 $4031
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $4011
+JUMPV
+LABELV $4013
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $4032
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4035
+ADDRLP4 12
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4036
+JUMPV
+LABELV $4035
+ADDRLP4 12
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4036
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $4046
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $4043
+LABELV $4046
+ADDRGP4 cg_attackDefendVoiceStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $4043
+ADDRGP4 cgs+43276
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $4052
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $4051
+LABELV $4052
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 cgs+43276
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+CNSTI4 0
+EQI4 $4047
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $4047
+LABELV $4051
+ADDRGP4 $4053
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $4011
+JUMPV
+LABELV $4047
+ADDRGP4 $4054
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $4011
+JUMPV
+LABELV $4043
+ADDRGP4 $4055
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $4011
+JUMPV
+LABELV $4032
+ADDRGP4 $4055
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $4011
+JUMPV
+LABELV $4010
+ADDRGP4 $369
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $4011
+ADDRGP4 cgs+43284
+CNSTI4 -999
+ASGNI4
+ADDRGP4 $3970
+JUMPV
+LABELV $4006
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43280
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $3970
+ADDRGP4 cgs+43268
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $3970
+ADDRLP4 0
+ADDRGP4 cgs+43268
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+GEI4 $3970
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $3970
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $4065
+ADDRGP4 $4068
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $3970
+JUMPV
+LABELV $4065
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $4069
+ADDRGP4 $4072
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $3970
+JUMPV
+LABELV $4069
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $4073
+ADDRGP4 cgs+43276
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $4076
+ADDRGP4 $4079
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $3970
+JUMPV
+LABELV $4076
+ADDRGP4 $4080
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $3970
+JUMPV
+LABELV $4073
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3970
+ADDRGP4 $4068
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $3997
+LABELV $3970
+endproc CG_DrawCenter 24 12
+bss
+align 4
+LABELV $4085
+skip 4096
+export CG_CreateFragString
+code
+proc CG_CreateFragString 22808 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4086
+ADDRLP4 20
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $4087
+JUMPV
+LABELV $4086
+ADDRLP4 20
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4087
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4090
+ADDRGP4 cg+1330564
+INDIRI4
+CNSTI4 30
+NEI4 $4092
+ADDRLP4 8
+ADDRGP4 cg_drawFragMessageThawTokens+16
+ASGNP4
+ADDRGP4 $4091
+JUMPV
+LABELV $4092
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $4096
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4099
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $4099
+ADDRGP4 cg+1330556
+INDIRI4
+ADDRGP4 cg+1330552
+INDIRI4
+NEI4 $4099
+ADDRLP4 8
+ADDRGP4 cg_drawFragMessageFreezeTeamTokens+16
+ASGNP4
+ADDRGP4 $4091
+JUMPV
+LABELV $4099
+ADDRLP4 8
+ADDRGP4 cg_drawFragMessageFreezeTokens+16
+ASGNP4
+ADDRGP4 $4091
+JUMPV
+LABELV $4096
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4106
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $4106
+ADDRGP4 cg+1330556
+INDIRI4
+ADDRGP4 cg+1330552
+INDIRI4
+NEI4 $4106
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $4106
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+EQI4 $4106
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+EQI4 $4106
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $4106
+ADDRLP4 8
+ADDRGP4 cg_drawFragMessageTeamTokens+16
+ASGNP4
+ADDRGP4 $4091
+JUMPV
+LABELV $4106
+ADDRLP4 8
+ADDRGP4 cg_drawFragMessageTokens+16
+ASGNP4
+ADDRGP4 $4091
+JUMPV
+LABELV $4090
+ADDRLP4 8
+ADDRGP4 cg_obituaryTokens+16
+ASGNP4
+LABELV $4091
+ADDRLP4 4
+ADDRGP4 cg+1226452
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+CNSTI4 100
+MODI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 5148
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+711652
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $4121
+JUMPV
+LABELV $4120
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 52
+INDIRU4
+LTU4 $4123
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4122
+JUMPV
+LABELV $4123
+ADDRLP4 48
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4125
+LABELV $4125
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4127
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4122
+JUMPV
+LABELV $4127
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 37
+EQI4 $4129
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $4121
+JUMPV
+LABELV $4129
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4131
+LABELV $4131
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 118
+NEI4 $4133
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4135
+ADDRLP4 44
+ADDRGP4 cg+1330296
+ASGNP4
+ADDRGP4 $4139
+JUMPV
+LABELV $4135
+ADDRLP4 44
+ADDRLP4 12
+INDIRP4
+CNSTI4 2056
+ADDP4
+ASGNP4
+ADDRGP4 $4139
+JUMPV
+LABELV $4138
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4139
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4138
+ADDRGP4 $4134
+JUMPV
+LABELV $4133
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 86
+NEI4 $4141
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4143
+ADDRLP4 44
+ADDRGP4 cg+1330424
+ASGNP4
+ADDRGP4 $4147
+JUMPV
+LABELV $4143
+ADDRLP4 44
+ADDRLP4 12
+INDIRP4
+CNSTI4 3080
+ADDP4
+ASGNP4
+ADDRGP4 $4147
+JUMPV
+LABELV $4146
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4147
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4146
+ADDRGP4 $4142
+JUMPV
+LABELV $4141
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 107
+NEI4 $4149
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4151
+ADDRLP4 44
+CNSTI4 4524
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ASGNP4
+ADDRGP4 $4158
+JUMPV
+LABELV $4151
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+INDIRI4
+NEI4 $4155
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4158
+JUMPV
+LABELV $4155
+ADDRLP4 44
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $4158
+JUMPV
+LABELV $4157
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4158
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4157
+ADDRGP4 $4150
+JUMPV
+LABELV $4149
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 75
+NEI4 $4160
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4162
+ADDRLP4 44
+CNSTI4 4524
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+132
+ADDP4
+ASGNP4
+ADDRGP4 $4169
+JUMPV
+LABELV $4162
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+INDIRI4
+NEI4 $4166
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4169
+JUMPV
+LABELV $4166
+ADDRLP4 44
+ADDRLP4 12
+INDIRP4
+CNSTI4 1024
+ADDP4
+ASGNP4
+ADDRGP4 $4169
+JUMPV
+LABELV $4168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4169
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4168
+ADDRGP4 $4161
+JUMPV
+LABELV $4160
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 113
+NEI4 $4171
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4173
+ADDRLP4 44
+ADDRGP4 cg+1330568
+ASGNP4
+ADDRGP4 $4177
+JUMPV
+LABELV $4173
+ADDRLP4 44
+ADDRLP4 12
+INDIRP4
+CNSTI4 4124
+ADDP4
+ASGNP4
+ADDRGP4 $4177
+JUMPV
+LABELV $4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4177
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4176
+ADDRGP4 $4172
+JUMPV
+LABELV $4171
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 119
+NEI4 $4179
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4181
+ADDRGP4 cg+1330560
+INDIRI4
+CNSTI4 0
+LTI4 $4183
+ADDRGP4 cg+1330560
+INDIRI4
+CNSTI4 16
+GTI4 $4183
+ADDRLP4 44
+ADDRGP4 cg+1330560
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 weapNamesCasual
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $4195
+JUMPV
+LABELV $4183
+ADDRGP4 $4188
+ARGP4
+ADDRGP4 cg+1330560
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 44
+ADDRGP4 $4190
+ASGNP4
+ADDRGP4 $4195
+JUMPV
+LABELV $4181
+ADDRLP4 56
+ADDRLP4 12
+INDIRP4
+CNSTI4 4112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+LTI4 $4191
+ADDRLP4 56
+INDIRI4
+CNSTI4 16
+GTI4 $4191
+ADDRLP4 44
+ADDRLP4 12
+INDIRP4
+CNSTI4 4112
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 weapNamesCasual
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $4195
+JUMPV
+LABELV $4191
+ADDRGP4 $4193
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4112
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 44
+ADDRGP4 $4190
+ASGNP4
+ADDRGP4 $4195
+JUMPV
+LABELV $4194
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4195
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4194
+ADDRGP4 $4180
+JUMPV
+LABELV $4179
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 105
+NEI4 $4197
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4199
+ADDRLP4 56
+CNSTI4 132
+ADDRGP4 cg+1330560
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4200
+JUMPV
+LABELV $4199
+ADDRLP4 56
+ADDRLP4 12
+INDIRP4
+CNSTI4 4116
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4200
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 256
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4198
+JUMPV
+LABELV $4197
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 65
+NEI4 $4203
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4205
+ADDRLP4 24
+CNSTI4 2392
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 wclients+1816
+ADDP4
+ASGNP4
+ADDRGP4 $4206
+JUMPV
+LABELV $4205
+ADDRLP4 24
+CNSTI4 2392
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+1816
+ADDP4
+ASGNP4
+LABELV $4206
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $4212
+JUMPV
+LABELV $4209
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $4213
+ADDRLP4 16
+INDIRI4
+CNSTI4 6
+EQI4 $4213
+ADDRLP4 16
+INDIRI4
+CNSTI4 7
+EQI4 $4213
+ADDRLP4 16
+INDIRI4
+CNSTI4 11
+EQI4 $4213
+ADDRGP4 $4210
+JUMPV
+LABELV $4213
+ADDRLP4 64
+CNSTI4 36
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CVIU4 4
+ADDRLP4 64
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $4210
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4212
+ADDRLP4 16
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $4209
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $4215
+ADDRLP4 36
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $4216
+JUMPV
+LABELV $4215
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+LABELV $4216
+ADDRLP4 60
+ADDRGP4 cg_fragTokenAccuracyStyle+12
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $4223
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+EQI4 $4220
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+EQI4 $4221
+ADDRGP4 $4217
+JUMPV
+LABELV $4220
+ADDRGP4 $2242
+ARGP4
+CNSTF4 1120403456
+ADDRLP4 36
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRGP4 $4226
+JUMPV
+LABELV $4221
+ADDRGP4 $4222
+ARGP4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $4226
+JUMPV
+LABELV $4223
+LABELV $4217
+ADDRGP4 $4224
+ARGP4
+CNSTF4 1120403456
+ADDRLP4 36
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRGP4 $4226
+JUMPV
+LABELV $4225
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4226
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4225
+ADDRGP4 $4204
+JUMPV
+LABELV $4203
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 97
+NEI4 $4228
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4230
+ADDRLP4 60
+CNSTI4 2392
+ADDRLP4 20
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 60
+INDIRI4
+ADDRGP4 wclients+1816
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 60
+INDIRI4
+ADDRGP4 wclients+2368
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4231
+JUMPV
+LABELV $4230
+ADDRLP4 24
+CNSTI4 2392
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+1816
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 12
+INDIRP4
+CNSTI4 4112
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4231
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 36
+ADDRLP4 56
+INDIRI4
+MULI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 64
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $4235
+ADDRLP4 36
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $4236
+JUMPV
+LABELV $4235
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+LABELV $4236
+ADDRLP4 68
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+EQI4 $4237
+ADDRLP4 68
+INDIRI4
+CNSTI4 6
+EQI4 $4237
+ADDRLP4 68
+INDIRI4
+CNSTI4 7
+EQI4 $4237
+ADDRLP4 68
+INDIRI4
+CNSTI4 11
+EQI4 $4237
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4246
+JUMPV
+LABELV $4237
+ADDRLP4 72
+ADDRGP4 cg_fragTokenAccuracyStyle+12
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $4244
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+EQI4 $4242
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+EQI4 $4243
+ADDRGP4 $4239
+JUMPV
+LABELV $4242
+ADDRGP4 $2242
+ARGP4
+CNSTF4 1120403456
+ADDRLP4 36
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $4246
+JUMPV
+LABELV $4243
+ADDRGP4 $4222
+ARGP4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRGP4 $4246
+JUMPV
+LABELV $4244
+LABELV $4239
+ADDRGP4 $4224
+ARGP4
+CNSTF4 1120403456
+ADDRLP4 36
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRGP4 $4246
+JUMPV
+LABELV $4245
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4246
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4245
+ADDRGP4 $4229
+JUMPV
+LABELV $4228
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 68
+NEI4 $4248
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4250
+ADDRLP4 24
+CNSTI4 2392
+ADDRGP4 cg+1330288
+INDIRI4
+MULI4
+ADDRGP4 wclients+1816
+ADDP4
+ASGNP4
+ADDRGP4 $4251
+JUMPV
+LABELV $4250
+ADDRLP4 24
+CNSTI4 2392
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+1816
+ADDP4
+ASGNP4
+LABELV $4251
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $4258
+JUMPV
+LABELV $4255
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $4259
+ADDRLP4 16
+INDIRI4
+CNSTI4 6
+EQI4 $4259
+ADDRLP4 16
+INDIRI4
+CNSTI4 7
+EQI4 $4259
+ADDRLP4 16
+INDIRI4
+CNSTI4 11
+EQI4 $4259
+ADDRGP4 $4256
+JUMPV
+LABELV $4259
+ADDRLP4 64
+CNSTI4 36
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CVIU4 4
+ADDRLP4 64
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $4256
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4258
+ADDRLP4 16
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $4255
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $4261
+ADDRLP4 36
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $4262
+JUMPV
+LABELV $4261
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+LABELV $4262
+ADDRLP4 60
+ADDRGP4 cg_fragTokenAccuracyStyle+12
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $4268
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+EQI4 $4266
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+EQI4 $4267
+ADDRGP4 $4263
+JUMPV
+LABELV $4266
+ADDRGP4 $2242
+ARGP4
+CNSTF4 1120403456
+ADDRLP4 36
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRGP4 $4270
+JUMPV
+LABELV $4267
+ADDRGP4 $4222
+ARGP4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $4270
+JUMPV
+LABELV $4268
+LABELV $4263
+ADDRGP4 $4224
+ARGP4
+CNSTF4 1120403456
+ADDRLP4 36
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRGP4 $4270
+JUMPV
+LABELV $4269
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4270
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4269
+ADDRGP4 $4249
+JUMPV
+LABELV $4248
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 100
+NEI4 $4272
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4274
+ADDRLP4 60
+CNSTI4 2392
+ASGNI4
+ADDRLP4 24
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+1330288
+INDIRI4
+MULI4
+ADDRGP4 wclients+1816
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+1330288
+INDIRI4
+MULI4
+ADDRGP4 wclients+2368
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4275
+JUMPV
+LABELV $4274
+ADDRLP4 60
+CNSTI4 2392
+ASGNI4
+ADDRLP4 64
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+1816
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2368
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4275
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 36
+ADDRLP4 56
+INDIRI4
+MULI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 64
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $4282
+ADDRLP4 36
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $4283
+JUMPV
+LABELV $4282
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+LABELV $4283
+ADDRLP4 68
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+EQI4 $4284
+ADDRLP4 68
+INDIRI4
+CNSTI4 6
+EQI4 $4284
+ADDRLP4 68
+INDIRI4
+CNSTI4 7
+EQI4 $4284
+ADDRLP4 68
+INDIRI4
+CNSTI4 11
+EQI4 $4284
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4293
+JUMPV
+LABELV $4284
+ADDRLP4 72
+ADDRGP4 cg_fragTokenAccuracyStyle+12
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $4291
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+EQI4 $4289
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+EQI4 $4290
+ADDRGP4 $4286
+JUMPV
+LABELV $4289
+ADDRGP4 $2242
+ARGP4
+CNSTF4 1120403456
+ADDRLP4 36
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $4293
+JUMPV
+LABELV $4290
+ADDRGP4 $4222
+ARGP4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRGP4 $4293
+JUMPV
+LABELV $4291
+LABELV $4286
+ADDRGP4 $4224
+ARGP4
+CNSTF4 1120403456
+ADDRLP4 36
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRGP4 $4293
+JUMPV
+LABELV $4292
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4293
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4292
+ADDRGP4 $4273
+JUMPV
+LABELV $4272
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 99
+NEI4 $4295
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 257
+ASGNI4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+ADDI4
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRLP4 72
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4296
+JUMPV
+LABELV $4295
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 116
+NEI4 $4297
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4299
+ADDRLP4 56
+ADDRGP4 cg+1330552
+INDIRI4
+ASGNI4
+ADDRGP4 $4300
+JUMPV
+LABELV $4299
+ADDRLP4 56
+ADDRLP4 12
+INDIRP4
+CNSTI4 4108
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4300
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 257
+ASGNI4
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $4302
+ADDRGP4 cg_obituaryRedTeamColor+16
+ARGP4
+ADDRLP4 64
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $4303
+JUMPV
+LABELV $4302
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+NEI4 $4305
+ADDRGP4 cg_obituaryBlueTeamColor+16
+ARGP4
+ADDRLP4 64
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $4306
+JUMPV
+LABELV $4305
+ADDRGP4 $4308
+ARGP4
+ADDRLP4 64
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $4306
+LABELV $4303
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4298
+JUMPV
+LABELV $4297
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 84
+NEI4 $4309
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4311
+ADDRLP4 60
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $4312
+JUMPV
+LABELV $4311
+ADDRLP4 60
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4312
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4315
+ADDRLP4 56
+CNSTI4 4524
+ADDRLP4 60
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4316
+JUMPV
+LABELV $4315
+ADDRLP4 56
+ADDRLP4 12
+INDIRP4
+CNSTI4 2052
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4316
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 257
+ASGNI4
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $4319
+ADDRGP4 cg_obituaryRedTeamColor+16
+ARGP4
+ADDRLP4 68
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $4320
+JUMPV
+LABELV $4319
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+NEI4 $4322
+ADDRGP4 cg_obituaryBlueTeamColor+16
+ARGP4
+ADDRLP4 68
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $4323
+JUMPV
+LABELV $4322
+ADDRGP4 $4308
+ARGP4
+ADDRLP4 68
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $4323
+LABELV $4320
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4310
+JUMPV
+LABELV $4309
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 102
+NEI4 $4325
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4327
+ADDRLP4 56
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $4328
+JUMPV
+LABELV $4327
+ADDRLP4 56
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4328
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4331
+ADDRLP4 60
+ADDRGP4 cg+1330552
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330288
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $4332
+ADDRGP4 $4332
+JUMPV
+LABELV $4331
+ADDRLP4 60
+ADDRLP4 12
+INDIRP4
+CNSTI4 4108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+NEI4 $4337
+LABELV $4337
+LABELV $4332
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $4339
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 256
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4342
+JUMPV
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085-4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4340
+JUMPV
+LABELV $4342
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+NEI4 $4345
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRGP4 cgs+632912+64
+INDIRI4
+ASGNI4
+ADDRGP4 $4340
+JUMPV
+LABELV $4345
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+NEI4 $4349
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRGP4 cgs+632912+76
+INDIRI4
+ASGNI4
+ADDRGP4 $4340
+JUMPV
+LABELV $4349
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4340
+JUMPV
+LABELV $4339
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4340
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4326
+JUMPV
+LABELV $4325
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 70
+NEI4 $4353
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4355
+ADDRLP4 60
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $4356
+JUMPV
+LABELV $4355
+ADDRLP4 60
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4356
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4359
+ADDRLP4 68
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 4524
+ADDRLP4 68
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330288
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $4360
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4360
+JUMPV
+LABELV $4359
+ADDRLP4 64
+ADDRLP4 12
+INDIRP4
+CNSTI4 2052
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+NEI4 $4366
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+LABELV $4366
+LABELV $4360
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $4368
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 256
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $4371
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085-4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4369
+JUMPV
+LABELV $4371
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+NEI4 $4374
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRGP4 cgs+632912+64
+INDIRI4
+ASGNI4
+ADDRGP4 $4369
+JUMPV
+LABELV $4374
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+NEI4 $4378
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRGP4 cgs+632912+76
+INDIRI4
+ASGNI4
+ADDRGP4 $4369
+JUMPV
+LABELV $4378
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4369
+JUMPV
+LABELV $4368
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4369
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4354
+JUMPV
+LABELV $4353
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 110
+NEI4 $4382
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4384
+ADDRLP4 56
+ADDRGP4 cg+1330288
+INDIRI4
+ASGNI4
+ADDRGP4 $4385
+JUMPV
+LABELV $4384
+ADDRLP4 56
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4385
+ADDRLP4 64
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+GEI4 $4389
+ADDRLP4 64
+INDIRI4
+CNSTI4 64
+GEI4 $4383
+LABELV $4389
+ADDRLP4 60
+CNSTI4 4524
+ADDRLP4 56
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $4383
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 256
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4383
+JUMPV
+LABELV $4382
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 78
+NEI4 $4394
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4396
+ADDRLP4 56
+ADDRGP4 cg+1330292
+INDIRI4
+ASGNI4
+ADDRGP4 $4397
+JUMPV
+LABELV $4396
+ADDRLP4 56
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4397
+ADDRLP4 64
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+GEI4 $4401
+ADDRLP4 64
+INDIRI4
+CNSTI4 64
+GEI4 $4395
+LABELV $4401
+ADDRLP4 60
+CNSTI4 4524
+ADDRLP4 56
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $4395
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 256
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4395
+JUMPV
+LABELV $4394
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 108
+NEI4 $4406
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4408
+CNSTI4 4524
+ADDRGP4 cg+1330288
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4410
+ADDRGP4 $4415
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+1330288
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $4426
+JUMPV
+LABELV $4410
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4426
+JUMPV
+LABELV $4408
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4419
+ADDRGP4 $4415
+ARGP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $4426
+JUMPV
+LABELV $4419
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4426
+JUMPV
+LABELV $4425
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4426
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4425
+ADDRGP4 $4407
+JUMPV
+LABELV $4406
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 76
+NEI4 $4428
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4430
+CNSTI4 4524
+ADDRGP4 cg+1330288
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2380
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4432
+ADDRGP4 $4415
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+1330288
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2380
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $4447
+JUMPV
+LABELV $4432
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4447
+JUMPV
+LABELV $4430
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2380
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4440
+ADDRGP4 $4415
+ARGP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2380
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $4447
+JUMPV
+LABELV $4440
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4447
+JUMPV
+LABELV $4446
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4447
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4446
+ADDRGP4 $4429
+JUMPV
+LABELV $4428
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 120
+NEI4 $4449
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4451
+CNSTI4 4524
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4453
+ADDRGP4 $4415
+ARGP4
+CNSTI4 4524
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $4468
+JUMPV
+LABELV $4453
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4468
+JUMPV
+LABELV $4451
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+INDIRI4
+NEI4 $4459
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4468
+JUMPV
+LABELV $4459
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4461
+ADDRGP4 $4415
+ARGP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRGP4 $4468
+JUMPV
+LABELV $4461
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4468
+JUMPV
+LABELV $4467
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4468
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4467
+ADDRGP4 $4450
+JUMPV
+LABELV $4449
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 88
+NEI4 $4470
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4472
+CNSTI4 4524
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2380
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4474
+ADDRGP4 $4415
+ARGP4
+CNSTI4 4524
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2380
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $4489
+JUMPV
+LABELV $4474
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4489
+JUMPV
+LABELV $4472
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4104
+ADDP4
+INDIRI4
+NEI4 $4480
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4489
+JUMPV
+LABELV $4480
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2380
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4482
+ADDRGP4 $4415
+ARGP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+CNSTI4 2048
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2380
+ADDP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRGP4 $4489
+JUMPV
+LABELV $4482
+ADDRLP4 44
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $4489
+JUMPV
+LABELV $4488
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4489
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4488
+ADDRGP4 $4471
+JUMPV
+LABELV $4470
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $4491
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4495
+ARGP4
+ADDRLP4 64
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $4495
+ARGP4
+ADDRLP4 64
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 68
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $4493
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 258
+ASGNI4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $4495
+ARGP4
+ADDRLP4 76
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+CVIU4 4
+ADDRLP4 76
+INDIRU4
+ADDU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $821
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 sscanf
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+EQI4 $4496
+ADDRGP4 $4498
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+LABELV $4496
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4494
+JUMPV
+LABELV $4493
+ADDRGP4 $4501
+ARGP4
+ADDRLP4 72
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $4501
+ARGP4
+ADDRLP4 72
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 76
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $4499
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 259
+ASGNI4
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $4501
+ARGP4
+ADDRLP4 84
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+CVIU4 4
+ADDRLP4 84
+INDIRU4
+ADDU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $821
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 sscanf
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+EQI4 $4502
+ADDRGP4 $4504
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $4502
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4500
+JUMPV
+LABELV $4499
+ADDRGP4 $4507
+ARGP4
+ADDRLP4 80
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $4507
+ARGP4
+ADDRLP4 80
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 84
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $4505
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 260
+ASGNI4
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $4507
+ARGP4
+ADDRLP4 92
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+CVIU4 4
+ADDRLP4 92
+INDIRU4
+ADDU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $821
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 sscanf
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+EQI4 $4508
+ADDRGP4 $4510
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $4508
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4506
+JUMPV
+LABELV $4505
+ADDRGP4 $4513
+ARGP4
+ADDRLP4 88
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $4513
+ARGP4
+ADDRLP4 88
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 92
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $4511
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 261
+ASGNI4
+ADDRLP4 22796
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 22796
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 100
+CNSTI1 0
+ASGNI1
+ADDRGP4 $4513
+ARGP4
+ADDRLP4 22800
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 22796
+INDIRI4
+ADDI4
+CVIU4 4
+ADDRLP4 22800
+INDIRU4
+ADDU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $4514
+ARGP4
+ADDRLP4 1124
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 22804
+ADDRGP4 sscanf
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 22804
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 100
+ASGNP4
+ADDRGP4 $4516
+JUMPV
+LABELV $4515
+ADDRLP4 96
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $4518
+ADDRLP4 96
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $4517
+JUMPV
+LABELV $4518
+ADDRLP4 96
+ADDRLP4 96
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $4516
+ADDRLP4 96
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4515
+LABELV $4517
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+EQI4 $4520
+ADDRGP4 $4522
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1124
+CNSTI4 24
+ASGNI4
+ADDRLP4 100
+CNSTI1 0
+ASGNI1
+LABELV $4520
+ADDRLP4 100
+ARGP4
+ADDRLP4 1124
+INDIRI4
+ARGI4
+ADDRLP4 1128
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ADDRLP4 1128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4512
+JUMPV
+LABELV $4511
+ADDRGP4 $4525
+ARGP4
+ADDRLP4 96
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $4525
+ARGP4
+ADDRLP4 96
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 100
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $4523
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 262
+ASGNI4
+ADDRLP4 104
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $4525
+ARGP4
+ADDRLP4 108
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+CVIU4 4
+ADDRLP4 108
+INDIRU4
+ADDU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $821
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 sscanf
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+EQI4 $4526
+ADDRGP4 $4528
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $4526
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4524
+JUMPV
+LABELV $4523
+ADDRGP4 $4531
+ARGP4
+ADDRLP4 104
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $4531
+ARGP4
+ADDRLP4 104
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 108
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $4529
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 263
+ASGNI4
+ADDRLP4 112
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $4531
+ARGP4
+ADDRLP4 116
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+CVIU4 4
+ADDRLP4 116
+INDIRU4
+ADDU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $821
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 sscanf
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+EQI4 $4532
+ADDRGP4 $4534
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $4532
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4530
+JUMPV
+LABELV $4529
+ADDRGP4 $4537
+ARGP4
+ADDRLP4 112
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $4537
+ARGP4
+ADDRLP4 112
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 116
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $4535
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 264
+ASGNI4
+ADDRLP4 120
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $4537
+ARGP4
+ADDRLP4 124
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+CVIU4 4
+ADDRLP4 124
+INDIRU4
+ADDU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 $2242
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 sscanf
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+EQI4 $4538
+ADDRGP4 $4540
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4538
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4536
+JUMPV
+LABELV $4535
+ADDRGP4 $4541
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4536
+LABELV $4530
+LABELV $4524
+LABELV $4512
+LABELV $4506
+LABELV $4500
+LABELV $4494
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4543
+JUMPV
+LABELV $4542
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $4545
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4544
+JUMPV
+LABELV $4545
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4543
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4542
+LABELV $4544
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $4492
+ADDRGP4 $4549
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4492
+JUMPV
+LABELV $4491
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 37
+NEI4 $4550
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4085
+ADDP4
+CNSTI4 37
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4551
+JUMPV
+LABELV $4550
+ADDRGP4 $4552
+ARGP4
+ADDRLP4 48
+INDIRI1
+CVII4 1
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4551
+LABELV $4492
+LABELV $4471
+LABELV $4450
+LABELV $4429
+LABELV $4407
+LABELV $4395
+LABELV $4383
+LABELV $4354
+LABELV $4326
+LABELV $4310
+LABELV $4298
+LABELV $4296
+LABELV $4273
+LABELV $4249
+LABELV $4229
+LABELV $4204
+LABELV $4198
+LABELV $4180
+LABELV $4172
+LABELV $4161
+LABELV $4150
+LABELV $4142
+LABELV $4134
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4121
+ADDRGP4 $4120
+JUMPV
+LABELV $4122
+ADDRGP4 $4085
+RETP4
+LABELV $4084
+endproc CG_CreateFragString 22808 16
+proc CG_DrawCenterString 1132 44
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawCenterPrint+12
+INDIRI4
+CNSTI4 0
+NEI4 $4554
+ADDRGP4 $4553
+JUMPV
+LABELV $4554
+ADDRGP4 cg+626096
+INDIRI4
+CNSTI4 0
+NEI4 $4557
+ADDRGP4 $4553
+JUMPV
+LABELV $4557
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawCenterPrintWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawCenterPrintFade+12
+INDIRI4
+CNSTI4 0
+EQI4 $4561
+ADDRLP4 48
+ARGP4
+ADDRGP4 cg+626096
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawCenterPrintTime+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawCenterPrintFadeTime+12
+INDIRI4
+ARGI4
+ADDRGP4 CG_FadeColorVec4
+CALLV
+pop
+ADDRGP4 $4562
+JUMPV
+LABELV $4561
+ADDRLP4 64
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 48+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 48+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $4562
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 64
+INDIRF4
+NEF4 $4570
+ADDRLP4 48+4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+NEF4 $4570
+ADDRLP4 48+8
+INDIRF4
+ADDRLP4 64
+INDIRF4
+NEF4 $4570
+ADDRLP4 48+12
+INDIRF4
+ADDRLP4 64
+INDIRF4
+NEF4 $4570
+ADDRGP4 $4553
+JUMPV
+LABELV $4570
+ADDRGP4 cg_drawCenterPrintColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4575
+ADDRLP4 48
+ARGP4
+ADDRGP4 cg_drawCenterPrintColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+LABELV $4575
+ADDRGP4 cg_drawCenterPrintAlpha+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4578
+ADDRLP4 48+12
+ADDRGP4 cg_drawCenterPrintAlpha+12
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+CNSTF4 1065353216
+ADDRLP4 48+12
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 48+12
+INDIRF4
+CNSTF4 0
+GTF4 $4584
+ADDRGP4 $4553
+JUMPV
+LABELV $4584
+LABELV $4578
+ADDRLP4 48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 cg+626108
+ASGNP4
+ADDRGP4 cg_qlhud+12
+INDIRI4
+CNSTI4 0
+EQI4 $4588
+ADDRGP4 $4593
+ARGP4
+ADDRGP4 cg_drawCenterPrintScale+8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+666984
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+626104
+INDIRF4
+ADDRGP4 cg+627132
+INDIRI4
+CVIF4 4
+ADDRLP4 68
+INDIRF4
+MULF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $4600
+JUMPV
+LABELV $4588
+ADDRLP4 40
+ADDRGP4 cg+626104
+INDIRF4
+ADDRGP4 cg+627132
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 $4600
+JUMPV
+LABELV $4599
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16
+ADDRLP4 1092
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CVIU4 4
+CNSTU4 1024
+LTU4 $4602
+ADDRLP4 16
+CNSTI4 1024
+ASGNI4
+LABELV $4602
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4607
+JUMPV
+LABELV $4604
+ADDRLP4 1096
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+EQI4 $4610
+ADDRLP4 1096
+INDIRI4
+CNSTI4 10
+NEI4 $4608
+LABELV $4610
+ADDRGP4 $4606
+JUMPV
+LABELV $4608
+ADDRLP4 8
+INDIRI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $4605
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4607
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $4604
+LABELV $4606
+ADDRLP4 8
+INDIRI4
+ADDRLP4 68
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cg_qlhud+12
+INDIRI4
+CNSTI4 0
+EQI4 $4611
+ADDRGP4 cg_drawCenterPrintFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4614
+ADDRLP4 32
+ADDRGP4 cgs+632912+666984
+ASGNP4
+ADDRGP4 $4615
+JUMPV
+LABELV $4614
+ADDRLP4 32
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $4615
+ADDRGP4 cg+627136
+INDIRI4
+CNSTI4 0
+EQI4 $4621
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+626108
+CVPU4 4
+NEU4 $4621
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1104
+ADDRGP4 CG_CreateFragString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1104
+INDIRP4
+ASGNP4
+ADDRGP4 $4626
+JUMPV
+LABELV $4625
+ADDRLP4 1112
+CNSTI4 0
+ASGNI4
+ADDRLP4 1116
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4628
+ADDRGP4 $4683
+JUMPV
+LABELV $4628
+ADDRLP4 1108
+ADDRGP4 tmpExtString
+ASGNP4
+ADDRGP4 $4631
+JUMPV
+LABELV $4630
+ADDRLP4 1120
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+LTI4 $4633
+ADDRLP4 1120
+INDIRI4
+CNSTI4 255
+GTI4 $4633
+ADDRLP4 1108
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4635
+ADDRGP4 $4632
+JUMPV
+LABELV $4635
+ADDRLP4 1124
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1124
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1108
+ADDRLP4 1108
+INDIRP4
+ADDRLP4 1124
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $4631
+JUMPV
+LABELV $4633
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 258
+NEI4 $4637
+ADDRLP4 1124
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1124
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1116
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1124
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1112
+CNSTI4 1
+ASGNI4
+ADDRLP4 1108
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4632
+JUMPV
+LABELV $4637
+ADDRLP4 1108
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 4
+ADDRLP4 1124
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1124
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1108
+ADDRLP4 1108
+INDIRP4
+ADDRLP4 1124
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 4
+ADDRLP4 1128
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1128
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1108
+ADDRLP4 1108
+INDIRP4
+ADDRLP4 1128
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4631
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4630
+LABELV $4632
+ADDRLP4 1108
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1100
+ADDRLP4 68
+ASGNP4
+ADDRLP4 1096
+ADDRGP4 tmpExtString
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4640
+JUMPV
+LABELV $4639
+ADDRLP4 1120
+ADDRLP4 1096
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+LTI4 $4642
+ADDRLP4 1120
+INDIRI4
+CNSTI4 255
+GTI4 $4642
+ADDRLP4 1100
+INDIRP4
+ADDRLP4 1096
+INDIRP4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 1096
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4644
+ADDRGP4 $4641
+JUMPV
+LABELV $4644
+ADDRLP4 1100
+ADDRLP4 1100
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1096
+ADDRLP4 1096
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRGP4 $4640
+JUMPV
+LABELV $4642
+ADDRLP4 1096
+INDIRP4
+INDIRI4
+CNSTI4 256
+NEI4 $4646
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4646
+ADDRLP4 1096
+ADDRLP4 1096
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+LABELV $4640
+ADDRLP4 1096
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4639
+LABELV $4641
+ADDRLP4 1100
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 24
+ADDRGP4 cg_drawCenterPrintScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 1120
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 1120
+INDIRF4
+ASGNF4
+ADDRGP4 tmpExtString
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRGP4 cg_drawFragMessageIconScale+8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 1124
+ADDRGP4 CG_Text_Pic_Width
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 1124
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 cg_drawCenterPrintAlign+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 28
+CNSTF4 1142947840
+ADDRLP4 36
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRGP4 cg_drawCenterPrintX+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4651
+ADDRLP4 28
+ADDRGP4 cg_drawCenterPrintX+8
+INDIRF4
+ASGNF4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+NEI4 $4655
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $4656
+JUMPV
+LABELV $4655
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+NEI4 $4657
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $4657
+LABELV $4656
+LABELV $4651
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 48
+ARGP4
+ADDRGP4 tmpExtString
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawCenterPrintStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 cg_drawFragMessageIconScale+8
+INDIRF4
+ARGF4
+ADDRGP4 CG_Text_Pic_Paint
+CALLV
+pop
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+EQI4 $4661
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+ADDRLP4 1116
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $4662
+JUMPV
+LABELV $4661
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1086324736
+ADDF4
+ADDF4
+ASGNF4
+LABELV $4662
+LABELV $4626
+ADDRGP4 $4625
+JUMPV
+ADDRGP4 $4683
+JUMPV
+LABELV $4621
+ADDRLP4 24
+ADDRGP4 cg_drawCenterPrintScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 1096
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 1100
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 cg_drawCenterPrintAlign+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 28
+CNSTF4 1142947840
+ADDRLP4 36
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRGP4 cg_drawCenterPrintX+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4665
+ADDRLP4 28
+ADDRGP4 cg_drawCenterPrintX+8
+INDIRF4
+ASGNF4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+NEI4 $4669
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $4670
+JUMPV
+LABELV $4669
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+NEI4 $4671
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $4671
+LABELV $4670
+LABELV $4665
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 48
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawCenterPrintStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1086324736
+ADDF4
+ADDF4
+ASGNF4
+ADDRGP4 $4683
+JUMPV
+LABELV $4611
+ADDRLP4 68
+ARGP4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRLP4 1096
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg+626100
+INDIRI4
+CVIF4 4
+ADDRLP4 1096
+INDIRF4
+MULF4
+CNSTF4 1098907648
+DIVF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1142947840
+ADDRLP4 36
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 1100
+CNSTI4 0
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cg+626100
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRGP4 cg+626100
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 1100
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+CNSTF4 1069547520
+ADDRGP4 cg+626100
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $4683
+JUMPV
+LABELV $4682
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $4683
+ADDRLP4 1096
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+EQI4 $4685
+ADDRLP4 1096
+INDIRI4
+CNSTI4 10
+NEI4 $4682
+LABELV $4685
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4686
+ADDRGP4 $4601
+JUMPV
+LABELV $4686
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $4688
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $4688
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4690
+ADDRGP4 $4601
+JUMPV
+LABELV $4690
+LABELV $4600
+ADDRGP4 $4599
+JUMPV
+LABELV $4601
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $4553
+endproc CG_DrawCenterString 1132 44
+proc CG_DrawFragMessage 1116 44
+ADDRGP4 cg_drawFragMessageSeparate+12
+INDIRI4
+CNSTI4 0
+NEI4 $4693
+ADDRGP4 $4692
+JUMPV
+LABELV $4693
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1330284
+INDIRI4
+SUBI4
+ADDRGP4 cg_drawFragMessageTime+12
+INDIRI4
+LEI4 $4696
+ADDRGP4 $4692
+JUMPV
+LABELV $4696
+ADDRGP4 cg+1329260
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4701
+ADDRGP4 $4692
+JUMPV
+LABELV $4701
+ADDRGP4 cg_drawFragMessageFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4704
+ADDRLP4 32
+ADDRGP4 cgs+632912+688660
+ASGNP4
+ADDRGP4 $4705
+JUMPV
+LABELV $4704
+ADDRLP4 32
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $4705
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawFragMessageWideScreen+12
+INDIRI4
+ASGNI4
+ADDRLP4 1084
+ADDRGP4 cg_drawFragMessageY+8
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg_drawFragMessageScale+8
+INDIRF4
+ASGNF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1088
+ADDRGP4 CG_CreateFragString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1088
+INDIRP4
+ASGNP4
+ADDRGP4 $4715
+JUMPV
+LABELV $4714
+ADDRLP4 1096
+CNSTI4 0
+ASGNI4
+ADDRLP4 1100
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4717
+ADDRGP4 $4716
+JUMPV
+LABELV $4717
+ADDRLP4 1092
+ADDRGP4 tmpExtString
+ASGNP4
+ADDRGP4 $4720
+JUMPV
+LABELV $4719
+ADDRLP4 1104
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+LTI4 $4722
+ADDRLP4 1104
+INDIRI4
+CNSTI4 255
+GTI4 $4722
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4724
+ADDRGP4 $4721
+JUMPV
+LABELV $4724
+ADDRLP4 1108
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1108
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1092
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 1108
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $4720
+JUMPV
+LABELV $4722
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 258
+NEI4 $4726
+ADDRLP4 1108
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1108
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1100
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1108
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1096
+CNSTI4 1
+ASGNI4
+ADDRLP4 1092
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4721
+JUMPV
+LABELV $4726
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 4
+ADDRLP4 1108
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1108
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1092
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 1108
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 4
+ADDRLP4 1112
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1112
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1092
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 1112
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4720
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4719
+LABELV $4721
+ADDRLP4 1092
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 56
+ASGNP4
+ADDRLP4 4
+ADDRGP4 tmpExtString
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4729
+JUMPV
+LABELV $4728
+ADDRLP4 1104
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+LTI4 $4731
+ADDRLP4 1104
+INDIRI4
+CNSTI4 255
+GTI4 $4731
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4733
+ADDRGP4 $4730
+JUMPV
+LABELV $4733
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRGP4 $4729
+JUMPV
+LABELV $4731
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 256
+NEI4 $4735
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4735
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+LABELV $4729
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4728
+LABELV $4730
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 52
+ADDRLP4 56
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 1104
+INDIRF4
+ASGNF4
+ADDRGP4 tmpExtString
+ARGP4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cg_drawFragMessageIconScale+8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 CG_Text_Pic_Width
+CALLF4
+ASGNF4
+ADDRLP4 1080
+ADDRLP4 1108
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 cg_drawFragMessageX+8
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cg_drawFragMessageAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+NEI4 $4740
+ADDRLP4 44
+ADDRLP4 44
+INDIRF4
+ADDRLP4 1080
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $4741
+JUMPV
+LABELV $4740
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+NEI4 $4742
+ADDRLP4 44
+ADDRLP4 44
+INDIRF4
+ADDRLP4 1080
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $4742
+LABELV $4741
+ADDRGP4 cg_drawFragMessageFade+12
+INDIRI4
+CNSTI4 0
+EQI4 $4744
+ADDRLP4 12
+ARGP4
+ADDRGP4 cg+1330284
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawFragMessageTime+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawFragMessageFadeTime+12
+INDIRI4
+ARGI4
+ADDRGP4 CG_FadeColorVec4
+CALLV
+pop
+ADDRGP4 $4745
+JUMPV
+LABELV $4744
+ADDRLP4 1112
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+ADDRLP4 1112
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 1112
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $4745
+ADDRLP4 12+12
+INDIRF4
+CNSTF4 0
+GTF4 $4753
+ADDRGP4 $4692
+JUMPV
+LABELV $4753
+ADDRGP4 cg_drawFragMessageColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4756
+ADDRLP4 12
+ARGP4
+ADDRGP4 cg_drawFragMessageColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+LABELV $4756
+ADDRGP4 cg_drawFragMessageAlpha+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4759
+ADDRLP4 12+12
+ADDRGP4 cg_drawFragMessageAlpha+12
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+CNSTF4 1065353216
+ADDRLP4 12+12
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 12+12
+INDIRF4
+CNSTF4 0
+GTF4 $4765
+ADDRGP4 $4692
+JUMPV
+LABELV $4765
+LABELV $4759
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 1084
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 tmpExtString
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawFragMessageStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 cg_drawFragMessageIconScale+8
+INDIRF4
+ARGF4
+ADDRGP4 CG_Text_Pic_Paint
+CALLV
+pop
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+EQI4 $4770
+ADDRLP4 1084
+ADDRLP4 1084
+INDIRF4
+ADDRLP4 1100
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4770
+LABELV $4715
+ADDRGP4 $4714
+JUMPV
+LABELV $4716
+LABELV $4692
+endproc CG_DrawFragMessage 1116 44
+proc Wolfcam_DrawCrosshair 68 36
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $4773
+ADDRGP4 $4772
+JUMPV
+LABELV $4773
+ADDRLP4 44
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg_crosshairX+8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg_crosshairY+8
+INDIRF4
+ASGNF4
+ADDRGP4 QLWideScreen
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+CNSTI4 3
+NEI4 $4780
+ADDRLP4 40
+ADDRGP4 cgs+20100+19500
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+20100+19496
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1061158912
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRLP4 48
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $4781
+JUMPV
+LABELV $4780
+ADDRLP4 8
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+LABELV $4781
+ADDRLP4 0
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $4790
+ADDRGP4 $4772
+JUMPV
+LABELV $4790
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4792
+ADDRGP4 $4772
+JUMPV
+LABELV $4792
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492004
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 cg_crosshairColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 20+12
+ADDRGP4 cg_crosshairAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 48
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 52
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+609412
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+609412+8
+INDIRI4
+CVIF4 4
+ADDRLP4 52
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 56
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+609412+4
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+609412+12
+INDIRI4
+CVIF4 4
+ADDRLP4 56
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 64
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $4772
+endproc Wolfcam_DrawCrosshair 68 36
+export CG_CreateNewCrosshairs
+proc CG_CreateNewCrosshairs 72 16
+ADDRGP4 $4806
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 cg_crosshairBrightness+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg_crosshairAlphaAdjust+12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+NEF4 $4809
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $4809
+ADDRGP4 $4811
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+LABELV $4812
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492004
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 trap_GetShaderImageDimensions
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 64
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $4820
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $4818
+LABELV $4820
+ADDRGP4 $4821
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4813
+JUMPV
+LABELV $4818
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492004
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 14
+LSHI4
+ADDRGP4 cgs+632912+484
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_ReplaceShaderImage
+CALLV
+pop
+LABELV $4813
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 30
+LTI4 $4812
+ADDRGP4 $4805
+JUMPV
+LABELV $4809
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+LABELV $4826
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492004
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 trap_GetShaderImageDimensions
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 64
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $4834
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $4832
+LABELV $4834
+ADDRGP4 $4821
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4827
+JUMPV
+LABELV $4832
+ADDRGP4 imgBuff
+ARGP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 14
+LSHI4
+ADDRGP4 cgs+632912+484
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4840
+JUMPV
+LABELV $4837
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+NEI4 $4841
+ADDRGP4 $4838
+JUMPV
+LABELV $4841
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $4844
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff+3
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 255
+LEI4 $4847
+ADDRLP4 32
+CNSTI4 255
+ASGNI4
+ADDRGP4 $4845
+JUMPV
+LABELV $4847
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+GEI4 $4845
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4845
+JUMPV
+LABELV $4844
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 125
+GEI4 $4851
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff+3
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 255
+LEI4 $4855
+ADDRLP4 32
+CNSTI4 255
+ASGNI4
+ADDRGP4 $4852
+JUMPV
+LABELV $4855
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+GEI4 $4852
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4852
+JUMPV
+LABELV $4851
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff+3
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+LABELV $4852
+LABELV $4845
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff+3
+ADDP4
+ADDRLP4 32
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $4861
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $4862
+JUMPV
+LABELV $4861
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4862
+ADDRLP4 28
+INDIRF4
+CNSTF4 1132396544
+LEF4 $4863
+ADDRLP4 28
+CNSTF4 1132396544
+ASGNF4
+ADDRGP4 $4864
+JUMPV
+LABELV $4863
+ADDRLP4 28
+INDIRF4
+CNSTF4 0
+GEF4 $4865
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+LABELV $4865
+LABELV $4864
+ADDRLP4 44
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LTF4 $4868
+ADDRLP4 36
+ADDRLP4 28
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $4869
+JUMPV
+LABELV $4868
+ADDRLP4 36
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $4869
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff
+ADDP4
+ADDRLP4 36
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $4870
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff+1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $4871
+JUMPV
+LABELV $4870
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff+1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4871
+ADDRLP4 28
+INDIRF4
+CNSTF4 1132396544
+LEF4 $4874
+ADDRLP4 28
+CNSTF4 1132396544
+ASGNF4
+ADDRGP4 $4875
+JUMPV
+LABELV $4874
+ADDRLP4 28
+INDIRF4
+CNSTF4 0
+GEF4 $4876
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+LABELV $4876
+LABELV $4875
+ADDRLP4 56
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 56
+INDIRF4
+LTF4 $4880
+ADDRLP4 48
+ADDRLP4 28
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $4881
+JUMPV
+LABELV $4880
+ADDRLP4 48
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $4881
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff+1
+ADDP4
+ADDRLP4 48
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $4882
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff+2
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $4883
+JUMPV
+LABELV $4882
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff+2
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4883
+ADDRLP4 28
+INDIRF4
+CNSTF4 1132396544
+LEF4 $4886
+ADDRLP4 28
+CNSTF4 1132396544
+ASGNF4
+ADDRGP4 $4887
+JUMPV
+LABELV $4886
+ADDRLP4 28
+INDIRF4
+CNSTF4 0
+GEF4 $4888
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+LABELV $4888
+LABELV $4887
+ADDRLP4 68
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 68
+INDIRF4
+LTF4 $4892
+ADDRLP4 60
+ADDRLP4 28
+INDIRF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $4893
+JUMPV
+LABELV $4892
+ADDRLP4 60
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $4893
+ADDRLP4 0
+INDIRI4
+ADDRGP4 imgBuff+2
+ADDP4
+ADDRLP4 60
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $4838
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+LABELV $4840
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+LTI4 $4837
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492004
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 imgBuff
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_ReplaceShaderImage
+CALLV
+pop
+LABELV $4827
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 30
+LTI4 $4826
+LABELV $4805
+endproc CG_CreateNewCrosshairs 72 16
+proc CG_CrosshairSetHitColor 20 4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1335092
+INDIRI4
+SUBI4
+ADDRGP4 cg_crosshairHitTime+12
+INDIRI4
+GEI4 $4897
+ADDRGP4 cg+1335100
+INDIRI4
+CNSTI4 0
+NEI4 $4902
+ADDRLP4 0
+CNSTF4 1046562734
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1060152279
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1063172178
+ASGNF4
+ADDRGP4 $4903
+JUMPV
+LABELV $4902
+ADDRGP4 cg+1335100
+INDIRI4
+CNSTI4 1
+NEI4 $4907
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $4908
+JUMPV
+LABELV $4907
+ADDRGP4 cg+1335100
+INDIRI4
+CNSTI4 2
+NEI4 $4912
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1335096
+INDIRI4
+CNSTI4 80
+LEI4 $4913
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $4913
+JUMPV
+LABELV $4912
+ADDRGP4 cg+1335100
+INDIRI4
+CNSTI4 3
+NEI4 $4922
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $4923
+JUMPV
+LABELV $4922
+ADDRLP4 0
+CNSTF4 1046562734
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1060152279
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1063172178
+ASGNF4
+LABELV $4923
+LABELV $4913
+LABELV $4908
+LABELV $4903
+ADDRLP4 0+12
+ADDRGP4 cg_crosshairAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $4897
+LABELV $4896
+endproc CG_CrosshairSetHitColor 20 4
+proc CG_DrawCrosshair 88 36
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $4932
+ADDRGP4 $4931
+JUMPV
+LABELV $4932
+ADDRGP4 cg_crosshairBrightness+8
+INDIRF4
+ADDRGP4 cg+1335104
+INDIRF4
+NEF4 $4941
+ADDRGP4 cg_crosshairAlphaAdjust+12
+INDIRI4
+ADDRGP4 cg+1335108
+INDIRI4
+EQI4 $4935
+LABELV $4941
+ADDRGP4 CG_CreateNewCrosshairs
+CALLV
+pop
+ADDRGP4 cg+1335104
+ADDRGP4 cg_crosshairBrightness+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1335108
+ADDRGP4 cg_crosshairAlphaAdjust+12
+INDIRI4
+ASGNI4
+LABELV $4935
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4946
+ADDRGP4 Wolfcam_DrawCrosshair
+CALLV
+pop
+ADDRGP4 $4931
+JUMPV
+LABELV $4946
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $4948
+ADDRGP4 $4931
+JUMPV
+LABELV $4948
+ADDRGP4 cg+607188
+INDIRI4
+CNSTI4 0
+EQI4 $4951
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $4931
+ADDRGP4 cg_freecam_crosshair+12
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $4931
+LABELV $4951
+LABELV $4958
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $4959
+ADDRLP4 48
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $4960
+JUMPV
+LABELV $4959
+ADDRGP4 cg_crosshairColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4962
+ADDRLP4 24
+ARGP4
+ADDRGP4 cg_crosshairColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 24+12
+ADDRGP4 cg_crosshairAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $4963
+JUMPV
+LABELV $4962
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $4963
+LABELV $4960
+ADDRLP4 48
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRGP4 cg_crosshairPulse+12
+INDIRI4
+CNSTI4 0
+EQI4 $4968
+ADDRLP4 12
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+627412
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $4973
+ADDRLP4 12
+INDIRF4
+CNSTF4 1128792064
+GEF4 $4973
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+LABELV $4973
+LABELV $4968
+ADDRLP4 16
+ADDRGP4 cg_crosshairX+8
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 cg_crosshairY+8
+INDIRF4
+ASGNF4
+ADDRGP4 QLWideScreen
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+CNSTI4 3
+NEI4 $4977
+ADDRLP4 44
+ADDRGP4 cgs+20100+19500
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+20100+19496
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 52
+INDIRF4
+CNSTF4 1061158912
+ADDRLP4 44
+INDIRF4
+SUBF4
+ADDRLP4 52
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $4978
+JUMPV
+LABELV $4977
+ADDRLP4 8
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+LABELV $4978
+ADDRLP4 0
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $4987
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $4931
+JUMPV
+LABELV $4987
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4989
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $4931
+JUMPV
+LABELV $4989
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492004
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_crosshairHitStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $4993
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1335092
+INDIRI4
+SUBI4
+ADDRGP4 cg_crosshairHitTime+12
+INDIRI4
+GEI4 $4994
+ADDRGP4 cg+1335100
+INDIRI4
+CNSTI4 0
+NEI4 $5001
+ADDRLP4 52
+CNSTF4 1046562734
+ASGNF4
+ADDRLP4 52+4
+CNSTF4 1060152279
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1063172178
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 72
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+609412
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 68
+INDIRF4
+ADDRGP4 cg+609412+8
+INDIRI4
+CVIF4 4
+ADDRLP4 72
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 76
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 cg+609412+4
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 68
+INDIRF4
+ADDRGP4 cg+609412+12
+INDIRI4
+CVIF4 4
+ADDRLP4 76
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 80
+CNSTF4 0
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 84
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 24+12
+CNSTF4 0
+ASGNF4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $4931
+JUMPV
+LABELV $5001
+ADDRGP4 cg+1335100
+INDIRI4
+CNSTI4 1
+NEI4 $5014
+ADDRLP4 52
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $5015
+JUMPV
+LABELV $5014
+ADDRGP4 cg+1335100
+INDIRI4
+CNSTI4 2
+NEI4 $5019
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1335096
+INDIRI4
+CNSTI4 80
+LEI4 $5020
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $5020
+JUMPV
+LABELV $5019
+ADDRGP4 cg+1335100
+INDIRI4
+CNSTI4 3
+NEI4 $5029
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $5030
+JUMPV
+LABELV $5029
+ADDRLP4 24
+CNSTF4 1046562734
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 1060152279
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1063172178
+ASGNF4
+LABELV $5030
+LABELV $5020
+LABELV $5015
+ADDRLP4 24+12
+ADDRGP4 cg_crosshairAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $4994
+JUMPV
+LABELV $4993
+ADDRGP4 cg_crosshairHitStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $5038
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1335092
+INDIRI4
+SUBI4
+ADDRGP4 cg_crosshairHitTime+12
+INDIRI4
+GEI4 $5039
+ADDRLP4 24
+ARGP4
+ADDRGP4 cg_crosshairHitColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 24+12
+ADDRGP4 cg_crosshairAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $5039
+JUMPV
+LABELV $5038
+ADDRGP4 cg_crosshairHitStyle+12
+INDIRI4
+CNSTI4 3
+NEI4 $5048
+ADDRLP4 12
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1335092
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $5049
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg_crosshairHitTime+12
+INDIRI4
+CVIF4 4
+GEF4 $5049
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg_crosshairHitTime+12
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $5049
+JUMPV
+LABELV $5048
+ADDRGP4 cg_crosshairHitStyle+12
+INDIRI4
+CNSTI4 4
+NEI4 $5057
+ADDRLP4 12
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1335092
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $5062
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg_crosshairHitTime+12
+INDIRI4
+CVIF4 4
+GEF4 $5062
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg_crosshairHitTime+12
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+LABELV $5062
+ADDRGP4 CG_CrosshairSetHitColor
+CALLV
+pop
+ADDRGP4 $5058
+JUMPV
+LABELV $5057
+ADDRGP4 cg_crosshairHitStyle+12
+INDIRI4
+CNSTI4 5
+NEI4 $5066
+ADDRLP4 12
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1335092
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $5071
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg_crosshairHitTime+12
+INDIRI4
+CVIF4 4
+GEF4 $5071
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg_crosshairHitTime+12
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+LABELV $5071
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1335092
+INDIRI4
+SUBI4
+ADDRGP4 cg_crosshairHitTime+12
+INDIRI4
+GEI4 $5067
+ADDRLP4 24
+ARGP4
+ADDRGP4 cg_crosshairHitColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 24+12
+ADDRGP4 cg_crosshairAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $5067
+JUMPV
+LABELV $5066
+ADDRGP4 cg_crosshairHitStyle+12
+INDIRI4
+CNSTI4 6
+NEI4 $5082
+ADDRLP4 12
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1335092
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $5083
+ADDRLP4 12
+INDIRF4
+CNSTF4 1128792064
+GEF4 $5083
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $5083
+JUMPV
+LABELV $5082
+ADDRGP4 cg_crosshairHitStyle+12
+INDIRI4
+CNSTI4 7
+NEI4 $5089
+ADDRLP4 12
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1335092
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $5094
+ADDRLP4 12
+INDIRF4
+CNSTF4 1128792064
+GEF4 $5094
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+LABELV $5094
+ADDRGP4 CG_CrosshairSetHitColor
+CALLV
+pop
+ADDRGP4 $5090
+JUMPV
+LABELV $5089
+ADDRGP4 cg_crosshairHitStyle+12
+INDIRI4
+CNSTI4 8
+NEI4 $5096
+ADDRLP4 12
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1335092
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $5101
+ADDRLP4 12
+INDIRF4
+CNSTF4 1128792064
+GEF4 $5101
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+LABELV $5101
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1335092
+INDIRI4
+SUBI4
+ADDRGP4 cg_crosshairHitTime+12
+INDIRI4
+GEI4 $5103
+ADDRLP4 24
+ARGP4
+ADDRGP4 cg_crosshairHitColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 24+12
+ADDRGP4 cg_crosshairAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $5103
+LABELV $5096
+LABELV $5090
+LABELV $5083
+LABELV $5067
+LABELV $5058
+LABELV $5049
+LABELV $5039
+LABELV $4994
+ADDRLP4 52
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 56
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+609412
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 52
+INDIRF4
+ADDRGP4 cg+609412+8
+INDIRI4
+CVIF4 4
+ADDRLP4 56
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 60
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 cg+609412+4
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 52
+INDIRF4
+ADDRGP4 cg+609412+12
+INDIRI4
+CVIF4 4
+ADDRLP4 60
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $4931
+endproc CG_DrawCrosshair 88 36
+proc CG_ScanForCrosshairEntity 92 28
+ADDRLP4 56
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 84
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 68
+ADDRLP4 56
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+609412+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+609412+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 cg+609412+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5132
+ADDRLP4 80
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $5133
+JUMPV
+LABELV $5132
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $5135
+ADDRLP4 80
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $5136
+JUMPV
+LABELV $5135
+ADDRLP4 80
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5136
+LABELV $5133
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 88
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 Wolfcam_WeaponTrace
+CALLV
+pop
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 64
+LTI4 $5139
+ADDRGP4 $5117
+JUMPV
+LABELV $5139
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 0
+LTI4 $5146
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 64
+LTI4 $5142
+LABELV $5146
+ADDRGP4 $5117
+JUMPV
+LABELV $5142
+CNSTI4 1496
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_INVIS
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $5147
+ADDRGP4 $5117
+JUMPV
+LABELV $5147
+ADDRGP4 cg+627144
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627148
+ADDRGP4 cg+607168
+INDIRI4
+ASGNI4
+LABELV $5117
+endproc CG_ScanForCrosshairEntity 92 28
+proc CG_DrawCrosshairNames 52 36
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $5156
+LABELV $5156
+ADDRGP4 cg_drawCrosshairNames+12
+INDIRI4
+CNSTI4 0
+NEI4 $5159
+ADDRGP4 $5155
+JUMPV
+LABELV $5159
+ADDRGP4 cg+607188
+INDIRI4
+CNSTI4 0
+EQI4 $5162
+LABELV $5162
+ADDRGP4 cg+627144
+INDIRI4
+CNSTI4 0
+LTI4 $5169
+ADDRGP4 cg+627144
+INDIRI4
+CNSTI4 64
+LTI4 $5165
+LABELV $5169
+ADDRGP4 $5155
+JUMPV
+LABELV $5165
+CNSTI4 1496
+ADDRGP4 cg+627144
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $5170
+ADDRGP4 $5155
+JUMPV
+LABELV $5170
+ADDRGP4 cg_drawCrosshairNamesFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5174
+ADDRLP4 20
+ADDRGP4 cgs+632912+840404
+ASGNP4
+ADDRGP4 $5175
+JUMPV
+LABELV $5174
+ADDRLP4 20
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $5175
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawCrosshairNamesWideScreen+12
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cg_drawCrosshairNamesAlign+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+607168
+INDIRI4
+ADDRGP4 cg+627148
+INDIRI4
+SUBI4
+ADDRGP4 cg_drawCrosshairNamesTime+12
+INDIRI4
+LEI4 $5183
+ADDRGP4 $5155
+JUMPV
+LABELV $5183
+ADDRGP4 cg_drawCrosshairNames+12
+INDIRI4
+CNSTI4 2
+NEI4 $5188
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+NEI4 $5188
+CNSTI4 4524
+ADDRGP4 cg+627144
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $5192
+ADDRGP4 $5155
+JUMPV
+LABELV $5192
+LABELV $5188
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg_drawCrosshairNamesColor
+ARGP4
+ADDRGP4 cg_drawCrosshairNamesAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRGP4 cg_drawCrosshairNamesFade+12
+INDIRI4
+CNSTI4 0
+EQI4 $5196
+ADDRGP4 cg+627148
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawCrosshairNamesFadeTime+12
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_FadeColorRealTime
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $5201
+ADDRGP4 $5155
+JUMPV
+LABELV $5201
+ADDRLP4 0+12
+ADDRLP4 0+12
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+LABELV $5196
+ADDRLP4 0+12
+INDIRF4
+CNSTF4 0
+GTF4 $5204
+ADDRGP4 $5155
+JUMPV
+LABELV $5204
+ADDRLP4 36
+CNSTI4 4524
+ADDRGP4 cg+627144
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5210
+ADDRGP4 $5212
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+627144
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $5211
+JUMPV
+LABELV $5210
+ADDRLP4 16
+CNSTI4 4524
+ADDRGP4 cg+627144
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ASGNP4
+LABELV $5211
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 cg_drawCrosshairNamesScale+8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 cg_drawCrosshairNamesX+8
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg_drawCrosshairNamesY+8
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+NEI4 $5222
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $5223
+JUMPV
+LABELV $5222
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+NEI4 $5224
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $5224
+LABELV $5223
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 cg_drawCrosshairNamesScale+8
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawCrosshairNamesStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $5155
+endproc CG_DrawCrosshairNames 52 36
+proc CG_DrawCrosshairTeammateHealth 120 36
+ADDRGP4 cg_drawCrosshairTeammateHealth+12
+INDIRI4
+CNSTI4 0
+NEI4 $5229
+ADDRGP4 $5228
+JUMPV
+LABELV $5229
+ADDRGP4 cg+627144
+INDIRI4
+CNSTI4 0
+LTI4 $5236
+ADDRGP4 cg+627144
+INDIRI4
+CNSTI4 64
+LTI4 $5232
+LABELV $5236
+ADDRGP4 $5228
+JUMPV
+LABELV $5232
+CNSTI4 1496
+ADDRGP4 cg+627144
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $5237
+ADDRGP4 $5228
+JUMPV
+LABELV $5237
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CNSTI4 0
+GTI4 $5241
+ADDRGP4 $5228
+JUMPV
+LABELV $5241
+ADDRGP4 cg+607168
+INDIRI4
+ADDRGP4 cg+627148
+INDIRI4
+SUBI4
+ADDRGP4 cg_drawCrosshairTeammateHealthTime+12
+INDIRI4
+LEI4 $5243
+ADDRGP4 $5228
+JUMPV
+LABELV $5243
+CNSTI4 4524
+ADDRGP4 cg+627144
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $5248
+ADDRGP4 $5228
+JUMPV
+LABELV $5248
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawCrosshairTeammateHealthWideScreen+12
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRGP4 cg_drawCrosshairTeammateHealthAlpha+12
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRGP4 cg_drawCrosshairTeammateHealthColor
+ARGP4
+ADDRGP4 cg_drawCrosshairTeammateHealthAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRGP4 cg_drawCrosshairTeammateHealthFade+12
+INDIRI4
+CNSTI4 0
+EQI4 $5254
+ADDRGP4 cg+627148
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawCrosshairTeammateHealthFadeTime+12
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_FadeColorRealTime
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $5259
+ADDRGP4 $5228
+JUMPV
+LABELV $5259
+ADDRLP4 36+12
+ADDRLP4 36+12
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 76
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+LABELV $5254
+ADDRLP4 36+12
+INDIRF4
+CNSTF4 0
+GTF4 $5262
+ADDRGP4 $5228
+JUMPV
+LABELV $5262
+ADDRGP4 cg+627144
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 Wolfcam_PlayerHealth
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627144
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 Wolfcam_PlayerArmor
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRGP4 cg_drawCrosshairTeammateHealthAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 cg_drawCrosshairTeammateHealthScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 cg_drawCrosshairTeammateHealthStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawCrosshairTeammateHealthFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5270
+ADDRLP4 24
+ADDRGP4 cgs+632912+862080
+ASGNP4
+ADDRGP4 $5271
+JUMPV
+LABELV $5270
+ADDRLP4 24
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $5271
+ADDRLP4 28
+ADDRGP4 cg_drawCrosshairTeammateHealthX+8
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 cg_drawCrosshairTeammateHealthY+8
+INDIRF4
+ASGNF4
+ADDRGP4 $5279
+ARGP4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+NEI4 $5280
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $5281
+JUMPV
+LABELV $5280
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+NEI4 $5282
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $5282
+LABELV $5281
+ADDRGP4 cg_drawCrosshairTeammateHealthColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5284
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $5285
+JUMPV
+LABELV $5284
+ADDRLP4 60
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 4+12
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 $5288
+ARGP4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+12
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 $5292
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 4+12
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 $5294
+ARGP4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $5285
+LABELV $5228
+endproc CG_DrawCrosshairTeammateHealth 120 36
+proc CG_DrawKeyPress 24 20
+ADDRGP4 cg_drawKeyPress+12
+INDIRI4
+CNSTI4 0
+NEI4 $5296
+ADDRGP4 $5295
+JUMPV
+LABELV $5296
+ADDRGP4 QLWideScreen
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+6770160
+INDIRI4
+CNSTI4 0
+EQI4 $5299
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $5302
+CNSTI4 1
+ARGI4
+CNSTI4 50
+ARGI4
+ADDRGP4 $369
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_CheckCpmaVersion
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $5302
+ADDRGP4 colorGreen
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $5303
+JUMPV
+LABELV $5302
+ADDRGP4 colorYellow
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $5303
+CNSTF4 1134559232
+ADDRLP4 0
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+CNSTF4 1131413504
+CNSTF4 1077936128
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+1317500
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $5299
+ADDRGP4 cg+6770164
+INDIRI4
+CNSTI4 0
+EQI4 $5307
+ADDRGP4 colorGreen
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 1134559232
+ADDRLP4 0
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+CNSTF4 1077936128
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1131413504
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+1317504
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $5307
+ADDRGP4 cg+6770168
+INDIRI4
+CNSTI4 0
+EQI4 $5312
+ADDRGP4 colorGreen
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1134559232
+ADDF4
+ARGF4
+CNSTF4 1131413504
+ADDRLP4 4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+1317508
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $5312
+ADDRGP4 cg+6770172
+INDIRI4
+CNSTI4 0
+EQI4 $5317
+ADDRGP4 colorGreen
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 1134559232
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1131413504
+ADDRLP4 4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+1317512
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $5317
+ADDRGP4 cg+6770176
+INDIRI4
+CNSTI4 0
+EQI4 $5322
+ADDRGP4 colorRed
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+CNSTF4 1077936128
+ASGNF4
+CNSTF4 1134559232
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1131413504
+ADDRLP4 12
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+1317516
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $5322
+ADDRGP4 cg+6770180
+INDIRI4
+CNSTI4 0
+EQI4 $5327
+ADDRGP4 colorBlue
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1134559232
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1131413504
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+1317516
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $5327
+ADDRGP4 cg+6770184
+INDIRI4
+CNSTI4 0
+EQI4 $5332
+ADDRGP4 colorCyan
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1134559232
+ADDF4
+ARGF4
+CNSTF4 1131413504
+ADDRLP4 12
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+1317516
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $5332
+LABELV $5295
+endproc CG_DrawKeyPress 24 20
+proc CG_DrawSpectator 0 16
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $5338
+ADDRGP4 $5337
+JUMPV
+LABELV $5338
+ADDRGP4 QLWideScreen
+CNSTI4 2
+ASGNI4
+CNSTI4 248
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $5341
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $5342
+CNSTI4 200
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $5345
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $5343
+JUMPV
+LABELV $5342
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $5346
+CNSTI4 8
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $5349
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $5346
+LABELV $5343
+LABELV $5337
+endproc CG_DrawSpectator 0 16
+proc CG_VoteAnnouncements 0 8
+ADDRGP4 cgs+40116
+INDIRI4
+CNSTI4 0
+NEI4 $5351
+ADDRGP4 $5350
+JUMPV
+LABELV $5351
+ADDRGP4 cgs+40128
+INDIRI4
+CNSTI4 0
+EQI4 $5354
+ADDRGP4 cgs+40128
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_audioAnnouncerVote+12
+INDIRI4
+CNSTI4 0
+EQI4 $5358
+ADDRGP4 cgs+632912+492992
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $5358
+LABELV $5354
+LABELV $5350
+endproc CG_VoteAnnouncements 0 8
+proc CG_DrawVote 60 36
+ADDRGP4 cg_drawVote+12
+INDIRI4
+CNSTI4 0
+NEI4 $5364
+ADDRGP4 $5363
+JUMPV
+LABELV $5364
+ADDRGP4 cgs+40116
+INDIRI4
+CNSTI4 0
+NEI4 $5367
+ADDRGP4 $5363
+JUMPV
+LABELV $5367
+ADDRLP4 0
+CNSTI4 30000
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+40116
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $5372
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $5372
+ADDRLP4 24
+ARGP4
+ADDRGP4 cg_drawVoteColor
+ARGP4
+ADDRGP4 cg_drawVoteAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 cg_drawVoteAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg_drawVoteScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 cg_drawVoteStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawVoteWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawVoteFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5378
+ADDRLP4 12
+ADDRGP4 cgs+632912+927108
+ASGNP4
+ADDRGP4 $5379
+JUMPV
+LABELV $5378
+ADDRLP4 12
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $5379
+ADDRLP4 16
+ADDRGP4 cg_drawVoteX+8
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg_drawVoteY+8
+INDIRF4
+ASGNF4
+ADDRGP4 $5387
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+40132
+ARGP4
+ADDRGP4 cgs+40120
+INDIRI4
+ARGI4
+ADDRGP4 cgs+40124
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $5391
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $5392
+JUMPV
+LABELV $5391
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $5393
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $5393
+LABELV $5392
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $5363
+endproc CG_DrawVote 60 36
+proc CG_TeamVoteAnnouncements 8 8
+ADDRGP4 cg_drawTeamVote+12
+INDIRI4
+CNSTI4 0
+NEI4 $5396
+ADDRGP4 $5395
+JUMPV
+LABELV $5396
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5399
+ADDRLP4 4
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $5400
+JUMPV
+LABELV $5399
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5400
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $5403
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5404
+JUMPV
+LABELV $5403
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $5395
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $5408
+LABELV $5404
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+41156
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $5411
+ADDRGP4 $5395
+JUMPV
+LABELV $5411
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+41180
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5414
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+41180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_audioAnnouncerTeamVote+12
+INDIRI4
+CNSTI4 0
+EQI4 $5418
+ADDRGP4 cgs+632912+492992
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $5418
+LABELV $5414
+LABELV $5395
+endproc CG_TeamVoteAnnouncements 8 8
+proc CG_DrawTeamVote 76 36
+ADDRGP4 cg_drawTeamVote+12
+INDIRI4
+CNSTI4 0
+NEI4 $5424
+ADDRGP4 $5423
+JUMPV
+LABELV $5424
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5427
+ADDRLP4 28
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $5428
+JUMPV
+LABELV $5427
+ADDRLP4 28
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5428
+CNSTI4 4524
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $5431
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5432
+JUMPV
+LABELV $5431
+CNSTI4 4524
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $5423
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $5436
+LABELV $5432
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+41156
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $5439
+ADDRGP4 $5423
+JUMPV
+LABELV $5439
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+41156
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $5444
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $5444
+ADDRLP4 40
+ARGP4
+ADDRGP4 cg_drawTeamVoteColor
+ARGP4
+ADDRGP4 cg_drawTeamVoteAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 24
+ADDRGP4 cg_drawTeamVoteAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg_drawTeamVoteScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg_drawTeamVoteStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawTeamVoteWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamVoteFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5450
+ADDRLP4 16
+ADDRGP4 cgs+632912+948784
+ASGNP4
+ADDRGP4 $5451
+JUMPV
+LABELV $5450
+ADDRLP4 16
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $5451
+ADDRLP4 20
+ADDRGP4 cg_drawTeamVoteX+8
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg_drawTeamVoteY+8
+INDIRF4
+ASGNF4
+ADDRGP4 $5459
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+41188
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cgs+41164
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cgs+41172
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+NEI4 $5463
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $5464
+JUMPV
+LABELV $5463
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+NEI4 $5465
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $5465
+LABELV $5464
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $5423
+endproc CG_DrawTeamVote 76 36
+data
+align 4
+LABELV $5468
+byte 4 1
+code
+proc CG_DrawScoreboard 28 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $5469
+ADDRGP4 cg+617020
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $5469
+CNSTI4 0
+RETI4
+ADDRGP4 $5467
+JUMPV
+LABELV $5469
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $5473
+ADDRGP4 cg_scoreBoardAtIntermission+12
+INDIRI4
+CNSTI4 0
+NEI4 $5473
+CNSTI4 0
+RETI4
+ADDRGP4 $5467
+JUMPV
+LABELV $5473
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627388
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $5477
+ADDRGP4 cg_scoreBoardWarmup+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $5477
+ADDRGP4 cg+617020
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $5477
+CNSTI4 0
+RETI4
+ADDRGP4 $5467
+JUMPV
+LABELV $5477
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $5482
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $5482
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $5490
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $5486
+LABELV $5490
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRGP4 cg+4
+INDIRI4
+NEI4 $5491
+CNSTI4 4524
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $5491
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5487
+JUMPV
+LABELV $5491
+CNSTI4 4524
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $5487
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $5487
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5487
+JUMPV
+LABELV $5486
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $5504
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $5504
+LABELV $5487
+LABELV $5482
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+617020
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $5517
+ADDRGP4 cg_scoreBoardWhenDead+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $5518
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $5517
+LABELV $5518
+ADDRGP4 cg_scoreBoardAtIntermission+12
+INDIRI4
+CNSTI4 0
+EQI4 $5509
+ADDRGP4 cg+607196+4
+INDIRI4
+CNSTI4 5
+NEI4 $5509
+LABELV $5517
+ADDRGP4 $5510
+JUMPV
+LABELV $5509
+ADDRGP4 cg+617028
+INDIRI4
+ARGI4
+CNSTI4 200
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $5519
+ADDRGP4 cg+20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+617036
+CNSTI1 0
+ASGNI1
+ADDRGP4 $5468
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $5467
+JUMPV
+LABELV $5519
+LABELV $5510
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_qlhud+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $5524
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $5524
+ADDRGP4 cg+617032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5528
+ADDRLP4 20
+ADDRGP4 cg+617032
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -1048577
+BANDI4
+ASGNI4
+LABELV $5528
+ADDRGP4 cg_paused+12
+INDIRI4
+CNSTI4 0
+EQI4 $5532
+ADDRGP4 cg+20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5468
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $5467
+JUMPV
+LABELV $5532
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 16
+NEI4 $5536
+ADDRGP4 cg+607196+4
+INDIRI4
+CNSTI4 5
+NEI4 $5536
+ADDRGP4 cg+20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5468
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $5467
+JUMPV
+LABELV $5536
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $5542
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $5545
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $5545
+ADDRGP4 $5550
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5543
+JUMPV
+LABELV $5545
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $5551
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5551
+ADDRGP4 $5556
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5543
+JUMPV
+LABELV $5551
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+NEI4 $5557
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5557
+ADDRGP4 $5562
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5543
+JUMPV
+LABELV $5557
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $5563
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5563
+ADDRGP4 $5568
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5543
+JUMPV
+LABELV $5563
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $5574
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $5569
+LABELV $5574
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5569
+ADDRGP4 $5576
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5543
+JUMPV
+LABELV $5569
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $5577
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5577
+ADDRGP4 $5582
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5543
+JUMPV
+LABELV $5577
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $5583
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5583
+ADDRGP4 $5588
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5543
+JUMPV
+LABELV $5583
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $5589
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5589
+ADDRGP4 $5594
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5543
+JUMPV
+LABELV $5589
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+NEI4 $5595
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5595
+ADDRGP4 $5600
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5543
+JUMPV
+LABELV $5595
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $5601
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5601
+ADDRGP4 $5606
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5543
+JUMPV
+LABELV $5601
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $5607
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5607
+ADDRGP4 $5550
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5543
+JUMPV
+LABELV $5607
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $5612
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5612
+ADDRGP4 $5617
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5543
+JUMPV
+LABELV $5612
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $5618
+ADDRGP4 $5622
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 cg+617032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $5543
+ADDRGP4 $5626
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5543
+JUMPV
+LABELV $5618
+ADDRGP4 $5628
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 cg+617032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $5543
+ADDRGP4 $5632
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5543
+JUMPV
+LABELV $5542
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $5633
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $5633
+ADDRGP4 $5638
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5634
+JUMPV
+LABELV $5633
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $5639
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5639
+ADDRGP4 $5644
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5640
+JUMPV
+LABELV $5639
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+NEI4 $5645
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5645
+ADDRGP4 $5650
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5646
+JUMPV
+LABELV $5645
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $5651
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5651
+ADDRGP4 $5656
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5652
+JUMPV
+LABELV $5651
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $5662
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $5657
+LABELV $5662
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5657
+ADDRGP4 $5664
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5658
+JUMPV
+LABELV $5657
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $5665
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5665
+ADDRGP4 $5670
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5666
+JUMPV
+LABELV $5665
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $5671
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5671
+ADDRGP4 $5676
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5672
+JUMPV
+LABELV $5671
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $5677
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5677
+ADDRGP4 $5682
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5678
+JUMPV
+LABELV $5677
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+NEI4 $5683
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5683
+ADDRGP4 $5688
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5684
+JUMPV
+LABELV $5683
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $5689
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5689
+ADDRGP4 $5694
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5690
+JUMPV
+LABELV $5689
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $5695
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5695
+ADDRGP4 $5638
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5696
+JUMPV
+LABELV $5695
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $5700
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5700
+ADDRGP4 $5705
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $5701
+JUMPV
+LABELV $5700
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $5706
+ADDRGP4 $5710
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 cg+617032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $5707
+ADDRGP4 $5626
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5707
+JUMPV
+LABELV $5706
+ADDRGP4 $5715
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 cg+617032
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 cg+617032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $5716
+ADDRGP4 $5632
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5716
+LABELV $5707
+LABELV $5701
+LABELV $5696
+LABELV $5690
+LABELV $5684
+LABELV $5678
+LABELV $5672
+LABELV $5666
+LABELV $5658
+LABELV $5652
+LABELV $5646
+LABELV $5640
+LABELV $5634
+LABELV $5543
+ADDRGP4 cg+617032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5719
+ADDRGP4 $5468
+INDIRI4
+CNSTI4 0
+EQI4 $5722
+ADDRGP4 cg+617032
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetScoreSelection
+CALLV
+pop
+ADDRGP4 $5468
+CNSTI4 0
+ASGNI4
+LABELV $5722
+ADDRGP4 Menu_HandleCapture
+CALLV
+pop
+ADDRGP4 cg+617032
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+LABELV $5719
+ADDRLP4 20
+ADDRGP4 cg+20
+ASGNP4
+ADDRLP4 24
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 10
+LEI4 $5726
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+LABELV $5726
+CNSTI4 1
+RETI4
+ADDRGP4 $5467
+JUMPV
+LABELV $5524
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_scoreBoardOldWideScreen+12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 CG_DrawOldScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $5467
+endproc CG_DrawScoreboard 28 8
+proc CG_DrawScoreboardMenuCursor 28 20
+ADDRLP4 0
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cgs+632808
+INDIRI4
+CNSTI4 16
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cgs+632812
+INDIRI4
+CNSTI4 16
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 QLWideScreen
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+CNSTI4 5
+NEI4 $5733
+ADDRLP4 16
+ADDRGP4 cgs+20100+19496
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+20100+19500
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1067450368
+LEF4 $5740
+ADDRLP4 20
+CNSTF4 1082130432
+ADDRGP4 cgs+20100+19500
+INDIRI4
+CVIF4 4
+CNSTF4 1077936128
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 20
+INDIRF4
+ADDRGP4 cgs+20100+19496
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+LABELV $5740
+LABELV $5733
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+493544
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $5730
+endproc CG_DrawScoreboardMenuCursor 28 20
+proc CG_DrawIntermission 4 0
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 16
+NEI4 $5749
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+ADDRGP4 $5748
+JUMPV
+LABELV $5749
+ADDRGP4 cg+617028
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+617024
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 CG_DrawAccStats
+CALLV
+pop
+ADDRGP4 CG_DrawEchoPopup
+CALLV
+pop
+ADDRGP4 CG_DrawErrorPopup
+CALLV
+pop
+ADDRGP4 cg+617024
+INDIRI4
+CNSTI4 0
+EQI4 $5755
+ADDRGP4 CG_DrawScoreboardMenuCursor
+CALLV
+pop
+LABELV $5755
+LABELV $5748
+endproc CG_DrawIntermission 4 0
+proc CG_DrawFollow 56 36
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5759
+CNSTI4 0
+RETI4
+ADDRGP4 $5758
+JUMPV
+LABELV $5759
+ADDRGP4 cg_drawFollowing+12
+INDIRI4
+CNSTI4 0
+NEI4 $5761
+CNSTI4 1
+RETI4
+ADDRGP4 $5758
+JUMPV
+LABELV $5761
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $5764
+ADDRGP4 cg_drawFollowing+12
+INDIRI4
+CNSTI4 2
+EQI4 $5764
+CNSTI4 0
+RETI4
+ADDRGP4 $5758
+JUMPV
+LABELV $5764
+ADDRLP4 24
+ARGP4
+ADDRGP4 cg_drawFollowingColor
+ARGP4
+ADDRGP4 cg_drawFollowingAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 cg_drawFollowingAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_drawFollowingScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg_drawFollowingStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawFollowingWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawFollowingFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5772
+ADDRLP4 4
+ADDRGP4 cgs+632912+970460
+ASGNP4
+ADDRGP4 $5773
+JUMPV
+LABELV $5772
+ADDRLP4 4
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $5773
+ADDRLP4 12
+ADDRGP4 cg_drawFollowingX+8
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 cg_drawFollowingY+8
+INDIRF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5784
+ADDRGP4 $5212
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRGP4 $5785
+JUMPV
+LABELV $5784
+ADDRLP4 8
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ASGNP4
+LABELV $5785
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $5792
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $5793
+JUMPV
+LABELV $5792
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $5794
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $5794
+LABELV $5793
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $5758
+endproc CG_DrawFollow 56 36
+proc CG_DrawAmmoWarning 64 36
+ADDRGP4 cg_drawAmmoWarning+12
+INDIRI4
+CNSTI4 0
+NEI4 $5797
+ADDRGP4 $5796
+JUMPV
+LABELV $5797
+ADDRGP4 cg+627140
+INDIRI4
+CNSTI4 0
+NEI4 $5800
+ADDRGP4 $5796
+JUMPV
+LABELV $5800
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $5803
+ADDRGP4 $5796
+JUMPV
+LABELV $5803
+ADDRLP4 20
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5808
+ADDRLP4 20
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $5813
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $5814
+ADDRGP4 $5796
+JUMPV
+LABELV $5813
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $5820
+ADDRGP4 $5796
+JUMPV
+LABELV $5820
+LABELV $5814
+LABELV $5808
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $5824
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRGP4 cg+4
+INDIRI4
+NEI4 $5824
+ADDRGP4 $5796
+JUMPV
+LABELV $5824
+ADDRLP4 52
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $5829
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $5830
+ADDRGP4 $5830
+JUMPV
+LABELV $5829
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $5834
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_FreezeTagFrozen
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $5834
+ADDRGP4 $5796
+JUMPV
+LABELV $5834
+LABELV $5830
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $5837
+ADDRGP4 $5796
+JUMPV
+LABELV $5837
+ADDRGP4 cg_drawAmmoWarningFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5839
+ADDRLP4 8
+ADDRGP4 cgs+632912+775364
+ASGNP4
+ADDRGP4 $5840
+JUMPV
+LABELV $5839
+ADDRLP4 8
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $5840
+ADDRLP4 56
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg_drawAmmoWarning+12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $5846
+ADDRGP4 cg+627140
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $5846
+ADDRGP4 $5796
+JUMPV
+LABELV $5846
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawAmmoWarningWideScreen+12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg_drawAmmoWarningScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 cg_drawAmmoWarningColor
+ARGP4
+ADDRGP4 cg_drawAmmoWarningAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 cg_drawAmmoWarningAlign+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627140
+INDIRI4
+CNSTI4 2
+NEI4 $5853
+ADDRLP4 0
+ADDRGP4 $5856
+ASGNP4
+ADDRGP4 $5854
+JUMPV
+LABELV $5853
+ADDRLP4 0
+ADDRGP4 $5857
+ASGNP4
+LABELV $5854
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg_drawAmmoWarningX+8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $5859
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $5860
+JUMPV
+LABELV $5859
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $5861
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $5861
+LABELV $5860
+ADDRLP4 24
+ADDRGP4 cg_drawAmmoWarningY+8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawAmmoWarningStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $5796
+endproc CG_DrawAmmoWarning 64 36
+proc CG_DrawProxWarning 52 36
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $5866
+ADDRGP4 $5865
+JUMPV
+LABELV $5866
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5869
+ADDRGP4 $5865
+JUMPV
+LABELV $5869
+ADDRGP4 cg_drawProxWarning+12
+INDIRI4
+CNSTI4 0
+NEI4 $5871
+ADDRGP4 $5865
+JUMPV
+LABELV $5871
+ADDRLP4 20
+ARGP4
+ADDRGP4 cg_drawProxWarningColor
+ARGP4
+ADDRGP4 cg_drawProxWarningAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 cg_drawProxWarningAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_drawProxWarningScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg_drawProxWarningStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawProxWarningWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawProxWarningFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5878
+ADDRLP4 4
+ADDRGP4 cgs+632912+1252248
+ASGNP4
+ADDRGP4 $5879
+JUMPV
+LABELV $5878
+ADDRLP4 4
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $5879
+ADDRLP4 12
+ADDRGP4 cg_drawProxWarningX+8
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg_drawProxWarningY+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+6702232
+INDIRI4
+CNSTI4 0
+EQI4 $5887
+ADDRGP4 $5890
+ARGP4
+ADDRGP4 cg+6702232
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $5888
+JUMPV
+LABELV $5887
+ADDRLP4 8
+ADDRGP4 $5892
+ASGNP4
+LABELV $5888
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $5893
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $5894
+JUMPV
+LABELV $5893
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $5895
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $5895
+LABELV $5894
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $5865
+endproc CG_DrawProxWarning 52 36
+proc CG_WarmupAnnouncements 16 8
+ADDRLP4 0
+ADDRGP4 cg+627388
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $5899
+ADDRGP4 $5897
+JUMPV
+LABELV $5899
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $5901
+ADDRGP4 $5897
+JUMPV
+LABELV $5901
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $5904
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+GEI4 $5904
+ADDRGP4 cg+627388
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5897
+JUMPV
+LABELV $5904
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $5908
+ADDRGP4 cg+627388
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $5908
+ADDRGP4 cg+627392
+INDIRI4
+CNSTI4 -1
+NEI4 $5911
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $5914
+ADDRLP4 4
+ADDRGP4 cg+627388
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 1000
+ADDRLP4 0
+INDIRI4
+MULI4
+MODI4
+ASGNI4
+ADDRGP4 $5915
+JUMPV
+LABELV $5914
+ADDRLP4 4
+ADDRGP4 cg+627388
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $5915
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LEI4 $5920
+ADDRGP4 cg+627392
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $5897
+JUMPV
+LABELV $5920
+LABELV $5911
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+627392
+INDIRI4
+EQI4 $5923
+ADDRGP4 cg+627392
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg_audioAnnouncerWarmup+12
+INDIRI4
+CNSTI4 0
+EQI4 $5927
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $5944
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $5947
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $5950
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $5931
+LABELV $5953
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+EQI4 $5932
+ADDRGP4 $5931
+JUMPV
+LABELV $5932
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $5939
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+LEI4 $5938
+LABELV $5939
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $5933
+LABELV $5938
+ADDRGP4 cgs+632912+493516
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $5931
+JUMPV
+LABELV $5933
+ADDRGP4 cgs+632912+493468
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $5931
+JUMPV
+LABELV $5944
+ADDRGP4 cgs+632912+493452
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $5931
+JUMPV
+LABELV $5947
+ADDRGP4 cgs+632912+493448
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $5931
+JUMPV
+LABELV $5950
+ADDRGP4 cgs+632912+493444
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $5931
+LABELV $5927
+LABELV $5923
+LABELV $5897
+endproc CG_WarmupAnnouncements 16 8
+proc CG_DrawWarmup 96 36
+ADDRLP4 12
+ADDRGP4 cg+627388
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $5956
+ADDRGP4 $5954
+JUMPV
+LABELV $5956
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $5958
+ADDRGP4 cg_drawWaitingForPlayers+12
+INDIRI4
+CNSTI4 0
+NEI4 $5960
+ADDRGP4 $5954
+JUMPV
+LABELV $5960
+ADDRLP4 36
+ARGP4
+ADDRGP4 cg_drawWaitingForPlayersColor
+ARGP4
+ADDRGP4 cg_drawWaitingForPlayersAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 cg_drawWaitingForPlayersAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 cg_drawWaitingForPlayersScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 cg_drawWaitingForPlayersStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawWaitingForPlayersWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawWaitingForPlayersFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5967
+ADDRLP4 8
+ADDRGP4 cgs+632912+905432
+ASGNP4
+ADDRGP4 $5968
+JUMPV
+LABELV $5967
+ADDRLP4 8
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $5968
+ADDRLP4 16
+ADDRGP4 cg_drawWaitingForPlayersX+8
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg_drawWaitingForPlayersY+8
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5976
+CNSTI4 710
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5976
+CNSTI4 710
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LEI4 $5979
+ADDRLP4 80
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $5982
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $5983
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $5984
+JUMPV
+LABELV $5983
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $5985
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $5985
+LABELV $5984
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+CNSTF4 1071644672
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $5987
+ARGP4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRGP4 $5977
+JUMPV
+LABELV $5979
+ADDRLP4 4
+ADDRGP4 $5989
+ASGNP4
+ADDRGP4 $5977
+JUMPV
+LABELV $5976
+ADDRLP4 4
+ADDRGP4 $5989
+ASGNP4
+LABELV $5977
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $5990
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $5991
+JUMPV
+LABELV $5990
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $5992
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $5992
+LABELV $5991
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+ADDRGP4 cg+627392
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5954
+JUMPV
+LABELV $5958
+ADDRGP4 cg_drawWarmupString+12
+INDIRI4
+CNSTI4 0
+NEI4 $5995
+ADDRGP4 $5954
+JUMPV
+LABELV $5995
+ADDRGP4 cg_drawWarmupStringFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5998
+ADDRLP4 8
+ADDRGP4 cgs+632912+905432
+ASGNP4
+ADDRGP4 $5999
+JUMPV
+LABELV $5998
+ADDRLP4 8
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $5999
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawWarmupStringWideScreen+12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 cg_drawWarmupStringAlign+12
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ARGP4
+ADDRGP4 cg_drawWarmupStringColor
+ARGP4
+ADDRGP4 cg_drawWarmupStringAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $6007
+ADDRLP4 68
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $6013
+JUMPV
+LABELV $6010
+ADDRLP4 72
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+EQI4 $6015
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+NEI4 $6015
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $6020
+ADDRLP4 24
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRGP4 $6021
+JUMPV
+LABELV $6020
+ADDRLP4 56
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+LABELV $6021
+LABELV $6015
+LABELV $6011
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $6013
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+39728
+INDIRI4
+LTI4 $6010
+ADDRLP4 72
+CNSTU4 0
+ASGNU4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRU4
+EQU4 $6008
+ADDRLP4 56
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRU4
+EQU4 $6008
+ADDRGP4 $6026
+ARGP4
+ADDRLP4 76
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 cg_drawWarmupStringScale+8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg_drawWarmupStringX+8
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg_drawWarmupStringY+8
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $6030
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $6031
+JUMPV
+LABELV $6030
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $6032
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $6032
+LABELV $6031
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRGP4 cg_drawWarmupStringScale+8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawWarmupStringStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $6008
+JUMPV
+LABELV $6007
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+NEI4 $6036
+ADDRLP4 4
+ADDRGP4 $6039
+ASGNP4
+ADDRGP4 $6037
+JUMPV
+LABELV $6036
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+NEI4 $6040
+ADDRLP4 4
+ADDRGP4 $6043
+ASGNP4
+ADDRGP4 $6041
+JUMPV
+LABELV $6040
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+NEI4 $6044
+ADDRLP4 4
+ADDRGP4 $6047
+ASGNP4
+ADDRGP4 $6045
+JUMPV
+LABELV $6044
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $6048
+ADDRLP4 4
+ADDRGP4 $6051
+ASGNP4
+ADDRGP4 $6049
+JUMPV
+LABELV $6048
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $6052
+ADDRLP4 4
+ADDRGP4 $6055
+ASGNP4
+ADDRGP4 $6053
+JUMPV
+LABELV $6052
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 7
+NEI4 $6056
+ADDRLP4 4
+ADDRGP4 $6059
+ASGNP4
+ADDRGP4 $6057
+JUMPV
+LABELV $6056
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $6060
+ADDRLP4 4
+ADDRGP4 $6063
+ASGNP4
+ADDRGP4 $6061
+JUMPV
+LABELV $6060
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $6064
+ADDRLP4 4
+ADDRGP4 $6067
+ASGNP4
+ADDRGP4 $6065
+JUMPV
+LABELV $6064
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $6068
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $6071
+ADDRLP4 4
+ADDRGP4 $6074
+ASGNP4
+ADDRGP4 $6069
+JUMPV
+LABELV $6071
+ADDRLP4 4
+ADDRGP4 $6075
+ASGNP4
+ADDRGP4 $6069
+JUMPV
+LABELV $6068
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+NEI4 $6076
+ADDRLP4 4
+ADDRGP4 $6079
+ASGNP4
+ADDRGP4 $6077
+JUMPV
+LABELV $6076
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $6080
+ADDRLP4 4
+ADDRGP4 $6083
+ASGNP4
+ADDRGP4 $6081
+JUMPV
+LABELV $6080
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 13
+NEI4 $6084
+ADDRLP4 4
+ADDRGP4 $6087
+ASGNP4
+ADDRGP4 $6085
+JUMPV
+LABELV $6084
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 14
+NEI4 $6088
+ADDRLP4 4
+ADDRGP4 $6091
+ASGNP4
+ADDRGP4 $6089
+JUMPV
+LABELV $6088
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 15
+NEI4 $6092
+ADDRLP4 4
+ADDRGP4 $6095
+ASGNP4
+ADDRGP4 $6093
+JUMPV
+LABELV $6092
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $6096
+ADDRLP4 4
+ADDRGP4 $6099
+ASGNP4
+ADDRGP4 $6097
+JUMPV
+LABELV $6096
+ADDRGP4 $6100
+ARGP4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+LABELV $6097
+LABELV $6093
+LABELV $6089
+LABELV $6085
+LABELV $6081
+LABELV $6077
+LABELV $6069
+LABELV $6065
+LABELV $6061
+LABELV $6057
+LABELV $6053
+LABELV $6049
+LABELV $6045
+LABELV $6041
+LABELV $6037
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 cg_drawWarmupStringScale+8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg_drawWarmupStringX+8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 cg_drawWarmupStringScale+8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg_drawWarmupStringY+8
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $6106
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $6107
+JUMPV
+LABELV $6106
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $6108
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $6108
+LABELV $6107
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRGP4 cg_drawWarmupStringScale+8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawWarmupStringStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $6008
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $6113
+ADDRGP4 cg+627388
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $6113
+ADDRGP4 $6116
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 cg+627392
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $6120
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+EQI4 $6121
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+EQI4 $6122
+ADDRGP4 $6117
+JUMPV
+LABELV $6120
+ADDRLP4 52
+CNSTF4 1057635697
+ASGNF4
+ADDRGP4 $6118
+JUMPV
+LABELV $6121
+ADDRLP4 52
+CNSTF4 1057132380
+ASGNF4
+ADDRGP4 $6118
+JUMPV
+LABELV $6122
+ADDRLP4 52
+CNSTF4 1056293519
+ASGNF4
+ADDRGP4 $6118
+JUMPV
+LABELV $6117
+ADDRLP4 52
+CNSTF4 1055286886
+ASGNF4
+LABELV $6118
+ADDRLP4 52
+CNSTF4 1055286886
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 cg_drawWarmupStringScale+8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg_drawWarmupStringX+8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 cg_drawWarmupStringScale+8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg_drawWarmupStringY+8
+INDIRF4
+CNSTF4 1077936128
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $6127
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $6128
+JUMPV
+LABELV $6127
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $6129
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $6129
+LABELV $6128
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRGP4 cg_drawWarmupStringScale+8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawWarmupStringStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $5954
+endproc CG_DrawWarmup 96 36
+proc CG_DrawAccStats 92 36
+ADDRGP4 cg+1332832
+INDIRI4
+CNSTI4 0
+NEI4 $6134
+ADDRGP4 $6133
+JUMPV
+LABELV $6134
+ADDRLP4 24
+CNSTI4 15
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $6137
+ADDRLP4 28
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $6138
+JUMPV
+LABELV $6137
+ADDRLP4 28
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $6138
+ADDRLP4 48
+CNSTI4 2392
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+CNSTI4 736
+ADDP4
+ASGNP4
+ADDRLP4 32
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 32+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+12
+CNSTF4 1050253722
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg_accX+8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg_accY+8
+INDIRF4
+ASGNF4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_accWideScreen+12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 80
+ASGNI4
+ADDRLP4 52
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRLP4 56
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 cg+1332836
+INDIRI4
+CNSTI4 0
+NEI4 $6149
+ADDRLP4 8
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $6152
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+12
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $6150
+JUMPV
+LABELV $6149
+ADDRLP4 60
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+1332836
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 60
+ASGNI4
+ADDRLP4 64
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 80
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $6157
+ARGP4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+12
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $6150
+LABELV $6147
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $6163
+JUMPV
+LABELV $6160
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $6164
+ADDRGP4 $6161
+JUMPV
+LABELV $6164
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1091567616
+SUBF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 cg+1332836
+INDIRI4
+CNSTI4 0
+EQI4 $6169
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+1332840
+INDIRI4
+NEI4 $6169
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+1332844
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2242
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1113325568
+SUBF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+12
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $6169
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+INDIRU4
+CNSTU4 0
+EQU4 $6176
+ADDRLP4 64
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 68
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+CNSTU4 1
+ASGNU4
+ADDRLP4 84
+ADDRLP4 68
+INDIRP4
+INDIRU4
+ASGNU4
+ADDRLP4 12
+CNSTF4 1120403456
+ADDRLP4 64
+INDIRF4
+ADDRLP4 72
+INDIRU4
+ADDRLP4 76
+INDIRI4
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 72
+INDIRU4
+ADDRLP4 80
+INDIRU4
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 84
+INDIRU4
+ADDRLP4 76
+INDIRI4
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 84
+INDIRU4
+ADDRLP4 80
+INDIRU4
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $6177
+JUMPV
+LABELV $6176
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $6177
+ADDRGP4 $6178
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1106247680
+SUBF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+12
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $6166
+LABELV $6161
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $6163
+ADDRLP4 0
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $6160
+LABELV $6133
+endproc CG_DrawAccStats 92 36
+proc CG_DrawErrorPopup 52 36
+ADDRGP4 cg+607168
+INDIRI4
+ADDRGP4 cg+1333956
+INDIRI4
+SUBI4
+ADDRGP4 cg+1333960
+INDIRI4
+LEI4 $6182
+ADDRGP4 $6181
+JUMPV
+LABELV $6182
+ADDRGP4 QLWideScreen
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+CNSTF4 1050253722
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTF4 1084227584
+ASGNF4
+ADDRGP4 cg+1333964
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgDC+236+12
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 24
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 0
+ARGF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRGP4 colorRed
+ARGP4
+ADDRGP4 cg+1333964
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+12
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $6181
+endproc CG_DrawErrorPopup 52 36
+proc CG_DrawEchoPopup 64 36
+ADDRGP4 cg+607168
+INDIRI4
+ADDRGP4 cg+1332908
+INDIRI4
+SUBI4
+ADDRGP4 cg+1332912
+INDIRI4
+LEI4 $6197
+ADDRGP4 $6196
+JUMPV
+LABELV $6197
+ADDRLP4 24
+ADDRGP4 cg+1333952
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg+1333940
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg+1333944
+INDIRF4
+ASGNF4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg+1333948
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332916
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgDC+236+12
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332916
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgDC+236+12
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 48
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 48
+INDIRF4
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 56
+INDIRF4
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 56
+INDIRF4
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 cg+1332916
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+12
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $6196
+endproc CG_DrawEchoPopup 64 36
+proc CG_DrawDominationPointStatus 160 36
+ADDRGP4 cg_drawDominationPointStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $6219
+ADDRGP4 $6218
+JUMPV
+LABELV $6219
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $6222
+ADDRLP4 52
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $6223
+JUMPV
+LABELV $6222
+ADDRLP4 52
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $6223
+ADDRLP4 44
+ADDRGP4 cg_drawDominationPointStatusX+8
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cg_drawDominationPointStatusY+8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg_drawDominationPointStatusScale+8
+INDIRF4
+ASGNF4
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_drawDominationPointStatusWideScreen+12
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTF4 1048576000
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg_drawDominationPointStatusFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $6232
+ADDRLP4 60
+ADDRGP4 cgs+632912+1273924
+ASGNP4
+ADDRGP4 $6233
+JUMPV
+LABELV $6232
+ADDRLP4 60
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $6233
+ADDRLP4 88
+ADDRGP4 cg_drawDominationPointStatusTextStyle+12
+INDIRI4
+ASGNI4
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_drawDominationPointStatusEnemyColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $6240
+ADDRLP4 128
+ARGP4
+ADDRGP4 cg_drawDominationPointStatusEnemyColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 128+12
+ADDRGP4 cg_drawDominationPointStatusAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+NEI4 $6245
+ADDRLP4 112
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 128+4
+INDIRF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 128+8
+INDIRF4
+ASGNF4
+ADDRLP4 112+12
+ADDRLP4 128+12
+INDIRF4
+ASGNF4
+ADDRGP4 $6241
+JUMPV
+LABELV $6245
+ADDRLP4 96
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 128+4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 128+8
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRLP4 128+12
+INDIRF4
+ASGNF4
+ADDRGP4 $6241
+JUMPV
+LABELV $6240
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+NEI4 $6259
+ADDRLP4 112
+CNSTF4 0
+ASGNF4
+ADDRLP4 112+4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 112+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 112+12
+ADDRGP4 cg_drawDominationPointStatusAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRGP4 $6260
+JUMPV
+LABELV $6259
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+12
+ADDRGP4 cg_drawDominationPointStatusAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+LABELV $6260
+LABELV $6241
+ADDRGP4 cg_drawDominationPointStatusTeamColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $6269
+ADDRLP4 128
+ARGP4
+ADDRGP4 cg_drawDominationPointStatusTeamColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 128+12
+ADDRGP4 cg_drawDominationPointStatusAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+NEI4 $6274
+ADDRLP4 96
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 128+4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 128+8
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRLP4 128+12
+INDIRF4
+ASGNF4
+ADDRGP4 $6270
+JUMPV
+LABELV $6274
+ADDRLP4 112
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 128+4
+INDIRF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 128+8
+INDIRF4
+ASGNF4
+ADDRLP4 112+12
+ADDRLP4 128+12
+INDIRF4
+ASGNF4
+ADDRGP4 $6270
+JUMPV
+LABELV $6269
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+NEI4 $6288
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+12
+ADDRGP4 cg_drawDominationPointStatusAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRGP4 $6289
+JUMPV
+LABELV $6288
+ADDRLP4 112
+CNSTF4 0
+ASGNF4
+ADDRLP4 112+4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 112+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 112+12
+ADDRGP4 cg_drawDominationPointStatusAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+LABELV $6289
+LABELV $6270
+ADDRGP4 cg_drawDominationPointStatusTextColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $6298
+ADDRLP4 72
+ARGP4
+ADDRGP4 cg_drawDominationPointStatusTextColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 72+12
+ADDRGP4 cg_drawDominationPointStatusTextAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRGP4 $6299
+JUMPV
+LABELV $6298
+ADDRLP4 144
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 72+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72+12
+ADDRGP4 cg_drawDominationPointStatusTextAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+LABELV $6299
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $6307
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1957824
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $6312
+ADDRGP4 $6309
+JUMPV
+LABELV $6312
+ADDRLP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 1124073472
+LEF4 $6314
+ADDRGP4 $6308
+JUMPV
+LABELV $6314
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 65
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 28
+ARGP4
+ADDRGP4 cg_drawDominationPointStatusBackgroundColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 28+12
+ADDRGP4 cg_drawDominationPointStatusAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1123549184
+ADDRLP4 4
+INDIRF4
+MULF4
+ARGF4
+CNSTF4 1092616192
+ADDRLP4 4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 52
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+NEI4 $6319
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+NEI4 $6321
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1123549184
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+MULF4
+ARGF4
+CNSTF4 1092616192
+ADDRLP4 4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $6322
+JUMPV
+LABELV $6321
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+NEI4 $6323
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1123549184
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+MULF4
+ARGF4
+CNSTF4 1092616192
+ADDRLP4 4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $6323
+LABELV $6322
+ADDRLP4 12
+ADDRLP4 44
+INDIRF4
+CNSTF4 1115160576
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $6326
+ARGP4
+ADDRLP4 56
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 152
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $6327
+ARGP4
+ADDRLP4 68
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 72
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $6309
+JUMPV
+LABELV $6319
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $6328
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1123549184
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+MULF4
+ARGF4
+CNSTF4 1092616192
+ADDRLP4 4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $6329
+JUMPV
+LABELV $6328
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $6330
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1123549184
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+MULF4
+ARGF4
+CNSTF4 1092616192
+ADDRLP4 4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $6331
+JUMPV
+LABELV $6330
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+NEI4 $6332
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1123549184
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+MULF4
+ARGF4
+CNSTF4 1092616192
+ADDRLP4 4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $6333
+JUMPV
+LABELV $6332
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+NEI4 $6334
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1123549184
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+MULF4
+ARGF4
+CNSTF4 1092616192
+ADDRLP4 4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $6334
+LABELV $6333
+LABELV $6331
+LABELV $6329
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $6336
+ADDRGP4 $6338
+ARGP4
+ADDRLP4 68
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRGP4 $6337
+JUMPV
+LABELV $6336
+ADDRGP4 $6339
+ARGP4
+ADDRLP4 68
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 152
+INDIRP4
+ASGNP4
+LABELV $6337
+ADDRLP4 12
+ADDRLP4 44
+INDIRF4
+CNSTF4 1115160576
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $6326
+ARGP4
+ADDRLP4 56
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 152
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 72
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $6309
+JUMPV
+LABELV $6308
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LTI4 $6307
+LABELV $6309
+LABELV $6218
+endproc CG_DrawDominationPointStatus 160 36
+proc CG_DrawCtfsRoundScoreboard 100 36
+ADDRGP4 cg_roundScoreBoard+12
+INDIRI4
+CNSTI4 0
+NEI4 $6342
+ADDRGP4 $6341
+JUMPV
+LABELV $6342
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $6345
+ADDRGP4 $6341
+JUMPV
+LABELV $6345
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43280
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $6352
+ADDRGP4 cgs+43268
+INDIRI4
+ADDRLP4 56
+INDIRI4
+GTI4 $6348
+LABELV $6352
+ADDRGP4 $6341
+JUMPV
+LABELV $6348
+ADDRLP4 44
+ADDRGP4 cgDC+236+12
+ASGNP4
+ADDRLP4 40
+CNSTF4 1043878380
+ASGNF4
+ADDRLP4 36
+CNSTI4 3
+ASGNI4
+ADDRGP4 QLWideScreen
+CNSTI4 2
+ASGNI4
+ADDRLP4 52
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 48
+CNSTF4 1126957056
+ASGNF4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1057803469
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1131413504
+ARGF4
+CNSTF4 1108344832
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 cgs+43276
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $6358
+ADDRLP4 20
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 64
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 64
+INDIRF4
+ADDF4
+ARGF4
+CNSTF4 1129054208
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $6359
+JUMPV
+LABELV $6358
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ARGF4
+CNSTF4 1129054208
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $6359
+ADDRLP4 4
+ADDRLP4 52
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 64
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 $6371
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $6372
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 224
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRGP4 $2242
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $6373
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LTI4 $6372
+ADDRLP4 4
+CNSTF4 1137442816
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 $6378
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 52
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 $6383
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRLP4 80
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+CNSTF4 1131413504
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $6390
+JUMPV
+LABELV $6387
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6746844
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $6392
+ADDRGP4 $6389
+JUMPV
+LABELV $6392
+ADDRGP4 $2242
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6746844
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $6388
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $6390
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GEI4 $6396
+ADDRGP4 cg+6747364
+INDIRI4
+CNSTI4 0
+NEI4 $6387
+LABELV $6396
+LABELV $6389
+ADDRLP4 4
+CNSTF4 1137901568
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2242
+ARGP4
+ADDRGP4 cg+6747356
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 52
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1108344832
+ADDF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 $6405
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+CNSTF4 1131413504
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $6412
+JUMPV
+LABELV $6409
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6747100
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $6414
+ADDRGP4 $6411
+JUMPV
+LABELV $6414
+ADDRGP4 $2242
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6747100
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $6410
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $6412
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GEI4 $6418
+ADDRGP4 cg+6747364
+INDIRI4
+CNSTI4 0
+NEI4 $6409
+LABELV $6418
+LABELV $6411
+ADDRLP4 4
+CNSTF4 1137901568
+ASGNF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2242
+ARGP4
+ADDRGP4 cg+6747360
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 cgs+43276
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $6423
+ADDRLP4 4+4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 240
+ADDI4
+CNSTI4 8
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1059481190
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6424
+JUMPV
+LABELV $6423
+ADDRLP4 4+4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 240
+ADDI4
+CNSTI4 8
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 1050253722
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 1059481190
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $6424
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+CNSTF4 1098907648
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $6341
+endproc CG_DrawCtfsRoundScoreboard 100 36
+proc CG_Draw2D 1036 36
+ADDRGP4 cg+16
+INDIRI4
+CNSTI4 0
+EQI4 $6436
+ADDRGP4 $6435
+JUMPV
+LABELV $6436
+ADDRGP4 cg_fadeStyle+12
+INDIRI4
+CNSTI4 0
+NEI4 $6439
+ADDRGP4 CG_DrawFade
+CALLV
+pop
+LABELV $6439
+ADDRGP4 cg+3196928
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $6442
+ADDRGP4 Menu_HandleCapture
+CALLV
+pop
+ADDRGP4 cg+3196928
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+ADDRGP4 CG_DrawScoreboardMenuCursor
+CALLV
+pop
+ADDRGP4 $6435
+JUMPV
+LABELV $6442
+ADDRGP4 cg_draw2D+12
+INDIRI4
+CNSTI4 0
+NEI4 $6446
+ADDRGP4 CG_DrawEchoPopup
+CALLV
+pop
+ADDRGP4 CG_DrawErrorPopup
+CALLV
+pop
+ADDRGP4 CG_WarmupAnnouncements
+CALLV
+pop
+ADDRGP4 CG_RoundAnnouncements
+CALLV
+pop
+ADDRGP4 CG_RewardAnnouncements
+CALLV
+pop
+ADDRGP4 CG_VoteAnnouncements
+CALLV
+pop
+ADDRGP4 CG_TeamVoteAnnouncements
+CALLV
+pop
+ADDRGP4 cg_fadeStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $6435
+ADDRGP4 CG_DrawFade
+CALLV
+pop
+ADDRGP4 $6435
+JUMPV
+LABELV $6446
+ADDRGP4 cg_draw2D+12
+INDIRI4
+CNSTI4 2
+NEI4 $6452
+ADDRGP4 cg_drawCameraPointInfoFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $6455
+ADDRLP4 0
+ADDRGP4 cgs+632912+1165544
+ASGNP4
+ADDRGP4 $6456
+JUMPV
+LABELV $6455
+ADDRLP4 0
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $6456
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1098907648
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 colorRed
+ARGP4
+ADDRGP4 $6462
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 0
+LEI4 $6463
+ADDRGP4 cg+3196784
+INDIRI4
+CNSTI4 0
+EQI4 $6466
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1107296256
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $6469
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $6464
+JUMPV
+LABELV $6466
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+CNSTI4 0
+EQI4 $6470
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1107296256
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $6473
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $6464
+JUMPV
+LABELV $6470
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1107296256
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $6474
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $6464
+JUMPV
+LABELV $6463
+ADDRGP4 demo+4+64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $6475
+ADDRGP4 cg+3196788
+INDIRI4
+CNSTI4 0
+EQI4 $6479
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1107296256
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $6482
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $6480
+JUMPV
+LABELV $6479
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+CNSTI4 0
+EQI4 $6483
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1107296256
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $6486
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $6484
+JUMPV
+LABELV $6483
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1107296256
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $6487
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $6484
+LABELV $6480
+LABELV $6475
+LABELV $6464
+CNSTF4 1092616192
+ARGF4
+ADDRGP4 CG_DrawFPS
+CALLF4
+pop
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 Wolfcam_DrawSpeed
+CALLF4
+pop
+ADDRGP4 CG_ScanForCrosshairEntity
+CALLV
+pop
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+ADDRGP4 CG_DrawCameraPointInfo
+CALLV
+pop
+ADDRGP4 CG_DrawEchoPopup
+CALLV
+pop
+ADDRGP4 CG_DrawErrorPopup
+CALLV
+pop
+ADDRGP4 CG_WarmupAnnouncements
+CALLV
+pop
+ADDRGP4 CG_RoundAnnouncements
+CALLV
+pop
+ADDRGP4 CG_RewardAnnouncements
+CALLV
+pop
+ADDRGP4 CG_VoteAnnouncements
+CALLV
+pop
+ADDRGP4 CG_TeamVoteAnnouncements
+CALLV
+pop
+ADDRGP4 cg_fadeStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $6435
+ADDRGP4 CG_DrawFade
+CALLV
+pop
+ADDRGP4 $6435
+JUMPV
+LABELV $6452
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $6491
+ADDRGP4 CG_DrawIntermission
+CALLV
+pop
+ADDRGP4 cg_fadeStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $6435
+ADDRGP4 CG_DrawFade
+CALLV
+pop
+ADDRGP4 $6435
+JUMPV
+LABELV $6491
+ADDRGP4 cg+627504
+INDIRI4
+CNSTI4 0
+EQI4 $6497
+ADDRGP4 CG_DrawFlashFade
+CALLV
+pop
+ADDRGP4 $6435
+JUMPV
+LABELV $6497
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $6500
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $6502
+ADDRGP4 cg_qlhud+12
+INDIRI4
+CNSTI4 0
+EQI4 $6505
+ADDRGP4 cg+686628
+INDIRI4
+CNSTI4 0
+NEI4 $6506
+ADDRGP4 Menu_PaintAll
+CALLV
+pop
+ADDRGP4 $6506
+JUMPV
+LABELV $6505
+ADDRGP4 CG_DrawStatusBar
+CALLV
+pop
+LABELV $6506
+LABELV $6502
+ADDRGP4 CG_DrawWeaponBar
+CALLV
+pop
+ADDRGP4 Wolfcam_DrawCrosshair
+CALLV
+pop
+ADDRGP4 CG_ScanForCrosshairEntity
+CALLV
+pop
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 CG_DrawCrosshairTeammateHealth
+CALLV
+pop
+ADDRGP4 CG_DrawKeyPress
+CALLV
+pop
+ADDRGP4 CG_DrawAmmoWarning
+CALLV
+pop
+ADDRGP4 $6501
+JUMPV
+LABELV $6500
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $6518
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $6511
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $6511
+ADDRGP4 cg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $6511
+LABELV $6518
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $6519
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $6519
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $6525
+ADDRGP4 cg_qlhud+12
+INDIRI4
+CNSTI4 0
+EQI4 $6528
+ADDRGP4 cg+686628
+INDIRI4
+CNSTI4 0
+NEI4 $6529
+ADDRGP4 Menu_PaintAll
+CALLV
+pop
+ADDRGP4 $6529
+JUMPV
+LABELV $6528
+ADDRGP4 CG_DrawStatusBar
+CALLV
+pop
+LABELV $6529
+LABELV $6525
+LABELV $6519
+ADDRGP4 CG_DrawSpectator
+CALLV
+pop
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+ADDRGP4 CG_ScanForCrosshairEntity
+CALLV
+pop
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 CG_DrawCrosshairTeammateHealth
+CALLV
+pop
+ADDRGP4 CG_DrawKeyPress
+CALLV
+pop
+ADDRGP4 $6512
+JUMPV
+LABELV $6511
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+617020
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $6542
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $6541
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $6541
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $6541
+LABELV $6542
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $6534
+LABELV $6541
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $6543
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $6559
+ADDRGP4 cg_scoreBoardWhenDead+12
+INDIRI4
+CNSTI4 0
+NEI4 $6560
+LABELV $6559
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $6561
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $6561
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $6561
+ADDRGP4 cg_scoreBoardWhenDead+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $6560
+LABELV $6561
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $6546
+ADDRGP4 cg_scoreBoardAtIntermission+12
+INDIRI4
+CNSTI4 0
+EQI4 $6546
+LABELV $6560
+ADDRGP4 $6544
+JUMPV
+LABELV $6546
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_qlhud+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $6562
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $6562
+ADDRGP4 cg+686628
+INDIRI4
+CNSTI4 0
+NEI4 $6544
+ADDRGP4 Menu_PaintAll
+CALLV
+pop
+ADDRGP4 $6544
+JUMPV
+LABELV $6562
+ADDRGP4 CG_DrawStatusBar
+CALLV
+pop
+ADDRGP4 $6544
+JUMPV
+LABELV $6543
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_qlhud+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $6569
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $6569
+ADDRGP4 cg+686628
+INDIRI4
+CNSTI4 0
+NEI4 $6570
+ADDRGP4 Menu_PaintAll
+CALLV
+pop
+ADDRGP4 $6570
+JUMPV
+LABELV $6569
+ADDRGP4 CG_DrawStatusBar
+CALLV
+pop
+LABELV $6570
+LABELV $6544
+ADDRGP4 CG_DrawProxWarning
+CALLV
+pop
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+ADDRGP4 CG_ScanForCrosshairEntity
+CALLV
+pop
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 CG_DrawCrosshairTeammateHealth
+CALLV
+pop
+ADDRGP4 CG_DrawKeyPress
+CALLV
+pop
+ADDRGP4 CG_DrawDominationPointStatus
+CALLV
+pop
+ADDRGP4 CG_DrawWeaponBar
+CALLV
+pop
+ADDRGP4 CG_DrawCtfsRoundScoreboard
+CALLV
+pop
+ADDRGP4 CG_DrawHoldableItem
+CALLV
+pop
+ADDRGP4 CG_RewardAnnouncements
+CALLV
+pop
+ADDRGP4 CG_DrawReward
+CALLV
+pop
+ADDRGP4 CG_DrawAmmoWarning
+CALLV
+pop
+LABELV $6534
+LABELV $6512
+LABELV $6501
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $6576
+ADDRGP4 CG_DrawTeamInfo
+CALLV
+pop
+LABELV $6576
+ADDRGP4 CG_VoteAnnouncements
+CALLV
+pop
+ADDRGP4 CG_DrawVote
+CALLV
+pop
+ADDRGP4 CG_TeamVoteAnnouncements
+CALLV
+pop
+ADDRGP4 CG_DrawTeamVote
+CALLV
+pop
+ADDRGP4 CG_DrawLagometer
+CALLV
+pop
+ADDRGP4 CG_DrawUpperRight
+CALLV
+pop
+ADDRGP4 CG_DrawUpperLeft
+CALLV
+pop
+ADDRGP4 cg_drawClientItemTimer+12
+INDIRI4
+CNSTI4 0
+EQI4 $6579
+ADDRGP4 CG_DrawClientItemTimer
+CALLV
+pop
+LABELV $6579
+ADDRGP4 cg_fxDebugEntities+12
+INDIRI4
+CNSTI4 2
+GTI4 $6586
+ADDRGP4 cg_fxDebugEntities+12
+INDIRI4
+CNSTI4 0
+GEI4 $6582
+LABELV $6586
+ADDRGP4 CG_DrawFxDebugEntities
+CALLV
+pop
+LABELV $6582
+ADDRGP4 cg_drawJumpSpeeds+12
+INDIRI4
+CNSTI4 0
+EQI4 $6587
+ADDRGP4 CG_DrawJumpSpeeds
+CALLV
+pop
+LABELV $6587
+ADDRGP4 cg_drawJumpSpeedsTime+12
+INDIRI4
+CNSTI4 0
+EQI4 $6590
+ADDRGP4 CG_DrawJumpSpeedsTime
+CALLV
+pop
+LABELV $6590
+ADDRGP4 cg_drawRaceTime+12
+INDIRI4
+CNSTI4 0
+EQI4 $6593
+ADDRGP4 CG_DrawRaceTime
+CALLV
+pop
+LABELV $6593
+ADDRGP4 CG_DrawLowerRight
+CALLV
+pop
+ADDRGP4 CG_DrawLowerLeft
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 CG_DrawFollow
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $6596
+LABELV $6596
+ADDRGP4 Wolfcam_DrawFollowing
+CALLV
+pop
+ADDRGP4 CG_DrawCpmaMvdIndicator
+CALLV
+pop
+ADDRGP4 CG_WarmupAnnouncements
+CALLV
+pop
+ADDRGP4 CG_DrawWarmup
+CALLV
+pop
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $6598
+ADDRLP4 8
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+617024
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $6599
+JUMPV
+LABELV $6598
+ADDRGP4 cg+686628
+INDIRI4
+CNSTI4 0
+EQI4 $6601
+ADDRLP4 8
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+617024
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $6602
+JUMPV
+LABELV $6601
+ADDRGP4 cg+617024
+CNSTI4 0
+ASGNI4
+LABELV $6602
+LABELV $6599
+ADDRGP4 CG_RoundAnnouncements
+CALLV
+pop
+ADDRGP4 CG_DrawCenter
+CALLV
+pop
+ADDRGP4 cg+617024
+INDIRI4
+CNSTI4 0
+NEI4 $6606
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+ADDRGP4 CG_DrawFragMessage
+CALLV
+pop
+LABELV $6606
+ADDRGP4 cg_qlhud+12
+INDIRI4
+CNSTI4 0
+NEI4 $6609
+ADDRGP4 trap_R_DrawConsoleLines
+CALLV
+pop
+LABELV $6609
+ADDRGP4 CG_DrawAccStats
+CALLV
+pop
+ADDRGP4 CG_DrawCameraPointInfo
+CALLV
+pop
+ADDRGP4 CG_DrawEchoPopup
+CALLV
+pop
+ADDRGP4 CG_DrawFlashFade
+CALLV
+pop
+ADDRGP4 cg_fadeStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $6612
+ADDRGP4 CG_DrawFade
+CALLV
+pop
+LABELV $6612
+ADDRGP4 CG_DrawErrorPopup
+CALLV
+pop
+ADDRGP4 $6617
+ARGP4
+ADDRLP4 8
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $6615
+ADDRLP4 12
+ARGP4
+ADDRGP4 $6618
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 QLWideScreen
+CNSTI4 2
+ASGNI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $6615
+ADDRGP4 cg+617024
+INDIRI4
+CNSTI4 0
+EQI4 $6619
+ADDRGP4 CG_DrawScoreboardMenuCursor
+CALLV
+pop
+LABELV $6619
+LABELV $6435
+endproc CG_Draw2D 1036 36
+export CG_RenderViewAxis
+proc CG_RenderViewAxis 28 8
+ADDRGP4 cg+1334988
+INDIRI4
+CNSTI4 -1
+LEI4 $6623
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+NEI4 $6623
+ADDRLP4 24
+CNSTI4 1496
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+1334988
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+1334988
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+4
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTI4 1496
+ADDRGP4 cg+1334988
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+8
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 $6624
+JUMPV
+LABELV $6623
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+LABELV $6624
+LABELV $6622
+endproc CG_RenderViewAxis 28 8
+export CG_DrawActive
+proc CG_DrawActive 52 8
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $6648
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $6647
+JUMPV
+LABELV $6648
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $6651
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $6651
+ADDRGP4 CG_DrawTourneyScoreboard
+CALLV
+pop
+ADDRGP4 $6647
+JUMPV
+LABELV $6651
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $6658
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $6659
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $6661
+ADDRGP4 $6655
+JUMPV
+LABELV $6658
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $6656
+JUMPV
+LABELV $6659
+ADDRLP4 0
+ADDRGP4 cg_stereoSeparation+8
+INDIRF4
+NEGF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRGP4 $6656
+JUMPV
+LABELV $6661
+ADDRLP4 0
+ADDRGP4 cg_stereoSeparation+8
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRGP4 $6656
+JUMPV
+LABELV $6655
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $6663
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $6656
+ADDRGP4 CG_TileClear
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $6666
+ADDRGP4 cg+609412+24
+ADDRGP4 cg+609412+24
+INDIRF4
+ADDRGP4 cg+609412+36+12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24+4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+ADDRGP4 cg+609412+36+12+4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24+8
+ADDRGP4 cg+609412+24+8
+INDIRF4
+ADDRGP4 cg+609412+36+12+8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $6666
+ADDRGP4 cg+1334988
+INDIRI4
+CNSTI4 -1
+LEI4 $6695
+ADDRLP4 48
+CNSTI4 1496
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+1334988
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+1334988
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+4
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+CNSTI4 1496
+ADDRGP4 cg+1334988
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+8
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 cg+1335000
+ADDRLP4 24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+NEI4 $6717
+ADDRGP4 cg+609780
+ADDRLP4 36
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $6717
+LABELV $6695
+ADDRGP4 CG_FloatEntNumbers
+CALLV
+pop
+ADDRGP4 cg_animationsIgnoreTimescale+12
+INDIRI4
+CNSTI4 0
+EQI4 $6724
+ADDRGP4 cg+609412+72
+ADDRGP4 cg+607168
+INDIRI4
+ASGNI4
+LABELV $6724
+ADDRLP4 24
+ADDRGP4 cg+609412+72
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_animationsRate+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $6733
+JUMPV
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 $6734
+JUMPV
+LABELV $6733
+ADDRGP4 CG_FlushSceneBatch
+CALLV
+pop
+ADDRGP4 cg+609412
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $6734
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $6736
+ADDRGP4 cg+609412+24
+ADDRLP4 4
+INDIRB
+ASGNB 12
+LABELV $6736
+ADDRGP4 cg+3874636
+INDIRI4
+CNSTI4 0
+EQI4 $6740
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 CG_DrawEchoPopup
+CALLV
+pop
+ADDRGP4 CG_DrawErrorPopup
+CALLV
+pop
+ADDRGP4 CG_WarmupAnnouncements
+CALLV
+pop
+ADDRGP4 CG_RoundAnnouncements
+CALLV
+pop
+ADDRGP4 CG_RewardAnnouncements
+CALLV
+pop
+ADDRGP4 CG_VoteAnnouncements
+CALLV
+pop
+ADDRGP4 CG_TeamVoteAnnouncements
+CALLV
+pop
+ADDRGP4 $6741
+JUMPV
+LABELV $6740
+ADDRGP4 CG_Draw2D
+CALLV
+pop
+LABELV $6741
+LABELV $6647
+endproc CG_DrawActive 52 8
+export CG_Fade
+proc CG_Fade 0 0
+ADDRGP4 cgs+632896
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRGP4 cgs+632904
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632908
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632904
+INDIRI4
+ADDRGP4 cgs+632908
+INDIRI4
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+GTI4 $6743
+ADDRGP4 cgs+632900
+ADDRGP4 cgs+632896
+INDIRF4
+ASGNF4
+LABELV $6743
+endproc CG_Fade 0 0
+bss
+align 4
+LABELV $6755
+skip 4
+export CG_DrawFlashFade
+code
+proc CG_DrawFlashFade 40 20
+ADDRGP4 cgs+632904
+INDIRI4
+ADDRGP4 cgs+632908
+INDIRI4
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+GEI4 $6756
+ADDRGP4 cgs+632900
+ADDRGP4 cgs+632896
+INDIRF4
+ASGNF4
+ADDRGP4 $6757
+JUMPV
+LABELV $6756
+ADDRGP4 cgs+632900
+INDIRF4
+ADDRGP4 cgs+632896
+INDIRF4
+EQF4 $6763
+ADDRLP4 24
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 $6755
+ASGNP4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 500
+GEI4 $6767
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $6767
+ADDRGP4 cgs+632900
+INDIRF4
+ADDRGP4 cgs+632896
+INDIRF4
+LEF4 $6769
+ADDRLP4 36
+ADDRGP4 cgs+632900
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+632908
+INDIRI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 cgs+632900
+INDIRF4
+ADDRGP4 cgs+632896
+INDIRF4
+GEF4 $6770
+ADDRGP4 cgs+632900
+ADDRGP4 cgs+632896
+INDIRF4
+ASGNF4
+ADDRGP4 $6770
+JUMPV
+LABELV $6769
+ADDRLP4 36
+ADDRGP4 cgs+632900
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+632908
+INDIRI4
+CVIF4 4
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 cgs+632900
+INDIRF4
+ADDRGP4 cgs+632896
+INDIRF4
+LEF4 $6783
+ADDRGP4 cgs+632900
+ADDRGP4 cgs+632896
+INDIRF4
+ASGNF4
+LABELV $6783
+LABELV $6770
+LABELV $6767
+LABELV $6763
+LABELV $6757
+ADDRGP4 cgs+632900
+INDIRF4
+CNSTF4 0
+LEF4 $6789
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRGP4 cgs+632900
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $6789
+LABELV $6754
+endproc CG_DrawFlashFade 40 20
+proc CG_DrawFade 20 20
+ADDRGP4 cg_fadeAlpha+12
+INDIRI4
+CNSTI4 0
+GTI4 $6797
+ADDRGP4 $6796
+JUMPV
+LABELV $6797
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg_fadeColor
+ARGP4
+ADDRGP4 cg_fadeAlpha
+ARGP4
+ADDRGP4 SC_Vec4ColorFromCvars
+CALLV
+pop
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $6796
+endproc CG_DrawFade 20 20
+bss
+align 4
+LABELV fontImageHeight
+skip 4
+align 4
+LABELV fontImageWidth
+skip 4
+align 1
+LABELV tmpBuff
+skip 1048576
+align 1
+LABELV fontImageData
+skip 1048576
+align 1
+LABELV finalImgBuff
+skip 35651584
+align 1
+LABELV imgBuff
+skip 35651584
+align 4
+LABELV SP_backgroundColor
+skip 16
+align 4
+LABELV SP_selectedColor
+skip 16
+align 4
+LABELV SP_count
+skip 4
+align 4
+LABELV SP_font
+skip 4
+align 4
+LABELV SP_style
+skip 4
+align 4
+LABELV SP_color
+skip 16
+align 4
+LABELV SP_scale
+skip 4
+align 4
+LABELV SP_align
+skip 4
+align 4
+LABELV SP_h
+skip 4
+align 4
+LABELV SP_y
+skip 4
+align 4
+LABELV SP_x
+skip 4
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import Wolfcam_WeaponTrace
+import Wolfcam_PlayerArmor
+import Wolfcam_PlayerHealth
+import Wolfcam_AddBoundingBox
+import Wolfcam_AddBox
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import CG_SpawnRailTrail
+import CG_AddWeaponWithPowerups
+import CG_MachinegunSpinAngle
+import CG_MapTorsoToWeaponFrame
+import CG_Bullet
+import CG_GetWeaponFlashOrigin
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_OutOfAmmoChange
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_DrawWeaponSelect
+import CG_AddViewWeapon
+import CG_AddPlayerWeapon
+import CG_LightningBolt
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_SimpleRailTrail
+import CG_DrawActiveFrame
+import CG_AdjustOriginToAvoidSolid
+import CG_CalcSpline
+import CG_AddBufferedSound
+import CG_AdjustedFov
+import CG_CalcZoom
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_CalcVrect
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_AddRealLoopingSound
+import CG_AddLoopingSound
+import CG_StartLocalSound
+import CG_StartSound
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_ClearSceneBatch
+import CG_FlushSceneBatch
+import CG_AddPolyToSceneBatch
+import CG_AddRefEntityToSceneBatch
+import CG_Q3mmeCameraResetInternalLengths
+import CG_Q3mmeCameraParse
+import CG_Q3mmeCameraSave
+import CG_Q3mmeDemoCameraCommand_f
+import CG_Q3mmeCameraDrawPath
+import CG_Q3mmeCameraFovAt
+import CG_Q3mmeCameraAnglesAt
+import CG_Q3mmeCameraOriginAt
+import CG_Q3mmeCameraPointAdd
+import demo
+import BG_XMLParse
+import BG_XMLOpen
+import BG_XMLWarning
+import BG_XMLError
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_ShutdownLocalEnts
+import CG_GetStoredScriptVarsFromLE
+import CG_RunFxAll
+import CG_SmokePuff_ql
+import CG_AddRefEntityFX
+import CG_AddRefEntity
+import CG_ListLocalEntities
+import CG_RemoveFXLocalEntities
+import CG_ClearLocalFrameEntities
+import CG_CullGrid
+import CG_AddToCullGrid
+import CG_BeginCullGrid
+import CG_AddLocalEntities
+import CG_MakeLowPriorityEntity
+import CG_AllocLocalEntityRealTime
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import FxLoopSounds
+import CG_FreeFxJitTokens
+import CG_ResetFXIntervalAndDistance
+import CG_UpdatePositionData
+import CG_CopyPositionDataToScript
+import CG_CopyPositionDataToCent
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+import CG_CopyPlayerDataToScriptData
+import CG_ResetScriptVars
+import CG_ReloadQ3mmeScripts
+import CG_RunQ3mmeScript
+import CG_Q3mmeMath
+import EffectScripts
+import PlainScript
+import DistanceScript
+import EmitterScript
+import EmitterScriptVars
+import ScriptVars
+import UI_DrawProportionalString3
+import UI_DrawProportionalString
+import CG_ColorForHealth
+import CG_GetColorForHealth
+import CG_TeamColor
+import CG_FadeColorVec4
+import CG_FadeColorRealTime
+import CG_FadeColor
+import CG_TileClear
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawStretchPic
+import CG_DrawPic
+import CG_DrawRect
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetTeamColor
+import CG_RunMenuScript
+import CG_ShowResponseHead
+import CG_KeyEvent
+import CG_EventHandling
+import CG_MouseEvent
+import CG_OwnerDraw
+import CG_GetServerTimeFromClockString
+import CG_GetLevelTimerString
+import CG_GetCurrentTimeWithDirection
+import CG_DrawWeaponBar
+import CG_Text_Paint_Align
+import CG_Text_Paint_Limit_Bottom
+import CG_Text_Paint_Limit
+import CG_Text_Length
+import CG_GameTypeString
+import CG_GetGameStatusText
+import CG_GetKillerText
+import CG_OwnerDrawVisible
+import CG_YourTeamHasFlag
+import CG_OtherTeamHasFlag
+import CG_GetValue
+import CG_SelectPrevPlayer
+import CG_SelectNextPlayer
+import CG_CheckOrderPending
+import CG_SetPrintString
+import CG_InitTeamChat
+import MenuRect
+import QLWideScreen
+import MenuWidescreen
+import CG_DrawInformation
+import CG_LoadingFutureClient
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_FreezeTagFrozen
+export tmpExtString
+align 4
+LABELV tmpExtString
+skip 4096
+export lagometer
+align 4
+LABELV lagometer
+skip 1544
+export teamChat2
+align 1
+LABELV teamChat2
+skip 256
+export teamChat1
+align 1
+LABELV teamChat1
+skip 256
+export systemChat
+align 1
+LABELV systemChat
+skip 256
+export numSortedTeamPlayers
+align 4
+LABELV numSortedTeamPlayers
+skip 4
+export sortedTeamPlayers
+align 4
+LABELV sortedTeamPlayers
+skip 128
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $6663
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 85
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 111
+byte 1 86
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $6618
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 48
+byte 1 97
+byte 1 98
+byte 1 99
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 103
+byte 1 104
+byte 1 105
+byte 1 106
+byte 1 107
+byte 1 108
+byte 1 109
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 10
+byte 1 113
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 118
+byte 1 119
+byte 1 120
+byte 1 121
+byte 1 122
+byte 1 65
+byte 1 66
+byte 1 67
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 71
+byte 1 72
+byte 1 73
+byte 1 74
+byte 1 75
+byte 1 76
+byte 1 77
+byte 1 78
+byte 1 10
+byte 1 79
+byte 1 80
+byte 1 81
+byte 1 82
+byte 1 83
+byte 1 84
+byte 1 85
+byte 1 86
+byte 1 87
+byte 1 88
+byte 1 89
+byte 1 90
+byte 1 10
+byte 1 126
+byte 1 33
+byte 1 64
+byte 1 35
+byte 1 36
+byte 1 37
+byte 1 94
+byte 1 38
+byte 1 42
+byte 1 40
+byte 1 41
+byte 1 95
+byte 1 45
+byte 1 43
+byte 1 61
+byte 1 92
+byte 1 93
+byte 1 125
+byte 1 91
+byte 1 123
+byte 1 39
+byte 1 34
+byte 1 59
+byte 1 58
+byte 1 47
+byte 1 63
+byte 1 46
+byte 1 62
+byte 1 44
+byte 1 60
+byte 1 10
+byte 1 0
+align 1
+LABELV $6617
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $6487
+byte 1 94
+byte 1 54
+byte 1 81
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 54
+byte 1 40
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 81
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 49
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 41
+byte 1 0
+align 1
+LABELV $6486
+byte 1 94
+byte 1 54
+byte 1 81
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 54
+byte 1 40
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 81
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $6482
+byte 1 94
+byte 1 54
+byte 1 81
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 54
+byte 1 40
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $6474
+byte 1 94
+byte 1 53
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 40
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 81
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 49
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 41
+byte 1 0
+align 1
+LABELV $6473
+byte 1 94
+byte 1 53
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 40
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 81
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $6469
+byte 1 94
+byte 1 53
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 40
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $6462
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 69
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 72
+byte 1 117
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 49
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 41
+byte 1 0
+align 1
+LABELV $6405
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $6383
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $6378
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $6371
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $6339
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $6338
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 120
+byte 1 41
+byte 1 0
+align 1
+LABELV $6327
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $6326
+byte 1 84
+byte 1 0
+align 1
+LABELV $6178
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $6157
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $6152
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $6116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $6100
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $6099
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $6095
+byte 1 72
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $6091
+byte 1 84
+byte 1 119
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 84
+byte 1 119
+byte 1 111
+byte 1 0
+align 1
+LABELV $6087
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $6083
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 82
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $6079
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $6075
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $6074
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 107
+byte 1 101
+byte 1 0
+align 1
+LABELV $6067
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $6063
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $6059
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $6055
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $6051
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $6047
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $6043
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $6039
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $6026
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 118
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5989
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $5987
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $5982
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $5892
+byte 1 89
+byte 1 79
+byte 1 85
+byte 1 32
+byte 1 72
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 32
+byte 1 66
+byte 1 69
+byte 1 69
+byte 1 78
+byte 1 32
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $5890
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 78
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 67
+byte 1 79
+byte 1 77
+byte 1 66
+byte 1 85
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $5857
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 32
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $5856
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $5715
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $5710
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $5705
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $5694
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $5688
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $5682
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $5676
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $5670
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $5664
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $5656
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 0
+align 1
+LABELV $5650
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 0
+align 1
+LABELV $5644
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $5638
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $5632
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $5628
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $5626
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $5622
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $5617
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $5606
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $5600
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $5594
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $5588
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $5582
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $5576
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $5568
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 0
+align 1
+LABELV $5562
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 0
+align 1
+LABELV $5556
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $5550
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $5459
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 115
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $5387
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 115
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $5349
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 74
+byte 1 79
+byte 1 73
+byte 1 78
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $5345
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $5341
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $5294
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 0
+align 1
+LABELV $5292
+byte 1 47
+byte 1 32
+byte 1 0
+align 1
+LABELV $5288
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 0
+align 1
+LABELV $5279
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 0
+align 1
+LABELV $5212
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4821
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4811
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4806
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4593
+byte 1 73
+byte 1 80
+byte 1 0
+align 1
+LABELV $4552
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 99
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $4549
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4541
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $4540
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $4537
+byte 1 115
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 0
+align 1
+LABELV $4534
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $4531
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 0
+align 1
+LABELV $4528
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $4525
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 0
+align 1
+LABELV $4522
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $4514
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 125
+byte 1 0
+align 1
+LABELV $4513
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 0
+align 1
+LABELV $4510
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $4507
+byte 1 121
+byte 1 32
+byte 1 0
+align 1
+LABELV $4504
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $4501
+byte 1 120
+byte 1 32
+byte 1 0
+align 1
+LABELV $4498
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $4495
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 0
+align 1
+LABELV $4415
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $4308
+byte 1 48
+byte 1 120
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $4224
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $4222
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 0
+align 1
+LABELV $4193
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4190
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $4188
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4080
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 10
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $4079
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 10
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $4072
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 10
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $4068
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 66
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 10
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $4055
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 33
+byte 1 0
+align 1
+LABELV $4054
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 32
+byte 1 84
+byte 1 72
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 76
+byte 1 65
+byte 1 71
+byte 1 33
+byte 1 0
+align 1
+LABELV $4053
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 84
+byte 1 72
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 76
+byte 1 65
+byte 1 71
+byte 1 33
+byte 1 0
+align 1
+LABELV $4031
+byte 1 82
+byte 1 85
+byte 1 78
+byte 1 33
+byte 1 0
+align 1
+LABELV $4026
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 33
+byte 1 0
+align 1
+LABELV $3982
+byte 1 77
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $3788
+byte 1 45
+byte 1 0
+align 1
+LABELV $3591
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3576
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3240
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3176
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3171
+byte 1 32
+byte 1 120
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $3068
+byte 1 94
+byte 1 49
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2982
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 51
+byte 1 102
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $2854
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $2781
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 0
+align 1
+LABELV $2773
+byte 1 70
+byte 1 82
+byte 1 79
+byte 1 90
+byte 1 69
+byte 1 78
+byte 1 0
+align 1
+LABELV $2623
+byte 1 32
+byte 1 33
+byte 1 34
+byte 1 35
+byte 1 36
+byte 1 37
+byte 1 38
+byte 1 39
+byte 1 40
+byte 1 41
+byte 1 42
+byte 1 43
+byte 1 45
+byte 1 46
+byte 1 47
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 58
+byte 1 59
+byte 1 60
+byte 1 61
+byte 1 62
+byte 1 63
+byte 1 64
+byte 1 65
+byte 1 66
+byte 1 67
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 71
+byte 1 72
+byte 1 73
+byte 1 74
+byte 1 75
+byte 1 76
+byte 1 77
+byte 1 78
+byte 1 79
+byte 1 80
+byte 1 81
+byte 1 82
+byte 1 83
+byte 1 84
+byte 1 85
+byte 1 86
+byte 1 87
+byte 1 88
+byte 1 89
+byte 1 90
+byte 1 91
+byte 1 93
+byte 1 45
+byte 1 96
+byte 1 97
+byte 1 98
+byte 1 99
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 103
+byte 1 104
+byte 1 105
+byte 1 106
+byte 1 107
+byte 1 108
+byte 1 109
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 113
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 118
+byte 1 119
+byte 1 120
+byte 1 121
+byte 1 122
+byte 1 123
+byte 1 125
+byte 1 124
+byte 1 0
+align 1
+LABELV $2594
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $2592
+byte 1 48
+byte 1 58
+byte 1 48
+byte 1 48
+byte 1 32
+byte 1 40
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 41
+byte 1 0
+align 1
+LABELV $2590
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 40
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 41
+byte 1 0
+align 1
+LABELV $2588
+byte 1 48
+byte 1 58
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $2554
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $2529
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2483
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 0
+align 1
+LABELV $2436
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2413
+byte 1 94
+byte 1 53
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2390
+byte 1 94
+byte 1 52
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2389
+byte 1 94
+byte 1 52
+byte 1 42
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2385
+byte 1 94
+byte 1 52
+byte 1 32
+byte 1 32
+byte 1 45
+byte 1 0
+align 1
+LABELV $2347
+byte 1 94
+byte 1 50
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2346
+byte 1 94
+byte 1 50
+byte 1 42
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2342
+byte 1 94
+byte 1 50
+byte 1 32
+byte 1 32
+byte 1 45
+byte 1 0
+align 1
+LABELV $2313
+byte 1 94
+byte 1 51
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2312
+byte 1 94
+byte 1 51
+byte 1 42
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2308
+byte 1 94
+byte 1 51
+byte 1 32
+byte 1 32
+byte 1 45
+byte 1 0
+align 1
+LABELV $2279
+byte 1 94
+byte 1 49
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2278
+byte 1 94
+byte 1 49
+byte 1 42
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2274
+byte 1 94
+byte 1 49
+byte 1 32
+byte 1 32
+byte 1 45
+byte 1 0
+align 1
+LABELV $2243
+byte 1 37
+byte 1 105
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $2242
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2238
+byte 1 37
+byte 1 46
+byte 1 51
+byte 1 102
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $2237
+byte 1 37
+byte 1 46
+byte 1 51
+byte 1 102
+byte 1 0
+align 1
+LABELV $2182
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1777
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1732
+byte 1 49
+byte 1 73
+byte 1 80
+byte 1 85
+byte 1 84
+byte 1 89
+byte 1 103
+byte 1 106
+byte 1 0
+align 1
+LABELV $1730
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 112
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1721
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 110
+byte 1 120
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1713
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1708
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1688
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1659
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1645
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 108
+byte 1 121
+byte 1 112
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1637
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 103
+byte 1 108
+byte 1 121
+byte 1 112
+byte 1 104
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 99
+byte 1 39
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1628
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1504
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1463
+byte 1 65
+byte 1 66
+byte 1 67
+byte 1 88
+byte 1 89
+byte 1 90
+byte 1 0
+align 1
+LABELV $1415
+byte 1 10
+byte 1 0
+align 1
+LABELV $1413
+byte 1 32
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 46
+byte 1 93
+byte 1 32
+byte 1 0
+align 1
+LABELV $1412
+byte 1 37
+byte 1 99
+byte 1 58
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 0
+align 1
+LABELV $1342
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1306
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 113
+byte 1 108
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1299
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 46
+byte 1 116
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $1198
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1137
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $1133
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 99
+byte 1 39
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $1094
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1064
+byte 1 113
+byte 1 51
+byte 1 103
+byte 1 105
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1061
+byte 1 113
+byte 1 51
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1058
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $1033
+byte 1 91
+byte 1 67
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 32
+byte 1 77
+byte 1 86
+byte 1 68
+byte 1 93
+byte 1 0
+align 1
+LABELV $997
+byte 1 37
+byte 1 115
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $993
+byte 1 37
+byte 1 115
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $984
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $937
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $932
+byte 1 94
+byte 1 50
+byte 1 0
+align 1
+LABELV $921
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $920
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $891
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 84
+byte 1 32
+byte 1 84
+byte 1 73
+byte 1 77
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $887
+byte 1 67
+byte 1 85
+byte 1 82
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 32
+byte 1 82
+byte 1 85
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $829
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $821
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $820
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $791
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 0
+align 1
+LABELV $779
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $754
+byte 1 94
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $753
+byte 1 94
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $673
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $672
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $671
+byte 1 98
+byte 1 101
+byte 1 122
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $669
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 45
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $667
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $657
+byte 1 32
+byte 1 40
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 41
+byte 1 0
+align 1
+LABELV $652
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $651
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $650
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 58
+byte 1 0
+align 1
+LABELV $635
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $634
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $633
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $632
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $623
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $614
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 91
+byte 1 48
+byte 1 93
+byte 1 0
+align 1
+LABELV $606
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $569
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $568
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $567
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $566
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $561
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $560
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $555
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $554
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $547
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $546
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $541
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $540
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $535
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $534
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $527
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $526
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $521
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $520
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $515
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $514
+byte 1 122
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $507
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $506
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $501
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $500
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $495
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $494
+byte 1 121
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $487
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $486
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $481
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $480
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $475
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $474
+byte 1 120
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $467
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $466
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 94
+byte 1 54
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 0
+align 1
+LABELV $465
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 41
+byte 1 32
+byte 1 94
+byte 1 54
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 0
+align 1
+LABELV $460
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 0
+align 1
+LABELV $459
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $458
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 0
+align 1
+LABELV $453
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 94
+byte 1 54
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 0
+align 1
+LABELV $452
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $451
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 41
+byte 1 32
+byte 1 94
+byte 1 54
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 0
+align 1
+LABELV $444
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $443
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 0
+align 1
+LABELV $442
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 41
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 0
+align 1
+LABELV $437
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 0
+align 1
+LABELV $436
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $435
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 0
+align 1
+LABELV $430
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 0
+align 1
+LABELV $429
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $428
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 41
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 102
+byte 1 40
+byte 1 105
+byte 1 109
+byte 1 109
+byte 1 41
+byte 1 0
+align 1
+LABELV $421
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $420
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $417
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $414
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $411
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $408
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $405
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 58
+byte 1 0
+align 1
+LABELV $404
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $401
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $400
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $397
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $394
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $391
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $390
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $389
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $386
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $385
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $375
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 0
+align 1
+LABELV $373
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 0
+align 1
+LABELV $371
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $369
+byte 1 0
+align 1
+LABELV $368
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 0
+align 1
+LABELV $367
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $366
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $365
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $362
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $359
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $356
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $353
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $352
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $349
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $346
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $343
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $340
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $337
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $334
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $331
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $328
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $325
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $324
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 116
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 82
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $321
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 66
+byte 1 101
+byte 1 122
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $318
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $315
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $312
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $309
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $306
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $305
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 40
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 41
+byte 1 0
+align 1
+LABELV $302
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $301
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 40
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 41
+byte 1 0
+align 1
+LABELV $288
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $287
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $283
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $280
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 43
+byte 1 93
+byte 1 0
+align 1
+LABELV $275
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 91
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 48
+byte 1 93
+byte 1 0
+align 1
+LABELV $247
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $244
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 109
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 41
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $241
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 41
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $234
+byte 1 32
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $232
+byte 1 32
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $201
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 48
+byte 1 97
+byte 1 98
+byte 1 99
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 103
+byte 1 104
+byte 1 105
+byte 1 106
+byte 1 107
+byte 1 108
+byte 1 109
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 113
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 118
+byte 1 119
+byte 1 120
+byte 1 121
+byte 1 122
+byte 1 65
+byte 1 66
+byte 1 67
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 71
+byte 1 72
+byte 1 73
+byte 1 74
+byte 1 75
+byte 1 76
+byte 1 77
+byte 1 78
+byte 1 79
+byte 1 80
+byte 1 81
+byte 1 82
+byte 1 83
+byte 1 84
+byte 1 85
+byte 1 86
+byte 1 87
+byte 1 88
+byte 1 89
+byte 1 90
+byte 1 126
+byte 1 96
+byte 1 33
+byte 1 64
+byte 1 35
+byte 1 36
+byte 1 37
+byte 1 94
+byte 1 38
+byte 1 42
+byte 1 40
+byte 1 41
+byte 1 45
+byte 1 95
+byte 1 61
+byte 1 43
+byte 1 91
+byte 1 123
+byte 1 93
+byte 1 125
+byte 1 92
+byte 1 124
+byte 1 59
+byte 1 58
+byte 1 39
+byte 1 34
+byte 1 44
+byte 1 46
+byte 1 47
+byte 1 63
+byte 1 0
@@ -0,0 +1,7278 @@
+export CG_AdjustFrom640
+code
+proc CG_AdjustFrom640 60 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+NEF4 $146
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $146
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+CNSTI4 5
+NEI4 $148
+ADDRGP4 cgs+20100+19496
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+20100+19500
+INDIRI4
+CVIF4 4
+DIVF4
+CNSTF4 1067450368
+GEF4 $151
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $151
+ADDRLP4 8
+ADDRGP4 MenuRect
+INDIRB
+ASGNB 16
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+12
+ADDRLP4 8+12
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1082130432
+ADDRGP4 cgs+20100+19500
+INDIRI4
+CVIF4 4
+CNSTF4 1077936128
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cgs+20100+19496
+INDIRI4
+CVIF4 4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 36
+INDIRF4
+CNSTF4 1142947840
+DIVF4
+ASGNF4
+ADDRGP4 QLWideScreen
+INDIRI4
+CNSTI4 0
+NEI4 $172
+ADDRGP4 MenuWidescreen
+INDIRI4
+CNSTI4 0
+EQI4 $174
+ADDRGP4 $176
+ARGP4
+ADDRGP4 MenuWidescreen
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $174
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $172
+ADDRGP4 QLWideScreen
+INDIRI4
+CNSTI4 1
+NEI4 $181
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $181
+ADDRGP4 QLWideScreen
+INDIRI4
+CNSTI4 2
+NEI4 $185
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $185
+ADDRGP4 QLWideScreen
+INDIRI4
+CNSTI4 3
+NEI4 $189
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $189
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $197
+ARGP4
+ADDRGP4 QLWideScreen
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $145
+JUMPV
+LABELV $148
+ADDRGP4 cg+617024
+INDIRI4
+CNSTI4 0
+EQI4 $198
+ADDRGP4 cg_wideScreenScoreBoardHack+12
+INDIRI4
+CNSTI4 1
+NEI4 $201
+ADDRLP4 8
+CNSTF4 1082130432
+ADDRGP4 cgs+20100+19500
+INDIRI4
+CVIF4 4
+CNSTF4 1077936128
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cgs+20100+19496
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 20
+INDIRF4
+CNSTF4 1142947840
+DIVF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $201
+ADDRGP4 cg_wideScreenScoreBoardHack+12
+INDIRI4
+CNSTI4 2
+NEI4 $210
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $210
+LABELV $198
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+CNSTI4 0
+EQI4 $223
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+CNSTI4 3
+EQI4 $223
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+CNSTI4 4
+NEI4 $217
+LABELV $223
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+CNSTI4 4
+NEI4 $218
+ADDRLP4 4
+ADDRGP4 cgs+20100+19500
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+20100+19496
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1061158912
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRLP4 28
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $218
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+CNSTI4 1
+NEI4 $237
+ADDRGP4 $238
+JUMPV
+LABELV $237
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+CNSTI4 2
+NEI4 $240
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+LABELV $240
+LABELV $238
+LABELV $218
+LABELV $145
+endproc CG_AdjustFrom640 60 8
+export CG_FillRect
+proc CG_FillRect 4 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $247
+endproc CG_FillRect 4 36
+export CG_DrawSides
+proc CG_DrawSides 12 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRFP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $250
+endproc CG_DrawSides 12 36
+export CG_DrawTopBottom
+proc CG_DrawTopBottom 12 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRGP4 cgs+39668
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $256
+endproc CG_DrawTopBottom 12 36
+export CG_DrawRect
+proc CG_DrawRect 4 20
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawTopBottom
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+CNSTF4 1073741824
+ADDRFP4 16
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawSides
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $262
+endproc CG_DrawRect 4 20
+export CG_DrawPic
+proc CG_DrawPic 8 36
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $263
+endproc CG_DrawPic 8 36
+export CG_DrawStretchPic
+proc CG_DrawStretchPic 0 36
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $264
+endproc CG_DrawStretchPic 0 36
+proc CG_DrawChar 116 36
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_GetGlyphInfo
+CALLI4
+pop
+ADDRLP4 96
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 88
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 92
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 100
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 88
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 108
+ADDRLP4 92
+INDIRF4
+ADDRLP4 104
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 0+16
+INDIRI4
+CVIF4 4
+ADDRLP4 108
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 112
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 0+4
+INDIRI4
+CVIF4 4
+ADDRLP4 112
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 0+24
+INDIRI4
+CVIF4 4
+ADDRLP4 108
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0+28
+INDIRI4
+CVIF4 4
+ADDRLP4 112
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0+32
+INDIRF4
+ARGF4
+ADDRLP4 0+36
+INDIRF4
+ARGF4
+ADDRLP4 0+40
+INDIRF4
+ARGF4
+ADDRLP4 0+44
+INDIRF4
+ARGF4
+ADDRLP4 0+48
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $265
+endproc CG_DrawChar 116 36
+export CG_DrawStringExt
+proc CG_DrawStringExt 80 36
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 36
+ADDRFP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg_testQlFont+12
+INDIRI4
+CNSTI4 0
+EQI4 $281
+ADDRLP4 32
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 36
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cgs+632912+601980
+ASGNP4
+ADDRFP4 24
+INDIRI4
+ADDRFP4 28
+INDIRI4
+EQI4 $286
+LABELV $286
+ADDRFP4 36
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+632912+558644
+CVPU4 4
+NEU4 $288
+ADDRLP4 32
+CNSTF4 1056964608
+ADDRLP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRFP4 36
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+632912+515308
+CVPU4 4
+NEU4 $292
+ADDRGP4 $293
+JUMPV
+LABELV $292
+ADDRFP4 36
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+632912+493640
+CVPU4 4
+NEU4 $296
+ADDRLP4 32
+CNSTF4 1073741824
+ADDRLP4 32
+INDIRF4
+MULF4
+ASGNF4
+LABELV $296
+LABELV $293
+LABELV $289
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $281
+ADDRLP4 32
+ADDRFP4 36
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 32
+INDIRU4
+ADDRGP4 cgs+632912+515308
+CVPU4 4
+EQU4 $300
+ADDRLP4 32
+INDIRU4
+ADDRGP4 cgs+632912+536976
+CVPU4 4
+EQU4 $300
+ADDRLP4 32
+INDIRU4
+ADDRGP4 cgs+632912+558644
+CVPU4 4
+EQU4 $300
+ADDRLP4 32
+INDIRU4
+ADDRGP4 cgs+632912+493640
+CVPU4 4
+EQU4 $300
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1086324736
+ADDF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+CNSTF4 1048576000
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+623648
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $300
+ADDRFP4 32
+INDIRI4
+CNSTI4 0
+GTI4 $312
+ADDRFP4 32
+CNSTI4 32767
+ASGNI4
+LABELV $312
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $314
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $320
+JUMPV
+LABELV $319
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $322
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $322
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $322
+ADDRLP4 56
+INDIRI4
+CNSTI4 65
+LTI4 $325
+ADDRLP4 56
+INDIRI4
+CNSTI4 90
+LEI4 $324
+LABELV $325
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 97
+LTI4 $326
+ADDRLP4 60
+INDIRI4
+CNSTI4 122
+LEI4 $324
+LABELV $326
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 48
+LTI4 $322
+ADDRLP4 64
+INDIRI4
+CNSTI4 57
+GTI4 $322
+LABELV $324
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $327
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 120
+EQI4 $332
+ADDRLP4 68
+INDIRI4
+CNSTI4 88
+NEI4 $330
+LABELV $332
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $320
+JUMPV
+LABELV $330
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $320
+JUMPV
+LABELV $327
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $320
+JUMPV
+LABELV $322
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawChar
+CALLV
+pop
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $320
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $333
+ADDRLP4 8
+INDIRI4
+ADDRFP4 32
+INDIRI4
+LTI4 $319
+LABELV $333
+LABELV $314
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $337
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $337
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $337
+ADDRLP4 52
+INDIRI4
+CNSTI4 65
+LTI4 $340
+ADDRLP4 52
+INDIRI4
+CNSTI4 90
+LEI4 $339
+LABELV $340
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 97
+LTI4 $341
+ADDRLP4 56
+INDIRI4
+CNSTI4 122
+LEI4 $339
+LABELV $341
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 48
+LTI4 $337
+ADDRLP4 60
+INDIRI4
+CNSTI4 57
+GTI4 $337
+LABELV $339
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $344
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_CpmaColorFromString
+CALLV
+pop
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $347
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_OspColorFromString
+CALLV
+pop
+ADDRGP4 $348
+JUMPV
+LABELV $347
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $348
+LABELV $345
+ADDRLP4 12+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $342
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $351
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 120
+EQI4 $356
+ADDRLP4 64
+INDIRI4
+CNSTI4 88
+NEI4 $354
+LABELV $356
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $335
+JUMPV
+LABELV $354
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $335
+JUMPV
+LABELV $351
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $335
+JUMPV
+LABELV $337
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawChar
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $335
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $357
+ADDRLP4 8
+INDIRI4
+ADDRFP4 32
+INDIRI4
+LTI4 $334
+LABELV $357
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $277
+endproc CG_DrawStringExt 80 36
+export CG_DrawBigString
+proc CG_DrawBigString 28 40
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+CNSTI4 16
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $358
+endproc CG_DrawBigString 28 40
+export CG_DrawBigStringColor
+proc CG_DrawBigStringColor 8 40
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+CNSTI4 16
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $364
+endproc CG_DrawBigStringColor 8 40
+export CG_DrawSmallString
+proc CG_DrawSmallString 24 40
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+536976
+ARGP4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $367
+endproc CG_DrawSmallString 24 40
+export CG_DrawSmallStringColor
+proc CG_DrawSmallStringColor 4 40
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+536976
+ARGP4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $373
+endproc CG_DrawSmallStringColor 4 40
+export CG_DrawStrlen
+proc CG_DrawStrlen 36 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_testQlFont+12
+INDIRI4
+CNSTI4 0
+EQI4 $377
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1048576000
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+623648
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+RETF4
+ADDRGP4 $376
+JUMPV
+LABELV $377
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+ADDRGP4 cgs+632912+515308
+CVPU4 4
+EQU4 $393
+ADDRLP4 12
+INDIRU4
+ADDRGP4 cgs+632912+536976
+CVPU4 4
+EQU4 $393
+ADDRLP4 12
+INDIRU4
+ADDRGP4 cgs+632912+558644
+CVPU4 4
+EQU4 $393
+ADDRLP4 12
+INDIRU4
+ADDRGP4 cgs+632912+493640
+CVPU4 4
+EQU4 $393
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1048576000
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+RETF4
+ADDRGP4 $376
+JUMPV
+LABELV $392
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $395
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $395
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $395
+ADDRLP4 20
+INDIRI4
+CNSTI4 65
+LTI4 $398
+ADDRLP4 20
+INDIRI4
+CNSTI4 90
+LEI4 $397
+LABELV $398
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 97
+LTI4 $399
+ADDRLP4 24
+INDIRI4
+CNSTI4 122
+LEI4 $397
+LABELV $399
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 48
+LTI4 $395
+ADDRLP4 28
+INDIRI4
+CNSTI4 57
+GTI4 $395
+LABELV $397
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $400
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 120
+EQI4 $405
+ADDRLP4 32
+INDIRI4
+CNSTI4 88
+NEI4 $403
+LABELV $405
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $396
+JUMPV
+LABELV $403
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $396
+JUMPV
+LABELV $400
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $396
+LABELV $393
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $392
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+632912+493640
+CVPU4 4
+NEU4 $406
+ADDRLP4 8
+CNSTI4 32
+ASGNI4
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+632912+515308
+CVPU4 4
+NEU4 $410
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+632912+536976
+CVPU4 4
+NEU4 $414
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRGP4 $415
+JUMPV
+LABELV $414
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+632912+558644
+CVPU4 4
+NEU4 $418
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRGP4 $419
+JUMPV
+LABELV $418
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $419
+LABELV $415
+LABELV $411
+LABELV $407
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CVIF4 4
+RETF4
+LABELV $376
+endproc CG_DrawStrlen 36 16
+proc CG_TileClearBox 44 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $422
+endproc CG_TileClearBox 44 36
+export CG_TileClear
+proc CG_TileClear 56 20
+ADDRLP4 8
+ADDRGP4 cgs+20100+19496
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 cgs+20100+19500
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+609412
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $428
+ADDRGP4 cg+609412+4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $428
+ADDRGP4 cg+609412+8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $428
+ADDRGP4 cg+609412+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $428
+ADDRGP4 $423
+JUMPV
+LABELV $428
+ADDRLP4 0
+ADDRGP4 cg+609412+4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+609412+12
+INDIRI4
+ADDI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+609412
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+609412+8
+INDIRI4
+ADDI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+492128
+INDIRI4
+ARGI4
+ADDRGP4 CG_TileClearBox
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 cgs+632912+492128
+INDIRI4
+ARGI4
+ADDRGP4 CG_TileClearBox
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 cgs+632912+492128
+INDIRI4
+ARGI4
+ADDRGP4 CG_TileClearBox
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 cgs+632912+492128
+INDIRI4
+ARGI4
+ADDRGP4 CG_TileClearBox
+CALLV
+pop
+LABELV $423
+endproc CG_TileClear 56 20
+bss
+align 4
+LABELV $453
+skip 16
+export CG_FadeColor
+code
+proc CG_FadeColor 8 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $454
+CNSTP4 0
+RETP4
+ADDRGP4 $452
+JUMPV
+LABELV $454
+ADDRLP4 0
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $457
+CNSTP4 0
+RETP4
+ADDRGP4 $452
+JUMPV
+LABELV $457
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 200
+GEI4 $459
+ADDRGP4 $453+12
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRGP4 $453+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $460
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $453+8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $453+4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $453
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $453
+RETP4
+LABELV $452
+endproc CG_FadeColor 8 0
+bss
+align 4
+LABELV $466
+skip 16
+export CG_FadeColorRealTime
+code
+proc CG_FadeColorRealTime 8 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $467
+CNSTP4 0
+RETP4
+ADDRGP4 $465
+JUMPV
+LABELV $467
+ADDRLP4 0
+ADDRGP4 cg+607168
+INDIRI4
+ADDRFP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $470
+CNSTP4 0
+RETP4
+ADDRGP4 $465
+JUMPV
+LABELV $470
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 200
+GEI4 $472
+ADDRGP4 $466+12
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRGP4 $473
+JUMPV
+LABELV $472
+ADDRGP4 $466+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $473
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $466+8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $466+4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $466
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $466
+RETP4
+LABELV $465
+endproc CG_FadeColorRealTime 8 0
+export CG_FadeColorVec4
+proc CG_FadeColorVec4 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $479
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $478
+JUMPV
+LABELV $479
+ADDRLP4 0
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $482
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $478
+JUMPV
+LABELV $482
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ADDRFP4 12
+INDIRI4
+GEI4 $484
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $485
+JUMPV
+LABELV $484
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $485
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $478
+endproc CG_FadeColorVec4 12 0
+data
+align 4
+LABELV $487
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+align 4
+LABELV $488
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $489
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $490
+byte 4 1060320051
+byte 4 1060320051
+byte 4 1060320051
+byte 4 1065353216
+export CG_TeamColor
+code
+proc CG_TeamColor 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $493
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $494
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $495
+ADDRGP4 $491
+JUMPV
+LABELV $493
+ADDRGP4 $487
+RETP4
+ADDRGP4 $486
+JUMPV
+LABELV $494
+ADDRGP4 $488
+RETP4
+ADDRGP4 $486
+JUMPV
+LABELV $495
+ADDRGP4 $490
+RETP4
+ADDRGP4 $486
+JUMPV
+LABELV $491
+ADDRGP4 $489
+RETP4
+LABELV $486
+endproc CG_TeamColor 4 0
+export CG_GetColorForHealth
+proc CG_GetColorForHealth 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $497
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $496
+JUMPV
+LABELV $497
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1059648963
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1051595899
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GEI4 $499
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $499
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 100
+LTI4 $501
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRFP4 0
+INDIRI4
+CNSTI4 66
+GEI4 $503
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 66
+SUBI4
+CVIF4 4
+CNSTF4 1107558400
+DIVF4
+ASGNF4
+LABELV $504
+LABELV $502
+ADDRFP4 0
+INDIRI4
+CNSTI4 60
+LEI4 $505
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $506
+JUMPV
+LABELV $505
+ADDRFP4 0
+INDIRI4
+CNSTI4 30
+GEI4 $507
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 30
+SUBI4
+CVIF4 4
+CNSTF4 1106247680
+DIVF4
+ASGNF4
+LABELV $508
+LABELV $506
+LABELV $496
+endproc CG_GetColorForHealth 16 0
+export CG_ColorForHealth
+proc CG_ColorForHealth 8 12
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+CNSTI4 228
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 STAT_ARMOR
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+LABELV $509
+endproc CG_ColorForHealth 8 12
+data
+align 4
+LABELV propMap
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 8
+byte 4 11
+byte 4 122
+byte 4 7
+byte 4 154
+byte 4 181
+byte 4 14
+byte 4 55
+byte 4 122
+byte 4 17
+byte 4 79
+byte 4 122
+byte 4 18
+byte 4 101
+byte 4 122
+byte 4 23
+byte 4 153
+byte 4 122
+byte 4 18
+byte 4 9
+byte 4 93
+byte 4 7
+byte 4 207
+byte 4 122
+byte 4 8
+byte 4 230
+byte 4 122
+byte 4 9
+byte 4 177
+byte 4 122
+byte 4 18
+byte 4 30
+byte 4 152
+byte 4 18
+byte 4 85
+byte 4 181
+byte 4 7
+byte 4 34
+byte 4 93
+byte 4 11
+byte 4 110
+byte 4 181
+byte 4 6
+byte 4 130
+byte 4 152
+byte 4 14
+byte 4 22
+byte 4 64
+byte 4 17
+byte 4 41
+byte 4 64
+byte 4 12
+byte 4 58
+byte 4 64
+byte 4 17
+byte 4 78
+byte 4 64
+byte 4 18
+byte 4 98
+byte 4 64
+byte 4 19
+byte 4 120
+byte 4 64
+byte 4 18
+byte 4 141
+byte 4 64
+byte 4 18
+byte 4 204
+byte 4 64
+byte 4 16
+byte 4 162
+byte 4 64
+byte 4 17
+byte 4 182
+byte 4 64
+byte 4 18
+byte 4 59
+byte 4 181
+byte 4 7
+byte 4 35
+byte 4 181
+byte 4 7
+byte 4 203
+byte 4 152
+byte 4 14
+byte 4 56
+byte 4 93
+byte 4 14
+byte 4 228
+byte 4 152
+byte 4 14
+byte 4 177
+byte 4 181
+byte 4 18
+byte 4 28
+byte 4 122
+byte 4 22
+byte 4 5
+byte 4 4
+byte 4 18
+byte 4 27
+byte 4 4
+byte 4 18
+byte 4 48
+byte 4 4
+byte 4 18
+byte 4 69
+byte 4 4
+byte 4 17
+byte 4 90
+byte 4 4
+byte 4 13
+byte 4 106
+byte 4 4
+byte 4 13
+byte 4 121
+byte 4 4
+byte 4 18
+byte 4 143
+byte 4 4
+byte 4 17
+byte 4 164
+byte 4 4
+byte 4 8
+byte 4 175
+byte 4 4
+byte 4 16
+byte 4 195
+byte 4 4
+byte 4 18
+byte 4 216
+byte 4 4
+byte 4 12
+byte 4 230
+byte 4 4
+byte 4 23
+byte 4 6
+byte 4 34
+byte 4 18
+byte 4 27
+byte 4 34
+byte 4 18
+byte 4 48
+byte 4 34
+byte 4 18
+byte 4 68
+byte 4 34
+byte 4 18
+byte 4 90
+byte 4 34
+byte 4 17
+byte 4 110
+byte 4 34
+byte 4 18
+byte 4 130
+byte 4 34
+byte 4 14
+byte 4 146
+byte 4 34
+byte 4 18
+byte 4 166
+byte 4 34
+byte 4 19
+byte 4 185
+byte 4 34
+byte 4 29
+byte 4 215
+byte 4 34
+byte 4 18
+byte 4 234
+byte 4 34
+byte 4 18
+byte 4 5
+byte 4 64
+byte 4 14
+byte 4 60
+byte 4 152
+byte 4 7
+byte 4 106
+byte 4 151
+byte 4 13
+byte 4 83
+byte 4 152
+byte 4 7
+byte 4 128
+byte 4 122
+byte 4 17
+byte 4 4
+byte 4 152
+byte 4 21
+byte 4 134
+byte 4 181
+byte 4 5
+byte 4 5
+byte 4 4
+byte 4 18
+byte 4 27
+byte 4 4
+byte 4 18
+byte 4 48
+byte 4 4
+byte 4 18
+byte 4 69
+byte 4 4
+byte 4 17
+byte 4 90
+byte 4 4
+byte 4 13
+byte 4 106
+byte 4 4
+byte 4 13
+byte 4 121
+byte 4 4
+byte 4 18
+byte 4 143
+byte 4 4
+byte 4 17
+byte 4 164
+byte 4 4
+byte 4 8
+byte 4 175
+byte 4 4
+byte 4 16
+byte 4 195
+byte 4 4
+byte 4 18
+byte 4 216
+byte 4 4
+byte 4 12
+byte 4 230
+byte 4 4
+byte 4 23
+byte 4 6
+byte 4 34
+byte 4 18
+byte 4 27
+byte 4 34
+byte 4 18
+byte 4 48
+byte 4 34
+byte 4 18
+byte 4 68
+byte 4 34
+byte 4 18
+byte 4 90
+byte 4 34
+byte 4 17
+byte 4 110
+byte 4 34
+byte 4 18
+byte 4 130
+byte 4 34
+byte 4 14
+byte 4 146
+byte 4 34
+byte 4 18
+byte 4 166
+byte 4 34
+byte 4 19
+byte 4 185
+byte 4 34
+byte 4 29
+byte 4 215
+byte 4 34
+byte 4 18
+byte 4 234
+byte 4 34
+byte 4 18
+byte 4 5
+byte 4 64
+byte 4 14
+byte 4 153
+byte 4 152
+byte 4 13
+byte 4 11
+byte 4 181
+byte 4 5
+byte 4 180
+byte 4 152
+byte 4 13
+byte 4 79
+byte 4 93
+byte 4 17
+byte 4 0
+byte 4 0
+byte 4 -1
+code
+proc UI_ProportionalStringWidth 136 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $516
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $516
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $516
+ADDRLP4 32
+INDIRI4
+CNSTI4 65
+LTI4 $519
+ADDRLP4 32
+INDIRI4
+CNSTI4 90
+LEI4 $518
+LABELV $519
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 97
+LTI4 $520
+ADDRLP4 36
+INDIRI4
+CNSTI4 122
+LEI4 $518
+LABELV $520
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 48
+LTI4 $516
+ADDRLP4 40
+INDIRI4
+CNSTI4 57
+GTI4 $516
+LABELV $518
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $521
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 120
+EQI4 $526
+ADDRLP4 44
+INDIRI4
+CNSTI4 88
+NEI4 $524
+LABELV $526
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $514
+JUMPV
+LABELV $524
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $514
+JUMPV
+LABELV $521
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $514
+JUMPV
+LABELV $516
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 127
+GTI4 $527
+ADDRLP4 12
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 -1
+EQI4 $528
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+ADDRGP4 $528
+JUMPV
+LABELV $527
+ADDRGP4 cgs+632912+623648
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 trap_R_GetGlyphInfo
+CALLI4
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1066401792
+ADDRLP4 52+20
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $528
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $514
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $513
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $512
+endproc UI_ProportionalStringWidth 136 12
+proc UI_DrawProportionalString2 196 36
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 124
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 156
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $539
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $539
+ADDRLP4 164
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $539
+ADDRLP4 164
+INDIRI4
+CNSTI4 65
+LTI4 $542
+ADDRLP4 164
+INDIRI4
+CNSTI4 90
+LEI4 $541
+LABELV $542
+ADDRLP4 168
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 97
+LTI4 $543
+ADDRLP4 168
+INDIRI4
+CNSTI4 122
+LEI4 $541
+LABELV $543
+ADDRLP4 172
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 48
+LTI4 $539
+ADDRLP4 172
+INDIRI4
+CNSTI4 57
+GTI4 $539
+LABELV $541
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $544
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 120
+EQI4 $551
+ADDRLP4 176
+INDIRI4
+CNSTI4 88
+NEI4 $549
+LABELV $551
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $537
+JUMPV
+LABELV $549
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $537
+JUMPV
+LABELV $546
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $537
+JUMPV
+LABELV $544
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $552
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_CpmaColorFromString
+CALLV
+pop
+ADDRGP4 $553
+JUMPV
+LABELV $552
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $555
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_OspColorFromString
+CALLV
+pop
+ADDRGP4 $556
+JUMPV
+LABELV $555
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $556
+LABELV $553
+ADDRLP4 8+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 55
+NEI4 $559
+ADDRLP4 8
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $559
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $561
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 120
+EQI4 $566
+ADDRLP4 176
+INDIRI4
+CNSTI4 88
+NEI4 $564
+LABELV $566
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $537
+JUMPV
+LABELV $564
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $537
+JUMPV
+LABELV $561
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $537
+JUMPV
+LABELV $539
+ADDRLP4 144
+INDIRI4
+CNSTI4 127
+GTI4 $567
+ADDRLP4 4
+INDIRU1
+CVUI4 1
+CNSTI4 32
+NEI4 $567
+ADDRLP4 24
+CNSTF4 1090519040
+ADDRGP4 cgs+39664
+INDIRF4
+MULF4
+ADDRFP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $568
+JUMPV
+LABELV $567
+ADDRLP4 144
+INDIRI4
+CNSTI4 127
+GTI4 $570
+CNSTI4 12
+ADDRLP4 4
+INDIRU1
+CVUI4 1
+MULI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $570
+ADDRLP4 176
+CNSTI4 12
+ADDRLP4 4
+INDIRU1
+CVUI4 1
+MULI4
+ASGNI4
+ADDRLP4 180
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 120
+ADDRLP4 176
+INDIRI4
+ADDRGP4 propMap
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 180
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 176
+INDIRI4
+ADDRGP4 propMap+4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 180
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 176
+INDIRI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 180
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 136
+CNSTF4 1037565952
+ASGNF4
+ADDRLP4 24
+ADDRLP4 176
+INDIRI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRFP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 128
+CNSTF4 1104674816
+ADDRFP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $571
+JUMPV
+LABELV $570
+ADDRLP4 144
+INDIRI4
+CNSTI4 127
+LEI4 $576
+ADDRLP4 176
+CNSTF4 1066401792
+ADDRFP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cgs+632912+623648
+ARGP4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 trap_R_GetGlyphInfo
+CALLI4
+pop
+ADDRLP4 180
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 180
+INDIRF4
+CNSTF4 1103101952
+ADDRFP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32+16
+INDIRI4
+CVIF4 4
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 32+4
+INDIRI4
+CVIF4 4
+ADDRLP4 176
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 32+24
+INDIRI4
+CVIF4 4
+ADDRLP4 176
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 32+28
+INDIRI4
+CVIF4 4
+ADDRLP4 176
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 32+32
+INDIRF4
+ARGF4
+ADDRLP4 32+36
+INDIRF4
+ARGF4
+ADDRLP4 32+40
+INDIRF4
+ARGF4
+ADDRLP4 32+44
+INDIRF4
+ARGF4
+ADDRLP4 32+48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStretchPic
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 32+20
+INDIRI4
+CVIF4 4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $577
+JUMPV
+LABELV $576
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+LABELV $577
+LABELV $571
+LABELV $568
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1077936128
+ADDRFP4 20
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $537
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $536
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $535
+endproc UI_DrawProportionalString2 196 36
+proc UI_ProportionalSizeScale 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $591
+CNSTF4 1061158912
+RETF4
+ADDRGP4 $590
+JUMPV
+LABELV $591
+CNSTF4 1065353216
+RETF4
+LABELV $590
+endproc UI_ProportionalSizeScale 0 0
+export UI_DrawProportionalString
+proc UI_DrawProportionalString 52 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_ProportionalSizeScale
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $595
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $597
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $598
+ADDRGP4 $595
+JUMPV
+LABELV $597
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $595
+JUMPV
+LABELV $598
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $595
+ADDRFP4 12
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $600
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+LABELV $600
+ADDRFP4 12
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $606
+ADDRLP4 36
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1061997773
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRGP4 $593
+JUMPV
+LABELV $606
+ADDRFP4 12
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $612
+ADDRLP4 36
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1061997773
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1056964608
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRGP4 $593
+JUMPV
+LABELV $612
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+LABELV $593
+endproc UI_DrawProportionalString 52 28
+export UI_DrawProportionalString3
+proc UI_DrawProportionalString3 1196 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $626
+JUMPV
+ADDRGP4 $628
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $626
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ADDRGP4 UI_ProportionalSizeScale
+CALLF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 1064
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRLP4 1068
+CNSTI1 0
+ASGNI1
+ADDRLP4 1036
+ADDRLP4 1068
+INDIRI1
+ASGNI1
+ADDRLP4 8
+ADDRLP4 1068
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 8
+ASGNP4
+ADDRLP4 1060
+CNSTI4 1
+ASGNI4
+ADDRGP4 $630
+JUMPV
+LABELV $629
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $632
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $632
+ADDRLP4 1088
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+EQI4 $632
+ADDRLP4 1088
+INDIRI4
+CNSTI4 65
+LTI4 $635
+ADDRLP4 1088
+INDIRI4
+CNSTI4 90
+LEI4 $634
+LABELV $635
+ADDRLP4 1092
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 97
+LTI4 $636
+ADDRLP4 1092
+INDIRI4
+CNSTI4 122
+LEI4 $634
+LABELV $636
+ADDRLP4 1096
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 48
+LTI4 $632
+ADDRLP4 1096
+INDIRI4
+CNSTI4 57
+GTI4 $632
+LABELV $634
+ADDRLP4 1100
+CNSTI1 94
+ASGNI1
+ADDRLP4 1036
+ADDRLP4 1100
+INDIRI1
+ASGNI1
+ADDRLP4 4
+INDIRP4
+ADDRLP4 1100
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $637
+ADDRLP4 1104
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 120
+EQI4 $642
+ADDRLP4 1104
+INDIRI4
+CNSTI4 88
+NEI4 $640
+LABELV $642
+ADDRLP4 1036+1
+CNSTI1 120
+ASGNI1
+ADDRLP4 1036+2
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ARGP4
+CNSTU4 6
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 1036+8
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ARGP4
+CNSTU4 6
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $630
+JUMPV
+LABELV $640
+ADDRLP4 1036+1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 1036+2
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $630
+JUMPV
+LABELV $637
+ADDRLP4 1036+1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 1036+2
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $630
+JUMPV
+LABELV $632
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ARGP4
+ADDRLP4 1080
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+ASGNI4
+ADDRLP4 1076
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1072
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 1108
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 127
+GTI4 $650
+ADDRLP4 1056
+CNSTI4 12
+ADDRLP4 1052
+INDIRI4
+MULI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 -1
+EQI4 $651
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+ADDRGP4 $651
+JUMPV
+LABELV $650
+ADDRGP4 cgs+632912+623648
+ARGP4
+ADDRLP4 1076
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ARGP4
+ADDRGP4 trap_R_GetGlyphInfo
+CALLI4
+pop
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CVIF4 4
+CNSTF4 1066401792
+ADDRLP4 1112+20
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $651
+ADDRLP4 1032
+INDIRI4
+CVIF4 4
+ADDRLP4 1048
+INDIRF4
+MULF4
+CNSTF4 1142947840
+CNSTF4 1106247680
+ADDRLP4 1048
+INDIRF4
+MULF4
+SUBF4
+GEF4 $660
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+CNSTU4 1011
+LTU4 $658
+LABELV $660
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 1036
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 1116
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 1116
+INDIRU4
+ADDRLP4 8
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1060
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $658
+LABELV $630
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $629
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 1060
+INDIRI4
+RETI4
+LABELV $625
+endproc UI_DrawProportionalString3 1196 20
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_GetTeamColor
+import CG_RunMenuScript
+import CG_ShowResponseHead
+import CG_KeyEvent
+import CG_EventHandling
+import CG_MouseEvent
+import CG_OwnerDraw
+import CG_GetServerTimeFromClockString
+import CG_GetLevelTimerString
+import CG_GetCurrentTimeWithDirection
+import CG_DrawWeaponBar
+import CG_Text_Paint_Align
+import CG_Text_Paint_Limit_Bottom
+import CG_Text_Paint_Limit
+import CG_Text_Length
+import CG_GameTypeString
+import CG_GetGameStatusText
+import CG_GetKillerText
+import CG_OwnerDrawVisible
+import CG_YourTeamHasFlag
+import CG_OtherTeamHasFlag
+import CG_GetValue
+import CG_SelectPrevPlayer
+import CG_SelectNextPlayer
+import CG_CheckOrderPending
+import CG_SetPrintString
+import CG_InitTeamChat
+import MenuRect
+import QLWideScreen
+import MenuWidescreen
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $628
+byte 1 94
+byte 1 49
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 51
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $197
+byte 1 94
+byte 1 51
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $176
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 113
+byte 1 108
+byte 1 32
+byte 1 81
+byte 1 76
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
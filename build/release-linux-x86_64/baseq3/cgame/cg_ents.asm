@@ -0,0 +1,17241 @@
+export CG_PrintEntityStatep
+code
+proc CG_PrintEntityStatep 32 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $156
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $157
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $158
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $159
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $160
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $161
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $162
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $163
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $164
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $165
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $166
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $167
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $168
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $169
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $170
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $171
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $172
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $173
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $174
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $175
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $176
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $177
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $178
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $179
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $180
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $181
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $182
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $183
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $184
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $185
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $186
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $187
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $188
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $189
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $190
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $191
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $193
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $194
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $195
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $196
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $197
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $198
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $199
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $155
+endproc CG_PrintEntityStatep 32 16
+export CG_PrintEntityState
+proc CG_PrintEntityState 0 8
+ADDRGP4 $201
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1496
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_PrintEntityStatep
+CALLV
+pop
+LABELV $200
+endproc CG_PrintEntityState 0 8
+export CG_AllowedAmbientSound
+proc CG_AllowedAmbientSound 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $206
+JUMPV
+LABELV $203
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+1331600
+ADDP4
+INDIRI4
+NEI4 $208
+CNSTI4 1
+RETI4
+ADDRGP4 $202
+JUMPV
+LABELV $208
+LABELV $204
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $206
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+1332112
+INDIRI4
+LTI4 $203
+CNSTI4 0
+RETI4
+LABELV $202
+endproc CG_AllowedAmbientSound 4 0
+export CG_PositionEntityOnTag
+proc CG_PositionEntityOnTag 84 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LerpTag
+CALLI4
+pop
+ADDRLP4 56
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $212
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $213
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $212
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 60
+CNSTI4 28
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 64
+CNSTI4 100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $211
+endproc CG_PositionEntityOnTag 84 24
+export CG_PositionRotatedEntityOnTag
+proc CG_PositionRotatedEntityOnTag 120 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LerpTag
+CALLI4
+pop
+ADDRLP4 92
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $218
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $219
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $218
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 52
+ARGP4
+ADDRLP4 96
+CNSTI4 28
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+LABELV $217
+endproc CG_PositionRotatedEntityOnTag 120 24
+export CG_SetEntitySoundPosition
+proc CG_SetEntitySoundPosition 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $224
+ADDRLP4 12
+CNSTI4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+48440
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_S_UpdateEntityPosition
+CALLV
+pop
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 trap_S_UpdateEntityPosition
+CALLV
+pop
+LABELV $225
+LABELV $223
+endproc CG_SetEntitySoundPosition 24 8
+proc CG_EntityEffects 36 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetEntitySoundPosition
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRGP4 cg+1331596
+INDIRI4
+NEI4 $230
+ADDRGP4 cg_proxMineTick+12
+INDIRI4
+CNSTI4 0
+EQI4 $231
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddLoopingSound
+CALLV
+pop
+ADDRGP4 $231
+JUMPV
+LABELV $230
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $239
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+CNSTI4 1
+EQI4 $246
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $240
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_AllowedAmbientSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $240
+LABELV $246
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddLoopingSound
+CALLV
+pop
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+CNSTI4 1
+EQI4 $253
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $248
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_AllowedAmbientSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $248
+LABELV $253
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddRealLoopingSound
+CALLV
+pop
+LABELV $248
+LABELV $249
+LABELV $240
+LABELV $237
+LABELV $231
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $255
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 255
+ASGNI4
+ADDRLP4 32
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+CNSTI4 8
+RSHI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+CNSTI4 16
+RSHI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1082130432
+ADDRLP4 24
+INDIRI4
+CNSTI4 24
+RSHI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $255
+LABELV $229
+endproc CG_EntityEffects 36 20
+proc CG_DominationControlPoint 420 52
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $258
+ADDRLP4 276
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRLP4 276
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $259
+ADDRLP4 252
+CNSTI4 4524
+ADDRLP4 276
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 248
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 6
+GEI4 $264
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+LEI4 $264
+ADDRLP4 248
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1957824-4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $264
+ADDRLP4 188
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 268
+CNSTI4 0
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 252
+INDIRI4
+NEI4 $268
+ADDRGP4 cg_dominationPointTeamColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $270
+ADDRLP4 172
+ARGP4
+ADDRGP4 cg_dominationPointTeamColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 188
+ADDRGP4 cg_dominationPointTeamAlpha+12
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 268
+CNSTI4 1
+ASGNI4
+ADDRGP4 $269
+JUMPV
+LABELV $270
+ADDRLP4 184
+INDIRI4
+CNSTI4 1
+NEI4 $274
+ADDRLP4 172
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $269
+JUMPV
+LABELV $274
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+NEI4 $278
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $269
+JUMPV
+LABELV $278
+ADDRLP4 300
+CNSTF4 1059481190
+ASGNF4
+ADDRLP4 172
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1059481190
+ASGNF4
+ADDRGP4 $269
+JUMPV
+LABELV $268
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+LEI4 $284
+ADDRGP4 cg_dominationPointEnemyColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $286
+ADDRLP4 172
+ARGP4
+ADDRGP4 cg_dominationPointEnemyColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 188
+ADDRGP4 cg_dominationPointEnemyAlpha+12
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 268
+CNSTI4 1
+ASGNI4
+ADDRGP4 $285
+JUMPV
+LABELV $286
+ADDRLP4 184
+INDIRI4
+CNSTI4 1
+NEI4 $290
+ADDRLP4 172
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $285
+JUMPV
+LABELV $290
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+NEI4 $294
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $285
+JUMPV
+LABELV $294
+ADDRLP4 300
+CNSTF4 1059481190
+ASGNF4
+ADDRLP4 172
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1059481190
+ASGNF4
+ADDRGP4 $285
+JUMPV
+LABELV $284
+ADDRGP4 cg_dominationPointNeutralColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $300
+ADDRLP4 172
+ARGP4
+ADDRGP4 cg_dominationPointNeutralColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 188
+ADDRGP4 cg_dominationPointNeutralAlpha+12
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 268
+CNSTI4 1
+ASGNI4
+ADDRGP4 $301
+JUMPV
+LABELV $300
+ADDRLP4 184
+INDIRI4
+CNSTI4 1
+NEI4 $304
+ADDRLP4 172
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+NEI4 $308
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $309
+JUMPV
+LABELV $308
+ADDRLP4 300
+CNSTF4 1059481190
+ASGNF4
+ADDRLP4 172
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1059481190
+ASGNF4
+LABELV $309
+LABELV $305
+LABELV $301
+LABELV $285
+LABELV $269
+ADDRLP4 252
+INDIRI4
+CNSTI4 3
+EQI4 $314
+ADDRLP4 300
+CNSTI4 0
+ASGNI4
+ADDRLP4 288
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+ADDRLP4 300
+INDIRI4
+EQI4 $316
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $320
+ADDRLP4 184
+INDIRI4
+ADDRLP4 252
+INDIRI4
+EQI4 $318
+LABELV $320
+ADDRLP4 248
+INDIRI4
+CNSTI4 1
+LTI4 $317
+ADDRLP4 248
+INDIRI4
+CNSTI4 5
+GTI4 $317
+ADDRLP4 248
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $338-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $338
+address $323
+address $326
+address $329
+address $332
+address $335
+code
+LABELV $323
+ADDRLP4 288
+ADDRGP4 cgs+632912+212
+INDIRI4
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $326
+ADDRLP4 288
+ADDRGP4 cgs+632912+216
+INDIRI4
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $329
+ADDRLP4 288
+ADDRGP4 cgs+632912+220
+INDIRI4
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $332
+ADDRLP4 288
+ADDRGP4 cgs+632912+224
+INDIRI4
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $335
+ADDRLP4 288
+ADDRGP4 cgs+632912+228
+INDIRI4
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $318
+ADDRLP4 184
+INDIRI4
+ADDRLP4 252
+INDIRI4
+NEI4 $317
+ADDRLP4 248
+INDIRI4
+CNSTI4 1
+LTI4 $317
+ADDRLP4 248
+INDIRI4
+CNSTI4 5
+GTI4 $317
+ADDRLP4 248
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $359-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $359
+address $344
+address $347
+address $350
+address $353
+address $356
+code
+LABELV $344
+ADDRLP4 288
+ADDRGP4 cgs+632912+252
+INDIRI4
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $347
+ADDRLP4 288
+ADDRGP4 cgs+632912+256
+INDIRI4
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $350
+ADDRLP4 288
+ADDRGP4 cgs+632912+260
+INDIRI4
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $353
+ADDRLP4 288
+ADDRGP4 cgs+632912+264
+INDIRI4
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $356
+ADDRLP4 288
+ADDRGP4 cgs+632912+268
+INDIRI4
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $316
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $363
+ADDRLP4 184
+INDIRI4
+ADDRLP4 252
+INDIRI4
+EQI4 $361
+LABELV $363
+ADDRLP4 248
+INDIRI4
+CNSTI4 1
+LTI4 $362
+ADDRLP4 248
+INDIRI4
+CNSTI4 5
+GTI4 $362
+ADDRLP4 248
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $381-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $381
+address $366
+address $369
+address $372
+address $375
+address $378
+code
+LABELV $366
+ADDRLP4 288
+ADDRGP4 cgs+632912+192
+INDIRI4
+ASGNI4
+ADDRGP4 $362
+JUMPV
+LABELV $369
+ADDRLP4 288
+ADDRGP4 cgs+632912+196
+INDIRI4
+ASGNI4
+ADDRGP4 $362
+JUMPV
+LABELV $372
+ADDRLP4 288
+ADDRGP4 cgs+632912+200
+INDIRI4
+ASGNI4
+ADDRGP4 $362
+JUMPV
+LABELV $375
+ADDRLP4 288
+ADDRGP4 cgs+632912+204
+INDIRI4
+ASGNI4
+ADDRGP4 $362
+JUMPV
+LABELV $378
+ADDRLP4 288
+ADDRGP4 cgs+632912+208
+INDIRI4
+ASGNI4
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRLP4 184
+INDIRI4
+ADDRLP4 252
+INDIRI4
+NEI4 $383
+ADDRLP4 248
+INDIRI4
+CNSTI4 1
+LTI4 $386
+ADDRLP4 248
+INDIRI4
+CNSTI4 5
+GTI4 $386
+ADDRLP4 248
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $402-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $402
+address $387
+address $390
+address $393
+address $396
+address $399
+code
+LABELV $387
+ADDRLP4 288
+ADDRGP4 cgs+632912+232
+INDIRI4
+ASGNI4
+ADDRGP4 $386
+JUMPV
+LABELV $390
+ADDRLP4 288
+ADDRGP4 cgs+632912+236
+INDIRI4
+ASGNI4
+ADDRGP4 $386
+JUMPV
+LABELV $393
+ADDRLP4 288
+ADDRGP4 cgs+632912+240
+INDIRI4
+ASGNI4
+ADDRGP4 $386
+JUMPV
+LABELV $396
+ADDRLP4 288
+ADDRGP4 cgs+632912+244
+INDIRI4
+ASGNI4
+ADDRGP4 $386
+JUMPV
+LABELV $399
+ADDRLP4 288
+ADDRGP4 cgs+632912+248
+INDIRI4
+ASGNI4
+LABELV $386
+LABELV $383
+LABELV $362
+LABELV $317
+ADDRLP4 304
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LEI4 $404
+ADDRGP4 cg_helpIcon+12
+INDIRI4
+ADDRLP4 304
+INDIRI4
+EQI4 $404
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1117782016
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+112
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $413
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $417
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $418
+JUMPV
+LABELV $417
+ADDRLP4 0+4
+CNSTI4 8
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $423
+ADDRLP4 320
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $424
+JUMPV
+LABELV $423
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $427
+ADDRLP4 320
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRGP4 $428
+JUMPV
+LABELV $427
+ADDRLP4 320
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+LABELV $428
+LABELV $424
+ADDRLP4 308
+ADDRGP4 cg_helpIconMinWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 316
+ADDRGP4 cg_helpIconMaxWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 336
+ADDRLP4 316
+INDIRF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 336
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 312
+CNSTF4 1128792064
+ADDRLP4 336
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+CNSTF4 1036831949
+LEF4 $435
+ADDRLP4 312
+ADDRLP4 312
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 308
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $435
+ADDRLP4 0+132
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRLP4 340
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 340
+INDIRF4
+ADDRLP4 312
+INDIRF4
+LEF4 $438
+ADDRLP4 308
+INDIRF4
+CNSTF4 1036831949
+LEF4 $438
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRLP4 344
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 0+132
+ADDRLP4 332
+INDIRF4
+ADDRLP4 344
+INDIRF4
+ADDRLP4 312
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $438
+LABELV $418
+LABELV $414
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRLP4 0+132
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 316
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 312
+INDIRF4
+ADDRLP4 316
+INDIRF4
+LTF4 $448
+ADDRLP4 308
+ADDRLP4 312
+INDIRF4
+ADDRLP4 316
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 308
+ADDRLP4 312
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $449
+ADDRLP4 0+116
+ADDRLP4 308
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 324
+CNSTF4 1132396544
+ADDRLP4 172+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 328
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 324
+INDIRF4
+ADDRLP4 328
+INDIRF4
+LTF4 $454
+ADDRLP4 320
+ADDRLP4 324
+INDIRF4
+ADDRLP4 328
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $455
+JUMPV
+LABELV $454
+ADDRLP4 320
+ADDRLP4 324
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $455
+ADDRLP4 0+116+1
+ADDRLP4 320
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 336
+CNSTF4 1132396544
+ADDRLP4 172+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 340
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 336
+INDIRF4
+ADDRLP4 340
+INDIRF4
+LTF4 $460
+ADDRLP4 332
+ADDRLP4 336
+INDIRF4
+ADDRLP4 340
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $461
+JUMPV
+LABELV $460
+ADDRLP4 332
+ADDRLP4 336
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $461
+ADDRLP4 0+116+2
+ADDRLP4 332
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 348
+CNSTF4 1132396544
+ADDRLP4 188
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 352
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 348
+INDIRF4
+ADDRLP4 352
+INDIRF4
+LTF4 $465
+ADDRLP4 344
+ADDRLP4 348
+INDIRF4
+ADDRLP4 352
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $466
+JUMPV
+LABELV $465
+ADDRLP4 344
+ADDRLP4 348
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $466
+ADDRLP4 0+116+3
+ADDRLP4 344
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $404
+LABELV $405
+LABELV $314
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 256+8
+ADDRLP4 256+8
+INDIRF4
+CNSTF4 1148846080
+SUBF4
+ASGNF4
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 300
+CNSTP4 0
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 304
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 304
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 172+4
+INDIRF4
+ARGF4
+ADDRLP4 172+8
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRLP4 280
+CNSTF4 1124073472
+ASGNF4
+ADDRGP4 $472
+ARGP4
+ADDRLP4 308
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+NEI4 $470
+ADDRGP4 cgs+632912+188
+INDIRI4
+ARGI4
+ADDRLP4 192+12
+ARGP4
+ADDRLP4 192+24
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 172+4
+INDIRF4
+ARGF4
+ADDRLP4 172+8
+INDIRF4
+ARGF4
+ADDRLP4 188
+INDIRF4
+ARGF4
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+ADDRLP4 312
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRF4
+ARGF4
+ADDRLP4 312
+INDIRI4
+ARGI4
+ADDRLP4 316
+CNSTI4 0
+ASGNI4
+ADDRLP4 316
+INDIRI4
+ARGI4
+ADDRLP4 316
+INDIRI4
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $470
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+12
+ADDRLP4 192+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRLP4 192+12
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+172
+INDIRI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $487
+ADDRLP4 0+108
+ADDRGP4 cgs+632912+184
+INDIRI4
+ASGNI4
+ADDRGP4 $488
+JUMPV
+LABELV $487
+ADDRLP4 184
+INDIRI4
+CNSTI4 1
+NEI4 $492
+ADDRLP4 0+108
+ADDRGP4 cgs+632912+176
+INDIRI4
+ASGNI4
+ADDRGP4 $493
+JUMPV
+LABELV $492
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+NEI4 $497
+ADDRLP4 0+108
+ADDRGP4 cgs+632912+180
+INDIRI4
+ASGNI4
+ADDRGP4 $498
+JUMPV
+LABELV $497
+ADDRLP4 0+108
+ADDRGP4 cgs+632912+184
+INDIRI4
+ASGNI4
+LABELV $498
+LABELV $493
+LABELV $488
+ADDRLP4 316
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 320
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+LTF4 $507
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $508
+ADDRLP4 0+116
+ADDRLP4 312
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 328
+CNSTF4 1132396544
+ADDRLP4 172+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 332
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+LTF4 $513
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $514
+ADDRLP4 0+116+1
+ADDRLP4 324
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 340
+CNSTF4 1132396544
+ADDRLP4 172+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 344
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 340
+INDIRF4
+ADDRLP4 344
+INDIRF4
+LTF4 $519
+ADDRLP4 336
+ADDRLP4 340
+INDIRF4
+ADDRLP4 344
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $520
+JUMPV
+LABELV $519
+ADDRLP4 336
+ADDRLP4 340
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $520
+ADDRLP4 0+116+2
+ADDRLP4 336
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 352
+CNSTF4 1132396544
+ADDRLP4 188
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 356
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+LTF4 $524
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $525
+JUMPV
+LABELV $524
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $525
+ADDRLP4 0+116+3
+ADDRLP4 348
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+CNSTF4 925353388
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1000593162
+ADDF4
+ASGNF4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 1000
+ADDI4
+CVIF4 4
+ADDRLP4 272
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 364
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 368
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ADDRLP4 368
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 364
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRGP4 cg+609316
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609328
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 0+64
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+45364
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 376
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 380
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 376
+INDIRF4
+ADDRLP4 380
+INDIRF4
+LTF4 $538
+ADDRLP4 372
+ADDRLP4 376
+INDIRF4
+ADDRLP4 380
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $539
+JUMPV
+LABELV $538
+ADDRLP4 372
+ADDRLP4 376
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $539
+ADDRLP4 0+116
+ADDRLP4 372
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 388
+CNSTF4 1132396544
+ADDRLP4 172+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 392
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 388
+INDIRF4
+ADDRLP4 392
+INDIRF4
+LTF4 $544
+ADDRLP4 384
+ADDRLP4 388
+INDIRF4
+ADDRLP4 392
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $545
+JUMPV
+LABELV $544
+ADDRLP4 384
+ADDRLP4 388
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $545
+ADDRLP4 0+116+1
+ADDRLP4 384
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 400
+CNSTF4 1132396544
+ADDRLP4 172+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 404
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 400
+INDIRF4
+ADDRLP4 404
+INDIRF4
+LTF4 $550
+ADDRLP4 396
+ADDRLP4 400
+INDIRF4
+ADDRLP4 404
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRLP4 396
+ADDRLP4 400
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $551
+ADDRLP4 0+116+2
+ADDRLP4 396
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 412
+CNSTF4 1132396544
+ADDRLP4 188
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 416
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 416
+INDIRF4
+LTF4 $555
+ADDRLP4 408
+ADDRLP4 412
+INDIRF4
+ADDRLP4 416
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $556
+JUMPV
+LABELV $555
+ADDRLP4 408
+ADDRLP4 412
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $556
+ADDRLP4 0+116+3
+ADDRLP4 408
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $257
+endproc CG_DominationControlPoint 420 52
+proc CG_DrawRaceFlagBase 312 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 184+8
+ADDRLP4 184+8
+INDIRF4
+CNSTF4 1148846080
+SUBF4
+ASGNF4
+ADDRLP4 196
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 260
+CNSTP4 0
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 184
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+12
+ADDRLP4 196+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRLP4 196+12
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+172
+INDIRI4
+ASGNI4
+ADDRLP4 252
+CNSTF4 1061997773
+ASGNF4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $567
+ADDRLP4 256
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $568
+JUMPV
+LABELV $567
+ADDRLP4 256
+ADDRGP4 cg+607704+900+200
+INDIRI4
+ASGNI4
+LABELV $568
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cgs+1957804
+INDIRI4
+NEI4 $575
+ADDRLP4 172
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+108
+ADDRGP4 cgs+632912+176
+INDIRI4
+ASGNI4
+ADDRGP4 $576
+JUMPV
+LABELV $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cgs+1957800
+INDIRI4
+NEI4 $583
+ADDRLP4 264
+CNSTF4 1059481190
+ASGNF4
+ADDRLP4 172
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1059481190
+ASGNF4
+ADDRLP4 0+108
+ADDRGP4 cgs+632912+184
+INDIRI4
+ASGNI4
+ADDRGP4 $584
+JUMPV
+LABELV $583
+ADDRLP4 256
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $591
+ADDRLP4 172
+CNSTF4 1044952121
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1064682127
+ASGNF4
+ADDRLP4 0+108
+ADDRGP4 cgs+632912+180
+INDIRI4
+ASGNI4
+ADDRGP4 $592
+JUMPV
+LABELV $591
+ADDRLP4 264
+CNSTF4 1059481190
+ASGNF4
+ADDRLP4 172
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1059481190
+ASGNF4
+ADDRLP4 0+108
+ADDRGP4 cgs+632912+184
+INDIRI4
+ASGNI4
+LABELV $592
+LABELV $584
+LABELV $576
+ADDRLP4 268
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+LTF4 $605
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $606
+JUMPV
+LABELV $605
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $606
+ADDRLP4 0+116
+ADDRLP4 264
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 280
+CNSTF4 1132396544
+ADDRLP4 172+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 284
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+LTF4 $611
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $612
+JUMPV
+LABELV $611
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $612
+ADDRLP4 0+116+1
+ADDRLP4 276
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 292
+CNSTF4 1132396544
+ADDRLP4 172+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LTF4 $617
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $618
+JUMPV
+LABELV $617
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $618
+ADDRLP4 0+116+2
+ADDRLP4 288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 304
+CNSTF4 1132396544
+ADDRLP4 252
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 308
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+LTF4 $622
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $623
+JUMPV
+LABELV $622
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $623
+ADDRLP4 0+116+3
+ADDRLP4 300
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $557
+endproc CG_DrawRaceFlagBase 312 28
+proc CG_DrawRaceHelpIcon 256 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+EQI4 $625
+ADDRGP4 $624
+JUMPV
+LABELV $625
+ADDRLP4 196
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $632
+ADDRGP4 cg_helpIcon+12
+INDIRI4
+ADDRLP4 196
+INDIRI4
+NEI4 $628
+LABELV $632
+ADDRGP4 $624
+JUMPV
+LABELV $628
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $633
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $633
+ADDRGP4 $624
+JUMPV
+LABELV $633
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $636
+ADDRGP4 cg_freecam_useTeamSettings+12
+INDIRI4
+ADDRLP4 200
+INDIRI4
+NEI4 $636
+ADDRGP4 $624
+JUMPV
+LABELV $636
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $640
+ADDRLP4 188
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $641
+JUMPV
+LABELV $640
+ADDRLP4 188
+ADDRGP4 cg+607704+900+200
+INDIRI4
+ASGNI4
+LABELV $641
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+LEI4 $648
+ADDRLP4 188
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+EQI4 $648
+ADDRGP4 $624
+JUMPV
+LABELV $648
+ADDRLP4 192
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1117782016
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $653
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cgs+1957800
+INDIRI4
+EQI4 $653
+ADDRGP4 $624
+JUMPV
+LABELV $653
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cgs+1957800
+INDIRI4
+NEI4 $656
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 1064682127
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+288
+INDIRI4
+ASGNI4
+ADDRGP4 $657
+JUMPV
+LABELV $656
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cgs+1957804
+INDIRI4
+NEI4 $664
+ADDRLP4 172
+CNSTF4 1064682127
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+296
+INDIRI4
+ASGNI4
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRLP4 172
+CNSTF4 1044952121
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1064682127
+ASGNF4
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+292
+INDIRI4
+ASGNI4
+LABELV $665
+LABELV $657
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $678
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $679
+JUMPV
+LABELV $678
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $682
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $683
+JUMPV
+LABELV $682
+ADDRLP4 0+4
+CNSTI4 8
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $688
+ADDRLP4 220
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $692
+ADDRLP4 220
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRGP4 $693
+JUMPV
+LABELV $692
+ADDRLP4 220
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+LABELV $693
+LABELV $689
+ADDRLP4 208
+ADDRGP4 cg_helpIconMinWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 216
+ADDRGP4 cg_helpIconMaxWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 236
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1128792064
+ADDRLP4 236
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+CNSTF4 1036831949
+LEF4 $700
+ADDRLP4 212
+ADDRLP4 212
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 208
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $700
+ADDRLP4 0+132
+ADDRLP4 232
+INDIRF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRLP4 240
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LEF4 $703
+ADDRLP4 208
+INDIRF4
+CNSTF4 1036831949
+LEF4 $703
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRLP4 244
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 0+132
+ADDRLP4 232
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 212
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $703
+LABELV $683
+LABELV $679
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRLP4 0+132
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 216
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+LTF4 $713
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $714
+JUMPV
+LABELV $713
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $714
+ADDRLP4 0+116
+ADDRLP4 208
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 224
+CNSTF4 1132396544
+ADDRLP4 172+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+LTF4 $719
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $720
+JUMPV
+LABELV $719
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $720
+ADDRLP4 0+116+1
+ADDRLP4 220
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 236
+CNSTF4 1132396544
+ADDRLP4 172+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 240
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 240
+INDIRF4
+LTF4 $725
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $726
+JUMPV
+LABELV $725
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $726
+ADDRLP4 0+116+2
+ADDRLP4 232
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 248
+CNSTF4 1132396544
+ADDRLP4 192
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 252
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 252
+INDIRF4
+LTF4 $730
+ADDRLP4 244
+ADDRLP4 248
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRLP4 244
+ADDRLP4 248
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $731
+ADDRLP4 0+116+3
+ADDRLP4 244
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $624
+endproc CG_DrawRaceHelpIcon 256 12
+proc CG_General 200 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $733
+ADDRGP4 $732
+JUMPV
+LABELV $733
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+NEI4 $735
+ADDRLP4 172
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cgs+1957812
+INDIRI4
+NEI4 $735
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DominationControlPoint
+CALLV
+pop
+ADDRGP4 $732
+JUMPV
+LABELV $735
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+80
+ADDRLP4 172
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 0+80
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 172
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+45364
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $747
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $747
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $752
+ADDRLP4 180
+ADDRLP4 172
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRGP4 cgs+1957800
+INDIRI4
+EQI4 $761
+ADDRLP4 180
+INDIRI4
+ADDRGP4 cgs+1957804
+INDIRI4
+EQI4 $761
+ADDRLP4 180
+INDIRI4
+ADDRGP4 cgs+1957808
+INDIRI4
+NEI4 $755
+LABELV $761
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawRaceFlagBase
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawRaceHelpIcon
+CALLV
+pop
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $762
+ADDRGP4 cg_freecam_useTeamSettings+12
+INDIRI4
+ADDRLP4 188
+INDIRI4
+NEI4 $762
+ADDRGP4 $732
+JUMPV
+LABELV $762
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $766
+ADDRLP4 184
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $767
+JUMPV
+LABELV $766
+ADDRLP4 184
+ADDRGP4 cg+607704+900+200
+INDIRI4
+ASGNI4
+LABELV $767
+ADDRLP4 172
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cgs+1957800
+INDIRI4
+NEI4 $774
+ADDRGP4 $775
+JUMPV
+LABELV $774
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $777
+ADDRGP4 $778
+JUMPV
+LABELV $777
+ADDRLP4 184
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+EQI4 $779
+ADDRLP4 172
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cgs+1957800
+INDIRI4
+EQI4 $779
+ADDRGP4 $732
+JUMPV
+LABELV $779
+ADDRLP4 172
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cgs+1957808
+INDIRI4
+NEI4 $782
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+1317472
+INDIRI4
+ASGNI4
+LABELV $782
+LABELV $778
+LABELV $775
+ADDRLP4 176
+CNSTF4 925353388
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1000593162
+ADDF4
+ASGNF4
+ADDRGP4 cg_itemFx+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $788
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 1000
+ADDI4
+CVIF4 4
+ADDRLP4 176
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 192
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 192
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDF4
+ADDF4
+ASGNF4
+LABELV $788
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg_itemFx+12
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $794
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRGP4 cg+609316
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609328
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRGP4 $795
+JUMPV
+LABELV $794
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $795
+ADDRLP4 0+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_itemsWh+12
+INDIRI4
+CNSTI4 0
+EQI4 $802
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $802
+LABELV $755
+LABELV $752
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $732
+endproc CG_General 200 12
+proc CG_Speaker 24 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $807
+ADDRGP4 $806
+JUMPV
+LABELV $807
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+INDIRI4
+GEI4 $809
+ADDRGP4 $806
+JUMPV
+LABELV $809
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+CNSTI4 1
+EQI4 $819
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+CNSTI4 3
+EQI4 $819
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $812
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_AllowedAmbientSound
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $812
+LABELV $819
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $812
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+CVIF4 4
+CNSTF4 1073741824
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $806
+endproc CG_Speaker 24 16
+proc CG_DrawFlagHelpIcon 256 12
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $823
+ADDRGP4 $822
+JUMPV
+LABELV $823
+ADDRLP4 204
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+ADDRLP4 204
+INDIRI4
+EQI4 $830
+ADDRGP4 cg_helpIcon+12
+INDIRI4
+ADDRLP4 204
+INDIRI4
+NEI4 $826
+LABELV $830
+ADDRGP4 $822
+JUMPV
+LABELV $826
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $831
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $831
+ADDRGP4 $822
+JUMPV
+LABELV $831
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $835
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $835
+ADDRGP4 $822
+JUMPV
+LABELV $835
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $838
+ADDRLP4 192
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $839
+JUMPV
+LABELV $838
+ADDRLP4 192
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $839
+ADDRLP4 200
+CNSTI4 4524
+ADDRLP4 192
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRLP4 196
+CNSTF4 1132396544
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+NEI4 $844
+ADDRLP4 172
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $848
+ADDRLP4 200
+INDIRI4
+CNSTI4 1
+NEI4 $851
+ADDRGP4 cgs+43276
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $853
+ADDRGP4 $822
+JUMPV
+LABELV $853
+ADDRLP4 188
+ADDRGP4 cgs+632912+284
+INDIRI4
+ASGNI4
+ADDRGP4 $845
+JUMPV
+LABELV $851
+ADDRGP4 cgs+43276
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $858
+ADDRGP4 $822
+JUMPV
+LABELV $858
+ADDRLP4 188
+ADDRGP4 cgs+632912+276
+INDIRI4
+ASGNI4
+ADDRGP4 $845
+JUMPV
+LABELV $848
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+NEI4 $845
+ADDRLP4 200
+INDIRI4
+CNSTI4 1
+NEI4 $866
+ADDRLP4 188
+ADDRGP4 cgs+632912+284
+INDIRI4
+ASGNI4
+ADDRGP4 $845
+JUMPV
+LABELV $866
+ADDRLP4 188
+ADDRGP4 cgs+632912+280
+INDIRI4
+ASGNI4
+ADDRGP4 $845
+JUMPV
+LABELV $844
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+NEI4 $872
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $876
+ADDRLP4 200
+INDIRI4
+CNSTI4 1
+NEI4 $879
+ADDRGP4 cgs+43276
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+EQI4 $881
+ADDRGP4 $822
+JUMPV
+LABELV $881
+ADDRLP4 188
+ADDRGP4 cgs+632912+276
+INDIRI4
+ASGNI4
+ADDRGP4 $873
+JUMPV
+LABELV $879
+ADDRGP4 cgs+43276
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+EQI4 $886
+ADDRGP4 $822
+JUMPV
+LABELV $886
+ADDRLP4 188
+ADDRGP4 cgs+632912+284
+INDIRI4
+ASGNI4
+ADDRGP4 $873
+JUMPV
+LABELV $876
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+NEI4 $873
+ADDRLP4 200
+INDIRI4
+CNSTI4 2
+NEI4 $894
+ADDRLP4 188
+ADDRGP4 cgs+632912+284
+INDIRI4
+ASGNI4
+ADDRGP4 $873
+JUMPV
+LABELV $894
+ADDRLP4 188
+ADDRGP4 cgs+632912+280
+INDIRI4
+ASGNI4
+ADDRGP4 $873
+JUMPV
+LABELV $872
+ADDRLP4 208
+CNSTF4 1059481190
+ASGNF4
+ADDRLP4 172
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1059481190
+ASGNF4
+LABELV $873
+LABELV $845
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1117782016
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+112
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $907
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $908
+JUMPV
+LABELV $907
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $911
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $912
+JUMPV
+LABELV $911
+ADDRLP4 0+4
+CNSTI4 8
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $917
+ADDRLP4 220
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $918
+JUMPV
+LABELV $917
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $921
+ADDRLP4 220
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRGP4 $922
+JUMPV
+LABELV $921
+ADDRLP4 220
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+LABELV $922
+LABELV $918
+ADDRLP4 208
+ADDRGP4 cg_helpIconMinWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 216
+ADDRGP4 cg_helpIconMaxWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 236
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1128792064
+ADDRLP4 236
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+CNSTF4 1036831949
+LEF4 $929
+ADDRLP4 212
+ADDRLP4 212
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 208
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $929
+ADDRLP4 0+132
+ADDRLP4 232
+INDIRF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRLP4 240
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LEF4 $932
+ADDRLP4 208
+INDIRF4
+CNSTF4 1036831949
+LEF4 $932
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRLP4 244
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 0+132
+ADDRLP4 232
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 212
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $932
+LABELV $912
+LABELV $908
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRLP4 0+132
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 216
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+LTF4 $942
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $943
+JUMPV
+LABELV $942
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $943
+ADDRLP4 0+116
+ADDRLP4 208
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 224
+CNSTF4 1132396544
+ADDRLP4 172+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+LTF4 $948
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $949
+JUMPV
+LABELV $948
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $949
+ADDRLP4 0+116+1
+ADDRLP4 220
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 236
+CNSTF4 1132396544
+ADDRLP4 172+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 240
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 240
+INDIRF4
+LTF4 $954
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $955
+JUMPV
+LABELV $954
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $955
+ADDRLP4 0+116+2
+ADDRLP4 232
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 248
+CNSTF4 1132396544
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 252
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 252
+INDIRF4
+LTF4 $959
+ADDRLP4 244
+ADDRLP4 248
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $960
+JUMPV
+LABELV $959
+ADDRLP4 244
+ADDRLP4 248
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $960
+ADDRLP4 0+116+3
+ADDRLP4 244
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $822
+endproc CG_DrawFlagHelpIcon 256 12
+proc CG_TieredArmorAvailability 60 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_drawTieredArmorAvailability+12
+INDIRI4
+CNSTI4 0
+NEI4 $963
+ADDRGP4 $961
+JUMPV
+LABELV $963
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $966
+ADDRGP4 $961
+JUMPV
+LABELV $966
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $968
+ADDRGP4 $961
+JUMPV
+LABELV $968
+ADDRGP4 cgs+1969988
+INDIRI4
+CNSTI4 0
+NEI4 $971
+ADDRGP4 $961
+JUMPV
+LABELV $971
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $974
+ADDRGP4 $961
+JUMPV
+LABELV $974
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+ADDRGP4 cgs+1969984
+INDIRP4
+CVPU4 4
+EQU4 $977
+ADDRLP4 12
+INDIRU4
+ADDRGP4 cgs+1969980
+INDIRP4
+CVPU4 4
+EQU4 $977
+ADDRLP4 12
+INDIRU4
+ADDRGP4 cgs+1969976
+INDIRP4
+CVPU4 4
+EQU4 $977
+ADDRGP4 $961
+JUMPV
+LABELV $977
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 20
+CNSTI4 228
+ASGNI4
+ADDRLP4 8
+ADDRGP4 STAT_ARMOR
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 STAT_ARMOR_TIER
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $984
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $984
+ADDRGP4 $961
+JUMPV
+LABELV $984
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $995
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $988
+ADDRGP4 $987
+JUMPV
+LABELV $988
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+1969980
+INDIRP4
+CVPU4 4
+NEU4 $989
+ADDRLP4 8
+INDIRI4
+CNSTI4 132
+LEI4 $989
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $987
+JUMPV
+LABELV $989
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+1969984
+INDIRP4
+CVPU4 4
+NEU4 $987
+ADDRLP4 8
+INDIRI4
+CNSTI4 66
+LEI4 $987
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $987
+JUMPV
+LABELV $995
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+1969984
+INDIRP4
+CVPU4 4
+NEU4 $987
+ADDRLP4 8
+INDIRI4
+CNSTI4 75
+LEI4 $987
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $987
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $999
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $1001
+ADDRLP4 44
+ADDRGP4 cg+1332224+20
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44+4
+ADDRGP4 cg+1332224+20+4
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44+8
+ADDRGP4 cg+1332224+20+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $1002
+JUMPV
+LABELV $1001
+ADDRLP4 44
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44+4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44+8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1002
+ADDRLP4 44
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 56
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 44+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+8
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1107296256
+ADDRLP4 44+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+8
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRGP4 cgs+632912+344
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 CG_FloatSprite
+CALLV
+pop
+LABELV $999
+LABELV $961
+endproc CG_TieredArmorAvailability 60 20
+proc CG_DrawTimerPie 260 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $1033
+ADDRGP4 $1032
+JUMPV
+LABELV $1033
+ADDRGP4 cg_itemTimers+12
+INDIRI4
+CNSTI4 0
+NEI4 $1036
+ADDRGP4 $1032
+JUMPV
+LABELV $1036
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1039
+ADDRGP4 $1032
+JUMPV
+LABELV $1039
+ADDRLP4 188
+CNSTI4 52
+ADDRLP4 192
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRLP4 192
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDRLP4 208
+INDIRI4
+LEI4 $1043
+ADDRLP4 192
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ADDRLP4 208
+INDIRI4
+GTI4 $1041
+LABELV $1043
+ADDRGP4 $1032
+JUMPV
+LABELV $1041
+ADDRLP4 216
+ADDRLP4 188
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 220
+CNSTI4 5
+ASGNI4
+ADDRLP4 216
+INDIRI4
+ADDRLP4 220
+INDIRI4
+EQI4 $1044
+ADDRLP4 216
+INDIRI4
+CNSTI4 3
+NEI4 $1046
+ADDRLP4 188
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 220
+INDIRI4
+GTI4 $1044
+LABELV $1046
+ADDRLP4 188
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1047
+ADDRLP4 188
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $1044
+LABELV $1047
+ADDRLP4 188
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1048
+ADDRLP4 188
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1044
+LABELV $1048
+ADDRGP4 $1032
+JUMPV
+LABELV $1044
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+132
+CNSTF4 1080033280
+ADDRGP4 cg_itemTimersScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+132
+INDIRF4
+CNSTF4 0
+GEF4 $1052
+ADDRGP4 $1032
+JUMPV
+LABELV $1052
+ADDRGP4 cg_itemTimers+12
+INDIRI4
+CNSTI4 2
+NEI4 $1055
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $1055
+ADDRLP4 0+112
+CNSTI4 24
+ADDRLP4 192
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+ADDRGP4 cg_itemTimersAlpha+12
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_itemTimersOffset+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+132
+CNSTF4 1096810496
+ADDRGP4 cg_itemTimersScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+132
+INDIRF4
+CNSTF4 0
+GEF4 $1075
+ADDRGP4 $1032
+JUMPV
+LABELV $1075
+ADDRGP4 cg_itemTimers+12
+INDIRI4
+CNSTI4 2
+NEI4 $1078
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $1078
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+ADDRGP4 cg_itemTimersAlpha+12
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_itemTimersOffset+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 192
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 232
+CNSTI4 5
+ASGNI4
+ADDRLP4 184
+ADDRLP4 200
+INDIRI4
+CNSTI4 1000
+DIVI4
+ADDRLP4 232
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 232
+INDIRI4
+GEI4 $1093
+ADDRLP4 176
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+1317440
+INDIRI4
+ASGNI4
+ADDRLP4 196
+ADDRGP4 cgs+632912+1317444
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 200
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 150
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 50
+ASGNU1
+ADDRLP4 0+116+3
+ADDRGP4 cg_itemTimersAlpha+12
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRGP4 $1094
+JUMPV
+LABELV $1093
+ADDRLP4 184
+INDIRI4
+CNSTI4 5
+NEI4 $1108
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+1317408
+INDIRI4
+ASGNI4
+ADDRLP4 196
+ADDRGP4 cgs+632912+1317412
+INDIRI4
+ASGNI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1108
+ADDRLP4 184
+INDIRI4
+CNSTI4 5
+LEI4 $1115
+ADDRLP4 184
+INDIRI4
+CNSTI4 7
+GTI4 $1115
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+1317416
+INDIRI4
+ASGNI4
+ADDRLP4 196
+ADDRGP4 cgs+632912+1317420
+INDIRI4
+ASGNI4
+ADDRGP4 $1116
+JUMPV
+LABELV $1115
+ADDRLP4 184
+INDIRI4
+CNSTI4 7
+LEI4 $1122
+ADDRLP4 184
+INDIRI4
+CNSTI4 12
+GTI4 $1122
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+1317424
+INDIRI4
+ASGNI4
+ADDRLP4 196
+ADDRGP4 cgs+632912+1317428
+INDIRI4
+ASGNI4
+ADDRGP4 $1123
+JUMPV
+LABELV $1122
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+1317432
+INDIRI4
+ASGNI4
+ADDRLP4 196
+ADDRGP4 cgs+632912+1317436
+INDIRI4
+ASGNI4
+LABELV $1123
+LABELV $1116
+LABELV $1109
+LABELV $1094
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 192
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+SUBI4
+SUBI4
+CVIF4 4
+ADDRLP4 200
+INDIRI4
+CVIF4 4
+DIVF4
+ADDRLP4 176
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 252
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 252
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+136
+CNSTI4 360
+ADDRLP4 176
+INDIRI4
+DIVI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 2
+DIVI4
+MULI4
+CVIF4 4
+ASGNF4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1139
+JUMPV
+LABELV $1136
+ADDRLP4 172
+INDIRI4
+ADDRLP4 180
+INDIRI4
+NEI4 $1140
+ADDRLP4 184
+INDIRI4
+CNSTI4 5
+GEI4 $1142
+ADDRLP4 0+116+2
+CNSTU1 200
+ASGNU1
+LABELV $1142
+ADDRLP4 0+112
+ADDRLP4 196
+INDIRI4
+ASGNI4
+LABELV $1140
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 172
+INDIRI4
+ADDRLP4 180
+INDIRI4
+NEI4 $1147
+ADDRGP4 $1138
+JUMPV
+LABELV $1147
+ADDRLP4 0+136
+ADDRLP4 0+136
+INDIRF4
+CNSTI4 360
+ADDRLP4 176
+INDIRI4
+DIVI4
+CVIF4 4
+SUBF4
+ASGNF4
+LABELV $1137
+ADDRLP4 172
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1139
+ADDRLP4 172
+INDIRI4
+ADDRLP4 176
+INDIRI4
+LTI4 $1136
+LABELV $1138
+LABELV $1032
+endproc CG_DrawTimerPie 260 12
+proc CG_DrawPowerupRespawnPOI 236 12
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $1151
+ADDRGP4 $1150
+JUMPV
+LABELV $1151
+ADDRGP4 cg_drawPowerupRespawn+12
+INDIRI4
+CNSTI4 0
+NEI4 $1154
+ADDRGP4 $1150
+JUMPV
+LABELV $1154
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1157
+ADDRGP4 $1150
+JUMPV
+LABELV $1157
+ADDRLP4 208
+CNSTI4 52
+ADDRLP4 172
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 216
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDRLP4 216
+INDIRI4
+LEI4 $1161
+ADDRLP4 172
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ADDRLP4 216
+INDIRI4
+GTI4 $1159
+LABELV $1161
+ADDRGP4 $1150
+JUMPV
+LABELV $1159
+ADDRLP4 208
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $1162
+ADDRGP4 $1150
+JUMPV
+LABELV $1162
+ADDRLP4 188
+ADDRLP4 172
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+GTI4 $1165
+ADDRGP4 $1150
+JUMPV
+LABELV $1165
+ADDRLP4 188
+INDIRI4
+CNSTI4 10000
+LEI4 $1167
+ADDRGP4 $1150
+JUMPV
+LABELV $1167
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+132
+CNSTF4 1096810496
+ADDRGP4 cg_drawPowerupRespawnScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+132
+INDIRF4
+CNSTF4 0
+GEF4 $1172
+ADDRGP4 $1150
+JUMPV
+LABELV $1172
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1175
+ADDRLP4 192
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $1176
+JUMPV
+LABELV $1175
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $1179
+ADDRLP4 192
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRGP4 $1180
+JUMPV
+LABELV $1179
+ADDRLP4 192
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+LABELV $1180
+LABELV $1176
+ADDRLP4 220
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 176
+ADDRLP4 220
+INDIRF4
+ADDRGP4 cg_drawPowerupRespawnScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 220
+INDIRF4
+ADDRGP4 cg_drawPowerupRespawnScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 204
+ADDRLP4 180
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 184
+CNSTF4 1128792064
+ADDRLP4 180
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1036831949
+LEF4 $1187
+ADDRLP4 184
+ADDRLP4 184
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 176
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $1187
+ADDRLP4 0+132
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 228
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 228
+INDIRF4
+ADDRLP4 184
+INDIRF4
+LEF4 $1190
+ADDRLP4 176
+INDIRF4
+CNSTF4 1036831949
+LEF4 $1190
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 232
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 0+132
+ADDRLP4 204
+INDIRF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 184
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $1190
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+1317448
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+ADDRGP4 cg_drawPowerupRespawnAlpha+12
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_drawPowerupRespawnOffset+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1150
+endproc CG_DrawPowerupRespawnPOI 236 12
+proc CG_DrawPowerupAvailable 260 12
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $1211
+ADDRGP4 $1210
+JUMPV
+LABELV $1211
+ADDRGP4 cg_drawPowerupAvailable+12
+INDIRI4
+CNSTI4 0
+NEI4 $1214
+ADDRGP4 $1210
+JUMPV
+LABELV $1214
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1217
+ADDRGP4 $1210
+JUMPV
+LABELV $1217
+ADDRLP4 176
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1219
+ADDRGP4 $1210
+JUMPV
+LABELV $1219
+ADDRLP4 180
+CNSTI4 52
+ADDRLP4 176
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $1221
+ADDRGP4 $1210
+JUMPV
+LABELV $1221
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+132
+CNSTF4 1096810496
+ADDRGP4 cg_drawPowerupAvailableScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+132
+INDIRF4
+CNSTF4 0
+GEF4 $1226
+ADDRGP4 $1210
+JUMPV
+LABELV $1226
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1229
+ADDRLP4 184
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $1230
+JUMPV
+LABELV $1229
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $1233
+ADDRLP4 184
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRGP4 $1234
+JUMPV
+LABELV $1233
+ADDRLP4 184
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+LABELV $1234
+LABELV $1230
+ADDRLP4 228
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 196
+ADDRLP4 228
+INDIRF4
+ADDRGP4 cg_drawPowerupAvailableScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 228
+INDIRF4
+ADDRGP4 cg_drawPowerupAvailableScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 200
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1128792064
+ADDRLP4 200
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 196
+INDIRF4
+CNSTF4 1036831949
+LEF4 $1241
+ADDRLP4 172
+ADDRLP4 172
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 196
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $1241
+ADDRLP4 0+132
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRLP4 236
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 172
+INDIRF4
+LEF4 $1244
+ADDRLP4 196
+INDIRF4
+CNSTF4 1036831949
+LEF4 $1244
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRLP4 240
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 0+132
+ADDRLP4 208
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $1244
+ADDRLP4 204
+ADDRGP4 cg_drawPowerupAvailableFadeStart+8
+INDIRF4
+ASGNF4
+ADDRLP4 212
+ADDRGP4 cg_drawPowerupAvailableFadeEnd+8
+INDIRF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRLP4 240
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 212
+INDIRF4
+GEF4 $1252
+ADDRGP4 $1210
+JUMPV
+LABELV $1252
+ADDRLP4 172
+INDIRF4
+ADDRLP4 204
+INDIRF4
+GEF4 $1254
+ADDRLP4 220
+ADDRLP4 204
+INDIRF4
+ADDRLP4 212
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 220
+INDIRF4
+CNSTF4 0
+LEF4 $1256
+ADDRLP4 224
+ADDRLP4 204
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+ADDRLP4 220
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $1257
+JUMPV
+LABELV $1256
+ADDRLP4 224
+CNSTF4 0
+ASGNF4
+LABELV $1257
+ADDRLP4 248
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 252
+ADDRLP4 248
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 224
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 256
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+LTF4 $1261
+ADDRLP4 244
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1262
+JUMPV
+LABELV $1261
+ADDRLP4 244
+ADDRLP4 252
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1262
+ADDRLP4 0+116+3
+ADDRLP4 244
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $1255
+JUMPV
+LABELV $1254
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1255
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 180
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_QUAD
+INDIRI4
+NEI4 $1266
+ADDRLP4 216
+ADDRGP4 cgs+632912+1317456
+INDIRI4
+ASGNI4
+ADDRGP4 $1267
+JUMPV
+LABELV $1266
+ADDRLP4 180
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+NEI4 $1270
+ADDRLP4 216
+ADDRGP4 cgs+632912+1317468
+INDIRI4
+ASGNI4
+ADDRGP4 $1271
+JUMPV
+LABELV $1270
+ADDRLP4 180
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_HASTE
+INDIRI4
+NEI4 $1274
+ADDRLP4 216
+ADDRGP4 cgs+632912+1317464
+INDIRI4
+ASGNI4
+ADDRGP4 $1275
+JUMPV
+LABELV $1274
+ADDRLP4 180
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_INVIS
+INDIRI4
+NEI4 $1278
+ADDRLP4 216
+ADDRGP4 cgs+632912+1317460
+INDIRI4
+ASGNI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1278
+ADDRLP4 180
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REGEN
+INDIRI4
+NEI4 $1282
+ADDRLP4 216
+ADDRGP4 cgs+632912+1317452
+INDIRI4
+ASGNI4
+ADDRGP4 $1283
+JUMPV
+LABELV $1282
+ADDRLP4 180
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_FLIGHT
+INDIRI4
+NEI4 $1210
+ADDRGP4 $1210
+JUMPV
+LABELV $1283
+LABELV $1279
+LABELV $1275
+LABELV $1271
+LABELV $1267
+ADDRLP4 0+112
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 248
+ADDRLP4 0+116+3
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRGP4 cg_drawPowerupAvailableAlpha+8
+INDIRF4
+CNSTF4 1132396544
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 252
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 252
+INDIRF4
+LTF4 $1298
+ADDRLP4 244
+ADDRLP4 248
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1299
+JUMPV
+LABELV $1298
+ADDRLP4 244
+ADDRLP4 248
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1299
+ADDRLP4 0+116+3
+ADDRLP4 244
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_drawPowerupAvailableOffset+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1210
+endproc CG_DrawPowerupAvailable 260 12
+proc CG_Item 428 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $1304
+ADDRGP4 $1306
+ARGP4
+ADDRLP4 184
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1304
+ADDRLP4 184
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1307
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawTimerPie
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawPowerupRespawnPOI
+CALLV
+pop
+ADDRGP4 $1308
+JUMPV
+LABELV $1307
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawPowerupAvailable
+CALLV
+pop
+LABELV $1308
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+ADDRLP4 184
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $1311
+ADDRLP4 184
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+ADDRLP4 200
+INDIRI4
+EQI4 $1309
+LABELV $1311
+ADDRGP4 $1303
+JUMPV
+LABELV $1309
+ADDRLP4 172
+CNSTI4 52
+ADDRLP4 184
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $1312
+ADDRLP4 204
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+EQI4 $1317
+ADDRLP4 204
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+NEI4 $1315
+LABELV $1317
+ADDRGP4 $1303
+JUMPV
+LABELV $1315
+LABELV $1312
+ADDRGP4 cg_simpleItems+12
+INDIRI4
+CNSTI4 0
+EQI4 $1318
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $1318
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+132
+CNSTF4 1096810496
+ADDRGP4 cg_simpleItemsScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+132
+INDIRF4
+CNSTF4 0
+GEF4 $1324
+ADDRGP4 $1303
+JUMPV
+LABELV $1324
+ADDRGP4 cg_itemsWh+12
+INDIRI4
+CNSTI4 0
+EQI4 $1327
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $1327
+ADDRLP4 0+112
+CNSTI4 24
+ADDRLP4 184
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cg_simpleItemsBob+12
+INDIRI4
+CNSTI4 0
+EQI4 $1340
+ADDRLP4 192
+CNSTF4 925353388
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1000593162
+ADDF4
+ASGNF4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 1000
+ADDI4
+CVIF4 4
+ADDRLP4 192
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ADDRLP4 212
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 208
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1340
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_simpleItemsHeightOffset+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1303
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRGP4 CG_TieredArmorAvailability
+CALLV
+pop
+ADDRGP4 $1303
+JUMPV
+LABELV $1318
+ADDRLP4 192
+CNSTF4 925353388
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1000593162
+ADDF4
+ASGNF4
+ADDRGP4 cg_itemFx+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1351
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 1000
+ADDI4
+CVIF4 4
+ADDRLP4 192
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 208
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ADDRLP4 208
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 204
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDF4
+ADDF4
+ASGNF4
+LABELV $1351
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_itemFx+12
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1355
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1358
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRGP4 cg+609364
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609376
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRGP4 $1356
+JUMPV
+LABELV $1358
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRGP4 cg+609316
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609328
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRGP4 $1356
+JUMPV
+LABELV $1355
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $1356
+ADDRLP4 180
+CNSTP4 0
+ASGNP4
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1367
+ADDRLP4 180
+CNSTI4 132
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ADDRLP4 204
+INDIRP4
+INDIRF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ADDRLP4 212
+INDIRP4
+INDIRF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 220
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ADDRLP4 220
+INDIRP4
+INDIRF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 228
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ADDRLP4 228
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $1367
+ADDRLP4 0+8
+CNSTI4 24
+ADDRLP4 184
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1392
+ADDRLP4 208
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+EQI4 $1395
+ADDRLP4 208
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+EQI4 $1395
+ADDRLP4 208
+INDIRI4
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+NEI4 $1392
+LABELV $1395
+ADDRGP4 cg_flagStyle+12
+INDIRI4
+CNSTI4 3
+NEI4 $1396
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+EQI4 $1396
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1399
+ADDRLP4 216
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $1400
+JUMPV
+LABELV $1399
+ADDRLP4 216
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1400
+ADDRLP4 212
+CNSTI4 4524
+ADDRLP4 216
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 220
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 220
+INDIRI4
+EQI4 $1411
+ADDRGP4 cg_freecam_useTeamSettings+12
+INDIRI4
+ADDRLP4 220
+INDIRI4
+EQI4 $1410
+LABELV $1411
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $1405
+LABELV $1410
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+LABELV $1405
+ADDRLP4 224
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 1
+EQI4 $1414
+ADDRLP4 224
+INDIRI4
+CNSTI4 2
+NEI4 $1412
+LABELV $1414
+ADDRLP4 212
+INDIRI4
+CNSTI4 1
+NEI4 $1418
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+EQI4 $1417
+LABELV $1418
+ADDRLP4 212
+INDIRI4
+CNSTI4 2
+NEI4 $1415
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+NEI4 $1415
+LABELV $1417
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+60
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+ARGP4
+ADDRGP4 cg_teamFlagColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1397
+JUMPV
+LABELV $1415
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+60
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+ARGP4
+ADDRGP4 cg_enemyFlagColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1397
+JUMPV
+LABELV $1412
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+NEI4 $1431
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+48
+INDIRI4
+ASGNI4
+ADDRGP4 $1397
+JUMPV
+LABELV $1431
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+NEI4 $1436
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+52
+INDIRI4
+ASGNI4
+ADDRGP4 $1397
+JUMPV
+LABELV $1436
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+56
+INDIRI4
+ASGNI4
+ADDRGP4 $1397
+JUMPV
+LABELV $1396
+ADDRGP4 cg_flagStyle+12
+INDIRI4
+CNSTI4 3
+NEI4 $1444
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+NEI4 $1444
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+60
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+ARGP4
+ADDRGP4 cg_neutralFlagColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1445
+JUMPV
+LABELV $1444
+ADDRGP4 cg_flagStyle+12
+INDIRI4
+CNSTI4 0
+EQI4 $1453
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+NEI4 $1456
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+48
+INDIRI4
+ASGNI4
+ADDRGP4 $1454
+JUMPV
+LABELV $1456
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+NEI4 $1461
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+52
+INDIRI4
+ASGNI4
+ADDRGP4 $1454
+JUMPV
+LABELV $1461
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+56
+INDIRI4
+ASGNI4
+ADDRGP4 $1454
+JUMPV
+LABELV $1453
+ADDRLP4 0+8
+CNSTI4 24
+ADDRLP4 184
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1454
+LABELV $1445
+LABELV $1397
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawFlagHelpIcon
+CALLV
+pop
+LABELV $1392
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+64
+CNSTI4 0
+ASGNI4
+ADDRLP4 188
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 216
+CNSTI4 0
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 216
+INDIRI4
+LTI4 $1475
+ADDRLP4 188
+INDIRI4
+CNSTI4 1000
+GEI4 $1475
+ADDRGP4 cg_itemFx+12
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 216
+INDIRI4
+EQI4 $1475
+ADDRLP4 176
+ADDRLP4 188
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 176
+INDIRF4
+ADDRGP4 cg_itemSize+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1476
+JUMPV
+LABELV $1475
+ADDRLP4 176
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 176
+ADDRLP4 176
+INDIRF4
+ADDRGP4 cg_itemSize+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+64
+CNSTI4 1
+ASGNI4
+LABELV $1476
+ADDRLP4 220
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 1
+EQI4 $1568
+ADDRLP4 220
+INDIRI4
+CNSTI4 3
+NEI4 $1566
+LABELV $1568
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $1566
+ADDRGP4 cg_itemsWh+12
+INDIRI4
+CNSTI4 0
+EQI4 $1570
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $1570
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1574
+ADDRLP4 0+28
+CNSTF4 1069547520
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1069547520
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1069547520
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1069547520
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1069547520
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1069547520
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1069547520
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1069547520
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1069547520
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+64
+CNSTI4 1
+ASGNI4
+LABELV $1574
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1619
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $1624
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $1623
+LABELV $1624
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1619
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1619
+LABELV $1623
+ADDRLP4 0+28
+CNSTF4 1073741824
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1073741824
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1073741824
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1073741824
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1073741824
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1073741824
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1073741824
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1073741824
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1073741824
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+64
+CNSTI4 1
+ASGNI4
+LABELV $1619
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1668
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1668
+ADDRLP4 0+116
+ARGP4
+ADDRGP4 cg_railItemColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1668
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957788
+INDIRI4
+ADDRLP4 232
+INDIRI4
+EQI4 $1673
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 232
+INDIRI4
+EQI4 $1673
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+1317356
+INDIRI4
+ASGNI4
+LABELV $1673
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1680
+ADDRLP4 180
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1680
+ADDRLP4 180
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1680
+ADDRLP4 240
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 240+8
+ADDRLP4 180
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 240+12
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 240+24
+ADDRLP4 0+24
+INDIRF4
+ASGNF4
+ADDRLP4 240+4
+ADDRLP4 0+4
+INDIRI4
+ASGNI4
+ADDRLP4 412+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 424
+CNSTF4 0
+ASGNF4
+ADDRLP4 412
+ADDRLP4 424
+INDIRF4
+ASGNF4
+ADDRLP4 412+8
+ADDRLP4 424
+INDIRF4
+ASGNF4
+ADDRLP4 412
+ARGP4
+ADDRLP4 240+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 240
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 180
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1692
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 240+64
+ADDRLP4 0+64
+INDIRI4
+ASGNI4
+ADDRGP4 cg_itemsWh+12
+INDIRI4
+CNSTI4 0
+EQI4 $1695
+ADDRLP4 240+4
+ADDRLP4 240+4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $1695
+ADDRLP4 240
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1680
+ADDRGP4 cg_simpleItems+12
+INDIRI4
+CNSTI4 0
+NEI4 $1699
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+NEI4 $1703
+ADDRLP4 172
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_FLIGHT
+INDIRI4
+EQI4 $1699
+LABELV $1703
+ADDRLP4 252
+CNSTF4 0
+ASGNF4
+ADDRLP4 240+8
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRLP4 240+4
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRLP4 256
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 4
+EQI4 $1708
+ADDRLP4 256
+INDIRI4
+CNSTI4 5
+NEI4 $1706
+LABELV $1708
+ADDRLP4 260
+CNSTI4 24
+ADDRLP4 184
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $1709
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1714
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRLP4 240+4
+CNSTI4 360
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 1023
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 3296722944
+DIVF4
+ASGNF4
+LABELV $1714
+ADDRLP4 240
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 176
+INDIRF4
+CNSTF4 1065353216
+EQF4 $1721
+ADDRLP4 0+28
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+64
+CNSTI4 1
+ASGNI4
+LABELV $1721
+ADDRGP4 cg_itemsWh+12
+INDIRI4
+CNSTI4 0
+EQI4 $1766
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $1766
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1709
+LABELV $1706
+LABELV $1699
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1770
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRGP4 CG_TieredArmorAvailability
+CALLV
+pop
+LABELV $1770
+LABELV $1303
+endproc CG_Item 428 16
+proc CG_Missile 236 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1773
+ADDRGP4 $1772
+JUMPV
+LABELV $1773
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1776
+ADDRGP4 $1772
+JUMPV
+LABELV $1776
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $1778
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1778
+ADDRLP4 176
+CNSTI4 132
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1780
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+LABELV $1780
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 196632
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1782
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1785
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1787
+ADDRLP4 208
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1788
+JUMPV
+LABELV $1787
+ADDRLP4 208
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1788
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1789
+ADDRLP4 212
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+LTI4 $1789
+ADDRLP4 212
+INDIRI4
+CNSTI4 64
+GEI4 $1789
+CNSTI4 1496
+ADDRLP4 208
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 $1790
+JUMPV
+LABELV $1789
+ADDRGP4 ScriptVars+372
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+360
+CNSTI4 -2
+ASGNI4
+ADDRGP4 ScriptVars+356
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+364
+CNSTI4 1
+ASGNI4
+ADDRGP4 ScriptVars+368
+CNSTI4 0
+ASGNI4
+LABELV $1790
+LABELV $1785
+ADDRGP4 ScriptVars+84
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 ScriptVars+52
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 ScriptVars+60
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+108
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+644
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+668
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+656
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+680
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+680
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 4+28
+ARGP4
+ADDRLP4 208
+ADDRGP4 VectorNormalize2
+CALLF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+CNSTF4 0
+NEF4 $1808
+ADDRLP4 4+28+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $1808
+ADDRGP4 ScriptVars+120
+ADDRLP4 4+28
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+120+12
+ADDRLP4 4+28+12
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+120+24
+ADDRLP4 4+28+24
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+7772
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7788
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 196632
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+65560
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+LABELV $1782
+ADDRLP4 212
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 216
+CNSTI4 0
+ASGNI4
+CNSTI4 196632
+ADDRLP4 212
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+12
+ADDP4
+INDIRI4
+ADDRLP4 216
+INDIRI4
+EQI4 $1832
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 216
+INDIRI4
+EQI4 $1832
+ADDRLP4 212
+INDIRI4
+CNSTI4 10
+EQI4 $1832
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1835
+ADDRLP4 220
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+LTI4 $1839
+ADDRLP4 224
+INDIRI4
+CNSTI4 64
+LTI4 $1837
+LABELV $1839
+ADDRLP4 220
+CNSTI4 0
+ASGNI4
+LABELV $1837
+CNSTI4 1496
+ADDRLP4 220
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+LABELV $1835
+ADDRGP4 ScriptVars+60
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+108
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+84
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 ScriptVars+644
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+668
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+656
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+680
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+680
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 4+28
+ARGP4
+ADDRLP4 220
+ADDRGP4 VectorNormalize2
+CALLF4
+ASGNF4
+ADDRLP4 220
+INDIRF4
+CNSTF4 0
+NEF4 $1850
+ADDRLP4 4+28+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $1850
+ADDRGP4 ScriptVars+120
+ADDRLP4 4+28
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+120+12
+ADDRLP4 4+28+12
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+120+24
+ADDRLP4 4+28+24
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7772
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7788
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 224
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+316+12
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+316+8
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+316+4
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+316
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1876
+ADDRLP4 184
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1877
+ADDRGP4 EffectScripts+3965288
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1880
+ADDRFP4 0
+INDIRP4
+CNSTI4 884
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $1883
+ADDRGP4 ScriptVars+7772
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRLP4 180
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 ScriptVars+7788
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRLP4 180
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1883
+ADDRGP4 EffectScripts+3965288
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 $1877
+JUMPV
+LABELV $1880
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 $1877
+JUMPV
+LABELV $1876
+CNSTI4 196632
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+98328
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+LABELV $1877
+ADDRFP4 0
+INDIRP4
+CNSTI4 884
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRGP4 $1833
+JUMPV
+LABELV $1832
+ADDRLP4 176
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1900
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 884
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1900
+LABELV $1833
+CNSTI4 196632
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1902
+ADDRLP4 176
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1905
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 176
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 176
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 176
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1905
+LABELV $1902
+CNSTI4 196632
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1907
+ADDRLP4 176
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1910
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 220
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryDeltaf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRLP4 176
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddLoopingSound
+CALLV
+pop
+LABELV $1910
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1915
+ADDRLP4 4
+CNSTI4 5
+ASGNI4
+ADDRLP4 4+132
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 4+136
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+112
+ADDRGP4 cgs+632912+492148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 $1772
+JUMPV
+LABELV $1915
+ADDRLP4 4+104
+ADDRGP4 cg
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 4+8
+ADDRLP4 176
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4+4
+ADDRLP4 176
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1925
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1927
+ADDRLP4 188
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $1928
+JUMPV
+LABELV $1927
+ADDRLP4 188
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1928
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRI4
+NEI4 $1931
+ADDRLP4 4+116
+ARGP4
+ADDRGP4 cg_grenadeColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 4+116+3
+ADDRGP4 cg_grenadeColorAlpha+12
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRGP4 $1932
+JUMPV
+LABELV $1931
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $1937
+ADDRLP4 220
+CNSTI4 4524
+ASGNI4
+ADDRLP4 220
+INDIRI4
+ADDRLP4 188
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 220
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+NEI4 $1937
+ADDRLP4 4+116
+ARGP4
+ADDRGP4 cg_grenadeTeamColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 4+116+3
+ADDRGP4 cg_grenadeTeamColorAlpha+12
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRGP4 $1938
+JUMPV
+LABELV $1937
+ADDRLP4 4+116
+ARGP4
+ADDRGP4 cg_grenadeEnemyColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 4+116+3
+ADDRGP4 cg_grenadeEnemyColorAlpha+12
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $1938
+LABELV $1932
+LABELV $1925
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $1952
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1954
+ADDRLP4 4+8
+ADDRGP4 cgs+632912+492168
+INDIRI4
+ASGNI4
+LABELV $1954
+LABELV $1952
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 4+28
+ARGP4
+ADDRLP4 220
+ADDRGP4 VectorNormalize2
+CALLF4
+ASGNF4
+ADDRLP4 220
+INDIRF4
+CNSTF4 0
+NEF4 $1959
+ADDRLP4 4+28+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $1959
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1964
+ADDRLP4 4+28
+ARGP4
+ADDRLP4 180
+INDIRI4
+CNSTI4 4
+DIVI4
+CVIF4 4
+ARGF4
+ADDRGP4 RotateAroundDirection
+CALLV
+pop
+ADDRGP4 $1965
+JUMPV
+LABELV $1964
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $1967
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 4+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 $1968
+JUMPV
+LABELV $1967
+ADDRLP4 4+28
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 RotateAroundDirection
+CALLV
+pop
+LABELV $1968
+LABELV $1965
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+LABELV $1907
+LABELV $1772
+endproc CG_Missile 236 20
+proc CG_Grapple 184 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $1972
+ADDRLP4 172
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1972
+ADDRLP4 176
+CNSTI4 132
+ADDRLP4 172
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1974
+ADDRLP4 172
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+LABELV $1974
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRLP4 172
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRGP4 CG_GrappleTrail
+CALLV
+pop
+CNSTI4 196632
+ADDRLP4 172
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1976
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRGP4 ScriptVars+84
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 ScriptVars+52
+ADDRLP4 172
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 ScriptVars+60
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+108
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+644
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+668
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+656
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+680
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+680
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorNormalize2
+CALLF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 0
+NEF4 $1990
+ADDRLP4 0+28+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $1990
+ADDRGP4 ScriptVars+120
+ADDRLP4 0+28
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+120+12
+ADDRLP4 0+28+12
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+120+24
+ADDRLP4 0+28+24
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+7772
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7788
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 196632
+ADDRLP4 172
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+65560
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+ADDRGP4 $1971
+JUMPV
+LABELV $1976
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+104
+ADDRGP4 cg
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 176
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 176
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 172
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorNormalize2
+CALLF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 0
+NEF4 $2019
+ADDRLP4 0+28+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $2019
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1971
+endproc CG_Grapple 184 12
+proc CG_Mover 200 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0+104
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 6
+RSHI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 172
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $2032
+ADDRLP4 0+8
+ADDRLP4 172
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+47416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2033
+JUMPV
+LABELV $2032
+ADDRLP4 0+8
+ADDRLP4 172
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+45364
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2033
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 172
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2038
+ADDRLP4 0+104
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 172
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+45364
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2038
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 188
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ADDRLP4 176
+INDIRB
+ASGNB 12
+LABELV $2025
+endproc CG_Mover 200 12
+export CG_Beam
+proc CG_Beam 176 12
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRLP4 172
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRLP4 172
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2044
+endproc CG_Beam 176 12
+proc CG_Portal 188 16
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRLP4 172
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 172
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0+28+12
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 0+28+12
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 0+28+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 0+28+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 0+28+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 0+28+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+28+12
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRLP4 172
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+NEGF4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 0+28+12
+ARGP4
+ADDRLP4 0+28+24
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 12
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 172
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 172
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+104
+CNSTF4 1135869952
+ADDRLP4 172
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1132462080
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2049
+endproc CG_Portal 188 16
+export CG_AdjustPositionForMover
+proc CG_AdjustPositionForMover 100 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $2090
+ADDRFP4 4
+INDIRI4
+CNSTI4 1022
+LTI4 $2088
+LABELV $2090
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 28
+INDIRP4
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2087
+JUMPV
+LABELV $2088
+ADDRLP4 0
+CNSTI4 1496
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 80
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $2091
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 28
+INDIRP4
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2087
+JUMPV
+LABELV $2091
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 64
+ARGP4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 64
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 52+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 64+8
+INDIRF4
+ADDRLP4 52+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 28
+INDIRP4
+ADDRFP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+CNSTI4 4
+ASGNI4
+ADDRFP4 28
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+CNSTI4 8
+ASGNI4
+ADDRFP4 28
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2087
+endproc CG_AdjustPositionForMover 100 16
+proc CG_InterpolateEntityPosition 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $2110
+ADDRGP4 cg_useOriginalInterpolation+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $2110
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Wolfcam_InterpolateEntityPosition
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2114
+ADDRGP4 $2109
+JUMPV
+LABELV $2114
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $2116
+LABELV $2116
+ADDRFP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2110
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2119
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRGP4 $2109
+JUMPV
+LABELV $2119
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2123
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $2126
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRGP4 $2109
+JUMPV
+LABELV $2126
+ADDRGP4 $2131
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $2123
+ADDRLP4 24
+ADDRGP4 cg+607132
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ARGP4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 12+4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+LABELV $2109
+endproc CG_InterpolateEntityPosition 48 12
+proc CG_CalcEntityLerpPositions 108 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $2148
+ADDRGP4 cg_useOriginalInterpolation+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $2148
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2152
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $2152
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_InterpolateEntityPosition
+CALLV
+pop
+ADDRGP4 $2147
+JUMPV
+LABELV $2152
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $2155
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_InterpolateEntityPosition
+CALLV
+pop
+ADDRGP4 $2147
+JUMPV
+LABELV $2155
+LABELV $2148
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $2158
+LABELV $2158
+ADDRGP4 cg_smoothClients+12
+INDIRI4
+CNSTI4 0
+NEI4 $2161
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+GEI4 $2164
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2164
+LABELV $2161
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2166
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2166
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_InterpolateEntityPosition
+CALLV
+pop
+ADDRGP4 $2147
+JUMPV
+LABELV $2166
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2168
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2168
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+GEI4 $2168
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_InterpolateEntityPosition
+CALLV
+pop
+ADDRGP4 $2147
+JUMPV
+LABELV $2168
+ADDRGP4 cg_useOriginalInterpolation+12
+INDIRI4
+CNSTI4 0
+NEI4 $2170
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $2173
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2173
+ADDRGP4 $2174
+JUMPV
+LABELV $2173
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2176
+ADDRLP4 40
+CNSTI4 184
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2176
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2176
+ADDRGP4 $2177
+JUMPV
+LABELV $2176
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+GEI4 $2181
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_InterpolateEntityPosition
+CALLV
+pop
+ADDRGP4 $2147
+JUMPV
+LABELV $2181
+LABELV $2177
+LABELV $2174
+LABELV $2170
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+3196916
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16+8
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2192
+LABELV $2192
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+607704
+CVPU4 4
+EQU4 $2194
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRGP4 CG_AdjustPositionForMover
+CALLV
+pop
+LABELV $2194
+LABELV $2147
+endproc CG_CalcEntityLerpPositions 108 32
+proc CG_DrawHarversterHelpIcons 260 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+EQI4 $2201
+ADDRGP4 $2200
+JUMPV
+LABELV $2201
+ADDRLP4 204
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+ADDRLP4 204
+INDIRI4
+EQI4 $2208
+ADDRGP4 cg_helpIcon+12
+INDIRI4
+ADDRLP4 204
+INDIRI4
+NEI4 $2204
+LABELV $2208
+ADDRGP4 $2200
+JUMPV
+LABELV $2204
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 208
+INDIRI4
+EQI4 $2209
+ADDRGP4 cg_freecam_useTeamSettings+12
+INDIRI4
+ADDRLP4 208
+INDIRI4
+NEI4 $2209
+ADDRGP4 $2200
+JUMPV
+LABELV $2209
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2213
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $2213
+ADDRGP4 $2200
+JUMPV
+LABELV $2213
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2216
+ADDRLP4 188
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $2217
+JUMPV
+LABELV $2216
+ADDRLP4 188
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2217
+ADDRLP4 196
+CNSTI4 1496
+ADDRLP4 188
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 63
+BANDI4
+CNSTI4 0
+NEI4 $2220
+ADDRGP4 $2200
+JUMPV
+LABELV $2220
+ADDRLP4 192
+CNSTI4 4524
+ADDRLP4 188
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRLP4 192
+INDIRI4
+NEI4 $2224
+ADDRGP4 $2200
+JUMPV
+LABELV $2224
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2226
+ADDRLP4 172
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 200
+CNSTF4 1132396544
+ASGNF4
+ADDRGP4 $2227
+JUMPV
+LABELV $2226
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 200
+CNSTF4 1132396544
+ASGNF4
+LABELV $2227
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1117782016
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+272
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $2239
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $2240
+JUMPV
+LABELV $2239
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $2243
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $2244
+JUMPV
+LABELV $2243
+ADDRLP4 0+4
+CNSTI4 8
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2249
+ADDRLP4 224
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2250
+JUMPV
+LABELV $2249
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $2253
+ADDRLP4 224
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRGP4 $2254
+JUMPV
+LABELV $2253
+ADDRLP4 224
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+LABELV $2254
+LABELV $2250
+ADDRLP4 212
+ADDRGP4 cg_helpIconMinWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 220
+ADDRGP4 cg_helpIconMaxWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 220
+INDIRF4
+ASGNF4
+ADDRLP4 236
+ADDRLP4 240
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 216
+CNSTF4 1128792064
+ADDRLP4 240
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRF4
+CNSTF4 1036831949
+LEF4 $2261
+ADDRLP4 216
+ADDRLP4 216
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 212
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $2261
+ADDRLP4 0+132
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 224
+ARGP4
+ADDRLP4 244
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 216
+INDIRF4
+LEF4 $2264
+ADDRLP4 212
+INDIRF4
+CNSTF4 1036831949
+LEF4 $2264
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 224
+ARGP4
+ADDRLP4 248
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 0+132
+ADDRLP4 236
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 216
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $2264
+LABELV $2244
+LABELV $2240
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRLP4 0+132
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 216
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 220
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 220
+INDIRF4
+LTF4 $2274
+ADDRLP4 212
+ADDRLP4 216
+INDIRF4
+ADDRLP4 220
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2275
+JUMPV
+LABELV $2274
+ADDRLP4 212
+ADDRLP4 216
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2275
+ADDRLP4 0+116
+ADDRLP4 212
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 228
+CNSTF4 1132396544
+ADDRLP4 172+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 232
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 228
+INDIRF4
+ADDRLP4 232
+INDIRF4
+LTF4 $2280
+ADDRLP4 224
+ADDRLP4 228
+INDIRF4
+ADDRLP4 232
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2281
+JUMPV
+LABELV $2280
+ADDRLP4 224
+ADDRLP4 228
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2281
+ADDRLP4 0+116+1
+ADDRLP4 224
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 240
+CNSTF4 1132396544
+ADDRLP4 172+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 244
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 244
+INDIRF4
+LTF4 $2286
+ADDRLP4 236
+ADDRLP4 240
+INDIRF4
+ADDRLP4 244
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2287
+JUMPV
+LABELV $2286
+ADDRLP4 236
+ADDRLP4 240
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2287
+ADDRLP4 0+116+2
+ADDRLP4 236
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 252
+CNSTF4 1132396544
+ADDRLP4 200
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 256
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+LTF4 $2291
+ADDRLP4 248
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2292
+JUMPV
+LABELV $2291
+ADDRLP4 248
+ADDRLP4 252
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2292
+ADDRLP4 0+116+3
+ADDRLP4 248
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2200
+endproc CG_DrawHarversterHelpIcons 260 12
+proc CG_Draw1FctfHelpIcons 256 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $2294
+ADDRGP4 $2293
+JUMPV
+LABELV $2294
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $2301
+ADDRGP4 cg_helpIcon+12
+INDIRI4
+ADDRLP4 200
+INDIRI4
+NEI4 $2297
+LABELV $2301
+ADDRGP4 $2293
+JUMPV
+LABELV $2297
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2302
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $2302
+ADDRGP4 $2293
+JUMPV
+LABELV $2302
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2305
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 2
+EQI4 $2309
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 3
+NEI4 $2305
+LABELV $2309
+ADDRGP4 $2293
+JUMPV
+LABELV $2305
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2310
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 2
+EQI4 $2310
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 3
+EQI4 $2310
+ADDRGP4 $2293
+JUMPV
+LABELV $2310
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2314
+ADDRLP4 188
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2314
+ADDRLP4 188
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2315
+ADDRLP4 192
+CNSTI4 4524
+ADDRLP4 188
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 196
+CNSTF4 1132396544
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2320
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2321
+JUMPV
+LABELV $2320
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2324
+ADDRLP4 172
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 172+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2325
+JUMPV
+LABELV $2324
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 0
+EQI4 $2328
+ADDRGP4 $2293
+JUMPV
+LABELV $2328
+ADDRLP4 204
+CNSTF4 1059481190
+ASGNF4
+ADDRLP4 172
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 172+8
+CNSTF4 1059481190
+ASGNF4
+LABELV $2325
+LABELV $2321
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+EQI4 $2335
+ADDRLP4 204
+INDIRI4
+CNSTI4 2
+NEI4 $2333
+LABELV $2335
+ADDRLP4 188
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2336
+ADDRLP4 208
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 356
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2337
+JUMPV
+LABELV $2336
+ADDRLP4 208
+CNSTI4 1496
+ADDRLP4 188
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+LSHI4
+BANDI4
+ASGNI4
+LABELV $2337
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+NEI4 $2341
+ADDRGP4 $2293
+JUMPV
+LABELV $2341
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $2343
+ADDRGP4 cg_freecam_useTeamSettings+12
+INDIRI4
+CNSTI4 2
+EQI4 $2343
+ADDRGP4 $2293
+JUMPV
+LABELV $2343
+LABELV $2333
+ADDRLP4 192
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+NEI4 $2347
+ADDRGP4 $2293
+JUMPV
+LABELV $2347
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1117782016
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+280
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $2356
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $2357
+JUMPV
+LABELV $2356
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $2360
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $2361
+JUMPV
+LABELV $2360
+ADDRLP4 0+4
+CNSTI4 8
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2366
+ADDRLP4 220
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2367
+JUMPV
+LABELV $2366
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $2370
+ADDRLP4 220
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRGP4 $2371
+JUMPV
+LABELV $2370
+ADDRLP4 220
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+LABELV $2371
+LABELV $2367
+ADDRLP4 208
+ADDRGP4 cg_helpIconMinWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 216
+ADDRGP4 cg_helpIconMaxWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 236
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1128792064
+ADDRLP4 236
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+CNSTF4 1036831949
+LEF4 $2378
+ADDRLP4 212
+ADDRLP4 212
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 208
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $2378
+ADDRLP4 0+132
+ADDRLP4 232
+INDIRF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRLP4 240
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LEF4 $2381
+ADDRLP4 208
+INDIRF4
+CNSTF4 1036831949
+LEF4 $2381
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRLP4 244
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 0+132
+ADDRLP4 232
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 212
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $2381
+LABELV $2361
+LABELV $2357
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRLP4 0+132
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 216
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+LTF4 $2391
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2392
+JUMPV
+LABELV $2391
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2392
+ADDRLP4 0+116
+ADDRLP4 208
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 224
+CNSTF4 1132396544
+ADDRLP4 172+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+LTF4 $2397
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2398
+JUMPV
+LABELV $2397
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2398
+ADDRLP4 0+116+1
+ADDRLP4 220
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 236
+CNSTF4 1132396544
+ADDRLP4 172+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 240
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 240
+INDIRF4
+LTF4 $2403
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2404
+JUMPV
+LABELV $2403
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2404
+ADDRLP4 0+116+2
+ADDRLP4 232
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 248
+CNSTF4 1132396544
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 252
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 252
+INDIRF4
+LTF4 $2408
+ADDRLP4 244
+ADDRLP4 248
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2409
+JUMPV
+LABELV $2408
+ADDRLP4 244
+ADDRLP4 248
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2409
+ADDRLP4 0+116+3
+ADDRLP4 244
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2293
+endproc CG_Draw1FctfHelpIcons 256 12
+proc CG_TeamBase 248 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $2415
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $2411
+LABELV $2415
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2419
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+128
+INDIRI4
+ASGNI4
+ADDRGP4 $2420
+JUMPV
+LABELV $2419
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2424
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+132
+INDIRI4
+ASGNI4
+ADDRGP4 $2425
+JUMPV
+LABELV $2424
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+136
+INDIRI4
+ASGNI4
+LABELV $2425
+LABELV $2420
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 $2412
+JUMPV
+LABELV $2411
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 7
+NEI4 $2432
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2441
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 200
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 204
+INDIRF4
+LTF4 $2447
+ADDRLP4 196
+ADDRLP4 200
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2448
+JUMPV
+LABELV $2447
+ADDRLP4 196
+ADDRLP4 200
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2448
+ADDRLP4 0+116+1
+ADDRLP4 196
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 212
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 216
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+LTF4 $2452
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2453
+JUMPV
+LABELV $2452
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2453
+ADDRLP4 0+116+2
+ADDRLP4 208
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2441
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2459
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2461
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $2461
+ADDRLP4 180
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 176
+CNSTI4 1000
+ADDRGP4 cg_obeliskRespawnDelay+12
+INDIRI4
+MULI4
+CNSTI4 5000
+SUBI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 176
+INDIRI4
+LEI4 $2466
+ADDRLP4 196
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 180
+INDIRI4
+ADDRLP4 196
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 196
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2467
+ADDRLP4 172
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2467
+JUMPV
+LABELV $2466
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+LABELV $2467
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 200
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 204
+INDIRF4
+LTF4 $2473
+ADDRLP4 196
+ADDRLP4 200
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2474
+JUMPV
+LABELV $2473
+ADDRLP4 196
+ADDRLP4 200
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2474
+ADDRLP4 0+116
+ADDRLP4 196
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 212
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 216
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+LTF4 $2478
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2479
+JUMPV
+LABELV $2478
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2479
+ADDRLP4 0+116+1
+ADDRLP4 208
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 224
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+LTF4 $2483
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2484
+JUMPV
+LABELV $2483
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2484
+ADDRLP4 0+116+2
+ADDRLP4 220
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 236
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 240
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 240
+INDIRF4
+LTF4 $2488
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2489
+JUMPV
+LABELV $2488
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2489
+ADDRLP4 0+116+3
+ADDRLP4 232
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 180
+INDIRI4
+ADDRLP4 176
+INDIRI4
+LEI4 $2433
+ADDRFP4 0
+INDIRP4
+CNSTI4 1088
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2495
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+632912+492916
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1088
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2495
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+CNSTF4 1065353216
+ADDRLP4 172
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 244
+ADDRGP4 acos
+CALLI4
+ASGNI4
+ADDRLP4 184+4
+ADDRLP4 184+4
+INDIRF4
+CNSTF4 1127481344
+CNSTF4 1098907648
+ADDRLP4 244
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 184
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+28
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 $2433
+JUMPV
+LABELV $2459
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1088
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 200
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 204
+INDIRF4
+LTF4 $2559
+ADDRLP4 196
+ADDRLP4 200
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2560
+JUMPV
+LABELV $2559
+ADDRLP4 196
+ADDRLP4 200
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2560
+ADDRLP4 0+116+1
+ADDRLP4 196
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 212
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 216
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+LTF4 $2564
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2565
+JUMPV
+LABELV $2564
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2565
+ADDRLP4 0+116+2
+ADDRLP4 208
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 $2433
+JUMPV
+LABELV $2432
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+EQI4 $2580
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2576
+LABELV $2580
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 196
+INDIRI4
+CNSTI4 1
+NEI4 $2584
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+156
+INDIRI4
+ASGNI4
+ADDRLP4 0+108
+ADDRGP4 cgs+632912+160
+INDIRI4
+ASGNI4
+ADDRGP4 $2585
+JUMPV
+LABELV $2584
+ADDRLP4 196
+INDIRI4
+CNSTI4 2
+NEI4 $2592
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+156
+INDIRI4
+ASGNI4
+ADDRLP4 0+108
+ADDRGP4 cgs+632912+164
+INDIRI4
+ASGNI4
+ADDRGP4 $2593
+JUMPV
+LABELV $2592
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2600
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+136
+INDIRI4
+ASGNI4
+ADDRGP4 $2601
+JUMPV
+LABELV $2600
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+168
+INDIRI4
+ASGNI4
+LABELV $2601
+ADDRLP4 0+108
+CNSTI4 0
+ASGNI4
+LABELV $2593
+LABELV $2585
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawHarversterHelpIcons
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Draw1FctfHelpIcons
+CALLV
+pop
+LABELV $2576
+LABELV $2433
+LABELV $2412
+LABELV $2410
+endproc CG_TeamBase 248 16
+proc CG_AddCEntity 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LTI4 $2611
+ADDRGP4 $2610
+JUMPV
+LABELV $2611
+ADDRGP4 cg+1335116
+INDIRI4
+CNSTI4 0
+EQI4 $2613
+LABELV $2613
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+607704
+CVPU4 4
+NEU4 $2616
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2617
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+607704
+ARGP4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+3883048
+ADDP4
+ARGP4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $2617
+JUMPV
+LABELV $2616
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1496
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2627
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1496
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3883048
+ADDP4
+ARGP4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $2627
+LABELV $2617
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2631
+ADDRFP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CalcEntityLerpPositions
+CALLV
+pop
+LABELV $2631
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3874800
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2634
+ADDRGP4 $2610
+JUMPV
+LABELV $2634
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $2638
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+GTI4 $2638
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2704
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2704
+address $2640
+address $2644
+address $2649
+address $2654
+address $2659
+address $2664
+address $2669
+address $2674
+address $2679
+address $2684
+address $2689
+address $2694
+address $2699
+code
+LABELV $2640
+ADDRGP4 cg+3878896
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2644
+ADDRGP4 cg+3878896+4
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2649
+ADDRGP4 cg+3878896+8
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2654
+ADDRGP4 cg+3878896+12
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2659
+ADDRGP4 cg+3878896+16
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2664
+ADDRGP4 cg+3878896+20
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2669
+ADDRGP4 cg+3878896+24
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2674
+ADDRGP4 cg+3878896+28
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2679
+ADDRGP4 cg+3878896+32
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2684
+ADDRGP4 cg+3878896+36
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2689
+ADDRGP4 cg+3878896+40
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2694
+ADDRGP4 cg+3878896+44
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2699
+ADDRGP4 cg+3878896+48
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRGP4 $2610
+JUMPV
+LABELV $2638
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_EntityEffects
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1460
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2705
+ADDRGP4 cg+607144
+INDIRI4
+CNSTI4 12
+LEI4 $2707
+LABELV $2707
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ResetFXIntervalAndDistance
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1460
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2705
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $2710
+ADDRLP4 16
+INDIRI4
+CNSTI4 12
+GTI4 $2710
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2726
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2726
+address $2716
+address $2717
+address $2718
+address $2719
+address $2720
+address $2721
+address $2722
+address $2723
+address $2711
+address $2711
+address $2711
+address $2724
+address $2725
+code
+LABELV $2710
+ADDRGP4 $2713
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PrintEntityStatep
+CALLV
+pop
+ADDRGP4 $2714
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $2711
+JUMPV
+LABELV $2716
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_General
+CALLV
+pop
+ADDRGP4 $2711
+JUMPV
+LABELV $2717
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Player
+CALLV
+pop
+ADDRGP4 $2711
+JUMPV
+LABELV $2718
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Item
+CALLV
+pop
+ADDRGP4 $2711
+JUMPV
+LABELV $2719
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Missile
+CALLV
+pop
+ADDRGP4 $2711
+JUMPV
+LABELV $2720
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Mover
+CALLV
+pop
+ADDRGP4 $2711
+JUMPV
+LABELV $2721
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Beam
+CALLV
+pop
+ADDRGP4 $2711
+JUMPV
+LABELV $2722
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Portal
+CALLV
+pop
+ADDRGP4 $2711
+JUMPV
+LABELV $2723
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Speaker
+CALLV
+pop
+ADDRGP4 $2711
+JUMPV
+LABELV $2724
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Grapple
+CALLV
+pop
+ADDRGP4 $2711
+JUMPV
+LABELV $2725
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_TeamBase
+CALLV
+pop
+LABELV $2711
+LABELV $2610
+endproc CG_AddCEntity 24 12
+export CG_AddPacketEntities
+proc CG_AddPacketEntities 1532 12
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2728
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2733
+ADDRGP4 cg+607132
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2729
+JUMPV
+LABELV $2733
+ADDRGP4 cg+607132
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $2729
+JUMPV
+LABELV $2728
+ADDRGP4 cg+607132
+CNSTF4 0
+ASGNF4
+LABELV $2729
+ADDRGP4 cg+609316
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+609316+4
+CNSTI4 360
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRGP4 cg+609316+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+609364
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+609364+4
+CNSTI4 360
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 1023
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1149239296
+DIVF4
+ASGNF4
+ADDRGP4 cg+609364+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+609316
+ARGP4
+ADDRGP4 cg+609328
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+609364
+ARGP4
+ADDRGP4 cg+609376
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 cg+607196
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 cg+607704
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+607704+4
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+607704
+ARGP4
+ADDRGP4 CG_CalcEntityLerpPositions
+CALLV
+pop
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_CalcEntityLerpPositions
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 184
+ASGNI4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+176
+ADDP4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 184
+ASGNI4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+607704+8
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $2775
+ADDRGP4 cg+607704+200
+INDIRI4
+CNSTI4 6
+EQI4 $2769
+LABELV $2775
+ADDRGP4 cg+607704+900+152
+CNSTI4 0
+ASGNI4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+152
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2769
+ADDRGP4 wcg+31082572
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31082572
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607704+176
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3874800
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $2786
+ADDRGP4 cg+3878896+4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $2786
+ADDRGP4 cg+607704
+ARGP4
+ADDRGP4 CG_EntityEffects
+CALLV
+pop
+LABELV $2786
+ADDRGP4 cg+607704+1456
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607704+176
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3874800
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $2797
+ADDRGP4 cg+3878896+4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $2797
+ADDRGP4 cg+607704
+ARGP4
+ADDRGP4 CG_Player
+CALLV
+pop
+LABELV $2797
+ADDRGP4 cg_useOriginalInterpolation+12
+INDIRI4
+CNSTI4 0
+NEI4 $2805
+ADDRGP4 wcg+31078476
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $2805
+ADDRGP4 cg_customMirrorSurfaces+12
+INDIRI4
+CNSTI4 0
+EQI4 $2810
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2816
+JUMPV
+LABELV $2813
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 16+68
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+699352
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16+84
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+699352
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+CNSTI4 12
+ASGNI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2814
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2816
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+699348
+INDIRI4
+LTI4 $2813
+LABELV $2810
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2825
+JUMPV
+LABELV $2822
+ADDRLP4 16
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 556
+ASGNI4
+ADDRLP4 4
+CNSTI4 1496
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31082572
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $2830
+ADDRGP4 $2823
+JUMPV
+LABELV $2830
+ADDRLP4 24
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 556
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $2836
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 6
+EQI4 $2832
+LABELV $2836
+ADDRLP4 4
+INDIRP4
+CNSTI4 1052
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2832
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $2837
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddCEntity
+CALLV
+pop
+ADDRGP4 $2838
+JUMPV
+LABELV $2837
+ADDRGP4 wcg+4
+INDIRI4
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+NEI4 $2839
+ADDRLP4 32
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 4
+INDIRP4
+CNSTI4 244
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $2839
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddCEntity
+CALLV
+pop
+LABELV $2838
+LABELV $2823
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2825
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $2822
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2846
+JUMPV
+LABELV $2843
+ADDRLP4 4
+CNSTI4 1496
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2849
+ADDRGP4 $2844
+JUMPV
+LABELV $2849
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $2851
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddCEntity
+CALLV
+pop
+ADDRGP4 $2852
+JUMPV
+LABELV $2851
+ADDRGP4 wcg+4
+INDIRI4
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+NEI4 $2853
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 244
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $2853
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddCEntity
+CALLV
+pop
+LABELV $2852
+LABELV $2844
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2846
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $2843
+ADDRGP4 cg_useOriginalInterpolation+12
+INDIRI4
+CNSTI4 0
+NEI4 $2857
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2865
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2860
+LABELV $2865
+ADDRGP4 cg_freecam_useServerView+12
+INDIRI4
+CNSTI4 0
+EQI4 $2860
+ADDRGP4 $2861
+JUMPV
+LABELV $2860
+ADDRLP4 20
+CNSTU4 0
+ASGNU4
+ADDRGP4 wcg+31078464
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRU4
+EQU4 $2866
+ADDRGP4 wcg+31078468
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRU4
+EQU4 $2866
+ADDRGP4 wcg+31078472
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRU4
+EQU4 $2866
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2874
+JUMPV
+LABELV $2871
+ADDRLP4 24
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wcg+31078468
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1496
+ADDRLP4 24
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2877
+ADDRGP4 $2872
+JUMPV
+LABELV $2877
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2880
+ADDRLP4 28
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTU4 236
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Wolfcam_InterpolateEntityPosition
+CALLI4
+pop
+ADDRLP4 1528
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 1528
+INDIRP4
+ADDRLP4 1528
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Player
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $2881
+JUMPV
+LABELV $2880
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2882
+LABELV $2882
+LABELV $2881
+LABELV $2872
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2874
+ADDRLP4 0
+INDIRI4
+ADDRGP4 wcg+31078468
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $2871
+LABELV $2866
+LABELV $2861
+LABELV $2857
+LABELV $2727
+endproc CG_AddPacketEntities 1532 12
+import acos
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import Wolfcam_InterpolateEntityPosition
+import Wolfcam_MarkValidEntities
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import CG_SpawnRailTrail
+import CG_AddWeaponWithPowerups
+import CG_MachinegunSpinAngle
+import CG_MapTorsoToWeaponFrame
+import CG_Bullet
+import CG_GetWeaponFlashOrigin
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_OutOfAmmoChange
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_DrawWeaponSelect
+import CG_AddViewWeapon
+import CG_AddPlayerWeapon
+import CG_LightningBolt
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_SimpleRailTrail
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_AddRealLoopingSound
+import CG_AddLoopingSound
+import CG_StartLocalSound
+import CG_StartSound
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_NewParticleArea
+import CG_ParticleExplosion
+import CG_AddParticles
+import CG_ClearParticles
+import CG_AddMarks
+import CG_ImpactMark
+import CG_InitMarkPolys
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_ThawPlayer
+import CG_GibPlayer
+import CG_FX_ThawPlayer
+import CG_FX_GibPlayer
+import CG_ImpactSparks
+import CG_Bleed
+import CG_MakeExplosion
+import CG_HeadShotPlum
+import CG_DamagePlum
+import CG_ScorePlum
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_LightningBoltBeam
+import CG_SpawnEffect
+import CG_SmokePuff
+import CG_BubbleTrail
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_ShutdownLocalEnts
+import CG_GetStoredScriptVarsFromLE
+import CG_RunFxAll
+import CG_SmokePuff_ql
+import CG_AddRefEntityFX
+import CG_AddRefEntity
+import CG_ListLocalEntities
+import CG_RemoveFXLocalEntities
+import CG_ClearLocalFrameEntities
+import CG_CullGrid
+import CG_AddToCullGrid
+import CG_BeginCullGrid
+import CG_AddLocalEntities
+import CG_MakeLowPriorityEntity
+import CG_AllocLocalEntityRealTime
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import FxLoopSounds
+import CG_FreeFxJitTokens
+import CG_ResetFXIntervalAndDistance
+import CG_UpdatePositionData
+import CG_CopyPositionDataToScript
+import CG_CopyPositionDataToCent
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+import CG_CopyPlayerDataToScriptData
+import CG_ResetScriptVars
+import CG_ReloadQ3mmeScripts
+import CG_RunQ3mmeScript
+import CG_Q3mmeMath
+import EffectScripts
+import PlainScript
+import DistanceScript
+import EmitterScript
+import EmitterScriptVars
+import ScriptVars
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2714
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $2713
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $2131
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 0
+align 1
+LABELV $1692
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1306
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $472
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 83
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $201
+byte 1 42
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $199
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $198
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $197
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $196
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $195
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $194
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $193
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 49
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $192
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $191
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $190
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $189
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $188
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $187
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $186
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $185
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $184
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $183
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 50
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $182
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $181
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $180
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $179
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $178
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 50
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $177
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $176
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $175
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $174
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $173
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $172
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $171
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $170
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $169
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 114
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $168
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 114
+byte 1 66
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $167
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 114
+byte 1 68
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $166
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $165
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 114
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $164
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $163
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 114
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $162
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 114
+byte 1 66
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $161
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 114
+byte 1 68
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $160
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $159
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 114
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $158
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $157
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $156
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
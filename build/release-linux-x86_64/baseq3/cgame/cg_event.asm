@@ -0,0 +1,26008 @@
+bss
+align 1
+LABELV $157
+skip 64
+export CG_PlaceString
+code
+proc CG_PlaceString 12 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $158
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $160
+ASGNP4
+ADDRGP4 $159
+JUMPV
+LABELV $158
+ADDRLP4 4
+ADDRGP4 $161
+ASGNP4
+LABELV $159
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $162
+ADDRLP4 0
+ADDRGP4 $164
+ASGNP4
+ADDRGP4 $163
+JUMPV
+LABELV $162
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $165
+ADDRLP4 0
+ADDRGP4 $167
+ASGNP4
+ADDRGP4 $166
+JUMPV
+LABELV $165
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $168
+ADDRLP4 0
+ADDRGP4 $170
+ASGNP4
+ADDRGP4 $169
+JUMPV
+LABELV $168
+ADDRFP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $171
+ADDRLP4 0
+ADDRGP4 $173
+ASGNP4
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $174
+ADDRLP4 0
+ADDRGP4 $176
+ASGNP4
+ADDRGP4 $175
+JUMPV
+LABELV $174
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $177
+ADDRLP4 0
+ADDRGP4 $179
+ASGNP4
+ADDRGP4 $178
+JUMPV
+LABELV $177
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 1
+NEI4 $180
+ADDRGP4 $182
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+NEI4 $183
+ADDRGP4 $185
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 3
+NEI4 $186
+ADDRGP4 $188
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $187
+JUMPV
+LABELV $186
+ADDRGP4 $189
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $187
+LABELV $184
+LABELV $181
+LABELV $178
+LABELV $175
+LABELV $172
+LABELV $169
+LABELV $166
+LABELV $163
+ADDRGP4 $157
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $157
+RETP4
+LABELV $156
+endproc CG_PlaceString 12 20
+proc CG_Obituary 476 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $192
+ADDRLP4 156
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $192
+ADDRLP4 156
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $193
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $196
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $196
+ADDRLP4 316
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 316
+INDIRI4
+NEI4 $196
+ADDRGP4 cg_killBeep+12
+INDIRI4
+ADDRLP4 316
+INDIRI4
+LEI4 $196
+ADDRGP4 cg_killBeep+12
+INDIRI4
+CNSTI4 8
+GTI4 $196
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $201
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $201
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $201
+ADDRGP4 cg_killBeep+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493588-4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $201
+LABELV $196
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $211
+JUMPV
+LABELV $208
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $213
+ADDRGP4 $209
+JUMPV
+LABELV $213
+ADDRLP4 12
+INDIRI4
+CNSTI4 30
+NEI4 $216
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $210
+JUMPV
+LABELV $216
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $210
+JUMPV
+LABELV $209
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $211
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $208
+LABELV $210
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $222
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 3
+NEI4 $222
+ADDRLP4 4
+INDIRI4
+ADDRGP4 wcg+20
+INDIRI4
+NEI4 $222
+ADDRGP4 cg+5417536
+CNSTI4 1496
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+5417548
+CNSTI4 1496
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1200
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $222
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $230
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 2
+NEI4 $230
+ADDRLP4 8
+INDIRI4
+ADDRGP4 wcg+12
+INDIRI4
+NEI4 $230
+ADDRGP4 cg+5417560
+CNSTI4 1496
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+5417572
+CNSTI4 1496
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+5417584
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $230
+ADDRLP4 296
+ADDRGP4 cg+1226452
+INDIRI4
+CNSTI4 100
+MODI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 5148
+ADDRLP4 296
+INDIRI4
+MULI4
+ADDRGP4 cg+711652
+ADDP4
+ASGNP4
+ADDRLP4 320
+ADDRGP4 cg+1226452
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ADDRLP4 320
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4120
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 2048
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4104
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $243
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+GTI4 $243
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 328
+ADDRGP4 BG_ModToWeapon
+CALLI4
+ASGNI4
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+2368
+ADDP4
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 30
+EQI4 $246
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $248
+ADDRLP4 332
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+696
+ADDP4
+ASGNP4
+ADDRLP4 332
+INDIRP4
+ADDRLP4 332
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRLP4 332
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+688
+ADDP4
+ASGNP4
+ADDRLP4 332
+INDIRP4
+ADDRLP4 332
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 336
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+2380
+ADDP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ADDRLP4 336
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $249
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+2376
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+2356
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $246
+ADDRLP4 16
+INDIRP4
+CNSTI4 2052
+ADDP4
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 2048
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $243
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $257
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GTI4 $257
+ADDRLP4 12
+INDIRI4
+CNSTI4 30
+EQI4 $259
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 332
+ADDRGP4 BG_ModToWeapon
+CALLI4
+ASGNI4
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2372
+ADDP4
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 336
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+692
+ADDP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ADDRLP4 336
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2376
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2380
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $259
+ADDRLP4 16
+INDIRP4
+CNSTI4 4108
+ADDP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4104
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2384
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+4
+INDIRI4
+NEI4 $268
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $275
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $271
+LABELV $275
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $276
+CNSTI4 662
+ARGI4
+ADDRLP4 336
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ARGP4
+ADDRLP4 340
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 332
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+LEI4 $277
+ADDRGP4 $281
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $282
+ADDRLP4 332
+ADDRGP4 CG_CpmaIsRoundWarmup
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+NEI4 $285
+ADDRGP4 $281
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $285
+LABELV $282
+LABELV $277
+LABELV $271
+LABELV $268
+LABELV $257
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $289
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $287
+LABELV $289
+ADDRGP4 $290
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $287
+ADDRLP4 152
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 2056
+ADDP4
+ARGP4
+ADDRLP4 152
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 16
+INDIRP4
+CNSTI4 3080
+ADDP4
+ARGP4
+ADDRLP4 152
+INDIRP4
+CNSTI4 132
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 16
+INDIRP4
+CNSTI4 4104
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $294
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $292
+LABELV $294
+ADDRLP4 8
+CNSTI4 1022
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+INDIRP4
+CNSTI4 1024
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+INDIRP4
+CNSTI4 2048
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $293
+JUMPV
+LABELV $292
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 340
+CNSTI4 1024
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 340
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+132
+ADDP4
+ARGP4
+ADDRLP4 340
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $293
+ADDRLP4 4
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 340
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 292
+ADDRLP4 340
+INDIRP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $299
+ADDRGP4 $301
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $299
+ADDRLP4 20
+ARGP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 126
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRGP4 $304
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 300
+ADDRGP4 $161
+ASGNP4
+ADDRLP4 160
+ADDRGP4 cgs+632912+32
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 344
+ADDRGP4 BG_ModToWeapon
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4112
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 14
+LTI4 $307
+ADDRLP4 12
+INDIRI4
+CNSTI4 22
+GTI4 $307
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $325-56
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $325
+address $315
+address $317
+address $319
+address $313
+address $307
+address $311
+address $309
+address $321
+address $323
+code
+LABELV $309
+ADDRLP4 148
+ADDRGP4 $310
+ASGNP4
+ADDRGP4 $308
+JUMPV
+LABELV $311
+ADDRLP4 148
+ADDRGP4 $312
+ASGNP4
+ADDRGP4 $308
+JUMPV
+LABELV $313
+ADDRLP4 148
+ADDRGP4 $314
+ASGNP4
+ADDRGP4 $308
+JUMPV
+LABELV $315
+ADDRLP4 148
+ADDRGP4 $316
+ASGNP4
+ADDRGP4 $308
+JUMPV
+LABELV $317
+ADDRLP4 148
+ADDRGP4 $318
+ASGNP4
+ADDRGP4 $308
+JUMPV
+LABELV $319
+ADDRLP4 148
+ADDRGP4 $320
+ASGNP4
+ADDRGP4 $308
+JUMPV
+LABELV $321
+ADDRLP4 148
+ADDRGP4 $322
+ASGNP4
+ADDRGP4 $308
+JUMPV
+LABELV $323
+ADDRLP4 148
+ADDRGP4 $324
+ASGNP4
+ADDRGP4 $308
+JUMPV
+LABELV $307
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+LABELV $308
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $327
+ADDRLP4 304
+ADDRLP4 152
+INDIRP4
+CNSTI4 896
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 356
+CNSTI4 13
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 356
+INDIRI4
+EQI4 $372
+ADDRLP4 12
+INDIRI4
+ADDRLP4 356
+INDIRI4
+GTI4 $415
+LABELV $414
+ADDRLP4 12
+INDIRI4
+CNSTI4 5
+EQI4 $333
+ADDRLP4 12
+INDIRI4
+CNSTI4 7
+EQI4 $346
+ADDRLP4 12
+INDIRI4
+CNSTI4 9
+EQI4 $359
+ADDRGP4 $329
+JUMPV
+LABELV $415
+ADDRLP4 12
+INDIRI4
+CNSTI4 25
+LTI4 $329
+ADDRLP4 12
+INDIRI4
+CNSTI4 31
+GTI4 $329
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $416-100
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $416
+address $392
+address $331
+address $329
+address $329
+address $405
+address $329
+address $379
+code
+LABELV $331
+ADDRLP4 148
+ADDRGP4 $332
+ASGNP4
+ADDRGP4 $328
+JUMPV
+LABELV $333
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+NEI4 $334
+ADDRLP4 148
+ADDRGP4 $336
+ASGNP4
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRLP4 304
+INDIRI4
+CNSTI4 2
+NEI4 $337
+ADDRLP4 148
+ADDRGP4 $339
+ASGNP4
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRLP4 148
+ADDRGP4 $340
+ASGNP4
+LABELV $338
+LABELV $335
+ADDRLP4 368
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+144+32
+ADDP4
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ADDRLP4 368
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+528+68
+INDIRI4
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $346
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+NEI4 $347
+ADDRLP4 148
+ADDRGP4 $349
+ASGNP4
+ADDRGP4 $348
+JUMPV
+LABELV $347
+ADDRLP4 304
+INDIRI4
+CNSTI4 2
+NEI4 $350
+ADDRLP4 148
+ADDRGP4 $352
+ASGNP4
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 148
+ADDRGP4 $353
+ASGNP4
+LABELV $351
+LABELV $348
+ADDRLP4 372
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+180+32
+ADDP4
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ADDRLP4 372
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+660+68
+INDIRI4
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $359
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+NEI4 $360
+ADDRLP4 148
+ADDRGP4 $362
+ASGNP4
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 304
+INDIRI4
+CNSTI4 2
+NEI4 $363
+ADDRLP4 148
+ADDRGP4 $365
+ASGNP4
+ADDRGP4 $364
+JUMPV
+LABELV $363
+ADDRLP4 148
+ADDRGP4 $366
+ASGNP4
+LABELV $364
+LABELV $361
+ADDRLP4 376
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+288+32
+ADDP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+ADDRLP4 376
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+1056+68
+INDIRI4
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $372
+ADDRLP4 148
+ADDRGP4 $373
+ASGNP4
+ADDRLP4 380
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+324+32
+ADDP4
+ASGNP4
+ADDRLP4 380
+INDIRP4
+ADDRLP4 380
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+1188+68
+INDIRI4
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $379
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+NEI4 $380
+ADDRLP4 148
+ADDRGP4 $382
+ASGNP4
+ADDRGP4 $381
+JUMPV
+LABELV $380
+ADDRLP4 304
+INDIRI4
+CNSTI4 2
+NEI4 $383
+ADDRLP4 148
+ADDRGP4 $385
+ASGNP4
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRLP4 148
+ADDRGP4 $386
+ASGNP4
+LABELV $384
+LABELV $381
+ADDRLP4 384
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+216+32
+ADDP4
+ASGNP4
+ADDRLP4 384
+INDIRP4
+ADDRLP4 384
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+792+68
+INDIRI4
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $392
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+NEI4 $393
+ADDRLP4 148
+ADDRGP4 $395
+ASGNP4
+ADDRGP4 $394
+JUMPV
+LABELV $393
+ADDRLP4 304
+INDIRI4
+CNSTI4 2
+NEI4 $396
+ADDRLP4 148
+ADDRGP4 $398
+ASGNP4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 148
+ADDRGP4 $399
+ASGNP4
+LABELV $397
+LABELV $394
+ADDRLP4 388
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+432+32
+ADDP4
+ASGNP4
+ADDRLP4 388
+INDIRP4
+ADDRLP4 388
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+1584+68
+INDIRI4
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $405
+ADDRLP4 148
+ADDRGP4 $406
+ASGNP4
+ADDRGP4 $328
+JUMPV
+LABELV $329
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+NEI4 $407
+ADDRLP4 148
+ADDRGP4 $409
+ASGNP4
+ADDRGP4 $328
+JUMPV
+LABELV $407
+ADDRLP4 304
+INDIRI4
+CNSTI4 2
+NEI4 $410
+ADDRLP4 148
+ADDRGP4 $412
+ASGNP4
+ADDRGP4 $328
+JUMPV
+LABELV $410
+ADDRLP4 148
+ADDRGP4 $413
+ASGNP4
+ADDRGP4 $328
+JUMPV
+LABELV $327
+ADDRLP4 356
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 356
+INDIRI4
+LTI4 $418
+ADDRLP4 360
+CNSTI4 64
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 360
+INDIRI4
+GTI4 $418
+ADDRLP4 4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+LTI4 $418
+ADDRLP4 4
+INDIRI4
+ADDRLP4 360
+INDIRI4
+GTI4 $418
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+LTI4 $421
+ADDRLP4 12
+INDIRI4
+CNSTI4 33
+GTI4 $421
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $539-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $539
+address $449
+address $422
+address $431
+address $458
+address $458
+address $467
+address $467
+address $476
+address $476
+address $485
+address $494
+address $503
+address $503
+address $421
+address $421
+address $421
+address $421
+address $421
+address $421
+address $421
+address $421
+address $421
+address $521
+address $530
+address $512
+address $421
+address $421
+address $421
+address $421
+address $421
+address $421
+address $440
+address $485
+code
+LABELV $422
+ADDRLP4 372
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+36+24
+ADDP4
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ADDRLP4 372
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 376
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+36+28
+ADDP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+ADDRLP4 376
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+132+68
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $431
+ADDRLP4 380
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+72+24
+ADDP4
+ASGNP4
+ADDRLP4 380
+INDIRP4
+ADDRLP4 380
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 384
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+72+28
+ADDP4
+ASGNP4
+ADDRLP4 384
+INDIRP4
+ADDRLP4 384
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+264+68
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $440
+ADDRLP4 388
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+504+24
+ADDP4
+ASGNP4
+ADDRLP4 388
+INDIRP4
+ADDRLP4 388
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 392
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+504+28
+ADDP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ADDRLP4 392
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+1848+68
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $449
+ADDRLP4 396
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+108+24
+ADDP4
+ASGNP4
+ADDRLP4 396
+INDIRP4
+ADDRLP4 396
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 400
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+108+28
+ADDP4
+ASGNP4
+ADDRLP4 400
+INDIRP4
+ADDRLP4 400
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+396+68
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $458
+ADDRLP4 404
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+144+24
+ADDP4
+ASGNP4
+ADDRLP4 404
+INDIRP4
+ADDRLP4 404
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 408
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+144+28
+ADDP4
+ASGNP4
+ADDRLP4 408
+INDIRP4
+ADDRLP4 408
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+528+68
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $467
+ADDRLP4 412
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+180+24
+ADDP4
+ASGNP4
+ADDRLP4 412
+INDIRP4
+ADDRLP4 412
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 416
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+180+28
+ADDP4
+ASGNP4
+ADDRLP4 416
+INDIRP4
+ADDRLP4 416
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+660+68
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $476
+ADDRLP4 420
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+288+24
+ADDP4
+ASGNP4
+ADDRLP4 420
+INDIRP4
+ADDRLP4 420
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 424
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+288+28
+ADDP4
+ASGNP4
+ADDRLP4 424
+INDIRP4
+ADDRLP4 424
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+1056+68
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $485
+ADDRLP4 428
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+252+24
+ADDP4
+ASGNP4
+ADDRLP4 428
+INDIRP4
+ADDRLP4 428
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 432
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+252+28
+ADDP4
+ASGNP4
+ADDRLP4 432
+INDIRP4
+ADDRLP4 432
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+924+68
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $494
+ADDRLP4 436
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+216+24
+ADDP4
+ASGNP4
+ADDRLP4 436
+INDIRP4
+ADDRLP4 436
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 440
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+216+28
+ADDP4
+ASGNP4
+ADDRLP4 440
+INDIRP4
+ADDRLP4 440
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+792+68
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $503
+ADDRLP4 444
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+324+24
+ADDP4
+ASGNP4
+ADDRLP4 444
+INDIRP4
+ADDRLP4 444
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 448
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+324+28
+ADDP4
+ASGNP4
+ADDRLP4 448
+INDIRP4
+ADDRLP4 448
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+1188+68
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $512
+ADDRLP4 452
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+432+24
+ADDP4
+ASGNP4
+ADDRLP4 452
+INDIRP4
+ADDRLP4 452
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 456
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+432+28
+ADDP4
+ASGNP4
+ADDRLP4 456
+INDIRP4
+ADDRLP4 456
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+1584+68
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $521
+ADDRLP4 460
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+396+24
+ADDP4
+ASGNP4
+ADDRLP4 460
+INDIRP4
+ADDRLP4 460
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 464
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+396+28
+ADDP4
+ASGNP4
+ADDRLP4 464
+INDIRP4
+ADDRLP4 464
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+1452+68
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $530
+ADDRLP4 468
+CNSTI4 2392
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+468+24
+ADDP4
+ASGNP4
+ADDRLP4 468
+INDIRP4
+ADDRLP4 468
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 472
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+468+28
+ADDP4
+ASGNP4
+ADDRLP4 472
+INDIRP4
+ADDRLP4 472
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 160
+ADDRGP4 cg_weapons+1716+68
+INDIRI4
+ASGNI4
+LABELV $421
+LABELV $418
+LABELV $328
+ADDRLP4 12
+INDIRI4
+CNSTI4 30
+NEI4 $541
+ADDRLP4 16
+INDIRP4
+CNSTI4 4116
+ADDP4
+ADDRGP4 cgs+632912+492576
+INDIRI4
+ASGNI4
+ADDRGP4 $542
+JUMPV
+LABELV $541
+ADDRLP4 16
+INDIRP4
+CNSTI4 4116
+ADDP4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+LABELV $542
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $545
+ADDRGP4 $547
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $545
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $548
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $548
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 356
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $559
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $558
+LABELV $559
+ADDRGP4 cg_fragMessageStyle+12
+INDIRI4
+CNSTI4 1
+EQI4 $557
+LABELV $558
+ADDRGP4 cg_fragMessageStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $551
+LABELV $557
+ADDRGP4 cg_drawFragMessageSeparate+12
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 360
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $563
+ARGP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 364
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+ADDRLP4 364
+INDIRP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $566
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 368
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+ADDRLP4 368
+INDIRP4
+ASGNP4
+ADDRGP4 $552
+JUMPV
+LABELV $560
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 360
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $567
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 364
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+ADDRLP4 364
+INDIRP4
+ASGNP4
+ADDRGP4 $552
+JUMPV
+LABELV $551
+ADDRLP4 12
+INDIRI4
+CNSTI4 30
+NEI4 $570
+ADDRGP4 $572
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+ADDRLP4 360
+INDIRP4
+ASGNP4
+ADDRGP4 $571
+JUMPV
+LABELV $570
+ADDRLP4 360
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_teamKillWarning+12
+INDIRI4
+ADDRLP4 360
+INDIRI4
+EQI4 $573
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $573
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $573
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+EQI4 $573
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+EQI4 $573
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $573
+ADDRLP4 4
+INDIRI4
+ADDRLP4 360
+INDIRI4
+LTI4 $573
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $573
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 368
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $573
+ADDRGP4 $582
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 372
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+ADDRLP4 372
+INDIRP4
+ASGNP4
+ADDRGP4 $574
+JUMPV
+LABELV $573
+ADDRGP4 $566
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 372
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+ADDRLP4 372
+INDIRP4
+ASGNP4
+LABELV $574
+LABELV $571
+LABELV $552
+ADDRGP4 cg_drawFragMessageSeparate+12
+INDIRI4
+CNSTI4 0
+EQI4 $583
+ADDRGP4 cg+1329260
+ARGP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $584
+JUMPV
+LABELV $583
+ADDRLP4 352
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrintFragMessage
+CALLV
+pop
+LABELV $584
+ADDRGP4 cg+1330284
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330288
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330292
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330296
+ARGP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+1330424
+ARGP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+132
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 360
+ADDRGP4 BG_ModToWeapon
+CALLI4
+ASGNI4
+ADDRGP4 cg+1330560
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330564
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330552
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330556
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $549
+JUMPV
+LABELV $548
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $608
+ADDRLP4 8
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $610
+ADDRLP4 12
+INDIRI4
+CNSTI4 30
+NEI4 $613
+ADDRGP4 $572
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 356
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+ADDRLP4 356
+INDIRP4
+ASGNP4
+ADDRGP4 $614
+JUMPV
+LABELV $613
+ADDRGP4 $566
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 356
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+ADDRLP4 356
+INDIRP4
+ASGNP4
+LABELV $614
+ADDRGP4 cg_drawFragMessageSeparate+12
+INDIRI4
+CNSTI4 0
+EQI4 $615
+ADDRGP4 cg+1329260
+ARGP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+1330284
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $616
+JUMPV
+LABELV $615
+ADDRLP4 352
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrintFragMessage
+CALLV
+pop
+LABELV $616
+ADDRGP4 cg+1330284
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330288
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330292
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330296
+ARGP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+1330424
+ARGP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+132
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 356
+ADDRGP4 BG_ModToWeapon
+CALLI4
+ASGNI4
+ADDRGP4 cg+1330560
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330564
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330552
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1330556
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $610
+LABELV $608
+LABELV $549
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $644
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $642
+LABELV $644
+ADDRLP4 8
+CNSTI4 1022
+ASGNI4
+ADDRLP4 164
+ARGP4
+ADDRGP4 $645
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $643
+ADDRGP4 cg+617036
+CNSTI1 0
+ASGNI1
+ADDRGP4 cg+617068
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRGP4 cg+617072
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $643
+JUMPV
+LABELV $642
+ADDRLP4 164
+ARGP4
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 126
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 164
+ARGP4
+ADDRGP4 $304
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $653
+ADDRGP4 cg+617036
+ARGP4
+ADDRLP4 164
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+617068
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRGP4 cg+617072
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+617076
+CNSTI4 1496
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 356
+ADDRGP4 cg+617076
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 356+4
+ADDRGP4 cg+617076+4
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 356+8
+ADDRGP4 cg+617076+8
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 356
+ARGP4
+ADDRGP4 cg+617088
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $653
+LABELV $643
+ADDRLP4 8
+INDIRI4
+CNSTI4 1022
+EQI4 $672
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+LTI4 $674
+ADDRLP4 12
+INDIRI4
+CNSTI4 33
+GTI4 $674
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $732-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $732
+address $682
+address $678
+address $680
+address $684
+address $690
+address $693
+address $695
+address $697
+address $700
+address $701
+address $705
+address $709
+address $709
+address $674
+address $674
+address $674
+address $674
+address $725
+address $674
+address $674
+address $674
+address $674
+address $712
+address $714
+address $717
+address $720
+address $723
+address $676
+address $674
+address $728
+address $707
+address $687
+address $703
+code
+LABELV $676
+ADDRLP4 148
+ADDRGP4 $677
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $678
+ADDRLP4 148
+ADDRGP4 $679
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $680
+ADDRLP4 148
+ADDRGP4 $681
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $682
+ADDRLP4 148
+ADDRGP4 $683
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $684
+ADDRLP4 148
+ADDRGP4 $685
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $686
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $687
+ADDRLP4 148
+ADDRGP4 $688
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $689
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $690
+ADDRLP4 148
+ADDRGP4 $691
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $692
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $693
+ADDRLP4 148
+ADDRGP4 $685
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $694
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $695
+ADDRLP4 148
+ADDRGP4 $696
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $694
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $697
+ADDRLP4 148
+ADDRGP4 $698
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $699
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $700
+ADDRLP4 148
+ADDRGP4 $698
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $699
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $701
+ADDRLP4 148
+ADDRGP4 $702
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $703
+ADDRLP4 148
+ADDRGP4 $704
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $705
+ADDRLP4 148
+ADDRGP4 $706
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $707
+ADDRLP4 148
+ADDRGP4 $708
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $709
+ADDRLP4 148
+ADDRGP4 $710
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $711
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $712
+ADDRLP4 148
+ADDRGP4 $713
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $714
+ADDRLP4 148
+ADDRGP4 $715
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $716
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $717
+ADDRLP4 148
+ADDRGP4 $718
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $719
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $720
+ADDRLP4 148
+ADDRGP4 $721
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $722
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $723
+ADDRLP4 148
+ADDRGP4 $724
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $725
+ADDRLP4 148
+ADDRGP4 $726
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $727
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $728
+ADDRLP4 148
+ADDRGP4 $729
+ASGNP4
+ADDRGP4 $675
+JUMPV
+LABELV $674
+ADDRLP4 148
+ADDRGP4 $730
+ASGNP4
+ADDRGP4 $731
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $675
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $734
+ADDRGP4 $736
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 360
+ADDRLP4 364
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4124
+ADDP4
+ARGP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $737
+ADDRGP4 cg+1330568
+ARGP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $737
+ADDRGP4 $741
+ARGP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $734
+LABELV $672
+ADDRGP4 $742
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $191
+endproc CG_Obituary 476 20
+proc CG_UseItem 40 16
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 21
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $746
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LEI4 $744
+LABELV $746
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $744
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 BG_FindItemForHoldable
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+NEU4 $747
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $747
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $749
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $749
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $752
+ADDRGP4 cg_noItemUseMessage+12
+INDIRI4
+CNSTI4 0
+EQI4 $750
+ADDRGP4 $757
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $750
+JUMPV
+LABELV $752
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BG_FindItemForHoldable
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cg_itemUseMessage+12
+INDIRI4
+CNSTI4 0
+EQI4 $750
+ADDRGP4 $761
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $750
+JUMPV
+LABELV $749
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $762
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $762
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $765
+ADDRGP4 cg_noItemUseMessage+12
+INDIRI4
+CNSTI4 0
+EQI4 $766
+ADDRGP4 $757
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $766
+JUMPV
+LABELV $765
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BG_FindItemForHoldable
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cg_itemUseMessage+12
+INDIRI4
+CNSTI4 0
+EQI4 $770
+ADDRGP4 $761
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $770
+LABELV $766
+LABELV $762
+LABELV $750
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $778
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $777
+LABELV $778
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $773
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $773
+LABELV $777
+ADDRGP4 cg_noItemUseSound+12
+INDIRI4
+CNSTI4 0
+EQI4 $774
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+632912+492656
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $774
+JUMPV
+LABELV $773
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $789
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+EQI4 $788
+LABELV $789
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $784
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $784
+LABELV $788
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $790
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $790
+ADDRLP4 16
+CNSTI4 4524
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 272
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $790
+ADDRGP4 cg_itemUseSound+12
+INDIRI4
+CNSTI4 0
+EQI4 $785
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+632912+493244
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $785
+JUMPV
+LABELV $784
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $804
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+EQI4 $803
+LABELV $804
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $799
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $799
+LABELV $803
+ADDRGP4 cg_itemUseSound+12
+INDIRI4
+CNSTI4 0
+EQI4 $805
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+632912+492884
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $805
+LABELV $799
+LABELV $785
+LABELV $774
+LABELV $743
+endproc CG_UseItem 40 16
+proc CG_ItemPickup 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawItemPickupsCount+12
+INDIRI4
+CNSTI4 0
+EQI4 $811
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+627404
+INDIRI4
+SUBI4
+ADDRGP4 cg_drawItemPickupsTime+12
+INDIRI4
+GEI4 $811
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+627400
+INDIRI4
+NEI4 $811
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $811
+ADDRLP4 4
+ADDRGP4 cg+627416
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $812
+JUMPV
+LABELV $811
+ADDRGP4 cg+627416
+CNSTI4 1
+ASGNI4
+LABELV $812
+ADDRGP4 cg+627400
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627404
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_GetCurrentTimeWithDirection
+CALLI4
+ASGNI4
+ADDRGP4 cg+627408
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627412
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $827
+ADDRGP4 cg_autoswitch+12
+INDIRI4
+CNSTI4 0
+EQI4 $830
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $830
+ADDRGP4 cg+627420
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+609312
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $830
+LABELV $827
+LABELV $810
+endproc CG_ItemPickup 8 4
+data
+align 4
+LABELV $839
+byte 4 -1
+align 4
+LABELV $840
+byte 4 -1
+align 4
+LABELV $841
+byte 4 -1
+export CG_TimedItemPickup
+code
+proc CG_TimedItemPickup 88 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRFP4 16
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $842
+ADDRFP4 12
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $842
+LABELV $842
+ADDRLP4 52
+ADDRLP4 28
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 3
+EQI4 $846
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+NEI4 $844
+LABELV $846
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $849
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $847
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1203982208
+ASGNF4
+ADDRLP4 24
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $853
+JUMPV
+LABELV $850
+ADDRLP4 68
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 cg+692416
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 cg+692416+4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+692416+8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GEF4 $862
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $862
+LABELV $851
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $853
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+692412
+INDIRI4
+LTI4 $850
+ADDRLP4 44
+CNSTI4 2
+ASGNI4
+ADDRLP4 40
+ADDRGP4 cg+692412
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+692416
+ADDP4
+ASGNP4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $866
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+692416+16
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+692416+28
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $866
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $848
+JUMPV
+LABELV $847
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $874
+ARGP4
+ADDRLP4 60
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $872
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1203982208
+ASGNF4
+ADDRLP4 24
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $878
+JUMPV
+LABELV $875
+ADDRLP4 72
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cg+691836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cg+691836+4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+691836+8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 76
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GEF4 $887
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $887
+LABELV $876
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $878
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+691832
+INDIRI4
+LTI4 $875
+ADDRLP4 44
+CNSTI4 3
+ASGNI4
+ADDRLP4 40
+ADDRGP4 cg+691832
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+691836
+ADDP4
+ASGNP4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $891
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+691836+16
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+691836+28
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $891
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $873
+JUMPV
+LABELV $872
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $899
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $897
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1203982208
+ASGNF4
+ADDRLP4 24
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $900
+ADDRLP4 76
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 cg+691256
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 cg+691256+4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+691256+8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GEF4 $912
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $912
+LABELV $901
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $903
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+691252
+INDIRI4
+LTI4 $900
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+ADDRGP4 cg+691252
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+691256
+ADDP4
+ASGNP4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $916
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+691256+16
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+691256+28
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $916
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $898
+JUMPV
+LABELV $897
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $924
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $922
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1203982208
+ASGNF4
+ADDRLP4 24
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 $928
+JUMPV
+LABELV $925
+ADDRLP4 80
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 80
+INDIRI4
+ADDRGP4 cg+692996
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 80
+INDIRI4
+ADDRGP4 cg+692996+4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+692996+8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 84
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GEF4 $937
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $937
+LABELV $926
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $928
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+692992
+INDIRI4
+LTI4 $925
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 cg+692992
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+692996
+ADDP4
+ASGNP4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $941
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+692996+16
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+692996+28
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+692996+32
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $941
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+LABELV $922
+LABELV $898
+LABELV $873
+LABELV $848
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $949
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $949
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $951
+ADDRLP4 72
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 1000
+ADDRLP4 72
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $952
+JUMPV
+LABELV $951
+ADDRGP4 cg_itemSpawnPrint+12
+INDIRI4
+CNSTI4 0
+EQI4 $838
+ADDRGP4 $839
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $956
+ADDRGP4 $840
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $956
+ADDRGP4 $841
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+NEI4 $956
+ADDRGP4 $838
+JUMPV
+LABELV $956
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+NEI4 $959
+ADDRLP4 72
+ADDRGP4 CG_GetLevelTimerString
+CALLP4
+ASGNP4
+ADDRGP4 $961
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+ADDRLP4 76
+ADDRGP4 CG_GetLevelTimerString
+CALLP4
+ASGNP4
+ADDRGP4 $961
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $960
+JUMPV
+LABELV $959
+ADDRLP4 72
+ADDRGP4 CG_GetLevelTimerString
+CALLP4
+ASGNP4
+ADDRGP4 $962
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+ADDRLP4 76
+ADDRGP4 CG_GetLevelTimerString
+CALLP4
+ASGNP4
+ADDRGP4 $962
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $960
+ADDRGP4 $839
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $840
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $841
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $838
+JUMPV
+LABELV $952
+LABELV $949
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $964
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $964
+ADDRLP4 32
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $964
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $845
+ADDRGP4 $845
+JUMPV
+LABELV $844
+ADDRLP4 28
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $968
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_QUAD
+INDIRI4
+NEI4 $970
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1203982208
+ASGNF4
+ADDRLP4 24
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $975
+JUMPV
+LABELV $972
+ADDRLP4 64
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+693576
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+693576+4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+693576+8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GEF4 $984
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $984
+LABELV $973
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $975
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+693572
+INDIRI4
+LTI4 $972
+ADDRLP4 40
+ADDRGP4 cg+693572
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $971
+ADDRLP4 60
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 1000
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+693576+16
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+DIVI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+693576+12
+ADDP4
+INDIRI4
+ADDI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+DIVI4
+GTI4 $971
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+693576+16
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $971
+JUMPV
+LABELV $970
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+NEI4 $995
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1203982208
+ASGNF4
+ADDRLP4 24
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $1000
+JUMPV
+LABELV $997
+ADDRLP4 64
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+694156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+694156+4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+694156+8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GEF4 $1009
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $1009
+LABELV $998
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1000
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+694152
+INDIRI4
+LTI4 $997
+ADDRLP4 40
+ADDRGP4 cg+694152
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $996
+ADDRLP4 60
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 1000
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+694156+16
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+DIVI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+694156+12
+ADDP4
+INDIRI4
+ADDI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+DIVI4
+GTI4 $996
+CNSTI4 36
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+694156+16
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $996
+JUMPV
+LABELV $995
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REGEN
+INDIRI4
+NEI4 $1020
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1021
+JUMPV
+LABELV $1020
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+LABELV $1021
+LABELV $996
+LABELV $971
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1022
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $838
+ADDRGP4 cg_itemSpawnPrint+12
+INDIRI4
+CNSTI4 0
+EQI4 $838
+ADDRGP4 $839
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $1029
+ADDRGP4 $840
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $1029
+ADDRGP4 $841
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+NEI4 $1029
+ADDRGP4 $838
+JUMPV
+LABELV $1029
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+NEI4 $1032
+ADDRLP4 56
+ADDRGP4 CG_GetLevelTimerString
+CALLP4
+ASGNP4
+ADDRGP4 $1034
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+ADDRLP4 60
+ADDRGP4 CG_GetLevelTimerString
+CALLP4
+ASGNP4
+ADDRGP4 $1034
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1033
+JUMPV
+LABELV $1032
+ADDRLP4 56
+ADDRGP4 CG_GetLevelTimerString
+CALLP4
+ASGNP4
+ADDRGP4 $1035
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+ADDRLP4 60
+ADDRGP4 CG_GetLevelTimerString
+CALLP4
+ASGNP4
+ADDRGP4 $1035
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1033
+ADDRGP4 $839
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $840
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $841
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $1022
+LABELV $968
+LABELV $845
+LABELV $838
+endproc CG_TimedItemPickup 88 20
+proc CG_WaterLevel 56 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $1040
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $1038
+LABELV $1040
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRGP4 $1039
+JUMPV
+LABELV $1038
+ADDRLP4 24
+CNSTI4 26
+ASGNI4
+LABELV $1039
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1043
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+CNSTI4 -24
+SUBI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1046
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1049
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+LABELV $1049
+LABELV $1046
+LABELV $1043
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $1037
+endproc CG_WaterLevel 56 8
+export CG_PainEvent
+proc CG_PainEvent 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 500
+GEI4 $1052
+ADDRGP4 $1051
+JUMPV
+LABELV $1052
+ADDRFP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $1055
+ADDRLP4 0
+ADDRGP4 $1057
+ASGNP4
+ADDRGP4 $1056
+JUMPV
+LABELV $1055
+ADDRFP4 4
+INDIRI4
+CNSTI4 50
+GEI4 $1058
+ADDRLP4 0
+ADDRGP4 $1060
+ASGNP4
+ADDRGP4 $1059
+JUMPV
+LABELV $1058
+ADDRFP4 4
+INDIRI4
+CNSTI4 75
+GEI4 $1061
+ADDRLP4 0
+ADDRGP4 $1063
+ASGNP4
+ADDRGP4 $1062
+JUMPV
+LABELV $1061
+ADDRLP4 0
+ADDRGP4 $1064
+ASGNP4
+LABELV $1062
+LABELV $1059
+LABELV $1056
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1069
+ADDRGP4 cgs+1957780
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1065
+LABELV $1069
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1065
+ADDRFP4 0
+CNSTI4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities-22440
+ADDP4
+ASGNP4
+LABELV $1065
+ADDRGP4 $1071
+JUMPV
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1073
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $1075
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1072
+JUMPV
+LABELV $1073
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $1076
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1072
+JUMPV
+LABELV $1071
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $1072
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+LABELV $1051
+endproc CG_PainEvent 16 16
+proc CG_EntityEventFromQ3 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1079
+ADDRFP4 0
+INDIRI4
+CNSTI4 66
+LTI4 $1079
+ADDRLP4 8
+CNSTI4 66
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1084
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $1082
+LABELV $1087
+ADDRFP4 0
+INDIRI4
+CNSTI4 78
+EQI4 $1085
+ADDRGP4 $1082
+JUMPV
+LABELV $1084
+CNSTI4 196
+RETI4
+ADDRGP4 $1078
+JUMPV
+LABELV $1085
+CNSTI4 74
+RETI4
+ADDRGP4 $1078
+JUMPV
+LABELV $1082
+ADDRGP4 $1086
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1078
+JUMPV
+LABELV $1079
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1088
+ADDRFP4 0
+INDIRI4
+CNSTI4 82
+GTI4 $1088
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1175
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1175
+address $1090
+address $1091
+address $1092
+address $1093
+address $1094
+address $1095
+address $1096
+address $1097
+address $1098
+address $1099
+address $1100
+address $1101
+address $1102
+address $1103
+address $1104
+address $1105
+address $1106
+address $1107
+address $1108
+address $1109
+address $1110
+address $1111
+address $1112
+address $1113
+address $1114
+address $1115
+address $1116
+address $1117
+address $1118
+address $1119
+address $1120
+address $1121
+address $1122
+address $1123
+address $1124
+address $1125
+address $1126
+address $1127
+address $1128
+address $1129
+address $1130
+address $1131
+address $1132
+address $1133
+address $1134
+address $1135
+address $1136
+address $1137
+address $1138
+address $1139
+address $1140
+address $1141
+address $1142
+address $1143
+address $1144
+address $1145
+address $1147
+address $1148
+address $1149
+address $1150
+address $1151
+address $1152
+address $1153
+address $1154
+address $1155
+address $1156
+address $1157
+address $1158
+address $1159
+address $1160
+address $1161
+address $1162
+address $1163
+address $1164
+address $1165
+address $1166
+address $1167
+address $1168
+address $1169
+address $1170
+address $1171
+address $1172
+address $1173
+code
+LABELV $1090
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1091
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1092
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1093
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1094
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1095
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1096
+ADDRLP4 0
+CNSTI4 196
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1097
+ADDRLP4 0
+CNSTI4 197
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1098
+ADDRLP4 0
+CNSTI4 198
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1099
+ADDRLP4 0
+CNSTI4 199
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1100
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1101
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1102
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1103
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1104
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1105
+ADDRLP4 0
+CNSTI4 11
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1106
+ADDRLP4 0
+CNSTI4 12
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1107
+ADDRLP4 0
+CNSTI4 13
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1108
+ADDRLP4 0
+CNSTI4 14
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1109
+ADDRLP4 0
+CNSTI4 15
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1110
+ADDRLP4 0
+CNSTI4 16
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1111
+ADDRLP4 0
+CNSTI4 17
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1112
+ADDRLP4 0
+CNSTI4 18
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1113
+ADDRLP4 0
+CNSTI4 20
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1114
+ADDRLP4 0
+CNSTI4 21
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1115
+ADDRLP4 0
+CNSTI4 22
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1116
+ADDRLP4 0
+CNSTI4 23
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1117
+ADDRLP4 0
+CNSTI4 24
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1118
+ADDRLP4 0
+CNSTI4 25
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1119
+ADDRLP4 0
+CNSTI4 26
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1120
+ADDRLP4 0
+CNSTI4 27
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1121
+ADDRLP4 0
+CNSTI4 28
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1122
+ADDRLP4 0
+CNSTI4 29
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1123
+ADDRLP4 0
+CNSTI4 30
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1124
+ADDRLP4 0
+CNSTI4 31
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1125
+ADDRLP4 0
+CNSTI4 32
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1126
+ADDRLP4 0
+CNSTI4 33
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1127
+ADDRLP4 0
+CNSTI4 34
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1128
+ADDRLP4 0
+CNSTI4 35
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1129
+ADDRLP4 0
+CNSTI4 36
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1130
+ADDRLP4 0
+CNSTI4 37
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1131
+ADDRLP4 0
+CNSTI4 38
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1132
+ADDRLP4 0
+CNSTI4 39
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1133
+ADDRLP4 0
+CNSTI4 40
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1134
+ADDRLP4 0
+CNSTI4 41
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1135
+ADDRLP4 0
+CNSTI4 42
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1136
+ADDRLP4 0
+CNSTI4 43
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1137
+ADDRLP4 0
+CNSTI4 44
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1138
+ADDRLP4 0
+CNSTI4 45
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1139
+ADDRLP4 0
+CNSTI4 46
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1140
+ADDRLP4 0
+CNSTI4 47
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1141
+ADDRLP4 0
+CNSTI4 48
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1142
+ADDRLP4 0
+CNSTI4 49
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1143
+ADDRLP4 0
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1144
+ADDRLP4 0
+CNSTI4 51
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1145
+ADDRGP4 $1146
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 45
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1147
+ADDRLP4 0
+CNSTI4 53
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1148
+ADDRLP4 0
+CNSTI4 54
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1149
+ADDRLP4 0
+CNSTI4 55
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1150
+ADDRLP4 0
+CNSTI4 56
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1151
+ADDRLP4 0
+CNSTI4 58
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1152
+ADDRLP4 0
+CNSTI4 59
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1153
+ADDRLP4 0
+CNSTI4 60
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1154
+ADDRLP4 0
+CNSTI4 61
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1155
+ADDRLP4 0
+CNSTI4 63
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1156
+ADDRLP4 0
+CNSTI4 64
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1157
+ADDRLP4 0
+CNSTI4 65
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1158
+ADDRLP4 0
+CNSTI4 66
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1159
+ADDRLP4 0
+CNSTI4 67
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1160
+ADDRLP4 0
+CNSTI4 68
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1161
+ADDRLP4 0
+CNSTI4 69
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1162
+ADDRLP4 0
+CNSTI4 70
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1163
+ADDRLP4 0
+CNSTI4 202
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1164
+ADDRLP4 0
+CNSTI4 203
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1165
+ADDRLP4 0
+CNSTI4 72
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1166
+ADDRLP4 0
+CNSTI4 73
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1167
+ADDRLP4 0
+CNSTI4 74
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1168
+ADDRLP4 0
+CNSTI4 75
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1169
+ADDRLP4 0
+CNSTI4 76
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1170
+ADDRLP4 0
+CNSTI4 77
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1171
+ADDRLP4 0
+CNSTI4 78
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1172
+ADDRLP4 0
+CNSTI4 79
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1173
+ADDRLP4 0
+CNSTI4 80
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1088
+ADDRGP4 $1174
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+LABELV $1089
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $1176
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1178
+ADDRGP4 $1086
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1078
+JUMPV
+LABELV $1178
+LABELV $1176
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1078
+endproc CG_EntityEventFromQ3 12 8
+export CG_CheckClientEventCpma
+proc CG_CheckClientEventCpma 0 0
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1182
+ADDRFP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 15
+BANDI4
+ASGNI4
+LABELV $1182
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $1181
+endproc CG_CheckClientEventCpma 0 0
+lit
+align 4
+LABELV $1475
+byte 4 0
+byte 4 0
+byte 4 1065353216
+data
+align 4
+LABELV $3647
+byte 4 0
+export CG_EntityEvent
+code
+proc CG_EntityEvent 1360 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $1185
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_EntityEventFromQ3
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $1185
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $1193
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $1189
+LABELV $1193
+ADDRGP4 $1194
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1189
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LTI4 $1196
+ADDRGP4 cg+3878896+52
+INDIRI4
+CNSTI4 0
+EQI4 $1198
+ADDRGP4 $1184
+JUMPV
+LABELV $1198
+LABELV $1196
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1202
+ADDRLP4 12
+ADDRGP4 $1204
+ASGNP4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+NEI4 $1209
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $1184
+LABELV $1209
+ADDRGP4 $1210
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $1202
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $1213
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+LTI4 $1211
+LABELV $1213
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $1211
+ADDRLP4 24
+CNSTI4 4524
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1215
+ADDRLP4 28
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $1216
+JUMPV
+LABELV $1215
+ADDRLP4 28
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1216
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 wolfcam_log_event
+CALLV
+pop
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+CNSTI4 0
+EQI4 $1219
+ADDRLP4 60
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 60+8
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72
+INDIRI4
+CNSTI4 40
+MODI4
+CNSTI4 50
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 56
+CNSTU1 0
+ASGNU1
+ADDRLP4 56+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 56+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 56+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+NEI4 $1226
+ADDRLP4 56
+CNSTU1 255
+ASGNU1
+ADDRLP4 56+1
+CNSTU1 50
+ASGNU1
+LABELV $1226
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 60
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 2000
+ARGI4
+ADDRGP4 CG_FloatNumberExt
+CALLV
+pop
+LABELV $1219
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1232
+JUMPV
+LABELV $1229
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6739156
+ADDP4
+INDIRI4
+NEI4 $1234
+ADDRGP4 $1184
+JUMPV
+LABELV $1234
+LABELV $1230
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1232
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+6743252
+INDIRI4
+LTI4 $1229
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $1237
+ADDRLP4 16
+INDIRI4
+CNSTI4 98
+GTI4 $3661
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3662-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3662
+address $1239
+address $1255
+address $1304
+address $1320
+address $1336
+address $1352
+address $1374
+address $1395
+address $1457
+address $1482
+address $1554
+address $1566
+address $1578
+address $1590
+address $1609
+address $1678
+address $1740
+address $1763
+address $1753
+address $1775
+address $1791
+address $1801
+address $1811
+address $1821
+address $1831
+address $1841
+address $1851
+address $1861
+address $1871
+address $1881
+address $1891
+address $1901
+address $1911
+address $1921
+address $1931
+address $1941
+address $1995
+address $1985
+address $1951
+address $1968
+address $2047
+address $2408
+address $2430
+address $2461
+address $2275
+address $2267
+address $2154
+address $2162
+address $2170
+address $2178
+address $2400
+address $1237
+address $3079
+address $3095
+address $3095
+address $3095
+address $3132
+address $3113
+address $3142
+address $3187
+address $3235
+address $3256
+address $3277
+address $2138
+address $2061
+address $2079
+address $2089
+address $2097
+address $2105
+address $2113
+address $1237
+address $3334
+address $3324
+address $1540
+address $1237
+address $1237
+address $1237
+address $1237
+address $1237
+address $1237
+address $1288
+address $1272
+address $1601
+address $3342
+address $3355
+address $1237
+address $3363
+address $3380
+address $3395
+address $3412
+address $1237
+address $1237
+address $3427
+address $3461
+address $3495
+address $2146
+address $3529
+address $3635
+code
+LABELV $3661
+ADDRLP4 16
+INDIRI4
+CNSTI4 196
+LTI4 $1237
+ADDRLP4 16
+INDIRI4
+CNSTI4 203
+GTI4 $1237
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3664-784
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3664
+address $1417
+address $1417
+address $1417
+address $1417
+address $1417
+address $1417
+address $2121
+address $2130
+code
+LABELV $1239
+ADDRLP4 12
+ADDRGP4 $1240
+ASGNP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $1245
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1241
+LABELV $1245
+ADDRGP4 $1246
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1241
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1247
+ADDRGP4 $1249
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1247
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 892
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cgs+632912+492664
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1255
+ADDRLP4 12
+ADDRGP4 $1256
+ASGNP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $1261
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1257
+LABELV $1261
+ADDRGP4 $1262
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1257
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1263
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1263
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+80
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1272
+ADDRLP4 12
+ADDRGP4 $1273
+ASGNP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $1278
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1274
+LABELV $1278
+ADDRGP4 $1279
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1274
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1280
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1280
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+112
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1288
+ADDRLP4 12
+ADDRGP4 $1289
+ASGNP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $1294
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1290
+LABELV $1294
+ADDRGP4 $1295
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1290
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1296
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1296
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+128
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1304
+ADDRLP4 12
+ADDRGP4 $1305
+ASGNP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $1310
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1306
+LABELV $1310
+ADDRGP4 $1311
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1306
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1312
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1312
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1320
+ADDRLP4 12
+ADDRGP4 $1321
+ASGNP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $1326
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1322
+LABELV $1326
+ADDRGP4 $1327
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1322
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1328
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1328
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1336
+ADDRLP4 12
+ADDRGP4 $1337
+ASGNP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $1342
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1338
+LABELV $1342
+ADDRGP4 $1343
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1338
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1344
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1344
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1352
+ADDRLP4 12
+ADDRGP4 $1353
+ASGNP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $1358
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1354
+LABELV $1358
+ADDRGP4 $1359
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1354
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1360
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1360
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+492996
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+607196+140
+INDIRI4
+NEI4 $1364
+ADDRGP4 cg+609304
+CNSTF4 3238002688
+ASGNF4
+ADDRGP4 cg+609308
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $1364
+CNSTI4 2392
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 wclients+48
+ADDP4
+CNSTI4 -8
+ASGNI4
+CNSTI4 2392
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 wclients+52
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $1374
+ADDRLP4 12
+ADDRGP4 $1375
+ASGNP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $1380
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1376
+LABELV $1380
+ADDRGP4 $1381
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1376
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1382
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1382
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $1064
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+607196+140
+INDIRI4
+NEI4 $1385
+ADDRGP4 cg+609304
+CNSTF4 3246391296
+ASGNF4
+ADDRGP4 cg+609308
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $1385
+CNSTI4 2392
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 wclients+48
+ADDP4
+CNSTI4 -16
+ASGNI4
+CNSTI4 2392
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 wclients+52
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $1395
+ADDRLP4 12
+ADDRGP4 $1396
+ASGNP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $1401
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $1397
+LABELV $1401
+ADDRGP4 $1402
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1397
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1403
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1403
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $1405
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+607196+140
+INDIRI4
+NEI4 $1407
+ADDRGP4 cg+609304
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 cg+609308
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $1407
+CNSTI4 2392
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 wclients+48
+ADDP4
+CNSTI4 -24
+ASGNI4
+CNSTI4 2392
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 wclients+52
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $1417
+ADDRLP4 12
+ADDRGP4 $1418
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+NEI4 $1423
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $1419
+LABELV $1423
+ADDRGP4 $1424
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1419
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1425
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1425
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+607196+140
+INDIRI4
+EQI4 $1427
+ADDRGP4 $1238
+JUMPV
+LABELV $1427
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $1439
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 84
+INDIRI4
+NEI4 $1439
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $1439
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 84
+INDIRI4
+EQI4 $1431
+LABELV $1439
+ADDRGP4 $1238
+JUMPV
+LABELV $1431
+ADDRLP4 72
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+609292
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_stepSmoothTime+8
+INDIRF4
+GEF4 $1442
+ADDRLP4 76
+ADDRGP4 cg+609288
+INDIRF4
+ADDRGP4 cg_stepSmoothTime+8
+INDIRF4
+ADDRLP4 72
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ADDRGP4 cg_stepSmoothTime+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $1443
+JUMPV
+LABELV $1442
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+LABELV $1443
+ADDRLP4 80
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 784
+SUBI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 cg+609288
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609288
+INDIRF4
+ADDRGP4 cg_stepSmoothMaxChange+8
+INDIRF4
+LEF4 $1449
+ADDRGP4 cg+609288
+ADDRGP4 cg_stepSmoothMaxChange+8
+INDIRF4
+ASGNF4
+LABELV $1449
+ADDRGP4 cg+609292
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $1457
+ADDRLP4 12
+ADDRGP4 $1458
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+NEI4 $1463
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $1459
+LABELV $1463
+ADDRGP4 $1464
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1459
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 72
+INDIRI4
+NEI4 $1469
+ADDRGP4 cgs+1957780
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $1465
+LABELV $1469
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_CheckClientEventCpma
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 76
+INDIRI4
+ASGNI4
+LABELV $1465
+ADDRGP4 EffectScripts+3899752
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1470
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 EffectScripts+3899752
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $1471
+JUMPV
+LABELV $1470
+ADDRLP4 76
+ADDRGP4 $1475
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRLP4 88
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1148846080
+ARGF4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+632912+492136
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 cgs+632912+493004
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $1471
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 $1481
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1482
+ADDRLP4 12
+ADDRGP4 $1483
+ASGNP4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $1488
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $1484
+LABELV $1488
+ADDRGP4 $1489
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1484
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1490
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1490
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $1481
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRLP4 84
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+LTI4 $1492
+ADDRLP4 84
+INDIRI4
+CNSTI4 64
+GEI4 $1492
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2388
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $1492
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $1238
+ADDRGP4 cg+5417532
+INDIRI4
+CNSTI4 0
+EQI4 $1498
+ADDRGP4 cg+5417524
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+5417532
+CNSTI4 0
+ASGNI4
+LABELV $1498
+ADDRGP4 cg+5417524
+INDIRI4
+CNSTI4 256
+MODI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+5415476+4
+ADDP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1511
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1507
+LABELV $1511
+ADDRLP4 88
+CNSTI4 76
+ASGNI4
+ADDRLP4 92
+CNSTI4 80
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 96
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRGP4 cg+5417524
+INDIRI4
+CNSTI4 256
+MODI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+5415476
+ADDP4
+ADDRLP4 96
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1508
+JUMPV
+LABELV $1507
+ADDRLP4 88
+CNSTI4 1496
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+12+24
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+12+24
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 88
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+12+24+4
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+12+24+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRGP4 cg+5417524
+INDIRI4
+CNSTI4 256
+MODI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+5415476
+ADDP4
+ADDRLP4 92
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $1508
+ADDRGP4 cg+5417524
+INDIRI4
+CNSTI4 0
+NEI4 $1534
+ADDRGP4 cg+5417528
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1534
+ADDRLP4 88
+ADDRGP4 cg+5417524
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $1540
+ADDRLP4 12
+ADDRGP4 $1541
+ASGNP4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+NEI4 $1546
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+EQI4 $1542
+LABELV $1546
+ADDRGP4 $1547
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1542
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1548
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1548
+ADDRGP4 cg_noTaunt+12
+INDIRI4
+CNSTI4 0
+NEI4 $1238
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $1553
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1554
+ADDRLP4 12
+ADDRGP4 $1555
+ASGNP4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+NEI4 $1560
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+EQI4 $1556
+LABELV $1560
+ADDRGP4 $1561
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1556
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1562
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1562
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+493228
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1566
+ADDRLP4 12
+ADDRGP4 $1567
+ASGNP4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+NEI4 $1572
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+EQI4 $1568
+LABELV $1572
+ADDRGP4 $1573
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1568
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1574
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1574
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+493232
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1578
+ADDRLP4 12
+ADDRGP4 $1579
+ASGNP4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+NEI4 $1584
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+EQI4 $1580
+LABELV $1584
+ADDRGP4 $1585
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1580
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1586
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1586
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+493236
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1590
+ADDRLP4 12
+ADDRGP4 $1591
+ASGNP4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+NEI4 $1596
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+EQI4 $1592
+LABELV $1596
+ADDRGP4 $1597
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1592
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1598
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1598
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $1600
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1601
+ADDRLP4 12
+ADDRGP4 $1602
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1607
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1603
+LABELV $1607
+ADDRGP4 $1608
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1603
+LABELV $1609
+ADDRLP4 12
+ADDRGP4 $1610
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1615
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1611
+LABELV $1615
+ADDRGP4 $1616
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1611
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 104
+INDIRI4
+NEI4 $1621
+ADDRGP4 cgs+1957780
+INDIRI4
+ADDRLP4 104
+INDIRI4
+EQI4 $1617
+LABELV $1621
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 CG_CheckClientEventCpma
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 $1618
+JUMPV
+LABELV $1617
+ADDRLP4 16
+INDIRI4
+CNSTI4 15
+NEI4 $1622
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+EQI4 $1622
+ADDRGP4 $1624
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1622
+LABELV $1618
+ADDRLP4 16
+INDIRI4
+CNSTI4 83
+NEI4 $1625
+ADDRLP4 92
+ADDRLP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1626
+JUMPV
+LABELV $1625
+ADDRLP4 92
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1626
+ADDRLP4 108
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+LTI4 $1629
+ADDRLP4 108
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $1627
+LABELV $1629
+ADDRGP4 $1238
+JUMPV
+LABELV $1627
+ADDRLP4 96
+CNSTI4 52
+ADDRLP4 92
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 15
+NEI4 $1630
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_TimedItemPickup
+CALLV
+pop
+ADDRGP4 $1631
+JUMPV
+LABELV $1630
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_TimedItemPickup
+CALLV
+pop
+LABELV $1633
+LABELV $1631
+ADDRLP4 16
+INDIRI4
+CNSTI4 83
+EQI4 $1635
+ADDRLP4 112
+ADDRLP4 96
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 5
+EQI4 $1639
+ADDRLP4 112
+INDIRI4
+CNSTI4 8
+NEI4 $1637
+LABELV $1639
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+493560
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1638
+JUMPV
+LABELV $1637
+ADDRLP4 96
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1642
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_audioAnnouncer+12
+INDIRI4
+ADDRLP4 116
+INDIRI4
+EQI4 $1648
+ADDRGP4 cg_audioAnnouncerPowerup+12
+INDIRI4
+ADDRLP4 116
+INDIRI4
+NEI4 $1644
+LABELV $1648
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+LABELV $1644
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_SCOUT
+INDIRI4
+NEI4 $1649
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $1643
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 cgs+632912+493536
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1643
+JUMPV
+LABELV $1649
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_GUARD
+INDIRI4
+NEI4 $1655
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $1643
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 cgs+632912+493532
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1643
+JUMPV
+LABELV $1655
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_DOUBLER
+INDIRI4
+NEI4 $1661
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $1643
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 cgs+632912+493528
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1643
+JUMPV
+LABELV $1661
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_ARMORREGEN
+INDIRI4
+NEI4 $1667
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $1643
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 cgs+632912+493520
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1643
+JUMPV
+LABELV $1667
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 601
+NEI4 $1643
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 120
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1643
+JUMPV
+LABELV $1642
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 116
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $1643
+LABELV $1638
+LABELV $1635
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $1238
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1238
+ADDRLP4 16
+INDIRI4
+CNSTI4 83
+EQI4 $1238
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1678
+ADDRLP4 12
+ADDRGP4 $1679
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1684
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1680
+LABELV $1684
+ADDRGP4 $1685
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1680
+ADDRLP4 92
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 1
+LTI4 $1688
+ADDRLP4 104
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $1686
+LABELV $1688
+ADDRGP4 $1238
+JUMPV
+LABELV $1686
+ADDRLP4 108
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 96
+CNSTI4 52
+ADDRLP4 108
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_TimedItemPickup
+CALLV
+pop
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_audioAnnouncer+12
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $1694
+ADDRGP4 cg_audioAnnouncerPowerup+12
+INDIRI4
+ADDRLP4 112
+INDIRI4
+NEI4 $1690
+LABELV $1694
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+LABELV $1690
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1695
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_QUAD
+INDIRI4
+NEI4 $1697
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $1698
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 cgs+632912+1317480
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1698
+JUMPV
+LABELV $1697
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+NEI4 $1704
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $1705
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 cgs+632912+1317484
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1705
+JUMPV
+LABELV $1704
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_HASTE
+INDIRI4
+NEI4 $1711
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $1712
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 cgs+632912+1317488
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1712
+JUMPV
+LABELV $1711
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_INVIS
+INDIRI4
+NEI4 $1718
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $1719
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 cgs+632912+1317492
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1719
+JUMPV
+LABELV $1718
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REGEN
+INDIRI4
+NEI4 $1725
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $1726
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 cgs+632912+1317496
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1726
+JUMPV
+LABELV $1725
+ADDRGP4 $1734
+ARGP4
+ADDRLP4 116
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $1734
+ARGP4
+ADDRLP4 116
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 120
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $1732
+ADDRGP4 $1735
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1732
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 124
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $1726
+LABELV $1719
+LABELV $1712
+LABELV $1705
+LABELV $1698
+LABELV $1695
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $1238
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1238
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1740
+ADDRLP4 12
+ADDRGP4 $1741
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1746
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1742
+LABELV $1746
+ADDRGP4 $1747
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1742
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1748
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1748
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $1238
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1238
+ADDRGP4 CG_OutOfAmmoChange
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1753
+ADDRLP4 12
+ADDRGP4 $1754
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1759
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1755
+LABELV $1759
+ADDRGP4 $1760
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1755
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1238
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1763
+ADDRLP4 12
+ADDRGP4 $1764
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1769
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1765
+LABELV $1769
+ADDRGP4 $1770
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1765
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1771
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1771
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+492652
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1775
+ADDRLP4 12
+ADDRGP4 $1776
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1781
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1777
+LABELV $1781
+ADDRGP4 $1782
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1777
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1783
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1785
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1785
+ADDRGP4 $1786
+JUMPV
+LABELV $1785
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1786
+LABELV $1783
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1238
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_FireWeapon
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1791
+ADDRLP4 12
+ADDRGP4 $1792
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1797
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1793
+LABELV $1797
+ADDRGP4 $1798
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1793
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1799
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1799
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1801
+ADDRLP4 12
+ADDRGP4 $1802
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1807
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1803
+LABELV $1807
+ADDRGP4 $1808
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1803
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1809
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1809
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1811
+ADDRLP4 12
+ADDRGP4 $1812
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1817
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1813
+LABELV $1817
+ADDRGP4 $1818
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1813
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1819
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1819
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1821
+ADDRLP4 12
+ADDRGP4 $1822
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1827
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1823
+LABELV $1827
+ADDRGP4 $1828
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1823
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1829
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1829
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1831
+ADDRLP4 12
+ADDRGP4 $1832
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1837
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1833
+LABELV $1837
+ADDRGP4 $1838
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1833
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1839
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1839
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1841
+ADDRLP4 12
+ADDRGP4 $1842
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1847
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1843
+LABELV $1847
+ADDRGP4 $1848
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1843
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1849
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1849
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1851
+ADDRLP4 12
+ADDRGP4 $1852
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1857
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1853
+LABELV $1857
+ADDRGP4 $1858
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1853
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1859
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1859
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1861
+ADDRLP4 12
+ADDRGP4 $1862
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1867
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1863
+LABELV $1867
+ADDRGP4 $1868
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1863
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1869
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1869
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1871
+ADDRLP4 12
+ADDRGP4 $1872
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1877
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1873
+LABELV $1877
+ADDRGP4 $1878
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1873
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1879
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1879
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1881
+ADDRLP4 12
+ADDRGP4 $1882
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1887
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1883
+LABELV $1887
+ADDRGP4 $1888
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1883
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1889
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1889
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1891
+ADDRLP4 12
+ADDRGP4 $1892
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1897
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1893
+LABELV $1897
+ADDRGP4 $1898
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1893
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1899
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1899
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1901
+ADDRLP4 12
+ADDRGP4 $1902
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1907
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1903
+LABELV $1907
+ADDRGP4 $1908
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1903
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1909
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1909
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1911
+ADDRLP4 12
+ADDRGP4 $1912
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1917
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1913
+LABELV $1917
+ADDRGP4 $1918
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1913
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1919
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1919
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1921
+ADDRLP4 12
+ADDRGP4 $1922
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1927
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1923
+LABELV $1927
+ADDRGP4 $1928
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1923
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1929
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1929
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1931
+ADDRLP4 12
+ADDRGP4 $1932
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1937
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1933
+LABELV $1937
+ADDRGP4 $1938
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1933
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1939
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1939
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1941
+ADDRLP4 12
+ADDRGP4 $1942
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1947
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1943
+LABELV $1947
+ADDRGP4 $1948
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1943
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1949
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1949
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1951
+ADDRLP4 12
+ADDRGP4 $1952
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1957
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1953
+LABELV $1957
+ADDRGP4 $1958
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1953
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1959
+LABELV $1959
+ADDRGP4 EffectScripts+3834216
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1961
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 EffectScripts+3834216
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1961
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+492976
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffect
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1968
+ADDRLP4 12
+ADDRGP4 $1969
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1974
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1970
+LABELV $1974
+ADDRGP4 $1975
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1970
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1976
+LABELV $1976
+ADDRGP4 EffectScripts+3866984
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1978
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 EffectScripts+3866984
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1978
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+492980
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffect
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1985
+ADDRLP4 12
+ADDRGP4 $1986
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $1991
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1987
+LABELV $1991
+ADDRGP4 $1992
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1987
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+492988
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1995
+ADDRLP4 12
+ADDRGP4 $1996
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $2001
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1997
+LABELV $2001
+ADDRGP4 $2002
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1997
+ADDRLP4 112
+ADDRLP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+LTI4 $2005
+ADDRLP4 128
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $2003
+LABELV $2005
+ADDRGP4 $2006
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2003
+ADDRLP4 96
+CNSTI4 52
+ADDRLP4 112
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 96
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 3
+EQI4 $2010
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+NEI4 $2008
+LABELV $2010
+ADDRLP4 96
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $924
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2011
+ADDRGP4 $2012
+JUMPV
+LABELV $2011
+ADDRLP4 96
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $874
+ARGP4
+ADDRLP4 140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $2013
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 120
+CNSTF4 1203982208
+ASGNF4
+ADDRLP4 124
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $2018
+JUMPV
+LABELV $2015
+ADDRLP4 152
+CNSTI4 36
+ADDRLP4 92
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 152
+INDIRI4
+ADDRGP4 cg+691836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 152
+INDIRI4
+ADDRGP4 cg+691836+4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 92
+INDIRI4
+MULI4
+ADDRGP4 cg+691836+8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 120
+INDIRF4
+GEF4 $2027
+ADDRLP4 124
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 116
+INDIRF4
+ASGNF4
+LABELV $2027
+LABELV $2016
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2018
+ADDRLP4 92
+INDIRI4
+ADDRGP4 cg+691832
+INDIRI4
+LTI4 $2015
+CNSTI4 36
+ADDRLP4 124
+INDIRI4
+MULI4
+ADDRGP4 cg+691836+24
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $2014
+JUMPV
+LABELV $2013
+ADDRLP4 96
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $899
+ARGP4
+ADDRLP4 144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $2032
+ADDRGP4 $2033
+JUMPV
+LABELV $2032
+ADDRLP4 96
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $2036
+ARGP4
+ADDRLP4 148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2034
+LABELV $2034
+LABELV $2033
+LABELV $2014
+LABELV $2012
+LABELV $2008
+ADDRLP4 96
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2037
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_QUAD
+INDIRI4
+NEI4 $2039
+ADDRGP4 $2040
+JUMPV
+LABELV $2039
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+NEI4 $2041
+ADDRGP4 $2042
+JUMPV
+LABELV $2041
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REGEN
+INDIRI4
+NEI4 $2043
+LABELV $2043
+LABELV $2042
+LABELV $2040
+LABELV $2037
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+492988
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2047
+ADDRLP4 12
+ADDRGP4 $2048
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $2053
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $2049
+LABELV $2053
+ADDRGP4 $2054
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2049
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2055
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+493564
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2055
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+493568
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2061
+ADDRLP4 12
+ADDRGP4 $2062
+ASGNP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $2067
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $2063
+LABELV $2067
+ADDRGP4 $2068
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2063
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $2069
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+493572
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2069
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2073
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+493576
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2073
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+493580
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2079
+ADDRLP4 12
+ADDRGP4 $2080
+ASGNP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $2085
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $2081
+LABELV $2085
+ADDRGP4 $2086
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2081
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+493584
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2089
+ADDRLP4 12
+ADDRGP4 $2090
+ASGNP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $2095
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $2091
+LABELV $2095
+ADDRGP4 $2096
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2091
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 CG_KamikazeEffect
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2097
+ADDRLP4 12
+ADDRGP4 $2098
+ASGNP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $2103
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $2099
+LABELV $2103
+ADDRGP4 $2104
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2099
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ObeliskExplode
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2105
+ADDRLP4 12
+ADDRGP4 $2106
+ASGNP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $2111
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $2107
+LABELV $2111
+ADDRGP4 $2112
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2107
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 CG_ObeliskPain
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2113
+ADDRLP4 12
+ADDRGP4 $2114
+ASGNP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $2119
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $2115
+LABELV $2119
+ADDRGP4 $2120
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2115
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRGP4 CG_InvulnerabilityImpact
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2121
+ADDRLP4 12
+ADDRGP4 $2122
+ASGNP4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 100
+INDIRI4
+NEI4 $2127
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 100
+INDIRI4
+EQI4 $2123
+LABELV $2127
+ADDRGP4 $2128
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2123
+ADDRGP4 $2129
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 CG_InvulnerabilityJuiced
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2130
+ADDRLP4 12
+ADDRGP4 $2131
+ASGNP4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 100
+INDIRI4
+NEI4 $2136
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 100
+INDIRI4
+EQI4 $2132
+LABELV $2136
+ADDRGP4 $2137
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2132
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CG_LightningBoltBeam
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2138
+ADDRLP4 12
+ADDRGP4 $2139
+ASGNP4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 104
+INDIRI4
+NEI4 $2144
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 104
+INDIRI4
+EQI4 $2140
+LABELV $2144
+ADDRGP4 $2145
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2140
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ScorePlum
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2146
+ADDRLP4 12
+ADDRGP4 $2147
+ASGNP4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 108
+INDIRI4
+NEI4 $2152
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $2148
+LABELV $2152
+ADDRGP4 $2153
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2148
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DamagePlum
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2154
+ADDRLP4 12
+ADDRGP4 $2155
+ASGNP4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 108
+INDIRI4
+NEI4 $2160
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $2156
+LABELV $2160
+ADDRGP4 $2161
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2156
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRGP4 CG_MissileHitPlayer
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Wolfcam_LogMissileHit
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2162
+ADDRLP4 12
+ADDRGP4 $2163
+ASGNP4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 116
+INDIRI4
+NEI4 $2168
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 116
+INDIRI4
+EQI4 $2164
+LABELV $2168
+ADDRGP4 $2169
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2164
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2170
+ADDRLP4 12
+ADDRGP4 $2171
+ASGNP4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 120
+INDIRI4
+NEI4 $2176
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $2172
+LABELV $2176
+ADDRGP4 $2177
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2172
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2178
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRGP4 $2179
+ASGNP4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $2184
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 152
+INDIRI4
+EQI4 $2180
+LABELV $2184
+ADDRGP4 $2185
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2180
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2186
+ADDRGP4 $1184
+JUMPV
+LABELV $2186
+ADDRGP4 cg_railUseOwnColors+12
+INDIRI4
+CNSTI4 0
+EQI4 $2189
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $2189
+ADDRLP4 156
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 160
+ADDRLP4 156
+INDIRP4
+CNSTI4 204
+ADDP4
+ASGNP4
+ADDRLP4 128
+ADDRLP4 160
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 140
+ADDRLP4 156
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 160
+INDIRP4
+ADDRGP4 cg+3196860
+INDIRB
+ASGNB 12
+ADDRLP4 24
+INDIRP4
+CNSTI4 216
+ADDP4
+ADDRGP4 cg+3196872
+INDIRB
+ASGNB 12
+ADDRLP4 124
+CNSTI4 1
+ASGNI4
+LABELV $2189
+ADDRGP4 cg_railFromMuzzle+12
+INDIRI4
+CNSTI4 0
+EQI4 $2194
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2197
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $2197
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $2197
+ADDRLP4 156
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 156+8
+ADDRLP4 156+8
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRGP4 $2198
+JUMPV
+LABELV $2197
+ADDRLP4 168
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRLP4 172
+INDIRI4
+LTI4 $2203
+ADDRLP4 168
+INDIRI4
+CNSTI4 64
+GEI4 $2203
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31082572
+ADDP4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $2203
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRGP4 CG_GetWeaponFlashOrigin
+CALLV
+pop
+ADDRGP4 $2204
+JUMPV
+LABELV $2203
+ADDRLP4 156
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2204
+LABELV $2198
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CG_RailTrail
+CALLV
+pop
+ADDRGP4 $2195
+JUMPV
+LABELV $2194
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CG_RailTrail
+CALLV
+pop
+LABELV $2195
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $2206
+ADDRLP4 24
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 128
+INDIRB
+ASGNB 12
+ADDRLP4 24
+INDIRP4
+CNSTI4 216
+ADDP4
+ADDRLP4 140
+INDIRB
+ASGNB 12
+LABELV $2206
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 255
+EQI4 $2208
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $2208
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 156
+INDIRI4
+EQI4 $2210
+ADDRGP4 cgs+1957472
+INDIRI4
+ADDRLP4 156
+INDIRI4
+EQI4 $2210
+ADDRLP4 156
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+CNSTI4 284
+ARGI4
+ADDRLP4 160
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $2210
+ADDRGP4 $1238
+JUMPV
+LABELV $2210
+ADDRLP4 164
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2214
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 $2215
+JUMPV
+LABELV $2214
+CNSTI4 1496
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+52+12
+ADDP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2215
+ADDRLP4 268
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 164
+ADDRLP4 164
+INDIRF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 164+4
+INDIRF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 188+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 188+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 3229614080
+ASGNF4
+ADDRLP4 164
+ADDRLP4 164
+INDIRF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 164+4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 176+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 3229614080
+ADDRLP4 176+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 200
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRLP4 276
+CNSTP4 0
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 Wolfcam_WeaponTrace
+CALLV
+pop
+ADDRLP4 200+52
+INDIRI4
+CNSTI4 64
+GEI4 $1238
+ADDRLP4 280
+CNSTI4 2392
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+252+4
+ADDP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ADDRLP4 280
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 284
+CNSTI4 2392
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 wclients+1276+252+4
+ADDP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+ADDRLP4 284
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 20
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $1238
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $2244
+ADDRLP4 288
+CNSTI4 4524
+ASGNI4
+ADDRLP4 288
+INDIRI4
+ADDRLP4 200+52
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2247
+ADDRLP4 288
+INDIRI4
+ADDRLP4 200+52
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 288
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+EQI4 $2247
+ADDRGP4 wcg+31087188
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $2247
+CNSTI4 4524
+ADDRLP4 200+52
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRGP4 wcg+31087192
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $2244
+CNSTI4 1496
+ADDRLP4 200+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2262
+ADDRGP4 $1238
+JUMPV
+LABELV $2262
+ADDRGP4 wcg+31087188
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $2267
+ADDRLP4 12
+ADDRGP4 $2268
+ASGNP4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 124
+INDIRI4
+NEI4 $2273
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 124
+INDIRI4
+EQI4 $2269
+LABELV $2273
+ADDRGP4 $2274
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2269
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1022
+ARGI4
+ADDRGP4 CG_Bullet
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2275
+ADDRLP4 12
+ADDRGP4 $2276
+ASGNP4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 128
+INDIRI4
+NEI4 $2281
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 128
+INDIRI4
+EQI4 $2277
+LABELV $2281
+ADDRGP4 $2282
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2277
+ADDRLP4 128
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+LTI4 $2283
+ADDRLP4 128
+INDIRI4
+CNSTI4 64
+GEI4 $2283
+ADDRLP4 132
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+NEI4 $2286
+ADDRLP4 136
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+72+4
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 140
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+1276+72+4
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRGP4 $2287
+JUMPV
+LABELV $2286
+ADDRLP4 132
+INDIRI4
+CNSTI4 13
+NEI4 $2294
+ADDRLP4 136
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+468+4
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 140
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+1276+468+4
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRGP4 $2295
+JUMPV
+LABELV $2294
+ADDRLP4 132
+INDIRI4
+CNSTI4 14
+NEI4 $2302
+ADDRLP4 136
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+504+4
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 140
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+1276+504+4
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+LABELV $2302
+LABELV $2295
+LABELV $2287
+LABELV $2283
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2310
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $2312
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GEI4 $2315
+ADDRGP4 wcg+31087188
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2316
+JUMPV
+LABELV $2315
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $2319
+ADDRLP4 132
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 64
+GEI4 $2322
+CNSTI4 4524
+ADDRLP4 132
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2322
+ADDRLP4 136
+CNSTI4 4524
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 136
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+EQI4 $2325
+ADDRGP4 wcg+31087188
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2326
+JUMPV
+LABELV $2325
+ADDRGP4 wcg+31087192
+CNSTI4 1
+ASGNI4
+LABELV $2326
+LABELV $2322
+LABELV $2319
+LABELV $2316
+LABELV $2312
+LABELV $2310
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_ClientInSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2334
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_ClientInSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $2334
+ADDRLP4 176
+CNSTI4 1496
+ASGNI4
+ADDRLP4 152
+ADDRLP4 176
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 184
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 152
+INDIRF4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 184
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 152+4
+INDIRF4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 184
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 152+8
+INDIRF4
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $2334
+ADDRGP4 EffectScripts+393264+163864
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2346
+ADDRLP4 140
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $2352
+ADDRLP4 144
+INDIRI4
+CNSTI4 64
+LTI4 $2350
+LABELV $2352
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $2350
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+CNSTI4 1496
+ADDRLP4 140
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRLP4 32
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+72
+CNSTF4 0
+ASGNF4
+ADDRGP4 ScriptVars+72+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 ScriptVars+72+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_ClientInSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $2360
+ADDRGP4 ScriptVars+72
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+72+4
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+72+8
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+8
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2360
+LABELV $2361
+ADDRGP4 EffectScripts+393264+163864
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2346
+ADDRGP4 EffectScripts+4063592
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2374
+ADDRLP4 140
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $2379
+ADDRLP4 144
+INDIRI4
+CNSTI4 64
+LTI4 $2377
+LABELV $2379
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $2377
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+CNSTI4 1496
+ADDRLP4 140
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRLP4 32
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+72
+CNSTF4 0
+ASGNF4
+ADDRGP4 ScriptVars+72+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 ScriptVars+72+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_ClientInSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $2387
+ADDRGP4 ScriptVars+72
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+72+4
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+72+8
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+8
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2387
+LABELV $2388
+ADDRGP4 EffectScripts+4063592
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2374
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bullet
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ImpactSparks
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2400
+ADDRLP4 12
+ADDRGP4 $2401
+ASGNP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $2406
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 140
+INDIRI4
+EQI4 $2402
+LABELV $2406
+ADDRGP4 $2407
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2402
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_ShotgunFire
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2408
+ADDRLP4 12
+ADDRGP4 $2409
+ASGNP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $2414
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 140
+INDIRI4
+EQI4 $2410
+LABELV $2414
+ADDRGP4 $2415
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2410
+ADDRLP4 140
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2416
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+CNSTI4 0
+NEI4 $2419
+ADDRGP4 $1238
+JUMPV
+LABELV $2419
+ADDRLP4 144
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+ADDRLP4 144
+INDIRI4
+NEI4 $2422
+ADDRLP4 140
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_AllowedAmbientSound
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2422
+ADDRGP4 $1238
+JUMPV
+LABELV $2422
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2416
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $2427
+ADDRLP4 140
+INDIRI4
+CNSTI4 274
+ADDI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRGP4 $2428
+JUMPV
+LABELV $2427
+ADDRLP4 140
+INDIRI4
+CNSTI4 274
+ADDI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 144
+INDIRP4
+ASGNP4
+LABELV $2428
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2430
+ADDRLP4 12
+ADDRGP4 $2431
+ASGNP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $2436
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 140
+INDIRI4
+EQI4 $2432
+LABELV $2436
+ADDRGP4 $2437
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2432
+ADDRLP4 140
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2438
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+CNSTI4 0
+NEI4 $2441
+ADDRGP4 $1238
+JUMPV
+LABELV $2441
+ADDRLP4 144
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+ADDRLP4 144
+INDIRI4
+NEI4 $2444
+ADDRLP4 140
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_AllowedAmbientSound
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2444
+ADDRGP4 $1238
+JUMPV
+LABELV $2444
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $2448
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2448
+CNSTP4 0
+ARGP4
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2438
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $2454
+ADDRLP4 140
+INDIRI4
+CNSTI4 274
+ADDI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRGP4 $2455
+JUMPV
+LABELV $2454
+ADDRLP4 140
+INDIRI4
+CNSTI4 274
+ADDI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 144
+INDIRP4
+ASGNP4
+LABELV $2455
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $2457
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2457
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2461
+ADDRLP4 12
+ADDRGP4 $2462
+ASGNP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $2467
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 140
+INDIRI4
+EQI4 $2463
+LABELV $2467
+ADDRGP4 $2468
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2463
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2469
+ADDRGP4 $1238
+JUMPV
+LABELV $2469
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2472
+ADDRLP4 144
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $2473
+JUMPV
+LABELV $2472
+ADDRLP4 144
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2473
+ADDRLP4 140
+CNSTI4 4524
+ADDRLP4 144
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $2478
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $2483
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $2478
+LABELV $2483
+ADDRLP4 148
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+LTI4 $2484
+ADDRLP4 148
+INDIRI4
+CNSTI4 13
+GTI4 $2685
+ADDRLP4 148
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2686
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2686
+address $2487
+address $2494
+address $2501
+address $2521
+address $2541
+address $2579
+address $2617
+address $2622
+address $2627
+address $2484
+address $2645
+address $2669
+address $2675
+address $2681
+code
+LABELV $2685
+ADDRLP4 148
+INDIRI4
+CNSTI4 999
+EQI4 $2663
+ADDRGP4 $2484
+JUMPV
+LABELV $2487
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2488
+ADDRGP4 cgs+632912+493312
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2488
+ADDRGP4 cgs+632912+493316
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2494
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2495
+ADDRGP4 cgs+632912+493312
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2495
+ADDRGP4 cgs+632912+493316
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2501
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2502
+ADDRGP4 cgs+632912+493320
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2503
+JUMPV
+LABELV $2502
+ADDRGP4 cgs+632912+493324
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $2503
+ADDRGP4 cg_audioAnnouncerFlagStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2511
+ADDRGP4 cgs+632912+493344
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2511
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2515
+ADDRGP4 cgs+632912+493348
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2515
+ADDRGP4 cgs+632912+493336
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2521
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2522
+ADDRGP4 cgs+632912+493320
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2523
+JUMPV
+LABELV $2522
+ADDRGP4 cgs+632912+493324
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $2523
+ADDRGP4 cg_audioAnnouncerFlagStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2531
+ADDRGP4 cgs+632912+493344
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2531
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2535
+ADDRGP4 cgs+632912+493348
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2535
+ADDRGP4 cgs+632912+493340
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2541
+ADDRLP4 156
+CNSTI4 2
+ASGNI4
+ADDRLP4 160
+CNSTI4 356
+ASGNI4
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ADDRLP4 156
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 164
+INDIRI4
+NEI4 $2546
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ADDRLP4 156
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 164
+INDIRI4
+EQI4 $2542
+LABELV $2546
+ADDRGP4 $1184
+JUMPV
+LABELV $2542
+ADDRGP4 cg_audioAnnouncerFlagStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $2547
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2550
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2552
+ADDRGP4 cgs+632912+493372
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2551
+JUMPV
+LABELV $2552
+ADDRGP4 cgs+632912+493360
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2551
+JUMPV
+LABELV $2550
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2559
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2561
+ADDRGP4 cgs+632912+493368
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2562
+JUMPV
+LABELV $2561
+ADDRGP4 cgs+632912+493356
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $2562
+LABELV $2559
+LABELV $2551
+LABELV $2547
+ADDRGP4 cg_flagTakenSound+12
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2571
+ADDRGP4 cgs+632912+493332
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2571
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $1184
+ADDRGP4 cgs+632912+493328
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2579
+ADDRLP4 168
+CNSTI4 2
+ASGNI4
+ADDRLP4 172
+CNSTI4 356
+ASGNI4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 176
+INDIRI4
+NEI4 $2584
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $2580
+LABELV $2584
+ADDRGP4 $1184
+JUMPV
+LABELV $2580
+ADDRGP4 cg_audioAnnouncerFlagStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $2585
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2588
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2590
+ADDRGP4 cgs+632912+493372
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2589
+JUMPV
+LABELV $2590
+ADDRGP4 cgs+632912+493360
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2589
+JUMPV
+LABELV $2588
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2597
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2599
+ADDRGP4 cgs+632912+493368
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2600
+JUMPV
+LABELV $2599
+ADDRGP4 cgs+632912+493356
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $2600
+LABELV $2597
+LABELV $2589
+LABELV $2585
+ADDRGP4 cg_flagTakenSound+12
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2609
+ADDRGP4 cgs+632912+493332
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2609
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $1184
+ADDRGP4 cgs+632912+493328
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2617
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $1184
+ADDRGP4 cgs+632912+493376
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2622
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $1184
+ADDRGP4 cgs+632912+493376
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2627
+ADDRGP4 cg_audioAnnouncerScore+12
+INDIRI4
+CNSTI4 0
+EQI4 $2628
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2631
+ADDRGP4 cgs+632912+493276
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2632
+JUMPV
+LABELV $2631
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2635
+ADDRGP4 cgs+632912+493280
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2636
+JUMPV
+LABELV $2635
+ADDRGP4 cgs+632912+493256
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $2636
+LABELV $2632
+LABELV $2628
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $1184
+ADDRGP4 $2644
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2645
+ADDRGP4 cg_audioAnnouncerScore+12
+INDIRI4
+CNSTI4 0
+EQI4 $2646
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2649
+ADDRGP4 cgs+632912+493276
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2650
+JUMPV
+LABELV $2649
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2653
+ADDRGP4 cgs+632912+493280
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2654
+JUMPV
+LABELV $2653
+ADDRGP4 cgs+632912+493260
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $2654
+LABELV $2650
+LABELV $2646
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $1184
+ADDRGP4 $2662
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2663
+ADDRGP4 cg_audioAnnouncerLead+12
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+ADDRGP4 cgs+632912+493264
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2669
+ADDRGP4 cg_audioAnnouncerLead+12
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+ADDRGP4 cgs+632912+493268
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2675
+ADDRGP4 cg_audioAnnouncerLead+12
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+ADDRGP4 cgs+632912+493272
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2681
+ADDRGP4 cgs+632912+492876
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2484
+ADDRGP4 $2684
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1184
+JUMPV
+LABELV $2478
+ADDRLP4 148
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+LTI4 $2687
+ADDRLP4 148
+INDIRI4
+CNSTI4 24
+GTI4 $2687
+ADDRLP4 148
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3078
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3078
+address $2690
+address $2697
+address $2704
+address $2724
+address $2744
+address $2783
+address $2822
+address $2827
+address $2832
+address $2850
+address $2868
+address $2875
+address $2882
+address $2889
+address $2919
+address $2913
+address $2899
+address $2892
+address $2906
+address $2925
+address $2937
+address $3056
+address $3040
+address $2962
+address $3072
+code
+LABELV $2690
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2691
+ADDRGP4 cgs+632912+493312
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2691
+ADDRGP4 cgs+632912+493316
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2697
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2698
+ADDRGP4 cgs+632912+493312
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2698
+ADDRGP4 cgs+632912+493316
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2704
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2705
+ADDRGP4 cgs+632912+493320
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2706
+JUMPV
+LABELV $2705
+ADDRGP4 cgs+632912+493324
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $2706
+ADDRGP4 cg_audioAnnouncerFlagStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2714
+ADDRGP4 cgs+632912+493344
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2714
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2718
+ADDRGP4 cgs+632912+493348
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2718
+ADDRGP4 cgs+632912+493340
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2724
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2725
+ADDRGP4 cgs+632912+493320
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2726
+JUMPV
+LABELV $2725
+ADDRGP4 cgs+632912+493324
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $2726
+ADDRGP4 cg_audioAnnouncerFlagStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2734
+ADDRGP4 cgs+632912+493344
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2734
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2738
+ADDRGP4 cgs+632912+493348
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2738
+ADDRGP4 cgs+632912+493336
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2744
+ADDRLP4 156
+CNSTI4 2
+ASGNI4
+ADDRLP4 160
+CNSTI4 356
+ASGNI4
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ADDRLP4 156
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 164
+INDIRI4
+NEI4 $2749
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ADDRLP4 156
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 164
+INDIRI4
+EQI4 $2745
+LABELV $2749
+ADDRGP4 $1238
+JUMPV
+LABELV $2745
+ADDRGP4 cg_audioAnnouncerFlagStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $2750
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $2750
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2754
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2756
+ADDRGP4 cgs+632912+493372
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2755
+JUMPV
+LABELV $2756
+ADDRGP4 cgs+632912+493356
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2755
+JUMPV
+LABELV $2754
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2763
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2765
+ADDRGP4 cgs+632912+493368
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2766
+JUMPV
+LABELV $2765
+ADDRGP4 cgs+632912+493360
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $2766
+LABELV $2763
+LABELV $2755
+LABELV $2750
+ADDRGP4 cg_flagTakenSound+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2775
+ADDRGP4 cgs+632912+493332
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2775
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $1238
+ADDRGP4 cgs+632912+493328
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2783
+ADDRLP4 168
+CNSTI4 2
+ASGNI4
+ADDRLP4 172
+CNSTI4 356
+ASGNI4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 176
+INDIRI4
+NEI4 $2788
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $2784
+LABELV $2788
+ADDRGP4 $1238
+JUMPV
+LABELV $2784
+ADDRGP4 cg_audioAnnouncerFlagStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $2789
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $2789
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2793
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2795
+ADDRGP4 cgs+632912+493372
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2794
+JUMPV
+LABELV $2795
+ADDRGP4 cgs+632912+493356
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2794
+JUMPV
+LABELV $2793
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2802
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2804
+ADDRGP4 cgs+632912+493368
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2805
+JUMPV
+LABELV $2804
+ADDRGP4 cgs+632912+493360
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $2805
+LABELV $2802
+LABELV $2794
+LABELV $2789
+ADDRGP4 cg_flagTakenSound+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2814
+ADDRGP4 cgs+632912+493332
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2814
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $1238
+ADDRGP4 cgs+632912+493328
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2822
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $1238
+ADDRGP4 cgs+632912+493376
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2827
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $1238
+ADDRGP4 cgs+632912+493376
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2832
+ADDRGP4 cg_audioAnnouncerScore+12
+INDIRI4
+CNSTI4 0
+EQI4 $2833
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $2833
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2837
+ADDRGP4 cgs+632912+493276
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2838
+JUMPV
+LABELV $2837
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2841
+ADDRGP4 cgs+632912+493280
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2842
+JUMPV
+LABELV $2841
+ADDRGP4 cgs+632912+493256
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $2842
+LABELV $2838
+LABELV $2833
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $1238
+ADDRGP4 $2644
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2850
+ADDRGP4 cg_audioAnnouncerScore+12
+INDIRI4
+CNSTI4 0
+EQI4 $2851
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $2851
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+NEI4 $2855
+ADDRGP4 cgs+632912+493276
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2856
+JUMPV
+LABELV $2855
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $2859
+ADDRGP4 cgs+632912+493280
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $2860
+JUMPV
+LABELV $2859
+ADDRGP4 cgs+632912+493260
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $2860
+LABELV $2856
+LABELV $2851
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $1238
+ADDRGP4 $2662
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2868
+ADDRGP4 cg_audioAnnouncerLead+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $1238
+ADDRGP4 cgs+632912+493264
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2875
+ADDRGP4 cg_audioAnnouncerLead+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $1238
+ADDRGP4 cgs+632912+493268
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2882
+ADDRGP4 cg_audioAnnouncerLead+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $1238
+ADDRGP4 cgs+632912+493272
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2889
+ADDRGP4 cgs+632912+492876
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2892
+ADDRGP4 cg_audioAnnouncerRound+12
+INDIRI4
+CNSTI4 0
+EQI4 $2893
+ADDRGP4 cgs+632912+493296
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $2893
+ADDRGP4 $2898
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2899
+ADDRGP4 cg_audioAnnouncerRound+12
+INDIRI4
+CNSTI4 0
+EQI4 $2900
+ADDRGP4 cgs+632912+493292
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $2900
+ADDRGP4 $2905
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2906
+ADDRGP4 cg_audioAnnouncerRound+12
+INDIRI4
+CNSTI4 0
+EQI4 $2907
+ADDRGP4 cgs+632912+493304
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $2907
+ADDRGP4 $2912
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2913
+ADDRGP4 cg_audioAnnouncerWin+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRGP4 cgs+632912+493288
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2919
+ADDRGP4 cg_audioAnnouncerWin+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRGP4 cgs+632912+493284
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2925
+ADDRGP4 cg_audioAnnouncerLastStanding+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 180
+INDIRI4
+NEI4 $1238
+ADDRLP4 184
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 184
+INDIRI4
+EQI4 $2934
+ADDRLP4 184
+INDIRI4
+ADDRLP4 180
+INDIRI4
+NEI4 $1238
+LABELV $2934
+ADDRGP4 cgs+632912+493384
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2937
+ADDRGP4 cg_audioAnnouncerRound+12
+INDIRI4
+CNSTI4 0
+EQI4 $2938
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $2941
+ADDRGP4 cgs+1960920
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $2941
+ADDRGP4 cg+6747456
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2941
+ADDRGP4 $2942
+JUMPV
+LABELV $2941
+ADDRGP4 cgs+632912+493400
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $2942
+LABELV $2938
+ADDRLP4 320
+CNSTI1 0
+ASGNI1
+ADDRLP4 320
+ARGP4
+ADDRGP4 $2949
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+CNSTI4 705
+ARGI4
+ADDRLP4 1344
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 184
+ADDRLP4 1344
+INDIRP4
+ASGNP4
+ADDRLP4 180
+ADDRLP4 192
+ASGNP4
+ADDRGP4 $2951
+JUMPV
+LABELV $2950
+ADDRLP4 180
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1348
+ADDRLP4 180
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+CNSTI4 32
+EQI4 $2955
+ADDRLP4 1348
+INDIRI4
+CNSTI4 0
+NEI4 $2953
+LABELV $2955
+ADDRLP4 180
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 192
+ARGP4
+ADDRLP4 1352
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 1352
+INDIRI4
+ASGNI4
+ADDRLP4 1356
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+CNSTI4 0
+LTI4 $2956
+ADDRLP4 1356
+INDIRI4
+CNSTI4 64
+GEI4 $2956
+ADDRLP4 320
+ARGP4
+CNSTI4 4524
+ADDRLP4 188
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 320
+ARGP4
+ADDRGP4 $2960
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $2956
+ADDRLP4 180
+ADDRLP4 192
+ASGNP4
+LABELV $2953
+ADDRLP4 1352
+CNSTI4 1
+ASGNI4
+ADDRLP4 180
+ADDRLP4 180
+INDIRP4
+ADDRLP4 1352
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 184
+ADDRLP4 184
+INDIRP4
+ADDRLP4 1352
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $2951
+ADDRLP4 184
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2950
+ADDRGP4 $2961
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRLP4 1348
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1348
+INDIRP4
+ARGP4
+CNSTF4 1119879168
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2962
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $2963
+ADDRGP4 $1238
+JUMPV
+LABELV $2963
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2966
+ADDRLP4 180
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2967
+JUMPV
+LABELV $2966
+ADDRLP4 180
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2967
+ADDRLP4 184
+ADDRGP4 $161
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2972
+ADDRLP4 184
+ADDRGP4 $2974
+ASGNP4
+ADDRGP4 $2973
+JUMPV
+LABELV $2972
+ADDRLP4 184
+ADDRGP4 $2975
+ASGNP4
+LABELV $2973
+ADDRLP4 192
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 1
+LTI4 $2976
+ADDRLP4 192
+INDIRI4
+CNSTI4 5
+GTI4 $2976
+ADDRLP4 192
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2989-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2989
+address $2979
+address $2981
+address $2983
+address $2985
+address $2987
+code
+LABELV $2979
+ADDRLP4 188
+ADDRGP4 $2980
+ASGNP4
+ADDRGP4 $2977
+JUMPV
+LABELV $2981
+ADDRLP4 188
+ADDRGP4 $2982
+ASGNP4
+ADDRGP4 $2977
+JUMPV
+LABELV $2983
+ADDRLP4 188
+ADDRGP4 $2984
+ASGNP4
+ADDRGP4 $2977
+JUMPV
+LABELV $2985
+ADDRLP4 188
+ADDRGP4 $2986
+ASGNP4
+ADDRGP4 $2977
+JUMPV
+LABELV $2987
+ADDRLP4 188
+ADDRGP4 $2988
+ASGNP4
+ADDRGP4 $2977
+JUMPV
+LABELV $2976
+ADDRLP4 188
+ADDRGP4 $161
+ASGNP4
+LABELV $2977
+ADDRLP4 200
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 1
+EQI4 $2993
+ADDRLP4 200
+INDIRI4
+CNSTI4 2
+NEI4 $2991
+LABELV $2993
+ADDRGP4 cg_audioAnnouncerDominationPoint+12
+INDIRI4
+CNSTI4 0
+EQI4 $2994
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+NEI4 $2997
+ADDRLP4 204
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+LTI4 $2998
+ADDRLP4 204
+INDIRI4
+CNSTI4 5
+GTI4 $2998
+ADDRLP4 204
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3017-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3017
+address $3002
+address $3005
+address $3008
+address $3011
+address $3014
+code
+LABELV $3002
+ADDRGP4 cgs+632912+493424
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $2998
+JUMPV
+LABELV $3005
+ADDRGP4 cgs+632912+493428
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $2998
+JUMPV
+LABELV $3008
+ADDRGP4 cgs+632912+493432
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $2998
+JUMPV
+LABELV $3011
+ADDRGP4 cgs+632912+493436
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $2998
+JUMPV
+LABELV $3014
+ADDRGP4 cgs+632912+493440
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $2998
+JUMPV
+LABELV $2997
+ADDRLP4 204
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+LTI4 $3020
+ADDRLP4 204
+INDIRI4
+CNSTI4 5
+GTI4 $3020
+ADDRLP4 204
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3037-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3037
+address $3022
+address $3025
+address $3028
+address $3031
+address $3034
+code
+LABELV $3022
+ADDRGP4 cgs+632912+493404
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3020
+JUMPV
+LABELV $3025
+ADDRGP4 cgs+632912+493408
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3020
+JUMPV
+LABELV $3028
+ADDRGP4 cgs+632912+493412
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3020
+JUMPV
+LABELV $3031
+ADDRGP4 cgs+632912+493416
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3020
+JUMPV
+LABELV $3034
+ADDRGP4 cgs+632912+493420
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $3020
+LABELV $2998
+LABELV $2994
+LABELV $2991
+ADDRGP4 $3039
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+CNSTF4 1119879168
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3040
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3041
+ADDRLP4 180
+CNSTI4 4524
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+EQI4 $3043
+ADDRGP4 $1238
+JUMPV
+LABELV $3043
+LABELV $3041
+ADDRGP4 cg_audioAnnouncerRoundReward+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRGP4 cgs+632912+493396
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3056
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3057
+ADDRLP4 180
+CNSTI4 4524
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+EQI4 $3059
+ADDRGP4 $1238
+JUMPV
+LABELV $3059
+LABELV $3057
+ADDRGP4 cg_audioAnnouncerRoundReward+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRGP4 cgs+632912+493088
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3072
+ADDRLP4 180
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+NEI4 $1238
+ADDRLP4 140
+INDIRI4
+ADDRLP4 180
+INDIRI4
+NEI4 $1238
+ADDRGP4 cgs+632912+493628
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $2687
+ADDRGP4 $3077
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3079
+ADDRLP4 12
+ADDRGP4 $3080
+ASGNP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $3085
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 140
+INDIRI4
+EQI4 $3081
+LABELV $3085
+ADDRGP4 $3086
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3081
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $3091
+ADDRGP4 cgs+1957780
+INDIRI4
+ADDRLP4 140
+INDIRI4
+EQI4 $3087
+LABELV $3091
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 CG_CheckClientEventCpma
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+CNSTI4 1496
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+LABELV $3087
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $1238
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PainEvent
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3095
+ADDRLP4 12
+ADDRGP4 $3096
+ASGNP4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 144
+INDIRI4
+NEI4 $3101
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 144
+INDIRI4
+EQI4 $3097
+LABELV $3101
+ADDRGP4 $3102
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3097
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 144
+INDIRI4
+NEI4 $3107
+ADDRGP4 cgs+1957780
+INDIRI4
+ADDRLP4 144
+INDIRI4
+EQI4 $3103
+LABELV $3107
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 CG_CheckClientEventCpma
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1496
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+LABELV $3103
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $3108
+CNSTI4 1496
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 CG_WaterLevel
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 3
+NEI4 $3108
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 $3111
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3108
+ADDRGP4 $3112
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 54
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3113
+ADDRLP4 12
+ADDRGP4 $3114
+ASGNP4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $3119
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 152
+INDIRI4
+EQI4 $3115
+LABELV $3119
+ADDRGP4 $3120
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3115
+ADDRLP4 152
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+LTI4 $3123
+ADDRLP4 152
+INDIRI4
+CNSTI4 64
+LTI4 $3121
+LABELV $3123
+ADDRGP4 $3124
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $3122
+JUMPV
+LABELV $3121
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3125
+ADDRLP4 156
+ADDRGP4 cg+607704+900
+ASGNP4
+ADDRGP4 $3126
+JUMPV
+LABELV $3125
+ADDRLP4 156
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900
+ADDP4
+ASGNP4
+LABELV $3126
+ADDRLP4 156
+INDIRP4
+CNSTI4 212
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $3122
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Obituary
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3132
+ADDRLP4 12
+ADDRGP4 $3133
+ASGNP4
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $3138
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 156
+INDIRI4
+EQI4 $3134
+LABELV $3138
+ADDRGP4 $3139
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3134
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $3140
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $3140
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $3111
+ARGP4
+ADDRLP4 156
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3142
+ADDRLP4 12
+ADDRGP4 $3143
+ASGNP4
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 188
+INDIRI4
+NEI4 $3148
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $3144
+LABELV $3148
+ADDRGP4 $3149
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3144
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 188
+INDIRI4
+NEI4 $3154
+ADDRGP4 cgs+1957780
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $3150
+LABELV $3154
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 CG_CheckClientEventCpma
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 192
+INDIRI4
+ASGNI4
+LABELV $3150
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3155
+ADDRGP4 cg+627152
+ADDRGP4 PW_QUAD
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627156
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $3155
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+632912+492644
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRLP4 192
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 180
+CNSTF4 1203982208
+ASGNF4
+ADDRLP4 184
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRGP4 $3166
+JUMPV
+LABELV $3163
+ADDRLP4 200
+CNSTI4 36
+ADDRLP4 160
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 200
+INDIRI4
+ADDRGP4 cg+693576
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 200
+INDIRI4
+ADDRGP4 cg+693576+4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 160
+INDIRI4
+MULI4
+ADDRGP4 cg+693576+8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRLP4 204
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+GEF4 $3175
+ADDRLP4 184
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 176
+INDIRF4
+ASGNF4
+LABELV $3175
+LABELV $3164
+ADDRLP4 160
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3166
+ADDRLP4 160
+INDIRI4
+ADDRGP4 cg+693572
+INDIRI4
+LTI4 $3163
+ADDRLP4 196
+CNSTI4 36
+ADDRLP4 184
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 200
+CNSTI4 1000
+ASGNI4
+ADDRLP4 196
+INDIRI4
+ADDRGP4 cg+693576+16
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+DIVI4
+ADDRLP4 196
+INDIRI4
+ADDRGP4 cg+693576+12
+ADDP4
+INDIRI4
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 200
+INDIRI4
+DIVI4
+GTI4 $1238
+CNSTI4 36
+ADDRLP4 184
+INDIRI4
+MULI4
+ADDRGP4 cg+693576+16
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $3187
+ADDRLP4 12
+ADDRGP4 $3188
+ASGNP4
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 188
+INDIRI4
+NEI4 $3193
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $3189
+LABELV $3193
+ADDRGP4 $3194
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3189
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 188
+INDIRI4
+NEI4 $3199
+ADDRGP4 cgs+1957780
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $3195
+LABELV $3199
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 CG_CheckClientEventCpma
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 192
+INDIRI4
+ASGNI4
+LABELV $3195
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3200
+ADDRGP4 cg+627152
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627156
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $3200
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+632912+493556
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRLP4 192
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 180
+CNSTF4 1203982208
+ASGNF4
+ADDRLP4 184
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRGP4 $3211
+JUMPV
+LABELV $3208
+ADDRLP4 200
+CNSTI4 36
+ADDRLP4 160
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 200
+INDIRI4
+ADDRGP4 cg+694156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 200
+INDIRI4
+ADDRGP4 cg+694156+4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 160
+INDIRI4
+MULI4
+ADDRGP4 cg+694156+8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRLP4 204
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+GEF4 $3220
+ADDRLP4 184
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 176
+INDIRF4
+ASGNF4
+LABELV $3220
+LABELV $3209
+ADDRLP4 160
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3211
+ADDRLP4 160
+INDIRI4
+ADDRGP4 cg+694152
+INDIRI4
+LTI4 $3208
+CNSTI4 36
+ADDRLP4 184
+INDIRI4
+MULI4
+ADDRGP4 cg+694156+16
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 196
+CNSTI4 36
+ADDRLP4 184
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 200
+CNSTI4 1000
+ASGNI4
+ADDRLP4 196
+INDIRI4
+ADDRGP4 cg+694156+16
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+DIVI4
+ADDRLP4 196
+INDIRI4
+ADDRGP4 cg+694156+12
+ADDP4
+INDIRI4
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 200
+INDIRI4
+DIVI4
+GEI4 $1238
+CNSTI4 36
+ADDRLP4 184
+INDIRI4
+MULI4
+ADDRGP4 cg+694156+16
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $3235
+ADDRLP4 12
+ADDRGP4 $3236
+ASGNP4
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 160
+INDIRI4
+NEI4 $3241
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 160
+INDIRI4
+EQI4 $3237
+LABELV $3241
+ADDRGP4 $3242
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3237
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 160
+INDIRI4
+NEI4 $3247
+ADDRGP4 cgs+1957780
+INDIRI4
+ADDRLP4 160
+INDIRI4
+EQI4 $3243
+LABELV $3247
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 CG_CheckClientEventCpma
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 164
+INDIRI4
+ASGNI4
+LABELV $3243
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3248
+ADDRGP4 cg+627152
+ADDRGP4 PW_REGEN
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627156
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $3248
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+632912+493552
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3256
+ADDRLP4 12
+ADDRGP4 $3257
+ASGNP4
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 164
+INDIRI4
+NEI4 $3262
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 164
+INDIRI4
+EQI4 $3258
+LABELV $3262
+ADDRGP4 $3263
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3258
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 164
+INDIRI4
+NEI4 $3268
+ADDRGP4 cgs+1957780
+INDIRI4
+ADDRLP4 164
+INDIRI4
+EQI4 $3264
+LABELV $3268
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 CG_CheckClientEventCpma
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 168
+INDIRI4
+ASGNI4
+LABELV $3264
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3269
+ADDRGP4 cg+627152
+ADDRGP4 PW_ARMORREGEN
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627156
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $3269
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+632912+493524
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3277
+ADDRLP4 12
+ADDRGP4 $3278
+ASGNP4
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 168
+INDIRI4
+NEI4 $3283
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 168
+INDIRI4
+EQI4 $3279
+LABELV $3283
+ADDRGP4 $3284
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3279
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $3285
+LABELV $3287
+LABELV $3285
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 168
+INDIRI4
+NEI4 $3293
+ADDRGP4 cgs+1957780
+INDIRI4
+ADDRLP4 168
+INDIRI4
+EQI4 $3289
+LABELV $3293
+LABELV $3289
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $3294
+ADDRGP4 $3297
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3294
+ADDRGP4 EffectScripts+3998056
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3298
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FX_GibPlayer
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3298
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $3301
+ADDRGP4 $3305
+ARGP4
+ADDRLP4 172
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $3303
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 180
+INDIRI4
+CNSTI4 4
+MODI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+LTI4 $3304
+ADDRLP4 176
+INDIRI4
+CNSTI4 3
+GTI4 $3304
+ADDRLP4 176
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3321
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3321
+address $3309
+address $3312
+address $3315
+address $3318
+code
+LABELV $3309
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+632912+492944
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $3304
+JUMPV
+LABELV $3312
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+632912+492948
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $3304
+JUMPV
+LABELV $3315
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+632912+492952
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $3304
+JUMPV
+LABELV $3318
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+632912+492956
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $3304
+JUMPV
+LABELV $3303
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+632912+492928
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $3304
+LABELV $3301
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_GibPlayer
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3324
+ADDRLP4 12
+ADDRGP4 $3325
+ASGNP4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $3330
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $3326
+LABELV $3330
+ADDRGP4 $3331
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3326
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $3332
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $3332
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StopLoopingSound
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $3334
+ADDRLP4 12
+ADDRGP4 $3335
+ASGNP4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $3340
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $3336
+LABELV $3340
+ADDRGP4 $3341
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3336
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Beam
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3342
+ADDRLP4 12
+ADDRGP4 $3343
+ASGNP4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $3348
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $3344
+LABELV $3348
+ADDRGP4 $3349
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3344
+CNSTI4 0
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRGP4 $3351
+ARGP4
+ADDRLP4 176
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $3350
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRGP4 $3351
+ARGP4
+ADDRLP4 184
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $3352
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 cgs+632912+492636
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3355
+ADDRLP4 12
+ADDRGP4 $3356
+ASGNP4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $3361
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $1238
+LABELV $3361
+ADDRGP4 $3362
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3363
+ADDRLP4 12
+ADDRGP4 $3364
+ASGNP4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $3369
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $3365
+LABELV $3369
+ADDRGP4 $3370
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3365
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $3371
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $3373
+ADDRGP4 $3376
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $3373
+LABELV $3371
+ADDRGP4 EffectScripts+4030824
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3377
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FX_ThawPlayer
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3377
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ThawPlayer
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3380
+ADDRLP4 12
+ADDRGP4 $3381
+ASGNP4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $3386
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $3382
+LABELV $3386
+ADDRGP4 $3387
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3382
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $3388
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $3390
+ADDRGP4 $3376
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $3390
+LABELV $3388
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+632912+493620
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3395
+ADDRLP4 12
+ADDRGP4 $3396
+ASGNP4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $3401
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $3397
+LABELV $3401
+ADDRGP4 $3402
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3397
+ADDRGP4 EffectScripts+3932520
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3403
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+360
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 EffectScripts+3932520
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3403
+ADDRGP4 cg_headShots+12
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CG_HeadShotPlum
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3412
+ADDRLP4 12
+ADDRGP4 $3413
+ASGNP4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 176
+INDIRI4
+NEI4 $3418
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $3414
+LABELV $3418
+ADDRGP4 $3419
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3414
+ADDRGP4 cg+6746840
+INDIRI4
+CNSTI4 128
+LTI4 $3420
+ADDRGP4 $1238
+JUMPV
+LABELV $3420
+ADDRLP4 172
+CNSTI4 28
+ADDRGP4 cg+6746840
+INDIRI4
+MULI4
+ADDRGP4 cg+6743256
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 172
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176
+ADDRGP4 cg+6746840
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $3427
+ADDRLP4 12
+ADDRGP4 $3428
+ASGNP4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $3433
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $3429
+LABELV $3433
+ADDRGP4 $3434
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3429
+ADDRLP4 172
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+LTI4 $3437
+ADDRLP4 172
+INDIRI4
+CNSTI4 64
+LTI4 $3435
+LABELV $3437
+ADDRGP4 $3438
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3435
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $3439
+ADDRGP4 cgs+632912+493632
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $3439
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3443
+ADDRGP4 cg+607704+900+192
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+607704+900+196
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+607704+900+200
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $3443
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+192
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+196
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+200
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $3461
+ADDRLP4 12
+ADDRGP4 $3462
+ASGNP4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $3467
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $3463
+LABELV $3467
+ADDRGP4 $3468
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3463
+ADDRLP4 172
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+LTI4 $3471
+ADDRLP4 172
+INDIRI4
+CNSTI4 64
+LTI4 $3469
+LABELV $3471
+ADDRGP4 $3472
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3469
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $3473
+ADDRGP4 cgs+632912+493632
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRLP4 176
+ADDRGP4 cgs+1969992
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 3
+GTI4 $3478
+ADDRGP4 $3480
+ARGP4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+CNSTF4 1135083520
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $3479
+JUMPV
+LABELV $3478
+ADDRGP4 $3481
+ARGP4
+CNSTF4 1135083520
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $3479
+LABELV $3473
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3482
+ADDRGP4 cg+607704+900+196
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+607704+900+200
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $3482
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+196
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+200
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $3495
+ADDRLP4 12
+ADDRGP4 $3496
+ASGNP4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $3501
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $3497
+LABELV $3501
+ADDRGP4 $3502
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3497
+ADDRLP4 172
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+LTI4 $3505
+ADDRLP4 172
+INDIRI4
+CNSTI4 64
+LTI4 $3503
+LABELV $3505
+ADDRGP4 $3506
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3503
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $3507
+ADDRGP4 cgs+632912+492632
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $3507
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3511
+ADDRGP4 cg+607704+900+196
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607704+900+200
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607704+900+208
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $3511
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+196
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+200
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1496
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+208
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $3529
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRGP4 $3530
+ASGNP4
+ADDRLP4 184
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 184
+INDIRI4
+NEI4 $3535
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 184
+INDIRI4
+EQI4 $3531
+LABELV $3535
+ADDRGP4 $3536
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3531
+ADDRLP4 184
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+LTI4 $3539
+ADDRLP4 184
+INDIRI4
+CNSTI4 64
+LTI4 $3537
+LABELV $3539
+ADDRGP4 $3540
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $3537
+ADDRLP4 176
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 188
+ADDRLP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+LTI4 $3542
+ADDRLP4 188
+INDIRI4
+CNSTI4 9
+GTI4 $3542
+ADDRLP4 188
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3627
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3627
+address $3545
+address $3553
+address $3561
+address $3569
+address $3577
+address $3585
+address $3593
+address $3601
+address $3609
+address $3617
+code
+LABELV $3545
+ADDRGP4 cg_rewardComboKill+12
+INDIRI4
+CNSTI4 0
+EQI4 $3543
+ADDRLP4 172
+ADDRGP4 cgs+632912+492504
+INDIRI4
+ASGNI4
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 200
+INDIRI4
+CNSTI4 3
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493124
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3543
+JUMPV
+LABELV $3553
+ADDRGP4 cg_rewardRampage+12
+INDIRI4
+CNSTI4 0
+EQI4 $3543
+ADDRLP4 172
+ADDRGP4 cgs+632912+492532
+INDIRI4
+ASGNI4
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 200
+INDIRI4
+CNSTI4 3
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493160
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3543
+JUMPV
+LABELV $3561
+ADDRGP4 cg_rewardMidAir+12
+INDIRI4
+CNSTI4 0
+EQI4 $3543
+ADDRLP4 172
+ADDRGP4 cgs+632912+492548
+INDIRI4
+ASGNI4
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 200
+INDIRI4
+CNSTI4 3
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3543
+JUMPV
+LABELV $3569
+ADDRGP4 cg_rewardRevenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $3543
+ADDRLP4 172
+ADDRGP4 cgs+632912+492536
+INDIRI4
+ASGNI4
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 200
+INDIRI4
+CNSTI4 3
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3543
+JUMPV
+LABELV $3577
+ADDRGP4 cg_rewardPerforated+12
+INDIRI4
+CNSTI4 0
+EQI4 $3543
+ADDRLP4 172
+ADDRGP4 cgs+632912+492524
+INDIRI4
+ASGNI4
+ADDRLP4 180
+ADDRGP4 cgs+632912+493152
+INDIRI4
+ASGNI4
+ADDRGP4 $3543
+JUMPV
+LABELV $3585
+ADDRGP4 cg_rewardHeadshot+12
+INDIRI4
+CNSTI4 0
+EQI4 $3543
+ADDRLP4 172
+ADDRGP4 cgs+632912+492540
+INDIRI4
+ASGNI4
+ADDRLP4 180
+ADDRGP4 cgs+632912+493200
+INDIRI4
+ASGNI4
+ADDRGP4 $3543
+JUMPV
+LABELV $3593
+ADDRGP4 cg_rewardAccuracy+12
+INDIRI4
+CNSTI4 0
+EQI4 $3543
+ADDRLP4 172
+ADDRGP4 cgs+632912+492516
+INDIRI4
+ASGNI4
+ADDRLP4 180
+ADDRGP4 cgs+632912+493144
+INDIRI4
+ASGNI4
+ADDRGP4 $3543
+JUMPV
+LABELV $3601
+ADDRGP4 cg_rewardQuadGod+12
+INDIRI4
+CNSTI4 0
+EQI4 $3543
+ADDRLP4 172
+ADDRGP4 cgs+632912+492528
+INDIRI4
+ASGNI4
+ADDRLP4 180
+ADDRGP4 cgs+632912+493156
+INDIRI4
+ASGNI4
+ADDRGP4 $3543
+JUMPV
+LABELV $3609
+ADDRGP4 cg_rewardFirstFrag+12
+INDIRI4
+CNSTI4 0
+EQI4 $3543
+ADDRLP4 172
+ADDRGP4 cgs+632912+492512
+INDIRI4
+ASGNI4
+ADDRLP4 180
+ADDRGP4 cgs+632912+493140
+INDIRI4
+ASGNI4
+ADDRGP4 $3543
+JUMPV
+LABELV $3617
+ADDRGP4 cg_rewardPerfect+12
+INDIRI4
+CNSTI4 0
+EQI4 $3543
+ADDRLP4 172
+ADDRGP4 cgs+632912+492520
+INDIRI4
+ASGNI4
+ADDRLP4 180
+ADDRGP4 cgs+632912+493148
+INDIRI4
+ASGNI4
+ADDRGP4 $3543
+JUMPV
+LABELV $3542
+ADDRGP4 $3625
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PrintEntityStatep
+CALLV
+pop
+ADDRGP4 $3626
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+LABELV $3543
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $3628
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $3629
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PushReward
+CALLV
+pop
+LABELV $3628
+LABELV $3629
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 176
+INDIRP4
+CNSTI4 4512
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRP4
+CNSTI4 4516
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRP4
+CNSTI4 4520
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $3635
+ADDRLP4 12
+ADDRGP4 $3636
+ASGNP4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $3641
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $3637
+LABELV $3641
+ADDRGP4 $3642
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3637
+ADDRGP4 cgs+632912+493636
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+6747456
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $1237
+ADDRLP4 12
+ADDRGP4 $3648
+ASGNP4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $3653
+ADDRGP4 cg_drawEventNumbers+12
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $3649
+LABELV $3653
+ADDRGP4 $3654
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3649
+ADDRLP4 16
+INDIRI4
+ADDRGP4 $3647
+INDIRI4
+EQI4 $1238
+ADDRGP4 $3657
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 1
+LEI4 $1238
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PrintEntityStatep
+CALLV
+pop
+LABELV $1238
+LABELV $1184
+endproc CG_EntityEvent 1360 48
+export CG_CheckEvents
+proc CG_CheckEvents 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LEI4 $3667
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3669
+ADDRGP4 $3666
+JUMPV
+LABELV $3669
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $3671
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3671
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+SUBI4
+ASGNI4
+ADDRGP4 $3668
+JUMPV
+LABELV $3667
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+NEI4 $3673
+ADDRGP4 $3666
+JUMPV
+LABELV $3673
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 0
+NEI4 $3675
+ADDRGP4 $3666
+JUMPV
+LABELV $3675
+LABELV $3668
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetEntitySoundPosition
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+LABELV $3666
+endproc CG_CheckEvents 8 12
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import Wolfcam_WeaponTrace
+import Wolfcam_LogMissileHit
+import wolfcam_log_event
+import find_best_target
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import CG_SpawnRailTrail
+import CG_AddWeaponWithPowerups
+import CG_MachinegunSpinAngle
+import CG_MapTorsoToWeaponFrame
+import CG_Bullet
+import CG_GetWeaponFlashOrigin
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_OutOfAmmoChange
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_DrawWeaponSelect
+import CG_AddViewWeapon
+import CG_AddPlayerWeapon
+import CG_LightningBolt
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_SimpleRailTrail
+import CG_DrawActiveFrame
+import CG_AdjustOriginToAvoidSolid
+import CG_CalcSpline
+import CG_AddBufferedSound
+import CG_AdjustedFov
+import CG_CalcZoom
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_CalcVrect
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_AddRealLoopingSound
+import CG_AddLoopingSound
+import CG_StartLocalSound
+import CG_StartSound
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_PushReward
+import CG_TransitionPlayerState
+import CG_CheckChangedPredictableEvents
+import CG_Respawn
+import CG_GetAmmoWarning
+import CG_PrintPlayerState
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_GetTeamColor
+import CG_RunMenuScript
+import CG_ShowResponseHead
+import CG_KeyEvent
+import CG_EventHandling
+import CG_MouseEvent
+import CG_OwnerDraw
+import CG_GetServerTimeFromClockString
+import CG_GetLevelTimerString
+import CG_GetCurrentTimeWithDirection
+import CG_DrawWeaponBar
+import CG_Text_Paint_Align
+import CG_Text_Paint_Limit_Bottom
+import CG_Text_Paint_Limit
+import CG_Text_Length
+import CG_GameTypeString
+import CG_GetGameStatusText
+import CG_GetKillerText
+import CG_OwnerDrawVisible
+import CG_YourTeamHasFlag
+import CG_OtherTeamHasFlag
+import CG_GetValue
+import CG_SelectPrevPlayer
+import CG_SelectNextPlayer
+import CG_CheckOrderPending
+import CG_SetPrintString
+import CG_InitTeamChat
+import MenuRect
+import QLWideScreen
+import MenuWidescreen
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_AddPacketEntities
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_SetEntitySoundPosition
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AllowedAmbientSound
+import CG_PrintEntityStatep
+import CG_PrintEntityState
+import CG_ThawPlayer
+import CG_GibPlayer
+import CG_FX_ThawPlayer
+import CG_FX_GibPlayer
+import CG_ImpactSparks
+import CG_Bleed
+import CG_MakeExplosion
+import CG_HeadShotPlum
+import CG_DamagePlum
+import CG_ScorePlum
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_LightningBoltBeam
+import CG_SpawnEffect
+import CG_SmokePuff
+import CG_BubbleTrail
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_ShutdownLocalEnts
+import CG_GetStoredScriptVarsFromLE
+import CG_RunFxAll
+import CG_SmokePuff_ql
+import CG_AddRefEntityFX
+import CG_AddRefEntity
+import CG_ListLocalEntities
+import CG_RemoveFXLocalEntities
+import CG_ClearLocalFrameEntities
+import CG_CullGrid
+import CG_AddToCullGrid
+import CG_BeginCullGrid
+import CG_AddLocalEntities
+import CG_MakeLowPriorityEntity
+import CG_AllocLocalEntityRealTime
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import FxLoopSounds
+import CG_FreeFxJitTokens
+import CG_ResetFXIntervalAndDistance
+import CG_UpdatePositionData
+import CG_CopyPositionDataToScript
+import CG_CopyPositionDataToCent
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+import CG_CopyPlayerDataToScriptData
+import CG_ResetScriptVars
+import CG_ReloadQ3mmeScripts
+import CG_RunQ3mmeScript
+import CG_Q3mmeMath
+import EffectScripts
+import PlainScript
+import DistanceScript
+import EmitterScript
+import EmitterScriptVars
+import ScriptVars
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $3657
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $3654
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $3648
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 0
+align 1
+LABELV $3642
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 70
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 69
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $3636
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 70
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $3626
+byte 1 94
+byte 1 51
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 65
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3625
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 65
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $3540
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 65
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3536
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 65
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $3530
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 65
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 0
+align 1
+LABELV $3506
+byte 1 94
+byte 1 51
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3502
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $3496
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $3481
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3480
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $3472
+byte 1 94
+byte 1 51
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 69
+byte 1 67
+byte 1 75
+byte 1 80
+byte 1 79
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3468
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 69
+byte 1 67
+byte 1 75
+byte 1 80
+byte 1 79
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $3462
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 69
+byte 1 67
+byte 1 75
+byte 1 80
+byte 1 79
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 0
+align 1
+LABELV $3438
+byte 1 94
+byte 1 51
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 82
+byte 1 84
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3434
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 82
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $3428
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 82
+byte 1 84
+byte 1 0
+align 1
+LABELV $3419
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 73
+byte 1 10
+byte 1 0
+align 1
+LABELV $3413
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 73
+byte 1 0
+align 1
+LABELV $3402
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 72
+byte 1 69
+byte 1 65
+byte 1 68
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $3396
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 72
+byte 1 69
+byte 1 65
+byte 1 68
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $3387
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 72
+byte 1 65
+byte 1 87
+byte 1 95
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 10
+byte 1 0
+align 1
+LABELV $3381
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 72
+byte 1 65
+byte 1 87
+byte 1 95
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 0
+align 1
+LABELV $3376
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3370
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 72
+byte 1 65
+byte 1 87
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $3364
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 72
+byte 1 65
+byte 1 87
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $3362
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $3356
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $3352
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 33
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3351
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3350
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3349
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 84
+byte 1 73
+byte 1 77
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $3343
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 84
+byte 1 73
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $3341
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $3335
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 0
+align 1
+LABELV $3331
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 80
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $3325
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 80
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $3305
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 0
+align 1
+LABELV $3297
+byte 1 94
+byte 1 53
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $3284
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $3278
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $3263
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 65
+byte 1 82
+byte 1 77
+byte 1 79
+byte 1 82
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $3257
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 65
+byte 1 82
+byte 1 77
+byte 1 79
+byte 1 82
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 0
+align 1
+LABELV $3242
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $3236
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 0
+align 1
+LABELV $3194
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 85
+byte 1 73
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $3188
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 85
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $3149
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 81
+byte 1 85
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $3143
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 81
+byte 1 85
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $3139
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 82
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $3133
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 82
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 0
+align 1
+LABELV $3124
+byte 1 94
+byte 1 51
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3120
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 10
+byte 1 0
+align 1
+LABELV $3114
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 0
+align 1
+LABELV $3112
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $3111
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $3102
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $3096
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 120
+byte 1 0
+align 1
+LABELV $3086
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $3080
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $3077
+byte 1 94
+byte 1 51
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3039
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 33
+byte 1 0
+align 1
+LABELV $2988
+byte 1 69
+byte 1 0
+align 1
+LABELV $2986
+byte 1 68
+byte 1 0
+align 1
+LABELV $2984
+byte 1 67
+byte 1 0
+align 1
+LABELV $2982
+byte 1 66
+byte 1 0
+align 1
+LABELV $2980
+byte 1 65
+byte 1 0
+align 1
+LABELV $2975
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2974
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $2961
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2960
+byte 1 10
+byte 1 0
+align 1
+LABELV $2949
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $2912
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $2905
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2898
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2684
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2662
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2644
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2468
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $2462
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $2437
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $2431
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $2415
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $2409
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $2407
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $2401
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $2282
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $2276
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $2274
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $2268
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 0
+align 1
+LABELV $2185
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $2179
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 0
+align 1
+LABELV $2177
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $2171
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $2169
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $2163
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 0
+align 1
+LABELV $2161
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $2155
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $2153
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 65
+byte 1 77
+byte 1 65
+byte 1 71
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $2147
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 65
+byte 1 77
+byte 1 65
+byte 1 71
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 0
+align 1
+LABELV $2145
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $2139
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 0
+align 1
+LABELV $2137
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 66
+byte 1 79
+byte 1 76
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $2131
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 66
+byte 1 79
+byte 1 76
+byte 1 84
+byte 1 0
+align 1
+LABELV $2129
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2128
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $2122
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $2120
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 86
+byte 1 85
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $2114
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 86
+byte 1 85
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 0
+align 1
+LABELV $2112
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $2106
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $2104
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $2098
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $2096
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 75
+byte 1 65
+byte 1 77
+byte 1 73
+byte 1 75
+byte 1 65
+byte 1 90
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $2090
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 75
+byte 1 65
+byte 1 77
+byte 1 73
+byte 1 75
+byte 1 65
+byte 1 90
+byte 1 69
+byte 1 0
+align 1
+LABELV $2086
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $2080
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $2068
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 10
+byte 1 0
+align 1
+LABELV $2062
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 0
+align 1
+LABELV $2054
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $2048
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 0
+align 1
+LABELV $2036
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $2006
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $2002
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1996
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 0
+align 1
+LABELV $1992
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $1986
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 80
+byte 1 0
+align 1
+LABELV $1975
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1969
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 0
+align 1
+LABELV $1958
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1952
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $1948
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $1942
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $1938
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 52
+byte 1 10
+byte 1 0
+align 1
+LABELV $1932
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $1928
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $1922
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $1918
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $1912
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $1908
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $1902
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $1898
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $1892
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $1888
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 57
+byte 1 10
+byte 1 0
+align 1
+LABELV $1882
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 57
+byte 1 0
+align 1
+LABELV $1878
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 56
+byte 1 10
+byte 1 0
+align 1
+LABELV $1872
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 56
+byte 1 0
+align 1
+LABELV $1868
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 55
+byte 1 10
+byte 1 0
+align 1
+LABELV $1862
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 55
+byte 1 0
+align 1
+LABELV $1858
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 54
+byte 1 10
+byte 1 0
+align 1
+LABELV $1852
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 54
+byte 1 0
+align 1
+LABELV $1848
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $1842
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 53
+byte 1 0
+align 1
+LABELV $1838
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 52
+byte 1 10
+byte 1 0
+align 1
+LABELV $1832
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 52
+byte 1 0
+align 1
+LABELV $1828
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $1822
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 51
+byte 1 0
+align 1
+LABELV $1818
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $1812
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 50
+byte 1 0
+align 1
+LABELV $1808
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $1802
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 0
+align 1
+LABELV $1798
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $1792
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 48
+byte 1 0
+align 1
+LABELV $1782
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1776
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $1770
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 78
+byte 1 71
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1764
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 78
+byte 1 71
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $1760
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 82
+byte 1 79
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1754
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 82
+byte 1 79
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $1747
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 10
+byte 1 0
+align 1
+LABELV $1741
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $1735
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $1734
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 0
+align 1
+LABELV $1685
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $1679
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $1624
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 32
+byte 1 119
+byte 1 116
+byte 1 102
+byte 1 32
+byte 1 99
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1616
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $1610
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $1608
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 10
+byte 1 0
+align 1
+LABELV $1602
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 0
+align 1
+LABELV $1600
+byte 1 42
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1597
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $1591
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $1585
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $1579
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $1573
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1567
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 0
+align 1
+LABELV $1561
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 67
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $1555
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 67
+byte 1 72
+byte 1 0
+align 1
+LABELV $1553
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1547
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1541
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 0
+align 1
+LABELV $1489
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $1483
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 0
+align 1
+LABELV $1481
+byte 1 42
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1464
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1458
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $1424
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $1418
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 0
+align 1
+LABELV $1405
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1402
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $1396
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $1381
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 68
+byte 1 73
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $1375
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 68
+byte 1 73
+byte 1 85
+byte 1 77
+byte 1 0
+align 1
+LABELV $1359
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1353
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 0
+align 1
+LABELV $1343
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $1337
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 77
+byte 1 0
+align 1
+LABELV $1327
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 87
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1321
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 87
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $1311
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $1305
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $1295
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 10
+byte 1 0
+align 1
+LABELV $1289
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 0
+align 1
+LABELV $1279
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 79
+byte 1 79
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1273
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 79
+byte 1 79
+byte 1 68
+byte 1 0
+align 1
+LABELV $1265
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1262
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1256
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $1249
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1246
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $1240
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 0
+align 1
+LABELV $1210
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1204
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 0
+align 1
+LABELV $1194
+byte 1 105
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 0
+align 1
+LABELV $1174
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 113
+byte 1 51
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1146
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 113
+byte 1 51
+byte 1 32
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1086
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1076
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1075
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1064
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1063
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1060
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 53
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1057
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1035
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 54
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1034
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 54
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $962
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $961
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $924
+byte 1 77
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 32
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $899
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $874
+byte 1 89
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $849
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $761
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $757
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $742
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $741
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $736
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $731
+byte 1 94
+byte 1 51
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $730
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $729
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $727
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $726
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $724
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $722
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 75
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $721
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $719
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $718
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $716
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $715
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $713
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $711
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $710
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $708
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $706
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $704
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $702
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $699
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $698
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $696
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $694
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $692
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $691
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $689
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 72
+byte 1 77
+byte 1 71
+byte 1 0
+align 1
+LABELV $688
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $686
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $685
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $683
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $681
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $679
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $677
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $645
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $582
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 10
+byte 1 94
+byte 1 49
+byte 1 87
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $572
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $567
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $566
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $563
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $547
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $413
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $412
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $409
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $406
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $399
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $398
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $395
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $386
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $385
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $382
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $373
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $366
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $365
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $362
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $353
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $352
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $349
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $340
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $339
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $336
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $332
+byte 1 103
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $324
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $322
+byte 1 115
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $320
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 0
+align 1
+LABELV $318
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $316
+byte 1 115
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $314
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $312
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $310
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $304
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $301
+byte 1 99
+byte 1 103
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 10
+byte 1 0
+align 1
+LABELV $290
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $281
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 84
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 68
+byte 1 105
+byte 1 101
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $190
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $189
+byte 1 37
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $188
+byte 1 37
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $185
+byte 1 37
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $182
+byte 1 37
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $179
+byte 1 49
+byte 1 51
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $176
+byte 1 49
+byte 1 50
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $173
+byte 1 49
+byte 1 49
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $170
+byte 1 94
+byte 1 51
+byte 1 51
+byte 1 114
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $167
+byte 1 94
+byte 1 49
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $164
+byte 1 94
+byte 1 52
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $161
+byte 1 0
+align 1
+LABELV $160
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
@@ -0,0 +1,17534 @@
+data
+export FxLoopSounds
+align 4
+LABELV FxLoopSounds
+byte 4 1025
+align 4
+LABELV FrameCount
+byte 4 1
+code
+proc Increment_FrameCount 4 0
+ADDRLP4 0
+ADDRGP4 FrameCount
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32
+LEI4 $157
+ADDRGP4 FrameCount
+CNSTI4 1
+ASGNI4
+LABELV $157
+LABELV $156
+endproc Increment_FrameCount 4 0
+export CG_InitLocalEntities
+proc CG_InitLocalEntities 12 12
+ADDRGP4 cg_localEntities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 134643600
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_activeLocalEntities+4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeLocalEntities
+ADDRGP4 cg_localEntities
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+8
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $163
+ADDRLP4 8
+CNSTI4 8220
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_localEntities+4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_localEntities+8220
+ADDP4
+ASGNP4
+LABELV $164
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16379
+LTI4 $163
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $172
+JUMPV
+LABELV $169
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 Next
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $170
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $172
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 9
+LTU4 $169
+ADDRGP4 cg+6747380
+CNSTI4 0
+ASGNI4
+LABELV $159
+endproc CG_InitLocalEntities 12 12
+export CG_ShutdownLocalEnts
+proc CG_ShutdownLocalEnts 0 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $175
+ADDRGP4 $177
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $175
+LABELV $174
+endproc CG_ShutdownLocalEnts 0 4
+proc CG_FreeLocalEntity 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 tmpLocalEntity
+CVPU4 4
+NEU4 $179
+ADDRGP4 $178
+JUMPV
+LABELV $179
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $181
+ADDRGP4 $183
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $181
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8204
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $184
+ADDRLP4 20
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $184
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $189
+JUMPV
+LABELV $186
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 Next
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+NEU4 $190
+ADDRLP4 16
+INDIRU4
+CNSTU4 0
+EQU4 $190
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 Next
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $190
+LABELV $187
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $189
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 9
+LTU4 $186
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_freeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeLocalEntities
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cg+6747380
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $178
+endproc CG_FreeLocalEntity 32 4
+proc CG_DropLocalEntity 12 24
+ADDRGP4 cg_fxDebugEntities+12
+INDIRI4
+CNSTI4 2
+LEI4 $194
+ADDRGP4 $197
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $194
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities+8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+EQU4 $199
+ADDRGP4 cg_fxDebugEntities+12
+INDIRI4
+CNSTI4 1
+LEI4 $201
+ADDRGP4 $204
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $201
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $200
+JUMPV
+LABELV $199
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $209
+ADDRGP4 cg_fxDebugEntities+12
+INDIRI4
+CNSTI4 1
+LEI4 $211
+ADDRGP4 $214
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $211
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 $208
+JUMPV
+LABELV $209
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $208
+ADDRGP4 cg_fxDebugEntities+12
+INDIRI4
+CNSTI4 3
+LEI4 $217
+ADDRGP4 $220
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $217
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $207
+ADDRGP4 $206
+JUMPV
+LABELV $208
+ADDRGP4 cg_fxDebugEntities+12
+INDIRI4
+CNSTI4 0
+LEI4 $222
+ADDRGP4 $225
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $222
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+LABELV $200
+LABELV $193
+endproc CG_DropLocalEntity 12 24
+proc CG_AllocLocalEntityExt 20 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $228
+ADDRGP4 $230
+ARGP4
+ADDRLP4 4
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $228
+ADDRGP4 tmpLocalEntity
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 8220
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 tmpLocalEntity
+RETP4
+ADDRGP4 $227
+JUMPV
+LABELV $228
+ADDRGP4 cg_freeLocalEntities
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $231
+ADDRGP4 CG_DropLocalEntity
+CALLV
+pop
+LABELV $231
+ADDRLP4 8
+ADDRGP4 cg_freeLocalEntities
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 8220
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cg+6747380
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $227
+endproc CG_AllocLocalEntityExt 20 12
+export CG_AllocLocalEntity
+proc CG_AllocLocalEntity 4 4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_AllocLocalEntityExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $237
+endproc CG_AllocLocalEntity 4 4
+export CG_AllocLocalEntityRealTime
+proc CG_AllocLocalEntityRealTime 4 4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_AllocLocalEntityExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $238
+endproc CG_AllocLocalEntityRealTime 4 4
+export CG_MakeLowPriorityEntity
+proc CG_MakeLowPriorityEntity 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg_activeLocalEntities+12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8204
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $239
+endproc CG_MakeLowPriorityEntity 0 0
+proc R_AddRefEntityPtrToScene 0 4
+ADDRGP4 cg_fxq3mmeCompatibility+12
+INDIRI4
+CNSTI4 0
+EQI4 $244
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityPtrToScene
+CALLV
+pop
+LABELV $245
+LABELV $243
+endproc R_AddRefEntityPtrToScene 0 4
+export CG_SmokePuff_ql
+proc CG_SmokePuff_ql 48 0
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRFP4 32
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 36
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 32
+INDIRI4
+CVIF4 4
+ADDRFP4 28
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 36
+INDIRI4
+ADDRFP4 32
+INDIRI4
+LEI4 $248
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+LABELV $249
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRFP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+20100+19480
+INDIRI4
+CNSTI4 3
+NEI4 $250
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492140
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $251
+JUMPV
+LABELV $250
+ADDRLP4 16
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LTF4 $257
+ADDRLP4 12
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRLP4 12
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $258
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 12
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 28
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LTF4 $260
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $261
+ADDRLP4 4
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LTF4 $263
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $264
+JUMPV
+LABELV $263
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $264
+ADDRLP4 4
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 36
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $251
+ADDRLP4 4
+INDIRP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $247
+endproc CG_SmokePuff_ql 48 0
+proc CG_BloodTrail_ql 72 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $266
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 cg_gibSparksColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $267
+ADDRGP4 $270
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $268
+JUMPV
+LABELV $267
+ADDRGP4 cg_gibSparksHighlight+12
+INDIRI4
+CNSTI4 0
+EQI4 $274
+ADDRGP4 $277
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $275
+JUMPV
+LABELV $274
+ADDRGP4 $278
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $275
+ADDRLP4 4
+ARGP4
+ADDRGP4 cg_gibSparksColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 4+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $268
+ADDRLP4 44
+ADDRGP4 cg_gibSparksSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cg_gibStepTime+12
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+607144
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ADDRLP4 48
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 48
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRGP4 $288
+JUMPV
+LABELV $285
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $289
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 4+8
+INDIRF4
+ARGF4
+ADDRLP4 4+12
+INDIRF4
+ARGF4
+ADDRGP4 cg_gibTime+12
+INDIRI4
+CNSTI4 3
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_SmokePuff_ql
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $290
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+LTI4 $289
+LABELV $286
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $288
+ADDRLP4 32
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $285
+LABELV $265
+endproc CG_BloodTrail_ql 72 48
+proc CG_BloodTrail 56 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $300
+ARGP4
+ADDRLP4 36
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $298
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_BloodTrail_ql
+CALLV
+pop
+ADDRGP4 $297
+JUMPV
+LABELV $298
+ADDRLP4 28
+ADDRGP4 cgs+632912+492156
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 20
+ASGNI4
+ADDRLP4 20
+CNSTI4 150
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+607144
+INDIRI4
+SUBI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRGP4 $309
+JUMPV
+LABELV $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTF4 1157234688
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+LABELV $307
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $309
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $306
+LABELV $297
+endproc CG_BloodTrail 56 48
+proc CG_IceTrail 52 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRGP4 cgs+632912+492160
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 20
+ASGNI4
+ADDRLP4 20
+CNSTI4 150
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+607144
+INDIRI4
+SUBI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRGP4 $319
+JUMPV
+LABELV $316
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1157234688
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+LABELV $317
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $319
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $316
+LABELV $310
+endproc CG_IceTrail 52 48
+proc CG_FragmentBounceMark 32 52
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $325
+ADDRGP4 cg_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $324
+LABELV $325
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $321
+LABELV $324
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $326
+ADDRGP4 $300
+ARGP4
+ADDRLP4 12
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $326
+ADDRLP4 4
+ADDRGP4 cgs+632912+492244
+INDIRI4
+ASGNI4
+ADDRGP4 $327
+JUMPV
+LABELV $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $330
+ADDRLP4 4
+ADDRGP4 cgs+632912+492248
+INDIRI4
+ASGNI4
+ADDRGP4 $320
+JUMPV
+LABELV $330
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $334
+LABELV $334
+ADDRLP4 4
+ADDRGP4 cgs+632912+492256
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+LABELV $327
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+ADDRGP4 $322
+JUMPV
+LABELV $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $339
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 15
+BANDI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492256
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $339
+LABELV $322
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $320
+endproc CG_FragmentBounceMark 32 52
+proc CG_FragmentBounceSound 24 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $344
+ADDRLP4 0
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $345
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $300
+ARGP4
+ADDRLP4 16
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $348
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+MODI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $350
+ADDRLP4 8
+ADDRGP4 cgs+632912+492960
+INDIRI4
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $350
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $354
+ADDRLP4 8
+ADDRGP4 cgs+632912+492964
+INDIRI4
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $354
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $358
+ADDRLP4 8
+ADDRGP4 cgs+632912+492968
+INDIRI4
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $358
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $349
+ADDRLP4 8
+ADDRGP4 cgs+632912+492972
+INDIRI4
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $366
+ADDRLP4 8
+ADDRGP4 cgs+632912+492932
+INDIRI4
+ASGNI4
+ADDRGP4 $367
+JUMPV
+LABELV $366
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $370
+ADDRLP4 8
+ADDRGP4 cgs+632912+492936
+INDIRI4
+ASGNI4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 8
+ADDRGP4 cgs+632912+492940
+INDIRI4
+ASGNI4
+LABELV $371
+LABELV $367
+LABELV $349
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $376
+LABELV $376
+LABELV $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $343
+endproc CG_FragmentBounceSound 24 16
+proc CG_ReflectVelocity 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+607144
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+607144
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectoryDelta
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 VectorReflect
+CALLV
+pop
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $387
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $383
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1109393408
+LTF4 $387
+ADDRLP4 44
+INDIRF4
+ADDRGP4 cg+607144
+INDIRI4
+NEGI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+MULF4
+GEF4 $383
+LABELV $387
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $383
+LABELV $384
+LABELV $378
+endproc CG_ReflectVelocity 48 12
+proc CG_FX_EmittedMoveOrigin 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 981668463
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1860
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $390
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1864
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $391
+JUMPV
+LABELV $390
+ADDRFP4 0
+INDIRP4
+CNSTI4 8088
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $392
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8092
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $392
+LABELV $391
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+EQF4 $394
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+LEF4 $394
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $394
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $388
+endproc CG_FX_EmittedMoveOrigin 32 4
+proc CG_TraceLocalEntities 24 32
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 $400
+JUMPV
+LABELV $397
+ADDRLP4 0
+INDIRP4
+CNSTI4 8212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $401
+ADDRGP4 $398
+JUMPV
+LABELV $401
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $403
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8100
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $405
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $405
+ADDRGP4 $398
+JUMPV
+LABELV $405
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8088
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $407
+ADDRLP4 0
+INDIRP4
+CNSTI4 1860
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $407
+ADDRGP4 $398
+JUMPV
+LABELV $407
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 batchTraceStarts
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 batchTraceEnds
+ADDP4
+ARGP4
+ADDRGP4 CG_FX_EmittedMoveOrigin
+CALLF4
+pop
+ADDRGP4 $404
+JUMPV
+LABELV $403
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $412
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $412
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $409
+LABELV $412
+ADDRGP4 $398
+JUMPV
+LABELV $409
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 192
+BANDI4
+CNSTI4 0
+EQI4 $413
+ADDRGP4 $398
+JUMPV
+LABELV $413
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 batchTraceStarts
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 batchTraceEnds
+ADDP4
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+LABELV $404
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8212
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $398
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $400
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $397
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $417
+ADDRGP4 batchTraces
+ARGP4
+ADDRGP4 batchTraceStarts
+ARGP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 batchTraceEnds
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_TraceBatch
+CALLV
+pop
+LABELV $417
+LABELV $396
+endproc CG_TraceLocalEntities 24 32
+proc CG_LocalEntityTrace 16 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $420
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 batchTraceStarts-12
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $420
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8212
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 batchTraceEnds-12
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $420
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 8212
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 batchTraces-56
+ADDP4
+INDIRB
+ASGNB 56
+ADDRGP4 $421
+JUMPV
+LABELV $420
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+LABELV $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 8212
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $419
+endproc CG_LocalEntityTrace 16 28
+proc CG_LocalEntityCullSphere 136 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $430
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 192
+BANDI4
+ADDRLP4 48
+INDIRI4
+EQI4 $428
+LABELV $430
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $428
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 2
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LTI4 $431
+ADDRLP4 52
+INDIRI4
+CNSTI4 7
+GTI4 $431
+ADDRLP4 52
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LSHI4
+ADDRGP4 $468-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $468
+address $443
+address $447
+address $434
+address $441
+address $431
+address $440
+code
+LABELV $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRF4
+LEF4 $438
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $439
+JUMPV
+LABELV $438
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $439
+ADDRFP4 8
+INDIRP4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $440
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $441
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 12
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $443
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRB
+ASGNB 12
+CNSTF4 1116733440
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+LEF4 $445
+ADDRLP4 80
+CNSTF4 1116733440
+ASGNF4
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $446
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $447
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $448
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRF4
+LEF4 $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRGP4 $458
+JUMPV
+LABELV $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 112
+INDIRF4
+ASGNF4
+LABELV $458
+ADDRLP4 96
+INDIRF4
+ADDRLP4 88
+INDIRF4
+LEF4 $455
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRGP4 $456
+JUMPV
+LABELV $455
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 124
+INDIRF4
+LEF4 $459
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 92
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 92
+ADDRLP4 132
+INDIRF4
+ASGNF4
+LABELV $460
+ADDRLP4 84
+ADDRLP4 92
+INDIRF4
+ASGNF4
+LABELV $456
+ADDRLP4 16
+ADDRLP4 84
+INDIRF4
+ASGNF4
+LABELV $450
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 84
+ADDRGP4 RadiusFromBounds
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 5
+EQI4 $463
+ADDRLP4 84
+INDIRI4
+CNSTI4 6
+NEI4 $461
+LABELV $463
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $462
+JUMPV
+LABELV $461
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $462
+LABELV $449
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 88
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 92
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 92
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 96
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 100
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 100
+INDIRF4
+MULF4
+CNSTF4 1098907648
+ADDF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $431
+CNSTI4 0
+RETI4
+LABELV $427
+endproc CG_LocalEntityCullSphere 136 16
+export CG_BeginCullGrid
+proc CG_BeginCullGrid 104 12
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_cullLocalEntities+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $475
+ADDRGP4 cg+711640
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $471
+LABELV $475
+CNSTI4 0
+RETI4
+ADDRGP4 $470
+JUMPV
+LABELV $471
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_RenderViewAxis
+CALLV
+pop
+CNSTF4 1078530011
+CNSTF4 1056964608
+ADDRGP4 cg+609412+16
+INDIRF4
+MULF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 64
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1056964608
+ADDRGP4 cg+609412+16
+INDIRF4
+MULF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 68
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1056964608
+ADDRGP4 cg+609412+20
+INDIRF4
+MULF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 72
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1056964608
+ADDRGP4 cg+609412+20
+INDIRF4
+MULF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRGP4 leGridFrustum
+ADDRLP4 4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 leGridFrustum+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 leGridFrustum+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84
+ADDRGP4 leGridFrustum
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 leGridFrustum+4
+ADDRGP4 leGridFrustum+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 leGridFrustum+8
+ADDRGP4 leGridFrustum+8
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 leGridFrustum+20
+ADDRLP4 4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 leGridFrustum+20+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 leGridFrustum+20+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 leGridFrustum+20
+ADDRGP4 leGridFrustum+20
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+ADDRLP4 48
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 leGridFrustum+20+4
+ADDRGP4 leGridFrustum+20+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 leGridFrustum+20+8
+ADDRGP4 leGridFrustum+20+8
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+ADDRLP4 48
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 leGridFrustum+40
+ADDRLP4 4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 leGridFrustum+40+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 leGridFrustum+40+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 leGridFrustum+40
+ADDRGP4 leGridFrustum+40
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 leGridFrustum+40+4
+ADDRGP4 leGridFrustum+40+4
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 leGridFrustum+40+8
+ADDRGP4 leGridFrustum+40+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 leGridFrustum+60
+ADDRLP4 4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 leGridFrustum+60+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 leGridFrustum+60+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 leGridFrustum+60
+ADDRGP4 leGridFrustum+60
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+ADDRLP4 56
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 leGridFrustum+60+4
+ADDRGP4 leGridFrustum+60+4
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 leGridFrustum+60+8
+ADDRGP4 leGridFrustum+60+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+ADDRLP4 56
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_stereoSeparation+8
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $564
+ADDRLP4 96
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRGP4 leGridFrustum+12
+ADDP4
+ADDRGP4 cg+609412+24
+INDIRF4
+ADDRLP4 96
+INDIRI4
+ADDRGP4 leGridFrustum
+ADDP4
+INDIRF4
+MULF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+ADDRLP4 96
+INDIRI4
+ADDRGP4 leGridFrustum+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+ADDRLP4 96
+INDIRI4
+ADDRGP4 leGridFrustum+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $565
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $564
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+NEF4 $580
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRGP4 $581
+JUMPV
+LABELV $580
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $581
+ADDRGP4 leGridUsePvs
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 numLeGridCells
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 numLeGridEntities
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 leGridHash
+ARGP4
+ADDRLP4 100
+INDIRI4
+ARGI4
+CNSTU4 8192
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $470
+endproc CG_BeginCullGrid 104 12
+export CG_AddToCullGrid
+proc CG_AddToCullGrid 48 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 numLeGridEntities
+INDIRI4
+CNSTI4 16380
+LTI4 $583
+ADDRGP4 $582
+JUMPV
+LABELV $583
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $585
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1140850688
+DIVF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $586
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $585
+ADDRLP4 24
+CNSTU4 73856093
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+MULU4
+CNSTU4 19349663
+ADDRLP4 8+4
+INDIRI4
+CVIU4 4
+MULU4
+BXORU4
+CNSTU4 83492791
+ADDRLP4 8+8
+INDIRI4
+CVIU4 4
+MULU4
+BXORU4
+CNSTU4 2047
+BANDU4
+ASGNU4
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRGP4 $592
+JUMPV
+LABELV $591
+ADDRLP4 4
+ADDRLP4 24
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 leGridHash
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 40
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 leGridCells
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $594
+ADDRLP4 32
+INDIRI4
+ADDRGP4 leGridCells+4
+ADDP4
+INDIRI4
+ADDRLP4 8+4
+INDIRI4
+NEI4 $594
+ADDRLP4 32
+INDIRI4
+ADDRGP4 leGridCells+8
+ADDP4
+INDIRI4
+ADDRLP4 8+8
+INDIRI4
+NEI4 $594
+ADDRLP4 20
+CNSTI4 40
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 leGridCells
+ADDP4
+ASGNP4
+ADDRGP4 $593
+JUMPV
+LABELV $594
+ADDRLP4 24
+ADDRLP4 24
+INDIRU4
+CNSTU4 1
+ADDU4
+CNSTU4 2047
+BANDU4
+ASGNU4
+LABELV $592
+ADDRLP4 24
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 leGridHash
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $591
+LABELV $593
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $600
+ADDRGP4 numLeGridCells
+INDIRI4
+CNSTI4 1024
+LTI4 $602
+ADDRGP4 $582
+JUMPV
+LABELV $602
+ADDRLP4 32
+ADDRGP4 numLeGridCells
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 leGridHash
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 40
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 leGridCells
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 ClearBounds
+CALLV
+pop
+ADDRLP4 20
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $600
+ADDRLP4 28
+CNSTI4 24
+ADDRGP4 numLeGridEntities
+INDIRI4
+MULI4
+ADDRGP4 leGridEntities
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 numLeGridEntities
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 numLeGridEntities
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $604
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+SUBF4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+GEF4 $608
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $608
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+LEF4 $610
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $610
+LABELV $605
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $604
+LABELV $582
+endproc CG_AddToCullGrid 48 8
+export CG_CullGrid
+proc CG_CullGrid 52 8
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $616
+JUMPV
+LABELV $613
+ADDRLP4 12
+CNSTI4 40
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRGP4 leGridCells
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+LABELV $617
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $621
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 leGridFrustum
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $626
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $627
+JUMPV
+LABELV $626
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $627
+ADDRLP4 44
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+LABELV $622
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $621
+ADDRLP4 40
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 leGridFrustum
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 leGridFrustum+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 leGridFrustum+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 leGridFrustum+12
+ADDP4
+INDIRF4
+GEF4 $628
+ADDRGP4 $619
+JUMPV
+LABELV $628
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $635
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 leGridFrustum
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $640
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $641
+JUMPV
+LABELV $640
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $641
+ADDRLP4 48
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+LABELV $636
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $635
+ADDRLP4 44
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 leGridFrustum
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 leGridFrustum+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 leGridFrustum+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 leGridFrustum+12
+ADDP4
+INDIRF4
+GEF4 $642
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+LABELV $642
+LABELV $618
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $617
+LABELV $619
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+NEI4 $649
+ADDRGP4 leGridUsePvs
+INDIRI4
+CNSTI4 0
+EQI4 $649
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $654
+JUMPV
+LABELV $651
+ADDRGP4 cg+609412+24
+ARGP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 leGridEntities+4
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_inPVS
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $656
+ADDRGP4 $653
+JUMPV
+LABELV $656
+LABELV $652
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 leGridEntities+20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $654
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $651
+LABELV $653
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $661
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $661
+LABELV $649
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+GEI4 $663
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $668
+JUMPV
+LABELV $665
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 leGridEntities
+ADDP4
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $666
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 leGridEntities+20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $668
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $665
+ADDRGP4 $614
+JUMPV
+LABELV $663
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $670
+ADDRGP4 $614
+JUMPV
+LABELV $670
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $672
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 leGridEntities
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $676
+ADDRLP4 44
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 leGridFrustum
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 leGridFrustum+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 leGridFrustum+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 leGridFrustum+12
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+NEGF4
+GEF4 $680
+ADDRLP4 8
+INDIRP4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $678
+JUMPV
+LABELV $680
+LABELV $677
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $676
+LABELV $678
+LABELV $673
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $675
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $672
+LABELV $614
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $616
+ADDRLP4 32
+INDIRI4
+ADDRGP4 numLeGridCells
+INDIRI4
+LTI4 $613
+LABELV $612
+endproc CG_CullGrid 52 8
+proc CG_CullLocalEntities 28 12
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ASGNP4
+ADDRGP4 $689
+JUMPV
+LABELV $686
+ADDRLP4 0
+INDIRP4
+CNSTI4 8216
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $687
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $689
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $686
+ADDRLP4 20
+ADDRGP4 CG_BeginCullGrid
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $691
+ADDRGP4 $685
+JUMPV
+LABELV $691
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ASGNP4
+ADDRGP4 $696
+JUMPV
+LABELV $693
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_LocalEntityCullSphere
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $698
+ADDRGP4 $694
+JUMPV
+LABELV $698
+ADDRLP4 0
+INDIRP4
+CNSTI4 8216
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 CG_AddToCullGrid
+CALLV
+pop
+LABELV $694
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $696
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $693
+ADDRGP4 CG_CullGrid
+CALLV
+pop
+LABELV $685
+endproc CG_CullLocalEntities 28 12
+proc CG_AddFragment 128 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $701
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1000
+GEI4 $704
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 120
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+CNSTF4 1065353216
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8216
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $706
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+LABELV $706
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRGP4 $705
+JUMPV
+LABELV $704
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 116
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 116
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8216
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $708
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+LABELV $708
+LABELV $705
+ADDRLP4 112
+ADDRLP4 68
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+LTI4 $700
+ADDRLP4 112
+INDIRI4
+CNSTI4 7
+GTI4 $700
+ADDRLP4 112
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $720
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $720
+address $716
+address $700
+address $700
+address $700
+address $700
+address $713
+address $713
+address $713
+code
+LABELV $713
+ADDRLP4 84
+INDIRF4
+ADDRLP4 80
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 120
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+LEF4 $700
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $700
+JUMPV
+LABELV $716
+ADDRLP4 68
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 84
+INDIRF4
+ADDRLP4 80
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 124
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 88+8
+INDIRF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+LEF4 $700
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $700
+JUMPV
+LABELV $701
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRGP4 CG_LocalEntityTrace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $723
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+ADDRLP4 56
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $726
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 80
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRLP4 80
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $726
+ADDRFP4 0
+INDIRP4
+CNSTI4 8216
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $730
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+LABELV $730
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $736
+ADDRGP4 cg_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $735
+LABELV $736
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $732
+ADDRGP4 $300
+ARGP4
+ADDRLP4 80
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $732
+LABELV $735
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_BloodTrail
+CALLV
+pop
+ADDRGP4 $700
+JUMPV
+LABELV $732
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $700
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_IceTrail
+CALLV
+pop
+ADDRGP4 $700
+JUMPV
+LABELV $723
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+EQU4 $739
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $700
+JUMPV
+LABELV $739
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+MULF4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+CNSTF4 0
+NEF4 $742
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $700
+JUMPV
+LABELV $742
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FragmentBounceMark
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FragmentBounceSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_ReflectVelocity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8216
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $754
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+LABELV $754
+LABELV $700
+endproc CG_AddFragment 128 16
+proc CG_AddFadeRGB 64 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $757
+ADDRLP4 8
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $758
+JUMPV
+LABELV $757
+ADDRLP4 8
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $758
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LTF4 $762
+ADDRLP4 12
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $763
+JUMPV
+LABELV $762
+ADDRLP4 12
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $763
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 12
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $765
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $766
+JUMPV
+LABELV $765
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $766
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LTF4 $768
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $769
+JUMPV
+LABELV $768
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $769
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 40
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LTF4 $771
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $772
+JUMPV
+LABELV $771
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $772
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 52
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+LABELV $756
+endproc CG_AddFadeRGB 64 4
+proc CG_AddMoveScaleFade 52 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+LEF4 $774
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 28
+INDIRF4
+GEF4 $774
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1065353216
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $775
+JUMPV
+LABELV $774
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $775
+ADDRLP4 36
+CNSTF4 1132396544
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+LTF4 $780
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $781
+JUMPV
+LABELV $780
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $781
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 32
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $782
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $782
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+GEF4 $796
+ADDRGP4 cg_allowLargeSprites+12
+INDIRI4
+CNSTI4 0
+NEI4 $796
+ADDRGP4 cg_allowSpritePassThrough+12
+INDIRI4
+CNSTI4 0
+NEI4 $773
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $773
+JUMPV
+LABELV $796
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+LABELV $773
+endproc CG_AddMoveScaleFade 52 16
+proc CG_AddScaleFade 48 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $805
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $806
+JUMPV
+LABELV $805
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $806
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+GEF4 $817
+ADDRGP4 cg_allowLargeSprites+12
+INDIRI4
+CNSTI4 0
+NEI4 $817
+ADDRGP4 cg_allowSpritePassThrough+12
+INDIRI4
+CNSTI4 0
+NEI4 $802
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $802
+JUMPV
+LABELV $817
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+LABELV $802
+endproc CG_AddScaleFade 48 4
+proc CG_AddFallScaleFade 52 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $826
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $827
+JUMPV
+LABELV $826
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $827
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $828
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRGP4 $829
+JUMPV
+LABELV $828
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $829
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+GEF4 $840
+ADDRGP4 cg_allowLargeSprites+12
+INDIRI4
+CNSTI4 0
+NEI4 $840
+ADDRGP4 cg_allowSpritePassThrough+12
+INDIRI4
+CNSTI4 0
+NEI4 $823
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $823
+JUMPV
+LABELV $840
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+LABELV $823
+endproc CG_AddFallScaleFade 52 4
+proc CG_AddExplosion 20 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $847
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+GEF4 $850
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $851
+JUMPV
+LABELV $850
+ADDRLP4 4
+CNSTF4 1065353216
+CNSTF4 1073741824
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $851
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $847
+LABELV $846
+endproc CG_AddExplosion 20 20
+proc CG_AddSpriteExplosion 212 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRB
+ASGNB 172
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 180
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ADDRLP4 180
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+CNSTF4 1065353216
+LEF4 $854
+ADDRLP4 172
+CNSTF4 1065353216
+ASGNF4
+LABELV $854
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 188
+CNSTF4 1051260355
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 192
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 192
+INDIRF4
+LTF4 $864
+ADDRLP4 184
+ADDRLP4 188
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $865
+JUMPV
+LABELV $864
+ADDRLP4 184
+ADDRLP4 188
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $865
+ADDRLP4 0+116+3
+ADDRLP4 184
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1109917696
+CNSTF4 1065353216
+ADDRLP4 172
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $867
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 196
+INDIRF4
+CNSTF4 1056964608
+GEF4 $870
+ADDRLP4 196
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $871
+JUMPV
+LABELV $870
+ADDRLP4 196
+CNSTF4 1065353216
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $871
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $867
+LABELV $852
+endproc CG_AddSpriteExplosion 212 20
+proc CG_AddKamikaze 316 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 216
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+CNSTF4 0
+ASGNF4
+ADDRLP4 220+8
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 220+4
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 220
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 220
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 216
+INDIRF4
+CNSTF4 0
+LEF4 $877
+ADDRLP4 216
+INDIRF4
+CNSTF4 1157234688
+GEF4 $877
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $879
+ADDRGP4 cgs+632912+492868
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRLP4 244
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ADDRLP4 244
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $879
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4+8
+ADDRGP4 cgs+632912+492400
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+128
+ADDRLP4 212
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+68
+ADDRLP4 212
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 216
+INDIRF4
+CNSTF4 0
+SUBF4
+CNSTF4 1157234688
+DIVF4
+ASGNF4
+ADDRLP4 4+28
+ADDRLP4 176
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+4
+ADDRLP4 176+4
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+8
+ADDRLP4 176+8
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12
+ADDRLP4 176+12
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12+4
+ADDRLP4 176+12+4
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12+8
+ADDRLP4 176+12+8
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24
+ADDRLP4 176+24
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24+4
+ADDRLP4 176+24+4
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24+8
+ADDRLP4 176+24+8
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 216
+INDIRF4
+CNSTF4 1153138688
+LEF4 $922
+ADDRLP4 0
+ADDRLP4 216
+INDIRF4
+CNSTF4 1153138688
+SUBF4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRGP4 $923
+JUMPV
+LABELV $922
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $923
+ADDRLP4 248
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 0
+ADDRLP4 248
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 248
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+LTF4 $926
+ADDRLP4 244
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $927
+JUMPV
+LABELV $926
+ADDRLP4 244
+ADDRLP4 252
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $927
+ADDRLP4 4+116
+ADDRLP4 244
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 264
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 268
+INDIRF4
+LTF4 $931
+ADDRLP4 260
+ADDRLP4 264
+INDIRF4
+ADDRLP4 268
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $932
+JUMPV
+LABELV $931
+ADDRLP4 260
+ADDRLP4 264
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $932
+ADDRLP4 4+116+1
+ADDRLP4 260
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 276
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 280
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 276
+INDIRF4
+ADDRLP4 280
+INDIRF4
+LTF4 $936
+ADDRLP4 272
+ADDRLP4 276
+INDIRF4
+ADDRLP4 280
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $937
+JUMPV
+LABELV $936
+ADDRLP4 272
+ADDRLP4 276
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $937
+ADDRLP4 4+116+2
+ADDRLP4 272
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 288
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 292
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 292
+INDIRF4
+LTF4 $941
+ADDRLP4 284
+ADDRLP4 288
+INDIRF4
+ADDRLP4 292
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $942
+JUMPV
+LABELV $941
+ADDRLP4 284
+ADDRLP4 288
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $942
+ADDRLP4 4+116+3
+ADDRLP4 284
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $877
+ADDRLP4 216
+INDIRF4
+CNSTF4 1132068864
+LEF4 $943
+ADDRLP4 216
+INDIRF4
+CNSTF4 1158455296
+GEF4 $943
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 260
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 260
+INDIRF4
+LTF4 $947
+ADDRLP4 248
+ADDRLP4 256
+INDIRF4
+ADDRLP4 260
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $948
+JUMPV
+LABELV $947
+ADDRLP4 248
+ADDRLP4 256
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $948
+ADDRLP4 212
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 248
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+LTF4 $950
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $951
+JUMPV
+LABELV $950
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $951
+ADDRLP4 212
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 264
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 284
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+LTF4 $953
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $954
+JUMPV
+LABELV $953
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $954
+ADDRLP4 212
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 276
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LTF4 $956
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $957
+JUMPV
+LABELV $956
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $957
+ADDRLP4 212
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 216
+INDIRF4
+CNSTF4 1157234688
+GEF4 $958
+ADDRLP4 0
+ADDRLP4 216
+INDIRF4
+CNSTF4 1132068864
+SUBF4
+CNSTF4 1155186688
+DIVF4
+ASGNF4
+ADDRGP4 $959
+JUMPV
+LABELV $958
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $960
+ADDRGP4 cgs+632912+492872
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $960
+ADDRLP4 0
+CNSTF4 1158455296
+ADDRLP4 216
+INDIRF4
+SUBF4
+CNSTF4 1132068864
+DIVF4
+ASGNF4
+LABELV $959
+ADDRLP4 212
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 176+4
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 176+8
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 176+12
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 176+12+4
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 176+12+8
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 176+24
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 176+24+4
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 176+24+8
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 212
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTF4 1148846080
+ADDRLP4 0
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 304
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 304
+INDIRF4
+ARGF4
+ADDRLP4 304
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $943
+ADDRLP4 216
+INDIRF4
+CNSTF4 1157234688
+LEF4 $976
+ADDRLP4 216
+INDIRF4
+CNSTF4 1161527296
+GEF4 $976
+ADDRLP4 256
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRLP4 256
+INDIRF4
+NEF4 $978
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRLP4 256
+INDIRF4
+NEF4 $978
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRLP4 256
+INDIRF4
+NEF4 $978
+ADDRLP4 260
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1135869952
+ADDRLP4 260
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 264
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1135869952
+ADDRLP4 264
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1135869952
+ADDRLP4 268
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+LABELV $978
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4+8
+ADDRGP4 cgs+632912+492400
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+128
+ADDRLP4 212
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+68
+ADDRLP4 212
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 220
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 220+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 220+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 220
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 216
+INDIRF4
+CNSTF4 1157234688
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 4+28
+ADDRLP4 176
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+4
+ADDRLP4 176+4
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+8
+ADDRLP4 176+8
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12
+ADDRLP4 176+12
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12+4
+ADDRLP4 176+12+4
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12+8
+ADDRLP4 176+12+8
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24
+ADDRLP4 176+24
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24+4
+ADDRLP4 176+24+4
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24+8
+ADDRLP4 176+24+8
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 216
+INDIRF4
+CNSTF4 1159479296
+LEF4 $1021
+ADDRLP4 0
+ADDRLP4 216
+INDIRF4
+CNSTF4 1159479296
+SUBF4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRGP4 $1022
+JUMPV
+LABELV $1021
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $1022
+ADDRLP4 268
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 0
+ADDRLP4 268
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+ADDRLP4 268
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 276
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 276
+INDIRF4
+LTF4 $1025
+ADDRLP4 264
+ADDRLP4 272
+INDIRF4
+ADDRLP4 276
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1026
+JUMPV
+LABELV $1025
+ADDRLP4 264
+ADDRLP4 272
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1026
+ADDRLP4 4+116
+ADDRLP4 264
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 284
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 288
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 284
+INDIRF4
+ADDRLP4 288
+INDIRF4
+LTF4 $1030
+ADDRLP4 280
+ADDRLP4 284
+INDIRF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1031
+JUMPV
+LABELV $1030
+ADDRLP4 280
+ADDRLP4 284
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1031
+ADDRLP4 4+116+1
+ADDRLP4 280
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 296
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 300
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 296
+INDIRF4
+ADDRLP4 300
+INDIRF4
+LTF4 $1035
+ADDRLP4 292
+ADDRLP4 296
+INDIRF4
+ADDRLP4 300
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1036
+JUMPV
+LABELV $1035
+ADDRLP4 292
+ADDRLP4 296
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1036
+ADDRLP4 4+116+2
+ADDRLP4 292
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 308
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 312
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 308
+INDIRF4
+ADDRLP4 312
+INDIRF4
+LTF4 $1040
+ADDRLP4 304
+ADDRLP4 308
+INDIRF4
+ADDRLP4 312
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1041
+JUMPV
+LABELV $1040
+ADDRLP4 304
+ADDRLP4 308
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1041
+ADDRLP4 4+116+3
+ADDRLP4 304
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $976
+LABELV $873
+endproc CG_AddKamikaze 316 20
+proc CG_AddInvulnerabilityImpact 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+LABELV $1042
+endproc CG_AddInvulnerabilityImpact 0 4
+proc CG_AddInvulnerabilityJuiced 1504 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1161527296
+LEF4 $1045
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1050253722
+ADDRLP4 0
+INDIRF4
+CNSTF4 1161527296
+SUBF4
+MULF4
+CNSTF4 1157234688
+DIVF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+CNSTF4 1050253722
+ADDRLP4 0
+INDIRF4
+CNSTF4 1161527296
+SUBF4
+MULF4
+CNSTF4 1157234688
+DIVF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 1500
+CNSTF4 1157234688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+CNSTF4 1050253722
+ADDRLP4 1500
+INDIRF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1161527296
+SUBF4
+SUBF4
+MULF4
+ADDRLP4 1500
+INDIRF4
+DIVF4
+CNSTF4 1060320051
+ADDF4
+ASGNF4
+LABELV $1045
+ADDRLP4 0
+INDIRF4
+CNSTF4 1167867904
+LEF4 $1047
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4+12+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 EffectScripts+3998056
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1051
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_FX_GibPlayer
+CALLV
+pop
+ADDRGP4 $1048
+JUMPV
+LABELV $1051
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_GibPlayer
+CALLV
+pop
+ADDRGP4 $1048
+JUMPV
+LABELV $1047
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+LABELV $1048
+LABELV $1043
+endproc CG_AddInvulnerabilityJuiced 1504 12
+proc CG_AddLocalRefEntity 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1055
+ADDRLP4 0
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1056
+JUMPV
+LABELV $1055
+ADDRLP4 0
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LEF4 $1059
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $1054
+JUMPV
+LABELV $1059
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+LABELV $1054
+endproc CG_AddLocalRefEntity 4 4
+lit
+align 4
+LABELV $1062
+byte 4 0
+byte 4 0
+byte 4 1065353216
+code
+proc CG_AddScorePlum 172 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 112
+ADDRGP4 $1062
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $1064
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 17
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 17
+ASGNU1
+ADDRGP4 $1065
+JUMPV
+LABELV $1064
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 12
+INDIRI4
+CNSTI4 50
+LTI4 $1066
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1067
+JUMPV
+LABELV $1066
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+LTI4 $1068
+ADDRLP4 136
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRGP4 $1069
+JUMPV
+LABELV $1068
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+LTI4 $1070
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1071
+JUMPV
+LABELV $1070
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LTI4 $1072
+ADDRLP4 136
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+LABELV $1072
+LABELV $1071
+LABELV $1069
+LABELV $1067
+LABELV $1065
+ADDRLP4 80
+INDIRF4
+CNSTF4 1048576000
+GEF4 $1074
+ADDRLP4 136
+CNSTF4 1149173760
+ADDRLP4 80
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+LTF4 $1077
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1078
+JUMPV
+LABELV $1077
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1078
+ADDRLP4 8
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 132
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $1075
+JUMPV
+LABELV $1074
+ADDRLP4 8
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $1075
+ADDRLP4 8
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1121714176
+CNSTF4 1120403456
+ADDRLP4 80
+INDIRF4
+MULF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 cg+609412+24
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96+4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96+8
+ADDRGP4 cg+609412+24+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 144
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 148
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 152
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 152
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 16+4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 16+8
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1101004800
+GEF4 $1110
+ADDRGP4 cg_allowLargeSprites+12
+INDIRI4
+CNSTI4 0
+NEI4 $1110
+ADDRGP4 cg_allowSpritePassThrough+12
+INDIRI4
+CNSTI4 0
+NEI4 $1061
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $1061
+JUMPV
+LABELV $1110
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 160
+INDIRI4
+GEI4 $1116
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $1116
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1121
+JUMPV
+LABELV $1118
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $1119
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1121
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 164
+INDIRI4
+EQI4 $1118
+ADDRLP4 12
+INDIRI4
+ADDRLP4 164
+INDIRI4
+NEI4 $1118
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $1122
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1122
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1127
+JUMPV
+LABELV $1124
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRLP4 40
+ADDP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRGP4 cgs+632912+492172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1125
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1127
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $1124
+LABELV $1061
+endproc CG_AddScorePlum 172 12
+proc CG_AddDamagePlum 396 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_damagePlumTarget+12
+INDIRI4
+CNSTI4 0
+NEI4 $1135
+ADDRGP4 $1134
+JUMPV
+LABELV $1135
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+LTI4 $1140
+ADDRLP4 168
+INDIRI4
+CNSTI4 15
+LTI4 $1138
+LABELV $1140
+ADDRGP4 $1141
+ARGP4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1134
+JUMPV
+LABELV $1138
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6747392
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1142
+ADDRGP4 $1134
+JUMPV
+LABELV $1142
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1145
+ADDRGP4 wcg+4
+INDIRI4
+ADDRLP4 192
+INDIRI4
+EQI4 $1147
+ADDRGP4 cg_damagePlumTarget+12
+INDIRI4
+CNSTI4 1
+NEI4 $1147
+ADDRGP4 $1134
+JUMPV
+LABELV $1147
+ADDRLP4 204
+CNSTI4 1496
+ASGNI4
+ADDRLP4 116
+ADDRLP4 204
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 180
+ADDRLP4 204
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $1146
+JUMPV
+LABELV $1145
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $1155
+ADDRLP4 192
+INDIRI4
+ADDRGP4 cg+607196+140
+INDIRI4
+EQI4 $1158
+ADDRGP4 cg_damagePlumTarget+12
+INDIRI4
+CNSTI4 1
+NEI4 $1158
+ADDRGP4 $1134
+JUMPV
+LABELV $1158
+ADDRLP4 116
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRLP4 180
+ADDRGP4 cg+1332136
+INDIRB
+ASGNB 12
+ADDRGP4 $1156
+JUMPV
+LABELV $1155
+ADDRLP4 192
+INDIRI4
+ADDRGP4 cg+607196+140
+INDIRI4
+EQI4 $1165
+ADDRGP4 cg_damagePlumTarget+12
+INDIRI4
+CNSTI4 1
+NEI4 $1165
+ADDRGP4 $1134
+JUMPV
+LABELV $1165
+ADDRLP4 116
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 180
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+LABELV $1156
+LABELV $1146
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 cg_damagePlumColorStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $1174
+ADDRLP4 24
+INDIRI4
+CNSTI4 25
+GTI4 $1177
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 56
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 176
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 222
+ASGNU1
+ADDRGP4 $1175
+JUMPV
+LABELV $1177
+ADDRLP4 24
+INDIRI4
+CNSTI4 26
+LEI4 $1179
+ADDRLP4 24
+INDIRI4
+CNSTI4 50
+GTI4 $1179
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1175
+JUMPV
+LABELV $1179
+ADDRLP4 24
+INDIRI4
+CNSTI4 50
+LEI4 $1181
+ADDRLP4 24
+INDIRI4
+CNSTI4 75
+GTI4 $1181
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 127
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1175
+JUMPV
+LABELV $1181
+ADDRLP4 24
+INDIRI4
+CNSTI4 76
+LTI4 $1183
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1175
+JUMPV
+LABELV $1183
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 56
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 176
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 222
+ASGNU1
+ADDRGP4 $1175
+JUMPV
+LABELV $1174
+ADDRGP4 cg_damagePlumColorStyle+12
+INDIRI4
+CNSTI4 3
+NEI4 $1185
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+LTI4 $1188
+ADDRLP4 168
+INDIRI4
+CNSTI4 14
+GTI4 $1188
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1204-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1204
+address $1190
+address $1191
+address $1192
+address $1193
+address $1194
+address $1195
+address $1196
+address $1197
+address $1198
+address $1199
+address $1200
+address $1201
+address $1202
+address $1203
+code
+LABELV $1190
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 56
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 176
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 222
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1191
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1192
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 127
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1193
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 127
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1194
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1195
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 175
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1196
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1197
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 175
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 175
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1198
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 63
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 175
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1199
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 85
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 168
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 139
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1200
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 175
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 127
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1201
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 127
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1202
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 175
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 175
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 175
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1203
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 175
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 175
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1188
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 56
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 176
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 222
+ASGNU1
+ADDRGP4 $1186
+JUMPV
+LABELV $1185
+ADDRLP4 24
+INDIRI4
+CNSTI4 100
+LTI4 $1206
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1207
+JUMPV
+LABELV $1206
+ADDRLP4 212
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 216
+ADDRLP4 212
+INDIRF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 220
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 220
+INDIRF4
+LTF4 $1209
+ADDRLP4 208
+ADDRLP4 216
+INDIRF4
+ADDRLP4 220
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1210
+JUMPV
+LABELV $1209
+ADDRLP4 208
+ADDRLP4 216
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1210
+ADDRLP4 228
+ADDRLP4 208
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 228
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 228
+INDIRU1
+ASGNU1
+LABELV $1207
+LABELV $1186
+LABELV $1175
+ADDRLP4 172
+INDIRF4
+CNSTF4 1048576000
+GEF4 $1211
+ADDRLP4 212
+CNSTF4 1149173760
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 216
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+LTF4 $1214
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1215
+JUMPV
+LABELV $1214
+ADDRLP4 208
+ADDRLP4 212
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1215
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 208
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $1212
+JUMPV
+LABELV $1211
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $1212
+ADDRLP4 220
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 220
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ADDRLP4 220
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 104
+ADDRLP4 116
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104+4
+ADDRLP4 116+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104+8
+ADDRLP4 116+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 128
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+CNSTU4 40
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 128+12
+ADDRLP4 116
+INDIRF4
+CNSTF4 3276275712
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128+12+4
+ADDRLP4 116+4
+INDIRF4
+CNSTF4 3276275712
+ADDRLP4 104+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128+12+8
+ADDRLP4 116+8
+INDIRF4
+CNSTF4 3276275712
+ADDRLP4 104+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRLP4 104
+ADDRLP4 116
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104+4
+ADDRLP4 116+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104+8
+ADDRLP4 116+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 224
+CNSTF4 3296722944
+ASGNF4
+ADDRLP4 28
+ADDRLP4 116
+INDIRF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 116+4
+INDIRF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 104+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 116+8
+INDIRF4
+CNSTF4 3296722944
+ADDRLP4 104+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 180
+ARGP4
+ADDRLP4 228
+CNSTP4 0
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+ADDRLP4 176
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 232
+INDIRI4
+GEI4 $1245
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $1245
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1250
+JUMPV
+LABELV $1247
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+ADDP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 10
+MODI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $1248
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1250
+ADDRLP4 236
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 236
+INDIRI4
+EQI4 $1247
+ADDRLP4 24
+INDIRI4
+ADDRLP4 236
+INDIRI4
+NEI4 $1247
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $1251
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+ADDP4
+CNSTI4 -3
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1251
+ADDRGP4 cg_damagePlumFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1253
+ADDRLP4 100
+ADDRGP4 cgs+632912+1295600
+ASGNP4
+ADDRGP4 $1254
+JUMPV
+LABELV $1253
+ADDRLP4 100
+ADDRGP4 cgs+632912+623648
+ASGNP4
+LABELV $1254
+ADDRLP4 196
+ADDRGP4 cg_damagePlumScale+8
+INDIRF4
+ASGNF4
+ADDRLP4 240
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRLP4 100
+INDIRP4
+CNSTI4 21532
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 113
+NEI4 $1261
+ADDRLP4 100
+INDIRP4
+CNSTI4 21533
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 51
+NEI4 $1261
+ADDRLP4 100
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1265
+ARGP4
+ADDRLP4 248
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $1263
+ADDRLP4 252
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 8
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRGP4 $1264
+JUMPV
+LABELV $1263
+ADDRLP4 100
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1268
+ARGP4
+ADDRLP4 252
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+NEI4 $1266
+ADDRLP4 8
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $1267
+JUMPV
+LABELV $1266
+ADDRLP4 100
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $1271
+ARGP4
+ADDRLP4 256
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $1269
+ADDRLP4 8
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 52
+CNSTF4 1077936128
+ASGNF4
+LABELV $1269
+LABELV $1267
+LABELV $1264
+LABELV $1261
+ADDRLP4 4
+ADDRLP4 196
+INDIRF4
+ADDRLP4 100
+INDIRP4
+CNSTI4 21528
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 cg_damagePlumFontStyle+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_damagePlumColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1273
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg_damagePlumColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+LABELV $1273
+ADDRGP4 cg_damagePlumAlpha+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1276
+ADDRLP4 252
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ASGNP4
+ADDRLP4 256
+ADDRLP4 252
+INDIRP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRGP4 cg_damagePlumAlpha+12
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 260
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 260
+INDIRF4
+LTF4 $1281
+ADDRLP4 248
+ADDRLP4 256
+INDIRF4
+ADDRLP4 260
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1282
+JUMPV
+LABELV $1281
+ADDRLP4 248
+ADDRLP4 256
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1282
+ADDRLP4 252
+INDIRP4
+ADDRLP4 248
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $1276
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 48
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1286
+JUMPV
+LABELV $1283
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+ADDP4
+INDIRI4
+CNSTI4 48
+ADDI4
+ARGI4
+ADDRLP4 248
+ARGP4
+ADDRGP4 trap_R_GetGlyphInfo
+CALLI4
+pop
+ADDRLP4 332
+ADDRLP4 4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDRLP4 248+4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 248+24
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 248+24
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 248+24
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 340
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRLP4 248+32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 248+36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRLP4 248+40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 248+44
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 248+24
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 248+28
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 248+48
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 248+20
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+INDIRI4
+CNSTI4 3
+EQI4 $1305
+ADDRLP4 56
+INDIRI4
+CNSTI4 6
+NEI4 $1303
+LABELV $1305
+ADDRLP4 56
+INDIRI4
+CNSTI4 3
+NEI4 $1307
+ADDRLP4 368
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1308
+JUMPV
+LABELV $1307
+ADDRLP4 368
+CNSTI4 2
+ASGNI4
+LABELV $1308
+ADDRLP4 352
+ADDRLP4 368
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 348
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 348+1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 348+2
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 348+3
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 356
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 380
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 380
+INDIRP4
+ADDRLP4 380
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 384
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 384
+INDIRP4
+ADDRLP4 384
+INDIRP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 388
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 388
+INDIRP4
+ADDRLP4 388
+INDIRP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 392
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ADDRLP4 392
+INDIRP4
+INDIRF4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 52
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 348
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 348+1
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 348+2
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 348+3
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 356
+INDIRB
+ASGNB 12
+LABELV $1303
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1284
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1286
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+GEI4 $1283
+LABELV $1134
+endproc CG_AddDamagePlum 396 16
+lit
+align 4
+LABELV $1318
+byte 4 0
+byte 4 0
+byte 4 1065353216
+code
+proc CG_AddHeadShotPlum 100 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRGP4 $1318
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 12
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 12
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 12
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 56
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1121714176
+CNSTF4 1120403456
+ADDRLP4 16
+INDIRF4
+MULF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 cg+609412+24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44+4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44+8
+ADDRGP4 cg+609412+24+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 84
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 88
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 20+8
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 92
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 96
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 72
+INDIRF4
+CNSTF4 1101004800
+GEF4 $1351
+ADDRGP4 cg_allowLargeSprites+12
+INDIRI4
+CNSTI4 0
+NEI4 $1351
+ADDRGP4 cg_allowSpritePassThrough+12
+INDIRI4
+CNSTI4 0
+NEI4 $1317
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $1317
+JUMPV
+LABELV $1351
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492500
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityToSceneBatch
+CALLV
+pop
+LABELV $1317
+endproc CG_AddHeadShotPlum 100 12
+export CG_RunFxAll
+proc CG_RunFxAll 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1363
+JUMPV
+LABELV $1360
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 EffectScripts+8290668
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1365
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 EffectScripts+8307052
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1362
+JUMPV
+LABELV $1365
+LABELV $1361
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1363
+ADDRLP4 4
+INDIRI4
+ADDRGP4 EffectScripts+8308076
+INDIRI4
+LTI4 $1360
+LABELV $1362
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1369
+ADDRGP4 $1371
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1359
+JUMPV
+LABELV $1369
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 $1375
+JUMPV
+LABELV $1372
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1376
+ADDRGP4 $1373
+JUMPV
+LABELV $1376
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_GetStoredScriptVarsFromLE
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+ARGP4
+ADDRGP4 ScriptVars
+ARGP4
+CNSTU4 7844
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1373
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $1375
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $1372
+LABELV $1359
+endproc CG_RunFxAll 20 12
+proc IsFxModel 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $1381
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $1381
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $1381
+ADDRGP4 $1379
+JUMPV
+LABELV $1381
+CNSTI4 1
+RETI4
+ADDRGP4 $1378
+JUMPV
+LABELV $1379
+CNSTI4 0
+RETI4
+LABELV $1378
+endproc IsFxModel 4 0
+proc CG_Add_FX_Emitted 212 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_GetStoredScriptVarsFromLE
+CALLV
+pop
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607188
+INDIRI4
+ADDRLP4 124
+INDIRI4
+NEI4 $1387
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 124
+INDIRI4
+EQI4 $1383
+LABELV $1387
+ADDRGP4 ScriptVars+372
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1384
+JUMPV
+LABELV $1383
+CNSTI4 4524
+ADDRGP4 ScriptVars+360
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRGP4 ScriptVars+372
+ADDRLP4 128
+INDIRI4
+ASGNI4
+LABELV $1384
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+176
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRGP4 ScriptVars+176
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1394
+ADDRGP4 ScriptVars+176
+CNSTF4 1065437102
+ASGNF4
+LABELV $1394
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 IsFxModel
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $1398
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRGP4 cg
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+LABELV $1398
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+7740
+INDIRI4
+ADDRLP4 140
+INDIRI4
+EQI4 $1400
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $1400
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 144
+CNSTF4 1065353216
+ADDRGP4 ScriptVars+7744
+INDIRF4
+SUBF4
+ADDRLP4 188
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 188
+INDIRP4
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 192
+INDIRF4
+GEF4 $1405
+ADDRLP4 192
+INDIRF4
+CNSTF4 0
+EQF4 $1405
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 200
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 204
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 152
+ADDRLP4 204
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 204
+INDIRP4
+ADDRLP4 204
+INDIRP4
+INDIRF4
+ADDRGP4 ScriptVars+7748
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 148
+INDIRF4
+ADDRLP4 144
+INDIRF4
+DIVF4
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 R_AddRefEntityPtrToScene
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRGP4 $1406
+JUMPV
+LABELV $1405
+ADDRLP4 200
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 152
+ADDRLP4 200
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 200
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 R_AddRefEntityPtrToScene
+CALLV
+pop
+LABELV $1406
+ADDRLP4 196
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+LTI4 $1382
+ADDRLP4 196
+INDIRI4
+CNSTI4 7
+GTI4 $1382
+ADDRLP4 196
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1418
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1418
+address $1414
+address $1382
+address $1382
+address $1382
+address $1382
+address $1411
+address $1411
+address $1411
+code
+LABELV $1411
+ADDRLP4 156
+INDIRF4
+ADDRLP4 152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 204
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+LEF4 $1382
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1382
+JUMPV
+LABELV $1414
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 172
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 156
+INDIRF4
+ADDRLP4 152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 160+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+LEF4 $1382
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1382
+JUMPV
+LABELV $1400
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+7728
+INDIRI4
+ADDRLP4 144
+INDIRI4
+NEI4 $1423
+ADDRGP4 ScriptVars+1500
+INDIRI4
+ADDRLP4 144
+INDIRI4
+EQI4 $1419
+LABELV $1423
+ADDRLP4 100
+CNSTF4 981668463
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 164
+ADDRGP4 CG_FX_EmittedMoveOrigin
+CALLF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 164
+INDIRF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 148
+ADDRGP4 ScriptVars+84
+INDIRB
+ASGNB 12
+ADDRLP4 116
+INDIRF4
+CNSTF4 0
+EQF4 $1426
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 168
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 168
+INDIRF4
+CNSTF4 0
+LEF4 $1426
+ADDRGP4 ScriptVars+84
+ADDRLP4 28
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+84+4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 104+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+84+8
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 104+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+84
+ADDRGP4 ScriptVars+84
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 100
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 ScriptVars+84+4
+ADDRGP4 ScriptVars+84+4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 100
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 ScriptVars+84+8
+ADDRGP4 ScriptVars+84+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 100
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $1426
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_LocalEntityTrace
+CALLV
+pop
+ADDRLP4 40+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $1447
+ADDRLP4 40+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+EQU4 $1450
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $1382
+JUMPV
+LABELV $1450
+ADDRLP4 40+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1453
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $1382
+JUMPV
+LABELV $1453
+ADDRLP4 28
+ADDRLP4 40+12
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7728
+INDIRI4
+CNSTI4 0
+EQI4 $1457
+ADDRGP4 ScriptVars+84
+ADDRLP4 148
+INDIRB
+ASGNB 12
+ADDRLP4 120
+ADDRGP4 ScriptVars+84
+INDIRF4
+ADDRLP4 40+24
+INDIRF4
+MULF4
+ADDRGP4 ScriptVars+84+4
+INDIRF4
+ADDRLP4 40+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 ScriptVars+84+8
+INDIRF4
+ADDRLP4 40+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 ScriptVars+84
+ADDRGP4 ScriptVars+84
+INDIRF4
+ADDRLP4 40+24
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 120
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 ScriptVars+84+4
+ADDRGP4 ScriptVars+84+4
+INDIRF4
+ADDRLP4 40+24+4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 120
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 ScriptVars+84+8
+ADDRGP4 ScriptVars+84+8
+INDIRF4
+ADDRLP4 40+24+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 120
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 ScriptVars+84
+ADDRGP4 ScriptVars+84
+INDIRF4
+ADDRGP4 ScriptVars+7736
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 ScriptVars+84+4
+ADDRGP4 ScriptVars+84+4
+INDIRF4
+ADDRGP4 ScriptVars+7736
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 ScriptVars+84+8
+ADDRGP4 ScriptVars+84+8
+INDIRF4
+ADDRGP4 ScriptVars+7736
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRGP4 ScriptVars+84
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 40+12
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7812
+ADDRLP4 40+12
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8172
+ADDP4
+ADDRLP4 40+12
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7824
+ADDRLP4 40+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8184
+ADDP4
+ADDRLP4 40+24
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7836
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8196
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 ScriptVars+84
+ARGP4
+ADDRLP4 176
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1101004800
+GEF4 $1448
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1448
+JUMPV
+LABELV $1457
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $1382
+JUMPV
+LABELV $1447
+LABELV $1448
+ADDRLP4 104
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 172
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 8124
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRF4
+ADDRLP4 172
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 ScriptVars+7764
+ADDRFP4 0
+INDIRP4
+CNSTI4 8124
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+60
+ADDRLP4 28
+INDIRB
+ASGNB 12
+LABELV $1419
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRLP4 148
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1140457472
+LEF4 $1517
+LABELV $1517
+ADDRLP4 152
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 5
+EQI4 $1522
+ADDRLP4 152
+INDIRI4
+CNSTI4 6
+EQI4 $1522
+ADDRLP4 152
+INDIRI4
+CNSTI4 7
+NEI4 $1519
+LABELV $1522
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 7
+NEI4 $1523
+ADDRGP4 $1524
+JUMPV
+LABELV $1523
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 6
+NEI4 $1525
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1525
+LABELV $1524
+ADDRLP4 96
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_fxratio+8
+INDIRF4
+GEF4 $1527
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 R_AddRefEntityPtrToScene
+CALLV
+pop
+ADDRGP4 $1382
+JUMPV
+LABELV $1527
+LABELV $1519
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRF4
+SUBF4
+ADDRGP4 cg_fxinterval+8
+INDIRF4
+LEF4 $1530
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRGP4 DistanceScript
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 EmitterScript
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_fxq3mmeCompatibility+12
+INDIRI4
+ADDRLP4 156
+INDIRI4
+EQI4 $1534
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $1535
+JUMPV
+LABELV $1534
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+LABELV $1535
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRGP4 EmitterScript
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRGP4 DistanceScript
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+7728
+INDIRI4
+ADDRLP4 164
+INDIRI4
+NEI4 $1542
+ADDRGP4 ScriptVars+1500
+INDIRI4
+ADDRLP4 164
+INDIRI4
+EQI4 $1538
+LABELV $1542
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 28
+INDIRB
+ASGNB 12
+ADDRGP4 $1531
+JUMPV
+LABELV $1538
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRGP4 $1531
+JUMPV
+LABELV $1530
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+7728
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $1548
+ADDRGP4 ScriptVars+1500
+INDIRI4
+ADDRLP4 156
+INDIRI4
+EQI4 $1544
+LABELV $1548
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 28
+INDIRB
+ASGNB 12
+LABELV $1544
+LABELV $1545
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+1528
+INDIRI4
+ADDRLP4 160
+INDIRI4
+NEI4 $1553
+ADDRGP4 ScriptVars+1532
+INDIRI4
+ADDRLP4 160
+INDIRI4
+EQI4 $1549
+LABELV $1553
+ADDRLP4 164
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 5
+EQI4 $1557
+ADDRLP4 164
+INDIRI4
+CNSTI4 6
+EQI4 $1557
+ADDRLP4 164
+INDIRI4
+CNSTI4 7
+NEI4 $1554
+LABELV $1557
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 172
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 ScriptVars
+INDIRF4
+GEF4 $1568
+ADDRGP4 $1382
+JUMPV
+LABELV $1568
+LABELV $1554
+LABELV $1549
+ADDRGP4 ScriptVars+1536
+INDIRI4
+CNSTI4 0
+EQI4 $1570
+ADDRLP4 164
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 5
+EQI4 $1576
+ADDRLP4 164
+INDIRI4
+CNSTI4 6
+EQI4 $1576
+ADDRLP4 164
+INDIRI4
+CNSTI4 7
+NEI4 $1573
+LABELV $1576
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 172
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 ScriptVars+1540
+INDIRF4
+LTF4 $1587
+ADDRGP4 $1382
+JUMPV
+LABELV $1587
+LABELV $1573
+LABELV $1570
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 R_AddRefEntityPtrToScene
+CALLV
+pop
+ADDRGP4 $1382
+JUMPV
+LABELV $1531
+ADDRGP4 ScriptVars+1508
+INDIRI4
+CNSTI4 0
+EQI4 $1590
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 ScriptVars+1512
+INDIRF4
+ASGNF4
+LABELV $1590
+ADDRLP4 156
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 5
+EQI4 $1597
+ADDRLP4 156
+INDIRI4
+CNSTI4 6
+EQI4 $1597
+ADDRLP4 156
+INDIRI4
+CNSTI4 7
+NEI4 $1594
+LABELV $1597
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 164
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 164
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 ScriptVars
+INDIRF4
+GEF4 $1608
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+1528
+INDIRI4
+ADDRLP4 168
+INDIRI4
+NEI4 $1614
+ADDRGP4 ScriptVars+1532
+INDIRI4
+ADDRLP4 168
+INDIRI4
+EQI4 $1609
+LABELV $1614
+ADDRGP4 $1382
+JUMPV
+LABELV $1608
+LABELV $1609
+ADDRGP4 ScriptVars+1536
+INDIRI4
+CNSTI4 0
+EQI4 $1615
+ADDRLP4 4
+INDIRF4
+ADDRGP4 ScriptVars+1540
+INDIRF4
+LTF4 $1618
+ADDRGP4 $1382
+JUMPV
+LABELV $1618
+LABELV $1615
+LABELV $1594
+ADDRGP4 ScriptVars+1484
+INDIRI4
+CNSTI4 0
+EQI4 $1621
+ADDRLP4 24
+CNSTF4 1065353216
+ADDRGP4 ScriptVars+1488
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+ADDRGP4 ScriptVars+176
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 160
+ADDRGP4 ScriptVars+316+12
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1621
+ADDRGP4 ScriptVars+1492
+INDIRI4
+CNSTI4 0
+EQI4 $1628
+ADDRLP4 160
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+ADDRLP4 160
+INDIRF4
+ADDRGP4 ScriptVars+1496
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 160
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 ScriptVars+176
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 164
+ADDRGP4 ScriptVars+316
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 168
+ADDRGP4 ScriptVars+316+4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 172
+ADDRGP4 ScriptVars+316+8
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1628
+ADDRLP4 164
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 168
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 168
+INDIRF4
+LTF4 $1640
+ADDRLP4 160
+ADDRLP4 164
+INDIRF4
+ADDRLP4 168
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1641
+JUMPV
+LABELV $1640
+ADDRLP4 160
+ADDRLP4 164
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1641
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 160
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 176
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+LTF4 $1645
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1646
+JUMPV
+LABELV $1645
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1646
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 172
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 188
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 192
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 192
+INDIRF4
+LTF4 $1650
+ADDRLP4 184
+ADDRLP4 188
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1651
+JUMPV
+LABELV $1650
+ADDRLP4 184
+ADDRLP4 188
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1651
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 184
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 200
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 204
+INDIRF4
+LTF4 $1655
+ADDRLP4 196
+ADDRLP4 200
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1656
+JUMPV
+LABELV $1655
+ADDRLP4 196
+ADDRLP4 200
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1656
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 196
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 ScriptVars+380
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1657
+LABELV $1657
+LABELV $1658
+ADDRLP4 208
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 5
+EQI4 $1663
+ADDRLP4 208
+INDIRI4
+CNSTI4 6
+EQI4 $1663
+ADDRLP4 208
+INDIRI4
+CNSTI4 7
+NEI4 $1660
+LABELV $1663
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 7
+NEI4 $1664
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 ScriptVars+84
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRGP4 ScriptVars+4
+INDIRF4
+ASGNF4
+ADDRGP4 $1661
+JUMPV
+LABELV $1664
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 6
+NEI4 $1661
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1661
+JUMPV
+LABELV $1660
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 13
+NEI4 $1671
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+ADDRGP4 $1672
+JUMPV
+LABELV $1671
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 14
+NEI4 $1674
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+LABELV $1674
+LABELV $1672
+LABELV $1661
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 ScriptVars
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 14
+NEI4 $1677
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 ScriptVars+4
+INDIRF4
+ASGNF4
+ADDRGP4 $1678
+JUMPV
+LABELV $1677
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 ScriptVars+52
+INDIRF4
+ASGNF4
+LABELV $1678
+ADDRFP4 0
+INDIRP4
+CNSTI4 8124
+ADDP4
+ADDRGP4 ScriptVars+7764
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8196
+ADDP4
+ADDRGP4 ScriptVars+7836
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8132
+ADDP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8144
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8148
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8160
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 R_AddRefEntityPtrToScene
+CALLV
+pop
+LABELV $1382
+endproc CG_Add_FX_Emitted 212 16
+proc CG_Run_FX_Emitted_Script 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_GetStoredScriptVarsFromLE
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+176
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRGP4 ScriptVars+176
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1690
+ADDRGP4 ScriptVars+176
+CNSTF4 1065437102
+ASGNF4
+LABELV $1690
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRF4
+EQF4 $1694
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 EmitterScript
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 PlainScript
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 ScriptVars+176
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1697
+LABELV $1697
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 EmitterScript
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 PlainScript
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $1694
+LABELV $1687
+endproc CG_Run_FX_Emitted_Script 16 8
+proc CG_Add_FX_Emitted_Light 8 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_GetStoredScriptVarsFromLE
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+176
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRGP4 ScriptVars+176
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1704
+ADDRGP4 ScriptVars+176
+CNSTF4 1065437102
+ASGNF4
+LABELV $1704
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRF4
+EQF4 $1708
+ADDRGP4 EmitterScript
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 EmitterScript
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $1708
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRGP4 ScriptVars
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1701
+endproc CG_Add_FX_Emitted_Light 8 20
+proc CG_Add_FX_Emitted_Sound 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_GetStoredScriptVarsFromLE
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+176
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRGP4 ScriptVars+176
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1721
+ADDRGP4 ScriptVars+176
+CNSTF4 1065437102
+ASGNF4
+LABELV $1721
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRF4
+EQF4 $1725
+ADDRGP4 EmitterScript
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 EmitterScript
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $1725
+ADDRGP4 ScriptVars+572
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1729
+ADDRGP4 ScriptVars+572
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 ScriptVars+60
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $1729
+LABELV $1718
+endproc CG_Add_FX_Emitted_Sound 16 16
+proc CG_Add_FX_Emitted_LoopSound 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_GetStoredScriptVarsFromLE
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+176
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRGP4 ScriptVars+176
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1737
+ADDRGP4 ScriptVars+176
+CNSTF4 1065437102
+ASGNF4
+LABELV $1737
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRF4
+EQF4 $1741
+ADDRGP4 EmitterScript
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 EmitterScript
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $1741
+ADDRGP4 ScriptVars+508
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1746
+ADDRGP4 $1748
+JUMPV
+ADDRGP4 ScriptVars+640
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRGP4 ScriptVars+84
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddLoopingSound
+CALLV
+pop
+ADDRGP4 $1749
+JUMPV
+LABELV $1748
+ADDRGP4 FxLoopSounds
+INDIRI4
+CNSTI4 2048
+LTI4 $1753
+ADDRGP4 $1755
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1754
+JUMPV
+LABELV $1753
+ADDRGP4 FxLoopSounds
+INDIRI4
+ARGI4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRGP4 ScriptVars+84
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddLoopingSound
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 FxLoopSounds
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1754
+LABELV $1749
+LABELV $1746
+LABELV $1734
+endproc CG_Add_FX_Emitted_LoopSound 20 16
+proc CG_AddLocalEntitiesExt 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 Next
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $1762
+JUMPV
+LABELV $1759
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LEI4 $1763
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 Next
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $1765
+ADDRGP4 $1761
+JUMPV
+LABELV $1765
+LABELV $1763
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1767
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 Next
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1768
+JUMPV
+LABELV $1767
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 Next
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1761
+JUMPV
+LABELV $1768
+ADDRLP4 0
+INDIRP4
+CNSTI4 8208
+ADDP4
+INDIRI4
+ADDRGP4 FrameCount
+INDIRI4
+NEI4 $1771
+ADDRGP4 $1760
+JUMPV
+LABELV $1771
+LABELV $1769
+ADDRLP4 0
+INDIRP4
+CNSTI4 8208
+ADDP4
+ADDRGP4 FrameCount
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1773
+ADDRGP4 $1760
+JUMPV
+LABELV $1773
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1775
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ARGP4
+ADDRGP4 R_AddRefEntityPtrToScene
+CALLV
+pop
+ADDRGP4 $1760
+JUMPV
+LABELV $1775
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1777
+ADDRLP4 8
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1778
+JUMPV
+LABELV $1777
+ADDRLP4 8
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $1778
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1781
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+LTF4 $1782
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $1760
+JUMPV
+LABELV $1781
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8116
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $1785
+ADDRLP4 0
+INDIRP4
+CNSTI4 8120
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $1785
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $1760
+JUMPV
+LABELV $1785
+ADDRLP4 0
+INDIRP4
+CNSTI4 8116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1787
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+LTF4 $1787
+ADDRLP4 0
+INDIRP4
+CNSTI4 8120
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1788
+JUMPV
+LABELV $1787
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+LTF4 $1789
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $1760
+JUMPV
+LABELV $1789
+LABELV $1788
+LABELV $1782
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+LTI4 $1792
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+GTI4 $1792
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1799-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1799
+address $1794
+address $1796
+address $1797
+address $1798
+address $1795
+code
+LABELV $1794
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Add_FX_Emitted
+CALLV
+pop
+ADDRGP4 $1760
+JUMPV
+LABELV $1795
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Run_FX_Emitted_Script
+CALLV
+pop
+ADDRGP4 $1760
+JUMPV
+LABELV $1796
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Add_FX_Emitted_Light
+CALLV
+pop
+ADDRGP4 $1760
+JUMPV
+LABELV $1797
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Add_FX_Emitted_Sound
+CALLV
+pop
+ADDRGP4 $1760
+JUMPV
+LABELV $1798
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Add_FX_Emitted_LoopSound
+CALLV
+pop
+ADDRGP4 $1760
+JUMPV
+LABELV $1792
+ADDRLP4 0
+INDIRP4
+CNSTI4 8216
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1801
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $1801
+ADDRGP4 $1760
+JUMPV
+LABELV $1801
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $1803
+ADDRLP4 32
+INDIRI4
+CNSTI4 14
+GTI4 $1803
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1822
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1822
+address $1804
+address $1809
+address $1808
+address $1810
+address $1811
+address $1813
+address $1812
+address $1814
+address $1815
+address $1816
+address $1817
+address $1818
+address $1819
+address $1820
+address $1821
+code
+LABELV $1803
+ADDRGP4 $1806
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1808
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddSpriteExplosion
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1809
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddExplosion
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1810
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFragment
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1811
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddMoveScaleFade
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1812
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFadeRGB
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1813
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFallScaleFade
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1814
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddScaleFade
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1815
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddScorePlum
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1816
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddDamagePlum
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1817
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddHeadShotPlum
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1818
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddKamikaze
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1819
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddInvulnerabilityImpact
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1820
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddInvulnerabilityJuiced
+CALLV
+pop
+ADDRGP4 $1804
+JUMPV
+LABELV $1821
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddLocalRefEntity
+CALLV
+pop
+LABELV $1804
+LABELV $1760
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1762
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $1759
+LABELV $1761
+LABELV $1758
+endproc CG_AddLocalEntitiesExt 40 8
+export CG_AddLocalEntities
+proc CG_AddLocalEntities 0 4
+ADDRGP4 Next
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 Increment_FrameCount
+CALLV
+pop
+ADDRGP4 CG_TraceLocalEntities
+CALLV
+pop
+ADDRGP4 CG_CullLocalEntities
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_AddLocalEntitiesExt
+CALLV
+pop
+LABELV $1823
+endproc CG_AddLocalEntities 0 4
+export CG_ClearLocalFrameEntities
+proc CG_ClearLocalFrameEntities 20 4
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1825
+ADDRGP4 $1824
+JUMPV
+LABELV $1825
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1830
+JUMPV
+LABELV $1827
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1833
+ADDRLP4 12
+INDIRI4
+CNSTI4 128
+BANDI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1831
+LABELV $1833
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+LABELV $1831
+LABELV $1828
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1830
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $1827
+LABELV $1824
+endproc CG_ClearLocalFrameEntities 20 4
+export CG_RemoveFXLocalEntities
+proc CG_RemoveFXLocalEntities 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 $1838
+JUMPV
+LABELV $1835
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1839
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $1841
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+NEF4 $1839
+LABELV $1841
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+LABELV $1839
+LABELV $1836
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1838
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $1835
+LABELV $1834
+endproc CG_RemoveFXLocalEntities 16 4
+export CG_ListLocalEntities
+proc CG_ListLocalEntities 52 28
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 $1846
+JUMPV
+LABELV $1843
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1847
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1849
+ADDRGP4 $1851
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1848
+JUMPV
+LABELV $1849
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1853
+ADDRGP4 $1855
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1848
+JUMPV
+LABELV $1853
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1857
+ADDRGP4 $1859
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1848
+JUMPV
+LABELV $1857
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1861
+ADDRGP4 $1863
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1848
+JUMPV
+LABELV $1861
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $1865
+ADDRGP4 $1867
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1848
+JUMPV
+LABELV $1865
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 14
+NEI4 $1869
+ADDRGP4 $1871
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1848
+JUMPV
+LABELV $1869
+ADDRGP4 $1873
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1848
+JUMPV
+LABELV $1847
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1875
+ADDRGP4 $1877
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1876
+JUMPV
+LABELV $1875
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1879
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1881
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1880
+JUMPV
+LABELV $1879
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1883
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1885
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1884
+JUMPV
+LABELV $1883
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1887
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1889
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8200
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1888
+JUMPV
+LABELV $1887
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 64
+NEI4 $1891
+ADDRGP4 $1893
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1892
+JUMPV
+LABELV $1891
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 128
+NEI4 $1894
+ADDRGP4 $1896
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1894
+LABELV $1892
+LABELV $1888
+LABELV $1884
+LABELV $1880
+LABELV $1876
+LABELV $1848
+LABELV $1844
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $1846
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $1843
+ADDRGP4 $1897
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1842
+endproc CG_ListLocalEntities 52 28
+export CG_AddRefEntity
+proc CG_AddRefEntity 8 4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_AllocLocalEntityExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 64
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 12
+NEI4 $1899
+ADDRGP4 cg+711640
+CNSTI4 1
+ASGNI4
+LABELV $1899
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1898
+endproc CG_AddRefEntity 8 4
+export CG_AddRefEntityFX
+proc CG_AddRefEntityFX 8 12
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_AllocLocalEntityExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 172
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1902
+endproc CG_AddRefEntityFX 8 12
+bss
+align 4
+LABELV leGridUsePvs
+skip 4
+align 4
+LABELV leGridFrustum
+skip 80
+align 4
+LABELV numLeGridEntities
+skip 4
+align 4
+LABELV leGridEntities
+skip 393120
+align 4
+LABELV leGridHash
+skip 8192
+align 4
+LABELV numLeGridCells
+skip 4
+align 4
+LABELV leGridCells
+skip 40960
+align 4
+LABELV batchTraces
+skip 57344
+align 4
+LABELV batchTraceEnds
+skip 12288
+align 4
+LABELV batchTraceStarts
+skip 12288
+align 4
+LABELV Next
+skip 36
+align 4
+LABELV tmpLocalEntity
+skip 8220
+align 4
+LABELV cg_freeLocalEntities
+skip 4
+align 4
+LABELV cg_activeLocalEntities
+skip 8220
+align 4
+LABELV cg_localEntities
+skip 134643600
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_AddRealLoopingSound
+import CG_AddLoopingSound
+import CG_StartLocalSound
+import CG_StartSound
+import CG_ClearSceneBatch
+import CG_FlushSceneBatch
+import CG_AddPolyToSceneBatch
+import CG_AddRefEntityToSceneBatch
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_NewParticleArea
+import CG_ParticleExplosion
+import CG_AddParticles
+import CG_ClearParticles
+import CG_AddMarks
+import CG_ImpactMark
+import CG_InitMarkPolys
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_ThawPlayer
+import CG_GibPlayer
+import CG_FX_ThawPlayer
+import CG_FX_GibPlayer
+import CG_ImpactSparks
+import CG_Bleed
+import CG_MakeExplosion
+import CG_HeadShotPlum
+import CG_DamagePlum
+import CG_ScorePlum
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_LightningBoltBeam
+import CG_SpawnEffect
+import CG_SmokePuff
+import CG_BubbleTrail
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_GetStoredScriptVarsFromLE
+import CG_FreeFxJitTokens
+import CG_ResetFXIntervalAndDistance
+import CG_UpdatePositionData
+import CG_CopyPositionDataToScript
+import CG_CopyPositionDataToCent
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+import CG_CopyPlayerDataToScriptData
+import CG_ResetScriptVars
+import CG_ReloadQ3mmeScripts
+import CG_RunQ3mmeScript
+import CG_Q3mmeMath
+import EffectScripts
+import PlainScript
+import DistanceScript
+import EmitterScript
+import EmitterScriptVars
+import ScriptVars
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1897
+byte 1 94
+byte 1 53
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 69
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1896
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 102
+byte 1 120
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $1893
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $1889
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $1885
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $1881
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $1877
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $1873
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 39
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1871
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1867
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 98
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1863
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1859
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1855
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1851
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1806
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1755
+byte 1 94
+byte 1 51
+byte 1 102
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1371
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1271
+byte 1 113
+byte 1 51
+byte 1 103
+byte 1 105
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1268
+byte 1 113
+byte 1 51
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1265
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $1141
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 100
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $300
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 0
+align 1
+LABELV $278
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $277
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $270
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $266
+byte 1 120
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 0
+align 1
+LABELV $230
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $225
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 112
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $220
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 112
+byte 1 32
+byte 1 40
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $214
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 68
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 120
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $204
+byte 1 94
+byte 1 53
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 112
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $197
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $183
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $177
+byte 1 94
+byte 1 53
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 10
+byte 1 0
@@ -0,0 +1,79968 @@
+data
+align 4
+LABELV forceModelModificationCount
+byte 4 -1
+export gametypeConfigs
+align 4
+LABELV gametypeConfigs
+address $159
+address $160
+address $161
+address $162
+address $163
+address $164
+address $165
+address $166
+address $167
+address $168
+address $169
+address $170
+address $171
+address $172
+address $173
+address $174
+address $175
+export vmMain
+code
+proc vmMain 20 24
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $177
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GTI4 $177
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $195
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $195
+address $179
+address $180
+address $181
+address $182
+address $183
+address $184
+address $185
+address $186
+address $191
+address $192
+address $193
+code
+LABELV $179
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $180
+ADDRGP4 CG_Shutdown
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $181
+ADDRLP4 4
+ADDRGP4 CG_ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $182
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActiveFrame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $183
+ADDRLP4 8
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $184
+ADDRLP4 12
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $185
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_KeyEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $186
+ADDRGP4 cgDC+224
+ADDRGP4 cgs+632808
+INDIRI4
+ASGNI4
+ADDRGP4 cgDC+228
+ADDRGP4 cgs+632812
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_MouseEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $191
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_EventHandling
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $192
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_TimeChange
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $193
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+CNSTF4 1132396544
+ASGNF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ARGF4
+ADDRGP4 Q_SetColorTable
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $177
+ADDRGP4 $194
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $178
+CNSTI4 -1
+RETI4
+LABELV $176
+endproc vmMain 20 24
+data
+export EM_Loaded
+align 4
+LABELV EM_Loaded
+byte 4 0
+align 4
+LABELV cvarTable
+address cg_ignore
+address $197
+address $198
+byte 4 0
+address cg_autoswitch
+address $199
+address $198
+byte 4 1
+address cg_drawGun
+address $200
+address $201
+byte 4 1
+address cg_zoomFov
+address $202
+address $203
+byte 4 1
+address cg_zoomTime
+address $204
+address $205
+byte 4 1
+address cg_zoomIgnoreTimescale
+address $206
+address $201
+byte 4 1
+address cg_zoomBroken
+address $207
+address $201
+byte 4 1
+address cg_fov
+address $208
+address $209
+byte 4 1
+address cg_fovy
+address $210
+address $211
+byte 4 1
+address cg_fovStyle
+address $212
+address $201
+byte 4 1
+address cg_fovForceAspectWidth
+address $213
+address $211
+byte 4 1
+address cg_fovForceAspectHeight
+address $214
+address $211
+byte 4 1
+address cg_fovIntermission
+address $215
+address $216
+byte 4 1
+address cg_viewsize
+address $217
+address $218
+byte 4 1
+address cg_stereoSeparation
+address $219
+address $220
+byte 4 1
+address cg_shadows
+address $221
+address $201
+byte 4 1
+address cg_thawGibs
+address $222
+address $223
+byte 4 1
+address cg_gibs
+address $224
+address $225
+byte 4 1
+address cg_gibColor
+address $226
+address $211
+byte 4 1
+address cg_gibJump
+address $227
+address $198
+byte 4 1
+address cg_gibVelocity
+address $228
+address $229
+byte 4 1
+address cg_gibVelocityRandomness
+address $230
+address $231
+byte 4 1
+address cg_gibDirScale
+address $232
+address $233
+byte 4 1
+address cg_gibOriginOffset
+address $234
+address $198
+byte 4 1
+address cg_gibOriginOffsetZ
+address $235
+address $198
+byte 4 1
+address cg_gibRandomness
+address $236
+address $231
+byte 4 1
+address cg_gibRandomnessZ
+address $237
+address $198
+byte 4 1
+address cg_gibTime
+address $238
+address $239
+byte 4 1
+address cg_gibStepTime
+address $240
+address $241
+byte 4 1
+address cg_gibBounceFactor
+address $242
+address $243
+byte 4 1
+address cg_gibGravity
+address $244
+address $245
+byte 4 1
+address cg_gibSparksSize
+address $246
+address $247
+byte 4 1
+address cg_gibSparksColor
+address $248
+address $211
+byte 4 1
+address cg_gibSparksHighlight
+address $249
+address $211
+byte 4 1
+address cg_gibFloatingVelocity
+address $250
+address $251
+byte 4 1
+address cg_gibFloatingRandomness
+address $252
+address $253
+byte 4 1
+address cg_gibFloatingOriginOffset
+address $254
+address $255
+byte 4 1
+address cg_gibFloatingOriginOffsetZ
+address $256
+address $198
+byte 4 1
+address cg_impactSparks
+address $257
+address $201
+byte 4 1
+address cg_impactSparksLifetime
+address $258
+address $231
+byte 4 1
+address cg_impactSparksSize
+address $259
+address $260
+byte 4 1
+address cg_impactSparksVelocity
+address $261
+address $262
+byte 4 1
+address cg_impactSparksColor
+address $263
+address $211
+byte 4 1
+address cg_impactSparksHighlight
+address $264
+address $198
+byte 4 1
+address cg_shotgunImpactSparks
+address $265
+address $201
+byte 4 1
+address cg_shotgunMarks
+address $266
+address $201
+byte 4 1
+address cg_shotgunStyle
+address $267
+address $201
+byte 4 1
+address cg_shotgunRandomness
+address $268
+address $269
+byte 4 1
+address cg_draw2D
+address $270
+address $201
+byte 4 1
+address cg_drawStatus
+address $271
+address $201
+byte 4 1
+address cg_drawTeamBackground
+address $272
+address $201
+byte 4 1
+address cg_drawTimer
+address $273
+address $201
+byte 4 1
+address cg_drawClientItemTimer
+address $274
+address $201
+byte 4 1
+address cg_drawClientItemTimerFilter
+address $275
+address $276
+byte 4 1
+address cg_drawClientItemTimerX
+address $277
+address $278
+byte 4 1
+address cg_drawClientItemTimerY
+address $279
+address $205
+byte 4 1
+address cg_drawClientItemTimerScale
+address $280
+address $220
+byte 4 1
+address cg_drawClientItemTimerTextColor
+address $281
+address $211
+byte 4 1
+address cg_drawClientItemTimerFont
+address $282
+address $283
+byte 4 1
+address cg_drawClientItemTimerPointSize
+address $284
+address $285
+byte 4 1
+address cg_drawClientItemTimerAlpha
+address $286
+address $287
+byte 4 1
+address cg_drawClientItemTimerStyle
+address $288
+address $289
+byte 4 1
+address cg_drawClientItemTimerAlign
+address $290
+address $291
+byte 4 1
+address cg_drawClientItemTimerSpacing
+address $292
+address $211
+byte 4 1
+address cg_drawClientItemTimerIcon
+address $293
+address $201
+byte 4 1
+address cg_drawClientItemTimerIconSize
+address $294
+address $295
+byte 4 1
+address cg_drawClientItemTimerIconXoffset
+address $296
+address $297
+byte 4 1
+address cg_drawClientItemTimerIconYoffset
+address $298
+address $198
+byte 4 1
+address cg_drawClientItemTimerWideScreen
+address $299
+address $300
+byte 4 1
+address cg_itemSpawnPrint
+address $301
+address $198
+byte 4 1
+address cg_itemTimers
+address $302
+address $201
+byte 4 1
+address cg_itemTimersScale
+address $303
+address $304
+byte 4 1
+address cg_itemTimersOffset
+address $305
+address $306
+byte 4 1
+address cg_itemTimersAlpha
+address $307
+address $287
+byte 4 1
+address cg_drawFPS
+address $308
+address $201
+byte 4 1
+address cg_drawFPSNoText
+address $309
+address $198
+byte 4 1
+address cg_drawFPSX
+address $310
+address $278
+byte 4 1
+address cg_drawFPSY
+address $311
+address $211
+byte 4 1
+address cg_drawFPSAlign
+address $312
+address $291
+byte 4 1
+address cg_drawFPSStyle
+address $313
+address $300
+byte 4 1
+address cg_drawFPSFont
+address $314
+address $315
+byte 4 1
+address cg_drawFPSPointSize
+address $316
+address $285
+byte 4 1
+address cg_drawFPSScale
+address $317
+address $318
+byte 4 1
+address cg_drawFPSColor
+address $319
+address $320
+byte 4 1
+address cg_drawFPSAlpha
+address $321
+address $287
+byte 4 1
+address cg_drawFPSWideScreen
+address $322
+address $300
+byte 4 1
+address cg_drawSnapshot
+address $323
+address $198
+byte 4 1
+address cg_drawSnapshotX
+address $324
+address $278
+byte 4 1
+address cg_drawSnapshotY
+address $325
+address $211
+byte 4 1
+address cg_drawSnapshotAlign
+address $326
+address $291
+byte 4 1
+address cg_drawSnapshotStyle
+address $327
+address $300
+byte 4 1
+address cg_drawSnapshotFont
+address $328
+address $329
+byte 4 1
+address cg_drawSnapshotPointSize
+address $330
+address $285
+byte 4 1
+address cg_drawSnapshotScale
+address $331
+address $318
+byte 4 1
+address cg_drawSnapshotColor
+address $332
+address $320
+byte 4 1
+address cg_drawSnapshotAlpha
+address $333
+address $287
+byte 4 1
+address cg_drawSnapshotWideScreen
+address $334
+address $300
+byte 4 1
+address cg_draw3dIcons
+address $335
+address $201
+byte 4 1
+address cg_drawIcons
+address $336
+address $201
+byte 4 1
+address cg_drawAmmoWarning
+address $337
+address $201
+byte 4 1
+address cg_drawAmmoWarningX
+address $338
+address $339
+byte 4 1
+address cg_drawAmmoWarningY
+address $340
+address $341
+byte 4 1
+address cg_drawAmmoWarningAlign
+address $342
+address $201
+byte 4 1
+address cg_drawAmmoWarningStyle
+address $343
+address $289
+byte 4 1
+address cg_drawAmmoWarningFont
+address $344
+address $345
+byte 4 1
+address cg_drawAmmoWarningPointSize
+address $346
+address $285
+byte 4 1
+address cg_drawAmmoWarningScale
+address $347
+address $318
+byte 4 1
+address cg_drawAmmoWarningColor
+address $348
+address $320
+byte 4 1
+address cg_drawAmmoWarningAlpha
+address $349
+address $287
+byte 4 1
+address cg_drawAmmoWarningWideScreen
+address $350
+address $291
+byte 4 1
+address cg_lowAmmoWarningStyle
+address $351
+address $201
+byte 4 1
+address cg_lowAmmoWarningPercentile
+address $352
+address $353
+byte 4 1
+address cg_lowAmmoWarningSound
+address $354
+address $201
+byte 4 1
+address cg_lowAmmoWeaponBarWarning
+address $355
+address $291
+byte 4 1
+address cg_lowAmmoWarningGauntlet
+address $356
+address $357
+byte 4 1
+address cg_lowAmmoWarningMachineGun
+address $358
+address $255
+byte 4 1
+address cg_lowAmmoWarningShotgun
+address $359
+address $357
+byte 4 1
+address cg_lowAmmoWarningGrenadeLauncher
+address $360
+address $357
+byte 4 1
+address cg_lowAmmoWarningRocketLauncher
+address $361
+address $357
+byte 4 1
+address cg_lowAmmoWarningLightningGun
+address $362
+address $255
+byte 4 1
+address cg_lowAmmoWarningRailGun
+address $363
+address $357
+byte 4 1
+address cg_lowAmmoWarningPlasmaGun
+address $364
+address $255
+byte 4 1
+address cg_lowAmmoWarningBFG
+address $365
+address $357
+byte 4 1
+address cg_lowAmmoWarningGrapplingHook
+address $366
+address $357
+byte 4 1
+address cg_lowAmmoWarningNailGun
+address $367
+address $255
+byte 4 1
+address cg_lowAmmoWarningProximityLauncher
+address $368
+address $255
+byte 4 1
+address cg_lowAmmoWarningChainGun
+address $369
+address $255
+byte 4 1
+address cg_drawAttacker
+address $370
+address $201
+byte 4 1
+address cg_drawAttackerX
+address $371
+address $372
+byte 4 1
+address cg_drawAttackerY
+address $373
+address $211
+byte 4 1
+address cg_drawAttackerAlign
+address $374
+address $291
+byte 4 1
+address cg_drawAttackerStyle
+address $375
+address $300
+byte 4 1
+address cg_drawAttackerFont
+address $376
+address $211
+byte 4 1
+address cg_drawAttackerPointSize
+address $377
+address $285
+byte 4 1
+address cg_drawAttackerScale
+address $378
+address $318
+byte 4 1
+address cg_drawAttackerImageScale
+address $379
+address $300
+byte 4 1
+address cg_drawAttackerTime
+address $380
+address $381
+byte 4 1
+address cg_drawAttackerColor
+address $382
+address $320
+byte 4 1
+address cg_drawAttackerAlpha
+address $383
+address $287
+byte 4 1
+address cg_drawAttackerFade
+address $384
+address $201
+byte 4 1
+address cg_drawAttackerFadeTime
+address $385
+address $381
+byte 4 1
+address cg_drawAttackerWideScreen
+address $386
+address $300
+byte 4 1
+address cg_drawCrosshair
+address $387
+address $357
+byte 4 1
+address cg_drawCrosshairNames
+address $388
+address $201
+byte 4 1
+address cg_drawCrosshairNamesX
+address $389
+address $339
+byte 4 1
+address cg_drawCrosshairNamesY
+address $390
+address $391
+byte 4 1
+address cg_drawCrosshairNamesAlign
+address $392
+address $201
+byte 4 1
+address cg_drawCrosshairNamesStyle
+address $393
+address $300
+byte 4 1
+address cg_drawCrosshairNamesFont
+address $394
+address $211
+byte 4 1
+address cg_drawCrosshairNamesPointSize
+address $395
+address $285
+byte 4 1
+address cg_drawCrosshairNamesScale
+address $396
+address $220
+byte 4 1
+address cg_drawCrosshairNamesTime
+address $397
+address $239
+byte 4 1
+address cg_drawCrosshairNamesColor
+address $398
+address $320
+byte 4 1
+address cg_drawCrosshairNamesAlpha
+address $399
+address $400
+byte 4 1
+address cg_drawCrosshairNamesFade
+address $401
+address $201
+byte 4 1
+address cg_drawCrosshairNamesFadeTime
+address $402
+address $239
+byte 4 1
+address cg_drawCrosshairNamesWideScreen
+address $403
+address $291
+byte 4 1
+address cg_drawCrosshairTeammateHealth
+address $404
+address $201
+byte 4 1
+address cg_drawCrosshairTeammateHealthX
+address $405
+address $339
+byte 4 1
+address cg_drawCrosshairTeammateHealthY
+address $406
+address $407
+byte 4 1
+address cg_drawCrosshairTeammateHealthAlign
+address $408
+address $201
+byte 4 1
+address cg_drawCrosshairTeammateHealthStyle
+address $409
+address $300
+byte 4 1
+address cg_drawCrosshairTeammateHealthFont
+address $410
+address $211
+byte 4 1
+address cg_drawCrosshairTeammateHealthPointSize
+address $411
+address $285
+byte 4 1
+address cg_drawCrosshairTeammateHealthScale
+address $412
+address $413
+byte 4 1
+address cg_drawCrosshairTeammateHealthTime
+address $414
+address $239
+byte 4 1
+address cg_drawCrosshairTeammateHealthColor
+address $415
+address $211
+byte 4 1
+address cg_drawCrosshairTeammateHealthAlpha
+address $416
+address $400
+byte 4 1
+address cg_drawCrosshairTeammateHealthFade
+address $417
+address $201
+byte 4 1
+address cg_drawCrosshairTeammateHealthFadeTime
+address $418
+address $239
+byte 4 1
+address cg_drawCrosshairTeammateHealthWideScreen
+address $419
+address $291
+byte 4 1
+address cg_drawRewards
+address $420
+address $201
+byte 4 1
+address cg_drawRewardsMax
+address $421
+address $223
+byte 4 1
+address cg_drawRewardsX
+address $422
+address $339
+byte 4 1
+address cg_drawRewardsY
+address $423
+address $424
+byte 4 1
+address cg_drawRewardsAlign
+address $425
+address $201
+byte 4 1
+address cg_drawRewardsStyle
+address $426
+address $300
+byte 4 1
+address cg_drawRewardsFont
+address $427
+address $211
+byte 4 1
+address cg_drawRewardsPointSize
+address $428
+address $285
+byte 4 1
+address cg_drawRewardsScale
+address $429
+address $318
+byte 4 1
+address cg_drawRewardsImageScale
+address $430
+address $233
+byte 4 1
+address cg_drawRewardsTime
+address $431
+address $432
+byte 4 1
+address cg_drawRewardsColor
+address $433
+address $320
+byte 4 1
+address cg_drawRewardsAlpha
+address $434
+address $287
+byte 4 1
+address cg_drawRewardsFade
+address $435
+address $201
+byte 4 1
+address cg_drawRewardsFadeTime
+address $436
+address $407
+byte 4 1
+address cg_drawRewardsWideScreen
+address $437
+address $291
+byte 4 1
+address cg_rewardsStack
+address $438
+address $201
+byte 4 1
+address cg_crosshairSize
+address $439
+address $440
+byte 4 1
+address cg_crosshairColor
+address $441
+address $320
+byte 4 1
+address cg_crosshairPulse
+address $442
+address $198
+byte 4 1
+address cg_crosshairHealth
+address $443
+address $198
+byte 4 1
+address cg_crosshairHitStyle
+address $444
+address $198
+byte 4 1
+address cg_crosshairHitColor
+address $445
+address $446
+byte 4 1
+address cg_crosshairHitTime
+address $447
+address $407
+byte 4 1
+address cg_crosshairX
+address $448
+address $198
+byte 4 1
+address cg_crosshairY
+address $449
+address $198
+byte 4 1
+address cg_crosshairBrightness
+address $450
+address $233
+byte 4 1
+address cg_crosshairAlpha
+address $451
+address $287
+byte 4 1
+address cg_crosshairAlphaAdjust
+address $452
+address $198
+byte 4 1
+address cg_brassTime
+address $453
+address $454
+byte 4 1
+address cg_simpleItems
+address $455
+address $198
+byte 4 1
+address cg_simpleItemsScale
+address $456
+address $233
+byte 4 1
+address cg_simpleItemsBob
+address $457
+address $198
+byte 4 1
+address cg_simpleItemsHeightOffset
+address $458
+address $198
+byte 4 1
+address cg_itemsWh
+address $459
+address $198
+byte 4 1
+address cg_itemFx
+address $460
+address $461
+byte 4 1
+address cg_itemSize
+address $462
+address $233
+byte 4 1
+address cg_marks
+address $463
+address $201
+byte 4 1
+address cg_markTime
+address $464
+address $381
+byte 4 1
+address cg_markFadeTime
+address $465
+address $239
+byte 4 1
+address cg_debugImpactOrigin
+address $466
+address $198
+byte 4 1
+address cg_lagometer
+address $467
+address $201
+byte 4 1
+address cg_lagometerX
+address $468
+address $372
+byte 4 1
+address cg_lagometerY
+address $469
+address $470
+byte 4 1
+address cg_lagometerFlash
+address $471
+address $201
+byte 4 1
+address cg_lagometerFlashValue
+address $472
+address $473
+byte 4 1
+address cg_lagometerFontAlign
+address $474
+address $198
+byte 4 1
+address cg_lagometerAlign
+address $475
+address $291
+byte 4 1
+address cg_lagometerFontStyle
+address $476
+address $300
+byte 4 1
+address cg_lagometerFont
+address $477
+address $329
+byte 4 1
+address cg_lagometerFontPointSize
+address $478
+address $285
+byte 4 1
+address cg_lagometerFontScale
+address $479
+address $318
+byte 4 1
+address cg_lagometerScale
+address $480
+address $233
+byte 4 1
+address cg_lagometerFontColor
+address $481
+address $320
+byte 4 1
+address cg_lagometerAlpha
+address $482
+address $287
+byte 4 1
+address cg_lagometerFontAlpha
+address $483
+address $287
+byte 4 1
+address cg_lagometerAveragePing
+address $484
+address $201
+byte 4 1
+address cg_lagometerSnapshotPing
+address $485
+address $201
+byte 4 1
+address cg_lagometerWideScreen
+address $486
+address $300
+byte 4 1
+address cg_railTrailTime
+address $487
+address $488
+byte 4 1
+address cg_railQL
+address $489
+address $201
+byte 4 1
+address cg_railQLRailRingWhiteValue
+address $490
+address $491
+byte 4 1
+address cg_railNudge
+address $492
+address $201
+byte 4 1
+address cg_railRings
+address $493
+address $198
+byte 4 1
+address cg_railRadius
+address $494
+address $495
+byte 4 1
+address cg_railRotation
+address $496
+address $201
+byte 4 1
+address cg_railSpacing
+address $497
+address $357
+byte 4 1
+address cg_railItemColor
+address $498
+address $499
+byte 4 1
+address cg_railUseOwnColors
+address $500
+address $198
+byte 4 1
+address cg_railFromMuzzle
+address $501
+address $201
+byte 4 1
+address cg_gun_x
+address $502
+address $198
+byte 4 1
+address cg_gun_y
+address $503
+address $198
+byte 4 1
+address cg_gun_z
+address $504
+address $198
+byte 4 1
+address cg_gunSize
+address $505
+address $233
+byte 4 1
+address cg_gunSizeThirdPerson
+address $506
+address $233
+byte 4 1
+address cg_bobup
+address $507
+address $198
+byte 4 1
+address cg_bobpitch
+address $508
+address $198
+byte 4 1
+address cg_bobroll
+address $509
+address $198
+byte 4 1
+address cg_swingSpeed
+address $510
+address $511
+byte 4 512
+address cg_animSpeed
+address $512
+address $201
+byte 4 512
+address cg_debugAnim
+address $513
+address $198
+byte 4 512
+address cg_debugPosition
+address $514
+address $198
+byte 4 512
+address cg_debugEvents
+address $515
+address $198
+byte 4 512
+address cg_debugServerCommands
+address $516
+address $198
+byte 4 1
+address cg_errorDecay
+address $517
+address $218
+byte 4 0
+address cg_nopredict
+address $518
+address $198
+byte 4 0
+address cg_noPlayerAnims
+address $519
+address $198
+byte 4 512
+address cg_showmiss
+address $520
+address $198
+byte 4 0
+address cg_footsteps
+address $521
+address $201
+byte 4 512
+address cg_tracerChance
+address $522
+address $220
+byte 4 1
+address cg_tracerWidth
+address $523
+address $201
+byte 4 1
+address cg_tracerLength
+address $524
+address $218
+byte 4 1
+address cg_thirdPersonRange
+address $525
+address $526
+byte 4 512
+address cg_thirdPersonAngle
+address $527
+address $198
+byte 4 512
+address cg_thirdPerson
+address $528
+address $198
+byte 4 0
+address cg_teamChatTime
+address $529
+address $432
+byte 4 1
+address cg_teamChatHeight
+address $530
+address $198
+byte 4 1
+address cg_forceModel
+address $531
+address $198
+byte 4 1
+address cg_forcePovModel
+address $532
+address $198
+byte 4 1
+address cg_forcePovModelIgnoreFreecamTeamSettings
+address $533
+address $198
+byte 4 1
+address cg_predictItems
+address $534
+address $201
+byte 4 1
+address cg_deferPlayers
+address $535
+address $198
+byte 4 1
+address cg_drawTeamOverlay
+address $536
+address $201
+byte 4 1
+address cg_drawTeamOverlayX
+address $537
+address $372
+byte 4 1
+address cg_drawTeamOverlayY
+address $538
+address $211
+byte 4 1
+address cg_teamOverlayUserinfo
+address $539
+address $201
+byte 4 66
+address cg_drawTeamOverlayFont
+address $540
+address $315
+byte 4 1
+address cg_drawTeamOverlayPointSize
+address $541
+address $285
+byte 4 1
+address cg_drawTeamOverlayAlign
+address $542
+address $291
+byte 4 1
+address cg_drawTeamOverlayScale
+address $543
+address $544
+byte 4 1
+address cg_drawTeamOverlayWideScreen
+address $545
+address $300
+byte 4 1
+address cg_drawTeamOverlayLineOffset
+address $546
+address $220
+byte 4 1
+address cg_drawTeamOverlayMaxPlayers
+address $547
+address $548
+byte 4 1
+address cg_selfOnTeamOverlay
+address $549
+address $198
+byte 4 1
+address cg_drawJumpSpeeds
+address $550
+address $198
+byte 4 1
+address cg_drawJumpSpeedsNoText
+address $551
+address $198
+byte 4 1
+address cg_drawJumpSpeedsMax
+address $552
+address $553
+byte 4 1
+address cg_drawJumpSpeedsX
+address $554
+address $357
+byte 4 1
+address cg_drawJumpSpeedsY
+address $555
+address $556
+byte 4 1
+address cg_drawJumpSpeedsAlign
+address $557
+address $198
+byte 4 1
+address cg_drawJumpSpeedsStyle
+address $558
+address $198
+byte 4 1
+address cg_drawJumpSpeedsFont
+address $559
+address $329
+byte 4 1
+address cg_drawJumpSpeedsPointSize
+address $560
+address $285
+byte 4 1
+address cg_drawJumpSpeedsScale
+address $561
+address $318
+byte 4 1
+address cg_drawJumpSpeedsColor
+address $562
+address $563
+byte 4 1
+address cg_drawJumpSpeedsAlpha
+address $564
+address $287
+byte 4 1
+address cg_drawJumpSpeedsWideScreen
+address $565
+address $201
+byte 4 1
+address cg_drawJumpSpeedsTime
+address $566
+address $198
+byte 4 1
+address cg_drawJumpSpeedsTimeNoText
+address $567
+address $198
+byte 4 1
+address cg_drawJumpSpeedsTimeX
+address $568
+address $357
+byte 4 1
+address cg_drawJumpSpeedsTimeY
+address $569
+address $339
+byte 4 1
+address cg_drawJumpSpeedsTimeAlign
+address $570
+address $198
+byte 4 1
+address cg_drawJumpSpeedsTimeStyle
+address $571
+address $198
+byte 4 1
+address cg_drawJumpSpeedsTimeFont
+address $572
+address $329
+byte 4 1
+address cg_drawJumpSpeedsTimePointSize
+address $573
+address $285
+byte 4 1
+address cg_drawJumpSpeedsTimeScale
+address $574
+address $318
+byte 4 1
+address cg_drawJumpSpeedsTimeColor
+address $575
+address $320
+byte 4 1
+address cg_drawJumpSpeedsTimeAlpha
+address $576
+address $287
+byte 4 1
+address cg_drawJumpSpeedsTimeWideScreen
+address $577
+address $201
+byte 4 1
+address cg_drawRaceTime
+address $578
+address $201
+byte 4 1
+address cg_drawRaceTimeNoText
+address $579
+address $198
+byte 4 1
+address cg_drawRaceTimeX
+address $580
+address $357
+byte 4 1
+address cg_drawRaceTimeY
+address $581
+address $582
+byte 4 1
+address cg_drawRaceTimeAlign
+address $583
+address $198
+byte 4 1
+address cg_drawRaceTimeStyle
+address $584
+address $198
+byte 4 1
+address cg_drawRaceTimeFont
+address $585
+address $329
+byte 4 1
+address cg_drawRaceTimePointSize
+address $586
+address $285
+byte 4 1
+address cg_drawRaceTimeScale
+address $587
+address $318
+byte 4 1
+address cg_drawRaceTimeColor
+address $588
+address $589
+byte 4 1
+address cg_drawRaceTimeAlpha
+address $590
+address $287
+byte 4 1
+address cg_drawRaceTimeWideScreen
+address $591
+address $201
+byte 4 1
+address cg_stats
+address $592
+address $198
+byte 4 0
+address cg_drawFriend
+address $593
+address $300
+byte 4 1
+address cg_drawFriendStyle
+address $594
+address $201
+byte 4 1
+address cg_drawFriendMinWidth
+address $595
+address $596
+byte 4 1
+address cg_drawFriendMaxWidth
+address $597
+address $598
+byte 4 1
+address cg_drawFoe
+address $599
+address $198
+byte 4 1
+address cg_drawFoeMinWidth
+address $600
+address $596
+byte 4 1
+address cg_drawFoeMaxWidth
+address $601
+address $598
+byte 4 1
+address cg_drawSelf
+address $602
+address $291
+byte 4 1
+address cg_drawSelfMinWidth
+address $603
+address $596
+byte 4 1
+address cg_drawSelfMaxWidth
+address $604
+address $598
+byte 4 1
+address cg_drawSelfIconStyle
+address $605
+address $201
+byte 4 1
+address cg_drawInfected
+address $606
+address $198
+byte 4 1
+address cg_drawFlagCarrier
+address $607
+address $201
+byte 4 1
+address cg_drawFlagCarrierSize
+address $608
+address $223
+byte 4 1
+address cg_drawHitFlagCarrierTime
+address $609
+address $610
+byte 4 1
+address cg_teamChatsOnly
+address $611
+address $198
+byte 4 1
+address cg_buildScript
+address $612
+address $198
+byte 4 0
+address cg_paused
+address $613
+address $198
+byte 4 64
+address cg_blood
+address $614
+address $201
+byte 4 1
+address cg_bleedTime
+address $615
+address $616
+byte 4 1
+address cg_synchronousClients
+address $617
+address $198
+byte 4 8
+address cg_redTeamName
+address $618
+address $619
+byte 4 7
+address cg_blueTeamName
+address $620
+address $621
+byte 4 7
+address cg_currentSelectedPlayer
+address $622
+address $198
+byte 4 1
+address cg_currentSelectedPlayerName
+address $623
+address $211
+byte 4 1
+address cg_singlePlayer
+address $624
+address $198
+byte 4 2
+address cg_serverEnableDust
+address $625
+address $198
+byte 4 4
+address cg_serverEnableBreath
+address $626
+address $198
+byte 4 4
+address cg_singlePlayerActive
+address $624
+address $198
+byte 4 2
+address cg_recordSPDemo
+address $627
+address $198
+byte 4 1
+address cg_recordSPDemoName
+address $628
+address $211
+byte 4 1
+address cg_obeliskRespawnDelay
+address $629
+address $223
+byte 4 4
+address cg_hudFiles
+address $630
+address $631
+byte 4 1
+address cg_cameraOrbit
+address $632
+address $198
+byte 4 1
+address cg_cameraOrbitDelay
+address $633
+address $241
+byte 4 1
+address cg_timescaleFadeEnd
+address $634
+address $201
+byte 4 0
+address cg_timescaleFadeSpeed
+address $635
+address $198
+byte 4 0
+address cg_timescale
+address $636
+address $201
+byte 4 0
+address cg_scorePlums
+address $637
+address $201
+byte 4 3
+address cg_damagePlum
+address $638
+address $639
+byte 4 1
+address cg_damagePlumColorStyle
+address $640
+address $201
+byte 4 1
+address cg_damagePlumTarget
+address $641
+address $201
+byte 4 1
+address cg_damagePlumTime
+address $642
+address $239
+byte 4 1
+address cg_damagePlumBounce
+address $643
+address $644
+byte 4 1
+address cg_damagePlumGravity
+address $645
+address $231
+byte 4 1
+address cg_damagePlumRandomVelocity
+address $646
+address $647
+byte 4 1
+address cg_damagePlumFont
+address $648
+address $211
+byte 4 1
+address cg_damagePlumFontStyle
+address $649
+address $198
+byte 4 1
+address cg_damagePlumPointSize
+address $650
+address $285
+byte 4 1
+address cg_damagePlumScale
+address $651
+address $233
+byte 4 1
+address cg_damagePlumColor
+address $652
+address $211
+byte 4 1
+address cg_damagePlumAlpha
+address $653
+address $287
+byte 4 1
+address cg_smoothClients
+address $654
+address $198
+byte 4 3
+address cg_cameraMode
+address $655
+address $198
+byte 4 512
+address pmove_fixed
+address $656
+address $198
+byte 4 8
+address pmove_msec
+address $657
+address $260
+byte 4 8
+address cg_smokeRadius_SG
+address $658
+address $440
+byte 4 1
+address cg_smokeRadius_GL
+address $659
+address $440
+byte 4 1
+address cg_smokeRadius_NG
+address $660
+address $661
+byte 4 1
+address cg_smokeRadius_RL
+address $662
+address $341
+byte 4 1
+address cg_smokeRadius_PL
+address $663
+address $440
+byte 4 1
+address cg_smokeRadius_breath
+address $664
+address $661
+byte 4 1
+address cg_enableBreath
+address $665
+address $201
+byte 4 1
+address cg_smokeRadius_dust
+address $666
+address $285
+byte 4 1
+address cg_enableDust
+address $667
+address $201
+byte 4 1
+address cg_smokeRadius_flight
+address $668
+address $260
+byte 4 1
+address cg_smokeRadius_haste
+address $669
+address $260
+byte 4 1
+address cg_smallFont
+address $670
+address $318
+byte 4 1
+address cg_bigFont
+address $671
+address $220
+byte 4 1
+address cg_noTaunt
+address $672
+address $198
+byte 4 1
+address cg_noProjectileTrail
+address $673
+address $198
+byte 4 1
+address cg_oldRocket
+address $674
+address $201
+byte 4 1
+address cg_plasmaStyle
+address $675
+address $201
+byte 4 1
+address cg_trueLightning
+address $676
+address $233
+byte 4 1
+address cg_drawSpeed
+address $677
+address $201
+byte 4 1
+address cg_drawSpeedX
+address $678
+address $278
+byte 4 1
+address cg_drawSpeedY
+address $679
+address $211
+byte 4 1
+address cg_drawSpeedNoText
+address $680
+address $198
+byte 4 1
+address cg_drawSpeedAlign
+address $681
+address $291
+byte 4 1
+address cg_drawSpeedStyle
+address $682
+address $300
+byte 4 1
+address cg_drawSpeedFont
+address $683
+address $315
+byte 4 1
+address cg_drawSpeedPointSize
+address $684
+address $285
+byte 4 1
+address cg_drawSpeedScale
+address $685
+address $318
+byte 4 1
+address cg_drawSpeedColor
+address $686
+address $320
+byte 4 1
+address cg_drawSpeedAlpha
+address $687
+address $287
+byte 4 1
+address cg_drawSpeedWideScreen
+address $688
+address $300
+byte 4 1
+address cg_drawSpeedChangeColor
+address $689
+address $201
+byte 4 1
+address cg_drawOrigin
+address $690
+address $198
+byte 4 1
+address cg_drawOriginX
+address $691
+address $357
+byte 4 1
+address cg_drawOriginY
+address $692
+address $582
+byte 4 1
+address cg_drawOriginAlign
+address $693
+address $198
+byte 4 1
+address cg_drawOriginStyle
+address $694
+address $198
+byte 4 1
+address cg_drawOriginFont
+address $695
+address $329
+byte 4 1
+address cg_drawOriginPointSize
+address $696
+address $285
+byte 4 1
+address cg_drawOriginScale
+address $697
+address $318
+byte 4 1
+address cg_drawOriginColor
+address $698
+address $320
+byte 4 1
+address cg_drawOriginAlpha
+address $699
+address $287
+byte 4 1
+address cg_drawOriginWideScreen
+address $700
+address $201
+byte 4 1
+address cg_drawScores
+address $701
+address $201
+byte 4 1
+address cg_drawPlayersLeft
+address $702
+address $201
+byte 4 1
+address cg_drawPowerups
+address $703
+address $201
+byte 4 1
+address cg_drawPowerupRespawn
+address $704
+address $201
+byte 4 1
+address cg_drawPowerupRespawnScale
+address $705
+address $233
+byte 4 1
+address cg_drawPowerupRespawnOffset
+address $706
+address $707
+byte 4 1
+address cg_drawPowerupRespawnAlpha
+address $708
+address $287
+byte 4 1
+address cg_drawPowerupAvailable
+address $709
+address $201
+byte 4 1
+address cg_drawPowerupAvailableScale
+address $710
+address $233
+byte 4 1
+address cg_drawPowerupAvailableOffset
+address $711
+address $707
+byte 4 1
+address cg_drawPowerupAvailableAlpha
+address $712
+address $287
+byte 4 1
+address cg_drawPowerupAvailableFadeStart
+address $713
+address $714
+byte 4 1
+address cg_drawPowerupAvailableFadeEnd
+address $715
+address $716
+byte 4 1
+address cg_drawItemPickups
+address $717
+address $300
+byte 4 1
+address cg_drawItemPickupsX
+address $718
+address $260
+byte 4 1
+address cg_drawItemPickupsY
+address $719
+address $720
+byte 4 1
+address cg_drawItemPickupsImageScale
+address $721
+address $722
+byte 4 1
+address cg_drawItemPickupsAlign
+address $723
+address $198
+byte 4 1
+address cg_drawItemPickupsStyle
+address $724
+address $198
+byte 4 1
+address cg_drawItemPickupsFont
+address $725
+address $315
+byte 4 1
+address cg_drawItemPickupsPointSize
+address $726
+address $285
+byte 4 1
+address cg_drawItemPickupsScale
+address $727
+address $318
+byte 4 1
+address cg_drawItemPickupsTime
+address $728
+address $432
+byte 4 1
+address cg_drawItemPickupsColor
+address $729
+address $320
+byte 4 1
+address cg_drawItemPickupsAlpha
+address $730
+address $287
+byte 4 1
+address cg_drawItemPickupsFade
+address $731
+address $201
+byte 4 1
+address cg_drawItemPickupsFadeTime
+address $732
+address $432
+byte 4 1
+address cg_drawItemPickupsCount
+address $733
+address $201
+byte 4 1
+address cg_drawItemPickupsWideScreen
+address $734
+address $201
+byte 4 1
+address cg_drawFollowing
+address $735
+address $201
+byte 4 1
+address cg_drawFollowingX
+address $736
+address $339
+byte 4 1
+address cg_drawFollowingY
+address $737
+address $241
+byte 4 1
+address cg_drawFollowingAlign
+address $738
+address $201
+byte 4 1
+address cg_drawFollowingStyle
+address $739
+address $289
+byte 4 1
+address cg_drawFollowingFont
+address $740
+address $315
+byte 4 1
+address cg_drawFollowingPointSize
+address $741
+address $285
+byte 4 1
+address cg_drawFollowingScale
+address $742
+address $220
+byte 4 1
+address cg_drawFollowingColor
+address $743
+address $320
+byte 4 1
+address cg_drawFollowingAlpha
+address $744
+address $287
+byte 4 1
+address cg_drawFollowingWideScreen
+address $745
+address $291
+byte 4 1
+address cg_drawCpmaMvdIndicator
+address $746
+address $201
+byte 4 1
+address cg_drawCpmaMvdIndicatorX
+address $747
+address $339
+byte 4 1
+address cg_drawCpmaMvdIndicatorY
+address $748
+address $473
+byte 4 1
+address cg_drawCpmaMvdIndicatorAlign
+address $749
+address $201
+byte 4 1
+address cg_drawCpmaMvdIndicatorStyle
+address $750
+address $289
+byte 4 1
+address cg_drawCpmaMvdIndicatorFont
+address $751
+address $315
+byte 4 1
+address cg_drawCpmaMvdIndicatorPointSize
+address $752
+address $285
+byte 4 1
+address cg_drawCpmaMvdIndicatorScale
+address $753
+address $220
+byte 4 1
+address cg_drawCpmaMvdIndicatorColor
+address $754
+address $755
+byte 4 1
+address cg_drawCpmaMvdIndicatorAlpha
+address $756
+address $287
+byte 4 1
+address cg_drawCpmaMvdIndicatorWideScreen
+address $757
+address $291
+byte 4 1
+address cg_testQlFont
+address $758
+address $198
+byte 4 1
+address cg_qlhud
+address $759
+address $201
+byte 4 1
+address cg_qlFontScaling
+address $760
+address $201
+byte 4 1
+address cg_autoFontScaling
+address $761
+address $201
+byte 4 1
+address cg_autoFontScalingThreshold
+address $762
+address $763
+byte 4 1
+address cg_weaponBar
+address $764
+address $201
+byte 4 1
+address cg_weaponBarX
+address $765
+address $211
+byte 4 1
+address cg_weaponBarY
+address $766
+address $211
+byte 4 1
+address cg_weaponBarFont
+address $767
+address $211
+byte 4 1
+address cg_weaponBarPointSize
+address $768
+address $285
+byte 4 1
+address cg_weaponBarWideScreen
+address $769
+address $201
+byte 4 1
+address cg_drawFullWeaponBar
+address $770
+address $201
+byte 4 1
+address cg_scoreBoardStyle
+address $771
+address $201
+byte 4 1
+address cg_scoreBoardSpectatorScroll
+address $772
+address $198
+byte 4 1
+address cg_scoreBoardWhenDead
+address $773
+address $201
+byte 4 1
+address cg_scoreBoardAtIntermission
+address $774
+address $201
+byte 4 1
+address cg_scoreBoardWarmup
+address $775
+address $201
+byte 4 1
+address cg_scoreBoardOld
+address $776
+address $198
+byte 4 1
+address cg_scoreBoardOld
+address $776
+address $291
+byte 4 1
+address cg_scoreBoardForceLineHeight
+address $777
+address $548
+byte 4 1
+address cg_scoreBoardForceLineHeightDefault
+address $778
+address $763
+byte 4 1
+address cg_scoreBoardForceLineHeightTeam
+address $779
+address $548
+byte 4 1
+address cg_scoreBoardForceLineHeightTeamDefault
+address $780
+address $260
+byte 4 1
+address cg_hitBeep
+address $781
+address $291
+byte 4 1
+address cg_drawSpawns
+address $782
+address $198
+byte 4 1
+address cg_drawSpawnsInitial
+address $783
+address $201
+byte 4 1
+address cg_drawSpawnsInitialZ
+address $784
+address $785
+byte 4 1
+address cg_drawSpawnsRespawns
+address $786
+address $201
+byte 4 1
+address cg_drawSpawnsRespawnsZ
+address $787
+address $785
+byte 4 1
+address cg_drawSpawnsShared
+address $788
+address $201
+byte 4 1
+address cg_drawSpawnsSharedZ
+address $789
+address $785
+byte 4 1
+address cg_freecam_noclip
+address $790
+address $198
+byte 4 1
+address cg_freecam_sensitivity
+address $791
+address $792
+byte 4 1
+address cg_freecam_yaw
+address $793
+address $233
+byte 4 1
+address cg_freecam_pitch
+address $794
+address $233
+byte 4 1
+address cg_freecam_speed
+address $795
+address $488
+byte 4 1
+address cg_freecam_crosshair
+address $796
+address $201
+byte 4 1
+address cg_freecam_useTeamSettings
+address $797
+address $291
+byte 4 1
+address cg_freecam_rollValue
+address $798
+address $722
+byte 4 1
+address cg_freecam_useServerView
+address $799
+address $201
+byte 4 1
+address cg_freecam_unlockPitch
+address $800
+address $201
+byte 4 1
+address cg_chatTime
+address $801
+address $802
+byte 4 1
+address cg_chatLines
+address $803
+address $223
+byte 4 1
+address cg_chatHistoryLength
+address $804
+address $225
+byte 4 1
+address cg_chatBeep
+address $805
+address $201
+byte 4 1
+address cg_chatBeepMaxTime
+address $806
+address $198
+byte 4 1
+address cg_teamChatBeep
+address $807
+address $201
+byte 4 1
+address cg_teamChatBeepMaxTime
+address $808
+address $198
+byte 4 1
+address cg_serverPrint
+address $809
+address $198
+byte 4 1
+address cg_serverPrintToChat
+address $810
+address $201
+byte 4 1
+address cg_serverPrintToConsole
+address $811
+address $201
+byte 4 1
+address cg_serverCenterPrint
+address $812
+address $201
+byte 4 1
+address cg_serverCenterPrintToChat
+address $813
+address $198
+byte 4 1
+address cg_serverCenterPrintToConsole
+address $814
+address $201
+byte 4 1
+address cg_drawCenterPrint
+address $815
+address $201
+byte 4 1
+address cg_drawCenterPrintX
+address $816
+address $339
+byte 4 1
+address cg_drawCenterPrintY
+address $817
+address $211
+byte 4 1
+address cg_drawCenterPrintAlign
+address $818
+address $201
+byte 4 1
+address cg_drawCenterPrintStyle
+address $819
+address $289
+byte 4 1
+address cg_drawCenterPrintFont
+address $820
+address $211
+byte 4 1
+address cg_drawCenterPrintPointSize
+address $821
+address $285
+byte 4 1
+address cg_drawCenterPrintScale
+address $822
+address $823
+byte 4 1
+address cg_drawCenterPrintTime
+address $824
+address $432
+byte 4 1
+address cg_drawCenterPrintColor
+address $825
+address $320
+byte 4 1
+address cg_drawCenterPrintAlpha
+address $826
+address $287
+byte 4 1
+address cg_drawCenterPrintFade
+address $827
+address $201
+byte 4 1
+address cg_drawCenterPrintFadeTime
+address $828
+address $407
+byte 4 1
+address cg_drawCenterPrintWideScreen
+address $829
+address $291
+byte 4 1
+address cg_drawVote
+address $830
+address $201
+byte 4 1
+address cg_drawVoteX
+address $831
+address $198
+byte 4 1
+address cg_drawVoteY
+address $832
+address $556
+byte 4 1
+address cg_drawVoteAlign
+address $833
+address $198
+byte 4 1
+address cg_drawVoteStyle
+address $834
+address $300
+byte 4 1
+address cg_drawVoteFont
+address $835
+address $211
+byte 4 1
+address cg_drawVotePointSize
+address $836
+address $285
+byte 4 1
+address cg_drawVoteScale
+address $837
+address $318
+byte 4 1
+address cg_drawVoteColor
+address $838
+address $563
+byte 4 1
+address cg_drawVoteAlpha
+address $839
+address $287
+byte 4 1
+address cg_drawVoteWideScreen
+address $840
+address $201
+byte 4 1
+address cg_drawTeamVote
+address $841
+address $201
+byte 4 1
+address cg_drawTeamVoteX
+address $842
+address $198
+byte 4 1
+address cg_drawTeamVoteY
+address $843
+address $556
+byte 4 1
+address cg_drawTeamVoteAlign
+address $844
+address $198
+byte 4 1
+address cg_drawTeamVoteStyle
+address $845
+address $300
+byte 4 1
+address cg_drawTeamVoteFont
+address $846
+address $211
+byte 4 1
+address cg_drawTeamVotePointSize
+address $847
+address $285
+byte 4 1
+address cg_drawTeamVoteScale
+address $848
+address $318
+byte 4 1
+address cg_drawTeamVoteColor
+address $849
+address $755
+byte 4 1
+address cg_drawTeamVoteAlpha
+address $850
+address $287
+byte 4 1
+address cg_drawTeamVoteWideScreen
+address $851
+address $201
+byte 4 1
+address cg_drawWaitingForPlayers
+address $852
+address $201
+byte 4 1
+address cg_drawWaitingForPlayersX
+address $853
+address $339
+byte 4 1
+address cg_drawWaitingForPlayersY
+address $854
+address $203
+byte 4 1
+address cg_drawWaitingForPlayersAlign
+address $855
+address $201
+byte 4 1
+address cg_drawWaitingForPlayersStyle
+address $856
+address $289
+byte 4 1
+address cg_drawWaitingForPlayersFont
+address $857
+address $315
+byte 4 1
+address cg_drawWaitingForPlayersPointSize
+address $858
+address $285
+byte 4 1
+address cg_drawWaitingForPlayersScale
+address $859
+address $220
+byte 4 1
+address cg_drawWaitingForPlayersColor
+address $860
+address $320
+byte 4 1
+address cg_drawWaitingForPlayersAlpha
+address $861
+address $287
+byte 4 1
+address cg_drawWaitingForPlayersWideScreen
+address $862
+address $291
+byte 4 1
+address cg_drawWarmupString
+address $863
+address $201
+byte 4 1
+address cg_drawWarmupStringX
+address $864
+address $339
+byte 4 1
+address cg_drawWarmupStringY
+address $865
+address $203
+byte 4 1
+address cg_drawWarmupStringAlign
+address $866
+address $201
+byte 4 1
+address cg_drawWarmupStringStyle
+address $867
+address $289
+byte 4 1
+address cg_drawWarmupStringFont
+address $868
+address $211
+byte 4 1
+address cg_drawWarmupStringPointSize
+address $869
+address $285
+byte 4 1
+address cg_drawWarmupStringScale
+address $870
+address $243
+byte 4 1
+address cg_drawWarmupStringColor
+address $871
+address $320
+byte 4 1
+address cg_drawWarmupStringAlpha
+address $872
+address $287
+byte 4 1
+address cg_drawWarmupStringWideScreen
+address $873
+address $291
+byte 4 1
+address cg_ambientSounds
+address $874
+address $291
+byte 4 1
+address cg_weather
+address $875
+address $201
+byte 4 1
+address wolfcam_hoverTime
+address $876
+address $877
+byte 4 1
+address wolfcam_switchMode
+address $878
+address $198
+byte 4 1
+address wolfcam_firstPersonSwitchSoundStyle
+address $879
+address $201
+byte 4 1
+address cg_interpolateMissiles
+address $880
+address $201
+byte 4 1
+address cg_wh
+address $881
+address $198
+byte 4 1
+address cg_whIncludeDeadBody
+address $882
+address $201
+byte 4 1
+address cg_whIncludeProjectile
+address $883
+address $201
+byte 4 1
+address cg_whShader
+address $884
+address $211
+byte 4 1
+address cg_playerShader
+address $885
+address $211
+byte 4 1
+address cg_whColor
+address $886
+address $320
+byte 4 1
+address cg_whAlpha
+address $887
+address $255
+byte 4 1
+address cg_whEnemyShader
+address $888
+address $211
+byte 4 1
+address cg_whEnemyColor
+address $889
+address $890
+byte 4 1
+address cg_whEnemyAlpha
+address $891
+address $255
+byte 4 1
+address wolfcam_fixedViewAngles
+address $892
+address $198
+byte 4 1
+address cg_useOriginalInterpolation
+address $893
+address $198
+byte 4 1
+address cg_drawBBox
+address $894
+address $198
+byte 4 1
+address cg_weaponRedTeamColor
+address $895
+address $896
+byte 4 1
+address cg_weaponBlueTeamColor
+address $897
+address $898
+byte 4 1
+address cg_hudRedTeamColor
+address $899
+address $896
+byte 4 1
+address cg_hudBlueTeamColor
+address $900
+address $898
+byte 4 1
+address cg_hudNoTeamColor
+address $901
+address $902
+byte 4 1
+address cg_hudForceRedTeamClanTag
+address $903
+address $211
+byte 4 1
+address cg_hudForceBlueTeamClanTag
+address $904
+address $211
+byte 4 1
+address cg_enemyModel
+address $905
+address $906
+byte 4 1
+address cg_enemyHeadModel
+address $907
+address $906
+byte 4 1
+address cg_enemyHeadSkin
+address $908
+address $211
+byte 4 1
+address cg_enemyTorsoSkin
+address $909
+address $211
+byte 4 1
+address cg_enemyLegsSkin
+address $910
+address $211
+byte 4 1
+address cg_enemyHeadColor
+address $911
+address $912
+byte 4 1
+address cg_enemyTorsoColor
+address $913
+address $912
+byte 4 1
+address cg_enemyLegsColor
+address $914
+address $912
+byte 4 1
+address cg_enemyRailColor1
+address $915
+address $211
+byte 4 1
+address cg_enemyRailColor2
+address $916
+address $211
+byte 4 1
+address cg_enemyRailColor1Team
+address $917
+address $198
+byte 4 1
+address cg_enemyRailColor2Team
+address $918
+address $198
+byte 4 1
+address cg_enemyRailRings
+address $919
+address $198
+byte 4 1
+address cg_enemyRailNudge
+address $920
+address $201
+byte 4 1
+address cg_enemyRailItemColor
+address $921
+address $211
+byte 4 1
+address cg_enemyRailItemColorTeam
+address $922
+address $198
+byte 4 1
+address cg_enemyFlagColor
+address $923
+address $924
+byte 4 1
+address cg_useDefaultTeamSkins
+address $925
+address $201
+byte 4 1
+address cg_ignoreClientHeadModel
+address $926
+address $291
+byte 4 1
+address cg_teamModel
+address $927
+address $211
+byte 4 1
+address cg_teamHeadModel
+address $928
+address $211
+byte 4 1
+address cg_teamHeadSkin
+address $929
+address $211
+byte 4 1
+address cg_teamTorsoSkin
+address $930
+address $211
+byte 4 1
+address cg_teamLegsSkin
+address $931
+address $211
+byte 4 1
+address cg_teamHeadColor
+address $932
+address $320
+byte 4 1
+address cg_teamTorsoColor
+address $933
+address $320
+byte 4 1
+address cg_teamLegsColor
+address $934
+address $320
+byte 4 1
+address cg_teamRailColor1
+address $935
+address $211
+byte 4 1
+address cg_teamRailColor2
+address $936
+address $211
+byte 4 1
+address cg_teamRailColor1Team
+address $937
+address $198
+byte 4 1
+address cg_teamRailColor2Team
+address $938
+address $198
+byte 4 1
+address cg_teamRailRings
+address $939
+address $198
+byte 4 1
+address cg_teamRailNudge
+address $940
+address $201
+byte 4 1
+address cg_teamRailItemColor
+address $941
+address $211
+byte 4 1
+address cg_teamRailItemColorTeam
+address $942
+address $198
+byte 4 1
+address cg_teamFlagColor
+address $943
+address $320
+byte 4 1
+address cg_neutralFlagColor
+address $944
+address $945
+byte 4 1
+address cg_ourModel
+address $946
+address $947
+byte 4 3
+address cg_ourHeadModel
+address $948
+address $947
+byte 4 3
+address cg_ourHeadSkin
+address $949
+address $211
+byte 4 1
+address cg_ourTorsoSkin
+address $950
+address $211
+byte 4 1
+address cg_ourLegsSkin
+address $951
+address $211
+byte 4 1
+address cg_ourHeadColor
+address $952
+address $320
+byte 4 1
+address cg_ourTorsoColor
+address $953
+address $320
+byte 4 1
+address cg_ourLegsColor
+address $954
+address $320
+byte 4 1
+address cg_deadBodyColor
+address $955
+address $956
+byte 4 1
+address cg_disallowEnemyModelForTeammates
+address $957
+address $201
+byte 4 1
+address cg_fallbackModel
+address $958
+address $959
+byte 4 1
+address cg_fallbackHeadModel
+address $960
+address $959
+byte 4 1
+address cg_audioAnnouncer
+address $961
+address $201
+byte 4 1
+address cg_audioAnnouncerRewards
+address $962
+address $201
+byte 4 1
+address cg_audioAnnouncerRewardsFirst
+address $963
+address $201
+byte 4 1
+address cg_audioAnnouncerRound
+address $964
+address $201
+byte 4 1
+address cg_audioAnnouncerRoundReward
+address $965
+address $201
+byte 4 1
+address cg_audioAnnouncerWarmup
+address $966
+address $201
+byte 4 1
+address cg_audioAnnouncerVote
+address $967
+address $201
+byte 4 1
+address cg_audioAnnouncerTeamVote
+address $968
+address $201
+byte 4 1
+address cg_audioAnnouncerFlagStatus
+address $969
+address $201
+byte 4 1
+address cg_audioAnnouncerLead
+address $970
+address $201
+byte 4 1
+address cg_audioAnnouncerTimeLimit
+address $971
+address $201
+byte 4 1
+address cg_audioAnnouncerFragLimit
+address $972
+address $201
+byte 4 1
+address cg_audioAnnouncerWin
+address $973
+address $201
+byte 4 1
+address cg_audioAnnouncerScore
+address $974
+address $201
+byte 4 1
+address cg_audioAnnouncerLastStanding
+address $975
+address $198
+byte 4 1
+address cg_audioAnnouncerDominationPoint
+address $976
+address $201
+byte 4 1
+address cg_audioAnnouncerPowerup
+address $977
+address $201
+byte 4 1
+address cg_ignoreServerPlaySound
+address $978
+address $198
+byte 4 1
+address wolfcam_drawFollowing
+address $979
+address $291
+byte 4 1
+address wolfcam_drawFollowingOnlyName
+address $980
+address $198
+byte 4 1
+address cg_printTimeStamps
+address $981
+address $201
+byte 4 1
+address cg_screenDamageAlpha_Team
+address $982
+address $407
+byte 4 1
+address cg_screenDamage_Team
+address $983
+address $984
+byte 4 1
+address cg_screenDamageAlpha_Self
+address $985
+address $198
+byte 4 1
+address cg_screenDamage_Self
+address $986
+address $987
+byte 4 1
+address cg_screenDamageAlpha
+address $988
+address $407
+byte 4 1
+address cg_screenDamage
+address $989
+address $984
+byte 4 1
+address cg_echoPopupTime
+address $990
+address $239
+byte 4 1
+address cg_echoPopupX
+address $991
+address $255
+byte 4 1
+address cg_echoPopupY
+address $992
+address $993
+byte 4 1
+address cg_echoPopupScale
+address $994
+address $511
+byte 4 1
+address cg_echoPopupWideScreen
+address $995
+address $201
+byte 4 1
+address cg_accX
+address $996
+address $997
+byte 4 1
+address cg_accY
+address $998
+address $218
+byte 4 1
+address cg_accWideScreen
+address $999
+address $300
+byte 4 1
+address cg_loadDefaultMenus
+address $1000
+address $201
+byte 4 1
+address cg_grenadeColor
+address $1001
+address $320
+byte 4 1
+address cg_grenadeColorAlpha
+address $1002
+address $287
+byte 4 1
+address cg_grenadeTeamColor
+address $1003
+address $563
+byte 4 1
+address cg_grenadeTeamColorAlpha
+address $1004
+address $287
+byte 4 1
+address cg_grenadeEnemyColor
+address $1005
+address $924
+byte 4 1
+address cg_grenadeEnemyColorAlpha
+address $1006
+address $287
+byte 4 1
+address cg_fragMessageStyle
+address $1007
+address $201
+byte 4 1
+address cg_drawFragMessageSeparate
+address $1008
+address $198
+byte 4 1
+address cg_drawFragMessageSeparate
+address $1009
+address $198
+byte 4 1
+address cg_drawFragMessageX
+address $1010
+address $339
+byte 4 1
+address cg_drawFragMessageY
+address $1011
+address $644
+byte 4 1
+address cg_drawFragMessageAlign
+address $1012
+address $201
+byte 4 1
+address cg_drawFragMessageStyle
+address $1013
+address $289
+byte 4 1
+address cg_drawFragMessageFont
+address $1014
+address $211
+byte 4 1
+address cg_drawFragMessagePointSize
+address $1015
+address $285
+byte 4 1
+address cg_drawFragMessageScale
+address $1016
+address $318
+byte 4 1
+address cg_drawFragMessageTime
+address $1017
+address $432
+byte 4 1
+address cg_drawFragMessageColor
+address $1018
+address $320
+byte 4 1
+address cg_drawFragMessageAlpha
+address $1019
+address $287
+byte 4 1
+address cg_drawFragMessageFade
+address $1020
+address $201
+byte 4 1
+address cg_drawFragMessageFadeTime
+address $1021
+address $407
+byte 4 1
+address cg_drawFragMessageTokens
+address $1022
+address $1023
+byte 4 1
+address cg_drawFragMessageTeamTokens
+address $1024
+address $1025
+byte 4 1
+address cg_drawFragMessageThawTokens
+address $1026
+address $1027
+byte 4 1
+address cg_drawFragMessageFreezeTokens
+address $1028
+address $1029
+byte 4 1
+address cg_drawFragMessageFreezeTeamTokens
+address $1030
+address $1031
+byte 4 1
+address cg_drawFragMessageIconScale
+address $1032
+address $1033
+byte 4 1
+address cg_drawFragMessageWideScreen
+address $1034
+address $291
+byte 4 1
+address cg_obituaryTokens
+address $1035
+address $1036
+byte 4 1
+address cg_obituaryIconScale
+address $1037
+address $1033
+byte 4 1
+address cg_obituaryRedTeamColor
+address $1038
+address $896
+byte 4 1
+address cg_obituaryBlueTeamColor
+address $1039
+address $898
+byte 4 1
+address cg_obituaryTime
+address $1040
+address $432
+byte 4 1
+address cg_obituaryFadeTime
+address $1041
+address $239
+byte 4 1
+address cg_obituaryStack
+address $1042
+address $357
+byte 4 1
+address cg_fragTokenAccuracyStyle
+address $1043
+address $198
+byte 4 1
+address cg_fragIconHeightFixed
+address $1044
+address $201
+byte 4 1
+address cg_drawPlayerNames
+address $1045
+address $198
+byte 4 1
+address cg_drawPlayerNamesY
+address $1046
+address $341
+byte 4 1
+address cg_drawPlayerNamesStyle
+address $1047
+address $300
+byte 4 1
+address cg_drawPlayerNamesFont
+address $1048
+address $211
+byte 4 1
+address cg_drawPlayerNamesPointSize
+address $1049
+address $661
+byte 4 1
+address cg_drawPlayerNamesScale
+address $1050
+address $318
+byte 4 1
+address cg_drawPlayerNamesColor
+address $1051
+address $211
+byte 4 1
+address cg_drawPlayerNamesAlpha
+address $1052
+address $287
+byte 4 1
+address cg_perKillStatsExcludePostKillSpam
+address $1053
+address $201
+byte 4 1
+address cg_perKillStatsClearNotFiringTime
+address $1054
+address $432
+byte 4 1
+address cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+address $1055
+address $201
+byte 4 1
+address cg_printSkillRating
+address $1056
+address $198
+byte 4 1
+address cg_lightningImpact
+address $1057
+address $201
+byte 4 1
+address cg_lightningImpactSize
+address $1058
+address $233
+byte 4 1
+address cg_lightningImpactOthersSize
+address $1059
+address $785
+byte 4 1
+address cg_lightningImpactCap
+address $1060
+address $1061
+byte 4 1
+address cg_lightningImpactCapMin
+address $1062
+address $203
+byte 4 1
+address cg_lightningImpactProject
+address $1063
+address $201
+byte 4 1
+address cg_lightningStyle
+address $1064
+address $201
+byte 4 1
+address cg_lightningRenderStyle
+address $1065
+address $201
+byte 4 1
+address cg_lightningAngleOriginStyle
+address $1066
+address $201
+byte 4 1
+address cg_debugLightningImpactDistance
+address $1067
+address $198
+byte 4 1
+address cg_lightningSize
+address $1068
+address $260
+byte 4 1
+address cg_drawEntNumbers
+address $1069
+address $198
+byte 4 1
+address cg_drawEventNumbers
+address $1070
+address $198
+byte 4 1
+address cg_demoSmoothing
+address $1071
+address $201
+byte 4 1
+address cg_demoSmoothingAngles
+address $1072
+address $201
+byte 4 1
+address cg_demoSmoothingTeleportCheck
+address $1073
+address $201
+byte 4 1
+address cg_drawCameraPath
+address $1074
+address $201
+byte 4 1
+address cg_drawCameraPointInfo
+address $1075
+address $201
+byte 4 1
+address cg_drawCameraPointInfoX
+address $1076
+address $203
+byte 4 1
+address cg_drawCameraPointInfoY
+address $1077
+address $203
+byte 4 1
+address cg_drawCameraPointInfoAlign
+address $1078
+address $198
+byte 4 1
+address cg_drawCameraPointInfoStyle
+address $1079
+address $198
+byte 4 1
+address cg_drawCameraPointInfoFont
+address $1080
+address $211
+byte 4 1
+address cg_drawCameraPointInfoPointSize
+address $1081
+address $285
+byte 4 1
+address cg_drawCameraPointInfoScale
+address $1082
+address $318
+byte 4 1
+address cg_drawCameraPointInfoColor
+address $1083
+address $320
+byte 4 1
+address cg_drawCameraPointInfoSelectedColor
+address $1084
+address $1085
+byte 4 1
+address cg_drawCameraPointInfoAlpha
+address $1086
+address $287
+byte 4 1
+address cg_drawCameraPointInfoWideScreen
+address $1087
+address $201
+byte 4 1
+address cg_drawCameraPointInfoBackgroundColor
+address $1088
+address $987
+byte 4 1
+address cg_drawCameraPointInfoBackgroundAlpha
+address $1089
+address $198
+byte 4 1
+address cg_drawViewPointMark
+address $1090
+address $198
+byte 4 1
+address cg_levelTimerDirection
+address $1091
+address $198
+byte 4 1
+address cg_levelTimerDefaultTimeLimit
+address $1092
+address $203
+byte 4 1
+address cg_levelTimerOvertimeReset
+address $1093
+address $198
+byte 4 1
+address cg_checkForOfflineDemo
+address $1094
+address $201
+byte 4 1
+address cg_muzzleFlash
+address $1095
+address $201
+byte 4 1
+address cg_weaponDefault
+address $1096
+address $211
+byte 4 1
+address cg_weaponNone
+address $1097
+address $211
+byte 4 1
+address cg_weaponGauntlet
+address $1098
+address $211
+byte 4 1
+address cg_weaponShotgun
+address $1099
+address $211
+byte 4 1
+address cg_weaponMachineGun
+address $1100
+address $211
+byte 4 1
+address cg_weaponShotgun
+address $1099
+address $211
+byte 4 1
+address cg_weaponGrenadeLauncher
+address $1101
+address $211
+byte 4 1
+address cg_weaponRocketLauncher
+address $1102
+address $211
+byte 4 1
+address cg_weaponLightningGun
+address $1103
+address $211
+byte 4 1
+address cg_weaponRailGun
+address $1104
+address $211
+byte 4 1
+address cg_weaponPlasmaGun
+address $1105
+address $211
+byte 4 1
+address cg_weaponBFG
+address $1106
+address $211
+byte 4 1
+address cg_weaponGrapplingHook
+address $1107
+address $211
+byte 4 1
+address cg_weaponNailGun
+address $1108
+address $211
+byte 4 1
+address cg_weaponProximityLauncher
+address $1109
+address $211
+byte 4 1
+address cg_weaponChainGun
+address $1110
+address $211
+byte 4 1
+address cg_weaponHeavyMachineGun
+address $1111
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponGauntlet
+address $1112
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponMachineGun
+address $1113
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponShotgun
+address $1114
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponGrenadeLauncher
+address $1115
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponRocketLauncher
+address $1116
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponLightningGun
+address $1117
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponRailGun
+address $1118
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponPlasmaGun
+address $1119
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponBFG
+address $1120
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponGrapplingHook
+address $1121
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponNailGun
+address $1122
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponProximityLauncher
+address $1123
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponChainGun
+address $1124
+address $211
+byte 4 1
+address cg_firstPersonShaderWeaponHeavyMachineGun
+address $1125
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponGauntlet
+address $1126
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponMachineGun
+address $1127
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponShotgun
+address $1128
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponGrenadeLauncher
+address $1129
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponRocketLauncher
+address $1130
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponLightningGun
+address $1131
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponRailGun
+address $1132
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponPlasmaGun
+address $1133
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponBFG
+address $1134
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponGrapplingHook
+address $1135
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponNailGun
+address $1136
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponProximityLauncher
+address $1137
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponChainGun
+address $1138
+address $211
+byte 4 1
+address cg_thirdPersonShaderWeaponHeavyMachineGun
+address $1139
+address $211
+byte 4 1
+address cg_spawnArmorTime
+address $1140
+address $616
+byte 4 1
+address cg_fxfile
+address $1141
+address $211
+byte 4 1
+address cg_fxinterval
+address $1142
+address $1143
+byte 4 1
+address cg_fxratio
+address $1144
+address $1145
+byte 4 1
+address cg_fxScriptMinEmitter
+address $1146
+address $785
+byte 4 1
+address cg_fxScriptMinDistance
+address $1147
+address $1148
+byte 4 1
+address cg_fxScriptMinInterval
+address $1149
+address $1148
+byte 4 1
+address cg_fxLightningGunImpactFps
+address $1150
+address $251
+byte 4 1
+address cg_fxDebugEntities
+address $1151
+address $198
+byte 4 1
+address cg_fxCompiled
+address $1152
+address $201
+byte 4 1
+address cg_vibrate
+address $1153
+address $198
+byte 4 1
+address cg_vibrateTime
+address $1154
+address $1155
+byte 4 1
+address cg_vibrateMaxDistance
+address $1156
+address $245
+byte 4 1
+address cg_vibrateForce
+address $1157
+address $233
+byte 4 1
+address cg_animationsIgnoreTimescale
+address $1158
+address $198
+byte 4 1
+address cg_animationsRate
+address $1159
+address $201
+byte 4 1
+address cg_quadFireSound
+address $1160
+address $201
+byte 4 1
+address cg_kickScale
+address $1161
+address $198
+byte 4 1
+address cg_gameType
+address $1162
+address $198
+byte 4 1
+address cg_compMode
+address $1163
+address $198
+byte 4 1
+address cg_drawSpecMessages
+address $1164
+address $201
+byte 4 1
+address g_training
+address $1165
+address $198
+byte 4 1
+address cg_waterWarp
+address $1166
+address $201
+byte 4 1
+address cg_allowLargeSprites
+address $1167
+address $198
+byte 4 1
+address cg_allowSpritePassThrough
+address $1168
+address $201
+byte 4 1
+address cg_drawSprites
+address $1169
+address $201
+byte 4 1
+address cg_drawSpriteSelf
+address $1170
+address $198
+byte 4 1
+address cg_drawSpritesDeadPlayers
+address $1171
+address $198
+byte 4 1
+address cg_playerLeanScale
+address $1172
+address $233
+byte 4 1
+address cg_cameraRewindTime
+address $1173
+address $198
+byte 4 1
+address cg_cameraQue
+address $1174
+address $201
+byte 4 1
+address cg_cameraUpdateFreeCam
+address $1175
+address $201
+byte 4 1
+address cg_cameraAddUsePreviousValues
+address $1176
+address $201
+byte 4 1
+address cg_cameraDefaultOriginType
+address $1177
+address $1178
+byte 4 1
+address cg_cameraDebugPath
+address $1179
+address $198
+byte 4 1
+address cg_cameraSmoothFactor
+address $1180
+address $1033
+byte 4 1
+address cg_q3mmeCameraSmoothPos
+address $1181
+address $198
+byte 4 1
+address cg_flightTrail
+address $1182
+address $201
+byte 4 1
+address cg_hasteTrail
+address $1183
+address $201
+byte 4 1
+address cg_noItemUseMessage
+address $1184
+address $201
+byte 4 1
+address cg_noItemUseSound
+address $1185
+address $201
+byte 4 1
+address cg_itemUseMessage
+address $1186
+address $201
+byte 4 1
+address cg_itemUseSound
+address $1187
+address $201
+byte 4 1
+address cg_localTime
+address $1188
+address $198
+byte 4 1
+address cg_localTimeStyle
+address $1189
+address $201
+byte 4 1
+address cg_warmupTime
+address $1190
+address $201
+byte 4 1
+address cg_clientOverrideIgnoreTeamSettings
+address $1191
+address $201
+byte 4 1
+address cg_killBeep
+address $1192
+address $461
+byte 4 1
+address cg_deathStyle
+address $1193
+address $201
+byte 4 1
+address cg_deathShowOwnCorpse
+address $1194
+address $201
+byte 4 1
+address cg_mouseSeekScale
+address $1195
+address $233
+byte 4 1
+address cg_mouseSeekPollInterval
+address $1196
+address $241
+byte 4 1
+address cg_mouseSeekUseTimescale
+address $1197
+address $291
+byte 4 1
+address cg_teamKillWarning
+address $1198
+address $201
+byte 4 1
+address cg_inheritPowerupShader
+address $1199
+address $198
+byte 4 1
+address cg_fadeColor
+address $1200
+address $987
+byte 4 1
+address cg_fadeAlpha
+address $1201
+address $198
+byte 4 1
+address cg_fadeStyle
+address $1202
+address $198
+byte 4 1
+address cg_enableAtCommands
+address $1203
+address $201
+byte 4 1
+address cg_quadKillCounter
+address $1204
+address $201
+byte 4 1
+address cg_battleSuitKillCounter
+address $1205
+address $201
+byte 4 1
+address cg_wideScreen
+address $1206
+address $357
+byte 4 1
+address cg_wideScreenScoreBoardHack
+address $1207
+address $198
+byte 4 1
+address cg_adShaderOverride
+address $1208
+address $198
+byte 4 1
+address cg_debugAds
+address $1209
+address $198
+byte 4 1
+address cg_firstPersonSwitchSound
+address $1210
+address $1211
+byte 4 1
+address cg_proxMineTick
+address $1212
+address $201
+byte 4 1
+address cg_drawProxWarning
+address $1213
+address $201
+byte 4 1
+address cg_drawProxWarningX
+address $1214
+address $339
+byte 4 1
+address cg_drawProxWarningY
+address $1215
+address $473
+byte 4 1
+address cg_drawProxWarningAlign
+address $1216
+address $201
+byte 4 1
+address cg_drawProxWarningStyle
+address $1217
+address $289
+byte 4 1
+address cg_drawProxWarningFont
+address $1218
+address $315
+byte 4 1
+address cg_drawProxWarningPointSize
+address $1219
+address $285
+byte 4 1
+address cg_drawProxWarningScale
+address $1220
+address $220
+byte 4 1
+address cg_drawProxWarningColor
+address $1221
+address $1222
+byte 4 1
+address cg_drawProxWarningAlpha
+address $1223
+address $287
+byte 4 1
+address cg_drawProxWarningWideScreen
+address $1224
+address $291
+byte 4 1
+address cg_customMirrorSurfaces
+address $1225
+address $198
+byte 4 1
+address cg_demoStepSmoothing
+address $1226
+address $201
+byte 4 1
+address cg_stepSmoothTime
+address $1227
+address $218
+byte 4 1
+address cg_stepSmoothMaxChange
+address $1228
+address $440
+byte 4 1
+address cg_pathRewindTime
+address $1229
+address $198
+byte 4 1
+address cg_pathSkipNum
+address $1230
+address $198
+byte 4 1
+address cg_dumpEntsUseServerTime
+address $1231
+address $198
+byte 4 1
+address cg_playerModelForceScale
+address $1232
+address $211
+byte 4 1
+address cg_playerModelForceLegsScale
+address $1233
+address $211
+byte 4 1
+address cg_playerModelForceTorsoScale
+address $1234
+address $211
+byte 4 1
+address cg_playerModelForceHeadScale
+address $1235
+address $211
+byte 4 1
+address cg_playerModelForceHeadOffset
+address $1236
+address $211
+byte 4 1
+address cg_playerModelAutoScaleHeight
+address $1237
+address $1238
+byte 4 1
+address cg_playerModelAllowServerScale
+address $1239
+address $201
+byte 4 1
+address cg_playerModelAllowServerScaleDefault
+address $1240
+address $1241
+byte 4 1
+address cg_playerModelAllowServerOverride
+address $1242
+address $201
+byte 4 1
+address cg_allowServerOverride
+address $1243
+address $201
+byte 4 1
+address cg_powerupLight
+address $1244
+address $201
+byte 4 1
+address cg_buzzerSound
+address $1245
+address $201
+byte 4 1
+address cg_flagStyle
+address $1246
+address $201
+byte 4 1
+address cg_flagTakenSound
+address $1247
+address $198
+byte 4 1
+address cg_helpIcon
+address $1248
+address $201
+byte 4 1
+address cg_helpIconStyle
+address $1249
+address $300
+byte 4 1
+address cg_helpIconMinWidth
+address $1250
+address $1251
+byte 4 1
+address cg_helpIconMaxWidth
+address $1252
+address $1253
+byte 4 1
+address cg_dominationPointTeamColor
+address $1254
+address $211
+byte 4 1
+address cg_dominationPointTeamAlpha
+address $1255
+address $211
+byte 4 1
+address cg_dominationPointEnemyColor
+address $1256
+address $211
+byte 4 1
+address cg_dominationPointEnemyAlpha
+address $1257
+address $211
+byte 4 1
+address cg_dominationPointNeutralColor
+address $1258
+address $211
+byte 4 1
+address cg_dominationPointNeutralAlpha
+address $1259
+address $211
+byte 4 1
+address cg_attackDefendVoiceStyle
+address $1260
+address $201
+byte 4 1
+address cg_drawDominationPointStatus
+address $1261
+address $201
+byte 4 1
+address cg_drawDominationPointStatusX
+address $1262
+address $1263
+byte 4 1
+address cg_drawDominationPointStatusY
+address $1264
+address $1265
+byte 4 1
+address cg_drawDominationPointStatusFont
+address $1266
+address $211
+byte 4 1
+address cg_drawDominationPointStatusPointSize
+address $1267
+address $285
+byte 4 1
+address cg_drawDominationPointStatusScale
+address $1268
+address $233
+byte 4 1
+address cg_drawDominationPointStatusEnemyColor
+address $1269
+address $211
+byte 4 1
+address cg_drawDominationPointStatusTeamColor
+address $1270
+address $211
+byte 4 1
+address cg_drawDominationPointStatusBackgroundColor
+address $1271
+address $987
+byte 4 1
+address cg_drawDominationPointStatusAlpha
+address $1272
+address $287
+byte 4 1
+address cg_drawDominationPointStatusTextColor
+address $1273
+address $320
+byte 4 1
+address cg_drawDominationPointStatusTextAlpha
+address $1274
+address $287
+byte 4 1
+address cg_drawDominationPointStatusTextStyle
+address $1275
+address $300
+byte 4 1
+address cg_drawDominationPointStatusWideScreen
+address $1276
+address $291
+skip 4
+address cg_roundScoreBoard
+address $1277
+address $201
+byte 4 1
+address cg_headShots
+address $1278
+address $201
+byte 4 1
+address cg_spectatorListSkillRating
+address $1279
+address $201
+byte 4 1
+address cg_spectatorListScore
+address $1280
+address $201
+byte 4 1
+address cg_spectatorListQue
+address $1281
+address $201
+byte 4 1
+address cg_rocketAimBot
+address $1282
+address $198
+byte 4 1
+address cg_drawTieredArmorAvailability
+address $1283
+address $201
+byte 4 1
+address cg_drawDeadFriendTime
+address $1284
+address $432
+byte 4 1
+address cg_drawHitFriendTime
+address $1285
+address $610
+byte 4 1
+address cg_racePlayerShader
+address $1286
+address $201
+byte 4 1
+address cg_quadSoundRate
+address $1287
+address $239
+byte 4 1
+address cg_cpmaSound
+address $1288
+address $201
+byte 4 1
+address cg_soundPvs
+address $1289
+address $201
+byte 4 1
+address cg_soundBuffer
+address $1290
+address $201
+byte 4 1
+address cg_drawFightMessage
+address $1291
+address $201
+byte 4 1
+address cg_winLossMusic
+address $1292
+address $201
+byte 4 1
+address cg_rewardCapture
+address $1293
+address $201
+byte 4 1
+address cg_rewardImpressive
+address $1294
+address $201
+byte 4 1
+address cg_rewardExcellent
+address $1295
+address $201
+byte 4 1
+address cg_rewardHumiliation
+address $1296
+address $201
+byte 4 1
+address cg_rewardDefend
+address $1297
+address $201
+byte 4 1
+address cg_rewardAssist
+address $1298
+address $201
+byte 4 1
+address cg_rewardComboKill
+address $1299
+address $201
+byte 4 1
+address cg_rewardRampage
+address $1300
+address $201
+byte 4 1
+address cg_rewardMidAir
+address $1301
+address $201
+byte 4 1
+address cg_rewardRevenge
+address $1302
+address $201
+byte 4 1
+address cg_rewardPerforated
+address $1303
+address $201
+byte 4 1
+address cg_rewardHeadshot
+address $1304
+address $201
+byte 4 1
+address cg_rewardAccuracy
+address $1305
+address $201
+byte 4 1
+address cg_rewardQuadGod
+address $1306
+address $201
+byte 4 1
+address cg_rewardFirstFrag
+address $1307
+address $201
+byte 4 1
+address cg_rewardPerfect
+address $1308
+address $201
+byte 4 1
+address cg_useDemoFov
+address $1309
+address $198
+byte 4 1
+address cg_specOffsetQL
+address $1310
+address $201
+byte 4 1
+address cg_drawKeyPress
+address $1311
+address $198
+byte 4 1
+address cg_useScoresUpdateTeam
+address $1312
+address $201
+byte 4 1
+address cg_sceneBatching
+address $1313
+address $201
+byte 4 1
+address cg_cullLocalEntities
+address $1314
+address $201
+byte 4 1
+align 4
+LABELV cvarTableSize
+byte 4 988
+code
+proc CG_RegisterCvars 1036 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $1319
+JUMPV
+LABELV $1316
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $1317
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $1319
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $1316
+ADDRGP4 $1320
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 1032
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39684
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+LABELV $1315
+endproc CG_RegisterCvars 1036 16
+export CG_ForceModelChange
+proc CG_ForceModelChange 12 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1324
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1328
+ADDRGP4 $1325
+JUMPV
+LABELV $1328
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+LABELV $1325
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1324
+LABELV $1323
+endproc CG_ForceModelChange 12 4
+proc CG_CreateNameSprites 20 40
+ADDRGP4 cg_drawPlayerNamesFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1331
+ADDRLP4 8
+ADDRGP4 cgs+632912+797040
+ASGNP4
+ADDRGP4 $1332
+JUMPV
+LABELV $1331
+ADDRLP4 8
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $1332
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1338
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1342
+ADDRGP4 $1339
+JUMPV
+LABELV $1342
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1345
+ADDRGP4 $1349
+ARGP4
+ADDRLP4 12
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $1346
+JUMPV
+LABELV $1345
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ASGNP4
+LABELV $1346
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+630584
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_CreateNameSprite
+CALLV
+pop
+LABELV $1339
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1338
+LABELV $1330
+endproc CG_CreateNameSprites 20 40
+export CG_UpdateCvars
+proc CG_UpdateCvars 1120 16
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg_audioAnnouncer+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $1364
+JUMPV
+LABELV $1361
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $1362
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $1364
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $1361
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+EQI4 $1365
+ADDRGP4 cg+617032
+CNSTP4 0
+ASGNP4
+LABELV $1365
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg_audioAnnouncer+12
+INDIRI4
+EQI4 $1369
+ADDRGP4 CG_RegisterAnnouncerSounds
+CALLV
+pop
+LABELV $1369
+ADDRGP4 drawTeamOverlayModificationCount
+INDIRI4
+ADDRGP4 cg_drawTeamOverlay+4
+INDIRI4
+EQI4 $1372
+ADDRGP4 drawTeamOverlayModificationCount
+ADDRGP4 cg_drawTeamOverlay+4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+LEI4 $1376
+ADDRGP4 $539
+ARGP4
+ADDRGP4 $201
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1377
+JUMPV
+LABELV $1376
+ADDRGP4 $539
+ARGP4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1377
+ADDRGP4 $539
+ARGP4
+ADDRGP4 $201
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1372
+ADDRGP4 forceModelModificationCount
+INDIRI4
+ADDRGP4 cg_forceModel+4
+INDIRI4
+EQI4 $1379
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ForceModelChange
+CALLV
+pop
+LABELV $1379
+ADDRGP4 cgs+632912+818712
+INDIRI4
+ADDRGP4 cg_drawPlayerNamesStyle+4
+INDIRI4
+EQI4 $1383
+ADDRGP4 CG_CreateNameSprites
+CALLV
+pop
+ADDRGP4 cgs+632912+818712
+ADDRGP4 cg_drawPlayerNamesStyle+4
+INDIRI4
+ASGNI4
+ADDRGP4 $1384
+JUMPV
+LABELV $1383
+ADDRGP4 cgs+632912+818716
+INDIRI4
+ADDRGP4 cg_drawPlayerNamesPointSize+4
+INDIRI4
+EQI4 $1391
+ADDRGP4 CG_CreateNameSprites
+CALLV
+pop
+ADDRGP4 cgs+632912+818716
+ADDRGP4 cg_drawPlayerNamesPointSize+4
+INDIRI4
+ASGNI4
+ADDRGP4 $1392
+JUMPV
+LABELV $1391
+ADDRGP4 cgs+632912+818720
+INDIRI4
+ADDRGP4 cg_drawPlayerNamesColor+4
+INDIRI4
+EQI4 $1399
+ADDRGP4 CG_CreateNameSprites
+CALLV
+pop
+ADDRGP4 cgs+632912+818720
+ADDRGP4 cg_drawPlayerNamesColor+4
+INDIRI4
+ASGNI4
+ADDRGP4 $1400
+JUMPV
+LABELV $1399
+ADDRGP4 cgs+632912+818724
+INDIRI4
+ADDRGP4 cg_drawPlayerNamesAlpha+4
+INDIRI4
+EQI4 $1407
+ADDRGP4 CG_CreateNameSprites
+CALLV
+pop
+ADDRGP4 cgs+632912+818724
+ADDRGP4 cg_drawPlayerNamesAlpha+4
+INDIRI4
+ASGNI4
+LABELV $1407
+LABELV $1400
+LABELV $1392
+LABELV $1384
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1415
+ADDRGP4 cg_ambientSounds+12
+INDIRI4
+CNSTI4 1
+EQI4 $1419
+ADDRGP4 $1418
+JUMPV
+LABELV $1418
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1422
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StopLoopingSound
+CALLV
+pop
+LABELV $1423
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $1422
+LABELV $1419
+LABELV $1415
+ADDRGP4 cg+6747452
+INDIRI4
+ADDRGP4 cg_damagePlum+4
+INDIRI4
+EQI4 $1426
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1430
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6747392
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1431
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $1430
+ADDRLP4 20
+ADDRGP4 cg_damagePlum+16
+ASGNP4
+ADDRGP4 $1437
+JUMPV
+LABELV $1436
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1441
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1439
+LABELV $1441
+ADDRGP4 $1438
+JUMPV
+LABELV $1439
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1056
+ADDRGP4 CG_GetToken
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1444
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $1442
+ADDRGP4 cg+6747392
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1443
+JUMPV
+LABELV $1442
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1448
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $1446
+ADDRGP4 cg+6747392+4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1447
+JUMPV
+LABELV $1446
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1453
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $1451
+ADDRGP4 cg+6747392+8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1452
+JUMPV
+LABELV $1451
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1458
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $1456
+ADDRGP4 cg+6747392+12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1457
+JUMPV
+LABELV $1456
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1463
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $1461
+ADDRGP4 cg+6747392+16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1462
+JUMPV
+LABELV $1461
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1468
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $1466
+ADDRGP4 cg+6747392+20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1467
+JUMPV
+LABELV $1466
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1473
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $1471
+ADDRGP4 cg+6747392+24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1472
+JUMPV
+LABELV $1471
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1478
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $1476
+ADDRGP4 cg+6747392+28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1477
+JUMPV
+LABELV $1476
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1483
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $1481
+ADDRGP4 cg+6747392+32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1482
+JUMPV
+LABELV $1481
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1488
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $1486
+ADDRGP4 cg+6747392+36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1487
+JUMPV
+LABELV $1486
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1493
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $1491
+ADDRGP4 cg+6747392+40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1492
+JUMPV
+LABELV $1491
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1498
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $1496
+ADDRGP4 cg+6747392+52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1497
+JUMPV
+LABELV $1496
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1503
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $1501
+ADDRGP4 cg+6747392+44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1502
+JUMPV
+LABELV $1501
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1508
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $1506
+ADDRGP4 cg+6747392+48
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1507
+JUMPV
+LABELV $1506
+ADDRLP4 24
+ARGP4
+ADDRGP4 $1513
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $1511
+ADDRGP4 cg+6747392+56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1512
+JUMPV
+LABELV $1511
+ADDRGP4 $1516
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1512
+LABELV $1507
+LABELV $1502
+LABELV $1497
+LABELV $1492
+LABELV $1487
+LABELV $1482
+LABELV $1477
+LABELV $1472
+LABELV $1467
+LABELV $1462
+LABELV $1457
+LABELV $1452
+LABELV $1447
+LABELV $1443
+LABELV $1437
+ADDRGP4 $1436
+JUMPV
+LABELV $1438
+ADDRGP4 cg+6747452
+ADDRGP4 cg_damagePlum+4
+INDIRI4
+ASGNI4
+LABELV $1426
+LABELV $1357
+endproc CG_UpdateCvars 1120 16
+proc CG_CheckIndividualFontUpdate 12 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1520
+ADDRFP4 20
+INDIRP4
+INDIRI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1520
+CNSTI4 0
+RETI4
+ADDRGP4 $1519
+JUMPV
+LABELV $1520
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1524
+ADDRFP4 20
+INDIRP4
+INDIRI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $1522
+LABELV $1524
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1525
+ADDRLP4 0
+ADDRGP4 $1527
+ASGNP4
+LABELV $1525
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 21532
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1528
+ADDRGP4 $1530
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+623648
+ARGP4
+CNSTU4 21668
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1528
+LABELV $1529
+ADDRFP4 12
+INDIRP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1522
+CNSTI4 1
+RETI4
+LABELV $1519
+endproc CG_CheckIndividualFontUpdate 12 16
+export CG_CheckFontUpdates
+proc CG_CheckFontUpdates 4 24
+ADDRGP4 cgs+632912+688660
+ARGP4
+ADDRGP4 cg_drawFragMessagePointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawFragMessageFont
+ARGP4
+ADDRGP4 cgs+632912+710328
+ARGP4
+ADDRGP4 cg_drawFragMessagePointSize
+ARGP4
+ADDRGP4 cgs+632912+710332
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+666984
+ARGP4
+ADDRGP4 cg_drawCenterPrintPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawCenterPrintFont
+ARGP4
+ADDRGP4 cgs+632912+688652
+ARGP4
+ADDRGP4 cg_drawCenterPrintPointSize
+ARGP4
+ADDRGP4 cgs+632912+688656
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+710336
+ARGP4
+ADDRGP4 cg_drawRewardsPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawRewardsFont
+ARGP4
+ADDRGP4 cgs+632912+732004
+ARGP4
+ADDRGP4 cg_drawRewardsPointSize
+ARGP4
+ADDRGP4 cgs+632912+732008
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+732012
+ARGP4
+ADDRGP4 cg_drawFPSPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawFPSFont
+ARGP4
+ADDRGP4 cgs+632912+753680
+ARGP4
+ADDRGP4 cg_drawFPSPointSize
+ARGP4
+ADDRGP4 cgs+632912+753684
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+753688
+ARGP4
+ADDRGP4 cg_drawClientItemTimerPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawClientItemTimerFont
+ARGP4
+ADDRGP4 cgs+632912+775356
+ARGP4
+ADDRGP4 cg_drawClientItemTimerPointSize
+ARGP4
+ADDRGP4 cgs+632912+775360
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+797040
+ARGP4
+ADDRGP4 cg_drawPlayerNamesPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawPlayerNamesFont
+ARGP4
+ADDRGP4 cgs+632912+818708
+ARGP4
+ADDRGP4 cg_drawPlayerNamesPointSize
+ARGP4
+ADDRGP4 cgs+632912+818716
+ARGP4
+ADDRLP4 0
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1571
+ADDRGP4 CG_CreateNameSprites
+CALLV
+pop
+LABELV $1571
+ADDRGP4 cgs+632912+818728
+ARGP4
+ADDRGP4 cg_drawSnapshotPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawSnapshotFont
+ARGP4
+ADDRGP4 cgs+632912+840396
+ARGP4
+ADDRGP4 cg_drawSnapshotPointSize
+ARGP4
+ADDRGP4 cgs+632912+840400
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+775364
+ARGP4
+ADDRGP4 cg_drawAmmoWarningPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawAmmoWarningFont
+ARGP4
+ADDRGP4 cgs+632912+797032
+ARGP4
+ADDRGP4 cg_drawAmmoWarningPointSize
+ARGP4
+ADDRGP4 cgs+632912+797036
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+840404
+ARGP4
+ADDRGP4 cg_drawCrosshairNamesPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawCrosshairNamesFont
+ARGP4
+ADDRGP4 cgs+632912+862072
+ARGP4
+ADDRGP4 cg_drawCrosshairNamesPointSize
+ARGP4
+ADDRGP4 cgs+632912+862076
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+862080
+ARGP4
+ADDRGP4 cg_drawCrosshairTeammateHealthPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawCrosshairTeammateHealthFont
+ARGP4
+ADDRGP4 cgs+632912+883748
+ARGP4
+ADDRGP4 cg_drawCrosshairTeammateHealthPointSize
+ARGP4
+ADDRGP4 cgs+632912+883752
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+883756
+ARGP4
+ADDRGP4 cg_drawWarmupStringPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawWarmupStringFont
+ARGP4
+ADDRGP4 cgs+632912+905424
+ARGP4
+ADDRGP4 cg_drawWarmupStringPointSize
+ARGP4
+ADDRGP4 cgs+632912+905428
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+905432
+ARGP4
+ADDRGP4 cg_drawWaitingForPlayersPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawWaitingForPlayersFont
+ARGP4
+ADDRGP4 cgs+632912+927100
+ARGP4
+ADDRGP4 cg_drawWaitingForPlayersPointSize
+ARGP4
+ADDRGP4 cgs+632912+927104
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+927108
+ARGP4
+ADDRGP4 cg_drawVotePointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawVoteFont
+ARGP4
+ADDRGP4 cgs+632912+948776
+ARGP4
+ADDRGP4 cg_drawVotePointSize
+ARGP4
+ADDRGP4 cgs+632912+948780
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+948784
+ARGP4
+ADDRGP4 cg_drawTeamVotePointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawTeamVoteFont
+ARGP4
+ADDRGP4 cgs+632912+970452
+ARGP4
+ADDRGP4 cg_drawTeamVotePointSize
+ARGP4
+ADDRGP4 cgs+632912+970456
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+970460
+ARGP4
+ADDRGP4 cg_drawFollowingPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawFollowingFont
+ARGP4
+ADDRGP4 cgs+632912+992128
+ARGP4
+ADDRGP4 cg_drawFollowingPointSize
+ARGP4
+ADDRGP4 cgs+632912+992132
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+992136
+ARGP4
+ADDRGP4 cg_drawCpmaMvdIndicatorPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawCpmaMvdIndicatorFont
+ARGP4
+ADDRGP4 cgs+632912+992128
+ARGP4
+ADDRGP4 cg_drawCpmaMvdIndicatorPointSize
+ARGP4
+ADDRGP4 cgs+632912+1013808
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1013812
+ARGP4
+ADDRGP4 cg_weaponBarPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_weaponBarFont
+ARGP4
+ADDRGP4 cgs+632912+1035480
+ARGP4
+ADDRGP4 cg_weaponBarPointSize
+ARGP4
+ADDRGP4 cgs+632912+1035484
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1035488
+ARGP4
+ADDRGP4 cg_drawItemPickupsPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawItemPickupsFont
+ARGP4
+ADDRGP4 cgs+632912+1057156
+ARGP4
+ADDRGP4 cg_drawItemPickupsPointSize
+ARGP4
+ADDRGP4 cgs+632912+1057160
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1057164
+ARGP4
+ADDRGP4 cg_drawOriginPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawOriginFont
+ARGP4
+ADDRGP4 cgs+632912+1078832
+ARGP4
+ADDRGP4 cg_drawOriginPointSize
+ARGP4
+ADDRGP4 cgs+632912+1078836
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1078840
+ARGP4
+ADDRGP4 cg_drawSpeedPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawSpeedFont
+ARGP4
+ADDRGP4 cgs+632912+1100508
+ARGP4
+ADDRGP4 cg_drawSpeedPointSize
+ARGP4
+ADDRGP4 cgs+632912+1100512
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1100516
+ARGP4
+ADDRGP4 cg_lagometerFontPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_lagometerFont
+ARGP4
+ADDRGP4 cgs+632912+1122184
+ARGP4
+ADDRGP4 cg_lagometerFontPointSize
+ARGP4
+ADDRGP4 cgs+632912+1122188
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1122192
+ARGP4
+ADDRGP4 cg_drawAttackerPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawAttackerFont
+ARGP4
+ADDRGP4 cgs+632912+1143860
+ARGP4
+ADDRGP4 cg_drawAttackerPointSize
+ARGP4
+ADDRGP4 cgs+632912+1143864
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1143868
+ARGP4
+ADDRGP4 cg_drawTeamOverlayPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawTeamOverlayFont
+ARGP4
+ADDRGP4 cgs+632912+1165536
+ARGP4
+ADDRGP4 cg_drawTeamOverlayPointSize
+ARGP4
+ADDRGP4 cgs+632912+1165540
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1165544
+ARGP4
+ADDRGP4 cg_drawCameraPointInfoPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawCameraPointInfoFont
+ARGP4
+ADDRGP4 cgs+632912+1187212
+ARGP4
+ADDRGP4 cg_drawCameraPointInfoPointSize
+ARGP4
+ADDRGP4 cgs+632912+1187216
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1187220
+ARGP4
+ADDRGP4 cg_drawJumpSpeedsPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawJumpSpeedsFont
+ARGP4
+ADDRGP4 cgs+632912+1208888
+ARGP4
+ADDRGP4 cg_drawJumpSpeedsPointSize
+ARGP4
+ADDRGP4 cgs+632912+1208892
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1208896
+ARGP4
+ADDRGP4 cg_drawJumpSpeedsTimePointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawJumpSpeedsTimeFont
+ARGP4
+ADDRGP4 cgs+632912+1230564
+ARGP4
+ADDRGP4 cg_drawJumpSpeedsTimePointSize
+ARGP4
+ADDRGP4 cgs+632912+1230568
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1230572
+ARGP4
+ADDRGP4 cg_drawRaceTimePointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawRaceTimeFont
+ARGP4
+ADDRGP4 cgs+632912+1252240
+ARGP4
+ADDRGP4 cg_drawRaceTimePointSize
+ARGP4
+ADDRGP4 cgs+632912+1252244
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1252248
+ARGP4
+ADDRGP4 cg_drawProxWarningPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawProxWarningFont
+ARGP4
+ADDRGP4 cgs+632912+1273916
+ARGP4
+ADDRGP4 cg_drawProxWarningPointSize
+ARGP4
+ADDRGP4 cgs+632912+1273920
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1273924
+ARGP4
+ADDRGP4 cg_drawDominationPointStatusPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawDominationPointStatusFont
+ARGP4
+ADDRGP4 cgs+632912+1295592
+ARGP4
+ADDRGP4 cg_drawDominationPointStatusPointSize
+ARGP4
+ADDRGP4 cgs+632912+1295596
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+ADDRGP4 cgs+632912+1295600
+ARGP4
+ADDRGP4 cg_damagePlumPointSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_damagePlumFont
+ARGP4
+ADDRGP4 cgs+632912+1317268
+ARGP4
+ADDRGP4 cg_damagePlumPointSize
+ARGP4
+ADDRGP4 cgs+632912+1317272
+ARGP4
+ADDRGP4 CG_CheckIndividualFontUpdate
+CALLI4
+pop
+LABELV $1535
+endproc CG_CheckFontUpdates 4 24
+proc CG_TimeChange 4 12
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1749
+LABELV $1749
+ADDRGP4 $1754
+ARGP4
+ADDRLP4 0
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1752
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1755
+ADDRGP4 $1758
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1755
+LABELV $1752
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ResetTimeChange
+CALLV
+pop
+ADDRGP4 cg+3196804
+INDIRI4
+CNSTI4 0
+EQI4 $1761
+ADDRGP4 $1762
+JUMPV
+LABELV $1761
+ADDRGP4 cg+3196784
+INDIRI4
+CNSTI4 0
+EQI4 $1764
+LABELV $1764
+LABELV $1762
+ADDRGP4 cg+3196800
+CNSTI4 0
+ASGNI4
+LABELV $1748
+endproc CG_TimeChange 4 12
+export CG_CrosshairPlayer
+proc CG_CrosshairPlayer 0 0
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+627148
+INDIRI4
+CNSTI4 1000
+ADDI4
+LEI4 $1769
+CNSTI4 -1
+RETI4
+ADDRGP4 $1768
+JUMPV
+LABELV $1769
+ADDRGP4 cg+627144
+INDIRI4
+RETI4
+LABELV $1768
+endproc CG_CrosshairPlayer 0 0
+export CG_LastAttacker
+proc CG_LastAttacker 0 0
+ADDRGP4 cg+627160
+INDIRI4
+CNSTI4 0
+NEI4 $1775
+CNSTI4 -1
+RETI4
+ADDRGP4 $1774
+JUMPV
+LABELV $1775
+ADDRGP4 PERS_ATTACKER
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+RETI4
+LABELV $1774
+endproc CG_LastAttacker 0 0
+export CG_AddChatLine
+proc CG_AddChatLine 8 12
+ADDRLP4 0
+ADDRGP4 cg+1329256
+INDIRI4
+CNSTI4 100
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cg+1226456
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+1328856
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+1329256
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1779
+endproc CG_AddChatLine 8 12
+export CG_PrintToScreen
+proc CG_PrintToScreen 1032 16
+ADDRLP4 1028
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRLP4 4+1023
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1789
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+CNSTI4 32
+LTI4 $1793
+ADDRGP4 $1790
+JUMPV
+LABELV $1793
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1795
+ADDRGP4 $1791
+JUMPV
+LABELV $1795
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTI1 32
+ASGNI1
+LABELV $1790
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $1789
+LABELV $1791
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AddChatLine
+CALLV
+pop
+LABELV $1786
+endproc CG_PrintToScreen 1032 16
+export CG_Printf
+proc CG_Printf 16440 28
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 16384
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $1799
+ADDRLP4 16388
+ADDRGP4 $1802
+ASGNP4
+ADDRGP4 $1800
+JUMPV
+LABELV $1799
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1803
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1803
+ADDRLP4 16388
+ADDRGP4 $1807
+ASGNP4
+ADDRGP4 $1804
+JUMPV
+LABELV $1803
+ADDRLP4 16388
+ADDRGP4 $211
+ASGNP4
+LABELV $1804
+LABELV $1800
+ADDRGP4 cg_printTimeStamps+12
+INDIRI4
+CNSTI4 2
+NEI4 $1808
+ADDRGP4 $1811
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16392
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16392
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $1809
+JUMPV
+LABELV $1808
+ADDRGP4 cg_printTimeStamps+12
+INDIRI4
+CNSTI4 1
+NEI4 $1813
+ADDRLP4 16408
+ADDRGP4 CG_GameTimeout
+CALLI4
+ASGNI4
+ADDRLP4 16408
+INDIRI4
+CNSTI4 0
+EQI4 $1816
+ADDRLP4 16404
+ADDRGP4 cgs+45340
+INDIRI4
+ADDRGP4 cgs+43236
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $1817
+JUMPV
+LABELV $1816
+ADDRLP4 16404
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+43236
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1817
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1822
+CNSTP4 0
+ARGP4
+ADDRLP4 16412
+ADDRGP4 CG_GetCurrentTimeWithDirection
+CALLI4
+ASGNI4
+ADDRLP4 16404
+ADDRLP4 16412
+INDIRI4
+ASGNI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1822
+ADDRLP4 16404
+CNSTI4 0
+ASGNI4
+LABELV $1823
+ADDRLP4 16392
+ADDRLP4 16404
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 16412
+ADDRLP4 16392
+INDIRI4
+ASGNI4
+ADDRLP4 16416
+CNSTI4 60
+ASGNI4
+ADDRLP4 16396
+ADDRLP4 16412
+INDIRI4
+ADDRLP4 16416
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 16420
+ADDRLP4 16396
+INDIRI4
+ASGNI4
+ADDRLP4 16392
+ADDRLP4 16412
+INDIRI4
+ADDRLP4 16416
+INDIRI4
+ADDRLP4 16420
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 16424
+ADDRLP4 16392
+INDIRI4
+ASGNI4
+ADDRLP4 16428
+CNSTI4 10
+ASGNI4
+ADDRLP4 16400
+ADDRLP4 16424
+INDIRI4
+ADDRLP4 16428
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 16432
+ADDRLP4 16400
+INDIRI4
+ASGNI4
+ADDRLP4 16392
+ADDRLP4 16424
+INDIRI4
+ADDRLP4 16428
+INDIRI4
+ADDRLP4 16432
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $1825
+ARGP4
+ADDRLP4 16388
+INDIRP4
+ARGP4
+ADDRLP4 16420
+INDIRI4
+ARGI4
+ADDRLP4 16432
+INDIRI4
+ARGI4
+ADDRLP4 16392
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16436
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16436
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $1814
+JUMPV
+LABELV $1813
+ADDRGP4 cg_printTimeStamps+12
+INDIRI4
+CNSTI4 3
+NEI4 $1826
+ADDRLP4 16408
+ADDRGP4 CG_GameTimeout
+CALLI4
+ASGNI4
+ADDRLP4 16408
+INDIRI4
+CNSTI4 0
+EQI4 $1829
+ADDRLP4 16404
+ADDRGP4 cgs+45340
+INDIRI4
+ADDRGP4 cgs+43236
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $1830
+JUMPV
+LABELV $1829
+ADDRLP4 16404
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+43236
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1830
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1835
+CNSTP4 0
+ARGP4
+ADDRLP4 16412
+ADDRGP4 CG_GetCurrentTimeWithDirection
+CALLI4
+ASGNI4
+ADDRLP4 16404
+ADDRLP4 16412
+INDIRI4
+ASGNI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1835
+ADDRLP4 16404
+CNSTI4 0
+ASGNI4
+LABELV $1836
+ADDRLP4 16392
+ADDRLP4 16404
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 16412
+ADDRLP4 16392
+INDIRI4
+ASGNI4
+ADDRLP4 16416
+CNSTI4 60
+ASGNI4
+ADDRLP4 16396
+ADDRLP4 16412
+INDIRI4
+ADDRLP4 16416
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 16420
+ADDRLP4 16396
+INDIRI4
+ASGNI4
+ADDRLP4 16392
+ADDRLP4 16412
+INDIRI4
+ADDRLP4 16416
+INDIRI4
+ADDRLP4 16420
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 16424
+ADDRLP4 16392
+INDIRI4
+ASGNI4
+ADDRLP4 16428
+CNSTI4 10
+ASGNI4
+ADDRLP4 16400
+ADDRLP4 16424
+INDIRI4
+ADDRLP4 16428
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 16432
+ADDRLP4 16400
+INDIRI4
+ASGNI4
+ADDRLP4 16392
+ADDRLP4 16424
+INDIRI4
+ADDRLP4 16428
+INDIRI4
+ADDRLP4 16432
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $1838
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+43236
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 16420
+INDIRI4
+ARGI4
+ADDRLP4 16432
+INDIRI4
+ARGI4
+ADDRLP4 16392
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16436
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16436
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $1827
+JUMPV
+LABELV $1826
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $1827
+LABELV $1814
+LABELV $1809
+LABELV $1797
+endproc CG_Printf 16440 28
+export CG_Error
+proc CG_Error 16388 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 16384
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $1842
+endproc CG_Error 16388 16
+export Com_Error
+proc Com_Error 16388 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 16384
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $1844
+endproc Com_Error 16388 16
+export Com_Printf
+proc Com_Printf 16388 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 16384
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $1846
+endproc Com_Printf 16388 16
+bss
+align 1
+LABELV $1849
+skip 1024
+export CG_Argv
+code
+proc CG_Argv 0 12
+ADDRGP4 cg+5417600
+INDIRI4
+CNSTI4 0
+EQI4 $1850
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+5417604
+INDIRI4
+LEI4 $1853
+ADDRGP4 $211
+RETP4
+ADDRGP4 $1848
+JUMPV
+LABELV $1853
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+5417608
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1848
+JUMPV
+LABELV $1850
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1849
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 $1849
+RETP4
+LABELV $1848
+endproc CG_Argv 0 12
+export CG_Argc
+proc CG_Argc 4 0
+ADDRGP4 cg+5417600
+INDIRI4
+CNSTI4 0
+EQI4 $1858
+ADDRGP4 cg+5417604
+INDIRI4
+RETI4
+ADDRGP4 $1857
+JUMPV
+LABELV $1858
+ADDRLP4 0
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1857
+endproc CG_Argc 4 0
+bss
+align 1
+LABELV $1863
+skip 1024
+export CG_ArgsFrom
+code
+proc CG_ArgsFrom 16 12
+ADDRGP4 $1863
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $1864
+ADDRGP4 $1863
+RETP4
+ADDRGP4 $1862
+JUMPV
+LABELV $1864
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $1869
+JUMPV
+LABELV $1866
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1863
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1870
+ADDRGP4 $1863
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1872
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $1870
+LABELV $1867
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1869
+ADDRLP4 8
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $1866
+ADDRGP4 $1863
+RETP4
+LABELV $1862
+endproc CG_ArgsFrom 16 12
+proc CG_RegisterItemSounds 96 12
+ADDRLP4 76
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1874
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $1874
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1878
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1880
+LABELV $1878
+ADDRGP4 $1873
+JUMPV
+LABELV $1879
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1883
+JUMPV
+LABELV $1882
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1883
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $1885
+ADDRLP4 84
+INDIRI4
+CNSTI4 32
+NEI4 $1882
+LABELV $1885
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $1888
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+GEI4 $1886
+LABELV $1888
+ADDRGP4 $1889
+ARGP4
+ADDRLP4 76
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1873
+JUMPV
+LABELV $1886
+ADDRLP4 8
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1890
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1890
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8-3
+ADDP4
+ARGP4
+ADDRGP4 $1895
+ARGP4
+ADDRLP4 92
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $1892
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $1892
+LABELV $1880
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1879
+LABELV $1873
+endproc CG_RegisterItemSounds 96 12
+proc CG_RegisterAnnouncerSounds 432 12
+ADDRGP4 cg_audioAnnouncer+12
+INDIRI4
+CNSTI4 1
+NEI4 $1897
+ADDRLP4 4
+ADDRGP4 $1900
+ASGNP4
+ADDRGP4 $1898
+JUMPV
+LABELV $1897
+ADDRGP4 cg_audioAnnouncer+12
+INDIRI4
+CNSTI4 2
+NEI4 $1901
+ADDRLP4 4
+ADDRGP4 $1904
+ASGNP4
+ADDRGP4 $1902
+JUMPV
+LABELV $1901
+ADDRLP4 4
+ADDRGP4 $1905
+ASGNP4
+LABELV $1902
+LABELV $1898
+ADDRGP4 $1908
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493008
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $1911
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493012
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $1914
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493016
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $1917
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493028
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $1920
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493024
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $1923
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493020
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $1926
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 60
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493444
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $1929
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493448
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $1932
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493452
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $1935
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 84
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493456
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 $1938
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 92
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493460
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $1941
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 100
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493464
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 $1944
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 108
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493468
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 $1947
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 116
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493516
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GEI4 $1952
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1948
+LABELV $1952
+ADDRGP4 $1955
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 124
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493264
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRGP4 $1958
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 132
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493268
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $1961
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 140
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493272
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $1964
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493256
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $1967
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493260
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $1970
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 164
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493284
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 $1973
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 172
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493288
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRGP4 $1976
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 180
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493276
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 $1979
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 188
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493280
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRGP4 $1982
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 196
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493292
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRGP4 $1985
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 204
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493296
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRGP4 $1988
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 212
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493300
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $1991
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 220
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493304
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRGP4 $1994
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 228
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493308
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRGP4 $1997
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 236
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493384
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRGP4 $2000
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 240
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 244
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493388
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRGP4 $2003
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 252
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493392
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRGP4 $2006
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 260
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493396
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRGP4 $2009
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 268
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493400
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $2012
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 276
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493404
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $2015
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 284
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493408
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $2018
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 292
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493412
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRGP4 $2021
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 300
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493416
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRGP4 $2024
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 308
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493420
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRGP4 $2027
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 316
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493424
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 $2030
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 324
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493428
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $2033
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 328
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493432
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $2036
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493436
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $2039
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 344
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493440
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $2045
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $2045
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $2040
+LABELV $2045
+ADDRGP4 $2048
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493336
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $2051
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493340
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $2054
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 368
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493344
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $2057
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 376
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493348
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $2060
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 384
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 384
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493356
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $2063
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 392
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493360
+ADDRLP4 396
+INDIRI4
+ASGNI4
+LABELV $2040
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $2070
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $2070
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $2070
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $2064
+LABELV $2070
+ADDRGP4 $2073
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493364
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $2076
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493380
+ADDRLP4 364
+INDIRI4
+ASGNI4
+LABELV $2064
+ADDRGP4 $2073
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493364
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $2076
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493380
+ADDRLP4 364
+INDIRI4
+ASGNI4
+LABELV $1948
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2081
+ADDRGP4 $2087
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 128
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493064
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+LABELV $2082
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2081
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2088
+ADDRGP4 $2094
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 128
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493076
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+LABELV $2089
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2088
+ADDRGP4 $2097
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 124
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493088
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2098
+ADDRGP4 $2104
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 136
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493092
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+LABELV $2099
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2098
+ADDRGP4 $2107
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 132
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493104
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $2110
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 140
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493108
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $2113
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493112
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $2116
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493116
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $2119
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 164
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493120
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 $2122
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 172
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493124
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRGP4 $2126
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 180
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493124+4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 $2130
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493124+8
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRGP4 $2133
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 196
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493136
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRGP4 $2136
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 204
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493140
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRGP4 $2139
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 212
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493144
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $2006
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 220
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493148
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRGP4 $2144
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 228
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493152
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRGP4 $2147
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 236
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493156
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRGP4 $2150
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 240
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 244
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493160
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRGP4 $2154
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 252
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493160+4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRGP4 $2158
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 260
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493160+8
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRGP4 $2161
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 268
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493172
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $2165
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 276
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493172+4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $2169
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 284
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493172+8
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+493184
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2174
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 292
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493188
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRGP4 $2178
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 300
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493188+4
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRGP4 $2182
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 308
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493188+8
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRGP4 $2185
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 316
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493200
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 $2188
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 324
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493204
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $2191
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 328
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493208
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $2194
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493212
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $2197
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 344
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493216
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $2200
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493220
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $2203
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493224
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $2206
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 368
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492920
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $2209
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 376
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492924
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $2212
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 384
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 384
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493636
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $2215
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 392
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317480
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $2218
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 400
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 400
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317484
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $2221
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 408
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 408
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317488
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $2224
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 416
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 416
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317492
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $2227
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 424
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 424
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317496
+ADDRLP4 428
+INDIRI4
+ASGNI4
+LABELV $1896
+endproc CG_RegisterAnnouncerSounds 432 12
+proc CG_RegisterSounds 648 16
+ADDRGP4 CG_RegisterAnnouncerSounds
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GEI4 $2233
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $2229
+LABELV $2233
+ADDRGP4 $2236
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493252
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $2239
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493060
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $2236
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493312
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $2244
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493316
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $2247
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493320
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $2250
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493324
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $2253
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493328
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $2256
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 360
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493332
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $2261
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $2257
+LABELV $2261
+ADDRGP4 $2250
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493352
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $2266
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493372
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $2269
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493368
+ADDRLP4 372
+INDIRI4
+ASGNI4
+LABELV $2257
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 7
+EQI4 $2274
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $2270
+LABELV $2274
+ADDRGP4 $2277
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493376
+ADDRLP4 364
+INDIRI4
+ASGNI4
+LABELV $2270
+LABELV $2229
+ADDRGP4 $2280
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492648
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $2283
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492652
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $2286
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 340
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492660
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $2289
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492656
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $2292
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492928
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+492928
+INDIRI4
+CNSTI4 0
+NEI4 $2293
+ADDRGP4 $2299
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492928
+ADDRLP4 352
+INDIRI4
+ASGNI4
+LABELV $2293
+ADDRGP4 $2302
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492932
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+492932
+INDIRI4
+CNSTI4 0
+NEI4 $2303
+ADDRGP4 $2309
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492932
+ADDRLP4 356
+INDIRI4
+ASGNI4
+LABELV $2303
+ADDRGP4 $2312
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492936
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+492936
+INDIRI4
+CNSTI4 0
+NEI4 $2313
+ADDRGP4 $2319
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 360
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492936
+ADDRLP4 360
+INDIRI4
+ASGNI4
+LABELV $2313
+ADDRGP4 $2322
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 360
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492940
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+492940
+INDIRI4
+CNSTI4 0
+NEI4 $2323
+ADDRGP4 $2329
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492940
+ADDRLP4 364
+INDIRI4
+ASGNI4
+LABELV $2323
+ADDRGP4 $2332
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492944
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $2335
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492948
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $2338
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492952
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $2341
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 376
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492956
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $2344
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492960
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $2347
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492964
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $2350
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492968
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $2353
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492972
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $2356
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492884
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $2359
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492888
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $2362
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492892
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $2365
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492896
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $2368
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493520
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $2371
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493524
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $2374
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493528
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $2377
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493532
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $2380
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493536
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $2383
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492976
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $2386
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492980
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $2389
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492988
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $2392
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 444
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492984
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $2395
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 448
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492992
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $2398
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 452
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492996
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $2401
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493032
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $2404
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493036
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $2407
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 464
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493040
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $2410
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493044
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $2413
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493048
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $2416
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493228
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $2419
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 480
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493232
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $2422
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 484
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493236
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $2425
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 488
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493004
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2426
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2430
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 492
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664
+ADDP4
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2433
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+16
+ADDP4
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2437
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+32
+ADDP4
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2441
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+48
+ADDP4
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2445
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 508
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+64
+ADDP4
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2449
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 512
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+96
+ADDP4
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2453
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 516
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+80
+ADDP4
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2457
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 520
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+112
+ADDP4
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2461
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 524
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492664+128
+ADDP4
+ADDRLP4 524
+INDIRI4
+ASGNI4
+LABELV $2427
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2426
+CNSTI4 15
+ARGI4
+ADDRLP4 492
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 492
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2468
+JUMPV
+LABELV $2465
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemSounds
+CALLV
+pop
+LABELV $2466
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2468
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $2465
+ADDRGP4 cg+1331596
+CNSTI4 -999
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $2470
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $2474
+ADDRLP4 0
+INDIRI4
+CNSTI4 274
+ADDI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 496
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 496
+INDIRP4
+ASGNP4
+ADDRGP4 $2475
+JUMPV
+LABELV $2474
+ADDRLP4 0
+INDIRI4
+CNSTI4 274
+ADDI4
+ARGI4
+ADDRLP4 496
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 496
+INDIRP4
+ASGNP4
+LABELV $2475
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2477
+ADDRGP4 $2472
+JUMPV
+LABELV $2477
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $2479
+ADDRGP4 $2471
+JUMPV
+LABELV $2479
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $2484
+ARGP4
+ADDRLP4 500
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2484
+ARGP4
+ADDRLP4 500
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 504
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 504
+INDIRI4
+CNSTI4 0
+NEI4 $2482
+ADDRGP4 cg+1331596
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $2486
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2482
+ADDRGP4 $2487
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+46388
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2471
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $2470
+LABELV $2472
+ADDRGP4 $2491
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493240
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $2494
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493244
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $2497
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492644
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $2500
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 508
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492632
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $2503
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 512
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492636
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $2506
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 516
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492640
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $2509
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 520
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492820
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $2512
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 524
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492824
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $2515
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 528
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492828
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 $2518
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 532
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492832
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRGP4 $2521
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 536
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492836
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRGP4 $2524
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 540
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492840
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRGP4 $2527
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 544
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492844
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRGP4 $2530
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 548
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492848
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRGP4 $2533
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 552
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492852
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRGP4 $2536
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 556
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492856
+ADDRLP4 556
+INDIRI4
+ASGNI4
+ADDRGP4 $2539
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 560
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492860
+ADDRLP4 560
+INDIRI4
+ASGNI4
+ADDRGP4 $2542
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 564
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492864
+ADDRLP4 564
+INDIRI4
+ASGNI4
+ADDRGP4 $2545
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 568
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493248
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRGP4 $2548
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 572
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492868
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRGP4 $2551
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 576
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492872
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRGP4 $2554
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 580
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492876
+ADDRLP4 580
+INDIRI4
+ASGNI4
+ADDRGP4 $2557
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 584
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492880
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRGP4 $2560
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 588
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493572
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRGP4 $2563
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 592
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493576
+ADDRLP4 592
+INDIRI4
+ASGNI4
+ADDRGP4 $2566
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 596
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493580
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRGP4 $2569
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 600
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493584
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2570
+ADDRGP4 $2576
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 608
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 612
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493588
+ADDP4
+ADDRLP4 612
+INDIRI4
+ASGNI4
+LABELV $2571
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $2570
+ADDRGP4 $2580
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 604
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493588+24
+ADDRLP4 604
+INDIRI4
+ASGNI4
+ADDRGP4 $2584
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 608
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493588+28
+ADDRLP4 608
+INDIRI4
+ASGNI4
+ADDRGP4 $2587
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 612
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493552
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRGP4 $2590
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 616
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493556
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRGP4 $2593
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 620
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493560
+ADDRLP4 620
+INDIRI4
+ASGNI4
+ADDRGP4 $2596
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 624
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493564
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRGP4 $2599
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 628
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493568
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRGP4 $2602
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 632
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493620
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRGP4 $2605
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 636
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493624
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRGP4 $2608
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 640
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493628
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRGP4 $2580
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 644
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493632
+ADDRLP4 644
+INDIRI4
+ASGNI4
+LABELV $2228
+endproc CG_RegisterSounds 648 16
+proc CG_RegisterFonts 0 12
+ADDRGP4 $2612
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 cgs+632912+580312
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $2612
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 cgs+632912+601980
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $2612
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRGP4 cgs+632912+623648
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $2612
+ARGP4
+CNSTI4 48
+ARGI4
+ADDRGP4 cgs+632912+645316
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $2621
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 cgs+632912+558644
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $283
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 cgs+632912+536976
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $329
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 cgs+632912+515308
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $2628
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 cgs+632912+493640
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 cgs+632912+710328
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+688652
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+732004
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+753680
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+775356
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+818708
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+818712
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+818716
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+818720
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+818724
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+840396
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+797032
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+862072
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+883748
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+905424
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+927100
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+927100
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+948776
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+970452
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+992128
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1013804
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1035480
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1057156
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1078832
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1100508
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1122184
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1143860
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1165536
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1187212
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1208888
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1230564
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1273916
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1295592
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+710332
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+688656
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+732008
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+753684
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+775360
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+840400
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+797036
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+862076
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+883752
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+905428
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+927104
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+927104
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+948780
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+970456
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+992132
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1013808
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1035484
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1057160
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1078836
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1100512
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1122188
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1143864
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1165540
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1187216
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1208892
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1230568
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1273920
+CNSTI4 -100
+ASGNI4
+ADDRGP4 cgs+632912+1295596
+CNSTI4 -100
+ASGNI4
+ADDRGP4 CG_CheckFontUpdates
+CALLV
+pop
+ADDRGP4 cg+6747384
+CNSTI4 1
+ASGNI4
+LABELV $2611
+endproc CG_RegisterFonts 0 12
+data
+align 4
+LABELV $2755
+address $2756
+address $2757
+address $2758
+address $2759
+address $2760
+address $2761
+address $2762
+address $2763
+address $2764
+address $2765
+address $2766
+code
+proc CG_RegisterGraphics 1140 16
+ADDRGP4 cg+609412
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 cgs+39732
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 $2770
+ARGP4
+ADDRGP4 cgs+39732
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cgs+39732
+ARGP4
+ADDRGP4 trap_R_LoadWorldMap
+CALLV
+pop
+ADDRGP4 $2773
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2774
+ADDRLP4 264
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRGP4 $2755
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRGP4 cgs+632912+492172
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+LABELV $2775
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LTI4 $2774
+ADDRGP4 $2782
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492220
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $2786
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492220+4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $2790
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492220+8
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRGP4 $2794
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492220+12
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $2798
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492220+16
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $2801
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+476
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $2804
+ARGP4
+ADDRLP4 288
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+340
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $2807
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+344
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRGP4 $2810
+ARGP4
+ADDRLP4 296
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492460
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRGP4 $2813
+ARGP4
+ADDRLP4 300
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492464
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRGP4 $2816
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492468
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRGP4 $2819
+ARGP4
+ADDRLP4 308
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492472
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRGP4 $2822
+ARGP4
+ADDRLP4 312
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492136
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRGP4 $2825
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492140
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 $2828
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492144
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRGP4 $2831
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492164
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $2834
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492168
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRGP4 $2837
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492148
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $2838
+ADDRGP4 $2843
+ARGP4
+ADDRLP4 336
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492160
+ADDRLP4 336
+INDIRI4
+ASGNI4
+LABELV $2838
+ADDRGP4 $2846
+ARGP4
+ADDRLP4 336
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492156
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+492156
+INDIRI4
+CNSTI4 0
+NEI4 $2847
+ADDRGP4 $2853
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492156
+ADDRLP4 340
+INDIRI4
+ASGNI4
+LABELV $2847
+ADDRGP4 $2856
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492124
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $2859
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+468
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $2862
+ARGP4
+ADDRLP4 348
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492152
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $2865
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+480
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $2868
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+472
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $2869
+ADDRGP4 $2875
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 372
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 376
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492004
+ADDP4
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492004
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 360
+ARGP4
+ADDRLP4 364
+ARGP4
+ADDRGP4 trap_GetShaderImageDimensions
+CALLV
+pop
+ADDRLP4 380
+CNSTI4 64
+ASGNI4
+ADDRLP4 360
+INDIRI4
+ADDRLP4 380
+INDIRI4
+GTI4 $2880
+ADDRLP4 364
+INDIRI4
+ADDRLP4 380
+INDIRI4
+LEI4 $2878
+LABELV $2880
+ADDRGP4 $2881
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 360
+INDIRI4
+ARGI4
+ADDRLP4 364
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2879
+JUMPV
+LABELV $2878
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492004
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LSHI4
+ADDRGP4 cgs+632912+484
+ADDP4
+ARGP4
+ADDRGP4 trap_GetShaderImageData
+CALLV
+pop
+LABELV $2879
+LABELV $2870
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+LTI4 $2869
+ADDRGP4 CG_CreateNewCrosshairs
+CALLV
+pop
+ADDRGP4 $2888
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492128
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $2891
+ARGP4
+ADDRLP4 364
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492132
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $2894
+ARGP4
+ADDRLP4 368
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492392
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $2897
+ARGP4
+ADDRLP4 372
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492268
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $2900
+ARGP4
+ADDRLP4 376
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492276
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $2903
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492288
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $2906
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492292
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $2909
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492296
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $2912
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492300
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $2915
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492304
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $2918
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492280
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $2921
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492284
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $2924
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492308
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+EQI4 $2929
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $2925
+LABELV $2929
+ADDRGP4 $2932
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+16
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $2935
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+20
+ADDRLP4 416
+INDIRI4
+ASGNI4
+LABELV $2925
+ADDRGP4 $2938
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+24
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $2941
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+28
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $2944
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+32
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $2947
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+64
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $2951
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+64+4
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $2955
+ARGP4
+ADDRLP4 432
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+64+8
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $2958
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+76
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $2962
+ARGP4
+ADDRLP4 440
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+76+4
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $2966
+ARGP4
+ADDRLP4 444
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+76+8
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $2969
+ARGP4
+ADDRLP4 448
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+88
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+88+4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2951
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+88+8
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $2962
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+88+12
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $2982
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+88+16
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $2993
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $2993
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+EQI4 $2993
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $2993
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $2983
+LABELV $2993
+ADDRGP4 $2996
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+44
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $2999
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+36
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $3002
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+40
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $3005
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+56
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $3008
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+60
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $3011
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+48
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $3014
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+52
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $3017
+ARGP4
+ADDRLP4 492
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+108
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $3020
+ARGP4
+ADDRLP4 496
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+112
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $3023
+ARGP4
+ADDRLP4 500
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+116
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $3026
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+120
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $3029
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+124
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $3032
+ARGP4
+ADDRLP4 512
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+128
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $3035
+ARGP4
+ADDRLP4 516
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+132
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $3038
+ARGP4
+ADDRLP4 520
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+136
+ADDRLP4 520
+INDIRI4
+ASGNI4
+LABELV $2983
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $3043
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $3039
+LABELV $3043
+LABELV $3039
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 7
+EQI4 $3048
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $3044
+LABELV $3048
+ADDRGP4 $3051
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492360
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $3054
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+140
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $3057
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+144
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $3060
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+148
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $3063
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+152
+ADDRLP4 480
+INDIRI4
+ASGNI4
+LABELV $3044
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+EQI4 $3069
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $3069
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $3064
+LABELV $3069
+ADDRGP4 $3072
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+156
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $3075
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+160
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $3078
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+164
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $3081
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+168
+ADDRLP4 476
+INDIRI4
+ASGNI4
+LABELV $3064
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+EQI4 $3086
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $3082
+LABELV $3086
+ADDRGP4 $3089
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+172
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $3092
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+176
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $3095
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+180
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $3098
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+184
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $3101
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+188
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $3104
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+192
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $3107
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+196
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $3110
+ARGP4
+ADDRLP4 492
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+200
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $3113
+ARGP4
+ADDRLP4 496
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+204
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $3116
+ARGP4
+ADDRLP4 500
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+208
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $3119
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+212
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $3122
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+216
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $3125
+ARGP4
+ADDRLP4 512
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+220
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $3128
+ARGP4
+ADDRLP4 516
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+224
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $3131
+ARGP4
+ADDRLP4 520
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+228
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $3134
+ARGP4
+ADDRLP4 524
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+232
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $3137
+ARGP4
+ADDRLP4 528
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+236
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 $3140
+ARGP4
+ADDRLP4 532
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+240
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRGP4 $3143
+ARGP4
+ADDRLP4 536
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+244
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRGP4 $3146
+ARGP4
+ADDRLP4 540
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+248
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRGP4 $3149
+ARGP4
+ADDRLP4 544
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+252
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRGP4 $3152
+ARGP4
+ADDRLP4 548
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+256
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRGP4 $3155
+ARGP4
+ADDRLP4 552
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+260
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRGP4 $3158
+ARGP4
+ADDRLP4 556
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+264
+ADDRLP4 556
+INDIRI4
+ASGNI4
+ADDRGP4 $3161
+ARGP4
+ADDRLP4 560
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+268
+ADDRLP4 560
+INDIRI4
+ASGNI4
+LABELV $3082
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $3162
+ADDRGP4 $3089
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+172
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $3092
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+176
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $3095
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+180
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $3098
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+184
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $3175
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+280
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $3178
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+288
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $3181
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+292
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $3184
+ARGP4
+ADDRLP4 492
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+296
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $3187
+ARGP4
+ADDRLP4 496
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+300
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $3190
+ARGP4
+ADDRLP4 500
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+304
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $3014
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317472
+ADDRLP4 504
+INDIRI4
+ASGNI4
+LABELV $3162
+ADDRGP4 $3195
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+272
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $3198
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+276
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $3175
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+280
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $3203
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+284
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $3206
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492312
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $2924
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492440
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $3211
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+336
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 492
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 496
+CNSTI4 0
+ASGNI4
+ADDRLP4 492
+INDIRI4
+ADDRLP4 496
+INDIRI4
+NEI4 $3216
+ADDRGP4 cg_buildScript+12
+INDIRI4
+ADDRLP4 496
+INDIRI4
+EQI4 $3212
+LABELV $3216
+ADDRGP4 $3219
+ARGP4
+ADDRLP4 500
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+424
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+424
+INDIRI4
+CNSTI4 0
+NEI4 $3220
+ADDRGP4 $3224
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3227
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+424
+ADDRLP4 504
+INDIRI4
+ASGNI4
+LABELV $3220
+ADDRGP4 $3230
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+428
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $3233
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+432
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $3236
+ARGP4
+ADDRLP4 512
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492272
+ADDRLP4 512
+INDIRI4
+ASGNI4
+LABELV $3212
+ADDRGP4 $3239
+ARGP4
+ADDRLP4 500
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+440
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $3242
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+444
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $3245
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+448
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $3248
+ARGP4
+ADDRLP4 512
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+452
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $3251
+ARGP4
+ADDRLP4 516
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+456
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $3254
+ARGP4
+ADDRLP4 520
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+460
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $3255
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3258
+ADDRGP4 $3264
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 528
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 528
+INDIRP4
+ARGP4
+ADDRLP4 532
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492320
+ADDP4
+ADDRLP4 532
+INDIRI4
+ASGNI4
+LABELV $3259
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $3258
+ADDRGP4 $3267
+ARGP4
+ADDRLP4 524
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+436
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $3270
+ARGP4
+ADDRLP4 528
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492576
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+492576
+INDIRI4
+CNSTI4 0
+NEI4 $3271
+ADDRGP4 $3277
+ARGP4
+ADDRLP4 532
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492576
+ADDRLP4 532
+INDIRI4
+ASGNI4
+LABELV $3271
+LABELV $3255
+ADDRGP4 $3280
+ARGP4
+ADDRLP4 524
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+308
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $3283
+ARGP4
+ADDRLP4 528
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+312
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 $3286
+ARGP4
+ADDRLP4 532
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+316
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRGP4 $3289
+ARGP4
+ADDRLP4 536
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+320
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRGP4 $3292
+ARGP4
+ADDRLP4 540
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+324
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRGP4 $3295
+ARGP4
+ADDRLP4 544
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+328
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRGP4 $3298
+ARGP4
+ADDRLP4 548
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+332
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRGP4 $3301
+ARGP4
+ADDRLP4 552
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+404
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRGP4 $3304
+ARGP4
+ADDRLP4 556
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+408
+ADDRLP4 556
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $3305
+ADDRGP4 $3310
+ARGP4
+ADDRLP4 560
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+392
+ADDRLP4 560
+INDIRI4
+ASGNI4
+ADDRGP4 $3313
+ARGP4
+ADDRLP4 564
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+396
+ADDRLP4 564
+INDIRI4
+ASGNI4
+LABELV $3305
+ADDRGP4 $3316
+ARGP4
+ADDRLP4 560
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+348
+ADDRLP4 560
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+348
+INDIRI4
+CNSTI4 0
+NEI4 $3317
+ADDRGP4 $3323
+ARGP4
+ADDRLP4 564
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+348
+ADDRLP4 564
+INDIRI4
+ASGNI4
+LABELV $3317
+ADDRGP4 $3326
+ARGP4
+ADDRLP4 564
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+352
+ADDRLP4 564
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+352
+INDIRI4
+CNSTI4 0
+NEI4 $3327
+ADDRGP4 $3333
+ARGP4
+ADDRLP4 568
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+352
+ADDRLP4 568
+INDIRI4
+ASGNI4
+LABELV $3327
+ADDRGP4 $3336
+ARGP4
+ADDRLP4 568
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+356
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+356
+INDIRI4
+CNSTI4 0
+NEI4 $3337
+ADDRGP4 $3343
+ARGP4
+ADDRLP4 572
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+356
+ADDRLP4 572
+INDIRI4
+ASGNI4
+LABELV $3337
+ADDRGP4 $3346
+ARGP4
+ADDRLP4 572
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+360
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+360
+INDIRI4
+CNSTI4 0
+NEI4 $3347
+ADDRGP4 $3353
+ARGP4
+ADDRLP4 576
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+360
+ADDRLP4 576
+INDIRI4
+ASGNI4
+LABELV $3347
+ADDRGP4 $3356
+ARGP4
+ADDRLP4 576
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+364
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+364
+INDIRI4
+CNSTI4 0
+NEI4 $3357
+ADDRGP4 $3363
+ARGP4
+ADDRLP4 580
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+364
+ADDRLP4 580
+INDIRI4
+ASGNI4
+LABELV $3357
+ADDRGP4 $3366
+ARGP4
+ADDRLP4 580
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+368
+ADDRLP4 580
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+368
+INDIRI4
+CNSTI4 0
+NEI4 $3367
+ADDRGP4 $3373
+ARGP4
+ADDRLP4 584
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+368
+ADDRLP4 584
+INDIRI4
+ASGNI4
+LABELV $3367
+ADDRGP4 $3376
+ARGP4
+ADDRLP4 584
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+372
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+372
+INDIRI4
+CNSTI4 0
+NEI4 $3377
+ADDRGP4 $3383
+ARGP4
+ADDRLP4 588
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+372
+ADDRLP4 588
+INDIRI4
+ASGNI4
+LABELV $3377
+ADDRGP4 $3386
+ARGP4
+ADDRLP4 588
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+376
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+376
+INDIRI4
+CNSTI4 0
+NEI4 $3387
+ADDRGP4 $3393
+ARGP4
+ADDRLP4 592
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+376
+ADDRLP4 592
+INDIRI4
+ASGNI4
+LABELV $3387
+ADDRGP4 $3396
+ARGP4
+ADDRLP4 592
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+380
+ADDRLP4 592
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+380
+INDIRI4
+CNSTI4 0
+NEI4 $3397
+ADDRGP4 $3403
+ARGP4
+ADDRLP4 596
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+380
+ADDRLP4 596
+INDIRI4
+ASGNI4
+LABELV $3397
+ADDRGP4 $3406
+ARGP4
+ADDRLP4 596
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+384
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+384
+INDIRI4
+CNSTI4 0
+NEI4 $3407
+ADDRGP4 $3413
+ARGP4
+ADDRLP4 600
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+384
+ADDRLP4 600
+INDIRI4
+ASGNI4
+LABELV $3407
+ADDRGP4 $3416
+ARGP4
+ADDRLP4 600
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+388
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRGP4 $3304
+ARGP4
+ADDRLP4 604
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+400
+ADDRLP4 604
+INDIRI4
+ASGNI4
+ADDRGP4 $3421
+ARGP4
+ADDRLP4 608
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+464
+ADDRLP4 608
+INDIRI4
+ASGNI4
+ADDRGP4 $3424
+ARGP4
+ADDRLP4 612
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492372
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+492372
+INDIRI4
+CNSTI4 0
+NEI4 $3425
+ADDRGP4 $3431
+ARGP4
+ADDRLP4 616
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492372
+ADDRLP4 616
+INDIRI4
+ASGNI4
+LABELV $3425
+ADDRGP4 cgs+632912+492372
+INDIRI4
+CNSTI4 0
+NEI4 $3432
+ADDRGP4 $3436
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3439
+ARGP4
+ADDRLP4 616
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492372
+ADDRLP4 616
+INDIRI4
+ASGNI4
+LABELV $3432
+ADDRGP4 $3442
+ARGP4
+ADDRLP4 616
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492332
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRGP4 $3445
+ARGP4
+ADDRLP4 620
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492336
+ADDRLP4 620
+INDIRI4
+ASGNI4
+ADDRGP4 $3448
+ARGP4
+ADDRLP4 624
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492340
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRGP4 $3451
+ARGP4
+ADDRLP4 628
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492376
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRGP4 $3454
+ARGP4
+ADDRLP4 632
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492384
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRGP4 $3457
+ARGP4
+ADDRLP4 636
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492388
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRGP4 $3460
+ARGP4
+ADDRLP4 640
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492396
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRGP4 $3463
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492400
+ADDRLP4 644
+INDIRI4
+ASGNI4
+ADDRGP4 $3466
+ARGP4
+ADDRLP4 648
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492404
+ADDRLP4 648
+INDIRI4
+ASGNI4
+ADDRGP4 $3469
+ARGP4
+ADDRLP4 652
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492408
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRGP4 $3472
+ARGP4
+ADDRLP4 656
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492412
+ADDRLP4 656
+INDIRI4
+ASGNI4
+ADDRGP4 $3475
+ARGP4
+ADDRLP4 660
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492416
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRGP4 $3478
+ARGP4
+ADDRLP4 664
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492420
+ADDRLP4 664
+INDIRI4
+ASGNI4
+ADDRGP4 $3481
+ARGP4
+ADDRLP4 668
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492424
+ADDRLP4 668
+INDIRI4
+ASGNI4
+ADDRGP4 $3484
+ARGP4
+ADDRLP4 672
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492428
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRGP4 $3487
+ARGP4
+ADDRLP4 676
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492432
+ADDRLP4 676
+INDIRI4
+ASGNI4
+ADDRGP4 $3490
+ARGP4
+ADDRLP4 680
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492436
+ADDRLP4 680
+INDIRI4
+ASGNI4
+ADDRGP4 $3493
+ARGP4
+ADDRLP4 684
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492444
+ADDRLP4 684
+INDIRI4
+ASGNI4
+ADDRGP4 $3496
+ARGP4
+ADDRLP4 688
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492448
+ADDRLP4 688
+INDIRI4
+ASGNI4
+ADDRGP4 $3499
+ARGP4
+ADDRLP4 692
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492476
+ADDRLP4 692
+INDIRI4
+ASGNI4
+ADDRGP4 $3502
+ARGP4
+ADDRLP4 696
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492480
+ADDRLP4 696
+INDIRI4
+ASGNI4
+ADDRGP4 $3505
+ARGP4
+ADDRLP4 700
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492484
+ADDRLP4 700
+INDIRI4
+ASGNI4
+ADDRGP4 $3508
+ARGP4
+ADDRLP4 704
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492488
+ADDRLP4 704
+INDIRI4
+ASGNI4
+ADDRGP4 $3511
+ARGP4
+ADDRLP4 708
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492492
+ADDRLP4 708
+INDIRI4
+ASGNI4
+ADDRGP4 $3514
+ARGP4
+ADDRLP4 712
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492496
+ADDRLP4 712
+INDIRI4
+ASGNI4
+ADDRGP4 $3517
+ARGP4
+ADDRLP4 716
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492500
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRGP4 $3520
+ARGP4
+ADDRLP4 720
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492504
+ADDRLP4 720
+INDIRI4
+ASGNI4
+ADDRGP4 $3523
+ARGP4
+ADDRLP4 724
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492512
+ADDRLP4 724
+INDIRI4
+ASGNI4
+ADDRGP4 $3526
+ARGP4
+ADDRLP4 728
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492516
+ADDRLP4 728
+INDIRI4
+ASGNI4
+ADDRGP4 $3529
+ARGP4
+ADDRLP4 732
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492520
+ADDRLP4 732
+INDIRI4
+ASGNI4
+ADDRGP4 $3532
+ARGP4
+ADDRLP4 736
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492524
+ADDRLP4 736
+INDIRI4
+ASGNI4
+ADDRGP4 $3535
+ARGP4
+ADDRLP4 740
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492528
+ADDRLP4 740
+INDIRI4
+ASGNI4
+ADDRGP4 $3538
+ARGP4
+ADDRLP4 744
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492532
+ADDRLP4 744
+INDIRI4
+ASGNI4
+ADDRGP4 $3541
+ARGP4
+ADDRLP4 748
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492536
+ADDRLP4 748
+INDIRI4
+ASGNI4
+ADDRGP4 $3544
+ARGP4
+ADDRLP4 752
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492540
+ADDRLP4 752
+INDIRI4
+ASGNI4
+ADDRGP4 $3547
+ARGP4
+ADDRLP4 756
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492548
+ADDRLP4 756
+INDIRI4
+ASGNI4
+ADDRGP4 $3550
+ARGP4
+ADDRLP4 760
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492544
+ADDRLP4 760
+INDIRI4
+ASGNI4
+ADDRGP4 $3553
+ARGP4
+ADDRLP4 764
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492508
+ADDRLP4 764
+INDIRI4
+ASGNI4
+ADDRGP4 $3556
+ARGP4
+ADDRLP4 768
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492552
+ADDRLP4 768
+INDIRI4
+ASGNI4
+ADDRGP4 $3559
+ARGP4
+ADDRLP4 772
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492556
+ADDRLP4 772
+INDIRI4
+ASGNI4
+ADDRGP4 $3562
+ARGP4
+ADDRLP4 776
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492560
+ADDRLP4 776
+INDIRI4
+ASGNI4
+ADDRGP4 $3565
+ARGP4
+ADDRLP4 780
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492564
+ADDRLP4 780
+INDIRI4
+ASGNI4
+ADDRGP4 $3568
+ARGP4
+ADDRLP4 784
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492568
+ADDRLP4 784
+INDIRI4
+ASGNI4
+ADDRGP4 $3571
+ARGP4
+ADDRLP4 788
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492572
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRGP4 $3574
+ARGP4
+ADDRLP4 792
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492452
+ADDRLP4 792
+INDIRI4
+ASGNI4
+ADDRGP4 $3577
+ARGP4
+ADDRLP4 796
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492456
+ADDRLP4 796
+INDIRI4
+ASGNI4
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6144
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2112
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3578
+ADDRGP4 $3583
+ARGP4
+ADDRLP4 800
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+LABELV $3579
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $3578
+CNSTI4 15
+ARGI4
+ADDRLP4 800
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 800
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3587
+JUMPV
+LABELV $3584
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+EQI4 $3595
+ADDRLP4 808
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_buildScript+12
+INDIRI4
+ADDRLP4 808
+INDIRI4
+NEI4 $3595
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 808
+INDIRI4
+NEI4 $3595
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $3588
+LABELV $3595
+ADDRLP4 812
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 812
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $3598
+ARGP4
+ADDRLP4 816
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 816
+INDIRI4
+CNSTI4 0
+NEI4 $3596
+ADDRGP4 cgs+1969984
+ADDRLP4 812
+INDIRP4
+ASGNP4
+ADDRGP4 $3597
+JUMPV
+LABELV $3596
+ADDRLP4 812
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $3602
+ARGP4
+ADDRLP4 820
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 820
+INDIRI4
+CNSTI4 0
+NEI4 $3600
+ADDRGP4 cgs+1969980
+ADDRLP4 812
+INDIRP4
+ASGNP4
+ADDRGP4 $3601
+JUMPV
+LABELV $3600
+ADDRLP4 812
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $3606
+ARGP4
+ADDRLP4 824
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 824
+INDIRI4
+CNSTI4 0
+NEI4 $3604
+ADDRGP4 cgs+1969976
+ADDRLP4 812
+INDIRP4
+ASGNP4
+LABELV $3604
+LABELV $3601
+LABELV $3597
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingItem
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+LABELV $3588
+LABELV $3585
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3587
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $3584
+ADDRGP4 $3610
+ARGP4
+ADDRLP4 804
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492252
+ADDRLP4 804
+INDIRI4
+ASGNI4
+ADDRGP4 $3613
+ARGP4
+ADDRLP4 808
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492256
+ADDRLP4 808
+INDIRI4
+ASGNI4
+ADDRGP4 $3616
+ARGP4
+ADDRLP4 812
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492260
+ADDRLP4 812
+INDIRI4
+ASGNI4
+ADDRGP4 $3619
+ARGP4
+ADDRLP4 816
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492264
+ADDRLP4 816
+INDIRI4
+ASGNI4
+ADDRGP4 $3622
+ARGP4
+ADDRLP4 820
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492216
+ADDRLP4 820
+INDIRI4
+ASGNI4
+ADDRGP4 $3625
+ARGP4
+ADDRLP4 824
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492240
+ADDRLP4 824
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $3626
+ADDRGP4 $3631
+ARGP4
+ADDRLP4 828
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492248
+ADDRLP4 828
+INDIRI4
+ASGNI4
+LABELV $3626
+ADDRGP4 $3634
+ARGP4
+ADDRLP4 828
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492244
+ADDRLP4 828
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632912+492244
+INDIRI4
+CNSTI4 0
+NEI4 $3635
+ADDRGP4 $3641
+ARGP4
+ADDRLP4 832
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492244
+ADDRLP4 832
+INDIRI4
+ASGNI4
+LABELV $3635
+ADDRLP4 832
+ADDRGP4 trap_CM_NumInlineModels
+CALLI4
+ASGNI4
+ADDRGP4 cgs+47412
+ADDRLP4 832
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3646
+JUMPV
+LABELV $3643
+ADDRLP4 864
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 $3648
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 864
+ARGP4
+ADDRLP4 876
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+47416
+ADDP4
+ADDRLP4 876
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+47416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 840
+ARGP4
+ADDRLP4 852
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 836
+CNSTI4 0
+ASGNI4
+LABELV $3651
+ADDRLP4 880
+ADDRLP4 836
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 884
+ADDRLP4 880
+INDIRI4
+ADDRLP4 840
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 880
+INDIRI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+48440
+ADDP4
+ADDP4
+ADDRLP4 884
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 880
+INDIRI4
+ADDRLP4 852
+ADDP4
+INDIRF4
+ADDRLP4 884
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3652
+ADDRLP4 836
+ADDRLP4 836
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 836
+INDIRI4
+CNSTI4 3
+LTI4 $3651
+LABELV $3644
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3646
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+47412
+INDIRI4
+LTI4 $3643
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $3656
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+ADDI4
+ARGI4
+ADDRLP4 840
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 836
+ADDRLP4 840
+INDIRP4
+ASGNP4
+ADDRLP4 836
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3660
+ADDRGP4 $3658
+JUMPV
+LABELV $3660
+ADDRLP4 836
+INDIRP4
+ARGP4
+ADDRLP4 844
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+45364
+ADDP4
+ADDRLP4 844
+INDIRI4
+ASGNI4
+ADDRGP4 $3663
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 836
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 836
+INDIRP4
+ARGP4
+ADDRGP4 $3008
+ARGP4
+ADDRLP4 848
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 848
+INDIRI4
+CNSTI4 0
+NEI4 $3664
+ADDRGP4 cgs+1957808
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957812
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $3665
+JUMPV
+LABELV $3664
+ADDRLP4 836
+INDIRP4
+ARGP4
+ADDRGP4 $3670
+ARGP4
+ADDRLP4 852
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 852
+INDIRI4
+CNSTI4 0
+NEI4 $3668
+ADDRGP4 cgs+1957800
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $3669
+JUMPV
+LABELV $3668
+ADDRLP4 836
+INDIRP4
+ARGP4
+ADDRGP4 $3674
+ARGP4
+ADDRLP4 856
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 856
+INDIRI4
+CNSTI4 0
+NEI4 $3672
+ADDRGP4 cgs+1957804
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $3672
+LABELV $3669
+LABELV $3665
+LABELV $3657
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $3656
+LABELV $3658
+ADDRGP4 $3678
+ARGP4
+ADDRLP4 836
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493472
+ADDRLP4 836
+INDIRI4
+ASGNI4
+ADDRGP4 $3681
+ARGP4
+ADDRLP4 840
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493476
+ADDRLP4 840
+INDIRI4
+ASGNI4
+ADDRGP4 $3684
+ARGP4
+ADDRLP4 844
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493480
+ADDRLP4 844
+INDIRI4
+ASGNI4
+ADDRGP4 $3687
+ARGP4
+ADDRLP4 848
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493484
+ADDRLP4 848
+INDIRI4
+ASGNI4
+ADDRGP4 $3690
+ARGP4
+ADDRLP4 852
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493488
+ADDRLP4 852
+INDIRI4
+ASGNI4
+ADDRGP4 $3693
+ARGP4
+ADDRLP4 856
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493492
+ADDRLP4 856
+INDIRI4
+ASGNI4
+ADDRGP4 $3696
+ARGP4
+ADDRLP4 860
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493496
+ADDRLP4 860
+INDIRI4
+ASGNI4
+ADDRGP4 $3699
+ARGP4
+ADDRLP4 864
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493500
+ADDRLP4 864
+INDIRI4
+ASGNI4
+ADDRGP4 $3702
+ARGP4
+ADDRLP4 868
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493540
+ADDRLP4 868
+INDIRI4
+ASGNI4
+ADDRGP4 $3705
+ARGP4
+ADDRLP4 872
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493548
+ADDRLP4 872
+INDIRI4
+ASGNI4
+ADDRGP4 $3708
+ARGP4
+ADDRLP4 876
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493544
+ADDRLP4 876
+INDIRI4
+ASGNI4
+ADDRGP4 $3711
+ARGP4
+ADDRLP4 880
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493504
+ADDRLP4 880
+INDIRI4
+ASGNI4
+ADDRGP4 $3715
+ARGP4
+ADDRLP4 884
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493504+4
+ADDRLP4 884
+INDIRI4
+ASGNI4
+ADDRGP4 $3719
+ARGP4
+ADDRLP4 888
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+493504+8
+ADDRLP4 888
+INDIRI4
+ASGNI4
+ADDRGP4 $3722
+ARGP4
+ADDRLP4 892
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492580
+ADDRLP4 892
+INDIRI4
+ASGNI4
+ADDRGP4 $3725
+ARGP4
+ADDRLP4 896
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492584
+ADDRLP4 896
+INDIRI4
+ASGNI4
+ADDRGP4 $3728
+ARGP4
+ADDRLP4 900
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492588
+ADDRLP4 900
+INDIRI4
+ASGNI4
+ADDRGP4 $3731
+ARGP4
+ADDRLP4 904
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492592
+ADDRLP4 904
+INDIRI4
+ASGNI4
+ADDRGP4 $3734
+ARGP4
+ADDRLP4 908
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492596
+ADDRLP4 908
+INDIRI4
+ASGNI4
+ADDRGP4 $3737
+ARGP4
+ADDRLP4 912
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492600
+ADDRLP4 912
+INDIRI4
+ASGNI4
+ADDRGP4 $3740
+ARGP4
+ADDRLP4 916
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492604
+ADDRLP4 916
+INDIRI4
+ASGNI4
+ADDRGP4 $3743
+ARGP4
+ADDRLP4 920
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492608
+ADDRLP4 920
+INDIRI4
+ASGNI4
+ADDRGP4 $3746
+ARGP4
+ADDRLP4 924
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492612
+ADDRLP4 924
+INDIRI4
+ASGNI4
+ADDRGP4 $3749
+ARGP4
+ADDRLP4 928
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492616
+ADDRLP4 928
+INDIRI4
+ASGNI4
+ADDRGP4 $3752
+ARGP4
+ADDRLP4 932
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492620
+ADDRLP4 932
+INDIRI4
+ASGNI4
+ADDRGP4 $3755
+ARGP4
+ADDRLP4 936
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492624
+ADDRLP4 936
+INDIRI4
+ASGNI4
+ADDRGP4 $3758
+ARGP4
+ADDRLP4 940
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492628
+ADDRLP4 940
+INDIRI4
+ASGNI4
+ADDRGP4 $3761
+ARGP4
+ADDRLP4 944
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317376
+ADDRLP4 944
+INDIRI4
+ASGNI4
+ADDRGP4 $3764
+ARGP4
+ADDRLP4 948
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317380
+ADDRLP4 948
+INDIRI4
+ASGNI4
+ADDRGP4 $3767
+ARGP4
+ADDRLP4 952
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317384
+ADDRLP4 952
+INDIRI4
+ASGNI4
+ADDRGP4 $3770
+ARGP4
+ADDRLP4 956
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317388
+ADDRLP4 956
+INDIRI4
+ASGNI4
+ADDRGP4 $3773
+ARGP4
+ADDRLP4 960
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317392
+ADDRLP4 960
+INDIRI4
+ASGNI4
+ADDRGP4 $3776
+ARGP4
+ADDRLP4 964
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317276
+ADDRLP4 964
+INDIRI4
+ASGNI4
+ADDRGP4 $3780
+ARGP4
+ADDRLP4 968
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317276+4
+ADDRLP4 968
+INDIRI4
+ASGNI4
+ADDRGP4 $3784
+ARGP4
+ADDRLP4 972
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317276+12
+ADDRLP4 972
+INDIRI4
+ASGNI4
+ADDRGP4 $3788
+ARGP4
+ADDRLP4 976
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317276+16
+ADDRLP4 976
+INDIRI4
+ASGNI4
+ADDRGP4 $3792
+ARGP4
+ADDRLP4 980
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317276+20
+ADDRLP4 980
+INDIRI4
+ASGNI4
+ADDRGP4 $3277
+ARGP4
+ADDRLP4 984
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317276+36
+ADDRLP4 984
+INDIRI4
+ASGNI4
+ADDRGP4 $3799
+ARGP4
+ADDRLP4 988
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317276+24
+ADDRLP4 988
+INDIRI4
+ASGNI4
+ADDRGP4 $3803
+ARGP4
+ADDRLP4 992
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317276+32
+ADDRLP4 992
+INDIRI4
+ASGNI4
+ADDRGP4 $3807
+ARGP4
+ADDRLP4 996
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317276+40
+ADDRLP4 996
+INDIRI4
+ASGNI4
+ADDRGP4 $3811
+ARGP4
+ADDRLP4 1000
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317276+44
+ADDRLP4 1000
+INDIRI4
+ASGNI4
+ADDRGP4 $3815
+ARGP4
+ADDRLP4 1004
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317276+48
+ADDRLP4 1004
+INDIRI4
+ASGNI4
+ADDRGP4 $3819
+ARGP4
+ADDRLP4 1008
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317276+8
+ADDRLP4 1008
+INDIRI4
+ASGNI4
+ADDRGP4 $3822
+ARGP4
+ADDRLP4 1012
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317348
+ADDRLP4 1012
+INDIRI4
+ASGNI4
+ADDRGP4 $3825
+ARGP4
+ADDRLP4 1016
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317352
+ADDRLP4 1016
+INDIRI4
+ASGNI4
+ADDRGP4 $3828
+ARGP4
+ADDRLP4 1020
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317356
+ADDRLP4 1020
+INDIRI4
+ASGNI4
+ADDRGP4 $3831
+ARGP4
+ADDRLP4 1024
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317360
+ADDRLP4 1024
+INDIRI4
+ASGNI4
+ADDRGP4 $3834
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317364
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRGP4 $3837
+ARGP4
+ADDRLP4 1032
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317368
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 $3840
+ARGP4
+ADDRLP4 1036
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317372
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 $3843
+ARGP4
+ADDRLP4 1040
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317396
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRGP4 $3846
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317400
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRGP4 $3849
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317404
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRGP4 $3852
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317408
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRGP4 $3855
+ARGP4
+ADDRLP4 1056
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317412
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRGP4 $3858
+ARGP4
+ADDRLP4 1060
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317416
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRGP4 $3861
+ARGP4
+ADDRLP4 1064
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317420
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRGP4 $3864
+ARGP4
+ADDRLP4 1068
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317424
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRGP4 $3867
+ARGP4
+ADDRLP4 1072
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317428
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRGP4 $3870
+ARGP4
+ADDRLP4 1076
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317432
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRGP4 $3873
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317436
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 $3876
+ARGP4
+ADDRLP4 1084
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317440
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRGP4 $3879
+ARGP4
+ADDRLP4 1088
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317444
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRGP4 $3882
+ARGP4
+ADDRLP4 1092
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317448
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRGP4 $3885
+ARGP4
+ADDRLP4 1096
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317452
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRGP4 $3888
+ARGP4
+ADDRLP4 1100
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317456
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRGP4 $3891
+ARGP4
+ADDRLP4 1104
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317460
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRGP4 $3894
+ARGP4
+ADDRLP4 1108
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317464
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $3897
+ARGP4
+ADDRLP4 1112
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317468
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+ADDRGP4 $3900
+ARGP4
+ADDRLP4 1116
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317476
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRGP4 $3903
+ARGP4
+ADDRLP4 1120
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317500
+ADDRLP4 1120
+INDIRI4
+ASGNI4
+ADDRGP4 $3906
+ARGP4
+ADDRLP4 1124
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317504
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRGP4 $3909
+ARGP4
+ADDRLP4 1128
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317508
+ADDRLP4 1128
+INDIRI4
+ASGNI4
+ADDRGP4 $3912
+ARGP4
+ADDRLP4 1132
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317512
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRGP4 $3915
+ARGP4
+ADDRLP4 1136
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+1317516
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+LABELV $2754
+endproc CG_RegisterGraphics 1140 16
+export CG_BuildSpectatorString
+proc CG_BuildSpectatorString 1056 12
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1028
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3920
+JUMPV
+LABELV $3917
+ADDRLP4 1036
+CNSTI4 92
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $3923
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_spectatorListSkillRating+12
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+EQI4 $3925
+CNSTI4 4524
+ADDRLP4 1036
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2144
+ADDP4
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+EQI4 $3925
+ADDRLP4 1044
+CNSTI4 91
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+NEI4 $3925
+ADDRGP4 cgs+1957744
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+GEI4 $3925
+ADDRGP4 $3932
+ARGP4
+CNSTI4 4524
+ADDRLP4 1036
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $3925
+CNSTI4 4524
+ADDRLP4 1036
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3935
+ADDRGP4 $3939
+ARGP4
+CNSTI4 4524
+ADDRLP4 1036
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $3935
+ADDRGP4 $3942
+ARGP4
+CNSTI4 4524
+ADDRLP4 1036
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 cg_spectatorListScore+12
+INDIRI4
+CNSTI4 0
+EQI4 $3945
+ADDRGP4 $3948
+ARGP4
+ADDRLP4 1036
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $3945
+ADDRGP4 cg_spectatorListQue+12
+INDIRI4
+CNSTI4 0
+EQI4 $3949
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $3949
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $3949
+CNSTI4 4524
+ADDRLP4 1036
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2152
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3954
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $3958
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $3955
+JUMPV
+LABELV $3954
+ADDRGP4 $3959
+ARGP4
+CNSTI4 4524
+ADDRLP4 1036
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2156
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $3955
+LABELV $3949
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $3962
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $3923
+LABELV $3918
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3920
+ADDRLP4 1028
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $3917
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3964
+JUMPV
+LABELV $3963
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3966
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $3966
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $3966
+ADDRLP4 1040
+INDIRI4
+CNSTI4 65
+LTI4 $3969
+ADDRLP4 1040
+INDIRI4
+CNSTI4 90
+LEI4 $3968
+LABELV $3969
+ADDRLP4 1044
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 97
+LTI4 $3970
+ADDRLP4 1044
+INDIRI4
+CNSTI4 122
+LEI4 $3968
+LABELV $3970
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 48
+LTI4 $3966
+ADDRLP4 1048
+INDIRI4
+CNSTI4 57
+GTI4 $3966
+LABELV $3968
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $3971
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 120
+EQI4 $3976
+ADDRLP4 1052
+INDIRI4
+CNSTI4 88
+NEI4 $3974
+LABELV $3976
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $3967
+JUMPV
+LABELV $3974
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $3967
+JUMPV
+LABELV $3971
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $3967
+JUMPV
+LABELV $3966
+ADDRLP4 1052
+CNSTI4 1
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1052
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $3967
+LABELV $3964
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3963
+ADDRGP4 cg+617100
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $3977
+ADDRGP4 cg+617100
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+617100
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+618124
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 cg+618128
+CNSTF4 3212836864
+ASGNF4
+LABELV $3977
+LABELV $3916
+endproc CG_BuildSpectatorString 1056 12
+data
+align 4
+LABELV $3987
+address $3988
+address $3989
+address $3990
+align 4
+LABELV $3991
+address $211
+address $3992
+code
+proc CG_PrefetchPlayerModels 152 20
+ADDRLP4 104
+ADDRGP4 trap_GetNumPlayerInfos
+CALLI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3996
+JUMPV
+LABELV $3993
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_GetExtraPlayerInfo
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 108
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3997
+ADDRLP4 112
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 112
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $3998
+JUMPV
+LABELV $3997
+ADDRLP4 92
+ADDRGP4 $3999
+ASGNP4
+LABELV $3998
+ADDRLP4 28
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4000
+ADDRGP4 $3994
+JUMPV
+LABELV $4000
+ADDRLP4 4
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRGP4 $3999
+ASGNP4
+ADDRLP4 4+8
+ADDRGP4 $4004
+ASGNP4
+ADDRLP4 4+12
+ADDRGP4 $4006
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4010
+JUMPV
+LABELV $4007
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4014
+JUMPV
+LABELV $4011
+ADDRGP4 $4015
+ARGP4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 $3991
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 $3987
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 trap_FS_Prefetch
+CALLV
+pop
+ADDRGP4 $4016
+ARGP4
+ADDRLP4 120
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LSHI4
+ADDRGP4 $3991
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LSHI4
+ADDRGP4 $3987
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRGP4 trap_FS_Prefetch
+CALLV
+pop
+ADDRGP4 $4017
+ARGP4
+ADDRLP4 128
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ADDRGP4 $3991
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ADDRGP4 $3987
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 trap_FS_Prefetch
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4021
+JUMPV
+LABELV $4018
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $4022
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $4022
+ADDRGP4 $4019
+JUMPV
+LABELV $4022
+ADDRGP4 $4024
+ARGP4
+ADDRLP4 144
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LSHI4
+ADDRGP4 $3991
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LSHI4
+ADDRGP4 $3987
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRGP4 trap_FS_Prefetch
+CALLV
+pop
+LABELV $4019
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4021
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 4
+LTU4 $4018
+LABELV $4012
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4014
+ADDRLP4 20
+INDIRI4
+CVIU4 4
+CNSTU4 3
+LTU4 $4011
+LABELV $4008
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4010
+ADDRLP4 24
+INDIRI4
+CVIU4 4
+CNSTU4 2
+LTU4 $4007
+ADDRGP4 $4025
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 112
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRGP4 trap_FS_Prefetch
+CALLV
+pop
+ADDRGP4 $4026
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 trap_FS_Prefetch
+CALLV
+pop
+LABELV $3994
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3996
+ADDRLP4 96
+INDIRI4
+ADDRLP4 100
+INDIRI4
+LTI4 $3993
+LABELV $3986
+endproc CG_PrefetchPlayerModels 152 20
+proc CG_RegisterClients 4612 28
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $4028
+ADDRLP4 4600
+ADDRGP4 trap_GetNumPlayerInfos
+CALLI4
+ASGNI4
+ADDRLP4 4528
+ADDRLP4 4600
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4034
+JUMPV
+LABELV $4031
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4532
+ARGP4
+ADDRGP4 trap_GetExtraPlayerInfo
+CALLV
+pop
+ADDRGP4 $4035
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4532
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4532
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4604
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4596
+ADDRLP4 4604
+INDIRP4
+ASGNP4
+ADDRLP4 4596
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4036
+ADDRLP4 4608
+ADDRLP4 4596
+INDIRP4
+ASGNP4
+ADDRLP4 4596
+ADDRLP4 4608
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4608
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $4037
+JUMPV
+LABELV $4036
+ADDRLP4 4596
+ADDRGP4 $3999
+ASGNP4
+LABELV $4037
+ADDRLP4 4+196
+CNSTI4 3
+ASGNI4
+ADDRLP4 4+416
+ARGP4
+ADDRLP4 4532
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4+544
+ARGP4
+ADDRLP4 4532
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4532
+ARGP4
+ADDRGP4 CG_LoadingFutureClient
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 4532
+ARGP4
+ADDRLP4 4596
+INDIRP4
+ARGP4
+ADDRLP4 4532
+ARGP4
+ADDRLP4 4596
+INDIRP4
+ARGP4
+ADDRGP4 $211
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+pop
+LABELV $4032
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4034
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4528
+INDIRI4
+LTI4 $4031
+LABELV $4028
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingClient
+CALLV
+pop
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4045
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $4049
+ADDRGP4 $4046
+JUMPV
+LABELV $4049
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 4536
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4532
+ADDRLP4 4536
+INDIRP4
+ASGNP4
+ADDRLP4 4532
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4052
+ADDRGP4 $4046
+JUMPV
+LABELV $4052
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingClient
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+LABELV $4046
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $4045
+LABELV $4027
+endproc CG_RegisterClients 4612 28
+export CG_ConfigStringIndexToQ3
+proc CG_ConfigStringIndexToQ3 52 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 17
+LTI4 $4055
+ADDRLP4 4
+INDIRI4
+CNSTI4 273
+GEI4 $4055
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 17
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $4054
+JUMPV
+LABELV $4055
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 274
+LTI4 $4057
+ADDRLP4 8
+INDIRI4
+CNSTI4 529
+GEI4 $4057
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 274
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $4054
+JUMPV
+LABELV $4057
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 529
+LTI4 $4059
+ADDRLP4 12
+INDIRI4
+CNSTI4 593
+GEI4 $4059
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 529
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $4054
+JUMPV
+LABELV $4059
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 593
+LTI4 $4061
+ADDRLP4 16
+INDIRI4
+CNSTI4 657
+GEI4 $4061
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 593
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 608
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $4054
+JUMPV
+LABELV $4061
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 593
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $4091
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GTI4 $4094
+LABELV $4093
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $4063
+ADDRLP4 20
+INDIRI4
+CNSTI4 17
+GTI4 $4095
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4096
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4096
+address $4066
+address $4067
+address $4068
+address $4069
+address $4070
+address $4071
+address $4072
+address $4073
+address $4074
+address $4075
+address $4076
+address $4077
+address $4082
+address $4083
+address $4084
+address $4088
+address $4063
+address $4089
+code
+LABELV $4095
+ADDRLP4 20
+INDIRI4
+CNSTI4 274
+EQI4 $4090
+ADDRGP4 $4063
+JUMPV
+LABELV $4094
+ADDRLP4 40
+CNSTI4 665
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $4086
+ADDRLP4 20
+INDIRI4
+ADDRLP4 40
+INDIRI4
+GTI4 $4098
+LABELV $4097
+ADDRLP4 20
+INDIRI4
+CNSTI4 657
+EQI4 $4092
+ADDRLP4 20
+INDIRI4
+CNSTI4 658
+EQI4 $4085
+ADDRGP4 $4063
+JUMPV
+LABELV $4098
+ADDRLP4 20
+INDIRI4
+CNSTI4 983
+LTI4 $4063
+ADDRLP4 20
+INDIRI4
+CNSTI4 991
+GTI4 $4063
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4099-3932
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4099
+address $4080
+address $4063
+address $4081
+address $4063
+address $4078
+address $4063
+address $4079
+address $4063
+address $4087
+code
+LABELV $4066
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4067
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4068
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4069
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4070
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4071
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4072
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4073
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4074
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4075
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4076
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4077
+ADDRLP4 0
+CNSTI4 11
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4078
+ADDRLP4 0
+CNSTI4 12
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4079
+ADDRLP4 0
+CNSTI4 14
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4080
+ADDRLP4 0
+CNSTI4 16
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4081
+ADDRLP4 0
+CNSTI4 18
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4082
+ADDRLP4 0
+CNSTI4 20
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4083
+ADDRLP4 0
+CNSTI4 21
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4084
+ADDRLP4 0
+CNSTI4 22
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4085
+ADDRLP4 0
+CNSTI4 23
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4086
+ADDRLP4 0
+CNSTI4 24
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4087
+ADDRLP4 0
+CNSTI4 25
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4088
+ADDRLP4 0
+CNSTI4 27
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4089
+ADDRLP4 0
+CNSTI4 32
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4090
+ADDRLP4 0
+CNSTI4 288
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4091
+ADDRLP4 0
+CNSTI4 608
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4092
+ADDRLP4 0
+CNSTI4 672
+ASGNI4
+ADDRGP4 $4064
+JUMPV
+LABELV $4063
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $4054
+JUMPV
+LABELV $4064
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $4054
+endproc CG_ConfigStringIndexToQ3 52 0
+export CG_ConfigStringIndexFromQ3
+proc CG_ConfigStringIndexFromQ3 44 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $4102
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 672
+LTI4 $4102
+CNSTI4 1
+RETI4
+ADDRGP4 $4101
+JUMPV
+LABELV $4102
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $4105
+ADDRLP4 4
+INDIRI4
+CNSTI4 288
+GEI4 $4105
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $4101
+JUMPV
+LABELV $4105
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 288
+LTI4 $4107
+ADDRLP4 8
+INDIRI4
+CNSTI4 544
+GEI4 $4107
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 288
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 274
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $4101
+JUMPV
+LABELV $4107
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 544
+LTI4 $4109
+ADDRLP4 12
+INDIRI4
+CNSTI4 608
+GEI4 $4109
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 544
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $4101
+JUMPV
+LABELV $4109
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 608
+LTI4 $4111
+ADDRLP4 16
+INDIRI4
+CNSTI4 672
+GEI4 $4111
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 608
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 593
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $4101
+JUMPV
+LABELV $4111
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 288
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $4140
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GTI4 $4144
+LABELV $4143
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $4113
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+GTI4 $4113
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4145
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4145
+address $4116
+address $4117
+address $4118
+address $4119
+address $4120
+address $4121
+address $4122
+address $4123
+address $4124
+address $4125
+address $4126
+address $4127
+address $4128
+address $4113
+address $4129
+address $4113
+address $4130
+address $4113
+address $4131
+address $4113
+address $4132
+address $4133
+address $4134
+address $4135
+address $4136
+address $4137
+address $4113
+address $4138
+address $4113
+address $4113
+address $4113
+address $4113
+address $4139
+code
+LABELV $4144
+ADDRLP4 40
+CNSTI4 608
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $4141
+ADDRLP4 20
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $4113
+LABELV $4146
+ADDRLP4 20
+INDIRI4
+CNSTI4 672
+EQI4 $4142
+ADDRGP4 $4113
+JUMPV
+LABELV $4116
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4117
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4118
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4119
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4120
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4121
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4122
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4123
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4124
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4125
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4126
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4127
+ADDRLP4 0
+CNSTI4 11
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4128
+ADDRLP4 0
+CNSTI4 987
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4129
+ADDRLP4 0
+CNSTI4 989
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4130
+ADDRLP4 0
+CNSTI4 983
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4131
+ADDRLP4 0
+CNSTI4 985
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4132
+ADDRLP4 0
+CNSTI4 12
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4133
+ADDRLP4 0
+CNSTI4 13
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4134
+ADDRLP4 0
+CNSTI4 14
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4135
+ADDRLP4 0
+CNSTI4 658
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4136
+ADDRLP4 0
+CNSTI4 665
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4137
+ADDRLP4 0
+CNSTI4 991
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4138
+ADDRLP4 0
+CNSTI4 15
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4139
+ADDRLP4 0
+CNSTI4 17
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4140
+ADDRLP4 0
+CNSTI4 274
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4141
+ADDRLP4 0
+CNSTI4 593
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4142
+ADDRLP4 0
+CNSTI4 657
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4113
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $4101
+JUMPV
+LABELV $4114
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $4101
+endproc CG_ConfigStringIndexFromQ3 44 0
+proc CG_ConfigStringIndexToQL91 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 665
+GTI4 $4148
+CNSTI4 1
+RETI4
+ADDRGP4 $4147
+JUMPV
+LABELV $4148
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 669
+LTI4 $4150
+ADDRLP4 0
+INDIRI4
+CNSTI4 672
+GTI4 $4150
+ADDRGP4 $4151
+JUMPV
+LABELV $4150
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 679
+NEI4 $4152
+ADDRFP4 0
+INDIRP4
+CNSTI4 678
+ASGNI4
+ADDRGP4 $4153
+JUMPV
+LABELV $4152
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 680
+NEI4 $4154
+ADDRFP4 0
+INDIRP4
+CNSTI4 679
+ASGNI4
+ADDRGP4 $4155
+JUMPV
+LABELV $4154
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 682
+NEI4 $4156
+ADDRFP4 0
+INDIRP4
+CNSTI4 681
+ASGNI4
+ADDRGP4 $4157
+JUMPV
+LABELV $4156
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 683
+NEI4 $4158
+ADDRFP4 0
+INDIRP4
+CNSTI4 682
+ASGNI4
+ADDRGP4 $4159
+JUMPV
+LABELV $4158
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 684
+NEI4 $4160
+ADDRFP4 0
+INDIRP4
+CNSTI4 683
+ASGNI4
+ADDRGP4 $4161
+JUMPV
+LABELV $4160
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 685
+NEI4 $4162
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ASGNI4
+ADDRGP4 $4163
+JUMPV
+LABELV $4162
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 686
+NEI4 $4164
+ADDRFP4 0
+INDIRP4
+CNSTI4 687
+ASGNI4
+ADDRGP4 $4165
+JUMPV
+LABELV $4164
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 687
+NEI4 $4166
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ASGNI4
+ADDRGP4 $4167
+JUMPV
+LABELV $4166
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 688
+NEI4 $4168
+ADDRFP4 0
+INDIRP4
+CNSTI4 685
+ASGNI4
+ADDRGP4 $4169
+JUMPV
+LABELV $4168
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 689
+NEI4 $4170
+ADDRFP4 0
+INDIRP4
+CNSTI4 686
+ASGNI4
+ADDRGP4 $4171
+JUMPV
+LABELV $4170
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 691
+NEI4 $4172
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ASGNI4
+ADDRGP4 $4173
+JUMPV
+LABELV $4172
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 692
+NEI4 $4174
+ADDRFP4 0
+INDIRP4
+CNSTI4 693
+ASGNI4
+ADDRGP4 $4175
+JUMPV
+LABELV $4174
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 697
+NEI4 $4176
+ADDRFP4 0
+INDIRP4
+CNSTI4 696
+ASGNI4
+ADDRGP4 $4177
+JUMPV
+LABELV $4176
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 693
+NEI4 $4178
+ADDRFP4 0
+INDIRP4
+CNSTI4 694
+ASGNI4
+ADDRGP4 $4179
+JUMPV
+LABELV $4178
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 694
+NEI4 $4180
+ADDRFP4 0
+INDIRP4
+CNSTI4 695
+ASGNI4
+ADDRGP4 $4181
+JUMPV
+LABELV $4180
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 693
+NEI4 $4182
+ADDRFP4 0
+INDIRP4
+CNSTI4 694
+ASGNI4
+ADDRGP4 $4183
+JUMPV
+LABELV $4182
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 696
+NEI4 $4184
+ADDRFP4 0
+INDIRP4
+CNSTI4 695
+ASGNI4
+ADDRGP4 $4185
+JUMPV
+LABELV $4184
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 699
+NEI4 $4186
+ADDRFP4 0
+INDIRP4
+CNSTI4 697
+ASGNI4
+ADDRGP4 $4187
+JUMPV
+LABELV $4186
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 700
+NEI4 $4188
+ADDRFP4 0
+INDIRP4
+CNSTI4 698
+ASGNI4
+ADDRGP4 $4189
+JUMPV
+LABELV $4188
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 701
+NEI4 $4190
+ADDRFP4 0
+INDIRP4
+CNSTI4 699
+ASGNI4
+ADDRGP4 $4191
+JUMPV
+LABELV $4190
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 702
+NEI4 $4192
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ASGNI4
+ADDRGP4 $4193
+JUMPV
+LABELV $4192
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 703
+NEI4 $4194
+ADDRFP4 0
+INDIRP4
+CNSTI4 701
+ASGNI4
+ADDRGP4 $4195
+JUMPV
+LABELV $4194
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 705
+NEI4 $4196
+ADDRFP4 0
+INDIRP4
+CNSTI4 703
+ASGNI4
+ADDRGP4 $4197
+JUMPV
+LABELV $4196
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 706
+NEI4 $4198
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ASGNI4
+ADDRGP4 $4199
+JUMPV
+LABELV $4198
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 707
+NEI4 $4200
+ADDRFP4 0
+INDIRP4
+CNSTI4 705
+ASGNI4
+ADDRGP4 $4201
+JUMPV
+LABELV $4200
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 708
+NEI4 $4202
+ADDRFP4 0
+INDIRP4
+CNSTI4 706
+ASGNI4
+ADDRGP4 $4203
+JUMPV
+LABELV $4202
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 709
+NEI4 $4204
+ADDRFP4 0
+INDIRP4
+CNSTI4 707
+ASGNI4
+ADDRGP4 $4205
+JUMPV
+LABELV $4204
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 710
+NEI4 $4206
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ASGNI4
+ADDRGP4 $4207
+JUMPV
+LABELV $4206
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 713
+NEI4 $4208
+ADDRFP4 0
+INDIRP4
+CNSTI4 710
+ASGNI4
+ADDRGP4 $4209
+JUMPV
+LABELV $4208
+ADDRGP4 $4210
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $4147
+JUMPV
+LABELV $4209
+LABELV $4207
+LABELV $4205
+LABELV $4203
+LABELV $4201
+LABELV $4199
+LABELV $4197
+LABELV $4195
+LABELV $4193
+LABELV $4191
+LABELV $4189
+LABELV $4187
+LABELV $4185
+LABELV $4183
+LABELV $4181
+LABELV $4179
+LABELV $4177
+LABELV $4175
+LABELV $4173
+LABELV $4171
+LABELV $4169
+LABELV $4167
+LABELV $4165
+LABELV $4163
+LABELV $4161
+LABELV $4159
+LABELV $4157
+LABELV $4155
+LABELV $4153
+LABELV $4151
+CNSTI4 1
+RETI4
+LABELV $4147
+endproc CG_ConfigStringIndexToQL91 4 8
+export CG_ConfigString
+proc CG_ConfigString 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4214
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4212
+LABELV $4214
+ADDRGP4 $4215
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $4212
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+5649552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4216
+ADDRGP4 $4219
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cg+5653648
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cg+5653648
+ADDP4
+RETP4
+ADDRGP4 $4211
+JUMPV
+LABELV $4216
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $4222
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_ConfigStringIndexToQ3
+CALLI4
+pop
+LABELV $4222
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+NEI4 $4225
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_ConfigStringIndexToQL91
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $4228
+ADDRGP4 $4230
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4211
+JUMPV
+LABELV $4228
+LABELV $4225
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs
+ADDP4
+INDIRI4
+ADDRGP4 cgs+4096
+ADDP4
+RETP4
+LABELV $4211
+endproc CG_ConfigString 12 12
+export CG_ConfigStringNoConvert
+proc CG_ConfigStringNoConvert 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4235
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4233
+LABELV $4235
+ADDRGP4 $4236
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $4233
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+5649552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4237
+ADDRGP4 $4219
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cg+5653648
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cg+5653648
+ADDP4
+RETP4
+ADDRGP4 $4232
+JUMPV
+LABELV $4237
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs
+ADDP4
+INDIRI4
+ADDRGP4 cgs+4096
+ADDP4
+RETP4
+LABELV $4232
+endproc CG_ConfigStringNoConvert 8 12
+export CG_StartMusic
+proc CG_StartMusic 1172 12
+CNSTI4 2
+ARGI4
+ADDRLP4 1160
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1156
+ADDRLP4 1160
+INDIRP4
+ASGNP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 1156
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1152
+ADDRLP4 128
+ASGNP4
+ADDRLP4 1152
+ARGP4
+ADDRLP4 1164
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1164
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1152
+ARGP4
+ADDRLP4 1168
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 1168
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $4243
+endproc CG_StartMusic 1172 12
+proc CG_Asset_Parse 1144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $4245
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4245
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4250
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $4252
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4251
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $4254
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4254
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4259
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $4256
+CNSTI4 1
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4256
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4263
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $4260
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1068
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+EQI4 $4266
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $4264
+LABELV $4266
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4264
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+12
+ARGP4
+ADDRGP4 cgDC+64
+INDIRP4
+CALLV
+pop
+ADDRGP4 $4252
+JUMPV
+LABELV $4260
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4273
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $4270
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+EQI4 $4276
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $4274
+LABELV $4276
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4274
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+21680
+ARGP4
+ADDRGP4 cgDC+64
+INDIRP4
+CALLV
+pop
+ADDRGP4 $4252
+JUMPV
+LABELV $4270
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4283
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $4280
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+EQI4 $4286
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1072
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $4284
+LABELV $4286
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4284
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1072
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+43348
+ARGP4
+ADDRGP4 cgDC+64
+INDIRP4
+CALLV
+pop
+ADDRGP4 $4252
+JUMPV
+LABELV $4280
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4293
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $4290
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $4294
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4294
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633700
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 $4252
+JUMPV
+LABELV $4290
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4301
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $4298
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $4302
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4302
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1084
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633748
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRGP4 $4252
+JUMPV
+LABELV $4298
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4309
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $4306
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1084
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $4310
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4310
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1088
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633752
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRGP4 $4252
+JUMPV
+LABELV $4306
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4317
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $4314
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1088
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $4318
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4318
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1092
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633760
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRGP4 $4252
+JUMPV
+LABELV $4314
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4325
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $4322
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1092
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $4326
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4326
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1096
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633756
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRGP4 $4252
+JUMPV
+LABELV $4322
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4333
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $4330
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $4334
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4334
+ADDRGP4 cgDC+236+4
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633696
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRGP4 cgDC+236+5633696
+INDIRI4
+CNSTI4 0
+NEI4 $4252
+ADDRGP4 $3702
+ARGP4
+ADDRLP4 1104
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633696
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRGP4 cgDC+236+5633696
+INDIRI4
+CNSTI4 0
+NEI4 $4252
+ADDRGP4 $4352
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4252
+JUMPV
+LABELV $4330
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4356
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $4353
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+5633764
+ARGP4
+ADDRLP4 1100
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $4252
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4353
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4364
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $4361
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+5633768
+ARGP4
+ADDRLP4 1104
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $4252
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4361
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4372
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $4369
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+5633772
+ARGP4
+ADDRLP4 1108
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $4252
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4369
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4380
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $4377
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+5633776
+ARGP4
+ADDRLP4 1112
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $4252
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4377
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4388
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $4385
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+5633780
+ARGP4
+ADDRLP4 1116
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $4252
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4385
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4396
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $4393
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+5633784
+ARGP4
+ADDRLP4 1120
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $4397
+CNSTI4 0
+RETI4
+ADDRGP4 $4244
+JUMPV
+LABELV $4397
+ADDRGP4 cgDC+236+5633800
+ADDRGP4 cgDC+236+5633784+12
+INDIRF4
+ASGNF4
+ADDRGP4 $4252
+JUMPV
+LABELV $4393
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4409
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $4406
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1124
+ARGP4
+ADDRLP4 1140
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $4410
+ADDRGP4 $4412
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4253
+JUMPV
+LABELV $4410
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1128
+ARGP4
+ADDRGP4 PC_Parenthesis_Parse
+CALLI4
+pop
+ADDRLP4 1128
+INDIRP4
+ARGP4
+ADDRLP4 1132
+ARGP4
+ADDRLP4 1136
+ARGP4
+ADDRGP4 Q_MathScript
+CALLP4
+pop
+ADDRLP4 1124
+INDIRP4
+ARGP4
+ADDRLP4 1132
+INDIRF4
+ARGF4
+ADDRGP4 MenuVar_Set
+CALLI4
+pop
+ADDRGP4 $4252
+JUMPV
+LABELV $4406
+ADDRGP4 $4413
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4252
+ADDRGP4 $4251
+JUMPV
+LABELV $4253
+CNSTI4 0
+RETI4
+LABELV $4244
+endproc CG_Asset_Parse 1144 12
+export CG_ParseMenu
+proc CG_ParseMenu 2112 12
+ADDRLP4 1044
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 2072
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $4416
+ADDRGP4 $4418
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRGP4 $4419
+ARGP4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 2076
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2076
+INDIRP4
+ARGP4
+ADDRLP4 2080
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 2080
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $4420
+ADDRGP4 $4422
+ARGP4
+ADDRLP4 1048
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4415
+JUMPV
+LABELV $4420
+ADDRLP4 1044
+ADDRLP4 1048
+ASGNP4
+ADDRGP4 $4424
+JUMPV
+LABELV $4416
+ADDRLP4 1044
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $4424
+JUMPV
+LABELV $4423
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 2076
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $4426
+ADDRGP4 $4425
+JUMPV
+LABELV $4426
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $4428
+ADDRGP4 $4424
+JUMPV
+LABELV $4428
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $4431
+ADDRGP4 $4425
+JUMPV
+LABELV $4431
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4437
+ARGP4
+ADDRLP4 2080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2080
+INDIRI4
+CNSTI4 0
+NEI4 $4434
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 2084
+ADDRGP4 CG_Asset_Parse
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+EQI4 $4425
+ADDRGP4 $4424
+JUMPV
+LABELV $4434
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4443
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $4440
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 Menu_New
+CALLV
+pop
+ADDRGP4 $4424
+JUMPV
+LABELV $4440
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $4409
+ARGP4
+ADDRLP4 2088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2088
+INDIRI4
+CNSTI4 0
+NEI4 $4444
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 2092
+ARGP4
+ADDRLP4 2108
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 2108
+INDIRI4
+CNSTI4 0
+NEI4 $4447
+ADDRGP4 $4449
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4425
+JUMPV
+LABELV $4447
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 2096
+ARGP4
+ADDRGP4 PC_Parenthesis_Parse
+CALLI4
+pop
+ADDRLP4 2096
+INDIRP4
+ARGP4
+ADDRLP4 2100
+ARGP4
+ADDRLP4 2104
+ARGP4
+ADDRGP4 Q_MathScript
+CALLP4
+pop
+ADDRLP4 2092
+INDIRP4
+ARGP4
+ADDRLP4 2100
+INDIRF4
+ARGF4
+ADDRGP4 MenuVar_Set
+CALLI4
+pop
+ADDRGP4 $4424
+JUMPV
+LABELV $4444
+ADDRGP4 $4452
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4450
+LABELV $4424
+ADDRGP4 $4423
+JUMPV
+LABELV $4425
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+LABELV $4415
+endproc CG_ParseMenu 2112 12
+proc CG_Load_Menu 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $4458
+CNSTI4 0
+RETI4
+ADDRGP4 $4454
+JUMPV
+LABELV $4457
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4259
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $4460
+CNSTI4 1
+RETI4
+ADDRGP4 $4454
+JUMPV
+LABELV $4460
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4462
+CNSTI4 0
+RETI4
+ADDRGP4 $4454
+JUMPV
+LABELV $4462
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+LABELV $4458
+ADDRGP4 $4457
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $4454
+endproc CG_Load_Menu 16 8
+bss
+align 1
+LABELV $4465
+skip 4096
+export CG_LoadMenus
+code
+proc CG_LoadMenus 44 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $4466
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $4467
+ADDRGP4 $4469
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $631
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $4470
+ADDRGP4 $4472
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4464
+JUMPV
+LABELV $4470
+LABELV $4467
+ADDRLP4 12
+INDIRI4
+CNSTI4 4096
+LTI4 $4473
+ADDRGP4 $4475
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $4464
+JUMPV
+LABELV $4473
+ADDRGP4 $4465
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+ADDRGP4 $4465
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $4465
+ARGP4
+ADDRGP4 COM_Compress
+CALLI4
+pop
+ADDRLP4 4
+ADDRGP4 $4465
+ASGNP4
+ADDRGP4 $4477
+JUMPV
+LABELV $4476
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4479
+ADDRGP4 $4478
+JUMPV
+LABELV $4479
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $4481
+ADDRGP4 $4477
+JUMPV
+LABELV $4481
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4259
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $4483
+ADDRGP4 $4478
+JUMPV
+LABELV $4483
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4487
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $4485
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_Load_Menu
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $4478
+ADDRGP4 $4477
+JUMPV
+LABELV $4485
+ADDRGP4 $4490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4477
+ADDRGP4 $4476
+JUMPV
+LABELV $4478
+ADDRLP4 28
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRGP4 $4491
+ARGP4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4464
+endproc CG_LoadMenus 44 16
+proc CG_OwnerDrawHandleKey 0 0
+CNSTI4 0
+RETI4
+LABELV $4492
+endproc CG_OwnerDrawHandleKey 0 0
+proc CG_FeederCount 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+EQF4 $4496
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099431936
+NEF4 $4494
+LABELV $4496
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4500
+JUMPV
+LABELV $4497
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $4502
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4502
+LABELV $4498
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4500
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $4497
+ADDRGP4 $4495
+JUMPV
+LABELV $4494
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+EQF4 $4508
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099956224
+NEF4 $4506
+LABELV $4508
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4512
+JUMPV
+LABELV $4509
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $4514
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4514
+LABELV $4510
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4512
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $4509
+ADDRGP4 $4507
+JUMPV
+LABELV $4506
+ADDRFP4 0
+INDIRF4
+CNSTF4 1093664768
+NEF4 $4518
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4523
+JUMPV
+LABELV $4520
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $4525
+ADDRGP4 $4521
+JUMPV
+LABELV $4525
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4521
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4523
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $4520
+ADDRGP4 $4519
+JUMPV
+LABELV $4518
+ADDRGP4 $4529
+ARGP4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4519
+LABELV $4507
+LABELV $4495
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $4493
+endproc CG_FeederCount 16 8
+export CG_SetScoreSelection
+proc CG_SetScoreSelection 24 16
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $4535
+JUMPV
+LABELV $4532
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $4537
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4538
+JUMPV
+LABELV $4537
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $4541
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4541
+LABELV $4538
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+NEI4 $4545
+ADDRGP4 cg+610856
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $4545
+LABELV $4533
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4535
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $4532
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4549
+ADDRGP4 $4530
+JUMPV
+LABELV $4549
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+NEI4 $4551
+CNSTI4 92
+ADDRGP4 cg+610856
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $4554
+LABELV $4554
+LABELV $4551
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $4559
+ADDRLP4 16
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 92
+ADDRGP4 cg+610856
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $4562
+ADDRLP4 16
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $4562
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $4560
+JUMPV
+LABELV $4559
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 cg+610856
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+LABELV $4560
+LABELV $4530
+endproc CG_SetScoreSelection 24 16
+proc CG_InfoFromScoreIndex 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GEI4 $4573
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+NEI4 $4569
+LABELV $4573
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $4577
+JUMPV
+LABELV $4574
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $4579
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $4583
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 4524
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+RETP4
+ADDRGP4 $4568
+JUMPV
+LABELV $4583
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4579
+LABELV $4575
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4577
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $4574
+LABELV $4569
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 4524
+CNSTI4 92
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+RETP4
+LABELV $4568
+endproc CG_InfoFromScoreIndex 12 0
+export CG_LimitText
+proc CG_LimitText 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $4590
+ADDRGP4 $4589
+JUMPV
+LABELV $4590
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $4593
+JUMPV
+LABELV $4592
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+LABELV $4593
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_Text_Length
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+GTI4 $4592
+LABELV $4589
+endproc CG_LimitText 12 4
+proc CG_FeederItemTextCaStats 132 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099431936
+NEF4 $4596
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4597
+JUMPV
+LABELV $4596
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099956224
+NEF4 $4598
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4599
+JUMPV
+LABELV $4598
+ADDRGP4 $4600
+ARGP4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4599
+LABELV $4597
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 92
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 124
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRGP4 cg+3848480
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $4603
+LABELV $4603
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4605
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $4605
+ADDRLP4 40
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $4608
+ADDRLP4 40
+INDIRI4
+CNSTI4 16
+GTI4 $4608
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4634
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4634
+address $4609
+address $4614
+address $4616
+address $4618
+address $4619
+address $4620
+address $4621
+address $4623
+address $4624
+address $4626
+address $4627
+address $4628
+address $4629
+address $4630
+address $4631
+address $4632
+address $4633
+code
+LABELV $4609
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4610
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRGP4 $4611
+JUMPV
+LABELV $4610
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 44
+INDIRP4
+ASGNP4
+LABELV $4611
+ADDRLP4 24
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4614
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4616
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4618
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4619
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4620
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4621
+ADDRGP4 $4622
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4623
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4624
+ADDRGP4 $4625
+ARGP4
+ADDRLP4 64
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4626
+ADDRGP4 $4625
+ARGP4
+ADDRLP4 72
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4627
+ADDRGP4 $4625
+ARGP4
+ADDRLP4 80
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4628
+ADDRGP4 $4625
+ARGP4
+ADDRLP4 88
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4629
+ADDRGP4 $4625
+ARGP4
+ADDRLP4 96
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4630
+ADDRGP4 $4625
+ARGP4
+ADDRLP4 104
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4631
+ADDRGP4 $4625
+ARGP4
+ADDRLP4 112
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4632
+ADDRGP4 $4625
+ARGP4
+ADDRLP4 120
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4633
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+RETP4
+ADDRGP4 $4595
+JUMPV
+LABELV $4608
+LABELV $4605
+ADDRGP4 $211
+RETP4
+LABELV $4595
+endproc CG_FeederItemTextCaStats 132 12
+proc CG_FeederItemTextTdmStats 120 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099431936
+NEF4 $4636
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4637
+JUMPV
+LABELV $4636
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099956224
+NEF4 $4638
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4639
+JUMPV
+LABELV $4638
+ADDRGP4 $4640
+ARGP4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4639
+LABELV $4637
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 92
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 60
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRGP4 cg+3861920
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $4643
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4643
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4645
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $4645
+ADDRLP4 44
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LTI4 $4648
+ADDRLP4 44
+INDIRI4
+CNSTI4 17
+GTI4 $4648
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4669
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4669
+address $4649
+address $4652
+address $4653
+address $4654
+address $4655
+address $4656
+address $4657
+address $4658
+address $4659
+address $4660
+address $4661
+address $4662
+address $4663
+address $4664
+address $4665
+address $4666
+address $4667
+address $4668
+code
+LABELV $4649
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4650
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $4651
+JUMPV
+LABELV $4650
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 48
+INDIRP4
+ASGNP4
+LABELV $4651
+ADDRLP4 24
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4652
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4653
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4654
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 48
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4655
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4656
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4657
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4658
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 72
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4659
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4660
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4661
+ADDRGP4 $4622
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4662
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4663
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4664
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4665
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4666
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4667
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4668
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+RETP4
+ADDRGP4 $4635
+JUMPV
+LABELV $4648
+LABELV $4645
+ADDRGP4 $211
+RETP4
+LABELV $4635
+endproc CG_FeederItemTextTdmStats 120 12
+proc CG_FeederItemTextCtfStats 112 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099431936
+NEF4 $4671
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4672
+JUMPV
+LABELV $4671
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099956224
+NEF4 $4673
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4674
+JUMPV
+LABELV $4673
+ADDRGP4 $4675
+ARGP4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4674
+LABELV $4672
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 92
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 56
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRGP4 cg+3871032
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4678
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $4678
+ADDRLP4 40
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $4681
+ADDRLP4 40
+INDIRI4
+CNSTI4 18
+GTI4 $4681
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4703
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4703
+address $4682
+address $4685
+address $4686
+address $4687
+address $4688
+address $4689
+address $4690
+address $4691
+address $4692
+address $4693
+address $4694
+address $4695
+address $4696
+address $4697
+address $4698
+address $4699
+address $4700
+address $4701
+address $4702
+code
+LABELV $4682
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4683
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRGP4 $4684
+JUMPV
+LABELV $4683
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 44
+INDIRP4
+ASGNP4
+LABELV $4684
+ADDRLP4 24
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4685
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4686
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4687
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4688
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4689
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 52
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4690
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4691
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4692
+ADDRGP4 $4622
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4693
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4694
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4695
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4696
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4697
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4698
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4699
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4700
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4701
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4702
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+RETP4
+ADDRGP4 $4670
+JUMPV
+LABELV $4681
+LABELV $4678
+ADDRGP4 $211
+RETP4
+LABELV $4670
+endproc CG_FeederItemTextCtfStats 112 12
+proc CG_FeederItemTextFreezetagStats 108 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099431936
+NEF4 $4705
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4706
+JUMPV
+LABELV $4705
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099956224
+NEF4 $4707
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4708
+JUMPV
+LABELV $4707
+ADDRGP4 $4709
+ARGP4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4708
+LABELV $4706
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 92
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 60
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cg+3861920
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 84
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $4714
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4714
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4716
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $4716
+ADDRLP4 52
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LTI4 $4719
+ADDRLP4 52
+INDIRI4
+CNSTI4 17
+GTI4 $4719
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4765
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4765
+address $4720
+address $4723
+address $4727
+address $4731
+address $4735
+address $4736
+address $4737
+address $4738
+address $4742
+address $4747
+address $4751
+address $4755
+address $4756
+address $4757
+address $4758
+address $4759
+address $4760
+address $4761
+code
+LABELV $4720
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4721
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $4722
+JUMPV
+LABELV $4721
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+LABELV $4722
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4723
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4724
+ADDRLP4 56
+ADDRLP4 20
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4725
+JUMPV
+LABELV $4724
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4725
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4727
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4728
+ADDRLP4 56
+ADDRLP4 20
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4729
+JUMPV
+LABELV $4728
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4729
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4731
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4732
+ADDRLP4 60
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 20
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $4733
+JUMPV
+LABELV $4732
+ADDRLP4 60
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $4733
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4735
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4736
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4737
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4738
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4739
+ADDRLP4 72
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 72
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 76
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 76
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $4740
+JUMPV
+LABELV $4739
+ADDRLP4 76
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 76
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 76
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $4740
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4742
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4743
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4743
+ADDRGP4 $4746
+ARGP4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4747
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4748
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4748
+ADDRGP4 $4746
+ARGP4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4751
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4752
+ADDRLP4 76
+ADDRLP4 20
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4753
+JUMPV
+LABELV $4752
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4753
+ADDRGP4 $4622
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4755
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4756
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4757
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4758
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4759
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4760
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4761
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4762
+ADDRLP4 100
+ADDRLP4 20
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4763
+JUMPV
+LABELV $4762
+ADDRLP4 100
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4763
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+RETP4
+ADDRGP4 $4704
+JUMPV
+LABELV $4719
+LABELV $4716
+ADDRGP4 $211
+RETP4
+LABELV $4704
+endproc CG_FeederItemTextFreezetagStats 108 12
+proc CG_FeederItemTextCa 64 16
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $4767
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4768
+JUMPV
+LABELV $4767
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+NEF4 $4769
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4769
+ADDRGP4 $4771
+ARGP4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4770
+LABELV $4768
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 92
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 84
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4775
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $4775
+ADDRLP4 40
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $4778
+ADDRLP4 40
+INDIRI4
+CNSTI4 11
+GTI4 $4778
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4900
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4900
+address $4779
+address $4782
+address $4792
+address $4801
+address $4828
+address $4835
+address $4853
+address $4858
+address $4867
+address $4874
+address $4884
+address $4895
+code
+LABELV $4779
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+972
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4782
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4783
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+3468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4786
+ADDRFP4 12
+INDIRP4
+ADDRGP4 cgs+632912+1317352
+INDIRI4
+ASGNI4
+LABELV $4786
+LABELV $4783
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4792
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4793
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $4796
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+GEI4 $4794
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4793
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $4799
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4799
+LABELV $4794
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4801
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $4802
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+LABELV $4802
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $4805
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $4808
+ADDRGP4 $4810
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $4809
+JUMPV
+LABELV $4808
+ADDRGP4 $4811
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $4809
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4805
+ADDRGP4 cg+3856416+8
+INDIRI4
+CNSTI4 3
+LTI4 $4812
+ADDRLP4 48
+ADDRLP4 16
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4813
+JUMPV
+LABELV $4812
+ADDRLP4 48
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4813
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $4820
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $4816
+LABELV $4820
+ADDRLP4 48
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2384
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4816
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $4822
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $4824
+ADDRGP4 $4826
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $4825
+JUMPV
+LABELV $4824
+ADDRGP4 $4827
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $4825
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4822
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4828
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4778
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4778
+JUMPV
+LABELV $4835
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 0
+EQI4 $4840
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $4836
+LABELV $4840
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4841
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRGP4 $4842
+JUMPV
+LABELV $4841
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+LABELV $4842
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 CG_LimitText
+CALLV
+pop
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4836
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2144
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4843
+ADDRLP4 44
+CNSTI4 91
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $4843
+ADDRGP4 cgs+1957744
+INDIRI4
+ADDRLP4 44
+INDIRI4
+GEI4 $4843
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4847
+ADDRGP4 $4849
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRGP4 $4848
+JUMPV
+LABELV $4847
+ADDRGP4 $4850
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $4848
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 CG_LimitText
+CALLV
+pop
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4843
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4851
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $4852
+JUMPV
+LABELV $4851
+ADDRGP4 $3942
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 48
+INDIRP4
+ASGNP4
+LABELV $4852
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 CG_LimitText
+CALLV
+pop
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4853
+ADDRGP4 cg+3856416+8
+INDIRI4
+CNSTI4 3
+LTI4 $4854
+ADDRLP4 44
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4855
+JUMPV
+LABELV $4854
+ADDRLP4 44
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4855
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4858
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $4859
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4859
+ADDRGP4 cg+3856416+8
+INDIRI4
+CNSTI4 3
+LTI4 $4862
+ADDRGP4 $4866
+ARGP4
+ADDRLP4 44
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4862
+ADDRGP4 $4866
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4867
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3856416
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $4868
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $4868
+ADDRLP4 28
+ADDRLP4 16
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1000
+LTI4 $4871
+ADDRGP4 $4873
+ARGP4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $4872
+JUMPV
+LABELV $4871
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 48
+INDIRP4
+ASGNP4
+LABELV $4872
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4868
+ADDRGP4 $4746
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4874
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3856416
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $4875
+ADDRLP4 52
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $4875
+ADDRLP4 52
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $4875
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4875
+ADDRGP4 cg+3856416+8
+INDIRI4
+CNSTI4 3
+LTI4 $4878
+ADDRFP4 12
+INDIRP4
+CNSTI4 132
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4879
+JUMPV
+LABELV $4878
+ADDRFP4 12
+INDIRP4
+CNSTI4 132
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4879
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4884
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3856416
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $4888
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $4885
+LABELV $4888
+ADDRGP4 $4622
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4885
+ADDRLP4 16
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4889
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4889
+ADDRGP4 cg+3856416+8
+INDIRI4
+CNSTI4 3
+LTI4 $4891
+ADDRGP4 $4622
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4891
+ADDRGP4 $4622
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4895
+ADDRGP4 cg+3856416+8
+INDIRI4
+CNSTI4 3
+LTI4 $4896
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4896
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4766
+JUMPV
+LABELV $4778
+LABELV $4775
+ADDRGP4 $211
+RETP4
+LABELV $4766
+endproc CG_FeederItemTextCa 64 16
+proc CG_FeederItemTextTdm 80 20
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $4902
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4903
+JUMPV
+LABELV $4902
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+NEF4 $4904
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4905
+JUMPV
+LABELV $4904
+ADDRGP4 $4906
+ARGP4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4905
+LABELV $4903
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 92
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 84
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4910
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $4910
+ADDRLP4 40
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $4913
+ADDRLP4 40
+INDIRI4
+CNSTI4 9
+GTI4 $4913
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $5014
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $5014
+address $4914
+address $4929
+address $4939
+address $4947
+address $4956
+address $4963
+address $4988
+address $4993
+address $5003
+address $5009
+code
+LABELV $4914
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 0
+EQI4 $4919
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $4915
+LABELV $4919
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+972
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4916
+JUMPV
+LABELV $4915
+ADDRGP4 cg+3856416+8
+INDIRI4
+CNSTI4 3
+LTI4 $4922
+ADDRLP4 44
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4923
+JUMPV
+LABELV $4922
+ADDRLP4 44
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4923
+ADDRFP4 12
+INDIRP4
+CNSTI4 132
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4927
+LABELV $4927
+LABELV $4916
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4929
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4930
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+3468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4933
+ADDRFP4 12
+INDIRP4
+ADDRGP4 cgs+632912+1317352
+INDIRI4
+ASGNI4
+LABELV $4933
+LABELV $4930
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4939
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4940
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $4796
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+GEI4 $4941
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4940
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $4945
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4945
+LABELV $4941
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4947
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $4948
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+LABELV $4948
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $4951
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $4954
+ADDRGP4 $4810
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $4955
+JUMPV
+LABELV $4954
+ADDRGP4 $4811
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $4955
+LABELV $4951
+ADDRGP4 $211
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4956
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4913
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4913
+JUMPV
+LABELV $4963
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 0
+EQI4 $4968
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $4964
+LABELV $4968
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4969
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRGP4 $4970
+JUMPV
+LABELV $4969
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+LABELV $4970
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 CG_LimitText
+CALLV
+pop
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4964
+ADDRGP4 cg+3856416+8
+INDIRI4
+CNSTI4 3
+EQI4 $4975
+ADDRGP4 $4971
+JUMPV
+LABELV $4975
+ADDRLP4 44
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4972
+JUMPV
+LABELV $4971
+ADDRLP4 44
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4972
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2144
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4976
+ADDRLP4 48
+CNSTI4 91
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $4976
+ADDRGP4 cgs+1957744
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GEI4 $4976
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4980
+ADDRGP4 $4982
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $4981
+JUMPV
+LABELV $4980
+ADDRGP4 $4983
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 56
+INDIRP4
+ASGNP4
+LABELV $4981
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 CG_LimitText
+CALLV
+pop
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4976
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4984
+ADDRGP4 $4986
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRGP4 $4985
+JUMPV
+LABELV $4984
+ADDRGP4 $4987
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $4985
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 CG_LimitText
+CALLV
+pop
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4988
+ADDRGP4 cg+3856416+8
+INDIRI4
+CNSTI4 3
+LTI4 $4989
+ADDRLP4 44
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4990
+JUMPV
+LABELV $4989
+ADDRLP4 44
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4990
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4993
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $4994
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4994
+ADDRLP4 44
+ADDRGP4 cg+3856416+8
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+EQI4 $5001
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+EQI4 $5001
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+EQI4 $5002
+ADDRGP4 $4997
+JUMPV
+LABELV $5001
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 52
+CNSTI4 68
+ASGNI4
+ADDRLP4 56
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRGP4 $4998
+JUMPV
+LABELV $5002
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 64
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $4998
+JUMPV
+LABELV $4997
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 76
+INDIRP4
+ASGNP4
+LABELV $4998
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $5003
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3856416
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $5004
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $5004
+ADDRLP4 28
+ADDRLP4 16
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1000
+LTI4 $5007
+ADDRGP4 $4873
+ARGP4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRGP4 $5008
+JUMPV
+LABELV $5007
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $5008
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $5004
+ADDRGP4 $4746
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $5009
+ADDRGP4 cg+3856416+8
+INDIRI4
+CNSTI4 3
+LTI4 $5010
+ADDRLP4 52
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5011
+JUMPV
+LABELV $5010
+ADDRLP4 52
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5011
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4913
+LABELV $4910
+ADDRGP4 $211
+RETP4
+LABELV $4901
+endproc CG_FeederItemTextTdm 80 20
+proc CG_FeederItemTextCtf 68 20
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $5016
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5017
+JUMPV
+LABELV $5016
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+NEF4 $5018
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $5019
+JUMPV
+LABELV $5018
+ADDRGP4 $5020
+ARGP4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5019
+LABELV $5017
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 92
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 80
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+3865760+152
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cg+3865760+8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $5026
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5027
+JUMPV
+LABELV $5026
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5027
+ADDRLP4 20
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $5028
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5028
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5030
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $5030
+ADDRLP4 44
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LTI4 $5033
+ADDRLP4 44
+INDIRI4
+CNSTI4 11
+GTI4 $5033
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $5151
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $5151
+address $5034
+address $5048
+address $5058
+address $5066
+address $5097
+address $5104
+address $5122
+address $5125
+address $5136
+address $5139
+address $5145
+address $5148
+code
+LABELV $5034
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 0
+EQI4 $5039
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $5035
+LABELV $5039
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+972
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5036
+JUMPV
+LABELV $5035
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $5042
+ADDRFP4 12
+INDIRP4
+CNSTI4 132
+ADDRLP4 24
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5043
+JUMPV
+LABELV $5042
+ADDRFP4 12
+INDIRP4
+CNSTI4 132
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5043
+ADDRFP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $5046
+LABELV $5046
+LABELV $5036
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5048
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5049
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+3468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5052
+ADDRFP4 12
+INDIRP4
+ADDRGP4 cgs+632912+1317352
+INDIRI4
+ASGNI4
+LABELV $5052
+LABELV $5049
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5058
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5059
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 $4796
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GEI4 $5060
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5059
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $5064
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5064
+LABELV $5060
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5066
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $5067
+ADDRLP4 56
+ADDRLP4 24
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5068
+JUMPV
+LABELV $5067
+ADDRLP4 56
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5068
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $5069
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+LABELV $5069
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+NEI4 $5076
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $5072
+LABELV $5076
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $5077
+ADDRGP4 $4810
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5078
+JUMPV
+LABELV $5077
+ADDRGP4 $4811
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+LABELV $5078
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5072
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_REDFLAG
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $5079
+ADDRFP4 12
+INDIRP4
+ADDRGP4 cgs+632912+492600
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5080
+JUMPV
+LABELV $5079
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $5083
+ADDRFP4 12
+INDIRP4
+ADDRGP4 cgs+632912+492604
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+LABELV $5083
+LABELV $5080
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $5087
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $5089
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5092
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $5095
+ADDRGP4 $4826
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $5096
+JUMPV
+LABELV $5095
+ADDRGP4 $4827
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $5096
+LABELV $5092
+LABELV $5089
+LABELV $5087
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5097
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5033
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5033
+JUMPV
+LABELV $5104
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 0
+EQI4 $5109
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $5105
+LABELV $5109
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5110
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $5111
+JUMPV
+LABELV $5110
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 48
+INDIRP4
+ASGNP4
+LABELV $5111
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 15
+ARGI4
+ADDRGP4 CG_LimitText
+CALLV
+pop
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5105
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $5112
+ADDRLP4 48
+ADDRLP4 24
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5113
+JUMPV
+LABELV $5112
+ADDRLP4 48
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5113
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2144
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5114
+ADDRLP4 52
+CNSTI4 91
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+ADDRLP4 52
+INDIRI4
+NEI4 $5114
+ADDRGP4 cgs+1957744
+INDIRI4
+ADDRLP4 52
+INDIRI4
+GEI4 $5114
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5118
+ADDRGP4 $4982
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRGP4 $5119
+JUMPV
+LABELV $5118
+ADDRGP4 $4983
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 60
+INDIRP4
+ASGNP4
+LABELV $5119
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 15
+ARGI4
+ADDRGP4 CG_LimitText
+CALLV
+pop
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5114
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5120
+ADDRGP4 $4986
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $5121
+JUMPV
+LABELV $5120
+ADDRGP4 $4987
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+LABELV $5121
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 15
+ARGI4
+ADDRGP4 CG_LimitText
+CALLV
+pop
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5122
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $5123
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5123
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5125
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $5126
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $5133
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $5129
+LABELV $5133
+ADDRGP4 $4746
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5129
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5126
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $5134
+ADDRGP4 $4866
+ARGP4
+ADDRLP4 48
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5134
+ADDRGP4 $4866
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5136
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $5137
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5137
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5139
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $5140
+ADDRGP4 $4746
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5140
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $5143
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5143
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5145
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $5146
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5146
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5148
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $5149
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5149
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5015
+JUMPV
+LABELV $5033
+LABELV $5030
+ADDRGP4 $211
+RETP4
+LABELV $5015
+endproc CG_FeederItemTextCtf 68 20
+proc CG_FeederItemTextFreezetag 60 20
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $5153
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5154
+JUMPV
+LABELV $5153
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+NEF4 $5155
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+LABELV $5155
+LABELV $5154
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 92
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 84
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5160
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $5160
+ADDRLP4 36
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $5162
+ADDRLP4 36
+INDIRI4
+CNSTI4 9
+GTI4 $5162
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $5257
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $5257
+address $5164
+address $5178
+address $5188
+address $5196
+address $5216
+address $5223
+address $5240
+address $5244
+address $5248
+address $5252
+code
+LABELV $5164
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 0
+EQI4 $5169
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $5165
+LABELV $5169
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+972
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5166
+JUMPV
+LABELV $5165
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $5172
+ADDRLP4 40
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5173
+JUMPV
+LABELV $5172
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5173
+ADDRFP4 12
+INDIRP4
+CNSTI4 132
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $5176
+LABELV $5176
+LABELV $5166
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5178
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5179
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+3468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5182
+ADDRFP4 12
+INDIRP4
+ADDRGP4 cgs+632912+1317352
+INDIRI4
+ASGNI4
+LABELV $5182
+LABELV $5179
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5188
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5189
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 $4796
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+GEI4 $5190
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5189
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $5194
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5194
+LABELV $5190
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5196
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $5197
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+LABELV $5197
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $5200
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $5203
+ADDRGP4 $4810
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $5204
+JUMPV
+LABELV $5203
+ADDRGP4 $4811
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $5204
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5200
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $5205
+ADDRLP4 44
+ADDRLP4 16
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5206
+JUMPV
+LABELV $5205
+ADDRLP4 44
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5206
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5208
+ADDRLP4 44
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2384
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5208
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $5212
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $5214
+ADDRGP4 $4826
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $5215
+JUMPV
+LABELV $5214
+ADDRGP4 $4827
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $5215
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5212
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5216
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5217
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5217
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5223
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 0
+NEI4 $5224
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5227
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRGP4 $5228
+JUMPV
+LABELV $5227
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 40
+INDIRP4
+ASGNP4
+LABELV $5228
+ADDRLP4 24
+INDIRP4
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5224
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $5229
+ADDRLP4 40
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5230
+JUMPV
+LABELV $5229
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5230
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2144
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5232
+ADDRLP4 44
+CNSTI4 91
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $5232
+ADDRGP4 cgs+1957744
+INDIRI4
+ADDRLP4 44
+INDIRI4
+GEI4 $5232
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5236
+ADDRGP4 $4982
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRGP4 $5237
+JUMPV
+LABELV $5236
+ADDRGP4 $4983
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $5237
+ADDRLP4 24
+INDIRP4
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5232
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5238
+ADDRGP4 $4986
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $5239
+JUMPV
+LABELV $5238
+ADDRGP4 $4987
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 48
+INDIRP4
+ASGNP4
+LABELV $5239
+ADDRLP4 24
+INDIRP4
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5240
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $5241
+ADDRLP4 40
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5242
+JUMPV
+LABELV $5241
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5242
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5244
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $5245
+ADDRLP4 48
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 48
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5246
+JUMPV
+LABELV $5245
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5246
+ADDRGP4 $4866
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5248
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $5249
+ADDRLP4 40
+ADDRLP4 16
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5250
+JUMPV
+LABELV $5249
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5250
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5252
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $5253
+ADDRLP4 40
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5254
+JUMPV
+LABELV $5253
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5254
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5162
+ADDRGP4 $5256
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+RETP4
+ADDRGP4 $5152
+JUMPV
+LABELV $5160
+ADDRGP4 $211
+RETP4
+LABELV $5152
+endproc CG_FeederItemTextFreezetag 60 20
+proc CG_FeederItemTextFfa 60 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $5259
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5260
+JUMPV
+LABELV $5259
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+NEF4 $5261
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $5262
+JUMPV
+LABELV $5261
+ADDRFP4 0
+INDIRF4
+CNSTF4 1093664768
+NEF4 $5263
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5264
+JUMPV
+LABELV $5263
+ADDRGP4 $5265
+ARGP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5264
+LABELV $5262
+LABELV $5260
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 92
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5267
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $5267
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $5269
+ADDRLP4 32
+INDIRI4
+CNSTI4 13
+GTI4 $5269
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $5325
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $5325
+address $5271
+address $5274
+address $5284
+address $5292
+address $5303
+address $5310
+address $5313
+address $5314
+address $5315
+address $5316
+address $5319
+address $5321
+address $5322
+address $5323
+code
+LABELV $5271
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+972
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5274
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5275
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+3468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5278
+ADDRFP4 12
+INDIRP4
+ADDRGP4 cgs+632912+1317352
+INDIRI4
+ASGNI4
+LABELV $5278
+LABELV $5275
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5284
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5285
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 $4796
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+GEI4 $5286
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5285
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $5290
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5290
+LABELV $5286
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5292
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $5293
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+LABELV $5293
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $5296
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $5299
+ADDRGP4 $4810
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $5300
+JUMPV
+LABELV $5299
+ADDRGP4 $4811
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $5300
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5296
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5301
+LABELV $5301
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5303
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5304
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5304
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5310
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5311
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $5312
+JUMPV
+LABELV $5311
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+LABELV $5312
+ADDRLP4 16
+INDIRP4
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5313
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5314
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5315
+ADDRGP4 $4866
+ARGP4
+ADDRLP4 40
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5316
+ADDRLP4 48
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1000
+LTI4 $5317
+ADDRGP4 $4873
+ARGP4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRGP4 $5318
+JUMPV
+LABELV $5317
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $5318
+ADDRLP4 16
+INDIRP4
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5319
+ADDRFP4 12
+INDIRP4
+CNSTI4 132
+ADDRLP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5321
+ADDRGP4 $4622
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5322
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5323
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5269
+ADDRGP4 $5324
+RETP4
+ADDRGP4 $5258
+JUMPV
+LABELV $5267
+ADDRGP4 $211
+RETP4
+LABELV $5258
+endproc CG_FeederItemTextFfa 60 12
+proc CG_FeederItemTextRedRover 60 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $5327
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5328
+JUMPV
+LABELV $5327
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+NEF4 $5329
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+LABELV $5329
+LABELV $5328
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 92
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5332
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $5332
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $5334
+ADDRLP4 32
+INDIRI4
+CNSTI4 13
+GTI4 $5334
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $5390
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $5390
+address $5336
+address $5339
+address $5349
+address $5357
+address $5370
+address $5377
+address $5380
+address $5380
+address $5381
+address $5382
+address $5385
+address $5387
+address $5388
+address $5389
+code
+LABELV $5336
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+972
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5339
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5340
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+3468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5343
+ADDRFP4 12
+INDIRP4
+ADDRGP4 cgs+632912+1317352
+INDIRI4
+ASGNI4
+LABELV $5343
+LABELV $5340
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5349
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5350
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 $4796
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+GEI4 $5351
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5350
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $5355
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5355
+LABELV $5351
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5357
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $5358
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+LABELV $5358
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $5361
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $5364
+ADDRGP4 $4810
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $5365
+JUMPV
+LABELV $5364
+ADDRGP4 $4811
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $5365
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5361
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $5366
+ADDRGP4 $4826
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $5367
+JUMPV
+LABELV $5366
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $5368
+ADDRGP4 $4827
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $5368
+LABELV $5367
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5370
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5371
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5371
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5377
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5378
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $5379
+JUMPV
+LABELV $5378
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+LABELV $5379
+ADDRLP4 16
+INDIRP4
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5380
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5381
+ADDRGP4 $4866
+ARGP4
+ADDRLP4 40
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5382
+ADDRLP4 48
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1000
+LTI4 $5383
+ADDRGP4 $4873
+ARGP4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRGP4 $5384
+JUMPV
+LABELV $5383
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $5384
+ADDRLP4 16
+INDIRP4
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5385
+ADDRFP4 12
+INDIRP4
+CNSTI4 132
+ADDRLP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5387
+ADDRGP4 $4622
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5388
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5389
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5334
+ADDRGP4 $5324
+RETP4
+ADDRGP4 $5326
+JUMPV
+LABELV $5332
+ADDRGP4 $211
+RETP4
+LABELV $5326
+endproc CG_FeederItemTextRedRover 60 12
+proc CG_FeederItemTextRace 56 20
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $5392
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5393
+JUMPV
+LABELV $5392
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+NEF4 $5394
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $5395
+JUMPV
+LABELV $5394
+ADDRFP4 0
+INDIRF4
+CNSTF4 1093664768
+NEF4 $5396
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5397
+JUMPV
+LABELV $5396
+ADDRGP4 $5398
+ARGP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5397
+LABELV $5395
+LABELV $5393
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 92
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5400
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $5400
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $5402
+ADDRLP4 32
+INDIRI4
+CNSTI4 6
+GTI4 $5402
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $5469
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $5469
+address $5404
+address $5422
+address $5439
+address $5452
+address $5466
+address $5467
+address $5468
+code
+LABELV $5404
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 0
+EQI4 $5409
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $5405
+LABELV $5409
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+972
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5406
+JUMPV
+LABELV $5405
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5412
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $5412
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5413
+JUMPV
+LABELV $5412
+ADDRFP4 12
+INDIRP4
+CNSTI4 132
+ADDRLP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $5420
+LABELV $5420
+LABELV $5413
+LABELV $5406
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5422
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5423
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+3468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5426
+ADDRFP4 12
+INDIRP4
+ADDRGP4 cgs+632912+1317352
+INDIRI4
+ASGNI4
+LABELV $5426
+LABELV $5423
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5432
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 $4796
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+GEI4 $5433
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5432
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $5437
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5437
+LABELV $5433
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5439
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $5440
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+LABELV $5440
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $5443
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $5446
+ADDRGP4 $4810
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $5447
+JUMPV
+LABELV $5446
+ADDRGP4 $4811
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $5447
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5443
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $5448
+ADDRGP4 $4826
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $5449
+JUMPV
+LABELV $5448
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $5450
+ADDRGP4 $4827
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $5450
+LABELV $5449
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5452
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 0
+NEI4 $5453
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5456
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $5457
+JUMPV
+LABELV $5456
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+LABELV $5457
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5453
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2144
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5458
+ADDRLP4 36
+CNSTI4 91
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $5458
+ADDRGP4 cgs+1957744
+INDIRI4
+ADDRLP4 36
+INDIRI4
+GEI4 $5458
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5462
+ADDRGP4 $4982
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRGP4 $5463
+JUMPV
+LABELV $5462
+ADDRGP4 $4983
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+LABELV $5463
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5458
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5464
+ADDRGP4 $4986
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRGP4 $5465
+JUMPV
+LABELV $5464
+ADDRGP4 $4987
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 40
+INDIRP4
+ASGNP4
+LABELV $5465
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5466
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_GetTimeString
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5467
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5468
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5402
+ADDRGP4 $5324
+RETP4
+ADDRGP4 $5391
+JUMPV
+LABELV $5400
+ADDRGP4 $211
+RETP4
+LABELV $5391
+endproc CG_FeederItemTextRace 56 20
+proc CG_FeederItemText 64 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $5471
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5471
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099431936
+EQF4 $5477
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099956224
+NEF4 $5475
+LABELV $5477
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FeederItemTextCaStats
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5475
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FeederItemTextCa
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5471
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+NEI4 $5478
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5478
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099431936
+EQF4 $5484
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099956224
+NEF4 $5482
+LABELV $5484
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FeederItemTextTdmStats
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5482
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FeederItemTextTdm
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5478
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $5496
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $5496
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $5496
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+EQI4 $5496
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+NEI4 $5485
+LABELV $5496
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5485
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099431936
+EQF4 $5499
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099956224
+NEF4 $5497
+LABELV $5499
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FeederItemTextCtfStats
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5497
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FeederItemTextCtf
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5485
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $5500
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+CNSTI4 0
+NEI4 $5500
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099431936
+EQF4 $5506
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099956224
+NEF4 $5504
+LABELV $5506
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FeederItemTextFreezetagStats
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5504
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FeederItemTextFreezetag
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5500
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $5507
+ADDRGP4 cg_scoreBoardOld+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $5507
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FeederItemTextFfa
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5507
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $5511
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FeederItemTextRedRover
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5511
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $5514
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FeederItemTextRace
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5514
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $5517
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5518
+JUMPV
+LABELV $5517
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+NEF4 $5519
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $5520
+JUMPV
+LABELV $5519
+ADDRFP4 0
+INDIRF4
+CNSTF4 1093664768
+NEF4 $5521
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5522
+JUMPV
+LABELV $5521
+ADDRGP4 $5523
+ARGP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5522
+LABELV $5520
+LABELV $5518
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 92
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5525
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $5525
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $5527
+ADDRFP4 8
+INDIRI4
+CNSTI4 9
+GTI4 $5527
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $5656
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $5656
+address $5529
+address $5547
+address $5564
+address $5600
+address $5614
+address $5621
+address $5628
+address $5635
+address $5642
+address $5649
+code
+LABELV $5529
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 0
+EQI4 $5534
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $5530
+LABELV $5534
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+972
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5531
+JUMPV
+LABELV $5530
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5537
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $5537
+ADDRFP4 12
+INDIRP4
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+2248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5538
+JUMPV
+LABELV $5537
+ADDRFP4 12
+INDIRP4
+CNSTI4 132
+ADDRLP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $5545
+LABELV $5545
+LABELV $5538
+LABELV $5531
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5547
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5548
+CNSTI4 4524
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+3468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5551
+ADDRFP4 12
+INDIRP4
+ADDRGP4 cgs+632912+1317352
+INDIRI4
+ASGNI4
+LABELV $5551
+LABELV $5548
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5557
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 $4796
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+GEI4 $5558
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5557
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $5562
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5562
+LABELV $5558
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5564
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $5565
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+LABELV $5565
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $5568
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $5571
+ADDRGP4 $4810
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $5572
+JUMPV
+LABELV $5571
+ADDRGP4 $4811
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $5572
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5568
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $5579
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $5579
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $5573
+LABELV $5579
+ADDRLP4 44
+ADDRLP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $5584
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $5580
+LABELV $5584
+ADDRLP4 44
+CNSTI4 2392
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2384
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5580
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $5586
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $5588
+ADDRGP4 $4826
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $5589
+JUMPV
+LABELV $5588
+ADDRGP4 $4827
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $5589
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5586
+LABELV $5573
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 0
+NEI4 $5590
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5593
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $4796
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+GEI4 $5591
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5593
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $5591
+ADDRGP4 $4615
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5590
+LABELV $5591
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5600
+ADDRGP4 cg_scoreBoardStyle+12
+INDIRI4
+CNSTI4 0
+NEI4 $5601
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5604
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRGP4 $5605
+JUMPV
+LABELV $5604
+ADDRGP4 $4613
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 40
+INDIRP4
+ASGNP4
+LABELV $5605
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5601
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2144
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5606
+ADDRLP4 40
+CNSTI4 91
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $5606
+ADDRGP4 cgs+1957744
+INDIRI4
+ADDRLP4 40
+INDIRI4
+GEI4 $5606
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5610
+ADDRGP4 $4982
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $5611
+JUMPV
+LABELV $5610
+ADDRGP4 $4983
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 48
+INDIRP4
+ASGNP4
+LABELV $5611
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5606
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5612
+ADDRGP4 $4986
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRGP4 $5613
+JUMPV
+LABELV $5612
+ADDRGP4 $4987
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+LABELV $5613
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5614
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $5615
+ADDRGP4 $4866
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5615
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+NEI4 $5618
+ADDRGP4 $211
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5618
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5621
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $5622
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5622
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+NEI4 $5625
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5625
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5628
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $5629
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5629
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+NEI4 $5632
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5632
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5635
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $5636
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5636
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+NEI4 $5639
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5639
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5642
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $5643
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5643
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+NEI4 $5646
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5646
+ADDRGP4 $461
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5649
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $5650
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5650
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+NEI4 $5653
+ADDRGP4 $4617
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5653
+ADDRGP4 $260
+RETP4
+ADDRGP4 $5470
+JUMPV
+LABELV $5527
+LABELV $5525
+ADDRGP4 $211
+RETP4
+LABELV $5470
+endproc CG_FeederItemText 64 20
+proc CG_FeederItemImage 0 12
+ADDRGP4 $5658
+ARGP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $5657
+endproc CG_FeederItemImage 0 12
+proc CG_FeederSelection 20 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $5660
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $5664
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5665
+JUMPV
+LABELV $5664
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+LABELV $5665
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $5669
+JUMPV
+LABELV $5666
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $5671
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $5675
+ADDRGP4 cg+610856
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $5675
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5671
+LABELV $5667
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5669
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $5666
+ADDRGP4 $5661
+JUMPV
+LABELV $5660
+ADDRGP4 cg+610856
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $5661
+LABELV $5659
+endproc CG_FeederSelection 20 0
+export CG_Cvar_Get
+proc CG_Cvar_Get 132 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 128
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+RETF4
+LABELV $5679
+endproc CG_Cvar_Get 132 12
+proc CG_InitDC 0 4
+ADDRGP4 cgDC
+ADDRGP4 trap_R_RegisterShaderNoMip
+ASGNP4
+ADDRGP4 cgDC+4
+ADDRGP4 trap_R_SetColor
+ASGNP4
+ADDRGP4 cgDC+8
+ADDRGP4 CG_DrawHandlePicDc
+ASGNP4
+ADDRGP4 cgDC+12
+ADDRGP4 CG_DrawStretchPicDc
+ASGNP4
+ADDRGP4 cgDC+16
+ADDRGP4 CG_DrawTextDc
+ASGNP4
+ADDRGP4 cgDC+20
+ADDRGP4 CG_TextWidthDc
+ASGNP4
+ADDRGP4 cgDC+24
+ADDRGP4 CG_TextHeightDc
+ASGNP4
+ADDRGP4 cgDC+28
+ADDRGP4 trap_R_RegisterModel
+ASGNP4
+ADDRGP4 cgDC+32
+ADDRGP4 trap_R_ModelBounds
+ASGNP4
+ADDRGP4 cgDC+36
+ADDRGP4 CG_FillRectDc
+ASGNP4
+ADDRGP4 cgDC+40
+ADDRGP4 CG_DrawRectDc
+ASGNP4
+ADDRGP4 cgDC+44
+ADDRGP4 CG_DrawSidesDc
+ASGNP4
+ADDRGP4 cgDC+48
+ADDRGP4 CG_DrawTopBottomDc
+ASGNP4
+ADDRGP4 cgDC+52
+ADDRGP4 trap_R_ClearScene
+ASGNP4
+ADDRGP4 cgDC+56
+ADDRGP4 CG_AddRefEntity
+ASGNP4
+ADDRGP4 cgDC+60
+ADDRGP4 trap_R_RenderScene
+ASGNP4
+ADDRGP4 cgDC+64
+ADDRGP4 trap_R_RegisterFont
+ASGNP4
+ADDRGP4 cgDC+68
+ADDRGP4 CG_OwnerDraw
+ASGNP4
+ADDRGP4 cgDC+72
+ADDRGP4 CG_GetValue
+ASGNP4
+ADDRGP4 cgDC+76
+ADDRGP4 CG_OwnerDrawVisible
+ASGNP4
+ADDRGP4 cgDC+80
+ADDRGP4 CG_RunMenuScript
+ASGNP4
+ADDRGP4 cgDC+84
+ADDRGP4 CG_GetTeamColor
+ASGNP4
+ADDRGP4 cgDC+96
+ADDRGP4 trap_Cvar_Set
+ASGNP4
+ADDRGP4 cgDC+88
+ADDRGP4 trap_Cvar_VariableStringBuffer
+ASGNP4
+ADDRGP4 cgDC+92
+ADDRGP4 CG_Cvar_Get
+ASGNP4
+ADDRGP4 cgDC+100
+ADDRGP4 trap_Cvar_Exists
+ASGNP4
+ADDRGP4 cgDC+104
+ADDRGP4 CG_DrawTextWithCursorDc
+ASGNP4
+ADDRGP4 cgDC+108
+ADDRGP4 trap_Key_SetOverstrikeMode
+ASGNP4
+ADDRGP4 cgDC+112
+ADDRGP4 trap_Key_GetOverstrikeMode
+ASGNP4
+ADDRGP4 cgDC+116
+ADDRGP4 trap_S_StartLocalSound
+ASGNP4
+ADDRGP4 cgDC+120
+ADDRGP4 CG_OwnerDrawHandleKey
+ASGNP4
+ADDRGP4 cgDC+124
+ADDRGP4 CG_FeederCount
+ASGNP4
+ADDRGP4 cgDC+132
+ADDRGP4 CG_FeederItemImage
+ASGNP4
+ADDRGP4 cgDC+128
+ADDRGP4 CG_FeederItemText
+ASGNP4
+ADDRGP4 cgDC+136
+ADDRGP4 CG_FeederSelection
+ASGNP4
+ADDRGP4 cgDC+148
+ADDRGP4 trap_Key_SetBinding
+ASGNP4
+ADDRGP4 cgDC+144
+ADDRGP4 trap_Key_GetBindingBuf
+ASGNP4
+ADDRGP4 cgDC+140
+ADDRGP4 trap_Key_KeynumToStringBuf
+ASGNP4
+ADDRGP4 cgDC+152
+ADDRGP4 CG_ExecuteTextDc
+ASGNP4
+ADDRGP4 cgDC+156
+ADDRGP4 Com_Error
+ASGNP4
+ADDRGP4 cgDC+160
+ADDRGP4 Com_Printf
+ASGNP4
+ADDRGP4 cgDC+164
+ADDRGP4 CG_PauseDc
+ASGNP4
+ADDRGP4 cgDC+168
+ADDRGP4 CG_OwnerDrawWidthDc
+ASGNP4
+ADDRGP4 cgDC+172
+ADDRGP4 trap_S_RegisterSound
+ASGNP4
+ADDRGP4 cgDC+176
+ADDRGP4 trap_S_StartBackgroundTrack
+ASGNP4
+ADDRGP4 cgDC+180
+ADDRGP4 trap_S_StopBackgroundTrack
+ASGNP4
+ADDRGP4 cgDC+184
+ADDRGP4 CG_PlayCinematicDc
+ASGNP4
+ADDRGP4 cgDC+188
+ADDRGP4 CG_StopCinematicDc
+ASGNP4
+ADDRGP4 cgDC+192
+ADDRGP4 CG_DrawCinematicDc
+ASGNP4
+ADDRGP4 cgDC+196
+ADDRGP4 CG_RunCinematicFrameDc
+ASGNP4
+ADDRGP4 cgDC
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 Menu_Reset
+CALLV
+pop
+LABELV $5680
+endproc CG_InitDC 0 4
+proc CG_AssetCache 68 4
+ADDRGP4 $5733
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633700
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $5736
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633808
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $5739
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633812
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $5743
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633812+4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $5747
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633812+8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $5751
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633812+12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $5755
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633812+16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $5759
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633812+20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $5763
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633812+24
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $5766
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633720
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $5769
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633708
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $5772
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633704
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $5775
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633712
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $5778
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633716
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $5781
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633724
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $5784
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633740
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $5787
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+236+5633744
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $5730
+endproc CG_AssetCache 68 4
+export CG_ResetTimedItemPickupTimes
+proc CG_ResetTimedItemPickupTimes 8 0
+ADDRLP4 4
+CNSTI4 -999999
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5792
+JUMPV
+LABELV $5789
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+692996+20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+692996+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+692996+24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+692996+28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $5790
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5792
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+692992
+INDIRI4
+LTI4 $5789
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5805
+JUMPV
+LABELV $5802
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+691256+20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+691256+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+691256+24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+691256+28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $5803
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5805
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+691252
+INDIRI4
+LTI4 $5802
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5818
+JUMPV
+LABELV $5815
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+691836+20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+691836+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+691836+24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+691836+28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $5816
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5818
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+691832
+INDIRI4
+LTI4 $5815
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5831
+JUMPV
+LABELV $5828
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+692416+20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+692416+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+692416+24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+692416+28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $5829
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5831
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+692412
+INDIRI4
+LTI4 $5828
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5844
+JUMPV
+LABELV $5841
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+693576+20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+693576+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+693576+24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $5842
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5844
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+693572
+INDIRI4
+LTI4 $5841
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5855
+JUMPV
+LABELV $5852
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+694156+20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+694156+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+694156+24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $5853
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5855
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+694152
+INDIRI4
+LTI4 $5852
+LABELV $5788
+endproc CG_ResetTimedItemPickupTimes 8 0
+export CG_CreateScoresFromClientInfo
+proc CG_CreateScoresFromClientInfo 16 0
+ADDRGP4 cg+610844
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $5865
+ADDRLP4 8
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $5870
+ADDRGP4 $5866
+JUMPV
+LABELV $5870
+ADDRLP4 4
+CNSTI4 92
+ADDRGP4 cg+610844
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+610844
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5866
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $5865
+LABELV $5863
+endproc CG_CreateScoresFromClientInfo 16 0
+lit
+align 4
+LABELV $6067
+address $6068
+address $6069
+address $6070
+address $6071
+address $6072
+address $6073
+address $6074
+address $6075
+address $6076
+address $2506
+address $2580
+address $6077
+align 4
+LABELV $6163
+byte 4 0
+byte 4 1092616192
+byte 4 1091567616
+byte 4 1084227584
+byte 4 1091567616
+byte 4 3231711232
+byte 4 0
+byte 4 3240099840
+byte 4 3239051264
+byte 4 3231711232
+byte 4 3239051264
+byte 4 1084227584
+byte 4 1095761920
+byte 4 1098907648
+byte 4 1101529088
+byte 4 3225419776
+byte 4 1088421888
+byte 4 3248488448
+byte 4 3245342720
+byte 4 3246915584
+byte 4 3249012736
+byte 4 1077936128
+byte 4 3238002688
+byte 4 1101004800
+byte 4 0
+byte 4 1107558400
+byte 4 1102053376
+byte 4 1102053376
+byte 4 1107558400
+byte 4 0
+byte 4 1102053376
+byte 4 3249537024
+byte 4 0
+byte 4 3255042048
+byte 4 3249537024
+byte 4 3249537024
+byte 4 3255042048
+byte 4 0
+byte 4 3249537024
+byte 4 1102053376
+code
+proc CG_Init 1288 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $5876
+ARGP4
+ADDRGP4 $211
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $5877
+ARGP4
+ADDRGP4 $5878
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5879
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cgs
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1969996
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6770188
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_entities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1533400
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $5882
+ARGP4
+ADDRLP4 1044
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1957744
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRGP4 $5883
+ARGP4
+ADDRGP4 cgs+1957744
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 66
+LTI4 $5885
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 71
+GTI4 $5885
+ADDRGP4 cgs+1957748
+CNSTI4 68
+ASGNI4
+ADDRGP4 $5886
+JUMPV
+LABELV $5885
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 73
+EQI4 $5896
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 90
+EQI4 $5896
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+NEI4 $5890
+LABELV $5896
+ADDRGP4 cgs+1957748
+CNSTI4 91
+ASGNI4
+ADDRGP4 $5891
+JUMPV
+LABELV $5890
+ADDRGP4 cgs+1957748
+CNSTI4 91
+ASGNI4
+LABELV $5891
+LABELV $5886
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+NEI4 $5899
+ADDRGP4 PW_NONE
+CNSTI4 0
+ASGNI4
+ADDRGP4 PW_QUAD
+CNSTI4 4
+ASGNI4
+ADDRGP4 PW_BATTLESUIT
+CNSTI4 5
+ASGNI4
+ADDRGP4 PW_HASTE
+CNSTI4 6
+ASGNI4
+ADDRGP4 PW_INVIS
+CNSTI4 7
+ASGNI4
+ADDRGP4 PW_REGEN
+CNSTI4 8
+ASGNI4
+ADDRGP4 PW_FLIGHT
+CNSTI4 9
+ASGNI4
+ADDRGP4 PW_REDFLAG
+CNSTI4 1
+ASGNI4
+ADDRGP4 PW_BLUEFLAG
+CNSTI4 2
+ASGNI4
+ADDRGP4 PW_NEUTRALFLAG
+CNSTI4 3
+ASGNI4
+ADDRGP4 PW_INVULNERABILITY
+CNSTI4 10
+ASGNI4
+ADDRGP4 PW_SCOUT
+CNSTI4 11
+ASGNI4
+ADDRGP4 PW_GUARD
+CNSTI4 12
+ASGNI4
+ADDRGP4 PW_DOUBLER
+CNSTI4 13
+ASGNI4
+ADDRGP4 PW_ARMORREGEN
+CNSTI4 14
+ASGNI4
+ADDRGP4 PW_FROZEN
+CNSTI4 15
+ASGNI4
+ADDRGP4 PW_NUM_POWERUPS
+CNSTI4 16
+ASGNI4
+LABELV $5899
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $5902
+ADDRGP4 bg_itemlist
+ARGP4
+ADDRGP4 bg_itemlistQ3
+ARGP4
+CNSTU4 52
+ADDRGP4 bg_numItemsQ3
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 bg_numItems
+ADDRGP4 bg_numItemsQ3
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+CNSTI4 11
+ASGNI4
+ADDRGP4 WP_NUM_WEAPONS
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_HEALTH
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+CNSTI4 1
+ASGNI4
+ADDRGP4 STAT_HOLDABLE_ITEM
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+CNSTI4 2
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+CNSTI4 3
+ASGNI4
+ADDRGP4 STAT_ARMOR
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 1068
+CNSTI4 5
+ASGNI4
+ADDRGP4 STAT_CLIENTS_READY
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1072
+CNSTI4 6
+ASGNI4
+ADDRGP4 STAT_MAX_HEALTH
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRGP4 PERS_SCORE
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRGP4 PERS_HITS
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRGP4 PERS_RANK
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRGP4 PERS_TEAM
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRGP4 PERS_SPAWN_COUNT
+CNSTI4 4
+ASGNI4
+ADDRGP4 PERS_PLAYEREVENTS
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRGP4 PERS_ATTACKER
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRGP4 PERS_ATTACKEE_ARMOR
+CNSTI4 7
+ASGNI4
+ADDRGP4 PERS_KILLED
+CNSTI4 8
+ASGNI4
+ADDRGP4 PERS_IMPRESSIVE_COUNT
+CNSTI4 9
+ASGNI4
+ADDRGP4 PERS_EXCELLENT_COUNT
+CNSTI4 10
+ASGNI4
+ADDRGP4 PERS_DEFEND_COUNT
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRGP4 PERS_ASSIST_COUNT
+CNSTI4 12
+ASGNI4
+ADDRGP4 PERS_GAUNTLET_FRAG_COUNT
+CNSTI4 13
+ASGNI4
+ADDRGP4 PERS_CAPTURES
+CNSTI4 14
+ASGNI4
+LABELV $5902
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $5905
+CNSTI4 1496
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+176
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1496
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $5906
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $5905
+ADDRGP4 $5910
+ARGP4
+ADDRLP4 1048
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 Q_SetColors
+CALLV
+pop
+ADDRGP4 cg+6706348
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRGP4 cg+4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39672
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39680
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39676
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332840
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+3196856
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+1335112
+CNSTI4 99999
+ASGNI4
+ADDRGP4 cg+1334988
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+1334996
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+3196780
+CNSTI4 3
+ASGNI4
+ADDRGP4 $5924
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+12
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRGP4 $5926
+ARGP4
+ADDRLP4 1056
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRGP4 $5929
+ARGP4
+ADDRLP4 1060
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+4
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRGP4 $5932
+ARGP4
+ADDRLP4 1064
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+8
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $5933
+ADDRGP4 $5938
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1072
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRGP4 tmpImgBuff
+ARGP4
+ADDRLP4 1076
+CNSTI4 64
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+ARGI4
+ADDRLP4 1076
+INDIRI4
+ARGI4
+ADDRLP4 1080
+CNSTI4 0
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+ARGI4
+ADDRLP4 1080
+INDIRI4
+ARGI4
+CNSTI4 33071
+ARGI4
+CNSTI4 -4
+ARGI4
+ADDRLP4 1084
+ADDRGP4 trap_RegisterShaderFromData
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+630584
+ADDP4
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+LABELV $5934
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $5933
+ADDRGP4 $5939
+ARGP4
+ADDRGP4 trap_SendConsoleCommandNow
+CALLV
+pop
+ADDRGP4 CG_RegisterCvars
+CALLV
+pop
+ADDRGP4 CG_RegisterFonts
+CALLV
+pop
+ADDRGP4 CG_InitConsoleCommands
+CALLV
+pop
+ADDRGP4 cg+609312
+CNSTI4 2
+ASGNI4
+ADDRLP4 1068
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+43252
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+43248
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+43256
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+20100
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRGP4 cgs+39664
+ADDRGP4 cgs+20100+19496
+INDIRI4
+CVIF4 4
+CNSTF4 1142947840
+DIVF4
+ASGNF4
+ADDRGP4 cgs+39668
+ADDRGP4 cgs+20100+19500
+INDIRI4
+CVIF4 4
+CNSTF4 1139802112
+DIVF4
+ASGNF4
+ADDRGP4 cgDC+5634196
+ARGP4
+ADDRGP4 cgs+20100
+ARGP4
+CNSTU4 19564
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cgDC+5653776
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 $5955
+ARGP4
+ADDRGP4 trap_SendConsoleCommandNow
+CALLV
+pop
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+ADDRGP4 cgs+1969972
+CNSTF4 1147207680
+ASGNF4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $5957
+ADDRGP4 cgs+1969972
+CNSTF4 1145569280
+ASGNF4
+CNSTI4 12
+ARGI4
+ADDRLP4 1072
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 $5963
+ARGP4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $5961
+ADDRGP4 cgs+1957752
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1080
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1080
+INDIRP4
+ARGP4
+ADDRGP4 $5965
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1084
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+1957764
+CNSTI1 0
+ASGNI1
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $5967
+ARGP4
+ADDRGP4 cgs+1957756
+ARGP4
+ADDRGP4 cgs+1957760
+ARGP4
+ADDRGP4 cgs+1957764
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRGP4 bg_itemlist
+ARGP4
+ADDRGP4 bg_itemlistCpma
+ARGP4
+CNSTU4 52
+ADDRGP4 bg_numItemsCpma
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 bg_numItems
+ADDRGP4 bg_numItemsCpma
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_ARMOR_TIER
+CNSTI4 9
+ASGNI4
+ADDRGP4 $5971
+ARGP4
+ADDRGP4 cgs+1957756
+INDIRI4
+ARGI4
+ADDRGP4 cgs+1957760
+INDIRI4
+ARGI4
+ADDRGP4 cgs+1957764
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5958
+JUMPV
+LABELV $5961
+CNSTI4 0
+ARGI4
+ADDRLP4 1080
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1080
+INDIRP4
+ARGP4
+ADDRGP4 $5978
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5977
+ARGP4
+ADDRLP4 1084
+INDIRP4
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+CNSTI4 0
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+ADDRLP4 1092
+INDIRI4
+EQI4 $5979
+ADDRLP4 1092
+INDIRI4
+ARGI4
+ADDRLP4 1096
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+ARGP4
+ADDRGP4 $5965
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5977
+ARGP4
+ADDRLP4 1104
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1100
+INDIRP4
+ARGP4
+ADDRGP4 $5977
+ARGP4
+ADDRLP4 1104
+INDIRU4
+CNSTU4 1
+SUBU4
+CVUI4 4
+ARGI4
+ADDRLP4 1108
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $5975
+LABELV $5979
+ADDRGP4 cgs+1957780
+CNSTI4 1
+ASGNI4
+CNSTI4 872
+ARGI4
+ADDRLP4 1112
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1957784
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRGP4 bg_itemlist
+ARGP4
+ADDRGP4 bg_itemlistCpma
+ARGP4
+CNSTU4 52
+ADDRGP4 bg_numItemsCpma
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 bg_numItems
+ADDRGP4 bg_numItemsCpma
+INDIRI4
+ASGNI4
+ADDRGP4 $5982
+ARGP4
+ADDRGP4 cgs+1957784
+INDIRI4
+CNSTI4 0
+EQI4 $5986
+ADDRLP4 1120
+ADDRGP4 $5984
+ASGNP4
+ADDRGP4 $5987
+JUMPV
+LABELV $5986
+ADDRLP4 1120
+ADDRGP4 $211
+ASGNP4
+LABELV $5987
+ADDRLP4 1120
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $5958
+JUMPV
+LABELV $5975
+CNSTI4 0
+ARGI4
+ADDRLP4 1112
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRGP4 $5978
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5990
+ARGP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $5988
+ADDRGP4 cgs+1957788
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5958
+JUMPV
+LABELV $5988
+CNSTI4 0
+ARGI4
+ADDRLP4 1124
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1124
+INDIRP4
+ARGP4
+ADDRGP4 $5994
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5958
+ADDRGP4 cgs+1957788
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5958
+JUMPV
+LABELV $5957
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 73
+NEI4 $5996
+ADDRGP4 bg_itemlist
+ARGP4
+ADDRGP4 bg_itemlistQldm73
+ARGP4
+CNSTU4 52
+ADDRGP4 bg_numItemsQldm73
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 bg_numItems
+ADDRGP4 bg_numItemsQldm73
+INDIRI4
+ASGNI4
+ADDRGP4 WP_NUM_WEAPONS
+CNSTI4 14
+ASGNI4
+ADDRGP4 $5997
+JUMPV
+LABELV $5996
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+NEI4 $5999
+ADDRGP4 bg_itemlist
+ARGP4
+ADDRGP4 bg_itemlistQldm91
+ARGP4
+CNSTU4 52
+ADDRGP4 bg_numItemsQldm91
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 bg_numItems
+ADDRGP4 bg_numItemsQldm91
+INDIRI4
+ASGNI4
+LABELV $5999
+LABELV $5997
+LABELV $5958
+ADDRGP4 cgs+1957788
+INDIRI4
+CNSTI4 0
+EQI4 $6002
+ADDRGP4 $6005
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $6002
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $6006
+CNSTI4 0
+ARGI4
+ADDRLP4 1072
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRGP4 $6008
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $6008
+ARGP4
+ADDRLP4 1076
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 1080
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1080
+INDIRP4
+ARGP4
+ADDRGP4 $6009
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $6009
+ARGP4
+ADDRLP4 1084
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 1088
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+ADDRGP4 $6010
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $6010
+ARGP4
+ADDRLP4 1092
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $6006
+CNSTI4 12
+ARGI4
+ADDRLP4 1072
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1072
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $6013
+ARGP4
+ADDRLP4 1076
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+EQI4 $6011
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $6014
+ARGP4
+ADDRLP4 1080
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+EQI4 $6011
+ADDRGP4 $6015
+ARGP4
+ADDRGP4 $6013
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $6011
+CNSTI4 13
+ARGI4
+ADDRLP4 1084
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1084
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 1088
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43236
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $6017
+ADDRGP4 $6020
+ARGP4
+ADDRGP4 cgs+1957476
+INDIRI4
+CNSTI4 0
+EQI4 $6031
+ADDRLP4 1092
+ADDRGP4 $6022
+ASGNP4
+ADDRGP4 $6032
+JUMPV
+LABELV $6031
+ADDRLP4 1092
+ADDRGP4 $211
+ASGNP4
+LABELV $6032
+ADDRLP4 1092
+INDIRP4
+ARGP4
+ADDRGP4 cgs+1957480
+INDIRI4
+ARGI4
+ADDRGP4 cgs+1957480+4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+1957480+8
+INDIRI4
+ARGI4
+ADDRGP4 cgs+1957480+12
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $6017
+ADDRGP4 CG_ParseWarmup
+CALLV
+pop
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $6033
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $6036
+ADDRGP4 cg+3874628
+CNSTI4 1
+ASGNI4
+LABELV $6036
+ADDRGP4 cg+3874632
+ADDRGP4 cgs+43236
+INDIRI4
+ASGNI4
+LABELV $6033
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $6042
+ADDRGP4 CG_PrefetchPlayerModels
+CALLV
+pop
+LABELV $6042
+ADDRGP4 $6045
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 $6046
+ARGP4
+ADDRGP4 cgs+39732
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $6050
+ARGP4
+ADDRLP4 1092
+ADDRGP4 SC_Cvar_Get_String
+CALLP4
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $6048
+ADDRGP4 $6050
+ARGP4
+ADDRLP4 1096
+ADDRGP4 SC_Cvar_Get_String
+CALLP4
+ASGNP4
+ADDRGP4 cgs+39732
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $6053
+ARGP4
+ADDRLP4 1096
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $6054
+ARGP4
+ADDRGP4 cgs+39732
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $6048
+ADDRGP4 cgs+39732
+ARGP4
+ADDRGP4 cgs+39796
+ARGP4
+CNSTU4 64
+ARGU4
+ADDRGP4 trap_GetRealMapName
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 cgs+39796
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 1096
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 1096
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8-1
+ADDP4
+CNSTI1 103
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8-2
+ADDP4
+CNSTI1 102
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8-3
+ADDP4
+CNSTI1 99
+ASGNI1
+ADDRGP4 $6063
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 cgs+39732
+ARGP4
+ADDRGP4 trap_CM_LoadMap
+CALLV
+pop
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRGP4 cg+24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $6066
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRLP4 1108
+ADDRGP4 $6067
+INDIRB
+ASGNB 48
+ADDRGP4 cg+1332112
+CNSTI4 0
+ASGNI4
+ADDRLP4 1104
+CNSTI4 0
+ASGNI4
+ADDRGP4 $6082
+JUMPV
+LABELV $6079
+ADDRLP4 1104
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1108
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1160
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332112
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+1331600
+ADDP4
+ADDRLP4 1156
+INDIRI4
+ASGNI4
+ADDRLP4 1164
+ADDRGP4 cg+1332112
+ASGNP4
+ADDRLP4 1164
+INDIRP4
+ADDRLP4 1164
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $6086
+ARGP4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1108
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1156
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $6080
+ADDRLP4 1104
+ADDRLP4 1104
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $6082
+ADDRLP4 1104
+INDIRI4
+CVIU4 4
+CNSTU4 12
+LTU4 $6079
+ADDRGP4 CG_RegisterSounds
+CALLV
+pop
+ADDRGP4 $6087
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $6088
+ADDRLP4 1104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $6094
+JUMPV
+LABELV $6091
+ADDRLP4 0
+CNSTI4 52
+ADDRLP4 1104
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $6095
+ADDRGP4 $6092
+JUMPV
+LABELV $6095
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+ARGI4
+ADDRGP4 CG_LoadingItem
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+CNSTI4 132
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $6092
+ADDRLP4 1104
+ADDRLP4 1104
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $6094
+ADDRLP4 1104
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $6091
+LABELV $6088
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $6105
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+EQI4 $6105
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $6105
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $6097
+LABELV $6105
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $6106
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $6113
+JUMPV
+LABELV $6110
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $6115
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $6115
+ADDRGP4 $6112
+JUMPV
+LABELV $6115
+LABELV $6111
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $6113
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $6110
+LABELV $6112
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $6117
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+GEI4 $6117
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $6117
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+ARGI4
+ADDRGP4 CG_LoadingItem
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+LABELV $6117
+LABELV $6107
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+LTI4 $6106
+ADDRGP4 $6098
+JUMPV
+LABELV $6097
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $6122
+JUMPV
+LABELV $6119
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+EQI4 $6123
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+EQI4 $6123
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $6123
+ADDRGP4 $6120
+JUMPV
+LABELV $6123
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $6128
+JUMPV
+LABELV $6125
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $6130
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $6130
+ADDRGP4 $6127
+JUMPV
+LABELV $6130
+LABELV $6126
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $6128
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $6125
+LABELV $6127
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $6132
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+GEI4 $6132
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $6132
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+ARGI4
+ADDRGP4 CG_LoadingItem
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+LABELV $6132
+LABELV $6120
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $6122
+ADDRLP4 4
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $6119
+LABELV $6098
+ADDRGP4 CG_RegisterGraphics
+CALLV
+pop
+ADDRGP4 $6134
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterClients
+CALLV
+pop
+ADDRGP4 CG_CreateScoresFromClientInfo
+CALLV
+pop
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+ADDRGP4 CG_AssetCache
+CALLV
+pop
+ADDRGP4 cg+24
+CNSTI4 0
+ASGNI4
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 cg+609816
+CNSTI1 0
+ASGNI1
+ADDRGP4 CG_SetConfigValues
+CALLV
+pop
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 $211
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_InitTeamChat
+CALLV
+pop
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $6137
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_EventHandling
+CALLV
+pop
+CNSTI4 8
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+LABELV $6137
+ADDRGP4 CG_ParseSpawnVars
+CALLI4
+pop
+ADDRGP4 CG_ResetTimedItemPickupTimes
+CALLV
+pop
+ADDRGP4 CG_InitDC
+CALLV
+pop
+ADDRGP4 CG_LoadDefaultMenus
+CALLV
+pop
+ADDRGP4 $630
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1036
+ADDRLP4 8
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $6140
+ADDRLP4 1036
+ADDRGP4 $631
+ASGNP4
+LABELV $6140
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadMenus
+CALLV
+pop
+ADDRGP4 cg+6747388
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+1957504
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+1957580
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $6145
+LABELV $6145
+ADDRGP4 cg_fxfile+16
+ARGP4
+ADDRGP4 CG_ReloadQ3mmeScripts
+CALLV
+pop
+ADDRGP4 CG_CreateNameSprites
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $6149
+ADDRGP4 cgs+1960920
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $6149
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $6149
+ADDRGP4 CG_LoadInfectedGameTypeModels
+CALLV
+pop
+LABELV $6149
+ADDRGP4 $6154
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $6157
+ARGP4
+ADDRLP4 1104
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+EQI4 $6155
+ADDRGP4 cg+609816
+CNSTI1 0
+ASGNI1
+ADDRLP4 1108
+ADDRGP4 cgs+39680
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+ADDRLP4 1108
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $6155
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $6160
+ADDRGP4 CG_SetDuelPlayers
+CALLV
+pop
+LABELV $6160
+ADDRLP4 1108
+ADDRGP4 $6163
+INDIRB
+ASGNB 160
+ADDRLP4 1268
+CNSTF4 1065568309
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $6164
+ADDRLP4 1272
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+ADDRLP4 1108
+ADDP4
+INDIRF4
+ADDRLP4 1268
+INDIRF4
+MULF4
+ARGF4
+CNSTF4 1133668598
+ARGF4
+ADDRLP4 1276
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 cg+3874640
+ADDP4
+CNSTF4 1127481344
+ADDRLP4 1276
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRLP4 1280
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+ADDRLP4 1108+4
+ADDP4
+INDIRF4
+ADDRLP4 1268
+INDIRF4
+MULF4
+ARGF4
+CNSTF4 1133668598
+ARGF4
+ADDRLP4 1284
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 1280
+INDIRI4
+ADDRGP4 cg+3874640+4
+ADDP4
+CNSTF4 1127481344
+ADDRLP4 1284
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+LABELV $6165
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+LTI4 $6164
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $6172
+ADDRGP4 cgs+1960916
+ARGP4
+ADDRGP4 cgs+1957844
+ARGP4
+ADDRGP4 trap_Get_Demo_Timeouts
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $6181
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $6177
+LABELV $6181
+ADDRGP4 cg+6770156
+ARGP4
+ADDRGP4 cg+6769132
+ARGP4
+ADDRGP4 trap_GetRoundStartTimes
+CALLV
+pop
+LABELV $6177
+LABELV $6172
+ADDRGP4 demo+4+12
+CNSTI4 3
+ASGNI4
+ADDRGP4 demo+4+68
+CNSTI4 2
+ASGNI4
+ADDRGP4 demo+4+72
+CNSTI4 1
+ASGNI4
+ADDRGP4 demo+4+8
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $315
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 cg+6747464
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $6193
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $5875
+endproc CG_Init 1288 32
+export CG_LoadDefaultMenus
+proc CG_LoadDefaultMenus 0 4
+ADDRGP4 cg_loadDefaultMenus+12
+INDIRI4
+CNSTI4 0
+NEI4 $6195
+ADDRGP4 $6194
+JUMPV
+LABELV $6195
+ADDRGP4 $6198
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $6199
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6200
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6201
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6202
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6203
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6204
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6205
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6206
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6207
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+NEI4 $6208
+ADDRGP4 $6211
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6212
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6209
+JUMPV
+LABELV $6208
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $6213
+ADDRGP4 $6216
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6217
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6214
+JUMPV
+LABELV $6213
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+NEI4 $6218
+ADDRGP4 $6221
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6222
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6219
+JUMPV
+LABELV $6218
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $6223
+ADDRGP4 $6226
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6227
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6224
+JUMPV
+LABELV $6223
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $6232
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $6228
+LABELV $6232
+ADDRGP4 $6233
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6234
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6229
+JUMPV
+LABELV $6228
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $6235
+ADDRGP4 $6238
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6239
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6236
+JUMPV
+LABELV $6235
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $6240
+ADDRGP4 $6243
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6244
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6241
+JUMPV
+LABELV $6240
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $6245
+ADDRGP4 $6248
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6249
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6246
+JUMPV
+LABELV $6245
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+NEI4 $6250
+ADDRGP4 $6253
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6254
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6251
+JUMPV
+LABELV $6250
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $6255
+ADDRGP4 $6258
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6259
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6256
+JUMPV
+LABELV $6255
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $6260
+ADDRGP4 $6211
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6212
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6261
+JUMPV
+LABELV $6260
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $6263
+ADDRGP4 $6266
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+ADDRGP4 $6267
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+LABELV $6263
+LABELV $6261
+LABELV $6256
+LABELV $6251
+LABELV $6246
+LABELV $6241
+LABELV $6236
+LABELV $6229
+LABELV $6224
+LABELV $6219
+LABELV $6214
+LABELV $6209
+LABELV $6194
+endproc CG_LoadDefaultMenus 0 4
+proc CG_Shutdown 0 4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ShutdownLocalEnts
+CALLV
+pop
+ADDRGP4 cg+1332744
+INDIRI4
+CNSTI4 0
+EQI4 $6269
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 cg+1332744
+CNSTI4 0
+ASGNI4
+LABELV $6269
+ADDRGP4 cg+6706344
+INDIRI4
+CNSTI4 0
+EQI4 $6274
+ADDRGP4 cg+6706344
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 cg+6706344
+CNSTI4 0
+ASGNI4
+LABELV $6274
+ADDRGP4 CG_FreeFxJitTokens
+CALLV
+pop
+ADDRGP4 $6279
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $6268
+endproc CG_Shutdown 0 4
+export CG_SetDuelPlayers
+proc CG_SetDuelPlayers 20 16
+ADDRGP4 cg+3848208
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+3848212
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 719
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $6283
+ADDRGP4 cg+3848196
+INDIRI4
+CNSTI4 0
+LEI4 $6285
+ADDRGP4 cg+3848208
+ADDRGP4 cg+3196932
+INDIRI4
+ASGNI4
+LABELV $6285
+ADDRGP4 cg+3848196
+INDIRI4
+CNSTI4 1
+LEI4 $6290
+ADDRGP4 cg+3848212
+ADDRGP4 cg+3196932+5088
+INDIRI4
+ASGNI4
+LABELV $6290
+ADDRGP4 cg+3848196
+INDIRI4
+CNSTI4 0
+LEI4 $6296
+ADDRGP4 $6280
+JUMPV
+LABELV $6296
+LABELV $6283
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $6299
+ADDRLP4 12
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $6303
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $6303
+ADDRGP4 cg+3848208
+INDIRI4
+CNSTI4 -1
+NEI4 $6308
+ADDRGP4 cg+3848208
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $6309
+JUMPV
+LABELV $6308
+ADDRGP4 cg+3848212
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $6301
+JUMPV
+LABELV $6309
+LABELV $6303
+LABELV $6300
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $6299
+LABELV $6301
+LABELV $6280
+endproc CG_SetDuelPlayers 20 16
+bss
+align 1
+LABELV tmpImgBuff
+skip 16384
+export cg_hudFiles
+align 4
+LABELV cg_hudFiles
+skip 272
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import CG_SpawnRailTrail
+import CG_AddWeaponWithPowerups
+import CG_MachinegunSpinAngle
+import CG_MapTorsoToWeaponFrame
+import CG_Bullet
+import CG_GetWeaponFlashOrigin
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_OutOfAmmoChange
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_DrawWeaponSelect
+import CG_AddViewWeapon
+import CG_AddPlayerWeapon
+import CG_LightningBolt
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_SimpleRailTrail
+import CG_DrawActiveFrame
+import CG_AdjustOriginToAvoidSolid
+import CG_CalcSpline
+import CG_AddBufferedSound
+import CG_AdjustedFov
+import CG_CalcZoom
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_CalcVrect
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_ParseSpawnVars
+import CG_NextNextSnapshot
+import CG_SnapshotRefEntity
+import CG_UpdateSnapshotRef
+import CG_SnapshotRefValid
+import CG_GetSnapshotRef
+import CG_PeekSnapshot
+import CG_GetSnapshot
+import CG_ProcessSnapshots
+import CG_ResetTimeChange
+import CG_ResetEntity
+import CG_PlayWinLossMusic
+import CG_CpmaParseGameState
+import CG_CpmaParseScores
+import CG_ExecuteNewServerCommands
+import CG_InterMissionHit
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseWarmup
+import CG_ParseServerinfo
+import CG_LoadInfectedGameTypeModels
+import CG_Q3mmeCameraResetInternalLengths
+import CG_Q3mmeCameraParse
+import CG_Q3mmeCameraSave
+import CG_Q3mmeDemoCameraCommand_f
+import CG_Q3mmeCameraDrawPath
+import CG_Q3mmeCameraFovAt
+import CG_Q3mmeCameraAnglesAt
+import CG_Q3mmeCameraOriginAt
+import CG_Q3mmeCameraPointAdd
+import demo
+import BG_XMLParse
+import BG_XMLOpen
+import BG_XMLWarning
+import BG_XMLError
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_GetTeamColor
+import CG_RunMenuScript
+import CG_ShowResponseHead
+import CG_KeyEvent
+import CG_EventHandling
+import CG_MouseEvent
+import CG_OwnerDraw
+import CG_GetServerTimeFromClockString
+import CG_GetLevelTimerString
+import CG_GetCurrentTimeWithDirection
+import CG_DrawWeaponBar
+import CG_Text_Paint_Align
+import CG_Text_Paint_Limit_Bottom
+import CG_Text_Paint_Limit
+import CG_Text_Length
+import CG_GameTypeString
+import CG_GetGameStatusText
+import CG_GetKillerText
+import CG_OwnerDrawVisible
+import CG_YourTeamHasFlag
+import CG_OtherTeamHasFlag
+import CG_GetValue
+import CG_SelectPrevPlayer
+import CG_SelectNextPlayer
+import CG_CheckOrderPending
+import CG_SetPrintString
+import CG_InitTeamChat
+import MenuRect
+import QLWideScreen
+import MenuWidescreen
+import CG_NewParticleArea
+import CG_ParticleExplosion
+import CG_AddParticles
+import CG_ClearParticles
+import CG_AddMarks
+import CG_ImpactMark
+import CG_InitMarkPolys
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_ShutdownLocalEnts
+import CG_GetStoredScriptVarsFromLE
+import CG_RunFxAll
+import CG_SmokePuff_ql
+import CG_AddRefEntityFX
+import CG_AddRefEntity
+import CG_ListLocalEntities
+import CG_RemoveFXLocalEntities
+import CG_ClearLocalFrameEntities
+import CG_CullGrid
+import CG_AddToCullGrid
+import CG_BeginCullGrid
+import CG_AddLocalEntities
+import CG_MakeLowPriorityEntity
+import CG_AllocLocalEntityRealTime
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import FxLoopSounds
+import CG_FreeFxJitTokens
+import CG_ResetFXIntervalAndDistance
+import CG_UpdatePositionData
+import CG_CopyPositionDataToScript
+import CG_CopyPositionDataToCent
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+import CG_CopyPlayerDataToScriptData
+import CG_ResetScriptVars
+import CG_ReloadQ3mmeScripts
+import CG_RunQ3mmeScript
+import CG_Q3mmeMath
+import EffectScripts
+import PlainScript
+import DistanceScript
+import EmitterScript
+import EmitterScriptVars
+import ScriptVars
+import CG_DrawInformation
+import CG_LoadingFutureClient
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import UI_DrawProportionalString3
+import UI_DrawProportionalString
+import CG_ColorForHealth
+import CG_GetColorForHealth
+import CG_TeamColor
+import CG_FadeColorVec4
+import CG_FadeColorRealTime
+import CG_FadeColor
+import CG_TileClear
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawStretchPic
+import CG_DrawPic
+import CG_DrawRect
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_ExecuteTextDc
+import CG_PauseDc
+import CG_RunCinematicFrameDc
+import CG_DrawCinematicDc
+import CG_StopCinematicDc
+import CG_PlayCinematicDc
+import CG_OwnerDrawWidthDc
+import CG_DrawTextWithCursorDc
+import CG_DrawTopBottomDc
+import CG_DrawSidesDc
+import CG_DrawRectDc
+import CG_FillRectDc
+import CG_TextHeightDc
+import CG_TextWidthDc
+import CG_DrawTextDc
+import CG_DrawStretchPicDc
+import CG_DrawHandlePicDc
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_StartidCamera
+import CG_ChangeConfigString
+import CG_CleanUpFieldNumber
+import CG_EchoPopup
+import CG_ErrorPopup
+import CG_AdjustTimeForTimeouts
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+export cg_cullLocalEntities
+align 4
+LABELV cg_cullLocalEntities
+skip 272
+export cg_sceneBatching
+align 4
+LABELV cg_sceneBatching
+skip 272
+export cg_useScoresUpdateTeam
+align 4
+LABELV cg_useScoresUpdateTeam
+skip 272
+export cg_drawKeyPress
+align 4
+LABELV cg_drawKeyPress
+skip 272
+export cg_specOffsetQL
+align 4
+LABELV cg_specOffsetQL
+skip 272
+export cg_useDemoFov
+align 4
+LABELV cg_useDemoFov
+skip 272
+export cg_rewardPerfect
+align 4
+LABELV cg_rewardPerfect
+skip 272
+export cg_rewardFirstFrag
+align 4
+LABELV cg_rewardFirstFrag
+skip 272
+export cg_rewardQuadGod
+align 4
+LABELV cg_rewardQuadGod
+skip 272
+export cg_rewardAccuracy
+align 4
+LABELV cg_rewardAccuracy
+skip 272
+export cg_rewardHeadshot
+align 4
+LABELV cg_rewardHeadshot
+skip 272
+export cg_rewardPerforated
+align 4
+LABELV cg_rewardPerforated
+skip 272
+export cg_rewardRevenge
+align 4
+LABELV cg_rewardRevenge
+skip 272
+export cg_rewardMidAir
+align 4
+LABELV cg_rewardMidAir
+skip 272
+export cg_rewardRampage
+align 4
+LABELV cg_rewardRampage
+skip 272
+export cg_rewardComboKill
+align 4
+LABELV cg_rewardComboKill
+skip 272
+export cg_rewardAssist
+align 4
+LABELV cg_rewardAssist
+skip 272
+export cg_rewardDefend
+align 4
+LABELV cg_rewardDefend
+skip 272
+export cg_rewardHumiliation
+align 4
+LABELV cg_rewardHumiliation
+skip 272
+export cg_rewardExcellent
+align 4
+LABELV cg_rewardExcellent
+skip 272
+export cg_rewardImpressive
+align 4
+LABELV cg_rewardImpressive
+skip 272
+export cg_rewardCapture
+align 4
+LABELV cg_rewardCapture
+skip 272
+export cg_winLossMusic
+align 4
+LABELV cg_winLossMusic
+skip 272
+export cg_drawFightMessage
+align 4
+LABELV cg_drawFightMessage
+skip 272
+export cg_soundBuffer
+align 4
+LABELV cg_soundBuffer
+skip 272
+export cg_soundPvs
+align 4
+LABELV cg_soundPvs
+skip 272
+export cg_cpmaSound
+align 4
+LABELV cg_cpmaSound
+skip 272
+export cg_quadSoundRate
+align 4
+LABELV cg_quadSoundRate
+skip 272
+export cg_racePlayerShader
+align 4
+LABELV cg_racePlayerShader
+skip 272
+export cg_drawHitFriendTime
+align 4
+LABELV cg_drawHitFriendTime
+skip 272
+export cg_drawDeadFriendTime
+align 4
+LABELV cg_drawDeadFriendTime
+skip 272
+export cg_drawTieredArmorAvailability
+align 4
+LABELV cg_drawTieredArmorAvailability
+skip 272
+export cg_rocketAimBot
+align 4
+LABELV cg_rocketAimBot
+skip 272
+export cg_spectatorListQue
+align 4
+LABELV cg_spectatorListQue
+skip 272
+export cg_spectatorListScore
+align 4
+LABELV cg_spectatorListScore
+skip 272
+export cg_spectatorListSkillRating
+align 4
+LABELV cg_spectatorListSkillRating
+skip 272
+export cg_headShots
+align 4
+LABELV cg_headShots
+skip 272
+export cg_roundScoreBoard
+align 4
+LABELV cg_roundScoreBoard
+skip 272
+export cg_drawDominationPointStatusWideScreen
+align 4
+LABELV cg_drawDominationPointStatusWideScreen
+skip 272
+export cg_drawDominationPointStatusTextStyle
+align 4
+LABELV cg_drawDominationPointStatusTextStyle
+skip 272
+export cg_drawDominationPointStatusTextAlpha
+align 4
+LABELV cg_drawDominationPointStatusTextAlpha
+skip 272
+export cg_drawDominationPointStatusTextColor
+align 4
+LABELV cg_drawDominationPointStatusTextColor
+skip 272
+export cg_drawDominationPointStatusAlpha
+align 4
+LABELV cg_drawDominationPointStatusAlpha
+skip 272
+export cg_drawDominationPointStatusBackgroundColor
+align 4
+LABELV cg_drawDominationPointStatusBackgroundColor
+skip 272
+export cg_drawDominationPointStatusTeamColor
+align 4
+LABELV cg_drawDominationPointStatusTeamColor
+skip 272
+export cg_drawDominationPointStatusEnemyColor
+align 4
+LABELV cg_drawDominationPointStatusEnemyColor
+skip 272
+export cg_drawDominationPointStatusScale
+align 4
+LABELV cg_drawDominationPointStatusScale
+skip 272
+export cg_drawDominationPointStatusPointSize
+align 4
+LABELV cg_drawDominationPointStatusPointSize
+skip 272
+export cg_drawDominationPointStatusFont
+align 4
+LABELV cg_drawDominationPointStatusFont
+skip 272
+export cg_drawDominationPointStatusY
+align 4
+LABELV cg_drawDominationPointStatusY
+skip 272
+export cg_drawDominationPointStatusX
+align 4
+LABELV cg_drawDominationPointStatusX
+skip 272
+export cg_drawDominationPointStatus
+align 4
+LABELV cg_drawDominationPointStatus
+skip 272
+export cg_attackDefendVoiceStyle
+align 4
+LABELV cg_attackDefendVoiceStyle
+skip 272
+export cg_dominationPointNeutralAlpha
+align 4
+LABELV cg_dominationPointNeutralAlpha
+skip 272
+export cg_dominationPointNeutralColor
+align 4
+LABELV cg_dominationPointNeutralColor
+skip 272
+export cg_dominationPointEnemyAlpha
+align 4
+LABELV cg_dominationPointEnemyAlpha
+skip 272
+export cg_dominationPointEnemyColor
+align 4
+LABELV cg_dominationPointEnemyColor
+skip 272
+export cg_dominationPointTeamAlpha
+align 4
+LABELV cg_dominationPointTeamAlpha
+skip 272
+export cg_dominationPointTeamColor
+align 4
+LABELV cg_dominationPointTeamColor
+skip 272
+export cg_helpIconMaxWidth
+align 4
+LABELV cg_helpIconMaxWidth
+skip 272
+export cg_helpIconMinWidth
+align 4
+LABELV cg_helpIconMinWidth
+skip 272
+export cg_helpIconStyle
+align 4
+LABELV cg_helpIconStyle
+skip 272
+export cg_helpIcon
+align 4
+LABELV cg_helpIcon
+skip 272
+export cg_flagTakenSound
+align 4
+LABELV cg_flagTakenSound
+skip 272
+export cg_flagStyle
+align 4
+LABELV cg_flagStyle
+skip 272
+export cg_buzzerSound
+align 4
+LABELV cg_buzzerSound
+skip 272
+export cg_powerupLight
+align 4
+LABELV cg_powerupLight
+skip 272
+export cg_allowServerOverride
+align 4
+LABELV cg_allowServerOverride
+skip 272
+export cg_playerModelAllowServerOverride
+align 4
+LABELV cg_playerModelAllowServerOverride
+skip 272
+export cg_playerModelAllowServerScaleDefault
+align 4
+LABELV cg_playerModelAllowServerScaleDefault
+skip 272
+export cg_playerModelAllowServerScale
+align 4
+LABELV cg_playerModelAllowServerScale
+skip 272
+export cg_playerModelAutoScaleHeight
+align 4
+LABELV cg_playerModelAutoScaleHeight
+skip 272
+export cg_playerModelForceHeadOffset
+align 4
+LABELV cg_playerModelForceHeadOffset
+skip 272
+export cg_playerModelForceHeadScale
+align 4
+LABELV cg_playerModelForceHeadScale
+skip 272
+export cg_playerModelForceTorsoScale
+align 4
+LABELV cg_playerModelForceTorsoScale
+skip 272
+export cg_playerModelForceLegsScale
+align 4
+LABELV cg_playerModelForceLegsScale
+skip 272
+export cg_playerModelForceScale
+align 4
+LABELV cg_playerModelForceScale
+skip 272
+export cg_dumpEntsUseServerTime
+align 4
+LABELV cg_dumpEntsUseServerTime
+skip 272
+export cg_pathSkipNum
+align 4
+LABELV cg_pathSkipNum
+skip 272
+export cg_pathRewindTime
+align 4
+LABELV cg_pathRewindTime
+skip 272
+export cg_stepSmoothMaxChange
+align 4
+LABELV cg_stepSmoothMaxChange
+skip 272
+export cg_stepSmoothTime
+align 4
+LABELV cg_stepSmoothTime
+skip 272
+export cg_demoStepSmoothing
+align 4
+LABELV cg_demoStepSmoothing
+skip 272
+export cg_customMirrorSurfaces
+align 4
+LABELV cg_customMirrorSurfaces
+skip 272
+export cg_drawProxWarningWideScreen
+align 4
+LABELV cg_drawProxWarningWideScreen
+skip 272
+export cg_drawProxWarningAlpha
+align 4
+LABELV cg_drawProxWarningAlpha
+skip 272
+export cg_drawProxWarningColor
+align 4
+LABELV cg_drawProxWarningColor
+skip 272
+export cg_drawProxWarningScale
+align 4
+LABELV cg_drawProxWarningScale
+skip 272
+export cg_drawProxWarningPointSize
+align 4
+LABELV cg_drawProxWarningPointSize
+skip 272
+export cg_drawProxWarningFont
+align 4
+LABELV cg_drawProxWarningFont
+skip 272
+export cg_drawProxWarningStyle
+align 4
+LABELV cg_drawProxWarningStyle
+skip 272
+export cg_drawProxWarningAlign
+align 4
+LABELV cg_drawProxWarningAlign
+skip 272
+export cg_drawProxWarningY
+align 4
+LABELV cg_drawProxWarningY
+skip 272
+export cg_drawProxWarningX
+align 4
+LABELV cg_drawProxWarningX
+skip 272
+export cg_drawProxWarning
+align 4
+LABELV cg_drawProxWarning
+skip 272
+export cg_proxMineTick
+align 4
+LABELV cg_proxMineTick
+skip 272
+export cg_firstPersonSwitchSound
+align 4
+LABELV cg_firstPersonSwitchSound
+skip 272
+export cg_debugAds
+align 4
+LABELV cg_debugAds
+skip 272
+export cg_adShaderOverride
+align 4
+LABELV cg_adShaderOverride
+skip 272
+export cg_playerShader
+align 4
+LABELV cg_playerShader
+skip 272
+export cg_whEnemyAlpha
+align 4
+LABELV cg_whEnemyAlpha
+skip 272
+export cg_whEnemyColor
+align 4
+LABELV cg_whEnemyColor
+skip 272
+export cg_whEnemyShader
+align 4
+LABELV cg_whEnemyShader
+skip 272
+export cg_whAlpha
+align 4
+LABELV cg_whAlpha
+skip 272
+export cg_whColor
+align 4
+LABELV cg_whColor
+skip 272
+export cg_whShader
+align 4
+LABELV cg_whShader
+skip 272
+export cg_whIncludeProjectile
+align 4
+LABELV cg_whIncludeProjectile
+skip 272
+export cg_whIncludeDeadBody
+align 4
+LABELV cg_whIncludeDeadBody
+skip 272
+export cg_wh
+align 4
+LABELV cg_wh
+skip 272
+export cg_wideScreenScoreBoardHack
+align 4
+LABELV cg_wideScreenScoreBoardHack
+skip 272
+export cg_wideScreen
+align 4
+LABELV cg_wideScreen
+skip 272
+export cg_battleSuitKillCounter
+align 4
+LABELV cg_battleSuitKillCounter
+skip 272
+export cg_quadKillCounter
+align 4
+LABELV cg_quadKillCounter
+skip 272
+export cg_enableAtCommands
+align 4
+LABELV cg_enableAtCommands
+skip 272
+export cg_fadeStyle
+align 4
+LABELV cg_fadeStyle
+skip 272
+export cg_fadeAlpha
+align 4
+LABELV cg_fadeAlpha
+skip 272
+export cg_fadeColor
+align 4
+LABELV cg_fadeColor
+skip 272
+export cg_inheritPowerupShader
+align 4
+LABELV cg_inheritPowerupShader
+skip 272
+export cg_teamKillWarning
+align 4
+LABELV cg_teamKillWarning
+skip 272
+export cg_mouseSeekUseTimescale
+align 4
+LABELV cg_mouseSeekUseTimescale
+skip 272
+export cg_mouseSeekPollInterval
+align 4
+LABELV cg_mouseSeekPollInterval
+skip 272
+export cg_mouseSeekScale
+align 4
+LABELV cg_mouseSeekScale
+skip 272
+export cg_deathShowOwnCorpse
+align 4
+LABELV cg_deathShowOwnCorpse
+skip 272
+export cg_deathStyle
+align 4
+LABELV cg_deathStyle
+skip 272
+export cg_killBeep
+align 4
+LABELV cg_killBeep
+skip 272
+export cg_clientOverrideIgnoreTeamSettings
+align 4
+LABELV cg_clientOverrideIgnoreTeamSettings
+skip 272
+export cg_warmupTime
+align 4
+LABELV cg_warmupTime
+skip 272
+export cg_localTimeStyle
+align 4
+LABELV cg_localTimeStyle
+skip 272
+export cg_localTime
+align 4
+LABELV cg_localTime
+skip 272
+export cg_itemUseSound
+align 4
+LABELV cg_itemUseSound
+skip 272
+export cg_itemUseMessage
+align 4
+LABELV cg_itemUseMessage
+skip 272
+export cg_noItemUseSound
+align 4
+LABELV cg_noItemUseSound
+skip 272
+export cg_noItemUseMessage
+align 4
+LABELV cg_noItemUseMessage
+skip 272
+export cg_hasteTrail
+align 4
+LABELV cg_hasteTrail
+skip 272
+export cg_flightTrail
+align 4
+LABELV cg_flightTrail
+skip 272
+export cg_q3mmeCameraSmoothPos
+align 4
+LABELV cg_q3mmeCameraSmoothPos
+skip 272
+export cg_cameraSmoothFactor
+align 4
+LABELV cg_cameraSmoothFactor
+skip 272
+export cg_cameraDebugPath
+align 4
+LABELV cg_cameraDebugPath
+skip 272
+export cg_cameraDefaultOriginType
+align 4
+LABELV cg_cameraDefaultOriginType
+skip 272
+export cg_cameraUpdateFreeCam
+align 4
+LABELV cg_cameraUpdateFreeCam
+skip 272
+export cg_cameraAddUsePreviousValues
+align 4
+LABELV cg_cameraAddUsePreviousValues
+skip 272
+export cg_cameraQue
+align 4
+LABELV cg_cameraQue
+skip 272
+export cg_cameraRewindTime
+align 4
+LABELV cg_cameraRewindTime
+skip 272
+export cg_playerLeanScale
+align 4
+LABELV cg_playerLeanScale
+skip 272
+export cg_drawSpritesDeadPlayers
+align 4
+LABELV cg_drawSpritesDeadPlayers
+skip 272
+export cg_drawSpriteSelf
+align 4
+LABELV cg_drawSpriteSelf
+skip 272
+export cg_drawSprites
+align 4
+LABELV cg_drawSprites
+skip 272
+export cg_allowSpritePassThrough
+align 4
+LABELV cg_allowSpritePassThrough
+skip 272
+export cg_allowLargeSprites
+align 4
+LABELV cg_allowLargeSprites
+skip 272
+export cg_waterWarp
+align 4
+LABELV cg_waterWarp
+skip 272
+export g_training
+align 4
+LABELV g_training
+skip 272
+export cg_drawSpecMessages
+align 4
+LABELV cg_drawSpecMessages
+skip 272
+export cg_compMode
+align 4
+LABELV cg_compMode
+skip 272
+export cg_gameType
+align 4
+LABELV cg_gameType
+skip 272
+export cg_kickScale
+align 4
+LABELV cg_kickScale
+skip 272
+export cg_quadFireSound
+align 4
+LABELV cg_quadFireSound
+skip 272
+export cg_animationsRate
+align 4
+LABELV cg_animationsRate
+skip 272
+export cg_animationsIgnoreTimescale
+align 4
+LABELV cg_animationsIgnoreTimescale
+skip 272
+export cg_vibrateForce
+align 4
+LABELV cg_vibrateForce
+skip 272
+export cg_vibrateMaxDistance
+align 4
+LABELV cg_vibrateMaxDistance
+skip 272
+export cg_vibrateTime
+align 4
+LABELV cg_vibrateTime
+skip 272
+export cg_vibrate
+align 4
+LABELV cg_vibrate
+skip 272
+export cg_fxq3mmeCompatibility
+align 4
+LABELV cg_fxq3mmeCompatibility
+skip 272
+import cg_fxThreads
+export cg_fxCompiled
+align 4
+LABELV cg_fxCompiled
+skip 272
+export cg_fxDebugEntities
+align 4
+LABELV cg_fxDebugEntities
+skip 272
+export cg_fxLightningGunImpactFps
+align 4
+LABELV cg_fxLightningGunImpactFps
+skip 272
+export cg_fxScriptMinInterval
+align 4
+LABELV cg_fxScriptMinInterval
+skip 272
+export cg_fxScriptMinDistance
+align 4
+LABELV cg_fxScriptMinDistance
+skip 272
+export cg_fxScriptMinEmitter
+align 4
+LABELV cg_fxScriptMinEmitter
+skip 272
+export cg_fxratio
+align 4
+LABELV cg_fxratio
+skip 272
+export cg_fxinterval
+align 4
+LABELV cg_fxinterval
+skip 272
+export cg_fxfile
+align 4
+LABELV cg_fxfile
+skip 272
+export cg_spawnArmorTime
+align 4
+LABELV cg_spawnArmorTime
+skip 272
+export cg_thirdPersonShaderWeaponHeavyMachineGun
+align 4
+LABELV cg_thirdPersonShaderWeaponHeavyMachineGun
+skip 272
+export cg_thirdPersonShaderWeaponChainGun
+align 4
+LABELV cg_thirdPersonShaderWeaponChainGun
+skip 272
+export cg_thirdPersonShaderWeaponProximityLauncher
+align 4
+LABELV cg_thirdPersonShaderWeaponProximityLauncher
+skip 272
+export cg_thirdPersonShaderWeaponNailGun
+align 4
+LABELV cg_thirdPersonShaderWeaponNailGun
+skip 272
+export cg_thirdPersonShaderWeaponGrapplingHook
+align 4
+LABELV cg_thirdPersonShaderWeaponGrapplingHook
+skip 272
+export cg_thirdPersonShaderWeaponBFG
+align 4
+LABELV cg_thirdPersonShaderWeaponBFG
+skip 272
+export cg_thirdPersonShaderWeaponPlasmaGun
+align 4
+LABELV cg_thirdPersonShaderWeaponPlasmaGun
+skip 272
+export cg_thirdPersonShaderWeaponRailGun
+align 4
+LABELV cg_thirdPersonShaderWeaponRailGun
+skip 272
+export cg_thirdPersonShaderWeaponLightningGun
+align 4
+LABELV cg_thirdPersonShaderWeaponLightningGun
+skip 272
+export cg_thirdPersonShaderWeaponRocketLauncher
+align 4
+LABELV cg_thirdPersonShaderWeaponRocketLauncher
+skip 272
+export cg_thirdPersonShaderWeaponGrenadeLauncher
+align 4
+LABELV cg_thirdPersonShaderWeaponGrenadeLauncher
+skip 272
+export cg_thirdPersonShaderWeaponShotgun
+align 4
+LABELV cg_thirdPersonShaderWeaponShotgun
+skip 272
+export cg_thirdPersonShaderWeaponMachineGun
+align 4
+LABELV cg_thirdPersonShaderWeaponMachineGun
+skip 272
+export cg_thirdPersonShaderWeaponGauntlet
+align 4
+LABELV cg_thirdPersonShaderWeaponGauntlet
+skip 272
+export cg_firstPersonShaderWeaponHeavyMachineGun
+align 4
+LABELV cg_firstPersonShaderWeaponHeavyMachineGun
+skip 272
+export cg_firstPersonShaderWeaponChainGun
+align 4
+LABELV cg_firstPersonShaderWeaponChainGun
+skip 272
+export cg_firstPersonShaderWeaponProximityLauncher
+align 4
+LABELV cg_firstPersonShaderWeaponProximityLauncher
+skip 272
+export cg_firstPersonShaderWeaponNailGun
+align 4
+LABELV cg_firstPersonShaderWeaponNailGun
+skip 272
+export cg_firstPersonShaderWeaponGrapplingHook
+align 4
+LABELV cg_firstPersonShaderWeaponGrapplingHook
+skip 272
+export cg_firstPersonShaderWeaponBFG
+align 4
+LABELV cg_firstPersonShaderWeaponBFG
+skip 272
+export cg_firstPersonShaderWeaponPlasmaGun
+align 4
+LABELV cg_firstPersonShaderWeaponPlasmaGun
+skip 272
+export cg_firstPersonShaderWeaponRailGun
+align 4
+LABELV cg_firstPersonShaderWeaponRailGun
+skip 272
+export cg_firstPersonShaderWeaponLightningGun
+align 4
+LABELV cg_firstPersonShaderWeaponLightningGun
+skip 272
+export cg_firstPersonShaderWeaponRocketLauncher
+align 4
+LABELV cg_firstPersonShaderWeaponRocketLauncher
+skip 272
+export cg_firstPersonShaderWeaponGrenadeLauncher
+align 4
+LABELV cg_firstPersonShaderWeaponGrenadeLauncher
+skip 272
+export cg_firstPersonShaderWeaponShotgun
+align 4
+LABELV cg_firstPersonShaderWeaponShotgun
+skip 272
+export cg_firstPersonShaderWeaponMachineGun
+align 4
+LABELV cg_firstPersonShaderWeaponMachineGun
+skip 272
+export cg_firstPersonShaderWeaponGauntlet
+align 4
+LABELV cg_firstPersonShaderWeaponGauntlet
+skip 272
+export cg_weaponHeavyMachineGun
+align 4
+LABELV cg_weaponHeavyMachineGun
+skip 272
+export cg_weaponChainGun
+align 4
+LABELV cg_weaponChainGun
+skip 272
+export cg_weaponProximityLauncher
+align 4
+LABELV cg_weaponProximityLauncher
+skip 272
+export cg_weaponNailGun
+align 4
+LABELV cg_weaponNailGun
+skip 272
+export cg_weaponGrapplingHook
+align 4
+LABELV cg_weaponGrapplingHook
+skip 272
+export cg_weaponBFG
+align 4
+LABELV cg_weaponBFG
+skip 272
+export cg_weaponPlasmaGun
+align 4
+LABELV cg_weaponPlasmaGun
+skip 272
+export cg_weaponRailGun
+align 4
+LABELV cg_weaponRailGun
+skip 272
+export cg_weaponLightningGun
+align 4
+LABELV cg_weaponLightningGun
+skip 272
+export cg_weaponRocketLauncher
+align 4
+LABELV cg_weaponRocketLauncher
+skip 272
+export cg_weaponGrenadeLauncher
+align 4
+LABELV cg_weaponGrenadeLauncher
+skip 272
+export cg_weaponShotgun
+align 4
+LABELV cg_weaponShotgun
+skip 272
+export cg_weaponMachineGun
+align 4
+LABELV cg_weaponMachineGun
+skip 272
+export cg_weaponGauntlet
+align 4
+LABELV cg_weaponGauntlet
+skip 272
+export cg_weaponNone
+align 4
+LABELV cg_weaponNone
+skip 272
+export cg_weaponDefault
+align 4
+LABELV cg_weaponDefault
+skip 272
+export cg_muzzleFlash
+align 4
+LABELV cg_muzzleFlash
+skip 272
+export cg_checkForOfflineDemo
+align 4
+LABELV cg_checkForOfflineDemo
+skip 272
+export cg_levelTimerOvertimeReset
+align 4
+LABELV cg_levelTimerOvertimeReset
+skip 272
+export cg_levelTimerDefaultTimeLimit
+align 4
+LABELV cg_levelTimerDefaultTimeLimit
+skip 272
+export cg_levelTimerDirection
+align 4
+LABELV cg_levelTimerDirection
+skip 272
+export cg_drawViewPointMark
+align 4
+LABELV cg_drawViewPointMark
+skip 272
+export cg_drawCameraPointInfoBackgroundAlpha
+align 4
+LABELV cg_drawCameraPointInfoBackgroundAlpha
+skip 272
+export cg_drawCameraPointInfoBackgroundColor
+align 4
+LABELV cg_drawCameraPointInfoBackgroundColor
+skip 272
+export cg_drawCameraPointInfoWideScreen
+align 4
+LABELV cg_drawCameraPointInfoWideScreen
+skip 272
+export cg_drawCameraPointInfoAlpha
+align 4
+LABELV cg_drawCameraPointInfoAlpha
+skip 272
+export cg_drawCameraPointInfoSelectedColor
+align 4
+LABELV cg_drawCameraPointInfoSelectedColor
+skip 272
+export cg_drawCameraPointInfoColor
+align 4
+LABELV cg_drawCameraPointInfoColor
+skip 272
+export cg_drawCameraPointInfoScale
+align 4
+LABELV cg_drawCameraPointInfoScale
+skip 272
+export cg_drawCameraPointInfoPointSize
+align 4
+LABELV cg_drawCameraPointInfoPointSize
+skip 272
+export cg_drawCameraPointInfoFont
+align 4
+LABELV cg_drawCameraPointInfoFont
+skip 272
+export cg_drawCameraPointInfoStyle
+align 4
+LABELV cg_drawCameraPointInfoStyle
+skip 272
+export cg_drawCameraPointInfoAlign
+align 4
+LABELV cg_drawCameraPointInfoAlign
+skip 272
+export cg_drawCameraPointInfoY
+align 4
+LABELV cg_drawCameraPointInfoY
+skip 272
+export cg_drawCameraPointInfoX
+align 4
+LABELV cg_drawCameraPointInfoX
+skip 272
+export cg_drawCameraPointInfo
+align 4
+LABELV cg_drawCameraPointInfo
+skip 272
+export cg_drawCameraPath
+align 4
+LABELV cg_drawCameraPath
+skip 272
+export cg_demoSmoothingTeleportCheck
+align 4
+LABELV cg_demoSmoothingTeleportCheck
+skip 272
+export cg_demoSmoothingAngles
+align 4
+LABELV cg_demoSmoothingAngles
+skip 272
+export cg_demoSmoothing
+align 4
+LABELV cg_demoSmoothing
+skip 272
+export cg_drawEventNumbers
+align 4
+LABELV cg_drawEventNumbers
+skip 272
+export cg_drawEntNumbers
+align 4
+LABELV cg_drawEntNumbers
+skip 272
+export cg_lightningSize
+align 4
+LABELV cg_lightningSize
+skip 272
+export cg_debugLightningImpactDistance
+align 4
+LABELV cg_debugLightningImpactDistance
+skip 272
+export cg_lightningAngleOriginStyle
+align 4
+LABELV cg_lightningAngleOriginStyle
+skip 272
+export cg_lightningRenderStyle
+align 4
+LABELV cg_lightningRenderStyle
+skip 272
+export cg_lightningStyle
+align 4
+LABELV cg_lightningStyle
+skip 272
+export cg_lightningImpactProject
+align 4
+LABELV cg_lightningImpactProject
+skip 272
+export cg_lightningImpactCapMin
+align 4
+LABELV cg_lightningImpactCapMin
+skip 272
+export cg_lightningImpactCap
+align 4
+LABELV cg_lightningImpactCap
+skip 272
+export cg_lightningImpactOthersSize
+align 4
+LABELV cg_lightningImpactOthersSize
+skip 272
+export cg_lightningImpactSize
+align 4
+LABELV cg_lightningImpactSize
+skip 272
+export cg_lightningImpact
+align 4
+LABELV cg_lightningImpact
+skip 272
+export cg_printSkillRating
+align 4
+LABELV cg_printSkillRating
+skip 272
+export cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+align 4
+LABELV cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+skip 272
+export cg_perKillStatsClearNotFiringTime
+align 4
+LABELV cg_perKillStatsClearNotFiringTime
+skip 272
+export cg_perKillStatsExcludePostKillSpam
+align 4
+LABELV cg_perKillStatsExcludePostKillSpam
+skip 272
+export cg_drawPlayerNamesAlpha
+align 4
+LABELV cg_drawPlayerNamesAlpha
+skip 272
+export cg_drawPlayerNamesColor
+align 4
+LABELV cg_drawPlayerNamesColor
+skip 272
+export cg_drawPlayerNamesScale
+align 4
+LABELV cg_drawPlayerNamesScale
+skip 272
+export cg_drawPlayerNamesPointSize
+align 4
+LABELV cg_drawPlayerNamesPointSize
+skip 272
+export cg_drawPlayerNamesFont
+align 4
+LABELV cg_drawPlayerNamesFont
+skip 272
+export cg_drawPlayerNamesY
+align 4
+LABELV cg_drawPlayerNamesY
+skip 272
+export cg_drawPlayerNamesStyle
+align 4
+LABELV cg_drawPlayerNamesStyle
+skip 272
+export cg_drawPlayerNames
+align 4
+LABELV cg_drawPlayerNames
+skip 272
+export cg_fragIconHeightFixed
+align 4
+LABELV cg_fragIconHeightFixed
+skip 272
+export cg_fragTokenAccuracyStyle
+align 4
+LABELV cg_fragTokenAccuracyStyle
+skip 272
+export cg_obituaryStack
+align 4
+LABELV cg_obituaryStack
+skip 272
+export cg_obituaryFadeTime
+align 4
+LABELV cg_obituaryFadeTime
+skip 272
+export cg_obituaryTime
+align 4
+LABELV cg_obituaryTime
+skip 272
+export cg_obituaryBlueTeamColor
+align 4
+LABELV cg_obituaryBlueTeamColor
+skip 272
+export cg_obituaryRedTeamColor
+align 4
+LABELV cg_obituaryRedTeamColor
+skip 272
+export cg_obituaryIconScale
+align 4
+LABELV cg_obituaryIconScale
+skip 272
+export cg_obituaryTokens
+align 4
+LABELV cg_obituaryTokens
+skip 272
+export cg_drawFragMessageWideScreen
+align 4
+LABELV cg_drawFragMessageWideScreen
+skip 272
+export cg_drawFragMessageIconScale
+align 4
+LABELV cg_drawFragMessageIconScale
+skip 272
+export cg_drawFragMessageFreezeTeamTokens
+align 4
+LABELV cg_drawFragMessageFreezeTeamTokens
+skip 272
+export cg_drawFragMessageFreezeTokens
+align 4
+LABELV cg_drawFragMessageFreezeTokens
+skip 272
+export cg_drawFragMessageThawTokens
+align 4
+LABELV cg_drawFragMessageThawTokens
+skip 272
+export cg_drawFragMessageTeamTokens
+align 4
+LABELV cg_drawFragMessageTeamTokens
+skip 272
+export cg_drawFragMessageTokens
+align 4
+LABELV cg_drawFragMessageTokens
+skip 272
+export cg_drawFragMessageFadeTime
+align 4
+LABELV cg_drawFragMessageFadeTime
+skip 272
+export cg_drawFragMessageFade
+align 4
+LABELV cg_drawFragMessageFade
+skip 272
+export cg_drawFragMessageAlpha
+align 4
+LABELV cg_drawFragMessageAlpha
+skip 272
+export cg_drawFragMessageColor
+align 4
+LABELV cg_drawFragMessageColor
+skip 272
+export cg_drawFragMessageTime
+align 4
+LABELV cg_drawFragMessageTime
+skip 272
+export cg_drawFragMessageScale
+align 4
+LABELV cg_drawFragMessageScale
+skip 272
+export cg_drawFragMessagePointSize
+align 4
+LABELV cg_drawFragMessagePointSize
+skip 272
+export cg_drawFragMessageFont
+align 4
+LABELV cg_drawFragMessageFont
+skip 272
+export cg_drawFragMessageStyle
+align 4
+LABELV cg_drawFragMessageStyle
+skip 272
+export cg_drawFragMessageAlign
+align 4
+LABELV cg_drawFragMessageAlign
+skip 272
+export cg_drawFragMessageY
+align 4
+LABELV cg_drawFragMessageY
+skip 272
+export cg_drawFragMessageX
+align 4
+LABELV cg_drawFragMessageX
+skip 272
+export cg_drawFragMessageSeparate
+align 4
+LABELV cg_drawFragMessageSeparate
+skip 272
+export cg_fragMessageStyle
+align 4
+LABELV cg_fragMessageStyle
+skip 272
+export cg_grenadeEnemyColorAlpha
+align 4
+LABELV cg_grenadeEnemyColorAlpha
+skip 272
+export cg_grenadeEnemyColor
+align 4
+LABELV cg_grenadeEnemyColor
+skip 272
+export cg_grenadeTeamColorAlpha
+align 4
+LABELV cg_grenadeTeamColorAlpha
+skip 272
+export cg_grenadeTeamColor
+align 4
+LABELV cg_grenadeTeamColor
+skip 272
+export cg_grenadeColorAlpha
+align 4
+LABELV cg_grenadeColorAlpha
+skip 272
+export cg_grenadeColor
+align 4
+LABELV cg_grenadeColor
+skip 272
+export cg_loadDefaultMenus
+align 4
+LABELV cg_loadDefaultMenus
+skip 272
+export cg_accWideScreen
+align 4
+LABELV cg_accWideScreen
+skip 272
+export cg_accY
+align 4
+LABELV cg_accY
+skip 272
+export cg_accX
+align 4
+LABELV cg_accX
+skip 272
+export cg_echoPopupWideScreen
+align 4
+LABELV cg_echoPopupWideScreen
+skip 272
+export cg_echoPopupScale
+align 4
+LABELV cg_echoPopupScale
+skip 272
+export cg_echoPopupY
+align 4
+LABELV cg_echoPopupY
+skip 272
+export cg_echoPopupX
+align 4
+LABELV cg_echoPopupX
+skip 272
+export cg_echoPopupTime
+align 4
+LABELV cg_echoPopupTime
+skip 272
+export cg_screenDamage
+align 4
+LABELV cg_screenDamage
+skip 272
+export cg_screenDamageAlpha
+align 4
+LABELV cg_screenDamageAlpha
+skip 272
+export cg_screenDamage_Self
+align 4
+LABELV cg_screenDamage_Self
+skip 272
+export cg_screenDamageAlpha_Self
+align 4
+LABELV cg_screenDamageAlpha_Self
+skip 272
+export cg_screenDamage_Team
+align 4
+LABELV cg_screenDamage_Team
+skip 272
+export cg_screenDamageAlpha_Team
+align 4
+LABELV cg_screenDamageAlpha_Team
+skip 272
+export cg_printTimeStamps
+align 4
+LABELV cg_printTimeStamps
+skip 272
+export wolfcam_drawFollowingOnlyName
+align 4
+LABELV wolfcam_drawFollowingOnlyName
+skip 272
+export wolfcam_drawFollowing
+align 4
+LABELV wolfcam_drawFollowing
+skip 272
+export cg_ignoreServerPlaySound
+align 4
+LABELV cg_ignoreServerPlaySound
+skip 272
+export cg_audioAnnouncerPowerup
+align 4
+LABELV cg_audioAnnouncerPowerup
+skip 272
+export cg_audioAnnouncerDominationPoint
+align 4
+LABELV cg_audioAnnouncerDominationPoint
+skip 272
+export cg_audioAnnouncerLastStanding
+align 4
+LABELV cg_audioAnnouncerLastStanding
+skip 272
+export cg_audioAnnouncerScore
+align 4
+LABELV cg_audioAnnouncerScore
+skip 272
+export cg_audioAnnouncerWin
+align 4
+LABELV cg_audioAnnouncerWin
+skip 272
+export cg_audioAnnouncerFragLimit
+align 4
+LABELV cg_audioAnnouncerFragLimit
+skip 272
+export cg_audioAnnouncerTimeLimit
+align 4
+LABELV cg_audioAnnouncerTimeLimit
+skip 272
+export cg_audioAnnouncerLead
+align 4
+LABELV cg_audioAnnouncerLead
+skip 272
+export cg_audioAnnouncerFlagStatus
+align 4
+LABELV cg_audioAnnouncerFlagStatus
+skip 272
+export cg_audioAnnouncerTeamVote
+align 4
+LABELV cg_audioAnnouncerTeamVote
+skip 272
+export cg_audioAnnouncerVote
+align 4
+LABELV cg_audioAnnouncerVote
+skip 272
+export cg_audioAnnouncerWarmup
+align 4
+LABELV cg_audioAnnouncerWarmup
+skip 272
+export cg_audioAnnouncerRoundReward
+align 4
+LABELV cg_audioAnnouncerRoundReward
+skip 272
+export cg_audioAnnouncerRound
+align 4
+LABELV cg_audioAnnouncerRound
+skip 272
+export cg_audioAnnouncerRewardsFirst
+align 4
+LABELV cg_audioAnnouncerRewardsFirst
+skip 272
+export cg_audioAnnouncerRewards
+align 4
+LABELV cg_audioAnnouncerRewards
+skip 272
+export cg_audioAnnouncer
+align 4
+LABELV cg_audioAnnouncer
+skip 272
+export cg_crosshairColor
+align 4
+LABELV cg_crosshairColor
+skip 272
+export cg_fallbackHeadModel
+align 4
+LABELV cg_fallbackHeadModel
+skip 272
+export cg_fallbackModel
+align 4
+LABELV cg_fallbackModel
+skip 272
+export cg_disallowEnemyModelForTeammates
+align 4
+LABELV cg_disallowEnemyModelForTeammates
+skip 272
+export cg_deadBodyColor
+align 4
+LABELV cg_deadBodyColor
+skip 272
+export cg_ourLegsColor
+align 4
+LABELV cg_ourLegsColor
+skip 272
+export cg_ourTorsoColor
+align 4
+LABELV cg_ourTorsoColor
+skip 272
+export cg_ourHeadColor
+align 4
+LABELV cg_ourHeadColor
+skip 272
+export cg_ourLegsSkin
+align 4
+LABELV cg_ourLegsSkin
+skip 272
+export cg_ourTorsoSkin
+align 4
+LABELV cg_ourTorsoSkin
+skip 272
+export cg_ourHeadSkin
+align 4
+LABELV cg_ourHeadSkin
+skip 272
+export cg_ourHeadModel
+align 4
+LABELV cg_ourHeadModel
+skip 272
+export cg_ourModel
+align 4
+LABELV cg_ourModel
+skip 272
+export cg_neutralFlagColor
+align 4
+LABELV cg_neutralFlagColor
+skip 272
+export cg_teamFlagColor
+align 4
+LABELV cg_teamFlagColor
+skip 272
+export cg_teamRailNudge
+align 4
+LABELV cg_teamRailNudge
+skip 272
+export cg_teamRailRings
+align 4
+LABELV cg_teamRailRings
+skip 272
+export cg_teamRailItemColorTeam
+align 4
+LABELV cg_teamRailItemColorTeam
+skip 272
+export cg_teamRailItemColor
+align 4
+LABELV cg_teamRailItemColor
+skip 272
+export cg_teamRailColor2Team
+align 4
+LABELV cg_teamRailColor2Team
+skip 272
+export cg_teamRailColor1Team
+align 4
+LABELV cg_teamRailColor1Team
+skip 272
+export cg_teamRailColor2
+align 4
+LABELV cg_teamRailColor2
+skip 272
+export cg_teamRailColor1
+align 4
+LABELV cg_teamRailColor1
+skip 272
+export cg_teamLegsColor
+align 4
+LABELV cg_teamLegsColor
+skip 272
+export cg_teamTorsoColor
+align 4
+LABELV cg_teamTorsoColor
+skip 272
+export cg_teamHeadColor
+align 4
+LABELV cg_teamHeadColor
+skip 272
+export cg_teamLegsSkin
+align 4
+LABELV cg_teamLegsSkin
+skip 272
+export cg_teamTorsoSkin
+align 4
+LABELV cg_teamTorsoSkin
+skip 272
+export cg_teamHeadSkin
+align 4
+LABELV cg_teamHeadSkin
+skip 272
+export cg_teamHeadModel
+align 4
+LABELV cg_teamHeadModel
+skip 272
+export cg_teamModel
+align 4
+LABELV cg_teamModel
+skip 272
+export cg_ignoreClientHeadModel
+align 4
+LABELV cg_ignoreClientHeadModel
+skip 272
+export cg_useDefaultTeamSkins
+align 4
+LABELV cg_useDefaultTeamSkins
+skip 272
+export cg_enemyFlagColor
+align 4
+LABELV cg_enemyFlagColor
+skip 272
+export cg_enemyRailNudge
+align 4
+LABELV cg_enemyRailNudge
+skip 272
+export cg_enemyRailRings
+align 4
+LABELV cg_enemyRailRings
+skip 272
+export cg_enemyRailItemColorTeam
+align 4
+LABELV cg_enemyRailItemColorTeam
+skip 272
+export cg_enemyRailItemColor
+align 4
+LABELV cg_enemyRailItemColor
+skip 272
+export cg_enemyRailColor2Team
+align 4
+LABELV cg_enemyRailColor2Team
+skip 272
+export cg_enemyRailColor1Team
+align 4
+LABELV cg_enemyRailColor1Team
+skip 272
+export cg_enemyRailColor2
+align 4
+LABELV cg_enemyRailColor2
+skip 272
+export cg_enemyRailColor1
+align 4
+LABELV cg_enemyRailColor1
+skip 272
+export cg_enemyLegsColor
+align 4
+LABELV cg_enemyLegsColor
+skip 272
+export cg_enemyTorsoColor
+align 4
+LABELV cg_enemyTorsoColor
+skip 272
+export cg_enemyHeadColor
+align 4
+LABELV cg_enemyHeadColor
+skip 272
+export cg_enemyLegsSkin
+align 4
+LABELV cg_enemyLegsSkin
+skip 272
+export cg_enemyTorsoSkin
+align 4
+LABELV cg_enemyTorsoSkin
+skip 272
+export cg_enemyHeadSkin
+align 4
+LABELV cg_enemyHeadSkin
+skip 272
+export cg_enemyHeadModel
+align 4
+LABELV cg_enemyHeadModel
+skip 272
+export cg_enemyModel
+align 4
+LABELV cg_enemyModel
+skip 272
+export cg_hudForceBlueTeamClanTag
+align 4
+LABELV cg_hudForceBlueTeamClanTag
+skip 272
+export cg_hudForceRedTeamClanTag
+align 4
+LABELV cg_hudForceRedTeamClanTag
+skip 272
+export cg_hudNoTeamColor
+align 4
+LABELV cg_hudNoTeamColor
+skip 272
+export cg_hudBlueTeamColor
+align 4
+LABELV cg_hudBlueTeamColor
+skip 272
+export cg_hudRedTeamColor
+align 4
+LABELV cg_hudRedTeamColor
+skip 272
+export cg_weaponBlueTeamColor
+align 4
+LABELV cg_weaponBlueTeamColor
+skip 272
+export cg_weaponRedTeamColor
+align 4
+LABELV cg_weaponRedTeamColor
+skip 272
+export wolfcam_firstPersonSwitchSoundStyle
+align 4
+LABELV wolfcam_firstPersonSwitchSoundStyle
+skip 272
+export wolfcam_switchMode
+align 4
+LABELV wolfcam_switchMode
+skip 272
+export wolfcam_hoverTime
+align 4
+LABELV wolfcam_hoverTime
+skip 272
+export cg_interpolateMissiles
+align 4
+LABELV cg_interpolateMissiles
+skip 272
+export cg_weather
+align 4
+LABELV cg_weather
+skip 272
+export cg_ambientSounds
+align 4
+LABELV cg_ambientSounds
+skip 272
+export cg_drawWarmupStringWideScreen
+align 4
+LABELV cg_drawWarmupStringWideScreen
+skip 272
+export cg_drawWarmupStringAlpha
+align 4
+LABELV cg_drawWarmupStringAlpha
+skip 272
+export cg_drawWarmupStringColor
+align 4
+LABELV cg_drawWarmupStringColor
+skip 272
+export cg_drawWarmupStringScale
+align 4
+LABELV cg_drawWarmupStringScale
+skip 272
+export cg_drawWarmupStringPointSize
+align 4
+LABELV cg_drawWarmupStringPointSize
+skip 272
+export cg_drawWarmupStringFont
+align 4
+LABELV cg_drawWarmupStringFont
+skip 272
+export cg_drawWarmupStringStyle
+align 4
+LABELV cg_drawWarmupStringStyle
+skip 272
+export cg_drawWarmupStringAlign
+align 4
+LABELV cg_drawWarmupStringAlign
+skip 272
+export cg_drawWarmupStringY
+align 4
+LABELV cg_drawWarmupStringY
+skip 272
+export cg_drawWarmupStringX
+align 4
+LABELV cg_drawWarmupStringX
+skip 272
+export cg_drawWarmupString
+align 4
+LABELV cg_drawWarmupString
+skip 272
+export cg_drawWaitingForPlayersWideScreen
+align 4
+LABELV cg_drawWaitingForPlayersWideScreen
+skip 272
+export cg_drawWaitingForPlayersAlpha
+align 4
+LABELV cg_drawWaitingForPlayersAlpha
+skip 272
+export cg_drawWaitingForPlayersColor
+align 4
+LABELV cg_drawWaitingForPlayersColor
+skip 272
+export cg_drawWaitingForPlayersScale
+align 4
+LABELV cg_drawWaitingForPlayersScale
+skip 272
+export cg_drawWaitingForPlayersPointSize
+align 4
+LABELV cg_drawWaitingForPlayersPointSize
+skip 272
+export cg_drawWaitingForPlayersFont
+align 4
+LABELV cg_drawWaitingForPlayersFont
+skip 272
+export cg_drawWaitingForPlayersStyle
+align 4
+LABELV cg_drawWaitingForPlayersStyle
+skip 272
+export cg_drawWaitingForPlayersAlign
+align 4
+LABELV cg_drawWaitingForPlayersAlign
+skip 272
+export cg_drawWaitingForPlayersY
+align 4
+LABELV cg_drawWaitingForPlayersY
+skip 272
+export cg_drawWaitingForPlayersX
+align 4
+LABELV cg_drawWaitingForPlayersX
+skip 272
+export cg_drawWaitingForPlayers
+align 4
+LABELV cg_drawWaitingForPlayers
+skip 272
+export cg_drawTeamVoteWideScreen
+align 4
+LABELV cg_drawTeamVoteWideScreen
+skip 272
+export cg_drawTeamVoteAlpha
+align 4
+LABELV cg_drawTeamVoteAlpha
+skip 272
+export cg_drawTeamVoteColor
+align 4
+LABELV cg_drawTeamVoteColor
+skip 272
+export cg_drawTeamVoteScale
+align 4
+LABELV cg_drawTeamVoteScale
+skip 272
+export cg_drawTeamVotePointSize
+align 4
+LABELV cg_drawTeamVotePointSize
+skip 272
+export cg_drawTeamVoteFont
+align 4
+LABELV cg_drawTeamVoteFont
+skip 272
+export cg_drawTeamVoteStyle
+align 4
+LABELV cg_drawTeamVoteStyle
+skip 272
+export cg_drawTeamVoteAlign
+align 4
+LABELV cg_drawTeamVoteAlign
+skip 272
+export cg_drawTeamVoteY
+align 4
+LABELV cg_drawTeamVoteY
+skip 272
+export cg_drawTeamVoteX
+align 4
+LABELV cg_drawTeamVoteX
+skip 272
+export cg_drawTeamVote
+align 4
+LABELV cg_drawTeamVote
+skip 272
+export cg_drawVoteWideScreen
+align 4
+LABELV cg_drawVoteWideScreen
+skip 272
+export cg_drawVoteAlpha
+align 4
+LABELV cg_drawVoteAlpha
+skip 272
+export cg_drawVoteColor
+align 4
+LABELV cg_drawVoteColor
+skip 272
+export cg_drawVoteScale
+align 4
+LABELV cg_drawVoteScale
+skip 272
+export cg_drawVotePointSize
+align 4
+LABELV cg_drawVotePointSize
+skip 272
+export cg_drawVoteFont
+align 4
+LABELV cg_drawVoteFont
+skip 272
+export cg_drawVoteStyle
+align 4
+LABELV cg_drawVoteStyle
+skip 272
+export cg_drawVoteAlign
+align 4
+LABELV cg_drawVoteAlign
+skip 272
+export cg_drawVoteY
+align 4
+LABELV cg_drawVoteY
+skip 272
+export cg_drawVoteX
+align 4
+LABELV cg_drawVoteX
+skip 272
+export cg_drawVote
+align 4
+LABELV cg_drawVote
+skip 272
+export cg_drawCenterPrintWideScreen
+align 4
+LABELV cg_drawCenterPrintWideScreen
+skip 272
+export cg_drawCenterPrintFadeTime
+align 4
+LABELV cg_drawCenterPrintFadeTime
+skip 272
+export cg_drawCenterPrintFade
+align 4
+LABELV cg_drawCenterPrintFade
+skip 272
+export cg_drawCenterPrintAlpha
+align 4
+LABELV cg_drawCenterPrintAlpha
+skip 272
+export cg_drawCenterPrintColor
+align 4
+LABELV cg_drawCenterPrintColor
+skip 272
+export cg_drawCenterPrintTime
+align 4
+LABELV cg_drawCenterPrintTime
+skip 272
+export cg_drawCenterPrintScale
+align 4
+LABELV cg_drawCenterPrintScale
+skip 272
+export cg_drawCenterPrintPointSize
+align 4
+LABELV cg_drawCenterPrintPointSize
+skip 272
+export cg_drawCenterPrintFont
+align 4
+LABELV cg_drawCenterPrintFont
+skip 272
+export cg_drawCenterPrintStyle
+align 4
+LABELV cg_drawCenterPrintStyle
+skip 272
+export cg_drawCenterPrintAlign
+align 4
+LABELV cg_drawCenterPrintAlign
+skip 272
+export cg_drawCenterPrintY
+align 4
+LABELV cg_drawCenterPrintY
+skip 272
+export cg_drawCenterPrintX
+align 4
+LABELV cg_drawCenterPrintX
+skip 272
+export cg_drawCenterPrint
+align 4
+LABELV cg_drawCenterPrint
+skip 272
+export cg_serverCenterPrintToConsole
+align 4
+LABELV cg_serverCenterPrintToConsole
+skip 272
+export cg_serverCenterPrintToChat
+align 4
+LABELV cg_serverCenterPrintToChat
+skip 272
+export cg_serverCenterPrint
+align 4
+LABELV cg_serverCenterPrint
+skip 272
+export cg_serverPrintToConsole
+align 4
+LABELV cg_serverPrintToConsole
+skip 272
+export cg_serverPrintToChat
+align 4
+LABELV cg_serverPrintToChat
+skip 272
+export cg_serverPrint
+align 4
+LABELV cg_serverPrint
+skip 272
+export cg_teamChatBeepMaxTime
+align 4
+LABELV cg_teamChatBeepMaxTime
+skip 272
+export cg_teamChatBeep
+align 4
+LABELV cg_teamChatBeep
+skip 272
+export cg_chatBeepMaxTime
+align 4
+LABELV cg_chatBeepMaxTime
+skip 272
+export cg_chatBeep
+align 4
+LABELV cg_chatBeep
+skip 272
+export cg_chatHistoryLength
+align 4
+LABELV cg_chatHistoryLength
+skip 272
+export cg_chatLines
+align 4
+LABELV cg_chatLines
+skip 272
+export cg_chatTime
+align 4
+LABELV cg_chatTime
+skip 272
+export cg_freecam_unlockPitch
+align 4
+LABELV cg_freecam_unlockPitch
+skip 272
+export cg_freecam_useServerView
+align 4
+LABELV cg_freecam_useServerView
+skip 272
+export cg_freecam_rollValue
+align 4
+LABELV cg_freecam_rollValue
+skip 272
+export cg_freecam_useTeamSettings
+align 4
+LABELV cg_freecam_useTeamSettings
+skip 272
+export cg_freecam_crosshair
+align 4
+LABELV cg_freecam_crosshair
+skip 272
+export cg_freecam_speed
+align 4
+LABELV cg_freecam_speed
+skip 272
+export cg_freecam_pitch
+align 4
+LABELV cg_freecam_pitch
+skip 272
+export cg_freecam_yaw
+align 4
+LABELV cg_freecam_yaw
+skip 272
+export cg_freecam_sensitivity
+align 4
+LABELV cg_freecam_sensitivity
+skip 272
+export cg_freecam_noclip
+align 4
+LABELV cg_freecam_noclip
+skip 272
+export cg_drawSpawnsSharedZ
+align 4
+LABELV cg_drawSpawnsSharedZ
+skip 272
+export cg_drawSpawnsShared
+align 4
+LABELV cg_drawSpawnsShared
+skip 272
+export cg_drawSpawnsRespawnsZ
+align 4
+LABELV cg_drawSpawnsRespawnsZ
+skip 272
+export cg_drawSpawnsRespawns
+align 4
+LABELV cg_drawSpawnsRespawns
+skip 272
+export cg_drawSpawnsInitialZ
+align 4
+LABELV cg_drawSpawnsInitialZ
+skip 272
+export cg_drawSpawnsInitial
+align 4
+LABELV cg_drawSpawnsInitial
+skip 272
+export cg_drawSpawns
+align 4
+LABELV cg_drawSpawns
+skip 272
+export cg_hitBeep
+align 4
+LABELV cg_hitBeep
+skip 272
+export cg_scoreBoardForceLineHeightTeamDefault
+align 4
+LABELV cg_scoreBoardForceLineHeightTeamDefault
+skip 272
+export cg_scoreBoardForceLineHeightTeam
+align 4
+LABELV cg_scoreBoardForceLineHeightTeam
+skip 272
+export cg_scoreBoardForceLineHeightDefault
+align 4
+LABELV cg_scoreBoardForceLineHeightDefault
+skip 272
+export cg_scoreBoardForceLineHeight
+align 4
+LABELV cg_scoreBoardForceLineHeight
+skip 272
+export cg_scoreBoardOldWideScreen
+align 4
+LABELV cg_scoreBoardOldWideScreen
+skip 272
+export cg_scoreBoardOld
+align 4
+LABELV cg_scoreBoardOld
+skip 272
+export cg_scoreBoardWarmup
+align 4
+LABELV cg_scoreBoardWarmup
+skip 272
+export cg_scoreBoardAtIntermission
+align 4
+LABELV cg_scoreBoardAtIntermission
+skip 272
+export cg_scoreBoardWhenDead
+align 4
+LABELV cg_scoreBoardWhenDead
+skip 272
+export cg_scoreBoardSpectatorScroll
+align 4
+LABELV cg_scoreBoardSpectatorScroll
+skip 272
+export cg_scoreBoardStyle
+align 4
+LABELV cg_scoreBoardStyle
+skip 272
+export cg_drawFullWeaponBar
+align 4
+LABELV cg_drawFullWeaponBar
+skip 272
+export cg_weaponBarWideScreen
+align 4
+LABELV cg_weaponBarWideScreen
+skip 272
+export cg_weaponBarPointSize
+align 4
+LABELV cg_weaponBarPointSize
+skip 272
+export cg_weaponBarFont
+align 4
+LABELV cg_weaponBarFont
+skip 272
+export cg_weaponBarY
+align 4
+LABELV cg_weaponBarY
+skip 272
+export cg_weaponBarX
+align 4
+LABELV cg_weaponBarX
+skip 272
+export cg_weaponBar
+align 4
+LABELV cg_weaponBar
+skip 272
+export cg_autoFontScalingThreshold
+align 4
+LABELV cg_autoFontScalingThreshold
+skip 272
+export cg_autoFontScaling
+align 4
+LABELV cg_autoFontScaling
+skip 272
+export cg_qlFontScaling
+align 4
+LABELV cg_qlFontScaling
+skip 272
+export cg_qlhud
+align 4
+LABELV cg_qlhud
+skip 272
+export cg_testQlFont
+align 4
+LABELV cg_testQlFont
+skip 272
+export cg_drawCpmaMvdIndicatorWideScreen
+align 4
+LABELV cg_drawCpmaMvdIndicatorWideScreen
+skip 272
+export cg_drawCpmaMvdIndicatorAlpha
+align 4
+LABELV cg_drawCpmaMvdIndicatorAlpha
+skip 272
+export cg_drawCpmaMvdIndicatorColor
+align 4
+LABELV cg_drawCpmaMvdIndicatorColor
+skip 272
+export cg_drawCpmaMvdIndicatorScale
+align 4
+LABELV cg_drawCpmaMvdIndicatorScale
+skip 272
+export cg_drawCpmaMvdIndicatorPointSize
+align 4
+LABELV cg_drawCpmaMvdIndicatorPointSize
+skip 272
+export cg_drawCpmaMvdIndicatorFont
+align 4
+LABELV cg_drawCpmaMvdIndicatorFont
+skip 272
+export cg_drawCpmaMvdIndicatorStyle
+align 4
+LABELV cg_drawCpmaMvdIndicatorStyle
+skip 272
+export cg_drawCpmaMvdIndicatorAlign
+align 4
+LABELV cg_drawCpmaMvdIndicatorAlign
+skip 272
+export cg_drawCpmaMvdIndicatorY
+align 4
+LABELV cg_drawCpmaMvdIndicatorY
+skip 272
+export cg_drawCpmaMvdIndicatorX
+align 4
+LABELV cg_drawCpmaMvdIndicatorX
+skip 272
+export cg_drawCpmaMvdIndicator
+align 4
+LABELV cg_drawCpmaMvdIndicator
+skip 272
+export cg_drawFollowingWideScreen
+align 4
+LABELV cg_drawFollowingWideScreen
+skip 272
+export cg_drawFollowingAlpha
+align 4
+LABELV cg_drawFollowingAlpha
+skip 272
+export cg_drawFollowingColor
+align 4
+LABELV cg_drawFollowingColor
+skip 272
+export cg_drawFollowingScale
+align 4
+LABELV cg_drawFollowingScale
+skip 272
+export cg_drawFollowingPointSize
+align 4
+LABELV cg_drawFollowingPointSize
+skip 272
+export cg_drawFollowingFont
+align 4
+LABELV cg_drawFollowingFont
+skip 272
+export cg_drawFollowingStyle
+align 4
+LABELV cg_drawFollowingStyle
+skip 272
+export cg_drawFollowingAlign
+align 4
+LABELV cg_drawFollowingAlign
+skip 272
+export cg_drawFollowingY
+align 4
+LABELV cg_drawFollowingY
+skip 272
+export cg_drawFollowingX
+align 4
+LABELV cg_drawFollowingX
+skip 272
+export cg_drawFollowing
+align 4
+LABELV cg_drawFollowing
+skip 272
+export cg_drawItemPickupsWideScreen
+align 4
+LABELV cg_drawItemPickupsWideScreen
+skip 272
+export cg_drawItemPickupsCount
+align 4
+LABELV cg_drawItemPickupsCount
+skip 272
+export cg_drawItemPickupsFadeTime
+align 4
+LABELV cg_drawItemPickupsFadeTime
+skip 272
+export cg_drawItemPickupsFade
+align 4
+LABELV cg_drawItemPickupsFade
+skip 272
+export cg_drawItemPickupsAlpha
+align 4
+LABELV cg_drawItemPickupsAlpha
+skip 272
+export cg_drawItemPickupsColor
+align 4
+LABELV cg_drawItemPickupsColor
+skip 272
+export cg_drawItemPickupsTime
+align 4
+LABELV cg_drawItemPickupsTime
+skip 272
+export cg_drawItemPickupsScale
+align 4
+LABELV cg_drawItemPickupsScale
+skip 272
+export cg_drawItemPickupsPointSize
+align 4
+LABELV cg_drawItemPickupsPointSize
+skip 272
+export cg_drawItemPickupsFont
+align 4
+LABELV cg_drawItemPickupsFont
+skip 272
+export cg_drawItemPickupsStyle
+align 4
+LABELV cg_drawItemPickupsStyle
+skip 272
+export cg_drawItemPickupsAlign
+align 4
+LABELV cg_drawItemPickupsAlign
+skip 272
+export cg_drawItemPickupsImageScale
+align 4
+LABELV cg_drawItemPickupsImageScale
+skip 272
+export cg_drawItemPickupsY
+align 4
+LABELV cg_drawItemPickupsY
+skip 272
+export cg_drawItemPickupsX
+align 4
+LABELV cg_drawItemPickupsX
+skip 272
+export cg_drawItemPickups
+align 4
+LABELV cg_drawItemPickups
+skip 272
+export cg_drawPowerupAvailableFadeEnd
+align 4
+LABELV cg_drawPowerupAvailableFadeEnd
+skip 272
+export cg_drawPowerupAvailableFadeStart
+align 4
+LABELV cg_drawPowerupAvailableFadeStart
+skip 272
+export cg_drawPowerupAvailableAlpha
+align 4
+LABELV cg_drawPowerupAvailableAlpha
+skip 272
+export cg_drawPowerupAvailableOffset
+align 4
+LABELV cg_drawPowerupAvailableOffset
+skip 272
+export cg_drawPowerupAvailableScale
+align 4
+LABELV cg_drawPowerupAvailableScale
+skip 272
+export cg_drawPowerupAvailable
+align 4
+LABELV cg_drawPowerupAvailable
+skip 272
+export cg_drawPowerupRespawnAlpha
+align 4
+LABELV cg_drawPowerupRespawnAlpha
+skip 272
+export cg_drawPowerupRespawnOffset
+align 4
+LABELV cg_drawPowerupRespawnOffset
+skip 272
+export cg_drawPowerupRespawnScale
+align 4
+LABELV cg_drawPowerupRespawnScale
+skip 272
+export cg_drawPowerupRespawn
+align 4
+LABELV cg_drawPowerupRespawn
+skip 272
+export cg_drawPowerups
+align 4
+LABELV cg_drawPowerups
+skip 272
+export cg_drawPlayersLeft
+align 4
+LABELV cg_drawPlayersLeft
+skip 272
+export cg_drawScores
+align 4
+LABELV cg_drawScores
+skip 272
+export cg_drawOriginWideScreen
+align 4
+LABELV cg_drawOriginWideScreen
+skip 272
+export cg_drawOriginAlpha
+align 4
+LABELV cg_drawOriginAlpha
+skip 272
+export cg_drawOriginColor
+align 4
+LABELV cg_drawOriginColor
+skip 272
+export cg_drawOriginScale
+align 4
+LABELV cg_drawOriginScale
+skip 272
+export cg_drawOriginPointSize
+align 4
+LABELV cg_drawOriginPointSize
+skip 272
+export cg_drawOriginFont
+align 4
+LABELV cg_drawOriginFont
+skip 272
+export cg_drawOriginStyle
+align 4
+LABELV cg_drawOriginStyle
+skip 272
+export cg_drawOriginAlign
+align 4
+LABELV cg_drawOriginAlign
+skip 272
+export cg_drawOriginY
+align 4
+LABELV cg_drawOriginY
+skip 272
+export cg_drawOriginX
+align 4
+LABELV cg_drawOriginX
+skip 272
+export cg_drawOrigin
+align 4
+LABELV cg_drawOrigin
+skip 272
+export cg_drawSpeedChangeColor
+align 4
+LABELV cg_drawSpeedChangeColor
+skip 272
+export cg_drawSpeedWideScreen
+align 4
+LABELV cg_drawSpeedWideScreen
+skip 272
+export cg_drawSpeedAlpha
+align 4
+LABELV cg_drawSpeedAlpha
+skip 272
+export cg_drawSpeedColor
+align 4
+LABELV cg_drawSpeedColor
+skip 272
+export cg_drawSpeedScale
+align 4
+LABELV cg_drawSpeedScale
+skip 272
+export cg_drawSpeedPointSize
+align 4
+LABELV cg_drawSpeedPointSize
+skip 272
+export cg_drawSpeedFont
+align 4
+LABELV cg_drawSpeedFont
+skip 272
+export cg_drawSpeedStyle
+align 4
+LABELV cg_drawSpeedStyle
+skip 272
+export cg_drawSpeedAlign
+align 4
+LABELV cg_drawSpeedAlign
+skip 272
+export cg_drawSpeedNoText
+align 4
+LABELV cg_drawSpeedNoText
+skip 272
+export cg_drawSpeedY
+align 4
+LABELV cg_drawSpeedY
+skip 272
+export cg_drawSpeedX
+align 4
+LABELV cg_drawSpeedX
+skip 272
+export cg_drawSpeed
+align 4
+LABELV cg_drawSpeed
+skip 272
+export cg_obeliskRespawnDelay
+align 4
+LABELV cg_obeliskRespawnDelay
+skip 272
+export cg_recordSPDemoName
+align 4
+LABELV cg_recordSPDemoName
+skip 272
+export cg_recordSPDemo
+align 4
+LABELV cg_recordSPDemo
+skip 272
+export cg_singlePlayerActive
+align 4
+LABELV cg_singlePlayerActive
+skip 272
+export cg_serverEnableBreath
+align 4
+LABELV cg_serverEnableBreath
+skip 272
+export cg_serverEnableDust
+align 4
+LABELV cg_serverEnableDust
+skip 272
+export cg_singlePlayer
+align 4
+LABELV cg_singlePlayer
+skip 272
+export cg_currentSelectedPlayerName
+align 4
+LABELV cg_currentSelectedPlayerName
+skip 272
+export cg_currentSelectedPlayer
+align 4
+LABELV cg_currentSelectedPlayer
+skip 272
+export cg_blueTeamName
+align 4
+LABELV cg_blueTeamName
+skip 272
+export cg_redTeamName
+align 4
+LABELV cg_redTeamName
+skip 272
+export cg_trueLightning
+align 4
+LABELV cg_trueLightning
+skip 272
+export cg_plasmaStyle
+align 4
+LABELV cg_plasmaStyle
+skip 272
+export cg_oldRocket
+align 4
+LABELV cg_oldRocket
+skip 272
+export cg_smokeRadius_haste
+align 4
+LABELV cg_smokeRadius_haste
+skip 272
+export cg_smokeRadius_flight
+align 4
+LABELV cg_smokeRadius_flight
+skip 272
+export cg_enableDust
+align 4
+LABELV cg_enableDust
+skip 272
+export cg_smokeRadius_dust
+align 4
+LABELV cg_smokeRadius_dust
+skip 272
+export cg_enableBreath
+align 4
+LABELV cg_enableBreath
+skip 272
+export cg_smokeRadius_breath
+align 4
+LABELV cg_smokeRadius_breath
+skip 272
+export cg_smokeRadius_PL
+align 4
+LABELV cg_smokeRadius_PL
+skip 272
+export cg_smokeRadius_RL
+align 4
+LABELV cg_smokeRadius_RL
+skip 272
+export cg_smokeRadius_NG
+align 4
+LABELV cg_smokeRadius_NG
+skip 272
+export cg_smokeRadius_GL
+align 4
+LABELV cg_smokeRadius_GL
+skip 272
+export cg_smokeRadius_SG
+align 4
+LABELV cg_smokeRadius_SG
+skip 272
+export cg_noProjectileTrail
+align 4
+LABELV cg_noProjectileTrail
+skip 272
+export cg_noTaunt
+align 4
+LABELV cg_noTaunt
+skip 272
+export cg_bigFont
+align 4
+LABELV cg_bigFont
+skip 272
+export cg_smallFont
+align 4
+LABELV cg_smallFont
+skip 272
+export cg_cameraMode
+align 4
+LABELV cg_cameraMode
+skip 272
+export cg_timescale
+align 4
+LABELV cg_timescale
+skip 272
+export cg_timescaleFadeSpeed
+align 4
+LABELV cg_timescaleFadeSpeed
+skip 272
+export cg_timescaleFadeEnd
+align 4
+LABELV cg_timescaleFadeEnd
+skip 272
+export cg_cameraOrbitDelay
+align 4
+LABELV cg_cameraOrbitDelay
+skip 272
+export cg_cameraOrbit
+align 4
+LABELV cg_cameraOrbit
+skip 272
+export pmove_msec
+align 4
+LABELV pmove_msec
+skip 272
+export pmove_fixed
+align 4
+LABELV pmove_fixed
+skip 272
+export cg_smoothClients
+align 4
+LABELV cg_smoothClients
+skip 272
+export cg_damagePlumAlpha
+align 4
+LABELV cg_damagePlumAlpha
+skip 272
+export cg_damagePlumColor
+align 4
+LABELV cg_damagePlumColor
+skip 272
+export cg_damagePlumScale
+align 4
+LABELV cg_damagePlumScale
+skip 272
+export cg_damagePlumPointSize
+align 4
+LABELV cg_damagePlumPointSize
+skip 272
+export cg_damagePlumFontStyle
+align 4
+LABELV cg_damagePlumFontStyle
+skip 272
+export cg_damagePlumFont
+align 4
+LABELV cg_damagePlumFont
+skip 272
+export cg_damagePlumRandomVelocity
+align 4
+LABELV cg_damagePlumRandomVelocity
+skip 272
+export cg_damagePlumGravity
+align 4
+LABELV cg_damagePlumGravity
+skip 272
+export cg_damagePlumBounce
+align 4
+LABELV cg_damagePlumBounce
+skip 272
+export cg_damagePlumTime
+align 4
+LABELV cg_damagePlumTime
+skip 272
+export cg_damagePlumTarget
+align 4
+LABELV cg_damagePlumTarget
+skip 272
+export cg_damagePlumColorStyle
+align 4
+LABELV cg_damagePlumColorStyle
+skip 272
+export cg_damagePlum
+align 4
+LABELV cg_damagePlum
+skip 272
+export cg_scorePlums
+align 4
+LABELV cg_scorePlums
+skip 272
+export cg_teamChatsOnly
+align 4
+LABELV cg_teamChatsOnly
+skip 272
+export cg_drawHitFlagCarrierTime
+align 4
+LABELV cg_drawHitFlagCarrierTime
+skip 272
+export cg_drawFlagCarrierSize
+align 4
+LABELV cg_drawFlagCarrierSize
+skip 272
+export cg_drawFlagCarrier
+align 4
+LABELV cg_drawFlagCarrier
+skip 272
+export cg_drawInfected
+align 4
+LABELV cg_drawInfected
+skip 272
+export cg_drawSelfIconStyle
+align 4
+LABELV cg_drawSelfIconStyle
+skip 272
+export cg_drawSelfMaxWidth
+align 4
+LABELV cg_drawSelfMaxWidth
+skip 272
+export cg_drawSelfMinWidth
+align 4
+LABELV cg_drawSelfMinWidth
+skip 272
+export cg_drawSelf
+align 4
+LABELV cg_drawSelf
+skip 272
+export cg_drawFoeMaxWidth
+align 4
+LABELV cg_drawFoeMaxWidth
+skip 272
+export cg_drawFoeMinWidth
+align 4
+LABELV cg_drawFoeMinWidth
+skip 272
+export cg_drawFoe
+align 4
+LABELV cg_drawFoe
+skip 272
+export cg_drawFriendMaxWidth
+align 4
+LABELV cg_drawFriendMaxWidth
+skip 272
+export cg_drawFriendMinWidth
+align 4
+LABELV cg_drawFriendMinWidth
+skip 272
+export cg_drawFriendStyle
+align 4
+LABELV cg_drawFriendStyle
+skip 272
+export cg_drawFriend
+align 4
+LABELV cg_drawFriend
+skip 272
+export cg_deferPlayers
+align 4
+LABELV cg_deferPlayers
+skip 272
+export cg_predictItems
+align 4
+LABELV cg_predictItems
+skip 272
+export cg_bleedTime
+align 4
+LABELV cg_bleedTime
+skip 272
+export cg_blood
+align 4
+LABELV cg_blood
+skip 272
+export cg_paused
+align 4
+LABELV cg_paused
+skip 272
+export cg_buildScript
+align 4
+LABELV cg_buildScript
+skip 272
+export cg_forcePovModelIgnoreFreecamTeamSettings
+align 4
+LABELV cg_forcePovModelIgnoreFreecamTeamSettings
+skip 272
+export cg_forcePovModel
+align 4
+LABELV cg_forcePovModel
+skip 272
+export cg_forceModel
+align 4
+LABELV cg_forceModel
+skip 272
+export cg_stats
+align 4
+LABELV cg_stats
+skip 272
+export cg_teamChatHeight
+align 4
+LABELV cg_teamChatHeight
+skip 272
+export cg_teamChatTime
+align 4
+LABELV cg_teamChatTime
+skip 272
+export cg_synchronousClients
+align 4
+LABELV cg_synchronousClients
+skip 272
+export cg_drawAttackerWideScreen
+align 4
+LABELV cg_drawAttackerWideScreen
+skip 272
+export cg_drawAttackerFadeTime
+align 4
+LABELV cg_drawAttackerFadeTime
+skip 272
+export cg_drawAttackerFade
+align 4
+LABELV cg_drawAttackerFade
+skip 272
+export cg_drawAttackerAlpha
+align 4
+LABELV cg_drawAttackerAlpha
+skip 272
+export cg_drawAttackerColor
+align 4
+LABELV cg_drawAttackerColor
+skip 272
+export cg_drawAttackerTime
+align 4
+LABELV cg_drawAttackerTime
+skip 272
+export cg_drawAttackerImageScale
+align 4
+LABELV cg_drawAttackerImageScale
+skip 272
+export cg_drawAttackerScale
+align 4
+LABELV cg_drawAttackerScale
+skip 272
+export cg_drawAttackerPointSize
+align 4
+LABELV cg_drawAttackerPointSize
+skip 272
+export cg_drawAttackerFont
+align 4
+LABELV cg_drawAttackerFont
+skip 272
+export cg_drawAttackerStyle
+align 4
+LABELV cg_drawAttackerStyle
+skip 272
+export cg_drawAttackerAlign
+align 4
+LABELV cg_drawAttackerAlign
+skip 272
+export cg_drawAttackerY
+align 4
+LABELV cg_drawAttackerY
+skip 272
+export cg_drawAttackerX
+align 4
+LABELV cg_drawAttackerX
+skip 272
+export cg_drawAttacker
+align 4
+LABELV cg_drawAttacker
+skip 272
+export cg_lagometerSnapshotPing
+align 4
+LABELV cg_lagometerSnapshotPing
+skip 272
+export cg_lagometerAveragePing
+align 4
+LABELV cg_lagometerAveragePing
+skip 272
+export cg_lagometerFontAlpha
+align 4
+LABELV cg_lagometerFontAlpha
+skip 272
+export cg_lagometerAlpha
+align 4
+LABELV cg_lagometerAlpha
+skip 272
+export cg_lagometerFontColor
+align 4
+LABELV cg_lagometerFontColor
+skip 272
+export cg_lagometerScale
+align 4
+LABELV cg_lagometerScale
+skip 272
+export cg_lagometerFontScale
+align 4
+LABELV cg_lagometerFontScale
+skip 272
+export cg_lagometerFontPointSize
+align 4
+LABELV cg_lagometerFontPointSize
+skip 272
+export cg_lagometerFont
+align 4
+LABELV cg_lagometerFont
+skip 272
+export cg_lagometerFontStyle
+align 4
+LABELV cg_lagometerFontStyle
+skip 272
+export cg_lagometerFontAlign
+align 4
+LABELV cg_lagometerFontAlign
+skip 272
+export cg_lagometerAlign
+align 4
+LABELV cg_lagometerAlign
+skip 272
+export cg_lagometerFlashValue
+align 4
+LABELV cg_lagometerFlashValue
+skip 272
+export cg_lagometerFlash
+align 4
+LABELV cg_lagometerFlash
+skip 272
+export cg_lagometerWideScreen
+align 4
+LABELV cg_lagometerWideScreen
+skip 272
+export cg_lagometerY
+align 4
+LABELV cg_lagometerY
+skip 272
+export cg_lagometerX
+align 4
+LABELV cg_lagometerX
+skip 272
+export cg_lagometer
+align 4
+LABELV cg_lagometer
+skip 272
+export cg_stereoSeparation
+align 4
+LABELV cg_stereoSeparation
+skip 272
+export cg_thirdPerson
+align 4
+LABELV cg_thirdPerson
+skip 272
+export cg_thirdPersonAngle
+align 4
+LABELV cg_thirdPersonAngle
+skip 272
+export cg_thirdPersonRange
+align 4
+LABELV cg_thirdPersonRange
+skip 272
+export cg_zoomBroken
+align 4
+LABELV cg_zoomBroken
+skip 272
+export cg_zoomIgnoreTimescale
+align 4
+LABELV cg_zoomIgnoreTimescale
+skip 272
+export cg_zoomTime
+align 4
+LABELV cg_zoomTime
+skip 272
+export cg_zoomFov
+align 4
+LABELV cg_zoomFov
+skip 272
+export cg_fovIntermission
+align 4
+LABELV cg_fovIntermission
+skip 272
+export cg_fovForceAspectHeight
+align 4
+LABELV cg_fovForceAspectHeight
+skip 272
+export cg_fovForceAspectWidth
+align 4
+LABELV cg_fovForceAspectWidth
+skip 272
+export cg_fovStyle
+align 4
+LABELV cg_fovStyle
+skip 272
+export cg_fovy
+align 4
+LABELV cg_fovy
+skip 272
+export cg_fov
+align 4
+LABELV cg_fov
+skip 272
+export cg_itemSize
+align 4
+LABELV cg_itemSize
+skip 272
+export cg_itemFx
+align 4
+LABELV cg_itemFx
+skip 272
+export cg_itemsWh
+align 4
+LABELV cg_itemsWh
+skip 272
+export cg_simpleItemsHeightOffset
+align 4
+LABELV cg_simpleItemsHeightOffset
+skip 272
+export cg_simpleItemsBob
+align 4
+LABELV cg_simpleItemsBob
+skip 272
+export cg_simpleItemsScale
+align 4
+LABELV cg_simpleItemsScale
+skip 272
+export cg_simpleItems
+align 4
+LABELV cg_simpleItems
+skip 272
+export cg_ignore
+align 4
+LABELV cg_ignore
+skip 272
+export cg_autoswitch
+align 4
+LABELV cg_autoswitch
+skip 272
+export cg_tracerLength
+align 4
+LABELV cg_tracerLength
+skip 272
+export cg_tracerWidth
+align 4
+LABELV cg_tracerWidth
+skip 272
+export cg_tracerChance
+align 4
+LABELV cg_tracerChance
+skip 272
+export cg_viewsize
+align 4
+LABELV cg_viewsize
+skip 272
+export cg_drawGun
+align 4
+LABELV cg_drawGun
+skip 272
+export cg_gunSizeThirdPerson
+align 4
+LABELV cg_gunSizeThirdPerson
+skip 272
+export cg_gunSize
+align 4
+LABELV cg_gunSize
+skip 272
+export cg_gun_z
+align 4
+LABELV cg_gun_z
+skip 272
+export cg_gun_y
+align 4
+LABELV cg_gun_y
+skip 272
+export cg_gun_x
+align 4
+LABELV cg_gun_x
+skip 272
+export cg_gun_frame
+align 4
+LABELV cg_gun_frame
+skip 272
+export cg_brassTime
+align 4
+LABELV cg_brassTime
+skip 272
+export cg_debugImpactOrigin
+align 4
+LABELV cg_debugImpactOrigin
+skip 272
+export cg_markFadeTime
+align 4
+LABELV cg_markFadeTime
+skip 272
+export cg_markTime
+align 4
+LABELV cg_markTime
+skip 272
+export cg_marks
+align 4
+LABELV cg_marks
+skip 272
+export cg_footsteps
+align 4
+LABELV cg_footsteps
+skip 272
+export cg_showmiss
+align 4
+LABELV cg_showmiss
+skip 272
+export cg_noPlayerAnims
+align 4
+LABELV cg_noPlayerAnims
+skip 272
+export cg_nopredict
+align 4
+LABELV cg_nopredict
+skip 272
+export cg_errorDecay
+align 4
+LABELV cg_errorDecay
+skip 272
+export cg_railFromMuzzle
+align 4
+LABELV cg_railFromMuzzle
+skip 272
+export cg_railUseOwnColors
+align 4
+LABELV cg_railUseOwnColors
+skip 272
+export cg_railItemColor
+align 4
+LABELV cg_railItemColor
+skip 272
+export cg_railSpacing
+align 4
+LABELV cg_railSpacing
+skip 272
+export cg_railRotation
+align 4
+LABELV cg_railRotation
+skip 272
+export cg_railRadius
+align 4
+LABELV cg_railRadius
+skip 272
+export cg_railRings
+align 4
+LABELV cg_railRings
+skip 272
+export cg_railNudge
+align 4
+LABELV cg_railNudge
+skip 272
+export cg_railQLRailRingWhiteValue
+align 4
+LABELV cg_railQLRailRingWhiteValue
+skip 272
+export cg_railQL
+align 4
+LABELV cg_railQL
+skip 272
+export cg_railTrailTime
+align 4
+LABELV cg_railTrailTime
+skip 272
+export cg_debugServerCommands
+align 4
+LABELV cg_debugServerCommands
+skip 272
+export cg_debugEvents
+align 4
+LABELV cg_debugEvents
+skip 272
+export cg_debugPosition
+align 4
+LABELV cg_debugPosition
+skip 272
+export cg_debugAnim
+align 4
+LABELV cg_debugAnim
+skip 272
+export cg_animSpeed
+align 4
+LABELV cg_animSpeed
+skip 272
+export cg_draw2D
+align 4
+LABELV cg_draw2D
+skip 272
+export cg_drawTeamBackground
+align 4
+LABELV cg_drawTeamBackground
+skip 272
+export cg_drawStatus
+align 4
+LABELV cg_drawStatus
+skip 272
+export cg_crosshairAlphaAdjust
+align 4
+LABELV cg_crosshairAlphaAdjust
+skip 272
+export cg_crosshairAlpha
+align 4
+LABELV cg_crosshairAlpha
+skip 272
+export cg_crosshairBrightness
+align 4
+LABELV cg_crosshairBrightness
+skip 272
+export cg_crosshairHitTime
+align 4
+LABELV cg_crosshairHitTime
+skip 272
+export cg_crosshairHitColor
+align 4
+LABELV cg_crosshairHitColor
+skip 272
+export cg_crosshairHitStyle
+align 4
+LABELV cg_crosshairHitStyle
+skip 272
+export cg_crosshairPulse
+align 4
+LABELV cg_crosshairPulse
+skip 272
+export cg_crosshairHealth
+align 4
+LABELV cg_crosshairHealth
+skip 272
+export cg_crosshairSize
+align 4
+LABELV cg_crosshairSize
+skip 272
+export cg_crosshairY
+align 4
+LABELV cg_crosshairY
+skip 272
+export cg_crosshairX
+align 4
+LABELV cg_crosshairX
+skip 272
+export cg_drawRaceTimeWideScreen
+align 4
+LABELV cg_drawRaceTimeWideScreen
+skip 272
+export cg_drawRaceTimeAlpha
+align 4
+LABELV cg_drawRaceTimeAlpha
+skip 272
+export cg_drawRaceTimeColor
+align 4
+LABELV cg_drawRaceTimeColor
+skip 272
+export cg_drawRaceTimeScale
+align 4
+LABELV cg_drawRaceTimeScale
+skip 272
+export cg_drawRaceTimePointSize
+align 4
+LABELV cg_drawRaceTimePointSize
+skip 272
+export cg_drawRaceTimeFont
+align 4
+LABELV cg_drawRaceTimeFont
+skip 272
+export cg_drawRaceTimeStyle
+align 4
+LABELV cg_drawRaceTimeStyle
+skip 272
+export cg_drawRaceTimeAlign
+align 4
+LABELV cg_drawRaceTimeAlign
+skip 272
+export cg_drawRaceTimeY
+align 4
+LABELV cg_drawRaceTimeY
+skip 272
+export cg_drawRaceTimeX
+align 4
+LABELV cg_drawRaceTimeX
+skip 272
+export cg_drawRaceTimeNoText
+align 4
+LABELV cg_drawRaceTimeNoText
+skip 272
+export cg_drawRaceTime
+align 4
+LABELV cg_drawRaceTime
+skip 272
+export cg_drawJumpSpeedsTimeWideScreen
+align 4
+LABELV cg_drawJumpSpeedsTimeWideScreen
+skip 272
+export cg_drawJumpSpeedsTimeAlpha
+align 4
+LABELV cg_drawJumpSpeedsTimeAlpha
+skip 272
+export cg_drawJumpSpeedsTimeColor
+align 4
+LABELV cg_drawJumpSpeedsTimeColor
+skip 272
+export cg_drawJumpSpeedsTimeScale
+align 4
+LABELV cg_drawJumpSpeedsTimeScale
+skip 272
+export cg_drawJumpSpeedsTimePointSize
+align 4
+LABELV cg_drawJumpSpeedsTimePointSize
+skip 272
+export cg_drawJumpSpeedsTimeFont
+align 4
+LABELV cg_drawJumpSpeedsTimeFont
+skip 272
+export cg_drawJumpSpeedsTimeStyle
+align 4
+LABELV cg_drawJumpSpeedsTimeStyle
+skip 272
+export cg_drawJumpSpeedsTimeAlign
+align 4
+LABELV cg_drawJumpSpeedsTimeAlign
+skip 272
+export cg_drawJumpSpeedsTimeY
+align 4
+LABELV cg_drawJumpSpeedsTimeY
+skip 272
+export cg_drawJumpSpeedsTimeX
+align 4
+LABELV cg_drawJumpSpeedsTimeX
+skip 272
+export cg_drawJumpSpeedsTimeNoText
+align 4
+LABELV cg_drawJumpSpeedsTimeNoText
+skip 272
+export cg_drawJumpSpeedsTime
+align 4
+LABELV cg_drawJumpSpeedsTime
+skip 272
+export cg_drawJumpSpeedsWideScreen
+align 4
+LABELV cg_drawJumpSpeedsWideScreen
+skip 272
+export cg_drawJumpSpeedsAlpha
+align 4
+LABELV cg_drawJumpSpeedsAlpha
+skip 272
+export cg_drawJumpSpeedsColor
+align 4
+LABELV cg_drawJumpSpeedsColor
+skip 272
+export cg_drawJumpSpeedsScale
+align 4
+LABELV cg_drawJumpSpeedsScale
+skip 272
+export cg_drawJumpSpeedsPointSize
+align 4
+LABELV cg_drawJumpSpeedsPointSize
+skip 272
+export cg_drawJumpSpeedsFont
+align 4
+LABELV cg_drawJumpSpeedsFont
+skip 272
+export cg_drawJumpSpeedsStyle
+align 4
+LABELV cg_drawJumpSpeedsStyle
+skip 272
+export cg_drawJumpSpeedsAlign
+align 4
+LABELV cg_drawJumpSpeedsAlign
+skip 272
+export cg_drawJumpSpeedsY
+align 4
+LABELV cg_drawJumpSpeedsY
+skip 272
+export cg_drawJumpSpeedsX
+align 4
+LABELV cg_drawJumpSpeedsX
+skip 272
+export cg_drawJumpSpeedsMax
+align 4
+LABELV cg_drawJumpSpeedsMax
+skip 272
+export cg_drawJumpSpeedsNoText
+align 4
+LABELV cg_drawJumpSpeedsNoText
+skip 272
+export cg_drawJumpSpeeds
+align 4
+LABELV cg_drawJumpSpeeds
+skip 272
+export cg_selfOnTeamOverlay
+align 4
+LABELV cg_selfOnTeamOverlay
+skip 272
+export cg_drawTeamOverlayMaxPlayers
+align 4
+LABELV cg_drawTeamOverlayMaxPlayers
+skip 272
+export cg_drawTeamOverlayLineOffset
+align 4
+LABELV cg_drawTeamOverlayLineOffset
+skip 272
+export cg_drawTeamOverlayWideScreen
+align 4
+LABELV cg_drawTeamOverlayWideScreen
+skip 272
+export cg_drawTeamOverlayScale
+align 4
+LABELV cg_drawTeamOverlayScale
+skip 272
+export cg_drawTeamOverlayAlign
+align 4
+LABELV cg_drawTeamOverlayAlign
+skip 272
+export cg_drawTeamOverlayPointSize
+align 4
+LABELV cg_drawTeamOverlayPointSize
+skip 272
+export cg_drawTeamOverlayFont
+align 4
+LABELV cg_drawTeamOverlayFont
+skip 272
+export cg_teamOverlayUserinfo
+align 4
+LABELV cg_teamOverlayUserinfo
+skip 272
+export cg_drawTeamOverlayY
+align 4
+LABELV cg_drawTeamOverlayY
+skip 272
+export cg_drawTeamOverlayX
+align 4
+LABELV cg_drawTeamOverlayX
+skip 272
+export cg_drawTeamOverlay
+align 4
+LABELV cg_drawTeamOverlay
+skip 272
+export cg_rewardsStack
+align 4
+LABELV cg_rewardsStack
+skip 272
+export cg_drawRewardsWideScreen
+align 4
+LABELV cg_drawRewardsWideScreen
+skip 272
+export cg_drawRewardsFadeTime
+align 4
+LABELV cg_drawRewardsFadeTime
+skip 272
+export cg_drawRewardsFade
+align 4
+LABELV cg_drawRewardsFade
+skip 272
+export cg_drawRewardsAlpha
+align 4
+LABELV cg_drawRewardsAlpha
+skip 272
+export cg_drawRewardsColor
+align 4
+LABELV cg_drawRewardsColor
+skip 272
+export cg_drawRewardsTime
+align 4
+LABELV cg_drawRewardsTime
+skip 272
+export cg_drawRewardsImageScale
+align 4
+LABELV cg_drawRewardsImageScale
+skip 272
+export cg_drawRewardsScale
+align 4
+LABELV cg_drawRewardsScale
+skip 272
+export cg_drawRewardsPointSize
+align 4
+LABELV cg_drawRewardsPointSize
+skip 272
+export cg_drawRewardsFont
+align 4
+LABELV cg_drawRewardsFont
+skip 272
+export cg_drawRewardsStyle
+align 4
+LABELV cg_drawRewardsStyle
+skip 272
+export cg_drawRewardsAlign
+align 4
+LABELV cg_drawRewardsAlign
+skip 272
+export cg_drawRewardsY
+align 4
+LABELV cg_drawRewardsY
+skip 272
+export cg_drawRewardsX
+align 4
+LABELV cg_drawRewardsX
+skip 272
+export cg_drawRewardsMax
+align 4
+LABELV cg_drawRewardsMax
+skip 272
+export cg_drawRewards
+align 4
+LABELV cg_drawRewards
+skip 272
+export cg_drawCrosshairTeammateHealthWideScreen
+align 4
+LABELV cg_drawCrosshairTeammateHealthWideScreen
+skip 272
+export cg_drawCrosshairTeammateHealthFadeTime
+align 4
+LABELV cg_drawCrosshairTeammateHealthFadeTime
+skip 272
+export cg_drawCrosshairTeammateHealthFade
+align 4
+LABELV cg_drawCrosshairTeammateHealthFade
+skip 272
+export cg_drawCrosshairTeammateHealthAlpha
+align 4
+LABELV cg_drawCrosshairTeammateHealthAlpha
+skip 272
+export cg_drawCrosshairTeammateHealthColor
+align 4
+LABELV cg_drawCrosshairTeammateHealthColor
+skip 272
+export cg_drawCrosshairTeammateHealthTime
+align 4
+LABELV cg_drawCrosshairTeammateHealthTime
+skip 272
+export cg_drawCrosshairTeammateHealthScale
+align 4
+LABELV cg_drawCrosshairTeammateHealthScale
+skip 272
+export cg_drawCrosshairTeammateHealthPointSize
+align 4
+LABELV cg_drawCrosshairTeammateHealthPointSize
+skip 272
+export cg_drawCrosshairTeammateHealthFont
+align 4
+LABELV cg_drawCrosshairTeammateHealthFont
+skip 272
+export cg_drawCrosshairTeammateHealthStyle
+align 4
+LABELV cg_drawCrosshairTeammateHealthStyle
+skip 272
+export cg_drawCrosshairTeammateHealthAlign
+align 4
+LABELV cg_drawCrosshairTeammateHealthAlign
+skip 272
+export cg_drawCrosshairTeammateHealthY
+align 4
+LABELV cg_drawCrosshairTeammateHealthY
+skip 272
+export cg_drawCrosshairTeammateHealthX
+align 4
+LABELV cg_drawCrosshairTeammateHealthX
+skip 272
+export cg_drawCrosshairTeammateHealth
+align 4
+LABELV cg_drawCrosshairTeammateHealth
+skip 272
+export cg_drawCrosshairNamesWideScreen
+align 4
+LABELV cg_drawCrosshairNamesWideScreen
+skip 272
+export cg_drawCrosshairNamesFadeTime
+align 4
+LABELV cg_drawCrosshairNamesFadeTime
+skip 272
+export cg_drawCrosshairNamesFade
+align 4
+LABELV cg_drawCrosshairNamesFade
+skip 272
+export cg_drawCrosshairNamesAlpha
+align 4
+LABELV cg_drawCrosshairNamesAlpha
+skip 272
+export cg_drawCrosshairNamesColor
+align 4
+LABELV cg_drawCrosshairNamesColor
+skip 272
+export cg_drawCrosshairNamesTime
+align 4
+LABELV cg_drawCrosshairNamesTime
+skip 272
+export cg_drawCrosshairNamesScale
+align 4
+LABELV cg_drawCrosshairNamesScale
+skip 272
+export cg_drawCrosshairNamesPointSize
+align 4
+LABELV cg_drawCrosshairNamesPointSize
+skip 272
+export cg_drawCrosshairNamesFont
+align 4
+LABELV cg_drawCrosshairNamesFont
+skip 272
+export cg_drawCrosshairNamesStyle
+align 4
+LABELV cg_drawCrosshairNamesStyle
+skip 272
+export cg_drawCrosshairNamesAlign
+align 4
+LABELV cg_drawCrosshairNamesAlign
+skip 272
+export cg_drawCrosshairNamesY
+align 4
+LABELV cg_drawCrosshairNamesY
+skip 272
+export cg_drawCrosshairNamesX
+align 4
+LABELV cg_drawCrosshairNamesX
+skip 272
+export cg_drawCrosshairNames
+align 4
+LABELV cg_drawCrosshairNames
+skip 272
+export cg_drawCrosshair
+align 4
+LABELV cg_drawCrosshair
+skip 272
+export cg_lowAmmoWarningChainGun
+align 4
+LABELV cg_lowAmmoWarningChainGun
+skip 272
+export cg_lowAmmoWarningProximityLauncher
+align 4
+LABELV cg_lowAmmoWarningProximityLauncher
+skip 272
+export cg_lowAmmoWarningNailGun
+align 4
+LABELV cg_lowAmmoWarningNailGun
+skip 272
+export cg_lowAmmoWarningGrapplingHook
+align 4
+LABELV cg_lowAmmoWarningGrapplingHook
+skip 272
+export cg_lowAmmoWarningBFG
+align 4
+LABELV cg_lowAmmoWarningBFG
+skip 272
+export cg_lowAmmoWarningPlasmaGun
+align 4
+LABELV cg_lowAmmoWarningPlasmaGun
+skip 272
+export cg_lowAmmoWarningRailGun
+align 4
+LABELV cg_lowAmmoWarningRailGun
+skip 272
+export cg_lowAmmoWarningLightningGun
+align 4
+LABELV cg_lowAmmoWarningLightningGun
+skip 272
+export cg_lowAmmoWarningRocketLauncher
+align 4
+LABELV cg_lowAmmoWarningRocketLauncher
+skip 272
+export cg_lowAmmoWarningGrenadeLauncher
+align 4
+LABELV cg_lowAmmoWarningGrenadeLauncher
+skip 272
+export cg_lowAmmoWarningShotgun
+align 4
+LABELV cg_lowAmmoWarningShotgun
+skip 272
+export cg_lowAmmoWarningMachineGun
+align 4
+LABELV cg_lowAmmoWarningMachineGun
+skip 272
+export cg_lowAmmoWarningGauntlet
+align 4
+LABELV cg_lowAmmoWarningGauntlet
+skip 272
+export cg_lowAmmoWeaponBarWarning
+align 4
+LABELV cg_lowAmmoWeaponBarWarning
+skip 272
+export cg_lowAmmoWarningSound
+align 4
+LABELV cg_lowAmmoWarningSound
+skip 272
+export cg_lowAmmoWarningPercentile
+align 4
+LABELV cg_lowAmmoWarningPercentile
+skip 272
+export cg_lowAmmoWarningStyle
+align 4
+LABELV cg_lowAmmoWarningStyle
+skip 272
+export cg_drawAmmoWarningWideScreen
+align 4
+LABELV cg_drawAmmoWarningWideScreen
+skip 272
+export cg_drawAmmoWarningAlpha
+align 4
+LABELV cg_drawAmmoWarningAlpha
+skip 272
+export cg_drawAmmoWarningColor
+align 4
+LABELV cg_drawAmmoWarningColor
+skip 272
+export cg_drawAmmoWarningScale
+align 4
+LABELV cg_drawAmmoWarningScale
+skip 272
+export cg_drawAmmoWarningPointSize
+align 4
+LABELV cg_drawAmmoWarningPointSize
+skip 272
+export cg_drawAmmoWarningFont
+align 4
+LABELV cg_drawAmmoWarningFont
+skip 272
+export cg_drawAmmoWarningStyle
+align 4
+LABELV cg_drawAmmoWarningStyle
+skip 272
+export cg_drawAmmoWarningAlign
+align 4
+LABELV cg_drawAmmoWarningAlign
+skip 272
+export cg_drawAmmoWarningY
+align 4
+LABELV cg_drawAmmoWarningY
+skip 272
+export cg_drawAmmoWarningX
+align 4
+LABELV cg_drawAmmoWarningX
+skip 272
+export cg_drawAmmoWarning
+align 4
+LABELV cg_drawAmmoWarning
+skip 272
+export cg_drawIcons
+align 4
+LABELV cg_drawIcons
+skip 272
+export cg_draw3dIcons
+align 4
+LABELV cg_draw3dIcons
+skip 272
+export cg_drawSnapshotWideScreen
+align 4
+LABELV cg_drawSnapshotWideScreen
+skip 272
+export cg_drawSnapshotAlpha
+align 4
+LABELV cg_drawSnapshotAlpha
+skip 272
+export cg_drawSnapshotColor
+align 4
+LABELV cg_drawSnapshotColor
+skip 272
+export cg_drawSnapshotScale
+align 4
+LABELV cg_drawSnapshotScale
+skip 272
+export cg_drawSnapshotPointSize
+align 4
+LABELV cg_drawSnapshotPointSize
+skip 272
+export cg_drawSnapshotFont
+align 4
+LABELV cg_drawSnapshotFont
+skip 272
+export cg_drawSnapshotStyle
+align 4
+LABELV cg_drawSnapshotStyle
+skip 272
+export cg_drawSnapshotAlign
+align 4
+LABELV cg_drawSnapshotAlign
+skip 272
+export cg_drawSnapshotY
+align 4
+LABELV cg_drawSnapshotY
+skip 272
+export cg_drawSnapshotX
+align 4
+LABELV cg_drawSnapshotX
+skip 272
+export cg_drawSnapshot
+align 4
+LABELV cg_drawSnapshot
+skip 272
+export cg_drawFPSWideScreen
+align 4
+LABELV cg_drawFPSWideScreen
+skip 272
+export cg_drawFPSAlpha
+align 4
+LABELV cg_drawFPSAlpha
+skip 272
+export cg_drawFPSColor
+align 4
+LABELV cg_drawFPSColor
+skip 272
+export cg_drawFPSScale
+align 4
+LABELV cg_drawFPSScale
+skip 272
+export cg_drawFPSPointSize
+align 4
+LABELV cg_drawFPSPointSize
+skip 272
+export cg_drawFPSFont
+align 4
+LABELV cg_drawFPSFont
+skip 272
+export cg_drawFPSStyle
+align 4
+LABELV cg_drawFPSStyle
+skip 272
+export cg_drawFPSAlign
+align 4
+LABELV cg_drawFPSAlign
+skip 272
+export cg_drawFPSY
+align 4
+LABELV cg_drawFPSY
+skip 272
+export cg_drawFPSX
+align 4
+LABELV cg_drawFPSX
+skip 272
+export cg_drawFPSNoText
+align 4
+LABELV cg_drawFPSNoText
+skip 272
+export cg_drawFPS
+align 4
+LABELV cg_drawFPS
+skip 272
+export cg_itemTimersAlpha
+align 4
+LABELV cg_itemTimersAlpha
+skip 272
+export cg_itemTimersOffset
+align 4
+LABELV cg_itemTimersOffset
+skip 272
+export cg_itemTimersScale
+align 4
+LABELV cg_itemTimersScale
+skip 272
+export cg_itemTimers
+align 4
+LABELV cg_itemTimers
+skip 272
+export cg_itemSpawnPrint
+align 4
+LABELV cg_itemSpawnPrint
+skip 272
+export cg_drawClientItemTimerWideScreen
+align 4
+LABELV cg_drawClientItemTimerWideScreen
+skip 272
+export cg_drawClientItemTimerIconYoffset
+align 4
+LABELV cg_drawClientItemTimerIconYoffset
+skip 272
+export cg_drawClientItemTimerIconXoffset
+align 4
+LABELV cg_drawClientItemTimerIconXoffset
+skip 272
+export cg_drawClientItemTimerIconSize
+align 4
+LABELV cg_drawClientItemTimerIconSize
+skip 272
+export cg_drawClientItemTimerIcon
+align 4
+LABELV cg_drawClientItemTimerIcon
+skip 272
+export cg_drawClientItemTimerSpacing
+align 4
+LABELV cg_drawClientItemTimerSpacing
+skip 272
+export cg_drawClientItemTimerAlign
+align 4
+LABELV cg_drawClientItemTimerAlign
+skip 272
+export cg_drawClientItemTimerStyle
+align 4
+LABELV cg_drawClientItemTimerStyle
+skip 272
+export cg_drawClientItemTimerAlpha
+align 4
+LABELV cg_drawClientItemTimerAlpha
+skip 272
+export cg_drawClientItemTimerPointSize
+align 4
+LABELV cg_drawClientItemTimerPointSize
+skip 272
+export cg_drawClientItemTimerFont
+align 4
+LABELV cg_drawClientItemTimerFont
+skip 272
+export cg_drawClientItemTimerTextColor
+align 4
+LABELV cg_drawClientItemTimerTextColor
+skip 272
+export cg_drawClientItemTimerScale
+align 4
+LABELV cg_drawClientItemTimerScale
+skip 272
+export cg_drawClientItemTimerY
+align 4
+LABELV cg_drawClientItemTimerY
+skip 272
+export cg_drawClientItemTimerX
+align 4
+LABELV cg_drawClientItemTimerX
+skip 272
+export cg_drawClientItemTimerFilter
+align 4
+LABELV cg_drawClientItemTimerFilter
+skip 272
+export cg_drawClientItemTimer
+align 4
+LABELV cg_drawClientItemTimer
+skip 272
+export cg_drawTimer
+align 4
+LABELV cg_drawTimer
+skip 272
+export cg_shotgunRandomness
+align 4
+LABELV cg_shotgunRandomness
+skip 272
+export cg_shotgunStyle
+align 4
+LABELV cg_shotgunStyle
+skip 272
+export cg_shotgunMarks
+align 4
+LABELV cg_shotgunMarks
+skip 272
+export cg_shotgunImpactSparks
+align 4
+LABELV cg_shotgunImpactSparks
+skip 272
+export cg_impactSparksHighlight
+align 4
+LABELV cg_impactSparksHighlight
+skip 272
+export cg_impactSparksColor
+align 4
+LABELV cg_impactSparksColor
+skip 272
+export cg_impactSparksVelocity
+align 4
+LABELV cg_impactSparksVelocity
+skip 272
+export cg_impactSparksSize
+align 4
+LABELV cg_impactSparksSize
+skip 272
+export cg_impactSparksLifetime
+align 4
+LABELV cg_impactSparksLifetime
+skip 272
+export cg_impactSparks
+align 4
+LABELV cg_impactSparks
+skip 272
+export cg_gibFloatingOriginOffsetZ
+align 4
+LABELV cg_gibFloatingOriginOffsetZ
+skip 272
+export cg_gibFloatingOriginOffset
+align 4
+LABELV cg_gibFloatingOriginOffset
+skip 272
+export cg_gibFloatingRandomness
+align 4
+LABELV cg_gibFloatingRandomness
+skip 272
+export cg_gibFloatingVelocity
+align 4
+LABELV cg_gibFloatingVelocity
+skip 272
+export cg_gibSparksHighlight
+align 4
+LABELV cg_gibSparksHighlight
+skip 272
+export cg_gibSparksColor
+align 4
+LABELV cg_gibSparksColor
+skip 272
+export cg_gibSparksSize
+align 4
+LABELV cg_gibSparksSize
+skip 272
+export cg_gibGravity
+align 4
+LABELV cg_gibGravity
+skip 272
+export cg_gibBounceFactor
+align 4
+LABELV cg_gibBounceFactor
+skip 272
+export cg_gibStepTime
+align 4
+LABELV cg_gibStepTime
+skip 272
+export cg_gibTime
+align 4
+LABELV cg_gibTime
+skip 272
+export cg_gibRandomnessZ
+align 4
+LABELV cg_gibRandomnessZ
+skip 272
+export cg_gibRandomness
+align 4
+LABELV cg_gibRandomness
+skip 272
+export cg_gibOriginOffsetZ
+align 4
+LABELV cg_gibOriginOffsetZ
+skip 272
+export cg_gibOriginOffset
+align 4
+LABELV cg_gibOriginOffset
+skip 272
+export cg_gibDirScale
+align 4
+LABELV cg_gibDirScale
+skip 272
+export cg_gibVelocityRandomness
+align 4
+LABELV cg_gibVelocityRandomness
+skip 272
+export cg_gibVelocity
+align 4
+LABELV cg_gibVelocity
+skip 272
+export cg_gibJump
+align 4
+LABELV cg_gibJump
+skip 272
+export cg_gibColor
+align 4
+LABELV cg_gibColor
+skip 272
+export cg_gibs
+align 4
+LABELV cg_gibs
+skip 272
+export cg_thawGibs
+align 4
+LABELV cg_thawGibs
+skip 272
+export cg_shadows
+align 4
+LABELV cg_shadows
+skip 272
+export cg_swingSpeed
+align 4
+LABELV cg_swingSpeed
+skip 272
+export cg_bobroll
+align 4
+LABELV cg_bobroll
+skip 272
+export cg_bobpitch
+align 4
+LABELV cg_bobpitch
+skip 272
+export cg_bobup
+align 4
+LABELV cg_bobup
+skip 272
+export cg_items
+align 4
+LABELV cg_items
+skip 6144
+export cg_weapons
+align 4
+LABELV cg_weapons
+skip 2112
+export cg_entities
+align 4
+LABELV cg_entities
+skip 1533400
+export cg
+align 4
+LABELV cg
+skip 6770188
+export cgs
+align 4
+LABELV cgs
+skip 1969996
+export cgDC
+align 4
+LABELV cgDC
+skip 5653780
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $6279
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $6267
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6266
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6259
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6258
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6254
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6253
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6249
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6248
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6244
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6243
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6239
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6238
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6234
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6233
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6227
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6226
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6222
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6221
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6217
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6216
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6212
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6211
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6207
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6206
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6205
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6204
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6203
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6202
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6201
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6200
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6199
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $6198
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $6193
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $6157
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $6154
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $6134
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $6087
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $6086
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $6077
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $6076
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 107
+byte 1 108
+byte 1 97
+byte 1 120
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $6075
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 107
+byte 1 108
+byte 1 97
+byte 1 120
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $6074
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 50
+byte 1 0
+align 1
+LABELV $6073
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 49
+byte 1 0
+align 1
+LABELV $6072
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 114
+byte 1 49
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $6071
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 114
+byte 1 49
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $6070
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 49
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $6069
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $6068
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $6066
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $6063
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $6054
+byte 1 94
+byte 1 51
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $6053
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $6050
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $6046
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $6045
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $6022
+byte 1 32
+byte 1 94
+byte 1 54
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 0
+align 1
+LABELV $6020
+byte 1 94
+byte 1 53
+byte 1 113
+byte 1 108
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $6015
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $6014
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 122
+byte 1 0
+align 1
+LABELV $6013
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $6010
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $6009
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $6008
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $6005
+byte 1 94
+byte 1 53
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $5994
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $5990
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $5984
+byte 1 40
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 114
+byte 1 121
+byte 1 112
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $5982
+byte 1 94
+byte 1 53
+byte 1 111
+byte 1 115
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $5978
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5977
+byte 1 111
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $5971
+byte 1 94
+byte 1 53
+byte 1 99
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $5967
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 49
+byte 1 48
+byte 1 115
+byte 1 0
+align 1
+LABELV $5965
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $5963
+byte 1 99
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $5955
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $5939
+byte 1 117
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $5938
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $5932
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 50
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $5929
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $5926
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $5924
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $5910
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 113
+byte 1 108
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $5883
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $5882
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $5879
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 83
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $5878
+byte 1 49
+byte 1 50
+byte 1 46
+byte 1 48
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 50
+byte 1 54
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 57
+byte 1 102
+byte 1 56
+byte 1 100
+byte 1 98
+byte 1 57
+byte 1 48
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 50
+byte 1 54
+byte 1 45
+byte 1 49
+byte 1 48
+byte 1 45
+byte 1 49
+byte 1 56
+byte 1 0
+align 1
+LABELV $5877
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $5876
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $5787
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $5784
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $5781
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $5778
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $5775
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $5772
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $5769
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 100
+byte 1 119
+byte 1 110
+byte 1 95
+byte 1 97
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $5766
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $5763
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $5759
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 99
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $5755
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $5751
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $5747
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $5743
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $5739
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $5736
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $5733
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $5658
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 73
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $5523
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 40
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $5398
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $5324
+byte 1 120
+byte 1 120
+byte 1 120
+byte 1 0
+align 1
+LABELV $5265
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 70
+byte 1 102
+byte 1 97
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $5256
+byte 1 94
+byte 1 51
+byte 1 102
+byte 1 95
+byte 1 37
+byte 1 100
+byte 1 95
+byte 1 0
+align 1
+LABELV $5020
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 67
+byte 1 116
+byte 1 102
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $4987
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4986
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4983
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4982
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4906
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 84
+byte 1 100
+byte 1 109
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $4873
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 107
+byte 1 0
+align 1
+LABELV $4866
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $4850
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4849
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4827
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $4826
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $4811
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 114
+byte 1 0
+align 1
+LABELV $4810
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 103
+byte 1 0
+align 1
+LABELV $4796
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $4771
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 67
+byte 1 97
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $4746
+byte 1 45
+byte 1 0
+align 1
+LABELV $4709
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $4675
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 67
+byte 1 116
+byte 1 102
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $4640
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 84
+byte 1 100
+byte 1 109
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $4625
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $4622
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $4617
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $4615
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $4613
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4612
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4600
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 67
+byte 1 97
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $4529
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $4491
+byte 1 85
+byte 1 73
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4490
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $4487
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $4475
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $4472
+byte 1 94
+byte 1 49
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 101
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $4469
+byte 1 94
+byte 1 51
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $4466
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4452
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $4449
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4443
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $4437
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $4422
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $4419
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $4418
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4413
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $4412
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4409
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $4396
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $4388
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 89
+byte 1 0
+align 1
+LABELV $4380
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 88
+byte 1 0
+align 1
+LABELV $4372
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 65
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4364
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4356
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $4352
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $4333
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $4325
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 66
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $4317
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $4309
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $4301
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $4293
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $4283
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4273
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4263
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4259
+byte 1 125
+byte 1 0
+align 1
+LABELV $4250
+byte 1 123
+byte 1 0
+align 1
+LABELV $4236
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 78
+byte 1 111
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $4230
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 113
+byte 1 108
+byte 1 57
+byte 1 49
+byte 1 32
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4219
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4215
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $4210
+byte 1 94
+byte 1 49
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 113
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4035
+byte 1 94
+byte 1 53
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $4026
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $4025
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $4024
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $4017
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $4016
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $4015
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $4006
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $4004
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3999
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $3992
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $3990
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $3989
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3988
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3962
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $3959
+byte 1 94
+byte 1 55
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $3958
+byte 1 94
+byte 1 55
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $3948
+byte 1 94
+byte 1 51
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $3942
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3939
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $3932
+byte 1 94
+byte 1 53
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $3915
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $3912
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 76
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $3909
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 82
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $3906
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $3903
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $3900
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 87
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $3897
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 98
+byte 1 115
+byte 1 0
+align 1
+LABELV $3894
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $3891
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $3888
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $3885
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $3882
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $3879
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 53
+byte 1 67
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3876
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 53
+byte 1 0
+align 1
+LABELV $3873
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 50
+byte 1 52
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3870
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $3867
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 49
+byte 1 50
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3864
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $3861
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 55
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3858
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 55
+byte 1 0
+align 1
+LABELV $3855
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 53
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3852
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 53
+byte 1 0
+align 1
+LABELV $3849
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3846
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $3843
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 108
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3840
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $3837
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3834
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3831
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 50
+byte 1 0
+align 1
+LABELV $3828
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3825
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $3822
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $3819
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $3815
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 114
+byte 1 114
+byte 1 0
+align 1
+LABELV $3811
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $3807
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $3803
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $3799
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 49
+byte 1 102
+byte 1 0
+align 1
+LABELV $3792
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $3788
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 0
+align 1
+LABELV $3784
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 0
+align 1
+LABELV $3780
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $3776
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $3773
+byte 1 98
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $3770
+byte 1 98
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 0
+align 1
+LABELV $3767
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 119
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $3764
+byte 1 110
+byte 1 111
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3761
+byte 1 103
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3758
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 86
+byte 1 73
+byte 1 83
+byte 1 0
+align 1
+LABELV $3755
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 0
+align 1
+LABELV $3752
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 0
+align 1
+LABELV $3749
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 66
+byte 1 83
+byte 1 0
+align 1
+LABELV $3746
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 81
+byte 1 85
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $3743
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 78
+byte 1 84
+byte 1 82
+byte 1 76
+byte 1 70
+byte 1 76
+byte 1 65
+byte 1 71
+byte 1 0
+align 1
+LABELV $3740
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 70
+byte 1 76
+byte 1 65
+byte 1 71
+byte 1 0
+align 1
+LABELV $3737
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 70
+byte 1 76
+byte 1 65
+byte 1 71
+byte 1 0
+align 1
+LABELV $3734
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 77
+byte 1 75
+byte 1 0
+align 1
+LABELV $3731
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 77
+byte 1 72
+byte 1 0
+align 1
+LABELV $3728
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 71
+byte 1 65
+byte 1 0
+align 1
+LABELV $3725
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 89
+byte 1 65
+byte 1 0
+align 1
+LABELV $3722
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 0
+align 1
+LABELV $3719
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3715
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $3711
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $3708
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 51
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $3705
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3702
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $3699
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3696
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3693
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3690
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3687
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3684
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3681
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3678
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3674
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 47
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3670
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 47
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3663
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3648
+byte 1 42
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $3641
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $3634
+byte 1 113
+byte 1 51
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $3631
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $3625
+byte 1 119
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 0
+align 1
+LABELV $3622
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $3619
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $3616
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $3613
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $3610
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $3606
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $3602
+byte 1 89
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $3598
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $3583
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3577
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 0
+align 1
+LABELV $3574
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3571
+byte 1 97
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $3568
+byte 1 97
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 56
+byte 1 120
+byte 1 49
+byte 1 0
+align 1
+LABELV $3565
+byte 1 97
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 52
+byte 1 120
+byte 1 49
+byte 1 0
+align 1
+LABELV $3562
+byte 1 97
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 50
+byte 1 120
+byte 1 49
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $3559
+byte 1 97
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 50
+byte 1 120
+byte 1 49
+byte 1 0
+align 1
+LABELV $3556
+byte 1 97
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 49
+byte 1 120
+byte 1 49
+byte 1 0
+align 1
+LABELV $3553
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $3550
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $3547
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 100
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $3544
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $3541
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $3538
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $3535
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $3532
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3529
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $3526
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 0
+align 1
+LABELV $3523
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3520
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $3517
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $3514
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $3511
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3508
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $3505
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $3502
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3499
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $3496
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3493
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3490
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3487
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3484
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3481
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3478
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3475
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3472
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3469
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3466
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 105
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3463
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3460
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3457
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $3454
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3451
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3448
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3445
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3442
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3439
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $3436
+byte 1 116
+byte 1 114
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $3431
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $3424
+byte 1 113
+byte 1 51
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $3421
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $3416
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3413
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3406
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 113
+byte 1 51
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3403
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3396
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 113
+byte 1 51
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3393
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3386
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 113
+byte 1 51
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3383
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3376
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 113
+byte 1 51
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3373
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3366
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 113
+byte 1 51
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3363
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3356
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 113
+byte 1 51
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3353
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3346
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 113
+byte 1 51
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3343
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3336
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 113
+byte 1 51
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3333
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3326
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 113
+byte 1 51
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3323
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 98
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3316
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 113
+byte 1 51
+byte 1 47
+byte 1 97
+byte 1 98
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3313
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3310
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 98
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3304
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3301
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3298
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $3295
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $3292
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 104
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3289
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $3286
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3283
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $3280
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3277
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $3270
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $3267
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 122
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $3264
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $3254
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $3251
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 84
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 69
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $3248
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 84
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3245
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 69
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $3242
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $3239
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 101
+byte 1 0
+align 1
+LABELV $3236
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3233
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $3230
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $3227
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 101
+byte 1 0
+align 1
+LABELV $3224
+byte 1 94
+byte 1 49
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3219
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $3211
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3206
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3203
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 97
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $3198
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 97
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $3195
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $3190
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $3187
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $3184
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $3181
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3178
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $3175
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 97
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $3161
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 95
+byte 1 101
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3158
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 95
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3155
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 95
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3152
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3149
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 95
+byte 1 97
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3146
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 95
+byte 1 101
+byte 1 0
+align 1
+LABELV $3143
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 95
+byte 1 100
+byte 1 0
+align 1
+LABELV $3140
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 95
+byte 1 99
+byte 1 0
+align 1
+LABELV $3137
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 0
+align 1
+LABELV $3134
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 95
+byte 1 97
+byte 1 0
+align 1
+LABELV $3131
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 101
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3128
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3125
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3122
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 98
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3119
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3116
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 101
+byte 1 0
+align 1
+LABELV $3113
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 100
+byte 1 0
+align 1
+LABELV $3110
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 99
+byte 1 0
+align 1
+LABELV $3107
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 98
+byte 1 0
+align 1
+LABELV $3104
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 0
+align 1
+LABELV $3101
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $3098
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 108
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3095
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3092
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3089
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3081
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3078
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3075
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3072
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3063
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3060
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3057
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3054
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3051
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $3038
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 47
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3035
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3032
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3029
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3026
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3023
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3020
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3017
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3014
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3011
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3008
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 47
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3005
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $3002
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $2999
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $2996
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $2982
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2969
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $2966
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2962
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2958
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2955
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2951
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2947
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2944
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $2941
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $2938
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2935
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $2932
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $2924
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $2921
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $2918
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $2915
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 111
+byte 1 111
+byte 1 0
+align 1
+LABELV $2912
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $2909
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2906
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2903
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2900
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2897
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $2894
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 104
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $2891
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $2888
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2881
+byte 1 94
+byte 1 49
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $2875
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2868
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $2865
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2862
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2859
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2856
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2853
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $2846
+byte 1 113
+byte 1 51
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $2843
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $2837
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 49
+byte 1 0
+align 1
+LABELV $2834
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $2831
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $2828
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $2825
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 82
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 0
+align 1
+LABELV $2822
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $2819
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2816
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $2813
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2810
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2807
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2804
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2801
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 66
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2798
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 53
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2794
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 52
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2790
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 51
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2786
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2782
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2773
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 0
+align 1
+LABELV $2770
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2766
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $2765
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $2764
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $2763
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $2762
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 105
+byte 1 120
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $2761
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $2760
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $2759
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $2758
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $2757
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $2756
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $2628
+byte 1 113
+byte 1 51
+byte 1 103
+byte 1 105
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2621
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $2612
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $2608
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2605
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2602
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2599
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 50
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2596
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2593
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2590
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2587
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2584
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2580
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2576
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2569
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 118
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2566
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2563
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2560
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2557
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2554
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2551
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2548
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2545
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2542
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2539
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2536
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2533
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2530
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2527
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2524
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2521
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 120
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2518
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 120
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2515
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2512
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2509
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2506
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2503
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 107
+byte 1 108
+byte 1 97
+byte 1 120
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2500
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 107
+byte 1 108
+byte 1 97
+byte 1 120
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2497
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2494
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2491
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2487
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2486
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 84
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2484
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $2461
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2457
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2453
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2449
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2445
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2441
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2437
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2433
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2430
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2425
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2422
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2419
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2416
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2413
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2410
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 50
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2407
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 49
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2404
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 48
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2401
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2398
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2395
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2392
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2389
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2386
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2383
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2380
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2377
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2374
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2371
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2368
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2365
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2362
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2359
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2356
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2353
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 52
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2350
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 51
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2347
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2344
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2341
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 95
+byte 1 48
+byte 1 52
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2338
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 95
+byte 1 48
+byte 1 51
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2335
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2332
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2329
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2322
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2319
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2312
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2309
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2302
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2299
+byte 1 100
+byte 1 108
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 116
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2292
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 116
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2289
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2286
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2283
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2280
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 98
+byte 1 121
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2277
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2269
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2266
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2256
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2253
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2250
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2247
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2244
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2239
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2236
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2227
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2224
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2221
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2218
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2215
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2212
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2209
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2206
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2203
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2200
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2197
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2194
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2191
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2188
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2185
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2182
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 100
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 51
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2178
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 100
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2174
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 100
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 49
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2169
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2165
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 50
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2161
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 49
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2158
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2154
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 50
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2150
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 49
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2147
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2144
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2139
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2136
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2133
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2130
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 51
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2126
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 50
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2122
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2119
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2116
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2113
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2110
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2107
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2104
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2097
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2094
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2087
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2076
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2073
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2063
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2060
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2057
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2054
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2051
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2048
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2039
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2036
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2033
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2030
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2027
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2024
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2021
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2018
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2015
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2012
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2009
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2006
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2003
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $2000
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1997
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1994
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 51
+byte 1 48
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1991
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1988
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 98
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1985
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1982
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1979
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1976
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1973
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1970
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1967
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1964
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1961
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1958
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1955
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1947
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1944
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1941
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1938
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 111
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1935
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1932
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1929
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1926
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1923
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1920
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 50
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1917
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 49
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1914
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 117
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1911
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 53
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1908
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 49
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1905
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 0
+align 1
+LABELV $1904
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 95
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1900
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 95
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $1895
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1889
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1872
+byte 1 32
+byte 1 0
+align 1
+LABELV $1838
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1825
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1811
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1807
+byte 1 94
+byte 1 51
+byte 1 40
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 41
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $1802
+byte 1 94
+byte 1 51
+byte 1 40
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 41
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $1758
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1754
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 0
+align 1
+LABELV $1530
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1527
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 46
+byte 1 116
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $1516
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 10
+byte 1 0
+align 1
+LABELV $1513
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 0
+align 1
+LABELV $1508
+byte 1 112
+byte 1 108
+byte 1 0
+align 1
+LABELV $1503
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1498
+byte 1 99
+byte 1 103
+byte 1 0
+align 1
+LABELV $1493
+byte 1 103
+byte 1 104
+byte 1 0
+align 1
+LABELV $1488
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $1483
+byte 1 112
+byte 1 103
+byte 1 0
+align 1
+LABELV $1478
+byte 1 114
+byte 1 103
+byte 1 0
+align 1
+LABELV $1473
+byte 1 108
+byte 1 103
+byte 1 0
+align 1
+LABELV $1468
+byte 1 114
+byte 1 108
+byte 1 0
+align 1
+LABELV $1463
+byte 1 103
+byte 1 108
+byte 1 0
+align 1
+LABELV $1458
+byte 1 115
+byte 1 103
+byte 1 0
+align 1
+LABELV $1453
+byte 1 109
+byte 1 103
+byte 1 0
+align 1
+LABELV $1448
+byte 1 103
+byte 1 0
+align 1
+LABELV $1444
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1349
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1320
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1314
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1313
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1312
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1311
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $1310
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 81
+byte 1 76
+byte 1 0
+align 1
+LABELV $1309
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $1308
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1307
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1306
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 71
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $1305
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 0
+align 1
+LABELV $1304
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $1303
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1302
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 82
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1301
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 77
+byte 1 105
+byte 1 100
+byte 1 65
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $1300
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 82
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1299
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1298
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 65
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1297
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1296
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1295
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 69
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1294
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1293
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1292
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 76
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $1291
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1290
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 66
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1289
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 118
+byte 1 115
+byte 1 0
+align 1
+LABELV $1288
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1287
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1286
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1285
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 72
+byte 1 105
+byte 1 116
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1284
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1283
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1282
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 105
+byte 1 109
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $1281
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 81
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1280
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1279
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1278
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1277
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $1276
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $1275
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1274
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1273
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1272
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1271
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1270
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1269
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 69
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1268
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1267
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $1266
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1265
+byte 1 51
+byte 1 54
+byte 1 53
+byte 1 0
+align 1
+LABELV $1264
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 89
+byte 1 0
+align 1
+LABELV $1263
+byte 1 50
+byte 1 53
+byte 1 56
+byte 1 0
+align 1
+LABELV $1262
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 88
+byte 1 0
+align 1
+LABELV $1261
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $1260
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1259
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1258
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1257
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1256
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1255
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1254
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1253
+byte 1 51
+byte 1 50
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $1252
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1251
+byte 1 49
+byte 1 54
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $1250
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1249
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1248
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1247
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 84
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1246
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1245
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1244
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1243
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1242
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1241
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 0
+align 1
+LABELV $1240
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1239
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1238
+byte 1 53
+byte 1 55
+byte 1 0
+align 1
+LABELV $1237
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1236
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1235
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1234
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1233
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1232
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1231
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1230
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $1229
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1228
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1227
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1226
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 83
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1225
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 77
+byte 1 105
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 83
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1224
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $1223
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1222
+byte 1 48
+byte 1 120
+byte 1 102
+byte 1 101
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $1221
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1220
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1219
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $1218
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1217
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1216
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $1215
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 89
+byte 1 0
+align 1
+LABELV $1214
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 88
+byte 1 0
+align 1
+LABELV $1213
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1212
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1211
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 99
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 48
+byte 1 53
+byte 1 0
+align 1
+LABELV $1210
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1209
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 65
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $1208
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1207
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 72
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1206
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $1205
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1204
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1203
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 65
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $1202
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1201
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1200
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1199
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1198
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1197
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1196
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 80
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1195
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1194
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 79
+byte 1 119
+byte 1 110
+byte 1 67
+byte 1 111
+byte 1 114
+byte 1 112
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1193
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1192
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $1191
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 73
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $1190
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1189
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1188
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1187
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1186
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1185
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1184
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1183
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $1182
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $1181
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $1180
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 70
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1179
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 68
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 80
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1178
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 66
+byte 1 101
+byte 1 122
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1177
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1176
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1175
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1174
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 81
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1173
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1172
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 110
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1171
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1170
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $1169
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1168
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 80
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 84
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 0
+align 1
+LABELV $1167
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 76
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1166
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $1165
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1164
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1163
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1162
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1161
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1160
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1159
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1158
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 73
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1157
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $1156
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $1155
+byte 1 49
+byte 1 53
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $1154
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1153
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1152
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 120
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1151
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 120
+byte 1 68
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1150
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 120
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 70
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $1149
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 120
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1148
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $1147
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 120
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $1146
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 120
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 69
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1145
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $1144
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 120
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 0
+align 1
+LABELV $1143
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $1142
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 120
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1141
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 120
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1140
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1139
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 121
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1138
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1137
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1136
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 78
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1135
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 72
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $1134
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $1133
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1132
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1131
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1130
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1129
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1128
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1127
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1126
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1125
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 121
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1124
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1123
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1122
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 78
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1121
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 72
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $1120
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $1119
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1118
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1117
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1116
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1115
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1114
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1113
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1112
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1111
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 121
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1110
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1109
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1108
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 78
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1107
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 72
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $1106
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $1105
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1104
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1103
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1102
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1101
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1100
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1099
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1098
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1097
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 78
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1096
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1095
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $1094
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $1093
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1092
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1091
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 68
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1090
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1089
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1088
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1087
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $1086
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1085
+byte 1 48
+byte 1 120
+byte 1 102
+byte 1 102
+byte 1 53
+byte 1 97
+byte 1 53
+byte 1 97
+byte 1 0
+align 1
+LABELV $1084
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1083
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1082
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1081
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $1080
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1079
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1078
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $1077
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 89
+byte 1 0
+align 1
+LABELV $1076
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 88
+byte 1 0
+align 1
+LABELV $1075
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $1074
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 80
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1073
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 84
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1072
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1071
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1070
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1069
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1068
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $1067
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $1066
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1065
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 82
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1064
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1063
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1062
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1061
+byte 1 49
+byte 1 57
+byte 1 50
+byte 1 0
+align 1
+LABELV $1060
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $1059
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 79
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $1058
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $1057
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1056
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1055
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 69
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1054
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1053
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 69
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 100
+byte 1 101
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1052
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1051
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1050
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1049
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $1048
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1047
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1046
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 89
+byte 1 0
+align 1
+LABELV $1045
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1044
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 70
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1043
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1042
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1041
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1040
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1039
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1038
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1037
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1036
+byte 1 37
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 118
+byte 1 0
+align 1
+LABELV $1035
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1034
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $1033
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 0
+align 1
+LABELV $1032
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1031
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 118
+byte 1 44
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1030
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1029
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 118
+byte 1 0
+align 1
+LABELV $1028
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1027
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 118
+byte 1 0
+align 1
+LABELV $1026
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 84
+byte 1 104
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1025
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 118
+byte 1 44
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1024
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1023
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 118
+byte 1 0
+align 1
+LABELV $1022
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1021
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1020
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1019
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1018
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1017
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1016
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1015
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $1014
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1013
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1012
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $1011
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 89
+byte 1 0
+align 1
+LABELV $1010
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 88
+byte 1 0
+align 1
+LABELV $1009
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 83
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1008
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 107
+byte 1 97
+byte 1 95
+byte 1 114
+byte 1 116
+byte 1 99
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1007
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1006
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1005
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1004
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1003
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1002
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $1001
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1000
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $999
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $998
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 89
+byte 1 0
+align 1
+LABELV $997
+byte 1 52
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $996
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 88
+byte 1 0
+align 1
+LABELV $995
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 80
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $994
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 80
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $993
+byte 1 51
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $992
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 80
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 89
+byte 1 0
+align 1
+LABELV $991
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 80
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 88
+byte 1 0
+align 1
+LABELV $990
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 80
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $989
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $988
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $987
+byte 1 48
+byte 1 120
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $986
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $985
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $984
+byte 1 48
+byte 1 120
+byte 1 55
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $983
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 95
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $982
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 95
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $981
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $980
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $979
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $978
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $977
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $976
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $975
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $974
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $973
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $972
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $971
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $970
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $969
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $968
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $967
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $966
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $965
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $964
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $963
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $962
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $961
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $960
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $959
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $958
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $957
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $956
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 48
+byte 1 49
+byte 1 48
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $955
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 66
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $954
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $953
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $952
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $951
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $950
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $949
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $948
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $947
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $946
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $945
+byte 1 48
+byte 1 120
+byte 1 102
+byte 1 54
+byte 1 102
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $944
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $943
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $942
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $941
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $940
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 78
+byte 1 117
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $939
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 82
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $938
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $937
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $936
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $935
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $934
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $933
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $932
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $931
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $930
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $929
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $928
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $927
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $926
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $925
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $924
+byte 1 48
+byte 1 120
+byte 1 48
+byte 1 48
+byte 1 102
+byte 1 102
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $923
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $922
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $921
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $920
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 78
+byte 1 117
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $919
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 82
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $918
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $917
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $916
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $915
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $914
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $913
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $912
+byte 1 48
+byte 1 120
+byte 1 50
+byte 1 97
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $911
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $910
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $909
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $908
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $907
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $906
+byte 1 107
+byte 1 101
+byte 1 101
+byte 1 108
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $905
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $904
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 84
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $903
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 84
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $902
+byte 1 48
+byte 1 120
+byte 1 102
+byte 1 50
+byte 1 100
+byte 1 98
+byte 1 49
+byte 1 102
+byte 1 0
+align 1
+LABELV $901
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 78
+byte 1 111
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $900
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $899
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $898
+byte 1 48
+byte 1 120
+byte 1 51
+byte 1 50
+byte 1 54
+byte 1 54
+byte 1 102
+byte 1 52
+byte 1 0
+align 1
+LABELV $897
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $896
+byte 1 48
+byte 1 120
+byte 1 102
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $895
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $894
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 66
+byte 1 66
+byte 1 111
+byte 1 120
+byte 1 0
+align 1
+LABELV $893
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $892
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 86
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $891
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 69
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $890
+byte 1 48
+byte 1 120
+byte 1 97
+byte 1 102
+byte 1 49
+byte 1 102
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $889
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 69
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $888
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 69
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $887
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $886
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $885
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $884
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $883
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 73
+byte 1 110
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 100
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $882
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 73
+byte 1 110
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 100
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 66
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $881
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 0
+align 1
+LABELV $880
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $879
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $878
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $877
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $876
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $875
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $874
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $873
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $872
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $871
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $870
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $869
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $868
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $867
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $866
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $865
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 89
+byte 1 0
+align 1
+LABELV $864
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 88
+byte 1 0
+align 1
+LABELV $863
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $862
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $861
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $860
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $859
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $858
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $857
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $856
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $855
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $854
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 89
+byte 1 0
+align 1
+LABELV $853
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 88
+byte 1 0
+align 1
+LABELV $852
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $851
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $850
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $849
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $848
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $847
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $846
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $845
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $844
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $843
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 89
+byte 1 0
+align 1
+LABELV $842
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 88
+byte 1 0
+align 1
+LABELV $841
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $840
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $839
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $838
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $837
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $836
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $835
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $834
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $833
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $832
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 89
+byte 1 0
+align 1
+LABELV $831
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 88
+byte 1 0
+align 1
+LABELV $830
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $829
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $828
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $827
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $826
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $825
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $824
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $823
+byte 1 48
+byte 1 46
+byte 1 51
+byte 1 53
+byte 1 0
+align 1
+LABELV $822
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $821
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $820
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $819
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $818
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $817
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 89
+byte 1 0
+align 1
+LABELV $816
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 88
+byte 1 0
+align 1
+LABELV $815
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $814
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 111
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $813
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 111
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $812
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $811
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 111
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $810
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 111
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $809
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $808
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $807
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $806
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $805
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $804
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 72
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $803
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $802
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $801
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $800
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 80
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $799
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 86
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $798
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $797
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $796
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $795
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $794
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $793
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $792
+byte 1 48
+byte 1 46
+byte 1 49
+byte 1 0
+align 1
+LABELV $791
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $790
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $789
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 115
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 90
+byte 1 0
+align 1
+LABELV $788
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 115
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $787
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 115
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 115
+byte 1 90
+byte 1 0
+align 1
+LABELV $786
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 115
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $785
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $784
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 115
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 90
+byte 1 0
+align 1
+LABELV $783
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 115
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $782
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $781
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $780
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $779
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $778
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $777
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $776
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 79
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $775
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $774
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 65
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $773
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 87
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $772
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $771
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $770
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $769
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $768
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $767
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $766
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 89
+byte 1 0
+align 1
+LABELV $765
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 88
+byte 1 0
+align 1
+LABELV $764
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $763
+byte 1 57
+byte 1 0
+align 1
+LABELV $762
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 84
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $761
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $760
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 113
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $759
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 113
+byte 1 108
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 0
+align 1
+LABELV $758
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 81
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $757
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 118
+byte 1 100
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $756
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 118
+byte 1 100
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $755
+byte 1 48
+byte 1 120
+byte 1 48
+byte 1 48
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $754
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 118
+byte 1 100
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $753
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 118
+byte 1 100
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $752
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 118
+byte 1 100
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $751
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 118
+byte 1 100
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $750
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 118
+byte 1 100
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $749
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 118
+byte 1 100
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $748
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 118
+byte 1 100
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 89
+byte 1 0
+align 1
+LABELV $747
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 118
+byte 1 100
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 88
+byte 1 0
+align 1
+LABELV $746
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 118
+byte 1 100
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $745
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $744
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $743
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $742
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $741
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $740
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $739
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $738
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $737
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 89
+byte 1 0
+align 1
+LABELV $736
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 88
+byte 1 0
+align 1
+LABELV $735
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $734
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $733
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $732
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $731
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $730
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $729
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $728
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $727
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $726
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $725
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $724
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $723
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $722
+byte 1 48
+byte 1 46
+byte 1 53
+byte 1 0
+align 1
+LABELV $721
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 73
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $720
+byte 1 51
+byte 1 54
+byte 1 48
+byte 1 0
+align 1
+LABELV $719
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 89
+byte 1 0
+align 1
+LABELV $718
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 88
+byte 1 0
+align 1
+LABELV $717
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $716
+byte 1 53
+byte 1 50
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $715
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 65
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $714
+byte 1 55
+byte 1 48
+byte 1 53
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $713
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 65
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $712
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 65
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $711
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 65
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $710
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 65
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $709
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 65
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $708
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $707
+byte 1 57
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $706
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $705
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $704
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $703
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $702
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 76
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $701
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $700
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $699
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $698
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $697
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $696
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $695
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $694
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $693
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $692
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 89
+byte 1 0
+align 1
+LABELV $691
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 88
+byte 1 0
+align 1
+LABELV $690
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $689
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $688
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $687
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $686
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $685
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $684
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $683
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $682
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $681
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $680
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 78
+byte 1 111
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $679
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 89
+byte 1 0
+align 1
+LABELV $678
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 88
+byte 1 0
+align 1
+LABELV $677
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $676
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $675
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $674
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $673
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $672
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 84
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $671
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $670
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $669
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 82
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $668
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 82
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $667
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 68
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $666
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 82
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 100
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $665
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 66
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $664
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 82
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $663
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 82
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 0
+align 1
+LABELV $662
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 82
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 82
+byte 1 76
+byte 1 0
+align 1
+LABELV $661
+byte 1 49
+byte 1 54
+byte 1 0
+align 1
+LABELV $660
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 82
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $659
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 82
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 0
+align 1
+LABELV $658
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 82
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 83
+byte 1 71
+byte 1 0
+align 1
+LABELV $657
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $656
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $655
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $654
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $653
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $652
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $651
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $650
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $649
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $648
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $647
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $646
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $645
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $644
+byte 1 49
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $643
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 66
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $642
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $641
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 84
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $640
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $639
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 32
+byte 1 109
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 103
+byte 1 32
+byte 1 103
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 103
+byte 1 32
+byte 1 114
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 32
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 32
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 0
+align 1
+LABELV $638
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $637
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $636
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $635
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $634
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $633
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $632
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $631
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $630
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $629
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $628
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $627
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $626
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 66
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $625
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 68
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $624
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $623
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $622
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $621
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $620
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $619
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $618
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $617
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $616
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $615
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $614
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $613
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $612
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $611
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $610
+byte 1 49
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $609
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 72
+byte 1 105
+byte 1 116
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $608
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $607
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $606
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $605
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $604
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $603
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $602
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $601
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $600
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 101
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $599
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 111
+byte 1 101
+byte 1 0
+align 1
+LABELV $598
+byte 1 50
+byte 1 52
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $597
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $596
+byte 1 52
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $595
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $594
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $593
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $592
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $591
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $590
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $589
+byte 1 48
+byte 1 120
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 57
+byte 1 57
+byte 1 0
+align 1
+LABELV $588
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $587
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $586
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $585
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $584
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $583
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $582
+byte 1 52
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $581
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 89
+byte 1 0
+align 1
+LABELV $580
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 88
+byte 1 0
+align 1
+LABELV $579
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 78
+byte 1 111
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $578
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $577
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $576
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $575
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $574
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $573
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $572
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $571
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $570
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $569
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 89
+byte 1 0
+align 1
+LABELV $568
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 88
+byte 1 0
+align 1
+LABELV $567
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 78
+byte 1 111
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $566
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $565
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $564
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $563
+byte 1 48
+byte 1 120
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $562
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $561
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $560
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $559
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $558
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $557
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $556
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $555
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 89
+byte 1 0
+align 1
+LABELV $554
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 88
+byte 1 0
+align 1
+LABELV $553
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $552
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 0
+align 1
+LABELV $551
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 78
+byte 1 111
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $550
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $549
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 79
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $548
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $547
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $546
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $545
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $544
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 0
+align 1
+LABELV $543
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $542
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $541
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $540
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $539
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $538
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 89
+byte 1 0
+align 1
+LABELV $537
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 88
+byte 1 0
+align 1
+LABELV $536
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $535
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $534
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $533
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 80
+byte 1 111
+byte 1 118
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 73
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $532
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 80
+byte 1 111
+byte 1 118
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $531
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $530
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $529
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $528
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $527
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $526
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $525
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $524
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $523
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $522
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $521
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $520
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $519
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $518
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $517
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $516
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $515
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $514
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $513
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $512
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $511
+byte 1 48
+byte 1 46
+byte 1 51
+byte 1 0
+align 1
+LABELV $510
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $509
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $508
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $507
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $506
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $505
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $504
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 90
+byte 1 0
+align 1
+LABELV $503
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 89
+byte 1 0
+align 1
+LABELV $502
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 88
+byte 1 0
+align 1
+LABELV $501
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 77
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $500
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 79
+byte 1 119
+byte 1 110
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $499
+byte 1 48
+byte 1 120
+byte 1 100
+byte 1 52
+byte 1 97
+byte 1 102
+byte 1 51
+byte 1 55
+byte 1 0
+align 1
+LABELV $498
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $497
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $496
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 82
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $495
+byte 1 52
+byte 1 0
+align 1
+LABELV $494
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 82
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $493
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 82
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $492
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 78
+byte 1 117
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $491
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 53
+byte 1 0
+align 1
+LABELV $490
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 81
+byte 1 76
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 82
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 87
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $489
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 81
+byte 1 76
+byte 1 0
+align 1
+LABELV $488
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $487
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $486
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $485
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $484
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $483
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $482
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $481
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $480
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $479
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $478
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $477
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $476
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $475
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $474
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $473
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $472
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $471
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $470
+byte 1 51
+byte 1 51
+byte 1 54
+byte 1 0
+align 1
+LABELV $469
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 89
+byte 1 0
+align 1
+LABELV $468
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 88
+byte 1 0
+align 1
+LABELV $467
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $466
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $465
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $464
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $463
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $462
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $461
+byte 1 55
+byte 1 0
+align 1
+LABELV $460
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 70
+byte 1 120
+byte 1 0
+align 1
+LABELV $459
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 87
+byte 1 104
+byte 1 0
+align 1
+LABELV $458
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $457
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 66
+byte 1 111
+byte 1 98
+byte 1 0
+align 1
+LABELV $456
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $455
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $454
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $453
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $452
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 65
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $451
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $450
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 66
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $449
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 89
+byte 1 0
+align 1
+LABELV $448
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 88
+byte 1 0
+align 1
+LABELV $447
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 72
+byte 1 105
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $446
+byte 1 48
+byte 1 120
+byte 1 102
+byte 1 102
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $445
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 72
+byte 1 105
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $444
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 72
+byte 1 105
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $443
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $442
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 80
+byte 1 117
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $441
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $440
+byte 1 51
+byte 1 50
+byte 1 0
+align 1
+LABELV $439
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $438
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $437
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $436
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $435
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $434
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $433
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $432
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $431
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $430
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 73
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $429
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $428
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $427
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $426
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $425
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $424
+byte 1 53
+byte 1 54
+byte 1 0
+align 1
+LABELV $423
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 89
+byte 1 0
+align 1
+LABELV $422
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 88
+byte 1 0
+align 1
+LABELV $421
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 0
+align 1
+LABELV $420
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $419
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $418
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $417
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $416
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $415
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $414
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $413
+byte 1 48
+byte 1 46
+byte 1 49
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $412
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $411
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $410
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $409
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $408
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $407
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $406
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 89
+byte 1 0
+align 1
+LABELV $405
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 88
+byte 1 0
+align 1
+LABELV $404
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $403
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $402
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $401
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $400
+byte 1 55
+byte 1 55
+byte 1 0
+align 1
+LABELV $399
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $398
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $397
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $396
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $395
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $394
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $393
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $392
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $391
+byte 1 49
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $390
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 89
+byte 1 0
+align 1
+LABELV $389
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 88
+byte 1 0
+align 1
+LABELV $388
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $387
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $386
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $385
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $384
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $383
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $382
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $381
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $380
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $379
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $378
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $377
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $376
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $375
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $374
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $373
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 89
+byte 1 0
+align 1
+LABELV $372
+byte 1 54
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $371
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 88
+byte 1 0
+align 1
+LABELV $370
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $369
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $368
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $367
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 78
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $366
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 72
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $365
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $364
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $363
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $362
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $361
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $360
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $359
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $358
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $357
+byte 1 53
+byte 1 0
+align 1
+LABELV $356
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $355
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $354
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $353
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $352
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $351
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $350
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $349
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $348
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $347
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $346
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $345
+byte 1 113
+byte 1 108
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $344
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $343
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $342
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $341
+byte 1 54
+byte 1 52
+byte 1 0
+align 1
+LABELV $340
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 89
+byte 1 0
+align 1
+LABELV $339
+byte 1 51
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $338
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 88
+byte 1 0
+align 1
+LABELV $337
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $336
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $335
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 51
+byte 1 100
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $334
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $333
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $332
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $331
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $330
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $329
+byte 1 113
+byte 1 51
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 0
+align 1
+LABELV $328
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $327
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $326
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $325
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 89
+byte 1 0
+align 1
+LABELV $324
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 88
+byte 1 0
+align 1
+LABELV $323
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $322
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $321
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $320
+byte 1 48
+byte 1 120
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $319
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $318
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $317
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $316
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $315
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 45
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $314
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $313
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $312
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $311
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 89
+byte 1 0
+align 1
+LABELV $310
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 88
+byte 1 0
+align 1
+LABELV $309
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 78
+byte 1 111
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $308
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $307
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $306
+byte 1 56
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $305
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $304
+byte 1 49
+byte 1 46
+byte 1 51
+byte 1 0
+align 1
+LABELV $303
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $302
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $301
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $300
+byte 1 51
+byte 1 0
+align 1
+LABELV $299
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $298
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 89
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $297
+byte 1 45
+byte 1 53
+byte 1 53
+byte 1 0
+align 1
+LABELV $296
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 88
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $295
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $294
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $293
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $292
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $291
+byte 1 50
+byte 1 0
+align 1
+LABELV $290
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $289
+byte 1 54
+byte 1 0
+align 1
+LABELV $288
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $287
+byte 1 50
+byte 1 53
+byte 1 53
+byte 1 0
+align 1
+LABELV $286
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $285
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $284
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $283
+byte 1 113
+byte 1 51
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $282
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $281
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $280
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $279
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 89
+byte 1 0
+align 1
+LABELV $278
+byte 1 54
+byte 1 51
+byte 1 53
+byte 1 0
+align 1
+LABELV $277
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 88
+byte 1 0
+align 1
+LABELV $276
+byte 1 114
+byte 1 109
+byte 1 121
+byte 1 103
+byte 1 113
+byte 1 98
+byte 1 0
+align 1
+LABELV $275
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $274
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $273
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $272
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $271
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $270
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 50
+byte 1 68
+byte 1 0
+align 1
+LABELV $269
+byte 1 50
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $268
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $267
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $266
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $265
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $264
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $263
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $262
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 0
+align 1
+LABELV $261
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $260
+byte 1 56
+byte 1 0
+align 1
+LABELV $259
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $258
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 76
+byte 1 105
+byte 1 102
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $257
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $256
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 90
+byte 1 0
+align 1
+LABELV $255
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $254
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $253
+byte 1 55
+byte 1 53
+byte 1 0
+align 1
+LABELV $252
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $251
+byte 1 49
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $250
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $249
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $248
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $247
+byte 1 51
+byte 1 46
+byte 1 53
+byte 1 0
+align 1
+LABELV $246
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $245
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $244
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $243
+byte 1 48
+byte 1 46
+byte 1 54
+byte 1 0
+align 1
+LABELV $242
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 66
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $241
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $240
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 83
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $239
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $238
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $237
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 90
+byte 1 0
+align 1
+LABELV $236
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $235
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 90
+byte 1 0
+align 1
+LABELV $234
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $233
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $232
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 68
+byte 1 105
+byte 1 114
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $231
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $230
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $229
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $228
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $227
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $226
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $225
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $224
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 0
+align 1
+LABELV $223
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $222
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 119
+byte 1 71
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 0
+align 1
+LABELV $221
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 0
+align 1
+LABELV $220
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 0
+align 1
+LABELV $219
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 111
+byte 1 83
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $218
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $217
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $216
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $215
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $214
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 65
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $213
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 65
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $212
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $211
+byte 1 0
+align 1
+LABELV $210
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 121
+byte 1 0
+align 1
+LABELV $209
+byte 1 49
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $208
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $207
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 66
+byte 1 114
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $206
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 73
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $205
+byte 1 49
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $204
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $203
+byte 1 54
+byte 1 48
+byte 1 0
+align 1
+LABELV $202
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $201
+byte 1 49
+byte 1 0
+align 1
+LABELV $200
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $199
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $198
+byte 1 48
+byte 1 0
+align 1
+LABELV $197
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $194
+byte 1 118
+byte 1 109
+byte 1 77
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $175
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $174
+byte 1 104
+byte 1 109
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $173
+byte 1 50
+byte 1 118
+byte 1 50
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $172
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $171
+byte 1 114
+byte 1 114
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $170
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $169
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $168
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $167
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $166
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $165
+byte 1 49
+byte 1 102
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $164
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $163
+byte 1 99
+byte 1 97
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $162
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $161
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $160
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $159
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
@@ -0,0 +1,61454 @@
+export CG_InitTeamChat
+code
+proc CG_InitTeamChat 0 12
+ADDRGP4 teamChat1
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 teamChat2
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 systemChat
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $152
+endproc CG_InitTeamChat 0 12
+export CG_SetPrintString
+proc CG_SetPrintString 0 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $154
+ADDRGP4 systemChat
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $155
+JUMPV
+LABELV $154
+ADDRGP4 teamChat2
+ARGP4
+ADDRGP4 teamChat1
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 teamChat1
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $155
+LABELV $153
+endproc CG_SetPrintString 0 8
+export CG_CheckOrderPending
+proc CG_CheckOrderPending 28 12
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $157
+ADDRGP4 $156
+JUMPV
+LABELV $157
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+LTI4 $163
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $159
+LABELV $163
+ADDRGP4 $156
+JUMPV
+LABELV $159
+ADDRGP4 cgs+632840
+INDIRI4
+CNSTI4 0
+EQI4 $164
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cgs+632836
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $167
+ADDRLP4 16
+INDIRI4
+CNSTI4 7
+GTI4 $167
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $195-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $195
+address $170
+address $174
+address $178
+address $182
+address $189
+address $192
+address $186
+code
+LABELV $170
+ADDRLP4 8
+ADDRGP4 $171
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $172
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $173
+ASGNP4
+ADDRGP4 $168
+JUMPV
+LABELV $174
+ADDRLP4 8
+ADDRGP4 $175
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $176
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $177
+ASGNP4
+ADDRGP4 $168
+JUMPV
+LABELV $178
+ADDRLP4 8
+ADDRGP4 $179
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $180
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $181
+ASGNP4
+ADDRGP4 $168
+JUMPV
+LABELV $182
+ADDRLP4 8
+ADDRGP4 $183
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $184
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $185
+ASGNP4
+ADDRGP4 $168
+JUMPV
+LABELV $186
+ADDRLP4 8
+ADDRGP4 $187
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $188
+ASGNP4
+ADDRGP4 $168
+JUMPV
+LABELV $189
+ADDRLP4 8
+ADDRGP4 $190
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $191
+ASGNP4
+ADDRGP4 $168
+JUMPV
+LABELV $192
+ADDRLP4 8
+ADDRGP4 $193
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $194
+ASGNP4
+LABELV $167
+LABELV $168
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+NEI4 $197
+ADDRGP4 $200
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 0
+LTI4 $205
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+LEI4 $201
+LABELV $205
+ADDRGP4 $206
+ARGP4
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $202
+JUMPV
+LABELV $201
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $208
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $208
+ADDRGP4 $212
+ARGP4
+ADDRGP4 cgs+632836
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $200
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $214
+ADDRGP4 $216
+ARGP4
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $214
+LABELV $209
+LABELV $202
+LABELV $198
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $218
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $218
+ADDRGP4 cgs+632840
+CNSTI4 0
+ASGNI4
+LABELV $164
+LABELV $156
+endproc CG_CheckOrderPending 28 12
+proc CG_SetSelectedPlayerName 8 8
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 0
+LTI4 $222
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+GEI4 $222
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $223
+ADDRGP4 $230
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $231
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cgs+632836
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRGP4 $230
+ARGP4
+ADDRGP4 $235
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $223
+LABELV $221
+endproc CG_SetSelectedPlayerName 8 8
+proc CG_GetSelectedPlayer 0 0
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 0
+LTI4 $241
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+LTI4 $237
+LABELV $241
+ADDRGP4 cg_currentSelectedPlayer+12
+CNSTI4 0
+ASGNI4
+LABELV $237
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+RETI4
+LABELV $236
+endproc CG_GetSelectedPlayer 0 0
+export CG_SelectNextPlayer
+proc CG_SelectNextPlayer 4 0
+ADDRGP4 CG_CheckOrderPending
+CALLV
+pop
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 0
+LTI4 $245
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+GEI4 $245
+ADDRLP4 0
+ADDRGP4 cg_currentSelectedPlayer+12
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $246
+JUMPV
+LABELV $245
+ADDRGP4 cg_currentSelectedPlayer+12
+CNSTI4 0
+ASGNI4
+LABELV $246
+ADDRGP4 CG_SetSelectedPlayerName
+CALLV
+pop
+LABELV $244
+endproc CG_SelectNextPlayer 4 0
+export CG_SelectPrevPlayer
+proc CG_SelectPrevPlayer 4 0
+ADDRGP4 CG_CheckOrderPending
+CALLV
+pop
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 0
+LEI4 $252
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+GEI4 $252
+ADDRLP4 0
+ADDRGP4 cg_currentSelectedPlayer+12
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+LABELV $253
+ADDRGP4 CG_SetSelectedPlayerName
+CALLV
+pop
+LABELV $251
+endproc CG_SelectPrevPlayer 4 0
+proc CG_DrawPlayerArmorIcon 36 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $259
+ADDRGP4 $258
+JUMPV
+LABELV $259
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $266
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $262
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $262
+LABELV $266
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+312
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $269
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 360
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+308
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $269
+LABELV $263
+LABELV $258
+endproc CG_DrawPlayerArmorIcon 36 32
+proc CG_DrawPlayerArmorValue 48 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $281
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 Wolfcam_PlayerArmor
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+GEI4 $282
+ADDRGP4 $280
+JUMPV
+LABELV $281
+ADDRLP4 36
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRGP4 STAT_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $282
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $287
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRLP4 16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 16
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+CNSTF4 1094713344
+ADDRFP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $288
+LABELV $280
+endproc CG_DrawPlayerArmorValue 48 36
+proc CG_DrawPlayerAmmoIcon 52 32
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $295
+ADDRLP4 0
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRLP4 0
+ADDRGP4 cg+607196+144
+INDIRI4
+ASGNI4
+LABELV $296
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $305
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $301
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $301
+LABELV $305
+ADDRLP4 32
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $302
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $309
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $312
+CNSTI4 132
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $312
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1116471296
+ASGNF4
+ADDRLP4 16+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1101004800
+ADDRLP4 44
+INDIRF4
+MULF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $312
+LABELV $309
+LABELV $302
+LABELV $294
+endproc CG_DrawPlayerAmmoIcon 52 32
+proc CG_DrawPlayerAmmoValue 56 36
+ADDRLP4 40
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $323
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $324
+ADDRGP4 $322
+JUMPV
+LABELV $323
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $327
+ADDRGP4 $322
+JUMPV
+LABELV $327
+LABELV $324
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRLP4 0
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $330
+JUMPV
+LABELV $329
+ADDRLP4 0
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $330
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $335
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+GEI4 $335
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $335
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $337
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRLP4 48
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $338
+ADDRLP4 20
+ADDRGP4 wcg+4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTU4 255
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $338
+ADDRLP4 20
+INDIRI4
+CNSTI4 -1
+LEI4 $344
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $346
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $345
+JUMPV
+LABELV $346
+ADDRLP4 24
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1094713344
+ADDRFP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+ARGF4
+ADDRLP4 52
+CNSTF4 1102053376
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+1317348
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $345
+LABELV $335
+LABELV $322
+endproc CG_DrawPlayerAmmoValue 56 36
+proc CG_DrawPlayerHead 76 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $355
+ADDRGP4 $354
+JUMPV
+LABELV $355
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $358
+ADDRLP4 20
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRLP4 20
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+LABELV $359
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $364
+ADDRGP4 cg+627432
+INDIRF4
+CNSTF4 0
+EQF4 $364
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+627432
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+GEF4 $364
+ADDRLP4 0
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+627432
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1067450368
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 48
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 32
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+MULF4
+CNSTF4 1069547520
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg+627436
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+627468
+CNSTF4 1110704128
+ADDRGP4 cg+627436
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+627456
+CNSTF4 1101004800
+ADDRLP4 60
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+627452
+CNSTF4 1084227584
+ADDRLP4 68
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+627472
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+627460
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $365
+JUMPV
+LABELV $364
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+627460
+INDIRI4
+LTI4 $380
+ADDRGP4 cg+627468
+ADDRGP4 cg+627456
+INDIRF4
+ASGNF4
+ADDRGP4 cg+627464
+ADDRGP4 cg+627452
+INDIRF4
+ASGNF4
+ADDRGP4 cg+627472
+ADDRGP4 cg+627460
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+627460
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+627456
+CNSTF4 1101004800
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+627452
+CNSTF4 1084227584
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+LABELV $380
+LABELV $365
+ADDRGP4 cg+627472
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LEI4 $394
+ADDRGP4 cg+627472
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $394
+ADDRLP4 0
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+627472
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+627460
+INDIRI4
+ADDRGP4 cg+627472
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRGP4 cg+627468
+INDIRF4
+ADDRGP4 cg+627456
+INDIRF4
+ADDRGP4 cg+627468
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+627464
+INDIRF4
+ADDRGP4 cg+627452
+INDIRF4
+ADDRGP4 cg+627464
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+LABELV $354
+endproc CG_DrawPlayerHead 76 28
+proc CG_DrawSelectedPlayerHealth 36 36
+ADDRLP4 24
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 4524
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $413
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $415
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $416
+LABELV $413
+LABELV $411
+endproc CG_DrawSelectedPlayerHealth 36 36
+proc CG_DrawSelectedPlayerArmor 36 36
+ADDRLP4 24
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 4524
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $419
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $421
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $423
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $424
+JUMPV
+LABELV $423
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $424
+LABELV $421
+LABELV $419
+LABELV $417
+endproc CG_DrawSelectedPlayerArmor 36 36
+proc CG_StatusHandle 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $426
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+GTI4 $426
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $451-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $451
+address $428
+address $431
+address $434
+address $437
+address $443
+address $446
+address $440
+code
+LABELV $428
+ADDRLP4 0
+ADDRGP4 cgs+632912+493476
+INDIRI4
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $431
+ADDRLP4 0
+ADDRGP4 cgs+632912+493488
+INDIRI4
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $434
+ADDRLP4 0
+ADDRGP4 cgs+632912+493472
+INDIRI4
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $437
+ADDRLP4 0
+ADDRGP4 cgs+632912+493484
+INDIRI4
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $440
+ADDRLP4 0
+ADDRGP4 cgs+632912+493480
+INDIRI4
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $443
+ADDRLP4 0
+ADDRGP4 cgs+632912+493496
+INDIRI4
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $446
+ADDRLP4 0
+ADDRGP4 cgs+632912+493500
+INDIRI4
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $426
+ADDRLP4 0
+ADDRGP4 cgs+632912+493476
+INDIRI4
+ASGNI4
+LABELV $427
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $425
+endproc CG_StatusHandle 8 0
+proc CG_DrawSelectedPlayerStatus 16 20
+ADDRLP4 4
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $455
+ADDRGP4 cgs+632840
+INDIRI4
+CNSTI4 0
+EQI4 $457
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+632844
+INDIRI4
+CNSTI4 2500
+SUBI4
+LEI4 $460
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $460
+ADDRGP4 $453
+JUMPV
+LABELV $460
+ADDRGP4 cgs+632836
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $458
+JUMPV
+LABELV $457
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $458
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $455
+LABELV $453
+endproc CG_DrawSelectedPlayerStatus 16 20
+proc CG_DrawPlayerStatus 16 20
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $469
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+LABELV $469
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $473
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $473
+LABELV $466
+endproc CG_DrawPlayerStatus 16 20
+proc CG_DrawSelectedPlayerName 24 36
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $479
+ADDRLP4 4
+ADDRGP4 cgs+632848
+INDIRI4
+ASGNI4
+ADDRGP4 $480
+JUMPV
+LABELV $479
+ADDRLP4 8
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $480
+ADDRLP4 0
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $481
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $483
+ADDRGP4 $485
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $484
+JUMPV
+LABELV $483
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $484
+LABELV $481
+LABELV $475
+endproc CG_DrawSelectedPlayerName 24 36
+proc CG_DrawSelectedPlayerLocation 24 36
+ADDRLP4 4
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $488
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 593
+ADDI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $492
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $490
+LABELV $492
+ADDRLP4 8
+ADDRGP4 $493
+ASGNP4
+LABELV $490
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $488
+LABELV $486
+endproc CG_DrawSelectedPlayerLocation 24 36
+proc CG_DrawPlayerLocation 20 36
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $497
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+LABELV $497
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $501
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 593
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $505
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $503
+LABELV $505
+ADDRLP4 4
+ADDRGP4 $493
+ASGNP4
+LABELV $503
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $501
+LABELV $494
+endproc CG_DrawPlayerLocation 20 36
+proc CG_DrawSelectedPlayerWeapon 12 20
+ADDRLP4 4
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $508
+CNSTI4 132
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $510
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 132
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+340
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $511
+LABELV $508
+LABELV $506
+endproc CG_DrawSelectedPlayerWeapon 12 20
+proc CG_DrawPlayerScore 20 36
+ADDRLP4 0
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $518
+ADDRLP4 4
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $521
+ADDRGP4 $519
+JUMPV
+LABELV $521
+ADDRLP4 8
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $525
+ADDRLP4 0
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $525
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $516
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $532
+ADDRGP4 $516
+JUMPV
+LABELV $532
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $537
+ADDRLP4 0
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $537
+ADDRLP4 0
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $519
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $544
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $545
+JUMPV
+LABELV $544
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $546
+ADDRLP4 0
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $553
+ADDRLP4 8
+INDIRI4
+CNSTI4 2147483647
+LTI4 $551
+LABELV $553
+ADDRGP4 $554
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $547
+JUMPV
+LABELV $551
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRGP4 $289
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $547
+LABELV $545
+LABELV $516
+endproc CG_DrawPlayerScore 20 36
+proc CG_DrawPlayerItem 92 36
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $557
+ADDRGP4 $556
+JUMPV
+LABELV $557
+ADDRLP4 0
+ADDRGP4 STAT_HOLDABLE_ITEM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 32
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $563
+ADDRLP4 32
+INDIRI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRGP4 PW_FLIGHT
+INDIRI4
+NEI4 $563
+ADDRLP4 60
+CNSTF4 1048576000
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 cgDC+236+12
+ASGNP4
+ADDRGP4 $571
+ARGP4
+CNSTF4 1120403456
+ADDRGP4 STAT_POWERUP_REMAINING
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1182400512
+DIVF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 36
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 36+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 36+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 84
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+DIVF4
+ADDF4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 84
+INDIRF4
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $563
+JUMPV
+LABELV $562
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 16+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 4+4
+CNSTI4 360
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $563
+LABELV $560
+LABELV $556
+endproc CG_DrawPlayerItem 92 36
+proc CG_DrawSelectedPlayerPowerup 40 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $585
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $587
+ADDRLP4 4
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $591
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $593
+ADDRLP4 24
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $583
+JUMPV
+LABELV $593
+LABELV $591
+LABELV $588
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $590
+ADDRLP4 0
+INDIRI4
+ADDRGP4 PW_NUM_POWERUPS
+INDIRI4
+LTI4 $587
+LABELV $585
+LABELV $583
+endproc CG_DrawSelectedPlayerPowerup 40 20
+proc CG_DrawSelectedPlayerHead 80 32
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $599
+ADDRLP4 60
+ADDRGP4 cgs+632848
+INDIRI4
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $599
+ADDRLP4 64
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $600
+ADDRLP4 0
+CNSTI4 4524
+ADDRLP4 60
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $601
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $603
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $606
+ADDRGP4 $595
+JUMPV
+LABELV $606
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1060320051
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 884
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 888
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 40+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 40+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 944
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $604
+JUMPV
+LABELV $603
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $622
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 972
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $622
+LABELV $604
+ADDRLP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $625
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+340
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $625
+LABELV $601
+LABELV $595
+endproc CG_DrawSelectedPlayerHead 80 32
+proc CG_DrawPlayerHealth 48 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $631
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 Wolfcam_PlayerHealth
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 -9999
+GTI4 $634
+ADDRGP4 $629
+JUMPV
+LABELV $634
+LABELV $631
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $636
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $637
+JUMPV
+LABELV $636
+ADDRLP4 24
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+CNSTF4 1094713344
+ADDRFP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $637
+LABELV $629
+endproc CG_DrawPlayerHealth 48 36
+proc CG_DrawRedScore 16 36
+ADDRGP4 cgs+43240
+INDIRI4
+CNSTI4 -9999
+NEI4 $643
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $554
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $644
+JUMPV
+LABELV $643
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $644
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $642
+endproc CG_DrawRedScore 16 36
+proc CG_DrawBlueScore 16 36
+ADDRGP4 cgs+43244
+INDIRI4
+CNSTI4 -9999
+NEI4 $648
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $554
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $649
+JUMPV
+LABELV $648
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $649
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $647
+endproc CG_DrawBlueScore 16 36
+proc CG_DrawRedName 0 36
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg_redTeamName+16
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $652
+endproc CG_DrawRedName 0 36
+proc CG_DrawBlueName 0 36
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg_blueTeamName+16
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $654
+endproc CG_DrawBlueName 0 36
+proc CG_DrawBlueFlagName 20 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $660
+JUMPV
+LABELV $657
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $662
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $662
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+51512+268
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $662
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $656
+JUMPV
+LABELV $662
+LABELV $658
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $660
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+39728
+INDIRI4
+LTI4 $657
+LABELV $656
+endproc CG_DrawBlueFlagName 20 36
+lit
+align 4
+LABELV $680
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $687
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_DrawBlueFlagStatus 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $672
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $672
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $672
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $671
+ADDRLP4 0
+ADDRGP4 $680
+INDIRB
+ASGNB 16
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+28
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $671
+JUMPV
+LABELV $672
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $683
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $684
+JUMPV
+LABELV $683
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $685
+ADDRLP4 8
+ADDRGP4 $687
+INDIRB
+ASGNB 16
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+43252
+INDIRI4
+CNSTI4 0
+LTI4 $688
+ADDRGP4 cgs+43252
+INDIRI4
+CNSTI4 2
+GTI4 $688
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+43252
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493504
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+493504
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $689
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $685
+LABELV $684
+LABELV $671
+endproc CG_DrawBlueFlagStatus 28 20
+proc CG_DrawBlueFlagHead 40 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $701
+JUMPV
+LABELV $698
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $703
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $703
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+51512+268
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $703
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+CNSTF4 1143111680
+DIVF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+4
+CNSTF4 1101004800
+ADDRLP4 32
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRGP4 $697
+JUMPV
+LABELV $703
+LABELV $699
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $701
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+39728
+INDIRI4
+LTI4 $698
+LABELV $697
+endproc CG_DrawBlueFlagHead 40 28
+proc CG_DrawRedFlagName 16 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $718
+JUMPV
+LABELV $715
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $720
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $720
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+51512+268
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_REDFLAG
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $720
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $714
+JUMPV
+LABELV $720
+LABELV $716
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $718
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+39728
+INDIRI4
+LTI4 $715
+LABELV $714
+endproc CG_DrawRedFlagName 16 36
+lit
+align 4
+LABELV $738
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $745
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+code
+proc CG_DrawRedFlagStatus 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $730
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $730
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $730
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $729
+ADDRLP4 0
+ADDRGP4 $738
+INDIRB
+ASGNB 16
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+24
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $729
+JUMPV
+LABELV $730
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $741
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $742
+JUMPV
+LABELV $741
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $743
+ADDRLP4 8
+ADDRGP4 $745
+INDIRB
+ASGNB 16
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+43248
+INDIRI4
+CNSTI4 0
+LTI4 $746
+ADDRGP4 cgs+43248
+INDIRI4
+CNSTI4 2
+GTI4 $746
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+43248
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493504
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $747
+JUMPV
+LABELV $746
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+493504
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $747
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $743
+LABELV $742
+LABELV $729
+endproc CG_DrawRedFlagStatus 28 20
+proc CG_DrawRedFlagHead 36 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $759
+JUMPV
+LABELV $756
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $761
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $761
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+51512+268
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_REDFLAG
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $761
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+CNSTF4 1143111680
+DIVF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1101004800
+ADDRLP4 28
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRGP4 $755
+JUMPV
+LABELV $761
+LABELV $757
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $759
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+39728
+INDIRI4
+LTI4 $756
+LABELV $755
+endproc CG_DrawRedFlagHead 36 28
+proc CG_HarvesterSkulls 80 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 63
+BANDI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $774
+ADDRGP4 $772
+JUMPV
+LABELV $774
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+EQI4 $776
+ADDRGP4 $772
+JUMPV
+LABELV $776
+ADDRLP4 16
+INDIRI4
+CNSTI4 99
+LEI4 $779
+ADDRLP4 16
+CNSTI4 99
+ASGNI4
+LABELV $779
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $781
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $784
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $784
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 36+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 36+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 24+4
+CNSTI4 360
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $793
+ADDRLP4 48
+ADDRGP4 cgs+632912+16
+INDIRI4
+ASGNI4
+ADDRGP4 $794
+JUMPV
+LABELV $793
+ADDRLP4 48
+ADDRGP4 cgs+632912+20
+INDIRI4
+ASGNI4
+LABELV $794
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 76
+CNSTF4 1108082688
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $785
+JUMPV
+LABELV $784
+ADDRLP4 64
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $800
+ADDRLP4 48
+ADDRGP4 cgs+632912+24
+INDIRI4
+ASGNI4
+ADDRGP4 $801
+JUMPV
+LABELV $800
+ADDRLP4 48
+ADDRGP4 cgs+632912+28
+INDIRI4
+ASGNI4
+LABELV $801
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ARGF4
+ADDRLP4 72
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $785
+LABELV $781
+LABELV $772
+endproc CG_HarvesterSkulls 80 36
+lit
+align 4
+LABELV $839
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_OneFlagStatus 48 20
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $808
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $809
+JUMPV
+LABELV $808
+ADDRLP4 0
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $809
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $814
+ADDRGP4 $807
+JUMPV
+LABELV $814
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $817
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $818
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $818
+JUMPV
+LABELV $817
+ADDRGP4 cgs+43244
+INDIRI4
+ADDRGP4 cgs+43240
+INDIRI4
+LEI4 $823
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $824
+JUMPV
+LABELV $823
+ADDRGP4 cgs+43244
+INDIRI4
+ADDRGP4 cgs+43240
+INDIRI4
+GEI4 $827
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $828
+JUMPV
+LABELV $827
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $831
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $831
+LABELV $828
+LABELV $824
+LABELV $818
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $833
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 0
+LTI4 $835
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 4
+GTI4 $835
+ADDRLP4 24
+ADDRGP4 $839
+INDIRB
+ASGNB 16
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 2
+NEI4 $840
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $845
+ADDRLP4 4
+CNSTI4 9
+ASGNI4
+ADDRGP4 $841
+JUMPV
+LABELV $845
+ADDRLP4 4
+CNSTI4 -9
+ASGNI4
+ADDRGP4 $841
+JUMPV
+LABELV $840
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 3
+NEI4 $847
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $851
+ADDRLP4 4
+CNSTI4 -9
+ASGNI4
+ADDRGP4 $848
+JUMPV
+LABELV $851
+ADDRLP4 4
+CNSTI4 9
+ASGNI4
+ADDRGP4 $848
+JUMPV
+LABELV $847
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 4
+NEI4 $853
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+LABELV $853
+LABELV $848
+LABELV $841
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493504
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $835
+LABELV $833
+LABELV $807
+endproc CG_OneFlagStatus 48 20
+proc CG_DrawCTFPowerUp 20 20
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $859
+ADDRGP4 $858
+JUMPV
+LABELV $859
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+LTI4 $866
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $862
+LABELV $866
+ADDRGP4 $858
+JUMPV
+LABELV $862
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $867
+ADDRLP4 0
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $868
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $872
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $875
+ADDRLP4 0
+CNSTI4 39
+ASGNI4
+ADDRGP4 $876
+JUMPV
+LABELV $875
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 42
+ADDI4
+ASGNI4
+LABELV $876
+LABELV $872
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $868
+JUMPV
+LABELV $867
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_GUARD
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $880
+ADDRGP4 PW_GUARD
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $881
+JUMPV
+LABELV $880
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_ARMORREGEN
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $882
+ADDRGP4 PW_ARMORREGEN
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $883
+JUMPV
+LABELV $882
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_SCOUT
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $884
+ADDRGP4 PW_SCOUT
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $885
+JUMPV
+LABELV $884
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_DOUBLER
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $886
+ADDRGP4 PW_DOUBLER
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+LABELV $886
+LABELV $885
+LABELV $883
+LABELV $881
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $888
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $888
+LABELV $868
+LABELV $858
+endproc CG_DrawCTFPowerUp 20 20
+proc CG_DrawTeamColor 8 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $891
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRGP4 $892
+JUMPV
+LABELV $891
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+LABELV $892
+LABELV $890
+endproc CG_DrawTeamColor 8 24
+lit
+align 4
+LABELV $936
+address PW_QUAD
+address PW_BATTLESUIT
+address PW_HASTE
+address PW_INVIS
+address PW_REGEN
+address PW_FLIGHT
+address PW_INVULNERABILITY
+code
+proc CG_DrawAreaPowerUp 260 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 204
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 208
+INDIRI4
+EQI4 $898
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 208
+INDIRI4
+NEI4 $898
+ADDRGP4 $897
+JUMPV
+LABELV $898
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $905
+ADDRLP4 216
+ADDRLP4 148+4
+ASGNP4
+ADDRGP4 $906
+JUMPV
+LABELV $905
+ADDRLP4 216
+ADDRLP4 148
+ASGNP4
+LABELV $906
+ADDRLP4 200
+ADDRLP4 216
+INDIRP4
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $907
+ADDRLP4 168
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 224
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 168
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 224
+INDIRI4
+LEI4 $912
+ADDRLP4 168
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 224
+INDIRI4
+EQI4 $910
+LABELV $912
+LABELV $910
+ADDRLP4 228
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 228
+INDIRI4
+ASGNI4
+LABELV $913
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 168
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $917
+ADDRGP4 $914
+JUMPV
+LABELV $917
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 168
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 2147483647
+NEI4 $919
+ADDRGP4 $914
+JUMPV
+LABELV $919
+ADDRLP4 144
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 168
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GTI4 $922
+ADDRGP4 $914
+JUMPV
+LABELV $922
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $927
+JUMPV
+LABELV $924
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LTI4 $928
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $933
+JUMPV
+LABELV $930
+ADDRLP4 232
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+ADDRLP4 68+4
+ADDP4
+ADDRLP4 232
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 236
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $931
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $933
+ADDRLP4 0
+INDIRI4
+ADDRLP4 132
+INDIRI4
+GEI4 $930
+ADDRGP4 $926
+JUMPV
+LABELV $928
+LABELV $925
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $927
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $924
+LABELV $926
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $914
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 16
+LTI4 $913
+ADDRGP4 $908
+JUMPV
+LABELV $907
+ADDRLP4 220
+ADDRGP4 $936
+INDIRB
+ASGNB 28
+ADDRLP4 168
+CNSTP4 0
+ASGNP4
+ADDRLP4 248
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $939
+JUMPV
+ADDRGP4 $941
+ARGP4
+CNSTU4 7
+ARGU4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $897
+JUMPV
+LABELV $939
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRGP4 $945
+JUMPV
+LABELV $942
+ADDRLP4 248
+INDIRI4
+CNSTI4 1
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 220
+ADDP4
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $946
+ADDRLP4 256
+CNSTI4 2
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ADDRLP4 256
+INDIRI4
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 256
+INDIRI4
+LSHI4
+ADDRLP4 220
+ADDP4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $946
+LABELV $943
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $945
+ADDRLP4 140
+INDIRI4
+CVIU4 4
+CNSTU4 7
+LTU4 $942
+LABELV $908
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $951
+JUMPV
+LABELV $948
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 164
+ADDRLP4 220
+INDIRP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $952
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $954
+ADDRLP4 144
+CNSTI4 -1
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRGP4 PW_QUAD
+INDIRI4
+NEI4 $956
+ADDRGP4 cg+693572
+INDIRI4
+CNSTI4 1
+NEI4 $955
+ADDRLP4 144
+ADDRGP4 cg+693576+16
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRGP4 cg+693576+16
+INDIRI4
+CNSTI4 1000
+ADDRLP4 164
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $955
+JUMPV
+LABELV $956
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+NEI4 $955
+ADDRGP4 cg+694152
+INDIRI4
+CNSTI4 1
+NEI4 $955
+ADDRLP4 144
+ADDRGP4 cg+694156+16
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRGP4 cg+694156+16
+INDIRI4
+CNSTI4 1000
+ADDRLP4 164
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $955
+JUMPV
+LABELV $954
+ADDRLP4 224
+CNSTI4 2
+ASGNI4
+ADDRLP4 144
+ADDRLP4 140
+INDIRI4
+ADDRLP4 224
+INDIRI4
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRLP4 224
+INDIRI4
+LSHI4
+ADDRLP4 168
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $955
+ADDRLP4 144
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $976
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $977
+JUMPV
+LABELV $976
+ADDRLP4 172
+ADDRLP4 144
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 172
+INDIRF4
+ADDRLP4 172
+INDIRF4
+CVFI4 4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 224+12
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 224+8
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 224+4
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 224
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 224
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $977
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $983
+LABELV $983
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $985
+ADDRLP4 164
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148+4
+INDIRF4
+ARGF4
+CNSTF4 1061158912
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 148+12
+INDIRF4
+ARGF4
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $990
+ADDRLP4 176
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $991
+JUMPV
+LABELV $990
+ADDRLP4 176
+CNSTI1 0
+ASGNI1
+LABELV $991
+ADDRLP4 148
+INDIRF4
+CNSTF4 1061158912
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1077936128
+ADDF4
+ARGF4
+ADDRLP4 148+4
+INDIRF4
+ADDRLP4 148+12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 176
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 228
+CNSTI4 0
+ASGNI4
+ADDRLP4 228
+INDIRI4
+ARGI4
+ADDRLP4 228
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 192
+ADDRLP4 148
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 196
+ADDRLP4 148+4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRF4
+ADDRLP4 148+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $997
+ADDRLP4 164
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_QUAD
+INDIRI4
+NEI4 $999
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $999
+ADDRGP4 cg_quadKillCounter+12
+INDIRI4
+CNSTI4 1
+NEI4 $999
+ADDRGP4 STAT_QUAD_KILL_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 168
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $999
+ADDRLP4 236
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 192
+INDIRI4
+CVIF4 4
+CNSTF4 1061158912
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1077936128
+ADDF4
+ARGF4
+ADDRLP4 196
+INDIRI4
+CVIF4 4
+CNSTF4 1036831949
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 148+8
+INDIRF4
+ADDRLP4 236
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 148+12
+INDIRF4
+ADDRLP4 236
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 cgs+632912+24
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1012
+ARGP4
+ADDRGP4 STAT_QUAD_KILL_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 168
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRI4
+CVIF4 4
+CNSTF4 1061158912
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1077936128
+ADDF4
+ADDRLP4 148+8
+INDIRF4
+ADDRLP4 236
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 196
+INDIRI4
+CVIF4 4
+ADDRLP4 148+12
+INDIRF4
+ADDRLP4 236
+INDIRF4
+CNSTF4 1036831949
+ADDF4
+MULF4
+ADDF4
+ARGF4
+CNSTF4 1051260355
+ADDRFP4 12
+INDIRF4
+MULF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+ADDRLP4 252
+INDIRI4
+ARGI4
+ADDRLP4 252
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $999
+ADDRLP4 164
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+NEI4 $1013
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1013
+ADDRGP4 cg_battleSuitKillCounter+12
+INDIRI4
+CNSTI4 1
+NEI4 $1013
+ADDRGP4 STAT_BATTLE_SUIT_KILL_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 168
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1013
+ADDRLP4 236
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 192
+INDIRI4
+CVIF4 4
+CNSTF4 1061158912
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1077936128
+ADDF4
+ARGF4
+ADDRLP4 196
+INDIRI4
+CVIF4 4
+CNSTF4 1036831949
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 148+8
+INDIRF4
+ADDRLP4 236
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 148+12
+INDIRF4
+ADDRLP4 236
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 cgs+632912+24
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1012
+ARGP4
+ADDRGP4 STAT_BATTLE_SUIT_KILL_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 168
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRI4
+CVIF4 4
+CNSTF4 1061158912
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1077936128
+ADDF4
+ADDRLP4 148+8
+INDIRF4
+ADDRLP4 236
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 196
+INDIRI4
+CVIF4 4
+ADDRLP4 148+12
+INDIRF4
+ADDRLP4 236
+INDIRF4
+CNSTF4 1036831949
+ADDF4
+MULF4
+ADDF4
+ARGF4
+CNSTF4 1051260355
+ADDRFP4 12
+INDIRF4
+MULF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+ADDRLP4 252
+INDIRI4
+ARGI4
+ADDRLP4 252
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1013
+LABELV $997
+LABELV $985
+LABELV $952
+LABELV $949
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $951
+ADDRLP4 140
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $948
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $897
+endproc CG_DrawAreaPowerUp 260 36
+proc CG_HaveWeapon 12 4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1027
+ADDRLP4 0
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1029
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1029
+ADDRLP4 8
+ADDRGP4 wcg+4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 6
+RSHI4
+CVIU4 4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+CNSTU4 65534
+BANDU4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+CNSTI4 1
+ADDRFP4 0
+INDIRI4
+LSHI4
+CVIU4 4
+BANDU4
+CNSTU4 0
+EQU4 $1034
+CNSTI4 1
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1034
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1029
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $1036
+CNSTI4 1
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1036
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1027
+ADDRLP4 0
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1040
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1040
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1042
+CNSTI4 1
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1042
+CNSTI4 0
+RETI4
+LABELV $1026
+endproc CG_HaveWeapon 12 4
+proc CG_NumHeldWeapons 24 4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1046
+ADDRLP4 12
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1048
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1048
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRGP4 wcg+4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 8
+RSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+BORI4
+ASGNI4
+ADDRGP4 $1047
+JUMPV
+LABELV $1048
+ADDRLP4 4
+CNSTI4 1
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRGP4 $1047
+JUMPV
+LABELV $1046
+ADDRLP4 4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1047
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1056
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1060
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1060
+LABELV $1057
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1056
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $1045
+endproc CG_NumHeldWeapons 24 4
+proc CG_WeaponAmmo 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1065
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1063
+LABELV $1065
+ADDRGP4 $1066
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 -2
+RETI4
+ADDRGP4 $1062
+JUMPV
+LABELV $1063
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1067
+CNSTI4 -2
+RETI4
+ADDRGP4 $1062
+JUMPV
+LABELV $1067
+ADDRLP4 4
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1070
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1072
+ADDRLP4 8
+CNSTI4 -2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+NEI4 $1074
+ADDRLP4 8
+ADDRGP4 wcg+4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRGP4 $1075
+JUMPV
+LABELV $1074
+CNSTI4 -2
+RETI4
+ADDRGP4 $1062
+JUMPV
+LABELV $1075
+ADDRLP4 8
+INDIRI4
+CNSTI4 255
+NEI4 $1080
+CNSTI4 -1
+RETI4
+ADDRGP4 $1062
+JUMPV
+LABELV $1080
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $1062
+JUMPV
+LABELV $1072
+CNSTI4 -2
+RETI4
+ADDRGP4 $1062
+JUMPV
+LABELV $1070
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1082
+CNSTI4 -2
+RETI4
+ADDRGP4 $1062
+JUMPV
+LABELV $1082
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+RETI4
+LABELV $1062
+endproc CG_WeaponAmmo 12 8
+export CG_GetValue
+proc CG_GetValue 288 16
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1086
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1086
+ADDRLP4 24
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1091
+ADDRLP4 12
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $1092
+JUMPV
+LABELV $1091
+ADDRLP4 12
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1092
+ADDRLP4 8
+CNSTI4 4524
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 92
+ADDRLP4 8
+INDIRP4
+CNSTI4 4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 7000
+LTI4 $2412
+ADDRLP4 32
+INDIRI4
+CNSTI4 7042
+GTI4 $2413
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2414-28000
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2414
+address $2335
+address $2346
+address $2356
+address $2361
+address $1097
+address $2362
+address $2363
+address $2364
+address $2365
+address $2366
+address $2367
+address $2368
+address $2369
+address $2370
+address $2371
+address $2372
+address $2373
+address $2374
+address $1097
+address $2376
+address $2377
+address $2378
+address $2379
+address $2380
+address $2381
+address $2382
+address $2383
+address $2384
+address $2385
+address $2386
+address $2387
+address $2388
+address $1097
+address $2390
+address $2375
+address $2389
+address $2397
+address $2399
+address $2401
+address $2403
+address $2405
+address $2407
+address $2409
+code
+LABELV $2412
+ADDRLP4 36
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LTI4 $1097
+ADDRLP4 36
+INDIRI4
+CNSTI4 327
+GTI4 $1097
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2416-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2416
+address $1142
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1168
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1206
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1453
+address $1455
+address $1457
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1103
+address $1097
+address $1097
+address $1097
+address $1123
+address $1097
+address $1097
+address $1097
+address $1097
+address $1109
+address $1097
+address $1119
+address $1097
+address $1097
+address $1140
+address $1097
+address $1097
+address $1133
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1144
+address $1147
+address $1153
+address $1097
+address $1150
+address $1156
+address $1165
+address $1159
+address $1097
+address $1097
+address $1162
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1202
+address $1097
+address $1097
+address $1244
+address $1097
+address $1097
+address $1097
+address $2313
+address $2324
+address $1097
+address $1097
+address $2249
+address $1254
+address $1268
+address $1282
+address $1296
+address $1299
+address $1313
+address $1327
+address $1334
+address $1097
+address $1097
+address $1097
+address $1097
+address $1459
+address $1464
+address $1474
+address $1479
+address $1484
+address $1489
+address $1494
+address $1499
+address $1504
+address $1509
+address $1514
+address $1519
+address $1469
+address $1524
+address $1532
+address $1536
+address $1540
+address $1544
+address $1548
+address $1552
+address $1556
+address $1560
+address $1564
+address $1568
+address $1528
+address $1572
+address $1582
+address $1587
+address $1592
+address $1597
+address $1602
+address $1607
+address $1612
+address $1617
+address $1622
+address $1627
+address $1577
+address $1632
+address $1637
+address $1647
+address $1652
+address $1657
+address $1662
+address $1667
+address $1672
+address $1677
+address $1682
+address $1687
+address $1692
+address $1642
+address $1697
+address $1707
+address $1712
+address $1717
+address $1722
+address $1727
+address $1732
+address $1737
+address $1742
+address $1747
+address $1752
+address $1702
+address $1097
+address $1757
+address $1760
+address $1763
+address $1766
+address $1769
+address $1772
+address $1775
+address $1778
+address $2173
+address $2176
+address $2190
+address $1097
+address $1097
+address $1097
+address $2255
+address $1348
+address $1363
+address $1378
+address $1393
+address $1397
+address $1412
+address $1427
+address $1434
+address $1097
+address $1097
+address $1097
+address $1097
+address $1781
+address $1787
+address $1799
+address $1805
+address $1811
+address $1817
+address $1823
+address $1829
+address $1835
+address $1841
+address $1847
+address $1853
+address $1793
+address $1859
+address $1869
+address $1874
+address $1879
+address $1884
+address $1889
+address $1894
+address $1899
+address $1904
+address $1909
+address $1914
+address $1864
+address $1919
+address $1931
+address $1937
+address $1943
+address $1949
+address $1955
+address $1961
+address $1967
+address $1973
+address $1979
+address $1985
+address $1925
+address $1991
+address $1997
+address $2009
+address $2015
+address $2021
+address $2027
+address $2033
+address $2039
+address $2045
+address $2051
+address $2057
+address $2063
+address $2003
+address $2069
+address $2081
+address $2087
+address $2093
+address $2099
+address $2105
+address $2111
+address $2117
+address $2123
+address $2129
+address $2135
+address $2075
+address $1097
+address $2141
+address $2145
+address $2149
+address $2153
+address $2157
+address $2161
+address $2165
+address $2169
+address $2204
+address $2219
+address $2234
+address $1097
+address $1097
+address $1097
+address $1127
+address $1097
+address $2309
+address $1449
+address $1097
+address $1214
+address $1232
+address $1236
+address $1097
+address $2261
+address $2264
+address $2267
+address $2270
+address $2273
+address $2276
+address $2297
+address $2300
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1097
+address $1129
+address $2311
+address $1451
+address $1097
+address $1223
+address $1234
+address $1240
+address $1097
+address $2279
+address $2282
+address $2285
+address $2288
+address $2291
+address $2294
+address $2303
+address $2306
+code
+LABELV $2413
+ADDRLP4 40
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 66666
+EQI4 $1099
+ADDRLP4 40
+INDIRI4
+CNSTI4 66667
+EQI4 $1101
+ADDRLP4 40
+INDIRI4
+CNSTI4 66668
+EQI4 $1131
+ADDRGP4 $1097
+JUMPV
+LABELV $1099
+ADDRLP4 44
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 4524
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1101
+ADDRLP4 48
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 4524
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1103
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1104
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 Wolfcam_PlayerArmor
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+GEI4 $1107
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1107
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1104
+ADDRGP4 STAT_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1109
+ADDRLP4 52
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1110
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1112
+ADDRLP4 56
+ADDRGP4 wcg+4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTU4 255
+BANDU4
+ASGNU4
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRU4
+CNSTI4 1
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 56
+INDIRU4
+CNSTU4 1
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1112
+CNSTF4 3212836864
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1110
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1115
+CNSTF4 3212836864
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1115
+ADDRLP4 24
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1098
+ADDRLP4 24
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1119
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1120
+CNSTF4 3212836864
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1120
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1123
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1124
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 Wolfcam_PlayerHealth
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1124
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1127
+ADDRGP4 cgs+43240
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1129
+ADDRGP4 cgs+43244
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1131
+ADDRLP4 56
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 4524
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1133
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1134
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1134
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1136
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 63
+BANDI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1136
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1140
+ADDRGP4 cgs+43256
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1142
+ADDRGP4 cgs+39688
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1144
+ADDRLP4 8
+INDIRP4
+CNSTI4 4504
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1145
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1145
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1147
+ADDRLP4 8
+INDIRP4
+CNSTI4 4504
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1148
+ADDRLP4 16
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1148
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1150
+ADDRLP4 8
+INDIRP4
+CNSTI4 4504
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1151
+ADDRLP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1151
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1153
+ADDRLP4 8
+INDIRP4
+CNSTI4 4504
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1154
+ADDRLP4 16
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1154
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1156
+ADDRLP4 8
+INDIRP4
+CNSTI4 4504
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1157
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1157
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1159
+ADDRLP4 8
+INDIRP4
+CNSTI4 4504
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1160
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1160
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1162
+ADDRLP4 8
+INDIRP4
+CNSTI4 4504
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1163
+ADDRLP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1163
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1165
+ADDRLP4 8
+INDIRP4
+CNSTI4 4504
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1166
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1166
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1168
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $1175
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $1175
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $1169
+LABELV $1175
+ADDRLP4 60
+ADDRGP4 cgs+39708
+INDIRI4
+ASGNI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1169
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+EQI4 $1183
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $1183
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $1177
+LABELV $1183
+ADDRLP4 60
+ADDRGP4 cgs+39720
+INDIRI4
+ASGNI4
+ADDRGP4 $1178
+JUMPV
+LABELV $1177
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $1189
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $1185
+LABELV $1189
+ADDRGP4 cgs+39716
+INDIRI4
+CNSTI4 0
+EQI4 $1190
+ADDRLP4 60
+ADDRGP4 cgs+39716
+INDIRI4
+ASGNI4
+ADDRGP4 $1186
+JUMPV
+LABELV $1190
+ADDRLP4 60
+ADDRGP4 cgs+39720
+INDIRI4
+ASGNI4
+ADDRGP4 $1186
+JUMPV
+LABELV $1185
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+EQI4 $1199
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $1195
+LABELV $1199
+ADDRLP4 60
+ADDRGP4 cgs+39700
+INDIRI4
+ASGNI4
+ADDRGP4 $1196
+JUMPV
+LABELV $1195
+ADDRLP4 60
+ADDRGP4 cgs+39704
+INDIRI4
+ASGNI4
+LABELV $1196
+LABELV $1186
+LABELV $1178
+LABELV $1170
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1202
+CNSTI4 92
+ADDRGP4 cg+610856
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+28
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1206
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $1207
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1211
+ADDRGP4 $1208
+JUMPV
+LABELV $1211
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1208
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1207
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1214
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $1215
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $1219
+ADDRGP4 $1216
+JUMPV
+LABELV $1219
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1216
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1215
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1223
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $1224
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1228
+ADDRGP4 $1225
+JUMPV
+LABELV $1228
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1225
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1224
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1232
+ADDRGP4 cgs+43260
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1234
+ADDRGP4 cgs+43264
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1236
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1237
+CNSTI4 671
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 76
+INDIRF4
+ASGNF4
+LABELV $1237
+ADDRLP4 28
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1240
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1241
+CNSTI4 672
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 76
+INDIRF4
+ASGNF4
+LABELV $1241
+ADDRLP4 28
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1244
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $1245
+ADDRLP4 28
+ADDRGP4 cg+627496
+INDIRF4
+ASGNF4
+ADDRGP4 $1246
+JUMPV
+LABELV $1245
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $1248
+ADDRLP4 72
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 76
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 76
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 $1249
+JUMPV
+LABELV $1248
+ADDRLP4 72
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 76
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 76
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 88
+INDIRF4
+ASGNF4
+LABELV $1249
+LABELV $1246
+ADDRLP4 28
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1254
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+CNSTI4 719
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $1259
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $1255
+LABELV $1259
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $1255
+ADDRGP4 cg+3196932+4528
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1255
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $1262
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1262
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1268
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $1269
+ADDRGP4 cg+3196932+4540
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1269
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $1274
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+68
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1274
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1282
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $1283
+ADDRGP4 cg+3196932+4544
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1283
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $1288
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+72
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1288
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1296
+ADDRGP4 cg+3196932+4556
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1299
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+CNSTI4 719
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1300
+ADDRGP4 cg+3848204
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1300
+ADDRGP4 cg+3196932+4536
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1300
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $1305
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+16
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1305
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1313
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $1314
+ADDRGP4 cg+3196932+4532
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1314
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $1319
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1319
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1327
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $1328
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+252
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1328
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1334
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $1335
+ADDRGP4 cg+3196932+4548
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1335
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $1340
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+28
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1340
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1348
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+CNSTI4 719
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 108
+INDIRI4
+NEI4 $1353
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $1349
+LABELV $1353
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $1349
+ADDRGP4 cg+3196932+5088+4528
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1349
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $1357
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1357
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1363
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $1364
+ADDRGP4 cg+3196932+5088+4540
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1364
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $1370
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+68
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1370
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1378
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $1379
+ADDRGP4 cg+3196932+5088+4544
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1379
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $1385
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+72
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1385
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1393
+ADDRGP4 cg+3196932+5088+4556
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1397
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+CNSTI4 719
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $1398
+ADDRGP4 cg+3848204
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $1398
+ADDRGP4 cg+3196932+5088+4536
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1398
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $1404
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+16
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1404
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1412
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $1413
+ADDRGP4 cg+3196932+5088+4532
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1413
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $1419
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1419
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1427
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $1428
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+252
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1428
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1434
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $1435
+ADDRGP4 cg+3196932+5088+4548
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1435
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1441
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+28
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1441
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1449
+ADDRGP4 cg+610868
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1451
+ADDRGP4 cg+610872
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1453
+CNSTI4 708
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 $1454
+ARGP4
+ADDRLP4 132
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1455
+CNSTI4 708
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRGP4 $1456
+ARGP4
+ADDRLP4 144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1457
+CNSTI4 708
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 $1458
+ARGP4
+ADDRLP4 156
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 160
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1459
+ADDRGP4 cg+3196932+4608+32+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1464
+ADDRGP4 cg+3196932+4608+64+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1469
+ADDRGP4 cg+3196932+4608+448+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1474
+ADDRGP4 cg+3196932+4608+96+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1479
+ADDRGP4 cg+3196932+4608+128+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1484
+ADDRGP4 cg+3196932+4608+160+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1489
+ADDRGP4 cg+3196932+4608+192+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1494
+ADDRGP4 cg+3196932+4608+224+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1499
+ADDRGP4 cg+3196932+4608+256+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1504
+ADDRGP4 cg+3196932+4608+288+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1509
+ADDRGP4 cg+3196932+4608+416+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1514
+ADDRGP4 cg+3196932+4608+352+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1519
+ADDRGP4 cg+3196932+4608+384+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1524
+ADDRGP4 cg+3196932+4608+64
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1528
+ADDRGP4 cg+3196932+4608+448
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1532
+ADDRGP4 cg+3196932+4608+96
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1536
+ADDRGP4 cg+3196932+4608+128
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1540
+ADDRGP4 cg+3196932+4608+160
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1544
+ADDRGP4 cg+3196932+4608+192
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1548
+ADDRGP4 cg+3196932+4608+224
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1552
+ADDRGP4 cg+3196932+4608+256
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1556
+ADDRGP4 cg+3196932+4608+288
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1560
+ADDRGP4 cg+3196932+4608+416
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1564
+ADDRGP4 cg+3196932+4608+352
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1568
+ADDRGP4 cg+3196932+4608+384
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1572
+ADDRGP4 cg+3196932+4608+64+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1577
+ADDRGP4 cg+3196932+4608+448+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1582
+ADDRGP4 cg+3196932+4608+96+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1587
+ADDRGP4 cg+3196932+4608+128+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1592
+ADDRGP4 cg+3196932+4608+160+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1597
+ADDRGP4 cg+3196932+4608+192+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1602
+ADDRGP4 cg+3196932+4608+224+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1607
+ADDRGP4 cg+3196932+4608+256+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1612
+ADDRGP4 cg+3196932+4608+288+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1617
+ADDRGP4 cg+3196932+4608+416+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1622
+ADDRGP4 cg+3196932+4608+352+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1627
+ADDRGP4 cg+3196932+4608+384+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1632
+ADDRGP4 cg+3196932+4608+32+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1637
+ADDRGP4 cg+3196932+4608+64+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1642
+ADDRGP4 cg+3196932+4608+448+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1647
+ADDRGP4 cg+3196932+4608+96+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1652
+ADDRGP4 cg+3196932+4608+128+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1657
+ADDRGP4 cg+3196932+4608+160+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1662
+ADDRGP4 cg+3196932+4608+192+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1667
+ADDRGP4 cg+3196932+4608+224+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1672
+ADDRGP4 cg+3196932+4608+256+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1677
+ADDRGP4 cg+3196932+4608+288+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1682
+ADDRGP4 cg+3196932+4608+416+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1687
+ADDRGP4 cg+3196932+4608+352+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1692
+ADDRGP4 cg+3196932+4608+384+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1697
+ADDRGP4 cg+3196932+4608+64+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1702
+ADDRGP4 cg+3196932+4608+448+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1707
+ADDRGP4 cg+3196932+4608+96+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1712
+ADDRGP4 cg+3196932+4608+128+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1717
+ADDRGP4 cg+3196932+4608+160+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1722
+ADDRGP4 cg+3196932+4608+192+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1727
+ADDRGP4 cg+3196932+4608+224+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1732
+ADDRGP4 cg+3196932+4608+256+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1737
+ADDRGP4 cg+3196932+4608+288+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1742
+ADDRGP4 cg+3196932+4608+416+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1747
+ADDRGP4 cg+3196932+4608+352+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1752
+ADDRGP4 cg+3196932+4608+384+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1757
+ADDRGP4 cg+3196932+4576
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1760
+ADDRGP4 cg+3196932+4584
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1763
+ADDRGP4 cg+3196932+4592
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1766
+ADDRGP4 cg+3196932+4600
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1769
+ADDRGP4 cg+3196932+4580
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1772
+ADDRGP4 cg+3196932+4588
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1775
+ADDRGP4 cg+3196932+4596
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1778
+ADDRGP4 cg+3196932+4604
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1781
+ADDRGP4 cg+3196932+5088+4608+32+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1787
+ADDRGP4 cg+3196932+5088+4608+64+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1793
+ADDRGP4 cg+3196932+5088+4608+448+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1799
+ADDRGP4 cg+3196932+5088+4608+96+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1805
+ADDRGP4 cg+3196932+5088+4608+128+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1811
+ADDRGP4 cg+3196932+5088+4608+160+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1817
+ADDRGP4 cg+3196932+5088+4608+192+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1823
+ADDRGP4 cg+3196932+5088+4608+224+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1829
+ADDRGP4 cg+3196932+5088+4608+256+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1835
+ADDRGP4 cg+3196932+5088+4608+288+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1841
+ADDRGP4 cg+3196932+5088+4608+416+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1847
+ADDRGP4 cg+3196932+5088+4608+352+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1853
+ADDRGP4 cg+3196932+5088+4608+384+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1859
+ADDRGP4 cg+3196932+5088+4608+64
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1864
+ADDRGP4 cg+3196932+5088+4608+448
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1869
+ADDRGP4 cg+3196932+5088+4608+96
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1874
+ADDRGP4 cg+3196932+5088+4608+128
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1879
+ADDRGP4 cg+3196932+5088+4608+160
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1884
+ADDRGP4 cg+3196932+5088+4608+192
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1889
+ADDRGP4 cg+3196932+5088+4608+224
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1894
+ADDRGP4 cg+3196932+5088+4608+256
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1899
+ADDRGP4 cg+3196932+5088+4608+288
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1904
+ADDRGP4 cg+3196932+5088+4608+416
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1909
+ADDRGP4 cg+3196932+5088+4608+352
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1914
+ADDRGP4 cg+3196932+5088+4608+384
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1919
+ADDRGP4 cg+3196932+5088+4608+64+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1925
+ADDRGP4 cg+3196932+5088+4608+448+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1931
+ADDRGP4 cg+3196932+5088+4608+96+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1937
+ADDRGP4 cg+3196932+5088+4608+128+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1943
+ADDRGP4 cg+3196932+5088+4608+160+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1949
+ADDRGP4 cg+3196932+5088+4608+192+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1955
+ADDRGP4 cg+3196932+5088+4608+224+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1961
+ADDRGP4 cg+3196932+5088+4608+256+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1967
+ADDRGP4 cg+3196932+5088+4608+288+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1973
+ADDRGP4 cg+3196932+5088+4608+416+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1979
+ADDRGP4 cg+3196932+5088+4608+352+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1985
+ADDRGP4 cg+3196932+5088+4608+384+4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1991
+ADDRGP4 cg+3196932+5088+4608+32+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1997
+ADDRGP4 cg+3196932+5088+4608+64+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2003
+ADDRGP4 cg+3196932+5088+4608+448+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2009
+ADDRGP4 cg+3196932+5088+4608+96+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2015
+ADDRGP4 cg+3196932+5088+4608+128+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2021
+ADDRGP4 cg+3196932+5088+4608+160+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2027
+ADDRGP4 cg+3196932+5088+4608+192+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2033
+ADDRGP4 cg+3196932+5088+4608+224+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2039
+ADDRGP4 cg+3196932+5088+4608+256+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2045
+ADDRGP4 cg+3196932+5088+4608+288+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2051
+ADDRGP4 cg+3196932+5088+4608+416+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2057
+ADDRGP4 cg+3196932+5088+4608+352+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2063
+ADDRGP4 cg+3196932+5088+4608+384+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2069
+ADDRGP4 cg+3196932+5088+4608+64+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2075
+ADDRGP4 cg+3196932+5088+4608+448+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2081
+ADDRGP4 cg+3196932+5088+4608+96+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2087
+ADDRGP4 cg+3196932+5088+4608+128+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2093
+ADDRGP4 cg+3196932+5088+4608+160+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2099
+ADDRGP4 cg+3196932+5088+4608+192+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2105
+ADDRGP4 cg+3196932+5088+4608+224+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2111
+ADDRGP4 cg+3196932+5088+4608+256+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2117
+ADDRGP4 cg+3196932+5088+4608+288+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2123
+ADDRGP4 cg+3196932+5088+4608+416+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2129
+ADDRGP4 cg+3196932+5088+4608+352+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2135
+ADDRGP4 cg+3196932+5088+4608+384+8
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2141
+ADDRGP4 cg+3196932+5088+4576
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2145
+ADDRGP4 cg+3196932+5088+4584
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2149
+ADDRGP4 cg+3196932+5088+4592
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2153
+ADDRGP4 cg+3196932+5088+4600
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2157
+ADDRGP4 cg+3196932+5088+4580
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2161
+ADDRGP4 cg+3196932+5088+4588
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2165
+ADDRGP4 cg+3196932+5088+4596
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2169
+ADDRGP4 cg+3196932+5088+4604
+INDIRF4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2173
+ADDRGP4 cg+3196932+4560
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2176
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $2177
+ADDRGP4 cg+3196932+4564
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2177
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $2182
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+32
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2182
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2190
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $2191
+ADDRGP4 cg+3196932+4568
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2191
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $2196
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+40
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2196
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2204
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $2205
+ADDRGP4 cg+3196932+5088+4560
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2205
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $2211
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+36
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2211
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2219
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $2220
+ADDRGP4 cg+3196932+5088+4564
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2220
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $2226
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+32
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2226
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2234
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $2235
+ADDRGP4 cg+3196932+5088+4568
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2235
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $2241
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+40
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2241
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2249
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $2250
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 cg+3848208
+INDIRI4
+LSHI4
+BANDI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2250
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2255
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $2256
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 cg+3848212
+INDIRI4
+LSHI4
+BANDI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2256
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2261
+ADDRGP4 cg+3856416+12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2264
+ADDRGP4 cg+3856416+16
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2267
+ADDRGP4 cg+3856416+20
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2270
+ADDRGP4 cg+3856416+24
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2273
+ADDRGP4 cg+3856416+28
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2276
+ADDRGP4 cg+3856416+32
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2279
+ADDRGP4 cg+3856416+68
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2282
+ADDRGP4 cg+3856416+72
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2285
+ADDRGP4 cg+3856416+76
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2288
+ADDRGP4 cg+3856416+80
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2291
+ADDRGP4 cg+3856416+84
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2294
+ADDRGP4 cg+3856416+88
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2297
+ADDRGP4 cg+3856416+48
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2300
+ADDRGP4 cg+3856416+52
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2303
+ADDRGP4 cg+3856416+104
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2306
+ADDRGP4 cg+3856416+108
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2309
+ADDRGP4 cgs+1957816
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2311
+ADDRGP4 cgs+1957820
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2313
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2314
+ADDRLP4 172
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2314
+ADDRLP4 172
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2315
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+NEI4 $2320
+ADDRGP4 cgs+43264
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2320
+ADDRGP4 cgs+43260
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2324
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2325
+ADDRLP4 172
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2326
+JUMPV
+LABELV $2325
+ADDRLP4 172
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2326
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+NEI4 $2331
+ADDRGP4 cgs+43260
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2331
+ADDRGP4 cgs+43264
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2335
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $2336
+CNSTF4 0
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2336
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2339
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2339
+CNSTF4 1073741824
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2339
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2343
+CNSTF4 1065353216
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2343
+CNSTF4 1077936128
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2346
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2347
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2347
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $2351
+ADDRGP4 cg+609312
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2351
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2356
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2357
+ADDRGP4 wcg+31087196
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2357
+ADDRGP4 cg+627420
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2361
+ADDRLP4 172
+ADDRGP4 CG_NumHeldWeapons
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2362
+CNSTI4 1
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2363
+CNSTI4 2
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2364
+CNSTI4 3
+ARGI4
+ADDRLP4 184
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2365
+CNSTI4 4
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2366
+CNSTI4 5
+ARGI4
+ADDRLP4 192
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2367
+CNSTI4 6
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2368
+CNSTI4 7
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2369
+CNSTI4 8
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2370
+CNSTI4 9
+ARGI4
+ADDRLP4 208
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2371
+CNSTI4 10
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2372
+CNSTI4 11
+ARGI4
+ADDRLP4 216
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2373
+CNSTI4 12
+ARGI4
+ADDRLP4 220
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2374
+CNSTI4 13
+ARGI4
+ADDRLP4 224
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2375
+CNSTI4 14
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2376
+CNSTI4 1
+ARGI4
+ADDRLP4 232
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2377
+CNSTI4 2
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2378
+CNSTI4 3
+ARGI4
+ADDRLP4 240
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2379
+CNSTI4 4
+ARGI4
+ADDRLP4 244
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2380
+CNSTI4 5
+ARGI4
+ADDRLP4 248
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2381
+CNSTI4 6
+ARGI4
+ADDRLP4 252
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2382
+CNSTI4 7
+ARGI4
+ADDRLP4 256
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2383
+CNSTI4 8
+ARGI4
+ADDRLP4 260
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2384
+CNSTI4 9
+ARGI4
+ADDRLP4 264
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2385
+CNSTI4 10
+ARGI4
+ADDRLP4 268
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2386
+CNSTI4 11
+ARGI4
+ADDRLP4 272
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2387
+CNSTI4 12
+ARGI4
+ADDRLP4 276
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2388
+CNSTI4 13
+ARGI4
+ADDRLP4 280
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2389
+CNSTI4 14
+ARGI4
+ADDRLP4 284
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2390
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2391
+CNSTI4 2392
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2380
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2391
+CNSTI4 2392
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2380
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2397
+ADDRGP4 cg+6770160
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2399
+ADDRGP4 cg+6770164
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2401
+ADDRGP4 cg+6770168
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2403
+ADDRGP4 cg+6770172
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2405
+ADDRGP4 cg+6770176
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2407
+ADDRGP4 cg+6770180
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $2409
+ADDRGP4 cg+6770184
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1097
+ADDRGP4 $2411
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1098
+CNSTF4 3212836864
+RETF4
+LABELV $1085
+endproc CG_GetValue 288 16
+export CG_OtherTeamHasFlag
+proc CG_OtherTeamHasFlag 8 0
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $2425
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $2425
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $2419
+LABELV $2425
+ADDRLP4 0
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2427
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2427
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2432
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $2435
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 3
+NEI4 $2435
+CNSTI4 1
+RETI4
+ADDRGP4 $2418
+JUMPV
+LABELV $2435
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2438
+ADDRGP4 cgs+43256
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2438
+CNSTI4 1
+RETI4
+ADDRGP4 $2418
+JUMPV
+LABELV $2438
+CNSTI4 0
+RETI4
+ADDRGP4 $2418
+JUMPV
+LABELV $2432
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2441
+ADDRGP4 cgs+43248
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2441
+CNSTI4 1
+RETI4
+ADDRGP4 $2418
+JUMPV
+LABELV $2441
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2444
+ADDRGP4 cgs+43252
+INDIRI4
+CNSTI4 1
+NEI4 $2444
+CNSTI4 1
+RETI4
+ADDRGP4 $2418
+JUMPV
+LABELV $2444
+CNSTI4 0
+RETI4
+ADDRGP4 $2418
+JUMPV
+LABELV $2419
+CNSTI4 0
+RETI4
+LABELV $2418
+endproc CG_OtherTeamHasFlag 8 0
+export CG_YourTeamHasFlag
+proc CG_YourTeamHasFlag 8 0
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $2454
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $2454
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $2448
+LABELV $2454
+ADDRLP4 0
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2456
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2456
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2461
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $2464
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 2
+NEI4 $2464
+CNSTI4 1
+RETI4
+ADDRGP4 $2447
+JUMPV
+LABELV $2464
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2467
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 3
+NEI4 $2467
+CNSTI4 1
+RETI4
+ADDRGP4 $2447
+JUMPV
+LABELV $2467
+CNSTI4 0
+RETI4
+ADDRGP4 $2447
+JUMPV
+LABELV $2461
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2470
+ADDRGP4 cgs+43252
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2470
+CNSTI4 1
+RETI4
+ADDRGP4 $2447
+JUMPV
+LABELV $2470
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2473
+ADDRGP4 cgs+43248
+INDIRI4
+CNSTI4 1
+NEI4 $2473
+CNSTI4 1
+RETI4
+ADDRGP4 $2447
+JUMPV
+LABELV $2473
+CNSTI4 0
+RETI4
+ADDRGP4 $2447
+JUMPV
+LABELV $2448
+CNSTI4 0
+RETI4
+LABELV $2447
+endproc CG_YourTeamHasFlag 8 0
+proc CG_OwnerDrawVisible2 36 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2477
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $2484
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2484
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2479
+LABELV $2484
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2479
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 495
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2488
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2485
+LABELV $2488
+ADDRLP4 12
+CNSTI4 686
+ASGNI4
+ADDRGP4 $2486
+JUMPV
+LABELV $2485
+ADDRLP4 12
+CNSTI4 685
+ASGNI4
+LABELV $2486
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2489
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2489
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2477
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2492
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $2499
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2499
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2494
+LABELV $2499
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2494
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 495
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2503
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2500
+LABELV $2503
+ADDRLP4 12
+CNSTI4 687
+ASGNI4
+ADDRGP4 $2501
+JUMPV
+LABELV $2500
+ADDRLP4 12
+CNSTI4 686
+ASGNI4
+LABELV $2501
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2504
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2504
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2492
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2507
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2518
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2509
+LABELV $2518
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2509
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2507
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $2519
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2530
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2521
+LABELV $2530
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2521
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2519
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2531
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2542
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2533
+LABELV $2542
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2533
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2531
+ADDRFP4 0
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $2543
+ADDRLP4 0
+CNSTI4 14
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2554
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2545
+LABELV $2554
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2545
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2543
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2555
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2566
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2557
+LABELV $2566
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2557
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2555
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $2567
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2578
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2569
+LABELV $2578
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2569
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2567
+ADDRFP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $2579
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2590
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2581
+LABELV $2590
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2581
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2579
+ADDRFP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $2591
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2602
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2593
+LABELV $2602
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2593
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2591
+ADDRFP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $2603
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2614
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2605
+LABELV $2614
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2605
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2603
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2615
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2626
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2617
+LABELV $2626
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2617
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2615
+ADDRFP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $2627
+ADDRLP4 0
+CNSTI4 13
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2638
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2629
+LABELV $2638
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2629
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2627
+ADDRFP4 0
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2639
+ADDRLP4 0
+CNSTI4 11
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2650
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2641
+LABELV $2650
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2641
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2639
+ADDRFP4 0
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $2651
+ADDRLP4 0
+CNSTI4 12
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2662
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2653
+LABELV $2662
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2653
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2651
+ADDRFP4 0
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $2663
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2665
+ADDRLP4 8
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $2666
+JUMPV
+LABELV $2665
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2666
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $2673
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $2671
+LABELV $2673
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2671
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2663
+ADDRFP4 0
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $2674
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2676
+ADDRLP4 8
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $2677
+JUMPV
+LABELV $2676
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2677
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $2684
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $2682
+LABELV $2684
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2682
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2674
+ADDRFP4 0
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $2685
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2687
+ADDRLP4 8
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $2688
+JUMPV
+LABELV $2687
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2688
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $2693
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2693
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2685
+ADDRFP4 0
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+EQI4 $2695
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2697
+ADDRLP4 8
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $2698
+JUMPV
+LABELV $2697
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2698
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $2703
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2703
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2695
+ADDRFP4 0
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $2705
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2707
+CNSTI4 687
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2710
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2710
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2707
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+CNSTI4 495
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $2716
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2713
+LABELV $2716
+ADDRLP4 12
+CNSTI4 686
+ASGNI4
+ADDRGP4 $2714
+JUMPV
+LABELV $2713
+ADDRLP4 12
+CNSTI4 685
+ASGNI4
+LABELV $2714
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2717
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2717
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2705
+ADDRFP4 0
+INDIRI4
+CNSTI4 4194304
+BANDI4
+CNSTI4 0
+EQI4 $2735
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2722
+CNSTI4 688
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2725
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2725
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2722
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+CNSTI4 495
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $2731
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2728
+LABELV $2731
+ADDRLP4 12
+CNSTI4 687
+ASGNI4
+ADDRGP4 $2729
+JUMPV
+LABELV $2728
+ADDRLP4 12
+CNSTI4 686
+ASGNI4
+LABELV $2729
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2732
+CNSTI4 1
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2732
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2735
+ADDRGP4 $2737
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2736
+CNSTI4 0
+RETI4
+LABELV $2476
+endproc CG_OwnerDrawVisible2 36 16
+export CG_OwnerDrawVisible
+proc CG_OwnerDrawVisible 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2739
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_OwnerDrawVisible2
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2739
+ADDRFP4 0
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $2741
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+NEI4 $2745
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2746
+JUMPV
+LABELV $2745
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2746
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2741
+ADDRFP4 0
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $2747
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+EQI4 $2751
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2752
+JUMPV
+LABELV $2751
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2752
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2747
+ADDRFP4 0
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+EQI4 $2753
+ADDRLP4 4
+ADDRGP4 CG_OtherTeamHasFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2753
+ADDRFP4 0
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $2755
+ADDRLP4 4
+ADDRGP4 CG_YourTeamHasFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2755
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $2757
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2759
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2762
+ADDRGP4 cgs+43256
+INDIRI4
+CNSTI4 3
+NEI4 $2762
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2762
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $2760
+ADDRGP4 cgs+43256
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2760
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2759
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $2768
+ADDRGP4 cgs+43248
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2768
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2768
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2771
+ADDRGP4 cgs+43252
+INDIRI4
+CNSTI4 1
+NEI4 $2771
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2771
+LABELV $2760
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2757
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2774
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2776
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2776
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2774
+ADDRFP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $2779
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2781
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2781
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2779
+ADDRFP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $2784
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $2786
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2786
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2784
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2789
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $2791
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2791
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2789
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2794
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+NEI4 $2796
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2796
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2794
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $2799
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 7
+NEI4 $2801
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2801
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2799
+ADDRFP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $2804
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2806
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Wolfcam_PlayerHealth
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -9999
+NEI4 $2809
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2809
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $2811
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2811
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2806
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 25
+GEI4 $2813
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2813
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2804
+ADDRFP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $2816
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+NEI4 $2818
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2818
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2816
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $2821
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $2823
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2823
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2821
+ADDRFP4 0
+INDIRI4
+CNSTI4 66669
+BANDI4
+CNSTI4 0
+EQI4 $2826
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $2828
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2828
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2826
+ADDRFP4 0
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $2831
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2833
+ADDRLP4 4
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2839
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2839
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2836
+LABELV $2839
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2836
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2833
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+CNSTI4 356
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $2846
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $2846
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $2840
+LABELV $2846
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2840
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2831
+ADDRFP4 0
+INDIRI4
+CNSTI4 536870912
+BANDI4
+CNSTI4 0
+EQI4 $2847
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2849
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2851
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2851
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2849
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2856
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2856
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2847
+ADDRFP4 0
+INDIRI4
+CNSTI4 1073741824
+BANDI4
+CNSTI4 0
+EQI4 $2859
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2861
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2863
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2863
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2861
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2868
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2868
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2859
+ADDRFP4 0
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $2871
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2873
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2874
+JUMPV
+LABELV $2873
+ADDRLP4 0
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2874
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2879
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+EQI4 $2879
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2883
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2883
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+GEI4 $2887
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $2891
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2891
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2887
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2893
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2893
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2879
+ADDRLP4 8
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $2902
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $2895
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2895
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $2895
+LABELV $2902
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+CNSTI4 0
+EQI4 $2903
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2903
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2895
+ADDRLP4 16
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2906
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRGP4 cgs+43240
+INDIRI4
+EQI4 $2908
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2908
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2906
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $2914
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $2917
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $2922
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2922
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+CNSTI4 0
+EQI4 $2925
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2925
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2917
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2914
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2871
+ADDRFP4 0
+INDIRI4
+CNSTI4 134217728
+BANDI4
+CNSTI4 0
+EQI4 $2928
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2930
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2931
+JUMPV
+LABELV $2930
+ADDRLP4 0
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2931
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $2936
+LABELV $2936
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2939
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $2939
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2939
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+LEI4 $2943
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2943
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2928
+ADDRFP4 0
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $2947
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2949
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2950
+JUMPV
+LABELV $2949
+ADDRLP4 0
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2950
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $2955
+LABELV $2955
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2958
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2958
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2958
+ADDRGP4 cgs+43244
+INDIRI4
+ADDRGP4 cgs+43240
+INDIRI4
+LEI4 $2962
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2962
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2947
+ADDRFP4 0
+INDIRI4
+CNSTI4 8388608
+BANDI4
+CNSTI4 0
+EQI4 $2966
+ADDRGP4 $2968
+JUMPV
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2968
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2966
+ADDRFP4 0
+INDIRI4
+CNSTI4 33554432
+BANDI4
+CNSTI4 0
+EQI4 $2970
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2972
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2973
+JUMPV
+LABELV $2972
+ADDRLP4 0
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2973
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2978
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+EQI4 $2978
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2982
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2982
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+GEI4 $2986
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $2990
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2990
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2986
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2992
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2992
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2978
+ADDRLP4 8
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $3001
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $2994
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2994
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $2994
+LABELV $3001
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+CNSTI4 0
+NEI4 $3002
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3002
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2994
+ADDRLP4 16
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3005
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRGP4 cgs+43240
+INDIRI4
+NEI4 $3007
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3007
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3005
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $3013
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $3016
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $3021
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3021
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+CNSTI4 0
+NEI4 $3024
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3024
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3016
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3013
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $2970
+ADDRFP4 0
+INDIRI4
+CNSTI4 4194304
+BANDI4
+CNSTI4 0
+EQI4 $3027
+ADDRGP4 $3029
+JUMPV
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3029
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3027
+ADDRFP4 0
+INDIRI4
+CNSTI4 16777216
+BANDI4
+CNSTI4 0
+EQI4 $3031
+ADDRGP4 cg+3874624
+INDIRI4
+CNSTI4 0
+EQI4 $3033
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3033
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3031
+ADDRFP4 0
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $3036
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+NEI4 $3038
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3038
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3036
+ADDRFP4 0
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $3041
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $3043
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3043
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3041
+ADDRFP4 0
+INDIRI4
+CNSTI4 1048576
+BANDI4
+CNSTI4 0
+EQI4 $3046
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $3048
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3048
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3046
+ADDRFP4 0
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $3051
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $3053
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3053
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3051
+ADDRFP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+EQU4 $3067
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $3066
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $3066
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+EQI4 $3066
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $3058
+LABELV $3066
+CNSTI4 1
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3058
+CNSTI4 0
+RETI4
+ADDRGP4 $2738
+JUMPV
+LABELV $3067
+ADDRGP4 $3069
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3068
+CNSTI4 0
+RETI4
+LABELV $2738
+endproc CG_OwnerDrawVisible 20 8
+proc CG_DrawPlayerHasFlag 40 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3072
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3073
+JUMPV
+LABELV $3072
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+LABELV $3073
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $3074
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $3074
+ADDRGP4 $3070
+JUMPV
+LABELV $3074
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3076
+ADDRLP4 28
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+LSHI4
+BANDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+LSHI4
+BANDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+LSHI4
+BANDI4
+ASGNI4
+ADDRGP4 $3077
+JUMPV
+LABELV $3076
+ADDRLP4 28
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRGP4 cg+607196+312
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRGP4 cg+607196+312
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRGP4 cg+607196+312
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3077
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3086
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $3087
+JUMPV
+LABELV $3086
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $3088
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $3089
+JUMPV
+LABELV $3088
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $3090
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $3090
+LABELV $3089
+LABELV $3087
+LABELV $3070
+endproc CG_DrawPlayerHasFlag 40 24
+proc CG_DrawAreaSystemChat 8 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 systemChat
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $3092
+endproc CG_DrawAreaSystemChat 8 36
+proc CG_DrawAreaTeamChat 8 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 teamChat1
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $3093
+endproc CG_DrawAreaTeamChat 8 36
+proc CG_DrawAreaChat 8 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 teamChat2
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $3094
+endproc CG_DrawAreaChat 8 36
+export CG_GetKillerText
+proc CG_GetKillerText 8 8
+ADDRLP4 0
+ADDRGP4 $3096
+ASGNP4
+ADDRGP4 cg+617036
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3097
+ADDRGP4 $3100
+ARGP4
+ADDRGP4 cg+617036
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $3097
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $3095
+endproc CG_GetKillerText 8 8
+proc CG_DrawKiller 56 36
+ADDRGP4 cg+617036
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3103
+ADDRLP4 16
+ADDRGP4 CG_GetKillerText
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $3106
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1069547520
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 24
+INDIRI4
+CNSTI4 1
+NEI4 $3107
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 48
+CNSTF4 1069547520
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRGP4 cg+617068
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $3108
+JUMPV
+LABELV $3107
+ADDRFP4 24
+INDIRI4
+CNSTI4 2
+NEI4 $3110
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+CNSTF4 1069547520
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRGP4 cg+617068
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $3111
+JUMPV
+LABELV $3110
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3113
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 48
+CNSTF4 1069547520
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRGP4 cg+617068
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $3114
+JUMPV
+LABELV $3113
+ADDRGP4 $3116
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3114
+LABELV $3111
+LABELV $3108
+LABELV $3103
+LABELV $3102
+endproc CG_DrawKiller 56 36
+proc CG_DrawCapFragLimit 8 36
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $3124
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $3124
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3118
+LABELV $3124
+ADDRLP4 0
+ADDRGP4 cgs+39708
+INDIRI4
+ASGNI4
+ADDRGP4 $3119
+JUMPV
+LABELV $3118
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+EQI4 $3132
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $3132
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $3126
+LABELV $3132
+ADDRLP4 0
+ADDRGP4 cgs+39720
+INDIRI4
+ASGNI4
+ADDRGP4 $3127
+JUMPV
+LABELV $3126
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $3138
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $3134
+LABELV $3138
+ADDRGP4 cgs+39716
+INDIRI4
+CNSTI4 0
+EQI4 $3139
+ADDRLP4 0
+ADDRGP4 cgs+39716
+INDIRI4
+ASGNI4
+ADDRGP4 $3135
+JUMPV
+LABELV $3139
+ADDRLP4 0
+ADDRGP4 cgs+39720
+INDIRI4
+ASGNI4
+ADDRGP4 $3135
+JUMPV
+LABELV $3134
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+EQI4 $3148
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $3144
+LABELV $3148
+ADDRLP4 0
+ADDRGP4 cgs+39700
+INDIRI4
+ASGNI4
+ADDRGP4 $3145
+JUMPV
+LABELV $3144
+ADDRLP4 0
+ADDRGP4 cgs+39704
+INDIRI4
+ASGNI4
+LABELV $3145
+LABELV $3135
+LABELV $3127
+LABELV $3119
+ADDRGP4 $3151
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $3117
+endproc CG_DrawCapFragLimit 8 36
+proc CG_Draw1stPlace 20 36
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3153
+ADDRLP4 0
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+ADDRGP4 $3154
+JUMPV
+LABELV $3153
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+LEI4 $3158
+ADDRLP4 0
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+ADDRGP4 $3159
+JUMPV
+LABELV $3158
+ADDRLP4 0
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+LABELV $3159
+LABELV $3154
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $3164
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $3169
+ADDRLP4 8
+INDIRI4
+CNSTI4 2147483647
+LTI4 $3167
+LABELV $3169
+ADDRGP4 $554
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $3165
+JUMPV
+LABELV $3167
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $3165
+JUMPV
+LABELV $3164
+ADDRGP4 $289
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $3165
+LABELV $3152
+endproc CG_Draw1stPlace 20 36
+proc CG_Draw2ndPlace 24 36
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3175
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3171
+LABELV $3175
+ADDRLP4 8
+ADDRGP4 CG_NumPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+GEI4 $3176
+ADDRGP4 $3170
+JUMPV
+LABELV $3176
+LABELV $3171
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $3178
+ADDRLP4 0
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+ADDRGP4 $3179
+JUMPV
+LABELV $3178
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+GEI4 $3183
+ADDRLP4 0
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+ADDRGP4 $3184
+JUMPV
+LABELV $3183
+ADDRLP4 0
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+LABELV $3184
+LABELV $3179
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $3189
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $3194
+ADDRLP4 12
+INDIRI4
+CNSTI4 2147483647
+LTI4 $3192
+LABELV $3194
+ADDRGP4 $554
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $3190
+JUMPV
+LABELV $3192
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $3190
+JUMPV
+LABELV $3189
+ADDRGP4 $289
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $3190
+LABELV $3170
+endproc CG_Draw2ndPlace 24 36
+export CG_GetGameStatusText
+proc CG_GetGameStatusText 36 12
+ADDRLP4 0
+ADDRGP4 $3096
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3196
+ADDRLP4 8
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $3203
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $3199
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3199
+LABELV $3203
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $3197
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $3207
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $3197
+JUMPV
+LABELV $3199
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $3197
+ADDRLP4 16
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3215
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $3217
+CNSTI4 4524
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3221
+ADDRGP4 $3218
+JUMPV
+LABELV $3221
+CNSTI4 4524
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $3224
+ADDRGP4 $3218
+JUMPV
+LABELV $3224
+ADDRLP4 28
+CNSTI4 4524
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+LEI4 $3228
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3228
+LABELV $3218
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+LTI4 $3217
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $3207
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $3195
+JUMPV
+LABELV $3215
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+EQI4 $3242
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 15
+NEI4 $3238
+LABELV $3242
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+NEI4 $3243
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $3207
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $3244
+JUMPV
+LABELV $3243
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3248
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $3207
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $3249
+JUMPV
+LABELV $3248
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $3207
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $3249
+LABELV $3244
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $3195
+JUMPV
+LABELV $3238
+ADDRLP4 0
+ADDRGP4 $3096
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $3195
+JUMPV
+LABELV $3196
+ADDRGP4 cg+610860
+INDIRI4
+ADDRGP4 cg+610860+4
+INDIRI4
+NEI4 $3253
+ADDRGP4 $3258
+ARGP4
+ADDRGP4 cg+610860
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $3254
+JUMPV
+LABELV $3253
+ADDRGP4 cg+610860
+INDIRI4
+ADDRGP4 cg+610860+4
+INDIRI4
+LTI4 $3260
+ADDRGP4 $3265
+ARGP4
+ADDRGP4 cg+610860
+INDIRI4
+ARGI4
+ADDRGP4 cg+610860+4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $3261
+JUMPV
+LABELV $3260
+ADDRGP4 $3269
+ARGP4
+ADDRGP4 cg+610860+4
+INDIRI4
+ARGI4
+ADDRGP4 cg+610860
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $3261
+LABELV $3254
+LABELV $3197
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $3195
+endproc CG_GetGameStatusText 36 12
+proc CG_DrawGameStatus 40 36
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 20
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_GetGameStatusText
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $3273
+endproc CG_DrawGameStatus 40 36
+export CG_GameTypeString
+proc CG_GameTypeString 0 0
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+NEI4 $3276
+ADDRGP4 $3279
+RETP4
+ADDRGP4 $3275
+JUMPV
+LABELV $3276
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+NEI4 $3280
+ADDRGP4 $3283
+RETP4
+ADDRGP4 $3275
+JUMPV
+LABELV $3280
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $3284
+ADDRGP4 $3287
+RETP4
+ADDRGP4 $3275
+JUMPV
+LABELV $3284
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+NEI4 $3288
+ADDRGP4 $3291
+RETP4
+ADDRGP4 $3275
+JUMPV
+LABELV $3288
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $3292
+ADDRGP4 $3295
+RETP4
+ADDRGP4 $3275
+JUMPV
+LABELV $3292
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $3296
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $3299
+ADDRGP4 $3302
+RETP4
+ADDRGP4 $3275
+JUMPV
+LABELV $3299
+ADDRGP4 $3303
+RETP4
+ADDRGP4 $3275
+JUMPV
+LABELV $3296
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 7
+NEI4 $3304
+ADDRGP4 $3307
+RETP4
+ADDRGP4 $3275
+JUMPV
+LABELV $3304
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $3308
+ADDRGP4 $3311
+RETP4
+ADDRGP4 $3275
+JUMPV
+LABELV $3308
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $3312
+ADDRGP4 $3315
+RETP4
+ADDRGP4 $3275
+JUMPV
+LABELV $3312
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+NEI4 $3316
+ADDRGP4 $3319
+RETP4
+ADDRGP4 $3275
+JUMPV
+LABELV $3316
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3320
+ADDRGP4 $3323
+RETP4
+ADDRGP4 $3275
+JUMPV
+LABELV $3320
+ADDRGP4 $3096
+RETP4
+LABELV $3275
+endproc CG_GameTypeString 0 0
+export CG_Text_Length
+proc CG_Text_Length 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3326
+JUMPV
+LABELV $3325
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3328
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $3328
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $3328
+ADDRLP4 8
+INDIRI4
+CNSTI4 65
+LTI4 $3331
+ADDRLP4 8
+INDIRI4
+CNSTI4 90
+LEI4 $3330
+LABELV $3331
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 97
+LTI4 $3332
+ADDRLP4 12
+INDIRI4
+CNSTI4 122
+LEI4 $3330
+LABELV $3332
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+LTI4 $3328
+ADDRLP4 16
+INDIRI4
+CNSTI4 57
+GTI4 $3328
+LABELV $3330
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $3333
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 120
+EQI4 $3338
+ADDRLP4 20
+INDIRI4
+CNSTI4 88
+NEI4 $3336
+LABELV $3338
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $3329
+JUMPV
+LABELV $3336
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $3329
+JUMPV
+LABELV $3333
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $3329
+JUMPV
+LABELV $3328
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+pop
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $3329
+LABELV $3326
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3325
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $3324
+endproc CG_Text_Length 32 12
+export CG_Text_Paint_Limit
+proc CG_Text_Paint_Limit 208 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 116
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRFP4 32
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $3342
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $3340
+ADDRLP4 124
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 100
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRGP4 $3341
+JUMPV
+LABELV $3340
+ADDRFP4 32
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $3345
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $3343
+ADDRLP4 100
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $3344
+JUMPV
+LABELV $3343
+ADDRFP4 32
+INDIRP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRGP4 $3348
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $3346
+ADDRLP4 100
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 112
+CNSTF4 1077936128
+ASGNF4
+LABELV $3346
+LABELV $3344
+LABELV $3341
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3349
+ADDRLP4 132
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg_qlFontScaling+12
+INDIRI4
+CNSTI4 0
+EQI4 $3351
+ADDRFP4 32
+INDIRP4
+CVPU4 4
+ADDRGP4 cgDC+236+12
+CVPU4 4
+NEU4 $3351
+ADDRFP4 12
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $3356
+ADDRFP4 32
+ADDRGP4 cgDC+236+21680
+ASGNP4
+ADDRGP4 $3357
+JUMPV
+LABELV $3356
+ADDRFP4 12
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $3361
+ADDRFP4 32
+ADDRGP4 cgDC+236+43348
+ASGNP4
+LABELV $3361
+LABELV $3357
+LABELV $3351
+ADDRLP4 136
+ADDRFP4 12
+INDIRF4
+ADDRFP4 32
+INDIRP4
+CNSTI4 21528
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 148
+ADDRGP4 CG_ScaleFont
+CALLP4
+ASGNP4
+ADDRFP4 32
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_Text_Length
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 156
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+LEI4 $3366
+ADDRLP4 108
+INDIRI4
+ADDRLP4 156
+INDIRI4
+LEI4 $3366
+ADDRLP4 108
+ADDRFP4 28
+INDIRI4
+ASGNI4
+LABELV $3366
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3369
+JUMPV
+LABELV $3368
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRLP4 172
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_GetGlyphInfo
+CALLI4
+pop
+ADDRLP4 132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3371
+ADDRLP4 132
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $3371
+ADDRLP4 180
+ADDRLP4 132
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $3371
+ADDRLP4 180
+INDIRI4
+CNSTI4 65
+LTI4 $3374
+ADDRLP4 180
+INDIRI4
+CNSTI4 90
+LEI4 $3373
+LABELV $3374
+ADDRLP4 184
+ADDRLP4 132
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 97
+LTI4 $3375
+ADDRLP4 184
+INDIRI4
+CNSTI4 122
+LEI4 $3373
+LABELV $3375
+ADDRLP4 188
+ADDRLP4 132
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 48
+LTI4 $3371
+ADDRLP4 188
+INDIRI4
+CNSTI4 57
+GTI4 $3371
+LABELV $3373
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $3376
+ADDRLP4 132
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRGP4 CG_CpmaColorFromString
+CALLV
+pop
+ADDRGP4 $3377
+JUMPV
+LABELV $3376
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $3379
+ADDRLP4 132
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRGP4 CG_OspColorFromString
+CALLV
+pop
+ADDRGP4 $3380
+JUMPV
+LABELV $3379
+ADDRLP4 84
+ARGP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $3380
+LABELV $3377
+ADDRLP4 84+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 132
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 55
+NEI4 $3383
+ADDRLP4 84
+ADDRFP4 16
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $3383
+ADDRLP4 84
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $3385
+ADDRLP4 192
+ADDRLP4 132
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 120
+EQI4 $3390
+ADDRLP4 192
+INDIRI4
+CNSTI4 88
+NEI4 $3388
+LABELV $3390
+ADDRLP4 132
+ADDRLP4 132
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $3369
+JUMPV
+LABELV $3388
+ADDRLP4 132
+ADDRLP4 132
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $3369
+JUMPV
+LABELV $3385
+ADDRLP4 132
+ADDRLP4 132
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $3369
+JUMPV
+LABELV $3371
+ADDRLP4 192
+ADDRLP4 136
+INDIRF4
+ADDRLP4 0+4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 136
+INDIRF4
+ADDRLP4 0+16
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0+20
+INDIRI4
+CVIF4 4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 24
+INDIRF4
+ADDF4
+ADDRLP4 140
+INDIRF4
+LEF4 $3393
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $3370
+JUMPV
+LABELV $3393
+ADDRFP4 4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0+24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0+28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 200
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0+32
+INDIRF4
+ARGF4
+ADDRLP4 0+36
+INDIRF4
+ARGF4
+ADDRLP4 0+40
+INDIRF4
+ARGF4
+ADDRLP4 0+44
+INDIRF4
+ARGF4
+ADDRLP4 0+48
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintCharScale
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0+20
+INDIRI4
+CVIF4 4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDRFP4 24
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 204
+CNSTI4 1
+ASGNI4
+ADDRLP4 104
+ADDRLP4 104
+INDIRI4
+ADDRLP4 204
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 132
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 132
+ADDRLP4 160
+INDIRI4
+ADDRLP4 204
+INDIRI4
+SUBI4
+ADDRLP4 132
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $3369
+ADDRLP4 132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3405
+ADDRLP4 132
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3405
+ADDRLP4 104
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $3368
+LABELV $3405
+LABELV $3370
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $3349
+LABELV $3339
+endproc CG_Text_Paint_Limit 208 44
+export CG_Text_Paint_Limit_Bottom
+proc CG_Text_Paint_Limit_Bottom 8 36
+ADDRGP4 $3407
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+LABELV $3406
+endproc CG_Text_Paint_Limit_Bottom 8 36
+export CG_Text_Paint_Align
+proc CG_Text_Paint_Align 12 36
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $3409
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $3408
+JUMPV
+LABELV $3409
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 32
+INDIRI4
+CNSTI4 1
+NEI4 $3411
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $3408
+JUMPV
+LABELV $3411
+ADDRFP4 32
+INDIRI4
+CNSTI4 2
+NEI4 $3413
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $3408
+JUMPV
+LABELV $3413
+ADDRGP4 $3415
+ARGP4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3408
+endproc CG_Text_Paint_Align 12 36
+proc CG_DrawNewTeamInfo 116 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3417
+ADDRLP4 72
+CNSTI4 4524
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+EQI4 $3417
+ADDRGP4 $3416
+JUMPV
+LABELV $3417
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CNSTI4 8
+LEI4 $3426
+ADDRLP4 76
+CNSTI4 8
+ASGNI4
+ADDRGP4 $3427
+JUMPV
+LABELV $3426
+ADDRLP4 76
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+LABELV $3427
+ADDRLP4 32
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3431
+JUMPV
+LABELV $3428
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $3433
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+NEI4 $3433
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 64
+INDIRF4
+LEF4 $3436
+ADDRLP4 64
+ADDRLP4 28
+INDIRF4
+ASGNF4
+LABELV $3436
+LABELV $3433
+LABELV $3429
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3431
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $3428
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $3438
+ADDRLP4 8
+INDIRI4
+CNSTI4 593
+ADDI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3442
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3442
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 68
+INDIRF4
+LEF4 $3444
+ADDRLP4 68
+ADDRLP4 28
+INDIRF4
+ASGNF4
+LABELV $3444
+LABELV $3442
+LABELV $3439
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $3438
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3449
+JUMPV
+LABELV $3446
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $3451
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+NEI4 $3451
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3457
+JUMPV
+LABELV $3454
+ADDRLP4 4
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $3458
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3460
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 92
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+ADDI4
+ASGNI4
+LABELV $3460
+LABELV $3458
+LABELV $3455
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3457
+ADDRLP4 0
+INDIRI4
+ADDRGP4 PW_NUM_POWERUPS
+INDIRI4
+LEI4 $3454
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1108344832
+ADDF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492444
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+ADDI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+632840
+INDIRI4
+CNSTI4 0
+EQI4 $3464
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+632844
+INDIRI4
+CNSTI4 2500
+SUBI4
+LEI4 $3467
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3467
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3465
+JUMPV
+LABELV $3467
+ADDRGP4 cgs+632836
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $3465
+JUMPV
+LABELV $3464
+ADDRLP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 92
+INDIRI4
+ASGNI4
+LABELV $3465
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $3473
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 92
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $3473
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+ADDI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 92
+INDIRF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 593
+ADDI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3477
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3475
+LABELV $3477
+ADDRLP4 20
+ADDRGP4 $493
+ASGNP4
+LABELV $3475
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+CNSTF4 1073741824
+ADDF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+ADDRLP4 108
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $3478
+ADDRGP4 $3448
+JUMPV
+LABELV $3478
+LABELV $3451
+LABELV $3447
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3449
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $3446
+LABELV $3448
+LABELV $3416
+endproc CG_DrawNewTeamInfo 116 36
+proc CG_DrawTeamSpectators 56 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 cg+618124
+INDIRI4
+CNSTI4 0
+NEI4 $3481
+ADDRGP4 $3480
+JUMPV
+LABELV $3481
+ADDRGP4 cg+617100
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 cg+618128
+INDIRF4
+CNSTF4 3212836864
+NEF4 $3485
+ADDRGP4 cg+618128
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+618136
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+618140
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+618144
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+618148
+CNSTI4 0
+ASGNI4
+LABELV $3485
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+GEF4 $3493
+ADDRGP4 cg_scoreBoardSpectatorScroll+12
+INDIRI4
+CNSTI4 0
+NEI4 $3495
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg+617100
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+ADDRGP4 $3480
+JUMPV
+LABELV $3495
+LABELV $3493
+ADDRGP4 cg+617100
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 cg+618144
+INDIRI4
+CVIU4 4
+ADDRLP4 20
+INDIRU4
+LTU4 $3499
+ADDRGP4 cg+618144
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+618140
+INDIRI4
+CNSTI4 -1
+LEI4 $3504
+ADDRGP4 cg+618136
+ADDRGP4 cg+618140
+INDIRI4
+ASGNI4
+ADDRGP4 $3505
+JUMPV
+LABELV $3504
+ADDRGP4 cg+618136
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1065353216
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $3505
+ADDRGP4 cg+618140
+CNSTI4 -1
+ASGNI4
+LABELV $3499
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+618132
+INDIRI4
+LEI4 $3511
+ADDRGP4 cg+618132
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRGP4 cg+618136
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+GTF4 $3517
+ADDRGP4 cg+617100
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 cg+618144
+INDIRI4
+CVIU4 4
+ADDRLP4 24
+INDIRU4
+GEU4 $3520
+ADDRGP4 cg+618148
+INDIRI4
+CNSTI4 0
+GTI4 $3524
+ADDRGP4 $3528
+JUMPV
+LABELV $3527
+ADDRGP4 cg+618144
+INDIRI4
+ADDRGP4 cg+617100
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $3529
+ADDRGP4 cg+618156
+ADDRGP4 cg+618144
+INDIRI4
+ADDRGP4 cg+617100+1
+ADDP4
+INDIRI1
+ASGNI1
+ADDRGP4 cg+617100
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 cg+618144
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIU4 4
+ADDRLP4 28
+INDIRU4
+GEU4 $3538
+ADDRLP4 32
+ADDRGP4 cg+618144
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $3531
+JUMPV
+LABELV $3538
+ADDRGP4 cg+618144
+INDIRI4
+ADDRGP4 cg+617100
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+pop
+ADDRLP4 32
+ADDRGP4 cg+618144
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $3531
+LABELV $3528
+ADDRGP4 $3527
+JUMPV
+LABELV $3529
+ADDRGP4 cg+618144
+INDIRI4
+ADDRGP4 cg+617100
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRGP4 cg+618148
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cg+618136
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ADDRGP4 cg+618148
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cg+618144
+INDIRI4
+ADDRGP4 cg+617100
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+pop
+ADDRLP4 36
+ADDRGP4 cg+618144
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $3518
+JUMPV
+LABELV $3524
+ADDRLP4 28
+ADDRGP4 cg+618148
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cg+618136
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cg+618140
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $3518
+JUMPV
+LABELV $3520
+ADDRGP4 cg+618144
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+618140
+INDIRI4
+CNSTI4 0
+LTI4 $3558
+ADDRGP4 cg+618136
+ADDRGP4 cg+618140
+INDIRI4
+ASGNI4
+ADDRGP4 $3559
+JUMPV
+LABELV $3558
+ADDRGP4 cg+618136
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $3559
+ADDRGP4 cg+618140
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3518
+JUMPV
+LABELV $3517
+ADDRLP4 24
+ADDRGP4 cg+618136
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+618140
+INDIRI4
+CNSTI4 0
+LTI4 $3566
+ADDRLP4 28
+ADDRGP4 cg+618140
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $3566
+LABELV $3518
+LABELV $3511
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRGP4 $3571
+ARGP4
+ADDRGP4 cg+618156
+INDIRI1
+CVII4 1
+ARGI4
+ADDRGP4 cg+618144
+INDIRI4
+ADDRGP4 cg+617100
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+618136
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+ADDRGP4 cg+618140
+INDIRI4
+CNSTI4 0
+LTI4 $3575
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRGP4 cg+618144
+INDIRI4
+ADDRGP4 cg+617100
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRGP4 cg+618136
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ADDRGP4 cg+618140
+INDIRI4
+CVIF4 4
+LEF4 $3580
+ADDRGP4 cg+618140
+ADDRGP4 cg+618136
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $3580
+ADDRLP4 36
+ARGP4
+ADDRGP4 cg+618140
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg+617100
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 cg+618144
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+LABELV $3575
+ADDRGP4 cg+618144
+INDIRI4
+CNSTI4 0
+EQI4 $3589
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $3589
+ADDRGP4 cg+618140
+INDIRI4
+CNSTI4 -1
+GTI4 $3590
+ADDRGP4 cg+618140
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $3590
+JUMPV
+LABELV $3589
+ADDRGP4 cg+618140
+CNSTI4 -1
+ASGNI4
+LABELV $3590
+LABELV $3480
+endproc CG_DrawTeamSpectators 56 36
+proc CG_DrawMedal 60 36
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 92
+ADDRGP4 cg+610856
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+LTI4 $3604
+ADDRLP4 36
+INDIRI4
+CNSTI4 74
+GTI4 $3604
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3614-256
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3614
+address $3606
+address $3607
+address $3613
+address $3604
+address $3608
+address $3609
+address $3612
+address $3610
+address $3604
+address $3604
+address $3611
+code
+LABELV $3606
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $3605
+JUMPV
+LABELV $3607
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $3605
+JUMPV
+LABELV $3608
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $3605
+JUMPV
+LABELV $3609
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $3605
+JUMPV
+LABELV $3610
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $3605
+JUMPV
+LABELV $3611
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $3605
+JUMPV
+LABELV $3612
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $3605
+JUMPV
+LABELV $3613
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $3604
+LABELV $3605
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+LEF4 $3616
+ADDRFP4 0
+INDIRI4
+CNSTI4 74
+EQI4 $3618
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+NEI4 $3620
+ADDRGP4 $3622
+ARGP4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1112014848
+LEF4 $3619
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $3619
+JUMPV
+LABELV $3620
+ADDRGP4 $289
+ARGP4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $3619
+JUMPV
+LABELV $3618
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+EQF4 $3627
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $3627
+ADDRLP4 16
+ADDRGP4 $3630
+ASGNP4
+LABELV $3619
+LABELV $3616
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3631
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1069547520
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 52
+CNSTF4 1073741824
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+DIVF4
+ADDF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 52
+INDIRF4
+DIVF4
+ADDF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $3631
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $3597
+endproc CG_DrawMedal 60 36
+proc CG_SetTeamColor 20 8
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3635
+ADDRLP4 16
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $3636
+JUMPV
+LABELV $3635
+ADDRLP4 16
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3636
+CNSTI4 4524
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3639
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg_hudRedTeamColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 $3640
+JUMPV
+LABELV $3639
+CNSTI4 4524
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3643
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg_hudBlueTeamColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 $3644
+JUMPV
+LABELV $3643
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg_hudNoTeamColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+LABELV $3644
+LABELV $3640
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $3634
+endproc CG_SetTeamColor 20 8
+proc CG_OspCalcPlacements 20 12
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+EQI4 $3649
+ADDRGP4 $3648
+JUMPV
+LABELV $3649
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43292
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $3652
+ADDRGP4 cgs+44316
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $3652
+ADDRGP4 $3648
+JUMPV
+LABELV $3652
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $3656
+ADDRGP4 cgs+43292
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3665
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $3670
+ADDRGP4 $3666
+JUMPV
+LABELV $3670
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3672
+ADDRGP4 $3666
+JUMPV
+LABELV $3672
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3675
+ADDRGP4 $3666
+JUMPV
+LABELV $3675
+ADDRGP4 cgs+44316
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $3657
+JUMPV
+LABELV $3666
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $3665
+ADDRGP4 $3657
+JUMPV
+LABELV $3656
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3679
+ADDRGP4 cgs+44316
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3688
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $3693
+ADDRGP4 $3689
+JUMPV
+LABELV $3693
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3695
+ADDRGP4 $3689
+JUMPV
+LABELV $3695
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3698
+ADDRGP4 $3689
+JUMPV
+LABELV $3698
+ADDRGP4 cgs+43292
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $3680
+JUMPV
+LABELV $3689
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $3688
+ADDRGP4 $3680
+JUMPV
+LABELV $3679
+ADDRGP4 $3702
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3680
+LABELV $3657
+LABELV $3648
+endproc CG_OspCalcPlacements 20 12
+proc CG_Draw1stPlaceScore 208 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $3704
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $3704
+ADDRGP4 CG_OspCalcPlacements
+CALLV
+pop
+LABELV $3704
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3708
+ADDRLP4 160
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3709
+JUMPV
+LABELV $3708
+ADDRLP4 160
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3709
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $3714
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+EQI4 $3714
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $3718
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+NEI4 $3722
+ADDRGP4 cg_hudForceRedTeamClanTag+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3724
+ADDRLP4 8
+ADDRGP4 cg_hudForceRedTeamClanTag+16
+ASGNP4
+ADDRGP4 $3723
+JUMPV
+LABELV $3724
+ADDRGP4 $3728
+ARGP4
+ADDRGP4 cgs+39988
+ARGP4
+ADDRLP4 176
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRGP4 $3723
+JUMPV
+LABELV $3722
+ADDRGP4 cg_hudForceBlueTeamClanTag+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3730
+ADDRLP4 8
+ADDRGP4 cg_hudForceBlueTeamClanTag+16
+ASGNP4
+ADDRGP4 $3731
+JUMPV
+LABELV $3730
+ADDRGP4 $3728
+ARGP4
+ADDRGP4 cgs+40052
+ARGP4
+ADDRLP4 176
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 176
+INDIRP4
+ASGNP4
+LABELV $3731
+LABELV $3723
+ADDRLP4 148
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+ADDRGP4 $3719
+JUMPV
+LABELV $3718
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+LEI4 $3736
+ADDRGP4 cg_hudForceRedTeamClanTag+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3740
+ADDRLP4 8
+ADDRGP4 cg_hudForceRedTeamClanTag+16
+ASGNP4
+ADDRGP4 $3741
+JUMPV
+LABELV $3740
+ADDRGP4 $3728
+ARGP4
+ADDRGP4 cgs+39988
+ARGP4
+ADDRLP4 176
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 176
+INDIRP4
+ASGNP4
+LABELV $3741
+ADDRLP4 148
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+ADDRGP4 $3737
+JUMPV
+LABELV $3736
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+GEI4 $3746
+ADDRGP4 cg_hudForceBlueTeamClanTag+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3750
+ADDRLP4 8
+ADDRGP4 cg_hudForceBlueTeamClanTag+16
+ASGNP4
+ADDRGP4 $3751
+JUMPV
+LABELV $3750
+ADDRGP4 $3728
+ARGP4
+ADDRGP4 cgs+40052
+ARGP4
+ADDRLP4 176
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 176
+INDIRP4
+ASGNP4
+LABELV $3751
+ADDRLP4 148
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+ADDRGP4 $3747
+JUMPV
+LABELV $3746
+ADDRGP4 $3756
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 148
+CNSTI4 -100
+ASGNI4
+ADDRGP4 $3757
+ARGP4
+ADDRLP4 176
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 176
+INDIRP4
+ASGNP4
+LABELV $3747
+LABELV $3737
+LABELV $3719
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $3715
+JUMPV
+LABELV $3714
+ADDRLP4 172
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $3767
+ADDRLP4 172
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $3758
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3758
+LABELV $3767
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $3758
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $3758
+ADDRLP4 184
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3771
+ADDRGP4 $3773
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRGP4 $3759
+JUMPV
+LABELV $3771
+ADDRGP4 $3777
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRGP4 $3759
+JUMPV
+LABELV $3758
+ADDRLP4 184
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $3781
+ADDRGP4 cgs+39688
+INDIRI4
+ADDRLP4 188
+INDIRI4
+NEI4 $3781
+ADDRLP4 8
+ADDRGP4 $3096
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3784
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRGP4 cgs+43240
+INDIRI4
+NEI4 $3786
+ADDRGP4 $3792
+ARGP4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 196
+INDIRP4
+ASGNP4
+LABELV $3786
+LABELV $3784
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3782
+ADDRLP4 192
+CNSTI4 0
+ASGNI4
+LABELV $3798
+CNSTI4 4524
+ADDRLP4 192
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3802
+ADDRGP4 $3799
+JUMPV
+LABELV $3802
+CNSTI4 4524
+ADDRLP4 192
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3805
+ADDRGP4 $3799
+JUMPV
+LABELV $3805
+CNSTI4 4524
+ADDRLP4 192
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRGP4 cgs+43240
+INDIRI4
+NEI4 $3809
+ADDRGP4 $3792
+ARGP4
+CNSTI4 4524
+ADDRLP4 192
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRGP4 $3782
+JUMPV
+LABELV $3809
+LABELV $3799
+ADDRLP4 192
+ADDRLP4 192
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 64
+LTI4 $3798
+ADDRGP4 $3782
+JUMPV
+LABELV $3781
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 196
+CNSTI4 0
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $3816
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $3816
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $3816
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $3823
+ADDRLP4 200
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3829
+ADDRGP4 $3831
+ARGP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRGP4 $3817
+JUMPV
+LABELV $3829
+ADDRGP4 $3777
+ARGP4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRGP4 $3817
+JUMPV
+LABELV $3823
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRGP4 cgs+43240
+INDIRI4
+NEI4 $3838
+ADDRLP4 200
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3847
+ADDRGP4 $3831
+ARGP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRGP4 $3817
+JUMPV
+LABELV $3847
+ADDRGP4 $3777
+ARGP4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRGP4 $3817
+JUMPV
+LABELV $3838
+ADDRGP4 $3792
+ARGP4
+ADDRGP4 cgs+43292
+ARGP4
+ADDRLP4 200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRGP4 $3817
+JUMPV
+LABELV $3816
+ADDRGP4 $3792
+ARGP4
+ADDRGP4 cgs+43292
+ARGP4
+ADDRLP4 200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 200
+INDIRP4
+ASGNP4
+LABELV $3817
+LABELV $3782
+LABELV $3759
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+LABELV $3715
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 -9999
+NEI4 $3858
+ADDRLP4 8
+ADDRGP4 $3860
+ASGNP4
+LABELV $3858
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $3861
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_GetTimeString
+CALLP4
+ASGNP4
+ADDRLP4 164
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $3728
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $3862
+JUMPV
+LABELV $3861
+ADDRLP4 148
+INDIRI4
+CNSTI4 -9999
+NEI4 $3864
+ADDRLP4 20
+CNSTI1 0
+ASGNI1
+ADDRGP4 $3865
+JUMPV
+LABELV $3864
+ADDRLP4 20
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $3865
+LABELV $3862
+ADDRLP4 20
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 172
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 152
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 176
+INDIRU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3867
+JUMPV
+LABELV $3866
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $3867
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+LEI4 $3869
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+GTF4 $3866
+LABELV $3869
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3870
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 188
+INDIRU4
+CNSTU4 3
+LEU4 $3870
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 46
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 46
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 46
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 55
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 32
+ASGNI1
+LABELV $3870
+ADDRLP4 196
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+ADDRLP4 152
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1086324736
+SUBF4
+CVFI4 4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $3703
+endproc CG_Draw1stPlaceScore 208 36
+proc CG_Draw2ndPlaceScore 244 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $3873
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $3873
+ADDRGP4 CG_OspCalcPlacements
+CALLV
+pop
+LABELV $3873
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $3881
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3877
+LABELV $3881
+ADDRLP4 192
+ADDRGP4 CG_NumPlayers
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 2
+GEI4 $3882
+ADDRGP4 $3872
+JUMPV
+LABELV $3882
+LABELV $3877
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3884
+ADDRLP4 164
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3885
+JUMPV
+LABELV $3884
+ADDRLP4 164
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3885
+ADDRLP4 160
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $3891
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+EQI4 $3891
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $3895
+ADDRLP4 160
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3896
+JUMPV
+LABELV $3895
+ADDRLP4 160
+CNSTI4 2
+ASGNI4
+LABELV $3896
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $3899
+ADDRLP4 164
+INDIRI4
+CNSTI4 1
+NEI4 $3903
+ADDRGP4 cg_hudForceBlueTeamClanTag+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3905
+ADDRLP4 8
+ADDRGP4 cg_hudForceBlueTeamClanTag+16
+ASGNP4
+ADDRGP4 $3904
+JUMPV
+LABELV $3905
+ADDRGP4 $3728
+ARGP4
+ADDRGP4 cgs+40052
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRGP4 $3904
+JUMPV
+LABELV $3903
+ADDRGP4 cg_hudForceRedTeamClanTag+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3910
+ADDRLP4 8
+ADDRGP4 cg_hudForceRedTeamClanTag+16
+ASGNP4
+ADDRGP4 $3911
+JUMPV
+LABELV $3910
+ADDRGP4 $3728
+ARGP4
+ADDRGP4 cgs+39988
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 204
+INDIRP4
+ASGNP4
+LABELV $3911
+LABELV $3904
+ADDRLP4 148
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+ADDRGP4 $3892
+JUMPV
+LABELV $3899
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+GEI4 $3916
+ADDRGP4 cg_hudForceRedTeamClanTag+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3920
+ADDRLP4 8
+ADDRGP4 cg_hudForceRedTeamClanTag+16
+ASGNP4
+ADDRGP4 $3921
+JUMPV
+LABELV $3920
+ADDRGP4 $3728
+ARGP4
+ADDRGP4 cgs+39988
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 204
+INDIRP4
+ASGNP4
+LABELV $3921
+ADDRLP4 148
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+ADDRGP4 $3892
+JUMPV
+LABELV $3916
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+LEI4 $3926
+ADDRGP4 cg_hudForceBlueTeamClanTag+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3930
+ADDRLP4 8
+ADDRGP4 cg_hudForceBlueTeamClanTag+16
+ASGNP4
+ADDRGP4 $3931
+JUMPV
+LABELV $3930
+ADDRGP4 $3728
+ARGP4
+ADDRGP4 cgs+40052
+ARGP4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 204
+INDIRP4
+ASGNP4
+LABELV $3931
+ADDRLP4 148
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+ADDRGP4 $3892
+JUMPV
+LABELV $3926
+ADDRGP4 $3936
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 148
+CNSTI4 -100
+ASGNI4
+ADDRGP4 $3892
+JUMPV
+LABELV $3891
+ADDRLP4 196
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+ADDRLP4 196
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $3946
+ADDRLP4 196
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $3937
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3937
+LABELV $3946
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $3937
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $3937
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRLP4 208
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $3947
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+ADDRGP4 cgs+44316
+ASGNP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 $3953
+ARGP4
+ADDRLP4 220
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 184
+ADDRLP4 220
+INDIRP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 176
+ADDRLP4 224
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 180
+ADDRLP4 228
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 180
+INDIRI4
+LTI4 $3954
+ADDRLP4 172
+ADDRLP4 176
+INDIRI4
+ADDRLP4 172
+INDIRP4
+ADDP4
+ADDRLP4 180
+INDIRI4
+SUBP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+NEI4 $3956
+ADDRLP4 212
+CNSTI4 1
+ASGNI4
+LABELV $3956
+LABELV $3954
+ADDRLP4 176
+INDIRI4
+ADDRLP4 180
+INDIRI4
+LEI4 $3958
+ADDRLP4 172
+INDIRP4
+CNSTI4 -1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $3960
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+LABELV $3960
+LABELV $3958
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+EQI4 $3962
+ADDRGP4 $3964
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+43292
+ARGP4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRGP4 $3948
+JUMPV
+LABELV $3962
+ADDRGP4 $3964
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+44316
+ARGP4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRGP4 $3948
+JUMPV
+LABELV $3947
+ADDRGP4 $3967
+ARGP4
+ADDRGP4 cgs+44316
+ARGP4
+ADDRLP4 212
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 212
+INDIRP4
+ASGNP4
+LABELV $3948
+ADDRLP4 148
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3938
+JUMPV
+LABELV $3937
+ADDRLP4 208
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 212
+INDIRI4
+EQI4 $3977
+ADDRLP4 208
+INDIRI4
+ADDRLP4 212
+INDIRI4
+EQI4 $3970
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3970
+LABELV $3977
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $3970
+ADDRLP4 216
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3981
+ADDRGP4 $3983
+ARGP4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRLP4 216
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 220
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 220
+INDIRP4
+ASGNP4
+ADDRGP4 $3982
+JUMPV
+LABELV $3981
+ADDRGP4 $3987
+ARGP4
+ADDRLP4 160
+INDIRI4
+ARGI4
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 220
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 220
+INDIRP4
+ASGNP4
+LABELV $3982
+ADDRLP4 148
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3971
+JUMPV
+LABELV $3970
+ADDRLP4 216
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 220
+CNSTI4 0
+ASGNI4
+ADDRLP4 216
+INDIRI4
+ADDRLP4 220
+INDIRI4
+EQI4 $3992
+ADDRGP4 cgs+39688
+INDIRI4
+ADDRLP4 220
+INDIRI4
+NEI4 $3992
+ADDRLP4 8
+ADDRGP4 $3096
+ASGNP4
+ADDRLP4 148
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3996
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRGP4 cgs+43240
+INDIRI4
+NEI4 $3998
+ADDRLP4 224
+CNSTI4 0
+ASGNI4
+LABELV $4004
+ADDRLP4 224
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $4008
+ADDRGP4 $4005
+JUMPV
+LABELV $4008
+CNSTI4 4524
+ADDRLP4 224
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4011
+ADDRGP4 $4005
+JUMPV
+LABELV $4011
+CNSTI4 4524
+ADDRLP4 224
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4014
+ADDRGP4 $4005
+JUMPV
+LABELV $4014
+CNSTI4 4524
+ADDRLP4 224
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+NEI4 $4018
+ADDRGP4 $3967
+ARGP4
+CNSTI4 4524
+ADDRLP4 224
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 228
+INDIRP4
+ASGNP4
+ADDRGP4 $3993
+JUMPV
+LABELV $4018
+LABELV $4005
+ADDRLP4 224
+ADDRLP4 224
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 64
+LTI4 $4004
+ADDRGP4 $3993
+JUMPV
+LABELV $3998
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+NEI4 $4025
+ADDRGP4 $3967
+ARGP4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 228
+INDIRP4
+ASGNP4
+ADDRGP4 $3993
+JUMPV
+LABELV $4025
+ADDRLP4 228
+CNSTI4 1
+ASGNI4
+ADDRLP4 224
+CNSTI4 0
+ASGNI4
+LABELV $4034
+CNSTI4 4524
+ADDRLP4 224
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4038
+ADDRGP4 $4035
+JUMPV
+LABELV $4038
+CNSTI4 4524
+ADDRLP4 224
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4041
+ADDRGP4 $4035
+JUMPV
+LABELV $4041
+ADDRLP4 232
+CNSTI4 4524
+ASGNI4
+ADDRLP4 232
+INDIRI4
+ADDRLP4 224
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRLP4 232
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+LEI4 $4045
+ADDRLP4 228
+ADDRLP4 228
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4045
+LABELV $4035
+ADDRLP4 224
+ADDRLP4 224
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 64
+LTI4 $4034
+ADDRGP4 $3964
+ARGP4
+ADDRLP4 228
+INDIRI4
+ARGI4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRLP4 148
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3993
+JUMPV
+LABELV $3996
+ADDRLP4 228
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+NEI4 $4058
+ADDRLP4 228
+CNSTI4 1
+ASGNI4
+LABELV $4058
+ADDRLP4 224
+CNSTI4 0
+ASGNI4
+LABELV $4062
+CNSTI4 4524
+ADDRLP4 224
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4066
+ADDRGP4 $4063
+JUMPV
+LABELV $4066
+CNSTI4 4524
+ADDRLP4 224
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4069
+ADDRGP4 $4063
+JUMPV
+LABELV $4069
+CNSTI4 4524
+ADDRLP4 224
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+NEI4 $4073
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $4078
+ADDRLP4 228
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4063
+JUMPV
+LABELV $4078
+ADDRGP4 $3967
+ARGP4
+CNSTI4 4524
+ADDRLP4 224
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRGP4 $3993
+JUMPV
+LABELV $4073
+LABELV $4063
+ADDRLP4 224
+ADDRLP4 224
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 64
+LTI4 $4062
+ADDRGP4 $3993
+JUMPV
+LABELV $3992
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 228
+CNSTI4 0
+ASGNI4
+ADDRLP4 224
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $4082
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $4082
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $4082
+ADDRLP4 148
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $4090
+ADDRLP4 8
+ADDRGP4 $3096
+ASGNP4
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+LABELV $4093
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4097
+ADDRGP4 $4094
+JUMPV
+LABELV $4097
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4100
+ADDRGP4 $4094
+JUMPV
+LABELV $4100
+ADDRLP4 232
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $4104
+ADDRGP4 $4094
+JUMPV
+LABELV $4104
+ADDRLP4 236
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4109
+ADDRGP4 $3831
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 240
+INDIRP4
+ASGNP4
+ADDRGP4 $4083
+JUMPV
+LABELV $4109
+ADDRGP4 $3777
+ARGP4
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 240
+INDIRP4
+ASGNP4
+ADDRGP4 $4083
+JUMPV
+LABELV $4094
+ADDRLP4 232
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 64
+LTI4 $4093
+ADDRGP4 $4083
+JUMPV
+LABELV $4090
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRGP4 cgs+43240
+INDIRI4
+NEI4 $4115
+ADDRLP4 8
+ADDRGP4 $3096
+ASGNP4
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+LABELV $4121
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4125
+ADDRGP4 $4122
+JUMPV
+LABELV $4125
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $4128
+ADDRGP4 $4122
+JUMPV
+LABELV $4128
+ADDRLP4 232
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $4132
+ADDRGP4 $4122
+JUMPV
+LABELV $4132
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRGP4 cgs+43240
+INDIRI4
+EQI4 $4135
+ADDRGP4 $4122
+JUMPV
+LABELV $4135
+ADDRLP4 236
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4142
+ADDRGP4 $3831
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 240
+INDIRP4
+ASGNP4
+ADDRGP4 $4083
+JUMPV
+LABELV $4142
+ADDRGP4 $3777
+ARGP4
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 240
+INDIRP4
+ASGNP4
+ADDRGP4 $4083
+JUMPV
+LABELV $4122
+ADDRLP4 232
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 64
+LTI4 $4121
+ADDRGP4 $4083
+JUMPV
+LABELV $4115
+ADDRGP4 $3792
+ARGP4
+ADDRGP4 cgs+44316
+ARGP4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRGP4 $4083
+JUMPV
+LABELV $4082
+ADDRGP4 $4149
+ARGP4
+ADDRGP4 cgs+44316
+ARGP4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+LABELV $4083
+LABELV $3993
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $3971
+LABELV $3938
+LABELV $3892
+ADDRLP4 148
+INDIRI4
+CNSTI4 -9999
+NEI4 $4152
+ADDRLP4 8
+ADDRGP4 $4154
+ASGNP4
+LABELV $4152
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $4155
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_GetTimeString
+CALLP4
+ASGNP4
+ADDRLP4 168
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $3728
+ARGP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4156
+JUMPV
+LABELV $4155
+ADDRLP4 148
+INDIRI4
+CNSTI4 -9999
+NEI4 $4158
+ADDRLP4 20
+CNSTI1 0
+ASGNI1
+ADDRGP4 $4159
+JUMPV
+LABELV $4158
+ADDRLP4 20
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $4159
+LABELV $4156
+ADDRLP4 20
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 196
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 152
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 200
+INDIRU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4161
+JUMPV
+LABELV $4160
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $4161
+ADDRLP4 204
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 204
+INDIRI4
+LEI4 $4163
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 204
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+GTF4 $4160
+LABELV $4163
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $4164
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 212
+INDIRU4
+CNSTU4 3
+LEU4 $4164
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 46
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 46
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 46
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 55
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 32
+ASGNI1
+LABELV $4164
+ADDRLP4 220
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+SUBF4
+ADDRLP4 152
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1086324736
+SUBF4
+CVFI4 4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $3872
+endproc CG_Draw2ndPlaceScore 244 36
+proc CG_DrawObit 1112 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 1080
+ADDRGP4 cg_obituaryStack+12
+INDIRI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+GEI4 $4168
+ADDRLP4 1080
+CNSTI4 0
+ASGNI4
+LABELV $4168
+ADDRLP4 1080
+INDIRI4
+CNSTI4 100
+LEI4 $4170
+ADDRLP4 1080
+CNSTI4 100
+ASGNI4
+LABELV $4170
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 1076
+ADDRLP4 1080
+INDIRI4
+CNSTI4 1
+SUBI4
+NEGI4
+ASGNI4
+ADDRGP4 $4175
+JUMPV
+LABELV $4172
+ADDRGP4 cg+1226452
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+CNSTI4 0
+GEI4 $4176
+ADDRGP4 $4173
+JUMPV
+LABELV $4176
+ADDRLP4 1072
+CNSTI4 5148
+ADDRGP4 cg+1226452
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+CNSTI4 100
+MODI4
+MULI4
+ADDRGP4 cg+711652
+ADDP4
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+CNSTI4 4120
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4181
+ADDRGP4 $4173
+JUMPV
+LABELV $4181
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 1072
+INDIRP4
+CNSTI4 4120
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg_obituaryTime+12
+INDIRI4
+LEI4 $4183
+ADDRGP4 $4173
+JUMPV
+LABELV $4183
+CNSTI4 0
+ARGI4
+ADDRLP4 1076
+INDIRI4
+ARGI4
+ADDRLP4 1084
+ADDRGP4 CG_CreateFragString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1084
+INDIRP4
+ASGNP4
+ADDRGP4 $4188
+JUMPV
+LABELV $4187
+ADDRLP4 1092
+CNSTI4 0
+ASGNI4
+ADDRLP4 1096
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4190
+ADDRGP4 $4189
+JUMPV
+LABELV $4190
+ADDRLP4 1088
+ADDRGP4 tmpExtString
+ASGNP4
+ADDRGP4 $4193
+JUMPV
+LABELV $4192
+ADDRLP4 1100
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+LTI4 $4195
+ADDRLP4 1100
+INDIRI4
+CNSTI4 255
+GTI4 $4195
+ADDRLP4 1088
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4197
+ADDRGP4 $4194
+JUMPV
+LABELV $4197
+ADDRLP4 1104
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1104
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1088
+ADDRLP4 1088
+INDIRP4
+ADDRLP4 1104
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $4193
+JUMPV
+LABELV $4195
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 258
+NEI4 $4199
+ADDRLP4 1104
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1104
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1096
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1104
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1092
+CNSTI4 1
+ASGNI4
+ADDRLP4 1088
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4194
+JUMPV
+LABELV $4199
+ADDRLP4 1088
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 4
+ADDRLP4 1104
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1104
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1088
+ADDRLP4 1088
+INDIRP4
+ADDRLP4 1104
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 4
+ADDRLP4 1108
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1108
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1088
+ADDRLP4 1088
+INDIRP4
+ADDRLP4 1108
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4193
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4192
+LABELV $4194
+ADDRLP4 1088
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 48
+ASGNP4
+ADDRLP4 4
+ADDRGP4 tmpExtString
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4202
+JUMPV
+LABELV $4201
+ADDRLP4 1100
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+LTI4 $4204
+ADDRLP4 1100
+INDIRI4
+CNSTI4 255
+GTI4 $4204
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRGP4 $4202
+JUMPV
+LABELV $4204
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 256
+NEI4 $4206
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4206
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+LABELV $4202
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4201
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 44
+ADDRLP4 48
+ASGNP4
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 1072
+INDIRP4
+CNSTI4 4120
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cg_obituaryTime+12
+INDIRI4
+ADDRGP4 cg_obituaryFadeTime+12
+INDIRI4
+SUBI4
+LEI4 $4212
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cg_obituaryTime+12
+INDIRI4
+ADDRGP4 cg_obituaryFadeTime+12
+INDIRI4
+SUBI4
+SUBI4
+ASGNI4
+ADDRLP4 1104
+ADDRGP4 cg_obituaryFadeTime+12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg_obituaryFadeTime+12
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 16+12
+ADDRLP4 16+12
+INDIRF4
+ADDRLP4 1104
+INDIRF4
+MULF4
+ASGNF4
+LABELV $4212
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 1104
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 tmpExtString
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 cg_drawFragMessageStyle+12
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 cg_obituaryIconScale+8
+INDIRF4
+ARGF4
+ADDRGP4 CG_Text_Pic_Paint
+CALLV
+pop
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+EQI4 $4223
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 1096
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $4224
+JUMPV
+LABELV $4223
+ADDRGP4 cg_obituaryIconScale+8
+INDIRF4
+CNSTF4 1065353216
+LEF4 $4225
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRGP4 cg_obituaryIconScale+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $4226
+JUMPV
+LABELV $4225
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $4226
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+LABELV $4224
+LABELV $4188
+ADDRGP4 $4187
+JUMPV
+LABELV $4189
+LABELV $4173
+ADDRLP4 1076
+ADDRLP4 1076
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4175
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+LEI4 $4172
+LABELV $4166
+endproc CG_DrawObit 1112 44
+export CG_DrawWeaponBar
+proc CG_DrawWeaponBar 132 36
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4230
+ADDRGP4 $4229
+JUMPV
+LABELV $4230
+ADDRLP4 92
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $4233
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $4233
+ADDRGP4 $4229
+JUMPV
+LABELV $4233
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 4
+EQI4 $4239
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 5
+NEI4 $4235
+LABELV $4239
+ADDRGP4 CG_DrawWeaponSelect
+CALLV
+pop
+ADDRGP4 $4229
+JUMPV
+LABELV $4235
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 0
+NEI4 $4240
+ADDRGP4 $4229
+JUMPV
+LABELV $4240
+ADDRGP4 cg_weaponBarFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4243
+ADDRLP4 84
+ADDRGP4 cgs+632912+1013812
+ASGNP4
+ADDRGP4 $4244
+JUMPV
+LABELV $4243
+ADDRLP4 84
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $4244
+ADDRGP4 QLWideScreen
+ADDRGP4 cg_weaponBarWideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4251
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $4253
+ADDRGP4 $4229
+JUMPV
+LABELV $4253
+ADDRLP4 64
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4252
+JUMPV
+LABELV $4251
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+607196+184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $4259
+ADDRGP4 $4229
+JUMPV
+LABELV $4259
+ADDRLP4 64
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4252
+ADDRLP4 100
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4267
+ADDRLP4 104
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $4269
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $4269
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 80
+ADDRGP4 wcg+4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 8
+RSHI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 3
+BORI4
+ASGNI4
+ADDRGP4 $4268
+JUMPV
+LABELV $4269
+ADDRLP4 80
+CNSTI4 1
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRGP4 $4268
+JUMPV
+LABELV $4267
+ADDRLP4 80
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4268
+ADDRLP4 60
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $4277
+ADDRLP4 60
+CNSTI4 10
+ASGNI4
+LABELV $4277
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4283
+JUMPV
+LABELV $4280
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4284
+ADDRGP4 $4281
+JUMPV
+LABELV $4284
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $4286
+ADDRGP4 $4281
+JUMPV
+LABELV $4286
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4281
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4283
+ADDRLP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LTI4 $4280
+ADDRLP4 88
+CNSTI4 54
+ASGNI4
+ADDRLP4 52
+CNSTI4 320
+ADDRLP4 76
+INDIRI4
+ADDRLP4 88
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1137508352
+ASGNF4
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 1
+NEI4 $4288
+ADDRLP4 44
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+LABELV $4288
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 2
+NEI4 $4291
+ADDRLP4 44
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 52
+CNSTF4 1141997568
+ASGNF4
+LABELV $4291
+ADDRGP4 cg_weaponBarX+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4294
+ADDRLP4 52
+ADDRGP4 cg_weaponBarX+8
+INDIRF4
+ASGNF4
+LABELV $4294
+ADDRGP4 cg_weaponBarY+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4298
+ADDRLP4 44
+ADDRGP4 cg_weaponBarY+8
+INDIRF4
+ASGNF4
+LABELV $4298
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4305
+JUMPV
+LABELV $4302
+ADDRLP4 48
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4306
+ADDRGP4 $4303
+JUMPV
+LABELV $4306
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $4308
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4309
+JUMPV
+LABELV $4308
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $4309
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawFullWeaponBar+12
+INDIRI4
+ADDRLP4 104
+INDIRI4
+NEI4 $4310
+ADDRLP4 40
+INDIRI4
+ADDRLP4 104
+INDIRI4
+NEI4 $4310
+ADDRGP4 $4303
+JUMPV
+LABELV $4310
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $4313
+ADDRLP4 108
+ADDRGP4 cgs+632912+1317360
+INDIRI4
+ASGNI4
+ADDRLP4 112
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 1
+NEI4 $4320
+ADDRLP4 52
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4321
+JUMPV
+LABELV $4320
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 2
+NEI4 $4323
+ADDRLP4 52
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4324
+JUMPV
+LABELV $4323
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 3
+NEI4 $4326
+ADDRLP4 52
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $4326
+LABELV $4324
+LABELV $4321
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $4313
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 1
+NEI4 $4329
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 108
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4330
+JUMPV
+LABELV $4329
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 2
+NEI4 $4332
+ADDRLP4 52
+INDIRF4
+CNSTF4 1109393408
+ADDF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 108
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4333
+JUMPV
+LABELV $4332
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 3
+NEI4 $4335
+ADDRLP4 108
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 112
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $4335
+LABELV $4333
+LABELV $4330
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $4338
+ADDRGP4 $4340
+JUMPV
+LABELV $4338
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4342
+ADDRLP4 108
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $4340
+ADDRLP4 0
+INDIRI4
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+NEI4 $4340
+ADDRLP4 56
+ADDRGP4 wcg+4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 255
+BANDI4
+ASGNI4
+LABELV $4345
+LABELV $4342
+ADDRLP4 4
+ADDRGP4 colorWhite
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRGP4 colorWhite+4
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRGP4 colorWhite+8
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+ADDRGP4 colorWhite+12
+INDIRF4
+ASGNF4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 cg_lowAmmoWarningStyle+12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 108
+INDIRI4
+NEI4 $4359
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4360
+JUMPV
+LABELV $4359
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $4361
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+LABELV $4361
+LABELV $4360
+ADDRGP4 cg_lowAmmoWeaponBarWarning+12
+INDIRI4
+CNSTI4 1
+NEI4 $4363
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_GetAmmoWarning
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+NEI4 $4364
+ADDRLP4 4
+ADDRGP4 colorRed
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRGP4 colorRed+4
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRGP4 colorRed+8
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+ADDRGP4 colorRed+12
+INDIRF4
+ASGNF4
+ADDRGP4 $4364
+JUMPV
+LABELV $4363
+ADDRGP4 cg_lowAmmoWeaponBarWarning+12
+INDIRI4
+CNSTI4 2
+NEI4 $4374
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_GetAmmoWarning
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+NEI4 $4377
+ADDRLP4 4
+ADDRGP4 colorRed
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRGP4 colorRed+4
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRGP4 colorRed+8
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+ADDRGP4 colorRed+12
+INDIRF4
+ASGNF4
+ADDRGP4 $4378
+JUMPV
+LABELV $4377
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+NEI4 $4385
+ADDRLP4 4
+CNSTF4 1065286107
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1061683200
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1051864334
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $4385
+LABELV $4378
+LABELV $4374
+LABELV $4364
+ADDRGP4 cg_lowAmmoWarningStyle+12
+INDIRI4
+CNSTI4 0
+NEI4 $4390
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $4390
+ADDRLP4 4
+ADDRGP4 colorWhite
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRGP4 colorWhite+4
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRGP4 colorWhite+8
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+ADDRGP4 colorWhite+12
+INDIRF4
+ASGNF4
+LABELV $4390
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+GEI4 $4399
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 52
+INDIRF4
+CNSTF4 1099956224
+ADDF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 112
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+1317348
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4400
+JUMPV
+LABELV $4399
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 1
+EQI4 $4407
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 3
+NEI4 $4403
+LABELV $4407
+ADDRGP4 $4408
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ARGF4
+CNSTF4 1048576000
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4404
+JUMPV
+LABELV $4403
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 2
+NEI4 $4409
+ADDRGP4 $4408
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 1048576000
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+CNSTF4 1108869120
+ADDF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ARGF4
+CNSTF4 1048576000
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $4409
+LABELV $4404
+LABELV $4400
+LABELV $4340
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 3
+GEI4 $4412
+ADDRLP4 44
+ADDRLP4 44
+INDIRF4
+CNSTF4 1102053376
+ADDF4
+ASGNF4
+ADDRGP4 $4413
+JUMPV
+LABELV $4412
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 3
+NEI4 $4415
+ADDRLP4 52
+ADDRLP4 52
+INDIRF4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $4415
+LABELV $4413
+LABELV $4303
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4305
+ADDRLP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LTI4 $4302
+LABELV $4229
+endproc CG_DrawWeaponBar 132 36
+proc CG_DrawAreaNewChat 44 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg_chatTime+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+5417596
+INDIRI4
+CNSTI4 0
+EQI4 $4420
+ADDRLP4 12
+ADDRGP4 cg_chatHistoryLength+12
+INDIRI4
+ASGNI4
+ADDRGP4 $4421
+JUMPV
+LABELV $4420
+ADDRLP4 12
+ADDRGP4 cg_chatLines+12
+INDIRI4
+ASGNI4
+LABELV $4421
+ADDRLP4 12
+INDIRI4
+CNSTI4 100
+LTI4 $4425
+ADDRLP4 12
+CNSTI4 99
+ASGNI4
+LABELV $4425
+ADDRGP4 $4427
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $4431
+JUMPV
+LABELV $4428
+ADDRLP4 0
+ADDRGP4 cg+1329256
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4433
+ADDRGP4 $4430
+JUMPV
+LABELV $4433
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+MODI4
+ASGNI4
+ADDRGP4 cg+617024
+INDIRI4
+CNSTI4 0
+NEI4 $4435
+ADDRGP4 cg+5417596
+INDIRI4
+CNSTI4 0
+NEI4 $4436
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+1328856
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 28
+INDIRI4
+LEI4 $4436
+ADDRGP4 $4430
+JUMPV
+LABELV $4435
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LEI4 $4443
+ADDRGP4 $4430
+JUMPV
+LABELV $4443
+LABELV $4436
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $4445
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $4446
+JUMPV
+LABELV $4445
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $4447
+ADDRGP4 $4430
+JUMPV
+LABELV $4447
+LABELV $4446
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cg+1226456
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4429
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4431
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $4428
+LABELV $4430
+ADDRGP4 cg+3874624
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $4418
+endproc CG_DrawAreaNewChat 44 36
+export CG_GetCurrentTimeWithDirection
+proc CG_GetCurrentTimeWithDirection 56 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4452
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $4452
+ADDRLP4 4
+ADDRGP4 cgs+43236
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $4455
+ADDRLP4 0
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+3196920
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $4451
+JUMPV
+LABELV $4455
+ADDRLP4 28
+ADDRGP4 CG_GameTimeout
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $4460
+ADDRLP4 20
+ADDRGP4 cgs+45340
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+45340
+INDIRI4
+ASGNI4
+ADDRGP4 $4461
+JUMPV
+LABELV $4460
+ADDRLP4 20
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $4461
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $4466
+ADDRGP4 $4467
+JUMPV
+LABELV $4466
+ADDRGP4 cgs+39724
+INDIRI4
+CNSTI4 0
+EQI4 $4469
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+LEI4 $4472
+ADDRLP4 32
+ADDRGP4 cgs+39688
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $4478
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $4475
+LABELV $4480
+ADDRLP4 40
+ADDRGP4 cgs+39688
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 9
+EQI4 $4478
+ADDRLP4 40
+INDIRI4
+CNSTI4 11
+EQI4 $4478
+ADDRLP4 40
+INDIRI4
+CNSTI4 12
+EQI4 $4478
+ADDRGP4 $4475
+JUMPV
+LABELV $4478
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4476
+JUMPV
+LABELV $4475
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 $4479
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 1000
+ADDRLP4 52
+INDIRI4
+MULI4
+ASGNI4
+LABELV $4476
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $4481
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+SUBI4
+ADDRLP4 24
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg_levelTimerOvertimeReset+12
+INDIRI4
+CNSTI4 0
+EQI4 $4484
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+SUBI4
+ADDRLP4 24
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $4473
+JUMPV
+LABELV $4484
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $4473
+JUMPV
+LABELV $4481
+ADDRLP4 24
+ADDRGP4 cgs+39720
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $4473
+JUMPV
+LABELV $4472
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $4473
+LABELV $4469
+LABELV $4467
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4491
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $4491
+ADDRGP4 cg_levelTimerDirection+12
+INDIRI4
+CNSTI4 0
+NEI4 $4493
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $4496
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $4497
+JUMPV
+LABELV $4496
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $4497
+ADDRGP4 cg+3196920
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4494
+JUMPV
+LABELV $4493
+ADDRGP4 cg_levelTimerDirection+12
+INDIRI4
+CNSTI4 1
+NEI4 $4499
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $4502
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3196920
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4503
+JUMPV
+LABELV $4502
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+ADDI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+3196920
+CNSTI4 0
+ASGNI4
+LABELV $4503
+ADDRGP4 cgs+39724
+INDIRI4
+CNSTI4 0
+NEI4 $4500
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $4510
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $4511
+JUMPV
+LABELV $4510
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $4511
+ADDRGP4 cg+3196920
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4500
+JUMPV
+LABELV $4499
+ADDRGP4 cg_levelTimerDirection+12
+INDIRI4
+CNSTI4 2
+NEI4 $4513
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+3196920
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4514
+JUMPV
+LABELV $4513
+ADDRGP4 cg_levelTimerDirection+12
+INDIRI4
+CNSTI4 3
+NEI4 $4517
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $4520
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $4526
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $4521
+LABELV $4526
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $4528
+JUMPV
+LABELV $4527
+ADDRGP4 cg_levelTimerDefaultTimeLimit+12
+INDIRI4
+CNSTI4 0
+LEI4 $4530
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cg_levelTimerDefaultTimeLimit+12
+INDIRI4
+MULI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $4531
+JUMPV
+LABELV $4530
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 3600000
+ADDI4
+ASGNI4
+LABELV $4531
+LABELV $4528
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4527
+ADDRGP4 $4521
+JUMPV
+LABELV $4520
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+ADDI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $4521
+ADDRGP4 cg+3196920
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4518
+JUMPV
+LABELV $4517
+ADDRGP4 cg_levelTimerDirection+12
+INDIRI4
+CNSTI4 4
+NEI4 $4536
+ADDRLP4 32
+ADDRGP4 trap_GetGameEndTime
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4539
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $4541
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $4547
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $4542
+LABELV $4547
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $4549
+JUMPV
+LABELV $4548
+ADDRGP4 cg_levelTimerDefaultTimeLimit+12
+INDIRI4
+CNSTI4 0
+LEI4 $4551
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cg_levelTimerDefaultTimeLimit+12
+INDIRI4
+MULI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $4552
+JUMPV
+LABELV $4551
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 3600000
+ADDI4
+ASGNI4
+LABELV $4552
+LABELV $4549
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4548
+ADDRGP4 $4542
+JUMPV
+LABELV $4541
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+ADDI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $4542
+LABELV $4539
+ADDRGP4 cg+3196920
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4537
+JUMPV
+LABELV $4536
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+3196920
+CNSTI4 1
+ASGNI4
+LABELV $4537
+LABELV $4518
+LABELV $4514
+LABELV $4500
+LABELV $4494
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $4451
+endproc CG_GetCurrentTimeWithDirection 56 8
+bss
+align 1
+LABELV $4559
+skip 1024
+export CG_GetLevelTimerString
+code
+proc CG_GetLevelTimerString 52 16
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_GetCurrentTimeWithDirection
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 1000
+ASGNI4
+ADDRLP4 32
+CNSTI4 3600
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ADDRLP4 32
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 60
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ADDRLP4 40
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627388
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $4560
+ADDRGP4 cg_warmupTime+12
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $4565
+ADDRGP4 cg_warmupTime+12
+INDIRI4
+CNSTI4 2
+NEI4 $4560
+LABELV $4565
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $4560
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $4566
+ADDRGP4 cg_warmupTime+12
+INDIRI4
+CNSTI4 1
+EQI4 $4571
+ADDRGP4 cg_warmupTime+12
+INDIRI4
+CNSTI4 2
+NEI4 $4566
+LABELV $4571
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $4572
+ADDRGP4 $4574
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $4567
+JUMPV
+LABELV $4572
+ADDRGP4 $4575
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $4567
+JUMPV
+LABELV $4566
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $4576
+ADDRGP4 $4578
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $4577
+JUMPV
+LABELV $4576
+ADDRGP4 $4579
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+LABELV $4577
+LABELV $4567
+ADDRGP4 $4559
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $4559
+RETP4
+LABELV $4558
+endproc CG_GetLevelTimerString 52 16
+export CG_GetServerTimeFromClockString
+proc CG_GetServerTimeFromClockString 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4583
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $4581
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4584
+ADDRGP4 $4587
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTF4 3212836864
+RETF4
+ADDRGP4 $4580
+JUMPV
+LABELV $4584
+ADDRGP4 cg+607152
+INDIRF4
+RETF4
+ADDRGP4 $4580
+JUMPV
+LABELV $4581
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 119
+EQI4 $4591
+ADDRLP4 24
+INDIRI4
+CNSTI4 87
+NEI4 $4589
+LABELV $4591
+ADDRGP4 cg+3874628
+INDIRI4
+CNSTI4 0
+NEI4 $4592
+ADDRGP4 $4595
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTF4 3212836864
+RETF4
+ADDRGP4 $4580
+JUMPV
+LABELV $4592
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $4589
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 24
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $4599
+JUMPV
+LABELV $4596
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 58
+NEI4 $4600
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4600
+LABELV $4597
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4599
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $4596
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $4602
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+RETF4
+ADDRGP4 $4580
+JUMPV
+LABELV $4602
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_ParseClockTime
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $4604
+ADDRGP4 cg+3874632
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+ADDF4
+RETF4
+ADDRGP4 $4580
+JUMPV
+LABELV $4604
+ADDRLP4 36
+ADDRGP4 trap_GetGameStartTime
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+GEI4 $4607
+ADDRGP4 $4609
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTF4 3212836864
+RETF4
+ADDRGP4 $4580
+JUMPV
+LABELV $4607
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_AdjustTimeForTimeouts
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 trap_GetGameStartTime
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+ADDF4
+RETF4
+LABELV $4580
+endproc CG_GetServerTimeFromClockString 48 8
+proc CG_DrawTeamMapPickupsTdm 164 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 cg+3856416
+ASGNP4
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $4612
+ADDRLP4 40
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4613
+JUMPV
+LABELV $4612
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $4614
+ADDRLP4 40
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 12
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 12
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 12
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 12
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 12
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4615
+JUMPV
+LABELV $4614
+ADDRGP4 $4616
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4610
+JUMPV
+LABELV $4615
+LABELV $4613
+ADDRLP4 100
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 24
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1048777327
+ASGNF4
+ADDRLP4 104
+CNSTF4 1107296256
+ADDRFP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 112
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 112
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1071225242
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 116
+INDIRI4
+EQI4 $4617
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492580
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 96
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4617
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $4621
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492584
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4621
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $4625
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492588
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4625
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $4629
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492592
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4629
+ADDRLP4 32
+INDIRI4
+CNSTI4 4
+GEI4 $4633
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1077936128
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $4633
+ADDRGP4 $4635
+ARGP4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+CNSTF4 1069547520
+ADDRLP4 124
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $4636
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492612
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 132
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 144
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 148
+CNSTI4 60
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4636
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $4641
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492616
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 132
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 144
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 148
+CNSTI4 60
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4641
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $4645
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492620
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 132
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 144
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 148
+CNSTI4 60
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4645
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $4649
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492624
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 132
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 144
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 148
+CNSTI4 60
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4649
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $4653
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492628
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 132
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 144
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 148
+CNSTI4 60
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4653
+LABELV $4610
+endproc CG_DrawTeamMapPickupsTdm 164 36
+proc CG_DrawTeamMapPickupsCtf 176 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 cg+3865760
+ASGNP4
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $4659
+ADDRLP4 40
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4660
+JUMPV
+LABELV $4659
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $4661
+ADDRLP4 40
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 12
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 12
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 12
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 12
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 12
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 12
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 12
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 12
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 12
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4662
+JUMPV
+LABELV $4661
+ADDRGP4 $4663
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4657
+JUMPV
+LABELV $4662
+LABELV $4660
+ADDRLP4 112
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 24
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1048777327
+ASGNF4
+ADDRLP4 116
+CNSTF4 1107296256
+ADDRFP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 124
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 124
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 124
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1071225242
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 0
+ASGNF4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 128
+INDIRI4
+EQI4 $4664
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492580
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 108
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4664
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $4668
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492584
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 136
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4668
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $4672
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492588
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 136
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4672
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $4676
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492592
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 136
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4676
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $4680
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492596
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 136
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4680
+ADDRLP4 32
+INDIRI4
+CNSTI4 4
+GEI4 $4684
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1077936128
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $4684
+ADDRGP4 $4635
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+CNSTF4 1069547520
+ADDRLP4 136
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $4686
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $4688
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492608
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4689
+JUMPV
+LABELV $4688
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $4693
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492604
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4694
+JUMPV
+LABELV $4693
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492600
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $4694
+LABELV $4689
+ADDRGP4 $232
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 144
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 156
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 160
+CNSTI4 60
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4686
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $4699
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492612
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 144
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 156
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 160
+CNSTI4 60
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4699
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $4703
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492616
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 144
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 156
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 160
+CNSTI4 60
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4703
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $4707
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492620
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 144
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 156
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 160
+CNSTI4 60
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4707
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $4711
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492624
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 144
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 156
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 160
+CNSTI4 60
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4711
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $4715
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492628
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 144
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 156
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 160
+CNSTI4 60
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4715
+LABELV $4657
+endproc CG_DrawTeamMapPickupsCtf 176 36
+proc CG_DrawTeamMapPickups 0 20
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+NEI4 $4720
+ADDRGP4 $4719
+JUMPV
+LABELV $4720
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $4727
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $4723
+LABELV $4727
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamMapPickupsTdm
+CALLV
+pop
+ADDRGP4 $4724
+JUMPV
+LABELV $4723
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $4736
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $4736
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $4736
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $4728
+LABELV $4736
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamMapPickupsCtf
+CALLV
+pop
+ADDRGP4 $4729
+JUMPV
+LABELV $4728
+ADDRGP4 $4737
+ARGP4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4729
+LABELV $4724
+LABELV $4719
+endproc CG_DrawTeamMapPickups 0 20
+proc CG_Draw1stPlayerPickups 48 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+3196932
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4741
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492580
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4745
+ADDRGP4 $4748
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4580
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $4745
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4741
+ADDRLP4 4
+INDIRP4
+CNSTI4 4584
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4749
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492584
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4584
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4753
+ADDRGP4 $4748
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4588
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $4753
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4749
+ADDRLP4 4
+INDIRP4
+CNSTI4 4592
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4756
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492588
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4592
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4760
+ADDRGP4 $4748
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4596
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $4760
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4756
+ADDRLP4 4
+INDIRP4
+CNSTI4 4600
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4763
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492592
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4600
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4767
+ADDRGP4 $4748
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4604
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $4767
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4763
+LABELV $4739
+endproc CG_Draw1stPlayerPickups 48 36
+proc CG_Draw2ndPlayerPickups 56 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+3196932+5088
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4773
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492580
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4777
+ADDRGP4 $4748
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4580
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $4777
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4773
+ADDRLP4 4
+INDIRP4
+CNSTI4 4584
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4780
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492584
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4584
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4784
+ADDRGP4 $4748
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4588
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $4784
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4780
+ADDRLP4 4
+INDIRP4
+CNSTI4 4592
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4787
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492588
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4592
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4791
+ADDRGP4 $4748
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4596
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $4791
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4787
+ADDRLP4 4
+INDIRP4
+CNSTI4 4600
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4794
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492592
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4600
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4798
+ADDRGP4 $4748
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4604
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $4798
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $4794
+LABELV $4770
+endproc CG_Draw2ndPlayerPickups 56 36
+proc CG_SetArmorColor 8 4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $4802
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $4802
+ADDRGP4 $4801
+JUMPV
+LABELV $4802
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4806
+ADDRLP4 0
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4801
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+EQI4 $4816
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 15
+EQI4 $4816
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+NEI4 $4801
+LABELV $4816
+ADDRGP4 $4801
+JUMPV
+LABELV $4806
+ADDRLP4 0
+ADDRGP4 STAT_ARMOR_TIER
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4823
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $4822
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $4821
+ADDRGP4 $4817
+JUMPV
+LABELV $4821
+ADDRGP4 colorRed
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $4818
+JUMPV
+LABELV $4822
+ADDRGP4 colorYellow
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $4818
+JUMPV
+LABELV $4817
+LABELV $4823
+ADDRGP4 colorGreen
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $4818
+LABELV $4801
+endproc CG_SetArmorColor 8 4
+data
+export MenuWidescreen
+align 4
+LABELV MenuWidescreen
+byte 4 0
+export QLWideScreen
+align 4
+LABELV QLWideScreen
+byte 4 0
+lit
+align 4
+LABELV $5030
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export CG_OwnerDraw
+code
+proc CG_OwnerDraw 1248 36
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 36
+ADDRFP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 44
+ADDRFP4 44
+INDIRF4
+ASGNF4
+ADDRFP4 48
+ADDRFP4 48
+INDIRP4
+ASGNP4
+ADDRFP4 52
+ADDRFP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 56
+ADDRFP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 64
+ADDRFP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 68
+ADDRFP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+CNSTI4 6
+NEI4 $4825
+ADDRGP4 $4824
+JUMPV
+LABELV $4825
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $4828
+ADDRGP4 $4824
+JUMPV
+LABELV $4828
+ADDRFP4 60
+INDIRI4
+CNSTI4 0
+GTI4 $4831
+ADDRLP4 16
+ADDRGP4 cgDC+236+12
+ASGNP4
+ADDRGP4 $4832
+JUMPV
+LABELV $4831
+ADDRLP4 16
+CNSTI4 21668
+ADDRFP4 60
+INDIRI4
+MULI4
+ADDRGP4 cgDC+236+65016
+ADDP4
+ASGNP4
+LABELV $4832
+ADDRLP4 20
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 20+8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 20+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 20+16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 20+20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 20+24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $4843
+ADDRLP4 20+28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $4844
+JUMPV
+LABELV $4843
+ADDRLP4 20+28
+ADDRFP4 32
+INDIRI4
+ASGNI4
+LABELV $4844
+ADDRLP4 20+32
+ADDRFP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 20+36
+ADDRFP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 20+40
+ADDRFP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 20+44
+ADDRFP4 48
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20+44+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20+60
+ADDRFP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 20+64
+ADDRFP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 20+68
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 MenuWidescreen
+ADDRFP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRFP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 MenuRect
+ADDRFP4 72
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRFP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $4859
+ADDRFP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $4861
+ADDRGP4 $4863
+ARGP4
+ADDRFP4 68
+INDIRI4
+ARGI4
+ADDRFP4 64
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4861
+LABELV $4859
+ADDRFP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $4864
+LABELV $4864
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRFP4 64
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $4868
+ADDRFP4 68
+INDIRI4
+ADDRLP4 156
+INDIRI4
+EQI4 $4866
+LABELV $4868
+ADDRLP4 160
+ADDRFP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $4869
+ADDRLP4 160
+ADDRFP4 68
+INDIRI4
+ASGNI4
+LABELV $4869
+LABELV $4866
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRI4
+ADDRLP4 160
+INDIRI4
+LTI4 $4873
+ADDRFP4 24
+INDIRI4
+ADDRLP4 164
+INDIRI4
+LEI4 $4871
+LABELV $4873
+LABELV $4871
+ADDRGP4 $4874
+ARGP4
+ADDRLP4 160
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 116
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+LEI4 $4875
+ADDRGP4 $4877
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+12
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $4875
+ADDRLP4 116
+INDIRI4
+CNSTI4 2
+LEI4 $4880
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRGP4 MenuWidescreen
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 $4824
+JUMPV
+LABELV $4880
+ADDRFP4 24
+INDIRI4
+CNSTI4 7000
+LTI4 $7786
+ADDRFP4 24
+INDIRI4
+CNSTI4 7033
+GTI4 $7787
+ADDRFP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $7788-28000
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $7788
+address $7717
+address $7731
+address $7741
+address $7746
+address $4882
+address $7747
+address $7748
+address $7749
+address $7750
+address $7751
+address $7752
+address $7753
+address $7754
+address $7755
+address $7756
+address $7757
+address $7758
+address $7759
+address $4882
+address $7760
+address $7761
+address $7762
+address $7763
+address $7764
+address $7765
+address $7766
+address $7767
+address $7768
+address $7769
+address $7770
+address $7771
+address $7772
+address $4901
+address $7773
+code
+LABELV $7786
+ADDRFP4 24
+INDIRI4
+CNSTI4 3
+LTI4 $4882
+ADDRFP4 24
+INDIRI4
+CNSTI4 549
+GTI4 $4882
+ADDRFP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $7790-12
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $7790
+address $5371
+address $4928
+address $5022
+address $4882
+address $4929
+address $5858
+address $5079
+address $4882
+address $4937
+address $4940
+address $7593
+address $5374
+address $7673
+address $5857
+address $5265
+address $5215
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $5758
+address $5771
+address $5782
+address $5793
+address $5795
+address $5797
+address $5799
+address $5801
+address $5802
+address $5803
+address $4882
+address $4900
+address $4882
+address $4884
+address $4885
+address $4886
+address $4975
+address $4993
+address $7548
+address $4904
+address $4943
+address $4957
+address $4887
+address $4888
+address $4889
+address $4902
+address $4903
+address $7628
+address $7645
+address $4917
+address $4923
+address $4924
+address $4915
+address $4916
+address $7682
+address $4920
+address $4921
+address $4919
+address $4930
+address $4931
+address $4931
+address $4931
+address $4882
+address $4931
+address $4931
+address $4931
+address $4931
+address $4882
+address $4882
+address $4931
+address $4883
+address $4883
+address $4883
+address $4883
+address $4883
+address $4883
+address $4932
+address $5029
+address $4938
+address $5020
+address $4882
+address $4939
+address $5021
+address $4942
+address $5011
+address $5115
+address $5225
+address $5241
+address $5260
+address $5354
+address $5403
+address $5414
+address $4882
+address $4882
+address $5016
+address $7600
+address $7611
+address $4882
+address $5426
+address $7191
+address $5439
+address $5458
+address $5472
+address $5486
+address $5492
+address $5506
+address $5525
+address $5536
+address $5550
+address $4883
+address $4882
+address $4882
+address $5876
+address $5881
+address $5891
+address $5896
+address $5901
+address $5906
+address $5911
+address $5916
+address $5921
+address $5926
+address $5931
+address $5936
+address $5886
+address $5941
+address $5949
+address $5953
+address $5957
+address $5961
+address $5965
+address $5969
+address $5973
+address $5977
+address $5981
+address $5985
+address $5945
+address $5989
+address $5999
+address $6004
+address $6009
+address $6014
+address $6019
+address $6024
+address $6029
+address $6034
+address $6039
+address $6044
+address $5994
+address $6049
+address $6054
+address $6064
+address $6069
+address $6074
+address $6079
+address $6084
+address $6089
+address $6094
+address $6099
+address $6104
+address $6109
+address $6059
+address $6114
+address $6159
+address $6181
+address $6203
+address $6225
+address $6247
+address $6269
+address $6291
+address $6313
+address $6335
+address $6357
+address $6137
+address $7554
+address $6379
+address $6382
+address $6385
+address $6388
+address $6391
+address $6398
+address $6405
+address $6412
+address $7047
+address $7070
+address $7093
+address $4882
+address $4882
+address $5577
+address $7257
+address $5591
+address $5616
+address $5631
+address $5646
+address $5653
+address $5668
+address $5687
+address $5697
+address $5712
+address $4883
+address $4882
+address $4882
+address $6419
+address $6425
+address $6437
+address $6443
+address $6449
+address $6455
+address $6461
+address $6467
+address $6473
+address $6479
+address $6485
+address $6491
+address $6431
+address $6497
+address $6507
+address $6512
+address $6517
+address $6522
+address $6527
+address $6532
+address $6537
+address $6542
+address $6547
+address $6552
+address $6502
+address $6557
+address $6569
+address $6575
+address $6581
+address $6587
+address $6593
+address $6599
+address $6605
+address $6611
+address $6617
+address $6623
+address $6563
+address $6629
+address $6635
+address $6647
+address $6653
+address $6659
+address $6665
+address $6671
+address $6677
+address $6683
+address $6689
+address $6695
+address $6701
+address $6641
+address $6707
+address $6755
+address $6779
+address $6803
+address $6827
+address $6851
+address $6875
+address $6899
+address $6923
+address $6947
+address $6971
+address $6731
+address $7555
+address $6995
+address $6999
+address $7003
+address $7007
+address $7011
+address $7020
+address $7029
+address $7038
+address $7116
+address $7141
+address $7166
+address $4882
+address $4882
+address $4913
+address $4905
+address $4907
+address $7589
+address $5741
+address $4882
+address $5277
+address $5365
+address $5392
+address $7552
+address $7428
+address $7434
+address $7440
+address $7446
+address $7452
+address $7458
+address $7500
+address $7512
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4910
+address $4908
+address $4906
+address $7591
+address $5750
+address $4882
+address $5317
+address $5368
+address $5397
+address $7553
+address $7464
+address $7470
+address $7476
+address $7482
+address $7488
+address $7494
+address $7524
+address $7536
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4883
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $7623
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4882
+address $4883
+code
+LABELV $7787
+ADDRFP4 24
+INDIRI4
+CNSTI4 66666
+LTI4 $4882
+ADDRFP4 24
+INDIRI4
+CNSTI4 66701
+GTI4 $4882
+ADDRFP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $7792-266664
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $7792
+address $4894
+address $4895
+address $4898
+address $4882
+address $4890
+address $4891
+address $4892
+address $4893
+address $4897
+address $4899
+address $4909
+address $4911
+address $4912
+address $4914
+address $4918
+address $4896
+address $4922
+address $4925
+address $4926
+address $4927
+address $4933
+address $5401
+address $5402
+address $7323
+address $7327
+address $7329
+address $7341
+address $7353
+address $7360
+address $7374
+address $7386
+address $7398
+address $7410
+address $7422
+address $5566
+address $5729
+code
+LABELV $4884
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerArmorIcon
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4885
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerArmorIcon
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4886
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRFP4 72
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawPlayerArmorValue
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4887
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerAmmoIcon
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4888
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerAmmoIcon
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4889
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRFP4 72
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawPlayerAmmoValue
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4890
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerHead
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4891
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerHead
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4892
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerName
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4893
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerStatus
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4894
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerArmor
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4895
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerHealth
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4896
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerName
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4897
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerLocation
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4898
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerWeapon
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4899
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerPowerup
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4900
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerHead
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4901
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawPlayerHead
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4902
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerItem
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4903
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerScore
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4904
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRFP4 72
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawPlayerHealth
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4905
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedScore
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4906
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueScore
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4907
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedName
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4908
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueName
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4909
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawBlueFlagHead
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4910
+ADDRLP4 0
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueFlagStatus
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4911
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawBlueFlagName
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4912
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawRedFlagHead
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4913
+ADDRLP4 0
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedFlagStatus
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4914
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawRedFlagName
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4915
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_HarvesterSkulls
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4916
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_HarvesterSkulls
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4917
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_OneFlagStatus
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4918
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawPlayerLocation
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4919
+ADDRLP4 0
+ARGP4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawTeamColor
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4920
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawCTFPowerUp
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4921
+ADDRLP4 0
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawAreaPowerUp
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4922
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawPlayerStatus
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4923
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawPlayerHasFlag
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4924
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerHasFlag
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4925
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawAreaSystemChat
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4926
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawAreaTeamChat
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4927
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawAreaChat
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4928
+ADDRLP4 176
+ADDRGP4 CG_GameTypeString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4929
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawGameStatus
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4930
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawKiller
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4931
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawMedal
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4932
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawTeamSpectators
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4933
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+NEI4 $4883
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawNewTeamInfo
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4937
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRFP4 72
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawCapFragLimit
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4938
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw1stPlace
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4939
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw2ndPlace
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4940
+ADDRLP4 180
+ADDRGP4 CG_GetLevelTimerString
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4942
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawObit
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4943
+ADDRLP4 92
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4945
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 Wolfcam_PlayerHealth
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 -9999
+GTI4 $4948
+ADDRGP4 $4883
+JUMPV
+LABELV $4948
+LABELV $4945
+ADDRLP4 92
+INDIRI4
+CNSTI4 100
+LEI4 $4950
+ADDRLP4 92
+CNSTI4 100
+ASGNI4
+LABELV $4950
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GEI4 $4952
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $4952
+ADDRGP4 CG_SetTeamColor
+CALLV
+pop
+ADDRLP4 180
+CNSTF4 0
+ASGNF4
+ADDRLP4 124
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 136
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 184
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4957
+ADDRLP4 92
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4959
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 Wolfcam_PlayerHealth
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 -9999
+GTI4 $4962
+ADDRGP4 $4883
+JUMPV
+LABELV $4962
+LABELV $4959
+ADDRLP4 188
+CNSTI4 100
+ASGNI4
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+ADDRLP4 188
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 188
+INDIRI4
+LEI4 $4964
+ADDRLP4 92
+CNSTI4 100
+ASGNI4
+LABELV $4964
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GEI4 $4966
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $4966
+ADDRGP4 CG_SetTeamColor
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+4
+ARGP4
+ADDRLP4 0+8
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+ADDRLP4 192
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 1065353216
+ADDRLP4 192
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 200
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 132
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ADDRLP4 192
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4975
+ADDRLP4 92
+ADDRGP4 STAT_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4977
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 Wolfcam_PlayerArmor
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GEI4 $4980
+ADDRGP4 $4883
+JUMPV
+LABELV $4980
+LABELV $4977
+ADDRLP4 92
+INDIRI4
+CNSTI4 100
+LEI4 $4982
+ADDRLP4 92
+CNSTI4 100
+ASGNI4
+LABELV $4982
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GEI4 $4984
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $4984
+ADDRGP4 CG_SetTeamColor
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+4
+ARGP4
+ADDRLP4 0+8
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 204
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 208
+CNSTF4 1065353216
+ADDRLP4 204
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 128
+CNSTF4 0
+ASGNF4
+ADDRLP4 212
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 132
+ADDRLP4 212
+INDIRF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 212
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 204
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $4993
+ADDRLP4 92
+ADDRGP4 STAT_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4995
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 Wolfcam_PlayerArmor
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GEI4 $4998
+ADDRGP4 $4883
+JUMPV
+LABELV $4998
+LABELV $4995
+ADDRLP4 216
+CNSTI4 100
+ASGNI4
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+ADDRLP4 216
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 216
+INDIRI4
+LEI4 $5000
+ADDRLP4 92
+CNSTI4 100
+ASGNI4
+LABELV $5000
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GEI4 $5002
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $5002
+ADDRGP4 CG_SetTeamColor
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+4
+ARGP4
+ADDRLP4 0+8
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+ADDRLP4 220
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 224
+CNSTF4 1065353216
+ADDRLP4 220
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRLP4 228
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 132
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+ADDRLP4 224
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ADDRLP4 220
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5011
+ADDRFP4 60
+INDIRI4
+CNSTI4 0
+GTI4 $5012
+ADDRLP4 20+68
+ADDRGP4 cg+6747464
+ASGNP4
+LABELV $5012
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_DrawAreaNewChat
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5016
+ADDRGP4 CG_SetTeamColor
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5020
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Draw1stPlaceScore
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5021
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Draw2ndPlaceScore
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5022
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+1317276
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5029
+ADDRLP4 232
+ADDRGP4 $5030
+INDIRB
+ASGNB 16
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 248
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+EQI4 $5035
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $5031
+LABELV $5035
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $5036
+CNSTI4 1
+ARGI4
+CNSTI4 50
+ARGI4
+ADDRGP4 $3096
+ARGP4
+ADDRLP4 256
+ADDRGP4 CG_CheckCpmaVersion
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+EQI4 $5036
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+EQI4 $5041
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 15
+NEI4 $5036
+LABELV $5041
+ADDRGP4 cg+3848224
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRGP4 $3728
+ARGP4
+ADDRGP4 cg+3848224
+ARGP4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $5037
+JUMPV
+LABELV $5036
+ADDRGP4 cgs+43292
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRGP4 $3728
+ARGP4
+ADDRGP4 cgs+43292
+ARGP4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $5037
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 232+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5058
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $5058
+ADDRGP4 cg+3848216
+INDIRI4
+CNSTI4 0
+NEI4 $5056
+LABELV $5058
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $5047
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+EQI4 $5059
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 15
+NEI4 $5047
+LABELV $5059
+ADDRGP4 cg+3848216
+INDIRI4
+CNSTI4 0
+EQI4 $5047
+LABELV $5056
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 232
+ARGP4
+ADDRGP4 $5060
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5047
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 232
+ARGP4
+ADDRGP4 $5061
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5031
+ADDRLP4 232+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRLP4 252
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+EQI4 $5063
+ADDRGP4 $5067
+ARGP4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 232
+ARGP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5063
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+LEI4 $5070
+ADDRGP4 $5074
+ARGP4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 232
+ARGP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5070
+ADDRGP4 $5067
+ARGP4
+ADDRGP4 cgs+43244
+INDIRI4
+ARGI4
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 232
+ARGP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5079
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+EQI4 $5086
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+EQI4 $5086
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+NEI4 $5080
+LABELV $5086
+ADDRLP4 112
+ADDRGP4 $5087
+ASGNP4
+ADDRGP4 $5081
+JUMPV
+LABELV $5080
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $5092
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $5088
+LABELV $5092
+ADDRLP4 112
+ADDRGP4 $5093
+ASGNP4
+ADDRGP4 $5089
+JUMPV
+LABELV $5088
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $5094
+ADDRLP4 112
+ADDRGP4 $5087
+ASGNP4
+ADDRGP4 $5095
+JUMPV
+LABELV $5094
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+EQI4 $5109
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $5109
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 7
+EQI4 $5109
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+EQI4 $5109
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $5109
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $5097
+LABELV $5109
+ADDRLP4 112
+ADDRGP4 $5110
+ASGNP4
+ADDRGP4 $5098
+JUMPV
+LABELV $5097
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $5111
+ADDRLP4 112
+ADDRGP4 $5114
+ASGNP4
+ADDRGP4 $5112
+JUMPV
+LABELV $5111
+ADDRLP4 112
+ADDRGP4 $3096
+ASGNP4
+LABELV $5112
+LABELV $5098
+LABELV $5095
+LABELV $5089
+LABELV $5081
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5115
+CNSTI4 4524
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $4883
+ADDRLP4 236
+CNSTI4 0
+ASGNI4
+ADDRLP4 240
+CNSTI4 0
+ASGNI4
+ADDRLP4 244
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3865760
+INDIRI4
+CNSTI4 0
+EQI4 $5121
+ADDRGP4 cg+3865760+8
+INDIRI4
+CNSTI4 1
+LTI4 $5121
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5129
+JUMPV
+LABELV $5126
+ADDRLP4 252
+CNSTI4 80
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cg+3865760+152
+ADDP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $5134
+ADDRLP4 256
+ADDRLP4 252
+INDIRP4
+ASGNP4
+ADDRLP4 236
+ADDRLP4 256
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 240
+ADDRLP4 256
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 244
+ADDRLP4 256
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5122
+JUMPV
+LABELV $5134
+LABELV $5127
+ADDRLP4 232
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5129
+ADDRLP4 232
+INDIRI4
+ADDRGP4 cg+3865760+148
+INDIRI4
+LTI4 $5126
+ADDRGP4 $5122
+JUMPV
+LABELV $5121
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5140
+JUMPV
+LABELV $5137
+ADDRLP4 248
+CNSTI4 92
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 248
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $5143
+ADDRLP4 256
+ADDRLP4 248
+INDIRP4
+ASGNP4
+ADDRLP4 236
+ADDRLP4 256
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 240
+ADDRLP4 256
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 244
+ADDRLP4 256
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5139
+JUMPV
+LABELV $5143
+LABELV $5138
+ADDRLP4 232
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5140
+ADDRLP4 232
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $5137
+LABELV $5139
+LABELV $5122
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 256
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $5147
+ADDRLP4 112
+ADDRLP4 112
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $5147
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $5149
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+EQI4 $5152
+ADDRGP4 $5154
+ARGP4
+ADDRLP4 264
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ARGI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+NEI4 $5158
+ADDRLP4 260
+ADDRGP4 $5155
+ASGNP4
+ADDRGP4 $5159
+JUMPV
+LABELV $5158
+ADDRLP4 260
+ADDRGP4 $5156
+ASGNP4
+LABELV $5159
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5152
+ADDRGP4 $5160
+ARGP4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5149
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $5162
+ADDRGP4 $5160
+ARGP4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5162
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $5166
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 CG_GetTimeString
+CALLP4
+ASGNP4
+ADDRGP4 $5169
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5166
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $5183
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $5183
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 7
+EQI4 $5183
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+EQI4 $5183
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $5183
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $5171
+LABELV $5183
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+EQI4 $5184
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $5186
+ADDRGP4 $5189
+ARGP4
+ADDRLP4 264
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ARGI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+NEI4 $5191
+ADDRLP4 260
+ADDRGP4 $5155
+ASGNP4
+ADDRGP4 $5192
+JUMPV
+LABELV $5191
+ADDRLP4 260
+ADDRGP4 $5156
+ASGNP4
+LABELV $5192
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5186
+ADDRGP4 $5193
+ARGP4
+ADDRLP4 264
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ARGI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+NEI4 $5195
+ADDRLP4 260
+ADDRGP4 $5155
+ASGNP4
+ADDRGP4 $5196
+JUMPV
+LABELV $5195
+ADDRLP4 260
+ADDRGP4 $5156
+ASGNP4
+LABELV $5196
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5184
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+EQI4 $5197
+ADDRGP4 $5154
+ARGP4
+ADDRLP4 264
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ARGI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+NEI4 $5200
+ADDRLP4 260
+ADDRGP4 $5155
+ASGNP4
+ADDRGP4 $5201
+JUMPV
+LABELV $5200
+ADDRLP4 260
+ADDRGP4 $5156
+ASGNP4
+LABELV $5201
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5197
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+EQI4 $5202
+ADDRGP4 $5204
+ARGP4
+ADDRLP4 264
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ARGI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+NEI4 $5206
+ADDRLP4 260
+ADDRGP4 $5155
+ASGNP4
+ADDRGP4 $5207
+JUMPV
+LABELV $5206
+ADDRLP4 260
+ADDRGP4 $5156
+ASGNP4
+LABELV $5207
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5202
+ADDRGP4 $5160
+ARGP4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5171
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $5209
+CNSTI4 1
+ARGI4
+CNSTI4 50
+ARGI4
+ADDRGP4 $3096
+ARGP4
+ADDRLP4 260
+ADDRGP4 CG_CheckCpmaVersion
+CALLI4
+ASGNI4
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 264
+INDIRI4
+EQI4 $5209
+ADDRGP4 cg+3848216
+INDIRI4
+ADDRLP4 264
+INDIRI4
+EQI4 $5209
+ADDRGP4 $4883
+JUMPV
+LABELV $5209
+ADDRGP4 $5213
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5215
+ADDRGP4 cg+617024
+INDIRI4
+CNSTI4 0
+EQI4 $5216
+ADDRLP4 232
+CNSTI4 91
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+ADDRLP4 232
+INDIRI4
+NEI4 $5216
+ADDRGP4 cgs+1957744
+INDIRI4
+ADDRLP4 232
+INDIRI4
+GEI4 $5216
+CNSTI4 3
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 240
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 240
+INDIRP4
+ARGP4
+ADDRGP4 $5223
+ARGP4
+ADDRLP4 244
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 $5222
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 248
+INDIRI4
+ARGI4
+ADDRLP4 252
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5216
+CNSTI4 3
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5225
+ADDRGP4 cg+610856
+INDIRI4
+CNSTI4 0
+LTI4 $5230
+ADDRGP4 cg+610856
+INDIRI4
+CNSTI4 64
+LEI4 $5226
+LABELV $5230
+ADDRGP4 $5231
+ARGP4
+ADDRGP4 cg+610856
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5226
+ADDRLP4 232
+CNSTI4 92
+ADDRGP4 cg+610856
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+LTI4 $5238
+ADDRLP4 236
+INDIRI4
+CNSTI4 16
+LEI4 $5236
+LABELV $5238
+ADDRGP4 $5239
+ARGP4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5236
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 weapNamesCasual
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5241
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5242
+ADDRLP4 232
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $5243
+JUMPV
+LABELV $5242
+ADDRLP4 232
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5243
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+NEI4 $5250
+ADDRGP4 colorRed
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $5251
+JUMPV
+LABELV $5250
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+NEI4 $5252
+ADDRGP4 colorBlue
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $5253
+JUMPV
+LABELV $5252
+ADDRGP4 colorYellow
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $5253
+LABELV $5251
+ADDRLP4 236
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+EQI4 $5256
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+NEI4 $4883
+LABELV $5256
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5260
+ADDRGP4 $571
+ARGP4
+CNSTI4 92
+ADDRGP4 cg+610856
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5265
+ADDRLP4 244
+CNSTI4 0
+ASGNI4
+ADDRLP4 240
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRLP4 232
+ADDRLP4 244
+INDIRI4
+ASGNI4
+LABELV $5266
+ADDRLP4 236
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $5271
+ADDRGP4 $5267
+JUMPV
+LABELV $5271
+ADDRLP4 236
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $5273
+LABELV $5273
+ADDRLP4 240
+ADDRLP4 240
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5267
+ADDRLP4 232
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 64
+LTI4 $5266
+CNSTI4 0
+ARGI4
+ADDRLP4 248
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRGP4 $5276
+ARGP4
+ADDRLP4 252
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5275
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5277
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+ADDRLP4 240
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRLP4 232
+ADDRLP4 252
+INDIRI4
+ASGNI4
+LABELV $5278
+ADDRLP4 236
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $5283
+ADDRGP4 $5279
+JUMPV
+LABELV $5283
+ADDRLP4 236
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $5285
+ADDRGP4 $5279
+JUMPV
+LABELV $5285
+ADDRLP4 240
+ADDRLP4 240
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5279
+ADDRLP4 232
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 64
+LTI4 $5278
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+ADDRGP4 $5287
+ARGP4
+ADDRLP4 260
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 248
+ADDRLP4 260
+INDIRP4
+ASGNP4
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRLP4 244
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 248
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 264
+INDIRI4
+EQI4 $5288
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 244
+ADDRLP4 268
+INDIRI4
+ASGNI4
+LABELV $5288
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $5304
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $5304
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $5304
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $5304
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+EQI4 $5304
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $5304
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+NEI4 $5290
+LABELV $5304
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+LEI4 $5305
+ADDRGP4 $5308
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 244
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5305
+ADDRGP4 $5310
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5290
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+LEI4 $5311
+ADDRGP4 $5314
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 244
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5311
+ADDRGP4 $5316
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5317
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+ADDRLP4 240
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRLP4 232
+ADDRLP4 252
+INDIRI4
+ASGNI4
+LABELV $5318
+ADDRLP4 236
+CNSTI4 4524
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $5323
+ADDRGP4 $5319
+JUMPV
+LABELV $5323
+ADDRLP4 236
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $5325
+ADDRGP4 $5319
+JUMPV
+LABELV $5325
+ADDRLP4 240
+ADDRLP4 240
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5319
+ADDRLP4 232
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 64
+LTI4 $5318
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+ADDRGP4 $5287
+ARGP4
+ADDRLP4 260
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 248
+ADDRLP4 260
+INDIRP4
+ASGNP4
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRLP4 244
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 248
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 264
+INDIRI4
+EQI4 $5327
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 244
+ADDRLP4 268
+INDIRI4
+ASGNI4
+LABELV $5327
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $5343
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $5343
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $5343
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $5343
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+EQI4 $5343
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $5343
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 10
+NEI4 $5329
+LABELV $5343
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+LEI4 $5344
+ADDRGP4 $5308
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 244
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5344
+ADDRGP4 $5310
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5329
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+LEI4 $5348
+ADDRGP4 $5351
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 244
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5348
+ADDRGP4 $5353
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5354
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5355
+ADDRGP4 $3728
+ARGP4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5355
+ADDRGP4 $3728
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5365
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cgs+43260
+INDIRI4
+ARGI4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5368
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cgs+43264
+INDIRI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5371
+CNSTI4 0
+ARGI4
+ADDRLP4 240
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 240
+INDIRP4
+ARGP4
+ADDRGP4 $5373
+ARGP4
+ADDRLP4 244
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5372
+ARGP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5374
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $5375
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $5375
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $5375
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+EQI4 $5375
+ADDRGP4 $4883
+JUMPV
+LABELV $5375
+CNSTI4 662
+ARGI4
+ADDRLP4 252
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43280
+INDIRI4
+ADDRLP4 260
+INDIRI4
+EQI4 $4883
+ADDRGP4 cgs+39708
+INDIRI4
+ADDRLP4 260
+INDIRI4
+EQI4 $4883
+ADDRGP4 cgs+39712
+INDIRI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 1000
+DIVI4
+SUBI4
+CNSTI4 30
+GTI4 $4883
+ADDRGP4 cgs+39712
+INDIRI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 1000
+DIVI4
+SUBI4
+CNSTI4 0
+LTI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cgs+39712
+INDIRI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 1000
+DIVI4
+SUBI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRGP4 colorRed
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5392
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4883
+CNSTI4 671
+ARGI4
+ADDRLP4 252
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 $5396
+ARGP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5397
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4883
+CNSTI4 672
+ARGI4
+ADDRLP4 252
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 $5396
+ARGP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5401
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Draw1stPlaceScore
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5402
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Draw2ndPlaceScore
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5403
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $5404
+ADDRGP4 $3728
+ARGP4
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5404
+ADDRGP4 $3728
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5414
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $5415
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+627496
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 252
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5415
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $5419
+ADDRLP4 256
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 260
+ADDRLP4 256
+INDIRP4
+ASGNP4
+ADDRLP4 264
+ADDRLP4 260
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 260
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 264
+INDIRF4
+MULF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 268
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 272
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 272
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $5420
+JUMPV
+LABELV $5419
+ADDRLP4 256
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 260
+ADDRLP4 256
+INDIRP4
+ASGNP4
+ADDRLP4 264
+ADDRLP4 260
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 260
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 264
+INDIRF4
+MULF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 268
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 272
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 272
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $5420
+ADDRGP4 $232
+ARGP4
+ADDRLP4 252
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5426
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+NEI4 $5427
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $5430
+ADDRGP4 $4883
+JUMPV
+LABELV $5430
+ADDRLP4 252
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRGP4 $5428
+JUMPV
+LABELV $5427
+ADDRLP4 252
+ADDRGP4 cg+3196932+4
+ASGNP4
+LABELV $5428
+ADDRLP4 252
+INDIRP4
+CNSTI4 2252
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5437
+ADDRGP4 $485
+ARGP4
+ADDRLP4 260
+ADDRLP4 252
+INDIRP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+CNSTI4 2252
+ADDP4
+ARGP4
+ADDRLP4 260
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 256
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRGP4 $5438
+JUMPV
+LABELV $5437
+ADDRLP4 256
+ADDRLP4 252
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+LABELV $5438
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5439
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5440
+ADDRGP4 cg+3848216
+INDIRI4
+CNSTI4 0
+EQI4 $5440
+ADDRGP4 cg+3848220
+INDIRI4
+CNSTI4 1
+NEI4 $5440
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5440
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+ADDRLP4 252
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 252
+INDIRI4
+ARGI4
+CNSTI4 719
+ARGI4
+ADDRLP4 256
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRLP4 256
+INDIRI4
+ADDRLP4 260
+INDIRI4
+NEI4 $5449
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 260
+INDIRI4
+EQI4 $5445
+LABELV $5449
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5445
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4528
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5445
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5458
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5459
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4540
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5459
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5472
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5473
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4544
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5473
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5486
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4556
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5492
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 264
+INDIRI4
+ARGI4
+CNSTI4 719
+ARGI4
+ADDRLP4 268
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 272
+INDIRI4
+EQI4 $5493
+ADDRGP4 cg+3848204
+INDIRI4
+ADDRLP4 272
+INDIRI4
+EQI4 $5493
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4536
+INDIRI4
+ARGI4
+ADDRLP4 276
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 276
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5493
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 276
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5506
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5507
+ADDRLP4 276
+ADDRGP4 cg+3196932+4532
+INDIRI4
+ASGNI4
+ADDRGP4 $5508
+JUMPV
+LABELV $5507
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRLP4 276
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5513
+LABELV $5508
+ADDRLP4 276
+INDIRI4
+CNSTI4 41
+GEI4 $5520
+ADDRLP4 280
+CNSTI4 2
+ASGNI4
+ADDRGP4 $5521
+JUMPV
+LABELV $5520
+ADDRLP4 276
+INDIRI4
+CNSTI4 81
+GEI4 $5522
+ADDRLP4 280
+CNSTI4 3
+ASGNI4
+ADDRGP4 $5523
+JUMPV
+LABELV $5522
+ADDRLP4 280
+CNSTI4 1
+ASGNI4
+LABELV $5523
+LABELV $5521
+ADDRGP4 $5524
+ARGP4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5525
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 276
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $5529
+ARGP4
+ADDRLP4 280
+CNSTI4 4524
+ASGNI4
+ADDRLP4 280
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+252
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+256
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5536
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5537
+ADDRGP4 $571
+ARGP4
+ADDRGP4 cg+3196932+4548
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5537
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $571
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5550
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5551
+ADDRLP4 280
+ADDRGP4 cg+3196932+4
+ASGNP4
+ADDRGP4 $5552
+JUMPV
+LABELV $5551
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRLP4 280
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+LABELV $5557
+LABELV $5552
+ADDRLP4 280
+INDIRP4
+CNSTI4 2248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 2248
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5566
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5567
+ADDRLP4 280
+ADDRGP4 cg+3196932+4
+ASGNP4
+ADDRGP4 $5568
+JUMPV
+LABELV $5567
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRLP4 280
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+LABELV $5573
+LABELV $5568
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 2444
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5577
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+NEI4 $5578
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $5581
+ADDRGP4 $4883
+JUMPV
+LABELV $5581
+ADDRLP4 280
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRGP4 $5579
+JUMPV
+LABELV $5578
+ADDRLP4 280
+ADDRGP4 cg+3196932+5088+4
+ASGNP4
+LABELV $5579
+ADDRLP4 280
+INDIRP4
+CNSTI4 2252
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5589
+ADDRGP4 $485
+ARGP4
+ADDRLP4 288
+ADDRLP4 280
+INDIRP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+CNSTI4 2252
+ADDP4
+ARGP4
+ADDRLP4 288
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 284
+ADDRLP4 292
+INDIRP4
+ASGNP4
+ADDRGP4 $5590
+JUMPV
+LABELV $5589
+ADDRLP4 284
+ADDRLP4 280
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+LABELV $5590
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5591
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5601
+ADDRGP4 cg+3848216
+INDIRI4
+CNSTI4 0
+EQI4 $5601
+ADDRGP4 cg+3848220
+INDIRI4
+CNSTI4 2
+EQI4 $5599
+LABELV $5601
+ADDRLP4 280
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 280
+INDIRI4
+EQI4 $5592
+ADDRGP4 cg+3848216
+INDIRI4
+ADDRLP4 280
+INDIRI4
+EQI4 $5592
+LABELV $5599
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5592
+ADDRLP4 284
+CNSTI4 0
+ASGNI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 719
+ARGI4
+ADDRLP4 288
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 292
+CNSTI4 0
+ASGNI4
+ADDRLP4 288
+INDIRI4
+ADDRLP4 292
+INDIRI4
+NEI4 $5606
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 292
+INDIRI4
+EQI4 $5602
+LABELV $5606
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5602
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4528
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5602
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5616
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5617
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4540
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5617
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5631
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5632
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4544
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5632
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5646
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4556
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5653
+ADDRLP4 296
+CNSTI4 0
+ASGNI4
+ADDRLP4 296
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 296
+INDIRI4
+ARGI4
+CNSTI4 719
+ARGI4
+ADDRLP4 300
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 304
+CNSTI4 0
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 304
+INDIRI4
+EQI4 $5654
+ADDRGP4 cg+3848204
+INDIRI4
+ADDRLP4 304
+INDIRI4
+EQI4 $5654
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4536
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $5655
+JUMPV
+LABELV $5654
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $5660
+ADDRGP4 $232
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $5660
+LABELV $5655
+LABELV $5668
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5669
+ADDRLP4 308
+ADDRGP4 cg+3196932+5088+4532
+INDIRI4
+ASGNI4
+ADDRGP4 $5670
+JUMPV
+LABELV $5669
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRLP4 308
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $5676
+LABELV $5670
+ADDRLP4 308
+INDIRI4
+CNSTI4 41
+GEI4 $5683
+ADDRLP4 312
+CNSTI4 2
+ASGNI4
+ADDRGP4 $5684
+JUMPV
+LABELV $5683
+ADDRLP4 308
+INDIRI4
+CNSTI4 81
+GEI4 $5685
+ADDRLP4 312
+CNSTI4 3
+ASGNI4
+ADDRGP4 $5686
+JUMPV
+LABELV $5685
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+LABELV $5686
+LABELV $5684
+ADDRGP4 $5524
+ARGP4
+ADDRLP4 312
+INDIRI4
+ARGI4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5687
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $5529
+ARGP4
+ADDRLP4 312
+CNSTI4 4524
+ASGNI4
+ADDRLP4 312
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+252
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+256
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5697
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5698
+ADDRGP4 $571
+ARGP4
+ADDRGP4 cg+3196932+5088+4548
+INDIRI4
+ARGI4
+ADDRLP4 312
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5698
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 312
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $571
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5712
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5713
+ADDRLP4 312
+ADDRGP4 cg+3196932+5088+4
+ASGNP4
+ADDRGP4 $5714
+JUMPV
+LABELV $5713
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRLP4 312
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+LABELV $5720
+LABELV $5714
+ADDRLP4 312
+INDIRP4
+CNSTI4 2248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 312
+INDIRP4
+CNSTI4 2248
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5729
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $5730
+ADDRLP4 312
+ADDRGP4 cg+3196932+5088+4
+ASGNP4
+ADDRGP4 $5731
+JUMPV
+LABELV $5730
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRLP4 312
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+LABELV $5737
+LABELV $5731
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 312
+INDIRP4
+CNSTI4 2444
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5741
+ADDRGP4 cg+610868
+INDIRI4
+CNSTI4 41
+GEI4 $5742
+ADDRLP4 312
+CNSTI4 2
+ASGNI4
+ADDRGP4 $5743
+JUMPV
+LABELV $5742
+ADDRGP4 cg+610868
+INDIRI4
+CNSTI4 81
+GEI4 $5745
+ADDRLP4 312
+CNSTI4 3
+ASGNI4
+ADDRGP4 $5746
+JUMPV
+LABELV $5745
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+LABELV $5746
+LABELV $5743
+ADDRGP4 $5748
+ARGP4
+ADDRLP4 312
+INDIRI4
+ARGI4
+ADDRGP4 cg+610868
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5750
+ADDRGP4 cg+610872
+INDIRI4
+CNSTI4 41
+GEI4 $5751
+ADDRLP4 312
+CNSTI4 2
+ASGNI4
+ADDRGP4 $5752
+JUMPV
+LABELV $5751
+ADDRGP4 cg+610872
+INDIRI4
+CNSTI4 81
+GEI4 $5754
+ADDRLP4 312
+CNSTI4 3
+ASGNI4
+ADDRGP4 $5755
+JUMPV
+LABELV $5754
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+LABELV $5755
+LABELV $5752
+ADDRGP4 $5748
+ARGP4
+ADDRLP4 312
+INDIRI4
+ARGI4
+ADDRGP4 cg+610872
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5758
+ADDRLP4 312
+CNSTI4 0
+ASGNI4
+CNSTI4 707
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 316
+ADDRLP4 320
+INDIRP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5759
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRGP4 $5764
+ARGP4
+ADDRLP4 324
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5763
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRLP4 332
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $5761
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRGP4 $5764
+ARGP4
+ADDRLP4 336
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5763
+ARGP4
+ADDRLP4 336
+INDIRP4
+ARGP4
+ADDRLP4 340
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 312
+ADDRLP4 344
+INDIRI4
+ASGNI4
+LABELV $5761
+LABELV $5759
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+NEI4 $5765
+ADDRGP4 $5767
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 312
+ADDRLP4 324
+INDIRI4
+ASGNI4
+LABELV $5765
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 312
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5771
+ADDRLP4 312
+CNSTI4 0
+ASGNI4
+CNSTI4 707
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 316
+ADDRLP4 320
+INDIRP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5772
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRGP4 $5776
+ARGP4
+ADDRLP4 324
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5763
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRLP4 332
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $5774
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRGP4 $5776
+ARGP4
+ADDRLP4 336
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5763
+ARGP4
+ADDRLP4 336
+INDIRP4
+ARGP4
+ADDRLP4 340
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 312
+ADDRLP4 344
+INDIRI4
+ASGNI4
+LABELV $5774
+LABELV $5772
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+NEI4 $5777
+ADDRGP4 $5767
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 312
+ADDRLP4 324
+INDIRI4
+ASGNI4
+LABELV $5777
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 312
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5782
+ADDRLP4 312
+CNSTI4 0
+ASGNI4
+CNSTI4 707
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 316
+ADDRLP4 320
+INDIRP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5783
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRGP4 $5787
+ARGP4
+ADDRLP4 324
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5763
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRLP4 332
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $5785
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRGP4 $5787
+ARGP4
+ADDRLP4 336
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5763
+ARGP4
+ADDRLP4 336
+INDIRP4
+ARGP4
+ADDRLP4 340
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 312
+ADDRLP4 344
+INDIRI4
+ASGNI4
+LABELV $5785
+LABELV $5783
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+NEI4 $5788
+ADDRGP4 $5767
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 312
+ADDRLP4 324
+INDIRI4
+ASGNI4
+LABELV $5788
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 312
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5793
+CNSTI4 707
+ARGI4
+ADDRLP4 312
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+ADDRGP4 $5794
+ARGP4
+ADDRLP4 316
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5795
+CNSTI4 707
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRGP4 $5796
+ARGP4
+ADDRLP4 324
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5797
+CNSTI4 707
+ARGI4
+ADDRLP4 328
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRGP4 $5798
+ARGP4
+ADDRLP4 332
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 332
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5799
+CNSTI4 708
+ARGI4
+ADDRLP4 336
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ARGP4
+ADDRGP4 $1454
+ARGP4
+ADDRLP4 340
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5800
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 344
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5801
+CNSTI4 708
+ARGI4
+ADDRLP4 348
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRGP4 $1456
+ARGP4
+ADDRLP4 352
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5800
+ARGP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5802
+CNSTI4 708
+ARGI4
+ADDRLP4 360
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRGP4 $1458
+ARGP4
+ADDRLP4 364
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5800
+ARGP4
+ADDRLP4 364
+INDIRP4
+ARGP4
+ADDRLP4 368
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5803
+CNSTI4 8
+ARGI4
+ADDRLP4 376
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+ARGP4
+ADDRLP4 380
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 372
+ADDRLP4 380
+INDIRI4
+CNSTI4 20000
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+LEI4 $5805
+ADDRGP4 $5807
+ARGP4
+ADDRLP4 372
+INDIRI4
+ARGI4
+ADDRLP4 384
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 384
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5805
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $5808
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5810
+ADDRLP4 372
+CNSTI4 0
+ASGNI4
+ADDRLP4 372
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 372
+INDIRI4
+ARGI4
+CNSTI4 495
+ARGI4
+ADDRLP4 376
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 376
+INDIRI4
+CNSTI4 0
+NEI4 $5815
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $5812
+LABELV $5815
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $5816
+CNSTI4 697
+ARGI4
+ADDRLP4 384
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 384
+INDIRP4
+ARGP4
+ADDRLP4 388
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 380
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRLP4 392
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+LTI4 $5819
+ADDRLP4 392
+INDIRI4
+CNSTI4 64
+GTI4 $5819
+ADDRGP4 $4883
+JUMPV
+LABELV $5819
+ADDRGP4 $5821
+ARGP4
+ADDRLP4 380
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5816
+CNSTI4 697
+ARGI4
+ADDRLP4 380
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 380
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5812
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4883
+CNSTI4 692
+ARGI4
+ADDRLP4 380
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 380
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5826
+ADDRLP4 380
+CNSTI4 0
+ASGNI4
+ADDRLP4 380
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 380
+INDIRI4
+ARGI4
+CNSTI4 495
+ARGI4
+ADDRLP4 384
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 384
+INDIRI4
+CNSTI4 0
+NEI4 $5831
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $5828
+LABELV $5831
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $5832
+CNSTI4 692
+ARGI4
+ADDRLP4 392
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ARGP4
+ADDRLP4 396
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 388
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRLP4 400
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+LTI4 $5835
+ADDRLP4 400
+INDIRI4
+CNSTI4 64
+GTI4 $5835
+ADDRGP4 $4883
+JUMPV
+LABELV $5835
+ADDRGP4 $5837
+ARGP4
+ADDRLP4 388
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5832
+CNSTI4 692
+ARGI4
+ADDRLP4 388
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 388
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5828
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4883
+CNSTI4 691
+ARGI4
+ADDRLP4 388
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 388
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5842
+ADDRLP4 388
+CNSTI4 0
+ASGNI4
+ADDRLP4 388
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+INDIRI4
+ARGI4
+CNSTI4 495
+ARGI4
+ADDRLP4 392
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+NEI4 $5847
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $5844
+LABELV $5847
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $5848
+CNSTI4 691
+ARGI4
+ADDRLP4 400
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 400
+INDIRP4
+ARGP4
+ADDRLP4 404
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 396
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRLP4 408
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRLP4 408
+INDIRI4
+CNSTI4 0
+LTI4 $5851
+ADDRLP4 408
+INDIRI4
+CNSTI4 64
+GTI4 $5851
+ADDRGP4 $4883
+JUMPV
+LABELV $5851
+ADDRGP4 $5853
+ARGP4
+ADDRLP4 396
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5848
+CNSTI4 691
+ARGI4
+ADDRLP4 396
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 396
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5844
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4883
+CNSTI4 690
+ARGI4
+ADDRLP4 396
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 396
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5857
+ADDRLP4 396
+ADDRGP4 CG_GetLocalTimeString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 396
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5858
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $5859
+ADDRLP4 396
+ADDRGP4 $5862
+ASGNP4
+ADDRGP4 $5860
+JUMPV
+LABELV $5859
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $5863
+ADDRLP4 396
+ADDRGP4 $5866
+ASGNP4
+ADDRGP4 $5864
+JUMPV
+LABELV $5863
+ADDRLP4 396
+ADDRGP4 $5867
+ASGNP4
+LABELV $5864
+LABELV $5860
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $5868
+CNSTI4 0
+ARGI4
+ADDRLP4 464
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 464
+INDIRP4
+ARGP4
+ADDRGP4 $5872
+ARGP4
+ADDRLP4 468
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 472
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 472
+INDIRP4
+ARGP4
+ADDRGP4 $5873
+ARGP4
+ADDRLP4 476
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+CNSTI4 3
+ARGI4
+ADDRLP4 480
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 $5871
+ARGP4
+ADDRLP4 396
+INDIRP4
+ARGP4
+ADDRLP4 468
+INDIRP4
+ARGP4
+ADDRLP4 476
+INDIRP4
+ARGP4
+ADDRLP4 480
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 484
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTI4 53
+ARGI4
+ADDRGP4 CG_LimitText
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5868
+ADDRLP4 400
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+ARGI4
+ADDRLP4 464
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 464
+INDIRP4
+ARGP4
+ADDRGP4 $5874
+ARGP4
+ADDRLP4 468
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 400
+ARGP4
+ADDRLP4 468
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 472
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 472
+INDIRP4
+ARGP4
+ADDRGP4 $5872
+ARGP4
+ADDRLP4 476
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5875
+ARGP4
+ADDRLP4 396
+INDIRP4
+ARGP4
+ADDRLP4 476
+INDIRP4
+ARGP4
+ADDRLP4 400
+ARGP4
+ADDRLP4 480
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 480
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTI4 53
+ARGI4
+ADDRGP4 CG_LimitText
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5876
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+32+16
+INDIRI4
+ARGI4
+ADDRLP4 396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 396
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5881
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+64+16
+INDIRI4
+ARGI4
+ADDRLP4 400
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 400
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5886
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+448+16
+INDIRI4
+ARGI4
+ADDRLP4 404
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 404
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5891
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+96+16
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 408
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5896
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+128+16
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 412
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5901
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+160+16
+INDIRI4
+ARGI4
+ADDRLP4 416
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 416
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5906
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+192+16
+INDIRI4
+ARGI4
+ADDRLP4 420
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 420
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5911
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+224+16
+INDIRI4
+ARGI4
+ADDRLP4 424
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 424
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5916
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+256+16
+INDIRI4
+ARGI4
+ADDRLP4 428
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 428
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5921
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+288+16
+INDIRI4
+ARGI4
+ADDRLP4 432
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 432
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5926
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+416+16
+INDIRI4
+ARGI4
+ADDRLP4 436
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 436
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5931
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+352+16
+INDIRI4
+ARGI4
+ADDRLP4 440
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 440
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5936
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+384+16
+INDIRI4
+ARGI4
+ADDRLP4 444
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 444
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5941
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+64
+INDIRI4
+ARGI4
+ADDRLP4 448
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 448
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5945
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+448
+INDIRI4
+ARGI4
+ADDRLP4 452
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 452
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5949
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+96
+INDIRI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 456
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5953
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+128
+INDIRI4
+ARGI4
+ADDRLP4 460
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 460
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5957
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+160
+INDIRI4
+ARGI4
+ADDRLP4 464
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 464
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5961
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+192
+INDIRI4
+ARGI4
+ADDRLP4 468
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 468
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5965
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+224
+INDIRI4
+ARGI4
+ADDRLP4 472
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 472
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5969
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+256
+INDIRI4
+ARGI4
+ADDRLP4 476
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 476
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5973
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+288
+INDIRI4
+ARGI4
+ADDRLP4 480
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 480
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5977
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+416
+INDIRI4
+ARGI4
+ADDRLP4 484
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 484
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5981
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+352
+INDIRI4
+ARGI4
+ADDRLP4 488
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 488
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5985
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+384
+INDIRI4
+ARGI4
+ADDRLP4 492
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 492
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5989
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+64+4
+INDIRI4
+ARGI4
+ADDRLP4 496
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 496
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5994
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+448+4
+INDIRI4
+ARGI4
+ADDRLP4 500
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 500
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $5999
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+96+4
+INDIRI4
+ARGI4
+ADDRLP4 504
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 504
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6004
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+128+4
+INDIRI4
+ARGI4
+ADDRLP4 508
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 508
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6009
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+160+4
+INDIRI4
+ARGI4
+ADDRLP4 512
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 512
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6014
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+192+4
+INDIRI4
+ARGI4
+ADDRLP4 516
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 516
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6019
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+224+4
+INDIRI4
+ARGI4
+ADDRLP4 520
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 520
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6024
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+256+4
+INDIRI4
+ARGI4
+ADDRLP4 524
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 524
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6029
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+288+4
+INDIRI4
+ARGI4
+ADDRLP4 528
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 528
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6034
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+416+4
+INDIRI4
+ARGI4
+ADDRLP4 532
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 532
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6039
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+352+4
+INDIRI4
+ARGI4
+ADDRLP4 536
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 536
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6044
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+384+4
+INDIRI4
+ARGI4
+ADDRLP4 540
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 540
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6049
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+32+12
+INDIRI4
+ARGI4
+ADDRLP4 544
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 544
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6054
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+64+12
+INDIRI4
+ARGI4
+ADDRLP4 548
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 548
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6059
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+448+12
+INDIRI4
+ARGI4
+ADDRLP4 552
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 552
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6064
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+96+12
+INDIRI4
+ARGI4
+ADDRLP4 556
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 556
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6069
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+128+12
+INDIRI4
+ARGI4
+ADDRLP4 560
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 560
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6074
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+160+12
+INDIRI4
+ARGI4
+ADDRLP4 564
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 564
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6079
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+192+12
+INDIRI4
+ARGI4
+ADDRLP4 568
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 568
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6084
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+224+12
+INDIRI4
+ARGI4
+ADDRLP4 572
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 572
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6089
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+256+12
+INDIRI4
+ARGI4
+ADDRLP4 576
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 576
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6094
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+288+12
+INDIRI4
+ARGI4
+ADDRLP4 580
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 580
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6099
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+416+12
+INDIRI4
+ARGI4
+ADDRLP4 584
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 584
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6104
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+352+12
+INDIRI4
+ARGI4
+ADDRLP4 588
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 588
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6109
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4608+384+12
+INDIRI4
+ARGI4
+ADDRLP4 592
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 592
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6114
+ADDRLP4 92
+CNSTI4 2
+ASGNI4
+ADDRLP4 596
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 596
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 596
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+LTI4 $6115
+ADDRLP4 600
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 600
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 600
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 604
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 604
+INDIRP4
+ASGNP4
+ADDRGP4 $6116
+JUMPV
+LABELV $6115
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 604
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 604
+INDIRP4
+ASGNP4
+LABELV $6116
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6137
+ADDRLP4 92
+CNSTI4 14
+ASGNI4
+ADDRLP4 600
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 600
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 600
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+LTI4 $6138
+ADDRLP4 604
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 604
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 604
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 608
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 608
+INDIRP4
+ASGNP4
+ADDRGP4 $6139
+JUMPV
+LABELV $6138
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 608
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 608
+INDIRP4
+ASGNP4
+LABELV $6139
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6159
+ADDRLP4 92
+CNSTI4 3
+ASGNI4
+ADDRLP4 604
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 604
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+LTI4 $6160
+ADDRLP4 608
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 612
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 612
+INDIRP4
+ASGNP4
+ADDRGP4 $6161
+JUMPV
+LABELV $6160
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 612
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 612
+INDIRP4
+ASGNP4
+LABELV $6161
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6181
+ADDRLP4 92
+CNSTI4 4
+ASGNI4
+ADDRLP4 608
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 608
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 608
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+LTI4 $6182
+ADDRLP4 612
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 612
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 612
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 616
+INDIRP4
+ASGNP4
+ADDRGP4 $6183
+JUMPV
+LABELV $6182
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 616
+INDIRP4
+ASGNP4
+LABELV $6183
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6203
+ADDRLP4 612
+CNSTI4 5
+ASGNI4
+ADDRLP4 92
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRLP4 616
+ADDRLP4 92
+INDIRI4
+ADDRLP4 612
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 616
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+LTI4 $6204
+ADDRLP4 620
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 620
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 620
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 624
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 624
+INDIRP4
+ASGNP4
+ADDRGP4 $6205
+JUMPV
+LABELV $6204
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 624
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 624
+INDIRP4
+ASGNP4
+LABELV $6205
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6225
+ADDRLP4 92
+CNSTI4 6
+ASGNI4
+ADDRLP4 620
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 620
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+LTI4 $6226
+ADDRLP4 624
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 624
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 624
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 628
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 628
+INDIRP4
+ASGNP4
+ADDRGP4 $6227
+JUMPV
+LABELV $6226
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 628
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 628
+INDIRP4
+ASGNP4
+LABELV $6227
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6247
+ADDRLP4 92
+CNSTI4 7
+ASGNI4
+ADDRLP4 624
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 624
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+LTI4 $6248
+ADDRLP4 628
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 628
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 628
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 632
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 632
+INDIRP4
+ASGNP4
+ADDRGP4 $6249
+JUMPV
+LABELV $6248
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 632
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 632
+INDIRP4
+ASGNP4
+LABELV $6249
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6269
+ADDRLP4 92
+CNSTI4 8
+ASGNI4
+ADDRLP4 628
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 628
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+LTI4 $6270
+ADDRLP4 632
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 632
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 632
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 636
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 636
+INDIRP4
+ASGNP4
+ADDRGP4 $6271
+JUMPV
+LABELV $6270
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 636
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 636
+INDIRP4
+ASGNP4
+LABELV $6271
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6291
+ADDRLP4 92
+CNSTI4 9
+ASGNI4
+ADDRLP4 632
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 632
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+LTI4 $6292
+ADDRLP4 636
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 636
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 636
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 640
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 640
+INDIRP4
+ASGNP4
+ADDRGP4 $6293
+JUMPV
+LABELV $6292
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 640
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 640
+INDIRP4
+ASGNP4
+LABELV $6293
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6313
+ADDRLP4 92
+CNSTI4 13
+ASGNI4
+ADDRLP4 636
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 636
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+LTI4 $6314
+ADDRLP4 640
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 640
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 640
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 644
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 644
+INDIRP4
+ASGNP4
+ADDRGP4 $6315
+JUMPV
+LABELV $6314
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 644
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 644
+INDIRP4
+ASGNP4
+LABELV $6315
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6335
+ADDRLP4 92
+CNSTI4 11
+ASGNI4
+ADDRLP4 640
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 640
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+LTI4 $6336
+ADDRLP4 644
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 644
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 644
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 648
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 648
+INDIRP4
+ASGNP4
+ADDRGP4 $6337
+JUMPV
+LABELV $6336
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 648
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 648
+INDIRP4
+ASGNP4
+LABELV $6337
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6357
+ADDRLP4 92
+CNSTI4 12
+ASGNI4
+ADDRLP4 644
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 644
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+LTI4 $6358
+ADDRLP4 648
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 648
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 648
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 652
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 652
+INDIRP4
+ASGNP4
+ADDRGP4 $6359
+JUMPV
+LABELV $6358
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 652
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 652
+INDIRP4
+ASGNP4
+LABELV $6359
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6379
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4576
+INDIRI4
+ARGI4
+ADDRLP4 648
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 648
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6382
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4584
+INDIRI4
+ARGI4
+ADDRLP4 652
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 652
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6385
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4592
+INDIRI4
+ARGI4
+ADDRLP4 656
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 656
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6388
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4600
+INDIRI4
+ARGI4
+ADDRLP4 660
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 660
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6391
+ADDRGP4 cg+3196932+4576
+INDIRI4
+CNSTI4 0
+EQI4 $6392
+ADDRGP4 $4748
+ARGP4
+ADDRGP4 cg+3196932+4580
+INDIRF4
+ARGF4
+ADDRLP4 664
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 664
+INDIRP4
+ASGNP4
+ADDRGP4 $6393
+JUMPV
+LABELV $6392
+ADDRLP4 112
+ADDRGP4 $554
+ASGNP4
+LABELV $6393
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6398
+ADDRGP4 cg+3196932+4584
+INDIRI4
+CNSTI4 0
+EQI4 $6399
+ADDRGP4 $4748
+ARGP4
+ADDRGP4 cg+3196932+4588
+INDIRF4
+ARGF4
+ADDRLP4 664
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 664
+INDIRP4
+ASGNP4
+ADDRGP4 $6400
+JUMPV
+LABELV $6399
+ADDRLP4 112
+ADDRGP4 $554
+ASGNP4
+LABELV $6400
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6405
+ADDRGP4 cg+3196932+4592
+INDIRI4
+CNSTI4 0
+EQI4 $6406
+ADDRGP4 $4748
+ARGP4
+ADDRGP4 cg+3196932+4596
+INDIRF4
+ARGF4
+ADDRLP4 664
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 664
+INDIRP4
+ASGNP4
+ADDRGP4 $6407
+JUMPV
+LABELV $6406
+ADDRLP4 112
+ADDRGP4 $554
+ASGNP4
+LABELV $6407
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6412
+ADDRGP4 cg+3196932+4600
+INDIRI4
+CNSTI4 0
+EQI4 $6413
+ADDRGP4 $4748
+ARGP4
+ADDRGP4 cg+3196932+4604
+INDIRF4
+ARGF4
+ADDRLP4 664
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 664
+INDIRP4
+ASGNP4
+ADDRGP4 $6414
+JUMPV
+LABELV $6413
+ADDRLP4 112
+ADDRGP4 $554
+ASGNP4
+LABELV $6414
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6419
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+32+16
+INDIRI4
+ARGI4
+ADDRLP4 664
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 664
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6425
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+64+16
+INDIRI4
+ARGI4
+ADDRLP4 668
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 668
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6431
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+448+16
+INDIRI4
+ARGI4
+ADDRLP4 672
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 672
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6437
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+96+16
+INDIRI4
+ARGI4
+ADDRLP4 676
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 676
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6443
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+128+16
+INDIRI4
+ARGI4
+ADDRLP4 680
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 680
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6449
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+160+16
+INDIRI4
+ARGI4
+ADDRLP4 684
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 684
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6455
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+192+16
+INDIRI4
+ARGI4
+ADDRLP4 688
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 688
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6461
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+224+16
+INDIRI4
+ARGI4
+ADDRLP4 692
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 692
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6467
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+256+16
+INDIRI4
+ARGI4
+ADDRLP4 696
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 696
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6473
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+288+16
+INDIRI4
+ARGI4
+ADDRLP4 700
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 700
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6479
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+416+16
+INDIRI4
+ARGI4
+ADDRLP4 704
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 704
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6485
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+352+16
+INDIRI4
+ARGI4
+ADDRLP4 708
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 708
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6491
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+384+16
+INDIRI4
+ARGI4
+ADDRLP4 712
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 712
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6497
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+64
+INDIRI4
+ARGI4
+ADDRLP4 716
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 716
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6502
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+448
+INDIRI4
+ARGI4
+ADDRLP4 720
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 720
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6507
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+96
+INDIRI4
+ARGI4
+ADDRLP4 724
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 724
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6512
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+128
+INDIRI4
+ARGI4
+ADDRLP4 728
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 728
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6517
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+160
+INDIRI4
+ARGI4
+ADDRLP4 732
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 732
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6522
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+192
+INDIRI4
+ARGI4
+ADDRLP4 736
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 736
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6527
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+224
+INDIRI4
+ARGI4
+ADDRLP4 740
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 740
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6532
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+256
+INDIRI4
+ARGI4
+ADDRLP4 744
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 744
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6537
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+288
+INDIRI4
+ARGI4
+ADDRLP4 748
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 748
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6542
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+416
+INDIRI4
+ARGI4
+ADDRLP4 752
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 752
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6547
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+352
+INDIRI4
+ARGI4
+ADDRLP4 756
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 756
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6552
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+384
+INDIRI4
+ARGI4
+ADDRLP4 760
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 760
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6557
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+64+4
+INDIRI4
+ARGI4
+ADDRLP4 764
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 764
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6563
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+448+4
+INDIRI4
+ARGI4
+ADDRLP4 768
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 768
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6569
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+96+4
+INDIRI4
+ARGI4
+ADDRLP4 772
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 772
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6575
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+128+4
+INDIRI4
+ARGI4
+ADDRLP4 776
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 776
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6581
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+160+4
+INDIRI4
+ARGI4
+ADDRLP4 780
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 780
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6587
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+192+4
+INDIRI4
+ARGI4
+ADDRLP4 784
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 784
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6593
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+224+4
+INDIRI4
+ARGI4
+ADDRLP4 788
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 788
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6599
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+256+4
+INDIRI4
+ARGI4
+ADDRLP4 792
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 792
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6605
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+288+4
+INDIRI4
+ARGI4
+ADDRLP4 796
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 796
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6611
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+416+4
+INDIRI4
+ARGI4
+ADDRLP4 800
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 800
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6617
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+352+4
+INDIRI4
+ARGI4
+ADDRLP4 804
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 804
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6623
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+384+4
+INDIRI4
+ARGI4
+ADDRLP4 808
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 808
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6629
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+32+12
+INDIRI4
+ARGI4
+ADDRLP4 812
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 812
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6635
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+64+12
+INDIRI4
+ARGI4
+ADDRLP4 816
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 816
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6641
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+448+12
+INDIRI4
+ARGI4
+ADDRLP4 820
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 820
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6647
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+96+12
+INDIRI4
+ARGI4
+ADDRLP4 824
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 824
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6653
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+128+12
+INDIRI4
+ARGI4
+ADDRLP4 828
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 828
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6659
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+160+12
+INDIRI4
+ARGI4
+ADDRLP4 832
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 832
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6665
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+192+12
+INDIRI4
+ARGI4
+ADDRLP4 836
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 836
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6671
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+224+12
+INDIRI4
+ARGI4
+ADDRLP4 840
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 840
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6677
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+256+12
+INDIRI4
+ARGI4
+ADDRLP4 844
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 844
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6683
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+288+12
+INDIRI4
+ARGI4
+ADDRLP4 848
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 848
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6689
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+416+12
+INDIRI4
+ARGI4
+ADDRLP4 852
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 852
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6695
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+352+12
+INDIRI4
+ARGI4
+ADDRLP4 856
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 856
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6701
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4608+384+12
+INDIRI4
+ARGI4
+ADDRLP4 860
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 860
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6707
+ADDRLP4 92
+CNSTI4 2
+ASGNI4
+ADDRLP4 864
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 864
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 864
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+LTI4 $6708
+ADDRLP4 868
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 868
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 868
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 872
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 872
+INDIRP4
+ASGNP4
+ADDRGP4 $6709
+JUMPV
+LABELV $6708
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 872
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 872
+INDIRP4
+ASGNP4
+LABELV $6709
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6731
+ADDRLP4 92
+CNSTI4 14
+ASGNI4
+ADDRLP4 868
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 868
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+LTI4 $6732
+ADDRLP4 872
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 872
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 872
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 876
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 876
+INDIRP4
+ASGNP4
+ADDRGP4 $6733
+JUMPV
+LABELV $6732
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 876
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 876
+INDIRP4
+ASGNP4
+LABELV $6733
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6755
+ADDRLP4 92
+CNSTI4 3
+ASGNI4
+ADDRLP4 872
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 872
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 872
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+LTI4 $6756
+ADDRLP4 876
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 876
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 876
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 880
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 880
+INDIRP4
+ASGNP4
+ADDRGP4 $6757
+JUMPV
+LABELV $6756
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 880
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 880
+INDIRP4
+ASGNP4
+LABELV $6757
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6779
+ADDRLP4 92
+CNSTI4 4
+ASGNI4
+ADDRLP4 876
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 876
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 876
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+LTI4 $6780
+ADDRLP4 880
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 880
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 880
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 884
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 884
+INDIRP4
+ASGNP4
+ADDRGP4 $6781
+JUMPV
+LABELV $6780
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 884
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 884
+INDIRP4
+ASGNP4
+LABELV $6781
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6803
+ADDRLP4 880
+CNSTI4 5
+ASGNI4
+ADDRLP4 92
+ADDRLP4 880
+INDIRI4
+ASGNI4
+ADDRLP4 884
+ADDRLP4 92
+INDIRI4
+ADDRLP4 880
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 884
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 884
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+LTI4 $6804
+ADDRLP4 888
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 888
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 888
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 892
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 892
+INDIRP4
+ASGNP4
+ADDRGP4 $6805
+JUMPV
+LABELV $6804
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 892
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 892
+INDIRP4
+ASGNP4
+LABELV $6805
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6827
+ADDRLP4 92
+CNSTI4 6
+ASGNI4
+ADDRLP4 888
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 888
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 888
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+LTI4 $6828
+ADDRLP4 892
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 892
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 892
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 896
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 896
+INDIRP4
+ASGNP4
+ADDRGP4 $6829
+JUMPV
+LABELV $6828
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 896
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 896
+INDIRP4
+ASGNP4
+LABELV $6829
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6851
+ADDRLP4 92
+CNSTI4 7
+ASGNI4
+ADDRLP4 892
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 892
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 892
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+LTI4 $6852
+ADDRLP4 896
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 896
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 896
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 900
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 900
+INDIRP4
+ASGNP4
+ADDRGP4 $6853
+JUMPV
+LABELV $6852
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 900
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 900
+INDIRP4
+ASGNP4
+LABELV $6853
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6875
+ADDRLP4 92
+CNSTI4 8
+ASGNI4
+ADDRLP4 896
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 896
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 896
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+LTI4 $6876
+ADDRLP4 900
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 900
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 900
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 904
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 904
+INDIRP4
+ASGNP4
+ADDRGP4 $6877
+JUMPV
+LABELV $6876
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 904
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 904
+INDIRP4
+ASGNP4
+LABELV $6877
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6899
+ADDRLP4 92
+CNSTI4 9
+ASGNI4
+ADDRLP4 900
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 900
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 900
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+LTI4 $6900
+ADDRLP4 904
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 904
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 904
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 908
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 908
+INDIRP4
+ASGNP4
+ADDRGP4 $6901
+JUMPV
+LABELV $6900
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 908
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 908
+INDIRP4
+ASGNP4
+LABELV $6901
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6923
+ADDRLP4 92
+CNSTI4 13
+ASGNI4
+ADDRLP4 904
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 904
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 904
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+LTI4 $6924
+ADDRLP4 908
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 908
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 908
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 912
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 912
+INDIRP4
+ASGNP4
+ADDRGP4 $6925
+JUMPV
+LABELV $6924
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 912
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 912
+INDIRP4
+ASGNP4
+LABELV $6925
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6947
+ADDRLP4 92
+CNSTI4 11
+ASGNI4
+ADDRLP4 908
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 908
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 908
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+LTI4 $6948
+ADDRLP4 912
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 912
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 912
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 916
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 916
+INDIRP4
+ASGNP4
+ADDRGP4 $6949
+JUMPV
+LABELV $6948
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 916
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 916
+INDIRP4
+ASGNP4
+LABELV $6949
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6971
+ADDRLP4 92
+CNSTI4 12
+ASGNI4
+ADDRLP4 912
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 912
+INDIRI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ADDRLP4 912
+INDIRI4
+ADDRGP4 cg+3196932+4608+8
+ADDP4
+INDIRI4
+LTI4 $6972
+ADDRLP4 916
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 916
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 916
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $6127
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 920
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 920
+INDIRP4
+ASGNP4
+ADDRGP4 $6973
+JUMPV
+LABELV $6972
+ADDRLP4 96
+ADDRFP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+ADDRFP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRFP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+3196932+5088+4608+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 920
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 920
+INDIRP4
+ASGNP4
+LABELV $6973
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6995
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4576
+INDIRI4
+ARGI4
+ADDRLP4 916
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 916
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $6999
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4584
+INDIRI4
+ARGI4
+ADDRLP4 920
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 920
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7003
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4592
+INDIRI4
+ARGI4
+ADDRLP4 924
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 924
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7007
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4600
+INDIRI4
+ARGI4
+ADDRLP4 928
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 928
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7011
+ADDRGP4 cg+3196932+5088+4576
+INDIRI4
+CNSTI4 0
+EQI4 $7012
+ADDRGP4 $4748
+ARGP4
+ADDRGP4 cg+3196932+5088+4580
+INDIRF4
+ARGF4
+ADDRLP4 932
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 932
+INDIRP4
+ASGNP4
+ADDRGP4 $7013
+JUMPV
+LABELV $7012
+ADDRLP4 112
+ADDRGP4 $554
+ASGNP4
+LABELV $7013
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7020
+ADDRGP4 cg+3196932+5088+4584
+INDIRI4
+CNSTI4 0
+EQI4 $7021
+ADDRGP4 $4748
+ARGP4
+ADDRGP4 cg+3196932+5088+4588
+INDIRF4
+ARGF4
+ADDRLP4 932
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 932
+INDIRP4
+ASGNP4
+ADDRGP4 $7022
+JUMPV
+LABELV $7021
+ADDRLP4 112
+ADDRGP4 $554
+ASGNP4
+LABELV $7022
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7029
+ADDRGP4 cg+3196932+5088+4592
+INDIRI4
+CNSTI4 0
+EQI4 $7030
+ADDRGP4 $4748
+ARGP4
+ADDRGP4 cg+3196932+5088+4596
+INDIRF4
+ARGF4
+ADDRLP4 932
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 932
+INDIRP4
+ASGNP4
+ADDRGP4 $7031
+JUMPV
+LABELV $7030
+ADDRLP4 112
+ADDRGP4 $554
+ASGNP4
+LABELV $7031
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7038
+ADDRGP4 cg+3196932+5088+4600
+INDIRI4
+CNSTI4 0
+EQI4 $7039
+ADDRGP4 $4748
+ARGP4
+ADDRGP4 cg+3196932+5088+4604
+INDIRF4
+ARGF4
+ADDRLP4 932
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 932
+INDIRP4
+ASGNP4
+ADDRGP4 $7040
+JUMPV
+LABELV $7039
+ADDRLP4 112
+ADDRGP4 $554
+ASGNP4
+LABELV $7040
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7047
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $7048
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $7051
+ADDRGP4 cg+3196932+4560
+INDIRI4
+CNSTI4 -1
+NEI4 $7051
+ADDRGP4 $4883
+JUMPV
+LABELV $7051
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4560
+INDIRI4
+ARGI4
+ADDRLP4 932
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 932
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7048
+ADDRLP4 932
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 932
+INDIRI4
+NEI4 $4883
+ADDRGP4 cg+610848
+INDIRI4
+ADDRLP4 932
+INDIRI4
+EQI4 $4883
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 936
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 936
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 940
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 940
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7070
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $7071
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $7074
+ADDRGP4 cg+3196932+4564
+INDIRI4
+CNSTI4 -1
+NEI4 $7074
+ADDRGP4 $4883
+JUMPV
+LABELV $7074
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4564
+INDIRI4
+ARGI4
+ADDRLP4 936
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 936
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7071
+ADDRLP4 936
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 936
+INDIRI4
+NEI4 $4883
+ADDRGP4 cg+610848
+INDIRI4
+ADDRLP4 936
+INDIRI4
+EQI4 $4883
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 940
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 940
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 944
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 944
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7093
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $7094
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $7097
+ADDRGP4 cg+3196932+4568
+INDIRI4
+CNSTI4 -1
+NEI4 $7097
+ADDRGP4 $4883
+JUMPV
+LABELV $7097
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4568
+INDIRI4
+ARGI4
+ADDRLP4 940
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 940
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7094
+ADDRLP4 940
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 940
+INDIRI4
+NEI4 $4883
+ADDRGP4 cg+610848
+INDIRI4
+ADDRLP4 940
+INDIRI4
+EQI4 $4883
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 944
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 944
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 948
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 948
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7116
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $7117
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $7120
+ADDRGP4 cg+3196932+5088+4560
+INDIRI4
+CNSTI4 -1
+NEI4 $7120
+ADDRGP4 $4883
+JUMPV
+LABELV $7120
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4560
+INDIRI4
+ARGI4
+ADDRLP4 944
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 944
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7117
+ADDRLP4 944
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 944
+INDIRI4
+NEI4 $4883
+ADDRGP4 cg+610848
+INDIRI4
+ADDRLP4 944
+INDIRI4
+EQI4 $4883
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 948
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 952
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 952
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7141
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $7142
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $7145
+ADDRGP4 cg+3196932+5088+4564
+INDIRI4
+CNSTI4 -1
+NEI4 $7145
+ADDRGP4 $4883
+JUMPV
+LABELV $7145
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4564
+INDIRI4
+ARGI4
+ADDRLP4 948
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 948
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7142
+ADDRLP4 948
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 948
+INDIRI4
+NEI4 $4883
+ADDRGP4 cg+610848
+INDIRI4
+ADDRLP4 948
+INDIRI4
+EQI4 $4883
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 952
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 956
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 956
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7166
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $7167
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $7170
+ADDRGP4 cg+3196932+5088+4568
+INDIRI4
+CNSTI4 -1
+NEI4 $7170
+ADDRGP4 $4883
+JUMPV
+LABELV $7170
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4568
+INDIRI4
+ARGI4
+ADDRLP4 952
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 952
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7167
+ADDRLP4 952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 952
+INDIRI4
+NEI4 $4883
+ADDRGP4 cg+610848
+INDIRI4
+ADDRLP4 952
+INDIRI4
+EQI4 $4883
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 956
+ADDRGP4 CG_DuelPlayerScoreValid
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+CNSTI4 92
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 960
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 960
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7191
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $7192
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 956
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 960
+CNSTI4 0
+ASGNI4
+ADDRLP4 956
+INDIRI4
+ADDRLP4 960
+INDIRI4
+EQI4 $7195
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 cg+3848208
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 960
+INDIRI4
+EQI4 $7195
+ADDRGP4 $7200
+ARGP4
+ADDRLP4 964
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 964
+INDIRI4
+ASGNI4
+ADDRGP4 $7193
+JUMPV
+LABELV $7195
+ADDRGP4 $7201
+ARGP4
+ADDRLP4 964
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 964
+INDIRI4
+ASGNI4
+ADDRGP4 $7193
+JUMPV
+LABELV $7192
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $7202
+CNSTI4 1
+ARGI4
+CNSTI4 50
+ARGI4
+ADDRGP4 $3096
+ARGP4
+ADDRLP4 956
+ADDRGP4 CG_CheckCpmaVersion
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+EQI4 $7202
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $7205
+ADDRGP4 cg+3196932+4528
+INDIRI4
+ADDRGP4 cg+3196932+5088+4528
+INDIRI4
+GTI4 $7216
+ADDRGP4 cg+3848216
+INDIRI4
+CNSTI4 0
+EQI4 $7208
+LABELV $7216
+ADDRGP4 $7217
+ARGP4
+ADDRLP4 960
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 960
+INDIRI4
+ASGNI4
+ADDRGP4 $7203
+JUMPV
+LABELV $7208
+ADDRGP4 cg+3196932+4528
+INDIRI4
+ADDRGP4 cg+3196932+5088+4528
+INDIRI4
+GEI4 $7218
+ADDRGP4 $7225
+ARGP4
+ADDRLP4 960
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 960
+INDIRI4
+ASGNI4
+ADDRGP4 $7203
+JUMPV
+LABELV $7218
+ADDRGP4 $7226
+ARGP4
+ADDRLP4 960
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 960
+INDIRI4
+ASGNI4
+ADDRGP4 $7203
+JUMPV
+LABELV $7205
+ADDRGP4 $7226
+ARGP4
+ADDRLP4 960
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 960
+INDIRI4
+ASGNI4
+ADDRGP4 $7203
+JUMPV
+LABELV $7202
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 960
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $7227
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 964
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 964
+INDIRI4
+CNSTI4 0
+NEI4 $7227
+ADDRGP4 $7226
+ARGP4
+ADDRLP4 968
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 968
+INDIRI4
+ASGNI4
+ADDRGP4 $7228
+JUMPV
+LABELV $7227
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 968
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 968
+INDIRI4
+CNSTI4 0
+EQI4 $7231
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 972
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+NEI4 $7231
+ADDRGP4 $7217
+ARGP4
+ADDRLP4 976
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 976
+INDIRI4
+ASGNI4
+ADDRGP4 $7232
+JUMPV
+LABELV $7231
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 976
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 976
+INDIRI4
+CNSTI4 0
+NEI4 $7235
+ADDRGP4 $7225
+ARGP4
+ADDRLP4 980
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 980
+INDIRI4
+ASGNI4
+ADDRGP4 $7236
+JUMPV
+LABELV $7235
+ADDRLP4 980
+CNSTI4 4524
+ASGNI4
+ADDRLP4 980
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRLP4 980
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+LEI4 $7238
+ADDRGP4 $7217
+ARGP4
+ADDRLP4 984
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 984
+INDIRI4
+ASGNI4
+ADDRGP4 $7239
+JUMPV
+LABELV $7238
+ADDRLP4 984
+CNSTI4 4524
+ASGNI4
+ADDRLP4 984
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRLP4 984
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+GEI4 $7246
+ADDRGP4 $7225
+ARGP4
+ADDRLP4 988
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 988
+INDIRI4
+ASGNI4
+ADDRGP4 $7247
+JUMPV
+LABELV $7246
+ADDRGP4 $7226
+ARGP4
+ADDRLP4 988
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 988
+INDIRI4
+ASGNI4
+LABELV $7247
+LABELV $7239
+LABELV $7236
+LABELV $7232
+LABELV $7228
+LABELV $7203
+LABELV $7193
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7257
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $7258
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 960
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 964
+CNSTI4 0
+ASGNI4
+ADDRLP4 960
+INDIRI4
+ADDRLP4 964
+INDIRI4
+EQI4 $7261
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 cg+3848212
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 964
+INDIRI4
+EQI4 $7261
+ADDRGP4 $7266
+ARGP4
+ADDRLP4 968
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 968
+INDIRI4
+ASGNI4
+ADDRGP4 $7259
+JUMPV
+LABELV $7261
+ADDRGP4 $7267
+ARGP4
+ADDRLP4 968
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 968
+INDIRI4
+ASGNI4
+ADDRGP4 $7259
+JUMPV
+LABELV $7258
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $7268
+CNSTI4 1
+ARGI4
+CNSTI4 50
+ARGI4
+ADDRGP4 $3096
+ARGP4
+ADDRLP4 960
+ADDRGP4 CG_CheckCpmaVersion
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+EQI4 $7268
+ADDRGP4 cg+3848204
+INDIRI4
+CNSTI4 0
+EQI4 $7271
+ADDRGP4 cg+3196932+5088+4528
+INDIRI4
+ADDRGP4 cg+3196932+4528
+INDIRI4
+LTI4 $7282
+ADDRGP4 cg+3848216
+INDIRI4
+CNSTI4 0
+EQI4 $7274
+LABELV $7282
+ADDRGP4 $7283
+ARGP4
+ADDRLP4 964
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 964
+INDIRI4
+ASGNI4
+ADDRGP4 $7269
+JUMPV
+LABELV $7274
+ADDRGP4 cg+3196932+5088+4528
+INDIRI4
+ADDRGP4 cg+3196932+4528
+INDIRI4
+LEI4 $7284
+ADDRGP4 $7291
+ARGP4
+ADDRLP4 964
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 964
+INDIRI4
+ASGNI4
+ADDRGP4 $7269
+JUMPV
+LABELV $7284
+ADDRGP4 $7292
+ARGP4
+ADDRLP4 964
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 964
+INDIRI4
+ASGNI4
+ADDRGP4 $7269
+JUMPV
+LABELV $7271
+ADDRGP4 $7292
+ARGP4
+ADDRLP4 964
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 964
+INDIRI4
+ASGNI4
+ADDRGP4 $7269
+JUMPV
+LABELV $7268
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 964
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 964
+INDIRI4
+CNSTI4 0
+NEI4 $7293
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 968
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 968
+INDIRI4
+CNSTI4 0
+NEI4 $7293
+ADDRGP4 $7292
+ARGP4
+ADDRLP4 972
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 972
+INDIRI4
+ASGNI4
+ADDRGP4 $7294
+JUMPV
+LABELV $7293
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 972
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $7297
+ADDRGP4 cg+3848208
+INDIRI4
+ARGI4
+ADDRLP4 976
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 976
+INDIRI4
+CNSTI4 0
+NEI4 $7297
+ADDRGP4 $7291
+ARGP4
+ADDRLP4 980
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 980
+INDIRI4
+ASGNI4
+ADDRGP4 $7298
+JUMPV
+LABELV $7297
+ADDRGP4 cg+3848212
+INDIRI4
+ARGI4
+ADDRLP4 980
+ADDRGP4 CG_DuelPlayerInfoValid
+CALLI4
+ASGNI4
+ADDRLP4 980
+INDIRI4
+CNSTI4 0
+NEI4 $7301
+ADDRGP4 $7283
+ARGP4
+ADDRLP4 984
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 984
+INDIRI4
+ASGNI4
+ADDRGP4 $7302
+JUMPV
+LABELV $7301
+ADDRLP4 984
+CNSTI4 4524
+ASGNI4
+ADDRLP4 984
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRLP4 984
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+LEI4 $7304
+ADDRGP4 $7291
+ARGP4
+ADDRLP4 988
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 988
+INDIRI4
+ASGNI4
+ADDRGP4 $7305
+JUMPV
+LABELV $7304
+ADDRLP4 988
+CNSTI4 4524
+ASGNI4
+ADDRLP4 988
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ADDRLP4 988
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+GEI4 $7312
+ADDRGP4 $7283
+ARGP4
+ADDRLP4 992
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 992
+INDIRI4
+ASGNI4
+ADDRGP4 $7313
+JUMPV
+LABELV $7312
+ADDRGP4 $7292
+ARGP4
+ADDRLP4 992
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 52
+ADDRLP4 992
+INDIRI4
+ASGNI4
+LABELV $7313
+LABELV $7305
+LABELV $7302
+LABELV $7298
+LABELV $7294
+LABELV $7269
+LABELV $7259
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7323
+ADDRLP4 964
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 140
+CNSTI4 4524
+ADDRLP4 964
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 2252
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $7325
+ADDRGP4 $485
+ARGP4
+ADDRLP4 968
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 968
+INDIRP4
+CNSTI4 2252
+ADDP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 972
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7325
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7327
+ADDRLP4 968
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 140
+CNSTI4 4524
+ADDRLP4 968
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 972
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7329
+ADDRLP4 976
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 976
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+NEI4 $7330
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4556
+INDIRI4
+ARGI4
+ADDRLP4 980
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 980
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7330
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+NEI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4556
+INDIRI4
+ARGI4
+ADDRLP4 980
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 980
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7341
+ADDRLP4 980
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 980
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+NEI4 $7342
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4548
+INDIRI4
+ARGI4
+ADDRLP4 984
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 984
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7342
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+NEI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4548
+INDIRI4
+ARGI4
+ADDRLP4 984
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 984
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7353
+ADDRLP4 984
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 140
+CNSTI4 4524
+ADDRLP4 984
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 2248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRP4
+CNSTI4 2248
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7360
+ADDRLP4 988
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 988
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+NEI4 $7361
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 cg+3196932+4+2444
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7361
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+NEI4 $4883
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 cg+3196932+5088+4+2444
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7374
+ADDRLP4 992
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 992
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+NEI4 $7375
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4576
+INDIRI4
+ARGI4
+ADDRLP4 996
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7375
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+NEI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4576
+INDIRI4
+ARGI4
+ADDRLP4 996
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7386
+ADDRLP4 996
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 996
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+NEI4 $7387
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4584
+INDIRI4
+ARGI4
+ADDRLP4 1000
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7387
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+NEI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4584
+INDIRI4
+ARGI4
+ADDRLP4 1000
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7398
+ADDRLP4 1000
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 1000
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+NEI4 $7399
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4592
+INDIRI4
+ARGI4
+ADDRLP4 1004
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1004
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7399
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+NEI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4592
+INDIRI4
+ARGI4
+ADDRLP4 1004
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1004
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7410
+ADDRLP4 1004
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 1004
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+NEI4 $7411
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+4600
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7411
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+NEI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3196932+5088+4600
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7422
+ADDRLP4 1008
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1012
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1012
+INDIRP4
+ARGP4
+ADDRGP4 $7423
+ARGP4
+ADDRLP4 1016
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1008
+ADDRLP4 1016
+INDIRP4
+ASGNP4
+ADDRLP4 1020
+ADDRLP4 1008
+INDIRP4
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $7426
+ADDRLP4 1020
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $7424
+LABELV $7426
+ADDRLP4 1008
+ADDRGP4 $7427
+ASGNP4
+LABELV $7424
+ADDRGP4 $3728
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+ADDRLP4 1024
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7428
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3856416+12
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7434
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3856416+16
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7440
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3856416+20
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7446
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3856416+24
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7452
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3856416+28
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7458
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3856416+32
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7464
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3856416+68
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7470
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3856416+72
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7476
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3856416+76
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7482
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3856416+80
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7488
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3856416+84
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7494
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $4883
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cg+3856416+88
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7500
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+NEI4 $7501
+ADDRGP4 $4883
+JUMPV
+LABELV $7501
+ADDRGP4 cg+3856416+28
+INDIRI4
+CNSTI4 0
+EQI4 $7504
+ADDRLP4 1008
+CNSTI4 60
+ASGNI4
+ADDRLP4 144
+ADDRGP4 cg+3856416+48
+INDIRI4
+ADDRLP4 1008
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 148
+ADDRGP4 cg+3856416+48
+INDIRI4
+ADDRLP4 1008
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 1012
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1012
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7504
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7512
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+NEI4 $7513
+ADDRGP4 $4883
+JUMPV
+LABELV $7513
+ADDRGP4 cg+3856416+32
+INDIRI4
+CNSTI4 0
+EQI4 $7516
+ADDRLP4 1008
+CNSTI4 60
+ASGNI4
+ADDRLP4 144
+ADDRGP4 cg+3856416+52
+INDIRI4
+ADDRLP4 1008
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 148
+ADDRGP4 cg+3856416+52
+INDIRI4
+ADDRLP4 1008
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 1012
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1012
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7516
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7524
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+NEI4 $7525
+ADDRGP4 $4883
+JUMPV
+LABELV $7525
+ADDRGP4 cg+3856416+84
+INDIRI4
+CNSTI4 0
+EQI4 $7528
+ADDRLP4 1008
+CNSTI4 60
+ASGNI4
+ADDRLP4 144
+ADDRGP4 cg+3856416+104
+INDIRI4
+ADDRLP4 1008
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 148
+ADDRGP4 cg+3856416+104
+INDIRI4
+ADDRLP4 1008
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 1012
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1012
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7528
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7536
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+NEI4 $7537
+ADDRGP4 $4883
+JUMPV
+LABELV $7537
+ADDRGP4 cg+3856416+88
+INDIRI4
+CNSTI4 0
+EQI4 $7540
+ADDRLP4 1008
+CNSTI4 60
+ASGNI4
+ADDRLP4 144
+ADDRGP4 cg+3856416+108
+INDIRI4
+ADDRLP4 1008
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 148
+ADDRGP4 cg+3856416+108
+INDIRI4
+ADDRLP4 1008
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $4640
+ARGP4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 1012
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1012
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7540
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7548
+ADDRGP4 CG_SetArmorColor
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7552
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawTeamMapPickups
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7553
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawTeamMapPickups
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7554
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Draw1stPlayerPickups
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7555
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_Draw2ndPlayerPickups
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7557
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $7559
+CNSTI4 699
+ARGI4
+ADDRLP4 1012
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1012
+INDIRP4
+ARGP4
+ADDRLP4 1016
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1008
+ADDRLP4 1016
+INDIRI4
+ASGNI4
+ADDRLP4 1020
+ADDRLP4 1008
+INDIRI4
+ASGNI4
+ADDRLP4 1020
+INDIRI4
+CNSTI4 0
+LTI4 $7562
+ADDRLP4 1020
+INDIRI4
+CNSTI4 64
+GTI4 $7562
+ADDRGP4 $4883
+JUMPV
+LABELV $7562
+ADDRGP4 $7564
+ARGP4
+ADDRLP4 1008
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7559
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4883
+CNSTI4 699
+ARGI4
+ADDRLP4 1008
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7569
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $7571
+CNSTI4 700
+ARGI4
+ADDRLP4 1012
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1012
+INDIRP4
+ARGP4
+ADDRLP4 1016
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1008
+ADDRLP4 1016
+INDIRI4
+ASGNI4
+ADDRLP4 1020
+ADDRLP4 1008
+INDIRI4
+ASGNI4
+ADDRLP4 1020
+INDIRI4
+CNSTI4 0
+LTI4 $7574
+ADDRLP4 1020
+INDIRI4
+CNSTI4 64
+GTI4 $7574
+ADDRGP4 $4883
+JUMPV
+LABELV $7574
+ADDRGP4 $7576
+ARGP4
+ADDRLP4 1008
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7571
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $4883
+CNSTI4 700
+ARGI4
+ADDRLP4 1008
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7581
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $7583
+CNSTI4 701
+ARGI4
+ADDRLP4 1012
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1012
+INDIRP4
+ARGP4
+ADDRLP4 1016
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1008
+ADDRLP4 1016
+INDIRI4
+ASGNI4
+ADDRLP4 1020
+ADDRLP4 1008
+INDIRI4
+ASGNI4
+ADDRLP4 1020
+INDIRI4
+CNSTI4 0
+LTI4 $7586
+ADDRLP4 1020
+INDIRI4
+CNSTI4 64
+GTI4 $7586
+ADDRGP4 $4883
+JUMPV
+LABELV $7586
+ADDRGP4 $7588
+ARGP4
+ADDRLP4 1008
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7583
+CNSTI4 701
+ARGI4
+ADDRLP4 1008
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7589
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cgs+1957816
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7591
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cgs+1957820
+INDIRI4
+ARGI4
+ADDRLP4 1012
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1012
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7593
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $7594
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $7597
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7594
+ADDRGP4 $7598
+ARGP4
+ADDRGP4 cgs+43272
+INDIRI4
+ARGI4
+ADDRLP4 1016
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7600
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $7601
+ADDRLP4 1016
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $7602
+JUMPV
+LABELV $7601
+ADDRLP4 1016
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $7602
+ADDRLP4 1016
+INDIRI4
+CNSTI4 2
+NEI4 $7607
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cgs+43264
+INDIRI4
+ARGI4
+ADDRLP4 1020
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7607
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cgs+43260
+INDIRI4
+ARGI4
+ADDRLP4 1020
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7611
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $7612
+ADDRLP4 1016
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $7613
+JUMPV
+LABELV $7612
+ADDRLP4 1016
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $7613
+ADDRLP4 1016
+INDIRI4
+CNSTI4 2
+NEI4 $7618
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cgs+43260
+INDIRI4
+ARGI4
+ADDRLP4 1020
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7618
+ADDRGP4 $232
+ARGP4
+ADDRGP4 cgs+43264
+INDIRI4
+ARGI4
+ADDRLP4 1020
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7623
+ADDRLP4 1016
+ADDRGP4 Display_KeyBindPending
+CALLI4
+ASGNI4
+ADDRLP4 1016
+INDIRI4
+CNSTI4 0
+EQI4 $7624
+ADDRLP4 112
+ADDRGP4 $7626
+ASGNP4
+ADDRGP4 $7625
+JUMPV
+LABELV $7624
+ADDRLP4 112
+ADDRGP4 $7627
+ASGNP4
+LABELV $7625
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7628
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 1024
+INDIRI4
+EQI4 $7629
+ADDRGP4 cg_freecam_useTeamSettings+12
+INDIRI4
+ADDRLP4 1024
+INDIRI4
+NEI4 $7629
+ADDRGP4 $4883
+JUMPV
+LABELV $7629
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $7633
+ADDRLP4 1020
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $7634
+JUMPV
+LABELV $7633
+ADDRLP4 1020
+ADDRGP4 cg+607704+900+200
+INDIRI4
+ASGNI4
+LABELV $7634
+ADDRLP4 1020
+INDIRI4
+CNSTI4 0
+LEI4 $7641
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $7643
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7641
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $7644
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7645
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+EQI4 $7646
+ADDRGP4 cg_freecam_useTeamSettings+12
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+NEI4 $7646
+ADDRGP4 $4883
+JUMPV
+LABELV $7646
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $7650
+ADDRLP4 1040
+CNSTI4 1496
+ASGNI4
+ADDRLP4 1020
+ADDRLP4 1040
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1040
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1040
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $7651
+JUMPV
+LABELV $7650
+ADDRLP4 1020
+ADDRGP4 cg+607704+900+200
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRGP4 cg+607704+900+192
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+ADDRGP4 cg+607704+900+208
+INDIRI4
+ASGNI4
+LABELV $7651
+ADDRLP4 1020
+INDIRI4
+CNSTI4 0
+LEI4 $7670
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 1040
+ADDRGP4 CG_GetTimeString
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 $3728
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7670
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ADDRGP4 CG_GetTimeString
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 $3728
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7673
+ADDRLP4 1020
+CNSTI4 0
+ASGNI4
+ADDRLP4 1020
+ARGP4
+ADDRGP4 CG_GetCurrentTimeWithDirection
+CALLI4
+pop
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627388
+INDIRI4
+ADDRLP4 1024
+INDIRI4
+NEI4 $4883
+ADDRLP4 1020
+INDIRI4
+ADDRLP4 1024
+INDIRI4
+EQI4 $4883
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $4883
+ADDRLP4 1020
+INDIRI4
+CNSTI4 2
+GEI4 $7678
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $7680
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7678
+ADDRGP4 $7681
+ARGP4
+ADDRLP4 1020
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7682
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $7683
+ADDRGP4 $4883
+JUMPV
+LABELV $7683
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $7686
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $7686
+ADDRGP4 $4883
+JUMPV
+LABELV $7686
+ADDRLP4 1020
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_MAP_KEYS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $7690
+ADDRLP4 1024
+ADDRGP4 cgs+632912+1317396
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1020
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 1020
+ADDRLP4 1020
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+LABELV $7690
+ADDRLP4 1028
+CNSTI4 2
+ASGNI4
+ADDRGP4 STAT_MAP_KEYS
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $7698
+ADDRLP4 1024
+ADDRGP4 cgs+632912+1317400
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1020
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 1020
+ADDRLP4 1020
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+LABELV $7698
+ADDRGP4 STAT_MAP_KEYS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $4883
+ADDRLP4 1024
+ADDRGP4 cgs+632912+1317404
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1020
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 1020
+ADDRLP4 1020
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRGP4 $4883
+JUMPV
+LABELV $7717
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+EQI4 $7718
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $7597
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7718
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $7721
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $7721
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $7725
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7721
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $7726
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $7729
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7726
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $7730
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7731
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $7732
+ADDRLP4 92
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $7733
+JUMPV
+LABELV $7732
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $7736
+ADDRLP4 92
+ADDRGP4 cg+609312
+INDIRI4
+ASGNI4
+ADDRGP4 $7737
+JUMPV
+LABELV $7736
+ADDRLP4 92
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $7737
+LABELV $7733
+ADDRGP4 $232
+ARGP4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 1020
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7741
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $7742
+ADDRLP4 92
+ADDRGP4 wcg+31087196
+INDIRI4
+ASGNI4
+ADDRGP4 $7743
+JUMPV
+LABELV $7742
+ADDRLP4 92
+ADDRGP4 cg+627420
+INDIRI4
+ASGNI4
+LABELV $7743
+ADDRGP4 $232
+ARGP4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 1024
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7746
+ADDRLP4 1028
+ADDRGP4 CG_NumHeldWeapons
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7747
+CNSTI4 1
+ARGI4
+ADDRLP4 1036
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7748
+CNSTI4 2
+ARGI4
+ADDRLP4 1044
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7749
+CNSTI4 3
+ARGI4
+ADDRLP4 1052
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7750
+CNSTI4 4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1060
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7751
+CNSTI4 5
+ARGI4
+ADDRLP4 1068
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRLP4 1072
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7752
+CNSTI4 6
+ARGI4
+ADDRLP4 1076
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1076
+INDIRI4
+ARGI4
+ADDRLP4 1080
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1080
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7753
+CNSTI4 7
+ARGI4
+ADDRLP4 1084
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1084
+INDIRI4
+ARGI4
+ADDRLP4 1088
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7754
+CNSTI4 8
+ARGI4
+ADDRLP4 1092
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1092
+INDIRI4
+ARGI4
+ADDRLP4 1096
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1096
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7755
+CNSTI4 9
+ARGI4
+ADDRLP4 1100
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1100
+INDIRI4
+ARGI4
+ADDRLP4 1104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1104
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7756
+CNSTI4 10
+ARGI4
+ADDRLP4 1108
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1108
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7757
+CNSTI4 11
+ARGI4
+ADDRLP4 1116
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1116
+INDIRI4
+ARGI4
+ADDRLP4 1120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1120
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7758
+CNSTI4 12
+ARGI4
+ADDRLP4 1124
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1124
+INDIRI4
+ARGI4
+ADDRLP4 1128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1128
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7759
+CNSTI4 13
+ARGI4
+ADDRLP4 1132
+ADDRGP4 CG_HaveWeapon
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1132
+INDIRI4
+ARGI4
+ADDRLP4 1136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1136
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7760
+CNSTI4 1
+ARGI4
+ADDRLP4 1140
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1140
+INDIRI4
+ARGI4
+ADDRLP4 1144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7761
+CNSTI4 2
+ARGI4
+ADDRLP4 1148
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1148
+INDIRI4
+ARGI4
+ADDRLP4 1152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1152
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7762
+CNSTI4 3
+ARGI4
+ADDRLP4 1156
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1156
+INDIRI4
+ARGI4
+ADDRLP4 1160
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1160
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7763
+CNSTI4 4
+ARGI4
+ADDRLP4 1164
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1164
+INDIRI4
+ARGI4
+ADDRLP4 1168
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1168
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7764
+CNSTI4 5
+ARGI4
+ADDRLP4 1172
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1172
+INDIRI4
+ARGI4
+ADDRLP4 1176
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1176
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7765
+CNSTI4 6
+ARGI4
+ADDRLP4 1180
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1180
+INDIRI4
+ARGI4
+ADDRLP4 1184
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1184
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7766
+CNSTI4 7
+ARGI4
+ADDRLP4 1188
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1188
+INDIRI4
+ARGI4
+ADDRLP4 1192
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1192
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7767
+CNSTI4 8
+ARGI4
+ADDRLP4 1196
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1196
+INDIRI4
+ARGI4
+ADDRLP4 1200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1200
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7768
+CNSTI4 9
+ARGI4
+ADDRLP4 1204
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1204
+INDIRI4
+ARGI4
+ADDRLP4 1208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1208
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7769
+CNSTI4 10
+ARGI4
+ADDRLP4 1212
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1212
+INDIRI4
+ARGI4
+ADDRLP4 1216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1216
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7770
+CNSTI4 11
+ARGI4
+ADDRLP4 1220
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1220
+INDIRI4
+ARGI4
+ADDRLP4 1224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1224
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7771
+CNSTI4 12
+ARGI4
+ADDRLP4 1228
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1228
+INDIRI4
+ARGI4
+ADDRLP4 1232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1232
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7772
+CNSTI4 13
+ARGI4
+ADDRLP4 1236
+ADDRGP4 CG_WeaponAmmo
+CALLI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1236
+INDIRI4
+ARGI4
+ADDRLP4 1240
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1240
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $4883
+JUMPV
+LABELV $7773
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $7774
+ADDRGP4 $232
+ARGP4
+CNSTI4 2392
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2380
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1244
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1244
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $7775
+JUMPV
+LABELV $7774
+ADDRGP4 $232
+ARGP4
+CNSTI4 2392
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2380
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1244
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1244
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+LABELV $7775
+LABELV $4882
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+LEI4 $4883
+ADDRGP4 $7782
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 1244
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRF4
+ARGF4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRLP4 1244
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 56
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+236+12
+ARGP4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Align
+CALLV
+pop
+ADDRGP4 $7785
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4883
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRGP4 MenuWidescreen
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRGP4 QLWideScreen
+ADDRLP4 176
+INDIRI4
+ASGNI4
+LABELV $4824
+endproc CG_OwnerDraw 1248 36
+export CG_MouseEvent
+proc CG_MouseEvent 20 12
+ADDRGP4 cgs+632816
+INDIRI4
+CNSTI4 4
+EQI4 $7798
+ADDRGP4 $7795
+JUMPV
+LABELV $7798
+ADDRLP4 4
+ADDRGP4 cg+1332164
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+1332168
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $7796
+JUMPV
+LABELV $7795
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_EventHandling
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 -9
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+LABELV $7796
+ADDRGP4 cg+607196+4
+INDIRI4
+CNSTI4 0
+EQI4 $7808
+ADDRGP4 cg+607196+4
+INDIRI4
+CNSTI4 2
+NEI4 $7801
+LABELV $7808
+ADDRGP4 cg+617020
+INDIRI4
+CNSTI4 0
+NEI4 $7801
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $7809
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $7794
+JUMPV
+LABELV $7809
+LABELV $7801
+ADDRGP4 cg+5417588
+INDIRI4
+CNSTI4 0
+EQI4 $7812
+ADDRGP4 cg+607168
+INDIRI4
+ADDRGP4 cg+5417592
+INDIRI4
+SUBI4
+ADDRGP4 cg_mouseSeekPollInterval+12
+INDIRI4
+GEI4 $7815
+ADDRGP4 $7794
+JUMPV
+LABELV $7815
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $7820
+ADDRGP4 cg+1332164
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $7820
+ADDRGP4 cg+1332164
+CNSTI4 0
+ASGNI4
+ADDRGP4 $7821
+JUMPV
+LABELV $7820
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $7824
+ADDRGP4 cg+1332164
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $7824
+ADDRGP4 cg+1332164
+CNSTI4 0
+ASGNI4
+LABELV $7824
+LABELV $7821
+ADDRLP4 4
+CNSTF4 961656599
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 cg_mouseSeekScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg_mouseSeekUseTimescale+12
+INDIRI4
+CNSTI4 1
+NEI4 $7829
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $7830
+JUMPV
+LABELV $7829
+ADDRGP4 cg_mouseSeekUseTimescale+12
+INDIRI4
+CNSTI4 2
+NEI4 $7833
+ADDRGP4 cg_timescale+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $7833
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $7833
+LABELV $7830
+ADDRGP4 cg+1332164
+INDIRI4
+CNSTI4 0
+LEI4 $7843
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GTF4 $7842
+LABELV $7843
+ADDRGP4 cg+1332164
+INDIRI4
+CNSTI4 0
+GEI4 $7838
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $7838
+LABELV $7842
+ADDRGP4 $7844
+ARGP4
+ADDRGP4 cg+1332164
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $7839
+JUMPV
+LABELV $7838
+ADDRGP4 cg+1332164
+INDIRI4
+CNSTI4 0
+GEI4 $7851
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GTF4 $7850
+LABELV $7851
+ADDRGP4 cg+1332164
+INDIRI4
+CNSTI4 0
+LEI4 $7846
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $7846
+LABELV $7850
+ADDRGP4 cg+1332164
+ADDRGP4 cg+1332164
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $7854
+ARGP4
+ADDRGP4 cg+1332164
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $7846
+LABELV $7839
+ADDRGP4 cg+1332164
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332168
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+5417592
+ADDRGP4 cg+607168
+INDIRI4
+ASGNI4
+ADDRGP4 $7794
+JUMPV
+LABELV $7812
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $7860
+ADDRGP4 $7794
+JUMPV
+LABELV $7860
+ADDRGP4 cg+617024
+INDIRI4
+CNSTI4 0
+NEI4 $7863
+ADDRGP4 cg+3196928
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $7863
+ADDRGP4 $7794
+JUMPV
+LABELV $7863
+ADDRLP4 4
+ADDRGP4 cgs+632808
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+632808
+INDIRI4
+CNSTI4 0
+GEI4 $7868
+ADDRGP4 cgs+632808
+CNSTI4 0
+ASGNI4
+ADDRGP4 $7869
+JUMPV
+LABELV $7868
+ADDRGP4 cgs+632808
+INDIRI4
+CNSTI4 640
+LEI4 $7872
+ADDRGP4 cgs+632808
+CNSTI4 640
+ASGNI4
+LABELV $7872
+LABELV $7869
+ADDRLP4 8
+ADDRGP4 cgs+632812
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+632812
+INDIRI4
+CNSTI4 0
+GEI4 $7877
+ADDRGP4 cgs+632812
+CNSTI4 0
+ASGNI4
+ADDRGP4 $7878
+JUMPV
+LABELV $7877
+ADDRGP4 cgs+632812
+INDIRI4
+CNSTI4 480
+LEI4 $7881
+ADDRGP4 cgs+632812
+CNSTI4 480
+ASGNI4
+LABELV $7881
+LABELV $7878
+ADDRGP4 cgs+632808
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632812
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Display_CursorType
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632832
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $7888
+ADDRGP4 cgs+632832
+ADDRGP4 cgs+632912+493544
+INDIRI4
+ASGNI4
+ADDRGP4 $7889
+JUMPV
+LABELV $7888
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $7893
+ADDRGP4 cgs+632832
+ADDRGP4 cgs+632912+493548
+INDIRI4
+ASGNI4
+LABELV $7893
+LABELV $7889
+ADDRGP4 cgs+632828
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $7898
+ADDRGP4 cgs+632828
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+ADDRGP4 $7899
+JUMPV
+LABELV $7898
+CNSTP4 0
+ARGP4
+ADDRGP4 cgs+632808
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632812
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+LABELV $7899
+LABELV $7794
+endproc CG_MouseEvent 20 12
+proc CG_HideTeamMenu 0 4
+ADDRGP4 $7905
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+ADDRGP4 $7906
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+LABELV $7904
+endproc CG_HideTeamMenu 0 4
+export CG_EventHandling
+proc CG_EventHandling 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $7908
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cgs+632816
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $7910
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $7910
+ADDRFP4 0
+CNSTI4 4
+ASGNI4
+LABELV $7910
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $7913
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $7915
+LABELV $7915
+ADDRGP4 CG_HideTeamMenu
+CALLV
+pop
+ADDRGP4 $7914
+JUMPV
+LABELV $7913
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $7918
+ADDRGP4 $7919
+JUMPV
+LABELV $7918
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $7920
+LABELV $7920
+LABELV $7919
+LABELV $7914
+ADDRGP4 cgs+632816
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $7923
+ADDRLP4 4
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $7924
+JUMPV
+LABELV $7923
+ADDRGP4 $7925
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $7924
+LABELV $7907
+endproc CG_EventHandling 8 8
+export CG_KeyEvent
+proc CG_KeyEvent 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632816
+INDIRI4
+CNSTI4 4
+EQI4 $7930
+ADDRGP4 $7928
+JUMPV
+LABELV $7930
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Wolfcam_DemoKeyClick
+CALLV
+pop
+LABELV $7928
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $7931
+ADDRFP4 0
+INDIRI4
+CNSTI4 145
+LTI4 $7935
+ADDRFP4 0
+INDIRI4
+CNSTI4 159
+GTI4 $7935
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $7937-580
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $7937
+address $7936
+address $7936
+address $7936
+address $7936
+address $7936
+address $7936
+address $7936
+address $7936
+address $7936
+address $7936
+address $7936
+address $7936
+address $7936
+address $7936
+address $7936
+code
+LABELV $7936
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Wolfcam_DemoKeyClick
+CALLV
+pop
+ADDRGP4 $7926
+JUMPV
+LABELV $7935
+LABELV $7931
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607196+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $7946
+ADDRGP4 cg+607196+4
+INDIRI4
+CNSTI4 2
+NEI4 $7939
+ADDRGP4 cg+617020
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $7939
+LABELV $7946
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $7947
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_EventHandling
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $7926
+JUMPV
+LABELV $7947
+LABELV $7939
+ADDRGP4 cg+617024
+INDIRI4
+CNSTI4 0
+NEI4 $7950
+ADDRGP4 cg+3196928
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $7950
+ADDRGP4 $7926
+JUMPV
+LABELV $7950
+ADDRFP4 0
+INDIRI4
+CNSTI4 178
+EQI4 $7954
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $7954
+ADDRGP4 $7926
+JUMPV
+LABELV $7954
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632808
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632812
+INDIRI4
+ARGI4
+ADDRGP4 Display_HandleKey
+CALLV
+pop
+ADDRGP4 cgs+632828
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $7958
+ADDRGP4 cgs+632828
+CNSTP4 0
+ASGNP4
+ADDRGP4 $7959
+JUMPV
+LABELV $7958
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+NEI4 $7962
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $7962
+ADDRGP4 cgs+632808
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632812
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Display_CaptureItem
+CALLP4
+ASGNP4
+ADDRGP4 cgs+632828
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $7962
+LABELV $7959
+LABELV $7926
+endproc CG_KeyEvent 12 16
+export CG_ShowResponseHead
+proc CG_ShowResponseHead 0 8
+ADDRGP4 $7968
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+ADDRGP4 $7969
+ARGP4
+ADDRGP4 $7970
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cg+627164
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $7967
+endproc CG_ShowResponseHead 0 8
+export CG_RunMenuScript
+proc CG_RunMenuScript 0 0
+LABELV $7973
+endproc CG_RunMenuScript 0 0
+export CG_GetTeamColor
+proc CG_GetTeamColor 4 8
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $7975
+ADDRLP4 0
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $7976
+JUMPV
+LABELV $7975
+ADDRLP4 0
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $7976
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $7981
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg_hudRedTeamColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 $7982
+JUMPV
+LABELV $7981
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $7983
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg_hudBlueTeamColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 $7984
+JUMPV
+LABELV $7983
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg_hudNoTeamColor
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+LABELV $7984
+LABELV $7982
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $7974
+endproc CG_GetTeamColor 4 8
+import round
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import Wolfcam_PlayerArmor
+import Wolfcam_PlayerHealth
+import Wolfcam_AddBoundingBox
+import Wolfcam_AddBox
+import Wolfcam_DemoKeyClick
+import CG_SpawnRailTrail
+import CG_AddWeaponWithPowerups
+import CG_MachinegunSpinAngle
+import CG_MapTorsoToWeaponFrame
+import CG_Bullet
+import CG_GetWeaponFlashOrigin
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_OutOfAmmoChange
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_DrawWeaponSelect
+import CG_AddViewWeapon
+import CG_AddPlayerWeapon
+import CG_LightningBolt
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_SimpleRailTrail
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_PushReward
+import CG_TransitionPlayerState
+import CG_CheckChangedPredictableEvents
+import CG_Respawn
+import CG_GetAmmoWarning
+import CG_PrintPlayerState
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+bss
+export MenuRect
+align 4
+LABELV MenuRect
+skip 16
+import CG_CheckEvents
+import CG_EntityEvent
+import CG_CheckClientEventCpma
+import CG_PainEvent
+import CG_TimedItemPickup
+import CG_PlaceString
+import UI_DrawProportionalString3
+import UI_DrawProportionalString
+import CG_ColorForHealth
+import CG_GetColorForHealth
+import CG_TeamColor
+import CG_FadeColorVec4
+import CG_FadeColorRealTime
+import CG_FadeColor
+import CG_TileClear
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawStretchPic
+import CG_DrawPic
+import CG_DrawRect
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_FillRect
+import CG_AdjustFrom640
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_StartidCamera
+import CG_ChangeConfigString
+import CG_CleanUpFieldNumber
+import CG_EchoPopup
+import CG_ErrorPopup
+import CG_AdjustTimeForTimeouts
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $7970
+byte 1 55
+byte 1 50
+byte 1 0
+align 1
+LABELV $7969
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 88
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $7968
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $7925
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 72
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $7908
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 72
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $7906
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $7905
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $7854
+byte 1 114
+byte 1 101
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $7844
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $7785
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 79
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $7782
+byte 1 94
+byte 1 51
+byte 1 120
+byte 1 120
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 120
+byte 1 120
+byte 1 120
+byte 1 0
+align 1
+LABELV $7730
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $7729
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $7725
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $7681
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 120
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $7680
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $7644
+byte 1 94
+byte 1 51
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 84
+byte 1 32
+byte 1 84
+byte 1 73
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $7643
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 85
+byte 1 82
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 32
+byte 1 82
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $7627
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $7626
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 65
+byte 1 80
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $7598
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $7597
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $7588
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 83
+byte 1 84
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 76
+byte 1 85
+byte 1 65
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 89
+byte 1 82
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $7576
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 83
+byte 1 84
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 76
+byte 1 85
+byte 1 65
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 69
+byte 1 78
+byte 1 83
+byte 1 73
+byte 1 86
+byte 1 69
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 89
+byte 1 82
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $7564
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 83
+byte 1 84
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 76
+byte 1 85
+byte 1 65
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 79
+byte 1 70
+byte 1 70
+byte 1 69
+byte 1 78
+byte 1 83
+byte 1 73
+byte 1 86
+byte 1 69
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 89
+byte 1 82
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $7427
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $7423
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $7292
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $7291
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $7283
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $7267
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 114
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $7266
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $7226
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $7225
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $7217
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $7201
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 114
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $7200
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $6127
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $5875
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5874
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5873
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $5872
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5871
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5867
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 67
+byte 1 72
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 32
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 83
+byte 1 0
+align 1
+LABELV $5866
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 67
+byte 1 72
+byte 1 32
+byte 1 83
+byte 1 85
+byte 1 77
+byte 1 77
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 0
+align 1
+LABELV $5862
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 67
+byte 1 72
+byte 1 32
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 77
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $5853
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 83
+byte 1 84
+byte 1 95
+byte 1 68
+byte 1 65
+byte 1 77
+byte 1 65
+byte 1 71
+byte 1 69
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 89
+byte 1 82
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $5837
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 83
+byte 1 84
+byte 1 95
+byte 1 65
+byte 1 67
+byte 1 67
+byte 1 85
+byte 1 82
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 89
+byte 1 82
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $5821
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 66
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 67
+byte 1 79
+byte 1 78
+byte 1 84
+byte 1 82
+byte 1 79
+byte 1 76
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 89
+byte 1 82
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $5808
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $5807
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $5800
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5798
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 50
+byte 1 0
+align 1
+LABELV $5796
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $5794
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $5787
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 50
+byte 1 0
+align 1
+LABELV $5776
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $5767
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $5764
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $5763
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5748
+byte 1 94
+byte 1 37
+byte 1 100
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $5529
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $5524
+byte 1 94
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $5396
+byte 1 84
+byte 1 79
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5373
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5372
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5353
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $5351
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $5316
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $5314
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $5310
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $5308
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $5287
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $5276
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $5275
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $5239
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 89
+byte 1 82
+byte 1 95
+byte 1 66
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 95
+byte 1 78
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $5231
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 89
+byte 1 82
+byte 1 95
+byte 1 66
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 95
+byte 1 78
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $5223
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $5222
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 115
+byte 1 107
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $5213
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $5204
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5193
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5189
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5169
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5160
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $5156
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $5155
+byte 1 46
+byte 1 0
+align 1
+LABELV $5154
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5114
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5110
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5093
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5087
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5074
+byte 1 94
+byte 1 49
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 87
+byte 1 73
+byte 1 78
+byte 1 83
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $5067
+byte 1 94
+byte 1 52
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 87
+byte 1 73
+byte 1 78
+byte 1 83
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $5061
+byte 1 32
+byte 1 87
+byte 1 73
+byte 1 78
+byte 1 83
+byte 1 0
+align 1
+LABELV $5060
+byte 1 32
+byte 1 87
+byte 1 73
+byte 1 78
+byte 1 83
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $4877
+byte 1 120
+byte 1 120
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 120
+byte 1 120
+byte 1 120
+byte 1 0
+align 1
+LABELV $4874
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 79
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $4863
+byte 1 94
+byte 1 53
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4748
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 0
+align 1
+LABELV $4737
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4663
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 67
+byte 1 116
+byte 1 102
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4640
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $4635
+byte 1 48
+byte 1 58
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $4616
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 84
+byte 1 100
+byte 1 109
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4609
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4595
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $4587
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $4583
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $4579
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $4578
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $4575
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 32
+byte 1 40
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 41
+byte 1 0
+align 1
+LABELV $4574
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 32
+byte 1 40
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 41
+byte 1 0
+align 1
+LABELV $4479
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4427
+byte 1 84
+byte 1 0
+align 1
+LABELV $4408
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $4154
+byte 1 50
+byte 1 46
+byte 1 0
+align 1
+LABELV $4149
+byte 1 50
+byte 1 46
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3987
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3983
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3967
+byte 1 50
+byte 1 46
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3964
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3953
+byte 1 110
+byte 1 0
+align 1
+LABELV $3936
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $3860
+byte 1 49
+byte 1 46
+byte 1 0
+align 1
+LABELV $3831
+byte 1 49
+byte 1 46
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 94
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3792
+byte 1 49
+byte 1 46
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3777
+byte 1 49
+byte 1 46
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3773
+byte 1 49
+byte 1 46
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3757
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $3756
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $3728
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3702
+byte 1 94
+byte 1 49
+byte 1 119
+byte 1 116
+byte 1 102
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $3630
+byte 1 87
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $3622
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $3571
+byte 1 94
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3415
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3407
+byte 1 49
+byte 1 73
+byte 1 80
+byte 1 85
+byte 1 84
+byte 1 89
+byte 1 0
+align 1
+LABELV $3348
+byte 1 113
+byte 1 51
+byte 1 103
+byte 1 105
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3345
+byte 1 113
+byte 1 51
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $3342
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $3323
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 82
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3319
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $3315
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3311
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3307
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $3303
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $3302
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 107
+byte 1 101
+byte 1 0
+align 1
+LABELV $3295
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $3291
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3287
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $3283
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $3279
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $3269
+byte 1 94
+byte 1 52
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $3265
+byte 1 94
+byte 1 49
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 52
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $3258
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $3207
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $3151
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $3116
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $3106
+byte 1 32
+byte 1 0
+align 1
+LABELV $3100
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3096
+byte 1 0
+align 1
+LABELV $3069
+byte 1 94
+byte 1 51
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 48
+byte 1 56
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $2737
+byte 1 94
+byte 1 51
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 48
+byte 1 56
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $2411
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1458
+byte 1 50
+byte 1 0
+align 1
+LABELV $1456
+byte 1 49
+byte 1 0
+align 1
+LABELV $1454
+byte 1 48
+byte 1 0
+align 1
+LABELV $1066
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1012
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $941
+byte 1 94
+byte 1 49
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $571
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $555
+byte 1 37
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $554
+byte 1 45
+byte 1 0
+align 1
+LABELV $493
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $485
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $289
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $235
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $232
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $231
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $230
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $216
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $212
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $206
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $200
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $194
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $193
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $191
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $190
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $188
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $187
+byte 1 111
+byte 1 110
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $185
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $184
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $183
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $181
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 57
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 57
+byte 1 0
+align 1
+LABELV $180
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $179
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $177
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 56
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 56
+byte 1 0
+align 1
+LABELV $176
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $175
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $173
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 55
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 55
+byte 1 0
+align 1
+LABELV $172
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $171
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
@@ -0,0 +1,15120 @@
+data
+align 4
+LABELV shaderAnimNames
+address $150
+byte 4 0
+skip 120
+align 4
+LABELV shaderAnimCounts
+byte 4 23
+skip 124
+align 4
+LABELV shaderAnimSTRatio
+byte 4 1065353216
+skip 124
+export cl_numparticles
+align 4
+LABELV cl_numparticles
+byte 4 1024
+export initparticles
+align 4
+LABELV initparticles
+byte 4 0
+export CG_ClearParticles
+code
+proc CG_ClearParticles 28 12
+ADDRGP4 particles
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 131072
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 free_particles
+ADDRGP4 particles
+ASGNP4
+ADDRGP4 active_particles
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $155
+JUMPV
+LABELV $152
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 particles
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 particles+128
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 particles+64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $153
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $155
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cl_numparticles
+INDIRI4
+LTI4 $152
+ADDRGP4 cl_numparticles
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 particles-128
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 oldtime
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $163
+JUMPV
+LABELV $160
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $164
+ADDRGP4 $168
+ARGP4
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 shaderAnims
+ADDP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $165
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $167
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimCounts
+ADDP4
+INDIRI4
+LTI4 $164
+LABELV $161
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $163
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $160
+ADDRGP4 numShaderAnims
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 initparticles
+CNSTI4 1
+ASGNI4
+LABELV $151
+endproc CG_ClearParticles 28 12
+export CG_AddParticleToScene
+proc CG_AddParticleToScene 480 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 240
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 1
+EQI4 $173
+ADDRLP4 240
+INDIRI4
+CNSTI4 5
+EQI4 $173
+ADDRLP4 240
+INDIRI4
+CNSTI4 11
+NEI4 $170
+LABELV $173
+LABELV $170
+ADDRLP4 244
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 1
+EQI4 $179
+ADDRLP4 244
+INDIRI4
+CNSTI4 5
+EQI4 $179
+ADDRLP4 244
+INDIRI4
+CNSTI4 11
+EQI4 $179
+ADDRLP4 244
+INDIRI4
+CNSTI4 13
+EQI4 $179
+ADDRLP4 244
+INDIRI4
+CNSTI4 14
+NEI4 $174
+LABELV $179
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 11
+EQI4 $180
+ADDRLP4 248
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 13
+EQI4 $184
+ADDRLP4 248
+INDIRI4
+CNSTI4 14
+NEI4 $182
+LABELV $184
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+LEF4 $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 252
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 252
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 14
+NEI4 $183
+ADDRLP4 260
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 260
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 264
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 264
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRGP4 $183
+JUMPV
+LABELV $182
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+GEF4 $190
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 256
+INDIRP4
+ADDRLP4 256
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+LABELV $194
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+LTF4 $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $196
+ADDRLP4 256
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 256
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 260
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 260
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $196
+LABELV $190
+LABELV $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $198
+ADDRGP4 $169
+JUMPV
+LABELV $198
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $180
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 248
+INDIRF4
+CNSTF4 1149239296
+LEF4 $200
+ADDRGP4 $169
+JUMPV
+LABELV $200
+ADDRLP4 252
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 13
+EQI4 $205
+ADDRLP4 252
+INDIRI4
+CNSTI4 14
+NEI4 $203
+LABELV $205
+ADDRLP4 260
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 264
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 264
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 264
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 272
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 276
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 276
+INDIRF4
+LTF4 $227
+ADDRLP4 268
+ADDRLP4 272
+INDIRF4
+ADDRLP4 276
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $228
+JUMPV
+LABELV $227
+ADDRLP4 268
+ADDRLP4 272
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $228
+ADDRLP4 12+20+3
+ADDRLP4 268
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 288
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 296
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 300
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 296
+INDIRF4
+ADDRLP4 300
+INDIRF4
+LTF4 $257
+ADDRLP4 292
+ADDRLP4 296
+INDIRF4
+ADDRLP4 300
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRLP4 292
+ADDRLP4 296
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $258
+ADDRLP4 12+24+20+3
+ADDRLP4 292
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 320
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 324
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 320
+INDIRF4
+ADDRLP4 324
+INDIRF4
+LTF4 $287
+ADDRLP4 316
+ADDRLP4 320
+INDIRF4
+ADDRLP4 324
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRLP4 316
+ADDRLP4 320
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $288
+ADDRLP4 12+48+20+3
+ADDRLP4 316
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 332
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 332
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 336
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 336
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 344
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 348
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 344
+INDIRF4
+ADDRLP4 348
+INDIRF4
+LTF4 $317
+ADDRLP4 340
+ADDRLP4 344
+INDIRF4
+ADDRLP4 348
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $318
+JUMPV
+LABELV $317
+ADDRLP4 340
+ADDRLP4 344
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $318
+ADDRLP4 12+72+20+3
+ADDRLP4 340
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $175
+JUMPV
+LABELV $203
+ADDRLP4 260
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 264
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 264
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 264
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 108+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 108+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 108+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 272
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 276
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 276
+INDIRF4
+LTF4 $340
+ADDRLP4 268
+ADDRLP4 272
+INDIRF4
+ADDRLP4 276
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $341
+JUMPV
+LABELV $340
+ADDRLP4 268
+ADDRLP4 272
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $341
+ADDRLP4 108+20+3
+ADDRLP4 268
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 288
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 108+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 108+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 108+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 296
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 300
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 296
+INDIRF4
+ADDRLP4 300
+INDIRF4
+LTF4 $370
+ADDRLP4 292
+ADDRLP4 296
+INDIRF4
+ADDRLP4 300
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 292
+ADDRLP4 296
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $371
+ADDRLP4 108+24+20+3
+ADDRLP4 292
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 108+48+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 108+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 108+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 320
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 324
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 320
+INDIRF4
+ADDRLP4 324
+INDIRF4
+LTF4 $400
+ADDRLP4 316
+ADDRLP4 320
+INDIRF4
+ADDRLP4 324
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRLP4 316
+ADDRLP4 320
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $401
+ADDRLP4 108+48+20+3
+ADDRLP4 316
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $175
+JUMPV
+LABELV $174
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 15
+NEI4 $402
+ADDRLP4 284
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 184
+ADDRLP4 284
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 284
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 232
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 296
+INDIRF4
+ADDRLP4 300
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 304
+INDIRF4
+ADDRLP4 300
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $407
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 272+8
+ADDRLP4 272+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 272
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 248
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $407
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $412
+ADDRLP4 312
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 316
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 316
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 316
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 312
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 316
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 316
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 316
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $413
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $444
+ADDRLP4 308
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRLP4 308
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $445
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $475
+ADDRLP4 308
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRLP4 308
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $476
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRLP4 308
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 308
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $507
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRLP4 248
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 3
+EQI4 $539
+ADDRLP4 248
+INDIRI4
+CNSTI4 12
+NEI4 $537
+LABELV $539
+ADDRLP4 252
+CNSTI4 64
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $540
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 256
+INDIRF4
+CNSTF4 1149239296
+LEF4 $540
+ADDRGP4 $169
+JUMPV
+LABELV $540
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $543
+ADDRLP4 184
+CNSTF4 1046562734
+ASGNF4
+ADDRLP4 184+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $544
+JUMPV
+LABELV $543
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $547
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 264
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 0
+NEF4 $550
+ADDRLP4 264
+CNSTF4 1065353216
+ASGNF4
+LABELV $550
+ADDRLP4 268
+CNSTF4 1166016512
+ADDRLP4 264
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 260
+CNSTF4 1048576000
+ADDRLP4 268
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 260
+INDIRF4
+CNSTF4 1056964608
+LEF4 $552
+ADDRLP4 260
+CNSTF4 1056964608
+ASGNF4
+LABELV $552
+ADDRLP4 276
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRGP4 $548
+JUMPV
+LABELV $547
+ADDRLP4 260
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 184
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $548
+LABELV $544
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 232
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRLP4 268
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 268
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+LEF4 $559
+ADDRLP4 276
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1065353216
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRLP4 276
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 276
+INDIRF4
+SUBF4
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $563
+ADDRLP4 284
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 284
+INDIRF4
+ADDRLP4 284
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280
+INDIRF4
+CNSTF4 0
+GEF4 $565
+ADDRLP4 280
+CNSTF4 0
+ASGNF4
+LABELV $565
+ADDRLP4 288
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 288
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 288
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+ADDRLP4 280
+INDIRF4
+ASGNF4
+LABELV $563
+ADDRLP4 204
+ADDRLP4 204
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRLP4 204
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $560
+ADDRGP4 cgs+20100+19480
+INDIRI4
+CNSTI4 3
+NEI4 $569
+ADDRLP4 204
+CNSTF4 1065353216
+ASGNF4
+LABELV $569
+ADDRLP4 204
+INDIRF4
+CNSTF4 1065353216
+LEF4 $573
+ADDRLP4 204
+CNSTF4 1065353216
+ASGNF4
+LABELV $573
+ADDRLP4 276
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 276
+INDIRF4
+ADDRLP4 280
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRLP4 276
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 284
+INDIRF4
+ADDRLP4 280
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 12
+EQI4 $575
+ADDRGP4 rforward
+ARGP4
+ADDRLP4 288
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 288+8
+ADDRLP4 288+8
+INDIRF4
+CNSTF4 1036831949
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 288
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 208
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 $576
+JUMPV
+LABELV $575
+ADDRLP4 208
+ADDRGP4 rright
+INDIRB
+ASGNB 12
+ADDRLP4 220
+ADDRGP4 rup
+INDIRB
+ASGNB 12
+LABELV $576
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $578
+ADDRLP4 292
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 220+4
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 296
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDRLP4 296
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $579
+JUMPV
+LABELV $578
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $579
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 292
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LTF4 $605
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $606
+JUMPV
+LABELV $605
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $606
+ADDRLP4 12+20
+ADDRLP4 288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 304
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 308
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+LTF4 $611
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $612
+JUMPV
+LABELV $611
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $612
+ADDRLP4 12+20+1
+ADDRLP4 300
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 316
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 320
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+LTF4 $617
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $618
+JUMPV
+LABELV $617
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $618
+ADDRLP4 12+20+2
+ADDRLP4 312
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 328
+CNSTF4 1132396544
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 332
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+LTF4 $622
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $623
+JUMPV
+LABELV $622
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $623
+ADDRLP4 12+20+3
+ADDRLP4 324
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $624
+ADDRLP4 340
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 340
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 220+4
+INDIRF4
+ADDRLP4 340
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 344
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 344
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDRLP4 344
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $625
+JUMPV
+LABELV $624
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 344
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 344
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 344
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $625
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 340
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 344
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 340
+INDIRF4
+ADDRLP4 344
+INDIRF4
+LTF4 $655
+ADDRLP4 336
+ADDRLP4 340
+INDIRF4
+ADDRLP4 344
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $656
+JUMPV
+LABELV $655
+ADDRLP4 336
+ADDRLP4 340
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $656
+ADDRLP4 12+24+20
+ADDRLP4 336
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 352
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 356
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+LTF4 $662
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $663
+JUMPV
+LABELV $662
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $663
+ADDRLP4 12+24+20+1
+ADDRLP4 348
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 364
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 368
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 364
+INDIRF4
+ADDRLP4 368
+INDIRF4
+LTF4 $669
+ADDRLP4 360
+ADDRLP4 364
+INDIRF4
+ADDRLP4 368
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $670
+JUMPV
+LABELV $669
+ADDRLP4 360
+ADDRLP4 364
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $670
+ADDRLP4 12+24+20+2
+ADDRLP4 360
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 376
+CNSTF4 1132396544
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 380
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 376
+INDIRF4
+ADDRLP4 380
+INDIRF4
+LTF4 $675
+ADDRLP4 372
+ADDRLP4 376
+INDIRF4
+ADDRLP4 380
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $676
+JUMPV
+LABELV $675
+ADDRLP4 372
+ADDRLP4 376
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $676
+ADDRLP4 12+24+20+3
+ADDRLP4 372
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $677
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 220+4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 392
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 392
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDRLP4 392
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $678
+JUMPV
+LABELV $677
+ADDRLP4 388
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 388
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 388
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 392
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 392
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 392
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $678
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 388
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 392
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 388
+INDIRF4
+ADDRLP4 392
+INDIRF4
+LTF4 $708
+ADDRLP4 384
+ADDRLP4 388
+INDIRF4
+ADDRLP4 392
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $709
+JUMPV
+LABELV $708
+ADDRLP4 384
+ADDRLP4 388
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $709
+ADDRLP4 12+48+20
+ADDRLP4 384
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 400
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 404
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 400
+INDIRF4
+ADDRLP4 404
+INDIRF4
+LTF4 $715
+ADDRLP4 396
+ADDRLP4 400
+INDIRF4
+ADDRLP4 404
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $716
+JUMPV
+LABELV $715
+ADDRLP4 396
+ADDRLP4 400
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $716
+ADDRLP4 12+48+20+1
+ADDRLP4 396
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 412
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 416
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 416
+INDIRF4
+LTF4 $722
+ADDRLP4 408
+ADDRLP4 412
+INDIRF4
+ADDRLP4 416
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $723
+JUMPV
+LABELV $722
+ADDRLP4 408
+ADDRLP4 412
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $723
+ADDRLP4 12+48+20+2
+ADDRLP4 408
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 424
+CNSTF4 1132396544
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 428
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 424
+INDIRF4
+ADDRLP4 428
+INDIRF4
+LTF4 $728
+ADDRLP4 420
+ADDRLP4 424
+INDIRF4
+ADDRLP4 428
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $729
+JUMPV
+LABELV $728
+ADDRLP4 420
+ADDRLP4 424
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $729
+ADDRLP4 12+48+20+3
+ADDRLP4 420
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $730
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 220+4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 440
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 440
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDRLP4 440
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRLP4 436
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 436
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 436
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 440
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 440
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 440
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $731
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 436
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 440
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 436
+INDIRF4
+ADDRLP4 440
+INDIRF4
+LTF4 $761
+ADDRLP4 432
+ADDRLP4 436
+INDIRF4
+ADDRLP4 440
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $762
+JUMPV
+LABELV $761
+ADDRLP4 432
+ADDRLP4 436
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $762
+ADDRLP4 12+72+20
+ADDRLP4 432
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 448
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 452
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 448
+INDIRF4
+ADDRLP4 452
+INDIRF4
+LTF4 $768
+ADDRLP4 444
+ADDRLP4 448
+INDIRF4
+ADDRLP4 452
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $769
+JUMPV
+LABELV $768
+ADDRLP4 444
+ADDRLP4 448
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $769
+ADDRLP4 12+72+20+1
+ADDRLP4 444
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 460
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 464
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 460
+INDIRF4
+ADDRLP4 464
+INDIRF4
+LTF4 $775
+ADDRLP4 456
+ADDRLP4 460
+INDIRF4
+ADDRLP4 464
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $776
+JUMPV
+LABELV $775
+ADDRLP4 456
+ADDRLP4 460
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $776
+ADDRLP4 12+72+20+2
+ADDRLP4 456
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 472
+CNSTF4 1132396544
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 476
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 472
+INDIRF4
+ADDRLP4 476
+INDIRF4
+LTF4 $781
+ADDRLP4 468
+ADDRLP4 472
+INDIRF4
+ADDRLP4 476
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $782
+JUMPV
+LABELV $781
+ADDRLP4 468
+ADDRLP4 472
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $782
+ADDRLP4 12+72+20+3
+ADDRLP4 468
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $538
+JUMPV
+LABELV $537
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $783
+ADDRLP4 276
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+20100+19480
+INDIRI4
+CNSTI4 3
+NEI4 $785
+ADDRLP4 276
+CNSTF4 1065353216
+ASGNF4
+LABELV $785
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $789
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRLP4 280
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 280+8
+ADDRLP4 280+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 280
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 252
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 $790
+JUMPV
+LABELV $789
+ADDRLP4 264
+ADDRGP4 vup
+INDIRB
+ASGNB 12
+ADDRLP4 252
+ADDRGP4 vright
+INDIRB
+ASGNB 12
+LABELV $790
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 264+4
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 300
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 252+4
+INDIRF4
+ADDRLP4 300
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 252+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 111
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 19
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 308
+CNSTF4 1132396544
+ADDRLP4 276
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 312
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 308
+INDIRF4
+ADDRLP4 312
+INDIRF4
+LTF4 $815
+ADDRLP4 304
+ADDRLP4 308
+INDIRF4
+ADDRLP4 312
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $816
+JUMPV
+LABELV $815
+ADDRLP4 304
+ADDRLP4 308
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $816
+ADDRLP4 12+20+3
+ADDRLP4 304
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 320
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 264+4
+INDIRF4
+ADDRLP4 320
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 324
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 252+4
+INDIRF4
+ADDRLP4 324
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 252+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 111
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 19
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 332
+CNSTF4 1132396544
+ADDRLP4 276
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 336
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 336
+INDIRF4
+LTF4 $845
+ADDRLP4 328
+ADDRLP4 332
+INDIRF4
+ADDRLP4 336
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $846
+JUMPV
+LABELV $845
+ADDRLP4 328
+ADDRLP4 332
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $846
+ADDRLP4 12+24+20+3
+ADDRLP4 328
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 344
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 344
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 264+4
+INDIRF4
+ADDRLP4 344
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 348
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 348
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 252+4
+INDIRF4
+ADDRLP4 348
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 252+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 111
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 19
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 356
+CNSTF4 1132396544
+ADDRLP4 276
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 360
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 356
+INDIRF4
+ADDRLP4 360
+INDIRF4
+LTF4 $875
+ADDRLP4 352
+ADDRLP4 356
+INDIRF4
+ADDRLP4 360
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $876
+JUMPV
+LABELV $875
+ADDRLP4 352
+ADDRLP4 356
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $876
+ADDRLP4 12+48+20+3
+ADDRLP4 352
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 368
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 368
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 264+4
+INDIRF4
+ADDRLP4 368
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 372
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 372
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 252+4
+INDIRF4
+ADDRLP4 372
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 252+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 111
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 19
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 380
+CNSTF4 1132396544
+ADDRLP4 276
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 384
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 380
+INDIRF4
+ADDRLP4 384
+INDIRF4
+LTF4 $905
+ADDRLP4 376
+ADDRLP4 380
+INDIRF4
+ADDRLP4 384
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $906
+JUMPV
+LABELV $905
+ADDRLP4 376
+ADDRLP4 380
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $906
+ADDRLP4 12+72+20+3
+ADDRLP4 376
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $784
+JUMPV
+LABELV $783
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $907
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $909
+ADDRLP4 260
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 184
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $910
+JUMPV
+LABELV $909
+ADDRLP4 264
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 184
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 1056964608
+ASGNF4
+LABELV $910
+ADDRLP4 272
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 232
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRLP4 272
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 272
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 276
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 276
+INDIRF4
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+ADDRLP4 276
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 288
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 288
+INDIRF4
+ADDRLP4 280
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 196
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+LEF4 $916
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $916
+ADDRLP4 180
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+LEF4 $918
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $918
+CNSTF4 1078530011
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 292
+ADDRGP4 sin
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 296
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 180
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 296
+INDIRF4
+MULF4
+ASGNF4
+CNSTF4 1078530011
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 300
+ADDRGP4 cos
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 304
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 256
+ADDRLP4 196
+INDIRF4
+ADDRLP4 300
+INDIRF4
+MULF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 256
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 312
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 316
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 312
+INDIRF4
+ADDRLP4 316
+INDIRF4
+LTF4 $926
+ADDRLP4 308
+ADDRLP4 312
+INDIRF4
+ADDRLP4 316
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $927
+JUMPV
+LABELV $926
+ADDRLP4 308
+ADDRLP4 312
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $927
+ADDRLP4 12+20
+ADDRLP4 308
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 324
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 328
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 324
+INDIRF4
+ADDRLP4 328
+INDIRF4
+LTF4 $932
+ADDRLP4 320
+ADDRLP4 324
+INDIRF4
+ADDRLP4 328
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $933
+JUMPV
+LABELV $932
+ADDRLP4 320
+ADDRLP4 324
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $933
+ADDRLP4 12+20+1
+ADDRLP4 320
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 336
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 340
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 336
+INDIRF4
+ADDRLP4 340
+INDIRF4
+LTF4 $938
+ADDRLP4 332
+ADDRLP4 336
+INDIRF4
+ADDRLP4 340
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $939
+JUMPV
+LABELV $938
+ADDRLP4 332
+ADDRLP4 336
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $939
+ADDRLP4 12+20+2
+ADDRLP4 332
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 12+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+24
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 256
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+24+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 348
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 352
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 348
+INDIRF4
+ADDRLP4 352
+INDIRF4
+LTF4 $954
+ADDRLP4 344
+ADDRLP4 348
+INDIRF4
+ADDRLP4 352
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $955
+JUMPV
+LABELV $954
+ADDRLP4 344
+ADDRLP4 348
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $955
+ADDRLP4 12+24+20
+ADDRLP4 344
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 360
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 364
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 360
+INDIRF4
+ADDRLP4 364
+INDIRF4
+LTF4 $961
+ADDRLP4 356
+ADDRLP4 360
+INDIRF4
+ADDRLP4 364
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $962
+JUMPV
+LABELV $961
+ADDRLP4 356
+ADDRLP4 360
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $962
+ADDRLP4 12+24+20+1
+ADDRLP4 356
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 372
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 376
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 372
+INDIRF4
+ADDRLP4 376
+INDIRF4
+LTF4 $968
+ADDRLP4 368
+ADDRLP4 372
+INDIRF4
+ADDRLP4 376
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $969
+JUMPV
+LABELV $968
+ADDRLP4 368
+ADDRLP4 372
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $969
+ADDRLP4 12+24+20+2
+ADDRLP4 368
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 12+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+48
+ADDRLP4 12+48
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48+4
+ADDRLP4 12+48+4
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 384
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 388
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 384
+INDIRF4
+ADDRLP4 388
+INDIRF4
+LTF4 $985
+ADDRLP4 380
+ADDRLP4 384
+INDIRF4
+ADDRLP4 388
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $986
+JUMPV
+LABELV $985
+ADDRLP4 380
+ADDRLP4 384
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $986
+ADDRLP4 12+48+20
+ADDRLP4 380
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 396
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 400
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 396
+INDIRF4
+ADDRLP4 400
+INDIRF4
+LTF4 $992
+ADDRLP4 392
+ADDRLP4 396
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $993
+JUMPV
+LABELV $992
+ADDRLP4 392
+ADDRLP4 396
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $993
+ADDRLP4 12+48+20+1
+ADDRLP4 392
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 408
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 412
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 408
+INDIRF4
+ADDRLP4 412
+INDIRF4
+LTF4 $999
+ADDRLP4 404
+ADDRLP4 408
+INDIRF4
+ADDRLP4 412
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1000
+JUMPV
+LABELV $999
+ADDRLP4 404
+ADDRLP4 408
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1000
+ADDRLP4 12+48+20+2
+ADDRLP4 404
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 12+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+72
+ADDRLP4 12+72
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72+4
+ADDRLP4 12+72+4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 420
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 424
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 420
+INDIRF4
+ADDRLP4 424
+INDIRF4
+LTF4 $1016
+ADDRLP4 416
+ADDRLP4 420
+INDIRF4
+ADDRLP4 424
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1017
+JUMPV
+LABELV $1016
+ADDRLP4 416
+ADDRLP4 420
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1017
+ADDRLP4 12+72+20
+ADDRLP4 416
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 432
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 436
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 432
+INDIRF4
+ADDRLP4 436
+INDIRF4
+LTF4 $1023
+ADDRLP4 428
+ADDRLP4 432
+INDIRF4
+ADDRLP4 436
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1024
+JUMPV
+LABELV $1023
+ADDRLP4 428
+ADDRLP4 432
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1024
+ADDRLP4 12+72+20+1
+ADDRLP4 428
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 444
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 448
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 444
+INDIRF4
+ADDRLP4 448
+INDIRF4
+LTF4 $1030
+ADDRLP4 440
+ADDRLP4 444
+INDIRF4
+ADDRLP4 448
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1031
+JUMPV
+LABELV $1030
+ADDRLP4 440
+ADDRLP4 444
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1031
+ADDRLP4 12+72+20+2
+ADDRLP4 440
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 12+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $908
+JUMPV
+LABELV $907
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1035
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+24
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+24+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+48
+ADDRLP4 12+48
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48+4
+ADDRLP4 12+48+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+72
+ADDRLP4 12+72
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72+4
+ADDRLP4 12+72+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1036
+JUMPV
+LABELV $1035
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1108
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 232
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRLP4 300
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 300
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1111
+ADDRLP4 200
+CNSTF4 1065351538
+ASGNF4
+LABELV $1111
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 312
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 308
+INDIRF4
+ADDRLP4 312
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 316
+INDIRF4
+ADDRLP4 312
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 316
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 320
+INDIRF4
+ADDRLP4 196
+INDIRF4
+CNSTF4 1069547520
+DIVF4
+GEF4 $1113
+ADDRGP4 $169
+JUMPV
+LABELV $1113
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 276
+ADDRLP4 324
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 324
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimCounts
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 328
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 328
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 280
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 shaderAnims
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1116
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRLP4 284
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 284+8
+ADDRLP4 284+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 284
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 252
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $1116
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1121
+ADDRLP4 336
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 252+4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 252+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 340
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 340
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 264+4
+INDIRF4
+ADDRLP4 340
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 264+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1122
+JUMPV
+LABELV $1121
+ADDRLP4 336
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 340
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 340
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 340
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1122
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1153
+ADDRLP4 332
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 252+4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 252+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1154
+JUMPV
+LABELV $1153
+ADDRLP4 332
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1154
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+ADDRLP4 332
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 264+4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 264+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1185
+JUMPV
+LABELV $1184
+ADDRLP4 332
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1185
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1215
+ADDRLP4 332
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 252+4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 252+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1216
+JUMPV
+LABELV $1215
+ADDRLP4 332
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1216
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+3
+CNSTU1 255
+ASGNU1
+LABELV $1108
+LABELV $1036
+LABELV $908
+LABELV $784
+LABELV $538
+LABELV $403
+LABELV $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1246
+ADDRGP4 $169
+JUMPV
+LABELV $1246
+ADDRLP4 252
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 1
+EQI4 $1251
+ADDRLP4 252
+INDIRI4
+CNSTI4 5
+EQI4 $1251
+ADDRLP4 252
+INDIRI4
+CNSTI4 11
+NEI4 $1248
+LABELV $1251
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 CG_AddPolyToSceneBatch
+CALLV
+pop
+ADDRGP4 $1249
+JUMPV
+LABELV $1248
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_AddPolyToSceneBatch
+CALLV
+pop
+LABELV $1249
+LABELV $169
+endproc CG_AddParticleToScene 480 16
+data
+align 4
+LABELV roll
+byte 4 0
+code
+proc CG_CullParticles 68 12
+ADDRLP4 0
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 $1256
+JUMPV
+LABELV $1253
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1254
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $1256
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1253
+ADDRLP4 28
+ADDRGP4 CG_BeginCullGrid
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $1257
+ADDRGP4 $1252
+JUMPV
+LABELV $1257
+ADDRLP4 0
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 $1262
+JUMPV
+LABELV $1259
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+EQI4 $1268
+ADDRLP4 32
+INDIRI4
+CNSTI4 5
+EQI4 $1268
+ADDRLP4 32
+INDIRI4
+CNSTI4 11
+EQI4 $1268
+ADDRLP4 32
+INDIRI4
+CNSTI4 13
+EQI4 $1268
+ADDRLP4 32
+INDIRI4
+CNSTI4 14
+NEI4 $1263
+LABELV $1268
+ADDRGP4 $1260
+JUMPV
+LABELV $1263
+ADDRLP4 4
+CNSTF4 981668463
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+LEF4 $1274
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1275
+JUMPV
+LABELV $1274
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1275
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+LEF4 $1276
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1277
+JUMPV
+LABELV $1276
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1277
+ADDRLP4 24
+CNSTF4 1069547520
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRGP4 CG_AddToCullGrid
+CALLV
+pop
+LABELV $1260
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $1262
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1259
+ADDRGP4 CG_CullGrid
+CALLV
+pop
+LABELV $1252
+endproc CG_CullParticles 68 12
+export CG_AddParticles
+proc CG_AddParticles 92 16
+ADDRGP4 initparticles
+INDIRI4
+CNSTI4 0
+NEI4 $1279
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+LABELV $1279
+ADDRGP4 vforward
+ADDRGP4 cg+609412+36
+INDIRB
+ASGNB 12
+ADDRGP4 vright
+ADDRGP4 cg+609412+36+12
+INDIRB
+ASGNB 12
+ADDRGP4 vup
+ADDRGP4 cg+609412+36+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 52
+ADDRGP4 roll
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1036831949
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRGP4 oldtime
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 40+8
+INDIRF4
+CNSTF4 1063675494
+ADDRLP4 52
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRGP4 rforward
+ARGP4
+ADDRGP4 rright
+ARGP4
+ADDRGP4 rup
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 oldtime
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 CG_CullParticles
+CALLV
+pop
+ADDRLP4 56
+CNSTP4 0
+ASGNP4
+ADDRLP4 36
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 $1297
+JUMPV
+LABELV $1294
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 981668463
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $1299
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1295
+JUMPV
+LABELV $1299
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+EQI4 $1305
+ADDRLP4 64
+INDIRI4
+CNSTI4 6
+EQI4 $1305
+ADDRLP4 64
+INDIRI4
+CNSTI4 8
+EQI4 $1305
+ADDRLP4 64
+INDIRI4
+CNSTI4 12
+NEI4 $1301
+LABELV $1305
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $1306
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1295
+JUMPV
+LABELV $1306
+LABELV $1301
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $1309
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $1311
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1295
+JUMPV
+LABELV $1311
+LABELV $1309
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $1314
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $1316
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1295
+JUMPV
+LABELV $1316
+LABELV $1314
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 7
+EQI4 $1321
+ADDRLP4 68
+INDIRI4
+CNSTI4 15
+NEI4 $1319
+LABELV $1321
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1319
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1322
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 CG_AddParticleToScene
+CALLV
+pop
+LABELV $1322
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1295
+JUMPV
+LABELV $1319
+ADDRLP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1324
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1325
+JUMPV
+LABELV $1324
+ADDRLP4 28
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $1325
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1326
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+LABELV $1326
+ADDRLP4 12
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1330
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 CG_AddParticleToScene
+CALLV
+pop
+LABELV $1330
+LABELV $1295
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $1297
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1294
+ADDRGP4 active_particles
+ADDRLP4 36
+INDIRP4
+ASGNP4
+LABELV $1278
+endproc CG_AddParticles 92 16
+export CG_ParticleSnowFlurry
+proc CG_ParticleSnowFlurry 72 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1333
+ADDRGP4 $1335
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1333
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1336
+ADDRGP4 $1332
+JUMPV
+LABELV $1336
+ADDRLP4 8
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1063675494
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+CNSTI4 96
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 100
+MODI4
+CNSTI4 90
+LEI4 $1341
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1036831949
+ASGNF4
+ADDRGP4 $1342
+JUMPV
+LABELV $1341
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $1342
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3248488448
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1343
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3240099840
+ASGNF4
+LABELV $1343
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 1107296256
+ADDRFP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1107296256
+ADDRFP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1345
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1345
+LABELV $1332
+endproc CG_ParticleSnowFlurry 72 4
+export CG_ParticleSnow
+proc CG_ParticleSnow 68 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1348
+ADDRGP4 $1350
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1348
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1351
+ADDRGP4 $1347
+JUMPV
+LABELV $1351
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3259498496
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1354
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3263299584
+ASGNF4
+ADDRGP4 $1355
+JUMPV
+LABELV $1354
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1355
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1356
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1356
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1347
+endproc CG_ParticleSnow 68 4
+export CG_ParticleBubble
+proc CG_ParticleBubble 80 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1359
+ADDRGP4 $1350
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1359
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1361
+ADDRGP4 $1358
+JUMPV
+LABELV $1361
+ADDRLP4 8
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1056964608
+CNSTF4 1073741824
+ADDRLP4 20
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1112014848
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1364
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1115815936
+ASGNF4
+ADDRGP4 $1365
+JUMPV
+LABELV $1364
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 13
+ASGNI4
+LABELV $1365
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1366
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1366
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1358
+endproc CG_ParticleBubble 80 4
+export CG_ParticleSmoke
+proc CG_ParticleSmoke 44 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1369
+ADDRGP4 $1371
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1369
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1372
+ADDRGP4 $1368
+JUMPV
+LABELV $1372
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+CNSTI4 96
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1084227584
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1377
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTF4 3212836864
+ADDRLP4 36
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1377
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $1368
+endproc CG_ParticleSmoke 44 4
+export CG_ParticleBulletDebris
+proc CG_ParticleBulletDebris 28 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1380
+ADDRGP4 $1379
+JUMPV
+LABELV $1380
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cgs+632912+480
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3262119936
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 3248488448
+ADDF4
+ASGNF4
+LABELV $1379
+endproc CG_ParticleBulletDebris 28 0
+export CG_ParticleExplosion
+proc CG_ParticleExplosion 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 10
+GEU4 $1388
+ADDRGP4 $1390
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1388
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1394
+JUMPV
+LABELV $1391
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1395
+ADDRGP4 $1393
+JUMPV
+LABELV $1395
+LABELV $1392
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1394
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1391
+LABELV $1393
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1397
+ADDRGP4 $1399
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1387
+JUMPV
+LABELV $1397
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1400
+ADDRGP4 $1387
+JUMPV
+LABELV $1400
+ADDRLP4 8
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $1403
+ADDRFP4 12
+CNSTI4 -1
+ADDRFP4 12
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1404
+JUMPV
+LABELV $1403
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1127415808
+CNSTF4 1073741824
+ADDRLP4 20
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $1404
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimSTRatio
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimSTRatio
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $1387
+endproc CG_ParticleExplosion 28 8
+export CG_AddParticleShrapnel
+proc CG_AddParticleShrapnel 0 0
+LABELV $1406
+endproc CG_AddParticleShrapnel 0 0
+export CG_NewParticleArea
+proc CG_NewParticleArea 92 24
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1408
+CNSTI4 0
+RETI4
+ADDRGP4 $1407
+JUMPV
+LABELV $1408
+ADDRLP4 8
+ARGP4
+ADDRLP4 60
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+NEI4 $1410
+ADDRLP4 40
+CNSTF4 1124073472
+ASGNF4
+ADDRGP4 $1411
+JUMPV
+LABELV $1410
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+NEI4 $1412
+ADDRLP4 40
+CNSTF4 1115684864
+ASGNF4
+ADDRGP4 $1413
+JUMPV
+LABELV $1412
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+NEI4 $1414
+ADDRLP4 40
+CNSTF4 1107296256
+ASGNF4
+ADDRGP4 $1415
+JUMPV
+LABELV $1414
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1416
+ADDRLP4 40
+CNSTF4 1132462080
+ASGNF4
+ADDRGP4 $1417
+JUMPV
+LABELV $1416
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+NEI4 $1418
+ADDRLP4 40
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 $1419
+JUMPV
+LABELV $1418
+ADDRLP4 36
+INDIRI4
+CNSTI4 5
+NEI4 $1420
+ADDRLP4 40
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $1421
+JUMPV
+LABELV $1420
+ADDRLP4 36
+INDIRI4
+CNSTI4 6
+NEI4 $1422
+ADDRLP4 40
+CNSTF4 1107296256
+ASGNF4
+ADDRGP4 $1423
+JUMPV
+LABELV $1422
+ADDRLP4 36
+INDIRI4
+CNSTI4 7
+NEI4 $1424
+ADDRLP4 40
+CNSTF4 1115684864
+ASGNF4
+LABELV $1424
+LABELV $1423
+LABELV $1421
+LABELV $1419
+LABELV $1417
+LABELV $1415
+LABELV $1413
+LABELV $1411
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1426
+ADDRLP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+LABELV $1427
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1426
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1430
+ADDRLP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+LABELV $1431
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1430
+ADDRLP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 76
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 84
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1437
+JUMPV
+LABELV $1434
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LTI4 $1438
+ADDRGP4 cgs+632912+492152
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParticleBubble
+CALLV
+pop
+ADDRGP4 $1439
+JUMPV
+LABELV $1438
+ADDRGP4 cgs+632912+492152
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParticleSnow
+CALLV
+pop
+LABELV $1439
+LABELV $1435
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1437
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $1434
+CNSTI4 1
+RETI4
+LABELV $1407
+endproc CG_NewParticleArea 92 24
+export CG_SnowLink
+proc CG_SnowLink 16 0
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 $1448
+JUMPV
+LABELV $1445
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $1451
+ADDRLP4 12
+INDIRI4
+CNSTI4 5
+NEI4 $1449
+LABELV $1451
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1452
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1454
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1455
+JUMPV
+LABELV $1454
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1455
+LABELV $1452
+LABELV $1449
+LABELV $1446
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1448
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1445
+LABELV $1444
+endproc CG_SnowLink 16 0
+export CG_ParticleImpactSmokePuff
+proc CG_ParticleImpactSmokePuff 36 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1457
+ADDRGP4 $1459
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1457
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1460
+ADDRGP4 $1456
+JUMPV
+LABELV $1460
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1127415808
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 1000
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 500
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1456
+endproc CG_ParticleImpactSmokePuff 36 4
+export CG_Particle_Bleed
+proc CG_Particle_Bleed 36 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1467
+ADDRGP4 $1469
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1467
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1470
+ADDRGP4 $1466
+JUMPV
+LABELV $1470
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1474
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1475
+JUMPV
+LABELV $1474
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+ASGNF4
+LABELV $1475
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+MODI4
+CNSTI4 4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3248488448
+ASGNF4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 32
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1466
+endproc CG_Particle_Bleed 36 4
+export CG_Particle_OilParticle
+proc CG_Particle_OilParticle 48 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTF4 1153138688
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1481
+ADDRGP4 $1483
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1481
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1484
+ADDRGP4 $1478
+JUMPV
+LABELV $1484
+ADDRLP4 20
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3248488448
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1478
+endproc CG_Particle_OilParticle 48 4
+export CG_Particle_OilSlick
+proc CG_Particle_OilSlick 48 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1489
+ADDRGP4 $1491
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1489
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1492
+ADDRGP4 $1488
+JUMPV
+LABELV $1492
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1495
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1496
+JUMPV
+LABELV $1495
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 60000
+ADDI4
+CVIF4 4
+ASGNF4
+LABELV $1496
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+NEF4 $1501
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+EQF4 $1499
+LABELV $1501
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1500
+JUMPV
+LABELV $1499
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+LABELV $1500
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1057803469
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1488
+endproc CG_Particle_OilSlick 48 4
+export CG_OilSlickRemove
+proc CG_OilSlickRemove 20 4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1503
+ADDRGP4 $1505
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1503
+ADDRLP4 0
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 $1509
+JUMPV
+LABELV $1506
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $1510
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1512
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 10
+ASGNI4
+LABELV $1512
+LABELV $1510
+LABELV $1507
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1509
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1506
+LABELV $1502
+endproc CG_OilSlickRemove 20 4
+export ValidBloodPool
+proc ValidBloodPool 448 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 416
+CNSTI4 16
+ASGNI4
+ADDRLP4 400
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRLP4 420
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRLP4 68+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 68
+ARGP4
+ADDRLP4 404
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 404
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 428
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 428
+INDIRF4
+ADDRLP4 68
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 152+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 428
+INDIRF4
+ADDRLP4 68+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 152+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 68+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+ADDRLP4 400
+INDIRI4
+NEGI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRGP4 $1525
+JUMPV
+LABELV $1522
+ADDRLP4 432
+ADDRLP4 144
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 152
+INDIRF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 432
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 152+4
+INDIRF4
+ADDRLP4 164+4
+INDIRF4
+ADDRLP4 432
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 152+8
+INDIRF4
+ADDRLP4 164+8
+INDIRF4
+ADDRLP4 144
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 140
+INDIRI4
+NEGI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRGP4 $1535
+JUMPV
+LABELV $1532
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+8
+ADDP4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 436
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+ADDRLP4 92
+ADDP4
+ADDRLP4 436
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 68
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 440
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 440
+INDIRI4
+ADDRLP4 92+4
+ADDP4
+ADDRLP4 440
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 68+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 444
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 444
+INDIRI4
+ADDRLP4 92+8
+ADDP4
+ADDRLP4 444
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 68+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1533
+ADDRLP4 52
+ADDRLP4 52
+INDIRI4
+ADDRLP4 140
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1535
+ADDRLP4 52
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $1532
+LABELV $1523
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+ADDRLP4 400
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1525
+ADDRLP4 144
+INDIRI4
+ADDRLP4 400
+INDIRI4
+LTI4 $1522
+ADDRLP4 176
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 432
+CNSTP4 0
+ASGNP4
+ADDRLP4 432
+INDIRP4
+ARGP4
+ADDRLP4 432
+INDIRP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_TraceBatch
+CALLV
+pop
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1551
+JUMPV
+LABELV $1548
+CNSTI4 56
+ADDRLP4 148
+INDIRI4
+MULI4
+ADDRLP4 176+52
+ADDP4
+INDIRI4
+CNSTI4 1022
+GEI4 $1552
+CNSTI4 0
+RETI4
+ADDRGP4 $1515
+JUMPV
+LABELV $1552
+ADDRLP4 436
+CNSTI4 56
+ADDRLP4 148
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+ADDRLP4 176+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1559
+ADDRLP4 436
+INDIRI4
+ADDRLP4 176+8
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1555
+LABELV $1559
+CNSTI4 0
+RETI4
+ADDRGP4 $1515
+JUMPV
+LABELV $1555
+LABELV $1549
+ADDRLP4 148
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1551
+ADDRLP4 148
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $1548
+CNSTI4 1
+RETI4
+LABELV $1515
+endproc ValidBloodPool 448 32
+export CG_BloodPool
+proc CG_BloodPool 60 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1561
+ADDRGP4 $1563
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1561
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1564
+ADDRGP4 $1560
+JUMPV
+LABELV $1564
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ADDRGP4 ValidBloodPool
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1566
+ADDRGP4 $1560
+JUMPV
+LABELV $1566
+ADDRLP4 28
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 3000
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1058642330
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1053609165
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1090519040
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1090519040
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 56
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $1560
+endproc CG_BloodPool 60 4
+export CG_ParticleBloodCloud
+proc CG_ParticleBloodCloud 96 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 60
+CNSTP4 0
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+EQF4 $1571
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $1571
+ADDRLP4 36
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1573
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+LABELV $1573
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1578
+JUMPV
+LABELV $1575
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1585
+ADDRGP4 $1570
+JUMPV
+LABELV $1585
+ADDRLP4 68
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cgs+632912+492136
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 350
+ADDI4
+CVIF4 4
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 88
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1576
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1578
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDRLP4 36
+INDIRF4
+LTF4 $1575
+LABELV $1570
+endproc CG_ParticleBloodCloud 96 16
+export CG_ParticleSparks
+proc CG_ParticleSparks 72 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1593
+ADDRGP4 $1592
+JUMPV
+LABELV $1593
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cgs+632912+480
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+ADDRFP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1592
+endproc CG_ParticleSparks 72 0
+export CG_ParticleDust
+proc CG_ParticleDust 132 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 72
+CNSTP4 0
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+EQF4 $1601
+ADDRLP4 40
+ADDRLP4 32
+INDIRF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $1601
+ADDRLP4 40
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1603
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+LABELV $1603
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1608
+JUMPV
+LABELV $1605
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1615
+ADDRGP4 $1600
+JUMPV
+LABELV $1615
+ADDRLP4 80
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cgs+632912+492136
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+EQF4 $1620
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 4500
+ADDI4
+CVIF4 4
+CNSTF4 1163575296
+CNSTF4 1073741824
+ADDRLP4 92
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1621
+JUMPV
+LABELV $1620
+ADDRLP4 96
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 750
+ADDI4
+CVIF4 4
+CNSTF4 1140457472
+CNSTF4 1073741824
+ADDRLP4 96
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1621
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1119879168
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1119879168
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+NEF4 $1625
+ADDRLP4 100
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+CNSTF4 1045220557
+ADDRLP4 100
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTF4 1045220557
+ADDRLP4 104
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+LABELV $1625
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1086324736
+CNSTF4 1073741824
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1086324736
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1101004800
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 112
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 112
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 116
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3246391296
+ASGNF4
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 128
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1606
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1608
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+LTF4 $1605
+LABELV $1600
+endproc CG_ParticleDust 132 16
+export CG_ParticleMisc
+proc CG_ParticleMisc 20 4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1628
+ADDRGP4 $1459
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1628
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1630
+ADDRGP4 $1627
+JUMPV
+LABELV $1630
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $1633
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1634
+JUMPV
+LABELV $1633
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1634
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 15
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1627
+endproc CG_ParticleMisc 20 4
+bss
+export oldtime
+align 4
+LABELV oldtime
+skip 4
+export rup
+align 4
+LABELV rup
+skip 12
+export rright
+align 4
+LABELV rright
+skip 12
+export rforward
+align 4
+LABELV rforward
+skip 12
+export vup
+align 4
+LABELV vup
+skip 12
+export vright
+align 4
+LABELV vright
+skip 12
+export vforward
+align 4
+LABELV vforward
+skip 12
+export particles
+align 4
+LABELV particles
+skip 131072
+export free_particles
+align 4
+LABELV free_particles
+skip 4
+export active_particles
+align 4
+LABELV active_particles
+skip 4
+align 4
+LABELV numShaderAnims
+skip 4
+align 4
+LABELV shaderAnims
+skip 8192
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_ClearSceneBatch
+import CG_FlushSceneBatch
+import CG_AddPolyToSceneBatch
+import CG_AddRefEntityToSceneBatch
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_ShutdownLocalEnts
+import CG_GetStoredScriptVarsFromLE
+import CG_RunFxAll
+import CG_SmokePuff_ql
+import CG_AddRefEntityFX
+import CG_AddRefEntity
+import CG_ListLocalEntities
+import CG_RemoveFXLocalEntities
+import CG_ClearLocalFrameEntities
+import CG_CullGrid
+import CG_AddToCullGrid
+import CG_BeginCullGrid
+import CG_AddLocalEntities
+import CG_MakeLowPriorityEntity
+import CG_AllocLocalEntityRealTime
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import FxLoopSounds
+import CG_FreeFxJitTokens
+import CG_ResetFXIntervalAndDistance
+import CG_UpdatePositionData
+import CG_CopyPositionDataToScript
+import CG_CopyPositionDataToCent
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+import CG_CopyPlayerDataToScriptData
+import CG_ResetScriptVars
+import CG_ReloadQ3mmeScripts
+import CG_RunQ3mmeScript
+import CG_Q3mmeMath
+import EffectScripts
+import PlainScript
+import DistanceScript
+import EmitterScript
+import EmitterScriptVars
+import ScriptVars
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1563
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1505
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 79
+byte 1 105
+byte 1 108
+byte 1 83
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 118
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1491
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 79
+byte 1 105
+byte 1 108
+byte 1 83
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1483
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 79
+byte 1 105
+byte 1 108
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1469
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 66
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1459
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1399
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1390
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1371
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1350
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1335
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $168
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $150
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 49
+byte 1 0
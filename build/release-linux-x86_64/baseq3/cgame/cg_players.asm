@@ -0,0 +1,32895 @@
+data
+export cg_customSoundNames
+align 4
+LABELV cg_customSoundNames
+address $157
+address $158
+address $159
+address $160
+address $161
+address $162
+address $163
+address $164
+address $165
+address $166
+address $167
+address $168
+address $169
+skip 76
+export CG_CustomSound
+code
+proc CG_CustomSound 536 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $171
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 524
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $171
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $173
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $178
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $176
+LABELV $178
+ADDRGP4 $179
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $176
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $180
+ADDRFP4 0
+CNSTI4 1496
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+172
+ADDP4
+INDIRI4
+CNSTI4 15
+BANDI4
+ASGNI4
+LABELV $180
+LABELV $173
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $185
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $183
+LABELV $185
+ADDRGP4 $186
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $183
+ADDRLP4 4
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+CNSTI4 1496
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 CG_CheckForModelChange
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $191
+JUMPV
+LABELV $188
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 532
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 532
+INDIRI4
+CNSTI4 0
+NEI4 $192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2016
+ADDP4
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $192
+LABELV $189
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $191
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $194
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $188
+LABELV $194
+ADDRGP4 $195
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $170
+endproc CG_CustomSound 536 20
+proc CG_ParseAnimationFile 20088 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 980
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20032
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20036
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 20036
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GTI4 $197
+CNSTI4 0
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $197
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+CNSTU4 19999
+LTU4 $199
+ADDRGP4 $201
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $199
+ADDRLP4 32
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 32
+ASGNP4
+ADDRLP4 20040
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20040
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 892
+ADDP4
+ADDRLP4 20040
+INDIRI4
+ASGNI4
+ADDRLP4 20048
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 888
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 884
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 880
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 896
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 872
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 876
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $203
+JUMPV
+LABELV $202
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $205
+ADDRGP4 $204
+JUMPV
+LABELV $205
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $209
+ARGP4
+ADDRLP4 20056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20056
+INDIRI4
+CNSTI4 0
+NEI4 $207
+ADDRLP4 12
+ARGP4
+ADDRLP4 20060
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20060
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $210
+ADDRGP4 $204
+JUMPV
+LABELV $210
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $212
+LABELV $216
+ADDRFP4 4
+INDIRP4
+CNSTI4 892
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $203
+JUMPV
+LABELV $212
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 20072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 0
+NEI4 $217
+ADDRFP4 4
+INDIRP4
+CNSTI4 892
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $203
+JUMPV
+LABELV $217
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $222
+ARGP4
+ADDRLP4 20076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 0
+NEI4 $220
+ADDRFP4 4
+INDIRP4
+CNSTI4 892
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $203
+JUMPV
+LABELV $220
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $225
+ARGP4
+ADDRLP4 20080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20080
+INDIRI4
+CNSTI4 0
+NEI4 $223
+ADDRFP4 4
+INDIRP4
+CNSTI4 892
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $203
+JUMPV
+LABELV $223
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $228
+ARGP4
+ADDRLP4 20084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20084
+INDIRI4
+CNSTI4 0
+NEI4 $226
+ADDRFP4 4
+INDIRP4
+CNSTI4 892
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $203
+JUMPV
+LABELV $226
+ADDRGP4 $229
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $203
+JUMPV
+LABELV $207
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 20060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20060
+INDIRI4
+CNSTI4 0
+NEI4 $230
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $233
+ADDRLP4 12
+ARGP4
+ADDRLP4 20064
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $237
+ADDRGP4 $203
+JUMPV
+LABELV $237
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20068
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 880
+ADDP4
+ADDP4
+ADDRLP4 20068
+INDIRF4
+ASGNF4
+LABELV $234
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $233
+ADDRGP4 $203
+JUMPV
+LABELV $230
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $241
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+NEI4 $239
+ADDRLP4 12
+ARGP4
+ADDRLP4 20068
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20068
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $242
+ADDRGP4 $204
+JUMPV
+LABELV $242
+ADDRLP4 20072
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 102
+EQI4 $246
+ADDRLP4 20072
+INDIRI4
+CNSTI4 70
+NEI4 $244
+LABELV $246
+ADDRFP4 4
+INDIRP4
+CNSTI4 896
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $203
+JUMPV
+LABELV $244
+ADDRLP4 20076
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 110
+EQI4 $249
+ADDRLP4 20076
+INDIRI4
+CNSTI4 78
+NEI4 $247
+LABELV $249
+ADDRFP4 4
+INDIRP4
+CNSTI4 896
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $203
+JUMPV
+LABELV $247
+ADDRFP4 4
+INDIRP4
+CNSTI4 896
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $203
+JUMPV
+LABELV $239
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $252
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $250
+ADDRFP4 4
+INDIRP4
+CNSTI4 872
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $203
+JUMPV
+LABELV $250
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $255
+ARGP4
+ADDRLP4 20072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 0
+NEI4 $253
+ADDRFP4 4
+INDIRP4
+CNSTI4 876
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $203
+JUMPV
+LABELV $253
+ADDRLP4 20076
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 48
+LTI4 $256
+ADDRLP4 20076
+INDIRI4
+CNSTI4 57
+GTI4 $256
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $204
+JUMPV
+LABELV $256
+ADDRGP4 $258
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $203
+ADDRGP4 $202
+JUMPV
+LABELV $204
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $259
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $263
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+LTI4 $261
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+GTI4 $261
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $260
+JUMPV
+LABELV $263
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 20056
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $267
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $267
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+LTI4 $269
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $269
+ADDRLP4 20064
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20064
+INDIRP4
+ADDRLP4 20064
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $269
+ADDRLP4 12
+ARGP4
+ADDRLP4 20064
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $271
+ADDRGP4 $261
+JUMPV
+LABELV $271
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20068
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $273
+ADDRLP4 20072
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20072
+INDIRP4
+ADDRLP4 20072
+INDIRP4
+INDIRI4
+NEGI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $273
+ADDRLP4 12
+ARGP4
+ADDRLP4 20072
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $275
+ADDRGP4 $261
+JUMPV
+LABELV $275
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20076
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20076
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20080
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20080
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $277
+ADDRGP4 $261
+JUMPV
+LABELV $277
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20084
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20084
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $279
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $279
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $260
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+LTI4 $259
+LABELV $261
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+EQI4 $281
+ADDRGP4 $283
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $281
+ADDRLP4 8
+INDIRP4
+CNSTI4 896
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+ARGP4
+CNSTU4 28
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 916
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 924
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 392
+ADDP4
+ARGP4
+CNSTU4 28
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 944
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 956
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 960
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 964
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 968
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 972
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 980
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 984
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 988
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 992
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 996
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1020
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1024
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1028
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $196
+endproc CG_ParseAnimationFile 20088 12
+export CG_FileExists
+proc CG_FileExists 8 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $285
+CNSTI4 1
+RETI4
+ADDRGP4 $284
+JUMPV
+LABELV $285
+CNSTI4 0
+RETI4
+LABELV $284
+endproc CG_FileExists 8 12
+export CG_RegisterSkinVertexLight
+proc CG_RegisterSkinVertexLight 20 8
+ADDRGP4 $288
+ARGP4
+ADDRLP4 8
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $289
+ADDRGP4 $288
+ARGP4
+ADDRGP4 $291
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $289
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $292
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $288
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $287
+endproc CG_RegisterSkinVertexLight 20 8
+proc CG_FindClientModelFile 48 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $294
+ADDRGP4 cg_useDefaultTeamSkins+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $294
+ADDRLP4 20
+ADDRFP4 8
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $301
+ADDRGP4 $298
+JUMPV
+LABELV $301
+ADDRLP4 8
+ADDRGP4 $302
+ASGNP4
+ADDRGP4 $295
+JUMPV
+LABELV $298
+ADDRLP4 8
+ADDRGP4 $303
+ASGNP4
+ADDRGP4 $295
+JUMPV
+LABELV $294
+ADDRLP4 8
+ADDRGP4 $214
+ASGNP4
+LABELV $295
+ADDRLP4 4
+ADDRGP4 $304
+ASGNP4
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $308
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $312
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $312
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $314
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $315
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $313
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $316
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $316
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $318
+ADDRFP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $318
+ADDRGP4 cg_useDefaultTeamSkins+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $318
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $322
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $322
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 40
+INDIRI4
+EQI4 $322
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $324
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $319
+JUMPV
+LABELV $322
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $325
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $319
+JUMPV
+LABELV $318
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $326
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $326
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 40
+INDIRI4
+EQI4 $326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $324
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $327
+JUMPV
+LABELV $326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $325
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $327
+LABELV $319
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $328
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $328
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $332
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $330
+LABELV $332
+ADDRGP4 $310
+JUMPV
+LABELV $330
+LABELV $309
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $308
+LABELV $310
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $333
+ADDRGP4 $307
+JUMPV
+LABELV $333
+ADDRLP4 4
+ADDRGP4 $335
+ASGNP4
+LABELV $306
+ADDRGP4 $305
+JUMPV
+LABELV $307
+CNSTI4 0
+RETI4
+LABELV $293
+endproc CG_FindClientModelFile 48 40
+export CG_FindClientHeadFile
+proc CG_FindClientHeadFile 48 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $337
+ADDRGP4 cg_useDefaultTeamSkins+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $337
+ADDRLP4 20
+ADDRFP4 8
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $344
+ADDRGP4 $341
+JUMPV
+LABELV $344
+ADDRLP4 8
+ADDRGP4 $302
+ASGNP4
+ADDRGP4 $338
+JUMPV
+LABELV $341
+ADDRLP4 8
+ADDRGP4 $303
+ASGNP4
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRLP4 8
+ADDRGP4 $214
+ASGNP4
+LABELV $338
+ADDRFP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $345
+ADDRLP4 4
+ADDRGP4 $347
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $349
+JUMPV
+LABELV $345
+ADDRLP4 4
+ADDRGP4 $304
+ASGNP4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $351
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $355
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $355
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $355
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $357
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $358
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $356
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $359
+CNSTI4 1
+RETI4
+ADDRGP4 $336
+JUMPV
+LABELV $359
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $361
+ADDRFP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $361
+ADDRGP4 cg_useDefaultTeamSkins+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $361
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $365
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $365
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 40
+INDIRI4
+EQI4 $365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $324
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $362
+JUMPV
+LABELV $365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $325
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $367
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $367
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 40
+INDIRI4
+EQI4 $367
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $324
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $325
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $368
+LABELV $362
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $369
+CNSTI4 1
+RETI4
+ADDRGP4 $336
+JUMPV
+LABELV $369
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $373
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $371
+LABELV $373
+ADDRGP4 $353
+JUMPV
+LABELV $371
+LABELV $352
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $351
+LABELV $353
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $374
+ADDRGP4 $350
+JUMPV
+LABELV $374
+ADDRLP4 4
+ADDRGP4 $347
+ASGNP4
+LABELV $349
+ADDRGP4 $348
+JUMPV
+LABELV $350
+CNSTI4 0
+RETI4
+LABELV $336
+endproc CG_FindClientHeadFile 48 40
+proc CG_RegisterClientSkin 224 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 192
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $377
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $380
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $383
+ADDRLP4 64
+ARGP4
+ADDRGP4 $303
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $378
+JUMPV
+LABELV $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $385
+ADDRLP4 64
+ARGP4
+ADDRGP4 $302
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $378
+JUMPV
+LABELV $385
+ADDRLP4 64
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $378
+JUMPV
+LABELV $380
+ADDRLP4 64
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRLP4 64
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $378
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 196
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $387
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $392
+ADDRLP4 128
+ARGP4
+ADDRGP4 $303
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $388
+JUMPV
+LABELV $392
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $394
+ADDRLP4 128
+ARGP4
+ADDRGP4 $302
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $388
+JUMPV
+LABELV $394
+ADDRLP4 128
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $388
+JUMPV
+LABELV $389
+ADDRLP4 128
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $388
+JUMPV
+LABELV $387
+ADDRLP4 128
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $388
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 $398
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $396
+ADDRLP4 0
+ARGP4
+ADDRLP4 204
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 904
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+LABELV $396
+ADDRFP4 0
+INDIRP4
+CNSTI4 904
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $400
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRGP4 $405
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 204
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $402
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $406
+ARGP4
+ADDRGP4 $398
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 208
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 904
+ADDP4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+LABELV $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 904
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $407
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 $398
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 208
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 904
+ADDP4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+LABELV $407
+LABELV $400
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 $411
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $409
+ADDRLP4 0
+ARGP4
+ADDRLP4 208
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 968
+ADDP4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+LABELV $409
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 $414
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 208
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $412
+ADDRLP4 0
+ARGP4
+ADDRLP4 212
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+ADDRLP4 212
+INDIRI4
+ASGNI4
+LABELV $412
+ADDRFP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $415
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $417
+ADDRGP4 $405
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $417
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $406
+ARGP4
+ADDRGP4 $414
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 216
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+LABELV $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $420
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 $414
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 216
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+LABELV $420
+LABELV $415
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 $411
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRLP4 0
+ARGP4
+ADDRLP4 216
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+LABELV $422
+ADDRFP4 0
+INDIRP4
+CNSTI4 944
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $424
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $426
+ADDRGP4 $405
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 216
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $426
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $406
+ARGP4
+ADDRGP4 $411
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 220
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRLP4 220
+INDIRI4
+ASGNI4
+LABELV $426
+ADDRFP4 0
+INDIRP4
+CNSTI4 944
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $429
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 $411
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 220
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRLP4 220
+INDIRI4
+ASGNI4
+LABELV $429
+LABELV $424
+ADDRLP4 220
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 904
+ADDP4
+INDIRI4
+ADDRLP4 220
+INDIRI4
+EQI4 $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+INDIRI4
+ADDRLP4 220
+INDIRI4
+EQI4 $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 944
+ADDP4
+INDIRI4
+ADDRLP4 220
+INDIRI4
+NEI4 $431
+LABELV $434
+CNSTI4 0
+RETI4
+ADDRGP4 $376
+JUMPV
+LABELV $431
+CNSTI4 1
+RETI4
+LABELV $376
+endproc CG_RegisterClientSkin 224 36
+lit
+align 4
+LABELV $436
+byte 4 0
+byte 4 0
+byte 4 0
+code
+proc CG_GetPlayerHeight 744 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 $436
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 172
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 344
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 528
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 344+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 516
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 516
+ARGP4
+ADDRLP4 172+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 516
+ARGP4
+ADDRLP4 344+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 728
+ADDRFP4 0
+INDIRP4
+CNSTI4 1596
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 728
+INDIRI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 728
+INDIRI4
+ASGNI4
+ADDRLP4 732
+ADDRFP4 0
+INDIRP4
+CNSTI4 1288
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172+80
+ADDRLP4 732
+INDIRI4
+ASGNI4
+ADDRLP4 172+96
+ADDRLP4 732
+INDIRI4
+ASGNI4
+ADDRLP4 0+68
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+68+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+68+8
+ADDRGP4 bg_playerMins+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+84
+ADDRLP4 0+68
+INDIRB
+ASGNB 12
+ADDRLP4 172
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $456
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 344
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRLP4 172+8
+INDIRI4
+ARGI4
+ADDRGP4 $458
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 528
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRLP4 172+8
+INDIRI4
+ARGI4
+ADDRGP4 $460
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 344+8
+INDIRI4
+ARGI4
+ADDRLP4 716
+ARGP4
+ADDRLP4 704
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRGP4 $464
+ARGP4
+ADDRLP4 736
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRGP4 $464
+ARGP4
+ADDRLP4 736
+INDIRU4
+CNSTU4 1
+SUBU4
+CVUI4 4
+ARGI4
+ADDRLP4 740
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 740
+INDIRI4
+CNSTI4 0
+NEI4 $462
+ADDRLP4 700
+ADDRLP4 528+68+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_weapons+264+12
+INDIRI4
+ARGI4
+ADDRLP4 716
+ARGP4
+ADDRLP4 704
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 700
+ADDRLP4 700
+INDIRF4
+ADDRLP4 704+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $463
+JUMPV
+LABELV $462
+ADDRLP4 700
+ADDRLP4 344+68+8
+INDIRF4
+ASGNF4
+ADDRLP4 700
+ADDRLP4 700
+INDIRF4
+ADDRLP4 704+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 3472
+ADDP4
+ADDRLP4 700
+INDIRF4
+ASGNF4
+LABELV $435
+endproc CG_GetPlayerHeight 744 16
+export CG_RegisterClientModelname
+proc CG_RegisterClientModelname 188 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $474
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $475
+JUMPV
+LABELV $474
+ADDRLP4 64
+ADDRFP4 12
+INDIRP4
+ASGNP4
+LABELV $475
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $476
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $477
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $479
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $480
+ADDRGP4 $482
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $480
+LABELV $477
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $483
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 964
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $484
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $485
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $487
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRGP4 $482
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $488
+LABELV $485
+ADDRLP4 64
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $490
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $492
+ARGP4
+ADDRLP4 156
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $491
+JUMPV
+LABELV $490
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $483
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $491
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $493
+ADDRLP4 64
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $493
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $492
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 164
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+LABELV $493
+ADDRFP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $495
+ADDRGP4 $482
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $495
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 CG_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $497
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $499
+ADDRFP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $499
+ADDRGP4 $501
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $502
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $504
+ARGP4
+ADDRGP4 $505
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $503
+JUMPV
+LABELV $502
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $504
+ARGP4
+ADDRGP4 $506
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $503
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 CG_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $500
+ADDRGP4 $501
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $500
+JUMPV
+LABELV $499
+ADDRGP4 $509
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $500
+LABELV $497
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $510
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 CG_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $511
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $513
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 CG_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $514
+ADDRGP4 $516
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $514
+LABELV $511
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $517
+ADDRLP4 0
+ARGP4
+ADDRLP4 172
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 972
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRGP4 $518
+JUMPV
+LABELV $517
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRGP4 $522
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $520
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 972
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+LABELV $520
+LABELV $518
+ADDRFP4 0
+INDIRP4
+CNSTI4 972
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $523
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $525
+ADDRLP4 0
+ARGP4
+ADDRLP4 180
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 972
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 $526
+JUMPV
+LABELV $525
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRGP4 $522
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $527
+ADDRLP4 0
+ARGP4
+ADDRLP4 184
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 972
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+LABELV $527
+LABELV $526
+LABELV $523
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_GetPlayerHeight
+CALLV
+pop
+ADDRLP4 68
+INDIRI4
+RETI4
+LABELV $473
+endproc CG_RegisterClientModelname 188 36
+data
+align 4
+LABELV g_color_table_ql_0_1_0_303
+byte 4 1064766013
+byte 4 0
+byte 4 0
+byte 4 1064766013
+byte 4 0
+byte 4 0
+byte 4 1064766013
+byte 4 1052938076
+byte 4 0
+byte 4 1064766013
+byte 4 1058441003
+byte 4 0
+byte 4 1064766013
+byte 4 1061477679
+byte 4 0
+byte 4 1064766013
+byte 4 1064766013
+byte 4 0
+byte 4 1061477679
+byte 4 1064766013
+byte 4 0
+byte 4 1058441003
+byte 4 1064766013
+byte 4 0
+byte 4 1052938076
+byte 4 1064766013
+byte 4 0
+byte 4 0
+byte 4 1064766013
+byte 4 0
+byte 4 0
+byte 4 1064766013
+byte 4 1052938076
+byte 4 0
+byte 4 1064766013
+byte 4 1058441003
+byte 4 0
+byte 4 1064766013
+byte 4 1061477679
+byte 4 0
+byte 4 1064766013
+byte 4 1064766013
+byte 4 0
+byte 4 1061477679
+byte 4 1064766013
+byte 4 0
+byte 4 1058441003
+byte 4 1064766013
+byte 4 0
+byte 4 1052938076
+byte 4 1064766013
+byte 4 0
+byte 4 0
+byte 4 1064766013
+byte 4 1052938076
+byte 4 0
+byte 4 1064766013
+byte 4 1058441003
+byte 4 0
+byte 4 1064766013
+byte 4 1061477679
+byte 4 0
+byte 4 1064766013
+byte 4 1064766013
+byte 4 0
+byte 4 1064766013
+byte 4 1064766013
+byte 4 0
+byte 4 1061477679
+byte 4 1064766013
+byte 4 0
+byte 4 1058441003
+byte 4 1064766013
+byte 4 0
+byte 4 1052938076
+byte 4 1064766013
+byte 4 1064766013
+byte 4 1064766013
+export CG_Q3ColorFromString
+code
+proc CG_Q3ColorFromString 24 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957472
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $533
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 303
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $530
+LABELV $533
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+GEI4 $534
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $534
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+LEI4 $536
+ADDRLP4 0
+CNSTI4 25
+ASGNI4
+LABELV $536
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_color_table_ql_0_1_0_303
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $531
+JUMPV
+LABELV $530
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table_q3
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 g_color_table_q3+4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table_q3+8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $531
+LABELV $529
+endproc CG_Q3ColorFromString 24 16
+export CG_CpmaColorFromPicString
+proc CG_CpmaColorFromPicString 32 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 16
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 121
+EQI4 $545
+ADDRLP4 16
+INDIRI4
+CNSTI4 89
+EQI4 $545
+ADDRLP4 16
+INDIRI4
+CNSTI4 122
+EQI4 $545
+ADDRLP4 16
+INDIRI4
+CNSTI4 90
+NEI4 $541
+LABELV $545
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $542
+JUMPV
+LABELV $541
+ADDRLP4 20
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 97
+LTI4 $549
+ADDRLP4 20
+INDIRI4
+CNSTI4 121
+LTI4 $548
+LABELV $549
+ADDRLP4 24
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 65
+LTI4 $546
+ADDRLP4 24
+INDIRI4
+CNSTI4 89
+GEI4 $546
+LABELV $548
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 97
+SUBI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_color_table_ql_0_1_0_303
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRGP4 g_color_table+4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $547
+LABELV $542
+LABELV $540
+endproc CG_CpmaColorFromPicString 32 4
+export CG_CpmaColorFromString
+proc CG_CpmaColorFromString 32 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 121
+EQI4 $557
+ADDRLP4 16
+INDIRI4
+CNSTI4 89
+EQI4 $557
+ADDRLP4 16
+INDIRI4
+CNSTI4 122
+EQI4 $557
+ADDRLP4 16
+INDIRI4
+CNSTI4 90
+NEI4 $553
+LABELV $557
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $554
+JUMPV
+LABELV $553
+ADDRLP4 20
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 97
+LTI4 $561
+ADDRLP4 20
+INDIRI4
+CNSTI4 121
+LTI4 $560
+LABELV $561
+ADDRLP4 24
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 65
+LTI4 $558
+ADDRLP4 24
+INDIRI4
+CNSTI4 89
+GEI4 $558
+LABELV $560
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 97
+SUBI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_color_table_ql_0_1_0_303
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $559
+JUMPV
+LABELV $558
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRGP4 g_color_table+4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $559
+LABELV $554
+LABELV $552
+endproc CG_CpmaColorFromString 32 4
+export CG_OspColorFromPicString
+proc CG_OspColorFromPicString 300 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 120
+EQI4 $567
+ADDRLP4 20
+INDIRI4
+CNSTI4 88
+NEI4 $565
+LABELV $567
+ADDRLP4 0
+CNSTI1 48
+ASGNI1
+ADDRLP4 0+1
+CNSTI1 120
+ASGNI1
+ADDRLP4 0+2
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0+3
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0+5
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0+6
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0+7
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0+8
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRLP4 24+12
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 $566
+JUMPV
+LABELV $565
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 98
+EQI4 $582
+ADDRLP4 24
+INDIRI4
+CNSTI4 66
+EQI4 $582
+ADDRLP4 24
+INDIRI4
+CNSTI4 102
+EQI4 $582
+ADDRLP4 24
+INDIRI4
+CNSTI4 70
+EQI4 $582
+ADDRLP4 24
+INDIRI4
+CNSTI4 78
+NEI4 $577
+LABELV $582
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 48
+LTI4 $583
+ADDRLP4 28
+INDIRI4
+CNSTI4 57
+GTI4 $583
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 56
+NEI4 $585
+ADDRLP4 16
+CNSTI4 51
+ASGNI4
+LABELV $585
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRGP4 g_color_table+4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $583
+LABELV $578
+LABELV $566
+LABELV $564
+endproc CG_OspColorFromPicString 300 8
+export CG_OspColorFromString
+proc CG_OspColorFromString 300 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 120
+EQI4 $592
+ADDRLP4 20
+INDIRI4
+CNSTI4 88
+NEI4 $590
+LABELV $592
+ADDRLP4 0
+CNSTI1 48
+ASGNI1
+ADDRLP4 0+1
+CNSTI1 120
+ASGNI1
+ADDRLP4 0+2
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTU4 6
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0+8
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRLP4 24+12
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 $591
+JUMPV
+LABELV $590
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 98
+EQI4 $602
+ADDRLP4 24
+INDIRI4
+CNSTI4 66
+EQI4 $602
+ADDRLP4 24
+INDIRI4
+CNSTI4 102
+EQI4 $602
+ADDRLP4 24
+INDIRI4
+CNSTI4 70
+EQI4 $602
+ADDRLP4 24
+INDIRI4
+CNSTI4 78
+NEI4 $597
+LABELV $602
+ADDRGP4 $598
+JUMPV
+LABELV $597
+ADDRLP4 28
+ADDRLP4 16
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 48
+LTI4 $603
+ADDRLP4 28
+INDIRI4
+CNSTI4 57
+GTI4 $603
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 56
+NEI4 $605
+ADDRLP4 16
+CNSTI1 51
+ASGNI1
+LABELV $605
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRGP4 g_color_table+4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $603
+LABELV $598
+LABELV $591
+LABELV $589
+endproc CG_OspColorFromString 300 12
+export CG_LoadClientInfo
+proc CG_LoadClientInfo 148 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $610
+ADDRGP4 $612
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $613
+ADDRGP4 $616
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $613
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $617
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $620
+ADDRLP4 20
+ARGP4
+ADDRGP4 $505
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $621
+JUMPV
+LABELV $620
+ADDRLP4 20
+ARGP4
+ADDRGP4 $506
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $621
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 $624
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $618
+ADDRGP4 $625
+ARGP4
+ADDRGP4 $624
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $618
+JUMPV
+LABELV $617
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 $624
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 $214
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $626
+ADDRGP4 $628
+ARGP4
+ADDRGP4 $624
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $626
+LABELV $618
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $610
+ADDRFP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $629
+ADDRLP4 92
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 $633
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_LerpTag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $631
+ADDRFP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $631
+LABELV $629
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $636
+ADDRLP4 92
+ADDRGP4 $624
+ASGNP4
+ADDRGP4 $637
+JUMPV
+LABELV $636
+ADDRLP4 92
+ADDRGP4 $624
+ASGNP4
+LABELV $637
+ADDRLP4 16
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $638
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $642
+ADDRGP4 $640
+JUMPV
+LABELV $642
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2016
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $644
+ADDRGP4 $646
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 104
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2016
+ADDP4
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+LABELV $644
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2016
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $647
+ADDRGP4 $646
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 104
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2016
+ADDP4
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+LABELV $647
+LABELV $639
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $638
+LABELV $640
+ADDRFP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $649
+ADDRFP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $649
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $651
+ADDRLP4 104
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRGP4 cg_entities+176
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $655
+ADDRLP4 104
+INDIRI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $655
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_ResetPlayerEntity
+CALLV
+pop
+LABELV $655
+LABELV $652
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $651
+LABELV $649
+LABELV $609
+endproc CG_LoadClientInfo 148 28
+export CG_CopyClientInfoModel
+proc CG_CopyClientInfoModel 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $660
+ADDRLP4 8
+CNSTI4 880
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+CNSTI4 892
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 896
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 900
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 904
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 920
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 924
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 972
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 868
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 3472
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 980
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+CNSTU4 1036
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 52
+CNSTI4 2016
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $662
+ADDRLP4 8
+CNSTI4 940
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 944
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $662
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $664
+ADDRLP4 8
+CNSTI4 2168
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12
+CNSTI4 2176
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 16
+CNSTI4 2184
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $664
+LABELV $659
+endproc CG_CopyClientInfoModel 56 12
+proc CG_RemoveClientFromScores 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 tmpScores
+ARGP4
+ADDRGP4 cg+610876
+ARGP4
+CNSTU4 5888
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+ADDRGP4 cg+610844
+INDIRI4
+ASGNI4
+ADDRGP4 cg+610844
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $674
+JUMPV
+LABELV $671
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 tmpScores
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $675
+ADDRGP4 $672
+JUMPV
+LABELV $675
+ADDRLP4 8
+CNSTI4 92
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 tmpScores
+ADDP4
+ARGP4
+CNSTU4 92
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12
+ADDRGP4 cg+610844
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $672
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $674
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $671
+LABELV $667
+endproc CG_RemoveClientFromScores 16 12
+proc CG_AddNewPlayerToScores 8 12
+ADDRLP4 0
+CNSTI4 92
+ADDRGP4 cg+610844
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+610844
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 92
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $680
+endproc CG_AddNewPlayerToScores 8 12
+proc CG_UpdatePlayerScores 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $685
+ADDRGP4 $684
+JUMPV
+LABELV $685
+ADDRLP4 4
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 196
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $689
+ADDRGP4 $684
+JUMPV
+LABELV $689
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $694
+JUMPV
+LABELV $691
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $696
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+64
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $684
+JUMPV
+LABELV $696
+LABELV $692
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $694
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $691
+LABELV $684
+endproc CG_UpdatePlayerScores 12 0
+proc CG_SafeColorName 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI1 55
+ASGNI1
+ADDRLP4 12
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $708
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+NEU4 $706
+LABELV $708
+ADDRGP4 $705
+JUMPV
+LABELV $706
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $709
+ADDRGP4 $705
+JUMPV
+LABELV $709
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 55
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $712
+JUMPV
+LABELV $711
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $714
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $713
+JUMPV
+LABELV $714
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $716
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $718
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $713
+JUMPV
+LABELV $718
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRGP4 $717
+JUMPV
+LABELV $716
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $720
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 32
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $720
+LABELV $717
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $712
+ADDRGP4 $711
+JUMPV
+LABELV $713
+LABELV $705
+endproc CG_SafeColorName 24 0
+proc CG_WhiteName 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $725
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+NEU4 $723
+LABELV $725
+ADDRGP4 $722
+JUMPV
+LABELV $723
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $726
+ADDRGP4 $722
+JUMPV
+LABELV $726
+ADDRFP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 16
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $729
+JUMPV
+LABELV $728
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $733
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $731
+LABELV $733
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $730
+JUMPV
+LABELV $731
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $734
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $736
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $730
+JUMPV
+LABELV $736
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $738
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 120
+EQI4 $743
+ADDRLP4 28
+INDIRI4
+CNSTI4 88
+NEI4 $741
+LABELV $743
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+LABELV $741
+LABELV $738
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $729
+JUMPV
+LABELV $734
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $729
+ADDRGP4 $728
+JUMPV
+LABELV $730
+LABELV $722
+endproc CG_WhiteName 32 4
+export CG_NewClientInfo
+proc CG_NewClientInfo 5000 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4760
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4532
+ADDRLP4 4760
+INDIRI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 4548
+ADDRLP4 4760
+INDIRI4
+ADDRGP4 cgs+341048
+ADDP4
+ASGNP4
+ADDRLP4 4624
+CNSTI4 3
+ASGNI4
+ADDRLP4 4532
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $747
+ADDRLP4 4624
+ADDRLP4 4532
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $747
+ADDRFP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 4764
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4528
+ADDRLP4 4764
+INDIRP4
+ASGNP4
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $749
+ARGP4
+ADDRLP4 4768
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4768
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4772
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4544
+ADDRLP4 4772
+INDIRI4
+ASGNI4
+ADDRLP4 4544
+INDIRI4
+CNSTI4 1
+EQI4 $752
+ADDRLP4 4544
+INDIRI4
+CNSTI4 2
+NEI4 $750
+LABELV $752
+ADDRLP4 4544
+INDIRI4
+ADDRLP4 4624
+INDIRI4
+EQI4 $753
+CNSTI4 2392
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+2384
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $753
+LABELV $750
+ADDRLP4 4532
+INDIRP4
+CNSTI4 2160
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $756
+ADDRGP4 $744
+JUMPV
+LABELV $756
+ADDRFP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 4780
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4528
+ADDRLP4 4780
+INDIRP4
+ASGNP4
+ADDRLP4 4528
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $758
+ADDRGP4 wnumOldClients
+INDIRI4
+CNSTI4 64
+LTI4 $760
+ADDRGP4 $762
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $761
+JUMPV
+LABELV $760
+ADDRLP4 4784
+CNSTI4 5128
+ADDRGP4 wnumOldClients
+INDIRI4
+MULI4
+ADDRGP4 woldclients
+ADDP4
+ASGNP4
+ADDRLP4 4788
+CNSTI4 2392
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+ASGNP4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4532
+INDIRP4
+ARGP4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4540
+ADDP4
+ADDRLP4 4788
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4544
+ADDP4
+CNSTI4 2392
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+692
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4548
+ADDP4
+CNSTI4 2392
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+696
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4552
+ADDP4
+ADDRLP4 4788
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4556
+ADDP4
+CNSTI4 2392
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+704
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4560
+ADDP4
+ADDRLP4 4788
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4792
+CNSTI4 4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+ADDRLP4 4792
+INDIRI4
+ADDP4
+ADDRLP4 4788
+INDIRP4
+ADDRLP4 4792
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4796
+CNSTI4 8
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+ADDRLP4 4796
+INDIRI4
+ADDP4
+ADDRLP4 4788
+INDIRP4
+ADDRLP4 4796
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4572
+ADDP4
+ADDRLP4 4788
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4576
+ADDP4
+ADDRLP4 4788
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4580
+ADDP4
+ADDRLP4 4788
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4584
+ADDP4
+ADDRLP4 4788
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4564
+ADDP4
+ADDRLP4 4788
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4568
+ADDP4
+ADDRLP4 4788
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957572
+ADDRLP4 4784
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 4784
+INDIRP4
+CNSTI4 4588
+ADDP4
+ARGP4
+CNSTI4 2392
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+736
+ADDP4
+ARGP4
+CNSTU4 36
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4800
+ADDRGP4 wnumOldClients
+ASGNP4
+ADDRLP4 4800
+INDIRP4
+ADDRLP4 4800
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $761
+ADDRGP4 cgs+1957508
+ARGP4
+ADDRLP4 4532
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 2392
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2392
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4532
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4548
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RemoveClientFromScores
+CALLV
+pop
+ADDRGP4 cgs+1957504
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957580
+CNSTI4 1
+ASGNI4
+ADDRGP4 $744
+JUMPV
+LABELV $758
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $772
+ARGP4
+ADDRLP4 4784
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4784
+INDIRP4
+ASGNP4
+ADDRLP4 0+4
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRGP4 CG_SafeColorName
+CALLV
+pop
+ADDRLP4 0+132
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRGP4 CG_WhiteName
+CALLV
+pop
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $775
+ARGP4
+ADDRLP4 4788
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4788
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $776
+ADDRLP4 0+2252
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRGP4 CG_SafeColorName
+CALLV
+pop
+ADDRLP4 0+2380
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRGP4 CG_WhiteName
+CALLV
+pop
+ADDRGP4 $777
+JUMPV
+LABELV $776
+ADDRLP4 0+2252
+CNSTI1 0
+ASGNI1
+ADDRLP4 0+2380
+CNSTI1 0
+ASGNI1
+LABELV $777
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $782
+ARGP4
+ADDRLP4 4792
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4792
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $783
+ADDRLP4 0+2444
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRGP4 CG_SafeColorName
+CALLV
+pop
+ADDRGP4 $784
+JUMPV
+LABELV $783
+ADDRLP4 0+2444
+CNSTI1 0
+ASGNI1
+LABELV $784
+ADDRLP4 4796
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4796
+INDIRI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $797
+ADDRLP4 0+4
+ARGP4
+ADDRLP4 4796
+INDIRI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 4800
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4800
+INDIRI4
+CNSTI4 0
+NEI4 $797
+ADDRLP4 0+2252
+ARGP4
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2252
+ADDP4
+ARGP4
+ADDRLP4 4804
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4804
+INDIRI4
+CNSTI4 0
+EQI4 $787
+LABELV $797
+ADDRGP4 cg_drawPlayerNamesFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $798
+ADDRLP4 4808
+ADDRGP4 cgs+632912+797040
+ASGNP4
+ADDRGP4 $799
+JUMPV
+LABELV $798
+ADDRLP4 4808
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $799
+ADDRLP4 0+2252
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $805
+ADDRGP4 $808
+ARGP4
+ADDRLP4 0+2252
+ARGP4
+ADDRLP4 0+4
+ARGP4
+ADDRLP4 4812
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4692
+ADDRLP4 4812
+INDIRP4
+ASGNP4
+ADDRGP4 $806
+JUMPV
+LABELV $805
+ADDRLP4 4692
+ADDRLP4 0+4
+ASGNP4
+LABELV $806
+ADDRLP4 4812
+CNSTF4 0
+ASGNF4
+ADDRLP4 4812
+INDIRF4
+ARGF4
+ADDRLP4 4812
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4692
+INDIRP4
+ARGP4
+ADDRLP4 4812
+INDIRF4
+ARGF4
+ADDRLP4 4816
+CNSTI4 0
+ASGNI4
+ADDRLP4 4816
+INDIRI4
+ARGI4
+ADDRLP4 4816
+INDIRI4
+ARGI4
+ADDRLP4 4808
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+630584
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_CreateNameSprite
+CALLV
+pop
+LABELV $787
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $813
+ADDRLP4 0+204
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+204+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+204+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+216
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+216+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+216+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+2168
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+2168+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+2168+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+2168+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+2176
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+2176+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+2176+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+2176+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+2184
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+2184+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+2184+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+2184+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $847
+ARGP4
+ADDRLP4 4820
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4820
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $814
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 0+204
+ARGP4
+ADDRGP4 CG_CpmaColorFromString
+CALLV
+pop
+ADDRLP4 4524
+ADDRLP4 4524
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $814
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4808
+ARGP4
+ADDRGP4 CG_CpmaColorFromString
+CALLV
+pop
+ADDRLP4 4828
+CNSTF4 1132396544
+ADDRLP4 4808
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4832
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 4828
+INDIRF4
+ADDRLP4 4832
+INDIRF4
+LTF4 $855
+ADDRLP4 4824
+ADDRLP4 4828
+INDIRF4
+ADDRLP4 4832
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $856
+JUMPV
+LABELV $855
+ADDRLP4 4824
+ADDRLP4 4828
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $856
+ADDRLP4 0+2168
+ADDRLP4 4824
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4840
+CNSTF4 1132396544
+ADDRLP4 4808+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4844
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 4840
+INDIRF4
+ADDRLP4 4844
+INDIRF4
+LTF4 $861
+ADDRLP4 4836
+ADDRLP4 4840
+INDIRF4
+ADDRLP4 4844
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $862
+JUMPV
+LABELV $861
+ADDRLP4 4836
+ADDRLP4 4840
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $862
+ADDRLP4 0+2168+1
+ADDRLP4 4836
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4852
+CNSTF4 1132396544
+ADDRLP4 4808+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4856
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 4852
+INDIRF4
+ADDRLP4 4856
+INDIRF4
+LTF4 $867
+ADDRLP4 4848
+ADDRLP4 4852
+INDIRF4
+ADDRLP4 4856
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $868
+JUMPV
+LABELV $867
+ADDRLP4 4848
+ADDRLP4 4852
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $868
+ADDRLP4 0+2168+2
+ADDRLP4 4848
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+2168+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 4524
+ADDRLP4 4524
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $814
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4808
+ARGP4
+ADDRGP4 CG_CpmaColorFromString
+CALLV
+pop
+ADDRLP4 4864
+CNSTF4 1132396544
+ADDRLP4 4808
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4868
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 4864
+INDIRF4
+ADDRLP4 4868
+INDIRF4
+LTF4 $875
+ADDRLP4 4860
+ADDRLP4 4864
+INDIRF4
+ADDRLP4 4868
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $876
+JUMPV
+LABELV $875
+ADDRLP4 4860
+ADDRLP4 4864
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $876
+ADDRLP4 0+2176
+ADDRLP4 4860
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4876
+CNSTF4 1132396544
+ADDRLP4 4808+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4880
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 4876
+INDIRF4
+ADDRLP4 4880
+INDIRF4
+LTF4 $881
+ADDRLP4 4872
+ADDRLP4 4876
+INDIRF4
+ADDRLP4 4880
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $882
+JUMPV
+LABELV $881
+ADDRLP4 4872
+ADDRLP4 4876
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $882
+ADDRLP4 0+2176+1
+ADDRLP4 4872
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4888
+CNSTF4 1132396544
+ADDRLP4 4808+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4892
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 4888
+INDIRF4
+ADDRLP4 4892
+INDIRF4
+LTF4 $887
+ADDRLP4 4884
+ADDRLP4 4888
+INDIRF4
+ADDRLP4 4892
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $888
+JUMPV
+LABELV $887
+ADDRLP4 4884
+ADDRLP4 4888
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $888
+ADDRLP4 0+2176+2
+ADDRLP4 4884
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+2176+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 4524
+ADDRLP4 4524
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $814
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4808
+ARGP4
+ADDRGP4 CG_CpmaColorFromString
+CALLV
+pop
+ADDRLP4 4900
+CNSTF4 1132396544
+ADDRLP4 4808
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4904
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 4900
+INDIRF4
+ADDRLP4 4904
+INDIRF4
+LTF4 $895
+ADDRLP4 4896
+ADDRLP4 4900
+INDIRF4
+ADDRLP4 4904
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $896
+JUMPV
+LABELV $895
+ADDRLP4 4896
+ADDRLP4 4900
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $896
+ADDRLP4 0+2184
+ADDRLP4 4896
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4912
+CNSTF4 1132396544
+ADDRLP4 4808+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4916
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 4912
+INDIRF4
+ADDRLP4 4916
+INDIRF4
+LTF4 $901
+ADDRLP4 4908
+ADDRLP4 4912
+INDIRF4
+ADDRLP4 4916
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $902
+JUMPV
+LABELV $901
+ADDRLP4 4908
+ADDRLP4 4912
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $902
+ADDRLP4 0+2184+1
+ADDRLP4 4908
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4924
+CNSTF4 1132396544
+ADDRLP4 4808+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4928
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 4924
+INDIRF4
+ADDRLP4 4928
+INDIRF4
+LTF4 $907
+ADDRLP4 4920
+ADDRLP4 4924
+INDIRF4
+ADDRLP4 4928
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $908
+JUMPV
+LABELV $907
+ADDRLP4 4920
+ADDRLP4 4924
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $908
+ADDRLP4 0+2184+2
+ADDRLP4 4920
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+2184+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 4524
+ADDRLP4 4524
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $814
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 0+216
+ARGP4
+ADDRGP4 CG_CpmaColorFromString
+CALLV
+pop
+ADDRGP4 $814
+JUMPV
+LABELV $813
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $847
+ARGP4
+ADDRLP4 4808
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4808
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 0+204
+ARGP4
+ADDRGP4 CG_Q3ColorFromString
+CALLV
+pop
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $915
+ARGP4
+ADDRLP4 4812
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4812
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 0+216
+ARGP4
+ADDRGP4 CG_Q3ColorFromString
+CALLV
+pop
+LABELV $814
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $917
+ARGP4
+ADDRLP4 4808
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4808
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4812
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+200
+ADDRLP4 4812
+INDIRI4
+ASGNI4
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $919
+ARGP4
+ADDRLP4 4816
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4816
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4820
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+248
+ADDRLP4 4820
+INDIRI4
+ASGNI4
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $921
+ARGP4
+ADDRLP4 4824
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4824
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4828
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+252
+ADDRLP4 4828
+INDIRI4
+ASGNI4
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $923
+ARGP4
+ADDRLP4 4832
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4832
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4836
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+256
+ADDRLP4 4836
+INDIRI4
+ASGNI4
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $749
+ARGP4
+ADDRLP4 4840
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4840
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4844
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+196
+ADDRLP4 4844
+INDIRI4
+ASGNI4
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $926
+ARGP4
+ADDRLP4 4848
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4848
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4852
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+260
+ADDRLP4 4852
+INDIRI4
+ASGNI4
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $928
+ARGP4
+ADDRLP4 4856
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4856
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4860
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+264
+ADDRLP4 4860
+INDIRI4
+ASGNI4
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $930
+ARGP4
+ADDRLP4 4864
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4864
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4868
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+2152
+ADDRLP4 4868
+INDIRI4
+ASGNI4
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $932
+ARGP4
+ADDRLP4 4872
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4872
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4876
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+2156
+ADDRLP4 4876
+INDIRI4
+ASGNI4
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $934
+ARGP4
+ADDRLP4 4880
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4880
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4884
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+3468
+ADDRLP4 4884
+INDIRI4
+ASGNI4
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $936
+ARGP4
+ADDRLP4 4888
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4888
+INDIRP4
+ASGNP4
+ADDRLP4 0+800
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $938
+ARGP4
+ADDRLP4 4892
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4892
+INDIRP4
+ASGNP4
+ADDRLP4 0+832
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $940
+ARGP4
+ADDRLP4 4896
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4896
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $941
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $941
+ADDRLP4 0+3476
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $942
+JUMPV
+LABELV $941
+ADDRLP4 0+3476
+CNSTI1 0
+ASGNI1
+LABELV $942
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $946
+ARGP4
+ADDRLP4 4900
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4900
+INDIRP4
+ASGNP4
+ADDRLP4 4524
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $947
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $947
+ADDRGP4 $952
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4904
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4904
+INDIRI4
+CNSTI4 0
+NEI4 $950
+ADDRGP4 $954
+ARGP4
+ADDRLP4 4908
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0+2248
+ADDRLP4 4908
+INDIRI4
+ASGNI4
+ADDRGP4 $948
+JUMPV
+LABELV $950
+ADDRLP4 4524
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $955
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $946
+ARGP4
+ADDRLP4 4908
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $958
+ARGP4
+ADDRLP4 4908
+INDIRP4
+ARGP4
+ADDRLP4 4912
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4912
+INDIRP4
+ARGP4
+ADDRLP4 4916
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0+2248
+ADDRLP4 4916
+INDIRI4
+ASGNI4
+ADDRGP4 $948
+JUMPV
+LABELV $955
+ADDRLP4 0+2248
+CNSTI4 0
+ASGNI4
+ADDRGP4 $948
+JUMPV
+LABELV $947
+ADDRLP4 0+2248
+CNSTI4 0
+ASGNI4
+LABELV $948
+ADDRGP4 cg_ignoreClientHeadModel+12
+INDIRI4
+CNSTI4 2
+NEI4 $961
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $961
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $965
+ARGP4
+ADDRLP4 4904
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4904
+INDIRP4
+ASGNP4
+ADDRGP4 $962
+JUMPV
+LABELV $961
+ADDRGP4 cg_ignoreClientHeadModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $966
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $965
+ARGP4
+ADDRLP4 4904
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4904
+INDIRP4
+ASGNP4
+ADDRGP4 $967
+JUMPV
+LABELV $966
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $969
+ARGP4
+ADDRLP4 4904
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4904
+INDIRP4
+ASGNP4
+LABELV $967
+LABELV $962
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $965
+ARGP4
+ADDRLP4 4904
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4552
+ADDRLP4 4904
+INDIRP4
+ASGNP4
+ADDRLP4 0+288
+ARGP4
+ADDRLP4 4552
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+352
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4908
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4908
+INDIRI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $982
+ADDRLP4 4552
+INDIRP4
+ARGP4
+ADDRLP4 4908
+INDIRI4
+ADDRGP4 cgs+51512+288
+ADDP4
+ARGP4
+ADDRLP4 4912
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4912
+INDIRI4
+CNSTI4 0
+NEI4 $982
+ADDRLP4 4524
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+352
+ADDP4
+ARGP4
+ADDRLP4 4916
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4916
+INDIRI4
+CNSTI4 0
+EQI4 $974
+LABELV $982
+ADDRGP4 cg_ignoreClientHeadModel+12
+INDIRI4
+CNSTI4 2
+NEI4 $983
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $983
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $965
+ARGP4
+ADDRLP4 4920
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4920
+INDIRP4
+ASGNP4
+ADDRGP4 $984
+JUMPV
+LABELV $983
+ADDRGP4 cg_ignoreClientHeadModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $987
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $965
+ARGP4
+ADDRLP4 4920
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4920
+INDIRP4
+ASGNP4
+ADDRGP4 $988
+JUMPV
+LABELV $987
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $969
+ARGP4
+ADDRLP4 4920
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4920
+INDIRP4
+ASGNP4
+LABELV $988
+LABELV $984
+ADDRLP4 4524
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $990
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $965
+ARGP4
+ADDRLP4 4920
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4920
+INDIRP4
+ASGNP4
+LABELV $990
+ADDRLP4 4524
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $992
+ADDRLP4 4696
+ARGP4
+ADDRGP4 $994
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4524
+ADDRLP4 4696
+ASGNP4
+LABELV $992
+ADDRLP4 4524
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4920
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4540
+ADDRLP4 4920
+INDIRP4
+ASGNP4
+ADDRLP4 4540
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $995
+ADDRLP4 4924
+ADDRLP4 4540
+INDIRP4
+ASGNP4
+ADDRLP4 4540
+ADDRLP4 4924
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4924
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $996
+JUMPV
+LABELV $995
+ADDRLP4 4540
+ADDRGP4 $214
+ASGNP4
+LABELV $996
+ADDRLP4 4540
+INDIRP4
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 4924
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4924
+INDIRI4
+CNSTI4 0
+NEI4 $997
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 4928
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 4928
+INDIRI4
+CNSTI4 0
+EQI4 $999
+ADDRLP4 0+196
+INDIRI4
+CNSTI4 1
+NEI4 $1002
+ADDRLP4 4628
+ARGP4
+ADDRGP4 $303
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $998
+JUMPV
+LABELV $1002
+ADDRLP4 0+196
+INDIRI4
+CNSTI4 2
+NEI4 $1005
+ADDRLP4 4628
+ARGP4
+ADDRGP4 $302
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $998
+JUMPV
+LABELV $1005
+ADDRLP4 4628
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $998
+JUMPV
+LABELV $999
+ADDRLP4 4628
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $998
+JUMPV
+LABELV $997
+ADDRLP4 4628
+ARGP4
+ADDRLP4 4540
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $998
+ADDRGP4 $1009
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4628
+ARGP4
+ADDRLP4 4928
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4928
+INDIRP4
+ARGP4
+ADDRLP4 4932
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0+976
+ADDRLP4 4932
+INDIRI4
+ASGNI4
+ADDRLP4 0+976
+INDIRI4
+CNSTI4 0
+NEI4 $1010
+ADDRGP4 $1014
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4628
+ARGP4
+ADDRLP4 4936
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4936
+INDIRP4
+ARGP4
+ADDRLP4 4940
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0+976
+ADDRLP4 4940
+INDIRI4
+ASGNI4
+LABELV $1010
+ADDRLP4 0+976
+INDIRI4
+CNSTI4 0
+NEI4 $1015
+ADDRGP4 $1009
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRLP4 4936
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4936
+INDIRP4
+ARGP4
+ADDRLP4 4940
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0+976
+ADDRLP4 4940
+INDIRI4
+ASGNI4
+LABELV $1018
+LABELV $1015
+ADDRLP4 0+976
+INDIRI4
+CNSTI4 0
+NEI4 $1021
+ADDRGP4 $1009
+ARGP4
+ADDRGP4 $624
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRLP4 4936
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4936
+INDIRP4
+ARGP4
+ADDRLP4 4940
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0+976
+ADDRLP4 4940
+INDIRI4
+ASGNI4
+LABELV $1021
+ADDRLP4 4556
+CNSTI4 0
+ASGNI4
+ADDRLP4 4560
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRLP4 4540
+INDIRP4
+ARGP4
+ADDRGP4 $411
+ARGP4
+ADDRGP4 $399
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4936
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 4936
+INDIRI4
+CNSTI4 0
+EQI4 $1025
+ADDRLP4 4560
+ARGP4
+ADDRLP4 4940
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRLP4 4556
+ADDRLP4 4940
+INDIRI4
+ASGNI4
+LABELV $1025
+ADDRLP4 4556
+INDIRI4
+CNSTI4 0
+NEI4 $1027
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1029
+ADDRGP4 $405
+ARGP4
+ADDRLP4 4540
+INDIRP4
+ARGP4
+ADDRLP4 4940
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4940
+INDIRI4
+CNSTI4 0
+NEI4 $1029
+ADDRLP4 4560
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRGP4 $406
+ARGP4
+ADDRGP4 $411
+ARGP4
+ADDRGP4 $399
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+pop
+ADDRLP4 4560
+ARGP4
+ADDRLP4 4944
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRLP4 4556
+ADDRLP4 4944
+INDIRI4
+ASGNI4
+LABELV $1029
+ADDRLP4 4556
+INDIRI4
+CNSTI4 0
+NEI4 $1032
+ADDRLP4 4560
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 $411
+ARGP4
+ADDRGP4 $399
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+pop
+ADDRLP4 4560
+ARGP4
+ADDRLP4 4944
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRLP4 4556
+ADDRLP4 4944
+INDIRI4
+ASGNI4
+LABELV $1032
+LABELV $1027
+ADDRLP4 0+948
+ADDRLP4 4556
+INDIRI4
+ASGNI4
+ADDRGP4 $975
+JUMPV
+LABELV $974
+ADDRLP4 0+976
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+976
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+948
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+948
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $975
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $965
+ARGP4
+ADDRLP4 4920
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4920
+INDIRP4
+ASGNP4
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $1041
+ADDRGP4 $1044
+JUMPV
+ADDRLP4 0+416
+ARGP4
+ADDRGP4 $624
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+480
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1045
+JUMPV
+LABELV $1044
+ADDRGP4 $965
+ARGP4
+ADDRLP4 4924
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4924
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4988
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4540
+ADDRLP4 4988
+INDIRP4
+ASGNP4
+ADDRLP4 4988
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1050
+ADDRLP4 4540
+ADDRGP4 $214
+ASGNP4
+ADDRGP4 $1051
+JUMPV
+LABELV $1050
+ADDRLP4 4992
+ADDRLP4 4540
+INDIRP4
+ASGNP4
+ADDRLP4 4540
+ADDRLP4 4992
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4992
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $1051
+ADDRLP4 0+480
+ARGP4
+ADDRLP4 4540
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+416
+ARGP4
+ADDRLP4 4924
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1045
+ADDRGP4 $1042
+JUMPV
+ADDRLP4 4524
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4988
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4536
+ADDRLP4 4988
+INDIRP4
+ASGNP4
+ADDRLP4 4536
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1042
+ADDRLP4 0+480
+ARGP4
+ADDRLP4 4536
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1042
+JUMPV
+LABELV $1041
+ADDRLP4 0+416
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+416
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4924
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4536
+ADDRLP4 4924
+INDIRP4
+ASGNP4
+ADDRLP4 4536
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1065
+ADDRLP4 0+480
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1066
+JUMPV
+LABELV $1065
+ADDRLP4 0+480
+ARGP4
+ADDRLP4 4536
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4536
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $1066
+LABELV $1042
+ADDRGP4 cg_ignoreClientHeadModel+12
+INDIRI4
+CNSTI4 2
+NEI4 $1071
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1071
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $965
+ARGP4
+ADDRLP4 4924
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4924
+INDIRP4
+ASGNP4
+ADDRGP4 $1072
+JUMPV
+LABELV $1071
+ADDRGP4 cg_ignoreClientHeadModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $1075
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $965
+ARGP4
+ADDRLP4 4924
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4924
+INDIRP4
+ASGNP4
+ADDRGP4 $1076
+JUMPV
+LABELV $1075
+ADDRLP4 4528
+INDIRP4
+ARGP4
+ADDRGP4 $969
+ARGP4
+ADDRLP4 4924
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4524
+ADDRLP4 4924
+INDIRP4
+ASGNP4
+LABELV $1076
+LABELV $1072
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $1078
+ADDRGP4 $1081
+JUMPV
+ADDRLP4 0+544
+ARGP4
+ADDRGP4 $624
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+608
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1082
+JUMPV
+LABELV $1081
+ADDRGP4 $1087
+ARGP4
+ADDRLP4 4924
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4924
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4992
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4988
+ADDRLP4 4992
+INDIRP4
+ASGNP4
+ADDRLP4 4992
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1088
+ADDRLP4 4988
+ADDRGP4 $214
+ASGNP4
+ADDRGP4 $1089
+JUMPV
+LABELV $1088
+ADDRLP4 4996
+ADDRLP4 4988
+INDIRP4
+ASGNP4
+ADDRLP4 4988
+ADDRLP4 4996
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4996
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $1089
+ADDRLP4 0+608
+ARGP4
+ADDRLP4 4988
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+544
+ARGP4
+ADDRLP4 4924
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1082
+ADDRGP4 $1079
+JUMPV
+ADDRLP4 4524
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4992
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4536
+ADDRLP4 4992
+INDIRP4
+ASGNP4
+ADDRLP4 4536
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1079
+ADDRLP4 0+608
+ARGP4
+ADDRLP4 4536
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1079
+JUMPV
+LABELV $1078
+ADDRLP4 0+544
+ARGP4
+ADDRLP4 4524
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+544
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4924
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4536
+ADDRLP4 4924
+INDIRP4
+ASGNP4
+ADDRLP4 4536
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1103
+ADDRLP4 0+608
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1104
+JUMPV
+LABELV $1103
+ADDRLP4 0+608
+ARGP4
+ADDRLP4 4536
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4536
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $1104
+LABELV $1079
+ADDRLP4 0+952
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+928
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+908
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+956
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+932
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+912
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 2
+NEI4 $1117
+ADDRLP4 4924
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1118
+JUMPV
+LABELV $1117
+ADDRLP4 4924
+CNSTI4 0
+ASGNI4
+LABELV $1118
+ADDRLP4 4924
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+ADDRLP4 4532
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1119
+ADDRGP4 cgs+1957504
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957580
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+1957508
+ARGP4
+ADDRLP4 0+4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cgs+1957572
+ADDRLP4 4532
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddNewPlayerToScores
+CALLV
+pop
+ADDRGP4 $1120
+JUMPV
+LABELV $1119
+ADDRLP4 0+2144
+ADDRLP4 4532
+INDIRP4
+CNSTI4 2144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+2148
+ADDRLP4 4532
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+228
+ADDRLP4 4532
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4500
+ADDRLP4 4532
+INDIRP4
+CNSTI4 4500
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4504
+ADDRLP4 4532
+INDIRP4
+CNSTI4 4504
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+232
+ADDRLP4 4532
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+236
+ADDRLP4 4532
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+240
+ADDRLP4 4532
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+244
+ADDRLP4 4532
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+268
+ADDRLP4 4532
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+272
+ADDRLP4 4532
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+276
+ADDRLP4 4532
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+280
+ADDRLP4 4532
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+284
+ADDRLP4 4532
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_UpdatePlayerScores
+CALLV
+pop
+LABELV $1120
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 4532
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 4524
+ADDRLP4 4548
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 4524
+LABELV $744
+endproc CG_NewClientInfo 5000 40
+export CG_LoadDeferredPlayers
+proc CG_LoadDeferredPlayers 20 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+51512
+ASGNP4
+ADDRGP4 $1145
+JUMPV
+LABELV $1142
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1148
+ADDRLP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1148
+ADDRLP4 16
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 4000000
+GEI4 $1150
+ADDRGP4 $1152
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1150
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $1148
+LABELV $1143
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4524
+ADDP4
+ASGNP4
+LABELV $1145
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+39728
+INDIRI4
+LTI4 $1142
+LABELV $1141
+endproc CG_LoadDeferredPlayers 20 12
+proc CG_SetLerpFrameAnimation 12 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $1156
+ADDRFP4 8
+INDIRI4
+CNSTI4 37
+LTI4 $1154
+LABELV $1156
+ADDRGP4 $1157
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1154
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 980
+ADDP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cg_debugAnim+12
+INDIRI4
+CNSTI4 0
+EQI4 $1158
+ADDRGP4 $1161
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1158
+LABELV $1153
+endproc CG_SetLerpFrameAnimation 12 8
+proc CG_SetAnimFrame 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1163
+ADDRGP4 $1162
+JUMPV
+LABELV $1163
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+GEI4 $1165
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1165
+ADDRLP4 16
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1166
+ADDRLP4 16
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1167
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $1167
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $1169
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1171
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $1172
+JUMPV
+LABELV $1171
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $1172
+LABELV $1169
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1173
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $1174
+JUMPV
+LABELV $1173
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1175
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $1175
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MODI4
+SUBI4
+ASGNI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1175
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1176
+LABELV $1174
+LABELV $1162
+endproc CG_SetAnimFrame 36 0
+export CG_RunLerpFrame
+proc CG_RunLerpFrame 20 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cg_animSpeed+12
+INDIRI4
+CNSTI4 0
+NEI4 $1178
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $1177
+JUMPV
+LABELV $1178
+ADDRFP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $1183
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1181
+LABELV $1183
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetLerpFrameAnimation
+CALLV
+pop
+LABELV $1181
+ADDRFP4 16
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LTI4 $1184
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1186
+ADDRGP4 $1177
+JUMPV
+LABELV $1186
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 CG_SetAnimFrame
+CALLV
+pop
+ADDRFP4 16
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LEI4 $1185
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cg_debugAnim+12
+INDIRI4
+CNSTI4 0
+EQI4 $1185
+ADDRGP4 $1193
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1184
+LABELV $1185
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $1194
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+LABELV $1194
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+LEI4 $1196
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+LABELV $1196
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $1198
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1199
+JUMPV
+LABELV $1198
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ADDRFP4 16
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+LABELV $1199
+LABELV $1177
+endproc CG_RunLerpFrame 20 12
+export CG_ClearLerpFrame
+proc CG_ClearLerpFrame 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetLerpFrameAnimation
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $1200
+endproc CG_ClearLerpFrame 16 12
+export CG_PlayerAnimation
+proc CG_PlayerAnimation 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_noPlayerAnims+12
+INDIRI4
+CNSTI4 0
+EQI4 $1202
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $1201
+JUMPV
+LABELV $1202
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_HASTE
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1205
+ADDRLP4 8
+CNSTF4 1069547520
+ASGNF4
+ADDRGP4 $1206
+JUMPV
+LABELV $1205
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+LABELV $1206
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_FreezeTagFrozen
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1207
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+LABELV $1207
+ADDRLP4 12
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+607704
+CVPU4 4
+NEU4 $1210
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1211
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1211
+JUMPV
+LABELV $1210
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1496
+DIVI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1217
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1217
+LABELV $1211
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1220
+ADDRFP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1222
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 22
+NEI4 $1222
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRGP4 $1223
+JUMPV
+LABELV $1222
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+LABELV $1223
+LABELV $1220
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 908
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 916
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1224
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 948
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+LABELV $1224
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 956
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 964
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1201
+endproc CG_PlayerAnimation 28 20
+proc CG_SwingAngles 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1227
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GTF4 $1231
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEGF4
+GEF4 $1229
+LABELV $1231
+ADDRFP4 20
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $1229
+LABELV $1227
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1232
+ADDRGP4 $1226
+JUMPV
+LABELV $1232
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+GEF4 $1234
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $1235
+JUMPV
+LABELV $1234
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+GEF4 $1236
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1237
+JUMPV
+LABELV $1236
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+LABELV $1237
+LABELV $1235
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LTF4 $1238
+ADDRLP4 8
+ADDRGP4 cg+607144
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LTF4 $1241
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1241
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $1239
+JUMPV
+LABELV $1238
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $1243
+ADDRLP4 8
+ADDRGP4 cg+607144
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+NEGF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $1246
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1246
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $1243
+LABELV $1239
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $1248
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $1249
+JUMPV
+LABELV $1248
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $1250
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $1250
+LABELV $1249
+LABELV $1226
+endproc CG_SwingAngles 28 8
+proc CG_AddPainTwitch 12 0
+ADDRLP4 0
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+LTI4 $1254
+ADDRGP4 $1252
+JUMPV
+LABELV $1254
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1256
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1257
+JUMPV
+LABELV $1256
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $1257
+LABELV $1252
+endproc CG_AddPainTwitch 12 0
+data
+align 4
+LABELV $1259
+byte 4 0
+byte 4 22
+byte 4 45
+byte 4 -22
+byte 4 0
+byte 4 22
+byte 4 -45
+byte 4 -22
+export CG_PlayerAngles
+code
+proc CG_PlayerAngles 164 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 84
+CNSTI4 -129
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+CNSTI4 22
+NEI4 $1268
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 11
+EQI4 $1266
+ADDRLP4 88
+INDIRI4
+CNSTI4 12
+EQI4 $1266
+LABELV $1268
+ADDRFP4 0
+INDIRP4
+CNSTI4 972
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 980
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1266
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1269
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1270
+JUMPV
+LABELV $1269
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+LTI4 $1273
+ADDRLP4 56
+INDIRI4
+CNSTI4 7
+LEI4 $1271
+LABELV $1273
+ADDRGP4 $1274
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1271
+LABELV $1270
+ADDRLP4 12+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1259
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1259
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 968
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 972
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 12+4
+INDIRF4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 968
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1127481344
+LEF4 $1285
+ADDRLP4 60
+CNSTF4 1061158912
+ADDRLP4 24
+INDIRF4
+CNSTF4 3283353600
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $1286
+JUMPV
+LABELV $1285
+ADDRLP4 60
+CNSTF4 1061158912
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1286
+ADDRLP4 60
+INDIRF4
+ARGF4
+CNSTF4 1097859072
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 976
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 980
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 976
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $1287
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $1287
+ADDRLP4 64
+CNSTI4 4524
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 876
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1290
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $1290
+LABELV $1287
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_FreezeTagFrozen
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+EQI4 $1292
+LABELV $1292
+ADDRLP4 44
+ARGP4
+ADDRLP4 120
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+ADDRGP4 cg_playerLeanScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+GEF4 $1295
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+LABELV $1295
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+LEF4 $1297
+ADDRLP4 40
+CNSTF4 1028443341
+ADDRLP4 40
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 160
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 124+12
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 124+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 124+12+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 124+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 124+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 160
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1297
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $1311
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $1311
+ADDRLP4 64
+CNSTI4 4524
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 872
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1314
+ADDRLP4 12+4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 128
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 128
+INDIRF4
+ASGNF4
+LABELV $1314
+LABELV $1311
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPainTwitch
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $1258
+endproc CG_PlayerAngles 164 24
+proc CG_HasteTrail 40 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_hasteTrail+12
+INDIRI4
+CNSTI4 0
+NEI4 $1320
+ADDRGP4 $1319
+JUMPV
+LABELV $1320
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LEI4 $1323
+ADDRGP4 $1319
+JUMPV
+LABELV $1323
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 936
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 15
+EQI4 $1326
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+EQI4 $1326
+ADDRGP4 $1319
+JUMPV
+LABELV $1326
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+GEI4 $1328
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $1328
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 cg_smokeRadius_haste+8
+INDIRF4
+ARGF4
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTF4 1140457472
+ARGF4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+492308
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $1319
+endproc CG_HasteTrail 40 48
+proc CG_FlightTrail 32 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_flightTrail+12
+INDIRI4
+CNSTI4 0
+NEI4 $1338
+ADDRGP4 $1337
+JUMPV
+LABELV $1338
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LEI4 $1341
+ADDRGP4 $1337
+JUMPV
+LABELV $1341
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $1344
+LABELV $1344
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+GEI4 $1346
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $1346
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 cg_smokeRadius_flight+8
+INDIRF4
+ARGF4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1140457472
+ARGF4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+492308
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $1337
+endproc CG_FlightTrail 32 48
+proc CG_BreathPuffs 76 48
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_enableBreath+12
+INDIRI4
+CNSTI4 0
+NEI4 $1356
+ADDRGP4 $1355
+JUMPV
+LABELV $1356
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $1361
+ADDRLP4 12
+INDIRI4
+CNSTI4 64
+LTI4 $1359
+LABELV $1361
+ADDRGP4 $1355
+JUMPV
+LABELV $1359
+ADDRLP4 28
+CNSTI4 4524
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRGP4 cg_enableBreath+12
+INDIRI4
+CNSTI4 1
+NEI4 $1363
+ADDRGP4 cg_serverEnableBreath+12
+INDIRI4
+CNSTI4 0
+NEI4 $1363
+ADDRGP4 $1355
+JUMPV
+LABELV $1363
+ADDRGP4 cg_enableBreath+12
+INDIRI4
+CNSTI4 2
+NEI4 $1367
+ADDRGP4 cg+3874616
+INDIRI4
+CNSTI4 0
+NEI4 $1367
+ADDRGP4 $1355
+JUMPV
+LABELV $1367
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1371
+ADDRGP4 $1355
+JUMPV
+LABELV $1371
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_IsFirstPersonView
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $1373
+ADDRGP4 $1355
+JUMPV
+LABELV $1373
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1375
+ADDRGP4 $1355
+JUMPV
+LABELV $1375
+ADDRLP4 28
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LEI4 $1377
+ADDRGP4 $1355
+JUMPV
+LABELV $1377
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 56
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 1090519040
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTF4 3229614080
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3229614080
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 cg_smokeRadius_breath+8
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+CNSTF4 1059648963
+ARGF4
+CNSTF4 1153138688
+ARGF4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 400
+ADDI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+632912+492144
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+ADDRLP4 28
+INDIRP4
+CNSTI4 284
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $1355
+endproc CG_BreathPuffs 76 48
+proc CG_DustTrail 112 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_enableDust+12
+INDIRI4
+CNSTI4 0
+NEI4 $1395
+ADDRGP4 $1394
+JUMPV
+LABELV $1395
+ADDRGP4 cg_enableDust+12
+INDIRI4
+CNSTI4 1
+NEI4 $1398
+ADDRGP4 cg_serverEnableDust+12
+INDIRI4
+CNSTI4 0
+NEI4 $1398
+ADDRGP4 $1394
+JUMPV
+LABELV $1398
+ADDRGP4 cg_enableDust+12
+INDIRI4
+CNSTI4 2
+NEI4 $1402
+ADDRGP4 cg+3874620
+INDIRI4
+CNSTI4 0
+NEI4 $1402
+ADDRGP4 $1394
+JUMPV
+LABELV $1402
+ADDRFP4 0
+INDIRP4
+CNSTI4 888
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LEI4 $1406
+ADDRGP4 $1394
+JUMPV
+LABELV $1406
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 936
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 21
+EQI4 $1409
+ADDRLP4 24
+INDIRI4
+CNSTI4 19
+EQI4 $1409
+ADDRGP4 $1394
+JUMPV
+LABELV $1409
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 888
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 40
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 888
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+GEI4 $1411
+ADDRFP4 0
+INDIRP4
+CNSTI4 888
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $1411
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 96
+CNSTP4 0
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 28+44
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+NEI4 $1416
+ADDRGP4 cg_enableDust+12
+INDIRI4
+CNSTI4 4
+EQI4 $1416
+ADDRGP4 $1394
+JUMPV
+LABELV $1416
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 100
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 3253731328
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 cg_smokeRadius_dust+8
+INDIRF4
+ARGF4
+ADDRLP4 104
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+CNSTF4 1060320051
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1140457472
+ARGF4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+492440
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+LABELV $1394
+endproc CG_DustTrail 112 48
+proc CG_TrailItemExt 224 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 220
+CNSTF4 0
+ASGNF4
+ADDRLP4 172
+ADDRLP4 220
+INDIRF4
+ASGNF4
+ADDRLP4 172+8
+ADDRLP4 220
+INDIRF4
+ASGNF4
+ADDRLP4 172
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 184
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 172+4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 172
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+1
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+2
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+ADDRFP4 20
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1427
+endproc CG_TrailItemExt 224 12
+proc CG_TrailItem 4 24
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItemExt
+CALLV
+pop
+LABELV $1448
+endproc CG_TrailItem 4 24
+proc CG_PlayerFlag 420 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+108
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $633
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 172
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 172+8
+ADDRGP4 cgs+632912+112
+INDIRI4
+ASGNI4
+ADDRLP4 172+108
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 172+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 172+24
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 172+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 396
+CNSTF4 0
+ASGNF4
+ADDRLP4 344+8
+ADDRLP4 396
+INDIRF4
+ASGNF4
+ADDRLP4 344+4
+ADDRLP4 396
+INDIRF4
+ASGNF4
+ADDRLP4 344
+ADDRLP4 396
+INDIRF4
+ASGNF4
+ADDRLP4 376
+CNSTI4 0
+ASGNI4
+ADDRLP4 368
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 22
+EQI4 $1467
+ADDRLP4 368
+INDIRI4
+CNSTI4 23
+NEI4 $1465
+LABELV $1467
+ADDRLP4 384
+CNSTI4 35
+ASGNI4
+ADDRGP4 $1466
+JUMPV
+LABELV $1465
+ADDRLP4 368
+INDIRI4
+CNSTI4 14
+EQI4 $1470
+ADDRLP4 368
+INDIRI4
+CNSTI4 13
+NEI4 $1468
+LABELV $1470
+ADDRLP4 384
+CNSTI4 35
+ASGNI4
+ADDRLP4 376
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1469
+JUMPV
+LABELV $1468
+ADDRLP4 384
+CNSTI4 34
+ASGNI4
+ADDRLP4 376
+CNSTI4 1
+ASGNI4
+LABELV $1469
+LABELV $1466
+ADDRLP4 376
+INDIRI4
+CNSTI4 0
+EQI4 $1471
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 356+8
+ADDRLP4 356+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 356
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 372
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 356
+INDIRF4
+MULF4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 356+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 356+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 372
+INDIRF4
+ARGF4
+ADDRLP4 408
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 408
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1484
+ADDRLP4 372
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 356
+INDIRF4
+MULF4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 356+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 356+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 372
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1493
+ADDRLP4 372
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1494
+JUMPV
+LABELV $1493
+ADDRLP4 372
+INDIRF4
+CNSTF4 3212836864
+GEF4 $1495
+ADDRLP4 372
+CNSTF4 3212836864
+ASGNF4
+LABELV $1495
+LABELV $1494
+ADDRLP4 372
+INDIRF4
+ARGF4
+ADDRLP4 412
+ADDRGP4 acos
+CALLI4
+ASGNI4
+ADDRLP4 388
+ADDRLP4 412
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 372
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 356
+INDIRF4
+MULF4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 356+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 356+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 372
+INDIRF4
+CNSTF4 0
+GEF4 $1507
+ADDRLP4 344+4
+CNSTF4 1135869952
+CNSTF4 1127481344
+ADDRLP4 388
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $1508
+JUMPV
+LABELV $1507
+ADDRLP4 344+4
+CNSTF4 1127481344
+ADDRLP4 388
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+LABELV $1508
+ADDRLP4 344+4
+INDIRF4
+CNSTF4 0
+GEF4 $1511
+ADDRLP4 344+4
+ADDRLP4 344+4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $1511
+ADDRLP4 344+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1515
+ADDRLP4 344+4
+ADDRLP4 344+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1515
+ADDRLP4 344+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1041865114
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1020
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+LABELV $1484
+LABELV $1471
+ADDRLP4 344+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 380
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 380
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 996
+ADDP4
+ARGP4
+ADDRLP4 384
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRLP4 172+96
+ADDRFP4 0
+INDIRP4
+CNSTI4 996
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172+80
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172+100
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 344
+ARGP4
+ADDRLP4 172+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 172
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $633
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 172
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1449
+endproc CG_PlayerFlag 420 24
+proc CG_PlayerTokens 232 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1528
+ADDRGP4 $1527
+JUMPV
+LABELV $1528
+ADDRLP4 4
+CNSTI4 124
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+618160
+ADDP4
+ASGNP4
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $1531
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1527
+JUMPV
+LABELV $1531
+ADDRLP4 212
+INDIRI4
+CNSTI4 10
+LEI4 $1533
+ADDRLP4 212
+CNSTI4 10
+ASGNI4
+LABELV $1533
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1538
+JUMPV
+LABELV $1535
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1542
+JUMPV
+LABELV $1539
+ADDRLP4 220
+CNSTI4 12
+ASGNI4
+ADDRLP4 224
+ADDRLP4 220
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 224
+INDIRI4
+ADDRLP4 220
+INDIRI4
+SUBI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1540
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1542
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $1539
+ADDRLP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1536
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1538
+ADDRLP4 8
+INDIRI4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+SUBI4
+LTI4 $1535
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1546
+JUMPV
+LABELV $1543
+ADDRLP4 220
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 220
+INDIRP4
+INDIRF4
+ADDRLP4 184
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196+4
+ADDRLP4 220
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 184+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196+8
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 184+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196
+ARGP4
+ADDRLP4 224
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 224
+INDIRF4
+CNSTF4 1106247680
+LEF4 $1551
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 184
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 184+4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 196+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 184+8
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 196+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1551
+ADDRLP4 184
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1544
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1546
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+LTI4 $1543
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1557
+ADDRLP4 12+8
+ADDRGP4 cgs+632912+16
+INDIRI4
+ASGNI4
+ADDRGP4 $1558
+JUMPV
+LABELV $1557
+ADDRLP4 12+8
+ADDRGP4 cgs+632912+20
+INDIRI4
+ASGNI4
+LABELV $1558
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1571
+JUMPV
+LABELV $1568
+ADDRLP4 12+28
+ADDRLP4 184
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+4
+ADDRLP4 184+4
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+8
+ADDRLP4 184+8
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+28
+ARGP4
+ADDRLP4 12+28+24
+ARGP4
+ADDRLP4 12+28+12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 12+68
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 208
+CNSTF4 1086918619
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 5000
+ADDI4
+CNSTI4 500
+ADDRLP4 8
+INDIRI4
+MULI4
+SUBI4
+CNSTI4 16
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ARGF4
+ADDRLP4 220
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+68+8
+ADDRLP4 12+68+8
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 220
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 184
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1569
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1571
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+LTI4 $1568
+LABELV $1527
+endproc CG_PlayerTokens 232 12
+proc CG_PlayerPowerups 32 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1600
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+ARGP4
+ADDRGP4 CG_UpdatePositionData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 852
+ADDP4
+ARGP4
+ADDRGP4 CG_UpdatePositionData
+CALLV
+pop
+ADDRGP4 $1599
+JUMPV
+LABELV $1600
+ADDRLP4 4
+ADDRGP4 cg_powerupLight+12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_QUAD
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1603
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1603
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1045220557
+ARGF4
+CNSTF4 1061158912
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1603
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_FLIGHT
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1605
+ADDRGP4 EffectScripts+3670376
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1607
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPositionDataToScript
+CALLV
+pop
+ADDRGP4 EffectScripts+3670376
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPositionDataToCent
+CALLV
+pop
+ADDRGP4 $1606
+JUMPV
+LABELV $1607
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FlightTrail
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 cgs+632912+493240
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddLoopingSound
+CALLV
+pop
+ADDRGP4 $1606
+JUMPV
+LABELV $1605
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+ARGP4
+ADDRGP4 CG_UpdatePositionData
+CALLV
+pop
+LABELV $1606
+ADDRLP4 8
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_REDFLAG
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1616
+ADDRGP4 cg_flagStyle+12
+INDIRI4
+CNSTI4 3
+NEI4 $1618
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1621
+ADDRLP4 24
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $1622
+JUMPV
+LABELV $1621
+ADDRLP4 24
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1622
+ADDRLP4 16
+CNSTI4 4524
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $1627
+ADDRGP4 cg_freecam_useTeamSettings+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $1627
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $1627
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $1631
+ADDRLP4 20
+ARGP4
+ADDRGP4 cg_teamFlagColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+60
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 20+1
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 20+2
+INDIRU1
+CVUI4 1
+ARGI4
+CNSTI4 255
+ARGI4
+ADDRGP4 CG_TrailItemExt
+CALLV
+pop
+ADDRGP4 $1619
+JUMPV
+LABELV $1631
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $1637
+ADDRLP4 20
+ARGP4
+ADDRGP4 cg_enemyFlagColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+60
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 20+1
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 20+2
+INDIRU1
+CVUI4 1
+ARGI4
+CNSTI4 255
+ARGI4
+ADDRGP4 CG_TrailItemExt
+CALLV
+pop
+ADDRGP4 $1619
+JUMPV
+LABELV $1637
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+48
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+ADDRGP4 $1619
+JUMPV
+LABELV $1618
+ADDRGP4 cg_flagStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $1645
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+48
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+ADDRGP4 $1646
+JUMPV
+LABELV $1645
+ADDRLP4 8
+INDIRP4
+CNSTI4 868
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1650
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+116
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1651
+JUMPV
+LABELV $1650
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+36
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1651
+LABELV $1646
+LABELV $1619
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1656
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 20
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1656
+LABELV $1616
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1658
+ADDRGP4 cg_flagStyle+12
+INDIRI4
+CNSTI4 3
+NEI4 $1660
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1663
+ADDRLP4 24
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $1664
+JUMPV
+LABELV $1663
+ADDRLP4 24
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1664
+ADDRLP4 16
+CNSTI4 4524
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $1669
+ADDRGP4 cg_freecam_useTeamSettings+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $1669
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $1669
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $1673
+ADDRLP4 20
+ARGP4
+ADDRGP4 cg_teamFlagColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+60
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 20+1
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 20+2
+INDIRU1
+CVUI4 1
+ARGI4
+CNSTI4 255
+ARGI4
+ADDRGP4 CG_TrailItemExt
+CALLV
+pop
+ADDRGP4 $1661
+JUMPV
+LABELV $1673
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $1679
+ADDRLP4 20
+ARGP4
+ADDRGP4 cg_enemyFlagColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+60
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 20+1
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 20+2
+INDIRU1
+CVUI4 1
+ARGI4
+CNSTI4 255
+ARGI4
+ADDRGP4 CG_TrailItemExt
+CALLV
+pop
+ADDRGP4 $1661
+JUMPV
+LABELV $1679
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+52
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+ADDRGP4 $1661
+JUMPV
+LABELV $1660
+ADDRGP4 cg_flagStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $1687
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+52
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+ADDRGP4 $1688
+JUMPV
+LABELV $1687
+ADDRLP4 8
+INDIRP4
+CNSTI4 868
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1692
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+120
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1693
+JUMPV
+LABELV $1692
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+40
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1693
+LABELV $1688
+LABELV $1661
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1698
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1698
+LABELV $1658
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1700
+ADDRGP4 cg_flagStyle+12
+INDIRI4
+CNSTI4 3
+NEI4 $1702
+ADDRLP4 16
+ARGP4
+ADDRGP4 cg_neutralFlagColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+60
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 16+1
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 16+2
+INDIRU1
+CVUI4 1
+ARGI4
+CNSTI4 255
+ARGI4
+ADDRGP4 CG_TrailItemExt
+CALLV
+pop
+ADDRGP4 $1703
+JUMPV
+LABELV $1702
+ADDRGP4 cg_flagStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $1709
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+56
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+ADDRGP4 $1710
+JUMPV
+LABELV $1709
+ADDRLP4 8
+INDIRP4
+CNSTI4 868
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1714
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+124
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1715
+JUMPV
+LABELV $1714
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+44
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1715
+LABELV $1710
+LABELV $1703
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1720
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1720
+LABELV $1700
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1722
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1722
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1722
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_HASTE
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1724
+ADDRGP4 EffectScripts+3506536
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1726
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 936
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 15
+EQI4 $1731
+ADDRLP4 24
+INDIRI4
+CNSTI4 16
+NEI4 $1725
+LABELV $1731
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 852
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPositionDataToScript
+CALLV
+pop
+ADDRGP4 EffectScripts+3506536
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 852
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPositionDataToCent
+CALLV
+pop
+ADDRGP4 $1725
+JUMPV
+LABELV $1726
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_HasteTrail
+CALLV
+pop
+ADDRGP4 $1725
+JUMPV
+LABELV $1724
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 852
+ADDP4
+ARGP4
+ADDRGP4 CG_UpdatePositionData
+CALLV
+pop
+LABELV $1725
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1733
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1452
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg_spawnArmorTime+12
+INDIRI4
+GEI4 $1735
+LABELV $1735
+LABELV $1733
+LABELV $1599
+endproc CG_PlayerPowerups 32 24
+proc CG_PlayerFloatSpriteExt 232 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 cg_drawSprites+12
+INDIRI4
+CNSTI4 0
+NEI4 $1740
+ADDRGP4 $1739
+JUMPV
+LABELV $1740
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $1743
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+436
+INDIRI4
+NEI4 $1743
+ADDRGP4 cg_drawSpriteSelf+12
+INDIRI4
+CNSTI4 0
+NEI4 $1743
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $1743
+ADDRGP4 $1739
+JUMPV
+LABELV $1743
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 208
+ADDRGP4 CG_IsFirstPersonView
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $1750
+ADDRLP4 172
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1751
+JUMPV
+LABELV $1750
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+LABELV $1751
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $1752
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+436
+INDIRI4
+NEI4 $1752
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+LABELV $1752
+ADDRLP4 172
+ADDRLP4 172
+INDIRI4
+ADDRFP4 8
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 48
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+132
+CNSTF4 1092616192
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1761
+ADDRLP4 0+116
+ADDRFP4 12
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+1
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+2
+ADDRFP4 12
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+3
+ADDRFP4 12
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRGP4 $1762
+JUMPV
+LABELV $1761
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1762
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1777
+ADDRGP4 $1778
+JUMPV
+LABELV $1777
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+424
+INDIRI4
+EQI4 $1791
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+440
+INDIRI4
+EQI4 $1791
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+444
+INDIRI4
+EQI4 $1791
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+452
+INDIRI4
+NEI4 $1779
+LABELV $1791
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1792
+ADDRLP4 188
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $1793
+JUMPV
+LABELV $1792
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $1796
+ADDRLP4 188
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRGP4 $1797
+JUMPV
+LABELV $1796
+ADDRLP4 188
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+LABELV $1797
+LABELV $1793
+ADDRLP4 216
+CNSTF4 0
+ASGNF4
+ADDRLP4 176
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+424
+INDIRI4
+NEI4 $1802
+ADDRLP4 176
+ADDRGP4 cg_drawFriendMinWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRGP4 cg_drawFriendMaxWidth+8
+INDIRF4
+ASGNF4
+ADDRGP4 $1803
+JUMPV
+LABELV $1802
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+440
+INDIRI4
+NEI4 $1808
+ADDRLP4 176
+ADDRGP4 cg_drawFoeMinWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRGP4 cg_drawFoeMaxWidth+8
+INDIRF4
+ASGNF4
+ADDRGP4 $1809
+JUMPV
+LABELV $1808
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+444
+INDIRI4
+NEI4 $1814
+ADDRLP4 176
+ADDRGP4 cg_drawSelfMinWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRGP4 cg_drawSelfMaxWidth+8
+INDIRF4
+ASGNF4
+ADDRGP4 $1815
+JUMPV
+LABELV $1814
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+452
+INDIRI4
+NEI4 $1820
+ADDRLP4 176
+ADDRGP4 cg_drawSelfMinWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRGP4 cg_drawSelfMaxWidth+8
+INDIRF4
+ASGNF4
+LABELV $1820
+LABELV $1815
+LABELV $1809
+LABELV $1803
+ADDRLP4 220
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 220
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 184
+CNSTF4 1128792064
+ADDRLP4 220
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1036831949
+LEF4 $1826
+ADDRLP4 184
+ADDRLP4 184
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 176
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $1826
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+452
+INDIRI4
+NEI4 $1828
+ADDRGP4 cg_drawSelfIconStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $1828
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $1829
+ADDRFP4 4
+ADDRGP4 cgs+632912+456
+INDIRI4
+ASGNI4
+ADDRGP4 $1829
+JUMPV
+LABELV $1828
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+444
+INDIRI4
+NEI4 $1839
+ADDRGP4 cg_drawSelfIconStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $1839
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $1844
+ADDRFP4 4
+ADDRGP4 cgs+632912+448
+INDIRI4
+ASGNI4
+LABELV $1844
+LABELV $1845
+LABELV $1839
+LABELV $1829
+ADDRLP4 0+132
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRLP4 224
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 184
+INDIRF4
+LEF4 $1780
+ADDRLP4 176
+INDIRF4
+CNSTF4 1036831949
+LEF4 $1780
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRLP4 228
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 0+132
+ADDRLP4 200
+INDIRF4
+ADDRLP4 228
+INDIRF4
+ADDRLP4 184
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $1780
+JUMPV
+LABELV $1779
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+1317364
+INDIRI4
+EQI4 $1865
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+1317368
+INDIRI4
+EQI4 $1865
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+632912+1317372
+INDIRI4
+NEI4 $1856
+LABELV $1865
+ADDRLP4 0+132
+ADDRGP4 cg_drawFlagCarrierSize+8
+INDIRF4
+ASGNF4
+LABELV $1856
+LABELV $1780
+LABELV $1778
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRLP4 0+132
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+112
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1739
+endproc CG_PlayerFloatSpriteExt 232 12
+proc CG_PlayerFloatSpriteNameExt 184 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $1874
+ADDRLP4 176
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1875
+JUMPV
+LABELV $1874
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1877
+ADDRLP4 176
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $1878
+JUMPV
+LABELV $1877
+ADDRLP4 176
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1878
+LABELV $1875
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 176
+INDIRI4
+NEI4 $1881
+ADDRGP4 $1873
+JUMPV
+LABELV $1881
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_IsFirstPersonView
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $1883
+ADDRLP4 172
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1884
+JUMPV
+LABELV $1883
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+LABELV $1884
+ADDRGP4 cg_drawPlayerNames+12
+INDIRI4
+CNSTI4 2
+NEI4 $1885
+ADDRLP4 172
+ADDRLP4 172
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $1886
+JUMPV
+LABELV $1885
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+LABELV $1886
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_drawPlayerNamesY+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+112
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1126170624
+ADDRGP4 cg_drawPlayerNamesScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+140
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1873
+endproc CG_PlayerFloatSpriteNameExt 184 12
+proc CG_PlayerFloatSprite 4 20
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteExt
+CALLV
+pop
+LABELV $1906
+endproc CG_PlayerFloatSprite 4 20
+export CG_FloatSprite
+proc CG_FloatSprite 172 12
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+112
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1912
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1913
+JUMPV
+LABELV $1912
+ADDRLP4 0+116
+ADDRFP4 12
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+1
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+2
+ADDRFP4 12
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+3
+ADDRFP4 12
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+LABELV $1913
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1907
+endproc CG_FloatSprite 172 12
+export CG_FloatNumber
+proc CG_FloatNumber 388 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRF4
+CNSTF4 0
+GEF4 $1929
+ADDRFP4 16
+CNSTF4 1008981770
+ASGNF4
+LABELV $1929
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1931
+ADDRLP4 324
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $1932
+JUMPV
+LABELV $1931
+ADDRLP4 324
+CNSTI4 0
+ASGNI4
+LABELV $1932
+ADDRLP4 180
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 356
+CNSTI4 10
+ASGNI4
+ADDRLP4 196
+ADDRLP4 180
+INDIRI4
+ADDRLP4 356
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 180
+INDIRI4
+ADDRLP4 356
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 172
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1936
+JUMPV
+LABELV $1933
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 196
+ADDP4
+ADDRLP4 180
+INDIRI4
+CNSTI4 10
+MODI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 180
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $1934
+ADDRLP4 172
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1936
+ADDRLP4 172
+INDIRI4
+CNSTI4 32
+GEI4 $1937
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $1933
+LABELV $1937
+ADDRGP4 cg+609780
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRLP4 340
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1939
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 3246391296
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRLP4 184+4
+INDIRF4
+CNSTF4 3246391296
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRLP4 184+8
+INDIRF4
+CNSTF4 3246391296
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+492172+40
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1090519040
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1960
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1961
+JUMPV
+LABELV $1960
+ADDRLP4 0+116
+ADDRFP4 12
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+1
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+2
+ADDRFP4 12
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+3
+ADDRFP4 12
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+LABELV $1961
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1939
+ADDRLP4 176
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRGP4 $1979
+JUMPV
+LABELV $1976
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 1098907648
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 176
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRLP4 172
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 16
+SUBI4
+CVIF4 4
+ADDRFP4 16
+INDIRF4
+MULF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRLP4 184+4
+INDIRF4
+CNSTF4 1098907648
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 176
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRLP4 172
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 16
+SUBI4
+CVIF4 4
+ADDRFP4 16
+INDIRF4
+MULF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRLP4 184+8
+INDIRF4
+CNSTF4 1098907648
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 176
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRLP4 172
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 16
+SUBI4
+CVIF4 4
+ADDRFP4 16
+INDIRF4
+MULF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 384
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+112
+ADDRLP4 176
+INDIRI4
+ADDRLP4 384
+INDIRI4
+LSHI4
+ADDRLP4 196-4
+ADDP4
+INDIRI4
+ADDRLP4 384
+INDIRI4
+LSHI4
+ADDRGP4 cgs+632912+492172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1090519040
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1999
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $2000
+JUMPV
+LABELV $1999
+ADDRLP4 0+116
+ADDRFP4 12
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+1
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+2
+ADDRFP4 12
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+3
+ADDRFP4 12
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+LABELV $2000
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1977
+ADDRLP4 176
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1979
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+GTI4 $1976
+LABELV $1928
+endproc CG_FloatNumber 388 16
+export CG_FloatNumberExt
+proc CG_FloatNumberExt 8 0
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 cg+6739152
+INDIRI4
+CNSTI4 1024
+LTI4 $2016
+ADDRGP4 $2015
+JUMPV
+LABELV $2016
+ADDRLP4 0
+ADDRGP4 cg+6739152
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+6706384
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 21
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+6739152
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2015
+endproc CG_FloatNumberExt 8 0
+export CG_FloatEntNumbers
+proc CG_FloatEntNumbers 33 20
+ADDRGP4 cg_drawEntNumbers+12
+INDIRI4
+CNSTI4 0
+NEI4 $2024
+ADDRGP4 $2023
+JUMPV
+LABELV $2024
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $2027
+ADDRLP4 28
+ADDRGP4 cg_entities
+ASGNP4
+ADDRLP4 0
+CNSTI4 1496
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1496
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2031
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $2031
+ADDRGP4 $2028
+JUMPV
+LABELV $2031
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $2034
+ADDRGP4 cg_drawEntNumbers+12
+INDIRI4
+CNSTI4 3
+GEI4 $2034
+ADDRGP4 $2028
+JUMPV
+LABELV $2034
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LTI4 $2037
+LABELV $2037
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2039
+ADDRLP4 12
+ADDRGP4 cg+607196+20
+INDIRB
+ASGNB 12
+ADDRGP4 $2040
+JUMPV
+LABELV $2039
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2040
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 32
+CNSTU1 255
+ASGNU1
+ADDRLP4 4
+ADDRLP4 32
+INDIRU1
+ASGNU1
+ADDRLP4 4+1
+ADDRLP4 32
+INDIRU1
+ASGNU1
+ADDRLP4 4+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 4+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2048
+ADDRLP4 4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $2049
+JUMPV
+LABELV $2048
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+GEI4 $2050
+ADDRLP4 4+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1112014848
+ADDF4
+ASGNF4
+LABELV $2050
+LABELV $2049
+ADDRGP4 cg_drawEntNumbers+12
+INDIRI4
+CNSTI4 1
+LEI4 $2054
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_FloatNumber
+CALLV
+pop
+ADDRGP4 $2055
+JUMPV
+LABELV $2054
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_FloatNumber
+CALLV
+pop
+LABELV $2055
+LABELV $2028
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1024
+LTI4 $2027
+LABELV $2023
+endproc CG_FloatEntNumbers 33 20
+lit
+align 1
+LABELV $2077
+byte 1 255
+byte 1 255
+byte 1 255
+byte 1 255
+code
+proc CG_PlayerSprites 64 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawSpritesDeadPlayers+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $2058
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 12
+INDIRI4
+EQI4 $2058
+ADDRGP4 $2057
+JUMPV
+LABELV $2058
+ADDRLP4 0
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRGP4 cg_drawPlayerNames+12
+INDIRI4
+CNSTI4 0
+EQI4 $2062
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+630584
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteNameExt
+CALLV
+pop
+LABELV $2062
+ADDRGP4 cg_rocketAimBot+12
+INDIRI4
+CNSTI4 0
+EQI4 $2066
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2069
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $2069
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2070
+JUMPV
+LABELV $2069
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $2072
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2072
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2073
+JUMPV
+LABELV $2072
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $2073
+LABELV $2070
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2075
+ADDRLP4 20
+ADDRGP4 $2077
+INDIRB
+ASGNB 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_Rocket_Aim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTF4 1092616192
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_SimpleRailTrail
+CALLV
+pop
+ADDRGP4 cgs+632912+1317384
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 20
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRGP4 CG_FloatSprite
+CALLV
+pop
+ADDRGP4 cg_rocketAimBot+12
+INDIRI4
+CNSTI4 1
+LEI4 $2080
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 24+4
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 24+8
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $2090
+ARGP4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48+4
+INDIRF4
+ARGF4
+ADDRLP4 48+8
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $2080
+LABELV $2075
+LABELV $2066
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $2100
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+EQI4 $2100
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $2093
+LABELV $2100
+ADDRGP4 cg_drawFlagCarrier+12
+INDIRI4
+CNSTI4 0
+EQI4 $2093
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_REDFLAG
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $2101
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $2103
+ADDRLP4 4
+ADDRGP4 cgs+632912+1317364
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTU1 255
+ASGNU1
+ADDRLP4 16
+ADDRLP4 36
+INDIRU1
+ASGNU1
+ADDRLP4 16+1
+ADDRLP4 36
+INDIRU1
+ASGNU1
+ADDRLP4 16+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 16+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $2102
+JUMPV
+LABELV $2103
+ADDRGP4 cg_drawFlagCarrier+12
+INDIRI4
+CNSTI4 1
+LEI4 $2102
+ADDRLP4 4
+ADDRGP4 cgs+632912+1317364
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTU1 255
+ASGNU1
+ADDRLP4 16
+ADDRLP4 36
+INDIRU1
+ASGNU1
+ADDRLP4 16+1
+ADDRLP4 36
+INDIRU1
+ASGNU1
+ADDRLP4 16+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 16+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $2102
+JUMPV
+LABELV $2101
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2118
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $2120
+ADDRLP4 4
+ADDRGP4 cgs+632912+1317364
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTU1 255
+ASGNU1
+ADDRLP4 16
+ADDRLP4 36
+INDIRU1
+ASGNU1
+ADDRLP4 16+1
+ADDRLP4 36
+INDIRU1
+ASGNU1
+ADDRLP4 16+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 16+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $2119
+JUMPV
+LABELV $2120
+ADDRGP4 cg_drawFlagCarrier+12
+INDIRI4
+CNSTI4 1
+LEI4 $2119
+ADDRLP4 4
+ADDRGP4 cgs+632912+1317364
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTU1 255
+ASGNU1
+ADDRLP4 16
+ADDRLP4 36
+INDIRU1
+ASGNU1
+ADDRLP4 16+1
+ADDRLP4 36
+INDIRU1
+ASGNU1
+ADDRLP4 16+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 16+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $2119
+JUMPV
+LABELV $2118
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2135
+ADDRLP4 4
+ADDRGP4 cgs+632912+1317368
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTU1 255
+ASGNU1
+ADDRLP4 16
+ADDRLP4 36
+INDIRU1
+ASGNU1
+ADDRLP4 16+1
+ADDRLP4 36
+INDIRU1
+ASGNU1
+ADDRLP4 16+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 16+3
+CNSTU1 255
+ASGNU1
+LABELV $2135
+LABELV $2119
+LABELV $2102
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2142
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRGP4 cg_drawHitFlagCarrierTime+12
+INDIRI4
+CVIF4 4
+GEF4 $2142
+ADDRLP4 4
+ADDRGP4 cgs+632912+1317372
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTU1 255
+ASGNU1
+ADDRLP4 16+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 16+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 16+3
+CNSTU1 255
+ASGNU1
+LABELV $2142
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2151
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2154
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRGP4 $2155
+JUMPV
+LABELV $2154
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $2155
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteExt
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $2151
+LABELV $2093
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $2156
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2158
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+LABELV $2158
+ADDRGP4 EffectScripts+2982248
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2160
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+2982248
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+468
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteExt
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2156
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2168
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2170
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+LABELV $2170
+ADDRGP4 EffectScripts+2949480
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2172
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+2949480
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2172
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+464
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteExt
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2168
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2180
+ADDRGP4 $2057
+JUMPV
+LABELV $2180
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4512
+ADDP4
+INDIRI4
+GTI4 $2182
+ADDRGP4 $2183
+JUMPV
+LABELV $2182
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4512
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1500
+GTI4 $2185
+ADDRLP4 0
+INDIRP4
+CNSTI4 4516
+ADDP4
+INDIRI4
+ADDRGP4 cgs+632912+492504
+INDIRI4
+NEI4 $2188
+ADDRGP4 EffectScripts+3178856
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2188
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3178856
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2188
+ADDRLP4 0
+INDIRP4
+CNSTI4 4516
+ADDP4
+INDIRI4
+ADDRGP4 cgs+632912+492548
+INDIRI4
+NEI4 $2196
+ADDRGP4 EffectScripts+3211624
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2196
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3211624
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2196
+ADDRLP4 0
+INDIRP4
+CNSTI4 4516
+ADDP4
+INDIRI4
+ADDRGP4 cgs+632912+492536
+INDIRI4
+NEI4 $2204
+ADDRGP4 EffectScripts+3244392
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2204
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3244392
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2204
+ADDRLP4 0
+INDIRP4
+CNSTI4 4516
+ADDP4
+INDIRI4
+ADDRGP4 cgs+632912+492512
+INDIRI4
+NEI4 $2212
+ADDRGP4 EffectScripts+3277160
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2212
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3277160
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2212
+ADDRLP4 0
+INDIRP4
+CNSTI4 4516
+ADDP4
+INDIRI4
+ADDRGP4 cgs+632912+492532
+INDIRI4
+NEI4 $2220
+ADDRGP4 EffectScripts+3309928
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2220
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3309928
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2220
+ADDRLP4 0
+INDIRP4
+CNSTI4 4516
+ADDP4
+INDIRI4
+ADDRGP4 cgs+632912+492524
+INDIRI4
+NEI4 $2228
+ADDRGP4 EffectScripts+3342696
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2228
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3342696
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2228
+ADDRLP4 0
+INDIRP4
+CNSTI4 4516
+ADDP4
+INDIRI4
+ADDRGP4 cgs+632912+492516
+INDIRI4
+NEI4 $2236
+ADDRGP4 EffectScripts+3375464
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2236
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3375464
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2236
+ADDRLP4 0
+INDIRP4
+CNSTI4 4516
+ADDP4
+INDIRI4
+ADDRGP4 cgs+632912+492540
+INDIRI4
+NEI4 $2244
+ADDRGP4 EffectScripts+3408232
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2244
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3408232
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2244
+ADDRLP4 0
+INDIRP4
+CNSTI4 4516
+ADDP4
+INDIRI4
+ADDRGP4 cgs+632912+492520
+INDIRI4
+NEI4 $2252
+ADDRGP4 EffectScripts+3441000
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2252
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3441000
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2252
+ADDRLP4 0
+INDIRP4
+CNSTI4 4516
+ADDP4
+INDIRI4
+ADDRGP4 cgs+632912+492528
+INDIRI4
+NEI4 $2260
+ADDRGP4 EffectScripts+3473768
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2260
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3473768
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2260
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4516
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2185
+LABELV $2183
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $2268
+ADDRGP4 EffectScripts+3015016
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2270
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3015016
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2270
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+492476
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2268
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $2278
+ADDRGP4 EffectScripts+3047784
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2280
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3047784
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2280
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+492480
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2278
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $2288
+ADDRGP4 EffectScripts+3146088
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2290
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3146088
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2290
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+492484
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2288
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $2298
+ADDRGP4 EffectScripts+3539304
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2300
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3539304
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2300
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+492488
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2298
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $2308
+ADDRGP4 EffectScripts+3572072
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2310
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3572072
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2310
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+492492
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2308
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $2318
+ADDRGP4 EffectScripts+3604840
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2320
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 ScriptVars+60+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRGP4 EffectScripts+3604840
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2320
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+492496
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2318
+ADDRGP4 cg_drawSelf+12
+INDIRI4
+CNSTI4 0
+EQI4 $2328
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2328
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2332
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $2332
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+4
+INDIRI4
+NEI4 $2336
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+452
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawSelf+12
+INDIRI4
+CNSTI4 2
+NEI4 $2343
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRGP4 $2344
+JUMPV
+LABELV $2343
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $2344
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteExt
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2336
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+444
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawSelf+12
+INDIRI4
+CNSTI4 2
+NEI4 $2349
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRGP4 $2350
+JUMPV
+LABELV $2349
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $2350
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteExt
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2332
+LABELV $2328
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $2351
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $2354
+ADDRGP4 cg_drawFriend+12
+INDIRI4
+CNSTI4 3
+NEI4 $2355
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2355
+JUMPV
+LABELV $2354
+ADDRGP4 cg_drawFriend+12
+INDIRI4
+CNSTI4 1
+EQI4 $2364
+ADDRGP4 cg_drawFriend+12
+INDIRI4
+CNSTI4 3
+NEI4 $2360
+LABELV $2364
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+LABELV $2360
+LABELV $2355
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_FreezeTagFrozen
+CALLI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $2365
+ADDRLP4 24
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $2365
+ADDRLP4 4
+ADDRGP4 cgs+632912+436
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2370
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRGP4 $2371
+JUMPV
+LABELV $2370
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $2371
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteExt
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2365
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2372
+ADDRGP4 cg_drawFriend+12
+INDIRI4
+CNSTI4 0
+EQI4 $2374
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRGP4 cg_drawHitFriendTime+12
+INDIRI4
+CVIF4 4
+GEF4 $2377
+ADDRLP4 4
+ADDRGP4 cgs+632912+428
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2384
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRGP4 $2385
+JUMPV
+LABELV $2384
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $2385
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteExt
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2377
+LABELV $2374
+LABELV $2372
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2386
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2388
+ADDRLP4 4
+ADDRGP4 cgs+632912+432
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawFriend+12
+INDIRI4
+CNSTI4 0
+EQI4 $2057
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2395
+ADDRLP4 44
+ADDRGP4 cg+607704+900+212
+INDIRI4
+ASGNI4
+ADDRGP4 $2396
+JUMPV
+LABELV $2395
+ADDRLP4 44
+CNSTI4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900+212
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2396
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ADDRGP4 cg_drawDeadFriendTime+12
+INDIRI4
+GTI4 $2057
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2408
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRGP4 $2409
+JUMPV
+LABELV $2408
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $2409
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteExt
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2388
+ADDRGP4 cg_drawFriend+12
+INDIRI4
+CNSTI4 0
+EQI4 $2057
+ADDRLP4 4
+ADDRGP4 cgs+632912+424
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawFriendStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $2415
+ADDRLP4 0
+INDIRP4
+CNSTI4 4508
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2415
+ADDRLP4 48
+CNSTU1 255
+ASGNU1
+ADDRLP4 44
+ADDRLP4 48
+INDIRU1
+ASGNU1
+ADDRLP4 44+1
+ADDRLP4 48
+INDIRU1
+ASGNU1
+ADDRLP4 44+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 44+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 30
+GEI4 $2421
+ADDRLP4 49
+CNSTU1 0
+ASGNU1
+ADDRLP4 44+2
+ADDRLP4 49
+INDIRU1
+ASGNU1
+ADDRLP4 44+1
+ADDRLP4 49
+INDIRU1
+ASGNU1
+ADDRGP4 $2416
+JUMPV
+LABELV $2421
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 66
+GEI4 $2425
+ADDRLP4 44+1
+CNSTU1 126
+ASGNU1
+ADDRGP4 $2416
+JUMPV
+LABELV $2425
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $2428
+ADDRLP4 44+1
+CNSTU1 255
+ASGNU1
+ADDRGP4 $2416
+JUMPV
+LABELV $2428
+ADDRLP4 44+2
+CNSTU1 125
+ASGNU1
+ADDRGP4 $2416
+JUMPV
+LABELV $2415
+ADDRLP4 48
+CNSTU1 255
+ASGNU1
+ADDRLP4 44
+ADDRLP4 48
+INDIRU1
+ASGNU1
+ADDRLP4 44+1
+ADDRLP4 48
+INDIRU1
+ASGNU1
+ADDRLP4 44+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 44+3
+CNSTU1 255
+ASGNU1
+LABELV $2416
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2436
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRGP4 $2437
+JUMPV
+LABELV $2436
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $2437
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 44
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteExt
+CALLV
+pop
+ADDRGP4 $2057
+JUMPV
+LABELV $2386
+LABELV $2351
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2438
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2438
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $2441
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1960920
+INDIRI4
+CNSTI4 67108864
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $2441
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2441
+ADDRGP4 cg_allowServerOverride+12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $2441
+ADDRGP4 cg_drawInfected+12
+INDIRI4
+CNSTI4 0
+EQI4 $2442
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+632912+460
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteExt
+CALLV
+pop
+ADDRGP4 $2442
+JUMPV
+LABELV $2441
+ADDRLP4 4
+ADDRGP4 cgs+632912+440
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawFoe+12
+INDIRI4
+CNSTI4 0
+EQI4 $2455
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cg_drawFoe+12
+INDIRI4
+CNSTI4 2
+NEI4 $2460
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRGP4 $2461
+JUMPV
+LABELV $2460
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $2461
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSpriteExt
+CALLV
+pop
+LABELV $2455
+LABELV $2442
+LABELV $2438
+LABELV $2057
+endproc CG_PlayerSprites 64 20
+lit
+align 4
+LABELV $2463
+byte 4 3245342720
+byte 4 3245342720
+byte 4 0
+align 4
+LABELV $2464
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+code
+proc CG_PlayerShadow 112 52
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 $2463
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRGP4 $2464
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 0
+EQI4 $2469
+ADDRGP4 $2468
+ARGP4
+ADDRLP4 96
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $2465
+LABELV $2469
+CNSTI4 0
+RETI4
+ADDRGP4 $2462
+JUMPV
+LABELV $2465
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_INVIS
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2470
+CNSTI4 0
+RETI4
+ADDRGP4 $2462
+JUMPV
+LABELV $2470
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 60+8
+ADDRLP4 60+8
+INDIRF4
+CNSTF4 1124073472
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $2478
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+NEI4 $2478
+ADDRLP4 0
+INDIRI4
+ADDRLP4 100
+INDIRI4
+EQI4 $2473
+LABELV $2478
+CNSTI4 0
+RETI4
+ADDRGP4 $2462
+JUMPV
+LABELV $2473
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 1
+EQI4 $2481
+CNSTI4 1
+RETI4
+ADDRGP4 $2462
+JUMPV
+LABELV $2481
+ADDRLP4 56
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 cgs+632912+492216
+INDIRI4
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+CNSTF4 1103101952
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $2462
+endproc CG_PlayerShadow 112 52
+proc CG_PlayerSplash 200 28
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 0
+EQI4 $2493
+ADDRGP4 $2468
+ARGP4
+ADDRLP4 180
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $2490
+LABELV $2493
+ADDRGP4 $2489
+JUMPV
+LABELV $2490
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 184
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $2495
+ADDRGP4 $2489
+JUMPV
+LABELV $2495
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 152+8
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 57
+BANDI4
+CNSTI4 0
+EQI4 $2498
+ADDRGP4 $2489
+JUMPV
+LABELV $2498
+ADDRLP4 96
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRLP4 192
+CNSTP4 0
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 96+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $2500
+ADDRGP4 $2489
+JUMPV
+LABELV $2500
+ADDRLP4 0
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 196
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 0+24
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 0+24+4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+48
+ADDRLP4 0+48
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 0+48+4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+72
+ADDRLP4 0+72
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 0+72+4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cgs+632912+492240
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $2489
+endproc CG_PlayerSplash 200 28
+export CG_AddRefEntityWithPowerups
+proc CG_AddRefEntityWithPowerups 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_INVIS
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2581
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492280
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 $2582
+JUMPV
+LABELV $2581
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 1496
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1452
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg_spawnArmorTime+12
+INDIRI4
+GEI4 $2585
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492296
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2585
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_QUAD
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2592
+ADDRGP4 $2594
+JUMPV
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492272
+INDIRI4
+ASGNI4
+ADDRGP4 $2595
+JUMPV
+LABELV $2594
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492268
+INDIRI4
+ASGNI4
+LABELV $2595
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2592
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_REGEN
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2600
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 100
+DIVI4
+CNSTI4 10
+MODI4
+CNSTI4 1
+NEI4 $2602
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492284
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2602
+LABELV $2600
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2607
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492288
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2607
+ADDRFP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_FreezeTagFrozen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2611
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_weapons+528+80
+INDIRI4
+EQI4 $2611
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_weapons+660+80
+INDIRI4
+EQI4 $2611
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_weapons+1188+80
+INDIRI4
+EQI4 $2611
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_weapons+1584+80
+INDIRI4
+EQI4 $2611
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+632912+492168
+INDIRI4
+EQI4 $2611
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2628
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $2627
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+EQI4 $2626
+ADDRGP4 $2623
+JUMPV
+LABELV $2626
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2624
+JUMPV
+LABELV $2627
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2624
+JUMPV
+LABELV $2628
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2624
+JUMPV
+LABELV $2623
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+LABELV $2624
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492320
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2611
+ADDRGP4 cg_playerShader+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2631
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 cg_playerShader+16
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2631
+ADDRGP4 cg_wh+12
+INDIRI4
+CNSTI4 0
+EQI4 $2635
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_whIncludeDeadBody+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $2638
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2638
+ADDRGP4 $2639
+JUMPV
+LABELV $2638
+ADDRGP4 cg_whIncludeProjectile+12
+INDIRI4
+CNSTI4 0
+NEI4 $2641
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2641
+ADDRGP4 $2642
+JUMPV
+LABELV $2641
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_IsEnemyTeam
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2644
+ADDRGP4 cg_wh+12
+INDIRI4
+CNSTI4 3
+NEI4 $2646
+ADDRGP4 $2580
+JUMPV
+LABELV $2646
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg_whEnemyColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRGP4 cg_whEnemyAlpha+12
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRGP4 cg_whEnemyShader+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2650
+ADDRGP4 cg_whEnemyShader+16
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2645
+JUMPV
+LABELV $2650
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492392
+INDIRI4
+ASGNI4
+ADDRGP4 $2645
+JUMPV
+LABELV $2644
+ADDRGP4 cg_wh+12
+INDIRI4
+CNSTI4 2
+NEI4 $2656
+ADDRGP4 $2580
+JUMPV
+LABELV $2656
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg_whColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRGP4 cg_whAlpha+12
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRGP4 cg_whShader+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2660
+ADDRGP4 cg_whShader+16
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2661
+JUMPV
+LABELV $2660
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492392
+INDIRI4
+ASGNI4
+LABELV $2661
+LABELV $2645
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $2642
+LABELV $2639
+LABELV $2635
+LABELV $2582
+LABELV $2580
+endproc CG_AddRefEntityWithPowerups 20 8
+proc CG_LoadAltTeamSkins 140 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_teamHeadSkin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2667
+ADDRGP4 cg_teamHeadSkin+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_GetModelAndSkinName
+CALLV
+pop
+ADDRLP4 64
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2671
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_teamHeadModel+16
+INDIRI1
+CVII4 1
+ADDRLP4 128
+INDIRI4
+EQI4 $2673
+ADDRFP4 4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+EQI4 $2673
+ADDRGP4 cg_teamHeadModel+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_GetModelName
+CALLV
+pop
+ADDRGP4 $2674
+JUMPV
+LABELV $2673
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2674
+LABELV $2671
+ADDRLP4 0
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $2677
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2679
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2682
+ADDRLP4 0
+ARGP4
+ADDRGP4 $303
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2680
+JUMPV
+LABELV $2682
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2684
+ADDRLP4 0
+ARGP4
+ADDRGP4 $302
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2680
+JUMPV
+LABELV $2684
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2680
+JUMPV
+LABELV $2679
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2680
+LABELV $2677
+ADDRGP4 $2686
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 952
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 952
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2687
+ADDRGP4 $2689
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 952
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2687
+LABELV $2667
+ADDRGP4 cg_teamTorsoSkin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2690
+ADDRGP4 cg_teamTorsoSkin+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_GetModelAndSkinName
+CALLV
+pop
+ADDRLP4 64
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2694
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_teamModel+16
+INDIRI1
+CVII4 1
+ADDRLP4 128
+INDIRI4
+EQI4 $2696
+ADDRFP4 4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+EQI4 $2696
+ADDRGP4 cg_teamModel+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_GetModelName
+CALLV
+pop
+ADDRGP4 $2697
+JUMPV
+LABELV $2696
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2697
+LABELV $2694
+ADDRLP4 0
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $2700
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2702
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2705
+ADDRLP4 0
+ARGP4
+ADDRGP4 $303
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2703
+JUMPV
+LABELV $2705
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2707
+ADDRLP4 0
+ARGP4
+ADDRGP4 $302
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2703
+JUMPV
+LABELV $2707
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2703
+JUMPV
+LABELV $2702
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2703
+LABELV $2700
+ADDRGP4 $2709
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 928
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 928
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2710
+ADDRGP4 $2712
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 928
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2710
+LABELV $2690
+ADDRGP4 cg_teamLegsSkin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2713
+ADDRGP4 cg_teamLegsSkin+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_GetModelAndSkinName
+CALLV
+pop
+ADDRLP4 64
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2717
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_teamModel+16
+INDIRI1
+CVII4 1
+ADDRLP4 128
+INDIRI4
+EQI4 $2719
+ADDRFP4 4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+EQI4 $2719
+ADDRGP4 cg_teamModel+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_GetModelName
+CALLV
+pop
+ADDRGP4 $2720
+JUMPV
+LABELV $2719
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2720
+LABELV $2717
+ADDRLP4 0
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $2723
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2725
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2728
+ADDRLP4 0
+ARGP4
+ADDRGP4 $303
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2726
+JUMPV
+LABELV $2728
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2730
+ADDRLP4 0
+ARGP4
+ADDRGP4 $302
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2726
+JUMPV
+LABELV $2730
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2726
+JUMPV
+LABELV $2725
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2726
+LABELV $2723
+ADDRGP4 $2732
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 908
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 908
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2733
+ADDRGP4 $2735
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 908
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2733
+LABELV $2713
+LABELV $2666
+endproc CG_LoadAltTeamSkins 140 12
+proc CG_LoadAltEnemySkins 140 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_enemyHeadSkin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2737
+ADDRGP4 cg_enemyHeadSkin+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_GetModelAndSkinName
+CALLV
+pop
+ADDRLP4 64
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2741
+ADDRGP4 cg_enemyHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2743
+ADDRGP4 cg_enemyHeadModel+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_GetModelName
+CALLV
+pop
+ADDRGP4 $2744
+JUMPV
+LABELV $2743
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2744
+LABELV $2741
+ADDRLP4 0
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $2747
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2749
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2752
+ADDRLP4 0
+ARGP4
+ADDRGP4 $303
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2750
+JUMPV
+LABELV $2752
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2754
+ADDRLP4 0
+ARGP4
+ADDRGP4 $302
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2750
+JUMPV
+LABELV $2754
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2750
+JUMPV
+LABELV $2749
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2750
+LABELV $2747
+ADDRGP4 $2686
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 956
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 956
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2756
+ADDRGP4 $2758
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 956
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2756
+LABELV $2737
+ADDRGP4 cg_enemyTorsoSkin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2759
+ADDRGP4 cg_enemyTorsoSkin+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_GetModelAndSkinName
+CALLV
+pop
+ADDRLP4 64
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2763
+ADDRGP4 cg_enemyModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2765
+ADDRGP4 cg_enemyModel+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_GetModelName
+CALLV
+pop
+ADDRGP4 $2766
+JUMPV
+LABELV $2765
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2766
+LABELV $2763
+ADDRLP4 0
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $2769
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2771
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2774
+ADDRLP4 0
+ARGP4
+ADDRGP4 $303
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2772
+JUMPV
+LABELV $2774
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2776
+ADDRLP4 0
+ARGP4
+ADDRGP4 $302
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2772
+JUMPV
+LABELV $2776
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2772
+JUMPV
+LABELV $2771
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2772
+LABELV $2769
+ADDRGP4 $2709
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 932
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 932
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2778
+ADDRGP4 $2780
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 932
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2778
+LABELV $2759
+ADDRGP4 cg_enemyLegsSkin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2781
+ADDRGP4 cg_enemyLegsSkin+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_GetModelAndSkinName
+CALLV
+pop
+ADDRLP4 64
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2785
+ADDRGP4 cg_enemyModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2787
+ADDRGP4 cg_enemyModel+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_GetModelName
+CALLV
+pop
+ADDRGP4 $2788
+JUMPV
+LABELV $2787
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2788
+LABELV $2785
+ADDRLP4 0
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $2791
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2793
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2796
+ADDRLP4 0
+ARGP4
+ADDRGP4 $303
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2794
+JUMPV
+LABELV $2796
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2798
+ADDRLP4 0
+ARGP4
+ADDRGP4 $302
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2794
+JUMPV
+LABELV $2798
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2794
+JUMPV
+LABELV $2793
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2794
+LABELV $2791
+ADDRGP4 $2732
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2800
+ADDRGP4 $2802
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2800
+LABELV $2781
+LABELV $2736
+endproc CG_LoadAltEnemySkins 140 12
+proc CG_LoadAltOurSkins 140 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_ourHeadSkin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2804
+ADDRGP4 cg_ourHeadSkin+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_GetModelAndSkinName
+CALLV
+pop
+ADDRLP4 64
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2808
+ADDRGP4 cg_ourHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2810
+ADDRGP4 cg_ourHeadModel+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_GetModelName
+CALLV
+pop
+ADDRGP4 $2811
+JUMPV
+LABELV $2810
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2811
+LABELV $2808
+ADDRLP4 0
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $2814
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2816
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2819
+ADDRLP4 0
+ARGP4
+ADDRGP4 $303
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2817
+JUMPV
+LABELV $2819
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2821
+ADDRLP4 0
+ARGP4
+ADDRGP4 $302
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2817
+JUMPV
+LABELV $2821
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2817
+JUMPV
+LABELV $2816
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2817
+LABELV $2814
+ADDRGP4 $2686
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 960
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 960
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2823
+ADDRGP4 $2825
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 960
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2823
+LABELV $2804
+ADDRGP4 cg_ourTorsoSkin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2826
+ADDRGP4 cg_ourTorsoSkin+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_GetModelAndSkinName
+CALLV
+pop
+ADDRLP4 64
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2830
+ADDRGP4 cg_ourModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2832
+ADDRGP4 cg_ourModel+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_GetModelName
+CALLV
+pop
+ADDRGP4 $2833
+JUMPV
+LABELV $2832
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2833
+LABELV $2830
+ADDRLP4 0
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $2836
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2838
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2841
+ADDRLP4 0
+ARGP4
+ADDRGP4 $303
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2839
+JUMPV
+LABELV $2841
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2843
+ADDRLP4 0
+ARGP4
+ADDRGP4 $302
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2839
+JUMPV
+LABELV $2843
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2839
+JUMPV
+LABELV $2838
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2839
+LABELV $2836
+ADDRGP4 $2709
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 936
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 936
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2845
+ADDRGP4 $2847
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 936
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2845
+LABELV $2826
+ADDRGP4 cg_ourLegsSkin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2848
+ADDRGP4 cg_ourLegsSkin+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_GetModelAndSkinName
+CALLV
+pop
+ADDRLP4 64
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2852
+ADDRGP4 cg_ourModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2854
+ADDRGP4 cg_ourModel+16
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_GetModelName
+CALLV
+pop
+ADDRGP4 $2855
+JUMPV
+LABELV $2854
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2855
+LABELV $2852
+ADDRLP4 0
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $2858
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2860
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2863
+ADDRLP4 0
+ARGP4
+ADDRGP4 $303
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2861
+JUMPV
+LABELV $2863
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2865
+ADDRLP4 0
+ARGP4
+ADDRGP4 $302
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2861
+JUMPV
+LABELV $2865
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2861
+JUMPV
+LABELV $2860
+ADDRLP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2861
+LABELV $2858
+ADDRGP4 $2732
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 916
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 916
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2867
+ADDRGP4 $2869
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 916
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2867
+LABELV $2848
+LABELV $2803
+endproc CG_LoadAltOurSkins 140 12
+data
+align 4
+LABELV $2956
+byte 4 -1
+align 4
+LABELV $2957
+byte 4 -1
+align 4
+LABELV $2958
+byte 4 -1
+align 4
+LABELV $2959
+byte 4 -1
+align 4
+LABELV $3062
+byte 4 -1
+align 4
+LABELV $3063
+byte 4 -1
+align 4
+LABELV $3064
+byte 4 -1
+align 4
+LABELV $3065
+byte 4 -1
+code
+proc CG_CheckForModelChange 192 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $2871
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2168
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2176
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2184
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $2871
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_clientOverrideIgnoreTeamSettings+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $2874
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2160
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $2874
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+CVPU4 4
+EQU4 $2879
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $2879
+ADDRFP4 4
+INDIRP4
+CNSTI4 2164
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2883
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2168
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $2883
+ADDRFP4 4
+INDIRP4
+CNSTI4 2172
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2885
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2176
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $2885
+ADDRFP4 4
+INDIRP4
+CNSTI4 2180
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2887
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2184
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $2887
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1496
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2893
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+EQI4 $2870
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+607704
+CVPU4 4
+EQU4 $2870
+LABELV $2893
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2870
+ADDRGP4 cg_deadBodyColor+16
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $2870
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg_deadBodyColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg_deadBodyColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg_deadBodyColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $2870
+JUMPV
+LABELV $2874
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $2897
+ADDRGP4 $2900
+JUMPV
+LABELV $2897
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2901
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $2903
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2903
+ADDRGP4 cg_freecam_useTeamSettings+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2903
+ADDRGP4 cg_forcePovModelIgnoreFreecamTeamSettings+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2903
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $2903
+ADDRGP4 cg_forcePovModel+12
+INDIRI4
+CNSTI4 2
+NEI4 $2909
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2909
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 cg+654892
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2914
+ADDRGP4 cg+686576
+INDIRI4
+CNSTI4 0
+EQI4 $2917
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2920
+ADDRFP4 4
+INDIRP4
+CNSTI4 924
+ADDP4
+ADDRGP4 cg+659416+924
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 904
+ADDP4
+ADDRGP4 cg+659416+904
+INDIRI4
+ASGNI4
+ADDRGP4 $2921
+JUMPV
+LABELV $2920
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2928
+ADDRFP4 4
+INDIRP4
+CNSTI4 924
+ADDP4
+ADDRGP4 cg+663940+924
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 904
+ADDP4
+ADDRGP4 cg+663940+904
+INDIRI4
+ASGNI4
+LABELV $2928
+LABELV $2921
+LABELV $2917
+ADDRGP4 cg+686580
+INDIRI4
+CNSTI4 0
+EQI4 $2936
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2939
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+659416+944
+INDIRI4
+ASGNI4
+ADDRGP4 $2940
+JUMPV
+LABELV $2939
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2945
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+663940+944
+INDIRI4
+ASGNI4
+LABELV $2945
+LABELV $2940
+LABELV $2936
+LABELV $2914
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686608
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686608+4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686608+8
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $2957
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+NEI4 $2964
+ADDRGP4 $2958
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+NEI4 $2964
+ADDRGP4 $2956
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+NEI4 $2964
+ADDRGP4 $2959
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+EQI4 $2960
+LABELV $2964
+ADDRGP4 $2957
+ADDRFP4 4
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2958
+ADDRFP4 4
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2956
+ADDRFP4 4
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2959
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+654892+960
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+936
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+916
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+908
+CNSTI4 0
+ASGNI4
+LABELV $2960
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_ourHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+NEI4 $2989
+ADDRGP4 cg_ourTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+NEI4 $2989
+ADDRGP4 cg_ourLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+EQI4 $2870
+LABELV $2989
+ADDRLP4 32
+ADDRGP4 cg+654892
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 960
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $2997
+ADDRGP4 cg_ourHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+NEI4 $2998
+LABELV $2997
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 936
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $2999
+ADDRGP4 cg_ourTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 40
+INDIRI4
+NEI4 $2998
+LABELV $2999
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 916
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $2991
+ADDRGP4 cg_ourLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+EQI4 $2991
+LABELV $2998
+ADDRLP4 48
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ASGNP4
+ADDRLP4 184
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 180
+ADDRLP4 184
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 184
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 116
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg_ourModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3001
+ADDRLP4 188
+CNSTI4 416
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $3001
+ADDRGP4 cg_ourHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3004
+ADDRLP4 188
+CNSTI4 544
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $3004
+ADDRLP4 188
+CNSTI4 196
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadAltOurSkins
+CALLV
+pop
+ADDRLP4 32
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRLP4 52
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 32
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRLP4 116
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 32
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+LABELV $2991
+ADDRLP4 48
+ADDRLP4 32
+INDIRP4
+CNSTI4 960
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $3007
+ADDRLP4 48
+INDIRI4
+CNSTI4 -1
+EQI4 $3007
+ADDRGP4 cg_ourHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+EQI4 $3007
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 960
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3007
+ADDRLP4 56
+ADDRLP4 32
+INDIRP4
+CNSTI4 936
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $3010
+ADDRLP4 56
+INDIRI4
+CNSTI4 -1
+EQI4 $3010
+ADDRGP4 cg_ourTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+EQI4 $3010
+ADDRFP4 4
+INDIRP4
+CNSTI4 924
+ADDP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 936
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3010
+ADDRLP4 64
+ADDRLP4 32
+INDIRP4
+CNSTI4 916
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $2870
+ADDRLP4 64
+INDIRI4
+CNSTI4 -1
+EQI4 $2870
+ADDRGP4 cg_ourLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 68
+INDIRI4
+EQI4 $2870
+ADDRFP4 4
+INDIRP4
+CNSTI4 904
+ADDP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 916
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2870
+JUMPV
+LABELV $2909
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_forcePovModel+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $3016
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $3016
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $3019
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596+4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596+8
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3028
+ADDRGP4 cg+659416
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3029
+JUMPV
+LABELV $3028
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3033
+ADDRGP4 cg+663940
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+LABELV $3033
+LABELV $3029
+ADDRGP4 cg+654892+940
+INDIRI4
+CNSTI4 0
+EQI4 $3038
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3042
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+659416+944
+INDIRI4
+ASGNI4
+ADDRGP4 $3043
+JUMPV
+LABELV $3042
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+663940+944
+INDIRI4
+ASGNI4
+LABELV $3043
+LABELV $3038
+ADDRGP4 cg_disallowEnemyModelForTeammates+12
+INDIRI4
+CNSTI4 0
+EQI4 $3050
+ADDRGP4 cg_disallowEnemyModelForTeammates+12
+INDIRI4
+CNSTI4 2
+EQI4 $3050
+ADDRFP4 4
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ADDRGP4 cg+627748+900
+INDIRI4
+NEI4 $3050
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $3056
+ADDRGP4 cg+672988
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3057
+JUMPV
+LABELV $3056
+ADDRGP4 cg+677512
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+LABELV $3057
+LABELV $3050
+ADDRGP4 $3063
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+NEI4 $3070
+ADDRGP4 $3064
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+NEI4 $3070
+ADDRGP4 $3062
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+NEI4 $3070
+ADDRGP4 $3065
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+EQI4 $3066
+LABELV $3070
+ADDRGP4 $3063
+ADDRFP4 4
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3064
+ADDRFP4 4
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3062
+ADDRFP4 4
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3065
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+654892+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+908
+CNSTI4 0
+ASGNI4
+LABELV $3066
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_teamHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 32
+INDIRI4
+NEI4 $3095
+ADDRGP4 cg_teamTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 32
+INDIRI4
+NEI4 $3095
+ADDRGP4 cg_teamLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 32
+INDIRI4
+EQI4 $2870
+LABELV $3095
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3096
+ADDRLP4 36
+ADDRGP4 cg+659416
+ASGNP4
+ADDRGP4 $3097
+JUMPV
+LABELV $3096
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3099
+ADDRLP4 36
+ADDRGP4 cg+663940
+ASGNP4
+ADDRGP4 $3100
+JUMPV
+LABELV $3099
+ADDRLP4 36
+ADDRGP4 cg+654892
+ASGNP4
+LABELV $3100
+LABELV $3097
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 952
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $3109
+ADDRGP4 cg_teamHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 40
+INDIRI4
+NEI4 $3110
+LABELV $3109
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 928
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $3111
+ADDRGP4 cg_teamTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+NEI4 $3110
+LABELV $3111
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 908
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $3103
+ADDRGP4 cg_teamLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 48
+INDIRI4
+EQI4 $3103
+LABELV $3110
+ADDRLP4 52
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ASGNP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 120
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $3113
+ADDRGP4 cg_fallbackModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3115
+ADDRLP4 36
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRGP4 cg+668464+416
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $3115
+ADDRGP4 cg_fallbackHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3114
+ADDRLP4 36
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRGP4 cg+668464+544
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $3114
+JUMPV
+LABELV $3113
+ADDRGP4 cg_ourModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3125
+ADDRLP4 184
+CNSTI4 416
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 184
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 184
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $3125
+ADDRGP4 cg_ourHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3128
+ADDRLP4 184
+CNSTI4 544
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 184
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 184
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $3128
+LABELV $3114
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_LoadAltTeamSkins
+CALLV
+pop
+ADDRLP4 36
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 36
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRLP4 120
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $3103
+ADDRLP4 52
+ADDRLP4 36
+INDIRP4
+CNSTI4 952
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $3131
+ADDRLP4 52
+INDIRI4
+CNSTI4 -1
+EQI4 $3131
+ADDRGP4 cg_teamHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 56
+INDIRI4
+EQI4 $3131
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 952
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3131
+ADDRLP4 60
+ADDRLP4 36
+INDIRP4
+CNSTI4 928
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $3134
+ADDRLP4 60
+INDIRI4
+CNSTI4 -1
+EQI4 $3134
+ADDRGP4 cg_teamTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 64
+INDIRI4
+EQI4 $3134
+ADDRFP4 4
+INDIRP4
+CNSTI4 924
+ADDP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 928
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3134
+ADDRLP4 68
+ADDRLP4 36
+INDIRP4
+CNSTI4 908
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $2870
+ADDRLP4 68
+INDIRI4
+CNSTI4 -1
+EQI4 $2870
+ADDRGP4 cg_teamLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 72
+INDIRI4
+EQI4 $2870
+ADDRFP4 4
+INDIRP4
+CNSTI4 904
+ADDP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 908
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2870
+JUMPV
+LABELV $3019
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 cg+654892
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 cg_disallowEnemyModelForTeammates+12
+INDIRI4
+CNSTI4 0
+EQI4 $2870
+ADDRGP4 cg_disallowEnemyModelForTeammates+12
+INDIRI4
+CNSTI4 2
+EQI4 $2870
+ADDRFP4 4
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ADDRGP4 cg+627748+900
+INDIRI4
+NEI4 $2870
+ADDRGP4 cg+668464
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $2870
+JUMPV
+LABELV $3016
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $3149
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $3149
+ADDRGP4 cg_freecam_useTeamSettings+12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $3149
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_teamModel+16
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+NEI4 $3158
+ADDRGP4 cg_teamHeadModel+16
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+EQI4 $3154
+LABELV $3158
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 cg+686560
+INDIRI4
+CNSTI4 0
+EQI4 $3160
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3163
+ADDRGP4 cg+645844
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3161
+JUMPV
+LABELV $3163
+ADDRGP4 cg+650368
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3161
+JUMPV
+LABELV $3160
+ADDRGP4 cg+641320
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+LABELV $3161
+ADDRGP4 cg+641320+940
+INDIRI4
+CNSTI4 0
+EQI4 $3170
+ADDRGP4 cg+686564
+INDIRI4
+CNSTI4 0
+EQI4 $3174
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3177
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+645844+944
+INDIRI4
+ASGNI4
+ADDRGP4 $3175
+JUMPV
+LABELV $3177
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+650368+944
+INDIRI4
+ASGNI4
+ADDRGP4 $3175
+JUMPV
+LABELV $3174
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+641320+944
+INDIRI4
+ASGNI4
+LABELV $3175
+LABELV $3170
+ADDRGP4 cg_disallowEnemyModelForTeammates+12
+INDIRI4
+CNSTI4 0
+EQI4 $3187
+ADDRGP4 cg_disallowEnemyModelForTeammates+12
+INDIRI4
+CNSTI4 2
+EQI4 $3187
+ADDRFP4 4
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ADDRGP4 cg+627748+900
+INDIRI4
+NEI4 $3187
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $3193
+ADDRGP4 cg+672988
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3194
+JUMPV
+LABELV $3193
+ADDRGP4 cg+677512
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+LABELV $3194
+LABELV $3187
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596+4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596+8
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $3155
+JUMPV
+LABELV $3154
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+LABELV $3155
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_teamHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 40
+INDIRI4
+NEI4 $3211
+ADDRGP4 cg_teamTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 40
+INDIRI4
+NEI4 $3211
+ADDRGP4 cg_teamLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 40
+INDIRI4
+EQI4 $2902
+LABELV $3211
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 952
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $3218
+ADDRGP4 cg_teamHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+NEI4 $3219
+LABELV $3218
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 928
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $3220
+ADDRGP4 cg_teamTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 48
+INDIRI4
+NEI4 $3219
+LABELV $3220
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 908
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+NEI4 $3212
+ADDRGP4 cg_teamLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+EQI4 $3212
+LABELV $3219
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $3221
+ADDRLP4 56
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 120
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg_fallbackModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3223
+ADDRFP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRGP4 cg+668464+416
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $3223
+ADDRGP4 cg_fallbackHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3228
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRGP4 cg+668464+544
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $3228
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_LoadAltTeamSkins
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRLP4 120
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $3222
+JUMPV
+LABELV $3221
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_LoadAltTeamSkins
+CALLV
+pop
+LABELV $3222
+LABELV $3212
+ADDRLP4 56
+ADDRFP4 4
+INDIRP4
+CNSTI4 952
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $3233
+ADDRLP4 56
+INDIRI4
+CNSTI4 -1
+EQI4 $3233
+ADDRGP4 cg_teamHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+EQI4 $3233
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 952
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3233
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+CNSTI4 928
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $3236
+ADDRLP4 64
+INDIRI4
+CNSTI4 -1
+EQI4 $3236
+ADDRGP4 cg_teamTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 68
+INDIRI4
+EQI4 $3236
+ADDRFP4 4
+INDIRP4
+CNSTI4 924
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 928
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3236
+ADDRLP4 72
+ADDRFP4 4
+INDIRP4
+CNSTI4 908
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+EQI4 $3239
+ADDRLP4 72
+INDIRI4
+CNSTI4 -1
+EQI4 $3239
+ADDRGP4 cg_teamLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 76
+INDIRI4
+EQI4 $3239
+ADDRFP4 4
+INDIRP4
+CNSTI4 904
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 908
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3239
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596+4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596+8
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $2902
+JUMPV
+LABELV $3149
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 cg_disallowEnemyModelForTeammates+12
+INDIRI4
+CNSTI4 0
+EQI4 $2902
+ADDRGP4 cg_disallowEnemyModelForTeammates+12
+INDIRI4
+CNSTI4 2
+EQI4 $2902
+ADDRFP4 4
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ADDRGP4 cg+627748+900
+INDIRI4
+NEI4 $2902
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $3254
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3257
+ADDRGP4 cg+672988
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $2902
+JUMPV
+LABELV $3257
+ADDRGP4 cg+677512
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $2902
+JUMPV
+LABELV $3254
+ADDRGP4 cg+668464
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $2902
+JUMPV
+LABELV $2901
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $3264
+ADDRGP4 EM_Loaded
+INDIRI4
+CNSTI4 1
+NEI4 $3266
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $3269
+ADDRGP4 cg+686568
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $3269
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3273
+ADDRGP4 cg+632272
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3270
+JUMPV
+LABELV $3273
+ADDRGP4 cg+636796
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3270
+JUMPV
+LABELV $3269
+ADDRGP4 cg+627748
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+LABELV $3270
+ADDRGP4 cg+627748+940
+INDIRI4
+CNSTI4 0
+EQI4 $3280
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $3284
+ADDRGP4 cg+686572
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $3284
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3288
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+632272+944
+INDIRI4
+ASGNI4
+ADDRGP4 $3285
+JUMPV
+LABELV $3288
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+636796+944
+INDIRI4
+ASGNI4
+ADDRGP4 $3285
+JUMPV
+LABELV $3284
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+627748+944
+INDIRI4
+ASGNI4
+LABELV $3285
+LABELV $3280
+ADDRGP4 cg_enemyHeadColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3298
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686584
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $3298
+ADDRGP4 cg_enemyTorsoColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3302
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686584+4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $3302
+ADDRGP4 cg_enemyLegsColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3267
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686584+8
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $3267
+JUMPV
+LABELV $3266
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+LABELV $3267
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_enemyHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 16
+INDIRI4
+NEI4 $3319
+ADDRGP4 cg_enemyTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 16
+INDIRI4
+NEI4 $3319
+ADDRGP4 cg_enemyLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 16
+INDIRI4
+EQI4 $3265
+LABELV $3319
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 956
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $3326
+ADDRGP4 cg_enemyHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+NEI4 $3327
+LABELV $3326
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 932
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $3328
+ADDRGP4 cg_enemyTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+NEI4 $3327
+LABELV $3328
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 912
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $3320
+ADDRGP4 cg_enemyLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+EQI4 $3320
+LABELV $3327
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadAltEnemySkins
+CALLV
+pop
+LABELV $3320
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 956
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $3329
+ADDRLP4 32
+INDIRI4
+CNSTI4 -1
+EQI4 $3329
+ADDRGP4 cg_enemyHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+EQI4 $3329
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 956
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3329
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+CNSTI4 932
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $3332
+ADDRLP4 40
+INDIRI4
+CNSTI4 -1
+EQI4 $3332
+ADDRGP4 cg_enemyTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+EQI4 $3332
+ADDRFP4 4
+INDIRP4
+CNSTI4 924
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 932
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3332
+ADDRLP4 48
+ADDRFP4 4
+INDIRP4
+CNSTI4 912
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $3335
+ADDRLP4 48
+INDIRI4
+CNSTI4 -1
+EQI4 $3335
+ADDRGP4 cg_enemyLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+EQI4 $3335
+ADDRFP4 4
+INDIRP4
+CNSTI4 904
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 912
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3335
+ADDRGP4 cg_enemyHeadColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3338
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686584
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $3338
+ADDRGP4 cg_enemyTorsoColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3342
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686584+4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $3342
+ADDRGP4 cg_enemyLegsColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3265
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686584+8
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $3265
+JUMPV
+LABELV $3264
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3352
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_teamModel+16
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+NEI4 $3358
+ADDRGP4 cg_teamHeadModel+16
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $3354
+LABELV $3358
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 cg+686560
+INDIRI4
+CNSTI4 0
+EQI4 $3360
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3363
+ADDRGP4 cg+645844
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3361
+JUMPV
+LABELV $3363
+ADDRGP4 cg+650368
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3361
+JUMPV
+LABELV $3360
+ADDRGP4 cg+641320
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+LABELV $3361
+ADDRGP4 cg+641320+940
+INDIRI4
+CNSTI4 0
+EQI4 $3370
+ADDRGP4 cg+686564
+INDIRI4
+CNSTI4 0
+EQI4 $3374
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3377
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+645844+944
+INDIRI4
+ASGNI4
+ADDRGP4 $3375
+JUMPV
+LABELV $3377
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+650368+944
+INDIRI4
+ASGNI4
+ADDRGP4 $3375
+JUMPV
+LABELV $3374
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRGP4 cg+641320+944
+INDIRI4
+ASGNI4
+LABELV $3375
+LABELV $3370
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+641320+900
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $3387
+ADDRGP4 cg+627748+900
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $3387
+ADDRGP4 cg+668464+900
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $3387
+ADDRGP4 cg_disallowEnemyModelForTeammates+12
+INDIRI4
+CNSTI4 0
+EQI4 $3395
+ADDRFP4 4
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ADDRGP4 cg+627748+900
+INDIRI4
+NEI4 $3395
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3402
+ADDRGP4 cg+672988
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3401
+JUMPV
+LABELV $3402
+ADDRGP4 cg+677512
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3401
+JUMPV
+LABELV $3400
+ADDRGP4 cg+668464
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+LABELV $3401
+LABELV $3395
+LABELV $3387
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596+4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596+8
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $3355
+JUMPV
+LABELV $3354
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596+4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596+8
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627748+900
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $3419
+ADDRGP4 cg+668464+900
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $3419
+ADDRGP4 cg_disallowEnemyModelForTeammates+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $3419
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+900
+ADDP4
+INDIRI4
+ADDRGP4 cg+627748+900
+INDIRI4
+NEI4 $3419
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3433
+ADDRGP4 cg+672988
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3420
+JUMPV
+LABELV $3433
+ADDRGP4 cg+677512
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3420
+JUMPV
+LABELV $3431
+ADDRGP4 cg+668464
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3420
+JUMPV
+LABELV $3419
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+LABELV $3420
+LABELV $3355
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_teamHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+NEI4 $3447
+ADDRGP4 cg_teamTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+NEI4 $3447
+ADDRGP4 cg_teamLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $3441
+LABELV $3447
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 952
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $3454
+ADDRGP4 cg_teamHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+NEI4 $3455
+LABELV $3454
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 928
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $3456
+ADDRGP4 cg_teamTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 32
+INDIRI4
+NEI4 $3455
+LABELV $3456
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 908
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $3448
+ADDRGP4 cg_teamLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+EQI4 $3448
+LABELV $3455
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $3457
+ADDRLP4 40
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 104
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg_fallbackModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3459
+ADDRFP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRGP4 cg+668464+416
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $3459
+ADDRGP4 cg_fallbackHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3464
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRGP4 cg+668464+544
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $3464
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_LoadAltTeamSkins
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $3458
+JUMPV
+LABELV $3457
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_LoadAltTeamSkins
+CALLV
+pop
+LABELV $3458
+LABELV $3448
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+CNSTI4 952
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $3469
+ADDRLP4 40
+INDIRI4
+CNSTI4 -1
+EQI4 $3469
+ADDRGP4 cg_teamHeadSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+EQI4 $3469
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 952
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3469
+ADDRLP4 48
+ADDRFP4 4
+INDIRP4
+CNSTI4 928
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $3472
+ADDRLP4 48
+INDIRI4
+CNSTI4 -1
+EQI4 $3472
+ADDRGP4 cg_teamTorsoSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+EQI4 $3472
+ADDRFP4 4
+INDIRP4
+CNSTI4 924
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 928
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3472
+ADDRLP4 56
+ADDRFP4 4
+INDIRP4
+CNSTI4 908
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $3475
+ADDRLP4 56
+INDIRI4
+CNSTI4 -1
+EQI4 $3475
+ADDRGP4 cg_teamLegsSkin+16
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+EQI4 $3475
+ADDRFP4 4
+INDIRP4
+CNSTI4 904
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 908
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3475
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596+4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg+686596+8
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $3441
+LABELV $3352
+LABELV $3265
+LABELV $2902
+LABELV $2900
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+607704
+CVPU4 4
+NEU4 $3483
+LABELV $3483
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_playerModelAllowServerOverride+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $3486
+ADDRGP4 cgs+1957608
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+NEI4 $3491
+ADDRGP4 cgs+1957672
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $3486
+LABELV $3491
+ADDRFP4 4
+INDIRP4
+CNSTI4 2160
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3492
+ADDRGP4 $2870
+JUMPV
+LABELV $3492
+ADDRGP4 cg+682036
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+682036+900
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $3495
+ADDRGP4 cg+682036+940
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $3495
+ADDRGP4 cgs+1957740
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $3495
+ADDRFP4 4
+INDIRP4
+CNSTI4 940
+ADDP4
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+964
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 944
+ADDP4
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048+968
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3495
+LABELV $3486
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1496
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $3510
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+EQI4 $3506
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+607704
+CVPU4 4
+EQU4 $3506
+LABELV $3510
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $3511
+ADDRGP4 cg_deadBodyColor+16
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+EQI4 $3511
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg_deadBodyColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg_deadBodyColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg_deadBodyColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $3511
+LABELV $3506
+ADDRFP4 4
+INDIRP4
+CNSTI4 2160
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3514
+ADDRGP4 $2870
+JUMPV
+LABELV $3514
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $3516
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3516
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1960920
+INDIRI4
+CNSTI4 67108864
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $3516
+ADDRGP4 cg_playerModelAllowServerOverride+12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $3516
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3522
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ARGP4
+ADDRGP4 $3526
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $3524
+ADDRGP4 cgs+1965448
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $3525
+JUMPV
+LABELV $3524
+ADDRGP4 cgs+1960924
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+LABELV $3525
+ADDRFP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492304
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492304
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492304
+INDIRI4
+ASGNI4
+LABELV $3522
+LABELV $3516
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $3535
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $3535
+ADDRGP4 cg_racePlayerShader+12
+INDIRI4
+CNSTI4 0
+EQI4 $3536
+ADDRFP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+1317380
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+1317380
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+1317380
+INDIRI4
+ASGNI4
+ADDRGP4 $3536
+JUMPV
+LABELV $3535
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $3547
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $3547
+ADDRGP4 cg_racePlayerShader+12
+INDIRI4
+CNSTI4 2
+EQI4 $3554
+ADDRGP4 cg_racePlayerShader+12
+INDIRI4
+CNSTI4 4
+NEI4 $3550
+LABELV $3554
+ADDRFP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+1317380
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+1317380
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+1317380
+INDIRI4
+ASGNI4
+LABELV $3550
+LABELV $3547
+LABELV $3536
+LABELV $2870
+endproc CG_CheckForModelChange 192 12
+export CG_Player
+proc CG_Player 5572 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $3562
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+GEI4 $3562
+ADDRLP4 5452
+CNSTI4 184
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 5452
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $3562
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $3562
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 5452
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 5456
+ADDRGP4 CG_FreezeTagFrozen
+CALLI4
+ASGNI4
+ADDRLP4 5456
+INDIRI4
+CNSTI4 0
+NEI4 $3562
+ADDRGP4 $3561
+JUMPV
+LABELV $3562
+ADDRGP4 cg+1335116
+INDIRI4
+CNSTI4 0
+EQI4 $3568
+ADDRFP4 0
+INDIRP4
+CNSTI4 1152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1164
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1168
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 928
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 932
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 968
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1168
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 972
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 976
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 980
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $3568
+ADDRLP4 868
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 0
+LTI4 $3571
+ADDRLP4 868
+INDIRI4
+CNSTI4 64
+GEI4 $3571
+ADDRLP4 5464
+CNSTI4 2392
+ADDRLP4 868
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $3573
+CNSTI4 2392
+ADDRLP4 868
+INDIRI4
+MULI4
+ADDRGP4 wclients+2360
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+CNSTI4 2392
+ADDRLP4 868
+INDIRI4
+MULI4
+ADDRGP4 wclients+2364
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3574
+JUMPV
+LABELV $3573
+ADDRLP4 5468
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_perKillStatsClearNotFiringTime+12
+INDIRI4
+ADDRLP4 5468
+INDIRI4
+EQI4 $3578
+ADDRLP4 5472
+CNSTI4 2392
+ADDRLP4 868
+INDIRI4
+MULI4
+ASGNI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 5472
+INDIRI4
+ADDRGP4 wclients+2360
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg_perKillStatsClearNotFiringTime+12
+INDIRI4
+LEI4 $3578
+ADDRLP4 5472
+INDIRI4
+ADDRGP4 wclients+2364
+ADDP4
+INDIRI4
+ADDRLP4 5468
+INDIRI4
+NEI4 $3578
+ADDRGP4 cg_perKillStatsClearNotFiringExcludeSingleClickWeapons+12
+INDIRI4
+CNSTI4 0
+EQI4 $3585
+ADDRLP4 868
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3588
+LABELV $3588
+ADDRLP4 5464
+INDIRP4
+CNSTI4 1348
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 36
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 5464
+INDIRP4
+CNSTI4 1492
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 36
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 5464
+INDIRP4
+CNSTI4 1564
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 36
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $3586
+JUMPV
+LABELV $3585
+CNSTI4 2392
+ADDRLP4 868
+INDIRI4
+MULI4
+ADDRGP4 wclients+1276
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 540
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $3586
+CNSTI4 2392
+ADDRLP4 868
+INDIRI4
+MULI4
+ADDRGP4 wclients+2364
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 868
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3594
+LABELV $3594
+LABELV $3578
+LABELV $3574
+ADDRLP4 5468
+CNSTI4 0
+ASGNI4
+CNSTI4 2392
+ADDRLP4 868
+INDIRI4
+MULI4
+ADDRGP4 wclients+2356
+ADDP4
+INDIRI4
+ADDRLP4 5468
+INDIRI4
+EQI4 $3597
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 5468
+INDIRI4
+NEI4 $3597
+ADDRGP4 cg_perKillStatsExcludePostKillSpam+12
+INDIRI4
+CNSTI4 0
+EQI4 $3600
+CNSTI4 2392
+ADDRLP4 868
+INDIRI4
+MULI4
+ADDRGP4 wclients+1276
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 540
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $3600
+CNSTI4 2392
+ADDRLP4 868
+INDIRI4
+MULI4
+ADDRGP4 wclients+2356
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 868
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3606
+LABELV $3606
+LABELV $3597
+LABELV $3571
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+607704
+CVPU4 4
+NEU4 $3609
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3610
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+3883048
+ADDP4
+ARGP4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $3610
+JUMPV
+LABELV $3609
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1496
+DIVI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3618
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1496
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+3883048
+ADDP4
+ARGP4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $3618
+LABELV $3610
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $3622
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 5
+GTI4 $3622
+LABELV $3622
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3624
+LABELV $3624
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $3626
+ADDRGP4 $3561
+JUMPV
+LABELV $3626
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+4
+INDIRI4
+NEI4 $3629
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3629
+ADDRGP4 $3561
+JUMPV
+LABELV $3629
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+NEI4 $3633
+ADDRLP4 5472
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ADDRLP4 5472
+INDIRI4
+NEI4 $3633
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 5472
+INDIRI4
+NEI4 $3633
+LABELV $3633
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+EQI4 $3635
+LABELV $3635
+ADDRLP4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 0
+LTI4 $3639
+ADDRLP4 868
+INDIRI4
+CNSTI4 64
+LTI4 $3637
+LABELV $3639
+ADDRGP4 $3640
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $3637
+ADDRLP4 924
+ARGP4
+CNSTI4 4524
+ADDRLP4 868
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 4524
+ADDRLP4 868
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $3643
+ADDRGP4 $3561
+JUMPV
+LABELV $3643
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $3645
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+NEI4 $3561
+LABELV $3648
+LABELV $3645
+ADDRLP4 176
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 520
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 520
+ARGP4
+ADDRGP4 CG_CheckForModelChange
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $3650
+ADDRGP4 $3561
+JUMPV
+LABELV $3650
+ADDRLP4 5484
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 5484
+INDIRI4
+NEI4 $3652
+ADDRLP4 868
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3652
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 5484
+INDIRI4
+GTI4 $3652
+ADDRGP4 cg_deathShowOwnCorpse+12
+INDIRI4
+ADDRLP4 5484
+INDIRI4
+NEI4 $3652
+ADDRGP4 $3561
+JUMPV
+LABELV $3652
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3657
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3659
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $3659
+ADDRGP4 $3561
+JUMPV
+LABELV $3659
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $3662
+ADDRLP4 868
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3662
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3662
+LABELV $3662
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $3667
+ADDRGP4 $3561
+JUMPV
+LABELV $3667
+LABELV $3657
+ADDRLP4 872
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3669
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $3672
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $3672
+ADDRGP4 $3561
+JUMPV
+LABELV $3672
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 5488
+ADDRGP4 CG_IsFirstPersonView
+CALLI4
+ASGNI4
+ADDRLP4 5488
+INDIRI4
+CNSTI4 0
+EQI4 $3676
+ADDRLP4 872
+CNSTI4 2
+ASGNI4
+ADDRGP4 $3677
+JUMPV
+LABELV $3676
+ADDRGP4 cg_cameraMode+12
+INDIRI4
+CNSTI4 0
+EQI4 $3679
+ADDRGP4 $3561
+JUMPV
+LABELV $3679
+LABELV $3677
+LABELV $3669
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176+28
+ARGP4
+ADDRLP4 4+28
+ARGP4
+ADDRLP4 520+28
+ARGP4
+ADDRGP4 CG_PlayerAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176+96
+ARGP4
+ADDRLP4 176+80
+ARGP4
+ADDRLP4 176+100
+ARGP4
+ADDRLP4 4+96
+ARGP4
+ADDRLP4 4+80
+ARGP4
+ADDRLP4 4+100
+ARGP4
+ADDRGP4 CG_PlayerAnimation
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerSprites
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 904
+ARGP4
+ADDRLP4 5488
+ADDRGP4 CG_PlayerShadow
+CALLI4
+ASGNI4
+ADDRLP4 920
+ADDRLP4 5488
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3691
+ADDRLP4 5492
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1960920
+INDIRI4
+CNSTI4 67108864
+BANDI4
+ADDRLP4 5492
+INDIRI4
+EQI4 $3691
+ADDRGP4 cg_allowServerOverride+12
+INDIRI4
+ADDRLP4 5492
+INDIRI4
+EQI4 $3691
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3696
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 cgs+632912+493624
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddLoopingSound
+CALLV
+pop
+LABELV $3696
+LABELV $3691
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerSplash
+CALLV
+pop
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 3
+NEI4 $3702
+ADDRLP4 920
+INDIRI4
+CNSTI4 0
+EQI4 $3702
+ADDRGP4 $2468
+ARGP4
+ADDRLP4 5496
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 5496
+INDIRI4
+CNSTI4 0
+NEI4 $3702
+ADDRLP4 872
+ADDRLP4 872
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $3702
+ADDRLP4 872
+ADDRLP4 872
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $3705
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 872
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerTokens
+CALLV
+pop
+LABELV $3705
+ADDRLP4 176+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176+108
+ADDRLP4 0
+INDIRP4
+CNSTI4 904
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 692
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 cg_playerModelAutoScaleHeight+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3711
+ADDRLP4 692
+CNSTF4 1065353216
+ADDRGP4 cg_playerModelAutoScaleHeight+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 3472
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $3711
+ADDRLP4 0
+INDIRP4
+CNSTI4 2220
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3715
+ADDRLP4 692
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 2244
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 3472
+ADDP4
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $3715
+ADDRGP4 cg_playerModelAllowServerScale+12
+INDIRI4
+CNSTI4 0
+EQI4 $3717
+ADDRGP4 cgs+1957736
+INDIRI4
+CNSTI4 0
+EQI4 $3720
+ADDRLP4 692
+ADDRLP4 692
+INDIRF4
+ADDRGP4 cgs+1957592
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3721
+JUMPV
+LABELV $3720
+ADDRLP4 692
+ADDRLP4 692
+INDIRF4
+ADDRGP4 cg_playerModelAllowServerScaleDefault+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3721
+LABELV $3717
+ADDRLP4 5504
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2200
+ADDP4
+INDIRI4
+ADDRLP4 5504
+INDIRI4
+NEI4 $3727
+ADDRLP4 0
+INDIRP4
+CNSTI4 2204
+ADDP4
+INDIRI4
+ADDRLP4 5504
+INDIRI4
+EQI4 $3725
+LABELV $3727
+ADDRLP4 0
+INDIRP4
+CNSTI4 2200
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3728
+ADDRLP4 692
+ADDRLP4 692
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3728
+ADDRLP4 0
+INDIRP4
+CNSTI4 2204
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3726
+ADDRLP4 692
+ADDRLP4 692
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3726
+JUMPV
+LABELV $3725
+ADDRGP4 cg_playerModelForceScale+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3732
+ADDRGP4 cg_playerModelForceScale+8
+INDIRF4
+CNSTF4 0
+LEF4 $3732
+ADDRLP4 692
+ADDRLP4 692
+INDIRF4
+ADDRGP4 cg_playerModelForceScale+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3732
+ADDRGP4 cg_playerModelForceLegsScale+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3737
+ADDRGP4 cg_playerModelForceLegsScale+8
+INDIRF4
+CNSTF4 0
+LEF4 $3737
+ADDRLP4 692
+ADDRLP4 692
+INDIRF4
+ADDRGP4 cg_playerModelForceLegsScale+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3737
+LABELV $3726
+ADDRLP4 692
+INDIRF4
+CNSTF4 0
+GTF4 $3742
+ADDRLP4 692
+CNSTF4 1065353216
+ASGNF4
+LABELV $3742
+ADDRLP4 692
+INDIRF4
+CNSTF4 1065353216
+EQF4 $3744
+ADDRLP4 176
+ARGP4
+ADDRLP4 692
+INDIRF4
+ARGF4
+ADDRGP4 CG_ScaleModel
+CALLV
+pop
+ADDRGP4 bg_playerMins+8
+INDIRF4
+ARGF4
+ADDRLP4 5512
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 5508
+ADDRLP4 5512
+INDIRF4
+ASGNF4
+ADDRLP4 176+68+8
+ADDRLP4 176+68+8
+INDIRF4
+ADDRLP4 5508
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 176+68+8
+ADDRLP4 176+68+8
+INDIRF4
+ADDRLP4 5508
+INDIRF4
+ADDRLP4 692
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3744
+ADDRLP4 176+12
+ADDRLP4 176+68
+INDIRB
+ASGNB 12
+ADDRLP4 176+24
+ADDRLP4 904
+INDIRF4
+ASGNF4
+ADDRLP4 176+4
+ADDRLP4 872
+INDIRI4
+ASGNI4
+ADDRLP4 176+84
+ADDRLP4 176+68
+INDIRB
+ASGNB 12
+ADDRGP4 EffectScripts+3801448
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3757
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+636
+ADDRLP4 176+80
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 ScriptVars+120
+ADDRLP4 176+28
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+120+12
+ADDRLP4 176+28+12
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+120+24
+ADDRLP4 176+28+24
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+60
+ADDRLP4 176+68
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7772
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRFP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7788
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 EffectScripts+3801448
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+LABELV $3757
+ADDRLP4 176
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1492
+ADDP4
+INDIRF4
+GEF4 $3783
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3783
+ADDRLP4 176+112
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $3783
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Wolfcam_AddBoundingBox
+CALLV
+pop
+ADDRLP4 176+8
+INDIRI4
+CNSTI4 0
+NEI4 $3787
+ADDRGP4 $3561
+JUMPV
+LABELV $3787
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4+8
+INDIRI4
+CNSTI4 0
+NEI4 $3791
+ADDRGP4 $3561
+JUMPV
+LABELV $3791
+ADDRLP4 4+108
+ADDRLP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4+12
+ADDRLP4 176+68
+INDIRB
+ASGNB 12
+ADDRLP4 692
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2208
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3797
+ADDRLP4 692
+ADDRLP4 0
+INDIRP4
+CNSTI4 2232
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $3798
+JUMPV
+LABELV $3797
+ADDRGP4 cg_playerModelForceTorsoScale+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3799
+ADDRGP4 cg_playerModelForceTorsoScale+8
+INDIRF4
+CNSTF4 0
+LEF4 $3799
+ADDRLP4 692
+ADDRGP4 cg_playerModelForceTorsoScale+8
+INDIRF4
+ASGNF4
+LABELV $3799
+LABELV $3798
+ADDRLP4 692
+INDIRF4
+CNSTF4 0
+GTF4 $3804
+ADDRLP4 692
+CNSTF4 1065353216
+ASGNF4
+LABELV $3804
+ADDRLP4 692
+INDIRF4
+CNSTF4 1065353216
+EQF4 $3806
+ADDRLP4 4
+ARGP4
+ADDRLP4 692
+INDIRF4
+ARGF4
+ADDRGP4 CG_ScaleModel
+CALLV
+pop
+LABELV $3806
+ADDRLP4 4
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $456
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 4+24
+ADDRLP4 904
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 872
+INDIRI4
+ASGNI4
+ADDRGP4 EffectScripts+3768680
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3810
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+636
+ADDRLP4 4+80
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 ScriptVars+120
+ADDRLP4 4+28
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+120+12
+ADDRLP4 4+28+12
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+120+24
+ADDRLP4 4+28+24
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+60
+ADDRLP4 4+68
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7772
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7788
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 EffectScripts+3768680
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+LABELV $3810
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1492
+ADDP4
+INDIRF4
+GEF4 $3836
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3836
+ADDRLP4 4+112
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $3836
+ADDRGP4 cg_inheritPowerupShader+12
+INDIRI4
+CNSTI4 0
+NEI4 $3840
+ADDRLP4 4+112
+CNSTI4 0
+ASGNI4
+LABELV $3840
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $3844
+ADDRLP4 696
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 696+12
+ADDRLP4 176+68
+INDIRB
+ASGNB 12
+ADDRLP4 696+24
+ADDRLP4 904
+INDIRF4
+ASGNF4
+ADDRLP4 696+4
+ADDRLP4 872
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3850
+ADDRLP4 5516
+CNSTF4 1086918619
+ASGNF4
+ADDRLP4 888
+ADDRLP4 5516
+INDIRF4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 7
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+ADDRLP4 5516
+INDIRF4
+LEF4 $3853
+ADDRLP4 888
+ADDRLP4 888
+INDIRF4
+CNSTF4 1086918619
+SUBF4
+ASGNF4
+LABELV $3853
+ADDRLP4 888
+INDIRF4
+ARGF4
+ADDRLP4 5520
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 876
+CNSTF4 1101004800
+ADDRLP4 5520
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+ARGF4
+ADDRLP4 5524
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 876+4
+CNSTF4 1101004800
+ADDRLP4 5524
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 888
+CNSTF4 1086918619
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 4
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+ARGF4
+ADDRLP4 5528
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 876+8
+CNSTF4 1090519040
+ADDRLP4 5528
+INDIRF4
+MULF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+ADDRLP4 696+68
+ADDRLP4 4+68
+INDIRF4
+ADDRLP4 876
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 696+68+4
+ADDRLP4 4+68+4
+INDIRF4
+ADDRLP4 876+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 696+68+8
+ADDRLP4 4+68+8
+INDIRF4
+ADDRLP4 876+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 876+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 696+28+12
+ADDRLP4 876
+INDIRB
+ASGNB 12
+ADDRLP4 696+28+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 696+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 696+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 696+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 696+28+12
+ARGP4
+ADDRLP4 696+28+24
+ARGP4
+ADDRLP4 696+28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 696+8
+ADDRGP4 cgs+632912+492404
+INDIRI4
+ASGNI4
+ADDRLP4 696
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 696+8
+ADDRGP4 cgs+632912+492408
+INDIRI4
+ASGNI4
+ADDRLP4 696
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 $3851
+JUMPV
+LABELV $3850
+ADDRLP4 888
+CNSTF4 1086918619
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 4
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+ARGF4
+ADDRLP4 5516
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 876
+CNSTF4 1101004800
+ADDRLP4 5516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+ARGF4
+ADDRLP4 5520
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 876+4
+CNSTF4 1101004800
+ADDRLP4 5520
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+ARGF4
+ADDRLP4 5524
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 876+8
+CNSTF4 1101004800
+ADDRLP4 5524
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 696+68
+ADDRLP4 4+68
+INDIRF4
+ADDRLP4 876
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 696+68+4
+ADDRLP4 4+68+4
+INDIRF4
+ADDRLP4 876+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 696+68+8
+ADDRLP4 4+68+8
+INDIRF4
+ADDRLP4 876+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+ARGF4
+ADDRLP4 5528
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 892
+CNSTF4 1106247680
+ADDRLP4 5528
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 892+4
+CNSTF4 1127481344
+ADDRLP4 888
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 892+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $3910
+ADDRLP4 892+4
+ADDRLP4 892+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $3910
+ADDRLP4 892+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 892
+ARGP4
+ADDRLP4 696+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 696+8
+ADDRGP4 cgs+632912+492404
+INDIRI4
+ASGNI4
+ADDRLP4 696
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 696+28+12
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+ADDRLP4 696+8
+ADDRGP4 cgs+632912+492408
+INDIRI4
+ASGNI4
+ADDRLP4 696
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 5532
+CNSTF4 1086918619
+ASGNF4
+ADDRLP4 888
+ADDRLP4 5532
+INDIRF4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 4
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+CNSTF4 1078530011
+ADDF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+ADDRLP4 5532
+INDIRF4
+LEF4 $3925
+ADDRLP4 888
+ADDRLP4 888
+INDIRF4
+CNSTF4 1086918619
+SUBF4
+ASGNF4
+LABELV $3925
+ADDRLP4 888
+INDIRF4
+ARGF4
+ADDRLP4 5536
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 876
+CNSTF4 1101004800
+ADDRLP4 5536
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+ARGF4
+ADDRLP4 5540
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 876+4
+CNSTF4 1101004800
+ADDRLP4 5540
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+ARGF4
+ADDRLP4 5544
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 876+8
+CNSTF4 1101004800
+ADDRLP4 5544
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 696+68
+ADDRLP4 4+68
+INDIRF4
+ADDRLP4 876
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 696+68+4
+ADDRLP4 4+68+4
+INDIRF4
+ADDRLP4 876+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 696+68+8
+ADDRLP4 4+68+8
+INDIRF4
+ADDRLP4 876+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+CNSTF4 1070141403
+SUBF4
+ARGF4
+ADDRLP4 5548
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 892
+CNSTF4 1106247680
+ADDRLP4 5548
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 892+4
+CNSTF4 1135869952
+CNSTF4 1127481344
+ADDRLP4 888
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 892+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $3942
+ADDRLP4 892+4
+ADDRLP4 892+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $3942
+ADDRLP4 892+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 892
+ARGP4
+ADDRLP4 696+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 696+8
+ADDRGP4 cgs+632912+492404
+INDIRI4
+ASGNI4
+ADDRLP4 696
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 696+8
+ADDRGP4 cgs+632912+492408
+INDIRI4
+ASGNI4
+ADDRLP4 696
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 5552
+CNSTF4 1086918619
+ASGNF4
+ADDRLP4 888
+ADDRLP4 5552
+INDIRF4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 3
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+CNSTF4 1070141403
+ADDF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+ADDRLP4 5552
+INDIRF4
+LEF4 $3955
+ADDRLP4 888
+ADDRLP4 888
+INDIRF4
+CNSTF4 1086918619
+SUBF4
+ASGNF4
+LABELV $3955
+ADDRLP4 888
+INDIRF4
+ARGF4
+ADDRLP4 5556
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 876
+CNSTF4 1101004800
+ADDRLP4 5556
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 888
+INDIRF4
+ARGF4
+ADDRLP4 5560
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 876+4
+CNSTF4 1101004800
+ADDRLP4 5560
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 876+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 696+68
+ADDRLP4 4+68
+INDIRF4
+ADDRLP4 876
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 696+68+4
+ADDRLP4 4+68+4
+INDIRF4
+ADDRLP4 876+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 696+68+8
+ADDRLP4 4+68+8
+INDIRF4
+ADDRLP4 876+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 696+28+12
+ADDRLP4 876
+INDIRB
+ASGNB 12
+ADDRLP4 696+28+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 696+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 696+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 696+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 696+28+12
+ARGP4
+ADDRLP4 696+28+24
+ARGP4
+ADDRLP4 696+28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 696+8
+ADDRGP4 cgs+632912+492404
+INDIRI4
+ASGNI4
+ADDRLP4 696
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 696+8
+ADDRGP4 cgs+632912+492408
+INDIRI4
+ASGNI4
+ADDRLP4 696
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $3851
+LABELV $3844
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_GUARD
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $3994
+ADDRLP4 348
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTU4 172
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 348+8
+ADDRGP4 cgs+632912+492412
+INDIRI4
+ASGNI4
+ADDRLP4 348+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 348
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $3994
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_SCOUT
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $4002
+ADDRLP4 348
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTU4 172
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 348+8
+ADDRGP4 cgs+632912+492416
+INDIRI4
+ASGNI4
+ADDRLP4 348+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 348
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $4002
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_DOUBLER
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $4010
+ADDRLP4 348
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTU4 172
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 348+8
+ADDRGP4 cgs+632912+492420
+INDIRI4
+ASGNI4
+ADDRLP4 348+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 348
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $4010
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_ARMORREGEN
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $4018
+ADDRLP4 348
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTU4 172
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 348+8
+ADDRGP4 cgs+632912+492424
+INDIRI4
+ASGNI4
+ADDRLP4 348+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 348
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $4018
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_INVULNERABILITY
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $4026
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4028
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $4028
+ADDRLP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $4027
+JUMPV
+LABELV $4026
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4027
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_INVULNERABILITY
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $4035
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 250
+GEI4 $4032
+LABELV $4035
+ADDRLP4 348
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTU4 172
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 348+8
+ADDRGP4 cgs+632912+492448
+INDIRI4
+ASGNI4
+ADDRLP4 348+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+4
+ADDRLP4 348+4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 348+68
+ADDRLP4 176+68
+INDIRB
+ASGNB 12
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 250
+GEI4 $4045
+ADDRLP4 916
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1132068864
+DIVF4
+ASGNF4
+ADDRGP4 $4046
+JUMPV
+LABELV $4045
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 250
+GEI4 $4049
+ADDRLP4 916
+CNSTI4 250
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CVIF4 4
+CNSTF4 1132068864
+DIVF4
+ASGNF4
+ADDRGP4 $4050
+JUMPV
+LABELV $4049
+ADDRLP4 916
+CNSTF4 1065353216
+ASGNF4
+LABELV $4050
+LABELV $4046
+ADDRLP4 348+28
+ADDRLP4 916
+INDIRF4
+ASGNF4
+ADDRLP4 348+28+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 348+28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 348+28+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 348+28+12+4
+ADDRLP4 916
+INDIRF4
+ASGNF4
+ADDRLP4 348+28+12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 348+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 348+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 348+28+24+8
+ADDRLP4 916
+INDIRF4
+ASGNF4
+ADDRLP4 348
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $4032
+ADDRLP4 912
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4075
+ADDRLP4 912
+INDIRI4
+CNSTI4 500
+GEI4 $4075
+ADDRLP4 348
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTU4 172
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 348+8
+ADDRGP4 cgs+632912+492436
+INDIRI4
+ASGNI4
+ADDRLP4 348+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+4
+ADDRLP4 348+4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 5516
+CNSTF4 0
+ASGNF4
+ADDRLP4 892+8
+ADDRLP4 5516
+INDIRF4
+ASGNF4
+ADDRLP4 892+4
+ADDRLP4 5516
+INDIRF4
+ASGNF4
+ADDRLP4 892
+ADDRLP4 5516
+INDIRF4
+ASGNF4
+ADDRLP4 892
+ARGP4
+ADDRLP4 348+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 348+68
+ADDRLP4 176+68
+INDIRB
+ASGNB 12
+ADDRLP4 348+68+8
+ADDRLP4 348+68+8
+INDIRF4
+CNSTF4 1117782016
+ADDRLP4 912
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1140457472
+DIVF4
+CNSTF4 3250585600
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 912
+INDIRI4
+CNSTI4 400
+LEI4 $4091
+ADDRLP4 5524
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 916
+ADDRLP4 5524
+INDIRF4
+ADDRLP4 912
+INDIRI4
+CNSTI4 1000
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 5528
+ADDRLP4 5524
+INDIRF4
+ADDRLP4 916
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 5532
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5528
+INDIRF4
+ADDRLP4 5532
+INDIRF4
+LTF4 $4095
+ADDRLP4 5520
+ADDRLP4 5528
+INDIRF4
+ADDRLP4 5532
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $4096
+JUMPV
+LABELV $4095
+ADDRLP4 5520
+ADDRLP4 5528
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $4096
+ADDRLP4 348+116
+ADDRLP4 5520
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 5540
+CNSTF4 1132396544
+ADDRLP4 916
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 5544
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5540
+INDIRF4
+ADDRLP4 5544
+INDIRF4
+LTF4 $4100
+ADDRLP4 5536
+ADDRLP4 5540
+INDIRF4
+ADDRLP4 5544
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $4101
+JUMPV
+LABELV $4100
+ADDRLP4 5536
+ADDRLP4 5540
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $4101
+ADDRLP4 348+116+1
+ADDRLP4 5536
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 5552
+CNSTF4 1132396544
+ADDRLP4 916
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 5556
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5552
+INDIRF4
+ADDRLP4 5556
+INDIRF4
+LTF4 $4105
+ADDRLP4 5548
+ADDRLP4 5552
+INDIRF4
+ADDRLP4 5556
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $4106
+JUMPV
+LABELV $4105
+ADDRLP4 5548
+ADDRLP4 5552
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $4106
+ADDRLP4 348+116+2
+ADDRLP4 5548
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 5564
+CNSTF4 1132396544
+ADDRLP4 916
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 5568
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5564
+INDIRF4
+ADDRLP4 5568
+INDIRF4
+LTF4 $4110
+ADDRLP4 5560
+ADDRLP4 5564
+INDIRF4
+ADDRLP4 5568
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $4111
+JUMPV
+LABELV $4110
+ADDRLP4 5560
+ADDRLP4 5564
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $4111
+ADDRLP4 348+116+3
+ADDRLP4 5560
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $4092
+JUMPV
+LABELV $4091
+ADDRLP4 348+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 348+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 348+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 348+116+3
+CNSTU1 255
+ASGNU1
+LABELV $4092
+ADDRLP4 348
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $4075
+ADDRLP4 520+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 520+8
+INDIRI4
+CNSTI4 0
+NEI4 $4120
+ADDRGP4 $3561
+JUMPV
+LABELV $4120
+ADDRLP4 520+108
+ADDRLP4 0
+INDIRP4
+CNSTI4 944
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 520+12
+ADDRLP4 176+68
+INDIRB
+ASGNB 12
+ADDRLP4 692
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2212
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4126
+ADDRLP4 692
+ADDRLP4 0
+INDIRP4
+CNSTI4 2236
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $4127
+JUMPV
+LABELV $4126
+ADDRLP4 5516
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_playerModelAllowServerScale+12
+INDIRI4
+ADDRLP4 5516
+INDIRI4
+EQI4 $4128
+ADDRGP4 cgs+1957736
+INDIRI4
+ADDRLP4 5516
+INDIRI4
+EQI4 $4128
+ADDRLP4 692
+ADDRGP4 cgs+1957596
+INDIRF4
+ASGNF4
+LABELV $4128
+ADDRGP4 cg_playerModelForceHeadScale+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4133
+ADDRGP4 cg_playerModelForceHeadScale+8
+INDIRF4
+CNSTF4 0
+LEF4 $4133
+ADDRLP4 692
+ADDRGP4 cg_playerModelForceHeadScale+8
+INDIRF4
+ASGNF4
+LABELV $4133
+LABELV $4127
+ADDRLP4 692
+INDIRF4
+CNSTF4 0
+GTF4 $4138
+ADDRLP4 692
+CNSTF4 1065353216
+ASGNF4
+LABELV $4138
+ADDRLP4 692
+INDIRF4
+CNSTF4 1065353216
+EQF4 $4140
+ADDRLP4 520
+ARGP4
+ADDRLP4 692
+INDIRF4
+ARGF4
+ADDRGP4 CG_ScaleModel
+CALLV
+pop
+LABELV $4140
+ADDRLP4 520
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $458
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 908
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2216
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4142
+ADDRLP4 908
+ADDRLP4 0
+INDIRP4
+CNSTI4 2240
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $4143
+JUMPV
+LABELV $4142
+ADDRGP4 cg_playerModelForceHeadOffset+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4144
+ADDRLP4 908
+ADDRGP4 cg_playerModelForceHeadOffset+8
+INDIRF4
+ASGNF4
+ADDRGP4 $4145
+JUMPV
+LABELV $4144
+ADDRLP4 5516
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_playerModelAllowServerScale+12
+INDIRI4
+ADDRLP4 5516
+INDIRI4
+EQI4 $4148
+ADDRGP4 cgs+1957736
+INDIRI4
+ADDRLP4 5516
+INDIRI4
+EQI4 $4148
+ADDRGP4 cgs+1957600
+INDIRI4
+ADDRLP4 5516
+INDIRI4
+EQI4 $4148
+ADDRLP4 908
+ADDRGP4 cgs+1957604
+INDIRF4
+ASGNF4
+LABELV $4148
+LABELV $4145
+LABELV $4143
+ADDRLP4 908
+INDIRF4
+CNSTF4 1065353216
+EQF4 $4154
+ADDRLP4 5516
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 520+68+8
+ADDRLP4 520+68+8
+INDIRF4
+ADDRLP4 5516
+INDIRF4
+SUBF4
+ADDRLP4 5516
+INDIRF4
+ADDRLP4 908
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $4154
+ADDRLP4 520+24
+ADDRLP4 904
+INDIRF4
+ASGNF4
+ADDRLP4 520+4
+ADDRLP4 872
+INDIRI4
+ASGNI4
+ADDRGP4 EffectScripts+3735912
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4162
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+636
+ADDRLP4 520+80
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 ScriptVars+120
+ADDRLP4 520+28
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+120+12
+ADDRLP4 520+28+12
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+120+24
+ADDRLP4 520+28+24
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+60
+ADDRLP4 520+68
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7772
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7788
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 EffectScripts+3735912
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+LABELV $4162
+ADDRLP4 520
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1492
+ADDP4
+INDIRF4
+GEF4 $4188
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4188
+ADDRLP4 520+112
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 520
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $4188
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 520
+ARGP4
+ADDRGP4 CG_BreathPuffs
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DustTrail
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddPlayerWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_PlayerPowerups
+CALLV
+pop
+LABELV $3561
+endproc CG_Player 5572 28
+export CG_ResetPlayerEntity
+proc CG_ResetPlayerEntity 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+1335116
+INDIRI4
+CNSTI4 0
+EQI4 $4193
+LABELV $4193
+ADDRGP4 cg_useOriginalInterpolation+12
+INDIRI4
+CNSTI4 0
+NEI4 $4196
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_freecam_useServerView+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $4192
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $4192
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $4204
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $4192
+LABELV $4204
+ADDRGP4 cg+1335116
+INDIRI4
+CNSTI4 0
+EQI4 $4200
+ADDRGP4 $4192
+JUMPV
+LABELV $4200
+LABELV $4196
+ADDRFP4 0
+INDIRP4
+CNSTI4 1120
+ADDP4
+CNSTI4 -99999
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1148
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 948
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1164
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 48
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1168
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 928
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 932
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 948
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 48
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 968
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1168
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 972
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 976
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 980
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1464
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1468
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1472
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_debugPosition+12
+INDIRI4
+CNSTI4 0
+EQI4 $4216
+ADDRGP4 $4219
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 968
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $4216
+LABELV $4192
+endproc CG_ResetPlayerEntity 40 16
+export CG_DuelPlayerScoreValid
+proc CG_DuelPlayerScoreValid 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $4221
+CNSTI4 0
+RETI4
+ADDRGP4 $4220
+JUMPV
+LABELV $4221
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4225
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $4223
+LABELV $4225
+CNSTI4 0
+RETI4
+ADDRGP4 $4220
+JUMPV
+LABELV $4223
+ADDRGP4 cg+610848
+INDIRI4
+CNSTI4 0
+NEI4 $4226
+CNSTI4 0
+RETI4
+ADDRGP4 $4220
+JUMPV
+LABELV $4226
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4229
+CNSTI4 0
+RETI4
+ADDRGP4 $4220
+JUMPV
+LABELV $4229
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+616764
+ADDP4
+INDIRI4
+RETI4
+LABELV $4220
+endproc CG_DuelPlayerScoreValid 4 0
+export CG_DuelPlayerInfoValid
+proc CG_DuelPlayerInfoValid 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $4234
+CNSTI4 0
+RETI4
+ADDRGP4 $4233
+JUMPV
+LABELV $4234
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4238
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $4236
+LABELV $4238
+CNSTI4 0
+RETI4
+ADDRGP4 $4233
+JUMPV
+LABELV $4236
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4239
+CNSTI4 0
+RETI4
+ADDRGP4 $4233
+JUMPV
+LABELV $4239
+CNSTI4 1
+RETI4
+LABELV $4233
+endproc CG_DuelPlayerInfoValid 4 0
+import acos
+bss
+align 4
+LABELV tmpScores
+skip 5888
+import PM_StepSlideMove
+import PM_SlideMove
+import PM_AddEvent
+import PM_AddTouchEnt
+import PM_ClipVelocity
+import bg_playerMaxs
+import bg_playerMins
+import c_pmove
+import pm_flightfriction
+import pm_waterfriction
+import pm_friction
+import pm_flyaccelerate
+import pm_wateraccelerate
+import pm_airaccelerate
+import pm_accelerate
+import pm_swimScale
+import pm_duckScale
+import pm_stopspeed
+import pml
+import pm
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import Wolfcam_CalcFov
+import Wolfcam_OffsetFirstPersonView
+import Wolfcam_OffsetThirdPersonView
+import Wolfcam_LoadModels
+import CG_GetModelAndSkinName
+import CG_GetModelName
+import Wolfcam_PlayerArmor
+import Wolfcam_PlayerHealth
+import Wolfcam_AddBoundingBox
+import Wolfcam_AddBox
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import CG_SpawnRailTrail
+import CG_AddWeaponWithPowerups
+import CG_MachinegunSpinAngle
+import CG_MapTorsoToWeaponFrame
+import CG_Bullet
+import CG_GetWeaponFlashOrigin
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_OutOfAmmoChange
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_DrawWeaponSelect
+import CG_AddViewWeapon
+import CG_AddPlayerWeapon
+import CG_LightningBolt
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_SimpleRailTrail
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_AddRealLoopingSound
+import CG_AddLoopingSound
+import CG_StartLocalSound
+import CG_StartSound
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_NewParticleArea
+import CG_ParticleExplosion
+import CG_AddParticles
+import CG_ClearParticles
+import CG_AddMarks
+import CG_ImpactMark
+import CG_InitMarkPolys
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_FreezeTagFrozen
+import CG_AddPacketEntities
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_SetEntitySoundPosition
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AllowedAmbientSound
+import CG_PrintEntityStatep
+import CG_PrintEntityState
+import CG_ThawPlayer
+import CG_GibPlayer
+import CG_FX_ThawPlayer
+import CG_FX_GibPlayer
+import CG_ImpactSparks
+import CG_Bleed
+import CG_MakeExplosion
+import CG_HeadShotPlum
+import CG_DamagePlum
+import CG_ScorePlum
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_LightningBoltBeam
+import CG_SpawnEffect
+import CG_SmokePuff
+import CG_BubbleTrail
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_ShutdownLocalEnts
+import CG_GetStoredScriptVarsFromLE
+import CG_RunFxAll
+import CG_SmokePuff_ql
+import CG_AddRefEntityFX
+import CG_AddRefEntity
+import CG_ListLocalEntities
+import CG_RemoveFXLocalEntities
+import CG_ClearLocalFrameEntities
+import CG_CullGrid
+import CG_AddToCullGrid
+import CG_BeginCullGrid
+import CG_AddLocalEntities
+import CG_MakeLowPriorityEntity
+import CG_AllocLocalEntityRealTime
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import FxLoopSounds
+import CG_FreeFxJitTokens
+import CG_ResetFXIntervalAndDistance
+import CG_UpdatePositionData
+import CG_CopyPositionDataToScript
+import CG_CopyPositionDataToCent
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+import CG_CopyPlayerDataToScriptData
+import CG_ResetScriptVars
+import CG_ReloadQ3mmeScripts
+import CG_RunQ3mmeScript
+import CG_Q3mmeMath
+import EffectScripts
+import PlainScript
+import DistanceScript
+import EmitterScript
+import EmitterScriptVars
+import ScriptVars
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $4219
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 61
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3640
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $3526
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2869
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2847
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2825
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2802
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2780
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2758
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2735
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2732
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2712
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2709
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2689
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2686
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2468
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 83
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $2090
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1274
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1193
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 102
+byte 1 45
+byte 1 62
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1161
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $1157
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1152
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 85
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1087
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1014
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1009
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $994
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $969
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $965
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $958
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $954
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $952
+byte 1 110
+byte 1 47
+byte 1 97
+byte 1 0
+align 1
+LABELV $946
+byte 1 99
+byte 1 0
+align 1
+LABELV $940
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $938
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $936
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $934
+byte 1 115
+byte 1 117
+byte 1 0
+align 1
+LABELV $932
+byte 1 112
+byte 1 113
+byte 1 0
+align 1
+LABELV $930
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $928
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $926
+byte 1 116
+byte 1 116
+byte 1 0
+align 1
+LABELV $923
+byte 1 108
+byte 1 0
+align 1
+LABELV $921
+byte 1 119
+byte 1 0
+align 1
+LABELV $919
+byte 1 104
+byte 1 99
+byte 1 0
+align 1
+LABELV $917
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $915
+byte 1 99
+byte 1 50
+byte 1 0
+align 1
+LABELV $847
+byte 1 99
+byte 1 49
+byte 1 0
+align 1
+LABELV $808
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $782
+byte 1 120
+byte 1 99
+byte 1 110
+byte 1 0
+align 1
+LABELV $775
+byte 1 99
+byte 1 110
+byte 1 0
+align 1
+LABELV $772
+byte 1 110
+byte 1 0
+align 1
+LABELV $762
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 79
+byte 1 108
+byte 1 100
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $749
+byte 1 116
+byte 1 0
+align 1
+LABELV $646
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $633
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $628
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $625
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $624
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $616
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 40
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $612
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $522
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $519
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $516
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $513
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $510
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $509
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $506
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $505
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $504
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $501
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $492
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $487
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $484
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $483
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $482
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $479
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $476
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $464
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 98
+byte 1 0
+align 1
+LABELV $460
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $458
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $456
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $414
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $411
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $406
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $405
+byte 1 112
+byte 1 109
+byte 1 0
+align 1
+LABELV $399
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $398
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $379
+byte 1 45
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $358
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $357
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $347
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $335
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $325
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $324
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $315
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $314
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $304
+byte 1 0
+align 1
+LABELV $303
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $302
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $292
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $291
+byte 1 48
+byte 1 0
+align 1
+LABELV $288
+byte 1 114
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $283
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $258
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $255
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $252
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $241
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $232
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $229
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $228
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 0
+align 1
+LABELV $225
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $222
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $219
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $215
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $214
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $209
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $201
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $195
+byte 1 94
+byte 1 49
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $186
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $179
+byte 1 94
+byte 1 49
+byte 1 99
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $169
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $168
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $167
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $166
+byte 1 42
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $165
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $164
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $163
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $162
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 53
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $161
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $160
+byte 1 42
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $159
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $158
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $157
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
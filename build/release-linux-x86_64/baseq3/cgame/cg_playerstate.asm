@@ -0,0 +1,8506 @@
+export CG_PrintPlayerState
+code
+proc CG_PrintPlayerState 36 16
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRGP4 $153
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $154
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $155
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $156
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $157
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $158
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $159
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $160
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $161
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $162
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $163
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $164
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $165
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $166
+ARGP4
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 -129
+BANDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $167
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $168
+ARGP4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 -129
+BANDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $169
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $170
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $171
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $172
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $173
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $174
+ADDRGP4 $178
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $175
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $174
+ADDRGP4 $179
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $180
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $181
+ADDRGP4 $178
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $182
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $181
+ADDRGP4 $179
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $185
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $186
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $187
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $188
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $189
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $190
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $191
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $192
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $193
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $194
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $195
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $196
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $197
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $198
+ADDRGP4 $178
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $199
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $198
+ADDRGP4 $179
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $202
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $203
+ADDRGP4 $178
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $204
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $203
+ADDRGP4 $179
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $207
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $208
+ADDRGP4 $178
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $209
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $208
+ADDRGP4 $179
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $212
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $213
+ADDRGP4 $178
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $214
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $213
+ADDRGP4 $179
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $217
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $218
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $219
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $220
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $221
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $222
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $223
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $224
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $225
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $226
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $227
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $228
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $229
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $230
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $231
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $151
+endproc CG_PrintPlayerState 36 16
+lit
+align 4
+LABELV $304
+byte 4 0
+address cg_lowAmmoWarningGauntlet
+address cg_lowAmmoWarningMachineGun
+address cg_lowAmmoWarningShotgun
+address cg_lowAmmoWarningGrenadeLauncher
+address cg_lowAmmoWarningRocketLauncher
+address cg_lowAmmoWarningLightningGun
+address cg_lowAmmoWarningRailGun
+address cg_lowAmmoWarningPlasmaGun
+address cg_lowAmmoWarningBFG
+address cg_lowAmmoWarningGrapplingHook
+address cg_lowAmmoWarningNailGun
+address cg_lowAmmoWarningProximityLauncher
+address cg_lowAmmoWarningChainGun
+export CG_GetAmmoWarning
+code
+proc CG_GetAmmoWarning 92 0
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $234
+ADDRLP4 28
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $236
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $238
+CNSTI4 0
+RETI4
+ADDRGP4 $233
+JUMPV
+LABELV $238
+ADDRFP4 0
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 255
+ASGNI4
+ADDRLP4 16
+ADDRGP4 wcg+4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $235
+CNSTI4 0
+RETI4
+ADDRGP4 $233
+JUMPV
+LABELV $236
+CNSTI4 0
+RETI4
+ADDRGP4 $233
+JUMPV
+LABELV $234
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GEI4 $250
+CNSTI4 0
+RETI4
+ADDRGP4 $233
+JUMPV
+LABELV $250
+LABELV $235
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $252
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $252
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRLP4 12
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $258
+JUMPV
+LABELV $255
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $259
+ADDRGP4 $256
+JUMPV
+LABELV $259
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $261
+ADDRGP4 $256
+JUMPV
+LABELV $261
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $264
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+GTI4 $264
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $269-12
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $269
+address $266
+address $266
+address $266
+address $264
+address $266
+address $264
+address $264
+address $264
+address $264
+address $266
+code
+LABELV $266
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 200
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $265
+ADDRLP4 4
+INDIRI4
+CNSTI4 5000
+LTI4 $271
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $233
+JUMPV
+LABELV $271
+LABELV $256
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $258
+ADDRLP4 0
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $255
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $273
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $253
+JUMPV
+LABELV $273
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $275
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+1969988
+INDIRI4
+CNSTI4 0
+EQI4 $277
+ADDRLP4 32
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $280
+ADDRLP4 32
+INDIRI4
+CNSTI4 13
+GTI4 $280
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRGP4 $288-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $288
+address $282
+address $283
+address $283
+address $283
+address $282
+address $283
+address $282
+address $286
+address $280
+address $287
+address $285
+address $284
+code
+LABELV $282
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRGP4 $278
+JUMPV
+LABELV $283
+ADDRLP4 20
+CNSTI4 20
+ASGNI4
+ADDRGP4 $278
+JUMPV
+LABELV $284
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRGP4 $278
+JUMPV
+LABELV $285
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+ADDRGP4 $278
+JUMPV
+LABELV $286
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+LABELV $287
+ADDRLP4 20
+CNSTI4 20
+ASGNI4
+ADDRGP4 $278
+JUMPV
+LABELV $280
+ADDRLP4 20
+CNSTI4 150
+ASGNI4
+ADDRGP4 $278
+JUMPV
+LABELV $277
+ADDRLP4 32
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $290
+ADDRLP4 32
+INDIRI4
+CNSTI4 13
+GTI4 $290
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRGP4 $297-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $297
+address $292
+address $293
+address $293
+address $293
+address $292
+address $293
+address $292
+address $296
+address $290
+address $296
+address $295
+address $294
+code
+LABELV $292
+ADDRLP4 20
+CNSTI4 150
+ASGNI4
+ADDRGP4 $291
+JUMPV
+LABELV $293
+ADDRLP4 20
+CNSTI4 25
+ASGNI4
+ADDRGP4 $291
+JUMPV
+LABELV $294
+ADDRLP4 20
+CNSTI4 200
+ASGNI4
+ADDRGP4 $291
+JUMPV
+LABELV $295
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+ADDRGP4 $291
+JUMPV
+LABELV $296
+ADDRLP4 20
+CNSTI4 25
+ASGNI4
+ADDRGP4 $291
+JUMPV
+LABELV $290
+ADDRLP4 20
+CNSTI4 150
+ASGNI4
+LABELV $291
+LABELV $278
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $299
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $299
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+DIVF4
+ADDRGP4 cg_lowAmmoWarningPercentile+8
+INDIRF4
+GEF4 $301
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $301
+CNSTI4 0
+RETI4
+ADDRGP4 $233
+JUMPV
+LABELV $275
+ADDRLP4 32
+ADDRGP4 $304
+INDIRB
+ASGNB 56
+ADDRLP4 88
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+LEI4 $307
+ADDRLP4 88
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $305
+LABELV $307
+CNSTI4 0
+RETI4
+ADDRGP4 $233
+JUMPV
+LABELV $305
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $308
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $309
+JUMPV
+LABELV $308
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+GEI4 $310
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+CNSTI4 0
+RETI4
+ADDRGP4 $233
+JUMPV
+LABELV $311
+LABELV $309
+LABELV $276
+LABELV $253
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $233
+endproc CG_GetAmmoWarning 92 0
+proc CG_CheckAmmo 28 12
+ADDRLP4 8
+ADDRGP4 cg+627140
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627140
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $315
+ADDRLP4 16
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $317
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRGP4 wcg+4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 356
+ADDP4
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 24
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRLP4 24
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 wcg+4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $323
+ADDRGP4 $312
+JUMPV
+LABELV $323
+ADDRLP4 12
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $316
+JUMPV
+LABELV $317
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $312
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $316
+JUMPV
+LABELV $315
+ADDRLP4 16
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $334
+ADDRGP4 $312
+JUMPV
+LABELV $334
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $316
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $340
+ADDRGP4 $312
+JUMPV
+LABELV $340
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRLP4 16
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $344
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_FreezeTagFrozen
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $344
+ADDRGP4 $312
+JUMPV
+LABELV $344
+LABELV $342
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $347
+ADDRGP4 $312
+JUMPV
+LABELV $347
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg_lowAmmoWarningStyle+12
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_GetAmmoWarning
+CALLI4
+ASGNI4
+ADDRGP4 cg+627140
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627140
+INDIRI4
+CNSTI4 0
+NEI4 $352
+ADDRGP4 $312
+JUMPV
+LABELV $352
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $355
+ADDRGP4 $312
+JUMPV
+LABELV $355
+ADDRGP4 cg_lowAmmoWarningSound+12
+INDIRI4
+CNSTI4 0
+NEI4 $358
+ADDRGP4 $312
+JUMPV
+LABELV $358
+ADDRGP4 cg_lowAmmoWarningSound+12
+INDIRI4
+CNSTI4 1
+NEI4 $361
+ADDRGP4 cg+627140
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $362
+ADDRGP4 cg+627140
+INDIRI4
+CNSTI4 2
+NEI4 $362
+ADDRGP4 cgs+632912+492984
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRGP4 cg+627140
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $370
+ADDRGP4 cgs+632912+492984
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $370
+LABELV $362
+LABELV $312
+endproc CG_CheckAmmo 28 12
+proc CG_DamageFeedback 84 16
+ADDRGP4 cg+627160
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 40
+GEI4 $379
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRLP4 28
+CNSTF4 1109393408
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $380
+ADDRLP4 12
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1084227584
+GEF4 $381
+ADDRLP4 12
+CNSTF4 1084227584
+ASGNF4
+LABELV $381
+ADDRLP4 12
+INDIRF4
+CNSTF4 1092616192
+LEF4 $383
+ADDRLP4 12
+CNSTF4 1092616192
+ASGNF4
+LABELV $383
+ADDRLP4 60
+CNSTI4 255
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $385
+ADDRFP4 4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $385
+ADDRGP4 cg+627436
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+627440
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+627484
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+627480
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $386
+JUMPV
+LABELV $385
+ADDRLP4 64
+CNSTF4 1135869952
+ASGNF4
+ADDRLP4 68
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 56
+ADDRLP4 64
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 68
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 64
+INDIRF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 68
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+CNSTP4 0
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 76
+INDIRF4
+ADDRGP4 cg+609412+36
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 cg+609412+36+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 cg+609412+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 76
+INDIRF4
+ADDRGP4 cg+609412+36+12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 cg+609412+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 cg+609412+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 76
+INDIRF4
+ADDRGP4 cg+609412+36+24
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 cg+609412+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 cg+609412+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1036831949
+GEF4 $437
+ADDRLP4 44
+CNSTF4 1036831949
+ASGNF4
+LABELV $437
+ADDRGP4 cg+627484
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+627480
+ADDRLP4 12
+INDIRF4
+NEGF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1036831949
+GTF4 $441
+ADDRLP4 16
+CNSTF4 1036831949
+ASGNF4
+LABELV $441
+ADDRGP4 cg+627436
+ADDRLP4 24
+INDIRF4
+NEGF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 cg+627440
+ADDRLP4 48
+INDIRF4
+ADDRLP4 44
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $386
+ADDRGP4 cg+627436
+INDIRF4
+CNSTF4 1065353216
+LEF4 $445
+ADDRGP4 cg+627436
+CNSTF4 1065353216
+ASGNF4
+LABELV $445
+ADDRGP4 cg+627436
+INDIRF4
+CNSTF4 3212836864
+GEF4 $449
+ADDRGP4 cg+627436
+CNSTF4 3212836864
+ASGNF4
+LABELV $449
+ADDRGP4 cg+627440
+INDIRF4
+CNSTF4 1065353216
+LEF4 $453
+ADDRGP4 cg+627440
+CNSTF4 1065353216
+ASGNF4
+LABELV $453
+ADDRGP4 cg+627440
+INDIRF4
+CNSTF4 3212836864
+GEF4 $457
+ADDRGP4 cg+627440
+CNSTF4 3212836864
+ASGNF4
+LABELV $457
+ADDRLP4 12
+INDIRF4
+CNSTF4 1092616192
+LEF4 $461
+ADDRLP4 12
+CNSTF4 1092616192
+ASGNF4
+LABELV $461
+ADDRGP4 cg+627444
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 cg+627476
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 500
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+627432
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $375
+endproc CG_DamageFeedback 84 16
+export CG_Respawn
+proc CG_Respawn 0 0
+ADDRGP4 cg+607136
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+627420
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+609312
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $468
+endproc CG_Respawn 0 0
+proc CG_CheckPlayerstateEvents 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 128
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $475
+ADDRLP4 16
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $475
+ADDRLP4 4
+CNSTI4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_checkForOfflineDemo+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $477
+ADDRGP4 cg+3196852
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $477
+ADDRGP4 $478
+JUMPV
+LABELV $477
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+LABELV $478
+LABELV $475
+ADDRLP4 4
+ADDRGP4 cg+607704
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $485
+JUMPV
+LABELV $482
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $488
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+LEI4 $486
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 112
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $486
+LABELV $488
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_checkForOfflineDemo+12
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $489
+ADDRGP4 cg+3196852
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $489
+ADDRGP4 $490
+JUMPV
+LABELV $489
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+LABELV $490
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+609224
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 cg+609220
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $486
+LABELV $483
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $485
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LTI4 $482
+LABELV $474
+endproc CG_CheckPlayerstateEvents 52 8
+export CG_CheckChangedPredictableEvents
+proc CG_CheckChangedPredictableEvents 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+607704
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $500
+JUMPV
+LABELV $497
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+609220
+INDIRI4
+LTI4 $501
+ADDRGP4 $498
+JUMPV
+LABELV $501
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+609220
+INDIRI4
+CNSTI4 16
+SUBI4
+LEI4 $504
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+BANDI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 cg+609224
+ADDP4
+INDIRI4
+EQI4 $507
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+609224
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $511
+ADDRGP4 $514
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $511
+LABELV $507
+LABELV $504
+LABELV $498
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $500
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LTI4 $497
+LABELV $495
+endproc CG_CheckChangedPredictableEvents 24 8
+export CG_PushReward
+proc CG_PushReward 8 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg_rewardsStack+12
+INDIRI4
+CNSTI4 0
+NEI4 $516
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+627172
+INDIRI4
+SUBI4
+ADDRGP4 cg_drawRewardsTime+12
+INDIRI4
+GEI4 $516
+ADDRLP4 0
+ADDRGP4 cg+627168
+INDIRI4
+ASGNI4
+ADDRGP4 $525
+JUMPV
+LABELV $522
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+627216
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $527
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+627176
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $515
+JUMPV
+LABELV $527
+LABELV $523
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $525
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $522
+LABELV $516
+ADDRGP4 cg+627168
+INDIRI4
+CNSTI4 9
+GEI4 $531
+ADDRLP4 4
+ADDRGP4 cg+627168
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+627168
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+627256
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627168
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+627216
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627168
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+627176
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $531
+LABELV $532
+LABELV $515
+endproc CG_PushReward 8 0
+proc CG_CheckShotgunHits 20 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $542
+ADDRLP4 4
+ADDRGP4 PERS_HITS
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 248
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $544
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LEI4 $546
+LABELV $546
+ADDRGP4 cg+1331592
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 2392
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736+108+4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 11
+ADDU4
+ASGNU4
+ADDRLP4 16
+CNSTI4 2392
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+1276+108+4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 11
+ADDU4
+ASGNU4
+ADDRGP4 $543
+JUMPV
+LABELV $544
+ADDRGP4 cg+1331592
+CNSTI4 0
+ASGNI4
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRGP4 cg+1331592
+CNSTI4 0
+ASGNI4
+LABELV $543
+LABELV $541
+endproc CG_CheckShotgunHits 20 0
+proc CG_CheckLocalSounds 156 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 248
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $558
+ADDRGP4 $557
+JUMPV
+LABELV $558
+ADDRLP4 32
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 184
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $560
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $562
+ADDRGP4 cg+609412+24
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $566
+ADDRGP4 cg+607704
+ARGP4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PainEvent
+CALLV
+pop
+LABELV $566
+LABELV $562
+LABELV $560
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $576
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $577
+LABELV $576
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $577
+ADDRGP4 cg+627504
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $569
+LABELV $577
+ADDRGP4 cg+28
+INDIRI4
+CNSTI4 0
+EQI4 $578
+ADDRGP4 $557
+JUMPV
+LABELV $578
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $583
+ADDRGP4 $557
+JUMPV
+LABELV $569
+ADDRLP4 44
+ADDRGP4 PERS_HITS
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 248
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+LEI4 $584
+ADDRGP4 cg+1335092
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 PERS_ATTACKEE_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRGP4 cg+1335096
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $589
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+CNSTI4 64
+DIVI4
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $592
+ADDRLP4 52
+ADDRGP4 PERS_HITS
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 248
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 26
+DIVI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+LEI4 $593
+ADDRLP4 12
+CNSTI4 3
+ASGNI4
+ADDRGP4 $593
+JUMPV
+LABELV $592
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $593
+LABELV $590
+ADDRLP4 52
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LTI4 $597
+ADDRLP4 52
+INDIRI4
+CNSTI4 3
+GTI4 $597
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $608
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $608
+address $599
+address $601
+address $603
+address $605
+code
+LABELV $599
+ADDRGP4 cg+1335100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $598
+JUMPV
+LABELV $601
+ADDRGP4 cg+1335100
+CNSTI4 1
+ASGNI4
+ADDRGP4 $598
+JUMPV
+LABELV $603
+ADDRGP4 cg+1335100
+CNSTI4 2
+ASGNI4
+ADDRGP4 $598
+JUMPV
+LABELV $605
+ADDRGP4 cg+1335100
+CNSTI4 3
+ASGNI4
+ADDRGP4 $598
+JUMPV
+LABELV $597
+ADDRGP4 cg+1335100
+CNSTI4 0
+ASGNI4
+LABELV $598
+ADDRLP4 56
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $615
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $585
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $585
+LABELV $615
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $585
+ADDRGP4 cg+627504
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $585
+ADDRGP4 cg_hitBeep+12
+INDIRI4
+CNSTI4 1
+NEI4 $616
+ADDRGP4 cgs+632912+493032
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $616
+ADDRGP4 cg_hitBeep+12
+INDIRI4
+CNSTI4 2
+NEI4 $621
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $624
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+CNSTI4 64
+DIVI4
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $624
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $627
+ADDRLP4 76
+ADDRGP4 PERS_HITS
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 248
+ASGNI4
+ADDRLP4 68
+ADDRLP4 76
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 26
+DIVI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 3
+LEI4 $628
+ADDRLP4 68
+CNSTI4 3
+ASGNI4
+ADDRGP4 $628
+JUMPV
+LABELV $627
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $628
+LABELV $625
+ADDRLP4 76
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+LTI4 $632
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+GTI4 $632
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $648
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $648
+address $634
+address $637
+address $640
+address $643
+code
+LABELV $634
+ADDRLP4 72
+ADDRGP4 cgs+632912+493036
+INDIRI4
+ASGNI4
+ADDRGP4 $633
+JUMPV
+LABELV $637
+ADDRLP4 72
+ADDRGP4 cgs+632912+493040
+INDIRI4
+ASGNI4
+ADDRGP4 $633
+JUMPV
+LABELV $640
+ADDRLP4 72
+ADDRGP4 cgs+632912+493044
+INDIRI4
+ASGNI4
+ADDRGP4 $633
+JUMPV
+LABELV $643
+ADDRLP4 72
+ADDRGP4 cgs+632912+493048
+INDIRI4
+ASGNI4
+ADDRGP4 $633
+JUMPV
+LABELV $632
+ADDRLP4 72
+ADDRGP4 cgs+632912+493036
+INDIRI4
+ASGNI4
+LABELV $633
+ADDRLP4 72
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $621
+ADDRGP4 cg_hitBeep+12
+INDIRI4
+CNSTI4 3
+NEI4 $585
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $652
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+CNSTI4 64
+DIVI4
+ASGNI4
+ADDRGP4 $653
+JUMPV
+LABELV $652
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $655
+ADDRLP4 76
+ADDRGP4 PERS_HITS
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 248
+ASGNI4
+ADDRLP4 68
+ADDRLP4 76
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 26
+DIVI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 3
+LEI4 $656
+ADDRLP4 68
+CNSTI4 3
+ASGNI4
+ADDRGP4 $656
+JUMPV
+LABELV $655
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $656
+LABELV $653
+ADDRLP4 76
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+LTI4 $660
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+GTI4 $660
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $676
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $676
+address $671
+address $668
+address $665
+address $662
+code
+LABELV $662
+ADDRLP4 72
+ADDRGP4 cgs+632912+493036
+INDIRI4
+ASGNI4
+ADDRGP4 $661
+JUMPV
+LABELV $665
+ADDRLP4 72
+ADDRGP4 cgs+632912+493040
+INDIRI4
+ASGNI4
+ADDRGP4 $661
+JUMPV
+LABELV $668
+ADDRLP4 72
+ADDRGP4 cgs+632912+493044
+INDIRI4
+ASGNI4
+ADDRGP4 $661
+JUMPV
+LABELV $671
+ADDRLP4 72
+ADDRGP4 cgs+632912+493048
+INDIRI4
+ASGNI4
+ADDRGP4 $661
+JUMPV
+LABELV $660
+ADDRLP4 72
+ADDRGP4 cgs+632912+493036
+INDIRI4
+ASGNI4
+LABELV $661
+ADDRLP4 72
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRLP4 52
+ADDRGP4 PERS_HITS
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 248
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+GEI4 $677
+ADDRLP4 60
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $685
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $679
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $679
+LABELV $685
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $679
+ADDRGP4 cg+627504
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $679
+ADDRGP4 cg_hitBeep+12
+INDIRI4
+CNSTI4 0
+EQI4 $686
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $686
+ADDRGP4 cgs+632912+493060
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $686
+LABELV $679
+LABELV $677
+LABELV $585
+ADDRGP4 cg+28
+INDIRI4
+CNSTI4 0
+EQI4 $692
+ADDRGP4 $557
+JUMPV
+LABELV $692
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $695
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $557
+ADDRGP4 cgs+1957752
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $557
+LABELV $698
+LABELV $695
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+ADDRGP4 PERS_CAPTURES
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 248
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+LEI4 $700
+ADDRGP4 cg_rewardCapture+12
+INDIRI4
+CNSTI4 0
+EQI4 $700
+ADDRGP4 cgs+632912+493252
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+492496
+INDIRI4
+ARGI4
+ADDRGP4 PERS_CAPTURES
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PushReward
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $700
+ADDRLP4 72
+ADDRGP4 PERS_IMPRESSIVE_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 248
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+LEI4 $707
+ADDRGP4 cg_rewardImpressive+12
+INDIRI4
+CNSTI4 0
+EQI4 $707
+ADDRGP4 PERS_IMPRESSIVE_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $710
+ADDRGP4 cg_audioAnnouncerRewardsFirst+12
+INDIRI4
+CNSTI4 0
+EQI4 $710
+ADDRLP4 4
+ADDRGP4 cgs+632912+493112
+INDIRI4
+ASGNI4
+ADDRGP4 $711
+JUMPV
+LABELV $710
+ADDRLP4 80
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+CNSTI4 3
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493064
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $711
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+492476
+INDIRI4
+ARGI4
+ADDRGP4 PERS_IMPRESSIVE_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PushReward
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $707
+ADDRLP4 80
+ADDRGP4 PERS_EXCELLENT_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 84
+CNSTI4 248
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+LEI4 $719
+ADDRGP4 cg_rewardExcellent+12
+INDIRI4
+CNSTI4 0
+EQI4 $719
+ADDRGP4 PERS_EXCELLENT_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $722
+ADDRGP4 cg_audioAnnouncerRewardsFirst+12
+INDIRI4
+CNSTI4 0
+EQI4 $722
+ADDRLP4 4
+ADDRGP4 cgs+632912+493116
+INDIRI4
+ASGNI4
+ADDRGP4 $723
+JUMPV
+LABELV $722
+ADDRLP4 88
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 88
+INDIRI4
+CNSTI4 3
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493076
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $723
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+492480
+INDIRI4
+ARGI4
+ADDRGP4 PERS_EXCELLENT_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PushReward
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $719
+ADDRLP4 88
+ADDRGP4 PERS_GAUNTLET_FRAG_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 92
+CNSTI4 248
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+LEI4 $731
+ADDRGP4 cg_rewardHumiliation+12
+INDIRI4
+CNSTI4 0
+EQI4 $731
+ADDRGP4 PERS_GAUNTLET_FRAG_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $734
+ADDRGP4 cg_audioAnnouncerRewardsFirst+12
+INDIRI4
+CNSTI4 0
+EQI4 $734
+ADDRLP4 4
+ADDRGP4 cgs+632912+493120
+INDIRI4
+ASGNI4
+ADDRGP4 $735
+JUMPV
+LABELV $734
+ADDRLP4 96
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 96
+INDIRI4
+CNSTI4 3
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493092
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $735
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+492484
+INDIRI4
+ARGI4
+ADDRGP4 PERS_GAUNTLET_FRAG_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PushReward
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $731
+ADDRLP4 96
+ADDRGP4 PERS_DEFEND_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 248
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+LEI4 $743
+ADDRGP4 cg_rewardDefend+12
+INDIRI4
+CNSTI4 0
+EQI4 $743
+ADDRGP4 cgs+632912+493108
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+492488
+INDIRI4
+ARGI4
+ADDRGP4 PERS_DEFEND_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PushReward
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $743
+ADDRLP4 104
+ADDRGP4 PERS_ASSIST_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 248
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+LEI4 $750
+ADDRGP4 cg_rewardAssist+12
+INDIRI4
+CNSTI4 0
+EQI4 $750
+ADDRGP4 cgs+632912+493104
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+492492
+INDIRI4
+ARGI4
+ADDRGP4 PERS_ASSIST_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PushReward
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $750
+ADDRLP4 112
+ADDRGP4 PERS_PLAYEREVENTS
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 116
+CNSTI4 248
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+LEI4 $757
+ADDRLP4 120
+ADDRGP4 PERS_PLAYEREVENTS
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 124
+CNSTI4 248
+ASGNI4
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+BANDI4
+ADDRLP4 120
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+BANDI4
+EQI4 $759
+ADDRGP4 cg_audioAnnouncerRewards+12
+INDIRI4
+CNSTI4 0
+EQI4 $760
+ADDRGP4 cgs+632912+493088
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $759
+ADDRLP4 132
+CNSTI4 2
+ASGNI4
+ADDRLP4 136
+ADDRGP4 PERS_PLAYEREVENTS
+INDIRI4
+ADDRLP4 132
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 140
+CNSTI4 248
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+BANDI4
+ADDRLP4 136
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+BANDI4
+LEI4 $766
+ADDRGP4 cg_audioAnnouncerRewards+12
+INDIRI4
+CNSTI4 0
+EQI4 $767
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 3
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+493092
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $767
+JUMPV
+LABELV $766
+ADDRLP4 144
+ADDRGP4 PERS_PLAYEREVENTS
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 148
+CNSTI4 248
+ASGNI4
+ADDRLP4 152
+CNSTI4 4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+BANDI4
+ADDRLP4 144
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+BANDI4
+LEI4 $773
+ADDRGP4 cg_audioAnnouncerRewards+12
+INDIRI4
+CNSTI4 0
+EQI4 $775
+ADDRGP4 cgs+632912+493380
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $775
+LABELV $773
+LABELV $767
+LABELV $760
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $757
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LEI4 $780
+ADDRLP4 120
+ADDRGP4 PW_REDFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 124
+CNSTI4 312
+ASGNI4
+ADDRLP4 128
+ADDRLP4 120
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $786
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $787
+LABELV $786
+ADDRLP4 132
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 136
+CNSTI4 312
+ASGNI4
+ADDRLP4 140
+ADDRLP4 132
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 132
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $788
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $787
+LABELV $788
+ADDRLP4 144
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 148
+CNSTI4 312
+ASGNI4
+ADDRLP4 152
+ADDRLP4 144
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ADDRLP4 144
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $783
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $783
+LABELV $787
+ADDRGP4 cg_audioAnnouncerFlagStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $789
+ADDRGP4 cgs+632912+493364
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $789
+ADDRGP4 cg_flagTakenSound+12
+INDIRI4
+CNSTI4 0
+EQI4 $794
+ADDRGP4 cgs+632912+493332
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $794
+LABELV $783
+LABELV $780
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 120
+INDIRI4
+NEI4 $799
+ADDRGP4 cg_audioAnnouncerLead+12
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $799
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+NEI4 $802
+ADDRLP4 124
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 128
+CNSTI4 248
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $805
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GEI4 $807
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $810
+ADDRGP4 cgs+632912+493204
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $811
+JUMPV
+LABELV $810
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 16384
+NEI4 $814
+ADDRGP4 cgs+632912+493208
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $815
+JUMPV
+LABELV $814
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+CNSTI4 0
+NEI4 $818
+ADDRGP4 cgs+632912+493212
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $818
+LABELV $815
+LABELV $811
+LABELV $807
+LABELV $805
+LABELV $802
+LABELV $799
+LABELV $583
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+39724
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LEI4 $822
+ADDRGP4 cg+627388
+INDIRI4
+ADDRLP4 124
+INDIRI4
+NEI4 $822
+ADDRLP4 128
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+43236
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+607176
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $828
+ADDRLP4 128
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+CNSTI4 2000
+ADDI4
+LEI4 $828
+ADDRLP4 132
+ADDRGP4 cg+607176
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRI4
+CNSTI4 7
+BORI4
+ASGNI4
+ADDRGP4 $829
+JUMPV
+LABELV $828
+ADDRGP4 cg+607176
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $833
+ADDRLP4 128
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+CNSTI4 60000
+SUBI4
+LEI4 $833
+ADDRLP4 132
+ADDRGP4 cg+607176
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRI4
+CNSTI4 3
+BORI4
+ASGNI4
+ADDRGP4 cg_audioAnnouncerTimeLimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $834
+ADDRGP4 cgs+632912+493008
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $834
+JUMPV
+LABELV $833
+ADDRGP4 cgs+39720
+INDIRI4
+CNSTI4 5
+LEI4 $843
+ADDRGP4 cg+607176
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $843
+ADDRLP4 128
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+CNSTI4 300000
+SUBI4
+LEI4 $843
+ADDRLP4 132
+ADDRGP4 cg+607176
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 cg_audioAnnouncerTimeLimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $849
+ADDRGP4 cgs+632912+493012
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $849
+LABELV $843
+LABELV $834
+LABELV $829
+LABELV $822
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+39704
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LEI4 $854
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+GEI4 $854
+ADDRGP4 cg+627388
+INDIRI4
+ADDRLP4 128
+INDIRI4
+NEI4 $854
+ADDRLP4 8
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+NEI4 $860
+ADDRGP4 cgs+43244
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $860
+ADDRLP4 8
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+LABELV $860
+ADDRGP4 cg+607180
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $865
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cgs+39704
+INDIRI4
+CNSTI4 1
+SUBI4
+NEI4 $865
+ADDRLP4 132
+ADDRGP4 cg+607180
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRI4
+CNSTI4 7
+BORI4
+ASGNI4
+ADDRGP4 cg_audioAnnouncerFragLimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $866
+ADDRGP4 cgs+632912+493028
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $866
+JUMPV
+LABELV $865
+ADDRLP4 132
+CNSTI4 2
+ASGNI4
+ADDRGP4 cgs+39704
+INDIRI4
+ADDRLP4 132
+INDIRI4
+LEI4 $875
+ADDRGP4 cg+607180
+INDIRI4
+ADDRLP4 132
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $875
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cgs+39704
+INDIRI4
+ADDRLP4 132
+INDIRI4
+SUBI4
+NEI4 $875
+ADDRLP4 136
+ADDRGP4 cg+607180
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRI4
+CNSTI4 3
+BORI4
+ASGNI4
+ADDRGP4 cg_audioAnnouncerFragLimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $876
+ADDRGP4 cgs+632912+493024
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $876
+JUMPV
+LABELV $875
+ADDRLP4 136
+CNSTI4 3
+ASGNI4
+ADDRGP4 cgs+39704
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LEI4 $886
+ADDRGP4 cg+607180
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $886
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cgs+39704
+INDIRI4
+ADDRLP4 136
+INDIRI4
+SUBI4
+NEI4 $886
+ADDRLP4 140
+ADDRGP4 cg+607180
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 cg_audioAnnouncerFragLimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $892
+ADDRGP4 cgs+632912+493020
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $892
+LABELV $886
+LABELV $876
+LABELV $866
+LABELV $854
+LABELV $557
+endproc CG_CheckLocalSounds 156 12
+proc test_flags 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $900
+ARGP4
+ADDRLP4 0
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $898
+ADDRGP4 $897
+JUMPV
+LABELV $898
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 1048576
+LTI4 $901
+ADDRGP4 $903
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $901
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 32768
+LTI4 $904
+ADDRGP4 $906
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $904
+LABELV $897
+endproc test_flags 4 8
+proc test_persStats 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $908
+ADDRLP4 0
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $914
+JUMPV
+LABELV $911
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $915
+ADDRGP4 $919
+ARGP4
+ADDRLP4 4
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $917
+ADDRGP4 $920
+ARGP4
+CNSTI4 68
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $917
+LABELV $915
+LABELV $912
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $914
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $911
+LABELV $908
+LABELV $909
+LABELV $907
+endproc test_persStats 12 16
+export CG_TransitionPlayerState
+proc CG_TransitionPlayerState 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $924
+ADDRGP4 cg+6747460
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 2
+NEI4 $928
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $928
+ADDRLP4 16
+CNSTI4 140
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $931
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $931
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 36
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $932
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $932
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $932
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $935
+LABELV $935
+ADDRLP4 40
+CNSTI4 488
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $937
+ADDRGP4 CG_ZoomDown_f
+CALLV
+pop
+ADDRGP4 $932
+JUMPV
+LABELV $937
+ADDRLP4 44
+CNSTI4 488
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $932
+ADDRGP4 CG_ZoomUp_f
+CALLV
+pop
+ADDRGP4 $932
+JUMPV
+LABELV $931
+ADDRGP4 CG_ZoomUp_f
+CALLV
+pop
+LABELV $932
+LABELV $928
+LABELV $924
+ADDRLP4 4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $944
+JUMPV
+LABELV $941
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $945
+ADDRGP4 $942
+JUMPV
+LABELV $945
+ADDRLP4 16
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $947
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+LABELV $947
+LABELV $942
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $944
+ADDRLP4 0
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $941
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $949
+ADDRGP4 cg+28
+INDIRI4
+CNSTI4 0
+NEI4 $952
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $952
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $963
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $963
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $955
+LABELV $963
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+EQI4 $955
+ADDRGP4 $964
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 CG_InterMissionHit
+CALLV
+pop
+ADDRGP4 cg+28
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $955
+LABELV $952
+ADDRLP4 12
+CNSTI4 140
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $967
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $972
+JUMPV
+LABELV $969
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+692996+28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $970
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $972
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+692992
+INDIRI4
+LTI4 $969
+LABELV $967
+ADDRGP4 cgs+1957776
+INDIRI4
+CNSTI4 0
+EQI4 $976
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 100
+GTI4 $976
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $982
+JUMPV
+LABELV $979
+ADDRLP4 8
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+692996
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+EQI4 $985
+ADDRGP4 $980
+JUMPV
+LABELV $985
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $987
+ADDRGP4 $980
+JUMPV
+LABELV $987
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $980
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $982
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+692992
+INDIRI4
+LTI4 $979
+LABELV $976
+LABELV $949
+ADDRLP4 12
+CNSTI4 140
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $990
+ADDRGP4 cg+607136
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 508
+ADDRGP4 CG_ResetLagometer
+CALLV
+pop
+LABELV $990
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 test_flags
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 test_persStats
+CALLV
+pop
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $993
+ADDRLP4 16
+CNSTI4 144
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $996
+ADDRGP4 cg+627420
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+609312
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $996
+LABELV $993
+ADDRLP4 20
+CNSTI4 168
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $1001
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1001
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DamageFeedback
+CALLV
+pop
+LABELV $1001
+ADDRLP4 24
+ADDRGP4 PERS_SPAWN_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 248
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $1003
+ADDRGP4 CG_Respawn
+CALLV
+pop
+LABELV $1003
+ADDRGP4 cg+607184
+INDIRI4
+CNSTI4 0
+EQI4 $1005
+ADDRGP4 CG_Respawn
+CALLV
+pop
+ADDRGP4 cg+607184
+CNSTI4 0
+ASGNI4
+LABELV $1005
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CheckPlayerstateEvents
+CALLV
+pop
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $1009
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $1009
+ADDRGP4 cg+40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1012
+ADDRGP4 cg+40
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+627396
+INDIRI4
+NEI4 $1012
+ADDRGP4 $1013
+JUMPV
+LABELV $1012
+ADDRLP4 32
+CNSTU4 0
+ASGNU4
+ADDRGP4 cg+40
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $1017
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $1017
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRGP4 cg+40
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1017
+ADDRGP4 $1018
+JUMPV
+LABELV $1017
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CheckShotgunHits
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CheckLocalSounds
+CALLV
+pop
+LABELV $1018
+LABELV $1013
+LABELV $1009
+ADDRGP4 CG_CheckAmmo
+CALLV
+pop
+ADDRLP4 32
+CNSTI4 164
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $1023
+ADDRLP4 36
+CNSTI4 164
+ASGNI4
+ADDRGP4 cg+609296
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+609300
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $1023
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $1028
+ADDRGP4 cg+6702224
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1029
+JUMPV
+LABELV $1028
+ADDRGP4 cg+6702224
+INDIRI4
+CNSTI4 0
+NEI4 $1031
+ADDRGP4 cg+6702224
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 cg+6702228
+CNSTI4 5
+ASGNI4
+ADDRGP4 cg+6702232
+CNSTI4 0
+ASGNI4
+LABELV $1031
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+6702224
+INDIRI4
+LEI4 $1038
+ADDRLP4 40
+ADDRGP4 cg+6702228
+ASGNP4
+ADDRLP4 36
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+6702232
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 cg+6702224
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $1038
+LABELV $1029
+LABELV $923
+endproc CG_TransitionPlayerState 48 12
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import CG_SpawnRailTrail
+import CG_AddWeaponWithPowerups
+import CG_MachinegunSpinAngle
+import CG_MapTorsoToWeaponFrame
+import CG_Bullet
+import CG_GetWeaponFlashOrigin
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_OutOfAmmoChange
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_DrawWeaponSelect
+import CG_AddViewWeapon
+import CG_AddPlayerWeapon
+import CG_LightningBolt
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_SimpleRailTrail
+import CG_DrawActiveFrame
+import CG_AdjustOriginToAvoidSolid
+import CG_CalcSpline
+import CG_AddBufferedSound
+import CG_AdjustedFov
+import CG_CalcZoom
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_CalcVrect
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_AddRealLoopingSound
+import CG_AddLoopingSound
+import CG_StartLocalSound
+import CG_StartSound
+import CG_PlayWinLossMusic
+import CG_CpmaParseGameState
+import CG_CpmaParseScores
+import CG_ExecuteNewServerCommands
+import CG_InterMissionHit
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseWarmup
+import CG_ParseServerinfo
+import CG_LoadInfectedGameTypeModels
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_FreezeTagFrozen
+import CG_CheckEvents
+import CG_EntityEvent
+import CG_CheckClientEventCpma
+import CG_PainEvent
+import CG_TimedItemPickup
+import CG_PlaceString
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $964
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $920
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $919
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $906
+byte 1 94
+byte 1 51
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 45
+byte 1 62
+byte 1 112
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $903
+byte 1 94
+byte 1 51
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 45
+byte 1 62
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $900
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $514
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $232
+byte 1 117
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $231
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $230
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $229
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $228
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $227
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 83
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $226
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $225
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $224
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $223
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $222
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $221
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $220
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $219
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $218
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $217
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 49
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $212
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 58
+byte 1 0
+align 1
+LABELV $207
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $202
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $197
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $196
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $195
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $194
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 89
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $193
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $192
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $191
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $190
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $189
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $188
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $187
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $186
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $185
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $180
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $179
+byte 1 10
+byte 1 0
+align 1
+LABELV $178
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $173
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $172
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $171
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $170
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $169
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $168
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $167
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $166
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $165
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $164
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $163
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $162
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $161
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $160
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $159
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $158
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $157
+byte 1 112
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $156
+byte 1 112
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 37
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $155
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $154
+byte 1 112
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $153
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
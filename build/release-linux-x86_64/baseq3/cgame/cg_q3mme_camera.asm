@@ -0,0 +1,11455 @@
+export CG_Q3mmeCameraResetInternalLengths
+code
+proc CG_Q3mmeCameraResetInternalLengths 4 0
+ADDRLP4 0
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRGP4 $151
+JUMPV
+LABELV $150
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $151
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $150
+LABELV $147
+endproc CG_Q3mmeCameraResetInternalLengths 4 0
+proc CG_DemosAddLog 16392 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 16384
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16388
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16388
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $153
+endproc CG_DemosAddLog 16392 16
+proc demoSaveLine 1036 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_vsnprintf
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1028
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $156
+endproc demoSaveLine 1036 16
+proc cameraPointMatch 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $160
+JUMPV
+LABELV $159
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $160
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $162
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $159
+LABELV $162
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $163
+ADDRFP4 8
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $166
+JUMPV
+LABELV $165
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $166
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $168
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $165
+LABELV $168
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $164
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $158
+JUMPV
+LABELV $163
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $172
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $174
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $171
+LABELV $174
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $164
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $176
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $178
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $175
+LABELV $178
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $182
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $182
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $184
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $181
+LABELV $184
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $158
+endproc cameraPointMatch 16 0
+proc cameraMatchAt 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LEI4 $191
+ADDRGP4 $196
+JUMPV
+LABELV $191
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $193
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $193
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $189
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $188
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $196
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $198
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $195
+LABELV $198
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $202
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $202
+JUMPV
+LABELV $201
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $202
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $204
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $201
+LABELV $204
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $185
+endproc cameraMatchAt 20 0
+proc cameraMatchOrigin 116 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $206
+CNSTI4 0
+RETI4
+ADDRGP4 $205
+JUMPV
+LABELV $206
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $208
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $210
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+CNSTI4 12
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 36
+CNSTI4 16
+ASGNI4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRGP4 $211
+JUMPV
+LABELV $210
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $211
+LABELV $209
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $212
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $214
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $213
+JUMPV
+LABELV $214
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 12
+ASGNI4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+CNSTI4 16
+ASGNI4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $216
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 12
+ASGNI4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 64
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 16
+ASGNI4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+CNSTI4 8
+ASGNI4
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+CNSTI4 12
+ASGNI4
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 108
+CNSTI4 16
+ASGNI4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $217
+LABELV $213
+CNSTI4 1
+RETI4
+LABELV $205
+endproc cameraMatchOrigin 116 0
+proc cameraPointLength 120 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 92
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 88
+CNSTF4 1008981770
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+CNSTF4 0
+LTF4 $219
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+RETF4
+ADDRGP4 $218
+JUMPV
+LABELV $219
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+ARGP4
+ADDRGP4 cameraPointMatch
+CALLV
+pop
+ADDRLP4 96
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 112
+ADDRGP4 cameraMatchOrigin
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $221
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTF4 0
+RETF4
+ADDRGP4 $218
+JUMPV
+LABELV $221
+ADDRGP4 demo+4+68
+INDIRI4
+CNSTI4 0
+NEI4 $223
+ADDRLP4 40+12
+ARGP4
+ADDRLP4 40+24
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+RETF4
+ADDRGP4 $218
+JUMPV
+LABELV $223
+CNSTF4 0
+ARGF4
+ADDRGP4 demo+4+68
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 posGet
+CALLV
+pop
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $236
+ADDRLP4 88
+CNSTF4 1008981770
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $236
+JUMPV
+LABELV $235
+ADDRLP4 0
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1008981770
+LEF4 $238
+ADDRLP4 0
+CNSTF4 1008981770
+ASGNF4
+LABELV $238
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $240
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 demo+4+68
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 posGet
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorDistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+GTF4 $246
+ADDRGP4 $242
+JUMPV
+LABELV $246
+ADDRLP4 0
+CNSTF4 1060320051
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $241
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+LTI4 $240
+LABELV $242
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 92
+ADDRLP4 92
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $248
+ADDRGP4 $237
+JUMPV
+LABELV $248
+LABELV $236
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+LTF4 $235
+LABELV $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+RETF4
+LABELV $218
+endproc cameraPointLength 120 16
+export CG_Q3mmeCameraOriginAt
+proc CG_Q3mmeCameraOriginAt 148 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 80
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 76
+CNSTF4 1008981770
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 88
+ARGP4
+ADDRGP4 cameraMatchAt
+CALLV
+pop
+ADDRLP4 88+4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $251
+ADDRLP4 88+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $254
+CNSTI4 0
+RETI4
+ADDRGP4 $250
+JUMPV
+LABELV $254
+ADDRLP4 88+12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $257
+CNSTI4 0
+RETI4
+ADDRGP4 $250
+JUMPV
+LABELV $257
+ADDRLP4 88+8
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 88
+ARGP4
+ADDRGP4 cameraPointMatch
+CALLV
+pop
+ADDRLP4 84
+CNSTF4 0
+ASGNF4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRLP4 88+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $261
+ADDRLP4 84
+CNSTF4 0
+ASGNF4
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRLP4 128
+CNSTI4 36
+ASGNI4
+ADDRLP4 104+4
+ADDRLP4 88+8
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 88+4
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 88+4
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 cameraPointLength
+CALLF4
+ASGNF4
+ADDRLP4 116+4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $269
+ADDRLP4 136
+CNSTI4 36
+ASGNI4
+ADDRLP4 140
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 104
+ADDRLP4 88+4
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 cameraPointLength
+CALLF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRGP4 $270
+JUMPV
+LABELV $269
+ADDRLP4 104
+ADDRLP4 104+4
+INDIRF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 116+4
+INDIRF4
+ASGNF4
+LABELV $270
+ADDRLP4 88+12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $274
+ADDRLP4 136
+CNSTI4 36
+ASGNI4
+ADDRLP4 104+8
+ADDRLP4 88+12
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 88+8
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 88+8
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 cameraPointLength
+CALLF4
+ASGNF4
+ADDRLP4 116+8
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRGP4 $275
+JUMPV
+LABELV $274
+ADDRLP4 104+8
+ADDRLP4 104+4
+INDIRF4
+ASGNF4
+ADDRLP4 116+8
+ADDRLP4 116+4
+INDIRF4
+ASGNF4
+LABELV $275
+ADDRFP4 0
+INDIRI4
+ADDRLP4 88+4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 104
+ARGP4
+ADDRLP4 116
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 dsplineCalc
+CALLF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 136
+INDIRF4
+ASGNF4
+LABELV $262
+LABELV $252
+ADDRLP4 88
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 128
+ADDRGP4 cameraMatchOrigin
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $287
+CNSTI4 0
+RETI4
+ADDRGP4 $250
+JUMPV
+LABELV $287
+ADDRGP4 demo+4+68
+INDIRI4
+CNSTI4 0
+NEI4 $289
+ADDRLP4 132
+ADDRLP4 84
+INDIRF4
+ADDRLP4 88+4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRGP4 demo+4+68
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 posGet
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $250
+JUMPV
+LABELV $289
+CNSTF4 0
+ARGF4
+ADDRGP4 demo+4+68
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 posGet
+CALLV
+pop
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $303
+ADDRLP4 76
+CNSTF4 1008981770
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $303
+JUMPV
+LABELV $302
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1008981770
+LEF4 $305
+ADDRLP4 4
+CNSTF4 1008981770
+ASGNF4
+LABELV $305
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $307
+ADDRLP4 24
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 demo+4+68
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 posGet
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 132
+ADDRGP4 VectorDistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 76
+INDIRF4
+GTF4 $313
+ADDRGP4 $309
+JUMPV
+LABELV $313
+ADDRLP4 4
+CNSTF4 1060320051
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $308
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 10
+LTI4 $307
+LABELV $309
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 132
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 84
+INDIRF4
+LEF4 $315
+ADDRGP4 $304
+JUMPV
+LABELV $315
+ADDRLP4 80
+ADDRLP4 80
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+LABELV $303
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+LTF4 $302
+LABELV $304
+CNSTI4 1
+RETI4
+LABELV $250
+endproc CG_Q3mmeCameraOriginAt 148 16
+export CG_Q3mmeCameraAnglesAt
+proc CG_Q3mmeCameraAnglesAt 140 24
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cameraMatchAt
+CALLV
+pop
+ADDRLP4 0+4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $318
+ADDRLP4 0+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $321
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0+8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $321
+CNSTI4 0
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $318
+ADDRLP4 0+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $325
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0+4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $325
+ADDRLP4 116
+CNSTI4 36
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 112
+ADDRGP4 demo+4+72
+INDIRI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $337
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+EQI4 $340
+ADDRGP4 $332
+JUMPV
+LABELV $337
+ADDRLP4 124
+CNSTI4 20
+ASGNI4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 LerpAngles
+CALLV
+pop
+ADDRGP4 $333
+JUMPV
+LABELV $332
+LABELV $340
+ADDRLP4 0+4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 QuatFromAngles
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $342
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 QuatFromAnglesClosest
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 128
+CNSTI4 20
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+CNSTI4 24
+ASGNI4
+ADDRLP4 20+4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+CNSTI4 28
+ASGNI4
+ADDRLP4 20+8
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 QuatFromAnglesClosest
+CALLV
+pop
+LABELV $343
+ADDRLP4 0+8
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 QuatFromAnglesClosest
+CALLV
+pop
+ADDRLP4 0+12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $356
+ADDRLP4 0+12
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 QuatFromAnglesClosest
+CALLV
+pop
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRLP4 128
+CNSTI4 20
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+CNSTI4 24
+ASGNI4
+ADDRLP4 20+4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 136
+CNSTI4 28
+ASGNI4
+ADDRLP4 20+8
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 QuatFromAnglesClosest
+CALLV
+pop
+LABELV $357
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 64
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRGP4 QuatSquad
+CALLV
+pop
+ADDRLP4 96
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 QuatToAngles
+CALLV
+pop
+LABELV $333
+CNSTI4 1
+RETI4
+LABELV $317
+endproc CG_Q3mmeCameraAnglesAt 140 24
+export CG_Q3mmeCameraFovAt
+proc CG_Q3mmeCameraFovAt 56 20
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cameraMatchAt
+CALLV
+pop
+ADDRLP4 0+4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $372
+ADDRLP4 0+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $375
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0+8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $371
+JUMPV
+LABELV $375
+CNSTI4 0
+RETI4
+ADDRGP4 $371
+JUMPV
+LABELV $372
+ADDRLP4 0+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $379
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0+4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $371
+JUMPV
+LABELV $379
+ADDRLP4 32+4
+ADDRLP4 0+4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 0+4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32+8
+ADDRLP4 0+8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 0+8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $391
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 52
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRLP4 32
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16+4
+INDIRI4
+ADDRLP4 16+8
+INDIRI4
+ADDRLP4 16+4
+INDIRI4
+SUBI4
+SUBI4
+ASGNI4
+LABELV $392
+ADDRLP4 0+12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $399
+ADDRLP4 32+12
+ADDRLP4 0+12
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16+12
+ADDRLP4 0+12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRLP4 32+12
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 16+12
+ADDRLP4 16+8
+INDIRI4
+ADDRLP4 16+8
+INDIRI4
+ADDRLP4 16+4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+LABELV $400
+ADDRLP4 48
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16+4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ADDRLP4 16+8
+INDIRI4
+ADDRLP4 16+4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 VectorTimeSpline
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $371
+endproc CG_Q3mmeCameraFovAt 56 20
+proc cameraPointReset 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $418
+ADDRGP4 $417
+JUMPV
+LABELV $418
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $420
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $424
+ADDRGP4 $421
+JUMPV
+LABELV $424
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $421
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $423
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $426
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $420
+LABELV $426
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $430
+JUMPV
+LABELV $427
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $431
+ADDRGP4 $428
+JUMPV
+LABELV $431
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $428
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $430
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $433
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $427
+LABELV $433
+LABELV $417
+endproc cameraPointReset 8 0
+export CG_Q3mmeCameraDrawPath
+proc CG_Q3mmeCameraDrawPath 212 16
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 188
+ARGP4
+ADDRGP4 cameraPointMatch
+CALLV
+pop
+ADDRLP4 188+4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $435
+ADDRGP4 $434
+JUMPV
+LABELV $435
+ADDRLP4 188+8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $438
+ADDRGP4 $434
+JUMPV
+LABELV $438
+ADDRLP4 188
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 cameraMatchOrigin
+CALLI4
+pop
+ADDRLP4 40+12
+ARGP4
+ADDRLP4 40+24
+ARGP4
+ADDRLP4 208
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 204
+INDIRI4
+CNSTI4 25
+DIVI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 5
+GEI4 $443
+ADDRLP4 36
+CNSTI4 5
+ASGNI4
+LABELV $443
+ADDRLP4 88
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 demoDrawSetupVerts
+CALLV
+pop
+ADDRLP4 184
+CNSTF4 1065351538
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $448
+JUMPV
+LABELV $445
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRGP4 demo+4+68
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 posGet
+CALLV
+pop
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $451
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRGP4 $446
+JUMPV
+LABELV $451
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 88
+ARGP4
+ADDRGP4 demoDrawRawLine
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 0
+INDIRB
+ASGNB 12
+LABELV $446
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $448
+ADDRLP4 12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $445
+LABELV $434
+endproc CG_Q3mmeCameraDrawPath 212 16
+proc cameraPointSynch 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $461
+CNSTP4 0
+RETP4
+ADDRGP4 $453
+JUMPV
+LABELV $458
+LABELV $459
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $461
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $462
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LEI4 $458
+LABELV $462
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $453
+endproc cameraPointSynch 8 0
+proc cameraPointAlloc 8 12
+CNSTU4 48
+ARGU4
+ADDRLP4 4
+ADDRGP4 CG_MallocMem
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $464
+ADDRGP4 $466
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $464
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 48
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $463
+endproc cameraPointAlloc 8 12
+proc cameraPointFree 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $468
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $469
+JUMPV
+LABELV $468
+ADDRGP4 demo+4+64
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $469
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $472
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $472
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeMem
+CALLV
+pop
+LABELV $467
+endproc cameraPointFree 12 4
+export CG_Q3mmeCameraPointAdd
+proc CG_Q3mmeCameraPointAdd 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $477
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LEI4 $475
+LABELV $477
+ADDRLP4 16
+ADDRGP4 cameraPointAlloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRGP4 demo+4+64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $480
+ADDRGP4 demo+4+64
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $480
+ADDRGP4 demo+4+64
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cg+3196768
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $489
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $490
+JUMPV
+LABELV $489
+ADDRLP4 16
+ADDRGP4 cameraPointAlloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $491
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $491
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cg+3196768
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $490
+LABELV $476
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cameraPointReset
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $474
+endproc CG_Q3mmeCameraPointAdd 24 4
+proc cameraDel 12 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $495
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $495
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $497
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $497
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $499
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 cameraPointReset
+CALLV
+pop
+LABELV $499
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $501
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 cameraPointReset
+CALLV
+pop
+LABELV $501
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cameraPointFree
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 cg+3196768
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $494
+endproc cameraDel 12 4
+proc cameraClear 12 4
+ADDRLP4 0
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cameraPointFree
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $508
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $507
+ADDRGP4 cg+3196768
+CNSTI4 0
+ASGNI4
+LABELV $504
+endproc cameraClear 12 4
+proc cameraPointShift 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 demo+4
+INDIRI4
+ADDRGP4 demo+4+4
+INDIRI4
+EQI4 $512
+ADDRGP4 demo+4
+INDIRI4
+ADDRGP4 demo+4+4
+INDIRI4
+LEI4 $517
+CNSTI4 0
+RETI4
+ADDRGP4 $511
+JUMPV
+LABELV $517
+ADDRGP4 demo+4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 demo+4+4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $527
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+NEU4 $525
+LABELV $527
+CNSTI4 0
+RETI4
+ADDRGP4 $511
+JUMPV
+LABELV $525
+ADDRLP4 20
+CNSTI4 36
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 demo+4
+INDIRI4
+NEI4 $533
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 demo+4+4
+INDIRI4
+EQI4 $513
+LABELV $533
+ADDRGP4 demo+4+16
+INDIRI4
+ADDRGP4 demo
+INDIRI4
+GEI4 $534
+ADDRGP4 $538
+ARGP4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 demo+4+16
+ADDRGP4 demo
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $534
+CNSTI4 0
+RETI4
+ADDRGP4 $511
+JUMPV
+LABELV $512
+ADDRGP4 demo+80
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $542
+CNSTI4 0
+RETI4
+ADDRGP4 $511
+JUMPV
+LABELV $542
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRGP4 demo+80
+INDIRI4
+EQI4 $544
+ADDRGP4 demo+4+16
+INDIRI4
+ADDRGP4 demo
+INDIRI4
+GEI4 $547
+ADDRGP4 $551
+ARGP4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 demo+4+16
+ADDRGP4 demo
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $547
+CNSTI4 0
+RETI4
+ADDRGP4 $511
+JUMPV
+LABELV $544
+LABELV $513
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $554
+CNSTI4 0
+RETI4
+ADDRGP4 $511
+JUMPV
+LABELV $554
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $556
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $558
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 0
+GEI4 $569
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $558
+ADDRLP4 16
+CNSTI4 36
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GTI4 $569
+ADDRFP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $556
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $569
+ADDRLP4 16
+CNSTI4 36
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $569
+ADDRFP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $568
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $571
+ADDRGP4 $570
+JUMPV
+LABELV $571
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $569
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $568
+LABELV $570
+ADDRGP4 demo+4
+INDIRI4
+ADDRGP4 demo+4+4
+INDIRI4
+EQI4 $573
+ADDRLP4 8
+ADDRGP4 demo+4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 demo+4+4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $574
+JUMPV
+LABELV $573
+ADDRLP4 8
+ADDRGP4 demo+80
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $574
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $511
+endproc cameraPointShift 24 4
+proc cameraParseTime 12 4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $583
+endproc cameraParseTime 12 4
+proc cameraParseTarget 4 4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 demo+4+8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $584
+endproc cameraParseTarget 4 4
+proc cameraParseFov 12 4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $587
+endproc cameraParseFov 12 4
+proc cameraParseAngles 12 20
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $589
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $588
+endproc cameraParseAngles 12 20
+proc cameraParseOrigin 12 20
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $589
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $590
+endproc cameraParseOrigin 12 20
+data
+align 4
+LABELV $592
+address $593
+byte 4 0
+address cameraParseOrigin
+address $594
+byte 4 0
+address cameraParseAngles
+address $595
+byte 4 0
+address cameraParseTime
+address $596
+byte 4 0
+address cameraParseFov
+byte 4 0
+byte 4 0
+byte 4 0
+code
+proc cameraParsePoint 56 16
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 40
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $592
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 BG_XMLParse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $598
+CNSTI4 0
+RETI4
+ADDRGP4 $591
+JUMPV
+LABELV $598
+ADDRLP4 0+36
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $600
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $603
+ARGP4
+ADDRLP4 48
+ADDRGP4 BG_XMLError
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+RETI4
+ADDRGP4 $591
+JUMPV
+LABELV $600
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0+36
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Q3mmeCameraPointAdd
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0+8
+INDIRB
+ASGNB 12
+ADDRLP4 40
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0+20
+INDIRB
+ASGNB 12
+ADDRLP4 40
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 0+32
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $591
+endproc cameraParsePoint 56 16
+proc cameraParseLocked 0 8
+ADDRGP4 $609
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $608
+endproc cameraParseLocked 0 8
+proc cameraParseSmoothPos 4 4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 demo+4+68
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $610
+endproc cameraParseSmoothPos 4 4
+proc cameraParseSmoothAngles 4 4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 demo+4+72
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $613
+endproc cameraParseSmoothAngles 4 4
+data
+align 4
+LABELV $617
+address $618
+address cameraParsePoint
+byte 4 0
+address $619
+byte 4 0
+address cameraParseLocked
+address $620
+byte 4 0
+address cameraParseTarget
+address $621
+byte 4 0
+address cameraParseSmoothPos
+address $622
+byte 4 0
+address cameraParseSmoothAngles
+byte 4 0
+byte 4 0
+byte 4 0
+export CG_Q3mmeCameraParse
+code
+proc CG_Q3mmeCameraParse 4 16
+ADDRGP4 cameraClear
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $617
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BG_XMLParse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $623
+CNSTI4 0
+RETI4
+ADDRGP4 $616
+JUMPV
+LABELV $623
+CNSTI4 1
+RETI4
+LABELV $616
+endproc CG_Q3mmeCameraParse 4 16
+export CG_Q3mmeCameraSave
+proc CG_Q3mmeCameraSave 12 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $628
+ARGP4
+ADDRGP4 demoSaveLine
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $629
+ARGP4
+ADDRGP4 demo+4+68
+INDIRI4
+ARGI4
+ADDRGP4 demoSaveLine
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $632
+ARGP4
+ADDRGP4 demo+4+72
+INDIRI4
+ARGI4
+ADDRGP4 demoSaveLine
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $635
+ARGP4
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+ARGI4
+ADDRGP4 demoSaveLine
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $637
+ARGP4
+ADDRGP4 demo+4+8
+INDIRI4
+ARGI4
+ADDRGP4 demoSaveLine
+CALLV
+pop
+ADDRGP4 $641
+JUMPV
+LABELV $640
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $643
+ARGP4
+ADDRGP4 demoSaveLine
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $644
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 demoSaveLine
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $645
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $647
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 demoSaveLine
+CALLV
+pop
+LABELV $645
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $648
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $650
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 demoSaveLine
+CALLV
+pop
+LABELV $648
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $651
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $653
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 demoSaveLine
+CALLV
+pop
+LABELV $651
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $654
+ARGP4
+ADDRGP4 demoSaveLine
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $641
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $640
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $655
+ARGP4
+ADDRGP4 demoSaveLine
+CALLV
+pop
+LABELV $625
+endproc CG_Q3mmeCameraSave 12 20
+proc cameraSmooth 56 4
+ADDRGP4 demo+4
+INDIRI4
+ADDRGP4 demo+4+4
+INDIRI4
+NEI4 $657
+ADDRGP4 $662
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $656
+JUMPV
+LABELV $657
+ADDRGP4 demo+4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $667
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRGP4 demo+4
+INDIRI4
+EQI4 $664
+LABELV $667
+ADDRGP4 $668
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $656
+JUMPV
+LABELV $664
+ADDRGP4 demo+4+4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $675
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRGP4 demo+4+4
+INDIRI4
+EQI4 $671
+LABELV $675
+ADDRGP4 $676
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $656
+JUMPV
+LABELV $671
+ADDRLP4 40
+CNSTI4 36
+ASGNI4
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $678
+JUMPV
+LABELV $677
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 cameraPointLength
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $680
+ADDRGP4 $679
+JUMPV
+LABELV $680
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $682
+ADDRGP4 $684
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $682
+LABELV $678
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $677
+LABELV $679
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+NEF4 $685
+ADDRGP4 $687
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $656
+JUMPV
+LABELV $685
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $691
+ADDRGP4 $656
+JUMPV
+LABELV $691
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $693
+ADDRGP4 $684
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $693
+ADDRLP4 48
+CNSTI4 36
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 cameraPointLength
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $689
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $688
+LABELV $656
+endproc cameraSmooth 56 4
+proc cameraMoveAll 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRGP4 $699
+JUMPV
+LABELV $698
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cameraPointReset
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $699
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $698
+LABELV $695
+endproc cameraMoveAll 16 4
+proc cameraRotateAll 76 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 demoCreateRotationMatrix
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRGP4 $705
+JUMPV
+LABELV $704
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 demoRotatePoint
+CALLV
+pop
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRGP4 AnglesNormalize360
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cameraPointReset
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $705
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $704
+LABELV $701
+endproc cameraRotateAll 76 8
+proc demoCommandValue 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $708
+ADDRGP4 $707
+JUMPV
+LABELV $708
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 97
+NEI4 $710
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $711
+JUMPV
+LABELV $710
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+LABELV $711
+LABELV $707
+endproc demoCommandValue 8 4
+export CG_Q3mmeDemoCameraCommand_f
+proc CG_Q3mmeDemoCameraCommand_f 144 16
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 demo+88
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRGP4 demo+100
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $718
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $718
+ADDRGP4 demo+112
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $719
+JUMPV
+LABELV $718
+ADDRGP4 demo+112
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+LABELV $719
+ADDRGP4 demo+80
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 demo+80+4
+ADDRGP4 cg+3196916
+INDIRF4
+ASGNF4
+ADDRGP4 demo
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $734
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $732
+ADDRGP4 cameraSmooth
+CALLV
+pop
+ADDRGP4 $733
+JUMPV
+LABELV $732
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $737
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $735
+ADDRGP4 demo+80
+INDIRI4
+ARGI4
+ADDRGP4 demo+4+12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Q3mmeCameraPointAdd
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $741
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 demo+88
+INDIRB
+ASGNB 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 demo+100
+INDIRB
+ASGNB 12
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $745
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $745
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $746
+JUMPV
+LABELV $745
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 demo+112
+INDIRF4
+ADDRGP4 cg_fov+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $746
+ADDRGP4 $752
+ARGP4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 $736
+JUMPV
+LABELV $741
+ADDRGP4 $753
+ARGP4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 $736
+JUMPV
+LABELV $735
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $756
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $758
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $757
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $754
+LABELV $758
+ADDRGP4 demo+80
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 cameraDel
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $759
+ADDRGP4 $762
+ARGP4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 $755
+JUMPV
+LABELV $759
+ADDRGP4 $763
+ARGP4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 $755
+JUMPV
+LABELV $754
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $766
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $764
+ADDRGP4 demo+4
+ADDRGP4 demo+80
+INDIRI4
+ASGNI4
+ADDRGP4 demo+4
+INDIRI4
+ADDRGP4 demo+4+4
+INDIRI4
+LEI4 $769
+ADDRGP4 demo+4
+ADDRGP4 demo+4+4
+INDIRI4
+ASGNI4
+LABELV $769
+ADDRGP4 demo+4+4
+INDIRI4
+ADDRGP4 demo+4
+INDIRI4
+NEI4 $777
+ADDRGP4 $782
+ARGP4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 $765
+JUMPV
+LABELV $777
+ADDRGP4 $783
+ARGP4
+ADDRLP4 28
+CNSTI4 1000
+ASGNI4
+ADDRGP4 demo+4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ARGI4
+ADDRGP4 demo+4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+MODI4
+ARGI4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 $765
+JUMPV
+LABELV $764
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $788
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $786
+ADDRGP4 demo+4+4
+ADDRGP4 demo+80
+INDIRI4
+ASGNI4
+ADDRGP4 demo+4+4
+INDIRI4
+ADDRGP4 demo+4
+INDIRI4
+GEI4 $792
+ADDRGP4 demo+4+4
+ADDRGP4 demo+4
+INDIRI4
+ASGNI4
+LABELV $792
+ADDRGP4 demo+4+4
+INDIRI4
+ADDRGP4 demo+4
+INDIRI4
+NEI4 $800
+ADDRGP4 $782
+ARGP4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 $787
+JUMPV
+LABELV $800
+ADDRGP4 $805
+ARGP4
+ADDRLP4 32
+CNSTI4 1000
+ASGNI4
+ADDRGP4 demo+4+4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+DIVI4
+ARGI4
+ADDRGP4 demo+4+4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MODI4
+ARGI4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 $787
+JUMPV
+LABELV $786
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $812
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $810
+ADDRGP4 demo+80
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $814
+ADDRGP4 $816
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $814
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $817
+ADDRLP4 36
+ADDRLP4 36
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $817
+ADDRGP4 cg+3196788
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332224+20
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332124
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332224+152
+ADDRLP4 36
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332136
+ADDRLP4 36
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $827
+ARGP4
+ADDRGP4 $828
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $829
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommandNow
+CALLV
+pop
+ADDRGP4 cg+3196800
+CNSTI4 1
+ASGNI4
+ADDRGP4 $811
+JUMPV
+LABELV $810
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $833
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $831
+ADDRGP4 demo+80
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $835
+ADDRGP4 $837
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $835
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $838
+ADDRLP4 40
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $838
+ADDRGP4 cg+3196788
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332224+20
+ADDRLP4 40
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332124
+ADDRLP4 40
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332224+152
+ADDRLP4 40
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332136
+ADDRLP4 40
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $827
+ARGP4
+ADDRGP4 $828
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $829
+ARGP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommandNow
+CALLV
+pop
+ADDRGP4 cg+3196800
+CNSTI4 1
+ASGNI4
+ADDRGP4 $832
+JUMPV
+LABELV $831
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $851
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $849
+ADDRLP4 48
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $854
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $855
+JUMPV
+LABELV $854
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+LABELV $855
+ADDRLP4 44
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $856
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $609
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $857
+ADDRGP4 $859
+ARGP4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 $858
+JUMPV
+LABELV $857
+ADDRGP4 $860
+ARGP4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+LABELV $858
+ADDRGP4 cg+3196788
+CNSTI4 0
+ASGNI4
+ADDRGP4 $850
+JUMPV
+LABELV $849
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $620
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $862
+ADDRLP4 48
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 3
+GEI4 $864
+ADDRGP4 $866
+ARGP4
+ADDRGP4 demo+4+8
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $863
+JUMPV
+LABELV $864
+CNSTI4 2
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 demo+4+8
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $871
+ARGP4
+ADDRGP4 demo+4+8
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $863
+JUMPV
+LABELV $862
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $876
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $874
+CNSTI4 2
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1148846080
+ADDRLP4 60
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 demo+4+16
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 cameraPointShift
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $875
+ADDRGP4 $881
+ARGP4
+ADDRLP4 68
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 1000
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 72
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 72
+INDIRI4
+MODI4
+ARGI4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 $875
+JUMPV
+LABELV $874
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $884
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $882
+ADDRGP4 cameraClear
+CALLV
+pop
+ADDRGP4 $885
+ARGP4
+ADDRGP4 CG_DemosAddLog
+CALLV
+pop
+ADDRGP4 $883
+JUMPV
+LABELV $882
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $888
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $886
+ADDRLP4 60
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+CNSTI4 0
+EQI4 $889
+ADDRGP4 demo+80
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $896
+ADDRLP4 72
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+EQI4 $893
+LABELV $896
+ADDRGP4 $897
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $893
+ADDRLP4 64
+ADDRLP4 60
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $890
+JUMPV
+LABELV $889
+ADDRLP4 64
+ADDRGP4 cg+1332224+20
+ASGNP4
+LABELV $890
+CNSTI4 2
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 demoCommandValue
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 demoCommandValue
+CALLV
+pop
+CNSTI4 4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRGP4 demoCommandValue
+CALLV
+pop
+ADDRLP4 60
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $887
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 cameraPointReset
+CALLV
+pop
+ADDRGP4 $887
+JUMPV
+LABELV $886
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $594
+ARGP4
+ADDRLP4 60
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $902
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+CNSTI4 0
+EQI4 $904
+ADDRGP4 demo+80
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $911
+ADDRLP4 76
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+607152
+INDIRF4
+EQF4 $908
+LABELV $911
+ADDRGP4 $912
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $908
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRGP4 $905
+JUMPV
+LABELV $904
+ADDRLP4 64
+ADDRGP4 cg+1332224+152
+ASGNP4
+LABELV $905
+CNSTI4 2
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 demoCommandValue
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 demoCommandValue
+CALLV
+pop
+CNSTI4 4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRGP4 demoCommandValue
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 AnglesNormalize180
+CALLV
+pop
+ADDRGP4 $903
+JUMPV
+LABELV $902
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $596
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $915
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+CNSTI4 0
+EQI4 $917
+ADDRGP4 demo+80
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $924
+ADDRLP4 80
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+607152
+INDIRF4
+EQF4 $921
+LABELV $924
+ADDRGP4 $925
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $921
+ADDRLP4 68
+ADDRLP4 72
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $918
+JUMPV
+LABELV $917
+ADDRGP4 $926
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $918
+CNSTI4 2
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 demoCommandValue
+CALLV
+pop
+ADDRGP4 $916
+JUMPV
+LABELV $915
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $621
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $927
+CNSTI4 2
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+LTI4 $929
+ADDRLP4 84
+INDIRI4
+CNSTI4 3
+GEI4 $929
+ADDRGP4 demo+4+68
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 $930
+JUMPV
+LABELV $929
+ADDRGP4 $933
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $930
+ADDRGP4 $934
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 88
+ADDRGP4 demo+4+68
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $940
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+EQI4 $942
+ADDRLP4 88
+INDIRI4
+CNSTI4 2
+EQI4 $944
+ADDRGP4 $935
+JUMPV
+LABELV $940
+ADDRGP4 $941
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $936
+JUMPV
+LABELV $942
+ADDRGP4 $943
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $936
+JUMPV
+LABELV $935
+LABELV $944
+ADDRGP4 $945
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $936
+ADDRGP4 $946
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 CG_Q3mmeCameraResetInternalLengths
+CALLV
+pop
+ADDRGP4 $928
+JUMPV
+LABELV $927
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $622
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $947
+CNSTI4 2
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+LTI4 $949
+ADDRLP4 88
+INDIRI4
+CNSTI4 2
+GEI4 $949
+ADDRGP4 demo+4+72
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $950
+JUMPV
+LABELV $949
+ADDRGP4 $933
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $950
+ADDRGP4 $953
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 92
+ADDRGP4 demo+4+72
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $959
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+EQI4 $960
+ADDRGP4 $954
+JUMPV
+LABELV $959
+ADDRGP4 $941
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $955
+JUMPV
+LABELV $954
+LABELV $960
+ADDRGP4 $961
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $955
+ADDRGP4 $946
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $948
+JUMPV
+LABELV $947
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $964
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $962
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+CNSTI4 0
+EQI4 $965
+ADDRGP4 demo+80
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $972
+ADDRLP4 88
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+607152
+INDIRF4
+EQF4 $969
+LABELV $972
+ADDRGP4 $973
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $969
+CNSTI4 2
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 80
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+BXORI4
+ASGNI4
+ADDRGP4 $966
+JUMPV
+LABELV $965
+CNSTI4 2
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRGP4 demo+4+12
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BXORI4
+ASGNI4
+LABELV $966
+ADDRGP4 CG_Q3mmeCameraResetInternalLengths
+CALLV
+pop
+ADDRGP4 $963
+JUMPV
+LABELV $962
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $978
+ARGP4
+ADDRLP4 80
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $976
+CNSTI4 2
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 $981
+ARGP4
+ADDRLP4 100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $979
+ADDRGP4 demo+80
+INDIRI4
+ARGI4
+ADDRGP4 demo+80+4
+INDIRF4
+ARGF4
+ADDRLP4 84
+ARGP4
+ADDRGP4 CG_Q3mmeCameraOriginAt
+CALLI4
+pop
+ADDRLP4 84
+ADDRGP4 demo+88
+INDIRF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84+4
+ADDRGP4 demo+88+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84+8
+ADDRGP4 demo+88+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $980
+JUMPV
+LABELV $979
+CNSTI4 2
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 108
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 116
+INDIRF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 124
+INDIRF4
+ASGNF4
+LABELV $980
+ADDRLP4 84
+ARGP4
+ADDRGP4 cameraMoveAll
+CALLV
+pop
+ADDRGP4 $996
+ARGP4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 84+4
+INDIRF4
+ARGF4
+ADDRLP4 84+8
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $977
+JUMPV
+LABELV $976
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1001
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $999
+CNSTI4 2
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 104
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 88+4
+ADDRLP4 112
+INDIRF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 88+8
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRGP4 demo+88
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 cameraRotateAll
+CALLV
+pop
+ADDRGP4 $1005
+ARGP4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88+4
+INDIRF4
+ARGF4
+ADDRLP4 88+8
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1000
+JUMPV
+LABELV $999
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1010
+ARGP4
+ADDRLP4 88
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $1008
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+CNSTI4 0
+EQI4 $1011
+ADDRGP4 demo+80
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 cameraPointSynch
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 104
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1018
+ADDRLP4 104
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+607152
+INDIRF4
+EQF4 $1015
+LABELV $1018
+ADDRGP4 $1019
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $1015
+ADDRLP4 96
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1023
+JUMPV
+LABELV $1020
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 $593
+ARGP4
+ADDRLP4 112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $1024
+ADDRLP4 116
+ADDRLP4 92
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1024
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 $594
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $1026
+ADDRLP4 124
+ADDRLP4 92
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+ADDRGP4 $1027
+JUMPV
+LABELV $1026
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRGP4 $596
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $1028
+ADDRLP4 132
+ADDRLP4 92
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRGP4 $1029
+JUMPV
+LABELV $1028
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 $595
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $1030
+ADDRLP4 140
+ADDRLP4 92
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+CNSTI4 256
+BXORI4
+ASGNI4
+ADDRGP4 $1031
+JUMPV
+LABELV $1030
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $1032
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1031
+LABELV $1029
+LABELV $1027
+LABELV $1025
+LABELV $1021
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1023
+ADDRLP4 108
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $1020
+ADDRGP4 $1033
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 92
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1034
+ADDRGP4 $1036
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1034
+ADDRLP4 92
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1037
+ADDRGP4 $1039
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1037
+ADDRLP4 92
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1040
+ADDRGP4 $1042
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1040
+ADDRLP4 92
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1043
+ADDRGP4 $1045
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1043
+ADDRGP4 $1046
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1012
+JUMPV
+LABELV $1011
+ADDRGP4 $1047
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $1012
+ADDRGP4 CG_Q3mmeCameraResetInternalLengths
+CALLV
+pop
+ADDRGP4 $1009
+JUMPV
+LABELV $1008
+ADDRGP4 $1048
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1049
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1050
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1051
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1052
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1053
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1054
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1055
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1056
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1057
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1058
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1059
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1060
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1061
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1062
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1063
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1009
+LABELV $1000
+LABELV $977
+LABELV $963
+LABELV $948
+LABELV $928
+LABELV $916
+LABELV $903
+LABELV $887
+LABELV $883
+LABELV $875
+LABELV $863
+LABELV $850
+LABELV $832
+LABELV $811
+LABELV $787
+LABELV $765
+LABELV $755
+LABELV $736
+LABELV $733
+LABELV $712
+endproc CG_Q3mmeDemoCameraCommand_f 144 16
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+bss
+export demo
+align 4
+LABELV demo
+skip 116
+import BG_XMLParse
+import BG_XMLOpen
+import BG_XMLWarning
+import BG_XMLError
+import CG_FrameArenaInfo_f
+import CG_ResetFrameArena
+import CG_FrameArenaRelease
+import CG_FrameArenaMark
+import CG_FrameAlloc
+import CG_FreeMem
+import CG_CallocMem
+import CG_MallocMem
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1063
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 44
+byte 1 32
+byte 1 82
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1062
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 47
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 44
+byte 1 32
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1061
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1060
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 120
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1059
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 48
+byte 1 45
+byte 1 49
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 44
+byte 1 32
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1058
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 48
+byte 1 45
+byte 1 50
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 122
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1057
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 78
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 47
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 44
+byte 1 32
+byte 1 71
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1056
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 67
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1055
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 97
+byte 1 41
+byte 1 48
+byte 1 32
+byte 1 40
+byte 1 97
+byte 1 41
+byte 1 48
+byte 1 32
+byte 1 40
+byte 1 97
+byte 1 41
+byte 1 48
+byte 1 44
+byte 1 32
+byte 1 68
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1054
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1053
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 44
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1052
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 102
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1051
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1050
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 40
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $1049
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 44
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1048
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $1047
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $1046
+byte 1 10
+byte 1 0
+align 1
+LABELV $1045
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 0
+align 1
+LABELV $1042
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 0
+align 1
+LABELV $1039
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $1036
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 0
+align 1
+LABELV $1033
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $1032
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1019
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1010
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $1005
+byte 1 82
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1001
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $996
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $981
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $978
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $973
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $964
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $961
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $953
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 0
+align 1
+LABELV $946
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $945
+byte 1 98
+byte 1 101
+byte 1 122
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $943
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 45
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $941
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $934
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 0
+align 1
+LABELV $933
+byte 1 73
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $926
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $925
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $912
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $897
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $888
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $885
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $884
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $881
+byte 1 83
+byte 1 104
+byte 1 105
+byte 1 102
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $876
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $871
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $866
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $860
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $859
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $856
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $851
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $837
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $833
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $829
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $828
+byte 1 49
+byte 1 0
+align 1
+LABELV $827
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $816
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $812
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $805
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 51
+byte 1 100
+byte 1 0
+align 1
+LABELV $788
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $783
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 51
+byte 1 100
+byte 1 0
+align 1
+LABELV $782
+byte 1 67
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $766
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $763
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $762
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $757
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $756
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $753
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $752
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $737
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 0
+align 1
+LABELV $734
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $687
+byte 1 84
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 48
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $684
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $676
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $668
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $662
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $655
+byte 1 60
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $654
+byte 1 9
+byte 1 60
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $653
+byte 1 9
+byte 1 9
+byte 1 60
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 62
+byte 1 37
+byte 1 57
+byte 1 46
+byte 1 52
+byte 1 102
+byte 1 60
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $650
+byte 1 9
+byte 1 9
+byte 1 60
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 62
+byte 1 37
+byte 1 57
+byte 1 46
+byte 1 52
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 57
+byte 1 46
+byte 1 52
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 57
+byte 1 46
+byte 1 52
+byte 1 102
+byte 1 60
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $647
+byte 1 9
+byte 1 9
+byte 1 60
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 62
+byte 1 37
+byte 1 57
+byte 1 46
+byte 1 52
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 57
+byte 1 46
+byte 1 52
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 57
+byte 1 46
+byte 1 52
+byte 1 102
+byte 1 60
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $644
+byte 1 9
+byte 1 9
+byte 1 60
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 37
+byte 1 49
+byte 1 48
+byte 1 100
+byte 1 60
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $643
+byte 1 9
+byte 1 60
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $637
+byte 1 9
+byte 1 60
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 62
+byte 1 37
+byte 1 100
+byte 1 60
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $635
+byte 1 9
+byte 1 60
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 62
+byte 1 37
+byte 1 100
+byte 1 60
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $632
+byte 1 9
+byte 1 60
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 62
+byte 1 37
+byte 1 100
+byte 1 60
+byte 1 47
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $629
+byte 1 9
+byte 1 60
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 62
+byte 1 37
+byte 1 100
+byte 1 60
+byte 1 47
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $628
+byte 1 60
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $622
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $621
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $620
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $619
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $618
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $609
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 81
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $603
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $596
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $595
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $594
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $593
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $589
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $551
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 102
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $538
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 102
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $466
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 0
+align 1
+LABELV $155
+byte 1 94
+byte 1 54
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
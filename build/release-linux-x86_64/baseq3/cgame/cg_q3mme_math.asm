@@ -0,0 +1,9043 @@
+code
+proc AngleForward 36 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $36
+endproc AngleForward 36 4
+proc QuatDot 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRLP4 16
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $37
+endproc QuatDot 20 0
+proc QuatCopy 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $38
+endproc QuatCopy 12 0
+proc QuatNegate 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $39
+endproc QuatNegate 12 0
+proc QuatConjugate 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $40
+endproc QuatConjugate 12 0
+proc QuatAdd 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $41
+endproc QuatAdd 12 0
+proc QuatSub 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $42
+endproc QuatSub 12 0
+proc QuatScale 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $43
+endproc QuatScale 12 0
+proc QuatScaleAdd 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $44
+endproc QuatScaleAdd 12 0
+proc QuatLengthSquared 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $45
+endproc QuatLengthSquared 20 0
+proc QuatLength 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+RETF4
+LABELV $46
+endproc QuatLength 24 4
+proc QuatClear 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $47
+endproc QuatClear 8 0
+proc QuatNormalize 28 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 QuatLength
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $49
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $50
+JUMPV
+LABELV $49
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 QuatClear
+CALLV
+pop
+LABELV $50
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $48
+endproc QuatNormalize 28 4
+proc posMatrix 52 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $55
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $57
+ADDRGP4 $52
+JUMPV
+LABELV $55
+ADDRFP4 8
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $53
+JUMPV
+LABELV $56
+ADDRFP4 8
+INDIRP4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRF4
+NEGF4
+CNSTF4 1073741824
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1056964608
+CNSTF4 1073741824
+CNSTF4 1084227584
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1077936128
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1077936128
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRF4
+NEGF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $53
+JUMPV
+LABELV $52
+LABELV $57
+ADDRLP4 28
+CNSTF4 1077936128
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRF4
+NEGF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1086324736
+DIVF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1086324736
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1077936128
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDF4
+ADDRLP4 36
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1077936128
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 3225419776
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRLP4 44
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRLP4 44
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1086324736
+DIVF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+CNSTF4 1086324736
+DIVF4
+ASGNF4
+LABELV $53
+LABELV $51
+endproc posMatrix 52 0
+proc posGet 60 12
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 posMatrix
+CALLV
+pop
+ADDRFP4 12
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $58
+endproc posGet 60 12
+proc VectorDistanceSquared 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $68
+endproc VectorDistanceSquared 32 0
+proc VectorDistance 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+RETF4
+LABELV $75
+endproc VectorDistance 36 4
+proc AnglesNormalize360 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 AngleNormalize360
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleNormalize360
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleNormalize360
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $82
+endproc AnglesNormalize360 24 4
+proc AnglesNormalize180 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $83
+endproc AnglesNormalize180 24 4
+proc GetPerpendicularViewVector 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $192
+endproc GetPerpendicularViewVector 56 12
+proc AxisToAngles 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEF4 $198
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEF4 $198
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LEF4 $200
+ADDRLP4 8
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $199
+JUMPV
+LABELV $200
+ADDRLP4 8
+CNSTF4 1132920832
+ASGNF4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 0
+EQF4 $202
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1127481344
+ADDRLP4 28
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $203
+JUMPV
+LABELV $202
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $204
+ADDRLP4 4
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRLP4 4
+CNSTF4 1132920832
+ASGNF4
+LABELV $205
+LABELV $203
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $206
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $206
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1127481344
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $208
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1127481344
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $210
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $210
+LABELV $199
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+LABELV $197
+endproc AxisToAngles 52 8
+export QuatMultiply
+proc QuatMultiply 80 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 12
+ASGNI4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 48
+CNSTI4 12
+ASGNI4
+ADDRLP4 56
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 8
+ASGNI4
+ADDRLP4 68
+CNSTI4 12
+ASGNI4
+ADDRLP4 76
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $212
+endproc QuatMultiply 80 0
+export QuatFromAxisAngle
+proc QuatFromAxisAngle 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 1056964608
+CNSTF4 1078530011
+ADDRFP4 4
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $213
+endproc QuatFromAxisAngle 24 4
+export QuatFromAngles
+proc QuatFromAngles 60 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTF4 1056964608
+CNSTF4 1078530011
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1056964608
+CNSTF4 1078530011
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1056964608
+CNSTF4 1078530011
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $214
+endproc QuatFromAngles 60 4
+export QuatFromAnglesClosest
+proc QuatFromAnglesClosest 44 12
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 QuatFromAngles
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatAdd
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 QuatSub
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 QuatLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 36
+ADDRGP4 QuatLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+GEF4 $216
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 QuatNegate
+CALLV
+pop
+LABELV $216
+LABELV $215
+endproc QuatFromAnglesClosest 44 12
+export QuatToAxisAngle
+proc QuatToAxisAngle 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 925353388
+LEF4 $219
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 acos
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LSHI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRFP4 8
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $220
+LABELV $218
+endproc QuatToAxisAngle 40 4
+export QuatToAxis
+proc QuatToAxis 48 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 1073741824
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1073741824
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1073741824
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ADDRLP4 36
+INDIRF4
+SUBF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+SUBF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+SUBF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $221
+endproc QuatToAxis 48 0
+export QuatToAngles
+proc QuatToAngles 36 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AxisToAngles
+CALLV
+pop
+LABELV $222
+endproc QuatToAngles 36 8
+export QuatLog
+proc QuatLog 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+GEF4 $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 acos
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 944879383
+LTF4 $226
+ADDRLP4 24
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $223
+JUMPV
+LABELV $226
+LABELV $224
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $223
+endproc QuatLog 36 4
+export QuatExp
+proc QuatExp 52 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 944879383
+LTF4 $229
+ADDRLP4 40
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $230
+LABELV $228
+endproc QuatExp 52 4
+proc QuatSquadPoint 64 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 QuatConjugate
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 QuatLog
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 QuatLog
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatAdd
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTF4 3196059648
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 QuatScale
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatExp
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+LABELV $231
+endproc QuatSquadPoint 64 12
+export QuatSlerp
+proc QuatSlerp 48 16
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 QuatDot
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 acos
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 925353388
+LTF4 $233
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ADDRLP4 32
+INDIRF4
+DIVF4
+ASGNF4
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 36
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 40
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 QuatScale
+CALLV
+pop
+ADDRLP4 44
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 QuatScaleAdd
+CALLV
+pop
+ADDRGP4 $234
+JUMPV
+LABELV $233
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 QuatCopy
+CALLV
+pop
+LABELV $234
+LABELV $232
+endproc QuatSlerp 48 16
+export QuatSquad
+proc QuatSquad 68 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatSquadPoint
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 QuatSquadPoint
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 QuatSlerp
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 QuatSlerp
+CALLV
+pop
+CNSTF4 1073741824
+ADDRFP4 0
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRF4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 QuatSlerp
+CALLV
+pop
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 QuatNormalize
+CALLF4
+pop
+LABELV $235
+endproc QuatSquad 68 16
+export QuatTimeSpline
+proc QuatTimeSpline 152 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 QuatConjugate
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 QuatLog
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 QuatConjugate
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 QuatLog
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 QuatConjugate
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRGP4 QuatLog
+CALLV
+pop
+ADDRLP4 124
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 128
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 124
+INDIRP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 136
+INDIRP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 140
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 140
+INDIRI4
+ADDRLP4 136
+INDIRP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 124
+INDIRP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 88
+ARGP4
+CNSTF4 1065353216
+ADDRLP4 132
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatScale
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTF4 3204448256
+ADDRLP4 48
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatScaleAdd
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTF4 1056964608
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatScale
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatExp
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 52
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatScale
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 52
+INDIRF4
+MULF4
+CNSTF4 1065353216
+SUBF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatScaleAdd
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTF4 1056964608
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatScale
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatExp
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatSlerp
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 QuatSlerp
+CALLV
+pop
+CNSTF4 1073741824
+ADDRFP4 0
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRF4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 QuatSlerp
+CALLV
+pop
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 QuatNormalize
+CALLF4
+pop
+LABELV $236
+endproc QuatTimeSpline 152 16
+export QuatTimeSpline2
+proc QuatTimeSpline2 128 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 QuatConjugate
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 QuatLog
+CALLV
+pop
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 QuatConjugate
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 QuatLog
+CALLV
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 QuatConjugate
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 QuatLog
+CALLV
+pop
+ADDRLP4 48
+ADDRFP4 12
+INDIRI4
+ADDRFP4 8
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 12
+INDIRI4
+ADDRFP4 4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatAdd
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatScale
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatSub
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTF4 1056964608
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatScale
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatExp
+CALLV
+pop
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+ADDRLP4 48
+ADDRFP4 12
+INDIRI4
+ADDRFP4 8
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 16
+INDIRI4
+ADDRFP4 8
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 68
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatAdd
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatScale
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatSub
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTF4 1056964608
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatScale
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatExp
+CALLV
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRGP4 QuatMultiply
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 QuatSlerp
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 QuatSlerp
+CALLV
+pop
+CNSTF4 1073741824
+ADDRFP4 0
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRF4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRGP4 QuatSlerp
+CALLV
+pop
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRGP4 QuatNormalize
+CALLF4
+pop
+LABELV $237
+endproc QuatTimeSpline2 128 16
+export VectorTimeSpline
+proc VectorTimeSpline 236 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $239
+ADDRLP4 176
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 176
+INDIRI4
+LSHI4
+ADDRLP4 100
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDI4
+ADDRLP4 176
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDI4
+ADDRLP4 176
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 192
+CNSTI4 2
+ASGNI4
+ADDRLP4 200
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 192
+INDIRI4
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRLP4 200
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 192
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 200
+INDIRI4
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDI4
+ADDRLP4 192
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRLP4 132
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $240
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $242
+ADDRLP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+LTI4 $239
+ADDRLP4 176
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 180
+ADDRLP4 176
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 168
+ADDRLP4 180
+INDIRI4
+ADDRLP4 184
+INDIRP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 180
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 184
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 176
+INDIRP4
+INDIRI4
+ADDRLP4 188
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $246
+JUMPV
+LABELV $243
+ADDRLP4 192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 36
+ADDP4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 100
+ADDP4
+INDIRF4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 196
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDRLP4 196
+INDIRI4
+ADDRLP4 132
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+LABELV $244
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $246
+ADDRLP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+LTI4 $243
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $247
+ADDRLP4 192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+CNSTF4 3221225472
+ADDRLP4 192
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 36
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 204
+ADDRLP4 200
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ADDRLP4 204
+INDIRP4
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 200
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 200
+INDIRI4
+ADDRLP4 36
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1077936128
+ADDRLP4 200
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ADDRLP4 208
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 212
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 216
+ADDRLP4 212
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ADDRLP4 216
+INDIRP4
+INDIRF4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 36
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 220
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ADDRLP4 220
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+CNSTI4 2
+ASGNI4
+ADDRLP4 232
+ADDRLP4 0
+INDIRI4
+ADDRLP4 228
+INDIRI4
+LSHI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ADDRLP4 232
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ADDRLP4 228
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $248
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $250
+ADDRLP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+LTI4 $247
+LABELV $238
+endproc VectorTimeSpline 236 0
+export bezierInterpolate
+proc bezierInterpolate 84 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 24
+CNSTF4 1086324736
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+NEGF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 3225419776
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1086324736
+DIVF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+CNSTF4 1086324736
+DIVF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $251
+endproc bezierInterpolate 84 0
+export linearInterpolate
+proc linearInterpolate 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $264
+endproc linearInterpolate 20 0
+proc dsMax 0 0
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+LEF4 $270
+ADDRFP4 4
+INDIRF4
+RETF4
+ADDRGP4 $269
+JUMPV
+LABELV $270
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $269
+endproc dsMax 0 0
+proc dsMin 0 0
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+GEF4 $273
+ADDRFP4 4
+INDIRF4
+RETF4
+ADDRGP4 $272
+JUMPV
+LABELV $273
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $272
+endproc dsMin 0 0
+proc dsplineTangent 64 8
+ADDRLP4 8
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 0
+NEF4 $276
+CNSTF4 0
+RETF4
+ADDRGP4 $275
+JUMPV
+LABELV $276
+ADDRLP4 12
+CNSTF4 1077936128
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 dsMax
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 dsMin
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+DIVF4
+RETF4
+LABELV $275
+endproc dsplineTangent 64 8
+export dsplineCalc
+proc dsplineCalc 88 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 dsplineTangent
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 dsplineTangent
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 4
+ASGNI4
+ADDRLP4 68
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+NEGF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $279
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1073741824
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1077936128
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $279
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+MULF4
+RETF4
+LABELV $278
+endproc dsplineCalc 88 16
+export demoDrawSetupVerts
+proc demoDrawSetupVerts 68 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $282
+ADDRLP4 8
+CNSTF4 1132396544
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+LTF4 $287
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $288
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+CNSTF4 1132396544
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LTF4 $290
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $291
+JUMPV
+LABELV $290
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $291
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 16
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $293
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $294
+JUMPV
+LABELV $293
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $294
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTF4 1132396544
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LTF4 $296
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $297
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+ADDRLP4 40
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $299
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 $300
+JUMPV
+LABELV $299
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+LABELV $300
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $302
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 $303
+JUMPV
+LABELV $302
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+LABELV $303
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $283
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $282
+LABELV $281
+endproc demoDrawSetupVerts 68 0
+export demoDrawRawLine
+proc demoDrawRawLine 52 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1120403456
+GEF4 $311
+ADDRGP4 $304
+JUMPV
+LABELV $311
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 GetPerpendicularViewVector
+CALLV
+pop
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cgs+632912+1317476
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $304
+endproc demoDrawRawLine 52 16
+export demoDrawLine
+proc demoDrawLine 96 16
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 demoDrawSetupVerts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 demoDrawRawLine
+CALLV
+pop
+LABELV $327
+endproc demoDrawLine 96 16
+export demoDrawCross
+proc demoDrawCross 136 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 demoDrawSetupVerts
+CALLV
+pop
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRGP4 $332
+JUMPV
+LABELV $329
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 128
+ADDRLP4 0
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 0
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRLP4 16
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1058642330
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 demoDrawRawLine
+CALLV
+pop
+LABELV $330
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+LABELV $332
+ADDRLP4 0
+INDIRU4
+CNSTU4 3
+LTU4 $329
+LABELV $328
+endproc demoDrawCross 136 16
+export demoDrawBox
+proc demoDrawBox 224 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 100
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 demoDrawSetupVerts
+CALLV
+pop
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRGP4 $337
+JUMPV
+LABELV $334
+ADDRLP4 0
+INDIRU4
+CNSTU4 2
+BANDU4
+CNSTU4 0
+EQU4 $339
+ADDRLP4 196
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $340
+JUMPV
+LABELV $339
+ADDRLP4 196
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $340
+CNSTU4 12
+ADDRLP4 0
+INDIRU4
+MULU4
+ADDRLP4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+ADDU4
+CNSTU4 2
+BANDU4
+CNSTU4 0
+EQU4 $343
+ADDRLP4 204
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $344
+JUMPV
+LABELV $343
+ADDRLP4 204
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $344
+CNSTU4 12
+ADDRLP4 0
+INDIRU4
+MULU4
+ADDRLP4 4+4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 204
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 216
+CNSTI4 2
+ASGNI4
+CNSTU4 12
+ADDRLP4 0
+INDIRU4
+MULU4
+ADDRLP4 4+8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRU4
+ADDRLP4 216
+INDIRI4
+RSHU4
+ADDRLP4 216
+INDIRI4
+LSHU4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $335
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+LABELV $337
+ADDRLP4 0
+INDIRU4
+CNSTU4 8
+LTU4 $334
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRGP4 $349
+JUMPV
+LABELV $346
+ADDRLP4 196
+CNSTU4 12
+ASGNU4
+ADDRLP4 196
+INDIRU4
+ADDRLP4 0
+INDIRU4
+MULU4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 196
+INDIRU4
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+ADDU4
+CNSTU4 3
+BANDU4
+MULU4
+ADDRLP4 4
+ADDP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 100
+ARGP4
+ADDRGP4 demoDrawRawLine
+CALLV
+pop
+ADDRLP4 204
+CNSTU4 12
+ASGNU4
+ADDRLP4 212
+CNSTU4 4
+ASGNU4
+ADDRLP4 204
+INDIRU4
+ADDRLP4 0
+INDIRU4
+ADDRLP4 212
+INDIRU4
+ADDU4
+MULU4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 204
+INDIRU4
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+ADDU4
+CNSTU4 3
+BANDU4
+ADDRLP4 212
+INDIRU4
+ADDU4
+MULU4
+ADDRLP4 4
+ADDP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 100
+ARGP4
+ADDRGP4 demoDrawRawLine
+CALLV
+pop
+ADDRLP4 216
+CNSTU4 12
+ASGNU4
+ADDRLP4 216
+INDIRU4
+ADDRLP4 0
+INDIRU4
+MULU4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 216
+INDIRU4
+ADDRLP4 0
+INDIRU4
+CNSTU4 4
+ADDU4
+MULU4
+ADDRLP4 4
+ADDP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 100
+ARGP4
+ADDRGP4 demoDrawRawLine
+CALLV
+pop
+LABELV $347
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+LABELV $349
+ADDRLP4 0
+INDIRU4
+CNSTU4 4
+LTU4 $346
+LABELV $333
+endproc demoDrawBox 224 16
+proc drawGridLine 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 GetPerpendicularViewVector
+CALLV
+pop
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $350
+endproc drawGridLine 20 16
+export demoDrawGrid
+proc demoDrawGrid 176 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 demoDrawSetupVerts
+CALLV
+pop
+ADDRLP4 148
+ADDRFP4 20
+INDIRF4
+ADDRFP4 16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+CNSTF4 1124073472
+LEF4 $362
+ADDRLP4 148
+CNSTF4 1124073472
+ASGNF4
+ADDRFP4 20
+ADDRFP4 16
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+LABELV $362
+ADDRLP4 148
+CNSTF4 1073741824
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $364
+ADDRLP4 152
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 152
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 160
+ADDRGP4 Q_fmodf
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRI4
+ADDRLP4 136
+ADDP4
+ADDRLP4 152
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 164
+INDIRI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ADDRFP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 168
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 168
+INDIRI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ADDRFP4 20
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $365
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 3
+LTI4 $364
+ADDRLP4 36+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 36+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 36+48+12
+ADDRLP4 148
+INDIRF4
+CNSTF4 0
+ADDF4
+ASGNF4
+ADDRLP4 36+72+12
+ADDRLP4 148
+INDIRF4
+CNSTF4 0
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $378
+JUMPV
+LABELV $375
+ADDRLP4 0
+ADDRLP4 24+4
+INDIRF4
+ASGNF4
+ADDRGP4 $382
+JUMPV
+LABELV $379
+ADDRLP4 152
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 152+4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 152+8
+ADDRLP4 24+8
+INDIRF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 164+8
+ADDRLP4 8+8
+INDIRF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 drawGridLine
+CALLV
+pop
+LABELV $380
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $382
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8+4
+INDIRF4
+LTF4 $379
+LABELV $376
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $378
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LTF4 $375
+ADDRLP4 20
+ADDRLP4 24+8
+INDIRF4
+ASGNF4
+ADDRGP4 $394
+JUMPV
+LABELV $391
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $400
+JUMPV
+LABELV $397
+ADDRLP4 152
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 152+4
+ADDRLP4 24+4
+INDIRF4
+ASGNF4
+ADDRLP4 152+8
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 8+4
+INDIRF4
+ASGNF4
+ADDRLP4 164+8
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 drawGridLine
+CALLV
+pop
+LABELV $398
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $400
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LTF4 $397
+ADDRLP4 0
+ADDRLP4 24+4
+INDIRF4
+ASGNF4
+ADDRGP4 $410
+JUMPV
+LABELV $407
+ADDRLP4 152
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 152+4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 152+8
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 164+8
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 drawGridLine
+CALLV
+pop
+LABELV $408
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $410
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8+4
+INDIRF4
+LTF4 $407
+LABELV $392
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $394
+ADDRLP4 20
+INDIRF4
+ADDRLP4 8+8
+INDIRF4
+LTF4 $391
+LABELV $361
+endproc demoDrawGrid 176 20
+export demoRotatePoint
+proc demoRotatePoint 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $417
+endproc demoRotatePoint 28 0
+export demoTransposeMatrix
+proc demoTransposeMatrix 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $425
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $429
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $430
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $429
+LABELV $426
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $425
+LABELV $424
+endproc demoTransposeMatrix 24 0
+export demoCreateRotationMatrix
+proc demoCreateRotationMatrix 4 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+LABELV $433
+endproc demoCreateRotationMatrix 4 16
+import acos
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import demoJitterCreate
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
@@ -0,0 +1,41175 @@
+data
+align 4
+LABELV parsingEmitterScriptLevel
+byte 4 0
+export EmitterScript
+align 4
+LABELV EmitterScript
+byte 4 0
+export PlainScript
+align 4
+LABELV PlainScript
+byte 4 0
+export DistanceScript
+align 4
+LABELV DistanceScript
+byte 4 0
+align 4
+LABELV ScriptJustParsing
+byte 4 0
+align 4
+LABELV EmittedEntities
+byte 4 0
+align 4
+LABELV fxTokens
+byte 4 0
+byte 4 0
+address $152
+byte 4 1
+address $153
+byte 4 2
+address $154
+byte 4 3
+address $155
+byte 4 4
+address $156
+byte 4 5
+address $157
+byte 4 6
+address $158
+byte 4 7
+address $159
+byte 4 8
+address $160
+byte 4 9
+address $161
+byte 4 10
+address $162
+byte 4 11
+address $163
+byte 4 12
+address $164
+byte 4 13
+address $165
+byte 4 14
+address $166
+byte 4 15
+address $167
+byte 4 16
+address $168
+byte 4 17
+address $169
+byte 4 18
+address $170
+byte 4 19
+address $171
+byte 4 20
+address $172
+byte 4 21
+address $173
+byte 4 22
+address $174
+byte 4 23
+address $175
+byte 4 24
+address $176
+byte 4 25
+address $177
+byte 4 26
+address $178
+byte 4 27
+address $179
+byte 4 28
+address $180
+byte 4 29
+address $181
+byte 4 30
+address $182
+byte 4 31
+address $183
+byte 4 32
+address $184
+byte 4 33
+address $185
+byte 4 34
+address $186
+byte 4 35
+address $187
+byte 4 36
+address $188
+byte 4 37
+address $189
+byte 4 38
+address $190
+byte 4 39
+address $191
+byte 4 40
+address $192
+byte 4 41
+address $193
+byte 4 42
+address $194
+byte 4 43
+address $195
+byte 4 44
+address $196
+byte 4 45
+address $197
+byte 4 46
+address $198
+byte 4 47
+address $199
+byte 4 48
+address $200
+byte 4 49
+address $201
+byte 4 50
+address $202
+byte 4 51
+address $203
+byte 4 52
+address $204
+byte 4 53
+address $205
+byte 4 54
+address $206
+byte 4 55
+address $207
+byte 4 56
+address $208
+byte 4 57
+address $209
+byte 4 58
+address $210
+byte 4 59
+address $211
+byte 4 60
+address $212
+byte 4 61
+address $213
+byte 4 62
+address $214
+byte 4 63
+address $215
+byte 4 64
+address $216
+byte 4 65
+address $217
+byte 4 66
+address $218
+byte 4 67
+address $219
+byte 4 68
+address $220
+byte 4 69
+address $221
+byte 4 70
+address $222
+byte 4 71
+address $223
+byte 4 72
+address $224
+byte 4 73
+address $225
+byte 4 74
+address $226
+byte 4 75
+address $227
+byte 4 76
+address $228
+byte 4 77
+address $229
+byte 4 78
+address $230
+byte 4 79
+address $231
+byte 4 80
+address $232
+byte 4 81
+address $233
+byte 4 82
+address $234
+byte 4 83
+address $235
+byte 4 84
+address $236
+byte 4 85
+address $237
+byte 4 86
+address $238
+byte 4 87
+address $239
+byte 4 88
+address $240
+byte 4 89
+address $241
+byte 4 90
+address $242
+byte 4 91
+address $243
+byte 4 92
+address $244
+byte 4 93
+address $245
+byte 4 94
+address $246
+byte 4 95
+address $247
+byte 4 96
+address $248
+byte 4 97
+address $249
+byte 4 98
+address $250
+byte 4 99
+address $251
+byte 4 100
+address $252
+byte 4 101
+address $253
+byte 4 102
+address $254
+byte 4 103
+address $255
+byte 4 104
+address $256
+byte 4 105
+address $257
+byte 4 106
+address $258
+byte 4 107
+address $259
+byte 4 108
+address $260
+byte 4 109
+address $261
+byte 4 110
+address $262
+byte 4 111
+address $263
+byte 4 112
+address $264
+byte 4 113
+address $265
+byte 4 114
+address $266
+byte 4 115
+address $267
+byte 4 116
+address $268
+byte 4 117
+address $269
+byte 4 118
+address $270
+byte 4 119
+address $271
+byte 4 120
+address $272
+byte 4 121
+address $273
+byte 4 122
+address $274
+byte 4 123
+address $275
+byte 4 124
+address $276
+byte 4 125
+address $277
+byte 4 126
+address $278
+byte 4 127
+address $279
+byte 4 128
+address $280
+byte 4 129
+address $281
+byte 4 130
+address $282
+byte 4 132
+address $283
+byte 4 131
+address $284
+byte 4 133
+address $285
+byte 4 134
+address $286
+byte 4 135
+address $287
+byte 4 136
+address $288
+byte 4 137
+address $289
+byte 4 138
+address $290
+byte 4 139
+address $291
+byte 4 140
+address $292
+byte 4 141
+address $293
+byte 4 142
+address $294
+byte 4 143
+address $295
+byte 4 144
+address $296
+byte 4 145
+address $297
+byte 4 146
+address $298
+byte 4 147
+address $299
+byte 4 148
+address $300
+byte 4 149
+address $301
+byte 4 150
+address $302
+byte 4 124
+address $303
+byte 4 152
+address $304
+byte 4 153
+address $305
+byte 4 154
+address $306
+byte 4 143
+address $307
+byte 4 155
+address $308
+byte 4 156
+address $309
+byte 4 157
+address $310
+byte 4 158
+address $311
+byte 4 159
+address $312
+byte 4 160
+address $313
+byte 4 161
+address $314
+byte 4 162
+address $315
+byte 4 163
+address $316
+byte 4 164
+address $317
+byte 4 165
+address $318
+byte 4 166
+address $319
+byte 4 167
+address $320
+byte 4 168
+address $321
+byte 4 169
+address $322
+byte 4 170
+address $323
+byte 4 171
+address $324
+byte 4 172
+address $325
+byte 4 173
+address $326
+byte 4 174
+address $327
+byte 4 175
+address $328
+byte 4 176
+address $329
+byte 4 177
+address $330
+byte 4 178
+address $331
+byte 4 179
+address $332
+byte 4 180
+address $333
+byte 4 181
+address $334
+byte 4 182
+address $335
+byte 4 183
+address $336
+byte 4 184
+address $337
+byte 4 185
+address $338
+byte 4 186
+address $339
+byte 4 187
+address $340
+byte 4 189
+address $341
+byte 4 190
+address $342
+byte 4 191
+address $343
+byte 4 192
+address $344
+byte 4 193
+address $345
+byte 4 194
+address $346
+byte 4 195
+address $347
+byte 4 196
+address $348
+byte 4 197
+address $349
+byte 4 198
+address $350
+byte 4 199
+address $351
+byte 4 200
+address $352
+byte 4 201
+address $353
+byte 4 202
+address $354
+byte 4 203
+address $355
+byte 4 204
+address $356
+byte 4 205
+address $357
+byte 4 206
+address $358
+byte 4 207
+address $359
+byte 4 209
+address $360
+byte 4 210
+address $361
+byte 4 212
+address $362
+byte 4 211
+address $363
+byte 4 213
+address $364
+byte 4 214
+address $365
+byte 4 215
+bss
+align 1
+LABELV $367
+skip 1024
+code
+proc PrintShort 4 12
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+CNSTU4 1024
+LTU4 $368
+ADDRLP4 0
+CNSTI4 1024
+ASGNI4
+ADDRGP4 $369
+JUMPV
+LABELV $368
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $369
+ADDRGP4 $367
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $367
+RETP4
+LABELV $366
+endproc PrintShort 4 12
+proc CG_GetFxTokenExt 48 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $371
+ADDRGP4 $373
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $370
+JUMPV
+LABELV $371
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 EffectScripts+24
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_fxCompiled+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $375
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $375
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 EffectScripts+8290668
+CVPU4 4
+GEU4 $375
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 EffectScripts+8308080
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $376
+JUMPV
+LABELV $375
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+LABELV $376
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $380
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $380
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $382
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $370
+JUMPV
+LABELV $380
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_GetToken
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_fxCompiled+12
+INDIRI4
+CNSTI4 1
+LEI4 $384
+ADDRGP4 $387
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 EffectScripts+8290668
+CVPU4 4
+GEU4 $396
+ADDRLP4 28
+CNSTI4 54
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 28
+CNSTI4 51
+ASGNI4
+LABELV $397
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 EffectScripts+8290668
+CVPU4 4
+GEU4 $398
+ADDRLP4 32
+ADDRGP4 $391
+ASGNP4
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRLP4 32
+ADDRGP4 $392
+ASGNP4
+LABELV $399
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 EffectScripts+8290668
+CVPU4 4
+GEU4 $400
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $401
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $384
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $402
+CNSTU4 24
+ARGU4
+ADDRLP4 32
+ADDRGP4 CG_CallocMem
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 EffectScripts+8308080
+ADDP4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 EffectScripts+8308080
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $406
+ADDRGP4 $408
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+RETP4
+ADDRGP4 $370
+JUMPV
+LABELV $406
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 46
+EQI4 $411
+ADDRLP4 40
+INDIRI4
+CNSTI4 48
+LTI4 $409
+ADDRLP4 40
+INDIRI4
+CNSTI4 57
+GTI4 $409
+LABELV $411
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 151
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 $415
+JUMPV
+LABELV $412
+ADDRLP4 28
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 fxTokens
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $416
+ADDRGP4 $413
+JUMPV
+LABELV $416
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 fxTokens
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $418
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 28
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 fxTokens+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $414
+JUMPV
+LABELV $418
+LABELV $413
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $415
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+CNSTU4 215
+LTU4 $412
+LABELV $414
+LABELV $410
+LABELV $402
+ADDRLP4 8
+INDIRP4
+RETP4
+LABELV $370
+endproc CG_GetFxTokenExt 48 24
+export CG_FreeFxJitTokens
+proc CG_FreeFxJitTokens 16 8
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $425
+JUMPV
+LABELV $422
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 EffectScripts+8308080
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $429
+ADDRGP4 $423
+JUMPV
+LABELV $429
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+CNSTU4 24
+ADDU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeMem
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 EffectScripts+8308080
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $423
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $425
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 4194724
+LTU4 $422
+ADDRGP4 $432
+ARGP4
+CNSTF4 1073741824
+ADDRLP4 8
+INDIRU4
+CNSTI4 1
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 8
+INDIRU4
+CNSTU4 1
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+CNSTF4 1233125376
+DIVF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $421
+endproc CG_FreeFxJitTokens 16 8
+proc CG_GetFxToken 8 24
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_GetFxTokenExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $433
+endproc CG_GetFxToken 8 24
+proc CG_AllocFxEntity 8 4
+ADDRLP4 4
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $435
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_MakeLowPriorityEntity
+CALLV
+pop
+LABELV $435
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $434
+endproc CG_AllocFxEntity 8 4
+data
+export QstrcmpCount
+align 4
+LABELV QstrcmpCount
+byte 4 0
+code
+proc Q_stricmpt 8 8
+ADDRLP4 0
+ADDRGP4 QstrcmpCount
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $437
+endproc Q_stricmpt 8 8
+data
+align 4
+LABELV $439
+byte 4 0
+align 4
+LABELV $440
+byte 4 0
+code
+proc CG_Q3mmeMathExt 1748 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 1108
+CNSTI4 0
+ASGNI4
+ADDRLP4 1124
+ADDRGP4 $439
+ASGNP4
+ADDRLP4 1128
+CNSTI4 1
+ASGNI4
+ADDRLP4 1124
+INDIRP4
+ADDRLP4 1124
+INDIRP4
+INDIRI4
+ADDRLP4 1128
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1132
+ADDRGP4 $440
+ASGNP4
+ADDRLP4 1132
+INDIRP4
+ADDRLP4 1132
+INDIRP4
+INDIRI4
+ADDRLP4 1128
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1136
+CNSTI4 0
+ASGNI4
+ADDRLP4 1116
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRGP4 $442
+JUMPV
+LABELV $441
+ADDRLP4 1144
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 1144
+INDIRU4
+CNSTU4 0
+EQU4 $444
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 1144
+INDIRU4
+LTU4 $444
+ADDRGP4 $443
+JUMPV
+LABELV $444
+ADDRLP4 1140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $446
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1112
+ARGP4
+ADDRLP4 1108
+ARGP4
+ADDRLP4 1120
+ARGP4
+ADDRLP4 1148
+ADDRGP4 CG_GetFxTokenExt
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 1148
+INDIRP4
+ASGNP4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1112
+ARGP4
+ADDRLP4 1148
+ADDRGP4 CG_GetToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 1148
+INDIRP4
+ASGNP4
+ADDRLP4 1108
+CNSTI4 0
+ASGNI4
+LABELV $447
+ADDRLP4 1148
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 1148
+INDIRU4
+CNSTU4 0
+EQU4 $448
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 1148
+INDIRU4
+LEU4 $448
+ADDRFP4 0
+ADDRLP4 1140
+INDIRP4
+ASGNP4
+ADDRGP4 $443
+JUMPV
+LABELV $448
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+EQI4 $450
+ADDRGP4 $452
+ARGP4
+ADDRLP4 1044
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1112
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $450
+ADDRLP4 1152
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+CNSTI4 0
+EQI4 $455
+ADDRLP4 1152
+INDIRI4
+CNSTI4 123
+NEI4 $453
+LABELV $455
+ADDRGP4 $443
+JUMPV
+LABELV $453
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 40
+NEI4 $456
+ADDRLP4 1156
+CNSTI4 1
+ASGNI4
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $459
+JUMPV
+LABELV $458
+ADDRLP4 1036
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 40
+NEI4 $461
+ADDRLP4 1156
+ADDRLP4 1156
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $462
+JUMPV
+LABELV $461
+ADDRLP4 1036
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 41
+NEI4 $463
+ADDRLP4 1156
+ADDRLP4 1156
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $463
+LABELV $462
+ADDRLP4 1036
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 9
+NEI4 $465
+ADDRLP4 1036
+ADDRLP4 1036
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $459
+JUMPV
+LABELV $465
+ADDRLP4 1164
+CNSTI4 0
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 1164
+INDIRI4
+EQI4 $472
+ADDRLP4 1168
+ADDRLP4 1036
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 1164
+INDIRI4
+EQI4 $472
+ADDRLP4 1168
+INDIRI4
+CNSTI4 10
+EQI4 $472
+ADDRLP4 1168
+INDIRI4
+CNSTI4 32
+LTI4 $472
+ADDRLP4 1168
+INDIRI4
+CNSTI4 126
+LEI4 $467
+LABELV $472
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1160
+ARGP4
+ADDRLP4 1040
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Q3mmeMathExt
+CALLP4
+pop
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $473
+ADDRFP4 12
+INDIRP4
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 1172
+ADDRGP4 $439
+ASGNP4
+ADDRLP4 1172
+INDIRP4
+ADDRLP4 1172
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $438
+JUMPV
+LABELV $473
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+CNSTI4 256
+LTI4 $475
+ADDRGP4 $477
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRFP4 0
+ADDRLP4 1036
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $460
+JUMPV
+LABELV $475
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1160
+INDIRF4
+ASGNF4
+ADDRLP4 1172
+CNSTI4 1
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+ADDRLP4 1172
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 1036
+INDIRP4
+ADDRLP4 1172
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $460
+JUMPV
+LABELV $467
+ADDRLP4 1036
+ADDRLP4 1036
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $459
+ADDRGP4 $458
+JUMPV
+LABELV $460
+LABELV $456
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+EQI4 $478
+ADDRLP4 1156
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+CNSTI4 1
+LTI4 $480
+ADDRLP4 1156
+INDIRI4
+CNSTI4 215
+GTI4 $480
+ADDRLP4 1156
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $795-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $795
+address $697
+address $695
+address $693
+address $480
+address $691
+address $480
+address $480
+address $711
+address $709
+address $707
+address $535
+address $537
+address $539
+address $541
+address $543
+address $545
+address $547
+address $549
+address $551
+address $553
+address $659
+address $661
+address $663
+address $665
+address $667
+address $669
+address $671
+address $673
+address $635
+address $637
+address $639
+address $641
+address $651
+address $653
+address $655
+address $657
+address $643
+address $645
+address $647
+address $649
+address $555
+address $557
+address $559
+address $561
+address $563
+address $565
+address $567
+address $569
+address $571
+address $573
+address $575
+address $577
+address $579
+address $581
+address $583
+address $585
+address $587
+address $589
+address $591
+address $593
+address $595
+address $597
+address $599
+address $601
+address $603
+address $605
+address $607
+address $609
+address $611
+address $613
+address $615
+address $617
+address $619
+address $621
+address $623
+address $625
+address $627
+address $629
+address $631
+address $633
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $681
+address $683
+address $679
+address $480
+address $480
+address $689
+address $687
+address $685
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $677
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $485
+address $675
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $705
+address $703
+address $701
+address $480
+address $480
+address $480
+address $493
+address $480
+address $480
+address $480
+address $480
+address $480
+address $480
+address $713
+address $482
+address $487
+address $489
+address $491
+address $495
+address $497
+address $499
+address $501
+address $503
+address $505
+address $507
+address $509
+address $511
+address $513
+address $515
+address $517
+address $519
+address $521
+address $523
+address $525
+address $527
+address $529
+address $531
+address $533
+address $715
+address $699
+address $717
+address $719
+address $721
+address $723
+address $725
+address $727
+address $729
+address $731
+address $733
+address $735
+address $737
+address $739
+address $741
+address $743
+address $745
+address $747
+address $749
+address $751
+address $753
+address $755
+address $757
+address $759
+address $761
+address $763
+address $765
+address $767
+address $769
+address $771
+address $773
+address $775
+address $777
+address $779
+address $781
+address $783
+address $785
+address $787
+address $789
+address $791
+address $793
+code
+LABELV $482
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1120
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $480
+ADDRGP4 $794
+ARGP4
+ADDRLP4 1108
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $481
+LABELV $478
+ADDRGP4 $797
+JUMPV
+ADDRGP4 $798
+JUMPV
+LABELV $797
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $799
+LABELV $753
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $799
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $801
+LABELV $751
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $801
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $803
+LABELV $747
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $803
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $805
+LABELV $749
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $805
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 37
+NEI4 $807
+LABELV $755
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $807
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 60
+NEI4 $809
+LABELV $757
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $809
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 62
+NEI4 $811
+LABELV $759
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1086324736
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $811
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 33
+NEI4 $813
+LABELV $761
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1088421888
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $813
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 61
+NEI4 $815
+LABELV $763
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $815
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 38
+NEI4 $817
+LABELV $765
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1091567616
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $817
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 124
+NEI4 $819
+LABELV $767
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $819
+ADDRLP4 1156
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+CNSTI4 46
+EQI4 $823
+ADDRLP4 1156
+INDIRI4
+CNSTI4 48
+LTI4 $821
+ADDRLP4 1156
+INDIRI4
+CNSTI4 57
+GTI4 $821
+LABELV $823
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1160
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1160
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $821
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $159
+ARGP4
+ADDRLP4 1160
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 0
+NEI4 $824
+LABELV $711
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $824
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 1164
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+CNSTI4 0
+NEI4 $827
+LABELV $709
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $827
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 1168
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+CNSTI4 0
+NEI4 $831
+LABELV $707
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+52
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $831
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 1172
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1172
+INDIRI4
+CNSTI4 0
+NEI4 $835
+LABELV $535
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+12
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $835
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 1176
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1176
+INDIRI4
+CNSTI4 0
+NEI4 $839
+LABELV $537
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+16
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $839
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 1180
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 0
+NEI4 $843
+LABELV $539
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+20
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $843
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 1184
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1184
+INDIRI4
+CNSTI4 0
+NEI4 $847
+LABELV $541
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+24
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $847
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $166
+ARGP4
+ADDRLP4 1188
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+NEI4 $851
+LABELV $543
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+28
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $851
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $167
+ARGP4
+ADDRLP4 1192
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+CNSTI4 0
+NEI4 $855
+LABELV $545
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+32
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $855
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $168
+ARGP4
+ADDRLP4 1196
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1196
+INDIRI4
+CNSTI4 0
+NEI4 $859
+LABELV $547
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+36
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $859
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 1200
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+CNSTI4 0
+NEI4 $863
+LABELV $549
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+40
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $863
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 1204
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1204
+INDIRI4
+CNSTI4 0
+NEI4 $867
+LABELV $551
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+44
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $867
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 1208
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1208
+INDIRI4
+CNSTI4 0
+NEI4 $871
+LABELV $553
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+48
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $871
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 1212
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1212
+INDIRI4
+CNSTI4 0
+NEI4 $875
+LABELV $667
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRLP4 1216
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1216
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $875
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 1216
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+CNSTI4 0
+NEI4 $879
+LABELV $669
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $879
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $178
+ARGP4
+ADDRLP4 1220
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+CNSTI4 0
+NEI4 $883
+LABELV $671
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+60+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $883
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $179
+ARGP4
+ADDRLP4 1224
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+NEI4 $888
+LABELV $673
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+60+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $888
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 1228
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+CNSTI4 0
+NEI4 $893
+LABELV $659
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+84
+ARGP4
+ADDRLP4 1232
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1232
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $893
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 1232
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+NEI4 $897
+LABELV $661
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+84
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $897
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $174
+ARGP4
+ADDRLP4 1236
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1236
+INDIRI4
+CNSTI4 0
+NEI4 $901
+LABELV $663
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+84+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $901
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $175
+ARGP4
+ADDRLP4 1240
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+NEI4 $906
+LABELV $665
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+84+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $906
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $184
+ARGP4
+ADDRLP4 1244
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1244
+INDIRI4
+CNSTI4 0
+NEI4 $911
+LABELV $651
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+96
+ARGP4
+ADDRLP4 1248
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1248
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $911
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $185
+ARGP4
+ADDRLP4 1248
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1248
+INDIRI4
+CNSTI4 0
+NEI4 $915
+LABELV $653
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+96
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $915
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $186
+ARGP4
+ADDRLP4 1252
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+CNSTI4 0
+NEI4 $919
+LABELV $655
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+96+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $919
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $187
+ARGP4
+ADDRLP4 1256
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+NEI4 $924
+LABELV $657
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+96+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $924
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $188
+ARGP4
+ADDRLP4 1260
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1260
+INDIRI4
+CNSTI4 0
+NEI4 $929
+LABELV $643
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+108
+ARGP4
+ADDRLP4 1264
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1264
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $929
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $189
+ARGP4
+ADDRLP4 1264
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 0
+NEI4 $933
+LABELV $645
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+108
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $933
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 1268
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+CNSTI4 0
+NEI4 $937
+LABELV $647
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+108+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $937
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $191
+ARGP4
+ADDRLP4 1272
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+CNSTI4 0
+NEI4 $942
+LABELV $649
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+108+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $942
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $288
+ARGP4
+ADDRLP4 1276
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1276
+INDIRI4
+CNSTI4 0
+NEI4 $947
+LABELV $705
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+108+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $947
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 1280
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+CNSTI4 0
+NEI4 $952
+LABELV $703
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+108
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $952
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $290
+ARGP4
+ADDRLP4 1284
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1284
+INDIRI4
+CNSTI4 0
+NEI4 $956
+LABELV $701
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+108+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $956
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $302
+ARGP4
+ADDRLP4 1288
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1288
+INDIRI4
+CNSTI4 0
+NEI4 $961
+LABELV $485
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+644
+ARGP4
+ADDRLP4 1292
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1292
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $961
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $303
+ARGP4
+ADDRLP4 1292
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1292
+INDIRI4
+CNSTI4 0
+NEI4 $965
+LABELV $487
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+644
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $965
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $304
+ARGP4
+ADDRLP4 1296
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1296
+INDIRI4
+CNSTI4 0
+NEI4 $969
+LABELV $489
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+644+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $969
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $305
+ARGP4
+ADDRLP4 1300
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1300
+INDIRI4
+CNSTI4 0
+NEI4 $974
+LABELV $491
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+644+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $974
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $294
+ARGP4
+ADDRLP4 1304
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+CNSTI4 0
+NEI4 $979
+LABELV $493
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+656
+ARGP4
+ADDRLP4 1308
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1308
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $979
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 1308
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 0
+NEI4 $983
+LABELV $495
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+656
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $983
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $308
+ARGP4
+ADDRLP4 1312
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 0
+NEI4 $987
+LABELV $497
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+656+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $987
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $309
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+NEI4 $992
+LABELV $499
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+656+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $992
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $310
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+NEI4 $997
+LABELV $501
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+668
+ARGP4
+ADDRLP4 1324
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1324
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $997
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $311
+ARGP4
+ADDRLP4 1324
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+NEI4 $1001
+LABELV $503
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+668
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1001
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $312
+ARGP4
+ADDRLP4 1328
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+NEI4 $1005
+LABELV $505
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+668+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1005
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $313
+ARGP4
+ADDRLP4 1332
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 0
+NEI4 $1010
+LABELV $507
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+668+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1010
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRLP4 1336
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+CNSTI4 0
+NEI4 $1015
+LABELV $509
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+708
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1015
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $315
+ARGP4
+ADDRLP4 1340
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+CNSTI4 0
+NEI4 $1019
+LABELV $511
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+668+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1019
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $316
+ARGP4
+ADDRLP4 1344
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1344
+INDIRI4
+CNSTI4 0
+NEI4 $1024
+LABELV $513
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+668
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1024
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $317
+ARGP4
+ADDRLP4 1348
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+CNSTI4 0
+NEI4 $1028
+LABELV $515
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+668+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1028
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $318
+ARGP4
+ADDRLP4 1352
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1352
+INDIRI4
+CNSTI4 0
+NEI4 $1033
+LABELV $517
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+704
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1033
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $319
+ARGP4
+ADDRLP4 1356
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+CNSTI4 0
+NEI4 $1037
+LABELV $519
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+680
+ARGP4
+ADDRLP4 1360
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1360
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1037
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 1360
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 0
+NEI4 $1041
+LABELV $521
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+680
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1041
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 1364
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1364
+INDIRI4
+CNSTI4 0
+NEI4 $1045
+LABELV $523
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+680+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1045
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $322
+ARGP4
+ADDRLP4 1368
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1368
+INDIRI4
+CNSTI4 0
+NEI4 $1050
+LABELV $525
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+680+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1050
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $323
+ARGP4
+ADDRLP4 1372
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1372
+INDIRI4
+CNSTI4 0
+NEI4 $1055
+LABELV $527
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+692
+ARGP4
+ADDRLP4 1376
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1376
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1055
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $324
+ARGP4
+ADDRLP4 1376
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1376
+INDIRI4
+CNSTI4 0
+NEI4 $1059
+LABELV $529
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+692
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1059
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $325
+ARGP4
+ADDRLP4 1380
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1380
+INDIRI4
+CNSTI4 0
+NEI4 $1063
+LABELV $531
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+692+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1063
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRLP4 1384
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1384
+INDIRI4
+CNSTI4 0
+NEI4 $1068
+LABELV $533
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+692+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1068
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $180
+ARGP4
+ADDRLP4 1388
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1388
+INDIRI4
+CNSTI4 0
+NEI4 $1073
+LABELV $635
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+72
+ARGP4
+ADDRLP4 1392
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1392
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1073
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $181
+ARGP4
+ADDRLP4 1392
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1392
+INDIRI4
+CNSTI4 0
+NEI4 $1077
+LABELV $637
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+72
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1077
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $182
+ARGP4
+ADDRLP4 1396
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1396
+INDIRI4
+CNSTI4 0
+NEI4 $1081
+LABELV $639
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+72+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1081
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $183
+ARGP4
+ADDRLP4 1400
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1400
+INDIRI4
+CNSTI4 0
+NEI4 $1086
+LABELV $641
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+72+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1086
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $327
+ARGP4
+ADDRLP4 1404
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1404
+INDIRI4
+CNSTI4 0
+NEI4 $1091
+LABELV $715
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cgs+43236
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1091
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 1408
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+CNSTI4 0
+NEI4 $1096
+LABELV $699
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1096
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 1412
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1412
+INDIRI4
+CNSTI4 0
+NEI4 $1100
+LABELV $717
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+160
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1100
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $330
+ARGP4
+ADDRLP4 1416
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1416
+INDIRI4
+CNSTI4 0
+NEI4 $1104
+LABELV $719
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+164
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1104
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 1420
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1420
+INDIRI4
+CNSTI4 0
+NEI4 $1108
+LABELV $697
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+316
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1108
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $153
+ARGP4
+ADDRLP4 1424
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1424
+INDIRI4
+CNSTI4 0
+NEI4 $1112
+LABELV $695
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1112
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $154
+ARGP4
+ADDRLP4 1428
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1428
+INDIRI4
+CNSTI4 0
+NEI4 $1117
+LABELV $693
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1117
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $156
+ARGP4
+ADDRLP4 1432
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1432
+INDIRI4
+CNSTI4 0
+NEI4 $1122
+LABELV $691
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1122
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 1436
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1436
+INDIRI4
+CNSTI4 0
+NEI4 $1127
+LABELV $721
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1078530011
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1127
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $332
+ARGP4
+ADDRLP4 1440
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1440
+INDIRI4
+CNSTI4 0
+NEI4 $1129
+LABELV $723
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1444
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1444
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1129
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $333
+ARGP4
+ADDRLP4 1444
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1444
+INDIRI4
+CNSTI4 0
+NEI4 $1132
+LABELV $725
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1448
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 1448
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1132
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $334
+ARGP4
+ADDRLP4 1448
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1448
+INDIRI4
+CNSTI4 0
+NEI4 $1135
+LABELV $727
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+176
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1135
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $335
+ARGP4
+ADDRLP4 1452
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1452
+INDIRI4
+CNSTI4 0
+NEI4 $1139
+LABELV $729
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+180
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1139
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $192
+ARGP4
+ADDRLP4 1456
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1456
+INDIRI4
+CNSTI4 0
+NEI4 $1143
+LABELV $555
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+184
+ARGP4
+ADDRLP4 1460
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1460
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1143
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $196
+ARGP4
+ADDRLP4 1460
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1460
+INDIRI4
+CNSTI4 0
+NEI4 $1147
+LABELV $563
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+196
+ARGP4
+ADDRLP4 1464
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1464
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1147
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $200
+ARGP4
+ADDRLP4 1464
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1464
+INDIRI4
+CNSTI4 0
+NEI4 $1151
+LABELV $571
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+208
+ARGP4
+ADDRLP4 1468
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1468
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1151
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $204
+ARGP4
+ADDRLP4 1468
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1468
+INDIRI4
+CNSTI4 0
+NEI4 $1155
+LABELV $579
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+220
+ARGP4
+ADDRLP4 1472
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1472
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1155
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 1472
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1472
+INDIRI4
+CNSTI4 0
+NEI4 $1159
+LABELV $587
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+232
+ARGP4
+ADDRLP4 1476
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1476
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1159
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $212
+ARGP4
+ADDRLP4 1476
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1476
+INDIRI4
+CNSTI4 0
+NEI4 $1163
+LABELV $595
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+244
+ARGP4
+ADDRLP4 1480
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1480
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1163
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $216
+ARGP4
+ADDRLP4 1480
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1480
+INDIRI4
+CNSTI4 0
+NEI4 $1167
+LABELV $603
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+256
+ARGP4
+ADDRLP4 1484
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1484
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1167
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $220
+ARGP4
+ADDRLP4 1484
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1484
+INDIRI4
+CNSTI4 0
+NEI4 $1171
+LABELV $611
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+268
+ARGP4
+ADDRLP4 1488
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1488
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1171
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $224
+ARGP4
+ADDRLP4 1488
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1488
+INDIRI4
+CNSTI4 0
+NEI4 $1175
+LABELV $619
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+280
+ARGP4
+ADDRLP4 1492
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1492
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1175
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $228
+ARGP4
+ADDRLP4 1492
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1492
+INDIRI4
+CNSTI4 0
+NEI4 $1179
+LABELV $627
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+292
+ARGP4
+ADDRLP4 1496
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1496
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1179
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $193
+ARGP4
+ADDRLP4 1496
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1496
+INDIRI4
+CNSTI4 0
+NEI4 $1183
+LABELV $557
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+184
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1183
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $194
+ARGP4
+ADDRLP4 1500
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1500
+INDIRI4
+CNSTI4 0
+NEI4 $1187
+LABELV $559
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+184+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1187
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $195
+ARGP4
+ADDRLP4 1504
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1504
+INDIRI4
+CNSTI4 0
+NEI4 $1192
+LABELV $561
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+184+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1192
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 1508
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1508
+INDIRI4
+CNSTI4 0
+NEI4 $1197
+LABELV $565
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+196
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1197
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $198
+ARGP4
+ADDRLP4 1512
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1512
+INDIRI4
+CNSTI4 0
+NEI4 $1201
+LABELV $567
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+196+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1201
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $199
+ARGP4
+ADDRLP4 1516
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1516
+INDIRI4
+CNSTI4 0
+NEI4 $1206
+LABELV $569
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+196+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1206
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $201
+ARGP4
+ADDRLP4 1520
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1520
+INDIRI4
+CNSTI4 0
+NEI4 $1211
+LABELV $573
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+208
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1211
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $202
+ARGP4
+ADDRLP4 1524
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1524
+INDIRI4
+CNSTI4 0
+NEI4 $1215
+LABELV $575
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+208+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1215
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $203
+ARGP4
+ADDRLP4 1528
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1528
+INDIRI4
+CNSTI4 0
+NEI4 $1220
+LABELV $577
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+208+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1220
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 1532
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1532
+INDIRI4
+CNSTI4 0
+NEI4 $1225
+LABELV $581
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+220
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1225
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 1536
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1536
+INDIRI4
+CNSTI4 0
+NEI4 $1229
+LABELV $583
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+220+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1229
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $207
+ARGP4
+ADDRLP4 1540
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1540
+INDIRI4
+CNSTI4 0
+NEI4 $1234
+LABELV $585
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+220+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1234
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $209
+ARGP4
+ADDRLP4 1544
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1544
+INDIRI4
+CNSTI4 0
+NEI4 $1239
+LABELV $589
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+232
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1239
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 1548
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1548
+INDIRI4
+CNSTI4 0
+NEI4 $1243
+LABELV $591
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+232+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1243
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $211
+ARGP4
+ADDRLP4 1552
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1552
+INDIRI4
+CNSTI4 0
+NEI4 $1248
+LABELV $593
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+232+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1248
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 1556
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1556
+INDIRI4
+CNSTI4 0
+NEI4 $1253
+LABELV $597
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+244
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1253
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRLP4 1560
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1560
+INDIRI4
+CNSTI4 0
+NEI4 $1257
+LABELV $599
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+244+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1257
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 1564
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1564
+INDIRI4
+CNSTI4 0
+NEI4 $1262
+LABELV $601
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+244+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1262
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $217
+ARGP4
+ADDRLP4 1568
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1568
+INDIRI4
+CNSTI4 0
+NEI4 $1267
+LABELV $605
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+256
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1267
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 1572
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1572
+INDIRI4
+CNSTI4 0
+NEI4 $1271
+LABELV $607
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+256+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1271
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 1576
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1576
+INDIRI4
+CNSTI4 0
+NEI4 $1276
+LABELV $609
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+256+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1276
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 1580
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1580
+INDIRI4
+CNSTI4 0
+NEI4 $1281
+LABELV $613
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+268
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1281
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $222
+ARGP4
+ADDRLP4 1584
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1584
+INDIRI4
+CNSTI4 0
+NEI4 $1285
+LABELV $615
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+268+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1285
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 1588
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1588
+INDIRI4
+CNSTI4 0
+NEI4 $1290
+LABELV $617
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+268+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1290
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $225
+ARGP4
+ADDRLP4 1592
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1592
+INDIRI4
+CNSTI4 0
+NEI4 $1295
+LABELV $621
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+280
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1295
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 1596
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1596
+INDIRI4
+CNSTI4 0
+NEI4 $1299
+LABELV $623
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+280+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1299
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $227
+ARGP4
+ADDRLP4 1600
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1600
+INDIRI4
+CNSTI4 0
+NEI4 $1304
+LABELV $625
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+280+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1304
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $229
+ARGP4
+ADDRLP4 1604
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1604
+INDIRI4
+CNSTI4 0
+NEI4 $1309
+LABELV $629
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+292
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1309
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $230
+ARGP4
+ADDRLP4 1608
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1608
+INDIRI4
+CNSTI4 0
+NEI4 $1313
+LABELV $631
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+292+4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1313
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $231
+ARGP4
+ADDRLP4 1612
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1612
+INDIRI4
+CNSTI4 0
+NEI4 $1318
+LABELV $633
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+292+8
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1318
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 1616
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1616
+INDIRI4
+CNSTI4 0
+NEI4 $1323
+LABELV $689
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+52
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1323
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $258
+ARGP4
+ADDRLP4 1620
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1620
+INDIRI4
+CNSTI4 0
+NEI4 $1327
+LABELV $687
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+56
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1327
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $259
+ARGP4
+ADDRLP4 1624
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1624
+INDIRI4
+CNSTI4 0
+NEI4 $1331
+LABELV $685
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+7840
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1331
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $252
+ARGP4
+ADDRLP4 1628
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1628
+INDIRI4
+CNSTI4 0
+NEI4 $1335
+LABELV $681
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+1488
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1335
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 1632
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1632
+INDIRI4
+CNSTI4 0
+NEI4 $1339
+LABELV $683
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+1540
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1339
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 1636
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1636
+INDIRI4
+CNSTI4 0
+NEI4 $1343
+LABELV $679
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+1512
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1343
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRLP4 1640
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1640
+INDIRI4
+CNSTI4 0
+NEI4 $1347
+LABELV $677
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+1496
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1347
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $276
+ARGP4
+ADDRLP4 1644
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1644
+INDIRI4
+CNSTI4 0
+NEI4 $1351
+LABELV $675
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+1504
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1351
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $1357
+ARGP4
+ADDRLP4 1648
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1648
+INDIRI4
+CNSTI4 0
+NEI4 $1355
+LABELV $739
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+356
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1355
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 1652
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1652
+INDIRI4
+CNSTI4 0
+NEI4 $1360
+LABELV $731
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+360
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1360
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $337
+ARGP4
+ADDRLP4 1656
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1656
+INDIRI4
+CNSTI4 0
+NEI4 $1364
+LABELV $733
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+364
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1364
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 1660
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1660
+INDIRI4
+CNSTI4 0
+NEI4 $1368
+LABELV $735
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+368
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1368
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $339
+ARGP4
+ADDRLP4 1664
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1664
+INDIRI4
+CNSTI4 0
+NEI4 $1372
+LABELV $737
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+372
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1372
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $340
+ARGP4
+ADDRLP4 1668
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1668
+INDIRI4
+CNSTI4 0
+NEI4 $1376
+LABELV $741
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+376
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1376
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $341
+ARGP4
+ADDRLP4 1672
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1672
+INDIRI4
+CNSTI4 0
+NEI4 $1380
+LABELV $743
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 cgs+39688
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1380
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $301
+ARGP4
+ADDRLP4 1676
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1676
+INDIRI4
+CNSTI4 0
+NEI4 $1384
+LABELV $713
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRGP4 ScriptVars+636
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1384
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $354
+ARGP4
+ADDRLP4 1680
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1680
+INDIRI4
+CNSTI4 0
+NEI4 $1388
+LABELV $769
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1388
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 1684
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1684
+INDIRI4
+CNSTI4 0
+NEI4 $1390
+LABELV $771
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1390
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 1688
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1688
+INDIRI4
+CNSTI4 0
+NEI4 $1392
+LABELV $773
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1392
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $357
+ARGP4
+ADDRLP4 1692
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1692
+INDIRI4
+CNSTI4 0
+NEI4 $1394
+LABELV $775
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1099431936
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1394
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $358
+ARGP4
+ADDRLP4 1696
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1696
+INDIRI4
+CNSTI4 0
+NEI4 $1396
+LABELV $777
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1099956224
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1396
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $359
+ARGP4
+ADDRLP4 1700
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1700
+INDIRI4
+CNSTI4 0
+NEI4 $1398
+LABELV $781
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1100480512
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1398
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $360
+ARGP4
+ADDRLP4 1704
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1704
+INDIRI4
+CNSTI4 0
+NEI4 $1400
+LABELV $783
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1400
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $361
+ARGP4
+ADDRLP4 1708
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1708
+INDIRI4
+CNSTI4 0
+NEI4 $1402
+LABELV $787
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1101529088
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1402
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRLP4 1712
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1712
+INDIRI4
+CNSTI4 0
+NEI4 $1404
+LABELV $785
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1102053376
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1404
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $363
+ARGP4
+ADDRLP4 1716
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1716
+INDIRI4
+CNSTI4 0
+NEI4 $1406
+LABELV $789
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1102577664
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1406
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 1720
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1720
+INDIRI4
+CNSTI4 0
+NEI4 $1408
+LABELV $791
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1408
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $1412
+ARGP4
+ADDRLP4 1724
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1724
+INDIRI4
+CNSTI4 0
+NEI4 $1410
+LABELV $779
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1103626240
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1410
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $365
+ARGP4
+ADDRLP4 1728
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1728
+INDIRI4
+CNSTI4 0
+NEI4 $1413
+LABELV $793
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1104150528
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1413
+ADDRLP4 1044
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRLP4 1732
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 1732
+INDIRI4
+CNSTI4 0
+NEI4 $1415
+LABELV $745
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRGP4 ScriptVars+60
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1736
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1736
+INDIRI4
+CNSTI4 32
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $1415
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 40
+NEI4 $1419
+ADDRGP4 $1420
+JUMPV
+LABELV $1419
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1736
+ADDRGP4 trap_Cvar_Exists
+CALLI4
+ASGNI4
+ADDRLP4 1736
+INDIRI4
+CNSTI4 0
+EQI4 $1421
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1740
+ADDRGP4 SC_Cvar_Get_Float
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1740
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+EQI4 $1422
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1744
+ADDRGP4 SC_Cvar_Get_Float
+CALLF4
+ASGNF4
+ADDRGP4 $1426
+ARGP4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1744
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1422
+JUMPV
+LABELV $1421
+ADDRGP4 $1427
+ARGP4
+ADDRLP4 1044
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRLP4 1740
+ADDRGP4 PrintShort
+CALLP4
+ASGNP4
+ADDRGP4 $1428
+ARGP4
+ADDRLP4 1740
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1422
+LABELV $1420
+LABELV $798
+LABELV $483
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+EQI4 $1430
+ADDRGP4 $443
+JUMPV
+LABELV $1430
+LABELV $442
+ADDRGP4 $441
+JUMPV
+LABELV $443
+ADDRLP4 1140
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 1140
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1432
+ADDRLP4 1140
+INDIRF4
+CNSTF4 1092616192
+GTF4 $1432
+ADDRLP4 1140
+INDIRF4
+CNSTF4 1073741824
+EQF4 $1432
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1434
+ARGP4
+ADDRGP4 $439
+INDIRI4
+ARGI4
+ADDRGP4 $440
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1144
+ADDRGP4 $439
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ADDRLP4 1144
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $438
+JUMPV
+LABELV $1432
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+LEI4 $1435
+ADDRLP4 1148
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+ADDRLP4 4-8
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1435
+ADDRLP4 1148
+INDIRI4
+ADDRLP4 4-8
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+GTF4 $1435
+ADDRFP4 12
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1439
+ARGP4
+ADDRGP4 $439
+INDIRI4
+ARGI4
+ADDRGP4 $440
+INDIRI4
+ARGI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-8
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1152
+ADDRGP4 $439
+ASGNP4
+ADDRLP4 1152
+INDIRP4
+ADDRLP4 1152
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $438
+JUMPV
+LABELV $1435
+ADDRLP4 1032
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $1444
+JUMPV
+LABELV $1441
+ADDRLP4 1160
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1160
+INDIRF4
+CNSTF4 1096810496
+LTF4 $1447
+ADDRLP4 1160
+INDIRF4
+CNSTF4 1104674816
+LEF4 $1445
+LABELV $1447
+ADDRGP4 $1442
+JUMPV
+LABELV $1445
+ADDRLP4 1152
+CNSTF4 0
+ASGNF4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1448
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+CNSTF4 1093664768
+EQF4 $1450
+ADDRFP4 12
+INDIRP4
+CNSTI4 6
+ASGNI4
+ADDRGP4 $1453
+ARGP4
+ADDRGP4 $439
+INDIRI4
+ARGI4
+ADDRGP4 $440
+INDIRI4
+ARGI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1164
+ADDRGP4 $439
+ASGNP4
+ADDRLP4 1164
+INDIRP4
+ADDRLP4 1164
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $438
+JUMPV
+LABELV $1450
+ADDRLP4 1152
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1448
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1096810496
+NEF4 $1456
+ADDRLP4 1152
+INDIRF4
+ARGF4
+ADDRLP4 1164
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 1152
+ADDRLP4 1164
+INDIRF4
+ASGNF4
+ADDRGP4 $1457
+JUMPV
+LABELV $1456
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1097859072
+NEF4 $1458
+ADDRLP4 1152
+INDIRF4
+ARGF4
+ADDRLP4 1164
+ADDRGP4 ceil
+CALLF4
+ASGNF4
+ADDRLP4 1152
+ADDRLP4 1164
+INDIRF4
+ASGNF4
+ADDRGP4 $1459
+JUMPV
+LABELV $1458
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+NEF4 $1460
+ADDRLP4 1152
+INDIRF4
+ARGF4
+ADDRLP4 1164
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 1152
+ADDRLP4 1164
+INDIRF4
+ASGNF4
+ADDRGP4 $1461
+JUMPV
+LABELV $1460
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1099431936
+NEF4 $1462
+CNSTF4 1078530011
+ADDRLP4 1152
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 1164
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 1152
+ADDRLP4 1164
+INDIRF4
+ASGNF4
+ADDRGP4 $1463
+JUMPV
+LABELV $1462
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1099956224
+NEF4 $1464
+CNSTF4 1078530011
+ADDRLP4 1152
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 1164
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 1152
+ADDRLP4 1164
+INDIRF4
+ASGNF4
+ADDRGP4 $1465
+JUMPV
+LABELV $1464
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1100480512
+NEF4 $1466
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 1152
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 1164
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 1152
+ADDRLP4 1164
+INDIRF4
+ASGNF4
+ADDRGP4 $1467
+JUMPV
+LABELV $1466
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1101004800
+NEF4 $1468
+ADDRLP4 1152
+INDIRF4
+CNSTF4 0
+GEF4 $1470
+ADDRLP4 1152
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1469
+JUMPV
+LABELV $1470
+ADDRLP4 1152
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1469
+ADDRLP4 1152
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1469
+JUMPV
+LABELV $1468
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1101529088
+NEF4 $1474
+ADDRLP4 1152
+INDIRF4
+ARGF4
+ADDRLP4 1164
+ADDRGP4 acos
+CALLI4
+ASGNI4
+ADDRLP4 1152
+CNSTF4 1127481344
+ADDRLP4 1164
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $1475
+JUMPV
+LABELV $1474
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1102053376
+NEF4 $1476
+ADDRLP4 1152
+INDIRF4
+ARGF4
+ADDRLP4 1164
+ADDRGP4 acos
+CALLI4
+ASGNI4
+ADDRLP4 1152
+CNSTF4 1127481344
+CNSTF4 1070141403
+ADDRLP4 1164
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $1477
+JUMPV
+LABELV $1476
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1102577664
+NEF4 $1478
+ADDRLP4 1152
+INDIRF4
+ADDRLP4 1152
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRLP4 1168
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 1152
+INDIRF4
+ADDRLP4 1168
+INDIRF4
+DIVF4
+ARGF4
+ADDRLP4 1172
+ADDRGP4 acos
+CALLI4
+ASGNI4
+ADDRLP4 1152
+CNSTF4 1127481344
+CNSTF4 1070141403
+ADDRLP4 1172
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $1479
+JUMPV
+LABELV $1478
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1103101952
+NEF4 $1480
+ADDRLP4 1156
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1152
+INDIRF4
+ARGF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 1164
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 1152
+CNSTF4 1127481344
+ADDRLP4 1164
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $1481
+JUMPV
+LABELV $1480
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1103626240
+NEF4 $1483
+CNSTF4 1078530011
+ADDRLP4 1152
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 1164
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 1152
+ADDRLP4 1164
+INDIRF4
+ASGNF4
+ADDRGP4 $1484
+JUMPV
+LABELV $1483
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1104150528
+NEF4 $1485
+ADDRLP4 1156
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1152
+INDIRF4
+ARGF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 1164
+ADDRGP4 powf
+CALLI4
+ASGNI4
+ADDRLP4 1152
+ADDRLP4 1164
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $1486
+JUMPV
+LABELV $1485
+ADDRGP4 $1488
+ARGP4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1486
+LABELV $1484
+LABELV $1481
+LABELV $1479
+LABELV $1477
+LABELV $1475
+LABELV $1469
+LABELV $1467
+LABELV $1465
+LABELV $1463
+LABELV $1461
+LABELV $1459
+LABELV $1457
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1493
+JUMPV
+LABELV $1490
+ADDRLP4 1164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 4-8
+ADDP4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1491
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1493
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1490
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $1442
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $1444
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+GEI4 $1441
+ADDRLP4 1032
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1498
+JUMPV
+LABELV $1495
+ADDRLP4 1152
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1152
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1499
+ADDRLP4 1152
+INDIRF4
+CNSTF4 1092616192
+GTF4 $1499
+ADDRLP4 1156
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1501
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+GTF4 $1501
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+EQF4 $1505
+ADDRFP4 12
+INDIRP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1508
+ARGP4
+ADDRGP4 $439
+INDIRI4
+ARGI4
+ADDRGP4 $440
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1160
+ADDRGP4 $439
+ASGNP4
+ADDRLP4 1160
+INDIRP4
+ADDRLP4 1160
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $438
+JUMPV
+LABELV $1505
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1501
+LABELV $1499
+LABELV $1496
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1498
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1495
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1512
+JUMPV
+LABELV $1509
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $1513
+ADDRGP4 $1510
+JUMPV
+LABELV $1513
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+NEF4 $1515
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $1521
+ADDRLP4 1156
+CNSTI4 2
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+LTI4 $1517
+ADDRLP4 1160
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4-8
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1517
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4-8
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+GTF4 $1517
+LABELV $1521
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1164
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1527
+JUMPV
+LABELV $1524
+ADDRLP4 1168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 4-8
+ADDP4
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1525
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1527
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1524
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $1517
+LABELV $1515
+LABELV $1510
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1512
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1509
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1532
+JUMPV
+LABELV $1529
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $1533
+ADDRGP4 $1530
+JUMPV
+LABELV $1533
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1077936128
+NEF4 $1535
+ADDRLP4 1152
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ASGNP4
+ADDRLP4 1156
+INDIRP4
+ADDRLP4 1156
+INDIRP4
+INDIRF4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1542
+JUMPV
+LABELV $1539
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1540
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1542
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1539
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $1530
+JUMPV
+LABELV $1535
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+NEF4 $1544
+ADDRLP4 1152
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ASGNP4
+ADDRLP4 1156
+INDIRP4
+ADDRLP4 1156
+INDIRP4
+INDIRF4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1551
+JUMPV
+LABELV $1548
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1549
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1551
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1548
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $1530
+JUMPV
+LABELV $1544
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1094713344
+NEF4 $1553
+ADDRLP4 1152
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1156
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1160
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 1160
+INDIRI4
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1561
+JUMPV
+LABELV $1558
+ADDRLP4 1164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1559
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1561
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1558
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $1553
+LABELV $1530
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1532
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1529
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1566
+JUMPV
+LABELV $1563
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $1567
+ADDRGP4 $1564
+JUMPV
+LABELV $1567
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+NEF4 $1569
+ADDRLP4 1152
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ASGNP4
+ADDRLP4 1156
+INDIRP4
+ADDRLP4 1156
+INDIRP4
+INDIRF4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1576
+JUMPV
+LABELV $1573
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1574
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1576
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1573
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $1564
+JUMPV
+LABELV $1569
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+NEF4 $1578
+ADDRLP4 1152
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ASGNP4
+ADDRLP4 1156
+INDIRP4
+ADDRLP4 1156
+INDIRP4
+INDIRF4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1585
+JUMPV
+LABELV $1582
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1583
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1585
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1582
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $1578
+LABELV $1564
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1566
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1563
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1590
+JUMPV
+LABELV $1587
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $1591
+ADDRGP4 $1588
+JUMPV
+LABELV $1591
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1084227584
+NEF4 $1593
+ADDRLP4 1156
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+GEF4 $1599
+ADDRLP4 1152
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1600
+JUMPV
+LABELV $1599
+ADDRLP4 1152
+CNSTI4 0
+ASGNI4
+LABELV $1600
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1152
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1604
+JUMPV
+LABELV $1601
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1602
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1604
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1601
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $1588
+JUMPV
+LABELV $1593
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1086324736
+NEF4 $1606
+ADDRLP4 1156
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+LEF4 $1612
+ADDRLP4 1152
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1613
+JUMPV
+LABELV $1612
+ADDRLP4 1152
+CNSTI4 0
+ASGNI4
+LABELV $1613
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1152
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1617
+JUMPV
+LABELV $1614
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1615
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1617
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1614
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $1588
+JUMPV
+LABELV $1606
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1088421888
+NEF4 $1619
+ADDRLP4 1156
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+EQF4 $1625
+ADDRLP4 1152
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1626
+JUMPV
+LABELV $1625
+ADDRLP4 1152
+CNSTI4 0
+ASGNI4
+LABELV $1626
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1152
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1630
+JUMPV
+LABELV $1627
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1628
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1630
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1627
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $1588
+JUMPV
+LABELV $1619
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1090519040
+NEF4 $1632
+ADDRLP4 1156
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+NEF4 $1638
+ADDRLP4 1152
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1639
+JUMPV
+LABELV $1638
+ADDRLP4 1152
+CNSTI4 0
+ASGNI4
+LABELV $1639
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1152
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1643
+JUMPV
+LABELV $1640
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1641
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1643
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1640
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $1632
+LABELV $1588
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1590
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1587
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1648
+JUMPV
+LABELV $1645
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $1649
+ADDRGP4 $1646
+JUMPV
+LABELV $1649
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1091567616
+NEF4 $1651
+ADDRLP4 1156
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+CNSTF4 0
+ASGNF4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ADDRLP4 1160
+INDIRF4
+EQF4 $1657
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+ADDRLP4 1160
+INDIRF4
+EQF4 $1657
+ADDRLP4 1152
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1658
+JUMPV
+LABELV $1657
+ADDRLP4 1152
+CNSTI4 0
+ASGNI4
+LABELV $1658
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1152
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1662
+JUMPV
+LABELV $1659
+ADDRLP4 1164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1660
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1662
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1659
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $1646
+JUMPV
+LABELV $1651
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+NEF4 $1664
+ADDRLP4 1156
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+CNSTF4 0
+ASGNF4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ADDRLP4 1160
+INDIRF4
+NEF4 $1672
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+ADDRLP4 1160
+INDIRF4
+EQF4 $1670
+LABELV $1672
+ADDRLP4 1152
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1671
+JUMPV
+LABELV $1670
+ADDRLP4 1152
+CNSTI4 0
+ASGNI4
+LABELV $1671
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1152
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $1676
+JUMPV
+LABELV $1673
+ADDRLP4 1164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1674
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1676
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1673
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $1664
+LABELV $1646
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1648
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1645
+ADDRLP4 4
+INDIRF4
+CNSTF4 1093664768
+EQF4 $1678
+ADDRFP4 12
+INDIRP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1680
+ARGP4
+ADDRGP4 $439
+INDIRI4
+ARGI4
+ADDRGP4 $440
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1152
+ADDRGP4 $439
+ASGNP4
+ADDRLP4 1152
+INDIRP4
+ADDRLP4 1152
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $438
+JUMPV
+LABELV $1678
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4+4
+INDIRF4
+ASGNF4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+EQI4 $1682
+ADDRGP4 $1684
+ARGP4
+ADDRGP4 $439
+INDIRI4
+ARGI4
+ADDRGP4 $440
+INDIRI4
+ARGI4
+ADDRLP4 1028
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1682
+ADDRLP4 1152
+ADDRGP4 $439
+ASGNP4
+ADDRLP4 1152
+INDIRP4
+ADDRLP4 1152
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $438
+endproc CG_Q3mmeMathExt 1748 24
+export CG_Q3mmeMath
+proc CG_Q3mmeMath 4 20
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Q3mmeMathExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $1685
+endproc CG_Q3mmeMath 4 20
+proc CG_GetScriptVector 104 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1687
+ADDRLP4 4
+CNSTI4 57
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1702
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $1735
+LABELV $1734
+ADDRLP4 12
+CNSTI4 33
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1716
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $1737
+LABELV $1736
+ADDRLP4 20
+CNSTI4 21
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1714
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $1739
+LABELV $1738
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $1720
+ADDRGP4 $1689
+JUMPV
+LABELV $1739
+ADDRLP4 28
+CNSTI4 25
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $1692
+ADDRFP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $1689
+LABELV $1740
+ADDRFP4 4
+INDIRI4
+CNSTI4 29
+EQI4 $1732
+ADDRGP4 $1689
+JUMPV
+LABELV $1737
+ADDRLP4 36
+CNSTI4 45
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $1696
+ADDRFP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+GTI4 $1742
+LABELV $1741
+ADDRLP4 44
+CNSTI4 37
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $1718
+ADDRFP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $1689
+LABELV $1743
+ADDRFP4 4
+INDIRI4
+CNSTI4 41
+EQI4 $1694
+ADDRGP4 $1689
+JUMPV
+LABELV $1742
+ADDRLP4 52
+CNSTI4 49
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $1698
+ADDRFP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LTI4 $1689
+LABELV $1744
+ADDRFP4 4
+INDIRI4
+CNSTI4 53
+EQI4 $1700
+ADDRGP4 $1689
+JUMPV
+LABELV $1735
+ADDRLP4 60
+CNSTI4 77
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $1712
+ADDRFP4 4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+GTI4 $1746
+LABELV $1745
+ADDRLP4 68
+CNSTI4 65
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $1706
+ADDRFP4 4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+GTI4 $1748
+LABELV $1747
+ADDRFP4 4
+INDIRI4
+CNSTI4 61
+EQI4 $1704
+ADDRGP4 $1689
+JUMPV
+LABELV $1748
+ADDRLP4 76
+CNSTI4 69
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+EQI4 $1708
+ADDRFP4 4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LTI4 $1689
+LABELV $1749
+ADDRFP4 4
+INDIRI4
+CNSTI4 73
+EQI4 $1710
+ADDRGP4 $1689
+JUMPV
+LABELV $1746
+ADDRLP4 84
+CNSTI4 158
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+EQI4 $1726
+ADDRFP4 4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+GTI4 $1751
+LABELV $1750
+ADDRLP4 92
+CNSTI4 124
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1722
+ADDRFP4 4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LTI4 $1689
+LABELV $1752
+ADDRFP4 4
+INDIRI4
+CNSTI4 143
+EQI4 $1724
+ADDRGP4 $1689
+JUMPV
+LABELV $1751
+ADDRLP4 100
+CNSTI4 167
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+EQI4 $1728
+ADDRFP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+LTI4 $1689
+LABELV $1753
+ADDRFP4 4
+INDIRI4
+CNSTI4 171
+EQI4 $1730
+ADDRGP4 $1689
+JUMPV
+LABELV $1689
+ADDRGP4 $1733
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1690
+LABELV $1687
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $192
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1754
+LABELV $1694
+ADDRGP4 ScriptVars+184
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1754
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $196
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1757
+LABELV $1696
+ADDRGP4 ScriptVars+196
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1757
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $200
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1760
+LABELV $1698
+ADDRGP4 ScriptVars+208
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1760
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $204
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1763
+LABELV $1700
+ADDRGP4 ScriptVars+220
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1763
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1766
+LABELV $1702
+ADDRGP4 ScriptVars+232
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1766
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $212
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1769
+LABELV $1704
+ADDRGP4 ScriptVars+244
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1769
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $216
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $1772
+LABELV $1706
+ADDRGP4 ScriptVars+256
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1772
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $220
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $1775
+LABELV $1708
+ADDRGP4 ScriptVars+268
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1775
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $224
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $1778
+LABELV $1710
+ADDRGP4 ScriptVars+280
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1778
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $228
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1781
+LABELV $1712
+ADDRGP4 ScriptVars+292
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1781
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $1784
+LABELV $1692
+ADDRGP4 ScriptVars+60
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1784
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $1787
+LABELV $1714
+ADDRGP4 ScriptVars+84
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1787
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $184
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $1790
+LABELV $1716
+ADDRGP4 ScriptVars+96
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1790
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $188
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $1793
+LABELV $1718
+ADDRGP4 ScriptVars+108
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1793
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $1796
+LABELV $1720
+ADDRGP4 ScriptVars+316
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1796
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $302
+ARGP4
+ADDRLP4 60
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $1799
+LABELV $1722
+ADDRGP4 ScriptVars+644
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1799
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $294
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $1802
+LABELV $1724
+ADDRGP4 ScriptVars+656
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1802
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $310
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $1805
+LABELV $1726
+ADDRGP4 ScriptVars+668
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1805
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $319
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $1808
+LABELV $1728
+ADDRGP4 ScriptVars+680
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1808
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $323
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $1811
+LABELV $1730
+ADDRGP4 ScriptVars+692
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1811
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $180
+ARGP4
+ADDRLP4 80
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $1814
+LABELV $1732
+ADDRGP4 ScriptVars+72
+RETP4
+ADDRGP4 $1686
+JUMPV
+LABELV $1814
+ADDRGP4 $1817
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 ScriptVars+304
+RETP4
+LABELV $1686
+endproc CG_GetScriptVector 104 12
+proc CG_SkipOpeningBrace 4 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1821
+JUMPV
+LABELV $1820
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1823
+ADDRGP4 $1825
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1819
+JUMPV
+LABELV $1823
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $1826
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $1822
+JUMPV
+LABELV $1826
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1821
+ADDRGP4 $1820
+JUMPV
+LABELV $1822
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $1819
+endproc CG_SkipOpeningBrace 4 4
+proc CG_SkipBlock 8 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1829
+ADDRGP4 $1831
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1828
+JUMPV
+LABELV $1829
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1833
+JUMPV
+LABELV $1832
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1835
+ADDRGP4 $1837
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1828
+JUMPV
+LABELV $1835
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $1838
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1839
+JUMPV
+LABELV $1838
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $1840
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1840
+LABELV $1839
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1842
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $1834
+JUMPV
+LABELV $1842
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1833
+ADDRGP4 $1832
+JUMPV
+LABELV $1834
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $1828
+endproc CG_SkipBlock 8 4
+proc CG_NumIfBlocks 108 20
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1845
+ADDRGP4 $1847
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1844
+JUMPV
+LABELV $1845
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_SkipBlock
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1848
+ADDRGP4 $1850
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1844
+JUMPV
+LABELV $1848
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1852
+JUMPV
+LABELV $1851
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $1855
+JUMPV
+LABELV $1854
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 92
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1857
+CNSTI4 0
+RETI4
+ADDRGP4 $1844
+JUMPV
+LABELV $1857
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1856
+LABELV $1855
+ADDRGP4 $1854
+JUMPV
+LABELV $1856
+ADDRLP4 4
+ARGP4
+ADDRGP4 $271
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $1863
+ADDRLP4 4
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRLP4 96
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $1853
+LABELV $1863
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1864
+ADDRGP4 $1866
+ARGP4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1844
+JUMPV
+LABELV $1864
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 CG_SkipBlock
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1862
+ADDRGP4 $1869
+ARGP4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1844
+JUMPV
+LABELV $1862
+LABELV $1852
+ADDRGP4 $1851
+JUMPV
+LABELV $1853
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1870
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRP4
+ASGNP4
+LABELV $1870
+ADDRLP4 80
+INDIRI4
+RETI4
+LABELV $1844
+endproc CG_NumIfBlocks 108 20
+proc CG_FX_SetRenderfx 4 0
+ADDRGP4 ScriptVars+1544
+INDIRI4
+CNSTI4 0
+EQI4 $1873
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $1873
+ADDRGP4 ScriptVars+1520
+INDIRI4
+CNSTI4 0
+EQI4 $1876
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $1876
+ADDRGP4 ScriptVars+1516
+INDIRI4
+CNSTI4 0
+EQI4 $1879
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $1879
+LABELV $1872
+endproc CG_FX_SetRenderfx 4 0
+proc CG_FX_Wobble 112 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 MakeNormalVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1114636288
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1114636288
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1114636288
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1114636288
+CNSTF4 1073741824
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+CNSTF4 1114636288
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1114636288
+CNSTF4 1073741824
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+CNSTF4 1078530011
+ADDRFP4 12
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $1882
+endproc CG_FX_Wobble 112 12
+proc CG_FX_Vibrate 28 8
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 EmitterScript
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1906
+ADDRGP4 PlainScript
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1906
+ADDRGP4 $1905
+JUMPV
+LABELV $1906
+ADDRGP4 ScriptJustParsing
+INDIRI4
+CNSTI4 0
+EQI4 $1908
+ADDRGP4 $1905
+JUMPV
+LABELV $1908
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRLP4 20
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg_vibrateMaxDistance+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+LEF4 $1914
+ADDRGP4 $1905
+JUMPV
+LABELV $1914
+ADDRLP4 12
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 ScriptVars+56
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 cg+3196888
+INDIRF4
+GEF4 $1917
+ADDRGP4 $1905
+JUMPV
+LABELV $1917
+ADDRGP4 cg+3196888
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+3196892
+INDIRF4
+CNSTF4 0
+NEF4 $1921
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+3196892
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1921
+ADDRGP4 cg+3196884
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $1905
+endproc CG_FX_Vibrate 28 8
+proc CG_CopyStoredScriptVarsToLE 0 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+ARGP4
+ADDRGP4 ScriptVars
+ARGP4
+CNSTU4 7844
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1927
+endproc CG_CopyStoredScriptVarsToLE 0 12
+export CG_GetStoredScriptVarsFromLE
+proc CG_GetStoredScriptVarsFromLE 0 12
+ADDRGP4 ScriptVars
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+ARGP4
+CNSTU4 7844
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1928
+endproc CG_GetStoredScriptVarsFromLE 0 12
+proc CG_FX_Sprite 228 12
+ADDRGP4 EmitterScript
+INDIRI4
+CNSTI4 0
+EQI4 $1930
+ADDRGP4 $1929
+JUMPV
+LABELV $1930
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+LEI4 $1932
+ADDRGP4 ScriptVars+7840
+INDIRF4
+ARGF4
+ADDRLP4 180
+ADDRGP4 CG_AllocFxEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 184
+ADDRGP4 EmittedEntities
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDRGP4 ScriptVars+7804
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+ADDRGP4 ScriptVars+7808
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyStoredScriptVarsToLE
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 8148
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8132
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8160
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8144
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CNSTF4 1148846080
+ADDRGP4 ScriptVars+7752
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 ScriptVars+316
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 ScriptVars+84
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 ScriptVars+84+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 ScriptVars+84+8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRGP4 $1933
+JUMPV
+LABELV $1932
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+ADDRLP4 8
+ASGNP4
+LABELV $1933
+ADDRGP4 ScriptVars+1508
+INDIRI4
+CNSTI4 0
+EQI4 $1960
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 ScriptVars+1512
+INDIRF4
+ASGNF4
+LABELV $1960
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1964
+ADDRLP4 4
+INDIRP4
+CNSTI4 7
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 ScriptVars+84
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRGP4 ScriptVars+4
+INDIRF4
+ASGNF4
+ADDRGP4 $1965
+JUMPV
+LABELV $1964
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1968
+ADDRLP4 4
+INDIRP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1969
+JUMPV
+LABELV $1968
+ADDRLP4 4
+INDIRP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1969
+LABELV $1965
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 CG_FX_SetRenderfx
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 ScriptVars+52
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 ScriptVars
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+380
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1972
+ADDRGP4 ScriptVars+380
+ARGP4
+ADDRLP4 180
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+LABELV $1972
+LABELV $1973
+ADDRLP4 184
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 188
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 188
+INDIRF4
+LTF4 $1978
+ADDRLP4 180
+ADDRLP4 184
+INDIRF4
+ADDRLP4 188
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1979
+JUMPV
+LABELV $1978
+ADDRLP4 180
+ADDRLP4 184
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1979
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 180
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 196
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 200
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 196
+INDIRF4
+ADDRLP4 200
+INDIRF4
+LTF4 $1983
+ADDRLP4 192
+ADDRLP4 196
+INDIRF4
+ADDRLP4 200
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1984
+JUMPV
+LABELV $1983
+ADDRLP4 192
+ADDRLP4 196
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1984
+ADDRLP4 4
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 192
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 208
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LTF4 $1988
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1989
+JUMPV
+LABELV $1988
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1989
+ADDRLP4 4
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 204
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 220
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 224
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 224
+INDIRF4
+LTF4 $1993
+ADDRLP4 216
+ADDRLP4 220
+INDIRF4
+ADDRLP4 224
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1994
+JUMPV
+LABELV $1993
+ADDRLP4 216
+ADDRLP4 220
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1994
+ADDRLP4 4
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 216
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+NEI4 $1996
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityFX
+CALLV
+pop
+LABELV $1996
+LABELV $1929
+endproc CG_FX_Sprite 228 12
+proc CG_FX_Spark 4 12
+ADDRGP4 EmitterScript
+INDIRI4
+CNSTI4 0
+EQI4 $1999
+ADDRGP4 $1998
+JUMPV
+LABELV $1999
+ADDRGP4 ScriptVars+380
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2001
+ADDRGP4 ScriptVars+380
+ARGP4
+ADDRGP4 $2005
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2001
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_FX_Sprite
+CALLV
+pop
+LABELV $1998
+endproc CG_FX_Spark 4 12
+proc CG_FX_Beam 228 12
+ADDRGP4 EmitterScript
+INDIRI4
+CNSTI4 0
+EQI4 $2008
+ADDRGP4 $2007
+JUMPV
+LABELV $2008
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+LEI4 $2010
+ADDRGP4 ScriptVars+7840
+INDIRF4
+ARGF4
+ADDRLP4 180
+ADDRGP4 CG_AllocFxEntity
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 184
+ADDRGP4 EmittedEntities
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDRGP4 ScriptVars+7804
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 352
+ADDP4
+ADDRGP4 ScriptVars+7808
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyStoredScriptVarsToLE
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 8148
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 8132
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 8160
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8144
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CNSTF4 1148846080
+ADDRGP4 ScriptVars+7752
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 ScriptVars+316
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRGP4 $2011
+JUMPV
+LABELV $2010
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ADDRLP4 8
+ASGNP4
+LABELV $2011
+ADDRGP4 ScriptVars+1508
+INDIRI4
+CNSTI4 0
+EQI4 $2032
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 ScriptVars+1512
+INDIRF4
+ASGNF4
+LABELV $2032
+ADDRLP4 0
+INDIRP4
+CNSTI4 13
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 ScriptVars+52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 ScriptVars
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+380
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2037
+ADDRGP4 ScriptVars+380
+ARGP4
+ADDRLP4 180
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+LABELV $2037
+LABELV $2038
+ADDRLP4 184
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 188
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 188
+INDIRF4
+LTF4 $2043
+ADDRLP4 180
+ADDRLP4 184
+INDIRF4
+ADDRLP4 188
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2044
+JUMPV
+LABELV $2043
+ADDRLP4 180
+ADDRLP4 184
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2044
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 180
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 196
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 200
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 196
+INDIRF4
+ADDRLP4 200
+INDIRF4
+LTF4 $2048
+ADDRLP4 192
+ADDRLP4 196
+INDIRF4
+ADDRLP4 200
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2049
+JUMPV
+LABELV $2048
+ADDRLP4 192
+ADDRLP4 196
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2049
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 192
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 208
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LTF4 $2053
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2054
+JUMPV
+LABELV $2053
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2054
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 204
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 220
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 224
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 224
+INDIRF4
+LTF4 $2058
+ADDRLP4 216
+ADDRLP4 220
+INDIRF4
+ADDRLP4 224
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2059
+JUMPV
+LABELV $2058
+ADDRLP4 216
+ADDRLP4 220
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2059
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 216
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 CG_FX_SetRenderfx
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+NEI4 $2062
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityFX
+CALLV
+pop
+LABELV $2062
+LABELV $2007
+endproc CG_FX_Beam 228 12
+proc CG_FX_Light 16 20
+ADDRGP4 EmitterScript
+INDIRI4
+CNSTI4 0
+EQI4 $2065
+ADDRGP4 $2064
+JUMPV
+LABELV $2065
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+LEI4 $2067
+ADDRGP4 ScriptVars+7840
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_AllocFxEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 EmittedEntities
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDRGP4 ScriptVars+7804
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+ADDRGP4 ScriptVars+7808
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyStoredScriptVarsToLE
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 8148
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8132
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8160
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8144
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CNSTF4 1148846080
+ADDRGP4 ScriptVars+7752
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 ScriptVars+316
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 ScriptVars+84
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 ScriptVars+84+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 ScriptVars+84+8
+INDIRF4
+ASGNF4
+ADDRGP4 $2068
+JUMPV
+LABELV $2067
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRGP4 ScriptVars
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $2068
+LABELV $2064
+endproc CG_FX_Light 16 20
+proc CG_FX_Model 332 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 EmitterScript
+INDIRI4
+CNSTI4 0
+EQI4 $2101
+ADDRGP4 $2100
+JUMPV
+LABELV $2101
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+LEI4 $2103
+ADDRGP4 ScriptVars+7840
+INDIRF4
+ARGF4
+ADDRLP4 192
+ADDRGP4 CG_AllocFxEntity
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 196
+ADDRGP4 EmittedEntities
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDRGP4 ScriptVars+7804
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 352
+ADDP4
+ADDRGP4 ScriptVars+7808
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CNSTF4 1148846080
+ADDRGP4 ScriptVars+7752
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyStoredScriptVarsToLE
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 8148
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 8132
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 8160
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8144
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRGP4 $2104
+JUMPV
+LABELV $2103
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ADDRLP4 8
+ASGNP4
+LABELV $2104
+ADDRGP4 ScriptVars+1508
+INDIRI4
+CNSTI4 0
+EQI4 $2119
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 ScriptVars+1512
+INDIRF4
+ASGNF4
+LABELV $2119
+ADDRLP4 192
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $2126
+ADDRLP4 192
+INDIRI4
+CNSTI4 1
+EQI4 $2127
+ADDRLP4 192
+INDIRI4
+CNSTI4 2
+EQI4 $2128
+ADDRGP4 $2123
+JUMPV
+LABELV $2126
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2127
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2128
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2123
+ADDRGP4 $2129
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $2124
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRGP4 cg
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRGP4 ScriptVars+444
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 CG_FX_SetRenderfx
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 ScriptVars
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 ScriptVars+52
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+380
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2134
+ADDRGP4 ScriptVars+380
+ARGP4
+ADDRLP4 204
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+LABELV $2134
+LABELV $2135
+ADDRLP4 208
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LTF4 $2140
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2141
+JUMPV
+LABELV $2140
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2141
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 204
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 220
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 224
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 224
+INDIRF4
+LTF4 $2145
+ADDRLP4 216
+ADDRLP4 220
+INDIRF4
+ADDRLP4 224
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2146
+JUMPV
+LABELV $2145
+ADDRLP4 216
+ADDRLP4 220
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2146
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 216
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 232
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 236
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+LTF4 $2150
+ADDRLP4 228
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2151
+JUMPV
+LABELV $2150
+ADDRLP4 228
+ADDRLP4 232
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2151
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 228
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 244
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 248
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 248
+INDIRF4
+LTF4 $2155
+ADDRLP4 240
+ADDRLP4 244
+INDIRF4
+ADDRLP4 248
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2156
+JUMPV
+LABELV $2155
+ADDRLP4 240
+ADDRLP4 244
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2156
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 240
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 ScriptVars+84
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 VectorNormalize2
+CALLF4
+ASGNF4
+ADDRLP4 252
+INDIRF4
+CNSTF4 0
+NEF4 $2157
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $2157
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2162
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $2160
+LABELV $2162
+ADDRGP4 ScriptVars+84
+ARGP4
+ADDRLP4 260
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 260
+INDIRF4
+CNSTF4 0
+EQF4 $2163
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2166
+ADDRGP4 ScriptVars+96
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 180
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 $2161
+JUMPV
+LABELV $2166
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $2161
+ADDRGP4 ScriptVars+108
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 $2161
+JUMPV
+LABELV $2163
+ADDRGP4 ScriptVars+108
+ARGP4
+ADDRLP4 264
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 0
+NEF4 $2172
+ADDRGP4 ScriptVars+96
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 180
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 $2161
+JUMPV
+LABELV $2172
+ADDRGP4 ScriptVars+108
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 $2161
+JUMPV
+LABELV $2160
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2177
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 ScriptVars+120
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRGP4 ScriptVars+120+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 ScriptVars+120+24
+INDIRB
+ASGNB 12
+LABELV $2177
+LABELV $2161
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $2184
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 RotateAroundDirection
+CALLV
+pop
+LABELV $2184
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+EQF4 $2186
+ADDRLP4 264
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ADDRLP4 264
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ADDRLP4 272
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 304
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 312
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 320
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ADDRLP4 320
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 328
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 328
+INDIRP4
+ADDRLP4 328
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2186
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRGP4 ScriptVars+636
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+NEI4 $2189
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityFX
+CALLV
+pop
+LABELV $2189
+LABELV $2100
+endproc CG_FX_Model 332 12
+proc CG_FX_Decal 8 52
+ADDRGP4 EmitterScript
+INDIRI4
+CNSTI4 0
+EQI4 $2192
+ADDRGP4 $2191
+JUMPV
+LABELV $2192
+ADDRGP4 ScriptVars+380
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2195
+ADDRGP4 $2191
+JUMPV
+LABELV $2195
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRGP4 ScriptVars+96
+ARGP4
+ADDRGP4 ScriptVars+52
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+1556
+INDIRI4
+ARGI4
+ADDRGP4 ScriptVars
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 ScriptVars+1552
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $2191
+endproc CG_FX_Decal 8 52
+proc CG_FX_DecalTemp 12 52
+ADDRGP4 EmitterScript
+INDIRI4
+CNSTI4 0
+EQI4 $2210
+ADDRGP4 $2209
+JUMPV
+LABELV $2210
+ADDRGP4 ScriptVars+380
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRGP4 ScriptVars+96
+ARGP4
+ADDRGP4 ScriptVars+52
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+ARGF4
+ADDRGP4 ScriptVars+1556
+INDIRI4
+ARGI4
+ADDRGP4 ScriptVars
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 ScriptVars+1552
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $2209
+endproc CG_FX_DecalTemp 12 52
+proc CG_FX_Rings 64 4
+ADDRGP4 EmitterScript
+INDIRI4
+CNSTI4 0
+EQI4 $2226
+ADDRGP4 $2225
+JUMPV
+LABELV $2226
+ADDRGP4 PlainScript
+INDIRI4
+CNSTI4 0
+EQI4 $2228
+ADDRGP4 $2225
+JUMPV
+LABELV $2228
+ADDRGP4 ScriptVars+7840
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_AllocFxEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+LEI4 $2231
+ADDRLP4 12
+ADDRGP4 EmittedEntities
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDRGP4 ScriptVars+7804
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+ADDRGP4 ScriptVars+7808
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyStoredScriptVarsToLE
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 8148
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8132
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8160
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8144
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRGP4 $2232
+JUMPV
+LABELV $2231
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2232
+ADDRGP4 ScriptVars+1508
+INDIRI4
+CNSTI4 0
+EQI4 $2240
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 ScriptVars+1512
+INDIRF4
+ASGNF4
+LABELV $2240
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 ScriptVars
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 ScriptVars+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CNSTF4 1148846080
+ADDRGP4 ScriptVars+7752
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 14
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+412
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LTF4 $2256
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2257
+JUMPV
+LABELV $2256
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2257
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 16
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $2261
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2262
+JUMPV
+LABELV $2261
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2262
+ADDRLP4 4
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LTF4 $2266
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2267
+JUMPV
+LABELV $2266
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2267
+ADDRLP4 4
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 40
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 56
+CNSTF4 1132396544
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LTF4 $2271
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2272
+JUMPV
+LABELV $2271
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2272
+ADDRLP4 4
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 52
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 ScriptVars+316
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+ASGNF4
+LABELV $2225
+endproc CG_FX_Rings 64 4
+proc CG_FX_Sound 20 16
+ADDRGP4 EmitterScript
+INDIRI4
+CNSTI4 0
+EQI4 $2281
+ADDRGP4 $2280
+JUMPV
+LABELV $2281
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+LEI4 $2283
+ADDRGP4 ScriptVars+7840
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_AllocFxEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 EmittedEntities
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDRGP4 ScriptVars+7804
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+ADDRGP4 ScriptVars+7808
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyStoredScriptVarsToLE
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 8148
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8132
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8160
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8144
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CNSTF4 1148846080
+ADDRGP4 ScriptVars+7752
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 ScriptVars+316
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 ScriptVars+84
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 ScriptVars+84+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 ScriptVars+84+8
+INDIRF4
+ASGNF4
+ADDRGP4 $2284
+JUMPV
+LABELV $2283
+ADDRGP4 ScriptVars+572
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2310
+ADDRGP4 ScriptVars+572
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2314
+CNSTP4 0
+ARGP4
+ADDRGP4 ScriptVars+360
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRGP4 $2315
+JUMPV
+LABELV $2314
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $2317
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $2318
+JUMPV
+LABELV $2317
+ADDRGP4 ScriptVars+60
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $2318
+LABELV $2315
+LABELV $2310
+LABELV $2284
+LABELV $2280
+endproc CG_FX_Sound 20 16
+proc CG_FX_LoopSound 20 16
+ADDRGP4 EmitterScript
+INDIRI4
+CNSTI4 0
+EQI4 $2321
+ADDRGP4 $2320
+JUMPV
+LABELV $2321
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+LEI4 $2323
+ADDRGP4 ScriptVars+7840
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_AllocFxEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 EmittedEntities
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDRGP4 ScriptVars+7804
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+ADDRGP4 ScriptVars+7808
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyStoredScriptVarsToLE
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 8148
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8132
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8160
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8144
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CNSTF4 1148846080
+ADDRGP4 ScriptVars+7752
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 ScriptVars+316
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 ScriptVars+316+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 ScriptVars+316+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRGP4 ScriptVars+316+12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 ScriptVars+84
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 ScriptVars+84+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 ScriptVars+84+8
+INDIRF4
+ASGNF4
+ADDRGP4 $2324
+JUMPV
+LABELV $2323
+ADDRGP4 ScriptVars+508
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2351
+ADDRGP4 $2353
+JUMPV
+ADDRGP4 ScriptVars+640
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRGP4 ScriptVars+84
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddLoopingSound
+CALLV
+pop
+ADDRGP4 $2354
+JUMPV
+LABELV $2353
+ADDRGP4 FxLoopSounds
+INDIRI4
+CNSTI4 2048
+LTI4 $2358
+ADDRGP4 $2360
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $2359
+JUMPV
+LABELV $2358
+ADDRGP4 FxLoopSounds
+INDIRI4
+ARGI4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRGP4 ScriptVars+84
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddLoopingSound
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 FxLoopSounds
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2359
+LABELV $2354
+LABELV $2351
+LABELV $2324
+LABELV $2320
+endproc CG_FX_LoopSound 20 16
+proc CG_ParseRenderTokens 112 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 ScriptVars+1516
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+1520
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+1524
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+1528
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+1532
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+1536
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+1544
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+1548
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2373
+JUMPV
+LABELV $2372
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 64
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2375
+ADDRGP4 $2374
+JUMPV
+LABELV $2375
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2379
+ARGP4
+ADDRLP4 80
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $2377
+ADDRGP4 ScriptVars+1516
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2378
+JUMPV
+LABELV $2377
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2383
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $2381
+ADDRGP4 ScriptVars+1520
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2382
+JUMPV
+LABELV $2381
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2387
+ARGP4
+ADDRLP4 88
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $2385
+ADDRGP4 ScriptVars+1524
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2386
+JUMPV
+LABELV $2385
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2391
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $2389
+ADDRGP4 ScriptVars+1528
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2390
+JUMPV
+LABELV $2389
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2395
+ARGP4
+ADDRLP4 96
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $2393
+ADDRGP4 ScriptVars+1532
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2394
+JUMPV
+LABELV $2393
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2399
+ARGP4
+ADDRLP4 100
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $2397
+ADDRGP4 ScriptVars+1536
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2398
+JUMPV
+LABELV $2397
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2403
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $2401
+ADDRGP4 ScriptVars+1544
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2402
+JUMPV
+LABELV $2401
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2407
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $2405
+ADDRGP4 ScriptVars+1548
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2406
+JUMPV
+LABELV $2405
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $2374
+ADDRGP4 $2411
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $2363
+JUMPV
+LABELV $2406
+LABELV $2402
+LABELV $2398
+LABELV $2394
+LABELV $2390
+LABELV $2386
+LABELV $2382
+LABELV $2378
+ADDRFP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+LABELV $2373
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $2372
+LABELV $2374
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $2363
+endproc CG_ParseRenderTokens 112 20
+export CG_RunQ3mmeScript
+proc CG_RunQ3mmeScript 1772 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2414
+JUMPV
+LABELV $2413
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2416
+ADDRGP4 $2418
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2416
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2419
+ADDRGP4 $2415
+JUMPV
+LABELV $2419
+ADDRGP4 $2423
+ARGP4
+ADDRLP4 124
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $2421
+ADDRGP4 EmitterScript
+INDIRI4
+CNSTI4 0
+NEI4 $2424
+ADDRGP4 $2426
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2424
+LABELV $2421
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2427
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2429
+ADDRGP4 $2414
+JUMPV
+LABELV $2429
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $2431
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2432
+JUMPV
+LABELV $2431
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2433
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2433
+LABELV $2432
+LABELV $2427
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $2437
+ADDRLP4 128
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 128
+INDIRU4
+CNSTU4 0
+EQU4 $2435
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 128
+INDIRU4
+LTU4 $2435
+LABELV $2437
+CNSTI4 0
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2435
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2438
+ADDRLP4 132
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+LTI4 $2440
+ADDRLP4 132
+INDIRI4
+CNSTI4 150
+GTI4 $2440
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2709-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2709
+address $2443
+address $2445
+address $2447
+address $2449
+address $2451
+address $2453
+address $2455
+address $2457
+address $2459
+address $2461
+address $2463
+address $2465
+address $2467
+address $2469
+address $2471
+address $2473
+address $2475
+address $2477
+address $2479
+address $2481
+address $2440
+address $2483
+address $2485
+address $2487
+address $2440
+address $2489
+address $2491
+address $2493
+address $2440
+address $2495
+address $2497
+address $2499
+address $2440
+address $2501
+address $2503
+address $2505
+address $2440
+address $2507
+address $2509
+address $2511
+address $2440
+address $2513
+address $2515
+address $2517
+address $2440
+address $2519
+address $2521
+address $2523
+address $2440
+address $2525
+address $2527
+address $2529
+address $2440
+address $2531
+address $2533
+address $2535
+address $2440
+address $2537
+address $2539
+address $2541
+address $2440
+address $2543
+address $2545
+address $2547
+address $2440
+address $2549
+address $2551
+address $2553
+address $2440
+address $2555
+address $2557
+address $2559
+address $2440
+address $2561
+address $2563
+address $2565
+address $2440
+address $2567
+address $2569
+address $2571
+address $2573
+address $2575
+address $2577
+address $2579
+address $2581
+address $2583
+address $2585
+address $2587
+address $2589
+address $2591
+address $2593
+address $2595
+address $2597
+address $2599
+address $2601
+address $2603
+address $2605
+address $2607
+address $2609
+address $2611
+address $2613
+address $2615
+address $2617
+address $2619
+address $2621
+address $2623
+address $2625
+address $2627
+address $2629
+address $2631
+address $2633
+address $2635
+address $2637
+address $2639
+address $2641
+address $2643
+address $2645
+address $2647
+address $2649
+address $2440
+address $2440
+address $2651
+address $2653
+address $2655
+address $2657
+address $2659
+address $2661
+address $2663
+address $2665
+address $2667
+address $2669
+address $2671
+address $2673
+address $2675
+address $2677
+address $2679
+address $2681
+address $2683
+address $2685
+address $2687
+address $2689
+address $2691
+address $2693
+address $2695
+address $2697
+address $2699
+address $2701
+address $2703
+address $2705
+address $2707
+code
+LABELV $2440
+ADDRGP4 $2708
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2441
+LABELV $2438
+ADDRGP4 $2711
+JUMPV
+ADDRGP4 $2712
+JUMPV
+LABELV $2711
+ADDRLP4 4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $2713
+LABELV $2443
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+316
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2713
+ADDRLP4 4
+ARGP4
+ADDRGP4 $153
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2720
+LABELV $2445
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+316+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 140
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2720
+ADDRLP4 4
+ARGP4
+ADDRGP4 $154
+ARGP4
+ADDRLP4 140
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $2726
+LABELV $2447
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+316+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 144
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2726
+ADDRLP4 4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 144
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $2732
+LABELV $2449
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 ScriptVars+316
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 ScriptVars+316+4
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 164
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 ScriptVars+316+8
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $2732
+ADDRLP4 4
+ARGP4
+ADDRGP4 $156
+ARGP4
+ADDRLP4 148
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2739
+LABELV $2451
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+316+12
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2739
+ADDRLP4 4
+ARGP4
+ADDRGP4 $157
+ARGP4
+ADDRLP4 152
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $2745
+LABELV $2453
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+380
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRGP4 $2719
+JUMPV
+LABELV $2745
+ADDRLP4 4
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 156
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $2748
+LABELV $2455
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+444
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 160
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRGP4 $2719
+JUMPV
+LABELV $2748
+ADDRLP4 4
+ARGP4
+ADDRGP4 $159
+ARGP4
+ADDRLP4 160
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $2751
+LABELV $2457
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 164
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2751
+ADDRLP4 4
+ARGP4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 164
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $2755
+LABELV $2459
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 168
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2755
+ADDRLP4 4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 168
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $2760
+LABELV $2461
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+52
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 172
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2760
+ADDRLP4 4
+ARGP4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 172
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $2765
+LABELV $2463
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+12
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 176
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2765
+ADDRLP4 4
+ARGP4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 176
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $2770
+LABELV $2465
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+16
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 180
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2770
+ADDRLP4 4
+ARGP4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 180
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $2775
+LABELV $2467
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+20
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 184
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 184
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2775
+ADDRLP4 4
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 184
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $2780
+LABELV $2469
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+24
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 188
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2780
+ADDRLP4 4
+ARGP4
+ADDRGP4 $166
+ARGP4
+ADDRLP4 188
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $2785
+LABELV $2471
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+28
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 192
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2785
+ADDRLP4 4
+ARGP4
+ADDRGP4 $167
+ARGP4
+ADDRLP4 192
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $2790
+LABELV $2473
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+32
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 196
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2790
+ADDRLP4 4
+ARGP4
+ADDRGP4 $168
+ARGP4
+ADDRLP4 196
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $2795
+LABELV $2475
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+36
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 200
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2795
+ADDRLP4 4
+ARGP4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 200
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+NEI4 $2800
+LABELV $2477
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+40
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 204
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2800
+ADDRLP4 4
+ARGP4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 204
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $2805
+LABELV $2479
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+44
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 208
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2805
+ADDRLP4 4
+ARGP4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 208
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+NEI4 $2810
+LABELV $2481
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+48
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 212
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 212
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2810
+ADDRLP4 4
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 212
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $2815
+LABELV $2483
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+84
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 216
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 216
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2815
+ADDRLP4 4
+ARGP4
+ADDRGP4 $174
+ARGP4
+ADDRLP4 216
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $2820
+LABELV $2485
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+84+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 220
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 220
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2820
+ADDRLP4 4
+ARGP4
+ADDRGP4 $175
+ARGP4
+ADDRLP4 220
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+NEI4 $2826
+LABELV $2487
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+84+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 224
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 224
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2826
+ADDRLP4 4
+ARGP4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 224
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $2832
+LABELV $2489
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 228
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 228
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2832
+ADDRLP4 4
+ARGP4
+ADDRGP4 $178
+ARGP4
+ADDRLP4 228
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+NEI4 $2837
+LABELV $2491
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+60+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 232
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2837
+ADDRLP4 4
+ARGP4
+ADDRGP4 $179
+ARGP4
+ADDRLP4 232
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+NEI4 $2843
+LABELV $2493
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+60+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 236
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 236
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2843
+ADDRLP4 4
+ARGP4
+ADDRGP4 $181
+ARGP4
+ADDRLP4 236
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+NEI4 $2849
+LABELV $2495
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+72
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 240
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 240
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2849
+ADDRLP4 4
+ARGP4
+ADDRGP4 $182
+ARGP4
+ADDRLP4 240
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $2854
+LABELV $2497
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+72+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 244
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 244
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2854
+ADDRLP4 4
+ARGP4
+ADDRGP4 $183
+ARGP4
+ADDRLP4 244
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+NEI4 $2860
+LABELV $2499
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+72+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 248
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 248
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2860
+ADDRLP4 4
+ARGP4
+ADDRGP4 $185
+ARGP4
+ADDRLP4 248
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $2866
+LABELV $2501
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+96
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 252
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 252
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2866
+ADDRLP4 4
+ARGP4
+ADDRGP4 $186
+ARGP4
+ADDRLP4 252
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+NEI4 $2871
+LABELV $2503
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+96+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 256
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 256
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2871
+ADDRLP4 4
+ARGP4
+ADDRGP4 $187
+ARGP4
+ADDRLP4 256
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $2877
+LABELV $2505
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+96+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 260
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 260
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2877
+ADDRLP4 4
+ARGP4
+ADDRGP4 $189
+ARGP4
+ADDRLP4 260
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $2883
+LABELV $2507
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+108
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 264
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2883
+ADDRLP4 4
+ARGP4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 264
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $2888
+LABELV $2509
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+108+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 268
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 268
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2888
+ADDRLP4 4
+ARGP4
+ADDRGP4 $191
+ARGP4
+ADDRLP4 268
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $2894
+LABELV $2511
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+108+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 272
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2894
+ADDRLP4 4
+ARGP4
+ADDRGP4 $193
+ARGP4
+ADDRLP4 272
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $2900
+LABELV $2513
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+184
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 276
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 276
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2900
+ADDRLP4 4
+ARGP4
+ADDRGP4 $194
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $2905
+LABELV $2515
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+184+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 280
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 280
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2905
+ADDRLP4 4
+ARGP4
+ADDRGP4 $195
+ARGP4
+ADDRLP4 280
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $2911
+LABELV $2517
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+184+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 284
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 284
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2911
+ADDRLP4 4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 284
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+NEI4 $2917
+LABELV $2519
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+196
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 288
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 288
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2917
+ADDRLP4 4
+ARGP4
+ADDRGP4 $198
+ARGP4
+ADDRLP4 288
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $2922
+LABELV $2521
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+196+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 292
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 292
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2922
+ADDRLP4 4
+ARGP4
+ADDRGP4 $199
+ARGP4
+ADDRLP4 292
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $2928
+LABELV $2523
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+196+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 296
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2928
+ADDRLP4 4
+ARGP4
+ADDRGP4 $201
+ARGP4
+ADDRLP4 296
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $2934
+LABELV $2525
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+208
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 300
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 300
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2934
+ADDRLP4 4
+ARGP4
+ADDRGP4 $202
+ARGP4
+ADDRLP4 300
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $2939
+LABELV $2527
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+208+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 304
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 304
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2939
+ADDRLP4 4
+ARGP4
+ADDRGP4 $203
+ARGP4
+ADDRLP4 304
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+NEI4 $2945
+LABELV $2529
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+208+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 308
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 308
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2945
+ADDRLP4 4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 308
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+NEI4 $2951
+LABELV $2531
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+220
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 312
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 312
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2951
+ADDRLP4 4
+ARGP4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 312
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+NEI4 $2956
+LABELV $2533
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+220+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 316
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 316
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2956
+ADDRLP4 4
+ARGP4
+ADDRGP4 $207
+ARGP4
+ADDRLP4 316
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+NEI4 $2962
+LABELV $2535
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+220+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 320
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 320
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2962
+ADDRLP4 4
+ARGP4
+ADDRGP4 $209
+ARGP4
+ADDRLP4 320
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+NEI4 $2968
+LABELV $2537
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+232
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 324
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 324
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2968
+ADDRLP4 4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 324
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+NEI4 $2973
+LABELV $2539
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+232+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 328
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 328
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2973
+ADDRLP4 4
+ARGP4
+ADDRGP4 $211
+ARGP4
+ADDRLP4 328
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+NEI4 $2979
+LABELV $2541
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+232+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 332
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 332
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2979
+ADDRLP4 4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 332
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+NEI4 $2985
+LABELV $2543
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+244
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 336
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 336
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2985
+ADDRLP4 4
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRLP4 336
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+NEI4 $2990
+LABELV $2545
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+244+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 340
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 340
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2990
+ADDRLP4 4
+ARGP4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 340
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+NEI4 $2996
+LABELV $2547
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+244+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 344
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 344
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $2996
+ADDRLP4 4
+ARGP4
+ADDRGP4 $217
+ARGP4
+ADDRLP4 344
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+NEI4 $3002
+LABELV $2549
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+256
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 348
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 348
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3002
+ADDRLP4 4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 348
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+NEI4 $3007
+LABELV $2551
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+256+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 352
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 352
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3008
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3007
+ADDRLP4 4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 352
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+NEI4 $3013
+LABELV $2553
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+256+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 356
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 356
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3013
+ADDRLP4 4
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 356
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+NEI4 $3019
+LABELV $2555
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+268
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 360
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 360
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3019
+ADDRLP4 4
+ARGP4
+ADDRGP4 $222
+ARGP4
+ADDRLP4 360
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+NEI4 $3024
+LABELV $2557
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+268+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 364
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 364
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3024
+ADDRLP4 4
+ARGP4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 364
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+NEI4 $3030
+LABELV $2559
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+268+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 368
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 368
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3030
+ADDRLP4 4
+ARGP4
+ADDRGP4 $225
+ARGP4
+ADDRLP4 368
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+NEI4 $3036
+LABELV $2561
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+280
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 372
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 372
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3036
+ADDRLP4 4
+ARGP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 372
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+NEI4 $3041
+LABELV $2563
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+280+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 376
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 376
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3041
+ADDRLP4 4
+ARGP4
+ADDRGP4 $227
+ARGP4
+ADDRLP4 376
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 376
+INDIRI4
+CNSTI4 0
+NEI4 $3047
+LABELV $2565
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+280+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 380
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 380
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3047
+ADDRLP4 4
+ARGP4
+ADDRGP4 $229
+ARGP4
+ADDRLP4 380
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 380
+INDIRI4
+CNSTI4 0
+NEI4 $3053
+LABELV $2567
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+292
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 384
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 384
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3053
+ADDRLP4 4
+ARGP4
+ADDRGP4 $230
+ARGP4
+ADDRLP4 384
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 384
+INDIRI4
+CNSTI4 0
+NEI4 $3058
+LABELV $2569
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+292+4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 388
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 388
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3058
+ADDRLP4 4
+ARGP4
+ADDRGP4 $231
+ARGP4
+ADDRLP4 388
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 0
+NEI4 $3064
+LABELV $2571
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+292+8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 392
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 392
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3064
+ADDRLP4 4
+ARGP4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 392
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+NEI4 $3070
+LABELV $2573
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 396
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 396
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 400
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 400
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 404
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 404
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 408
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 412
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 412
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3072
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3072
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 416
+CNSTI4 4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 416
+INDIRI4
+ADDP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 416
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 420
+CNSTI4 8
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 420
+INDIRI4
+ADDP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 420
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3070
+ADDRLP4 4
+ARGP4
+ADDRGP4 $233
+ARGP4
+ADDRLP4 396
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+NEI4 $3074
+LABELV $2575
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 400
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 400
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 404
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 404
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 408
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 408
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 412
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 416
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 416
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 420
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 420
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+CNSTI4 4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 424
+INDIRI4
+ADDP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 424
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 424
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 428
+CNSTI4 8
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 428
+INDIRI4
+ADDP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 428
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 428
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3074
+ADDRLP4 4
+ARGP4
+ADDRGP4 $234
+ARGP4
+ADDRLP4 400
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+NEI4 $3076
+LABELV $2577
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 404
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 404
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 408
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 412
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 412
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 416
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 416
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 420
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 420
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 424
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 428
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 428
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3078
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3078
+ADDRLP4 432
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 436
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 432
+INDIRP4
+INDIRF4
+ADDRLP4 436
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 432
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 436
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 92
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 440
+CNSTI4 4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 440
+INDIRI4
+ADDP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 440
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 440
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 444
+CNSTI4 8
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 444
+INDIRI4
+ADDP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 444
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 444
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3076
+ADDRLP4 4
+ARGP4
+ADDRGP4 $235
+ARGP4
+ADDRLP4 404
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 404
+INDIRI4
+CNSTI4 0
+NEI4 $3082
+LABELV $2579
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 408
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 408
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 412
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 416
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 416
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 420
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 420
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 424
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 428
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 428
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 432
+CNSTI4 4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 432
+INDIRI4
+ADDP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 432
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 432
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 436
+CNSTI4 8
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 436
+INDIRI4
+ADDP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 436
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 436
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3082
+ADDRLP4 4
+ARGP4
+ADDRGP4 $236
+ARGP4
+ADDRLP4 408
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 408
+INDIRI4
+CNSTI4 0
+NEI4 $3084
+LABELV $2581
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 412
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 412
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 416
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 416
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 420
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 420
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 424
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 428
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 428
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 432
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 432
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 436
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 436
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3086
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3086
+ADDRLP4 440
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 444
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 440
+INDIRP4
+INDIRF4
+ADDRLP4 444
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 440
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 444
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 92
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 448
+CNSTI4 4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 448
+INDIRI4
+ADDP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 448
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 452
+CNSTI4 8
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 452
+INDIRI4
+ADDP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 452
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3084
+ADDRLP4 4
+ARGP4
+ADDRGP4 $237
+ARGP4
+ADDRLP4 412
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+NEI4 $3092
+LABELV $2583
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 416
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 416
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 420
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 420
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 424
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 428
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 428
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2719
+JUMPV
+LABELV $3092
+ADDRLP4 4
+ARGP4
+ADDRGP4 $238
+ARGP4
+ADDRLP4 416
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+NEI4 $3094
+LABELV $2585
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 420
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 420
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 424
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRLP4 428
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 432
+CNSTF4 0
+ASGNF4
+ADDRLP4 428
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 428
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 428
+INDIRP4
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3094
+ADDRLP4 4
+ARGP4
+ADDRGP4 $239
+ARGP4
+ADDRLP4 420
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 420
+INDIRI4
+CNSTI4 0
+NEI4 $3096
+LABELV $2587
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 424
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 428
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 428
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 432
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 432
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 436
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 436
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 440
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 440
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3098
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3098
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRGP4 CG_FX_Wobble
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3096
+ADDRLP4 4
+ARGP4
+ADDRGP4 $240
+ARGP4
+ADDRLP4 424
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+CNSTI4 0
+NEI4 $3101
+LABELV $2589
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 428
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 428
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 432
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 432
+INDIRP4
+ASGNP4
+ADDRLP4 436
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+CNSTF4 1073741824
+ADDRLP4 436
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 440
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 440
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 444
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 444
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3101
+ADDRLP4 4
+ARGP4
+ADDRGP4 $241
+ARGP4
+ADDRLP4 428
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+NEI4 $3103
+LABELV $2591
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 432
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 432
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 436
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 436
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 440
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 440
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3105
+ADDRLP4 80
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRGP4 $3106
+JUMPV
+LABELV $3105
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 444
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 444
+INDIRP4
+ASGNP4
+LABELV $3106
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3103
+ADDRLP4 4
+ARGP4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 432
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 432
+INDIRI4
+CNSTI4 0
+NEI4 $3107
+LABELV $2593
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 436
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 436
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 440
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 440
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 444
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 444
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 448
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 448
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3107
+ADDRLP4 4
+ARGP4
+ADDRGP4 $243
+ARGP4
+ADDRLP4 436
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+NEI4 $3109
+LABELV $2595
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 440
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 440
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 444
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 444
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 448
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 448
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 452
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 452
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 456
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 456
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 460
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 460
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3109
+ADDRLP4 4
+ARGP4
+ADDRGP4 $244
+ARGP4
+ADDRLP4 440
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 440
+INDIRI4
+CNSTI4 0
+NEI4 $3111
+LABELV $2597
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 444
+ADDRGP4 CG_ParseRenderTokens
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 444
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3114
+CNSTI4 0
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3114
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_FX_Sprite
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3111
+ADDRLP4 4
+ARGP4
+ADDRGP4 $245
+ARGP4
+ADDRLP4 444
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 444
+INDIRI4
+CNSTI4 0
+NEI4 $3116
+LABELV $2599
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 448
+ADDRGP4 CG_ParseRenderTokens
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 448
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3119
+CNSTI4 0
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3119
+ADDRGP4 CG_FX_Spark
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3116
+ADDRLP4 4
+ARGP4
+ADDRGP4 $246
+ARGP4
+ADDRLP4 448
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 448
+INDIRI4
+CNSTI4 0
+NEI4 $3121
+LABELV $2601
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 452
+ADDRGP4 CG_ParseRenderTokens
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 452
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3124
+CNSTI4 0
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3124
+ADDRLP4 456
+CNSTI4 0
+ASGNI4
+ADDRLP4 456
+INDIRI4
+ARGI4
+ADDRLP4 456
+INDIRI4
+ARGI4
+ADDRGP4 CG_FX_Sprite
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3121
+ADDRLP4 4
+ARGP4
+ADDRGP4 $247
+ARGP4
+ADDRLP4 452
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 0
+NEI4 $3126
+LABELV $2603
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 456
+ADDRGP4 CG_ParseRenderTokens
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 456
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3129
+CNSTI4 0
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3129
+ADDRGP4 CG_FX_Beam
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3126
+ADDRLP4 4
+ARGP4
+ADDRGP4 $248
+ARGP4
+ADDRLP4 456
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+NEI4 $3131
+LABELV $2605
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 CG_FX_Light
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3131
+ADDRLP4 4
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRLP4 460
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 0
+NEI4 $3134
+LABELV $2607
+ADDRLP4 496
+CNSTI4 0
+ASGNI4
+ADDRLP4 492
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3136
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3136
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 500
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 500
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3138
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3138
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+NEI4 $3140
+ADDRGP4 DistanceScript
+INDIRI4
+CNSTI4 0
+EQI4 $3142
+ADDRLP4 504
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7764
+INDIRF4
+ADDRLP4 504
+INDIRF4
+LTF4 $3143
+ADDRLP4 504
+INDIRF4
+CNSTF4 0
+LEF4 $3143
+ADDRLP4 492
+CNSTI4 1
+ASGNI4
+ADDRGP4 ScriptVars+7764
+CNSTF4 0
+ASGNF4
+ADDRGP4 $3143
+JUMPV
+LABELV $3142
+ADDRGP4 ScriptVars+7788
+ARGP4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRLP4 504
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 508
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 504
+INDIRF4
+ADDRLP4 508
+INDIRF4
+LTF4 $3148
+ADDRLP4 508
+INDIRF4
+CNSTF4 0
+LEF4 $3148
+ADDRLP4 492
+CNSTI4 1
+ASGNI4
+LABELV $3148
+LABELV $3143
+ADDRLP4 492
+INDIRI4
+CNSTI4 0
+EQI4 $3152
+ADDRGP4 ScriptVars+7800
+INDIRF4
+CNSTF4 3212836864
+NEF4 $3152
+ADDRLP4 492
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+7788
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $3152
+ADDRLP4 492
+INDIRI4
+CNSTI4 0
+EQI4 $3159
+ADDRLP4 88
+INDIRF4
+ADDRGP4 cg_fxScriptMinDistance+8
+INDIRF4
+GEF4 $3161
+ADDRLP4 88
+ADDRGP4 cg_fxScriptMinDistance+8
+INDIRF4
+ASGNF4
+LABELV $3161
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+EQI4 $3165
+LABELV $3165
+ADDRLP4 464
+ADDRGP4 ScriptVars+60
+INDIRF4
+ADDRGP4 ScriptVars+7788
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 464+4
+ADDRGP4 ScriptVars+60+4
+INDIRF4
+ADDRGP4 ScriptVars+7788+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 464+8
+ADDRGP4 ScriptVars+60+8
+INDIRF4
+ADDRGP4 ScriptVars+7788+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 464
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 480
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 504
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 476
+CNSTI4 0
+ASGNI4
+ADDRLP4 516
+CNSTF4 0
+ASGNF4
+ADDRGP4 $3182
+JUMPV
+LABELV $3181
+ADDRGP4 ScriptVars+7788
+ARGP4
+ADDRLP4 480
+ARGP4
+ADDRLP4 524
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+ASGNF4
+ADDRLP4 520
+INDIRF4
+ADDRLP4 88
+INDIRF4
+GEF4 $3185
+ADDRGP4 $3183
+JUMPV
+LABELV $3185
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+NEI4 $3187
+ADDRGP4 $3188
+JUMPV
+LABELV $3187
+ADDRLP4 520
+INDIRF4
+ADDRLP4 516
+INDIRF4
+LTF4 $3189
+ADDRGP4 $3183
+JUMPV
+LABELV $3189
+LABELV $3188
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+ASGNF4
+ADDRLP4 476
+ADDRLP4 476
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 528
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 504
+ADDRGP4 ScriptVars+7788
+INDIRF4
+ADDRLP4 464
+INDIRF4
+ADDRLP4 528
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 504+4
+ADDRGP4 ScriptVars+7788+4
+INDIRF4
+ADDRLP4 464+4
+INDIRF4
+ADDRLP4 528
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 504+8
+ADDRGP4 ScriptVars+7788+8
+INDIRF4
+ADDRLP4 464+8
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 ScriptVars+60
+ADDRLP4 504
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 532
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+ASGNI4
+ADDRLP4 532
+INDIRI4
+CNSTI4 0
+EQI4 $3201
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3201
+ADDRGP4 ScriptVars+7788
+ADDRLP4 504
+INDIRB
+ASGNB 12
+LABELV $3182
+ADDRGP4 $3181
+JUMPV
+LABELV $3183
+ADDRGP4 ScriptVars+60
+ADDRLP4 480
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7788
+ADDRLP4 480
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $3159
+LABELV $3140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 504
+ADDRGP4 CG_SkipBlock
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 504
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2719
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3134
+ADDRLP4 4
+ARGP4
+ADDRGP4 $250
+ARGP4
+ADDRLP4 464
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+CNSTI4 0
+NEI4 $3210
+LABELV $2609
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3212
+JUMPV
+LABELV $3210
+ADDRLP4 4
+ARGP4
+ADDRGP4 $251
+ARGP4
+ADDRLP4 468
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $3213
+LABELV $2611
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+LABELV $3212
+ADDRGP4 cg+8
+INDIRI4
+CNSTI4 0
+EQI4 $3215
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 488
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 488
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 492
+ADDRGP4 CG_SkipBlock
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 492
+INDIRP4
+ASGNP4
+ADDRGP4 $2719
+JUMPV
+LABELV $3215
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3218
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3218
+ADDRLP4 88
+INDIRF4
+CNSTF4 0
+GTF4 $3220
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 488
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 488
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 492
+ADDRGP4 CG_SkipBlock
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 492
+INDIRP4
+ASGNP4
+ADDRGP4 $2719
+JUMPV
+LABELV $3220
+ADDRLP4 488
+ADDRGP4 parsingEmitterScriptLevel
+ASGNP4
+ADDRLP4 488
+INDIRP4
+ADDRLP4 488
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 88
+INDIRF4
+ADDRGP4 cg_fxScriptMinEmitter+8
+INDIRF4
+GEF4 $3222
+ADDRLP4 88
+ADDRGP4 cg_fxScriptMinEmitter+8
+INDIRF4
+ASGNF4
+LABELV $3222
+ADDRGP4 ScriptVars+7752
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7756
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 ScriptVars+7760
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 492
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 492
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3229
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3229
+ADDRGP4 ScriptVars+7804
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 ScriptJustParsing
+CNSTI4 1
+ASGNI4
+ADDRLP4 496
+ADDRGP4 EmitterScript
+ASGNP4
+ADDRLP4 476
+ADDRLP4 496
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 500
+CNSTI4 0
+ASGNI4
+ADDRLP4 496
+INDIRP4
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRLP4 504
+ADDRGP4 EmittedEntities
+ASGNP4
+ADDRLP4 480
+ADDRLP4 504
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 504
+INDIRP4
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 508
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+EQI4 $3232
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3232
+ADDRGP4 EmitterScript
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 512
+ADDRGP4 EmittedEntities
+ASGNP4
+ADDRLP4 484
+ADDRLP4 512
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 512
+INDIRP4
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRLP4 516
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptJustParsing
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+ADDRLP4 516
+INDIRI4
+NEI4 $3234
+ADDRGP4 ScriptVars+7840
+INDIRF4
+ARGF4
+ADDRLP4 520
+ADDRGP4 CG_AllocFxEntity
+CALLP4
+ASGNP4
+ADDRLP4 472
+ADDRLP4 520
+INDIRP4
+ASGNP4
+ADDRLP4 472
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 472
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyStoredScriptVarsToLE
+CALLV
+pop
+ADDRLP4 472
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 472
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 472
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CNSTF4 1148846080
+ADDRGP4 ScriptVars+7752
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 524
+ADDRLP4 472
+INDIRP4
+ASGNP4
+ADDRLP4 524
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 524
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 524
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 472
+INDIRP4
+CNSTI4 8148
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 472
+INDIRP4
+CNSTI4 8132
+ADDP4
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 472
+INDIRP4
+CNSTI4 8160
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 472
+INDIRP4
+CNSTI4 8144
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $3234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 CG_SkipBlock
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 520
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3244
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3244
+ADDRLP4 524
+ADDRGP4 parsingEmitterScriptLevel
+ASGNP4
+ADDRLP4 524
+INDIRP4
+ADDRLP4 524
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2719
+JUMPV
+LABELV $3213
+ADDRLP4 4
+ARGP4
+ADDRGP4 $3248
+ARGP4
+ADDRLP4 472
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+NEI4 $3246
+LABELV $2613
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 476
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 476
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3249
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3249
+ADDRGP4 ScriptVars+1488
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+1484
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2719
+JUMPV
+LABELV $3246
+ADDRLP4 4
+ARGP4
+ADDRGP4 $3255
+ARGP4
+ADDRLP4 476
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+NEI4 $3253
+LABELV $2615
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 480
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 480
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3256
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3256
+ADDRGP4 ScriptVars+1540
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3253
+ADDRLP4 4
+ARGP4
+ADDRGP4 $3261
+ARGP4
+ADDRLP4 480
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $3259
+LABELV $2617
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 484
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 484
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3262
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3262
+ADDRGP4 ScriptVars+1512
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+1508
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2719
+JUMPV
+LABELV $3259
+ADDRLP4 4
+ARGP4
+ADDRGP4 $255
+ARGP4
+ADDRLP4 484
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+NEI4 $3266
+LABELV $2619
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_FX_Model
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3266
+ADDRLP4 4
+ARGP4
+ADDRGP4 $256
+ARGP4
+ADDRLP4 488
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+NEI4 $3269
+LABELV $2621
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+508
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 492
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 492
+INDIRP4
+ASGNP4
+ADDRGP4 CG_FX_LoopSound
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3269
+ADDRLP4 4
+ARGP4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 492
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 492
+INDIRI4
+CNSTI4 0
+NEI4 $3273
+LABELV $2623
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 496
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 496
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3275
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3275
+ADDRGP4 ScriptVars+52
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3273
+ADDRLP4 4
+ARGP4
+ADDRGP4 $258
+ARGP4
+ADDRLP4 496
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 496
+INDIRI4
+CNSTI4 0
+NEI4 $3278
+LABELV $2625
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 500
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 500
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3280
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3280
+ADDRGP4 ScriptVars+56
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 CG_FX_Vibrate
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3278
+ADDRLP4 4
+ARGP4
+ADDRGP4 $3285
+ARGP4
+ADDRLP4 500
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+NEI4 $3283
+LABELV $2627
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 504
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 504
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3286
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3286
+ADDRGP4 ScriptVars+7840
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3283
+ADDRLP4 4
+ARGP4
+ADDRGP4 $260
+ARGP4
+ADDRLP4 504
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 504
+INDIRI4
+CNSTI4 0
+NEI4 $3289
+LABELV $2629
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 ScriptVars+1552
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+1556
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3295
+JUMPV
+LABELV $3294
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 508
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 508
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3297
+ADDRGP4 $3296
+JUMPV
+LABELV $3297
+ADDRLP4 4
+ARGP4
+ADDRGP4 $3301
+ARGP4
+ADDRLP4 512
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+NEI4 $3299
+ADDRGP4 ScriptVars+1552
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3300
+JUMPV
+LABELV $3299
+ADDRLP4 4
+ARGP4
+ADDRGP4 $156
+ARGP4
+ADDRLP4 516
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $3303
+ADDRGP4 ScriptVars+1556
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3304
+JUMPV
+LABELV $3303
+ADDRGP4 $2411
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3304
+LABELV $3300
+LABELV $3295
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $3294
+LABELV $3296
+ADDRGP4 CG_FX_Decal
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3289
+ADDRLP4 4
+ARGP4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 508
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+NEI4 $3306
+LABELV $2631
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+572
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 512
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 512
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_FX_Sound
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3306
+ADDRLP4 4
+ARGP4
+ADDRGP4 $262
+ARGP4
+ADDRLP4 512
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+NEI4 $3310
+LABELV $2633
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+572
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 516
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 516
+INDIRP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_FX_Sound
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3310
+ADDRLP4 4
+ARGP4
+ADDRGP4 $263
+ARGP4
+ADDRLP4 516
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $3314
+LABELV $2635
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+572
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 520
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 520
+INDIRP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_FX_Sound
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3314
+ADDRLP4 4
+ARGP4
+ADDRGP4 $264
+ARGP4
+ADDRLP4 520
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $3318
+LABELV $2637
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_FX_Model
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3318
+ADDRLP4 4
+ARGP4
+ADDRGP4 $265
+ARGP4
+ADDRLP4 524
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+NEI4 $3321
+LABELV $2639
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_FX_Model
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3321
+ADDRLP4 4
+ARGP4
+ADDRGP4 $266
+ARGP4
+ADDRLP4 528
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $3324
+LABELV $2641
+ADDRLP4 544
+CNSTI4 0
+ASGNI4
+ADDRLP4 536
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3326
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 548
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 548
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3328
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3328
+ADDRGP4 parsingEmitterScriptLevel
+INDIRI4
+CNSTI4 0
+NEI4 $3330
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+ADDRLP4 88
+INDIRF4
+MULF4
+LTF4 $3332
+ADDRLP4 536
+CNSTI4 1
+ASGNI4
+LABELV $3332
+ADDRLP4 536
+INDIRI4
+CNSTI4 0
+EQI4 $3336
+ADDRGP4 ScriptVars+7784
+INDIRF4
+CNSTF4 3212836864
+NEF4 $3336
+ADDRLP4 536
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+7772
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $3336
+ADDRLP4 536
+INDIRI4
+CNSTI4 0
+EQI4 $3343
+ADDRLP4 88
+INDIRF4
+CNSTF4 0
+LEF4 $3343
+ADDRLP4 88
+INDIRF4
+ADDRGP4 cg_fxScriptMinInterval+8
+INDIRF4
+GEF4 $3345
+ADDRLP4 88
+ADDRGP4 cg_fxScriptMinInterval+8
+INDIRF4
+ASGNF4
+LABELV $3345
+ADDRLP4 532
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 540
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+607152
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRGP4 cg+607148
+ADDRGP4 cg+607152
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 552
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3356
+JUMPV
+LABELV $3355
+ADDRGP4 ScriptVars+7772
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRLP4 556
+ADDRGP4 cg+607152
+ASGNP4
+ADDRLP4 556
+INDIRP4
+ADDRLP4 556
+INDIRP4
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+607148
+ADDRGP4 cg+607152
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 560
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 0
+EQI4 $3364
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3364
+ADDRGP4 ScriptVars+7784
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 552
+ADDRLP4 552
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 1000
+LEI4 $3368
+LABELV $3368
+LABELV $3356
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 532
+INDIRF4
+LTF4 $3355
+ADDRGP4 cg+607152
+ADDRLP4 532
+INDIRF4
+ASGNF4
+ADDRGP4 cg+607148
+ADDRLP4 540
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $3343
+LABELV $3330
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 552
+ADDRGP4 CG_SkipBlock
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 552
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2719
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3324
+ADDRLP4 4
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRLP4 532
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 532
+INDIRI4
+CNSTI4 0
+NEI4 $3374
+LABELV $2643
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 536
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 536
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3376
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3376
+ADDRGP4 ScriptVars+1496
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+1492
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2719
+JUMPV
+LABELV $3374
+ADDRLP4 4
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 536
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 536
+INDIRI4
+CNSTI4 0
+NEI4 $3380
+LABELV $2645
+ADDRGP4 ScriptVars+1480
+INDIRI4
+CNSTI4 64
+LTI4 $3382
+ADDRGP4 $3385
+ARGP4
+ADDRGP4 ScriptVars+1480
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3382
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 540
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 540
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $3389
+ARGP4
+ADDRLP4 544
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 544
+INDIRI4
+CNSTI4 0
+NEI4 $3387
+CNSTI4 12
+ADDRGP4 ScriptVars+1480
+INDIRI4
+MULI4
+ADDRGP4 ScriptVars+712
+ADDP4
+ADDRGP4 ScriptVars+332
+INDIRB
+ASGNB 12
+ADDRLP4 548
+ADDRGP4 ScriptVars+1480
+ASGNP4
+ADDRLP4 548
+INDIRP4
+ADDRLP4 548
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2719
+JUMPV
+LABELV $3387
+ADDRLP4 4
+ARGP4
+ADDRGP4 $3396
+ARGP4
+ADDRLP4 548
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+NEI4 $3394
+CNSTI4 12
+ADDRGP4 ScriptVars+1480
+INDIRI4
+MULI4
+ADDRGP4 ScriptVars+712
+ADDP4
+ADDRGP4 ScriptVars+344
+INDIRB
+ASGNB 12
+ADDRLP4 552
+ADDRGP4 ScriptVars+1480
+ASGNP4
+ADDRLP4 552
+INDIRP4
+ADDRLP4 552
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2719
+JUMPV
+LABELV $3394
+ADDRGP4 $3401
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3380
+ADDRLP4 4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 540
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 540
+INDIRI4
+CNSTI4 0
+NEI4 $3402
+LABELV $2647
+ADDRGP4 ScriptVars+1480
+INDIRI4
+CNSTI4 0
+GTI4 $3404
+ADDRGP4 $3407
+ARGP4
+ADDRGP4 ScriptVars+1480
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3404
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 544
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 544
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 548
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 548
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDRGP4 ScriptVars+1480
+INDIRI4
+MULI4
+ADDRGP4 ScriptVars+712-12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 552
+ADDRGP4 ScriptVars+1480
+ASGNP4
+ADDRLP4 552
+INDIRP4
+ADDRLP4 552
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2719
+JUMPV
+LABELV $3402
+ADDRLP4 4
+ARGP4
+ADDRGP4 $270
+ARGP4
+ADDRLP4 544
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 544
+INDIRI4
+CNSTI4 0
+NEI4 $3413
+LABELV $2649
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRLP4 556
+ADDRGP4 CG_NumIfBlocks
+CALLI4
+ASGNI4
+ADDRLP4 548
+ADDRLP4 556
+INDIRI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+GTI4 $3415
+ADDRGP4 $3417
+ARGP4
+ADDRLP4 548
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3415
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3421
+JUMPV
+LABELV $3418
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+LEI4 $3422
+ADDRGP4 $3425
+JUMPV
+LABELV $3424
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 560
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 560
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3427
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3427
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3426
+LABELV $3425
+ADDRGP4 $3424
+JUMPV
+LABELV $3426
+LABELV $3422
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+LEI4 $3431
+ADDRLP4 4
+ARGP4
+ADDRGP4 $271
+ARGP4
+ADDRLP4 560
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 0
+NEI4 $3433
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $3436
+JUMPV
+LABELV $3435
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 564
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 564
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3438
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3438
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3437
+LABELV $3436
+ADDRGP4 $3435
+JUMPV
+LABELV $3437
+ADDRLP4 4
+ARGP4
+ADDRGP4 $270
+ARGP4
+ADDRLP4 564
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 564
+INDIRI4
+CNSTI4 0
+NEI4 $3442
+ADDRFP4 0
+ADDRLP4 112
+INDIRP4
+ASGNP4
+ADDRGP4 $3434
+JUMPV
+LABELV $3442
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 568
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 568
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3444
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3444
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 572
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+CNSTI4 0
+EQI4 $3420
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3433
+ADDRLP4 4
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRLP4 564
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 564
+INDIRI4
+CNSTI4 0
+NEI4 $3448
+LABELV $3448
+LABELV $3434
+LABELV $3431
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3450
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3450
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 560
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3452
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3452
+ADDRLP4 88
+INDIRF4
+CNSTF4 0
+EQF4 $3454
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 564
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+ASGNI4
+ADDRLP4 564
+INDIRI4
+CNSTI4 0
+EQI4 $3420
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3454
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 564
+ADDRGP4 CG_SkipBlock
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 564
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3458
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3458
+LABELV $3419
+ADDRLP4 116
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3421
+ADDRLP4 116
+INDIRI4
+ADDRLP4 548
+INDIRI4
+LTI4 $3418
+LABELV $3420
+ADDRFP4 0
+ADDRLP4 552
+INDIRP4
+ASGNP4
+ADDRGP4 $2719
+JUMPV
+LABELV $3413
+ADDRLP4 4
+ARGP4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 548
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+NEI4 $3460
+LABELV $2651
+ADDRLP4 552
+ADDRGP4 ScriptVars+160
+INDIRF4
+ASGNF4
+ADDRLP4 556
+ADDRGP4 ScriptVars+164
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3464
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3464
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 560
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3466
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3466
+ADDRLP4 88
+INDIRF4
+CNSTF4 0
+EQF4 $3468
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3473
+JUMPV
+LABELV $3470
+ADDRGP4 ScriptVars+164
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRGP4 ScriptVars+160
+ADDRLP4 116
+INDIRI4
+CVIF4 4
+ADDRLP4 88
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 564
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+ASGNI4
+ADDRLP4 564
+INDIRI4
+CNSTI4 0
+EQI4 $3476
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3476
+LABELV $3471
+ADDRLP4 116
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3473
+ADDRLP4 116
+INDIRI4
+CVIF4 4
+ADDRLP4 88
+INDIRF4
+LTF4 $3470
+LABELV $3468
+ADDRGP4 ScriptVars+160
+ADDRLP4 552
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+164
+ADDRLP4 556
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 564
+ADDRGP4 CG_SkipBlock
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 564
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2719
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3460
+ADDRLP4 4
+ARGP4
+ADDRGP4 $274
+ARGP4
+ADDRLP4 552
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 0
+NEI4 $3482
+LABELV $2653
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 568
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 568
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 572
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 572
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 576
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 576
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 580
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 580
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 584
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 584
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 588
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 588
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 592
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 592
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3484
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3484
+ADDRLP4 556
+ADDRLP4 84
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 556
+ARGP4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3482
+ADDRLP4 4
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 556
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 0
+NEI4 $3486
+LABELV $2655
+ADDRGP4 $3488
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3486
+ADDRLP4 4
+ARGP4
+ADDRGP4 $276
+ARGP4
+ADDRLP4 560
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 0
+NEI4 $3489
+LABELV $2657
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 564
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 564
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3491
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3491
+ADDRGP4 ScriptVars+1504
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+1500
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2719
+JUMPV
+LABELV $3489
+ADDRLP4 4
+ARGP4
+ADDRGP4 $277
+ARGP4
+ADDRLP4 564
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 564
+INDIRI4
+CNSTI4 0
+NEI4 $3495
+LABELV $2659
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 568
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $3499
+JUMPV
+LABELV $3498
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 572
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 572
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3501
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3501
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3503
+ADDRGP4 $3499
+JUMPV
+LABELV $3503
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3505
+ADDRGP4 $3500
+JUMPV
+LABELV $3505
+ADDRLP4 568
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3500
+JUMPV
+LABELV $3499
+ADDRGP4 $3498
+JUMPV
+LABELV $3500
+ADDRLP4 568
+INDIRI4
+CNSTI4 0
+EQI4 $3507
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3508
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3507
+ADDRLP4 572
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 572
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+LABELV $3508
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 572
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 572
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3511
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3511
+ADDRGP4 ScriptVars+3608
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3515
+JUMPV
+LABELV $3514
+ADDRGP4 ScriptVars+3608
+INDIRI4
+CNSTI4 32
+LTI4 $3517
+ADDRGP4 $3520
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3516
+JUMPV
+LABELV $3517
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 576
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 576
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3521
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3521
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3523
+ADDRGP4 $3515
+JUMPV
+LABELV $3523
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $3525
+ADDRGP4 $3516
+JUMPV
+LABELV $3525
+ADDRGP4 ScriptVars+3608
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 ScriptVars+1560
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 580
+ADDRGP4 ScriptVars+3608
+ASGNP4
+ADDRLP4 580
+INDIRP4
+ADDRLP4 580
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3515
+ADDRGP4 $3514
+JUMPV
+LABELV $3516
+ADDRGP4 ScriptVars+3608
+INDIRI4
+CNSTI4 0
+GTI4 $3530
+ADDRGP4 $3533
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3530
+ADDRGP4 ScriptVars+3612
+ADDRLP4 88
+INDIRF4
+ADDRGP4 ScriptVars+3608
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 ScriptVars+3612
+INDIRI4
+ADDRGP4 ScriptVars+3608
+INDIRI4
+LTI4 $3536
+ADDRGP4 $3540
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3536
+ADDRGP4 ScriptVars+572
+ARGP4
+ADDRGP4 ScriptVars+3612
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 ScriptVars+1560
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_FX_Sound
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3495
+ADDRLP4 4
+ARGP4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 568
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 568
+INDIRI4
+CNSTI4 0
+NEI4 $3544
+LABELV $2661
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 572
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $3548
+JUMPV
+LABELV $3547
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 576
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 576
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3550
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3550
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3552
+ADDRGP4 $3548
+JUMPV
+LABELV $3552
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3554
+ADDRGP4 $3549
+JUMPV
+LABELV $3554
+ADDRLP4 572
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3549
+JUMPV
+LABELV $3548
+ADDRGP4 $3547
+JUMPV
+LABELV $3549
+ADDRLP4 572
+INDIRI4
+CNSTI4 0
+EQI4 $3556
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3557
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3556
+ADDRLP4 576
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 576
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+LABELV $3557
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 576
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 576
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3560
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3560
+ADDRGP4 ScriptVars+3608
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3564
+JUMPV
+LABELV $3563
+ADDRGP4 ScriptVars+3608
+INDIRI4
+CNSTI4 32
+LTI4 $3566
+ADDRGP4 $3520
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3565
+JUMPV
+LABELV $3566
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 580
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 580
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3569
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3569
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3571
+ADDRGP4 $3564
+JUMPV
+LABELV $3571
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $3573
+ADDRGP4 $3565
+JUMPV
+LABELV $3573
+ADDRGP4 ScriptVars+3608
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 ScriptVars+1560
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 584
+ADDRGP4 ScriptVars+3608
+ASGNP4
+ADDRLP4 584
+INDIRP4
+ADDRLP4 584
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3564
+ADDRGP4 $3563
+JUMPV
+LABELV $3565
+ADDRGP4 ScriptVars+3608
+INDIRI4
+CNSTI4 0
+GTI4 $3578
+ADDRGP4 $3533
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3578
+ADDRGP4 ScriptVars+3612
+ADDRLP4 88
+INDIRF4
+ADDRGP4 ScriptVars+3608
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 ScriptVars+3612
+INDIRI4
+ADDRGP4 ScriptVars+3608
+INDIRI4
+LTI4 $3583
+ADDRGP4 $3540
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3583
+ADDRGP4 ScriptVars+572
+ARGP4
+ADDRGP4 ScriptVars+3612
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 ScriptVars+1560
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_FX_Sound
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3544
+ADDRLP4 4
+ARGP4
+ADDRGP4 $279
+ARGP4
+ADDRLP4 572
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+CNSTI4 0
+NEI4 $3590
+LABELV $2663
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 576
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $3594
+JUMPV
+LABELV $3593
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 580
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 580
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3596
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3596
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3598
+ADDRGP4 $3594
+JUMPV
+LABELV $3598
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3600
+ADDRGP4 $3595
+JUMPV
+LABELV $3600
+ADDRLP4 576
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3595
+JUMPV
+LABELV $3594
+ADDRGP4 $3593
+JUMPV
+LABELV $3595
+ADDRLP4 576
+INDIRI4
+CNSTI4 0
+EQI4 $3602
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3603
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3602
+ADDRLP4 580
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 580
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+LABELV $3603
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 580
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 580
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3606
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3606
+ADDRGP4 ScriptVars+3608
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3610
+JUMPV
+LABELV $3609
+ADDRGP4 ScriptVars+3608
+INDIRI4
+CNSTI4 32
+LTI4 $3612
+ADDRGP4 $3520
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3611
+JUMPV
+LABELV $3612
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 584
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 584
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3615
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3615
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3617
+ADDRGP4 $3610
+JUMPV
+LABELV $3617
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $3619
+ADDRGP4 $3611
+JUMPV
+LABELV $3619
+ADDRGP4 ScriptVars+3608
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 ScriptVars+1560
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 588
+ADDRGP4 ScriptVars+3608
+ASGNP4
+ADDRLP4 588
+INDIRP4
+ADDRLP4 588
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3610
+ADDRGP4 $3609
+JUMPV
+LABELV $3611
+ADDRGP4 ScriptVars+3608
+INDIRI4
+CNSTI4 0
+GTI4 $3624
+ADDRGP4 $3533
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3624
+ADDRGP4 ScriptVars+3612
+ADDRLP4 88
+INDIRF4
+ADDRGP4 ScriptVars+3608
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 ScriptVars+3612
+INDIRI4
+ADDRGP4 ScriptVars+3608
+INDIRI4
+LTI4 $3629
+ADDRGP4 $3540
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3629
+ADDRGP4 ScriptVars+572
+ARGP4
+ADDRGP4 ScriptVars+3612
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 ScriptVars+1560
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_FX_Sound
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3590
+ADDRLP4 4
+ARGP4
+ADDRGP4 $280
+ARGP4
+ADDRLP4 576
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 576
+INDIRI4
+CNSTI4 0
+NEI4 $3636
+LABELV $2665
+ADDRGP4 ScriptVars+380
+CNSTI1 0
+ASGNI1
+ADDRGP4 $2719
+JUMPV
+LABELV $3636
+ADDRLP4 4
+ARGP4
+ADDRGP4 $281
+ARGP4
+ADDRLP4 580
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 580
+INDIRI4
+CNSTI4 0
+NEI4 $3639
+LABELV $2667
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 584
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 584
+INDIRP4
+ASGNP4
+ADDRGP4 ScriptVars+640
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2719
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2719
+ADDRLP4 4
+ARGP4
+ADDRLP4 588
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 ScriptVars+640
+INDIRP4
+CNSTI4 1488
+ADDP4
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRGP4 $2719
+JUMPV
+LABELV $3639
+ADDRLP4 4
+ARGP4
+ADDRGP4 $283
+ARGP4
+ADDRLP4 584
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 584
+INDIRI4
+CNSTI4 0
+NEI4 $3645
+LABELV $2669
+ADDRGP4 ScriptVars+640
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2719
+ADDRGP4 ScriptVars+640
+INDIRP4
+CNSTI4 1488
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2719
+JUMPV
+LABELV $3645
+ADDRLP4 4
+ARGP4
+ADDRGP4 $282
+ARGP4
+ADDRLP4 588
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 588
+INDIRI4
+CNSTI4 0
+NEI4 $3651
+LABELV $2671
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 596
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 596
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3653
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3653
+ADDRGP4 ScriptVars+640
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2719
+ADDRGP4 ScriptVars+640
+INDIRP4
+CNSTI4 1492
+ADDP4
+ADDRLP4 592
+INDIRF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3651
+ADDRLP4 4
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 592
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+CNSTI4 0
+NEI4 $3659
+LABELV $2673
+ADDRLP4 664
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 596
+ADDRGP4 ScriptVars+60
+INDIRF4
+ADDRLP4 664
+INDIRF4
+ADDRGP4 ScriptVars+96
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 596+4
+ADDRGP4 ScriptVars+60+4
+INDIRF4
+ADDRLP4 664
+INDIRF4
+ADDRGP4 ScriptVars+96+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 596+8
+ADDRGP4 ScriptVars+60+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 ScriptVars+96+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 608
+ARGP4
+ADDRGP4 ScriptVars+60
+ARGP4
+ADDRLP4 668
+CNSTP4 0
+ASGNP4
+ADDRLP4 668
+INDIRP4
+ARGP4
+ADDRLP4 668
+INDIRP4
+ARGP4
+ADDRLP4 596
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRLP4 608+12
+INDIRB
+ASGNB 12
+ADDRGP4 $2719
+JUMPV
+LABELV $3659
+ADDRLP4 4
+ARGP4
+ADDRGP4 $285
+ARGP4
+ADDRLP4 596
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 596
+INDIRI4
+CNSTI4 0
+NEI4 $3676
+LABELV $2675
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 ScriptVars+1552
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+1556
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3682
+JUMPV
+LABELV $3681
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 600
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 600
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3684
+ADDRGP4 $3683
+JUMPV
+LABELV $3684
+ADDRLP4 4
+ARGP4
+ADDRGP4 $3301
+ARGP4
+ADDRLP4 604
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+CNSTI4 0
+NEI4 $3686
+ADDRGP4 ScriptVars+1552
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3687
+JUMPV
+LABELV $3686
+ADDRLP4 4
+ARGP4
+ADDRGP4 $156
+ARGP4
+ADDRLP4 608
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 608
+INDIRI4
+CNSTI4 0
+NEI4 $3689
+ADDRGP4 ScriptVars+1556
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3690
+JUMPV
+LABELV $3689
+ADDRGP4 $2411
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3690
+LABELV $3687
+LABELV $3682
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $3681
+LABELV $3683
+ADDRGP4 CG_FX_DecalTemp
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3676
+ADDRLP4 4
+ARGP4
+ADDRGP4 $286
+ARGP4
+ADDRLP4 600
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 600
+INDIRI4
+CNSTI4 0
+NEI4 $3692
+LABELV $2677
+ADDRLP4 604
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $3695
+JUMPV
+LABELV $3694
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 608
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 608
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3697
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3697
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3699
+ADDRGP4 $3695
+JUMPV
+LABELV $3699
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3701
+ADDRGP4 $3696
+JUMPV
+LABELV $3701
+ADDRLP4 604
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3696
+JUMPV
+LABELV $3695
+ADDRGP4 $3694
+JUMPV
+LABELV $3696
+ADDRLP4 604
+INDIRI4
+CNSTI4 0
+EQI4 $3703
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3704
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3703
+ADDRLP4 608
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 608
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+LABELV $3704
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 608
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 608
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3707
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3707
+ADDRGP4 ScriptVars+5664
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3711
+JUMPV
+LABELV $3710
+ADDRGP4 ScriptVars+5664
+INDIRI4
+CNSTI4 32
+LTI4 $3713
+ADDRGP4 $3716
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3712
+JUMPV
+LABELV $3713
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 612
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 612
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3717
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3717
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3719
+ADDRGP4 $3711
+JUMPV
+LABELV $3719
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $3721
+ADDRGP4 $3712
+JUMPV
+LABELV $3721
+ADDRGP4 ScriptVars+5664
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 ScriptVars+3616
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 616
+ADDRGP4 ScriptVars+5664
+ASGNP4
+ADDRLP4 616
+INDIRP4
+ADDRLP4 616
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3711
+ADDRGP4 $3710
+JUMPV
+LABELV $3712
+ADDRGP4 ScriptVars+5664
+INDIRI4
+CNSTI4 0
+GTI4 $3726
+ADDRGP4 $3729
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3726
+ADDRGP4 ScriptVars+5668
+ADDRLP4 88
+INDIRF4
+ADDRGP4 ScriptVars+5664
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 ScriptVars+5668
+INDIRI4
+ADDRGP4 ScriptVars+5664
+INDIRI4
+LTI4 $3732
+ADDRGP4 $3736
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3732
+ADDRGP4 ScriptVars+444
+ARGP4
+ADDRGP4 ScriptVars+5668
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 ScriptVars+3616
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3692
+ADDRLP4 4
+ARGP4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 604
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+CNSTI4 0
+NEI4 $3740
+LABELV $2679
+ADDRLP4 608
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $3743
+JUMPV
+LABELV $3742
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 612
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 612
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3745
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3745
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3747
+ADDRGP4 $3743
+JUMPV
+LABELV $3747
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3749
+ADDRGP4 $3744
+JUMPV
+LABELV $3749
+ADDRLP4 608
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3744
+JUMPV
+LABELV $3743
+ADDRGP4 $3742
+JUMPV
+LABELV $3744
+ADDRLP4 608
+INDIRI4
+CNSTI4 0
+EQI4 $3751
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3752
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3751
+ADDRLP4 612
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 612
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+LABELV $3752
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 612
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 612
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3755
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3755
+ADDRGP4 ScriptVars+7720
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3759
+JUMPV
+LABELV $3758
+ADDRGP4 ScriptVars+7720
+INDIRI4
+CNSTI4 32
+LTI4 $3761
+ADDRGP4 $3764
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3760
+JUMPV
+LABELV $3761
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 616
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 616
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3765
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3765
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3767
+ADDRGP4 $3759
+JUMPV
+LABELV $3767
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $3769
+ADDRGP4 $3760
+JUMPV
+LABELV $3769
+ADDRGP4 ScriptVars+7720
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 ScriptVars+5672
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 620
+ADDRGP4 ScriptVars+7720
+ASGNP4
+ADDRLP4 620
+INDIRP4
+ADDRLP4 620
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3759
+ADDRGP4 $3758
+JUMPV
+LABELV $3760
+ADDRGP4 ScriptVars+7720
+INDIRI4
+CNSTI4 0
+GTI4 $3774
+ADDRGP4 $3777
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3774
+ADDRGP4 ScriptVars+7724
+ADDRLP4 88
+INDIRF4
+ADDRGP4 ScriptVars+7720
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 ScriptVars+7724
+INDIRI4
+ADDRGP4 ScriptVars+7720
+INDIRI4
+LTI4 $3780
+ADDRGP4 $3784
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3780
+ADDRGP4 ScriptVars+380
+ARGP4
+ADDRGP4 ScriptVars+7724
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 ScriptVars+5672
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3740
+ADDRLP4 4
+ARGP4
+ADDRGP4 $288
+ARGP4
+ADDRLP4 608
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 608
+INDIRI4
+CNSTI4 0
+NEI4 $3788
+LABELV $2681
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 612
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 612
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3790
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3790
+ADDRGP4 ScriptVars+108+4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3788
+ADDRLP4 4
+ARGP4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 612
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 612
+INDIRI4
+CNSTI4 0
+NEI4 $3794
+LABELV $2683
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 616
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 616
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3796
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3796
+ADDRGP4 ScriptVars+108
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3794
+ADDRLP4 4
+ARGP4
+ADDRGP4 $290
+ARGP4
+ADDRLP4 616
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+CNSTI4 0
+NEI4 $3799
+LABELV $2685
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 620
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 620
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3801
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3801
+ADDRGP4 ScriptVars+108+8
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 $2719
+JUMPV
+LABELV $3799
+ADDRLP4 4
+ARGP4
+ADDRGP4 $291
+ARGP4
+ADDRLP4 620
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+CNSTI4 0
+NEI4 $3805
+LABELV $2687
+ADDRLP4 624
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 632
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 632
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 624
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Q3mmeMathExt
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3807
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3807
+ADDRGP4 ScriptVars+7732
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 624
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 640
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 640
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 624
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Q3mmeMathExt
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3810
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3810
+ADDRGP4 ScriptVars+7736
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7728
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2719
+JUMPV
+LABELV $3805
+ADDRLP4 4
+ARGP4
+ADDRGP4 $292
+ARGP4
+ADDRLP4 624
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 0
+NEI4 $3814
+LABELV $2689
+ADDRLP4 628
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 636
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 636
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 628
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Q3mmeMathExt
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3816
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3816
+ADDRGP4 ScriptVars+7744
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 628
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 644
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 644
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 628
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Q3mmeMathExt
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3819
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3819
+ADDRGP4 ScriptVars+7748
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7740
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2719
+JUMPV
+LABELV $3814
+ADDRLP4 4
+ARGP4
+ADDRGP4 $293
+ARGP4
+ADDRLP4 628
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+CNSTI4 0
+NEI4 $3823
+LABELV $2691
+ADDRLP4 636
+CNSTI4 0
+ASGNI4
+ADDRLP4 632
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3825
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3825
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 CG_SkipOpeningBrace
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 640
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3827
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3827
+ADDRGP4 ScriptVars+7836
+INDIRI4
+CNSTI4 0
+EQI4 $3829
+ADDRGP4 ScriptVars+84
+ARGP4
+ADDRLP4 644
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 644
+INDIRF4
+ADDRLP4 88
+INDIRF4
+LEF4 $3829
+ADDRLP4 632
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3830
+JUMPV
+LABELV $3829
+ADDRGP4 ScriptVars+7836
+CNSTI4 0
+ASGNI4
+LABELV $3830
+ADDRLP4 632
+INDIRI4
+CNSTI4 0
+EQI4 $3834
+ADDRLP4 648
+ADDRGP4 ScriptVars+60
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+60
+ADDRGP4 ScriptVars+7812
+INDIRB
+ASGNB 12
+ADDRLP4 664
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRGP4 ScriptVars+7824
+INDIRB
+ASGNB 12
+ADDRLP4 676
+ADDRGP4 EmitterScript
+ASGNP4
+ADDRLP4 660
+ADDRLP4 676
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 676
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 680
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+ASGNI4
+ADDRLP4 680
+INDIRI4
+CNSTI4 0
+EQI4 $3842
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3842
+ADDRGP4 EmitterScript
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRGP4 ScriptVars+60
+ADDRLP4 648
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRLP4 664
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7836
+CNSTI4 0
+ASGNI4
+LABELV $3834
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 CG_SkipBlock
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 648
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2719
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3823
+ADDRLP4 4
+ARGP4
+ADDRGP4 $294
+ARGP4
+ADDRLP4 632
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 0
+NEI4 $3849
+LABELV $2693
+ADDRGP4 $3851
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3849
+ADDRLP4 4
+ARGP4
+ADDRGP4 $295
+ARGP4
+ADDRLP4 636
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+NEI4 $3852
+LABELV $2695
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 640
+ADDRGP4 CG_GetFxToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 640
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 644
+ADDRGP4 CG_GetScriptVector
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 644
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3852
+ADDRLP4 4
+ARGP4
+ADDRGP4 $296
+ARGP4
+ADDRLP4 640
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+NEI4 $3854
+LABELV $2697
+ADDRGP4 ScriptVars+7808
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 CG_FX_Rings
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3854
+ADDRLP4 4
+ARGP4
+ADDRGP4 $297
+ARGP4
+ADDRLP4 644
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+NEI4 $3857
+LABELV $2699
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 648
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 648
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $3859
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3859
+ADDRGP4 $3861
+ARGP4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3857
+ADDRLP4 4
+ARGP4
+ADDRGP4 $298
+ARGP4
+ADDRLP4 648
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+NEI4 $3862
+LABELV $2701
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3862
+ADDRLP4 4
+ARGP4
+ADDRGP4 $299
+ARGP4
+ADDRLP4 652
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 0
+NEI4 $3864
+LABELV $2703
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 656
+ADDRGP4 CG_SkipBlock
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 656
+INDIRP4
+ASGNP4
+ADDRGP4 $2719
+JUMPV
+LABELV $3864
+ADDRLP4 4
+ARGP4
+ADDRGP4 $300
+ARGP4
+ADDRLP4 656
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+NEI4 $3866
+LABELV $2705
+ADDRLP4 1756
+CNSTI4 0
+ASGNI4
+ADDRLP4 728
+ADDRLP4 1756
+INDIRI4
+ASGNI4
+ADDRLP4 732
+ARGP4
+ADDRLP4 1756
+INDIRI4
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_autoWriteConfig
+CALLV
+pop
+ADDRGP4 cg+5649548
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3870
+JUMPV
+LABELV $3869
+ADDRLP4 660
+ADDRFP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1760
+ADDRLP4 660
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1760
+INDIRI4
+CNSTI4 10
+EQI4 $3876
+ADDRLP4 1760
+INDIRI4
+CNSTI4 12
+EQI4 $3876
+ADDRLP4 1760
+INDIRI4
+CNSTI4 13
+EQI4 $3876
+ADDRLP4 1760
+INDIRI4
+CNSTI4 0
+NEI4 $3872
+LABELV $3876
+ADDRLP4 728
+INDIRI4
+CNSTI4 1022
+GEI4 $3877
+ADDRLP4 728
+INDIRI4
+ADDRLP4 732
+ADDP4
+CNSTI1 10
+ASGNI1
+ADDRLP4 728
+ADDRLP4 728
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 728
+INDIRI4
+ADDRLP4 732
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 732
+ARGP4
+ADDRGP4 trap_SendConsoleCommandNow
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3877
+ADDRGP4 $3879
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2719
+JUMPV
+LABELV $3872
+ADDRLP4 660
+INDIRI1
+CVII4 1
+CNSTI4 37
+NEI4 $3880
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 37
+NEI4 $3882
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $3883
+JUMPV
+LABELV $3882
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3885
+JUMPV
+LABELV $3884
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 660
+ADDRFP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1764
+ADDRLP4 660
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1764
+INDIRI4
+CNSTI4 48
+LTI4 $3889
+ADDRLP4 1764
+INDIRI4
+CNSTI4 122
+LEI4 $3887
+LABELV $3889
+ADDRLP4 116
+INDIRI4
+ADDRLP4 661
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 661
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_Q3mmeMathExt
+CALLP4
+pop
+ADDRGP4 $3886
+JUMPV
+LABELV $3887
+ADDRLP4 116
+INDIRI4
+ADDRLP4 661
+ADDP4
+ADDRLP4 660
+INDIRI1
+ASGNI1
+ADDRLP4 116
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3885
+ADDRGP4 $3884
+JUMPV
+LABELV $3886
+ADDRLP4 1764
+ADDRLP4 728
+INDIRI4
+ASGNI4
+ADDRLP4 1764
+INDIRI4
+ADDRLP4 732
+ADDP4
+ARGP4
+CNSTI4 1023
+ADDRLP4 1764
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 $3890
+ARGP4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 732
+ARGP4
+ADDRLP4 1768
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 728
+ADDRLP4 1768
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $3870
+JUMPV
+LABELV $3883
+LABELV $3880
+ADDRLP4 728
+INDIRI4
+ADDRLP4 732
+ADDP4
+ADDRLP4 660
+INDIRI1
+ASGNI1
+ADDRLP4 1764
+CNSTI4 1
+ASGNI4
+ADDRLP4 728
+ADDRLP4 728
+INDIRI4
+ADDRLP4 1764
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 1764
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $3870
+ADDRGP4 $3869
+JUMPV
+ADDRGP4 $2719
+JUMPV
+LABELV $3866
+ADDRLP4 4
+ARGP4
+ADDRGP4 $301
+ARGP4
+ADDRLP4 660
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+NEI4 $3891
+LABELV $2707
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScriptVars+636
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 664
+ADDRGP4 CG_Q3mmeMath
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 664
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2719
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3891
+ADDRLP4 664
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 664
+INDIRI4
+CNSTI4 0
+EQI4 $3896
+ADDRLP4 664
+INDIRI4
+CNSTI4 125
+EQI4 $3896
+ADDRGP4 $3898
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2412
+JUMPV
+LABELV $3896
+LABELV $3008
+LABELV $2712
+LABELV $2719
+LABELV $2414
+ADDRGP4 $2413
+JUMPV
+LABELV $2415
+CNSTI4 0
+RETI4
+LABELV $2412
+endproc CG_RunQ3mmeScript 1772 28
+proc CG_SetQ3mmeFXScript 32 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 EffectScripts+8308076
+INDIRI4
+CNSTI4 256
+LTI4 $3900
+ADDRGP4 $3903
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3899
+JUMPV
+LABELV $3900
+ADDRGP4 EffectScripts+8308076
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 EffectScripts+8290668
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 EffectScripts+8308076
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 EffectScripts+8307052
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 EffectScripts+8308076
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3912
+JUMPV
+LABELV $3911
+ADDRFP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3914
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 16
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $3920
+JUMPV
+LABELV $3914
+ADDRLP4 28
+ADDRFP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 10
+EQI4 $3918
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $3916
+LABELV $3918
+ADDRGP4 $3920
+JUMPV
+LABELV $3916
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $3912
+ADDRGP4 $3911
+JUMPV
+ADDRGP4 $3920
+JUMPV
+LABELV $3919
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $3922
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $3924
+ADDRGP4 $3899
+JUMPV
+LABELV $3924
+LABELV $3922
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_CleanString
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_LStrip
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_StripSlashComments
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 SC_Lowercase
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $3926
+ADDRGP4 $3920
+JUMPV
+LABELV $3926
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3928
+ADDRGP4 $3920
+JUMPV
+LABELV $3928
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $3930
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $3930
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $3933
+JUMPV
+LABELV $3932
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3935
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $3937
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $3937
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3936
+JUMPV
+LABELV $3935
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $3939
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $3940
+JUMPV
+LABELV $3939
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3941
+ADDRGP4 $3934
+JUMPV
+LABELV $3941
+LABELV $3940
+LABELV $3936
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3943
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $3945
+ADDRGP4 $3899
+JUMPV
+LABELV $3945
+LABELV $3943
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $3933
+ADDRGP4 $3932
+JUMPV
+LABELV $3934
+LABELV $3920
+ADDRGP4 $3919
+JUMPV
+LABELV $3899
+endproc CG_SetQ3mmeFXScript 32 12
+proc CG_ParseQ3mmeEffect 568 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $3949
+JUMPV
+ADDRGP4 $3950
+JUMPV
+LABELV $3949
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3953
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $3951
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+2949480
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $3951
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3958
+ARGP4
+ADDRLP4 88
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $3956
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3015016
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $3956
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3963
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $3961
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3047784
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $3961
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3968
+ARGP4
+ADDRLP4 96
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $3966
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3080552
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $3966
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3973
+ARGP4
+ADDRLP4 100
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $3971
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3113320
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $3971
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3978
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $3976
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3146088
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $3976
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3983
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $3981
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3178856
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $3981
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3988
+ARGP4
+ADDRLP4 112
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $3986
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3211624
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $3986
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3993
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $3991
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3244392
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $3991
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3998
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $3996
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3277160
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $3996
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4003
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $4001
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3309928
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4001
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4008
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $4006
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3342696
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4006
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4013
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $4011
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3375464
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4011
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4018
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $4016
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3408232
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4016
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4023
+ARGP4
+ADDRLP4 140
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $4021
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3441000
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4021
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4028
+ARGP4
+ADDRLP4 144
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $4026
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3473768
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4026
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4033
+ARGP4
+ADDRLP4 148
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $4031
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+2982248
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4031
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4038
+ARGP4
+ADDRLP4 152
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $4036
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3539304
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4036
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4043
+ARGP4
+ADDRLP4 156
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $4041
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3572072
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4041
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4048
+ARGP4
+ADDRLP4 160
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $4046
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3604840
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4046
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4053
+ARGP4
+ADDRLP4 164
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $4051
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3506536
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4051
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4058
+ARGP4
+ADDRLP4 168
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $4056
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3670376
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4056
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4063
+ARGP4
+ADDRLP4 172
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $4061
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3735912
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4061
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4068
+ARGP4
+ADDRLP4 176
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $4066
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3768680
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4066
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4073
+ARGP4
+ADDRLP4 180
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $4071
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3801448
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4071
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4078
+ARGP4
+ADDRLP4 184
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $4076
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3637608
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4076
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4083
+ARGP4
+ADDRLP4 188
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $4081
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3703144
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4081
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4088
+ARGP4
+ADDRLP4 192
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $4086
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3834216
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4086
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4093
+ARGP4
+ADDRLP4 196
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $4091
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3866984
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4091
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4098
+ARGP4
+ADDRLP4 200
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+NEI4 $4096
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3899752
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4096
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4103
+ARGP4
+ADDRLP4 204
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $4101
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3932520
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4101
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4108
+ARGP4
+ADDRLP4 208
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+NEI4 $4106
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3998056
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4106
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4113
+ARGP4
+ADDRLP4 212
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $4111
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+4030824
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $4112
+JUMPV
+LABELV $4111
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4118
+ARGP4
+ADDRLP4 216
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $4116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+3965288
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4123
+ARGP4
+ADDRLP4 220
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+NEI4 $4121
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+4063592
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4121
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4128
+ARGP4
+ADDRLP4 224
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $4126
+ADDRLP4 80
+ADDRGP4 EffectScripts+196632
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4126
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4132
+ARGP4
+ADDRLP4 228
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+NEI4 $4130
+ADDRLP4 80
+ADDRGP4 EffectScripts+196632
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4136
+ARGP4
+ADDRLP4 232
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+NEI4 $4134
+ADDRLP4 80
+ADDRGP4 EffectScripts+196632
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4134
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4140
+ARGP4
+ADDRLP4 236
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+NEI4 $4138
+ADDRLP4 80
+ADDRGP4 EffectScripts+196632
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4138
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4144
+ARGP4
+ADDRLP4 240
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $4142
+ADDRLP4 80
+ADDRGP4 EffectScripts+196632
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4142
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4148
+ARGP4
+ADDRLP4 244
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+NEI4 $4146
+ADDRLP4 80
+ADDRGP4 EffectScripts+196632
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4146
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4152
+ARGP4
+ADDRLP4 248
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $4150
+ADDRLP4 80
+ADDRGP4 EffectScripts+393264
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4150
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4156
+ARGP4
+ADDRLP4 252
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+NEI4 $4154
+ADDRLP4 80
+ADDRGP4 EffectScripts+393264
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4154
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4160
+ARGP4
+ADDRLP4 256
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $4158
+ADDRLP4 80
+ADDRGP4 EffectScripts+393264
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4158
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4164
+ARGP4
+ADDRLP4 260
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $4162
+ADDRLP4 80
+ADDRGP4 EffectScripts+393264
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4162
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4168
+ARGP4
+ADDRLP4 264
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $4166
+ADDRLP4 80
+ADDRGP4 EffectScripts+393264
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4166
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4172
+ARGP4
+ADDRLP4 268
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $4170
+ADDRLP4 80
+ADDRGP4 EffectScripts+393264
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4170
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4176
+ARGP4
+ADDRLP4 272
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $4174
+ADDRLP4 80
+ADDRGP4 EffectScripts+589896
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4174
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4180
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $4178
+ADDRLP4 80
+ADDRGP4 EffectScripts+589896
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4178
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4184
+ARGP4
+ADDRLP4 280
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $4182
+ADDRLP4 80
+ADDRGP4 EffectScripts+589896
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4182
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4188
+ARGP4
+ADDRLP4 284
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+NEI4 $4186
+ADDRLP4 80
+ADDRGP4 EffectScripts+589896
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4186
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4192
+ARGP4
+ADDRLP4 288
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $4190
+ADDRLP4 80
+ADDRGP4 EffectScripts+589896
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4190
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4196
+ARGP4
+ADDRLP4 292
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $4194
+ADDRLP4 80
+ADDRGP4 EffectScripts+589896
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4194
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4200
+ARGP4
+ADDRLP4 296
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $4198
+ADDRLP4 80
+ADDRGP4 EffectScripts+786528
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4198
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4204
+ARGP4
+ADDRLP4 300
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $4202
+ADDRLP4 80
+ADDRGP4 EffectScripts+786528
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4202
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4208
+ARGP4
+ADDRLP4 304
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+NEI4 $4206
+ADDRLP4 80
+ADDRGP4 EffectScripts+786528
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4206
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4212
+ARGP4
+ADDRLP4 308
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+NEI4 $4210
+ADDRLP4 80
+ADDRGP4 EffectScripts+786528
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4210
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4216
+ARGP4
+ADDRLP4 312
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+NEI4 $4214
+ADDRLP4 80
+ADDRGP4 EffectScripts+786528
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4214
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4220
+ARGP4
+ADDRLP4 316
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+NEI4 $4218
+ADDRLP4 80
+ADDRGP4 EffectScripts+786528
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4224
+ARGP4
+ADDRLP4 320
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+NEI4 $4222
+ADDRLP4 80
+ADDRGP4 EffectScripts+983160
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4222
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4228
+ARGP4
+ADDRLP4 324
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+NEI4 $4226
+ADDRLP4 80
+ADDRGP4 EffectScripts+983160
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4226
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4232
+ARGP4
+ADDRLP4 328
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+NEI4 $4230
+ADDRLP4 80
+ADDRGP4 EffectScripts+983160
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4230
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4236
+ARGP4
+ADDRLP4 332
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+NEI4 $4234
+ADDRLP4 80
+ADDRGP4 EffectScripts+983160
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4240
+ARGP4
+ADDRLP4 336
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+NEI4 $4238
+ADDRLP4 80
+ADDRGP4 EffectScripts+983160
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4238
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4244
+ARGP4
+ADDRLP4 340
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+NEI4 $4242
+ADDRLP4 80
+ADDRGP4 EffectScripts+983160
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4242
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4248
+ARGP4
+ADDRLP4 344
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+NEI4 $4246
+ADDRLP4 80
+ADDRGP4 EffectScripts+1179792
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4246
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4252
+ARGP4
+ADDRLP4 348
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+NEI4 $4250
+ADDRLP4 80
+ADDRGP4 EffectScripts+1179792
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4250
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4256
+ARGP4
+ADDRLP4 352
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+NEI4 $4254
+ADDRLP4 80
+ADDRGP4 EffectScripts+1179792
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4254
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4260
+ARGP4
+ADDRLP4 356
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+NEI4 $4258
+ADDRLP4 80
+ADDRGP4 EffectScripts+1179792
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4258
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4264
+ARGP4
+ADDRLP4 360
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+NEI4 $4262
+ADDRLP4 80
+ADDRGP4 EffectScripts+1179792
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4262
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4268
+ARGP4
+ADDRLP4 364
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+NEI4 $4266
+ADDRLP4 80
+ADDRGP4 EffectScripts+1179792
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4266
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4272
+ARGP4
+ADDRLP4 368
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+NEI4 $4270
+ADDRLP4 80
+ADDRGP4 EffectScripts+1376424
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4270
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4276
+ARGP4
+ADDRLP4 372
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+NEI4 $4274
+ADDRLP4 80
+ADDRGP4 EffectScripts+1376424
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4274
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4280
+ARGP4
+ADDRLP4 376
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 376
+INDIRI4
+CNSTI4 0
+NEI4 $4278
+ADDRLP4 80
+ADDRGP4 EffectScripts+1376424
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4278
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4284
+ARGP4
+ADDRLP4 380
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 380
+INDIRI4
+CNSTI4 0
+NEI4 $4282
+ADDRLP4 80
+ADDRGP4 EffectScripts+1376424
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4282
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4288
+ARGP4
+ADDRLP4 384
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 384
+INDIRI4
+CNSTI4 0
+NEI4 $4286
+ADDRLP4 80
+ADDRGP4 EffectScripts+1376424
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4286
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4292
+ARGP4
+ADDRLP4 388
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 0
+NEI4 $4290
+ADDRLP4 80
+ADDRGP4 EffectScripts+1376424
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4290
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4296
+ARGP4
+ADDRLP4 392
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+NEI4 $4294
+ADDRLP4 80
+ADDRGP4 EffectScripts+1573056
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4294
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4300
+ARGP4
+ADDRLP4 396
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+NEI4 $4298
+ADDRLP4 80
+ADDRGP4 EffectScripts+1573056
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4298
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4304
+ARGP4
+ADDRLP4 400
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+NEI4 $4302
+ADDRLP4 80
+ADDRGP4 EffectScripts+1573056
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4302
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4308
+ARGP4
+ADDRLP4 404
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 404
+INDIRI4
+CNSTI4 0
+NEI4 $4306
+ADDRLP4 80
+ADDRGP4 EffectScripts+1573056
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4306
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4312
+ARGP4
+ADDRLP4 408
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 408
+INDIRI4
+CNSTI4 0
+NEI4 $4310
+ADDRLP4 80
+ADDRGP4 EffectScripts+1573056
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4310
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4316
+ARGP4
+ADDRLP4 412
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+NEI4 $4314
+ADDRLP4 80
+ADDRGP4 EffectScripts+1573056
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4314
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4320
+ARGP4
+ADDRLP4 416
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+NEI4 $4318
+ADDRLP4 80
+ADDRGP4 EffectScripts+1769688
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4318
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4324
+ARGP4
+ADDRLP4 420
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 420
+INDIRI4
+CNSTI4 0
+NEI4 $4322
+ADDRLP4 80
+ADDRGP4 EffectScripts+1769688
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4322
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4328
+ARGP4
+ADDRLP4 424
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+CNSTI4 0
+NEI4 $4326
+ADDRLP4 80
+ADDRGP4 EffectScripts+1769688
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4332
+ARGP4
+ADDRLP4 428
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+NEI4 $4330
+ADDRLP4 80
+ADDRGP4 EffectScripts+1769688
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4330
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4336
+ARGP4
+ADDRLP4 432
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 432
+INDIRI4
+CNSTI4 0
+NEI4 $4334
+ADDRLP4 80
+ADDRGP4 EffectScripts+1769688
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4334
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4340
+ARGP4
+ADDRLP4 436
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+NEI4 $4338
+ADDRLP4 80
+ADDRGP4 EffectScripts+1769688
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4338
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4344
+ARGP4
+ADDRLP4 440
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 440
+INDIRI4
+CNSTI4 0
+NEI4 $4342
+ADDRLP4 80
+ADDRGP4 EffectScripts+2162952
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4342
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4348
+ARGP4
+ADDRLP4 444
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 444
+INDIRI4
+CNSTI4 0
+NEI4 $4346
+ADDRLP4 80
+ADDRGP4 EffectScripts+2162952
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4346
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4352
+ARGP4
+ADDRLP4 448
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 448
+INDIRI4
+CNSTI4 0
+NEI4 $4350
+ADDRLP4 80
+ADDRGP4 EffectScripts+2162952
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4350
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4356
+ARGP4
+ADDRLP4 452
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 0
+NEI4 $4354
+ADDRLP4 80
+ADDRGP4 EffectScripts+2162952
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4354
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4360
+ARGP4
+ADDRLP4 456
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+NEI4 $4358
+ADDRLP4 80
+ADDRGP4 EffectScripts+2162952
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4358
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4364
+ARGP4
+ADDRLP4 460
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 0
+NEI4 $4362
+ADDRLP4 80
+ADDRGP4 EffectScripts+2162952
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4362
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4368
+ARGP4
+ADDRLP4 464
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+CNSTI4 0
+NEI4 $4366
+ADDRLP4 80
+ADDRGP4 EffectScripts+2359584
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4366
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4372
+ARGP4
+ADDRLP4 468
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $4370
+ADDRLP4 80
+ADDRGP4 EffectScripts+2359584
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4370
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4376
+ARGP4
+ADDRLP4 472
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+NEI4 $4374
+ADDRLP4 80
+ADDRGP4 EffectScripts+2359584
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4374
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4380
+ARGP4
+ADDRLP4 476
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+NEI4 $4378
+ADDRLP4 80
+ADDRGP4 EffectScripts+2359584
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4378
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4384
+ARGP4
+ADDRLP4 480
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $4382
+ADDRLP4 80
+ADDRGP4 EffectScripts+2359584
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4382
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4388
+ARGP4
+ADDRLP4 484
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+NEI4 $4386
+ADDRLP4 80
+ADDRGP4 EffectScripts+2359584
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4386
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4392
+ARGP4
+ADDRLP4 488
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+NEI4 $4390
+ADDRLP4 80
+ADDRGP4 EffectScripts+2556216
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4390
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4396
+ARGP4
+ADDRLP4 492
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 492
+INDIRI4
+CNSTI4 0
+NEI4 $4394
+ADDRLP4 80
+ADDRGP4 EffectScripts+2556216
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4394
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4400
+ARGP4
+ADDRLP4 496
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 496
+INDIRI4
+CNSTI4 0
+NEI4 $4398
+ADDRLP4 80
+ADDRGP4 EffectScripts+2556216
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4398
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4404
+ARGP4
+ADDRLP4 500
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+NEI4 $4402
+ADDRLP4 80
+ADDRGP4 EffectScripts+2556216
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4402
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4408
+ARGP4
+ADDRLP4 504
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 504
+INDIRI4
+CNSTI4 0
+NEI4 $4406
+ADDRLP4 80
+ADDRGP4 EffectScripts+2556216
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4406
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4412
+ARGP4
+ADDRLP4 508
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+NEI4 $4410
+ADDRLP4 80
+ADDRGP4 EffectScripts+2556216
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4410
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4416
+ARGP4
+ADDRLP4 512
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+NEI4 $4414
+ADDRLP4 80
+ADDRGP4 EffectScripts+1966320
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4414
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4420
+ARGP4
+ADDRLP4 516
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $4418
+ADDRLP4 80
+ADDRGP4 EffectScripts+1966320
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4418
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4424
+ARGP4
+ADDRLP4 520
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $4422
+ADDRLP4 80
+ADDRGP4 EffectScripts+1966320
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4422
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4428
+ARGP4
+ADDRLP4 524
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+NEI4 $4426
+ADDRLP4 80
+ADDRGP4 EffectScripts+1966320
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4426
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4432
+ARGP4
+ADDRLP4 528
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $4430
+ADDRLP4 80
+ADDRGP4 EffectScripts+1966320
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4430
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4436
+ARGP4
+ADDRLP4 532
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 532
+INDIRI4
+CNSTI4 0
+NEI4 $4434
+ADDRLP4 80
+ADDRGP4 EffectScripts+1966320
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4434
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4440
+ARGP4
+ADDRLP4 536
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 536
+INDIRI4
+CNSTI4 0
+NEI4 $4438
+ADDRLP4 80
+ADDRGP4 EffectScripts+2752848
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4438
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4444
+ARGP4
+ADDRLP4 540
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 540
+INDIRI4
+CNSTI4 0
+NEI4 $4442
+ADDRLP4 80
+ADDRGP4 EffectScripts+2752848
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32792
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4442
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4448
+ARGP4
+ADDRLP4 544
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 544
+INDIRI4
+CNSTI4 0
+NEI4 $4446
+ADDRLP4 80
+ADDRGP4 EffectScripts+2752848
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65560
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4446
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4452
+ARGP4
+ADDRLP4 548
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+NEI4 $4450
+ADDRLP4 80
+ADDRGP4 EffectScripts+2752848
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 98328
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4450
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4456
+ARGP4
+ADDRLP4 552
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 0
+NEI4 $4454
+ADDRLP4 80
+ADDRGP4 EffectScripts+2752848
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 131096
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4454
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4460
+ARGP4
+ADDRLP4 556
+ADDRGP4 Q_stricmpt
+CALLI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 0
+NEI4 $4458
+ADDRLP4 80
+ADDRGP4 EffectScripts+2752848
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 163864
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $3948
+JUMPV
+LABELV $4458
+ADDRGP4 EffectScripts+8290664
+INDIRI4
+CNSTI4 128
+GEI4 $4462
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 EffectScripts+8290664
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 EffectScripts+4096360
+ADDP4
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetQ3mmeFXScript
+CALLV
+pop
+ADDRGP4 $4467
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 560
+ADDRGP4 EffectScripts+8290664
+ASGNP4
+ADDRLP4 560
+INDIRP4
+ADDRLP4 560
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3948
+JUMPV
+LABELV $4462
+ADDRGP4 $4469
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4112
+LABELV $3950
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4471
+JUMPV
+LABELV $4470
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 560
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 560
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $4473
+ADDRGP4 $3948
+JUMPV
+LABELV $4473
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 CG_CleanString
+CALLV
+pop
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_LStrip
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 CG_StripSlashComments
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 SC_Lowercase
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $4478
+ADDRGP4 $4471
+JUMPV
+LABELV $4477
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 564
+ADDRGP4 CG_GetToken
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 564
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4480
+ADDRGP4 $4479
+JUMPV
+LABELV $4480
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $4482
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4478
+JUMPV
+LABELV $4482
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $4484
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $4484
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $4486
+ADDRGP4 $3948
+JUMPV
+LABELV $4486
+LABELV $4478
+ADDRGP4 $4477
+JUMPV
+LABELV $4479
+LABELV $4471
+ADDRGP4 $4470
+JUMPV
+LABELV $3948
+endproc CG_ParseQ3mmeEffect 568 20
+proc CG_ParseQ3mmeScripts 88 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4490
+ADDRGP4 $4489
+JUMPV
+LABELV $4490
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4492
+ADDRGP4 $4489
+JUMPV
+LABELV $4492
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $4498
+ADDRGP4 $4496
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4489
+JUMPV
+LABELV $4497
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $4500
+ADDRGP4 $4499
+JUMPV
+LABELV $4500
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CleanString
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_LStrip
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_StripSlashComments
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SC_Lowercase
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $4502
+ADDRGP4 $4498
+JUMPV
+LABELV $4502
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_GetToken
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4504
+ADDRGP4 $4498
+JUMPV
+LABELV $4504
+ADDRGP4 $4506
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParseQ3mmeEffect
+CALLV
+pop
+LABELV $4498
+ADDRGP4 $4497
+JUMPV
+LABELV $4499
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $4489
+endproc CG_ParseQ3mmeScripts 88 16
+proc CG_ResetFXScripting 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 parsingEmitterScriptLevel
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 EmitterScript
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 PlainScript
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 ScriptJustParsing
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 DistanceScript
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 EmittedEntities
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $4507
+endproc CG_ResetFXScripting 4 0
+export CG_ResetFXIntervalAndDistance
+proc CG_ResetFXIntervalAndDistance 56 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $4508
+endproc CG_ResetFXIntervalAndDistance 56 0
+export CG_ReloadQ3mmeScripts
+proc CG_ReloadQ3mmeScripts 8 12
+CNSTI4 1
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 CG_RemoveFXLocalEntities
+CALLV
+pop
+ADDRGP4 CG_FreeFxJitTokens
+CALLV
+pop
+ADDRGP4 EffectScripts
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 25086976
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 CG_ResetFXScripting
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ParseQ3mmeScripts
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4525
+ADDRLP4 4
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4529
+ADDRGP4 $4526
+JUMPV
+LABELV $4529
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_ResetFXIntervalAndDistance
+CALLV
+pop
+LABELV $4526
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $4525
+LABELV $4524
+endproc CG_ReloadQ3mmeScripts 8 12
+export CG_ResetScriptVars
+proc CG_ResetScriptVars 4 12
+ADDRGP4 ScriptVars
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 7844
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 ScriptVars+316
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+316+4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+316+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+316+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 CG_ResetFXScripting
+CALLV
+pop
+LABELV $4531
+endproc CG_ResetScriptVars 4 12
+export CG_CopyPlayerDataToScriptData
+proc CG_CopyPlayerDataToScriptData 28 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4543
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $4541
+LABELV $4543
+ADDRGP4 $4544
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1496
+DIVI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4541
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRGP4 ScriptVars+60
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+108
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 ScriptVars+356
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 ScriptVars+360
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRGP4 ScriptVars+364
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRGP4 ScriptVars+368
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $4559
+ADDRGP4 cg+607188
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $4555
+LABELV $4559
+ADDRGP4 ScriptVars+372
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4556
+JUMPV
+LABELV $4555
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRGP4 ScriptVars+372
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $4556
+ADDRGP4 ScriptVars+332
+ADDRLP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+344
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $4564
+ADDRGP4 ScriptVars+640
+ADDRGP4 cg+607704
+ASGNP4
+ADDRGP4 $4565
+JUMPV
+LABELV $4564
+ADDRGP4 ScriptVars+640
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $4565
+LABELV $4540
+endproc CG_CopyPlayerDataToScriptData 28 16
+export CG_CopyPositionDataToCent
+proc CG_CopyPositionDataToCent 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+LABELV $4570
+endproc CG_CopyPositionDataToCent 0 0
+export CG_CopyPositionDataToScript
+proc CG_CopyPositionDataToScript 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 ScriptVars+7772
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7788
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $4575
+endproc CG_CopyPositionDataToScript 0 0
+export CG_UpdatePositionData
+proc CG_UpdatePositionData 0 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $4580
+endproc CG_UpdatePositionData 0 0
+import round
+import powf
+import acos
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_AddRealLoopingSound
+import CG_AddLoopingSound
+import CG_StartLocalSound
+import CG_StartSound
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_FrameArenaInfo_f
+import CG_ResetFrameArena
+import CG_FrameArenaRelease
+import CG_FrameArenaMark
+import CG_FrameAlloc
+import CG_FreeMem
+import CG_CallocMem
+import CG_MallocMem
+import CG_NewParticleArea
+import CG_ParticleExplosion
+import CG_AddParticles
+import CG_ClearParticles
+import CG_AddMarks
+import CG_ImpactMark
+import CG_InitMarkPolys
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_ShutdownLocalEnts
+import CG_RunFxAll
+import CG_SmokePuff_ql
+import CG_AddRefEntityFX
+import CG_AddRefEntity
+import CG_ListLocalEntities
+import CG_RemoveFXLocalEntities
+import CG_ClearLocalFrameEntities
+import CG_CullGrid
+import CG_AddToCullGrid
+import CG_BeginCullGrid
+import CG_AddLocalEntities
+import CG_MakeLowPriorityEntity
+import CG_AllocLocalEntityRealTime
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import FxLoopSounds
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+bss
+export EffectScripts
+align 4
+LABELV EffectScripts
+skip 25086976
+import EmitterScriptVars
+export ScriptVars
+align 4
+LABELV ScriptVars
+skip 7844
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $4544
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 111
+byte 1 112
+byte 1 121
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 68
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 84
+byte 1 111
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 68
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 112
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4506
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $4496
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $4469
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 70
+byte 1 88
+byte 1 95
+byte 1 69
+byte 1 88
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $4467
+byte 1 94
+byte 1 54
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $4460
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4456
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4452
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4448
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4444
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4440
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4436
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4432
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4428
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4424
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4420
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4416
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4412
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4408
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4404
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4400
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4396
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4392
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4388
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4384
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4380
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4376
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4372
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4368
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4364
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4360
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4356
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4352
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4348
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4344
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4340
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4336
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4332
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4328
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4324
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4320
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4316
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4312
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4308
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4304
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4300
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4296
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4292
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4288
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4284
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4280
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4276
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4272
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4268
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4264
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4260
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4256
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4252
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4248
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4244
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4240
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4236
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4232
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4228
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4224
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4220
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4216
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4212
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4208
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4204
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4200
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4196
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4192
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4188
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4184
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4180
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4176
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4172
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4168
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4164
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4160
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4156
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4152
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4148
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4144
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4140
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4136
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4132
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4128
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4123
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 70
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $4118
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4113
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $4108
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 98
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $4103
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $4098
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $4093
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $4088
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 0
+align 1
+LABELV $4083
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $4078
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $4073
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4068
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4063
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $4058
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $4053
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $4048
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4043
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $4038
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $4033
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $4028
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 71
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $4023
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4018
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $4013
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 0
+align 1
+LABELV $4008
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $4003
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 82
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $3998
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3993
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 82
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $3988
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 77
+byte 1 105
+byte 1 100
+byte 1 65
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $3983
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $3978
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $3973
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 0
+align 1
+LABELV $3968
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $3963
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3958
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $3953
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 0
+align 1
+LABELV $3903
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 81
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 70
+byte 1 88
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 70
+byte 1 88
+byte 1 10
+byte 1 0
+align 1
+LABELV $3898
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 73
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3890
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $3879
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 39
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3861
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3851
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 81
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $3784
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $3777
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 61
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $3764
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 70
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $3736
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $3729
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 61
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $3716
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 70
+byte 1 88
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $3540
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $3533
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 61
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $3520
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 70
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $3488
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 81
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $3417
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 39
+byte 1 105
+byte 1 102
+byte 1 39
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3407
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 44
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 99
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3401
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3396
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $3389
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $3385
+byte 1 118
+byte 1 101
+byte 1 99
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 82
+byte 1 73
+byte 1 80
+byte 1 84
+byte 1 69
+byte 1 68
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 95
+byte 1 86
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 10
+byte 1 0
+align 1
+LABELV $3301
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 0
+align 1
+LABELV $3285
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 100
+byte 1 0
+align 1
+LABELV $3261
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3255
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $3248
+byte 1 97
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2718
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $2708
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 81
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $2426
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $2423
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 120
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $2418
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 81
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $2411
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $2407
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $2403
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 104
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $2399
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $2395
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $2391
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2387
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $2383
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2379
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2360
+byte 1 94
+byte 1 51
+byte 1 102
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2129
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 88
+byte 1 95
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2005
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1869
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 73
+byte 1 102
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1866
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 73
+byte 1 102
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1850
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 73
+byte 1 102
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 105
+byte 1 102
+byte 1 39
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $1847
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 73
+byte 1 102
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1837
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1831
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1825
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 66
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1817
+byte 1 94
+byte 1 51
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1733
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 86
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1684
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 40
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 79
+byte 1 112
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1680
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1508
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $1488
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1453
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1439
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1434
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1428
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1427
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 47
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1426
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1412
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $1357
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $794
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 81
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $477
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 81
+byte 1 51
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $452
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 91
+byte 1 48
+byte 1 93
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $432
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 98
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 106
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 120
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $408
+byte 1 94
+byte 1 49
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 106
+byte 1 105
+byte 1 116
+byte 1 70
+byte 1 120
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $392
+byte 1 0
+align 1
+LABELV $391
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $387
+byte 1 94
+byte 1 37
+byte 1 99
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 70
+byte 1 120
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $373
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 70
+byte 1 120
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $365
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $364
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $363
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $362
+byte 1 97
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $361
+byte 1 97
+byte 1 99
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $360
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $359
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $358
+byte 1 99
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $357
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $356
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $355
+byte 1 99
+byte 1 101
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $354
+byte 1 115
+byte 1 113
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $353
+byte 1 124
+byte 1 0
+align 1
+LABELV $352
+byte 1 38
+byte 1 0
+align 1
+LABELV $351
+byte 1 61
+byte 1 0
+align 1
+LABELV $350
+byte 1 33
+byte 1 0
+align 1
+LABELV $349
+byte 1 62
+byte 1 0
+align 1
+LABELV $348
+byte 1 60
+byte 1 0
+align 1
+LABELV $347
+byte 1 37
+byte 1 0
+align 1
+LABELV $346
+byte 1 43
+byte 1 0
+align 1
+LABELV $345
+byte 1 45
+byte 1 0
+align 1
+LABELV $344
+byte 1 47
+byte 1 0
+align 1
+LABELV $343
+byte 1 42
+byte 1 0
+align 1
+LABELV $342
+byte 1 105
+byte 1 110
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $341
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $340
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $339
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $338
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $337
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $336
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $335
+byte 1 108
+byte 1 105
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $334
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $333
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $332
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $331
+byte 1 112
+byte 1 105
+byte 1 0
+align 1
+LABELV $330
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $329
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $328
+byte 1 99
+byte 1 103
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $327
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $326
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $325
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $324
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 48
+byte 1 0
+align 1
+LABELV $323
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $322
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 105
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $321
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 105
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $320
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 105
+byte 1 114
+byte 1 48
+byte 1 0
+align 1
+LABELV $319
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $318
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $317
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $316
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $315
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $314
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $313
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $312
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $311
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $310
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $309
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 50
+byte 1 0
+align 1
+LABELV $308
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 49
+byte 1 0
+align 1
+LABELV $307
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 48
+byte 1 0
+align 1
+LABELV $306
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $305
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $304
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $303
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $302
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $301
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $300
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $299
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $298
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $297
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 0
+align 1
+LABELV $296
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $295
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $294
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $293
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $292
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 0
+align 1
+LABELV $291
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $290
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $289
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $288
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $287
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $286
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $285
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $284
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $283
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $282
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $281
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $280
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $279
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $278
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $277
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $276
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $275
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $274
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $273
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $272
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 102
+byte 1 0
+align 1
+LABELV $271
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $270
+byte 1 105
+byte 1 102
+byte 1 0
+align 1
+LABELV $269
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $268
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $267
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $266
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $265
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $264
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $263
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $262
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $261
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $260
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $259
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $258
+byte 1 118
+byte 1 105
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $257
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $256
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $255
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $254
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $253
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $252
+byte 1 97
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $251
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 0
+align 1
+LABELV $250
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $249
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $248
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $247
+byte 1 98
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $246
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $245
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $244
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $243
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $242
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $241
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $240
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $239
+byte 1 119
+byte 1 111
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $238
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $237
+byte 1 99
+byte 1 111
+byte 1 112
+byte 1 121
+byte 1 0
+align 1
+LABELV $236
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $235
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 0
+align 1
+LABELV $234
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $233
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 0
+align 1
+LABELV $232
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $231
+byte 1 118
+byte 1 57
+byte 1 50
+byte 1 0
+align 1
+LABELV $230
+byte 1 118
+byte 1 57
+byte 1 49
+byte 1 0
+align 1
+LABELV $229
+byte 1 118
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $228
+byte 1 118
+byte 1 57
+byte 1 0
+align 1
+LABELV $227
+byte 1 118
+byte 1 56
+byte 1 50
+byte 1 0
+align 1
+LABELV $226
+byte 1 118
+byte 1 56
+byte 1 49
+byte 1 0
+align 1
+LABELV $225
+byte 1 118
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $224
+byte 1 118
+byte 1 56
+byte 1 0
+align 1
+LABELV $223
+byte 1 118
+byte 1 55
+byte 1 50
+byte 1 0
+align 1
+LABELV $222
+byte 1 118
+byte 1 55
+byte 1 49
+byte 1 0
+align 1
+LABELV $221
+byte 1 118
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $220
+byte 1 118
+byte 1 55
+byte 1 0
+align 1
+LABELV $219
+byte 1 118
+byte 1 54
+byte 1 50
+byte 1 0
+align 1
+LABELV $218
+byte 1 118
+byte 1 54
+byte 1 49
+byte 1 0
+align 1
+LABELV $217
+byte 1 118
+byte 1 54
+byte 1 48
+byte 1 0
+align 1
+LABELV $216
+byte 1 118
+byte 1 54
+byte 1 0
+align 1
+LABELV $215
+byte 1 118
+byte 1 53
+byte 1 50
+byte 1 0
+align 1
+LABELV $214
+byte 1 118
+byte 1 53
+byte 1 49
+byte 1 0
+align 1
+LABELV $213
+byte 1 118
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $212
+byte 1 118
+byte 1 53
+byte 1 0
+align 1
+LABELV $211
+byte 1 118
+byte 1 52
+byte 1 50
+byte 1 0
+align 1
+LABELV $210
+byte 1 118
+byte 1 52
+byte 1 49
+byte 1 0
+align 1
+LABELV $209
+byte 1 118
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $208
+byte 1 118
+byte 1 52
+byte 1 0
+align 1
+LABELV $207
+byte 1 118
+byte 1 51
+byte 1 50
+byte 1 0
+align 1
+LABELV $206
+byte 1 118
+byte 1 51
+byte 1 49
+byte 1 0
+align 1
+LABELV $205
+byte 1 118
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $204
+byte 1 118
+byte 1 51
+byte 1 0
+align 1
+LABELV $203
+byte 1 118
+byte 1 50
+byte 1 50
+byte 1 0
+align 1
+LABELV $202
+byte 1 118
+byte 1 50
+byte 1 49
+byte 1 0
+align 1
+LABELV $201
+byte 1 118
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $200
+byte 1 118
+byte 1 50
+byte 1 0
+align 1
+LABELV $199
+byte 1 118
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $198
+byte 1 118
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $197
+byte 1 118
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $196
+byte 1 118
+byte 1 49
+byte 1 0
+align 1
+LABELV $195
+byte 1 118
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $194
+byte 1 118
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $193
+byte 1 118
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $192
+byte 1 118
+byte 1 48
+byte 1 0
+align 1
+LABELV $191
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $190
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $189
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $188
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $187
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $186
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $185
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 48
+byte 1 0
+align 1
+LABELV $184
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $183
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $182
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $181
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 48
+byte 1 0
+align 1
+LABELV $180
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $179
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $178
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $177
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $176
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $175
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 50
+byte 1 0
+align 1
+LABELV $174
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 49
+byte 1 0
+align 1
+LABELV $173
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 48
+byte 1 0
+align 1
+LABELV $172
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $171
+byte 1 116
+byte 1 57
+byte 1 0
+align 1
+LABELV $170
+byte 1 116
+byte 1 56
+byte 1 0
+align 1
+LABELV $169
+byte 1 116
+byte 1 55
+byte 1 0
+align 1
+LABELV $168
+byte 1 116
+byte 1 54
+byte 1 0
+align 1
+LABELV $167
+byte 1 116
+byte 1 53
+byte 1 0
+align 1
+LABELV $166
+byte 1 116
+byte 1 52
+byte 1 0
+align 1
+LABELV $165
+byte 1 116
+byte 1 51
+byte 1 0
+align 1
+LABELV $164
+byte 1 116
+byte 1 50
+byte 1 0
+align 1
+LABELV $163
+byte 1 116
+byte 1 49
+byte 1 0
+align 1
+LABELV $162
+byte 1 116
+byte 1 48
+byte 1 0
+align 1
+LABELV $161
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $160
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $159
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $158
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $157
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $156
+byte 1 97
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $155
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $154
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $153
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $152
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
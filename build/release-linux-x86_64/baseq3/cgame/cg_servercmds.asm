@@ -0,0 +1,37674 @@
+code
+proc CG_RoundStart 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $158
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+2384
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $159
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $158
+ADDRGP4 $163
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $157
+endproc CG_RoundStart 4 4
+proc CG_RoundEnd 0 4
+ADDRGP4 $165
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $164
+endproc CG_RoundEnd 0 4
+proc CG_ParseScores 268 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+3848200
+INDIRI4
+CNSTI4 500
+ADDI4
+LEI4 $167
+ADDRGP4 cg+3848204
+CNSTI4 0
+ASGNI4
+LABELV $167
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+3856416+4
+INDIRI4
+CNSTI4 500
+ADDI4
+LEI4 $172
+ADDRGP4 cg+3856416
+INDIRI4
+CNSTI4 0
+EQI4 $177
+ADDRGP4 cg+3856416
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5504
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $177
+ADDRGP4 cg+3856416
+CNSTI4 0
+ASGNI4
+LABELV $172
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+3865760+4
+INDIRI4
+CNSTI4 500
+ADDI4
+LEI4 $183
+ADDRGP4 cg+3865760
+INDIRI4
+CNSTI4 0
+EQI4 $188
+ADDRGP4 cg+3865760
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5272
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $188
+ADDRGP4 cg+3865760
+CNSTI4 0
+ASGNI4
+LABELV $183
+ADDRGP4 cg+610848
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610844
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 cg+610844
+INDIRI4
+CNSTI4 64
+LEI4 $196
+ADDRGP4 $199
+ARGP4
+ADDRGP4 cg+610844
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+610844
+CNSTI4 64
+ASGNI4
+LABELV $196
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $202
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+616764
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $203
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $202
+CNSTI4 2
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860+4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $214
+ADDRLP4 4
+CNSTI4 18
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 4
+CNSTI4 14
+ASGNI4
+LABELV $215
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $220
+JUMPV
+LABELV $217
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+LTI4 $224
+ADDRLP4 48
+INDIRI4
+CNSTI4 64
+LTI4 $222
+LABELV $224
+ADDRGP4 $225
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $222
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 6
+ADDI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+20
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 9
+ADDI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+24
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 10
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+28
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 11
+ADDI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+32
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 12
+ADDI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+36
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 13
+ADDI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+40
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 14
+ADDI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+44
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+48
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+56
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 17
+ADDI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+52
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $253
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 18
+ADDI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+64
+ADDP4
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 19
+ADDI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+68
+ADDP4
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 20
+ADDI4
+ARGI4
+ADDRLP4 248
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+72
+ADDP4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 21
+ADDI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+76
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+LABELV $253
+ADDRLP4 220
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $268
+ADDRLP4 220
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $264
+LABELV $268
+ADDRGP4 $269
+ARGP4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $264
+ADDRLP4 224
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 224
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+ADDRLP4 224
+INDIRI4
+ADDRGP4 cg+610876+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 228
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 228
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+268
+ADDP4
+ADDRLP4 228
+INDIRI4
+ADDRGP4 cg+610876+24
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 4524
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 4524
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4504
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+616764
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 236
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+ADDRGP4 cg+610876+60
+ADDP4
+CNSTI4 4524
+ADDRLP4 236
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $295
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $301
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $301
+LABELV $296
+LABELV $218
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $220
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $217
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $307
+ADDRGP4 cg+610868
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $308
+JUMPV
+LABELV $307
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+LABELV $308
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRGP4 cg+610872
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $312
+JUMPV
+LABELV $311
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+LABELV $312
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_SetScoreSelection
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $315
+ADDRGP4 CG_SetDuelPlayers
+CALLV
+pop
+LABELV $315
+ADDRLP4 48
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+EQI4 $318
+ADDRLP4 52
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $318
+LABELV $166
+endproc CG_ParseScores 268 12
+proc CG_ParseRRScores 284 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610848
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610844
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 cg+610844
+INDIRI4
+CNSTI4 64
+LEI4 $324
+ADDRGP4 $327
+ARGP4
+ADDRGP4 cg+610844
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+610844
+CNSTI4 64
+ASGNI4
+LABELV $324
+CNSTI4 2
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860+4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $335
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+616764
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $336
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $335
+ADDRLP4 4
+CNSTI4 19
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $345
+JUMPV
+LABELV $342
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+LTI4 $349
+ADDRLP4 48
+INDIRI4
+CNSTI4 64
+LTI4 $347
+LABELV $349
+ADDRGP4 $350
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $347
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 9
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+20
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 10
+ADDI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+24
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 11
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+28
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 12
+ADDI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+32
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 13
+ADDI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+36
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 14
+ADDI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+40
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+44
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+48
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 17
+ADDI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+56
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 18
+ADDI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+52
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 19
+ADDI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+64
+ADDP4
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 20
+ADDI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+68
+ADDP4
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 21
+ADDI4
+ARGI4
+ADDRLP4 248
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+72
+ADDP4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 22
+ADDI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+76
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 268
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $390
+ADDRLP4 268
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $386
+LABELV $390
+ADDRGP4 $269
+ARGP4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $386
+ADDRLP4 272
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 272
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+ADDRLP4 272
+INDIRI4
+ADDRGP4 cg+610876+4
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 4524
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4504
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+616764
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 276
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 276
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+268
+ADDP4
+ADDRLP4 276
+INDIRI4
+ADDRGP4 cg+610876+24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+ADDRGP4 cg+610876+60
+ADDP4
+CNSTI4 4524
+ADDRLP4 280
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $413
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $414
+JUMPV
+LABELV $413
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $419
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $419
+LABELV $414
+LABELV $343
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $345
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $342
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $425
+ADDRGP4 cg+610868
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $426
+JUMPV
+LABELV $425
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+LABELV $426
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $429
+ADDRGP4 cg+610872
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $430
+JUMPV
+LABELV $429
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+LABELV $430
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_SetScoreSelection
+CALLV
+pop
+ADDRLP4 48
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+EQI4 $433
+ADDRLP4 52
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $435
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $433
+LABELV $321
+endproc CG_ParseRRScores 284 12
+proc CG_ParseCaScores 60 12
+ADDRGP4 cg+3856416
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $439
+JUMPV
+LABELV $438
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $441
+ADDRGP4 $440
+JUMPV
+LABELV $441
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $445
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $443
+LABELV $445
+ADDRGP4 $446
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $436
+JUMPV
+LABELV $443
+ADDRLP4 4
+CNSTI4 84
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+LABELV $439
+ADDRGP4 $438
+JUMPV
+LABELV $440
+ADDRLP4 12
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+EQI4 $449
+ADDRLP4 16
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $451
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $449
+LABELV $436
+endproc CG_ParseCaScores 60 12
+proc CG_ParseTdmScores 200 12
+ADDRGP4 cg+3856416
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3856416+8
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+28
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+32
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+48
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+52
+ADDRLP4 72
+INDIRI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+68
+ADDRLP4 80
+INDIRI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+72
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+76
+ADDRLP4 96
+INDIRI4
+ASGNI4
+CNSTI4 12
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+80
+ADDRLP4 104
+INDIRI4
+ASGNI4
+CNSTI4 13
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+84
+ADDRLP4 112
+INDIRI4
+ASGNI4
+CNSTI4 14
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+88
+ADDRLP4 120
+INDIRI4
+ASGNI4
+CNSTI4 15
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+104
+ADDRLP4 128
+INDIRI4
+ASGNI4
+CNSTI4 16
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+108
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 17
+ASGNI4
+ADDRGP4 $489
+JUMPV
+LABELV $488
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $491
+ADDRGP4 $490
+JUMPV
+LABELV $491
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $495
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $493
+LABELV $495
+ADDRGP4 $496
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $452
+JUMPV
+LABELV $493
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $499
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $497
+LABELV $499
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128+8
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128+64
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128+68
+ADDP4
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128+76
+ADDP4
+ADDRLP4 196
+INDIRI4
+ASGNI4
+LABELV $497
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+LABELV $489
+ADDRGP4 $488
+JUMPV
+LABELV $490
+ADDRLP4 140
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $514
+ADDRLP4 144
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $516
+ARGP4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $514
+LABELV $452
+endproc CG_ParseTdmScores 200 12
+proc CG_ParseTdmScores2 304 12
+ADDRGP4 cg+3856416
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3856416+8
+CNSTI4 2
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+28
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+32
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+36
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+40
+ADDRLP4 72
+INDIRI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+44
+ADDRLP4 80
+INDIRI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+48
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+52
+ADDRLP4 96
+INDIRI4
+ASGNI4
+CNSTI4 12
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+56
+ADDRLP4 104
+INDIRI4
+ASGNI4
+CNSTI4 13
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+60
+ADDRLP4 112
+INDIRI4
+ASGNI4
+CNSTI4 14
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+64
+ADDRLP4 120
+INDIRI4
+ASGNI4
+CNSTI4 15
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+68
+ADDRLP4 128
+INDIRI4
+ASGNI4
+CNSTI4 16
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+72
+ADDRLP4 136
+INDIRI4
+ASGNI4
+CNSTI4 17
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+76
+ADDRLP4 144
+INDIRI4
+ASGNI4
+CNSTI4 18
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+80
+ADDRLP4 152
+INDIRI4
+ASGNI4
+CNSTI4 19
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+84
+ADDRLP4 160
+INDIRI4
+ASGNI4
+CNSTI4 20
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+88
+ADDRLP4 168
+INDIRI4
+ASGNI4
+CNSTI4 21
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+92
+ADDRLP4 176
+INDIRI4
+ASGNI4
+CNSTI4 22
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+96
+ADDRLP4 184
+INDIRI4
+ASGNI4
+CNSTI4 23
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+100
+ADDRLP4 192
+INDIRI4
+ASGNI4
+CNSTI4 24
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+104
+ADDRLP4 200
+INDIRI4
+ASGNI4
+CNSTI4 25
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+108
+ADDRLP4 208
+INDIRI4
+ASGNI4
+CNSTI4 26
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+112
+ADDRLP4 216
+INDIRI4
+ASGNI4
+CNSTI4 27
+ARGI4
+ADDRLP4 220
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+116
+ADDRLP4 224
+INDIRI4
+ASGNI4
+CNSTI4 28
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+120
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 29
+ASGNI4
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $580
+ADDRGP4 $579
+JUMPV
+LABELV $580
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 240
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 240
+INDIRP4
+ARGP4
+ADDRLP4 244
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $584
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $582
+LABELV $584
+ADDRGP4 $585
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $517
+JUMPV
+LABELV $582
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 252
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $588
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $586
+LABELV $588
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128+8
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128+12
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128+64
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128+68
+ADDP4
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128+76
+ADDP4
+ADDRLP4 300
+INDIRI4
+ASGNI4
+LABELV $586
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+ADDI4
+ASGNI4
+LABELV $578
+ADDRGP4 $577
+JUMPV
+LABELV $579
+ADDRLP4 236
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $606
+ADDRLP4 240
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $608
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $606
+LABELV $517
+endproc CG_ParseTdmScores2 304 12
+proc CG_ParseCtfScores 328 12
+ADDRGP4 cg+3865760
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3865760+8
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+28
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+32
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+36
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+40
+ADDRLP4 72
+INDIRI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+44
+ADDRLP4 80
+INDIRI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+48
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+52
+ADDRLP4 96
+INDIRI4
+ASGNI4
+CNSTI4 12
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+56
+ADDRLP4 104
+INDIRI4
+ASGNI4
+CNSTI4 13
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+60
+ADDRLP4 112
+INDIRI4
+ASGNI4
+CNSTI4 14
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+64
+ADDRLP4 120
+INDIRI4
+ASGNI4
+CNSTI4 15
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+68
+ADDRLP4 128
+INDIRI4
+ASGNI4
+CNSTI4 16
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+72
+ADDRLP4 136
+INDIRI4
+ASGNI4
+CNSTI4 17
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+76
+ADDRLP4 144
+INDIRI4
+ASGNI4
+CNSTI4 18
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+80
+ADDRLP4 152
+INDIRI4
+ASGNI4
+CNSTI4 19
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+84
+ADDRLP4 160
+INDIRI4
+ASGNI4
+CNSTI4 20
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+88
+ADDRLP4 168
+INDIRI4
+ASGNI4
+CNSTI4 21
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+92
+ADDRLP4 176
+INDIRI4
+ASGNI4
+CNSTI4 22
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+96
+ADDRLP4 184
+INDIRI4
+ASGNI4
+CNSTI4 23
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+100
+ADDRLP4 192
+INDIRI4
+ASGNI4
+CNSTI4 24
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+104
+ADDRLP4 200
+INDIRI4
+ASGNI4
+CNSTI4 25
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+108
+ADDRLP4 208
+INDIRI4
+ASGNI4
+CNSTI4 26
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+112
+ADDRLP4 216
+INDIRI4
+ASGNI4
+CNSTI4 27
+ARGI4
+ADDRLP4 220
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+116
+ADDRLP4 224
+INDIRI4
+ASGNI4
+CNSTI4 28
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+120
+ADDRLP4 232
+INDIRI4
+ASGNI4
+CNSTI4 29
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+124
+ADDRLP4 240
+INDIRI4
+ASGNI4
+CNSTI4 30
+ARGI4
+ADDRLP4 244
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+128
+ADDRLP4 248
+INDIRI4
+ASGNI4
+CNSTI4 31
+ARGI4
+ADDRLP4 252
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+132
+ADDRLP4 256
+INDIRI4
+ASGNI4
+CNSTI4 32
+ARGI4
+ADDRLP4 260
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+136
+ADDRLP4 264
+INDIRI4
+ASGNI4
+CNSTI4 33
+ARGI4
+ADDRLP4 268
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+140
+ADDRLP4 272
+INDIRI4
+ASGNI4
+CNSTI4 34
+ARGI4
+ADDRLP4 276
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+144
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 35
+ASGNI4
+ADDRGP4 $682
+JUMPV
+LABELV $681
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $684
+ADDRGP4 $683
+JUMPV
+LABELV $684
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $688
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $686
+LABELV $688
+ADDRGP4 $689
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $609
+JUMPV
+LABELV $686
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $692
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $690
+LABELV $692
+CNSTI4 80
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3865760+152
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 312
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 80
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3865760+152+8
+ADDP4
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 80
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3865760+152+12
+ADDP4
+ADDRLP4 324
+INDIRI4
+ASGNI4
+LABELV $690
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+LABELV $682
+ADDRGP4 $681
+JUMPV
+LABELV $683
+ADDRLP4 284
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $701
+ADDRLP4 288
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $703
+ARGP4
+ADDRLP4 288
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $701
+LABELV $609
+endproc CG_ParseCtfScores 328 12
+proc CG_ParseCaStats 252 8
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $707
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $705
+LABELV $707
+ADDRGP4 $708
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $704
+JUMPV
+LABELV $705
+ADDRLP4 0
+CNSTI4 124
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3848480
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTI4 12
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+CNSTI4 13
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+CNSTI4 14
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+CNSTI4 15
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+CNSTI4 16
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+CNSTI4 17
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+CNSTI4 18
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+CNSTI4 19
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+CNSTI4 20
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+CNSTI4 21
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+CNSTI4 22
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+CNSTI4 23
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+CNSTI4 24
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+CNSTI4 25
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+CNSTI4 26
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+CNSTI4 27
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+CNSTI4 28
+ARGI4
+ADDRLP4 220
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 224
+INDIRI4
+ASGNI4
+CNSTI4 29
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 232
+INDIRI4
+ASGNI4
+CNSTI4 30
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 240
+INDIRI4
+ASGNI4
+CNSTI4 31
+ARGI4
+ADDRLP4 244
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+LABELV $704
+endproc CG_ParseCaStats 252 8
+proc CG_ParseTdmStats 108 8
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $713
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $711
+LABELV $713
+ADDRGP4 $714
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $710
+JUMPV
+LABELV $711
+ADDRGP4 $715
+JUMPV
+ADDRLP4 0
+CNSTI4 60
+CNSTI4 92
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+3861920
+ADDP4
+ASGNP4
+ADDRGP4 $716
+JUMPV
+LABELV $715
+ADDRLP4 0
+CNSTI4 60
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3861920
+ADDP4
+ASGNP4
+LABELV $716
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+CNSTI4 12
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+LABELV $710
+endproc CG_ParseTdmStats 108 8
+proc CG_ParseCtfStats 116 8
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $723
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $721
+LABELV $723
+ADDRGP4 $724
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $720
+JUMPV
+LABELV $721
+ADDRLP4 0
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+3871032
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+CNSTI4 12
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+CNSTI4 13
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+LABELV $720
+endproc CG_ParseCtfStats 116 8
+proc CG_ParseTeamInfo_91 52 8
+ADDRGP4 $726
+JUMPV
+LABELV $727
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CNSTI4 32
+LTI4 $729
+ADDRGP4 $731
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 numSortedTeamPlayers
+CNSTI4 31
+ASGNI4
+LABELV $729
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $735
+JUMPV
+LABELV $732
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $738
+ADDRLP4 12
+INDIRI4
+CNSTI4 64
+LTI4 $736
+LABELV $738
+ADDRGP4 $739
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $726
+JUMPV
+LABELV $736
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $741
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 240
+ADDP4
+ADDRGP4 STAT_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 244
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 268
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $745
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $749
+ADDRLP4 48
+ADDRLP4 4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $749
+LABELV $746
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $745
+ADDRGP4 $742
+JUMPV
+LABELV $741
+ADDRLP4 20
+CNSTI4 1496
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 232
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 240
+ADDP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 244
+ADDP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $742
+ADDRLP4 4
+INDIRP4
+CNSTI4 4508
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $733
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $735
+ADDRLP4 16
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+LTI4 $732
+LABELV $726
+endproc CG_ParseTeamInfo_91 52 8
+proc CG_ParseTeamInfo 72 8
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CNSTI4 32
+LTI4 $752
+ADDRGP4 $754
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 numSortedTeamPlayers
+CNSTI4 31
+ASGNI4
+LABELV $752
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $758
+JUMPV
+LABELV $755
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $761
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $759
+LABELV $761
+ADDRGP4 $762
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $751
+JUMPV
+LABELV $759
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+232
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+236
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+240
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 6
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+244
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+268
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4508
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $756
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $758
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+LTI4 $755
+LABELV $751
+endproc CG_ParseTeamInfo 72 8
+proc CG_ParseVersion 1068 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $776
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+1957476
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $778
+ADDRGP4 $783
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRGP4 $783
+ARGP4
+ADDRLP4 1044
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 1048
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $781
+ADDRGP4 cgs+1957472
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+1957476
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+1957480
+CNSTI4 1032
+ASGNI4
+ADDRGP4 $775
+JUMPV
+LABELV $781
+ADDRGP4 $789
+ARGP4
+ADDRLP4 1052
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRGP4 $789
+ARGP4
+ADDRLP4 1052
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $793
+ADDRGP4 $790
+ARGP4
+ADDRLP4 1060
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRGP4 $790
+ARGP4
+ADDRLP4 1060
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 1064
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+EQI4 $793
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $787
+LABELV $793
+ADDRGP4 cgs+1957472
+CNSTI4 1
+ASGNI4
+ADDRGP4 $788
+JUMPV
+LABELV $787
+ADDRGP4 cgs+1957472
+CNSTI4 0
+ASGNI4
+LABELV $788
+LABELV $778
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+LABELV $796
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1957480
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $797
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+LTI4 $796
+ADDRLP4 0
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRGP4 $802
+JUMPV
+LABELV $801
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $804
+ADDRGP4 $775
+JUMPV
+LABELV $804
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $802
+ADDRLP4 1044
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 48
+LTI4 $801
+ADDRLP4 1044
+INDIRI4
+CNSTI4 57
+GTI4 $801
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+LABELV $806
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $810
+ADDRGP4 $775
+JUMPV
+LABELV $810
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $813
+JUMPV
+LABELV $812
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $817
+ADDRLP4 4
+INDIRI4
+CNSTI4 1022
+LTI4 $815
+LABELV $817
+ADDRGP4 $775
+JUMPV
+LABELV $815
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1048
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1048
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $813
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 48
+LTI4 $818
+ADDRLP4 1048
+INDIRI4
+CNSTI4 57
+LEI4 $812
+LABELV $818
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $819
+ADDRGP4 $775
+JUMPV
+LABELV $819
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ARGP4
+ADDRLP4 1052
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1957480
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+LABELV $807
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+LTI4 $806
+ADDRGP4 cgs+1957472
+INDIRI4
+CNSTI4 0
+EQI4 $822
+ADDRLP4 1048
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957480
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+GTI4 $836
+ADDRGP4 cgs+1957480+4
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+GTI4 $836
+ADDRGP4 cgs+1957480+8
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+GTI4 $836
+ADDRGP4 cgs+1957480+12
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+LEI4 $823
+LABELV $836
+LABELV $822
+LABELV $823
+LABELV $775
+endproc CG_ParseVersion 1068 12
+proc CG_LoadServerModelOverride 224 36
+ADDRGP4 cg+682036
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cgs+1957608
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $840
+ADDRLP4 12
+ARGP4
+ADDRGP4 cgs+1957608
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 80
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $844
+ADDRLP4 76
+ADDRGP4 $846
+ASGNP4
+ADDRGP4 $845
+JUMPV
+LABELV $844
+ADDRLP4 84
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $845
+ADDRGP4 cg+682036+416
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+682036+480
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+682036+544
+ARGP4
+ADDRGP4 cg+682036+416
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+682036+608
+ARGP4
+ADDRGP4 cg+682036+480
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+682036
+ARGP4
+ADDRGP4 cg+682036+416
+ARGP4
+ADDRGP4 cg+682036+480
+ARGP4
+ADDRGP4 cg+682036+544
+ARGP4
+ADDRGP4 cg+682036+608
+ARGP4
+ADDRGP4 $876
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+pop
+ADDRLP4 8
+ADDRGP4 cg+682036+416
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $879
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $883
+ADDRGP4 $881
+JUMPV
+LABELV $883
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+682036+2016
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $889
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 88
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+682036+2016
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+LABELV $880
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $879
+LABELV $881
+LABELV $840
+ADDRGP4 cgs+1957672
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $890
+ADDRLP4 12
+ARGP4
+ADDRGP4 cgs+1957672
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 208
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $894
+ADDRLP4 76
+ADDRGP4 $846
+ASGNP4
+ADDRGP4 $895
+JUMPV
+LABELV $894
+ADDRLP4 212
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 212
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $895
+ADDRGP4 cg+682036+544
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+682036+608
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $904
+JUMPV
+ADDRLP4 80
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $906
+ARGP4
+ADDRGP4 cg+682036+544+1
+ARGP4
+ADDRGP4 cg+682036+544+1
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $905
+JUMPV
+LABELV $904
+ADDRLP4 80
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $913
+ARGP4
+ADDRGP4 cg+682036+544
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $905
+ADDRLP4 80
+ARGP4
+ADDRLP4 212
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+682036+940
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 cg+682036+940
+INDIRI4
+CNSTI4 0
+NEI4 $918
+ADDRGP4 $922
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $837
+JUMPV
+LABELV $918
+ADDRLP4 80
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 cg+682036
+ARGP4
+ADDRGP4 $876
+ARGP4
+ADDRGP4 cg+682036+544
+ARGP4
+ADDRGP4 cg+682036+608
+ARGP4
+ADDRGP4 $930
+ARGP4
+ADDRGP4 $931
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 216
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $923
+ADDRLP4 80
+ARGP4
+ADDRLP4 220
+ADDRGP4 CG_RegisterSkinVertexLight
+CALLI4
+ASGNI4
+ADDRGP4 cg+682036+944
+ADDRLP4 220
+INDIRI4
+ASGNI4
+LABELV $923
+ADDRGP4 cg+682036+944
+INDIRI4
+CNSTI4 0
+NEI4 $934
+ADDRGP4 $938
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $934
+LABELV $890
+LABELV $837
+endproc CG_LoadServerModelOverride 224 36
+export CG_LoadInfectedGameTypeModels
+proc CG_LoadInfectedGameTypeModels 56 28
+ADDRLP4 4
+ADDRGP4 cgs+1960924
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 16
+ADDRGP4 $941
+ASGNP4
+ADDRLP4 20
+ADDRGP4 $846
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 608
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 608
+ADDP4
+ARGP4
+ADDRGP4 $876
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+pop
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $942
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $946
+ADDRGP4 $944
+JUMPV
+LABELV $946
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2016
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $889
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2016
+ADDP4
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $943
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $942
+LABELV $944
+ADDRLP4 4
+ADDRGP4 cgs+1965448
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 16
+ADDRGP4 $949
+ASGNP4
+ADDRLP4 20
+ADDRGP4 $846
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 608
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 608
+ADDP4
+ARGP4
+ADDRGP4 $876
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+pop
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $950
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $954
+ADDRGP4 $952
+JUMPV
+LABELV $954
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2016
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $889
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2016
+ADDP4
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $951
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $950
+LABELV $952
+LABELV $939
+endproc CG_LoadInfectedGameTypeModels 56 28
+proc CG_SetScorePlace 16 12
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $957
+ADDRGP4 $956
+JUMPV
+LABELV $957
+CNSTI4 659
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $962
+CNSTI4 660
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $960
+LABELV $962
+CNSTI4 659
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+43292
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 660
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+44316
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $960
+LABELV $956
+endproc CG_SetScorePlace 16 12
+export CG_ParseServerinfo
+proc CG_ParseServerinfo 196 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $969
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39688
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $970
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $973
+ADDRGP4 $971
+JUMPV
+LABELV $973
+ADDRLP4 48
+ADDRGP4 cgs+39688
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LTI4 $971
+ADDRLP4 48
+INDIRI4
+CNSTI4 7
+GTI4 $971
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LSHI4
+ADDRGP4 $989-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $989
+address $979
+address $971
+address $981
+address $983
+address $985
+address $987
+code
+LABELV $979
+ADDRGP4 cgs+39688
+CNSTI4 16
+ASGNI4
+ADDRGP4 $971
+JUMPV
+LABELV $981
+ADDRGP4 cgs+39688
+CNSTI4 5
+ASGNI4
+ADDRGP4 $971
+JUMPV
+LABELV $983
+ADDRGP4 cgs+39688
+CNSTI4 6
+ASGNI4
+ADDRGP4 $971
+JUMPV
+LABELV $985
+ADDRGP4 cgs+39688
+CNSTI4 7
+ASGNI4
+ADDRGP4 $971
+JUMPV
+LABELV $987
+ADDRGP4 cgs+39688
+CNSTI4 8
+ASGNI4
+ADDRGP4 $971
+JUMPV
+LABELV $970
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $991
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $994
+ADDRGP4 cgs+39688
+CNSTI4 2
+ASGNI4
+LABELV $994
+LABELV $991
+LABELV $971
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $999
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39692
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+39692
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 -61
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1001
+ADDRGP4 $1003
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1001
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1004
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1004
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $1004
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1006
+ARGP4
+ADDRLP4 68
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39696
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1007
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_CpmaParseGameState
+CALLV
+pop
+ADDRGP4 $1008
+JUMPV
+LABELV $1007
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1011
+ARGP4
+ADDRLP4 76
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39700
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1013
+ARGP4
+ADDRLP4 84
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39704
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1015
+ARGP4
+ADDRLP4 92
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39708
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1017
+ARGP4
+ADDRLP4 100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39712
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1019
+ARGP4
+ADDRLP4 108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39716
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1021
+ARGP4
+ADDRLP4 116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39720
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39724
+ADDRGP4 cgs+39720
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1024
+CNSTI4 661
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 $1028
+ARGP4
+ADDRLP4 128
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43272
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 $1030
+ARGP4
+ADDRLP4 136
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43276
+ADDRLP4 140
+INDIRI4
+ASGNI4
+LABELV $1024
+LABELV $1008
+ADDRGP4 $1032
+ARGP4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1031
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1032
+ARGP4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $969
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cgs+39720
+INDIRI4
+CNSTI4 0
+NEI4 $1035
+ADDRGP4 cg_levelTimerDirection+12
+INDIRI4
+CNSTI4 4
+NEI4 $1038
+ADDRLP4 92
+ADDRGP4 trap_GetGameEndTime
+CALLI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 trap_GetGameStartTime
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 100
+INDIRI4
+EQI4 $1041
+ADDRLP4 88
+INDIRI4
+ADDRLP4 100
+INDIRI4
+EQI4 $1041
+ADDRLP4 104
+ADDRGP4 trap_GetGameEndTime
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRGP4 trap_GetGameStartTime
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39720
+ADDRLP4 104
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 112
+ADDRGP4 cgs+39720
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 60000
+DIVI4
+ASGNI4
+ADDRGP4 $1039
+JUMPV
+LABELV $1041
+ADDRGP4 cgs+39720
+ADDRGP4 cg_levelTimerDefaultTimeLimit+12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39720
+INDIRI4
+CNSTI4 0
+GTI4 $1039
+ADDRGP4 cgs+39720
+CNSTI4 60
+ASGNI4
+ADDRGP4 $1039
+JUMPV
+LABELV $1038
+ADDRGP4 cgs+39720
+ADDRGP4 cg_levelTimerDefaultTimeLimit+12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39720
+INDIRI4
+CNSTI4 0
+GTI4 $1053
+ADDRGP4 cgs+39720
+CNSTI4 60
+ASGNI4
+LABELV $1053
+LABELV $1039
+LABELV $1035
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1058
+ARGP4
+ADDRLP4 84
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39728
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1059
+ARGP4
+ADDRLP4 92
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+39732
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $1062
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1063
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_CpmaParseScores
+CALLV
+pop
+LABELV $1063
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1066
+CNSTI4 0
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 $1072
+ARGP4
+ADDRLP4 100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $1071
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $1074
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRGP4 $1072
+ARGP4
+ADDRLP4 116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $1069
+LABELV $1074
+ADDRGP4 cgs+1957776
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+1969972
+CNSTF4 1147207680
+ASGNF4
+ADDRGP4 $1077
+ARGP4
+ADDRGP4 $1078
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1070
+JUMPV
+LABELV $1069
+ADDRGP4 cgs+1957776
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1969972
+CNSTF4 1145569280
+ASGNF4
+ADDRGP4 $1077
+ARGP4
+ADDRGP4 $1081
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1070
+LABELV $1066
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $1082
+ADDRGP4 cgs+40128
+CNSTI4 0
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+40116
+ADDRLP4 100
+INDIRI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+40120
+ADDRLP4 108
+INDIRI4
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+40124
+ADDRLP4 116
+INDIRI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+40132
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1091
+ADDRGP4 $1092
+JUMPV
+LABELV $1091
+CNSTI4 12
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+41156
+ADDRLP4 128
+INDIRI4
+ASGNI4
+CNSTI4 13
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+41156+4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+CNSTI4 14
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRGP4 cgs+41188
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 15
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRGP4 cgs+41188+1024
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 16
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+41164
+ADDRLP4 152
+INDIRI4
+ASGNI4
+CNSTI4 17
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+41164+4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+CNSTI4 18
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+41172
+ADDRLP4 168
+INDIRI4
+ASGNI4
+CNSTI4 19
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+41172+4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+41180
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+41180+4
+CNSTI4 0
+ASGNI4
+LABELV $1092
+LABELV $1082
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $1109
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1112
+ADDRGP4 cgs+39988
+ARGP4
+ADDRGP4 $1115
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cgs+39860
+ARGP4
+ADDRGP4 $1115
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1119
+ARGP4
+ADDRGP4 cgs+39860
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cgs+40052
+ARGP4
+ADDRGP4 $1122
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cgs+39924
+ARGP4
+ADDRGP4 $1122
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1126
+ARGP4
+ADDRGP4 cgs+39924
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1112
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+LABELV $1109
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1133
+ADDRGP4 cgs+1957588
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1128
+LABELV $1133
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 0
+LTI4 $1128
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 17
+GEI4 $1128
+ADDRGP4 cgs+1957588
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957588
+INDIRI4
+CNSTI4 0
+EQI4 $1135
+ADDRGP4 $1138
+ARGP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametypeConfigs
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRGP4 $1136
+JUMPV
+LABELV $1135
+ADDRLP4 24
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametypeConfigs
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1136
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1141
+ADDRGP4 $1143
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $1142
+JUMPV
+LABELV $1141
+ADDRGP4 $1144
+ARGP4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1142
+LABELV $1128
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $1146
+ADDRGP4 $967
+JUMPV
+LABELV $1146
+ADDRGP4 CG_SetScorePlace
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1149
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $1151
+CNSTI4 695
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1151
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $1156
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+NEI4 $1151
+LABELV $1156
+CNSTI4 695
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+39988
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1152
+JUMPV
+LABELV $1151
+ADDRGP4 cgs+39988
+ARGP4
+ADDRGP4 $1115
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1152
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $1161
+CNSTI4 693
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1161
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $1166
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+NEI4 $1161
+LABELV $1166
+CNSTI4 693
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+39860
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1162
+JUMPV
+LABELV $1161
+ADDRGP4 cgs+39860
+ARGP4
+ADDRGP4 $1115
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1162
+ADDRGP4 $1119
+ARGP4
+ADDRGP4 cgs+39860
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $1172
+CNSTI4 696
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1172
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $1177
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+NEI4 $1172
+LABELV $1177
+CNSTI4 696
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+40052
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1173
+JUMPV
+LABELV $1172
+ADDRGP4 cgs+40052
+ARGP4
+ADDRGP4 $1122
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1173
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $1182
+CNSTI4 694
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1182
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $1187
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+NEI4 $1182
+LABELV $1187
+CNSTI4 694
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+39924
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1183
+JUMPV
+LABELV $1182
+ADDRGP4 cgs+39924
+ARGP4
+ADDRGP4 $1122
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1183
+ADDRGP4 $1126
+ARGP4
+ADDRGP4 cgs+39924
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1149
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1194
+ARGP4
+ADDRLP4 96
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1957584
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1195
+ARGP4
+ADDRLP4 104
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 $1196
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1195
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1197
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 90
+GTI4 $1197
+ADDRGP4 cgs+1957504
+INDIRI4
+CNSTI4 -1
+LEI4 $1197
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957508
+INDIRI1
+CVII4 1
+ADDRLP4 116
+INDIRI4
+EQI4 $1197
+ADDRGP4 cgs+1957572
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1197
+ADDRGP4 cgs+1957580
+INDIRI4
+ADDRLP4 116
+INDIRI4
+EQI4 $1197
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $1208
+JUMPV
+LABELV $1205
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1209
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1209
+LABELV $1206
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1208
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1205
+CNSTI4 4524
+ADDRGP4 cgs+1957504
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1212
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+1957576
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+MULI4
+SUBI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957572
+INDIRP4
+CNSTI4 2148
+ADDP4
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957572
+INDIRP4
+CNSTI4 2144
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+1957576
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+MULI4
+SUBI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRGP4 $1219
+ARGP4
+ADDRGP4 cgs+1957508
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cg_printSkillRating+12
+INDIRI4
+CNSTI4 0
+EQI4 $1222
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+1957576
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+MULI4
+SUBI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRGP4 $1219
+ARGP4
+ADDRGP4 cgs+1957508
+ARGP4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+LABELV $1222
+ADDRGP4 cgs+1957580
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1198
+JUMPV
+LABELV $1212
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+1957576
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+MULI4
+SUBI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRGP4 $1228
+ARGP4
+ADDRGP4 cgs+1957508
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cg_printSkillRating+12
+INDIRI4
+CNSTI4 0
+EQI4 $1231
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+1957576
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+MULI4
+SUBI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRGP4 $1228
+ARGP4
+ADDRGP4 cgs+1957508
+ARGP4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+LABELV $1231
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+1957576
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+MULI4
+SUBI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 abs
+CALLI4
+ASGNI4
+CNSTI4 4524
+ADDRGP4 cgs+1957504
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2148
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+CNSTI4 4524
+ADDRGP4 cgs+1957504
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2144
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+1957580
+CNSTI4 0
+ASGNI4
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+LABELV $1197
+LABELV $1198
+ADDRGP4 cgs+1957576
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ParseVersion
+CALLV
+pop
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+CNSTI4 495
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $1245
+CNSTI4 683
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1247
+ARGP4
+ADDRLP4 136
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 128
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1248
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1969988
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $1249
+JUMPV
+LABELV $1248
+ADDRGP4 cgs+1969988
+CNSTI4 0
+ASGNI4
+LABELV $1249
+ADDRGP4 $1077
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1245
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+CNSTI4 495
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $1255
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1252
+LABELV $1255
+CNSTI4 685
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRGP4 $1253
+JUMPV
+LABELV $1252
+CNSTI4 684
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 136
+INDIRP4
+ASGNP4
+LABELV $1253
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1256
+ADDRGP4 cgs+1957736
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1260
+ARGP4
+ADDRLP4 144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1957740
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1262
+ARGP4
+ADDRLP4 152
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cgs+1957592
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1264
+ARGP4
+ADDRLP4 160
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cgs+1957596
+ADDRLP4 164
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1267
+ARGP4
+ADDRLP4 168
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1265
+ADDRGP4 cgs+1957600
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1267
+ARGP4
+ADDRLP4 172
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cgs+1957604
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRGP4 $1266
+JUMPV
+LABELV $1265
+ADDRGP4 cgs+1957600
+CNSTI4 0
+ASGNI4
+LABELV $1266
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1271
+ARGP4
+ADDRLP4 172
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 136
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1272
+ARGP4
+ADDRLP4 176
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRGP4 cgs+1957608
+ARGP4
+ADDRLP4 180
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $1277
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRGP4 cgs+1957672
+ARGP4
+ADDRLP4 184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $1257
+LABELV $1277
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1271
+ARGP4
+ADDRLP4 188
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+1957608
+ARGP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1272
+ARGP4
+ADDRLP4 192
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+1957672
+ARGP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 CG_LoadServerModelOverride
+CALLV
+pop
+ADDRGP4 $1257
+JUMPV
+LABELV $1256
+ADDRGP4 cgs+1957736
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957740
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957592
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 cgs+1957596
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 cgs+1957604
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 cgs+1957600
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957608
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+1957672
+CNSTI1 0
+ASGNI1
+LABELV $1257
+CNSTI4 713
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1969992
+ADDRLP4 140
+INDIRI4
+ASGNI4
+CNSTI4 669
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+45340
+ADDRLP4 148
+INDIRI4
+ASGNI4
+CNSTI4 670
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+45344
+ADDRLP4 156
+INDIRI4
+ASGNI4
+CNSTI4 671
+ARGI4
+ADDRLP4 160
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+45352
+ADDRLP4 164
+INDIRI4
+ASGNI4
+CNSTI4 672
+ARGI4
+ADDRLP4 168
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+45356
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1295
+CNSTI4 706
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1960920
+ADDRLP4 180
+INDIRI4
+ASGNI4
+LABELV $1295
+LABELV $967
+endproc CG_ParseServerinfo 196 16
+export CG_ParseWarmup
+proc CG_ParseWarmup 24 12
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1299
+CNSTI4 672
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1302
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $1300
+JUMPV
+LABELV $1299
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1303
+CNSTI4 5
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1306
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $1304
+JUMPV
+LABELV $1303
+CNSTI4 5
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $1304
+LABELV $1300
+ADDRGP4 cg+627392
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $1308
+ADDRGP4 cg+627388
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1308
+ADDRGP4 $1311
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 CG_ResetTimedItemPickupTimes
+CALLV
+pop
+ADDRGP4 cg+627404
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627408
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196884
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+3196888
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+3196892
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+627148
+ADDRGP4 cg_drawCrosshairNamesTime+12
+INDIRI4
+CNSTI4 2000
+ADDI4
+NEGI4
+ASGNI4
+ADDRGP4 cg+627144
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+627156
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627160
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627164
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627304
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627420
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627428
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627432
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+711644
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1330284
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+711652
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 514800
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+1226452
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+711648
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1335092
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1335
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+2380
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1336
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1335
+LABELV $1308
+ADDRGP4 cg+627388
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1298
+endproc CG_ParseWarmup 24 12
+export CG_SetConfigValues
+proc CG_SetConfigValues 40 8
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1342
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43240
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43244
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 13
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43236
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $1306
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+627388
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1342
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $1349
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43240
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43244
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 13
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43236
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+627388
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $1349
+LABELV $1343
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $1360
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $1356
+LABELV $1360
+CNSTI4 658
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+43248
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+43252
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1356
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $1363
+CNSTI4 658
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+43256
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $1363
+LABELV $1357
+LABELV $1341
+endproc CG_SetConfigValues 40 8
+export CG_ShaderStateChanged
+proc CG_ShaderStateChanged 192 20
+CNSTI4 665
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRGP4 $1369
+JUMPV
+LABELV $1368
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1371
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1370
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1370
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $1374
+ARGP4
+ADDRLP4 172
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1370
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1370
+ADDRLP4 76
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 76
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1376
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1377
+ARGP4
+ADDRLP4 180
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1373
+ADDRLP4 140
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 140
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+LABELV $1373
+LABELV $1369
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1380
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1368
+LABELV $1380
+LABELV $1370
+LABELV $1367
+endproc CG_ShaderStateChanged 192 20
+export CG_PlayWinLossMusic
+proc CG_PlayWinLossMusic 8 8
+ADDRGP4 cg_winLossMusic+12
+INDIRI4
+CNSTI4 0
+NEI4 $1382
+ADDRGP4 $1381
+JUMPV
+LABELV $1382
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1385
+ADDRGP4 $1381
+JUMPV
+LABELV $1385
+ADDRLP4 0
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1389
+ADDRLP4 4
+ADDRGP4 $1391
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+ADDRGP4 $1390
+JUMPV
+LABELV $1389
+ADDRLP4 4
+ADDRGP4 $1392
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $1390
+LABELV $1381
+endproc CG_PlayWinLossMusic 8 8
+export CG_InterMissionHit
+proc CG_InterMissionHit 0 8
+ADDRGP4 cg_buzzerSound+12
+INDIRI4
+CNSTI4 0
+EQI4 $1394
+ADDRGP4 cgs+632912+492640
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $1394
+ADDRGP4 CG_PlayWinLossMusic
+CALLV
+pop
+LABELV $1393
+endproc CG_InterMissionHit 0 8
+proc CG_IsModelConfigString 4 0
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $1400
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $1401
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+GEI4 $1401
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1400
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+LTI4 $1405
+ADDRLP4 0
+INDIRI4
+CNSTI4 274
+GEI4 $1405
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 17
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1405
+LABELV $1401
+CNSTI4 0
+RETI4
+LABELV $1399
+endproc CG_IsModelConfigString 4 0
+proc CG_IsSoundConfigString 4 0
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $1408
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+LTI4 $1409
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+GEI4 $1409
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 288
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1407
+JUMPV
+LABELV $1408
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+LTI4 $1413
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+GEI4 $1413
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 274
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1407
+JUMPV
+LABELV $1413
+LABELV $1409
+CNSTI4 0
+RETI4
+LABELV $1407
+endproc CG_IsSoundConfigString 4 0
+proc CG_IsPlayerConfigString 4 0
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $1416
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+LTI4 $1417
+ADDRLP4 0
+INDIRI4
+CNSTI4 608
+GEI4 $1417
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1415
+JUMPV
+LABELV $1416
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+LTI4 $1421
+ADDRLP4 0
+INDIRI4
+CNSTI4 593
+GEI4 $1421
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 529
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1415
+JUMPV
+LABELV $1421
+LABELV $1417
+CNSTI4 0
+RETI4
+LABELV $1415
+endproc CG_IsPlayerConfigString 4 0
+proc CG_IsTeamVoteTime 4 0
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $1424
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $1425
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $1425
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1423
+JUMPV
+LABELV $1424
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 987
+LTI4 $1429
+ADDRLP4 0
+INDIRI4
+CNSTI4 988
+GTI4 $1429
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+SUBI4
+CNSTI4 37
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1423
+JUMPV
+LABELV $1429
+LABELV $1425
+CNSTI4 0
+RETI4
+LABELV $1423
+endproc CG_IsTeamVoteTime 4 0
+proc CG_IsTeamVoteYes 4 0
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $1432
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1433
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+GTI4 $1433
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1431
+JUMPV
+LABELV $1432
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 983
+LTI4 $1437
+ADDRLP4 0
+INDIRI4
+CNSTI4 984
+GTI4 $1437
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+SUBI4
+CNSTI4 41
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1431
+JUMPV
+LABELV $1437
+LABELV $1433
+CNSTI4 0
+RETI4
+LABELV $1431
+endproc CG_IsTeamVoteYes 4 0
+proc CG_IsTeamVoteNo 4 0
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $1440
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+LTI4 $1441
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+GTI4 $1441
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 18
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1439
+JUMPV
+LABELV $1440
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 985
+LTI4 $1445
+ADDRLP4 0
+INDIRI4
+CNSTI4 986
+GTI4 $1445
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+SUBI4
+CNSTI4 39
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1439
+JUMPV
+LABELV $1445
+LABELV $1441
+CNSTI4 0
+RETI4
+LABELV $1439
+endproc CG_IsTeamVoteNo 4 0
+proc CG_IsTeamVoteString 4 0
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $1448
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $1449
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+GTI4 $1449
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 14
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1447
+JUMPV
+LABELV $1448
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 989
+LTI4 $1453
+ADDRLP4 0
+INDIRI4
+CNSTI4 990
+GTI4 $1453
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+SUBI4
+CNSTI4 35
+SUBI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1447
+JUMPV
+LABELV $1453
+LABELV $1449
+CNSTI4 0
+RETI4
+LABELV $1447
+endproc CG_IsTeamVoteString 4 0
+export CG_CpmaParseScores
+proc CG_CpmaParseScores 68 8
+CNSTI4 710
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1456
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1460
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43240
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1462
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43244
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1464
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43264
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1466
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43260
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 cgs+43268
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1302
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+43268
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $1469
+ADDRGP4 cgs+43280
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1457
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1457
+ADDRGP4 CG_RoundEnd
+CALLV
+pop
+ADDRGP4 $1457
+JUMPV
+LABELV $1469
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $1457
+ADDRLP4 20
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LEI4 $1457
+ADDRGP4 cgs+43280
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+43284
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1457
+ADDRGP4 CG_RoundStart
+CALLV
+pop
+ADDRGP4 $1457
+JUMPV
+LABELV $1456
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1460
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43240
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1462
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43244
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+43240
+INDIRI4
+ADDRGP4 cgs+43244
+INDIRI4
+GEI4 $1484
+ADDRLP4 4
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+43240
+ADDRGP4 cgs+43244
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+43244
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1484
+LABELV $1457
+LABELV $1455
+endproc CG_CpmaParseScores 68 8
+export CG_CpmaParseGameState
+proc CG_CpmaParseGameState 144 12
+CNSTI4 672
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1493
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+LTI4 $1494
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+GTI4 $1494
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1520+4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1520
+address $1516
+address $1496
+address $1498
+address $1500
+address $1502
+address $1504
+address $1506
+address $1508
+address $1510
+address $1512
+address $1514
+code
+LABELV $1496
+ADDRGP4 cgs+39688
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1495
+JUMPV
+LABELV $1498
+ADDRGP4 cgs+39688
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1495
+JUMPV
+LABELV $1500
+ADDRGP4 cgs+39688
+CNSTI4 16
+ASGNI4
+ADDRGP4 $1495
+JUMPV
+LABELV $1502
+ADDRGP4 cgs+39688
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1495
+JUMPV
+LABELV $1504
+ADDRGP4 cgs+39688
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1495
+JUMPV
+LABELV $1506
+ADDRGP4 cgs+39688
+CNSTI4 4
+ASGNI4
+ADDRGP4 $1495
+JUMPV
+LABELV $1508
+ADDRGP4 cgs+39688
+CNSTI4 9
+ASGNI4
+ADDRGP4 $1495
+JUMPV
+LABELV $1510
+ADDRGP4 cgs+39688
+CNSTI4 11
+ASGNI4
+ADDRGP4 $1495
+JUMPV
+LABELV $1512
+ADDRGP4 cgs+39688
+CNSTI4 13
+ASGNI4
+ADDRGP4 $1495
+JUMPV
+LABELV $1514
+ADDRGP4 cgs+39688
+CNSTI4 14
+ASGNI4
+ADDRGP4 $1495
+JUMPV
+LABELV $1516
+ADDRGP4 cgs+39688
+CNSTI4 15
+ASGNI4
+ADDRGP4 $1495
+JUMPV
+LABELV $1494
+ADDRGP4 $1518
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cgs+39688
+CNSTI4 0
+ASGNI4
+LABELV $1495
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1523
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39704
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39700
+ADDRGP4 cgs+39704
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39708
+ADDRGP4 cgs+39704
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1529
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39720
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39724
+ADDRGP4 cgs+39720
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1532
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+43236
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1534
+ARGP4
+ADDRLP4 60
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRGP4 cgs+43236
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1302
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $1536
+ADDRGP4 cg+627388
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $1536
+ADDRGP4 cg+627388
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1540
+ADDRGP4 CG_MapRestart
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $1546
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $1542
+LABELV $1546
+ADDRGP4 CG_RoundStart
+CALLV
+pop
+LABELV $1542
+LABELV $1540
+LABELV $1536
+ADDRGP4 cg+627388
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1466
+ARGP4
+ADDRLP4 84
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43260
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1464
+ARGP4
+ADDRLP4 92
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43264
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1550
+ARGP4
+ADDRLP4 100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1551
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+40116
+INDIRI4
+EQI4 $1553
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1553
+ADDRGP4 cg_audioAnnouncerVote+12
+INDIRI4
+CNSTI4 0
+EQI4 $1556
+ADDRGP4 cgs+632912+493216
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $1556
+LABELV $1553
+ADDRGP4 cgs+40128
+CNSTI4 1
+ASGNI4
+LABELV $1551
+ADDRGP4 cgs+40116
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1564
+ARGP4
+ADDRLP4 108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+40120
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1566
+ARGP4
+ADDRLP4 116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+40124
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1568
+ARGP4
+ADDRLP4 124
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+40132
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1570
+ARGP4
+ADDRLP4 128
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 136
+INDIRI4
+EQI4 $1571
+ADDRGP4 cgs+1957792
+INDIRI4
+ADDRLP4 136
+INDIRI4
+NEI4 $1571
+ADDRGP4 cgs+45344
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CNSTI4 320000
+ADDI4
+ASGNI4
+ADDRGP4 cgs+45340
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1572
+ADDRGP4 cgs+632912+492632
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 CG_ResetTimedItemPickupTimes
+CALLV
+pop
+ADDRGP4 $1572
+JUMPV
+LABELV $1571
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1580
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cgs+1957796
+INDIRI4
+EQI4 $1580
+ADDRGP4 cgs+45340
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1581
+ADDRGP4 $1581
+JUMPV
+LABELV $1580
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $1586
+ADDRGP4 cgs+1957792
+INDIRI4
+ADDRLP4 140
+INDIRI4
+EQI4 $1586
+ADDRGP4 cgs+45344
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+45340
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1591
+LABELV $1591
+LABELV $1586
+LABELV $1581
+LABELV $1572
+ADDRGP4 cgs+1957792
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957796
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $1492
+endproc CG_CpmaParseGameState 144 12
+proc CG_CpmaCs 8 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 710
+NEI4 $1596
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_CpmaParseScores
+CALLV
+pop
+ADDRGP4 cg+28
+INDIRI4
+CNSTI4 0
+NEI4 $1597
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1597
+ADDRGP4 $1602
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 CG_InterMissionHit
+CALLV
+pop
+ADDRGP4 cg+28
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $1597
+JUMPV
+LABELV $1596
+ADDRFP4 0
+INDIRI4
+CNSTI4 672
+NEI4 $1605
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_CpmaParseGameState
+CALLV
+pop
+ADDRGP4 $1606
+JUMPV
+LABELV $1605
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1607
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1595
+JUMPV
+LABELV $1606
+LABELV $1597
+CNSTI4 1
+RETI4
+LABELV $1595
+endproc CG_CpmaCs 8 8
+proc CG_ConfigStringModified 1184 16
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 1052
+INDIRI4
+ARGI4
+CNSTI4 495
+ARGI4
+ADDRLP4 1056
+ADDRGP4 CG_CheckQlVersion
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $1612
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1609
+LABELV $1612
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1609
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+LABELV $1610
+CNSTI4 1
+ARGI4
+ADDRLP4 1060
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 1068
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+5649552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1613
+LABELV $1613
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1616
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+5649552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1620
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cg+5653648
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_ChangeConfigString
+CALLV
+pop
+LABELV $1620
+LABELV $1617
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $1616
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+5649552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1624
+ADDRGP4 $1608
+JUMPV
+LABELV $1624
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1072
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1072
+INDIRP4
+ASGNP4
+ADDRGP4 $1629
+ARGP4
+ADDRLP4 1076
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+EQI4 $1627
+ADDRGP4 $1630
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1627
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $1631
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_ConfigStringIndexFromQ3
+CALLI4
+pop
+ADDRGP4 $1629
+ARGP4
+ADDRLP4 1080
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+EQI4 $1634
+ADDRGP4 $1636
+ARGP4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1634
+LABELV $1631
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $1637
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 $1638
+JUMPV
+LABELV $1637
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1639
+ADDRLP4 1080
+CNSTI4 0
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+ARGI4
+ADDRLP4 1080
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 $1640
+JUMPV
+LABELV $1639
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $1641
+ADDRGP4 $1642
+JUMPV
+LABELV $1641
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $1643
+ADDRGP4 CG_ParseWarmup
+CALLV
+pop
+ADDRGP4 $1644
+JUMPV
+LABELV $1643
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+NEI4 $1645
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $1645
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43240
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $1646
+ADDRGP4 cgs+43292
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+44316
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1646
+JUMPV
+LABELV $1645
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+NEI4 $1654
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $1654
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43244
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $1655
+ADDRGP4 cgs+43292
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+44316
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1655
+JUMPV
+LABELV $1654
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $1663
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $1663
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43236
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 $1664
+JUMPV
+LABELV $1663
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $1667
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+40116
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+40128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1668
+JUMPV
+LABELV $1667
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+NEI4 $1671
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+40120
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+40128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1672
+JUMPV
+LABELV $1671
+ADDRLP4 4
+INDIRI4
+CNSTI4 11
+NEI4 $1675
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+40124
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+40128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1676
+JUMPV
+LABELV $1675
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+NEI4 $1679
+ADDRGP4 cgs+40132
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1080
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+40132
+INDIRI1
+CVII4 1
+ADDRLP4 1080
+INDIRI4
+EQI4 $1680
+ADDRGP4 cg_audioAnnouncerVote+12
+INDIRI4
+ADDRLP4 1080
+INDIRI4
+EQI4 $1680
+ADDRGP4 cgs+632912+493216
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1680
+JUMPV
+LABELV $1679
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1080
+ADDRGP4 CG_IsTeamVoteTime
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+EQI4 $1689
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+41156
+ADDP4
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+41180
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1690
+JUMPV
+LABELV $1689
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1084
+ADDRGP4 CG_IsTeamVoteYes
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+EQI4 $1693
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1088
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+41164
+ADDP4
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+41180
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1694
+JUMPV
+LABELV $1693
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1088
+ADDRGP4 CG_IsTeamVoteNo
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+EQI4 $1697
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+41172
+ADDP4
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+41180
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1698
+JUMPV
+LABELV $1697
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1092
+ADDRGP4 CG_IsTeamVoteString
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+EQI4 $1701
+ADDRLP4 1044
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+41188
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1096
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 1096
+INDIRI4
+EQI4 $1702
+ADDRGP4 cg_audioAnnouncerTeamVote+12
+INDIRI4
+ADDRLP4 1096
+INDIRI4
+EQI4 $1702
+ADDRGP4 cgs+632912+493216
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1702
+JUMPV
+LABELV $1701
+ADDRLP4 4
+INDIRI4
+CNSTI4 14
+NEI4 $1709
+ADDRGP4 cg+28
+INDIRI4
+CNSTI4 0
+NEI4 $1711
+ADDRGP4 CG_InterMissionHit
+CALLV
+pop
+ADDRGP4 $1602
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $1711
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1714
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1717
+ADDRGP4 cg+28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1710
+JUMPV
+LABELV $1717
+ADDRGP4 cg+28
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1710
+JUMPV
+LABELV $1714
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+28
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRGP4 $1710
+JUMPV
+LABELV $1709
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1096
+ADDRGP4 CG_IsModelConfigString
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+EQI4 $1722
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+45364
+ADDP4
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRGP4 $1723
+JUMPV
+LABELV $1722
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1100
+ADDRGP4 CG_IsSoundConfigString
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+EQI4 $1725
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $1726
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1104
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+46388+4
+ADDP4
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRGP4 $1726
+JUMPV
+LABELV $1725
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1104
+ADDRGP4 CG_IsPlayerConfigString
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+EQI4 $1731
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+ADDRGP4 $1732
+JUMPV
+LABELV $1731
+ADDRLP4 4
+INDIRI4
+CNSTI4 658
+NEI4 $1733
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $1739
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $1735
+LABELV $1739
+ADDRGP4 cgs+43248
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+43252
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $1734
+JUMPV
+LABELV $1735
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $1734
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43256
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $1734
+JUMPV
+LABELV $1733
+ADDRLP4 4
+INDIRI4
+CNSTI4 665
+NEI4 $1746
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+ADDRGP4 $1747
+JUMPV
+LABELV $1746
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $1748
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1751
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1108
+ADDRGP4 CG_CpmaCs
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+EQI4 $1754
+ADDRGP4 $1608
+JUMPV
+LABELV $1754
+LABELV $1751
+ADDRGP4 $1756
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1749
+JUMPV
+LABELV $1748
+ADDRLP4 4
+INDIRI4
+CNSTI4 659
+NEI4 $1758
+ADDRGP4 cgs+43292
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1759
+JUMPV
+LABELV $1758
+ADDRLP4 4
+INDIRI4
+CNSTI4 660
+NEI4 $1762
+ADDRGP4 cgs+44316
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1763
+JUMPV
+LABELV $1762
+ADDRLP4 4
+INDIRI4
+CNSTI4 663
+NEI4 $1766
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43260
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $1767
+JUMPV
+LABELV $1766
+ADDRLP4 4
+INDIRI4
+CNSTI4 664
+NEI4 $1769
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43264
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $1770
+JUMPV
+LABELV $1769
+ADDRLP4 4
+INDIRI4
+CNSTI4 661
+NEI4 $1772
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $1780
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $1780
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $1780
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $1772
+LABELV $1780
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1781
+ADDRGP4 cgs+43280
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1787
+JUMPV
+LABELV $1784
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1785
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1787
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $1784
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1791
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+1276
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 540
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $1792
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1791
+ADDRGP4 cgs+43288
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1773
+JUMPV
+LABELV $1781
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1306
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43268
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1028
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRLP4 1120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43272
+ADDRLP4 1120
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1030
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1124
+INDIRP4
+ARGP4
+ADDRLP4 1128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43276
+ADDRLP4 1128
+INDIRI4
+ASGNI4
+ADDRGP4 $1773
+JUMPV
+LABELV $1772
+ADDRLP4 4
+INDIRI4
+CNSTI4 662
+NEI4 $1801
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $1809
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $1809
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $1809
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $1801
+LABELV $1809
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1108
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+ADDRLP4 1116
+CNSTI4 0
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 1116
+INDIRI4
+LEI4 $1810
+ADDRGP4 cgs+43280
+INDIRI4
+ADDRLP4 1116
+INDIRI4
+NEI4 $1810
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 2
+NEI4 $1813
+ADDRGP4 CG_ZoomUp_f
+CALLV
+pop
+LABELV $1813
+ADDRGP4 cgs+43280
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_RoundStart
+CALLV
+pop
+ADDRGP4 $1802
+JUMPV
+LABELV $1810
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+GEI4 $1802
+ADDRGP4 cgs+43280
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43268
+CNSTI4 -999
+ASGNI4
+ADDRGP4 cgs+43284
+CNSTI4 -999
+ASGNI4
+ADDRGP4 CG_RoundEnd
+CALLV
+pop
+ADDRGP4 $1802
+JUMPV
+LABELV $1801
+ADDRLP4 4
+INDIRI4
+CNSTI4 669
+NEI4 $1822
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+45340
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1822
+ADDRLP4 4
+INDIRI4
+CNSTI4 670
+NEI4 $1825
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+45344
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $1826
+JUMPV
+LABELV $1825
+ADDRLP4 4
+INDIRI4
+CNSTI4 671
+NEI4 $1828
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+45352
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $1829
+JUMPV
+LABELV $1828
+ADDRLP4 4
+INDIRI4
+CNSTI4 672
+NEI4 $1831
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+45356
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $1832
+JUMPV
+LABELV $1831
+ADDRLP4 4
+INDIRI4
+CNSTI4 689
+NEI4 $1834
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1834
+ADDRGP4 $1835
+JUMPV
+LABELV $1834
+ADDRLP4 4
+INDIRI4
+CNSTI4 690
+NEI4 $1837
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1837
+ADDRGP4 $1838
+JUMPV
+LABELV $1837
+ADDRLP4 4
+INDIRI4
+CNSTI4 685
+NEI4 $1840
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1840
+ADDRGP4 $1841
+JUMPV
+LABELV $1840
+ADDRLP4 4
+INDIRI4
+CNSTI4 686
+NEI4 $1842
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1842
+ADDRGP4 $1843
+JUMPV
+LABELV $1842
+ADDRLP4 4
+INDIRI4
+CNSTI4 686
+NEI4 $1844
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1844
+ADDRGP4 $1845
+JUMPV
+LABELV $1844
+ADDRLP4 4
+INDIRI4
+CNSTI4 687
+NEI4 $1846
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1846
+ADDRGP4 $1847
+JUMPV
+LABELV $1846
+ADDRLP4 4
+INDIRI4
+CNSTI4 687
+NEI4 $1848
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1848
+ADDRGP4 $1849
+JUMPV
+LABELV $1848
+ADDRLP4 4
+INDIRI4
+CNSTI4 688
+NEI4 $1850
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1850
+ADDRGP4 $1851
+JUMPV
+LABELV $1850
+ADDRLP4 4
+INDIRI4
+CNSTI4 688
+NEI4 $1852
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1852
+ADDRGP4 $1853
+JUMPV
+LABELV $1852
+ADDRLP4 4
+INDIRI4
+CNSTI4 689
+NEI4 $1854
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1854
+ADDRGP4 $1855
+JUMPV
+LABELV $1854
+ADDRLP4 4
+INDIRI4
+CNSTI4 690
+NEI4 $1856
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1856
+ADDRGP4 $1857
+JUMPV
+LABELV $1856
+ADDRLP4 4
+INDIRI4
+CNSTI4 691
+NEI4 $1858
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1858
+ADDRGP4 $1859
+JUMPV
+LABELV $1858
+ADDRLP4 4
+INDIRI4
+CNSTI4 692
+NEI4 $1860
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1860
+ADDRGP4 $1861
+JUMPV
+LABELV $1860
+ADDRLP4 4
+INDIRI4
+CNSTI4 691
+NEI4 $1862
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1862
+ADDRGP4 $1863
+JUMPV
+LABELV $1862
+ADDRLP4 4
+INDIRI4
+CNSTI4 692
+NEI4 $1864
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1864
+ADDRGP4 $1865
+JUMPV
+LABELV $1864
+ADDRLP4 4
+INDIRI4
+CNSTI4 697
+NEI4 $1866
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1866
+ADDRGP4 $1867
+JUMPV
+LABELV $1866
+ADDRLP4 4
+INDIRI4
+CNSTI4 699
+NEI4 $1868
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $1868
+ADDRGP4 $1869
+JUMPV
+LABELV $1868
+ADDRLP4 4
+INDIRI4
+CNSTI4 700
+NEI4 $1871
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $1871
+ADDRGP4 $1872
+JUMPV
+LABELV $1871
+ADDRLP4 4
+INDIRI4
+CNSTI4 701
+NEI4 $1874
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $1874
+ADDRGP4 $1875
+JUMPV
+LABELV $1874
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1877
+ADDRLP4 1108
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 693
+EQI4 $1885
+ADDRLP4 1108
+INDIRI4
+CNSTI4 692
+EQI4 $1885
+ADDRLP4 1112
+CNSTI4 696
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 1112
+INDIRI4
+EQI4 $1885
+ADDRLP4 1108
+INDIRI4
+CNSTI4 697
+EQI4 $1885
+ADDRLP4 1108
+INDIRI4
+CNSTI4 698
+EQI4 $1885
+ADDRLP4 1108
+INDIRI4
+CNSTI4 699
+EQI4 $1885
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 1112
+INDIRI4
+NEI4 $1877
+LABELV $1885
+ADDRGP4 $1878
+JUMPV
+LABELV $1877
+ADDRLP4 4
+INDIRI4
+CNSTI4 693
+NEI4 $1886
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $1886
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $1895
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $1895
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $1887
+LABELV $1895
+CNSTI4 695
+ARGI4
+ADDRLP4 1116
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+39860
+ARGP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1887
+JUMPV
+LABELV $1886
+ADDRLP4 4
+INDIRI4
+CNSTI4 694
+NEI4 $1898
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $1898
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $1907
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $1907
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $1899
+LABELV $1907
+CNSTI4 696
+ARGI4
+ADDRLP4 1116
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+39924
+ARGP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1899
+JUMPV
+LABELV $1898
+ADDRLP4 4
+INDIRI4
+CNSTI4 695
+NEI4 $1910
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $1910
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $1919
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $1919
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $1911
+LABELV $1919
+CNSTI4 695
+ARGI4
+ADDRLP4 1116
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+39988
+ARGP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1911
+JUMPV
+LABELV $1910
+ADDRLP4 4
+INDIRI4
+CNSTI4 696
+NEI4 $1922
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $1922
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+EQI4 $1931
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $1931
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $1923
+LABELV $1931
+CNSTI4 696
+ARGI4
+ADDRLP4 1116
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+40052
+ARGP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1923
+JUMPV
+LABELV $1922
+ADDRLP4 4
+INDIRI4
+CNSTI4 685
+NEI4 $1937
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1936
+LABELV $1937
+ADDRLP4 4
+INDIRI4
+CNSTI4 684
+NEI4 $1934
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1934
+LABELV $1936
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1938
+CNSTI4 685
+ARGI4
+ADDRLP4 1124
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1124
+INDIRP4
+ASGNP4
+ADDRGP4 $1939
+JUMPV
+LABELV $1938
+CNSTI4 684
+ARGI4
+ADDRLP4 1124
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1124
+INDIRP4
+ASGNP4
+LABELV $1939
+ADDRLP4 1048
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1940
+ADDRGP4 cgs+1957736
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1941
+JUMPV
+LABELV $1940
+ADDRGP4 cgs+1957736
+CNSTI4 0
+ASGNI4
+LABELV $1941
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 $1260
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1124
+INDIRP4
+ARGP4
+ADDRLP4 1128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1957740
+ADDRLP4 1128
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 $1262
+ARGP4
+ADDRLP4 1132
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1132
+INDIRP4
+ARGP4
+ADDRLP4 1136
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cgs+1957592
+ADDRLP4 1136
+INDIRF4
+ASGNF4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 $1264
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1140
+INDIRP4
+ARGP4
+ADDRLP4 1144
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cgs+1957596
+ADDRLP4 1144
+INDIRF4
+ASGNF4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 $1267
+ARGP4
+ADDRLP4 1148
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1148
+INDIRP4
+ARGP4
+ADDRLP4 1152
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cgs+1957604
+ADDRLP4 1152
+INDIRF4
+ASGNF4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 $1267
+ARGP4
+ADDRLP4 1156
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1156
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1948
+ADDRGP4 cgs+1957600
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1949
+JUMPV
+LABELV $1948
+ADDRGP4 cgs+1957600
+CNSTI4 0
+ASGNI4
+LABELV $1949
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 $1271
+ARGP4
+ADDRLP4 1160
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1116
+ADDRLP4 1160
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 $1272
+ARGP4
+ADDRLP4 1164
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1120
+ADDRLP4 1164
+INDIRP4
+ASGNP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRGP4 cgs+1957608
+ARGP4
+ADDRLP4 1168
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+CNSTI4 0
+NEI4 $1956
+ADDRLP4 1120
+INDIRP4
+ARGP4
+ADDRGP4 cgs+1957672
+ARGP4
+ADDRLP4 1172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1172
+INDIRI4
+CNSTI4 0
+EQI4 $1935
+LABELV $1956
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 $1271
+ARGP4
+ADDRLP4 1176
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+1957608
+ARGP4
+ADDRLP4 1176
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 $1272
+ARGP4
+ADDRLP4 1180
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+1957672
+ARGP4
+ADDRLP4 1180
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 CG_LoadServerModelOverride
+CALLV
+pop
+ADDRGP4 $1935
+JUMPV
+LABELV $1934
+ADDRLP4 4
+INDIRI4
+CNSTI4 702
+NEI4 $1966
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1965
+LABELV $1966
+ADDRLP4 4
+INDIRI4
+CNSTI4 700
+NEI4 $1961
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1961
+LABELV $1965
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1957816
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRGP4 $1962
+JUMPV
+LABELV $1961
+ADDRLP4 4
+INDIRI4
+CNSTI4 703
+NEI4 $1973
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1972
+LABELV $1973
+ADDRLP4 4
+INDIRI4
+CNSTI4 701
+NEI4 $1968
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1968
+LABELV $1972
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1957820
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRGP4 $1969
+JUMPV
+LABELV $1968
+ADDRLP4 4
+INDIRI4
+CNSTI4 705
+NEI4 $1975
+ADDRGP4 $1976
+JUMPV
+LABELV $1975
+ADDRLP4 4
+INDIRI4
+CNSTI4 707
+NEI4 $1977
+ADDRGP4 $1978
+JUMPV
+LABELV $1977
+ADDRLP4 4
+INDIRI4
+CNSTI4 708
+NEI4 $1979
+ADDRGP4 $1980
+JUMPV
+LABELV $1979
+ADDRLP4 4
+INDIRI4
+CNSTI4 709
+NEI4 $1981
+ADDRGP4 $1982
+JUMPV
+LABELV $1981
+ADDRLP4 4
+INDIRI4
+CNSTI4 682
+NEI4 $1983
+ADDRGP4 $1984
+JUMPV
+LABELV $1983
+ADDRLP4 4
+INDIRI4
+CNSTI4 684
+NEI4 $1985
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1985
+ADDRGP4 $1986
+JUMPV
+LABELV $1985
+ADDRLP4 4
+INDIRI4
+CNSTI4 683
+NEI4 $1987
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1987
+ADDRGP4 $1988
+JUMPV
+LABELV $1987
+ADDRLP4 4
+INDIRI4
+CNSTI4 706
+NEI4 $1989
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1960920
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRGP4 $1990
+JUMPV
+LABELV $1989
+ADDRLP4 4
+INDIRI4
+CNSTI4 683
+NEI4 $1992
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1992
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1247
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1116
+ADDRLP4 1120
+INDIRP4
+ASGNP4
+ADDRLP4 1116
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1994
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRLP4 1124
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1969988
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRGP4 $1995
+JUMPV
+LABELV $1994
+ADDRGP4 cgs+1969988
+CNSTI4 0
+ASGNI4
+LABELV $1995
+ADDRGP4 $1077
+ARGP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1993
+JUMPV
+LABELV $1992
+ADDRLP4 4
+INDIRI4
+CNSTI4 713
+NEI4 $1998
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1969992
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRGP4 $1999
+JUMPV
+LABELV $1998
+ADDRGP4 $2001
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1999
+LABELV $1993
+LABELV $1990
+LABELV $1988
+LABELV $1986
+LABELV $1984
+LABELV $1982
+LABELV $1980
+LABELV $1978
+LABELV $1976
+LABELV $1969
+LABELV $1962
+LABELV $1935
+LABELV $1923
+LABELV $1911
+LABELV $1899
+LABELV $1887
+LABELV $1878
+LABELV $1875
+LABELV $1872
+LABELV $1869
+LABELV $1867
+LABELV $1865
+LABELV $1863
+LABELV $1861
+LABELV $1859
+LABELV $1857
+LABELV $1855
+LABELV $1853
+LABELV $1851
+LABELV $1849
+LABELV $1847
+LABELV $1845
+LABELV $1843
+LABELV $1841
+LABELV $1838
+LABELV $1835
+LABELV $1832
+LABELV $1829
+LABELV $1826
+LABELV $1823
+LABELV $1802
+LABELV $1773
+LABELV $1770
+LABELV $1767
+LABELV $1763
+LABELV $1759
+LABELV $1749
+LABELV $1747
+LABELV $1734
+LABELV $1732
+LABELV $1726
+LABELV $1723
+LABELV $1710
+LABELV $1702
+LABELV $1698
+LABELV $1694
+LABELV $1690
+LABELV $1680
+LABELV $1676
+LABELV $1672
+LABELV $1668
+LABELV $1664
+LABELV $1655
+LABELV $1646
+LABELV $1644
+LABELV $1642
+LABELV $1640
+LABELV $1638
+LABELV $1608
+endproc CG_ConfigStringModified 1184 16
+proc CG_AddToTeamChat 64 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+CNSTI4 8
+GEI4 $2004
+ADDRLP4 12
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+ASGNI4
+ADDRGP4 $2005
+JUMPV
+LABELV $2004
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+LABELV $2005
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $2011
+ADDRGP4 cg_teamChatTime+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $2008
+LABELV $2011
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+632804
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+632800
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $2003
+JUMPV
+LABELV $2008
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 241
+ADDRGP4 cgs+632800
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+630840
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+CNSTI4 55
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 $2017
+JUMPV
+LABELV $2016
+ADDRLP4 4
+INDIRI4
+CNSTI4 79
+LEI4 $2019
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2021
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+SUBP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $2021
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+632800
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632768
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 cgs+632800
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 241
+ADDRGP4 cgs+632800
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+630840
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 16
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+LABELV $2019
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2029
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $2029
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2029
+ADDRLP4 28
+INDIRI4
+CNSTI4 65
+LTI4 $2032
+ADDRLP4 28
+INDIRI4
+CNSTI4 90
+LEI4 $2031
+LABELV $2032
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 97
+LTI4 $2033
+ADDRLP4 32
+INDIRI4
+CNSTI4 122
+LEI4 $2031
+LABELV $2033
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $2029
+ADDRLP4 36
+INDIRI4
+CNSTI4 57
+GTI4 $2029
+LABELV $2031
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 56
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 52
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $2017
+JUMPV
+LABELV $2029
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $2034
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $2034
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2017
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2016
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+632800
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632768
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 cgs+632800
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cgs+632800
+INDIRI4
+ADDRGP4 cgs+632804
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+LEI4 $2040
+ADDRGP4 cgs+632804
+ADDRGP4 cgs+632800
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $2040
+LABELV $2003
+endproc CG_AddToTeamChat 64 0
+proc CG_MapRestart 8 12
+ADDRGP4 $2047
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $2048
+ADDRGP4 $2051
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2048
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+ADDRGP4 CG_ResetTimedItemPickupTimes
+CALLV
+pop
+ADDRGP4 cg+627404
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627408
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196884
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+3196888
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+3196892
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+627148
+ADDRGP4 cg_drawCrosshairNamesTime+12
+INDIRI4
+CNSTI4 2000
+ADDI4
+NEGI4
+ASGNI4
+ADDRGP4 cg+627156
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627160
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627164
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627168
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627304
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627420
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627428
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627432
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+711644
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1330284
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+711652
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 514800
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+1226452
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+711648
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1335092
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607180
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607176
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+40116
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607184
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 CG_ResetTimedItemPickupTimes
+CALLV
+pop
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+NEI4 $2081
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $2081
+ADDRGP4 cg_audioAnnouncerWarmup+12
+INDIRI4
+CNSTI4 0
+EQI4 $2085
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $2088
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1960920
+INDIRI4
+CNSTI4 67108864
+BANDI4
+ADDRLP4 0
+INDIRI4
+EQI4 $2088
+ADDRGP4 cg_allowServerOverride+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $2088
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2093
+ADDRLP4 4
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $2094
+JUMPV
+LABELV $2093
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2094
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2097
+ADDRGP4 cgs+632912+493464
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $2089
+JUMPV
+LABELV $2097
+ADDRGP4 cgs+632912+493456
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $2089
+JUMPV
+LABELV $2088
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $2105
+ADDRGP4 cgs+632912+493460
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $2106
+JUMPV
+LABELV $2105
+ADDRGP4 cgs+632912+493456
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $2106
+LABELV $2089
+LABELV $2085
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $2112
+ADDRGP4 cgs+43268
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43280
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+43284
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+EQI4 $2122
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 15
+NEI4 $2118
+LABELV $2122
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2123
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2127
+ADDRGP4 $2124
+JUMPV
+LABELV $2127
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2130
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $2134
+ADDRGP4 cgs+43292
+ARGP4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2135
+JUMPV
+LABELV $2134
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $2140
+ADDRGP4 cgs+44316
+ARGP4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2140
+LABELV $2135
+LABELV $2130
+LABELV $2124
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2123
+ADDRGP4 $2119
+JUMPV
+LABELV $2118
+ADDRGP4 cgs+43292
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+44316
+CNSTI1 0
+ASGNI1
+LABELV $2119
+LABELV $2112
+ADDRGP4 cg_drawFightMessage+12
+INDIRI4
+CNSTI4 0
+EQI4 $2148
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $2151
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1960920
+INDIRI4
+CNSTI4 67108864
+BANDI4
+ADDRLP4 0
+INDIRI4
+EQI4 $2151
+ADDRGP4 cg_allowServerOverride+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $2151
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2156
+ADDRLP4 4
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $2157
+JUMPV
+LABELV $2156
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2157
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2160
+ADDRGP4 $2164
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $2149
+JUMPV
+LABELV $2160
+ADDRGP4 $2165
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $2149
+JUMPV
+LABELV $2151
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $2166
+ADDRGP4 $2169
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $2149
+JUMPV
+LABELV $2166
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+NEI4 $2170
+ADDRGP4 $2149
+JUMPV
+LABELV $2170
+ADDRGP4 $2165
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $2149
+JUMPV
+LABELV $2148
+ADDRGP4 $876
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $2149
+LABELV $2081
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2173
+ADDRGP4 cg+627396
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2174
+JUMPV
+LABELV $2173
+ADDRGP4 cg+627396
+CNSTI4 0
+ASGNI4
+LABELV $2174
+ADDRGP4 CG_ParseWarmup
+CALLV
+pop
+LABELV $2046
+endproc CG_MapRestart 8 12
+proc CG_RemoveChatEscapeChar 1052 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $2180
+ADDRGP4 $2179
+JUMPV
+LABELV $2180
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2183
+ADDRGP4 $2179
+JUMPV
+LABELV $2183
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 1036
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1024
+LTI4 $2185
+ADDRGP4 $2187
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $2179
+JUMPV
+LABELV $2185
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+GEI4 $2188
+ADDRGP4 $2179
+JUMPV
+LABELV $2188
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRGP4 $2193
+JUMPV
+LABELV $2190
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 25
+NEI4 $2194
+ADDRGP4 $2191
+JUMPV
+LABELV $2194
+ADDRLP4 1044
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $2191
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2193
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2190
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12+3
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+SUBI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2179
+endproc CG_RemoveChatEscapeChar 1052 12
+proc CG_CpmaStringScore 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+ADDRFP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 65
+LTI4 $2198
+ADDRLP4 4
+INDIRI4
+CNSTI4 90
+GTI4 $2198
+ADDRLP4 0
+ADDRFP4 0
+INDIRI1
+CVII4 1
+CNSTI4 26
+ADDI4
+CNSTI4 65
+SUBI4
+ASGNI4
+ADDRGP4 $2199
+JUMPV
+LABELV $2198
+ADDRLP4 8
+ADDRFP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 97
+LTI4 $2200
+ADDRLP4 8
+INDIRI4
+CNSTI4 122
+GTI4 $2200
+ADDRLP4 0
+ADDRFP4 0
+INDIRI1
+CVII4 1
+CNSTI4 97
+SUBI4
+ASGNI4
+ADDRGP4 $2201
+JUMPV
+LABELV $2200
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2201
+LABELV $2199
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $2197
+endproc CG_CpmaStringScore 12 0
+proc CG_CpmaParseMstats 188 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+EQI4 $2203
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 15
+EQI4 $2203
+CNSTI4 0
+RETI4
+ADDRGP4 $2202
+JUMPV
+LABELV $2203
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2207
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2209
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $2209
+ADDRGP4 $2211
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2202
+JUMPV
+LABELV $2209
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2212
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3848208
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $2213
+JUMPV
+LABELV $2212
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3848212
+ADDRLP4 56
+INDIRI4
+ASGNI4
+LABELV $2213
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+ADDRGP4 $2208
+JUMPV
+LABELV $2207
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $2218
+ADDRLP4 16
+INDIRI4
+CNSTI4 64
+LTI4 $2216
+LABELV $2218
+ADDRGP4 $2219
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2202
+JUMPV
+LABELV $2216
+ADDRLP4 40
+CNSTI4 2392
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2220
+ADDRLP4 56
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $2229
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $2224
+LABELV $2229
+ADDRGP4 $2221
+JUMPV
+LABELV $2224
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2230
+ADDRGP4 $2222
+JUMPV
+LABELV $2230
+LABELV $2221
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $2220
+LABELV $2222
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $2232
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2233
+JUMPV
+LABELV $2232
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+LTI4 $2234
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+LABELV $2234
+LABELV $2235
+LABELV $2233
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2236
+ADDRGP4 cg+3848208
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2237
+JUMPV
+LABELV $2236
+ADDRGP4 cg+3848212
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $2237
+LABELV $2208
+ADDRLP4 12
+CNSTI4 5088
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg+3196932
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5088
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 4524
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRB
+ASGNB 4524
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2242
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2244
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRGP4 cg+3848224
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2245
+JUMPV
+LABELV $2244
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRGP4 cg+3848352
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2245
+LABELV $2242
+ADDRGP4 cg+3848204
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3848200
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 64
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $2251
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4608
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2253
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 100
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2254
+JUMPV
+LABELV $2253
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2254
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2251
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2255
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4640
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2257
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 100
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2258
+JUMPV
+LABELV $2257
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2258
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2255
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2259
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4672
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2261
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 100
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2262
+JUMPV
+LABELV $2261
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2262
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2259
+ADDRLP4 20
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $2263
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4704
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2265
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 100
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2266
+JUMPV
+LABELV $2265
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2266
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2263
+ADDRLP4 20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2267
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4736
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2269
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 100
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2270
+JUMPV
+LABELV $2269
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2270
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2267
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2271
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4768
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2273
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 100
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2274
+JUMPV
+LABELV $2273
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2274
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2271
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $2275
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4800
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2277
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 100
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2278
+JUMPV
+LABELV $2277
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2278
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2275
+ADDRLP4 20
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $2279
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4832
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2281
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 100
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2282
+JUMPV
+LABELV $2281
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2282
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2279
+ADDRLP4 20
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $2283
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4864
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2285
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 100
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2286
+JUMPV
+LABELV $2285
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2286
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2283
+ADDRLP4 20
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $2287
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4896
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2289
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 100
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2290
+JUMPV
+LABELV $2289
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2290
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2287
+ADDRLP4 20
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2291
+ADDRGP4 $2293
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2291
+ADDRLP4 20
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $2294
+ADDRGP4 $2296
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2294
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4556
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4600
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4576
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4584
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+EQI4 $2297
+ADDRLP4 36
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_CpmaStringScore
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_CpmaStringScore
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4532
+ADDP4
+ADDRLP4 128
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 132
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2297
+ADDRLP4 12
+INDIRP4
+CNSTI4 4532
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2298
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2299
+ADDRLP4 128
+ADDRLP4 40
+INDIRP4
+CNSTI4 720
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4532
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 40
+INDIRP4
+CNSTI4 724
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2299
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4528
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2301
+CNSTI4 4524
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4528
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2301
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4540
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 atoi
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2305
+ADDRLP4 12
+INDIRP4
+CNSTI4 4548
+ADDP4
+CNSTI4 100
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2306
+JUMPV
+LABELV $2305
+ADDRLP4 12
+INDIRP4
+CNSTI4 4548
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2306
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2307
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2309
+ADDRLP4 12
+INDIRP4
+CNSTI4 4560
+ADDP4
+ADDRGP4 PERS_EXCELLENT_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4564
+ADDP4
+ADDRGP4 PERS_IMPRESSIVE_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4568
+ADDP4
+ADDRGP4 PERS_GAUNTLET_FRAG_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2310
+JUMPV
+LABELV $2309
+ADDRLP4 12
+INDIRP4
+CNSTI4 4560
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4564
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4568
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2310
+LABELV $2307
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2315
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2320
+JUMPV
+LABELV $2317
+CNSTI4 92
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2322
+ADDRGP4 $2318
+JUMPV
+LABELV $2322
+CNSTI4 92
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4532
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+4
+ADDP4
+CNSTI4 4524
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2319
+JUMPV
+LABELV $2318
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2320
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $2317
+LABELV $2319
+LABELV $2315
+CNSTI4 1
+RETI4
+LABELV $2202
+endproc CG_CpmaParseMstats 188 12
+proc CG_CpmaParseDmscores 28 12
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2334
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2332
+LABELV $2334
+ADDRGP4 $2335
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2331
+JUMPV
+LABELV $2332
+ADDRGP4 cgs+43292
+ARGP4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2342
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2340
+LABELV $2342
+ADDRGP4 $2343
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2331
+JUMPV
+LABELV $2340
+ADDRGP4 cgs+44316
+ARGP4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $2331
+endproc CG_CpmaParseDmscores 28 12
+proc CG_CpmaMM2 44 16
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2351
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2349
+LABELV $2351
+ADDRGP4 $2352
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2348
+JUMPV
+LABELV $2349
+CNSTI4 2
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 593
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+CNSTI4 3
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $2353
+ARGP4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRGP4 $2356
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cg_serverPrintToChat+12
+INDIRI4
+CNSTI4 0
+EQI4 $2357
+ADDRGP4 $2360
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+LABELV $2357
+CNSTI4 1
+RETI4
+LABELV $2348
+endproc CG_CpmaMM2 44 16
+proc CG_CpmaXscores 116 12
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610876
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5888
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+610844
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2370
+JUMPV
+LABELV $2367
+ADDRLP4 4
+CNSTI4 92
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $2374
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $2372
+LABELV $2374
+ADDRGP4 $2375
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2361
+JUMPV
+LABELV $2372
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 4524
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+EQI4 $2377
+ADDRLP4 20
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_CpmaStringScore
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_CpmaStringScore
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 76
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $2378
+JUMPV
+LABELV $2377
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2378
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 112
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+NEI4 $2379
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $2380
+JUMPV
+LABELV $2379
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2381
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2381
+LABELV $2380
+LABELV $2368
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2370
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $2367
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2383
+ADDRGP4 cg+610868
+ADDRLP4 32
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2384
+JUMPV
+LABELV $2383
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+LABELV $2384
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2387
+ADDRGP4 cg+610872
+ADDRLP4 40
+INDIRI4
+ADDRLP4 36
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2388
+JUMPV
+LABELV $2387
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+LABELV $2388
+CNSTI4 1
+RETI4
+LABELV $2361
+endproc CG_CpmaXscores 116 12
+proc CG_CpmaParseDuelEndScores 20 12
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 cg+3848224
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 cg+3848352
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2396
+ADDRGP4 cg+3848216
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2397
+JUMPV
+LABELV $2396
+ADDRGP4 cg+3848216
+CNSTI4 1
+ASGNI4
+LABELV $2397
+CNSTI4 1
+RETI4
+LABELV $2391
+endproc CG_CpmaParseDuelEndScores 20 12
+proc CG_ParseCtfsRoundScores 24 4
+ADDRGP4 cg+6747364
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2402
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6746844
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6747100
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2403
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $2402
+CNSTI4 21
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+6747356
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 22
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+6747360
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $2400
+endproc CG_ParseCtfsRoundScores 24 4
+proc CG_FilterOspTeamChatLocation 0 0
+LABELV $2410
+endproc CG_FilterOspTeamChatLocation 0 0
+proc CG_ParseScores_Ffa 288 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610848
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610844
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 cg+610844
+INDIRI4
+CNSTI4 64
+LEI4 $2414
+ADDRGP4 $2417
+ARGP4
+ADDRGP4 cg+610844
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+610844
+CNSTI4 64
+ASGNI4
+LABELV $2414
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2420
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+616764
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2421
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2420
+CNSTI4 2
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860+4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $2432
+ADDRLP4 4
+CNSTI4 18
+ASGNI4
+ADDRGP4 $2433
+JUMPV
+LABELV $2432
+ADDRLP4 4
+CNSTI4 14
+ASGNI4
+LABELV $2433
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2438
+JUMPV
+LABELV $2435
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+LTI4 $2442
+ADDRLP4 48
+INDIRI4
+CNSTI4 64
+LTI4 $2440
+LABELV $2442
+ADDRGP4 $2443
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2440
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 6
+ADDI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+16
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+28
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 9
+ADDI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+32
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 10
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+36
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 11
+ADDI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+40
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 12
+ADDI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+44
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 13
+ADDI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+48
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 14
+ADDI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+56
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+52
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+64
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 17
+ADDI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+68
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 18
+ADDI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+72
+ADDP4
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 19
+ADDI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+76
+ADDP4
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 20
+ADDI4
+ARGI4
+ADDRLP4 248
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+24
+ADDP4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 21
+ADDI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+84
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 268
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $2483
+ADDRLP4 268
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $2479
+LABELV $2483
+ADDRGP4 $2484
+ARGP4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2479
+ADDRLP4 272
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 272
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+228
+ADDP4
+ADDRLP4 272
+INDIRI4
+ADDRGP4 cg+610876+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+CNSTI4 4524
+ADDRLP4 276
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+268
+ADDP4
+ADDRLP4 276
+INDIRI4
+ADDRGP4 cg+610876+24
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 4524
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4500
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 4524
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4504
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+616764
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 284
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+ADDRGP4 cg+610876+60
+ADDP4
+CNSTI4 4524
+ADDRLP4 284
+INDIRI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2510
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $2511
+JUMPV
+LABELV $2510
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+60
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2516
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2516
+LABELV $2511
+LABELV $2436
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2438
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $2435
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2522
+ADDRGP4 cg+610868
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2523
+JUMPV
+LABELV $2522
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+LABELV $2523
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2526
+ADDRGP4 cg+610872
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2527
+JUMPV
+LABELV $2526
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+LABELV $2527
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_SetScoreSelection
+CALLV
+pop
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $2530
+ADDRGP4 CG_SetDuelPlayers
+CALLV
+pop
+LABELV $2530
+ADDRLP4 48
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+EQI4 $2533
+ADDRLP4 52
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $2535
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2533
+LABELV $2411
+endproc CG_ParseScores_Ffa 288 12
+proc CG_ParseScores_Duel 260 12
+ADDRGP4 cg+3848204
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3848200
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3848196
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3848196
+INDIRI4
+CNSTI4 2
+LEI4 $2541
+ADDRGP4 $2544
+ARGP4
+ADDRGP4 cg+3848196
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2541
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $2546
+ADDRLP4 24
+CNSTI4 5088
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+3196932
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2551
+ADDRGP4 $2548
+JUMPV
+LABELV $2551
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LTI4 $2555
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+LTI4 $2553
+LABELV $2555
+ADDRGP4 $2556
+ARGP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $2536
+JUMPV
+LABELV $2553
+ADDRLP4 28
+CNSTI4 4524
+ADDRLP4 24
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2558
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 4524
+ADDRLP4 24
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRB
+ASGNB 4524
+LABELV $2558
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4528
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4532
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4536
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4540
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4544
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4548
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4552
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4556
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4564
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4560
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4568
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4572
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4576
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4580
+ADDP4
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4584
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4588
+ADDP4
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4592
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4596
+ADDP4
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4600
+ADDP4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4604
+ADDP4
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 212
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 212
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $2564
+JUMPV
+LABELV $2561
+ADDRLP4 216
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4608
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 252
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2562
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2564
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $2561
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2568
+JUMPV
+LABELV $2565
+CNSTI4 92
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+EQI4 $2570
+ADDRGP4 $2566
+JUMPV
+LABELV $2570
+CNSTI4 92
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4532
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+4
+ADDP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4528
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 92
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+16
+ADDP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2567
+JUMPV
+LABELV $2566
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2568
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $2565
+LABELV $2567
+LABELV $2547
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LTI4 $2546
+LABELV $2548
+ADDRGP4 CG_SetDuelPlayers
+CALLV
+pop
+ADDRLP4 24
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $2579
+ADDRLP4 28
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $2581
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2579
+LABELV $2536
+endproc CG_ParseScores_Duel 260 12
+proc CG_ParseScores_Tdm 412 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3856416
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3856416+8
+CNSTI4 3
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+20
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+28
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+32
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+36
+ADDRLP4 72
+INDIRI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+40
+ADDRLP4 80
+INDIRI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+44
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+48
+ADDRLP4 96
+INDIRI4
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+52
+ADDRLP4 104
+INDIRI4
+ASGNI4
+CNSTI4 12
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+56
+ADDRLP4 112
+INDIRI4
+ASGNI4
+CNSTI4 13
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+60
+ADDRLP4 120
+INDIRI4
+ASGNI4
+CNSTI4 14
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+64
+ADDRLP4 128
+INDIRI4
+ASGNI4
+CNSTI4 15
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+68
+ADDRLP4 136
+INDIRI4
+ASGNI4
+CNSTI4 16
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+72
+ADDRLP4 144
+INDIRI4
+ASGNI4
+CNSTI4 17
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+76
+ADDRLP4 152
+INDIRI4
+ASGNI4
+CNSTI4 18
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+80
+ADDRLP4 160
+INDIRI4
+ASGNI4
+CNSTI4 19
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+84
+ADDRLP4 168
+INDIRI4
+ASGNI4
+CNSTI4 20
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+88
+ADDRLP4 176
+INDIRI4
+ASGNI4
+CNSTI4 21
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+92
+ADDRLP4 184
+INDIRI4
+ASGNI4
+CNSTI4 22
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+96
+ADDRLP4 192
+INDIRI4
+ASGNI4
+CNSTI4 23
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+100
+ADDRLP4 200
+INDIRI4
+ASGNI4
+CNSTI4 24
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+104
+ADDRLP4 208
+INDIRI4
+ASGNI4
+CNSTI4 25
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+108
+ADDRLP4 216
+INDIRI4
+ASGNI4
+CNSTI4 26
+ARGI4
+ADDRLP4 220
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+112
+ADDRLP4 224
+INDIRI4
+ASGNI4
+CNSTI4 27
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+116
+ADDRLP4 232
+INDIRI4
+ASGNI4
+CNSTI4 28
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+120
+ADDRLP4 240
+INDIRI4
+ASGNI4
+CNSTI4 29
+ARGI4
+ADDRLP4 244
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+124
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 30
+ASGNI4
+ADDRLP4 252
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+ADDRGP4 cg+3856416+124
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 31
+ADDI4
+GTI4 $2649
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2644
+LABELV $2649
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860+4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2644
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3856416+128
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5376
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+610844
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610848
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2662
+JUMPV
+LABELV $2661
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2664
+ADDRGP4 $2663
+JUMPV
+LABELV $2664
+ADDRLP4 260
+CNSTI4 92
+ADDRGP4 cg+610844
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 276
+ADDRGP4 cg+610844
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+LTI4 $2671
+ADDRLP4 264
+INDIRI4
+CNSTI4 64
+LTI4 $2669
+LABELV $2671
+ADDRGP4 $2672
+ARGP4
+ADDRLP4 264
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $2582
+JUMPV
+LABELV $2669
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 292
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg_useScoresUpdateTeam+12
+INDIRI4
+CNSTI4 0
+EQI4 $2673
+CNSTI4 4524
+ADDRLP4 264
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2160
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2676
+CNSTI4 4524
+ADDRLP4 264
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+LABELV $2676
+LABELV $2673
+ADDRLP4 256
+CNSTI4 84
+ADDRLP4 264
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRI4
+CNSTI4 1
+EQI4 $2686
+ADDRLP4 268
+INDIRI4
+CNSTI4 2
+NEI4 $2684
+LABELV $2686
+ADDRLP4 256
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2685
+JUMPV
+LABELV $2684
+ADDRLP4 256
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $2685
+ADDRLP4 256
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $2687
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2687
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 256
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 312
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 256
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 256
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 328
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRLP4 332
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 256
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 336
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ARGP4
+ADDRLP4 340
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 256
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 344
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 344
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 256
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 352
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 256
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 360
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 256
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 368
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRLP4 372
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 256
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 376
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+ARGP4
+ADDRLP4 380
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 256
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 384
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 384
+INDIRP4
+ARGP4
+ADDRLP4 388
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 392
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ARGP4
+ADDRLP4 396
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 400
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 400
+INDIRP4
+ARGP4
+ADDRLP4 404
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRLP4 408
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 408
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 408
+INDIRI4
+NEI4 $2690
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $2691
+JUMPV
+LABELV $2690
+ADDRLP4 256
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2692
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2692
+LABELV $2691
+LABELV $2662
+ADDRGP4 $2661
+JUMPV
+LABELV $2663
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2694
+ADDRGP4 cg+610868
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2695
+JUMPV
+LABELV $2694
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+LABELV $2695
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2698
+ADDRGP4 cg+610872
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2699
+JUMPV
+LABELV $2698
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+LABELV $2699
+ADDRLP4 256
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $2702
+ADDRLP4 260
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $2704
+ARGP4
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2702
+LABELV $2582
+endproc CG_ParseScores_Tdm 412 12
+proc CG_ParseScores_Ca 184 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3856416
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3856416+8
+CNSTI4 3
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+124
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3856416+128
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5376
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 32
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 17
+ADDRGP4 cg+3856416+124
+INDIRI4
+MULI4
+CNSTI4 3
+ADDI4
+GTI4 $2722
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2717
+LABELV $2722
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860+4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2717
+ADDRGP4 cg+610844
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610848
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2729
+JUMPV
+LABELV $2728
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2731
+ADDRGP4 $2730
+JUMPV
+LABELV $2731
+ADDRLP4 36
+CNSTI4 92
+ADDRGP4 cg+610844
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRGP4 cg+610844
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $2738
+ADDRLP4 40
+INDIRI4
+CNSTI4 64
+LTI4 $2736
+LABELV $2738
+ADDRGP4 $2739
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $2705
+JUMPV
+LABELV $2736
+ADDRLP4 0
+CNSTI4 84
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg_useScoresUpdateTeam+12
+INDIRI4
+CNSTI4 0
+EQI4 $2742
+CNSTI4 4524
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2160
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2745
+CNSTI4 4524
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2745
+LABELV $2742
+ADDRLP4 36
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $2751
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2751
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2754
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $2755
+JUMPV
+LABELV $2754
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2756
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2756
+LABELV $2755
+LABELV $2729
+ADDRGP4 $2728
+JUMPV
+LABELV $2730
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2758
+ADDRGP4 cg+610868
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2759
+JUMPV
+LABELV $2758
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+LABELV $2759
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2762
+ADDRGP4 cg+610872
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2763
+JUMPV
+LABELV $2762
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+LABELV $2763
+ADDRLP4 36
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $2766
+ADDRLP4 40
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $2768
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2766
+LABELV $2705
+endproc CG_ParseScores_Ca 184 12
+proc CG_ParseSmScores 120 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3856416
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3856416+8
+CNSTI4 3
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+124
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3856416+128
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5376
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860+4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+610844
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610848
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2787
+JUMPV
+LABELV $2786
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2789
+ADDRGP4 $2788
+JUMPV
+LABELV $2789
+ADDRLP4 48
+CNSTI4 92
+ADDRGP4 cg+610844
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 60
+ADDRGP4 cg+610844
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LTI4 $2796
+ADDRLP4 52
+INDIRI4
+CNSTI4 64
+LTI4 $2794
+LABELV $2796
+ADDRGP4 $2797
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $2769
+JUMPV
+LABELV $2794
+ADDRLP4 0
+CNSTI4 84
+ADDRLP4 52
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 4524
+ADDRLP4 52
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2802
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $2803
+JUMPV
+LABELV $2802
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2804
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2804
+LABELV $2803
+LABELV $2787
+ADDRGP4 $2786
+JUMPV
+LABELV $2788
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2806
+ADDRGP4 cg+610868
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2807
+JUMPV
+LABELV $2806
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+LABELV $2807
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2810
+ADDRGP4 cg+610872
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2811
+JUMPV
+LABELV $2810
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+LABELV $2811
+ADDRLP4 48
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $2814
+ADDRLP4 52
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $2816
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2814
+LABELV $2769
+endproc CG_ParseSmScores 120 12
+proc CG_ParseScores_Ctf 472 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3865760
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3865760+8
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+20
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+28
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+32
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+36
+ADDRLP4 72
+INDIRI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+40
+ADDRLP4 80
+INDIRI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+44
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+48
+ADDRLP4 96
+INDIRI4
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+52
+ADDRLP4 104
+INDIRI4
+ASGNI4
+CNSTI4 12
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+56
+ADDRLP4 112
+INDIRI4
+ASGNI4
+CNSTI4 13
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+60
+ADDRLP4 120
+INDIRI4
+ASGNI4
+CNSTI4 14
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+64
+ADDRLP4 128
+INDIRI4
+ASGNI4
+CNSTI4 15
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+68
+ADDRLP4 136
+INDIRI4
+ASGNI4
+CNSTI4 16
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+72
+ADDRLP4 144
+INDIRI4
+ASGNI4
+CNSTI4 17
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+76
+ADDRLP4 152
+INDIRI4
+ASGNI4
+CNSTI4 18
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+80
+ADDRLP4 160
+INDIRI4
+ASGNI4
+CNSTI4 19
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+84
+ADDRLP4 168
+INDIRI4
+ASGNI4
+CNSTI4 20
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+88
+ADDRLP4 176
+INDIRI4
+ASGNI4
+CNSTI4 21
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+92
+ADDRLP4 184
+INDIRI4
+ASGNI4
+CNSTI4 22
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+96
+ADDRLP4 192
+INDIRI4
+ASGNI4
+CNSTI4 23
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+100
+ADDRLP4 200
+INDIRI4
+ASGNI4
+CNSTI4 24
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+104
+ADDRLP4 208
+INDIRI4
+ASGNI4
+CNSTI4 25
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+108
+ADDRLP4 216
+INDIRI4
+ASGNI4
+CNSTI4 26
+ARGI4
+ADDRLP4 220
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+112
+ADDRLP4 224
+INDIRI4
+ASGNI4
+CNSTI4 27
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+116
+ADDRLP4 232
+INDIRI4
+ASGNI4
+CNSTI4 28
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+120
+ADDRLP4 240
+INDIRI4
+ASGNI4
+CNSTI4 29
+ARGI4
+ADDRLP4 244
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+124
+ADDRLP4 248
+INDIRI4
+ASGNI4
+CNSTI4 30
+ARGI4
+ADDRLP4 252
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+128
+ADDRLP4 256
+INDIRI4
+ASGNI4
+CNSTI4 31
+ARGI4
+ADDRLP4 260
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+132
+ADDRLP4 264
+INDIRI4
+ASGNI4
+CNSTI4 32
+ARGI4
+ADDRLP4 268
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+136
+ADDRLP4 272
+INDIRI4
+ASGNI4
+CNSTI4 33
+ARGI4
+ADDRLP4 276
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+140
+ADDRLP4 280
+INDIRI4
+ASGNI4
+CNSTI4 34
+ARGI4
+ADDRLP4 284
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+144
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 35
+ASGNI4
+ADDRGP4 cg+3865760+152
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5120
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 292
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3865760+148
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 300
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 19
+ADDRGP4 cg+3865760+148
+INDIRI4
+MULI4
+CNSTI4 36
+ADDI4
+GTI4 $2902
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2897
+LABELV $2902
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 312
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860+4
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2897
+ADDRGP4 cg+610844
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610848
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2909
+JUMPV
+LABELV $2908
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2911
+ADDRGP4 $2910
+JUMPV
+LABELV $2911
+ADDRLP4 308
+CNSTI4 92
+ADDRGP4 cg+610844
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 320
+ADDRGP4 cg+610844
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ADDRLP4 320
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 312
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+LTI4 $2918
+ADDRLP4 312
+INDIRI4
+CNSTI4 64
+LTI4 $2916
+LABELV $2918
+ADDRGP4 $2919
+ARGP4
+ADDRLP4 312
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $2817
+JUMPV
+LABELV $2916
+ADDRLP4 304
+CNSTI4 80
+ADDRLP4 312
+INDIRI4
+MULI4
+ADDRGP4 cg+3865760+152
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 340
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_useScoresUpdateTeam+12
+INDIRI4
+CNSTI4 0
+EQI4 $2922
+CNSTI4 4524
+ADDRLP4 312
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2160
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2925
+CNSTI4 4524
+ADDRLP4 312
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2925
+LABELV $2922
+ADDRLP4 348
+ADDRLP4 304
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 1
+EQI4 $2933
+ADDRLP4 348
+INDIRI4
+CNSTI4 2
+NEI4 $2931
+LABELV $2933
+ADDRLP4 304
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2932
+JUMPV
+LABELV $2931
+ADDRLP4 304
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $2932
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $2934
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 352
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2934
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 352
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 360
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 368
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRLP4 372
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 376
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+ARGP4
+ADDRLP4 380
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 384
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 384
+INDIRP4
+ARGP4
+ADDRLP4 388
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $2937
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 392
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ARGP4
+ADDRLP4 396
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2937
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 392
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ARGP4
+ADDRLP4 396
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 400
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 400
+INDIRP4
+ARGP4
+ADDRLP4 404
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 408
+INDIRP4
+ARGP4
+ADDRLP4 412
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 416
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 416
+INDIRP4
+ARGP4
+ADDRLP4 420
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 424
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 424
+INDIRP4
+ARGP4
+ADDRLP4 428
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 432
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 432
+INDIRP4
+ARGP4
+ADDRLP4 436
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 440
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 440
+INDIRP4
+ARGP4
+ADDRLP4 444
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 448
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 448
+INDIRP4
+ARGP4
+ADDRLP4 452
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 456
+INDIRP4
+ARGP4
+ADDRLP4 460
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 464
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 464
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2940
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $2941
+JUMPV
+LABELV $2940
+ADDRLP4 304
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2942
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 304
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2942
+LABELV $2941
+LABELV $2909
+ADDRGP4 $2908
+JUMPV
+LABELV $2910
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2944
+ADDRGP4 cg+610868
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2945
+JUMPV
+LABELV $2944
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+LABELV $2945
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2948
+ADDRGP4 cg+610872
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $2949
+JUMPV
+LABELV $2948
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+LABELV $2949
+ADDRLP4 304
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $2952
+ADDRLP4 308
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $2954
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2952
+LABELV $2817
+endproc CG_ParseScores_Ctf 472 12
+proc CG_ParseScores_Rr 220 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610848
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+610852
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610844
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 cg+610844
+INDIRI4
+CNSTI4 64
+LEI4 $2959
+ADDRGP4 $2962
+ARGP4
+ADDRGP4 cg+610844
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+610844
+CNSTI4 64
+ASGNI4
+LABELV $2959
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2965
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+616764
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2966
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2965
+CNSTI4 2
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860+4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2980
+JUMPV
+LABELV $2977
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LTI4 $2984
+ADDRLP4 52
+INDIRI4
+CNSTI4 64
+LTI4 $2982
+LABELV $2984
+ADDRGP4 $2985
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $2955
+JUMPV
+LABELV $2982
+ADDRLP4 48
+CNSTI4 92
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 56
+CNSTI4 4524
+ADDRLP4 52
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 4504
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+616764
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $2989
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2989
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2992
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2992
+ADDRLP4 48
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2995
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $2996
+JUMPV
+LABELV $2995
+ADDRLP4 48
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2997
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2997
+LABELV $2996
+LABELV $2978
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2980
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $2977
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2999
+ADDRGP4 cg+610868
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $3000
+JUMPV
+LABELV $2999
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+LABELV $3000
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3003
+ADDRGP4 cg+610872
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $3004
+JUMPV
+LABELV $3003
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+LABELV $3004
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_SetScoreSelection
+CALLV
+pop
+ADDRLP4 48
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $3007
+ADDRLP4 52
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $3009
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $3007
+LABELV $2955
+endproc CG_ParseScores_Rr 220 12
+proc CG_ParseScores_Race 68 12
+ADDRGP4 cg+610848
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+610852
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610844
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+610844
+INDIRI4
+CNSTI4 64
+LEI4 $3014
+ADDRGP4 $3017
+ARGP4
+ADDRGP4 cg+610844
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+610844
+CNSTI4 64
+ASGNI4
+LABELV $3014
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3020
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+616764
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $3021
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $3020
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3030
+JUMPV
+LABELV $3027
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $3033
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+LTI4 $3031
+LABELV $3033
+ADDRGP4 $3034
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $3010
+JUMPV
+LABELV $3031
+ADDRLP4 16
+CNSTI4 92
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 4524
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $3037
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3037
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4504
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+616764
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3028
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3030
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3027
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_SetScoreSelection
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $3041
+LABELV $3041
+LABELV $3010
+endproc CG_ParseScores_Race 68 12
+proc CG_ParseScores_Ft 416 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3856416
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3856416+8
+CNSTI4 3
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+20
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+28
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+32
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+36
+ADDRLP4 72
+INDIRI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+40
+ADDRLP4 80
+INDIRI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+44
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+48
+ADDRLP4 96
+INDIRI4
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+52
+ADDRLP4 104
+INDIRI4
+ASGNI4
+CNSTI4 12
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+56
+ADDRLP4 112
+INDIRI4
+ASGNI4
+CNSTI4 13
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+60
+ADDRLP4 120
+INDIRI4
+ASGNI4
+CNSTI4 14
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+64
+ADDRLP4 128
+INDIRI4
+ASGNI4
+CNSTI4 15
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+68
+ADDRLP4 136
+INDIRI4
+ASGNI4
+CNSTI4 16
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+72
+ADDRLP4 144
+INDIRI4
+ASGNI4
+CNSTI4 17
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+76
+ADDRLP4 152
+INDIRI4
+ASGNI4
+CNSTI4 18
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+80
+ADDRLP4 160
+INDIRI4
+ASGNI4
+CNSTI4 19
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+84
+ADDRLP4 168
+INDIRI4
+ASGNI4
+CNSTI4 20
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+88
+ADDRLP4 176
+INDIRI4
+ASGNI4
+CNSTI4 21
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+92
+ADDRLP4 184
+INDIRI4
+ASGNI4
+CNSTI4 22
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+96
+ADDRLP4 192
+INDIRI4
+ASGNI4
+CNSTI4 23
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+100
+ADDRLP4 200
+INDIRI4
+ASGNI4
+CNSTI4 24
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+104
+ADDRLP4 208
+INDIRI4
+ASGNI4
+CNSTI4 25
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+108
+ADDRLP4 216
+INDIRI4
+ASGNI4
+CNSTI4 26
+ARGI4
+ADDRLP4 220
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+112
+ADDRLP4 224
+INDIRI4
+ASGNI4
+CNSTI4 27
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+116
+ADDRLP4 232
+INDIRI4
+ASGNI4
+CNSTI4 28
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+120
+ADDRLP4 240
+INDIRI4
+ASGNI4
+CNSTI4 29
+ARGI4
+ADDRLP4 244
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3856416+124
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 30
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 252
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+610860+4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3105
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3856416+128
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5376
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+610844
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3118
+JUMPV
+LABELV $3117
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3120
+ADDRGP4 $3119
+JUMPV
+LABELV $3120
+ADDRLP4 256
+CNSTI4 92
+ADDRGP4 cg+610844
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+ASGNP4
+ADDRLP4 272
+ADDRGP4 cg+610844
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 276
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+LTI4 $3127
+ADDRLP4 260
+INDIRI4
+CNSTI4 64
+LTI4 $3125
+LABELV $3127
+ADDRGP4 $3128
+ARGP4
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $3043
+JUMPV
+LABELV $3125
+ADDRLP4 256
+INDIRP4
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg_useScoresUpdateTeam+12
+INDIRI4
+CNSTI4 0
+EQI4 $3129
+CNSTI4 4524
+ADDRLP4 260
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2160
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3132
+CNSTI4 4524
+ADDRLP4 260
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+LABELV $3132
+LABELV $3129
+ADDRLP4 252
+CNSTI4 84
+ADDRLP4 260
+INDIRI4
+MULI4
+ADDRGP4 cg+3856416+128
+ADDP4
+ASGNP4
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+EQI4 $3142
+ADDRLP4 264
+INDIRI4
+CNSTI4 2
+NEI4 $3140
+LABELV $3142
+ADDRLP4 252
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3141
+JUMPV
+LABELV $3140
+ADDRLP4 252
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $3141
+ADDRLP4 252
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $3143
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3143
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 252
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 252
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 252
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 252
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 332
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 332
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 252
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 340
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 252
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 348
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 252
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 356
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRLP4 360
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 252
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 364
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 364
+INDIRP4
+ARGP4
+ADDRLP4 368
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 252
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 372
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 376
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 252
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 380
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 380
+INDIRP4
+ARGP4
+ADDRLP4 384
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 388
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 388
+INDIRP4
+ARGP4
+ADDRLP4 392
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRLP4 396
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 396
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 396
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 400
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 400
+INDIRP4
+ARGP4
+ADDRLP4 404
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 408
+INDIRP4
+ARGP4
+ADDRLP4 412
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 252
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $3146
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $3147
+JUMPV
+LABELV $3146
+ADDRLP4 252
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3148
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 252
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $3148
+LABELV $3147
+LABELV $3118
+ADDRGP4 $3117
+JUMPV
+LABELV $3119
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3150
+ADDRGP4 cg+610868
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $3151
+JUMPV
+LABELV $3150
+ADDRGP4 cg+610868
+CNSTI4 0
+ASGNI4
+LABELV $3151
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $3154
+ADDRGP4 cg+610872
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $3155
+JUMPV
+LABELV $3154
+ADDRGP4 cg+610872
+CNSTI4 0
+ASGNI4
+LABELV $3155
+ADDRLP4 252
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $3158
+ADDRLP4 256
+ADDRGP4 CG_Argc
+CALLI4
+ASGNI4
+ADDRGP4 $3160
+ARGP4
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $3158
+LABELV $3043
+endproc CG_ParseScores_Ft 416 12
+data
+align 4
+LABELV $3162
+byte 4 -1
+align 4
+LABELV $3163
+byte 4 -1
+align 4
+LABELV $3164
+byte 4 0
+code
+proc CG_ParseDScores 208 4
+ADDRGP4 CG_SetDuelPlayers
+CALLV
+pop
+ADDRGP4 cg+3848204
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3848200
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+3848208
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $3172
+ADDRGP4 cg+3848212
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $3168
+LABELV $3172
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $3177
+ADDRGP4 cg+627388
+INDIRI4
+CNSTI4 0
+NEI4 $3173
+LABELV $3177
+ADDRGP4 $3164
+INDIRI4
+CNSTI4 0
+EQI4 $3173
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3162
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $3173
+ADDRGP4 $3163
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $3173
+ADDRGP4 cg+3848208
+ADDRGP4 $3162
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3848212
+ADDRGP4 $3163
+INDIRI4
+ASGNI4
+ADDRGP4 $3161
+JUMPV
+LABELV $3173
+LABELV $3168
+ADDRGP4 $3162
+ADDRGP4 cg+3848208
+INDIRI4
+ASGNI4
+ADDRGP4 $3163
+ADDRGP4 cg+3848212
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3164
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $3182
+ADDRLP4 24
+CNSTI4 5088
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+3196932
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4532
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4540
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4544
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4548
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4556
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4564
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4560
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4568
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 92
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 92
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 92
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4576
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4580
+ADDP4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4584
+ADDP4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4588
+ADDP4
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4592
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4596
+ADDP4
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4600
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4604
+ADDP4
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 160
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 160
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRGP4 $3190
+JUMPV
+LABELV $3187
+ADDRLP4 164
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4608
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3188
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3190
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $3187
+LABELV $3183
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LTI4 $3182
+ADDRGP4 cg+3848208
+INDIRI4
+CNSTI4 -1
+EQI4 $3191
+ADDRGP4 cg+3196932
+ADDRGP4 cg+3848208
+INDIRI4
+ASGNI4
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3196
+ADDRGP4 cg+3196932+4
+CNSTI4 4524
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRB
+ASGNB 4524
+LABELV $3196
+LABELV $3191
+ADDRGP4 cg+3848212
+INDIRI4
+CNSTI4 -1
+EQI4 $3204
+ADDRGP4 cg+3196932+5088
+ADDRGP4 cg+3848212
+INDIRI4
+ASGNI4
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3210
+ADDRGP4 cg+3196932+5088+4
+CNSTI4 4524
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRB
+ASGNB 4524
+LABELV $3210
+LABELV $3204
+LABELV $3161
+endproc CG_ParseDScores 208 4
+proc CG_RaceInit 8 0
+ADDRLP4 0
+ADDRGP4 cg+607704+900
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $3222
+ADDRLP4 0
+CNSTI4 1496
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+900
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $3223
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $3222
+LABELV $3219
+endproc CG_RaceInit 8 0
+proc CG_ServerCommand 592 20
+CNSTI4 0
+ARGI4
+ADDRLP4 416
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 416
+INDIRP4
+ASGNP4
+ADDRGP4 cg_debugServerCommands+12
+INDIRI4
+CNSTI4 1
+NEI4 $3228
+ADDRGP4 $3231
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3233
+JUMPV
+LABELV $3232
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 420
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 420
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3235
+ADDRGP4 $3234
+JUMPV
+LABELV $3235
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 424
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $3237
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 424
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3233
+ADDRGP4 $3232
+JUMPV
+LABELV $3234
+LABELV $3228
+CNSTI4 0
+ARGI4
+ADDRLP4 420
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 420
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3238
+ADDRGP4 $3227
+JUMPV
+LABELV $3238
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3242
+ARGP4
+ADDRLP4 424
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+CNSTI4 0
+NEI4 $3240
+ADDRGP4 $3227
+JUMPV
+LABELV $3240
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3245
+ARGP4
+ADDRLP4 428
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+NEI4 $3243
+ADDRGP4 $3227
+JUMPV
+LABELV $3243
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3248
+ARGP4
+ADDRLP4 432
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 432
+INDIRI4
+CNSTI4 0
+NEI4 $3246
+ADDRGP4 cg_serverCenterPrint+12
+INDIRI4
+CNSTI4 0
+EQI4 $3249
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 436
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $3249
+ADDRGP4 cg_serverCenterPrintToChat+12
+INDIRI4
+CNSTI4 0
+EQI4 $3252
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $2360
+ARGP4
+ADDRLP4 436
+INDIRP4
+ARGP4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+LABELV $3252
+ADDRGP4 cg_serverCenterPrintToConsole+12
+INDIRI4
+CNSTI4 0
+EQI4 $3227
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $2360
+ARGP4
+ADDRLP4 436
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3246
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3260
+ARGP4
+ADDRLP4 436
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+NEI4 $3258
+ADDRGP4 CG_ConfigStringModified
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3258
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3263
+ARGP4
+ADDRLP4 440
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 440
+INDIRI4
+CNSTI4 0
+NEI4 $3261
+ADDRGP4 cg_serverPrint+12
+INDIRI4
+CNSTI4 0
+EQI4 $3264
+CNSTI4 1
+ARGI4
+ADDRLP4 444
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 444
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $3264
+ADDRGP4 cg_serverPrintToChat+12
+INDIRI4
+CNSTI4 0
+EQI4 $3267
+CNSTI4 1
+ARGI4
+ADDRLP4 444
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $2360
+ARGP4
+ADDRLP4 444
+INDIRP4
+ARGP4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+LABELV $3267
+ADDRGP4 cg_serverPrintToConsole+12
+INDIRI4
+CNSTI4 0
+EQI4 $3270
+CNSTI4 1
+ARGI4
+ADDRLP4 444
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $2360
+ARGP4
+ADDRLP4 444
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $3270
+CNSTI4 1
+ARGI4
+ADDRLP4 444
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 444
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3275
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRLP4 448
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 452
+CNSTI4 0
+ASGNI4
+ADDRLP4 448
+INDIRI4
+ADDRLP4 452
+INDIRI4
+NEI4 $3273
+ADDRGP4 cg_audioAnnouncerVote+12
+INDIRI4
+ADDRLP4 452
+INDIRI4
+EQI4 $3273
+ADDRGP4 cgs+632912+493224
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3273
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3281
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRLP4 456
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 460
+CNSTI4 0
+ASGNI4
+ADDRLP4 456
+INDIRI4
+ADDRLP4 460
+INDIRI4
+NEI4 $3279
+ADDRGP4 cg_audioAnnouncerTeamVote+12
+INDIRI4
+ADDRLP4 460
+INDIRI4
+EQI4 $3279
+ADDRGP4 cgs+632912+493224
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3279
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3287
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRLP4 464
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 468
+CNSTI4 0
+ASGNI4
+ADDRLP4 464
+INDIRI4
+ADDRLP4 468
+INDIRI4
+NEI4 $3285
+ADDRGP4 cg_audioAnnouncerVote+12
+INDIRI4
+ADDRLP4 468
+INDIRI4
+EQI4 $3285
+ADDRGP4 cgs+632912+493220
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3285
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3293
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRLP4 472
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 476
+CNSTI4 0
+ASGNI4
+ADDRLP4 472
+INDIRI4
+ADDRLP4 476
+INDIRI4
+NEI4 $3291
+ADDRGP4 cg_audioAnnouncerTeamVote+12
+INDIRI4
+ADDRLP4 476
+INDIRI4
+EQI4 $3291
+ADDRGP4 cgs+632912+493220
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3291
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $3227
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $3227
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3301
+ARGP4
+CNSTI4 23
+ARGI4
+ADDRLP4 480
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $3227
+ADDRGP4 $3302
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+3848216
+CNSTI4 1
+ASGNI4
+ADDRLP4 484
+CNSTI4 4524
+ASGNI4
+ADDRLP4 488
+CNSTI4 0
+ASGNI4
+ADDRLP4 484
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+ADDRLP4 488
+INDIRI4
+EQI4 $3311
+ADDRLP4 484
+INDIRI4
+ADDRGP4 cg+3848208
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 488
+INDIRI4
+EQI4 $3304
+LABELV $3311
+ADDRGP4 cg+3848220
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3227
+JUMPV
+LABELV $3304
+ADDRLP4 492
+CNSTI4 4524
+ASGNI4
+ADDRLP4 496
+CNSTI4 0
+ASGNI4
+ADDRLP4 492
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+ADDRLP4 496
+INDIRI4
+EQI4 $3320
+ADDRLP4 492
+INDIRI4
+ADDRGP4 cg+3848212
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRLP4 496
+INDIRI4
+EQI4 $3313
+LABELV $3320
+ADDRGP4 cg+3848220
+CNSTI4 2
+ASGNI4
+ADDRGP4 $3227
+JUMPV
+LABELV $3313
+ADDRGP4 $3322
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3261
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3325
+ARGP4
+ADDRLP4 444
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 444
+INDIRI4
+CNSTI4 0
+NEI4 $3323
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 448
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 452
+CNSTI4 0
+ASGNI4
+ADDRLP4 448
+INDIRI4
+ADDRLP4 452
+INDIRI4
+EQI4 $3326
+ADDRGP4 cg_teamChatsOnly+12
+INDIRI4
+ADDRLP4 452
+INDIRI4
+EQI4 $3326
+ADDRGP4 $3227
+JUMPV
+LABELV $3326
+ADDRGP4 cg_chatBeep+12
+INDIRI4
+CNSTI4 0
+EQI4 $3330
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+711644
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRGP4 cg_chatBeepMaxTime+8
+INDIRF4
+MULF4
+LTF4 $3333
+ADDRGP4 cgs+632912+492992
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+711644
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $3333
+LABELV $3330
+CNSTI4 1
+ARGI4
+ADDRLP4 456
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 456
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 264
+ARGP4
+ADDRGP4 CG_RemoveChatEscapeChar
+CALLV
+pop
+ADDRGP4 $2356
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $2360
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3323
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3344
+ARGP4
+ADDRLP4 448
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 448
+INDIRI4
+CNSTI4 0
+NEI4 $3342
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRGP4 cg+4
+INDIRI4
+EQI4 $3345
+ADDRGP4 cg_chatBeep+12
+INDIRI4
+CNSTI4 0
+EQI4 $3346
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+711644
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRGP4 cg_chatBeepMaxTime+8
+INDIRF4
+MULF4
+LTF4 $3346
+ADDRGP4 cgs+632912+492992
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+711644
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $3346
+JUMPV
+LABELV $3345
+ADDRGP4 cg_teamChatBeep+12
+INDIRI4
+CNSTI4 0
+EQI4 $3361
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+711648
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRGP4 cg_teamChatBeepMaxTime+8
+INDIRF4
+MULF4
+LTF4 $3364
+ADDRGP4 cgs+632912+492992
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+711648
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $3364
+LABELV $3361
+LABELV $3346
+CNSTI4 1
+ARGI4
+ADDRLP4 452
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 452
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 264
+ARGP4
+ADDRGP4 CG_RemoveChatEscapeChar
+CALLV
+pop
+ADDRGP4 cgs+1957780
+INDIRI4
+CNSTI4 0
+EQI4 $3373
+ADDRLP4 264
+ARGP4
+ADDRGP4 CG_FilterOspTeamChatLocation
+CALLV
+pop
+LABELV $3373
+ADDRLP4 264
+ARGP4
+ADDRGP4 CG_AddToTeamChat
+CALLV
+pop
+ADDRGP4 $2356
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $2360
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3342
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3378
+ARGP4
+ADDRLP4 452
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 0
+NEI4 $3376
+ADDRGP4 CG_ParseScores
+CALLV
+pop
+ADDRGP4 Wolfcam_ScoreData
+CALLV
+pop
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3376
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3381
+ARGP4
+ADDRLP4 456
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+NEI4 $3379
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $3382
+ADDRGP4 CG_ParseTeamInfo_91
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3382
+ADDRGP4 CG_ParseTeamInfo
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3379
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3387
+ARGP4
+ADDRLP4 460
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 0
+NEI4 $3385
+ADDRGP4 CG_MapRestart
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3385
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3390
+ARGP4
+ADDRLP4 464
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+CNSTI4 0
+NEI4 $3388
+ADDRLP4 468
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 4
+NEI4 $3391
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $3393
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 472
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRLP4 8-64
+ADDP4
+ARGP4
+ADDRLP4 472
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $3394
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $3393
+ADDRLP4 8
+ARGP4
+ADDRLP4 8+64
+ARGP4
+ADDRLP4 8+128
+ARGP4
+ADDRLP4 472
+CNSTI4 0
+ASGNI4
+ADDRLP4 472
+INDIRI4
+ARGI4
+ADDRLP4 472
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+LABELV $3391
+LABELV $3388
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3403
+ARGP4
+ADDRLP4 468
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $3401
+ADDRGP4 $3404
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3401
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3407
+ARGP4
+ADDRLP4 472
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+NEI4 $3405
+ADDRGP4 cg+16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3227
+JUMPV
+LABELV $3405
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $3409
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3414
+ARGP4
+ADDRLP4 476
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+NEI4 $3412
+CNSTI4 0
+ARGI4
+ADDRLP4 480
+ADDRGP4 CG_CpmaParseMstats
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $3415
+ADDRGP4 $3227
+JUMPV
+LABELV $3415
+LABELV $3412
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3419
+ARGP4
+ADDRLP4 480
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $3417
+CNSTI4 1
+ARGI4
+ADDRLP4 484
+ADDRGP4 CG_CpmaParseMstats
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $3420
+ADDRGP4 $3227
+JUMPV
+LABELV $3420
+LABELV $3417
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3424
+ARGP4
+ADDRLP4 484
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+NEI4 $3422
+ADDRLP4 488
+ADDRGP4 CG_CpmaParseDmscores
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+EQI4 $3425
+ADDRGP4 $3227
+JUMPV
+LABELV $3425
+LABELV $3422
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3429
+ARGP4
+ADDRLP4 488
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+NEI4 $3427
+ADDRLP4 492
+ADDRGP4 CG_CpmaMM2
+CALLI4
+ASGNI4
+ADDRLP4 492
+INDIRI4
+CNSTI4 0
+EQI4 $3430
+ADDRGP4 $3227
+JUMPV
+LABELV $3430
+LABELV $3427
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3434
+ARGP4
+ADDRLP4 492
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 492
+INDIRI4
+CNSTI4 0
+NEI4 $3432
+ADDRLP4 496
+ADDRGP4 CG_CpmaXscores
+CALLI4
+ASGNI4
+ADDRLP4 496
+INDIRI4
+CNSTI4 0
+EQI4 $3435
+ADDRGP4 Wolfcam_ScoreData
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3435
+LABELV $3432
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3439
+ARGP4
+ADDRLP4 496
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 496
+INDIRI4
+CNSTI4 0
+NEI4 $3437
+ADDRGP4 $3227
+JUMPV
+LABELV $3437
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3442
+ARGP4
+ADDRLP4 500
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+NEI4 $3440
+ADDRLP4 504
+ADDRGP4 CG_CpmaParseDuelEndScores
+CALLI4
+ASGNI4
+ADDRLP4 504
+INDIRI4
+CNSTI4 0
+EQI4 $3443
+ADDRGP4 $3227
+JUMPV
+LABELV $3443
+LABELV $3440
+LABELV $3409
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $3445
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3450
+ARGP4
+ADDRLP4 476
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+NEI4 $3448
+ADDRGP4 cg_ignoreServerPlaySound+12
+INDIRI4
+CNSTI4 0
+NEI4 $3227
+CNSTI4 1
+ARGI4
+ADDRLP4 480
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $3454
+ARGP4
+ADDRLP4 480
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 484
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3448
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3457
+ARGP4
+ADDRLP4 480
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $3455
+ADDRGP4 cg_teamChatsOnly+12
+INDIRI4
+CNSTI4 0
+NEI4 $3227
+ADDRGP4 cg_chatBeep+12
+INDIRI4
+CNSTI4 0
+EQI4 $3461
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+711644
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRGP4 cg_chatBeepMaxTime+8
+INDIRF4
+MULF4
+LTF4 $3464
+ADDRGP4 cgs+632912+492992
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+711644
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $3464
+LABELV $3461
+CNSTI4 1
+ARGI4
+ADDRLP4 484
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 484
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2356
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $2360
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3455
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3475
+ARGP4
+ADDRLP4 484
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+NEI4 $3473
+ADDRGP4 CG_ParseScores_Duel
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3473
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3478
+ARGP4
+ADDRLP4 488
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+NEI4 $3476
+ADDRGP4 CG_ParseScores_Tdm
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3476
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3481
+ARGP4
+ADDRLP4 492
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 492
+INDIRI4
+CNSTI4 0
+NEI4 $3479
+ADDRGP4 CG_ParseScores_Ca
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3479
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3484
+ARGP4
+ADDRLP4 496
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 496
+INDIRI4
+CNSTI4 0
+NEI4 $3482
+ADDRGP4 CG_ParseScores_Ctf
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3482
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3487
+ARGP4
+ADDRLP4 500
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+NEI4 $3485
+ADDRGP4 CG_ParseScores_Rr
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3485
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3490
+ARGP4
+ADDRLP4 504
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 504
+INDIRI4
+CNSTI4 0
+NEI4 $3488
+ADDRGP4 CG_ParseScores_Race
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3488
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3493
+ARGP4
+ADDRLP4 508
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+NEI4 $3491
+ADDRGP4 CG_ParseScores_Ft
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3491
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3496
+ARGP4
+ADDRLP4 512
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+NEI4 $3494
+ADDRGP4 CG_ParseScores_Ffa
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3494
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3499
+ARGP4
+ADDRLP4 516
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $3497
+ADDRGP4 CG_ParseDScores
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3497
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3502
+ARGP4
+ADDRLP4 520
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $3500
+ADDRGP4 CG_ParseCaScores
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3500
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3505
+ARGP4
+ADDRLP4 524
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+NEI4 $3503
+ADDRGP4 CG_ParseCaStats
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3503
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3508
+ARGP4
+ADDRLP4 528
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $3506
+ADDRGP4 CG_ParseTdmScores
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3506
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3511
+ARGP4
+ADDRLP4 532
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 532
+INDIRI4
+CNSTI4 0
+NEI4 $3509
+ADDRGP4 CG_ParseTdmStats
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3509
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3514
+ARGP4
+ADDRLP4 536
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 536
+INDIRI4
+CNSTI4 0
+NEI4 $3512
+ADDRGP4 CG_ParseTdmScores2
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3512
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3517
+ARGP4
+ADDRLP4 540
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 540
+INDIRI4
+CNSTI4 0
+NEI4 $3515
+ADDRGP4 CG_ParseCtfScores
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3515
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3520
+ARGP4
+ADDRLP4 544
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 544
+INDIRI4
+CNSTI4 0
+NEI4 $3518
+ADDRGP4 CG_ParseCtfStats
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3518
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3523
+ARGP4
+ADDRLP4 548
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+NEI4 $3521
+ADDRGP4 CG_ParseRRScores
+CALLV
+pop
+ADDRGP4 Wolfcam_ScoreData
+CALLV
+pop
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3521
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3526
+ARGP4
+ADDRLP4 552
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 0
+EQI4 $3528
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3527
+ARGP4
+ADDRLP4 556
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 0
+NEI4 $3524
+LABELV $3528
+ADDRGP4 CG_ParseCtfsRoundScores
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3524
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3531
+ARGP4
+ADDRLP4 560
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 0
+NEI4 $3529
+ADDRGP4 CG_ParseSmScores
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3529
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3534
+ARGP4
+ADDRLP4 564
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 564
+INDIRI4
+CNSTI4 0
+NEI4 $3532
+CNSTI4 1
+ARGI4
+ADDRLP4 568
+ADDRGP4 CG_ArgsFrom
+CALLP4
+ASGNP4
+ADDRGP4 $3535
+ARGP4
+ADDRLP4 568
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3532
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3538
+ARGP4
+ADDRLP4 568
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 568
+INDIRI4
+CNSTI4 0
+NEI4 $3536
+ADDRGP4 cg+1332836
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332840
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 576
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+ASGNI4
+ADDRLP4 572
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3546
+JUMPV
+LABELV $3543
+ADDRLP4 572
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 584
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 584
+INDIRP4
+ARGP4
+ADDRLP4 588
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+1332844
+ADDP4
+ADDRLP4 588
+INDIRI4
+ASGNI4
+LABELV $3544
+ADDRLP4 572
+ADDRLP4 572
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3546
+ADDRLP4 572
+INDIRI4
+ADDRLP4 576
+INDIRI4
+LTI4 $3543
+ADDRGP4 $3227
+JUMPV
+LABELV $3536
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3550
+ARGP4
+ADDRLP4 572
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+CNSTI4 0
+NEI4 $3548
+ADDRGP4 cgs+632912+492632
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg_serverCenterPrint+12
+INDIRI4
+CNSTI4 0
+EQI4 $3553
+CNSTI4 1
+ARGI4
+ADDRLP4 576
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 576
+INDIRP4
+ARGP4
+CNSTF4 1125122048
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $3553
+ADDRGP4 cg_serverCenterPrintToChat+12
+INDIRI4
+CNSTI4 0
+EQI4 $3556
+CNSTI4 1
+ARGI4
+ADDRLP4 576
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $2360
+ARGP4
+ADDRLP4 576
+INDIRP4
+ARGP4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+LABELV $3556
+ADDRGP4 cg_serverCenterPrintToConsole+12
+INDIRI4
+CNSTI4 0
+EQI4 $3559
+CNSTI4 1
+ARGI4
+ADDRLP4 576
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $2360
+ARGP4
+ADDRLP4 576
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $3559
+ADDRGP4 CG_ResetTimedItemPickupTimes
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3548
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3564
+ARGP4
+ADDRLP4 576
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 576
+INDIRI4
+CNSTI4 0
+NEI4 $3562
+ADDRGP4 CG_RaceInit
+CALLV
+pop
+ADDRGP4 $3227
+JUMPV
+LABELV $3562
+LABELV $3445
+CNSTI4 0
+ARGI4
+ADDRLP4 476
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $3565
+ARGP4
+ADDRLP4 476
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cg_debugServerCommands+12
+INDIRI4
+CNSTI4 2
+NEI4 $3566
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3570
+JUMPV
+LABELV $3569
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 480
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 480
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3572
+ADDRGP4 $3571
+JUMPV
+LABELV $3572
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 484
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $3237
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 484
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3570
+ADDRGP4 $3569
+JUMPV
+LABELV $3571
+LABELV $3566
+LABELV $3227
+endproc CG_ServerCommand 592 20
+export CG_ExecuteNewServerCommands
+proc CG_ExecuteNewServerCommands 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $3576
+JUMPV
+LABELV $3575
+ADDRLP4 0
+ADDRGP4 cgs+39676
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_GetServerCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $3579
+ADDRGP4 CG_ServerCommand
+CALLV
+pop
+LABELV $3579
+LABELV $3576
+ADDRGP4 cgs+39676
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LTI4 $3575
+LABELV $3574
+endproc CG_ExecuteNewServerCommands 12 4
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import Wolfcam_ScoreData
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import CG_DrawActiveFrame
+import CG_AdjustOriginToAvoidSolid
+import CG_CalcSpline
+import CG_AddBufferedSound
+import CG_AdjustedFov
+import CG_CalcZoom
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_CalcVrect
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_AddRealLoopingSound
+import CG_AddLoopingSound
+import CG_StartLocalSound
+import CG_StartSound
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_NewParticleArea
+import CG_ParticleExplosion
+import CG_AddParticles
+import CG_ClearParticles
+import CG_AddMarks
+import CG_ImpactMark
+import CG_InitMarkPolys
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_ShutdownLocalEnts
+import CG_GetStoredScriptVarsFromLE
+import CG_RunFxAll
+import CG_SmokePuff_ql
+import CG_AddRefEntityFX
+import CG_AddRefEntity
+import CG_ListLocalEntities
+import CG_RemoveFXLocalEntities
+import CG_ClearLocalFrameEntities
+import CG_CullGrid
+import CG_AddToCullGrid
+import CG_BeginCullGrid
+import CG_AddLocalEntities
+import CG_MakeLowPriorityEntity
+import CG_AllocLocalEntityRealTime
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import FxLoopSounds
+import CG_FreeFxJitTokens
+import CG_ResetFXIntervalAndDistance
+import CG_UpdatePositionData
+import CG_CopyPositionDataToScript
+import CG_CopyPositionDataToCent
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+import CG_CopyPlayerDataToScriptData
+import CG_ResetScriptVars
+import CG_ReloadQ3mmeScripts
+import CG_RunQ3mmeScript
+import CG_Q3mmeMath
+import EffectScripts
+import PlainScript
+import DistanceScript
+import EmitterScript
+import EmitterScriptVars
+import ScriptVars
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_StartidCamera
+import CG_ChangeConfigString
+import CG_CleanUpFieldNumber
+import CG_EchoPopup
+import CG_ErrorPopup
+import CG_AdjustTimeForTimeouts
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $3565
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3564
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $3550
+byte 1 112
+byte 1 99
+byte 1 112
+byte 1 0
+align 1
+LABELV $3538
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 0
+align 1
+LABELV $3535
+byte 1 94
+byte 1 51
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3534
+byte 1 114
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 0
+align 1
+LABELV $3531
+byte 1 115
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3527
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $3526
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3523
+byte 1 114
+byte 1 114
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3520
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $3517
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3514
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $3511
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $3508
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3505
+byte 1 99
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $3502
+byte 1 99
+byte 1 97
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3499
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3496
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $3493
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $3490
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $3487
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 114
+byte 1 0
+align 1
+LABELV $3484
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $3481
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 0
+align 1
+LABELV $3478
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 0
+align 1
+LABELV $3475
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $3457
+byte 1 98
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $3454
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3450
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $3442
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3439
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $3434
+byte 1 120
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3429
+byte 1 109
+byte 1 109
+byte 1 50
+byte 1 0
+align 1
+LABELV $3424
+byte 1 100
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3419
+byte 1 109
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 97
+byte 1 0
+align 1
+LABELV $3414
+byte 1 109
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $3407
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $3404
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3403
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3390
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3387
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $3381
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $3378
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3344
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $3325
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $3322
+byte 1 94
+byte 1 49
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3302
+byte 1 94
+byte 1 53
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $3301
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3293
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3287
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3281
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3275
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3263
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3260
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $3248
+byte 1 99
+byte 1 112
+byte 1 0
+align 1
+LABELV $3245
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $3242
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $3237
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 118
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3231
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3160
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 70
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3128
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 70
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3034
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3017
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 82
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 62
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3009
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 82
+byte 1 114
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2985
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 82
+byte 1 114
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2962
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 82
+byte 1 114
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 62
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $2954
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 67
+byte 1 116
+byte 1 102
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2919
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 67
+byte 1 116
+byte 1 102
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2816
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2797
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2768
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2739
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2704
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 84
+byte 1 100
+byte 1 109
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2672
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 84
+byte 1 100
+byte 1 109
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2581
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 68
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2556
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 68
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2544
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 68
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 50
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $2535
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 70
+byte 1 102
+byte 1 97
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2484
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 70
+byte 1 102
+byte 1 97
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 45
+byte 1 62
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2443
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 70
+byte 1 102
+byte 1 97
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2417
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 70
+byte 1 102
+byte 1 97
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 62
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $2375
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 88
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2360
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2356
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2353
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2352
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 77
+byte 1 50
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2343
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 68
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2335
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 68
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2296
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 99
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $2293
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 99
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 48
+byte 1 120
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $2219
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 77
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2211
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 77
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2187
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2169
+byte 1 71
+byte 1 79
+byte 1 33
+byte 1 0
+align 1
+LABELV $2165
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 33
+byte 1 0
+align 1
+LABELV $2164
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 33
+byte 1 0
+align 1
+LABELV $2051
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2047
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2001
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1756
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 113
+byte 1 51
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1636
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1630
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1629
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1607
+byte 1 94
+byte 1 51
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 10
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1602
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $1570
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1568
+byte 1 118
+byte 1 115
+byte 1 0
+align 1
+LABELV $1566
+byte 1 118
+byte 1 97
+byte 1 0
+align 1
+LABELV $1564
+byte 1 118
+byte 1 102
+byte 1 0
+align 1
+LABELV $1550
+byte 1 118
+byte 1 116
+byte 1 0
+align 1
+LABELV $1534
+byte 1 116
+byte 1 100
+byte 1 0
+align 1
+LABELV $1532
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1529
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $1523
+byte 1 115
+byte 1 108
+byte 1 0
+align 1
+LABELV $1518
+byte 1 94
+byte 1 51
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 112
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1493
+byte 1 116
+byte 1 0
+align 1
+LABELV $1466
+byte 1 112
+byte 1 114
+byte 1 0
+align 1
+LABELV $1464
+byte 1 112
+byte 1 98
+byte 1 0
+align 1
+LABELV $1462
+byte 1 115
+byte 1 98
+byte 1 0
+align 1
+LABELV $1460
+byte 1 115
+byte 1 114
+byte 1 0
+align 1
+LABELV $1392
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1391
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $1377
+byte 1 64
+byte 1 0
+align 1
+LABELV $1374
+byte 1 58
+byte 1 0
+align 1
+LABELV $1371
+byte 1 61
+byte 1 0
+align 1
+LABELV $1311
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1306
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1302
+byte 1 116
+byte 1 119
+byte 1 0
+align 1
+LABELV $1272
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1271
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1267
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1264
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1262
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1260
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $1247
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1228
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1219
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1196
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1195
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1194
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $1144
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1143
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1138
+byte 1 105
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1126
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1122
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1119
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1115
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1081
+byte 1 48
+byte 1 0
+align 1
+LABELV $1078
+byte 1 49
+byte 1 0
+align 1
+LABELV $1077
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1073
+byte 1 112
+byte 1 109
+byte 1 99
+byte 1 0
+align 1
+LABELV $1072
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1071
+byte 1 99
+byte 1 112
+byte 1 109
+byte 1 0
+align 1
+LABELV $1062
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $1059
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1058
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1032
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1031
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1030
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $1028
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1021
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1019
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1017
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1015
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1013
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1011
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1006
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $1004
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 0
+align 1
+LABELV $1003
+byte 1 94
+byte 1 49
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $999
+byte 1 100
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $969
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $949
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $941
+byte 1 98
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $938
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $931
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $930
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $922
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $913
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $906
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $889
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $876
+byte 1 0
+align 1
+LABELV $846
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $790
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $789
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $783
+byte 1 98
+byte 1 49
+byte 1 48
+byte 1 51
+byte 1 50
+byte 1 0
+align 1
+LABELV $776
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $762
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $754
+byte 1 94
+byte 1 51
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 10
+byte 1 0
+align 1
+LABELV $739
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 57
+byte 1 49
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $731
+byte 1 94
+byte 1 51
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 57
+byte 1 49
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 10
+byte 1 0
+align 1
+LABELV $724
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 67
+byte 1 116
+byte 1 102
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $714
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 100
+byte 1 109
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $708
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $703
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 67
+byte 1 116
+byte 1 102
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $689
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 67
+byte 1 116
+byte 1 102
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $608
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 100
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $585
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 100
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $516
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 100
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $496
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 100
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $451
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $446
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $435
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 82
+byte 1 82
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $350
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 82
+byte 1 82
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $327
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 82
+byte 1 82
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 62
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $320
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $269
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 45
+byte 1 62
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $225
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $199
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 62
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $165
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $163
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
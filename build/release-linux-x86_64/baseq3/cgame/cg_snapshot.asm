@@ -0,0 +1,10103 @@
+export CG_ResetEntity
+code
+proc CG_ResetEntity 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_useOriginalInterpolation+12
+INDIRI4
+CNSTI4 0
+NEI4 $157
+LABELV $157
+ADDRFP4 0
+INDIRP4
+CNSTI4 896
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 300
+SUBI4
+GEI4 $160
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $160
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ResetFXIntervalAndDistance
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+ARGP4
+ADDRGP4 CG_UpdatePositionData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 852
+ADDP4
+ARGP4
+ADDRGP4 CG_UpdatePositionData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1460
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $164
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $164
+ADDRGP4 cg_useOriginalInterpolation+12
+INDIRI4
+CNSTI4 0
+NEI4 $166
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ResetPlayerEntity
+CALLV
+pop
+ADDRGP4 $156
+JUMPV
+LABELV $166
+LABELV $164
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $169
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ResetPlayerEntity
+CALLV
+pop
+LABELV $169
+LABELV $156
+endproc CG_ResetEntity 20 8
+proc CG_TransitionEntity 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRB
+ASGNB 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $172
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ResetEntity
+CALLV
+pop
+LABELV $172
+LABELV $173
+ADDRGP4 $176
+ARGP4
+ADDRLP4 4
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $174
+ADDRGP4 CG_Abort
+CALLV
+pop
+LABELV $174
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CheckEvents
+CALLV
+pop
+LABELV $171
+endproc CG_TransitionEntity 8 4
+proc CG_SetInitialSnapshot 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $178
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cgs+1957496
+INDIRI4
+CNSTI4 0
+NEI4 $179
+ADDRGP4 cgs+1957496
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+1957500
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $184
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 121392
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cgs+39676
+ADDRFP4 0
+INDIRP4
+CNSTI4 121392
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $179
+ADDRGP4 cg+44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 121400
+ADDRGP4 wcg+31078456
+INDIRI4
+CNSTI4 256
+MODI4
+MULI4
+ADDRGP4 wcg+56
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 121400
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12
+ADDRGP4 wcg+31078456
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTI4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+CNSTI4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_ResetEntity
+CALLV
+pop
+ADDRGP4 CG_BuildSolidList
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 121392
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ExecuteNewServerCommands
+CALLV
+pop
+ADDRGP4 CG_Respawn
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $190
+ADDRLP4 8
+CNSTI4 236
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1496
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTU4 236
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ResetEntity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CheckEvents
+CALLV
+pop
+LABELV $191
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $193
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $190
+LABELV $177
+endproc CG_SetInitialSnapshot 24 12
+proc SortClients 0 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+SUBI4
+RETI4
+LABELV $196
+endproc SortClients 0 0
+proc CG_TransitionSnapshot 72 16
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $198
+ADDRGP4 $201
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $198
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $202
+ADDRGP4 $205
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $202
+ADDRGP4 cg+6747456
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $207
+LABELV $207
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $214
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+1335112
+INDIRI4
+GEI4 $215
+ADDRGP4 cg+1335112
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $220
+ARGP4
+ADDRLP4 20
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1000
+ADDRLP4 20
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $214
+LABELV $215
+LABELV $210
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $221
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+2376
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $222
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $221
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 121392
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ExecuteNewServerCommands
+CALLV
+pop
+ADDRGP4 cg+607184
+INDIRI4
+CNSTI4 0
+EQI4 $227
+LABELV $227
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $233
+JUMPV
+LABELV $230
+ADDRLP4 4
+CNSTI4 1496
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $231
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $233
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $230
+ADDRGP4 cg+40
+ADDRGP4 cg+44
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+ASGNP4
+ADDRGP4 cg+44
+ADDRGP4 cg+48
+INDIRP4
+ASGNP4
+ADDRGP4 $243
+ARGP4
+ADDRLP4 16
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $241
+ADDRGP4 $244
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $241
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $255
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $254
+LABELV $255
+ADDRLP4 24
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $250
+LABELV $254
+ADDRGP4 numSortedTeamPlayers
+CNSTI4 0
+ASGNI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $256
+ADDRGP4 numSortedTeamPlayers
+CNSTI4 1
+ASGNI4
+ADDRGP4 sortedTeamPlayers
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $256
+LABELV $250
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $264
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $260
+LABELV $264
+ADDRGP4 cg_drawJumpSpeeds+12
+INDIRI4
+CNSTI4 1
+NEI4 $265
+ADDRLP4 28
+CNSTI4 76
+ASGNI4
+ADDRLP4 32
+CNSTI4 80
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1065353216
+GEF4 $265
+ADDRGP4 cg+5417532
+CNSTI4 1
+ASGNI4
+LABELV $265
+LABELV $260
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $273
+ADDRLP4 28
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 556
+ASGNI4
+ADDRLP4 4
+CNSTI4 1496
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $279
+LABELV $279
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $282
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $282
+ADDRLP4 36
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $287
+ADDRLP4 36
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $287
+LABELV $287
+LABELV $282
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 64
+GEI4 $289
+ADDRLP4 36
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 556
+ASGNI4
+CNSTI4 2392
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+120
+ADDP4
+ARGP4
+CNSTI4 1496
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+CNSTU4 236
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $300
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $299
+LABELV $300
+ADDRLP4 48
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $295
+LABELV $299
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $301
+ADDRLP4 56
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRLP4 60
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $306
+ADDRLP4 56
+CNSTI4 3
+ASGNI4
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRLP4 56
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $307
+LABELV $302
+ADDRLP4 52
+CNSTI4 4524
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRLP4 52
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $311
+ADDRLP4 56
+INDIRI4
+CNSTI4 3
+EQI4 $311
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CNSTI4 32
+GEI4 $313
+ADDRLP4 68
+ADDRGP4 numSortedTeamPlayers
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers-4
+ADDP4
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $313
+LABELV $311
+LABELV $295
+LABELV $289
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $322
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $321
+LABELV $322
+ADDRLP4 40
+ADDRGP4 CG_IsCpmaMvd
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $317
+LABELV $321
+ADDRGP4 sortedTeamPlayers
+ARGP4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 4
+ARGU4
+ADDRGP4 SortClients
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $317
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_TransitionEntity
+CALLV
+pop
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $323
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $323
+ADDRGP4 cg_drawJumpSpeeds+12
+INDIRI4
+CNSTI4 1
+NEI4 $327
+ADDRLP4 48
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1065353216
+GEF4 $327
+ADDRGP4 cg+5417532
+CNSTI4 1
+ASGNI4
+LABELV $327
+LABELV $323
+ADDRLP4 4
+INDIRP4
+CNSTI4 896
+ADDP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $274
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $276
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $273
+ADDRGP4 cg+48
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $333
+ADDRLP4 36
+CNSTI4 44
+ASGNI4
+ADDRLP4 28
+ADDRLP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 104
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $336
+ADDRGP4 cg+607136
+CNSTI4 1
+ASGNI4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1464
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1468
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1472
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+607704+1464
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607704+1468
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607704+1472
+CNSTF4 0
+ASGNF4
+LABELV $336
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $359
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 44
+INDIRI4
+NEI4 $359
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $359
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $351
+LABELV $359
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 CG_TransitionPlayerState
+CALLV
+pop
+LABELV $351
+LABELV $333
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $360
+ADDRLP4 28
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 2376
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $364
+ADDRGP4 $361
+JUMPV
+LABELV $364
+ADDRLP4 28
+INDIRP4
+CNSTI4 1816
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1276
+ADDP4
+ARGP4
+CNSTU4 540
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 28
+INDIRP4
+CNSTI4 1276
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 540
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $361
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $360
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $366
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+EQI4 $373
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 15
+NEI4 $369
+LABELV $373
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $374
+ADDRLP4 28
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $379
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $383
+ADDRGP4 $380
+JUMPV
+LABELV $383
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $386
+ADDRGP4 $380
+JUMPV
+LABELV $386
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $390
+ADDRGP4 $380
+JUMPV
+LABELV $390
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $380
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $379
+LABELV $381
+ADDRLP4 28
+INDIRI4
+CNSTI4 -1
+EQI4 $393
+ADDRGP4 cgs+43240
+INDIRI4
+ARGI4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_ScoresEqual
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $395
+ADDRGP4 cgs+43292
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cgs+44316
+ARGP4
+CNSTI4 4524
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRGP4 cgs+43292
+ARGP4
+CNSTI4 4524
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cgs+44316
+ARGP4
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $396
+LABELV $393
+LABELV $374
+LABELV $369
+LABELV $366
+LABELV $197
+endproc CG_TransitionSnapshot 72 16
+proc CG_SetNextSnap 104 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+5649544
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $420
+CNSTI4 121400
+ADDRGP4 wcg+31078456
+INDIRI4
+CNSTI4 256
+MODI4
+MULI4
+ADDRGP4 wcg+56
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+ARGP4
+CNSTU4 121400
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 32
+ADDRGP4 wcg+31078456
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $430
+JUMPV
+LABELV $427
+ADDRLP4 0
+CNSTI4 236
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $433
+ADDRLP4 16
+ADDRGP4 cg+5649544
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+5584008
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTU4 40
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cg+5649544
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $433
+LABELV $428
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $430
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $427
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $438
+ADDRLP4 24
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_GetCurrentSnapshotNumber
+CALLV
+pop
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 cg+76
+ARGP4
+ADDRGP4 cg+52
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_GetSnapshotRef
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $443
+ADDRGP4 cg+121476
+CNSTI4 0
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRGP4 cg+121476
+CNSTI4 1
+ASGNI4
+LABELV $444
+ADDRGP4 Wolfcam_NextSnapShotSet
+CALLV
+pop
+LABELV $438
+LABELV $420
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $447
+ADDRLP4 32
+CNSTI4 121400
+ADDRGP4 wcg+31078456
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 256
+MODI4
+MULI4
+ADDRGP4 wcg+56+8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+CNSTI4 33
+LEI4 $448
+LABELV $447
+LABELV $448
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTI4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+236
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+472
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $462
+JUMPV
+LABELV $459
+ADDRLP4 36
+CNSTI4 236
+ASGNI4
+ADDRLP4 0
+ADDRLP4 36
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1496
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTU4 236
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $465
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+ADDRLP4 48
+INDIRI4
+EQI4 $463
+LABELV $465
+ADDRLP4 4
+INDIRP4
+CNSTI4 472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $464
+JUMPV
+LABELV $463
+ADDRLP4 4
+INDIRP4
+CNSTI4 472
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $464
+LABELV $460
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $462
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $459
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $466
+ADDRLP4 36
+CNSTI4 148
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $466
+ADDRGP4 cg+607140
+CNSTI4 1
+ASGNI4
+ADDRGP4 $467
+JUMPV
+LABELV $466
+ADDRGP4 cg+607140
+CNSTI4 0
+ASGNI4
+LABELV $467
+ADDRLP4 40
+CNSTI4 184
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $472
+ADDRGP4 cg+607140
+CNSTI4 1
+ASGNI4
+LABELV $472
+ADDRGP4 cg+48
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $477
+ADDRGP4 cg+607140
+CNSTI4 1
+ASGNI4
+LABELV $477
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $482
+ADDRLP4 44
+CNSTU4 0
+ASGNU4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+ADDRLP4 44
+INDIRU4
+EQU4 $482
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+ADDRLP4 44
+INDIRU4
+EQU4 $482
+ADDRLP4 60
+CNSTI4 44
+ASGNI4
+ADDRLP4 48
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 104
+ASGNI4
+ADDRLP4 72
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $489
+ADDRLP4 76
+CNSTI4 140
+ASGNI4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $489
+ADDRLP4 80
+CNSTI4 68
+ASGNI4
+ADDRLP4 84
+CNSTI4 1022
+ASGNI4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $491
+ADDRLP4 48
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $491
+ADDRLP4 88
+CNSTI4 28
+ASGNI4
+ADDRLP4 56
+ADDRLP4 52
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1073741824
+LEF4 $493
+ADDRLP4 92
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+609292
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_stepSmoothTime+8
+INDIRF4
+GEF4 $497
+ADDRLP4 96
+ADDRGP4 cg+609288
+INDIRF4
+ADDRGP4 cg_stepSmoothTime+8
+INDIRF4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ADDRGP4 cg_stepSmoothTime+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $498
+JUMPV
+LABELV $497
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+LABELV $498
+ADDRLP4 100
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+609288
+ADDRLP4 96
+INDIRF4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609288
+INDIRF4
+ADDRGP4 cg_stepSmoothMaxChange+8
+INDIRF4
+LEF4 $504
+ADDRGP4 cg+609288
+ADDRGP4 cg_stepSmoothMaxChange+8
+INDIRF4
+ASGNF4
+LABELV $504
+ADDRGP4 cg+609292
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $493
+LABELV $491
+LABELV $489
+LABELV $482
+ADDRGP4 CG_BuildSolidList
+CALLV
+pop
+LABELV $417
+endproc CG_SetNextSnap 104 12
+proc CG_SetSnapshotRef 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 121396
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $512
+endproc CG_SetSnapshotRef 0 0
+export CG_ResetTimeChange
+proc CG_ResetTimeChange 232 20
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $514
+ADDRGP4 $513
+JUMPV
+LABELV $514
+ADDRGP4 cg+1335116
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+1332740
+INDIRI4
+CNSTI4 0
+EQI4 $518
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 cg+1332744
+CNSTI4 0
+ASGNI4
+ADDRGP4 $523
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+1332908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332740
+CNSTI4 0
+ASGNI4
+LABELV $518
+ADDRLP4 92
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRGP4 cg+607148
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3196912
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3196916
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1232348160
+DIVF4
+ASGNF4
+ADDRGP4 cg+607152
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+3196916
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 92
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108
+CNSTU4 0
+ASGNU4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+ADDRLP4 108
+INDIRU4
+EQU4 $534
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+ADDRLP4 108
+INDIRU4
+EQU4 $534
+ADDRLP4 112
+CNSTI4 8
+ASGNI4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+LTF4 $538
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+GEF4 $538
+ADDRGP4 $513
+JUMPV
+LABELV $538
+LABELV $534
+ADDRLP4 60
+ARGP4
+ADDRGP4 cg+36
+ARGP4
+ADDRGP4 trap_GetCurrentSnapshotNumber
+CALLV
+pop
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cgs+39680
+INDIRI4
+CNSTI4 1
+ADDI4
+NEI4 $545
+ADDRGP4 $513
+JUMPV
+LABELV $545
+ADDRGP4 cg+44
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+48
+CNSTP4 0
+ASGNP4
+ADDRLP4 80
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+121476
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 CG_ResetTimedItemPickupTimes
+CALLV
+pop
+ADDRLP4 112
+CNSTI4 1000
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDRGP4 cg+694732
+INDIRI4
+MULI4
+SUBI4
+ADDRLP4 112
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 trap_GetItemPickupNumber
+CALLI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 -1
+LEI4 $552
+ADDRGP4 $555
+JUMPV
+LABELV $554
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 120
+ADDRGP4 trap_GetItemPickup
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 -1
+NEI4 $557
+ADDRGP4 $556
+JUMPV
+LABELV $557
+ADDRLP4 20+20
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+607152
+INDIRF4
+LEF4 $559
+ADDRGP4 $556
+JUMPV
+LABELV $559
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20+32
+INDIRI4
+CNSTI4 0
+EQI4 $563
+ADDRLP4 20+24
+INDIRI4
+CNSTI4 0
+EQI4 $564
+ADDRLP4 20+4
+INDIRI4
+ARGI4
+ADDRLP4 20+8
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20+24
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_TimedItemPickup
+CALLV
+pop
+ADDRGP4 $564
+JUMPV
+LABELV $563
+ADDRLP4 20+4
+INDIRI4
+ARGI4
+ADDRLP4 20+8
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20+20
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_TimedItemPickup
+CALLV
+pop
+LABELV $564
+LABELV $555
+ADDRGP4 $554
+JUMPV
+LABELV $556
+LABELV $552
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $575
+ADDRLP4 120
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+GEI4 $579
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $580
+ADDRLP4 120
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $580
+JUMPV
+LABELV $579
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $580
+ADDRLP4 120
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 120
+INDIRP4
+CNSTI4 528
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 120
+INDIRP4
+CNSTI4 544
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 120
+INDIRP4
+CNSTI4 560
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 120
+INDIRP4
+CNSTI4 576
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 120
+INDIRP4
+CNSTI4 592
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 120
+INDIRP4
+CNSTI4 608
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 120
+INDIRP4
+CNSTI4 624
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 120
+INDIRP4
+CNSTI4 832
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 120
+INDIRP4
+CNSTI4 848
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 120
+INDIRP4
+CNSTI4 864
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 120
+INDIRP4
+CNSTI4 880
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+LABELV $576
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $575
+ADDRGP4 cg+607704
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+LABELV $585
+ADDRGP4 cg+607136
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607140
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6747456
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+632768
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 32
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cgs+632844
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+632852
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+632904
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43292
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+44316
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $597
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $601
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $598
+JUMPV
+LABELV $601
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+LABELV $598
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $597
+ADDRGP4 cg+607196
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 508
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+607704
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+610848
+CNSTI4 0
+ASGNI4
+ADDRGP4 CG_CreateScoresFromClientInfo
+CALLV
+pop
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+ADDRGP4 cgs+1957504
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+1957580
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+ADDRGP4 trap_GetLastExecutedServerCommand
+CALLI4
+ASGNI4
+ADDRGP4 cgs+39676
+ADDRLP4 120
+INDIRI4
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43240
+ADDRLP4 128
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43244
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $615
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+GEI4 $618
+CNSTI4 702
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1957816
+ADDRLP4 144
+INDIRI4
+ASGNI4
+CNSTI4 703
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1957820
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRGP4 $616
+JUMPV
+LABELV $618
+CNSTI4 700
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1957816
+ADDRLP4 144
+INDIRI4
+ASGNI4
+CNSTI4 701
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+1957820
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRGP4 $616
+JUMPV
+LABELV $615
+ADDRGP4 cgs+1957816
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957820
+CNSTI4 0
+ASGNI4
+LABELV $616
+ADDRGP4 cg+627388
+CNSTI4 0
+ASGNI4
+ADDRGP4 CG_ParseWarmup
+CALLV
+pop
+CNSTI4 13
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43236
+ADDRLP4 144
+INDIRI4
+ASGNI4
+CNSTI4 14
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+28
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 5
+EQI4 $636
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $636
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $630
+LABELV $636
+CNSTI4 658
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+43248
+ADDRLP4 156
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+CNSTI4 658
+ARGI4
+ADDRLP4 160
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+43252
+ADDRLP4 160
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $639
+CNSTI4 658
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43256
+ADDRLP4 168
+INDIRI4
+ASGNI4
+LABELV $639
+LABELV $630
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $643
+CNSTI4 663
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43260
+ADDRLP4 160
+INDIRI4
+ASGNI4
+CNSTI4 664
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43264
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 $644
+JUMPV
+LABELV $643
+ADDRGP4 cgs+43260
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43264
+CNSTI4 0
+ASGNI4
+LABELV $644
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $650
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $661
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $661
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 11
+EQI4 $661
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $651
+LABELV $661
+CNSTI4 661
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $662
+ADDRGP4 cgs+43280
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+43268
+CNSTI4 -999
+ASGNI4
+ADDRGP4 cgs+43272
+CNSTI4 0
+ASGNI4
+ADDRGP4 $651
+JUMPV
+LABELV $662
+ADDRGP4 cgs+43280
+CNSTI4 0
+ASGNI4
+CNSTI4 661
+ARGI4
+ADDRLP4 160
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRGP4 $669
+ARGP4
+ADDRLP4 164
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43268
+ADDRLP4 168
+INDIRI4
+ASGNI4
+CNSTI4 661
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRGP4 $671
+ARGP4
+ADDRLP4 176
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+43272
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 $651
+JUMPV
+LABELV $650
+ADDRGP4 cgs+43280
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43268
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43272
+CNSTI4 0
+ASGNI4
+LABELV $651
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $675
+CNSTI4 669
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+45340
+ADDRLP4 160
+INDIRI4
+ASGNI4
+CNSTI4 670
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+45344
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+45348
+CNSTI4 0
+ASGNI4
+CNSTI4 671
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+45352
+ADDRLP4 176
+INDIRI4
+ASGNI4
+CNSTI4 672
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+45356
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+45344
+INDIRI4
+LTI4 $689
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+45340
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $676
+ADDRGP4 cgs+45344
+INDIRI4
+ADDRLP4 188
+INDIRI4
+NEI4 $676
+LABELV $689
+ADDRGP4 CG_ResetTimedItemPickupTimes
+CALLV
+pop
+ADDRGP4 $676
+JUMPV
+LABELV $675
+ADDRGP4 cgs+45340
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+45344
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+45348
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+45352
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+45356
+CNSTI4 0
+ASGNI4
+LABELV $676
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $695
+ADDRGP4 cgs+1957792
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_CpmaParseGameState
+CALLV
+pop
+CNSTI4 672
+ARGI4
+ADDRLP4 160
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 156
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRGP4 $701
+ARGP4
+ADDRLP4 164
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $699
+ADDRGP4 CG_ResetTimedItemPickupTimes
+CALLV
+pop
+LABELV $699
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_CpmaParseScores
+CALLV
+pop
+LABELV $695
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $702
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+2388
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $703
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $702
+ADDRGP4 cg+627132
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196856
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+607132
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+607156
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3196884
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+3196888
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+3196892
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+609200
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+609204
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+609292
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+609300
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+609308
+CNSTI4 0
+ASGNI4
+ADDRLP4 156
+ADDRGP4 cg+609796
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 160
+ADDRGP4 cg+609804
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+610840
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+617028
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3848200
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3856416+4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3865760+4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3848204
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3856416
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3865760
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+618132
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+626096
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627148
+ADDRGP4 cg_drawCrosshairNamesTime+12
+INDIRI4
+CNSTI4 2000
+ADDI4
+NEGI4
+ASGNI4
+ADDRGP4 cg+627156
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627160
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627164
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627304
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627404
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627408
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627420
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627428
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627432
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+627460
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627472
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627476
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+627500
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+686624
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+711644
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1330284
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+711652
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 514800
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+1226452
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+711648
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1328856
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 400
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+1329256
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332736
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1335092
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332836
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332840
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+6702224
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6702228
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6702232
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3848216
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $769
+ADDRGP4 CG_SetDuelPlayers
+CALLV
+pop
+LABELV $769
+ADDRGP4 cg+32
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39680
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+31078456
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 cg+121476
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+CNSTI4 10
+ASGNI4
+ADDRLP4 0
+ADDRLP4 88
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $779
+JUMPV
+LABELV $776
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+121476
+CNSTI4 0
+ASGNI4
+ADDRLP4 168
+ADDRLP4 60
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cgs+39672
+INDIRI4
+GEI4 $781
+ADDRGP4 $778
+JUMPV
+LABELV $781
+ADDRLP4 16
+CNSTI4 121400
+ADDRGP4 wcg+31078456
+INDIRI4
+CNSTI4 256
+MODI4
+MULI4
+ADDRGP4 wcg+56
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 CG_GetSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39680
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $787
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $789
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $790
+JUMPV
+LABELV $789
+ADDRGP4 cg+1335112
+INDIRI4
+CNSTI4 99999
+EQI4 $791
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg+1335112
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+1335112
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $792
+JUMPV
+LABELV $791
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 25
+SUBI4
+CVIF4 4
+CNSTF4 1095237632
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $792
+LABELV $790
+ADDRLP4 76
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_checkForOfflineDemo+12
+INDIRI4
+CNSTI4 0
+EQI4 $802
+CNSTI4 121400
+ADDRGP4 wcg+31078456
+INDIRI4
+CNSTI4 256
+MODI4
+MULI4
+ADDRGP4 wcg+56+8
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LEI4 $788
+LABELV $802
+ADDRLP4 64
+CNSTI4 121400
+ADDRGP4 wcg+31078456
+INDIRI4
+CNSTI4 256
+MODI4
+MULI4
+ADDRGP4 wcg+56+8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $806
+ADDRLP4 180
+ADDRGP4 wcg+31078456
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $806
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $809
+ADDRGP4 cg+44
+CNSTI4 121400
+ADDRGP4 wcg+31078456
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 256
+MODI4
+MULI4
+ADDRGP4 wcg+56
+ADDP4
+ASGNP4
+ADDRGP4 $810
+JUMPV
+LABELV $809
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $815
+ADDRGP4 cg+48
+CNSTI4 121400
+ADDRGP4 wcg+31078456
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 256
+MODI4
+MULI4
+ADDRGP4 wcg+56
+ADDP4
+ASGNP4
+ADDRGP4 $816
+JUMPV
+LABELV $815
+ADDRLP4 80
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $821
+ADDRLP4 180
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+CNSTI4 121400
+ADDRGP4 wcg+31078456
+INDIRI4
+ADDRLP4 180
+INDIRI4
+SUBI4
+CNSTI4 256
+MODI4
+MULI4
+ADDRGP4 wcg+56
+ADDP4
+ASGNP4
+ADDRLP4 172
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 cg+121476
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 $822
+JUMPV
+LABELV $821
+ADDRLP4 180
+CNSTI4 1
+ASGNI4
+ADDRLP4 172
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 cg+121476
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 cg+44
+ADDRGP4 cg+48
+INDIRP4
+ASGNP4
+ADDRGP4 cg+48
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 80
+CNSTI4 121400
+ADDRGP4 wcg+31078456
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 256
+MODI4
+MULI4
+ADDRGP4 wcg+56
+ADDP4
+ASGNP4
+LABELV $822
+LABELV $816
+LABELV $810
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $788
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 cg+52
+ARGP4
+ADDRGP4 CG_SetSnapshotRef
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $835
+CNSTI4 1496
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+480
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1496
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+484
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1496
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+476
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $836
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $835
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+480
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+476
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $849
+JUMPV
+LABELV $846
+CNSTI4 1496
+CNSTI4 236
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+480
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1496
+CNSTI4 236
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+476
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $847
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $849
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $846
+CNSTI4 1496
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $860
+JUMPV
+LABELV $857
+CNSTI4 1496
+CNSTI4 236
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+484
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $858
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $860
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $857
+ADDRGP4 Wolfcam_CheckNoMove
+CALLV
+pop
+ADDRGP4 $788
+JUMPV
+LABELV $787
+ADDRGP4 cg+121476
+CNSTI4 0
+ASGNI4
+ADDRGP4 $865
+ARGP4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $788
+LABELV $777
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $779
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $776
+LABELV $778
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $866
+ADDRLP4 12
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 472
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $867
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $866
+ADDRGP4 cg+44
+ADDRGP4 cg+364332
+ASGNP4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $872
+ADDRGP4 $875
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 cg+44
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 CG_GetSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $877
+ADDRGP4 $879
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cg+44
+CNSTP4 0
+ASGNP4
+ADDRGP4 CG_Abort
+CALLV
+pop
+LABELV $877
+ADDRGP4 cg+1335112
+INDIRI4
+CNSTI4 99999
+EQI4 $881
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg+1335112
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+1335112
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $882
+JUMPV
+LABELV $881
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 25
+SUBI4
+CVIF4 4
+CNSTF4 1095237632
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $882
+ADDRGP4 cg+48
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+32
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39680
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $873
+JUMPV
+LABELV $872
+ADDRGP4 cg+44
+INDIRP4
+ADDRGP4 cg+48
+INDIRP4
+INDIRB
+ASGNB 121400
+ADDRGP4 cg+1335112
+INDIRI4
+CNSTI4 99999
+EQI4 $897
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg+1335112
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+1335112
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $898
+JUMPV
+LABELV $897
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 25
+SUBI4
+CVIF4 4
+CNSTF4 1095237632
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $898
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $908
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 cgs+43280
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cgs+43268
+INDIRI4
+LEI4 $912
+ADDRGP4 cgs+43268
+CNSTI4 0
+ASGNI4
+LABELV $912
+LABELV $908
+ADDRLP4 12
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 196
+CNSTI4 184
+ASGNI4
+ADDRLP4 172
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 trap_GetLegsAnimStartTime
+CALLI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 trap_GetTorsoAnimStartTime
+CALLI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_HASTE
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $923
+ADDRLP4 180
+CNSTF4 1069547520
+ASGNF4
+ADDRGP4 $924
+JUMPV
+LABELV $923
+ADDRLP4 180
+CNSTF4 1065353216
+ASGNF4
+LABELV $924
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 208
+ADDRGP4 CG_FreezeTagFrozen
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $925
+ADDRLP4 180
+CNSTF4 0
+ASGNF4
+LABELV $925
+ADDRLP4 176
+ADDRLP4 12
+INDIRP4
+CNSTI4 900
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+ADDRLP4 184
+CNSTI4 28
+ADDRLP4 8
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 172
+INDIRP4
+CNSTI4 980
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $927
+ADDRLP4 168
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRGP4 $932
+JUMPV
+LABELV $929
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRF4
+ARGF4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+LABELV $930
+ADDRLP4 168
+ADDRLP4 168
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+LABELV $932
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LTI4 $929
+LABELV $927
+ADDRLP4 176
+ADDRLP4 12
+INDIRP4
+CNSTI4 948
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+ADDRLP4 184
+CNSTI4 28
+ADDRLP4 8
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 172
+INDIRP4
+CNSTI4 980
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $934
+ADDRLP4 168
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRGP4 $939
+JUMPV
+LABELV $936
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRF4
+ARGF4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+LABELV $937
+ADDRLP4 168
+ADDRLP4 168
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+LABELV $939
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LTI4 $936
+LABELV $934
+ADDRGP4 cg+607704
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cg+627420
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+609312
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $946
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+480
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+476
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $947
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $946
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+480
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+476
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $959
+JUMPV
+LABELV $956
+ADDRLP4 8
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1496
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTU4 236
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $962
+ADDRGP4 $957
+JUMPV
+LABELV $962
+ADDRLP4 172
+CNSTI4 4524
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 trap_GetLegsAnimStartTime
+CALLI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 trap_GetTorsoAnimStartTime
+CALLI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_HASTE
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $965
+ADDRLP4 180
+CNSTF4 1069547520
+ASGNF4
+ADDRGP4 $966
+JUMPV
+LABELV $965
+ADDRLP4 180
+CNSTF4 1065353216
+ASGNF4
+LABELV $966
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_FreezeTagFrozen
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $967
+ADDRLP4 180
+CNSTF4 0
+ASGNF4
+LABELV $967
+ADDRLP4 176
+ADDRLP4 12
+INDIRP4
+CNSTI4 900
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+ADDRLP4 184
+CNSTI4 28
+ADDRLP4 8
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 172
+INDIRP4
+CNSTI4 980
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $969
+ADDRLP4 168
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRGP4 $974
+JUMPV
+LABELV $971
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRF4
+ARGF4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+LABELV $972
+ADDRLP4 168
+ADDRLP4 168
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+LABELV $974
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LTI4 $971
+LABELV $969
+ADDRLP4 176
+ADDRLP4 12
+INDIRP4
+CNSTI4 948
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+ADDRLP4 184
+CNSTI4 28
+ADDRLP4 8
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 172
+INDIRP4
+CNSTI4 980
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $976
+ADDRLP4 168
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRGP4 $981
+JUMPV
+LABELV $978
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRF4
+ARGF4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+LABELV $979
+ADDRLP4 168
+ADDRLP4 168
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+LABELV $981
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LTI4 $978
+LABELV $976
+LABELV $957
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $959
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $956
+ADDRGP4 cg+32
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39680
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+48
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+121476
+CNSTI4 0
+ASGNI4
+LABELV $873
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $987
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $987
+ADDRGP4 CG_PlayWinLossMusic
+CALLV
+pop
+ADDRGP4 $988
+JUMPV
+LABELV $987
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+LABELV $988
+ADDRGP4 cgs+43288
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+43280
+INDIRI4
+CNSTI4 0
+EQI4 $992
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $992
+CNSTI4 662
+ARGI4
+ADDRLP4 168
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 104
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 172
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cgs+39712
+INDIRI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 1000
+DIVI4
+SUBI4
+CNSTI4 30
+GEI4 $993
+ADDRGP4 cgs+43288
+CNSTI4 1
+ASGNI4
+ADDRGP4 $993
+JUMPV
+LABELV $992
+ADDRGP4 cgs+43288
+CNSTI4 1
+ASGNI4
+LABELV $993
+ADDRGP4 cgs+43280
+INDIRI4
+CNSTI4 0
+NEI4 $1002
+ADDRLP4 96
+ADDRGP4 cgs+43268
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRGP4 cgs+43284
+CNSTI4 -999
+ASGNI4
+ADDRLP4 168
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+LTI4 $1008
+ADDRLP4 168
+INDIRI4
+CNSTI4 5
+GTI4 $1008
+ADDRGP4 cgs+43284
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $1008
+LABELV $1002
+ADDRGP4 cg+607176
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607180
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+39724
+INDIRI4
+CNSTI4 0
+LEI4 $1013
+ADDRLP4 168
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+43236
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+607176
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1018
+ADDRLP4 168
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+CNSTI4 2000
+ADDI4
+LEI4 $1018
+ADDRLP4 172
+ADDRGP4 cg+607176
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+CNSTI4 7
+BORI4
+ASGNI4
+ADDRGP4 $1019
+JUMPV
+LABELV $1018
+ADDRGP4 cg+607176
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $1023
+ADDRLP4 168
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+CNSTI4 60000
+SUBI4
+LEI4 $1023
+ADDRLP4 172
+ADDRGP4 cg+607176
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+CNSTI4 3
+BORI4
+ASGNI4
+ADDRGP4 $1024
+JUMPV
+LABELV $1023
+ADDRGP4 cgs+39720
+INDIRI4
+CNSTI4 5
+LEI4 $1028
+ADDRGP4 cg+607176
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $1028
+ADDRLP4 168
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+39720
+INDIRI4
+MULI4
+MULI4
+CNSTI4 300000
+SUBI4
+LEI4 $1028
+ADDRLP4 172
+ADDRGP4 cg+607176
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $1028
+LABELV $1024
+LABELV $1019
+LABELV $1013
+ADDRGP4 cgs+39704
+INDIRI4
+CNSTI4 0
+LEI4 $1034
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+GEI4 $1034
+ADDRLP4 100
+ADDRGP4 cgs+43240
+INDIRI4
+ASGNI4
+ADDRGP4 cg+607180
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1039
+ADDRLP4 100
+INDIRI4
+ADDRGP4 cgs+39704
+INDIRI4
+CNSTI4 1
+SUBI4
+NEI4 $1039
+ADDRLP4 168
+ADDRGP4 cg+607180
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 7
+BORI4
+ASGNI4
+ADDRGP4 $1040
+JUMPV
+LABELV $1039
+ADDRLP4 168
+CNSTI4 2
+ASGNI4
+ADDRGP4 cgs+39704
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LEI4 $1044
+ADDRGP4 cg+607180
+INDIRI4
+ADDRLP4 168
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $1044
+ADDRLP4 100
+INDIRI4
+ADDRGP4 cgs+39704
+INDIRI4
+ADDRLP4 168
+INDIRI4
+SUBI4
+NEI4 $1044
+ADDRLP4 172
+ADDRGP4 cg+607180
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+CNSTI4 3
+BORI4
+ASGNI4
+ADDRGP4 $1045
+JUMPV
+LABELV $1044
+ADDRLP4 172
+CNSTI4 3
+ASGNI4
+ADDRGP4 cgs+39704
+INDIRI4
+ADDRLP4 172
+INDIRI4
+LEI4 $1050
+ADDRGP4 cg+607180
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $1050
+ADDRLP4 100
+INDIRI4
+ADDRGP4 cgs+39704
+INDIRI4
+ADDRLP4 172
+INDIRI4
+SUBI4
+NEI4 $1050
+ADDRLP4 176
+ADDRGP4 cg+607180
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $1050
+LABELV $1045
+LABELV $1040
+LABELV $1034
+ADDRGP4 cg+627168
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1057
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+496
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $1058
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $1057
+ADDRGP4 cg+617032
+CNSTP4 0
+ASGNP4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $1068
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $1064
+LABELV $1068
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+6770156
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1069
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6769132
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+GEI4 $1074
+ADDRLP4 168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6769132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1071
+JUMPV
+LABELV $1074
+LABELV $1070
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1072
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1069
+LABELV $1071
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+LEI4 $1079
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1081
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+2384
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 180
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 184
+ADDRGP4 trap_GetNextKiller
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $1086
+ADDRLP4 172
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+GTI4 $1088
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+2384
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1088
+LABELV $1086
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 176
+ARGP4
+ADDRLP4 188
+ADDRGP4 trap_GetTeamSwitchTime
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $1092
+ADDRLP4 176
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+GTI4 $1094
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+2384
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1094
+LABELV $1092
+LABELV $1082
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1081
+LABELV $1079
+LABELV $1064
+ADDRGP4 $1100
+ARGP4
+ADDRLP4 168
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $1098
+ADDRGP4 $1101
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1104
+ADDRGP4 $1107
+ARGP4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1105
+JUMPV
+LABELV $1104
+ADDRGP4 $1109
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1105
+LABELV $1098
+LABELV $513
+endproc CG_ResetTimeChange 232 20
+data
+align 4
+LABELV $1154
+byte 4 0
+align 4
+LABELV $1155
+byte 4 0
+code
+proc CG_ReadNextSnapshot 40 20
+ADDRGP4 $243
+ARGP4
+ADDRLP4 12
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1111
+ADDRGP4 $1113
+ARGP4
+ADDRGP4 cg+32
+INDIRI4
+ARGI4
+ADDRGP4 cgs+39680
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1111
+ADDRGP4 cg+32
+INDIRI4
+ADDRGP4 cgs+39680
+INDIRI4
+CNSTI4 1000
+ADDI4
+LEI4 $1116
+LABELV $1116
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+39680
+INDIRI4
+ADDRGP4 cg+32
+INDIRI4
+LTI4 $1127
+ADDRGP4 $1124
+ARGP4
+ADDRLP4 16
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1127
+ADDRGP4 $1125
+ARGP4
+ADDRLP4 20
+ADDRGP4 SC_Cvar_Get_Float
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1065353216
+GTF4 $1127
+ADDRGP4 $1127
+JUMPV
+LABELV $1126
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+364332
+CVPU4 4
+NEU4 $1131
+ADDRLP4 0
+ADDRGP4 cg+364332+121400
+ASGNP4
+ADDRGP4 $1132
+JUMPV
+LABELV $1131
+ADDRLP4 0
+ADDRGP4 cg+364332
+ASGNP4
+LABELV $1132
+ADDRLP4 24
+ADDRGP4 cgs+39680
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $243
+ARGP4
+ADDRLP4 28
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1139
+ADDRGP4 $1141
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 cgs+39680
+INDIRI4
+ARGI4
+ADDRGP4 cg+32
+INDIRI4
+ARGI4
+ADDRGP4 cg+607172
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1139
+ADDRGP4 cg+32
+INDIRI4
+ADDRGP4 cgs+39680
+INDIRI4
+SUBI4
+CNSTI4 32
+LTI4 $1145
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1145
+ADDRGP4 cgs+39680
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_GetSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1150
+LABELV $1150
+LABELV $1146
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1152
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1156
+LABELV $1156
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 $1154
+INDIRI4
+NEI4 $1158
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $1155
+INDIRI4
+ASGNI4
+ADDRGP4 $1159
+JUMPV
+LABELV $1158
+ADDRGP4 cg+1335112
+INDIRI4
+CNSTI4 99999
+EQI4 $1160
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg+1335112
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+1335112
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1161
+JUMPV
+LABELV $1160
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 25
+SUBI4
+CVIF4 4
+CNSTF4 1095237632
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $1161
+LABELV $1159
+ADDRGP4 $1154
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1155
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddLagometerSnapshotInfo
+CALLV
+pop
+ADDRGP4 $243
+ARGP4
+ADDRLP4 36
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $1165
+ADDRGP4 $1167
+ARGP4
+ADDRGP4 cgs+39680
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1165
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $1110
+JUMPV
+LABELV $1152
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $1169
+LABELV $1169
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_AddLagometerSnapshotInfo
+CALLV
+pop
+LABELV $1127
+ADDRGP4 cgs+39680
+INDIRI4
+ADDRGP4 cg+32
+INDIRI4
+LTI4 $1126
+CNSTP4 0
+RETP4
+LABELV $1110
+endproc CG_ReadNextSnapshot 40 20
+proc CG_TemporarySnapshotTransition 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cg+44
+INDIRP4
+ASGNP4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+472
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1179
+JUMPV
+LABELV $1176
+ADDRLP4 20
+CNSTI4 236
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1496
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTU4 236
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1182
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1180
+LABELV $1182
+ADDRLP4 4
+INDIRP4
+CNSTI4 472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1180
+ADDRLP4 4
+INDIRP4
+CNSTI4 472
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1181
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1183
+ADDRLP4 40
+CNSTI4 148
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1183
+ADDRGP4 cg+607140
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1184
+JUMPV
+LABELV $1183
+ADDRGP4 cg+607140
+CNSTI4 0
+ASGNI4
+LABELV $1184
+ADDRLP4 44
+CNSTI4 184
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $1189
+ADDRGP4 cg+607140
+CNSTI4 1
+ASGNI4
+LABELV $1189
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1193
+ADDRGP4 cg+607140
+CNSTI4 1
+ASGNI4
+LABELV $1193
+LABELV $1177
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1179
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $1176
+ADDRGP4 CG_BuildSolidList
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1197
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients+2376
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1198
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1197
+ADDRFP4 0
+INDIRP4
+CNSTI4 121392
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ExecuteNewServerCommands
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1205
+JUMPV
+LABELV $1202
+ADDRLP4 4
+CNSTI4 1496
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1203
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1205
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $1202
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTI4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1211
+JUMPV
+LABELV $1208
+ADDRLP4 12
+CNSTI4 236
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1496
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_TransitionEntity
+CALLV
+pop
+LABELV $1209
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1211
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $1208
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1212
+ADDRLP4 32
+CNSTI4 44
+ASGNI4
+ADDRLP4 24
+ADDRLP4 16
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 104
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1214
+ADDRGP4 cg+607136
+CNSTI4 1
+ASGNI4
+LABELV $1214
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 CG_TransitionPlayerState
+CALLV
+pop
+LABELV $1212
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1217
+ADDRLP4 24
+CNSTI4 2392
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 2376
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1221
+ADDRGP4 $1218
+JUMPV
+LABELV $1221
+ADDRLP4 24
+INDIRP4
+CNSTI4 1816
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1276
+ADDP4
+ARGP4
+CNSTU4 540
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 24
+INDIRP4
+CNSTI4 1276
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 540
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $1218
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1217
+LABELV $1172
+endproc CG_TemporarySnapshotTransition 48 12
+export CG_ProcessSnapshots
+proc CG_ProcessSnapshots 24 12
+ADDRLP4 4
+ARGP4
+ADDRGP4 cg+36
+ARGP4
+ADDRGP4 trap_GetCurrentSnapshotNumber
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+32
+INDIRI4
+EQI4 $1239
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+32
+INDIRI4
+GEI4 $1228
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $1231
+ADDRGP4 $1234
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1239
+JUMPV
+LABELV $1231
+ADDRGP4 $1235
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cg+32
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1239
+JUMPV
+LABELV $1228
+ADDRGP4 cg+32
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1239
+JUMPV
+LABELV $1238
+ADDRLP4 8
+ADDRGP4 CG_ReadNextSnapshot
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1242
+ADDRGP4 $1223
+JUMPV
+LABELV $1242
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $1244
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetInitialSnapshot
+CALLV
+pop
+ADDRGP4 $1246
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $1244
+LABELV $1239
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1238
+LABELV $1247
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1250
+ADDRLP4 8
+ADDRGP4 CG_ReadNextSnapshot
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1253
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $1249
+ADDRGP4 $1124
+ARGP4
+ADDRLP4 12
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1249
+ADDRGP4 $1125
+ARGP4
+ADDRLP4 16
+ADDRGP4 SC_Cvar_Get_Float
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+NEF4 $1249
+ADDRGP4 $1258
+ARGP4
+ADDRGP4 cgs+39680
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1249
+JUMPV
+LABELV $1253
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1260
+ADDRGP4 cg_checkForOfflineDemo+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1260
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1260
+ADDRGP4 $1267
+ARGP4
+ADDRLP4 20
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1265
+ADDRGP4 $1268
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1265
+ADDRGP4 cg+3196852
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_TemporarySnapshotTransition
+CALLV
+pop
+ADDRGP4 $1248
+JUMPV
+LABELV $1260
+ADDRGP4 cg+3196852
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetNextSnap
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $1271
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $1275
+ADDRGP4 $1278
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1276
+JUMPV
+LABELV $1275
+ADDRGP4 $1279
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1276
+LABELV $1271
+LABELV $1250
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+LTI4 $1280
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $1280
+ADDRGP4 $1249
+JUMPV
+LABELV $1280
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $1286
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+GEI4 $1286
+ADDRGP4 $1249
+JUMPV
+LABELV $1286
+ADDRGP4 CG_TransitionSnapshot
+CALLV
+pop
+ADDRGP4 Wolfcam_MarkValidEntities
+CALLV
+pop
+LABELV $1248
+ADDRGP4 $1247
+JUMPV
+LABELV $1249
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1291
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $1223
+ADDRGP4 $1297
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1223
+JUMPV
+LABELV $1291
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+GEI4 $1298
+ADDRGP4 cg+607148
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1298
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $1304
+LABELV $1304
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1307
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+GTI4 $1307
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $1312
+ADDRGP4 $1315
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1312
+LABELV $1307
+LABELV $1223
+endproc CG_ProcessSnapshots 24 12
+export CG_GetSnapshot
+proc CG_GetSnapshot 40 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_GetSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1317
+LABELV $1317
+ADDRGP4 cgs+1957784
+INDIRI4
+CNSTI4 0
+EQI4 $1319
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1325
+JUMPV
+LABELV $1322
+ADDRLP4 0
+CNSTI4 236
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+GEI4 $1326
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTI4 677
+CNSTI4 7
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+SUBI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTI4 411
+CNSTI4 12
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+SUBI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTI4 243
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $1326
+LABELV $1323
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1325
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $1322
+LABELV $1319
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $1316
+endproc CG_GetSnapshot 40 8
+export CG_PeekSnapshot
+proc CG_PeekSnapshot 40 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_PeekSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957784
+INDIRI4
+CNSTI4 0
+EQI4 $1329
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1335
+JUMPV
+LABELV $1332
+ADDRLP4 0
+CNSTI4 236
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+GEI4 $1336
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTI4 677
+CNSTI4 7
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+SUBI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTI4 411
+CNSTI4 12
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+SUBI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTI4 243
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $1336
+LABELV $1333
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1335
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $1332
+LABELV $1329
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $1328
+endproc CG_PeekSnapshot 40 8
+export CG_GetSnapshotRef
+proc CG_GetSnapshotRef 8 8
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+32
+INDIRI4
+LEI4 $1339
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_PeekSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1340
+JUMPV
+LABELV $1339
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_GetSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1340
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetSnapshotRef
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1338
+endproc CG_GetSnapshotRef 8 8
+export CG_SnapshotRefValid
+proc CG_SnapshotRefValid 0 0
+CNSTI4 0
+RETI4
+LABELV $1342
+endproc CG_SnapshotRefValid 0 0
+export CG_UpdateSnapshotRef
+proc CG_UpdateSnapshotRef 12 12
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $1344
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_SnapshotRefValid
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1344
+CNSTI4 1
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1344
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_GetSnapshotRef
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $1343
+endproc CG_UpdateSnapshotRef 12 12
+export CG_SnapshotRefEntity
+proc CG_SnapshotRefEntity 0 0
+CNSTI4 236
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+RETP4
+LABELV $1346
+endproc CG_SnapshotRefEntity 0 0
+export CG_NextNextSnapshot
+proc CG_NextNextSnapshot 8 12
+ADDRGP4 cg+121476
+INDIRI4
+CNSTI4 0
+NEI4 $1348
+CNSTP4 0
+RETP4
+ADDRGP4 $1347
+JUMPV
+LABELV $1348
+ADDRGP4 cg+52+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1356
+ADDRGP4 cg+52
+ARGP4
+ADDRLP4 0
+ADDRGP4 CG_SnapshotRefValid
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1351
+LABELV $1356
+ADDRGP4 cg+52
+RETP4
+ADDRGP4 $1347
+JUMPV
+LABELV $1351
+ADDRGP4 cg+52+4
+INDIRI4
+ARGI4
+ADDRGP4 cg+76
+ARGP4
+ADDRGP4 cg+52
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_GetSnapshotRef
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1358
+ADDRGP4 cg+121476
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+RETP4
+ADDRGP4 $1347
+JUMPV
+LABELV $1358
+ADDRGP4 cg+52
+RETP4
+LABELV $1347
+endproc CG_NextNextSnapshot 8 12
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import Wolfcam_NextSnapShotSet
+import Wolfcam_CheckNoMove
+import Wolfcam_InterpolateEntityPosition
+import Wolfcam_MarkValidEntities
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_PlayWinLossMusic
+import CG_CpmaParseGameState
+import CG_CpmaParseScores
+import CG_ExecuteNewServerCommands
+import CG_InterMissionHit
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseWarmup
+import CG_ParseServerinfo
+import CG_LoadInfectedGameTypeModels
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_PushReward
+import CG_TransitionPlayerState
+import CG_CheckChangedPredictableEvents
+import CG_Respawn
+import CG_GetAmmoWarning
+import CG_PrintPlayerState
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_NewParticleArea
+import CG_ParticleExplosion
+import CG_AddParticles
+import CG_ClearParticles
+import CG_AddMarks
+import CG_ImpactMark
+import CG_InitMarkPolys
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_ShutdownLocalEnts
+import CG_GetStoredScriptVarsFromLE
+import CG_RunFxAll
+import CG_SmokePuff_ql
+import CG_AddRefEntityFX
+import CG_AddRefEntity
+import CG_ListLocalEntities
+import CG_RemoveFXLocalEntities
+import CG_ClearLocalFrameEntities
+import CG_CullGrid
+import CG_AddToCullGrid
+import CG_BeginCullGrid
+import CG_AddLocalEntities
+import CG_MakeLowPriorityEntity
+import CG_AllocLocalEntityRealTime
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import FxLoopSounds
+import CG_FreeFxJitTokens
+import CG_ResetFXIntervalAndDistance
+import CG_UpdatePositionData
+import CG_CopyPositionDataToScript
+import CG_CopyPositionDataToCent
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+import CG_CopyPlayerDataToScriptData
+import CG_ResetScriptVars
+import CG_ReloadQ3mmeScripts
+import CG_RunQ3mmeScript
+import CG_Q3mmeMath
+import EffectScripts
+import PlainScript
+import DistanceScript
+import EmitterScript
+import EmitterScriptVars
+import ScriptVars
+import CG_FreezeTagFrozen
+import CG_CheckEvents
+import CG_EntityEvent
+import CG_CheckClientEventCpma
+import CG_PainEvent
+import CG_TimedItemPickup
+import CG_PlaceString
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1315
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 45
+byte 1 62
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 61
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1297
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 0
+align 1
+LABELV $1279
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1278
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $1268
+byte 1 94
+byte 1 53
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1267
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $1258
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1246
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $1235
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1234
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $1167
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1141
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1125
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1124
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $1113
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1109
+byte 1 10
+byte 1 0
+align 1
+LABELV $1107
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 45
+byte 1 62
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1101
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 45
+byte 1 62
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1100
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 0
+align 1
+LABELV $879
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $875
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $865
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $701
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $671
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $669
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $523
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 10
+byte 1 0
+align 1
+LABELV $244
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $243
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $220
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $205
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $201
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $184
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 83
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $178
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $176
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
@@ -0,0 +1,4912 @@
+code
+proc CG_AddSpawnVarToken 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 cg+687152
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+CNSTI4 4096
+LEI4 $145
+ADDRGP4 $148
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $145
+ADDRLP4 4
+ADDRGP4 cg+687152
+INDIRI4
+ADDRGP4 cg+687156
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12
+ADDRGP4 cg+687152
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $144
+endproc CG_AddSpawnVarToken 16 12
+proc AddTimedItem 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 16
+LTI4 $154
+ADDRGP4 $156
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $153
+JUMPV
+LABELV $154
+ADDRGP4 cg+694732
+INDIRI4
+ADDRFP4 12
+INDIRI4
+GEI4 $157
+ADDRGP4 cg+694732
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $157
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $161
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $163
+JUMPV
+LABELV $161
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $164
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $168
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $163
+JUMPV
+LABELV $168
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+NEF4 $170
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $175
+JUMPV
+LABELV $172
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $176
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $163
+JUMPV
+LABELV $176
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+NEF4 $178
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $183
+JUMPV
+LABELV $180
+ADDRFP4 8
+INDIRP4
+INDIRF4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+LEF4 $184
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $163
+JUMPV
+LABELV $184
+LABELV $181
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $183
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $180
+LABELV $178
+LABELV $173
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $175
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $172
+LABELV $170
+LABELV $165
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $167
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $164
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $186
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $186
+LABELV $163
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+LEI4 $188
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $190
+ADDRLP4 20
+CNSTI4 36
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+CNSTI4 36
+ASGNI4
+ADDRLP4 36
+ADDRLP4 32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 12
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $191
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $193
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $190
+LABELV $188
+CNSTI4 36
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 36
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $153
+endproc AddTimedItem 48 8
+data
+align 4
+LABELV $195
+address $196
+address $197
+address $198
+address $199
+address $200
+address $201
+address $202
+address $203
+address $204
+address $205
+address $206
+address $207
+address $208
+address $209
+export CG_ParseSpawnVars
+code
+proc CG_ParseSpawnVars 3248 16
+ADDRGP4 cg+686636
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+687152
+CNSTI4 0
+ASGNI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 3164
+ADDRGP4 trap_GetEntityToken
+CALLI4
+ASGNI4
+ADDRLP4 3164
+INDIRI4
+CNSTI4 0
+NEI4 $212
+CNSTI4 0
+RETI4
+ADDRGP4 $194
+JUMPV
+LABELV $212
+ADDRLP4 1024
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $218
+ADDRGP4 $216
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 3168
+ADDRGP4 trap_GetEntityToken
+CALLI4
+ASGNI4
+ADDRLP4 3168
+INDIRI4
+CNSTI4 0
+NEI4 $220
+ADDRGP4 $222
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $220
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $223
+ADDRGP4 $219
+JUMPV
+LABELV $223
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 3172
+ADDRGP4 trap_GetEntityToken
+CALLI4
+ASGNI4
+ADDRLP4 3172
+INDIRI4
+CNSTI4 0
+NEI4 $225
+ADDRGP4 $222
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $225
+ADDRLP4 1024
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $227
+ADDRGP4 $229
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $227
+ADDRGP4 cg+686636
+INDIRI4
+CNSTI4 64
+NEI4 $230
+ADDRGP4 $233
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $230
+ADDRLP4 0
+ARGP4
+ADDRLP4 3176
+ADDRGP4 CG_AddSpawnVarToken
+CALLP4
+ASGNP4
+ADDRGP4 cg+686636
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+686640
+ADDP4
+ADDRLP4 3176
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 3180
+ADDRGP4 CG_AddSpawnVarToken
+CALLP4
+ASGNP4
+ADDRGP4 cg+686636
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+686640+4
+ADDP4
+ADDRLP4 3180
+INDIRP4
+ASGNP4
+ADDRLP4 3184
+ADDRGP4 cg+686636
+ASGNP4
+ADDRLP4 3184
+INDIRP4
+ADDRLP4 3184
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 3188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3188
+INDIRI4
+CNSTI4 0
+NEI4 $240
+ADDRLP4 1024
+ARGP4
+ADDRLP4 3192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3874620
+ADDRLP4 3192
+INDIRI4
+ASGNI4
+ADDRGP4 $241
+JUMPV
+LABELV $240
+ADDRLP4 0
+ARGP4
+ADDRGP4 $246
+ARGP4
+ADDRLP4 3192
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3192
+INDIRI4
+CNSTI4 0
+NEI4 $244
+ADDRLP4 1024
+ARGP4
+ADDRLP4 3196
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+3874616
+ADDRLP4 3196
+INDIRI4
+ASGNI4
+LABELV $244
+LABELV $241
+LABELV $218
+ADDRGP4 $217
+JUMPV
+LABELV $219
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $248
+LABELV $248
+ADDRLP4 3136
+CNSTI4 6
+ASGNI4
+ADDRLP4 3168
+CNSTI4 0
+ASGNI4
+ADDRLP4 3128
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 3104
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 3140
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 3144
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 2064
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 2072
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 3100
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 3132
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 3120
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 3108
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 3124
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 3112
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 3116
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRLP4 2068
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 3172
+ADDRGP4 trap_GetEntityToken
+CALLI4
+ASGNI4
+ADDRLP4 3172
+INDIRI4
+CNSTI4 0
+NEI4 $254
+ADDRGP4 $253
+JUMPV
+LABELV $254
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $256
+ADDRLP4 3136
+CNSTI4 6
+ASGNI4
+ADDRLP4 3176
+CNSTI4 0
+ASGNI4
+ADDRLP4 3128
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 3104
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 3140
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 3144
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 2064
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 2072
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 3100
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 3132
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 3120
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 3108
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 3124
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 3112
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 3116
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRLP4 2068
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRGP4 $252
+JUMPV
+LABELV $256
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $258
+ADDRLP4 2064
+INDIRI4
+CNSTI4 0
+EQI4 $260
+ADDRLP4 2048
+ADDRGP4 cg+694736
+INDIRI4
+ASGNI4
+ADDRLP4 2048
+INDIRI4
+CNSTI4 128
+LTI4 $263
+ADDRGP4 $252
+JUMPV
+LABELV $263
+CNSTI4 36
+ADDRLP4 2048
+INDIRI4
+MULI4
+ADDRGP4 cg+694740
+ADDP4
+ADDRLP4 2052
+INDIRB
+ASGNB 12
+CNSTI4 36
+ADDRLP4 2048
+INDIRI4
+MULI4
+ADDRGP4 cg+694740+12
+ADDP4
+ADDRLP4 3140
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 2048
+INDIRI4
+MULI4
+ADDRGP4 cg+694740+16
+ADDP4
+ADDRLP4 3144
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 2048
+INDIRI4
+MULI4
+ADDRGP4 cg+694740+20
+ADDP4
+ADDRLP4 2072
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 2048
+INDIRI4
+MULI4
+ADDRGP4 cg+694740+24
+ADDP4
+ADDRLP4 3100
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 2048
+INDIRI4
+MULI4
+ADDRGP4 cg+694740+28
+ADDP4
+ADDRLP4 3132
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 2048
+INDIRI4
+MULI4
+ADDRGP4 cg+694740+32
+ADDP4
+ADDRLP4 3120
+INDIRI4
+ASGNI4
+ADDRLP4 3176
+ADDRGP4 cg+694736
+ASGNP4
+ADDRLP4 3176
+INDIRP4
+ADDRLP4 3176
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $252
+JUMPV
+LABELV $260
+ADDRLP4 3108
+INDIRI4
+CNSTI4 0
+EQI4 $279
+ADDRLP4 3124
+INDIRI4
+CNSTI4 0
+NEI4 $252
+ADDRGP4 cg+699348
+INDIRI4
+CNSTI4 1024
+LEI4 $283
+ADDRGP4 $286
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $283
+CNSTI4 12
+ADDRGP4 cg+699348
+INDIRI4
+MULI4
+ADDRGP4 cg+699352
+ADDP4
+ADDRLP4 2052
+INDIRB
+ASGNB 12
+ADDRLP4 3176
+ADDRGP4 cg+699348
+ASGNP4
+ADDRLP4 3176
+INDIRP4
+ADDRLP4 3176
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $252
+JUMPV
+LABELV $279
+ADDRLP4 3112
+INDIRI4
+CNSTI4 0
+EQI4 $290
+ADDRGP4 cg+6706352
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+6706360
+ADDRLP4 2052
+INDIRB
+ASGNB 12
+ADDRGP4 $294
+ARGP4
+ADDRLP4 2052
+INDIRF4
+ARGF4
+ADDRLP4 2052+4
+INDIRF4
+ARGF4
+ADDRLP4 2052+8
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $290
+ADDRLP4 3116
+INDIRI4
+CNSTI4 0
+EQI4 $297
+ADDRGP4 cg+6706356
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+6706372
+ADDRLP4 2052
+INDIRB
+ASGNB 12
+ADDRGP4 $301
+ARGP4
+ADDRLP4 2052
+INDIRF4
+ARGF4
+ADDRLP4 2052+4
+INDIRF4
+ARGF4
+ADDRLP4 2052+8
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $297
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 2052
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 3176
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 3148
+ADDRLP4 3176
+INDIRI4
+ASGNI4
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRLP4 3148
+CNSTI4 0
+ASGNI4
+LABELV $305
+ADDRLP4 3104
+INDIRI4
+CNSTI4 0
+EQI4 $306
+ADDRGP4 $252
+JUMPV
+LABELV $306
+ADDRLP4 3148
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $308
+ADDRGP4 $252
+JUMPV
+LABELV $308
+ADDRLP4 3136
+INDIRI4
+CNSTI4 1
+NEI4 $310
+ADDRLP4 3128
+INDIRI4
+CNSTI4 0
+NEI4 $312
+ADDRLP4 3128
+CNSTI4 25
+ASGNI4
+LABELV $312
+ADDRGP4 cg+691252
+ARGP4
+ADDRGP4 cg+691256
+ARGP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 3128
+INDIRI4
+ARGI4
+ADDRGP4 AddTimedItem
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $310
+ADDRLP4 3136
+INDIRI4
+CNSTI4 2
+NEI4 $316
+ADDRLP4 3128
+INDIRI4
+CNSTI4 0
+NEI4 $318
+ADDRLP4 3128
+CNSTI4 25
+ASGNI4
+LABELV $318
+ADDRGP4 cg+691832
+ARGP4
+ADDRGP4 cg+691836
+ARGP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 3128
+INDIRI4
+ARGI4
+ADDRGP4 AddTimedItem
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $316
+ADDRLP4 3136
+INDIRI4
+CNSTI4 3
+NEI4 $322
+ADDRLP4 3128
+INDIRI4
+CNSTI4 0
+NEI4 $324
+ADDRLP4 3128
+CNSTI4 25
+ASGNI4
+LABELV $324
+ADDRGP4 cg+692412
+ARGP4
+ADDRGP4 cg+692416
+ARGP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 3128
+INDIRI4
+ARGI4
+ADDRGP4 AddTimedItem
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $322
+ADDRLP4 3136
+INDIRI4
+CNSTI4 0
+NEI4 $328
+ADDRLP4 3128
+INDIRI4
+CNSTI4 0
+NEI4 $330
+ADDRLP4 3128
+CNSTI4 35
+ASGNI4
+LABELV $330
+ADDRGP4 cg+692992
+ARGP4
+ADDRGP4 cg+692996
+ARGP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 3128
+INDIRI4
+ARGI4
+ADDRGP4 AddTimedItem
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $328
+ADDRLP4 3136
+INDIRI4
+CNSTI4 4
+NEI4 $334
+ADDRLP4 3128
+INDIRI4
+CNSTI4 0
+NEI4 $336
+ADDRLP4 3128
+CNSTI4 120
+ASGNI4
+LABELV $336
+ADDRGP4 cg+693572
+ARGP4
+ADDRGP4 cg+693576
+ARGP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 3128
+INDIRI4
+ARGI4
+ADDRGP4 AddTimedItem
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $334
+ADDRLP4 3136
+INDIRI4
+CNSTI4 5
+NEI4 $252
+ADDRLP4 3128
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRLP4 3128
+CNSTI4 120
+ASGNI4
+LABELV $342
+ADDRGP4 cg+694152
+ARGP4
+ADDRGP4 cg+694156
+ARGP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 3128
+INDIRI4
+ARGI4
+ADDRGP4 AddTimedItem
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $258
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 3176
+ADDRGP4 trap_GetEntityToken
+CALLI4
+ASGNI4
+ADDRLP4 3176
+INDIRI4
+CNSTI4 0
+NEI4 $346
+ADDRGP4 $222
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $346
+ADDRLP4 1024
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $348
+ADDRGP4 $229
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $348
+ADDRLP4 0
+ARGP4
+ADDRGP4 $352
+ARGP4
+ADDRLP4 3180
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3180
+INDIRI4
+CNSTI4 0
+NEI4 $350
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 3184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3184
+INDIRI4
+CNSTI4 0
+EQI4 $357
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 3188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3188
+INDIRI4
+CNSTI4 0
+NEI4 $353
+LABELV $357
+ADDRLP4 3192
+CNSTI4 1
+ASGNI4
+ADDRLP4 2064
+ADDRLP4 3192
+INDIRI4
+ASGNI4
+ADDRLP4 3120
+ADDRLP4 3192
+INDIRI4
+ASGNI4
+ADDRLP4 3100
+ADDRLP4 3192
+INDIRI4
+ASGNI4
+ADDRLP4 2072
+ADDRLP4 3192
+INDIRI4
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $353
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $360
+ARGP4
+ADDRLP4 3192
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3192
+INDIRI4
+CNSTI4 0
+NEI4 $358
+ADDRLP4 3196
+CNSTI4 1
+ASGNI4
+ADDRLP4 2064
+ADDRLP4 3196
+INDIRI4
+ASGNI4
+ADDRLP4 2072
+ADDRLP4 3196
+INDIRI4
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $358
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $363
+ARGP4
+ADDRLP4 3196
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3196
+INDIRI4
+CNSTI4 0
+NEI4 $361
+ADDRLP4 3200
+CNSTI4 1
+ASGNI4
+ADDRLP4 2064
+ADDRLP4 3200
+INDIRI4
+ASGNI4
+ADDRLP4 3100
+ADDRLP4 3200
+INDIRI4
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $361
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $366
+ARGP4
+ADDRLP4 3200
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3200
+INDIRI4
+CNSTI4 0
+NEI4 $364
+ADDRLP4 3204
+CNSTI4 1
+ASGNI4
+ADDRLP4 2064
+ADDRLP4 3204
+INDIRI4
+ASGNI4
+ADDRLP4 2072
+ADDRLP4 3204
+INDIRI4
+ASGNI4
+ADDRLP4 3132
+ADDRLP4 3204
+INDIRI4
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $364
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $369
+ARGP4
+ADDRLP4 3204
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3204
+INDIRI4
+CNSTI4 0
+NEI4 $367
+ADDRLP4 3208
+CNSTI4 1
+ASGNI4
+ADDRLP4 2064
+ADDRLP4 3208
+INDIRI4
+ASGNI4
+ADDRLP4 3100
+ADDRLP4 3208
+INDIRI4
+ASGNI4
+ADDRLP4 3132
+ADDRLP4 3208
+INDIRI4
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $367
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $372
+ARGP4
+ADDRLP4 3208
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3208
+INDIRI4
+CNSTI4 0
+NEI4 $370
+ADDRLP4 3136
+CNSTI4 1
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $370
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $375
+ARGP4
+ADDRLP4 3212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3212
+INDIRI4
+CNSTI4 0
+NEI4 $373
+ADDRLP4 3136
+CNSTI4 2
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $373
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 3216
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3216
+INDIRI4
+CNSTI4 0
+NEI4 $376
+ADDRLP4 3136
+CNSTI4 3
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $376
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 3220
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3220
+INDIRI4
+CNSTI4 0
+NEI4 $379
+ADDRLP4 3136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $379
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $384
+ARGP4
+ADDRLP4 3224
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3224
+INDIRI4
+CNSTI4 0
+NEI4 $382
+ADDRLP4 3136
+CNSTI4 4
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $382
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 3228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3228
+INDIRI4
+CNSTI4 0
+NEI4 $385
+ADDRLP4 3136
+CNSTI4 5
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $385
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $390
+ARGP4
+ADDRLP4 3232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3232
+INDIRI4
+CNSTI4 0
+NEI4 $388
+ADDRLP4 3108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $388
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $393
+ARGP4
+ADDRLP4 3236
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3236
+INDIRI4
+CNSTI4 0
+NEI4 $391
+ADDRLP4 3112
+CNSTI4 1
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $391
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 3240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3240
+INDIRI4
+CNSTI4 0
+NEI4 $351
+ADDRLP4 3116
+CNSTI4 1
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 0
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 3184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3184
+INDIRI4
+CNSTI4 0
+NEI4 $397
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 3188
+ADDRGP4 SC_ParseVec3FromStr
+CALLI4
+ASGNI4
+ADDRLP4 3188
+INDIRI4
+CNSTI4 -1
+NEI4 $400
+ADDRLP4 3192
+CNSTF4 0
+ASGNF4
+ADDRLP4 2052
+ADDRLP4 3192
+INDIRF4
+ASGNF4
+ADDRLP4 2052+4
+ADDRLP4 3192
+INDIRF4
+ASGNF4
+ADDRLP4 2052+8
+CNSTF4 0
+ASGNF4
+LABELV $400
+ADDRLP4 2068
+CNSTI4 1
+ASGNI4
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRLP4 0
+ARGP4
+ADDRGP4 $406
+ARGP4
+ADDRLP4 3188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3188
+INDIRI4
+CNSTI4 0
+NEI4 $404
+ADDRLP4 3124
+CNSTI4 1
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 0
+ARGP4
+ADDRGP4 $409
+ARGP4
+ADDRLP4 3192
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3192
+INDIRI4
+CNSTI4 0
+NEI4 $407
+ADDRLP4 1024
+ARGP4
+ADDRLP4 3196
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3128
+ADDRLP4 3196
+INDIRI4
+ASGNI4
+ADDRGP4 $408
+JUMPV
+LABELV $407
+ADDRLP4 0
+ARGP4
+ADDRGP4 $412
+ARGP4
+ADDRLP4 3196
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3196
+INDIRI4
+CNSTI4 0
+NEI4 $410
+ADDRLP4 1024
+ARGP4
+ADDRLP4 3200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3160
+ADDRLP4 3200
+INDIRI4
+ASGNI4
+ADDRLP4 3160
+INDIRI4
+CNSTI4 0
+EQI4 $411
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 3204
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 3204
+INDIRI4
+CNSTI4 0
+EQI4 $411
+ADDRLP4 3104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRLP4 0
+ARGP4
+ADDRGP4 $418
+ARGP4
+ADDRLP4 3200
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3200
+INDIRI4
+CNSTI4 0
+NEI4 $416
+ADDRLP4 3204
+ADDRLP4 1024
+ASGNP4
+ADDRLP4 3216
+ADDRLP4 1024
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 3216
+INDIRI4
+CNSTI4 48
+LTI4 $419
+ADDRLP4 3216
+INDIRI4
+CNSTI4 57
+GTI4 $419
+ADDRLP4 1024
+ARGP4
+ADDRLP4 3220
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3160
+ADDRLP4 3220
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $421
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $424
+ADDRLP4 3160
+INDIRI4
+CNSTI4 2
+NEI4 $417
+ADDRLP4 3104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $424
+ADDRGP4 cgs+39688
+INDIRI4
+ADDRLP4 3160
+INDIRI4
+NEI4 $417
+ADDRLP4 3104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $421
+ADDRGP4 cgs+39688
+INDIRI4
+ADDRLP4 3160
+INDIRI4
+NEI4 $417
+ADDRLP4 3104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $419
+ADDRLP4 3208
+CNSTP4 0
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CVIU4 4
+CNSTU4 14
+GEU4 $435
+ADDRLP4 3212
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $195
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3204
+INDIRP4
+ARGP4
+ADDRLP4 3212
+INDIRP4
+ARGP4
+ADDRLP4 3220
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 3208
+ADDRLP4 3220
+INDIRP4
+ASGNP4
+LABELV $435
+ADDRLP4 3208
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $439
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+NEI4 $441
+ADDRLP4 3204
+INDIRP4
+ARGP4
+ADDRGP4 $444
+ARGP4
+ADDRLP4 3220
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 3208
+ADDRLP4 3220
+INDIRP4
+ASGNP4
+ADDRGP4 $442
+JUMPV
+LABELV $441
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $445
+ADDRLP4 3204
+INDIRP4
+ARGP4
+ADDRGP4 $448
+ARGP4
+ADDRLP4 3220
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 3208
+ADDRLP4 3220
+INDIRP4
+ASGNP4
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $449
+ADDRLP4 3204
+INDIRP4
+ARGP4
+ADDRGP4 $452
+ARGP4
+ADDRLP4 3220
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 3208
+ADDRLP4 3220
+INDIRP4
+ASGNP4
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $453
+ADDRLP4 3204
+INDIRP4
+ARGP4
+ADDRGP4 $456
+ARGP4
+ADDRLP4 3220
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 3208
+ADDRLP4 3220
+INDIRP4
+ASGNP4
+ADDRGP4 $454
+JUMPV
+LABELV $453
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 7
+NEI4 $457
+ADDRLP4 3204
+INDIRP4
+ARGP4
+ADDRGP4 $460
+ARGP4
+ADDRLP4 3220
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 3208
+ADDRLP4 3220
+INDIRP4
+ASGNP4
+LABELV $457
+LABELV $454
+LABELV $450
+LABELV $446
+LABELV $442
+LABELV $439
+ADDRLP4 3208
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $417
+ADDRLP4 3104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRLP4 0
+ARGP4
+ADDRGP4 $465
+ARGP4
+ADDRLP4 3204
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3204
+INDIRI4
+CNSTI4 0
+NEI4 $463
+ADDRLP4 3208
+CNSTI4 0
+ASGNI4
+ADDRLP4 3104
+CNSTI4 1
+ASGNI4
+ADDRLP4 3152
+ADDRLP4 1024
+ASGNP4
+ADDRLP4 3156
+CNSTI4 0
+ASGNI4
+ADDRGP4 $467
+JUMPV
+LABELV $466
+ADDRLP4 3152
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 3156
+ARGP4
+ADDRLP4 3216
+ADDRGP4 CG_GetTokenGameType
+CALLP4
+ASGNP4
+ADDRLP4 3152
+ADDRLP4 3216
+INDIRP4
+ASGNP4
+ADDRLP4 2076
+ARGP4
+ADDRLP4 3220
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 3212
+ADDRLP4 3220
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 3224
+CNSTI4 0
+ASGNI4
+ADDRLP4 3212
+INDIRI4
+ADDRLP4 3224
+INDIRI4
+EQI4 $469
+ADDRLP4 2076
+INDIRI1
+CVII4 1
+ADDRLP4 3224
+INDIRI4
+EQI4 $469
+ADDRLP4 3212
+INDIRI4
+ADDRLP4 2076-1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 44
+NEI4 $471
+ADDRLP4 3212
+INDIRI4
+ADDRLP4 2076-1
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $471
+LABELV $469
+ADDRLP4 2048
+CNSTI4 0
+ASGNI4
+ADDRGP4 $478
+JUMPV
+LABELV $475
+ADDRLP4 2076
+ARGP4
+ADDRLP4 2048
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $195
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 3228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3228
+INDIRI4
+CNSTI4 0
+NEI4 $479
+ADDRLP4 3208
+CNSTI4 1
+ASGNI4
+ADDRGP4 $477
+JUMPV
+LABELV $479
+LABELV $476
+ADDRLP4 2048
+ADDRLP4 2048
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $478
+ADDRLP4 2048
+INDIRI4
+CVIU4 4
+CNSTU4 14
+LTU4 $475
+LABELV $477
+ADDRLP4 3208
+INDIRI4
+CNSTI4 0
+NEI4 $481
+ADDRLP4 2076
+ARGP4
+ADDRGP4 $444
+ARGP4
+ADDRLP4 3228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3228
+INDIRI4
+CNSTI4 0
+NEI4 $483
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+NEI4 $482
+ADDRLP4 3104
+CNSTI4 0
+ASGNI4
+ADDRGP4 $482
+JUMPV
+LABELV $483
+ADDRLP4 2076
+ARGP4
+ADDRGP4 $448
+ARGP4
+ADDRLP4 3232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3232
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $482
+ADDRLP4 3104
+CNSTI4 0
+ASGNI4
+ADDRGP4 $482
+JUMPV
+LABELV $488
+ADDRLP4 2076
+ARGP4
+ADDRGP4 $452
+ARGP4
+ADDRLP4 3236
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3236
+INDIRI4
+CNSTI4 0
+NEI4 $493
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 8
+NEI4 $482
+ADDRLP4 3104
+CNSTI4 0
+ASGNI4
+ADDRGP4 $482
+JUMPV
+LABELV $493
+ADDRLP4 2076
+ARGP4
+ADDRGP4 $456
+ARGP4
+ADDRLP4 3240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3240
+INDIRI4
+CNSTI4 0
+NEI4 $498
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $482
+ADDRLP4 3104
+CNSTI4 0
+ASGNI4
+ADDRGP4 $482
+JUMPV
+LABELV $498
+ADDRLP4 2076
+ARGP4
+ADDRGP4 $505
+ARGP4
+ADDRLP4 3244
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3244
+INDIRI4
+CNSTI4 0
+NEI4 $503
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 7
+NEI4 $482
+ADDRLP4 3104
+CNSTI4 0
+ASGNI4
+ADDRGP4 $482
+JUMPV
+LABELV $503
+ADDRGP4 $509
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2076
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $482
+JUMPV
+LABELV $481
+ADDRGP4 cgs+39688
+INDIRI4
+CVIU4 4
+CNSTU4 14
+GEU4 $510
+ADDRLP4 2076
+ARGP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $195
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 3228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3228
+INDIRI4
+CNSTI4 0
+NEI4 $510
+ADDRLP4 3104
+CNSTI4 0
+ASGNI4
+LABELV $510
+LABELV $482
+LABELV $467
+ADDRLP4 3212
+CNSTI4 0
+ASGNI4
+ADDRLP4 3152
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 3212
+INDIRI4
+EQI4 $514
+ADDRLP4 3156
+INDIRI4
+ADDRLP4 3212
+INDIRI4
+EQI4 $466
+LABELV $514
+ADDRGP4 $464
+JUMPV
+LABELV $463
+ADDRLP4 0
+ARGP4
+ADDRGP4 $517
+ARGP4
+ADDRLP4 3208
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3208
+INDIRI4
+CNSTI4 0
+NEI4 $515
+ADDRLP4 1024
+ARGP4
+ADDRLP4 3212
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3160
+ADDRLP4 3212
+INDIRI4
+ASGNI4
+ADDRLP4 3216
+CNSTI4 0
+ASGNI4
+ADDRLP4 3160
+INDIRI4
+ADDRLP4 3216
+INDIRI4
+EQI4 $516
+ADDRGP4 cgs+39688
+INDIRI4
+ADDRLP4 3216
+INDIRI4
+EQI4 $522
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 1
+NEI4 $516
+LABELV $522
+ADDRLP4 3104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRLP4 0
+ARGP4
+ADDRGP4 $525
+ARGP4
+ADDRLP4 3212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3212
+INDIRI4
+CNSTI4 0
+NEI4 $523
+ADDRLP4 1024
+ARGP4
+ADDRLP4 3216
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3160
+ADDRLP4 3216
+INDIRI4
+ASGNI4
+ADDRLP4 3160
+INDIRI4
+CNSTI4 0
+EQI4 $524
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 16
+NEI4 $524
+ADDRLP4 3104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $524
+JUMPV
+LABELV $523
+ADDRLP4 0
+ARGP4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 3216
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3216
+INDIRI4
+CNSTI4 0
+NEI4 $529
+ADDRLP4 1024
+ARGP4
+ADDRLP4 3220
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3140
+ADDRLP4 3220
+INDIRI4
+ASGNI4
+ADDRGP4 $530
+JUMPV
+LABELV $529
+ADDRLP4 0
+ARGP4
+ADDRGP4 $534
+ARGP4
+ADDRLP4 3220
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3220
+INDIRI4
+CNSTI4 0
+NEI4 $532
+ADDRLP4 1024
+ARGP4
+ADDRLP4 3224
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3144
+ADDRLP4 3224
+INDIRI4
+ASGNI4
+LABELV $532
+LABELV $530
+LABELV $524
+LABELV $516
+LABELV $464
+LABELV $417
+LABELV $411
+LABELV $408
+LABELV $405
+LABELV $398
+LABELV $351
+LABELV $252
+ADDRGP4 $251
+JUMPV
+LABELV $253
+CNSTI4 1
+RETI4
+LABELV $194
+endproc CG_ParseSpawnVars 3248 16
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $534
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $531
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $525
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $517
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 0
+align 1
+LABELV $509
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $505
+byte 1 111
+byte 1 98
+byte 1 0
+align 1
+LABELV $465
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $460
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 0
+align 1
+LABELV $456
+byte 1 49
+byte 1 102
+byte 1 0
+align 1
+LABELV $452
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $448
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $444
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 0
+align 1
+LABELV $418
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $412
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $409
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $406
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $399
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $396
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $393
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $390
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $387
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 114
+byte 1 111
+byte 1 0
+align 1
+LABELV $384
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $381
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $378
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 106
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $375
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $372
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $369
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $366
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $363
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $360
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $356
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $355
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $352
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $301
+byte 1 94
+byte 1 53
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $294
+byte 1 94
+byte 1 53
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $286
+byte 1 94
+byte 1 51
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $246
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 66
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $242
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 68
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $233
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $229
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 0
+align 1
+LABELV $222
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 69
+byte 1 79
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $216
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 123
+byte 1 0
+align 1
+LABELV $209
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $208
+byte 1 114
+byte 1 114
+byte 1 0
+align 1
+LABELV $207
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $206
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $205
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $204
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $203
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $202
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $201
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $200
+byte 1 99
+byte 1 97
+byte 1 0
+align 1
+LABELV $199
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $198
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $197
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $196
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $156
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 84
+byte 1 73
+byte 1 77
+byte 1 69
+byte 1 68
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $148
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 0
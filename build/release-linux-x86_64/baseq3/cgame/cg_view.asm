@@ -0,0 +1,27138 @@
+export CG_TestModel_f
+code
+proc CG_TestModel_f 36 12
+ADDRGP4 cg+627508
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+GEI4 $163
+ADDRGP4 $160
+JUMPV
+LABELV $163
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 cg+627680
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+627680
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+627508+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+NEI4 $169
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+627508+100
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 cg+627508+80
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+627508+96
+CNSTI4 0
+ASGNI4
+LABELV $169
+ADDRGP4 cg+627508+8
+INDIRI4
+CNSTI4 0
+NEI4 $177
+ADDRGP4 $181
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $160
+JUMPV
+LABELV $177
+ADDRGP4 cg+627508+68
+ADDRGP4 cg+609412+24
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+609412+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+627508+68+4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+609412+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+627508+68+8
+ADDRGP4 cg+609412+24+8
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+609412+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 cg+609780+4
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+627508+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+627744
+CNSTI4 0
+ASGNI4
+LABELV $160
+endproc CG_TestModel_f 36 12
+export CG_TestGun_f
+proc CG_TestGun_f 0 0
+ADDRGP4 CG_TestModel_f
+CALLV
+pop
+ADDRGP4 cg+627744
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+627508+4
+CNSTI4 13
+ASGNI4
+LABELV $213
+endproc CG_TestGun_f 0 0
+export CG_TestModelNextFrame_f
+proc CG_TestModelNextFrame_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+627508+80
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 cg+627508+80
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $217
+endproc CG_TestModelNextFrame_f 4 8
+export CG_TestModelPrevFrame_f
+proc CG_TestModelPrevFrame_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+627508+80
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+627508+80
+INDIRI4
+CNSTI4 0
+GEI4 $226
+ADDRGP4 cg+627508+80
+CNSTI4 0
+ASGNI4
+LABELV $226
+ADDRGP4 $220
+ARGP4
+ADDRGP4 cg+627508+80
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $223
+endproc CG_TestModelPrevFrame_f 4 8
+export CG_TestModelNextSkin_f
+proc CG_TestModelNextSkin_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+627508+104
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $237
+ARGP4
+ADDRGP4 cg+627508+104
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $234
+endproc CG_TestModelNextSkin_f 4 8
+export CG_TestModelPrevSkin_f
+proc CG_TestModelPrevSkin_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+627508+104
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+627508+104
+INDIRI4
+CNSTI4 0
+GEI4 $243
+ADDRGP4 cg+627508+104
+CNSTI4 0
+ASGNI4
+LABELV $243
+ADDRGP4 $237
+ARGP4
+ADDRGP4 cg+627508+104
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $240
+endproc CG_TestModelPrevSkin_f 4 8
+proc CG_AddTestModel 32 4
+ADDRGP4 cg+627680
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+627508+8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627508+8
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRGP4 $181
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $255
+ADDRGP4 cg+627744
+INDIRI4
+CNSTI4 0
+EQI4 $259
+ADDRGP4 cg+627508+68
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+627508+28
+ADDRGP4 cg+609412+36
+INDIRB
+ASGNB 12
+ADDRGP4 cg+627508+28+12
+ADDRGP4 cg+609412+36+12
+INDIRB
+ASGNB 12
+ADDRGP4 cg+627508+28+24
+ADDRGP4 cg+609412+36+24
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $282
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+627508+68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+609412+36
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+627508+68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+609412+36+12
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+627508+68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+609412+36+24
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $283
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $282
+LABELV $259
+ADDRGP4 cg+627508
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $251
+endproc CG_AddTestModel 32 4
+export CG_CalcVrect
+proc CG_CalcVrect 12 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $305
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 30
+GEI4 $308
+ADDRGP4 $311
+ARGP4
+ADDRGP4 $312
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 30
+ASGNI4
+ADDRGP4 $309
+JUMPV
+LABELV $308
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 100
+LEI4 $313
+ADDRGP4 $311
+ARGP4
+ADDRGP4 $316
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $314
+JUMPV
+LABELV $313
+ADDRLP4 0
+ADDRGP4 cg_viewsize+12
+INDIRI4
+ASGNI4
+LABELV $314
+LABELV $309
+LABELV $306
+ADDRGP4 cg+609412+8
+ADDRGP4 cgs+20100+19496
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+609412+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 cg+609412+12
+ADDRGP4 cgs+20100+19500
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+609412+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 cg+609412
+ADDRGP4 cgs+20100+19496
+INDIRI4
+ADDRGP4 cg+609412+8
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRGP4 cg+609412+4
+ADDRGP4 cgs+20100+19500
+INDIRI4
+ADDRGP4 cg+609412+12
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+LABELV $304
+endproc CG_CalcVrect 12 8
+data
+align 4
+LABELV $342
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $343
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+code
+proc CG_OffsetThirdPersonView 208 28
+ADDRLP4 152
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRF4
+ADDRGP4 cg+607196+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRLP4 156
+CNSTI4 2
+ASGNI4
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 156
+INDIRI4
+LSHI4
+ADDRGP4 cg+607196+184
+ADDP4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+GTI4 $350
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 160
+INDIRI4
+NEI4 $359
+ADDRGP4 cg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $359
+ADDRGP4 PERS_TEAM
+INDIRI4
+ADDRLP4 156
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $350
+LABELV $359
+ADDRGP4 cg_deathStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $360
+ADDRGP4 cg+617072
+INDIRI4
+CNSTI4 0
+LTI4 $361
+ADDRGP4 cg+617072
+INDIRI4
+CNSTI4 64
+GEI4 $361
+ADDRGP4 cg+617072
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $361
+ADDRLP4 56+4
+ADDRGP4 cg+617088+4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609780+4
+ADDRGP4 cg+617088+4
+INDIRF4
+ASGNF4
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRGP4 cg_deathStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $376
+ADDRGP4 cg+617072
+INDIRI4
+CNSTI4 0
+LTI4 $377
+ADDRGP4 cg+617072
+INDIRI4
+CNSTI4 64
+GEI4 $377
+ADDRGP4 cg+617072
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $377
+ADDRLP4 164
+CNSTI4 1496
+ASGNI4
+ADDRLP4 24
+ADDRLP4 164
+INDIRI4
+ADDRGP4 cg+617072
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 164
+INDIRI4
+ADDRGP4 cg+617072
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+4
+ADDP4
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+CNSTI4 1496
+ADDRGP4 cg+617072
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+8
+ADDP4
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 cg+609780
+ADDRLP4 140
+INDIRB
+ASGNB 12
+ADDRGP4 $341
+JUMPV
+LABELV $376
+ADDRGP4 cg_deathStyle+12
+INDIRI4
+CNSTI4 3
+NEI4 $399
+ADDRLP4 56+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+609780+4
+CNSTF4 0
+ASGNF4
+LABELV $399
+LABELV $377
+LABELV $361
+LABELV $350
+ADDRLP4 56
+INDIRF4
+CNSTF4 1110704128
+LEF4 $405
+ADDRLP4 56
+CNSTF4 1110704128
+ASGNF4
+LABELV $405
+ADDRLP4 56
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 164
+CNSTP4 0
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 168
+CNSTF4 1140850688
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+609412+24
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 cg+609412+24+8
+INDIRF4
+CNSTF4 1140850688
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 172
+ADDRGP4 cg+609780
+ASGNP4
+ADDRLP4 172
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 172
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+609780
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+CNSTF4 1078530011
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 176
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 176
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 180
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 48
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 48
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 48
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_cameraMode+12
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRLP4 72
+ARGP4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRGP4 $343
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+607196+140
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $451
+ADDRLP4 0
+ADDRLP4 72+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1107296256
+CNSTF4 1065353216
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRGP4 $343
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+607196+140
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 72+12
+INDIRB
+ASGNB 12
+LABELV $451
+LABELV $444
+ADDRGP4 cg+609412+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 192
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 196
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 1065353216
+GEF4 $478
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+LABELV $478
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 200
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRGP4 cg+609780
+CNSTF4 3261411041
+ADDRLP4 200
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 204
+ADDRGP4 cg+609780+4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ADDRLP4 204
+INDIRP4
+INDIRF4
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $341
+endproc CG_OffsetThirdPersonView 208 28
+proc CG_OffsetQuakeLiveSpec 0 0
+LABELV $485
+endproc CG_OffsetQuakeLiveSpec 0 0
+proc CG_StepOffset 16 0
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $487
+ADDRGP4 cg_demoStepSmoothing+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $487
+ADDRGP4 $486
+JUMPV
+LABELV $487
+ADDRGP4 cg_stepSmoothTime+8
+INDIRF4
+CNSTF4 0
+GTF4 $491
+ADDRGP4 $486
+JUMPV
+LABELV $491
+ADDRLP4 0
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+609292
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_stepSmoothTime+8
+INDIRF4
+GEF4 $496
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $499
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $499
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $499
+ADDRGP4 cg+609412+24+8
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $499
+ADDRLP4 12
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 cg+609288
+INDIRF4
+ADDRGP4 cg_stepSmoothTime+8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDRGP4 cg_stepSmoothTime+8
+INDIRF4
+DIVF4
+SUBF4
+ASGNF4
+LABELV $496
+LABELV $486
+endproc CG_StepOffset 16 0
+proc CG_OffsetFirstPersonView 60 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $516
+ADDRGP4 $515
+JUMPV
+LABELV $516
+ADDRLP4 8
+ADDRGP4 cg+609412+24
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+609780
+ASGNP4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $522
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+GTI4 $522
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTF4 3245342720
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+617088+4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRGP4 cg+607196+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $515
+JUMPV
+LABELV $522
+ADDRGP4 cg+627432
+INDIRF4
+CNSTF4 0
+EQF4 $529
+ADDRLP4 16
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+627432
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg_kickScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1120403456
+GEF4 $535
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+627480
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+627484
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $536
+JUMPV
+LABELV $535
+ADDRLP4 16
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+CNSTF4 1137180672
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+LEF4 $539
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+627480
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+627484
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $539
+LABELV $536
+LABELV $529
+ADDRGP4 cg+627496
+INDIRF4
+CNSTF4 1128792064
+LEF4 $546
+ADDRLP4 36
+ADDRGP4 cg+627496
+INDIRF4
+ASGNF4
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRLP4 36
+CNSTF4 1128792064
+ASGNF4
+LABELV $547
+ADDRLP4 20
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+627488
+INDIRF4
+ADDRGP4 cg_bobpitch+8
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+607196+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $550
+ADDRLP4 0
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $550
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+627488
+INDIRF4
+ADDRGP4 cg_bobroll+8
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+607196+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $556
+ADDRLP4 0
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $556
+ADDRGP4 cg+627492
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $560
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $560
+ADDRLP4 44
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRGP4 cg+607196+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+609300
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 100
+GEI4 $567
+ADDRLP4 52
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRGP4 cg+609296
+INDIRF4
+CNSTI4 100
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1120403456
+DIVF4
+SUBF4
+ASGNF4
+LABELV $567
+ADDRLP4 12
+ADDRGP4 cg+627488
+INDIRF4
+ADDRGP4 cg+627496
+INDIRF4
+MULF4
+ADDRGP4 cg_bobup+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1086324736
+LEF4 $576
+ADDRLP4 12
+CNSTF4 1086324736
+ASGNF4
+LABELV $576
+ADDRLP4 52
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+609308
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+GEF4 $580
+ADDRLP4 28
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRGP4 cg+609304
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $581
+JUMPV
+LABELV $580
+ADDRLP4 0
+INDIRF4
+CNSTF4 1138819072
+GEF4 $586
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRGP4 cg+609304
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $586
+LABELV $581
+ADDRGP4 CG_StepOffset
+CALLV
+pop
+LABELV $515
+endproc CG_OffsetFirstPersonView 60 0
+export CG_ZoomDown_f
+proc CG_ZoomDown_f 4 0
+ADDRGP4 cg+609792
+INDIRI4
+CNSTI4 0
+EQI4 $593
+ADDRGP4 $592
+JUMPV
+LABELV $593
+ADDRGP4 cg+609792
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+609796
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+LEF4 $599
+ADDRLP4 0
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+ASGNF4
+LABELV $599
+ADDRGP4 cg+609796
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+609800
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+LEF4 $608
+ADDRLP4 0
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+ASGNF4
+LABELV $608
+ADDRGP4 cg+609800
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+609804
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609808
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $592
+endproc CG_ZoomDown_f 4 0
+export CG_ZoomUp_f
+proc CG_ZoomUp_f 4 0
+ADDRGP4 cg+609792
+INDIRI4
+CNSTI4 0
+NEI4 $620
+ADDRGP4 $619
+JUMPV
+LABELV $620
+ADDRGP4 cg+609792
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+609796
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+LEF4 $626
+ADDRLP4 0
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+ASGNF4
+LABELV $626
+ADDRGP4 cg+609796
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+609800
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+LEF4 $635
+ADDRLP4 0
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+ASGNF4
+LABELV $635
+ADDRGP4 cg+609800
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+609804
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609808
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $619
+endproc CG_ZoomUp_f 4 0
+export CG_CalcZoom
+proc CG_CalcZoom 24 0
+ADDRLP4 0
+ADDRGP4 cg_zoomFov+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+GEF4 $648
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $649
+JUMPV
+LABELV $648
+ADDRLP4 0
+INDIRF4
+CNSTF4 1126170624
+LEF4 $650
+LABELV $650
+LABELV $649
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_zoomIgnoreTimescale+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $656
+ADDRGP4 cg+8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $652
+LABELV $656
+ADDRLP4 8
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg_zoomBroken+12
+INDIRI4
+CNSTI4 0
+EQI4 $658
+ADDRLP4 12
+ADDRGP4 cg+609808
+INDIRF4
+ASGNF4
+ADDRGP4 $653
+JUMPV
+LABELV $658
+ADDRLP4 12
+ADDRGP4 cg+609800
+INDIRF4
+ASGNF4
+ADDRGP4 $653
+JUMPV
+LABELV $652
+ADDRLP4 8
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRGP4 cg_zoomBroken+12
+INDIRI4
+CNSTI4 0
+EQI4 $664
+ADDRLP4 12
+ADDRGP4 cg+609804
+INDIRF4
+ASGNF4
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRLP4 12
+ADDRGP4 cg+609796
+INDIRF4
+ASGNF4
+LABELV $665
+LABELV $653
+ADDRGP4 cg+609792
+INDIRI4
+CNSTI4 0
+EQI4 $669
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+CNSTF4 0
+LEF4 $672
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $673
+JUMPV
+LABELV $672
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+LABELV $673
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $676
+ADDRFP4 0
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 $670
+JUMPV
+LABELV $676
+ADDRLP4 20
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ADDRLP4 20
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $670
+JUMPV
+LABELV $669
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+CNSTF4 0
+LEF4 $678
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $679
+JUMPV
+LABELV $678
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+LABELV $679
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+GTF4 $682
+ADDRFP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $682
+LABELV $670
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $646
+endproc CG_CalcZoom 24 0
+export CG_AdjustedFov
+proc CG_AdjustedFov 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg_fovStyle+12
+INDIRI4
+CNSTI4 0
+NEI4 $685
+ADDRGP4 cg_fovy+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $688
+ADDRLP4 8
+ADDRGP4 cg_fovy+8
+INDIRF4
+ASGNF4
+ADDRGP4 $689
+JUMPV
+LABELV $688
+CNSTF4 1078530011
+ADDRFP4 0
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+609412+8
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 cg+609412+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1135869952
+ADDRLP4 8
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+LABELV $689
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $684
+JUMPV
+LABELV $685
+ADDRLP4 0
+ADDRGP4 cg+609412+8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+609412+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GTF4 $700
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+LABELV $700
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GTF4 $702
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $702
+ADDRGP4 cg_fovStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $704
+ADDRLP4 16
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1071877689
+LTF4 $707
+ADDRLP4 0
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 4
+CNSTF4 1091567616
+ASGNF4
+ADDRGP4 $708
+JUMPV
+LABELV $707
+ADDRLP4 16
+INDIRF4
+CNSTF4 1070386381
+LTF4 $709
+ADDRLP4 0
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 4
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $710
+JUMPV
+LABELV $709
+ADDRLP4 16
+INDIRF4
+CNSTF4 1068149419
+LTF4 $711
+ADDRLP4 0
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 4
+CNSTF4 1077936128
+ASGNF4
+ADDRGP4 $712
+JUMPV
+LABELV $711
+ADDRLP4 0
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 4
+CNSTF4 1082130432
+ASGNF4
+LABELV $712
+LABELV $710
+LABELV $708
+LABELV $704
+ADDRGP4 cg_fovForceAspectWidth+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $713
+ADDRLP4 0
+ADDRGP4 cg_fovForceAspectWidth+8
+INDIRF4
+ASGNF4
+LABELV $713
+ADDRGP4 cg_fovForceAspectHeight+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $717
+ADDRLP4 4
+ADDRGP4 cg_fovForceAspectHeight+8
+INDIRF4
+ASGNF4
+LABELV $717
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GTF4 $721
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+LABELV $721
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GTF4 $723
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $723
+ADDRFP4 0
+INDIRF4
+CNSTF4 1065353216
+GEF4 $725
+ADDRFP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $726
+JUMPV
+LABELV $725
+ADDRFP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $727
+LABELV $727
+LABELV $726
+ADDRGP4 cg_fovy+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $729
+ADDRLP4 8
+ADDRGP4 cg_fovy+8
+INDIRF4
+ASGNF4
+ADDRGP4 $730
+JUMPV
+LABELV $729
+ADDRLP4 16
+CNSTF4 1073741824
+ASGNF4
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 tan
+CALLF4
+ASGNF4
+CNSTF4 1061158912
+ADDRLP4 20
+INDIRF4
+MULF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1113927393
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $730
+ADDRLP4 16
+CNSTF4 1073741824
+ASGNF4
+CNSTF4 1016003125
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+MULF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRFP4 0
+ADDRLP4 16
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+CNSTF4 1113927393
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $684
+endproc CG_AdjustedFov 28 8
+proc CG_CalcFov 40 12
+ADDRGP4 cg+607196+4
+INDIRI4
+CNSTI4 5
+NEI4 $734
+ADDRGP4 cg_fovIntermission+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $738
+ADDRLP4 0
+ADDRGP4 cg_fovIntermission+8
+INDIRF4
+ASGNF4
+ADDRGP4 $735
+JUMPV
+LABELV $738
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $742
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $742
+ADDRLP4 0
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $735
+JUMPV
+LABELV $742
+ADDRLP4 0
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+ADDRGP4 $735
+JUMPV
+LABELV $734
+ADDRGP4 $748
+JUMPV
+ADDRGP4 $750
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $749
+JUMPV
+LABELV $748
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $751
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $751
+ADDRLP4 0
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $752
+JUMPV
+LABELV $751
+ADDRLP4 0
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+LABELV $752
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+GEF4 $757
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $758
+JUMPV
+LABELV $757
+ADDRLP4 0
+INDIRF4
+CNSTF4 1126170624
+LEF4 $759
+LABELV $759
+LABELV $758
+LABELV $749
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 CG_CalcZoom
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $735
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_AdjustedFov
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 cg_waterWarp+12
+INDIRI4
+CNSTI4 0
+EQI4 $761
+ADDRGP4 cg+609412+24
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $762
+JUMPV
+LABELV $761
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $762
+ADDRLP4 8
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $766
+ADDRLP4 28
+CNSTF4 1073741824
+CNSTF4 1078530011
+CNSTF4 1053609165
+ADDRGP4 cg+607152
+INDIRF4
+CNSTF4 1148846080
+DIVF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1065353216
+ADDRLP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $767
+JUMPV
+LABELV $766
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $767
+ADDRGP4 cg+609412+16
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+20
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609792
+INDIRI4
+CNSTI4 0
+NEI4 $773
+ADDRGP4 cg+609812
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $774
+JUMPV
+LABELV $773
+ADDRGP4 cg+609812
+ADDRGP4 cg+609412+20
+INDIRF4
+CNSTF4 1117126656
+DIVF4
+ASGNF4
+LABELV $774
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $733
+endproc CG_CalcFov 40 12
+proc CG_DamageBlendBlob 492 12
+ADDRGP4 cg+627444
+INDIRF4
+CNSTF4 0
+NEF4 $781
+ADDRGP4 $780
+JUMPV
+LABELV $781
+ADDRGP4 cg+627504
+INDIRI4
+CNSTI4 0
+EQI4 $784
+ADDRGP4 $780
+JUMPV
+LABELV $784
+ADDRGP4 cgs+20100+19480
+INDIRI4
+CNSTI4 3
+NEI4 $787
+ADDRGP4 $780
+JUMPV
+LABELV $787
+ADDRLP4 452
+CNSTI4 500
+ASGNI4
+ADDRLP4 172
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+627432
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+LEI4 $795
+ADDRLP4 172
+INDIRI4
+ADDRLP4 452
+INDIRI4
+LTI4 $793
+LABELV $795
+ADDRGP4 $780
+JUMPV
+LABELV $793
+ADDRLP4 448
+ADDRGP4 PERS_ATTACKER
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+607196+248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+68
+ADDRGP4 cg+609412+24
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+609412+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+609412+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRGP4 cg+609412+24+8
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+609412+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+609412+36+12
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+627436
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+609412+36+12+4
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+627436
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+609412+36+12+8
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+627436
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+609412+36+24
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+627440
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+609412+36+24+4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+627440
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+609412+36+24+8
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+627440
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+132
+CNSTF4 1077936128
+ADDRGP4 cg+627444
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+476
+INDIRI4
+ASGNI4
+ADDRLP4 448
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $873
+ADDRLP4 176
+ADDRGP4 cg_screenDamage_Self
+INDIRB
+ASGNB 272
+ADDRLP4 456
+ADDRGP4 cg_screenDamageAlpha_Self+12
+INDIRI4
+ASGNI4
+ADDRGP4 $874
+JUMPV
+LABELV $873
+ADDRLP4 448
+INDIRI4
+CNSTI4 0
+LTI4 $877
+ADDRLP4 448
+INDIRI4
+CNSTI4 64
+GEI4 $877
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $877
+CNSTI4 4524
+ADDRLP4 448
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+NEI4 $877
+ADDRLP4 176
+ADDRGP4 cg_screenDamage_Team
+INDIRB
+ASGNB 272
+ADDRLP4 456
+ADDRGP4 cg_screenDamageAlpha_Team+12
+INDIRI4
+ASGNI4
+ADDRGP4 $878
+JUMPV
+LABELV $877
+ADDRLP4 176
+ADDRGP4 cg_screenDamage
+INDIRB
+ASGNB 272
+ADDRLP4 456
+ADDRGP4 cg_screenDamageAlpha+12
+INDIRI4
+ASGNI4
+LABELV $878
+LABELV $874
+ADDRLP4 176
+ARGP4
+ADDRLP4 468
+ADDRGP4 SC_RedFromCvar
+CALLI4
+ASGNI4
+ADDRLP4 0+116
+ADDRLP4 468
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 176
+ARGP4
+ADDRLP4 472
+ADDRGP4 SC_GreenFromCvar
+CALLI4
+ASGNI4
+ADDRLP4 0+116+1
+ADDRLP4 472
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 176
+ARGP4
+ADDRLP4 476
+ADDRGP4 SC_BlueFromCvar
+CALLI4
+ASGNI4
+ADDRLP4 0+116+2
+ADDRLP4 476
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 484
+ADDRLP4 456
+INDIRI4
+CVIF4 4
+CNSTF4 1065353216
+ADDRLP4 172
+INDIRI4
+CVIF4 4
+ADDRLP4 452
+INDIRI4
+CVIF4 4
+DIVF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 488
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 484
+INDIRF4
+ADDRLP4 488
+INDIRF4
+LTF4 $893
+ADDRLP4 480
+ADDRLP4 484
+INDIRF4
+ADDRLP4 488
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $894
+JUMPV
+LABELV $893
+ADDRLP4 480
+ADDRLP4 484
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $894
+ADDRLP4 0+116+3
+ADDRLP4 480
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $780
+endproc CG_DamageBlendBlob 492 12
+data
+align 4
+LABELV $938
+byte 4 0
+code
+proc CG_CalcViewValues 160 16
+ADDRGP4 cg+609412
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 CG_CalcVrect
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+607196
+ASGNP4
+ADDRGP4 cg+627504
+INDIRI4
+CNSTI4 0
+EQI4 $899
+ADDRLP4 4
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 cg+607168
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_getCameraInfo
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $902
+ADDRGP4 cg+609412+24
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 cg+609780
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_AdjustedFov
+CALLV
+pop
+ADDRGP4 cg+609412+16
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+20
+ADDRLP4 36
+INDIRF4
+ASGNF4
+CNSTI4 1023
+ARGI4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $895
+JUMPV
+LABELV $902
+ADDRGP4 cg+627504
+CNSTI4 0
+ASGNI4
+CNSTI4 255
+ARGI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_Fade
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 cg+607168
+INDIRI4
+CNSTI4 200
+ADDI4
+ARGI4
+CNSTI4 1500
+ARGI4
+ADDRGP4 CG_Fade
+CALLV
+pop
+LABELV $899
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $922
+ADDRGP4 cg+609412+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 CG_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $895
+JUMPV
+LABELV $922
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $930
+ADDRGP4 cg_demoSmoothing+12
+INDIRI4
+CNSTI4 2
+LTI4 $930
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $934
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $934
+ADDRGP4 cg_demoSmoothing+12
+INDIRI4
+CNSTI4 2
+NEI4 $939
+ADDRLP4 72
+CNSTI4 44
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 76
+CNSTI4 8
+ASGNI4
+ADDRLP4 60
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $940
+JUMPV
+LABELV $939
+ADDRLP4 72
+ADDRGP4 cg_demoSmoothing+12
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 32
+LTI4 $947
+ADDRLP4 72
+CNSTI4 31
+ASGNI4
+LABELV $947
+ADDRLP4 76
+CNSTI4 121396
+ASGNI4
+ADDRLP4 80
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+MODI4
+SUBI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 84
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 cg+121484
+ASGNP4
+ADDRLP4 56
+ADDRGP4 cg+121508
+ASGNP4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 cg+121532
+ARGP4
+ADDRGP4 cg+121484
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_UpdateSnapshotRef
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $955
+LABELV $955
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $957
+LABELV $957
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 cg+242932
+ARGP4
+ADDRGP4 cg+121508
+ARGP4
+ADDRLP4 92
+ADDRGP4 CG_UpdateSnapshotRef
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $961
+LABELV $961
+ADDRLP4 56
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $963
+LABELV $963
+ADDRLP4 96
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 100
+CNSTI4 12
+ASGNI4
+ADDRLP4 8
+ADDRLP4 96
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 96
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 104
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 104
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $938
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $965
+LABELV $965
+ADDRGP4 $938
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $940
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_demoSmoothingTeleportCheck+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $967
+ADDRLP4 76
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 80
+CNSTI4 140
+ASGNI4
+ADDRLP4 84
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $971
+ADDRLP4 88
+CNSTI4 104
+ASGNI4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+ADDRLP4 72
+INDIRI4
+NEI4 $971
+ADDRLP4 92
+ADDRGP4 PERS_SPAWN_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 96
+CNSTI4 248
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $967
+LABELV $971
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRGP4 $968
+JUMPV
+LABELV $967
+ADDRLP4 100
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 100
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $968
+ADDRLP4 100
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 104
+CNSTI4 20
+ASGNI4
+ADDRLP4 108
+ADDRLP4 100
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 108
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+CNSTI4 24
+ASGNI4
+ADDRLP4 124
+ADDRLP4 100
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+CNSTI4 28
+ASGNI4
+ADDRLP4 132
+ADDRLP4 8
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20+8
+ADDRLP4 132
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRGP4 cg_demoSmoothingAngles+12
+INDIRI4
+CNSTI4 0
+EQI4 $977
+ADDRLP4 136
+CNSTI4 152
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 LerpAngleNear
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 144
+CNSTI4 156
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 LerpAngleNear
+CALLF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 152
+CNSTI4 160
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 156
+ADDRGP4 LerpAngleNear
+CALLF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609780
+ADDRLP4 36
+INDIRB
+ASGNB 12
+ADDRGP4 $931
+JUMPV
+LABELV $977
+ADDRGP4 cg+609780
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $931
+JUMPV
+LABELV $934
+ADDRGP4 cg+609412+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $931
+JUMPV
+LABELV $930
+ADDRGP4 cg+609412+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $931
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $990
+ADDRGP4 cg+627492
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 7
+RSHI4
+ASGNI4
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 127
+BANDI4
+CVIF4 4
+CNSTF4 1123942400
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 cg+627488
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRGP4 cg+627496
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $991
+JUMPV
+LABELV $990
+ADDRGP4 cg+607188
+INDIRI4
+CNSTI4 0
+EQI4 $997
+ADDRGP4 CG_OffsetThirdPersonView
+CALLV
+pop
+ADDRGP4 $1005
+JUMPV
+LABELV $997
+ADDRLP4 4
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cg+607196+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $1005
+JUMPV
+LABELV $991
+ADDRGP4 cg_cameraOrbit+12
+INDIRI4
+CNSTI4 0
+EQI4 $1006
+ADDRGP4 cg+607168
+INDIRI4
+ADDRGP4 cg+627500
+INDIRI4
+LEI4 $1009
+ADDRGP4 cg+627500
+ADDRGP4 cg+607168
+INDIRI4
+ADDRGP4 cg_cameraOrbitDelay+12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg_thirdPersonAngle+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cg_cameraOrbit+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1009
+LABELV $1006
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+CNSTF4 0
+LEF4 $1018
+ADDRLP4 8
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+609204
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $1025
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1025
+ADDRGP4 cg+609412+24
+ADDRGP4 cg+609412+24
+INDIRF4
+ADDRGP4 cg+609208
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24+4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+ADDRGP4 cg+609208+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24+8
+ADDRGP4 cg+609412+24+8
+INDIRF4
+ADDRGP4 cg+609208+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1026
+JUMPV
+LABELV $1025
+ADDRGP4 cg+609204
+CNSTI4 0
+ASGNI4
+LABELV $1026
+LABELV $1018
+ADDRGP4 cg+607188
+INDIRI4
+CNSTI4 0
+EQI4 $1049
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $1052
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRGP4 cg+4
+INDIRI4
+NEI4 $1052
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1052
+ADDRGP4 PERS_TEAM
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1052
+ADDRGP4 cg_specOffsetQL+12
+INDIRI4
+CNSTI4 1
+NEI4 $1059
+ADDRGP4 CG_OffsetQuakeLiveSpec
+CALLV
+pop
+ADDRGP4 $1050
+JUMPV
+LABELV $1059
+ADDRGP4 cg_specOffsetQL+12
+INDIRI4
+CNSTI4 2
+NEI4 $1062
+ADDRGP4 CG_OffsetThirdPersonView
+CALLV
+pop
+ADDRGP4 $1050
+JUMPV
+LABELV $1062
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_OffsetFirstPersonView
+CALLV
+pop
+ADDRGP4 $1050
+JUMPV
+LABELV $1052
+ADDRGP4 CG_OffsetThirdPersonView
+CALLV
+pop
+ADDRGP4 $1050
+JUMPV
+LABELV $1049
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_OffsetFirstPersonView
+CALLV
+pop
+LABELV $1050
+LABELV $1005
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+607192
+INDIRI4
+CNSTI4 0
+EQI4 $1068
+ADDRLP4 4
+ADDRGP4 cg+609412+76
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 5
+BORI4
+ASGNI4
+LABELV $1068
+ADDRLP4 4
+ADDRGP4 CG_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $895
+endproc CG_CalcViewValues 160 16
+proc CG_PowerupTimerSounds 16 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1074
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 356
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+GTI4 $1079
+ADDRGP4 $1075
+JUMPV
+LABELV $1079
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $1082
+ADDRGP4 $1075
+JUMPV
+LABELV $1082
+ADDRLP4 12
+CNSTI4 1000
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+607156
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+EQI4 $1085
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+632912+492660
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $1085
+LABELV $1075
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+LTI4 $1074
+LABELV $1073
+endproc CG_PowerupTimerSounds 16 16
+export CG_AddBufferedSound
+proc CG_AddBufferedSound 4 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1093
+ADDRGP4 $1092
+JUMPV
+LABELV $1093
+ADDRGP4 cg_soundBuffer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1095
+ADDRGP4 cg+627296
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+627308
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+627296
+ADDRGP4 cg+627296
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 20
+MODI4
+ASGNI4
+ADDRGP4 cg+627296
+INDIRI4
+ADDRGP4 cg+627300
+INDIRI4
+NEI4 $1096
+ADDRLP4 0
+ADDRGP4 cg+627300
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1096
+JUMPV
+LABELV $1095
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $1096
+LABELV $1092
+endproc CG_AddBufferedSound 4 8
+proc CG_PlayBufferedSounds 0 8
+ADDRGP4 cg+627304
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+GEI4 $1108
+ADDRGP4 cg+627300
+INDIRI4
+ADDRGP4 cg+627296
+INDIRI4
+EQI4 $1112
+ADDRGP4 cg+627300
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+627308
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1112
+ADDRGP4 cg+627300
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+627308
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+627300
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+627308
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627300
+ADDRGP4 cg+627300
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 20
+MODI4
+ASGNI4
+ADDRGP4 cg+627304
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 750
+ADDI4
+ASGNI4
+LABELV $1112
+LABELV $1108
+LABELV $1107
+endproc CG_PlayBufferedSounds 0 8
+proc CG_DrawAdvertisements 196 20
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1953504
+INDIRI4
+CNSTI4 0
+NEI4 $1127
+ADDRGP4 cgs+1953508
+ARGP4
+ADDRGP4 cgs+1953632
+ARGP4
+ADDRGP4 cgs+1955552
+ARGP4
+ADDRGP4 trap_Get_Advertisements
+CALLV
+pop
+ADDRGP4 cgs+1953504
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1134
+ARGP4
+ADDRGP4 cgs+1953508
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1139
+JUMPV
+LABELV $1136
+ADDRGP4 $1141
+ARGP4
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cgs+1955552
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 100
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cgs+1955552
+ADDP4
+ARGP4
+ADDRGP4 $1146
+ARGP4
+ADDRLP4 136
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1143
+ADDRLP4 100
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1953512
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1143
+LABELV $1137
+ADDRLP4 100
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1139
+ADDRLP4 100
+INDIRI4
+ADDRGP4 cgs+1953508
+INDIRI4
+LTI4 $1136
+LABELV $1127
+ADDRGP4 cg+607192
+INDIRI4
+CNSTI4 0
+EQI4 $1148
+ADDRGP4 $1126
+JUMPV
+LABELV $1148
+ADDRLP4 104
+ADDRGP4 cgs+1953632
+ASGNP4
+ADDRGP4 $1152
+ARGP4
+ADDRLP4 132
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+EQI4 $1155
+ADDRLP4 128
+INDIRI4
+CNSTI4 2
+NEI4 $1153
+LABELV $1155
+ADDRLP4 116
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1154
+JUMPV
+LABELV $1153
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+LABELV $1154
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1159
+JUMPV
+LABELV $1156
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 cg_adShaderOverride+12
+INDIRI4
+ADDRLP4 156
+INDIRI4
+EQI4 $1161
+ADDRGP4 $1164
+ARGP4
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 SC_Cvar_Get_String
+CALLP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1165
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 BlackListedShader
+ARGP4
+ADDRLP4 172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $1165
+ADDRLP4 108
+ADDRGP4 $1167
+ASGNP4
+ADDRGP4 $1162
+JUMPV
+LABELV $1165
+ADDRLP4 108
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1162
+ADDRLP4 112
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1161
+ADDRLP4 108
+ADDRGP4 $1167
+ASGNP4
+LABELV $1162
+ADDRLP4 0+72
+ADDRLP4 100
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRLP4 104
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 160
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+72+4
+ADDRLP4 100
+INDIRI4
+ADDRLP4 160
+INDIRI4
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRLP4 160
+INDIRI4
+ADDI4
+ADDRLP4 104
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRLP4 100
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+CNSTI4 8
+ADDI4
+ADDRLP4 104
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+48
+ADDRLP4 100
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+CNSTI4 12
+ADDI4
+ADDRLP4 104
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 100
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+CNSTI4 16
+ADDI4
+ADDRLP4 104
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 100
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+CNSTI4 20
+ADDI4
+ADDRLP4 104
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 100
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+CNSTI4 24
+ADDI4
+ADDRLP4 104
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 100
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+CNSTI4 28
+ADDI4
+ADDRLP4 104
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 100
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+CNSTI4 32
+ADDI4
+ADDRLP4 104
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 100
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 164
+INDIRI4
+CNSTI4 36
+ADDI4
+ADDRLP4 104
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 164
+INDIRI4
+CNSTI4 40
+ADDI4
+ADDRLP4 104
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 100
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDI4
+ADDRLP4 104
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+72
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 172
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 172
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+72
+ARGP4
+ADDRLP4 0+48
+ARGP4
+ADDRLP4 176
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 148
+INDIRI4
+CVIF4 4
+ADDRLP4 152
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 1050253722
+GEF4 $1190
+ADDRLP4 140
+ADDRGP4 cgs+632912+492572
+INDIRI4
+ASGNI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1191
+JUMPV
+LABELV $1190
+ADDRLP4 144
+INDIRF4
+CNSTF4 1091567616
+LTF4 $1194
+ADDRLP4 140
+ADDRGP4 cgs+632912+492572
+INDIRI4
+ASGNI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1195
+JUMPV
+LABELV $1194
+ADDRLP4 144
+INDIRF4
+CNSTF4 1088421888
+LEF4 $1198
+ADDRLP4 140
+ADDRGP4 cgs+632912+492568
+INDIRI4
+ASGNI4
+ADDRLP4 120
+CNSTI4 8
+ASGNI4
+ADDRGP4 $1199
+JUMPV
+LABELV $1198
+ADDRLP4 144
+INDIRF4
+CNSTF4 1077936128
+LEF4 $1202
+ADDRLP4 140
+ADDRGP4 cgs+632912+492564
+INDIRI4
+ASGNI4
+ADDRLP4 120
+CNSTI4 4
+ASGNI4
+ADDRGP4 $1203
+JUMPV
+LABELV $1202
+ADDRLP4 144
+INDIRF4
+CNSTF4 1069547520
+LEF4 $1206
+ADDRLP4 140
+ADDRGP4 cgs+632912+492556
+INDIRI4
+ASGNI4
+ADDRLP4 120
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1207
+JUMPV
+LABELV $1206
+ADDRLP4 144
+INDIRF4
+CNSTF4 1061158912
+LEF4 $1210
+ADDRLP4 140
+ADDRGP4 cgs+632912+492552
+INDIRI4
+ASGNI4
+ADDRLP4 120
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1211
+JUMPV
+LABELV $1210
+ADDRLP4 144
+INDIRF4
+CNSTF4 1048576000
+LEF4 $1214
+ADDRLP4 140
+ADDRGP4 cgs+632912+492556
+INDIRI4
+ASGNI4
+ADDRLP4 120
+CNSTI4 2
+ASGNI4
+ADDRLP4 124
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1215
+JUMPV
+LABELV $1214
+ADDRLP4 140
+ADDRGP4 cgs+632912+492572
+INDIRI4
+ASGNI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+LABELV $1215
+LABELV $1211
+LABELV $1207
+LABELV $1203
+LABELV $1199
+LABELV $1195
+LABELV $1191
+ADDRLP4 100
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1953512
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1220
+ADDRLP4 120
+INDIRI4
+CNSTI4 2
+NEI4 $1223
+ADDRLP4 140
+ADDRGP4 cgs+632912+492560
+INDIRI4
+ASGNI4
+LABELV $1223
+LABELV $1220
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $1227
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $1229
+ADDRGP4 BlackListedShader
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1229
+LABELV $1227
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+EQI4 $1231
+ADDRLP4 180
+ADDRGP4 trap_R_GetSingleShader
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 180
+INDIRI4
+ASGNI4
+LABELV $1231
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 180
+INDIRI4
+NEI4 $1291
+ADDRLP4 116
+INDIRI4
+ADDRLP4 180
+INDIRI4
+NEI4 $1291
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $1293
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 1065353216
+ASGNF4
+LABELV $1293
+LABELV $1291
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+LEF4 $1313
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+LABELV $1313
+ADDRLP4 140
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRGP4 cg_debugAds+12
+INDIRI4
+CNSTI4 0
+EQI4 $1336
+ADDRLP4 188
+CNSTU1 0
+ASGNU1
+ADDRLP4 184
+ADDRLP4 188
+INDIRU1
+ASGNU1
+ADDRLP4 184+1
+ADDRLP4 188
+INDIRU1
+ASGNU1
+ADDRLP4 184+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 184+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 8
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_FloatNumber
+CALLV
+pop
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $1342
+ADDRLP4 96
+INDIRI4
+ARGI4
+CNSTI4 24
+ADDRLP4 96
+INDIRI4
+MULI4
+ADDRLP4 0
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 184
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_FloatNumber
+CALLV
+pop
+LABELV $1343
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 4
+LTI4 $1342
+LABELV $1336
+LABELV $1157
+ADDRLP4 100
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1159
+ADDRLP4 100
+INDIRI4
+ADDRGP4 cgs+1953508
+INDIRI4
+LTI4 $1156
+LABELV $1126
+endproc CG_DrawAdvertisements 196 20
+proc CG_DrawDecals 216 60
+ADDRLP4 36
+ADDRGP4 $1167
+ASGNP4
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1348
+JUMPV
+LABELV $1347
+ADDRGP4 $1350
+ARGP4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 SC_Cvar_Get_String
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1351
+ADDRGP4 $1349
+JUMPV
+LABELV $1351
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 $1353
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+4
+ARGP4
+ADDRLP4 0+8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 12+4
+ARGP4
+ADDRLP4 12+8
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 104
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 204
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 204
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1207959552
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 208
+CNSTP4 0
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 40+12
+ARGP4
+ADDRLP4 40+24
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 176
+INDIRF4
+ARGF4
+ADDRLP4 180
+INDIRF4
+ARGF4
+ADDRLP4 184
+INDIRF4
+ARGF4
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+ADDRLP4 212
+INDIRI4
+ARGI4
+ADDRLP4 188
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 212
+INDIRI4
+ARGI4
+ADDRLP4 212
+INDIRI4
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1348
+ADDRGP4 $1347
+JUMPV
+LABELV $1349
+LABELV $1346
+endproc CG_DrawDecals 216 60
+lit
+align 4
+LABELV $1373
+byte 4 0
+byte 4 0
+byte 4 0
+code
+proc CG_ForceBModels 272 32
+ADDRLP4 172
+CNSTP4 0
+ASGNP4
+ADDRLP4 184
+ADDRGP4 $1373
+INDIRB
+ASGNB 12
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1375
+JUMPV
+LABELV $1374
+ADDRGP4 $1377
+ARGP4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 SC_Cvar_Get_String
+CALLP4
+ASGNP4
+ADDRLP4 172
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1378
+ADDRGP4 $1376
+JUMPV
+LABELV $1378
+ADDRGP4 $1377
+ARGP4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 184
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0+104
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 6
+RSHI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 180
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+47416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1386
+ARGP4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRLP4 220
+ADDRGP4 SC_Cvar_Get_String
+CALLP4
+ASGNP4
+ADDRLP4 172
+ADDRLP4 220
+INDIRP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1387
+ADDRLP4 0+68
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+68+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+68+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 236
+CNSTF4 0
+ASGNF4
+ADDRLP4 224
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 224+4
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 224+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRGP4 $1396
+ARGP4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 0+68+4
+ARGP4
+ADDRLP4 0+68+8
+ARGP4
+ADDRLP4 224
+ARGP4
+ADDRLP4 224+4
+ARGP4
+ADDRLP4 224+8
+ARGP4
+ADDRLP4 240
+ADDRGP4 sscanf
+CALLI4
+ASGNI4
+ADDRLP4 196
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+GTI4 $1404
+ADDRGP4 $1406
+ARGP4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1404
+ADDRLP4 0+84
+ADDRLP4 0+68
+INDIRB
+ASGNB 12
+ADDRLP4 224
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $1387
+ADDRGP4 $1410
+ARGP4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 SC_Cvar_Get_String
+CALLP4
+ASGNP4
+ADDRLP4 172
+ADDRLP4 228
+INDIRP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1411
+ADDRLP4 232
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 40
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRGP4 $1413
+ARGP4
+ADDRLP4 232
+ARGP4
+ADDRLP4 232+4
+ARGP4
+ADDRLP4 232+8
+ARGP4
+ADDRLP4 232+24
+ARGP4
+ADDRLP4 232+24+4
+ARGP4
+ADDRLP4 232+24+8
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 232+12
+ADDRLP4 0+68
+INDIRB
+ASGNB 12
+ADDRLP4 232
+ARGP4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 0+68
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRLP4 0+84
+ADDRLP4 0+68
+INDIRB
+ASGNB 12
+LABELV $1411
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 176
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1375
+ADDRGP4 $1374
+JUMPV
+LABELV $1376
+LABELV $1372
+endproc CG_ForceBModels 272 32
+proc CG_DrawSpawns 480 12
+ADDRGP4 cg_drawSpawns+12
+INDIRI4
+CNSTI4 0
+NEI4 $1429
+ADDRGP4 $1428
+JUMPV
+LABELV $1429
+ADDRLP4 192
+CNSTU1 255
+ASGNU1
+ADDRLP4 188+3
+ADDRLP4 192
+INDIRU1
+ASGNU1
+ADDRLP4 188+2
+ADDRLP4 192
+INDIRU1
+ASGNU1
+ADDRLP4 188+1
+ADDRLP4 192
+INDIRU1
+ASGNU1
+ADDRLP4 188
+ADDRLP4 192
+INDIRU1
+ASGNU1
+ADDRLP4 196
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRGP4 $1438
+JUMPV
+LABELV $1435
+ADDRLP4 180
+CNSTI4 36
+ADDRLP4 176
+INDIRI4
+MULI4
+ADDRGP4 cg+694740
+ADDP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRLP4 180
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 184
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+632912+492172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+112
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1106247680
+ASGNF4
+ADDRGP4 cg_drawSpawns+12
+INDIRI4
+CNSTI4 2
+NEI4 $1446
+ADDRLP4 0+4
+CNSTI4 8
+ASGNI4
+LABELV $1446
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 10
+LTI4 $1450
+ADDRLP4 0+116
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1451
+JUMPV
+LABELV $1450
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+LABELV $1451
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 20
+LTI4 $1454
+ADDRLP4 0+116+1
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1455
+JUMPV
+LABELV $1454
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+LABELV $1455
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 30
+LTI4 $1460
+ADDRLP4 0+116+2
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1461
+JUMPV
+LABELV $1460
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+LABELV $1461
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 0
+ASGNU1
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GTI4 $1473
+ADDRLP4 180
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1476
+ADDRGP4 cg_drawSpawnsInitial+12
+INDIRI4
+CNSTI4 0
+EQI4 $1436
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_drawSpawnsInitialZ+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1474
+JUMPV
+LABELV $1476
+ADDRGP4 cg_drawSpawnsRespawns+12
+INDIRI4
+CNSTI4 0
+EQI4 $1436
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_drawSpawnsRespawnsZ+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1474
+JUMPV
+LABELV $1473
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LEI4 $1492
+ADDRLP4 180
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1495
+ADDRGP4 cg_drawSpawnsShared+12
+INDIRI4
+CNSTI4 0
+NEI4 $1497
+ADDRGP4 $1436
+JUMPV
+LABELV $1497
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $1505
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+NEI4 $1501
+LABELV $1505
+ADDRLP4 0+116+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1502
+JUMPV
+LABELV $1501
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+LABELV $1502
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_drawSpawnsSharedZ+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1496
+JUMPV
+LABELV $1495
+ADDRLP4 180
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1517
+ADDRLP4 0+116
+CNSTU1 100
+ASGNU1
+ADDRLP4 180
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1520
+ADDRGP4 cg_drawSpawnsInitial+12
+INDIRI4
+CNSTI4 0
+NEI4 $1522
+ADDRGP4 $1436
+JUMPV
+LABELV $1522
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 100
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_drawSpawnsInitialZ+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1518
+JUMPV
+LABELV $1520
+ADDRGP4 cg_drawSpawnsRespawns+12
+INDIRI4
+CNSTI4 0
+NEI4 $1533
+ADDRGP4 $1436
+JUMPV
+LABELV $1533
+ADDRLP4 0+116+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_drawSpawnsRespawnsZ+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1518
+JUMPV
+LABELV $1517
+ADDRLP4 180
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1436
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 180
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1547
+ADDRGP4 cg_drawSpawnsInitial+12
+INDIRI4
+CNSTI4 0
+NEI4 $1549
+ADDRGP4 $1436
+JUMPV
+LABELV $1549
+ADDRLP4 0+116+2
+CNSTU1 100
+ASGNU1
+ADDRLP4 0+116
+CNSTU1 50
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_drawSpawnsInitialZ+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1544
+JUMPV
+LABELV $1547
+ADDRGP4 cg_drawSpawnsRespawns+12
+INDIRI4
+CNSTI4 0
+NEI4 $1560
+ADDRGP4 $1436
+JUMPV
+LABELV $1560
+ADDRLP4 0+116
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 150
+ASGNU1
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg_drawSpawnsRespawnsZ+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1544
+LABELV $1518
+LABELV $1496
+LABELV $1492
+LABELV $1474
+ADDRGP4 $1571
+ARGP4
+ADDRLP4 200
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $1569
+ADDRGP4 $1571
+ARGP4
+ADDRLP4 476
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 204+12
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 204+8
+ADDRLP4 204+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0+116
+ARGP4
+ADDRLP4 204
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1569
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+8
+ADDRGP4 cgs+632912+492376
+INDIRI4
+ASGNI4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+112
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRLP4 172
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1436
+ADDRLP4 176
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1438
+ADDRLP4 176
+INDIRI4
+ADDRGP4 cg+694736
+INDIRI4
+LTI4 $1435
+LABELV $1428
+endproc CG_DrawSpawns 480 12
+proc CG_PlayPath 92 40
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+8
+INDIRI4
+CNSTI4 0
+EQI4 $1586
+ADDRGP4 $1585
+JUMPV
+LABELV $1586
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+1332772
+INDIRF4
+GEF4 $1589
+ADDRGP4 $1585
+JUMPV
+LABELV $1589
+ADDRLP4 12
+ADDRGP4 cg_pathSkipNum+12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $1594
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $1594
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+1332800
+INDIRF4
+LTF4 $1596
+ADDRGP4 cg+1332776
+ADDRGP4 cg+1332804
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332788
+ADDRGP4 cg+1332816
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332772
+ADDRGP4 cg+1332800
+INDIRF4
+ASGNF4
+ADDRGP4 $1607
+JUMPV
+LABELV $1606
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1614
+JUMPV
+LABELV $1611
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_FS_ReadLine
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 72
+INDIRP4
+ASGNP4
+LABELV $1612
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1614
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1611
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1619
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 76
+INDIRI4
+EQI4 $1619
+ADDRLP4 8
+INDIRI4
+ADDRLP4 76
+INDIRI4
+NEI4 $1616
+LABELV $1619
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 cg+1332752
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1622
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1623
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $1585
+JUMPV
+LABELV $1616
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $1624
+ARGP4
+ADDRGP4 cg+1332800
+ARGP4
+ADDRGP4 cg+1332804
+ARGP4
+ADDRGP4 cg+1332804+4
+ARGP4
+ADDRGP4 cg+1332804+8
+ARGP4
+ADDRGP4 cg+1332816
+ARGP4
+ADDRGP4 cg+1332816+4
+ARGP4
+ADDRGP4 cg+1332816+8
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+LABELV $1607
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+1332800
+INDIRF4
+GEF4 $1606
+LABELV $1596
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+1332772
+INDIRF4
+SUBF4
+ADDRGP4 cg+1332800
+INDIRF4
+ADDRGP4 cg+1332772
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1640
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $1640
+ADDRLP4 20
+ADDRGP4 cg+1332776
+INDIRB
+ASGNB 12
+ADDRLP4 48
+ADDRGP4 cg+1332788
+INDIRB
+ASGNB 12
+ADDRLP4 36
+ADDRGP4 cg+1332804
+INDIRB
+ASGNB 12
+ADDRLP4 60
+ADDRGP4 cg+1332816
+INDIRB
+ASGNB 12
+ADDRLP4 72
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+24
+ADDRLP4 72
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24+4
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24+8
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 20+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRGP4 cg+609780
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 48+4
+INDIRF4
+ARGF4
+ADDRLP4 60+4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRGP4 cg+609780+4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 48+8
+INDIRF4
+ARGF4
+ADDRLP4 60+8
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRGP4 cg+609780+8
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1675
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $1675
+ADDRGP4 cg+609412+16
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1676
+JUMPV
+LABELV $1675
+ADDRGP4 cg+609412+16
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+LABELV $1676
+ADDRGP4 cg+609412+16
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1685
+ADDRGP4 cg+609412+16
+CNSTF4 1065353216
+ASGNF4
+LABELV $1685
+ADDRGP4 cg+609412+16
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+16
+ARGP4
+ADDRGP4 cg+609412+20
+ARGP4
+ADDRGP4 CG_AdjustedFov
+CALLV
+pop
+ADDRGP4 cg+609412+72
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+CNSTI4 1023
+ARGI4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+LABELV $1585
+endproc CG_PlayPath 92 40
+export CG_CalcSpline
+proc CG_CalcSpline 4 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_CalcSpline
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $1704
+endproc CG_CalcSpline 4 12
+proc demoTargetEntity 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1708
+ADDRFP4 0
+INDIRI4
+CNSTI4 1023
+LTI4 $1706
+LABELV $1708
+CNSTP4 0
+RETP4
+ADDRGP4 $1705
+JUMPV
+LABELV $1706
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1709
+ADDRGP4 cg+607704
+RETP4
+ADDRGP4 $1705
+JUMPV
+LABELV $1709
+CNSTI4 1496
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+476
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1713
+CNSTI4 1496
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+RETP4
+ADDRGP4 $1705
+JUMPV
+LABELV $1713
+CNSTP4 0
+RETP4
+LABELV $1705
+endproc demoTargetEntity 4 0
+proc chaseEntityOrigin 8 0
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $1720
+ADDRGP4 $1717
+JUMPV
+LABELV $1720
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+LABELV $1717
+LABELV $1718
+LABELV $1716
+endproc chaseEntityOrigin 8 0
+lit
+align 1
+LABELV $1832
+byte 1 255
+byte 1 0
+byte 1 0
+byte 1 255
+code
+proc CG_PlayQ3mmeCamera 296 16
+ADDRLP4 0
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1727
+CNSTI4 0
+RETI4
+ADDRGP4 $1721
+JUMPV
+LABELV $1726
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1727
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1726
+ADDRGP4 cg_cameraDebugPath+12
+INDIRI4
+CNSTI4 0
+EQI4 $1729
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1730
+JUMPV
+LABELV $1729
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1730
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196788
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $1737
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1732
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+GTI4 $1732
+LABELV $1737
+ADDRGP4 cg+3196816
+INDIRI4
+CNSTI4 0
+EQI4 $1738
+ADDRGP4 cg+3196816
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1721
+JUMPV
+LABELV $1738
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+LEI4 $1742
+ADDRGP4 cg+3196788
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1721
+JUMPV
+LABELV $1742
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1746
+ADDRLP4 20
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRLP4 44
+ADDRGP4 cg+609412+16
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cg+609412+20
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 cg+1332224+32
+INDIRB
+ASGNB 12
+LABELV $1746
+ADDRLP4 68
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRGP4 cg+3196916
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 CG_Q3mmeCameraOriginAt
+CALLI4
+pop
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 CG_Q3mmeCameraAnglesAt
+CALLI4
+pop
+ADDRGP4 demo+4+8
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 demoTargetEntity
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1764
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 chaseEntityOrigin
+CALLV
+pop
+ADDRLP4 80
+ADDRLP4 80
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 80+4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 80+8
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 cg+609780+4
+ADDRLP4 92+4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609780
+ADDRLP4 92
+INDIRF4
+ASGNF4
+LABELV $1764
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1785
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $1785
+ADDRLP4 12
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1786
+JUMPV
+LABELV $1785
+ADDRLP4 12
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+LABELV $1786
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 demo+4+24
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_Q3mmeCameraFovAt
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $1791
+ADDRGP4 demo+4+24
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1792
+JUMPV
+LABELV $1791
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 demo+4+24
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1792
+ADDRGP4 cg+609412+16
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+16
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1801
+ADDRGP4 cg+609412+16
+CNSTF4 1065353216
+ASGNF4
+LABELV $1801
+ADDRGP4 cg+609412+16
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+16
+ARGP4
+ADDRGP4 cg+609412+20
+ARGP4
+ADDRGP4 CG_AdjustedFov
+CALLV
+pop
+CNSTI4 1023
+ARGI4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_cameraUpdateFreeCam+12
+INDIRI4
+ADDRLP4 84
+INDIRI4
+EQI4 $1817
+ADDRGP4 cg_cameraDebugPath+12
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $1817
+ADDRGP4 cg+1332220
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332124
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 88
+ADDRGP4 cg+1332124+8
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+SUBF4
+ASGNF4
+ADDRGP4 cg+1332136
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332160
+CNSTI4 1
+ASGNI4
+LABELV $1817
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1830
+ADDRLP4 272
+ADDRGP4 $1832
+INDIRB
+ASGNB 4
+ADDRLP4 88
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 88+68
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88+8
+ADDRGP4 cgs+632912+492376
+INDIRI4
+ASGNI4
+ADDRLP4 88+28
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 88+132
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 88+112
+CNSTI4 0
+ASGNI4
+ADDRLP4 88+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 88+116+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 88+116+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 88+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 88+4
+CNSTI4 8
+ASGNI4
+ADDRLP4 88
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 cg+609780
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRLP4 288
+CNSTP4 0
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 260
+ADDRLP4 88+68
+INDIRB
+ASGNB 12
+ADDRLP4 292
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 260
+ADDRLP4 260
+INDIRF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 276
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 276+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 260+8
+INDIRF4
+CNSTF4 1133903872
+ADDRLP4 276+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88+68
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRGP4 cg_railTrailTime+8
+INDIRF4
+ARGF4
+ADDRLP4 272
+ARGP4
+ADDRGP4 CG_SimpleRailTrail
+CALLV
+pop
+ADDRGP4 cg+609412+24
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ADDRLP4 32
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+609412+16
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332224+32
+ADDRLP4 52
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332160
+CNSTI4 1
+ASGNI4
+LABELV $1830
+CNSTI4 1
+RETI4
+ADDRGP4 $1721
+JUMPV
+LABELV $1732
+CNSTI4 0
+RETI4
+LABELV $1721
+endproc CG_PlayQ3mmeCamera 296 16
+lit
+align 1
+LABELV $2957
+byte 1 0
+byte 1 255
+byte 1 0
+byte 1 255
+code
+proc CG_PlayCamera 460 36
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_PlayQ3mmeCamera
+CALLI4
+pop
+ADDRLP4 216
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196788
+INDIRI4
+ADDRLP4 216
+INDIRI4
+EQI4 $1874
+ADDRGP4 cg_cameraDebugPath+12
+INDIRI4
+ADDRLP4 216
+INDIRI4
+NEI4 $1874
+CNSTI4 1
+RETI4
+ADDRGP4 $1873
+JUMPV
+LABELV $1874
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+GEI4 $1878
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1873
+JUMPV
+LABELV $1878
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $1883
+ADDRGP4 cg+609412+24
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRLP4 220
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ADDRLP4 220
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRGP4 cg+609780
+ADDRGP4 cg+1332136
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $1883
+ADDRGP4 cg_cameraDebugPath+12
+INDIRI4
+CNSTI4 0
+EQI4 $1897
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+LABELV $1897
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1900
+ADDRLP4 104
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 116
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRLP4 184
+ADDRGP4 cg+609412+16
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRGP4 cg+609412+20
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRGP4 cg+1332224+32
+INDIRB
+ASGNB 12
+ADDRGP4 $1901
+JUMPV
+LABELV $1900
+ADDRLP4 220
+CNSTF4 0
+ASGNF4
+ADDRLP4 104
+ADDRLP4 220
+INDIRF4
+ASGNF4
+ADDRLP4 104+4
+ADDRLP4 220
+INDIRF4
+ASGNF4
+ADDRLP4 104+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 224
+CNSTF4 0
+ASGNF4
+ADDRLP4 116
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRLP4 116+4
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRLP4 116+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 228
+CNSTF4 0
+ASGNF4
+ADDRLP4 184
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 128+8
+CNSTF4 0
+ASGNF4
+LABELV $1901
+ADDRLP4 20
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556-1460
+ADDP4
+ASGNP4
+ADDRLP4 220
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196784
+INDIRI4
+ADDRLP4 220
+INDIRI4
+NEI4 $1920
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+ADDRLP4 220
+INDIRI4
+EQI4 $1920
+ADDRLP4 224
+ADDRLP4 20
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 224
+INDIRF4
+EQF4 $1929
+ADDRGP4 cg+3196792
+INDIRI4
+CNSTI4 0
+EQI4 $1924
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 224
+INDIRF4
+LTF4 $1924
+LABELV $1929
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+CNSTI4 1
+LEI4 $1930
+ADDRLP4 20
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1930
+ADDRLP4 20
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRGP4 cg+3196820
+INDIRF4
+EQF4 $1930
+ADDRGP4 $1934
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 cg+3196820
+ADDRLP4 20
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1930
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556-2920
+ADDP4
+ASGNP4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+LEI4 $1939
+ADDRLP4 8
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556-4380
+ADDP4
+ASGNP4
+ADDRGP4 $1940
+JUMPV
+LABELV $1939
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+LABELV $1940
+ADDRGP4 cg+3196796
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1921
+JUMPV
+LABELV $1924
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1950
+JUMPV
+LABELV $1947
+ADDRLP4 228
+CNSTI4 1460
+ADDRLP4 12
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 228
+INDIRI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 228
+INDIRI4
+ADDRGP4 cg+2121556+1460
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 232
+CNSTI4 40
+ASGNI4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $1955
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $1955
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1949
+JUMPV
+LABELV $1955
+LABELV $1948
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1950
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $1947
+LABELV $1949
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1959
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1873
+JUMPV
+LABELV $1959
+ADDRGP4 cg+3196796
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+3196796
+INDIRI4
+CNSTI4 0
+LEI4 $1964
+ADDRLP4 8
+CNSTI4 1460
+ADDRGP4 cg+3196796
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556-1460
+ADDP4
+ASGNP4
+LABELV $1964
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+CNSTI4 1
+LEI4 $1921
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1921
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRGP4 cg+3196820
+INDIRF4
+EQF4 $1921
+ADDRGP4 $1934
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 cg+3196820
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1921
+JUMPV
+LABELV $1920
+ADDRLP4 224
+ADDRLP4 20
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 224
+INDIRF4
+EQF4 $1980
+ADDRGP4 cg+3196792
+INDIRI4
+CNSTI4 0
+EQI4 $1975
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 224
+INDIRF4
+LTF4 $1975
+LABELV $1980
+ADDRLP4 20
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1981
+ADDRLP4 20
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRGP4 cg+3196820
+INDIRF4
+EQF4 $1981
+LABELV $1981
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556-2920
+ADDP4
+ASGNP4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+LEI4 $1987
+ADDRLP4 8
+CNSTI4 1460
+ADDRGP4 cg+3196764
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556-4380
+ADDP4
+ASGNP4
+ADDRGP4 $1976
+JUMPV
+LABELV $1987
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1976
+JUMPV
+LABELV $1975
+ADDRLP4 0
+CNSTI4 1460
+ADDRGP4 cg+3196796
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+3196796
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1995
+ADDRLP4 4
+CNSTI4 1460
+ADDRGP4 cg+3196796
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1460
+ADDP4
+ASGNP4
+LABELV $1995
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+3196796
+INDIRI4
+CNSTI4 0
+LEI4 $2002
+ADDRLP4 8
+CNSTI4 1460
+ADDRGP4 cg+3196796
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556-1460
+ADDP4
+ASGNP4
+LABELV $2002
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2008
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1873
+JUMPV
+LABELV $2008
+LABELV $1976
+ADDRGP4 cg+3196812
+INDIRI4
+CNSTI4 0
+EQI4 $2012
+ADDRGP4 cg+3196812
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196808
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3196804
+CNSTI4 1
+ASGNI4
+ADDRLP4 228
+CNSTF4 1148846080
+ADDRGP4 cg_cameraRewindTime+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+INDIRF4
+CNSTF4 0
+GEF4 $2021
+ADDRLP4 228
+CNSTF4 0
+ASGNF4
+LABELV $2021
+ADDRGP4 $2023
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 228
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1873
+JUMPV
+LABELV $2017
+ADDRGP4 cg+3196804
+CNSTI4 0
+ASGNI4
+LABELV $2012
+ADDRGP4 cg+3196804
+INDIRI4
+CNSTI4 0
+EQI4 $2026
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+LTF4 $2029
+ADDRGP4 cg+3196804
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196808
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2030
+JUMPV
+LABELV $2029
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1873
+JUMPV
+LABELV $2030
+LABELV $2026
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+GEF4 $2035
+ADDRGP4 cg+3196804
+INDIRI4
+CNSTI4 0
+EQI4 $2038
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1873
+JUMPV
+LABELV $2038
+ADDRGP4 $2042
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1873
+JUMPV
+LABELV $2035
+ADDRGP4 cg+3196808
+INDIRI4
+CNSTI4 0
+EQI4 $2045
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2048
+ADDRGP4 $1934
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $2048
+ADDRGP4 cg+3196808
+CNSTI4 0
+ASGNI4
+LABELV $2045
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+LTF4 $2051
+ADDRLP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2054
+ADDRGP4 $1934
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $2054
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+NEU4 $2062
+ADDRGP4 cg+3196796
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2057
+JUMPV
+LABELV $2061
+ADDRLP4 228
+ADDRGP4 cg+3196796
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ADDRLP4 228
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+3196796
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $2065
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1873
+JUMPV
+LABELV $2065
+ADDRLP4 232
+CNSTI4 1460
+ASGNI4
+ADDRLP4 0
+ADDRLP4 232
+INDIRI4
+ADDRGP4 cg+3196796
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 232
+INDIRI4
+ADDRGP4 cg+3196796
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1460
+ADDP4
+ASGNP4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+GEF4 $2076
+ADDRGP4 $2063
+JUMPV
+LABELV $2076
+LABELV $2062
+ADDRGP4 $2061
+JUMPV
+LABELV $2063
+LABELV $2057
+LABELV $2051
+LABELV $1921
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+GEF4 $2079
+ADDRGP4 cg+3196792
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2080
+JUMPV
+LABELV $2079
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+LABELV $2080
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+NEI4 $2084
+CNSTI4 1
+RETI4
+ADDRGP4 $1873
+JUMPV
+LABELV $2084
+ADDRLP4 224
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332224+32+8
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332224+32+4
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332224+32
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $2096
+JUMPV
+LABELV $2095
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2096
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2098
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2095
+LABELV $2098
+ADDRGP4 $2100
+JUMPV
+LABELV $2099
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2100
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2102
+ADDRLP4 8
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2099
+LABELV $2102
+ADDRGP4 $2104
+JUMPV
+LABELV $2103
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2104
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2106
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2103
+LABELV $2106
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2107
+ADDRGP4 $2109
+JUMPV
+LABELV $2107
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2110
+ADDRGP4 cg+609412+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2109
+JUMPV
+LABELV $2110
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2114
+ADDRGP4 cg+609412+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2115
+JUMPV
+LABELV $2114
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2118
+ADDRLP4 240
+CNSTI4 40
+ASGNI4
+ADDRLP4 244
+ADDRLP4 0
+INDIRP4
+ADDRLP4 240
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 244
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 240
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 244
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2121
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2121
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2123
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2123
+ADDRLP4 56
+CNSTI4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2124
+JUMPV
+LABELV $2123
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2126
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2126
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2127
+JUMPV
+LABELV $2126
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2128
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2128
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2129
+JUMPV
+LABELV $2128
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2129
+LABELV $2127
+LABELV $2124
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2130
+ADDRLP4 156
+CNSTI4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2131
+JUMPV
+LABELV $2130
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2133
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2134
+JUMPV
+LABELV $2133
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2135
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2136
+JUMPV
+LABELV $2135
+ADDRLP4 156
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2136
+LABELV $2134
+LABELV $2131
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2137
+ADDRLP4 172
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 264
+CNSTI4 40
+ASGNI4
+ADDRLP4 268
+ADDRLP4 0
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 272
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 4
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 268
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 272
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 276
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 276
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 268
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 272
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 276
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2140
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2140
+LABELV $2137
+ADDRLP4 260
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+24
+ADDRLP4 260
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 260
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156+4
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156+8
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2119
+JUMPV
+LABELV $2118
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2156
+ADDRLP4 264
+CNSTI4 1236
+ASGNI4
+ADDRLP4 244
+ADDRLP4 4
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 272
+CNSTI4 40
+ASGNI4
+ADDRLP4 252
+ADDRLP4 4
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 244
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2158
+ADDRLP4 172
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 280
+CNSTI4 40
+ASGNI4
+ADDRLP4 284
+ADDRLP4 0
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 288
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 4
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 288
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 288
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 292
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2161
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2161
+ADDRLP4 248
+ADDRLP4 16
+INDIRF4
+ADDRLP4 244
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 $2159
+JUMPV
+LABELV $2158
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+GEF4 $2163
+ADDRLP4 248
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 252
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $2164
+JUMPV
+LABELV $2163
+ADDRLP4 276
+CNSTI4 40
+ASGNI4
+ADDRLP4 248
+ADDRLP4 4
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 252
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $2164
+LABELV $2159
+ADDRLP4 240
+ADDRLP4 248
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2169
+ARGP4
+ADDRLP4 276
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $2167
+ADDRGP4 $2170
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 244
+INDIRI4
+ARGI4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 252
+INDIRF4
+DIVF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2167
+ADDRLP4 280
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 248
+INDIRF4
+ADDRLP4 280
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 284
+CNSTI4 12
+ASGNI4
+ADDRLP4 288
+ADDRLP4 0
+INDIRP4
+CNSTI4 1236
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 284
+INDIRI4
+ADDRLP4 288
+INDIRP4
+INDIRI4
+ADDRLP4 280
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 156
+ADDRLP4 284
+INDIRI4
+ADDRLP4 288
+INDIRP4
+INDIRI4
+ADDRLP4 280
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 cg+2869080+12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2169
+ARGP4
+ADDRLP4 292
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $2176
+ADDRGP4 $2178
+ARGP4
+ADDRLP4 252
+INDIRF4
+ARGF4
+ADDRLP4 256
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2179
+ARGP4
+ADDRLP4 296
+ADDRLP4 0
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+ADDRLP4 240
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56+4
+INDIRF4
+ARGF4
+ADDRLP4 56+8
+INDIRF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 156+4
+INDIRF4
+ARGF4
+ADDRLP4 156+8
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2176
+ADDRLP4 16
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRGP4 $2169
+ARGP4
+ADDRLP4 296
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $2184
+ADDRGP4 $2186
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2184
+ADDRLP4 300
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+24
+ADDRLP4 300
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 300
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156+4
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156+8
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2157
+JUMPV
+LABELV $2156
+ADDRLP4 240
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 4
+EQI4 $2203
+ADDRLP4 240
+INDIRI4
+CNSTI4 5
+NEI4 $2201
+LABELV $2203
+ADDRLP4 244
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2204
+ADDRLP4 244
+CNSTI4 1
+ASGNI4
+LABELV $2204
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2206
+ADDRLP4 172
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 252
+CNSTI4 40
+ASGNI4
+ADDRLP4 256
+ADDRLP4 0
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 260
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 4
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 256
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 260
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 264
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 264
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 256
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 260
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 264
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2209
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2209
+ADDRLP4 272
+CNSTI4 40
+ASGNI4
+ADDRLP4 276
+ADDRLP4 0
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 276
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 276
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 244
+INDIRI4
+ARGI4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2202
+JUMPV
+LABELV $2206
+ADDRLP4 16
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 244
+INDIRI4
+ARGI4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2202
+JUMPV
+LABELV $2201
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2216
+ADDRLP4 244
+CNSTI4 40
+ASGNI4
+ADDRLP4 248
+ADDRLP4 0
+INDIRP4
+ADDRLP4 244
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 248
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 244
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 248
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2219
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2219
+ADDRLP4 0
+INDIRP4
+CNSTI4 1432
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2221
+ADDRLP4 256
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2223
+ADDRLP4 256
+ADDRLP4 4
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2226
+JUMPV
+LABELV $2225
+ADDRLP4 256
+ADDRLP4 256
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2226
+ADDRLP4 272
+ADDRLP4 256
+INDIRP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2228
+ADDRLP4 272
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2225
+LABELV $2228
+LABELV $2223
+ADDRLP4 252
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2230
+JUMPV
+LABELV $2229
+ADDRLP4 252
+ADDRLP4 252
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2230
+ADDRLP4 272
+ADDRLP4 252
+INDIRP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2232
+ADDRLP4 272
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2229
+LABELV $2232
+ADDRLP4 276
+CNSTP4 0
+ASGNP4
+ADDRLP4 268
+ADDRLP4 276
+INDIRP4
+ASGNP4
+ADDRLP4 264
+ADDRLP4 276
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRLP4 276
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1440
+ADDP4
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $2233
+ADDRLP4 260
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 264
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 256
+INDIRP4
+ASGNP4
+ADDRGP4 $2234
+JUMPV
+LABELV $2233
+ADDRLP4 260
+ADDRLP4 252
+INDIRP4
+ASGNP4
+ADDRLP4 264
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $2234
+ADDRLP4 280
+CNSTU4 0
+ASGNU4
+ADDRLP4 260
+INDIRP4
+CVPU4 4
+ADDRLP4 280
+INDIRU4
+EQU4 $2217
+ADDRLP4 264
+INDIRP4
+CVPU4 4
+ADDRLP4 280
+INDIRU4
+EQU4 $2217
+ADDRLP4 268
+INDIRP4
+CVPU4 4
+ADDRLP4 280
+INDIRU4
+EQU4 $2217
+ADDRLP4 288
+CNSTI4 0
+ASGNI4
+ADDRLP4 284
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 288
+INDIRI4
+ASGNI4
+LABELV $2237
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LTF4 $2241
+ADDRLP4 300
+CNSTI4 40
+ASGNI4
+ADDRLP4 292
+ADDRLP4 4
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 260
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $2242
+JUMPV
+LABELV $2241
+ADDRLP4 292
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 260
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+LABELV $2242
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2244
+ADDRLP4 172
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 308
+CNSTI4 40
+ASGNI4
+ADDRLP4 312
+ADDRLP4 0
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 316
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 4
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 316
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 320
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 320
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 316
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 320
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 300
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2247
+ADDRLP4 300
+CNSTF4 1065353216
+ASGNF4
+LABELV $2247
+ADDRLP4 292
+ADDRLP4 168
+INDIRF4
+ADDRLP4 300
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1436
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ADDF4
+ASGNF4
+LABELV $2244
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LTF4 $2249
+ADDRGP4 cg+609412+24
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2250
+JUMPV
+LABELV $2249
+ADDRLP4 300
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 308
+ADDRLP4 292
+INDIRF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 300
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1396
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1408
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1420
+ADDP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 300
+INDIRI4
+ADDRGP4 cg+609412+24
+ADDP4
+ADDRLP4 296
+INDIRF4
+ASGNF4
+LABELV $2250
+LABELV $2238
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+LTI4 $2237
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $2217
+ADDRGP4 $2257
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2217
+JUMPV
+LABELV $2221
+ADDRLP4 252
+CNSTI4 40
+ASGNI4
+ADDRLP4 256
+ADDRLP4 0
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 256
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 256
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2259
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2259
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2261
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2261
+ADDRLP4 56
+CNSTI4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2262
+JUMPV
+LABELV $2261
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2264
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2264
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2265
+JUMPV
+LABELV $2264
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2266
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2266
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2267
+JUMPV
+LABELV $2266
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2267
+LABELV $2265
+LABELV $2262
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2268
+ADDRLP4 156
+CNSTI4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2269
+JUMPV
+LABELV $2268
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2271
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2272
+JUMPV
+LABELV $2271
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2273
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRGP4 CG_CameraSplineOriginAt
+CALLI4
+pop
+ADDRGP4 $2274
+JUMPV
+LABELV $2273
+ADDRLP4 156
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2274
+LABELV $2272
+LABELV $2269
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2275
+ADDRLP4 172
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 276
+CNSTI4 40
+ASGNI4
+ADDRLP4 280
+ADDRLP4 0
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 284
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 4
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 284
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 284
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 288
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2278
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2278
+LABELV $2275
+ADDRLP4 272
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+24
+ADDRLP4 272
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156+4
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156+8
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2217
+JUMPV
+LABELV $2216
+ADDRGP4 $2294
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2217
+LABELV $2202
+LABELV $2157
+LABELV $2119
+LABELV $2115
+LABELV $2109
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $2300
+JUMPV
+LABELV $2299
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2300
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2302
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2299
+LABELV $2302
+ADDRGP4 $2304
+JUMPV
+LABELV $2303
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2304
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2306
+ADDRLP4 8
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2303
+LABELV $2306
+ADDRGP4 $2308
+JUMPV
+LABELV $2307
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2308
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2310
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2307
+LABELV $2310
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2311
+ADDRGP4 $2313
+JUMPV
+LABELV $2311
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2314
+ADDRGP4 cg+609780
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1240
+ADDP4
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 $2313
+JUMPV
+LABELV $2314
+ADDRLP4 256
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+EQI4 $2323
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+NEI4 $2321
+LABELV $2323
+ADDRLP4 260
+CNSTI4 40
+ASGNI4
+ADDRLP4 264
+ADDRLP4 0
+INDIRP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 264
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 264
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2325
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2325
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2327
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2329
+ADDRGP4 $2331
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2329
+ADDRLP4 92
+ADDRLP4 8
+INDIRP4
+CNSTI4 1240
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2328
+JUMPV
+LABELV $2327
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2335
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $2335
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 92
+ARGP4
+ADDRGP4 CG_CameraSplineAnglesAt
+CALLI4
+pop
+ADDRGP4 $2336
+JUMPV
+LABELV $2335
+ADDRLP4 92
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2336
+LABELV $2328
+ADDRLP4 192
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2337
+ADDRLP4 140
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 192
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $2338
+JUMPV
+LABELV $2337
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2339
+ADDRGP4 $2341
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2339
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2345
+ADDRLP4 140
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 192
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $2346
+JUMPV
+LABELV $2345
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2347
+ADDRGP4 $2349
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2347
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2353
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2355
+ADDRGP4 $2357
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2355
+ADDRLP4 56
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 56
+ADDRLP4 56
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 56
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 56+4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 56+8
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 192
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $2354
+JUMPV
+LABELV $2353
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2375
+ADDRLP4 56
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRLP4 56
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 56+4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 56+8
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 192
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $2376
+JUMPV
+LABELV $2375
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2389
+ADDRGP4 $2391
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2389
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $2395
+ADDRLP4 56
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRLP4 56
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 56+4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 56+8
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 192
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $2396
+JUMPV
+LABELV $2395
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $2409
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 140
+ARGP4
+ADDRGP4 CG_CameraSplineAnglesAt
+CALLI4
+pop
+ADDRLP4 192
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $2410
+JUMPV
+LABELV $2409
+ADDRGP4 $2411
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2410
+LABELV $2396
+LABELV $2376
+LABELV $2354
+LABELV $2346
+LABELV $2338
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $2414
+ADDRLP4 92+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 140+8
+CNSTF4 0
+ASGNF4
+LABELV $2414
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2418
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2420
+ADDRLP4 92
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 272
+ADDRGP4 CG_CameraAngleLongestDistanceWithRoll
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRGP4 $2421
+JUMPV
+LABELV $2420
+ADDRLP4 92
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 272
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 272
+INDIRF4
+ASGNF4
+LABELV $2421
+ADDRLP4 272
+CNSTI4 40
+ASGNI4
+ADDRLP4 280
+ADDRLP4 0
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 284
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 192
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 284
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 284
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 288
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2423
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2423
+LABELV $2418
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 272
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRGP4 cg+609780
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 92+4
+INDIRF4
+ARGF4
+ADDRLP4 140+4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 276
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRGP4 cg+609780+4
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRLP4 92+8
+INDIRF4
+ARGF4
+ADDRLP4 140+8
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 280
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRGP4 cg+609780+8
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRGP4 $2322
+JUMPV
+LABELV $2321
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2434
+ADDRGP4 cg+609780
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2435
+JUMPV
+LABELV $2434
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2437
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2439
+ADDRGP4 cg+609780
+ADDRLP4 8
+INDIRP4
+CNSTI4 1240
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2438
+JUMPV
+LABELV $2439
+ADDRGP4 $2442
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2437
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2446
+ADDRLP4 284
+CNSTI4 40
+ASGNI4
+ADDRLP4 288
+ADDRLP4 0
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2449
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2449
+ADDRLP4 212
+CNSTI4 1496
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 292
+ADDRLP4 212
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 292
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 292
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2451
+LABELV $2451
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2453
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $2455
+ADDRGP4 $2457
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2455
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $2461
+ADDRLP4 296
+CNSTI4 1460
+ASGNI4
+ADDRLP4 152
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1392
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 304
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 308
+CNSTI4 92
+ASGNI4
+ADDRLP4 260
+ADDRLP4 304
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 312
+CNSTI4 96
+ASGNI4
+ADDRLP4 264
+ADDRLP4 304
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 316
+CNSTI4 100
+ASGNI4
+ADDRLP4 268
+ADDRLP4 304
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 320
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 272
+ADDRLP4 320
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 276
+ADDRLP4 320
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 320
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 324
+CNSTI4 40
+ASGNI4
+ADDRLP4 328
+ADDRLP4 304
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 328
+INDIRF4
+SUBF4
+ADDRLP4 320
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2454
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2454
+JUMPV
+LABELV $2461
+ADDRLP4 152
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 304
+CNSTI4 92
+ASGNI4
+ADDRLP4 260
+ADDRLP4 0
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 308
+CNSTI4 96
+ASGNI4
+ADDRLP4 264
+ADDRLP4 0
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 312
+CNSTI4 100
+ASGNI4
+ADDRLP4 268
+ADDRLP4 0
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 4
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 276
+ADDRLP4 4
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 4
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2454
+JUMPV
+LABELV $2453
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2468
+ADDRLP4 152
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+CNSTI4 0
+ASGNI4
+ADDRLP4 280
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRLP4 276
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2469
+JUMPV
+LABELV $2468
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2470
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $2472
+ADDRGP4 $2474
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2472
+ADDRLP4 296
+CNSTI4 1460
+ASGNI4
+ADDRLP4 152
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1388
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1392
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 304
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 308
+CNSTI4 92
+ASGNI4
+ADDRLP4 260
+ADDRLP4 304
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 312
+CNSTI4 96
+ASGNI4
+ADDRLP4 264
+ADDRLP4 304
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 316
+CNSTI4 100
+ASGNI4
+ADDRLP4 268
+ADDRLP4 304
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 320
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 272
+ADDRLP4 320
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 276
+ADDRLP4 320
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 320
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 324
+CNSTI4 40
+ASGNI4
+ADDRLP4 328
+ADDRLP4 304
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 328
+INDIRF4
+SUBF4
+ADDRLP4 320
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2471
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2471
+JUMPV
+LABELV $2470
+ADDRGP4 $2483
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2471
+LABELV $2469
+LABELV $2454
+ADDRLP4 296
+CNSTI4 40
+ASGNI4
+ADDRLP4 168
+ADDRLP4 196
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $2486
+ADDRLP4 300
+CNSTI4 40
+ASGNI4
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRGP4 $2487
+JUMPV
+LABELV $2486
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+LABELV $2487
+ADDRLP4 152
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2490
+ADDRLP4 272
+INDIRI4
+ADDRLP4 260
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 300
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 304
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 308
+ADDRLP4 304
+INDIRP4
+CNSTI4 156
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 304
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 308
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 316
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 316
+INDIRI4
+CVIF4 4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ADDRLP4 272
+INDIRI4
+ADDRLP4 316
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2491
+JUMPV
+LABELV $2490
+ADDRLP4 300
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 300
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 272
+INDIRI4
+ADDRLP4 300
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $2491
+ADDRLP4 152
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2492
+ADDRLP4 276
+INDIRI4
+ADDRLP4 264
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 300
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 304
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 308
+ADDRLP4 304
+INDIRP4
+CNSTI4 168
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 304
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 308
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 316
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 316
+INDIRI4
+CVIF4 4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 316
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2493
+JUMPV
+LABELV $2492
+ADDRLP4 300
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 300
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 300
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $2493
+ADDRLP4 152
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2494
+ADDRLP4 280
+INDIRI4
+ADDRLP4 268
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 300
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 304
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 308
+ADDRLP4 304
+INDIRP4
+CNSTI4 180
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 304
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 308
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 316
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 316
+INDIRI4
+CVIF4 4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ADDRLP4 280
+INDIRI4
+ADDRLP4 316
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2495
+JUMPV
+LABELV $2494
+ADDRLP4 300
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 300
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 280
+INDIRI4
+ADDRLP4 300
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $2495
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 264
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 268
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 24+4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 24+8
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80
+ARGP4
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $2447
+JUMPV
+LABELV $2446
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2511
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 260
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 5
+EQI4 $2515
+ADDRLP4 260
+INDIRI4
+CNSTI4 7
+NEI4 $2513
+LABELV $2515
+ADDRLP4 156
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 268
+CNSTI4 40
+ASGNI4
+ADDRLP4 272
+ADDRLP4 0
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2517
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2517
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2514
+ADDRLP4 56
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRLP4 276
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRLP4 280
+CNSTI4 40
+ASGNI4
+ADDRLP4 288
+ADDRLP4 0
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 292
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 4
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 292
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 292
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 296
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2514
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2514
+JUMPV
+LABELV $2513
+ADDRLP4 0
+INDIRP4
+CNSTI4 1364
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $2524
+ADDRGP4 $2526
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2524
+ADDRLP4 0
+INDIRP4
+CNSTI4 1364
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $2530
+ADDRLP4 264
+CNSTI4 1460
+ASGNI4
+ADDRLP4 272
+ADDRLP4 0
+INDIRP4
+CNSTI4 1368
+ADDP4
+ASGNP4
+ADDRLP4 156
+ADDRLP4 264
+INDIRI4
+ADDRLP4 272
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 276
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 276
+INDIRF4
+SUBF4
+ADDRLP4 264
+INDIRI4
+ADDRLP4 272
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ADDRLP4 276
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2537
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2537
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2539
+ADDRLP4 56
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRLP4 280
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 292
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+CNSTI4 1460
+ADDRLP4 0
+INDIRP4
+CNSTI4 1368
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+40
+ADDP4
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 292
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 292
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 296
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2544
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2544
+LABELV $2539
+LABELV $2530
+LABELV $2514
+ADDRLP4 264
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 264
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 264
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156+4
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156+8
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 24+4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 24+8
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80
+ARGP4
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $2512
+JUMPV
+LABELV $2511
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2567
+ADDRLP4 0
+INDIRP4
+CNSTI4 1364
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $2569
+ADDRGP4 $2571
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2569
+ADDRLP4 260
+CNSTI4 1460
+ASGNI4
+ADDRLP4 152
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1364
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1368
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 272
+CNSTI4 52
+ASGNI4
+ADDRLP4 56
+ADDRLP4 268
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 276
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 156
+ADDRLP4 276
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 280
+CNSTI4 40
+ASGNI4
+ADDRLP4 284
+ADDRLP4 268
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 284
+INDIRF4
+SUBF4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2578
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2578
+ADDRLP4 152
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2580
+ADDRLP4 56
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRLP4 288
+ADDRGP4 CG_CameraAngleLongestDistanceNoRoll
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 288
+INDIRF4
+ASGNF4
+ADDRLP4 292
+CNSTI4 40
+ASGNI4
+ADDRLP4 296
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 300
+ADDRLP4 296
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 304
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 196
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 300
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 304
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 308
+ADDRLP4 296
+INDIRP4
+CNSTI4 136
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 296
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 300
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 304
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 308
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2583
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2583
+LABELV $2580
+ADDRLP4 288
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 288
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156+4
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156+8
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 24+4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 24+8
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80
+ARGP4
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $2568
+JUMPV
+LABELV $2567
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $2606
+ADDRLP4 80
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80
+ARGP4
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $2607
+JUMPV
+LABELV $2606
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $2619
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2621
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 92
+ARGP4
+ADDRGP4 CG_CameraSplineAnglesAt
+CALLI4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 140
+ARGP4
+ADDRGP4 CG_CameraSplineAnglesAt
+CALLI4
+pop
+ADDRLP4 92
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 260
+ADDRGP4 CG_CameraAngleLongestDistanceWithRoll
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRLP4 264
+CNSTI4 40
+ASGNI4
+ADDRLP4 272
+ADDRLP4 0
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 276
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 4
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 272
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 276
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 272
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 276
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 280
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2624
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2624
+ADDRLP4 288
+CNSTI4 40
+ASGNI4
+ADDRLP4 292
+ADDRLP4 0
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 292
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 CG_CameraSplineAnglesAt
+CALLI4
+pop
+ADDRGP4 $2620
+JUMPV
+LABELV $2621
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 CG_CameraSplineAnglesAt
+CALLI4
+pop
+ADDRGP4 $2620
+JUMPV
+LABELV $2619
+ADDRGP4 $2629
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2620
+LABELV $2607
+LABELV $2568
+LABELV $2512
+LABELV $2447
+LABELV $2438
+LABELV $2435
+LABELV $2322
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2633
+ADDRGP4 $2634
+JUMPV
+LABELV $2633
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2635
+ADDRLP4 260
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $2639
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+NEI4 $2637
+LABELV $2639
+ADDRLP4 268
+CNSTI4 24
+ASGNI4
+ADDRLP4 200
+ADDRLP4 0
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 204
+ADDRLP4 4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 276
+CNSTI4 40
+ASGNI4
+ADDRLP4 280
+ADDRLP4 0
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 280
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 280
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2641
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2641
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2638
+ADDRLP4 204
+INDIRF4
+ADDRLP4 200
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 284
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 284
+INDIRF4
+ASGNF4
+ADDRLP4 288
+CNSTI4 40
+ASGNI4
+ADDRLP4 296
+ADDRLP4 0
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 300
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 4
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 300
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 304
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 300
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 304
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2638
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2638
+JUMPV
+LABELV $2637
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2648
+ADDRLP4 0
+INDIRP4
+CNSTI4 1372
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $2650
+ADDRGP4 $2652
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2650
+ADDRLP4 264
+CNSTI4 1460
+ASGNI4
+ADDRLP4 152
+ADDRLP4 264
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1372
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 264
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1376
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 272
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 276
+CNSTI4 24
+ASGNI4
+ADDRLP4 200
+ADDRLP4 272
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 204
+ADDRLP4 280
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 284
+CNSTI4 40
+ASGNI4
+ADDRLP4 288
+ADDRLP4 272
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+ADDRLP4 280
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2659
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2659
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2649
+ADDRLP4 204
+INDIRF4
+ADDRLP4 200
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 292
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 292
+INDIRF4
+ASGNF4
+ADDRLP4 296
+CNSTI4 40
+ASGNI4
+ADDRLP4 300
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 304
+ADDRLP4 300
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 308
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 196
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 308
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 312
+ADDRLP4 300
+INDIRP4
+CNSTI4 204
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 300
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 308
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 312
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2649
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2649
+JUMPV
+LABELV $2648
+ADDRGP4 $2666
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2649
+LABELV $2638
+ADDRLP4 200
+INDIRF4
+ARGF4
+ADDRLP4 204
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 264
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRGP4 cg+609780+8
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRGP4 $2636
+JUMPV
+LABELV $2635
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2671
+ADDRGP4 cg+609780+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $2672
+JUMPV
+LABELV $2671
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2675
+ADDRLP4 0
+INDIRP4
+CNSTI4 1372
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $2677
+ADDRGP4 $2679
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2677
+ADDRLP4 260
+CNSTI4 1460
+ASGNI4
+ADDRLP4 152
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1372
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1376
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 272
+CNSTI4 24
+ASGNI4
+ADDRLP4 200
+ADDRLP4 268
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 204
+ADDRLP4 276
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 280
+CNSTI4 40
+ASGNI4
+ADDRLP4 284
+ADDRLP4 268
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 284
+INDIRF4
+SUBF4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2686
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2686
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2688
+ADDRLP4 204
+INDIRF4
+ADDRLP4 200
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 288
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 288
+INDIRF4
+ASGNF4
+ADDRLP4 292
+CNSTI4 40
+ASGNI4
+ADDRLP4 296
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 300
+ADDRLP4 296
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 304
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 196
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 300
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 304
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 308
+ADDRLP4 296
+INDIRP4
+CNSTI4 204
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 296
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 300
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 304
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 308
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2691
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2691
+LABELV $2688
+ADDRLP4 288
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609780+8
+ADDRLP4 288
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 204
+INDIRF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2676
+JUMPV
+LABELV $2675
+ADDRGP4 $2695
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2676
+LABELV $2672
+LABELV $2636
+LABELV $2634
+ADDRLP4 0
+INDIRP4
+CNSTI4 1240
+ADDP4
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $2313
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $2704
+JUMPV
+LABELV $2703
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2704
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2706
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2703
+LABELV $2706
+ADDRGP4 $2708
+JUMPV
+LABELV $2707
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2708
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2710
+ADDRLP4 8
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2707
+LABELV $2710
+ADDRGP4 $2712
+JUMPV
+LABELV $2711
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1444
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2712
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2714
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2711
+LABELV $2714
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2715
+ADDRGP4 $2298
+JUMPV
+LABELV $2715
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2717
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2719
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $2719
+ADDRLP4 48
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $2720
+JUMPV
+LABELV $2719
+ADDRLP4 48
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+LABELV $2720
+ADDRGP4 cg+609412+16
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+16
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2727
+ADDRGP4 cg+609412+16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2727
+ADDRGP4 cg+609412+16
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+16
+ARGP4
+ADDRGP4 cg+609412+20
+ARGP4
+ADDRGP4 CG_AdjustedFov
+CALLV
+pop
+ADDRGP4 $2298
+JUMPV
+LABELV $2717
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2739
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2741
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $2741
+ADDRLP4 48
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $2740
+JUMPV
+LABELV $2741
+ADDRLP4 48
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+ADDRGP4 $2740
+JUMPV
+LABELV $2739
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2747
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2749
+ADDRLP4 172
+ADDRLP4 0
+INDIRP4
+CNSTI4 1332
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 280
+CNSTI4 40
+ASGNI4
+ADDRLP4 284
+ADDRLP4 0
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 288
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 4
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 288
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 288
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 292
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2752
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2752
+ADDRLP4 300
+CNSTI4 40
+ASGNI4
+ADDRLP4 304
+ADDRLP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 304
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 272
+ARGP4
+ADDRLP4 308
+ADDRGP4 CG_CameraSplineFovAt
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+NEI4 $2754
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2756
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $2756
+ADDRLP4 48
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $2748
+JUMPV
+LABELV $2756
+ADDRLP4 48
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+ADDRGP4 $2748
+JUMPV
+LABELV $2754
+ADDRLP4 48
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRGP4 $2748
+JUMPV
+LABELV $2749
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 272
+ARGP4
+ADDRLP4 276
+ADDRGP4 CG_CameraSplineFovAt
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $2762
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2765
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $2765
+ADDRLP4 48
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $2748
+JUMPV
+LABELV $2765
+ADDRLP4 48
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+ADDRGP4 $2748
+JUMPV
+LABELV $2762
+ADDRLP4 48
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRGP4 $2748
+JUMPV
+LABELV $2747
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2771
+ADDRLP4 272
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 1
+EQI4 $2775
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+NEI4 $2773
+LABELV $2775
+ADDRLP4 280
+CNSTI4 104
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 4
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 288
+CNSTI4 40
+ASGNI4
+ADDRLP4 292
+ADDRLP4 0
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 292
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 292
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2777
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2777
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2774
+ADDRLP4 208
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 296
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 296
+INDIRF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 40
+ASGNI4
+ADDRLP4 308
+ADDRLP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 312
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 4
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 312
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 316
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDRLP4 316
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 312
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 316
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2774
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2774
+JUMPV
+LABELV $2773
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2784
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2786
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $2786
+ADDRLP4 208
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $2787
+JUMPV
+LABELV $2786
+ADDRLP4 208
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+LABELV $2787
+ADDRLP4 276
+CNSTI4 40
+ASGNI4
+ADDRLP4 280
+ADDRLP4 0
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 280
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 280
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2793
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2793
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2785
+ADDRLP4 208
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 284
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 284
+INDIRF4
+ASGNF4
+ADDRLP4 288
+CNSTI4 40
+ASGNI4
+ADDRLP4 296
+ADDRLP4 0
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 300
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 4
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 300
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 304
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 300
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 304
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2785
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2785
+JUMPV
+LABELV $2784
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2800
+ADDRLP4 0
+INDIRP4
+CNSTI4 1380
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $2802
+ADDRGP4 $2804
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 276
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2802
+ADDRLP4 276
+CNSTI4 1460
+ASGNI4
+ADDRLP4 152
+ADDRLP4 276
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1380
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 276
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1384
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 284
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 288
+CNSTI4 104
+ASGNI4
+ADDRLP4 48
+ADDRLP4 284
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 208
+ADDRLP4 292
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 296
+CNSTI4 40
+ASGNI4
+ADDRLP4 300
+ADDRLP4 284
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 300
+INDIRF4
+SUBF4
+ADDRLP4 292
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 300
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2811
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2811
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2801
+ADDRLP4 208
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 304
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 304
+INDIRF4
+ASGNF4
+ADDRLP4 308
+CNSTI4 40
+ASGNI4
+ADDRLP4 312
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 316
+ADDRLP4 312
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 320
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 196
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 316
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 320
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 324
+ADDRLP4 312
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 312
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDRLP4 324
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 316
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 320
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 324
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2801
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2801
+JUMPV
+LABELV $2800
+ADDRGP4 $2818
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2801
+LABELV $2785
+LABELV $2774
+ADDRLP4 48
+ADDRLP4 48
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2772
+JUMPV
+LABELV $2771
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2821
+ADDRLP4 0
+INDIRP4
+CNSTI4 1380
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $2823
+ADDRGP4 $2825
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2823
+ADDRLP4 272
+CNSTI4 1460
+ASGNI4
+ADDRLP4 152
+ADDRLP4 272
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1380
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 272
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1384
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 280
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 284
+CNSTI4 104
+ASGNI4
+ADDRLP4 48
+ADDRLP4 280
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 208
+ADDRLP4 288
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 292
+CNSTI4 40
+ASGNI4
+ADDRLP4 296
+ADDRLP4 280
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+ADDRLP4 288
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2832
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2832
+ADDRLP4 152
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2834
+ADDRLP4 208
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 300
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 304
+CNSTI4 40
+ASGNI4
+ADDRLP4 308
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 312
+ADDRLP4 308
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 316
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 168
+ADDRLP4 196
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 316
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 320
+ADDRLP4 308
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 308
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDRLP4 320
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 168
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 316
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 320
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2837
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2837
+LABELV $2834
+ADDRLP4 48
+ADDRLP4 48
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2822
+JUMPV
+LABELV $2821
+ADDRGP4 $2839
+ARGP4
+ADDRGP4 cg+3196796
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 CG_ErrorPopup
+CALLV
+pop
+ADDRGP4 cg+3196784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2298
+JUMPV
+LABELV $2822
+LABELV $2772
+LABELV $2748
+LABELV $2740
+ADDRGP4 cg+609412+16
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+16
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2845
+ADDRGP4 cg+609412+16
+CNSTF4 1065353216
+ASGNF4
+LABELV $2845
+ADDRGP4 cg+609412+16
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+16
+ARGP4
+ADDRGP4 cg+609412+20
+ARGP4
+ADDRGP4 CG_AdjustedFov
+CALLV
+pop
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+LABELV $2298
+ADDRGP4 cg+609412+72
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+CNSTI4 1023
+ARGI4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_cameraUpdateFreeCam+12
+INDIRI4
+ADDRLP4 272
+INDIRI4
+EQI4 $2864
+ADDRGP4 cg_cameraDebugPath+12
+INDIRI4
+ADDRLP4 272
+INDIRI4
+NEI4 $2864
+ADDRGP4 cg+1332220
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332124
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 276
+ADDRGP4 cg+1332124+8
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+SUBF4
+ASGNF4
+ADDRGP4 cg+1332136
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332160
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+LTF4 $2877
+ADDRLP4 280
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332224+32+8
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332224+32+4
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332224+32
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRGP4 $2878
+JUMPV
+LABELV $2877
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+1332732
+INDIRF4
+LEF4 $2888
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $2892
+ADDRLP4 280
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+ADDRGP4 cg+1332224+32
+ADDP4
+ADDRLP4 280
+INDIRI4
+ADDRGP4 cg+609412+24
+ADDP4
+INDIRF4
+ADDRLP4 280
+INDIRI4
+ADDRGP4 cg+3196824
+ADDP4
+INDIRF4
+SUBF4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+1332732
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ASGNF4
+LABELV $2893
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+LTI4 $2892
+ADDRGP4 $2889
+JUMPV
+LABELV $2888
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+1332732
+INDIRF4
+GEF4 $2903
+ADDRGP4 cg+1332224+32
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332224+32+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+1332224+32+8
+CNSTF4 0
+ASGNF4
+LABELV $2903
+LABELV $2889
+LABELV $2878
+LABELV $2864
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+LTF4 $2915
+ADDRLP4 276
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+3196836+8
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRGP4 cg+3196836+4
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRGP4 cg+3196836
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRGP4 $2916
+JUMPV
+LABELV $2915
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+1332732
+INDIRF4
+LEF4 $2923
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $2927
+ADDRLP4 276
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+ADDRGP4 cg+3196836
+ADDP4
+ADDRLP4 276
+INDIRI4
+ADDRGP4 cg+609412+24
+ADDP4
+INDIRF4
+ADDRLP4 276
+INDIRI4
+ADDRGP4 cg+3196824
+ADDP4
+INDIRF4
+SUBF4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+1332732
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+DIVF4
+ASGNF4
+LABELV $2928
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+LTI4 $2927
+ADDRGP4 $2924
+JUMPV
+LABELV $2923
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+1332732
+INDIRF4
+GEF4 $2937
+ADDRGP4 cg+3196836
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+3196836+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+3196836+8
+CNSTF4 0
+ASGNF4
+LABELV $2937
+LABELV $2924
+LABELV $2916
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+1332732
+INDIRF4
+EQF4 $2946
+ADDRGP4 cg+1332732
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRGP4 cg+3196824
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+LABELV $2946
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $2955
+ADDRLP4 448
+ADDRGP4 $2957
+INDIRB
+ASGNB 4
+ADDRLP4 276
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 276+68
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 276
+CNSTI4 0
+ASGNI4
+ADDRLP4 276+8
+ADDRGP4 cgs+632912+492376
+INDIRI4
+ASGNI4
+ADDRLP4 276+28
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 276+132
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 276+112
+CNSTI4 0
+ASGNI4
+ADDRLP4 276+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 276+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 276+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 276+116+3
+CNSTU1 100
+ASGNU1
+ADDRLP4 276+4
+CNSTI4 8
+ASGNI4
+ADDRLP4 276
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 cg+609780
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 452
+CNSTP4 0
+ASGNP4
+ADDRLP4 452
+INDIRP4
+ARGP4
+ADDRLP4 452
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 276+68
+INDIRB
+ASGNB 12
+ADDRLP4 456
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 456
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 456
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1133903872
+ADDRLP4 80+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 276+68
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 cg_railTrailTime+8
+INDIRF4
+ARGF4
+ADDRLP4 448
+ARGP4
+ADDRGP4 CG_SimpleRailTrail
+CALLV
+pop
+ADDRGP4 cg+609412+24
+ADDRLP4 104
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ADDRLP4 116
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+609412+16
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+20
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332224+32
+ADDRLP4 128
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332160
+CNSTI4 1
+ASGNI4
+LABELV $2955
+ADDRLP4 44
+INDIRI4
+RETI4
+LABELV $1873
+endproc CG_PlayCamera 460 36
+export CG_AdjustOriginToAvoidSolid
+proc CG_AdjustOriginToAvoidSolid 88 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 bg_playerMins
+INDIRB
+ASGNB 12
+ADDRLP4 68
+ADDRGP4 bg_playerMaxs
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $2999
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+LABELV $2999
+LABELV $2998
+endproc CG_AdjustOriginToAvoidSolid 88 28
+bss
+align 4
+LABELV $3111
+skip 12
+code
+proc CG_FreeCam 448 52
+ADDRLP4 4
+ADDRGP4 cg+1332224
+ASGNP4
+ADDRLP4 256
+ADDRGP4 cg+607168
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRGP4 bg_playerMins
+INDIRB
+ASGNB 12
+ADDRLP4 260
+ADDRGP4 bg_playerMaxs
+INDIRB
+ASGNB 12
+ADDRGP4 cg+5417588
+INDIRI4
+CNSTI4 0
+EQI4 $3007
+LABELV $3007
+ADDRGP4 cg+1332752
+INDIRI4
+CNSTI4 0
+EQI4 $3010
+ADDRGP4 CG_PlayPath
+CALLV
+pop
+ADDRGP4 $3004
+JUMPV
+LABELV $3010
+ADDRGP4 cg+3196784
+INDIRI4
+CNSTI4 0
+EQI4 $3013
+ADDRGP4 $3016
+ARGP4
+ADDRLP4 284
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+NEI4 $3013
+LABELV $3013
+ADDRGP4 cg+1332220
+INDIRI4
+CNSTI4 0
+NEI4 $3017
+ADDRGP4 cg+1332220
+ADDRGP4 cg+607168
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRGP4 cg+1332136
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+609412+24
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRLP4 288
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRGP4 cg+609780
+ADDRGP4 cg+1332136
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $3035
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $3035
+ADDRGP4 cg+609412+16
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $3036
+JUMPV
+LABELV $3035
+ADDRGP4 cg+609412+16
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+LABELV $3036
+ADDRGP4 cg+609412+16
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3045
+ADDRGP4 cg+609412+16
+CNSTF4 1065353216
+ASGNF4
+LABELV $3045
+ADDRGP4 cg+609412+16
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+16
+ARGP4
+ADDRGP4 cg+609412+20
+ARGP4
+ADDRGP4 CG_AdjustedFov
+CALLV
+pop
+ADDRGP4 cg+609412+72
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $3004
+JUMPV
+LABELV $3017
+ADDRGP4 cg+1334988
+INDIRI4
+CNSTI4 -1
+NEI4 $3060
+ADDRGP4 cg+1335044
+INDIRI4
+CNSTI4 0
+NEI4 $3060
+ADDRGP4 cg+5417588
+INDIRI4
+CNSTI4 0
+NEI4 $3064
+ADDRGP4 cg+1332120
+INDIRI4
+CNSTI4 0
+NEI4 $3067
+ADDRLP4 296
+ADDRGP4 cg+1332136+4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+ADDRGP4 cg+1332164
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_freecam_sensitivity+8
+INDIRF4
+MULF4
+ADDRGP4 cg_freecam_yaw+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+1332164
+CNSTI4 0
+ASGNI4
+ADDRLP4 300
+ADDRGP4 cg+1332136
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRF4
+ADDRGP4 cg+1332168
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_freecam_sensitivity+8
+INDIRF4
+MULF4
+ADDRGP4 cg_freecam_pitch+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+1332168
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3068
+JUMPV
+LABELV $3067
+ADDRGP4 cg+1332136
+ADDRGP4 cg+1332224+152
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332120
+CNSTI4 0
+ASGNI4
+LABELV $3068
+LABELV $3064
+ADDRLP4 288
+ADDRGP4 cg+1332136+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332208
+INDIRI4
+CNSTI4 0
+EQI4 $3087
+ADDRLP4 296
+ADDRGP4 cg+1332136+8
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+ADDRGP4 cg_freecam_rollValue+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3087
+ADDRGP4 cg+1332212
+INDIRI4
+CNSTI4 0
+EQI4 $3093
+ADDRLP4 296
+ADDRGP4 cg+1332136+8
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+ADDRGP4 cg_freecam_rollValue+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3093
+ADDRGP4 cg+1332136+8
+INDIRF4
+ARGF4
+ADDRLP4 296
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 296
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332216
+INDIRI4
+CNSTI4 0
+EQI4 $3061
+ADDRLP4 300
+ADDRLP4 288
+INDIRF4
+ASGNF4
+ADDRLP4 304
+CNSTF4 0
+ASGNF4
+ADDRLP4 300
+INDIRF4
+ADDRLP4 304
+INDIRF4
+EQF4 $3107
+ADDRLP4 300
+INDIRF4
+ADDRLP4 304
+INDIRF4
+LEF4 $3108
+ADDRLP4 292
+INDIRF4
+ADDRLP4 304
+INDIRF4
+LEF4 $3107
+LABELV $3108
+ADDRLP4 308
+CNSTF4 0
+ASGNF4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 308
+INDIRF4
+GEF4 $3061
+ADDRLP4 292
+INDIRF4
+ADDRLP4 308
+INDIRF4
+LTF4 $3061
+LABELV $3107
+ADDRGP4 cg+1332136+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $3061
+JUMPV
+LABELV $3060
+ADDRGP4 cg+1335044
+INDIRI4
+CNSTI4 0
+EQI4 $3112
+ADDRLP4 288
+ADDRGP4 cg+1335048
+INDIRB
+ASGNB 12
+ADDRGP4 $3113
+JUMPV
+LABELV $3112
+ADDRLP4 332
+CNSTI4 1496
+ADDRGP4 cg+1334988
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 288
+ADDRLP4 332
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $3113
+ADDRLP4 288
+ADDRLP4 288
+INDIRF4
+ADDRGP4 cg+1335012
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 288+4
+ADDRLP4 288+4
+INDIRF4
+ADDRGP4 cg+1335016
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 288+8
+ADDRLP4 288+8
+INDIRF4
+ADDRGP4 cg+1335020
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 300+8
+ADDRLP4 300+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRGP4 $3111
+ADDRLP4 288
+INDIRF4
+ADDRLP4 300
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3111+4
+ADDRLP4 288+4
+INDIRF4
+ADDRLP4 300+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3111+8
+ADDRLP4 288+8
+INDIRF4
+ADDRLP4 300+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3111
+ARGP4
+ADDRLP4 316
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 336
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1335036
+INDIRI4
+ADDRLP4 336
+INDIRI4
+EQI4 $3129
+ADDRGP4 cg+5417588
+INDIRI4
+ADDRLP4 336
+INDIRI4
+NEI4 $3129
+ADDRLP4 340
+ADDRGP4 cg+1332136+4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+ADDRGP4 cg+1332164
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_freecam_sensitivity+8
+INDIRF4
+MULF4
+ADDRGP4 cg_freecam_yaw+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $3130
+JUMPV
+LABELV $3129
+ADDRLP4 340
+ADDRGP4 cg+1332136+4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+ADDRLP4 316+4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+LABELV $3130
+ADDRLP4 340
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1335040
+INDIRI4
+ADDRLP4 340
+INDIRI4
+EQI4 $3141
+ADDRGP4 cg+5417588
+INDIRI4
+ADDRLP4 340
+INDIRI4
+NEI4 $3141
+ADDRLP4 344
+ADDRGP4 cg+1332136
+ASGNP4
+ADDRLP4 344
+INDIRP4
+ADDRLP4 344
+INDIRP4
+INDIRF4
+ADDRGP4 cg+1332168
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_freecam_sensitivity+8
+INDIRF4
+MULF4
+ADDRGP4 cg_freecam_pitch+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $3142
+JUMPV
+LABELV $3141
+ADDRLP4 344
+ADDRGP4 cg+1332136
+ASGNP4
+ADDRLP4 344
+INDIRP4
+ADDRLP4 344
+INDIRP4
+INDIRF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+LABELV $3142
+ADDRLP4 312
+ADDRGP4 cg+1332136+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332208
+INDIRI4
+CNSTI4 0
+EQI4 $3152
+ADDRLP4 344
+ADDRGP4 cg+1332136+8
+ASGNP4
+ADDRLP4 344
+INDIRP4
+ADDRLP4 344
+INDIRP4
+INDIRF4
+ADDRGP4 cg_freecam_rollValue+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3152
+ADDRGP4 cg+1332212
+INDIRI4
+CNSTI4 0
+EQI4 $3158
+ADDRLP4 344
+ADDRGP4 cg+1332136+8
+ASGNP4
+ADDRLP4 344
+INDIRP4
+ADDRLP4 344
+INDIRP4
+INDIRF4
+ADDRGP4 cg_freecam_rollValue+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $3158
+ADDRGP4 cg+1332136+8
+INDIRF4
+ARGF4
+ADDRLP4 344
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 328
+ADDRLP4 344
+INDIRF4
+ASGNF4
+ADDRGP4 cg+1332216
+INDIRI4
+CNSTI4 0
+EQI4 $3166
+ADDRLP4 348
+ADDRLP4 312
+INDIRF4
+ASGNF4
+ADDRLP4 352
+CNSTF4 0
+ASGNF4
+ADDRLP4 348
+INDIRF4
+ADDRLP4 352
+INDIRF4
+EQF4 $3172
+ADDRLP4 348
+INDIRF4
+ADDRLP4 352
+INDIRF4
+LEF4 $3173
+ADDRLP4 328
+INDIRF4
+ADDRLP4 352
+INDIRF4
+LEF4 $3172
+LABELV $3173
+ADDRLP4 356
+CNSTF4 0
+ASGNF4
+ADDRLP4 312
+INDIRF4
+ADDRLP4 356
+INDIRF4
+GEF4 $3169
+ADDRLP4 328
+INDIRF4
+ADDRLP4 356
+INDIRF4
+LTF4 $3169
+LABELV $3172
+ADDRGP4 cg+1332136+8
+CNSTF4 0
+ASGNF4
+LABELV $3169
+LABELV $3166
+ADDRGP4 cg+5417588
+INDIRI4
+CNSTI4 0
+NEI4 $3176
+ADDRGP4 cg+1332164
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332168
+CNSTI4 0
+ASGNI4
+LABELV $3176
+LABELV $3061
+ADDRLP4 288
+CNSTI4 0
+ASGNI4
+ADDRLP4 252
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 244
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332188
+INDIRI4
+ADDRLP4 288
+INDIRI4
+EQI4 $3181
+ADDRLP4 244
+ADDRLP4 244
+INDIRI4
+CNSTI4 127
+ADDI4
+ASGNI4
+LABELV $3181
+ADDRGP4 cg+1332192
+INDIRI4
+CNSTI4 0
+EQI4 $3184
+ADDRLP4 244
+ADDRLP4 244
+INDIRI4
+CNSTI4 127
+SUBI4
+ASGNI4
+LABELV $3184
+ADDRGP4 cg+1332196
+INDIRI4
+CNSTI4 0
+EQI4 $3187
+ADDRLP4 248
+ADDRLP4 248
+INDIRI4
+CNSTI4 127
+ADDI4
+ASGNI4
+LABELV $3187
+ADDRGP4 cg+1332200
+INDIRI4
+CNSTI4 0
+EQI4 $3190
+ADDRLP4 248
+ADDRLP4 248
+INDIRI4
+CNSTI4 127
+SUBI4
+ASGNI4
+LABELV $3190
+ADDRGP4 cg+1332180
+INDIRI4
+CNSTI4 0
+EQI4 $3193
+ADDRLP4 252
+ADDRLP4 252
+INDIRI4
+CNSTI4 127
+ADDI4
+ASGNI4
+LABELV $3193
+ADDRGP4 cg+1332184
+INDIRI4
+CNSTI4 0
+EQI4 $3196
+ADDRLP4 252
+ADDRLP4 252
+INDIRI4
+CNSTI4 127
+SUBI4
+ASGNI4
+LABELV $3196
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+LEI4 $3199
+ADDRLP4 244
+CNSTI4 127
+ASGNI4
+LABELV $3199
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+GEI4 $3201
+ADDRLP4 244
+CNSTI4 -127
+ASGNI4
+LABELV $3201
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+LEI4 $3203
+ADDRLP4 248
+CNSTI4 127
+ASGNI4
+LABELV $3203
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+GEI4 $3205
+ADDRLP4 248
+CNSTI4 -127
+ASGNI4
+LABELV $3205
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+LEI4 $3207
+ADDRLP4 252
+CNSTI4 127
+ASGNI4
+LABELV $3207
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+GEI4 $3209
+ADDRLP4 252
+CNSTI4 -127
+ASGNI4
+LABELV $3209
+ADDRGP4 cg+5417588
+INDIRI4
+CNSTI4 0
+EQI4 $3211
+ADDRLP4 292
+CNSTI4 0
+ASGNI4
+ADDRLP4 252
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 244
+ADDRLP4 292
+INDIRI4
+ASGNI4
+LABELV $3211
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3214
+ADDRLP4 292
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+ADDRGP4 cg+1332136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 296
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 292
+INDIRI4
+ADDRGP4 cg+1332136
+ADDP4
+ADDRLP4 296
+INDIRF4
+ASGNF4
+LABELV $3215
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $3214
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8+228
+ADDRGP4 CG_Trace
+ASGNP4
+ADDRLP4 8+232
+ADDRGP4 CG_PointContents
+ASGNP4
+ADDRLP4 8+28
+CNSTI4 33619969
+ASGNI4
+ADDRLP4 8+28
+ADDRLP4 8+28
+INDIRI4
+CNSTI4 -33554433
+BANDI4
+ASGNI4
+ADDRLP4 8+36
+CNSTI4 0
+ASGNI4
+ADDRLP4 8+216
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ASGNI4
+ADDRLP4 8+220
+ADDRGP4 pmove_msec+12
+INDIRI4
+ASGNI4
+ADDRLP4 8+32
+CNSTI4 0
+ASGNI4
+ADDRLP4 8+180
+ADDRLP4 272
+INDIRB
+ASGNB 12
+ADDRLP4 8+192
+ADDRLP4 260
+INDIRB
+ASGNB 12
+ADDRGP4 cg_freecam_noclip+12
+INDIRI4
+CNSTI4 0
+EQI4 $3232
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3233
+JUMPV
+LABELV $3232
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $3233
+ADDRLP4 4
+INDIRP4
+ADDRGP4 cg+1332220
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 cg_freecam_speed+12
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+CNSTI4 100
+ASGNI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 800
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8+4+21
+ADDRLP4 244
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8+4+16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8+4+22
+ADDRLP4 248
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8+4+23
+ADDRLP4 252
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8+4
+ADDRGP4 cg+607168
+INDIRI4
+ASGNI4
+ADDRLP4 8+4+20
+CNSTU1 7
+ASGNU1
+ADDRGP4 cg_freecam_unlockPitch+12
+INDIRI4
+CNSTI4 0
+NEI4 $3249
+ADDRGP4 cg+1332136
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1119092736
+LEF4 $3252
+ADDRGP4 cg+1332136
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRGP4 $3253
+JUMPV
+LABELV $3252
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+ADDRGP4 cg+1332136
+INDIRF4
+SUBF4
+CNSTF4 1119092736
+LEF4 $3256
+ADDRGP4 cg+1332136
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+ASGNF4
+LABELV $3256
+LABELV $3253
+LABELV $3249
+ADDRLP4 8+224
+ADDRGP4 cg_freecam_unlockPitch+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3262
+ADDRLP4 292
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+ADDRLP4 8+4+4
+ADDP4
+CNSTF4 1199570944
+ADDRLP4 292
+INDIRI4
+ADDRGP4 cg+1332136
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+LABELV $3263
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $3262
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRGP4 cg+1332124
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332136
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+1332148
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609412+24
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRLP4 292
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRGP4 cg+609780
+ADDRGP4 cg+1332136
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3283
+ADDRLP4 296
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 300
+ADDRLP4 296
+INDIRI4
+ADDRGP4 cg+1332136
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 296
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3284
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $3283
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $3288
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $3288
+ADDRGP4 cg+609412+16
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $3289
+JUMPV
+LABELV $3288
+ADDRGP4 cg+609412+16
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+LABELV $3289
+ADDRGP4 cg+609412+16
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3298
+ADDRGP4 cg+609412+16
+CNSTF4 1065353216
+ASGNF4
+LABELV $3298
+ADDRGP4 cg+609412+16
+INDIRF4
+ARGF4
+ADDRLP4 296
+ADDRGP4 CG_CalcZoom
+CALLF4
+ASGNF4
+ADDRGP4 cg+609412+16
+ADDRLP4 296
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+16
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+16
+ARGP4
+ADDRGP4 cg+609412+20
+ARGP4
+ADDRGP4 CG_AdjustedFov
+CALLV
+pop
+ADDRGP4 cg+609412+72
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 300
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332204
+INDIRI4
+ADDRLP4 300
+INDIRI4
+EQI4 $3317
+ADDRGP4 cg+5417588
+INDIRI4
+ADDRLP4 300
+INDIRI4
+NEI4 $3317
+ADDRLP4 256
+INDIRI4
+ADDRGP4 cg+1332736
+INDIRI4
+SUBI4
+CNSTI4 1500
+LEI4 $3321
+ADDRLP4 316
+CNSTU1 96
+ASGNU1
+ADDRLP4 316+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 316+2
+CNSTU1 96
+ASGNU1
+ADDRLP4 316+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 304
+ADDRGP4 cg+1332124
+INDIRB
+ASGNB 12
+ADDRLP4 304+8
+ADDRLP4 304+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRGP4 cg+609780
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRLP4 388
+ARGP4
+ADDRLP4 412
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 424
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 304
+ADDRLP4 304
+INDIRF4
+ADDRLP4 424
+INDIRF4
+ADDRLP4 320
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 304+4
+ADDRLP4 304+4
+INDIRF4
+ADDRLP4 424
+INDIRF4
+ADDRLP4 320+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 304+8
+ADDRLP4 304+8
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 320+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 428
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 400
+ADDRLP4 304
+INDIRF4
+ADDRLP4 428
+INDIRF4
+ADDRLP4 320
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 400+4
+ADDRLP4 304+4
+INDIRF4
+ADDRLP4 428
+INDIRF4
+ADDRLP4 320+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 400+8
+ADDRLP4 304+8
+INDIRF4
+CNSTF4 1207959552
+ADDRLP4 320+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 332
+ARGP4
+ADDRLP4 304
+ARGP4
+ADDRLP4 432
+CNSTP4 0
+ASGNP4
+ADDRLP4 432
+INDIRP4
+ARGP4
+ADDRLP4 432
+INDIRP4
+ARGP4
+ADDRLP4 400
+ARGP4
+CNSTI4 63
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 Wolfcam_WeaponTrace
+CALLV
+pop
+ADDRLP4 436
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 304
+ADDRLP4 304
+INDIRF4
+ADDRLP4 436
+INDIRF4
+ADDRLP4 388
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 304+4
+ADDRLP4 304+4
+INDIRF4
+ADDRLP4 436
+INDIRF4
+ADDRLP4 388+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 304+8
+ADDRLP4 304+8
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 388+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 304
+ARGP4
+ADDRLP4 332+12
+ARGP4
+ADDRGP4 cg_railTrailTime+8
+INDIRF4
+ARGF4
+ADDRLP4 316
+ARGP4
+ADDRGP4 CG_SimpleRailTrail
+CALLV
+pop
+ADDRGP4 cg+609412+24
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 cg_weapons+924+52
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRLP4 332+52
+INDIRI4
+CNSTI4 64
+GEI4 $3354
+ADDRLP4 332+52
+INDIRI4
+CNSTI4 0
+LTI4 $3354
+CNSTI4 1496
+ADDRLP4 332+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_GibPlayer
+CALLV
+pop
+LABELV $3354
+LABELV $3355
+ADDRLP4 440
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492264
+INDIRI4
+ARGI4
+ADDRLP4 332+12
+ARGP4
+ADDRLP4 332+24
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 440
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 316
+INDIRU1
+CVUI4 1
+CVIF4 4
+ARGF4
+ADDRLP4 316+1
+INDIRU1
+CVUI4 1
+CVIF4 4
+ARGF4
+ADDRLP4 316+2
+INDIRU1
+CVUI4 1
+CVIF4 4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 444
+CNSTI4 1
+ASGNI4
+ADDRLP4 444
+INDIRI4
+ARGI4
+CNSTF4 1090519040
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 444
+INDIRI4
+ARGI4
+ADDRLP4 444
+INDIRI4
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+ADDRGP4 cg+1332736
+ADDRLP4 256
+INDIRI4
+ASGNI4
+LABELV $3321
+LABELV $3317
+ADDRGP4 cg+1334996
+INDIRI4
+CNSTI4 -1
+LEI4 $3366
+ADDRLP4 304
+CNSTI4 1496
+ADDRGP4 cg+1334996
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 308
+ADDRLP4 304
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609412+24
+ADDRLP4 308
+INDIRB
+ASGNB 12
+ADDRLP4 320
+ADDRGP4 cg+609412+24
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ADDRLP4 320
+INDIRP4
+INDIRF4
+ADDRGP4 cg+1335024
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 324
+ADDRGP4 cg+609412+24+4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+ADDRLP4 324
+INDIRP4
+INDIRF4
+ADDRGP4 cg+1335028
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 328
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 328
+INDIRP4
+ADDRLP4 328
+INDIRP4
+INDIRF4
+ADDRGP4 cg+1335032
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3366
+CNSTI4 1023
+ARGI4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+ADDRGP4 cg+1332220
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332160
+CNSTI4 1
+ASGNI4
+LABELV $3004
+endproc CG_FreeCam 448 52
+proc CG_CheckSkillRating 0 12
+ADDRGP4 cgs+1957580
+INDIRI4
+CNSTI4 0
+EQI4 $3394
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+EQI4 $3390
+LABELV $3394
+ADDRGP4 $3389
+JUMPV
+LABELV $3390
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $3395
+ADDRGP4 $3389
+JUMPV
+LABELV $3395
+CNSTI4 4524
+ADDRGP4 cgs+1957504
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3398
+ADDRGP4 cgs+1957572
+INDIRP4
+CNSTI4 2148
+ADDP4
+ADDRGP4 cgs+1957576
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+1957572
+INDIRP4
+CNSTI4 2144
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3405
+ARGP4
+ADDRGP4 cgs+1957508
+ARGP4
+ADDRGP4 cgs+1957576
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cg_printSkillRating+12
+INDIRI4
+CNSTI4 0
+EQI4 $3399
+ADDRGP4 $3405
+ARGP4
+ADDRGP4 cgs+1957508
+ARGP4
+ADDRGP4 cgs+1957576
+INDIRI4
+ARGI4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+ADDRGP4 $3399
+JUMPV
+LABELV $3398
+CNSTI4 4524
+ADDRGP4 cgs+1957504
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2148
+ADDP4
+ADDRGP4 cgs+1957576
+INDIRI4
+ASGNI4
+CNSTI4 4524
+ADDRGP4 cgs+1957504
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+2144
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+ADDRGP4 $3420
+ARGP4
+ADDRGP4 cgs+1957508
+ARGP4
+ADDRGP4 cgs+1957576
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cg_printSkillRating+12
+INDIRI4
+CNSTI4 0
+EQI4 $3423
+ADDRGP4 $3420
+ARGP4
+ADDRGP4 cgs+1957508
+ARGP4
+ADDRGP4 cgs+1957576
+INDIRI4
+ARGI4
+ADDRGP4 CG_PrintToScreen
+CALLV
+pop
+LABELV $3423
+LABELV $3399
+ADDRGP4 cgs+1957580
+CNSTI4 0
+ASGNI4
+LABELV $3389
+endproc CG_CheckSkillRating 0 12
+proc CG_DrawRawCameraPathKeyPoints 24 20
+ADDRLP4 4
+CNSTU1 255
+ASGNU1
+ADDRLP4 4+1
+CNSTU1 40
+ASGNU1
+ADDRLP4 4+2
+CNSTU1 40
+ASGNU1
+ADDRLP4 4+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+CNSTU1 255
+ASGNU1
+ADDRLP4 8+1
+CNSTU1 127
+ASGNU1
+ADDRLP4 8+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 8+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3439
+JUMPV
+LABELV $3436
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $3446
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+2121552
+INDIRI4
+CNSTI4 1
+SUBI4
+EQI4 $3446
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+2121552
+INDIRI4
+CNSTI4 5
+DIVI4
+MODI4
+ADDRLP4 16
+INDIRI4
+NEI4 $3441
+LABELV $3446
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+1335120
+ADDP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_FloatNumber
+CALLV
+pop
+LABELV $3441
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $3448
+ADDRLP4 20
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+1335120-24
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+1335120
+ADDP4
+ARGP4
+ADDRGP4 cg_railTrailTime+8
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_SimpleRailTrail
+CALLV
+pop
+LABELV $3448
+LABELV $3437
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3439
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+2121552
+INDIRI4
+LTI4 $3436
+LABELV $3429
+endproc CG_DrawRawCameraPathKeyPoints 24 20
+proc CG_Q3mmeDrawCross 136 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 demoDrawSetupVerts
+CALLV
+pop
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRGP4 $3458
+JUMPV
+LABELV $3455
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 128
+ADDRLP4 0
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 0
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRLP4 16
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1058642330
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 demoDrawRawLine
+CALLV
+pop
+LABELV $3456
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+LABELV $3458
+ADDRLP4 0
+INDIRU4
+CNSTU4 3
+LTU4 $3455
+LABELV $3454
+endproc CG_Q3mmeDrawCross 136 16
+proc CG_DrawSplinePoints 48 20
+ADDRGP4 cg_drawCameraPath+12
+INDIRI4
+CNSTI4 0
+NEI4 $3460
+ADDRLP4 20
+ADDRGP4 SplineNumPoints
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196764
+ARGP4
+ADDRGP4 cg+2121556
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 cg+2869080
+ARGP4
+ADDRGP4 SplineColor
+ARGP4
+ADDRGP4 trap_SetPathLines
+CALLV
+pop
+ADDRGP4 $3459
+JUMPV
+LABELV $3460
+ADDRGP4 cg+3196768
+INDIRI4
+CNSTI4 0
+LEI4 $3466
+ADDRLP4 8
+CNSTU1 255
+ASGNU1
+ADDRLP4 8+1
+CNSTU1 165
+ASGNU1
+ADDRLP4 8+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 8+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 20
+ADDRGP4 demo+4+64
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3475
+JUMPV
+LABELV $3474
+ADDRLP4 40
+ADDRLP4 20
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 CG_Q3mmeDrawCross
+CALLV
+pop
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 colorRed
+ARGP4
+ADDRGP4 CG_Q3mmeCameraDrawPath
+CALLV
+pop
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_FloatNumber
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3475
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3474
+LABELV $3466
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 2
+GEI4 $3478
+ADDRLP4 20
+ADDRGP4 SplineNumPoints
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196764
+ARGP4
+ADDRGP4 cg+2121556
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 cg+2869080
+ARGP4
+ADDRGP4 SplineColor
+ARGP4
+ADDRGP4 trap_SetPathLines
+CALLV
+pop
+ADDRGP4 $3484
+JUMPV
+LABELV $3478
+ADDRGP4 SplineColor
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 SplineColor+4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 SplineColor+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 SplineColor+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRGP4 SplineNumPoints
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRGP4 cg+3196760
+INDIRI4
+ADDRGP4 cg+2121556+1236
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $3491
+ADDRGP4 SplineNumPoints
+CNSTI4 0
+ASGNI4
+LABELV $3491
+ADDRGP4 cg+3196764
+ARGP4
+ADDRGP4 cg+2121556
+ARGP4
+ADDRGP4 cg+3196760
+ARGP4
+ADDRGP4 cg+2869080
+ARGP4
+ADDRGP4 SplineColor
+ARGP4
+ADDRGP4 trap_SetPathLines
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 255
+ASGNU1
+ADDRLP4 8+1
+CNSTU1 40
+ASGNU1
+ADDRLP4 8+2
+CNSTU1 40
+ASGNU1
+ADDRLP4 8+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12
+CNSTU1 0
+ASGNU1
+ADDRLP4 12+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+2
+CNSTU1 40
+ASGNU1
+ADDRLP4 12+3
+CNSTU1 255
+ASGNU1
+LABELV $3484
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 8+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 8+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 12+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 24
+CNSTU1 255
+ASGNU1
+ADDRLP4 16
+ADDRLP4 24
+INDIRU1
+ASGNU1
+ADDRLP4 16+1
+ADDRLP4 24
+INDIRU1
+ASGNU1
+ADDRLP4 16+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 16+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3515
+JUMPV
+LABELV $3512
+ADDRLP4 4
+CNSTI4 1460
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556
+ADDP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+3196764
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $3518
+ADDRLP4 4
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $3518
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+2869080
+ADDP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_FloatNumber
+CALLV
+pop
+LABELV $3518
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+3196772
+INDIRI4
+LTI4 $3522
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+3196776
+INDIRI4
+GTI4 $3522
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_FloatNumber
+CALLV
+pop
+ADDRGP4 $3523
+JUMPV
+LABELV $3522
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_FloatNumber
+CALLV
+pop
+LABELV $3523
+LABELV $3513
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3515
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+LTI4 $3512
+LABELV $3459
+endproc CG_DrawSplinePoints 48 20
+proc CG_DrawViewPointMark 16 20
+ADDRGP4 cg_drawViewPointMark+12
+INDIRI4
+CNSTI4 0
+NEI4 $3527
+ADDRGP4 $3526
+JUMPV
+LABELV $3527
+ADDRGP4 cg+1335060
+INDIRI4
+CNSTI4 0
+NEI4 $3530
+ADDRGP4 $3526
+JUMPV
+LABELV $3530
+ADDRLP4 4
+ADDRGP4 cgs+632912+12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ADDRLP4 8
+INDIRU1
+ASGNU1
+ADDRLP4 0+1
+ADDRLP4 8
+INDIRU1
+ASGNU1
+ADDRLP4 0+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cg+1335048
+ARGP4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_FloatSprite
+CALLV
+pop
+ADDRGP4 cg+3196772
+INDIRI4
+ADDRGP4 cg+3196776
+INDIRI4
+NEI4 $3539
+CNSTI4 1460
+ADDRGP4 cg+3196772
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+32
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3543
+ADDRLP4 0
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1460
+ADDRGP4 cg+3196772
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+52
+ADDP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_FloatSprite
+CALLV
+pop
+LABELV $3543
+ADDRGP4 cg+3196772
+INDIRI4
+ADDRGP4 cg+3196764
+INDIRI4
+CNSTI4 1
+ADDI4
+GEI4 $3554
+CNSTI4 1460
+ADDRGP4 cg+3196772
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1460+32
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3558
+ADDRLP4 0
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1460
+ADDRGP4 cg+3196772
+INDIRI4
+MULI4
+ADDRGP4 cg+2121556+1460+52
+ADDP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_FloatSprite
+CALLV
+pop
+LABELV $3558
+LABELV $3554
+LABELV $3539
+LABELV $3526
+endproc CG_DrawViewPointMark 16 20
+proc CG_VibrateCamera 40 8
+ADDRGP4 cg_vibrate+12
+INDIRI4
+CNSTI4 0
+NEI4 $3572
+ADDRGP4 cg+3196884
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+3196888
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+3196892
+CNSTF4 0
+ASGNF4
+ADDRGP4 $3571
+JUMPV
+LABELV $3572
+ADDRLP4 8
+ADDRGP4 cg_vibrateTime+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+3196884
+INDIRF4
+SUBF4
+ADDRLP4 8
+INDIRF4
+LEF4 $3579
+ADDRGP4 cg+3196888
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+3196892
+CNSTF4 0
+ASGNF4
+ADDRGP4 $3571
+JUMPV
+LABELV $3579
+ADDRLP4 0
+CNSTF4 1065353216
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+3196884
+INDIRF4
+SUBF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+SUBF4
+ASGNF4
+CNSTF4 1102048735
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRGP4 cg+3196892
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1048576000
+ADDRGP4 cg_vibrateForce+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 cg+3196888
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+3196884
+INDIRF4
+SUBF4
+CNSTF4 1112014848
+GEF4 $3593
+ADDRLP4 36
+ADDRGP4 cg+609780+8
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1084227584
+ADDRGP4 cg+3196888
+INDIRF4
+MULF4
+CNSTF4 1120403456
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $3593
+LABELV $3571
+endproc CG_VibrateCamera 40 8
+proc CG_DrawFloatNumbers 20 20
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3607
+JUMPV
+LABELV $3604
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+6706384
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+LTI4 $3610
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTF4 1036831949
+ARGF4
+ADDRGP4 CG_FloatNumber
+CALLV
+pop
+ADDRGP4 $3611
+JUMPV
+LABELV $3610
+ADDRGP4 cg+6739152
+INDIRI4
+CNSTI4 1
+LEI4 $3613
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3619
+JUMPV
+LABELV $3616
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+6706384-32
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+6706384
+ADDP4
+INDIRB
+ASGNB 32
+LABELV $3617
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3619
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+6739152
+INDIRI4
+LTI4 $3616
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $3613
+ADDRLP4 16
+ADDRGP4 cg+6739152
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $3611
+LABELV $3605
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3607
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+6739152
+INDIRI4
+LTI4 $3604
+LABELV $3603
+endproc CG_DrawFloatNumbers 20 20
+proc CG_DrawPoiPics 240 12
+ADDRLP4 184
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+ADDRLP4 184
+INDIRI4
+NEI4 $3630
+ADDRGP4 cg_helpIcon+12
+INDIRI4
+ADDRLP4 184
+INDIRI4
+NEI4 $3626
+LABELV $3630
+ADDRGP4 $3625
+JUMPV
+LABELV $3626
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3631
+ADDRLP4 180
+CNSTI4 4524
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3632
+JUMPV
+LABELV $3631
+ADDRLP4 180
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3632
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3640
+JUMPV
+LABELV $3637
+ADDRLP4 188
+CNSTI4 28
+ADDRLP4 176
+INDIRI4
+MULI4
+ADDRGP4 cg+6743256
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 188
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+ADDRLP4 188
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+LTI4 $3643
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 196
+INDIRI4
+LTI4 $3643
+ADDRLP4 188
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $3644
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 0
+EQI4 $3644
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4+68
+ADDRLP4 188
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4+68+8
+ADDRLP4 4+68+8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 5
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3653
+ADDRGP4 cgs+1960920
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $3653
+ADDRLP4 4+112
+ADDRGP4 cgs+632912+460
+INDIRI4
+ASGNI4
+ADDRGP4 $3654
+JUMPV
+LABELV $3653
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $3660
+ADDRLP4 4+112
+ADDRGP4 cgs+632912+1317368
+INDIRI4
+ASGNI4
+ADDRGP4 $3661
+JUMPV
+LABELV $3660
+ADDRLP4 4+112
+ADDRGP4 cgs+632912+1317368
+INDIRI4
+ASGNI4
+LABELV $3661
+LABELV $3654
+ADDRLP4 4+132
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $3670
+ADDRLP4 4+132
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $3671
+JUMPV
+LABELV $3670
+ADDRGP4 cg_helpIconStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $3674
+ADDRLP4 4+4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $3675
+JUMPV
+LABELV $3674
+ADDRLP4 4+4
+CNSTI4 8
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3679
+ADDRLP4 212
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $3680
+JUMPV
+LABELV $3679
+ADDRLP4 212
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+LABELV $3680
+ADDRLP4 200
+ADDRGP4 cg_helpIconMinWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 208
+ADDRGP4 cg_helpIconMaxWidth+8
+INDIRF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 224
+ADDRLP4 228
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1128792064
+ADDRLP4 228
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 1036831949
+LEF4 $3687
+ADDRLP4 204
+ADDRLP4 204
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 200
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $3687
+ADDRLP4 4+132
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRLP4 4+68
+ARGP4
+ADDRLP4 212
+ARGP4
+ADDRLP4 232
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 204
+INDIRF4
+LEF4 $3690
+ADDRLP4 200
+INDIRF4
+CNSTF4 1036831949
+LEF4 $3690
+ADDRLP4 4+68
+ARGP4
+ADDRLP4 212
+ARGP4
+ADDRLP4 236
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 4+132
+ADDRLP4 224
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 204
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $3690
+LABELV $3675
+LABELV $3671
+ADDRLP4 4+68+8
+ADDRLP4 4+68+8
+INDIRF4
+ADDRLP4 4+132
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $3698
+ADDRGP4 cgs+1960920
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $3698
+ADDRLP4 4+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 4+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 4+116+2
+CNSTU1 255
+ASGNU1
+ADDRGP4 $3699
+JUMPV
+LABELV $3698
+ADDRLP4 4+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 4+116+1
+CNSTU1 255
+ASGNU1
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 6
+NEI4 $3710
+ADDRLP4 4+116+2
+CNSTU1 255
+ASGNU1
+ADDRGP4 $3711
+JUMPV
+LABELV $3710
+ADDRLP4 4+116+2
+CNSTU1 255
+ASGNU1
+LABELV $3711
+LABELV $3699
+ADDRLP4 188
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CNSTI4 1000
+GTI4 $3717
+ADDRLP4 212
+CNSTF4 1132396544
+ADDRLP4 188
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ADDRGP4 cg+607148
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 216
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+LTF4 $3724
+ADDRLP4 204
+ADDRLP4 212
+INDIRF4
+ADDRLP4 216
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $3725
+JUMPV
+LABELV $3724
+ADDRLP4 204
+ADDRLP4 212
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $3725
+ADDRLP4 4+116+3
+ADDRLP4 204
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $3718
+JUMPV
+LABELV $3717
+ADDRLP4 4+116+3
+CNSTU1 255
+ASGNU1
+LABELV $3718
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 $3644
+JUMPV
+LABELV $3643
+ADDRGP4 cg+6746840
+INDIRI4
+CNSTI4 1
+LEI4 $3728
+ADDRLP4 0
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3734
+JUMPV
+LABELV $3731
+ADDRLP4 200
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+ADDRGP4 cg+6743256-28
+ADDP4
+ADDRLP4 200
+INDIRI4
+ADDRGP4 cg+6743256
+ADDP4
+INDIRB
+ASGNB 28
+LABELV $3732
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3734
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+6746840
+INDIRI4
+LTI4 $3731
+ADDRLP4 176
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $3728
+ADDRLP4 200
+ADDRGP4 cg+6746840
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $3644
+LABELV $3638
+ADDRLP4 176
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3640
+ADDRLP4 176
+INDIRI4
+ADDRGP4 cg+6746840
+INDIRI4
+LTI4 $3637
+LABELV $3625
+endproc CG_DrawPoiPics 240 12
+proc CG_CheckRepeatKeys 2092 16
+ADDRLP4 2068
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 2060
+ADDRLP4 2068
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3741
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1952480
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3745
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ARGP4
+ADDRGP4 trap_Key_GetBinding
+CALLV
+pop
+ADDRGP4 $3748
+ARGP4
+ADDRLP4 2072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 2072
+INDIRU4
+ADDRLP4 1032
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 2064
+ARGP4
+ADDRLP4 2076
+ADDRGP4 CG_GetToken
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 2076
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 2080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2056
+ADDRLP4 2080
+INDIRI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1951456
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 2056
+INDIRI4
+LTI4 $3749
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 2064
+ARGP4
+ADDRLP4 2084
+ADDRGP4 CG_GetToken
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 2084
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3752
+ADDRGP4 $3754
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 2088
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2088
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $3752
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+1951456
+ADDP4
+ADDRLP4 2060
+INDIRI4
+ASGNI4
+LABELV $3749
+LABELV $3750
+LABELV $3745
+LABELV $3742
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $3741
+LABELV $3740
+endproc CG_CheckRepeatKeys 2092 16
+proc CG_CheckCvarInterp 28 8
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $3757
+ADDRLP4 0
+CNSTI4 1048
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+5417864
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $3762
+ADDRGP4 $3758
+JUMPV
+LABELV $3762
+ADDRGP4 $3766
+ARGP4
+ADDRLP4 12
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $3764
+ADDRGP4 cg+5649548
+INDIRI4
+CNSTI4 0
+NEI4 $3764
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_autoWriteConfig
+CALLV
+pop
+ADDRGP4 cg+5649548
+CNSTI4 1
+ASGNI4
+LABELV $3764
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3769
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GEF4 $3771
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3758
+JUMPV
+LABELV $3771
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+LTF4 $3774
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3777
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $3758
+JUMPV
+LABELV $3774
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRGP4 $3770
+JUMPV
+LABELV $3769
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GEF4 $3779
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3758
+JUMPV
+LABELV $3779
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+LTF4 $3782
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3777
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $3758
+JUMPV
+LABELV $3782
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+LABELV $3770
+ADDRGP4 $3777
+ARGP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $3758
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $3757
+LABELV $3756
+endproc CG_CheckCvarInterp 28 8
+proc CG_CheckAtCommands 24 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $3787
+ADDRLP4 0
+CNSTI4 1036
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+5451400
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $3792
+ADDRGP4 $3789
+JUMPV
+LABELV $3792
+ADDRGP4 cg_enableAtCommands+12
+INDIRI4
+CNSTI4 0
+EQI4 $3794
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LTF4 $3797
+ADDRLP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+GEF4 $3797
+ADDRGP4 $1934
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $3797
+LABELV $3794
+ADDRLP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $3788
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+LTI4 $3787
+LABELV $3789
+LABELV $3786
+endproc CG_CheckAtCommands 24 8
+data
+align 4
+LABELV $3802
+byte 4 0
+align 4
+LABELV $3803
+byte 4 0
+code
+proc CG_CheckCvarChange 8 4
+ADDRGP4 $3802
+INDIRF4
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+EQF4 $3804
+ADDRGP4 cg+609796
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+609800
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+609804
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+609808
+CNSTF4 0
+ASGNF4
+ADDRGP4 $3802
+ADDRGP4 cg_zoomTime+8
+INDIRF4
+ASGNF4
+LABELV $3804
+ADDRGP4 $3812
+ARGP4
+ADDRLP4 4
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+6706348
+INDIRI4
+EQI4 $3813
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Q_SetColors
+CALLV
+pop
+ADDRGP4 cg+6706348
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $3813
+ADDRGP4 $3803
+INDIRF4
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+EQF4 $3817
+ADDRGP4 CG_Q3mmeCameraResetInternalLengths
+CALLV
+pop
+ADDRGP4 CG_CameraResetInternalLengths
+CALLV
+pop
+ADDRGP4 $3803
+ADDRGP4 cg_q3mmeCameraSmoothPos+8
+INDIRF4
+ASGNF4
+LABELV $3817
+LABELV $3801
+endproc CG_CheckCvarChange 8 4
+proc CG_DumpEntity 40 60
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $3822
+ARGP4
+ADDRGP4 cg_dumpEntsUseServerTime+12
+INDIRI4
+CNSTI4 0
+EQI4 $3827
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $3828
+JUMPV
+LABELV $3827
+ADDRLP4 8
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+LABELV $3828
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+BXORI4
+ADDRLP4 16
+INDIRI4
+BANDI4
+ARGI4
+ADDRLP4 28
+CNSTI4 -129
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 cg+6706344
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $3821
+endproc CG_DumpEntity 40 60
+proc CG_DumpEntities 1508 12
+ADDRGP4 cg+6702236
+INDIRI4
+CNSTI4 0
+NEI4 $3831
+ADDRGP4 $3830
+JUMPV
+LABELV $3831
+ADDRGP4 cg+8
+INDIRI4
+CNSTI4 0
+EQI4 $3834
+ADDRGP4 $3830
+JUMPV
+LABELV $3834
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3837
+ADDRGP4 $3830
+JUMPV
+LABELV $3837
+ADDRGP4 cg_dumpEntsUseServerTime+12
+INDIRI4
+CNSTI4 0
+EQI4 $3840
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 cg+6706340
+INDIRI4
+NEI4 $3840
+ADDRGP4 $3830
+JUMPV
+LABELV $3840
+ADDRGP4 cg+6702240
+INDIRI4
+CNSTI4 0
+EQI4 $3845
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1496
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 8+1188
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 8+1200
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8+8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8+236+8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8+204
+CNSTI4 0
+ASGNI4
+ADDRLP4 8+208
+CNSTI4 0
+ASGNI4
+ADDRLP4 8+4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8+200
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_DumpEntity
+CALLV
+pop
+LABELV $3845
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3860
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3864
+ADDRLP4 4
+ADDRGP4 cg+607704
+ASGNP4
+ADDRGP4 $3865
+JUMPV
+LABELV $3864
+ADDRLP4 4
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+LABELV $3865
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+6702244
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3868
+ADDRGP4 $3861
+JUMPV
+LABELV $3868
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3871
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+607704
+CVPU4 4
+EQU4 $3871
+ADDRGP4 $3861
+JUMPV
+LABELV $3871
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_DumpEntity
+CALLV
+pop
+LABELV $3861
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $3860
+ADDRGP4 cg+6706340
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3830
+endproc CG_DumpEntities 1508 12
+proc CG_CheckPlayerKeyPress 128 16
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $3877
+CNSTI4 1
+ARGI4
+CNSTI4 50
+ARGI4
+ADDRGP4 $1167
+ARGP4
+ADDRLP4 96
+ADDRGP4 CG_CheckCpmaVersion
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $3877
+ADDRLP4 108
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $3884
+ADDRLP4 108
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $3880
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3880
+LABELV $3884
+ADDRLP4 100
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3881
+JUMPV
+LABELV $3880
+ADDRLP4 116
+CNSTI4 1496
+ASGNI4
+ADDRLP4 100
+ADDRLP4 116
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 116
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3881
+ADDRGP4 cg+6770160
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRGP4 cg+6770164
+ADDRLP4 100
+INDIRI4
+CNSTI4 2
+BANDI4
+ASGNI4
+ADDRGP4 cg+6770172
+ADDRLP4 100
+INDIRI4
+CNSTI4 4
+BANDI4
+ASGNI4
+ADDRGP4 cg+6770168
+ADDRLP4 100
+INDIRI4
+CNSTI4 8
+BANDI4
+ASGNI4
+ADDRGP4 cg+6770184
+ADDRLP4 100
+INDIRI4
+CNSTI4 16
+BANDI4
+ASGNI4
+ADDRGP4 cg+6770180
+ADDRLP4 100
+INDIRI4
+CNSTI4 32
+BANDI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $3897
+ADDRGP4 cg+6770176
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3876
+JUMPV
+LABELV $3897
+ADDRGP4 cg+6770176
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3876
+JUMPV
+LABELV $3877
+ADDRGP4 cg+6770180
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6770176
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6770184
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3904
+ADDRLP4 100
+CNSTI4 1496
+ASGNI4
+ADDRLP4 16
+ADDRLP4 100
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+204
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $3908
+ADDRGP4 cg+6770176
+CNSTI4 1
+ASGNI4
+LABELV $3908
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $3915
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $3913
+LABELV $3915
+ADDRGP4 cg+6770180
+CNSTI4 1
+ASGNI4
+LABELV $3913
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 2392
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 wclients+2388
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 150
+GTI4 $3905
+ADDRGP4 cg+6770184
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3905
+JUMPV
+LABELV $3904
+ADDRLP4 16
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $3924
+ADDRGP4 cg+6770176
+CNSTI4 1
+ASGNI4
+LABELV $3924
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3928
+ADDRGP4 cg+6770180
+CNSTI4 1
+ASGNI4
+LABELV $3928
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3932
+ADDRGP4 cg+6770184
+CNSTI4 1
+ASGNI4
+LABELV $3932
+LABELV $3905
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3936
+ADDRLP4 12
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+136+4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $3937
+JUMPV
+LABELV $3936
+ADDRLP4 12
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3937
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $3943
+ADDRLP4 12
+INDIRI4
+CNSTI4 7
+GTI4 $3943
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3952
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3952
+address $3944
+address $3945
+address $3946
+address $3947
+address $3948
+address $3949
+address $3950
+address $3951
+code
+LABELV $3944
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3943
+JUMPV
+LABELV $3945
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 $3943
+JUMPV
+LABELV $3946
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3943
+JUMPV
+LABELV $3947
+ADDRLP4 112
+CNSTI4 1
+ASGNI4
+ADDRLP4 52
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRGP4 $3943
+JUMPV
+LABELV $3948
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3943
+JUMPV
+LABELV $3949
+ADDRLP4 116
+CNSTI4 1
+ASGNI4
+ADDRLP4 52
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRGP4 $3943
+JUMPV
+LABELV $3950
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3943
+JUMPV
+LABELV $3951
+ADDRLP4 120
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 120
+INDIRI4
+ASGNI4
+LABELV $3943
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $3955
+ADDRLP4 12
+INDIRI4
+CNSTI4 7
+NEI4 $3953
+LABELV $3955
+LABELV $3953
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6770160
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg+6770164
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 cg+6770172
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 cg+6770168
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3960
+ADDRLP4 32
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+12+24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $3961
+JUMPV
+LABELV $3960
+ADDRLP4 32
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $3961
+ADDRLP4 16
+INDIRI4
+CNSTI4 22
+EQI4 $3968
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $3966
+LABELV $3968
+ADDRGP4 cg+6770160
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6770164
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6770172
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+6770168
+CNSTI4 0
+ASGNI4
+LABELV $3966
+LABELV $3967
+ADDRLP4 32
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3973
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+52+12
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 $3974
+JUMPV
+LABELV $3973
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $3974
+ADDRLP4 116
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 20
+ADDRLP4 116
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 3212836864
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+ADDRGP4 AngleBetweenVectors
+CALLF4
+ASGNF4
+CNSTF4 1127481344
+ADDRLP4 120
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+CNSTF4 1110704128
+GEF4 $3983
+ADDRGP4 cg+6770160
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3984
+JUMPV
+LABELV $3983
+ADDRLP4 32
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 124
+ADDRGP4 AngleBetweenVectors
+CALLF4
+ASGNF4
+CNSTF4 1127481344
+ADDRLP4 124
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+CNSTF4 1110704128
+GEF4 $3986
+LABELV $3986
+LABELV $3984
+LABELV $3876
+endproc CG_CheckPlayerKeyPress 128 16
+data
+align 4
+LABELV $4107
+byte 4 -1
+align 4
+LABELV $4169
+byte 4 -1
+align 4
+LABELV $4184
+byte 4 0
+align 4
+LABELV $4185
+byte 4 0
+align 4
+LABELV $4186
+byte 4 -1
+align 4
+LABELV $4258
+byte 4 0
+align 4
+LABELV $4259
+byte 4 0
+byte 4 0
+byte 4 0
+lit
+align 4
+LABELV $4286
+address cg_weaponNone
+address cg_weaponGauntlet
+address cg_weaponMachineGun
+address cg_weaponShotgun
+address cg_weaponGrenadeLauncher
+address cg_weaponRocketLauncher
+address cg_weaponLightningGun
+address cg_weaponRailGun
+address cg_weaponPlasmaGun
+address cg_weaponBFG
+address cg_weaponGrapplingHook
+address cg_weaponNailGun
+address cg_weaponProximityLauncher
+address cg_weaponChainGun
+address cg_weaponHeavyMachineGun
+data
+align 4
+LABELV $4480
+byte 4 0
+export CG_DrawActiveFrame
+code
+proc CG_DrawActiveFrame 136 36
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3991
+ARGP4
+ADDRLP4 12
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $3989
+ADDRGP4 $3992
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3989
+ADDRGP4 CG_ResetFrameArena
+CALLV
+pop
+ADDRGP4 FxLoopSounds
+CNSTI4 1025
+ASGNI4
+ADDRGP4 CG_ClearLocalFrameEntities
+CALLV
+pop
+ADDRGP4 CG_CleanUpFieldNumber
+CALLV
+pop
+ADDRGP4 cgs+20100
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRGP4 cgs+39664
+ADDRGP4 cgs+20100+19496
+INDIRI4
+CVIF4 4
+CNSTF4 1142947840
+DIVF4
+ASGNF4
+ADDRGP4 cgs+39668
+ADDRGP4 cgs+20100+19500
+INDIRI4
+CVIF4 4
+CNSTF4 1139802112
+DIVF4
+ASGNF4
+ADDRGP4 cgDC+5634196
+ARGP4
+ADDRGP4 cgs+20100
+ARGP4
+CNSTU4 19564
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cgDC+5653776
+ADDRGP4 cg_wideScreen+12
+INDIRI4
+ASGNI4
+ADDRGP4 $3016
+ARGP4
+ADDRLP4 16
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRGP4 cg+8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cg+8
+INDIRI4
+CNSTI4 0
+NEI4 $4005
+ADDRGP4 cg+3196800
+CNSTI4 0
+ASGNI4
+LABELV $4005
+ADDRGP4 cg+3196908
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3196912
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cg+3196916
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+CNSTF4 1232348160
+DIVF4
+ASGNF4
+ADDRGP4 cg+3196924
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRGP4 cg+607168
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgDC+212
+ADDRGP4 cg+607168
+INDIRI4
+ASGNI4
+ADDRGP4 cg+607148
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+607152
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+3196916
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cgDC+216
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+3196820
+INDIRF4
+EQF4 $4022
+LABELV $4022
+ADDRGP4 cg+12
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+5649548
+INDIRI4
+CNSTI4 0
+EQI4 $4027
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_autoWriteConfig
+CALLV
+pop
+ADDRGP4 cg+5649548
+CNSTI4 0
+ASGNI4
+LABELV $4027
+ADDRGP4 CG_CheckCvarChange
+CALLV
+pop
+ADDRGP4 CG_CheckRepeatKeys
+CALLV
+pop
+ADDRGP4 CG_CheckCvarInterp
+CALLV
+pop
+ADDRGP4 CG_CheckAtCommands
+CALLV
+pop
+ADDRGP4 cg+1335072
+INDIRI4
+CNSTI4 0
+EQI4 $4031
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+1335068
+INDIRI4
+LTI4 $4031
+ADDRGP4 $2023
+ARGP4
+ADDRGP4 cg+1335064
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $3988
+JUMPV
+LABELV $4031
+ADDRGP4 cg+1335076
+INDIRI4
+CNSTI4 0
+EQI4 $4036
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+24
+INDIRI4
+CNSTI4 0
+LTI4 $4048
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 wcg+24
+INDIRI4
+ADDRGP4 cg+1335084
+INDIRI4
+ADDI4
+GTI4 $4047
+LABELV $4048
+ADDRGP4 wcg+28
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $4039
+LABELV $4047
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 wcg+24
+INDIRI4
+CNSTI4 200
+ADDI4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 trap_GetNextVictim
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRGP4 wcg+24
+INDIRI4
+CNSTI4 200
+ADDI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 60
+ADDRGP4 trap_GetNextVictim
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $4055
+ADDRLP4 52
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $4053
+LABELV $4055
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $4056
+ADDRLP4 68
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $4060
+ADDRLP4 32
+INDIRI4
+ADDRLP4 68
+INDIRI4
+GEI4 $4058
+LABELV $4060
+ADDRLP4 24
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $4058
+LABELV $4056
+ADDRLP4 68
+ADDRGP4 wcg+24
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+28
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $4062
+ADDRGP4 wcg+24
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+28
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+LABELV $4062
+ADDRLP4 72
+ADDRGP4 cg+1335088
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4071
+ARGP4
+ADDRGP4 cg+1335088
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $4073
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+1335080
+INDIRI4
+SUBI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+GEI4 $4075
+ADDRGP4 wcg+20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+24
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $4081
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4082
+JUMPV
+LABELV $4075
+LABELV $4073
+ADDRGP4 wcg+20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+24
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $4085
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $2023
+ARGP4
+ADDRGP4 wcg+24
+INDIRI4
+ADDRGP4 cg+1335080
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $4054
+JUMPV
+LABELV $4053
+ADDRGP4 cg+1335076
+CNSTI4 0
+ASGNI4
+ADDRGP4 wcg+20
+CNSTI4 -1
+ASGNI4
+ADDRGP4 wcg+24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4091
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $4054
+LABELV $4039
+LABELV $4036
+LABELV $4082
+ADDRGP4 CG_UpdateCvars
+CALLV
+pop
+ADDRGP4 $4092
+ARGP4
+ADDRLP4 24
+ADDRGP4 SC_Cvar_Get_String
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 cg+3196860
+ARGP4
+ADDRGP4 CG_Q3ColorFromString
+CALLV
+pop
+ADDRGP4 $4094
+ARGP4
+ADDRLP4 28
+ADDRGP4 SC_Cvar_Get_String
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 cg+3196872
+ARGP4
+ADDRGP4 CG_Q3ColorFromString
+CALLV
+pop
+ADDRGP4 CG_CheckFontUpdates
+CALLV
+pop
+ADDRGP4 cg+609816
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4096
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 cg+1335116
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3988
+JUMPV
+LABELV $4096
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $4100
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 cg+711640
+CNSTI4 0
+ASGNI4
+ADDRGP4 CG_ClearSceneBatch
+CALLV
+pop
+ADDRGP4 CG_DrawDecals
+CALLV
+pop
+LABELV $4100
+ADDRGP4 $4103
+ARGP4
+ADDRGP4 trap_ProfileBegin
+CALLV
+pop
+ADDRGP4 CG_ProcessSnapshots
+CALLV
+pop
+ADDRGP4 trap_ProfileEnd
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4105
+ADDRLP4 32
+ADDRGP4 wolfcam_find_client_to_follow
+CALLI4
+ASGNI4
+ADDRGP4 wcg+4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $4107
+INDIRI4
+CNSTI4 -1
+NEI4 $4109
+ADDRGP4 $4107
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+LABELV $4109
+ADDRGP4 $4107
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+EQI4 $4112
+ADDRGP4 cg+617036
+CNSTI1 0
+ASGNI1
+ADDRGP4 cg+5417532
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+5417524
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_firstPersonSwitchSound+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4118
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_firstPersonSwitchSoundStyle+12
+INDIRI4
+CNSTI4 0
+NEI4 $4121
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4122
+JUMPV
+LABELV $4121
+ADDRGP4 wolfcam_firstPersonSwitchSoundStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $4124
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4125
+JUMPV
+LABELV $4124
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 3
+NEI4 $4127
+ADDRGP4 $4107
+INDIRI4
+ADDRGP4 wcg+20
+INDIRI4
+EQI4 $4135
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 wcg+20
+INDIRI4
+NEI4 $4128
+LABELV $4135
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4128
+JUMPV
+LABELV $4127
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 2
+NEI4 $4136
+ADDRGP4 $4107
+INDIRI4
+ADDRGP4 wcg+12
+INDIRI4
+EQI4 $4144
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 wcg+12
+INDIRI4
+NEI4 $4137
+LABELV $4144
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4137
+JUMPV
+LABELV $4136
+ADDRLP4 44
+ADDRGP4 wcg
+INDIRI4
+ASGNI4
+ADDRGP4 $4107
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $4148
+ADDRGP4 wcg+4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $4145
+LABELV $4148
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+LABELV $4145
+LABELV $4137
+LABELV $4128
+LABELV $4125
+LABELV $4122
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $4149
+ADDRGP4 cg_firstPersonSwitchSound+16
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $4149
+LABELV $4118
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 2
+NEI4 $4152
+ADDRGP4 CG_ZoomUp_f
+CALLV
+pop
+LABELV $4152
+ADDRGP4 $4155
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $4156
+ADDRGP4 $4160
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $4157
+JUMPV
+LABELV $4156
+ADDRGP4 $4161
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $4157
+LABELV $4112
+ADDRGP4 $4107
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+LABELV $4105
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4167
+ADDRGP4 cg+44
+INDIRP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $4163
+LABELV $4167
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 cg+1335116
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3988
+JUMPV
+LABELV $4163
+ADDRGP4 CG_CheckPlayerKeyPress
+CALLV
+pop
+ADDRGP4 $4169
+INDIRI4
+ADDRGP4 cg+617024
+INDIRI4
+EQI4 $4170
+ADDRGP4 cg+617024
+INDIRI4
+CNSTI4 0
+EQI4 $4173
+ADDRGP4 $4176
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $4174
+JUMPV
+LABELV $4173
+ADDRGP4 $4177
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $4174
+LABELV $4170
+ADDRGP4 $4169
+ADDRGP4 cg+617024
+INDIRI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4179
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $4179
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $4179
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $4179
+ADDRLP4 36
+CNSTI4 4524
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4184
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $4191
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+NEI4 $4193
+ADDRGP4 $4195
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $4194
+JUMPV
+LABELV $4193
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+EQI4 $4196
+ADDRGP4 $4198
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $4196
+LABELV $4194
+LABELV $4191
+ADDRGP4 $4185
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $4199
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $4201
+ADDRGP4 $4185
+INDIRI4
+CNSTI4 2
+NEI4 $4201
+ADDRGP4 $4198
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $4202
+JUMPV
+LABELV $4201
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+NEI4 $4203
+ADDRGP4 $4195
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $4203
+LABELV $4202
+LABELV $4199
+ADDRGP4 $4186
+INDIRI4
+CNSTI4 -1
+NEI4 $4205
+ADDRGP4 $4186
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4205
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRGP4 $4186
+INDIRI4
+EQI4 $4208
+ADDRGP4 cg_firstPersonSwitchSound+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4211
+ADDRGP4 cg_firstPersonSwitchSound+16
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $4211
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 2
+NEI4 $4215
+ADDRGP4 CG_ZoomUp_f
+CALLV
+pop
+LABELV $4215
+ADDRGP4 $4218
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $4208
+ADDRGP4 $4184
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $4185
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4186
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4179
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $4221
+ADDRGP4 CG_DrawAdvertisements
+CALLV
+pop
+ADDRGP4 CG_ForceBModels
+CALLV
+pop
+ADDRGP4 CG_DrawSpawns
+CALLV
+pop
+ADDRGP4 CG_DrawRawCameraPathKeyPoints
+CALLV
+pop
+ADDRGP4 CG_DrawSplinePoints
+CALLV
+pop
+ADDRGP4 CG_DrawViewPointMark
+CALLV
+pop
+ADDRGP4 CG_DrawFloatNumbers
+CALLV
+pop
+ADDRGP4 CG_DrawPoiPics
+CALLV
+pop
+LABELV $4221
+ADDRGP4 cg+609312
+INDIRI4
+ARGI4
+ADDRGP4 cg+609812
+INDIRF4
+ARGF4
+ADDRGP4 trap_SetUserCmdValue
+CALLV
+pop
+ADDRLP4 36
+ADDRGP4 cg
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 CG_PredictPlayerState
+CALLV
+pop
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $4234
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+GTI4 $4235
+ADDRGP4 cg_deathStyle+12
+INDIRI4
+CNSTI4 4
+NEI4 $4234
+LABELV $4235
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $4231
+LABELV $4234
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4232
+JUMPV
+LABELV $4231
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $4232
+ADDRGP4 cg+607188
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $4240
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $4236
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $4236
+LABELV $4240
+ADDRLP4 56
+ADDRGP4 CG_CalcViewValues
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+LABELV $4236
+ADDRGP4 Wolfcam_LoadModels
+CALLV
+pop
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_IsFirstPersonView
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $4241
+ADDRGP4 CG_DamageBlendBlob
+CALLV
+pop
+ADDRGP4 $4242
+JUMPV
+LABELV $4241
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $4244
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 60
+INDIRI4
+NEI4 $4244
+LABELV $4244
+LABELV $4242
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607192
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $4251
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $4248
+LABELV $4251
+ADDRGP4 $4252
+ARGP4
+ADDRGP4 trap_ProfileBegin
+CALLV
+pop
+ADDRGP4 CG_AddPacketEntities
+CALLV
+pop
+ADDRGP4 trap_ProfileEnd
+CALLV
+pop
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4253
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Wolfcam_TransitionPlayerState
+CALLV
+pop
+ADDRGP4 Wolfcam_OffsetFirstPersonView
+CALLI4
+pop
+ADDRGP4 wolfcam_fixedViewAngles+12
+INDIRI4
+CNSTI4 0
+LEI4 $4255
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 $4258
+INDIRI4
+SUBI4
+ADDRGP4 wolfcam_fixedViewAngles+12
+INDIRI4
+LEI4 $4260
+ADDRGP4 $4259
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRGP4 $4258
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $4260
+LABELV $4261
+ADDRGP4 cg+609780
+ADDRGP4 $4259
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $4255
+ADDRLP4 68
+ADDRGP4 Wolfcam_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $4253
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $4270
+ADDRGP4 CG_AddMarks
+CALLV
+pop
+ADDRGP4 CG_AddParticles
+CALLV
+pop
+LABELV $4270
+ADDRGP4 QstrcmpCount
+CNSTI4 0
+ASGNI4
+LABELV $4248
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $4272
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4273
+JUMPV
+LABELV $4272
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $4275
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4276
+JUMPV
+LABELV $4275
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4278
+ADDRLP4 0
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4279
+JUMPV
+LABELV $4278
+ADDRLP4 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4279
+LABELV $4276
+LABELV $4273
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+3196856
+INDIRI4
+EQI4 $4283
+ADDRLP4 68
+ADDRGP4 $4286
+INDIRB
+ASGNB 60
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+GTI4 $4289
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $4287
+LABELV $4289
+ADDRGP4 cg_weaponNone+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4288
+ADDRGP4 $1934
+ARGP4
+ADDRGP4 cg_weaponNone+16
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $4288
+JUMPV
+LABELV $4287
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4294
+ADDRGP4 $1934
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $4295
+JUMPV
+LABELV $4294
+ADDRGP4 cg_weaponDefault+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4296
+ADDRGP4 $1934
+ARGP4
+ADDRGP4 cg_weaponDefault+16
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $4296
+LABELV $4295
+LABELV $4288
+ADDRGP4 cg+3196856
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $4283
+ADDRGP4 CG_VibrateCamera
+CALLV
+pop
+ADDRGP4 cg+607196
+ARGP4
+ADDRGP4 CG_AddViewWeapon
+CALLV
+pop
+LABELV $4301
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4304
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $4304
+ADDRGP4 Wolfcam_AddViewWeapon
+CALLV
+pop
+LABELV $4304
+ADDRGP4 CG_PlayBufferedSounds
+CALLV
+pop
+ADDRGP4 cg+627508+8
+INDIRI4
+CNSTI4 0
+EQI4 $4308
+ADDRGP4 CG_AddTestModel
+CALLV
+pop
+LABELV $4308
+ADDRGP4 cg+609412+72
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+609412+80
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTU4 32
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 CG_PowerupTimerSounds
+CALLV
+pop
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $4320
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 wcg+31087188
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $4322
+ADDRGP4 cg_hitBeep+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $4322
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $4322
+ADDRGP4 cgs+632912+493032
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+ADDRGP4 wcg+31087188
+CNSTI4 0
+ASGNI4
+ADDRGP4 wcg+31087192
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4323
+JUMPV
+LABELV $4322
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 wcg+31087192
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $4332
+ADDRGP4 cg_hitBeep+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $4332
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $4332
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+EQI4 $4338
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 9
+EQI4 $4338
+ADDRGP4 cgs+632912+493060
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_StartLocalSound
+CALLV
+pop
+LABELV $4338
+ADDRGP4 wcg+31087188
+CNSTI4 0
+ASGNI4
+ADDRGP4 wcg+31087192
+CNSTI4 0
+ASGNI4
+LABELV $4332
+LABELV $4323
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+ADDRGP4 $4321
+JUMPV
+LABELV $4320
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+LABELV $4321
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $4356
+ADDRGP4 cg+607144
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+607156
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+607144
+INDIRI4
+CNSTI4 0
+GEI4 $4361
+ADDRGP4 cg+607144
+CNSTI4 0
+ASGNI4
+LABELV $4361
+ADDRGP4 cg+607156
+INDIRI4
+CNSTI4 0
+NEI4 $4365
+ADDRGP4 cg+607144
+CNSTI4 0
+ASGNI4
+LABELV $4365
+ADDRGP4 cg+607144
+INDIRI4
+CNSTI4 200
+LEI4 $4369
+ADDRGP4 cg+3196924
+INDIRI4
+CNSTI4 0
+EQI4 $4372
+ADDRGP4 $4375
+ARGP4
+ADDRLP4 68
+ADDRGP4 SC_Cvar_Get_Float
+CALLF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 1065353216
+GTF4 $4372
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4376
+ADDRLP4 72
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 121396
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4376
+ADDRGP4 $4380
+ARGP4
+ADDRGP4 cg+607144
+INDIRI4
+ARGI4
+ADDRGP4 cg+607160
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4372
+ADDRGP4 cg+607144
+CNSTI4 200
+ASGNI4
+LABELV $4369
+ADDRGP4 cg+607156
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4386
+ADDRGP4 cg+607160
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 121396
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4387
+JUMPV
+LABELV $4386
+ADDRGP4 cg+607160
+CNSTI4 0
+ASGNI4
+LABELV $4387
+ADDRGP4 cg+8
+INDIRI4
+CNSTI4 0
+NEI4 $4392
+ADDRGP4 CG_AddLagometerFrameInfo
+CALLV
+pop
+LABELV $4392
+LABELV $4356
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+EQF4 $4395
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+GEF4 $4399
+ADDRLP4 68
+ADDRGP4 cg_timescale+8
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+ADDRGP4 cg+607144
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+LEF4 $4400
+ADDRGP4 cg_timescale+8
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+ASGNF4
+ADDRGP4 $4400
+JUMPV
+LABELV $4399
+ADDRLP4 68
+ADDRGP4 cg_timescale+8
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+ADDRGP4 cg+607144
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+GEF4 $4415
+ADDRGP4 cg_timescale+8
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+ASGNF4
+LABELV $4415
+LABELV $4400
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+CNSTF4 0
+EQF4 $4421
+ADDRGP4 $3777
+ARGP4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $4375
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $4421
+LABELV $4395
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $4425
+ADDRGP4 CG_FreeCam
+CALLV
+pop
+ADDRGP4 CG_VibrateCamera
+CALLV
+pop
+LABELV $4425
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+3196784
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $4434
+ADDRGP4 cg+3196788
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $4434
+ADDRGP4 cg_cameraQue+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $4428
+LABELV $4434
+ADDRGP4 CG_PlayCamera
+CALLI4
+pop
+ADDRGP4 cg+609412+72
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $4429
+CNSTI4 1023
+ARGI4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+ADDRGP4 $4429
+JUMPV
+LABELV $4428
+ADDRGP4 cg+3196792
+CNSTI4 0
+ASGNI4
+LABELV $4429
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332740
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $4446
+ADDRGP4 cg+8
+INDIRI4
+ADDRLP4 72
+INDIRI4
+NEI4 $4446
+ADDRGP4 $4450
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+24
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+ARGF4
+ADDRGP4 cg+609780
+INDIRF4
+ARGF4
+ADDRGP4 cg+609780+4
+INDIRF4
+ARGF4
+ADDRGP4 cg+609780+8
+INDIRF4
+ARGF4
+ADDRGP4 cg+1334988
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 cg+1332744
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 cg+1332748
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4469
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $4446
+ADDRGP4 cg+627504
+INDIRI4
+CNSTI4 0
+EQI4 $4470
+CNSTI4 1023
+ARGI4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+ADDRGP4 CG_VibrateCamera
+CALLV
+pop
+LABELV $4470
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $4477
+ADDRGP4 $4479
+ARGP4
+ADDRGP4 trap_ProfileBegin
+CALLV
+pop
+ADDRGP4 CG_AddLocalEntities
+CALLV
+pop
+ADDRGP4 CG_FlushSceneBatch
+CALLV
+pop
+ADDRGP4 trap_ProfileEnd
+CALLV
+pop
+LABELV $4477
+ADDRGP4 CG_DumpEntities
+CALLV
+pop
+ADDRGP4 CG_CheckSkillRating
+CALLV
+pop
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627388
+INDIRI4
+ADDRLP4 76
+INDIRI4
+NEI4 $4481
+ADDRGP4 cg+627392
+INDIRI4
+CNSTI4 -1
+NEI4 $4481
+ADDRGP4 $4480
+INDIRI4
+ADDRLP4 76
+INDIRI4
+NEI4 $4481
+ADDRGP4 cg+617032
+CNSTP4 0
+ASGNP4
+ADDRGP4 $4486
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $4481
+ADDRGP4 $4480
+ADDRGP4 cg+627392
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $4488
+ADDRGP4 $4490
+ARGP4
+ADDRGP4 trap_ProfileBegin
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActive
+CALLV
+pop
+ADDRGP4 trap_ProfileEnd
+CALLV
+pop
+LABELV $4488
+ADDRGP4 cg_stats+12
+INDIRI4
+CNSTI4 0
+EQI4 $4491
+ADDRGP4 $4494
+ARGP4
+ADDRGP4 cg
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $4491
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $4495
+LABELV $4495
+ADDRGP4 cg+1335116
+CNSTI4 0
+ASGNI4
+LABELV $3988
+endproc CG_DrawActiveFrame 136 36
+import QstrcmpCount
+bss
+align 4
+LABELV SplineNumPoints
+skip 4
+align 4
+LABELV SplineColor
+skip 16
+align 1
+LABELV BlackListedShader
+skip 64
+import PM_StepSlideMove
+import PM_SlideMove
+import PM_AddEvent
+import PM_AddTouchEnt
+import PM_ClipVelocity
+import bg_playerMaxs
+import bg_playerMins
+import c_pmove
+import pm_flightfriction
+import pm_waterfriction
+import pm_friction
+import pm_flyaccelerate
+import pm_wateraccelerate
+import pm_airaccelerate
+import pm_accelerate
+import pm_swimScale
+import pm_duckScale
+import pm_stopspeed
+import pml
+import pm
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import Wolfcam_AddViewWeapon
+import Wolfcam_CalcMuzzlePoint
+import Wolfcam_CalcFov
+import Wolfcam_OffsetFirstPersonView
+import Wolfcam_OffsetThirdPersonView
+import Wolfcam_LoadModels
+import CG_GetModelAndSkinName
+import CG_GetModelName
+import Wolfcam_WeaponTrace
+import Wolfcam_TransitionPlayerState
+import wolfcam_find_client_to_follow
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import CG_SpawnRailTrail
+import CG_AddWeaponWithPowerups
+import CG_MachinegunSpinAngle
+import CG_MapTorsoToWeaponFrame
+import CG_Bullet
+import CG_GetWeaponFlashOrigin
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_OutOfAmmoChange
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_DrawWeaponSelect
+import CG_AddViewWeapon
+import CG_AddPlayerWeapon
+import CG_LightningBolt
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_SimpleRailTrail
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_AddRealLoopingSound
+import CG_AddLoopingSound
+import CG_StartLocalSound
+import CG_StartSound
+import CG_NextNextSnapshot
+import CG_SnapshotRefEntity
+import CG_UpdateSnapshotRef
+import CG_SnapshotRefValid
+import CG_GetSnapshotRef
+import CG_PeekSnapshot
+import CG_GetSnapshot
+import CG_ProcessSnapshots
+import CG_ResetTimeChange
+import CG_ResetEntity
+import CG_PlayWinLossMusic
+import CG_CpmaParseGameState
+import CG_CpmaParseScores
+import CG_ExecuteNewServerCommands
+import CG_InterMissionHit
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseWarmup
+import CG_ParseServerinfo
+import CG_LoadInfectedGameTypeModels
+import CG_ClearSceneBatch
+import CG_FlushSceneBatch
+import CG_AddPolyToSceneBatch
+import CG_AddRefEntityToSceneBatch
+import CG_Q3mmeCameraResetInternalLengths
+import CG_Q3mmeCameraParse
+import CG_Q3mmeCameraSave
+import CG_Q3mmeDemoCameraCommand_f
+import CG_Q3mmeCameraDrawPath
+import CG_Q3mmeCameraFovAt
+import CG_Q3mmeCameraAnglesAt
+import CG_Q3mmeCameraOriginAt
+import CG_Q3mmeCameraPointAdd
+import demo
+import BG_XMLParse
+import BG_XMLOpen
+import BG_XMLWarning
+import BG_XMLError
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_FrameArenaInfo_f
+import CG_ResetFrameArena
+import CG_FrameArenaRelease
+import CG_FrameArenaMark
+import CG_FrameAlloc
+import CG_FreeMem
+import CG_CallocMem
+import CG_MallocMem
+import CG_NewParticleArea
+import CG_ParticleExplosion
+import CG_AddParticles
+import CG_ClearParticles
+import CG_AddMarks
+import CG_ImpactMark
+import CG_InitMarkPolys
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_DrawInformation
+import CG_LoadingFutureClient
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_AddPacketEntities
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_SetEntitySoundPosition
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AllowedAmbientSound
+import CG_PrintEntityStatep
+import CG_PrintEntityState
+import CG_ThawPlayer
+import CG_GibPlayer
+import CG_FX_ThawPlayer
+import CG_FX_GibPlayer
+import CG_ImpactSparks
+import CG_Bleed
+import CG_MakeExplosion
+import CG_HeadShotPlum
+import CG_DamagePlum
+import CG_ScorePlum
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_LightningBoltBeam
+import CG_SpawnEffect
+import CG_SmokePuff
+import CG_BubbleTrail
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_ShutdownLocalEnts
+import CG_GetStoredScriptVarsFromLE
+import CG_RunFxAll
+import CG_SmokePuff_ql
+import CG_AddRefEntityFX
+import CG_AddRefEntity
+import CG_ListLocalEntities
+import CG_RemoveFXLocalEntities
+import CG_ClearLocalFrameEntities
+import CG_CullGrid
+import CG_AddToCullGrid
+import CG_BeginCullGrid
+import CG_AddLocalEntities
+import CG_MakeLowPriorityEntity
+import CG_AllocLocalEntityRealTime
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import FxLoopSounds
+import CG_FreeFxJitTokens
+import CG_ResetFXIntervalAndDistance
+import CG_UpdatePositionData
+import CG_CopyPositionDataToScript
+import CG_CopyPositionDataToCent
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+import CG_CopyPlayerDataToScriptData
+import CG_ResetScriptVars
+import CG_ReloadQ3mmeScripts
+import CG_RunQ3mmeScript
+import CG_Q3mmeMath
+import EffectScripts
+import PlainScript
+import DistanceScript
+import EmitterScript
+import EmitterScriptVars
+import ScriptVars
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_StartidCamera
+import CG_ChangeConfigString
+import CG_CleanUpFieldNumber
+import CG_EchoPopup
+import CG_ErrorPopup
+import CG_AdjustTimeForTimeouts
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $4494
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $4490
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $4486
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4479
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4469
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 10
+byte 1 0
+align 1
+LABELV $4450
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4380
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 62
+byte 1 32
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4375
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4252
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 80
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4218
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4198
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4195
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4177
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4176
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4161
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4160
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4155
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4103
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $4094
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $4092
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $4091
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4085
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4081
+byte 1 94
+byte 1 53
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $4071
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3992
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3991
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3822
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3812
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 113
+byte 1 108
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $3777
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $3766
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 87
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 0
+align 1
+LABELV $3754
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3748
+byte 1 43
+byte 1 43
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 0
+align 1
+LABELV $3420
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3405
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3016
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $2839
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2825
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $2818
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2804
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 80
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 48
+byte 1 0
+align 1
+LABELV $2695
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2679
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 48
+byte 1 0
+align 1
+LABELV $2666
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2652
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2629
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2571
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $2526
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 101
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2483
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2474
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2457
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2442
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2411
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2391
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $2357
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $2349
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $2341
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2331
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2294
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2257
+byte 1 10
+byte 1 0
+align 1
+LABELV $2186
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2179
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $2178
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2170
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2169
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $2042
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 102
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 99
+byte 1 112
+byte 1 45
+byte 1 62
+byte 1 99
+byte 1 103
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2023
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1934
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1624
+byte 1 37
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1623
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 10
+byte 1 0
+align 1
+LABELV $1622
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 10
+byte 1 0
+align 1
+LABELV $1571
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1413
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $1410
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1406
+byte 1 94
+byte 1 51
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1396
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $1386
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1377
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1353
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 54
+byte 1 51
+byte 1 115
+byte 1 0
+align 1
+LABELV $1350
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1167
+byte 1 0
+align 1
+LABELV $1164
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1152
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1146
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1141
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1134
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $750
+byte 1 68
+byte 1 70
+byte 1 95
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 69
+byte 1 68
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 86
+byte 1 10
+byte 1 0
+align 1
+LABELV $316
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $312
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $311
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $237
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $220
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $181
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
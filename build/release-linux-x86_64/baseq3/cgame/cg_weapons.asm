@@ -0,0 +1,27466 @@
+code
+proc CG_MachineGunEjectBrass 144 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 0
+GTI4 $157
+ADDRGP4 $156
+JUMPV
+LABELV $157
+ADDRLP4 96
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1109393408
+CNSTF4 1073741824
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 3259498496
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+8
+CNSTF4 1112014848
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 4
+DIVI4
+CVIF4 4
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 15
+BANDI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 52+4
+CNSTF4 3229614080
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 120
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 52
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $190
+ADDRLP4 92
+CNSTF4 1036831949
+ASGNF4
+LABELV $190
+ADDRLP4 128
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 40
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cgs+632912+404
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 1053609165
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 136
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $156
+endproc CG_MachineGunEjectBrass 144 8
+proc CG_ShotgunEjectBrass 144 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 0
+GTI4 $218
+ADDRGP4 $217
+JUMPV
+LABELV $218
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $221
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+CNSTF4 1114636288
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $225
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1109393408
+ADDF4
+ASGNF4
+ADDRGP4 $226
+JUMPV
+LABELV $225
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 3256877056
+ADDF4
+ASGNF4
+LABELV $226
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+8
+CNSTF4 1112014848
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 112
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+CNSTI4 3
+ADDRGP4 cg_brassTime+12
+INDIRI4
+MULI4
+CVIF4 4
+ADDF4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CVIF4 4
+ADDRLP4 112
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 52+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 120
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 52
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $258
+ADDRLP4 96
+CNSTF4 1036831949
+ASGNF4
+LABELV $258
+ADDRLP4 128
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 40
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cgs+632912+408
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 1050253722
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 136
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $222
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+LTI4 $221
+LABELV $217
+endproc CG_ShotgunEjectBrass 144 8
+proc CG_NailgunEjectBrass 112 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 3242196992
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 88
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 88
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48+4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48+8
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 60+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 60+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+ADDRLP4 48+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 72+8
+CNSTF4 1115684864
+ASGNF4
+ADDRGP4 cg_smokeRadius_NG+12
+INDIRI4
+CNSTI4 0
+LEI4 $314
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 cg_smokeRadius_NG+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 100
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1143930880
+ARGF4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+492136
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $314
+LABELV $285
+endproc CG_NailgunEjectBrass 112 48
+export CG_SimpleRailTrail
+proc CG_SimpleRailTrail 20 0
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 CG_AllocLocalEntityRealTime
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 32
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607168
+INDIRI4
+CVIF4 4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 9
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+416
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 12
+INDIRP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 12
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+LABELV $321
+endproc CG_SimpleRailTrail 20 0
+proc CG_FX_RailTrail 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+51512
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 4524
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $331
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $329
+LABELV $331
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $329
+ADDRLP4 4
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+644
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+72
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+692
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRGP4 ScriptVars+96+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRGP4 ScriptVars+96+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+680
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+316
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+316+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+332
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+344
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 EffectScripts+1376424+98328
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+LABELV $327
+endproc CG_FX_RailTrail 20 8
+export CG_RailTrail
+proc CG_RailTrail 692 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 EffectScripts+1376424+12
+INDIRI4
+CNSTI4 0
+EQI4 $351
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_FX_RailTrail
+CALLV
+pop
+ADDRGP4 $350
+JUMPV
+LABELV $351
+ADDRLP4 508
+ADDRGP4 cg_railRadius+12
+INDIRI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+GTI4 $356
+ADDRLP4 508
+CNSTI4 1
+ASGNI4
+LABELV $356
+ADDRLP4 484
+ADDRGP4 cg_railRotation+12
+INDIRI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+GTI4 $359
+ADDRLP4 484
+CNSTI4 1
+ASGNI4
+LABELV $359
+ADDRLP4 504
+ADDRGP4 cg_railSpacing+12
+INDIRI4
+ASGNI4
+ADDRLP4 504
+INDIRI4
+CNSTI4 0
+GTI4 $362
+ADDRLP4 504
+CNSTI4 1
+ASGNI4
+LABELV $362
+ADDRGP4 cg_railQL+12
+INDIRI4
+CNSTI4 0
+EQI4 $364
+ADDRLP4 532
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg_railFromMuzzle+12
+INDIRI4
+CNSTI4 0
+NEI4 $367
+ADDRLP4 532+8
+ADDRLP4 532+8
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+LABELV $367
+ADDRLP4 8
+ADDRLP4 532
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 532+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 532+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 564
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 528
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRLP4 512
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $375
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 40
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 512
+ARGP4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIF4 4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+LABELV $376
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 36
+LTI4 $375
+ADDRLP4 568
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 568
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_railTrailTime+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 10
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+412
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 532
+INDIRB
+ASGNB 12
+ADDRLP4 36
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 548
+ADDRGP4 cg_railQLRailRingWhiteValue+8
+INDIRF4
+ASGNF4
+ADDRLP4 584
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 548
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 588
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 584
+INDIRF4
+ADDRLP4 588
+INDIRF4
+LTF4 $387
+ADDRLP4 580
+ADDRLP4 584
+INDIRF4
+ADDRLP4 588
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $388
+JUMPV
+LABELV $387
+ADDRLP4 580
+ADDRLP4 584
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $388
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 580
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 596
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 548
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 600
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 596
+INDIRF4
+ADDRLP4 600
+INDIRF4
+LTF4 $390
+ADDRLP4 592
+ADDRLP4 596
+INDIRF4
+ADDRLP4 600
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $391
+JUMPV
+LABELV $390
+ADDRLP4 592
+ADDRLP4 596
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $391
+ADDRLP4 36
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 592
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 608
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 548
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 612
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+LTF4 $393
+ADDRLP4 604
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $394
+JUMPV
+LABELV $393
+ADDRLP4 604
+ADDRLP4 608
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $394
+ADDRLP4 36
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 604
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 620
+CNSTF4 1132396544
+ADDRLP4 548
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 624
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+LTF4 $396
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $397
+ADDRLP4 36
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 616
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ADDRLP4 548
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+ADDRLP4 548
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ADDRLP4 548
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 548
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg_railFromMuzzle+12
+INDIRI4
+CNSTI4 0
+NEI4 $398
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 628
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 632
+CNSTI4 0
+ASGNI4
+ADDRLP4 628
+INDIRI4
+ADDRLP4 632
+INDIRI4
+EQI4 $411
+ADDRGP4 cg_railNudge+12
+INDIRI4
+ADDRLP4 632
+INDIRI4
+NEI4 $416
+LABELV $411
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $415
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 636
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRLP4 640
+CNSTI4 0
+ASGNI4
+ADDRLP4 636
+INDIRI4
+ADDRLP4 640
+INDIRI4
+EQI4 $415
+ADDRGP4 cg_teamRailNudge+12
+INDIRI4
+ADDRLP4 640
+INDIRI4
+EQI4 $415
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $416
+LABELV $415
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $419
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 652
+CNSTI4 0
+ASGNI4
+ADDRLP4 648
+INDIRI4
+ADDRLP4 652
+INDIRI4
+EQI4 $419
+ADDRGP4 cg_enemyRailNudge+12
+INDIRI4
+ADDRLP4 652
+INDIRI4
+EQI4 $419
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 656
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $416
+LABELV $419
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GEI4 $401
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 660
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 664
+CNSTI4 0
+ASGNI4
+ADDRLP4 660
+INDIRI4
+ADDRLP4 664
+INDIRI4
+EQI4 $401
+ADDRGP4 cg_enemyRailNudge+12
+INDIRI4
+ADDRLP4 664
+INDIRI4
+EQI4 $401
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 668
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 668
+INDIRI4
+CNSTI4 0
+NEI4 $401
+LABELV $416
+ADDRLP4 672
+ADDRLP4 36
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 672
+INDIRP4
+ADDRLP4 672
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRLP4 676
+ADDRLP4 36
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 676
+INDIRP4
+ADDRLP4 676
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $401
+LABELV $398
+LABELV $364
+ADDRLP4 532
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg_railFromMuzzle+12
+INDIRI4
+CNSTI4 0
+NEI4 $420
+ADDRLP4 532+8
+ADDRLP4 532+8
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+LABELV $420
+ADDRLP4 8
+ADDRLP4 532
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 532+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 532+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 564
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 528
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRLP4 512
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $428
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 40
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 512
+ARGP4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIF4 4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+LABELV $429
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 36
+LTI4 $428
+ADDRLP4 568
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 568
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_railTrailTime+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 9
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+416
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 532
+INDIRB
+ASGNB 12
+ADDRLP4 36
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 580
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2160
+ADDP4
+INDIRI4
+ADDRLP4 580
+INDIRI4
+EQI4 $438
+ADDRGP4 cg_clientOverrideIgnoreTeamSettings+12
+INDIRI4
+ADDRLP4 580
+INDIRI4
+EQI4 $438
+ADDRLP4 588
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 592
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 592
+INDIRF4
+LTF4 $442
+ADDRLP4 584
+ADDRLP4 588
+INDIRF4
+ADDRLP4 592
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $443
+JUMPV
+LABELV $442
+ADDRLP4 584
+ADDRLP4 588
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $443
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 584
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 600
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 604
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+LTF4 $445
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $446
+ADDRLP4 36
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 596
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 612
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 616
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+LTF4 $448
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $449
+ADDRLP4 36
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 608
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 36
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 628
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 632
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 628
+INDIRF4
+ADDRLP4 632
+INDIRF4
+LTF4 $451
+ADDRLP4 620
+ADDRLP4 628
+INDIRF4
+ADDRLP4 632
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $452
+JUMPV
+LABELV $451
+ADDRLP4 620
+ADDRLP4 628
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $452
+ADDRLP4 544
+ADDRLP4 620
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 636
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 640
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+LTF4 $455
+ADDRLP4 624
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $456
+JUMPV
+LABELV $455
+ADDRLP4 624
+ADDRLP4 636
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $456
+ADDRLP4 544+1
+ADDRLP4 624
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 648
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 652
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+LTF4 $459
+ADDRLP4 644
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRLP4 644
+ADDRLP4 648
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $460
+ADDRLP4 544+2
+ADDRLP4 644
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 656
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 488
+ADDRLP4 656
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 656
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+8
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $439
+JUMPV
+LABELV $438
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GEI4 $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 584
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 552
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRLP4 588
+CNSTI4 0
+ASGNI4
+ADDRLP4 552
+INDIRI4
+ADDRLP4 588
+INDIRI4
+EQI4 $468
+ADDRGP4 cg_enemyRailColor1+16
+INDIRI1
+CVII4 1
+ADDRLP4 588
+INDIRI4
+NEI4 $472
+ADDRGP4 cg_enemyRailColor2+16
+INDIRI1
+CVII4 1
+ADDRLP4 588
+INDIRI4
+EQI4 $468
+LABELV $472
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+CNSTI4 0
+NEI4 $468
+ADDRGP4 cg_enemyRailColor1+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $473
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 cg_enemyRailColor1
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 36
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 544
+ARGP4
+ADDRGP4 cg_enemyRailColor1
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRGP4 cg_enemyRailColor1
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 596
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 596
+INDIRP4
+CNSTF4 1061158912
+ADDRLP4 596
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 600
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ASGNP4
+ADDRLP4 600
+INDIRP4
+CNSTF4 1061158912
+ADDRLP4 600
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 604
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ASGNP4
+ADDRLP4 604
+INDIRP4
+CNSTF4 1061158912
+ADDRLP4 604
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 488
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 488+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 488+12
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRLP4 600
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 604
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+LTF4 $481
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $482
+JUMPV
+LABELV $481
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $482
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 596
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 612
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 616
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+LTF4 $484
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $485
+JUMPV
+LABELV $484
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $485
+ADDRLP4 36
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 608
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 624
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 628
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+LTF4 $487
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $488
+JUMPV
+LABELV $487
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $488
+ADDRLP4 36
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 620
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 36
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 640
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 644
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+LTF4 $490
+ADDRLP4 632
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $491
+JUMPV
+LABELV $490
+ADDRLP4 632
+ADDRLP4 640
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $491
+ADDRLP4 544
+ADDRLP4 632
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 648
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 652
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+LTF4 $494
+ADDRLP4 636
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $495
+JUMPV
+LABELV $494
+ADDRLP4 636
+ADDRLP4 648
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $495
+ADDRLP4 544+1
+ADDRLP4 636
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 660
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 664
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 660
+INDIRF4
+ADDRLP4 664
+INDIRF4
+LTF4 $498
+ADDRLP4 656
+ADDRLP4 660
+INDIRF4
+ADDRLP4 664
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRLP4 656
+ADDRLP4 660
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $499
+ADDRLP4 544+2
+ADDRLP4 656
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 668
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 488
+ADDRLP4 668
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 668
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+8
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $474
+ADDRGP4 cg_enemyRailColor2+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $504
+ADDRLP4 544
+ARGP4
+ADDRGP4 cg_enemyRailColor2
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 488
+ARGP4
+ADDRGP4 cg_enemyRailColor2
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 596
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 488
+ADDRLP4 596
+INDIRF4
+ADDRLP4 488
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 596
+INDIRF4
+ADDRLP4 488+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+8
+CNSTF4 1061158912
+ADDRLP4 488+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $466
+JUMPV
+LABELV $504
+ADDRLP4 604
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 608
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 604
+INDIRF4
+ADDRLP4 608
+INDIRF4
+LTF4 $512
+ADDRLP4 596
+ADDRLP4 604
+INDIRF4
+ADDRLP4 608
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $513
+JUMPV
+LABELV $512
+ADDRLP4 596
+ADDRLP4 604
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $513
+ADDRLP4 544
+ADDRLP4 596
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 612
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 616
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+LTF4 $516
+ADDRLP4 600
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $517
+JUMPV
+LABELV $516
+ADDRLP4 600
+ADDRLP4 612
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $517
+ADDRLP4 544+1
+ADDRLP4 600
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 624
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 628
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+LTF4 $520
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $521
+JUMPV
+LABELV $520
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $521
+ADDRLP4 544+2
+ADDRLP4 620
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 632
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 488
+ADDRLP4 632
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 632
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+8
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $466
+JUMPV
+LABELV $468
+ADDRLP4 600
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 604
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+LTF4 $527
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $528
+JUMPV
+LABELV $527
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $528
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 596
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 612
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 616
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+LTF4 $530
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $531
+JUMPV
+LABELV $530
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $531
+ADDRLP4 36
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 608
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 624
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 628
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+LTF4 $533
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $534
+JUMPV
+LABELV $533
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $534
+ADDRLP4 36
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 620
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 36
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 640
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 644
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+LTF4 $536
+ADDRLP4 632
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRLP4 632
+ADDRLP4 640
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $537
+ADDRLP4 544
+ADDRLP4 632
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 648
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 652
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+LTF4 $540
+ADDRLP4 636
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $541
+JUMPV
+LABELV $540
+ADDRLP4 636
+ADDRLP4 648
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $541
+ADDRLP4 544+1
+ADDRLP4 636
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 660
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 664
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 660
+INDIRF4
+ADDRLP4 664
+INDIRF4
+LTF4 $544
+ADDRLP4 656
+ADDRLP4 660
+INDIRF4
+ADDRLP4 664
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $545
+JUMPV
+LABELV $544
+ADDRLP4 656
+ADDRLP4 660
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $545
+ADDRLP4 544+2
+ADDRLP4 656
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 668
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 488
+ADDRLP4 668
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 668
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+8
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $466
+JUMPV
+LABELV $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 584
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 552
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 588
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRLP4 556
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 596
+CNSTI4 0
+ASGNI4
+ADDRLP4 592
+INDIRI4
+ADDRLP4 596
+INDIRI4
+NEI4 $550
+ADDRLP4 552
+INDIRI4
+ADDRLP4 596
+INDIRI4
+EQI4 $550
+ADDRGP4 cg_enemyRailColor1+16
+INDIRI1
+CVII4 1
+ADDRLP4 596
+INDIRI4
+NEI4 $558
+ADDRGP4 cg_enemyRailColor1Team+12
+INDIRI4
+ADDRLP4 596
+INDIRI4
+NEI4 $558
+ADDRGP4 cg_enemyRailColor2+16
+INDIRI1
+CVII4 1
+ADDRLP4 596
+INDIRI4
+NEI4 $558
+ADDRGP4 cg_enemyRailColor2Team+12
+INDIRI4
+ADDRLP4 596
+INDIRI4
+EQI4 $550
+LABELV $558
+ADDRGP4 cg_enemyRailColor1Team+12
+INDIRI4
+CNSTI4 0
+EQI4 $559
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $562
+ADDRLP4 600
+ADDRGP4 cg_weaponRedTeamColor
+ASGNP4
+ADDRGP4 $560
+JUMPV
+LABELV $562
+ADDRLP4 600
+ADDRGP4 cg_weaponBlueTeamColor
+ASGNP4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRLP4 600
+ADDRGP4 cg_enemyRailColor1
+ASGNP4
+LABELV $560
+ADDRLP4 600
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $564
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 600
+INDIRP4
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 36
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 544
+ARGP4
+ADDRLP4 600
+INDIRP4
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRLP4 600
+INDIRP4
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 604
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 604
+INDIRP4
+CNSTF4 1061158912
+ADDRLP4 604
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 608
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ASGNP4
+ADDRLP4 608
+INDIRP4
+CNSTF4 1061158912
+ADDRLP4 608
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 612
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ASGNP4
+ADDRLP4 612
+INDIRP4
+CNSTF4 1061158912
+ADDRLP4 612
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 488
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 488+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 488+12
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $565
+JUMPV
+LABELV $564
+ADDRLP4 608
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 612
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+LTF4 $571
+ADDRLP4 604
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $572
+JUMPV
+LABELV $571
+ADDRLP4 604
+ADDRLP4 608
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $572
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 604
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 620
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 624
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+LTF4 $574
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $575
+JUMPV
+LABELV $574
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $575
+ADDRLP4 36
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 616
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 632
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 636
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+LTF4 $577
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $578
+ADDRLP4 36
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 628
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 36
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 648
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 652
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+LTF4 $580
+ADDRLP4 640
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $581
+JUMPV
+LABELV $580
+ADDRLP4 640
+ADDRLP4 648
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $581
+ADDRLP4 544
+ADDRLP4 640
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 656
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 660
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 656
+INDIRF4
+ADDRLP4 660
+INDIRF4
+LTF4 $584
+ADDRLP4 644
+ADDRLP4 656
+INDIRF4
+ADDRLP4 660
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRLP4 644
+ADDRLP4 656
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $585
+ADDRLP4 544+1
+ADDRLP4 644
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 668
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 672
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 668
+INDIRF4
+ADDRLP4 672
+INDIRF4
+LTF4 $588
+ADDRLP4 664
+ADDRLP4 668
+INDIRF4
+ADDRLP4 672
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $589
+JUMPV
+LABELV $588
+ADDRLP4 664
+ADDRLP4 668
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $589
+ADDRLP4 544+2
+ADDRLP4 664
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 676
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 488
+ADDRLP4 676
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 676
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+8
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $565
+ADDRGP4 cg_enemyRailColor2Team+12
+INDIRI4
+CNSTI4 0
+EQI4 $594
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $597
+ADDRLP4 600
+ADDRGP4 cg_weaponRedTeamColor
+ASGNP4
+ADDRGP4 $595
+JUMPV
+LABELV $597
+ADDRLP4 600
+ADDRGP4 cg_weaponBlueTeamColor
+ASGNP4
+ADDRGP4 $595
+JUMPV
+LABELV $594
+ADDRLP4 600
+ADDRGP4 cg_enemyRailColor2
+ASGNP4
+LABELV $595
+ADDRLP4 600
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $599
+ADDRLP4 544
+ARGP4
+ADDRLP4 600
+INDIRP4
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 488
+ARGP4
+ADDRLP4 600
+INDIRP4
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 604
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 488
+ADDRLP4 604
+INDIRF4
+ADDRLP4 488
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 604
+INDIRF4
+ADDRLP4 488+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+8
+CNSTF4 1061158912
+ADDRLP4 488+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $551
+JUMPV
+LABELV $599
+ADDRLP4 612
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 616
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+LTF4 $606
+ADDRLP4 604
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $607
+JUMPV
+LABELV $606
+ADDRLP4 604
+ADDRLP4 612
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $607
+ADDRLP4 544
+ADDRLP4 604
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 620
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 624
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+LTF4 $610
+ADDRLP4 608
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $611
+JUMPV
+LABELV $610
+ADDRLP4 608
+ADDRLP4 620
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $611
+ADDRLP4 544+1
+ADDRLP4 608
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 632
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 636
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+LTF4 $614
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $615
+JUMPV
+LABELV $614
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $615
+ADDRLP4 544+2
+ADDRLP4 628
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 640
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 488
+ADDRLP4 640
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 640
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+8
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 600
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 604
+CNSTI4 0
+ASGNI4
+ADDRLP4 600
+INDIRI4
+ADDRLP4 604
+INDIRI4
+NEI4 $620
+ADDRLP4 556
+INDIRI4
+ADDRLP4 604
+INDIRI4
+EQI4 $620
+ADDRGP4 cg_teamRailColor1+16
+INDIRI1
+CVII4 1
+ADDRLP4 604
+INDIRI4
+NEI4 $628
+ADDRGP4 cg_teamRailColor1Team+12
+INDIRI4
+ADDRLP4 604
+INDIRI4
+NEI4 $628
+ADDRGP4 cg_teamRailColor2+16
+INDIRI1
+CVII4 1
+ADDRLP4 604
+INDIRI4
+NEI4 $628
+ADDRGP4 cg_teamRailColor2Team+12
+INDIRI4
+ADDRLP4 604
+INDIRI4
+EQI4 $620
+LABELV $628
+ADDRGP4 cg_teamRailColor1Team+12
+INDIRI4
+CNSTI4 0
+EQI4 $629
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $632
+ADDRLP4 608
+ADDRGP4 cg_weaponRedTeamColor
+ASGNP4
+ADDRGP4 $630
+JUMPV
+LABELV $632
+ADDRLP4 608
+ADDRGP4 cg_weaponBlueTeamColor
+ASGNP4
+ADDRGP4 $630
+JUMPV
+LABELV $629
+ADDRLP4 608
+ADDRGP4 cg_teamRailColor1
+ASGNP4
+LABELV $630
+ADDRLP4 608
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $634
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 36
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 544
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 612
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 612
+INDIRP4
+CNSTF4 1061158912
+ADDRLP4 612
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 616
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ASGNP4
+ADDRLP4 616
+INDIRP4
+CNSTF4 1061158912
+ADDRLP4 616
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 620
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ASGNP4
+ADDRLP4 620
+INDIRP4
+CNSTF4 1061158912
+ADDRLP4 620
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 488
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 488+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 488+12
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $635
+JUMPV
+LABELV $634
+ADDRLP4 616
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 620
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 616
+INDIRF4
+ADDRLP4 620
+INDIRF4
+LTF4 $641
+ADDRLP4 612
+ADDRLP4 616
+INDIRF4
+ADDRLP4 620
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $642
+JUMPV
+LABELV $641
+ADDRLP4 612
+ADDRLP4 616
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $642
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 612
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 628
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 632
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 628
+INDIRF4
+ADDRLP4 632
+INDIRF4
+LTF4 $644
+ADDRLP4 624
+ADDRLP4 628
+INDIRF4
+ADDRLP4 632
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $645
+JUMPV
+LABELV $644
+ADDRLP4 624
+ADDRLP4 628
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $645
+ADDRLP4 36
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 624
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 640
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 644
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+LTF4 $647
+ADDRLP4 636
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $648
+JUMPV
+LABELV $647
+ADDRLP4 636
+ADDRLP4 640
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $648
+ADDRLP4 36
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 636
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 36
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 656
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 660
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 656
+INDIRF4
+ADDRLP4 660
+INDIRF4
+LTF4 $650
+ADDRLP4 648
+ADDRLP4 656
+INDIRF4
+ADDRLP4 660
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $651
+JUMPV
+LABELV $650
+ADDRLP4 648
+ADDRLP4 656
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $651
+ADDRLP4 544
+ADDRLP4 648
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 664
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 668
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 664
+INDIRF4
+ADDRLP4 668
+INDIRF4
+LTF4 $654
+ADDRLP4 652
+ADDRLP4 664
+INDIRF4
+ADDRLP4 668
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $655
+JUMPV
+LABELV $654
+ADDRLP4 652
+ADDRLP4 664
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $655
+ADDRLP4 544+1
+ADDRLP4 652
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 676
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 680
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 676
+INDIRF4
+ADDRLP4 680
+INDIRF4
+LTF4 $658
+ADDRLP4 672
+ADDRLP4 676
+INDIRF4
+ADDRLP4 680
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $659
+JUMPV
+LABELV $658
+ADDRLP4 672
+ADDRLP4 676
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $659
+ADDRLP4 544+2
+ADDRLP4 672
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 684
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 488
+ADDRLP4 684
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 684
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+8
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $635
+ADDRGP4 cg_teamRailColor2Team+12
+INDIRI4
+CNSTI4 0
+EQI4 $664
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $667
+ADDRLP4 608
+ADDRGP4 cg_weaponRedTeamColor
+ASGNP4
+ADDRGP4 $665
+JUMPV
+LABELV $667
+ADDRLP4 608
+ADDRGP4 cg_weaponBlueTeamColor
+ASGNP4
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRLP4 608
+ADDRGP4 cg_teamRailColor2
+ASGNP4
+LABELV $665
+ADDRLP4 608
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $669
+ADDRLP4 544
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 488
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+ADDRGP4 SC_Vec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 612
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 488
+ADDRLP4 612
+INDIRF4
+ADDRLP4 488
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 488+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+8
+CNSTF4 1061158912
+ADDRLP4 488+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $621
+JUMPV
+LABELV $669
+ADDRLP4 620
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 624
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+LTF4 $676
+ADDRLP4 612
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $677
+JUMPV
+LABELV $676
+ADDRLP4 612
+ADDRLP4 620
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $677
+ADDRLP4 544
+ADDRLP4 612
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 628
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 632
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 628
+INDIRF4
+ADDRLP4 632
+INDIRF4
+LTF4 $680
+ADDRLP4 616
+ADDRLP4 628
+INDIRF4
+ADDRLP4 632
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $681
+JUMPV
+LABELV $680
+ADDRLP4 616
+ADDRLP4 628
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $681
+ADDRLP4 544+1
+ADDRLP4 616
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 640
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 644
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+LTF4 $684
+ADDRLP4 636
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $685
+JUMPV
+LABELV $684
+ADDRLP4 636
+ADDRLP4 640
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $685
+ADDRLP4 544+2
+ADDRLP4 636
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 648
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 488
+ADDRLP4 648
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 648
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+8
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $621
+JUMPV
+LABELV $620
+ADDRLP4 612
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 616
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+LTF4 $691
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $692
+JUMPV
+LABELV $691
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $692
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 608
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 624
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 628
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+LTF4 $694
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $695
+JUMPV
+LABELV $694
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $695
+ADDRLP4 36
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 620
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 636
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 640
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+LTF4 $697
+ADDRLP4 632
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $698
+JUMPV
+LABELV $697
+ADDRLP4 632
+ADDRLP4 636
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $698
+ADDRLP4 36
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 632
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 36
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 652
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 656
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 652
+INDIRF4
+ADDRLP4 656
+INDIRF4
+LTF4 $700
+ADDRLP4 644
+ADDRLP4 652
+INDIRF4
+ADDRLP4 656
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $701
+JUMPV
+LABELV $700
+ADDRLP4 644
+ADDRLP4 652
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $701
+ADDRLP4 544
+ADDRLP4 644
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 660
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 664
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 660
+INDIRF4
+ADDRLP4 664
+INDIRF4
+LTF4 $704
+ADDRLP4 648
+ADDRLP4 660
+INDIRF4
+ADDRLP4 664
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $705
+JUMPV
+LABELV $704
+ADDRLP4 648
+ADDRLP4 660
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $705
+ADDRLP4 544+1
+ADDRLP4 648
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 672
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 676
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 672
+INDIRF4
+ADDRLP4 676
+INDIRF4
+LTF4 $708
+ADDRLP4 668
+ADDRLP4 672
+INDIRF4
+ADDRLP4 676
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $709
+JUMPV
+LABELV $708
+ADDRLP4 668
+ADDRLP4 672
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $709
+ADDRLP4 544+2
+ADDRLP4 668
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 680
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 488
+ADDRLP4 680
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+4
+ADDRLP4 680
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+8
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $621
+LABELV $551
+LABELV $466
+LABELV $439
+ADDRLP4 36
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 584
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 584
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 8+4
+INDIRF4
+ADDRLP4 584
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 588
+ADDRLP4 504
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 504
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 cg_railFromMuzzle+12
+INDIRI4
+CNSTI4 0
+NEI4 $724
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 596
+CNSTI4 0
+ASGNI4
+ADDRLP4 592
+INDIRI4
+ADDRLP4 596
+INDIRI4
+EQI4 $737
+ADDRGP4 cg_railNudge+12
+INDIRI4
+ADDRLP4 596
+INDIRI4
+NEI4 $742
+LABELV $737
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $741
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 600
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRLP4 604
+CNSTI4 0
+ASGNI4
+ADDRLP4 600
+INDIRI4
+ADDRLP4 604
+INDIRI4
+EQI4 $741
+ADDRGP4 cg_teamRailNudge+12
+INDIRI4
+ADDRLP4 604
+INDIRI4
+EQI4 $741
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 608
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 608
+INDIRI4
+CNSTI4 0
+EQI4 $742
+LABELV $741
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $745
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 612
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 616
+CNSTI4 0
+ASGNI4
+ADDRLP4 612
+INDIRI4
+ADDRLP4 616
+INDIRI4
+EQI4 $745
+ADDRGP4 cg_enemyRailNudge+12
+INDIRI4
+ADDRLP4 616
+INDIRI4
+EQI4 $745
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 620
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+CNSTI4 0
+EQI4 $742
+LABELV $745
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GEI4 $727
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 624
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 628
+CNSTI4 0
+ASGNI4
+ADDRLP4 624
+INDIRI4
+ADDRLP4 628
+INDIRI4
+EQI4 $727
+ADDRGP4 cg_enemyRailNudge+12
+INDIRI4
+ADDRLP4 628
+INDIRI4
+EQI4 $727
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 632
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 0
+NEI4 $727
+LABELV $742
+ADDRLP4 636
+ADDRLP4 36
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 636
+INDIRP4
+ADDRLP4 636
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRLP4 640
+ADDRLP4 36
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 640
+INDIRP4
+ADDRLP4 640
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $727
+LABELV $724
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 596
+CNSTI4 0
+ASGNI4
+ADDRLP4 592
+INDIRI4
+ADDRLP4 596
+INDIRI4
+EQI4 $756
+ADDRGP4 cg_railRings+12
+INDIRI4
+ADDRLP4 596
+INDIRI4
+EQI4 $760
+LABELV $756
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $759
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 600
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRLP4 604
+CNSTI4 0
+ASGNI4
+ADDRLP4 600
+INDIRI4
+ADDRLP4 604
+INDIRI4
+EQI4 $759
+ADDRGP4 cg_teamRailRings+12
+INDIRI4
+ADDRLP4 604
+INDIRI4
+EQI4 $760
+LABELV $759
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $762
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 608
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 612
+CNSTI4 0
+ASGNI4
+ADDRLP4 608
+INDIRI4
+ADDRLP4 612
+INDIRI4
+EQI4 $762
+ADDRGP4 cg_enemyRailRings+12
+INDIRI4
+ADDRLP4 612
+INDIRI4
+EQI4 $760
+LABELV $762
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GEI4 $746
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 616
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 620
+CNSTI4 0
+ASGNI4
+ADDRLP4 616
+INDIRI4
+ADDRLP4 620
+INDIRI4
+EQI4 $746
+ADDRGP4 cg_enemyRailRings+12
+INDIRI4
+ADDRLP4 620
+INDIRI4
+NEI4 $746
+LABELV $760
+ADDRGP4 $350
+JUMPV
+LABELV $746
+ADDRLP4 524
+CNSTI4 -1
+ASGNI4
+ADDRLP4 20
+CNSTI4 18
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $766
+JUMPV
+LABELV $763
+ADDRLP4 4
+INDIRI4
+ADDRLP4 524
+INDIRI4
+EQI4 $767
+ADDRLP4 524
+ADDRLP4 4
+INDIRI4
+ADDRLP4 504
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 624
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 624
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+RSHI4
+ADDI4
+CNSTI4 600
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1066192077
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+412
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 544
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 488
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 488+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 488+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 488+12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 636
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 640
+ADDRLP4 508
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 472
+ADDRLP4 472
+INDIRF4
+ADDRLP4 636
+INDIRI4
+ADDRLP4 40
+ADDP4
+INDIRF4
+ADDRLP4 640
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 472+4
+ADDRLP4 472+4
+INDIRF4
+ADDRLP4 636
+INDIRI4
+ADDRLP4 40+4
+ADDP4
+INDIRF4
+ADDRLP4 640
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 472+8
+ADDRLP4 472+8
+INDIRF4
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 40+8
+ADDP4
+INDIRF4
+ADDRLP4 508
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 472
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1086324736
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTF4 1086324736
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 40+4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1086324736
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 40+8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $767
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 8+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 484
+INDIRI4
+ADDI4
+CNSTI4 36
+GEI4 $793
+ADDRLP4 624
+ADDRLP4 20
+INDIRI4
+ADDRLP4 484
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $794
+JUMPV
+LABELV $793
+ADDRLP4 624
+ADDRLP4 20
+INDIRI4
+ADDRLP4 484
+INDIRI4
+ADDI4
+CNSTI4 36
+MODI4
+ASGNI4
+LABELV $794
+ADDRLP4 20
+ADDRLP4 624
+INDIRI4
+ASGNI4
+LABELV $764
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 504
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $766
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 528
+INDIRF4
+LTF4 $763
+LABELV $350
+endproc CG_RailTrail 692 16
+proc CG_ProjectileTrail 364 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $796
+ADDRGP4 $795
+JUMPV
+LABELV $796
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_weapons
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 132
+DIVI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 312
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 316
+CNSTI4 4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+ADDRLP4 316
+INDIRI4
+EQI4 $803
+ADDRLP4 312
+INDIRI4
+CNSTI4 5
+EQI4 $801
+ADDRLP4 312
+INDIRI4
+ADDRLP4 316
+INDIRI4
+LTI4 $800
+LABELV $807
+ADDRLP4 288
+INDIRI4
+CNSTI4 12
+EQI4 $805
+ADDRGP4 $800
+JUMPV
+LABELV $801
+ADDRLP4 4
+ADDRGP4 cg_smokeRadius_RL+12
+INDIRI4
+ASGNI4
+ADDRGP4 $800
+JUMPV
+LABELV $803
+ADDRLP4 4
+ADDRGP4 cg_smokeRadius_GL+12
+INDIRI4
+ASGNI4
+ADDRGP4 $800
+JUMPV
+LABELV $805
+ADDRLP4 4
+ADDRGP4 cg_smokeRadius_PL+12
+INDIRI4
+ASGNI4
+LABELV $800
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+GEI4 $808
+ADDRGP4 $795
+JUMPV
+LABELV $808
+ADDRLP4 320
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+ADDRLP4 320
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 320
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+CNSTI4 50
+ASGNI4
+ADDRLP4 48
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 236
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 24
+ADDRLP4 48
+ASGNP4
+ADDRLP4 324
+ADDRLP4 24
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+ADDRLP4 324
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $812
+LABELV $812
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+ADDRLP4 304
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 332
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $815
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $795
+JUMPV
+LABELV $815
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 336
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 308
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $817
+ADDRLP4 284
+INDIRI4
+ADDRLP4 308
+INDIRI4
+BANDI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $795
+ADDRLP4 8
+ARGP4
+ADDRLP4 292
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $795
+JUMPV
+LABELV $817
+ADDRLP4 340
+CNSTI4 0
+ASGNI4
+ADDRGP4 $824
+JUMPV
+LABELV $821
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+NEI4 $831
+ADDRLP4 344
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $832
+JUMPV
+LABELV $831
+ADDRLP4 344
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $832
+ADDRLP4 344
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 352
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 352
+INDIRF4
+ARGF4
+ADDRLP4 352
+INDIRF4
+ARGF4
+ADDRLP4 352
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 356
+CNSTI4 0
+ASGNI4
+ADDRLP4 356
+INDIRI4
+ARGI4
+ADDRLP4 356
+INDIRI4
+ARGI4
+ADDRLP4 340
+INDIRI4
+ADDRLP4 356
+INDIRI4
+NEI4 $833
+ADDRLP4 348
+ADDRGP4 cgs+632912+492136
+INDIRI4
+ASGNI4
+ADDRGP4 $834
+JUMPV
+LABELV $833
+ADDRLP4 348
+ADDRGP4 cgs+632912+492136
+INDIRI4
+ASGNI4
+LABELV $834
+ADDRLP4 348
+INDIRI4
+ARGI4
+ADDRLP4 360
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 360
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRLP4 340
+ADDRLP4 340
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $822
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $824
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+LEI4 $821
+LABELV $795
+endproc CG_ProjectileTrail 364 48
+proc CG_NailTrail 336 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $836
+ADDRGP4 $835
+JUMPV
+LABELV $836
+ADDRGP4 cg_smokeRadius_NG+12
+INDIRI4
+CNSTI4 1
+GEI4 $839
+ADDRGP4 $835
+JUMPV
+LABELV $839
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 304
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRLP4 304
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 304
+INDIRF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+CNSTI4 50
+ASGNI4
+ADDRLP4 44
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 236
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 20
+ADDRLP4 44
+ASGNP4
+ADDRLP4 308
+ADDRLP4 20
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $844
+LABELV $844
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ADDRLP4 24
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 284
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRLP4 284
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 316
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $847
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $835
+JUMPV
+LABELV $847
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 300
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $856
+ADDRLP4 280
+INDIRI4
+ADDRLP4 300
+INDIRI4
+BANDI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $835
+ADDRLP4 4
+ARGP4
+ADDRLP4 284
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $835
+JUMPV
+LABELV $853
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 cg_smokeRadius_NG+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 324
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 324
+INDIRF4
+ARGF4
+ADDRLP4 324
+INDIRF4
+ARGF4
+ADDRLP4 324
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 328
+CNSTI4 0
+ASGNI4
+ADDRLP4 328
+INDIRI4
+ARGI4
+ADDRLP4 328
+INDIRI4
+ARGI4
+ADDRGP4 cgs+632912+492164
+INDIRI4
+ARGI4
+ADDRLP4 332
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 332
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $854
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $856
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+LEI4 $853
+LABELV $835
+endproc CG_NailTrail 336 48
+proc CG_PlasmaTrail 440 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 cg_plasmaStyle+12
+INDIRI4
+CNSTI4 2
+EQI4 $861
+ADDRGP4 $860
+JUMPV
+LABELV $861
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 236
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 348
+ADDRLP4 112
+ASGNP4
+ADDRLP4 348
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 100
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRLP4 356
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 356
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ASGNP4
+ADDRLP4 360
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+CNSTF4 1114636288
+CNSTF4 1123024896
+CNSTF4 1073741824
+ADDRLP4 360
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 364
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44+4
+CNSTF4 1109393408
+CNSTF4 1117782016
+CNSTF4 1073741824
+ADDRLP4 364
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 368
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44+8
+CNSTF4 1120403456
+CNSTF4 1128792064
+CNSTF4 1073741824
+ADDRLP4 368
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 376
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 56
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRLP4 56+8
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 380
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 380
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 380
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 56
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 100+4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 100+8
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 384
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 384
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $893
+ADDRLP4 96
+CNSTF4 1036831949
+ASGNF4
+LABELV $893
+ADDRLP4 388
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 388
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 388
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 44
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 40
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+412
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 1050253722
+ASGNF4
+ADDRLP4 396
+CNSTF4 1115422720
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 400
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 396
+INDIRF4
+ADDRLP4 400
+INDIRF4
+LTF4 $920
+ADDRLP4 392
+ADDRLP4 396
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $921
+JUMPV
+LABELV $920
+ADDRLP4 392
+ADDRLP4 396
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $921
+ADDRLP4 40
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 392
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 408
+CNSTF4 1115422720
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 412
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 408
+INDIRF4
+ADDRLP4 412
+INDIRF4
+LTF4 $923
+ADDRLP4 404
+ADDRLP4 408
+INDIRF4
+ADDRLP4 412
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $924
+JUMPV
+LABELV $923
+ADDRLP4 404
+ADDRLP4 408
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $924
+ADDRLP4 40
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 404
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 420
+CNSTF4 1115422720
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 424
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 420
+INDIRF4
+ADDRLP4 424
+INDIRF4
+LTF4 $926
+ADDRLP4 416
+ADDRLP4 420
+INDIRF4
+ADDRLP4 424
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $927
+JUMPV
+LABELV $926
+ADDRLP4 416
+ADDRLP4 420
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $927
+ADDRLP4 40
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 416
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 63
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 1045220557
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1045220557
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1045220557
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 428
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 428
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 432
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 432
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 436
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 436
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $860
+endproc CG_PlasmaTrail 440 16
+proc CG_FX_GrappleTrail 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+51512
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 4524
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $932
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $930
+LABELV $932
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $930
+ADDRLP4 4
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+644
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+72
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+692
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRGP4 ScriptVars+96+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRGP4 ScriptVars+96+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+680
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+ADDRGP4 EffectScripts+1966320+98328
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+LABELV $928
+endproc CG_FX_GrappleTrail 20 8
+export CG_GrappleTrail
+proc CG_GrappleTrail 472 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 196
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 236
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 192
+ADDRLP4 196
+ASGNP4
+ADDRLP4 192
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 432
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+LTI4 $950
+ADDRLP4 172
+INDIRI4
+CNSTI4 64
+LTI4 $948
+LABELV $950
+ADDRGP4 $951
+ARGP4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+LABELV $948
+ADDRLP4 444
+CNSTI4 4524
+ADDRLP4 172
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+CNSTI4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+CNSTI4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1200
+ADDP4
+ARGP4
+ADDRLP4 448
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 176+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 176+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+84
+ADDRLP4 432
+INDIRB
+ASGNB 12
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 0+84
+ARGP4
+ADDRGP4 CG_GetWeaponFlashOrigin
+CALLV
+pop
+ADDRLP4 192
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 0+68
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRGP4 EffectScripts+1966320+12
+INDIRI4
+CNSTI4 0
+EQI4 $974
+ADDRLP4 444
+INDIRP4
+ARGP4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 0+84
+ARGP4
+ADDRGP4 CG_FX_GrappleTrail
+CALLV
+pop
+ADDRGP4 $946
+JUMPV
+LABELV $974
+ADDRLP4 0
+CNSTI4 15
+ASGNI4
+ADDRGP4 $981
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0+112
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+144
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $946
+endproc CG_GrappleTrail 472 16
+proc CG_GrenadeTrail 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_ProjectileTrail
+CALLV
+pop
+LABELV $991
+endproc CG_GrenadeTrail 0 8
+data
+align 4
+LABELV $996
+byte 4 0
+export CG_RegisterWeapon
+code
+proc CG_RegisterWeapon 372 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $995
+ADDRFP4 0
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $993
+LABELV $995
+ADDRGP4 $996
+INDIRI4
+CNSTI4 0
+NEI4 $992
+ADDRGP4 $999
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $996
+CNSTI4 1
+ASGNI4
+ADDRGP4 $992
+JUMPV
+LABELV $993
+ADDRLP4 12
+CNSTI4 132
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1000
+ADDRGP4 $992
+JUMPV
+LABELV $1000
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1002
+ADDRGP4 $992
+JUMPV
+LABELV $1002
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 132
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $1007
+JUMPV
+LABELV $1004
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1009
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $1009
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1006
+JUMPV
+LABELV $1009
+LABELV $1005
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $1007
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1004
+LABELV $1006
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1011
+ADDRGP4 $1013
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1011
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1014
+ADDRLP4 116
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 116
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 116
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+ADDRLP4 120
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 116
+INDIRI4
+ADDRLP4 92
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1015
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1014
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $1021
+JUMPV
+LABELV $1018
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1023
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $1023
+ADDRGP4 $1020
+JUMPV
+LABELV $1023
+LABELV $1019
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $1021
+ADDRLP4 8
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1018
+LABELV $1020
+ADDRLP4 128
+CNSTU4 0
+ASGNU4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRLP4 128
+INDIRU4
+EQU4 $1025
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 128
+INDIRU4
+EQU4 $1025
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+LABELV $1025
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $1027
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1028
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $1030
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $1029
+JUMPV
+LABELV $1028
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $1030
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $1029
+ADDRLP4 28
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $1031
+ADDRLP4 28
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+LABELV $1031
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $1033
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1034
+ADDRGP4 $1036
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+LABELV $1034
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $1037
+ADDRFP4 0
+INDIRI4
+CNSTI4 14
+GTI4 $1037
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1145-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1145
+address $1039
+address $1074
+address $1081
+address $1098
+address $1085
+address $1042
+address $1120
+address $1111
+address $1131
+address $1061
+address $1108
+address $1092
+address $1065
+address $1138
+code
+LABELV $1039
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1040
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $1041
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1042
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1043
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $1044
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 160
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRGP4 $1045
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 164
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 $1048
+ARGP4
+ADDRLP4 168
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+420
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 $1051
+ARGP4
+ADDRLP4 172
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492344
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRGP4 $1054
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 176
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492808
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRGP4 $1057
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 180
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492812
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 $1060
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 184
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492816
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1061
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1062
+ARGP4
+ADDRLP4 188
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_GrappleTrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1157234688
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1043
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 192
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRGP4 $1040
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 196
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRGP4 $1048
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+420
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1065
+ADDRGP4 $1066
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 204
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1067
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 208
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRGP4 $1068
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 212
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $1069
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 216
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRGP4 $1070
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 220
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_MachineGunEjectBrass
+ASGNP4
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 224
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492356
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1074
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1075
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 228
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRGP4 $1076
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 232
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRGP4 $1077
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 236
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRGP4 $1078
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 240
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_MachineGunEjectBrass
+ASGNP4
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 244
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492356
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1081
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1082
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 248
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_ShotgunEjectBrass
+ASGNP4
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 252
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492356
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1085
+ADDRGP4 $1086
+ARGP4
+ADDRLP4 256
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRGP4 $1087
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 260
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_ProjectileTrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1157234688
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1088
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 264
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $1091
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492360
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1092
+ADDRGP4 $1093
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_GrenadeTrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1143930880
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1094
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 276
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $1097
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492364
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1098
+ADDRGP4 $1099
+ARGP4
+ADDRLP4 288
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1100
+ADDRGP4 $1099
+ARGP4
+ADDRGP4 $1102
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1100
+ADDRGP4 $1103
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_GrenadeTrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1143930880
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1104
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 296
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRGP4 $1097
+ARGP4
+ADDRLP4 300
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492364
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRGP4 $1107
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1099
+ARGP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1038
+JUMPV
+LABELV $1108
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_NailgunEjectBrass
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_NailTrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1132068864
+ASGNF4
+ADDRGP4 $1109
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1110
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 288
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1111
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_PlasmaTrail
+ASGNP4
+ADDRGP4 $1112
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 292
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1113
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 296
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRGP4 $1116
+ARGP4
+ADDRLP4 300
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492352
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+412
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1120
+ADDRGP4 $1121
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 308
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1122
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 312
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRGP4 $1125
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492348
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+412
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRGP4 $1130
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+416
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1131
+ADDRGP4 $1132
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 328
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1133
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $1136
+ARGP4
+ADDRLP4 336
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492368
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $1137
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $1087
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1138
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1139
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $1140
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $1141
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $1142
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 360
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_MachineGunEjectBrass
+ASGNP4
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 364
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+632912+492356
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+JUMPV
+LABELV $1037
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1088
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 368
+INDIRI4
+ASGNI4
+LABELV $1038
+LABELV $992
+endproc CG_RegisterWeapon 372 12
+export CG_RegisterItemVisuals
+proc CG_RegisterItemVisuals 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1150
+ADDRFP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $1148
+LABELV $1150
+ADDRGP4 $1151
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 bg_numItems
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1147
+JUMPV
+LABELV $1148
+ADDRLP4 8
+CNSTI4 24
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1152
+ADDRGP4 $1147
+JUMPV
+LABELV $1152
+ADDRLP4 4
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 24
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1154
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1158
+ADDRGP4 $1155
+JUMPV
+LABELV $1158
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $1155
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $1154
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1160
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+LABELV $1160
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $1166
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $1166
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $1166
+ADDRLP4 20
+INDIRI4
+CNSTI4 6
+NEI4 $1162
+LABELV $1166
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1167
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1167
+LABELV $1162
+LABELV $1147
+endproc CG_RegisterItemVisuals 28 12
+export CG_MapTorsoToWeaponFrame
+proc CG_MapTorsoToWeaponFrame 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $1170
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+ADDI4
+GEI4 $1170
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1232
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 6
+ADDI4
+RETI4
+ADDRGP4 $1169
+JUMPV
+LABELV $1170
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1172
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+ADDI4
+GEI4 $1172
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1176
+ADDP4
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $1169
+JUMPV
+LABELV $1172
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $1174
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 6
+ADDI4
+GEI4 $1174
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $1169
+JUMPV
+LABELV $1174
+CNSTI4 0
+RETI4
+LABELV $1169
+endproc CG_MapTorsoToWeaponFrame 24 0
+proc CG_CalculateWeaponPosition 56 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 0
+LEI4 $1186
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 2
+EQI4 $1186
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 3
+NEI4 $1180
+LABELV $1186
+ADDRGP4 $1176
+JUMPV
+LABELV $1180
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1187
+ADDRLP4 16
+ADDRGP4 cg+5415460
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+5415464
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 cg+5415468
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 cg+5415472
+INDIRI4
+ASGNI4
+ADDRGP4 $1188
+JUMPV
+LABELV $1187
+ADDRLP4 16
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+627496
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 cg+609304
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 cg+609308
+INDIRI4
+ASGNI4
+LABELV $1188
+ADDRGP4 cg+627492
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1199
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $1200
+JUMPV
+LABELV $1199
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $1200
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1000593162
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+627488
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+627488
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1000593162
+ADDRLP4 8
+INDIRF4
+ADDRGP4 cg+627488
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 150
+GEI4 $1205
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1125515264
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 $1206
+JUMPV
+LABELV $1205
+ADDRLP4 12
+INDIRI4
+CNSTI4 450
+GEI4 $1207
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 24
+INDIRF4
+MULF4
+CNSTI4 450
+ADDRLP4 12
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1133903872
+DIVF4
+ADDF4
+ASGNF4
+LABELV $1207
+LABELV $1206
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+CNSTF4 1109393408
+ADDF4
+ASGNF4
+CNSTF4 981668463
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1176
+endproc CG_CalculateWeaponPosition 56 4
+export CG_LightningBolt
+proc CG_LightningBolt 480 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 6
+EQI4 $1210
+ADDRGP4 $1209
+JUMPV
+LABELV $1210
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $1212
+ADDRGP4 $1209
+JUMPV
+LABELV $1212
+ADDRLP4 68
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+607196+140
+INDIRI4
+NEI4 $1214
+ADDRGP4 cg_trueLightning+8
+INDIRF4
+CNSTF4 0
+EQF4 $1214
+ADDRLP4 304
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 304
+INDIRI4
+NEI4 $1214
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 304
+INDIRI4
+NEI4 $1214
+ADDRGP4 cg+607188
+INDIRI4
+ADDRLP4 304
+INDIRI4
+NEI4 $1214
+ADDRGP4 cg_lightningAngleOriginStyle+12
+INDIRI4
+CNSTI4 2
+EQI4 $1214
+ADDRLP4 308
+CNSTI4 0
+ASGNI4
+LABELV $1222
+ADDRLP4 328
+ADDRLP4 308
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 324
+ADDRLP4 328
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 328
+INDIRI4
+ADDRGP4 cg+609780
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 324
+INDIRF4
+CNSTF4 1127481344
+LEF4 $1227
+ADDRLP4 324
+ADDRLP4 324
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1227
+ADDRLP4 324
+INDIRF4
+CNSTF4 3274964992
+GEF4 $1229
+ADDRLP4 324
+ADDRLP4 324
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $1229
+ADDRLP4 332
+ADDRLP4 308
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+ADDRLP4 312
+ADDP4
+ADDRLP4 332
+INDIRI4
+ADDRGP4 cg+609780
+ADDP4
+INDIRF4
+ADDRLP4 324
+INDIRF4
+CNSTF4 1065353216
+ADDRGP4 cg_trueLightning+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 312
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1233
+ADDRLP4 336
+ADDRLP4 308
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 312
+ADDP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ADDRLP4 336
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $1233
+ADDRLP4 308
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 312
+ADDP4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1235
+ADDRLP4 336
+ADDRLP4 308
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 312
+ADDP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ADDRLP4 336
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1235
+LABELV $1223
+ADDRLP4 308
+ADDRLP4 308
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 3
+LTI4 $1222
+ADDRLP4 312
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 324
+CNSTP4 0
+ASGNP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 cg_lightningAngleOriginStyle+12
+INDIRI4
+CNSTI4 0
+NEI4 $1237
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 332
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 13
+EQI4 $1242
+ADDRLP4 332
+INDIRI4
+CNSTI4 23
+NEI4 $1240
+LABELV $1242
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRGP4 $1215
+JUMPV
+LABELV $1240
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRGP4 $1215
+JUMPV
+LABELV $1237
+ADDRLP4 0
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRGP4 $1215
+JUMPV
+LABELV $1214
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 308
+CNSTP4 0
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 316
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 13
+EQI4 $1249
+ADDRLP4 316
+INDIRI4
+CNSTI4 23
+NEI4 $1247
+LABELV $1249
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRGP4 $1248
+JUMPV
+LABELV $1247
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+LABELV $1248
+LABELV $1215
+ADDRLP4 308
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 308
+INDIRF4
+ADDRLP4 256
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+ADDRLP4 256+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 256+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+CNSTF4 1145044992
+ASGNF4
+ADDRLP4 268
+ADDRLP4 0
+INDIRF4
+ADDRLP4 312
+INDIRF4
+ADDRLP4 256
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 268+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 312
+INDIRF4
+ADDRLP4 256+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 268+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1145044992
+ADDRLP4 256+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 316
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRLP4 268
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 Wolfcam_WeaponTrace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1264
+ADDRGP4 cg_debugLightningImpactDistance+12
+INDIRI4
+CNSTI4 0
+EQI4 $1264
+ADDRLP4 0
+ARGP4
+ADDRLP4 12+12
+ARGP4
+ADDRLP4 320
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRGP4 $1268
+ARGP4
+ADDRLP4 320
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1264
+ADDRGP4 cg_fxLightningGunImpactFps+8
+INDIRF4
+CNSTF4 0
+LEF4 $1270
+ADDRLP4 252
+CNSTF4 1148846080
+ADDRGP4 cg_fxLightningGunImpactFps+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1271
+JUMPV
+LABELV $1270
+ADDRLP4 252
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 300
+CNSTI4 0
+ASGNI4
+LABELV $1271
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1274
+ADDRLP4 320
+CNSTI4 0
+ASGNI4
+ADDRGP4 EffectScripts+1179792+16
+INDIRI4
+ADDRLP4 320
+INDIRI4
+EQI4 $1274
+ADDRLP4 12+52
+INDIRI4
+ADDRLP4 320
+INDIRI4
+LTI4 $1282
+ADDRLP4 12+52
+INDIRI4
+CNSTI4 64
+LTI4 $1274
+LABELV $1282
+ADDRLP4 12+44
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1274
+ADDRLP4 396
+ADDRGP4 cg
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1464
+ADDP4
+INDIRI4
+ADDRLP4 396
+INDIRI4
+NEI4 $1287
+ADDRFP4 0
+INDIRP4
+CNSTI4 1468
+ADDP4
+INDIRI4
+ADDRLP4 396
+INDIRI4
+NEI4 $1287
+ADDRFP4 0
+INDIRP4
+CNSTI4 1472
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1287
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $1283
+LABELV $1287
+ADDRFP4 0
+INDIRP4
+CNSTI4 1472
+ADDP4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 296
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1284
+JUMPV
+LABELV $1283
+ADDRLP4 296
+CNSTI4 0
+ASGNI4
+LABELV $1284
+ADDRLP4 384
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1472
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 384
+INDIRF4
+ADDRLP4 252
+INDIRF4
+GEF4 $1290
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $1290
+ADDRGP4 $1292
+JUMPV
+LABELV $1290
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1293
+ADDRFP4 0
+INDIRP4
+CNSTI4 1476
+ADDP4
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+LABELV $1293
+ADDRLP4 12+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1476
+ADDP4
+ARGP4
+ADDRLP4 400
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 388
+ADDRLP4 400
+INDIRF4
+ASGNF4
+ADDRLP4 364
+ADDRLP4 12+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1476
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 364+4
+ADDRLP4 12+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1480
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 364+8
+ADDRLP4 12+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 364
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 360
+ADDRLP4 388
+INDIRF4
+ADDRLP4 384
+INDIRF4
+ADDRLP4 252
+INDIRF4
+DIVF4
+DIVF4
+ASGNF4
+ADDRLP4 376
+ADDRGP4 cg+607152
+INDIRF4
+ASGNF4
+ADDRLP4 412
+ADDRFP4 0
+INDIRP4
+CNSTI4 1472
+ADDP4
+ASGNP4
+ADDRLP4 412
+INDIRP4
+ADDRLP4 412
+INDIRP4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 380
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1308
+JUMPV
+LABELV $1305
+ADDRLP4 360
+INDIRF4
+CNSTF4 0
+LEF4 $1310
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 1476
+ADDP4
+INDIRF4
+ADDRLP4 364
+INDIRF4
+ADDRLP4 360
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 324+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1480
+ADDP4
+INDIRF4
+ADDRLP4 364+4
+INDIRF4
+ADDRLP4 360
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 324+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+INDIRF4
+ADDRLP4 364+8
+INDIRF4
+ADDRLP4 360
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1311
+JUMPV
+LABELV $1310
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 1476
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1311
+ADDRLP4 348
+ADDRLP4 324
+INDIRB
+ASGNB 12
+ADDRLP4 336
+ADDRLP4 324
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 336+4
+ADDRLP4 324+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 336+8
+ADDRLP4 324+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 336
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 472
+CNSTF4 1145044992
+ASGNF4
+ADDRLP4 348
+ADDRLP4 0
+INDIRF4
+ADDRLP4 472
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 348+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 472
+INDIRF4
+ADDRLP4 336+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 348+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1145044992
+ADDRLP4 336+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 416
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 476
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 476
+INDIRP4
+ARGP4
+ADDRLP4 476
+INDIRP4
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 Wolfcam_WeaponTrace
+CALLV
+pop
+ADDRLP4 416+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1333
+ADDRLP4 416+52
+INDIRI4
+CNSTI4 0
+LTI4 $1328
+ADDRLP4 416+52
+INDIRI4
+CNSTI4 64
+GEI4 $1328
+LABELV $1333
+ADDRFP4 0
+INDIRP4
+CNSTI4 1476
+ADDP4
+ADDRLP4 324
+INDIRB
+ASGNB 12
+ADDRGP4 $1306
+JUMPV
+LABELV $1328
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 416+44
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1334
+ADDRGP4 ScriptVars+376
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1335
+JUMPV
+LABELV $1334
+ADDRLP4 416+44
+INDIRI4
+CNSTI4 1048576
+BANDI4
+CNSTI4 0
+EQI4 $1338
+ADDRGP4 ScriptVars+376
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1339
+JUMPV
+LABELV $1338
+ADDRLP4 416+44
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+EQI4 $1342
+ADDRGP4 ScriptVars+376
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1342
+ADDRLP4 416+44
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $1346
+ADDRGP4 ScriptVars+376
+CNSTI4 4
+ASGNI4
+LABELV $1346
+LABELV $1343
+LABELV $1339
+LABELV $1335
+ADDRGP4 ScriptVars+60
+ADDRLP4 416+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 416+12
+ARGP4
+ADDRLP4 240
+ARGP4
+ADDRGP4 VectorStartEndDir
+CALLV
+pop
+ADDRLP4 240
+ARGP4
+ADDRLP4 12+24
+ARGP4
+ADDRGP4 ScriptVars+84
+ARGP4
+ADDRGP4 VectorReflect
+CALLV
+pop
+ADDRGP4 ScriptVars+96
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+84
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 ScriptVars+96
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 cg+607152
+ADDRFP4 0
+INDIRP4
+CNSTI4 1472
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 EffectScripts+1179792+131096
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 cg+607152
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1476
+ADDP4
+ADDRLP4 324
+INDIRB
+ASGNB 12
+LABELV $1306
+ADDRLP4 416
+ADDRFP4 0
+INDIRP4
+CNSTI4 1472
+ADDP4
+ASGNP4
+ADDRLP4 416
+INDIRP4
+ADDRLP4 416
+INDIRP4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 380
+ADDRLP4 380
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1308
+ADDRGP4 cg+607152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1472
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 0
+GEF4 $1305
+ADDRLP4 420
+ADDRFP4 0
+INDIRP4
+CNSTI4 1472
+ADDP4
+ASGNP4
+ADDRLP4 420
+INDIRP4
+ADDRLP4 420
+INDIRP4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+607152
+ADDRLP4 376
+INDIRF4
+ASGNF4
+LABELV $1274
+LABELV $1292
+ADDRFP4 0
+INDIRP4
+CNSTI4 1464
+ADDP4
+ADDRGP4 cg
+INDIRI4
+ASGNI4
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1364
+ADDRLP4 12+52
+INDIRI4
+CNSTI4 0
+LTI4 $1370
+ADDRLP4 12+52
+INDIRI4
+CNSTI4 64
+LTI4 $1364
+LABELV $1370
+ADDRLP4 12+44
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 1468
+ADDP4
+ADDRGP4 cg
+INDIRI4
+ASGNI4
+LABELV $1364
+ADDRGP4 EffectScripts+1179792+12
+INDIRI4
+CNSTI4 0
+EQI4 $1371
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+72
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRLP4 12+12
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+96+4
+ADDRLP4 12+12+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+96+8
+ADDRLP4 12+12+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+644
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+680
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7772
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7788
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 EffectScripts+1179792+98328
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $1209
+JUMPV
+LABELV $1371
+ADDRLP4 68+84
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 68+68
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 68
+CNSTI4 11
+ASGNI4
+ADDRGP4 cg_lightningStyle+12
+INDIRI4
+CNSTI4 0
+LEI4 $1405
+ADDRGP4 cg_lightningStyle+12
+INDIRI4
+CNSTI4 6
+GEI4 $1405
+ADDRGP4 $1410
+ARGP4
+ADDRGP4 cg_lightningStyle+12
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 68+112
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRGP4 $1406
+JUMPV
+LABELV $1405
+ADDRLP4 68+112
+ADDRGP4 cgs+632912+420
+INDIRI4
+ASGNI4
+LABELV $1406
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 CG_IsFirstPersonView
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1415
+ADDRGP4 cg_lightningRenderStyle+12
+INDIRI4
+CNSTI4 1
+NEI4 $1415
+ADDRLP4 68+4
+CNSTI4 8
+ASGNI4
+LABELV $1415
+ADDRLP4 68+132
+ADDRGP4 cg_lightningSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 cg_lightningImpact+12
+INDIRI4
+CNSTI4 1
+NEI4 $1438
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1437
+LABELV $1438
+ADDRGP4 cg_lightningImpact+12
+INDIRI4
+CNSTI4 2
+NEI4 $1421
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1421
+ADDRLP4 12+52
+INDIRI4
+CNSTI4 0
+LTI4 $1439
+ADDRLP4 12+52
+INDIRI4
+CNSTI4 64
+LTI4 $1421
+LABELV $1439
+ADDRLP4 12+12
+INDIRF4
+ADDRLP4 268
+INDIRF4
+EQF4 $1421
+ADDRLP4 12+12+4
+INDIRF4
+ADDRLP4 268+4
+INDIRF4
+EQF4 $1421
+ADDRLP4 12+12+8
+INDIRF4
+ADDRLP4 268+8
+INDIRF4
+EQF4 $1421
+LABELV $1437
+ADDRLP4 12+44
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1421
+ADDRLP4 280
+ADDRLP4 12+12
+INDIRF4
+ADDRLP4 68+68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 280+4
+ADDRLP4 12+12+4
+INDIRF4
+ADDRLP4 68+68+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 280+8
+ADDRLP4 12+12+8
+INDIRF4
+ADDRLP4 68+68+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 280
+ARGP4
+ADDRLP4 380
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 340
+ADDRLP4 380
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 68
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 68+8
+ADDRGP4 cgs+632912+492344
+INDIRI4
+ASGNI4
+ADDRLP4 68+68
+ADDRLP4 12+12
+INDIRF4
+ADDRLP4 280
+INDIRF4
+ADDRGP4 cg_lightningImpactProject+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+68+4
+ADDRLP4 12+12+4
+INDIRF4
+ADDRLP4 280+4
+INDIRF4
+ADDRGP4 cg_lightningImpactProject+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+68+8
+ADDRLP4 12+12+8
+INDIRF4
+ADDRLP4 280+8
+INDIRF4
+ADDRGP4 cg_lightningImpactProject+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 384
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 384
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 388
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 328+4
+ADDRLP4 388
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 392
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 328+8
+ADDRLP4 392
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 328
+ARGP4
+ADDRLP4 68+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 344
+ADDRGP4 cg_lightningImpactSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 340
+INDIRF4
+ADDRGP4 cg_lightningImpactCap+8
+INDIRF4
+GEF4 $1474
+ADDRLP4 340
+INDIRF4
+ADDRGP4 cg_lightningImpactCapMin+8
+INDIRF4
+GEF4 $1477
+ADDRLP4 340
+ADDRGP4 cg_lightningImpactCapMin+8
+INDIRF4
+ASGNF4
+LABELV $1477
+ADDRLP4 68+8
+INDIRI4
+ARGI4
+ADDRLP4 368
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 348
+INDIRF4
+ARGF4
+ADDRGP4 cg_lightningImpactCap+8
+INDIRF4
+ARGF4
+ADDRLP4 396
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 360
+ADDRLP4 396
+INDIRF4
+ASGNF4
+ADDRLP4 360
+INDIRF4
+ARGF4
+ADDRLP4 400
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 364
+ADDRLP4 400
+INDIRF4
+ADDRLP4 340
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 344
+ADDRLP4 344
+INDIRF4
+ADDRLP4 364
+INDIRF4
+ADDRLP4 348
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $1474
+ADDRLP4 12+52
+INDIRI4
+CNSTI4 0
+LTI4 $1483
+ADDRLP4 12+52
+INDIRI4
+CNSTI4 64
+GEI4 $1483
+CNSTI4 4524
+ADDRLP4 12+52
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 396
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 400
+CNSTI4 0
+ASGNI4
+ADDRLP4 396
+INDIRI4
+ADDRLP4 400
+INDIRI4
+EQI4 $1483
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 400
+INDIRI4
+NEI4 $1483
+ADDRGP4 cg+607188
+INDIRI4
+ADDRLP4 400
+INDIRI4
+NEI4 $1483
+ADDRGP4 cg_lightningImpactOthersSize+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1491
+ADDRLP4 344
+ADDRGP4 cg_lightningImpactOthersSize+8
+INDIRF4
+ASGNF4
+LABELV $1491
+LABELV $1483
+ADDRLP4 68
+ARGP4
+ADDRLP4 344
+INDIRF4
+ARGF4
+ADDRGP4 CG_ScaleModel
+CALLV
+pop
+ADDRLP4 68
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1421
+LABELV $1209
+endproc CG_LightningBolt 480 28
+export CG_SpawnRailTrail
+proc CG_SpawnRailTrail 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $1496
+ADDRGP4 $1495
+JUMPV
+LABELV $1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1498
+ADDRGP4 $1495
+JUMPV
+LABELV $1498
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1056
+ADDP4
+ARGP4
+ADDRGP4 CG_RailTrail
+CALLV
+pop
+LABELV $1495
+endproc CG_SpawnRailTrail 8 12
+export CG_MachinegunSpinAngle
+proc CG_MachinegunSpinAngle 44 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1503
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+INDIRF4
+CNSTF4 1063675494
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1504
+JUMPV
+LABELV $1503
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+LEI4 $1505
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+LABELV $1505
+ADDRLP4 8
+CNSTF4 1056964608
+CNSTI4 1000
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+CNSTF4 1063675494
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1504
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $1510
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1511
+JUMPV
+LABELV $1510
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $1511
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1507
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1514
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1515
+JUMPV
+LABELV $1514
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $1515
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $1516
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1516
+ADDRGP4 $1518
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $1516
+LABELV $1507
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $1501
+endproc CG_MachinegunSpinAngle 44 16
+export CG_AddWeaponWithPowerups
+proc CG_AddWeaponWithPowerups 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_INVIS
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1520
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492280
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 $1521
+JUMPV
+LABELV $1520
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1524
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492292
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1524
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_QUAD
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1528
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+632912+492276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1528
+LABELV $1521
+LABELV $1519
+endproc CG_AddWeaponWithPowerups 0 4
+lit
+align 4
+LABELV $1781
+byte 4 0
+address cg_firstPersonShaderWeaponGauntlet
+address cg_firstPersonShaderWeaponMachineGun
+address cg_firstPersonShaderWeaponShotgun
+address cg_firstPersonShaderWeaponGrenadeLauncher
+address cg_firstPersonShaderWeaponRocketLauncher
+address cg_firstPersonShaderWeaponLightningGun
+address cg_firstPersonShaderWeaponRailGun
+address cg_firstPersonShaderWeaponPlasmaGun
+address cg_firstPersonShaderWeaponBFG
+address cg_firstPersonShaderWeaponGrapplingHook
+address cg_firstPersonShaderWeaponNailGun
+address cg_firstPersonShaderWeaponProximityLauncher
+address cg_firstPersonShaderWeaponChainGun
+address cg_firstPersonShaderWeaponHeavyMachineGun
+skip 4
+align 4
+LABELV $1785
+byte 4 0
+address cg_thirdPersonShaderWeaponGauntlet
+address cg_thirdPersonShaderWeaponMachineGun
+address cg_thirdPersonShaderWeaponShotgun
+address cg_thirdPersonShaderWeaponGrenadeLauncher
+address cg_thirdPersonShaderWeaponRocketLauncher
+address cg_thirdPersonShaderWeaponLightningGun
+address cg_thirdPersonShaderWeaponRailGun
+address cg_thirdPersonShaderWeaponPlasmaGun
+address cg_thirdPersonShaderWeaponBFG
+address cg_thirdPersonShaderWeaponGrapplingHook
+address cg_thirdPersonShaderWeaponNailGun
+address cg_thirdPersonShaderWeaponProximityLauncher
+address cg_thirdPersonShaderWeaponChainGun
+address cg_thirdPersonShaderWeaponHeavyMachineGun
+skip 4
+export CG_AddPlayerWeapon
+code
+proc CG_AddPlayerWeapon 684 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 556
+CNSTI4 0
+ASGNI4
+ADDRLP4 352
+CNSTI4 4524
+ADDRFP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 172
+ADDRFP4 8
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+LEI4 $1536
+ADDRLP4 172
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $1534
+LABELV $1536
+ADDRGP4 $1532
+JUMPV
+LABELV $1534
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 12
+NEI4 $1537
+ADDRGP4 cgs+1960920
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $1537
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $1537
+ADDRLP4 172
+INDIRI4
+CNSTI4 8
+EQI4 $1537
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1537
+ADDRGP4 $1532
+JUMPV
+LABELV $1537
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 348
+CNSTI4 132
+ADDRLP4 172
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1544
+ADDRGP4 cg_railUseOwnColors+12
+INDIRI4
+CNSTI4 0
+EQI4 $1546
+CNSTI4 4524
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 600
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 600
+INDIRI4
+CNSTI4 0
+EQI4 $1546
+ADDRLP4 608
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+ASGNP4
+ADDRLP4 564
+ADDRLP4 608
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 576
+ADDRLP4 352
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 608
+INDIRP4
+ADDRGP4 cg+3196860
+INDIRB
+ASGNB 12
+ADDRLP4 352
+INDIRP4
+CNSTI4 216
+ADDP4
+ADDRGP4 cg+3196872
+INDIRB
+ASGNB 12
+ADDRLP4 556
+CNSTI4 1
+ASGNI4
+LABELV $1546
+ADDRGP4 cg+607196+144
+INDIRI4
+CNSTI4 7
+NEI4 $1553
+ADDRGP4 cg+607196+148
+INDIRI4
+CNSTI4 3
+NEI4 $1553
+ADDRLP4 560
+ADDRGP4 cg+607196+44
+INDIRI4
+CVIF4 4
+CNSTF4 1153138688
+DIVF4
+ASGNF4
+ADDRGP4 cg+607196+44
+INDIRI4
+CNSTI4 60
+LEI4 $1561
+ADDRLP4 608
+CNSTF4 1117782016
+CNSTF4 1065353216
+ADDRLP4 560
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 612
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+LTF4 $1567
+ADDRLP4 604
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1568
+JUMPV
+LABELV $1567
+ADDRLP4 604
+ADDRLP4 608
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1568
+ADDRLP4 0+116
+ADDRLP4 604
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 620
+CNSTF4 1117782016
+CNSTF4 1065353216
+ADDRLP4 560
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 352
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 624
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+LTF4 $1572
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1573
+JUMPV
+LABELV $1572
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1573
+ADDRLP4 0+116+1
+ADDRLP4 616
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 632
+CNSTF4 1117782016
+CNSTF4 1065353216
+ADDRLP4 560
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 352
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 636
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+LTF4 $1577
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1578
+JUMPV
+LABELV $1577
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1578
+ADDRLP4 0+116+2
+ADDRLP4 628
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1545
+JUMPV
+LABELV $1561
+ADDRLP4 608
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 612
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+LTF4 $1583
+ADDRLP4 604
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1584
+JUMPV
+LABELV $1583
+ADDRLP4 604
+ADDRLP4 608
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1584
+ADDRLP4 0+116
+ADDRLP4 604
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 620
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 624
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+LTF4 $1588
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1589
+JUMPV
+LABELV $1588
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1589
+ADDRLP4 0+116+1
+ADDRLP4 616
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 632
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 636
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+LTF4 $1593
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1594
+JUMPV
+LABELV $1593
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1594
+ADDRLP4 0+116+2
+ADDRLP4 628
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1545
+JUMPV
+LABELV $1553
+ADDRLP4 608
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 612
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+LTF4 $1599
+ADDRLP4 604
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1600
+JUMPV
+LABELV $1599
+ADDRLP4 604
+ADDRLP4 608
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1600
+ADDRLP4 0+116
+ADDRLP4 604
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 620
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 624
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+LTF4 $1604
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1605
+JUMPV
+LABELV $1604
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1605
+ADDRLP4 0+116+1
+ADDRLP4 616
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 632
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 636
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+LTF4 $1609
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1610
+JUMPV
+LABELV $1609
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1610
+ADDRLP4 0+116+2
+ADDRLP4 628
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1545
+JUMPV
+LABELV $1544
+ADDRLP4 172
+INDIRI4
+CNSTI4 7
+NEI4 $1613
+ADDRGP4 cg_railUseOwnColors+12
+INDIRI4
+CNSTI4 0
+EQI4 $1615
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 608
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 608
+INDIRI4
+CNSTI4 0
+EQI4 $1615
+ADDRLP4 616
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+ASGNP4
+ADDRLP4 564
+ADDRLP4 616
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 576
+ADDRLP4 352
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 616
+INDIRP4
+ADDRGP4 cg+3196860
+INDIRB
+ASGNB 12
+ADDRLP4 352
+INDIRP4
+CNSTI4 216
+ADDP4
+ADDRGP4 cg+3196872
+INDIRB
+ASGNB 12
+ADDRLP4 556
+CNSTI4 1
+ASGNI4
+LABELV $1615
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 612
+ADDRGP4 CG_IsTeammate
+CALLI4
+ASGNI4
+ADDRLP4 600
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 616
+ADDRGP4 CG_IsEnemy
+CALLI4
+ASGNI4
+ADDRLP4 604
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GEI4 $1620
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 620
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+CNSTI4 0
+NEI4 $1623
+ADDRGP4 cg_enemyRailItemColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1625
+ADDRLP4 0+116
+ARGP4
+ADDRGP4 cg_enemyRailItemColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1621
+JUMPV
+LABELV $1625
+ADDRLP4 628
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 632
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 628
+INDIRF4
+ADDRLP4 632
+INDIRF4
+LTF4 $1633
+ADDRLP4 624
+ADDRLP4 628
+INDIRF4
+ADDRLP4 632
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1634
+JUMPV
+LABELV $1633
+ADDRLP4 624
+ADDRLP4 628
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1634
+ADDRLP4 0+116
+ADDRLP4 624
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 640
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 644
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+LTF4 $1638
+ADDRLP4 636
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1639
+JUMPV
+LABELV $1638
+ADDRLP4 636
+ADDRLP4 640
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1639
+ADDRLP4 0+116+1
+ADDRLP4 636
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 652
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 656
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 652
+INDIRF4
+ADDRLP4 656
+INDIRF4
+LTF4 $1643
+ADDRLP4 648
+ADDRLP4 652
+INDIRF4
+ADDRLP4 656
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1644
+JUMPV
+LABELV $1643
+ADDRLP4 648
+ADDRLP4 652
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1644
+ADDRLP4 0+116+2
+ADDRLP4 648
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1621
+JUMPV
+LABELV $1623
+ADDRLP4 628
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 632
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 628
+INDIRF4
+ADDRLP4 632
+INDIRF4
+LTF4 $1649
+ADDRLP4 624
+ADDRLP4 628
+INDIRF4
+ADDRLP4 632
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1650
+JUMPV
+LABELV $1649
+ADDRLP4 624
+ADDRLP4 628
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1650
+ADDRLP4 0+116
+ADDRLP4 624
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 640
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 644
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+LTF4 $1654
+ADDRLP4 636
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1655
+JUMPV
+LABELV $1654
+ADDRLP4 636
+ADDRLP4 640
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1655
+ADDRLP4 0+116+1
+ADDRLP4 636
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 652
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 656
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 652
+INDIRF4
+ADDRLP4 656
+INDIRF4
+LTF4 $1659
+ADDRLP4 648
+ADDRLP4 652
+INDIRF4
+ADDRLP4 656
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1660
+JUMPV
+LABELV $1659
+ADDRLP4 648
+ADDRLP4 652
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1660
+ADDRLP4 0+116+2
+ADDRLP4 648
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1621
+JUMPV
+LABELV $1620
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 620
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 624
+CNSTI4 0
+ASGNI4
+ADDRLP4 620
+INDIRI4
+ADDRLP4 624
+INDIRI4
+NEI4 $1663
+ADDRLP4 600
+INDIRI4
+ADDRLP4 624
+INDIRI4
+EQI4 $1663
+ADDRGP4 cg_teamRailItemColorTeam+12
+INDIRI4
+CNSTI4 0
+EQI4 $1665
+ADDRLP4 352
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1668
+ADDRLP4 0+116
+ARGP4
+ADDRGP4 cg_weaponRedTeamColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 $1669
+JUMPV
+LABELV $1668
+ADDRLP4 0+116
+ARGP4
+ADDRGP4 cg_weaponBlueTeamColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+LABELV $1669
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1664
+JUMPV
+LABELV $1665
+ADDRGP4 cg_teamRailItemColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1674
+ADDRLP4 0+116
+ARGP4
+ADDRGP4 cg_teamRailItemColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1664
+JUMPV
+LABELV $1674
+ADDRLP4 632
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 636
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+LTF4 $1682
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1683
+JUMPV
+LABELV $1682
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1683
+ADDRLP4 0+116
+ADDRLP4 628
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 644
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 648
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 644
+INDIRF4
+ADDRLP4 648
+INDIRF4
+LTF4 $1687
+ADDRLP4 640
+ADDRLP4 644
+INDIRF4
+ADDRLP4 648
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1688
+JUMPV
+LABELV $1687
+ADDRLP4 640
+ADDRLP4 644
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1688
+ADDRLP4 0+116+1
+ADDRLP4 640
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 656
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 660
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 656
+INDIRF4
+ADDRLP4 660
+INDIRF4
+LTF4 $1692
+ADDRLP4 652
+ADDRLP4 656
+INDIRF4
+ADDRLP4 660
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1693
+JUMPV
+LABELV $1692
+ADDRLP4 652
+ADDRLP4 656
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1693
+ADDRLP4 0+116+2
+ADDRLP4 652
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1664
+JUMPV
+LABELV $1663
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 628
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 632
+CNSTI4 0
+ASGNI4
+ADDRLP4 628
+INDIRI4
+ADDRLP4 632
+INDIRI4
+NEI4 $1696
+ADDRLP4 604
+INDIRI4
+ADDRLP4 632
+INDIRI4
+EQI4 $1696
+ADDRGP4 cg_enemyRailItemColorTeam+12
+INDIRI4
+CNSTI4 0
+EQI4 $1698
+ADDRLP4 352
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1701
+ADDRLP4 0+116
+ARGP4
+ADDRGP4 cg_weaponRedTeamColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 $1702
+JUMPV
+LABELV $1701
+ADDRLP4 0+116
+ARGP4
+ADDRGP4 cg_weaponBlueTeamColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+LABELV $1702
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1697
+JUMPV
+LABELV $1698
+ADDRGP4 cg_enemyRailItemColor+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1707
+ADDRLP4 0+116
+ARGP4
+ADDRGP4 cg_enemyRailItemColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1697
+JUMPV
+LABELV $1707
+ADDRLP4 640
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 644
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+LTF4 $1715
+ADDRLP4 636
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1716
+JUMPV
+LABELV $1715
+ADDRLP4 636
+ADDRLP4 640
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1716
+ADDRLP4 0+116
+ADDRLP4 636
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 652
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 656
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 652
+INDIRF4
+ADDRLP4 656
+INDIRF4
+LTF4 $1720
+ADDRLP4 648
+ADDRLP4 652
+INDIRF4
+ADDRLP4 656
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1721
+JUMPV
+LABELV $1720
+ADDRLP4 648
+ADDRLP4 652
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1721
+ADDRLP4 0+116+1
+ADDRLP4 648
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 664
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 668
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 664
+INDIRF4
+ADDRLP4 668
+INDIRF4
+LTF4 $1725
+ADDRLP4 660
+ADDRLP4 664
+INDIRF4
+ADDRLP4 668
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1726
+JUMPV
+LABELV $1725
+ADDRLP4 660
+ADDRLP4 664
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1726
+ADDRLP4 0+116+2
+ADDRLP4 660
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1697
+JUMPV
+LABELV $1696
+ADDRLP4 640
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 644
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+LTF4 $1731
+ADDRLP4 636
+ADDRLP4 640
+INDIRF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1732
+JUMPV
+LABELV $1731
+ADDRLP4 636
+ADDRLP4 640
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1732
+ADDRLP4 0+116
+ADDRLP4 636
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 652
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 656
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 652
+INDIRF4
+ADDRLP4 656
+INDIRF4
+LTF4 $1736
+ADDRLP4 648
+ADDRLP4 652
+INDIRF4
+ADDRLP4 656
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1737
+JUMPV
+LABELV $1736
+ADDRLP4 648
+ADDRLP4 652
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1737
+ADDRLP4 0+116+1
+ADDRLP4 648
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 664
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 668
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 664
+INDIRF4
+ADDRLP4 668
+INDIRF4
+LTF4 $1741
+ADDRLP4 660
+ADDRLP4 664
+INDIRF4
+ADDRLP4 668
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1742
+JUMPV
+LABELV $1741
+ADDRLP4 660
+ADDRLP4 664
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1742
+ADDRLP4 0+116+2
+ADDRLP4 660
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1697
+LABELV $1664
+LABELV $1621
+ADDRLP4 560
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 1088
+ADDP4
+INDIRI4
+CNSTI4 1460
+ADDI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 560
+INDIRF4
+CNSTF4 0
+GEF4 $1746
+ADDRLP4 560
+CNSTF4 1065353216
+ADDRLP4 560
+INDIRF4
+CNSTF4 3300622336
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 624
+ADDRLP4 0+116
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1050723484
+ADDRLP4 560
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 628
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+LTF4 $1750
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1751
+JUMPV
+LABELV $1750
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1751
+ADDRLP4 0+116
+ADDRLP4 620
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 636
+ADDRLP4 0+116+1
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1050723484
+ADDRLP4 560
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 640
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+LTF4 $1755
+ADDRLP4 632
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1756
+JUMPV
+LABELV $1755
+ADDRLP4 632
+ADDRLP4 636
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1756
+ADDRLP4 0+116+1
+ADDRLP4 632
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 648
+ADDRLP4 0+116+2
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1050723484
+ADDRLP4 560
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 652
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+LTF4 $1760
+ADDRLP4 644
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1761
+JUMPV
+LABELV $1760
+ADDRLP4 644
+ADDRLP4 648
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1761
+ADDRLP4 0+116+2
+ADDRLP4 644
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $1746
+LABELV $1613
+LABELV $1545
+ADDRLP4 0+8
+ADDRLP4 348
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $1763
+LABELV $1763
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1766
+ADDRLP4 600
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 600
+INDIRI4
+EQI4 $1768
+ADDRLP4 348
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ADDRLP4 600
+INDIRI4
+EQI4 $1768
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 348
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddLoopingSound
+CALLV
+pop
+ADDRGP4 $1769
+JUMPV
+LABELV $1770
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 348
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddLoopingSound
+CALLV
+pop
+ADDRGP4 $1769
+JUMPV
+LABELV $1768
+ADDRLP4 348
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1772
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 348
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddLoopingSound
+CALLV
+pop
+LABELV $1772
+LABELV $1769
+LABELV $1766
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1774
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1775
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 608
+ADDRGP4 CG_IsFirstPersonView
+CALLI4
+ASGNI4
+ADDRLP4 608
+INDIRI4
+CNSTI4 0
+EQI4 $1775
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg_gunSize+8
+INDIRF4
+ARGF4
+ADDRGP4 CG_ScaleModel
+CALLV
+pop
+ADDRGP4 $1776
+JUMPV
+LABELV $1775
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg_gunSizeThirdPerson+8
+INDIRF4
+ARGF4
+ADDRGP4 CG_ScaleModel
+CALLV
+pop
+LABELV $1776
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1779
+ADDRLP4 612
+ADDRGP4 $1781
+INDIRB
+ASGNB 64
+ADDRLP4 676
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 612
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 676
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1780
+ADDRLP4 676
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1780
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 612
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 680
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0+112
+ADDRLP4 680
+INDIRI4
+ASGNI4
+ADDRGP4 $1780
+JUMPV
+LABELV $1779
+ADDRLP4 612
+ADDRGP4 $1785
+INDIRB
+ASGNB 64
+ADDRLP4 676
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 612
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 676
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1786
+ADDRLP4 676
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1786
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 612
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 680
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0+112
+ADDRLP4 680
+INDIRI4
+ASGNI4
+LABELV $1786
+LABELV $1780
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+EQI4 $1789
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1792
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 2
+LEI4 $1792
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+1317376
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1792
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1805
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $1805
+ADDRGP4 cg_racePlayerShader+12
+INDIRI4
+CNSTI4 0
+EQI4 $1805
+CNSTI4 4524
+ADDRFP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 612
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 612
+INDIRI4
+CNSTI4 0
+EQI4 $1815
+ADDRGP4 cg_racePlayerShader+12
+INDIRI4
+CNSTI4 2
+EQI4 $1815
+ADDRGP4 cg_racePlayerShader+12
+INDIRI4
+CNSTI4 3
+NEI4 $1809
+LABELV $1815
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+1317380
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1809
+LABELV $1805
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddWeaponWithPowerups
+CALLV
+pop
+LABELV $1789
+ADDRLP4 348
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1826
+ADDRLP4 356
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 356+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 356+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 356+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 356+8
+ADDRLP4 348
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 528+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 528
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 612
+ADDRGP4 CG_MachinegunSpinAngle
+CALLF4
+ASGNF4
+ADDRLP4 528+8
+ADDRLP4 612
+INDIRF4
+ASGNF4
+ADDRLP4 528
+ARGP4
+ADDRLP4 356+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 356
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 348
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1835
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1836
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 620
+ADDRGP4 CG_IsFirstPersonView
+CALLI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+CNSTI4 0
+EQI4 $1836
+ADDRLP4 356
+ARGP4
+ADDRGP4 cg_gunSize+8
+INDIRF4
+ARGF4
+ADDRGP4 CG_ScaleModel
+CALLV
+pop
+ADDRGP4 $1837
+JUMPV
+LABELV $1836
+ADDRLP4 356
+ARGP4
+ADDRGP4 cg_gunSizeThirdPerson+8
+INDIRF4
+ARGF4
+ADDRGP4 CG_ScaleModel
+CALLV
+pop
+LABELV $1837
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1840
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 2
+LEI4 $1840
+ADDRLP4 356+112
+ADDRGP4 cgs+632912+1317376
+INDIRI4
+ASGNI4
+ADDRLP4 356+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 356+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 356+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 356+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1840
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1853
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $1853
+ADDRGP4 cg_racePlayerShader+12
+INDIRI4
+CNSTI4 0
+EQI4 $1853
+CNSTI4 4524
+ADDRFP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 624
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 0
+EQI4 $1863
+ADDRGP4 cg_racePlayerShader+12
+INDIRI4
+CNSTI4 2
+EQI4 $1863
+ADDRGP4 cg_racePlayerShader+12
+INDIRI4
+CNSTI4 3
+NEI4 $1857
+LABELV $1863
+ADDRLP4 0+112
+ADDRGP4 cgs+632912+1317380
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1857
+LABELV $1853
+ADDRLP4 356
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddWeaponWithPowerups
+CALLV
+pop
+LABELV $1826
+ADDRLP4 612
+ADDRFP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+ASGNP4
+ADDRLP4 616
+ADDRGP4 cg_entities
+ASGNP4
+ADDRLP4 540
+CNSTI4 1496
+ADDRLP4 612
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 616
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 540
+INDIRP4
+CVPU4 4
+ADDRLP4 616
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1496
+DIVI4
+ADDRLP4 612
+INDIRP4
+INDIRI4
+EQI4 $1874
+ADDRLP4 540
+ADDRFP4 8
+INDIRP4
+ASGNP4
+LABELV $1874
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $1876
+ADDRFP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1876
+LABELV $1876
+ADDRLP4 172
+INDIRI4
+CNSTI4 6
+EQI4 $1882
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+EQI4 $1882
+ADDRLP4 172
+INDIRI4
+CNSTI4 10
+NEI4 $1879
+LABELV $1882
+ADDRLP4 540
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1879
+ADDRGP4 $1880
+JUMPV
+LABELV $1879
+ADDRLP4 172
+INDIRI4
+CNSTI4 6
+NEI4 $1883
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1883
+LABELV $1883
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 540
+INDIRP4
+CNSTI4 1088
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 20
+LEI4 $1885
+ADDRLP4 540
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1885
+ADDRLP4 556
+INDIRI4
+CNSTI4 0
+EQI4 $1532
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 564
+INDIRB
+ASGNB 12
+ADDRLP4 352
+INDIRP4
+CNSTI4 216
+ADDP4
+ADDRLP4 576
+INDIRB
+ASGNB 12
+ADDRGP4 $1532
+JUMPV
+LABELV $1885
+LABELV $1880
+ADDRLP4 176
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 176+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 176+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 176+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176+8
+ADDRLP4 348
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176+8
+INDIRI4
+CNSTI4 0
+NEI4 $1894
+LABELV $1894
+ADDRLP4 528+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 528
+CNSTF4 0
+ASGNF4
+ADDRLP4 624
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 528+8
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 624
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 528
+ARGP4
+ADDRLP4 176+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 172
+INDIRI4
+CNSTI4 7
+NEI4 $1900
+ADDRGP4 cg_railUseOwnColors+12
+INDIRI4
+CNSTI4 0
+EQI4 $1902
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 628
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+CNSTI4 0
+EQI4 $1902
+ADDRLP4 636
+CNSTF4 1132396544
+ADDRGP4 cg+3196860
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 640
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+LTF4 $1908
+ADDRLP4 632
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1909
+JUMPV
+LABELV $1908
+ADDRLP4 632
+ADDRLP4 636
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1909
+ADDRLP4 176+116
+ADDRLP4 632
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 648
+CNSTF4 1132396544
+ADDRGP4 cg+3196860+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 652
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+LTF4 $1915
+ADDRLP4 644
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1916
+JUMPV
+LABELV $1915
+ADDRLP4 644
+ADDRLP4 648
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1916
+ADDRLP4 176+116+1
+ADDRLP4 644
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 660
+CNSTF4 1132396544
+ADDRGP4 cg+3196860+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 664
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 660
+INDIRF4
+ADDRLP4 664
+INDIRF4
+LTF4 $1922
+ADDRLP4 656
+ADDRLP4 660
+INDIRF4
+ADDRLP4 664
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1923
+JUMPV
+LABELV $1922
+ADDRLP4 656
+ADDRLP4 660
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1923
+ADDRLP4 176+116+2
+ADDRLP4 656
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $1903
+JUMPV
+LABELV $1902
+ADDRLP4 636
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 640
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+LTF4 $1926
+ADDRLP4 632
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1927
+JUMPV
+LABELV $1926
+ADDRLP4 632
+ADDRLP4 636
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1927
+ADDRLP4 176+116
+ADDRLP4 632
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 648
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 652
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+LTF4 $1931
+ADDRLP4 644
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1932
+JUMPV
+LABELV $1931
+ADDRLP4 644
+ADDRLP4 648
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1932
+ADDRLP4 176+116+1
+ADDRLP4 644
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 660
+CNSTF4 1132396544
+ADDRLP4 352
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 664
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 660
+INDIRF4
+ADDRLP4 664
+INDIRF4
+LTF4 $1936
+ADDRLP4 656
+ADDRLP4 660
+INDIRF4
+ADDRLP4 664
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1937
+JUMPV
+LABELV $1936
+ADDRLP4 656
+ADDRLP4 660
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1937
+ADDRLP4 176+116+2
+ADDRLP4 656
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $1903
+LABELV $1900
+ADDRGP4 $1938
+JUMPV
+ADDRGP4 $1939
+JUMPV
+LABELV $1938
+ADDRLP4 544
+ADDRLP4 348
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 544+4
+ADDRLP4 348
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 544+8
+ADDRLP4 348
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 632
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 588
+ADDRLP4 632
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 300
+ADDI4
+CVIF4 4
+ASGNF4
+LABELV $1939
+ADDRLP4 176
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 348
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1942
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+607704
+CVPU4 4
+NEU4 $1943
+ADDRGP4 cg+607188
+INDIRI4
+CNSTI4 0
+NEI4 $1943
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1943
+ADDRGP4 $1944
+JUMPV
+LABELV $1943
+CNSTI4 196632
+ADDRLP4 172
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1947
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRLP4 176+68
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+644
+ADDRLP4 176+68
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7772
+ADDRFP4 8
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRFP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7788
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRFP4 8
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 196632
+ADDRLP4 172
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+32792
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+LABELV $1947
+LABELV $1944
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+607704
+CVPU4 4
+NEU4 $1963
+ADDRGP4 cg_muzzleFlash+12
+INDIRI4
+CNSTI4 0
+NEI4 $1963
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1963
+ADDRGP4 $1964
+JUMPV
+LABELV $1963
+ADDRLP4 176+8
+INDIRI4
+CNSTI4 0
+EQI4 $1967
+ADDRLP4 176
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $1967
+LABELV $1964
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1978
+ADDRLP4 628
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+607188
+INDIRI4
+ADDRLP4 628
+INDIRI4
+NEI4 $1978
+ADDRLP4 632
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+ADDRGP4 cg+607196+140
+INDIRI4
+NEI4 $1978
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 628
+INDIRI4
+EQI4 $1970
+ADDRLP4 632
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+EQI4 $1970
+LABELV $1978
+ADDRLP4 636
+ADDRGP4 wolfcam_following
+INDIRI4
+ASGNI4
+ADDRLP4 640
+CNSTI4 0
+ASGNI4
+ADDRLP4 636
+INDIRI4
+ADDRLP4 640
+INDIRI4
+EQI4 $1983
+ADDRLP4 636
+INDIRI4
+ADDRLP4 640
+INDIRI4
+EQI4 $1984
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $1983
+LABELV $1984
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1971
+LABELV $1983
+ADDRLP4 540
+INDIRP4
+ARGP4
+ADDRLP4 176+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 176+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRLP4 644
+CNSTF4 0
+ASGNF4
+ADDRLP4 544
+INDIRF4
+ADDRLP4 644
+INDIRF4
+NEF4 $1993
+ADDRLP4 544+4
+INDIRF4
+ADDRLP4 644
+INDIRF4
+NEF4 $1993
+ADDRLP4 544+8
+INDIRF4
+ADDRLP4 644
+INDIRF4
+EQF4 $1971
+LABELV $1993
+CNSTI4 196632
+ADDRLP4 172
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1971
+ADDRLP4 176+68
+ARGP4
+ADDRLP4 588
+INDIRF4
+ARGF4
+ADDRLP4 544
+INDIRF4
+ARGF4
+ADDRLP4 544+4
+INDIRF4
+ARGF4
+ADDRLP4 544+8
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1970
+LABELV $1971
+ADDRLP4 556
+INDIRI4
+CNSTI4 0
+EQI4 $1997
+ADDRLP4 352
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 564
+INDIRB
+ASGNB 12
+ADDRLP4 352
+INDIRP4
+CNSTI4 216
+ADDP4
+ADDRLP4 576
+INDIRB
+ASGNB 12
+LABELV $1997
+LABELV $1532
+endproc CG_AddPlayerWeapon 684 20
+export CG_AddViewWeapon
+proc CG_AddViewWeapon 228 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2000
+ADDRGP4 $1999
+JUMPV
+LABELV $2000
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2002
+ADDRGP4 $1999
+JUMPV
+LABELV $2002
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 208
+ADDRGP4 CG_IsFirstPersonView
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+NEI4 $2004
+ADDRGP4 $1999
+JUMPV
+LABELV $2004
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2006
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRGP4 cg+4
+INDIRI4
+NEI4 $2006
+ADDRGP4 $1999
+JUMPV
+LABELV $2006
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 0
+NEI4 $2011
+ADDRGP4 cg+607196+104
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1999
+ADDRLP4 212
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 224
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 212
+ADDRLP4 212
+INDIRF4
+ADDRLP4 224
+INDIRF4
+ADDRGP4 cg+609412+36+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 212+4
+ADDRLP4 212+4
+INDIRF4
+ADDRLP4 224
+INDIRF4
+ADDRGP4 cg+609412+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 212+8
+ADDRLP4 212+8
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+609412+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRLP4 212
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+ADDRGP4 $1999
+JUMPV
+LABELV $2011
+ADDRGP4 cg+627744
+INDIRI4
+CNSTI4 0
+EQI4 $2035
+ADDRGP4 $1999
+JUMPV
+LABELV $2035
+ADDRLP4 172
+ADDRGP4 cg_gun_x+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $2039
+ADDRLP4 172
+ADDRLP4 172
+INDIRF4
+CNSTF4 1091462758
+ADDF4
+ASGNF4
+LABELV $2039
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $2041
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $2041
+ADDRLP4 184
+ADDRGP4 cg+6747460
+INDIRI4
+ASGNI4
+ADDRGP4 $2042
+JUMPV
+LABELV $2041
+ADDRLP4 184
+ADDRGP4 cg_fov+12
+INDIRI4
+ASGNI4
+LABELV $2042
+ADDRLP4 184
+INDIRI4
+CNSTI4 90
+LEI4 $2047
+ADDRLP4 176
+CNSTF4 3192704205
+ADDRLP4 184
+INDIRI4
+CNSTI4 90
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 $2048
+JUMPV
+LABELV $2047
+ADDRLP4 176
+CNSTF4 0
+ASGNF4
+LABELV $2048
+ADDRLP4 180
+ADDRGP4 cg+607704
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 200
+CNSTI4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRGP4 CG_CalculateWeaponPosition
+CALLV
+pop
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+609412+36
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+609412+36+4
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+609412+36+8
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+609412+36+12
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+609412+36+12+4
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+609412+36+12+8
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+609412+36+24
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+609412+36+24+4
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+609412+36+24+8
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 188
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg_gun_frame+12
+INDIRI4
+CNSTI4 0
+EQI4 $2118
+ADDRLP4 212
+ADDRGP4 cg_gun_frame+12
+INDIRI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2119
+JUMPV
+LABELV $2118
+ADDRLP4 204
+CNSTI4 4524
+ADDRLP4 180
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRLP4 180
+INDIRP4
+CNSTI4 956
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 CG_MapTorsoToWeaponFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRLP4 180
+INDIRP4
+CNSTI4 948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 CG_MapTorsoToWeaponFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+ADDRLP4 180
+INDIRP4
+CNSTI4 964
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $2119
+ADDRLP4 0+8
+ADDRLP4 200
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 13
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+607704
+ARGP4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddPlayerWeapon
+CALLV
+pop
+LABELV $1999
+endproc CG_AddViewWeapon 228 16
+export CG_DrawWeaponSelect
+proc CG_DrawWeaponSelect 68 36
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $2133
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+607196+184
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+GTI4 $2133
+ADDRGP4 $2132
+JUMPV
+LABELV $2133
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $2137
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 48
+INDIRI4
+EQI4 $2137
+ADDRGP4 $2132
+JUMPV
+LABELV $2137
+ADDRGP4 cg_weaponBarFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2141
+ADDRLP4 36
+ADDRGP4 cgs+632912+1013812
+ASGNP4
+ADDRGP4 $2142
+JUMPV
+LABELV $2141
+ADDRLP4 36
+ADDRGP4 cgDC+236+12
+ASGNP4
+LABELV $2142
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2148
+ADDRLP4 28
+ADDRGP4 wcg+31087196
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2149
+JUMPV
+LABELV $2148
+ADDRLP4 28
+ADDRGP4 cg+627420
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $2155
+ADDRLP4 16
+ADDRGP4 cg+609312
+INDIRI4
+ASGNI4
+LABELV $2155
+LABELV $2149
+ADDRGP4 cg_weaponBar+12
+INDIRI4
+CNSTI4 5
+NEI4 $2159
+ADDRLP4 28
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $2159
+ADDRLP4 28
+INDIRI4
+ARGI4
+CNSTI4 1400
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2163
+ADDRGP4 $2132
+JUMPV
+LABELV $2163
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+627404
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2166
+ADDRLP4 12
+CNSTI4 1
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRGP4 $2167
+JUMPV
+LABELV $2166
+ADDRLP4 12
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2167
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $2171
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2175
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2175
+LABELV $2172
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $2171
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 20
+ADDRLP4 20
+INDIRI4
+MULI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1136525312
+ASGNF4
+ADDRGP4 cg_weaponBarX+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2177
+ADDRLP4 4
+ADDRGP4 cg_weaponBarX+8
+INDIRF4
+ASGNF4
+LABELV $2177
+ADDRGP4 cg_weaponBarY+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2181
+ADDRLP4 8
+ADDRGP4 cg_weaponBarY+8
+INDIRF4
+ASGNF4
+LABELV $2181
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $2185
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $2189
+ADDRGP4 $2186
+JUMPV
+LABELV $2189
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2192
+ADDRLP4 60
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 64
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+472
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2192
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $2196
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $2196
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 64
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRGP4 cgs+632912+492132
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2196
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1109393408
+ADDF4
+ASGNF4
+LABELV $2186
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $2185
+CNSTI4 132
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2201
+ADDRLP4 56
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 32
+CNSTI4 132
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+4
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2205
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1134559232
+ADDRLP4 40
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1102053376
+SUBF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 CG_Text_Paint_Bottom
+CALLV
+pop
+LABELV $2205
+LABELV $2201
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $2132
+endproc CG_DrawWeaponSelect 68 36
+proc CG_WeaponSelectable 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2208
+CNSTI4 0
+RETI4
+ADDRGP4 $2207
+JUMPV
+LABELV $2208
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $2211
+CNSTI4 0
+RETI4
+ADDRGP4 $2207
+JUMPV
+LABELV $2211
+CNSTI4 1
+RETI4
+LABELV $2207
+endproc CG_WeaponSelectable 0 0
+export CG_NextWeapon_f
+proc CG_NextWeapon_f 16 4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2215
+ADDRGP4 $2214
+JUMPV
+LABELV $2215
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2218
+ADDRGP4 $2214
+JUMPV
+LABELV $2218
+ADDRGP4 cg+627420
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+609312
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2224
+ADDRLP4 8
+ADDRGP4 cg+609312
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+609312
+INDIRI4
+CNSTI4 16
+NEI4 $2229
+ADDRGP4 cg+609312
+CNSTI4 0
+ASGNI4
+LABELV $2229
+ADDRGP4 cg+609312
+INDIRI4
+CNSTI4 1
+NEI4 $2233
+ADDRGP4 $2225
+JUMPV
+LABELV $2233
+ADDRGP4 cg+609312
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2236
+ADDRGP4 $2226
+JUMPV
+LABELV $2236
+LABELV $2225
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $2224
+LABELV $2226
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+NEI4 $2239
+ADDRGP4 cg+609312
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $2239
+LABELV $2214
+endproc CG_NextWeapon_f 16 4
+export CG_PrevWeapon_f
+proc CG_PrevWeapon_f 16 4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2243
+ADDRGP4 $2242
+JUMPV
+LABELV $2243
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2246
+ADDRGP4 $2242
+JUMPV
+LABELV $2246
+ADDRGP4 cg+627420
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+609312
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2252
+ADDRLP4 8
+ADDRGP4 cg+609312
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+609312
+INDIRI4
+CNSTI4 -1
+NEI4 $2257
+ADDRGP4 cg+609312
+CNSTI4 15
+ASGNI4
+LABELV $2257
+ADDRGP4 cg+609312
+INDIRI4
+CNSTI4 1
+NEI4 $2261
+ADDRGP4 $2253
+JUMPV
+LABELV $2261
+ADDRGP4 cg+609312
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2264
+ADDRGP4 $2254
+JUMPV
+LABELV $2264
+LABELV $2253
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $2252
+LABELV $2254
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+NEI4 $2267
+ADDRGP4 cg+609312
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $2267
+LABELV $2242
+endproc CG_PrevWeapon_f 16 4
+export CG_Weapon_f
+proc CG_Weapon_f 16 4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2271
+ADDRGP4 $2270
+JUMPV
+LABELV $2271
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2274
+ADDRGP4 $2270
+JUMPV
+LABELV $2274
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $2279
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LEI4 $2277
+LABELV $2279
+ADDRGP4 $2270
+JUMPV
+LABELV $2277
+ADDRGP4 cg+627420
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $2282
+ADDRGP4 $2270
+JUMPV
+LABELV $2282
+ADDRGP4 cg+609312
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $2270
+endproc CG_Weapon_f 16 4
+export CG_OutOfAmmoChange
+proc CG_OutOfAmmoChange 8 4
+ADDRGP4 cg+627420
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 15
+ASGNI4
+LABELV $2289
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2293
+ADDRGP4 cg+609312
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $2291
+JUMPV
+LABELV $2293
+LABELV $2290
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $2289
+LABELV $2291
+LABELV $2286
+endproc CG_OutOfAmmoChange 8 4
+export CG_FireWeapon
+proc CG_FireWeapon 136 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $2297
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $2297
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2299
+ADDRGP4 $2296
+JUMPV
+LABELV $2299
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $2301
+ADDRGP4 $2303
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $2296
+JUMPV
+LABELV $2301
+ADDRLP4 8
+CNSTI4 132
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2304
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2306
+ADDRLP4 20
+CNSTI4 36
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 11
+ADDU4
+ASGNU4
+ADDRLP4 28
+CNSTI4 36
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+1276
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 11
+ADDU4
+ASGNU4
+ADDRGP4 $2307
+JUMPV
+LABELV $2306
+ADDRLP4 20
+CNSTI4 36
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+736
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 28
+CNSTI4 36
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+CNSTI4 2392
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+1276
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+LABELV $2307
+LABELV $2304
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $2316
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $2316
+ADDRLP4 16
+INDIRI4
+CNSTI4 14
+NEI4 $2312
+LABELV $2316
+CNSTI4 196632
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2312
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2317
+ADDRGP4 $2319
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2317
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 112
+CNSTP4 0
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 116
+ADDRGP4 Wolfcam_CalcMuzzlePoint
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $2320
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 124
+CNSTP4 0
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2320
+ADDRLP4 120
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 32
+ADDRLP4 20
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 44+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+8
+ADDRLP4 20+8
+INDIRF4
+CNSTF4 1207959552
+ADDRLP4 44+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2328
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $2328
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $2328
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20+8
+ADDRLP4 20+8
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRGP4 $2329
+JUMPV
+LABELV $2328
+ADDRLP4 124
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LTI4 $2334
+ADDRLP4 124
+INDIRI4
+CNSTI4 64
+GEI4 $2334
+ADDRLP4 124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31082572
+ADDP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+EQI4 $2334
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_GetWeaponFlashOrigin
+CALLV
+pop
+ADDRGP4 $2335
+JUMPV
+LABELV $2334
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2335
+LABELV $2329
+ADDRLP4 56
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 124
+CNSTP4 0
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 Wolfcam_WeaponTrace
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 56+12
+INDIRB
+ASGNB 12
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+72
+ADDRLP4 32
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRLP4 32
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+96+4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+96+8
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 20+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+644
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+680
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7772
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7788
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 196632
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+98328
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $2312
+ADDRFP4 0
+INDIRP4
+CNSTI4 1088
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $2363
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTI4 1496
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+CVPU4 4
+NEU4 $2363
+ADDRGP4 cg+607704+900+188
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $2363
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2371
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2373
+ADDRGP4 $2375
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2373
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2376
+ADDRGP4 $2296
+JUMPV
+LABELV $2376
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2371
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_quadFireSound+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2378
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_QUAD
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2378
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+EQI4 $2385
+ADDRLP4 24
+INDIRI4
+CNSTI4 14
+EQI4 $2385
+ADDRLP4 24
+INDIRI4
+CNSTI4 13
+EQI4 $2385
+ADDRLP4 24
+INDIRI4
+CNSTI4 8
+NEI4 $2381
+LABELV $2385
+ADDRGP4 cg+607148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1116
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg_quadSoundRate+12
+INDIRI4
+LTI4 $2382
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+632912+492644
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1116
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+ADDRGP4 $2382
+JUMPV
+LABELV $2381
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+632912+492644
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $2382
+LABELV $2378
+CNSTI4 196632
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+24
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2395
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2398
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 116
+CNSTP4 0
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 120
+ADDRGP4 Wolfcam_CalcMuzzlePoint
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $2400
+ADDRGP4 $2402
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 128
+CNSTP4 0
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2400
+ADDRLP4 124
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1207959552
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2409
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $2409
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $2409
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRGP4 $2410
+JUMPV
+LABELV $2409
+ADDRLP4 128
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 132
+INDIRI4
+LTI4 $2415
+ADDRLP4 128
+INDIRI4
+CNSTI4 64
+GEI4 $2415
+ADDRLP4 128
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31082572
+ADDP4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+EQI4 $2415
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_GetWeaponFlashOrigin
+CALLV
+pop
+ADDRGP4 $2416
+JUMPV
+LABELV $2415
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2416
+LABELV $2410
+ADDRLP4 60
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 128
+CNSTP4 0
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 Wolfcam_WeaponTrace
+CALLV
+pop
+ADDRLP4 36
+ADDRLP4 60+12
+INDIRB
+ASGNB 12
+ADDRGP4 $2399
+JUMPV
+LABELV $2398
+ADDRLP4 116
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 116
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+ADDRLP4 116
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $2399
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2419
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 $2420
+JUMPV
+LABELV $2419
+ADDRGP4 ScriptVars+332
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+332+4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+332+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+344
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+344+4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+344+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 ScriptVars+360
+CNSTI4 -2
+ASGNI4
+ADDRGP4 ScriptVars+356
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+364
+CNSTI4 1
+ASGNI4
+ADDRGP4 ScriptVars+368
+CNSTI4 0
+ASGNI4
+ADDRGP4 ScriptVars+372
+CNSTI4 0
+ASGNI4
+LABELV $2420
+ADDRGP4 ScriptVars+60
+ADDRLP4 24
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+72
+ADDRLP4 36
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRLP4 36
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+96+4
+ADDRLP4 36+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+96+8
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+644
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+680
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+668
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 196632
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+24
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2296
+JUMPV
+LABELV $2395
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2452
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2456
+ADDRGP4 $2454
+JUMPV
+LABELV $2456
+LABELV $2453
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2452
+LABELV $2454
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $2458
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2460
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2462
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2464
+ADDRGP4 $2466
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2464
+ADDRFP4 0
+INDIRP4
+CNSTI4 1084
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $2462
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+CNSTI4 2
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $2460
+LABELV $2458
+ADDRLP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2468
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 0
+LEI4 $2468
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2471
+ADDRGP4 $2473
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2471
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2468
+LABELV $2296
+endproc CG_FireWeapon 136 28
+export CG_MissileHitWall
+proc CG_MissileHitWall 284 52
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2477
+ARGP4
+ADDRLP4 176
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $2475
+ADDRGP4 $2478
+ARGP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2475
+ADDRLP4 0
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2479
+ADDRFP4 0
+CNSTI4 6
+ASGNI4
+LABELV $2479
+ADDRLP4 104
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 184
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LTI4 $2482
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $2482
+ADDRFP4 0
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRGP4 $2520-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2520
+address $2511
+address $2511
+address $2483
+address $2483
+address $2482
+address $2511
+address $2483
+address $2483
+address $2482
+address $2483
+address $2483
+address $2511
+code
+LABELV $2483
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRLP4 100
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRGP4 $2487
+JUMPV
+LABELV $2484
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+5584008
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $2490
+ADDRGP4 $2485
+JUMPV
+LABELV $2490
+ADDRLP4 16
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2492
+ADDRGP4 $2485
+JUMPV
+LABELV $2492
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $2495
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+ADDRLP4 120
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 40
+INDIRB
+ASGNB 12
+ADDRGP4 $2485
+JUMPV
+LABELV $2495
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 192
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 196
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+GEF4 $2497
+ADDRLP4 120
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 40
+INDIRB
+ASGNB 12
+LABELV $2497
+LABELV $2485
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2487
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+5649544
+INDIRI4
+LTI4 $2484
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $2482
+ADDRLP4 192
+ADDRLP4 120
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+5584008+60
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 120
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+5584008+24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 128
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 196
+INDIRF4
+CNSTF4 1092616192
+GTF4 $2505
+ADDRLP4 104
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRGP4 $2506
+JUMPV
+LABELV $2505
+ADDRLP4 128
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRGP4 VectorReflect
+CALLV
+pop
+LABELV $2506
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $2507
+ADDRLP4 120
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+5584008+40
+ADDP4
+ARGP4
+ADDRLP4 200
+CNSTP4 0
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 104
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $2507
+ADDRLP4 104
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 $2482
+JUMPV
+LABELV $2511
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $2482
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ARGP4
+ADDRLP4 192
+CNSTP4 0
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 196
+ADDRGP4 Wolfcam_CalcMuzzlePoint
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $2514
+ADDRLP4 128
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 164+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 164+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRGP4 VectorReflect
+CALLV
+pop
+ADDRLP4 104
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 $2482
+JUMPV
+LABELV $2514
+ADDRLP4 104
+ADDRLP4 0
+INDIRB
+ASGNB 12
+LABELV $2482
+ADDRLP4 60
+CNSTP4 0
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2522
+ADDRFP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $2522
+ADDRLP4 60
+CNSTI4 1496
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $2527
+ADDRLP4 60
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2524
+LABELV $2527
+ADDRLP4 60
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $2528
+ADDRFP4 0
+CNSTI4 13
+ASGNI4
+LABELV $2528
+LABELV $2524
+LABELV $2522
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2532
+ADDRFP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $2530
+LABELV $2532
+ADDRFP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2530
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2535
+ADDRFP4 0
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $2533
+LABELV $2535
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2533
+CNSTI4 196632
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2536
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+EQI4 $2536
+ADDRLP4 204
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $2539
+ADDRLP4 216
+ARGP4
+ADDRLP4 204
+ARGP4
+ADDRLP4 272
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRLP4 204
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 Wolfcam_WeaponTrace
+CALLV
+pop
+ADDRLP4 204
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 276
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2543
+ADDRGP4 $2541
+JUMPV
+LABELV $2543
+ADDRLP4 280
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 204
+ADDRLP4 204
+INDIRF4
+ADDRLP4 280
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 204+4
+ADDRLP4 204+4
+INDIRF4
+ADDRLP4 280
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 204+8
+ADDRLP4 204+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2540
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $2539
+LABELV $2541
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+CNSTI4 1496
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRLP4 216+44
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2551
+ADDRGP4 ScriptVars+376
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2552
+JUMPV
+LABELV $2551
+ADDRLP4 216+44
+INDIRI4
+CNSTI4 1048576
+BANDI4
+CNSTI4 0
+EQI4 $2555
+ADDRGP4 ScriptVars+376
+CNSTI4 2
+ASGNI4
+LABELV $2555
+LABELV $2552
+ADDRGP4 ScriptVars+60
+ADDRLP4 204
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+84
+ADDRLP4 104
+INDIRB
+ASGNB 12
+CNSTI4 196632
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+131096
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2474
+JUMPV
+LABELV $2536
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $2563
+ADDRGP4 cg_shotgunMarks+12
+INDIRI4
+CNSTI4 0
+NEI4 $2563
+ADDRGP4 $2474
+JUMPV
+LABELV $2563
+ADDRLP4 204
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 92
+CNSTF4 0
+ASGNF4
+ADDRLP4 208
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+CNSTI4 600
+ASGNI4
+ADDRLP4 216
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 216
+INDIRI4
+LTI4 $2568
+ADDRFP4 0
+INDIRI4
+CNSTI4 14
+GTI4 $2568
+ADDRFP4 0
+INDIRI4
+ADDRLP4 216
+INDIRI4
+LSHI4
+ADDRGP4 $2732-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2732
+address $2698
+address $2664
+address $2605
+address $2614
+address $2583
+address $2637
+address $2646
+address $2655
+address $2568
+address $2570
+address $2596
+address $2671
+address $2715
+code
+LABELV $2568
+LABELV $2570
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $2571
+ADDRLP4 52
+ADDRGP4 cgs+632912+492848
+INDIRI4
+ASGNI4
+ADDRGP4 $2572
+JUMPV
+LABELV $2571
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $2575
+ADDRLP4 52
+ADDRGP4 cgs+632912+492852
+INDIRI4
+ASGNI4
+ADDRGP4 $2576
+JUMPV
+LABELV $2575
+ADDRLP4 52
+ADDRGP4 cgs+632912+492844
+INDIRI4
+ASGNI4
+LABELV $2576
+LABELV $2572
+ADDRLP4 36
+ADDRGP4 cgs+632912+492260
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTF4 1094713344
+ASGNF4
+ADDRGP4 $2569
+JUMPV
+LABELV $2583
+ADDRLP4 220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 220
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 2
+GEI4 $2584
+ADDRLP4 52
+ADDRGP4 cgs+632912+492812
+INDIRI4
+ASGNI4
+ADDRGP4 $2585
+JUMPV
+LABELV $2584
+ADDRLP4 124
+INDIRI4
+CNSTI4 2
+NEI4 $2588
+ADDRLP4 52
+ADDRGP4 cgs+632912+492808
+INDIRI4
+ASGNI4
+ADDRGP4 $2589
+JUMPV
+LABELV $2588
+ADDRLP4 52
+ADDRGP4 cgs+632912+492816
+INDIRI4
+ASGNI4
+LABELV $2589
+LABELV $2585
+ADDRLP4 36
+ADDRGP4 cgs+632912+492260
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTF4 1094713344
+ASGNF4
+ADDRGP4 $2569
+JUMPV
+LABELV $2596
+ADDRLP4 32
+ADDRGP4 cgs+632912+492340
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cgs+632912+492364
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 cgs+632912+492840
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cgs+632912+492256
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 92
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2569
+JUMPV
+LABELV $2605
+ADDRLP4 32
+ADDRGP4 cgs+632912+492340
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cgs+632912+492364
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 cgs+632912+492832
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cgs+632912+492256
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 92
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2569
+JUMPV
+LABELV $2614
+ADDRLP4 32
+ADDRGP4 cgs+632912+492340
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cgs+632912+492360
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 cgs+632912+492832
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cgs+632912+492256
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 92
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRLP4 116
+CNSTI4 1000
+ASGNI4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_oldRocket+12
+INDIRI4
+CNSTI4 0
+NEI4 $2569
+ADDRLP4 228
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 140
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 228
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 228
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1103101952
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 232
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 152
+ADDRLP4 232
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 152+4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 152+8
+CNSTF4 1115684864
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $2636
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 152
+ARGP4
+CNSTI4 1400
+ARGI4
+CNSTI4 20
+ARGI4
+CNSTI4 30
+ARGI4
+ADDRGP4 CG_ParticleExplosion
+CALLV
+pop
+ADDRGP4 $2569
+JUMPV
+LABELV $2637
+ADDRLP4 32
+ADDRGP4 cgs+632912+492336
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cgs+632912+492348
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 cgs+632912+492836
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cgs+632912+492264
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 64
+CNSTF4 1103101952
+ASGNF4
+ADDRGP4 $2569
+JUMPV
+LABELV $2646
+ADDRLP4 32
+ADDRGP4 cgs+632912+492336
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cgs+632912+492352
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 cgs+632912+492836
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cgs+632912+492264
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 64
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $2569
+JUMPV
+LABELV $2655
+ADDRLP4 32
+ADDRGP4 cgs+632912+492340
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cgs+632912+492368
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 cgs+632912+492832
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cgs+632912+492256
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2569
+JUMPV
+LABELV $2664
+ADDRLP4 32
+ADDRGP4 cgs+632912+492332
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cgs+632912+492356
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cgs+632912+492252
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+CNSTF4 1082130432
+ASGNF4
+ADDRGP4 $2569
+JUMPV
+LABELV $2671
+ADDRLP4 32
+ADDRGP4 cgs+632912+492332
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $2674
+ADDRLP4 52
+ADDRGP4 cgs+632912+492860
+INDIRI4
+ASGNI4
+ADDRGP4 $2675
+JUMPV
+LABELV $2674
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $2678
+ADDRLP4 52
+ADDRGP4 cgs+632912+492864
+INDIRI4
+ASGNI4
+ADDRGP4 $2679
+JUMPV
+LABELV $2678
+ADDRLP4 52
+ADDRGP4 cgs+632912+492856
+INDIRI4
+ASGNI4
+LABELV $2679
+LABELV $2675
+ADDRLP4 56
+ADDRGP4 cgs+632912+492356
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cgs+632912+492252
+INDIRI4
+ASGNI4
+ADDRLP4 224
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 224
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 2
+GEI4 $2688
+ADDRLP4 52
+ADDRGP4 cgs+632912+492820
+INDIRI4
+ASGNI4
+ADDRGP4 $2689
+JUMPV
+LABELV $2688
+ADDRLP4 124
+INDIRI4
+CNSTI4 2
+NEI4 $2692
+ADDRLP4 52
+ADDRGP4 cgs+632912+492824
+INDIRI4
+ASGNI4
+ADDRGP4 $2693
+JUMPV
+LABELV $2692
+ADDRLP4 52
+ADDRGP4 cgs+632912+492828
+INDIRI4
+ASGNI4
+LABELV $2693
+LABELV $2689
+ADDRLP4 64
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 $2569
+JUMPV
+LABELV $2698
+ADDRLP4 32
+ADDRGP4 cgs+632912+492332
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cgs+632912+492356
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cgs+632912+492252
+INDIRI4
+ASGNI4
+ADDRLP4 228
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 228
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $2705
+ADDRLP4 52
+ADDRGP4 cgs+632912+492820
+INDIRI4
+ASGNI4
+ADDRGP4 $2706
+JUMPV
+LABELV $2705
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+NEI4 $2709
+ADDRLP4 52
+ADDRGP4 cgs+632912+492824
+INDIRI4
+ASGNI4
+ADDRGP4 $2710
+JUMPV
+LABELV $2709
+ADDRLP4 52
+ADDRGP4 cgs+632912+492828
+INDIRI4
+ASGNI4
+LABELV $2710
+LABELV $2706
+ADDRLP4 64
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 $2569
+JUMPV
+LABELV $2715
+ADDRLP4 32
+ADDRGP4 cgs+632912+492332
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cgs+632912+492356
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cgs+632912+492252
+INDIRI4
+ASGNI4
+ADDRLP4 232
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 232
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $2722
+ADDRLP4 52
+ADDRGP4 cgs+632912+492820
+INDIRI4
+ASGNI4
+ADDRGP4 $2723
+JUMPV
+LABELV $2722
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+NEI4 $2726
+ADDRLP4 52
+ADDRGP4 cgs+632912+492824
+INDIRI4
+ASGNI4
+ADDRGP4 $2727
+JUMPV
+LABELV $2726
+ADDRLP4 52
+ADDRGP4 cgs+632912+492828
+INDIRI4
+ASGNI4
+LABELV $2727
+LABELV $2723
+ADDRLP4 64
+CNSTF4 1090519040
+ASGNF4
+LABELV $2569
+CNSTI4 196632
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2734
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $2734
+ADDRGP4 $2474
+JUMPV
+LABELV $2734
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $2737
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+EQI4 $2741
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2739
+LABELV $2741
+ADDRGP4 $2740
+JUMPV
+LABELV $2739
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $2740
+LABELV $2737
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2742
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 CG_MakeExplosion
+CALLP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 224
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $2744
+ADDRLP4 96
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTI4 4524
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+204
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2744
+LABELV $2742
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cgs+632912+492264
+INDIRI4
+NEI4 $2751
+ADDRLP4 224
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2752
+JUMPV
+LABELV $2751
+ADDRLP4 224
+CNSTI4 0
+ASGNI4
+LABELV $2752
+ADDRLP4 72
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $2753
+ADDRLP4 228
+CNSTI4 4524
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+204
+ADDP4
+ASGNP4
+ADDRGP4 cg_railUseOwnColors+12
+INDIRI4
+CNSTI4 0
+EQI4 $2757
+CNSTI4 4524
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 CG_IsUs
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $2757
+ADDRLP4 228
+ADDRGP4 cg+3196860
+ASGNP4
+LABELV $2757
+ADDRLP4 236
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 236
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 240
+ADDRLP4 228
+INDIRP4
+ASGNP4
+ADDRLP4 240
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 240
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 240
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+ADDRGP4 $2754
+JUMPV
+LABELV $2753
+ADDRLP4 228
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 228
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 232
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 232
+INDIRF4
+ARGF4
+ADDRLP4 232
+INDIRF4
+ARGF4
+ADDRLP4 232
+INDIRF4
+ARGF4
+ADDRLP4 232
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $2754
+LABELV $2474
+endproc CG_MissileHitWall 284 52
+export CG_MissileHitPlayer
+proc CG_MissileHitPlayer 12 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2765
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2763
+LABELV $2765
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2763
+CNSTI4 196632
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2766
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+72
+CNSTF4 0
+ASGNF4
+ADDRGP4 ScriptVars+72+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 ScriptVars+72+8
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ClientInSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2776
+ADDRGP4 ScriptVars+72
+CNSTI4 1496
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+72+4
+CNSTI4 1496
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+72+8
+CNSTI4 1496
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2776
+LABELV $2777
+CNSTI4 196632
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+163864
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2762
+JUMPV
+LABELV $2766
+ADDRGP4 EffectScripts+4063592
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2789
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+CNSTI4 1496
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+72
+CNSTF4 0
+ASGNF4
+ADDRGP4 ScriptVars+72+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 ScriptVars+72+8
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ClientInSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2799
+ADDRGP4 ScriptVars+72
+CNSTI4 1496
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+72+4
+CNSTI4 1496
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+72+8
+CNSTI4 1496
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+1188+8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $2799
+LABELV $2800
+ADDRGP4 EffectScripts+4063592
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRGP4 $2762
+JUMPV
+LABELV $2789
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $2812
+ADDRFP4 16
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2814
+LABELV $2814
+LABELV $2812
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $2817
+ADDRGP4 cg_shotgunImpactSparks+12
+INDIRI4
+CNSTI4 0
+NEI4 $2817
+ADDRGP4 $2762
+JUMPV
+LABELV $2817
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bleed
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_ImpactSparks
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2821
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $2821
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2823-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2823
+address $2822
+address $2822
+address $2821
+address $2821
+address $2821
+address $2822
+address $2821
+address $2822
+address $2822
+address $2822
+code
+LABELV $2822
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $2821
+LABELV $2762
+endproc CG_MissileHitPlayer 12 24
+proc CG_ShotgunPellet 204 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 120
+CNSTP4 0
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 Wolfcam_WeaponTrace
+CALLV
+pop
+ADDRLP4 56+52
+INDIRI4
+CNSTI4 64
+GEI4 $2826
+CNSTI4 1496
+ADDRLP4 56+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $2826
+LABELV $2826
+CNSTI4 1496
+ADDRLP4 56+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2831
+CNSTI4 3
+ARGI4
+ADDRLP4 56+12
+ARGP4
+ADDRLP4 56+24
+ARGP4
+ADDRLP4 56+52
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitPlayer
+CALLV
+pop
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2838
+ADDRFP4 8
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $2838
+LABELV $2838
+LABELV $2831
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 124
+CNSTP4 0
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 EffectScripts+589896+12
+INDIRI4
+ADDRLP4 128
+INDIRI4
+EQI4 $2841
+ADDRFP4 8
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LTI4 $2841
+ADDRFP4 8
+INDIRI4
+CNSTI4 64
+GEI4 $2841
+ADDRLP4 136
+CNSTI4 1496
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 152
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $2845
+ADDRLP4 152
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $2845
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $2845
+ADDRLP4 140
+ADDRLP4 152
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRGP4 $2846
+JUMPV
+LABELV $2845
+ADDRLP4 156
+ADDRLP4 152
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 160
+INDIRI4
+LTI4 $2851
+ADDRLP4 156
+INDIRI4
+CNSTI4 64
+GEI4 $2851
+ADDRLP4 156
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31082572
+ADDP4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+EQI4 $2851
+ADDRLP4 152
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRGP4 CG_GetWeaponFlashOrigin
+CALLV
+pop
+LABELV $2851
+LABELV $2852
+LABELV $2846
+ADDRGP4 CG_ResetScriptVars
+CALLV
+pop
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyPlayerDataToScriptData
+CALLV
+pop
+ADDRGP4 ScriptVars+60
+ADDRLP4 140
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+72
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+96
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+96+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+96+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 ScriptVars+644
+ADDRLP4 136
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+680
+ADDRGP4 ScriptVars+96
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7772
+ADDRLP4 136
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7784
+ADDRLP4 136
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 ScriptVars+7788
+ADDRLP4 136
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ScriptVars+7800
+ADDRLP4 136
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 EffectScripts+589896+98328
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_RunQ3mmeScript
+CALLI4
+pop
+ADDRLP4 136
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRGP4 ScriptVars+7772
+INDIRB
+ASGNB 12
+ADDRLP4 136
+INDIRP4
+CNSTI4 576
+ADDP4
+ADDRGP4 ScriptVars+7784
+INDIRF4
+ASGNF4
+ADDRLP4 136
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 ScriptVars+7788
+INDIRB
+ASGNB 12
+ADDRLP4 136
+INDIRP4
+CNSTI4 592
+ADDP4
+ADDRGP4 ScriptVars+7800
+INDIRF4
+ASGNF4
+ADDRLP4 136
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $2841
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 116
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 116
+INDIRI4
+NEI4 $2878
+ADDRLP4 112
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2879
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $2879
+JUMPV
+LABELV $2878
+ADDRLP4 112
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2883
+ADDRLP4 144
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+CNSTP4 0
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $2884
+JUMPV
+LABELV $2883
+ADDRLP4 116
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2886
+ADDRLP4 144
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 200
+CNSTP4 0
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 144+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+LABELV $2886
+LABELV $2884
+LABELV $2879
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2890
+ADDRGP4 $2825
+JUMPV
+LABELV $2890
+CNSTI4 1496
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2893
+ADDRGP4 $2894
+JUMPV
+LABELV $2893
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2897
+ADDRGP4 $2825
+JUMPV
+LABELV $2897
+CNSTI4 1496
+ADDRLP4 56+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2900
+LABELV $2900
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2904
+CNSTI4 3
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 144
+CNSTI4 1
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $2905
+JUMPV
+LABELV $2904
+CNSTI4 3
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $2905
+LABELV $2894
+LABELV $2825
+endproc CG_ShotgunPellet 204 28
+proc CG_ShotgunPattern 104 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 1496
+ADDRFP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 64
+CNSTP4 0
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRGP4 $2912
+JUMPV
+ADDRGP4 $2913
+JUMPV
+LABELV $2912
+ADDRGP4 cg_shotgunStyle+12
+INDIRI4
+CNSTI4 0
+NEI4 $2914
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $2917
+ADDRFP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1098907648
+CNSTF4 1143930880
+ADDRLP4 68
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 8
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1098907648
+CNSTF4 1143930880
+ADDRLP4 72
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 80
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1207959552
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 48+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_ShotgunPellet
+CALLV
+pop
+LABELV $2918
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 11
+LTI4 $2917
+ADDRGP4 $2915
+JUMPV
+LABELV $2914
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $2937
+ADDRLP4 92
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 92
+INDIRI4
+ADDRGP4 cg+3874640
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 92
+INDIRI4
+ADDRGP4 cg+3874640+4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg_shotgunStyle+12
+INDIRI4
+CNSTI4 1
+LEI4 $2944
+ADDRLP4 96
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 96
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRGP4 cg_shotgunRandomness+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRGP4 cg_shotgunRandomness+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2944
+ADDRLP4 68
+ADDRLP4 24
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 68
+ADDRLP4 80
+INDIRB
+ASGNB 12
+ADDRLP4 68
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 80
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 68
+ADDRLP4 80
+INDIRB
+ASGNB 12
+ADDRLP4 68
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 100
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 68
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 68+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1207959552
+ADDRLP4 68+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_ShotgunPellet
+CALLV
+pop
+LABELV $2938
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 20
+LTI4 $2937
+LABELV $2915
+LABELV $2913
+LABELV $2911
+endproc CG_ShotgunPattern 104 16
+export CG_ShotgunFire
+proc CG_ShotgunFire 56 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 24
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1107296256
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cgs+20100+19480
+INDIRI4
+CNSTI4 3
+EQI4 $2964
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $2968
+ADDRGP4 cg_smokeRadius_SG+12
+INDIRI4
+CNSTI4 0
+LEI4 $2970
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 cg_smokeRadius_SG+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 52
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1147207680
+ARGF4
+ADDRGP4 cg+607148
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+632912+492144
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+LABELV $2970
+LABELV $2968
+LABELV $2964
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ShotgunPattern
+CALLV
+pop
+LABELV $2953
+endproc CG_ShotgunFire 56 48
+proc CG_Tracer 236 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 188
+CNSTI4 4
+ASGNI4
+ADDRLP4 108+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 192
+CNSTI4 8
+ASGNI4
+ADDRLP4 108+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2982
+ADDRGP4 $2979
+JUMPV
+LABELV $2982
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 200
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+MULF4
+CNSTF4 1112014848
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRGP4 cg_tracerLength+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LEF4 $2985
+ADDRLP4 156
+ADDRLP4 164
+INDIRF4
+ASGNF4
+LABELV $2985
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 224
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 224
+INDIRF4
+ADDRGP4 cg+609412+36+12
+INDIRF4
+MULF4
+ADDRLP4 108+4
+INDIRF4
+ADDRGP4 cg+609412+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 108+8
+INDIRF4
+ADDRGP4 cg+609412+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 224
+INDIRF4
+ADDRGP4 cg+609412+36+24
+INDIRF4
+MULF4
+ADDRLP4 108+4
+INDIRF4
+ADDRGP4 cg+609412+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 108+8
+INDIRF4
+ADDRGP4 cg+609412+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 cg+609412+36+12
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+4
+ADDRGP4 cg+609412+36+12+4
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+8
+ADDRGP4 cg+609412+36+12+8
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 144
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg+609412+36+24
+INDIRF4
+ADDRLP4 228
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+609412+36+24+4
+INDIRF4
+ADDRLP4 228
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+609412+36+24+8
+INDIRF4
+ADDRLP4 144
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+ADDRLP4 132
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 132+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 132
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 132+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 120
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72
+ADDRLP4 120
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cgs+632912+480
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 232
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 168
+ADDRLP4 232
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 168+4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 168+8
+CNSTF4 1056964608
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 168
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+632912+492648
+INDIRI4
+ARGI4
+ADDRGP4 CG_StartSound
+CALLV
+pop
+LABELV $2979
+endproc CG_Tracer 236 16
+export CG_GetWeaponFlashOrigin
+proc CG_GetWeaponFlashOrigin 1088 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $3169
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $3167
+LABELV $3169
+ADDRGP4 $3166
+JUMPV
+LABELV $3167
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3170
+ADDRLP4 344
+ADDRGP4 cg+607704
+ASGNP4
+ADDRGP4 $3171
+JUMPV
+LABELV $3170
+ADDRLP4 344
+CNSTI4 1496
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+LABELV $3171
+ADDRLP4 868
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 864
+CNSTI4 132
+ADDRLP4 344
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1076
+ADDRGP4 CG_IsFirstPersonView
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+EQI4 $3175
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3177
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $3177
+ADDRGP4 $3166
+JUMPV
+LABELV $3177
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $3181
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $3181
+ADDRLP4 1052
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $3182
+JUMPV
+LABELV $3181
+ADDRLP4 1052
+ADDRGP4 cg_fov+12
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $3182
+ADDRLP4 1052
+INDIRF4
+CNSTF4 1119092736
+LEF4 $3187
+ADDRLP4 876
+CNSTF4 3192704205
+ADDRLP4 1052
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+MULF4
+ASGNF4
+ADDRGP4 $3188
+JUMPV
+LABELV $3187
+ADDRLP4 876
+CNSTF4 0
+ASGNF4
+LABELV $3188
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 872
+ADDRGP4 cg_gun_x+8
+INDIRF4
+ASGNF4
+ADDRLP4 344
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $3190
+ADDRLP4 872
+ADDRLP4 872
+INDIRF4
+CNSTF4 1091462758
+ADDF4
+ASGNF4
+LABELV $3190
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 1056
+ARGP4
+ADDRGP4 CG_CalculateWeaponPosition
+CALLV
+pop
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+609412+36
+INDIRF4
+ADDRLP4 872
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+609412+36+4
+INDIRF4
+ADDRLP4 872
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+609412+36+8
+INDIRF4
+ADDRLP4 872
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+609412+36+12
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+609412+36+12+4
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+609412+36+12+8
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+609412+36+24
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 876
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+609412+36+24+4
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 876
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+609412+36+24+8
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 876
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1056
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 868
+INDIRP4
+ARGP4
+ADDRLP4 344
+INDIRP4
+CNSTI4 956
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1080
+ADDRGP4 CG_MapTorsoToWeaponFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 868
+INDIRP4
+ARGP4
+ADDRLP4 344
+INDIRP4
+CNSTI4 948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1084
+ADDRGP4 CG_MapTorsoToWeaponFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+ADDRLP4 344
+INDIRP4
+CNSTI4 964
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 864
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 172+8
+ADDRLP4 864
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $1774
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 172
+ARGP4
+ADDRGP4 cg_gunSize+8
+INDIRF4
+ARGF4
+ADDRGP4 CG_ScaleModel
+CALLV
+pop
+ADDRGP4 $3176
+JUMPV
+LABELV $3175
+ADDRLP4 692
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 348
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 880
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3267
+ADDRLP4 344
+ADDRGP4 cg+607704
+ASGNP4
+LABELV $3267
+ADDRLP4 344
+INDIRP4
+ARGP4
+ADDRLP4 692+28
+ARGP4
+ADDRLP4 348+28
+ARGP4
+ADDRLP4 880+28
+ARGP4
+ADDRGP4 CG_PlayerAngles
+CALLV
+pop
+ADDRLP4 344
+INDIRP4
+ARGP4
+ADDRLP4 692+96
+ARGP4
+ADDRLP4 692+80
+ARGP4
+ADDRLP4 692+100
+ARGP4
+ADDRLP4 348+96
+ARGP4
+ADDRLP4 348+80
+ARGP4
+ADDRLP4 348+100
+ARGP4
+ADDRGP4 CG_PlayerAnimation
+CALLV
+pop
+ADDRLP4 692+8
+ADDRLP4 868
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 692+68
+ADDRLP4 344
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 348+8
+ADDRLP4 868
+INDIRP4
+CNSTI4 920
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 348
+ARGP4
+ADDRLP4 692
+ARGP4
+ADDRLP4 868
+INDIRP4
+CNSTI4 900
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $3283
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 172
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 172+8
+ADDRLP4 864
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRLP4 348+8
+INDIRI4
+ARGI4
+ADDRGP4 $1774
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 172
+ARGP4
+ADDRGP4 cg_gunSizeThirdPerson+8
+INDIRF4
+ARGF4
+ADDRGP4 CG_ScaleModel
+CALLV
+pop
+LABELV $3176
+ADDRLP4 520
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 520+8
+ADDRLP4 864
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 520
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRLP4 864
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1942
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ADDRLP4 520+68
+INDIRB
+ASGNB 12
+LABELV $3166
+endproc CG_GetWeaponFlashOrigin 1088 28
+proc CG_CalcMuzzlePoint 40 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3290
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $3289
+JUMPV
+LABELV $3290
+ADDRLP4 12
+CNSTI4 1496
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3298
+CNSTI4 0
+RETI4
+ADDRGP4 $3289
+JUMPV
+LABELV $3298
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $3302
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $3300
+LABELV $3302
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRGP4 $3301
+JUMPV
+LABELV $3300
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+LABELV $3301
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $3289
+endproc CG_CalcMuzzlePoint 40 16
+export CG_Bullet
+proc CG_Bullet 116 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3306
+ADDRFP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $3306
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $3306
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $3308
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 100
+ADDRGP4 CG_CalcMuzzlePoint
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $3310
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3311
+JUMPV
+LABELV $3310
+ADDRLP4 8
+CNSTI4 1496
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+200
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3311
+LABELV $3308
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3315
+ADDRLP4 28
+CNSTI4 1496
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $3317
+ADDRLP4 12
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $3317
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $3317
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRGP4 $3318
+JUMPV
+LABELV $3317
+ADDRLP4 100
+ADDRLP4 12
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ADDRLP4 104
+INDIRI4
+LTI4 $3323
+ADDRLP4 100
+INDIRI4
+CNSTI4 64
+GEI4 $3323
+ADDRLP4 100
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31082572
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+EQI4 $3323
+ADDRLP4 12
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_GetWeaponFlashOrigin
+CALLV
+pop
+ADDRGP4 $3324
+JUMPV
+LABELV $3323
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $3324
+LABELV $3318
+LABELV $3315
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3326
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3328
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 cg_tracerChance+8
+INDIRF4
+CNSTF4 0
+LEF4 $3330
+ADDRLP4 108
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $3333
+ADDRLP4 108
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $3333
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $3334
+JUMPV
+LABELV $3333
+ADDRLP4 32
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $3335
+ADDRLP4 40
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 112
+CNSTP4 0
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 40+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $3336
+JUMPV
+LABELV $3335
+ADDRLP4 36
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $3338
+ADDRLP4 40
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+CNSTP4 0
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 40+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+LABELV $3338
+LABELV $3336
+LABELV $3334
+LABELV $3330
+ADDRLP4 108
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+EQI4 $3345
+ADDRLP4 108
+INDIRI4
+CNSTI4 13
+EQI4 $3345
+ADDRLP4 108
+INDIRI4
+CNSTI4 14
+NEI4 $3341
+LABELV $3345
+CNSTI4 196632
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 EffectScripts+12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3341
+ADDRGP4 $3342
+JUMPV
+LABELV $3341
+ADDRLP4 112
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRGP4 cg_tracerChance+8
+INDIRF4
+GEF4 $3346
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Tracer
+CALLV
+pop
+LABELV $3346
+LABELV $3342
+LABELV $3328
+LABELV $3326
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $3349
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bleed
+CALLV
+pop
+ADDRGP4 $3350
+JUMPV
+LABELV $3349
+CNSTI4 2
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $3350
+LABELV $3305
+endproc CG_Bullet 116 28
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import Wolfcam_AddViewWeapon
+import Wolfcam_CalcMuzzlePoint
+import Wolfcam_WeaponTrace
+import Wolfcam_LogMissileHit
+import wolfcam_log_event
+import find_best_target
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_AddRealLoopingSound
+import CG_AddLoopingSound
+import CG_StartLocalSound
+import CG_StartSound
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_NewParticleArea
+import CG_ParticleExplosion
+import CG_AddParticles
+import CG_ClearParticles
+import CG_AddMarks
+import CG_ImpactMark
+import CG_InitMarkPolys
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import CG_AddPacketEntities
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_SetEntitySoundPosition
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AllowedAmbientSound
+import CG_PrintEntityStatep
+import CG_PrintEntityState
+import CG_ThawPlayer
+import CG_GibPlayer
+import CG_FX_ThawPlayer
+import CG_FX_GibPlayer
+import CG_ImpactSparks
+import CG_Bleed
+import CG_MakeExplosion
+import CG_HeadShotPlum
+import CG_DamagePlum
+import CG_ScorePlum
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_LightningBoltBeam
+import CG_SpawnEffect
+import CG_SmokePuff
+import CG_BubbleTrail
+import CG_ClearFxExternalForces
+import CG_AddFxExternalForce
+import CG_UpdateFxExternalForces
+import CG_ShutdownLocalEnts
+import CG_GetStoredScriptVarsFromLE
+import CG_RunFxAll
+import CG_SmokePuff_ql
+import CG_AddRefEntityFX
+import CG_AddRefEntity
+import CG_ListLocalEntities
+import CG_RemoveFXLocalEntities
+import CG_ClearLocalFrameEntities
+import CG_CullGrid
+import CG_AddToCullGrid
+import CG_BeginCullGrid
+import CG_AddLocalEntities
+import CG_MakeLowPriorityEntity
+import CG_AllocLocalEntityRealTime
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import FxLoopSounds
+import CG_FreeFxJitTokens
+import CG_ResetFXIntervalAndDistance
+import CG_UpdatePositionData
+import CG_CopyPositionDataToScript
+import CG_CopyPositionDataToCent
+import CG_CopyStaticCentDataToScript
+import CG_CopyStaticScriptDataToCent
+import CG_CopyPlayerDataToScriptData
+import CG_ResetScriptVars
+import CG_ReloadQ3mmeScripts
+import CG_RunQ3mmeScript
+import CG_Q3mmeMath
+import EffectScripts
+import PlainScript
+import DistanceScript
+import EmitterScript
+import EmitterScriptVars
+import ScriptVars
+import UI_DrawProportionalString3
+import UI_DrawProportionalString
+import CG_ColorForHealth
+import CG_GetColorForHealth
+import CG_TeamColor
+import CG_FadeColorVec4
+import CG_FadeColorRealTime
+import CG_FadeColor
+import CG_TileClear
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawStretchPic
+import CG_DrawPic
+import CG_DrawRect
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_FillRect
+import CG_AdjustFrom640
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $3283
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $2636
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $2478
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2477
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 83
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $2473
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 45
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2466
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 108
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 45
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $2402
+byte 1 119
+byte 1 116
+byte 1 102
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $2375
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 108
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $2319
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 109
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 45
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2303
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 45
+byte 1 62
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 87
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 85
+byte 1 77
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 83
+byte 1 0
+align 1
+LABELV $1942
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $1835
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1774
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1518
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1410
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 66
+byte 1 111
+byte 1 108
+byte 1 116
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1268
+byte 1 108
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1151
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 48
+byte 1 45
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1142
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 52
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1141
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 51
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1140
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 50
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1139
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 49
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1137
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1136
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1133
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1132
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1130
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1125
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1122
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1121
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1119
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $1116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1113
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 104
+byte 1 121
+byte 1 112
+byte 1 114
+byte 1 98
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1112
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1110
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1109
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1107
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1104
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 108
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1103
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1102
+byte 1 48
+byte 1 0
+align 1
+LABELV $1099
+byte 1 114
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1097
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1094
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1093
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1091
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1088
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1087
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 102
+byte 1 108
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1086
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1082
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 49
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1078
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 52
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1077
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 51
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1076
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 50
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1075
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 49
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1073
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1070
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 52
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1069
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 51
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1068
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 50
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1067
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 49
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1066
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1062
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1060
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1057
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1054
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1051
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1048
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 66
+byte 1 111
+byte 1 108
+byte 1 116
+byte 1 49
+byte 1 0
+align 1
+LABELV $1045
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1044
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1043
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1041
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1040
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1036
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1033
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1030
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1027
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1013
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $999
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $981
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $951
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
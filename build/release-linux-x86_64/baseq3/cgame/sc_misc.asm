@@ -0,0 +1,6408 @@
+export SC_Lowercase
+code
+proc SC_Lowercase 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $151
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $152
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $151
+LABELV $150
+endproc SC_Lowercase 8 4
+export SC_ParseColorFromStr
+proc SC_ParseColorFromStr 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $155
+CNSTI4 -1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $155
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 16
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $157
+CNSTI4 -1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $157
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $162
+JUMPV
+LABELV $159
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 32
+EQI4 $163
+ADDRLP4 24
+INDIRI4
+CNSTI4 48
+LTI4 $165
+ADDRLP4 24
+INDIRI4
+CNSTI4 57
+LEI4 $163
+LABELV $165
+ADDRGP4 $166
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $163
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $167
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $168
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $173
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $174
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $175
+ADDRGP4 $172
+JUMPV
+LABELV $173
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $172
+JUMPV
+LABELV $174
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $172
+JUMPV
+LABELV $175
+ADDRFP4 12
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $172
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $168
+JUMPV
+LABELV $167
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $176
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $176
+LABELV $168
+LABELV $160
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $162
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $159
+CNSTI4 0
+RETI4
+LABELV $154
+endproc SC_ParseColorFromStr 40 4
+export SC_ParseEnemyColorsFromStr
+proc SC_ParseEnemyColorsFromStr 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $179
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $183
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $184
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $183
+LABELV $180
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $179
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $187
+CNSTI4 -1
+RETI4
+ADDRGP4 $178
+JUMPV
+LABELV $187
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 24
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $192
+JUMPV
+LABELV $189
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 32
+EQI4 $193
+ADDRLP4 32
+INDIRI4
+CNSTI4 48
+LTI4 $195
+ADDRLP4 32
+INDIRI4
+CNSTI4 57
+LEI4 $193
+LABELV $195
+ADDRGP4 $196
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $178
+JUMPV
+LABELV $193
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $197
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $198
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+NEI4 $198
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $203
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $203
+LABELV $198
+LABELV $190
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $192
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $189
+CNSTI4 0
+RETI4
+LABELV $178
+endproc SC_ParseEnemyColorsFromStr 40 4
+export SC_ParseVec3FromStr
+proc SC_ParseVec3FromStr 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $206
+CNSTI4 -1
+RETI4
+ADDRGP4 $205
+JUMPV
+LABELV $206
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 16
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $211
+JUMPV
+LABELV $208
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 32
+EQI4 $212
+ADDRLP4 24
+INDIRI4
+CNSTI4 48
+LTI4 $214
+ADDRLP4 24
+INDIRI4
+CNSTI4 57
+LEI4 $212
+LABELV $214
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 45
+EQI4 $212
+ADDRLP4 28
+INDIRI4
+CNSTI4 46
+EQI4 $212
+ADDRGP4 $215
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $205
+JUMPV
+LABELV $212
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $217
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $217
+ADDRGP4 $210
+JUMPV
+LABELV $216
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $222
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $222
+LABELV $217
+LABELV $209
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $211
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $208
+LABELV $210
+CNSTI4 0
+RETI4
+LABELV $205
+endproc SC_ParseVec3FromStr 36 8
+export SC_RedFromCvar
+proc SC_RedFromCvar 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16777215
+GTI4 $225
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 16711680
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 65536
+DIVI4
+ASGNI4
+ADDRGP4 $226
+JUMPV
+LABELV $225
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 4278190080
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 16777216
+DIVI4
+ASGNI4
+LABELV $226
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $224
+endproc SC_RedFromCvar 4 0
+export SC_GreenFromCvar
+proc SC_GreenFromCvar 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16777215
+GTI4 $228
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 65280
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+DIVI4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $228
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 16711680
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 65536
+DIVI4
+ASGNI4
+LABELV $229
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $227
+endproc SC_GreenFromCvar 4 0
+export SC_BlueFromCvar
+proc SC_BlueFromCvar 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16777215
+GTI4 $231
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $232
+JUMPV
+LABELV $231
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 65280
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+DIVI4
+ASGNI4
+LABELV $232
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $230
+endproc SC_BlueFromCvar 4 0
+export SC_AlphaFromCvar
+proc SC_AlphaFromCvar 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16777215
+GTI4 $234
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $235
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $233
+endproc SC_AlphaFromCvar 4 0
+export SC_ByteVec3ColorFromCvar
+proc SC_ByteVec3ColorFromCvar 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 SC_RedFromCvar
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 SC_GreenFromCvar
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 SC_BlueFromCvar
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $236
+endproc SC_ByteVec3ColorFromCvar 12 4
+export SC_Vec4ColorFromCvars
+proc SC_Vec4ColorFromCvars 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 SC_RedFromCvar
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 SC_GreenFromCvar
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 SC_BlueFromCvar
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+LABELV $237
+endproc SC_Vec4ColorFromCvars 16 4
+export SC_Vec3ColorFromCvar
+proc SC_Vec3ColorFromCvar 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 SC_RedFromCvar
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 SC_GreenFromCvar
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 SC_BlueFromCvar
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+LABELV $238
+endproc SC_Vec3ColorFromCvar 12 4
+export SC_ByteVecColorFromInt
+proc SC_ByteVecColorFromInt 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 16711680
+BANDI4
+CNSTI4 65536
+DIVI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 65280
+BANDI4
+CNSTI4 256
+DIVI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 255
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $239
+endproc SC_ByteVecColorFromInt 0 0
+export SC_Cvar_Get_Int
+proc SC_Cvar_Get_Int 1028 12
+ADDRLP4 0
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+RETI4
+LABELV $240
+endproc SC_Cvar_Get_Int 1028 12
+export SC_Cvar_Get_Float
+proc SC_Cvar_Get_Float 1028 12
+ADDRLP4 0
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRF4
+RETF4
+LABELV $241
+endproc SC_Cvar_Get_Float 1028 12
+bss
+align 1
+LABELV $243
+skip 1024
+export SC_Cvar_Get_String
+code
+proc SC_Cvar_Get_String 4 12
+ADDRLP4 0
+ADDRGP4 $243
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $243
+RETP4
+LABELV $242
+endproc SC_Cvar_Get_String 4 12
+export CG_IsEnemy
+proc CG_IsEnemy 20 4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $245
+ADDRLP4 4
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $246
+JUMPV
+LABELV $245
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $246
+ADDRLP4 0
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $250
+CNSTI4 0
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $250
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $252
+ADDRLP4 12
+CNSTI4 196
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $252
+CNSTI4 1
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $252
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $255
+CNSTI4 1
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $255
+CNSTI4 0
+RETI4
+LABELV $244
+endproc CG_IsEnemy 20 4
+export CG_IsTeammate
+proc CG_IsTeammate 12 0
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GEI4 $259
+CNSTI4 0
+RETI4
+ADDRGP4 $258
+JUMPV
+LABELV $259
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $262
+ADDRLP4 0
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $263
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 196
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $267
+CNSTI4 0
+RETI4
+ADDRGP4 $258
+JUMPV
+LABELV $267
+CNSTI4 1
+RETI4
+LABELV $258
+endproc CG_IsTeammate 12 0
+export CG_IsEnemyTeam
+proc CG_IsEnemyTeam 16 4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $270
+ADDRLP4 0
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $271
+JUMPV
+LABELV $270
+ADDRLP4 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $271
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $275
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+EQI4 $275
+CNSTI4 1
+RETI4
+ADDRGP4 $269
+JUMPV
+LABELV $275
+ADDRGP4 cgs+39688
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_IsTeamGame
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $278
+CNSTI4 1
+RETI4
+ADDRGP4 $269
+JUMPV
+LABELV $278
+CNSTI4 0
+RETI4
+LABELV $269
+endproc CG_IsEnemyTeam 16 4
+export CG_IsOurTeam
+proc CG_IsOurTeam 8 0
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+GEI4 $282
+CNSTI4 0
+RETI4
+ADDRGP4 $281
+JUMPV
+LABELV $282
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $285
+ADDRLP4 0
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $286
+JUMPV
+LABELV $285
+ADDRLP4 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $286
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+EQI4 $290
+CNSTI4 0
+RETI4
+ADDRGP4 $281
+JUMPV
+LABELV $290
+CNSTI4 1
+RETI4
+LABELV $281
+endproc CG_IsOurTeam 8 0
+export CG_IsUs
+proc CG_IsUs 4 0
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $293
+ADDRLP4 0
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $294
+JUMPV
+LABELV $293
+ADDRLP4 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $294
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+CVPU4 4
+NEU4 $297
+CNSTI4 1
+RETI4
+ADDRGP4 $292
+JUMPV
+LABELV $297
+CNSTI4 0
+RETI4
+LABELV $292
+endproc CG_IsUs 4 0
+export CG_IsFirstPersonView
+proc CG_IsFirstPersonView 0 0
+ADDRGP4 cg+1332116
+INDIRI4
+CNSTI4 0
+EQI4 $301
+CNSTI4 0
+RETI4
+ADDRGP4 $300
+JUMPV
+LABELV $301
+ADDRGP4 cg+627504
+INDIRI4
+CNSTI4 0
+EQI4 $304
+CNSTI4 0
+RETI4
+ADDRGP4 $300
+JUMPV
+LABELV $304
+ADDRGP4 cg+607188
+INDIRI4
+CNSTI4 0
+EQI4 $307
+CNSTI4 0
+RETI4
+ADDRGP4 $300
+JUMPV
+LABELV $307
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $310
+ADDRGP4 wcg+4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $310
+CNSTI4 0
+RETI4
+ADDRGP4 $300
+JUMPV
+LABELV $310
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $313
+CNSTI4 0
+RETI4
+ADDRGP4 $300
+JUMPV
+LABELV $313
+CNSTI4 1
+RETI4
+LABELV $300
+endproc CG_IsFirstPersonView 0 0
+export CG_IsTeamGame
+proc CG_IsTeamGame 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $329
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+EQI4 $329
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+EQI4 $329
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+EQI4 $329
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+EQI4 $329
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+EQI4 $329
+ADDRFP4 0
+INDIRI4
+CNSTI4 9
+EQI4 $329
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $329
+ADDRFP4 0
+INDIRI4
+CNSTI4 11
+EQI4 $329
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+EQI4 $329
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $329
+ADDRFP4 0
+INDIRI4
+CNSTI4 14
+NEI4 $317
+LABELV $329
+CNSTI4 1
+RETI4
+ADDRGP4 $316
+JUMPV
+LABELV $317
+CNSTI4 0
+RETI4
+LABELV $316
+endproc CG_IsTeamGame 4 0
+bss
+align 1
+LABELV $331
+skip 1024
+export CG_FS_ReadLine
+code
+proc CG_FS_ReadLine 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $331
+CNSTI1 0
+ASGNI1
+ADDRGP4 $333
+JUMPV
+LABELV $332
+ADDRLP4 0
+INDIRI4
+CNSTI4 1022
+NEI4 $335
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $331+1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $338
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $331
+RETP4
+ADDRGP4 $330
+JUMPV
+LABELV $335
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $331
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $331
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $339
+ADDRGP4 $331
+RETP4
+ADDRGP4 $330
+JUMPV
+LABELV $339
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $331
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+EQI4 $344
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+EQI4 $344
+ADDRLP4 8
+INDIRI4
+CNSTI4 13
+NEI4 $341
+LABELV $344
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $331
+ADDP4
+CNSTI1 10
+ASGNI1
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $331+1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $331
+RETP4
+ADDRGP4 $330
+JUMPV
+LABELV $341
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $333
+ADDRGP4 $332
+JUMPV
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+RETP4
+LABELV $330
+endproc CG_FS_ReadLine 16 12
+export CG_GetToken
+proc CG_GetToken 36 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+LABELV $347
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $349
+ADDRGP4 $351
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $346
+JUMPV
+LABELV $349
+ADDRFP4 12
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $352
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+RETP4
+ADDRGP4 $346
+JUMPV
+LABELV $352
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $357
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $356
+JUMPV
+LABELV $357
+ADDRLP4 12
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 9
+EQI4 $359
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+LTI4 $361
+ADDRLP4 12
+INDIRI4
+CNSTI4 126
+LEI4 $359
+LABELV $361
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $356
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRGP4 $356
+JUMPV
+LABELV $359
+ADDRLP4 16
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+EQI4 $368
+ADDRLP4 16
+INDIRI4
+CNSTI4 9
+EQI4 $368
+ADDRLP4 16
+INDIRI4
+CNSTI4 39
+EQI4 $368
+ADDRLP4 16
+INDIRI4
+CNSTI4 34
+NEI4 $364
+LABELV $368
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $356
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $355
+JUMPV
+LABELV $364
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $371
+ADDRLP4 20
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 47
+EQI4 $378
+ADDRLP4 20
+INDIRI4
+CNSTI4 45
+EQI4 $378
+ADDRLP4 20
+INDIRI4
+CNSTI4 43
+EQI4 $378
+ADDRLP4 20
+INDIRI4
+CNSTI4 42
+EQI4 $378
+ADDRLP4 20
+INDIRI4
+CNSTI4 40
+EQI4 $378
+ADDRLP4 20
+INDIRI4
+CNSTI4 41
+EQI4 $378
+ADDRLP4 20
+INDIRI4
+CNSTI4 44
+NEI4 $371
+LABELV $378
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $379
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRGP4 $356
+JUMPV
+LABELV $379
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI1
+ASGNI1
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $356
+JUMPV
+LABELV $371
+ADDRLP4 24
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 33
+LTI4 $383
+ADDRLP4 24
+INDIRI4
+CNSTI4 126
+LEI4 $381
+LABELV $383
+ADDRGP4 $356
+JUMPV
+LABELV $381
+ADDRLP4 28
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 123
+EQI4 $386
+ADDRLP4 28
+INDIRI4
+CNSTI4 125
+NEI4 $384
+LABELV $386
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $387
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRGP4 $356
+JUMPV
+LABELV $387
+LABELV $384
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI1
+ASGNI1
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $355
+ADDRGP4 $354
+JUMPV
+LABELV $356
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $346
+endproc CG_GetToken 36 4
+export CG_GetTokenGameType
+proc CG_GetTokenGameType 36 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+LABELV $390
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $392
+ADDRGP4 $351
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $389
+JUMPV
+LABELV $392
+ADDRFP4 12
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $394
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+RETP4
+ADDRGP4 $389
+JUMPV
+LABELV $394
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $399
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $398
+JUMPV
+LABELV $399
+ADDRLP4 12
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 9
+EQI4 $401
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+LTI4 $403
+ADDRLP4 12
+INDIRI4
+CNSTI4 126
+LEI4 $401
+LABELV $403
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $398
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRGP4 $398
+JUMPV
+LABELV $401
+ADDRLP4 16
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+EQI4 $411
+ADDRLP4 16
+INDIRI4
+CNSTI4 9
+EQI4 $411
+ADDRLP4 16
+INDIRI4
+CNSTI4 39
+EQI4 $411
+ADDRLP4 16
+INDIRI4
+CNSTI4 34
+EQI4 $411
+ADDRLP4 16
+INDIRI4
+CNSTI4 44
+NEI4 $406
+LABELV $411
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $398
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $397
+JUMPV
+LABELV $406
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $414
+ADDRLP4 20
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 47
+EQI4 $420
+ADDRLP4 20
+INDIRI4
+CNSTI4 45
+EQI4 $420
+ADDRLP4 20
+INDIRI4
+CNSTI4 43
+EQI4 $420
+ADDRLP4 20
+INDIRI4
+CNSTI4 42
+EQI4 $420
+ADDRLP4 20
+INDIRI4
+CNSTI4 40
+EQI4 $420
+ADDRLP4 20
+INDIRI4
+CNSTI4 41
+NEI4 $414
+LABELV $420
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $421
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRGP4 $398
+JUMPV
+LABELV $421
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI1
+ASGNI1
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $398
+JUMPV
+LABELV $414
+ADDRLP4 24
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 33
+LTI4 $425
+ADDRLP4 24
+INDIRI4
+CNSTI4 126
+LEI4 $423
+LABELV $425
+ADDRGP4 $398
+JUMPV
+LABELV $423
+ADDRLP4 28
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 123
+EQI4 $428
+ADDRLP4 28
+INDIRI4
+CNSTI4 125
+NEI4 $426
+LABELV $428
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $429
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRGP4 $398
+JUMPV
+LABELV $429
+LABELV $426
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI1
+ASGNI1
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $397
+ADDRGP4 $396
+JUMPV
+LABELV $398
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $389
+endproc CG_GetTokenGameType 36 4
+export CG_LStrip
+proc CG_LStrip 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $433
+JUMPV
+LABELV $432
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $435
+ADDRGP4 $431
+JUMPV
+LABELV $435
+ADDRLP4 4
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 33
+LTI4 $437
+ADDRLP4 4
+INDIRI4
+CNSTI4 126
+GTI4 $437
+ADDRGP4 $431
+JUMPV
+LABELV $437
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $433
+ADDRGP4 $432
+JUMPV
+LABELV $431
+endproc CG_LStrip 12 0
+export CG_StripSlashComments
+proc CG_StripSlashComments 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $443
+ADDRGP4 $442
+JUMPV
+LABELV $443
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $445
+ADDRGP4 $442
+JUMPV
+LABELV $445
+ADDRLP4 16
+CNSTI4 47
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 16
+INDIRI4
+NEI4 $447
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 16
+INDIRI4
+NEI4 $447
+ADDRFP4 0
+INDIRP4
+CNSTI1 10
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $442
+JUMPV
+LABELV $447
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $441
+ADDRGP4 $440
+JUMPV
+LABELV $442
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+GEI4 $449
+ADDRGP4 $439
+JUMPV
+LABELV $449
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRGP4 $452
+JUMPV
+LABELV $451
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 33
+LTI4 $454
+ADDRLP4 16
+INDIRI4
+CNSTI4 126
+GTI4 $454
+ADDRGP4 $453
+JUMPV
+LABELV $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI1 10
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+LABELV $452
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+GTU4 $451
+LABELV $453
+LABELV $439
+endproc CG_StripSlashComments 20 4
+export CG_CleanString
+proc CG_CleanString 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $458
+JUMPV
+LABELV $457
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $460
+ADDRGP4 $459
+JUMPV
+LABELV $460
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 9
+NEI4 $462
+ADDRFP4 0
+INDIRP4
+CNSTI1 32
+ASGNI1
+ADDRGP4 $463
+JUMPV
+LABELV $462
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+EQI4 $467
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $467
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $464
+LABELV $467
+ADDRFP4 0
+INDIRP4
+CNSTI1 10
+ASGNI1
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $470
+ADDRLP4 4
+INDIRI4
+CNSTI4 126
+LEI4 $468
+LABELV $470
+ADDRFP4 0
+INDIRP4
+CNSTI1 32
+ASGNI1
+LABELV $468
+LABELV $465
+LABELV $463
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $458
+ADDRGP4 $457
+JUMPV
+LABELV $459
+LABELV $456
+endproc CG_CleanString 8 0
+export CG_Abort
+proc CG_Abort 4 4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 666
+ASGNI4
+LABELV $471
+endproc CG_Abort 4 4
+export CG_ScaleModel
+proc CG_ScaleModel 72 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $473
+endproc CG_ScaleModel 72 0
+bss
+align 1
+LABELV $475
+skip 128
+export CG_GetLocalTimeString
+code
+proc CG_GetLocalTimeString 60 36
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+43236
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $478
+JUMPV
+CNSTI4 672
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $480
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $478
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $481
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 56
+INDIRI4
+ASGNI4
+LABELV $479
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $482
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $482
+ADDRGP4 cg_localTime+12
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $482
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LEI4 $486
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1000
+DIVI4
+ADDI4
+ASGNI4
+LABELV $486
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+ADDRGP4 $483
+JUMPV
+LABELV $482
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+LABELV $483
+ADDRGP4 cg_localTimeStyle+12
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRGP4 $475
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 MonthAbbrev
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1900
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $489
+JUMPV
+LABELV $488
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 12
+GEI4 $497
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+INDIRI4
+ADDRLP4 52
+INDIRI4
+GEI4 $498
+ADDRLP4 0+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 $498
+JUMPV
+LABELV $497
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 12
+LTI4 $504
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 13
+LTI4 $507
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 12
+SUBI4
+ASGNI4
+LABELV $507
+LABELV $504
+LABELV $498
+ADDRGP4 $475
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $520
+ADDRLP4 52
+ADDRGP4 $514
+ASGNP4
+ADDRGP4 $521
+JUMPV
+LABELV $520
+ADDRLP4 52
+ADDRGP4 $515
+ASGNP4
+LABELV $521
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 MonthAbbrev
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1900
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $489
+ADDRGP4 $475
+RETP4
+LABELV $474
+endproc CG_GetLocalTimeString 60 36
+bss
+align 1
+LABELV $523
+skip 128
+export CG_GetTimeString
+code
+proc CG_GetTimeString 28 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $524
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $529
+ADDRFP4 0
+INDIRI4
+CNSTI4 2147483647
+LTI4 $527
+LABELV $529
+ADDRGP4 $523
+CNSTI1 45
+ASGNI1
+ADDRGP4 $523+1
+CNSTI1 0
+ASGNI1
+ADDRGP4 $523
+RETP4
+ADDRGP4 $522
+JUMPV
+LABELV $527
+LABELV $524
+ADDRLP4 16
+CNSTI4 1000
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 60
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $523
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $523
+RETP4
+LABELV $522
+endproc CG_GetTimeString 28 24
+export CG_CheckQlVersion
+proc CG_CheckQlVersion 0 0
+ADDRGP4 cgs+1957480
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LEI4 $533
+CNSTI4 1
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $533
+ADDRGP4 cgs+1957480
+INDIRI4
+ADDRFP4 0
+INDIRI4
+GEI4 $536
+CNSTI4 0
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $536
+ADDRGP4 cgs+1957480+4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LEI4 $539
+CNSTI4 1
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $539
+ADDRGP4 cgs+1957480+4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+GEI4 $543
+CNSTI4 0
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $543
+ADDRGP4 cgs+1957480+8
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $547
+CNSTI4 1
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $547
+ADDRGP4 cgs+1957480+8
+INDIRI4
+ADDRFP4 8
+INDIRI4
+GEI4 $551
+CNSTI4 0
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $551
+ADDRGP4 cgs+1957480+12
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LEI4 $555
+CNSTI4 1
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $555
+ADDRGP4 cgs+1957480+12
+INDIRI4
+ADDRFP4 12
+INDIRI4
+GEI4 $559
+CNSTI4 0
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $559
+CNSTI4 1
+RETI4
+LABELV $532
+endproc CG_CheckQlVersion 0 0
+export CG_CheckCpmaVersion
+proc CG_CheckCpmaVersion 0 0
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $564
+CNSTI4 0
+RETI4
+ADDRGP4 $563
+JUMPV
+LABELV $564
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cgs+1957756
+INDIRI4
+GEI4 $567
+CNSTI4 1
+RETI4
+ADDRGP4 $563
+JUMPV
+LABELV $567
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cgs+1957756
+INDIRI4
+LEI4 $570
+CNSTI4 0
+RETI4
+ADDRGP4 $563
+JUMPV
+LABELV $570
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+1957760
+INDIRI4
+GTI4 $573
+CNSTI4 1
+RETI4
+ADDRGP4 $563
+JUMPV
+LABELV $573
+CNSTI4 0
+RETI4
+ADDRGP4 $563
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $563
+endproc CG_CheckCpmaVersion 0 0
+export CG_EntityFrozen
+proc CG_EntityFrozen 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+607704
+CVPU4 4
+NEU4 $577
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $578
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1496
+DIVI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+3878952
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $584
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $584
+LABELV $578
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $576
+endproc CG_EntityFrozen 4 0
+export CG_GameTimeout
+proc CG_GameTimeout 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $588
+ADDRGP4 cgs+45340
+INDIRI4
+CNSTI4 0
+EQI4 $589
+ADDRGP4 cgs+45344
+INDIRI4
+CNSTI4 0
+NEI4 $594
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $589
+JUMPV
+LABELV $594
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+45344
+INDIRI4
+GEI4 $589
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $589
+JUMPV
+LABELV $588
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+EQI4 $601
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cgs+45344
+INDIRI4
+GEI4 $604
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $604
+LABELV $601
+LABELV $589
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $587
+endproc CG_GameTimeout 4 0
+proc predict_player_position 92 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 68
+CNSTF4 1145569280
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg+607152
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $613
+ADDRLP4 84
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 68
+INDIRF4
+NEGF4
+MULF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $613
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRLP4 88
+CNSTP4 0
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Wolfcam_WeaponTrace
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+LABELV $608
+endproc predict_player_position 92 28
+proc rocket_flight_time 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $617
+ADDRGP4 $619
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTF4 3212836864
+RETF4
+ADDRGP4 $616
+JUMPV
+LABELV $617
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1096810496
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1110704128
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 897988541
+GTF4 $622
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $622
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+DIVF4
+RETF4
+LABELV $616
+endproc rocket_flight_time 36 8
+export CG_Rocket_Aim
+proc CG_Rocket_Aim 88 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+1969972
+INDIRF4
+ASGNF4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $626
+ADDRLP4 32
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+12+12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $627
+JUMPV
+LABELV $626
+ADDRLP4 32
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $627
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 rocket_flight_time
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRGP4 predict_player_position
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 40
+ASGNI4
+ADDRLP4 44
+CNSTF4 1107296256
+ADDRLP4 28
+INDIRF4
+DIVF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $635
+JUMPV
+LABELV $632
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 rocket_flight_time
+CALLF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRGP4 predict_player_position
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 rocket_flight_time
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 64
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $636
+ADDRGP4 $638
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $636
+ADDRLP4 12
+INDIRF4
+ADDRLP4 44
+INDIRF4
+GEF4 $640
+ADDRLP4 12
+INDIRF4
+ADDRLP4 44
+INDIRF4
+NEGF4
+LEF4 $640
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $642
+ADDRGP4 $644
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $642
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRGP4 $624
+JUMPV
+LABELV $640
+ADDRLP4 64
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LEF4 $645
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $647
+ADDRGP4 $649
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $647
+ADDRLP4 60
+ADDRLP4 60
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+DIVF4
+CNSTF4 1065353216
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $646
+JUMPV
+LABELV $645
+ADDRLP4 64
+INDIRF4
+ADDRLP4 60
+INDIRF4
+GEF4 $651
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $653
+ADDRGP4 $655
+ARGP4
+ADDRGP4 cg+607152
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $653
+ADDRLP4 60
+ADDRLP4 60
+INDIRF4
+CNSTF4 1065353216
+CNSTF4 1036831949
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+DIVF4
+SUBF4
+MULF4
+ASGNF4
+LABELV $651
+LABELV $646
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRGP4 predict_player_position
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+LABELV $633
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $635
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $632
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $624
+ADDRGP4 $659
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $624
+endproc CG_Rocket_Aim 88 16
+export CG_ClientInSnapshot
+proc CG_ClientInSnapshot 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $663
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $661
+LABELV $663
+CNSTI4 0
+RETI4
+ADDRGP4 $660
+JUMPV
+LABELV $661
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $664
+CNSTI4 0
+RETI4
+ADDRGP4 $660
+JUMPV
+LABELV $664
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $667
+CNSTI4 1
+RETI4
+ADDRGP4 $660
+JUMPV
+LABELV $667
+CNSTI4 1496
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+476
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $670
+CNSTI4 1
+RETI4
+ADDRGP4 $660
+JUMPV
+LABELV $670
+CNSTI4 0
+RETI4
+LABELV $660
+endproc CG_ClientInSnapshot 4 0
+export CG_NumPlayers
+proc CG_NumPlayers 16 0
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $674
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $679
+ADDRGP4 $675
+JUMPV
+LABELV $679
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $681
+ADDRGP4 $675
+JUMPV
+LABELV $681
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $675
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $674
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $673
+endproc CG_NumPlayers 16 0
+export CG_ScoresEqual
+proc CG_ScoresEqual 0 0
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 2
+NEI4 $684
+ADDRFP4 0
+INDIRI4
+CNSTI4 2147483647
+LTI4 $687
+ADDRFP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $687
+ADDRFP4 4
+INDIRI4
+CNSTI4 2147483647
+LTI4 $689
+ADDRFP4 4
+CNSTI4 -1
+ASGNI4
+LABELV $689
+LABELV $684
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $691
+CNSTI4 1
+RETI4
+ADDRGP4 $683
+JUMPV
+LABELV $691
+CNSTI4 0
+RETI4
+LABELV $683
+endproc CG_ScoresEqual 0 0
+export CG_CpmaIsRoundWarmup
+proc CG_CpmaIsRoundWarmup 36 8
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 4
+NEI4 $694
+CNSTI4 710
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $697
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LEI4 $698
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+LEI4 $698
+CNSTI4 1
+RETI4
+ADDRGP4 $693
+JUMPV
+LABELV $698
+CNSTI4 672
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_ConfigStringNoConvert
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $697
+ARGP4
+ADDRLP4 28
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $701
+CNSTI4 1
+RETI4
+ADDRGP4 $693
+JUMPV
+LABELV $701
+LABELV $694
+CNSTI4 0
+RETI4
+LABELV $693
+endproc CG_CpmaIsRoundWarmup 36 8
+export CG_IsCpmaMvd
+proc CG_IsCpmaMvd 0 0
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $708
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $704
+LABELV $708
+CNSTI4 0
+RETI4
+ADDRGP4 $703
+JUMPV
+LABELV $704
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $709
+CNSTI4 0
+RETI4
+ADDRGP4 $703
+JUMPV
+LABELV $709
+CNSTI4 4524
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $712
+CNSTI4 0
+RETI4
+ADDRGP4 $703
+JUMPV
+LABELV $712
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $717
+CNSTI4 1
+RETI4
+ADDRGP4 $703
+JUMPV
+LABELV $717
+CNSTI4 0
+RETI4
+LABELV $703
+endproc CG_IsCpmaMvd 0 0
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import Wolfcam_WeaponTrace
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $697
+byte 1 116
+byte 1 119
+byte 1 0
+align 1
+LABELV $659
+byte 1 94
+byte 1 49
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $655
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $649
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $644
+byte 1 94
+byte 1 53
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $638
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $619
+byte 1 94
+byte 1 49
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 102
+byte 1 41
+byte 1 32
+byte 1 60
+byte 1 61
+byte 1 32
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $531
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 51
+byte 1 100
+byte 1 0
+align 1
+LABELV $515
+byte 1 112
+byte 1 109
+byte 1 0
+align 1
+LABELV $514
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $511
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $491
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $481
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $480
+byte 1 105
+byte 1 0
+align 1
+LABELV $472
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $351
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $338
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 83
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $215
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 99
+byte 1 51
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $196
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $166
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
@@ -0,0 +1,6278 @@
+code
+proc BG_cleanName 28 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $151
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $154
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $157
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $158
+JUMPV
+LABELV $157
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+LABELV $158
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $155
+JUMPV
+LABELV $154
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+GEI4 $162
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $161
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+NEI4 $161
+LABELV $162
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 126
+LEI4 $159
+LABELV $161
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $160
+JUMPV
+LABELV $159
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $160
+LABELV $155
+LABELV $152
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $163
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+CNSTU4 1
+SUBU4
+LTU4 $151
+LABELV $163
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+RETI4
+LABELV $150
+endproc BG_cleanName 28 0
+export Wolfcam_List_Player_Models_f
+proc Wolfcam_List_Player_Models_f 12 16
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $165
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+341048
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $170
+ADDRGP4 $166
+JUMPV
+LABELV $170
+ADDRGP4 $172
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $166
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $165
+LABELV $164
+endproc Wolfcam_List_Player_Models_f 12 16
+export Wolfcam_Players_f
+proc Wolfcam_Players_f 24 20
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $174
+ADDRLP4 0
+CNSTI4 4524
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $179
+ADDRGP4 $175
+JUMPV
+LABELV $179
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $181
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+GTI4 $181
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $188
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $188
+address $187
+address $184
+address $185
+address $186
+code
+LABELV $184
+ADDRLP4 12
+CNSTI1 49
+ASGNI1
+ADDRGP4 $182
+JUMPV
+LABELV $185
+ADDRLP4 12
+CNSTI1 52
+ASGNI1
+ADDRGP4 $182
+JUMPV
+LABELV $186
+ADDRLP4 12
+CNSTI1 51
+ASGNI1
+ADDRGP4 $182
+JUMPV
+LABELV $187
+ADDRLP4 12
+CNSTI1 55
+ASGNI1
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 12
+CNSTI1 54
+ASGNI1
+LABELV $182
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 2252
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $189
+ADDRGP4 $191
+ARGP4
+ADDRLP4 12
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRGP4 $192
+ARGP4
+ADDRLP4 12
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $190
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $193
+ADDRLP4 0
+INDIRP4
+CNSTI4 3476
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $196
+ADDRGP4 $198
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 3476
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $196
+LABELV $193
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+4
+INDIRI4
+NEI4 $199
+ADDRGP4 $202
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $200
+JUMPV
+LABELV $199
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $203
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $203
+ADDRGP4 $207
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $203
+LABELV $200
+ADDRGP4 $208
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $175
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $174
+LABELV $173
+endproc Wolfcam_Players_f 24 20
+export Wolfcam_Playersw_f
+proc Wolfcam_Playersw_f 84 16
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $210
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $215
+ADDRGP4 $211
+JUMPV
+LABELV $215
+ADDRLP4 76
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+LTI4 $217
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+GTI4 $217
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $224
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $224
+address $223
+address $220
+address $221
+address $222
+code
+LABELV $220
+ADDRLP4 72
+CNSTI1 49
+ASGNI1
+ADDRGP4 $218
+JUMPV
+LABELV $221
+ADDRLP4 72
+CNSTI1 52
+ASGNI1
+ADDRGP4 $218
+JUMPV
+LABELV $222
+ADDRLP4 72
+CNSTI1 51
+ASGNI1
+ADDRGP4 $218
+JUMPV
+LABELV $223
+ADDRLP4 72
+CNSTI1 55
+ASGNI1
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRLP4 72
+CNSTI1 54
+ASGNI1
+LABELV $218
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTU4 64
+ARGU4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_cleanName
+CALLI4
+pop
+ADDRGP4 $225
+ARGP4
+ADDRLP4 72
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $211
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $210
+LABELV $209
+endproc Wolfcam_Playersw_f 84 16
+export Wolfcam_Follow_f
+proc Wolfcam_Follow_f 108 16
+ADDRLP4 68
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+GEI4 $227
+ADDRGP4 $229
+ARGP4
+ADDRGP4 wcg
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 0
+NEI4 $230
+ADDRGP4 $233
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $231
+JUMPV
+LABELV $230
+CNSTI4 4524
+ADDRGP4 wcg
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTU4 64
+ARGU4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_cleanName
+CALLI4
+pop
+ADDRGP4 $236
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 2
+NEI4 $237
+ADDRGP4 $240
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $238
+JUMPV
+LABELV $237
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 3
+NEI4 $241
+ADDRGP4 $244
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $241
+LABELV $238
+LABELV $231
+ADDRGP4 $245
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $226
+JUMPV
+LABELV $227
+CNSTI4 1
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $248
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $246
+ADDRGP4 wcg+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $246
+CNSTI4 1
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $251
+ADDRGP4 wcg+8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $251
+CNSTI4 1
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GTI4 $257
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+GEI4 $255
+LABELV $257
+ADDRGP4 $258
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $226
+JUMPV
+LABELV $255
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $259
+ADDRLP4 100
+CNSTI4 -1
+ASGNI4
+ADDRGP4 wcg
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+8
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 cg+1332116
+CNSTI4 0
+ASGNI4
+CNSTI4 4524
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $264
+ADDRGP4 $269
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $270
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $270
+ADDRGP4 $269
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $271
+JUMPV
+LABELV $270
+ADDRGP4 $274
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $271
+LABELV $265
+ADDRGP4 $275
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $226
+JUMPV
+LABELV $259
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $276
+ADDRGP4 $279
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $226
+JUMPV
+LABELV $276
+ADDRGP4 wcg
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+8
+CNSTI4 1
+ASGNI4
+LABELV $250
+ADDRGP4 wolfcam_following
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+1332116
+CNSTI4 0
+ASGNI4
+ADDRGP4 $283
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $284
+ADDRGP4 $275
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $285
+JUMPV
+LABELV $284
+ADDRGP4 $288
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $285
+LABELV $226
+endproc Wolfcam_Follow_f 108 16
+export Wolfcam_Server_Info_f
+proc Wolfcam_Server_Info_f 8 8
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $290
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $289
+endproc Wolfcam_Server_Info_f 8 8
+proc print_ind_weap_stats 32 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+CNSTU4 1000
+GEU4 $292
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+CNSTU4 100
+GEU4 $295
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $295
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+CNSTU4 10
+GEU4 $297
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $297
+ADDRGP4 $299
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ARGU4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+CNSTU4 1000
+GEU4 $300
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $300
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+CNSTU4 100
+GEU4 $302
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $302
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+CNSTU4 10
+GEU4 $304
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $304
+ADDRGP4 $299
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ARGU4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $306
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+CNSTU4 10000
+GEU4 $307
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $307
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+CNSTU4 1000
+GEU4 $309
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $309
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+CNSTU4 100
+GEU4 $311
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $311
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+CNSTU4 10
+GEU4 $313
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $313
+ADDRGP4 $315
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ARGU4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRU4
+CNSTU4 10000
+GEU4 $316
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $316
+ADDRFP4 0
+INDIRP4
+INDIRU4
+CNSTU4 1000
+GEU4 $318
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $318
+ADDRFP4 0
+INDIRP4
+INDIRU4
+CNSTU4 100
+GEU4 $320
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $320
+ADDRFP4 0
+INDIRP4
+INDIRU4
+CNSTU4 10
+GEU4 $322
+ADDRGP4 $294
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $322
+ADDRGP4 $299
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRU4
+ARGU4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $324
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 4
+INDIRU4
+EQU4 $325
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRU4
+EQU4 $325
+ADDRGP4 $327
+ARGP4
+ADDRLP4 8
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+CNSTU4 1
+ASGNU4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRU4
+ASGNU4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 16
+INDIRU4
+ADDRLP4 20
+INDIRI4
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 16
+INDIRU4
+ADDRLP4 24
+INDIRU4
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 28
+INDIRU4
+ADDRLP4 20
+INDIRI4
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 28
+INDIRU4
+ADDRLP4 24
+INDIRU4
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+DIVF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $325
+LABELV $326
+ADDRGP4 $208
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $291
+endproc print_ind_weap_stats 32 8
+proc wolfcam_reset_weapon_stats 12 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRGP4 $331
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $328
+JUMPV
+LABELV $329
+ADDRLP4 8
+CNSTI4 2392
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 688
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 692
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 696
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 736
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $332
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 36
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $333
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $335
+ADDRLP4 0
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $332
+LABELV $328
+endproc wolfcam_reset_weapon_stats 12 12
+proc wolfcam_calc_averages 36 12
+ADDRGP4 totalKills
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 60
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 totalWarp
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 totalWarpSeverity
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 totalClients
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $337
+CNSTI4 4524
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $341
+ADDRGP4 $338
+JUMPV
+LABELV $341
+ADDRLP4 12
+CNSTI4 2392
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $344
+ADDRGP4 $338
+JUMPV
+LABELV $344
+ADDRLP4 24
+ADDRGP4 totalClients
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $346
+ADDRLP4 28
+ADDRGP4 totalWarp
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $346
+ADDRLP4 12
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $348
+ADDRLP4 28
+ADDRGP4 totalWarpSeverity
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRI4
+DIVI4
+ADDI4
+ASGNI4
+LABELV $348
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $350
+ADDRLP4 4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 736
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 totalKills
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CVIU4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $351
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $353
+ADDRLP4 0
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $350
+LABELV $338
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 64
+LTI4 $337
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $357
+JUMPV
+LABELV $354
+ADDRLP4 8
+CNSTI4 5128
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 woldclients
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $358
+ADDRGP4 $355
+JUMPV
+LABELV $358
+ADDRLP4 24
+ADDRGP4 totalClients
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4556
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $360
+ADDRLP4 28
+ADDRGP4 totalWarp
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4552
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4556
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $360
+ADDRLP4 8
+INDIRP4
+CNSTI4 4552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $362
+ADDRLP4 28
+ADDRGP4 totalWarpSeverity
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4560
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4552
+ADDP4
+INDIRI4
+DIVI4
+ADDI4
+ASGNI4
+LABELV $362
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $367
+JUMPV
+LABELV $364
+ADDRLP4 4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4588
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 totalKills
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CVIU4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $365
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $367
+ADDRLP4 0
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $364
+LABELV $355
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $357
+ADDRLP4 16
+INDIRI4
+ADDRGP4 wnumOldClients
+INDIRI4
+LTI4 $354
+ADDRGP4 totalClients
+INDIRI4
+CNSTI4 0
+LEI4 $368
+ADDRLP4 24
+ADDRGP4 totalClients
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 avgWarp
+ADDRGP4 totalWarp
+INDIRF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 avgSeverity
+ADDRGP4 totalWarpSeverity
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $369
+JUMPV
+LABELV $368
+ADDRGP4 avgWarp
+CNSTF4 0
+ASGNF4
+ADDRGP4 avgSeverity
+CNSTI4 0
+ASGNI4
+LABELV $369
+LABELV $336
+endproc wolfcam_calc_averages 36 12
+proc wolfcam_print_weapon_stats 188 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $371
+ADDRGP4 $370
+JUMPV
+LABELV $371
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $374
+ADDRLP4 68
+CNSTI4 5128
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 woldclients
+ADDP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 5128
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 72
+INDIRI4
+ADDRGP4 woldclients+16
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 72
+INDIRI4
+ADDRGP4 woldclients+16+4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 72
+INDIRI4
+ADDRGP4 woldclients+4540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 72
+INDIRI4
+ADDRGP4 woldclients+4544
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 72
+INDIRI4
+ADDRGP4 woldclients+4548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 68
+INDIRP4
+CNSTI4 4552
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 68
+INDIRP4
+CNSTI4 4556
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 68
+INDIRP4
+CNSTI4 4560
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 68
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 68
+INDIRP4
+CNSTI4 4572
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 68
+INDIRP4
+CNSTI4 4576
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 68
+INDIRP4
+CNSTI4 4584
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+CNSTI4 4564
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 68
+INDIRP4
+CNSTI4 4568
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 woldclients+4588
+ADDP4
+ASGNP4
+ADDRGP4 $375
+JUMPV
+LABELV $374
+ADDRLP4 68
+CNSTI4 2392
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+ASGNP4
+ADDRLP4 76
+CNSTI4 4524
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 76
+INDIRI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 76
+INDIRI4
+ADDRGP4 cgs+51512+4
+ADDP4
+ASGNP4
+ADDRLP4 80
+CNSTI4 2392
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 80
+INDIRI4
+ADDRGP4 wclients+688
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 80
+INDIRI4
+ADDRGP4 wclients+692
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 80
+INDIRI4
+ADDRGP4 wclients+696
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 68
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 68
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 68
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 68
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 68
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 68
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 68
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 68
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+ADDRGP4 wclients+736
+ADDP4
+ASGNP4
+LABELV $375
+ADDRGP4 $390
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $391
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $392
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $393
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+LEI4 $395
+ADDRLP4 68
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 68
+CNSTF4 3212836864
+ASGNF4
+LABELV $396
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+4
+INDIRI4
+EQI4 $404
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $397
+CNSTI4 4524
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+196
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $397
+LABELV $404
+ADDRGP4 $405
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRGP4 $406
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $398
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LEI4 $407
+ADDRLP4 88
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ADDRGP4 avgWarp
+INDIRF4
+LEF4 $409
+ADDRGP4 $411
+ARGP4
+ADDRLP4 92
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRF4
+ADDRGP4 avgWarp
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $408
+JUMPV
+LABELV $409
+ADDRLP4 88
+INDIRF4
+ADDRGP4 avgWarp
+INDIRF4
+GEF4 $412
+ADDRGP4 $414
+ARGP4
+ADDRLP4 92
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRGP4 avgWarp
+INDIRF4
+ADDRLP4 92
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $408
+JUMPV
+LABELV $412
+ADDRGP4 $415
+ARGP4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+DIVF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $408
+JUMPV
+LABELV $407
+ADDRGP4 $416
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $408
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $417
+ADDRLP4 88
+ADDRLP4 60
+INDIRI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRGP4 avgSeverity
+INDIRI4
+LEI4 $419
+ADDRGP4 $421
+ARGP4
+ADDRLP4 92
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ADDRGP4 avgSeverity
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $418
+JUMPV
+LABELV $419
+ADDRLP4 88
+INDIRI4
+ADDRGP4 avgSeverity
+INDIRI4
+GEI4 $422
+ADDRGP4 $424
+ARGP4
+ADDRLP4 92
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 avgSeverity
+INDIRI4
+ADDRLP4 92
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $418
+JUMPV
+LABELV $422
+ADDRGP4 $425
+ARGP4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $418
+JUMPV
+LABELV $417
+ADDRGP4 $208
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $418
+ADDRGP4 $426
+ARGP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $428
+ADDRLP4 88
+ADDRLP4 52
+INDIRI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $429
+JUMPV
+LABELV $428
+ADDRLP4 88
+CNSTI4 -1
+ASGNI4
+LABELV $429
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 28
+INDIRP4
+CNSTI4 2144
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $430
+ADDRGP4 $432
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 2148
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $430
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 96
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDRLP4 96
+INDIRU4
+NEU4 $436
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ADDRLP4 96
+INDIRU4
+NEU4 $436
+ADDRLP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 96
+INDIRU4
+EQU4 $433
+LABELV $436
+ADDRGP4 $437
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $433
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+ASGNP4
+ADDRLP4 104
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDRLP4 104
+INDIRU4
+NEU4 $441
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ADDRLP4 104
+INDIRU4
+NEU4 $441
+ADDRLP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 104
+INDIRU4
+EQU4 $438
+LABELV $441
+ADDRGP4 $442
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $438
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 112
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDRLP4 112
+INDIRU4
+NEU4 $446
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ADDRLP4 112
+INDIRU4
+NEU4 $446
+ADDRLP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 112
+INDIRU4
+EQU4 $443
+LABELV $446
+ADDRGP4 $447
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $443
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 504
+ADDP4
+ASGNP4
+ADDRLP4 120
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDRLP4 120
+INDIRU4
+NEU4 $451
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ADDRLP4 120
+INDIRU4
+NEU4 $451
+ADDRLP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 120
+INDIRU4
+EQU4 $448
+LABELV $451
+ADDRGP4 $452
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $448
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 160
+CNSTU4 0
+ASGNU4
+ADDRLP4 124+24
+INDIRU4
+ADDRLP4 160
+INDIRU4
+NEU4 $458
+ADDRLP4 124+28
+INDIRU4
+ADDRLP4 160
+INDIRU4
+NEU4 $458
+ADDRLP4 124
+INDIRU4
+ADDRLP4 160
+INDIRU4
+EQU4 $453
+LABELV $458
+ADDRGP4 $459
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 124
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $453
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ASGNP4
+ADDRLP4 128
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDRLP4 128
+INDIRU4
+NEU4 $463
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ADDRLP4 128
+INDIRU4
+NEU4 $463
+ADDRLP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 128
+INDIRU4
+EQU4 $460
+LABELV $463
+ADDRGP4 $464
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $460
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+ASGNP4
+ADDRLP4 136
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDRLP4 136
+INDIRU4
+NEU4 $468
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ADDRLP4 136
+INDIRU4
+NEU4 $468
+ADDRLP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 136
+INDIRU4
+EQU4 $465
+LABELV $468
+ADDRGP4 $469
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $465
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+ASGNP4
+ADDRLP4 144
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDRLP4 144
+INDIRU4
+NEU4 $473
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ADDRLP4 144
+INDIRU4
+NEU4 $473
+ADDRLP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 144
+INDIRU4
+EQU4 $470
+LABELV $473
+ADDRGP4 $474
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $470
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 252
+ADDP4
+ASGNP4
+ADDRLP4 152
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDRLP4 152
+INDIRU4
+NEU4 $478
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ADDRLP4 152
+INDIRU4
+NEU4 $478
+ADDRLP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 152
+INDIRU4
+EQU4 $475
+LABELV $478
+ADDRGP4 $479
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $475
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 324
+ADDP4
+ASGNP4
+ADDRLP4 160
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDRLP4 160
+INDIRU4
+NEU4 $483
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ADDRLP4 160
+INDIRU4
+NEU4 $483
+ADDRLP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 160
+INDIRU4
+EQU4 $480
+LABELV $483
+ADDRGP4 $484
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $480
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 396
+ADDP4
+ASGNP4
+ADDRLP4 168
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDRLP4 168
+INDIRU4
+NEU4 $488
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ADDRLP4 168
+INDIRU4
+NEU4 $488
+ADDRLP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 168
+INDIRU4
+EQU4 $485
+LABELV $488
+ADDRGP4 $489
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $485
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 432
+ADDP4
+ASGNP4
+ADDRLP4 176
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDRLP4 176
+INDIRU4
+NEU4 $493
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ADDRLP4 176
+INDIRU4
+NEU4 $493
+ADDRLP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 176
+INDIRU4
+EQU4 $490
+LABELV $493
+ADDRGP4 $494
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $490
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+ASGNP4
+ADDRLP4 184
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+ADDRLP4 184
+INDIRU4
+NEU4 $498
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRU4
+ADDRLP4 184
+INDIRU4
+NEU4 $498
+ADDRLP4 0
+INDIRP4
+INDIRU4
+ADDRLP4 184
+INDIRU4
+EQU4 $495
+LABELV $498
+ADDRGP4 $499
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 print_ind_weap_stats
+CALLV
+pop
+LABELV $495
+LABELV $370
+endproc wolfcam_print_weapon_stats 188 24
+export Wolfcam_Weapon_Stats_f
+proc Wolfcam_Weapon_Stats_f 16 8
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $501
+ADDRGP4 $504
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $500
+JUMPV
+LABELV $501
+ADDRLP4 4
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+GEI4 $505
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $507
+ADDRLP4 0
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $506
+JUMPV
+LABELV $507
+ADDRLP4 0
+ADDRGP4 cg+4
+INDIRI4
+ASGNI4
+ADDRGP4 $506
+JUMPV
+LABELV $505
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $506
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $511
+ADDRLP4 0
+ADDRGP4 cg+4
+INDIRI4
+ASGNI4
+LABELV $511
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $516
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $514
+LABELV $516
+ADDRGP4 $517
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $500
+JUMPV
+LABELV $514
+ADDRGP4 wolfcam_calc_averages
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 wolfcam_print_weapon_stats
+CALLV
+pop
+LABELV $500
+endproc Wolfcam_Weapon_Stats_f 16 8
+export Wolfcam_Weapon_Statsall_f
+proc Wolfcam_Weapon_Statsall_f 8 12
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $519
+ADDRGP4 $504
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $518
+JUMPV
+LABELV $519
+ADDRGP4 wolfcam_calc_averages
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $522
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $526
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 wolfcam_print_weapon_stats
+CALLV
+pop
+ADDRGP4 $208
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $526
+LABELV $523
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $522
+ADDRGP4 wnumOldClients
+INDIRI4
+CNSTI4 0
+EQI4 $529
+ADDRGP4 $531
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $535
+JUMPV
+LABELV $532
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 wolfcam_print_weapon_stats
+CALLV
+pop
+ADDRGP4 $208
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $533
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $535
+ADDRLP4 0
+INDIRI4
+ADDRGP4 wnumOldClients
+INDIRI4
+LTI4 $532
+LABELV $529
+ADDRGP4 $390
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $536
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $537
+ARGP4
+ADDRGP4 avgWarp
+INDIRF4
+ARGF4
+ADDRGP4 avgSeverity
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $541
+JUMPV
+LABELV $538
+ADDRGP4 $542
+ARGP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 totalKills
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 weapNamesCasual
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $539
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $541
+ADDRLP4 0
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $538
+ADDRGP4 totalKills
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 60
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 totalWarp
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 totalWarpSeverity
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 totalClients
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 avgWarp
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 avgSeverity
+CNSTI4 -1
+ASGNI4
+LABELV $518
+endproc Wolfcam_Weapon_Statsall_f 8 12
+export Wolfcam_Reset_Weapon_Stats_f
+proc Wolfcam_Reset_Weapon_Stats_f 4 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $544
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $548
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 wolfcam_reset_weapon_stats
+CALLV
+pop
+LABELV $548
+LABELV $545
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $544
+ADDRGP4 woldclients
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 328192
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 wnumOldClients
+CNSTI4 0
+ASGNI4
+LABELV $543
+endproc Wolfcam_Reset_Weapon_Stats_f 4 12
+bss
+align 4
+LABELV avgSeverity
+skip 4
+align 4
+LABELV avgWarp
+skip 4
+align 4
+LABELV totalClients
+skip 4
+align 4
+LABELV totalWarpSeverity
+skip 4
+align 4
+LABELV totalWarp
+skip 4
+align 4
+LABELV totalKills
+skip 60
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $542
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $537
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $536
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 94
+byte 1 51
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $531
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 10
+byte 1 10
+byte 1 0
+align 1
+LABELV $517
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $504
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $499
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $494
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $489
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $484
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $479
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $474
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $469
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $464
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $459
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $452
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $447
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $442
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $437
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $432
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $426
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $425
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $424
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 45
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $421
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 43
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $416
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $415
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 51
+byte 1 102
+byte 1 0
+align 1
+LABELV $414
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 51
+byte 1 102
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 45
+byte 1 37
+byte 1 46
+byte 1 51
+byte 1 102
+byte 1 0
+align 1
+LABELV $411
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 51
+byte 1 102
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 43
+byte 1 37
+byte 1 46
+byte 1 51
+byte 1 102
+byte 1 0
+align 1
+LABELV $406
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 0
+align 1
+LABELV $405
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 0
+align 1
+LABELV $393
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $392
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $391
+byte 1 94
+byte 1 55
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 51
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $390
+byte 1 94
+byte 1 49
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $331
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $327
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 0
+align 1
+LABELV $324
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $315
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 0
+align 1
+LABELV $306
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $299
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $294
+byte 1 32
+byte 1 0
+align 1
+LABELV $290
+byte 1 94
+byte 1 52
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $288
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $283
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $279
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $275
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $274
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $269
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $258
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $253
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $248
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $245
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 45
+byte 1 49
+byte 1 39
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 118
+byte 1 10
+byte 1 0
+align 1
+LABELV $244
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 10
+byte 1 0
+align 1
+LABELV $240
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $236
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $233
+byte 1 94
+byte 1 51
+byte 1 60
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 118
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $229
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $225
+byte 1 94
+byte 1 37
+byte 1 99
+byte 1 32
+byte 1 88
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $208
+byte 1 10
+byte 1 0
+align 1
+LABELV $207
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 54
+byte 1 91
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 118
+byte 1 93
+byte 1 0
+align 1
+LABELV $202
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 91
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 93
+byte 1 0
+align 1
+LABELV $198
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 53
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $192
+byte 1 94
+byte 1 37
+byte 1 99
+byte 1 32
+byte 1 88
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $191
+byte 1 94
+byte 1 37
+byte 1 99
+byte 1 32
+byte 1 88
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $172
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
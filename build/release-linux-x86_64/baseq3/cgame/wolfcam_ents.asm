@@ -0,0 +1,4851 @@
+export Wolfcam_MarkValidEntities
+code
+proc Wolfcam_MarkValidEntities 20 0
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $152
+CNSTI4 2392
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $153
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $152
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $159
+JUMPV
+LABELV $156
+ADDRLP4 8
+CNSTI4 1496
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 556
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $162
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 176
+ADDP4
+INDIRI4
+NEI4 $162
+CNSTI4 2392
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 2392
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+16
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $162
+LABELV $157
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $159
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $156
+CNSTI4 2392
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 2392
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 wclients+16
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $151
+endproc Wolfcam_MarkValidEntities 20 0
+proc Wolfcam_ResetPlayerEntity 32 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+NEI4 $174
+LABELV $174
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1120
+ADDP4
+CNSTI4 -99999
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1148
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+CNSTI4 4524
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 948
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1164
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 900
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 48
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 920
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1168
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 924
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 928
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 932
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 948
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 48
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 968
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1168
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 972
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 976
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 980
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1464
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1468
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1472
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $173
+endproc Wolfcam_ResetPlayerEntity 32 16
+proc Wolfcam_ResetEntity 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRGP4 cg+3196916
+INDIRF4
+ARGF4
+ADDRGP4 BG_EvaluateTrajectoryf
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $183
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Wolfcam_ResetPlayerEntity
+CALLV
+pop
+LABELV $183
+LABELV $180
+endproc Wolfcam_ResetEntity 0 16
+proc IsCorpse 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $186
+ADDRLP4 4
+CNSTI4 64
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $186
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $186
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $186
+CNSTI4 1
+RETI4
+ADDRGP4 $185
+JUMPV
+LABELV $186
+CNSTI4 0
+RETI4
+LABELV $185
+endproc IsCorpse 12 0
+export Wolfcam_InterpolateEntityPosition
+proc Wolfcam_InterpolateEntityPosition 1164 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $189
+JUMPV
+ADDRGP4 $193
+ARGP4
+ADDRLP4 604
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+CNSTI4 0
+EQI4 $191
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+LABELV $191
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $189
+ADDRLP4 604
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+1332116
+INDIRI4
+ADDRLP4 604
+INDIRI4
+NEI4 $202
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+ADDRLP4 604
+INDIRI4
+EQI4 $197
+LABELV $202
+ADDRGP4 cg_freecam_useServerView+12
+INDIRI4
+CNSTI4 0
+EQI4 $197
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $197
+ADDRLP4 608
+CNSTI4 0
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+ADDRLP4 608
+INDIRI4
+NEI4 $204
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+ADDRLP4 608
+INDIRI4
+EQI4 $204
+ADDRGP4 cg_freecam_useServerView+12
+INDIRI4
+ADDRLP4 608
+INDIRI4
+EQI4 $204
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $204
+ADDRGP4 wcg+31078456
+INDIRI4
+CNSTI4 4
+GEI4 $209
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $209
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $213
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRGP4 cgs+39680
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 tmpSnapshot
+ARGP4
+ADDRLP4 612
+ADDRGP4 trap_PeekSnapshot
+CALLI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $220
+ADDRGP4 $222
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $220
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRGP4 tmpSnapshot+8
+INDIRI4
+LTI4 $224
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRLP4 92
+ADDRGP4 tmpSnapshot
+ASGNP4
+ADDRGP4 $214
+JUMPV
+LABELV $225
+LABELV $217
+ADDRGP4 $216
+JUMPV
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 92
+ADDRGP4 cg+48
+INDIRP4
+ASGNP4
+LABELV $214
+ADDRLP4 52
+ADDRGP4 cg+607132
+INDIRF4
+ASGNF4
+ADDRLP4 612
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 612
+INDIRI4
+EQI4 $235
+ADDRLP4 108
+INDIRI4
+ADDRLP4 612
+INDIRI4
+NEI4 $235
+ADDRGP4 cg_useOriginalInterpolation+12
+INDIRI4
+ADDRLP4 612
+INDIRI4
+EQI4 $230
+LABELV $235
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $230
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+NEI4 $237
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $237
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $237
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $241
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $241
+ADDRLP4 616
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 616
+INDIRP4
+ADDRLP4 616
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $241
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $245
+ADDRGP4 cg_interpolateMissiles+12
+INDIRI4
+CNSTI4 0
+NEI4 $247
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $247
+LABELV $245
+ADDRLP4 52
+ADDRGP4 cg+607132
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+607704
+CVPU4 4
+EQU4 $252
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 616
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ADDRLP4 616
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 616
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 620
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRLP4 620
+INDIRF4
+ASGNF4
+ADDRLP4 40+4
+INDIRF4
+ARGF4
+ADDRLP4 56+4
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 624
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+ADDRLP4 624
+INDIRF4
+ASGNF4
+ADDRLP4 40+8
+INDIRF4
+ARGF4
+ADDRLP4 56+8
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 628
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+ADDRLP4 628
+INDIRF4
+ASGNF4
+LABELV $252
+ADDRGP4 $269
+ARGP4
+ADDRLP4 616
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+CNSTI4 1
+NEI4 $267
+ADDRLP4 620
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 620+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 620+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+CNSTF4 1116471296
+ADDF4
+ASGNF4
+ADDRLP4 620
+ARGP4
+ADDRLP4 636
+CNSTI4 10
+ASGNI4
+ADDRLP4 636
+INDIRI4
+ARGI4
+ADDRLP4 636
+INDIRI4
+ARGI4
+ADDRLP4 636
+INDIRI4
+ARGI4
+CNSTI4 255
+ARGI4
+ADDRLP4 640
+CNSTI4 0
+ASGNI4
+ADDRLP4 640
+INDIRI4
+ARGI4
+ADDRLP4 640
+INDIRI4
+ARGI4
+ADDRGP4 Wolfcam_AddBox
+CALLV
+pop
+LABELV $267
+ADDRLP4 620
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+CNSTI4 64
+GEI4 $272
+CNSTI4 4524
+ADDRLP4 620
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512+200
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $272
+ADDRLP4 120
+CNSTI4 1
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+LABELV $273
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 624
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+ADDRLP4 624
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 624
+INDIRP4
+ASGNP4
+ADDRLP4 628
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+LABELV $277
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $278
+LABELV $278
+ADDRLP4 632
+CNSTI4 8
+ASGNI4
+ADDRLP4 124
+ADDRLP4 92
+INDIRP4
+ADDRLP4 632
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 632
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+686624
+INDIRI4
+SUBI4
+CNSTI4 5000
+LEI4 $281
+ADDRLP4 636
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRGP4 $288
+JUMPV
+LABELV $285
+ADDRLP4 640
+ADDRGP4 lagometer+1540
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+GEI4 $292
+ADDRGP4 $286
+JUMPV
+LABELV $292
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+ADDRLP4 640
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $286
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $288
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+GEI4 $294
+ADDRLP4 0
+INDIRI4
+ADDRGP4 lagometer+1540
+INDIRI4
+LTI4 $285
+LABELV $294
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $295
+ADDRGP4 cg+686620
+ADDRLP4 88
+INDIRI4
+ADDRLP4 0
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRGP4 cg+686620
+CNSTI4 0
+ASGNI4
+LABELV $296
+ADDRGP4 cg+686624
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+LABELV $281
+ADDRLP4 16
+ADDRGP4 cg+686620
+INDIRI4
+ASGNI4
+ADDRGP4 wolfcam_following
+INDIRI4
+CNSTI4 0
+EQI4 $302
+ADDRLP4 636
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRGP4 $307
+JUMPV
+LABELV $304
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876
+ADDP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $309
+ADDRLP4 16
+CNSTI4 92
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+610876+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $306
+JUMPV
+LABELV $309
+LABELV $305
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $307
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+610844
+INDIRI4
+LTI4 $304
+LABELV $306
+LABELV $302
+ADDRLP4 16
+INDIRI4
+CNSTI4 80
+LEI4 $315
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 91
+NEI4 $315
+ADDRLP4 16
+CNSTI4 80
+ASGNI4
+LABELV $315
+ADDRGP4 cgs+1957748
+INDIRI4
+CNSTI4 68
+NEI4 $318
+ADDRGP4 cgs+1957752
+INDIRI4
+CNSTI4 0
+NEI4 $318
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $318
+ADDRLP4 24
+ADDRGP4 cg+1335112
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LEI4 $325
+ADDRLP4 24
+INDIRI4
+CNSTI4 200
+LEI4 $323
+LABELV $325
+ADDRLP4 24
+ADDRLP4 124
+INDIRI4
+ASGNI4
+LABELV $323
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $329
+JUMPV
+LABELV $328
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $329
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+GTF4 $328
+ADDRGP4 $333
+ARGP4
+ADDRLP4 640
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+EQI4 $331
+ADDRGP4 $333
+ARGP4
+ADDRLP4 644
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 644
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+GEI4 $334
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+LABELV $334
+ADDRGP4 $336
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $331
+ADDRFP4 0
+INDIRP4
+CNSTI4 1448
+ADDP4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 648
+CNSTI4 1
+ASGNI4
+ADDRLP4 100
+ADDRLP4 36
+INDIRI4
+ADDRLP4 648
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 648
+INDIRI4
+NEI4 $337
+ADDRLP4 32
+ADDRGP4 cg+40
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 cg+44
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRGP4 wcg+31078456
+INDIRI4
+ADDRLP4 100
+INDIRI4
+SUBI4
+CNSTI4 0
+GEI4 $341
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $341
+ADDRLP4 652
+CNSTI4 121400
+ASGNI4
+ADDRLP4 660
+CNSTI4 256
+ASGNI4
+ADDRLP4 32
+ADDRLP4 652
+INDIRI4
+ADDRGP4 wcg+31078456
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+ADDRLP4 660
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 wcg+56
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 652
+INDIRI4
+ADDRGP4 wcg+31078456
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ADDRLP4 660
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 wcg+56
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 652
+INDIRI4
+ADDRGP4 wcg+31078456
+INDIRI4
+ADDRLP4 100
+INDIRI4
+SUBI4
+ADDRLP4 660
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 wcg+56
+ADDP4
+ASGNP4
+LABELV $338
+ADDRGP4 wcg+31078464
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 wcg+31078468
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 wcg+31078472
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $357
+JUMPV
+LABELV $354
+ADDRLP4 20
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $358
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRGP4 $356
+JUMPV
+LABELV $358
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $360
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+NEI4 $362
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $362
+LABELV $362
+LABELV $360
+LABELV $355
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $357
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $354
+LABELV $356
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $367
+JUMPV
+LABELV $364
+ADDRLP4 8
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $368
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRGP4 $366
+JUMPV
+LABELV $368
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $370
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $370
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+NEI4 $372
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $372
+LABELV $372
+LABELV $370
+LABELV $365
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $367
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $364
+LABELV $366
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $377
+JUMPV
+LABELV $374
+ADDRLP4 4
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $378
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRGP4 $376
+JUMPV
+LABELV $378
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $380
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $380
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+NEI4 $382
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $382
+LABELV $382
+LABELV $380
+LABELV $375
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $377
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+LTI4 $374
+LABELV $376
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $384
+ADDRLP4 1160
+CNSTI4 1
+ASGNI4
+ADDRLP4 76
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRLP4 652
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 508
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 652
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTU4 508
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 652
+ARGP4
+ADDRLP4 128
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRLP4 652
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 508
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 652
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTU4 508
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 652
+ARGP4
+ADDRLP4 364
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 128
+ASGNP4
+ADDRLP4 4
+ADDRLP4 364
+ASGNP4
+LABELV $384
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $387
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $389
+ADDRGP4 $392
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $389
+ADDRGP4 $393
+JUMPV
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $394
+JUMPV
+LABELV $393
+ADDRLP4 652
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 652
+INDIRP4
+ADDRLP4 652
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 656
+ADDRGP4 IsCorpse
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+NEI4 $398
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+GEI4 $396
+LABELV $398
+LABELV $396
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $394
+LABELV $387
+ADDRLP4 656
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 656
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 656
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $401
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $401
+ADDRLP4 660
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 660
+INDIRP4
+ADDRLP4 660
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $404
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $405
+CNSTI4 1
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $401
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $408
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $408
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 660
+CNSTI4 8
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 660
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 660
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ADDI4
+ARGI4
+ADDRGP4 Wolfcam_ResetEntity
+CALLV
+pop
+LABELV $408
+ADDRLP4 660
+CNSTI4 184
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 660
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 660
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $413
+LABELV $413
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $415
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 664
+ADDRGP4 IsCorpse
+CALLI4
+ASGNI4
+ADDRLP4 664
+INDIRI4
+CNSTI4 0
+EQI4 $417
+LABELV $417
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRGP4 $419
+JUMPV
+LABELV $415
+ADDRLP4 668
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 668
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 668
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $420
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $420
+ADDRLP4 672
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 672
+INDIRP4
+ADDRLP4 672
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $424
+ADDRLP4 672
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRLP4 676
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 676
+INDIRI4
+CNSTI4 47
+EQI4 $429
+ADDRLP4 676
+INDIRI4
+CNSTI4 48
+EQI4 $429
+ADDRLP4 676
+INDIRI4
+CNSTI4 49
+NEI4 $426
+LABELV $429
+ADDRLP4 680
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 680
+INDIRP4
+ADDRLP4 680
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $426
+LABELV $424
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $431
+ADDRGP4 $269
+ARGP4
+ADDRLP4 672
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 672
+INDIRI4
+CNSTI4 1
+NEI4 $433
+ADDRLP4 676
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 676+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 676+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 676
+ARGP4
+ADDRLP4 692
+CNSTI4 20
+ASGNI4
+ADDRLP4 692
+INDIRI4
+ARGI4
+ADDRLP4 692
+INDIRI4
+ARGI4
+ADDRLP4 692
+INDIRI4
+ARGI4
+ADDRLP4 696
+CNSTI4 255
+ASGNI4
+ADDRLP4 696
+INDIRI4
+ARGI4
+ADDRLP4 696
+INDIRI4
+ARGI4
+ADDRLP4 696
+INDIRI4
+ARGI4
+ADDRGP4 Wolfcam_AddBox
+CALLV
+pop
+LABELV $433
+LABELV $431
+ADDRLP4 672
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 672
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+607148
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 672
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 676
+CNSTI4 8
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 676
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 676
+INDIRI4
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $439
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $441
+LABELV $441
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRGP4 $419
+JUMPV
+LABELV $439
+ADDRLP4 680
+CNSTI4 12
+ASGNI4
+ADDRLP4 112
+ADDRLP4 8
+INDIRP4
+ADDRLP4 680
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 116
+ADDRLP4 4
+INDIRP4
+ADDRLP4 680
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRLP4 52
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 96
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $445
+ADDRLP4 52
+ADDRGP4 cg+607132
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 688
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ADDRLP4 688
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 688
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 692
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRLP4 692
+INDIRF4
+ASGNF4
+ADDRLP4 40+4
+INDIRF4
+ARGF4
+ADDRLP4 56+4
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 696
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+ADDRLP4 696
+INDIRF4
+ASGNF4
+ADDRLP4 40+8
+INDIRF4
+ARGF4
+ADDRLP4 56+8
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 700
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+ADDRLP4 700
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+LABELV $419
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 704
+CNSTI4 180
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 704
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 704
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 708
+CNSTI4 184
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 708
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 708
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 712
+CNSTI4 156
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 712
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 712
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 104
+INDIRI4
+EQI4 $459
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRLP4 716
+CNSTI4 204
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 716
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 716
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 720
+CNSTI4 208
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 720
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 720
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $460
+ADDRLP4 716
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 716
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 716
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 720
+CNSTI4 196
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 720
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 720
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 724
+CNSTI4 200
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 724
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 724
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 728
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 728
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 728
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+GEI4 $461
+LABELV $461
+ADDRGP4 $269
+ARGP4
+ADDRLP4 732
+ADDRGP4 SC_Cvar_Get_Int
+CALLI4
+ASGNI4
+ADDRLP4 732
+INDIRI4
+CNSTI4 1
+NEI4 $463
+ADDRLP4 736
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 736+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 736+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRLP4 736
+ARGP4
+ADDRLP4 752
+CNSTI4 30
+ASGNI4
+ADDRLP4 752
+INDIRI4
+ARGI4
+ADDRLP4 752
+INDIRI4
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRLP4 756
+CNSTI4 0
+ASGNI4
+ADDRLP4 756
+INDIRI4
+ARGI4
+ADDRLP4 756
+INDIRI4
+ARGI4
+CNSTI4 255
+ARGI4
+ADDRGP4 Wolfcam_AddBox
+CALLV
+pop
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $467
+LABELV $467
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 wcg+31078476
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $188
+endproc Wolfcam_InterpolateEntityPosition 1164 28
+bss
+align 4
+LABELV tmpSnapshot
+skip 121400
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import Wolfcam_PlayerArmor
+import Wolfcam_PlayerHealth
+import Wolfcam_AddBoundingBox
+import Wolfcam_AddBox
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import tmpExtString
+import CG_PrintPicString
+import CG_ScaleFont
+import CG_DrawActive
+import CG_RenderViewAxis
+import CG_DrawFlashFade
+import CG_Fade
+import CG_CreateNewCrosshairs
+import CG_CreateFragString
+import CG_CenterPrintFragMessage
+import CG_CenterPrint
+import CG_LagometerMarkNoMove
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_ResetLagometer
+import lagometer
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawHead
+import CG_Draw3DModel
+import CG_Text_Paint_old
+import CG_Text_Paint_Bottom
+import CG_CreateNameSprite
+import CG_Text_Pic_Paint
+import CG_Text_Paint
+import CG_Text_PaintCharScale
+import CG_Text_PaintChar
+import CG_Text_Height_old
+import CG_Text_Height
+import CG_Text_Width_old
+import CG_Text_Width
+import CG_Text_Pic_Width
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $395
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 112
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $392
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 104
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $336
+byte 1 115
+byte 1 49
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $333
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $269
+byte 1 119
+byte 1 111
+byte 1 108
+byte 1 102
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 0
+align 1
+LABELV $222
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 119
+byte 1 99
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $193
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
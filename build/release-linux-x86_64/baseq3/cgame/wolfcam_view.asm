@@ -0,0 +1,6871 @@
+code
+proc RegisterTeamClientModelnameWithFallback 76 28
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $153
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $151
+ADDRGP4 cg+641320+868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+641320+920
+INDIRI4
+CNSTI4 0
+EQI4 $156
+ADDRLP4 20
+ARGP4
+ADDRGP4 cg+641320+920
+INDIRI4
+ARGI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_LerpTag
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $160
+ADDRGP4 cg+641320+868
+CNSTI4 1
+ASGNI4
+LABELV $160
+LABELV $156
+ADDRLP4 12
+ADDRGP4 cg+641320+416
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $172
+ADDRLP4 20
+ADDRGP4 $170
+ASGNP4
+ADDRGP4 $173
+JUMPV
+LABELV $172
+ADDRLP4 20
+ADDRGP4 $170
+ASGNP4
+LABELV $173
+ADDRLP4 16
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $174
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $178
+ADDRGP4 $176
+JUMPV
+LABELV $178
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+641320+2016
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $184
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+641320+2016
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+641320+2016
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $185
+ADDRGP4 $184
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+641320+2016
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+LABELV $185
+LABELV $175
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $174
+LABELV $176
+LABELV $151
+LABELV $150
+endproc RegisterTeamClientModelnameWithFallback 76 28
+export CG_GetModelName
+proc CG_GetModelName 12 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $192
+ADDRGP4 $191
+JUMPV
+LABELV $192
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $191
+endproc CG_GetModelName 12 12
+export CG_GetModelAndSkinName
+proc CG_GetModelAndSkinName 12 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $195
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $195
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $194
+endproc CG_GetModelAndSkinName 12 12
+data
+align 4
+LABELV $198
+byte 4 -1
+align 4
+LABELV $199
+byte 4 -1
+align 4
+LABELV $200
+byte 4 -1
+align 4
+LABELV $201
+byte 4 -1
+align 4
+LABELV $202
+byte 4 -1
+align 4
+LABELV $203
+byte 4 -1
+align 4
+LABELV $204
+byte 4 -1
+align 4
+LABELV $205
+byte 4 -1
+code
+proc Wolfcam_LoadTeamModel 156 28
+ADDRGP4 cg_teamHeadColor+4
+INDIRI4
+ADDRGP4 $203
+INDIRI4
+NEI4 $212
+ADDRGP4 cg_teamTorsoColor+4
+INDIRI4
+ADDRGP4 $204
+INDIRI4
+NEI4 $212
+ADDRGP4 cg_teamLegsColor+4
+INDIRI4
+ADDRGP4 $205
+INDIRI4
+EQI4 $206
+LABELV $212
+ADDRGP4 cg+686596
+ARGP4
+ADDRGP4 cg_teamHeadColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 cg+686596+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cg+686596+4
+ARGP4
+ADDRGP4 cg_teamTorsoColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 cg+686596+4+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cg+686596+8
+ARGP4
+ADDRGP4 cg_teamLegsColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 cg+686596+8+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $203
+ADDRGP4 cg_teamHeadColor+4
+INDIRI4
+ASGNI4
+ADDRGP4 $204
+ADDRGP4 cg_teamTorsoColor+4
+INDIRI4
+ASGNI4
+ADDRGP4 $205
+ADDRGP4 cg_teamLegsColor+4
+INDIRI4
+ASGNI4
+LABELV $206
+ADDRGP4 cg_teamModel+4
+INDIRI4
+ADDRGP4 $198
+INDIRI4
+NEI4 $239
+ADDRGP4 cg_teamHeadModel+4
+INDIRI4
+ADDRGP4 $199
+INDIRI4
+NEI4 $239
+ADDRGP4 cg_teamHeadSkin+4
+INDIRI4
+ADDRGP4 $200
+INDIRI4
+NEI4 $239
+ADDRGP4 cg_teamTorsoSkin+4
+INDIRI4
+ADDRGP4 $201
+INDIRI4
+NEI4 $239
+ADDRGP4 cg_teamLegsSkin+4
+INDIRI4
+ADDRGP4 $202
+INDIRI4
+EQI4 $197
+LABELV $239
+ADDRGP4 $198
+ADDRGP4 cg_teamModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 $199
+ADDRGP4 cg_teamHeadModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 $200
+ADDRGP4 cg_teamHeadSkin+4
+INDIRI4
+ASGNI4
+ADDRGP4 $201
+ADDRGP4 cg_teamTorsoSkin+4
+INDIRI4
+ASGNI4
+ADDRGP4 $202
+ADDRGP4 cg_teamLegsSkin+4
+INDIRI4
+ASGNI4
+LABELV $230
+ADDRGP4 $245
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $246
+ADDRLP4 140
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 928
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 908
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $247
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $246
+ADDRGP4 cg+654892+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_teamModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $269
+ADDRLP4 4
+ARGP4
+ADDRGP4 cg_teamModel+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $270
+JUMPV
+LABELV $269
+ADDRLP4 4
+ARGP4
+ADDRGP4 $170
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $270
+ADDRGP4 cg_teamHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $273
+ADDRLP4 72
+ARGP4
+ADDRGP4 cg_teamHeadModel+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $274
+JUMPV
+LABELV $273
+ADDRLP4 72
+ARGP4
+ADDRGP4 $170
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $274
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 140
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $277
+ADDRLP4 68
+ADDRGP4 $279
+ASGNP4
+ADDRGP4 cg+686560
+CNSTI4 1
+ASGNI4
+ADDRGP4 $278
+JUMPV
+LABELV $277
+ADDRLP4 144
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cg+686560
+CNSTI4 0
+ASGNI4
+LABELV $278
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $282
+ADDRGP4 cg+686560
+CNSTI4 1
+ASGNI4
+LABELV $282
+ADDRLP4 72
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 148
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 136
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $286
+ADDRLP4 136
+ADDRGP4 $279
+ASGNP4
+ADDRGP4 cg+686564
+CNSTI4 1
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 152
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 136
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cg+686564
+CNSTI4 0
+ASGNI4
+LABELV $287
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 152
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $290
+ADDRGP4 cg+686564
+CNSTI4 1
+ASGNI4
+LABELV $290
+ADDRGP4 cg+641320+416
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+641320+480
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+645844+416
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+645844+480
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+650368+416
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+650368+480
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+641320+544
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+641320+608
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+645844+544
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+645844+608
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+650368+544
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+650368+608
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+641320
+ARGP4
+ADDRGP4 cg+641320+416
+ARGP4
+ADDRGP4 cg+641320+480
+ARGP4
+ADDRGP4 cg+641320+544
+ARGP4
+ADDRGP4 cg+641320+608
+ARGP4
+ADDRGP4 $153
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 RegisterTeamClientModelnameWithFallback
+CALLV
+pop
+ADDRGP4 cg+645844+196
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+645844
+ARGP4
+ADDRGP4 cg+645844+416
+ARGP4
+ADDRGP4 cg+645844+480
+ARGP4
+ADDRGP4 cg+645844+544
+ARGP4
+ADDRGP4 cg+645844+608
+ARGP4
+ADDRGP4 $153
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 RegisterTeamClientModelnameWithFallback
+CALLV
+pop
+ADDRGP4 cg+650368+196
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+650368
+ARGP4
+ADDRGP4 cg+650368+416
+ARGP4
+ADDRGP4 cg+650368+480
+ARGP4
+ADDRGP4 cg+650368+544
+ARGP4
+ADDRGP4 cg+650368+608
+ARGP4
+ADDRGP4 $153
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 RegisterTeamClientModelnameWithFallback
+CALLV
+pop
+ADDRGP4 cg_teamModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $372
+ADDRGP4 cg+641320+900
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+641320+920
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+645844+900
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+645844+920
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+650368+900
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+650368+920
+CNSTI4 0
+ASGNI4
+LABELV $372
+ADDRGP4 cg_teamHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $387
+ADDRGP4 cg+641320+940
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+645844+940
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+650368+940
+CNSTI4 0
+ASGNI4
+LABELV $387
+LABELV $197
+endproc Wolfcam_LoadTeamModel 156 28
+data
+align 4
+LABELV $397
+byte 4 -1
+align 4
+LABELV $398
+byte 4 -1
+align 4
+LABELV $399
+byte 4 -1
+align 4
+LABELV $400
+byte 4 -1
+align 4
+LABELV $401
+byte 4 -1
+align 4
+LABELV $402
+byte 4 -1
+align 4
+LABELV $403
+byte 4 -1
+align 4
+LABELV $404
+byte 4 -1
+code
+proc Wolfcam_LoadOurModel 224 28
+ADDRGP4 cg_ourHeadColor+4
+INDIRI4
+ADDRGP4 $402
+INDIRI4
+NEI4 $411
+ADDRGP4 cg_ourTorsoColor+4
+INDIRI4
+ADDRGP4 $403
+INDIRI4
+NEI4 $411
+ADDRGP4 cg_ourLegsColor+4
+INDIRI4
+ADDRGP4 $404
+INDIRI4
+EQI4 $405
+LABELV $411
+ADDRGP4 cg+686608
+ARGP4
+ADDRGP4 cg_ourHeadColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 cg+686608+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cg+686608+4
+ARGP4
+ADDRGP4 cg_ourTorsoColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 cg+686608+4+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cg+686608+8
+ARGP4
+ADDRGP4 cg_ourLegsColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 cg+686608+8+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $402
+ADDRGP4 cg_ourHeadColor+4
+INDIRI4
+ASGNI4
+ADDRGP4 $403
+ADDRGP4 cg_ourTorsoColor+4
+INDIRI4
+ASGNI4
+ADDRGP4 $404
+ADDRGP4 cg_ourLegsColor+4
+INDIRI4
+ASGNI4
+LABELV $405
+ADDRGP4 $399
+INDIRI4
+ADDRGP4 cg_ourHeadSkin+4
+INDIRI4
+NEI4 $438
+ADDRGP4 $400
+INDIRI4
+ADDRGP4 cg_ourTorsoSkin+4
+INDIRI4
+NEI4 $438
+ADDRGP4 $401
+INDIRI4
+ADDRGP4 cg_ourLegsSkin+4
+INDIRI4
+NEI4 $438
+ADDRGP4 $397
+INDIRI4
+ADDRGP4 cg_ourModel+4
+INDIRI4
+NEI4 $438
+ADDRGP4 $398
+INDIRI4
+ADDRGP4 cg_ourHeadModel+4
+INDIRI4
+EQI4 $396
+LABELV $438
+ADDRGP4 $399
+ADDRGP4 cg_ourHeadSkin+4
+INDIRI4
+ASGNI4
+ADDRGP4 $400
+ADDRGP4 cg_ourTorsoSkin+4
+INDIRI4
+ASGNI4
+ADDRGP4 $401
+ADDRGP4 cg_ourLegsSkin+4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+654892+960
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+936
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+916
+CNSTI4 0
+ASGNI4
+ADDRGP4 $397
+ADDRGP4 cg_ourModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 $398
+ADDRGP4 cg_ourHeadModel+4
+INDIRI4
+ASGNI4
+LABELV $429
+ADDRGP4 $450
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+654892
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_ourModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $454
+ADDRLP4 12
+ARGP4
+ADDRGP4 cg_ourModel+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $455
+JUMPV
+LABELV $454
+ADDRLP4 12
+ARGP4
+ADDRGP4 $170
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $455
+ADDRLP4 12
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 148
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $458
+ADDRLP4 76
+ADDRGP4 $279
+ASGNP4
+ADDRGP4 $459
+JUMPV
+LABELV $458
+ADDRLP4 152
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $459
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 152
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $460
+ADDRGP4 cg+686576
+CNSTI4 1
+ASGNI4
+ADDRGP4 $461
+JUMPV
+LABELV $460
+ADDRGP4 cg+686576
+CNSTI4 0
+ASGNI4
+LABELV $461
+ADDRGP4 cg_ourHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $464
+ADDRLP4 80
+ARGP4
+ADDRGP4 cg_ourHeadModel+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRLP4 80
+ARGP4
+ADDRGP4 $170
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $465
+ADDRLP4 80
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 156
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $468
+ADDRLP4 144
+ADDRGP4 $279
+ASGNP4
+ADDRGP4 $469
+JUMPV
+LABELV $468
+ADDRLP4 160
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 160
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $469
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 160
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $470
+ADDRGP4 cg+686580
+CNSTI4 1
+ASGNI4
+ADDRGP4 $471
+JUMPV
+LABELV $470
+ADDRGP4 cg+686580
+CNSTI4 0
+ASGNI4
+LABELV $471
+ADDRGP4 cg+654892+416
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+654892+480
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+654892+544
+ARGP4
+ADDRLP4 80
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+654892+608
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+654892
+ARGP4
+ADDRGP4 cg+654892+416
+ARGP4
+ADDRGP4 cg+654892+480
+ARGP4
+ADDRGP4 cg+654892+544
+ARGP4
+ADDRGP4 cg+654892+608
+ARGP4
+ADDRGP4 $153
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $490
+LABELV $490
+ADDRGP4 cg+654892+868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+920
+INDIRI4
+CNSTI4 0
+EQI4 $503
+ADDRLP4 168
+ARGP4
+ADDRGP4 cg+654892+920
+INDIRI4
+ARGI4
+ADDRLP4 216
+CNSTI4 0
+ASGNI4
+ADDRLP4 216
+INDIRI4
+ARGI4
+ADDRLP4 216
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 220
+ADDRGP4 trap_R_LerpTag
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+EQI4 $507
+ADDRGP4 cg+654892+868
+CNSTI4 1
+ASGNI4
+LABELV $507
+LABELV $503
+ADDRGP4 cg+659416
+ARGP4
+ADDRGP4 cg+654892
+ARGP4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cg+663940
+ARGP4
+ADDRGP4 cg+654892
+ARGP4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cg+659416+196
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+663940+196
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+659416
+ARGP4
+ADDRGP4 cg+659416+416
+ARGP4
+ADDRGP4 cg+659416+480
+ARGP4
+ADDRGP4 cg+659416+544
+ARGP4
+ADDRGP4 cg+659416+608
+ARGP4
+ADDRGP4 $530
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+pop
+ADDRGP4 cg+663940
+ARGP4
+ADDRGP4 cg+663940+416
+ARGP4
+ADDRGP4 cg+663940+480
+ARGP4
+ADDRGP4 cg+663940+544
+ARGP4
+ADDRGP4 cg+663940+608
+ARGP4
+ADDRGP4 $540
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+pop
+ADDRGP4 cg_ourModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $541
+ADDRGP4 cg+654892+900
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+920
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+900
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+920
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+900
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+920
+CNSTI4 0
+ASGNI4
+LABELV $541
+ADDRGP4 cg_ourHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $556
+ADDRGP4 cg+654892+940
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+940
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+940
+CNSTI4 0
+ASGNI4
+LABELV $556
+ADDRLP4 8
+ADDRGP4 cg+654892+416
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $567
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $571
+ADDRGP4 $569
+JUMPV
+LABELV $571
+ADDRLP4 168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cg+663940+2016
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cg+659416+2016
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRGP4 cg+654892+2016
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRGP4 $184
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 180
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRGP4 cg+663940+2016
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRGP4 cg+659416+2016
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRGP4 cg+654892+2016
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+LABELV $568
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $567
+LABELV $569
+LABELV $452
+LABELV $396
+endproc Wolfcam_LoadOurModel 224 28
+data
+align 4
+LABELV $586
+byte 4 -1
+align 4
+LABELV $587
+byte 4 -1
+code
+proc Wolfcam_LoadFallbackModel 216 28
+ADDRGP4 $586
+INDIRI4
+ADDRGP4 cg_fallbackModel+4
+INDIRI4
+NEI4 $592
+ADDRGP4 $587
+INDIRI4
+ADDRGP4 cg_fallbackHeadModel+4
+INDIRI4
+EQI4 $585
+LABELV $592
+ADDRGP4 $586
+ADDRGP4 cg_fallbackModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 $587
+ADDRGP4 cg_fallbackHeadModel+4
+INDIRI4
+ASGNI4
+LABELV $589
+ADDRGP4 $595
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg+668464
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $597
+ADDRLP4 148
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 928
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 908
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $598
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $597
+ADDRGP4 cg+654892+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_fallbackModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $622
+ADDRLP4 12
+ARGP4
+ADDRGP4 cg_fallbackModel+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $623
+JUMPV
+LABELV $622
+ADDRLP4 12
+ARGP4
+ADDRGP4 $170
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $623
+ADDRLP4 12
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 148
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $626
+ADDRLP4 140
+ADDRGP4 $279
+ASGNP4
+ADDRGP4 $627
+JUMPV
+LABELV $626
+ADDRLP4 152
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $627
+ADDRGP4 cg_fallbackHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $628
+ADDRLP4 76
+ARGP4
+ADDRGP4 cg_fallbackHeadModel+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $629
+JUMPV
+LABELV $628
+ADDRLP4 76
+ARGP4
+ADDRGP4 $170
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $629
+ADDRLP4 76
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 152
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $632
+ADDRLP4 144
+ADDRGP4 $279
+ASGNP4
+ADDRGP4 $633
+JUMPV
+LABELV $632
+ADDRLP4 156
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 156
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $633
+ADDRGP4 cg+668464+416
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+668464+480
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+668464+544
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+668464+608
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+668464
+ARGP4
+ADDRGP4 cg+668464+416
+ARGP4
+ADDRGP4 cg+668464+480
+ARGP4
+ADDRGP4 cg+668464+544
+ARGP4
+ADDRGP4 cg+668464+608
+ARGP4
+ADDRGP4 $153
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $650
+LABELV $650
+ADDRGP4 cg+668464+868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+668464+920
+INDIRI4
+CNSTI4 0
+EQI4 $663
+ADDRLP4 160
+ARGP4
+ADDRGP4 cg+668464+920
+INDIRI4
+ARGI4
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRLP4 208
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 212
+ADDRGP4 trap_R_LerpTag
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+EQI4 $667
+ADDRGP4 cg+668464+868
+CNSTI4 1
+ASGNI4
+LABELV $667
+LABELV $663
+ADDRGP4 cg+672988
+ARGP4
+ADDRGP4 cg+668464
+ARGP4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cg+677512
+ARGP4
+ADDRGP4 cg+668464
+ARGP4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cg+672988+196
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+677512+196
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+672988
+ARGP4
+ADDRGP4 cg+672988+416
+ARGP4
+ADDRGP4 cg+672988+480
+ARGP4
+ADDRGP4 cg+672988+544
+ARGP4
+ADDRGP4 cg+672988+608
+ARGP4
+ADDRGP4 $530
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+pop
+ADDRGP4 cg+677512
+ARGP4
+ADDRGP4 cg+677512+416
+ARGP4
+ADDRGP4 cg+677512+480
+ARGP4
+ADDRGP4 cg+677512+544
+ARGP4
+ADDRGP4 cg+677512+608
+ARGP4
+ADDRGP4 $540
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+pop
+ADDRGP4 cg_fallbackModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $699
+ADDRGP4 cg+668464+900
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+668464+920
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+672988+900
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+672988+920
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+677512+900
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+677512+920
+CNSTI4 0
+ASGNI4
+LABELV $699
+ADDRGP4 cg_fallbackHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $714
+ADDRGP4 cg+668464+940
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+672988+940
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+677512+940
+CNSTI4 0
+ASGNI4
+LABELV $714
+ADDRLP4 8
+ADDRGP4 cg+668464+416
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $725
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $729
+ADDRGP4 $727
+JUMPV
+LABELV $729
+ADDRLP4 160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ADDRGP4 cg+677512+2016
+ADDP4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ADDRGP4 cg+672988+2016
+ADDP4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ADDRGP4 cg+668464+2016
+ADDP4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 $184
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 172
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ADDRGP4 cg+677512+2016
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ADDRGP4 cg+672988+2016
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ADDRGP4 cg+668464+2016
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $726
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $725
+LABELV $727
+LABELV $620
+LABELV $585
+endproc Wolfcam_LoadFallbackModel 216 28
+data
+align 4
+LABELV $744
+byte 4 -1
+bss
+align 4
+LABELV $745
+skip 4
+data
+align 4
+LABELV $746
+byte 4 -1
+align 4
+LABELV $747
+byte 4 -1
+align 4
+LABELV $748
+byte 4 -1
+align 4
+LABELV $749
+byte 4 -1
+align 4
+LABELV $750
+byte 4 -1
+align 4
+LABELV $751
+byte 4 -1
+code
+proc Wolfcam_LoadEnemyModel 224 28
+ADDRGP4 cg_enemyHeadColor+4
+INDIRI4
+ADDRGP4 $749
+INDIRI4
+NEI4 $758
+ADDRGP4 cg_enemyTorsoColor+4
+INDIRI4
+ADDRGP4 $750
+INDIRI4
+NEI4 $758
+ADDRGP4 cg_enemyLegsColor+4
+INDIRI4
+ADDRGP4 $751
+INDIRI4
+EQI4 $752
+LABELV $758
+ADDRGP4 cg+686584
+ARGP4
+ADDRGP4 cg_enemyHeadColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 cg+686584+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cg+686584+4
+ARGP4
+ADDRGP4 cg_enemyTorsoColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 cg+686584+4+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cg+686584+8
+ARGP4
+ADDRGP4 cg_enemyLegsColor
+ARGP4
+ADDRGP4 SC_ByteVec3ColorFromCvar
+CALLV
+pop
+ADDRGP4 cg+686584+8+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $749
+ADDRGP4 cg_enemyHeadColor+4
+INDIRI4
+ASGNI4
+ADDRGP4 $750
+ADDRGP4 cg_enemyTorsoColor+4
+INDIRI4
+ASGNI4
+ADDRGP4 $751
+ADDRGP4 cg_enemyLegsColor+4
+INDIRI4
+ASGNI4
+LABELV $752
+ADDRGP4 cg_enemyModel+4
+INDIRI4
+ADDRGP4 $744
+INDIRI4
+NEI4 $785
+ADDRGP4 cg_enemyHeadModel+4
+INDIRI4
+ADDRGP4 $745
+INDIRI4
+NEI4 $785
+ADDRGP4 cg_enemyHeadSkin+4
+INDIRI4
+ADDRGP4 $746
+INDIRI4
+NEI4 $785
+ADDRGP4 cg_enemyTorsoSkin+4
+INDIRI4
+ADDRGP4 $747
+INDIRI4
+NEI4 $785
+ADDRGP4 cg_enemyLegsSkin+4
+INDIRI4
+ADDRGP4 $748
+INDIRI4
+EQI4 $743
+LABELV $785
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 EM_Loaded
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $744
+ADDRGP4 cg_enemyModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 $745
+ADDRGP4 cg_enemyHeadModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 $746
+ADDRGP4 cg_enemyHeadSkin+4
+INDIRI4
+ASGNI4
+ADDRGP4 $747
+ADDRGP4 cg_enemyTorsoSkin+4
+INDIRI4
+ASGNI4
+ADDRGP4 $748
+ADDRGP4 cg_enemyLegsSkin+4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 140
+INDIRI4
+ASGNI4
+LABELV $791
+ADDRLP4 144
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 956
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRP4
+CNSTI4 932
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRP4
+CNSTI4 912
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRP4
+CNSTI4 952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRP4
+CNSTI4 928
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRP4
+CNSTI4 908
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $792
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $791
+ADDRGP4 cg+654892+956
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+932
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+912
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+956
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+932
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+912
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+956
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+932
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+912
+CNSTI4 0
+ASGNI4
+LABELV $776
+ADDRGP4 EM_Loaded
+INDIRI4
+CNSTI4 0
+NEI4 $814
+ADDRGP4 cg+627748
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_enemyModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $817
+ADDRLP4 4
+ARGP4
+ADDRGP4 cg_enemyModel+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $818
+JUMPV
+LABELV $817
+ADDRLP4 4
+ARGP4
+ADDRGP4 $170
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $818
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 140
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $821
+ADDRLP4 68
+ADDRGP4 $279
+ASGNP4
+ADDRGP4 cg+686568
+CNSTI4 1
+ASGNI4
+ADDRGP4 $822
+JUMPV
+LABELV $821
+ADDRGP4 cg+686568
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $822
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $825
+ADDRGP4 cg+686568
+CNSTI4 1
+ASGNI4
+LABELV $825
+ADDRGP4 cg_enemyHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $828
+ADDRLP4 72
+ARGP4
+ADDRGP4 cg_enemyHeadModel+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $829
+JUMPV
+LABELV $828
+ADDRLP4 72
+ARGP4
+ADDRGP4 $170
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $829
+ADDRLP4 72
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 148
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 136
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $832
+ADDRLP4 136
+ADDRGP4 $279
+ASGNP4
+ADDRGP4 cg+686572
+CNSTI4 1
+ASGNI4
+ADDRGP4 $833
+JUMPV
+LABELV $832
+ADDRGP4 cg+686572
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 136
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $833
+ADDRGP4 cg+627748+416
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+627748+480
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+627748+544
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+627748+608
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+627748
+ARGP4
+ADDRGP4 cg+627748+416
+ARGP4
+ADDRGP4 cg+627748+480
+ARGP4
+ADDRGP4 cg+627748+544
+ARGP4
+ADDRGP4 cg+627748+608
+ARGP4
+ADDRGP4 $153
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $852
+ADDRGP4 EM_Loaded
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+627748+868
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627748+920
+INDIRI4
+CNSTI4 0
+EQI4 $865
+ADDRLP4 168
+ARGP4
+ADDRGP4 cg+627748+920
+INDIRI4
+ARGI4
+ADDRLP4 216
+CNSTI4 0
+ASGNI4
+ADDRLP4 216
+INDIRI4
+ARGI4
+ADDRLP4 216
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 220
+ADDRGP4 trap_R_LerpTag
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+EQI4 $869
+ADDRGP4 cg+627748+868
+CNSTI4 1
+ASGNI4
+LABELV $869
+LABELV $865
+ADDRGP4 cg+632272
+ARGP4
+ADDRGP4 cg+627748
+ARGP4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cg+636796
+ARGP4
+ADDRGP4 cg+627748
+ARGP4
+CNSTU4 4524
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cg+632272+196
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+636796+196
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+632272
+ARGP4
+ADDRGP4 cg+632272+416
+ARGP4
+ADDRGP4 cg+632272+480
+ARGP4
+ADDRGP4 cg+632272+544
+ARGP4
+ADDRGP4 cg+632272+608
+ARGP4
+ADDRGP4 $530
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+pop
+ADDRGP4 cg+636796
+ARGP4
+ADDRGP4 cg+636796+416
+ARGP4
+ADDRGP4 cg+636796+480
+ARGP4
+ADDRGP4 cg+636796+544
+ARGP4
+ADDRGP4 cg+636796+608
+ARGP4
+ADDRGP4 $540
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+pop
+ADDRGP4 cg_enemyModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $901
+ADDRGP4 cg+627748+900
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+627748+920
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+632272+900
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+632272+920
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+636796+900
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+636796+920
+CNSTI4 0
+ASGNI4
+LABELV $901
+ADDRGP4 cg_enemyHeadModel+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $916
+ADDRGP4 cg+627748+940
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+632272+940
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+636796+940
+CNSTI4 0
+ASGNI4
+LABELV $916
+ADDRLP4 160
+ADDRGP4 cg+627748+416
+ASGNP4
+ADDRGP4 cgs+39688
+INDIRI4
+CNSTI4 3
+LTI4 $929
+ADDRLP4 168
+ADDRGP4 $170
+ASGNP4
+ADDRGP4 $930
+JUMPV
+LABELV $929
+ADDRLP4 168
+ADDRGP4 $170
+ASGNP4
+LABELV $930
+ADDRLP4 164
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $931
+ADDRLP4 156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $935
+ADDRGP4 $853
+JUMPV
+LABELV $935
+ADDRLP4 172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ADDRGP4 cg+636796+2016
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ADDRGP4 cg+632272+2016
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ADDRGP4 cg+627748+2016
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRGP4 $184
+ARGP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 156
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 184
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRGP4 cg+636796+2016
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRGP4 cg+632272+2016
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRGP4 cg+627748+2016
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+627748+2016
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $949
+ADDRGP4 $184
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 156
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 196
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 200
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+ADDRGP4 cg+636796+2016
+ADDP4
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+ADDRGP4 cg+632272+2016
+ADDP4
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+ADDRGP4 cg+627748+2016
+ADDP4
+ADDRLP4 196
+INDIRI4
+ASGNI4
+LABELV $949
+LABELV $932
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $931
+ADDRGP4 $853
+JUMPV
+LABELV $852
+ADDRGP4 EM_Loaded
+CNSTI4 -1
+ASGNI4
+LABELV $853
+LABELV $814
+LABELV $743
+endproc Wolfcam_LoadEnemyModel 224 28
+data
+align 4
+LABELV $960
+byte 4 -1
+align 4
+LABELV $961
+byte 4 -1
+align 4
+LABELV $962
+byte 4 -1
+export Wolfcam_LoadModels
+code
+proc Wolfcam_LoadModels 8 0
+ADDRGP4 cg_useDefaultTeamSkins+12
+INDIRI4
+ADDRGP4 $961
+INDIRI4
+NEI4 $967
+ADDRGP4 cg_ignoreClientHeadModel+12
+INDIRI4
+ADDRGP4 $962
+INDIRI4
+EQI4 $963
+LABELV $967
+ADDRGP4 CG_ForceModelChange
+CALLV
+pop
+ADDRGP4 $961
+ADDRGP4 cg_useDefaultTeamSkins+12
+INDIRI4
+ASGNI4
+ADDRGP4 $962
+ADDRGP4 cg_ignoreClientHeadModel+12
+INDIRI4
+ASGNI4
+LABELV $963
+ADDRGP4 Wolfcam_LoadOurModel
+CALLV
+pop
+ADDRGP4 Wolfcam_LoadTeamModel
+CALLV
+pop
+ADDRGP4 Wolfcam_LoadEnemyModel
+CALLV
+pop
+ADDRGP4 Wolfcam_LoadFallbackModel
+CALLV
+pop
+ADDRGP4 cg_disallowEnemyModelForTeammates+4
+INDIRI4
+ADDRGP4 $960
+INDIRI4
+EQI4 $970
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $973
+ADDRLP4 4
+CNSTI4 4524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 928
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 908
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $974
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $973
+ADDRGP4 cg+654892+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+654892+908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+659416+908
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+952
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+928
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+663940+908
+CNSTI4 0
+ASGNI4
+ADDRGP4 $960
+ADDRGP4 cg_disallowEnemyModelForTeammates+4
+INDIRI4
+ASGNI4
+LABELV $970
+LABELV $959
+endproc Wolfcam_LoadModels 8 0
+data
+align 4
+LABELV $998
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $999
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+export Wolfcam_OffsetThirdPersonView
+code
+proc Wolfcam_OffsetThirdPersonView 192 28
+ADDRLP4 112
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRGP4 wcg+32
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRGP4 wcg+44
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609412+24
+ADDRLP4 112
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ADDRLP4 112
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 144
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRLP4 116
+ADDRGP4 cg+609780
+INDIRB
+ASGNB 12
+ADDRLP4 112
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1013
+ADDRLP4 116+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+609780+4
+CNSTF4 0
+ASGNF4
+LABELV $1015
+LABELV $1013
+ADDRLP4 116
+INDIRF4
+CNSTF4 1110704128
+LEF4 $1020
+ADDRLP4 116
+CNSTF4 1110704128
+ASGNF4
+LABELV $1020
+ADDRLP4 116
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 $1022
+JUMPV
+ADDRGP4 $1023
+JUMPV
+LABELV $1022
+ADDRLP4 152
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+609412+24
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 cg+609412+24+8
+INDIRF4
+CNSTF4 1137180672
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1023
+ADDRLP4 0
+ADDRGP4 cg+609412+24
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRGP4 cg+609780
+ASGNP4
+ADDRLP4 156
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+609780
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 132
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+CNSTF4 1078530011
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 160
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 160
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 164
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 164
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 104
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 104
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 104
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 108
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 108
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 108
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ARGP4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 $998
+ARGP4
+ADDRGP4 $999
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 48+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $1064
+ADDRLP4 0
+ADDRLP4 48+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1107296256
+CNSTF4 1065353216
+ADDRLP4 48+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ARGP4
+ADDRGP4 cg+609412+24
+ARGP4
+ADDRGP4 $998
+ARGP4
+ADDRGP4 $999
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 wcg+4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 48+12
+INDIRB
+ASGNB 12
+LABELV $1064
+ADDRGP4 cg+609412+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+609412+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+609412+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+609412+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 180
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1090
+ADDRLP4 128
+CNSTF4 1065353216
+ASGNF4
+LABELV $1090
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 184
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRGP4 cg+609780
+CNSTF4 3261411041
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 188
+ADDRGP4 cg+609780+4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRF4
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $997
+endproc Wolfcam_OffsetThirdPersonView 192 28
+export Wolfcam_OffsetFirstPersonView
+proc Wolfcam_OffsetFirstPersonView 244 12
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+609412
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 CG_CalcVrect
+CALLV
+pop
+ADDRGP4 cg+607192
+INDIRI4
+CNSTI4 0
+EQI4 $1103
+ADDRLP4 60
+ADDRGP4 cg+609412+76
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 5
+BORI4
+ASGNI4
+LABELV $1103
+ADDRLP4 24
+ADDRGP4 wcg+4
+INDIRI4
+ASGNI4
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 2
+NEI4 $1109
+ADDRLP4 60
+CNSTI4 1496
+ADDRGP4 cg+5417584
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 wcg+16
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GEI4 $1115
+ADDRLP4 16
+INDIRI4
+ADDRGP4 wolfcam_hoverTime+12
+INDIRI4
+NEGI4
+LEI4 $1115
+ADDRLP4 60
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1118
+ADDRGP4 $1119
+JUMPV
+LABELV $1118
+ADDRLP4 24
+ADDRGP4 cg+5417584
+INDIRI4
+ASGNI4
+LABELV $1119
+LABELV $1115
+LABELV $1109
+ADDRLP4 48
+CNSTI4 4524
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cgs+51512
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1496
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 2392
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRGP4 wcg+4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1123
+LABELV $1123
+LABELV $1124
+ADDRLP4 68
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 4
+INDIRP4
+CNSTI4 244
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 cg_demoSmoothing+12
+INDIRI4
+CNSTI4 2
+LEI4 $1127
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 100
+ADDRGP4 cg_demoSmoothing+12
+INDIRI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 32
+LTI4 $1131
+ADDRLP4 100
+CNSTI4 31
+ASGNI4
+LABELV $1131
+ADDRLP4 132
+CNSTI4 121396
+ASGNI4
+ADDRLP4 136
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 108
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 136
+INDIRI4
+MODI4
+SUBI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 140
+INDIRI4
+ADDRLP4 136
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 84
+ADDRGP4 cg+121484
+ASGNP4
+ADDRLP4 88
+ADDRGP4 cg+121508
+ASGNP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 cg+121532
+ARGP4
+ADDRGP4 cg+121484
+ARGP4
+ADDRLP4 144
+ADDRGP4 CG_UpdateSnapshotRef
+CALLI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $1139
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1139
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 cg+242932
+ARGP4
+ADDRGP4 cg+121508
+ARGP4
+ADDRLP4 148
+ADDRGP4 CG_UpdateSnapshotRef
+CALLI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $1143
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1143
+ADDRLP4 152
+CNSTP4 0
+ASGNP4
+ADDRLP4 92
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1145
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1150
+JUMPV
+LABELV $1147
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_SnapshotRefEntity
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $1151
+ADDRLP4 92
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRGP4 $1149
+JUMPV
+LABELV $1151
+LABELV $1148
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1150
+ADDRLP4 76
+INDIRI4
+ADDRLP4 84
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LTI4 $1147
+LABELV $1149
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1157
+JUMPV
+LABELV $1154
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_SnapshotRefEntity
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+ADDRGP4 wcg+4
+INDIRI4
+NEI4 $1158
+ADDRLP4 96
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRGP4 $1156
+JUMPV
+LABELV $1158
+LABELV $1155
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1157
+ADDRLP4 76
+INDIRI4
+ADDRLP4 88
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LTI4 $1154
+LABELV $1156
+LABELV $1145
+ADDRLP4 156
+CNSTU4 0
+ASGNU4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+ADDRLP4 156
+INDIRU4
+EQU4 $1163
+ADDRLP4 92
+INDIRP4
+CVPU4 4
+ADDRLP4 156
+INDIRU4
+NEU4 $1161
+LABELV $1163
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1161
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_demoSmoothingTeleportCheck+12
+INDIRI4
+ADDRLP4 160
+INDIRI4
+EQI4 $1164
+ADDRLP4 164
+CNSTI4 8
+ASGNI4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+ADDRLP4 160
+INDIRI4
+EQI4 $1164
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1164
+ADDRLP4 168
+ADDRLP4 84
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRGP4 cg+607152
+INDIRF4
+ADDRLP4 168
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 176
+CNSTI4 24
+ASGNI4
+ADDRLP4 180
+ADDRLP4 92
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 180
+INDIRF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192
+CNSTI4 28
+ASGNI4
+ADDRLP4 196
+ADDRLP4 92
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 116+4
+ADDRLP4 196
+INDIRF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 200
+CNSTI4 32
+ASGNI4
+ADDRLP4 204
+ADDRLP4 92
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 116+8
+ADDRLP4 204
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+609412+24
+ADDRLP4 116
+INDIRB
+ASGNB 12
+ADDRGP4 cg_demoSmoothingAngles+12
+INDIRI4
+CNSTI4 0
+EQI4 $1172
+ADDRLP4 220
+CNSTI4 64
+ASGNI4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 220
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 220
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 224
+ADDRGP4 LerpAngleNear
+CALLF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRLP4 228
+CNSTI4 68
+ASGNI4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 228
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 228
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 232
+ADDRGP4 LerpAngleNear
+CALLF4
+ASGNF4
+ADDRLP4 208+4
+ADDRLP4 232
+INDIRF4
+ASGNF4
+ADDRLP4 236
+CNSTI4 72
+ASGNI4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 236
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 236
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 240
+ADDRGP4 LerpAngleNear
+CALLF4
+ASGNF4
+ADDRLP4 208+8
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609780
+ADDRLP4 208
+INDIRB
+ASGNB 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1173
+ADDRLP4 4
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRLP4 208
+INDIRB
+ASGNB 12
+ADDRGP4 $1173
+JUMPV
+LABELV $1172
+ADDRGP4 cg+609780
+ADDRLP4 4
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1173
+LABELV $1162
+LABELV $1127
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1181
+ADDRGP4 cg+609412+24
+ADDRLP4 4
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ADDRLP4 4
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1181
+ADDRLP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $1188
+ADDRLP4 8
+INDIRI4
+CNSTI4 23
+NEI4 $1186
+LABELV $1188
+ADDRLP4 80
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRGP4 $1187
+JUMPV
+LABELV $1186
+ADDRLP4 80
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+LABELV $1187
+ADDRLP4 20
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $1196
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 cg+607148
+INDIRI4
+CNSTI4 100
+SUBI4
+ASGNI4
+LABELV $1196
+ADDRLP4 20
+INDIRI4
+CNSTI4 100
+GEI4 $1199
+ADDRLP4 80
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 84
+CNSTI4 100
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+MULI4
+ADDRLP4 84
+INDIRI4
+DIVI4
+CVIF4 4
+SUBF4
+ASGNF4
+LABELV $1199
+CNSTI4 2392
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1204
+ADDRLP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+INDIRF4
+CNSTF4 1128792064
+LEF4 $1208
+ADDRLP4 80
+ADDRLP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1209
+JUMPV
+LABELV $1208
+ADDRLP4 80
+CNSTF4 1128792064
+ASGNF4
+LABELV $1209
+ADDRLP4 36
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 88
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+NEF4 $1210
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+LEF4 $1210
+ADDRLP4 92
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+CNSTF4 1000593162
+ADDRGP4 cg+607144
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+LABELV $1210
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1216
+ADDRLP4 92
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+ADDRGP4 cg_bobpitch+8
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $1217
+JUMPV
+LABELV $1216
+ADDRLP4 92
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+ADDRGP4 cg_bobpitch+8
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1217
+ADDRLP4 28
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $1220
+ADDRLP4 8
+INDIRI4
+CNSTI4 23
+NEI4 $1218
+LABELV $1220
+ADDRLP4 28
+CNSTF4 1077936128
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1218
+ADDRLP4 100
+ADDRGP4 cg+609780
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1225
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+ADDRGP4 cg_bobroll+8
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $1226
+JUMPV
+LABELV $1225
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+ADDRGP4 cg_bobroll+8
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1226
+ADDRLP4 28
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $1229
+ADDRLP4 8
+INDIRI4
+CNSTI4 23
+NEI4 $1227
+LABELV $1229
+ADDRLP4 28
+CNSTF4 1077936128
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1227
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1230
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1231
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $1231
+JUMPV
+LABELV $1230
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1234
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $1234
+LABELV $1231
+ADDRLP4 112
+ADDRGP4 cg+609780+8
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 3231711232
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+607148
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1140457472
+GEF4 $1239
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 116
+INDIRI4
+NEI4 $1239
+ADDRLP4 48
+INDIRP4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+EQI4 $1239
+ADDRLP4 40
+INDIRF4
+CNSTF4 1120403456
+GEF4 $1241
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 120
+ADDRGP4 cg+609780
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1242
+JUMPV
+LABELV $1241
+ADDRLP4 40
+CNSTF4 1065353216
+ADDRLP4 40
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+CNSTF4 1137180672
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+LEF4 $1244
+ADDRLP4 120
+ADDRGP4 cg+609780
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1244
+LABELV $1242
+LABELV $1239
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+INDIRF4
+MULF4
+ADDRGP4 cg_bobup+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1086324736
+LEF4 $1248
+ADDRLP4 44
+CNSTF4 1086324736
+ASGNF4
+LABELV $1248
+ADDRLP4 124
+ADDRGP4 cg+609412+24+8
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1204
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 3
+NEI4 $1253
+ADDRLP4 16
+ADDRGP4 wcg+24
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GEI4 $1254
+ADDRLP4 16
+INDIRI4
+ADDRGP4 wolfcam_hoverTime+12
+INDIRI4
+NEGI4
+LEI4 $1254
+ADDRGP4 cg+609412+24
+ADDRGP4 cg+5417536
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ADDRGP4 cg+5417548
+INDIRB
+ASGNB 12
+ADDRGP4 $1254
+JUMPV
+LABELV $1253
+ADDRGP4 wcg+8
+INDIRI4
+CNSTI4 2
+NEI4 $1266
+ADDRLP4 80
+CNSTI4 1496
+ADDRGP4 cg+5417584
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 wcg+16
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GEI4 $1272
+ADDRLP4 16
+INDIRI4
+ADDRGP4 wolfcam_hoverTime+12
+INDIRI4
+NEGI4
+LEI4 $1272
+ADDRLP4 80
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1275
+ADDRGP4 cg+609412+24
+ADDRGP4 cg+5417560
+INDIRB
+ASGNB 12
+ADDRGP4 cg+609780
+ADDRGP4 cg+5417572
+INDIRB
+ASGNB 12
+LABELV $1275
+LABELV $1272
+LABELV $1266
+LABELV $1254
+ADDRGP4 cg+609780
+ARGP4
+ADDRGP4 cg+609412+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $1100
+endproc Wolfcam_OffsetFirstPersonView 244 12
+export Wolfcam_CalcFov
+proc Wolfcam_CalcFov 52 12
+ADDRLP4 24
+CNSTI4 1496
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 2392
+ADDRGP4 wcg+4
+INDIRI4
+MULI4
+ADDRGP4 wclients
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1288
+ADDRLP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1288
+ADDRGP4 cg+607196+4
+INDIRI4
+CNSTI4 5
+NEI4 $1290
+ADDRGP4 cg_fovIntermission+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1294
+ADDRLP4 0
+ADDRGP4 cg_fovIntermission+8
+INDIRF4
+ASGNF4
+ADDRGP4 $1291
+JUMPV
+LABELV $1294
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1298
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $1298
+ADDRLP4 0
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1291
+JUMPV
+LABELV $1298
+ADDRLP4 0
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+ADDRGP4 $1291
+JUMPV
+LABELV $1290
+ADDRGP4 cgs+1957744
+INDIRI4
+CNSTI4 91
+LTI4 $1304
+ADDRGP4 cg_useDemoFov+12
+INDIRI4
+CNSTI4 1
+NEI4 $1304
+ADDRLP4 0
+ADDRGP4 cg+6747460
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1305
+JUMPV
+LABELV $1304
+ADDRLP4 0
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+LABELV $1305
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $1310
+LABELV $1310
+LABELV $1291
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 CG_CalcZoom
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cg+609412+16
+ARGP4
+ADDRGP4 cg+609412+20
+ARGP4
+ADDRGP4 CG_AdjustedFov
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+609412+16
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+609412+20
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+24
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1322
+ADDRLP4 32
+CNSTF4 1073741824
+CNSTF4 1078530011
+CNSTF4 1053609165
+ADDRGP4 cg+607148
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1065353216
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1323
+JUMPV
+LABELV $1322
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $1323
+ADDRGP4 cg+609412+16
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+609412+20
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1329
+ADDRGP4 cg+609812
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1330
+JUMPV
+LABELV $1329
+ADDRLP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1332
+ADDRLP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1334
+ADDRGP4 cg+609812
+CNSTF4 1058642330
+ADDRLP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1119092736
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $1333
+JUMPV
+LABELV $1334
+ADDRGP4 cg+609812
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1333
+JUMPV
+LABELV $1332
+ADDRGP4 cg+609812
+ADDRGP4 cg+609412+20
+INDIRF4
+CNSTF4 1117126656
+DIVF4
+ASGNF4
+LABELV $1333
+LABELV $1330
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $1285
+endproc Wolfcam_CalcFov 52 12
+import cg_drawBBox
+import cg_useOriginalInterpolation
+import wolfcam_fixedViewAngles
+import weapNamesCasual
+import weapNames
+import wnumOldClients
+import woldclients
+import wclients
+import wcg
+import wolfcam_following
+import CG_IsCpmaMvd
+import CG_CpmaIsRoundWarmup
+import CG_ScoresEqual
+import CG_NumPlayers
+import CG_ClientInSnapshot
+import CG_Rocket_Aim
+import CG_GameTimeout
+import CG_EntityFrozen
+import CG_CheckCpmaVersion
+import CG_CheckQlVersion
+import CG_GetTimeString
+import CG_GetLocalTimeString
+import CG_ScaleModel
+import CG_Abort
+import CG_CleanString
+import CG_StripSlashComments
+import CG_LStrip
+import CG_GetTokenGameType
+import CG_GetToken
+import CG_FS_ReadLine
+import CG_IsOurTeam
+import CG_IsEnemyTeam
+import CG_IsTeamGame
+import CG_IsFirstPersonView
+import CG_IsUs
+import CG_IsTeammate
+import CG_IsEnemy
+import SC_Cvar_Get_String
+import SC_Cvar_Get_Float
+import SC_Cvar_Get_Int
+import SC_ByteVecColorFromInt
+import SC_Vec3ColorFromCvar
+import SC_Vec4ColorFromCvars
+import SC_ByteVec3ColorFromCvar
+import SC_AlphaFromCvar
+import SC_BlueFromCvar
+import SC_GreenFromCvar
+import SC_RedFromCvar
+import SC_ParseVec3FromStr
+import SC_ParseEnemyColorsFromStr
+import SC_ParseColorFromStr
+import SC_Lowercase
+import CG_DrawActiveFrame
+import CG_AdjustOriginToAvoidSolid
+import CG_CalcSpline
+import CG_AddBufferedSound
+import CG_AdjustedFov
+import CG_CalcZoom
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_CalcVrect
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import trap_ProfileEnd
+import trap_ProfileBegin
+import trap_GetTeamSwitchTime
+import trap_GetRoundStartTimes
+import trap_R_GetFontInfo
+import trap_R_GetGlyphInfo
+import trap_Key_KeynumToStringBuf
+import trap_Key_GetBindingBuf
+import trap_Key_SetBinding
+import trap_Key_GetOverstrikeMode
+import trap_Key_SetOverstrikeMode
+import trap_GetRealMapName
+import trap_GetExtraPlayerInfo
+import trap_GetNumPlayerInfos
+import trap_Get_Demo_Timeouts
+import trap_GetItemPickup
+import trap_GetItemPickupNumber
+import trap_autoWriteConfig
+import trap_GetTorsoAnimStartTime
+import trap_GetLegsAnimStartTime
+import trap_AddAt
+import trap_GetLastServerTime
+import trap_GetFirstServerTime
+import trap_GetGameEndTime
+import trap_GetGameStartTime
+import trap_SetPathLines
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_R_GetSingleShader
+import trap_CalcSpline
+import trap_GetShaderImageData
+import trap_GetShaderImageDimensions
+import trap_RegisterShaderFromData
+import trap_ReplaceShaderImage
+import trap_GetNextVictim
+import trap_GetNextKiller
+import trap_GetLastExecutedServerCommand
+import trap_R_DrawConsoleLines
+import trap_Get_Advertisements
+import trap_Key_GetBinding
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_PeekSnapshot
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_inPVS
+import trap_R_ClearRemappedShader
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityPtrToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderLightMap
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_RealTime
+import trap_S_PrintSfxFilename
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_TraceBatchContext
+import trap_CM_FreeTraceContext
+import trap_CM_CreateTraceContext
+import trap_CM_TraceBatch
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_SendConsoleCommandNow
+import trap_SendConsoleCommand
+import trap_FS_Prefetch
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_Exists
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_NextNextSnapshot
+import CG_SnapshotRefEntity
+import CG_UpdateSnapshotRef
+import CG_SnapshotRefValid
+import CG_GetSnapshotRef
+import CG_PeekSnapshot
+import CG_GetSnapshot
+import CG_ProcessSnapshots
+import CG_ResetTimeChange
+import CG_ResetEntity
+import CG_PredictPlayerState
+import CG_PointContents
+import CG_TraceBatch
+import CG_Trace
+import CG_BuildSolidList
+import cg_solidEntities
+import cg_numSolidEntities
+import CG_DuelPlayerInfoValid
+import CG_DuelPlayerScoreValid
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_AddRefEntityWithPowerups
+import CG_FloatEntNumbers
+import CG_FloatNumberExt
+import CG_FloatNumber
+import CG_FloatSprite
+import CG_PlayerAngles
+import CG_PlayerAnimation
+import CG_ClearLerpFrame
+import CG_RunLerpFrame
+import CG_LoadDeferredPlayers
+import CG_NewClientInfo
+import CG_CopyClientInfoModel
+import CG_LoadClientInfo
+import CG_OspColorFromString
+import CG_OspColorFromPicString
+import CG_CpmaColorFromString
+import CG_CpmaColorFromPicString
+import CG_Q3ColorFromString
+import CG_RegisterClientModelname
+import CG_FindClientHeadFile
+import CG_RegisterSkinVertexLight
+import CG_FileExists
+import CG_CustomSound
+import cg_customSoundNames
+import CG_ForceModelChange
+import CG_SetDuelPlayers
+import CG_LoadDefaultMenus
+import CG_CreateScoresFromClientInfo
+import CG_ResetTimedItemPickupTimes
+import CG_Cvar_Get
+import CG_LimitText
+import CG_SetScoreSelection
+import CG_LoadMenus
+import CG_ParseMenu
+import CG_StartMusic
+import CG_ConfigStringNoConvert
+import CG_ConfigString
+import CG_ConfigStringIndexFromQ3
+import CG_ConfigStringIndexToQ3
+import CG_BuildSpectatorString
+import CG_ArgsFrom
+import CG_Argc
+import CG_Argv
+import CG_Error
+import CG_Printf
+import CG_PrintToScreen
+import CG_AddChatLine
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_CheckFontUpdates
+import CG_UpdateCvars
+import gametypeConfigs
+import cg_cullLocalEntities
+import cg_sceneBatching
+import cg_useScoresUpdateTeam
+import cg_drawKeyPress
+import cg_specOffsetQL
+import cg_useDemoFov
+import cg_rewardPerfect
+import cg_rewardFirstFrag
+import cg_rewardQuadGod
+import cg_rewardAccuracy
+import cg_rewardHeadshot
+import cg_rewardPerforated
+import cg_rewardRevenge
+import cg_rewardMidAir
+import cg_rewardRampage
+import cg_rewardComboKill
+import cg_rewardAssist
+import cg_rewardDefend
+import cg_rewardHumiliation
+import cg_rewardExcellent
+import cg_rewardImpressive
+import cg_rewardCapture
+import cg_winLossMusic
+import cg_drawFightMessage
+import cg_soundBuffer
+import cg_soundPvs
+import cg_cpmaSound
+import cg_quadSoundRate
+import cg_racePlayerShader
+import cg_drawHitFriendTime
+import cg_drawDeadFriendTime
+import cg_drawTieredArmorAvailability
+import cg_rocketAimBot
+import cg_spectatorListQue
+import cg_spectatorListScore
+import cg_spectatorListSkillRating
+import cg_headShots
+import cg_roundScoreBoard
+import cg_drawDominationPointStatusWideScreen
+import cg_drawDominationPointStatusTextStyle
+import cg_drawDominationPointStatusTextAlpha
+import cg_drawDominationPointStatusTextColor
+import cg_drawDominationPointStatusAlpha
+import cg_drawDominationPointStatusBackgroundColor
+import cg_drawDominationPointStatusTeamColor
+import cg_drawDominationPointStatusEnemyColor
+import cg_drawDominationPointStatusScale
+import cg_drawDominationPointStatusPointSize
+import cg_drawDominationPointStatusFont
+import cg_drawDominationPointStatusY
+import cg_drawDominationPointStatusX
+import cg_drawDominationPointStatus
+import cg_attackDefendVoiceStyle
+import cg_dominationPointNeutralAlpha
+import cg_dominationPointNeutralColor
+import cg_dominationPointEnemyAlpha
+import cg_dominationPointEnemyColor
+import cg_dominationPointTeamAlpha
+import cg_dominationPointTeamColor
+import cg_helpIconMaxWidth
+import cg_helpIconMinWidth
+import cg_helpIconStyle
+import cg_helpIcon
+import cg_flagTakenSound
+import cg_flagStyle
+import cg_buzzerSound
+import cg_powerupLight
+import cg_allowServerOverride
+import cg_playerModelAllowServerOverride
+import cg_playerModelAllowServerScaleDefault
+import cg_playerModelAllowServerScale
+import cg_playerModelAutoScaleHeight
+import cg_playerModelForceHeadOffset
+import cg_playerModelForceHeadScale
+import cg_playerModelForceTorsoScale
+import cg_playerModelForceLegsScale
+import cg_playerModelForceScale
+import cg_dumpEntsUseServerTime
+import cg_pathSkipNum
+import cg_pathRewindTime
+import cg_stepSmoothMaxChange
+import cg_stepSmoothTime
+import cg_demoStepSmoothing
+import cg_customMirrorSurfaces
+import cg_drawProxWarningWideScreen
+import cg_drawProxWarningAlpha
+import cg_drawProxWarningColor
+import cg_drawProxWarningScale
+import cg_drawProxWarningPointSize
+import cg_drawProxWarningFont
+import cg_drawProxWarningStyle
+import cg_drawProxWarningAlign
+import cg_drawProxWarningY
+import cg_drawProxWarningX
+import cg_drawProxWarning
+import cg_proxMineTick
+import cg_firstPersonSwitchSound
+import cg_debugAds
+import cg_adShaderOverride
+import cg_playerShader
+import cg_whEnemyAlpha
+import cg_whEnemyColor
+import cg_whEnemyShader
+import cg_whAlpha
+import cg_whColor
+import cg_whShader
+import cg_whIncludeProjectile
+import cg_whIncludeDeadBody
+import cg_wh
+import cg_wideScreenScoreBoardHack
+import cg_wideScreen
+import cg_battleSuitKillCounter
+import cg_quadKillCounter
+import cg_enableAtCommands
+import cg_fadeStyle
+import cg_fadeAlpha
+import cg_fadeColor
+import cg_inheritPowerupShader
+import cg_teamKillWarning
+import cg_mouseSeekUseTimescale
+import cg_mouseSeekPollInterval
+import cg_mouseSeekScale
+import cg_deathShowOwnCorpse
+import cg_deathStyle
+import cg_killBeep
+import cg_clientOverrideIgnoreTeamSettings
+import cg_warmupTime
+import cg_localTimeStyle
+import cg_localTime
+import cg_itemUseSound
+import cg_itemUseMessage
+import cg_noItemUseSound
+import cg_noItemUseMessage
+import cg_hasteTrail
+import cg_flightTrail
+import cg_q3mmeCameraSmoothPos
+import cg_cameraSmoothFactor
+import cg_cameraDebugPath
+import cg_cameraDefaultOriginType
+import cg_cameraUpdateFreeCam
+import cg_cameraAddUsePreviousValues
+import cg_cameraQue
+import cg_cameraRewindTime
+import cg_playerLeanScale
+import cg_drawSpritesDeadPlayers
+import cg_drawSpriteSelf
+import cg_drawSprites
+import cg_allowSpritePassThrough
+import cg_allowLargeSprites
+import cg_waterWarp
+import g_training
+import cg_drawSpecMessages
+import cg_compMode
+import cg_gameType
+import cg_kickScale
+import cg_quadFireSound
+import cg_animationsRate
+import cg_animationsIgnoreTimescale
+import cg_vibrateForce
+import cg_vibrateMaxDistance
+import cg_vibrateTime
+import cg_vibrate
+import cg_fxq3mmeCompatibility
+import cg_fxThreads
+import cg_fxCompiled
+import cg_fxDebugEntities
+import cg_fxLightningGunImpactFps
+import cg_fxScriptMinInterval
+import cg_fxScriptMinDistance
+import cg_fxScriptMinEmitter
+import cg_fxratio
+import cg_fxinterval
+import cg_fxfile
+import cg_spawnArmorTime
+import cg_thirdPersonShaderWeaponHeavyMachineGun
+import cg_thirdPersonShaderWeaponChainGun
+import cg_thirdPersonShaderWeaponProximityLauncher
+import cg_thirdPersonShaderWeaponNailGun
+import cg_thirdPersonShaderWeaponGrapplingHook
+import cg_thirdPersonShaderWeaponBFG
+import cg_thirdPersonShaderWeaponPlasmaGun
+import cg_thirdPersonShaderWeaponRailGun
+import cg_thirdPersonShaderWeaponLightningGun
+import cg_thirdPersonShaderWeaponRocketLauncher
+import cg_thirdPersonShaderWeaponGrenadeLauncher
+import cg_thirdPersonShaderWeaponShotgun
+import cg_thirdPersonShaderWeaponMachineGun
+import cg_thirdPersonShaderWeaponGauntlet
+import cg_firstPersonShaderWeaponHeavyMachineGun
+import cg_firstPersonShaderWeaponChainGun
+import cg_firstPersonShaderWeaponProximityLauncher
+import cg_firstPersonShaderWeaponNailGun
+import cg_firstPersonShaderWeaponGrapplingHook
+import cg_firstPersonShaderWeaponBFG
+import cg_firstPersonShaderWeaponPlasmaGun
+import cg_firstPersonShaderWeaponRailGun
+import cg_firstPersonShaderWeaponLightningGun
+import cg_firstPersonShaderWeaponRocketLauncher
+import cg_firstPersonShaderWeaponGrenadeLauncher
+import cg_firstPersonShaderWeaponShotgun
+import cg_firstPersonShaderWeaponMachineGun
+import cg_firstPersonShaderWeaponGauntlet
+import cg_weaponHeavyMachineGun
+import cg_weaponChainGun
+import cg_weaponProximityLauncher
+import cg_weaponNailGun
+import cg_weaponGrapplingHook
+import cg_weaponBFG
+import cg_weaponPlasmaGun
+import cg_weaponRailGun
+import cg_weaponLightningGun
+import cg_weaponRocketLauncher
+import cg_weaponGrenadeLauncher
+import cg_weaponShotgun
+import cg_weaponMachineGun
+import cg_weaponGauntlet
+import cg_weaponNone
+import cg_weaponDefault
+import cg_muzzleFlash
+import cg_checkForOfflineDemo
+import cg_levelTimerOvertimeReset
+import cg_levelTimerDefaultTimeLimit
+import cg_levelTimerDirection
+import cg_drawViewPointMark
+import cg_drawCameraPointInfoBackgroundAlpha
+import cg_drawCameraPointInfoBackgroundColor
+import cg_drawCameraPointInfoWideScreen
+import cg_drawCameraPointInfoAlpha
+import cg_drawCameraPointInfoSelectedColor
+import cg_drawCameraPointInfoColor
+import cg_drawCameraPointInfoScale
+import cg_drawCameraPointInfoPointSize
+import cg_drawCameraPointInfoFont
+import cg_drawCameraPointInfoStyle
+import cg_drawCameraPointInfoAlign
+import cg_drawCameraPointInfoY
+import cg_drawCameraPointInfoX
+import cg_drawCameraPointInfo
+import cg_drawCameraPath
+import cg_demoSmoothingTeleportCheck
+import cg_demoSmoothingAngles
+import cg_demoSmoothing
+import cg_drawEventNumbers
+import cg_drawEntNumbers
+import cg_lightningSize
+import cg_debugLightningImpactDistance
+import cg_lightningAngleOriginStyle
+import cg_lightningRenderStyle
+import cg_lightningStyle
+import cg_lightningImpactProject
+import cg_lightningImpactCapMin
+import cg_lightningImpactCap
+import cg_lightningImpactOthersSize
+import cg_lightningImpactSize
+import cg_lightningImpact
+import cg_printSkillRating
+import cg_perKillStatsClearNotFiringExcludeSingleClickWeapons
+import cg_perKillStatsClearNotFiringTime
+import cg_perKillStatsExcludePostKillSpam
+import cg_drawPlayerNamesAlpha
+import cg_drawPlayerNamesColor
+import cg_drawPlayerNamesScale
+import cg_drawPlayerNamesPointSize
+import cg_drawPlayerNamesFont
+import cg_drawPlayerNamesY
+import cg_drawPlayerNamesStyle
+import cg_drawPlayerNames
+import cg_fragIconHeightFixed
+import cg_fragTokenAccuracyStyle
+import cg_obituaryStack
+import cg_obituaryFadeTime
+import cg_obituaryTime
+import cg_obituaryBlueTeamColor
+import cg_obituaryRedTeamColor
+import cg_obituaryIconScale
+import cg_obituaryTokens
+import cg_drawFragMessageWideScreen
+import cg_drawFragMessageIconScale
+import cg_drawFragMessageFreezeTeamTokens
+import cg_drawFragMessageFreezeTokens
+import cg_drawFragMessageThawTokens
+import cg_drawFragMessageTeamTokens
+import cg_drawFragMessageTokens
+import cg_drawFragMessageFadeTime
+import cg_drawFragMessageFade
+import cg_drawFragMessageAlpha
+import cg_drawFragMessageColor
+import cg_drawFragMessageTime
+import cg_drawFragMessageScale
+import cg_drawFragMessagePointSize
+import cg_drawFragMessageFont
+import cg_drawFragMessageStyle
+import cg_drawFragMessageAlign
+import cg_drawFragMessageY
+import cg_drawFragMessageX
+import cg_drawFragMessageSeparate
+import cg_fragMessageStyle
+import cg_grenadeEnemyColorAlpha
+import cg_grenadeEnemyColor
+import cg_grenadeTeamColorAlpha
+import cg_grenadeTeamColor
+import cg_grenadeColorAlpha
+import cg_grenadeColor
+import cg_loadDefaultMenus
+import cg_accWideScreen
+import cg_accY
+import cg_accX
+import cg_echoPopupWideScreen
+import cg_echoPopupScale
+import cg_echoPopupY
+import cg_echoPopupX
+import cg_echoPopupTime
+import cg_screenDamage
+import cg_screenDamageAlpha
+import cg_screenDamage_Self
+import cg_screenDamageAlpha_Self
+import cg_screenDamage_Team
+import cg_screenDamageAlpha_Team
+import cg_printTimeStamps
+import wolfcam_drawFollowingOnlyName
+import wolfcam_drawFollowing
+import cg_ignoreServerPlaySound
+import cg_audioAnnouncerPowerup
+import cg_audioAnnouncerDominationPoint
+import cg_audioAnnouncerLastStanding
+import cg_audioAnnouncerScore
+import cg_audioAnnouncerWin
+import cg_audioAnnouncerFragLimit
+import cg_audioAnnouncerTimeLimit
+import cg_audioAnnouncerLead
+import cg_audioAnnouncerFlagStatus
+import cg_audioAnnouncerTeamVote
+import cg_audioAnnouncerVote
+import cg_audioAnnouncerWarmup
+import cg_audioAnnouncerRoundReward
+import cg_audioAnnouncerRound
+import cg_audioAnnouncerRewardsFirst
+import cg_audioAnnouncerRewards
+import cg_audioAnnouncer
+import cg_crosshairColor
+import cg_fallbackHeadModel
+import cg_fallbackModel
+import cg_disallowEnemyModelForTeammates
+import cg_deadBodyColor
+import cg_ourLegsColor
+import cg_ourTorsoColor
+import cg_ourHeadColor
+import cg_ourLegsSkin
+import cg_ourTorsoSkin
+import cg_ourHeadSkin
+import cg_ourHeadModel
+import cg_ourModel
+import cg_neutralFlagColor
+import cg_teamFlagColor
+import cg_teamRailNudge
+import cg_teamRailRings
+import cg_teamRailItemColorTeam
+import cg_teamRailItemColor
+import cg_teamRailColor2Team
+import cg_teamRailColor1Team
+import cg_teamRailColor2
+import cg_teamRailColor1
+import cg_teamLegsColor
+import cg_teamTorsoColor
+import cg_teamHeadColor
+import cg_teamLegsSkin
+import cg_teamTorsoSkin
+import cg_teamHeadSkin
+import cg_teamHeadModel
+import cg_teamModel
+import cg_ignoreClientHeadModel
+import cg_useDefaultTeamSkins
+import cg_enemyFlagColor
+import cg_enemyRailNudge
+import cg_enemyRailRings
+import cg_enemyRailItemColorTeam
+import cg_enemyRailItemColor
+import cg_enemyRailColor2Team
+import cg_enemyRailColor1Team
+import cg_enemyRailColor2
+import cg_enemyRailColor1
+import cg_enemyLegsColor
+import cg_enemyTorsoColor
+import cg_enemyHeadColor
+import cg_enemyLegsSkin
+import cg_enemyTorsoSkin
+import cg_enemyHeadSkin
+import cg_enemyHeadModel
+import cg_enemyModel
+import cg_hudForceBlueTeamClanTag
+import cg_hudForceRedTeamClanTag
+import cg_hudNoTeamColor
+import cg_hudBlueTeamColor
+import cg_hudRedTeamColor
+import cg_weaponBlueTeamColor
+import cg_weaponRedTeamColor
+import wolfcam_firstPersonSwitchSoundStyle
+import wolfcam_switchMode
+import wolfcam_hoverTime
+import cg_interpolateMissiles
+import cg_weather
+import cg_ambientSounds
+import cg_drawWarmupStringWideScreen
+import cg_drawWarmupStringAlpha
+import cg_drawWarmupStringColor
+import cg_drawWarmupStringScale
+import cg_drawWarmupStringPointSize
+import cg_drawWarmupStringFont
+import cg_drawWarmupStringStyle
+import cg_drawWarmupStringAlign
+import cg_drawWarmupStringY
+import cg_drawWarmupStringX
+import cg_drawWarmupString
+import cg_drawWaitingForPlayersWideScreen
+import cg_drawWaitingForPlayersAlpha
+import cg_drawWaitingForPlayersColor
+import cg_drawWaitingForPlayersScale
+import cg_drawWaitingForPlayersPointSize
+import cg_drawWaitingForPlayersFont
+import cg_drawWaitingForPlayersStyle
+import cg_drawWaitingForPlayersAlign
+import cg_drawWaitingForPlayersY
+import cg_drawWaitingForPlayersX
+import cg_drawWaitingForPlayers
+import cg_drawTeamVoteWideScreen
+import cg_drawTeamVoteAlpha
+import cg_drawTeamVoteColor
+import cg_drawTeamVoteScale
+import cg_drawTeamVotePointSize
+import cg_drawTeamVoteFont
+import cg_drawTeamVoteStyle
+import cg_drawTeamVoteAlign
+import cg_drawTeamVoteY
+import cg_drawTeamVoteX
+import cg_drawTeamVote
+import cg_drawVoteWideScreen
+import cg_drawVoteAlpha
+import cg_drawVoteColor
+import cg_drawVoteScale
+import cg_drawVotePointSize
+import cg_drawVoteFont
+import cg_drawVoteStyle
+import cg_drawVoteAlign
+import cg_drawVoteY
+import cg_drawVoteX
+import cg_drawVote
+import cg_drawCenterPrintWideScreen
+import cg_drawCenterPrintFadeTime
+import cg_drawCenterPrintFade
+import cg_drawCenterPrintAlpha
+import cg_drawCenterPrintColor
+import cg_drawCenterPrintTime
+import cg_drawCenterPrintScale
+import cg_drawCenterPrintPointSize
+import cg_drawCenterPrintFont
+import cg_drawCenterPrintStyle
+import cg_drawCenterPrintAlign
+import cg_drawCenterPrintY
+import cg_drawCenterPrintX
+import cg_drawCenterPrint
+import cg_serverCenterPrintToConsole
+import cg_serverCenterPrintToChat
+import cg_serverCenterPrint
+import cg_serverPrintToConsole
+import cg_serverPrintToChat
+import cg_serverPrint
+import cg_teamChatBeepMaxTime
+import cg_teamChatBeep
+import cg_chatBeepMaxTime
+import cg_chatBeep
+import cg_chatHistoryLength
+import cg_chatLines
+import cg_chatTime
+import cg_freecam_unlockPitch
+import cg_freecam_useServerView
+import cg_freecam_rollValue
+import cg_freecam_useTeamSettings
+import cg_freecam_crosshair
+import cg_freecam_speed
+import cg_freecam_pitch
+import cg_freecam_yaw
+import cg_freecam_sensitivity
+import cg_freecam_noclip
+import cg_drawSpawnsSharedZ
+import cg_drawSpawnsShared
+import cg_drawSpawnsRespawnsZ
+import cg_drawSpawnsRespawns
+import cg_drawSpawnsInitialZ
+import cg_drawSpawnsInitial
+import cg_drawSpawns
+import cg_hitBeep
+import cg_scoreBoardForceLineHeightTeamDefault
+import cg_scoreBoardForceLineHeightTeam
+import cg_scoreBoardForceLineHeightDefault
+import cg_scoreBoardForceLineHeight
+import cg_scoreBoardOldWideScreen
+import cg_scoreBoardOld
+import cg_scoreBoardWarmup
+import cg_scoreBoardAtIntermission
+import cg_scoreBoardWhenDead
+import cg_scoreBoardSpectatorScroll
+import cg_scoreBoardStyle
+import cg_drawFullWeaponBar
+import cg_weaponBarWideScreen
+import cg_weaponBarPointSize
+import cg_weaponBarFont
+import cg_weaponBarY
+import cg_weaponBarX
+import cg_weaponBar
+import cg_autoFontScalingThreshold
+import cg_autoFontScaling
+import cg_qlFontScaling
+import cg_qlhud
+import cg_testQlFont
+import cg_drawCpmaMvdIndicatorWideScreen
+import cg_drawCpmaMvdIndicatorAlpha
+import cg_drawCpmaMvdIndicatorColor
+import cg_drawCpmaMvdIndicatorScale
+import cg_drawCpmaMvdIndicatorPointSize
+import cg_drawCpmaMvdIndicatorFont
+import cg_drawCpmaMvdIndicatorStyle
+import cg_drawCpmaMvdIndicatorAlign
+import cg_drawCpmaMvdIndicatorY
+import cg_drawCpmaMvdIndicatorX
+import cg_drawCpmaMvdIndicator
+import cg_drawFollowingWideScreen
+import cg_drawFollowingAlpha
+import cg_drawFollowingColor
+import cg_drawFollowingScale
+import cg_drawFollowingPointSize
+import cg_drawFollowingFont
+import cg_drawFollowingStyle
+import cg_drawFollowingAlign
+import cg_drawFollowingY
+import cg_drawFollowingX
+import cg_drawFollowing
+import cg_drawItemPickupsWideScreen
+import cg_drawItemPickupsCount
+import cg_drawItemPickupsFadeTime
+import cg_drawItemPickupsFade
+import cg_drawItemPickupsAlpha
+import cg_drawItemPickupsColor
+import cg_drawItemPickupsTime
+import cg_drawItemPickupsScale
+import cg_drawItemPickupsPointSize
+import cg_drawItemPickupsFont
+import cg_drawItemPickupsStyle
+import cg_drawItemPickupsAlign
+import cg_drawItemPickupsImageScale
+import cg_drawItemPickupsY
+import cg_drawItemPickupsX
+import cg_drawItemPickups
+import cg_drawPowerupAvailableFadeEnd
+import cg_drawPowerupAvailableFadeStart
+import cg_drawPowerupAvailableAlpha
+import cg_drawPowerupAvailableOffset
+import cg_drawPowerupAvailableScale
+import cg_drawPowerupAvailable
+import cg_drawPowerupRespawnAlpha
+import cg_drawPowerupRespawnOffset
+import cg_drawPowerupRespawnScale
+import cg_drawPowerupRespawn
+import cg_drawPowerups
+import cg_drawPlayersLeft
+import cg_drawScores
+import cg_drawOriginWideScreen
+import cg_drawOriginAlpha
+import cg_drawOriginColor
+import cg_drawOriginScale
+import cg_drawOriginPointSize
+import cg_drawOriginFont
+import cg_drawOriginStyle
+import cg_drawOriginAlign
+import cg_drawOriginY
+import cg_drawOriginX
+import cg_drawOrigin
+import cg_drawSpeedChangeColor
+import cg_drawSpeedWideScreen
+import cg_drawSpeedAlpha
+import cg_drawSpeedColor
+import cg_drawSpeedScale
+import cg_drawSpeedPointSize
+import cg_drawSpeedFont
+import cg_drawSpeedStyle
+import cg_drawSpeedAlign
+import cg_drawSpeedNoText
+import cg_drawSpeedY
+import cg_drawSpeedX
+import cg_drawSpeed
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_serverEnableBreath
+import cg_serverEnableDust
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_trueLightning
+import cg_plasmaStyle
+import cg_oldRocket
+import cg_smokeRadius_haste
+import cg_smokeRadius_flight
+import cg_enableDust
+import cg_smokeRadius_dust
+import cg_enableBreath
+import cg_smokeRadius_breath
+import cg_smokeRadius_PL
+import cg_smokeRadius_RL
+import cg_smokeRadius_NG
+import cg_smokeRadius_GL
+import cg_smokeRadius_SG
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_damagePlumAlpha
+import cg_damagePlumColor
+import cg_damagePlumScale
+import cg_damagePlumPointSize
+import cg_damagePlumFontStyle
+import cg_damagePlumFont
+import cg_damagePlumRandomVelocity
+import cg_damagePlumGravity
+import cg_damagePlumBounce
+import cg_damagePlumTime
+import cg_damagePlumTarget
+import cg_damagePlumColorStyle
+import cg_damagePlum
+import cg_scorePlums
+import cg_teamChatsOnly
+import cg_drawHitFlagCarrierTime
+import cg_drawFlagCarrierSize
+import cg_drawFlagCarrier
+import cg_drawInfected
+import cg_drawSelfIconStyle
+import cg_drawSelfMaxWidth
+import cg_drawSelfMinWidth
+import cg_drawSelf
+import cg_drawFoeMaxWidth
+import cg_drawFoeMinWidth
+import cg_drawFoe
+import cg_drawFriendMaxWidth
+import cg_drawFriendMinWidth
+import cg_drawFriendStyle
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_bleedTime
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forcePovModelIgnoreFreecamTeamSettings
+import cg_forcePovModel
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttackerWideScreen
+import cg_drawAttackerFadeTime
+import cg_drawAttackerFade
+import cg_drawAttackerAlpha
+import cg_drawAttackerColor
+import cg_drawAttackerTime
+import cg_drawAttackerImageScale
+import cg_drawAttackerScale
+import cg_drawAttackerPointSize
+import cg_drawAttackerFont
+import cg_drawAttackerStyle
+import cg_drawAttackerAlign
+import cg_drawAttackerY
+import cg_drawAttackerX
+import cg_drawAttacker
+import cg_lagometerSnapshotPing
+import cg_lagometerAveragePing
+import cg_lagometerFontAlpha
+import cg_lagometerAlpha
+import cg_lagometerFontColor
+import cg_lagometerScale
+import cg_lagometerFontScale
+import cg_lagometerFontPointSize
+import cg_lagometerFont
+import cg_lagometerFontStyle
+import cg_lagometerFontAlign
+import cg_lagometerAlign
+import cg_lagometerFlashValue
+import cg_lagometerFlash
+import cg_lagometerWideScreen
+import cg_lagometerY
+import cg_lagometerX
+import cg_lagometer
+import cg_stereoSeparation
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomBroken
+import cg_zoomIgnoreTimescale
+import cg_zoomTime
+import cg_zoomFov
+import cg_fovIntermission
+import cg_fovForceAspectHeight
+import cg_fovForceAspectWidth
+import cg_fovStyle
+import cg_fovy
+import cg_fov
+import cg_itemSize
+import cg_itemFx
+import cg_itemsWh
+import cg_simpleItemsHeightOffset
+import cg_simpleItemsBob
+import cg_simpleItemsScale
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gunSizeThirdPerson
+import cg_gunSize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_debugImpactOrigin
+import cg_markFadeTime
+import cg_markTime
+import cg_marks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railFromMuzzle
+import cg_railUseOwnColors
+import cg_railItemColor
+import cg_railSpacing
+import cg_railRotation
+import cg_railRadius
+import cg_railRings
+import cg_railNudge
+import cg_railQLRailRingWhiteValue
+import cg_railQL
+import cg_railTrailTime
+import cg_debugServerCommands
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawTeamBackground
+import cg_drawStatus
+import cg_crosshairAlphaAdjust
+import cg_crosshairAlpha
+import cg_crosshairBrightness
+import cg_crosshairHitTime
+import cg_crosshairHitColor
+import cg_crosshairHitStyle
+import cg_crosshairPulse
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_drawRaceTimeWideScreen
+import cg_drawRaceTimeAlpha
+import cg_drawRaceTimeColor
+import cg_drawRaceTimeScale
+import cg_drawRaceTimePointSize
+import cg_drawRaceTimeFont
+import cg_drawRaceTimeStyle
+import cg_drawRaceTimeAlign
+import cg_drawRaceTimeY
+import cg_drawRaceTimeX
+import cg_drawRaceTimeNoText
+import cg_drawRaceTime
+import cg_drawJumpSpeedsTimeWideScreen
+import cg_drawJumpSpeedsTimeAlpha
+import cg_drawJumpSpeedsTimeColor
+import cg_drawJumpSpeedsTimeScale
+import cg_drawJumpSpeedsTimePointSize
+import cg_drawJumpSpeedsTimeFont
+import cg_drawJumpSpeedsTimeStyle
+import cg_drawJumpSpeedsTimeAlign
+import cg_drawJumpSpeedsTimeY
+import cg_drawJumpSpeedsTimeX
+import cg_drawJumpSpeedsTimeNoText
+import cg_drawJumpSpeedsTime
+import cg_drawJumpSpeedsWideScreen
+import cg_drawJumpSpeedsAlpha
+import cg_drawJumpSpeedsColor
+import cg_drawJumpSpeedsScale
+import cg_drawJumpSpeedsPointSize
+import cg_drawJumpSpeedsFont
+import cg_drawJumpSpeedsStyle
+import cg_drawJumpSpeedsAlign
+import cg_drawJumpSpeedsY
+import cg_drawJumpSpeedsX
+import cg_drawJumpSpeedsMax
+import cg_drawJumpSpeedsNoText
+import cg_drawJumpSpeeds
+import cg_selfOnTeamOverlay
+import cg_drawTeamOverlayMaxPlayers
+import cg_drawTeamOverlayLineOffset
+import cg_drawTeamOverlayWideScreen
+import cg_drawTeamOverlayScale
+import cg_drawTeamOverlayAlign
+import cg_drawTeamOverlayPointSize
+import cg_drawTeamOverlayFont
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlayY
+import cg_drawTeamOverlayX
+import cg_drawTeamOverlay
+import cg_rewardsStack
+import cg_drawRewardsWideScreen
+import cg_drawRewardsFadeTime
+import cg_drawRewardsFade
+import cg_drawRewardsAlpha
+import cg_drawRewardsColor
+import cg_drawRewardsTime
+import cg_drawRewardsImageScale
+import cg_drawRewardsScale
+import cg_drawRewardsPointSize
+import cg_drawRewardsFont
+import cg_drawRewardsStyle
+import cg_drawRewardsAlign
+import cg_drawRewardsY
+import cg_drawRewardsX
+import cg_drawRewardsMax
+import cg_drawRewards
+import cg_drawCrosshairTeammateHealthWideScreen
+import cg_drawCrosshairTeammateHealthFadeTime
+import cg_drawCrosshairTeammateHealthFade
+import cg_drawCrosshairTeammateHealthAlpha
+import cg_drawCrosshairTeammateHealthColor
+import cg_drawCrosshairTeammateHealthTime
+import cg_drawCrosshairTeammateHealthScale
+import cg_drawCrosshairTeammateHealthPointSize
+import cg_drawCrosshairTeammateHealthFont
+import cg_drawCrosshairTeammateHealthStyle
+import cg_drawCrosshairTeammateHealthAlign
+import cg_drawCrosshairTeammateHealthY
+import cg_drawCrosshairTeammateHealthX
+import cg_drawCrosshairTeammateHealth
+import cg_drawCrosshairNamesWideScreen
+import cg_drawCrosshairNamesFadeTime
+import cg_drawCrosshairNamesFade
+import cg_drawCrosshairNamesAlpha
+import cg_drawCrosshairNamesColor
+import cg_drawCrosshairNamesTime
+import cg_drawCrosshairNamesScale
+import cg_drawCrosshairNamesPointSize
+import cg_drawCrosshairNamesFont
+import cg_drawCrosshairNamesStyle
+import cg_drawCrosshairNamesAlign
+import cg_drawCrosshairNamesY
+import cg_drawCrosshairNamesX
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_lowAmmoWarningChainGun
+import cg_lowAmmoWarningProximityLauncher
+import cg_lowAmmoWarningNailGun
+import cg_lowAmmoWarningGrapplingHook
+import cg_lowAmmoWarningBFG
+import cg_lowAmmoWarningPlasmaGun
+import cg_lowAmmoWarningRailGun
+import cg_lowAmmoWarningLightningGun
+import cg_lowAmmoWarningRocketLauncher
+import cg_lowAmmoWarningGrenadeLauncher
+import cg_lowAmmoWarningShotgun
+import cg_lowAmmoWarningMachineGun
+import cg_lowAmmoWarningGauntlet
+import cg_lowAmmoWeaponBarWarning
+import cg_lowAmmoWarningSound
+import cg_lowAmmoWarningPercentile
+import cg_lowAmmoWarningStyle
+import cg_drawAmmoWarningWideScreen
+import cg_drawAmmoWarningAlpha
+import cg_drawAmmoWarningColor
+import cg_drawAmmoWarningScale
+import cg_drawAmmoWarningPointSize
+import cg_drawAmmoWarningFont
+import cg_drawAmmoWarningStyle
+import cg_drawAmmoWarningAlign
+import cg_drawAmmoWarningY
+import cg_drawAmmoWarningX
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshotWideScreen
+import cg_drawSnapshotAlpha
+import cg_drawSnapshotColor
+import cg_drawSnapshotScale
+import cg_drawSnapshotPointSize
+import cg_drawSnapshotFont
+import cg_drawSnapshotStyle
+import cg_drawSnapshotAlign
+import cg_drawSnapshotY
+import cg_drawSnapshotX
+import cg_drawSnapshot
+import cg_drawFPSWideScreen
+import cg_drawFPSAlpha
+import cg_drawFPSColor
+import cg_drawFPSScale
+import cg_drawFPSPointSize
+import cg_drawFPSFont
+import cg_drawFPSStyle
+import cg_drawFPSAlign
+import cg_drawFPSY
+import cg_drawFPSX
+import cg_drawFPSNoText
+import cg_drawFPS
+import cg_itemTimersAlpha
+import cg_itemTimersOffset
+import cg_itemTimersScale
+import cg_itemTimers
+import cg_itemSpawnPrint
+import cg_drawClientItemTimerWideScreen
+import cg_drawClientItemTimerIconYoffset
+import cg_drawClientItemTimerIconXoffset
+import cg_drawClientItemTimerIconSize
+import cg_drawClientItemTimerIcon
+import cg_drawClientItemTimerSpacing
+import cg_drawClientItemTimerAlign
+import cg_drawClientItemTimerStyle
+import cg_drawClientItemTimerAlpha
+import cg_drawClientItemTimerPointSize
+import cg_drawClientItemTimerFont
+import cg_drawClientItemTimerTextColor
+import cg_drawClientItemTimerScale
+import cg_drawClientItemTimerY
+import cg_drawClientItemTimerX
+import cg_drawClientItemTimerFilter
+import cg_drawClientItemTimer
+import cg_drawTimer
+import cg_shotgunRandomness
+import cg_shotgunStyle
+import cg_shotgunMarks
+import cg_shotgunImpactSparks
+import cg_impactSparksHighlight
+import cg_impactSparksColor
+import cg_impactSparksVelocity
+import cg_impactSparksSize
+import cg_impactSparksLifetime
+import cg_impactSparks
+import cg_gibFloatingOriginOffsetZ
+import cg_gibFloatingOriginOffset
+import cg_gibFloatingRandomness
+import cg_gibFloatingVelocity
+import cg_gibSparksHighlight
+import cg_gibSparksColor
+import cg_gibSparksSize
+import cg_gibGravity
+import cg_gibBounceFactor
+import cg_gibStepTime
+import cg_gibTime
+import cg_gibRandomnessZ
+import cg_gibRandomness
+import cg_gibOriginOffsetZ
+import cg_gibOriginOffset
+import cg_gibDirScale
+import cg_gibVelocityRandomness
+import cg_gibVelocity
+import cg_gibJump
+import cg_gibColor
+import cg_gibs
+import cg_thawGibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import EM_Loaded
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import cgDC
+import CG_CameraPathChanged
+import CG_CameraResetInternalLengths
+import CG_CameraAngleLongestDistanceWithRoll
+import CG_CameraAngleLongestDistanceNoRoll
+import CG_CameraSplineFovAt
+import CG_CameraSplineOriginAt
+import CG_CameraSplineAnglesAt
+import demoJitterCreate
+import demoCreateRotationMatrix
+import demoTransposeMatrix
+import demoRotatePoint
+import demoDrawGrid
+import demoDrawSetupVerts
+import demoDrawRawLine
+import demoDrawLine
+import demoDrawBox
+import demoDrawCross
+import dsplineCalc
+import AnglesNormalize180
+import AnglesNormalize360
+import VectorDistance
+import VectorDistanceSquared
+import posGet
+import posMatrix
+import QuatNormalize
+import QuatClear
+import QuatLength
+import QuatLengthSquared
+import QuatScaleAdd
+import QuatScale
+import QuatSub
+import QuatAdd
+import QuatConjugate
+import QuatNegate
+import QuatCopy
+import QuatDot
+import AngleForward
+import VectorTimeSpline
+import QuatExp
+import QuatLog
+import QuatTimeSpline
+import QuatSquad
+import QuatSlerp
+import QuatMultiply
+import QuatToAxisAngle
+import QuatToAxis
+import QuatToAngles
+import QuatFromAxisAngle
+import QuatFromAnglesClosest
+import QuatFromAngles
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_HandleCapture
+import Menu_New
+import Menu_Count
+import Q_MathScript
+import MenuVar_Get
+import MenuVar_Set
+import PC_Parenthesis_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $595
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $540
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $530
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $450
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $284
+byte 1 45
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $279
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $245
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $184
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $170
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $164
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $153
+byte 1 0
@@ -0,0 +1,8941 @@
+export BotNumActivePlayers
+code
+proc BotNumActivePlayers 1056 12
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 $61
+JUMPV
+LABELV $58
+ADDRLP4 1024
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRU4
+CNSTU4 0
+EQU4 $66
+ADDRLP4 0
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1044
+INDIRU4
+CNSTU4 0
+NEU4 $63
+LABELV $66
+ADDRGP4 $59
+JUMPV
+LABELV $63
+ADDRLP4 0
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 3
+NEI4 $67
+ADDRGP4 $59
+JUMPV
+LABELV $67
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $59
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $61
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $58
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $57
+endproc BotNumActivePlayers 1056 12
+export BotIsFirstInRankings
+proc BotIsFirstInRankings 1564 12
+ADDRLP4 1536
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 $74
+JUMPV
+LABELV $71
+ADDRLP4 1024
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1540
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1540
+INDIRU4
+CNSTU4 0
+EQU4 $78
+ADDRLP4 0
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1544
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1544
+INDIRP4
+ARGP4
+ADDRLP4 1548
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1548
+INDIRU4
+CNSTU4 0
+NEU4 $76
+LABELV $78
+ADDRGP4 $72
+JUMPV
+LABELV $76
+ADDRLP4 0
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1552
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1552
+INDIRP4
+ARGP4
+ADDRLP4 1556
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1556
+INDIRI4
+CNSTI4 3
+NEI4 $79
+ADDRGP4 $72
+JUMPV
+LABELV $79
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1560
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 1560
+INDIRI4
+CNSTI4 0
+EQI4 $81
+ADDRLP4 1536
+INDIRI4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1028+248
+ADDP4
+INDIRI4
+GEI4 $81
+CNSTI4 0
+RETI4
+ADDRGP4 $70
+JUMPV
+LABELV $81
+LABELV $72
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $74
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $71
+CNSTI4 1
+RETI4
+LABELV $70
+endproc BotIsFirstInRankings 1564 12
+export BotIsLastInRankings
+proc BotIsLastInRankings 1564 12
+ADDRLP4 1536
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 $88
+JUMPV
+LABELV $85
+ADDRLP4 1024
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1540
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1540
+INDIRU4
+CNSTU4 0
+EQU4 $92
+ADDRLP4 0
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1544
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1544
+INDIRP4
+ARGP4
+ADDRLP4 1548
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1548
+INDIRU4
+CNSTU4 0
+NEU4 $90
+LABELV $92
+ADDRGP4 $86
+JUMPV
+LABELV $90
+ADDRLP4 0
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1552
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1552
+INDIRP4
+ARGP4
+ADDRLP4 1556
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1556
+INDIRI4
+CNSTI4 3
+NEI4 $93
+ADDRGP4 $86
+JUMPV
+LABELV $93
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1560
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 1560
+INDIRI4
+CNSTI4 0
+EQI4 $95
+ADDRLP4 1536
+INDIRI4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1028+248
+ADDP4
+INDIRI4
+LEI4 $95
+CNSTI4 0
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $95
+LABELV $86
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $88
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $85
+CNSTI4 1
+RETI4
+LABELV $84
+endproc BotIsLastInRankings 1564 12
+bss
+align 1
+LABELV $99
+skip 32
+export BotFirstClientInRankings
+code
+proc BotFirstClientInRankings 1572 12
+ADDRLP4 1536
+CNSTI4 -999999
+ASGNI4
+ADDRLP4 1544
+CNSTI4 0
+ASGNI4
+ADDRLP4 1540
+ADDRLP4 1544
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1544
+INDIRI4
+ASGNI4
+ADDRGP4 $103
+JUMPV
+LABELV $100
+ADDRLP4 1024
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1548
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1548
+INDIRU4
+CNSTU4 0
+EQU4 $107
+ADDRLP4 0
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1552
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1552
+INDIRP4
+ARGP4
+ADDRLP4 1556
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1556
+INDIRU4
+CNSTU4 0
+NEU4 $105
+LABELV $107
+ADDRGP4 $101
+JUMPV
+LABELV $105
+ADDRLP4 0
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1560
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1560
+INDIRP4
+ARGP4
+ADDRLP4 1564
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1564
+INDIRI4
+CNSTI4 3
+NEI4 $108
+ADDRGP4 $101
+JUMPV
+LABELV $108
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1568
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 1568
+INDIRI4
+CNSTI4 0
+EQI4 $110
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1028+248
+ADDP4
+INDIRI4
+ADDRLP4 1536
+INDIRI4
+LEI4 $110
+ADDRLP4 1536
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1028+248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1540
+ADDRLP4 1024
+INDIRI4
+ASGNI4
+LABELV $110
+LABELV $101
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $103
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $100
+ADDRLP4 1540
+INDIRI4
+ARGI4
+ADDRGP4 $99
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $99
+RETP4
+LABELV $98
+endproc BotFirstClientInRankings 1572 12
+bss
+align 1
+LABELV $115
+skip 32
+export BotLastClientInRankings
+code
+proc BotLastClientInRankings 1572 12
+ADDRLP4 1536
+CNSTI4 999999
+ASGNI4
+ADDRLP4 1544
+CNSTI4 0
+ASGNI4
+ADDRLP4 1540
+ADDRLP4 1544
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1544
+INDIRI4
+ASGNI4
+ADDRGP4 $119
+JUMPV
+LABELV $116
+ADDRLP4 1024
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1548
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1548
+INDIRU4
+CNSTU4 0
+EQU4 $123
+ADDRLP4 0
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1552
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1552
+INDIRP4
+ARGP4
+ADDRLP4 1556
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1556
+INDIRU4
+CNSTU4 0
+NEU4 $121
+LABELV $123
+ADDRGP4 $117
+JUMPV
+LABELV $121
+ADDRLP4 0
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1560
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1560
+INDIRP4
+ARGP4
+ADDRLP4 1564
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1564
+INDIRI4
+CNSTI4 3
+NEI4 $124
+ADDRGP4 $117
+JUMPV
+LABELV $124
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1568
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 1568
+INDIRI4
+CNSTI4 0
+EQI4 $126
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1028+248
+ADDP4
+INDIRI4
+ADDRLP4 1536
+INDIRI4
+GEI4 $126
+ADDRLP4 1536
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1028+248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1540
+ADDRLP4 1024
+INDIRI4
+ASGNI4
+LABELV $126
+LABELV $117
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $119
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $116
+ADDRLP4 1540
+INDIRI4
+ARGI4
+ADDRGP4 $115
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $115
+RETP4
+LABELV $114
+endproc BotLastClientInRankings 1572 12
+bss
+align 1
+LABELV $131
+skip 32
+export BotRandomOpponentName
+code
+proc BotRandomOpponentName 1320 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1292
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $132
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $137
+ADDRGP4 $133
+JUMPV
+LABELV $137
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1296
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1296
+INDIRU4
+CNSTU4 0
+EQU4 $141
+ADDRLP4 4
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1300
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1300
+INDIRP4
+ARGP4
+ADDRLP4 1304
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1304
+INDIRU4
+CNSTU4 0
+NEU4 $139
+LABELV $141
+ADDRGP4 $133
+JUMPV
+LABELV $139
+ADDRLP4 4
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1308
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1308
+INDIRP4
+ARGP4
+ADDRLP4 1312
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 3
+NEI4 $142
+ADDRGP4 $133
+JUMPV
+LABELV $142
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1316
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+EQI4 $144
+ADDRGP4 $133
+JUMPV
+LABELV $144
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1036
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $133
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $135
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $132
+ADDRLP4 1296
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1296
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 1028
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $149
+JUMPV
+LABELV $146
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+GTI4 $150
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1036
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $131
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $131
+RETP4
+ADDRGP4 $130
+JUMPV
+LABELV $150
+LABELV $147
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $149
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $146
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 $131
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $131
+RETP4
+LABELV $130
+endproc BotRandomOpponentName 1320 12
+bss
+align 1
+LABELV $153
+skip 128
+export BotMapTitle
+code
+proc BotMapTitle 1028 12
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $154
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $153
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTU4 127
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRGP4 $153+127
+CNSTI1 0
+ASGNI1
+ADDRGP4 $153
+RETP4
+LABELV $152
+endproc BotMapTitle 1028 12
+export BotWeaponNameForMeansOfDeath
+proc BotWeaponNameForMeansOfDeath 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $157
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GTI4 $157
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $192-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $192
+address $159
+address $161
+address $163
+address $167
+address $167
+address $169
+address $169
+address $171
+address $171
+address $173
+address $175
+address $177
+address $177
+address $157
+address $157
+address $157
+address $157
+address $157
+address $157
+address $157
+address $157
+address $157
+address $179
+address $181
+address $183
+address $185
+address $187
+address $189
+address $157
+address $157
+address $157
+address $165
+code
+LABELV $159
+ADDRGP4 $160
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $161
+ADDRGP4 $162
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $163
+ADDRGP4 $164
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $165
+ADDRGP4 $166
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $167
+ADDRGP4 $168
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $169
+ADDRGP4 $170
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $171
+ADDRGP4 $172
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $173
+ADDRGP4 $174
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $175
+ADDRGP4 $176
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $177
+ADDRGP4 $178
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $179
+ADDRGP4 $180
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $181
+ADDRGP4 $182
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $183
+ADDRGP4 $184
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $185
+ADDRGP4 $186
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $187
+ADDRGP4 $188
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $189
+ADDRGP4 $190
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $157
+ADDRGP4 $191
+RETP4
+LABELV $156
+endproc BotWeaponNameForMeansOfDeath 4 0
+export BotRandomWeaponName
+proc BotRandomWeaponName 12 0
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1094608486
+ADDRLP4 4
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $195
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+GTI4 $195
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $208
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $208
+address $197
+address $198
+address $199
+address $200
+address $201
+address $202
+address $203
+address $204
+address $205
+address $206
+address $207
+code
+LABELV $197
+ADDRGP4 $162
+RETP4
+ADDRGP4 $194
+JUMPV
+LABELV $198
+ADDRGP4 $160
+RETP4
+ADDRGP4 $194
+JUMPV
+LABELV $199
+ADDRGP4 $164
+RETP4
+ADDRGP4 $194
+JUMPV
+LABELV $200
+ADDRGP4 $168
+RETP4
+ADDRGP4 $194
+JUMPV
+LABELV $201
+ADDRGP4 $170
+RETP4
+ADDRGP4 $194
+JUMPV
+LABELV $202
+ADDRGP4 $172
+RETP4
+ADDRGP4 $194
+JUMPV
+LABELV $203
+ADDRGP4 $174
+RETP4
+ADDRGP4 $194
+JUMPV
+LABELV $204
+ADDRGP4 $176
+RETP4
+ADDRGP4 $194
+JUMPV
+LABELV $205
+ADDRGP4 $180
+RETP4
+ADDRGP4 $194
+JUMPV
+LABELV $206
+ADDRGP4 $182
+RETP4
+ADDRGP4 $194
+JUMPV
+LABELV $207
+ADDRGP4 $184
+RETP4
+ADDRGP4 $194
+JUMPV
+LABELV $195
+ADDRGP4 $178
+RETP4
+LABELV $194
+endproc BotRandomWeaponName 12 0
+export BotVisibleEnemies
+proc BotVisibleEnemies 172 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $210
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $214
+ADDRGP4 $211
+JUMPV
+LABELV $214
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $216
+ADDRGP4 $211
+JUMPV
+LABELV $216
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $221
+ADDRLP4 4+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $218
+LABELV $221
+ADDRGP4 $211
+JUMPV
+LABELV $218
+ADDRLP4 4
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $222
+ADDRLP4 4
+ARGP4
+ADDRLP4 156
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $222
+ADDRGP4 $211
+JUMPV
+LABELV $222
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $224
+ADDRGP4 $211
+JUMPV
+LABELV $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+LEF4 $226
+CNSTI4 1
+RETI4
+ADDRGP4 $209
+JUMPV
+LABELV $226
+LABELV $211
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $210
+CNSTI4 0
+RETI4
+LABELV $209
+endproc BotVisibleEnemies 172 20
+export BotValidChatPosition
+proc BotValidChatPosition 168 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $229
+CNSTI4 1
+RETI4
+ADDRGP4 $228
+JUMPV
+LABELV $229
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 5000
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 5008
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+EQI4 $231
+LABELV $237
+CNSTI4 0
+RETI4
+ADDRGP4 $228
+JUMPV
+LABELV $231
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+EQI4 $239
+CNSTI4 0
+RETI4
+ADDRGP4 $228
+JUMPV
+LABELV $239
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $242
+CNSTI4 0
+RETI4
+ADDRGP4 $228
+JUMPV
+LABELV $242
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 164
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRLP4 164
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 60
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 60+80
+INDIRI4
+CNSTI4 1022
+EQI4 $246
+CNSTI4 0
+RETI4
+ADDRGP4 $228
+JUMPV
+LABELV $246
+CNSTI4 1
+RETI4
+LABELV $228
+endproc BotValidChatPosition 168 28
+export BotChat_EnterGame
+proc BotChat_EnterGame 68 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $250
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $253
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $253
+ADDRLP4 36
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $255
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $255
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $257
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 27
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $259
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRF4
+LEF4 $262
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $262
+LABELV $259
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $264
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $266
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 52
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $249
+endproc BotChat_EnterGame 68 32
+export BotChat_ExitGame
+proc BotChat_ExitGame 64 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $271
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $271
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $274
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $274
+ADDRLP4 36
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $276
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $276
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $278
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $278
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 27
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $280
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRF4
+LEF4 $283
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $283
+LABELV $280
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $285
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 48
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $270
+endproc BotChat_ExitGame 64 32
+export BotChat_StartLevel
+proc BotChat_StartLevel 56 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $289
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $289
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $292
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $294
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $294
+ADDRLP4 40
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $296
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $296
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $298
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $298
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 44
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $300
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRF4
+LEF4 $303
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $303
+LABELV $300
+ADDRLP4 48
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+GTI4 $305
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 52
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $288
+endproc BotChat_StartLevel 56 16
+export BotChat_EndLevel
+proc BotChat_EndLevel 80 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $309
+CNSTI4 0
+RETI4
+ADDRGP4 $308
+JUMPV
+LABELV $309
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $312
+CNSTI4 0
+RETI4
+ADDRGP4 $308
+JUMPV
+LABELV $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $314
+CNSTI4 0
+RETI4
+ADDRGP4 $308
+JUMPV
+LABELV $314
+ADDRLP4 40
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $316
+CNSTI4 1
+RETI4
+ADDRGP4 $308
+JUMPV
+LABELV $316
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $318
+CNSTI4 0
+RETI4
+ADDRGP4 $308
+JUMPV
+LABELV $318
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 44
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $320
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRF4
+LEF4 $323
+CNSTI4 0
+RETI4
+ADDRGP4 $308
+JUMPV
+LABELV $323
+LABELV $320
+ADDRLP4 48
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+GTI4 $325
+CNSTI4 0
+RETI4
+ADDRGP4 $308
+JUMPV
+LABELV $325
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotIsFirstInRankings
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $327
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 56
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $328
+JUMPV
+LABELV $327
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotIsLastInRankings
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 60
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $332
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 60
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $333
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $331
+LABELV $328
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $308
+endproc BotChat_EndLevel 80 32
+export BotChat_Death
+proc BotChat_Death 124 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $335
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $335
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $338
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 29
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $340
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $340
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $345
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $345
+LABELV $342
+ADDRLP4 40
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+GTI4 $347
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $347
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 5892
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LTI4 $349
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+GEI4 $349
+ADDRFP4 0
+INDIRP4
+CNSTI4 5892
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRLP4 0
+ARGP4
+ADDRGP4 $351
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $350
+ADDRLP4 48
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $352
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5892
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $352
+ADDRFP4 0
+INDIRP4
+CNSTI4 5892
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $354
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $354
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $352
+ADDRLP4 60
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $357
+CNSTI4 1
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+CNSTI4 14
+NEI4 $359
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $361
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $360
+JUMPV
+LABELV $359
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+CNSTI4 15
+NEI4 $362
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+CNSTI4 16
+NEI4 $365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $367
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $366
+JUMPV
+LABELV $365
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+CNSTI4 19
+NEI4 $368
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $370
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $369
+JUMPV
+LABELV $368
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5904
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $377
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 17
+EQI4 $377
+ADDRLP4 88
+INDIRI4
+CNSTI4 20
+EQI4 $377
+ADDRLP4 88
+INDIRI4
+CNSTI4 21
+EQI4 $377
+ADDRLP4 88
+INDIRI4
+CNSTI4 22
+EQI4 $377
+ADDRLP4 88
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $371
+LABELV $377
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $372
+JUMPV
+LABELV $371
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+CNSTI4 18
+NEI4 $379
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+CNSTI4 26
+NEI4 $382
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $384
+ARGP4
+ADDRLP4 100
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $382
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $384
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $383
+JUMPV
+LABELV $382
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 2
+EQI4 $389
+ADDRLP4 104
+INDIRI4
+CNSTI4 10
+EQI4 $389
+ADDRLP4 104
+INDIRI4
+CNSTI4 12
+EQI4 $389
+ADDRLP4 104
+INDIRI4
+CNSTI4 13
+NEI4 $385
+LABELV $389
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $390
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $390
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $385
+ADDRLP4 112
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 116
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 112
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 116
+INDIRF4
+GEF4 $397
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $400
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $398
+LABELV $386
+LABELV $383
+LABELV $380
+LABELV $372
+LABELV $369
+LABELV $366
+LABELV $363
+LABELV $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $353
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $334
+endproc BotChat_Death 124 20
+export BotChat_Kill
+proc BotChat_Kill 88 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $402
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $405
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $405
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $407
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $407
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $409
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $412
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $412
+LABELV $409
+ADDRFP4 0
+INDIRP4
+CNSTI4 5888
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $414
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $414
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $416
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $416
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $418
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $418
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $420
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 5888
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5888
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $424
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 68
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $425
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $425
+ADDRFP4 0
+INDIRP4
+CNSTI4 5900
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $427
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $429
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $428
+JUMPV
+LABELV $427
+ADDRFP4 0
+INDIRP4
+CNSTI4 5900
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $430
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $432
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRFP4 0
+INDIRP4
+CNSTI4 5900
+ADDP4
+INDIRI4
+CNSTI4 18
+NEI4 $433
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $435
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+CNSTI4 26
+NEI4 $436
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $438
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $436
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $437
+JUMPV
+LABELV $436
+ADDRLP4 80
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 84
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 84
+INDIRF4
+GEF4 $439
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $441
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $442
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $440
+LABELV $437
+LABELV $434
+LABELV $431
+LABELV $428
+LABELV $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $401
+endproc BotChat_Kill 88 16
+export BotChat_EnemySuicide
+proc BotChat_EnemySuicide 56 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $444
+CNSTI4 0
+RETI4
+ADDRGP4 $443
+JUMPV
+LABELV $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $447
+CNSTI4 0
+RETI4
+ADDRGP4 $443
+JUMPV
+LABELV $447
+ADDRLP4 36
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+GTI4 $449
+CNSTI4 0
+RETI4
+ADDRGP4 $443
+JUMPV
+LABELV $449
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 30
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $451
+CNSTI4 0
+RETI4
+ADDRGP4 $443
+JUMPV
+LABELV $451
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $453
+CNSTI4 0
+RETI4
+ADDRGP4 $443
+JUMPV
+LABELV $453
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $455
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $458
+CNSTI4 0
+RETI4
+ADDRGP4 $443
+JUMPV
+LABELV $458
+LABELV $455
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $460
+CNSTI4 0
+RETI4
+ADDRGP4 $443
+JUMPV
+LABELV $460
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $462
+CNSTI4 0
+RETI4
+ADDRGP4 $443
+JUMPV
+LABELV $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $464
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRLP4 0
+ARGP4
+ADDRGP4 $466
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $443
+endproc BotChat_EnemySuicide 56 16
+export BotChat_HitTalking
+proc BotChat_HitTalking 68 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $469
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $469
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $472
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $472
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $474
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $474
+ADDRLP4 0
+CNSTI4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+INDIRP4
+CNSTI4 764
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $477
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $477
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $479
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $479
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $483
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $481
+LABELV $483
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 31
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 52
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $484
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $484
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $486
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $486
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+ADDRLP4 40
+INDIRF4
+MULF4
+LEF4 $491
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $491
+LABELV $488
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $493
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $493
+CNSTI4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+INDIRP4
+CNSTI4 764
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $497
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $468
+endproc BotChat_HitTalking 68 20
+export BotChat_HitNoDeath
+proc BotChat_HitNoDeath 216 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+INDIRP4
+CNSTI4 764
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $500
+CNSTI4 0
+RETI4
+ADDRGP4 $498
+JUMPV
+LABELV $500
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $502
+CNSTI4 0
+RETI4
+ADDRGP4 $498
+JUMPV
+LABELV $502
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $506
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $504
+LABELV $506
+CNSTI4 0
+RETI4
+ADDRGP4 $498
+JUMPV
+LABELV $504
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $507
+CNSTI4 0
+RETI4
+ADDRGP4 $498
+JUMPV
+LABELV $507
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $510
+CNSTI4 0
+RETI4
+ADDRGP4 $498
+JUMPV
+LABELV $510
+ADDRLP4 188
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 1
+GTI4 $512
+CNSTI4 0
+RETI4
+ADDRGP4 $498
+JUMPV
+LABELV $512
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 192
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $514
+CNSTI4 0
+RETI4
+ADDRGP4 $498
+JUMPV
+LABELV $514
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $516
+CNSTI4 0
+RETI4
+ADDRGP4 $498
+JUMPV
+LABELV $516
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $518
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+ADDRLP4 180
+INDIRF4
+MULF4
+LEF4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $498
+JUMPV
+LABELV $521
+LABELV $518
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+NEI4 $523
+CNSTI4 0
+RETI4
+ADDRGP4 $498
+JUMPV
+LABELV $523
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $525
+CNSTI4 0
+RETI4
+ADDRGP4 $498
+JUMPV
+LABELV $525
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+ADDRLP4 208
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $527
+CNSTI4 0
+RETI4
+ADDRGP4 $498
+JUMPV
+LABELV $527
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 212
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $498
+endproc BotChat_HitNoDeath 216 20
+export BotChat_HitNoKill
+proc BotChat_HitNoKill 208 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $532
+CNSTI4 0
+RETI4
+ADDRGP4 $531
+JUMPV
+LABELV $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $535
+CNSTI4 0
+RETI4
+ADDRGP4 $531
+JUMPV
+LABELV $535
+ADDRLP4 180
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+GTI4 $537
+CNSTI4 0
+RETI4
+ADDRGP4 $531
+JUMPV
+LABELV $537
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 184
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $539
+CNSTI4 0
+RETI4
+ADDRGP4 $531
+JUMPV
+LABELV $539
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $541
+CNSTI4 0
+RETI4
+ADDRGP4 $531
+JUMPV
+LABELV $541
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $543
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+LEF4 $546
+CNSTI4 0
+RETI4
+ADDRGP4 $531
+JUMPV
+LABELV $546
+LABELV $543
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $548
+CNSTI4 0
+RETI4
+ADDRGP4 $531
+JUMPV
+LABELV $548
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $550
+CNSTI4 0
+RETI4
+ADDRGP4 $531
+JUMPV
+LABELV $550
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRLP4 200
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $552
+CNSTI4 0
+RETI4
+ADDRGP4 $531
+JUMPV
+LABELV $552
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $531
+endproc BotChat_HitNoKill 208 20
+export BotChat_Random
+proc BotChat_Random 96 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $557
+CNSTI4 0
+RETI4
+ADDRGP4 $556
+JUMPV
+LABELV $557
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $560
+CNSTI4 0
+RETI4
+ADDRGP4 $556
+JUMPV
+LABELV $560
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $562
+CNSTI4 0
+RETI4
+ADDRGP4 $556
+JUMPV
+LABELV $562
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $564
+CNSTI4 0
+RETI4
+ADDRGP4 $556
+JUMPV
+LABELV $564
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+EQI4 $569
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+EQI4 $569
+ADDRLP4 40
+INDIRI4
+CNSTI4 5
+NEI4 $566
+LABELV $569
+CNSTI4 0
+RETI4
+ADDRGP4 $556
+JUMPV
+LABELV $566
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 34
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 44
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+ADDRFP4 0
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+MULF4
+LEF4 $570
+CNSTI4 0
+RETI4
+ADDRGP4 $556
+JUMPV
+LABELV $570
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $572
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $575
+CNSTI4 0
+RETI4
+ADDRGP4 $556
+JUMPV
+LABELV $575
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1048576000
+LEF4 $577
+CNSTI4 0
+RETI4
+ADDRGP4 $556
+JUMPV
+LABELV $577
+LABELV $572
+ADDRLP4 52
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+GTI4 $579
+CNSTI4 0
+RETI4
+ADDRGP4 $556
+JUMPV
+LABELV $579
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $581
+CNSTI4 0
+RETI4
+ADDRGP4 $556
+JUMPV
+LABELV $581
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $583
+CNSTI4 0
+RETI4
+ADDRGP4 $556
+JUMPV
+LABELV $583
+ADDRFP4 0
+INDIRP4
+CNSTI4 5888
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $585
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $586
+JUMPV
+LABELV $585
+ADDRFP4 0
+INDIRP4
+CNSTI4 5888
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+LABELV $586
+ADDRLP4 68
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $587
+CNSTI4 0
+RETI4
+ADDRGP4 $556
+JUMPV
+LABELV $587
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 25
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 76
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 76
+INDIRF4
+GEF4 $589
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $591
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $592
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $590
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $556
+endproc BotChat_Random 96 36
+export BotChatTime
+proc BotChatTime 0 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 23
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 4000
+ARGI4
+ADDRGP4 trap_Characteristic_BInteger
+CALLI4
+pop
+CNSTF4 1073741824
+RETF4
+LABELV $593
+endproc BotChatTime 0 16
+export BotChatTest
+proc BotChatTest 184 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $598
+JUMPV
+LABELV $595
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 48
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $596
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $598
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $595
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $602
+JUMPV
+LABELV $599
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 52
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $600
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $602
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $599
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $606
+JUMPV
+LABELV $603
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 56
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $604
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $606
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $603
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $607
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 60
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $608
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $610
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $607
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $332
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $614
+JUMPV
+LABELV $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 64
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $332
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $612
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $614
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $333
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $618
+JUMPV
+LABELV $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 68
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $333
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $616
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $618
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 5892
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $361
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $622
+JUMPV
+LABELV $619
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $361
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $620
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $622
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $619
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $626
+JUMPV
+LABELV $623
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $624
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $626
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $367
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $630
+JUMPV
+LABELV $627
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $367
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $628
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $630
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $627
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $370
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $634
+JUMPV
+LABELV $631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $370
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $632
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $634
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $631
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $638
+JUMPV
+LABELV $635
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $636
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $638
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $635
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $642
+JUMPV
+LABELV $639
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $640
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $642
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $639
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $392
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $646
+JUMPV
+LABELV $643
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $644
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $646
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $643
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 96
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $650
+JUMPV
+LABELV $647
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $648
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $650
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $647
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 100
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $654
+JUMPV
+LABELV $651
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $652
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $654
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $651
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $658
+JUMPV
+LABELV $655
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $656
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $658
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $655
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $400
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $662
+JUMPV
+LABELV $659
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $400
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $660
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $662
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $659
+ADDRFP4 0
+INDIRP4
+CNSTI4 5888
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $429
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $666
+JUMPV
+LABELV $663
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $429
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $664
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $666
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $663
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $432
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $670
+JUMPV
+LABELV $667
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $432
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $668
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $670
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $667
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $435
+ARGP4
+ADDRLP4 120
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $674
+JUMPV
+LABELV $671
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $435
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $672
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $674
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $671
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $441
+ARGP4
+ADDRLP4 124
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $678
+JUMPV
+LABELV $675
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $441
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $676
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $678
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $675
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $442
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $682
+JUMPV
+LABELV $679
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $442
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $680
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $682
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $679
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $686
+JUMPV
+LABELV $683
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $684
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $686
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $683
+CNSTI4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+INDIRP4
+CNSTI4 764
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+INDIRP4
+CNSTI4 764
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $497
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $692
+JUMPV
+LABELV $689
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $497
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $690
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $692
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $689
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $696
+JUMPV
+LABELV $693
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $694
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $696
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $693
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $700
+JUMPV
+LABELV $697
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $698
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $700
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $697
+ADDRFP4 0
+INDIRP4
+CNSTI4 5888
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $701
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $702
+JUMPV
+LABELV $701
+ADDRFP4 0
+INDIRP4
+CNSTI4 5888
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+LABELV $702
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $591
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $706
+JUMPV
+LABELV $703
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 164
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 168
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $591
+ARGP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 172
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $704
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $706
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $703
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $592
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $710
+JUMPV
+LABELV $707
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 168
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 172
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $592
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 176
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $708
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $710
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $707
+LABELV $594
+endproc BotChatTest 184 36
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $592
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $591
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $555
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $530
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $497
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $467
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $466
+byte 1 0
+align 1
+LABELV $442
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $441
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $438
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $435
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $432
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $429
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $424
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $400
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $399
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $396
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $395
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $392
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $384
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $381
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $378
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $370
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $367
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 0
+align 1
+LABELV $364
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $361
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $356
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $351
+byte 1 91
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $333
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $332
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $329
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 0
+align 1
+LABELV $307
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $287
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $269
+byte 1 91
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 93
+byte 1 0
+align 1
+LABELV $268
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $191
+byte 1 91
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $190
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $188
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $186
+byte 1 75
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $184
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $182
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $180
+byte 1 78
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $178
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 49
+byte 1 48
+byte 1 75
+byte 1 0
+align 1
+LABELV $176
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $174
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $172
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $170
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $168
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $166
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 121
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $164
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $162
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $160
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $154
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $69
+byte 1 116
+byte 1 0
+align 1
+LABELV $65
+byte 1 110
+byte 1 0
@@ -0,0 +1,9034 @@
+export BotGetItemTeamGoal
+code
+proc BotGetItemTeamGoal 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRU4
+CNSTU4 0
+NEU4 $58
+CNSTI4 0
+RETI4
+ADDRGP4 $57
+JUMPV
+LABELV $58
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $60
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $63
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $65
+ADDRGP4 $61
+JUMPV
+LABELV $65
+CNSTI4 1
+RETI4
+ADDRGP4 $57
+JUMPV
+LABELV $63
+LABELV $61
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $60
+CNSTI4 0
+RETI4
+LABELV $57
+endproc BotGetItemTeamGoal 12 12
+export BotGetMessageTeamGoal
+proc BotGetMessageTeamGoal 12 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotGetItemTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $68
+CNSTI4 1
+RETI4
+ADDRGP4 $67
+JUMPV
+LABELV $68
+ADDRFP4 0
+INDIRP4
+CNSTI4 8868
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotFindWayPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $70
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $67
+JUMPV
+LABELV $70
+CNSTI4 0
+RETI4
+LABELV $67
+endproc BotGetMessageTeamGoal 12 12
+export BotGetTime
+proc BotGetTime 600 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $73
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 256
+ARGP4
+CNSTU4 8
+ARGU4
+ADDRLP4 588
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 588
+INDIRI4
+CNSTI4 0
+EQI4 $75
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 107
+NEI4 $77
+ADDRLP4 584
+CNSTF4 1287568416
+ASGNF4
+ADDRGP4 $78
+JUMPV
+LABELV $77
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 109
+NEI4 $80
+ADDRLP4 584
+CNSTF4 1142292480
+ASGNF4
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 108
+NEI4 $83
+ADDRLP4 584
+CNSTF4 1155596288
+ASGNF4
+ADDRGP4 $84
+JUMPV
+LABELV $83
+ADDRLP4 256
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 105
+NEI4 $86
+ADDRLP4 0
+ARGP4
+ADDRLP4 592
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 584
+CNSTF4 1114636288
+ADDRLP4 592
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 106
+NEI4 $89
+ADDRLP4 0
+ARGP4
+ADDRLP4 596
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 584
+ADDRLP4 596
+INDIRF4
+ASGNF4
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRLP4 584
+CNSTF4 0
+ASGNF4
+LABELV $90
+LABELV $87
+LABELV $84
+LABELV $81
+LABELV $78
+ADDRLP4 584
+INDIRF4
+CNSTF4 0
+LEF4 $92
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 584
+INDIRF4
+ADDF4
+RETF4
+ADDRGP4 $72
+JUMPV
+LABELV $92
+LABELV $75
+LABELV $73
+CNSTF4 0
+RETF4
+LABELV $72
+endproc BotGetTime 600 16
+export FindClientByName
+proc FindClientByName 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $98
+JUMPV
+LABELV $95
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $100
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $100
+LABELV $96
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $98
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $95
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $102
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $107
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $107
+LABELV $103
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $105
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $102
+CNSTI4 -1
+RETI4
+LABELV $94
+endproc FindClientByName 1032 12
+export FindEnemyByName
+proc FindEnemyByName 1036 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $110
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+EQI4 $115
+ADDRGP4 $111
+JUMPV
+LABELV $115
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $117
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $109
+JUMPV
+LABELV $117
+LABELV $111
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $113
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $110
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $122
+JUMPV
+LABELV $119
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+EQI4 $124
+ADDRGP4 $120
+JUMPV
+LABELV $124
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $126
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $109
+JUMPV
+LABELV $126
+LABELV $120
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $122
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $119
+CNSTI4 -1
+RETI4
+LABELV $109
+endproc FindEnemyByName 1036 12
+export NumPlayersOnSameTeam
+proc NumPlayersOnSameTeam 1044 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 $132
+JUMPV
+LABELV $129
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRU4
+CNSTU4 0
+EQU4 $134
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1040
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $136
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $136
+LABELV $134
+LABELV $130
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $132
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $129
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $128
+endproc NumPlayersOnSameTeam 1044 12
+export BotGetPatrolWaypoints
+proc BotGetPatrolWaypoints 680 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 592
+CNSTP4 0
+ASGNP4
+ADDRLP4 652
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRGP4 $140
+JUMPV
+LABELV $139
+ADDRLP4 8
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTU4 64
+ARGU4
+ADDRLP4 656
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+NEI4 $142
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $144
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+ADDRLP4 592
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8872
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $138
+JUMPV
+LABELV $142
+ADDRLP4 264
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 596
+ARGP4
+ADDRLP4 660
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+NEI4 $145
+ADDRLP4 592
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8872
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $138
+JUMPV
+LABELV $145
+ADDRLP4 8
+ARGP4
+ADDRLP4 596
+ARGP4
+ADDRLP4 596+12
+INDIRI4
+ARGI4
+ADDRLP4 664
+ADDRGP4 BotCreateWayPoint
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 664
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $148
+ADDRGP4 $141
+JUMPV
+LABELV $148
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRLP4 592
+INDIRP4
+ASGNP4
+ADDRGP4 $153
+JUMPV
+LABELV $150
+LABELV $151
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $153
+ADDRLP4 672
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 672
+INDIRU4
+EQU4 $154
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 672
+INDIRU4
+NEU4 $150
+LABELV $154
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $155
+ADDRLP4 592
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $156
+JUMPV
+LABELV $155
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $156
+ADDRLP4 264+260
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $157
+ADDRLP4 652
+CNSTI4 1
+ASGNI4
+ADDRGP4 $141
+JUMPV
+LABELV $157
+ADDRLP4 264+260
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $160
+ADDRLP4 652
+CNSTI4 2
+ASGNI4
+ADDRGP4 $141
+JUMPV
+LABELV $160
+ADDRLP4 264+260
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $141
+ADDRLP4 264
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+LABELV $164
+LABELV $140
+ADDRGP4 $139
+JUMPV
+LABELV $141
+ADDRLP4 660
+CNSTU4 0
+ASGNU4
+ADDRLP4 592
+INDIRP4
+CVPU4 4
+ADDRLP4 660
+INDIRU4
+EQU4 $168
+ADDRLP4 592
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 660
+INDIRU4
+NEU4 $166
+LABELV $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $169
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+ADDRLP4 592
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRLP4 592
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $138
+JUMPV
+LABELV $166
+ADDRFP4 0
+INDIRP4
+CNSTI4 8872
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8872
+ADDP4
+ADDRLP4 592
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8876
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8872
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8880
+ADDP4
+ADDRLP4 652
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $138
+endproc BotGetPatrolWaypoints 680 16
+export BotAddressedToBot
+proc BotAddressedToBot 1572 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 840
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 840
+ARGP4
+ADDRLP4 1228
+ADDRGP4 ClientOnSameTeamFromName
+CALLI4
+ASGNI4
+ADDRLP4 1096
+ADDRLP4 1228
+INDIRI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+GEI4 $171
+CNSTI4 0
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $171
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $173
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 584
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1100
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRLP4 0+256
+INDIRI4
+CNSTI4 101
+NEI4 $178
+CNSTI4 1
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $178
+ADDRLP4 0+256
+INDIRI4
+CNSTI4 102
+NEI4 $181
+ADDRLP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 328
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 328
+ARGP4
+ADDRLP4 1232
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1232
+INDIRU4
+CNSTU4 0
+EQU4 $184
+ADDRLP4 1100
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 1236
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1236
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $186
+CNSTI4 1
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $186
+ADDRFP4 0
+INDIRP4
+CNSTI4 6876
+ADDP4
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 1240
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1240
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $188
+CNSTI4 1
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $188
+LABELV $184
+ADDRLP4 0
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 584
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 328
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 328
+ARGP4
+ADDRLP4 1232
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1232
+INDIRU4
+CNSTU4 0
+EQU4 $177
+ADDRLP4 1100
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 1236
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1236
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $192
+CNSTI4 1
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $192
+ADDRFP4 0
+INDIRP4
+CNSTI4 6876
+ADDP4
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 1240
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1240
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $177
+CNSTI4 1
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $182
+LABELV $176
+ADDRLP4 584
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 32
+ARGU4
+ADDRLP4 1232
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+NEI4 $175
+LABELV $177
+CNSTI4 0
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $173
+ADDRLP4 1232+256
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1232
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 1560
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 1560
+INDIRI4
+CNSTI4 0
+EQI4 $200
+ADDRLP4 1232+256
+INDIRI4
+CNSTI4 202
+EQI4 $197
+LABELV $200
+ADDRLP4 1564
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1568
+ADDRGP4 NumPlayersOnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1564
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDRLP4 1568
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIF4 4
+DIVF4
+LEF4 $201
+CNSTI4 0
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $201
+LABELV $197
+CNSTI4 1
+RETI4
+LABELV $170
+endproc BotAddressedToBot 1572 16
+export BotGPSToPosition
+proc BotGPSToPosition 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $204
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $209
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $208
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $211
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $211
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+LTI4 $216
+ADDRLP4 16
+INDIRI4
+CNSTI4 57
+GTI4 $216
+ADDRLP4 4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $217
+LABELV $214
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $213
+LABELV $215
+CNSTI4 1
+ARGI4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+LABELV $205
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LTI4 $204
+CNSTI4 1
+RETI4
+LABELV $203
+endproc BotGPSToPosition 24 12
+export BotMatch_HelpAccompany
+proc BotMatch_HelpAccompany 1272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1248
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 1248
+INDIRI4
+CNSTI4 0
+NEI4 $220
+ADDRGP4 $219
+JUMPV
+LABELV $220
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1252
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+CNSTI4 0
+NEI4 $222
+ADDRGP4 $219
+JUMPV
+LABELV $222
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRLP4 656
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRLP4 1256
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+EQI4 $224
+ADDRLP4 656+256
+INDIRI4
+CNSTI4 100
+NEI4 $224
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRLP4 984
+CNSTI4 0
+ASGNI4
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRLP4 260
+ARGP4
+ADDRLP4 1260
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $227
+ADDRLP4 984
+CNSTI4 0
+ASGNI4
+ADDRGP4 $228
+JUMPV
+LABELV $227
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1264
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 0
+NEI4 $229
+ADDRGP4 $219
+JUMPV
+LABELV $229
+ADDRLP4 984
+CNSTI4 1
+ASGNI4
+LABELV $228
+LABELV $225
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $231
+ADDRLP4 984
+INDIRI4
+CNSTI4 0
+EQI4 $233
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $235
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $234
+JUMPV
+LABELV $233
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $235
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $234
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $219
+JUMPV
+LABELV $231
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $236
+ADDRGP4 $219
+JUMPV
+LABELV $236
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 516
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+EQI4 $238
+ADDRLP4 516+24
+ARGP4
+ADDRLP4 1260
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRLP4 988
+INDIRI4
+CNSTI4 0
+EQI4 $241
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+ADDRLP4 988
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ADDRLP4 516+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6552
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $241
+LABELV $238
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $244
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $246
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 992
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 992
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRLP4 1264
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 0
+NEI4 $248
+ADDRGP4 $219
+JUMPV
+LABELV $248
+LABELV $246
+LABELV $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $250
+ADDRLP4 984
+INDIRI4
+CNSTI4 0
+EQI4 $252
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $255
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $253
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $219
+JUMPV
+LABELV $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 1264
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 1264
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1268
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRLP4 1268
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $256
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 6908
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $257
+LABELV $219
+endproc BotMatch_HelpAccompany 1272 16
+export BotMatch_DefendKeyArea
+proc BotMatch_DefendKeyArea 544 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $263
+ADDRGP4 $262
+JUMPV
+LABELV $263
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $265
+ADDRGP4 $262
+JUMPV
+LABELV $265
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRLP4 528
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $267
+ADDRGP4 $262
+JUMPV
+LABELV $267
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 256
+ARGP4
+ADDRLP4 532
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 536
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 536
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 540
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRLP4 540
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $269
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $269
+ADDRFP4 0
+INDIRP4
+CNSTI4 6040
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $262
+endproc BotMatch_DefendKeyArea 544 16
+export BotMatch_GetItem
+proc BotMatch_GetItem 540 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $272
+ADDRGP4 $271
+JUMPV
+LABELV $272
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $274
+ADDRGP4 $271
+JUMPV
+LABELV $274
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRLP4 528
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $276
+ADDRGP4 $271
+JUMPV
+LABELV $276
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 532
+ADDRGP4 ClientOnSameTeamFromName
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 536
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 536
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $271
+endproc BotMatch_GetItem 540 16
+export BotMatch_Camp
+proc BotMatch_Camp 688 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 660
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRGP4 $278
+JUMPV
+LABELV $279
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 664
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 664
+INDIRI4
+CNSTI4 0
+NEI4 $281
+ADDRGP4 $278
+JUMPV
+LABELV $281
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 668
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 668
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $283
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $235
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $278
+JUMPV
+LABELV $283
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6552
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 $286
+JUMPV
+LABELV $285
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $287
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $289
+ADDRGP4 $278
+JUMPV
+LABELV $289
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 516
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+EQI4 $291
+ADDRLP4 516+24
+ARGP4
+ADDRLP4 672
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 656
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $294
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+ADDRLP4 656
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ADDRLP4 516+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6552
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $294
+LABELV $291
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $288
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $255
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 672
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $278
+JUMPV
+LABELV $287
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRLP4 676
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 676
+INDIRI4
+CNSTI4 0
+NEI4 $299
+ADDRGP4 $278
+JUMPV
+LABELV $299
+LABELV $288
+LABELV $286
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 680
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 680
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 684
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRLP4 684
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $301
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $301
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $278
+endproc BotMatch_Camp 688 16
+export BotMatch_Patrol
+proc BotMatch_Patrol 284 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $304
+ADDRGP4 $303
+JUMPV
+LABELV $304
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $306
+ADDRGP4 $303
+JUMPV
+LABELV $306
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotGetPatrolWaypoints
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $308
+ADDRGP4 $303
+JUMPV
+LABELV $308
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 276
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $310
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $303
+endproc BotMatch_Patrol 284 16
+export BotMatch_GetFlag
+proc BotMatch_GetFlag 276 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $312
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 260
+INDIRI4
+EQI4 $319
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 260
+INDIRI4
+NEI4 $314
+LABELV $319
+ADDRGP4 $312
+JUMPV
+LABELV $314
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $320
+ADDRGP4 $312
+JUMPV
+LABELV $320
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 268
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $322
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+LABELV $322
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $312
+endproc BotMatch_GetFlag 276 16
+export BotMatch_AttackEnemyBase
+proc BotMatch_AttackEnemyBase 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $324
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotMatch_GetFlag
+CALLV
+pop
+LABELV $326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $327
+ADDRGP4 $324
+JUMPV
+LABELV $327
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 268
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $324
+endproc BotMatch_AttackEnemyBase 272 16
+export BotMatch_RushBase
+proc BotMatch_RushBase 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $329
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 260
+INDIRI4
+EQI4 $336
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 260
+INDIRI4
+NEI4 $331
+LABELV $336
+ADDRGP4 $329
+JUMPV
+LABELV $331
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $337
+ADDRGP4 $329
+JUMPV
+LABELV $337
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 268
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $329
+endproc BotMatch_RushBase 272 16
+export BotMatch_TaskPreference
+proc BotMatch_TaskPreference 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $340
+ADDRGP4 $339
+JUMPV
+LABELV $340
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 304
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $342
+ADDRGP4 $339
+JUMPV
+LABELV $342
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotGetTeamMateTaskPreference
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 312
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $347
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $348
+ADDRLP4 312
+INDIRI4
+CNSTI4 4
+EQI4 $349
+ADDRGP4 $344
+JUMPV
+LABELV $347
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $345
+JUMPV
+LABELV $348
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $345
+JUMPV
+LABELV $349
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 -4
+BANDI4
+ASGNI4
+LABELV $344
+LABELV $345
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSetTeamMateTaskPreference
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $350
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $351
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+LABELV $339
+endproc BotMatch_TaskPreference 320 16
+export BotMatch_ReturnFlag
+proc BotMatch_ReturnFlag 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+EQI4 $353
+ADDRGP4 $352
+JUMPV
+LABELV $353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $355
+ADDRGP4 $352
+JUMPV
+LABELV $355
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 268
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $352
+endproc BotMatch_ReturnFlag 272 16
+export BotMatch_JoinSubteam
+proc BotMatch_JoinSubteam 528 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $358
+ADDRGP4 $357
+JUMPV
+LABELV $358
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $360
+ADDRGP4 $357
+JUMPV
+LABELV $360
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6876
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 32
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6907
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRLP4 256
+ARGP4
+ADDRLP4 524
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 512
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $357
+endproc BotMatch_JoinSubteam 528 16
+export BotMatch_LeaveSubteam
+proc BotMatch_LeaveSubteam 280 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $364
+ADDRGP4 $363
+JUMPV
+LABELV $364
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $366
+ADDRGP4 $363
+JUMPV
+LABELV $366
+ADDRFP4 0
+INDIRP4
+CNSTI4 6876
+ADDP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 268
+INDIRU4
+CNSTU4 0
+EQU4 $368
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $370
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6876
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $368
+ADDRFP4 0
+INDIRP4
+CNSTI4 6876
+ADDP4
+ARGP4
+ADDRGP4 $371
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $363
+endproc BotMatch_LeaveSubteam 280 16
+export BotMatch_WhichTeam
+proc BotMatch_WhichTeam 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $373
+ADDRGP4 $372
+JUMPV
+LABELV $373
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $375
+ADDRGP4 $372
+JUMPV
+LABELV $375
+ADDRFP4 0
+INDIRP4
+CNSTI4 6876
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $377
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6876
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $380
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $372
+endproc BotMatch_WhichTeam 16 16
+export BotMatch_CheckPoint
+proc BotMatch_CheckPoint 572 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 536
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 536
+INDIRI4
+CNSTI4 0
+NEI4 $382
+ADDRGP4 $381
+JUMPV
+LABELV $382
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 540
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 540
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 540
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 540
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 276
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 276
+ARGP4
+ADDRLP4 544
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 532
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4+4
+ARGP4
+ADDRLP4 4+8
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 548
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $390
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $394
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 532
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $390
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8868
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotFindWayPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 552
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $395
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $397
+ADDRLP4 560
+CNSTI4 96
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ADDRLP4 560
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 560
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $397
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $399
+ADDRLP4 568
+CNSTI4 92
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ADDRLP4 568
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 568
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRFP4 0
+INDIRP4
+CNSTI4 8868
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $400
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $395
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 556
+ADDRGP4 BotCreateWayPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 556
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8868
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8868
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 8868
+ADDP4
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 8868
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 560
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 0
+EQI4 $403
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $405
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $406
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 532
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $403
+LABELV $381
+endproc BotMatch_CheckPoint 572 24
+export BotMatch_FormationSpace
+proc BotMatch_FormationSpace 280 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $408
+ADDRGP4 $407
+JUMPV
+LABELV $408
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $410
+ADDRGP4 $407
+JUMPV
+LABELV $410
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $412
+ADDRLP4 4
+ARGP4
+ADDRLP4 268
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1092357823
+ADDRLP4 268
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 4
+ARGP4
+ADDRLP4 272
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1107296256
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+LABELV $413
+ADDRLP4 0
+INDIRF4
+CNSTF4 1111490560
+LTF4 $416
+ADDRLP4 0
+INDIRF4
+CNSTF4 1140457472
+LEF4 $414
+LABELV $416
+ADDRLP4 0
+CNSTF4 1120403456
+ASGNF4
+LABELV $414
+ADDRFP4 0
+INDIRP4
+CNSTI4 6908
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+LABELV $407
+endproc BotMatch_FormationSpace 280 16
+export BotMatch_Dismiss
+proc BotMatch_Dismiss 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $418
+ADDRGP4 $417
+JUMPV
+LABELV $418
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $420
+ADDRGP4 $417
+JUMPV
+LABELV $420
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6776
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $422
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $417
+endproc BotMatch_Dismiss 272 16
+export BotMatch_Suicide
+proc BotMatch_Suicide 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $424
+ADDRGP4 $423
+JUMPV
+LABELV $424
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $426
+ADDRGP4 $423
+JUMPV
+LABELV $426
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $428
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRGP4 $429
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+LABELV $423
+endproc BotMatch_Suicide 272 16
+export BotMatch_StartTeamLeaderShip
+proc BotMatch_StartTeamLeaderShip 268 16
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $431
+ADDRGP4 $430
+JUMPV
+LABELV $431
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $433
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+CNSTU4 35
+ADDI4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+LTI4 $435
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+LABELV $435
+LABELV $434
+LABELV $430
+endproc BotMatch_StartTeamLeaderShip 268 16
+export BotMatch_StopTeamLeaderShip
+proc BotMatch_StopTeamLeaderShip 528 16
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $438
+ADDRGP4 $437
+JUMPV
+LABELV $438
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $440
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRLP4 520
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRLP4 4
+ARGP4
+ADDRLP4 520
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 520
+INDIRI4
+ASGNI4
+LABELV $441
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $442
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 520
+ADDRGP4 ClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 520
+INDIRP4
+ARGP4
+ADDRLP4 524
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 notleader
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $444
+LABELV $442
+LABELV $437
+endproc BotMatch_StopTeamLeaderShip 528 16
+export BotMatch_WhoIsTeamLeader
+proc BotMatch_WhoIsTeamLeader 264 12
+ADDRLP4 256
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $447
+ADDRGP4 $446
+JUMPV
+LABELV $447
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $449
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $451
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+LABELV $449
+LABELV $446
+endproc BotMatch_WhoIsTeamLeader 264 12
+export BotMatch_WhatAreYouDoing
+proc BotMatch_WhatAreYouDoing 532 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 516
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $453
+ADDRGP4 $452
+JUMPV
+LABELV $453
+ADDRLP4 520
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 1
+LTI4 $455
+ADDRLP4 520
+INDIRI4
+CNSTI4 11
+GTI4 $455
+ADDRLP4 520
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $479-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $479
+address $458
+address $460
+address $462
+address $472
+address $474
+address $476
+address $468
+address $468
+address $470
+address $464
+address $466
+code
+LABELV $458
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $459
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $460
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $461
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $463
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $464
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $465
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $466
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $468
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $469
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $470
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $471
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $472
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $473
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $474
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $475
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $476
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $477
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $455
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $478
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $456
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 528
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $452
+endproc BotMatch_WhatAreYouDoing 532 16
+export BotMatch_WhatIsMyCommand
+proc BotMatch_WhatIsMyCommand 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $482
+ADDRGP4 $481
+JUMPV
+LABELV $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $481
+endproc BotMatch_WhatIsMyCommand 40 12
+export BotNearestVisibleItem
+proc BotNearestVisibleItem 252 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 140
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 68
+CNSTI4 -1
+ASGNI4
+LABELV $485
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 228
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRGP4 $486
+JUMPV
+LABELV $489
+ADDRLP4 56
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 240
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+GEF4 $495
+ADDRLP4 144
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 248
+CNSTP4 0
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 144+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $497
+ADDRLP4 140
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $497
+LABELV $495
+LABELV $486
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+GTI4 $485
+ADDRLP4 140
+INDIRF4
+RETF4
+LABELV $484
+endproc BotNearestVisibleItem 252 28
+lit
+align 4
+LABELV $501
+address $502
+address $503
+address $504
+address $505
+address $506
+address $507
+address $508
+address $509
+address $510
+address $511
+address $512
+address $513
+address $514
+address $515
+address $516
+address $517
+address $518
+address $519
+address $520
+address $521
+address $522
+address $523
+address $524
+address $525
+address $526
+address $527
+address $528
+address $529
+byte 4 0
+export BotMatch_WhereAreYou
+code
+proc BotMatch_WhereAreYou 488 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 $501
+INDIRB
+ASGNB 116
+ADDRLP4 456
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+NEI4 $530
+ADDRGP4 $500
+JUMPV
+LABELV $530
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 460
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 0
+NEI4 $532
+ADDRGP4 $500
+JUMPV
+LABELV $532
+ADDRLP4 184
+CNSTI4 -1
+ASGNI4
+ADDRLP4 124
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $537
+JUMPV
+LABELV $534
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 464
+ADDRGP4 BotNearestVisibleItem
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 464
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+GEF4 $538
+ADDRLP4 124
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $538
+LABELV $535
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $537
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $534
+ADDRLP4 184
+INDIRI4
+CNSTI4 -1
+EQI4 $540
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $542
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 448
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 452
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 480
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CVIF4 4
+CNSTF4 1053609165
+ADDRLP4 480
+INDIRI4
+ADDRLP4 452
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+GEF4 $546
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $548
+ARGP4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $549
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $543
+JUMPV
+LABELV $546
+ADDRLP4 484
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CVIF4 4
+CNSTF4 1053609165
+ADDRLP4 448
+INDIRI4
+ADDRLP4 484
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+GEF4 $550
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $548
+ARGP4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $552
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $543
+JUMPV
+LABELV $550
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $543
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 188
+ARGP4
+ADDRLP4 464
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 444
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 444
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $540
+LABELV $500
+endproc BotMatch_WhereAreYou 488 20
+export BotMatch_LeadTheWay
+proc BotMatch_LeadTheWay 680 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 664
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 664
+INDIRI4
+CNSTI4 0
+NEI4 $555
+ADDRGP4 $554
+JUMPV
+LABELV $555
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 668
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 668
+INDIRI4
+CNSTI4 0
+NEI4 $557
+ADDRGP4 $554
+JUMPV
+LABELV $557
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $559
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 400
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 400
+ARGP4
+ADDRLP4 672
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $561
+ADDRLP4 656
+CNSTI4 0
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $561
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 676
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 676
+INDIRI4
+CNSTI4 0
+NEI4 $563
+ADDRGP4 $554
+JUMPV
+LABELV $563
+ADDRLP4 656
+CNSTI4 1
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 144
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 144
+ARGP4
+ADDRLP4 672
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 656
+CNSTI4 0
+ASGNI4
+LABELV $560
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $565
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $235
+ARGP4
+ADDRLP4 144
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $554
+JUMPV
+LABELV $565
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $567
+ADDRLP4 4+24
+ARGP4
+ADDRLP4 672
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 660
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+EQI4 $570
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6720
+ADDP4
+ADDRLP4 4+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $570
+LABELV $567
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $573
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 400
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $576
+JUMPV
+LABELV $575
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $255
+ARGP4
+ADDRLP4 144
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $576
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $554
+JUMPV
+LABELV $573
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6776
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6780
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 672
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6784
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 672
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+NEGF4
+ASGNF4
+LABELV $554
+endproc BotMatch_LeadTheWay 680 16
+export BotMatch_Kill
+proc BotMatch_Kill 532 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $578
+ADDRGP4 $577
+JUMPV
+LABELV $578
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $580
+ADDRGP4 $577
+JUMPV
+LABELV $580
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 524
+ADDRGP4 FindEnemyByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $582
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $235
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRLP4 528
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $577
+JUMPV
+LABELV $582
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 528
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 528
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $577
+endproc BotMatch_Kill 532 16
+export BotMatch_CTF
+proc BotMatch_CTF 176 16
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $585
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $587
+ADDRLP4 0
+ARGP4
+ADDRGP4 $549
+ARGP4
+ADDRLP4 164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $589
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+NEI4 $590
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+ADDRLP4 172
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+NEI4 $593
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+ADDRLP4 172
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $593
+LABELV $590
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6840
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $588
+JUMPV
+LABELV $587
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $595
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $596
+JUMPV
+LABELV $595
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $597
+ADDRLP4 0
+ARGP4
+ADDRGP4 $549
+ARGP4
+ADDRLP4 164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $599
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $599
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $600
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $597
+LABELV $596
+LABELV $588
+LABELV $585
+LABELV $584
+endproc BotMatch_CTF 176 16
+export BotMatch_EnterGame
+proc BotMatch_EnterGame 44 16
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $602
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 notleader
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $602
+LABELV $601
+endproc BotMatch_EnterGame 44 16
+export BotMatch_NewLeader
+proc BotMatch_NewLeader 48 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $605
+ADDRGP4 $604
+JUMPV
+LABELV $605
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $604
+endproc BotMatch_NewLeader 48 16
+export BotMatchMessage
+proc BotMatchMessage 336 12
+ADDRLP4 0+256
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 262
+ARGU4
+ADDRLP4 328
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+NEI4 $609
+CNSTI4 0
+RETI4
+ADDRGP4 $607
+JUMPV
+LABELV $609
+ADDRLP4 332
+ADDRLP4 0+256
+INDIRI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 1
+LTI4 $611
+ADDRLP4 332
+INDIRI4
+CNSTI4 33
+GTI4 $647
+ADDRLP4 332
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $648-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $648
+address $643
+address $642
+address $614
+address $614
+address $615
+address $619
+address $618
+address $634
+address $635
+address $636
+address $612
+address $637
+address $624
+address $625
+address $628
+address $630
+address $631
+address $612
+address $633
+address $616
+address $627
+address $617
+address $640
+address $623
+address $641
+address $639
+address $620
+address $638
+address $626
+address $621
+address $611
+address $611
+address $645
+code
+LABELV $647
+ADDRLP4 0+256
+INDIRI4
+CNSTI4 300
+EQI4 $622
+ADDRGP4 $611
+JUMPV
+LABELV $614
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_HelpAccompany
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $615
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_DefendKeyArea
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $616
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Camp
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $617
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Patrol
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $618
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_GetFlag
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $619
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_RushBase
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $620
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_ReturnFlag
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $621
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_TaskPreference
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $622
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_CTF
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $623
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_GetItem
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $624
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_JoinSubteam
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $625
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_LeaveSubteam
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $626
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhichTeam
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $627
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_CheckPoint
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $628
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $629
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $630
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $629
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_FormationSpace
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $633
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Dismiss
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $634
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_StartTeamLeaderShip
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $635
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_StopTeamLeaderShip
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $636
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhoIsTeamLeader
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $637
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhatAreYouDoing
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $638
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhatIsMyCommand
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $639
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhereAreYou
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $640
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_LeadTheWay
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $641
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Kill
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $642
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_EnterGame
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $643
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_NewLeader
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $645
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Suicide
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $611
+CNSTI4 1
+ARGI4
+ADDRGP4 $646
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $612
+CNSTI4 1
+RETI4
+LABELV $607
+endproc BotMatchMessage 336 12
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+bss
+export notleader
+align 4
+LABELV notleader
+skip 256
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $646
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $629
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $553
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $552
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $549
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $548
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $529
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $528
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $527
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $526
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $525
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $524
+byte 1 68
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $523
+byte 1 71
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $522
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $521
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $520
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $519
+byte 1 78
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $518
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $517
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $516
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $515
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $514
+byte 1 70
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $513
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $512
+byte 1 72
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $511
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $510
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $509
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $508
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 49
+byte 1 48
+byte 1 75
+byte 1 0
+align 1
+LABELV $507
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $506
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $505
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $504
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $503
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $502
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $478
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $477
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $475
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $473
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $471
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $469
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $467
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $465
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $463
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $461
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $459
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $451
+byte 1 73
+byte 1 39
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $429
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $428
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $422
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $406
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 0
+align 1
+LABELV $405
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 0
+align 1
+LABELV $394
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $386
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $380
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $379
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $371
+byte 1 0
+align 1
+LABELV $370
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $362
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $351
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $350
+byte 1 107
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $255
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 0
+align 1
+LABELV $254
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $235
+byte 1 119
+byte 1 104
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $218
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $169
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $144
+byte 1 119
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 63
+byte 1 0
@@ -0,0 +1,17708 @@
+export BotResetNodeSwitches
+code
+proc BotResetNodeSwitches 0 0
+ADDRGP4 numnodeswitches
+CNSTI4 0
+ASGNI4
+LABELV $57
+endproc BotResetNodeSwitches 0 0
+export BotDumpNodeSwitches
+proc BotDumpNodeSwitches 40 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $59
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $63
+JUMPV
+LABELV $60
+CNSTI4 1
+ARGI4
+ADDRGP4 $64
+ARGP4
+CNSTI4 144
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $61
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $63
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+LTI4 $60
+CNSTI4 4
+ARGI4
+ADDRGP4 $65
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $58
+endproc BotDumpNodeSwitches 40 20
+export BotRecordNodeSwitch
+proc BotRecordNodeSwitch 44 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 36
+CNSTI4 144
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 $67
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 40
+ADDRGP4 numnodeswitches
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $66
+endproc BotRecordNodeSwitch 44 32
+lit
+align 4
+LABELV $69
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3221225472
+align 4
+LABELV $70
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+export BotGetAirGoal
+code
+proc BotGetAirGoal 140 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRGP4 $69
+INDIRB
+ASGNB 12
+ADDRLP4 108
+ADDRGP4 $70
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 0
+LEF4 $73
+ADDRLP4 12+12
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $77
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $77
+LABELV $73
+CNSTI4 0
+RETI4
+LABELV $68
+endproc BotGetAirGoal 140 28
+export BotGoForAir
+proc BotGoForAir 68 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+GEF4 $81
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotGetAirGoal
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $86
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotPushGoal
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $85
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $88
+CNSTI4 1
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $88
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+LABELV $86
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4848
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 trap_BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $85
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+LABELV $81
+CNSTI4 0
+RETI4
+LABELV $80
+endproc BotGoForAir 68 24
+export BotNearbyGoal
+proc BotNearbyGoal 28 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $91
+CNSTI4 1
+RETI4
+ADDRGP4 $90
+JUMPV
+LABELV $91
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $96
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $96
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $93
+LABELV $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 300
+GEI4 $97
+ADDRFP4 12
+CNSTF4 1112014848
+ASGNF4
+LABELV $97
+LABELV $93
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4848
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 trap_BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $90
+endproc BotNearbyGoal 28 24
+export BotReachedGoal
+proc BotReachedGoal 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $100
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $102
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $104
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 3212836864
+ARGF4
+ADDRGP4 trap_BotSetAvoidGoalTime
+CALLV
+pop
+LABELV $104
+CNSTI4 1
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $102
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $106
+CNSTI4 1
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $101
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $101
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $101
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $101
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $101
+CNSTI4 1
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $100
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $116
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $118
+CNSTI4 1
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $117
+CNSTI4 1
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $116
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $122
+CNSTI4 1
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $122
+LABELV $117
+LABELV $101
+CNSTI4 0
+RETI4
+LABELV $99
+endproc BotReachedGoal 40 16
+export BotGetItemLongTermGoal
+proc BotGetItemLongTermGoal 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $125
+ADDRFP4 0
+INDIRP4
+CNSTI4 5964
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $126
+JUMPV
+LABELV $125
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $127
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5964
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $127
+LABELV $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 5964
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $129
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4848
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_BotChooseLTGItem
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $131
+ADDRFP4 0
+INDIRP4
+CNSTI4 5964
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+LABELV $132
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $124
+JUMPV
+LABELV $129
+CNSTI4 1
+RETI4
+LABELV $124
+endproc BotGetItemLongTermGoal 20 16
+export BotGetLongTermGoal
+proc BotGetLongTermGoal 672 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $134
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $134
+ADDRLP4 620
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 620
+INDIRF4
+CNSTF4 0
+EQF4 $136
+ADDRLP4 620
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 624
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 624
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $139
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $142
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $142
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 272
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 628
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $144
+ADDRLP4 260
+ADDRLP4 272+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 636
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+CNSTF4 1176256512
+GEF4 $145
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $144
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $145
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $155
+ADDRLP4 272+24
+ARGP4
+ADDRLP4 632
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 448
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRLP4 636
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $158
+ADDRLP4 636
+INDIRI4
+ARGI4
+ADDRLP4 640
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+EQI4 $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ADDRLP4 272+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6552
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $158
+LABELV $155
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $134
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $161
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $161
+ADDRLP4 620
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 620
+INDIRF4
+CNSTF4 0
+EQF4 $163
+ADDRLP4 620
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $163
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 624
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 624
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $139
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $163
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $166
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 624
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $168
+ARGP4
+ADDRLP4 624
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $166
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 272
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 628
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $169
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 272+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 636
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 6908
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+ADDRLP4 640
+INDIRF4
+MULF4
+GEF4 $178
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 452
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 452+24+8
+INDIRF4
+ADDRLP4 452+84+8
+INDIRF4
+ADDF4
+ADDRLP4 272+24+8
+INDIRF4
+ADDRLP4 272+72+8
+INDIRF4
+ADDF4
+LEF4 $180
+ADDRLP4 644
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 452+24
+INDIRF4
+ADDRLP4 452+84
+INDIRF4
+ADDF4
+ADDRLP4 272+24
+INDIRF4
+ADDRLP4 272+72
+INDIRF4
+ADDF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+LEF4 $190
+ADDRLP4 452+24
+INDIRF4
+ADDRLP4 452+72
+INDIRF4
+ADDF4
+ADDRLP4 272+24
+INDIRF4
+ADDRLP4 272+84
+INDIRF4
+ADDF4
+ADDRLP4 644
+INDIRF4
+ADDF4
+GEF4 $190
+ADDRLP4 648
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 452+24+4
+INDIRF4
+ADDRLP4 452+84+4
+INDIRF4
+ADDF4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRLP4 272+72+4
+INDIRF4
+ADDF4
+ADDRLP4 648
+INDIRF4
+SUBF4
+LEF4 $200
+ADDRLP4 452+24+4
+INDIRF4
+ADDRLP4 452+72+4
+INDIRF4
+ADDF4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRLP4 272+84+4
+INDIRF4
+ADDF4
+ADDRLP4 648
+INDIRF4
+ADDF4
+GEF4 $200
+ADDRLP4 652
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 452+24+8
+INDIRF4
+ADDRLP4 452+84+8
+INDIRF4
+ADDF4
+ADDRLP4 272+24+8
+INDIRF4
+ADDRLP4 272+72+8
+INDIRF4
+ADDF4
+ADDRLP4 652
+INDIRF4
+SUBF4
+LEF4 $218
+ADDRLP4 452+24+8
+INDIRF4
+ADDRLP4 452+72+8
+INDIRF4
+ADDF4
+ADDRLP4 272+24+8
+INDIRF4
+ADDRLP4 272+84+8
+INDIRF4
+ADDF4
+ADDRLP4 652
+INDIRF4
+ADDF4
+GEF4 $218
+ADDRLP4 272+36
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 656
+CNSTP4 0
+ASGNP4
+ADDRLP4 656
+INDIRP4
+ARGP4
+ADDRLP4 656
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 260+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 608
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ADDRLP4 272+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 608+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ADDRLP4 272+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 608+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ADDRLP4 272+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 608
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 260
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 608+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 260+8
+INDIRF4
+ADDRLP4 608+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1060320051
+LEF4 $245
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 608
+ARGP4
+CNSTF4 1137180672
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+LABELV $245
+LABELV $218
+LABELV $200
+LABELV $190
+LABELV $180
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $251
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 644
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 604
+ADDRLP4 644
+INDIRF4
+ASGNF4
+ADDRLP4 648
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+ADDRLP4 604
+INDIRF4
+MULF4
+GEF4 $253
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $253
+LABELV $251
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 648
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 648
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $262
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Crouch
+CALLV
+pop
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 648
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1028443341
+ADDRFP4 0
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+MULF4
+GEF4 $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+LABELV $264
+LABELV $263
+LABELV $260
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $266
+ADDRLP4 260
+ADDRLP4 272+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 652
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 652
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 652
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 648
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+MULF4
+GEF4 $275
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 260
+ADDRLP4 592
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 592+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 592+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 656
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 656
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 656
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $275
+LABELV $267
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 656
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $281
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $283
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $281
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $178
+LABELV $169
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $284
+ADDRLP4 272+24
+ARGP4
+ADDRLP4 632
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 448
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRLP4 636
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $287
+ADDRLP4 636
+INDIRI4
+ARGI4
+ADDRLP4 640
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+EQI4 $287
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ADDRLP4 272+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6552
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $287
+LABELV $284
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+GEF4 $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 632
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $292
+ARGP4
+ADDRLP4 632
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $290
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $161
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $293
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 624
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+INDIRF4
+LEF4 $295
+ADDRFP4 0
+INDIRP4
+CNSTI4 6040
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $295
+LABELV $293
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $297
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $297
+ADDRFP4 0
+INDIRP4
+CNSTI4 6040
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $297
+ADDRLP4 624
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 624
+INDIRF4
+CNSTF4 0
+EQF4 $299
+ADDRLP4 624
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $301
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $302
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $299
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $303
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $305
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $303
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 636
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+CNSTF4 1167663104
+GEF4 $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 640
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 644
+CNSTF4 1077936128
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6040
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 644
+INDIRF4
+ADDF4
+ADDRLP4 644
+INDIRF4
+ADDRLP4 640
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 BotHasPersistantPowerupAndWeapon
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+EQI4 $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTF4 1135542272
+ASGNF4
+LABELV $311
+LABELV $308
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $297
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $312
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $312
+ADDRLP4 624
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 624
+INDIRF4
+CNSTF4 0
+EQF4 $314
+ADDRLP4 624
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $314
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $316
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $314
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+SUBF4
+LEF4 $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 5888
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+NEI4 $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $319
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $320
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 632
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $322
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $322
+ADDRLP4 624
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 624
+INDIRF4
+CNSTF4 0
+EQF4 $324
+ADDRLP4 624
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $139
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $324
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $327
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $327
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 632
+ADDRGP4 trap_BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $330
+JUMPV
+LABELV $329
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 636
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $332
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $334
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $332
+LABELV $330
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $322
+ADDRLP4 624
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 7
+EQI4 $337
+ADDRLP4 624
+INDIRI4
+CNSTI4 8
+NEI4 $335
+LABELV $337
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $335
+ADDRLP4 628
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $338
+ADDRLP4 628
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $340
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 632
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRLP4 632
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $139
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+LABELV $340
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $338
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $343
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $345
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $347
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $343
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 640
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 640
+INDIRF4
+CNSTF4 1163984896
+GEF4 $350
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $352
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 644
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 644
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $357
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+LABELV $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $352
+ADDRLP4 644
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+MULF4
+GEF4 $358
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 260
+ADDRLP4 592
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 592+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 592+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 652
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 652
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 652
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $358
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $364
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 648
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 604
+ADDRLP4 648
+INDIRF4
+ASGNF4
+ADDRLP4 652
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+ADDRLP4 604
+INDIRF4
+MULF4
+GEF4 $366
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $366
+LABELV $364
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $368
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Crouch
+CALLV
+pop
+LABELV $368
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+EQI4 $370
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $370
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 656
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $372
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $374
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $347
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $376
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $376
+LABELV $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $372
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $350
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $335
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $378
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $378
+ADDRLP4 628
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $380
+ADDRLP4 628
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $380
+ADDRLP4 4
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8872
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $386
+JUMPV
+LABELV $383
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $387
+ADDRLP4 4
+ARGP4
+ADDRGP4 $389
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $387
+LABELV $384
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $386
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $383
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $390
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $139
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $380
+ADDRFP4 0
+INDIRP4
+CNSTI4 8876
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8876
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 636
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 8880
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $395
+ADDRFP4 0
+INDIRP4
+CNSTI4 8876
+ADDP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $397
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 8876
+ADDP4
+ASGNP4
+ADDRLP4 640
+INDIRP4
+ADDRLP4 640
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $396
+JUMPV
+LABELV $397
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 8876
+ADDP4
+ASGNP4
+ADDRLP4 640
+INDIRP4
+ADDRLP4 640
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 644
+ADDRFP4 0
+INDIRP4
+CNSTI4 8880
+ADDP4
+ASGNP4
+ADDRLP4 644
+INDIRP4
+ADDRLP4 644
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRFP4 0
+INDIRP4
+CNSTI4 8876
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $399
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 8876
+ADDP4
+ASGNP4
+ADDRLP4 640
+INDIRP4
+ADDRLP4 640
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 8876
+ADDP4
+ASGNP4
+ADDRLP4 640
+INDIRP4
+ADDRLP4 640
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 644
+ADDRFP4 0
+INDIRP4
+CNSTI4 8880
+ADDP4
+ASGNP4
+ADDRLP4 644
+INDIRP4
+ADDRLP4 644
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $400
+LABELV $396
+LABELV $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $401
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $403
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 8876
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $404
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $404
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8876
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $378
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $406
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $408
+ADDRLP4 628
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $410
+ADDRLP4 628
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $410
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $412
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $413
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $410
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 636
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 632
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 1
+EQI4 $417
+ADDRLP4 632
+INDIRI4
+CNSTI4 2
+EQI4 $418
+ADDRGP4 $414
+JUMPV
+LABELV $417
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $415
+JUMPV
+LABELV $418
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $415
+JUMPV
+LABELV $414
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $415
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $419
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 648
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 1
+EQI4 $424
+ADDRLP4 648
+INDIRI4
+CNSTI4 2
+EQI4 $425
+ADDRGP4 $421
+JUMPV
+LABELV $424
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $422
+JUMPV
+LABELV $425
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $421
+LABELV $422
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $419
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $426
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $426
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $428
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $428
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 636
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 632
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 1
+EQI4 $433
+ADDRLP4 632
+INDIRI4
+CNSTI4 2
+EQI4 $434
+ADDRGP4 $430
+JUMPV
+LABELV $433
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $431
+JUMPV
+LABELV $434
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $431
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+NEI4 $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $437
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $437
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+EQI4 $439
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 0
+EQI4 $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 656
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 656
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $442
+JUMPV
+LABELV $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $442
+LABELV $439
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $428
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $407
+ADDRLP4 632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 0
+EQF4 $445
+ADDRLP4 632
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $445
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $447
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $448
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $445
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 636
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 1
+EQI4 $452
+ADDRLP4 636
+INDIRI4
+CNSTI4 2
+EQI4 $453
+ADDRGP4 $449
+JUMPV
+LABELV $452
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $450
+JUMPV
+LABELV $453
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+EQI4 $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $456
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $406
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $458
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $460
+ADDRLP4 628
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $462
+ADDRLP4 628
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $462
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $412
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $413
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $462
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 632
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 0
+EQI4 $464
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $464
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $466
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $466
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $460
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $468
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 632
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 628
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+CNSTI4 1
+EQI4 $473
+ADDRLP4 628
+INDIRI4
+CNSTI4 2
+EQI4 $474
+ADDRGP4 $470
+JUMPV
+LABELV $473
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $471
+JUMPV
+LABELV $474
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $471
+JUMPV
+LABELV $470
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $471
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+NEI4 $475
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $475
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $477
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $477
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $479
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $479
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $468
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $481
+ADDRLP4 632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 0
+EQF4 $483
+ADDRLP4 632
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $483
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $485
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $486
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $483
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 636
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 1
+EQI4 $490
+ADDRLP4 636
+INDIRI4
+CNSTI4 2
+EQI4 $491
+ADDRGP4 $487
+JUMPV
+LABELV $490
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $488
+JUMPV
+LABELV $491
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $488
+JUMPV
+LABELV $487
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $488
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $492
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $492
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+EQI4 $494
+ADDRLP4 652
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 652
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $494
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $459
+ADDRLP4 632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 0
+EQF4 $498
+ADDRLP4 632
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $498
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $447
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $448
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $500
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $500
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 636
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $458
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $502
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $503
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $503
+ADDRLP4 632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 0
+EQF4 $506
+ADDRLP4 632
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $506
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $485
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $486
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $506
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 636
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 1
+EQI4 $511
+ADDRLP4 636
+INDIRI4
+CNSTI4 2
+EQI4 $512
+ADDRGP4 $508
+JUMPV
+LABELV $511
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $509
+JUMPV
+LABELV $512
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $509
+JUMPV
+LABELV $508
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $509
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 BotFeelingBad
+CALLF4
+ASGNF4
+ADDRLP4 648
+INDIRF4
+CNSTF4 1112014848
+LEF4 $513
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $513
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 0
+EQI4 $515
+ADDRLP4 656
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 656
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $515
+ADDRLP4 260
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 664
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 664
+INDIRF4
+CNSTF4 1163984896
+GEF4 $519
+ADDRLP4 668
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 668
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $519
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $521
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $521
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $502
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $523
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $525
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 632
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 628
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+CNSTI4 1
+EQI4 $530
+ADDRLP4 628
+INDIRI4
+CNSTI4 2
+EQI4 $531
+ADDRGP4 $527
+JUMPV
+LABELV $530
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $528
+JUMPV
+LABELV $531
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $528
+JUMPV
+LABELV $527
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $528
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+NEI4 $532
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $534
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $534
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $536
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $536
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $525
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $538
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $538
+ADDRLP4 632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 0
+EQF4 $540
+ADDRLP4 632
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $540
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $485
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $486
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $540
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 636
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 1
+EQI4 $545
+ADDRLP4 636
+INDIRI4
+CNSTI4 2
+EQI4 $546
+ADDRGP4 $542
+JUMPV
+LABELV $545
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $543
+JUMPV
+LABELV $546
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $543
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $547
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $547
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+EQI4 $549
+ADDRLP4 652
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 652
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $549
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $538
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $551
+ADDRFP4 0
+INDIRP4
+CNSTI4 6056
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $551
+ADDRLP4 636
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+CNSTF4 0
+EQF4 $553
+ADDRLP4 636
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $553
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $555
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $486
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $553
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $556
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $556
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+EQI4 $558
+ADDRLP4 644
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6056
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CNSTF4 1077936128
+ADDRLP4 644
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $558
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $551
+LABELV $523
+LABELV $503
+LABELV $459
+LABELV $407
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 628
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+RETI4
+LABELV $133
+endproc BotGetLongTermGoal 672 20
+export BotLongTermGoal
+proc BotLongTermGoal 448 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6776
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $561
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $561
+ADDRFP4 0
+INDIRP4
+CNSTI4 6776
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $563
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 416
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $565
+ARGP4
+ADDRLP4 416
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6776
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 424
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $563
+ADDRLP4 416
+ADDRFP4 0
+INDIRP4
+CNSTI4 6784
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 416
+INDIRF4
+CNSTF4 0
+GEF4 $566
+ADDRLP4 416
+INDIRF4
+NEGF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $566
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 420
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $568
+ARGP4
+ADDRLP4 420
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6784
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $566
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $569
+ADDRLP4 12+24
+ARGP4
+ADDRLP4 420
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 412
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRLP4 424
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+CNSTI4 0
+EQI4 $572
+ADDRLP4 424
+INDIRI4
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+EQI4 $572
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6720
+ADDP4
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $572
+LABELV $569
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 424
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 424
+INDIRF4
+CNSTF4 0
+EQF4 $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 6780
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 6780
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $577
+ADDRFP4 0
+INDIRP4
+CNSTI4 6788
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $577
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6720
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6724
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 436
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 408
+ADDRLP4 436
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6788
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $581
+ADDRFP4 0
+INDIRP4
+CNSTI4 6784
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+GEF4 $583
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 440
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $568
+ARGP4
+ADDRLP4 440
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6784
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $583
+ADDRLP4 408
+INDIRF4
+CNSTF4 1176256512
+GEF4 $585
+ADDRFP4 0
+INDIRP4
+CNSTI4 6788
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $585
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6720
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $581
+ADDRLP4 408
+INDIRF4
+CNSTF4 1215570944
+LEF4 $587
+ADDRFP4 0
+INDIRP4
+CNSTI4 6784
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+GEF4 $589
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 440
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $568
+ARGP4
+ADDRLP4 440
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6784
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $589
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 444
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 444
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 444
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $587
+LABELV $561
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 416
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+RETI4
+LABELV $560
+endproc BotLongTermGoal 448 20
+export AIEnter_Intermission
+proc AIEnter_Intermission 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $599
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotChat_EndLevel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $600
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $600
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+ADDRGP4 AINode_Intermission
+ASGNP4
+LABELV $598
+endproc AIEnter_Intermission 8 16
+export AINode_Intermission
+proc AINode_Intermission 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $603
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotChat_StartLevel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $606
+JUMPV
+LABELV $605
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $606
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $607
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $603
+CNSTI4 1
+RETI4
+LABELV $602
+endproc AINode_Intermission 16 8
+export AIEnter_Observer
+proc AIEnter_Observer 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $609
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+ADDRGP4 AINode_Observer
+ASGNP4
+LABELV $608
+endproc AIEnter_Observer 0 16
+export AINode_Observer
+proc AINode_Observer 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $611
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $613
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $611
+CNSTI4 1
+RETI4
+LABELV $610
+endproc AINode_Observer 4 8
+export AIEnter_Stand
+proc AIEnter_Stand 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $615
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+ADDRGP4 AINode_Stand
+ASGNP4
+LABELV $614
+endproc AIEnter_Stand 0 16
+export AINode_Stand
+proc AINode_Stand 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5940
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+LEI4 $617
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotChat_HitTalking
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $619
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+CNSTF4 1036831949
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+CNSTF4 1036831949
+ADDF4
+ASGNF4
+LABELV $619
+LABELV $617
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $621
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $623
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $625
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $616
+JUMPV
+LABELV $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $621
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Talk
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $626
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $628
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $616
+JUMPV
+LABELV $626
+CNSTI4 1
+RETI4
+LABELV $616
+endproc AINode_Stand 24 12
+export AIEnter_Respawn
+proc AIEnter_Respawn 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $630
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetMoveState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetGoalState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotChat_Death
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5972
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $632
+JUMPV
+LABELV $631
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5972
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $632
+ADDRFP4 0
+INDIRP4
+CNSTI4 5880
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+ADDRGP4 AINode_Respawn
+ASGNP4
+LABELV $629
+endproc AIEnter_Respawn 12 16
+export AINode_Respawn
+proc AINode_Respawn 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5880
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $634
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $636
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $638
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+ADDRGP4 $635
+JUMPV
+LABELV $636
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Respawn
+CALLV
+pop
+ADDRGP4 $635
+JUMPV
+LABELV $634
+ADDRFP4 0
+INDIRP4
+CNSTI4 5972
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $639
+ADDRFP4 0
+INDIRP4
+CNSTI4 5880
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Respawn
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $641
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5948
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $641
+LABELV $639
+LABELV $635
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $643
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+GEF4 $643
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Talk
+CALLV
+pop
+LABELV $643
+CNSTI4 1
+RETI4
+LABELV $633
+endproc AINode_Respawn 4 12
+export BotSelectActivateWeapon
+proc BotSelectActivateWeapon 88 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4872
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $646
+ADDRFP4 0
+INDIRP4
+CNSTI4 4924
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $646
+CNSTI4 2
+RETI4
+ADDRGP4 $645
+JUMPV
+LABELV $646
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4868
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $648
+ADDRFP4 0
+INDIRP4
+CNSTI4 4920
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $648
+CNSTI4 3
+RETI4
+ADDRGP4 $645
+JUMPV
+LABELV $648
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4892
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $650
+ADDRFP4 0
+INDIRP4
+CNSTI4 4932
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $650
+CNSTI4 8
+RETI4
+ADDRGP4 $645
+JUMPV
+LABELV $650
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4884
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $652
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $652
+CNSTI4 6
+RETI4
+ADDRGP4 $645
+JUMPV
+LABELV $652
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $654
+ADDRFP4 0
+INDIRP4
+CNSTI4 4960
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $654
+CNSTI4 13
+RETI4
+ADDRGP4 $645
+JUMPV
+LABELV $654
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $656
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $656
+CNSTI4 11
+RETI4
+ADDRGP4 $645
+JUMPV
+LABELV $656
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $658
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $658
+CNSTI4 12
+RETI4
+ADDRGP4 $645
+JUMPV
+LABELV $658
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4876
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 4928
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $660
+CNSTI4 4
+RETI4
+ADDRGP4 $645
+JUMPV
+LABELV $660
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4888
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $662
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $662
+CNSTI4 7
+RETI4
+ADDRGP4 $645
+JUMPV
+LABELV $662
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4880
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $664
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $664
+CNSTI4 5
+RETI4
+ADDRGP4 $645
+JUMPV
+LABELV $664
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+LEI4 $666
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+LEI4 $666
+CNSTI4 9
+RETI4
+ADDRGP4 $645
+JUMPV
+LABELV $666
+CNSTI4 -1
+RETI4
+LABELV $645
+endproc BotSelectActivateWeapon 88 0
+export BotClearPath
+proc BotClearPath 404 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $669
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 17
+BANDI4
+CNSTI4 0
+NEI4 $671
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 264
+ADDRLP4 12+12+12
+INDIRB
+ASGNB 12
+ADDRLP4 264+8
+ADDRLP4 264+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 264
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 264+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4840
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $680
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $680
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $682
+ADDRLP4 368
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ADDRLP4 368
+INDIRP4
+INDIRI4
+CNSTI4 17
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+NEI4 $684
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 372
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $686
+ADDRLP4 276
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 380
+CNSTP4 0
+ASGNP4
+ADDRLP4 380
+INDIRP4
+ARGP4
+ADDRLP4 380
+INDIRP4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 276+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $692
+ADDRLP4 276+80
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $688
+LABELV $692
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $688
+LABELV $686
+LABELV $684
+LABELV $682
+LABELV $671
+LABELV $669
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $693
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $693
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $695
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 17
+BANDI4
+CNSTI4 0
+NEI4 $695
+ADDRLP4 256
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 260
+CNSTI4 -1
+ASGNI4
+ADDRLP4 248
+CNSTI4 0
+ASGNI4
+ADDRGP4 $700
+JUMPV
+LABELV $697
+ADDRLP4 248
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 12+12+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+12+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+12+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 364
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+GEF4 $711
+ADDRLP4 256
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 248
+INDIRI4
+ASGNI4
+LABELV $711
+LABELV $698
+ADDRLP4 248
+ADDRLP4 248
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $700
+ADDRLP4 248
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6408
+ADDP4
+INDIRI4
+LTI4 $697
+ADDRLP4 260
+INDIRI4
+CNSTI4 -1
+EQI4 $713
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 264
+ADDRLP4 12+12+12
+INDIRB
+ASGNB 12
+ADDRLP4 264+8
+ADDRLP4 264+8
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 264
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 264+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4840
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 368
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4892
+ADDP4
+INDIRI4
+ADDRLP4 368
+INDIRI4
+LEI4 $722
+ADDRFP4 0
+INDIRP4
+CNSTI4 4932
+ADDP4
+INDIRI4
+ADDRLP4 368
+INDIRI4
+LEI4 $722
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $723
+JUMPV
+LABELV $722
+ADDRLP4 376
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4880
+ADDP4
+INDIRI4
+ADDRLP4 376
+INDIRI4
+LEI4 $724
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRI4
+ADDRLP4 376
+INDIRI4
+LEI4 $724
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $725
+JUMPV
+LABELV $724
+ADDRLP4 384
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRI4
+ADDRLP4 384
+INDIRI4
+LEI4 $726
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ADDRLP4 384
+INDIRI4
+LEI4 $726
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRGP4 $727
+JUMPV
+LABELV $726
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $727
+LABELV $725
+LABELV $723
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $728
+ADDRLP4 388
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 388
+INDIRP4
+ADDRLP4 388
+INDIRP4
+INDIRI4
+CNSTI4 17
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+NEI4 $730
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 392
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+EQI4 $732
+ADDRLP4 276
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 400
+CNSTP4 0
+ASGNP4
+ADDRLP4 400
+INDIRP4
+ARGP4
+ADDRLP4 400
+INDIRP4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 276+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $738
+ADDRLP4 276+80
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $734
+LABELV $738
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $734
+LABELV $732
+LABELV $730
+LABELV $728
+LABELV $713
+LABELV $695
+LABELV $668
+endproc BotClearPath 404 28
+export AIEnter_Seek_ActivateEntity
+proc AIEnter_Seek_ActivateEntity 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $740
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+ADDRGP4 AINode_Seek_ActivateEntity
+ASGNP4
+LABELV $739
+endproc AIEnter_Seek_ActivateEntity 0 16
+export AINode_Seek_ActivateEntity
+proc AINode_Seek_ActivateEntity 380 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $742
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $744
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $741
+JUMPV
+LABELV $742
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $745
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $747
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $741
+JUMPV
+LABELV $745
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $748
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $750
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $741
+JUMPV
+LABELV $748
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $751
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 332
+INDIRP4
+ADDRLP4 332
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $751
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $754
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ADDRLP4 340
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $754
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $756
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $758
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $741
+JUMPV
+LABELV $756
+ADDRLP4 344
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 344
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 348
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRLP4 344
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 348
+INDIRI4
+EQI4 $759
+ADDRLP4 72
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 356
+CNSTP4 0
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $765
+ADDRLP4 72+80
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $761
+LABELV $765
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+NEI4 $766
+ADDRLP4 368
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 368
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 368
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4840
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 308
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 308
+ARGP4
+ADDRLP4 376
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 376
+INDIRI4
+CNSTI4 0
+EQI4 $770
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $770
+LABELV $766
+LABELV $761
+LABELV $759
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $772
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 156+24
+ARGP4
+ADDRLP4 352
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+NEI4 $774
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $774
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $777
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $779
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $741
+JUMPV
+LABELV $779
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $781
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $741
+JUMPV
+LABELV $777
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $773
+JUMPV
+LABELV $772
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $782
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $783
+JUMPV
+LABELV $782
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $784
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $786
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $786
+LABELV $784
+LABELV $783
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $788
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $790
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $741
+JUMPV
+LABELV $790
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $792
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $741
+JUMPV
+LABELV $788
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $793
+CNSTI4 0
+RETI4
+ADDRGP4 $741
+JUMPV
+LABELV $793
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $795
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $795
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+LABELV $773
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $797
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $799
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 356
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 356
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4840
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $799
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $806
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $810
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $810
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $806
+LABELV $797
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $813
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $814
+JUMPV
+LABELV $813
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $817
+ADDRLP4 352
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+MULF4
+GEF4 $818
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 56
+ADDRLP4 296
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 296+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 296+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 360
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $818
+JUMPV
+LABELV $817
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $826
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 296
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $828
+ADDRLP4 56
+ADDRLP4 296
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 296+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 296+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $829
+JUMPV
+LABELV $828
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $829
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 360
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $826
+LABELV $818
+LABELV $814
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $835
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $835
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 352
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $839
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $841
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $843
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+ADDRGP4 $842
+JUMPV
+LABELV $841
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $843
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $842
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+LABELV $839
+CNSTI4 1
+RETI4
+LABELV $741
+endproc AINode_Seek_ActivateEntity 380 28
+export AIEnter_Seek_NBG
+proc AIEnter_Seek_NBG 204 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $845
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $848
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $846
+JUMPV
+LABELV $845
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $848
+ARGP4
+ADDRGP4 $849
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $846
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+ADDRGP4 AINode_Seek_NBG
+ASGNP4
+LABELV $844
+endproc AIEnter_Seek_NBG 204 16
+export AINode_Seek_NBG
+proc AINode_Seek_NBG 192 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $851
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $853
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $851
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $854
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $856
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $854
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $857
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $859
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $857
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $860
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $860
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $863
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $863
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $865
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $865
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $867
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $868
+JUMPV
+LABELV $867
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $869
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $869
+LABELV $868
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $871
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1028443341
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $873
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $871
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $874
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $874
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $876
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $876
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $878
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $879
+JUMPV
+LABELV $878
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $882
+ADDRLP4 176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+MULF4
+GEF4 $883
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 120
+ADDRLP4 108
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 108+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 184
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $883
+JUMPV
+LABELV $882
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $891
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_BotGetSecondGoal
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $893
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+LABELV $893
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 184
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $895
+ADDRLP4 120
+ADDRLP4 108
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 108+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $896
+JUMPV
+LABELV $895
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $896
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 188
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $891
+LABELV $883
+LABELV $879
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $902
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $902
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 176
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $906
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $908
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $910
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+ADDRGP4 $909
+JUMPV
+LABELV $908
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $910
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $909
+LABELV $906
+CNSTI4 1
+RETI4
+LABELV $850
+endproc AINode_Seek_NBG 192 20
+export AIEnter_Seek_LTG
+proc AIEnter_Seek_LTG 204 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $912
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $915
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $913
+JUMPV
+LABELV $912
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $915
+ARGP4
+ADDRGP4 $849
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $913
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+ADDRGP4 AINode_Seek_LTG
+ASGNP4
+LABELV $911
+endproc AIEnter_Seek_LTG 204 16
+export AINode_Seek_LTG
+proc AINode_Seek_LTG 212 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $917
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $919
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $916
+JUMPV
+LABELV $917
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $920
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $922
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $916
+JUMPV
+LABELV $920
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $923
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $925
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $916
+JUMPV
+LABELV $923
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotChat_Random
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $926
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $928
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $916
+JUMPV
+LABELV $926
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $929
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $929
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $932
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $932
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $934
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $934
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $936
+ADDRLP4 168
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+MULF4
+GEF4 $938
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+LABELV $938
+LABELV $936
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 168
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $940
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $942
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $944
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $916
+JUMPV
+LABELV $942
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $944
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $916
+JUMPV
+LABELV $940
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $945
+CNSTI4 1
+RETI4
+ADDRGP4 $916
+JUMPV
+LABELV $945
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $947
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotWantsToCamp
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $949
+ADDRLP4 108
+CNSTI4 400
+ASGNI4
+ADDRGP4 $950
+JUMPV
+LABELV $949
+ADDRLP4 108
+CNSTI4 150
+ASGNI4
+LABELV $950
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $951
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $952
+ADDRLP4 108
+CNSTI4 50
+ASGNI4
+ADDRGP4 $952
+JUMPV
+LABELV $951
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $955
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $956
+ADDRLP4 108
+CNSTI4 50
+ASGNI4
+ADDRGP4 $956
+JUMPV
+LABELV $955
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $959
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $961
+ADDRLP4 108
+CNSTI4 80
+ASGNI4
+LABELV $961
+LABELV $959
+LABELV $956
+LABELV $952
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 184
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $963
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CNSTF4 1008981770
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $965
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $916
+JUMPV
+LABELV $963
+LABELV $947
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $966
+CNSTI4 0
+RETI4
+ADDRGP4 $916
+JUMPV
+LABELV $966
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $968
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5964
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $968
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $970
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $971
+JUMPV
+LABELV $970
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $974
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+MULF4
+GEF4 $975
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 196
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $975
+JUMPV
+LABELV $974
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $983
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $985
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $986
+JUMPV
+LABELV $985
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 196
+INDIRF4
+CNSTF4 0
+EQF4 $991
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $992
+JUMPV
+LABELV $991
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+MULF4
+GEF4 $995
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 208
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 208
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $995
+LABELV $992
+LABELV $986
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 204
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $983
+LABELV $975
+LABELV $971
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1001
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1001
+CNSTI4 1
+RETI4
+LABELV $916
+endproc AINode_Seek_LTG 212 20
+export AIEnter_Battle_Fight
+proc AIEnter_Battle_Fight 4 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1006
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+LABELV $1005
+endproc AIEnter_Battle_Fight 4 16
+export AIEnter_Battle_SuicidalFight
+proc AIEnter_Battle_SuicidalFight 4 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1006
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $1007
+endproc AIEnter_Battle_SuicidalFight 4 16
+export AINode_Battle_Fight
+proc AINode_Battle_Fight 292 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $1009
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1011
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1009
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+EQI4 $1012
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1014
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1012
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $1015
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1017
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1015
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+EQI4 $1018
+LABELV $1018
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1020
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1022
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1020
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6032
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1023
+ADDRFP4 0
+INDIRP4
+CNSTI4 6032
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1024
+ADDRFP4 0
+INDIRP4
+CNSTI4 6032
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5908
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1027
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_EnemySuicide
+CALLI4
+pop
+LABELV $1027
+ADDRFP4 0
+INDIRP4
+CNSTI4 5888
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+NEI4 $1029
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 BotChat_Kill
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $1029
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1031
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+ADDRGP4 $1030
+JUMPV
+LABELV $1029
+ADDRFP4 0
+INDIRP4
+CNSTI4 5964
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1031
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $1030
+CNSTI4 0
+RETI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1023
+ADDRLP4 0
+ARGP4
+ADDRLP4 228
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $1032
+ADDRFP4 0
+INDIRP4
+CNSTI4 6032
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1032
+LABELV $1024
+ADDRLP4 0
+ARGP4
+ADDRLP4 228
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $1034
+ADDRLP4 0
+ARGP4
+ADDRLP4 232
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+NEI4 $1034
+ADDRLP4 236
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1045220557
+GEF4 $1036
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1038
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1036
+LABELV $1034
+ADDRLP4 196
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1040
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1046
+ADDRLP4 236
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1042
+LABELV $1046
+ADDRLP4 196+8
+ADDRLP4 196+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1042
+LABELV $1040
+ADDRLP4 196
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $1048
+ADDRLP4 192
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+EQI4 $1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 6440
+ADDP4
+ADDRLP4 196
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+LABELV $1048
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5940
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+LEI4 $1050
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 BotChat_HitNoDeath
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+EQI4 $1052
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 264
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1054
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1052
+LABELV $1050
+ADDRGP4 PERS_HITS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5944
+ADDP4
+INDIRI4
+LEI4 $1055
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotChat_HitNoKill
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $1057
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 268
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1059
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1057
+LABELV $1055
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 0
+NEF4 $1060
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1066
+ADDRLP4 268
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1062
+LABELV $1066
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1067
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1062
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $1068
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1070
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1068
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1070
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1060
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBattleUseItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1071
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 268
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $1071
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $1074
+ADDRLP4 276
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1074
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1076
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+ADDRLP4 284
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $1076
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAttackMove
+CALLV
+pop
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1078
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5964
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1078
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $1080
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $1082
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1084
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1082
+LABELV $1080
+CNSTI4 1
+RETI4
+LABELV $1008
+endproc AINode_Battle_Fight 292 20
+export AIEnter_Battle_Chase
+proc AIEnter_Battle_Chase 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1086
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+ADDRGP4 AINode_Battle_Chase
+ASGNP4
+LABELV $1085
+endproc AIEnter_Battle_Chase 0 16
+export AINode_Battle_Chase
+proc AINode_Battle_Chase 204 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $1088
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1090
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1087
+JUMPV
+LABELV $1088
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1091
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1093
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1087
+JUMPV
+LABELV $1091
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1094
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1096
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1087
+JUMPV
+LABELV $1094
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1097
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1099
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1087
+JUMPV
+LABELV $1097
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 0
+EQF4 $1100
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1086
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1087
+JUMPV
+LABELV $1100
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 156
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $1102
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1104
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1087
+JUMPV
+LABELV $1102
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1105
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1107
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1087
+JUMPV
+LABELV $1105
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1108
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $1108
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $1111
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1111
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $1113
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $1113
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6440
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $1127
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1127
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 0
+EQF4 $1131
+ADDRLP4 180
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $1129
+LABELV $1131
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1132
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1087
+JUMPV
+LABELV $1129
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1133
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 1125515264
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 188
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $1135
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 108
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1137
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1087
+JUMPV
+LABELV $1135
+LABELV $1133
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $1138
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5964
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1138
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $1140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ADDRLP4 56+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1141
+JUMPV
+LABELV $1140
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $1144
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $1146
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1147
+JUMPV
+LABELV $1146
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 196
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $1148
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1149
+JUMPV
+LABELV $1148
+ADDRLP4 56+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1149
+LABELV $1147
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 192
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1144
+LABELV $1141
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1155
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+ADDRLP4 56+24
+INDIRI4
+ASGNI4
+LABELV $1155
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+NEI4 $1159
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1159
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $1161
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1163
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1087
+JUMPV
+LABELV $1161
+CNSTI4 1
+RETI4
+LABELV $1087
+endproc AINode_Battle_Chase 204 20
+export AIEnter_Battle_Retreat
+proc AIEnter_Battle_Retreat 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1165
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+ADDRGP4 AINode_Battle_Retreat
+ASGNP4
+LABELV $1164
+endproc AIEnter_Battle_Retreat 0 16
+export AINode_Battle_Retreat
+proc AINode_Battle_Retreat 368 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1167
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1169
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1167
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $1170
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1172
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1170
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1173
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1175
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1173
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1176
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1178
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1176
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108
+ARGP4
+ADDRLP4 296
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1179
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1181
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1179
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1182
+LABELV $1182
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $1184
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1187
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1187
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1189
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1191
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1189
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 332
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 332
+INDIRF4
+CNSTF4 0
+EQF4 $1192
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 108+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1195
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1201
+ADDRLP4 336
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1197
+LABELV $1201
+ADDRLP4 252+8
+ADDRLP4 252+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1197
+LABELV $1195
+ADDRLP4 252
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRLP4 340
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $1203
+ADDRLP4 340
+INDIRI4
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1203
+ADDRFP4 0
+INDIRP4
+CNSTI4 6440
+ADDP4
+ADDRLP4 252
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+LABELV $1203
+LABELV $1192
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+GEF4 $1205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1207
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1205
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1208
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 336
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $1210
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1212
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1210
+LABELV $1208
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBattleUseItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 340
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+NEI4 $1213
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1215
+ARGP4
+ADDRGP4 AIEnter_Battle_SuicidalFight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1213
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1216
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 264
+CNSTF4 1125515264
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $1218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1219
+ADDRLP4 264
+CNSTF4 1112014848
+ASGNF4
+ADDRGP4 $1219
+JUMPV
+LABELV $1218
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $1222
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1223
+ADDRLP4 264
+CNSTF4 1112014848
+ASGNF4
+ADDRGP4 $1223
+JUMPV
+LABELV $1222
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $1226
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1228
+ADDRLP4 264
+CNSTF4 1117782016
+ASGNF4
+LABELV $1228
+LABELV $1226
+LABELV $1223
+LABELV $1219
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 264
+INDIRF4
+ARGF4
+ADDRLP4 348
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1230
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1232
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1230
+LABELV $1216
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1233
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5964
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1233
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1235
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1236
+JUMPV
+LABELV $1235
+ADDRLP4 348
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 348
+INDIRI4
+NEI4 $1239
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 348
+INDIRI4
+NEI4 $1239
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 352
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 268
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1242
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1243
+JUMPV
+LABELV $1242
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 252
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+EQI4 $1244
+ADDRLP4 272
+ADDRLP4 252
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272+4
+ADDRLP4 252+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272+8
+ADDRLP4 252+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1245
+JUMPV
+LABELV $1244
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1245
+ADDRLP4 364
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 364
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 364
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1243
+LABELV $1239
+LABELV $1236
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1251
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1166
+endproc AINode_Battle_Retreat 368 20
+export AIEnter_Battle_NBG
+proc AIEnter_Battle_NBG 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1256
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+ADDRGP4 AINode_Battle_NBG
+ASGNP4
+LABELV $1255
+endproc AIEnter_Battle_NBG 0 16
+export AINode_Battle_NBG
+proc AINode_Battle_NBG 356 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1258
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1260
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1257
+JUMPV
+LABELV $1258
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1261
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1263
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1257
+JUMPV
+LABELV $1261
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $1264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1266
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1257
+JUMPV
+LABELV $1264
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1267
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1269
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1257
+JUMPV
+LABELV $1267
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108
+ARGP4
+ADDRLP4 292
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1270
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1272
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1257
+JUMPV
+LABELV $1270
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1273
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $1273
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1276
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1276
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1278
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 312
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $1278
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 316
+INDIRF4
+CNSTF4 0
+EQF4 $1280
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 108+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1283
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1289
+ADDRLP4 320
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1285
+LABELV $1289
+ADDRLP4 252+8
+ADDRLP4 252+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1285
+LABELV $1283
+ADDRLP4 252
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 324
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1291
+ADDRLP4 324
+INDIRI4
+ARGI4
+ADDRLP4 328
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $1291
+ADDRFP4 0
+INDIRP4
+CNSTI4 6440
+ADDP4
+ADDRLP4 252
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+LABELV $1291
+LABELV $1280
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+NEI4 $1293
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1294
+JUMPV
+LABELV $1293
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1295
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1295
+LABELV $1294
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1297
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $1299
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1301
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+ADDRGP4 $1300
+JUMPV
+LABELV $1299
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1301
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $1300
+CNSTI4 0
+RETI4
+ADDRGP4 $1257
+JUMPV
+LABELV $1297
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1302
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1302
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1304
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1305
+JUMPV
+LABELV $1304
+ADDRLP4 336
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 336
+INDIRI4
+NEI4 $1308
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 336
+INDIRI4
+NEI4 $1308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 340
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 264
+ADDRLP4 340
+INDIRF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1311
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1312
+JUMPV
+LABELV $1311
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 252
+ARGP4
+ADDRLP4 348
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1313
+ADDRLP4 268
+ADDRLP4 252
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+4
+ADDRLP4 252+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+8
+ADDRLP4 252+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1314
+JUMPV
+LABELV $1313
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1314
+ADDRLP4 352
+ADDRFP4 0
+INDIRP4
+CNSTI4 6476
+ADDP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 352
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1312
+LABELV $1308
+LABELV $1305
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1320
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1257
+endproc AINode_Battle_NBG 356 20
+bss
+export nodeswitch
+align 1
+LABELV nodeswitch
+skip 7344
+export numnodeswitches
+align 4
+LABELV numnodeswitches
+skip 4
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import AIEnter_Seek_Camp
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1301
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1272
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1269
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1266
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1263
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1260
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1256
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $1232
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $1215
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1212
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1207
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1191
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1181
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1178
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1175
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1172
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1169
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1165
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1163
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1137
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $1132
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1107
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $1104
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1099
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1096
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1093
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1090
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1086
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1084
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1070
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1067
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1059
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1054
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1038
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1031
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1022
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1017
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1014
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1011
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1006
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $965
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $944
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $928
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $925
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $922
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $919
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $915
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 0
+align 1
+LABELV $910
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $873
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $859
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $856
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $853
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $849
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $848
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $843
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $792
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $781
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $758
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $750
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $747
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $744
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $740
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $638
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $630
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $628
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $625
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $615
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $613
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $609
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $607
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $599
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $568
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $565
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $555
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $486
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $485
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $448
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $447
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $413
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $412
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $403
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $390
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $389
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 0
+align 1
+LABELV $382
+byte 1 0
+align 1
+LABELV $357
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $356
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $347
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $342
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $334
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $331
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $326
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $319
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $316
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $305
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $302
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $301
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $292
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $283
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 76
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 84
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $261
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $168
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $165
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $139
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $138
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $67
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 50
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $65
+byte 1 10
+byte 1 0
+align 1
+LABELV $64
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $59
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
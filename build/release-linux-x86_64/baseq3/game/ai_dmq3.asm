@@ -0,0 +1,30796 @@
+export BotSetUserInfo
+code
+proc BotSetUserInfo 1024 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $57
+endproc BotSetUserInfo 1024 12
+export BotCTFCarryingFlag
+proc BotCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+EQI4 $59
+CNSTI4 0
+RETI4
+ADDRGP4 $58
+JUMPV
+LABELV $59
+ADDRFP4 0
+INDIRP4
+CNSTI4 5028
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $61
+CNSTI4 1
+RETI4
+ADDRGP4 $58
+JUMPV
+LABELV $61
+ADDRFP4 0
+INDIRP4
+CNSTI4 5032
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $63
+CNSTI4 2
+RETI4
+ADDRGP4 $58
+JUMPV
+LABELV $63
+CNSTI4 0
+RETI4
+LABELV $58
+endproc BotCTFCarryingFlag 0 0
+export BotTeam
+proc BotTeam 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $68
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $66
+LABELV $68
+CNSTI4 0
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $66
+CNSTI4 888
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $69
+CNSTI4 1
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $69
+CNSTI4 888
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $71
+CNSTI4 2
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $71
+CNSTI4 0
+RETI4
+LABELV $65
+endproc BotTeam 4 0
+export BotOppositeTeam
+proc BotOppositeTeam 12 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $77
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $78
+ADDRGP4 $74
+JUMPV
+LABELV $77
+CNSTI4 2
+RETI4
+ADDRGP4 $73
+JUMPV
+LABELV $78
+CNSTI4 1
+RETI4
+ADDRGP4 $73
+JUMPV
+LABELV $74
+CNSTI4 0
+RETI4
+LABELV $73
+endproc BotOppositeTeam 12 4
+export BotEnemyFlag
+proc BotEnemyFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $80
+ADDRGP4 ctf_blueflag
+RETP4
+ADDRGP4 $79
+JUMPV
+LABELV $80
+ADDRGP4 ctf_redflag
+RETP4
+LABELV $79
+endproc BotEnemyFlag 4 4
+export BotTeamFlag
+proc BotTeamFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $83
+ADDRGP4 ctf_redflag
+RETP4
+ADDRGP4 $82
+JUMPV
+LABELV $83
+ADDRGP4 ctf_blueflag
+RETP4
+LABELV $82
+endproc BotTeamFlag 4 4
+export EntityIsDead
+proc EntityIsDead 516 8
+ADDRLP4 508
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+LTI4 $86
+ADDRLP4 508
+INDIRI4
+CNSTI4 64
+GEI4 $86
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 512
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+NEI4 $88
+CNSTI4 0
+RETI4
+ADDRGP4 $85
+JUMPV
+LABELV $88
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+EQI4 $90
+CNSTI4 1
+RETI4
+ADDRGP4 $85
+JUMPV
+LABELV $90
+LABELV $86
+CNSTI4 0
+RETI4
+LABELV $85
+endproc EntityIsDead 516 8
+export EntityCarriesFlag
+proc EntityCarriesFlag 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_REDFLAG
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $94
+CNSTI4 1
+RETI4
+ADDRGP4 $93
+JUMPV
+LABELV $94
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $96
+CNSTI4 1
+RETI4
+ADDRGP4 $93
+JUMPV
+LABELV $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $98
+CNSTI4 1
+RETI4
+ADDRGP4 $93
+JUMPV
+LABELV $98
+CNSTI4 0
+RETI4
+LABELV $93
+endproc EntityCarriesFlag 0 0
+export EntityIsInvisible
+proc EntityIsInvisible 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $101
+CNSTI4 0
+RETI4
+ADDRGP4 $100
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_INVIS
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $103
+CNSTI4 1
+RETI4
+ADDRGP4 $100
+JUMPV
+LABELV $103
+CNSTI4 0
+RETI4
+LABELV $100
+endproc EntityIsInvisible 4 4
+export EntityIsShooting
+proc EntityIsShooting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $106
+CNSTI4 1
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $106
+CNSTI4 0
+RETI4
+LABELV $105
+endproc EntityIsShooting 0 0
+export EntityIsChatting
+proc EntityIsChatting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $109
+CNSTI4 1
+RETI4
+ADDRGP4 $108
+JUMPV
+LABELV $109
+CNSTI4 0
+RETI4
+LABELV $108
+endproc EntityIsChatting 0 0
+export EntityHasQuad
+proc EntityHasQuad 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_QUAD
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $112
+CNSTI4 1
+RETI4
+ADDRGP4 $111
+JUMPV
+LABELV $112
+CNSTI4 0
+RETI4
+LABELV $111
+endproc EntityHasQuad 0 0
+export EntityHasKamikaze
+proc EntityHasKamikaze 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $115
+CNSTI4 1
+RETI4
+ADDRGP4 $114
+JUMPV
+LABELV $115
+CNSTI4 0
+RETI4
+LABELV $114
+endproc EntityHasKamikaze 0 0
+export EntityCarriesCubes
+proc EntityCarriesCubes 236 8
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+EQI4 $118
+CNSTI4 0
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+212
+INDIRI4
+CNSTI4 0
+LEI4 $120
+CNSTI4 1
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $120
+CNSTI4 0
+RETI4
+LABELV $117
+endproc EntityCarriesCubes 236 8
+export Bot1FCTFCarryingFlag
+proc Bot1FCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+EQI4 $124
+CNSTI4 0
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $126
+CNSTI4 1
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $126
+CNSTI4 0
+RETI4
+LABELV $123
+endproc Bot1FCTFCarryingFlag 0 0
+export BotHarvesterCarryingCubes
+proc BotHarvesterCarryingCubes 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+EQI4 $129
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $129
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $131
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $131
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $133
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $133
+CNSTI4 0
+RETI4
+LABELV $128
+endproc BotHarvesterCarryingCubes 0 0
+export BotRememberLastOrderedTask
+proc BotRememberLastOrderedTask 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $136
+ADDRGP4 $135
+JUMPV
+LABELV $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $135
+endproc BotRememberLastOrderedTask 16 12
+export BotSetTeamStatus
+proc BotSetTeamStatus 164 12
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+LTI4 $139
+ADDRLP4 144
+INDIRI4
+CNSTI4 13
+GTI4 $139
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $159-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $159
+address $140
+address $143
+address $149
+address $150
+address $151
+address $152
+address $153
+address $153
+address $154
+address $155
+address $156
+address $157
+address $158
+code
+LABELV $143
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 152
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 5
+EQI4 $148
+ADDRLP4 152
+INDIRI4
+CNSTI4 6
+NEI4 $147
+LABELV $148
+ADDRLP4 4
+ARGP4
+ADDRLP4 156
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $146
+LABELV $147
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $144
+ADDRLP4 4
+ARGP4
+ADDRLP4 160
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $144
+LABELV $146
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $144
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $149
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $150
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $151
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $152
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $153
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $154
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $155
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $156
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $157
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $158
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $139
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+LABELV $140
+ADDRGP4 $162
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+LABELV $138
+endproc BotSetTeamStatus 164 12
+export BotSetLastOrderedTask
+proc BotSetLastOrderedTask 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $164
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $166
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $169
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $172
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $172
+LABELV $169
+LABELV $166
+LABELV $164
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $174
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1133903872
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $176
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $178
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BotTeamFlag
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotEnemyFlag
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $180
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+LABELV $180
+LABELV $178
+LABELV $176
+CNSTI4 1
+RETI4
+ADDRGP4 $163
+JUMPV
+LABELV $174
+CNSTI4 0
+RETI4
+LABELV $163
+endproc BotSetLastOrderedTask 60 16
+export BotRefuseOrder
+proc BotRefuseOrder 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $183
+ADDRGP4 $182
+JUMPV
+LABELV $183
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $185
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+LEF4 $185
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2097152
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $187
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $185
+LABELV $182
+endproc BotRefuseOrder 8 12
+export BotCTFSeekGoals
+proc BotCTFSeekGoals 240 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $191
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+EQI4 $196
+ADDRLP4 180
+INDIRI4
+CNSTI4 2
+EQI4 $201
+ADDRGP4 $193
+JUMPV
+LABELV $196
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $194
+JUMPV
+LABELV $201
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRLP4 200
+CNSTF4 1148829696
+ASGNF4
+ADDRLP4 160
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 160+4
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 160+8
+CNSTF4 1148829696
+ASGNF4
+LABELV $194
+ADDRLP4 160
+ARGP4
+ADDRLP4 192
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 192
+INDIRF4
+CNSTF4 1124073472
+GEF4 $208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $209
+ADDRGP4 $162
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 196
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $210
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $188
+JUMPV
+LABELV $191
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $188
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+NEI4 $213
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $214
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $188
+JUMPV
+LABELV $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $217
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $217
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 180
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $219
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $219
+LABELV $217
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+NEI4 $221
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $222
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $223
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $231
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+ADDRGP4 ctf_redflag+44
+INDIRI4
+EQI4 $188
+ADDRLP4 196
+INDIRI4
+ADDRGP4 ctf_blueflag+44
+INDIRI4
+EQI4 $188
+LABELV $231
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRLP4 204
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+LTI4 $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $234
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ADDRLP4 204
+INDIRI4
+EQI4 $188
+LABELV $234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $235
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6908
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $223
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $236
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $188
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+LTI4 $240
+LABELV $240
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 4
+EQI4 $188
+ADDRLP4 196
+INDIRI4
+CNSTI4 6
+EQI4 $188
+ADDRLP4 196
+INDIRI4
+CNSTI4 1
+EQI4 $188
+ADDRLP4 196
+INDIRI4
+CNSTI4 2
+EQI4 $188
+ADDRLP4 196
+INDIRI4
+CNSTI4 8
+EQI4 $188
+ADDRLP4 196
+INDIRI4
+CNSTI4 9
+EQI4 $188
+ADDRLP4 196
+INDIRI4
+CNSTI4 10
+EQI4 $188
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 6
+ASGNI4
+LABELV $245
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $236
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $188
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 6
+EQI4 $188
+ADDRLP4 192
+INDIRI4
+CNSTI4 2
+EQI4 $188
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+LTI4 $252
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $235
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6908
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $252
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 204
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $246
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $254
+ADDRGP4 $188
+JUMPV
+LABELV $254
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $256
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $256
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+NEI4 $258
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $258
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $258
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+EQI4 $271
+ADDRLP4 204
+INDIRI4
+CNSTI4 2
+EQI4 $271
+ADDRLP4 204
+INDIRI4
+CNSTI4 3
+EQI4 $271
+ADDRLP4 204
+INDIRI4
+CNSTI4 4
+EQI4 $271
+ADDRLP4 204
+INDIRI4
+CNSTI4 5
+EQI4 $271
+ADDRLP4 204
+INDIRI4
+CNSTI4 6
+EQI4 $271
+ADDRLP4 204
+INDIRI4
+CNSTI4 8
+EQI4 $271
+ADDRLP4 204
+INDIRI4
+CNSTI4 9
+EQI4 $271
+ADDRLP4 204
+INDIRI4
+CNSTI4 10
+EQI4 $271
+ADDRLP4 204
+INDIRI4
+CNSTI4 14
+EQI4 $271
+ADDRLP4 204
+INDIRI4
+CNSTI4 15
+NEI4 $260
+LABELV $271
+ADDRGP4 $188
+JUMPV
+LABELV $260
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $272
+ADDRGP4 $188
+JUMPV
+LABELV $272
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $274
+ADDRGP4 $188
+JUMPV
+LABELV $274
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $276
+ADDRGP4 $188
+JUMPV
+LABELV $276
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 212
+INDIRF4
+CNSTF4 1112014848
+GEF4 $278
+ADDRGP4 $188
+JUMPV
+LABELV $278
+ADDRLP4 216
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 216
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $282
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $283
+JUMPV
+LABELV $282
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $283
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $281
+JUMPV
+LABELV $280
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $281
+ADDRLP4 220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 220
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $284
+ADDRLP4 224
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 224
+INDIRI4
+EQI4 $284
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 224
+INDIRI4
+EQI4 $284
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $285
+JUMPV
+LABELV $284
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $288
+ADDRLP4 228
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $288
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $288
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+NEI4 $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $293
+JUMPV
+LABELV $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $293
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6040
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $289
+LABELV $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $188
+endproc BotCTFSeekGoals 240 12
+export BotCTFRetreatGoals
+proc BotCTFRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $295
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $297
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $297
+LABELV $295
+LABELV $294
+endproc BotCTFRetreatGoals 8 4
+export Bot1FCTFSeekGoals
+proc Bot1FCTFSeekGoals 208 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $300
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $299
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $210
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $299
+JUMPV
+LABELV $300
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $304
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $304
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 164
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $306
+LABELV $304
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+LTI4 $314
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $235
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6908
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $299
+JUMPV
+LABELV $314
+LABELV $312
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 1
+EQI4 $327
+ADDRLP4 164
+INDIRI4
+CNSTI4 2
+EQI4 $327
+ADDRLP4 164
+INDIRI4
+CNSTI4 3
+EQI4 $327
+ADDRLP4 164
+INDIRI4
+CNSTI4 4
+EQI4 $327
+ADDRLP4 164
+INDIRI4
+CNSTI4 5
+EQI4 $327
+ADDRLP4 164
+INDIRI4
+CNSTI4 8
+EQI4 $327
+ADDRLP4 164
+INDIRI4
+CNSTI4 9
+EQI4 $327
+ADDRLP4 164
+INDIRI4
+CNSTI4 13
+EQI4 $327
+ADDRLP4 164
+INDIRI4
+CNSTI4 10
+EQI4 $327
+ADDRLP4 164
+INDIRI4
+CNSTI4 14
+EQI4 $327
+ADDRLP4 164
+INDIRI4
+CNSTI4 15
+NEI4 $316
+LABELV $327
+ADDRGP4 $299
+JUMPV
+LABELV $316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 13
+EQI4 $299
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+NEI4 $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $331
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $299
+JUMPV
+LABELV $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $332
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $299
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+LTI4 $336
+LABELV $336
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+EQI4 $343
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+EQI4 $343
+ADDRLP4 168
+INDIRI4
+CNSTI4 8
+EQI4 $343
+ADDRLP4 168
+INDIRI4
+CNSTI4 9
+EQI4 $343
+ADDRLP4 168
+INDIRI4
+CNSTI4 10
+NEI4 $338
+LABELV $343
+ADDRGP4 $299
+JUMPV
+LABELV $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $299
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+NEI4 $346
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $347
+JUMPV
+LABELV $346
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $347
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6040
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $299
+JUMPV
+LABELV $332
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $348
+ADDRGP4 $299
+JUMPV
+LABELV $348
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $350
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $350
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $352
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $352
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $352
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+EQI4 $366
+ADDRLP4 176
+INDIRI4
+CNSTI4 2
+EQI4 $366
+ADDRLP4 176
+INDIRI4
+CNSTI4 3
+EQI4 $366
+ADDRLP4 176
+INDIRI4
+CNSTI4 4
+EQI4 $366
+ADDRLP4 176
+INDIRI4
+CNSTI4 5
+EQI4 $366
+ADDRLP4 176
+INDIRI4
+CNSTI4 6
+EQI4 $366
+ADDRLP4 176
+INDIRI4
+CNSTI4 8
+EQI4 $366
+ADDRLP4 176
+INDIRI4
+CNSTI4 9
+EQI4 $366
+ADDRLP4 176
+INDIRI4
+CNSTI4 13
+EQI4 $366
+ADDRLP4 176
+INDIRI4
+CNSTI4 10
+EQI4 $366
+ADDRLP4 176
+INDIRI4
+CNSTI4 14
+EQI4 $366
+ADDRLP4 176
+INDIRI4
+CNSTI4 15
+NEI4 $354
+LABELV $366
+ADDRGP4 $299
+JUMPV
+LABELV $354
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $367
+ADDRGP4 $299
+JUMPV
+LABELV $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $369
+ADDRGP4 $299
+JUMPV
+LABELV $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $371
+ADDRGP4 $299
+JUMPV
+LABELV $371
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 1112014848
+GEF4 $373
+ADDRGP4 $299
+JUMPV
+LABELV $373
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 188
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $375
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $377
+ADDRLP4 4
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRLP4 4
+CNSTF4 1045220557
+ASGNF4
+LABELV $378
+ADDRLP4 8
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $376
+JUMPV
+LABELV $375
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+LABELV $376
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 192
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $379
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+CNSTI4 0
+EQI4 $379
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $382
+ADDRLP4 196
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $382
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $382
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+NEI4 $386
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $387
+JUMPV
+LABELV $386
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $387
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6040
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $383
+JUMPV
+LABELV $382
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $383
+LABELV $380
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $299
+endproc Bot1FCTFSeekGoals 208 12
+export Bot1FCTFRetreatGoals
+proc Bot1FCTFRetreatGoals 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $391
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $391
+LABELV $389
+LABELV $388
+endproc Bot1FCTFRetreatGoals 12 8
+export BotObeliskSeekGoals
+proc BotObeliskSeekGoals 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $394
+ADDRGP4 $393
+JUMPV
+LABELV $394
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $396
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $396
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $410
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $410
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+EQI4 $410
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+EQI4 $410
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+EQI4 $410
+ADDRLP4 16
+INDIRI4
+CNSTI4 6
+EQI4 $410
+ADDRLP4 16
+INDIRI4
+CNSTI4 8
+EQI4 $410
+ADDRLP4 16
+INDIRI4
+CNSTI4 9
+EQI4 $410
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $410
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+EQI4 $410
+ADDRLP4 16
+INDIRI4
+CNSTI4 14
+EQI4 $410
+ADDRLP4 16
+INDIRI4
+CNSTI4 15
+NEI4 $398
+LABELV $410
+ADDRGP4 $393
+JUMPV
+LABELV $398
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $411
+ADDRGP4 $393
+JUMPV
+LABELV $411
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $413
+ADDRGP4 $393
+JUMPV
+LABELV $413
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1112014848
+GEF4 $415
+ADDRGP4 $393
+JUMPV
+LABELV $415
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $419
+ADDRLP4 4
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $420
+JUMPV
+LABELV $419
+ADDRLP4 4
+CNSTF4 1045220557
+ASGNF4
+LABELV $420
+ADDRLP4 8
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $418
+JUMPV
+LABELV $417
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+LABELV $418
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $421
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $421
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+NEI4 $425
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $426
+JUMPV
+LABELV $425
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $426
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $422
+JUMPV
+LABELV $421
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $427
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $427
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $427
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+NEI4 $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $432
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6040
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $428
+JUMPV
+LABELV $427
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $428
+LABELV $422
+LABELV $393
+endproc BotObeliskSeekGoals 52 12
+export BotGoHarvest
+proc BotGoHarvest 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $435
+JUMPV
+LABELV $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6056
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $433
+endproc BotGoHarvest 4 12
+export BotObeliskRetreatGoals
+proc BotObeliskRetreatGoals 0 0
+LABELV $436
+endproc BotObeliskRetreatGoals 0 0
+export BotHarvesterSeekGoals
+proc BotHarvesterSeekGoals 208 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $438
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $437
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $437
+JUMPV
+LABELV $438
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $442
+ADDRGP4 $437
+JUMPV
+LABELV $442
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 168
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $446
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $446
+LABELV $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $448
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $448
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+EQI4 $461
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+EQI4 $461
+ADDRLP4 168
+INDIRI4
+CNSTI4 3
+EQI4 $461
+ADDRLP4 168
+INDIRI4
+CNSTI4 4
+EQI4 $461
+ADDRLP4 168
+INDIRI4
+CNSTI4 8
+EQI4 $461
+ADDRLP4 168
+INDIRI4
+CNSTI4 9
+EQI4 $461
+ADDRLP4 168
+INDIRI4
+CNSTI4 13
+EQI4 $461
+ADDRLP4 168
+INDIRI4
+CNSTI4 12
+EQI4 $461
+ADDRLP4 168
+INDIRI4
+CNSTI4 10
+EQI4 $461
+ADDRLP4 168
+INDIRI4
+CNSTI4 14
+EQI4 $461
+ADDRLP4 168
+INDIRI4
+CNSTI4 15
+NEI4 $450
+LABELV $461
+ADDRGP4 $437
+JUMPV
+LABELV $450
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $462
+ADDRGP4 $437
+JUMPV
+LABELV $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $464
+ADDRGP4 $437
+JUMPV
+LABELV $464
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1112014848
+GEF4 $466
+ADDRGP4 $437
+JUMPV
+LABELV $466
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $468
+LABELV $468
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $470
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotTeamCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $472
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $235
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6908
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $437
+JUMPV
+LABELV $472
+LABELV $470
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $476
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $477
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $475
+JUMPV
+LABELV $474
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $475
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 188
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $478
+ADDRLP4 192
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 192
+INDIRI4
+EQI4 $478
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 192
+INDIRI4
+EQI4 $478
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+ADDRGP4 $479
+JUMPV
+LABELV $478
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $482
+ADDRLP4 196
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $482
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+NEI4 $486
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $487
+JUMPV
+LABELV $486
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $487
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6040
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $483
+JUMPV
+LABELV $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $483
+LABELV $479
+LABELV $437
+endproc BotHarvesterSeekGoals 208 12
+export BotHarvesterRetreatGoals
+proc BotHarvesterRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $488
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $489
+LABELV $488
+endproc BotHarvesterRetreatGoals 8 4
+export BotTeamGoals
+proc BotTeamGoals 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $494
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $496
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $495
+JUMPV
+LABELV $496
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $498
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $495
+JUMPV
+LABELV $498
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $500
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskRetreatGoals
+CALLV
+pop
+ADDRGP4 $495
+JUMPV
+LABELV $500
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $495
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterRetreatGoals
+CALLV
+pop
+ADDRGP4 $495
+JUMPV
+LABELV $494
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $504
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFSeekGoals
+CALLV
+pop
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $506
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFSeekGoals
+CALLV
+pop
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $508
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskSeekGoals
+CALLV
+pop
+ADDRGP4 $509
+JUMPV
+LABELV $508
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $510
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterSeekGoals
+CALLV
+pop
+LABELV $510
+LABELV $509
+LABELV $507
+LABELV $505
+LABELV $495
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $493
+endproc BotTeamGoals 0 4
+export BotPointAreaNum
+proc BotPointAreaNum 68 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $513
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $512
+JUMPV
+LABELV $513
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $516
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $512
+JUMPV
+LABELV $516
+CNSTI4 0
+RETI4
+LABELV $512
+endproc BotPointAreaNum 68 20
+export ClientName
+proc ClientName 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $521
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $519
+LABELV $521
+CNSTI4 3
+ARGI4
+ADDRGP4 $522
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $523
+RETP4
+ADDRGP4 $518
+JUMPV
+LABELV $519
+ADDRFP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $524
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $518
+endproc ClientName 1032 12
+export ClientSkin
+proc ClientSkin 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $528
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $526
+LABELV $528
+CNSTI4 3
+ARGI4
+ADDRGP4 $529
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $523
+RETP4
+ADDRGP4 $525
+JUMPV
+LABELV $526
+ADDRFP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $525
+endproc ClientSkin 1032 12
+export ClientFromName
+proc ClientFromName 1036 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 $535
+JUMPV
+LABELV $532
+ADDRLP4 1024
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $524
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $537
+ADDRLP4 1024
+INDIRI4
+RETI4
+ADDRGP4 $531
+JUMPV
+LABELV $537
+LABELV $533
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $535
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $532
+CNSTI4 -1
+RETI4
+LABELV $531
+endproc ClientFromName 1036 12
+export ClientOnSameTeamFromName
+proc ClientOnSameTeamFromName 1040 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $543
+JUMPV
+LABELV $540
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $545
+ADDRGP4 $541
+JUMPV
+LABELV $545
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $524
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $547
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $539
+JUMPV
+LABELV $547
+LABELV $541
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $543
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $540
+CNSTI4 -1
+RETI4
+LABELV $539
+endproc ClientOnSameTeamFromName 1040 12
+export stristr
+proc stristr 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $556
+JUMPV
+LABELV $553
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $557
+ADDRGP4 $555
+JUMPV
+LABELV $557
+LABELV $554
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $556
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $559
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+NEI4 $553
+LABELV $559
+LABELV $555
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $560
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $549
+JUMPV
+LABELV $560
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $551
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $550
+CNSTP4 0
+RETP4
+LABELV $549
+endproc stristr 12 4
+lit
+align 1
+LABELV $563
+byte 1 0
+skip 127
+export EasyClientName
+code
+proc EasyClientName 196 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ADDRGP4 $563
+INDIRB
+ASGNB 128
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 5
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $567
+JUMPV
+LABELV $564
+ADDRLP4 148
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVII1 4
+ASGNI1
+LABELV $565
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $567
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $564
+ADDRLP4 5
+ARGP4
+ADDRGP4 $572
+ARGP4
+ADDRLP4 152
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRGP4 $571
+JUMPV
+LABELV $568
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 156
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $569
+ADDRLP4 5
+ARGP4
+ADDRGP4 $572
+ARGP4
+ADDRLP4 156
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+LABELV $571
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $568
+ADDRLP4 5
+ARGP4
+ADDRGP4 $573
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ARGP4
+ADDRGP4 $574
+ARGP4
+ADDRLP4 164
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 168
+CNSTU4 0
+ASGNU4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+ADDRLP4 168
+INDIRU4
+EQU4 $575
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 168
+INDIRU4
+EQU4 $575
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+LEU4 $577
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 172
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 176
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $578
+LABELV $575
+ADDRLP4 172
+ADDRLP4 5
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 109
+EQI4 $583
+ADDRLP4 172
+INDIRI4
+CNSTI4 77
+NEI4 $579
+LABELV $583
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 114
+EQI4 $584
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 82
+NEI4 $579
+LABELV $584
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5
+ARGP4
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 176
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $579
+ADDRLP4 0
+ADDRLP4 5
+ASGNP4
+ADDRGP4 $588
+JUMPV
+LABELV $587
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 176
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 97
+LTI4 $593
+ADDRLP4 176
+INDIRI4
+CNSTI4 122
+LEI4 $594
+LABELV $593
+ADDRLP4 180
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 48
+LTI4 $595
+ADDRLP4 180
+INDIRI4
+CNSTI4 57
+LEI4 $594
+LABELV $595
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 95
+NEI4 $590
+LABELV $594
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $591
+JUMPV
+LABELV $590
+ADDRLP4 184
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 65
+LTI4 $596
+ADDRLP4 184
+INDIRI4
+CNSTI4 90
+GTI4 $596
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $597
+JUMPV
+LABELV $596
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $597
+LABELV $591
+LABELV $588
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $587
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 5
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $562
+endproc EasyClientName 196 12
+export BotSynonymContext
+proc BotSynonymContext 12 4
+ADDRLP4 0
+CNSTI4 1027
+ASGNI4
+ADDRLP4 4
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+EQI4 $601
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+NEI4 $599
+LABELV $601
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $602
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $602
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $599
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $604
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $606
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $605
+JUMPV
+LABELV $606
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRGP4 $605
+JUMPV
+LABELV $604
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $608
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $610
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $610
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $611
+LABELV $608
+LABELV $605
+LABELV $600
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $598
+endproc BotSynonymContext 12 4
+export BotChooseWeapon
+proc BotChooseWeapon 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $615
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $613
+LABELV $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRGP4 $614
+JUMPV
+LABELV $613
+ADDRFP4 0
+INDIRP4
+CNSTI4 6428
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4848
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_BotChooseBestFightWeapon
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $616
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $616
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+LABELV $614
+LABELV $612
+endproc BotChooseWeapon 20 8
+export BotSetupForMovement
+proc BotSetupForMovement 92 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 68
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+36
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+44
+ADDRFP4 0
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $630
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $630
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 80
+INDIRI4
+EQI4 $633
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $633
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $633
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 88
+INDIRI4
+EQI4 $636
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LEI4 $636
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $636
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $639
+ADDRLP4 0+48
+CNSTI4 4
+ASGNI4
+ADDRGP4 $640
+JUMPV
+LABELV $639
+ADDRLP4 0+48
+CNSTI4 2
+ASGNI4
+LABELV $640
+ADDRFP4 0
+INDIRP4
+CNSTI4 5952
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+LEF4 $643
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $643
+ADDRLP4 0+52
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotInitMoveState
+CALLV
+pop
+LABELV $618
+endproc BotSetupForMovement 92 12
+export BotCheckItemPickup
+proc BotCheckItemPickup 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GTI4 $648
+ADDRGP4 $647
+JUMPV
+LABELV $648
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $650
+ADDRFP4 0
+INDIRP4
+CNSTI4 4976
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $650
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $650
+ADDRFP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $652
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $652
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $652
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4976
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $654
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $654
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $656
+ADDRFP4 0
+INDIRP4
+CNSTI4 5012
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $656
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $656
+ADDRFP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $658
+ADDRFP4 0
+INDIRP4
+CNSTI4 5016
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $658
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $658
+ADDRFP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 5020
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $660
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $660
+ADDRFP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $662
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $662
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $662
+LABELV $654
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $664
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $666
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $668
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $670
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $672
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $671
+JUMPV
+LABELV $670
+ADDRGP4 g_spSkill+12
+INDIRI4
+CNSTI4 3
+GTI4 $673
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+EQI4 $676
+ADDRLP4 24
+INDIRI4
+CNSTI4 13
+EQI4 $676
+ADDRLP4 24
+INDIRI4
+CNSTI4 12
+EQI4 $676
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $680
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $678
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $678
+LABELV $680
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $681
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $678
+LABELV $681
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $672
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $678
+LABELV $676
+LABELV $673
+LABELV $671
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $668
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 $667
+JUMPV
+LABELV $666
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $682
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $684
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $686
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $685
+JUMPV
+LABELV $684
+ADDRGP4 g_spSkill+12
+INDIRI4
+CNSTI4 3
+GTI4 $687
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $690
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $694
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $692
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $692
+LABELV $694
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $695
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $692
+LABELV $695
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $686
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $692
+LABELV $690
+LABELV $687
+LABELV $685
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $682
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $667
+LABELV $664
+LABELV $647
+endproc BotCheckItemPickup 36 12
+export BotUpdateInventory
+proc BotUpdateInventory 1336 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4848
+ADDP4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4852
+ADDP4
+ADDRGP4 STAT_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+CNSTI4 2
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $698
+ADDRLP4 1028
+CNSTI4 1
+ASGNI4
+ADDRGP4 $699
+JUMPV
+LABELV $698
+ADDRLP4 1028
+CNSTI4 0
+ASGNI4
+LABELV $699
+ADDRFP4 0
+INDIRP4
+CNSTI4 4864
+ADDP4
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $701
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+ADDRGP4 $702
+JUMPV
+LABELV $701
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+LABELV $702
+ADDRFP4 0
+INDIRP4
+CNSTI4 4868
+ADDP4
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $704
+ADDRLP4 1048
+CNSTI4 1
+ASGNI4
+ADDRGP4 $705
+JUMPV
+LABELV $704
+ADDRLP4 1048
+CNSTI4 0
+ASGNI4
+LABELV $705
+ADDRFP4 0
+INDIRP4
+CNSTI4 4872
+ADDP4
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $707
+ADDRLP4 1056
+CNSTI4 1
+ASGNI4
+ADDRGP4 $708
+JUMPV
+LABELV $707
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+LABELV $708
+ADDRFP4 0
+INDIRP4
+CNSTI4 4876
+ADDP4
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $710
+ADDRLP4 1064
+CNSTI4 1
+ASGNI4
+ADDRGP4 $711
+JUMPV
+LABELV $710
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+LABELV $711
+ADDRFP4 0
+INDIRP4
+CNSTI4 4880
+ADDP4
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $713
+ADDRLP4 1072
+CNSTI4 1
+ASGNI4
+ADDRGP4 $714
+JUMPV
+LABELV $713
+ADDRLP4 1072
+CNSTI4 0
+ASGNI4
+LABELV $714
+ADDRFP4 0
+INDIRP4
+CNSTI4 4884
+ADDP4
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $716
+ADDRLP4 1080
+CNSTI4 1
+ASGNI4
+ADDRGP4 $717
+JUMPV
+LABELV $716
+ADDRLP4 1080
+CNSTI4 0
+ASGNI4
+LABELV $717
+ADDRFP4 0
+INDIRP4
+CNSTI4 4888
+ADDP4
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $719
+ADDRLP4 1088
+CNSTI4 1
+ASGNI4
+ADDRGP4 $720
+JUMPV
+LABELV $719
+ADDRLP4 1088
+CNSTI4 0
+ASGNI4
+LABELV $720
+ADDRFP4 0
+INDIRP4
+CNSTI4 4892
+ADDP4
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $722
+ADDRLP4 1096
+CNSTI4 1
+ASGNI4
+ADDRGP4 $723
+JUMPV
+LABELV $722
+ADDRLP4 1096
+CNSTI4 0
+ASGNI4
+LABELV $723
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $725
+ADDRLP4 1104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $726
+JUMPV
+LABELV $725
+ADDRLP4 1104
+CNSTI4 0
+ASGNI4
+LABELV $726
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $728
+ADDRLP4 1112
+CNSTI4 1
+ASGNI4
+ADDRGP4 $729
+JUMPV
+LABELV $728
+ADDRLP4 1112
+CNSTI4 0
+ASGNI4
+LABELV $729
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $731
+ADDRLP4 1120
+CNSTI4 1
+ASGNI4
+ADDRGP4 $732
+JUMPV
+LABELV $731
+ADDRLP4 1120
+CNSTI4 0
+ASGNI4
+LABELV $732
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+ADDRLP4 1120
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $734
+ADDRLP4 1128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $735
+JUMPV
+LABELV $734
+ADDRLP4 1128
+CNSTI4 0
+ASGNI4
+LABELV $735
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+ADDRLP4 1128
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4920
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4924
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 400
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4928
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 408
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4932
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4960
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_HOLDABLE_ITEM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 26
+NEI4 $737
+ADDRLP4 1184
+CNSTI4 1
+ASGNI4
+ADDRGP4 $738
+JUMPV
+LABELV $737
+ADDRLP4 1184
+CNSTI4 0
+ASGNI4
+LABELV $738
+ADDRFP4 0
+INDIRP4
+CNSTI4 4968
+ADDP4
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_HOLDABLE_ITEM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 27
+NEI4 $740
+ADDRLP4 1192
+CNSTI4 1
+ASGNI4
+ADDRGP4 $741
+JUMPV
+LABELV $740
+ADDRLP4 1192
+CNSTI4 0
+ASGNI4
+LABELV $741
+ADDRFP4 0
+INDIRP4
+CNSTI4 4972
+ADDP4
+ADDRLP4 1192
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_HOLDABLE_ITEM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 36
+NEI4 $743
+ADDRLP4 1200
+CNSTI4 1
+ASGNI4
+ADDRGP4 $744
+JUMPV
+LABELV $743
+ADDRLP4 1200
+CNSTI4 0
+ASGNI4
+LABELV $744
+ADDRFP4 0
+INDIRP4
+CNSTI4 4976
+ADDP4
+ADDRLP4 1200
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_HOLDABLE_ITEM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 37
+NEI4 $746
+ADDRLP4 1208
+CNSTI4 1
+ASGNI4
+ADDRGP4 $747
+JUMPV
+LABELV $746
+ADDRLP4 1208
+CNSTI4 0
+ASGNI4
+LABELV $747
+ADDRFP4 0
+INDIRP4
+CNSTI4 4980
+ADDP4
+ADDRLP4 1208
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_HOLDABLE_ITEM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 38
+NEI4 $749
+ADDRLP4 1216
+CNSTI4 1
+ASGNI4
+ADDRGP4 $750
+JUMPV
+LABELV $749
+ADDRLP4 1216
+CNSTI4 0
+ASGNI4
+LABELV $750
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+ADDRLP4 1216
+INDIRI4
+ASGNI4
+ADDRGP4 PW_QUAD
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 328
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $752
+ADDRLP4 1224
+CNSTI4 1
+ASGNI4
+ADDRGP4 $753
+JUMPV
+LABELV $752
+ADDRLP4 1224
+CNSTI4 0
+ASGNI4
+LABELV $753
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+ADDRLP4 1224
+INDIRI4
+ASGNI4
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 328
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $755
+ADDRLP4 1232
+CNSTI4 1
+ASGNI4
+ADDRGP4 $756
+JUMPV
+LABELV $755
+ADDRLP4 1232
+CNSTI4 0
+ASGNI4
+LABELV $756
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRGP4 PW_HASTE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 328
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $758
+ADDRLP4 1240
+CNSTI4 1
+ASGNI4
+ADDRGP4 $759
+JUMPV
+LABELV $758
+ADDRLP4 1240
+CNSTI4 0
+ASGNI4
+LABELV $759
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+ADDRLP4 1240
+INDIRI4
+ASGNI4
+ADDRGP4 PW_INVIS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 328
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $761
+ADDRLP4 1248
+CNSTI4 1
+ASGNI4
+ADDRGP4 $762
+JUMPV
+LABELV $761
+ADDRLP4 1248
+CNSTI4 0
+ASGNI4
+LABELV $762
+ADDRFP4 0
+INDIRP4
+CNSTI4 5000
+ADDP4
+ADDRLP4 1248
+INDIRI4
+ASGNI4
+ADDRGP4 PW_REGEN
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 328
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $764
+ADDRLP4 1256
+CNSTI4 1
+ASGNI4
+ADDRGP4 $765
+JUMPV
+LABELV $764
+ADDRLP4 1256
+CNSTI4 0
+ASGNI4
+LABELV $765
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+ADDRLP4 1256
+INDIRI4
+ASGNI4
+ADDRGP4 PW_FLIGHT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 328
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $767
+ADDRLP4 1264
+CNSTI4 1
+ASGNI4
+ADDRGP4 $768
+JUMPV
+LABELV $767
+ADDRLP4 1264
+CNSTI4 0
+ASGNI4
+LABELV $768
+ADDRFP4 0
+INDIRP4
+CNSTI4 5008
+ADDP4
+ADDRLP4 1264
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 42
+NEI4 $770
+ADDRLP4 1272
+CNSTI4 1
+ASGNI4
+ADDRGP4 $771
+JUMPV
+LABELV $770
+ADDRLP4 1272
+CNSTI4 0
+ASGNI4
+LABELV $771
+ADDRFP4 0
+INDIRP4
+CNSTI4 5012
+ADDP4
+ADDRLP4 1272
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 43
+NEI4 $773
+ADDRLP4 1280
+CNSTI4 1
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $773
+ADDRLP4 1280
+CNSTI4 0
+ASGNI4
+LABELV $774
+ADDRFP4 0
+INDIRP4
+CNSTI4 5016
+ADDP4
+ADDRLP4 1280
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 44
+NEI4 $776
+ADDRLP4 1288
+CNSTI4 1
+ASGNI4
+ADDRGP4 $777
+JUMPV
+LABELV $776
+ADDRLP4 1288
+CNSTI4 0
+ASGNI4
+LABELV $777
+ADDRFP4 0
+INDIRP4
+CNSTI4 5020
+ADDP4
+ADDRLP4 1288
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 45
+NEI4 $779
+ADDRLP4 1296
+CNSTI4 1
+ASGNI4
+ADDRGP4 $780
+JUMPV
+LABELV $779
+ADDRLP4 1296
+CNSTI4 0
+ASGNI4
+LABELV $780
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+ADDRLP4 1296
+INDIRI4
+ASGNI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 328
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $782
+ADDRLP4 1304
+CNSTI4 1
+ASGNI4
+ADDRGP4 $783
+JUMPV
+LABELV $782
+ADDRLP4 1304
+CNSTI4 0
+ASGNI4
+LABELV $783
+ADDRFP4 0
+INDIRP4
+CNSTI4 5028
+ADDP4
+ADDRLP4 1304
+INDIRI4
+ASGNI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 328
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $785
+ADDRLP4 1312
+CNSTI4 1
+ASGNI4
+ADDRGP4 $786
+JUMPV
+LABELV $785
+ADDRLP4 1312
+CNSTI4 0
+ASGNI4
+LABELV $786
+ADDRFP4 0
+INDIRP4
+CNSTI4 5032
+ADDP4
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 328
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $788
+ADDRLP4 1320
+CNSTI4 1
+ASGNI4
+ADDRGP4 $789
+JUMPV
+LABELV $788
+ADDRLP4 1320
+CNSTI4 0
+ASGNI4
+LABELV $789
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+ADDRLP4 1320
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1328
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 1
+NEI4 $790
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $791
+JUMPV
+LABELV $790
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $791
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckItemPickup
+CALLV
+pop
+LABELV $696
+endproc BotUpdateInventory 1336 12
+export BotUpdateBattleInventory
+proc BotUpdateBattleInventory 160 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5652
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5648
+ADDP4
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $792
+endproc BotUpdateBattleInventory 160 8
+export BotUseKamikaze
+proc BotUseKamikaze 288 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4976
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $803
+ADDRGP4 $802
+JUMPV
+LABELV $803
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $805
+ADDRGP4 $802
+JUMPV
+LABELV $805
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $807
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $809
+ADDRGP4 $802
+JUMPV
+LABELV $809
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $811
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 276
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 1233125376
+GEF4 $820
+ADDRGP4 $802
+JUMPV
+LABELV $820
+LABELV $811
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $808
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 280
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 280
+INDIRF4
+CNSTF4 1233125376
+GEF4 $808
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $802
+JUMPV
+LABELV $807
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $833
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $835
+ADDRGP4 $802
+JUMPV
+LABELV $835
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $837
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 276
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 1233125376
+GEF4 $846
+ADDRGP4 $802
+JUMPV
+LABELV $846
+LABELV $837
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $834
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 280
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 280
+INDIRF4
+CNSTF4 1233125376
+GEF4 $834
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $802
+JUMPV
+LABELV $833
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $859
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+EQI4 $864
+ADDRGP4 $861
+JUMPV
+LABELV $864
+ADDRLP4 176
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $862
+JUMPV
+LABELV $861
+ADDRLP4 176
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $862
+ADDRLP4 164
+ADDRLP4 176
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ADDRLP4 164+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ADDRLP4 164+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 276
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 1229937705
+GEF4 $860
+ADDRLP4 180
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 284
+CNSTP4 0
+ASGNP4
+ADDRLP4 284
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRP4
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 180+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $876
+ADDRLP4 180+80
+INDIRI4
+ADDRLP4 176
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $860
+LABELV $876
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $802
+JUMPV
+LABELV $859
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $877
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $879
+ADDRGP4 $802
+JUMPV
+LABELV $879
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotTeamCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $881
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 276
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 1233125376
+GEF4 $890
+ADDRGP4 $802
+JUMPV
+LABELV $890
+LABELV $881
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $892
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 280
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 280
+INDIRF4
+CNSTF4 1233125376
+GEF4 $901
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $802
+JUMPV
+LABELV $901
+LABELV $892
+LABELV $877
+LABELV $860
+LABELV $834
+LABELV $808
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 156
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotVisibleTeamMatesAndEnemies
+CALLV
+pop
+ADDRLP4 264
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 2
+LEI4 $903
+ADDRLP4 264
+INDIRI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $903
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $903
+LABELV $802
+endproc BotUseKamikaze 288 28
+export BotUseInvulnerability
+proc BotUseInvulnerability 148 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $906
+ADDRGP4 $905
+JUMPV
+LABELV $906
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $908
+ADDRGP4 $905
+JUMPV
+LABELV $908
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $910
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+EQI4 $912
+ADDRGP4 $905
+JUMPV
+LABELV $912
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $914
+ADDRGP4 $905
+JUMPV
+LABELV $914
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+EQI4 $919
+ADDRGP4 $916
+JUMPV
+LABELV $919
+ADDRLP4 28
+ADDRGP4 ctf_blueflag
+ASGNP4
+ADDRGP4 $917
+JUMPV
+LABELV $916
+ADDRLP4 28
+ADDRGP4 ctf_redflag
+ASGNP4
+LABELV $917
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 136
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+CNSTF4 1193033728
+GEF4 $911
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 144
+CNSTP4 0
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $931
+ADDRLP4 32+80
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $911
+LABELV $931
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $905
+JUMPV
+LABELV $910
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $932
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+EQI4 $934
+ADDRGP4 $905
+JUMPV
+LABELV $934
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $936
+ADDRGP4 $905
+JUMPV
+LABELV $936
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+EQI4 $941
+ADDRGP4 $938
+JUMPV
+LABELV $941
+ADDRLP4 28
+ADDRGP4 ctf_blueflag
+ASGNP4
+ADDRGP4 $939
+JUMPV
+LABELV $938
+ADDRLP4 28
+ADDRGP4 ctf_redflag
+ASGNP4
+LABELV $939
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 136
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+CNSTF4 1193033728
+GEF4 $933
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 144
+CNSTP4 0
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $953
+ADDRLP4 32+80
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $933
+LABELV $953
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $905
+JUMPV
+LABELV $932
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $954
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 116
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+EQI4 $959
+ADDRGP4 $956
+JUMPV
+LABELV $959
+ADDRLP4 28
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $957
+JUMPV
+LABELV $956
+ADDRLP4 28
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $957
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 128
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+CNSTF4 1202702336
+GEF4 $955
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 136
+CNSTP4 0
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $971
+ADDRLP4 32+80
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $955
+LABELV $971
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $905
+JUMPV
+LABELV $954
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+EQI4 $974
+ADDRGP4 $905
+JUMPV
+LABELV $974
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $976
+ADDRGP4 $905
+JUMPV
+LABELV $976
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+EQI4 $981
+ADDRGP4 $978
+JUMPV
+LABELV $981
+ADDRLP4 28
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $979
+JUMPV
+LABELV $978
+ADDRLP4 28
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $979
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 136
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+CNSTF4 1193033728
+GEF4 $973
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 144
+CNSTP4 0
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $993
+ADDRLP4 32+80
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $973
+LABELV $993
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $905
+JUMPV
+LABELV $972
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $973
+LABELV $955
+LABELV $933
+LABELV $911
+LABELV $905
+endproc BotUseInvulnerability 148 28
+export BotBattleUseItems
+proc BotBattleUseItems 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $995
+ADDRFP4 0
+INDIRP4
+CNSTI4 4968
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $997
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $999
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $999
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $999
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $999
+LABELV $997
+LABELV $995
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1001
+ADDRFP4 0
+INDIRP4
+CNSTI4 4972
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1003
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $1003
+LABELV $1001
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUseKamikaze
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUseInvulnerability
+CALLV
+pop
+LABELV $994
+endproc BotBattleUseItems 12 4
+export BotSetTeleportTime
+proc BotSetTeleportTime 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1006
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1006
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1005
+endproc BotSetTeleportTime 8 0
+export BotIsDead
+proc BotIsDead 4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1010
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1011
+JUMPV
+LABELV $1010
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1011
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1008
+endproc BotIsDead 4 0
+export BotIsObserver
+proc BotIsObserver 1032 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1013
+CNSTI4 1
+RETI4
+ADDRGP4 $1012
+JUMPV
+LABELV $1013
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1017
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+NEI4 $1015
+CNSTI4 1
+RETI4
+ADDRGP4 $1012
+JUMPV
+LABELV $1015
+CNSTI4 0
+RETI4
+LABELV $1012
+endproc BotIsObserver 1032 12
+export BotIntermission
+proc BotIntermission 8 0
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $1019
+CNSTI4 1
+RETI4
+ADDRGP4 $1018
+JUMPV
+LABELV $1019
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $1025
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $1023
+LABELV $1025
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1024
+JUMPV
+LABELV $1023
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1024
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1018
+endproc BotIntermission 8 0
+export BotInLavaOrSlime
+proc BotInLavaOrSlime 16 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1102577664
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+BANDI4
+RETI4
+LABELV $1026
+endproc BotInLavaOrSlime 16 4
+lit
+align 4
+LABELV $1029
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $1030
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCreateWayPoint
+code
+proc BotCreateWayPoint 32 12
+ADDRLP4 4
+ADDRGP4 $1029
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 $1030
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1031
+CNSTI4 2
+ARGI4
+ADDRGP4 $1033
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1028
+JUMPV
+LABELV $1031
+ADDRLP4 28
+ADDRGP4 botai_freewaypoints
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $1028
+endproc BotCreateWayPoint 32 12
+export BotFindWayPoint
+proc BotFindWayPoint 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1038
+JUMPV
+LABELV $1035
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1039
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $1034
+JUMPV
+LABELV $1039
+LABELV $1036
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1038
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1035
+CNSTP4 0
+RETP4
+LABELV $1034
+endproc BotFindWayPoint 8 8
+export BotFreeWaypoints
+proc BotFreeWaypoints 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1045
+JUMPV
+LABELV $1042
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1043
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $1045
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1042
+LABELV $1041
+endproc BotFreeWaypoints 8 0
+export BotInitWaypoints
+proc BotInitWaypoints 4 0
+ADDRGP4 botai_freewaypoints
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1047
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints+92
+ADDP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints
+ADDP4
+ASGNP4
+LABELV $1048
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $1047
+LABELV $1046
+endproc BotInitWaypoints 4 0
+export TeamPlayIsOn
+proc TeamPlayIsOn 4 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $1054
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1054
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1055
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1052
+endproc TeamPlayIsOn 4 0
+export BotAggression
+proc BotAggression 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1057
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1061
+ADDRFP4 0
+INDIRP4
+CNSTI4 5648
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1059
+LABELV $1061
+CNSTF4 1116471296
+RETF4
+ADDRGP4 $1056
+JUMPV
+LABELV $1059
+LABELV $1057
+ADDRFP4 0
+INDIRP4
+CNSTI4 5652
+ADDP4
+INDIRI4
+CNSTI4 200
+LEI4 $1062
+CNSTF4 0
+RETF4
+ADDRGP4 $1056
+JUMPV
+LABELV $1062
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1064
+CNSTF4 0
+RETF4
+ADDRGP4 $1056
+JUMPV
+LABELV $1064
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1066
+ADDRFP4 0
+INDIRP4
+CNSTI4 4852
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1068
+CNSTF4 0
+RETF4
+ADDRGP4 $1056
+JUMPV
+LABELV $1068
+LABELV $1066
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1070
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $1070
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1056
+JUMPV
+LABELV $1070
+ADDRFP4 0
+INDIRP4
+CNSTI4 4888
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1072
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1072
+CNSTF4 1119748096
+RETF4
+ADDRGP4 $1056
+JUMPV
+LABELV $1072
+ADDRFP4 0
+INDIRP4
+CNSTI4 4884
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1074
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1074
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $1056
+JUMPV
+LABELV $1074
+ADDRFP4 0
+INDIRP4
+CNSTI4 4880
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1076
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1076
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $1056
+JUMPV
+LABELV $1076
+ADDRFP4 0
+INDIRP4
+CNSTI4 4892
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1078
+ADDRFP4 0
+INDIRP4
+CNSTI4 4932
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1078
+CNSTF4 1118437376
+RETF4
+ADDRGP4 $1056
+JUMPV
+LABELV $1078
+ADDRFP4 0
+INDIRP4
+CNSTI4 4876
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1080
+ADDRFP4 0
+INDIRP4
+CNSTI4 4928
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $1080
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $1056
+JUMPV
+LABELV $1080
+ADDRFP4 0
+INDIRP4
+CNSTI4 4868
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1082
+ADDRFP4 0
+INDIRP4
+CNSTI4 4920
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $1082
+CNSTF4 1112014848
+RETF4
+ADDRGP4 $1056
+JUMPV
+LABELV $1082
+CNSTF4 0
+RETF4
+LABELV $1056
+endproc BotAggression 28 0
+export BotFeelingBad
+proc BotFeelingBad 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1085
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1084
+JUMPV
+LABELV $1085
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1087
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1084
+JUMPV
+LABELV $1087
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1089
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $1084
+JUMPV
+LABELV $1089
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1091
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $1084
+JUMPV
+LABELV $1091
+CNSTF4 0
+RETF4
+LABELV $1084
+endproc BotFeelingBad 0 0
+export BotWantsToRetreat
+proc BotWantsToRetreat 148 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $1094
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1095
+CNSTI4 1
+RETI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1094
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $1098
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1099
+CNSTI4 1
+RETI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1098
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $1102
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $1104
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1106
+ADDRLP4 140
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+EQI4 $1106
+CNSTI4 1
+RETI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1106
+LABELV $1104
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotFeelingBad
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1110
+CNSTI4 1
+RETI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1110
+CNSTI4 0
+RETI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1102
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $1112
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1114
+CNSTI4 1
+RETI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1114
+LABELV $1112
+LABELV $1099
+LABELV $1095
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1116
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1118
+CNSTI4 0
+RETI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1118
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1120
+CNSTI4 0
+RETI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1120
+LABELV $1116
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1122
+CNSTI4 1
+RETI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1122
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1112014848
+GEF4 $1124
+CNSTI4 1
+RETI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1124
+CNSTI4 0
+RETI4
+LABELV $1093
+endproc BotWantsToRetreat 148 8
+export BotWantsToChase
+proc BotWantsToChase 148 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $1127
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1129
+CNSTI4 0
+RETI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1129
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1128
+CNSTI4 1
+RETI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1127
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $1133
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1135
+CNSTI4 0
+RETI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1135
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1134
+CNSTI4 1
+RETI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1133
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $1139
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $1140
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1140
+ADDRLP4 140
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+EQI4 $1140
+CNSTI4 0
+RETI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1139
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $1147
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1149
+CNSTI4 0
+RETI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1149
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1151
+CNSTI4 1
+RETI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1151
+LABELV $1147
+LABELV $1140
+LABELV $1134
+LABELV $1128
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1153
+CNSTI4 0
+RETI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1153
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1155
+CNSTI4 1
+RETI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1155
+CNSTI4 0
+RETI4
+LABELV $1126
+endproc BotWantsToChase 148 8
+export BotWantsToHelp
+proc BotWantsToHelp 0 0
+CNSTI4 1
+RETI4
+LABELV $1157
+endproc BotWantsToHelp 0 0
+export BotCanAndWantsToRocketJump
+proc BotCanAndWantsToRocketJump 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_rocketjump+12
+INDIRI4
+CNSTI4 0
+NEI4 $1159
+CNSTI4 0
+RETI4
+ADDRGP4 $1158
+JUMPV
+LABELV $1159
+ADDRFP4 0
+INDIRP4
+CNSTI4 4880
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1162
+CNSTI4 0
+RETI4
+ADDRGP4 $1158
+JUMPV
+LABELV $1162
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRI4
+CNSTI4 3
+GEI4 $1164
+CNSTI4 0
+RETI4
+ADDRGP4 $1158
+JUMPV
+LABELV $1164
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1166
+CNSTI4 0
+RETI4
+ADDRGP4 $1158
+JUMPV
+LABELV $1166
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1168
+CNSTI4 0
+RETI4
+ADDRGP4 $1158
+JUMPV
+LABELV $1168
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+CNSTI4 90
+GEI4 $1170
+ADDRFP4 0
+INDIRP4
+CNSTI4 4852
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1172
+CNSTI4 0
+RETI4
+ADDRGP4 $1158
+JUMPV
+LABELV $1172
+LABELV $1170
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 38
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 4
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1174
+CNSTI4 0
+RETI4
+ADDRGP4 $1158
+JUMPV
+LABELV $1174
+CNSTI4 1
+RETI4
+LABELV $1158
+endproc BotCanAndWantsToRocketJump 8 16
+export BotHasPersistantPowerupAndWeapon
+proc BotHasPersistantPowerupAndWeapon 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5012
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1177
+ADDRFP4 0
+INDIRP4
+CNSTI4 5016
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1177
+ADDRFP4 0
+INDIRP4
+CNSTI4 5020
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1177
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1177
+CNSTI4 0
+RETI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1177
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1179
+CNSTI4 0
+RETI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1179
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1181
+ADDRFP4 0
+INDIRP4
+CNSTI4 4852
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1183
+CNSTI4 0
+RETI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1183
+LABELV $1181
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1185
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $1185
+CNSTI4 1
+RETI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1185
+ADDRFP4 0
+INDIRP4
+CNSTI4 4888
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1187
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1187
+CNSTI4 1
+RETI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1187
+ADDRFP4 0
+INDIRP4
+CNSTI4 4884
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1189
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1189
+CNSTI4 1
+RETI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1189
+ADDRFP4 0
+INDIRP4
+CNSTI4 4880
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1191
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1191
+CNSTI4 1
+RETI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1191
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1193
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1193
+CNSTI4 1
+RETI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1193
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1195
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1195
+CNSTI4 1
+RETI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1195
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1197
+ADDRFP4 0
+INDIRP4
+CNSTI4 4960
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1197
+CNSTI4 1
+RETI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1197
+ADDRFP4 0
+INDIRP4
+CNSTI4 4892
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1199
+ADDRFP4 0
+INDIRP4
+CNSTI4 4932
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1199
+CNSTI4 1
+RETI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1199
+CNSTI4 0
+RETI4
+LABELV $1176
+endproc BotHasPersistantPowerupAndWeapon 40 0
+export BotGoCamp
+proc BotGoCamp 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065185444
+LEF4 $1202
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1203982208
+ADDF4
+ASGNF4
+ADDRGP4 $1203
+JUMPV
+LABELV $1202
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+CNSTF4 1127481344
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1203
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $1201
+endproc BotGoCamp 16 16
+export BotWantsToCamp
+proc BotWantsToCamp 172 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 128
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1036831949
+GEF4 $1205
+CNSTI4 0
+RETI4
+ADDRGP4 $1204
+JUMPV
+LABELV $1205
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+EQI4 $1215
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+EQI4 $1215
+ADDRLP4 132
+INDIRI4
+CNSTI4 3
+EQI4 $1215
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+EQI4 $1215
+ADDRLP4 132
+INDIRI4
+CNSTI4 5
+EQI4 $1215
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+EQI4 $1215
+ADDRLP4 132
+INDIRI4
+CNSTI4 8
+EQI4 $1215
+ADDRLP4 132
+INDIRI4
+CNSTI4 9
+NEI4 $1207
+LABELV $1215
+CNSTI4 0
+RETI4
+ADDRGP4 $1204
+JUMPV
+LABELV $1207
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+CNSTF4 1133903872
+CNSTF4 1065353216
+ADDRLP4 124
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+LEF4 $1216
+CNSTI4 0
+RETI4
+ADDRGP4 $1204
+JUMPV
+LABELV $1216
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 124
+INDIRF4
+LEF4 $1218
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $1204
+JUMPV
+LABELV $1218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1112014848
+GEF4 $1220
+CNSTI4 0
+RETI4
+ADDRGP4 $1204
+JUMPV
+LABELV $1220
+ADDRFP4 0
+INDIRP4
+CNSTI4 4880
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1224
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $1222
+LABELV $1224
+ADDRFP4 0
+INDIRP4
+CNSTI4 4888
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1225
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $1222
+LABELV $1225
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1226
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $1222
+LABELV $1226
+CNSTI4 0
+RETI4
+ADDRGP4 $1204
+JUMPV
+LABELV $1222
+ADDRLP4 64
+CNSTI4 99999
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1227
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 164
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1232
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+GEI4 $1232
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1232
+LABELV $1228
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+LABELV $1230
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1227
+ADDRLP4 64
+INDIRI4
+CNSTI4 150
+LEI4 $1234
+CNSTI4 0
+RETI4
+ADDRGP4 $1204
+JUMPV
+LABELV $1234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 BotGoCamp
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $1204
+endproc BotWantsToCamp 172 16
+export BotDontAvoid
+proc BotDontAvoid 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $1237
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveFromAvoidGoals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $1238
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1237
+LABELV $1236
+endproc BotDontAvoid 68 12
+export BotGoForPowerups
+proc BotGoForPowerups 0 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1242
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1243
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1244
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1245
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1246
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5964
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1241
+endproc BotGoForPowerups 0 8
+export BotRoamGoal
+proc BotRoamGoal 180 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+LABELV $1248
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+CNSTF4 1048576000
+LEF4 $1252
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $1254
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $1255
+JUMPV
+LABELV $1254
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $1255
+LABELV $1252
+ADDRLP4 112
+INDIRF4
+CNSTF4 1061158912
+GEF4 $1256
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $1258
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $1259
+JUMPV
+LABELV $1258
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $1259
+LABELV $1256
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1119879168
+CNSTF4 1073741824
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+CNSTF4 1128792064
+LEF4 $1270
+ADDRLP4 164
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+CNSTF4 1109393408
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1145569280
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 172
+CNSTP4 0
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 24+4
+INDIRI4
+CNSTI4 0
+NEI4 $1287
+ADDRLP4 24+12+8
+ADDRLP4 24+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+NEI4 $1293
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRGP4 $1247
+JUMPV
+LABELV $1293
+LABELV $1287
+LABELV $1270
+LABELV $1249
+ADDRLP4 116
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 10
+LTI4 $1248
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $1247
+endproc BotRoamGoal 180 28
+lit
+align 4
+LABELV $1297
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAttackMove
+code
+proc BotAttackMove 400 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 $1297
+INDIRB
+ASGNB 12
+ADDRLP4 332
+ADDRFP4 4
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6020
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1298
+ADDRLP4 136+40
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 136+12
+ADDRFP4 4
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+CNSTI4 6440
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 136+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 136+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 80
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1295
+JUMPV
+LABELV $1298
+ADDRLP4 80
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 352
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 37
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 356
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 340
+ADDRLP4 356
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 360
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 344
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1045220557
+GEF4 $1312
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1295
+JUMPV
+LABELV $1312
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 332
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 192+24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 192+24+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 192+24+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 368
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1325
+ADDRLP4 372
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 340
+INDIRF4
+GEF4 $1327
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+ADDRGP4 $1328
+JUMPV
+LABELV $1327
+ADDRFP4 4
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1329
+ADDRLP4 376
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 376
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 344
+INDIRF4
+GEF4 $1329
+ADDRFP4 4
+INDIRP4
+CNSTI4 6016
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 344
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1329
+LABELV $1328
+LABELV $1325
+ADDRFP4 4
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1331
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+LABELV $1331
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+NEI4 $1333
+ADDRFP4 4
+INDIRP4
+CNSTI4 6024
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1335
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1336
+JUMPV
+LABELV $1335
+ADDRFP4 4
+INDIRP4
+CNSTI4 6024
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $1336
+LABELV $1333
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1337
+ADDRLP4 372
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRGP4 $1338
+JUMPV
+LABELV $1337
+ADDRLP4 72
+CNSTF4 1124859904
+ASGNF4
+ADDRLP4 76
+CNSTF4 1109393408
+ASGNF4
+LABELV $1338
+ADDRLP4 132
+INDIRF4
+CNSTF4 1053609165
+GTF4 $1339
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+LEF4 $1341
+ADDRFP4 4
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $1343
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1295
+JUMPV
+LABELV $1343
+LABELV $1341
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+GEF4 $1345
+ADDRFP4 4
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $1347
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1295
+JUMPV
+LABELV $1347
+LABELV $1345
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1295
+JUMPV
+LABELV $1339
+ADDRLP4 376
+ADDRFP4 4
+INDIRP4
+CNSTI4 6012
+ADDP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+ADDRLP4 376
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4800
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 336
+CNSTF4 1045220557
+CNSTF4 1065353216
+ADDRLP4 132
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1053609165
+ADDF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1060320051
+LEF4 $1349
+ADDRLP4 384
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 336
+ADDRLP4 336
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1073741824
+ADDRLP4 384
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1349
+ADDRFP4 4
+INDIRP4
+CNSTI4 6012
+ADDP4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+LEF4 $1351
+ADDRLP4 388
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1064262697
+LEF4 $1353
+ADDRLP4 392
+ADDRFP4 4
+INDIRP4
+CNSTI4 5876
+ADDP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ADDRLP4 392
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1353
+LABELV $1351
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $1355
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 5876
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1362
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $1362
+ADDRLP4 388
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1063675494
+LEF4 $1368
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1369
+JUMPV
+LABELV $1368
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+LEF4 $1376
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1377
+JUMPV
+LABELV $1376
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+GEF4 $1384
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1384
+LABELV $1377
+LABELV $1369
+ADDRFP4 4
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+EQI4 $1392
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1295
+JUMPV
+LABELV $1392
+ADDRLP4 396
+ADDRFP4 4
+INDIRP4
+CNSTI4 5876
+ADDP4
+ASGNP4
+ADDRLP4 396
+INDIRP4
+ADDRLP4 396
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1356
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LTI4 $1355
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+LABELV $1295
+endproc BotAttackMove 400 16
+export BotSameTeam
+proc BotSameTeam 20 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1397
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1395
+LABELV $1397
+CNSTI4 0
+RETI4
+ADDRGP4 $1394
+JUMPV
+LABELV $1395
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1400
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1398
+LABELV $1400
+CNSTI4 0
+RETI4
+ADDRGP4 $1394
+JUMPV
+LABELV $1398
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $1401
+ADDRLP4 8
+CNSTI4 888
+ASGNI4
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 656
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1403
+CNSTI4 1
+RETI4
+ADDRGP4 $1394
+JUMPV
+LABELV $1403
+LABELV $1401
+CNSTI4 0
+RETI4
+LABELV $1394
+endproc BotSameTeam 20 0
+export InFieldOfVision
+proc InFieldOfVision 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1406
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $1410
+ADDRLP4 4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $1411
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $1411
+JUMPV
+LABELV $1410
+ADDRLP4 4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $1414
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $1414
+LABELV $1411
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $1416
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+LEF4 $1417
+CNSTI4 0
+RETI4
+ADDRGP4 $1405
+JUMPV
+LABELV $1416
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+NEGF4
+MULF4
+GEF4 $1420
+CNSTI4 0
+RETI4
+ADDRGP4 $1405
+JUMPV
+LABELV $1420
+LABELV $1417
+LABELV $1407
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $1406
+CNSTI4 1
+RETI4
+LABELV $1405
+endproc InFieldOfVision 32 4
+export BotEntityVisible
+proc BotEntityVisible 380 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1423
+CNSTF4 0
+RETF4
+ADDRGP4 $1422
+JUMPV
+LABELV $1423
+ADDRLP4 84
+ADDRLP4 148+72
+INDIRF4
+ADDRLP4 148+84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 148+72+4
+INDIRF4
+ADDRLP4 148+84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 148+72+8
+INDIRF4
+ADDRLP4 148+84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 332
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 84
+ADDRLP4 332
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84+8
+CNSTF4 1056964608
+ADDRLP4 84+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 148+24
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 148+24+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 148+24+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 84
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 84+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRLP4 84+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 320
+ARGP4
+ADDRLP4 340
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+NEI4 $1454
+CNSTF4 0
+RETF4
+ADDRGP4 $1422
+JUMPV
+LABELV $1454
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 316
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRLP4 312
+ADDRLP4 316
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 308
+ADDRLP4 316
+INDIRI4
+CNSTI4 56
+BANDI4
+ASGNI4
+ADDRLP4 296
+CNSTF4 0
+ASGNF4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+LABELV $1456
+ADDRLP4 96
+CNSTI4 65537
+ASGNI4
+ADDRLP4 116
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 104
+ADDRLP4 84
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1460
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 56
+BORI4
+ASGNI4
+LABELV $1460
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1462
+ADDRLP4 96
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $1464
+ADDRLP4 116
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 84
+INDIRB
+ASGNB 12
+ADDRLP4 104
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $1464
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 56
+BXORI4
+ASGNI4
+LABELV $1462
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRLP4 356
+CNSTP4 0
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 288
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+76
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1466
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 -57
+BANDI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 360
+CNSTP4 0
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 288
+CNSTF4 1056964608
+ASGNF4
+LABELV $1469
+LABELV $1466
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1476
+ADDRLP4 0+80
+INDIRI4
+ADDRLP4 132
+INDIRI4
+NEI4 $1472
+LABELV $1476
+ADDRLP4 84
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 304
+ADDRLP4 360
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 364
+CNSTI4 0
+ASGNI4
+ADDRLP4 312
+INDIRI4
+ADDRLP4 364
+INDIRI4
+EQI4 $1477
+ADDRLP4 304
+INDIRI4
+ADDRLP4 364
+INDIRI4
+EQI4 $1477
+ADDRLP4 136
+ADDRLP4 0+12
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 0+12+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRLP4 0+12+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 372
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRGP4 $1478
+JUMPV
+LABELV $1477
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1486
+ADDRLP4 120
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRLP4 368
+CNSTP4 0
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 376
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRGP4 $1487
+JUMPV
+LABELV $1486
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1496
+ADDRLP4 104
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 368
+CNSTP4 0
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 136
+ADDRLP4 104
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 104+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRLP4 104+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 372
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRGP4 $1497
+JUMPV
+LABELV $1496
+ADDRLP4 300
+CNSTF4 0
+ASGNF4
+LABELV $1497
+LABELV $1487
+LABELV $1478
+ADDRLP4 372
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 981668463
+ADDRLP4 300
+INDIRF4
+MULF4
+ADDRLP4 372
+INDIRF4
+GEF4 $1509
+ADDRLP4 368
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1510
+JUMPV
+LABELV $1509
+ADDRLP4 368
+CNSTF4 981668463
+ADDRLP4 300
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1510
+ADDRLP4 292
+ADDRLP4 372
+INDIRF4
+ADDRLP4 368
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 292
+INDIRF4
+ADDRLP4 288
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LEF4 $1511
+ADDRLP4 296
+ADDRLP4 292
+INDIRF4
+ASGNF4
+LABELV $1511
+ADDRLP4 296
+INDIRF4
+CNSTF4 1064514355
+LTF4 $1513
+ADDRLP4 296
+INDIRF4
+RETF4
+ADDRGP4 $1422
+JUMPV
+LABELV $1513
+LABELV $1472
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $1515
+ADDRLP4 84+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 148+72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1516
+JUMPV
+LABELV $1515
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+NEI4 $1520
+ADDRLP4 84+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 148+84+8
+INDIRF4
+ADDRLP4 148+72+8
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+LABELV $1520
+LABELV $1516
+LABELV $1457
+ADDRLP4 100
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 3
+LTI4 $1456
+ADDRLP4 296
+INDIRF4
+RETF4
+LABELV $1422
+endproc BotEntityVisible 380 28
+export BotFindEnemy
+proc BotFindEnemy 468 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 336
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 336
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 45
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 340
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 340
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5884
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+LEI4 $1529
+ADDRLP4 344
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1530
+JUMPV
+LABELV $1529
+ADDRLP4 344
+CNSTI4 0
+ASGNI4
+LABELV $1530
+ADDRLP4 160
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5884
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1531
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 196
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 196
+ARGP4
+ADDRLP4 356
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $1533
+CNSTI4 0
+RETI4
+ADDRGP4 $1527
+JUMPV
+LABELV $1533
+ADDRLP4 144
+ADDRLP4 196+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 196+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 196+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 364
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRGP4 $1532
+JUMPV
+LABELV $1531
+ADDRLP4 192
+CNSTF4 0
+ASGNF4
+LABELV $1532
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $1542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 456
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 1
+NEI4 $1544
+ADDRLP4 356
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $1545
+JUMPV
+LABELV $1544
+ADDRLP4 356
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $1545
+ADDRLP4 360
+ADDRLP4 356
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 360+8
+ADDRLP4 360+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 372
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 464
+CNSTP4 0
+ASGNP4
+ADDRLP4 464
+INDIRP4
+ARGP4
+ADDRLP4 464
+INDIRP4
+ARGP4
+ADDRLP4 360
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 372+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1551
+ADDRLP4 372+80
+INDIRI4
+ADDRLP4 356
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $1547
+LABELV $1551
+ADDRLP4 356
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+NEI4 $1552
+CNSTI4 0
+RETI4
+ADDRGP4 $1527
+JUMPV
+LABELV $1552
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ADDRLP4 356
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6028
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5908
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6032
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1527
+JUMPV
+LABELV $1547
+LABELV $1542
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1557
+JUMPV
+LABELV $1554
+ADDRLP4 140
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1559
+ADDRGP4 $1555
+JUMPV
+LABELV $1559
+ADDRLP4 140
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1561
+ADDRGP4 $1555
+JUMPV
+LABELV $1561
+CNSTI4 868
+ADDRLP4 140
+INDIRI4
+MULI4
+ADDRGP4 g_entities+592
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1563
+ADDRGP4 $1555
+JUMPV
+LABELV $1563
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1566
+ADDRGP4 $1555
+JUMPV
+LABELV $1566
+ADDRLP4 0
+ARGP4
+ADDRLP4 356
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+NEI4 $1571
+ADDRLP4 0+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $1568
+LABELV $1571
+ADDRGP4 $1555
+JUMPV
+LABELV $1568
+ADDRLP4 0
+ARGP4
+ADDRLP4 360
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+EQI4 $1572
+ADDRLP4 0
+ARGP4
+ADDRLP4 364
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+NEI4 $1572
+ADDRGP4 $1555
+JUMPV
+LABELV $1572
+ADDRLP4 176
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1574
+ADDRLP4 0
+ARGP4
+ADDRLP4 368
+ADDRGP4 EntityIsChatting
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $1574
+ADDRGP4 $1555
+JUMPV
+LABELV $1574
+ADDRGP4 lastteleport_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+LEF4 $1576
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRGP4 lastteleport_origin
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRGP4 lastteleport_origin+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRGP4 lastteleport_origin+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 372
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 372
+INDIRF4
+CNSTF4 1167663104
+GEF4 $1587
+ADDRGP4 $1555
+JUMPV
+LABELV $1587
+LABELV $1576
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 376
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 380
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 380
+INDIRI4
+CNSTI4 0
+NEI4 $1596
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1598
+ADDRLP4 156
+INDIRF4
+ADDRLP4 192
+INDIRF4
+LEF4 $1598
+ADDRGP4 $1555
+JUMPV
+LABELV $1598
+LABELV $1596
+ADDRLP4 384
+CNSTF4 1165623296
+ADDRLP4 164
+INDIRF4
+MULF4
+CNSTF4 1147207680
+ADDF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 384
+INDIRF4
+ADDRLP4 384
+INDIRF4
+MULF4
+LEF4 $1600
+ADDRGP4 $1555
+JUMPV
+LABELV $1600
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 388
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 0
+EQI4 $1602
+ADDRGP4 $1555
+JUMPV
+LABELV $1602
+ADDRLP4 392
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 392
+INDIRI4
+GEI4 $1604
+ADDRLP4 160
+INDIRI4
+ADDRLP4 392
+INDIRI4
+NEI4 $1606
+ADDRLP4 0
+ARGP4
+ADDRLP4 396
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+EQI4 $1604
+LABELV $1606
+ADDRLP4 168
+CNSTF4 1135869952
+ASGNF4
+ADDRGP4 $1605
+JUMPV
+LABELV $1604
+ADDRLP4 156
+INDIRF4
+CNSTF4 1226845760
+LEF4 $1608
+ADDRLP4 400
+CNSTF4 1226845760
+ASGNF4
+ADDRGP4 $1609
+JUMPV
+LABELV $1608
+ADDRLP4 400
+ADDRLP4 156
+INDIRF4
+ASGNF4
+LABELV $1609
+ADDRLP4 168
+CNSTF4 1127481344
+CNSTF4 1119092736
+ADDRLP4 400
+INDIRF4
+CNSTF4 1172557824
+DIVF4
+SUBF4
+SUBF4
+ASGNF4
+LABELV $1605
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 408
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+CNSTF4 0
+GTF4 $1610
+ADDRGP4 $1555
+JUMPV
+LABELV $1610
+ADDRLP4 412
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 412
+INDIRI4
+GEI4 $1612
+ADDRLP4 156
+INDIRF4
+CNSTF4 1176256512
+LEF4 $1612
+ADDRLP4 160
+INDIRI4
+ADDRLP4 412
+INDIRI4
+NEI4 $1612
+ADDRLP4 0
+ARGP4
+ADDRLP4 416
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+NEI4 $1612
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0+36
+ARGP4
+CNSTF4 1119092736
+ARGF4
+ADDRLP4 180
+ARGP4
+ADDRLP4 424
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+CNSTI4 0
+NEI4 $1621
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 428
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+EQI4 $1624
+ADDRGP4 $1555
+JUMPV
+LABELV $1624
+LABELV $1621
+LABELV $1612
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ADDRLP4 0+20
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1627
+ADDRFP4 0
+INDIRP4
+CNSTI4 6028
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRGP4 $1628
+JUMPV
+LABELV $1627
+ADDRFP4 0
+INDIRP4
+CNSTI4 6028
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1628
+ADDRFP4 0
+INDIRP4
+CNSTI4 5908
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6032
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1527
+JUMPV
+LABELV $1555
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1557
+ADDRLP4 140
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1554
+CNSTI4 0
+RETI4
+LABELV $1527
+endproc BotFindEnemy 468 28
+export BotTeamFlagCarrierVisible
+proc BotTeamFlagCarrierVisible 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1633
+JUMPV
+LABELV $1630
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1635
+ADDRGP4 $1631
+JUMPV
+LABELV $1635
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1637
+ADDRGP4 $1631
+JUMPV
+LABELV $1637
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1639
+ADDRGP4 $1631
+JUMPV
+LABELV $1639
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $1641
+ADDRGP4 $1631
+JUMPV
+LABELV $1641
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1643
+ADDRGP4 $1631
+JUMPV
+LABELV $1643
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1629
+JUMPV
+LABELV $1631
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1633
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1630
+CNSTI4 -1
+RETI4
+LABELV $1629
+endproc BotTeamFlagCarrierVisible 164 20
+export BotTeamFlagCarrier
+proc BotTeamFlagCarrier 152 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1649
+JUMPV
+LABELV $1646
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1651
+ADDRGP4 $1647
+JUMPV
+LABELV $1651
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1653
+ADDRGP4 $1647
+JUMPV
+LABELV $1653
+ADDRLP4 4
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $1655
+ADDRGP4 $1647
+JUMPV
+LABELV $1655
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1657
+ADDRGP4 $1647
+JUMPV
+LABELV $1657
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1645
+JUMPV
+LABELV $1647
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1649
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1646
+CNSTI4 -1
+RETI4
+LABELV $1645
+endproc BotTeamFlagCarrier 152 8
+export BotEnemyFlagCarrierVisible
+proc BotEnemyFlagCarrierVisible 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1663
+JUMPV
+LABELV $1660
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1665
+ADDRGP4 $1661
+JUMPV
+LABELV $1665
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1667
+ADDRGP4 $1661
+JUMPV
+LABELV $1667
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1669
+ADDRGP4 $1661
+JUMPV
+LABELV $1669
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1671
+ADDRGP4 $1661
+JUMPV
+LABELV $1671
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1673
+ADDRGP4 $1661
+JUMPV
+LABELV $1673
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1659
+JUMPV
+LABELV $1661
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1663
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1660
+CNSTI4 -1
+RETI4
+LABELV $1659
+endproc BotEnemyFlagCarrierVisible 164 20
+export BotVisibleTeamMatesAndEnemies
+proc BotVisibleTeamMatesAndEnemies 192 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1676
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1676
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1678
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1678
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1683
+JUMPV
+LABELV $1680
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1685
+ADDRGP4 $1681
+JUMPV
+LABELV $1685
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1687
+ADDRGP4 $1681
+JUMPV
+LABELV $1687
+ADDRLP4 4
+ARGP4
+ADDRLP4 160
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $1689
+ADDRGP4 $1681
+JUMPV
+LABELV $1689
+ADDRLP4 144
+ADDRLP4 4+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 4+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 4+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 168
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+LEF4 $1698
+ADDRGP4 $1681
+JUMPV
+LABELV $1698
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 0
+GTF4 $1700
+ADDRGP4 $1681
+JUMPV
+LABELV $1700
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $1702
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1703
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1703
+JUMPV
+LABELV $1702
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1706
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1706
+LABELV $1703
+LABELV $1681
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1683
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1680
+LABELV $1675
+endproc BotVisibleTeamMatesAndEnemies 192 20
+export BotTeamCubeCarrierVisible
+proc BotTeamCubeCarrierVisible 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1712
+JUMPV
+LABELV $1709
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1714
+ADDRGP4 $1710
+JUMPV
+LABELV $1714
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1716
+ADDRGP4 $1710
+JUMPV
+LABELV $1716
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1718
+ADDRGP4 $1710
+JUMPV
+LABELV $1718
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $1720
+ADDRGP4 $1710
+JUMPV
+LABELV $1720
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1722
+ADDRGP4 $1710
+JUMPV
+LABELV $1722
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1708
+JUMPV
+LABELV $1710
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1712
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1709
+CNSTI4 -1
+RETI4
+LABELV $1708
+endproc BotTeamCubeCarrierVisible 164 20
+export BotEnemyCubeCarrierVisible
+proc BotEnemyCubeCarrierVisible 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1728
+JUMPV
+LABELV $1725
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1730
+ADDRGP4 $1726
+JUMPV
+LABELV $1730
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1732
+ADDRGP4 $1726
+JUMPV
+LABELV $1732
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1734
+ADDRGP4 $1726
+JUMPV
+LABELV $1734
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1736
+ADDRGP4 $1726
+JUMPV
+LABELV $1736
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1738
+ADDRGP4 $1726
+JUMPV
+LABELV $1738
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1726
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1728
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1725
+CNSTI4 -1
+RETI4
+LABELV $1724
+endproc BotEnemyCubeCarrierVisible 164 20
+lit
+align 4
+LABELV $1741
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $1742
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+export BotAimAtEnemy
+code
+proc BotAimAtEnemy 1148 52
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 860
+ADDRGP4 $1741
+INDIRB
+ASGNB 12
+ADDRLP4 872
+ADDRGP4 $1742
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1743
+ADDRGP4 $1740
+JUMPV
+LABELV $1743
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1745
+ADDRLP4 824
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 984
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1752
+ADDRLP4 984
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1748
+LABELV $1752
+ADDRLP4 824+8
+ADDRLP4 824+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+LABELV $1748
+ADDRLP4 140
+ADDRLP4 824
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 824+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 824+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4840
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+ADDRLP4 824
+INDIRB
+ASGNB 12
+ADDRGP4 $1740
+JUMPV
+LABELV $1745
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 984
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 984
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 988
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 988
+INDIRF4
+ASGNF4
+ADDRLP4 736
+INDIRF4
+CNSTF4 1064514355
+LEF4 $1758
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 992
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 856
+CNSTF4 1056964608
+ADDRLP4 992
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6028
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 856
+INDIRF4
+SUBF4
+LEF4 $1760
+ADDRGP4 $1740
+JUMPV
+LABELV $1760
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 856
+INDIRF4
+SUBF4
+LEF4 $1762
+ADDRGP4 $1740
+JUMPV
+LABELV $1762
+LABELV $1758
+ADDRFP4 0
+INDIRP4
+CNSTI4 6428
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 2
+NEI4 $1764
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1765
+JUMPV
+LABELV $1764
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 3
+NEI4 $1767
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 9
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1768
+JUMPV
+LABELV $1767
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 4
+NEI4 $1770
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 11
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRGP4 $1771
+JUMPV
+LABELV $1770
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 5
+NEI4 $1773
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRGP4 $1774
+JUMPV
+LABELV $1773
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 6
+NEI4 $1776
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1777
+JUMPV
+LABELV $1776
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 7
+NEI4 $1779
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 14
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1780
+JUMPV
+LABELV $1779
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 8
+NEI4 $1782
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRGP4 $1783
+JUMPV
+LABELV $1782
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 9
+NEI4 $1785
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 15
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 20
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+LABELV $1785
+LABELV $1783
+LABELV $1780
+LABELV $1777
+LABELV $1774
+LABELV $1771
+LABELV $1768
+LABELV $1765
+ADDRLP4 156
+INDIRF4
+CNSTF4 0
+GTF4 $1788
+ADDRLP4 156
+CNSTF4 953267991
+ASGNF4
+LABELV $1788
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 996
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 996
+INDIRI4
+CNSTI4 0
+EQI4 $1790
+ADDRLP4 1000
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1000
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+LEF4 $1792
+ADDRLP4 156
+CNSTF4 1053609165
+ADDRLP4 156
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1792
+LABELV $1790
+ADDRLP4 712
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 712+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 712+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1000
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 712
+ADDRLP4 712
+INDIRF4
+ADDRLP4 1000
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 712+4
+ADDRLP4 712+4
+INDIRF4
+ADDRLP4 1000
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6036
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1813
+ADDRFP4 0
+INDIRP4
+CNSTI4 6036
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6124
+ADDP4
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+LABELV $1813
+ADDRLP4 736
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1816
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6140
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1008
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1008
+INDIRF4
+CNSTF4 1158676480
+LEF4 $1825
+ADDRFP4 0
+INDIRP4
+CNSTI4 6124
+ADDP4
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6128
+ADDP4
+INDIRF4
+ADDRLP4 712+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+INDIRF4
+ADDRLP4 712+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $1827
+ADDRLP4 156
+CNSTF4 1060320051
+ADDRLP4 156
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1827
+LABELV $1825
+LABELV $1816
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 836
+ADDRLP4 1008
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 836
+INDIRI4
+CNSTI4 0
+EQI4 $1831
+ADDRLP4 724
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 844
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 844+8
+ADDRLP4 844+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 844+8
+ADDRLP4 844+8
+INDIRF4
+ADDRLP4 160+292+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 844
+ARGP4
+ADDRLP4 860
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 724
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 740+8
+INDIRF4
+CNSTF4 1065353216
+GTF4 $1839
+ADDRLP4 740+80
+INDIRI4
+ADDRLP4 0+20
+INDIRI4
+EQI4 $1839
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1839
+ADDRLP4 160+272
+INDIRF4
+CNSTF4 0
+EQF4 $1845
+ADDRLP4 140
+ADDRLP4 724
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 724+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 724+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1020
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1020
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6140
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 840
+INDIRF4
+CNSTF4 1120403456
+LEF4 $1861
+ADDRLP4 140
+ARGP4
+ADDRLP4 1028
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRF4
+CNSTF4 1149239296
+LTF4 $1859
+LABELV $1861
+ADDRLP4 736
+INDIRF4
+CNSTF4 1061997773
+LEF4 $1862
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1862
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1132
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1132
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1136
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 1136
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 1136
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 1032+8
+ADDRLP4 1032+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 1140
+CNSTF4 0
+ASGNF4
+ADDRLP4 968+8
+ADDRLP4 1140
+INDIRF4
+ASGNF4
+ADDRLP4 968+4
+ADDRLP4 1140
+INDIRF4
+ASGNF4
+ADDRLP4 968
+ADDRLP4 1140
+INDIRF4
+ASGNF4
+ADDRLP4 1044
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 1144
+CNSTI4 0
+ASGNI4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRLP4 968
+ARGP4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+CNSTF4 1092616192
+ADDRLP4 840
+INDIRF4
+MULF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_PredictClientMovement
+CALLI4
+pop
+ADDRLP4 724
+ADDRLP4 1044
+INDIRB
+ASGNB 12
+ADDRGP4 $1863
+JUMPV
+LABELV $1862
+ADDRLP4 736
+INDIRF4
+CNSTF4 1053609165
+LEF4 $1895
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1036
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1040
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 980
+ADDRLP4 1040
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 1044
+ADDRLP4 840
+INDIRF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 1044
+INDIRF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+ADDRLP4 1048
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 724+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 1044
+INDIRF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+ADDRLP4 1048
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 724+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+ADDRLP4 840
+INDIRF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+ADDRLP4 980
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1895
+LABELV $1863
+LABELV $1859
+LABELV $1845
+ADDRLP4 736
+INDIRF4
+CNSTF4 1058642330
+LEF4 $1930
+ADDRLP4 160+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1930
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+GEF4 $1934
+ADDRLP4 956
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 956+8
+ADDRLP4 956+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 1016
+CNSTP4 0
+ASGNP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 956
+ARGP4
+ADDRLP4 0+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 944
+ADDRLP4 724
+INDIRB
+ASGNB 12
+ADDRLP4 740+4
+INDIRI4
+CNSTI4 0
+EQI4 $1942
+ADDRLP4 944+8
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRGP4 $1943
+JUMPV
+LABELV $1942
+ADDRLP4 944+8
+ADDRLP4 740+12+8
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $1943
+ADDRLP4 740
+ARGP4
+ADDRLP4 844
+ARGP4
+ADDRLP4 1020
+CNSTP4 0
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+ADDRLP4 944
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 740+12+8
+INDIRF4
+ADDRLP4 944+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 1024
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRF4
+CNSTF4 1112014848
+GEF4 $1951
+ADDRLP4 140
+ADDRLP4 740+12
+INDIRF4
+ADDRLP4 944
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 740+12+4
+INDIRF4
+ADDRLP4 944+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 740+12+8
+INDIRF4
+ADDRLP4 944+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1028
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRF4
+CNSTF4 1163984896
+GEF4 $1965
+ADDRLP4 140
+ADDRLP4 740+12
+INDIRF4
+ADDRLP4 844
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 740+12+4
+INDIRF4
+ADDRLP4 844+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 740+12+8
+INDIRF4
+ADDRLP4 844+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1032
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1032
+INDIRF4
+CNSTF4 1176256512
+LEF4 $1976
+ADDRLP4 740+12+8
+ADDRLP4 740+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 740+12
+ARGP4
+ADDRLP4 1036
+CNSTP4 0
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 740+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1983
+ADDRLP4 724
+ADDRLP4 944
+INDIRB
+ASGNB 12
+LABELV $1983
+LABELV $1976
+LABELV $1965
+LABELV $1951
+LABELV $1934
+LABELV $1930
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724
+ADDRLP4 724
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1020
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724+4
+ADDRLP4 724+4
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 1020
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1024
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 1024
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1832
+JUMPV
+LABELV $1831
+ADDRLP4 724
+ADDRFP4 0
+INDIRP4
+CNSTI4 6440
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 736
+INDIRF4
+CNSTF4 1056964608
+LEF4 $1989
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 9
+EQI4 $1997
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 5
+EQI4 $1997
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 4
+NEI4 $1991
+LABELV $1997
+ADDRLP4 884+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 884+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 884
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 884+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 884+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 884+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 884+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 884+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 884+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6440
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 884
+ARGP4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 824
+ARGP4
+ADDRLP4 1016
+ADDRGP4 trap_BotPredictVisiblePosition
+CALLI4
+ASGNI4
+ADDRLP4 1016
+INDIRI4
+CNSTI4 0
+EQI4 $2010
+ADDRLP4 140
+ADDRLP4 824
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 824+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 824+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4840
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1024
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRF4
+CNSTF4 1170735104
+LEF4 $2016
+ADDRLP4 724
+ADDRLP4 824
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $2016
+LABELV $2010
+ADDRLP4 156
+CNSTF4 1065353216
+ASGNF4
+LABELV $1991
+LABELV $1989
+LABELV $1832
+ADDRLP4 836
+INDIRI4
+CNSTI4 0
+EQI4 $2019
+ADDRLP4 740
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 1016
+CNSTP4 0
+ASGNP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 724
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+ADDRLP4 740+12
+INDIRB
+ASGNB 12
+ADDRGP4 $2020
+JUMPV
+LABELV $2019
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+ADDRLP4 724
+INDIRB
+ASGNB 12
+LABELV $2020
+ADDRLP4 140
+ADDRLP4 724
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 724+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 724+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4840
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 2
+EQI4 $2034
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 3
+EQI4 $2034
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 6
+EQI4 $2034
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 7
+NEI4 $2026
+LABELV $2034
+ADDRLP4 140
+ARGP4
+ADDRLP4 1016
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1016
+INDIRF4
+ASGNF4
+ADDRLP4 840
+INDIRF4
+CNSTF4 1125515264
+LEF4 $2035
+ADDRLP4 840
+CNSTF4 1125515264
+ASGNF4
+LABELV $2035
+ADDRLP4 940
+CNSTF4 1053609165
+ADDRLP4 840
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 156
+INDIRF4
+ADDRLP4 940
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2026
+ADDRLP4 156
+INDIRF4
+CNSTF4 1061997773
+GEF4 $2037
+ADDRLP4 140
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+LABELV $2039
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1020
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 140
+ADDP4
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+ADDRLP4 1020
+INDIRP4
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1073741824
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2040
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 3
+LTI4 $2039
+LABELV $2037
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1020
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+ADDRLP4 1020
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 160+268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1024
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1028
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRP4
+ADDRLP4 1028
+INDIRF4
+ASGNF4
+ADDRLP4 1032
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+CNSTI4 6472
+ADDP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ADDRLP4 1036
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 160+264
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 1032
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 6472
+ADDP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1044
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1040
+INDIRP4
+ADDRLP4 1044
+INDIRF4
+ASGNF4
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $2045
+ADDRLP4 156
+INDIRF4
+CNSTF4 1063675494
+LEF4 $2048
+ADDRFP4 0
+INDIRP4
+CNSTI4 6028
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $2048
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $2050
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $2050
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $2048
+LABELV $2045
+LABELV $1740
+endproc BotAimAtEnemy 1148 52
+lit
+align 4
+LABELV $2053
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $2054
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCheckAttack
+code
+proc BotCheckAttack 1032 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 948
+ADDRGP4 $2053
+INDIRB
+ASGNB 12
+ADDRLP4 960
+ADDRGP4 $2054
+INDIRB
+ASGNB 12
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 576
+INDIRI4
+ARGI4
+ADDRLP4 788
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 576
+INDIRI4
+CNSTI4 64
+LTI4 $2055
+ADDRLP4 788+20
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $2063
+ADDRLP4 788+20
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $2057
+LABELV $2063
+ADDRLP4 976
+CNSTI4 868
+ASGNI4
+ADDRLP4 976
+INDIRI4
+ADDRLP4 788+20
+INDIRI4
+MULI4
+ADDRGP4 g_entities+824
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2064
+ADDRLP4 976
+INDIRI4
+ADDRLP4 788+20
+INDIRI4
+MULI4
+ADDRGP4 g_entities+824
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2064
+ADDRGP4 $2052
+JUMPV
+LABELV $2064
+LABELV $2057
+LABELV $2055
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 976
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 700
+ADDRLP4 976
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6028
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 700
+INDIRF4
+SUBF4
+LEF4 $2070
+ADDRGP4 $2052
+JUMPV
+LABELV $2070
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 700
+INDIRF4
+SUBF4
+LEF4 $2072
+ADDRGP4 $2052
+JUMPV
+LABELV $2072
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $2074
+ADDRGP4 $2052
+JUMPV
+LABELV $2074
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $2076
+ADDRGP4 $2052
+JUMPV
+LABELV $2076
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 47
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 980
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 932
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $2078
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 932
+INDIRF4
+LEF4 $2080
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 932
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2081
+JUMPV
+LABELV $2080
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 932
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2081
+LABELV $2078
+ADDRLP4 580
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 580+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6116
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 580+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4840
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2084
+ADDRLP4 580
+ARGP4
+ADDRLP4 992
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 992
+INDIRF4
+CNSTF4 1163984896
+LEF4 $2086
+ADDRGP4 $2052
+JUMPV
+LABELV $2086
+LABELV $2084
+ADDRLP4 580
+ARGP4
+ADDRLP4 992
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 992
+INDIRF4
+CNSTF4 1176256512
+GEF4 $2088
+ADDRLP4 928
+CNSTF4 1123024896
+ASGNF4
+ADDRGP4 $2089
+JUMPV
+LABELV $2088
+ADDRLP4 928
+CNSTF4 1112014848
+ASGNF4
+LABELV $2089
+ADDRLP4 580
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+ADDRLP4 928
+INDIRF4
+ARGF4
+ADDRLP4 936
+ARGP4
+ADDRLP4 996
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 996
+INDIRI4
+CNSTI4 0
+NEI4 $2090
+ADDRGP4 $2052
+JUMPV
+LABELV $2090
+ADDRLP4 704
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 1004
+CNSTP4 0
+ASGNP4
+ADDRLP4 1004
+INDIRP4
+ARGP4
+ADDRLP4 1004
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 704+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2092
+ADDRLP4 704+80
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $2092
+ADDRGP4 $2052
+JUMPV
+LABELV $2092
+ADDRFP4 0
+INDIRP4
+CNSTI4 6428
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 676
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676+4
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676+8
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+292+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 1016
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 688
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1016
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 688+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1016
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 688+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1020
+CNSTF4 3242196992
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1020
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1020
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3242196992
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 592
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 948
+ARGP4
+ADDRLP4 960
+ARGP4
+ADDRLP4 688
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 592+80
+INDIRI4
+CNSTI4 0
+LTI4 $2126
+ADDRLP4 592+80
+INDIRI4
+CNSTI4 64
+GEI4 $2126
+ADDRLP4 592+80
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $2130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592+80
+INDIRI4
+ARGI4
+ADDRLP4 1024
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+EQI4 $2133
+ADDRGP4 $2052
+JUMPV
+LABELV $2133
+LABELV $2130
+LABELV $2126
+ADDRLP4 592+80
+INDIRI4
+ADDRLP4 576
+INDIRI4
+NEI4 $2139
+ADDRLP4 576
+INDIRI4
+CNSTI4 64
+LTI4 $2136
+LABELV $2139
+ADDRLP4 24+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2140
+CNSTF4 1148846080
+ADDRLP4 592+8
+INDIRF4
+MULF4
+ADDRLP4 24+344+172
+INDIRF4
+GEF4 $2144
+ADDRLP4 1028
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 972
+ADDRLP4 1028
+INDIRF4
+ADDRLP4 24+344+168
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 1028
+INDIRF4
+ADDRLP4 592+8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 972
+INDIRF4
+CNSTF4 0
+LEF4 $2152
+ADDRGP4 $2052
+JUMPV
+LABELV $2152
+LABELV $2144
+LABELV $2140
+LABELV $2136
+ADDRLP4 24+176
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2154
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2155
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $2155
+JUMPV
+LABELV $2154
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $2155
+ADDRLP4 1028
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ADDRLP4 1028
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $2052
+endproc BotCheckAttack 1032 28
+lit
+align 4
+LABELV $2169
+byte 4 1143832576
+byte 4 1128792064
+byte 4 1139802112
+align 4
+LABELV $2170
+byte 4 1148321792
+byte 4 1139539968
+byte 4 1143603200
+align 4
+LABELV $2171
+byte 4 1134034944
+byte 4 1135607808
+byte 4 1147535360
+export BotMapScripts
+code
+proc BotMapScripts 1436 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 272
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 272
+ARGP4
+ADDRGP4 $2160
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 1316
+INDIRP4
+ARGP4
+CNSTU4 127
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 144+127
+CNSTI1 0
+ASGNI1
+ADDRLP4 144
+ARGP4
+ADDRGP4 $2164
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+EQI4 $2168
+ADDRLP4 144
+ARGP4
+ADDRGP4 $2165
+ARGP4
+ADDRLP4 1324
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+EQI4 $2168
+ADDRLP4 144
+ARGP4
+ADDRGP4 $2166
+ARGP4
+ADDRLP4 1328
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+NEI4 $2162
+LABELV $2168
+ADDRLP4 1332
+ADDRGP4 $2169
+INDIRB
+ASGNB 12
+ADDRLP4 1344
+ADDRGP4 $2170
+INDIRB
+ASGNB 12
+ADDRLP4 1356
+ADDRGP4 $2171
+INDIRB
+ASGNB 12
+ADDRLP4 1368
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+ASGNP4
+ADDRLP4 1368
+INDIRP4
+ADDRLP4 1368
+INDIRP4
+INDIRI4
+CNSTI4 -16777217
+BANDI4
+ASGNI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 $2166
+ARGP4
+ADDRLP4 1372
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1372
+INDIRI4
+CNSTI4 0
+NEI4 $2172
+ADDRLP4 1332+8
+ADDRLP4 1332+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+ADDRLP4 1344+8
+ADDRLP4 1344+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+LABELV $2172
+ADDRLP4 1376
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1376
+INDIRF4
+ADDRLP4 1332
+INDIRF4
+LEF4 $2176
+ADDRLP4 1376
+INDIRF4
+ADDRLP4 1344
+INDIRF4
+GEF4 $2176
+ADDRLP4 1380
+ADDRFP4 0
+INDIRP4
+CNSTI4 4808
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1380
+INDIRF4
+ADDRLP4 1332+4
+INDIRF4
+LEF4 $2178
+ADDRLP4 1380
+INDIRF4
+ADDRLP4 1344+4
+INDIRF4
+GEF4 $2178
+ADDRLP4 1384
+ADDRFP4 0
+INDIRP4
+CNSTI4 4812
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1384
+INDIRF4
+ADDRLP4 1332+8
+INDIRF4
+LEF4 $2182
+ADDRLP4 1384
+INDIRF4
+ADDRLP4 1344+8
+INDIRF4
+GEF4 $2182
+ADDRGP4 $2159
+JUMPV
+LABELV $2182
+LABELV $2178
+LABELV $2176
+ADDRLP4 1380
+CNSTI4 0
+ASGNI4
+ADDRLP4 1296
+ADDRLP4 1380
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1380
+INDIRI4
+ASGNI4
+ADDRGP4 $2189
+JUMPV
+LABELV $2186
+ADDRLP4 140
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2191
+ADDRGP4 $2187
+JUMPV
+LABELV $2191
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2193
+ADDRGP4 $2187
+JUMPV
+LABELV $2193
+ADDRLP4 0
+ARGP4
+ADDRLP4 1384
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 1384
+INDIRI4
+CNSTI4 0
+NEI4 $2198
+ADDRLP4 0+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $2195
+LABELV $2198
+ADDRGP4 $2187
+JUMPV
+LABELV $2195
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 1332
+INDIRF4
+LEF4 $2199
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 1344
+INDIRF4
+GEF4 $2199
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 1332+4
+INDIRF4
+LEF4 $2203
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 1344+4
+INDIRF4
+GEF4 $2203
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 1332+8
+INDIRF4
+LEF4 $2211
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 1344+8
+INDIRF4
+GEF4 $2211
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 1388
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1388
+INDIRI4
+CNSTI4 0
+EQI4 $2219
+ADDRLP4 1296
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2188
+JUMPV
+LABELV $2219
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $2221
+ADDRLP4 1296
+CNSTI4 1
+ASGNI4
+LABELV $2221
+LABELV $2211
+LABELV $2203
+LABELV $2199
+LABELV $2187
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2189
+ADDRLP4 140
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2186
+LABELV $2188
+ADDRLP4 1296
+INDIRI4
+CNSTI4 0
+EQI4 $2223
+ADDRLP4 1384
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+ASGNP4
+ADDRLP4 1384
+INDIRP4
+ADDRLP4 1384
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRLP4 1300
+ADDRLP4 1356
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1300+4
+ADDRLP4 1356+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1300+8
+ADDRLP4 1356+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4840
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1300
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1392
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 1312
+ADDRLP4 1392
+INDIRF4
+ASGNF4
+ADDRLP4 1396
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1400
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ASGNP4
+ADDRLP4 1400
+INDIRP4
+ADDRLP4 1400
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 1396
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 1312
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1404
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ASGNP4
+ADDRLP4 1404
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1408
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1404
+INDIRP4
+ADDRLP4 1408
+INDIRF4
+ASGNF4
+ADDRLP4 1412
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1416
+ADDRFP4 0
+INDIRP4
+CNSTI4 6472
+ADDP4
+ASGNP4
+ADDRLP4 1416
+INDIRP4
+ADDRLP4 1416
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 1412
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 1312
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1420
+ADDRFP4 0
+INDIRP4
+CNSTI4 6472
+ADDP4
+ASGNP4
+ADDRLP4 1420
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1424
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1420
+INDIRP4
+ADDRLP4 1424
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ARGP4
+ADDRLP4 1432
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 1432
+INDIRI4
+CNSTI4 0
+EQI4 $2229
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $2229
+LABELV $2223
+LABELV $2162
+LABELV $2159
+endproc BotMapScripts 1436 16
+data
+align 4
+LABELV VEC_UP
+byte 4 0
+byte 4 3212836864
+byte 4 0
+align 4
+LABELV MOVEDIR_UP
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV VEC_DOWN
+byte 4 0
+byte 4 3221225472
+byte 4 0
+align 4
+LABELV MOVEDIR_DOWN
+byte 4 0
+byte 4 0
+byte 4 3212836864
+export BotSetMovedir
+code
+proc BotSetMovedir 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_UP
+ARGP4
+ADDRLP4 0
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2232
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_UP
+INDIRB
+ASGNB 12
+ADDRGP4 $2233
+JUMPV
+LABELV $2232
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_DOWN
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2234
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_DOWN
+INDIRB
+ASGNB 12
+ADDRGP4 $2235
+JUMPV
+LABELV $2234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2235
+LABELV $2233
+LABELV $2231
+endproc BotSetMovedir 12 16
+export BotModelMinsMaxs
+proc BotModelMinsMaxs 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2240
+JUMPV
+LABELV $2237
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2242
+ADDRGP4 $2238
+JUMPV
+LABELV $2242
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2244
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $2244
+ADDRGP4 $2238
+JUMPV
+LABELV $2244
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2246
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+EQI4 $2246
+ADDRGP4 $2238
+JUMPV
+LABELV $2246
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2248
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2250
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2250
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2252
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2252
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $2236
+JUMPV
+LABELV $2248
+LABELV $2238
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+LABELV $2240
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2237
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2254
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $2254
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2256
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $2256
+CNSTI4 0
+RETI4
+LABELV $2236
+endproc BotModelMinsMaxs 40 0
+lit
+align 4
+LABELV $2259
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $2260
+byte 4 3212836864
+byte 4 3212836864
+byte 4 3212836864
+export BotFuncButtonActivateGoal
+code
+proc BotFuncButtonActivateGoal 644 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 304
+ADDRGP4 $2259
+INDIRB
+ASGNB 12
+ADDRLP4 316
+ADDRGP4 $2260
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 564
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 148
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2261
+CNSTI4 0
+RETI4
+ADDRGP4 $2258
+JUMPV
+LABELV $2261
+ADDRLP4 148+1
+ARGP4
+ADDRLP4 568
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 288
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $2264
+CNSTI4 0
+RETI4
+ADDRGP4 $2258
+JUMPV
+LABELV $2264
+ADDRLP4 288
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 572
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 344
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2266
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 328
+INDIRF4
+CNSTF4 0
+NEF4 $2267
+ADDRLP4 328
+CNSTF4 1082130432
+ASGNF4
+LABELV $2267
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2269
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 276
+CNSTF4 0
+ASGNF4
+ADDRLP4 276+4
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 276+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 276
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotSetMovedir
+CALLV
+pop
+ADDRLP4 100
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 72
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 576
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 576
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1056964608
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 580
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+8
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 580
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDRLP4 584
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1056964608
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2292
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 348
+INDIRF4
+CNSTF4 0
+EQF4 $2293
+ADDRLP4 592
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 592
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 592
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 356
+ARGP4
+ADDRLP4 596
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 596
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 600
+CNSTP4 0
+ASGNP4
+ADDRLP4 600
+INDIRP4
+ARGP4
+ADDRLP4 600
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 596
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 356+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2305
+ADDRLP4 356+80
+INDIRI4
+ADDRLP4 344
+INDIRI4
+NEI4 $2301
+LABELV $2305
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $2258
+JUMPV
+LABELV $2301
+CNSTI4 4
+ARGI4
+ADDRLP4 124
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2306
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2310
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 604
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 604
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2311
+JUMPV
+LABELV $2310
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 616
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2311
+LABELV $2307
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2306
+ADDRLP4 604
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 292
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1140850688
+SUBF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 440
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 608
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 608
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2323
+JUMPV
+LABELV $2320
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 612
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 612
+INDIRI4
+CNSTI4 0
+EQI4 $2324
+ADDRGP4 $2322
+JUMPV
+LABELV $2324
+LABELV $2321
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2323
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $2320
+LABELV $2322
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $2326
+LABELV $2326
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2328
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 440
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2330
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2334
+ADDRLP4 612
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 612
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 616
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 316
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 620
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 624
+ADDRLP4 612
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 624
+INDIRP4
+ADDRLP4 624
+INDIRP4
+INDIRF4
+ADDRLP4 616
+INDIRF4
+ADDRLP4 620
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2335
+JUMPV
+LABELV $2334
+ADDRLP4 628
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 632
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 304
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 636
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 640
+ADDRLP4 628
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 640
+INDIRP4
+ADDRLP4 640
+INDIRP4
+INDIRF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2335
+LABELV $2331
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2330
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2258
+JUMPV
+LABELV $2328
+CNSTI4 0
+RETI4
+ADDRGP4 $2258
+JUMPV
+LABELV $2293
+CNSTI4 4
+ARGI4
+ADDRLP4 124
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2336
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2340
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 592
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 596
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 592
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2341
+JUMPV
+LABELV $2340
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 600
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 604
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2341
+LABELV $2337
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2336
+ADDRLP4 592
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 592
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 592
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 292
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 596
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2353
+JUMPV
+LABELV $2350
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 600
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 600
+INDIRI4
+CNSTI4 0
+EQI4 $2354
+ADDRGP4 $2352
+JUMPV
+LABELV $2354
+LABELV $2351
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2353
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $2350
+LABELV $2352
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GEI4 $2356
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2366
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2370
+ADDRLP4 600
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 600
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 604
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 316
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 612
+ADDRLP4 600
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 612
+INDIRP4
+ADDRLP4 612
+INDIRP4
+INDIRF4
+ADDRLP4 604
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2371
+JUMPV
+LABELV $2370
+ADDRLP4 616
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 620
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 304
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 624
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 628
+ADDRLP4 616
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 628
+INDIRP4
+ADDRLP4 628
+INDIRP4
+INDIRF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2371
+LABELV $2367
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2366
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2258
+JUMPV
+LABELV $2356
+CNSTI4 0
+RETI4
+LABELV $2258
+endproc BotFuncButtonActivateGoal 644 28
+export BotFuncDoorActivateGoal
+proc BotFuncDoorActivateGoal 1080 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2373
+CNSTI4 0
+RETI4
+ADDRGP4 $2372
+JUMPV
+LABELV $2373
+ADDRLP4 12+1
+ARGP4
+ADDRLP4 1068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $2376
+CNSTI4 0
+RETI4
+ADDRGP4 $2372
+JUMPV
+LABELV $2376
+ADDRLP4 1060
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1072
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 1048
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1036+4
+INDIRF4
+ADDRLP4 1048+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 1036+8
+INDIRF4
+ADDRLP4 1048+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1076
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1076
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1076
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $2372
+endproc BotFuncDoorActivateGoal 1080 20
+export BotTriggerMultipleActivateGoal
+proc BotTriggerMultipleActivateGoal 284 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 84
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2389
+CNSTI4 0
+RETI4
+ADDRGP4 $2388
+JUMPV
+LABELV $2389
+ADDRLP4 84+1
+ARGP4
+ADDRLP4 264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $2392
+CNSTI4 0
+RETI4
+ADDRGP4 $2388
+JUMPV
+LABELV $2392
+ADDRLP4 224
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1073741824
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 252
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 212
+ADDRLP4 240
+INDIRB
+ASGNB 12
+ADDRLP4 212+8
+ADDRLP4 212+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 212
+INDIRB
+ASGNB 12
+ADDRLP4 228+8
+ADDRLP4 228+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 212
+ARGP4
+ADDRLP4 228
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 276
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2409
+JUMPV
+LABELV $2406
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $2410
+ADDRGP4 $2408
+JUMPV
+LABELV $2410
+LABELV $2407
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2409
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $2406
+LABELV $2408
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $2412
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2388
+JUMPV
+LABELV $2412
+CNSTI4 0
+RETI4
+LABELV $2388
+endproc BotTriggerMultipleActivateGoal 284 20
+export BotPopFromActivateGoalStack
+proc BotPopFromActivateGoalStack 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2423
+CNSTI4 0
+RETI4
+ADDRGP4 $2422
+JUMPV
+LABELV $2423
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $2422
+endproc BotPopFromActivateGoalStack 4 8
+export BotPushOntoActivateGoalStack
+proc BotPushOntoActivateGoalStack 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1176255488
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2426
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6916
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2430
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6916
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $2432
+ADDRLP4 4
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6916
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $2432
+LABELV $2430
+LABELV $2427
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $2426
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $2434
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6916
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 244
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6916
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6916
+ADDP4
+ADDP4
+CNSTI4 240
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6916
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $2425
+JUMPV
+LABELV $2434
+CNSTI4 0
+RETI4
+LABELV $2425
+endproc BotPushOntoActivateGoalStack 20 12
+export BotClearActivateGoalStack
+proc BotClearActivateGoalStack 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $2438
+JUMPV
+LABELV $2437
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+LABELV $2438
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2437
+LABELV $2436
+endproc BotClearActivateGoalStack 0 4
+export BotEnableActivateGoalAreas
+proc BotEnableActivateGoalAreas 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2444
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2445
+JUMPV
+LABELV $2444
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2445
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2441
+ADDRGP4 $2440
+JUMPV
+LABELV $2441
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2449
+JUMPV
+LABELV $2446
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_EnableRoutingArea
+CALLI4
+pop
+LABELV $2447
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2449
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+LTI4 $2446
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2451
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2452
+JUMPV
+LABELV $2451
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2452
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $2440
+endproc BotEnableActivateGoalAreas 12 8
+export BotIsGoingToActivateEntity
+proc BotIsGoingToActivateEntity 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2457
+JUMPV
+LABELV $2454
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $2458
+ADDRGP4 $2455
+JUMPV
+LABELV $2458
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $2460
+CNSTI4 1
+RETI4
+ADDRGP4 $2453
+JUMPV
+LABELV $2460
+LABELV $2455
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2457
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2454
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2462
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6916
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2466
+ADDRGP4 $2463
+JUMPV
+LABELV $2466
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6916
+ADDP4
+ADDP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $2468
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6916
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $2470
+CNSTI4 1
+RETI4
+ADDRGP4 $2453
+JUMPV
+LABELV $2470
+LABELV $2468
+LABELV $2463
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $2462
+CNSTI4 0
+RETI4
+LABELV $2453
+endproc BotIsGoingToActivateEntity 8 0
+export BotGetActivateGoal
+proc BotGetActivateGoal 3308 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 244
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 3052
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2473
+ARGP4
+ADDRLP4 3052+104
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 3240
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3240
+INDIRI4
+ASGNI4
+ADDRGP4 $2478
+JUMPV
+LABELV $2475
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 1584
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3244
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3244
+INDIRI4
+CNSTI4 0
+NEI4 $2479
+ADDRGP4 $2476
+JUMPV
+LABELV $2479
+ADDRLP4 1712
+ARGP4
+ADDRLP4 1584
+ARGP4
+ADDRLP4 3248
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3248
+INDIRI4
+CNSTI4 0
+NEI4 $2481
+ADDRGP4 $2477
+JUMPV
+LABELV $2481
+LABELV $2476
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3244
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3244
+INDIRI4
+ASGNI4
+LABELV $2478
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2475
+LABELV $2477
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2483
+CNSTI4 3
+ARGI4
+ADDRGP4 $2485
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2472
+JUMPV
+LABELV $2483
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2486
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1456
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2487
+CNSTI4 3
+ARGI4
+ADDRGP4 $2489
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2472
+JUMPV
+LABELV $2487
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2492
+ARGP4
+ADDRLP4 3248
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3248
+INDIRI4
+CNSTI4 0
+NEI4 $2490
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2292
+ARGP4
+ADDRLP4 3208
+ARGP4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3252
+INDIRI4
+CNSTI4 0
+EQI4 $2493
+ADDRLP4 3208
+INDIRF4
+CNSTF4 0
+EQF4 $2495
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotFuncDoorActivateGoal
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2472
+JUMPV
+LABELV $2495
+LABELV $2493
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2497
+ARGP4
+ADDRLP4 3204
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 3204
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2498
+CNSTI4 0
+RETI4
+ADDRGP4 $2472
+JUMPV
+LABELV $2498
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2502
+ARGP4
+ADDRLP4 3192
+ARGP4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $2500
+ADDRLP4 3260
+CNSTF4 0
+ASGNF4
+ADDRLP4 3192+8
+ADDRLP4 3260
+INDIRF4
+ASGNF4
+ADDRLP4 3192+4
+ADDRLP4 3260
+INDIRF4
+ASGNF4
+ADDRLP4 3192
+ADDRLP4 3260
+INDIRF4
+ASGNF4
+LABELV $2500
+ADDRLP4 3192
+ARGP4
+ADDRLP4 3052+24
+ARGP4
+ADDRLP4 3260
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $2505
+CNSTI4 0
+RETI4
+ADDRGP4 $2472
+JUMPV
+LABELV $2505
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1712
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2508
+ADDRLP4 1712+1
+ARGP4
+ADDRLP4 3264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3212
+ADDRLP4 3264
+INDIRI4
+ASGNI4
+ADDRLP4 3212
+INDIRI4
+CNSTI4 0
+EQI4 $2511
+ADDRLP4 3212
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3216
+ARGP4
+ADDRLP4 3228
+ARGP4
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+pop
+ADDRLP4 3216
+ARGP4
+ADDRLP4 3228
+ARGP4
+ADDRLP4 2740
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 3268
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 3048
+ADDRLP4 3268
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2516
+JUMPV
+LABELV $2513
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2517
+ADDRGP4 $2515
+JUMPV
+LABELV $2517
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3272
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3272
+INDIRI4
+CNSTI4 0
+NEI4 $2519
+ADDRGP4 $2514
+JUMPV
+LABELV $2519
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2521
+ADDRLP4 3280
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3276
+ADDRLP4 3280
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3280
+INDIRP4
+ADDRLP4 3276
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3284
+CNSTI4 2
+ASGNI4
+ADDRLP4 3276
+INDIRI4
+ADDRLP4 3284
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3284
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2521
+LABELV $2514
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2516
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3048
+INDIRI4
+LTI4 $2513
+LABELV $2515
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2526
+JUMPV
+LABELV $2523
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2527
+ADDRGP4 $2525
+JUMPV
+LABELV $2527
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3272
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3272
+INDIRI4
+CNSTI4 0
+EQI4 $2529
+ADDRGP4 $2524
+JUMPV
+LABELV $2529
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2531
+ADDRLP4 3280
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3276
+ADDRLP4 3280
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3280
+INDIRP4
+ADDRLP4 3276
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3284
+CNSTI4 2
+ASGNI4
+ADDRLP4 3276
+INDIRI4
+ADDRLP4 3284
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3284
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2531
+LABELV $2524
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2526
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3048
+INDIRI4
+LTI4 $2523
+LABELV $2525
+LABELV $2511
+LABELV $2508
+LABELV $2490
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2535
+ARGP4
+ADDRLP4 3252
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3252
+INDIRI4
+CNSTI4 0
+NEI4 $2533
+CNSTI4 0
+RETI4
+ADDRGP4 $2472
+JUMPV
+LABELV $2533
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2538
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $2536
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2539
+CNSTI4 3
+ARGI4
+ADDRGP4 $2542
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2539
+CNSTI4 0
+RETI4
+ADDRGP4 $2472
+JUMPV
+LABELV $2536
+CNSTI4 0
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 1416
+ADDRLP4 3260
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2546
+JUMPV
+LABELV $2543
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2550
+JUMPV
+LABELV $2547
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2553
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3264
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $2551
+ADDRGP4 $2548
+JUMPV
+LABELV $2551
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3268
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $2554
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3272
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3272
+INDIRI4
+ASGNI4
+ADDRGP4 $2549
+JUMPV
+LABELV $2554
+LABELV $2548
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3264
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3264
+INDIRI4
+ASGNI4
+LABELV $2550
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2547
+LABELV $2549
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2556
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2558
+CNSTI4 3
+ARGI4
+ADDRGP4 $2561
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2558
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2544
+JUMPV
+LABELV $2556
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2486
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3268
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $2562
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2544
+CNSTI4 3
+ARGI4
+ADDRGP4 $2567
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2544
+JUMPV
+LABELV $2562
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2535
+ARGP4
+ADDRLP4 3272
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3272
+INDIRI4
+CNSTI4 0
+NEI4 $2568
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3276
+ADDRGP4 BotFuncButtonActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3276
+INDIRI4
+CNSTI4 0
+NEI4 $2570
+ADDRGP4 $2544
+JUMPV
+LABELV $2570
+ADDRLP4 3280
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3280
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2572
+ADDRLP4 3280
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2572
+ADDRLP4 3284
+CNSTI4 44
+ASGNI4
+ADDRLP4 3280
+INDIRP4
+ADDRLP4 3284
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3284
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2572
+ADDRLP4 3288
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3280
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3288
+INDIRF4
+LEF4 $2572
+ADDRLP4 3280
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3288
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $2572
+ADDRGP4 $2544
+JUMPV
+LABELV $2572
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3292
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 0
+EQI4 $2574
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3300
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3300
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $2576
+ADDRGP4 $2544
+JUMPV
+LABELV $2576
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $2574
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2472
+JUMPV
+LABELV $2568
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2580
+ARGP4
+ADDRLP4 3276
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3276
+INDIRI4
+CNSTI4 0
+NEI4 $2578
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3280
+ADDRGP4 BotTriggerMultipleActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+NEI4 $2581
+ADDRGP4 $2544
+JUMPV
+LABELV $2581
+ADDRLP4 3284
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3284
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2583
+ADDRLP4 3284
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2583
+ADDRLP4 3288
+CNSTI4 44
+ASGNI4
+ADDRLP4 3284
+INDIRP4
+ADDRLP4 3288
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3288
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2583
+ADDRLP4 3292
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3284
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3292
+INDIRF4
+LEF4 $2583
+ADDRLP4 3284
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3292
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $2583
+ADDRGP4 $2544
+JUMPV
+LABELV $2583
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3296
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3296
+INDIRI4
+CNSTI4 0
+EQI4 $2585
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3304
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3304
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $2587
+ADDRGP4 $2544
+JUMPV
+LABELV $2587
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $2585
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2472
+JUMPV
+LABELV $2578
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2591
+ARGP4
+ADDRLP4 3280
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+NEI4 $2589
+ADDRGP4 $2544
+JUMPV
+LABELV $2589
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2594
+ARGP4
+ADDRLP4 3284
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3284
+INDIRI4
+CNSTI4 0
+EQI4 $2596
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2595
+ARGP4
+ADDRLP4 3288
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $2592
+LABELV $2596
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2538
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136+128
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3292
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 0
+EQI4 $2597
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3296
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3296
+INDIRI4
+ASGNI4
+LABELV $2597
+LABELV $2592
+LABELV $2544
+LABELV $2546
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+LTI4 $2600
+ADDRLP4 132
+INDIRI4
+CNSTI4 10
+LTI4 $2543
+LABELV $2600
+CNSTI4 0
+RETI4
+LABELV $2472
+endproc BotGetActivateGoal 3308 20
+export BotGoForActivateGoal
+proc BotGoForActivateGoal 144 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $2602
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $2602
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotPushOntoActivateGoalStack
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $2605
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2607
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2601
+JUMPV
+LABELV $2605
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $2601
+endproc BotGoForActivateGoal 144 8
+export BotPrintActivateGoalInfo
+proc BotPrintActivateGoalInfo 296 36
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $2486
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2609
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $2611
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2610
+JUMPV
+LABELV $2609
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $2612
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $2610
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ARGP4
+ADDRGP4 trap_EA_Say
+CALLV
+pop
+LABELV $2608
+endproc BotPrintActivateGoalInfo 296 36
+export BotRandomMove
+proc BotRandomMove 32 16
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1135869952
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $2613
+endproc BotRandomMove 32 16
+lit
+align 4
+LABELV $2617
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAIBlocked
+code
+proc BotAIBlocked 472 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 180
+ADDRGP4 $2617
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2618
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $2616
+JUMPV
+LABELV $2618
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $2620
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRGP4 $2616
+JUMPV
+LABELV $2620
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 440
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 440
+INDIRI4
+EQI4 $2622
+ADDRLP4 28+104
+INDIRI4
+ADDRLP4 440
+INDIRI4
+LEI4 $2622
+ADDRLP4 28+104
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+GTI4 $2622
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28+20
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRLP4 444
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 436
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+EQI4 $2627
+ADDRLP4 448
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 448
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2629
+ADDRLP4 448
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2629
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2629
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192+4+40
+INDIRI4
+ARGI4
+ADDRLP4 452
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 0
+NEI4 $2631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+LABELV $2631
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $2628
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+EQI4 $2628
+ADDRGP4 $2616
+JUMPV
+LABELV $2627
+ADDRLP4 192
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+LABELV $2628
+LABELV $2622
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 448
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 448
+INDIRF4
+CNSTF4 1036831949
+GEF4 $2639
+ADDRLP4 168
+CNSTF4 0
+ASGNF4
+ADDRLP4 452
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 168+4
+CNSTF4 1135869952
+ADDRLP4 452
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 168+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 168
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 456
+CNSTP4 0
+ASGNP4
+ADDRLP4 456
+INDIRP4
+ARGP4
+ADDRLP4 456
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2639
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2643
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $2643
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+NEI4 $2651
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+NEI4 $2649
+LABELV $2651
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 0
+NEI4 $2652
+ADDRLP4 464
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+ASGNP4
+ADDRLP4 464
+INDIRP4
+ADDRLP4 464
+INDIRP4
+INDIRI4
+CNSTI4 16
+BXORI4
+ASGNI4
+ADDRLP4 468
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 468
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 468
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+LABELV $2652
+LABELV $2649
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1053609165
+SUBF4
+GEF4 $2660
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_NBG
+CVPU4 4
+NEU4 $2662
+ADDRFP4 0
+INDIRP4
+CNSTI4 5968
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2663
+JUMPV
+LABELV $2662
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_LTG
+CVPU4 4
+NEU4 $2664
+ADDRFP4 0
+INDIRP4
+CNSTI4 5964
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2664
+LABELV $2663
+LABELV $2660
+LABELV $2616
+endproc BotAIBlocked 472 16
+export BotAIPredictObstacles
+proc BotAIPredictObstacles 324 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 bot_predictobstacles+12
+INDIRI4
+CNSTI4 0
+NEI4 $2667
+CNSTI4 0
+RETI4
+ADDRGP4 $2666
+JUMPV
+LABELV $2667
+ADDRFP4 0
+INDIRP4
+CNSTI4 6108
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $2670
+ADDRFP4 0
+INDIRP4
+CNSTI4 6104
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+LEF4 $2670
+CNSTI4 0
+RETI4
+ADDRGP4 $2666
+JUMPV
+LABELV $2670
+ADDRFP4 0
+INDIRP4
+CNSTI4 6108
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6104
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100
+ARGI4
+CNSTI4 1000
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTI4 1024
+ARGI4
+CNSTI4 67108864
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_AAS_PredictRoute
+CALLI4
+pop
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2672
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2673
+ADDRLP4 300
+CNSTI4 24
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 255
+ADDRLP4 300
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 300
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2673
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 304
+CNSTP4 0
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $2673
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2673
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2685
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2685
+ADDRFP4 0
+INDIRP4
+CNSTI4 6912
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2685
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48+4+40
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+NEI4 $2687
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2666
+JUMPV
+LABELV $2687
+ADDRLP4 48
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRGP4 $2673
+JUMPV
+LABELV $2672
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2691
+ADDRLP4 0+24
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $2694
+LABELV $2694
+LABELV $2691
+LABELV $2673
+CNSTI4 0
+RETI4
+LABELV $2666
+endproc BotAIPredictObstacles 324 44
+export BotCheckConsoleMessages
+proc BotCheckConsoleMessages 1012 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 908
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 $2699
+JUMPV
+LABELV $2698
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 948
+ADDRGP4 trap_BotNumConsoleMessages
+CALLI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 10
+GEI4 $2701
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2703
+ADDRLP4 952
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 952
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+LEF4 $2703
+ADDRGP4 $2700
+JUMPV
+LABELV $2703
+LABELV $2701
+ADDRLP4 276
+ADDRLP4 0+12
+ASGNP4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2708
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 952
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+CNSTI4 0
+EQI4 $2711
+ADDRLP4 276
+ADDRLP4 288+264+16
+INDIRI1
+CVII4 1
+ADDRLP4 0+12
+ADDP4
+ASGNP4
+LABELV $2711
+LABELV $2708
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnifyWhiteSpaces
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 952
+ADDRGP4 BotSynonymContext
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 952
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 trap_BotReplaceSynonyms
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 956
+ADDRGP4 BotMatchMessage
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+NEI4 $2717
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2720
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+NEI4 $2720
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 960
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $2724
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2699
+JUMPV
+LABELV $2724
+ADDRLP4 288+260
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $2727
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2699
+JUMPV
+LABELV $2727
+ADDRLP4 288
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 872
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 288
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 616
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 872
+ARGP4
+ADDRLP4 964
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 964
+INDIRI4
+NEI4 $2730
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2699
+JUMPV
+LABELV $2730
+ADDRLP4 616
+ARGP4
+ADDRGP4 trap_UnifyWhiteSpaces
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testrchat+12
+INDIRI4
+CNSTI4 0
+EQI4 $2732
+ADDRGP4 $2735
+ARGP4
+ADDRGP4 $2736
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 968
+CNSTP4 0
+ASGNP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 972
+ADDRGP4 trap_BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $2737
+CNSTI4 1
+ARGI4
+ADDRGP4 $2739
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2733
+JUMPV
+LABELV $2737
+CNSTI4 1
+ARGI4
+ADDRGP4 $2740
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2733
+JUMPV
+LABELV $2732
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Stand
+CVPU4 4
+EQU4 $2741
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 972
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $2741
+ADDRLP4 976
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 976
+INDIRI4
+CNSTI4 0
+NEI4 $2741
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 35
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 980
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 944
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRGP4 NumBots
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1069547520
+ADDRLP4 988
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+DIVF4
+GEF4 $2743
+ADDRLP4 992
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 992
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 944
+INDIRF4
+GEF4 $2743
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 996
+CNSTP4 0
+ASGNP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 1000
+ADDRGP4 trap_BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 1000
+INDIRI4
+CNSTI4 0
+EQI4 $2745
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1008
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 1008
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2747
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+ADDRGP4 $2700
+JUMPV
+LABELV $2745
+LABELV $2743
+LABELV $2741
+LABELV $2733
+LABELV $2720
+LABELV $2717
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+LABELV $2699
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 948
+ADDRGP4 trap_BotNextConsoleMessage
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 948
+INDIRI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 0
+NEI4 $2698
+LABELV $2700
+LABELV $2697
+endproc BotCheckConsoleMessages 1012 48
+export BotCheckForGrenades
+proc BotCheckForGrenades 8 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2751
+ADDRFP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $2749
+LABELV $2751
+ADDRGP4 $2748
+JUMPV
+LABELV $2749
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+LABELV $2748
+endproc BotCheckForGrenades 8 16
+export BotCheckForProxMines
+proc BotCheckForProxMines 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2755
+ADDRFP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 12
+EQI4 $2753
+LABELV $2755
+ADDRGP4 $2752
+JUMPV
+LABELV $2753
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2756
+ADDRGP4 $2752
+JUMPV
+LABELV $2756
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4892
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $2760
+ADDRFP4 0
+INDIRP4
+CNSTI4 4932
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $2758
+LABELV $2760
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4880
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $2761
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $2758
+LABELV $2761
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $2762
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GTI4 $2758
+LABELV $2762
+ADDRGP4 $2752
+JUMPV
+LABELV $2758
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6408
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $2763
+ADDRGP4 $2752
+JUMPV
+LABELV $2763
+ADDRFP4 0
+INDIRP4
+CNSTI4 6408
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 6408
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2752
+endproc BotCheckForProxMines 40 16
+export BotCheckForKamikazeBody
+proc BotCheckForKamikazeBody 0 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $2766
+ADDRGP4 $2765
+JUMPV
+LABELV $2766
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2768
+ADDRGP4 $2765
+JUMPV
+LABELV $2768
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $2765
+endproc BotCheckForKamikazeBody 0 0
+export BotCheckEvents
+proc BotCheckEvents 320 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 272
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 868
+ADDRLP4 272
+INDIRI4
+MULI4
+ADDRGP4 g_entities+608
+ADDP4
+INDIRI4
+NEI4 $2771
+ADDRGP4 $2770
+JUMPV
+LABELV $2771
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDP4
+CNSTI4 868
+ADDRLP4 276
+INDIRI4
+MULI4
+ADDRGP4 g_entities+608
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LEI4 $2775
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+SUBI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 $2776
+JUMPV
+LABELV $2775
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+LABELV $2776
+ADDRLP4 280
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 1
+LTI4 $2777
+ADDRLP4 280
+INDIRI4
+CNSTI4 74
+GTI4 $2855
+ADDRLP4 280
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2856-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2856
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2777
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2778
+address $2777
+address $2777
+address $2840
+address $2777
+address $2777
+address $2841
+address $2797
+address $2809
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2779
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2777
+address $2778
+code
+LABELV $2855
+ADDRLP4 284
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 196
+LTI4 $2777
+ADDRLP4 284
+INDIRI4
+CNSTI4 199
+GTI4 $2777
+ADDRLP4 284
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2858-784
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2858
+address $2778
+address $2778
+address $2778
+address $2778
+code
+LABELV $2779
+ADDRLP4 288
+ADDRFP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 292
+ADDRFP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 296
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2780
+ADDRFP4 0
+INDIRP4
+CNSTI4 5896
+ADDP4
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5892
+ADDP4
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 304
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+ADDRLP4 292
+INDIRI4
+EQI4 $2785
+ADDRLP4 304
+INDIRI4
+CNSTI4 1023
+EQI4 $2785
+ADDRLP4 304
+INDIRI4
+CNSTI4 1022
+NEI4 $2782
+LABELV $2785
+ADDRFP4 0
+INDIRP4
+CNSTI4 5904
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2783
+JUMPV
+LABELV $2782
+ADDRFP4 0
+INDIRP4
+CNSTI4 5904
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2783
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 5924
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2781
+JUMPV
+LABELV $2780
+ADDRLP4 292
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2786
+ADDRFP4 0
+INDIRP4
+CNSTI4 5900
+ADDP4
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5888
+ADDP4
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 5928
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2787
+JUMPV
+LABELV $2786
+ADDRLP4 304
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+NEI4 $2788
+ADDRLP4 288
+INDIRI4
+ADDRLP4 304
+INDIRI4
+NEI4 $2788
+ADDRFP4 0
+INDIRP4
+CNSTI4 5908
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2788
+LABELV $2787
+LABELV $2781
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $2778
+ADDRLP4 288
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 132+124
+INDIRI4
+CNSTI4 1
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2778
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+NEI4 $2778
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2797
+ADDRLP4 288
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+LTI4 $2800
+ADDRLP4 288
+INDIRI4
+CNSTI4 256
+LTI4 $2798
+LABELV $2800
+CNSTI4 3
+ARGI4
+ADDRGP4 $2801
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2778
+JUMPV
+LABELV $2798
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 274
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2804
+ARGP4
+ADDRLP4 292
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $2802
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2805
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRGP4 $2778
+JUMPV
+LABELV $2802
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2808
+ARGP4
+ADDRLP4 296
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $2778
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForPowerups
+CALLV
+pop
+ADDRGP4 $2778
+JUMPV
+LABELV $2809
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $2810
+ADDRLP4 288
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+LTI4 $2778
+ADDRLP4 288
+INDIRI4
+CNSTI4 5
+GTI4 $2778
+ADDRLP4 288
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2821
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2821
+address $2815
+address $2816
+address $2817
+address $2818
+address $2819
+address $2820
+code
+LABELV $2815
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2816
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2817
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2818
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2819
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2820
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2810
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $2778
+ADDRLP4 288
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+LTI4 $2778
+ADDRLP4 288
+INDIRI4
+CNSTI4 5
+GTI4 $2778
+ADDRLP4 288
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2839
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2839
+address $2827
+address $2828
+address $2829
+address $2830
+address $2831
+address $2835
+code
+LABELV $2827
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2828
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2829
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2830
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2831
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+NEI4 $2833
+ADDRLP4 296
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2834
+JUMPV
+LABELV $2833
+ADDRLP4 296
+CNSTI4 1
+ASGNI4
+LABELV $2834
+ADDRLP4 300
+INDIRP4
+CNSTI4 6856
+ADDP4
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2835
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 2
+NEI4 $2837
+ADDRLP4 308
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2838
+JUMPV
+LABELV $2837
+ADDRLP4 308
+CNSTI4 1
+ASGNI4
+LABELV $2838
+ADDRLP4 312
+INDIRP4
+CNSTI4 6856
+ADDP4
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2840
+ADDRGP4 lastteleport_origin
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 lastteleport_time
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $2778
+JUMPV
+LABELV $2841
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2778
+ADDRLP4 288
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+LTI4 $2846
+ADDRLP4 288
+INDIRI4
+CNSTI4 256
+LTI4 $2844
+LABELV $2846
+CNSTI4 3
+ARGI4
+ADDRGP4 $2847
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2778
+JUMPV
+LABELV $2844
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 274
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2850
+ARGP4
+ADDRLP4 292
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $2778
+ADDRFP4 0
+INDIRP4
+CNSTI4 4968
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2778
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $2777
+LABELV $2778
+LABELV $2770
+endproc BotCheckEvents 320 12
+export BotCheckSnapshot
+proc BotCheckSnapshot 244 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6408
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 236
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2862
+JUMPV
+LABELV $2861
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForGrenades
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForProxMines
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForKamikazeBody
+CALLV
+pop
+LABELV $2862
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 236
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotAI_GetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 -1
+NEI4 $2861
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+188
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+192
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+LABELV $2860
+endproc BotCheckSnapshot 244 16
+export BotCheckAir
+proc BotCheckAir 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $2867
+ADDRFP4 0
+INDIRP4
+CNSTI4 4832
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $2869
+ADDRGP4 $2866
+JUMPV
+LABELV $2869
+LABELV $2867
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2866
+endproc BotCheckAir 4 4
+export BotAlternateRoute
+proc BotAlternateRoute 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2872
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $2874
+ADDRFP4 4
+INDIRP4
+RETP4
+ADDRGP4 $2871
+JUMPV
+LABELV $2874
+ADDRFP4 0
+INDIRP4
+CNSTI4 4844
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5872
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2876
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+GEI4 $2876
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2876
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+RETP4
+ADDRGP4 $2871
+JUMPV
+LABELV $2872
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $2871
+endproc BotAlternateRoute 16 16
+export BotGetAlternateRouteGoal
+proc BotGetAlternateRouteGoal 28 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $2879
+ADDRLP4 12
+ADDRGP4 red_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 red_numaltroutegoals
+INDIRI4
+ASGNI4
+ADDRGP4 $2880
+JUMPV
+LABELV $2879
+ADDRLP4 12
+ADDRGP4 blue_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 blue_numaltroutegoals
+INDIRI4
+ASGNI4
+LABELV $2880
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2881
+CNSTI4 0
+RETI4
+ADDRGP4 $2878
+JUMPV
+LABELV $2881
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $2883
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2883
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $2878
+endproc BotGetAlternateRouteGoal 28 0
+export BotSetupAlternativeRouteGoals
+proc BotSetupAlternativeRouteGoals 12 32
+ADDRGP4 altroutegoals_setup
+INDIRI4
+CNSTI4 0
+EQI4 $2886
+ADDRGP4 $2885
+JUMPV
+LABELV $2886
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $2888
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2892
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $2890
+CNSTI4 2
+ARGI4
+ADDRGP4 $2893
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2890
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+CNSTI4 0
+EQI4 $2889
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2889
+JUMPV
+LABELV $2888
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $2901
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2905
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $2903
+CNSTI4 2
+ARGI4
+ADDRGP4 $2906
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2903
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2902
+JUMPV
+LABELV $2901
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $2911
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2905
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $2913
+CNSTI4 2
+ARGI4
+ADDRGP4 $2915
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2913
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 redobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 blueobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2912
+JUMPV
+LABELV $2911
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $2920
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2905
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $2922
+CNSTI4 2
+ARGI4
+ADDRGP4 $2924
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2922
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 redobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 blueobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $2920
+LABELV $2912
+LABELV $2902
+LABELV $2889
+ADDRGP4 altroutegoals_setup
+CNSTI4 1
+ASGNI4
+LABELV $2885
+endproc BotSetupAlternativeRouteGoals 12 32
+export BotDeathmatchAI
+proc BotDeathmatchAI 1348 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5912
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2930
+ADDRLP4 1316
+ADDRFP4 0
+INDIRP4
+CNSTI4 5912
+ADDP4
+ASGNP4
+ADDRLP4 1316
+INDIRP4
+ADDRLP4 1316
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5912
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2932
+ADDRGP4 $2929
+JUMPV
+LABELV $2932
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 148
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRGP4 $2934
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 109
+NEI4 $2935
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $2936
+JUMPV
+LABELV $2935
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 102
+NEI4 $2937
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $2938
+JUMPV
+LABELV $2937
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+LABELV $2938
+LABELV $2936
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotSetChatName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5940
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5944
+ADDP4
+ADDRGP4 PERS_HITS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5912
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 BotSetupAlternativeRouteGoals
+CALLV
+pop
+LABELV $2930
+ADDRLP4 1316
+ADDRFP4 0
+INDIRP4
+CNSTI4 5876
+ADDP4
+ASGNP4
+ADDRLP4 1316
+INDIRP4
+ADDRLP4 1316
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1320
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+NEI4 $2939
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeleportTime
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUpdateInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckSnapshot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAir
+CALLV
+pop
+LABELV $2939
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckConsoleMessages
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+NEI4 $2941
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1328
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+NEI4 $2941
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamAI
+CALLV
+pop
+LABELV $2941
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2943
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2945
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $2943
+ADDRFP4 0
+INDIRP4
+CNSTI4 5920
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2946
+ADDRFP4 0
+INDIRP4
+CNSTI4 5960
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+LEF4 $2946
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1336
+ADDRGP4 BotChat_EnterGame
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+CNSTI4 0
+EQI4 $2948
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1344
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 1344
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2950
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $2948
+ADDRFP4 0
+INDIRP4
+CNSTI4 5920
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2946
+ADDRGP4 BotResetNodeSwitches
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2951
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1340
+ADDRFP4 0
+INDIRP4
+CNSTI4 4796
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+CNSTI4 0
+EQI4 $2955
+ADDRGP4 $2953
+JUMPV
+LABELV $2955
+LABELV $2952
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $2951
+LABELV $2953
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2957
+ADDRGP4 $2929
+JUMPV
+LABELV $2957
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $2959
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotDumpGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotDumpAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDumpNodeSwitches
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 3
+ARGI4
+ADDRGP4 $2961
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2959
+ADDRFP4 0
+INDIRP4
+CNSTI4 5940
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5944
+ADDP4
+ADDRGP4 PERS_HITS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2929
+endproc BotDeathmatchAI 1348 20
+export BotSetEntityNumForGoalWithModel
+proc BotSetEntityNumForGoalWithModel 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2966
+JUMPV
+LABELV $2963
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2968
+ADDRGP4 $2964
+JUMPV
+LABELV $2968
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2970
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $2970
+ADDRGP4 $2964
+JUMPV
+LABELV $2970
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2972
+ADDRGP4 $2964
+JUMPV
+LABELV $2972
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2976
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2962
+JUMPV
+LABELV $2976
+LABELV $2964
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+LABELV $2966
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2963
+LABELV $2962
+endproc BotSetEntityNumForGoalWithModel 44 4
+export BotSetEntityNumForGoal
+proc BotSetEntityNumForGoal 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2982
+JUMPV
+LABELV $2979
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2984
+ADDRGP4 $2980
+JUMPV
+LABELV $2984
+ADDRLP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $2986
+ADDRGP4 $2980
+JUMPV
+LABELV $2986
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2990
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2978
+JUMPV
+LABELV $2990
+LABELV $2980
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+LABELV $2982
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2979
+LABELV $2978
+endproc BotSetEntityNumForGoal 36 8
+export BotGoalForBSPEntity
+proc BotGoalForBSPEntity 1128 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $2996
+JUMPV
+LABELV $2993
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2486
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $2997
+ADDRGP4 $2994
+JUMPV
+LABELV $2997
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $2999
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2502
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1120
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $3001
+CNSTI4 0
+RETI4
+ADDRGP4 $2992
+JUMPV
+LABELV $3001
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040+8
+ADDRLP4 1040+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 1052
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1052+8
+ADDRLP4 1052+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 1124
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $3005
+CNSTI4 0
+RETI4
+ADDRGP4 $2992
+JUMPV
+LABELV $3005
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2992
+JUMPV
+LABELV $2999
+LABELV $2994
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+LABELV $2996
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2993
+CNSTI4 0
+RETI4
+LABELV $2992
+endproc BotGoalForBSPEntity 1128 20
+export BotSetupDeathmatchAI
+proc BotSetupDeathmatchAI 156 16
+ADDRGP4 $3008
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 gametype
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRGP4 bot_rocketjump
+ARGP4
+ADDRGP4 $3009
+ARGP4
+ADDRGP4 $2736
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_grapple
+ARGP4
+ADDRGP4 $3010
+ARGP4
+ADDRGP4 $3011
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_fastchat
+ARGP4
+ADDRGP4 $3012
+ARGP4
+ADDRGP4 $3011
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_nochat
+ARGP4
+ADDRGP4 $3013
+ARGP4
+ADDRGP4 $3011
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 $2735
+ARGP4
+ADDRGP4 $3011
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_challenge
+ARGP4
+ADDRGP4 $3014
+ARGP4
+ADDRGP4 $3011
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_predictobstacles
+ARGP4
+ADDRGP4 $3015
+ARGP4
+ADDRGP4 $2736
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 g_spSkill
+ARGP4
+ADDRGP4 $3016
+ARGP4
+ADDRGP4 $3017
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $3018
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3022
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $3020
+CNSTI4 2
+ARGI4
+ADDRGP4 $3023
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3020
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3026
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $3019
+CNSTI4 2
+ARGI4
+ADDRGP4 $3027
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $3019
+JUMPV
+LABELV $3018
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $3028
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2892
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $3030
+CNSTI4 2
+ARGI4
+ADDRGP4 $3032
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3030
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3022
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $3033
+CNSTI4 2
+ARGI4
+ADDRGP4 $3035
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3033
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3026
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+GEI4 $3029
+CNSTI4 2
+ARGI4
+ADDRGP4 $3038
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $3029
+JUMPV
+LABELV $3028
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $3039
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3043
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $3041
+CNSTI4 2
+ARGI4
+ADDRGP4 $3044
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3041
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 $3045
+ARGP4
+ADDRGP4 BotSetEntityNumForGoal
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3048
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $3046
+CNSTI4 2
+ARGI4
+ADDRGP4 $3049
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3046
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 $3050
+ARGP4
+ADDRGP4 BotSetEntityNumForGoal
+CALLV
+pop
+ADDRGP4 $3040
+JUMPV
+LABELV $3039
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $3051
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3043
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $3053
+CNSTI4 2
+ARGI4
+ADDRGP4 $3055
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3053
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 $3045
+ARGP4
+ADDRGP4 BotSetEntityNumForGoal
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3048
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $3056
+CNSTI4 2
+ARGI4
+ADDRGP4 $3058
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3056
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 $3050
+ARGP4
+ADDRGP4 BotSetEntityNumForGoal
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2905
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+GEI4 $3059
+CNSTI4 2
+ARGI4
+ADDRGP4 $2924
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3059
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 $3061
+ARGP4
+ADDRGP4 BotSetEntityNumForGoal
+CALLV
+pop
+LABELV $3051
+LABELV $3040
+LABELV $3029
+LABELV $3019
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 max_bspmodelindex
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $3065
+JUMPV
+LABELV $3062
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $3066
+ADDRGP4 $3063
+JUMPV
+LABELV $3066
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $3068
+ADDRLP4 4+1
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+LEI4 $3071
+ADDRGP4 max_bspmodelindex
+ADDRLP4 132
+INDIRI4
+ASGNI4
+LABELV $3071
+LABELV $3068
+LABELV $3063
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $3065
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $3062
+ADDRGP4 BotInitWaypoints
+CALLV
+pop
+LABELV $3007
+endproc BotSetupDeathmatchAI 156 16
+export BotShutdownDeathmatchAI
+proc BotShutdownDeathmatchAI 0 0
+ADDRGP4 altroutegoals_setup
+CNSTI4 0
+ASGNI4
+LABELV $3073
+endproc BotShutdownDeathmatchAI 0 0
+bss
+export blue_numaltroutegoals
+align 4
+LABELV blue_numaltroutegoals
+skip 4
+export blue_altroutegoals
+align 4
+LABELV blue_altroutegoals
+skip 768
+export red_numaltroutegoals
+align 4
+LABELV red_numaltroutegoals
+skip 4
+export red_altroutegoals
+align 4
+LABELV red_altroutegoals
+skip 768
+export altroutegoals_setup
+align 4
+LABELV altroutegoals_setup
+skip 4
+export max_bspmodelindex
+align 4
+LABELV max_bspmodelindex
+skip 4
+export lastteleport_time
+align 4
+LABELV lastteleport_time
+skip 4
+export lastteleport_origin
+align 4
+LABELV lastteleport_origin
+skip 12
+import bot_developer
+export g_spSkill
+align 4
+LABELV g_spSkill
+skip 272
+export bot_predictobstacles
+align 4
+LABELV bot_predictobstacles
+skip 272
+export botai_freewaypoints
+align 4
+LABELV botai_freewaypoints
+skip 4
+export botai_waypoints
+align 4
+LABELV botai_waypoints
+skip 12800
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+export neutralobelisk
+align 4
+LABELV neutralobelisk
+skip 56
+export blueobelisk
+align 4
+LABELV blueobelisk
+skip 56
+export redobelisk
+align 4
+LABELV redobelisk
+skip 56
+export ctf_neutralflag
+align 4
+LABELV ctf_neutralflag
+skip 56
+export ctf_blueflag
+align 4
+LABELV ctf_blueflag
+skip 56
+export ctf_redflag
+align 4
+LABELV ctf_redflag
+skip 56
+export bot_challenge
+align 4
+LABELV bot_challenge
+skip 272
+export bot_testrchat
+align 4
+LABELV bot_testrchat
+skip 272
+export bot_nochat
+align 4
+LABELV bot_nochat
+skip 272
+export bot_fastchat
+align 4
+LABELV bot_fastchat
+skip 272
+export bot_rocketjump
+align 4
+LABELV bot_rocketjump
+skip 272
+export bot_grapple
+align 4
+LABELV bot_grapple
+skip 272
+import maxclients
+export gametype
+align 4
+LABELV gametype
+skip 4
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $3061
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3058
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3055
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3050
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3049
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3048
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3045
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3044
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3043
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3038
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3035
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3032
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3027
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3026
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3023
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3022
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3017
+byte 1 50
+byte 1 0
+align 1
+LABELV $3016
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $3015
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3014
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $3013
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $3012
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $3011
+byte 1 48
+byte 1 0
+align 1
+LABELV $3010
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3009
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $3008
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2961
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2950
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2945
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2934
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $2924
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $2915
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $2906
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $2905
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $2893
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2892
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $2850
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2847
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2808
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2805
+byte 1 75
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $2804
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2801
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2747
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2740
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $2739
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $2736
+byte 1 49
+byte 1 0
+align 1
+LABELV $2735
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2612
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2611
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2607
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $2595
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $2594
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $2591
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2580
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2567
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2561
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $2553
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $2542
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2538
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2535
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2502
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2497
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $2492
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2489
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2486
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2485
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2473
+byte 1 42
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2292
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $2269
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2266
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $2166
+byte 1 109
+byte 1 112
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $2165
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $2164
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $2160
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1246
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1245
+byte 1 72
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1244
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1243
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1242
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1033
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 87
+byte 1 97
+byte 1 121
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1017
+byte 1 116
+byte 1 0
+align 1
+LABELV $686
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $672
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $574
+byte 1 93
+byte 1 0
+align 1
+LABELV $573
+byte 1 91
+byte 1 0
+align 1
+LABELV $572
+byte 1 32
+byte 1 0
+align 1
+LABELV $530
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $529
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $524
+byte 1 110
+byte 1 0
+align 1
+LABELV $523
+byte 1 91
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 0
+align 1
+LABELV $522
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $235
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $210
+byte 1 105
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $187
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $162
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $161
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
@@ -0,0 +1,11500 @@
+export BotAI_Print
+code
+proc BotAI_Print 2056 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 2048
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 2052
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 1
+LTI4 $59
+ADDRLP4 2052
+INDIRI4
+CNSTI4 5
+GTI4 $59
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $72-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $72
+address $61
+address $63
+address $65
+address $67
+address $69
+code
+LABELV $61
+ADDRGP4 $62
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $60
+JUMPV
+LABELV $63
+ADDRGP4 $64
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $60
+JUMPV
+LABELV $65
+ADDRGP4 $66
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $60
+JUMPV
+LABELV $67
+ADDRGP4 $68
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $60
+JUMPV
+LABELV $69
+ADDRGP4 $70
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $60
+JUMPV
+LABELV $59
+ADDRGP4 $71
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $60
+LABELV $57
+endproc BotAI_Print 2056 16
+export BotAI_Trace
+proc BotAI_Trace 56 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0+4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0+24+12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 41
+ADDP4
+ADDRLP4 0+24+17
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0+24+16
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0+44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $74
+endproc BotAI_Trace 56 28
+export BotAI_GetClientState
+proc BotAI_GetClientState 4 12
+ADDRLP4 0
+CNSTI4 868
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $88
+CNSTI4 0
+RETI4
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $90
+CNSTI4 0
+RETI4
+ADDRGP4 $87
+JUMPV
+LABELV $90
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ARGP4
+CNSTU4 508
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $87
+endproc BotAI_GetClientState 4 12
+export BotAI_GetEntityState
+proc BotAI_GetEntityState 4 12
+ADDRLP4 0
+CNSTI4 868
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 236
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $93
+CNSTI4 0
+RETI4
+ADDRGP4 $92
+JUMPV
+LABELV $93
+ADDRLP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $95
+CNSTI4 0
+RETI4
+ADDRGP4 $92
+JUMPV
+LABELV $95
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $97
+CNSTI4 0
+RETI4
+ADDRGP4 $92
+JUMPV
+LABELV $97
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTU4 236
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $92
+endproc BotAI_GetEntityState 4 12
+export BotAI_GetSnapshotEntity
+proc BotAI_GetSnapshotEntity 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_BotGetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $100
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 236
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $100
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+RETI4
+LABELV $99
+endproc BotAI_GetSnapshotEntity 8 12
+export BotAI_BotInitialChat
+proc BotAI_BotInitialChat 56 44
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 32
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 40
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 40
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $104
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $108
+ADDRGP4 $106
+JUMPV
+LABELV $108
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 40
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $105
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $104
+LABELV $106
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotSynonymContext
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8+4
+INDIRP4
+ARGP4
+ADDRLP4 8+8
+INDIRP4
+ARGP4
+ADDRLP4 8+12
+INDIRP4
+ARGP4
+ADDRLP4 8+16
+INDIRP4
+ARGP4
+ADDRLP4 8+20
+INDIRP4
+ARGP4
+ADDRLP4 8+24
+INDIRP4
+ARGP4
+ADDRLP4 8+28
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotInitialChat
+CALLV
+pop
+LABELV $102
+endproc BotAI_BotInitialChat 56 44
+export BotTestAAS
+proc BotTestAAS 64 16
+ADDRGP4 bot_testsolid
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testclusters
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testsolid+12
+INDIRI4
+CNSTI4 0
+EQI4 $118
+ADDRLP4 56
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $121
+ADDRGP4 $117
+JUMPV
+LABELV $121
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $123
+CNSTI4 1
+ARGI4
+ADDRGP4 $125
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $119
+JUMPV
+LABELV $123
+CNSTI4 1
+ARGI4
+ADDRGP4 $126
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $119
+JUMPV
+LABELV $118
+ADDRGP4 bot_testclusters+12
+INDIRI4
+CNSTI4 0
+EQI4 $127
+ADDRLP4 56
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $130
+ADDRGP4 $117
+JUMPV
+LABELV $130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $132
+CNSTI4 1
+ARGI4
+ADDRGP4 $134
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $133
+JUMPV
+LABELV $132
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $135
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4+12
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $133
+LABELV $127
+LABELV $119
+LABELV $117
+endproc BotTestAAS 64 16
+export BotReportStatus
+proc BotReportStatus 560 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 548
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+NEI4 $138
+ADDRLP4 288
+ADDRGP4 $140
+ASGNP4
+ADDRGP4 $139
+JUMPV
+LABELV $138
+ADDRLP4 288
+ADDRGP4 $141
+ASGNP4
+LABELV $139
+ADDRLP4 256
+ARGP4
+ADDRGP4 $142
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $143
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 0
+EQI4 $144
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 556
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 1
+NEI4 $147
+ADDRLP4 256
+ARGP4
+ADDRGP4 $149
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $144
+JUMPV
+LABELV $147
+ADDRLP4 256
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $151
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 552
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 0
+EQI4 $152
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 556
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 1
+NEI4 $155
+ADDRLP4 256
+ARGP4
+ADDRGP4 $149
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $152
+JUMPV
+LABELV $155
+ADDRLP4 256
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $152
+JUMPV
+LABELV $151
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $157
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 0
+EQI4 $159
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 556
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 1
+NEI4 $161
+ADDRLP4 256
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $162
+JUMPV
+LABELV $161
+ADDRLP4 256
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $164
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $162
+LABELV $159
+LABELV $157
+LABELV $152
+LABELV $144
+ADDRLP4 552
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 1
+LTI4 $165
+ADDRLP4 552
+INDIRI4
+CNSTI4 13
+GTI4 $165
+ADDRLP4 552
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $193-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $193
+address $168
+address $170
+address $172
+address $182
+address $184
+address $186
+address $178
+address $178
+address $180
+address $174
+address $176
+address $190
+address $188
+code
+LABELV $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $170
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $172
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $174
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $175
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $176
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $178
+CNSTI4 1
+ARGI4
+ADDRGP4 $179
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $180
+CNSTI4 1
+ARGI4
+ADDRGP4 $181
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $182
+CNSTI4 1
+ARGI4
+ADDRGP4 $183
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $184
+CNSTI4 1
+ARGI4
+ADDRGP4 $185
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $186
+CNSTI4 1
+ARGI4
+ADDRGP4 $187
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $188
+CNSTI4 1
+ARGI4
+ADDRGP4 $189
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $190
+CNSTI4 1
+ARGI4
+ADDRGP4 $191
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $165
+CNSTI4 1
+ARGI4
+ADDRGP4 $192
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $166
+LABELV $137
+endproc BotReportStatus 560 24
+export BotTeamplayReport
+proc BotTeamplayReport 1052 12
+CNSTI4 1
+ARGI4
+ADDRGP4 $196
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $200
+JUMPV
+LABELV $197
+ADDRLP4 1028
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $204
+ADDRLP4 1028
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $202
+LABELV $204
+ADDRGP4 $198
+JUMPV
+LABELV $202
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1032
+INDIRU4
+CNSTU4 0
+EQU4 $208
+ADDRLP4 4
+ARGP4
+ADDRGP4 $207
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRU4
+CNSTU4 0
+NEU4 $205
+LABELV $208
+ADDRGP4 $198
+JUMPV
+LABELV $205
+ADDRLP4 4
+ARGP4
+ADDRGP4 $211
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 1
+NEI4 $209
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotReportStatus
+CALLV
+pop
+LABELV $209
+LABELV $198
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $200
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $197
+CNSTI4 1
+ARGI4
+ADDRGP4 $212
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $216
+JUMPV
+LABELV $213
+ADDRLP4 1028
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $220
+ADDRLP4 1028
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $218
+LABELV $220
+ADDRGP4 $214
+JUMPV
+LABELV $218
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1032
+INDIRU4
+CNSTU4 0
+EQU4 $223
+ADDRLP4 4
+ARGP4
+ADDRGP4 $207
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRU4
+CNSTU4 0
+NEU4 $221
+LABELV $223
+ADDRGP4 $214
+JUMPV
+LABELV $221
+ADDRLP4 4
+ARGP4
+ADDRGP4 $211
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 2
+NEI4 $224
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotReportStatus
+CALLV
+pop
+LABELV $224
+LABELV $214
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $216
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $213
+LABELV $195
+endproc BotTeamplayReport 1052 12
+export BotSetInfoConfigString
+proc BotSetInfoConfigString 880 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 256
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 864
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 864
+INDIRI4
+CNSTI4 0
+NEI4 $227
+ADDRLP4 544
+ADDRGP4 $140
+ASGNP4
+ADDRGP4 $228
+JUMPV
+LABELV $227
+ADDRLP4 544
+ADDRGP4 $141
+ASGNP4
+LABELV $228
+ADDRLP4 512
+ARGP4
+ADDRGP4 $142
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $229
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 868
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 0
+EQI4 $230
+ADDRLP4 512
+ARGP4
+ADDRGP4 $233
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 868
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 0
+EQI4 $235
+ADDRLP4 512
+ARGP4
+ADDRGP4 $233
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $238
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 868
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 0
+EQI4 $240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 872
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 872
+INDIRI4
+CNSTI4 1
+NEI4 $242
+ADDRLP4 512
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $244
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $243
+JUMPV
+LABELV $242
+ADDRLP4 512
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $244
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $243
+LABELV $240
+LABELV $238
+LABELV $235
+LABELV $230
+ADDRLP4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 1
+LTI4 $245
+ADDRLP4 868
+INDIRI4
+CNSTI4 13
+GTI4 $245
+ADDRLP4 868
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $274-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $274
+address $248
+address $250
+address $252
+address $262
+address $264
+address $266
+address $258
+address $258
+address $260
+address $254
+address $256
+address $270
+address $268
+code
+LABELV $248
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $249
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $251
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $252
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $254
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $255
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $256
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $258
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $259
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $260
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $261
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $262
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $263
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $264
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $265
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $266
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $267
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $268
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $269
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $270
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $271
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $245
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 808
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRLP4 808+44
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $246
+ADDRGP4 $276
+ARGP4
+ADDRLP4 544
+INDIRP4
+ARGP4
+ADDRLP4 512
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 876
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 548
+ADDRLP4 876
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 991
+ADDI4
+ARGI4
+ADDRLP4 548
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $226
+endproc BotSetInfoConfigString 880 16
+export BotUpdateInfoConfigStrings
+proc BotUpdateInfoConfigStrings 1044 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $281
+JUMPV
+LABELV $278
+ADDRLP4 1028
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $285
+ADDRLP4 1028
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $283
+LABELV $285
+ADDRGP4 $279
+JUMPV
+LABELV $283
+ADDRLP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1032
+INDIRU4
+CNSTU4 0
+EQU4 $288
+ADDRLP4 4
+ARGP4
+ADDRGP4 $207
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRU4
+CNSTU4 0
+NEU4 $286
+LABELV $288
+ADDRGP4 $279
+JUMPV
+LABELV $286
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetInfoConfigString
+CALLV
+pop
+LABELV $279
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $281
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $278
+LABELV $277
+endproc BotUpdateInfoConfigStrings 1044 12
+export BotInterbreedBots
+proc BotInterbreedBots 288 20
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $290
+ADDRLP4 272
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $294
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $294
+ADDRLP4 276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 276
+INDIRI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 5928
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 280
+INDIRP4
+CNSTI4 5924
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $295
+JUMPV
+LABELV $294
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+LABELV $295
+LABELV $291
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $290
+CNSTI4 64
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 268
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_GeneticParentsAndChildSelection
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $296
+ADDRLP4 276
+CNSTI4 2
+ASGNI4
+ADDRLP4 280
+ADDRGP4 botstates
+ASGNP4
+ADDRLP4 284
+CNSTI4 6420
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LSHI4
+ADDRLP4 280
+INDIRP4
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LSHI4
+ADDRLP4 280
+INDIRP4
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LSHI4
+ADDRLP4 280
+INDIRP4
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotInterbreedGoalFuzzyLogic
+CALLV
+pop
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_BotMutateGoalFuzzyLogic
+CALLV
+pop
+LABELV $296
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $298
+ADDRLP4 276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $302
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $302
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 5928
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 5924
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $302
+LABELV $299
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $298
+LABELV $289
+endproc BotInterbreedBots 288 20
+export BotWriteInterbreeded
+proc BotWriteInterbreeded 24 8
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $305
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $309
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $309
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 5928
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 5924
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRLP4 4
+CNSTF4 3212836864
+ASGNF4
+LABELV $310
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $311
+ADDRLP4 8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $311
+LABELV $306
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $305
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $313
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotSaveGoalFuzzyLogic
+CALLV
+pop
+LABELV $313
+LABELV $304
+endproc BotWriteInterbreeded 24 8
+export BotInterbreedEndMatch
+proc BotInterbreedEndMatch 8 8
+ADDRGP4 bot_interbreed
+INDIRI4
+CNSTI4 0
+NEI4 $316
+ADDRGP4 $315
+JUMPV
+LABELV $316
+ADDRLP4 0
+ADDRGP4 bot_interbreedmatchcount
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 bot_interbreedcycle+12
+INDIRI4
+LTI4 $318
+ADDRGP4 bot_interbreedmatchcount
+CNSTI4 0
+ASGNI4
+ADDRGP4 bot_interbreedwrite
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_interbreedwrite+16
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRU4
+CNSTU4 0
+EQU4 $321
+ADDRGP4 bot_interbreedwrite+16
+ARGP4
+ADDRGP4 BotWriteInterbreeded
+CALLV
+pop
+ADDRGP4 $325
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $321
+ADDRGP4 BotInterbreedBots
+CALLV
+pop
+LABELV $318
+LABELV $315
+endproc BotInterbreedEndMatch 8 8
+export BotInterbreeding
+proc BotInterbreeding 16 20
+ADDRGP4 bot_interbreedchar
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_interbreedchar+16
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRU4
+CNSTU4 0
+NEU4 $328
+ADDRGP4 $327
+JUMPV
+LABELV $328
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+EQI4 $331
+ADDRGP4 $334
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $333
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 ExitLevel
+CALLV
+pop
+ADDRGP4 $327
+JUMPV
+LABELV $331
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $335
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $339
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $339
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIShutdownClient
+CALLI4
+pop
+LABELV $339
+LABELV $336
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $335
+ADDRGP4 $341
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $346
+JUMPV
+LABELV $343
+ADDRGP4 $348
+ARGP4
+ADDRGP4 bot_interbreedchar+16
+ARGP4
+CNSTI4 50
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+ADDRGP4 bot_interbreedchar+16
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $344
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $346
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bot_interbreedbots+12
+INDIRI4
+LTI4 $343
+ADDRGP4 $351
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 bot_interbreed
+CNSTI4 1
+ASGNI4
+LABELV $327
+endproc BotInterbreeding 16 20
+export BotEntityInfo
+proc BotEntityInfo 0 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_AAS_EntityInfo
+CALLV
+pop
+LABELV $352
+endproc BotEntityInfo 0 8
+export NumBots
+proc NumBots 0 0
+ADDRGP4 numbots
+INDIRI4
+RETI4
+LABELV $353
+endproc NumBots 0 0
+export BotTeamLeader
+proc BotTeamLeader 12 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $355
+CNSTI4 0
+RETI4
+ADDRGP4 $354
+JUMPV
+LABELV $355
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $359
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $357
+LABELV $359
+CNSTI4 0
+RETI4
+ADDRGP4 $354
+JUMPV
+LABELV $357
+CNSTI4 1
+RETI4
+LABELV $354
+endproc BotTeamLeader 12 4
+export AngleDifference
+proc AngleDifference 12 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $361
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $362
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+GEF4 $365
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $365
+LABELV $362
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $360
+endproc AngleDifference 12 0
+export BotChangeViewAngle
+proc BotChangeViewAngle 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+NEF4 $368
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $367
+JUMPV
+LABELV $368
+ADDRLP4 0
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+LEF4 $370
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $371
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+GEF4 $374
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $374
+LABELV $371
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $376
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $377
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $377
+JUMPV
+LABELV $376
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $380
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $380
+LABELV $377
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+RETF4
+LABELV $367
+endproc BotChangeViewAngle 24 4
+export BotChangeViewAngles
+proc BotChangeViewAngles 80 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $383
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTF4 1008981770
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 28
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1155596288
+ARGF4
+ADDRLP4 32
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 $386
+JUMPV
+LABELV $385
+ADDRLP4 16
+CNSTF4 1028443341
+ASGNF4
+ADDRLP4 8
+CNSTF4 1135869952
+ASGNF4
+LABELV $386
+ADDRLP4 8
+INDIRF4
+CNSTF4 1131413504
+GEF4 $387
+ADDRLP4 8
+CNSTF4 1131413504
+ASGNF4
+LABELV $387
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $389
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $393
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $396
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $396
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 BotChangeViewAngle
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRGP4 $394
+JUMPV
+LABELV $393
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6480
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6480
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $398
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6480
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $398
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6480
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $400
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6480
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $400
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6480
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $402
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $402
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+GEF4 $404
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $404
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6480
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTF4 1055286886
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $394
+LABELV $390
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $406
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $406
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $382
+endproc BotChangeViewAngles 80 16
+export BotInputToUserCommand
+proc BotInputToUserCommand 152 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 24
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $409
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+LABELV $409
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $411
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $411
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $413
+ADDRLP4 60
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $413
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $415
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $415
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $417
+ADDRLP4 68
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $419
+ADDRLP4 72
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $419
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $421
+ADDRLP4 76
+CNSTI4 16
+ASGNI4
+ADDRLP4 80
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+BORI4
+ASGNI4
+LABELV $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1048576
+BANDI4
+CNSTI4 0
+EQI4 $423
+ADDRLP4 84
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $425
+ADDRLP4 88
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $425
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8388608
+BANDI4
+CNSTI4 0
+EQI4 $427
+ADDRLP4 92
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $427
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 16777216
+BANDI4
+CNSTI4 0
+EQI4 $429
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $429
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 33554432
+BANDI4
+CNSTI4 0
+EQI4 $431
+ADDRLP4 100
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 134217728
+BANDI4
+CNSTI4 0
+EQI4 $433
+ADDRLP4 104
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+LABELV $433
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1199570944
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1199570944
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1199570944
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $435
+ADDRLP4 108
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 108
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+SUBI4
+CVII2 4
+ASGNI2
+ADDRLP4 112
+INDIRP4
+ADDRLP4 4
+INDIRI2
+CVII4 2
+ASGNI4
+LABELV $436
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $439
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+LABELV $440
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+CNSTF4 1123942400
+ADDRLP4 108
+INDIRP4
+INDIRF4
+MULF4
+CNSTF4 1137180672
+DIVF4
+ASGNF4
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 124
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 36
+INDIRF4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 36+4
+INDIRF4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 128
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 128
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 132
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 136
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $448
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 140
+INDIRF4
+ASGNF4
+LABELV $448
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $450
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 144
+INDIRF4
+ASGNF4
+LABELV $450
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+LEF4 $452
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 56
+INDIRF4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 48
+INDIRF4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 52
+INDIRF4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $452
+ADDRFP4 4
+INDIRP4
+CNSTI4 21
+ADDP4
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 22
+ADDP4
+ADDRLP4 48
+INDIRF4
+CVFI4 4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 23
+ADDP4
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $454
+ADDRFP4 4
+INDIRP4
+CNSTI4 21
+ADDP4
+CNSTI1 127
+ASGNI1
+LABELV $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $456
+ADDRFP4 4
+INDIRP4
+CNSTI4 21
+ADDP4
+CNSTI1 -127
+ASGNI1
+LABELV $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $458
+ADDRFP4 4
+INDIRP4
+CNSTI4 22
+ADDP4
+CNSTI1 -127
+ASGNI1
+LABELV $458
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $460
+ADDRFP4 4
+INDIRP4
+CNSTI4 22
+ADDP4
+CNSTI1 127
+ASGNI1
+LABELV $460
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $462
+ADDRFP4 4
+INDIRP4
+CNSTI4 23
+ADDP4
+CNSTI1 127
+ASGNI1
+LABELV $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $464
+ADDRFP4 4
+INDIRP4
+CNSTI4 23
+ADDP4
+CNSTI1 127
+ASGNI1
+LABELV $464
+LABELV $408
+endproc BotInputToUserCommand 152 16
+export BotUpdateInput
+proc BotUpdateInput 64 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $467
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $468
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $467
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 BotChangeViewAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_EA_GetInput
+CALLV
+pop
+ADDRLP4 4+32
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $471
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $474
+ADDRLP4 4+32
+ADDRLP4 4+32
+INDIRI4
+CNSTI4 -10
+BANDI4
+ASGNI4
+LABELV $474
+LABELV $471
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotInputToUserCommand
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $477
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 48
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 48
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+LABELV $478
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $477
+LABELV $466
+endproc BotUpdateInput 64 16
+export BotAIRegularUpdate
+proc BotAIRegularUpdate 0 0
+ADDRGP4 regularupdate_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $482
+ADDRGP4 trap_BotUpdateEntityItems
+CALLV
+pop
+ADDRGP4 regularupdate_time
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1050253722
+ADDF4
+ASGNF4
+LABELV $482
+LABELV $481
+endproc BotAIRegularUpdate 0 0
+export RemoveColorEscapeSequences
+proc RemoveColorEscapeSequences 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $488
+JUMPV
+LABELV $485
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $489
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $489
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRLP4 16
+INDIRI4
+CNSTI4 65
+LTI4 $492
+ADDRLP4 16
+INDIRI4
+CNSTI4 90
+LEI4 $491
+LABELV $492
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 97
+LTI4 $493
+ADDRLP4 20
+INDIRI4
+CNSTI4 122
+LEI4 $491
+LABELV $493
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 48
+LTI4 $489
+ADDRLP4 24
+INDIRI4
+CNSTI4 57
+GTI4 $489
+LABELV $491
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $486
+JUMPV
+LABELV $489
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 126
+LEI4 $494
+ADDRGP4 $486
+JUMPV
+LABELV $494
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $486
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $488
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $485
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $484
+endproc RemoveColorEscapeSequences 36 0
+export BotAI
+proc BotAI 1096 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_ResetInput
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $499
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $497
+LABELV $499
+CNSTI4 4
+ARGI4
+ADDRGP4 $500
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $496
+JUMPV
+LABELV $497
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $505
+CNSTI4 4
+ARGI4
+ADDRGP4 $503
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $496
+JUMPV
+LABELV $504
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1044
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $507
+ADDRGP4 $505
+JUMPV
+LABELV $507
+ADDRLP4 1048
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1048
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 RemoveColorEscapeSequences
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $509
+ADDRGP4 $510
+JUMPV
+LABELV $509
+ADDRLP4 12
+ARGP4
+ADDRGP4 $514
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $512
+ADDRGP4 $513
+JUMPV
+LABELV $512
+ADDRLP4 12
+ARGP4
+ADDRGP4 $517
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $515
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1064
+INDIRU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1072
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRLP4 12
+ARGP4
+ADDRGP4 $520
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $518
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1068
+INDIRU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1076
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRLP4 12
+ARGP4
+ADDRGP4 $523
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $521
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1072
+INDIRU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1080
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRLP4 12
+ARGP4
+ADDRGP4 $526
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $524
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotVoiceChatCommand
+CALLI4
+pop
+ADDRGP4 $525
+JUMPV
+LABELV $524
+ADDRLP4 12
+ARGP4
+ADDRGP4 $529
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $527
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotVoiceChatCommand
+CALLI4
+pop
+ADDRGP4 $528
+JUMPV
+LABELV $527
+ADDRLP4 12
+ARGP4
+ADDRGP4 $532
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $530
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotVoiceChatCommand
+CALLI4
+pop
+ADDRGP4 $531
+JUMPV
+LABELV $530
+ADDRLP4 12
+ARGP4
+ADDRGP4 $535
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $533
+ADDRGP4 $534
+JUMPV
+LABELV $533
+ADDRLP4 12
+ARGP4
+ADDRGP4 $538
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $536
+LABELV $536
+LABELV $534
+LABELV $531
+LABELV $528
+LABELV $525
+LABELV $522
+LABELV $519
+LABELV $516
+LABELV $513
+LABELV $510
+LABELV $505
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1044
+ADDRGP4 trap_BotGetServerCommand
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $504
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $539
+ADDRLP4 1048
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 1060
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1060
+INDIRF4
+ASGNF4
+LABELV $540
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $539
+ADDRLP4 1048
+ADDRLP4 4
+INDIRP4
+CNSTI4 5956
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4800
+ADDP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4804
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4832
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 1064
+ADDRLP4 4
+INDIRP4
+CNSTI4 4840
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4804
+ADDP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4844
+ADDP4
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 BotDeathmatchAI
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6452
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $543
+ADDRLP4 1080
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1088
+ADDRLP4 1080
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 1080
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 1092
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1088
+INDIRP4
+ADDRLP4 1092
+INDIRF4
+ASGNF4
+LABELV $544
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $543
+CNSTI4 1
+RETI4
+LABELV $496
+endproc BotAI 1096 12
+export BotScheduleBotThink
+proc BotScheduleBotThink 16 0
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $548
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $554
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $552
+LABELV $554
+ADDRGP4 $549
+JUMPV
+LABELV $552
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 numbots
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $549
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $548
+LABELV $547
+endproc BotScheduleBotThink 16 0
+export BotWriteSessionData
+proc BotWriteSessionData 20 76
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $557
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6672
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6708
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6712
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6684
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6688
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6692
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6696
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6908
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $558
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $556
+endproc BotWriteSessionData 20 76
+export BotReadSessionData
+proc BotReadSessionData 1036 80
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $558
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $557
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6672
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6708
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6712
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6684
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6688
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6692
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6696
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6908
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+LABELV $559
+endproc BotReadSessionData 1036 80
+export BotAISetupClient
+proc BotAISetupClient 512 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $561
+CNSTI4 8884
+ARGI4
+ADDRLP4 440
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+ADDRLP4 440
+INDIRP4
+ASGNP4
+LABELV $561
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $563
+CNSTI4 4
+ARGI4
+ADDRGP4 $565
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $563
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $566
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $566
+CNSTI4 4
+ARGI4
+ADDRGP4 $568
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $566
+ADDRLP4 448
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 448
+INDIRI4
+CNSTI4 0
+NEI4 $569
+CNSTI4 4
+ARGI4
+ADDRGP4 $571
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $569
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 456
+ADDRGP4 trap_BotLoadCharacter
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $572
+CNSTI4 4
+ARGI4
+ADDRGP4 $574
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $572
+ADDRLP4 0
+INDIRP4
+CNSTI4 4648
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 148
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_BotAllocGoalState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 40
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_BotLoadItemWeights
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRLP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $575
+ADDRLP4 468
+ADDRGP4 trap_BotAllocWeaponState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6428
+ADDP4
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6428
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_BotLoadWeaponWeights
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $577
+ADDRLP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6428
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeWeaponState
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $577
+ADDRLP4 476
+ADDRGP4 trap_BotAllocChatState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 21
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 22
+ARGI4
+ADDRLP4 296
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_BotLoadChatFile
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRLP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeChatState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6428
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeWeaponState
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $579
+ADDRLP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 484
+ADDRLP4 152
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 102
+EQI4 $583
+ADDRLP4 484
+INDIRI4
+CNSTI4 70
+NEI4 $581
+LABELV $583
+ADDRLP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $582
+JUMPV
+LABELV $581
+ADDRLP4 488
+ADDRLP4 152
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 109
+EQI4 $586
+ADDRLP4 488
+INDIRI4
+CNSTI4 77
+NEI4 $584
+LABELV $586
+ADDRLP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRLP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+LABELV $585
+LABELV $582
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 5912
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 5960
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 492
+ADDRGP4 trap_BotAllocMoveState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 500
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 5952
+ADDP4
+ADDRLP4 500
+INDIRF4
+ASGNF4
+ADDRLP4 504
+ADDRGP4 numbots
+ASGNP4
+ADDRLP4 504
+INDIRP4
+ADDRLP4 504
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $589
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+EQI4 $587
+ADDRGP4 $589
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChatTest
+CALLV
+pop
+LABELV $587
+ADDRGP4 BotScheduleBotThink
+CALLV
+pop
+ADDRGP4 bot_interbreed
+INDIRI4
+CNSTI4 0
+EQI4 $590
+ADDRLP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_BotMutateGoalFuzzyLogic
+CALLV
+pop
+LABELV $590
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $592
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotReadSessionData
+CALLV
+pop
+LABELV $592
+CNSTI4 1
+RETI4
+LABELV $560
+endproc BotAISetupClient 512 16
+export BotAIShutdownClient
+proc BotAIShutdownClient 20 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $597
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $595
+LABELV $597
+CNSTI4 0
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $595
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $598
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotWriteSessionData
+CALLV
+pop
+LABELV $598
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChat_ExitGame
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $600
+ADDRLP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $600
+ADDRLP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeMoveState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeChatState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6428
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeWeaponState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeCharacter
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 8868
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 8872
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 8884
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRGP4 numbots
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $594
+endproc BotAIShutdownClient 20 12
+export BotResetState
+proc BotResetState 696 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4648
+ADDP4
+ARGP4
+CNSTU4 148
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 180
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+CNSTU4 508
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6428
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 688
+ADDRFP4 0
+INDIRP4
+CNSTI4 5960
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8868
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8872
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 8884
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6428
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 180
+ARGP4
+CNSTU4 508
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4648
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTU4 148
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6412
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5960
+ADDP4
+ADDRLP4 688
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $603
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetMoveState
+CALLV
+pop
+LABELV $603
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetGoalState
+CALLV
+pop
+LABELV $605
+ADDRFP4 0
+INDIRP4
+CNSTI4 6428
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $607
+ADDRFP4 0
+INDIRP4
+CNSTI4 6428
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetWeaponState
+CALLV
+pop
+LABELV $607
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $609
+ADDRFP4 0
+INDIRP4
+CNSTI4 6420
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+LABELV $609
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 6416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+LABELV $611
+LABELV $602
+endproc BotResetState 696 12
+export BotAILoadMap
+proc BotAILoadMap 280 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $614
+ADDRLP4 4
+ARGP4
+ADDRGP4 $616
+ARGP4
+ADDRGP4 $326
+ARGP4
+CNSTI4 68
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 trap_BotLibLoadMap
+CALLI4
+pop
+LABELV $614
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $618
+ADDRLP4 276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $622
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $622
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 5912
+ADDP4
+CNSTI4 4
+ASGNI4
+LABELV $622
+LABELV $619
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $618
+ADDRGP4 BotSetupDeathmatchAI
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $613
+endproc BotAILoadMap 280 16
+bss
+align 4
+LABELV $625
+skip 4
+align 4
+LABELV $626
+skip 4
+align 4
+LABELV $627
+skip 4
+export BotAIStartFrame
+code
+proc BotAIStartFrame 164 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 G_CheckBotSpawn
+CALLV
+pop
+ADDRGP4 bot_rocketjump
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_grapple
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_fastchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_nochat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_thinktime
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_memorydump
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_saveroutingcache
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_pause
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_report
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_report+12
+INDIRI4
+CNSTI4 0
+EQI4 $628
+ADDRGP4 BotUpdateInfoConfigStrings
+CALLV
+pop
+LABELV $628
+ADDRGP4 bot_pause+12
+INDIRI4
+CNSTI4 0
+EQI4 $631
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $634
+ADDRLP4 128
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $640
+ADDRLP4 128
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $638
+LABELV $640
+ADDRGP4 $635
+JUMPV
+LABELV $638
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $641
+ADDRGP4 $635
+JUMPV
+LABELV $641
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 549
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 550
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 551
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 544
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRGP4 trap_BotUserCommand
+CALLV
+pop
+LABELV $635
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $634
+CNSTI4 1
+RETI4
+ADDRGP4 $624
+JUMPV
+LABELV $631
+ADDRGP4 bot_memorydump+12
+INDIRI4
+CNSTI4 0
+EQI4 $644
+ADDRGP4 $647
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $648
+ARGP4
+ADDRGP4 $649
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $644
+ADDRGP4 bot_saveroutingcache+12
+INDIRI4
+CNSTI4 0
+EQI4 $650
+ADDRGP4 $653
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $654
+ARGP4
+ADDRGP4 $649
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $650
+ADDRGP4 BotInterbreeding
+CALLV
+pop
+ADDRGP4 bot_thinktime+12
+INDIRI4
+CNSTI4 200
+LEI4 $655
+ADDRGP4 $658
+ARGP4
+ADDRGP4 $659
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $655
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ADDRGP4 $627
+INDIRI4
+EQI4 $660
+ADDRGP4 $627
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ASGNI4
+ADDRGP4 BotScheduleBotThink
+CALLV
+pop
+LABELV $660
+ADDRLP4 132
+ADDRGP4 $625
+ASGNP4
+ADDRLP4 120
+ADDRFP4 0
+INDIRI4
+ADDRLP4 132
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 132
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRGP4 $626
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 bot_thinktime+12
+INDIRI4
+LEI4 $664
+ADDRLP4 124
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRLP4 124
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ASGNI4
+LABELV $665
+ADDRGP4 $626
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LTI4 $668
+ADDRLP4 144
+ADDRGP4 $626
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 trap_BotLibStartFrame
+CALLI4
+pop
+ADDRLP4 148
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $670
+CNSTI4 0
+RETI4
+ADDRGP4 $624
+JUMPV
+LABELV $670
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $672
+ADDRLP4 4
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $676
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $673
+JUMPV
+LABELV $676
+ADDRLP4 4
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $678
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $673
+JUMPV
+LABELV $678
+ADDRLP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $680
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $673
+JUMPV
+LABELV $680
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $682
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 10
+EQI4 $682
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $673
+JUMPV
+LABELV $682
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LEI4 $684
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $673
+JUMPV
+LABELV $684
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 1073741824
+NEI4 $686
+ADDRLP4 4
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 ProximityMine_Trigger
+CVPU4 4
+NEU4 $688
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $673
+JUMPV
+LABELV $688
+LABELV $686
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 112
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 8+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $691
+ADDRLP4 8+20
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $692
+JUMPV
+LABELV $691
+ADDRLP4 8+20
+ADDRLP4 4
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $692
+ADDRLP4 8+32
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+44
+ADDRLP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+56
+ADDRLP4 4
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $699
+ADDRLP4 8+72
+CNSTI4 3
+ASGNI4
+ADDRGP4 $700
+JUMPV
+LABELV $699
+ADDRLP4 8+72
+CNSTI4 2
+ASGNI4
+LABELV $700
+ADDRLP4 8+68
+ADDRLP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+76
+ADDRLP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+80
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+84
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+88
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+92
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+96
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+104
+ADDRLP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+108
+ADDRLP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+100
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+LABELV $673
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $672
+ADDRGP4 BotAIRegularUpdate
+CALLV
+pop
+LABELV $668
+ADDRLP4 144
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRGP4 floattime
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $713
+ADDRLP4 148
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $719
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $717
+LABELV $719
+ADDRGP4 $714
+JUMPV
+LABELV $717
+ADDRLP4 152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LTI4 $720
+ADDRLP4 156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 160
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $722
+CNSTI4 0
+RETI4
+ADDRGP4 $624
+JUMPV
+LABELV $722
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $724
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 BotAI
+CALLI4
+pop
+LABELV $724
+LABELV $720
+LABELV $714
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $713
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $727
+ADDRLP4 148
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $733
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $731
+LABELV $733
+ADDRGP4 $728
+JUMPV
+LABELV $731
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $734
+ADDRGP4 $728
+JUMPV
+LABELV $734
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateInput
+CALLV
+pop
+ADDRLP4 152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRGP4 trap_BotUserCommand
+CALLV
+pop
+LABELV $728
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $727
+CNSTI4 1
+RETI4
+LABELV $624
+endproc BotAIStartFrame 164 12
+export BotInitLibrary
+proc BotInitLibrary 212 16
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 $334
+ARGP4
+ADDRGP4 level+24
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $739
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 $334
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $740
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $741
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+INDIRU4
+CNSTU4 0
+EQU4 $742
+ADDRGP4 $741
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $742
+ADDRGP4 $744
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 148
+INDIRU4
+CNSTU4 0
+EQU4 $745
+ADDRGP4 $744
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $745
+ADDRGP4 $747
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 152
+INDIRU4
+CNSTU4 0
+EQU4 $748
+ADDRGP4 $747
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $748
+ADDRGP4 $333
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 156
+INDIRU4
+CNSTU4 0
+NEU4 $750
+ADDRLP4 0
+ARGP4
+ADDRGP4 $649
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $750
+ADDRGP4 $333
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $752
+ARGP4
+ADDRGP4 bot_developer+16
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $754
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $755
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $756
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 160
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 160
+INDIRU4
+CNSTU4 0
+EQU4 $757
+ADDRGP4 $759
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $757
+ADDRGP4 $760
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 164
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 164
+INDIRU4
+CNSTU4 0
+EQU4 $761
+ADDRGP4 $760
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $761
+ADDRGP4 $763
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 168
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 168
+INDIRU4
+CNSTU4 0
+EQU4 $764
+ADDRGP4 $766
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $764
+ADDRGP4 $767
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 172
+INDIRU4
+CNSTU4 0
+EQU4 $768
+ADDRGP4 $770
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $768
+ADDRGP4 $771
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 176
+INDIRU4
+CNSTU4 0
+EQU4 $772
+ADDRGP4 $774
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $772
+ADDRGP4 $775
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 180
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 180
+INDIRU4
+CNSTU4 0
+EQU4 $776
+ADDRGP4 $778
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $776
+ADDRGP4 $654
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 184
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 184
+INDIRU4
+CNSTU4 0
+EQU4 $779
+ADDRGP4 $653
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $779
+ADDRGP4 $781
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 188
+INDIRU4
+CNSTU4 0
+EQU4 $782
+ADDRGP4 $784
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $782
+ADDRGP4 $341
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 192
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 192
+INDIRU4
+CNSTU4 0
+NEU4 $785
+ADDRLP4 0
+ARGP4
+ADDRGP4 $649
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $785
+ADDRGP4 $341
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $787
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 196
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 196
+INDIRU4
+CNSTU4 0
+EQU4 $788
+ADDRGP4 $790
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $788
+ADDRGP4 $791
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 200
+INDIRU4
+CNSTU4 0
+EQU4 $792
+ADDRGP4 $794
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $792
+ADDRGP4 $795
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 204
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 204
+INDIRU4
+CNSTU4 0
+EQU4 $796
+ADDRGP4 $798
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $796
+ADDRGP4 $799
+ARGP4
+ADDRGP4 trap_BotLibDefine
+CALLI4
+pop
+ADDRLP4 208
+ADDRGP4 trap_BotLibSetup
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+RETI4
+LABELV $737
+endproc BotInitLibrary 212 16
+export BotAISetup
+proc BotAISetup 8 16
+ADDRGP4 bot_thinktime
+ARGP4
+ADDRGP4 $658
+ARGP4
+ADDRGP4 $801
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_memorydump
+ARGP4
+ADDRGP4 $648
+ARGP4
+ADDRGP4 $649
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_saveroutingcache
+ARGP4
+ADDRGP4 $654
+ARGP4
+ADDRGP4 $649
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_pause
+ARGP4
+ADDRGP4 $802
+ARGP4
+ADDRGP4 $649
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_report
+ARGP4
+ADDRGP4 $803
+ARGP4
+ADDRGP4 $649
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testsolid
+ARGP4
+ADDRGP4 $804
+ARGP4
+ADDRGP4 $649
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testclusters
+ARGP4
+ADDRGP4 $805
+ARGP4
+ADDRGP4 $649
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_developer
+ARGP4
+ADDRGP4 $752
+ARGP4
+ADDRGP4 $649
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedchar
+ARGP4
+ADDRGP4 $351
+ARGP4
+ADDRGP4 $326
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedbots
+ARGP4
+ADDRGP4 $806
+ARGP4
+ADDRGP4 $807
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedcycle
+ARGP4
+ADDRGP4 $808
+ARGP4
+ADDRGP4 $809
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedwrite
+ARGP4
+ADDRGP4 $325
+ARGP4
+ADDRGP4 $326
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $810
+CNSTI4 1
+RETI4
+ADDRGP4 $800
+JUMPV
+LABELV $810
+ADDRGP4 botstates
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+ADDRGP4 BotInitLibrary
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $812
+CNSTI4 0
+RETI4
+ADDRGP4 $800
+JUMPV
+LABELV $812
+CNSTI4 1
+RETI4
+LABELV $800
+endproc BotAISetup 8 16
+export BotAIShutdown
+proc BotAIShutdown 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $815
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $817
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $821
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $821
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAIShutdownClient
+CALLI4
+pop
+LABELV $821
+LABELV $818
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $817
+ADDRGP4 $816
+JUMPV
+LABELV $815
+ADDRGP4 trap_BotLibShutdown
+CALLI4
+pop
+LABELV $816
+CNSTI4 1
+RETI4
+LABELV $814
+endproc BotAIShutdown 8 8
+import ProximityMine_Trigger
+import ExitLevel
+bss
+export bot_interbreedwrite
+align 4
+LABELV bot_interbreedwrite
+skip 272
+export bot_interbreedcycle
+align 4
+LABELV bot_interbreedcycle
+skip 272
+export bot_interbreedbots
+align 4
+LABELV bot_interbreedbots
+skip 272
+export bot_interbreedchar
+align 4
+LABELV bot_interbreedchar
+skip 272
+export bot_developer
+align 4
+LABELV bot_developer
+skip 272
+export bot_testclusters
+align 4
+LABELV bot_testclusters
+skip 272
+export bot_testsolid
+align 4
+LABELV bot_testsolid
+skip 272
+export bot_report
+align 4
+LABELV bot_report
+skip 272
+export bot_pause
+align 4
+LABELV bot_pause
+skip 272
+export bot_saveroutingcache
+align 4
+LABELV bot_saveroutingcache
+skip 272
+export bot_memorydump
+align 4
+LABELV bot_memorydump
+skip 272
+export bot_thinktime
+align 4
+LABELV bot_thinktime
+skip 272
+export bot_interbreedmatchcount
+align 4
+LABELV bot_interbreedmatchcount
+skip 4
+export bot_interbreed
+align 4
+LABELV bot_interbreed
+skip 4
+export regularupdate_time
+align 4
+LABELV regularupdate_time
+skip 4
+export numbots
+align 4
+LABELV numbots
+skip 4
+export botstates
+align 4
+LABELV botstates
+skip 256
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+export floattime
+align 4
+LABELV floattime
+skip 4
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $809
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $808
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 99
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $807
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $806
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $805
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $804
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $803
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $802
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $801
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $799
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 0
+align 1
+LABELV $798
+byte 1 104
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $795
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $794
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $791
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $790
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $787
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $784
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $781
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $778
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $775
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $774
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $771
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $770
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $767
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $766
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $763
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $760
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $759
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $756
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $755
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $754
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $752
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $747
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $744
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $741
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $740
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $739
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $659
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $658
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $654
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $653
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $649
+byte 1 48
+byte 1 0
+align 1
+LABELV $648
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $647
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $616
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $589
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $574
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $571
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $568
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $565
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $558
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $557
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $538
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $535
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $532
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $529
+byte 1 118
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $526
+byte 1 118
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $523
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $520
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $517
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $514
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $511
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 0
+align 1
+LABELV $503
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $500
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $351
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $348
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 52
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $342
+byte 1 49
+byte 1 0
+align 1
+LABELV $341
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $334
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $333
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $326
+byte 1 0
+align 1
+LABELV $325
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $276
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 97
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $273
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $271
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $269
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $267
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $265
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $263
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $261
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $259
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $257
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $255
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $253
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $251
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $249
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $244
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $233
+byte 1 70
+byte 1 32
+byte 1 0
+align 1
+LABELV $212
+byte 1 94
+byte 1 52
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $211
+byte 1 116
+byte 1 0
+align 1
+LABELV $207
+byte 1 110
+byte 1 0
+align 1
+LABELV $196
+byte 1 94
+byte 1 49
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $192
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $191
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $189
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $187
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $185
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $183
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $181
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $179
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $177
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $175
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $173
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $171
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $169
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $164
+byte 1 94
+byte 1 52
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $163
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $150
+byte 1 94
+byte 1 52
+byte 1 70
+byte 1 32
+byte 1 0
+align 1
+LABELV $149
+byte 1 94
+byte 1 49
+byte 1 70
+byte 1 32
+byte 1 0
+align 1
+LABELV $142
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $141
+byte 1 32
+byte 1 0
+align 1
+LABELV $140
+byte 1 76
+byte 1 0
+align 1
+LABELV $135
+byte 1 13
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $134
+byte 1 13
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 33
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $126
+byte 1 13
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 79
+byte 1 76
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $125
+byte 1 13
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $71
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $70
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $68
+byte 1 94
+byte 1 49
+byte 1 70
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $66
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $64
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $62
+byte 1 37
+byte 1 115
+byte 1 0
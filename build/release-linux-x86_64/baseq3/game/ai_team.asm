@@ -0,0 +1,13114 @@
+export BotValidTeamLeader
+code
+proc BotValidTeamLeader 8 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+CNSTU4 0
+NEU4 $58
+CNSTI4 0
+RETI4
+ADDRGP4 $57
+JUMPV
+LABELV $58
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $60
+CNSTI4 0
+RETI4
+ADDRGP4 $57
+JUMPV
+LABELV $60
+CNSTI4 1
+RETI4
+LABELV $57
+endproc BotValidTeamLeader 8 4
+export BotNumTeamMates
+proc BotNumTeamMates 1060 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 $66
+JUMPV
+LABELV $63
+ADDRLP4 1024
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRU4
+CNSTU4 0
+EQU4 $71
+ADDRLP4 0
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1044
+INDIRU4
+CNSTU4 0
+NEU4 $68
+LABELV $71
+ADDRGP4 $64
+JUMPV
+LABELV $68
+ADDRLP4 0
+ARGP4
+ADDRGP4 $74
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 3
+NEI4 $72
+ADDRGP4 $64
+JUMPV
+LABELV $72
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $75
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $75
+LABELV $64
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $66
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $63
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $62
+endproc BotNumTeamMates 1060 12
+export BotClientTravelTimeToGoal
+proc BotClientTravelTimeToGoal 520 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 512
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+EQI4 $78
+ADDRLP4 4+20
+ARGP4
+ADDRLP4 516
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $79
+JUMPV
+LABELV $78
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $79
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $81
+CNSTI4 1
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $81
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4+20
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 516
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+RETI4
+LABELV $77
+endproc BotClientTravelTimeToGoal 520 16
+export BotSortTeamMatesByBaseTravelTime
+proc BotSortTeamMatesByBaseTravelTime 1352 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 1300
+CNSTP4 0
+ASGNP4
+ADDRLP4 1304
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+CNSTI4 5
+EQI4 $87
+ADDRLP4 1304
+INDIRI4
+CNSTI4 6
+NEI4 $85
+LABELV $87
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1308
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 1
+NEI4 $88
+ADDRLP4 1300
+ADDRGP4 ctf_redflag
+ASGNP4
+ADDRGP4 $86
+JUMPV
+LABELV $88
+ADDRLP4 1300
+ADDRGP4 ctf_blueflag
+ASGNP4
+ADDRGP4 $86
+JUMPV
+LABELV $85
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1308
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 1
+NEI4 $90
+ADDRLP4 1300
+ADDRGP4 redobelisk
+ASGNP4
+ADDRGP4 $91
+JUMPV
+LABELV $90
+ADDRLP4 1300
+ADDRGP4 blueobelisk
+ASGNP4
+LABELV $91
+LABELV $86
+ADDRLP4 1308
+CNSTI4 0
+ASGNI4
+ADDRLP4 264
+ADDRLP4 1308
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 1308
+INDIRI4
+ASGNI4
+ADDRGP4 $95
+JUMPV
+LABELV $92
+ADDRLP4 272
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 276
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 276
+ARGP4
+ADDRLP4 1312
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1312
+INDIRU4
+CNSTU4 0
+EQU4 $99
+ADDRLP4 276
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1316
+INDIRP4
+ARGP4
+ADDRLP4 1320
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1320
+INDIRU4
+CNSTU4 0
+NEU4 $97
+LABELV $99
+ADDRGP4 $93
+JUMPV
+LABELV $97
+ADDRLP4 276
+ARGP4
+ADDRGP4 $74
+ARGP4
+ADDRLP4 1324
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1324
+INDIRP4
+ARGP4
+ADDRLP4 1328
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 3
+NEI4 $100
+ADDRGP4 $93
+JUMPV
+LABELV $100
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 1332
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 0
+EQI4 $102
+ADDRLP4 1300
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $102
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 1300
+INDIRP4
+ARGP4
+ADDRLP4 1336
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 1336
+INDIRI4
+ASGNI4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $104
+ADDRLP4 268
+INDIRI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+GEI4 $108
+ADDRLP4 0
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $110
+ADDRLP4 1340
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1340
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1344
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1344
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 1344
+INDIRI4
+CNSTI4 4
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $111
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $113
+ADDRLP4 0
+INDIRI4
+ADDRLP4 260
+INDIRI4
+GTI4 $110
+ADDRGP4 $106
+JUMPV
+LABELV $108
+LABELV $105
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $107
+ADDRLP4 260
+INDIRI4
+ADDRLP4 264
+INDIRI4
+LTI4 $104
+LABELV $106
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $115
+ADDRGP4 $94
+JUMPV
+LABELV $115
+LABELV $102
+LABELV $93
+ADDRLP4 272
+ADDRLP4 272
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $95
+ADDRLP4 272
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $92
+LABELV $94
+ADDRLP4 264
+INDIRI4
+RETI4
+LABELV $84
+endproc BotSortTeamMatesByBaseTravelTime 1352 12
+export BotSetTeamMateTaskPreference
+proc BotSetTeamMateTaskPreference 36 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $117
+endproc BotSetTeamMateTaskPreference 36 12
+export BotGetTeamMateTaskPreference
+proc BotGetTeamMateTaskPreference 40 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $120
+CNSTI4 0
+RETI4
+ADDRGP4 $119
+JUMPV
+LABELV $120
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $123
+CNSTI4 0
+RETI4
+ADDRGP4 $119
+JUMPV
+LABELV $123
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+INDIRI4
+RETI4
+LABELV $119
+endproc BotGetTeamMateTaskPreference 40 12
+export BotSortTeamMatesByTaskPreference
+proc BotSortTeamMatesByTaskPreference 804 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 788
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $127
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 792
+ADDRGP4 BotGetTeamMateTaskPreference
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 792
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $131
+ADDRLP4 796
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $133
+ADDRLP4 796
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 276
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRLP4 796
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 532
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $134
+LABELV $132
+LABELV $128
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $130
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $127
+ADDRFP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 792
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 792
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ADDRLP4 792
+INDIRI4
+LSHU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 796
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 796
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 532
+ARGP4
+ADDRLP4 272
+INDIRI4
+CVIU4 4
+ADDRLP4 796
+INDIRI4
+LSHU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 272
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRLP4 268
+INDIRI4
+CVIU4 4
+ADDRLP4 800
+INDIRI4
+LSHU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 268
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+RETI4
+LABELV $126
+endproc BotSortTeamMatesByTaskPreference 804 12
+export BotSayTeamOrderAlways
+proc BotSayTeamOrderAlways 548 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGetChatMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 512
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 512
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $137
+LABELV $135
+endproc BotSayTeamOrderAlways 548 20
+export BotSayTeamOrder
+proc BotSayTeamOrder 256 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGetChatMessage
+CALLV
+pop
+LABELV $139
+endproc BotSayTeamOrder 256 12
+export BotVoiceChat
+proc BotVoiceChat 8 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $141
+ADDRGP4 $143
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+ADDRGP4 $142
+JUMPV
+LABELV $141
+ADDRGP4 $144
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+LABELV $142
+LABELV $140
+endproc BotVoiceChat 8 12
+export BotVoiceChatOnly
+proc BotVoiceChatOnly 8 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $146
+ADDRGP4 $148
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+ADDRGP4 $147
+JUMPV
+LABELV $146
+ADDRGP4 $149
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+LABELV $147
+LABELV $145
+endproc BotVoiceChatOnly 8 12
+export BotSayVoiceTeamOrder
+proc BotSayVoiceTeamOrder 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $150
+endproc BotSayVoiceTeamOrder 0 12
+lit
+align 4
+LABELV $152
+byte 4 0
+skip 252
+export BotCTFOrders_BothFlagsNotAtBase
+code
+proc BotCTFOrders_BothFlagsNotAtBase 368 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $152
+INDIRB
+ASGNB 256
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRLP4 352
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 1
+EQI4 $154
+ADDRLP4 352
+INDIRI4
+CNSTI4 2
+EQI4 $157
+ADDRLP4 352
+INDIRI4
+CNSTI4 3
+EQI4 $163
+ADDRGP4 $153
+JUMPV
+LABELV $157
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+EQI4 $158
+ADDRLP4 308
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $159
+JUMPV
+LABELV $158
+ADDRLP4 308
+ADDRLP4 0+4
+INDIRI4
+ASGNI4
+LABELV $159
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $154
+JUMPV
+LABELV $163
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+EQI4 $164
+ADDRLP4 308
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $165
+JUMPV
+LABELV $164
+ADDRLP4 308
+ADDRLP4 0+4
+INDIRI4
+ASGNI4
+LABELV $165
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $167
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $169
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $172
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $168
+JUMPV
+LABELV $169
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $168
+JUMPV
+LABELV $167
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $168
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+EQI4 $175
+ADDRLP4 308
+ADDRLP4 0+8
+INDIRI4
+ASGNI4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRLP4 308
+ADDRLP4 0+4
+INDIRI4
+ASGNI4
+LABELV $176
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $180
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRLP4 300
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 4
+LEI4 $181
+ADDRLP4 300
+CNSTI4 4
+ASGNI4
+LABELV $181
+ADDRLP4 360
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 304
+ADDRLP4 360
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 360
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 5
+LEI4 $183
+ADDRLP4 304
+CNSTI4 5
+ASGNI4
+LABELV $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $185
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $190
+JUMPV
+LABELV $187
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $191
+ADDRGP4 $188
+JUMPV
+LABELV $191
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $193
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $172
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $194
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $188
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $190
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $187
+ADDRGP4 $186
+JUMPV
+LABELV $185
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $195
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $199
+ADDRGP4 $196
+JUMPV
+LABELV $199
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $196
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $198
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $195
+LABELV $186
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $204
+JUMPV
+LABELV $201
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $205
+ADDRGP4 $202
+JUMPV
+LABELV $205
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $180
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $202
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $204
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $201
+LABELV $154
+LABELV $151
+endproc BotCTFOrders_BothFlagsNotAtBase 368 20
+export BotCTFOrders_FlagNotAtBase
+proc BotCTFOrders_FlagNotAtBase 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6872
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $212
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $213
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $218
+ADDRLP4 312
+INDIRI4
+CNSTI4 3
+EQI4 $224
+ADDRGP4 $214
+JUMPV
+LABELV $218
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $213
+JUMPV
+LABELV $224
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $213
+JUMPV
+LABELV $214
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $231
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $231
+ADDRLP4 304
+CNSTF4 1058642330
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 6
+LEI4 $233
+ADDRLP4 304
+CNSTI4 6
+ASGNI4
+LABELV $233
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $238
+JUMPV
+LABELV $235
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $236
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $238
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $235
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $239
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $240
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $242
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $239
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $246
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $249
+ADDRLP4 312
+INDIRI4
+CNSTI4 3
+EQI4 $253
+ADDRGP4 $245
+JUMPV
+LABELV $249
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $253
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $245
+ADDRLP4 300
+CNSTF4 1045220557
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 2
+LEI4 $260
+ADDRLP4 300
+CNSTI4 2
+ASGNI4
+LABELV $260
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $262
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $262
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $267
+JUMPV
+LABELV $264
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $265
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $267
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $264
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $271
+JUMPV
+LABELV $268
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $269
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $271
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $268
+LABELV $246
+LABELV $213
+LABELV $211
+endproc BotCTFOrders_FlagNotAtBase 320 16
+export BotCTFOrders_EnemyFlagNotAtBase
+proc BotCTFOrders_EnemyFlagNotAtBase 360 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+EQI4 $277
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+EQI4 $279
+ADDRLP4 260
+INDIRI4
+CNSTI4 3
+EQI4 $283
+ADDRGP4 $276
+JUMPV
+LABELV $279
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $280
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+ADDRGP4 $281
+JUMPV
+LABELV $280
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $281
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $283
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+EQI4 $284
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $285
+JUMPV
+LABELV $284
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $285
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+EQI4 $287
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $288
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 300
+CNSTF4 1058642330
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 6
+LEI4 $292
+ADDRLP4 300
+CNSTI4 6
+ASGNI4
+LABELV $292
+ADDRLP4 304
+CNSTF4 1050253722
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 3
+LEI4 $294
+ADDRLP4 304
+CNSTI4 3
+ASGNI4
+LABELV $294
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $299
+JUMPV
+LABELV $296
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $300
+ADDRGP4 $297
+JUMPV
+LABELV $300
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $297
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $299
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $296
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $302
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $307
+JUMPV
+LABELV $304
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $308
+ADDRGP4 $305
+JUMPV
+LABELV $308
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $172
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $313
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $305
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $307
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $304
+ADDRGP4 $277
+JUMPV
+LABELV $302
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $320
+JUMPV
+LABELV $317
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $321
+ADDRGP4 $318
+JUMPV
+LABELV $321
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $318
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $320
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $317
+LABELV $277
+LABELV $275
+endproc BotCTFOrders_EnemyFlagNotAtBase 360 20
+lit
+align 4
+LABELV $328
+byte 4 0
+skip 252
+export BotCTFOrders_BothFlagsAtBase
+code
+proc BotCTFOrders_BothFlagsAtBase 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $328
+INDIRB
+ASGNB 256
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6872
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $329
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $330
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $334
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $338
+ADDRGP4 $331
+JUMPV
+LABELV $334
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $330
+JUMPV
+LABELV $338
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $330
+JUMPV
+LABELV $331
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $345
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $345
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $347
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $347
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $352
+JUMPV
+LABELV $349
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $350
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $352
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $349
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $356
+JUMPV
+LABELV $353
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $354
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $356
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $353
+ADDRGP4 $330
+JUMPV
+LABELV $329
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $361
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $363
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $367
+ADDRGP4 $360
+JUMPV
+LABELV $363
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $361
+JUMPV
+LABELV $367
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 300
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 4
+LEI4 $374
+ADDRLP4 300
+CNSTI4 4
+ASGNI4
+LABELV $374
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 304
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 5
+LEI4 $376
+ADDRLP4 304
+CNSTI4 5
+ASGNI4
+LABELV $376
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $378
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $379
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $381
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $378
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $382
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $383
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $385
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $382
+LABELV $361
+LABELV $330
+LABELV $327
+endproc BotCTFOrders_BothFlagsAtBase 320 16
+export BotCTFOrders
+proc BotCTFOrders 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $390
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $391
+JUMPV
+LABELV $390
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $391
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $392
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+GTI4 $392
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $398
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $398
+address $394
+address $395
+address $396
+address $397
+code
+LABELV $394
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_BothFlagsAtBase
+CALLV
+pop
+ADDRGP4 $393
+JUMPV
+LABELV $395
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_EnemyFlagNotAtBase
+CALLV
+pop
+ADDRGP4 $393
+JUMPV
+LABELV $396
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_FlagNotAtBase
+CALLV
+pop
+ADDRGP4 $393
+JUMPV
+LABELV $397
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_BothFlagsNotAtBase
+CALLV
+pop
+LABELV $392
+LABELV $393
+LABELV $389
+endproc BotCTFOrders 20 4
+export BotCreateGroup
+proc BotCreateGroup 76 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $403
+JUMPV
+LABELV $400
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $404
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $405
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrderAlways
+CALLV
+pop
+LABELV $401
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $403
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $400
+LABELV $399
+endproc BotCreateGroup 76 20
+export BotTeamOrders
+proc BotTeamOrders 1316 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1288
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1288
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1288
+INDIRI4
+ASGNI4
+ADDRGP4 $410
+JUMPV
+LABELV $407
+ADDRLP4 1024
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1292
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1292
+INDIRU4
+CNSTU4 0
+EQU4 $414
+ADDRLP4 0
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1296
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1296
+INDIRP4
+ARGP4
+ADDRLP4 1300
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1300
+INDIRU4
+CNSTU4 0
+NEU4 $412
+LABELV $414
+ADDRGP4 $408
+JUMPV
+LABELV $412
+ADDRLP4 0
+ARGP4
+ADDRGP4 $74
+ARGP4
+ADDRLP4 1304
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1304
+INDIRP4
+ARGP4
+ADDRLP4 1308
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 3
+NEI4 $415
+ADDRGP4 $408
+JUMPV
+LABELV $415
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1312
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 0
+EQI4 $417
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1032
+ADDP4
+ADDRLP4 1024
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $417
+LABELV $408
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $410
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $407
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LTI4 $419
+ADDRLP4 1028
+INDIRI4
+CNSTI4 5
+GTI4 $419
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $434-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $434
+address $420
+address $420
+address $423
+address $424
+address $426
+code
+LABELV $423
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $420
+JUMPV
+LABELV $424
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032+8
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $420
+JUMPV
+LABELV $426
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032+8
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $420
+JUMPV
+LABELV $419
+ADDRLP4 1028
+INDIRI4
+CNSTI4 10
+GTI4 $420
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 $433
+JUMPV
+LABELV $430
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1296
+CNSTI4 2
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 1296
+INDIRI4
+LSHI4
+ADDRLP4 1032
+ADDP4
+ARGP4
+ADDRLP4 1296
+INDIRI4
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+LABELV $431
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $433
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $430
+LABELV $420
+LABELV $406
+endproc BotTeamOrders 1316 12
+export Bot1FCTFOrders_FlagAtCenter
+proc Bot1FCTFOrders_FlagAtCenter 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6872
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $437
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $438
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $442
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $446
+ADDRGP4 $439
+JUMPV
+LABELV $442
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $438
+JUMPV
+LABELV $446
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $438
+JUMPV
+LABELV $439
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $452
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $452
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $454
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $454
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $459
+JUMPV
+LABELV $456
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $457
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $459
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $456
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $463
+JUMPV
+LABELV $460
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $461
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $463
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $460
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $468
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $470
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $474
+ADDRGP4 $467
+JUMPV
+LABELV $470
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $468
+JUMPV
+LABELV $474
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $468
+JUMPV
+LABELV $467
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $481
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $481
+ADDRLP4 304
+CNSTF4 1058642330
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 6
+LEI4 $483
+ADDRLP4 304
+CNSTI4 6
+ASGNI4
+LABELV $483
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $488
+JUMPV
+LABELV $485
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $486
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $488
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $485
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $492
+JUMPV
+LABELV $489
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $490
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $492
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $489
+LABELV $468
+LABELV $438
+LABELV $436
+endproc Bot1FCTFOrders_FlagAtCenter 320 16
+export Bot1FCTFOrders_TeamHasFlag
+proc Bot1FCTFOrders_TeamHasFlag 360 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6872
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $497
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+EQI4 $498
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+EQI4 $502
+ADDRLP4 260
+INDIRI4
+CNSTI4 3
+EQI4 $508
+ADDRGP4 $499
+JUMPV
+LABELV $502
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $503
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $504
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $508
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+EQI4 $509
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $510
+JUMPV
+LABELV $509
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $510
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+EQI4 $512
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $513
+JUMPV
+LABELV $512
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $513
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $517
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $519
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $172
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $518
+JUMPV
+LABELV $519
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $518
+JUMPV
+LABELV $517
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $518
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $499
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $521
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $521
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $523
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $523
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $528
+JUMPV
+LABELV $525
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $529
+ADDRGP4 $526
+JUMPV
+LABELV $529
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $526
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $528
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $525
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $531
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $536
+JUMPV
+LABELV $533
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $537
+ADDRGP4 $534
+JUMPV
+LABELV $537
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $541
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $172
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $542
+JUMPV
+LABELV $541
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $534
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $536
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $533
+ADDRGP4 $498
+JUMPV
+LABELV $531
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $549
+JUMPV
+LABELV $546
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $550
+ADDRGP4 $547
+JUMPV
+LABELV $550
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $547
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $549
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $546
+ADDRGP4 $498
+JUMPV
+LABELV $497
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+EQI4 $557
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+EQI4 $559
+ADDRLP4 260
+INDIRI4
+CNSTI4 3
+EQI4 $563
+ADDRGP4 $556
+JUMPV
+LABELV $559
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $560
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+ADDRGP4 $561
+JUMPV
+LABELV $560
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $561
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $557
+JUMPV
+LABELV $563
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+EQI4 $564
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $565
+JUMPV
+LABELV $564
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $565
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+EQI4 $567
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $568
+JUMPV
+LABELV $567
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $568
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $572
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $172
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $573
+JUMPV
+LABELV $572
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $573
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRGP4 $557
+JUMPV
+LABELV $556
+ADDRLP4 300
+CNSTF4 1045220557
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 2
+LEI4 $574
+ADDRLP4 300
+CNSTI4 2
+ASGNI4
+LABELV $574
+ADDRLP4 304
+CNSTF4 1061997773
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 8
+LEI4 $576
+ADDRLP4 304
+CNSTI4 8
+ASGNI4
+LABELV $576
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $581
+JUMPV
+LABELV $578
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $582
+ADDRGP4 $579
+JUMPV
+LABELV $582
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $579
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $581
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $578
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $587
+JUMPV
+LABELV $584
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+NEI4 $588
+ADDRGP4 $585
+JUMPV
+LABELV $588
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $592
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $172
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $593
+JUMPV
+LABELV $592
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $593
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $585
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $587
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $584
+LABELV $557
+LABELV $498
+LABELV $496
+endproc Bot1FCTFOrders_TeamHasFlag 360 20
+export Bot1FCTFOrders_EnemyHasFlag
+proc Bot1FCTFOrders_EnemyHasFlag 316 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6872
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $598
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $599
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $603
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $607
+ADDRGP4 $600
+JUMPV
+LABELV $603
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $599
+JUMPV
+LABELV $607
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $599
+JUMPV
+LABELV $600
+ADDRLP4 300
+CNSTF4 1061997773
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 8
+LEI4 $614
+ADDRLP4 300
+CNSTI4 8
+ASGNI4
+LABELV $614
+ADDRLP4 304
+CNSTF4 1036831949
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+LEI4 $616
+ADDRLP4 304
+CNSTI4 1
+ASGNI4
+LABELV $616
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $621
+JUMPV
+LABELV $618
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $619
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $621
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $618
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $622
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $627
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $623
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $625
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $622
+ADDRGP4 $599
+JUMPV
+LABELV $598
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $631
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $633
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $637
+ADDRGP4 $630
+JUMPV
+LABELV $633
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $631
+JUMPV
+LABELV $637
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $627
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $631
+JUMPV
+LABELV $630
+ADDRLP4 300
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 7
+LEI4 $644
+ADDRLP4 300
+CNSTI4 7
+ASGNI4
+LABELV $644
+ADDRLP4 304
+CNSTF4 1045220557
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 2
+LEI4 $646
+ADDRLP4 304
+CNSTI4 2
+ASGNI4
+LABELV $646
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $651
+JUMPV
+LABELV $648
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $649
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $651
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $648
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $655
+JUMPV
+LABELV $652
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $627
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $653
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $655
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $652
+LABELV $631
+LABELV $599
+LABELV $597
+endproc Bot1FCTFOrders_EnemyHasFlag 316 16
+export Bot1FCTFOrders_EnemyDroppedFlag
+proc Bot1FCTFOrders_EnemyDroppedFlag 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6872
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $660
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $661
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $665
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $669
+ADDRGP4 $662
+JUMPV
+LABELV $665
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $661
+JUMPV
+LABELV $669
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $661
+JUMPV
+LABELV $662
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $676
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $676
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $678
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $678
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $683
+JUMPV
+LABELV $680
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $681
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $683
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $680
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $687
+JUMPV
+LABELV $684
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $685
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $687
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $684
+ADDRGP4 $661
+JUMPV
+LABELV $660
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $692
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $694
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $698
+ADDRGP4 $691
+JUMPV
+LABELV $694
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $698
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $691
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $705
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $705
+ADDRLP4 304
+CNSTF4 1058642330
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 6
+LEI4 $707
+ADDRLP4 304
+CNSTI4 6
+ASGNI4
+LABELV $707
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $712
+JUMPV
+LABELV $709
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $710
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $712
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $709
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $716
+JUMPV
+LABELV $713
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $714
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $716
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $713
+LABELV $692
+LABELV $661
+LABELV $659
+endproc Bot1FCTFOrders_EnemyDroppedFlag 320 16
+export Bot1FCTFOrders
+proc Bot1FCTFOrders 8 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $721
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GTI4 $721
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $728
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $728
+address $724
+address $725
+address $726
+address $727
+code
+LABELV $724
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders_FlagAtCenter
+CALLV
+pop
+ADDRGP4 $722
+JUMPV
+LABELV $725
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders_TeamHasFlag
+CALLV
+pop
+ADDRGP4 $722
+JUMPV
+LABELV $726
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders_EnemyHasFlag
+CALLV
+pop
+ADDRGP4 $722
+JUMPV
+LABELV $727
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders_EnemyDroppedFlag
+CALLV
+pop
+LABELV $721
+LABELV $722
+LABELV $720
+endproc Bot1FCTFOrders 8 4
+export BotObeliskOrders
+proc BotObeliskOrders 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6872
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $730
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $731
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $735
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $739
+ADDRGP4 $732
+JUMPV
+LABELV $735
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $731
+JUMPV
+LABELV $739
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $731
+JUMPV
+LABELV $732
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $746
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $746
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $748
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $748
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $753
+JUMPV
+LABELV $750
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $751
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $753
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $750
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $757
+JUMPV
+LABELV $754
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $755
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $757
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $754
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $762
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $764
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $768
+ADDRGP4 $761
+JUMPV
+LABELV $764
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $762
+JUMPV
+LABELV $768
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $762
+JUMPV
+LABELV $761
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $775
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $775
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $777
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $777
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $782
+JUMPV
+LABELV $779
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $780
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $782
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $779
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $786
+JUMPV
+LABELV $783
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $784
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $786
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $783
+LABELV $762
+LABELV $731
+LABELV $729
+endproc BotObeliskOrders 320 16
+lit
+align 4
+LABELV $791
+byte 4 0
+skip 252
+export BotHarvesterOrders
+code
+proc BotHarvesterOrders 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $791
+INDIRB
+ASGNB 256
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6872
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $792
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $793
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $797
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $802
+ADDRGP4 $794
+JUMPV
+LABELV $797
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $799
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $793
+JUMPV
+LABELV $802
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $799
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $793
+JUMPV
+LABELV $794
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $809
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $809
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $811
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $811
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $816
+JUMPV
+LABELV $813
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $814
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $816
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $813
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $820
+JUMPV
+LABELV $817
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $799
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $818
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $820
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $817
+ADDRGP4 $793
+JUMPV
+LABELV $792
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $825
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $827
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $831
+ADDRGP4 $824
+JUMPV
+LABELV $827
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $799
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $825
+JUMPV
+LABELV $831
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $799
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $799
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $825
+JUMPV
+LABELV $824
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $838
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $838
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $840
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $840
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $845
+JUMPV
+LABELV $842
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $843
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $845
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $842
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $849
+JUMPV
+LABELV $846
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $799
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $847
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $849
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $846
+LABELV $825
+LABELV $793
+LABELV $790
+endproc BotHarvesterOrders 320 16
+export FindHumanTeamLeader
+proc FindHumanTeamLeader 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $854
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $858
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+236+244
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $861
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 notleader
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $865
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $867
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $869
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotVoiceChat_Defend
+CALLV
+pop
+LABELV $869
+CNSTI4 1
+RETI4
+ADDRGP4 $853
+JUMPV
+LABELV $867
+LABELV $865
+LABELV $861
+LABELV $858
+LABELV $855
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $854
+CNSTI4 0
+RETI4
+LABELV $853
+endproc FindHumanTeamLeader 12 12
+export BotTeamAI
+proc BotTeamAI 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GEI4 $872
+ADDRGP4 $871
+JUMPV
+LABELV $872
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BotValidTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $874
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 FindHumanTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $876
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $878
+ADDRFP4 0
+INDIRP4
+CNSTI4 6832
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $878
+ADDRFP4 0
+INDIRP4
+CNSTI4 5960
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $880
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $881
+JUMPV
+LABELV $880
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6832
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $881
+LABELV $878
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+EQF4 $882
+ADDRLP4 56
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $882
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $884
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6832
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $882
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6832
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $871
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $871
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $887
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6424
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $888
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+CNSTU4 35
+ADDI4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 6832
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $871
+JUMPV
+LABELV $876
+LABELV $874
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6832
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $889
+ADDRGP4 $871
+JUMPV
+LABELV $889
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotNumTeamMates
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+NEI4 $891
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $895
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $893
+LABELV $895
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $893
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+EQF4 $892
+ADDRLP4 56
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $892
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRGP4 $892
+JUMPV
+LABELV $891
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $898
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $903
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $903
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $900
+LABELV $903
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $900
+ADDRFP4 0
+INDIRP4
+CNSTI4 6840
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1131413504
+SUBF4
+GEF4 $904
+ADDRFP4 0
+INDIRP4
+CNSTI4 6840
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1053609165
+GEF4 $906
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 6872
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $906
+LABELV $904
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $899
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+GEF4 $899
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $899
+JUMPV
+LABELV $898
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $910
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $915
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $915
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $912
+LABELV $915
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $912
+ADDRFP4 0
+INDIRP4
+CNSTI4 6840
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1131413504
+SUBF4
+GEF4 $916
+ADDRFP4 0
+INDIRP4
+CNSTI4 6840
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1053609165
+GEF4 $918
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 6872
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $918
+LABELV $916
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $911
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $911
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $911
+JUMPV
+LABELV $910
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $922
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $926
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $924
+LABELV $926
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $924
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+EQF4 $923
+ADDRLP4 56
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $923
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+ADDRGP4 $923
+JUMPV
+LABELV $922
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $929
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $933
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $931
+LABELV $933
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $931
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+EQF4 $934
+ADDRLP4 56
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $934
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+LABELV $934
+LABELV $929
+LABELV $923
+LABELV $911
+LABELV $899
+LABELV $892
+LABELV $871
+endproc BotTeamAI 68 12
+bss
+export ctftaskpreferences
+align 4
+LABELV ctftaskpreferences
+skip 2560
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $888
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $887
+byte 1 105
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $884
+byte 1 119
+byte 1 104
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $799
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $627
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $507
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $506
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $220
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $219
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $180
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $174
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $173
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $172
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $171
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $162
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $161
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $149
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $148
+byte 1 118
+byte 1 111
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $144
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $143
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $138
+byte 1 25
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 25
+byte 1 41
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $74
+byte 1 116
+byte 1 0
+align 1
+LABELV $70
+byte 1 110
+byte 1 0
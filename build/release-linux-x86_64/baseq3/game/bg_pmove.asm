@@ -0,0 +1,8734 @@
+data
+export pm_stopspeed
+align 4
+LABELV pm_stopspeed
+byte 4 1120403456
+export pm_duckScale
+align 4
+LABELV pm_duckScale
+byte 4 1048576000
+export pm_swimScale
+align 4
+LABELV pm_swimScale
+byte 4 1056964608
+export pm_accelerate
+align 4
+LABELV pm_accelerate
+byte 4 1092616192
+export pm_airaccelerate
+align 4
+LABELV pm_airaccelerate
+byte 4 1065353216
+export pm_wateraccelerate
+align 4
+LABELV pm_wateraccelerate
+byte 4 1082130432
+export pm_flyaccelerate
+align 4
+LABELV pm_flyaccelerate
+byte 4 1090519040
+export pm_friction
+align 4
+LABELV pm_friction
+byte 4 1086324736
+export pm_waterfriction
+align 4
+LABELV pm_waterfriction
+byte 4 1065353216
+export pm_flightfriction
+align 4
+LABELV pm_flightfriction
+byte 4 1077936128
+export pm_spectatorfriction
+align 4
+LABELV pm_spectatorfriction
+byte 4 1084227584
+export c_pmove
+align 4
+LABELV c_pmove
+byte 4 0
+export PM_AddEvent
+code
+proc PM_AddEvent 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+LABELV $45
+endproc PM_AddEvent 0 12
+export PM_AddTouchEnt
+proc PM_AddTouchEnt 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1022
+NEI4 $47
+ADDRGP4 $46
+JUMPV
+LABELV $47
+ADDRGP4 pm
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 32
+NEI4 $49
+ADDRGP4 $46
+JUMPV
+LABELV $49
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $54
+JUMPV
+LABELV $51
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $55
+ADDRGP4 $46
+JUMPV
+LABELV $55
+LABELV $52
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $54
+ADDRLP4 0
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+LTI4 $51
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $46
+endproc PM_AddTouchEnt 12 0
+proc PM_StartTorsoAnim 8 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $58
+ADDRGP4 $57
+JUMPV
+LABELV $58
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 0
+INDIRI4
+BORI4
+ASGNI4
+LABELV $57
+endproc PM_StartTorsoAnim 8 0
+proc PM_StartLegsAnim 8 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $61
+ADDRGP4 $60
+JUMPV
+LABELV $61
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $63
+ADDRGP4 $60
+JUMPV
+LABELV $63
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 0
+INDIRI4
+BORI4
+ASGNI4
+LABELV $60
+endproc PM_StartLegsAnim 8 0
+proc PM_ContinueLegsAnim 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ADDRFP4 0
+INDIRI4
+NEI4 $66
+ADDRGP4 $65
+JUMPV
+LABELV $66
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $68
+ADDRGP4 $65
+JUMPV
+LABELV $68
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_StartLegsAnim
+CALLV
+pop
+LABELV $65
+endproc PM_ContinueLegsAnim 0 4
+proc PM_ContinueTorsoAnim 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ADDRFP4 0
+INDIRI4
+NEI4 $71
+ADDRGP4 $70
+JUMPV
+LABELV $71
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $73
+ADDRGP4 $70
+JUMPV
+LABELV $73
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $70
+endproc PM_ContinueTorsoAnim 0 4
+proc PM_ForceLegsAnim 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_StartLegsAnim
+CALLV
+pop
+LABELV $75
+endproc PM_ForceLegsAnim 0 4
+export PM_ClipVelocity
+proc PM_ClipVelocity 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $77
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $78
+JUMPV
+LABELV $77
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $78
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $79
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $80
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $79
+LABELV $76
+endproc PM_ClipVelocity 32 0
+proc PM_Friction 48 4
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 pml+44
+INDIRI4
+CNSTI4 0
+EQI4 $84
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+LABELV $84
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $88
+ADDRLP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $83
+JUMPV
+LABELV $88
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+GTI4 $90
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $92
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 36
+INDIRI4
+NEI4 $92
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $97
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_stopspeed
+INDIRF4
+GEF4 $100
+ADDRLP4 40
+ADDRGP4 pm_stopspeed
+INDIRF4
+ASGNF4
+ADDRGP4 $101
+JUMPV
+LABELV $100
+ADDRLP4 40
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $101
+ADDRLP4 28
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 pm_friction
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $97
+LABELV $92
+LABELV $90
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $103
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_waterfriction
+INDIRF4
+MULF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $103
+ADDRGP4 PW_FLIGHT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $106
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_flightfriction
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $106
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $109
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_spectatorfriction
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $109
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $112
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+LABELV $112
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $83
+endproc PM_Friction 48 4
+proc PM_Accelerate 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $115
+ADDRGP4 $114
+JUMPV
+LABELV $115
+ADDRLP4 4
+ADDRFP4 8
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $118
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $118
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $120
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $121
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $120
+LABELV $114
+endproc PM_Accelerate 32 0
+proc PM_CmdScale 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 21
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+EQI4 $125
+LABELV $125
+ADDRFP4 0
+INDIRP4
+CNSTI4 21
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $127
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $127
+ADDRFP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $129
+ADDRFP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $129
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $131
+CNSTF4 0
+RETF4
+ADDRGP4 $124
+JUMPV
+LABELV $131
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 21
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1123942400
+ADDRLP4 4
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $124
+endproc PM_CmdScale 44 4
+proc PM_SetMovementDir 72 0
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $136
+ADDRLP4 0
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+EQI4 $134
+LABELV $136
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+NEI4 $137
+ADDRLP4 8
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+LEI4 $137
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $137
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+GEI4 $139
+ADDRLP4 16
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+LEI4 $139
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $139
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+GEI4 $141
+ADDRLP4 24
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+NEI4 $141
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $141
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+GEI4 $143
+ADDRLP4 32
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+GEI4 $143
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $143
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+NEI4 $145
+ADDRLP4 40
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+GEI4 $145
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $145
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+LEI4 $147
+ADDRLP4 48
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+GEI4 $147
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $147
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+LEI4 $149
+ADDRLP4 56
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+NEI4 $149
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $149
+ADDRLP4 64
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 68
+INDIRI4
+LEI4 $135
+ADDRLP4 64
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 68
+INDIRI4
+LEI4 $135
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $134
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $153
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $155
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $155
+LABELV $154
+LABELV $135
+LABELV $133
+endproc PM_SetMovementDir 72 0
+proc PM_CheckJump 8 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $158
+CNSTI4 0
+RETI4
+ADDRGP4 $157
+JUMPV
+LABELV $158
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+GEI4 $160
+CNSTI4 0
+RETI4
+ADDRGP4 $157
+JUMPV
+LABELV $160
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $162
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+RETI4
+ADDRGP4 $157
+JUMPV
+LABELV $162
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1132920832
+ASGNF4
+CNSTI4 10
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $166
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $166
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $167
+CNSTI4 1
+RETI4
+LABELV $157
+endproc PM_CheckJump 8 4
+proc PM_CheckWaterJump 56 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $169
+CNSTI4 0
+RETI4
+ADDRGP4 $168
+JUMPV
+LABELV $169
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $171
+CNSTI4 0
+RETI4
+ADDRGP4 $168
+JUMPV
+LABELV $171
+ADDRLP4 12
+ADDRGP4 pml
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 pml+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRLP4 36
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $181
+CNSTI4 0
+RETI4
+ADDRGP4 $168
+JUMPV
+LABELV $181
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRLP4 44
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 33619969
+BANDI4
+CNSTI4 0
+EQI4 $184
+CNSTI4 0
+RETI4
+ADDRGP4 $168
+JUMPV
+LABELV $184
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1128792064
+ADDRGP4 pml
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1128792064
+ADDRGP4 pml+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1128792064
+ADDRGP4 pml+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1135542272
+ASGNF4
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 2000
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $168
+endproc PM_CheckWaterJump 56 8
+proc PM_WaterJumpMove 12 4
+CNSTI4 1
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $190
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -353
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $190
+LABELV $188
+endproc PM_WaterJumpMove 12 4
+proc PM_WaterMove 76 16
+ADDRLP4 40
+ADDRGP4 PM_CheckWaterJump
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $193
+ADDRGP4 PM_WaterJumpMove
+CALLV
+pop
+ADDRGP4 $192
+JUMPV
+LABELV $193
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $195
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 3262119936
+ASGNF4
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $199
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $200
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $199
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $196
+ADDRLP4 24
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_swimScale
+INDIRF4
+MULF4
+LEF4 $205
+ADDRLP4 20
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_swimScale
+INDIRF4
+MULF4
+ASGNF4
+LABELV $205
+ADDRLP4 24
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 pm_wateraccelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRGP4 pml+48
+INDIRI4
+CNSTI4 0
+EQI4 $207
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRGP4 pml+52+24
+INDIRF4
+MULF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRGP4 pml+52+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRGP4 pml+52+24+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $207
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 64
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $207
+CNSTI4 0
+ARGI4
+ADDRGP4 PM_SlideMove
+CALLI4
+pop
+LABELV $192
+endproc PM_WaterMove 76 16
+proc PM_InvulnerabilityMove 8 0
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 pm
+INDIRP4
+CNSTI4 26
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $220
+endproc PM_InvulnerabilityMove 8 0
+proc PM_FlyMove 52 12
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $222
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $226
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $227
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $226
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $223
+ADDRLP4 20
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRGP4 pm_flyaccelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+LABELV $221
+endproc PM_FlyMove 52 12
+proc PM_AirMove 84 16
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 68
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 68
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 24
+ADDRLP4 44
+ARGP4
+ADDRLP4 72
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 PM_SetMovementDir
+CALLV
+pop
+ADDRGP4 pml+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 pml+12+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 pml
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $237
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $238
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $237
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRLP4 76
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRGP4 pm_airaccelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRGP4 pml+48
+INDIRI4
+CNSTI4 0
+EQI4 $243
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+LABELV $243
+CNSTI4 1
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+LABELV $232
+endproc PM_AirMove 84 16
+proc PM_GrappleMove 52 4
+ADDRLP4 28
+CNSTF4 3246391296
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ADDRGP4 pml
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 pml+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 3246391296
+ADDRGP4 pml+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 24
+INDIRF4
+CNSTF4 1120403456
+GTF4 $261
+ADDRLP4 44
+CNSTF4 1092616192
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 24
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRLP4 48
+CNSTF4 1145569280
+ASGNF4
+ADDRLP4 0
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1145569280
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $262
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+LABELV $248
+endproc PM_GrappleMove 52 4
+proc PM_WalkMove 132 16
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+LEI4 $273
+ADDRGP4 pml
+INDIRF4
+ADDRGP4 pml+52+24
+INDIRF4
+MULF4
+ADDRGP4 pml+4
+INDIRF4
+ADDRGP4 pml+52+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 pml+8
+INDIRF4
+ADDRGP4 pml+52+24+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+LEF4 $273
+ADDRGP4 PM_WaterMove
+CALLV
+pop
+ADDRGP4 $272
+JUMPV
+LABELV $273
+ADDRLP4 76
+ADDRGP4 PM_CheckJump
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $285
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $287
+ADDRGP4 PM_WaterMove
+CALLV
+pop
+ADDRGP4 $272
+JUMPV
+LABELV $287
+ADDRGP4 PM_AirMove
+CALLV
+pop
+ADDRGP4 $272
+JUMPV
+LABELV $285
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 80
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 80
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 24
+ADDRLP4 48
+ARGP4
+ADDRLP4 84
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRGP4 PM_SetMovementDir
+CALLV
+pop
+ADDRGP4 pml+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 pml+12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 88
+ADDRGP4 pml
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRGP4 pml+12
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pml
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $299
+ADDRLP4 92
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 92
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $300
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $299
+ADDRLP4 32
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ARGP4
+ADDRLP4 92
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 24
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_duckScale
+INDIRF4
+MULF4
+LEF4 $306
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_duckScale
+INDIRF4
+MULF4
+ASGNF4
+LABELV $306
+LABELV $304
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $308
+ADDRLP4 100
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 100
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 104
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDRGP4 pm_swimScale
+INDIRF4
+SUBF4
+ADDRLP4 96
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 100
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+MULF4
+LEF4 $310
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+LABELV $310
+LABELV $308
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 96
+INDIRI4
+NEI4 $316
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 96
+INDIRI4
+EQI4 $312
+LABELV $316
+ADDRLP4 72
+ADDRGP4 pm_airaccelerate
+INDIRF4
+ASGNF4
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRLP4 72
+ADDRGP4 pm_accelerate
+INDIRF4
+ASGNF4
+LABELV $313
+ADDRLP4 32
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 100
+INDIRI4
+NEI4 $321
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 100
+INDIRI4
+EQI4 $317
+LABELV $321
+ADDRLP4 104
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 104
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+ADDRLP4 104
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $317
+LABELV $318
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 108
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 112
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 120
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 128
+CNSTF4 0
+ASGNF4
+ADDRLP4 124
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+NEF4 $325
+ADDRLP4 124
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+NEF4 $325
+ADDRGP4 $272
+JUMPV
+LABELV $325
+CNSTI4 0
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+LABELV $272
+endproc PM_WalkMove 132 16
+proc PM_DeadMove 20 4
+ADDRGP4 pml+44
+INDIRI4
+CNSTI4 0
+NEI4 $328
+ADDRGP4 $327
+JUMPV
+LABELV $328
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GTF4 $331
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $332
+LABELV $327
+endproc PM_DeadMove 20 4
+proc PM_NoclipMove 108 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 26
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+GEF4 $334
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 vec3_origin
+INDIRB
+ASGNB 12
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 56
+CNSTF4 1069547520
+ADDRGP4 pm_friction
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 pm_stopspeed
+INDIRF4
+GEF4 $337
+ADDRLP4 68
+ADDRGP4 pm_stopspeed
+INDIRF4
+ASGNF4
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRLP4 68
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $338
+ADDRLP4 60
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 52
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 24
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 0
+GEF4 $340
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+LABELV $340
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+LABELV $335
+ADDRGP4 pm
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 72
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 72
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $342
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $343
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $342
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRGP4 pm_accelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRLP4 84
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 84
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 92
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 100
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 104
+ADDRLP4 100
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+ADDRLP4 100
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $333
+endproc PM_NoclipMove 108 12
+proc PM_FootstepForSurface 0 0
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $352
+CNSTI4 0
+RETI4
+ADDRGP4 $351
+JUMPV
+LABELV $352
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 1048576
+BANDI4
+CNSTI4 0
+EQI4 $356
+CNSTI4 82
+RETI4
+ADDRGP4 $351
+JUMPV
+LABELV $356
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $360
+CNSTI4 2
+RETI4
+ADDRGP4 $351
+JUMPV
+LABELV $360
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $364
+CNSTI4 81
+RETI4
+ADDRGP4 $351
+JUMPV
+LABELV $364
+CNSTI4 1
+RETI4
+LABELV $351
+endproc PM_FootstepForSurface 0 0
+proc PM_CrashLand 56 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $369
+CNSTI4 21
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRGP4 $370
+JUMPV
+LABELV $369
+CNSTI4 19
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+LABELV $370
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 130
+ASGNI4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 pml+112+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 pml+124+8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+NEGI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 12
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+GEF4 $375
+ADDRGP4 $368
+JUMPV
+LABELV $375
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 4
+INDIRF4
+NEGF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 953267991
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $377
+ADDRLP4 0
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $377
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $379
+ADDRGP4 $368
+JUMPV
+LABELV $379
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $381
+ADDRLP4 0
+CNSTF4 1048576000
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $381
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $383
+ADDRLP4 0
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $383
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+GEF4 $385
+ADDRGP4 $368
+JUMPV
+LABELV $385
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $387
+ADDRLP4 0
+INDIRF4
+CNSTF4 1114636288
+LEF4 $391
+CNSTI4 8
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRLP4 0
+INDIRF4
+CNSTF4 1109393408
+LEF4 $393
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $394
+CNSTI4 7
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $394
+JUMPV
+LABELV $393
+ADDRLP4 0
+INDIRF4
+CNSTF4 1088421888
+LEF4 $397
+CNSTI4 6
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRLP4 52
+ADDRGP4 PM_FootstepForSurface
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $398
+LABELV $394
+LABELV $392
+LABELV $387
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $368
+endproc PM_CrashLand 56 4
+proc PM_CorrectAllSolid 40 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $400
+ADDRGP4 $402
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $400
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+LABELV $403
+ADDRLP4 16
+CNSTI4 -1
+ASGNI4
+LABELV $407
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+LABELV $411
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $417
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 1048576000
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 pml+52
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 56
+CNSTI4 1
+RETI4
+ADDRGP4 $399
+JUMPV
+LABELV $417
+LABELV $412
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+LEI4 $411
+LABELV $408
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LEI4 $407
+LABELV $404
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+LEI4 $403
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+LABELV $399
+endproc PM_CorrectAllSolid 40 28
+proc PM_GroundTraceMissed 80 28
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $425
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $427
+ADDRGP4 $429
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $427
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 68
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $431
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $434
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $435
+JUMPV
+LABELV $434
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $435
+LABELV $431
+LABELV $425
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+LABELV $424
+endproc PM_GroundTraceMissed 80 28
+proc PM_GroundTrace 92 28
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 68
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 68
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 1048576000
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 72
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 pml+52
+ADDRLP4 0
+INDIRB
+ASGNB 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $442
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ADDRGP4 PM_CorrectAllSolid
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRGP4 $438
+JUMPV
+LABELV $444
+LABELV $442
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $446
+ADDRGP4 PM_GroundTraceMissed
+CALLV
+pop
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $446
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 80
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+CNSTF4 0
+LEF4 $451
+ADDRLP4 80
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+MULF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1092616192
+LEF4 $451
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $458
+ADDRGP4 $460
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $458
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $461
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $462
+JUMPV
+LABELV $461
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $462
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $451
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 1060320051
+GEF4 $465
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $469
+ADDRGP4 $471
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $469
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 1
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $465
+ADDRGP4 pml+48
+CNSTI4 1
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 1
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $476
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 -289
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $476
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $478
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $480
+ADDRGP4 $482
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $480
+ADDRGP4 PM_CrashLand
+CALLV
+pop
+ADDRGP4 pml+124+8
+INDIRF4
+CNSTF4 3276275712
+GEF4 $483
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 250
+ASGNI4
+LABELV $483
+LABELV $478
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRLP4 0+52
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddTouchEnt
+CALLV
+pop
+LABELV $438
+endproc PM_GroundTrace 92 28
+proc PM_SetWaterLevel 56 8
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRLP4 28
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $492
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 -24
+SUBI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRLP4 40
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $495
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRLP4 48
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $498
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $498
+LABELV $495
+LABELV $492
+LABELV $489
+endproc PM_SetWaterLevel 56 8
+proc PM_CheckDuck 76 28
+ADDRGP4 PW_INVULNERABILITY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $501
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $503
+ADDRGP4 pm
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTF4 3257401344
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 3257401344
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTF4 3257401344
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 1109917696
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1109917696
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1109917696
+ASGNF4
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRGP4 pm
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+LABELV $504
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $500
+JUMPV
+LABELV $501
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $505
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 -16
+ASGNI4
+ADDRGP4 $500
+JUMPV
+LABELV $505
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+GEI4 $507
+ADDRLP4 60
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $509
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 60
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 60
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 64
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $511
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $511
+LABELV $509
+LABELV $508
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $513
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 26
+ASGNI4
+LABELV $514
+LABELV $500
+endproc PM_CheckDuck 76 28
+proc PM_Footsteps 64 4
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 212
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $516
+ADDRGP4 PW_INVULNERABILITY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $518
+CNSTI4 23
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+LABELV $518
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $515
+CNSTI4 17
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $515
+JUMPV
+LABELV $516
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+NEI4 $522
+ADDRLP4 32
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+NEI4 $522
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+CNSTF4 1084227584
+GEF4 $515
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $526
+CNSTI4 23
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $515
+JUMPV
+LABELV $526
+CNSTI4 22
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $515
+JUMPV
+LABELV $522
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 40
+INDIRI4
+EQI4 $528
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $530
+CNSTI4 32
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $529
+JUMPV
+LABELV $530
+CNSTI4 13
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $529
+JUMPV
+LABELV $528
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $532
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $534
+CNSTI4 16
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $535
+JUMPV
+LABELV $534
+CNSTI4 15
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+LABELV $535
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $533
+JUMPV
+LABELV $532
+ADDRLP4 4
+CNSTF4 1050253722
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $536
+CNSTI4 33
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $537
+JUMPV
+LABELV $536
+CNSTI4 14
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+LABELV $537
+LABELV $533
+LABELV $529
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 pml+40
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+BXORI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $539
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $541
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $542
+ADDRGP4 pm
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $542
+ADDRLP4 60
+ADDRGP4 PM_FootstepForSurface
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $542
+JUMPV
+LABELV $541
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $545
+CNSTI4 3
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $546
+JUMPV
+LABELV $545
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $547
+CNSTI4 5
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $548
+JUMPV
+LABELV $547
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $549
+LABELV $549
+LABELV $548
+LABELV $546
+LABELV $542
+LABELV $539
+LABELV $515
+endproc PM_Footsteps 64 4
+proc PM_WaterEvents 16 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $552
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $552
+CNSTI4 11
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $552
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $555
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $555
+CNSTI4 12
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $555
+ADDRLP4 8
+CNSTI4 3
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $558
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $558
+CNSTI4 13
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $558
+ADDRLP4 12
+CNSTI4 3
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $561
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $561
+CNSTI4 14
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $561
+LABELV $551
+endproc PM_WaterEvents 16 4
+proc PM_BeginWeaponChange 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $567
+ADDRFP4 0
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $565
+LABELV $567
+ADDRGP4 $564
+JUMPV
+LABELV $565
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $568
+ADDRGP4 $564
+JUMPV
+LABELV $568
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $570
+ADDRGP4 $564
+JUMPV
+LABELV $570
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $564
+endproc PM_BeginWeaponChange 8 4
+proc PM_FinishWeaponChange 12 4
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $575
+ADDRLP4 0
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LTI4 $573
+LABELV $575
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $573
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $576
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $576
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 250
+ADDI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $572
+endproc PM_FinishWeaponChange 12 4
+proc PM_TorsoAnimation 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $579
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $581
+CNSTI4 12
+ARGI4
+ADDRGP4 PM_ContinueTorsoAnim
+CALLV
+pop
+ADDRGP4 $578
+JUMPV
+LABELV $581
+CNSTI4 11
+ARGI4
+ADDRGP4 PM_ContinueTorsoAnim
+CALLV
+pop
+LABELV $579
+LABELV $578
+endproc PM_TorsoAnimation 0 4
+proc PM_Weapon 28 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $584
+ADDRGP4 $583
+JUMPV
+LABELV $584
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $586
+ADDRGP4 $583
+JUMPV
+LABELV $586
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $588
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $583
+JUMPV
+LABELV $588
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $590
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+NEI4 $591
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ASGNP4
+CNSTI4 52
+ADDRGP4 STAT_HOLDABLE_ITEM
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $594
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+LTI4 $594
+ADDRGP4 $583
+JUMPV
+LABELV $594
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+CNSTI4 52
+ADDRGP4 STAT_HOLDABLE_ITEM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 21
+ADDI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 STAT_HOLDABLE_ITEM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $583
+JUMPV
+LABELV $590
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -1025
+BANDI4
+ASGNI4
+LABELV $591
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $598
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $598
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $603
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $601
+LABELV $603
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU1
+CVUI4 1
+EQI4 $604
+ADDRGP4 pm
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRGP4 PM_BeginWeaponChange
+CALLV
+pop
+LABELV $604
+LABELV $601
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $606
+ADDRGP4 $583
+JUMPV
+LABELV $606
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $608
+ADDRGP4 PM_FinishWeaponChange
+CALLV
+pop
+ADDRGP4 $583
+JUMPV
+LABELV $608
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $610
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $612
+CNSTI4 12
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $583
+JUMPV
+LABELV $612
+CNSTI4 11
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $583
+JUMPV
+LABELV $610
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $614
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $583
+JUMPV
+LABELV $614
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $616
+ADDRGP4 pm
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $618
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $583
+JUMPV
+LABELV $618
+CNSTI4 8
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $616
+CNSTI4 7
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $617
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $620
+CNSTI4 17
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRGP4 $583
+JUMPV
+LABELV $620
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $622
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $622
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $624
+ADDRLP4 16
+INDIRI4
+CNSTI4 14
+GTI4 $624
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $641-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $641
+address $627
+address $630
+address $629
+address $632
+address $633
+address $628
+address $635
+address $634
+address $636
+address $637
+address $638
+address $639
+address $640
+address $631
+code
+LABELV $624
+LABELV $627
+ADDRLP4 0
+CNSTI4 400
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $628
+ADDRLP4 0
+CNSTI4 50
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $629
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $630
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $631
+ADDRLP4 0
+CNSTI4 75
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $632
+ADDRLP4 0
+CNSTI4 800
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $633
+ADDRLP4 0
+CNSTI4 800
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $634
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $635
+ADDRLP4 0
+CNSTI4 1500
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $636
+ADDRLP4 0
+CNSTI4 200
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $637
+ADDRLP4 0
+CNSTI4 400
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $638
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $639
+ADDRLP4 0
+CNSTI4 800
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $640
+ADDRLP4 0
+CNSTI4 30
+ASGNI4
+LABELV $625
+CNSTI4 52
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRGP4 PW_SCOUT
+INDIRI4
+NEI4 $643
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1069547520
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $644
+JUMPV
+LABELV $643
+CNSTI4 52
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRGP4 PW_ARMORREGEN
+INDIRI4
+NEI4 $646
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1067869798
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $647
+JUMPV
+LABELV $646
+ADDRGP4 PW_HASTE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $649
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1067869798
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $649
+LABELV $647
+LABELV $644
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $583
+endproc PM_Weapon 28 4
+proc PM_Animate 0 4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $652
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $653
+CNSTI4 6
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 2294
+ASGNI4
+CNSTI4 74
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $653
+JUMPV
+LABELV $652
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $656
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $657
+CNSTI4 25
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 600
+ASGNI4
+ADDRGP4 $657
+JUMPV
+LABELV $656
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $660
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $661
+CNSTI4 26
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 600
+ASGNI4
+ADDRGP4 $661
+JUMPV
+LABELV $660
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $664
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $665
+CNSTI4 27
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 600
+ASGNI4
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $668
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $669
+CNSTI4 28
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 600
+ASGNI4
+ADDRGP4 $669
+JUMPV
+LABELV $668
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $672
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $673
+CNSTI4 29
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 600
+ASGNI4
+ADDRGP4 $673
+JUMPV
+LABELV $672
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $676
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $678
+CNSTI4 30
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 600
+ASGNI4
+LABELV $678
+LABELV $676
+LABELV $673
+LABELV $669
+LABELV $665
+LABELV $661
+LABELV $657
+LABELV $653
+LABELV $651
+endproc PM_Animate 0 4
+proc PM_DropTimers 4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $681
+ADDRGP4 pml+40
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LTI4 $683
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -353
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $684
+JUMPV
+LABELV $683
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $684
+LABELV $681
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $687
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $690
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $690
+LABELV $687
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $692
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $695
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $695
+LABELV $692
+LABELV $680
+endproc PM_DropTimers 4 0
+export PM_UpdateViewAngles
+proc PM_UpdateViewAngles 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+EQI4 $700
+ADDRLP4 8
+INDIRI4
+CNSTI4 6
+NEI4 $698
+LABELV $700
+ADDRGP4 $697
+JUMPV
+LABELV $698
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $701
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $701
+ADDRGP4 $697
+JUMPV
+LABELV $701
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $703
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+INDIRI4
+ADDI4
+CVII2 4
+ASGNI2
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $707
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $707
+ADDRLP4 4
+INDIRI2
+CVII4 2
+CNSTI4 16000
+LEI4 $709
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+CNSTI4 16000
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI2 16000
+ASGNI2
+ADDRGP4 $710
+JUMPV
+LABELV $709
+ADDRLP4 4
+INDIRI2
+CVII4 2
+CNSTI4 -16000
+GEI4 $711
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+CNSTI4 -16000
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI2 -16000
+ASGNI2
+LABELV $711
+LABELV $710
+LABELV $707
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDP4
+CNSTF4 1001652224
+ADDRLP4 4
+INDIRI2
+CVII4 2
+CVIF4 4
+MULF4
+ASGNF4
+LABELV $704
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $703
+LABELV $697
+endproc PM_UpdateViewAngles 32 0
+export PmoveSingle
+proc PmoveSingle 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+EQI4 $714
+LABELV $714
+ADDRLP4 0
+ADDRGP4 pm
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 c_pmove
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $716
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -33554433
+BANDI4
+ASGNI4
+LABELV $716
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+GTI4 $720
+ADDRGP4 pm
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 64
+LEI4 $718
+LABELV $720
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+LABELV $718
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $721
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRGP4 $722
+JUMPV
+LABELV $721
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+LABELV $722
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $723
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $723
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 24
+INDIRI4
+EQI4 $723
+ADDRLP4 20
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $723
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRGP4 $724
+JUMPV
+LABELV $723
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+LABELV $724
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $725
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+ADDRLP4 32
+INDIRI4
+NEI4 $725
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+LABELV $725
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $727
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 25
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 26
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $727
+ADDRGP4 pml
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 pml+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 pml+40
+INDIRI4
+CNSTI4 1
+GEI4 $730
+ADDRGP4 pml+40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRGP4 pml+40
+INDIRI4
+CNSTI4 200
+LEI4 $734
+ADDRGP4 pml+40
+CNSTI4 200
+ASGNI4
+LABELV $734
+LABELV $731
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 pml+112
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 pml+124
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 pml+36
+CNSTF4 981668463
+ADDRGP4 pml+40
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 PM_UpdateViewAngles
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 pml
+ARGP4
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 pml+24
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+GEI4 $744
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $744
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+GEI4 $746
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRGP4 $747
+JUMPV
+LABELV $746
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 40
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GTI4 $750
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $748
+ADDRLP4 40
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 48
+INDIRI4
+EQI4 $748
+LABELV $750
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+LABELV $748
+LABELV $747
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $751
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 pm
+INDIRP4
+CNSTI4 26
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $751
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $753
+ADDRGP4 PM_CheckDuck
+CALLV
+pop
+ADDRGP4 PM_FlyMove
+CALLV
+pop
+ADDRGP4 PM_DropTimers
+CALLV
+pop
+ADDRGP4 $713
+JUMPV
+LABELV $753
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $755
+ADDRGP4 PM_NoclipMove
+CALLV
+pop
+ADDRGP4 PM_DropTimers
+CALLV
+pop
+ADDRGP4 PM_Weapon
+CALLV
+pop
+ADDRGP4 $713
+JUMPV
+LABELV $755
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+NEI4 $757
+ADDRGP4 $713
+JUMPV
+LABELV $757
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 5
+EQI4 $761
+ADDRLP4 56
+INDIRI4
+CNSTI4 6
+NEI4 $759
+LABELV $761
+ADDRGP4 $713
+JUMPV
+LABELV $759
+ADDRGP4 PM_SetWaterLevel
+CALLV
+pop
+ADDRGP4 pml+136
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 PM_CheckDuck
+CALLV
+pop
+ADDRGP4 PM_GroundTrace
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $763
+ADDRGP4 PM_DeadMove
+CALLV
+pop
+LABELV $763
+ADDRGP4 PM_DropTimers
+CALLV
+pop
+ADDRGP4 PW_INVULNERABILITY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $765
+ADDRGP4 PM_InvulnerabilityMove
+CALLV
+pop
+ADDRGP4 $766
+JUMPV
+LABELV $765
+ADDRGP4 PW_FLIGHT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $767
+ADDRGP4 PM_FlyMove
+CALLV
+pop
+ADDRGP4 $768
+JUMPV
+LABELV $767
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $769
+ADDRGP4 PM_GrappleMove
+CALLV
+pop
+ADDRGP4 PM_AirMove
+CALLV
+pop
+ADDRGP4 $770
+JUMPV
+LABELV $769
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $771
+ADDRGP4 PM_WaterJumpMove
+CALLV
+pop
+ADDRGP4 $772
+JUMPV
+LABELV $771
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $773
+ADDRGP4 PM_WaterMove
+CALLV
+pop
+ADDRGP4 $774
+JUMPV
+LABELV $773
+ADDRGP4 pml+44
+INDIRI4
+CNSTI4 0
+EQI4 $775
+ADDRGP4 PM_WalkMove
+CALLV
+pop
+ADDRGP4 $776
+JUMPV
+LABELV $775
+ADDRGP4 PM_AirMove
+CALLV
+pop
+LABELV $776
+LABELV $774
+LABELV $772
+LABELV $770
+LABELV $768
+LABELV $766
+ADDRGP4 PM_Animate
+CALLV
+pop
+ADDRGP4 PM_GroundTrace
+CALLV
+pop
+ADDRGP4 PM_SetWaterLevel
+CALLV
+pop
+ADDRGP4 PM_Weapon
+CALLV
+pop
+ADDRGP4 PM_TorsoAnimation
+CALLV
+pop
+ADDRGP4 PM_Footsteps
+CALLV
+pop
+ADDRGP4 PM_WaterEvents
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 trap_SnapVector
+CALLV
+pop
+LABELV $713
+endproc PmoveSingle 60 16
+export Pmove
+proc Pmove 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+EQI4 $779
+LABELV $779
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+GEI4 $781
+ADDRGP4 $778
+JUMPV
+LABELV $781
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+CNSTI4 1000
+ADDI4
+LEI4 $783
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+LABELV $783
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 456
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 63
+BANDI4
+ASGNI4
+ADDRGP4 $786
+JUMPV
+LABELV $785
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $788
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+LEI4 $789
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $789
+JUMPV
+LABELV $788
+ADDRLP4 12
+INDIRI4
+CNSTI4 66
+LEI4 $792
+ADDRLP4 12
+CNSTI4 66
+ASGNI4
+LABELV $792
+LABELV $789
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PmoveSingle
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $794
+ADDRFP4 0
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 20
+ASGNI1
+LABELV $794
+LABELV $786
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $785
+LABELV $778
+endproc Pmove 24 4
+import trap_SnapVector
+import PM_StepSlideMove
+import PM_SlideMove
+import bg_playerMaxs
+import bg_playerMins
+bss
+export pml
+align 4
+LABELV pml
+skip 140
+export pm
+align 4
+LABELV pm
+skip 4
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $482
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 76
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $471
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $460
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $429
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 108
+byte 1 105
+byte 1 102
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $402
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 10
+byte 1 0
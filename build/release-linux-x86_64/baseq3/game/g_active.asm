@@ -0,0 +1,5678 @@
+export P_DamageFeedback
+code
+proc P_DamageFeedback 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $57
+ADDRGP4 $56
+JUMPV
+LABELV $57
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $59
+ADDRGP4 $56
+JUMPV
+LABELV $59
+ADDRLP4 4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $61
+ADDRLP4 4
+CNSTF4 1132396544
+ASGNF4
+LABELV $61
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $63
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $64
+JUMPV
+LABELV $63
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTF4 1132462080
+ADDRLP4 8
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTF4 1132462080
+ADDRLP4 8+4
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $64
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRI4
+LEI4 $66
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $66
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 700
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 53
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $66
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $56
+endproc P_DamageFeedback 36 12
+export P_WorldEffects
+proc P_WorldEffects 44 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $71
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 788
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 12000
+ADDI4
+ASGNI4
+ADDRGP4 $70
+JUMPV
+LABELV $71
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 848
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $76
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $77
+JUMPV
+LABELV $76
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $77
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $78
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $80
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 788
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+LABELV $80
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+GEI4 $79
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 788
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $79
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+INDIRI4
+CNSTI4 15
+LEI4 $88
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+CNSTI4 15
+ASGNI4
+LABELV $88
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+INDIRI4
+GTI4 $90
+ADDRGP4 $92
+ARGP4
+ADDRLP4 28
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 G_Sound
+CALLV
+pop
+ADDRGP4 $91
+JUMPV
+LABELV $90
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $93
+ADDRGP4 $95
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 G_Sound
+CALLV
+pop
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRGP4 $96
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 G_Sound
+CALLV
+pop
+LABELV $94
+LABELV $91
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+CNSTP4 0
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTI4 14
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $79
+JUMPV
+LABELV $78
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 788
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 12000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $79
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $99
+ADDRFP4 0
+INDIRP4
+CNSTI4 844
+ADDP4
+INDIRI4
+CNSTI4 24
+BANDI4
+ADDRLP4 16
+INDIRI4
+EQI4 $99
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+GTI4 $101
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $104
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 60
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRFP4 0
+INDIRP4
+CNSTI4 844
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $106
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 30
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 844
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $108
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 10
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 15
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $108
+LABELV $105
+LABELV $101
+LABELV $99
+LABELV $70
+endproc P_WorldEffects 44 32
+export G_SetClientSound
+proc G_SetClientSound 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $111
+ADDRGP4 $113
+ARGP4
+ADDRLP4 0
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 848
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $114
+ADDRFP4 0
+INDIRP4
+CNSTI4 844
+ADDP4
+INDIRI4
+CNSTI4 24
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $114
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRGP4 level+348
+INDIRI4
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 444
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $115
+LABELV $112
+LABELV $110
+endproc G_SetClientSound 8 4
+export ClientImpacts
+proc ClientImpacts 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $121
+JUMPV
+LABELV $118
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $125
+JUMPV
+LABELV $122
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+ADDRLP4 72
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRLP4 72
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRLP4 72
+INDIRP4
+ADDP4
+INDIRI4
+NEI4 $126
+ADDRGP4 $124
+JUMPV
+LABELV $126
+LABELV $123
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $125
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $122
+LABELV $124
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $128
+ADDRGP4 $119
+JUMPV
+LABELV $128
+ADDRLP4 8
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $130
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $130
+ADDRLP4 8
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $132
+ADDRGP4 $119
+JUMPV
+LABELV $132
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $119
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $121
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+LTI4 $118
+LABELV $117
+endproc ClientImpacts 76 12
+data
+align 4
+LABELV $135
+byte 4 1109393408
+byte 4 1109393408
+byte 4 1112539136
+export G_TouchTriggers
+code
+proc G_TouchTriggers 4240 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $136
+ADDRGP4 $134
+JUMPV
+LABELV $136
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $138
+ADDRGP4 $134
+JUMPV
+LABELV $138
+ADDRLP4 4188
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 4188
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRGP4 $135
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 4188
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRGP4 $135+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 $135+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4192
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 4192
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRGP4 $135
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 4192
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRGP4 $135+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 $135+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4196
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4196
+INDIRI4
+ASGNI4
+ADDRLP4 4204
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 4204
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 4204
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4216
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 4216
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 4216
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $155
+JUMPV
+LABELV $152
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 92
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4224
+CNSTI4 756
+ASGNI4
+ADDRLP4 4228
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4224
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4228
+INDIRU4
+NEU4 $156
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4224
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4228
+INDIRU4
+NEU4 $156
+ADDRGP4 $153
+JUMPV
+LABELV $156
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 1073741824
+BANDI4
+CNSTI4 0
+NEI4 $158
+ADDRGP4 $153
+JUMPV
+LABELV $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $160
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 9
+EQI4 $162
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 Touch_DoorTrigger
+CVPU4 4
+EQU4 $162
+ADDRGP4 $153
+JUMPV
+LABELV $162
+LABELV $160
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $164
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRLP4 4232
+ADDRGP4 BG_PlayerTouchesItem
+CALLI4
+ASGNI4
+ADDRLP4 4232
+INDIRI4
+CNSTI4 0
+NEI4 $165
+ADDRGP4 $153
+JUMPV
+LABELV $164
+ADDRLP4 64
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4232
+ADDRGP4 trap_EntityContact
+CALLI4
+ASGNI4
+ADDRLP4 4232
+INDIRI4
+CNSTI4 0
+NEI4 $169
+ADDRGP4 $153
+JUMPV
+LABELV $169
+LABELV $165
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $171
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $171
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $173
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $173
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $173
+LABELV $153
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $155
+ADDRLP4 4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LTI4 $152
+ADDRLP4 4224
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4224
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ADDRLP4 4224
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+EQI4 $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 448
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $175
+LABELV $134
+endproc G_TouchTriggers 4240 16
+export SpectatorThink
+proc SpectatorThink 256 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $178
+ADDRLP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $180
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $181
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 400
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 236
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 24
+ADDRLP4 4+28
+CNSTI4 65537
+ASGNI4
+ADDRLP4 4+228
+ADDRGP4 trap_Trace
+ASGNP4
+ADDRLP4 4+232
+ADDRGP4 trap_PointContents
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_TouchTriggers
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $178
+ADDRLP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 248
+CNSTI4 1
+ASGNI4
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+ADDRLP4 248
+INDIRI4
+BANDI4
+ADDRLP4 252
+INDIRI4
+EQI4 $186
+ADDRLP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRI4
+ADDRLP4 248
+INDIRI4
+BANDI4
+ADDRLP4 252
+INDIRI4
+NEI4 $186
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Cmd_FollowCycle_f
+CALLV
+pop
+LABELV $186
+LABELV $177
+endproc SpectatorThink 256 12
+export ClientInactivityTimer
+proc ClientInactivityTimer 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_inactivity+12
+INDIRI4
+CNSTI4 0
+NEI4 $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 60000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 533
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 534
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 535
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $193
+LABELV $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_inactivity+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $200
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRI4
+LEI4 $202
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 888
+DIVI4
+ARGI4
+ADDRGP4 $205
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $202
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $206
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $206
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 888
+DIVI4
+ARGI4
+ADDRGP4 $209
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $206
+LABELV $200
+LABELV $194
+LABELV $190
+CNSTI4 1
+RETI4
+LABELV $188
+endproc ClientInactivityTimer 12 8
+export ClientTimerActions
+proc ClientTimerActions 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+ADDRGP4 PW_REGEN
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $214
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+GEI4 $216
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 15
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1066192077
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+LEF4 $218
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+CNSTF4 1066192077
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $218
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 61
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $215
+JUMPV
+LABELV $216
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+GEI4 $215
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+LEI4 $222
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $222
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 61
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+LEI4 $224
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $224
+LABELV $215
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ASGNP4
+ADDRGP4 STAT_ARMOR
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+INDIRI4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+INDIRI4
+LEI4 $226
+ADDRLP4 20
+ADDRGP4 STAT_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $226
+LABELV $212
+ADDRLP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+INDIRI4
+CNSTI4 1000
+GEI4 $211
+LABELV $210
+endproc ClientTimerActions 24 12
+export ClientIntermissionThink
+proc ClientIntermissionThink 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+BANDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BXORI4
+BANDI4
+CNSTI4 0
+EQI4 $229
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $229
+LABELV $228
+endproc ClientIntermissionThink 24 0
+export ClientEvents
+proc ClientEvents 80 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $232
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $232
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $237
+JUMPV
+LABELV $234
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 7
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $240
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+EQI4 $240
+ADDRLP4 4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LTI4 $239
+LABELV $269
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+LTI4 $239
+ADDRLP4 4
+INDIRI4
+CNSTI4 26
+GTI4 $239
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $270-80
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $270
+address $249
+address $239
+address $250
+address $262
+address $263
+address $264
+address $267
+code
+LABELV $240
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $241
+ADDRGP4 $239
+JUMPV
+LABELV $241
+ADDRGP4 g_dmflags+12
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $243
+ADDRGP4 $239
+JUMPV
+LABELV $243
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $246
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $247
+JUMPV
+LABELV $246
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+LABELV $247
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+CNSTP4 0
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+CNSTP4 0
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 19
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $239
+JUMPV
+LABELV $249
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FireWeapon
+CALLV
+pop
+ADDRGP4 $239
+JUMPV
+LABELV $250
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $251
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ASGNI4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $253
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ASGNI4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $255
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ASGNI4
+LABELV $255
+LABELV $254
+LABELV $252
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $257
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 76
+ADDRGP4 Drop_Item
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 812
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+CNSTI4 1
+GEI4 $260
+ADDRLP4 48
+INDIRP4
+CNSTI4 812
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $260
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 SelectSpawnPoint
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 TeleportPlayer
+CALLV
+pop
+ADDRGP4 $239
+JUMPV
+LABELV $262
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $263
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 880
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_StartKamikaze
+CALLV
+pop
+ADDRGP4 $239
+JUMPV
+LABELV $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 816
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $265
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DropPortalSource
+CALLV
+pop
+ADDRGP4 $239
+JUMPV
+LABELV $265
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DropPortalDestination
+CALLV
+pop
+ADDRGP4 $239
+JUMPV
+LABELV $267
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 880
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+LABELV $239
+LABELV $235
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $237
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LTI4 $234
+LABELV $231
+endproc ClientEvents 80 32
+proc StuckInOtherClient 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $273
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $277
+ADDRGP4 $274
+JUMPV
+LABELV $277
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRGP4 $274
+JUMPV
+LABELV $279
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $281
+ADDRGP4 $274
+JUMPV
+LABELV $281
+ADDRLP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $283
+ADDRGP4 $274
+JUMPV
+LABELV $283
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+LEF4 $285
+ADDRGP4 $274
+JUMPV
+LABELV $285
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRF4
+LEF4 $287
+ADDRGP4 $274
+JUMPV
+LABELV $287
+ADDRLP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRF4
+LEF4 $289
+ADDRGP4 $274
+JUMPV
+LABELV $289
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRF4
+GEF4 $291
+ADDRGP4 $274
+JUMPV
+LABELV $291
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRF4
+GEF4 $293
+ADDRGP4 $274
+JUMPV
+LABELV $293
+ADDRLP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+GEF4 $295
+ADDRGP4 $274
+JUMPV
+LABELV $295
+CNSTI4 1
+RETI4
+ADDRGP4 $272
+JUMPV
+LABELV $274
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $273
+CNSTI4 0
+RETI4
+LABELV $272
+endproc StuckInOtherClient 8 0
+export SendPendingPredictableEvents
+proc SendPendingPredictableEvents 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+GEI4 $298
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 8
+LSHI4
+BORI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $298
+LABELV $297
+endproc SendPendingPredictableEvents 52 12
+lit
+align 4
+LABELV $365
+byte 4 3257401344
+byte 4 3257401344
+byte 4 3257401344
+align 4
+LABELV $366
+byte 4 1109917696
+byte 4 1109917696
+byte 4 1109917696
+export ClientThink_real
+code
+proc ClientThink_real 344 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $301
+ADDRGP4 $300
+JUMPV
+LABELV $301
+ADDRLP4 240
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRLP4 240
+INDIRP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $303
+ADDRLP4 240
+INDIRP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+LABELV $303
+ADDRLP4 240
+INDIRP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+SUBI4
+GEI4 $307
+ADDRLP4 240
+INDIRP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+LABELV $307
+ADDRLP4 244
+ADDRLP4 240
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 1
+GEI4 $311
+ADDRLP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $311
+ADDRGP4 $300
+JUMPV
+LABELV $311
+ADDRLP4 244
+INDIRI4
+CNSTI4 200
+LEI4 $313
+ADDRLP4 244
+CNSTI4 200
+ASGNI4
+LABELV $313
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 8
+GEI4 $315
+ADDRGP4 $318
+ARGP4
+ADDRGP4 $319
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 pmove_msec
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 $316
+JUMPV
+LABELV $315
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 33
+LEI4 $320
+ADDRGP4 $318
+ARGP4
+ADDRGP4 $323
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 pmove_msec
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $320
+LABELV $316
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ADDRLP4 252
+INDIRI4
+NEI4 $327
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ADDRLP4 252
+INDIRI4
+EQI4 $324
+LABELV $327
+ADDRLP4 240
+INDIRP4
+ADDRLP4 240
+INDIRP4
+INDIRI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+DIVI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+MULI4
+ASGNI4
+LABELV $324
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $331
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientIntermissionThink
+CALLV
+pop
+ADDRGP4 $300
+JUMPV
+LABELV $331
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $334
+ADDRLP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $336
+ADDRGP4 $300
+JUMPV
+LABELV $336
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+INDIRP4
+ARGP4
+ADDRGP4 SpectatorThink
+CALLV
+pop
+ADDRGP4 $300
+JUMPV
+LABELV $334
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 ClientInactivityTimer
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $338
+ADDRGP4 $300
+JUMPV
+LABELV $338
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+LEI4 $340
+ADDRLP4 260
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ADDRLP4 260
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+LABELV $340
+ADDRLP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $343
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $344
+JUMPV
+LABELV $343
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $345
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $346
+LABELV $344
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRGP4 g_gravity+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 g_speed+8
+INDIRF4
+CVFI4 4
+ASGNI4
+CNSTI4 52
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRGP4 PW_SCOUT
+INDIRI4
+NEI4 $349
+ADDRLP4 260
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+CNSTF4 1069547520
+ADDRLP4 260
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRGP4 PW_HASTE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $352
+ADDRLP4 260
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+CNSTF4 1067869798
+ADDRLP4 260
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $352
+LABELV $350
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $354
+ADDRLP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $354
+ADDRLP4 240
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $354
+ADDRLP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_HookFree
+CALLV
+pop
+LABELV $354
+ADDRLP4 248
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 236
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 268
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ADDRLP4 268
+INDIRI4
+NEI4 $356
+ADDRLP4 272
+ADDRLP4 240
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 276
+INDIRI4
+NEI4 $356
+ADDRLP4 272
+INDIRI4
+ADDRLP4 268
+INDIRI4
+BANDI4
+ADDRLP4 276
+INDIRI4
+EQI4 $356
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRLP4 276
+INDIRI4
+GTI4 $356
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 CheckGauntletAttack
+CALLI4
+ASGNI4
+ADDRLP4 4+40
+ADDRLP4 280
+INDIRI4
+ASGNI4
+LABELV $356
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $359
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 528
+ADDP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+ADDRLP4 284
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $359
+ADDRGP4 PW_INVULNERABILITY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $361
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+NEI4 $363
+ADDRLP4 280
+ADDRGP4 $365
+INDIRB
+ASGNB 12
+ADDRLP4 292
+ADDRGP4 $366
+INDIRB
+ASGNB 12
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ASGNP4
+ADDRLP4 304
+ADDRLP4 332
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 332
+INDIRP4
+ADDRLP4 280
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDRLP4 292
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 StuckInOtherClient
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+NEI4 $367
+ADDRLP4 340
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ADDRLP4 340
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDRLP4 304
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDRLP4 316
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $363
+LABELV $361
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRLP4 240
+INDIRP4
+INDIRB
+ASGNB 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $370
+ADDRLP4 4+28
+CNSTI4 65537
+ASGNI4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $373
+ADDRLP4 4+28
+CNSTI4 37814273
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRLP4 4+28
+CNSTI4 33619969
+ASGNI4
+LABELV $374
+LABELV $371
+ADDRLP4 4+228
+ADDRGP4 trap_Trace
+ASGNP4
+ADDRLP4 4+232
+ADDRGP4 trap_PointContents
+ASGNP4
+ADDRLP4 4+32
+ADDRGP4 g_debugMove+12
+INDIRI4
+ASGNI4
+ADDRLP4 4+36
+ADDRGP4 g_dmflags+12
+INDIRI4
+CNSTI4 32
+BANDI4
+ASGNI4
+ADDRLP4 4+216
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 4+220
+ADDRGP4 pmove_msec+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 248
+INDIRI4
+EQI4 $387
+ADDRFP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $387
+ADDRGP4 g_smoothClients+12
+INDIRI4
+CNSTI4 0
+EQI4 $390
+ADDRLP4 288
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityStateExtraPolate
+CALLV
+pop
+ADDRGP4 $391
+JUMPV
+LABELV $390
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 SendPendingPredictableEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $393
+ADDRLP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDRLP4 4+180
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDRLP4 4+192
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 848
+ADDP4
+ADDRLP4 4+208
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 844
+ADDP4
+ADDRLP4 4+204
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 248
+INDIRI4
+ARGI4
+ADDRGP4 ClientEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $399
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_TouchTriggers
+CALLV
+pop
+LABELV $399
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRGP4 BotTestAAS
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 ClientImpacts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 248
+INDIRI4
+EQI4 $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $401
+ADDRLP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+ADDRLP4 240
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 300
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRI4
+BCOMI4
+BANDI4
+BORI4
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $404
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRI4
+LEI4 $300
+ADDRGP4 g_forcerespawn+12
+INDIRI4
+CNSTI4 0
+LEI4 $409
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+ADDRGP4 g_forcerespawn+12
+INDIRI4
+MULI4
+LEI4 $409
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientRespawn
+CALLV
+pop
+ADDRGP4 $300
+JUMPV
+LABELV $409
+ADDRLP4 240
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+CNSTI4 0
+EQI4 $300
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientRespawn
+CALLV
+pop
+ADDRGP4 $300
+JUMPV
+LABELV $404
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 244
+INDIRI4
+ARGI4
+ADDRGP4 ClientTimerActions
+CALLV
+pop
+LABELV $300
+endproc ClientThink_real 344 16
+export ClientThink
+proc ClientThink 12 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 trap_GetUsercmd
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 8
+INDIRI4
+NEI4 $418
+ADDRGP4 g_synchronousClients+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $418
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientThink_real
+CALLV
+pop
+LABELV $418
+LABELV $416
+endproc ClientThink 12 8
+export G_RunClient
+proc G_RunClient 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 0
+INDIRI4
+NEI4 $422
+ADDRGP4 g_synchronousClients+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $422
+ADDRGP4 $421
+JUMPV
+LABELV $422
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientThink_real
+CALLV
+pop
+LABELV $421
+endproc G_RunClient 4 4
+export SpectatorClientEndFrame
+proc SpectatorClientEndFrame 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $427
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $429
+ADDRLP4 4
+ADDRGP4 level+340
+INDIRI4
+ASGNI4
+ADDRGP4 $430
+JUMPV
+LABELV $429
+ADDRLP4 4
+INDIRI4
+CNSTI4 -2
+NEI4 $432
+ADDRLP4 4
+ADDRGP4 level+344
+INDIRI4
+ASGNI4
+LABELV $432
+LABELV $430
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $435
+ADDRLP4 0
+CNSTI4 888
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $437
+ADDRLP4 12
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $437
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 104
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 -540673
+BANDI4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 540672
+BANDI4
+BORI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRB
+ASGNB 508
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $426
+JUMPV
+LABELV $437
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $436
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 664
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 888
+DIVI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+ADDRGP4 $436
+JUMPV
+LABELV $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 664
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 888
+DIVI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+LABELV $436
+LABELV $427
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $441
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRGP4 $442
+JUMPV
+LABELV $441
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -8193
+BANDI4
+ASGNI4
+LABELV $442
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $443
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $443
+LABELV $426
+endproc SpectatorClientEndFrame 32 4
+export ClientEndFrame
+proc ClientEndFrame 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $446
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SpectatorClientEndFrame
+CALLV
+pop
+ADDRGP4 $445
+JUMPV
+LABELV $446
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $448
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+GEI4 $452
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $452
+LABELV $449
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $448
+CNSTI4 52
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRGP4 PW_GUARD
+INDIRI4
+NEI4 $455
+ADDRGP4 PW_GUARD
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $455
+CNSTI4 52
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRGP4 PW_SCOUT
+INDIRI4
+NEI4 $459
+ADDRGP4 PW_SCOUT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $459
+CNSTI4 52
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRGP4 PW_DOUBLER
+INDIRI4
+NEI4 $463
+ADDRGP4 PW_DOUBLER
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $463
+CNSTI4 52
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRGP4 PW_ARMORREGEN
+INDIRI4
+NEI4 $467
+ADDRGP4 PW_ARMORREGEN
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $471
+ADDRGP4 PW_INVULNERABILITY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $471
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $475
+ADDRGP4 $445
+JUMPV
+LABELV $475
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 P_WorldEffects
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 P_DamageFeedback
+CALLV
+pop
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 692
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $478
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $478
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -8193
+BANDI4
+ASGNI4
+LABELV $479
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_SetClientSound
+CALLV
+pop
+ADDRGP4 g_smoothClients+12
+INDIRI4
+CNSTI4 0
+EQI4 $481
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityStateExtraPolate
+CALLV
+pop
+ADDRGP4 $482
+JUMPV
+LABELV $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 SendPendingPredictableEvents
+CALLV
+pop
+LABELV $445
+endproc ClientEndFrame 16 16
+import BotTestSolid
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $323
+byte 1 51
+byte 1 51
+byte 1 0
+align 1
+LABELV $319
+byte 1 56
+byte 1 0
+align 1
+LABELV $318
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $209
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 33
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $205
+byte 1 68
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $113
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $96
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $95
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $92
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
@@ -0,0 +1,6161 @@
+export trap_Cvar_VariableValue
+code
+proc trap_Cvar_VariableValue 132 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+RETF4
+LABELV $57
+endproc trap_Cvar_VariableValue 132 12
+export G_ParseInfos
+proc G_ParseInfos 2084 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+CNSTI4 0
+ASGNI4
+ADDRGP4 $60
+JUMPV
+LABELV $59
+ADDRFP4 0
+ARGP4
+ADDRLP4 2056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $62
+ADDRGP4 $61
+JUMPV
+LABELV $62
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $66
+ARGP4
+ADDRLP4 2060
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+EQI4 $64
+ADDRGP4 $67
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $61
+JUMPV
+LABELV $64
+ADDRLP4 2052
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $68
+ADDRGP4 $70
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $61
+JUMPV
+LABELV $68
+ADDRLP4 1028
+CNSTI1 0
+ASGNI1
+ADDRGP4 $72
+JUMPV
+LABELV $71
+ADDRFP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 2064
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $74
+ADDRGP4 $76
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $73
+JUMPV
+LABELV $74
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $79
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $77
+ADDRGP4 $73
+JUMPV
+LABELV $77
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 2072
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $80
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $82
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $80
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $72
+ADDRGP4 $71
+JUMPV
+LABELV $73
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2064
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 $84
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2072
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2064
+INDIRU4
+ADDRLP4 2068
+INDIRU4
+ADDU4
+ADDRLP4 2076
+INDIRU4
+ADDU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 2080
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 2080
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $85
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 2052
+ADDRLP4 2052
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $85
+LABELV $60
+ADDRGP4 $59
+JUMPV
+LABELV $61
+ADDRLP4 2052
+INDIRI4
+RETI4
+LABELV $58
+endproc G_ParseInfos 2084 12
+proc G_LoadArenasFromFile 16408 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16392
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16392
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $88
+ADDRGP4 $90
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRLP4 0
+INDIRI4
+CNSTI4 16384
+LTI4 $91
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $93
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 16384
+ARGI4
+ADDRLP4 16396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $87
+JUMPV
+LABELV $91
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 16396
+ADDRGP4 g_numArenas
+ASGNP4
+ADDRLP4 16400
+ADDRLP4 16396
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 16400
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 16400
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaInfos
+ADDP4
+ARGP4
+ADDRLP4 16404
+ADDRGP4 G_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 16396
+INDIRP4
+ADDRLP4 16400
+INDIRI4
+ADDRLP4 16404
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $87
+endproc G_LoadArenasFromFile 16408 16
+proc G_LoadArenas 1460 16
+ADDRGP4 g_numArenas
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 $95
+ARGP4
+ADDRGP4 $96
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 148+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $97
+ADDRLP4 148+16
+ARGP4
+ADDRGP4 G_LoadArenasFromFile
+CALLV
+pop
+ADDRGP4 $98
+JUMPV
+LABELV $97
+ADDRGP4 $101
+ARGP4
+ADDRGP4 G_LoadArenasFromFile
+CALLV
+pop
+LABELV $98
+ADDRGP4 $102
+ARGP4
+ADDRGP4 $103
+ARGP4
+ADDRLP4 420
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1444
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 1444
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 420
+ASGNP4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $104
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1448
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 140
+ADDRLP4 1448
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_LoadArenasFromFile
+CALLV
+pop
+LABELV $105
+ADDRLP4 1448
+CNSTI4 1
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $107
+ADDRLP4 136
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LTI4 $104
+ADDRGP4 $109
+ARGP4
+ADDRGP4 g_numArenas
+INDIRI4
+ARGI4
+ADDRLP4 1452
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $110
+ADDRGP4 $115
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1456
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $114
+ARGP4
+ADDRLP4 1456
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $111
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $113
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numArenas
+INDIRI4
+LTI4 $110
+LABELV $94
+endproc G_LoadArenas 1460 16
+export G_GetArenaInfoByMap
+proc G_GetArenaInfoByMap 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $120
+JUMPV
+LABELV $117
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $123
+ARGP4
+ADDRLP4 4
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $121
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $116
+JUMPV
+LABELV $121
+LABELV $118
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $120
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numArenas
+INDIRI4
+LTI4 $117
+CNSTP4 0
+RETP4
+LABELV $116
+endproc G_GetArenaInfoByMap 12 8
+proc PlayerIntroSound 80 12
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $125
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $126
+JUMPV
+LABELV $125
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+LABELV $126
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $129
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+LABELV $127
+ADDRGP4 $130
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $124
+endproc PlayerIntroSound 80 12
+export G_CountBotPlayersByName
+proc G_CountBotPlayersByName 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $132
+ADDRLP4 4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $137
+ADDRGP4 $133
+JUMPV
+LABELV $137
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+236+244
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $139
+ADDRGP4 $133
+JUMPV
+LABELV $139
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $143
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $143
+ADDRGP4 $133
+JUMPV
+LABELV $143
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $145
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $145
+ADDRGP4 $133
+JUMPV
+LABELV $145
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $133
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $135
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $132
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $131
+endproc G_CountBotPlayersByName 28 8
+export G_SelectRandomBotInfo
+proc G_SelectRandomBotInfo 4140 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4116
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4116
+INDIRI4
+EQI4 $148
+CNSTP4 0
+ARGP4
+ADDRLP4 4116
+INDIRI4
+ARGI4
+ADDRLP4 4120
+ADDRGP4 G_CountBotPlayersByName
+CALLI4
+ASGNI4
+ADDRLP4 4120
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+GEI4 $148
+ADDRFP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $148
+ADDRLP4 4124
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 4124
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4124
+INDIRI4
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $150
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $154
+ARGP4
+ADDRLP4 4128
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4128
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $155
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $157
+ARGP4
+ADDRLP4 4132
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4132
+INDIRP4
+ASGNP4
+LABELV $155
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4132
+ADDRGP4 G_CountBotPlayersByName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4132
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $158
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $158
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $160
+ADDRLP4 4136
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 4136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1024
+NEI4 $162
+ADDRGP4 $152
+JUMPV
+LABELV $162
+LABELV $160
+LABELV $151
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $153
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $150
+LABELV $152
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $164
+ADDRLP4 4128
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 4128
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $147
+JUMPV
+LABELV $164
+CNSTI4 -1
+RETI4
+LABELV $147
+endproc G_SelectRandomBotInfo 4140 8
+export G_AddRandomBot
+proc G_AddRandomBot 16 16
+ADDRGP4 $167
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $168
+ADDRLP4 0
+ADDRGP4 $170
+ASGNP4
+ADDRGP4 $169
+JUMPV
+LABELV $168
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $171
+ADDRLP4 0
+ADDRGP4 $173
+ASGNP4
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 0
+ADDRGP4 $174
+ASGNP4
+LABELV $172
+LABELV $169
+ADDRGP4 $175
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $166
+endproc G_AddRandomBot 16 16
+export G_RemoveRandomBot
+proc G_RemoveRandomBot 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $177
+ADDRLP4 4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $182
+ADDRGP4 $178
+JUMPV
+LABELV $182
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+236+244
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $184
+ADDRGP4 $178
+JUMPV
+LABELV $184
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $188
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $188
+ADDRGP4 $178
+JUMPV
+LABELV $188
+ADDRGP4 $190
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $178
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $180
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $177
+CNSTI4 0
+RETI4
+LABELV $176
+endproc G_RemoveRandomBot 16 8
+export G_CountHumanPlayers
+proc G_CountHumanPlayers 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $195
+JUMPV
+LABELV $192
+ADDRLP4 4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $197
+ADDRGP4 $193
+JUMPV
+LABELV $197
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+236+244
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $199
+ADDRGP4 $193
+JUMPV
+LABELV $199
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $203
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $203
+ADDRGP4 $193
+JUMPV
+LABELV $203
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $193
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $195
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $192
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $191
+endproc G_CountHumanPlayers 20 0
+export G_CountBotPlayers
+proc G_CountBotPlayers 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $209
+JUMPV
+LABELV $206
+ADDRLP4 4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $211
+ADDRGP4 $207
+JUMPV
+LABELV $211
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+236+244
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $213
+ADDRGP4 $207
+JUMPV
+LABELV $213
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $217
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $217
+ADDRGP4 $207
+JUMPV
+LABELV $217
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $207
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $209
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $206
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $205
+endproc G_CountBotPlayers 20 0
+bss
+align 4
+LABELV $220
+skip 4
+export G_CheckMinimumPlayers
+code
+proc G_CheckMinimumPlayers 36 4
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $221
+ADDRGP4 $219
+JUMPV
+LABELV $221
+ADDRGP4 $220
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $224
+ADDRGP4 $219
+JUMPV
+LABELV $224
+ADDRGP4 $220
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 bot_minplayers
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 bot_minplayers+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $229
+ADDRGP4 $219
+JUMPV
+LABELV $229
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $231
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $234
+ADDRLP4 0
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $234
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $238
+CNSTI4 1
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $239
+JUMPV
+LABELV $238
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $240
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $240
+CNSTI4 1
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+LABELV $240
+LABELV $239
+CNSTI4 2
+ARGI4
+ADDRLP4 24
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $242
+CNSTI4 2
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $232
+JUMPV
+LABELV $242
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $232
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $232
+CNSTI4 2
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+ADDRGP4 $232
+JUMPV
+LABELV $231
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $246
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $249
+ADDRLP4 0
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $249
+CNSTI4 -1
+ARGI4
+ADDRLP4 12
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 -1
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $253
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $247
+JUMPV
+LABELV $253
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $247
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $247
+CNSTI4 3
+ARGI4
+ADDRLP4 24
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $247
+CNSTI4 -1
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+ADDRGP4 $247
+JUMPV
+LABELV $246
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+NEI4 $259
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $262
+ADDRLP4 0
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $262
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $266
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $268
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $268
+CNSTI4 0
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+LABELV $268
+LABELV $267
+LABELV $259
+LABELV $247
+LABELV $232
+LABELV $219
+endproc G_CheckMinimumPlayers 36 4
+export G_CheckBotSpawn
+proc G_CheckBotSpawn 1032 12
+ADDRGP4 G_CheckMinimumPlayers
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $271
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $275
+ADDRGP4 $272
+JUMPV
+LABELV $275
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $278
+ADDRGP4 $272
+JUMPV
+LABELV $278
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 16
+NEI4 $283
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $286
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 PlayerIntroSound
+CALLV
+pop
+LABELV $283
+LABELV $272
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $271
+LABELV $270
+endproc G_CheckBotSpawn 1032 12
+proc AddBotToSpawnQueue 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $288
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $292
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $292
+LABELV $289
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $288
+ADDRGP4 $297
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+LABELV $287
+endproc AddBotToSpawnQueue 4 4
+export G_RemoveQueuedBotBegin
+proc G_RemoveQueuedBotBegin 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $299
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $303
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $298
+JUMPV
+LABELV $303
+LABELV $300
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $299
+LABELV $298
+endproc G_RemoveQueuedBotBegin 4 0
+export G_BotConnect
+proc G_BotConnect 1188 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 148
+ARGP4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 1172
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1172
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 148
+ARGP4
+ADDRGP4 $309
+ARGP4
+ADDRLP4 1176
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1176
+INDIRP4
+ARGP4
+ADDRLP4 1180
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0+144
+ADDRLP4 1180
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1184
+ADDRGP4 BotAISetupClient
+CALLI4
+ASGNI4
+ADDRLP4 1184
+INDIRI4
+CNSTI4 0
+NEI4 $310
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $312
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $306
+JUMPV
+LABELV $310
+CNSTI4 1
+RETI4
+LABELV $306
+endproc G_BotConnect 1188 12
+proc G_AddBot 1128 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 1060
+ADDRGP4 trap_BotAllocateClient
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 -1
+NEI4 $314
+ADDRGP4 $316
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $317
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $314
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $320
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $318
+LABELV $320
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $321
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRGP4 PickTeam
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 1
+NEI4 $324
+ADDRFP4 8
+ADDRGP4 $170
+ASGNP4
+ADDRGP4 $322
+JUMPV
+LABELV $324
+ADDRFP4 8
+ADDRGP4 $173
+ASGNP4
+ADDRGP4 $322
+JUMPV
+LABELV $321
+ADDRFP4 8
+ADDRGP4 $174
+ASGNP4
+LABELV $322
+LABELV $318
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $326
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+EQI4 $332
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $329
+LABELV $332
+ADDRLP4 1056
+CNSTI4 1
+ASGNI4
+ADDRGP4 $330
+JUMPV
+LABELV $329
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+EQI4 $336
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $335
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $333
+LABELV $336
+ADDRLP4 1056
+CNSTI4 2
+ASGNI4
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $339
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+EQI4 $341
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $340
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $337
+LABELV $341
+ADDRLP4 1056
+CNSTI4 3
+ASGNI4
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+LABELV $338
+LABELV $334
+LABELV $330
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRLP4 1096
+ADDRGP4 G_SelectRandomBotInfo
+CALLI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+GEI4 $342
+ADDRGP4 $344
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeClient
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $342
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRLP4 1100
+ADDRGP4 G_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1100
+INDIRP4
+ASGNP4
+ADDRGP4 $327
+JUMPV
+LABELV $326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 G_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1072
+INDIRP4
+ASGNP4
+LABELV $327
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $345
+ADDRGP4 $347
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeClient
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $345
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $154
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1072
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $348
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $157
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1076
+INDIRP4
+ASGNP4
+LABELV $348
+ADDRLP4 1076
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 1076
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $350
+ADDRLP4 1076
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $350
+ADDRLP4 1048
+ADDRFP4 16
+INDIRP4
+ASGNP4
+LABELV $350
+ADDRLP4 4
+ARGP4
+ADDRGP4 $157
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $352
+ARGP4
+ADDRGP4 $353
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $354
+ARGP4
+ADDRGP4 $355
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $356
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 1080
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $309
+ARGP4
+ADDRLP4 1080
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $357
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $358
+ADDRFP4 4
+INDIRF4
+CNSTF4 1073741824
+GEF4 $358
+ADDRLP4 4
+ARGP4
+ADDRGP4 $360
+ARGP4
+ADDRGP4 $361
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRFP4 4
+INDIRF4
+CNSTF4 1073741824
+LTF4 $362
+ADDRFP4 4
+INDIRF4
+CNSTF4 1077936128
+GEF4 $362
+ADDRLP4 4
+ARGP4
+ADDRGP4 $360
+ARGP4
+ADDRGP4 $364
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRFP4 4
+INDIRF4
+CNSTF4 1077936128
+LTF4 $365
+ADDRFP4 4
+INDIRF4
+CNSTF4 1082130432
+GEF4 $365
+ADDRLP4 4
+ARGP4
+ADDRGP4 $360
+ARGP4
+ADDRGP4 $367
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $365
+LABELV $363
+LABELV $359
+ADDRLP4 0
+ADDRGP4 $286
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1096
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $368
+ADDRLP4 1040
+ADDRGP4 $370
+ASGNP4
+LABELV $368
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $371
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $372
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1100
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $373
+ADDRLP4 1044
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+LABELV $373
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $375
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $376
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1104
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $377
+ADDRLP4 1028
+ADDRGP4 $379
+ASGNP4
+LABELV $377
+ADDRLP4 4
+ARGP4
+ADDRGP4 $380
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $381
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1108
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $382
+ADDRLP4 1028
+ADDRGP4 $384
+ASGNP4
+LABELV $382
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $385
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1112
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $386
+ADDRLP4 1028
+ADDRGP4 $388
+ASGNP4
+LABELV $386
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $389
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1116
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $390
+ADDRGP4 $392
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeClient
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $390
+ADDRLP4 4
+ARGP4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $393
+ARGP4
+ADDRGP4 $394
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1120
+CNSTI4 1
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+ARGI4
+ADDRLP4 1120
+INDIRI4
+ARGI4
+ADDRLP4 1124
+ADDRGP4 ClientConnect
+CALLP4
+ASGNP4
+ADDRLP4 1124
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $395
+ADDRGP4 $313
+JUMPV
+LABELV $395
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $397
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $397
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 AddBotToSpawnQueue
+CALLV
+pop
+LABELV $313
+endproc G_AddBot 1128 12
+export Svcmd_AddBot_f
+proc Svcmd_AddBot_f 4116 20
+ADDRGP4 $402
+ARGP4
+ADDRLP4 4104
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 4104
+INDIRI4
+CNSTI4 0
+NEI4 $400
+ADDRGP4 $399
+JUMPV
+LABELV $400
+CNSTI4 1
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $403
+ADDRGP4 $405
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $399
+JUMPV
+LABELV $403
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $406
+ADDRLP4 4096
+CNSTF4 1082130432
+ASGNF4
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRLP4 0
+ARGP4
+ADDRLP4 4108
+ADDRGP4 atof
+CALLF4
+ASGNF4
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1084227584
+ARGF4
+ADDRLP4 4108
+INDIRF4
+ARGF4
+ADDRLP4 4112
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 4096
+ADDRLP4 4112
+INDIRF4
+ASGNF4
+LABELV $407
+CNSTI4 3
+ARGI4
+ADDRLP4 3072
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $408
+ADDRLP4 4100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $409
+JUMPV
+LABELV $408
+ADDRLP4 0
+ARGP4
+ADDRLP4 4108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4100
+ADDRLP4 4108
+INDIRI4
+ASGNI4
+LABELV $409
+CNSTI4 5
+ARGI4
+ADDRLP4 2048
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+ADDRLP4 4096
+INDIRF4
+ARGF4
+ADDRLP4 3072
+ARGP4
+ADDRLP4 4100
+INDIRI4
+ARGI4
+ADDRLP4 2048
+ARGP4
+ADDRGP4 G_AddBot
+CALLV
+pop
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $410
+ADDRGP4 $414
+ARGP4
+ADDRLP4 4108
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 4108
+INDIRI4
+CNSTI4 0
+EQI4 $410
+CNSTI4 -1
+ARGI4
+ADDRGP4 $415
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $410
+LABELV $399
+endproc Svcmd_AddBot_f 4116 20
+export Svcmd_BotList_f
+proc Svcmd_BotList_f 4120 20
+ADDRGP4 $417
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $418
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $157
+ARGP4
+ADDRLP4 4100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4100
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $422
+ADDRLP4 4
+ARGP4
+ADDRGP4 $424
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $422
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $154
+ARGP4
+ADDRLP4 4104
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4104
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1028
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $425
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $425
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $286
+ARGP4
+ADDRLP4 4108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 4108
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2052
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $427
+ADDRLP4 2052
+ARGP4
+ADDRGP4 $370
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $427
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $389
+ARGP4
+ADDRLP4 4112
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 3076
+ARGP4
+ADDRLP4 4112
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 3076
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $429
+ADDRLP4 3076
+ARGP4
+ADDRGP4 $431
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $429
+ADDRGP4 $432
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 3076
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4116
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $419
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $421
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $418
+LABELV $416
+endproc Svcmd_BotList_f 4120 20
+proc G_SpawnBots 1060 16
+ADDRLP4 1040
+CNSTP4 0
+ASGNP4
+ADDRGP4 podium1
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 podium2
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 podium3
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 $167
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 1044
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+GEF4 $434
+ADDRGP4 $167
+ARGP4
+ADDRGP4 $436
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $435
+JUMPV
+LABELV $434
+ADDRLP4 12
+INDIRF4
+CNSTF4 1084227584
+LEF4 $437
+ADDRGP4 $167
+ARGP4
+ADDRGP4 $388
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 12
+CNSTF4 1084227584
+ASGNF4
+LABELV $437
+LABELV $435
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 16
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $442
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $443
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $445
+ADDRLP4 1048
+INDIRI4
+CNSTI4 32
+EQI4 $442
+LABELV $445
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $446
+ADDRGP4 $441
+JUMPV
+LABELV $446
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $449
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $451
+ADDRLP4 1052
+INDIRI4
+CNSTI4 32
+NEI4 $448
+LABELV $451
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $452
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1056
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $452
+ADDRGP4 $454
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1500
+ADDI4
+ASGNI4
+LABELV $440
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $443
+LABELV $441
+LABELV $433
+endproc G_SpawnBots 1060 16
+proc G_LoadBotsFromFile 16408 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16392
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16392
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $456
+ADDRGP4 $90
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $455
+JUMPV
+LABELV $456
+ADDRLP4 0
+INDIRI4
+CNSTI4 16384
+LTI4 $458
+ADDRGP4 $93
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 16384
+ARGI4
+ADDRLP4 16396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $455
+JUMPV
+LABELV $458
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 16396
+ADDRGP4 g_numBots
+ASGNP4
+ADDRLP4 16400
+ADDRLP4 16396
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 16400
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 16400
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+ARGP4
+ADDRLP4 16404
+ADDRGP4 G_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 16396
+INDIRP4
+ADDRLP4 16400
+INDIRI4
+ADDRLP4 16404
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $455
+endproc G_LoadBotsFromFile 16408 16
+proc G_LoadBots 1456 16
+ADDRGP4 $402
+ARGP4
+ADDRLP4 1440
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 1440
+INDIRI4
+CNSTI4 0
+NEI4 $461
+ADDRGP4 $460
+JUMPV
+LABELV $461
+ADDRGP4 g_numBots
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 $463
+ARGP4
+ADDRGP4 $96
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 144+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $464
+ADDRLP4 144+16
+ARGP4
+ADDRGP4 G_LoadBotsFromFile
+CALLV
+pop
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRGP4 $468
+ARGP4
+ADDRGP4 G_LoadBotsFromFile
+CALLV
+pop
+LABELV $465
+ADDRGP4 $102
+ARGP4
+ADDRGP4 $469
+ARGP4
+ADDRLP4 416
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1444
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1444
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 416
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $473
+JUMPV
+LABELV $470
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1448
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 136
+ADDRLP4 1448
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_LoadBotsFromFile
+CALLV
+pop
+LABELV $471
+ADDRLP4 1448
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $473
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $470
+ADDRGP4 $474
+ARGP4
+ADDRGP4 g_numBots
+INDIRI4
+ARGI4
+ADDRLP4 1452
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $460
+endproc G_LoadBots 1456 16
+export G_GetBotInfoByNumber
+proc G_GetBotInfoByNumber 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $478
+ADDRFP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $476
+LABELV $478
+ADDRGP4 $479
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $475
+JUMPV
+LABELV $476
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+RETP4
+LABELV $475
+endproc G_GetBotInfoByNumber 8 8
+export G_GetBotInfoByName
+proc G_GetBotInfoByName 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $484
+JUMPV
+LABELV $481
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $157
+ARGP4
+ADDRLP4 8
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $485
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $480
+JUMPV
+LABELV $485
+LABELV $482
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $484
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $481
+CNSTP4 0
+RETP4
+LABELV $480
+endproc G_GetBotInfoByName 16 8
+export G_InitBots
+proc G_InitBots 1148 16
+ADDRGP4 G_LoadBots
+CALLV
+pop
+ADDRGP4 G_LoadArenas
+CALLV
+pop
+ADDRGP4 bot_minplayers
+ARGP4
+ADDRGP4 $488
+ARGP4
+ADDRGP4 $394
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 16
+NEI4 $489
+ADDRLP4 80
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 80
+ARGP4
+ADDRGP4 $492
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 1112
+ADDRGP4 G_GetArenaInfoByMap
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1112
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $493
+ADDRGP4 $487
+JUMPV
+LABELV $493
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1116
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1120
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $496
+ADDRGP4 $495
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRGP4 $495
+ARGP4
+ADDRGP4 $394
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $497
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $498
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1124
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 1128
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $499
+ADDRGP4 $498
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $500
+JUMPV
+LABELV $499
+ADDRGP4 $498
+ARGP4
+ADDRGP4 $394
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $500
+ADDRLP4 1132
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1132
+INDIRI4
+NEI4 $501
+ADDRLP4 12
+INDIRI4
+ADDRLP4 1132
+INDIRI4
+NEI4 $501
+ADDRGP4 $495
+ARGP4
+ADDRGP4 $503
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $498
+ARGP4
+ADDRGP4 $394
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $501
+ADDRLP4 1104
+CNSTI4 2000
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $504
+ARGP4
+ADDRLP4 1136
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1136
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $507
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $505
+ADDRLP4 1104
+ADDRLP4 1104
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+LABELV $505
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $508
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $510
+ARGP4
+ADDRLP4 1144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1104
+INDIRI4
+ARGI4
+ADDRGP4 G_SpawnBots
+CALLV
+pop
+LABELV $508
+LABELV $489
+LABELV $487
+endproc G_InitBots 1148 16
+import podium3
+import podium2
+import podium1
+bss
+export bot_minplayers
+align 4
+LABELV bot_minplayers
+skip 272
+align 4
+LABELV botSpawnQueue
+skip 128
+align 4
+LABELV g_arenaInfos
+skip 4096
+export g_numArenas
+align 4
+LABELV g_numArenas
+skip 4
+align 4
+LABELV g_botInfos
+skip 4096
+align 4
+LABELV g_numBots
+skip 4
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $510
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $507
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $504
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $503
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $498
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $495
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $492
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $488
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $479
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $474
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $469
+byte 1 46
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $468
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $463
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $454
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $436
+byte 1 49
+byte 1 0
+align 1
+LABELV $432
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 54
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 54
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $431
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 46
+byte 1 99
+byte 1 0
+align 1
+LABELV $424
+byte 1 85
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $417
+byte 1 94
+byte 1 49
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $415
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $414
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $405
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 49
+byte 1 45
+byte 1 53
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $402
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $394
+byte 1 48
+byte 1 0
+align 1
+LABELV $393
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $392
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $389
+byte 1 97
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $388
+byte 1 53
+byte 1 0
+align 1
+LABELV $385
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $384
+byte 1 52
+byte 1 0
+align 1
+LABELV $381
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $380
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $379
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $376
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $375
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $372
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $371
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $370
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $367
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $364
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $361
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $360
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $357
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $356
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 0
+align 1
+LABELV $355
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $354
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $353
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $352
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $347
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $344
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $340
+byte 1 115
+byte 1 0
+align 1
+LABELV $339
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $335
+byte 1 98
+byte 1 0
+align 1
+LABELV $331
+byte 1 114
+byte 1 0
+align 1
+LABELV $328
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $317
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 39
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 41
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $316
+byte 1 94
+byte 1 49
+byte 1 85
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $312
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $309
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $307
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $297
+byte 1 94
+byte 1 51
+byte 1 85
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $286
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $190
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $175
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $174
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 0
+align 1
+LABELV $173
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $170
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $167
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $157
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $154
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $130
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 10
+byte 1 0
+align 1
+LABELV $129
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $123
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $115
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $114
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $109
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $103
+byte 1 46
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $102
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $96
+byte 1 0
+align 1
+LABELV $95
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $93
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $90
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $84
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $83
+byte 1 92
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 92
+byte 1 0
+align 1
+LABELV $82
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
+align 1
+LABELV $79
+byte 1 125
+byte 1 0
+align 1
+LABELV $76
+byte 1 85
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $70
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $67
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 123
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $66
+byte 1 123
+byte 1 0
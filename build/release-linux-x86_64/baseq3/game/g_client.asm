@@ -0,0 +1,6425 @@
+export SP_info_player_deathmatch
+code
+proc SP_info_player_deathmatch 8 12
+ADDRGP4 $58
+ARGP4
+ADDRGP4 $59
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $60
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+LABELV $60
+ADDRGP4 $62
+ARGP4
+ADDRGP4 $59
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $63
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $63
+LABELV $57
+endproc SP_info_player_deathmatch 8 12
+export SP_info_player_start
+proc SP_info_player_start 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 $66
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SP_info_player_deathmatch
+CALLV
+pop
+LABELV $65
+endproc SP_info_player_start 0 4
+export SP_info_player_intermission
+proc SP_info_player_intermission 0 0
+LABELV $67
+endproc SP_info_player_intermission 0 0
+export SpotWouldTelefrag
+proc SpotWouldTelefrag 4144 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4108
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRGP4 bg_playerMins
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDRGP4 bg_playerMins+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDRGP4 bg_playerMins+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRGP4 bg_playerMaxs
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDRGP4 bg_playerMaxs+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDRGP4 bg_playerMaxs+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108
+ARGP4
+ADDRLP4 4120
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4140
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $80
+JUMPV
+LABELV $77
+ADDRLP4 4
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $81
+CNSTI4 1
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $81
+LABELV $78
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $80
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $77
+CNSTI4 0
+RETI4
+LABELV $68
+endproc SpotWouldTelefrag 4144 16
+export SelectNearestDeathmatchSpawnPoint
+proc SelectNearestDeathmatchSpawnPoint 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 $85
+JUMPV
+LABELV $84
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GEF4 $89
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $89
+LABELV $85
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRGP4 $66
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $84
+ADDRLP4 24
+INDIRP4
+RETP4
+LABELV $83
+endproc SelectNearestDeathmatchSpawnPoint 44 12
+export SelectRandomDeathmatchSpawnPoint
+proc SelectRandomDeathmatchSpawnPoint 536 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 524
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+EQI4 $95
+ADDRGP4 $93
+JUMPV
+LABELV $95
+ADDRLP4 528
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+ADDRLP4 528
+INDIRI4
+EQI4 $100
+ADDRFP4 0
+INDIRI4
+ADDRLP4 528
+INDIRI4
+NEI4 $99
+LABELV $100
+ADDRLP4 532
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+ADDRLP4 532
+INDIRI4
+EQI4 $97
+ADDRFP4 0
+INDIRI4
+ADDRLP4 532
+INDIRI4
+NEI4 $97
+LABELV $99
+ADDRGP4 $93
+JUMPV
+LABELV $97
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $93
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRGP4 $66
+ARGP4
+ADDRLP4 524
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 524
+INDIRP4
+ASGNP4
+ADDRLP4 524
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $101
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+LTI4 $92
+LABELV $101
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $102
+CNSTP4 0
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRGP4 $66
+ARGP4
+ADDRLP4 528
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 528
+INDIRP4
+RETP4
+ADDRGP4 $91
+JUMPV
+LABELV $102
+ADDRLP4 528
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 520
+ADDRLP4 528
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+RETP4
+LABELV $91
+endproc SelectRandomDeathmatchSpawnPoint 536 12
+export SelectRandomFurthestSpawnPoint
+proc SelectRandomFurthestSpawnPoint 1092 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+CNSTP4 0
+ASGNP4
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $108
+ADDRGP4 $106
+JUMPV
+LABELV $108
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+ADDRLP4 1064
+INDIRI4
+EQI4 $113
+ADDRFP4 12
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+NEI4 $112
+LABELV $113
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+ADDRLP4 1068
+INDIRI4
+EQI4 $110
+ADDRFP4 12
+INDIRI4
+ADDRLP4 1068
+INDIRI4
+NEI4 $110
+LABELV $112
+ADDRGP4 $106
+JUMPV
+LABELV $110
+ADDRLP4 1044
+ADDRLP4 1040
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1044+4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1044+8
+ADDRLP4 1040
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1080
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+CNSTI4 0
+ASGNI4
+ADDRGP4 $119
+JUMPV
+LABELV $116
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+LEF4 $120
+ADDRLP4 1032
+INDIRI4
+CNSTI4 128
+LTI4 $122
+ADDRLP4 1032
+CNSTI4 127
+ASGNI4
+LABELV $122
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 $127
+JUMPV
+LABELV $124
+ADDRLP4 1084
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1088
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+ADDRLP4 516
+ADDP4
+ADDRLP4 1088
+INDIRI4
+ADDRLP4 516-4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $125
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $127
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+GTI4 $124
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 516
+ADDP4
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $118
+JUMPV
+LABELV $120
+LABELV $117
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $119
+ADDRLP4 1028
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+LTI4 $116
+LABELV $118
+ADDRLP4 1028
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+LTI4 $130
+ADDRLP4 1032
+INDIRI4
+CNSTI4 128
+GEI4 $130
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 516
+ADDP4
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $130
+LABELV $106
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRGP4 $66
+ARGP4
+ADDRLP4 1060
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $105
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $132
+CNSTP4 0
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRGP4 $66
+ARGP4
+ADDRLP4 1064
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1064
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $134
+ADDRGP4 $136
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $134
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 1068
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ADDRLP4 1068
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 1040
+INDIRP4
+RETP4
+ADDRGP4 $104
+JUMPV
+LABELV $132
+ADDRLP4 1064
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1068
+CNSTI4 2
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 1064
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1068
+INDIRI4
+DIVI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1068
+INDIRI4
+LSHI4
+ADDRLP4 516
+ADDP4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 1072
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+ADDRLP4 1072
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 516
+ADDP4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 1056
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 516
+ADDP4
+INDIRP4
+RETP4
+LABELV $104
+endproc SelectRandomFurthestSpawnPoint 1092 12
+export SelectSpawnPoint
+proc SelectSpawnPoint 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 SelectRandomFurthestSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $137
+endproc SelectSpawnPoint 4 16
+export SelectInitialSpawnPoint
+proc SelectInitialSpawnPoint 24 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $140
+JUMPV
+LABELV $139
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $145
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $144
+LABELV $145
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $142
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $142
+LABELV $144
+ADDRGP4 $140
+JUMPV
+LABELV $142
+ADDRLP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $146
+ADDRGP4 $141
+JUMPV
+LABELV $146
+LABELV $140
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRGP4 $66
+ARGP4
+ADDRLP4 4
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $139
+LABELV $141
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $150
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $148
+LABELV $150
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+RETP4
+ADDRGP4 $138
+JUMPV
+LABELV $148
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $138
+endproc SelectInitialSpawnPoint 24 16
+export SelectSpectatorSpawnPoint
+proc SelectSpectatorSpawnPoint 0 0
+ADDRGP4 FindIntermissionPoint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRGP4 level+9144
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 level+9156
+INDIRB
+ASGNB 12
+CNSTP4 0
+RETP4
+LABELV $151
+endproc SelectSpectatorSpawnPoint 0 0
+export InitBodyQue
+proc InitBodyQue 12 0
+ADDRGP4 level+9176
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $156
+ADDRLP4 8
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 $160
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9180
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $157
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $156
+LABELV $154
+endproc InitBodyQue 12 0
+export BodySink
+proc BodySink 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 6500
+LEI4 $163
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $162
+JUMPV
+LABELV $163
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $162
+endproc BodySink 4 4
+export CopyToBodyQue
+proc CopyToBodyQue 56 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+EQU4 $168
+ADDRGP4 $167
+JUMPV
+LABELV $168
+ADDRLP4 0
+ADDRGP4 level+9176
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9180
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 level+9176
+ADDRGP4 level+9176
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 8
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 236
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $174
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $176
+ADDRLP4 4
+CNSTI4 868
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $181
+ADDRGP4 $177
+JUMPV
+LABELV $181
+ADDRLP4 4
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $183
+ADDRGP4 $177
+JUMPV
+LABELV $183
+ADDRLP4 4
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $187
+ARGP4
+ADDRLP4 24
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $185
+ADDRGP4 $177
+JUMPV
+LABELV $185
+ADDRLP4 4
+INDIRP4
+CNSTI4 824
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $178
+JUMPV
+LABELV $177
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $179
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $176
+LABELV $178
+LABELV $174
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $189
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $190
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $192
+ADDRLP4 24
+INDIRI4
+CNSTI4 5
+GTI4 $192
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $198
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $198
+address $195
+address $195
+address $196
+address $196
+address $197
+address $197
+code
+LABELV $195
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $196
+ADDRLP4 44
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $197
+LABELV $192
+ADDRLP4 52
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $193
+ADDRLP4 32
+CNSTI4 480
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 492
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+CNSTI4 504
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 44
+CNSTI4 520
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 48
+CNSTI4 532
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+CNSTI4 65537
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 67108864
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 BodySink
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRGP4 body_die
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $200
+ADDRLP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $201
+JUMPV
+LABELV $200
+ADDRLP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $201
+ADDRLP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $167
+endproc CopyToBodyQue 56 8
+export SetClientViewAngle
+proc SetClientViewAngle 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $203
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1199570944
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $204
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $203
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $202
+endproc SetClientViewAngle 16 0
+export ClientRespawn
+proc ClientRespawn 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CopyToBodyQue
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+LABELV $207
+endproc ClientRespawn 0 4
+export TeamCount
+proc TeamCount 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $212
+JUMPV
+LABELV $209
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $214
+ADDRGP4 $210
+JUMPV
+LABELV $214
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $216
+ADDRGP4 $210
+JUMPV
+LABELV $216
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $218
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $218
+LABELV $210
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $212
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $209
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $208
+endproc TeamCount 8 0
+export TeamLeader
+proc TeamLeader 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $224
+JUMPV
+LABELV $221
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $226
+ADDRGP4 $222
+JUMPV
+LABELV $226
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $228
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 680
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $230
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $220
+JUMPV
+LABELV $230
+LABELV $228
+LABELV $222
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $224
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $221
+CNSTI4 -1
+RETI4
+LABELV $220
+endproc TeamLeader 4 0
+export PickTeam
+proc PickTeam 24 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+INDIRI4
+ADDRLP4 0+4
+INDIRI4
+LEI4 $235
+CNSTI4 1
+RETI4
+ADDRGP4 $232
+JUMPV
+LABELV $235
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 0+8
+INDIRI4
+LEI4 $239
+CNSTI4 2
+RETI4
+ADDRGP4 $232
+JUMPV
+LABELV $239
+ADDRGP4 level+44+8
+INDIRI4
+ADDRGP4 level+44+4
+INDIRI4
+LEI4 $243
+CNSTI4 1
+RETI4
+ADDRGP4 $232
+JUMPV
+LABELV $243
+CNSTI4 2
+RETI4
+LABELV $232
+endproc PickTeam 24 8
+proc ClientCleanName 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $253
+JUMPV
+LABELV $250
+LABELV $251
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $253
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $250
+ADDRGP4 $257
+JUMPV
+LABELV $254
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $258
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LEI4 $260
+ADDRGP4 $255
+JUMPV
+LABELV $260
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $262
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $262
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $264
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $264
+ADDRLP4 24
+ADDRLP4 20
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $264
+ADDRLP4 24
+INDIRI4
+CNSTI4 65
+LTI4 $267
+ADDRLP4 24
+INDIRI4
+CNSTI4 90
+LEI4 $266
+LABELV $267
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 97
+LTI4 $268
+ADDRLP4 32
+INDIRI4
+CNSTI4 122
+LEI4 $266
+LABELV $268
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 48
+LTI4 $264
+ADDRLP4 40
+INDIRI4
+CNSTI4 57
+GTI4 $264
+LABELV $266
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 0
+NEI4 $263
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $255
+JUMPV
+LABELV $264
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $263
+LABELV $259
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $255
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $257
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $271
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $254
+LABELV $271
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+EQI4 $274
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $272
+LABELV $274
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $272
+LABELV $249
+endproc ClientCleanName 44 12
+export ClientUserinfoChanged
+proc ClientUserinfoChanged 4308 52
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+CNSTI4 868
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 4252
+ADDRGP4 Info_Validate
+CALLI4
+ASGNI4
+ADDRLP4 4252
+INDIRI4
+CNSTI4 0
+NEI4 $277
+ADDRLP4 4
+ARGP4
+ADDRGP4 $279
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $280
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+LABELV $277
+ADDRLP4 4
+ARGP4
+ADDRGP4 $281
+ARGP4
+ADDRLP4 4256
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 4256
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 4260
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4260
+INDIRI4
+CNSTI4 0
+NEI4 $282
+ADDRLP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $282
+ADDRLP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $283
+ADDRLP4 3212
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 4264
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 4264
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientCleanName
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $285
+ADDRLP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $287
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRGP4 $289
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $287
+LABELV $285
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $290
+ADDRLP4 3212
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 4268
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4268
+INDIRI4
+CNSTI4 0
+EQI4 $292
+ADDRGP4 $294
+ARGP4
+ADDRLP4 3212
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 4272
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4272
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $292
+LABELV $290
+ADDRGP4 PW_GUARD
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $295
+ADDRLP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTI4 200
+ASGNI4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRLP4 4
+ARGP4
+ADDRGP4 $297
+ARGP4
+ADDRLP4 4268
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4268
+INDIRP4
+ARGP4
+ADDRLP4 4272
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4244
+ADDRLP4 4272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+ADDRLP4 4244
+INDIRI4
+ASGNI4
+ADDRLP4 4276
+ADDRLP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4276
+INDIRI4
+CNSTI4 1
+LTI4 $300
+ADDRLP4 4276
+INDIRI4
+CNSTI4 100
+LEI4 $298
+LABELV $300
+ADDRLP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTI4 100
+ASGNI4
+LABELV $298
+LABELV $296
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $301
+ARGP4
+ADDRLP4 4272
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 4272
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4276
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 4276
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $303
+ADDRLP4 1032
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $303
+ADDRLP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $304
+JUMPV
+LABELV $303
+ADDRLP4 4
+ARGP4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 4280
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 4280
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $309
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 4288
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4288
+INDIRI4
+CNSTI4 0
+EQI4 $307
+LABELV $309
+ADDRLP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $308
+JUMPV
+LABELV $307
+ADDRLP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $308
+LABELV $304
+ADDRLP4 4
+ARGP4
+ADDRGP4 $310
+ARGP4
+ADDRLP4 4280
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4280
+INDIRP4
+ARGP4
+ADDRLP4 4284
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4236
+ADDRLP4 4284
+INDIRI4
+ASGNI4
+ADDRLP4 4240
+ADDRLP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $311
+ARGP4
+ADDRLP4 4288
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1164
+ARGP4
+ADDRLP4 4288
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $312
+ARGP4
+ADDRLP4 4292
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2188
+ARGP4
+ADDRLP4 4292
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1032
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $313
+ADDRLP4 4
+ARGP4
+ADDRGP4 $316
+ARGP4
+ADDRLP4 4296
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $315
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 1164
+ARGP4
+ADDRLP4 2188
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4296
+INDIRP4
+ARGP4
+ADDRLP4 4236
+INDIRI4
+ARGI4
+ADDRLP4 4240
+INDIRI4
+ARGI4
+ADDRLP4 4304
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 4304
+INDIRP4
+ASGNP4
+ADDRGP4 $314
+JUMPV
+LABELV $313
+ADDRGP4 $317
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 1164
+ARGP4
+ADDRLP4 2188
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4236
+INDIRI4
+ARGI4
+ADDRLP4 4240
+INDIRI4
+ARGI4
+ADDRLP4 4300
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 4300
+INDIRP4
+ASGNP4
+LABELV $314
+ADDRFP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $318
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $276
+endproc ClientUserinfoChanged 4308 52
+export ClientConnect
+proc ClientConnect 1072 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+CNSTI4 868
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 G_FilterPacket
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $321
+ADDRGP4 $323
+RETP4
+ADDRGP4 $319
+JUMPV
+LABELV $321
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $324
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $324
+ADDRLP4 8
+ARGP4
+ADDRGP4 $327
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRGP4 g_password+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $328
+ADDRGP4 g_password+16
+ARGP4
+ADDRGP4 $332
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $328
+ADDRGP4 g_password+16
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $328
+ADDRGP4 $334
+RETP4
+ADDRGP4 $319
+JUMPV
+LABELV $328
+LABELV $324
+ADDRLP4 1032
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $335
+ADDRGP4 $337
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientDisconnect
+CALLV
+pop
+LABELV $335
+ADDRLP4 1032
+INDIRP4
+CNSTI4 572
+ADDP4
+CNSTI4 888
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 888
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRLP4 1056
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $338
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $338
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $340
+ADDRLP4 1060
+ADDRLP4 1032
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 1032
+INDIRP4
+CNSTI4 576
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $345
+ADDRLP4 1064
+CNSTI4 1
+ASGNI4
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+LABELV $346
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRGP4 G_BotConnect
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRGP4 $347
+RETP4
+ADDRGP4 $319
+JUMPV
+LABELV $342
+LABELV $340
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 1060
+INDIRI4
+NEI4 $351
+ADDRGP4 level+64
+INDIRI4
+ADDRLP4 1060
+INDIRI4
+EQI4 $348
+LABELV $351
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_InitSessionData
+CALLV
+pop
+LABELV $348
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_ReadSessionData
+CALLV
+pop
+ADDRGP4 $352
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $353
+ADDRGP4 $355
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $353
+ADDRLP4 1064
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+LTI4 $356
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+EQI4 $356
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 BroadcastTeamChange
+CALLV
+pop
+LABELV $356
+ADDRGP4 CalculateRanks
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $319
+endproc ClientConnect 1072 12
+export ClientBegin
+proc ClientBegin 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 868
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 888
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $360
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $360
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_InitGentity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 756
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 764
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 508
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $363
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+EQI4 $365
+ADDRGP4 $368
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $365
+LABELV $363
+ADDRGP4 $369
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+LABELV $359
+endproc ClientBegin 24 12
+export ClientSpawn
+proc ClientSpawn 1412 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1332
+CNSTF4 0
+ASGNF4
+ADDRLP4 72+8
+ADDRLP4 1332
+INDIRF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 1332
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 1332
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $373
+ADDRLP4 72
+ARGP4
+ADDRLP4 1116
+ARGP4
+ADDRLP4 1336
+ADDRGP4 SelectSpectatorSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1320
+ADDRLP4 1336
+INDIRP4
+ASGNP4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $375
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 1116
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $379
+ADDRLP4 1336
+CNSTI4 1
+ASGNI4
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRLP4 1336
+CNSTI4 0
+ASGNI4
+LABELV $380
+ADDRLP4 1336
+INDIRI4
+ARGI4
+ADDRLP4 1344
+ADDRGP4 SelectCTFSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1320
+ADDRLP4 1344
+INDIRP4
+ASGNP4
+ADDRGP4 $376
+JUMPV
+LABELV $375
+ADDRLP4 1340
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ADDRLP4 1340
+INDIRI4
+NEI4 $381
+ADDRLP4 4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 1340
+INDIRI4
+EQI4 $381
+ADDRLP4 4
+INDIRP4
+CNSTI4 540
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 1116
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $384
+ADDRLP4 1344
+CNSTI4 1
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRLP4 1344
+CNSTI4 0
+ASGNI4
+LABELV $385
+ADDRLP4 1344
+INDIRI4
+ARGI4
+ADDRLP4 1348
+ADDRGP4 SelectInitialSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1320
+ADDRLP4 1348
+INDIRP4
+ASGNP4
+ADDRGP4 $382
+JUMPV
+LABELV $381
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 1116
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $387
+ADDRLP4 1344
+CNSTI4 1
+ASGNI4
+ADDRGP4 $388
+JUMPV
+LABELV $387
+ADDRLP4 1344
+CNSTI4 0
+ASGNI4
+LABELV $388
+ADDRLP4 1344
+INDIRI4
+ARGI4
+ADDRLP4 1348
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1320
+ADDRLP4 1348
+INDIRP4
+ASGNP4
+LABELV $382
+LABELV $376
+LABELV $374
+ADDRLP4 4
+INDIRP4
+CNSTI4 596
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1336
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 1336
+INDIRP4
+ADDRLP4 1336
+INDIRP4
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 540676
+BANDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRLP4 1128
+ADDRLP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRB
+ASGNB 148
+ADDRLP4 1276
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRB
+ASGNB 28
+ADDRLP4 1304
+ADDRLP4 4
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1308
+ADDRLP4 4
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1312
+ADDRLP4 4
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $389
+ADDRLP4 1344
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1344
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 1344
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $390
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $389
+ADDRLP4 1316
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 888
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+ADDRLP4 1128
+INDIRB
+ASGNB 148
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRLP4 1276
+INDIRB
+ASGNB 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 452
+ADDP4
+ADDRLP4 1304
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 756
+ADDP4
+ADDRLP4 1308
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 752
+ADDP4
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 760
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $393
+ADDRLP4 1348
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ADDRLP4 1348
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $394
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $393
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 1316
+INDIRI4
+ASGNI4
+ADDRLP4 1348
+ADDRGP4 PERS_SPAWN_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 1348
+INDIRP4
+ADDRLP4 1348
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 788
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 12000
+ADDI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 92
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 92
+ARGP4
+ADDRGP4 $297
+ARGP4
+ADDRLP4 1356
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1356
+INDIRP4
+ARGP4
+ADDRLP4 1360
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 588
+ADDP4
+ADDRLP4 1360
+INDIRI4
+ASGNI4
+ADDRLP4 1364
+ADDRLP4 4
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1364
+INDIRI4
+CNSTI4 1
+LTI4 $400
+ADDRLP4 1364
+INDIRI4
+CNSTI4 100
+LEI4 $398
+LABELV $400
+ADDRLP4 4
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTI4 100
+ASGNI4
+LABELV $398
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+CNSTI4 888
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 $401
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 33554432
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+CNSTI4 33619969
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRGP4 player_die
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 848
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 844
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDRGP4 bg_playerMins
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDRGP4 bg_playerMaxs
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+NEI4 $402
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 150
+ASGNI4
+LABELV $403
+ADDRLP4 1372
+CNSTI4 2
+ASGNI4
+ADDRLP4 1376
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+ADDRLP4 1372
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 1376
+INDIRP4
+ADDRLP4 1376
+INDIRP4
+INDIRI4
+ADDRLP4 1372
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 380
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 1380
+CNSTI4 2
+ASGNI4
+ADDRLP4 1384
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ASGNP4
+ADDRLP4 1388
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+ADDRLP4 1380
+INDIRI4
+LSHI4
+ADDRLP4 1384
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 1380
+INDIRI4
+LSHI4
+ADDRLP4 1384
+INDIRP4
+ADDP4
+ADDRLP4 1388
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRLP4 1388
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 72
+INDIRB
+ASGNB 12
+ADDRLP4 1392
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 1392
+INDIRP4
+ADDRLP4 1392
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 888
+DIVI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 trap_GetUsercmd
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ARGP4
+ADDRGP4 SetClientViewAngle
+CALLV
+pop
+ADDRLP4 1396
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 1396
+INDIRP4
+ADDRLP4 1396
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 100
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 776
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_inactivity+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 704
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 22
+ASGNI4
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+NEI4 $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $409
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_KillBox
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1320
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_UseTargets
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $416
+JUMPV
+LABELV $413
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $417
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $415
+JUMPV
+LABELV $417
+LABELV $414
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $416
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $413
+LABELV $415
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 39
+ARGI4
+ADDRLP4 1404
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 1324
+ADDRLP4 1404
+INDIRP4
+ASGNP4
+ADDRLP4 1408
+CNSTI4 176
+ASGNI4
+ADDRLP4 1324
+INDIRP4
+ADDRLP4 1408
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 1408
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRGP4 $409
+JUMPV
+LABELV $408
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MoveClientToIntermission
+CALLV
+pop
+LABELV $409
+ADDRLP4 4
+INDIRP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 100
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 ClientThink
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $421
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientEndFrame
+CALLV
+pop
+LABELV $421
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $370
+endproc ClientSpawn 1412 20
+export ClientDisconnect
+proc ClientDisconnect 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_RemoveQueuedBotBegin
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 868
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $426
+ADDRLP4 12
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $424
+LABELV $426
+ADDRGP4 $423
+JUMPV
+LABELV $424
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $430
+JUMPV
+LABELV $427
+ADDRLP4 16
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $432
+ADDRLP4 16
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $432
+ADDRLP4 16
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $432
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 StopFollowing
+CALLV
+pop
+LABELV $432
+LABELV $428
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $430
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $427
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $434
+ADDRLP4 16
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $434
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRLP4 20
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 176
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 TossClientItems
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 TossClientPersistantPowerups
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+NEI4 $436
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 TossClientCubes
+CALLV
+pop
+LABELV $436
+LABELV $434
+ADDRGP4 $439
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $440
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9128
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $440
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $440
+ADDRGP4 level+84+4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $440
+ADDRLP4 24
+CNSTI4 888
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 672
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+84
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $440
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $449
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $449
+ADDRGP4 level+9128
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $449
+CNSTI4 2
+ARGI4
+ADDRGP4 $453
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9132
+CNSTP4 0
+ASGNP4
+ADDRGP4 level+9128
+CNSTI4 0
+ASGNI4
+LABELV $449
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 576
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 $457
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 529
+ADDI4
+ARGI4
+ADDRGP4 $458
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $459
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIShutdownClient
+CALLI4
+pop
+LABELV $459
+LABELV $423
+endproc ClientDisconnect 28 8
+import PM_StepSlideMove
+import PM_SlideMove
+import PM_AddEvent
+import PM_AddTouchEnt
+import PM_ClipVelocity
+import bg_playerMaxs
+import bg_playerMins
+import c_pmove
+import pm_flightfriction
+import pm_waterfriction
+import pm_friction
+import pm_flyaccelerate
+import pm_wateraccelerate
+import pm_airaccelerate
+import pm_accelerate
+import pm_swimScale
+import pm_duckScale
+import pm_stopspeed
+import pml
+import pm
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import CalculateRanks
+import AddScore
+import player_die
+import BeginIntermission
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $458
+byte 1 0
+align 1
+LABELV $457
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $453
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $439
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $401
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $369
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $368
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $355
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $352
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $347
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $337
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $334
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $332
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $327
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $326
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $323
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $320
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $318
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $317
+byte 1 110
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 49
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 50
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 99
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 119
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 116
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 92
+byte 1 116
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 92
+byte 1 115
+byte 1 117
+byte 1 92
+byte 1 49
+byte 1 0
+align 1
+LABELV $316
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $315
+byte 1 110
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 49
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 50
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 99
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 119
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 116
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 92
+byte 1 116
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $312
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $311
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $310
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $306
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $302
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $301
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $297
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $294
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $289
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $284
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $281
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $280
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $279
+byte 1 92
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 92
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $275
+byte 1 85
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $187
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $160
+byte 1 98
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $136
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $66
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $62
+byte 1 110
+byte 1 111
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $59
+byte 1 48
+byte 1 0
+align 1
+LABELV $58
+byte 1 110
+byte 1 111
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
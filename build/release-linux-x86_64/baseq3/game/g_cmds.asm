@@ -0,0 +1,12660 @@
+export DeathmatchScoreboardMessage
+code
+proc DeathmatchScoreboardMessage 2112 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $57
+ADDRGP4 $56
+JUMPV
+LABELV $57
+ADDRLP4 1040
+CNSTI1 0
+ASGNI1
+ADDRLP4 2056
+CNSTI4 0
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 2056
+INDIRI4
+ASGNI4
+ADDRLP4 2052
+ADDRLP4 2056
+INDIRI4
+ASGNI4
+ADDRLP4 2048
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 2056
+INDIRI4
+ASGNI4
+ADDRGP4 $63
+JUMPV
+LABELV $60
+ADDRLP4 0
+CNSTI4 888
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $65
+ADDRLP4 2060
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $66
+JUMPV
+LABELV $65
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+CNSTI4 999
+GEI4 $68
+ADDRLP4 2064
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $69
+JUMPV
+LABELV $68
+ADDRLP4 2064
+CNSTI4 999
+ASGNI4
+LABELV $69
+ADDRLP4 2060
+ADDRLP4 2064
+INDIRI4
+ASGNI4
+LABELV $66
+ADDRLP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $70
+ADDRLP4 2040
+CNSTI4 100
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $71
+JUMPV
+LABELV $70
+ADDRLP4 2040
+CNSTI4 0
+ASGNI4
+LABELV $71
+ADDRLP4 2076
+CNSTI4 2
+ASGNI4
+ADDRLP4 2080
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ASGNP4
+ADDRLP4 2084
+CNSTI4 0
+ASGNI4
+ADDRGP4 PERS_RANK
+INDIRI4
+ADDRLP4 2076
+INDIRI4
+LSHI4
+ADDRLP4 2080
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 2084
+INDIRI4
+NEI4 $73
+ADDRGP4 PERS_KILLED
+INDIRI4
+ADDRLP4 2076
+INDIRI4
+LSHI4
+ADDRLP4 2080
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 2084
+INDIRI4
+NEI4 $73
+ADDRLP4 2064
+CNSTI4 1
+ASGNI4
+ADDRGP4 $74
+JUMPV
+LABELV $73
+ADDRLP4 2064
+CNSTI4 0
+ASGNI4
+LABELV $74
+ADDRLP4 2044
+ADDRLP4 2064
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $75
+ARGP4
+ADDRLP4 2088
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 2088
+INDIRI4
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 PERS_SCORE
+INDIRI4
+ADDRLP4 2088
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 g_debugPingValue+12
+INDIRI4
+CNSTI4 0
+LEI4 $84
+ADDRLP4 2068
+ADDRGP4 g_debugPingValue+12
+INDIRI4
+ASGNI4
+ADDRGP4 $85
+JUMPV
+LABELV $84
+ADDRLP4 2068
+ADDRLP4 2060
+INDIRI4
+ASGNI4
+LABELV $85
+ADDRLP4 2068
+INDIRI4
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 60000
+DIVI4
+ARGI4
+ADDRLP4 2052
+INDIRI4
+ARGI4
+ADDRLP4 2096
+CNSTI4 2
+ASGNI4
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+ADDRLP4 2096
+INDIRI4
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+196
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2040
+INDIRI4
+ARGI4
+ADDRLP4 2100
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ASGNP4
+ADDRGP4 PERS_IMPRESSIVE_COUNT
+INDIRI4
+ADDRLP4 2096
+INDIRI4
+LSHI4
+ADDRLP4 2100
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 PERS_EXCELLENT_COUNT
+INDIRI4
+ADDRLP4 2096
+INDIRI4
+LSHI4
+ADDRLP4 2100
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 PERS_GAUNTLET_FRAG_COUNT
+INDIRI4
+ADDRLP4 2096
+INDIRI4
+LSHI4
+ADDRLP4 2100
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 PERS_DEFEND_COUNT
+INDIRI4
+ADDRLP4 2096
+INDIRI4
+LSHI4
+ADDRLP4 2100
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 PERS_ASSIST_COUNT
+INDIRI4
+ADDRLP4 2096
+INDIRI4
+LSHI4
+ADDRLP4 2100
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2044
+INDIRI4
+ARGI4
+ADDRGP4 PERS_CAPTURES
+INDIRI4
+ADDRLP4 2096
+INDIRI4
+LSHI4
+ADDRLP4 2100
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $86
+ADDRLP4 2072
+CNSTI4 1
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRLP4 2072
+CNSTI4 0
+ASGNI4
+LABELV $87
+ADDRLP4 2072
+INDIRI4
+ARGI4
+ADDRLP4 2104
+CNSTI4 0
+ASGNI4
+ADDRLP4 2104
+INDIRI4
+ARGI4
+ADDRLP4 2104
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 2108
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+ADDRLP4 2108
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+ADDI4
+CVIU4 4
+CNSTU4 1000
+LTU4 $88
+ADDRGP4 $62
+JUMPV
+LABELV $88
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1040
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $61
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $63
+ADDRLP4 4
+INDIRI4
+ADDRLP4 2048
+INDIRI4
+LTI4 $60
+LABELV $62
+ADDRGP4 $90
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 level+44+4
+INDIRI4
+ARGI4
+ADDRGP4 level+44+8
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 2060
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 2060
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $56
+endproc DeathmatchScoreboardMessage 2112 84
+export Cmd_Score_f
+proc Cmd_Score_f 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DeathmatchScoreboardMessage
+CALLV
+pop
+LABELV $95
+endproc Cmd_Score_f 0 4
+export DuelScores
+proc DuelScores 1032 12
+ADDRLP4 0
+CNSTI1 0
+ASGNI1
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+LABELV $97
+ADDRGP4 $101
+ARGP4
+ADDRGP4 g_debugPingValue+12
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $98
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 2
+LTI4 $97
+ADDRGP4 $103
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1028
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $96
+endproc DuelScores 1032 12
+export Cmd_DuelScores_f
+proc Cmd_DuelScores_f 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DuelScores
+CALLV
+pop
+LABELV $104
+endproc Cmd_DuelScores_f 0 4
+export CheatsOk
+proc CheatsOk 0 8
+ADDRGP4 g_cheats+12
+INDIRI4
+CNSTI4 0
+NEI4 $106
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $110
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $112
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $110
+CNSTI4 1
+RETI4
+LABELV $105
+endproc CheatsOk 0 8
+bss
+align 1
+LABELV $114
+skip 1024
+export ConcatArgs
+code
+proc ConcatArgs 1048 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $118
+JUMPV
+LABELV $115
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 1044
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CNSTI4 1023
+LTI4 $119
+ADDRGP4 $117
+JUMPV
+LABELV $119
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $114
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 1
+SUBI4
+EQI4 $121
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $114
+ADDP4
+CNSTI1 32
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $121
+LABELV $116
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $118
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+LTI4 $115
+LABELV $117
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $114
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $114
+RETP4
+LABELV $113
+endproc ConcatArgs 1048 12
+export StringIsInteger
+proc StringIsInteger 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $127
+JUMPV
+LABELV $124
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 48
+LTI4 $130
+ADDRLP4 20
+INDIRI4
+CNSTI4 57
+LEI4 $128
+LABELV $130
+CNSTI4 0
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $128
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $125
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $127
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $124
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $123
+endproc StringIsInteger 24 4
+export ClientNumberFromString
+proc ClientNumberFromString 1044 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $132
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 StringIsInteger
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $134
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+LTI4 $136
+ADDRLP4 1028
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+GEI4 $136
+ADDRLP4 1024
+CNSTI4 888
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $139
+ADDRLP4 1028
+INDIRI4
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $139
+LABELV $136
+LABELV $134
+LABELV $132
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $141
+ADDRLP4 1028
+CNSTI4 0
+ASGNI4
+ADDRLP4 1024
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRGP4 $146
+JUMPV
+LABELV $143
+ADDRLP4 1024
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $148
+ADDRGP4 $144
+JUMPV
+LABELV $148
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $150
+ADDRLP4 1028
+INDIRI4
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $150
+LABELV $144
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRP4
+CNSTI4 888
+ADDP4
+ASGNP4
+LABELV $146
+ADDRLP4 1028
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $143
+LABELV $141
+ADDRGP4 $152
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 -1
+RETI4
+LABELV $131
+endproc ClientNumberFromString 1044 12
+export Cmd_Give_f
+proc Cmd_Give_f 132 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 CheatsOk
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $154
+ADDRGP4 $153
+JUMPV
+LABELV $154
+CNSTI4 1
+ARGI4
+ADDRLP4 80
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $156
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $157
+JUMPV
+LABELV $156
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $157
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $162
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 88
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $159
+LABELV $162
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $163
+ADDRGP4 $153
+JUMPV
+LABELV $163
+LABELV $159
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $168
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $167
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $165
+LABELV $168
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+ADDRLP4 96
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+LSHI4
+ADDRLP4 96
+INDIRI4
+SUBI4
+CNSTI4 1024
+SUBI4
+ADDRLP4 96
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $169
+ADDRGP4 $153
+JUMPV
+LABELV $169
+LABELV $165
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $174
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 96
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $171
+LABELV $174
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $175
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+CNSTI4 999
+ASGNI4
+LABELV $176
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $175
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $179
+ADDRGP4 $153
+JUMPV
+LABELV $179
+LABELV $171
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $184
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $183
+ARGP4
+ADDRLP4 100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $181
+LABELV $184
+ADDRGP4 STAT_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+CNSTI4 200
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $185
+ADDRGP4 $153
+JUMPV
+LABELV $185
+LABELV $181
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $189
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $187
+ADDRLP4 108
+ADDRGP4 PERS_EXCELLENT_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $187
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $192
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $190
+ADDRLP4 112
+ADDRGP4 PERS_IMPRESSIVE_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $190
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $195
+ARGP4
+ADDRLP4 112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $193
+ADDRLP4 116
+ADDRGP4 PERS_GAUNTLET_FRAG_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $193
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $198
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $196
+ADDRLP4 120
+ADDRGP4 PERS_DEFEND_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $196
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $201
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $199
+ADDRLP4 124
+ADDRGP4 PERS_ASSIST_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $199
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $202
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $204
+ADDRGP4 $153
+JUMPV
+LABELV $204
+ADDRLP4 128
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 G_SpawnItem
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 FinishSpawningItem
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 Touch_Item
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $206
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+LABELV $206
+LABELV $202
+LABELV $153
+endproc Cmd_Give_f 132 12
+export Cmd_God_f
+proc Cmd_God_f 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CheatsOk
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $209
+ADDRGP4 $208
+JUMPV
+LABELV $209
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 16
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $211
+ADDRLP4 0
+ADDRGP4 $213
+ASGNP4
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRLP4 0
+ADDRGP4 $214
+ASGNP4
+LABELV $212
+ADDRGP4 $215
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $208
+endproc Cmd_God_f 16 8
+export Cmd_Notarget_f
+proc Cmd_Notarget_f 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CheatsOk
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $217
+ADDRGP4 $216
+JUMPV
+LABELV $217
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $219
+ADDRLP4 0
+ADDRGP4 $221
+ASGNP4
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRLP4 0
+ADDRGP4 $222
+ASGNP4
+LABELV $220
+ADDRGP4 $215
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $216
+endproc Cmd_Notarget_f 16 8
+export Cmd_Noclip_f
+proc Cmd_Noclip_f 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CheatsOk
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $224
+ADDRGP4 $223
+JUMPV
+LABELV $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $226
+ADDRLP4 0
+ADDRGP4 $228
+ASGNP4
+ADDRGP4 $227
+JUMPV
+LABELV $226
+ADDRLP4 0
+ADDRGP4 $229
+ASGNP4
+LABELV $227
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 688
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $231
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $232
+JUMPV
+LABELV $231
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $232
+ADDRLP4 12
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $223
+endproc Cmd_Noclip_f 20 8
+export Cmd_LevelShot_f
+proc Cmd_LevelShot_f 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $234
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $236
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $233
+JUMPV
+LABELV $234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 CheatsOk
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $237
+ADDRGP4 $233
+JUMPV
+LABELV $237
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 16
+NEI4 $239
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $242
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $233
+JUMPV
+LABELV $239
+ADDRGP4 BeginIntermission
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $243
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $233
+endproc Cmd_LevelShot_f 4 8
+export Cmd_TeamTask_f
+proc Cmd_TeamTask_f 2068 12
+ADDRLP4 1024
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 888
+DIVI4
+ASGNI4
+ADDRLP4 2056
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+CNSTI4 2
+EQI4 $245
+ADDRGP4 $244
+JUMPV
+LABELV $245
+CNSTI4 1
+ARGI4
+ADDRLP4 1028
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2060
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2052
+ADDRLP4 2060
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRGP4 $248
+ARGP4
+ADDRLP4 2052
+INDIRI4
+ARGI4
+ADDRLP4 2064
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 $247
+ARGP4
+ADDRLP4 2064
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $244
+endproc Cmd_TeamTask_f 2068 12
+export Cmd_Kill_f
+proc Cmd_Kill_f 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $250
+ADDRGP4 $249
+JUMPV
+LABELV $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $252
+ADDRGP4 $249
+JUMPV
+LABELV $252
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 -999
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 100000
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRGP4 player_die
+CALLV
+pop
+LABELV $249
+endproc Cmd_Kill_f 16 20
+export BroadcastTeamChange
+proc BroadcastTeamChange 8 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $255
+ADDRGP4 $257
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $258
+ADDRGP4 $260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $261
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $261
+ADDRGP4 $263
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $264
+ADDRGP4 $266
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $264
+LABELV $262
+LABELV $259
+LABELV $256
+LABELV $254
+endproc BroadcastTeamChange 8 8
+export SetTeam
+proc SetTeam 104 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 888
+DIVI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $270
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $272
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $271
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $268
+LABELV $272
+ADDRLP4 40
+CNSTI4 3
+ASGNI4
+ADDRLP4 4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $269
+JUMPV
+LABELV $268
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $273
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $274
+JUMPV
+LABELV $273
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $276
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 20
+CNSTI4 -2
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $281
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $283
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $282
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $279
+LABELV $283
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $280
+JUMPV
+LABELV $279
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $284
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $291
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $290
+ARGP4
+ADDRLP4 60
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $287
+LABELV $291
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $294
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $296
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $295
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $292
+LABELV $296
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $293
+JUMPV
+LABELV $292
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 PickTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $293
+LABELV $288
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_teamForceBalance+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $285
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+NEI4 $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 72
+INDIRI4
+NEI4 $285
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 92
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 76+8
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 76+4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+NEI4 $302
+ADDRLP4 76+4
+INDIRI4
+ADDRLP4 76+8
+INDIRI4
+SUBI4
+ADDRLP4 100
+INDIRI4
+LEI4 $302
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 $306
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $302
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $285
+ADDRLP4 76+8
+INDIRI4
+ADDRLP4 76+4
+INDIRI4
+SUBI4
+CNSTI4 1
+LEI4 $285
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 $311
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $284
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $285
+LABELV $280
+LABELV $277
+LABELV $274
+LABELV $269
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $312
+ADDRGP4 level+76
+INDIRI4
+CNSTI4 2
+LTI4 $312
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRGP4 g_maxGameClients+12
+INDIRI4
+CNSTI4 0
+LEI4 $316
+ADDRGP4 level+76
+INDIRI4
+ADDRGP4 g_maxGameClients+12
+INDIRI4
+LTI4 $316
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+LABELV $316
+LABELV $313
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $321
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $321
+ADDRGP4 $267
+JUMPV
+LABELV $321
+ADDRLP4 60
+CNSTI4 2
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $323
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $323
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CopyToBodyQue
+CALLV
+pop
+LABELV $323
+ADDRLP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+EQI4 $325
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 100000
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRGP4 player_die
+CALLV
+pop
+LABELV $325
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $327
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $327
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AddTournamentQueue
+CALLV
+pop
+LABELV $327
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $331
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $329
+LABELV $331
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 TeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 -1
+EQI4 $338
+ADDRLP4 84
+CNSTI4 868
+ASGNI4
+ADDRLP4 88
+CNSTI4 8
+ASGNI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 g_entities+236+244
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+BANDI4
+ADDRLP4 92
+INDIRI4
+NEI4 $332
+ADDRLP4 84
+INDIRI4
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRGP4 g_entities+236+244
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+BANDI4
+ADDRLP4 92
+INDIRI4
+EQI4 $332
+LABELV $338
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 SetLeader
+CALLV
+pop
+LABELV $332
+LABELV $329
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $341
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $339
+LABELV $341
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CheckTeamLeader
+CALLV
+pop
+LABELV $339
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BroadcastTeamChange
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $342
+ADDRGP4 $267
+JUMPV
+LABELV $342
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+LABELV $267
+endproc SetTeam 104 20
+export StopFollowing
+proc StopFollowing 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 664
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 SetClientViewAngle
+CALLV
+pop
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $345
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $345
+LABELV $344
+endproc StopFollowing 16 8
+export Cmd_Team_f
+proc Cmd_Team_f 1036 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+EQI4 $348
+ADDRLP4 1024
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1024
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+LTI4 $347
+ADDRLP4 1032
+INDIRI4
+CNSTI4 3
+GTI4 $347
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $360
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $360
+address $356
+address $354
+address $352
+address $358
+code
+LABELV $352
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $353
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $347
+JUMPV
+LABELV $354
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $355
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $347
+JUMPV
+LABELV $356
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $357
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $347
+JUMPV
+LABELV $358
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $359
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $347
+JUMPV
+LABELV $348
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $361
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $364
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $347
+JUMPV
+LABELV $361
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $365
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $365
+ADDRLP4 1032
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ADDRLP4 1032
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $365
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 804
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+LABELV $347
+endproc Cmd_Team_f 1036 12
+export Cmd_Follow_f
+proc Cmd_Follow_f 1044 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+EQI4 $370
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $369
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 StopFollowing
+CALLV
+pop
+ADDRGP4 $369
+JUMPV
+LABELV $370
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1032
+CNSTI4 1
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1036
+ADDRGP4 ClientNumberFromString
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $374
+ADDRGP4 $369
+JUMPV
+LABELV $374
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+NEU4 $376
+ADDRGP4 $369
+JUMPV
+LABELV $376
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $378
+ADDRGP4 $369
+JUMPV
+LABELV $378
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $380
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $380
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ADDRLP4 1040
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $380
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $383
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $281
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 664
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $369
+endproc Cmd_Follow_f 1044 16
+export Cmd_FollowCycle_f
+proc Cmd_FollowCycle_f 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $386
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $386
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $386
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $389
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $281
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $389
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $391
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $391
+ADDRGP4 $393
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $394
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $396
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+CNSTI4 -2
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $396
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+CNSTI4 -2
+NEI4 $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $394
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $400
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $403
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $403
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $406
+ADDRLP4 0
+ADDRGP4 level+24
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $406
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $409
+ADDRGP4 $401
+JUMPV
+LABELV $409
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $411
+ADDRGP4 $401
+JUMPV
+LABELV $411
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 664
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $401
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $400
+LABELV $385
+endproc Cmd_FollowCycle_f 12 8
+proc G_SayTo 24 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $414
+ADDRGP4 $413
+JUMPV
+LABELV $414
+ADDRFP4 4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $416
+ADDRGP4 $413
+JUMPV
+LABELV $416
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $418
+ADDRGP4 $413
+JUMPV
+LABELV $418
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $420
+ADDRGP4 $413
+JUMPV
+LABELV $420
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $422
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $422
+ADDRGP4 $413
+JUMPV
+LABELV $422
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $424
+ADDRLP4 4
+CNSTI4 572
+ASGNI4
+ADDRLP4 8
+CNSTI4 656
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $424
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $424
+ADDRGP4 $413
+JUMPV
+LABELV $424
+ADDRGP4 $427
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $431
+ADDRLP4 16
+ADDRGP4 $428
+ASGNP4
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRLP4 16
+ADDRGP4 $429
+ASGNP4
+LABELV $432
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTI4 94
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $413
+endproc G_SayTo 24 28
+export G_Say
+proc G_Say 328 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+GEI4 $434
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $434
+ADDRFP4 8
+CNSTI4 0
+ASGNI4
+LABELV $434
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $439
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $442
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+EQI4 $448
+ADDRGP4 $437
+JUMPV
+LABELV $437
+LABELV $439
+ADDRGP4 $440
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 158
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $441
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+CNSTI4 94
+ARGI4
+CNSTI4 55
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 224
+CNSTI4 50
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $442
+ADDRGP4 $443
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 228
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 296
+ADDRGP4 Team_GetLocationMsg
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $444
+ADDRLP4 158
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $446
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+CNSTI4 94
+ARGI4
+CNSTI4 55
+ARGI4
+ADDRLP4 228
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRLP4 158
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $447
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+CNSTI4 94
+ARGI4
+CNSTI4 55
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $445
+ADDRLP4 224
+CNSTI4 53
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $448
+ADDRLP4 300
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 304
+CNSTU4 0
+ASGNU4
+ADDRLP4 300
+INDIRP4
+CVPU4 4
+ADDRLP4 304
+INDIRU4
+EQU4 $449
+ADDRLP4 300
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $449
+ADDRLP4 308
+CNSTI4 572
+ASGNI4
+ADDRLP4 312
+ADDRLP4 300
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+CVPU4 4
+ADDRLP4 304
+INDIRU4
+EQU4 $449
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $449
+ADDRLP4 316
+CNSTI4 656
+ASGNI4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $449
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 228
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 324
+ADDRGP4 Team_GetLocationMsg
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $449
+ADDRLP4 158
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $452
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+CNSTI4 94
+ARGI4
+CNSTI4 55
+ARGI4
+ADDRLP4 228
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRLP4 158
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $453
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+CNSTI4 94
+ARGI4
+CNSTI4 55
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $450
+ADDRLP4 224
+CNSTI4 54
+ASGNI4
+LABELV $438
+ADDRLP4 8
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $454
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRLP4 158
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_SayTo
+CALLV
+pop
+ADDRGP4 $433
+JUMPV
+LABELV $454
+ADDRGP4 g_dedicated+12
+INDIRI4
+CNSTI4 0
+EQI4 $456
+ADDRGP4 $459
+ARGP4
+ADDRLP4 158
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $456
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $463
+JUMPV
+LABELV $460
+ADDRLP4 4
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRLP4 158
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_SayTo
+CALLV
+pop
+LABELV $461
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $463
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $460
+LABELV $433
+endproc G_Say 328 28
+proc SanitizeChatText 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $469
+JUMPV
+LABELV $466
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+EQI4 $472
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $470
+LABELV $472
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 32
+ASGNI1
+LABELV $470
+LABELV $467
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $469
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $466
+LABELV $465
+endproc SanitizeChatText 8 0
+proc Cmd_Say_f 12 16
+ADDRLP4 4
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+GEI4 $474
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $474
+ADDRGP4 $473
+JUMPV
+LABELV $474
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $476
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $477
+JUMPV
+LABELV $476
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $477
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SanitizeChatText
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+LABELV $473
+endproc Cmd_Say_f 12 16
+proc Cmd_Tell_f 1072 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 3
+GEI4 $479
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $481
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $478
+JUMPV
+LABELV $479
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ADDRGP4 ClientNumberFromString
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $482
+ADDRGP4 $478
+JUMPV
+LABELV $482
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $486
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $484
+LABELV $486
+ADDRGP4 $478
+JUMPV
+LABELV $484
+CNSTI4 2
+ARGI4
+ADDRLP4 1052
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 SanitizeChatText
+CALLV
+pop
+ADDRGP4 $487
+ARGP4
+ADDRLP4 1056
+CNSTI4 572
+ASGNI4
+ADDRLP4 1060
+CNSTI4 552
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 1056
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 1060
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1056
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 1060
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+EQU4 $488
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $488
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+LABELV $488
+LABELV $478
+endproc Cmd_Tell_f 1072 16
+data
+align 4
+LABELV gc_orders
+address $490
+address $491
+address $492
+address $493
+address $494
+address $495
+address $496
+lit
+align 4
+LABELV numgc_orders
+byte 4 7
+export Cmd_GameCommand_f
+code
+proc Cmd_GameCommand_f 1084 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 3
+EQI4 $498
+ADDRGP4 $500
+ARGP4
+ADDRGP4 numgc_orders
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 1040
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $498
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 1040
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $503
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numgc_orders
+INDIRI4
+LTI4 $501
+LABELV $503
+ADDRGP4 $504
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $501
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1048
+CNSTI4 1
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ADDRGP4 ClientNumberFromString
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 -1
+NEI4 $505
+ADDRGP4 $497
+JUMPV
+LABELV $505
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 1032
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $509
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $507
+LABELV $509
+ADDRGP4 $497
+JUMPV
+LABELV $507
+ADDRGP4 $487
+ARGP4
+ADDRLP4 1060
+CNSTI4 572
+ASGNI4
+ADDRLP4 1064
+CNSTI4 552
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 1060
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 1064
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1060
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 1064
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gc_orders
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1068
+CNSTI4 2
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1068
+INDIRI4
+LSHI4
+ADDRGP4 gc_orders
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+EQU4 $510
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $510
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1080
+CNSTI4 2
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1080
+INDIRI4
+LSHI4
+ADDRGP4 gc_orders
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+LABELV $510
+LABELV $497
+endproc Cmd_GameCommand_f 1084 16
+export Cmd_Where_f
+proc Cmd_Where_f 8 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $513
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $512
+endproc Cmd_Where_f 8 8
+data
+align 4
+LABELV gameNames
+address $514
+address $515
+address $516
+address $517
+address $518
+address $519
+address $520
+address $521
+export Cmd_CallVote_f
+code
+proc Cmd_CallVote_f 3128 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_allowVote+12
+INDIRI4
+CNSTI4 0
+NEI4 $523
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $526
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $523
+ADDRGP4 level+2404
+INDIRI4
+CNSTI4 0
+EQI4 $527
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $530
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $527
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $531
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $533
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $531
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $534
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $536
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $534
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 1032
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 1032
+ASGNP4
+ADDRGP4 $540
+JUMPV
+LABELV $537
+ADDRLP4 2056
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2064
+CNSTI4 10
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+ADDRLP4 2064
+INDIRI4
+EQI4 $544
+ADDRLP4 2056
+INDIRI4
+CNSTI4 13
+EQI4 $544
+ADDRLP4 2056
+INDIRI4
+ADDRLP4 2064
+INDIRI4
+LTI4 $541
+LABELV $546
+ADDRLP4 2056
+INDIRI4
+CNSTI4 59
+EQI4 $544
+ADDRGP4 $541
+JUMPV
+LABELV $544
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $545
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $541
+LABELV $538
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $540
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $537
+ADDRLP4 8
+ARGP4
+ADDRGP4 $549
+ARGP4
+ADDRLP4 2056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+CNSTI4 0
+NEI4 $547
+ADDRGP4 $548
+JUMPV
+LABELV $547
+ADDRLP4 8
+ARGP4
+ADDRGP4 $552
+ARGP4
+ADDRLP4 2060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+NEI4 $550
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRLP4 8
+ARGP4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 2064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2064
+INDIRI4
+CNSTI4 0
+NEI4 $553
+ADDRGP4 $554
+JUMPV
+LABELV $553
+ADDRLP4 8
+ARGP4
+ADDRGP4 $558
+ARGP4
+ADDRLP4 2068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $556
+ADDRGP4 $557
+JUMPV
+LABELV $556
+ADDRLP4 8
+ARGP4
+ADDRGP4 $561
+ARGP4
+ADDRLP4 2072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $559
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRLP4 8
+ARGP4
+ADDRGP4 $564
+ARGP4
+ADDRLP4 2076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $562
+ADDRGP4 $563
+JUMPV
+LABELV $562
+ADDRLP4 8
+ARGP4
+ADDRGP4 $567
+ARGP4
+ADDRLP4 2080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2080
+INDIRI4
+CNSTI4 0
+NEI4 $565
+ADDRGP4 $566
+JUMPV
+LABELV $565
+ADDRLP4 8
+ARGP4
+ADDRGP4 $570
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $568
+ADDRGP4 $569
+JUMPV
+LABELV $568
+ADDRLP4 8
+ARGP4
+ADDRGP4 $573
+ARGP4
+ADDRLP4 2088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2088
+INDIRI4
+CNSTI4 0
+NEI4 $571
+ADDRGP4 $572
+JUMPV
+LABELV $571
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $545
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $574
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $572
+LABELV $569
+LABELV $566
+LABELV $563
+LABELV $560
+LABELV $557
+LABELV $554
+LABELV $551
+LABELV $548
+ADDRGP4 level+2408
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRGP4 level+356
+ARGP4
+ADDRGP4 $555
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 2092
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 2092
+INDIRI4
+CNSTI4 0
+EQI4 $582
+ADDRGP4 level+356
+ARGP4
+ADDRGP4 $552
+ARGP4
+CNSTI4 7
+ARGI4
+ADDRLP4 2096
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 2096
+INDIRI4
+CNSTI4 0
+NEI4 $578
+LABELV $582
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $583
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $578
+ADDRGP4 level+2408
+CNSTI4 0
+ASGNI4
+ADDRGP4 $585
+ARGP4
+ADDRGP4 level+356
+ARGP4
+ADDRLP4 2100
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 2100
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $575
+ADDRLP4 8
+ARGP4
+ADDRGP4 $558
+ARGP4
+ADDRLP4 2092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2092
+INDIRI4
+CNSTI4 0
+NEI4 $587
+ADDRLP4 1032
+ARGP4
+ADDRLP4 2096
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2096
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+EQI4 $592
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $592
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+LTI4 $589
+LABELV $592
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $593
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $589
+ADDRGP4 level+356
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $596
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 level+1380
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $599
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gameNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $588
+JUMPV
+LABELV $587
+ADDRLP4 8
+ARGP4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 2096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2096
+INDIRI4
+CNSTI4 0
+NEI4 $600
+ADDRGP4 $552
+ARGP4
+ADDRLP4 2100
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 2100
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $602
+ADDRGP4 level+356
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $606
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 2100
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $603
+JUMPV
+LABELV $602
+ADDRGP4 level+356
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $599
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $603
+ADDRGP4 level+1380
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $611
+ARGP4
+ADDRGP4 level+356
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $601
+JUMPV
+LABELV $600
+ADDRLP4 8
+ARGP4
+ADDRGP4 $552
+ARGP4
+ADDRLP4 2100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2100
+INDIRI4
+CNSTI4 0
+NEI4 $613
+ADDRGP4 $552
+ARGP4
+ADDRLP4 2104
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 2104
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $615
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $617
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $615
+ADDRGP4 level+356
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $620
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 level+1380
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $611
+ARGP4
+ADDRGP4 level+356
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $614
+JUMPV
+LABELV $613
+ADDRLP4 8
+ARGP4
+ADDRGP4 $564
+ARGP4
+ADDRLP4 2104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2104
+INDIRI4
+CNSTI4 0
+EQI4 $626
+ADDRLP4 8
+ARGP4
+ADDRGP4 $561
+ARGP4
+ADDRLP4 2108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2108
+INDIRI4
+CNSTI4 0
+NEI4 $624
+LABELV $626
+ADDRLP4 8
+ARGP4
+ADDRGP4 $564
+ARGP4
+ADDRLP4 2120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2120
+INDIRI4
+CNSTI4 0
+NEI4 $629
+ADDRLP4 2112
+CNSTI4 1
+ASGNI4
+ADDRGP4 $630
+JUMPV
+LABELV $629
+ADDRLP4 2112
+CNSTI4 0
+ASGNI4
+LABELV $630
+ADDRLP4 8
+ARGP4
+ADDRGP4 $561
+ARGP4
+ADDRLP4 2124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2124
+INDIRI4
+CNSTI4 0
+NEI4 $631
+ADDRLP4 2116
+CNSTI4 1
+ASGNI4
+ADDRGP4 $632
+JUMPV
+LABELV $631
+ADDRLP4 2116
+CNSTI4 0
+ASGNI4
+LABELV $632
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 2112
+INDIRI4
+ARGI4
+ADDRLP4 2116
+INDIRI4
+ARGI4
+ADDRLP4 2128
+ADDRGP4 ClientNumberFromString
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $633
+ADDRGP4 $522
+JUMPV
+LABELV $633
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $635
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $637
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $635
+ADDRGP4 level+356
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $640
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 level+1380
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $643
+ARGP4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $625
+JUMPV
+LABELV $624
+ADDRGP4 level+356
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $646
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 level+1380
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $611
+ARGP4
+ADDRGP4 level+356
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $625
+LABELV $614
+LABELV $601
+LABELV $588
+ADDRGP4 $650
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 2112
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 2112
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 level+2404
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 level+2412
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+2416
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $658
+JUMPV
+LABELV $655
+ADDRLP4 2116
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 2116
+INDIRP4
+ADDRLP4 2116
+INDIRP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+LABELV $656
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $658
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $655
+ADDRLP4 2116
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 2116
+INDIRP4
+ADDRLP4 2116
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $660
+ARGP4
+ADDRGP4 level+2404
+INDIRI4
+ARGI4
+ADDRLP4 2120
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 8
+ARGI4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+CNSTI4 9
+ARGI4
+ADDRGP4 level+1380
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $660
+ARGP4
+ADDRGP4 level+2412
+INDIRI4
+ARGI4
+ADDRLP4 2124
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 10
+ARGI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $660
+ARGP4
+ADDRGP4 level+2416
+INDIRI4
+ARGI4
+ADDRLP4 2128
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 11
+ARGI4
+ADDRLP4 2128
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $522
+endproc Cmd_CallVote_f 3128 24
+export Cmd_Vote_f
+proc Cmd_Vote_f 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 level+2404
+INDIRI4
+CNSTI4 0
+NEI4 $666
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $669
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $665
+JUMPV
+LABELV $666
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $670
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $672
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $665
+JUMPV
+LABELV $670
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $673
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $675
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $665
+JUMPV
+LABELV $673
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 121
+EQI4 $679
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 49
+NEI4 $677
+LABELV $679
+ADDRLP4 72
+ADDRGP4 level+2412
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $660
+ARGP4
+ADDRGP4 level+2412
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 10
+ARGI4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $678
+JUMPV
+LABELV $677
+ADDRLP4 72
+ADDRGP4 level+2416
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $660
+ARGP4
+ADDRGP4 level+2416
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 11
+ARGI4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $678
+LABELV $665
+endproc Cmd_Vote_f 80 12
+export Cmd_CallTeamVote_f
+proc Cmd_CallTeamVote_f 2160 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+NEI4 $685
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRGP4 $686
+JUMPV
+LABELV $685
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+NEI4 $684
+ADDRLP4 1036
+CNSTI4 1
+ASGNI4
+LABELV $688
+LABELV $686
+ADDRGP4 g_allowVote+12
+INDIRI4
+CNSTI4 0
+NEI4 $689
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $526
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $684
+JUMPV
+LABELV $689
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4472
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $692
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $695
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $684
+JUMPV
+LABELV $692
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $696
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $698
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $684
+JUMPV
+LABELV $696
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $699
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $536
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $684
+JUMPV
+LABELV $699
+CNSTI4 1
+ARGI4
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $704
+JUMPV
+LABELV $701
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LEI4 $705
+ADDRLP4 4
+ARGP4
+ADDRGP4 $707
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $705
+ADDRLP4 4
+ARGP4
+ADDRLP4 2064
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2064
+INDIRU4
+ADDRLP4 4
+ADDP4
+ARGP4
+CNSTU4 1024
+ADDRLP4 2068
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+LABELV $702
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $704
+ADDRLP4 2064
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 2064
+INDIRI4
+LTI4 $701
+ADDRLP4 1028
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $711
+JUMPV
+LABELV $708
+ADDRLP4 2068
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2076
+CNSTI4 10
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+ADDRLP4 2076
+INDIRI4
+EQI4 $715
+ADDRLP4 2068
+INDIRI4
+CNSTI4 13
+EQI4 $715
+ADDRLP4 2068
+INDIRI4
+ADDRLP4 2076
+INDIRI4
+LTI4 $712
+LABELV $716
+ADDRLP4 2068
+INDIRI4
+CNSTI4 59
+EQI4 $715
+ADDRGP4 $712
+JUMPV
+LABELV $715
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $545
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $684
+JUMPV
+LABELV $712
+LABELV $709
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $711
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $708
+ADDRLP4 1040
+ARGP4
+ADDRGP4 $719
+ARGP4
+ADDRLP4 2068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $717
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $720
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $721
+JUMPV
+LABELV $720
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $722
+ADDRLP4 2144
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2144
+INDIRI4
+CNSTI4 0
+EQI4 $729
+ADDRLP4 2144
+INDIRI4
+CNSTI4 48
+LTI4 $729
+ADDRLP4 2144
+INDIRI4
+CNSTI4 57
+LEI4 $726
+LABELV $729
+ADDRGP4 $724
+JUMPV
+LABELV $726
+LABELV $723
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $722
+LABELV $724
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GEI4 $732
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $730
+LABELV $732
+ADDRLP4 4
+ARGP4
+ADDRLP4 2148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $736
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $733
+LABELV $736
+ADDRGP4 $737
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 2156
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $684
+JUMPV
+LABELV $733
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $731
+ADDRGP4 $741
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 2156
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $684
+JUMPV
+LABELV $730
+ADDRLP4 2108
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2108
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $745
+JUMPV
+LABELV $742
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $747
+ADDRGP4 $743
+JUMPV
+LABELV $747
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+EQI4 $749
+ADDRGP4 $743
+JUMPV
+LABELV $749
+ADDRLP4 2072
+ARGP4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 552
+ADDP4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2072
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 2072
+ARGP4
+ADDRLP4 2108
+ARGP4
+ADDRLP4 2148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2148
+INDIRI4
+CNSTI4 0
+NEI4 $751
+ADDRGP4 $744
+JUMPV
+LABELV $751
+LABELV $743
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $745
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $742
+LABELV $744
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $753
+ADDRGP4 $756
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 2148
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $684
+JUMPV
+LABELV $753
+LABELV $731
+LABELV $721
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $248
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $717
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $545
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $757
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $684
+JUMPV
+LABELV $718
+ADDRLP4 1036
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2424
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $599
+ARGP4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $763
+JUMPV
+LABELV $760
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $765
+ADDRGP4 $761
+JUMPV
+LABELV $765
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+NEI4 $767
+ADDRGP4 $769
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $767
+LABELV $761
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $763
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $760
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4472
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4480
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4488
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $777
+JUMPV
+LABELV $774
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+NEI4 $779
+ADDRLP4 2072
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI4
+CNSTI4 -524289
+BANDI4
+ASGNI4
+LABELV $779
+LABELV $775
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $777
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $774
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI4
+CNSTI4 524288
+BORI4
+ASGNI4
+ADDRGP4 $660
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4472
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2076
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 987
+ADDI4
+ARGI4
+ADDRLP4 2076
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+CNSTI4 989
+ADDI4
+ARGI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2424
+ADDP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $660
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4480
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2084
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 983
+ADDI4
+ARGI4
+ADDRLP4 2084
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $660
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4488
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2088
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 985
+ADDI4
+ARGI4
+ADDRLP4 2088
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $684
+endproc Cmd_CallTeamVote_f 2160 20
+export Cmd_TeamVote_f
+proc Cmd_TeamVote_f 88 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+NEI4 $786
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $787
+JUMPV
+LABELV $786
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+NEI4 $785
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $789
+LABELV $787
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $790
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $793
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $785
+JUMPV
+LABELV $790
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $794
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $796
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $785
+JUMPV
+LABELV $794
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $797
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $675
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $785
+JUMPV
+LABELV $797
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $799
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 524288
+BORI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 76
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 121
+EQI4 $802
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 49
+NEI4 $800
+LABELV $802
+ADDRLP4 80
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4480
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $660
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4480
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 983
+ADDI4
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $801
+JUMPV
+LABELV $800
+ADDRLP4 80
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4488
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $660
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4488
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 985
+ADDI4
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $801
+LABELV $785
+endproc Cmd_TeamVote_f 88 12
+export Cmd_SetViewpos_f
+proc Cmd_SetViewpos_f 1064 12
+ADDRGP4 g_cheats+12
+INDIRI4
+CNSTI4 0
+NEI4 $808
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $807
+JUMPV
+LABELV $808
+ADDRLP4 1052
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 5
+EQI4 $811
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $813
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $807
+JUMPV
+LABELV $811
+ADDRLP4 1056
+CNSTF4 0
+ASGNF4
+ADDRLP4 1040+8
+ADDRLP4 1056
+INDIRF4
+ASGNF4
+ADDRLP4 1040+4
+ADDRLP4 1056
+INDIRF4
+ASGNF4
+ADDRLP4 1040
+ADDRLP4 1056
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $816
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1028
+ADDP4
+ADDRLP4 1060
+INDIRF4
+ASGNF4
+LABELV $817
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $816
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 1040+4
+ADDRLP4 1060
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1040
+ARGP4
+ADDRGP4 TeleportPlayer
+CALLV
+pop
+LABELV $807
+endproc Cmd_SetViewpos_f 1064 12
+export Cmd_SetView_f
+proc Cmd_SetView_f 1052 12
+ADDRGP4 g_cheats+12
+INDIRI4
+CNSTI4 0
+NEI4 $822
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $821
+JUMPV
+LABELV $822
+ADDRLP4 1040
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 4
+EQI4 $825
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $827
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $821
+JUMPV
+LABELV $825
+ADDRLP4 1044
+CNSTF4 0
+ASGNF4
+ADDRLP4 1028+8
+ADDRLP4 1044
+INDIRF4
+ASGNF4
+ADDRLP4 1028+4
+ADDRLP4 1044
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1044
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $830
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1028
+ADDP4
+ADDRLP4 1048
+INDIRF4
+ASGNF4
+LABELV $831
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $830
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 SetClientViewAngle
+CALLV
+pop
+LABELV $821
+endproc Cmd_SetView_f 1052 12
+export Cmd_Stats_f
+proc Cmd_Stats_f 0 0
+LABELV $834
+endproc Cmd_Stats_f 0 0
+proc Cmd_Kami_f 4 8
+ADDRGP4 g_cheats+12
+INDIRI4
+CNSTI4 0
+NEI4 $836
+ADDRGP4 $109
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $835
+JUMPV
+LABELV $836
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_StartKamikaze
+CALLV
+pop
+LABELV $835
+endproc Cmd_Kami_f 4 8
+proc Cmd_ServerSound_f 4 12
+ADDRGP4 g_cheats+12
+INDIRI4
+CNSTI4 0
+NEI4 $840
+ADDRGP4 $109
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $839
+JUMPV
+LABELV $840
+CNSTI4 1
+ARGI4
+ADDRGP4 level+9216
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 level+9280
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 level+9292
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $839
+endproc Cmd_ServerSound_f 4 12
+proc Cmd_Juiced_f 4 8
+ADDRGP4 g_cheats+12
+INDIRI4
+CNSTI4 0
+NEI4 $848
+ADDRGP4 $109
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $847
+JUMPV
+LABELV $848
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 202
+ARGI4
+ADDRGP4 G_TempEntity
+CALLP4
+pop
+LABELV $851
+LABELV $847
+endproc Cmd_Juiced_f 4 8
+proc Cmd_Spawn_f 1276 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_cheats+12
+INDIRI4
+CNSTI4 0
+NEI4 $854
+ADDRGP4 $109
+ARGP4
+ADDRLP4 1244
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 1244
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $853
+JUMPV
+LABELV $854
+ADDRLP4 1244
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1244
+INDIRI4
+CNSTI4 2
+GEI4 $857
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $859
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $853
+JUMPV
+LABELV $857
+ADDRLP4 1248
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1248
+INDIRI4
+CNSTI4 2
+LEI4 $860
+CNSTI4 2
+ARGI4
+ADDRLP4 1116
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1116
+ARGP4
+ADDRLP4 1252
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 1252
+INDIRF4
+ASGNF4
+ADDRGP4 $861
+JUMPV
+LABELV $860
+ADDRLP4 24
+CNSTF4 1120403456
+ASGNF4
+LABELV $861
+CNSTI4 1
+ARGI4
+ADDRLP4 92
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1252
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 1252
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1256
+CNSTP4 0
+ASGNP4
+ADDRLP4 1256
+INDIRP4
+ARGP4
+ADDRLP4 1256
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 1268
+CNSTP4 0
+ASGNP4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 84
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 28+12
+INDIRB
+ASGNB 12
+ADDRLP4 92
+ARGP4
+ADDRLP4 1272
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 1272
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $869
+ADDRLP4 84
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRLP4 88
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 G_SpawnItem
+CALLV
+pop
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 FinishSpawningItem
+CALLV
+pop
+ADDRGP4 $853
+JUMPV
+LABELV $869
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRGP4 $871
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $853
+endproc Cmd_Spawn_f 1276 28
+export ClientCommand
+proc ClientCommand 1152 12
+ADDRLP4 1024
+CNSTI4 868
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1024
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $875
+ADDRLP4 1028
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $873
+LABELV $875
+ADDRLP4 1032
+ADDRLP4 1024
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $872
+ADDRLP4 1032
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $872
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $880
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $872
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Team_f
+CALLV
+pop
+ADDRGP4 $872
+JUMPV
+LABELV $873
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $883
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $881
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 Cmd_Say_f
+CALLV
+pop
+ADDRGP4 $872
+JUMPV
+LABELV $881
+ADDRLP4 0
+ARGP4
+ADDRGP4 $886
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $884
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Cmd_Say_f
+CALLV
+pop
+ADDRGP4 $872
+JUMPV
+LABELV $884
+ADDRLP4 0
+ARGP4
+ADDRGP4 $889
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $887
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Tell_f
+CALLV
+pop
+ADDRGP4 $872
+JUMPV
+LABELV $887
+ADDRLP4 0
+ARGP4
+ADDRGP4 $271
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $890
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Score_f
+CALLV
+pop
+ADDRGP4 $872
+JUMPV
+LABELV $890
+ADDRLP4 0
+ARGP4
+ADDRGP4 $894
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $892
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_DuelScores_f
+CALLV
+pop
+ADDRGP4 $872
+JUMPV
+LABELV $892
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $895
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Cmd_Say_f
+CALLV
+pop
+ADDRGP4 $872
+JUMPV
+LABELV $895
+ADDRLP4 0
+ARGP4
+ADDRGP4 $900
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $898
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Give_f
+CALLV
+pop
+ADDRGP4 $899
+JUMPV
+LABELV $898
+ADDRLP4 0
+ARGP4
+ADDRGP4 $903
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $901
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_God_f
+CALLV
+pop
+ADDRGP4 $902
+JUMPV
+LABELV $901
+ADDRLP4 0
+ARGP4
+ADDRGP4 $906
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $904
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Notarget_f
+CALLV
+pop
+ADDRGP4 $905
+JUMPV
+LABELV $904
+ADDRLP4 0
+ARGP4
+ADDRGP4 $909
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $907
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Noclip_f
+CALLV
+pop
+ADDRGP4 $908
+JUMPV
+LABELV $907
+ADDRLP4 0
+ARGP4
+ADDRGP4 $912
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $910
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Kill_f
+CALLV
+pop
+ADDRGP4 $911
+JUMPV
+LABELV $910
+ADDRLP4 0
+ARGP4
+ADDRGP4 $247
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $913
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_TeamTask_f
+CALLV
+pop
+ADDRGP4 $914
+JUMPV
+LABELV $913
+ADDRLP4 0
+ARGP4
+ADDRGP4 $917
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $915
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_LevelShot_f
+CALLV
+pop
+ADDRGP4 $916
+JUMPV
+LABELV $915
+ADDRLP4 0
+ARGP4
+ADDRGP4 $920
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $918
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Follow_f
+CALLV
+pop
+ADDRGP4 $919
+JUMPV
+LABELV $918
+ADDRLP4 0
+ARGP4
+ADDRGP4 $923
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $921
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Cmd_FollowCycle_f
+CALLV
+pop
+ADDRGP4 $922
+JUMPV
+LABELV $921
+ADDRLP4 0
+ARGP4
+ADDRGP4 $926
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $924
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 Cmd_FollowCycle_f
+CALLV
+pop
+ADDRGP4 $925
+JUMPV
+LABELV $924
+ADDRLP4 0
+ARGP4
+ADDRGP4 $880
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $927
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Team_f
+CALLV
+pop
+ADDRGP4 $928
+JUMPV
+LABELV $927
+ADDRLP4 0
+ARGP4
+ADDRGP4 $931
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $929
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Where_f
+CALLV
+pop
+ADDRGP4 $930
+JUMPV
+LABELV $929
+ADDRLP4 0
+ARGP4
+ADDRGP4 $934
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $932
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_CallVote_f
+CALLV
+pop
+ADDRGP4 $933
+JUMPV
+LABELV $932
+ADDRLP4 0
+ARGP4
+ADDRGP4 $937
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $935
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Vote_f
+CALLV
+pop
+ADDRGP4 $936
+JUMPV
+LABELV $935
+ADDRLP4 0
+ARGP4
+ADDRGP4 $940
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $938
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_CallTeamVote_f
+CALLV
+pop
+ADDRGP4 $939
+JUMPV
+LABELV $938
+ADDRLP4 0
+ARGP4
+ADDRGP4 $943
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $941
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_TeamVote_f
+CALLV
+pop
+ADDRGP4 $942
+JUMPV
+LABELV $941
+ADDRLP4 0
+ARGP4
+ADDRGP4 $946
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $944
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_GameCommand_f
+CALLV
+pop
+ADDRGP4 $945
+JUMPV
+LABELV $944
+ADDRLP4 0
+ARGP4
+ADDRGP4 $949
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $947
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_SetViewpos_f
+CALLV
+pop
+ADDRGP4 $948
+JUMPV
+LABELV $947
+ADDRLP4 0
+ARGP4
+ADDRGP4 $952
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $950
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_SetView_f
+CALLV
+pop
+ADDRGP4 $951
+JUMPV
+LABELV $950
+ADDRLP4 0
+ARGP4
+ADDRGP4 $955
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+NEI4 $953
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Stats_f
+CALLV
+pop
+ADDRGP4 $954
+JUMPV
+LABELV $953
+ADDRLP4 0
+ARGP4
+ADDRGP4 $958
+ARGP4
+ADDRLP4 1132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+CNSTI4 0
+NEI4 $956
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Kami_f
+CALLV
+pop
+ADDRGP4 $957
+JUMPV
+LABELV $956
+ADDRLP4 0
+ARGP4
+ADDRGP4 $961
+ARGP4
+ADDRLP4 1136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1136
+INDIRI4
+CNSTI4 0
+NEI4 $959
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_ServerSound_f
+CALLV
+pop
+ADDRGP4 $960
+JUMPV
+LABELV $959
+ADDRLP4 0
+ARGP4
+ADDRGP4 $964
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $962
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Juiced_f
+CALLV
+pop
+ADDRGP4 $963
+JUMPV
+LABELV $962
+ADDRLP4 0
+ARGP4
+ADDRGP4 $967
+ARGP4
+ADDRLP4 1144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1144
+INDIRI4
+CNSTI4 0
+NEI4 $965
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Spawn_f
+CALLV
+pop
+ADDRGP4 $966
+JUMPV
+LABELV $965
+ADDRGP4 $968
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1148
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $966
+LABELV $963
+LABELV $960
+LABELV $957
+LABELV $954
+LABELV $951
+LABELV $948
+LABELV $945
+LABELV $942
+LABELV $939
+LABELV $936
+LABELV $933
+LABELV $930
+LABELV $928
+LABELV $925
+LABELV $922
+LABELV $919
+LABELV $916
+LABELV $914
+LABELV $911
+LABELV $908
+LABELV $905
+LABELV $902
+LABELV $899
+LABELV $872
+endproc ClientCommand 1152 12
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $968
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $967
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $964
+byte 1 106
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $961
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $958
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 0
+align 1
+LABELV $955
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $952
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $949
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $946
+byte 1 103
+byte 1 99
+byte 1 0
+align 1
+LABELV $943
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $940
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $937
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $934
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $931
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $926
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $923
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $920
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $917
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $912
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $909
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $906
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $903
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $900
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $894
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $889
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $886
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $883
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $880
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $871
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $859
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 93
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $827
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $813
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $799
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $796
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $793
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $769
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $757
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $756
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $741
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $737
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $719
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $707
+byte 1 32
+byte 1 0
+align 1
+LABELV $698
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $695
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 65
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $676
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $675
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $672
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $669
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $660
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $650
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $646
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $643
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $640
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $637
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $620
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $617
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $611
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $606
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 59
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $599
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $596
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $593
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $585
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $583
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 102
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $574
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 60
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 44
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 110
+byte 1 62
+byte 1 44
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 62
+byte 1 44
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 62
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $573
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $570
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $567
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $564
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $561
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $558
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $555
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $552
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $549
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $545
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $536
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $533
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $530
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 65
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $526
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $521
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $520
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $519
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $518
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $517
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $516
+byte 1 83
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $515
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $514
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $513
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $504
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $500
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 48
+byte 1 45
+byte 1 37
+byte 1 100
+byte 1 62
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $496
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $495
+byte 1 115
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 121
+byte 1 0
+align 1
+LABELV $494
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $493
+byte 1 99
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $492
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $491
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $490
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $487
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $481
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $459
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $453
+byte 1 25
+byte 1 91
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 25
+byte 1 93
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $452
+byte 1 25
+byte 1 91
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 25
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $447
+byte 1 25
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 25
+byte 1 41
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $446
+byte 1 25
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 25
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $443
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $441
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $440
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $429
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $428
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $427
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $393
+byte 1 67
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $364
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 77
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 53
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $359
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $357
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $355
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $353
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $311
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $306
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $295
+byte 1 98
+byte 1 0
+align 1
+LABELV $294
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $290
+byte 1 114
+byte 1 0
+align 1
+LABELV $289
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $282
+byte 1 115
+byte 1 0
+align 1
+LABELV $281
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $278
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 50
+byte 1 0
+align 1
+LABELV $275
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 49
+byte 1 0
+align 1
+LABELV $271
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $270
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $266
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $263
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $260
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $257
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $248
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $247
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $243
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $242
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $236
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $229
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $228
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 70
+byte 1 10
+byte 1 0
+align 1
+LABELV $222
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $221
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 70
+byte 1 10
+byte 1 0
+align 1
+LABELV $215
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $214
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $213
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 70
+byte 1 10
+byte 1 0
+align 1
+LABELV $201
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $198
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $195
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $192
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $189
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $183
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $173
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $167
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $161
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $158
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $152
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $112
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $109
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $103
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $101
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $90
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $75
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
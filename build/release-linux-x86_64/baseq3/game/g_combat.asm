@@ -0,0 +1,7066 @@
+export ScorePlum
+code
+proc ScorePlum 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $56
+endproc ScorePlum 12 8
+export AddScore
+proc AddScore 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $58
+ADDRGP4 $57
+JUMPV
+LABELV $58
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $60
+ADDRGP4 $57
+JUMPV
+LABELV $60
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 ScorePlum
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+NEI4 $63
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+ADDRGP4 PERS_TEAM
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 level+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $63
+ADDRGP4 CalculateRanks
+CALLV
+pop
+LABELV $57
+endproc AddScore 12 12
+export TossClientItems
+proc TossClientItems 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $70
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+NEI4 $68
+LABELV $70
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $71
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+LABELV $71
+ADDRGP4 STAT_WEAPONS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $73
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $73
+LABELV $68
+ADDRLP4 28
+CNSTI4 2
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $75
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+EQI4 $75
+ADDRLP4 12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $75
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForWeapon
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Drop_Item
+CALLP4
+pop
+LABELV $75
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $77
+ADDRLP4 16
+CNSTF4 1110704128
+ASGNF4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $83
+JUMPV
+LABELV $80
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $84
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $87
+ADDRGP4 $81
+JUMPV
+LABELV $87
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Drop_Item
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 812
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+CNSTI4 1
+GEI4 $90
+ADDRLP4 4
+INDIRP4
+CNSTI4 812
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $90
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+CNSTF4 1110704128
+ADDF4
+ASGNF4
+LABELV $84
+LABELV $81
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $83
+ADDRLP4 0
+INDIRI4
+ADDRGP4 PW_NUM_POWERUPS
+INDIRI4
+LTI4 $80
+LABELV $77
+LABELV $67
+endproc TossClientItems 40 12
+export TossClientCubes
+proc TossClientCubes 68 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 440
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+ADDRGP4 G_EntitiesFree
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $93
+ADDRGP4 $92
+JUMPV
+LABELV $93
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $95
+ADDRGP4 $97
+ARGP4
+ADDRLP4 48
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $96
+JUMPV
+LABELV $95
+ADDRGP4 $98
+ARGP4
+ADDRLP4 48
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 48
+INDIRP4
+ASGNP4
+LABELV $96
+ADDRLP4 16+4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 52
+CNSTP4 0
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 56
+CNSTF4 1125515264
+ASGNF4
+ADDRLP4 0
+ADDRLP4 56
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1125515264
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1112014848
+CNSTF4 1073741824
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1128792064
+ADDF4
+ADDF4
+ASGNF4
+ADDRGP4 neutralObelisk
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $107
+ADDRLP4 28
+ADDRGP4 neutralObelisk
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 28+8
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1110441984
+ADDF4
+ASGNF4
+ADDRGP4 $108
+JUMPV
+LABELV $107
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 64
+INDIRF4
+ASGNF4
+LABELV $108
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 LaunchItem
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_cubeTimeout+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 G_FreeEntity
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 584
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $92
+endproc TossClientCubes 68 16
+export TossClientPersistantPowerups
+proc TossClientPersistantPowerups 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $115
+ADDRGP4 $114
+JUMPV
+LABELV $115
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $117
+ADDRGP4 $114
+JUMPV
+LABELV $117
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 1073741824
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 812
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $114
+endproc TossClientPersistantPowerups 12 4
+export LookAtKiller
+proc LookAtKiller 0 0
+LABELV $119
+endproc LookAtKiller 0 0
+export GibEntity
+proc GibEntity 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $121
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $126
+JUMPV
+LABELV $123
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $128
+ADDRGP4 $124
+JUMPV
+LABELV $128
+ADDRLP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $130
+ADDRGP4 $124
+JUMPV
+LABELV $130
+ADDRLP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $132
+ADDRGP4 $124
+JUMPV
+LABELV $132
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $125
+JUMPV
+LABELV $124
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $126
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $123
+LABELV $125
+LABELV $121
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 63
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $120
+endproc GibEntity 12 12
+export body_die
+proc body_die 0 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 -40
+LEI4 $136
+ADDRGP4 $135
+JUMPV
+LABELV $136
+ADDRGP4 g_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+CNSTI4 -39
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $138
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 GibEntity
+CALLV
+pop
+LABELV $135
+endproc body_die 0 8
+data
+align 4
+LABELV modNames
+address $141
+address $142
+address $143
+address $144
+address $145
+address $146
+address $147
+address $148
+address $149
+address $150
+address $151
+address $152
+address $153
+address $154
+address $155
+address $156
+address $157
+address $158
+address $159
+address $160
+address $161
+address $162
+address $163
+address $164
+address $165
+address $166
+address $167
+address $168
+address $169
+address $170
+address $171
+address $172
+address $173
+export Kamikaze_DeathActivate
+code
+proc Kamikaze_DeathActivate 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_StartKamikaze
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+LABELV $174
+endproc Kamikaze_DeathActivate 0 4
+export Kamikaze_DeathTimer
+proc Kamikaze_DeathTimer 16 0
+ADDRLP4 4
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 $134
+ASGNP4
+ADDRLP4 8
+CNSTI4 24
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 Kamikaze_DeathActivate
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $175
+endproc Kamikaze_DeathTimer 16 0
+export CheckAlmostCapture
+proc CheckAlmostCapture 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $181
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $181
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $178
+LABELV $181
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $182
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $185
+ADDRLP4 4
+ADDRGP4 $187
+ASGNP4
+ADDRGP4 $183
+JUMPV
+LABELV $185
+ADDRLP4 4
+ADDRGP4 $188
+ASGNP4
+ADDRGP4 $183
+JUMPV
+LABELV $182
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $189
+ADDRLP4 4
+ADDRGP4 $188
+ASGNP4
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRLP4 4
+ADDRGP4 $187
+ASGNP4
+LABELV $190
+LABELV $183
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+LABELV $191
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $192
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $194
+ADDRLP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $191
+LABELV $194
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $195
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $195
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 40
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 40
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+CNSTF4 1128792064
+GEF4 $199
+ADDRLP4 52
+ADDRGP4 PERS_PLAYEREVENTS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $201
+ADDRLP4 56
+ADDRGP4 PERS_PLAYEREVENTS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+LABELV $201
+LABELV $199
+LABELV $195
+LABELV $178
+LABELV $177
+endproc CheckAlmostCapture 60 12
+export CheckAlmostScored
+proc CheckAlmostScored 44 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $204
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $206
+ADDRLP4 16
+ADDRGP4 $208
+ASGNP4
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRLP4 16
+ADDRGP4 $209
+ASGNP4
+LABELV $207
+CNSTP4 0
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $210
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1128792064
+GEF4 $214
+ADDRLP4 36
+ADDRGP4 PERS_PLAYEREVENTS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $216
+ADDRLP4 40
+ADDRGP4 PERS_PLAYEREVENTS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+LABELV $216
+LABELV $214
+LABELV $210
+LABELV $204
+LABELV $203
+endproc CheckAlmostScored 44 12
+bss
+align 4
+LABELV $285
+skip 4
+export player_die
+code
+proc player_die 100 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $219
+ADDRGP4 $218
+JUMPV
+LABELV $219
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $221
+ADDRGP4 $218
+JUMPV
+LABELV $221
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CheckAlmostCapture
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CheckAlmostScored
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTU4 0
+ASGNU4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $224
+ADDRLP4 28
+INDIRP4
+CNSTI4 800
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 800
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_HookFree
+CALLV
+pop
+LABELV $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $226
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $226
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 G_FreeEntity
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $226
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $229
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $231
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ASGNP4
+ADDRGP4 $230
+JUMPV
+LABELV $231
+ADDRLP4 12
+ADDRGP4 $233
+ASGNP4
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRLP4 4
+CNSTI4 1022
+ASGNI4
+ADDRLP4 12
+ADDRGP4 $234
+ASGNP4
+LABELV $230
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $237
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $235
+LABELV $237
+ADDRLP4 4
+CNSTI4 1022
+ASGNI4
+ADDRLP4 12
+ADDRGP4 $234
+ASGNP4
+LABELV $235
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $240
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+CNSTU4 33
+LTU4 $238
+LABELV $240
+ADDRLP4 20
+ADDRGP4 $241
+ASGNP4
+ADDRGP4 $239
+JUMPV
+LABELV $238
+ADDRLP4 20
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 modNames
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $239
+ADDRGP4 $242
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 58
+ARGI4
+ADDRLP4 52
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 32
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 PERS_KILLED
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 64
+CNSTU4 0
+ASGNU4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 64
+INDIRU4
+EQU4 $243
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 64
+INDIRU4
+EQU4 $243
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $247
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $245
+LABELV $247
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRGP4 $244
+JUMPV
+LABELV $245
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $248
+ADDRLP4 80
+ADDRGP4 PERS_GAUNTLET_FRAG_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRLP4 92
+CNSTI4 2
+ASGNI4
+ADDRLP4 96
+ADDRGP4 PERS_PLAYEREVENTS
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+BXORI4
+ASGNI4
+LABELV $248
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 792
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 3000
+GEI4 $251
+ADDRLP4 80
+ADDRGP4 PERS_EXCELLENT_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $251
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 792
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+LABELV $244
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Team_FragBonuses
+CALLV
+pop
+ADDRFP4 16
+INDIRI4
+CNSTI4 20
+NEI4 $256
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $258
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRGP4 PW_REDFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $260
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 PW_REDFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $262
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $262
+LABELV $261
+LABELV $259
+LABELV $256
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TossClientItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TossClientPersistantPowerups
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+NEI4 $264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TossClientCubes
+CALLV
+pop
+LABELV $264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Score_f
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $270
+JUMPV
+LABELV $267
+ADDRLP4 68
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $272
+ADDRGP4 $268
+JUMPV
+LABELV $272
+ADDRLP4 68
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $274
+ADDRGP4 $268
+JUMPV
+LABELV $274
+ADDRLP4 68
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $276
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 Cmd_Score_f
+CALLV
+pop
+LABELV $276
+LABELV $268
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $270
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $267
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 67108864
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1700
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $284
+ADDRLP4 16
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+NEU4 $284
+ADDRGP4 g_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $282
+LABELV $284
+ADDRFP4 16
+INDIRI4
+CNSTI4 20
+NEI4 $279
+LABELV $282
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 GibEntity
+CALLV
+pop
+ADDRGP4 $280
+JUMPV
+LABELV $279
+ADDRLP4 76
+ADDRGP4 $285
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $288
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+EQI4 $289
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+EQI4 $290
+ADDRGP4 $286
+JUMPV
+LABELV $288
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $289
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $290
+LABELV $286
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+LABELV $287
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $291
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+CNSTI4 -39
+ASGNI4
+LABELV $291
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 84
+CNSTI4 128
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+ADDRLP4 84
+INDIRI4
+BXORI4
+ADDRLP4 24
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 92
+CNSTI4 128
+ASGNI4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+BANDI4
+ADDRLP4 92
+INDIRI4
+BXORI4
+ADDRLP4 24
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $285
+INDIRI4
+CNSTI4 54
+ADDI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRGP4 body_die
+ASGNP4
+ADDRLP4 96
+ADDRGP4 $285
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 3
+MODI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $293
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Kamikaze_DeathTimer
+CALLV
+pop
+LABELV $293
+LABELV $280
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $218
+endproc player_die 100 28
+export CheckArmor
+proc CheckArmor 20 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $296
+CNSTI4 0
+RETI4
+ADDRGP4 $295
+JUMPV
+LABELV $296
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $298
+CNSTI4 0
+RETI4
+ADDRGP4 $295
+JUMPV
+LABELV $298
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $300
+CNSTI4 0
+RETI4
+ADDRGP4 $295
+JUMPV
+LABELV $300
+ADDRLP4 8
+ADDRGP4 STAT_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+CNSTF4 1059648963
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 ceil
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $302
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $302
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $304
+CNSTI4 0
+RETI4
+ADDRGP4 $295
+JUMPV
+LABELV $304
+ADDRLP4 16
+ADDRGP4 STAT_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $295
+endproc CheckArmor 20 4
+export RaySphereIntersections
+proc RaySphereIntersections 96 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 1073741824
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+LEF4 $307
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+NEGF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+NEGF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 2
+RETI4
+ADDRGP4 $306
+JUMPV
+LABELV $307
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+NEF4 $309
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+NEGF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $306
+JUMPV
+LABELV $309
+CNSTI4 0
+RETI4
+LABELV $306
+endproc RaySphereIntersections 96 4
+export G_InvulnerabilityEffect
+proc G_InvulnerabilityEffect 64 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $312
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $312
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTF4 1109917696
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+ADDRGP4 RaySphereIntersections
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $314
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 70
+ARGI4
+ADDRLP4 48
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 56
+ADDRLP4 36
+INDIRP4
+CNSTI4 124
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $320
+ADDRLP4 60
+ADDRLP4 36
+INDIRP4
+CNSTI4 124
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $320
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $322
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $322
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $324
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $324
+CNSTI4 1
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $314
+CNSTI4 0
+RETI4
+LABELV $311
+endproc G_InvulnerabilityEffect 64 20
+export G_Damage
+proc G_Damage 100 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $327
+ADDRGP4 $326
+JUMPV
+LABELV $327
+ADDRGP4 level+9124
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRGP4 $326
+JUMPV
+LABELV $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $332
+ADDRFP4 28
+INDIRI4
+CNSTI4 27
+EQI4 $332
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $334
+ADDRLP4 44
+CNSTU4 0
+ASGNU4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 44
+INDIRU4
+EQU4 $326
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+ADDRLP4 44
+INDIRU4
+EQU4 $326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 G_InvulnerabilityEffect
+CALLI4
+pop
+ADDRGP4 $326
+JUMPV
+LABELV $334
+LABELV $332
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $339
+ADDRFP4 4
+ADDRGP4 g_entities+887096
+ASGNP4
+LABELV $339
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $342
+ADDRFP4 8
+ADDRGP4 g_entities+887096
+ASGNP4
+LABELV $342
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $326
+JUMPV
+LABELV $345
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $349
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $349
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+ADDRLP4 56
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 184
+ASGNI4
+ADDRLP4 16
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LSHI4
+ADDRLP4 56
+INDIRP4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 52
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LSHI4
+ADDRLP4 56
+INDIRP4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRGP4 PW_GUARD
+INDIRI4
+NEI4 $351
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+LABELV $351
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+LABELV $349
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $354
+ADDRLP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $356
+ADDRGP4 $326
+JUMPV
+LABELV $356
+LABELV $354
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $358
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $359
+ADDRLP4 8
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 200
+LEI4 $360
+ADDRLP4 8
+CNSTI4 200
+ASGNI4
+LABELV $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $362
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $362
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $364
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $364
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $366
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $366
+ADDRLP4 64
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 72
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 g_knockback+8
+INDIRF4
+ADDRLP4 72
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 52+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 g_knockback+8
+INDIRF4
+ADDRLP4 72
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 52+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 g_knockback+8
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 64
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRLP4 52+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRLP4 52+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $375
+ADDRLP4 92
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 50
+GEI4 $377
+ADDRLP4 92
+CNSTI4 50
+ASGNI4
+LABELV $377
+ADDRLP4 92
+INDIRI4
+CNSTI4 200
+LEI4 $379
+ADDRLP4 92
+CNSTI4 200
+ASGNI4
+LABELV $379
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $375
+LABELV $366
+ADDRFP4 24
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $381
+ADDRFP4 28
+INDIRI4
+CNSTI4 27
+EQI4 $383
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $383
+ADDRFP4 24
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $383
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $383
+ADDRGP4 g_friendlyFire+12
+INDIRI4
+CNSTI4 0
+NEI4 $385
+ADDRGP4 $326
+JUMPV
+LABELV $385
+LABELV $383
+ADDRFP4 28
+INDIRI4
+CNSTI4 25
+NEI4 $388
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTU4 0
+ASGNU4
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+EQU4 $390
+ADDRLP4 72
+ADDRLP4 64
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+EQU4 $390
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $390
+ADDRGP4 $326
+JUMPV
+LABELV $390
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+NEU4 $392
+ADDRGP4 $326
+JUMPV
+LABELV $392
+LABELV $388
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $394
+ADDRGP4 $326
+JUMPV
+LABELV $394
+LABELV $381
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $396
+ADDRGP4 PW_BATTLESUIT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $396
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 60
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $400
+ADDRFP4 28
+INDIRI4
+CNSTI4 19
+NEI4 $398
+LABELV $400
+ADDRGP4 $326
+JUMPV
+LABELV $398
+ADDRFP4 20
+CNSTF4 1056964608
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $396
+ADDRLP4 60
+CNSTU4 0
+ASGNU4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 60
+INDIRU4
+EQU4 $401
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 60
+INDIRU4
+EQU4 $401
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $401
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $401
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 3
+EQI4 $401
+ADDRLP4 72
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $401
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $403
+ADDRLP4 80
+ADDRGP4 PERS_HITS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $404
+JUMPV
+LABELV $403
+ADDRLP4 80
+ADDRGP4 PERS_HITS
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $404
+ADDRLP4 80
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_ATTACKEE_ARMOR
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 STAT_ARMOR
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+BORI4
+ASGNI4
+LABELV $401
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+NEU4 $405
+ADDRFP4 20
+CNSTF4 1056964608
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $405
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+GEI4 $407
+ADDRFP4 20
+CNSTI4 1
+ASGNI4
+LABELV $407
+ADDRLP4 4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CheckArmor
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 g_debugDamage+12
+INDIRI4
+CNSTI4 0
+EQI4 $409
+ADDRGP4 $412
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $409
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $414
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $416
+ADDRGP4 PERS_ATTACKER
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRGP4 PERS_ATTACKER
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+CNSTI4 1022
+ASGNI4
+LABELV $417
+ADDRLP4 80
+ADDRLP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $418
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $419
+JUMPV
+LABELV $418
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $419
+LABELV $414
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $420
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Team_CheckHurtCarrier
+CALLV
+pop
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 764
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRFP4 28
+INDIRI4
+ASGNI4
+LABELV $423
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $425
+ADDRLP4 84
+CNSTI4 572
+ASGNI4
+ADDRLP4 88
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 88
+INDIRU4
+EQU4 $427
+ADDRFP4 8
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 88
+INDIRU4
+EQU4 $427
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 96
+ARGI4
+ADDRLP4 92
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 BG_ModToWeapon
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+CNSTI4 212
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $427
+LABELV $425
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $429
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $431
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $433
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $435
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 -999
+GEI4 $437
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+CNSTI4 -999
+ASGNI4
+LABELV $437
+ADDRFP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $326
+JUMPV
+LABELV $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 764
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $439
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 764
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $439
+LABELV $429
+LABELV $326
+endproc G_Damage 100 24
+lit
+align 4
+LABELV $442
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3245342720
+align 4
+LABELV $443
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1097859072
+export CanDamage
+code
+proc CanDamage 152 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 $442
+INDIRB
+ASGNB 12
+ADDRLP4 92
+ADDRGP4 $443
+INDIRB
+ASGNB 12
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 68
+ADDRLP4 112
+INDIRF4
+ADDRLP4 68
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 68+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 68+8
+CNSTF4 1056964608
+ADDRLP4 68+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $454
+ADDRLP4 12+52
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $450
+LABELV $454
+CNSTI4 1
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $450
+ADDRLP4 0
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 92+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 92+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $459
+CNSTI4 1
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $459
+ADDRLP4 0
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 92+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $466
+CNSTI4 1
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $466
+ADDRLP4 0
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 92+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 92+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $473
+CNSTI4 1
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $473
+ADDRLP4 0
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 92+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $480
+CNSTI4 1
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $480
+ADDRLP4 0
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 92+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $487
+CNSTI4 1
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $487
+ADDRLP4 0
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $494
+CNSTI4 1
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $494
+ADDRLP4 0
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 92+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $501
+CNSTI4 1
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $501
+ADDRLP4 0
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $508
+CNSTI4 1
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $508
+CNSTI4 0
+RETI4
+LABELV $441
+endproc CanDamage 152 28
+export G_RadiusDamage
+proc G_RadiusDamage 4196 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4168
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRF4
+CNSTF4 1065353216
+GEF4 $512
+ADDRFP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $512
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $514
+ADDRLP4 4172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4172
+INDIRI4
+ADDRLP4 4144
+ADDP4
+ADDRLP4 4172
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 4156
+ADDP4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $515
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $514
+ADDRLP4 4144
+ARGP4
+ADDRLP4 4156
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4172
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 4140
+ADDRLP4 4172
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $518
+ADDRLP4 4
+CNSTI4 868
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+NEU4 $522
+ADDRGP4 $519
+JUMPV
+LABELV $522
+ADDRLP4 4
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $524
+ADDRGP4 $519
+JUMPV
+LABELV $524
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $526
+ADDRLP4 4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDP4
+INDIRF4
+GEF4 $530
+ADDRLP4 4180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $531
+JUMPV
+LABELV $530
+ADDRLP4 4180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRF4
+LEF4 $532
+ADDRLP4 4184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4184
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4184
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4184
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $533
+JUMPV
+LABELV $532
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $533
+LABELV $531
+LABELV $527
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $526
+ADDRLP4 8
+ARGP4
+ADDRLP4 4176
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 4176
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+LTF4 $534
+ADDRGP4 $519
+JUMPV
+LABELV $534
+ADDRLP4 40
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+DIVF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4180
+ADDRGP4 CanDamage
+CALLI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+CNSTI4 0
+EQI4 $536
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4184
+ADDRGP4 LogAccuracyHit
+CALLI4
+ASGNI4
+ADDRLP4 4184
+INDIRI4
+CNSTI4 0
+EQI4 $538
+ADDRLP4 4168
+CNSTI4 1
+ASGNI4
+LABELV $538
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $536
+LABELV $519
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $521
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4140
+INDIRI4
+LTI4 $518
+ADDRLP4 4168
+INDIRI4
+RETI4
+LABELV $511
+endproc G_RadiusDamage 4196 32
+import neutralObelisk
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $412
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $242
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $241
+byte 1 60
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 62
+byte 1 0
+align 1
+LABELV $234
+byte 1 60
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 62
+byte 1 0
+align 1
+LABELV $233
+byte 1 60
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 45
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 62
+byte 1 0
+align 1
+LABELV $209
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $208
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $188
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $187
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $173
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 72
+byte 1 77
+byte 1 71
+byte 1 0
+align 1
+LABELV $172
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 51
+byte 1 49
+byte 1 0
+align 1
+LABELV $171
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 72
+byte 1 65
+byte 1 87
+byte 1 0
+align 1
+LABELV $170
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 84
+byte 1 67
+byte 1 72
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 83
+byte 1 0
+align 1
+LABELV $169
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 80
+byte 1 76
+byte 1 69
+byte 1 0
+align 1
+LABELV $168
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $167
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 75
+byte 1 65
+byte 1 77
+byte 1 73
+byte 1 75
+byte 1 65
+byte 1 90
+byte 1 69
+byte 1 0
+align 1
+LABELV $166
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 0
+align 1
+LABELV $165
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $164
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 78
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 0
+align 1
+LABELV $163
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 72
+byte 1 85
+byte 1 82
+byte 1 84
+byte 1 0
+align 1
+LABELV $162
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 82
+byte 1 71
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $161
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 85
+byte 1 73
+byte 1 67
+byte 1 73
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $160
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $159
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 70
+byte 1 82
+byte 1 65
+byte 1 71
+byte 1 0
+align 1
+LABELV $158
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 67
+byte 1 82
+byte 1 85
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $157
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 76
+byte 1 65
+byte 1 86
+byte 1 65
+byte 1 0
+align 1
+LABELV $156
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $155
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $154
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $153
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $152
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $151
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $150
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 77
+byte 1 65
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $149
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 77
+byte 1 65
+byte 1 0
+align 1
+LABELV $148
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 82
+byte 1 79
+byte 1 67
+byte 1 75
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $147
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 82
+byte 1 79
+byte 1 67
+byte 1 75
+byte 1 69
+byte 1 84
+byte 1 0
+align 1
+LABELV $146
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $145
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $144
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 77
+byte 1 65
+byte 1 67
+byte 1 72
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $143
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 0
+align 1
+LABELV $142
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $141
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 0
+align 1
+LABELV $134
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $98
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 67
+byte 1 117
+byte 1 98
+byte 1 101
+byte 1 0
+align 1
+LABELV $97
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 67
+byte 1 117
+byte 1 98
+byte 1 101
+byte 1 0
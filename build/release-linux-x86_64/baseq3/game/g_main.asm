@@ -0,0 +1,10257 @@
+data
+align 4
+LABELV gameCvarTable
+address g_cheats
+address $57
+address $58
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+byte 4 0
+address $59
+address $60
+byte 4 68
+byte 4 0
+byte 4 0
+skip 4
+byte 4 0
+address $61
+address $62
+byte 4 64
+byte 4 0
+byte 4 0
+skip 4
+address g_restarted
+address $63
+address $64
+byte 4 64
+byte 4 0
+byte 4 0
+skip 4
+address g_gametype
+address $65
+address $64
+byte 4 38
+byte 4 0
+byte 4 0
+skip 4
+address g_maxclients
+address $66
+address $67
+byte 4 37
+byte 4 0
+byte 4 0
+skip 4
+address g_maxGameClients
+address $68
+address $64
+byte 4 37
+byte 4 0
+byte 4 0
+skip 4
+address g_dmflags
+address $69
+address $64
+byte 4 5
+byte 4 0
+byte 4 1
+skip 4
+address g_fraglimit
+address $70
+address $71
+byte 4 1029
+byte 4 0
+byte 4 1
+skip 4
+address g_timelimit
+address $72
+address $64
+byte 4 1029
+byte 4 0
+byte 4 1
+skip 4
+address g_capturelimit
+address $73
+address $67
+byte 4 1029
+byte 4 0
+byte 4 1
+skip 4
+address g_synchronousClients
+address $74
+address $64
+byte 4 8
+byte 4 0
+byte 4 0
+skip 4
+address g_friendlyFire
+address $75
+address $64
+byte 4 1
+byte 4 0
+byte 4 1
+skip 4
+address g_teamAutoJoin
+address $76
+address $64
+byte 4 1
+skip 12
+address g_teamForceBalance
+address $77
+address $64
+byte 4 1
+skip 12
+address g_warmup
+address $78
+address $71
+byte 4 1
+byte 4 0
+byte 4 1
+skip 4
+address g_doWarmup
+address $79
+address $64
+byte 4 1
+byte 4 0
+byte 4 1
+skip 4
+address g_logfile
+address $80
+address $81
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_logfileSync
+address $82
+address $64
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_password
+address $83
+address $58
+byte 4 2
+byte 4 0
+byte 4 0
+skip 4
+address g_banIPs
+address $84
+address $58
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_filterBan
+address $85
+address $86
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_needpass
+address $87
+address $64
+byte 4 68
+byte 4 0
+byte 4 0
+skip 4
+address g_dedicated
+address $88
+address $64
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_speed
+address $89
+address $90
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_gravity
+address $91
+address $92
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_knockback
+address $93
+address $94
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_quadfactor
+address $95
+address $96
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_weaponRespawn
+address $97
+address $98
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_weaponTeamRespawn
+address $99
+address $100
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_forcerespawn
+address $101
+address $71
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_inactivity
+address $102
+address $64
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_debugMove
+address $103
+address $64
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_debugDamage
+address $104
+address $64
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_debugAlloc
+address $105
+address $64
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_motd
+address $106
+address $58
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_blood
+address $107
+address $86
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_podiumDist
+address $108
+address $109
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_podiumDrop
+address $110
+address $111
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_allowVote
+address $112
+address $86
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_listEntity
+address $113
+address $64
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_obeliskHealth
+address $114
+address $115
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_obeliskRegenPeriod
+address $116
+address $86
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_obeliskRegenAmount
+address $117
+address $118
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_obeliskRespawnDelay
+address $119
+address $120
+byte 4 4
+byte 4 0
+byte 4 0
+skip 4
+address g_cubeTimeout
+address $121
+address $100
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_redteam
+address $122
+address $123
+byte 4 7
+byte 4 0
+byte 4 1
+byte 4 1
+address g_blueteam
+address $124
+address $125
+byte 4 7
+byte 4 0
+byte 4 1
+byte 4 1
+address g_singlePlayer
+address $126
+address $58
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address g_enableDust
+address $127
+address $64
+byte 4 4
+byte 4 0
+byte 4 1
+byte 4 0
+address g_enableBreath
+address $128
+address $64
+byte 4 4
+byte 4 0
+byte 4 1
+byte 4 0
+address g_proxMineTimeout
+address $129
+address $130
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_smoothClients
+address $131
+address $86
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address pmove_fixed
+address $132
+address $64
+byte 4 8
+byte 4 0
+byte 4 0
+skip 4
+address pmove_msec
+address $133
+address $67
+byte 4 8
+byte 4 0
+byte 4 0
+skip 4
+address g_rankings
+address $134
+address $64
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_localTeamPref
+address $135
+address $58
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_levelStartTime
+address $136
+address $64
+byte 4 4
+byte 4 0
+byte 4 0
+skip 4
+address g_weapon_rocket_speed
+address $137
+address $138
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_weapon_plasma_speed
+address $139
+address $140
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_debugPingValue
+address $141
+address $64
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+align 4
+LABELV gameCvarTableSize
+byte 4 61
+export vmMain
+code
+proc vmMain 16 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $143
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GTI4 $143
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $156
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $156
+address $145
+address $146
+address $147
+address $151
+address $149
+address $150
+address $152
+address $148
+address $153
+address $154
+address $155
+code
+LABELV $145
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_InitGame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $146
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_ShutdownGame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $147
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 ClientConnect
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CVUI4 4
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $148
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientThink
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $149
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $150
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientDisconnect
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $151
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $152
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $153
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_RunFrame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $154
+ADDRLP4 8
+ADDRGP4 ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $155
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotAIStartFrame
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $143
+CNSTI4 -1
+RETI4
+LABELV $142
+endproc vmMain 16 12
+export G_Printf
+proc G_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $157
+endproc G_Printf 1028 16
+export G_Error
+proc G_Error 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $159
+endproc G_Error 1028 16
+export G_FindTeams
+proc G_FindTeams 56 12
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 64
+ASGNI4
+ADDRLP4 4
+CNSTI4 868
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRGP4 $165
+JUMPV
+LABELV $162
+ADDRLP4 4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $167
+ADDRGP4 $163
+JUMPV
+LABELV $167
+ADDRLP4 4
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $169
+ADDRGP4 $163
+JUMPV
+LABELV $169
+ADDRLP4 4
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $171
+ADDRGP4 $163
+JUMPV
+LABELV $171
+ADDRLP4 4
+INDIRP4
+CNSTI4 832
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+ADDRGP4 $176
+JUMPV
+LABELV $173
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $178
+ADDRGP4 $174
+JUMPV
+LABELV $178
+ADDRLP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $180
+ADDRGP4 $174
+JUMPV
+LABELV $180
+ADDRLP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $182
+ADDRGP4 $174
+JUMPV
+LABELV $182
+ADDRLP4 36
+CNSTI4 708
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $184
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 828
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 828
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $186
+ADDRLP4 52
+CNSTI4 704
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $186
+LABELV $184
+LABELV $174
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+LABELV $176
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $173
+LABELV $163
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+LABELV $165
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $162
+ADDRGP4 $188
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $161
+endproc G_FindTeams 56 12
+export G_RemapTeamShaders
+proc G_RemapTeamShaders 1032 16
+ADDRLP4 1024
+CNSTF4 981668463
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $191
+ARGP4
+ADDRGP4 g_redteam+16
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $193
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+INDIRF4
+ARGF4
+ADDRGP4 AddRemap
+CALLV
+pop
+ADDRGP4 $194
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+INDIRF4
+ARGF4
+ADDRGP4 AddRemap
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $195
+ARGP4
+ADDRGP4 g_blueteam+16
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $197
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+INDIRF4
+ARGF4
+ADDRGP4 AddRemap
+CALLV
+pop
+ADDRGP4 $198
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+INDIRF4
+ARGF4
+ADDRGP4 AddRemap
+CALLV
+pop
+ADDRLP4 1028
+ADDRGP4 BuildShaderStateConfig
+CALLP4
+ASGNP4
+CNSTI4 665
+ARGI4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $189
+endproc G_RemapTeamShaders 1032 16
+export G_RegisterCvars
+proc G_RegisterCvars 20 16
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 gameCvarTable
+ASGNP4
+ADDRGP4 $203
+JUMPV
+LABELV $200
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $204
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $204
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $206
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $206
+LABELV $201
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $203
+ADDRLP4 4
+INDIRI4
+ADDRGP4 gameCvarTableSize
+INDIRI4
+LTI4 $200
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $208
+ADDRGP4 G_RemapTeamShaders
+CALLV
+pop
+LABELV $208
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+LTI4 $214
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 17
+LTI4 $210
+LABELV $214
+ADDRGP4 $215
+ARGP4
+ADDRGP4 g_gametype+12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $65
+ARGP4
+ADDRGP4 $64
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 g_gametype
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $210
+ADDRGP4 level+352
+ADDRGP4 g_warmup+4
+INDIRI4
+ASGNI4
+LABELV $199
+endproc G_RegisterCvars 20 16
+export G_UpdateCvars
+proc G_UpdateCvars 28 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 gameCvarTable
+ASGNP4
+ADDRGP4 $223
+JUMPV
+LABELV $220
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $224
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+EQI4 $226
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $228
+ADDRGP4 $230
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $228
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $231
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $231
+LABELV $226
+LABELV $224
+LABELV $221
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $223
+ADDRLP4 4
+INDIRI4
+ADDRGP4 gameCvarTableSize
+INDIRI4
+LTI4 $220
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $233
+ADDRGP4 G_RemapTeamShaders
+CALLV
+pop
+LABELV $233
+LABELV $219
+endproc G_UpdateCvars 28 12
+export G_InitGame
+proc G_InitGame 1304 20
+ADDRGP4 $236
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $237
+ARGP4
+ADDRGP4 $60
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $238
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $239
+ARGP4
+ADDRGP4 $240
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 srand
+CALLV
+pop
+ADDRGP4 G_RegisterCvars
+CALLV
+pop
+ADDRGP4 G_ProcessIPBans
+CALLV
+pop
+ADDRGP4 G_InitMemory
+CALLV
+pop
+ADDRGP4 $241
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 91
+NEI4 $243
+ADDRGP4 PW_NONE
+CNSTI4 0
+ASGNI4
+ADDRGP4 PW_QUAD
+CNSTI4 4
+ASGNI4
+ADDRGP4 PW_BATTLESUIT
+CNSTI4 5
+ASGNI4
+ADDRGP4 PW_HASTE
+CNSTI4 6
+ASGNI4
+ADDRGP4 PW_INVIS
+CNSTI4 7
+ASGNI4
+ADDRGP4 PW_REGEN
+CNSTI4 8
+ASGNI4
+ADDRGP4 PW_FLIGHT
+CNSTI4 9
+ASGNI4
+ADDRGP4 PW_REDFLAG
+CNSTI4 1
+ASGNI4
+ADDRGP4 PW_BLUEFLAG
+CNSTI4 2
+ASGNI4
+ADDRGP4 PW_NEUTRALFLAG
+CNSTI4 3
+ASGNI4
+ADDRGP4 PW_INVULNERABILITY
+CNSTI4 10
+ASGNI4
+ADDRGP4 PW_SCOUT
+CNSTI4 11
+ASGNI4
+ADDRGP4 PW_GUARD
+CNSTI4 12
+ASGNI4
+ADDRGP4 PW_DOUBLER
+CNSTI4 13
+ASGNI4
+ADDRGP4 PW_ARMORREGEN
+CNSTI4 14
+ASGNI4
+ADDRGP4 PW_FROZEN
+CNSTI4 15
+ASGNI4
+ADDRGP4 PW_NUM_POWERUPS
+CNSTI4 16
+ASGNI4
+ADDRGP4 bg_itemlist
+ARGP4
+ADDRGP4 bg_itemlistQldm91
+ARGP4
+CNSTU4 52
+ADDRGP4 bg_numItemsQldm91
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 bg_numItems
+ADDRGP4 bg_numItemsQldm91
+INDIRI4
+ASGNI4
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRGP4 $245
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $244
+ADDRGP4 level
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 9296
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 level+32
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 level+40
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $249
+ARGP4
+ADDRLP4 268
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRGP4 level+348
+ADDRLP4 268
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 272
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRGP4 $250
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 276
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $136
+ARGP4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 16
+EQI4 $251
+ADDRGP4 g_logfile+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $251
+ADDRGP4 g_logfileSync+12
+INDIRI4
+CNSTI4 0
+EQI4 $255
+ADDRGP4 g_logfile+16
+ARGP4
+ADDRGP4 level+20
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRGP4 g_logfile+16
+ARGP4
+ADDRGP4 level+20
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $256
+ADDRGP4 level+20
+INDIRI4
+CNSTI4 0
+NEI4 $262
+ADDRGP4 $265
+ARGP4
+ADDRGP4 g_logfile+16
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $262
+ADDRLP4 280
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRGP4 $267
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $268
+ARGP4
+ADDRLP4 280
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRGP4 $269
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $252
+ADDRGP4 G_InitWorldSession
+CALLV
+pop
+ADDRGP4 g_entities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 888832
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 level+4
+ADDRGP4 g_entities
+ASGNP4
+ADDRGP4 level+24
+ADDRGP4 g_maxclients+12
+INDIRI4
+ASGNI4
+ADDRGP4 g_clients
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56832
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 level
+ADDRGP4 g_clients
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $273
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $274
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $276
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $273
+ADDRGP4 level+12
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $280
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+580
+ADDP4
+ADDRGP4 $285
+ASGNP4
+LABELV $281
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $280
+ADDRGP4 level+4
+INDIRP4
+ARGP4
+ADDRGP4 level+12
+INDIRI4
+ARGI4
+CNSTI4 868
+ARGI4
+ADDRGP4 level
+INDIRP4
+ARGP4
+CNSTI4 888
+ARGI4
+ADDRGP4 trap_LocateGameData
+CALLV
+pop
+ADDRGP4 InitBodyQue
+CALLV
+pop
+ADDRGP4 ClearRegisteredItems
+CALLV
+pop
+ADDRGP4 G_SpawnEntitiesFromString
+CALLV
+pop
+ADDRGP4 G_FindTeams
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $288
+ADDRGP4 G_CheckTeamItems
+CALLV
+pop
+LABELV $288
+ADDRGP4 SaveRegisteredItems
+CALLV
+pop
+ADDRGP4 $291
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 16
+EQI4 $296
+ADDRGP4 $295
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $292
+LABELV $296
+ADDRGP4 $297
+ARGP4
+ADDRGP4 G_ModelIndex
+CALLI4
+pop
+ADDRGP4 $298
+ARGP4
+ADDRGP4 G_SoundIndex
+CALLI4
+pop
+ADDRGP4 $299
+ARGP4
+ADDRGP4 G_SoundIndex
+CALLI4
+pop
+LABELV $292
+ADDRGP4 $302
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $300
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotAISetup
+CALLI4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotAILoadMap
+CALLI4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 G_InitBots
+CALLV
+pop
+LABELV $300
+ADDRGP4 G_RemapTeamShaders
+CALLV
+pop
+CNSTI4 14
+ARGI4
+ADDRGP4 $58
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $235
+endproc G_InitGame 1304 20
+export G_ShutdownGame
+proc G_ShutdownGame 4 4
+ADDRGP4 $304
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 level+20
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRGP4 $308
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $267
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+20
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 level+20
+CNSTI4 0
+ASGNI4
+LABELV $305
+ADDRGP4 G_WriteSessionData
+CALLV
+pop
+ADDRGP4 $302
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAIShutdown
+CALLI4
+pop
+LABELV $311
+LABELV $303
+endproc G_ShutdownGame 4 4
+export Com_Error
+proc Com_Error 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $313
+endproc Com_Error 1028 16
+export Com_Printf
+proc Com_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $315
+endproc Com_Printf 1028 16
+export AddTournamentPlayer
+proc AddTournamentPlayer 24 8
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+LTI4 $318
+ADDRGP4 $317
+JUMPV
+LABELV $318
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $321
+ADDRGP4 $317
+JUMPV
+LABELV $321
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $327
+JUMPV
+LABELV $324
+ADDRLP4 0
+CNSTI4 888
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $329
+ADDRGP4 $325
+JUMPV
+LABELV $329
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $331
+ADDRGP4 $325
+JUMPV
+LABELV $331
+ADDRLP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $335
+ADDRLP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $333
+LABELV $335
+ADDRGP4 $325
+JUMPV
+LABELV $333
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $338
+ADDRLP4 20
+CNSTI4 660
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $336
+LABELV $338
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $336
+LABELV $325
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $327
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $324
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $339
+ADDRGP4 $317
+JUMPV
+LABELV $339
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+CNSTI4 868
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 888
+DIVI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $317
+endproc AddTournamentPlayer 24 8
+export AddTournamentQueue
+proc AddTournamentQueue 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $347
+JUMPV
+LABELV $344
+ADDRLP4 0
+CNSTI4 888
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $349
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $351
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $353
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $353
+LABELV $352
+LABELV $349
+LABELV $345
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $347
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $344
+LABELV $343
+endproc AddTournamentQueue 12 0
+export RemoveTournamentLoser
+proc RemoveTournamentLoser 4 8
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+EQI4 $356
+ADDRGP4 $355
+JUMPV
+LABELV $356
+ADDRLP4 0
+ADDRGP4 level+84+4
+INDIRI4
+ASGNI4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $361
+ADDRGP4 $355
+JUMPV
+LABELV $361
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 $363
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $355
+endproc RemoveTournamentLoser 4 8
+export RemoveTournamentWinner
+proc RemoveTournamentWinner 4 8
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+EQI4 $365
+ADDRGP4 $364
+JUMPV
+LABELV $365
+ADDRLP4 0
+ADDRGP4 level+84
+INDIRI4
+ASGNI4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $369
+ADDRGP4 $364
+JUMPV
+LABELV $369
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 $363
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $364
+endproc RemoveTournamentWinner 4 8
+export AdjustTournamentScores
+proc AdjustTournamentScores 8 4
+ADDRLP4 0
+ADDRGP4 level+84
+INDIRI4
+ASGNI4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $373
+ADDRLP4 4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 672
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $373
+ADDRLP4 0
+ADDRGP4 level+84+4
+INDIRI4
+ASGNI4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $377
+ADDRLP4 4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 676
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $377
+LABELV $371
+endproc AdjustTournamentScores 8 4
+export SortRanks
+proc SortRanks 48 0
+ADDRLP4 8
+CNSTI4 888
+ASGNI4
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $382
+ADDRLP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $380
+LABELV $382
+CNSTI4 1
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $380
+ADDRLP4 4
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $385
+ADDRLP4 4
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $383
+LABELV $385
+CNSTI4 -1
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $383
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $386
+CNSTI4 1
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $386
+ADDRLP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $388
+CNSTI4 -1
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $388
+ADDRLP4 24
+CNSTI4 656
+ASGNI4
+ADDRLP4 28
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $390
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $390
+ADDRLP4 32
+CNSTI4 660
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $392
+CNSTI4 -1
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $392
+ADDRLP4 36
+CNSTI4 660
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $394
+CNSTI4 1
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $394
+CNSTI4 0
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $390
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $396
+CNSTI4 1
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $396
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $398
+CNSTI4 -1
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $398
+ADDRLP4 32
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 248
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+LEI4 $400
+CNSTI4 -1
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $400
+ADDRLP4 40
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 248
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+GEI4 $402
+CNSTI4 1
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $402
+CNSTI4 0
+RETI4
+LABELV $379
+endproc SortRanks 48 0
+export CalculateRanks
+proc CalculateRanks 44 16
+ADDRGP4 level+340
+CNSTI4 -1
+ASGNI4
+ADDRGP4 level+344
+CNSTI4 -1
+ASGNI4
+ADDRGP4 level+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+76
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+80
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+2420
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $414
+JUMPV
+LABELV $411
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4496
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $412
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $414
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 2
+LTU4 $411
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $418
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $423
+ADDRGP4 level+72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 level+72
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $428
+ADDRLP4 24
+ADDRGP4 level+76
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $431
+ADDRLP4 28
+ADDRGP4 level+80
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+236+244
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $434
+ADDRLP4 32
+ADDRGP4 level+2420
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $439
+ADDRLP4 36
+ADDRGP4 level+4496
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $439
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $442
+ADDRLP4 40
+ADDRGP4 level+4496+4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $442
+LABELV $440
+LABELV $434
+ADDRGP4 level+340
+INDIRI4
+CNSTI4 -1
+NEI4 $446
+ADDRGP4 level+340
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRGP4 level+344
+INDIRI4
+CNSTI4 -1
+NEI4 $450
+ADDRGP4 level+344
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $450
+LABELV $447
+LABELV $431
+LABELV $428
+LABELV $423
+LABELV $419
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $421
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $418
+ADDRGP4 level+84
+ARGP4
+ADDRGP4 level+72
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 4
+ARGU4
+ADDRGP4 SortRanks
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $457
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $463
+JUMPV
+LABELV $460
+ADDRLP4 4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+NEI4 $466
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_RANK
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $467
+JUMPV
+LABELV $466
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+LEI4 $472
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $473
+JUMPV
+LABELV $472
+ADDRGP4 PERS_RANK
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $473
+LABELV $467
+LABELV $461
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $463
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+72
+INDIRI4
+LTI4 $460
+ADDRGP4 $458
+JUMPV
+LABELV $457
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $481
+JUMPV
+LABELV $478
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 PERS_SCORE
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $486
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $484
+LABELV $486
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_RANK
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $485
+JUMPV
+LABELV $484
+ADDRLP4 28
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_RANK
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRGP4 level+84-4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_RANK
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $485
+ADDRLP4 16
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 16
+NEI4 $491
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 1
+NEI4 $491
+ADDRLP4 28
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_RANK
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $491
+LABELV $479
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $481
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+80
+INDIRI4
+LTI4 $478
+LABELV $458
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $496
+ADDRGP4 $250
+ARGP4
+ADDRGP4 level+44+4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $250
+ARGP4
+ADDRGP4 level+44+8
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRGP4 level+72
+INDIRI4
+CNSTI4 0
+NEI4 $503
+ADDRGP4 $250
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $250
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRGP4 level+72
+INDIRI4
+CNSTI4 1
+NEI4 $506
+ADDRGP4 $250
+ARGP4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 888
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $250
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRGP4 $250
+ARGP4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 888
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $250
+ARGP4
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 888
+ADDRGP4 level+84+4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $507
+LABELV $504
+LABELV $497
+ADDRGP4 CheckExitRules
+CALLV
+pop
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $513
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+LABELV $513
+LABELV $404
+endproc CalculateRanks 44 16
+export SendScoreboardMessageToAllClients
+proc SendScoreboardMessageToAllClients 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $520
+JUMPV
+LABELV $517
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $522
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 DeathmatchScoreboardMessage
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $524
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 DuelScores
+CALLV
+pop
+LABELV $524
+LABELV $522
+LABELV $518
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $520
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $517
+LABELV $516
+endproc SendScoreboardMessageToAllClients 4 4
+export MoveClientToIntermission
+proc MoveClientToIntermission 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $528
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 StopFollowing
+CALLV
+pop
+LABELV $528
+ADDRGP4 FindIntermissionPoint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRGP4 level+9144
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 level+9144
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRGP4 level+9156
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $527
+endproc MoveClientToIntermission 0 12
+export FindIntermissionPoint
+proc FindIntermissionPoint 32 16
+CNSTP4 0
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRGP4 $534
+ARGP4
+ADDRLP4 20
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $535
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 level+9144
+ARGP4
+ADDRGP4 level+9156
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 SelectSpawnPoint
+CALLP4
+pop
+ADDRGP4 $536
+JUMPV
+LABELV $535
+ADDRGP4 level+9144
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 level+9156
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $541
+ADDRLP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_PickTarget
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $543
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRGP4 level+9144
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 28
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDRGP4 level+9144+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDRGP4 level+9144+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 level+9156
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $543
+LABELV $541
+LABELV $536
+LABELV $533
+endproc FindIntermissionPoint 32 16
+export BeginIntermission
+proc BeginIntermission 8 4
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $554
+ADDRGP4 $553
+JUMPV
+LABELV $554
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $557
+ADDRGP4 AdjustTournamentScores
+CALLV
+pop
+LABELV $557
+ADDRGP4 level+9128
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $565
+JUMPV
+LABELV $562
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $567
+ADDRGP4 $563
+JUMPV
+LABELV $567
+ADDRLP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $569
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientRespawn
+CALLV
+pop
+LABELV $569
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MoveClientToIntermission
+CALLV
+pop
+LABELV $563
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $565
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $562
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 16
+NEI4 $571
+ADDRGP4 UpdateTournamentInfo
+CALLV
+pop
+ADDRGP4 SpawnModelsOnVictoryPads
+CALLV
+pop
+LABELV $571
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+LABELV $553
+endproc BeginIntermission 8 4
+export ExitLevel
+proc ExitLevel 2064 12
+ADDRGP4 BotInterbreedEndMatch
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $575
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 0
+NEI4 $574
+ADDRGP4 RemoveTournamentLoser
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $581
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9132
+CNSTP4 0
+ASGNP4
+ADDRGP4 level+9128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $574
+JUMPV
+LABELV $575
+ADDRGP4 $585
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $586
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $589
+ARGP4
+ADDRLP4 2056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+CNSTI4 0
+NEI4 $587
+ADDRLP4 1032
+ARGP4
+ADDRGP4 $58
+ARGP4
+ADDRLP4 2060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+EQI4 $587
+ADDRGP4 $585
+ARGP4
+ADDRGP4 $590
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $591
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $588
+JUMPV
+LABELV $587
+CNSTI4 2
+ARGI4
+ADDRGP4 $592
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $588
+ADDRGP4 level+9132
+CNSTP4 0
+ASGNP4
+ADDRGP4 level+9128
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+44+4
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+44+8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $602
+JUMPV
+LABELV $599
+ADDRLP4 4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $604
+ADDRGP4 $600
+JUMPV
+LABELV $604
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $600
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $602
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $599
+ADDRGP4 G_WriteSessionData
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $606
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $611
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $611
+LABELV $607
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $609
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $606
+LABELV $574
+endproc ExitLevel 2064 12
+export G_LogPrintf
+proc G_LogPrintf 1068 24
+ADDRLP4 1024
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 1044
+CNSTI4 60
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 1056
+CNSTI4 10
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $616
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 1028
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 0+7
+ARGP4
+CNSTU4 1017
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRGP4 g_dedicated+12
+INDIRI4
+CNSTI4 0
+EQI4 $619
+ADDRGP4 $622
+ARGP4
+ADDRLP4 0+7
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $619
+ADDRGP4 level+20
+INDIRI4
+CNSTI4 0
+NEI4 $624
+ADDRGP4 $613
+JUMPV
+LABELV $624
+ADDRLP4 0
+ARGP4
+ADDRLP4 1064
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1064
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 level+20
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $613
+endproc G_LogPrintf 1068 24
+export LogExit
+proc LogExit 28 20
+ADDRGP4 $629
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+9124
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+CNSTI4 14
+ARGI4
+ADDRGP4 $86
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LEI4 $633
+ADDRLP4 8
+CNSTI4 32
+ASGNI4
+LABELV $633
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $635
+ADDRGP4 $638
+ARGP4
+ADDRGP4 level+44+4
+INDIRI4
+ARGI4
+ADDRGP4 level+44+8
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $635
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $646
+JUMPV
+LABELV $643
+ADDRLP4 0
+CNSTI4 888
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $648
+ADDRGP4 $644
+JUMPV
+LABELV $648
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $650
+ADDRGP4 $644
+JUMPV
+LABELV $650
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+CNSTI4 999
+GEI4 $653
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $654
+JUMPV
+LABELV $653
+ADDRLP4 16
+CNSTI4 999
+ASGNI4
+LABELV $654
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $655
+ARGP4
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_SCORE
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $644
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $646
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $643
+LABELV $628
+endproc LogExit 28 20
+export CheckIntermissionExit
+proc CheckIntermissionExit 28 0
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 16
+NEI4 $658
+ADDRGP4 $657
+JUMPV
+LABELV $658
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $664
+JUMPV
+LABELV $661
+ADDRLP4 4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $666
+ADDRGP4 $662
+JUMPV
+LABELV $666
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+236+244
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $668
+ADDRGP4 $662
+JUMPV
+LABELV $668
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $672
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+GEI4 $673
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $673
+JUMPV
+LABELV $672
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $673
+LABELV $662
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $664
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $661
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $679
+JUMPV
+LABELV $676
+ADDRLP4 4
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $681
+ADDRGP4 $677
+JUMPV
+LABELV $681
+ADDRGP4 STAT_CLIENTS_READY
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $677
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $679
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $676
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 5000
+ADDI4
+GEI4 $683
+ADDRGP4 $657
+JUMPV
+LABELV $683
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $687
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $689
+ADDRGP4 level+9136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $657
+JUMPV
+LABELV $689
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $692
+ADDRGP4 ExitLevel
+CALLV
+pop
+ADDRGP4 $657
+JUMPV
+LABELV $692
+LABELV $687
+ADDRGP4 level+9136
+INDIRI4
+CNSTI4 0
+NEI4 $694
+ADDRGP4 level+9136
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9140
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $694
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9140
+INDIRI4
+CNSTI4 10000
+ADDI4
+GEI4 $700
+ADDRGP4 $657
+JUMPV
+LABELV $700
+ADDRGP4 ExitLevel
+CALLV
+pop
+LABELV $657
+endproc CheckIntermissionExit 28 0
+export ScoreIsTied
+proc ScoreIsTied 28 0
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+GEI4 $705
+CNSTI4 0
+RETI4
+ADDRGP4 $704
+JUMPV
+LABELV $705
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $708
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+NEI4 $716
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $717
+JUMPV
+LABELV $716
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $717
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $704
+JUMPV
+LABELV $708
+ADDRLP4 12
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 888
+ASGNI4
+ADDRLP4 20
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 248
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+84+4
+INDIRI4
+MULI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $722
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $723
+JUMPV
+LABELV $722
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $723
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $704
+endproc ScoreIsTied 28 0
+export CheckExitRules
+proc CheckExitRules 20 8
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $725
+ADDRGP4 CheckIntermissionExit
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $725
+ADDRGP4 level+9124
+INDIRI4
+CNSTI4 0
+EQI4 $728
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9124
+INDIRI4
+SUBI4
+CNSTI4 1000
+LTI4 $724
+ADDRGP4 level+9124
+CNSTI4 0
+ASGNI4
+ADDRGP4 BeginIntermission
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $728
+ADDRLP4 8
+ADDRGP4 ScoreIsTied
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $736
+ADDRGP4 $724
+JUMPV
+LABELV $736
+ADDRGP4 g_timelimit+12
+INDIRI4
+CNSTI4 0
+LTI4 $742
+ADDRGP4 g_timelimit+12
+INDIRI4
+CNSTI4 35791
+LEI4 $738
+LABELV $742
+ADDRGP4 $743
+ARGP4
+ADDRGP4 g_timelimit+12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $72
+ARGP4
+ADDRGP4 $64
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 g_timelimit
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $738
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_timelimit+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $745
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $745
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+SUBI4
+CNSTI4 60000
+ADDRGP4 g_timelimit+12
+INDIRI4
+MULI4
+LTI4 $749
+CNSTI4 -1
+ARGI4
+ADDRGP4 $754
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $755
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $749
+LABELV $745
+ADDRGP4 g_fraglimit+12
+INDIRI4
+CNSTI4 0
+GEI4 $756
+ADDRGP4 $759
+ARGP4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $70
+ARGP4
+ADDRGP4 $64
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 g_fraglimit
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $756
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+GEI4 $761
+ADDRGP4 g_fraglimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $761
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+LTI4 $765
+CNSTI4 -1
+ARGI4
+ADDRGP4 $770
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $771
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $765
+ADDRGP4 level+44+8
+INDIRI4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+LTI4 $772
+CNSTI4 -1
+ARGI4
+ADDRGP4 $777
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $771
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $772
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $781
+JUMPV
+LABELV $778
+ADDRLP4 0
+CNSTI4 888
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $783
+ADDRGP4 $779
+JUMPV
+LABELV $783
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $785
+ADDRGP4 $779
+JUMPV
+LABELV $785
+ADDRGP4 PERS_SCORE
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+LTI4 $787
+ADDRGP4 $771
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $790
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $787
+LABELV $779
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $781
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $778
+LABELV $761
+ADDRGP4 g_capturelimit+12
+INDIRI4
+CNSTI4 0
+GEI4 $791
+ADDRGP4 $794
+ARGP4
+ADDRGP4 g_capturelimit+12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $73
+ARGP4
+ADDRGP4 $64
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 g_capturelimit
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $791
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $796
+ADDRGP4 g_capturelimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $796
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 g_capturelimit+12
+INDIRI4
+LTI4 $800
+CNSTI4 -1
+ARGI4
+ADDRGP4 $805
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $806
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $800
+ADDRGP4 level+44+8
+INDIRI4
+ADDRGP4 g_capturelimit+12
+INDIRI4
+LTI4 $807
+CNSTI4 -1
+ARGI4
+ADDRGP4 $812
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $806
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+LABELV $807
+LABELV $796
+LABELV $724
+endproc CheckExitRules 20 8
+export CheckTournament
+proc CheckTournament 32 8
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 0
+NEI4 $814
+ADDRGP4 $813
+JUMPV
+LABELV $814
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $817
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+GEI4 $820
+ADDRGP4 AddTournamentPlayer
+CALLV
+pop
+LABELV $820
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+EQI4 $823
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 -1
+EQI4 $813
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $830
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $832
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $813
+JUMPV
+LABELV $823
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+NEI4 $833
+ADDRGP4 $813
+JUMPV
+LABELV $833
+ADDRGP4 g_warmup+4
+INDIRI4
+ADDRGP4 level+352
+INDIRI4
+EQI4 $836
+ADDRGP4 level+352
+ADDRGP4 g_warmup+4
+INDIRI4
+ASGNI4
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+LABELV $836
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+GEI4 $843
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+NEI4 $813
+ADDRGP4 g_warmup+12
+INDIRI4
+CNSTI4 1
+LEI4 $849
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+ADDRGP4 level+16
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_warmup+12
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $850
+JUMPV
+LABELV $849
+ADDRGP4 level+16
+CNSTI4 0
+ASGNI4
+LABELV $850
+ADDRGP4 $830
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $813
+JUMPV
+LABELV $843
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+16
+INDIRI4
+LEI4 $818
+ADDRLP4 0
+ADDRGP4 level+16
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+ADDRGP4 $63
+ARGP4
+ADDRGP4 $86
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $581
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $813
+JUMPV
+LABELV $817
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 16
+EQI4 $863
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $863
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $867
+CNSTI4 -1
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 4+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 4+4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $876
+ADDRLP4 4+8
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $868
+LABELV $876
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $868
+JUMPV
+LABELV $867
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+GEI4 $877
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $877
+LABELV $868
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $880
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 -1
+EQI4 $813
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $830
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $832
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $813
+JUMPV
+LABELV $880
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+NEI4 $887
+ADDRGP4 $813
+JUMPV
+LABELV $887
+ADDRGP4 g_warmup+4
+INDIRI4
+ADDRGP4 level+352
+INDIRI4
+EQI4 $890
+ADDRGP4 level+352
+ADDRGP4 g_warmup+4
+INDIRI4
+ASGNI4
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+LABELV $890
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+GEI4 $897
+ADDRGP4 g_warmup+12
+INDIRI4
+CNSTI4 1
+LEI4 $900
+ADDRLP4 20
+CNSTI4 1000
+ASGNI4
+ADDRGP4 level+16
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 g_warmup+12
+INDIRI4
+MULI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $901
+JUMPV
+LABELV $900
+ADDRGP4 level+16
+CNSTI4 0
+ASGNI4
+LABELV $901
+ADDRGP4 $830
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $813
+JUMPV
+LABELV $897
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+16
+INDIRI4
+LEI4 $908
+ADDRLP4 20
+ADDRGP4 level+16
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+ADDRGP4 $63
+ARGP4
+ADDRGP4 $86
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $581
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+LABELV $908
+LABELV $863
+LABELV $818
+LABELV $813
+endproc CheckTournament 32 8
+export CheckVote
+proc CheckVote 4 8
+ADDRGP4 level+2408
+INDIRI4
+CNSTI4 0
+EQI4 $915
+ADDRGP4 level+2408
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+GEI4 $915
+ADDRGP4 level+2408
+CNSTI4 0
+ASGNI4
+ADDRGP4 $921
+ARGP4
+ADDRGP4 level+356
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $915
+ADDRGP4 level+2404
+INDIRI4
+CNSTI4 0
+NEI4 $923
+ADDRGP4 $914
+JUMPV
+LABELV $923
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+2404
+INDIRI4
+SUBI4
+CNSTI4 30000
+LTI4 $926
+CNSTI4 -1
+ARGI4
+ADDRGP4 $930
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $927
+JUMPV
+LABELV $926
+ADDRGP4 level+2412
+INDIRI4
+ADDRGP4 level+2420
+INDIRI4
+CNSTI4 2
+DIVI4
+LEI4 $931
+CNSTI4 -1
+ARGI4
+ADDRGP4 $935
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 level+2408
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+ADDRGP4 $932
+JUMPV
+LABELV $931
+ADDRGP4 level+2416
+INDIRI4
+ADDRGP4 level+2420
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $914
+CNSTI4 -1
+ARGI4
+ADDRGP4 $930
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $939
+LABELV $932
+LABELV $927
+ADDRGP4 level+2404
+CNSTI4 0
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRGP4 $58
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $914
+endproc CheckVote 4 8
+export PrintTeam
+proc PrintTeam 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $947
+JUMPV
+LABELV $944
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $949
+ADDRGP4 $945
+JUMPV
+LABELV $949
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $945
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $947
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $944
+LABELV $943
+endproc PrintTeam 4 8
+export SetLeader
+proc SetLeader 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 888
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $952
+ADDRGP4 $954
+ARGP4
+CNSTI4 888
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintTeam
+CALLV
+pop
+ADDRGP4 $951
+JUMPV
+LABELV $952
+CNSTI4 888
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $955
+ADDRGP4 $957
+ARGP4
+CNSTI4 888
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintTeam
+CALLV
+pop
+ADDRGP4 $951
+JUMPV
+LABELV $955
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $961
+JUMPV
+LABELV $958
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $963
+ADDRGP4 $959
+JUMPV
+LABELV $963
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 680
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $965
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 680
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $965
+LABELV $959
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $961
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $958
+CNSTI4 888
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 680
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRGP4 $967
+ARGP4
+CNSTI4 888
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintTeam
+CALLV
+pop
+LABELV $951
+endproc SetLeader 8 8
+export CheckTeamLeader
+proc CheckTeamLeader 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $972
+JUMPV
+LABELV $969
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $974
+ADDRGP4 $970
+JUMPV
+LABELV $974
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 680
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $976
+ADDRGP4 $971
+JUMPV
+LABELV $976
+LABELV $970
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $972
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $969
+LABELV $971
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $978
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $984
+JUMPV
+LABELV $981
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $986
+ADDRGP4 $982
+JUMPV
+LABELV $986
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+236+244
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $988
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 680
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $983
+JUMPV
+LABELV $988
+LABELV $982
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $984
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $981
+LABELV $983
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $992
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $998
+JUMPV
+LABELV $995
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1000
+ADDRGP4 $996
+JUMPV
+LABELV $1000
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 680
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $997
+JUMPV
+LABELV $996
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $998
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $995
+LABELV $997
+LABELV $992
+LABELV $978
+LABELV $968
+endproc CheckTeamLeader 4 0
+export CheckTeamVote
+proc CheckTeamVote 20 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $1003
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1004
+JUMPV
+LABELV $1003
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1002
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1006
+LABELV $1004
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1007
+ADDRGP4 $1002
+JUMPV
+LABELV $1007
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4472
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 30000
+LTI4 $1010
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1014
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1011
+JUMPV
+LABELV $1010
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+4480
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+4496
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+LEI4 $1015
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1019
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1022
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2424
+ADDP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 12
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1020
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2424+7
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 SetLeader
+CALLV
+pop
+ADDRGP4 $1016
+JUMPV
+LABELV $1020
+ADDRGP4 $921
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2424
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $1016
+JUMPV
+LABELV $1015
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+4488
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+4496
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+LTI4 $1002
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1014
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1028
+LABELV $1016
+LABELV $1011
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 987
+ADDI4
+ARGI4
+ADDRGP4 $58
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $1002
+endproc CheckTeamVote 20 12
+data
+align 4
+LABELV $1033
+byte 4 -1
+export CheckCvars
+code
+proc CheckCvars 4 8
+ADDRGP4 g_password+4
+INDIRI4
+ADDRGP4 $1033
+INDIRI4
+EQI4 $1034
+ADDRGP4 $1033
+ADDRGP4 g_password+4
+INDIRI4
+ASGNI4
+ADDRGP4 g_password+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1038
+ADDRGP4 g_password+16
+ARGP4
+ADDRGP4 $1042
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1038
+ADDRGP4 $87
+ARGP4
+ADDRGP4 $86
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1039
+JUMPV
+LABELV $1038
+ADDRGP4 $87
+ARGP4
+ADDRGP4 $64
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1039
+LABELV $1034
+LABELV $1032
+endproc CheckCvars 4 8
+export G_RunThink
+proc G_RunThink 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $1044
+ADDRGP4 $1043
+JUMPV
+LABELV $1044
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $1046
+ADDRGP4 $1043
+JUMPV
+LABELV $1046
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1049
+ADDRGP4 $1051
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $1049
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1043
+endproc G_RunThink 8 4
+export G_RunFrame
+proc G_RunFrame 28 16
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 0
+EQI4 $1053
+ADDRGP4 $1052
+JUMPV
+LABELV $1053
+ADDRLP4 8
+ADDRGP4 level+28
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+36
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 level+32
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 G_UpdateCvars
+CALLV
+pop
+ADDRGP4 level+9216
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1060
+ADDRGP4 level+9292
+INDIRP4
+ARGP4
+ADDRGP4 level+9292
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 $1065
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+LABELV $1060
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1069
+JUMPV
+LABELV $1066
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1071
+ADDRGP4 $1067
+JUMPV
+LABELV $1071
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 300
+LEI4 $1073
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1076
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1078
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1078
+LABELV $1076
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1080
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $1067
+JUMPV
+LABELV $1080
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1082
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $1082
+LABELV $1073
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1084
+ADDRGP4 $1067
+JUMPV
+LABELV $1084
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1086
+ADDRLP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1086
+ADDRGP4 $1067
+JUMPV
+LABELV $1086
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1088
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunMissile
+CALLV
+pop
+ADDRGP4 $1067
+JUMPV
+LABELV $1088
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1092
+ADDRLP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1090
+LABELV $1092
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunItem
+CALLV
+pop
+ADDRGP4 $1067
+JUMPV
+LABELV $1090
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $1093
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunMover
+CALLV
+pop
+ADDRGP4 $1067
+JUMPV
+LABELV $1093
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $1095
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunClient
+CALLV
+pop
+ADDRGP4 $1067
+JUMPV
+LABELV $1095
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunThink
+CALLV
+pop
+LABELV $1067
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+LABELV $1069
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $1066
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1100
+JUMPV
+LABELV $1097
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1102
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientEndFrame
+CALLV
+pop
+LABELV $1102
+LABELV $1098
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+LABELV $1100
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1097
+ADDRGP4 CheckTournament
+CALLV
+pop
+ADDRGP4 CheckExitRules
+CALLV
+pop
+ADDRGP4 CheckTeamStatus
+CALLV
+pop
+ADDRGP4 CheckVote
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+ADDRGP4 CheckCvars
+CALLV
+pop
+ADDRGP4 g_listEntity+12
+INDIRI4
+CNSTI4 0
+EQI4 $1104
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1107
+ADDRGP4 $1111
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+580
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $1108
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $1107
+ADDRGP4 $113
+ARGP4
+ADDRGP4 $64
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1104
+LABELV $1052
+endproc G_RunFrame 28 16
+bss
+export g_listEntity
+align 4
+LABELV g_listEntity
+skip 272
+export g_podiumDrop
+align 4
+LABELV g_podiumDrop
+skip 272
+export g_podiumDist
+align 4
+LABELV g_podiumDist
+skip 272
+export g_logfileSync
+align 4
+LABELV g_logfileSync
+skip 272
+export g_logfile
+align 4
+LABELV g_logfile
+skip 272
+export g_clients
+align 4
+LABELV g_clients
+skip 56832
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+export g_debugPingValue
+align 4
+LABELV g_debugPingValue
+skip 272
+export g_weapon_plasma_speed
+align 4
+LABELV g_weapon_plasma_speed
+skip 272
+export g_weapon_rocket_speed
+align 4
+LABELV g_weapon_rocket_speed
+skip 272
+export g_levelStartTime
+align 4
+LABELV g_levelStartTime
+skip 272
+export g_localTeamPref
+align 4
+LABELV g_localTeamPref
+skip 272
+export g_proxMineTimeout
+align 4
+LABELV g_proxMineTimeout
+skip 272
+export g_singlePlayer
+align 4
+LABELV g_singlePlayer
+skip 272
+export g_enableBreath
+align 4
+LABELV g_enableBreath
+skip 272
+export g_enableDust
+align 4
+LABELV g_enableDust
+skip 272
+export g_rankings
+align 4
+LABELV g_rankings
+skip 272
+export pmove_msec
+align 4
+LABELV pmove_msec
+skip 272
+export pmove_fixed
+align 4
+LABELV pmove_fixed
+skip 272
+export g_smoothClients
+align 4
+LABELV g_smoothClients
+skip 272
+export g_blueteam
+align 4
+LABELV g_blueteam
+skip 272
+export g_redteam
+align 4
+LABELV g_redteam
+skip 272
+export g_cubeTimeout
+align 4
+LABELV g_cubeTimeout
+skip 272
+export g_obeliskRespawnDelay
+align 4
+LABELV g_obeliskRespawnDelay
+skip 272
+export g_obeliskRegenAmount
+align 4
+LABELV g_obeliskRegenAmount
+skip 272
+export g_obeliskRegenPeriod
+align 4
+LABELV g_obeliskRegenPeriod
+skip 272
+export g_obeliskHealth
+align 4
+LABELV g_obeliskHealth
+skip 272
+export g_filterBan
+align 4
+LABELV g_filterBan
+skip 272
+export g_banIPs
+align 4
+LABELV g_banIPs
+skip 272
+export g_teamForceBalance
+align 4
+LABELV g_teamForceBalance
+skip 272
+export g_teamAutoJoin
+align 4
+LABELV g_teamAutoJoin
+skip 272
+export g_allowVote
+align 4
+LABELV g_allowVote
+skip 272
+export g_blood
+align 4
+LABELV g_blood
+skip 272
+export g_doWarmup
+align 4
+LABELV g_doWarmup
+skip 272
+export g_warmup
+align 4
+LABELV g_warmup
+skip 272
+export g_motd
+align 4
+LABELV g_motd
+skip 272
+export g_synchronousClients
+align 4
+LABELV g_synchronousClients
+skip 272
+export g_weaponTeamRespawn
+align 4
+LABELV g_weaponTeamRespawn
+skip 272
+export g_weaponRespawn
+align 4
+LABELV g_weaponRespawn
+skip 272
+export g_debugDamage
+align 4
+LABELV g_debugDamage
+skip 272
+export g_debugAlloc
+align 4
+LABELV g_debugAlloc
+skip 272
+export g_debugMove
+align 4
+LABELV g_debugMove
+skip 272
+export g_inactivity
+align 4
+LABELV g_inactivity
+skip 272
+export g_forcerespawn
+align 4
+LABELV g_forcerespawn
+skip 272
+export g_quadfactor
+align 4
+LABELV g_quadfactor
+skip 272
+export g_knockback
+align 4
+LABELV g_knockback
+skip 272
+export g_speed
+align 4
+LABELV g_speed
+skip 272
+export g_gravity
+align 4
+LABELV g_gravity
+skip 272
+export g_needpass
+align 4
+LABELV g_needpass
+skip 272
+export g_password
+align 4
+LABELV g_password
+skip 272
+export g_friendlyFire
+align 4
+LABELV g_friendlyFire
+skip 272
+export g_capturelimit
+align 4
+LABELV g_capturelimit
+skip 272
+export g_timelimit
+align 4
+LABELV g_timelimit
+skip 272
+export g_fraglimit
+align 4
+LABELV g_fraglimit
+skip 272
+export g_dmflags
+align 4
+LABELV g_dmflags
+skip 272
+export g_restarted
+align 4
+LABELV g_restarted
+skip 272
+export g_maxGameClients
+align 4
+LABELV g_maxGameClients
+skip 272
+export g_maxclients
+align 4
+LABELV g_maxclients
+skip 272
+export g_cheats
+align 4
+LABELV g_cheats
+skip 272
+export g_dedicated
+align 4
+LABELV g_dedicated
+skip 272
+export g_gametype
+align 4
+LABELV g_gametype
+skip 272
+export g_entities
+align 4
+LABELV g_entities
+skip 888832
+export level
+align 4
+LABELV level
+skip 9296
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1111
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1065
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1051
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 45
+byte 1 62
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 0
+align 1
+LABELV $1042
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1022
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1019
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1014
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $967
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $957
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $954
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $935
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $930
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $921
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $832
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $830
+byte 1 92
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $812
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $806
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $805
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $794
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $790
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $777
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $771
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $770
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $759
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $755
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $754
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $743
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $655
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $638
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $629
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $622
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $616
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $592
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $591
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $590
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $589
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 48
+byte 1 0
+align 1
+LABELV $586
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $585
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $581
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $534
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $363
+byte 1 115
+byte 1 0
+align 1
+LABELV $342
+byte 1 102
+byte 1 0
+align 1
+LABELV $308
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $304
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 10
+byte 1 0
+align 1
+LABELV $302
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $299
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $298
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $297
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 52
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $295
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $291
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $285
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $269
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $268
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $267
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $265
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $250
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $249
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $245
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $242
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $241
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $240
+byte 1 49
+byte 1 50
+byte 1 46
+byte 1 48
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 50
+byte 1 54
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 49
+byte 1 54
+byte 1 52
+byte 1 97
+byte 1 50
+byte 1 55
+byte 1 51
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 50
+byte 1 54
+byte 1 45
+byte 1 49
+byte 1 48
+byte 1 45
+byte 1 49
+byte 1 56
+byte 1 0
+align 1
+LABELV $239
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $238
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $237
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $236
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 32
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $230
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $215
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $198
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $197
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $195
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $194
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 50
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $193
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 50
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $191
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $188
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $141
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $140
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $139
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $138
+byte 1 57
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $137
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $136
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $135
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $134
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $133
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $132
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $131
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $130
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $129
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $128
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 66
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $127
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 68
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $126
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $125
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $124
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $123
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $122
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $121
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 98
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $120
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $119
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $118
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $117
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 65
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $116
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $115
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $114
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $113
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $112
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $111
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $110
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 68
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $109
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $108
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $107
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $106
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 100
+byte 1 0
+align 1
+LABELV $105
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 0
+align 1
+LABELV $104
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $103
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $102
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $101
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $100
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $98
+byte 1 53
+byte 1 0
+align 1
+LABELV $97
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $96
+byte 1 51
+byte 1 0
+align 1
+LABELV $95
+byte 1 103
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $94
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $93
+byte 1 103
+byte 1 95
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $92
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $91
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $90
+byte 1 51
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $89
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $88
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $87
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $86
+byte 1 49
+byte 1 0
+align 1
+LABELV $85
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $84
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 0
+align 1
+LABELV $83
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $82
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $81
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $80
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $79
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $78
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $77
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $76
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $75
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $74
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $73
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $72
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $71
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $70
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $69
+byte 1 100
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $68
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $67
+byte 1 56
+byte 1 0
+align 1
+LABELV $66
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $65
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $64
+byte 1 48
+byte 1 0
+align 1
+LABELV $63
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $62
+byte 1 79
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 49
+byte 1 56
+byte 1 32
+byte 1 50
+byte 1 48
+byte 1 50
+byte 1 54
+byte 1 0
+align 1
+LABELV $61
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $60
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 0
+align 1
+LABELV $59
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $58
+byte 1 0
+align 1
+LABELV $57
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
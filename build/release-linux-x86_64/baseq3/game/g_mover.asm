@@ -0,0 +1,8709 @@
+export G_TestEntityPosition
+code
+proc G_TestEntityPosition 68 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $58
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $59
+JUMPV
+LABELV $58
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+LABELV $59
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $60
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRGP4 $61
+JUMPV
+LABELV $60
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+LABELV $61
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+EQI4 $62
+CNSTI4 868
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+RETP4
+ADDRGP4 $57
+JUMPV
+LABELV $62
+CNSTP4 0
+RETP4
+LABELV $57
+endproc G_TestEntityPosition 68 28
+export G_CreateRotationMatrix
+proc G_CreateRotationMatrix 4 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+LABELV $66
+endproc G_CreateRotationMatrix 4 16
+export G_TransposeMatrix
+proc G_TransposeMatrix 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $68
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $72
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $73
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $72
+LABELV $69
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $68
+LABELV $67
+endproc G_TransposeMatrix 24 0
+export G_RotatePoint
+proc G_RotatePoint 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $76
+endproc G_RotatePoint 28 0
+export G_TryPushingEntity
+proc G_TryPushingEntity 172 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $84
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+EQI4 $84
+CNSTI4 0
+RETI4
+ADDRGP4 $83
+JUMPV
+LABELV $84
+ADDRGP4 pushed_p
+INDIRP4
+CVPU4 4
+ADDRGP4 pushed+32768
+CVPU4 4
+LEU4 $86
+ADDRGP4 $89
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $86
+ADDRGP4 pushed_p
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $90
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $90
+ADDRLP4 116
+ADDRGP4 pushed_p
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 G_CreateRotationMatrix
+CALLV
+pop
+ADDRLP4 76
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 G_TransposeMatrix
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $92
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 120
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 120
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $93
+ADDRLP4 24
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 G_RotatePoint
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 124
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 136
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $106
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTF4 1199570944
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ADDI4
+ASGNI4
+LABELV $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+EQI4 $110
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 1023
+ASGNI4
+LABELV $110
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 G_TestEntityPosition
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $114
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $115
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $83
+JUMPV
+LABELV $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 -28
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $116
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 -28
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $116
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 -16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 G_TestEntityPosition
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRLP4 152
+ADDRGP4 pushed_p
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRP4
+CNSTI4 -32
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $83
+JUMPV
+LABELV $118
+CNSTI4 0
+RETI4
+LABELV $83
+endproc G_TryPushingEntity 172 8
+export G_CheckProxMinePosition
+proc G_CheckProxMinePosition 108 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 84
+CNSTF4 1040187392
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 1040187392
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 104
+CNSTP4 0
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 24+4
+INDIRI4
+CNSTI4 0
+NEI4 $129
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $125
+LABELV $129
+CNSTI4 0
+RETI4
+ADDRGP4 $120
+JUMPV
+LABELV $125
+CNSTI4 1
+RETI4
+LABELV $120
+endproc G_CheckProxMinePosition 108 28
+export G_TryPushingProxMine
+proc G_TryPushingProxMine 124 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 100
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 0
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 60+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 60+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 G_CheckProxMinePosition
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $159
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $159
+ADDRLP4 72
+INDIRI4
+RETI4
+LABELV $130
+endproc G_TryPushingProxMine 124 16
+export G_MoverPush
+proc G_MoverPush 4240 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4168
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+NEF4 $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+NEF4 $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+NEF4 $168
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+NEF4 $168
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+NEF4 $168
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+EQF4 $162
+LABELV $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ARGP4
+ADDRLP4 4184
+ADDRGP4 RadiusFromBounds
+CALLF4
+ASGNF4
+ADDRLP4 4176
+ADDRLP4 4184
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $169
+ADDRLP4 4188
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4188
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 4188
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4188
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 4176
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4192
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4192
+INDIRI4
+ADDRLP4 28
+ADDP4
+ADDRLP4 4192
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4192
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 4176
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4196
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4196
+INDIRI4
+ADDRLP4 4140
+ADDP4
+ADDRLP4 4196
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRF4
+ADDRLP4 4196
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4200
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4200
+INDIRI4
+ADDRLP4 4152
+ADDP4
+ADDRLP4 4200
+INDIRI4
+ADDRLP4 28
+ADDP4
+INDIRF4
+ADDRLP4 4200
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $170
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $169
+ADDRGP4 $163
+JUMPV
+LABELV $162
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $173
+ADDRLP4 4176
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4180
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 28
+ADDP4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $174
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $173
+ADDRLP4 4140
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4152
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $177
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $181
+ADDRLP4 4180
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4184
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 4152
+ADDP4
+ASGNP4
+ADDRLP4 4184
+INDIRP4
+ADDRLP4 4184
+INDIRP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 4180
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4184
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 4140
+ADDP4
+ASGNP4
+ADDRLP4 4184
+INDIRP4
+ADDRLP4 4184
+INDIRP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $182
+LABELV $178
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $177
+LABELV $163
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRLP4 4140
+ARGP4
+ADDRLP4 4152
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4176
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 4136
+ADDRLP4 4176
+INDIRI4
+ASGNI4
+ADDRLP4 4180
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ASGNP4
+ADDRLP4 4180
+INDIRP4
+ADDRLP4 4180
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4184
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ASGNP4
+ADDRLP4 4184
+INDIRP4
+ADDRLP4 4184
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4188
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ASGNP4
+ADDRLP4 4188
+INDIRP4
+ADDRLP4 4188
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4192
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ASGNP4
+ADDRLP4 4192
+INDIRP4
+ADDRLP4 4192
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4196
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+ASGNP4
+ADDRLP4 4196
+INDIRP4
+ADDRLP4 4196
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4200
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ASGNP4
+ADDRLP4 4200
+INDIRP4
+ADDRLP4 4200
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $186
+JUMPV
+LABELV $183
+ADDRLP4 8
+CNSTI4 868
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $187
+ADDRLP4 8
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $191
+ARGP4
+ADDRLP4 4204
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4204
+INDIRI4
+CNSTI4 0
+NEI4 $189
+ADDRLP4 8
+INDIRP4
+CNSTI4 820
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $192
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4208
+ADDRGP4 G_TryPushingProxMine
+CALLI4
+ASGNI4
+ADDRLP4 4208
+INDIRI4
+CNSTI4 0
+NEI4 $184
+ADDRLP4 8
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 66
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_ExplodeMissile
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $184
+ADDRLP4 8
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 824
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $184
+JUMPV
+LABELV $192
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4208
+ADDRGP4 G_CheckProxMinePosition
+CALLI4
+ASGNI4
+ADDRLP4 4208
+INDIRI4
+CNSTI4 0
+NEI4 $184
+ADDRLP4 8
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 66
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_ExplodeMissile
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $184
+ADDRLP4 8
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 824
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $184
+JUMPV
+LABELV $189
+LABELV $187
+ADDRLP4 4208
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4208
+INDIRI4
+CNSTI4 2
+EQI4 $202
+ADDRLP4 4208
+INDIRI4
+CNSTI4 1
+EQI4 $202
+ADDRLP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $202
+ADDRGP4 $184
+JUMPV
+LABELV $202
+ADDRLP4 8
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+EQI4 $204
+ADDRLP4 8
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+GEF4 $216
+ADDRLP4 8
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+GEF4 $216
+ADDRLP4 8
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+GEF4 $216
+ADDRLP4 8
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $216
+ADDRLP4 8
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+LEF4 $216
+ADDRLP4 8
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+GTF4 $206
+LABELV $216
+ADDRGP4 $184
+JUMPV
+LABELV $206
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4216
+ADDRGP4 G_TestEntityPosition
+CALLP4
+ASGNP4
+ADDRLP4 4216
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $217
+ADDRGP4 $184
+JUMPV
+LABELV $217
+LABELV $204
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4212
+ADDRGP4 G_TryPushingEntity
+CALLI4
+ASGNI4
+ADDRLP4 4212
+INDIRI4
+CNSTI4 0
+EQI4 $219
+ADDRGP4 $184
+JUMPV
+LABELV $219
+ADDRLP4 4220
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4220
+INDIRI4
+EQI4 $223
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRLP4 4220
+INDIRI4
+NEI4 $221
+LABELV $223
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4228
+CNSTP4 0
+ASGNP4
+ADDRLP4 4228
+INDIRP4
+ARGP4
+ADDRLP4 4228
+INDIRP4
+ARGP4
+CNSTI4 99999
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 17
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $184
+JUMPV
+LABELV $221
+ADDRFP4 12
+INDIRP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 -32
+ADDP4
+ASGNP4
+ADDRGP4 $227
+JUMPV
+LABELV $224
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $228
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $228
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $225
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -32
+ADDP4
+ASGNP4
+LABELV $227
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 pushed
+CVPU4 4
+GEU4 $224
+CNSTI4 0
+RETI4
+ADDRGP4 $161
+JUMPV
+LABELV $184
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $186
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4136
+INDIRI4
+LTI4 $183
+CNSTI4 1
+RETI4
+LABELV $161
+endproc G_MoverPush 4240 32
+export G_MoverTeam
+proc G_MoverTeam 72 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+CNSTP4 0
+ASGNP4
+ADDRGP4 pushed_p
+ADDRGP4 pushed
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $234
+JUMPV
+LABELV $231
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 64
+ADDRGP4 G_MoverPush
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $245
+ADDRGP4 $233
+JUMPV
+LABELV $245
+LABELV $232
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $234
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $231
+LABELV $233
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $247
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $252
+JUMPV
+LABELV $249
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+36
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+36
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $250
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $252
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $249
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $230
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $230
+JUMPV
+LABELV $247
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $264
+JUMPV
+LABELV $261
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $265
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+LTI4 $267
+ADDRLP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $270
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $270
+LABELV $267
+LABELV $265
+LABELV $262
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $264
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $261
+LABELV $230
+endproc G_MoverTeam 72 16
+export G_RunMover
+proc G_RunMover 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $273
+ADDRGP4 $272
+JUMPV
+LABELV $273
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $277
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $275
+LABELV $277
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_MoverTeam
+CALLV
+pop
+LABELV $275
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunThink
+CALLV
+pop
+LABELV $272
+endproc G_RunMover 8 4
+export SetMoverState
+proc SetMoverState 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $279
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+GTI4 $279
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $294
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $294
+address $282
+address $283
+address $284
+address $289
+code
+LABELV $282
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $280
+JUMPV
+LABELV $283
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $280
+JUMPV
+LABELV $284
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1148846080
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $280
+JUMPV
+LABELV $289
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1148846080
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $279
+LABELV $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $278
+endproc SetMoverState 64 12
+export MatchTeam
+proc MatchTeam 4 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $300
+JUMPV
+LABELV $297
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 SetMoverState
+CALLV
+pop
+LABELV $298
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $300
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $297
+LABELV $296
+endproc MatchTeam 4 12
+export ReturnToPos1
+proc ReturnToPos1 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRGP4 MatchTeam
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $303
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 42
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+LABELV $303
+LABELV $301
+endproc ReturnToPos1 8 12
+export Reached_BinaryMover
+proc Reached_BinaryMover 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $306
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRGP4 SetMoverState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $309
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 42
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+LABELV $309
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 ReturnToPos1
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 856
+ADDP4
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_UseTargets
+CALLV
+pop
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $314
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRGP4 SetMoverState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $317
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 42
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+LABELV $317
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $321
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+NEU4 $315
+LABELV $321
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_AdjustAreaPortalState
+CALLV
+pop
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRGP4 $322
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $315
+LABELV $307
+LABELV $305
+endproc Reached_BinaryMover 12 12
+export Use_BinaryMover
+proc Use_BinaryMover 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Use_BinaryMover
+CALLV
+pop
+ADDRGP4 $323
+JUMPV
+LABELV $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $326
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 50
+ADDI4
+ARGI4
+ADDRGP4 MatchTeam
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 42
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+LABELV $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 16
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $333
+ADDRLP4 16
+INDIRU4
+CNSTU4 0
+NEU4 $323
+LABELV $333
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_AdjustAreaPortalState
+CALLV
+pop
+ADDRGP4 $323
+JUMPV
+LABELV $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $334
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 856
+ADDP4
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $323
+JUMPV
+LABELV $334
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $337
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $340
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $340
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+SUBI4
+ARGI4
+ADDRGP4 MatchTeam
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $323
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 42
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $323
+JUMPV
+LABELV $337
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $345
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $348
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $348
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+SUBI4
+ARGI4
+ADDRGP4 MatchTeam
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $323
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 42
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+LABELV $345
+LABELV $323
+endproc Use_BinaryMover 20 12
+export InitMover
+proc InitMover 100 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $354
+ADDRGP4 $358
+ARGP4
+ADDRGP4 $359
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 44
+ADDRGP4 G_SpawnString
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $356
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $356
+ADDRGP4 $360
+ARGP4
+ADDRGP4 $359
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ADDRGP4 G_SpawnFloat
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $361
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 52
+ADDRGP4 G_SpawnVector
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $365
+ADDRLP4 32
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $363
+LABELV $365
+ADDRLP4 60
+CNSTF4 1132396544
+ADDRLP4 12
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 255
+LEI4 $366
+ADDRLP4 60
+CNSTI4 255
+ASGNI4
+LABELV $366
+ADDRLP4 64
+CNSTF4 1132396544
+ADDRLP4 12+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 255
+LEI4 $369
+ADDRLP4 64
+CNSTI4 255
+ASGNI4
+LABELV $369
+ADDRLP4 68
+CNSTF4 1132396544
+ADDRLP4 12+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 255
+LEI4 $372
+ADDRLP4 68
+CNSTI4 255
+ASGNI4
+LABELV $372
+ADDRLP4 72
+ADDRLP4 36
+INDIRF4
+CNSTF4 1082130432
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 255
+LEI4 $374
+ADDRLP4 72
+CNSTI4 255
+ASGNI4
+LABELV $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+LABELV $363
+LABELV $364
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDRGP4 Use_BinaryMover
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+ADDRGP4 Reached_BinaryMover
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+LABELV $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $382
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $382
+LABELV $353
+endproc InitMover 100 12
+export Blocked_Door
+proc Blocked_Door 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $385
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $387
+ADDRFP4 4
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $387
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Team_DroppedFlagThink
+CALLV
+pop
+ADDRGP4 $384
+JUMPV
+LABELV $387
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+CNSTI4 38
+ARGI4
+ADDRGP4 G_TempEntity
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $384
+JUMPV
+LABELV $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $389
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 17
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $391
+ADDRGP4 $384
+JUMPV
+LABELV $391
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Use_BinaryMover
+CALLV
+pop
+LABELV $384
+endproc Blocked_Door 8 32
+proc Touch_DoorTriggerSpectator 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 32
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LTF4 $396
+ADDRLP4 36
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LEF4 $394
+LABELV $396
+ADDRGP4 $393
+JUMPV
+LABELV $394
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+GEF4 $397
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+ASGNF4
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $398
+CNSTF4 1259902592
+ARGF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 tv
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 TeleportPlayer
+CALLV
+pop
+LABELV $393
+endproc Touch_DoorTriggerSpectator 56 12
+export Touch_DoorTrigger
+proc Touch_DoorTrigger 8 12
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $400
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $400
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $401
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $401
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Touch_DoorTriggerSpectator
+CALLV
+pop
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $404
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Use_BinaryMover
+CALLV
+pop
+LABELV $404
+LABELV $401
+LABELV $399
+endproc Touch_DoorTrigger 8 12
+export Think_SpawnNewDoorTrigger
+proc Think_SpawnNewDoorTrigger 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $407
+ADDRGP4 $409
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $406
+JUMPV
+LABELV $407
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $413
+JUMPV
+LABELV $410
+ADDRLP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $411
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $413
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $410
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $417
+JUMPV
+LABELV $414
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 AddPointToBounds
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 AddPointToBounds
+CALLV
+pop
+LABELV $415
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $417
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $414
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $418
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRLP4 44
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 32
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+SUBF4
+GEF4 $422
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $422
+LABELV $419
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $418
+ADDRLP4 40
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+CNSTF4 1123024896
+SUBF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 $424
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 1073741824
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+ADDRGP4 Touch_DoorTrigger
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRGP4 MatchTeam
+CALLV
+pop
+LABELV $406
+endproc Think_SpawnNewDoorTrigger 56 12
+export Think_MatchTeam
+proc Think_MatchTeam 4 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRGP4 MatchTeam
+CALLV
+pop
+LABELV $426
+endproc Think_MatchTeam 4 12
+export SP_func_door
+proc SP_func_door 116 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $429
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $430
+ARGP4
+ADDRLP4 40
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+ADDRGP4 Blocked_Door
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+CNSTF4 1137180672
+ASGNF4
+LABELV $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 856
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 856
+ADDP4
+CNSTF4 1073741824
+ASGNF4
+LABELV $433
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 856
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTF4 1148846080
+ADDRLP4 48
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $435
+ARGP4
+ADDRGP4 $436
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRGP4 $437
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ARGP4
+ADDRGP4 G_SetMovedir
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $447
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 112
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 112
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRLP4 96
+INDIRB
+ASGNB 12
+LABELV $447
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+NEI4 $450
+ADDRGP4 $452
+ARGP4
+ADDRGP4 $453
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $458
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $456
+LABELV $458
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 Think_MatchTeam
+ASGNP4
+ADDRGP4 $457
+JUMPV
+LABELV $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 Think_SpawnNewDoorTrigger
+ASGNP4
+LABELV $457
+LABELV $450
+LABELV $428
+endproc SP_func_door 116 12
+export Touch_Plat
+proc Touch_Plat 4 0
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $462
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $460
+LABELV $462
+ADDRGP4 $459
+JUMPV
+LABELV $460
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $463
+LABELV $459
+endproc Touch_Plat 4 0
+export Touch_PlatCenterTrigger
+proc Touch_PlatCenterTrigger 4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $467
+ADDRGP4 $466
+JUMPV
+LABELV $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $469
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Use_BinaryMover
+CALLV
+pop
+LABELV $469
+LABELV $466
+endproc Touch_PlatCenterTrigger 4 12
+export SpawnPlatTrigger
+proc SpawnPlatTrigger 60 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 $472
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+ADDRGP4 Touch_PlatCenterTrigger
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 1073741824
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 1107558400
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1107558400
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GTF4 $477
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $477
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+GTF4 $479
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $479
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $471
+endproc SpawnPlatTrigger 60 4
+export SP_func_plat
+proc SP_func_plat 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $487
+ARGP4
+ADDRLP4 8
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $488
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 $489
+ARGP4
+ADDRGP4 $490
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRGP4 $437
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRGP4 $491
+ARGP4
+ADDRGP4 $492
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 856
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRGP4 $435
+ARGP4
+ADDRGP4 $436
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 856
+ADDP4
+CNSTF4 1148846080
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRGP4 $495
+ARGP4
+ADDRGP4 $453
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 G_SpawnFloat
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $493
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $493
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+ADDRGP4 Touch_Plat
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+ADDRGP4 Blocked_Door
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $496
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SpawnPlatTrigger
+CALLV
+pop
+LABELV $496
+LABELV $486
+endproc SP_func_plat 56 12
+export Touch_Button
+proc Touch_Button 4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $499
+ADDRGP4 $498
+JUMPV
+LABELV $499
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $501
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Use_BinaryMover
+CALLV
+pop
+LABELV $501
+LABELV $498
+endproc Touch_Button 4 12
+export SP_func_button
+proc SP_func_button 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $504
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $505
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+LABELV $505
+ADDRFP4 0
+INDIRP4
+CNSTI4 856
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $507
+ADDRFP4 0
+INDIRP4
+CNSTI4 856
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $507
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 856
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTF4 1148846080
+ADDRLP4 36
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRGP4 $435
+ARGP4
+ADDRGP4 $509
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ARGP4
+ADDRGP4 G_SetMovedir
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $518
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+ADDRGP4 Touch_Button
+ASGNP4
+LABELV $519
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+LABELV $503
+endproc SP_func_button 84 12
+export Think_BeginMoving
+proc Think_BeginMoving 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $520
+endproc Think_BeginMoving 0 0
+export Reached_Train
+proc Reached_Train 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRU4
+EQU4 $525
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRU4
+NEU4 $523
+LABELV $525
+ADDRGP4 $522
+JUMPV
+LABELV $523
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 G_UseTargets
+CALLV
+pop
+ADDRLP4 32
+CNSTI4 660
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $526
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $527
+JUMPV
+LABELV $526
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $527
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+GEF4 $528
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $528
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+GEI4 $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRGP4 SetMoverState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 856
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $535
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 0
+INDIRP4
+CNSTI4 856
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 Think_BeginMoving
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $535
+LABELV $522
+endproc Reached_Train 56 12
+export Think_SetupTrainTargets
+proc Think_SetupTrainTargets 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTP4 0
+ARGP4
+CNSTI4 704
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $539
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $541
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $538
+JUMPV
+LABELV $539
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $545
+JUMPV
+LABELV $542
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $546
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $546
+ADDRLP4 4
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $548
+ADDRLP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $550
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $538
+JUMPV
+LABELV $548
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+LABELV $551
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 704
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $554
+ADDRLP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $556
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $538
+JUMPV
+LABELV $554
+LABELV $552
+ADDRLP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $557
+ARGP4
+ADDRLP4 20
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $551
+ADDRLP4 4
+INDIRP4
+CNSTI4 660
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $543
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $545
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+NEU4 $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Reached_Train
+CALLV
+pop
+LABELV $538
+endproc Think_SetupTrainTargets 28 12
+export SP_path_corner
+proc SP_path_corner 4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $559
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $561
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+LABELV $559
+LABELV $558
+endproc SP_path_corner 4 8
+export SP_func_train
+proc SP_func_train 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $563
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $564
+JUMPV
+LABELV $563
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $565
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $565
+LABELV $564
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $567
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+LABELV $567
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $569
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $562
+JUMPV
+LABELV $569
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+ADDRGP4 Reached_Train
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 Think_SetupTrainTargets
+ASGNP4
+LABELV $562
+endproc SP_func_train 12 8
+export SP_func_static
+proc SP_func_static 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $573
+endproc SP_func_static 12 8
+export SP_func_rotating
+proc SP_func_rotating 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+LABELV $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $577
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $579
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $580
+JUMPV
+LABELV $579
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $580
+LABELV $578
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $581
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $581
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $574
+endproc SP_func_rotating 16 8
+export SP_func_bobbing
+proc SP_func_bobbing 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $489
+ARGP4
+ADDRGP4 $509
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRGP4 $495
+ARGP4
+ADDRGP4 $584
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRGP4 $437
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRGP4 $585
+ARGP4
+ADDRGP4 $453
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1148846080
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $586
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $588
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 $589
+JUMPV
+LABELV $588
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+LABELV $589
+LABELV $587
+LABELV $583
+endproc SP_func_bobbing 28 12
+export SP_func_pendulum
+proc SP_func_pendulum 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $489
+ARGP4
+ADDRGP4 $591
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRGP4 $437
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRGP4 $585
+ARGP4
+ADDRGP4 $453
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1090519040
+GEF4 $592
+ADDRLP4 0
+CNSTF4 1090519040
+ASGNF4
+LABELV $592
+ADDRGP4 g_gravity+8
+INDIRF4
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+DIVF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1042479491
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $590
+endproc SP_func_pendulum 44 12
+import G_ExplodeMissile
+bss
+export pushed_p
+align 4
+LABELV pushed_p
+skip 4
+export pushed
+align 4
+LABELV pushed
+skip 32768
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $591
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $585
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $584
+byte 1 51
+byte 1 50
+byte 1 0
+align 1
+LABELV $571
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $561
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $557
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $556
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $550
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $541
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $509
+byte 1 52
+byte 1 0
+align 1
+LABELV $504
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 110
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $495
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $492
+byte 1 49
+byte 1 0
+align 1
+LABELV $491
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $490
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $489
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $488
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $487
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $472
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $453
+byte 1 48
+byte 1 0
+align 1
+LABELV $452
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $438
+byte 1 50
+byte 1 0
+align 1
+LABELV $437
+byte 1 100
+byte 1 109
+byte 1 103
+byte 1 0
+align 1
+LABELV $436
+byte 1 56
+byte 1 0
+align 1
+LABELV $435
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $430
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 114
+byte 1 49
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $429
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 114
+byte 1 49
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $424
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $409
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 95
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $362
+byte 1 49
+byte 1 32
+byte 1 49
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $361
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $360
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $359
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $358
+byte 1 110
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $322
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 66
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $191
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $89
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 32
+byte 1 62
+byte 1 32
+byte 1 38
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 91
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 73
+byte 1 69
+byte 1 83
+byte 1 93
+byte 1 0
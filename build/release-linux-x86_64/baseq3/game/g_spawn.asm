@@ -0,0 +1,4740 @@
+export G_SpawnString
+code
+proc G_SpawnString 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 level+4504
+INDIRI4
+CNSTI4 0
+NEI4 $57
+ADDRFP4 8
+INDIRP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $57
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $63
+JUMPV
+LABELV $60
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 level+4512
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $65
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 level+4512+4
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $56
+JUMPV
+LABELV $65
+LABELV $61
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $63
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+4508
+INDIRI4
+LTI4 $60
+ADDRFP4 8
+INDIRP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 0
+RETI4
+LABELV $56
+endproc G_SpawnString 8 8
+export G_SpawnFloat
+proc G_SpawnFloat 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 G_SpawnString
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $70
+endproc G_SpawnFloat 16 12
+export G_SpawnInt
+proc G_SpawnInt 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 G_SpawnString
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $71
+endproc G_SpawnInt 16 12
+export G_SpawnVector
+proc G_SpawnVector 16 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 G_SpawnString
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $73
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $72
+endproc G_SpawnVector 16 20
+data
+export fields
+align 4
+LABELV fields
+address $76
+byte 4 580
+byte 4 2
+address $77
+byte 4 100
+byte 4 3
+address $78
+byte 4 596
+byte 4 2
+address $79
+byte 4 600
+byte 4 2
+address $80
+byte 4 584
+byte 4 0
+address $81
+byte 4 724
+byte 4 1
+address $82
+byte 4 700
+byte 4 2
+address $83
+byte 4 704
+byte 4 2
+address $84
+byte 4 692
+byte 4 2
+address $85
+byte 4 708
+byte 4 2
+address $86
+byte 4 856
+byte 4 1
+address $87
+byte 4 860
+byte 4 1
+address $88
+byte 4 812
+byte 4 0
+address $89
+byte 4 784
+byte 4 0
+address $90
+byte 4 792
+byte 4 0
+address $91
+byte 4 124
+byte 4 3
+address $92
+byte 4 124
+byte 4 4
+address $93
+byte 4 712
+byte 4 2
+address $94
+byte 4 716
+byte 4 2
+byte 4 0
+skip 8
+export SP_item_botroam
+code
+proc SP_item_botroam 0 0
+LABELV $96
+endproc SP_item_botroam 0 0
+export SP_ignore
+proc SP_ignore 0 0
+LABELV $97
+endproc SP_ignore 0 0
+data
+export spawns
+align 4
+LABELV spawns
+address $98
+address SP_info_player_start
+address $99
+address SP_info_player_deathmatch
+address $100
+address SP_info_player_intermission
+address $101
+address SP_info_null
+address $102
+address SP_info_notnull
+address $103
+address SP_info_camp
+address $104
+address SP_func_plat
+address $105
+address SP_func_button
+address $106
+address SP_func_door
+address $107
+address SP_func_static
+address $108
+address SP_func_rotating
+address $109
+address SP_func_bobbing
+address $110
+address SP_func_pendulum
+address $111
+address SP_func_train
+address $112
+address SP_info_null
+address $113
+address SP_func_timer
+address $114
+address SP_trigger_always
+address $115
+address SP_trigger_multiple
+address $116
+address SP_trigger_push
+address $117
+address SP_trigger_teleport
+address $118
+address SP_trigger_hurt
+address $119
+address SP_target_give
+address $120
+address SP_target_remove_powerups
+address $121
+address SP_target_delay
+address $122
+address SP_target_speaker
+address $123
+address SP_target_print
+address $124
+address SP_target_laser
+address $125
+address SP_target_score
+address $126
+address SP_target_teleporter
+address $127
+address SP_target_relay
+address $128
+address SP_target_kill
+address $129
+address SP_target_position
+address $130
+address SP_target_location
+address $131
+address SP_target_push
+address $132
+address SP_light
+address $133
+address SP_path_corner
+address $134
+address SP_misc_teleporter_dest
+address $135
+address SP_misc_model
+address $136
+address SP_misc_portal_surface
+address $137
+address SP_misc_portal_camera
+address $138
+address SP_shooter_rocket
+address $139
+address SP_shooter_grenade
+address $140
+address SP_shooter_plasma
+address $141
+address SP_team_CTF_redplayer
+address $142
+address SP_team_CTF_blueplayer
+address $143
+address SP_team_CTF_redspawn
+address $144
+address SP_team_CTF_bluespawn
+address $145
+address SP_item_botroam
+address $146
+address SP_ignore
+byte 4 0
+byte 4 0
+export G_CallSpawn
+code
+proc G_CallSpawn 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $148
+ADDRGP4 $150
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $147
+JUMPV
+LABELV $148
+ADDRLP4 4
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $154
+JUMPV
+LABELV $151
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $156
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_SpawnItem
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $147
+JUMPV
+LABELV $156
+LABELV $152
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $154
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $151
+ADDRLP4 0
+ADDRGP4 spawns
+ASGNP4
+ADDRGP4 $161
+JUMPV
+LABELV $158
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $162
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $147
+JUMPV
+LABELV $162
+LABELV $159
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+LABELV $161
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $158
+ADDRGP4 $164
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $147
+endproc G_CallSpawn 12 8
+export G_NewString
+proc G_NewString 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 16
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $166
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $170
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $170
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 110
+NEI4 $172
+ADDRLP4 28
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI1 10
+ASGNI1
+ADDRGP4 $171
+JUMPV
+LABELV $172
+ADDRLP4 28
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI1 92
+ASGNI1
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRLP4 28
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $171
+LABELV $167
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $169
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $166
+ADDRLP4 12
+INDIRP4
+RETP4
+LABELV $165
+endproc G_NewString 32 4
+export G_ParseField
+proc G_ParseField 60 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 fields
+ASGNP4
+ADDRGP4 $178
+JUMPV
+LABELV $175
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $179
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LTI4 $174
+ADDRLP4 28
+INDIRI4
+CNSTI4 4
+GTI4 $174
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $193
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $193
+address $190
+address $191
+address $184
+address $185
+address $192
+code
+LABELV $184
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 G_NewString
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $174
+JUMPV
+LABELV $185
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $73
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 8+4
+ARGP4
+ADDRLP4 8+8
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRLP4 8+4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8+8
+INDIRF4
+ASGNF4
+ADDRGP4 $174
+JUMPV
+LABELV $190
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $174
+JUMPV
+LABELV $191
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRGP4 $174
+JUMPV
+LABELV $192
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 56
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $174
+JUMPV
+LABELV $179
+LABELV $176
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+LABELV $178
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $175
+LABELV $174
+endproc G_ParseField 60 20
+data
+align 4
+LABELV $195
+address $196
+address $197
+address $198
+address $85
+address $199
+address $200
+address $201
+address $202
+address $203
+address $204
+address $205
+address $206
+address $207
+address $208
+export G_SpawnGEntityFromSpawnVars
+code
+proc G_SpawnGEntityFromSpawnVars 44 12
+ADDRLP4 20
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $212
+JUMPV
+LABELV $209
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 level+4512
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 level+4512+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_ParseField
+CALLV
+pop
+LABELV $210
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $212
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+4508
+INDIRI4
+LTI4 $209
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 16
+NEI4 $217
+ADDRGP4 $220
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $222
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $224
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_AdjustAreaPortalState
+CALLV
+pop
+LABELV $224
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $222
+LABELV $217
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $226
+ADDRGP4 $229
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $227
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $232
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_AdjustAreaPortalState
+CALLV
+pop
+LABELV $232
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $226
+ADDRGP4 $234
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $235
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $237
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_AdjustAreaPortalState
+CALLV
+pop
+LABELV $237
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $235
+LABELV $227
+ADDRGP4 $241
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_SpawnString
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $239
+ADDRLP4 28
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 48
+LTI4 $242
+ADDRLP4 28
+INDIRI4
+CNSTI4 57
+GTI4 $242
+ADDRGP4 g_gametype+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $243
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $247
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_AdjustAreaPortalState
+CALLV
+pop
+LABELV $247
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $242
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+LTI4 $249
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 17
+GEI4 $249
+ADDRLP4 16
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $195
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $254
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+NEI4 $256
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $259
+ARGP4
+ADDRLP4 36
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $260
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $263
+ARGP4
+ADDRLP4 36
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+NEI4 $264
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRLP4 36
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+NEI4 $268
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $271
+ARGP4
+ADDRLP4 36
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $269
+JUMPV
+LABELV $268
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $272
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 36
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+LABELV $272
+LABELV $269
+LABELV $265
+LABELV $261
+LABELV $257
+LABELV $254
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $276
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $278
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_AdjustAreaPortalState
+CALLV
+pop
+LABELV $278
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $276
+LABELV $249
+LABELV $243
+LABELV $239
+ADDRGP4 $280
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $281
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $283
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_AdjustAreaPortalState
+CALLV
+pop
+LABELV $283
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $281
+ADDRGP4 $287
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+ADDRGP4 G_SpawnString
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $285
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+LTI4 $288
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 17
+GEI4 $288
+ADDRLP4 16
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $195
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $293
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+NEI4 $295
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $259
+ARGP4
+ADDRLP4 36
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $298
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $263
+ARGP4
+ADDRLP4 36
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $299
+JUMPV
+LABELV $298
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+NEI4 $301
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRLP4 36
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+NEI4 $304
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $271
+ARGP4
+ADDRLP4 36
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $307
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 36
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+LABELV $307
+LABELV $305
+LABELV $302
+LABELV $299
+LABELV $296
+LABELV $293
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $310
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $312
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_AdjustAreaPortalState
+CALLV
+pop
+LABELV $312
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $310
+LABELV $288
+LABELV $285
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 G_CallSpawn
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $314
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+LABELV $314
+LABELV $194
+endproc G_SpawnGEntityFromSpawnVars 44 12
+export G_AddSpawnVarToken
+proc G_AddSpawnVarToken 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 level+5024
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+CNSTI4 4096
+LEI4 $317
+ADDRGP4 $320
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $317
+ADDRLP4 4
+ADDRGP4 level+5024
+INDIRI4
+ADDRGP4 level+5028
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12
+ADDRGP4 level+5024
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $316
+endproc G_AddSpawnVarToken 16 12
+export G_ParseSpawnVars
+proc G_ParseSpawnVars 2072 8
+ADDRGP4 level+4508
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+5024
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2048
+ADDRGP4 trap_GetEntityToken
+CALLI4
+ASGNI4
+ADDRLP4 2048
+INDIRI4
+CNSTI4 0
+NEI4 $327
+CNSTI4 0
+RETI4
+ADDRGP4 $324
+JUMPV
+LABELV $327
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $333
+ADDRGP4 $331
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $333
+JUMPV
+LABELV $332
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2052
+ADDRGP4 trap_GetEntityToken
+CALLI4
+ASGNI4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 0
+NEI4 $335
+ADDRGP4 $337
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $335
+ADDRLP4 1024
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $338
+ADDRGP4 $334
+JUMPV
+LABELV $338
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2056
+ADDRGP4 trap_GetEntityToken
+CALLI4
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+CNSTI4 0
+NEI4 $340
+ADDRGP4 $337
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $340
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $342
+ADDRGP4 $344
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $342
+ADDRGP4 level+4508
+INDIRI4
+CNSTI4 64
+NEI4 $345
+ADDRGP4 $348
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $345
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2060
+ADDRGP4 G_AddSpawnVarToken
+CALLP4
+ASGNP4
+ADDRGP4 level+4508
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 level+4512
+ADDP4
+ADDRLP4 2060
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 2064
+ADDRGP4 G_AddSpawnVarToken
+CALLP4
+ASGNP4
+ADDRGP4 level+4508
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 level+4512+4
+ADDP4
+ADDRLP4 2064
+INDIRP4
+ASGNP4
+ADDRLP4 2068
+ADDRGP4 level+4508
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2068
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $333
+ADDRGP4 $332
+JUMPV
+LABELV $334
+CNSTI4 1
+RETI4
+LABELV $324
+endproc G_ParseSpawnVars 2072 8
+export SP_worldspawn
+proc SP_worldspawn 88 12
+ADDRGP4 $76
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnString
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $359
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $357
+ADDRGP4 $360
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $357
+ADDRGP4 $361
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+CNSTI4 12
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $362
+ARGP4
+ADDRGP4 level+40
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 13
+ARGI4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $364
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnString
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $84
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnString
+CALLI4
+pop
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $365
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnString
+CALLI4
+pop
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $366
+ADDRLP4 76
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $366
+CNSTI4 678
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $366
+ADDRGP4 $368
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnString
+CALLI4
+pop
+ADDRLP4 80
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $369
+ADDRLP4 80
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $369
+CNSTI4 679
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $369
+CNSTI4 4
+ARGI4
+ADDRGP4 g_motd+16
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $372
+ARGP4
+ADDRGP4 $373
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnString
+CALLI4
+pop
+ADDRGP4 $374
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $375
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnString
+CALLI4
+pop
+ADDRGP4 $376
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $377
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnString
+CALLI4
+pop
+ADDRGP4 $378
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 g_entities+887096
+CNSTI4 1022
+ASGNI4
+ADDRGP4 g_entities+887096+236+332
+CNSTI4 1023
+ASGNI4
+ADDRGP4 g_entities+887096+580
+ADDRGP4 $359
+ASGNP4
+ADDRGP4 g_entities+887964
+CNSTI4 1023
+ASGNI4
+ADDRGP4 g_entities+887964+236+332
+CNSTI4 1023
+ASGNI4
+ADDRGP4 g_entities+887964+580
+ADDRGP4 $391
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRGP4 $356
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 g_restarted+12
+INDIRI4
+CNSTI4 0
+EQI4 $392
+ADDRGP4 $395
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 level+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRGP4 g_doWarmup+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $401
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $403
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $397
+LABELV $393
+LABELV $355
+endproc SP_worldspawn 88 12
+export G_SpawnEntitiesFromString
+proc G_SpawnEntitiesFromString 8 4
+ADDRGP4 level+4504
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+4508
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 G_ParseSpawnVars
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $407
+ADDRGP4 $409
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $407
+ADDRGP4 SP_worldspawn
+CALLV
+pop
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRGP4 G_SpawnGEntityFromSpawnVars
+CALLV
+pop
+LABELV $411
+ADDRLP4 4
+ADDRGP4 G_ParseSpawnVars
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $410
+ADDRGP4 level+4504
+CNSTI4 0
+ASGNI4
+LABELV $404
+endproc G_SpawnEntitiesFromString 8 4
+import SP_team_CTF_bluespawn
+import SP_team_CTF_redspawn
+import SP_team_CTF_blueplayer
+import SP_team_CTF_redplayer
+import SP_shooter_grenade
+import SP_shooter_plasma
+import SP_shooter_rocket
+import SP_misc_portal_surface
+import SP_misc_portal_camera
+import SP_misc_model
+import SP_misc_teleporter_dest
+import SP_path_corner
+import SP_info_camp
+import SP_info_notnull
+import SP_info_null
+import SP_light
+import SP_target_push
+import SP_target_location
+import SP_target_position
+import SP_target_kill
+import SP_target_relay
+import SP_target_teleporter
+import SP_target_score
+import SP_target_laser
+import SP_target_print
+import SP_target_speaker
+import SP_target_delay
+import SP_target_give
+import SP_target_remove_powerups
+import SP_trigger_hurt
+import SP_trigger_teleport
+import SP_trigger_push
+import SP_trigger_multiple
+import SP_trigger_always
+import SP_func_timer
+import SP_func_train
+import SP_func_door
+import SP_func_button
+import SP_func_pendulum
+import SP_func_bobbing
+import SP_func_rotating
+import SP_func_static
+import SP_func_plat
+import SP_info_player_intermission
+import SP_info_player_deathmatch
+import SP_info_player_start
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $409
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $403
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $401
+byte 1 92
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $395
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $391
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $378
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 66
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $377
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 66
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $376
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 68
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $375
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 68
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $374
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $373
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $372
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $368
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $365
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $364
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $362
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $361
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $360
+byte 1 83
+byte 1 80
+byte 1 95
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 39
+byte 1 0
+align 1
+LABELV $359
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $356
+byte 1 0
+align 1
+LABELV $348
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $344
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 0
+align 1
+LABELV $337
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 69
+byte 1 79
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $331
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 123
+byte 1 0
+align 1
+LABELV $320
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $287
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $280
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 0
+align 1
+LABELV $275
+byte 1 111
+byte 1 98
+byte 1 0
+align 1
+LABELV $271
+byte 1 49
+byte 1 102
+byte 1 0
+align 1
+LABELV $267
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $263
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $259
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 0
+align 1
+LABELV $241
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $234
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 0
+align 1
+LABELV $229
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $221
+byte 1 48
+byte 1 0
+align 1
+LABELV $220
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $208
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $207
+byte 1 114
+byte 1 114
+byte 1 0
+align 1
+LABELV $206
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $205
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $204
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $203
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $202
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $201
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $200
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $199
+byte 1 99
+byte 1 97
+byte 1 0
+align 1
+LABELV $198
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $197
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $196
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $164
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $150
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $146
+byte 1 97
+byte 1 100
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $145
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $144
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $143
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $142
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $141
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $140
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $139
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $138
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $137
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $136
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $135
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $134
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $133
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $132
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $131
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $130
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $129
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $128
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $127
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $126
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $125
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $124
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $123
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $122
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $121
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $120
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $119
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $118
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $117
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $116
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 0
+align 1
+LABELV $113
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $112
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $111
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $110
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 117
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $109
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 98
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $108
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $107
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $106
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $105
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $104
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $103
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $102
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 110
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $101
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 110
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $100
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $99
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $98
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $94
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $93
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $92
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $91
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $90
+byte 1 100
+byte 1 109
+byte 1 103
+byte 1 0
+align 1
+LABELV $89
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $88
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $87
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $86
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $85
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $84
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $82
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $81
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $80
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $79
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 50
+byte 1 0
+align 1
+LABELV $78
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $77
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $76
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $73
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
@@ -0,0 +1,3183 @@
+code
+proc StringToFilter 160 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $57
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+ADDP4
+CNSTU1 0
+ASGNU1
+LABELV $58
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+LTI4 $57
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $61
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 48
+LTI4 $67
+ADDRLP4 144
+INDIRI4
+CNSTI4 57
+LEI4 $65
+LABELV $67
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $68
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $70
+ADDRGP4 $63
+JUMPV
+LABELV $70
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $62
+JUMPV
+LABELV $68
+ADDRGP4 $72
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $56
+JUMPV
+LABELV $65
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $74
+JUMPV
+LABELV $73
+ADDRLP4 148
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 156
+CNSTI4 1
+ASGNI4
+ADDRLP4 128
+ADDRLP4 148
+INDIRI4
+ADDRLP4 156
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 152
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRI4
+ADDRLP4 0
+ADDP4
+ADDRLP4 152
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $74
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 48
+LTI4 $76
+ADDRLP4 148
+INDIRI4
+CNSTI4 57
+LEI4 $73
+LABELV $76
+ADDRLP4 128
+INDIRI4
+ADDRLP4 0
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+ADDP4
+ADDRLP4 152
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $77
+ADDRGP4 $63
+JUMPV
+LABELV $77
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $62
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+LTI4 $61
+LABELV $63
+ADDRFP4 4
+INDIRP4
+ADDRLP4 140
+INDIRU4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 136
+INDIRU4
+ASGNU4
+CNSTI4 1
+RETI4
+LABELV $56
+endproc StringToFilter 160 8
+lit
+align 1
+LABELV $80
+byte 1 0
+skip 3
+align 1
+LABELV $81
+byte 1 0
+skip 3
+align 1
+LABELV $82
+byte 1 0
+skip 255
+align 1
+LABELV $83
+byte 1 0
+skip 63
+code
+proc UpdateIPBans 348 12
+ADDRLP4 72
+ADDRGP4 $80
+INDIRB
+ASGNB 4
+ADDRLP4 68
+ADDRGP4 $81
+INDIRB
+ASGNB 4
+ADDRLP4 80
+ADDRGP4 $82
+INDIRB
+ASGNB 256
+ADDRLP4 4
+ADDRGP4 $83
+INDIRB
+ASGNB 64
+ADDRLP4 80
+CNSTI1 0
+ASGNI1
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $84
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+CNSTU4 4294967295
+NEU4 $88
+ADDRGP4 $85
+JUMPV
+LABELV $88
+ADDRLP4 336
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 336
+INDIRI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 68
+ADDRLP4 336
+INDIRI4
+ADDRGP4 ipFilters
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $92
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 255
+EQI4 $96
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $98
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRGP4 $99
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 72
+ADDP4
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $97
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GEI4 $103
+ADDRLP4 344
+ADDRGP4 $100
+ASGNP4
+ADDRGP4 $104
+JUMPV
+LABELV $103
+ADDRLP4 344
+ADDRGP4 $101
+ASGNP4
+LABELV $104
+ADDRLP4 344
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $93
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $92
+ADDRLP4 80
+ARGP4
+ADDRLP4 340
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ARGP4
+ADDRLP4 344
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 340
+INDIRU4
+ADDRLP4 344
+INDIRU4
+ADDU4
+CNSTU4 256
+GEU4 $105
+ADDRLP4 80
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRGP4 $107
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $86
+JUMPV
+LABELV $106
+LABELV $85
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $87
+ADDRLP4 76
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $84
+LABELV $86
+ADDRGP4 $108
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $79
+endproc UpdateIPBans 348 12
+lit
+align 1
+LABELV $110
+byte 1 0
+skip 3
+export G_FilterPacket
+code
+proc G_FilterPacket 28 0
+ADDRLP4 8
+ADDRGP4 $110
+INDIRB
+ASGNB 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 10
+ADDRLP4 16
+INDIRP4
+INDIRU1
+CVUI4 1
+MULI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $115
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+LTI4 $117
+ADDRLP4 16
+INDIRI4
+CNSTI4 57
+LEI4 $114
+LABELV $117
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $120
+ADDRLP4 20
+INDIRI4
+CNSTI4 58
+NEI4 $118
+LABELV $120
+ADDRGP4 $113
+JUMPV
+LABELV $118
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $112
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $121
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $111
+LABELV $121
+LABELV $113
+ADDRLP4 12
+ADDRLP4 8
+INDIRU4
+ASGNU4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $125
+JUMPV
+LABELV $122
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRU4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 ipFilters
+ADDP4
+INDIRU4
+BANDU4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+NEU4 $126
+ADDRGP4 g_filterBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $131
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $132
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $109
+JUMPV
+LABELV $126
+LABELV $123
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $125
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $122
+ADDRGP4 g_filterBan+12
+INDIRI4
+CNSTI4 0
+NEI4 $135
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $136
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $109
+endproc G_FilterPacket 28 0
+proc AddIP 8 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $141
+JUMPV
+LABELV $138
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+CNSTU4 4294967295
+NEU4 $142
+ADDRGP4 $140
+JUMPV
+LABELV $142
+LABELV $139
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $141
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $138
+LABELV $140
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+NEI4 $145
+ADDRGP4 numIPFilters
+INDIRI4
+CNSTI4 1024
+NEI4 $147
+ADDRGP4 $149
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $147
+ADDRLP4 4
+ADDRGP4 numIPFilters
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $145
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 StringToFilter
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $150
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+CNSTU4 4294967295
+ASGNU4
+LABELV $150
+ADDRGP4 UpdateIPBans
+CALLV
+pop
+LABELV $137
+endproc AddIP 8 8
+export G_ProcessIPBans
+proc G_ProcessIPBans 276 12
+ADDRLP4 8
+ARGP4
+ADDRGP4 g_banIPs+16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 264
+ADDRGP4 g_banIPs+16
+ASGNP4
+ADDRLP4 0
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRGP4 $158
+JUMPV
+LABELV $155
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 268
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 268
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $163
+ADDRGP4 $157
+JUMPV
+LABELV $162
+ADDRLP4 272
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 272
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $163
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $162
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $165
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AddIP
+CALLV
+pop
+LABELV $165
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $156
+LABELV $158
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $155
+LABELV $157
+LABELV $153
+endproc G_ProcessIPBans 276 12
+export Svcmd_AddIP_f
+proc Svcmd_AddIP_f 1028 12
+ADDRLP4 1024
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 2
+GEI4 $168
+ADDRGP4 $170
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $167
+JUMPV
+LABELV $168
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 AddIP
+CALLV
+pop
+LABELV $167
+endproc Svcmd_AddIP_f 1028 12
+export Svcmd_RemoveIP_f
+proc Svcmd_RemoveIP_f 1048 12
+ADDRLP4 1036
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+GEI4 $172
+ADDRGP4 $174
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $171
+JUMPV
+LABELV $172
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 StringToFilter
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $175
+ADDRGP4 $171
+JUMPV
+LABELV $175
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $177
+ADDRLP4 1044
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ADDRGP4 ipFilters
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRU4
+NEU4 $181
+ADDRLP4 1044
+INDIRI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+ADDRLP4 4+4
+INDIRU4
+NEU4 $181
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+CNSTU4 4294967295
+ASGNU4
+ADDRGP4 $186
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 UpdateIPBans
+CALLV
+pop
+ADDRGP4 $171
+JUMPV
+LABELV $181
+LABELV $178
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $180
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $177
+ADDRGP4 $187
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $171
+endproc Svcmd_RemoveIP_f 1048 12
+export Svcmd_EntityList_f
+proc Svcmd_EntityList_f 16 8
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $192
+JUMPV
+LABELV $189
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $194
+ADDRGP4 $190
+JUMPV
+LABELV $194
+ADDRGP4 $196
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $197
+ADDRLP4 8
+INDIRI4
+CNSTI4 11
+GTI4 $197
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $225
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $225
+address $200
+address $202
+address $204
+address $206
+address $208
+address $210
+address $212
+address $214
+address $216
+address $218
+address $220
+address $222
+code
+LABELV $200
+ADDRGP4 $201
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $202
+ADDRGP4 $203
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $204
+ADDRGP4 $205
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $206
+ADDRGP4 $207
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $208
+ADDRGP4 $209
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $210
+ADDRGP4 $211
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $212
+ADDRGP4 $213
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $214
+ADDRGP4 $215
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $216
+ADDRGP4 $217
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $218
+ADDRGP4 $219
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $220
+ADDRGP4 $221
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $222
+ADDRGP4 $223
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRGP4 $224
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $198
+ADDRLP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $226
+ADDRGP4 $228
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $226
+ADDRGP4 $229
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $190
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+LABELV $192
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $189
+LABELV $188
+endproc Svcmd_EntityList_f 16 8
+export ClientForString
+proc ClientForString 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 48
+LTI4 $231
+ADDRLP4 12
+INDIRI4
+CNSTI4 57
+GTI4 $231
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $236
+ADDRLP4 20
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $233
+LABELV $236
+ADDRGP4 $237
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $230
+JUMPV
+LABELV $233
+ADDRLP4 0
+CNSTI4 888
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $238
+ADDRGP4 $240
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $230
+JUMPV
+LABELV $238
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $230
+JUMPV
+LABELV $231
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $244
+JUMPV
+LABELV $241
+ADDRLP4 0
+CNSTI4 888
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $246
+ADDRGP4 $242
+JUMPV
+LABELV $246
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $248
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $230
+JUMPV
+LABELV $248
+LABELV $242
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $244
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $241
+ADDRGP4 $250
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $230
+endproc ClientForString 24 8
+export Svcmd_ForceTeam_f
+proc Svcmd_ForceTeam_f 1036 12
+ADDRLP4 1028
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+GEI4 $252
+ADDRGP4 $254
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $252
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1032
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1032
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $255
+ADDRGP4 $251
+JUMPV
+LABELV $255
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 868
+ADDRLP4 1024
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 888
+DIVI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $251
+endproc Svcmd_ForceTeam_f 1036 12
+export ConsoleCommand
+proc ConsoleCommand 1072 12
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $260
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+NEI4 $258
+ADDRGP4 Svcmd_EntityList_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $258
+ADDRLP4 0
+ARGP4
+ADDRGP4 $263
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $261
+ADDRGP4 Svcmd_ForceTeam_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $261
+ADDRLP4 0
+ARGP4
+ADDRGP4 $266
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $264
+ADDRGP4 Svcmd_GameMem_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $264
+ADDRLP4 0
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $267
+ADDRGP4 Svcmd_AddBot_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $267
+ADDRLP4 0
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $270
+ADDRGP4 Svcmd_BotList_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $270
+ADDRLP4 0
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $273
+ADDRGP4 Svcmd_AbortPodium_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $273
+ADDRLP4 0
+ARGP4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $276
+ADDRGP4 Svcmd_AddIP_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $276
+ADDRLP4 0
+ARGP4
+ADDRGP4 $281
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRGP4 Svcmd_RemoveIP_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $279
+ADDRLP4 0
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $282
+CNSTI4 0
+ARGI4
+ADDRGP4 $285
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $282
+ADDRGP4 g_dedicated+12
+INDIRI4
+CNSTI4 0
+EQI4 $286
+ADDRLP4 0
+ARGP4
+ADDRGP4 $291
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $289
+CNSTI4 1
+ARGI4
+ADDRLP4 1064
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRGP4 $292
+ARGP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $289
+CNSTI4 0
+ARGI4
+ADDRLP4 1064
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRGP4 $292
+ARGP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $286
+CNSTI4 0
+RETI4
+LABELV $257
+endproc ConsoleCommand 1072 12
+import ConcatArgs
+bss
+align 4
+LABELV numIPFilters
+skip 4
+align 4
+LABELV ipFilters
+skip 8192
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $292
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $291
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $285
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $284
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $281
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $278
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $275
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $272
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $269
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $266
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 0
+align 1
+LABELV $263
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $260
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $254
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $250
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $240
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $237
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $229
+byte 1 10
+byte 1 0
+align 1
+LABELV $228
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $224
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $223
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 80
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $221
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 86
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $219
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 0
+align 1
+LABELV $217
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 85
+byte 1 83
+byte 1 72
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $215
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 65
+byte 1 75
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $213
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $211
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $209
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $207
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $205
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $203
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $201
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $196
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 0
+align 1
+LABELV $187
+byte 1 68
+byte 1 105
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $186
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $174
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 112
+byte 1 45
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $170
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 112
+byte 1 45
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $149
+byte 1 73
+byte 1 80
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $108
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 0
+align 1
+LABELV $107
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 67
+byte 1 86
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 10
+byte 1 0
+align 1
+LABELV $101
+byte 1 32
+byte 1 0
+align 1
+LABELV $100
+byte 1 46
+byte 1 0
+align 1
+LABELV $99
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $98
+byte 1 42
+byte 1 0
+align 1
+LABELV $72
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
@@ -0,0 +1,6217 @@
+export Team_InitGame
+code
+proc Team_InitGame 0 12
+ADDRGP4 teamgame
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 36
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $57
+ADDRGP4 teamgame+8
+CNSTI4 -1
+ASGNI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 teamgame+12
+CNSTI4 -1
+ASGNI4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+LABELV $57
+LABELV $56
+endproc Team_InitGame 0 12
+export OtherTeam
+proc OtherTeam 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $63
+CNSTI4 2
+RETI4
+ADDRGP4 $62
+JUMPV
+LABELV $63
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $65
+CNSTI4 1
+RETI4
+ADDRGP4 $62
+JUMPV
+LABELV $65
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $62
+endproc OtherTeam 0 0
+export TeamName
+proc TeamName 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $68
+ADDRGP4 $70
+RETP4
+ADDRGP4 $67
+JUMPV
+LABELV $68
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $71
+ADDRGP4 $73
+RETP4
+ADDRGP4 $67
+JUMPV
+LABELV $71
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $74
+ADDRGP4 $76
+RETP4
+ADDRGP4 $67
+JUMPV
+LABELV $74
+ADDRGP4 $77
+RETP4
+LABELV $67
+endproc TeamName 0 0
+export TeamColorString
+proc TeamColorString 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $79
+ADDRGP4 $81
+RETP4
+ADDRGP4 $78
+JUMPV
+LABELV $79
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $82
+ADDRGP4 $84
+RETP4
+ADDRGP4 $78
+JUMPV
+LABELV $82
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $85
+ADDRGP4 $87
+RETP4
+ADDRGP4 $78
+JUMPV
+LABELV $85
+ADDRGP4 $88
+RETP4
+LABELV $78
+endproc TeamColorString 0 0
+proc PrintMsg 1048 16
+ADDRLP4 1028
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_vsnprintf
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CVIU4 4
+CNSTU4 1024
+LTU4 $91
+ADDRGP4 $93
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $91
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRLP4 0
+INDIRP4
+CNSTI1 39
+ASGNI1
+LABELV $95
+ADDRLP4 4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRLP4 1036
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $94
+ADDRGP4 $98
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $99
+ADDRLP4 1040
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $100
+JUMPV
+LABELV $99
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ASGNI4
+LABELV $100
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $89
+endproc PrintMsg 1048 16
+export AddTeamScore
+proc AddTeamScore 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 44
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $102
+ADDRGP4 level+44+4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+44+8
+INDIRI4
+NEI4 $104
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $103
+JUMPV
+LABELV $104
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+GTI4 $110
+ADDRGP4 level+44+4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+44+8
+INDIRI4
+LEI4 $110
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $103
+JUMPV
+LABELV $110
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRGP4 level+44+8
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+44+4
+INDIRI4
+NEI4 $120
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRGP4 level+44+8
+INDIRI4
+ADDRGP4 level+44+4
+INDIRI4
+GTI4 $126
+ADDRGP4 level+44+8
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+44+4
+INDIRI4
+LEI4 $126
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 9
+ASGNI4
+LABELV $127
+LABELV $121
+LABELV $103
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $101
+endproc AddTeamScore 16 8
+export OnSameTeam
+proc OnSameTeam 16 0
+ADDRLP4 0
+CNSTI4 572
+ASGNI4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $140
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $138
+LABELV $140
+CNSTI4 0
+RETI4
+ADDRGP4 $137
+JUMPV
+LABELV $138
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+GEI4 $141
+CNSTI4 0
+RETI4
+ADDRGP4 $137
+JUMPV
+LABELV $141
+ADDRLP4 8
+CNSTI4 572
+ASGNI4
+ADDRLP4 12
+CNSTI4 656
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $144
+CNSTI4 1
+RETI4
+ADDRGP4 $137
+JUMPV
+LABELV $144
+CNSTI4 0
+RETI4
+LABELV $137
+endproc OnSameTeam 16 0
+data
+align 1
+LABELV ctfFlagStatusRemap
+byte 1 48
+byte 1 49
+byte 1 42
+byte 1 42
+byte 1 50
+align 1
+LABELV oneFlagStatusRemap
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+export Team_SetFlagStatus
+code
+proc Team_SetFlagStatus 16 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $159
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $149
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $154
+ADDRGP4 $147
+JUMPV
+LABELV $149
+ADDRGP4 teamgame+8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $148
+ADDRGP4 teamgame+8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $154
+ADDRGP4 teamgame+12
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $148
+ADDRGP4 teamgame+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $159
+ADDRGP4 teamgame+16
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $148
+ADDRGP4 teamgame+16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $147
+LABELV $148
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $164
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $166
+ADDRLP4 12
+ADDRGP4 ctfFlagStatusRemap
+ASGNP4
+ADDRLP4 8
+ADDRGP4 teamgame+8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+1
+ADDRGP4 teamgame+12
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+2
+CNSTI1 0
+ASGNI1
+ADDRGP4 $167
+JUMPV
+LABELV $166
+ADDRLP4 8
+ADDRGP4 teamgame+16
+INDIRI4
+ADDRGP4 oneFlagStatusRemap
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+1
+CNSTI1 0
+ASGNI1
+LABELV $167
+CNSTI4 658
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $164
+LABELV $146
+endproc Team_SetFlagStatus 16 8
+export Team_CheckDroppedItem
+proc Team_CheckDroppedItem 0 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+NEI4 $176
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRFP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+NEI4 $178
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRFP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+NEI4 $180
+CNSTI4 0
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+LABELV $180
+LABELV $179
+LABELV $177
+LABELV $175
+endproc Team_CheckDroppedItem 0 8
+export Team_ForceGesture
+proc Team_ForceGesture 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $183
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $187
+ADDRGP4 $184
+JUMPV
+LABELV $187
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $189
+ADDRGP4 $184
+JUMPV
+LABELV $189
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $191
+ADDRGP4 $184
+JUMPV
+LABELV $191
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32768
+BORI4
+ASGNI4
+LABELV $184
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $183
+LABELV $182
+endproc Team_ForceGesture 12 0
+export Team_FragBonuses
+proc Team_FragBonuses 284 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 68
+CNSTI4 572
+ASGNI4
+ADDRLP4 72
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRU4
+EQU4 $198
+ADDRFP4 8
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRU4
+EQU4 $198
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $198
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $194
+LABELV $198
+ADDRGP4 $193
+JUMPV
+LABELV $194
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 88
+CNSTI4 656
+ASGNI4
+ADDRLP4 56
+ADDRLP4 84
+INDIRP4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRP4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $199
+ADDRGP4 $193
+JUMPV
+LABELV $199
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+NEI4 $201
+ADDRLP4 16
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ASGNI4
+ADDRGP4 $202
+JUMPV
+LABELV $201
+ADDRLP4 16
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ASGNI4
+LABELV $202
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+NEI4 $203
+ADDRLP4 96
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $203
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $206
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 640
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $209
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $213
+JUMPV
+LABELV $210
+ADDRLP4 12
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $215
+ADDRLP4 12
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $215
+ADDRLP4 12
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $215
+LABELV $211
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $213
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $210
+ADDRGP4 $193
+JUMPV
+LABELV $206
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $217
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 640
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 52
+INDIRI4
+MULI4
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $220
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $224
+JUMPV
+LABELV $221
+ADDRLP4 12
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $226
+ADDRLP4 12
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $226
+ADDRLP4 12
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $226
+LABELV $222
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $224
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $221
+ADDRGP4 $193
+JUMPV
+LABELV $217
+ADDRLP4 100
+CNSTI4 572
+ASGNI4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 0
+EQF4 $228
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ADDRLP4 104
+INDIRF4
+SUBF4
+CNSTF4 1174011904
+GEF4 $228
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $228
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 612
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 112
+ADDRGP4 PERS_DEFEND_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 116
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 120
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $228
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+EQI4 $235
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+EQI4 $237
+ADDRGP4 $193
+JUMPV
+LABELV $235
+ADDRLP4 24
+ADDRGP4 $236
+ASGNP4
+ADDRGP4 $233
+JUMPV
+LABELV $237
+ADDRLP4 24
+ADDRGP4 $238
+ASGNP4
+LABELV $233
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $239
+ADDRLP4 4
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $244
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $244
+ADDRGP4 $241
+JUMPV
+LABELV $244
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+LABELV $240
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $242
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $239
+LABELV $241
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 $247
+JUMPV
+LABELV $246
+ADDRLP4 8
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $249
+ADDRGP4 $248
+JUMPV
+LABELV $249
+LABELV $247
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $246
+LABELV $248
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $251
+ADDRGP4 $193
+JUMPV
+LABELV $251
+ADDRLP4 124
+CNSTI4 544
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+CNSTI4 548
+ASGNI4
+ADDRLP4 28+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+CNSTI4 552
+ASGNI4
+ADDRLP4 28+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+CNSTI4 544
+ASGNI4
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 152
+CNSTI4 548
+ASGNI4
+ADDRLP4 40+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+CNSTI4 552
+ASGNI4
+ADDRLP4 40+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 160
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 160
+INDIRF4
+CNSTF4 1148846080
+GEF4 $260
+ADDRLP4 164
+CNSTI4 544
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $259
+LABELV $260
+ADDRLP4 40
+ARGP4
+ADDRLP4 172
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+CNSTF4 1148846080
+GEF4 $257
+ADDRLP4 176
+CNSTI4 544
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $257
+LABELV $259
+ADDRLP4 184
+CNSTI4 572
+ASGNI4
+ADDRLP4 188
+CNSTI4 656
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 184
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 184
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $257
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 192
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 608
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 196
+ADDRGP4 PERS_DEFEND_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 200
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 204
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ADDRLP4 204
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $257
+ADDRLP4 192
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 192
+INDIRU4
+CNSTU4 0
+EQU4 $262
+ADDRLP4 192
+INDIRU4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $262
+ADDRLP4 200
+CNSTI4 544
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 208
+CNSTI4 548
+ASGNI4
+ADDRLP4 28+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212
+CNSTI4 552
+ASGNI4
+ADDRLP4 28+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 220
+CNSTI4 544
+ASGNI4
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+ADDRLP4 220
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 220
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 228
+CNSTI4 548
+ASGNI4
+ADDRLP4 40+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 228
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 228
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 232
+CNSTI4 552
+ASGNI4
+ADDRLP4 40+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 236
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 236
+INDIRF4
+CNSTF4 1148846080
+GEF4 $271
+ADDRLP4 240
+CNSTI4 544
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 240
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 240
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 244
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+NEI4 $270
+LABELV $271
+ADDRLP4 40
+ARGP4
+ADDRLP4 248
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 248
+INDIRF4
+CNSTF4 1148846080
+GEF4 $268
+ADDRLP4 252
+CNSTI4 544
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+EQI4 $268
+LABELV $270
+ADDRLP4 260
+CNSTI4 572
+ASGNI4
+ADDRLP4 264
+CNSTI4 656
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $268
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 268
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 612
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 268
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 272
+ADDRGP4 PERS_DEFEND_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 276
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 280
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $268
+LABELV $262
+LABELV $193
+endproc Team_FragBonuses 284 16
+export Team_CheckHurtCarrier
+proc Team_CheckHurtCarrier 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 572
+ASGNI4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $276
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+NEU4 $274
+LABELV $276
+ADDRGP4 $273
+JUMPV
+LABELV $274
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $277
+ADDRLP4 0
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ASGNI4
+ADDRGP4 $278
+JUMPV
+LABELV $277
+ADDRLP4 0
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ASGNI4
+LABELV $278
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+NEI4 $279
+ADDRLP4 0
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+ASGNI4
+LABELV $279
+ADDRLP4 12
+CNSTI4 572
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $282
+ADDRLP4 20
+CNSTI4 656
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $282
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $282
+ADDRLP4 24
+CNSTI4 572
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $285
+ADDRLP4 32
+CNSTI4 656
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $285
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $285
+LABELV $273
+endproc Team_CheckHurtCarrier 36 0
+export Team_ResetFlag
+proc Team_ResetFlag 20 12
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $293
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $291
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $292
+ADDRGP4 $289
+JUMPV
+LABELV $291
+ADDRLP4 4
+ADDRGP4 $236
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $292
+ADDRLP4 4
+ADDRGP4 $238
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $293
+ADDRLP4 4
+ADDRGP4 $294
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $289
+CNSTP4 0
+RETP4
+ADDRGP4 $288
+JUMPV
+LABELV $290
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRLP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $298
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $299
+JUMPV
+LABELV $298
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 RespawnItem
+CALLV
+pop
+LABELV $299
+LABELV $296
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $295
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+RETP4
+LABELV $288
+endproc Team_ResetFlag 20 12
+export Team_ResetFlags
+proc Team_ResetFlags 0 4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $301
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ResetFlag
+CALLP4
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ResetFlag
+CALLP4
+pop
+LABELV $301
+LABELV $300
+endproc Team_ResetFlags 0 4
+export Team_ReturnFlagSound
+proc Team_ReturnFlagSound 12 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $305
+ADDRGP4 $307
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $304
+JUMPV
+LABELV $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 44
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $308
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $309
+JUMPV
+LABELV $308
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $309
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $304
+endproc Team_ReturnFlagSound 12 8
+export Team_TakeFlagSound
+proc Team_TakeFlagSound 16 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $311
+ADDRGP4 $313
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $310
+JUMPV
+LABELV $311
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $316
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $326
+ADDRGP4 $314
+JUMPV
+LABELV $316
+ADDRGP4 teamgame+12
+INDIRI4
+CNSTI4 0
+EQI4 $317
+ADDRGP4 teamgame+24
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $320
+ADDRGP4 $310
+JUMPV
+LABELV $320
+LABELV $317
+ADDRGP4 teamgame+24
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 $315
+JUMPV
+LABELV $326
+ADDRGP4 teamgame+8
+INDIRI4
+CNSTI4 0
+EQI4 $327
+ADDRGP4 teamgame+20
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $330
+ADDRGP4 $310
+JUMPV
+LABELV $330
+LABELV $327
+ADDRGP4 teamgame+20
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $314
+LABELV $315
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 44
+ARGI4
+ADDRLP4 8
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $336
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $337
+JUMPV
+LABELV $336
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 5
+ASGNI4
+LABELV $337
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $310
+endproc Team_TakeFlagSound 16 8
+export Team_CaptureFlagSound
+proc Team_CaptureFlagSound 12 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $339
+ADDRGP4 $341
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $338
+JUMPV
+LABELV $339
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 44
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $342
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $343
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $338
+endproc Team_CaptureFlagSound 12 8
+export Team_ReturnFlag
+proc Team_ReturnFlag 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 Team_ResetFlag
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Team_ReturnFlagSound
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $345
+CNSTP4 0
+ARGP4
+ADDRGP4 $347
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $348
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+LABELV $346
+LABELV $344
+endproc Team_ReturnFlag 8 12
+export Team_FreeEntity
+proc Team_FreeEntity 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+NEI4 $350
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRFP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+NEI4 $352
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 $353
+JUMPV
+LABELV $352
+ADDRFP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+NEI4 $354
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+LABELV $354
+LABELV $353
+LABELV $351
+LABELV $349
+endproc Team_FreeEntity 0 4
+export Team_DroppedFlagThink
+proc Team_DroppedFlagThink 8 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+NEI4 $357
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $358
+JUMPV
+LABELV $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+NEI4 $359
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $360
+JUMPV
+LABELV $359
+ADDRFP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+NEI4 $361
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $361
+LABELV $360
+LABELV $358
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Team_ResetFlag
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Team_ReturnFlagSound
+CALLV
+pop
+LABELV $356
+endproc Team_DroppedFlagThink 8 8
+export Team_TouchOurFlag
+proc Team_TouchOurFlag 68 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $364
+ADDRLP4 12
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+ASGNI4
+ADDRGP4 $365
+JUMPV
+LABELV $364
+ADDRLP4 12
+ADDRGP4 PW_REDFLAG
+INDIRI4
+ASGNI4
+LABELV $365
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $366
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $368
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 632
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Team_ResetFlag
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_ReturnFlagSound
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $363
+JUMPV
+LABELV $366
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $370
+CNSTI4 0
+RETI4
+ADDRGP4 $363
+JUMPV
+LABELV $370
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $372
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 teamgame
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 teamgame+4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddTeamScore
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Team_ForceGesture
+CALLV
+pop
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 604
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 PERS_CAPTURES
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_CaptureFlagSound
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $376
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $383
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+NEU4 $381
+LABELV $383
+ADDRGP4 $377
+JUMPV
+LABELV $381
+ADDRLP4 44
+CNSTI4 656
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $384
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+CNSTF4 3231711232
+ASGNF4
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRLP4 48
+CNSTI4 656
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $386
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRF4
+CNSTF4 1176256512
+ADDF4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+LEF4 $388
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 624
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 PERS_ASSIST_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 131072
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $388
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRF4
+CNSTF4 1176256512
+ADDF4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+LEF4 $392
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 624
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 PERS_ASSIST_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 131072
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $392
+LABELV $386
+LABELV $385
+LABELV $377
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $379
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $376
+ADDRGP4 Team_ResetFlags
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $363
+endproc Team_TouchOurFlag 68 16
+export Team_TouchEnemyFlag
+proc Team_TouchEnemyFlag 8 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $397
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $398
+ADDRGP4 PW_REDFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 2147483647
+ASGNI4
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 2147483647
+ASGNI4
+LABELV $399
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_TakeFlagSound
+CALLV
+pop
+CNSTI4 -1
+RETI4
+LABELV $396
+endproc Team_TouchEnemyFlag 8 16
+export Pickup_Team
+proc Pickup_Team 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $236
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $402
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $238
+ARGP4
+ADDRLP4 12
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $404
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $406
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $405
+LABELV $403
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+NEI4 $407
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Team_TouchOurFlag
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $407
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Team_TouchEnemyFlag
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $401
+endproc Pickup_Team 20 12
+export Team_GetLocation
+proc Team_GetLocation 48 8
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+CNSTF4 1296039936
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 level+9172
+INDIRP4
+ASGNP4
+ADDRGP4 $413
+JUMPV
+LABELV $410
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LEF4 $419
+ADDRGP4 $411
+JUMPV
+LABELV $419
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $421
+ADDRGP4 $411
+JUMPV
+LABELV $421
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $411
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $413
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $410
+ADDRLP4 24
+INDIRP4
+RETP4
+LABELV $409
+endproc Team_GetLocation 48 8
+export Team_GetLocationMsg
+proc Team_GetLocationMsg 12 24
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Team_GetLocation
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $424
+CNSTI4 0
+RETI4
+ADDRGP4 $423
+JUMPV
+LABELV $424
+ADDRLP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $426
+ADDRLP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $428
+ADDRLP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $428
+ADDRLP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $430
+ADDRLP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $430
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $432
+ARGP4
+CNSTI4 94
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+CNSTI4 48
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $427
+JUMPV
+LABELV $426
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $433
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $427
+CNSTI4 1
+RETI4
+LABELV $423
+endproc Team_GetLocationMsg 12 24
+export SelectRandomTeamSpawnPoint
+proc SelectRandomTeamSpawnPoint 152 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $435
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $437
+ADDRLP4 8
+ADDRGP4 $439
+ASGNP4
+ADDRGP4 $436
+JUMPV
+LABELV $437
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $440
+ADDRLP4 8
+ADDRGP4 $442
+ASGNP4
+ADDRGP4 $436
+JUMPV
+LABELV $440
+CNSTP4 0
+RETP4
+ADDRGP4 $434
+JUMPV
+LABELV $435
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $443
+ADDRLP4 8
+ADDRGP4 $445
+ASGNP4
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $446
+ADDRLP4 8
+ADDRGP4 $448
+ASGNP4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+CNSTP4 0
+RETP4
+ADDRGP4 $434
+JUMPV
+LABELV $447
+LABELV $444
+LABELV $436
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $452
+ADDRGP4 $450
+JUMPV
+LABELV $452
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 32
+NEI4 $454
+ADDRGP4 $451
+JUMPV
+LABELV $454
+LABELV $450
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $449
+LABELV $451
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $456
+CNSTP4 0
+ARGP4
+CNSTI4 580
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+RETP4
+ADDRGP4 $434
+JUMPV
+LABELV $456
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 148
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRP4
+RETP4
+LABELV $434
+endproc SelectRandomTeamSpawnPoint 152 12
+export SelectCTFSpawnPoint
+proc SelectCTFSpawnPoint 12 16
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 SelectRandomTeamSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $459
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+RETP4
+ADDRGP4 $458
+JUMPV
+LABELV $459
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $458
+endproc SelectCTFSpawnPoint 12 16
+proc SortClients 0 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+SUBI4
+RETI4
+LABELV $461
+endproc SortClients 0 0
+export TeamplayInfoMessage
+proc TeamplayInfoMessage 9416 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $463
+ADDRGP4 $462
+JUMPV
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $465
+ADDRLP4 9376
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 9376
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $469
+ADDRLP4 9376
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $467
+LABELV $469
+ADDRGP4 $462
+JUMPV
+LABELV $467
+ADDRLP4 12
+CNSTI4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $466
+JUMPV
+LABELV $465
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $466
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $471
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $471
+ADDRGP4 $462
+JUMPV
+LABELV $471
+ADDRLP4 9380
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 9380
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 9380
+INDIRI4
+ASGNI4
+ADDRGP4 $476
+JUMPV
+LABELV $473
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $479
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $479
+ADDRLP4 9388
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 9388
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 9392
+CNSTI4 2
+ASGNI4
+ADDRLP4 9388
+INDIRI4
+ADDRLP4 9392
+INDIRI4
+LSHI4
+ADDRLP4 9248
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 9392
+INDIRI4
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $479
+LABELV $474
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $476
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+GEI4 $482
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LTI4 $473
+LABELV $482
+ADDRLP4 9248
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 4
+ARGU4
+ADDRGP4 SortClients
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRLP4 1056
+CNSTI1 0
+ASGNI1
+ADDRLP4 9384
+CNSTI4 0
+ASGNI4
+ADDRLP4 1048
+ADDRLP4 9384
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 9384
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 9384
+INDIRI4
+ASGNI4
+ADDRGP4 $486
+JUMPV
+LABELV $483
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $488
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $488
+ADDRLP4 9392
+CNSTI4 2
+ASGNI4
+ADDRLP4 9396
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 9400
+CNSTI4 184
+ASGNI4
+ADDRLP4 1040
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 9392
+INDIRI4
+LSHI4
+ADDRLP4 9396
+INDIRP4
+INDIRP4
+ADDRLP4 9400
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+ADDRGP4 STAT_ARMOR
+INDIRI4
+ADDRLP4 9392
+INDIRI4
+LSHI4
+ADDRLP4 9396
+INDIRP4
+INDIRP4
+ADDRLP4 9400
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+GEI4 $490
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+LABELV $490
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+GEI4 $492
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+LABELV $492
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 9408
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 9408
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 9408
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 9412
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1052
+ADDRLP4 9412
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+ADDI4
+CVIU4 4
+CNSTU4 8192
+LTU4 $495
+ADDRGP4 $485
+JUMPV
+LABELV $495
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1056
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1048
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $488
+LABELV $484
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $486
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+GEI4 $497
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LTI4 $483
+LABELV $497
+LABELV $485
+ADDRGP4 $498
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ARGP4
+ADDRLP4 9388
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ARGI4
+ADDRLP4 9388
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $462
+endproc TeamplayInfoMessage 9416 36
+export CheckTeamStatus
+proc CheckTeamStatus 24 4
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $500
+ADDRGP4 level+60
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $509
+JUMPV
+LABELV $506
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $511
+ADDRGP4 $507
+JUMPV
+LABELV $511
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $513
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $515
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $513
+LABELV $515
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Team_GetLocation
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $516
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 600
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 484
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $517
+JUMPV
+LABELV $516
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $517
+LABELV $513
+LABELV $507
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $509
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $506
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $518
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $523
+ADDRGP4 $519
+JUMPV
+LABELV $523
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $525
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TeamplayInfoMessage
+CALLV
+pop
+LABELV $525
+LABELV $519
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $521
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $518
+LABELV $500
+LABELV $499
+endproc CheckTeamStatus 24 4
+export SP_team_CTF_redplayer
+proc SP_team_CTF_redplayer 0 0
+LABELV $527
+endproc SP_team_CTF_redplayer 0 0
+export SP_team_CTF_blueplayer
+proc SP_team_CTF_blueplayer 0 0
+LABELV $528
+endproc SP_team_CTF_blueplayer 0 0
+export SP_team_CTF_redspawn
+proc SP_team_CTF_redspawn 0 0
+LABELV $529
+endproc SP_team_CTF_redspawn 0 0
+export SP_team_CTF_bluespawn
+proc SP_team_CTF_bluespawn 0 0
+LABELV $530
+endproc SP_team_CTF_bluespawn 0 0
+bss
+export neutralObelisk
+align 4
+LABELV neutralObelisk
+skip 4
+export teamgame
+align 4
+LABELV teamgame
+skip 36
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $498
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $494
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $448
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $445
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $442
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $439
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $433
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $432
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $406
+byte 1 68
+byte 1 111
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $397
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $372
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $368
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $348
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $347
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $341
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $313
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 84
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $307
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $294
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $238
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $236
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $220
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $209
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $98
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $93
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 115
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $88
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $87
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $84
+byte 1 94
+byte 1 52
+byte 1 0
+align 1
+LABELV $81
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $77
+byte 1 70
+byte 1 82
+byte 1 69
+byte 1 69
+byte 1 0
+align 1
+LABELV $76
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $73
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 0
+align 1
+LABELV $70
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 0
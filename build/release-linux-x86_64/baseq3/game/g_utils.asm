@@ -0,0 +1,3374 @@
+data
+export remapCount
+align 4
+LABELV remapCount
+byte 4 0
+export AddRemap
+code
+proc AddRemap 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $61
+JUMPV
+LABELV $58
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 remappedShaders
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $62
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 remappedShaders+64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 remappedShaders+128
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $57
+JUMPV
+LABELV $62
+LABELV $59
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $61
+ADDRLP4 0
+INDIRI4
+ADDRGP4 remapCount
+INDIRI4
+LTI4 $58
+ADDRGP4 remapCount
+INDIRI4
+CNSTI4 128
+GEI4 $66
+CNSTI4 132
+ADDRGP4 remapCount
+INDIRI4
+MULI4
+ADDRGP4 remappedShaders+64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 132
+ADDRGP4 remapCount
+INDIRI4
+MULI4
+ADDRGP4 remappedShaders
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 132
+ADDRGP4 remapCount
+INDIRI4
+MULI4
+ADDRGP4 remappedShaders+128
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 remapCount
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $66
+LABELV $57
+endproc AddRemap 8 8
+bss
+align 1
+LABELV $71
+skip 4096
+export BuildShaderStateConfig
+code
+proc BuildShaderStateConfig 144 24
+ADDRGP4 $71
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $72
+ADDRLP4 4
+ARGP4
+CNSTI4 133
+ARGI4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 140
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 remappedShaders
+ADDP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 remappedShaders+64
+ADDP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 remappedShaders+128
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $71
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $73
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $75
+ADDRLP4 0
+INDIRI4
+ADDRGP4 remapCount
+INDIRI4
+LTI4 $72
+ADDRGP4 $71
+RETP4
+LABELV $70
+endproc BuildShaderStateConfig 144 24
+export G_FindConfigstringIndex
+proc G_FindConfigstringIndex 1036 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $82
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $80
+LABELV $82
+CNSTI4 0
+RETI4
+ADDRGP4 $79
+JUMPV
+LABELV $80
+ADDRLP4 1024
+CNSTI4 1
+ASGNI4
+ADDRGP4 $86
+JUMPV
+LABELV $83
+ADDRFP4 4
+INDIRI4
+ADDRLP4 1024
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $87
+ADDRGP4 $85
+JUMPV
+LABELV $87
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $89
+ADDRLP4 1024
+INDIRI4
+RETI4
+ADDRGP4 $79
+JUMPV
+LABELV $89
+LABELV $84
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $86
+ADDRLP4 1024
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $83
+LABELV $85
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $91
+CNSTI4 0
+RETI4
+ADDRGP4 $79
+JUMPV
+LABELV $91
+ADDRLP4 1024
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $93
+ADDRGP4 $95
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $93
+ADDRFP4 4
+INDIRI4
+ADDRLP4 1024
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRLP4 1024
+INDIRI4
+RETI4
+LABELV $79
+endproc G_FindConfigstringIndex 1036 12
+export G_ModelIndex
+proc G_ModelIndex 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+CNSTI4 256
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 G_FindConfigstringIndex
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $96
+endproc G_ModelIndex 4 16
+export G_SoundIndex
+proc G_SoundIndex 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 273
+ARGI4
+CNSTI4 256
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 G_FindConfigstringIndex
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $97
+endproc G_SoundIndex 4 16
+export G_TeamCommand
+proc G_TeamCommand 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $99
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $104
+CNSTI4 888
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $106
+ADDRGP4 $108
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $106
+LABELV $104
+LABELV $100
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $102
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $99
+LABELV $98
+endproc G_TeamCommand 8 8
+export G_Find
+proc G_Find 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $110
+ADDRFP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRGP4 $115
+JUMPV
+LABELV $110
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+ADDRGP4 $115
+JUMPV
+LABELV $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $117
+ADDRGP4 $113
+JUMPV
+LABELV $117
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $119
+ADDRGP4 $113
+JUMPV
+LABELV $119
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $121
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $109
+JUMPV
+LABELV $121
+LABELV $113
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+LABELV $115
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTI4 868
+ADDRGP4 level+12
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+CVPU4 4
+LTU4 $112
+CNSTP4 0
+RETP4
+LABELV $109
+endproc G_Find 8 8
+export G_PickTarget
+proc G_PickTarget 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $128
+ADDRGP4 $126
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $123
+JUMPV
+LABELV $127
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 704
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $130
+ADDRGP4 $129
+JUMPV
+LABELV $130
+ADDRLP4 140
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+NEI4 $132
+ADDRGP4 $129
+JUMPV
+LABELV $132
+LABELV $128
+ADDRGP4 $127
+JUMPV
+LABELV $129
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $134
+ADDRGP4 $136
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $123
+JUMPV
+LABELV $134
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+RETP4
+LABELV $123
+endproc G_PickTarget 144 12
+export G_UseTargets
+proc G_UseTargets 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $138
+ADDRGP4 $137
+JUMPV
+LABELV $138
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $140
+ADDRLP4 12
+CNSTF4 981668463
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 AddRemap
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 BuildShaderStateConfig
+CALLP4
+ASGNP4
+CNSTI4 665
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $143
+ADDRGP4 $137
+JUMPV
+LABELV $143
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $146
+JUMPV
+LABELV $145
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $148
+ADDRGP4 $150
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $148
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $151
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $151
+LABELV $149
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $153
+ADDRGP4 $155
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $153
+LABELV $146
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 704
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $145
+LABELV $137
+endproc G_UseTargets 24 12
+bss
+align 4
+LABELV $157
+skip 4
+align 4
+LABELV $158
+skip 96
+export tv
+code
+proc tv 12 0
+ADDRLP4 4
+ADDRGP4 $157
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 $158
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $156
+endproc tv 12 0
+bss
+align 4
+LABELV $160
+skip 4
+align 1
+LABELV $161
+skip 256
+export vtos
+code
+proc vtos 16 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $160
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 $161
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $159
+endproc vtos 16 24
+data
+align 4
+LABELV $164
+byte 4 0
+byte 4 3212836864
+byte 4 0
+align 4
+LABELV $165
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $166
+byte 4 0
+byte 4 3221225472
+byte 4 0
+align 4
+LABELV $167
+byte 4 0
+byte 4 0
+byte 4 3212836864
+export G_SetMovedir
+code
+proc G_SetMovedir 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 0
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $168
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $165
+INDIRB
+ASGNB 12
+ADDRGP4 $169
+JUMPV
+LABELV $168
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $166
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $170
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $167
+INDIRB
+ASGNB 12
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $171
+LABELV $169
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $163
+endproc G_SetMovedir 16 16
+export vectoyaw
+proc vectoyaw 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEF4 $173
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEF4 $173
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $174
+JUMPV
+LABELV $173
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 0
+EQF4 $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1127481344
+ADDRLP4 16
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $177
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $178
+JUMPV
+LABELV $177
+ADDRLP4 0
+CNSTF4 1132920832
+ASGNF4
+LABELV $178
+LABELV $176
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $179
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $179
+LABELV $174
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $172
+endproc vectoyaw 20 8
+export G_InitGentity
+proc G_InitGentity 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 $182
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 868
+DIVI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+CNSTI4 1023
+ASGNI4
+LABELV $181
+endproc G_InitGentity 4 0
+export G_Spawn
+proc G_Spawn 16 20
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $184
+ADDRLP4 0
+ADDRGP4 g_entities+55552
+ASGNP4
+ADDRLP4 4
+CNSTI4 64
+ASGNI4
+ADDRGP4 $192
+JUMPV
+LABELV $189
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $194
+ADDRGP4 $190
+JUMPV
+LABELV $194
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $196
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 2000
+ADDI4
+LEI4 $196
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CNSTI4 1000
+GEI4 $196
+ADDRGP4 $190
+JUMPV
+LABELV $196
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_InitGentity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $183
+JUMPV
+LABELV $190
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+LABELV $192
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $189
+ADDRGP4 level+12
+INDIRI4
+CNSTI4 1022
+GEI4 $200
+ADDRGP4 $186
+JUMPV
+LABELV $200
+LABELV $185
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LTI4 $184
+LABELV $186
+ADDRGP4 level+12
+INDIRI4
+CNSTI4 1022
+NEI4 $203
+ADDRLP4 4
+CNSTI4 64
+ASGNI4
+ADDRGP4 $209
+JUMPV
+LABELV $206
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $211
+ADDRGP4 $207
+JUMPV
+LABELV $211
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_InitGentity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $183
+JUMPV
+LABELV $207
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $209
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $206
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $213
+ADDRGP4 $217
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 868
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+580
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $214
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $213
+ADDRGP4 $219
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $203
+ADDRLP4 12
+ADDRGP4 level+12
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+4
+INDIRP4
+ARGP4
+ADDRGP4 level+12
+INDIRI4
+ARGI4
+CNSTI4 868
+ARGI4
+ADDRGP4 level
+INDIRP4
+ARGP4
+CNSTI4 888
+ARGI4
+ADDRGP4 trap_LocateGameData
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_InitGentity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $183
+endproc G_Spawn 16 20
+export G_EntitiesFree
+proc G_EntitiesFree 8 0
+ADDRGP4 level+12
+INDIRI4
+CNSTI4 1022
+GEI4 $224
+CNSTI4 1
+RETI4
+ADDRGP4 $223
+JUMPV
+LABELV $224
+ADDRLP4 4
+ADDRGP4 g_entities+55552
+ASGNP4
+ADDRLP4 0
+CNSTI4 64
+ASGNI4
+ADDRGP4 $231
+JUMPV
+LABELV $228
+ADDRLP4 4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $233
+ADDRGP4 $229
+JUMPV
+LABELV $233
+CNSTI4 1
+RETI4
+ADDRGP4 $223
+JUMPV
+LABELV $229
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 868
+ADDP4
+ASGNP4
+LABELV $231
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $228
+CNSTI4 0
+RETI4
+LABELV $223
+endproc G_EntitiesFree 8 0
+export G_FreeEntity
+proc G_FreeEntity 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $236
+ADDRGP4 $235
+JUMPV
+LABELV $236
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 868
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 $238
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $235
+endproc G_FreeEntity 0 12
+export G_TempEntity
+proc G_TempEntity 20 8
+ADDRLP4 16
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 13
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 $241
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $240
+endproc G_TempEntity 20 8
+export G_KillBox
+proc G_KillBox 4168 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4136
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 4108
+ADDRLP4 4136
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108+4
+ADDRLP4 4136
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4148
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 4120
+ADDRLP4 4148
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+4
+ADDRLP4 4148
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108
+ARGP4
+ADDRLP4 4120
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4156
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $255
+JUMPV
+LABELV $252
+ADDRLP4 4
+CNSTI4 868
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $256
+ADDRGP4 $253
+JUMPV
+LABELV $256
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4164
+CNSTP4 0
+ASGNP4
+ADDRLP4 4164
+INDIRP4
+ARGP4
+ADDRLP4 4164
+INDIRP4
+ARGP4
+CNSTI4 100000
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 18
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $253
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $255
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $252
+LABELV $247
+endproc G_KillBox 4168 32
+export G_AddPredictableEvent
+proc G_AddPredictableEvent 0 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $259
+ADDRGP4 $258
+JUMPV
+LABELV $259
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+LABELV $258
+endproc G_AddPredictableEvent 0 12
+export G_AddEvent
+proc G_AddEvent 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $262
+ADDRGP4 $264
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $261
+JUMPV
+LABELV $262
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $265
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 128
+ASGNI4
+ADDRLP4 12
+CNSTI4 768
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+ADDI4
+ADDRLP4 12
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $265
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 768
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+ADDI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $261
+endproc G_AddEvent 16 8
+export G_Sound
+proc G_Sound 8 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ARGP4
+CNSTI4 42
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $269
+endproc G_Sound 8 8
+export G_SetOrigin
+proc G_SetOrigin 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $270
+endproc G_SetOrigin 8 0
+lit
+align 4
+LABELV $272
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export DebugLine
+code
+proc DebugLine 120 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 $272
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+36
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 60
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100
+CNSTI4 4
+ASGNI4
+ADDRLP4 60+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104
+CNSTI4 8
+ASGNI4
+ADDRLP4 60+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 84
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRF4
+MULF4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+CNSTF4 1065185444
+GTF4 $284
+ADDRLP4 84
+INDIRF4
+CNSTF4 3212669092
+GEF4 $282
+LABELV $284
+ADDRLP4 48
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 48+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $283
+JUMPV
+LABELV $282
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+LABELV $283
+ADDRLP4 48
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 112
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 0+12
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12+4
+ADDRLP4 0+12+4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12+8
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 0+24
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 0+24+4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+36
+ADDRLP4 0+36
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+36+4
+ADDRLP4 0+36+4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+36+8
+ADDRLP4 0+36+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_DebugPolygonCreate
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+RETI4
+LABELV $271
+endproc DebugLine 120 12
+bss
+export remappedShaders
+align 4
+LABELV remappedShaders
+skip 16896
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import G_TouchTriggers
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $264
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $241
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $238
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $219
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $217
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $182
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $162
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 0
+align 1
+LABELV $155
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $150
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $136
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 84
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $126
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 84
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $108
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $95
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $76
+byte 1 37
+byte 1 115
+byte 1 61
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 53
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 64
+byte 1 0
@@ -0,0 +1,6505 @@
+export G_BounceProjectile
+code
+proc G_BounceProjectile 68 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 44
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 3221225472
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 44
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 24
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 12
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1174405120
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1174405120
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1174405120
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $56
+endproc G_BounceProjectile 68 4
+export Weapon_Gauntlet
+proc Weapon_Gauntlet 0 0
+LABELV $67
+endproc Weapon_Gauntlet 0 0
+export CheckGauntletAttack
+proc CheckGauntletAttack 108 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 right
+ARGP4
+ADDRGP4 up
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 right
+ARGP4
+ADDRGP4 up
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 CalcMuzzlePoint
+CALLV
+pop
+ADDRLP4 80
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 60
+ADDRGP4 muzzle
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDRGP4 forward
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60+4
+ADDRGP4 muzzle+4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDRGP4 forward+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60+8
+ADDRGP4 muzzle+8
+INDIRF4
+CNSTF4 1107296256
+ADDRGP4 forward+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRLP4 84
+CNSTP4 0
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $75
+CNSTI4 0
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $75
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $79
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $79
+ADDRLP4 4+12
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 92
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4+24
+ARGP4
+ADDRLP4 96
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 200
+ASGNI4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $79
+ADDRLP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $83
+CNSTI4 0
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $83
+ADDRGP4 PW_QUAD
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $85
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 59
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 s_quadFactor
+ADDRGP4 g_quadfactor+8
+INDIRF4
+ASGNF4
+ADDRGP4 $86
+JUMPV
+LABELV $85
+ADDRGP4 s_quadFactor
+CNSTF4 1065353216
+ASGNF4
+LABELV $86
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 96
+CNSTU4 0
+ASGNU4
+ADDRLP4 92
+INDIRP4
+CVPU4 4
+ADDRLP4 96
+INDIRU4
+EQU4 $88
+ADDRLP4 100
+ADDRLP4 92
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+CVPU4 4
+ADDRLP4 96
+INDIRU4
+EQU4 $88
+ADDRLP4 100
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_DOUBLER
+INDIRI4
+NEI4 $88
+ADDRLP4 104
+ADDRGP4 s_quadFactor
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $88
+ADDRLP4 76
+CNSTF4 1112014848
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $68
+endproc CheckGauntletAttack 108 32
+export SnapVectorTowards
+proc SnapVectorTowards 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $92
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+GTF4 $96
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 ceil
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $97
+LABELV $93
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $92
+LABELV $91
+endproc SnapVectorTowards 16 4
+export Bullet_Fire
+proc Bullet_Fire 168 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 84
+CNSTF4 1073741824
+CNSTF4 1078530011
+ADDRLP4 116
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 120
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 100
+CNSTF4 1098907648
+ADDRLP4 120
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 124
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDRFP4 4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 128
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 84
+CNSTF4 1098907648
+ADDRLP4 128
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 132
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDRFP4 4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 136
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 64
+ADDRGP4 muzzle
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDRGP4 forward
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRGP4 muzzle+4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDRGP4 forward+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRGP4 muzzle+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 forward+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 64
+INDIRF4
+ADDRGP4 right
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 64+4
+INDIRF4
+ADDRGP4 right+4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRLP4 64+8
+INDIRF4
+ADDRGP4 right+8
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 64
+INDIRF4
+ADDRGP4 up
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 64+4
+INDIRF4
+ADDRGP4 up+4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRLP4 64+8
+INDIRF4
+ADDRGP4 up+8
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+LABELV $117
+ADDRLP4 4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $121
+ADDRGP4 $98
+JUMPV
+LABELV $121
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4+12
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 SnapVectorTowards
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $126
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $126
+ADDRLP4 4+12
+ARGP4
+CNSTI4 45
+ARGI4
+ADDRLP4 156
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 LogAccuracyHit
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $127
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 756
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 4+12
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 156
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 4+24
+ARGP4
+ADDRLP4 160
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+LABELV $127
+ADDRLP4 60
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $119
+ADDRLP4 156
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $135
+ADDRLP4 156
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $135
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 160
+ADDRGP4 G_InvulnerabilityEffect
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $138
+ADDRGP4 muzzle
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 G_BounceProjectile
+CALLV
+pop
+ADDRGP4 muzzle
+ADDRLP4 88
+INDIRB
+ASGNB 12
+ADDRLP4 80
+CNSTI4 1023
+ASGNI4
+ADDRGP4 $118
+JUMPV
+LABELV $138
+ADDRGP4 muzzle
+ADDRLP4 4+12
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $118
+JUMPV
+LABELV $135
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $119
+JUMPV
+LABELV $118
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 10
+LTI4 $117
+LABELV $119
+LABELV $98
+endproc Bullet_Fire 168 32
+export BFG_Fire
+proc BFG_Fire 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4
+ADDRGP4 fire_bfg
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $143
+endproc BFG_Fire 16 12
+export ShotgunPellet
+proc ShotgunPellet 140 32
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $145
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 124
+CNSTP4 0
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $150
+CNSTI4 0
+RETI4
+ADDRGP4 $144
+JUMPV
+LABELV $150
+ADDRLP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $153
+ADDRLP4 92
+CNSTF4 1092616192
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $155
+ADDRLP4 128
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $155
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 132
+ADDRGP4 G_InvulnerabilityEffect
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $158
+ADDRLP4 64
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 G_BounceProjectile
+CALLV
+pop
+ADDRLP4 64
+ADDRLP4 100
+INDIRB
+ASGNB 12
+ADDRLP4 76
+CNSTI4 1023
+ASGNI4
+ADDRGP4 $146
+JUMPV
+LABELV $158
+ADDRLP4 64
+ADDRLP4 4+12
+INDIRB
+ASGNB 12
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $146
+JUMPV
+LABELV $155
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 LogAccuracyHit
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $162
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+LABELV $162
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 92
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRLP4 96
+INDIRI4
+RETI4
+ADDRGP4 $144
+JUMPV
+LABELV $153
+CNSTI4 0
+RETI4
+ADDRGP4 $144
+JUMPV
+LABELV $146
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LTI4 $145
+CNSTI4 0
+RETI4
+LABELV $144
+endproc ShotgunPellet 140 32
+export ShotgunPattern
+proc ShotgunPattern 104 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $166
+ADDRFP4 8
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1098907648
+CNSTF4 1143930880
+ADDRLP4 64
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1098907648
+CNSTF4 1143930880
+ADDRLP4 68
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1207959552
+ADDRLP4 20+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 ShotgunPellet
+CALLI4
+ASGNI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $186
+ADDRLP4 60
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $186
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRLP4 60
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 12
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 756
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $186
+LABELV $167
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 11
+LTI4 $166
+LABELV $165
+endproc ShotgunPattern 104 12
+export weapon_supershotgun_fire
+proc weapon_supershotgun_fire 20 16
+ADDRGP4 muzzle
+ARGP4
+CNSTI4 51
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1166016512
+ADDRGP4 forward
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1166016512
+ADDRGP4 forward+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1166016512
+ADDRGP4 forward+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ShotgunPattern
+CALLV
+pop
+LABELV $188
+endproc weapon_supershotgun_fire 20 16
+export weapon_grenadelauncher_fire
+proc weapon_grenadelauncher_fire 20 12
+ADDRLP4 4
+ADDRGP4 forward+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 8
+ADDRGP4 fire_grenade
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $191
+endproc weapon_grenadelauncher_fire 20 12
+export Weapon_RocketLauncher_Fire
+proc Weapon_RocketLauncher_Fire 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4
+ADDRGP4 fire_rocket
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $193
+endproc Weapon_RocketLauncher_Fire 16 12
+export Weapon_Plasmagun_Fire
+proc Weapon_Plasmagun_Fire 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4
+ADDRGP4 fire_plasma
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $194
+endproc Weapon_Plasmagun_Fire 16 12
+export weapon_railgun_fire
+proc weapon_railgun_fire 200 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 132
+CNSTF4 1120403456
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 136
+CNSTF4 1174405120
+ASGNF4
+ADDRLP4 88
+ADDRGP4 muzzle
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDRGP4 forward
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88+4
+ADDRGP4 muzzle+4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDRGP4 forward+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88+8
+ADDRGP4 muzzle+8
+INDIRF4
+CNSTF4 1174405120
+ADDRGP4 forward+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $202
+ADDRLP4 4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRLP4 144
+CNSTP4 0
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 100
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 4+52
+INDIRI4
+CNSTI4 1022
+LTI4 $205
+ADDRGP4 $204
+JUMPV
+LABELV $205
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 4+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $209
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $211
+ADDRLP4 4+12
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 152
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4+24
+ARGP4
+ADDRLP4 156
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRLP4 160
+CNSTI4 176
+ASGNI4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $211
+ADDRLP4 148
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $215
+ADDRLP4 148
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $215
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRLP4 152
+ADDRGP4 G_InvulnerabilityEffect
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRGP4 muzzle
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 G_BounceProjectile
+CALLV
+pop
+ADDRLP4 4+12
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 SnapVectorTowards
+CALLV
+pop
+ADDRLP4 4+12
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRLP4 156
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 160
+CNSTI4 176
+ASGNI4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 muzzle
+INDIRB
+ASGNB 12
+ADDRLP4 164
+ADDRLP4 64
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 right
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168
+ADDRLP4 64
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 right+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 64
+INDIRP4
+CNSTI4 120
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 right+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 64
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRF4
+CNSTF4 3212836864
+ADDRGP4 up
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 64
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRF4
+CNSTF4 3212836864
+ADDRGP4 up+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 64
+INDIRP4
+CNSTI4 120
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRF4
+CNSTF4 3212836864
+ADDRGP4 up+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRGP4 muzzle
+ADDRLP4 104
+INDIRB
+ASGNB 12
+ADDRLP4 100
+CNSTI4 1023
+ASGNI4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 LogAccuracyHit
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $227
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $227
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 132
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $216
+LABELV $209
+ADDRLP4 4+48
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $230
+ADDRGP4 $204
+JUMPV
+LABELV $230
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 72
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $203
+ADDRLP4 60
+INDIRI4
+CNSTI4 4
+LTI4 $202
+LABELV $204
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $236
+JUMPV
+LABELV $233
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 72
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $234
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $236
+ADDRLP4 68
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LTI4 $233
+ADDRLP4 4+12
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 SnapVectorTowards
+CALLV
+pop
+ADDRLP4 4+12
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRLP4 144
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 148
+CNSTI4 176
+ASGNI4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 muzzle
+INDIRB
+ASGNB 12
+ADDRLP4 152
+ADDRLP4 64
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 right
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 64
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 right+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 64
+INDIRP4
+CNSTI4 120
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 right+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 64
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+CNSTF4 3212836864
+ADDRGP4 up
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168
+ADDRLP4 64
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRF4
+CNSTF4 3212836864
+ADDRGP4 up+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 64
+INDIRP4
+CNSTI4 120
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRF4
+CNSTF4 3212836864
+ADDRGP4 up+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $243
+ADDRLP4 64
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRLP4 4+24
+ARGP4
+ADDRLP4 176
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+LABELV $244
+ADDRLP4 176
+CNSTI4 176
+ASGNI4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $247
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 748
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $248
+JUMPV
+LABELV $247
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 748
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRI4
+CNSTI4 2
+LTI4 $249
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 748
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRLP4 188
+ADDRGP4 PERS_IMPRESSIVE_COUNT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRI4
+CNSTI4 32768
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $249
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 756
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $248
+LABELV $195
+endproc weapon_railgun_fire 200 32
+export Weapon_GrapplingHook_Fire
+proc Weapon_GrapplingHook_Fire 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $253
+ADDRLP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $253
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 fire_grapple
+CALLP4
+pop
+LABELV $253
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 796
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $252
+endproc Weapon_GrapplingHook_Fire 4 12
+export Weapon_HookFree
+proc Weapon_HookFree 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 800
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -2049
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+LABELV $255
+endproc Weapon_HookFree 4 4
+export Weapon_HookThink
+proc Weapon_HookThink 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $257
+ADDRLP4 28
+CNSTI4 544
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0+4
+ADDRLP4 44
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0+8
+ADDRLP4 48
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 48
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 SnapVectorTowards
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $256
+endproc Weapon_HookThink 52 8
+export Weapon_LightningFire
+proc Weapon_LightningFire 136 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 96
+CNSTF4 1090519040
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+LABELV $262
+ADDRLP4 112
+CNSTF4 1145044992
+ASGNF4
+ADDRLP4 0
+ADDRGP4 muzzle
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRGP4 forward
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 muzzle+4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRGP4 forward+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 muzzle+8
+INDIRF4
+CNSTF4 1145044992
+ADDRGP4 forward+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRLP4 116
+CNSTP4 0
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $272
+ADDRGP4 muzzle
+ARGP4
+CNSTI4 203
+ARGI4
+ADDRLP4 120
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+LABELV $272
+ADDRLP4 16+52
+INDIRI4
+CNSTI4 1023
+NEI4 $279
+ADDRGP4 $261
+JUMPV
+LABELV $279
+ADDRLP4 12
+CNSTI4 868
+ADDRLP4 16+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $283
+ADDRLP4 120
+ADDRLP4 12
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $285
+ADDRLP4 120
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $285
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 16+12
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 124
+ADDRGP4 G_InvulnerabilityEffect
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $288
+ADDRGP4 muzzle
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_BounceProjectile
+CALLV
+pop
+ADDRGP4 muzzle
+ADDRLP4 84
+INDIRB
+ASGNB 12
+ADDRGP4 forward
+ADDRLP4 0
+INDIRF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 forward+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 forward+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 80
+CNSTI4 1023
+ASGNI4
+ADDRGP4 $263
+JUMPV
+LABELV $288
+ADDRGP4 muzzle
+ADDRLP4 16+12
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $263
+JUMPV
+LABELV $285
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 LogAccuracyHit
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $298
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 756
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $298
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 16+12
+ARGP4
+ADDRLP4 96
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $283
+ADDRLP4 12
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $301
+ADDRLP4 12
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $301
+ADDRLP4 16+12
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 124
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16+24
+ARGP4
+ADDRLP4 128
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 200
+ASGNI4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $264
+JUMPV
+LABELV $301
+ADDRLP4 16+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $264
+ADDRLP4 16+12
+ARGP4
+CNSTI4 48
+ARGI4
+ADDRLP4 124
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 16+24
+ARGP4
+ADDRLP4 128
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRGP4 $264
+JUMPV
+LABELV $263
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 10
+LTI4 $262
+LABELV $264
+LABELV $261
+endproc Weapon_LightningFire 136 32
+export Weapon_Nailgun_Fire
+proc Weapon_Nailgun_Fire 20 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $311
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 right
+ARGP4
+ADDRGP4 up
+ARGP4
+ADDRLP4 8
+ADDRGP4 fire_nail
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $312
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 15
+LTI4 $311
+LABELV $310
+endproc Weapon_Nailgun_Fire 20 20
+export weapon_proxlauncher_fire
+proc weapon_proxlauncher_fire 20 12
+ADDRLP4 4
+ADDRGP4 forward+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 8
+ADDRGP4 fire_prox
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $315
+endproc weapon_proxlauncher_fire 20 12
+export LogAccuracyHit
+proc LogAccuracyHit 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $318
+CNSTI4 0
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $318
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+NEU4 $320
+CNSTI4 0
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $320
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $322
+CNSTI4 0
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $322
+ADDRFP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $324
+CNSTI4 0
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $324
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $326
+CNSTI4 0
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $328
+CNSTI4 0
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $328
+CNSTI4 1
+RETI4
+LABELV $317
+endproc LogAccuracyHit 4 8
+export CalcMuzzlePoint
+proc CalcMuzzlePoint 36 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 16
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 20
+ADDRFP4 16
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $330
+endproc CalcMuzzlePoint 36 0
+export CalcMuzzlePointOrigin
+proc CalcMuzzlePointOrigin 36 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 20
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 20
+ADDRFP4 20
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $331
+endproc CalcMuzzlePointOrigin 36 0
+export FireWeapon
+proc FireWeapon 28 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 PW_QUAD
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $333
+ADDRGP4 s_quadFactor
+ADDRGP4 g_quadfactor+8
+INDIRF4
+ASGNF4
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRGP4 s_quadFactor
+CNSTF4 1065353216
+ASGNF4
+LABELV $334
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $336
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $336
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_DOUBLER
+INDIRI4
+NEI4 $336
+ADDRLP4 12
+ADDRGP4 s_quadFactor
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTF4 1073741824
+ADDRLP4 12
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $336
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+EQI4 $338
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $340
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 752
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 15
+ADDI4
+ASGNI4
+ADDRGP4 $341
+JUMPV
+LABELV $340
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 752
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $341
+LABELV $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 right
+ARGP4
+ADDRGP4 up
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 708
+ADDP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 right
+ARGP4
+ADDRGP4 up
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 CalcMuzzlePointOrigin
+CALLV
+pop
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+LTI4 $343
+ADDRLP4 20
+INDIRI4
+CNSTI4 14
+GTI4 $343
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $362-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $362
+address $345
+address $348
+address $347
+address $353
+address $354
+address $346
+address $356
+address $355
+address $357
+address $358
+address $359
+address $360
+address $361
+address $352
+code
+LABELV $345
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_Gauntlet
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $346
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_LightningFire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $347
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 weapon_supershotgun_fire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $348
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $349
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1128792064
+ARGF4
+CNSTI4 7
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 Bullet_Fire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $349
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1128792064
+ARGF4
+CNSTI4 5
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 Bullet_Fire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $352
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1128792064
+ARGF4
+CNSTI4 8
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 Bullet_Fire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 weapon_grenadelauncher_fire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $354
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_RocketLauncher_Fire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $355
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_Plasmagun_Fire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $356
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 weapon_railgun_fire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $357
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BFG_Fire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $358
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_GrapplingHook_Fire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $359
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_Nailgun_Fire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $360
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 weapon_proxlauncher_fire
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $361
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1142292480
+ARGF4
+CNSTI4 7
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRGP4 Bullet_Fire
+CALLV
+pop
+LABELV $343
+LABELV $332
+endproc FireWeapon 28 24
+proc KamikazeRadiusDamage 4180 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRF4
+CNSTF4 1065353216
+GEF4 $365
+ADDRFP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $365
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $367
+ADDRLP4 4164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4164
+INDIRI4
+ADDRLP4 4140
+ADDP4
+ADDRLP4 4164
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4168
+INDIRI4
+ADDRLP4 4152
+ADDP4
+ADDRLP4 4168
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $368
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $367
+ADDRLP4 4140
+ARGP4
+ADDRLP4 4152
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4164
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 4136
+ADDRLP4 4164
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $371
+ADDRLP4 4
+CNSTI4 868
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $375
+ADDRGP4 $372
+JUMPV
+LABELV $375
+ADDRLP4 4
+INDIRP4
+CNSTI4 836
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $377
+ADDRGP4 $372
+JUMPV
+LABELV $377
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $380
+ADDRLP4 4168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4168
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4168
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDP4
+INDIRF4
+GEF4 $384
+ADDRLP4 4172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4172
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4172
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4172
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRLP4 4172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4172
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4172
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRF4
+LEF4 $386
+ADDRLP4 4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $387
+JUMPV
+LABELV $386
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $387
+LABELV $385
+LABELV $381
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $380
+ADDRLP4 8
+ARGP4
+ADDRLP4 4168
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 4168
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 12
+INDIRF4
+LTF4 $388
+ADDRGP4 $372
+JUMPV
+LABELV $388
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20+8
+ADDRLP4 20+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTI4 26
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 836
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+LABELV $372
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $374
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4136
+INDIRI4
+LTI4 $371
+LABELV $364
+endproc KamikazeRadiusDamage 4180 32
+proc KamikazeShockWave 4180 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRF4
+CNSTF4 1065353216
+GEF4 $395
+ADDRFP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $395
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $397
+ADDRLP4 4164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4164
+INDIRI4
+ADDRLP4 4140
+ADDP4
+ADDRLP4 4164
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4168
+INDIRI4
+ADDRLP4 4152
+ADDP4
+ADDRLP4 4168
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $398
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $397
+ADDRLP4 4140
+ARGP4
+ADDRLP4 4152
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4164
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 4136
+ADDRLP4 4164
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $404
+JUMPV
+LABELV $401
+ADDRLP4 4
+CNSTI4 868
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 840
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $405
+ADDRGP4 $402
+JUMPV
+LABELV $405
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $408
+ADDRLP4 4168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4168
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4168
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDP4
+INDIRF4
+GEF4 $412
+ADDRLP4 4172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4172
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4172
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4172
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 4172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4172
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4172
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRF4
+LEF4 $414
+ADDRLP4 4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $415
+JUMPV
+LABELV $414
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $415
+LABELV $413
+LABELV $409
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $408
+ADDRLP4 8
+ARGP4
+ADDRLP4 4168
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 4168
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRF4
+LTF4 $416
+ADDRGP4 $402
+JUMPV
+LABELV $416
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20+8
+ADDRLP4 20+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTI4 26
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $422
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 20+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+LABELV $422
+ADDRLP4 4
+INDIRP4
+CNSTI4 840
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+LABELV $402
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $404
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4136
+INDIRI4
+LTI4 $401
+LABELV $394
+endproc KamikazeShockWave 4180 32
+proc KamikazeDamage 64 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $427
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1137180672
+ARGF4
+CNSTI4 1320
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+MULI4
+CNSTI4 2000
+DIVI4
+CVIF4 4
+ARGF4
+ADDRGP4 KamikazeShockWave
+CALLV
+pop
+LABELV $427
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+CNSTI4 250
+LTI4 $429
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+CNSTI4 250
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 1137180672
+ARGF4
+CNSTI4 720
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+MULI4
+CNSTI4 1750
+DIVI4
+CVIF4 4
+ARGF4
+ADDRGP4 KamikazeRadiusDamage
+CALLV
+pop
+LABELV $429
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+CNSTI4 2000
+LTI4 $431
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $426
+JUMPV
+LABELV $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 32
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $436
+ADDRLP4 0
+CNSTI4 868
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $440
+ADDRGP4 $437
+JUMPV
+LABELV $440
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $442
+ADDRGP4 $437
+JUMPV
+LABELV $442
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $444
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 1123024896
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1123024896
+CNSTF4 1073741824
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1103626240
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+LABELV $444
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTF4 1199570944
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ADDI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTF4 1199570944
+ADDRLP4 4+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTF4 1199570944
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ADDI4
+ASGNI4
+LABELV $437
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 64
+LTI4 $436
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+LABELV $426
+endproc KamikazeDamage 64 20
+export G_StartKamikaze
+proc G_StartKamikaze 44 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 80
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $450
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $451
+JUMPV
+LABELV $450
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $451
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRGP4 $456
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 836
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 KamikazeDamage
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $459
+ADDRLP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 100000
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 26
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $463
+ARGP4
+ADDRLP4 32
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $461
+ADDRLP4 36
+CNSTI4 824
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+CNSTI4 868
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+CNSTI4 568
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRGP4 $462
+JUMPV
+LABELV $461
+ADDRLP4 36
+CNSTI4 824
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $462
+LABELV $460
+ADDRLP4 4
+ARGP4
+CNSTI4 44
+ARGI4
+ADDRLP4 32
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 16
+INDIRP4
+CNSTI4 480
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 13
+ASGNI4
+LABELV $448
+endproc G_StartKamikaze 44 32
+bss
+align 4
+LABELV muzzle
+skip 12
+align 4
+LABELV up
+skip 12
+align 4
+LABELV right
+skip 12
+align 4
+LABELV forward
+skip 12
+align 4
+LABELV s_quadFactor
+skip 4
+import G_Say
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_debugPingValue
+import g_weapon_plasma_speed
+import g_weapon_rocket_speed
+import g_levelStartTime
+import g_localTeamPref
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DuelScores
+import DeathmatchScoreboardMessage
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $463
+byte 1 98
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $456
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
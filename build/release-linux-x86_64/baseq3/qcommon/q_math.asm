@@ -0,0 +1,8655 @@
+code
+proc VectorCompare 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+NEF4 $12
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+NEF4 $12
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+EQF4 $9
+LABELV $12
+CNSTI4 0
+RETI4
+ADDRGP4 $8
+JUMPV
+LABELV $9
+CNSTI4 1
+RETI4
+LABELV $8
+endproc VectorCompare 16 0
+proc VectorLength 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+RETF4
+LABELV $13
+endproc VectorLength 20 4
+proc VectorLengthSquared 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $14
+endproc VectorLengthSquared 16 0
+proc Distance 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+RETF4
+LABELV $15
+endproc Distance 32 4
+proc DistanceSquared 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $18
+endproc DistanceSquared 32 0
+proc VectorNormalizeFast 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Q_rsqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $25
+endproc VectorNormalizeFast 36 4
+proc VectorInverse 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $26
+endproc VectorInverse 12 0
+proc CrossProduct 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $27
+endproc CrossProduct 40 0
+data
+export vec3_origin
+align 4
+LABELV vec3_origin
+byte 4 0
+byte 4 0
+byte 4 0
+export axisDefault
+align 4
+LABELV axisDefault
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export g_color_table
+align 4
+LABELV g_color_table
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065286107
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065286107
+byte 4 0
+byte 4 1065353216
+byte 4 1065286107
+byte 4 1065286107
+byte 4 0
+byte 4 1065353216
+byte 4 1044952121
+byte 4 1053609165
+byte 4 1065286107
+byte 4 1065353216
+byte 4 0
+byte 4 1065286107
+byte 4 1065286107
+byte 4 1065353216
+byte 4 1065286107
+byte 4 0
+byte 4 1065286107
+byte 4 1065353216
+byte 4 1065286107
+byte 4 1065286107
+byte 4 1065286107
+byte 4 1065353216
+export g_color_table_ql
+align 4
+LABELV g_color_table_ql
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065286107
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065286107
+byte 4 0
+byte 4 1065353216
+byte 4 1065286107
+byte 4 1065286107
+byte 4 0
+byte 4 1065353216
+byte 4 1044952121
+byte 4 1053609165
+byte 4 1065286107
+byte 4 1065353216
+byte 4 0
+byte 4 1065286107
+byte 4 1065286107
+byte 4 1065353216
+byte 4 1065286107
+byte 4 0
+byte 4 1065286107
+byte 4 1065353216
+byte 4 1065286107
+byte 4 1065286107
+byte 4 1065286107
+byte 4 1065353216
+export g_color_table_q3
+align 4
+LABELV g_color_table_q3
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export colorBlack
+align 4
+LABELV colorBlack
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export colorRed
+align 4
+LABELV colorRed
+byte 4 1064682127
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export colorGreen
+align 4
+LABELV colorGreen
+byte 4 0
+byte 4 1064682127
+byte 4 0
+byte 4 1065353216
+export colorBlue
+align 4
+LABELV colorBlue
+byte 4 1044952121
+byte 4 1053609165
+byte 4 1064682127
+byte 4 1065353216
+export colorYellow
+align 4
+LABELV colorYellow
+byte 4 1064682127
+byte 4 1064682127
+byte 4 0
+byte 4 1065353216
+export colorMagenta
+align 4
+LABELV colorMagenta
+byte 4 1064682127
+byte 4 0
+byte 4 1064682127
+byte 4 1065353216
+export colorCyan
+align 4
+LABELV colorCyan
+byte 4 0
+byte 4 1064682127
+byte 4 1064682127
+byte 4 1065353216
+export colorWhite
+align 4
+LABELV colorWhite
+byte 4 1064682127
+byte 4 1064682127
+byte 4 1064682127
+byte 4 1065353216
+export colorLtGrey
+align 4
+LABELV colorLtGrey
+byte 4 1061158912
+byte 4 1061158912
+byte 4 1061158912
+byte 4 1065353216
+export colorMdGrey
+align 4
+LABELV colorMdGrey
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1065353216
+export colorDkGrey
+align 4
+LABELV colorDkGrey
+byte 4 1048576000
+byte 4 1048576000
+byte 4 1048576000
+byte 4 1065353216
+export qlcolorRed
+align 4
+LABELV qlcolorRed
+byte 4 1064682127
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export qlcolorGreen
+align 4
+LABELV qlcolorGreen
+byte 4 0
+byte 4 1064682127
+byte 4 0
+byte 4 1065353216
+export qlcolorBlue
+align 4
+LABELV qlcolorBlue
+byte 4 1044952121
+byte 4 1053609165
+byte 4 1064682127
+byte 4 1065353216
+export qlcolorYellow
+align 4
+LABELV qlcolorYellow
+byte 4 1064682127
+byte 4 1064682127
+byte 4 0
+byte 4 1065353216
+export qlcolorMagenta
+align 4
+LABELV qlcolorMagenta
+byte 4 1064682127
+byte 4 0
+byte 4 1064682127
+byte 4 1065353216
+export qlcolorCyan
+align 4
+LABELV qlcolorCyan
+byte 4 0
+byte 4 1064682127
+byte 4 1064682127
+byte 4 1065353216
+export qlcolorWhite
+align 4
+LABELV qlcolorWhite
+byte 4 1064682127
+byte 4 1064682127
+byte 4 1064682127
+byte 4 1065353216
+export q3colorRed
+align 4
+LABELV q3colorRed
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export q3colorGreen
+align 4
+LABELV q3colorGreen
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+export q3colorBlue
+align 4
+LABELV q3colorBlue
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+export q3colorYellow
+align 4
+LABELV q3colorYellow
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+export q3colorMagenta
+align 4
+LABELV q3colorMagenta
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+export q3colorCyan
+align 4
+LABELV q3colorCyan
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export q3colorWhite
+align 4
+LABELV q3colorWhite
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export Q_SetColors
+code
+proc Q_SetColors 20 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $46
+ADDRGP4 colorRed
+ADDRGP4 qlcolorRed
+INDIRF4
+ASGNF4
+ADDRGP4 colorRed+4
+ADDRGP4 qlcolorRed+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorRed+8
+ADDRGP4 qlcolorRed+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorRed+12
+ADDRGP4 qlcolorRed+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorGreen
+ADDRGP4 qlcolorGreen
+INDIRF4
+ASGNF4
+ADDRGP4 colorGreen+4
+ADDRGP4 qlcolorGreen+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorGreen+8
+ADDRGP4 qlcolorGreen+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorGreen+12
+ADDRGP4 qlcolorGreen+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlue
+ADDRGP4 qlcolorBlue
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlue+4
+ADDRGP4 qlcolorBlue+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlue+8
+ADDRGP4 qlcolorBlue+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlue+12
+ADDRGP4 qlcolorBlue+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorYellow
+ADDRGP4 qlcolorYellow
+INDIRF4
+ASGNF4
+ADDRGP4 colorYellow+4
+ADDRGP4 qlcolorYellow+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorYellow+8
+ADDRGP4 qlcolorYellow+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorYellow+12
+ADDRGP4 qlcolorYellow+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorMagenta
+ADDRGP4 qlcolorMagenta
+INDIRF4
+ASGNF4
+ADDRGP4 colorMagenta+4
+ADDRGP4 qlcolorMagenta+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorMagenta+8
+ADDRGP4 qlcolorMagenta+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorMagenta+12
+ADDRGP4 qlcolorMagenta+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorCyan
+ADDRGP4 qlcolorCyan
+INDIRF4
+ASGNF4
+ADDRGP4 colorCyan+4
+ADDRGP4 qlcolorCyan+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorCyan+8
+ADDRGP4 qlcolorCyan+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorCyan+12
+ADDRGP4 qlcolorCyan+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorWhite
+ADDRGP4 qlcolorWhite
+INDIRF4
+ASGNF4
+ADDRGP4 colorWhite+4
+ADDRGP4 qlcolorWhite+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorWhite+8
+ADDRGP4 qlcolorWhite+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorWhite+12
+ADDRGP4 qlcolorWhite+12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $90
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_color_table
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_color_table_ql
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_color_table+4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_color_table_ql+4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_color_table+8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_color_table_ql+8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_color_table+12
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_color_table_ql+12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $91
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $90
+ADDRGP4 $47
+JUMPV
+LABELV $46
+ADDRGP4 colorRed
+ADDRGP4 q3colorRed
+INDIRF4
+ASGNF4
+ADDRGP4 colorRed+4
+ADDRGP4 q3colorRed+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorRed+8
+ADDRGP4 q3colorRed+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorRed+12
+ADDRGP4 q3colorRed+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorGreen
+ADDRGP4 q3colorGreen
+INDIRF4
+ASGNF4
+ADDRGP4 colorGreen+4
+ADDRGP4 q3colorGreen+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorGreen+8
+ADDRGP4 q3colorGreen+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorGreen+12
+ADDRGP4 q3colorGreen+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlue
+ADDRGP4 q3colorBlue
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlue+4
+ADDRGP4 q3colorBlue+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlue+8
+ADDRGP4 q3colorBlue+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlue+12
+ADDRGP4 q3colorBlue+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorYellow
+ADDRGP4 q3colorYellow
+INDIRF4
+ASGNF4
+ADDRGP4 colorYellow+4
+ADDRGP4 q3colorYellow+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorYellow+8
+ADDRGP4 q3colorYellow+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorYellow+12
+ADDRGP4 q3colorYellow+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorMagenta
+ADDRGP4 q3colorMagenta
+INDIRF4
+ASGNF4
+ADDRGP4 colorMagenta+4
+ADDRGP4 q3colorMagenta+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorMagenta+8
+ADDRGP4 q3colorMagenta+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorMagenta+12
+ADDRGP4 q3colorMagenta+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorCyan
+ADDRGP4 q3colorCyan
+INDIRF4
+ASGNF4
+ADDRGP4 colorCyan+4
+ADDRGP4 q3colorCyan+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorCyan+8
+ADDRGP4 q3colorCyan+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorCyan+12
+ADDRGP4 q3colorCyan+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorWhite
+ADDRGP4 q3colorWhite
+INDIRF4
+ASGNF4
+ADDRGP4 colorWhite+4
+ADDRGP4 q3colorWhite+4
+INDIRF4
+ASGNF4
+ADDRGP4 colorWhite+8
+ADDRGP4 q3colorWhite+8
+INDIRF4
+ASGNF4
+ADDRGP4 colorWhite+12
+ADDRGP4 q3colorWhite+12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $142
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_color_table
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_color_table_q3
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_color_table+4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_color_table_q3+4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_color_table+8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_color_table_q3+8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_color_table+12
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_color_table_q3+12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $143
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $142
+LABELV $47
+ADDRLP4 4
+CNSTF4 1061158912
+ASGNF4
+ADDRGP4 colorLtGrey
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorLtGrey+4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorLtGrey+8
+CNSTF4 1061158912
+ASGNF4
+ADDRGP4 colorLtGrey+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 colorMdGrey
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorMdGrey+4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorMdGrey+8
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 colorMdGrey+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+CNSTF4 1048576000
+ASGNF4
+ADDRGP4 colorDkGrey
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorDkGrey+4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorDkGrey+8
+CNSTF4 1048576000
+ASGNF4
+ADDRGP4 colorDkGrey+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $45
+endproc Q_SetColors 20 0
+export Q_SetColorTable
+proc Q_SetColorTable 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+LEI4 $162
+ADDRGP4 $164
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $162
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $165
+ADDRGP4 colorLtGrey
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorLtGrey+4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorLtGrey+8
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorLtGrey+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $166
+JUMPV
+LABELV $165
+ADDRFP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $170
+ADDRGP4 colorMdGrey
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorMdGrey+4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorMdGrey+8
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorMdGrey+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $175
+ADDRGP4 colorDkGrey
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorDkGrey+4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorDkGrey+8
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorDkGrey+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+4
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+8
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+12
+ADDP4
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $184
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $184
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $217
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $217
+address $185
+address $189
+address $193
+address $197
+address $201
+address $205
+address $209
+address $213
+code
+LABELV $185
+ADDRGP4 colorBlack
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack+4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack+8
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $184
+JUMPV
+LABELV $189
+ADDRGP4 colorRed
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorRed+4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorRed+8
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorRed+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $184
+JUMPV
+LABELV $193
+ADDRGP4 colorGreen
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorGreen+4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorGreen+8
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorGreen+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $184
+JUMPV
+LABELV $197
+ADDRGP4 colorYellow
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorYellow+4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorYellow+8
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorYellow+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $184
+JUMPV
+LABELV $201
+ADDRGP4 colorBlue
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlue+4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlue+8
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlue+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $184
+JUMPV
+LABELV $205
+ADDRGP4 colorCyan
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorCyan+4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorCyan+8
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorCyan+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $184
+JUMPV
+LABELV $209
+ADDRGP4 colorMagenta
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorMagenta+4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorMagenta+8
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorMagenta+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $184
+JUMPV
+LABELV $213
+ADDRGP4 colorWhite
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 colorWhite+4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 colorWhite+8
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 colorWhite+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+LABELV $184
+LABELV $176
+LABELV $171
+LABELV $166
+LABELV $161
+endproc Q_SetColorTable 4 8
+data
+export bytedirs
+align 4
+LABELV bytedirs
+byte 4 3204879951
+byte 4 0
+byte 4 1062847556
+byte 4 3202531056
+byte 4 1047828139
+byte 4 1063074669
+byte 4 3197577718
+byte 4 0
+byte 4 1064605338
+byte 4 3198039930
+byte 4 1056964608
+byte 4 1062149053
+byte 4 3190184938
+byte 4 1049007711
+byte 4 1064532072
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1062847556
+byte 4 1057396303
+byte 4 3189189110
+byte 4 1060597999
+byte 4 1060013330
+byte 4 1041705462
+byte 4 1060597999
+byte 4 1060013330
+byte 4 0
+byte 4 1057396303
+byte 4 1062847556
+byte 4 1050556282
+byte 4 1056964608
+byte 4 1062149053
+byte 4 1057396303
+byte 4 0
+byte 4 1062847556
+byte 4 1050094070
+byte 4 0
+byte 4 1064605338
+byte 4 1055047408
+byte 4 1047828139
+byte 4 1063074669
+byte 4 1042701290
+byte 4 1049007711
+byte 4 1064532072
+byte 4 3207496978
+byte 4 1041705462
+byte 4 1060597999
+byte 4 3209632701
+byte 4 1050556282
+byte 4 1056964608
+byte 4 3205921044
+byte 4 1054458931
+byte 4 1060121929
+byte 4 3210331204
+byte 4 1057396303
+byte 4 0
+byte 4 3210558317
+byte 4 1055047408
+byte 4 1047828139
+byte 4 3208081647
+byte 4 1060013330
+byte 4 1041705462
+byte 4 3207605577
+byte 4 1058437396
+byte 4 1054458931
+byte 4 3204448256
+byte 4 1062149053
+byte 4 1050556282
+byte 4 3195311787
+byte 4 1063074669
+byte 4 1055047408
+byte 4 3201942579
+byte 4 1060121929
+byte 4 1058437396
+byte 4 3208081647
+byte 4 1060013330
+byte 4 3189189110
+byte 4 3204448256
+byte 4 1062149053
+byte 4 3198039930
+byte 4 3204879951
+byte 4 1062847556
+byte 4 0
+byte 4 0
+byte 4 1062847556
+byte 4 3204879951
+byte 4 3195311787
+byte 4 1063074669
+byte 4 3202531056
+byte 4 0
+byte 4 1064605338
+byte 4 3197577718
+byte 4 3196491359
+byte 4 1064532072
+byte 4 3190184938
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1064605338
+byte 4 1050094070
+byte 4 3196491359
+byte 4 1064532072
+byte 4 1042701290
+byte 4 1047828139
+byte 4 1063074669
+byte 4 1055047408
+byte 4 1049007711
+byte 4 1064532072
+byte 4 1042701290
+byte 4 1056964608
+byte 4 1062149053
+byte 4 1050556282
+byte 4 1047828139
+byte 4 1063074669
+byte 4 3202531056
+byte 4 1049007711
+byte 4 1064532072
+byte 4 3190184938
+byte 4 1056964608
+byte 4 1062149053
+byte 4 3198039930
+byte 4 1062847556
+byte 4 1057396303
+byte 4 0
+byte 4 1060597999
+byte 4 1060013330
+byte 4 1041705462
+byte 4 1060597999
+byte 4 1060013330
+byte 4 3189189110
+byte 4 1057396303
+byte 4 1062847556
+byte 4 0
+byte 4 1054458931
+byte 4 1060121929
+byte 4 1058437396
+byte 4 1063074669
+byte 4 1055047408
+byte 4 1047828139
+byte 4 1060121929
+byte 4 1058437396
+byte 4 1054458931
+byte 4 1062149053
+byte 4 1050556282
+byte 4 1056964608
+byte 4 1060013330
+byte 4 1041705462
+byte 4 1060597999
+byte 4 1058437396
+byte 4 1054458931
+byte 4 1060121929
+byte 4 1064605338
+byte 4 1050094070
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1064532072
+byte 4 1042701290
+byte 4 1049007711
+byte 4 1062847556
+byte 4 3204879951
+byte 4 0
+byte 4 1064605338
+byte 4 3197577718
+byte 4 0
+byte 4 1063074669
+byte 4 3202531056
+byte 4 1047828139
+byte 4 1064532072
+byte 4 3190184938
+byte 4 1049007711
+byte 4 1062149053
+byte 4 3198039930
+byte 4 1056964608
+byte 4 1060013330
+byte 4 3189189110
+byte 4 1060597999
+byte 4 1062847556
+byte 4 0
+byte 4 1057396303
+byte 4 1063074669
+byte 4 1055047408
+byte 4 3195311787
+byte 4 1062149053
+byte 4 1050556282
+byte 4 3204448256
+byte 4 1064532072
+byte 4 1042701290
+byte 4 3196491359
+byte 4 1057396303
+byte 4 0
+byte 4 3210331204
+byte 4 1060013330
+byte 4 1041705462
+byte 4 3208081647
+byte 4 1060013330
+byte 4 3189189110
+byte 4 3208081647
+byte 4 1062847556
+byte 4 0
+byte 4 3204879951
+byte 4 1062149053
+byte 4 3198039930
+byte 4 3204448256
+byte 4 1063074669
+byte 4 3202531056
+byte 4 3195311787
+byte 4 1064532072
+byte 4 3190184938
+byte 4 3196491359
+byte 4 1041705462
+byte 4 1060597999
+byte 4 3207496978
+byte 4 1050556282
+byte 4 1056964608
+byte 4 3209632701
+byte 4 1054458931
+byte 4 1060121929
+byte 4 3205921044
+byte 4 1055047408
+byte 4 1047828139
+byte 4 3210558317
+byte 4 1058437396
+byte 4 1054458931
+byte 4 3207605577
+byte 4 1060121929
+byte 4 1058437396
+byte 4 3201942579
+byte 4 3189189110
+byte 4 1060597999
+byte 4 3207496978
+byte 4 3198039930
+byte 4 1056964608
+byte 4 3209632701
+byte 4 0
+byte 4 1057396303
+byte 4 3210331204
+byte 4 3204879951
+byte 4 0
+byte 4 3210331204
+byte 4 3202531056
+byte 4 1047828139
+byte 4 3210558317
+byte 4 3197577718
+byte 4 0
+byte 4 3212088986
+byte 4 3190184938
+byte 4 1049007711
+byte 4 3212015720
+byte 4 0
+byte 4 0
+byte 4 3212836864
+byte 4 1050094070
+byte 4 0
+byte 4 3212088986
+byte 4 1042701290
+byte 4 1049007711
+byte 4 3212015720
+byte 4 3202531056
+byte 4 3195311787
+byte 4 3210558317
+byte 4 3198039930
+byte 4 3204448256
+byte 4 3209632701
+byte 4 3190184938
+byte 4 3196491359
+byte 4 3212015720
+byte 4 0
+byte 4 3210331204
+byte 4 3204879951
+byte 4 3189189110
+byte 4 3208081647
+byte 4 3207496978
+byte 4 1041705462
+byte 4 3208081647
+byte 4 3207496978
+byte 4 0
+byte 4 3204879951
+byte 4 3210331204
+byte 4 1050556282
+byte 4 3204448256
+byte 4 3209632701
+byte 4 1055047408
+byte 4 3195311787
+byte 4 3210558317
+byte 4 1042701290
+byte 4 3196491359
+byte 4 3212015720
+byte 4 1047828139
+byte 4 3210558317
+byte 4 3202531056
+byte 4 1056964608
+byte 4 3209632701
+byte 4 3198039930
+byte 4 1054458931
+byte 4 3207605577
+byte 4 3205921044
+byte 4 1060597999
+byte 4 3207496978
+byte 4 3189189110
+byte 4 1060121929
+byte 4 3205921044
+byte 4 3201942579
+byte 4 1058437396
+byte 4 3201942579
+byte 4 3207605577
+byte 4 0
+byte 4 3212088986
+byte 4 3197577718
+byte 4 0
+byte 4 3212836864
+byte 4 0
+byte 4 1049007711
+byte 4 3212015720
+byte 4 3190184938
+byte 4 0
+byte 4 3210331204
+byte 4 1057396303
+byte 4 0
+byte 4 3212088986
+byte 4 1050094070
+byte 4 1047828139
+byte 4 3210558317
+byte 4 1055047408
+byte 4 1049007711
+byte 4 3212015720
+byte 4 1042701290
+byte 4 1056964608
+byte 4 3209632701
+byte 4 1050556282
+byte 4 1060597999
+byte 4 3207496978
+byte 4 1041705462
+byte 4 1057396303
+byte 4 3210331204
+byte 4 0
+byte 4 3195311787
+byte 4 3210558317
+byte 4 3202531056
+byte 4 3204448256
+byte 4 3209632701
+byte 4 3198039930
+byte 4 3196491359
+byte 4 3212015720
+byte 4 3190184938
+byte 4 3210331204
+byte 4 3204879951
+byte 4 0
+byte 4 3208081647
+byte 4 3207496978
+byte 4 3189189110
+byte 4 3208081647
+byte 4 3207496978
+byte 4 1041705462
+byte 4 3204879951
+byte 4 3210331204
+byte 4 0
+byte 4 3204448256
+byte 4 3209632701
+byte 4 1050556282
+byte 4 3195311787
+byte 4 3210558317
+byte 4 1055047408
+byte 4 3196491359
+byte 4 3212015720
+byte 4 1042701290
+byte 4 3210558317
+byte 4 3202531056
+byte 4 1047828139
+byte 4 3209632701
+byte 4 3198039930
+byte 4 1056964608
+byte 4 3207605577
+byte 4 3205921044
+byte 4 1054458931
+byte 4 3207496978
+byte 4 3189189110
+byte 4 1060597999
+byte 4 3202531056
+byte 4 3195311787
+byte 4 1063074669
+byte 4 3205921044
+byte 4 3201942579
+byte 4 1060121929
+byte 4 3198039930
+byte 4 3204448256
+byte 4 1062149053
+byte 4 3189189110
+byte 4 3208081647
+byte 4 1060013330
+byte 4 3201942579
+byte 4 3207605577
+byte 4 1058437396
+byte 4 3190184938
+byte 4 3196491359
+byte 4 1064532072
+byte 4 1055047408
+byte 4 3195311787
+byte 4 1063074669
+byte 4 1042701290
+byte 4 3196491359
+byte 4 1064532072
+byte 4 1050556282
+byte 4 3204448256
+byte 4 1062149053
+byte 4 1041705462
+byte 4 3208081647
+byte 4 1060013330
+byte 4 0
+byte 4 3204879951
+byte 4 1062847556
+byte 4 1054458931
+byte 4 3207605577
+byte 4 1058437396
+byte 4 1058437396
+byte 4 3201942579
+byte 4 1060121929
+byte 4 1060121929
+byte 4 3205921044
+byte 4 1054458931
+byte 4 3212088986
+byte 4 1050094070
+byte 4 0
+byte 4 3212015720
+byte 4 1042701290
+byte 4 1049007711
+byte 4 3212836864
+byte 4 0
+byte 4 0
+byte 4 3210331204
+byte 4 0
+byte 4 1057396303
+byte 4 3212088986
+byte 4 3197577718
+byte 4 0
+byte 4 3212015720
+byte 4 3190184938
+byte 4 1049007711
+byte 4 3210558317
+byte 4 1055047408
+byte 4 3195311787
+byte 4 3212015720
+byte 4 1042701290
+byte 4 3196491359
+byte 4 3209632701
+byte 4 1050556282
+byte 4 3204448256
+byte 4 3210558317
+byte 4 3202531056
+byte 4 3195311787
+byte 4 3212015720
+byte 4 3190184938
+byte 4 3196491359
+byte 4 3209632701
+byte 4 3198039930
+byte 4 3204448256
+byte 4 3207496978
+byte 4 1041705462
+byte 4 3208081647
+byte 4 3207496978
+byte 4 3189189110
+byte 4 3208081647
+byte 4 3210331204
+byte 4 0
+byte 4 3204879951
+byte 4 3207605577
+byte 4 1058437396
+byte 4 3201942579
+byte 4 3205921044
+byte 4 1054458931
+byte 4 3207605577
+byte 4 3201942579
+byte 4 1060121929
+byte 4 3205921044
+byte 4 3201942579
+byte 4 3207605577
+byte 4 3205921044
+byte 4 3205921044
+byte 4 3201942579
+byte 4 3207605577
+byte 4 3207605577
+byte 4 3205921044
+byte 4 3201942579
+export Q_rand
+code
+proc Q_rand 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTU4 69069
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CVIU4 4
+MULU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+RETI4
+LABELV $218
+endproc Q_rand 4 0
+export Q_random
+proc Q_random 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 65535
+BANDI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+RETF4
+LABELV $219
+endproc Q_random 4 4
+export Q_crandom
+proc Q_crandom 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_random
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+RETF4
+LABELV $220
+endproc Q_crandom 4 4
+export ClampChar
+proc ClampChar 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -128
+GEI4 $222
+CNSTI4 -128
+RETI4
+ADDRGP4 $221
+JUMPV
+LABELV $222
+ADDRFP4 0
+INDIRI4
+CNSTI4 127
+LEI4 $224
+CNSTI4 127
+RETI4
+ADDRGP4 $221
+JUMPV
+LABELV $224
+ADDRFP4 0
+INDIRI4
+CVII1 4
+CVII4 1
+RETI4
+LABELV $221
+endproc ClampChar 0 0
+export ClampShort
+proc ClampShort 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -32768
+GEI4 $227
+CNSTI4 -32768
+RETI4
+ADDRGP4 $226
+JUMPV
+LABELV $227
+ADDRFP4 0
+INDIRI4
+CNSTI4 32767
+LEI4 $229
+CNSTI4 32767
+RETI4
+ADDRGP4 $226
+JUMPV
+LABELV $229
+ADDRFP4 0
+INDIRI4
+CVII2 4
+CVII4 2
+RETI4
+LABELV $226
+endproc ClampShort 0 0
+export DirToByte
+proc DirToByte 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $232
+CNSTI4 0
+RETI4
+ADDRGP4 $231
+JUMPV
+LABELV $232
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $234
+ADDRLP4 24
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 bytedirs
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 bytedirs+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 bytedirs+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $240
+ADDRLP4 8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $240
+LABELV $235
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 162
+LTI4 $234
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $231
+endproc DirToByte 28 0
+export ByteToDir
+proc ByteToDir 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $245
+ADDRFP4 0
+INDIRI4
+CNSTI4 162
+LTI4 $243
+LABELV $245
+ADDRFP4 4
+INDIRP4
+ADDRGP4 vec3_origin
+INDIRB
+ASGNB 12
+ADDRGP4 $242
+JUMPV
+LABELV $243
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bytedirs
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $242
+endproc ByteToDir 4 0
+export ColorBytes3
+proc ColorBytes3 40 0
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRLP4 12
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LTF4 $248
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $249
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+CNSTF4 1132396544
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LTF4 $252
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $253
+ADDRLP4 0+1
+ADDRLP4 8
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $256
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $257
+ADDRLP4 0+2
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU4
+RETU4
+LABELV $246
+endproc ColorBytes3 40 0
+export ColorBytes4
+proc ColorBytes4 52 0
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRLP4 12
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LTF4 $260
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $261
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+CNSTF4 1132396544
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LTF4 $264
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $265
+ADDRLP4 0+1
+ADDRLP4 8
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $268
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $269
+JUMPV
+LABELV $268
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $269
+ADDRLP4 0+2
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTF4 1132396544
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LTF4 $272
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $273
+ADDRLP4 0+3
+ADDRLP4 40
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU4
+RETU4
+LABELV $258
+endproc ColorBytes4 52 0
+export NormalizeColor
+proc NormalizeColor 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LEF4 $275
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $275
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LEF4 $277
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $277
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $279
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $280
+JUMPV
+LABELV $279
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $280
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $274
+endproc NormalizeColor 16 0
+export PlaneFromPoints
+proc PlaneFromPoints 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 12+8
+ADDRFP4 12
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+NEF4 $286
+CNSTI4 0
+RETI4
+ADDRGP4 $281
+JUMPV
+LABELV $286
+ADDRLP4 68
+CNSTI4 4
+ASGNI4
+ADDRLP4 72
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $281
+endproc PlaneFromPoints 76 12
+export RotatePointAroundVector
+proc RotatePointAroundVector 260 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 160
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 160
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 40
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 40+12
+ADDRLP4 160+4
+INDIRF4
+ASGNF4
+ADDRLP4 40+24
+ADDRLP4 160+8
+INDIRF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 40+12+4
+ADDRLP4 176+4
+INDIRF4
+ASGNF4
+ADDRLP4 40+24+4
+ADDRLP4 176+8
+INDIRF4
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 40+12+8
+ADDRLP4 148+4
+INDIRF4
+ASGNF4
+ADDRLP4 40+24+8
+ADDRLP4 148+8
+INDIRF4
+ASGNF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 112+4
+ADDRLP4 40+12
+INDIRF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 40+24
+INDIRF4
+ASGNF4
+ADDRLP4 112+12
+ADDRLP4 40+4
+INDIRF4
+ASGNF4
+ADDRLP4 112+12+8
+ADDRLP4 40+24+4
+INDIRF4
+ASGNF4
+ADDRLP4 112+24
+ADDRLP4 40+8
+INDIRF4
+ASGNF4
+ADDRLP4 112+24+4
+ADDRLP4 40+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 36
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 228
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 76+24+8
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 76+12+4
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1078530011
+ADDRFP4 12
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 232
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 232
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 236
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 240
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 76+12
+ADDRLP4 240
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 244
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 76+12+4
+ADDRLP4 244
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 188
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $333
+ADDRLP4 252
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $334
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $333
+LABELV $288
+endproc RotatePointAroundVector 260 12
+export RotateAroundDirection
+proc RotateAroundDirection 24 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+CNSTF4 0
+EQF4 $340
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+LABELV $340
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+LABELV $339
+endproc RotateAroundDirection 24 16
+export vectoangles
+proc vectoangles 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+NEF4 $343
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+NEF4 $343
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LEF4 $345
+ADDRLP4 4
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $344
+JUMPV
+LABELV $345
+ADDRLP4 4
+CNSTF4 1132920832
+ASGNF4
+ADDRGP4 $344
+JUMPV
+LABELV $343
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 0
+EQF4 $347
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1127481344
+ADDRLP4 24
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $348
+JUMPV
+LABELV $347
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $349
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRLP4 0
+CNSTF4 1132920832
+ASGNF4
+LABELV $350
+LABELV $348
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $351
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $351
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1127481344
+ADDRLP4 36
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $353
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $353
+LABELV $344
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $342
+endproc vectoangles 40 8
+export AnglesToAxis
+proc AnglesToAxis 16 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $355
+endproc AnglesToAxis 16 16
+export AxisClear
+proc AxisClear 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $360
+endproc AxisClear 0 0
+export AxisCopy
+proc AxisCopy 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+CNSTI4 24
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $361
+endproc AxisCopy 8 0
+export ProjectPointOntoVector
+proc ProjectPointOntoVector 60 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRLP4 56
+ADDRFP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $362
+endproc ProjectPointOntoVector 60 0
+export ProjectPointOnPlane
+proc ProjectPointOnPlane 68 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $371
+endproc ProjectPointOnPlane 68 0
+export PointToPlane
+proc PointToPlane 76 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+NEGF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 52
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 0
+NEF4 $381
+ADDRGP4 $383
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $376
+JUMPV
+LABELV $381
+ADDRLP4 12
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $376
+endproc PointToPlane 76 4
+export MakeNormalVectors
+proc MakeNormalVectors 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+LABELV $384
+endproc MakeNormalVectors 36 12
+export VectorRotate
+proc VectorRotate 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $385
+endproc VectorRotate 40 0
+export VectorGetScale
+proc VectorGetScale 8 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 0
+EQF4 $387
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $387
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $389
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $389
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $391
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $391
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $393
+LABELV $393
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $386
+endproc VectorGetScale 8 0
+export Q_rsqrt
+proc Q_rsqrt 24 0
+ADDRLP4 12
+CNSTF4 1069547520
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1056964608
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 1597463007
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+RSHI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $395
+endproc Q_rsqrt 24 0
+export Q_fabs
+proc Q_fabs 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2147483647
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $396
+endproc Q_fabs 4 0
+export LerpAngle
+proc LerpAngle 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+CNSTF4 1127481344
+LEF4 $398
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $398
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+CNSTF4 3274964992
+GEF4 $400
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $400
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $397
+endproc LerpAngle 8 0
+export LerpAngleNear
+proc LerpAngleNear 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 Q_floatIsNan
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $405
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Q_floatIsNan
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $408
+LABELV $405
+ADDRGP4 $406
+ARGP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $402
+JUMPV
+LABELV $407
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $408
+ADDRFP4 0
+INDIRF4
+CNSTF4 1127481344
+GTF4 $407
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $411
+ADDRFP4 0
+INDIRF4
+CNSTF4 3274964992
+LTF4 $410
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $414
+ADDRFP4 4
+INDIRF4
+CNSTF4 1127481344
+GTF4 $413
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $417
+ADDRFP4 4
+INDIRF4
+CNSTF4 3274964992
+LTF4 $416
+ADDRFP4 4
+INDIRF4
+CNSTF4 3274964992
+LTF4 $421
+ADDRFP4 4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $419
+LABELV $421
+ADDRGP4 $422
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $419
+ADDRFP4 0
+INDIRF4
+CNSTF4 3274964992
+LTF4 $425
+ADDRFP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $423
+LABELV $425
+ADDRGP4 $426
+ARGP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $423
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+GTF4 $430
+ADDRFP4 4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LEF4 $429
+LABELV $430
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+LTF4 $427
+ADDRFP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+LTF4 $427
+LABELV $429
+ADDRLP4 4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $428
+JUMPV
+LABELV $427
+ADDRLP4 32
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+LTF4 $431
+ADDRLP4 40
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 32
+ADDRLP4 40
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRFP4 4
+INDIRF4
+NEGF4
+ADDF4
+ASGNF4
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRLP4 32
+ADDRFP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 3274964992
+ADDRFP4 0
+INDIRF4
+SUBF4
+NEGF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+CNSTF4 1127481344
+ADDRFP4 4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+LABELV $432
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LEF4 $433
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $434
+LABELV $428
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $402
+endproc LerpAngleNear 52 12
+export LerpAngles
+proc LerpAngles 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $435
+endproc LerpAngles 20 12
+export AngleSubtract
+proc AngleSubtract 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $438
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+GTF4 $437
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $441
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+LTF4 $440
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $436
+endproc AngleSubtract 4 0
+export AnglesSubtract
+proc AnglesSubtract 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $443
+endproc AnglesSubtract 20 8
+export AngleAdd
+proc AngleAdd 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $446
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+GTF4 $445
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $449
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+LTF4 $448
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $444
+endproc AngleAdd 4 0
+export AngleMod
+proc AngleMod 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+CNSTF4 1001652224
+CNSTF4 1127615329
+ADDRFP4 0
+INDIRF4
+MULF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $451
+endproc AngleMod 0 0
+export AngleNormalize360
+proc AngleNormalize360 0 0
+CNSTF4 1001652224
+CNSTF4 1127615329
+ADDRFP4 0
+INDIRF4
+MULF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+CVIF4 4
+MULF4
+RETF4
+LABELV $452
+endproc AngleNormalize360 0 0
+export AngleNormalize180
+proc AngleNormalize180 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 AngleNormalize360
+CALLF4
+ASGNF4
+ADDRFP4 0
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $454
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $454
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $453
+endproc AngleNormalize180 4 4
+export AngleDelta
+proc AngleDelta 4 4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $456
+endproc AngleDelta 4 4
+export SetPlaneSignbits
+proc SetPlaneSignbits 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $458
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $462
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $462
+LABELV $459
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $458
+ADDRFP4 0
+INDIRP4
+CNSTI4 17
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $457
+endproc SetPlaneSignbits 12 0
+export BoxOnPlaneSide
+proc BoxOnPlaneSide 60 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 3
+GEI4 $465
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+GTF4 $467
+CNSTI4 1
+RETI4
+ADDRGP4 $464
+JUMPV
+LABELV $467
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+LTF4 $469
+CNSTI4 2
+RETI4
+ADDRGP4 $464
+JUMPV
+LABELV $469
+CNSTI4 3
+RETI4
+ADDRGP4 $464
+JUMPV
+LABELV $465
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 17
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+GEI4 $472
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $474
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+CNSTI4 17
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 0
+INDIRI4
+RSHI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRLP4 36
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRLP4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $479
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $480
+JUMPV
+LABELV $479
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $480
+ADDRLP4 48
+CNSTI4 2
+ASGNI4
+ADDRLP4 52
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ADDRLP4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 56
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $475
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $474
+LABELV $472
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+LTF4 $481
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $481
+ADDRLP4 8+4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+GEF4 $483
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $483
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $464
+endproc BoxOnPlaneSide 60 0
+export RadiusFromBounds
+proc RadiusFromBounds 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $487
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $492
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $493
+JUMPV
+LABELV $492
+ADDRLP4 32
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $493
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $488
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $487
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+RETF4
+LABELV $486
+endproc RadiusFromBounds 36 4
+export ClearBounds
+proc ClearBounds 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 1203982208
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 3351465856
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $494
+endproc ClearBounds 16 0
+export AddPointToBounds
+proc AddPointToBounds 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+GEF4 $496
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $496
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+LEF4 $498
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $498
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $500
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $500
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $502
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $502
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $504
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $504
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $506
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $506
+LABELV $495
+endproc AddPointToBounds 20 0
+export BoundsIntersect
+proc BoundsIntersect 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+LTF4 $515
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $515
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $515
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+GTF4 $515
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $515
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $509
+LABELV $515
+CNSTI4 0
+RETI4
+ADDRGP4 $508
+JUMPV
+LABELV $509
+CNSTI4 1
+RETI4
+LABELV $508
+endproc BoundsIntersect 24 0
+export BoundsIntersectSphere
+proc BoundsIntersectSphere 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+GTF4 $523
+ADDRLP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+LTF4 $523
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $523
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $523
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $523
+ADDRLP4 32
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $517
+LABELV $523
+CNSTI4 0
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $517
+CNSTI4 1
+RETI4
+LABELV $516
+endproc BoundsIntersectSphere 36 0
+export BoundsIntersectPoint
+proc BoundsIntersectPoint 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+GTF4 $531
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+LTF4 $531
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $531
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $531
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $531
+ADDRLP4 28
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $525
+LABELV $531
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $525
+CNSTI4 1
+RETI4
+LABELV $524
+endproc BoundsIntersectPoint 32 0
+export VectorNormalize
+proc VectorNormalize 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $533
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $533
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $532
+endproc VectorNormalize 44 4
+export VectorNormalize2
+proc VectorNormalize2 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $536
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+LABELV $537
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $535
+endproc VectorNormalize2 40 4
+export _VectorMA
+proc _VectorMA 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $538
+endproc _VectorMA 8 0
+export _DotProduct
+proc _DotProduct 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $539
+endproc _DotProduct 16 0
+export _VectorSubtract
+proc _VectorSubtract 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $540
+endproc _VectorSubtract 8 0
+export _VectorAdd
+proc _VectorAdd 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $541
+endproc _VectorAdd 8 0
+export _VectorCopy
+proc _VectorCopy 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $542
+endproc _VectorCopy 8 0
+export _VectorScale
+proc _VectorScale 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $543
+endproc _VectorScale 8 0
+export Vector4Scale
+proc Vector4Scale 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $544
+endproc Vector4Scale 12 0
+export AngleBetweenVectors
+proc AngleBetweenVectors 28 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 acos
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+RETF4
+LABELV $545
+endproc AngleBetweenVectors 28 4
+export Q_log2
+proc Q_log2 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $552
+JUMPV
+LABELV $551
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $552
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+RSHI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $551
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $550
+endproc Q_log2 8 0
+export MatrixMultiply
+proc MatrixMultiply 104 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+CNSTI4 20
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 24
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 28
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+CNSTI4 32
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $554
+endproc MatrixMultiply 104 0
+bss
+align 4
+LABELV $556
+skip 4
+align 4
+LABELV $557
+skip 4
+align 4
+LABELV $558
+skip 4
+align 4
+LABELV $559
+skip 4
+align 4
+LABELV $560
+skip 4
+align 4
+LABELV $561
+skip 4
+export AngleVectors
+code
+proc AngleVectors 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 $558
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 $561
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 $557
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 $560
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 $556
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 $559
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $562
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $560
+INDIRF4
+ADDRGP4 $561
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $560
+INDIRF4
+ADDRGP4 $558
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $557
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $562
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $564
+ADDRLP4 28
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 $556
+INDIRF4
+MULF4
+ADDRGP4 $557
+INDIRF4
+MULF4
+ADDRGP4 $561
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 $559
+INDIRF4
+MULF4
+ADDRGP4 $558
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 $556
+INDIRF4
+MULF4
+ADDRGP4 $557
+INDIRF4
+MULF4
+ADDRGP4 $558
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 $559
+INDIRF4
+MULF4
+ADDRGP4 $561
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 3212836864
+ADDRGP4 $556
+INDIRF4
+MULF4
+ADDRGP4 $560
+INDIRF4
+MULF4
+ASGNF4
+LABELV $564
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $566
+ADDRFP4 12
+INDIRP4
+ADDRGP4 $559
+INDIRF4
+ADDRGP4 $557
+INDIRF4
+MULF4
+ADDRGP4 $561
+INDIRF4
+MULF4
+ADDRGP4 $556
+INDIRF4
+NEGF4
+ADDRGP4 $558
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $559
+INDIRF4
+ADDRGP4 $557
+INDIRF4
+MULF4
+ADDRGP4 $558
+INDIRF4
+MULF4
+ADDRGP4 $556
+INDIRF4
+NEGF4
+ADDRGP4 $561
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $559
+INDIRF4
+ADDRGP4 $560
+INDIRF4
+MULF4
+ASGNF4
+LABELV $566
+LABELV $555
+endproc AngleVectors 36 4
+export PerpendicularVector
+proc PerpendicularVector 40 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $572
+JUMPV
+LABELV $569
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $573
+ADDRGP4 $575
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $573
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $576
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+LABELV $576
+LABELV $570
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $572
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $569
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ProjectPointOnPlane
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $568
+endproc PerpendicularVector 40 12
+export VectorStartEndDir
+proc VectorStartEndDir 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $580
+endproc VectorStartEndDir 8 0
+export VectorCheck
+proc VectorCheck 16 0
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 2139095040
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+NEI4 $582
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $583
+JUMPV
+LABELV $582
+ADDRLP4 8
+CNSTI4 2139095040
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+ADDRLP4 8
+INDIRI4
+NEI4 $584
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRLP4 12
+CNSTI4 2139095040
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+BANDI4
+ADDRLP4 12
+INDIRI4
+NEI4 $586
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $586
+LABELV $585
+LABELV $583
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $588
+ADDRGP4 Crash
+CALLV
+pop
+LABELV $588
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $581
+endproc VectorCheck 16 0
+export VectorReflect
+proc VectorReflect 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 20
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $590
+endproc VectorReflect 32 4
+export Q_floatIsNan
+proc Q_floatIsNan 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+CNSTU4 2147483647
+BANDU4
+ASGNU4
+ADDRLP4 0
+CNSTU4 2139095040
+ADDRLP4 0
+INDIRU4
+SUBU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+CNSTI4 31
+RSHU4
+CVUI4 4
+RETI4
+LABELV $595
+endproc Q_floatIsNan 4 0
+export Q_fmodf
+proc Q_fmodf 12 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+SUBF4
+RETF4
+LABELV $596
+endproc Q_fmodf 12 4
+import acos
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_acos
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $575
+byte 1 94
+byte 1 51
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 86
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 114
+byte 1 99
+byte 1 91
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $426
+byte 1 94
+byte 1 51
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 119
+byte 1 116
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $422
+byte 1 94
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 119
+byte 1 116
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $406
+byte 1 94
+byte 1 51
+byte 1 76
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 78
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $383
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 111
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 10
+byte 1 0
+align 1
+LABELV $164
+byte 1 81
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 84
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 100
+byte 1 39
+byte 1 10
+byte 1 0
@@ -0,0 +1,7982 @@
+data
+export MonthAbbrev
+align 4
+LABELV MonthAbbrev
+address $25
+address $26
+address $27
+address $28
+address $29
+address $30
+address $31
+address $32
+address $33
+address $34
+address $35
+address $36
+export DayAbbrev
+align 4
+LABELV DayAbbrev
+address $37
+address $38
+address $39
+address $40
+address $41
+address $42
+address $43
+export Com_Clamp
+code
+proc Com_Clamp 0 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+GEF4 $45
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $44
+JUMPV
+LABELV $45
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+LEF4 $47
+ADDRFP4 4
+INDIRF4
+RETF4
+ADDRGP4 $44
+JUMPV
+LABELV $47
+ADDRFP4 8
+INDIRF4
+RETF4
+LABELV $44
+endproc Com_Clamp 0 0
+export COM_SkipPath
+proc COM_SkipPath 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $51
+JUMPV
+LABELV $50
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $53
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $53
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $51
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $50
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $49
+endproc COM_SkipPath 4 0
+export COM_GetExtension
+proc COM_GetExtension 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 8
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $56
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 12
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $58
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+GEU4 $56
+LABELV $58
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+RETP4
+ADDRGP4 $55
+JUMPV
+LABELV $56
+ADDRGP4 $59
+RETP4
+LABELV $55
+endproc COM_GetExtension 16 8
+export COM_StripExtension
+proc COM_StripExtension 44 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 16
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 20
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 28
+CNSTU4 0
+ASGNU4
+ADDRLP4 24
+INDIRU4
+ADDRLP4 28
+INDIRU4
+EQU4 $61
+ADDRLP4 32
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 32
+INDIRU4
+ADDRLP4 28
+INDIRU4
+EQU4 $63
+ADDRLP4 32
+INDIRU4
+ADDRLP4 24
+INDIRU4
+GEU4 $61
+LABELV $63
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+GEI4 $64
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $62
+JUMPV
+LABELV $64
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $62
+JUMPV
+LABELV $61
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $62
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $69
+JUMPV
+LABELV $66
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI1
+ASGNI1
+LABELV $67
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $69
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $70
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $66
+LABELV $70
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $71
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $71
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $60
+endproc COM_StripExtension 44 8
+export COM_CompareExtension
+proc COM_CompareExtension 20 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GTI4 $74
+ADDRFP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $76
+CNSTI4 1
+RETI4
+ADDRGP4 $73
+JUMPV
+LABELV $76
+LABELV $74
+CNSTI4 0
+RETI4
+LABELV $73
+endproc COM_CompareExtension 20 8
+export COM_DefaultExtension
+proc COM_DefaultExtension 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 8
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $79
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 12
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $81
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+GEU4 $79
+LABELV $81
+ADDRGP4 $78
+JUMPV
+LABELV $79
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $78
+endproc COM_DefaultExtension 16 12
+export CopyShortSwap
+proc CopyShortSwap 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRLP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+LABELV $82
+endproc CopyShortSwap 8 0
+export CopyLongSwap
+proc CopyLongSwap 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ADDRLP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+LABELV $83
+endproc CopyLongSwap 8 0
+export ShortSwap
+proc ShortSwap 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRLP4 4
+ADDRFP4 0
+INDIRI2
+CVII4 2
+ASGNI4
+ADDRLP4 8
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRLP4 1
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 1
+INDIRU1
+CVUI4 1
+ADDI4
+CVII2 4
+CVII4 2
+RETI4
+LABELV $84
+endproc ShortSwap 16 0
+export ShortNoSwap
+proc ShortNoSwap 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRFP4 0
+INDIRI2
+CVII4 2
+RETI4
+LABELV $85
+endproc ShortNoSwap 0 0
+export LongSwap
+proc LongSwap 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRLP4 1
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+ADDRLP4 2
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+CNSTI4 24
+ASGNI4
+ADDRLP4 3
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 1
+INDIRU1
+CVUI4 1
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 2
+INDIRU1
+CVUI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 3
+INDIRU1
+CVUI4 1
+ADDI4
+RETI4
+LABELV $86
+endproc LongSwap 24 0
+export LongNoSwap
+proc LongNoSwap 0 0
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $87
+endproc LongNoSwap 0 0
+export Long64Swap
+proc Long64Swap 12 0
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 7
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+1
+ADDRLP4 8
+INDIRP4
+CNSTI4 6
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+2
+ADDRFP4 4
+INDIRP4
+CNSTI4 5
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+3
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+5
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+6
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+7
+ADDRFP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 8
+LABELV $88
+endproc Long64Swap 12 0
+export Long64NoSwap
+proc Long64NoSwap 0 0
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 8
+LABELV $97
+endproc Long64NoSwap 0 0
+export FloatSwap
+proc FloatSwap 8 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 LongSwap
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $99
+endproc FloatSwap 8 4
+export FloatNoSwap
+proc FloatNoSwap 0 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+RETF4
+LABELV $100
+endproc FloatNoSwap 0 0
+export COM_BeginParseSession
+proc COM_BeginParseSession 0 16
+ADDRGP4 com_lines
+CNSTI4 1
+ASGNI4
+ADDRGP4 com_tokenline
+CNSTI4 0
+ASGNI4
+ADDRGP4 com_parsename
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $102
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $101
+endproc COM_BeginParseSession 0 16
+export COM_GetCurrentParseLine
+proc COM_GetCurrentParseLine 0 0
+ADDRGP4 com_tokenline
+INDIRI4
+CNSTI4 0
+EQI4 $104
+ADDRGP4 com_tokenline
+INDIRI4
+RETI4
+ADDRGP4 $103
+JUMPV
+LABELV $104
+ADDRGP4 com_lines
+INDIRI4
+RETI4
+LABELV $103
+endproc COM_GetCurrentParseLine 0 0
+export COM_Parse
+proc COM_Parse 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $106
+endproc COM_Parse 4 8
+bss
+align 1
+LABELV $108
+skip 4096
+export COM_ParseError
+code
+proc COM_ParseError 8 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRGP4 $108
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $110
+ARGP4
+ADDRGP4 com_parsename
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $108
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $107
+endproc COM_ParseError 8 16
+bss
+align 1
+LABELV $112
+skip 4096
+export COM_ParseWarning
+code
+proc COM_ParseWarning 8 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRGP4 $112
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $114
+ARGP4
+ADDRGP4 com_parsename
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $112
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $111
+endproc COM_ParseWarning 8 16
+proc SkipWhitespace 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $117
+JUMPV
+LABELV $116
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $119
+CNSTP4 0
+RETP4
+ADDRGP4 $115
+JUMPV
+LABELV $119
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $121
+ADDRLP4 4
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $121
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $117
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+LEI4 $116
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $115
+endproc SkipWhitespace 12 0
+export COM_Compress
+proc COM_Compress 48 0
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $124
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 24
+CNSTI4 47
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $129
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+NEI4 $129
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $132
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $134
+ADDRLP4 28
+INDIRI4
+CNSTI4 10
+NEI4 $131
+LABELV $134
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRLP4 4
+INDIRI4
+CNSTI4 47
+NEI4 $135
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $135
+ADDRGP4 $138
+JUMPV
+LABELV $137
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $138
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $140
+ADDRLP4 32
+INDIRI4
+CNSTI4 42
+NEI4 $137
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $137
+LABELV $140
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $136
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+EQI4 $145
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $143
+LABELV $145
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+EQI4 $148
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+NEI4 $146
+LABELV $148
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $147
+JUMPV
+LABELV $146
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $149
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI1 10
+ASGNI1
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $149
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $151
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI1 32
+ASGNI1
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $151
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+NEI4 $153
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $156
+JUMPV
+LABELV $155
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $157
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+EQI4 $157
+ADDRLP4 44
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $159
+LABELV $156
+ADDRGP4 $155
+JUMPV
+LABELV $157
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+NEI4 $154
+ADDRLP4 40
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 40
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $154
+LABELV $147
+LABELV $144
+LABELV $136
+LABELV $130
+LABELV $127
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $126
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $124
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+RETI4
+LABELV $123
+endproc COM_Compress 48 0
+export COM_ParseExt
+proc COM_ParseExt 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 com_token
+CNSTI1 0
+ASGNI1
+ADDRGP4 com_tokenline
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $166
+ADDRFP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $162
+JUMPV
+LABELV $165
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20
+ADDRGP4 SkipWhitespace
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $168
+ADDRFP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $162
+JUMPV
+LABELV $168
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $170
+ADDRFP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $170
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $162
+JUMPV
+LABELV $170
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+CNSTI4 47
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $172
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+NEI4 $172
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $175
+JUMPV
+LABELV $174
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $175
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $177
+ADDRLP4 32
+INDIRI4
+CNSTI4 10
+NEI4 $174
+LABELV $177
+ADDRGP4 $173
+JUMPV
+LABELV $172
+ADDRLP4 4
+INDIRI4
+CNSTI4 47
+NEI4 $167
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $167
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $183
+ADDRLP4 32
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $183
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $181
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $185
+ADDRLP4 36
+INDIRI4
+CNSTI4 42
+NEI4 $180
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $180
+LABELV $185
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $179
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $179
+LABELV $173
+LABELV $166
+ADDRGP4 $165
+JUMPV
+LABELV $167
+ADDRGP4 com_tokenline
+ADDRGP4 com_lines
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+NEI4 $188
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $191
+JUMPV
+LABELV $190
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+EQI4 $195
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $193
+LABELV $195
+ADDRLP4 8
+INDIRI4
+ADDRGP4 com_token
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $162
+JUMPV
+LABELV $193
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+NEI4 $196
+ADDRLP4 28
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $196
+ADDRLP4 8
+INDIRI4
+CNSTI4 1023
+GEI4 $198
+ADDRLP4 8
+INDIRI4
+ADDRGP4 com_token
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $198
+LABELV $191
+ADDRGP4 $190
+JUMPV
+LABELV $188
+LABELV $200
+ADDRLP4 8
+INDIRI4
+CNSTI4 1023
+GEI4 $203
+ADDRLP4 8
+INDIRI4
+ADDRGP4 com_token
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $203
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+LABELV $201
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+GTI4 $200
+ADDRLP4 8
+INDIRI4
+ADDRGP4 com_token
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+RETP4
+LABELV $162
+endproc COM_ParseExt 40 8
+export COM_MatchToken
+proc COM_MatchToken 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $206
+CNSTI4 1
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $206
+LABELV $205
+endproc COM_MatchToken 12 16
+export SkipBracedSection
+proc SkipBracedSection 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $210
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $213
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $215
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $217
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $217
+LABELV $216
+LABELV $213
+LABELV $211
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $219
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $210
+LABELV $219
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $221
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $222
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $209
+endproc SkipBracedSection 8 8
+export SkipRestOfLine
+proc SkipRestOfLine 16 4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $228
+ADDRGP4 $226
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $223
+JUMPV
+LABELV $227
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $230
+ADDRLP4 8
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $230
+LABELV $228
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $227
+LABELV $229
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $223
+endproc SkipRestOfLine 16 4
+export Parse1DMatrix
+proc Parse1DMatrix 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $233
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $237
+JUMPV
+LABELV $234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $235
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $237
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $238
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $232
+endproc Parse1DMatrix 16 8
+export Parse2DMatrix
+proc Parse2DMatrix 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $233
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $243
+JUMPV
+LABELV $240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 Parse1DMatrix
+CALLV
+pop
+LABELV $241
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $243
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $238
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $239
+endproc Parse2DMatrix 8 12
+export Parse3DMatrix
+proc Parse3DMatrix 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $233
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $248
+JUMPV
+LABELV $245
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 Parse2DMatrix
+CALLV
+pop
+LABELV $246
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $248
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $245
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $238
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $244
+endproc Parse3DMatrix 12 16
+export Com_HexStrToInt
+proc Com_HexStrToInt 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $250
+CNSTI4 -1
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $250
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+NEI4 $252
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 120
+NEI4 $252
+ADDRFP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $252
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 16
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $257
+JUMPV
+LABELV $254
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 28
+ADDRLP4 20
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 48
+LTI4 $258
+ADDRLP4 28
+INDIRI4
+CNSTI4 57
+GTI4 $258
+ADDRLP4 20
+ADDRLP4 20
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVII1 4
+ASGNI1
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRLP4 32
+ADDRLP4 20
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 97
+LTI4 $260
+ADDRLP4 32
+INDIRI4
+CNSTI4 102
+GTI4 $260
+ADDRLP4 20
+ADDRLP4 20
+INDIRI1
+CVII4 1
+CNSTI4 97
+SUBI4
+CNSTI4 10
+ADDI4
+CVII1 4
+ASGNI1
+ADDRGP4 $261
+JUMPV
+LABELV $260
+CNSTI4 -1
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $261
+LABELV $259
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI1
+CVII4 1
+ADDI4
+ASGNI4
+LABELV $255
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $257
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $254
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $252
+CNSTI4 -1
+RETI4
+LABELV $249
+endproc Com_HexStrToInt 36 4
+export Q_isprint
+proc Q_isprint 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $263
+ADDRLP4 0
+INDIRI4
+CNSTI4 126
+GTI4 $263
+CNSTI4 1
+RETI4
+ADDRGP4 $262
+JUMPV
+LABELV $263
+CNSTI4 0
+RETI4
+LABELV $262
+endproc Q_isprint 4 0
+export Q_islower
+proc Q_islower 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $266
+ADDRLP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $266
+CNSTI4 1
+RETI4
+ADDRGP4 $265
+JUMPV
+LABELV $266
+CNSTI4 0
+RETI4
+LABELV $265
+endproc Q_islower 4 0
+export Q_isupper
+proc Q_isupper 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $269
+ADDRLP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $269
+CNSTI4 1
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $269
+CNSTI4 0
+RETI4
+LABELV $268
+endproc Q_isupper 4 0
+export Q_isalpha
+proc Q_isalpha 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $275
+ADDRFP4 0
+INDIRI4
+CNSTI4 122
+LEI4 $274
+LABELV $275
+ADDRFP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $272
+ADDRFP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $272
+LABELV $274
+CNSTI4 1
+RETI4
+ADDRGP4 $271
+JUMPV
+LABELV $272
+CNSTI4 0
+RETI4
+LABELV $271
+endproc Q_isalpha 8 0
+export Q_isdigit
+proc Q_isdigit 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRFP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $279
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $277
+LABELV $279
+CNSTI4 0
+RETI4
+ADDRGP4 $276
+JUMPV
+LABELV $277
+CNSTI4 1
+RETI4
+LABELV $276
+endproc Q_isdigit 4 0
+export Q_isanumber
+proc Q_isanumber 16 8
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $281
+CNSTI4 0
+RETI4
+ADDRGP4 $280
+JUMPV
+LABELV $281
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 strtod
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $284
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $285
+JUMPV
+LABELV $284
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $285
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $280
+endproc Q_isanumber 16 8
+export Q_isAnInteger
+proc Q_isAnInteger 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $289
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $291
+LABELV $289
+CNSTI4 0
+RETI4
+ADDRGP4 $286
+JUMPV
+LABELV $290
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $293
+ADDRGP4 $292
+JUMPV
+LABELV $293
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 48
+LTI4 $297
+ADDRLP4 4
+INDIRI4
+CNSTI4 57
+LEI4 $295
+LABELV $297
+CNSTI4 0
+RETI4
+ADDRGP4 $286
+JUMPV
+LABELV $295
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $291
+ADDRGP4 $290
+JUMPV
+LABELV $292
+CNSTI4 1
+RETI4
+LABELV $286
+endproc Q_isAnInteger 8 0
+export Q_isintegral
+proc Q_isintegral 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+NEF4 $300
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $301
+JUMPV
+LABELV $300
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $301
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $298
+endproc Q_isintegral 8 0
+export Q_strncpyz
+proc Q_strncpyz 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $303
+CNSTI4 0
+ARGI4
+ADDRGP4 $305
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $303
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $306
+CNSTI4 0
+ARGI4
+ADDRGP4 $308
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $306
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $309
+CNSTI4 0
+ARGI4
+ADDRGP4 $311
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $309
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 8
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+LTU4 $312
+ADDRLP4 12
+INDIRU4
+ADDRLP4 4
+INDIRU4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CVPU4 4
+GTU4 $312
+ADDRGP4 $314
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRU4
+GTU4 $315
+ADDRFP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CVPU4 4
+ADDRLP4 24
+INDIRU4
+LEU4 $315
+ADDRGP4 $317
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $315
+LABELV $313
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $318
+ADDRGP4 $320
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $321
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $318
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 $327
+JUMPV
+LABELV $324
+ADDRLP4 32
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI1
+ASGNI1
+LABELV $325
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $327
+ADDRLP4 28
+INDIRI4
+ADDRFP4 8
+INDIRI4
+GEI4 $328
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $324
+LABELV $328
+ADDRLP4 28
+INDIRI4
+ADDRFP4 8
+INDIRI4
+GEI4 $329
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $329
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $302
+JUMPV
+LABELV $322
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $302
+endproc Q_strncpyz 40 16
+export Q_stricmpn
+proc Q_stricmpn 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $332
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $334
+CNSTI4 0
+RETI4
+ADDRGP4 $331
+JUMPV
+LABELV $334
+CNSTI4 -1
+RETI4
+ADDRGP4 $331
+JUMPV
+LABELV $332
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $336
+CNSTI4 1
+RETI4
+ADDRGP4 $331
+JUMPV
+LABELV $336
+LABELV $338
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $341
+CNSTI4 0
+RETI4
+ADDRGP4 $331
+JUMPV
+LABELV $341
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $343
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $345
+ADDRLP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $345
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+LABELV $345
+ADDRLP4 4
+INDIRI4
+CNSTI4 97
+LTI4 $347
+ADDRLP4 4
+INDIRI4
+CNSTI4 122
+GTI4 $347
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+LABELV $347
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $349
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $352
+ADDRLP4 32
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $352
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+LABELV $353
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $331
+JUMPV
+LABELV $349
+LABELV $343
+LABELV $339
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $338
+CNSTI4 0
+RETI4
+LABELV $331
+endproc Q_stricmpn 36 0
+export Q_strncmp
+proc Q_strncmp 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $355
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $358
+CNSTI4 0
+RETI4
+ADDRGP4 $354
+JUMPV
+LABELV $358
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $360
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $363
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $364
+JUMPV
+LABELV $363
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+LABELV $364
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $354
+JUMPV
+LABELV $360
+LABELV $356
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $355
+CNSTI4 0
+RETI4
+LABELV $354
+endproc Q_strncmp 28 0
+export Q_stricmp
+proc Q_stricmp 16 12
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $367
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $367
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 99999
+ARGI4
+ADDRLP4 12
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRLP4 4
+CNSTI4 -1
+ASGNI4
+LABELV $368
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $365
+endproc Q_stricmp 16 12
+export Q_strlwr
+proc Q_strlwr 12 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $371
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $370
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $369
+endproc Q_strlwr 12 4
+export Q_strupr
+proc Q_strupr 12 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $375
+JUMPV
+LABELV $374
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $375
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $374
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $373
+endproc Q_strupr 12 4
+export Q_strcat
+proc Q_strcat 12 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $378
+CNSTI4 0
+ARGI4
+ADDRGP4 $380
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $378
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $377
+endproc Q_strcat 12 12
+export Q_stristr
+proc Q_stristr 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1
+ADDRLP4 12
+INDIRI1
+ASGNI1
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $382
+ADDRLP4 16
+ADDRLP4 1
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 97
+LTI4 $384
+ADDRLP4 16
+INDIRI4
+CNSTI4 122
+GTI4 $384
+ADDRLP4 1
+ADDRLP4 1
+INDIRI1
+CVII4 1
+CNSTI4 32
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $384
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 20
+INDIRU4
+ASGNU4
+LABELV $386
+LABELV $389
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 24
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+ADDRLP4 28
+INDIRI1
+ASGNI1
+ADDRLP4 28
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $392
+CNSTP4 0
+RETP4
+ADDRGP4 $381
+JUMPV
+LABELV $392
+ADDRLP4 32
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 97
+LTI4 $394
+ADDRLP4 32
+INDIRI4
+CNSTI4 122
+GTI4 $394
+ADDRLP4 0
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 32
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $394
+LABELV $390
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ADDRLP4 1
+INDIRI1
+CVII4 1
+NEI4 $389
+LABELV $387
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $386
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+LABELV $382
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $381
+endproc Q_stristr 36 12
+export Q_PrintStrlen
+proc Q_PrintStrlen 28 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $397
+CNSTI4 0
+RETI4
+ADDRGP4 $396
+JUMPV
+LABELV $397
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $402
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $402
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRLP4 12
+INDIRI4
+CNSTI4 65
+LTI4 $405
+ADDRLP4 12
+INDIRI4
+CNSTI4 90
+LEI4 $404
+LABELV $405
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 97
+LTI4 $406
+ADDRLP4 16
+INDIRI4
+CNSTI4 122
+LEI4 $404
+LABELV $406
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 48
+LTI4 $402
+ADDRLP4 20
+INDIRI4
+CNSTI4 57
+GTI4 $402
+LABELV $404
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $400
+JUMPV
+LABELV $402
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $400
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $399
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $396
+endproc Q_PrintStrlen 28 0
+export Q_CleanStr
+proc Q_CleanStr 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $409
+JUMPV
+LABELV $408
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $411
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $411
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $411
+ADDRLP4 20
+INDIRI4
+CNSTI4 65
+LTI4 $414
+ADDRLP4 20
+INDIRI4
+CNSTI4 90
+LEI4 $413
+LABELV $414
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 97
+LTI4 $415
+ADDRLP4 24
+INDIRI4
+CNSTI4 122
+LEI4 $413
+LABELV $415
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 48
+LTI4 $411
+ADDRLP4 28
+INDIRI4
+CNSTI4 57
+GTI4 $411
+LABELV $413
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $412
+JUMPV
+LABELV $411
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $416
+ADDRLP4 4
+INDIRI4
+CNSTI4 126
+GTI4 $416
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+LABELV $416
+LABELV $412
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $409
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $408
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $407
+endproc Q_CleanStr 40 0
+export Q_CountChar
+proc Q_CountChar 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $422
+JUMPV
+LABELV $419
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $423
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $423
+LABELV $420
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $422
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $419
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $418
+endproc Q_CountChar 4 0
+export Q_ParseClockTime
+proc Q_ParseClockTime 1080 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 1056
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRGP4 $429
+JUMPV
+LABELV $426
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 58
+NEI4 $430
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $430
+LABELV $427
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $429
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $426
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+NEI4 $432
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $437
+JUMPV
+LABELV $434
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 58
+NEI4 $438
+ADDRGP4 $436
+JUMPV
+LABELV $438
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $435
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $437
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $434
+LABELV $436
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1064
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 1068
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $433
+JUMPV
+LABELV $432
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+NEI4 $440
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $445
+JUMPV
+LABELV $442
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 58
+NEI4 $446
+ADDRGP4 $444
+JUMPV
+LABELV $446
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $443
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $445
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $442
+LABELV $444
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ARGP4
+ADDRLP4 1064
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRGP4 $451
+JUMPV
+LABELV $448
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 58
+NEI4 $452
+ADDRGP4 $450
+JUMPV
+LABELV $452
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $449
+ADDRLP4 1068
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1068
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 1068
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $451
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $448
+LABELV $450
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ARGP4
+ADDRLP4 1072
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 1076
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRGP4 $454
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTF4 3212836864
+RETF4
+ADDRGP4 $425
+JUMPV
+LABELV $441
+LABELV $433
+ADDRLP4 1064
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 1040
+CNSTF4 1148846080
+ADDRLP4 1064
+INDIRF4
+ADDRLP4 1064
+INDIRF4
+ADDRLP4 1052
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+ADDRLP4 1064
+INDIRF4
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ADDRLP4 1048
+INDIRI4
+CVIF4 4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 1040
+INDIRF4
+RETF4
+LABELV $425
+endproc Q_ParseClockTime 1080 8
+export Com_sprintf
+proc Com_sprintf 12 16
+ADDRLP4 4
+ADDRFP4 8+4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_vsnprintf
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $457
+ADDRGP4 $459
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $457
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $455
+endproc Com_sprintf 12 16
+bss
+align 1
+LABELV $461
+skip 64000
+data
+align 4
+LABELV $462
+byte 4 0
+export va
+code
+proc va 20 16
+ADDRLP4 8
+ADDRGP4 $462
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 32000
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+BANDI4
+MULI4
+ADDRGP4 $461
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTU4 32000
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $460
+endproc va 20 16
+export Com_TruncateLongString
+proc Com_TruncateLongString 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GTI4 $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $466
+JUMPV
+LABELV $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 29
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $467
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 -29
+ADDP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $466
+LABELV $464
+endproc Com_TruncateLongString 8 12
+bss
+align 1
+LABELV $469
+skip 16384
+data
+align 4
+LABELV $470
+byte 4 0
+export Info_ValueForKeyExt
+code
+proc Info_ValueForKeyExt 8220 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8196
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8196
+INDIRU4
+EQU4 $473
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8196
+INDIRU4
+NEU4 $471
+LABELV $473
+ADDRGP4 $59
+RETP4
+ADDRGP4 $468
+JUMPV
+LABELV $471
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8200
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8200
+INDIRU4
+CNSTU4 8192
+LTU4 $474
+CNSTI4 1
+ARGI4
+ADDRGP4 $476
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $474
+ADDRLP4 8204
+ADDRGP4 $470
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $480
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $480
+JUMPV
+LABELV $479
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $483
+JUMPV
+LABELV $482
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $485
+ADDRGP4 $59
+RETP4
+ADDRGP4 $468
+JUMPV
+LABELV $485
+ADDRLP4 8208
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8216
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8212
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8212
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $483
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $482
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $470
+INDIRI4
+CNSTI4 13
+LSHI4
+ADDRGP4 $469
+ADDP4
+ASGNP4
+ADDRGP4 $488
+JUMPV
+LABELV $487
+ADDRLP4 8208
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8216
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8212
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8212
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $488
+ADDRLP4 8208
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 92
+EQI4 $490
+ADDRLP4 8208
+INDIRI4
+CNSTI4 0
+NEI4 $487
+LABELV $490
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8212
+INDIRI4
+CNSTI4 0
+NEI4 $491
+ADDRGP4 $470
+INDIRI4
+CNSTI4 13
+LSHI4
+ADDRGP4 $469
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $493
+ADDRFP4 8
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $493
+ADDRGP4 $470
+INDIRI4
+CNSTI4 13
+LSHI4
+ADDRGP4 $469
+ADDP4
+RETP4
+ADDRGP4 $468
+JUMPV
+LABELV $491
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $495
+ADDRGP4 $481
+JUMPV
+LABELV $495
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $480
+ADDRGP4 $479
+JUMPV
+LABELV $481
+ADDRGP4 $59
+RETP4
+LABELV $468
+endproc Info_ValueForKeyExt 8220 8
+export Info_ValueForKey
+proc Info_ValueForKey 8 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 Info_ValueForKeyExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $497
+endproc Info_ValueForKey 8 12
+export Info_NextPair
+proc Info_NextPair 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $499
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $499
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $504
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $498
+JUMPV
+LABELV $504
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $502
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $501
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $507
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 92
+EQI4 $509
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $506
+LABELV $509
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $498
+endproc Info_NextPair 20 0
+export Info_RemoveKey
+proc Info_RemoveKey 2080 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2056
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2056
+INDIRU4
+CNSTU4 1024
+LTU4 $511
+CNSTI4 1
+ARGI4
+ADDRGP4 $513
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $511
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 2060
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2060
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $517
+ADDRGP4 $510
+JUMPV
+LABELV $516
+ADDRLP4 1028
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $519
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $519
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $524
+ADDRGP4 $510
+JUMPV
+LABELV $524
+ADDRLP4 2068
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2076
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $522
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $521
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1032
+ASGNP4
+ADDRGP4 $527
+JUMPV
+LABELV $526
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $529
+ADDRGP4 $510
+JUMPV
+LABELV $529
+ADDRLP4 2068
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2076
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $527
+ADDRLP4 2068
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 92
+EQI4 $531
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $526
+LABELV $531
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $532
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2076
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $510
+JUMPV
+LABELV $532
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $534
+ADDRGP4 $510
+JUMPV
+LABELV $534
+LABELV $517
+ADDRGP4 $516
+JUMPV
+LABELV $510
+endproc Info_RemoveKey 2080 12
+export Info_RemoveKey_Big
+proc Info_RemoveKey_Big 16416 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16392
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16392
+INDIRU4
+CNSTU4 8192
+LTU4 $537
+CNSTI4 1
+ARGI4
+ADDRGP4 $539
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $537
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 16396
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $543
+ADDRGP4 $536
+JUMPV
+LABELV $542
+ADDRLP4 8196
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $545
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $545
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $548
+JUMPV
+LABELV $547
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $550
+ADDRGP4 $536
+JUMPV
+LABELV $550
+ADDRLP4 16404
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16412
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16408
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 16408
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16408
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $548
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $547
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8200
+ASGNP4
+ADDRGP4 $553
+JUMPV
+LABELV $552
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $555
+ADDRGP4 $536
+JUMPV
+LABELV $555
+ADDRLP4 16404
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16412
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16408
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 16408
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16408
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $553
+ADDRLP4 16404
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16404
+INDIRI4
+CNSTI4 92
+EQI4 $557
+ADDRLP4 16404
+INDIRI4
+CNSTI4 0
+NEI4 $552
+LABELV $557
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16408
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 16408
+INDIRI4
+CNSTI4 0
+NEI4 $558
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16412
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8196
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16412
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $536
+JUMPV
+LABELV $558
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $560
+ADDRGP4 $536
+JUMPV
+LABELV $560
+LABELV $543
+ADDRGP4 $542
+JUMPV
+LABELV $536
+endproc Info_RemoveKey_Big 16416 12
+export Info_Validate
+proc Info_Validate 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRLP4 0
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $563
+CNSTI4 0
+RETI4
+ADDRGP4 $562
+JUMPV
+LABELV $563
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 59
+ARGI4
+ADDRLP4 4
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $565
+CNSTI4 0
+RETI4
+ADDRGP4 $562
+JUMPV
+LABELV $565
+CNSTI4 1
+RETI4
+LABELV $562
+endproc Info_Validate 8 8
+export Info_SetValueForKey
+proc Info_SetValueForKey 1048 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $568
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1028
+INDIRU4
+CNSTU4 1024
+LTU4 $575
+CNSTI4 1
+ARGI4
+ADDRGP4 $571
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+ADDRGP4 $575
+JUMPV
+LABELV $572
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1032
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $578
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1036
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $576
+LABELV $578
+ADDRGP4 $579
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $567
+JUMPV
+LABELV $576
+LABELV $573
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $575
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $572
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Info_RemoveKey
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $582
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRU4
+CNSTU4 0
+NEU4 $580
+LABELV $582
+ADDRGP4 $567
+JUMPV
+LABELV $580
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $583
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRU4
+ADDRLP4 1044
+INDIRU4
+ADDU4
+CNSTU4 1024
+LTU4 $584
+ADDRGP4 $586
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $567
+JUMPV
+LABELV $584
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $567
+endproc Info_SetValueForKey 1048 20
+export Info_SetValueForKey_Big
+proc Info_SetValueForKey_Big 8208 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $568
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8196
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8196
+INDIRU4
+CNSTU4 8192
+LTU4 $593
+CNSTI4 1
+ARGI4
+ADDRGP4 $571
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+ADDRGP4 $593
+JUMPV
+LABELV $590
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8200
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8200
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $596
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8204
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $594
+LABELV $596
+ADDRGP4 $579
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $594
+LABELV $591
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $593
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $590
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Info_RemoveKey_Big
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $597
+ADDRGP4 $587
+JUMPV
+LABELV $597
+ADDRLP4 4
+ARGP4
+CNSTI4 8192
+ARGI4
+ADDRGP4 $583
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 8200
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8200
+INDIRU4
+ADDRLP4 8204
+INDIRU4
+ADDU4
+CNSTU4 8192
+LTU4 $599
+ADDRGP4 $601
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $599
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $587
+endproc Info_SetValueForKey_Big 8208 20
+proc Com_CharIsOneOfCharset 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $606
+JUMPV
+LABELV $603
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRFP4 0
+INDIRI1
+CVII4 1
+NEI4 $607
+CNSTI4 1
+RETI4
+ADDRGP4 $602
+JUMPV
+LABELV $607
+LABELV $604
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $606
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 4
+INDIRU4
+LTU4 $603
+CNSTI4 0
+RETI4
+LABELV $602
+endproc Com_CharIsOneOfCharset 8 4
+export Com_SkipCharset
+proc Com_SkipCharset 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $611
+JUMPV
+LABELV $610
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $612
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $614
+LABELV $611
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $610
+LABELV $612
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $609
+endproc Com_SkipCharset 8 8
+export Com_SkipTokens
+proc Com_SkipTokens 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $617
+JUMPV
+LABELV $616
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $619
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $622
+JUMPV
+LABELV $621
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $622
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $621
+ADDRGP4 $620
+JUMPV
+LABELV $619
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $624
+ADDRGP4 $618
+JUMPV
+LABELV $624
+LABELV $620
+LABELV $617
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $616
+LABELV $618
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $626
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $615
+JUMPV
+LABELV $626
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $615
+endproc Com_SkipTokens 20 8
+export Crash
+proc Crash 0 0
+CNSTP4 0
+CNSTI4 1365
+ASGNI4
+LABELV $628
+endproc Crash 0 0
+export Q_PrintSubString
+proc Q_PrintSubString 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $631
+JUMPV
+LABELV $630
+ADDRGP4 $633
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $631
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+GEU4 $634
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $630
+LABELV $634
+LABELV $629
+endproc Q_PrintSubString 8 8
+export Q_GetCpFromUtf8
+proc Q_GetCpFromUtf8 28 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 127
+GTI4 $636
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $636
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 224
+BANDI4
+CNSTI4 192
+NEI4 $638
+ADDRGP4 $640
+JUMPV
+ADDRGP4 $642
+ARGP4
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $640
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 6
+LSHI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 63
+BANDI4
+BORI4
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $638
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 240
+BANDI4
+CNSTI4 224
+NEI4 $643
+ADDRGP4 $645
+JUMPV
+ADDRGP4 $647
+ARGP4
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $645
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 63
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 15
+BANDI4
+CNSTI4 12
+LSHI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+BANDI4
+CNSTI4 6
+LSHI4
+BORI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+BANDI4
+BORI4
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $643
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 248
+BANDI4
+CNSTI4 240
+NEI4 $648
+ADDRGP4 $650
+JUMPV
+ADDRGP4 $652
+ARGP4
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $650
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 63
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+BANDI4
+CNSTI4 18
+LSHI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+BANDI4
+CNSTI4 12
+LSHI4
+BORI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+BANDI4
+CNSTI4 6
+LSHI4
+BORI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRI4
+BANDI4
+BORI4
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $648
+ADDRGP4 $653
+ARGP4
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+RETI4
+LABELV $635
+endproc Q_GetCpFromUtf8 28 8
+export Q_GetUtf8FromCp
+proc Q_GetUtf8FromCp 0 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $655
+ADDRGP4 $657
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $658
+JUMPV
+LABELV $655
+ADDRFP4 0
+INDIRI4
+CNSTI4 127
+GTI4 $659
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 8
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $654
+JUMPV
+LABELV $659
+ADDRFP4 0
+INDIRI4
+CNSTI4 2047
+GTI4 $661
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+RSHI4
+CNSTI4 31
+BANDI4
+CNSTI4 192
+BORI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 63
+BANDI4
+CNSTI4 128
+BORI4
+CVII1 4
+ASGNI1
+ADDRFP4 8
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $654
+JUMPV
+LABELV $661
+ADDRFP4 0
+INDIRI4
+CNSTI4 65535
+GTI4 $663
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+RSHI4
+CNSTI4 15
+BANDI4
+CNSTI4 224
+BORI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+RSHI4
+CNSTI4 63
+BANDI4
+CNSTI4 128
+BORI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 63
+BANDI4
+CNSTI4 128
+BORI4
+CVII1 4
+ASGNI1
+ADDRFP4 8
+INDIRP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $654
+JUMPV
+LABELV $663
+ADDRFP4 0
+INDIRI4
+CNSTI4 2097151
+GTI4 $665
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 18
+RSHI4
+CNSTI4 7
+BANDI4
+CNSTI4 240
+BORI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+RSHI4
+CNSTI4 63
+BANDI4
+CNSTI4 128
+BORI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+RSHI4
+CNSTI4 63
+BANDI4
+CNSTI4 128
+BORI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 63
+BANDI4
+CNSTI4 128
+BORI4
+CVII1 4
+ASGNI1
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $654
+JUMPV
+LABELV $665
+LABELV $658
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 127
+BANDI4
+CVII1 4
+ASGNI1
+ADDRFP4 8
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $654
+endproc Q_GetUtf8FromCp 0 8
+bss
+align 4
+LABELV com_tokenline
+skip 4
+align 4
+LABELV com_lines
+skip 4
+align 1
+LABELV com_parsename
+skip 1024
+align 1
+LABELV com_token
+skip 1024
+import VectorCheck
+import Com_Printf
+import Com_Error
+import Com_RandomBytes
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $657
+byte 1 94
+byte 1 51
+byte 1 81
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 85
+byte 1 116
+byte 1 102
+byte 1 56
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 67
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $653
+byte 1 94
+byte 1 51
+byte 1 81
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 67
+byte 1 112
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 85
+byte 1 116
+byte 1 102
+byte 1 56
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 116
+byte 1 102
+byte 1 56
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $652
+byte 1 94
+byte 1 51
+byte 1 81
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 67
+byte 1 112
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 85
+byte 1 116
+byte 1 102
+byte 1 56
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 116
+byte 1 102
+byte 1 56
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $647
+byte 1 94
+byte 1 51
+byte 1 81
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 67
+byte 1 112
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 85
+byte 1 116
+byte 1 102
+byte 1 56
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 116
+byte 1 102
+byte 1 56
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $642
+byte 1 94
+byte 1 51
+byte 1 81
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 67
+byte 1 112
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 85
+byte 1 116
+byte 1 102
+byte 1 56
+byte 1 32
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 116
+byte 1 102
+byte 1 56
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $633
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $601
+byte 1 66
+byte 1 73
+byte 1 71
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $586
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $583
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $579
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 99
+byte 1 39
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $571
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $568
+byte 1 92
+byte 1 59
+byte 1 34
+byte 1 0
+align 1
+LABELV $539
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 66
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $513
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $476
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $467
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 0
+align 1
+LABELV $459
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $454
+byte 1 81
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 49
+byte 1 58
+byte 1 51
+byte 1 56
+byte 1 44
+byte 1 32
+byte 1 49
+byte 1 53
+byte 1 58
+byte 1 48
+byte 1 49
+byte 1 44
+byte 1 32
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 53
+byte 1 44
+byte 1 32
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $380
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $321
+byte 1 115
+byte 1 114
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $320
+byte 1 94
+byte 1 49
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 112
+byte 1 32
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $317
+byte 1 103
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $314
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $311
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $308
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 115
+byte 1 114
+byte 1 99
+byte 1 0
+align 1
+LABELV $305
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $238
+byte 1 41
+byte 1 0
+align 1
+LABELV $233
+byte 1 40
+byte 1 0
+align 1
+LABELV $226
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 79
+byte 1 102
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 42
+byte 1 112
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $208
+byte 1 77
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $114
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $110
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $102
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $59
+byte 1 0
+align 1
+LABELV $43
+byte 1 83
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $42
+byte 1 83
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $41
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 0
+align 1
+LABELV $40
+byte 1 84
+byte 1 104
+byte 1 117
+byte 1 0
+align 1
+LABELV $39
+byte 1 87
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $38
+byte 1 84
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $37
+byte 1 77
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $36
+byte 1 68
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $35
+byte 1 78
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $34
+byte 1 79
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $33
+byte 1 83
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $32
+byte 1 65
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $31
+byte 1 74
+byte 1 117
+byte 1 108
+byte 1 0
+align 1
+LABELV $30
+byte 1 74
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $29
+byte 1 77
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $28
+byte 1 65
+byte 1 112
+byte 1 114
+byte 1 0
+align 1
+LABELV $27
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $26
+byte 1 70
+byte 1 101
+byte 1 98
+byte 1 0
+align 1
+LABELV $25
+byte 1 74
+byte 1 97
+byte 1 110
+byte 1 0
@@ -0,0 +1,16239 @@
+data
+export STAT_HEALTH
+align 4
+LABELV STAT_HEALTH
+byte 4 0
+export STAT_HOLDABLE_ITEM
+align 4
+LABELV STAT_HOLDABLE_ITEM
+byte 4 1
+export STAT_PERSISTANT_POWERUP
+align 4
+LABELV STAT_PERSISTANT_POWERUP
+byte 4 2
+export STAT_WEAPONS
+align 4
+LABELV STAT_WEAPONS
+byte 4 3
+export STAT_ARMOR
+align 4
+LABELV STAT_ARMOR
+byte 4 4
+export STAT_BATTLE_SUIT_KILL_COUNT
+align 4
+LABELV STAT_BATTLE_SUIT_KILL_COUNT
+byte 4 5
+export STAT_CLIENTS_READY
+align 4
+LABELV STAT_CLIENTS_READY
+byte 4 6
+export STAT_MAX_HEALTH
+align 4
+LABELV STAT_MAX_HEALTH
+byte 4 7
+export STAT_UNKNOWN_8
+align 4
+LABELV STAT_UNKNOWN_8
+byte 4 8
+export STAT_UNKNOWN_9
+align 4
+LABELV STAT_UNKNOWN_9
+byte 4 9
+export STAT_UNKNOWN_10
+align 4
+LABELV STAT_UNKNOWN_10
+byte 4 10
+export STAT_POWERUP_REMAINING
+align 4
+LABELV STAT_POWERUP_REMAINING
+byte 4 11
+export STAT_UNKNOWN_12
+align 4
+LABELV STAT_UNKNOWN_12
+byte 4 12
+export STAT_QUAD_KILL_COUNT
+align 4
+LABELV STAT_QUAD_KILL_COUNT
+byte 4 13
+export STAT_ARMOR_TIER
+align 4
+LABELV STAT_ARMOR_TIER
+byte 4 14
+export STAT_MAP_KEYS
+align 4
+LABELV STAT_MAP_KEYS
+byte 4 15
+export PERS_SCORE
+align 4
+LABELV PERS_SCORE
+byte 4 0
+export PERS_HITS
+align 4
+LABELV PERS_HITS
+byte 4 1
+export PERS_RANK
+align 4
+LABELV PERS_RANK
+byte 4 2
+export PERS_TEAM
+align 4
+LABELV PERS_TEAM
+byte 4 3
+export PERS_SPAWN_COUNT
+align 4
+LABELV PERS_SPAWN_COUNT
+byte 4 4
+export PERS_PLAYEREVENTS
+align 4
+LABELV PERS_PLAYEREVENTS
+byte 4 5
+export PERS_ATTACKER
+align 4
+LABELV PERS_ATTACKER
+byte 4 6
+export PERS_KILLED
+align 4
+LABELV PERS_KILLED
+byte 4 7
+export PERS_IMPRESSIVE_COUNT
+align 4
+LABELV PERS_IMPRESSIVE_COUNT
+byte 4 8
+export PERS_EXCELLENT_COUNT
+align 4
+LABELV PERS_EXCELLENT_COUNT
+byte 4 9
+export PERS_DEFEND_COUNT
+align 4
+LABELV PERS_DEFEND_COUNT
+byte 4 10
+export PERS_ASSIST_COUNT
+align 4
+LABELV PERS_ASSIST_COUNT
+byte 4 11
+export PERS_GAUNTLET_FRAG_COUNT
+align 4
+LABELV PERS_GAUNTLET_FRAG_COUNT
+byte 4 12
+export PERS_CAPTURES
+align 4
+LABELV PERS_CAPTURES
+byte 4 13
+export PERS_ATTACKEE_ARMOR
+align 4
+LABELV PERS_ATTACKEE_ARMOR
+byte 4 14
+export WP_NUM_WEAPONS
+align 4
+LABELV WP_NUM_WEAPONS
+byte 4 15
+export PW_NONE
+align 4
+LABELV PW_NONE
+byte 4 0
+export PW_QUAD
+align 4
+LABELV PW_QUAD
+byte 4 1
+export PW_BATTLESUIT
+align 4
+LABELV PW_BATTLESUIT
+byte 4 2
+export PW_HASTE
+align 4
+LABELV PW_HASTE
+byte 4 3
+export PW_INVIS
+align 4
+LABELV PW_INVIS
+byte 4 4
+export PW_REGEN
+align 4
+LABELV PW_REGEN
+byte 4 5
+export PW_FLIGHT
+align 4
+LABELV PW_FLIGHT
+byte 4 6
+export PW_REDFLAG
+align 4
+LABELV PW_REDFLAG
+byte 4 7
+export PW_BLUEFLAG
+align 4
+LABELV PW_BLUEFLAG
+byte 4 8
+export PW_NEUTRALFLAG
+align 4
+LABELV PW_NEUTRALFLAG
+byte 4 9
+export PW_INVULNERABILITY
+align 4
+LABELV PW_INVULNERABILITY
+byte 4 10
+export PW_SCOUT
+align 4
+LABELV PW_SCOUT
+byte 4 11
+export PW_GUARD
+align 4
+LABELV PW_GUARD
+byte 4 12
+export PW_DOUBLER
+align 4
+LABELV PW_DOUBLER
+byte 4 13
+export PW_ARMORREGEN
+align 4
+LABELV PW_ARMORREGEN
+byte 4 14
+export PW_FROZEN
+align 4
+LABELV PW_FROZEN
+byte 4 15
+export PW_NUM_POWERUPS
+align 4
+LABELV PW_NUM_POWERUPS
+byte 4 16
+export bg_playerMins
+align 4
+LABELV bg_playerMins
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3250585600
+export bg_playerMaxs
+align 4
+LABELV bg_playerMaxs
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1107296256
+export bg_itemlist
+align 4
+LABELV bg_itemlist
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $44
+address $44
+address $45
+address $46
+address $47
+address $48
+byte 4 0
+byte 4 0
+address $49
+address $50
+byte 4 5
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $51
+address $52
+address $53
+byte 4 0
+byte 4 0
+byte 4 0
+address $54
+address $55
+byte 4 50
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $56
+address $52
+address $57
+byte 4 0
+byte 4 0
+byte 4 0
+address $58
+address $59
+byte 4 100
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $60
+address $52
+address $61
+byte 4 0
+byte 4 0
+byte 4 0
+address $62
+address $63
+byte 4 25
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $64
+address $65
+address $66
+address $67
+byte 4 0
+byte 4 0
+address $68
+address $69
+byte 4 5
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $70
+address $71
+address $72
+address $73
+byte 4 0
+byte 4 0
+address $74
+address $75
+byte 4 25
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $76
+address $77
+address $78
+address $79
+byte 4 0
+byte 4 0
+address $80
+address $81
+byte 4 50
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $82
+address $83
+address $84
+address $85
+byte 4 0
+byte 4 0
+address $86
+address $87
+byte 4 100
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $88
+address $89
+address $90
+byte 4 0
+byte 4 0
+byte 4 0
+address $91
+address $92
+byte 4 0
+byte 4 1
+byte 4 1
+address $44
+address $44
+address $93
+address $89
+address $94
+byte 4 0
+byte 4 0
+byte 4 0
+address $95
+address $96
+byte 4 10
+byte 4 1
+byte 4 3
+address $44
+address $44
+address $97
+address $89
+address $98
+byte 4 0
+byte 4 0
+byte 4 0
+address $99
+address $100
+byte 4 40
+byte 4 1
+byte 4 2
+address $44
+address $44
+address $101
+address $89
+address $102
+byte 4 0
+byte 4 0
+byte 4 0
+address $103
+address $104
+byte 4 10
+byte 4 1
+byte 4 4
+address $44
+address $105
+address $106
+address $89
+address $107
+byte 4 0
+byte 4 0
+byte 4 0
+address $108
+address $109
+byte 4 10
+byte 4 1
+byte 4 5
+address $44
+address $44
+address $110
+address $89
+address $111
+byte 4 0
+byte 4 0
+byte 4 0
+address $112
+address $113
+byte 4 100
+byte 4 1
+byte 4 6
+address $44
+address $44
+address $114
+address $89
+address $115
+byte 4 0
+byte 4 0
+byte 4 0
+address $116
+address $117
+byte 4 10
+byte 4 1
+byte 4 7
+address $44
+address $44
+address $118
+address $89
+address $119
+byte 4 0
+byte 4 0
+byte 4 0
+address $120
+address $121
+byte 4 50
+byte 4 1
+byte 4 8
+address $44
+address $44
+address $122
+address $89
+address $123
+byte 4 0
+byte 4 0
+byte 4 0
+address $124
+address $125
+byte 4 20
+byte 4 1
+byte 4 9
+address $44
+address $44
+address $126
+address $89
+address $127
+byte 4 0
+byte 4 0
+byte 4 0
+address $128
+address $129
+byte 4 0
+byte 4 1
+byte 4 10
+address $44
+address $44
+address $130
+address $131
+address $132
+byte 4 0
+byte 4 0
+byte 4 0
+address $133
+address $134
+byte 4 10
+byte 4 2
+byte 4 3
+address $44
+address $44
+address $135
+address $131
+address $136
+byte 4 0
+byte 4 0
+byte 4 0
+address $137
+address $138
+byte 4 50
+byte 4 2
+byte 4 2
+address $44
+address $44
+address $139
+address $131
+address $140
+byte 4 0
+byte 4 0
+byte 4 0
+address $141
+address $142
+byte 4 5
+byte 4 2
+byte 4 4
+address $44
+address $44
+address $143
+address $131
+address $144
+byte 4 0
+byte 4 0
+byte 4 0
+address $145
+address $146
+byte 4 30
+byte 4 2
+byte 4 8
+address $44
+address $44
+address $147
+address $131
+address $148
+byte 4 0
+byte 4 0
+byte 4 0
+address $149
+address $150
+byte 4 60
+byte 4 2
+byte 4 6
+address $44
+address $44
+address $151
+address $131
+address $152
+byte 4 0
+byte 4 0
+byte 4 0
+address $153
+address $154
+byte 4 5
+byte 4 2
+byte 4 5
+address $44
+address $44
+address $155
+address $131
+address $156
+byte 4 0
+byte 4 0
+byte 4 0
+address $157
+address $158
+byte 4 10
+byte 4 2
+byte 4 7
+address $44
+address $44
+address $159
+address $131
+address $160
+byte 4 0
+byte 4 0
+byte 4 0
+address $161
+address $162
+byte 4 15
+byte 4 2
+byte 4 9
+address $44
+address $44
+address $163
+address $164
+address $165
+byte 4 0
+byte 4 0
+byte 4 0
+address $166
+address $167
+byte 4 60
+byte 4 6
+byte 4 1
+address $44
+address $44
+address $168
+address $164
+address $169
+address $170
+byte 4 0
+byte 4 0
+address $171
+address $172
+byte 4 60
+byte 4 6
+byte 4 2
+address $44
+address $173
+address $174
+address $175
+address $176
+address $177
+byte 4 0
+byte 4 0
+address $178
+address $179
+byte 4 30
+byte 4 5
+byte 4 1
+address $44
+address $180
+address $181
+address $182
+address $183
+address $184
+byte 4 0
+byte 4 0
+address $185
+address $186
+byte 4 30
+byte 4 5
+byte 4 2
+address $44
+address $187
+address $188
+address $189
+address $190
+address $191
+byte 4 0
+byte 4 0
+address $192
+address $193
+byte 4 30
+byte 4 5
+byte 4 3
+address $44
+address $44
+address $194
+address $195
+address $196
+address $197
+byte 4 0
+byte 4 0
+address $198
+address $199
+byte 4 30
+byte 4 5
+byte 4 4
+address $44
+address $44
+address $200
+address $201
+address $202
+address $203
+byte 4 0
+byte 4 0
+address $204
+address $205
+byte 4 30
+byte 4 5
+byte 4 5
+address $44
+address $206
+address $207
+address $208
+address $209
+address $210
+byte 4 0
+byte 4 0
+address $211
+address $212
+byte 4 60
+byte 4 5
+byte 4 6
+address $44
+address $208
+address $213
+byte 4 0
+address $214
+address $215
+byte 4 0
+byte 4 0
+address $216
+address $217
+byte 4 0
+byte 4 8
+byte 4 7
+address $44
+address $44
+address $218
+byte 4 0
+address $219
+address $220
+byte 4 0
+byte 4 0
+address $221
+address $222
+byte 4 0
+byte 4 8
+byte 4 8
+address $44
+address $44
+address $223
+address $164
+address $224
+byte 4 0
+byte 4 0
+byte 4 0
+address $225
+address $226
+byte 4 60
+byte 4 6
+byte 4 3
+address $44
+address $227
+address $228
+address $164
+address $229
+byte 4 0
+byte 4 0
+byte 4 0
+address $230
+address $231
+byte 4 60
+byte 4 6
+byte 4 4
+address $44
+address $44
+address $232
+address $164
+address $233
+byte 4 0
+byte 4 0
+byte 4 0
+address $234
+address $235
+byte 4 60
+byte 4 6
+byte 4 5
+address $44
+address $44
+address $236
+address $131
+address $237
+byte 4 0
+byte 4 0
+byte 4 0
+address $238
+address $239
+byte 4 20
+byte 4 2
+byte 4 11
+address $44
+address $44
+address $240
+address $131
+address $241
+byte 4 0
+byte 4 0
+byte 4 0
+address $242
+address $243
+byte 4 10
+byte 4 2
+byte 4 12
+address $44
+address $44
+address $244
+address $131
+address $245
+byte 4 0
+byte 4 0
+byte 4 0
+address $246
+address $247
+byte 4 100
+byte 4 2
+byte 4 13
+address $44
+address $44
+address $248
+address $249
+address $250
+byte 4 0
+byte 4 0
+byte 4 0
+address $251
+address $252
+byte 4 30
+byte 4 7
+byte 4 11
+address $44
+address $44
+address $253
+address $254
+address $255
+byte 4 0
+byte 4 0
+byte 4 0
+address $256
+address $257
+byte 4 30
+byte 4 7
+byte 4 12
+address $44
+address $44
+address $258
+address $259
+address $260
+byte 4 0
+byte 4 0
+byte 4 0
+address $261
+address $262
+byte 4 30
+byte 4 7
+byte 4 13
+address $44
+address $44
+address $263
+address $264
+address $265
+byte 4 0
+byte 4 0
+byte 4 0
+address $266
+address $267
+byte 4 30
+byte 4 7
+byte 4 14
+address $44
+address $44
+address $268
+byte 4 0
+address $269
+address $270
+byte 4 0
+byte 4 0
+address $271
+address $272
+byte 4 0
+byte 4 8
+byte 4 9
+address $44
+address $44
+address $273
+address $131
+address $274
+byte 4 0
+byte 4 0
+byte 4 0
+address $275
+address $276
+byte 4 0
+byte 4 8
+byte 4 0
+address $44
+address $44
+address $277
+address $131
+address $278
+byte 4 0
+byte 4 0
+byte 4 0
+address $279
+address $280
+byte 4 0
+byte 4 8
+byte 4 0
+address $44
+address $44
+address $281
+address $89
+address $282
+byte 4 0
+byte 4 0
+byte 4 0
+address $283
+address $284
+byte 4 10
+byte 4 1
+byte 4 11
+address $44
+address $44
+address $285
+address $89
+address $286
+byte 4 0
+byte 4 0
+byte 4 0
+address $287
+address $288
+byte 4 5
+byte 4 1
+byte 4 12
+address $44
+address $289
+address $290
+address $89
+address $291
+byte 4 0
+byte 4 0
+byte 4 0
+address $292
+address $293
+byte 4 80
+byte 4 1
+byte 4 13
+address $44
+address $294
+address $295
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $296
+address $297
+byte 4 0
+byte 4 0
+byte 4 0
+address $44
+address $44
+address $298
+address $89
+address $299
+byte 4 0
+byte 4 0
+byte 4 0
+address $300
+address $301
+byte 4 0
+byte 4 1
+byte 4 14
+address $44
+address $44
+address $302
+address $131
+address $303
+byte 4 0
+byte 4 0
+byte 4 0
+address $304
+address $305
+byte 4 0
+byte 4 2
+byte 4 14
+address $44
+address $44
+address $306
+address $131
+address $307
+byte 4 0
+byte 4 0
+byte 4 0
+address $308
+address $309
+byte 4 0
+byte 4 2
+byte 4 0
+address $44
+address $44
+address $310
+address $311
+address $312
+byte 4 0
+byte 4 0
+byte 4 0
+address $313
+address $314
+byte 4 0
+byte 4 7
+byte 4 601
+address $44
+address $44
+address $315
+address $316
+address $317
+byte 4 0
+byte 4 0
+byte 4 0
+address $318
+address $319
+byte 4 0
+byte 4 7
+byte 4 601
+address $44
+address $44
+address $320
+byte 4 0
+address $321
+byte 4 0
+byte 4 0
+byte 4 0
+address $322
+address $323
+byte 4 0
+byte 4 7
+byte 4 601
+address $44
+address $44
+byte 4 0
+skip 48
+export bg_itemlistQldm91
+align 4
+LABELV bg_itemlistQldm91
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $44
+address $44
+address $45
+address $46
+address $47
+address $48
+byte 4 0
+byte 4 0
+address $49
+address $50
+byte 4 5
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $51
+address $52
+address $53
+byte 4 0
+byte 4 0
+byte 4 0
+address $54
+address $55
+byte 4 50
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $56
+address $52
+address $57
+byte 4 0
+byte 4 0
+byte 4 0
+address $58
+address $59
+byte 4 100
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $60
+address $52
+address $61
+byte 4 0
+byte 4 0
+byte 4 0
+address $62
+address $63
+byte 4 25
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $64
+address $65
+address $66
+address $67
+byte 4 0
+byte 4 0
+address $68
+address $69
+byte 4 5
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $70
+address $71
+address $72
+address $73
+byte 4 0
+byte 4 0
+address $74
+address $75
+byte 4 25
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $76
+address $77
+address $78
+address $79
+byte 4 0
+byte 4 0
+address $80
+address $81
+byte 4 50
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $82
+address $83
+address $84
+address $85
+byte 4 0
+byte 4 0
+address $86
+address $87
+byte 4 100
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $88
+address $89
+address $90
+byte 4 0
+byte 4 0
+byte 4 0
+address $91
+address $92
+byte 4 0
+byte 4 1
+byte 4 1
+address $44
+address $44
+address $93
+address $89
+address $94
+byte 4 0
+byte 4 0
+byte 4 0
+address $95
+address $96
+byte 4 10
+byte 4 1
+byte 4 3
+address $44
+address $44
+address $97
+address $89
+address $98
+byte 4 0
+byte 4 0
+byte 4 0
+address $99
+address $100
+byte 4 40
+byte 4 1
+byte 4 2
+address $44
+address $44
+address $101
+address $89
+address $102
+byte 4 0
+byte 4 0
+byte 4 0
+address $103
+address $104
+byte 4 10
+byte 4 1
+byte 4 4
+address $44
+address $105
+address $106
+address $89
+address $107
+byte 4 0
+byte 4 0
+byte 4 0
+address $108
+address $109
+byte 4 10
+byte 4 1
+byte 4 5
+address $44
+address $44
+address $110
+address $89
+address $111
+byte 4 0
+byte 4 0
+byte 4 0
+address $112
+address $113
+byte 4 100
+byte 4 1
+byte 4 6
+address $44
+address $44
+address $114
+address $89
+address $115
+byte 4 0
+byte 4 0
+byte 4 0
+address $116
+address $117
+byte 4 10
+byte 4 1
+byte 4 7
+address $44
+address $44
+address $118
+address $89
+address $119
+byte 4 0
+byte 4 0
+byte 4 0
+address $120
+address $121
+byte 4 50
+byte 4 1
+byte 4 8
+address $44
+address $44
+address $122
+address $89
+address $123
+byte 4 0
+byte 4 0
+byte 4 0
+address $124
+address $125
+byte 4 20
+byte 4 1
+byte 4 9
+address $44
+address $44
+address $126
+address $89
+address $127
+byte 4 0
+byte 4 0
+byte 4 0
+address $128
+address $129
+byte 4 0
+byte 4 1
+byte 4 10
+address $44
+address $44
+address $130
+address $131
+address $132
+byte 4 0
+byte 4 0
+byte 4 0
+address $133
+address $134
+byte 4 10
+byte 4 2
+byte 4 3
+address $44
+address $44
+address $135
+address $131
+address $136
+byte 4 0
+byte 4 0
+byte 4 0
+address $137
+address $138
+byte 4 50
+byte 4 2
+byte 4 2
+address $44
+address $44
+address $139
+address $131
+address $140
+byte 4 0
+byte 4 0
+byte 4 0
+address $141
+address $142
+byte 4 5
+byte 4 2
+byte 4 4
+address $44
+address $44
+address $143
+address $131
+address $144
+byte 4 0
+byte 4 0
+byte 4 0
+address $145
+address $146
+byte 4 30
+byte 4 2
+byte 4 8
+address $44
+address $44
+address $147
+address $131
+address $148
+byte 4 0
+byte 4 0
+byte 4 0
+address $149
+address $150
+byte 4 60
+byte 4 2
+byte 4 6
+address $44
+address $44
+address $151
+address $131
+address $152
+byte 4 0
+byte 4 0
+byte 4 0
+address $153
+address $154
+byte 4 5
+byte 4 2
+byte 4 5
+address $44
+address $44
+address $155
+address $131
+address $156
+byte 4 0
+byte 4 0
+byte 4 0
+address $157
+address $158
+byte 4 10
+byte 4 2
+byte 4 7
+address $44
+address $44
+address $159
+address $131
+address $160
+byte 4 0
+byte 4 0
+byte 4 0
+address $161
+address $162
+byte 4 15
+byte 4 2
+byte 4 9
+address $44
+address $44
+address $163
+address $164
+address $165
+byte 4 0
+byte 4 0
+byte 4 0
+address $166
+address $167
+byte 4 60
+byte 4 6
+byte 4 1
+address $44
+address $44
+address $168
+address $164
+address $169
+address $170
+byte 4 0
+byte 4 0
+address $171
+address $172
+byte 4 60
+byte 4 6
+byte 4 2
+address $44
+address $173
+address $174
+address $175
+address $176
+address $177
+byte 4 0
+byte 4 0
+address $178
+address $179
+byte 4 30
+byte 4 5
+byte 4 4
+address $44
+address $180
+address $181
+address $182
+address $183
+address $184
+byte 4 0
+byte 4 0
+address $185
+address $186
+byte 4 30
+byte 4 5
+byte 4 5
+address $44
+address $187
+address $188
+address $189
+address $190
+address $191
+byte 4 0
+byte 4 0
+address $192
+address $193
+byte 4 30
+byte 4 5
+byte 4 6
+address $44
+address $44
+address $194
+address $195
+address $196
+address $197
+byte 4 0
+byte 4 0
+address $198
+address $199
+byte 4 30
+byte 4 5
+byte 4 7
+address $44
+address $44
+address $200
+address $201
+address $202
+address $203
+byte 4 0
+byte 4 0
+address $204
+address $205
+byte 4 30
+byte 4 5
+byte 4 8
+address $44
+address $206
+address $207
+address $208
+address $209
+address $210
+byte 4 0
+byte 4 0
+address $211
+address $212
+byte 4 60
+byte 4 5
+byte 4 9
+address $44
+address $208
+address $213
+byte 4 0
+address $214
+address $215
+byte 4 0
+byte 4 0
+address $216
+address $217
+byte 4 0
+byte 4 8
+byte 4 1
+address $44
+address $44
+address $218
+byte 4 0
+address $219
+address $220
+byte 4 0
+byte 4 0
+address $221
+address $222
+byte 4 0
+byte 4 8
+byte 4 2
+address $44
+address $44
+address $223
+address $164
+address $224
+byte 4 0
+byte 4 0
+byte 4 0
+address $225
+address $226
+byte 4 60
+byte 4 6
+byte 4 3
+address $44
+address $227
+address $228
+address $164
+address $229
+byte 4 0
+byte 4 0
+byte 4 0
+address $230
+address $231
+byte 4 60
+byte 4 6
+byte 4 4
+address $44
+address $44
+address $232
+address $164
+address $233
+byte 4 0
+byte 4 0
+byte 4 0
+address $234
+address $235
+byte 4 60
+byte 4 6
+byte 4 5
+address $44
+address $44
+address $236
+address $131
+address $237
+byte 4 0
+byte 4 0
+byte 4 0
+address $238
+address $239
+byte 4 20
+byte 4 2
+byte 4 11
+address $44
+address $44
+address $240
+address $131
+address $241
+byte 4 0
+byte 4 0
+byte 4 0
+address $242
+address $243
+byte 4 10
+byte 4 2
+byte 4 12
+address $44
+address $44
+address $244
+address $131
+address $245
+byte 4 0
+byte 4 0
+byte 4 0
+address $246
+address $247
+byte 4 100
+byte 4 2
+byte 4 13
+address $44
+address $44
+address $248
+address $249
+address $250
+byte 4 0
+byte 4 0
+byte 4 0
+address $251
+address $252
+byte 4 30
+byte 4 7
+byte 4 11
+address $44
+address $44
+address $253
+address $254
+address $255
+byte 4 0
+byte 4 0
+byte 4 0
+address $256
+address $257
+byte 4 30
+byte 4 7
+byte 4 12
+address $44
+address $44
+address $258
+address $259
+address $260
+byte 4 0
+byte 4 0
+byte 4 0
+address $261
+address $262
+byte 4 30
+byte 4 7
+byte 4 13
+address $44
+address $44
+address $263
+address $264
+address $265
+byte 4 0
+byte 4 0
+byte 4 0
+address $266
+address $267
+byte 4 30
+byte 4 7
+byte 4 14
+address $44
+address $44
+address $268
+byte 4 0
+address $269
+address $270
+byte 4 0
+byte 4 0
+address $271
+address $272
+byte 4 0
+byte 4 8
+byte 4 3
+address $44
+address $44
+address $273
+address $131
+address $274
+byte 4 0
+byte 4 0
+byte 4 0
+address $275
+address $276
+byte 4 0
+byte 4 8
+byte 4 0
+address $44
+address $44
+address $277
+address $131
+address $278
+byte 4 0
+byte 4 0
+byte 4 0
+address $279
+address $280
+byte 4 0
+byte 4 8
+byte 4 0
+address $44
+address $44
+address $281
+address $89
+address $282
+byte 4 0
+byte 4 0
+byte 4 0
+address $283
+address $284
+byte 4 10
+byte 4 1
+byte 4 11
+address $44
+address $44
+address $285
+address $89
+address $286
+byte 4 0
+byte 4 0
+byte 4 0
+address $287
+address $288
+byte 4 5
+byte 4 1
+byte 4 12
+address $44
+address $289
+address $290
+address $89
+address $291
+byte 4 0
+byte 4 0
+byte 4 0
+address $292
+address $293
+byte 4 80
+byte 4 1
+byte 4 13
+address $44
+address $294
+address $295
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $296
+address $297
+byte 4 0
+byte 4 0
+byte 4 0
+address $44
+address $44
+address $298
+address $89
+address $299
+byte 4 0
+byte 4 0
+byte 4 0
+address $300
+address $301
+byte 4 0
+byte 4 1
+byte 4 14
+address $44
+address $44
+address $302
+address $131
+address $303
+byte 4 0
+byte 4 0
+byte 4 0
+address $304
+address $305
+byte 4 0
+byte 4 2
+byte 4 14
+address $44
+address $44
+address $306
+address $131
+address $307
+byte 4 0
+byte 4 0
+byte 4 0
+address $308
+address $309
+byte 4 0
+byte 4 2
+byte 4 0
+address $44
+address $44
+address $310
+address $311
+address $312
+byte 4 0
+byte 4 0
+byte 4 0
+address $313
+address $314
+byte 4 0
+byte 4 7
+byte 4 601
+address $44
+address $44
+address $315
+address $316
+address $317
+byte 4 0
+byte 4 0
+byte 4 0
+address $318
+address $319
+byte 4 0
+byte 4 7
+byte 4 601
+address $44
+address $44
+address $320
+byte 4 0
+address $321
+byte 4 0
+byte 4 0
+byte 4 0
+address $322
+address $323
+byte 4 0
+byte 4 7
+byte 4 601
+address $44
+address $44
+byte 4 0
+skip 48
+export bg_itemlistQldm73
+align 4
+LABELV bg_itemlistQldm73
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $44
+address $44
+address $45
+address $46
+address $47
+address $48
+byte 4 0
+byte 4 0
+address $49
+address $50
+byte 4 5
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $51
+address $52
+address $53
+byte 4 0
+byte 4 0
+byte 4 0
+address $54
+address $55
+byte 4 50
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $56
+address $52
+address $57
+byte 4 0
+byte 4 0
+byte 4 0
+address $58
+address $59
+byte 4 100
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $60
+address $52
+address $61
+byte 4 0
+byte 4 0
+byte 4 0
+address $62
+address $63
+byte 4 25
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $64
+address $65
+address $66
+address $67
+byte 4 0
+byte 4 0
+address $68
+address $69
+byte 4 5
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $70
+address $71
+address $72
+address $73
+byte 4 0
+byte 4 0
+address $74
+address $75
+byte 4 25
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $76
+address $77
+address $78
+address $79
+byte 4 0
+byte 4 0
+address $80
+address $81
+byte 4 50
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $82
+address $83
+address $84
+address $85
+byte 4 0
+byte 4 0
+address $86
+address $87
+byte 4 100
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $88
+address $89
+address $90
+byte 4 0
+byte 4 0
+byte 4 0
+address $91
+address $92
+byte 4 0
+byte 4 1
+byte 4 1
+address $44
+address $44
+address $93
+address $89
+address $94
+byte 4 0
+byte 4 0
+byte 4 0
+address $95
+address $96
+byte 4 10
+byte 4 1
+byte 4 3
+address $44
+address $44
+address $97
+address $89
+address $98
+byte 4 0
+byte 4 0
+byte 4 0
+address $99
+address $100
+byte 4 40
+byte 4 1
+byte 4 2
+address $44
+address $44
+address $101
+address $89
+address $102
+byte 4 0
+byte 4 0
+byte 4 0
+address $103
+address $104
+byte 4 10
+byte 4 1
+byte 4 4
+address $44
+address $105
+address $106
+address $89
+address $107
+byte 4 0
+byte 4 0
+byte 4 0
+address $108
+address $109
+byte 4 10
+byte 4 1
+byte 4 5
+address $44
+address $44
+address $110
+address $89
+address $111
+byte 4 0
+byte 4 0
+byte 4 0
+address $112
+address $113
+byte 4 100
+byte 4 1
+byte 4 6
+address $44
+address $44
+address $114
+address $89
+address $115
+byte 4 0
+byte 4 0
+byte 4 0
+address $116
+address $117
+byte 4 10
+byte 4 1
+byte 4 7
+address $44
+address $44
+address $118
+address $89
+address $119
+byte 4 0
+byte 4 0
+byte 4 0
+address $120
+address $121
+byte 4 50
+byte 4 1
+byte 4 8
+address $44
+address $44
+address $122
+address $89
+address $123
+byte 4 0
+byte 4 0
+byte 4 0
+address $124
+address $125
+byte 4 20
+byte 4 1
+byte 4 9
+address $44
+address $44
+address $126
+address $89
+address $127
+byte 4 0
+byte 4 0
+byte 4 0
+address $128
+address $129
+byte 4 0
+byte 4 1
+byte 4 10
+address $44
+address $44
+address $130
+address $131
+address $132
+byte 4 0
+byte 4 0
+byte 4 0
+address $133
+address $134
+byte 4 10
+byte 4 2
+byte 4 3
+address $44
+address $44
+address $135
+address $131
+address $136
+byte 4 0
+byte 4 0
+byte 4 0
+address $137
+address $138
+byte 4 50
+byte 4 2
+byte 4 2
+address $44
+address $44
+address $139
+address $131
+address $140
+byte 4 0
+byte 4 0
+byte 4 0
+address $141
+address $142
+byte 4 5
+byte 4 2
+byte 4 4
+address $44
+address $44
+address $143
+address $131
+address $144
+byte 4 0
+byte 4 0
+byte 4 0
+address $145
+address $146
+byte 4 30
+byte 4 2
+byte 4 8
+address $44
+address $44
+address $147
+address $131
+address $148
+byte 4 0
+byte 4 0
+byte 4 0
+address $149
+address $150
+byte 4 60
+byte 4 2
+byte 4 6
+address $44
+address $44
+address $151
+address $131
+address $152
+byte 4 0
+byte 4 0
+byte 4 0
+address $153
+address $154
+byte 4 5
+byte 4 2
+byte 4 5
+address $44
+address $44
+address $155
+address $131
+address $156
+byte 4 0
+byte 4 0
+byte 4 0
+address $157
+address $158
+byte 4 10
+byte 4 2
+byte 4 7
+address $44
+address $44
+address $159
+address $131
+address $160
+byte 4 0
+byte 4 0
+byte 4 0
+address $161
+address $162
+byte 4 15
+byte 4 2
+byte 4 9
+address $44
+address $44
+address $163
+address $164
+address $165
+byte 4 0
+byte 4 0
+byte 4 0
+address $166
+address $167
+byte 4 60
+byte 4 6
+byte 4 1
+address $44
+address $44
+address $168
+address $164
+address $169
+address $170
+byte 4 0
+byte 4 0
+address $171
+address $172
+byte 4 60
+byte 4 6
+byte 4 2
+address $44
+address $173
+address $174
+address $175
+address $176
+address $177
+byte 4 0
+byte 4 0
+address $178
+address $179
+byte 4 30
+byte 4 5
+byte 4 1
+address $44
+address $180
+address $181
+address $182
+address $183
+address $184
+byte 4 0
+byte 4 0
+address $185
+address $186
+byte 4 30
+byte 4 5
+byte 4 2
+address $44
+address $187
+address $188
+address $189
+address $190
+address $191
+byte 4 0
+byte 4 0
+address $192
+address $193
+byte 4 30
+byte 4 5
+byte 4 3
+address $44
+address $44
+address $194
+address $195
+address $196
+address $197
+byte 4 0
+byte 4 0
+address $198
+address $199
+byte 4 30
+byte 4 5
+byte 4 4
+address $44
+address $44
+address $200
+address $201
+address $202
+address $203
+byte 4 0
+byte 4 0
+address $204
+address $205
+byte 4 30
+byte 4 5
+byte 4 5
+address $44
+address $206
+address $207
+address $208
+address $209
+address $210
+byte 4 0
+byte 4 0
+address $211
+address $212
+byte 4 60
+byte 4 5
+byte 4 6
+address $44
+address $208
+address $213
+byte 4 0
+address $214
+address $215
+byte 4 0
+byte 4 0
+address $216
+address $217
+byte 4 0
+byte 4 8
+byte 4 7
+address $44
+address $44
+address $218
+byte 4 0
+address $219
+address $220
+byte 4 0
+byte 4 0
+address $221
+address $222
+byte 4 0
+byte 4 8
+byte 4 8
+address $44
+address $44
+address $223
+address $164
+address $224
+byte 4 0
+byte 4 0
+byte 4 0
+address $225
+address $226
+byte 4 60
+byte 4 6
+byte 4 3
+address $44
+address $227
+address $228
+address $164
+address $229
+byte 4 0
+byte 4 0
+byte 4 0
+address $230
+address $231
+byte 4 60
+byte 4 6
+byte 4 4
+address $44
+address $44
+address $232
+address $164
+address $233
+byte 4 0
+byte 4 0
+byte 4 0
+address $234
+address $235
+byte 4 60
+byte 4 6
+byte 4 5
+address $44
+address $44
+address $236
+address $131
+address $237
+byte 4 0
+byte 4 0
+byte 4 0
+address $238
+address $239
+byte 4 20
+byte 4 2
+byte 4 11
+address $44
+address $44
+address $240
+address $131
+address $241
+byte 4 0
+byte 4 0
+byte 4 0
+address $242
+address $243
+byte 4 10
+byte 4 2
+byte 4 12
+address $44
+address $44
+address $244
+address $131
+address $245
+byte 4 0
+byte 4 0
+byte 4 0
+address $246
+address $247
+byte 4 100
+byte 4 2
+byte 4 13
+address $44
+address $44
+address $248
+address $249
+address $250
+byte 4 0
+byte 4 0
+byte 4 0
+address $251
+address $252
+byte 4 30
+byte 4 7
+byte 4 11
+address $44
+address $44
+address $253
+address $254
+address $255
+byte 4 0
+byte 4 0
+byte 4 0
+address $256
+address $257
+byte 4 30
+byte 4 7
+byte 4 12
+address $44
+address $44
+address $258
+address $259
+address $260
+byte 4 0
+byte 4 0
+byte 4 0
+address $261
+address $262
+byte 4 30
+byte 4 7
+byte 4 13
+address $44
+address $44
+address $263
+address $264
+address $265
+byte 4 0
+byte 4 0
+byte 4 0
+address $266
+address $267
+byte 4 30
+byte 4 7
+byte 4 14
+address $44
+address $44
+address $268
+byte 4 0
+address $269
+address $270
+byte 4 0
+byte 4 0
+address $271
+address $272
+byte 4 0
+byte 4 8
+byte 4 9
+address $44
+address $44
+address $273
+address $131
+address $274
+byte 4 0
+byte 4 0
+byte 4 0
+address $275
+address $276
+byte 4 0
+byte 4 8
+byte 4 0
+address $44
+address $44
+address $277
+address $131
+address $278
+byte 4 0
+byte 4 0
+byte 4 0
+address $279
+address $280
+byte 4 0
+byte 4 8
+byte 4 0
+address $44
+address $44
+address $281
+address $89
+address $282
+byte 4 0
+byte 4 0
+byte 4 0
+address $283
+address $284
+byte 4 10
+byte 4 1
+byte 4 11
+address $44
+address $44
+address $285
+address $89
+address $286
+byte 4 0
+byte 4 0
+byte 4 0
+address $287
+address $288
+byte 4 5
+byte 4 1
+byte 4 12
+address $44
+address $289
+address $290
+address $89
+address $291
+byte 4 0
+byte 4 0
+byte 4 0
+address $292
+address $293
+byte 4 80
+byte 4 1
+byte 4 13
+address $44
+address $294
+byte 4 0
+skip 48
+export bg_itemlistQ3
+align 4
+LABELV bg_itemlistQ3
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $44
+address $44
+address $45
+address $46
+address $47
+address $48
+byte 4 0
+byte 4 0
+address $49
+address $50
+byte 4 5
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $51
+address $52
+address $53
+byte 4 0
+byte 4 0
+byte 4 0
+address $54
+address $55
+byte 4 50
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $56
+address $52
+address $57
+byte 4 0
+byte 4 0
+byte 4 0
+address $58
+address $59
+byte 4 100
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $64
+address $65
+address $66
+address $67
+byte 4 0
+byte 4 0
+address $68
+address $69
+byte 4 5
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $70
+address $71
+address $72
+address $73
+byte 4 0
+byte 4 0
+address $74
+address $75
+byte 4 25
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $76
+address $77
+address $78
+address $79
+byte 4 0
+byte 4 0
+address $80
+address $81
+byte 4 50
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $82
+address $83
+address $84
+address $85
+byte 4 0
+byte 4 0
+address $86
+address $87
+byte 4 100
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $88
+address $89
+address $90
+byte 4 0
+byte 4 0
+byte 4 0
+address $91
+address $92
+byte 4 0
+byte 4 1
+byte 4 1
+address $44
+address $44
+address $93
+address $89
+address $94
+byte 4 0
+byte 4 0
+byte 4 0
+address $95
+address $96
+byte 4 10
+byte 4 1
+byte 4 3
+address $44
+address $44
+address $97
+address $89
+address $98
+byte 4 0
+byte 4 0
+byte 4 0
+address $99
+address $100
+byte 4 40
+byte 4 1
+byte 4 2
+address $44
+address $44
+address $101
+address $89
+address $102
+byte 4 0
+byte 4 0
+byte 4 0
+address $103
+address $104
+byte 4 10
+byte 4 1
+byte 4 4
+address $44
+address $105
+address $106
+address $89
+address $107
+byte 4 0
+byte 4 0
+byte 4 0
+address $108
+address $109
+byte 4 10
+byte 4 1
+byte 4 5
+address $44
+address $44
+address $110
+address $89
+address $111
+byte 4 0
+byte 4 0
+byte 4 0
+address $112
+address $113
+byte 4 100
+byte 4 1
+byte 4 6
+address $44
+address $44
+address $114
+address $89
+address $115
+byte 4 0
+byte 4 0
+byte 4 0
+address $116
+address $117
+byte 4 10
+byte 4 1
+byte 4 7
+address $44
+address $44
+address $118
+address $89
+address $119
+byte 4 0
+byte 4 0
+byte 4 0
+address $120
+address $121
+byte 4 50
+byte 4 1
+byte 4 8
+address $44
+address $44
+address $122
+address $89
+address $123
+byte 4 0
+byte 4 0
+byte 4 0
+address $124
+address $125
+byte 4 20
+byte 4 1
+byte 4 9
+address $44
+address $44
+address $126
+address $89
+address $127
+byte 4 0
+byte 4 0
+byte 4 0
+address $128
+address $129
+byte 4 0
+byte 4 1
+byte 4 10
+address $44
+address $44
+address $130
+address $131
+address $132
+byte 4 0
+byte 4 0
+byte 4 0
+address $133
+address $134
+byte 4 10
+byte 4 2
+byte 4 3
+address $44
+address $44
+address $135
+address $131
+address $136
+byte 4 0
+byte 4 0
+byte 4 0
+address $137
+address $138
+byte 4 50
+byte 4 2
+byte 4 2
+address $44
+address $44
+address $139
+address $131
+address $140
+byte 4 0
+byte 4 0
+byte 4 0
+address $141
+address $142
+byte 4 5
+byte 4 2
+byte 4 4
+address $44
+address $44
+address $143
+address $131
+address $144
+byte 4 0
+byte 4 0
+byte 4 0
+address $145
+address $146
+byte 4 30
+byte 4 2
+byte 4 8
+address $44
+address $44
+address $147
+address $131
+address $148
+byte 4 0
+byte 4 0
+byte 4 0
+address $149
+address $150
+byte 4 60
+byte 4 2
+byte 4 6
+address $44
+address $44
+address $151
+address $131
+address $152
+byte 4 0
+byte 4 0
+byte 4 0
+address $153
+address $154
+byte 4 5
+byte 4 2
+byte 4 5
+address $44
+address $44
+address $155
+address $131
+address $156
+byte 4 0
+byte 4 0
+byte 4 0
+address $157
+address $158
+byte 4 10
+byte 4 2
+byte 4 7
+address $44
+address $44
+address $159
+address $131
+address $160
+byte 4 0
+byte 4 0
+byte 4 0
+address $161
+address $162
+byte 4 15
+byte 4 2
+byte 4 9
+address $44
+address $44
+address $163
+address $164
+address $165
+byte 4 0
+byte 4 0
+byte 4 0
+address $166
+address $167
+byte 4 60
+byte 4 6
+byte 4 1
+address $44
+address $44
+address $168
+address $164
+address $169
+address $170
+byte 4 0
+byte 4 0
+address $171
+address $172
+byte 4 60
+byte 4 6
+byte 4 2
+address $44
+address $173
+address $174
+address $175
+address $176
+address $177
+byte 4 0
+byte 4 0
+address $178
+address $179
+byte 4 30
+byte 4 5
+byte 4 1
+address $44
+address $180
+address $181
+address $182
+address $183
+address $184
+byte 4 0
+byte 4 0
+address $185
+address $186
+byte 4 30
+byte 4 5
+byte 4 2
+address $44
+address $187
+address $188
+address $189
+address $190
+address $191
+byte 4 0
+byte 4 0
+address $192
+address $193
+byte 4 30
+byte 4 5
+byte 4 3
+address $44
+address $44
+address $194
+address $195
+address $196
+address $197
+byte 4 0
+byte 4 0
+address $198
+address $199
+byte 4 30
+byte 4 5
+byte 4 4
+address $44
+address $44
+address $200
+address $201
+address $202
+address $203
+byte 4 0
+byte 4 0
+address $204
+address $205
+byte 4 30
+byte 4 5
+byte 4 5
+address $44
+address $206
+address $207
+address $208
+address $209
+address $210
+byte 4 0
+byte 4 0
+address $211
+address $212
+byte 4 60
+byte 4 5
+byte 4 6
+address $44
+address $208
+address $213
+byte 4 0
+address $214
+byte 4 0
+byte 4 0
+byte 4 0
+address $216
+address $217
+byte 4 0
+byte 4 8
+byte 4 7
+address $44
+address $44
+address $218
+byte 4 0
+address $219
+byte 4 0
+byte 4 0
+byte 4 0
+address $221
+address $222
+byte 4 0
+byte 4 8
+byte 4 8
+address $44
+address $44
+byte 4 0
+skip 48
+export bg_itemlistCpma
+align 4
+LABELV bg_itemlistCpma
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $44
+address $44
+address $45
+address $46
+address $47
+address $48
+byte 4 0
+byte 4 0
+address $49
+address $50
+byte 4 5
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $51
+address $52
+address $53
+byte 4 0
+byte 4 0
+byte 4 0
+address $54
+address $55
+byte 4 50
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $56
+address $52
+address $57
+byte 4 0
+byte 4 0
+byte 4 0
+address $58
+address $59
+byte 4 100
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $64
+address $65
+address $66
+address $67
+byte 4 0
+byte 4 0
+address $68
+address $69
+byte 4 5
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $70
+address $71
+address $72
+address $73
+byte 4 0
+byte 4 0
+address $74
+address $75
+byte 4 25
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $76
+address $77
+address $78
+address $79
+byte 4 0
+byte 4 0
+address $80
+address $81
+byte 4 50
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $82
+address $83
+address $84
+address $85
+byte 4 0
+byte 4 0
+address $86
+address $87
+byte 4 100
+byte 4 4
+byte 4 0
+address $44
+address $44
+address $88
+address $89
+address $90
+byte 4 0
+byte 4 0
+byte 4 0
+address $91
+address $92
+byte 4 0
+byte 4 1
+byte 4 1
+address $44
+address $44
+address $93
+address $89
+address $94
+byte 4 0
+byte 4 0
+byte 4 0
+address $95
+address $96
+byte 4 10
+byte 4 1
+byte 4 3
+address $44
+address $44
+address $97
+address $89
+address $98
+byte 4 0
+byte 4 0
+byte 4 0
+address $99
+address $100
+byte 4 40
+byte 4 1
+byte 4 2
+address $44
+address $44
+address $101
+address $89
+address $102
+byte 4 0
+byte 4 0
+byte 4 0
+address $103
+address $104
+byte 4 10
+byte 4 1
+byte 4 4
+address $44
+address $105
+address $106
+address $89
+address $107
+byte 4 0
+byte 4 0
+byte 4 0
+address $108
+address $109
+byte 4 10
+byte 4 1
+byte 4 5
+address $44
+address $44
+address $110
+address $89
+address $111
+byte 4 0
+byte 4 0
+byte 4 0
+address $112
+address $113
+byte 4 100
+byte 4 1
+byte 4 6
+address $44
+address $44
+address $114
+address $89
+address $115
+byte 4 0
+byte 4 0
+byte 4 0
+address $116
+address $117
+byte 4 10
+byte 4 1
+byte 4 7
+address $44
+address $44
+address $118
+address $89
+address $119
+byte 4 0
+byte 4 0
+byte 4 0
+address $120
+address $121
+byte 4 50
+byte 4 1
+byte 4 8
+address $44
+address $44
+address $122
+address $89
+address $123
+byte 4 0
+byte 4 0
+byte 4 0
+address $124
+address $125
+byte 4 20
+byte 4 1
+byte 4 9
+address $44
+address $44
+address $126
+address $89
+address $127
+byte 4 0
+byte 4 0
+byte 4 0
+address $128
+address $129
+byte 4 0
+byte 4 1
+byte 4 10
+address $44
+address $44
+address $130
+address $131
+address $132
+byte 4 0
+byte 4 0
+byte 4 0
+address $133
+address $134
+byte 4 10
+byte 4 2
+byte 4 3
+address $44
+address $44
+address $135
+address $131
+address $136
+byte 4 0
+byte 4 0
+byte 4 0
+address $137
+address $138
+byte 4 50
+byte 4 2
+byte 4 2
+address $44
+address $44
+address $139
+address $131
+address $140
+byte 4 0
+byte 4 0
+byte 4 0
+address $141
+address $142
+byte 4 5
+byte 4 2
+byte 4 4
+address $44
+address $44
+address $143
+address $131
+address $144
+byte 4 0
+byte 4 0
+byte 4 0
+address $145
+address $146
+byte 4 30
+byte 4 2
+byte 4 8
+address $44
+address $44
+address $147
+address $131
+address $148
+byte 4 0
+byte 4 0
+byte 4 0
+address $149
+address $150
+byte 4 60
+byte 4 2
+byte 4 6
+address $44
+address $44
+address $151
+address $131
+address $152
+byte 4 0
+byte 4 0
+byte 4 0
+address $153
+address $154
+byte 4 5
+byte 4 2
+byte 4 5
+address $44
+address $44
+address $155
+address $131
+address $156
+byte 4 0
+byte 4 0
+byte 4 0
+address $157
+address $158
+byte 4 10
+byte 4 2
+byte 4 7
+address $44
+address $44
+address $159
+address $131
+address $160
+byte 4 0
+byte 4 0
+byte 4 0
+address $161
+address $324
+byte 4 15
+byte 4 2
+byte 4 9
+address $44
+address $44
+address $163
+address $164
+address $165
+byte 4 0
+byte 4 0
+byte 4 0
+address $166
+address $167
+byte 4 60
+byte 4 6
+byte 4 4
+address $44
+address $44
+address $168
+address $164
+address $169
+address $170
+byte 4 0
+byte 4 0
+address $171
+address $172
+byte 4 60
+byte 4 6
+byte 4 5
+address $44
+address $173
+address $174
+address $175
+address $176
+address $177
+byte 4 0
+byte 4 0
+address $178
+address $179
+byte 4 30
+byte 4 5
+byte 4 1
+address $44
+address $180
+address $181
+address $182
+address $183
+address $184
+byte 4 0
+byte 4 0
+address $185
+address $186
+byte 4 30
+byte 4 5
+byte 4 2
+address $44
+address $187
+address $188
+address $189
+address $190
+address $191
+byte 4 0
+byte 4 0
+address $192
+address $193
+byte 4 30
+byte 4 5
+byte 4 3
+address $44
+address $44
+address $194
+address $195
+address $196
+address $197
+byte 4 0
+byte 4 0
+address $198
+address $199
+byte 4 30
+byte 4 5
+byte 4 4
+address $44
+address $44
+address $200
+address $201
+address $202
+address $203
+byte 4 0
+byte 4 0
+address $204
+address $205
+byte 4 30
+byte 4 5
+byte 4 5
+address $44
+address $206
+address $207
+address $208
+address $209
+address $210
+byte 4 0
+byte 4 0
+address $211
+address $212
+byte 4 60
+byte 4 5
+byte 4 6
+address $44
+address $208
+address $213
+byte 4 0
+address $214
+byte 4 0
+byte 4 0
+byte 4 0
+address $216
+address $217
+byte 4 0
+byte 4 8
+byte 4 7
+address $44
+address $44
+address $218
+byte 4 0
+address $219
+byte 4 0
+byte 4 0
+byte 4 0
+address $221
+address $222
+byte 4 0
+byte 4 8
+byte 4 8
+address $44
+address $44
+address $60
+address $52
+address $61
+byte 4 0
+byte 4 0
+byte 4 0
+address $62
+address $63
+byte 4 25
+byte 4 3
+byte 4 0
+address $44
+address $44
+address $325
+byte 4 0
+address $326
+byte 4 0
+byte 4 0
+byte 4 0
+address $327
+address $328
+byte 4 0
+byte 4 8
+byte 4 9
+address $44
+address $44
+address $268
+byte 4 0
+address $269
+byte 4 0
+byte 4 0
+byte 4 0
+address $271
+address $272
+byte 4 0
+byte 4 8
+byte 4 9
+address $44
+address $44
+byte 4 0
+skip 48
+export bg_numItems
+align 4
+LABELV bg_numItems
+byte 4 60
+export bg_numItemsQ3
+align 4
+LABELV bg_numItemsQ3
+byte 4 36
+export bg_numItemsCpma
+align 4
+LABELV bg_numItemsCpma
+byte 4 39
+export bg_numItemsQldm73
+align 4
+LABELV bg_numItemsQldm73
+byte 4 53
+export bg_numItemsQldm91
+align 4
+LABELV bg_numItemsQldm91
+byte 4 60
+export BG_FindItemForPowerup
+code
+proc BG_FindItemForPowerup 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $333
+JUMPV
+LABELV $330
+ADDRLP4 4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $341
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $341
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $334
+LABELV $341
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $334
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+RETP4
+ADDRGP4 $329
+JUMPV
+LABELV $334
+LABELV $331
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $333
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $330
+CNSTP4 0
+RETP4
+LABELV $329
+endproc BG_FindItemForPowerup 8 0
+export BG_FindItemForHoldable
+proc BG_FindItemForHoldable 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $346
+JUMPV
+LABELV $343
+ADDRLP4 4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $347
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $347
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+RETP4
+ADDRGP4 $342
+JUMPV
+LABELV $347
+LABELV $344
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $346
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $343
+ADDRGP4 bg_itemlist
+RETP4
+LABELV $342
+endproc BG_FindItemForHoldable 8 0
+export BG_FindItemForWeapon
+proc BG_FindItemForWeapon 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $355
+JUMPV
+LABELV $352
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $357
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $357
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $351
+JUMPV
+LABELV $357
+LABELV $353
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $355
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $352
+ADDRGP4 $359
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 bg_itemlist
+RETP4
+LABELV $351
+endproc BG_FindItemForWeapon 8 8
+export BG_FindItem
+proc BG_FindItem 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $364
+JUMPV
+LABELV $361
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $366
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $360
+JUMPV
+LABELV $366
+LABELV $362
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $364
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $361
+ADDRGP4 $368
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $360
+endproc BG_FindItem 8 8
+export BG_PlayerTouchesItem
+proc BG_PlayerTouchesItem 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1110441984
+GTF4 $380
+ADDRLP4 16
+INDIRF4
+CNSTF4 3259498496
+LTF4 $380
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1108344832
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ADDRLP4 24
+INDIRF4
+GTF4 $380
+ADDRLP4 28
+CNSTF4 3255828480
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ADDRLP4 28
+INDIRF4
+LTF4 $380
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ADDRLP4 24
+INDIRF4
+GTF4 $380
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ADDRLP4 28
+INDIRF4
+GEF4 $370
+LABELV $380
+CNSTI4 0
+RETI4
+ADDRGP4 $369
+JUMPV
+LABELV $370
+CNSTI4 1
+RETI4
+LABELV $369
+endproc BG_PlayerTouchesItem 36 12
+export BG_CanItemBeGrabbed
+proc BG_CanItemBeGrabbed 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $384
+ADDRLP4 8
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $382
+LABELV $384
+CNSTI4 1
+ARGI4
+ADDRGP4 $385
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $382
+ADDRLP4 0
+CNSTI4 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $386
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+GTI4 $386
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $458
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $458
+address $455
+address $389
+address $390
+address $393
+address $402
+address $413
+address $452
+address $414
+address $421
+code
+LABELV $389
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $390
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 200
+LTI4 $391
+CNSTI4 0
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $391
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $393
+CNSTI4 52
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRGP4 PW_SCOUT
+INDIRI4
+NEI4 $394
+CNSTI4 0
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $394
+CNSTI4 52
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRGP4 PW_GUARD
+INDIRI4
+NEI4 $397
+ADDRLP4 4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRLP4 4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $398
+ADDRGP4 STAT_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $400
+CNSTI4 0
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $400
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $402
+CNSTI4 52
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRGP4 PW_GUARD
+INDIRI4
+NEI4 $403
+ADDRGP4 $404
+JUMPV
+LABELV $403
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $408
+ADDRLP4 20
+INDIRI4
+CNSTI4 100
+NEI4 $406
+LABELV $408
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ASGNP4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+LTI4 $409
+CNSTI4 0
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $409
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $406
+LABELV $404
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ASGNP4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+ADDRGP4 STAT_MAX_HEALTH
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+LTI4 $411
+CNSTI4 0
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $411
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $413
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $414
+ADDRGP4 STAT_PERSISTANT_POWERUP
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $415
+CNSTI4 0
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $415
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $417
+ADDRGP4 PERS_TEAM
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $417
+CNSTI4 0
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $417
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $419
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $419
+CNSTI4 0
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $419
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $421
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $422
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+NEI4 $424
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $424
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $426
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+NEI4 $427
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $427
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $426
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $430
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+NEI4 $432
+ADDRGP4 PW_NEUTRALFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $432
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $432
+LABELV $430
+LABELV $427
+LABELV $422
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $434
+ADDRGP4 PERS_TEAM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $436
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+EQI4 $441
+ADDRLP4 40
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+NEI4 $442
+ADDRFP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $441
+LABELV $442
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+NEI4 $437
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $437
+LABELV $441
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $436
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRGP4 PERS_TEAM
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $443
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 PW_REDFLAG
+INDIRI4
+EQI4 $448
+ADDRLP4 44
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+NEI4 $449
+ADDRFP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $448
+LABELV $449
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRGP4 PW_BLUEFLAG
+INDIRI4
+NEI4 $445
+ADDRGP4 PW_REDFLAG
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $445
+LABELV $448
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $445
+LABELV $443
+LABELV $437
+LABELV $434
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $450
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $450
+CNSTI4 0
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $452
+ADDRGP4 STAT_HOLDABLE_ITEM
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $453
+CNSTI4 0
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $453
+CNSTI4 1
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $455
+CNSTI4 1
+ARGI4
+ADDRGP4 $456
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $386
+ADDRGP4 $457
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $387
+CNSTI4 0
+RETI4
+LABELV $381
+endproc BG_CanItemBeGrabbed 48 8
+export BG_EvaluateTrajectory
+proc BG_EvaluateTrajectory 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $460
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+GTI4 $460
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $475
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $475
+address $463
+address $463
+address $464
+address $466
+address $465
+address $471
+code
+LABELV $463
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $461
+JUMPV
+LABELV $464
+ADDRLP4 0
+CNSTF4 981668463
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $461
+JUMPV
+LABELV $465
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+CNSTF4 1073741824
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $461
+JUMPV
+LABELV $466
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+LEI4 $467
+ADDRFP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $467
+ADDRLP4 0
+CNSTF4 981668463
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $469
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $469
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $461
+JUMPV
+LABELV $471
+ADDRLP4 0
+CNSTF4 981668463
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $472
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDRLP4 80
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $461
+JUMPV
+LABELV $472
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTF4 1137180672
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDRLP4 80
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $461
+JUMPV
+LABELV $460
+CNSTI4 1
+ARGI4
+ADDRGP4 $474
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $461
+LABELV $459
+endproc BG_EvaluateTrajectory 84 12
+export BG_EvaluateTrajectoryf
+proc BG_EvaluateTrajectoryf 88 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $477
+ADDRLP4 12
+INDIRI4
+CNSTI4 5
+GTI4 $477
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $492
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $492
+address $480
+address $480
+address $481
+address $483
+address $482
+address $488
+code
+LABELV $480
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $478
+JUMPV
+LABELV $481
+ADDRLP4 0
+CNSTF4 981668463
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $478
+JUMPV
+LABELV $482
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+CNSTF4 1073741824
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $478
+JUMPV
+LABELV $483
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+LEF4 $484
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $484
+ADDRLP4 0
+CNSTF4 981668463
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $486
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $486
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $478
+JUMPV
+LABELV $488
+ADDRLP4 0
+CNSTF4 981668463
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDRLP4 84
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $478
+JUMPV
+LABELV $489
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+CNSTF4 1137180672
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDRLP4 84
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $478
+JUMPV
+LABELV $477
+CNSTI4 1
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $478
+LABELV $476
+endproc BG_EvaluateTrajectoryf 88 12
+export BG_EvaluateTrajectoryDelta
+proc BG_EvaluateTrajectoryDelta 44 12
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $494
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+GTI4 $494
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $505
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $505
+address $497
+address $497
+address $498
+address $500
+address $499
+address $503
+code
+LABELV $497
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 $495
+JUMPV
+LABELV $498
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $495
+JUMPV
+LABELV $499
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+CNSTF4 1073741824
+CNSTF4 1078530011
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $495
+JUMPV
+LABELV $500
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+LEI4 $501
+ADDRLP4 36
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 $493
+JUMPV
+LABELV $501
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $495
+JUMPV
+LABELV $503
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 981668463
+ADDRFP4 4
+INDIRI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $495
+JUMPV
+LABELV $494
+CNSTI4 1
+ARGI4
+ADDRGP4 $504
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $495
+LABELV $493
+endproc BG_EvaluateTrajectoryDelta 44 12
+export BG_EvaluateTrajectoryDeltaf
+proc BG_EvaluateTrajectoryDeltaf 48 12
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $507
+ADDRLP4 12
+INDIRI4
+CNSTI4 5
+GTI4 $507
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $518
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $518
+address $510
+address $510
+address $511
+address $513
+address $512
+address $516
+code
+LABELV $510
+ADDRLP4 20
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $508
+JUMPV
+LABELV $511
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $508
+JUMPV
+LABELV $512
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+CNSTF4 1073741824
+CNSTF4 1078530011
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1056964608
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $508
+JUMPV
+LABELV $513
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+LEF4 $514
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $506
+JUMPV
+LABELV $514
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $508
+JUMPV
+LABELV $516
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 981668463
+ADDRLP4 0
+INDIRF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+CNSTI4 1
+ARGI4
+ADDRGP4 $517
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $508
+LABELV $506
+endproc BG_EvaluateTrajectoryDeltaf 48 12
+data
+export eventnames
+align 4
+LABELV eventnames
+address $519
+address $520
+address $521
+address $522
+address $523
+address $524
+address $525
+address $526
+address $527
+address $528
+address $529
+address $530
+address $531
+address $532
+address $533
+address $534
+address $535
+address $536
+address $537
+address $538
+address $539
+address $540
+address $541
+address $542
+address $543
+address $544
+address $545
+address $546
+address $547
+address $548
+address $549
+address $550
+address $551
+address $552
+address $553
+address $554
+address $555
+address $556
+address $557
+address $558
+address $559
+address $560
+address $561
+address $562
+address $563
+address $564
+address $565
+address $566
+address $567
+address $568
+address $569
+address $570
+address $571
+address $572
+address $573
+address $574
+address $575
+address $576
+address $577
+address $578
+address $579
+address $580
+address $581
+address $582
+address $583
+address $584
+address $585
+address $586
+address $587
+address $588
+address $589
+address $590
+address $591
+address $592
+address $593
+address $594
+address $595
+address $596
+address $597
+address $598
+address $599
+address $600
+export BG_AddPredictableEventToPlayerstate
+code
+proc BG_AddPredictableEventToPlayerstate 12 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $601
+endproc BG_AddPredictableEventToPlayerstate 12 0
+export BG_TouchJumpPad
+proc BG_TouchJumpPad 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $603
+ADDRGP4 $602
+JUMPV
+LABELV $603
+ADDRGP4 PW_FLIGHT
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRGP4 $602
+JUMPV
+LABELV $605
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+EQI4 $607
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1110704128
+GEF4 $609
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $609
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $610
+CNSTI4 9
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+LABELV $607
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $602
+endproc BG_TouchJumpPad 28 12
+export BG_PlayerStateToEntityState
+proc BG_PlayerStateToEntityState 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+EQI4 $614
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $612
+LABELV $614
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $613
+JUMPV
+LABELV $612
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $615
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $616
+JUMPV
+LABELV $615
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $616
+LABELV $613
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $617
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $617
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $619
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $619
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $621
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $622
+JUMPV
+LABELV $621
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $622
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $623
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $624
+JUMPV
+LABELV $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+GEI4 $625
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $627
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $627
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 8
+LSHI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $625
+LABELV $624
+ADDRFP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $629
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $633
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $633
+LABELV $630
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $629
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRGP4 STAT_ARMOR
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $611
+endproc BG_PlayerStateToEntityState 32 0
+export BG_PlayerStateToEntityStateExtraPolate
+proc BG_PlayerStateToEntityStateExtraPolate 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+EQI4 $638
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $636
+LABELV $638
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $637
+JUMPV
+LABELV $636
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $639
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $640
+JUMPV
+LABELV $639
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $640
+LABELV $637
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $641
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $641
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $643
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $643
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 STAT_HEALTH
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $645
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $646
+JUMPV
+LABELV $645
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $646
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $647
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $648
+JUMPV
+LABELV $647
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+GEI4 $649
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $651
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $651
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 8
+LSHI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $649
+LABELV $648
+ADDRFP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $653
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $657
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $657
+LABELV $654
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $653
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $635
+endproc BG_PlayerStateToEntityStateExtraPolate 32 0
+export BG_ModToWeapon
+proc BG_ModToWeapon 8 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $660
+ADDRLP4 4
+INDIRI4
+CNSTI4 33
+GTI4 $660
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $674-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $674
+address $669
+address $667
+address $668
+address $662
+address $662
+address $663
+address $663
+address $664
+address $664
+address $670
+address $671
+address $665
+address $665
+address $660
+address $660
+address $660
+address $660
+address $660
+address $660
+address $660
+address $660
+address $660
+address $672
+address $673
+address $666
+address $660
+address $660
+address $660
+address $660
+address $660
+address $671
+address $660
+address $670
+code
+LABELV $662
+CNSTI4 4
+RETI4
+ADDRGP4 $659
+JUMPV
+LABELV $663
+CNSTI4 5
+RETI4
+ADDRGP4 $659
+JUMPV
+LABELV $664
+CNSTI4 8
+RETI4
+ADDRGP4 $659
+JUMPV
+LABELV $665
+CNSTI4 9
+RETI4
+ADDRGP4 $659
+JUMPV
+LABELV $666
+CNSTI4 12
+RETI4
+ADDRGP4 $659
+JUMPV
+LABELV $667
+CNSTI4 1
+RETI4
+ADDRGP4 $659
+JUMPV
+LABELV $668
+CNSTI4 2
+RETI4
+ADDRGP4 $659
+JUMPV
+LABELV $669
+CNSTI4 3
+RETI4
+ADDRGP4 $659
+JUMPV
+LABELV $670
+CNSTI4 7
+RETI4
+ADDRGP4 $659
+JUMPV
+LABELV $671
+CNSTI4 6
+RETI4
+ADDRGP4 $659
+JUMPV
+LABELV $672
+CNSTI4 11
+RETI4
+ADDRGP4 $659
+JUMPV
+LABELV $673
+CNSTI4 13
+RETI4
+ADDRGP4 $659
+JUMPV
+LABELV $660
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $659
+endproc BG_ModToWeapon 8 0
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $600
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 84
+byte 1 82
+byte 1 79
+byte 1 76
+byte 1 0
+align 1
+LABELV $599
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 66
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 0
+align 1
+LABELV $598
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 84
+byte 1 70
+byte 1 76
+byte 1 65
+byte 1 71
+byte 1 0
+align 1
+LABELV $597
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $596
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 0
+align 1
+LABELV $595
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 89
+byte 1 69
+byte 1 83
+byte 1 0
+align 1
+LABELV $594
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 0
+align 1
+LABELV $593
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 80
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $592
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 0
+align 1
+LABELV $591
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 66
+byte 1 79
+byte 1 76
+byte 1 84
+byte 1 0
+align 1
+LABELV $590
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $589
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 86
+byte 1 85
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 0
+align 1
+LABELV $588
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $587
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 75
+byte 1 65
+byte 1 77
+byte 1 73
+byte 1 75
+byte 1 65
+byte 1 90
+byte 1 69
+byte 1 0
+align 1
+LABELV $586
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $585
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 0
+align 1
+LABELV $584
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 0
+align 1
+LABELV $583
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $582
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 0
+align 1
+LABELV $581
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 85
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $580
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 81
+byte 1 85
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $579
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 0
+align 1
+LABELV $578
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 51
+byte 1 0
+align 1
+LABELV $577
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 50
+byte 1 0
+align 1
+LABELV $576
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 49
+byte 1 0
+align 1
+LABELV $575
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $574
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 0
+align 1
+LABELV $573
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $572
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 0
+align 1
+LABELV $571
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $570
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 0
+align 1
+LABELV $569
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $568
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 0
+align 1
+LABELV $567
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $566
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $565
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $564
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $563
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 0
+align 1
+LABELV $562
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 0
+align 1
+LABELV $561
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $560
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 80
+byte 1 0
+align 1
+LABELV $559
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 0
+align 1
+LABELV $558
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $557
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $556
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $555
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $554
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $553
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $552
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 57
+byte 1 0
+align 1
+LABELV $551
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 56
+byte 1 0
+align 1
+LABELV $550
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 55
+byte 1 0
+align 1
+LABELV $549
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 54
+byte 1 0
+align 1
+LABELV $548
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 53
+byte 1 0
+align 1
+LABELV $547
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 52
+byte 1 0
+align 1
+LABELV $546
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 51
+byte 1 0
+align 1
+LABELV $545
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 50
+byte 1 0
+align 1
+LABELV $544
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 0
+align 1
+LABELV $543
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 48
+byte 1 0
+align 1
+LABELV $542
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $541
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 78
+byte 1 71
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $540
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $539
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $538
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $537
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $536
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $535
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 0
+align 1
+LABELV $534
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 67
+byte 1 72
+byte 1 0
+align 1
+LABELV $533
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 0
+align 1
+LABELV $532
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $531
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $530
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 68
+byte 1 73
+byte 1 85
+byte 1 77
+byte 1 0
+align 1
+LABELV $529
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 0
+align 1
+LABELV $528
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 49
+byte 1 54
+byte 1 0
+align 1
+LABELV $527
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $526
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 56
+byte 1 0
+align 1
+LABELV $525
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 52
+byte 1 0
+align 1
+LABELV $524
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 77
+byte 1 0
+align 1
+LABELV $523
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 87
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $522
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $521
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $520
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 0
+align 1
+LABELV $519
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 78
+byte 1 69
+byte 1 0
+align 1
+LABELV $517
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 69
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $504
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 69
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $491
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 69
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $474
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 69
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $457
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 66
+byte 1 101
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 98
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $456
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 66
+byte 1 101
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 98
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $385
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 66
+byte 1 101
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 98
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $368
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $359
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $328
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $327
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $326
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $325
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $324
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 32
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $323
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $322
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $321
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $320
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $319
+byte 1 71
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $318
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $317
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $316
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $315
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $314
+byte 1 83
+byte 1 105
+byte 1 108
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $313
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 108
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $312
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 108
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $311
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 108
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $310
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 108
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $309
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 80
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $308
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $307
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $306
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $305
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 121
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $304
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 0
+align 1
+LABELV $303
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $302
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 0
+align 1
+LABELV $301
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 121
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $300
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 0
+align 1
+LABELV $299
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 51
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 47
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $298
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 104
+byte 1 109
+byte 1 103
+byte 1 0
+align 1
+LABELV $297
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $296
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $295
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $294
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $293
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $292
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $291
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $290
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $289
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 118
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 118
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $288
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $287
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $286
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $285
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $284
+byte 1 78
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $283
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $282
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $281
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $280
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $279
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 104
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 0
+align 1
+LABELV $278
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $277
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 98
+byte 1 101
+byte 1 0
+align 1
+LABELV $276
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $275
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 104
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 0
+align 1
+LABELV $274
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $273
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 99
+byte 1 117
+byte 1 98
+byte 1 101
+byte 1 0
+align 1
+LABELV $272
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $271
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $270
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $269
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $268
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $267
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $266
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $265
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $264
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $263
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $262
+byte 1 68
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $261
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $260
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $259
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $258
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $257
+byte 1 71
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $256
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $255
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $254
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $253
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $252
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $251
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $250
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $249
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $248
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $247
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 66
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $246
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $245
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $244
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $243
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $242
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $241
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $240
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $239
+byte 1 78
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $238
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $237
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $236
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $235
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $234
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $233
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $232
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $231
+byte 1 80
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $230
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $229
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $228
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $227
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $226
+byte 1 75
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $225
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $224
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 105
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $223
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $222
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $221
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $220
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $219
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $218
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $217
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $216
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $215
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $214
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $213
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $212
+byte 1 70
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $211
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $210
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $209
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $208
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $207
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $206
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $205
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $204
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $203
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $202
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $201
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $200
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $199
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $198
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $197
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $196
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $195
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $194
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $193
+byte 1 72
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $192
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $191
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $190
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $189
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $188
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $187
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $186
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $185
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $184
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 114
+byte 1 111
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $183
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 114
+byte 1 111
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $182
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $181
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 114
+byte 1 111
+byte 1 0
+align 1
+LABELV $180
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $179
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $178
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $177
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $176
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $175
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $174
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $173
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $172
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $171
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $170
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $169
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $168
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $167
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $166
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $165
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $164
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $163
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $162
+byte 1 66
+byte 1 102
+byte 1 103
+byte 1 32
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $161
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $160
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $159
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $158
+byte 1 83
+byte 1 108
+byte 1 117
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $157
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $156
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $155
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 108
+byte 1 117
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $154
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $153
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $152
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $151
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $150
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $149
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $148
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $147
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $146
+byte 1 67
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $145
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $144
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $143
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $142
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $141
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $140
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $139
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $138
+byte 1 66
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $137
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $136
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $135
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $134
+byte 1 83
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $133
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $132
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $131
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $130
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $129
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 72
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $128
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $127
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $126
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $125
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 49
+byte 1 48
+byte 1 75
+byte 1 0
+align 1
+LABELV $124
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $123
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $122
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $121
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $120
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $119
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $118
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $117
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $116
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $115
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $114
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $113
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $112
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $111
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $110
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $109
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $108
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $107
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $106
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $105
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 50
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $104
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $103
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $102
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $101
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $100
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $99
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $98
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $97
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $96
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $95
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $94
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $93
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $92
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $91
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $90
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $89
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 119
+byte 1 95
+byte 1 112
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $88
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $87
+byte 1 77
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 32
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $86
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 104
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $85
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $84
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $83
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $82
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $81
+byte 1 53
+byte 1 48
+byte 1 32
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $80
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 104
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $79
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $78
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $77
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $76
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $75
+byte 1 50
+byte 1 53
+byte 1 32
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $74
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 104
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $73
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $72
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $71
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $70
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $69
+byte 1 53
+byte 1 32
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $68
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 104
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $67
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $66
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $65
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $64
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $63
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $62
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $61
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $60
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 106
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $59
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $58
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $57
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $56
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $55
+byte 1 89
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $54
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $53
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $52
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 50
+byte 1 95
+byte 1 112
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $51
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $50
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $49
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $48
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $46
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $45
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $44
+byte 1 0
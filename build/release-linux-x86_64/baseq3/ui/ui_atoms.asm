@@ -0,0 +1,5733 @@
+export Com_Error
+code
+proc Com_Error 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $71
+endproc Com_Error 1028 16
+export Com_Printf
+proc Com_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $73
+endproc Com_Printf 1028 16
+export UI_ClampCvar
+proc UI_ClampCvar 0 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+GEF4 $76
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $75
+JUMPV
+LABELV $76
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+LEF4 $78
+ADDRFP4 4
+INDIRF4
+RETF4
+ADDRGP4 $75
+JUMPV
+LABELV $78
+ADDRFP4 8
+INDIRF4
+RETF4
+LABELV $75
+endproc UI_ClampCvar 0 0
+export UI_StartDemoLoop
+proc UI_StartDemoLoop 0 8
+CNSTI4 2
+ARGI4
+ADDRGP4 $81
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $80
+endproc UI_StartDemoLoop 0 8
+export UI_PushMenu
+proc UI_PushMenu 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $86
+JUMPV
+LABELV $83
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+24
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $88
+ADDRGP4 uis+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $85
+JUMPV
+LABELV $88
+LABELV $84
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $86
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uis+16
+INDIRI4
+LTI4 $83
+LABELV $85
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uis+16
+INDIRI4
+NEI4 $92
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 8
+LTI4 $95
+ADDRGP4 $98
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $95
+ADDRLP4 12
+ADDRGP4 uis+16
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+24
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $92
+ADDRGP4 uis+20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 m_entersound
+CNSTI4 1
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $102
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 26624
+BANDU4
+CNSTU4 0
+NEU4 $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 $104
+JUMPV
+LABELV $106
+LABELV $103
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $105
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $102
+LABELV $104
+ADDRGP4 uis+19680
+CNSTI4 1
+ASGNI4
+LABELV $82
+endproc UI_PushMenu 16 8
+export UI_PopMenu
+proc UI_PopMenu 4 8
+ADDRGP4 menu_out_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 uis+16
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 0
+GEI4 $111
+ADDRGP4 $114
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $111
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 0
+EQI4 $115
+ADDRGP4 uis+20
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+24-4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 uis+19680
+CNSTI4 1
+ASGNI4
+ADDRGP4 $116
+JUMPV
+LABELV $115
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+LABELV $116
+LABELV $109
+endproc UI_PopMenu 4 8
+export UI_ForceMenuOff
+proc UI_ForceMenuOff 4 8
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 uis+20
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $126
+ARGP4
+ADDRGP4 $127
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $123
+endproc UI_ForceMenuOff 4 8
+export UI_LerpColor
+proc UI_LerpColor 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $129
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $133
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $135
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $135
+LABELV $134
+LABELV $130
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $129
+LABELV $128
+endproc UI_LerpColor 12 0
+data
+align 4
+LABELV propMap
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 8
+byte 4 11
+byte 4 122
+byte 4 7
+byte 4 154
+byte 4 181
+byte 4 14
+byte 4 55
+byte 4 122
+byte 4 17
+byte 4 79
+byte 4 122
+byte 4 18
+byte 4 101
+byte 4 122
+byte 4 23
+byte 4 153
+byte 4 122
+byte 4 18
+byte 4 9
+byte 4 93
+byte 4 7
+byte 4 207
+byte 4 122
+byte 4 8
+byte 4 230
+byte 4 122
+byte 4 9
+byte 4 177
+byte 4 122
+byte 4 18
+byte 4 30
+byte 4 152
+byte 4 18
+byte 4 85
+byte 4 181
+byte 4 7
+byte 4 34
+byte 4 93
+byte 4 11
+byte 4 110
+byte 4 181
+byte 4 6
+byte 4 130
+byte 4 152
+byte 4 14
+byte 4 22
+byte 4 64
+byte 4 17
+byte 4 41
+byte 4 64
+byte 4 12
+byte 4 58
+byte 4 64
+byte 4 17
+byte 4 78
+byte 4 64
+byte 4 18
+byte 4 98
+byte 4 64
+byte 4 19
+byte 4 120
+byte 4 64
+byte 4 18
+byte 4 141
+byte 4 64
+byte 4 18
+byte 4 204
+byte 4 64
+byte 4 16
+byte 4 162
+byte 4 64
+byte 4 17
+byte 4 182
+byte 4 64
+byte 4 18
+byte 4 59
+byte 4 181
+byte 4 7
+byte 4 35
+byte 4 181
+byte 4 7
+byte 4 203
+byte 4 152
+byte 4 14
+byte 4 56
+byte 4 93
+byte 4 14
+byte 4 228
+byte 4 152
+byte 4 14
+byte 4 177
+byte 4 181
+byte 4 18
+byte 4 28
+byte 4 122
+byte 4 22
+byte 4 5
+byte 4 4
+byte 4 18
+byte 4 27
+byte 4 4
+byte 4 18
+byte 4 48
+byte 4 4
+byte 4 18
+byte 4 69
+byte 4 4
+byte 4 17
+byte 4 90
+byte 4 4
+byte 4 13
+byte 4 106
+byte 4 4
+byte 4 13
+byte 4 121
+byte 4 4
+byte 4 18
+byte 4 143
+byte 4 4
+byte 4 17
+byte 4 164
+byte 4 4
+byte 4 8
+byte 4 175
+byte 4 4
+byte 4 16
+byte 4 195
+byte 4 4
+byte 4 18
+byte 4 216
+byte 4 4
+byte 4 12
+byte 4 230
+byte 4 4
+byte 4 23
+byte 4 6
+byte 4 34
+byte 4 18
+byte 4 27
+byte 4 34
+byte 4 18
+byte 4 48
+byte 4 34
+byte 4 18
+byte 4 68
+byte 4 34
+byte 4 18
+byte 4 90
+byte 4 34
+byte 4 17
+byte 4 110
+byte 4 34
+byte 4 18
+byte 4 130
+byte 4 34
+byte 4 14
+byte 4 146
+byte 4 34
+byte 4 18
+byte 4 166
+byte 4 34
+byte 4 19
+byte 4 185
+byte 4 34
+byte 4 29
+byte 4 215
+byte 4 34
+byte 4 18
+byte 4 234
+byte 4 34
+byte 4 18
+byte 4 5
+byte 4 64
+byte 4 14
+byte 4 60
+byte 4 152
+byte 4 7
+byte 4 106
+byte 4 151
+byte 4 13
+byte 4 83
+byte 4 152
+byte 4 7
+byte 4 128
+byte 4 122
+byte 4 17
+byte 4 4
+byte 4 152
+byte 4 21
+byte 4 134
+byte 4 181
+byte 4 5
+byte 4 5
+byte 4 4
+byte 4 18
+byte 4 27
+byte 4 4
+byte 4 18
+byte 4 48
+byte 4 4
+byte 4 18
+byte 4 69
+byte 4 4
+byte 4 17
+byte 4 90
+byte 4 4
+byte 4 13
+byte 4 106
+byte 4 4
+byte 4 13
+byte 4 121
+byte 4 4
+byte 4 18
+byte 4 143
+byte 4 4
+byte 4 17
+byte 4 164
+byte 4 4
+byte 4 8
+byte 4 175
+byte 4 4
+byte 4 16
+byte 4 195
+byte 4 4
+byte 4 18
+byte 4 216
+byte 4 4
+byte 4 12
+byte 4 230
+byte 4 4
+byte 4 23
+byte 4 6
+byte 4 34
+byte 4 18
+byte 4 27
+byte 4 34
+byte 4 18
+byte 4 48
+byte 4 34
+byte 4 18
+byte 4 68
+byte 4 34
+byte 4 18
+byte 4 90
+byte 4 34
+byte 4 17
+byte 4 110
+byte 4 34
+byte 4 18
+byte 4 130
+byte 4 34
+byte 4 14
+byte 4 146
+byte 4 34
+byte 4 18
+byte 4 166
+byte 4 34
+byte 4 19
+byte 4 185
+byte 4 34
+byte 4 29
+byte 4 215
+byte 4 34
+byte 4 18
+byte 4 234
+byte 4 34
+byte 4 18
+byte 4 5
+byte 4 64
+byte 4 14
+byte 4 153
+byte 4 152
+byte 4 13
+byte 4 11
+byte 4 181
+byte 4 5
+byte 4 180
+byte 4 152
+byte 4 13
+byte 4 79
+byte 4 93
+byte 4 17
+byte 4 0
+byte 4 0
+byte 4 -1
+align 4
+LABELV propMapB
+byte 4 11
+byte 4 12
+byte 4 33
+byte 4 49
+byte 4 12
+byte 4 31
+byte 4 85
+byte 4 12
+byte 4 31
+byte 4 120
+byte 4 12
+byte 4 30
+byte 4 156
+byte 4 12
+byte 4 21
+byte 4 183
+byte 4 12
+byte 4 21
+byte 4 207
+byte 4 12
+byte 4 32
+byte 4 13
+byte 4 55
+byte 4 30
+byte 4 49
+byte 4 55
+byte 4 13
+byte 4 66
+byte 4 55
+byte 4 29
+byte 4 101
+byte 4 55
+byte 4 31
+byte 4 135
+byte 4 55
+byte 4 21
+byte 4 158
+byte 4 55
+byte 4 40
+byte 4 204
+byte 4 55
+byte 4 32
+byte 4 12
+byte 4 97
+byte 4 31
+byte 4 48
+byte 4 97
+byte 4 31
+byte 4 82
+byte 4 97
+byte 4 30
+byte 4 118
+byte 4 97
+byte 4 30
+byte 4 153
+byte 4 97
+byte 4 30
+byte 4 185
+byte 4 97
+byte 4 25
+byte 4 213
+byte 4 97
+byte 4 30
+byte 4 11
+byte 4 139
+byte 4 32
+byte 4 42
+byte 4 139
+byte 4 51
+byte 4 93
+byte 4 139
+byte 4 32
+byte 4 126
+byte 4 139
+byte 4 31
+byte 4 158
+byte 4 139
+byte 4 25
+code
+proc UI_DrawBannerString2 60 36
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19664
+INDIRF4
+MULF4
+ADDRGP4 uis+19672
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19668
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $141
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 32
+NEI4 $144
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+CNSTF4 1098907648
+ADDRGP4 uis+19664
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRLP4 40
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 65
+LTI4 $147
+ADDRLP4 40
+INDIRI4
+CNSTI4 90
+GTI4 $147
+ADDRLP4 0
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 65
+SUBI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTI4 12
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+MULI4
+ASGNI4
+ADDRLP4 48
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRI4
+ADDRGP4 propMapB
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 48
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ADDRGP4 propMapB+4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 48
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 44
+INDIRI4
+ADDRGP4 propMapB+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 48
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1041235968
+ASGNF4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ADDRGP4 propMapB+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1108344832
+ADDRGP4 uis+19668
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 uis+19648
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 uis+19664
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+LABELV $147
+LABELV $145
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $142
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $141
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $137
+endproc UI_DrawBannerString2 60 36
+export UI_DrawBannerString
+proc UI_DrawBannerString 44 16
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $158
+JUMPV
+LABELV $157
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+NEI4 $160
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+ADDI4
+ASGNI4
+ADDRGP4 $161
+JUMPV
+LABELV $160
+ADDRLP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $162
+ADDRLP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $162
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 propMapB-780+8
+ADDP4
+INDIRI4
+CNSTI4 4
+ADDI4
+ADDI4
+ASGNI4
+LABELV $162
+LABELV $161
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $158
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $157
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $167
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $169
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $170
+ADDRGP4 $167
+JUMPV
+LABELV $169
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $170
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $167
+ADDRFP4 12
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $172
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 UI_DrawBannerString2
+CALLV
+pop
+LABELV $172
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawBannerString2
+CALLV
+pop
+LABELV $156
+endproc UI_DrawBannerString 44 16
+export UI_ProportionalStringWidth
+proc UI_ProportionalStringWidth 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $182
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+LABELV $182
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $179
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $178
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+SUBI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $177
+endproc UI_ProportionalStringWidth 16 0
+proc UI_DrawProportionalString2 60 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19664
+INDIRF4
+MULF4
+ADDRGP4 uis+19672
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19668
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 32
+NEI4 $191
+ADDRLP4 8
+CNSTF4 1090519040
+ADDRGP4 uis+19664
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $192
+JUMPV
+LABELV $191
+CNSTI4 12
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+MULI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $194
+ADDRLP4 40
+CNSTI4 12
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+MULI4
+ASGNI4
+ADDRLP4 44
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+ADDRGP4 propMap
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ADDRGP4 propMap+4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 40
+INDIRI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1037565952
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19664
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1104674816
+ADDRGP4 uis+19668
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $194
+LABELV $192
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1077936128
+ADDRGP4 uis+19664
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $189
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $188
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $184
+endproc UI_DrawProportionalString2 60 36
+export UI_ProportionalSizeScale
+proc UI_ProportionalSizeScale 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $204
+CNSTF4 1061158912
+RETF4
+ADDRGP4 $203
+JUMPV
+LABELV $204
+CNSTF4 1065353216
+RETF4
+LABELV $203
+endproc UI_ProportionalSizeScale 0 0
+export UI_DrawProportionalString
+proc UI_DrawProportionalString 52 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_ProportionalSizeScale
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $208
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $210
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $211
+ADDRGP4 $208
+JUMPV
+LABELV $210
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $208
+JUMPV
+LABELV $211
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $208
+ADDRFP4 12
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $213
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+19640
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+LABELV $213
+ADDRFP4 12
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $219
+ADDRLP4 36
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1060320051
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+19640
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRGP4 $206
+JUMPV
+LABELV $219
+ADDRFP4 12
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $225
+ADDRLP4 36
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1060320051
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+19640
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1056964608
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+19644
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRGP4 $206
+JUMPV
+LABELV $225
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+19640
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+LABELV $206
+endproc UI_DrawProportionalString 52 24
+export UI_DrawProportionalString_AutoWrapped
+proc UI_DrawProportionalString_AutoWrapped 1072 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $240
+ADDRFP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $238
+LABELV $240
+ADDRGP4 $237
+JUMPV
+LABELV $238
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ADDRGP4 UI_ProportionalSizeScale
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 1052
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+ASGNP4
+ADDRGP4 $242
+JUMPV
+LABELV $241
+LABELV $244
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $245
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 32
+EQI4 $247
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $244
+LABELV $247
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI1
+ASGNI1
+ADDRLP4 16
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $248
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $250
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $250
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $252
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $243
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $243
+JUMPV
+LABELV $252
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $256
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $243
+JUMPV
+LABELV $256
+LABELV $249
+LABELV $242
+ADDRGP4 $241
+JUMPV
+LABELV $243
+LABELV $237
+endproc UI_DrawProportionalString_AutoWrapped 1072 20
+proc UI_DrawString2 84 36
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 20
+INDIRI4
+NEGI4
+GEI4 $259
+ADDRGP4 $258
+JUMPV
+LABELV $259
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19664
+INDIRF4
+MULF4
+ADDRGP4 uis+19672
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19668
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19668
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $269
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $269
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $269
+ADDRLP4 56
+INDIRI4
+CNSTI4 65
+LTI4 $272
+ADDRLP4 56
+INDIRI4
+CNSTI4 90
+LEI4 $271
+LABELV $272
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 97
+LTI4 $273
+ADDRLP4 60
+INDIRI4
+CNSTI4 122
+LEI4 $271
+LABELV $273
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 48
+LTI4 $269
+ADDRLP4 64
+INDIRI4
+CNSTI4 57
+GTI4 $269
+LABELV $271
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $274
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 24+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $274
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $267
+JUMPV
+LABELV $269
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $277
+ADDRLP4 68
+CNSTF4 1031798784
+ASGNF4
+ADDRLP4 72
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+RSHI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRI4
+CNSTI4 15
+BANDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 68
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 68
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 uis+19636
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $277
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $267
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $266
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $258
+endproc UI_DrawString2 84 36
+export UI_DrawString
+proc UI_DrawString 84 24
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $281
+ADDRGP4 $280
+JUMPV
+LABELV $281
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 64
+INDIRI4
+EQI4 $283
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+ADDRLP4 64
+INDIRI4
+EQI4 $283
+ADDRGP4 $280
+JUMPV
+LABELV $283
+ADDRFP4 12
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $286
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+CNSTI4 16
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRFP4 12
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $288
+ADDRLP4 0
+CNSTI4 32
+ASGNI4
+ADDRLP4 4
+CNSTI4 48
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRLP4 68
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $289
+LABELV $287
+ADDRFP4 12
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $290
+ADDRLP4 68
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 8
+ADDRLP4 68
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 68
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 1061997773
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1061997773
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 76
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 UI_LerpColor
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 44
+ASGNP4
+ADDRGP4 $291
+JUMPV
+LABELV $290
+ADDRLP4 24
+ADDRFP4 16
+INDIRP4
+ASGNP4
+LABELV $291
+ADDRLP4 68
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+EQI4 $299
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+EQI4 $300
+ADDRGP4 $297
+JUMPV
+LABELV $299
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 60
+ADDRLP4 76
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $297
+JUMPV
+LABELV $300
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 60
+ADDRLP4 80
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+LABELV $297
+ADDRFP4 12
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $301
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 28+12
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawString2
+CALLV
+pop
+LABELV $301
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawString2
+CALLV
+pop
+LABELV $280
+endproc UI_DrawString 84 24
+export UI_DrawChar
+proc UI_DrawChar 2 20
+ADDRLP4 0
+ADDRFP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0+1
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $306
+endproc UI_DrawChar 2 20
+export UI_IsFullscreen
+proc UI_IsFullscreen 4 0
+ADDRGP4 uis+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $309
+ADDRLP4 0
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $309
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 4120
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $308
+JUMPV
+LABELV $309
+CNSTI4 0
+RETI4
+LABELV $308
+endproc UI_IsFullscreen 4 0
+proc NeedCDAction 0 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $314
+CNSTI4 2
+ARGI4
+ADDRGP4 $316
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $314
+LABELV $313
+endproc NeedCDAction 0 8
+proc NeedCDKeyAction 0 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $318
+CNSTI4 2
+ARGI4
+ADDRGP4 $316
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $318
+LABELV $317
+endproc NeedCDKeyAction 0 8
+export UI_SetActiveMenu
+proc UI_SetActiveMenu 8 12
+ADDRGP4 Menu_Cache
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $321
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GTI4 $321
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $334
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $334
+address $324
+address $325
+address $330
+address $326
+address $328
+address $332
+address $332
+code
+LABELV $324
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+ADDRGP4 $320
+JUMPV
+LABELV $325
+ADDRGP4 UI_MainMenu
+CALLV
+pop
+ADDRGP4 $320
+JUMPV
+LABELV $326
+ADDRGP4 $327
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 NeedCDAction
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+ADDRGP4 $320
+JUMPV
+LABELV $328
+ADDRGP4 $329
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 NeedCDKeyAction
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+ADDRGP4 $320
+JUMPV
+LABELV $330
+ADDRGP4 $126
+ARGP4
+ADDRGP4 $331
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 UI_InGameMenu
+CALLV
+pop
+ADDRGP4 $320
+JUMPV
+LABELV $332
+LABELV $321
+ADDRGP4 $333
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $322
+LABELV $320
+endproc UI_SetActiveMenu 8 12
+export UI_KeyEvent
+proc UI_KeyEvent 1044 12
+ADDRGP4 uis+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $336
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $339
+ADDRGP4 $335
+JUMPV
+LABELV $339
+ADDRLP4 1028
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 145
+LTI4 $335
+ADDRLP4 1028
+INDIRI4
+CNSTI4 159
+GTI4 $335
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $344-580
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $344
+address $342
+address $342
+address $342
+address $342
+address $342
+address $342
+address $342
+address $342
+address $342
+address $342
+address $342
+address $342
+address $342
+address $342
+address $342
+code
+LABELV $342
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Key_GetBindingBuf
+CALLV
+pop
+ADDRLP4 1032
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $352
+ADDRLP4 1032
+INDIRI4
+CNSTI4 43
+EQI4 $352
+ADDRLP4 4+1
+INDIRI1
+CVII4 1
+CNSTI4 45
+EQI4 $352
+ADDRGP4 $349
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $349
+ARGP4
+ADDRLP4 1036
+INDIRU4
+CNSTU4 1
+SUBU4
+CVUI4 4
+ARGI4
+ADDRLP4 1040
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $346
+LABELV $352
+ADDRGP4 $335
+JUMPV
+LABELV $346
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $335
+JUMPV
+LABELV $336
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $353
+ADDRGP4 $335
+JUMPV
+LABELV $353
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 4112
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $355
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 4112
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRGP4 uis+20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $356
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $360
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menu_null_sound
+INDIRI4
+EQI4 $360
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $360
+LABELV $335
+endproc UI_KeyEvent 1044 12
+export UI_MouseEvent
+proc UI_MouseEvent 28 8
+ADDRGP4 uis+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $363
+ADDRGP4 $362
+JUMPV
+LABELV $363
+ADDRLP4 8
+ADDRGP4 uis+19672
+INDIRF4
+ADDRGP4 uis+19664
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 uis+8
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEGI4
+GEI4 $369
+ADDRGP4 uis+8
+ADDRLP4 8
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $370
+JUMPV
+LABELV $369
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 640
+ADDI4
+LEI4 $373
+ADDRGP4 uis+8
+ADDRLP4 8
+INDIRI4
+CNSTI4 640
+ADDI4
+ASGNI4
+LABELV $373
+LABELV $370
+ADDRLP4 16
+ADDRGP4 uis+12
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uis+12
+INDIRI4
+CNSTI4 0
+GEI4 $378
+ADDRGP4 uis+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRGP4 uis+12
+INDIRI4
+CNSTI4 480
+LEI4 $382
+ADDRGP4 uis+12
+CNSTI4 480
+ASGNI4
+LABELV $382
+LABELV $379
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $389
+JUMPV
+LABELV $386
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 24576
+BANDU4
+CNSTU4 0
+EQU4 $392
+ADDRGP4 $387
+JUMPV
+LABELV $392
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LTI4 $402
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+GTI4 $402
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+LTI4 $402
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+LEI4 $394
+LABELV $402
+ADDRGP4 $387
+JUMPV
+LABELV $394
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $403
+ADDRGP4 uis+20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRLP4 24
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294966783
+BANDU4
+ASGNU4
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 1048576
+BANDU4
+CNSTU4 0
+NEU4 $409
+ADDRGP4 menu_move_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $409
+LABELV $403
+ADDRLP4 24
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 512
+BORU4
+ASGNU4
+ADDRGP4 $362
+JUMPV
+LABELV $387
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $389
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $386
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $415
+ADDRLP4 20
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294966783
+BANDU4
+ASGNU4
+LABELV $415
+LABELV $362
+endproc UI_MouseEvent 28 8
+bss
+align 1
+LABELV $421
+skip 1024
+export UI_Argv
+code
+proc UI_Argv 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $421
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 $421
+RETP4
+LABELV $420
+endproc UI_Argv 0 12
+bss
+align 1
+LABELV $423
+skip 1024
+export UI_Cvar_VariableString
+code
+proc UI_Cvar_VariableString 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $423
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $423
+RETP4
+LABELV $422
+endproc UI_Cvar_VariableString 0 12
+export UI_Cache_f
+proc UI_Cache_f 0 0
+ADDRGP4 MainMenu_Cache
+CALLV
+pop
+ADDRGP4 InGame_Cache
+CALLV
+pop
+ADDRGP4 ConfirmMenu_Cache
+CALLV
+pop
+ADDRGP4 PlayerModel_Cache
+CALLV
+pop
+ADDRGP4 PlayerSettings_Cache
+CALLV
+pop
+ADDRGP4 Controls_Cache
+CALLV
+pop
+ADDRGP4 Demos_Cache
+CALLV
+pop
+ADDRGP4 UI_CinematicsMenu_Cache
+CALLV
+pop
+ADDRGP4 Preferences_Cache
+CALLV
+pop
+ADDRGP4 ServerInfo_Cache
+CALLV
+pop
+ADDRGP4 SpecifyServer_Cache
+CALLV
+pop
+ADDRGP4 ArenaServers_Cache
+CALLV
+pop
+ADDRGP4 StartServer_Cache
+CALLV
+pop
+ADDRGP4 ServerOptions_Cache
+CALLV
+pop
+ADDRGP4 DriverInfo_Cache
+CALLV
+pop
+ADDRGP4 GraphicsOptions_Cache
+CALLV
+pop
+ADDRGP4 UI_DisplayOptionsMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_SoundOptionsMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_NetworkOptionsMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_SPSkillMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_SPPostgameMenu_Cache
+CALLV
+pop
+ADDRGP4 TeamMain_Cache
+CALLV
+pop
+ADDRGP4 UI_AddBots_Cache
+CALLV
+pop
+ADDRGP4 UI_RemoveBots_Cache
+CALLV
+pop
+ADDRGP4 UI_SetupMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_BotSelectMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_CDKeyMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_ModsMenu_Cache
+CALLV
+pop
+LABELV $424
+endproc UI_Cache_f 0 0
+export UI_ConsoleCommand
+proc UI_ConsoleCommand 44 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uis
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uis+4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 uis+4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 Menu_Cache
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $430
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $428
+ADDRGP4 UI_SPLevelMenu_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $425
+JUMPV
+LABELV $428
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $433
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $431
+ADDRGP4 UI_SPPostgameMenu_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $425
+JUMPV
+LABELV $431
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $436
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $434
+ADDRGP4 UI_Cache_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $425
+JUMPV
+LABELV $434
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $439
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $437
+ADDRGP4 UI_CinematicsMenu_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $425
+JUMPV
+LABELV $437
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $442
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $440
+ADDRGP4 UI_TeamOrdersMenu_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $425
+JUMPV
+LABELV $440
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $445
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $443
+ADDRGP4 UI_SPUnlock_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $425
+JUMPV
+LABELV $443
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $448
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $446
+ADDRGP4 UI_SPUnlockMedals_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $425
+JUMPV
+LABELV $446
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $451
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $449
+ADDRGP4 UI_CDKeyMenu_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $425
+JUMPV
+LABELV $449
+CNSTI4 0
+RETI4
+LABELV $425
+endproc UI_ConsoleCommand 44 8
+export UI_Shutdown
+proc UI_Shutdown 0 0
+LABELV $452
+endproc UI_Shutdown 0 0
+export UI_Init
+proc UI_Init 0 8
+ADDRGP4 $454
+ARGP4
+ADDRGP4 $455
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 UI_RegisterCvars
+CALLV
+pop
+ADDRGP4 UI_InitGameinfo
+CALLV
+pop
+ADDRGP4 uis+56
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRGP4 uis+19664
+CNSTF4 986500301
+ADDRGP4 uis+56+19496
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 uis+19668
+CNSTF4 990414985
+ADDRGP4 uis+56+19500
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+CNSTI4 480
+ADDRGP4 uis+56+19496
+INDIRI4
+MULI4
+CNSTI4 640
+ADDRGP4 uis+56+19500
+INDIRI4
+MULI4
+LEI4 $463
+ADDRGP4 uis+19672
+CNSTF4 1056964608
+ADDRGP4 uis+56+19496
+INDIRI4
+CVIF4 4
+CNSTF4 1068149419
+ADDRGP4 uis+56+19500
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRGP4 uis+19664
+ADDRGP4 uis+19668
+INDIRF4
+ASGNF4
+ADDRGP4 $464
+JUMPV
+LABELV $463
+ADDRGP4 uis+19672
+CNSTF4 0
+ASGNF4
+LABELV $464
+ADDRGP4 Menu_Cache
+CALLV
+pop
+ADDRGP4 uis+20
+CNSTP4 0
+ASGNP4
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+LABELV $453
+endproc UI_Init 0 8
+export UI_AdjustFrom640
+proc UI_AdjustFrom640 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 uis+19664
+INDIRF4
+MULF4
+ADDRGP4 uis+19672
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 uis+19668
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 uis+19664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 uis+19668
+INDIRF4
+MULF4
+ASGNF4
+LABELV $479
+endproc UI_AdjustFrom640 16 0
+export UI_DrawNamedPic
+proc UI_DrawNamedPic 16 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $485
+endproc UI_DrawNamedPic 16 36
+export UI_DrawHandlePic
+proc UI_DrawHandlePic 16 36
+ADDRFP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $487
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $488
+JUMPV
+LABELV $487
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $488
+ADDRFP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $489
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRGP4 $490
+JUMPV
+LABELV $489
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $490
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $486
+endproc UI_DrawHandlePic 16 36
+export UI_FillRect
+proc UI_FillRect 4 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uis+19624
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $491
+endproc UI_FillRect 4 36
+export UI_DrawRect
+proc UI_DrawRect 24 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uis+19624
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 uis+19624
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 uis+19624
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 uis+19624
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $493
+endproc UI_DrawRect 24 36
+export UI_SetColor
+proc UI_SetColor 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $498
+endproc UI_SetColor 0 4
+export UI_UpdateScreen
+proc UI_UpdateScreen 0 0
+ADDRGP4 trap_UpdateScreen
+CALLV
+pop
+LABELV $499
+endproc UI_UpdateScreen 0 0
+export UI_Refresh
+proc UI_Refresh 24 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uis
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uis+4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 uis+4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $503
+ADDRGP4 $500
+JUMPV
+LABELV $503
+ADDRGP4 UI_UpdateCvars
+CALLV
+pop
+ADDRGP4 uis+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $505
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 4120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $508
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 4124
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $511
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+19628
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $511
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+19632
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $512
+LABELV $508
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 4108
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $516
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 4108
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $517
+JUMPV
+LABELV $516
+ADDRGP4 uis+20
+INDIRP4
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $517
+ADDRGP4 uis+19680
+INDIRI4
+CNSTI4 0
+EQI4 $521
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_MouseEvent
+CALLV
+pop
+ADDRGP4 uis+19680
+CNSTI4 0
+ASGNI4
+LABELV $521
+LABELV $505
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_SetColor
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 uis+19652
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 uis+19620
+INDIRI4
+CNSTI4 0
+EQI4 $528
+ADDRGP4 $531
+ARGP4
+ADDRGP4 uis+8
+INDIRI4
+ARGI4
+ADDRGP4 uis+12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 colorRed
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $528
+ADDRGP4 m_entersound
+INDIRI4
+CNSTI4 0
+EQI4 $534
+ADDRGP4 menu_in_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 m_entersound
+CNSTI4 0
+ASGNI4
+LABELV $534
+LABELV $500
+endproc UI_Refresh 24 20
+export UI_DrawTextBox
+proc UI_DrawTextBox 24 20
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawRect
+CALLV
+pop
+LABELV $536
+endproc UI_DrawTextBox 24 20
+export UI_CursorInRect
+proc UI_CursorInRect 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $546
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $546
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+GTI4 $546
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+LEI4 $538
+LABELV $546
+CNSTI4 0
+RETI4
+ADDRGP4 $537
+JUMPV
+LABELV $538
+CNSTI4 1
+RETI4
+LABELV $537
+endproc UI_CursorInRect 8 0
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_DrawConsoleLinesOver
+import trap_OpenWolfcamDirectory
+import trap_OpenQuakeLiveDirectory
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+bss
+export uis
+align 4
+LABELV uis
+skip 19688
+export m_entersound
+align 4
+LABELV m_entersound
+skip 4
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import ScrollList_Init
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_doubleClickTime
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $531
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $455
+byte 1 49
+byte 1 50
+byte 1 46
+byte 1 48
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 50
+byte 1 54
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 49
+byte 1 54
+byte 1 52
+byte 1 97
+byte 1 50
+byte 1 55
+byte 1 51
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 50
+byte 1 54
+byte 1 45
+byte 1 49
+byte 1 48
+byte 1 45
+byte 1 49
+byte 1 56
+byte 1 0
+align 1
+LABELV $454
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $451
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $448
+byte 1 105
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 110
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $445
+byte 1 105
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $442
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $439
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $436
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $433
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $430
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $349
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 0
+align 1
+LABELV $333
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $331
+byte 1 49
+byte 1 0
+align 1
+LABELV $329
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 67
+byte 1 68
+byte 1 32
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $327
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 67
+byte 1 68
+byte 1 0
+align 1
+LABELV $316
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $127
+byte 1 48
+byte 1 0
+align 1
+LABELV $126
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $114
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 80
+byte 1 111
+byte 1 112
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $98
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 80
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $81
+byte 1 100
+byte 1 49
+byte 1 10
+byte 1 0
@@ -0,0 +1,6939 @@
+data
+align 4
+LABELV controls_binding_color
+byte 4 1065353216
+byte 4 1054615798
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV g_bindings
+address $74
+address $75
+byte 4 0
+byte 4 0
+byte 4 9
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $76
+address $77
+byte 4 1
+byte 4 0
+byte 4 13
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $78
+address $79
+byte 4 2
+byte 4 1
+byte 4 138
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $80
+address $81
+byte 4 3
+byte 4 2
+byte 4 132
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $82
+address $83
+byte 4 4
+byte 4 3
+byte 4 133
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $84
+address $85
+byte 4 5
+byte 4 6
+byte 4 44
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $86
+address $87
+byte 4 6
+byte 4 7
+byte 4 46
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $88
+address $89
+byte 4 7
+byte 4 4
+byte 4 32
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $90
+address $91
+byte 4 8
+byte 4 5
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $92
+address $93
+byte 4 9
+byte 4 8
+byte 4 134
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $94
+address $95
+byte 4 10
+byte 4 9
+byte 4 135
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $96
+address $97
+byte 4 11
+byte 4 0
+byte 4 136
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $98
+address $99
+byte 4 12
+byte 4 10
+byte 4 141
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $100
+address $101
+byte 4 13
+byte 4 11
+byte 4 140
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $102
+address $103
+byte 4 14
+byte 4 0
+byte 4 47
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $104
+address $105
+byte 4 15
+byte 4 0
+byte 4 144
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $106
+address $107
+byte 4 16
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $108
+address $109
+byte 4 17
+byte 4 12
+byte 4 49
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $110
+address $111
+byte 4 18
+byte 4 13
+byte 4 50
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $112
+address $113
+byte 4 19
+byte 4 14
+byte 4 51
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $114
+address $115
+byte 4 20
+byte 4 15
+byte 4 52
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $116
+address $117
+byte 4 21
+byte 4 16
+byte 4 53
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $118
+address $119
+byte 4 22
+byte 4 17
+byte 4 54
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $120
+address $121
+byte 4 23
+byte 4 18
+byte 4 55
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $122
+address $123
+byte 4 24
+byte 4 19
+byte 4 56
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $124
+address $125
+byte 4 25
+byte 4 20
+byte 4 57
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $126
+address $127
+byte 4 26
+byte 4 22
+byte 4 137
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $128
+address $129
+byte 4 27
+byte 4 0
+byte 4 91
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $130
+address $131
+byte 4 28
+byte 4 0
+byte 4 93
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $132
+address $133
+byte 4 29
+byte 4 23
+byte 4 180
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $134
+address $135
+byte 4 30
+byte 4 25
+byte 4 116
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $136
+address $137
+byte 4 31
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $138
+address $139
+byte 4 32
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $140
+address $141
+byte 4 33
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $142
+address $143
+byte 4 34
+byte 4 0
+byte 4 27
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+align 4
+LABELV g_configcvars
+address $144
+byte 4 0
+byte 4 0
+address $145
+byte 4 0
+byte 4 0
+address $146
+byte 4 0
+byte 4 0
+address $147
+byte 4 0
+byte 4 0
+address $148
+byte 4 0
+byte 4 0
+address $149
+byte 4 0
+byte 4 0
+address $150
+byte 4 0
+byte 4 0
+address $151
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV g_movement_controls
+address s_controls+6700
+address s_controls+5292
+address s_controls+4752
+address s_controls+4812
+address s_controls+4872
+address s_controls+4932
+address s_controls+4992
+address s_controls+5052
+address s_controls+5112
+address s_controls+5172
+address s_controls+5232
+byte 4 0
+align 4
+LABELV g_weapons_controls
+address s_controls+5892
+address s_controls+6012
+address s_controls+5952
+address s_controls+6824
+address s_controls+5412
+address s_controls+5352
+address s_controls+5472
+address s_controls+5532
+address s_controls+5592
+address s_controls+5652
+address s_controls+5712
+address s_controls+5772
+address s_controls+5832
+byte 4 0
+align 4
+LABELV g_looking_controls
+address s_controls+6560
+address s_controls+6636
+address s_controls+6496
+address s_controls+6072
+address s_controls+6132
+address s_controls+6192
+address s_controls+6252
+address s_controls+6316
+address s_controls+6376
+address s_controls+8384
+address s_controls+8448
+byte 4 0
+align 4
+LABELV g_misc_controls
+address s_controls+6764
+address s_controls+6888
+address s_controls+6436
+address s_controls+8084
+address s_controls+8144
+address s_controls+8204
+address s_controls+8264
+address s_controls+8324
+byte 4 0
+align 4
+LABELV g_controls
+address g_movement_controls
+address g_looking_controls
+address g_weapons_controls
+address g_misc_controls
+code
+proc Controls_InitCvars 28 8
+ADDRLP4 0
+ADDRGP4 g_configcvars
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $196
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $200
+ADDRGP4 $198
+JUMPV
+LABELV $200
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $197
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRGP4 $196
+JUMPV
+LABELV $198
+LABELV $195
+endproc Controls_InitCvars 28 8
+proc Controls_GetCvarDefault 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_configcvars
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $203
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $207
+CNSTF4 0
+RETF4
+ADDRGP4 $202
+JUMPV
+LABELV $207
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $209
+ADDRGP4 $205
+JUMPV
+LABELV $209
+LABELV $204
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRGP4 $203
+JUMPV
+LABELV $205
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+RETF4
+LABELV $202
+endproc Controls_GetCvarDefault 12 8
+proc Controls_GetCvarValue 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_configcvars
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $212
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $216
+CNSTF4 0
+RETF4
+ADDRGP4 $211
+JUMPV
+LABELV $216
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $218
+ADDRGP4 $214
+JUMPV
+LABELV $218
+LABELV $213
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRGP4 $212
+JUMPV
+LABELV $214
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+RETF4
+LABELV $211
+endproc Controls_GetCvarValue 12 8
+proc Controls_UpdateModel 20 28
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_controls+8596+8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+8596+4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+8596
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_controls+8608+8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+8608+4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+8608
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+8596+4
+CNSTF4 1125515264
+ASGNF4
+ADDRGP4 s_controls+8608+4
+ADDRGP4 s_controls+8596+4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+8620
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_controls+8624
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_controls+8628
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+ASGNI4
+ADDRGP4 s_controls+8632
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $242
+ADDRLP4 8
+INDIRI4
+CNSTI4 25
+GTI4 $242
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $305-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $305
+address $243
+address $245
+address $247
+address $249
+address $251
+address $259
+address $265
+address $253
+address $256
+address $271
+address $273
+address $275
+address $277
+address $279
+address $281
+address $283
+address $285
+address $287
+address $289
+address $291
+address $293
+address $295
+address $297
+address $299
+address $303
+code
+LABELV $243
+ADDRGP4 s_controls+8620
+CNSTI4 15
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $245
+ADDRGP4 s_controls+8620
+CNSTI4 14
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $247
+ADDRGP4 s_controls+8620
+CNSTI4 16
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $249
+ADDRGP4 s_controls+8620
+CNSTI4 18
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $251
+ADDRGP4 s_controls+8620
+CNSTI4 23
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $253
+ADDRLP4 12
+ADDRGP4 s_controls+8596+4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRGP4 $242
+JUMPV
+LABELV $256
+ADDRLP4 16
+ADDRGP4 s_controls+8596+4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+ASGNF4
+ADDRGP4 $242
+JUMPV
+LABELV $259
+ADDRGP4 s_controls+8620
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+8608+4
+ADDRGP4 s_controls+8596+4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRGP4 $242
+JUMPV
+LABELV $265
+ADDRGP4 s_controls+8620
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+8608+4
+ADDRGP4 s_controls+8596+4
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+ASGNF4
+ADDRGP4 $242
+JUMPV
+LABELV $271
+ADDRGP4 s_controls+8596
+CNSTF4 3258187776
+ASGNF4
+ADDRGP4 $242
+JUMPV
+LABELV $273
+ADDRGP4 s_controls+8596
+CNSTF4 1110704128
+ASGNF4
+ADDRGP4 $242
+JUMPV
+LABELV $275
+ADDRGP4 s_controls+8628
+CNSTI4 1
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $277
+ADDRGP4 s_controls+8628
+CNSTI4 2
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $279
+ADDRGP4 s_controls+8628
+CNSTI4 3
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $281
+ADDRGP4 s_controls+8628
+CNSTI4 4
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $283
+ADDRGP4 s_controls+8628
+CNSTI4 5
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $285
+ADDRGP4 s_controls+8628
+CNSTI4 6
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $287
+ADDRGP4 s_controls+8628
+CNSTI4 7
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $289
+ADDRGP4 s_controls+8628
+CNSTI4 8
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $291
+ADDRGP4 s_controls+8628
+CNSTI4 9
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $293
+ADDRGP4 s_controls+8628
+CNSTI4 10
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $295
+ADDRGP4 s_controls+8624
+CNSTI4 7
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $297
+ADDRGP4 s_controls+8624
+CNSTI4 6
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $299
+ADDRGP4 s_controls+8620
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+8624
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+8628
+CNSTI4 0
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $303
+ADDRGP4 s_controls+8632
+CNSTI4 1
+ASGNI4
+LABELV $242
+ADDRGP4 s_controls+6948
+ARGP4
+ADDRGP4 s_controls+8620
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+8624
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+8596
+ARGP4
+ADDRGP4 s_controls+8608
+ARGP4
+ADDRGP4 s_controls+8628
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+8632
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+LABELV $220
+endproc Controls_UpdateModel 20 28
+proc Controls_Update 96 0
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $315
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_controls
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $322
+JUMPV
+LABELV $319
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $320
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $322
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $319
+LABELV $316
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $315
+ADDRLP4 8
+ADDRGP4 s_controls+8524
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_controls
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $327
+JUMPV
+LABELV $324
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294938623
+BANDU4
+ASGNU4
+LABELV $325
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $327
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $324
+ADDRLP4 16
+CNSTI4 480
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $328
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 320
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 168
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 488
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $329
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $331
+ADDRLP4 24
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $328
+ADDRGP4 s_controls+8528
+INDIRI4
+CNSTI4 0
+EQI4 $332
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $338
+JUMPV
+LABELV $335
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $336
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $338
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_controls+8
+INDIRI4
+LTI4 $335
+ADDRLP4 28
+ADDRGP4 s_controls
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 s_controls+8724+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRGP4 $314
+JUMPV
+LABELV $332
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $347
+JUMPV
+LABELV $344
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $345
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $347
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_controls+8
+INDIRI4
+LTI4 $344
+ADDRLP4 28
+ADDRGP4 s_controls+4536+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 s_controls+4464+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 s_controls+4608+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 s_controls+4680+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 s_controls+4536+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 s_controls+4464+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 s_controls+4608+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 s_controls+4680+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 s_controls+8524
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+LTI4 $366
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+GTI4 $366
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $389
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $389
+address $369
+address $374
+address $379
+address $384
+code
+LABELV $369
+ADDRLP4 64
+ADDRGP4 s_controls+4464+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 s_controls+4464+44
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+ADDRGP4 $367
+JUMPV
+LABELV $374
+ADDRLP4 72
+ADDRGP4 s_controls+4536+44
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 76
+ADDRGP4 s_controls+4536+44
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+ADDRGP4 $367
+JUMPV
+LABELV $379
+ADDRLP4 80
+ADDRGP4 s_controls+4608+44
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 84
+ADDRGP4 s_controls+4608+44
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+ADDRGP4 $367
+JUMPV
+LABELV $384
+ADDRLP4 88
+ADDRGP4 s_controls+4680+44
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 92
+ADDRGP4 s_controls+4680+44
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+LABELV $366
+LABELV $367
+LABELV $314
+endproc Controls_Update 96 0
+proc Controls_DrawKeyBinding 120 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+NEU4 $392
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+LABELV $393
+ADDRLP4 48
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 -1
+NEI4 $395
+ADDRLP4 12
+ARGP4
+ADDRGP4 $397
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Key_KeynumToStringBuf
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 -1
+EQI4 $399
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Key_KeynumToStringBuf
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $401
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $399
+LABELV $396
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 108
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 112
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+SUBI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 116
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 16400
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 s_controls+8528
+INDIRI4
+CNSTI4 0
+EQI4 $405
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 61
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 384
+ARGI4
+ADDRGP4 $408
+ARGP4
+CNSTI4 16401
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $403
+JUMPV
+LABELV $405
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 374
+ARGI4
+ADDRGP4 $409
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 393
+ARGI4
+ADDRGP4 $410
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $411
+ADDRLP4 100
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 text_color_disabled
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 text_color_disabled
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $412
+JUMPV
+LABELV $411
+ADDRLP4 100
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 controls_binding_color
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 controls_binding_color
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $412
+LABELV $403
+LABELV $390
+endproc Controls_DrawKeyBinding 120 20
+proc Controls_StatusBar 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 384
+ARGI4
+ADDRGP4 $416
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $415
+endproc Controls_StatusBar 0 20
+proc Controls_DrawPlayer 76 24
+ADDRGP4 $418
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 s_controls+8532
+ARGP4
+ADDRLP4 68
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $419
+ADDRGP4 s_controls+6948
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 s_controls+8532
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+LABELV $419
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 s_controls+6948
+ARGP4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $417
+endproc Controls_DrawPlayer 76 24
+proc Controls_GetKeyAssignment 280 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+LABELV $427
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Key_GetBindingBuf
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $431
+ADDRGP4 $428
+JUMPV
+LABELV $431
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $433
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+NEI4 $435
+ADDRGP4 $429
+JUMPV
+LABELV $435
+LABELV $433
+LABELV $428
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $427
+LABELV $429
+LABELV $426
+endproc Controls_GetKeyAssignment 280 12
+proc Controls_GetConfig 80 12
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $438
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $442
+ADDRGP4 $440
+JUMPV
+LABELV $442
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Controls_GetKeyAssignment
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $439
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $438
+JUMPV
+LABELV $440
+ADDRGP4 $145
+ARGP4
+ADDRLP4 20
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+GEF4 $448
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $449
+ADDRGP4 s_controls+6496+60
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 24
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+6636+60
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 32
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+6700+60
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 40
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+6824+60
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $147
+ARGP4
+ADDRLP4 48
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1106247680
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+6560+68
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 56
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+8384+60
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 64
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 1028443341
+ARGF4
+CNSTF4 1061158912
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+8448+68
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRGP4 $151
+ARGP4
+ADDRLP4 72
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+6252+60
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $437
+endproc Controls_GetConfig 80 12
+proc Controls_SetConfig 24 8
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $465
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $469
+ADDRGP4 $467
+JUMPV
+LABELV $469
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $471
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $473
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+LABELV $473
+LABELV $471
+LABELV $466
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $465
+JUMPV
+LABELV $467
+ADDRGP4 s_controls+6496+60
+INDIRI4
+CNSTI4 0
+EQI4 $475
+ADDRGP4 $145
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 12
+INDIRF4
+NEGF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRGP4 $145
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $476
+ADDRGP4 $150
+ARGP4
+ADDRGP4 s_controls+6636+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $144
+ARGP4
+ADDRGP4 s_controls+6700+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $146
+ARGP4
+ADDRGP4 s_controls+6824+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $147
+ARGP4
+ADDRGP4 s_controls+6560+68
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $148
+ARGP4
+ADDRGP4 s_controls+8384+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $149
+ARGP4
+ADDRGP4 s_controls+8448+68
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $151
+ARGP4
+ADDRGP4 s_controls+6252+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $493
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $464
+endproc Controls_SetConfig 24 8
+proc Controls_SetDefaults 44 4
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $495
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $499
+ADDRGP4 $497
+JUMPV
+LABELV $499
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $496
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $495
+JUMPV
+LABELV $497
+ADDRGP4 $145
+ARGP4
+ADDRLP4 12
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $504
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $505
+ADDRGP4 s_controls+6496+60
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 16
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+6636+60
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 20
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+6700+60
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 24
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+6824+60
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $147
+ARGP4
+ADDRLP4 28
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+6560+68
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 32
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+8384+60
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 36
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+8448+68
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 $151
+ARGP4
+ADDRLP4 40
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+6252+60
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $494
+endproc Controls_SetDefaults 44 4
+proc Controls_MenuKey 44 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 s_controls+8528
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $521
+ADDRLP4 24
+CNSTI4 140
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $526
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $533
+LABELV $532
+ADDRLP4 32
+CNSTI4 27
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $527
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $531
+LABELV $534
+ADDRFP4 0
+INDIRI4
+CNSTI4 127
+EQI4 $526
+ADDRGP4 $531
+JUMPV
+LABELV $533
+ADDRLP4 40
+CNSTI4 171
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $526
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $531
+LABELV $535
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $527
+ADDRGP4 $531
+JUMPV
+LABELV $526
+ADDRFP4 0
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $522
+JUMPV
+LABELV $527
+ADDRGP4 s_controls+8080
+INDIRI4
+CNSTI4 0
+EQI4 $531
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 $531
+JUMPV
+LABELV $521
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $536
+ADDRGP4 $531
+JUMPV
+LABELV $536
+ADDRLP4 24
+CNSTI4 27
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $540
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $538
+LABELV $543
+ADDRFP4 0
+INDIRI4
+CNSTI4 96
+EQI4 $531
+ADDRGP4 $538
+JUMPV
+LABELV $540
+ADDRGP4 s_controls+8528
+CNSTI4 0
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 menu_out_sound
+INDIRI4
+RETI4
+ADDRGP4 $520
+JUMPV
+LABELV $538
+LABELV $522
+ADDRGP4 s_controls+8080
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+EQI4 $545
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $547
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $551
+ADDRGP4 $549
+JUMPV
+LABELV $551
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $553
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $553
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $555
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $555
+LABELV $548
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $547
+JUMPV
+LABELV $549
+LABELV $545
+ADDRLP4 8
+ADDRGP4 s_controls
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $558
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $562
+ADDRGP4 $560
+JUMPV
+LABELV $562
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $564
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $566
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $568
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $570
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $568
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $560
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $570
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $566
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $573
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $573
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $575
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $575
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $575
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $570
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $570
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $564
+LABELV $559
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $558
+JUMPV
+LABELV $560
+ADDRGP4 s_controls+8528
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $578
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 menu_out_sound
+INDIRI4
+RETI4
+ADDRGP4 $520
+JUMPV
+LABELV $578
+LABELV $531
+ADDRGP4 s_controls
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $520
+endproc Controls_MenuKey 44 8
+proc Controls_ResetDefaults_Action 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $581
+ADDRGP4 $580
+JUMPV
+LABELV $581
+ADDRGP4 s_controls+8080
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_SetDefaults
+CALLV
+pop
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $580
+endproc Controls_ResetDefaults_Action 0 0
+proc Controls_ResetDefaults_Draw 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 356
+ARGI4
+ADDRGP4 $585
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 383
+ARGI4
+ADDRGP4 $586
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $584
+endproc Controls_ResetDefaults_Draw 0 20
+proc Controls_MenuEvent 12 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 35
+LTI4 $588
+ADDRLP4 0
+INDIRI4
+CNSTI4 42
+GTI4 $627
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $628-140
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $628
+address $623
+address $623
+address $623
+address $623
+address $623
+address $623
+address $623
+address $623
+code
+LABELV $627
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LTI4 $588
+ADDRLP4 0
+INDIRI4
+CNSTI4 107
+GTI4 $588
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $630-400
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $630
+address $591
+address $595
+address $599
+address $603
+address $607
+address $611
+address $617
+address $620
+code
+LABELV $591
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $589
+ADDRGP4 s_controls+8524
+CNSTI4 0
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $589
+JUMPV
+LABELV $595
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $589
+ADDRGP4 s_controls+8524
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $589
+JUMPV
+LABELV $599
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $589
+ADDRGP4 s_controls+8524
+CNSTI4 2
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $589
+JUMPV
+LABELV $603
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $589
+ADDRGP4 s_controls+8524
+CNSTI4 3
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $589
+JUMPV
+LABELV $607
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $589
+ADDRGP4 $610
+ARGP4
+ADDRGP4 Controls_ResetDefaults_Draw
+ARGP4
+ADDRGP4 Controls_ResetDefaults_Action
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+ADDRGP4 $589
+JUMPV
+LABELV $611
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $589
+ADDRGP4 s_controls+8080
+INDIRI4
+CNSTI4 0
+EQI4 $614
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+LABELV $614
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $589
+JUMPV
+LABELV $617
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $589
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $589
+JUMPV
+LABELV $620
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $589
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $589
+JUMPV
+LABELV $623
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $589
+ADDRGP4 s_controls+8080
+CNSTI4 1
+ASGNI4
+LABELV $588
+LABELV $589
+LABELV $587
+endproc Controls_MenuEvent 12 12
+proc Controls_ActionEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $633
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+ADDRGP4 $634
+JUMPV
+LABELV $633
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $635
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+ADDRGP4 $636
+JUMPV
+LABELV $635
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $638
+ADDRGP4 s_controls+8528
+INDIRI4
+CNSTI4 0
+NEI4 $638
+ADDRGP4 s_controls+8528
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $638
+LABELV $636
+LABELV $634
+LABELV $632
+endproc Controls_ActionEvent 0 4
+proc Controls_InitModel 4 12
+ADDRGP4 s_controls+6948
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1132
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $418
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_controls+6948
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+LABELV $642
+endproc Controls_InitModel 4 12
+proc Controls_InitWeapons 4 4
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $649
+JUMPV
+LABELV $646
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $651
+ADDRGP4 $647
+JUMPV
+LABELV $651
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+pop
+LABELV $647
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $649
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $646
+LABELV $645
+endproc Controls_InitWeapons 4 4
+bss
+align 1
+LABELV $654
+skip 32
+code
+proc Controls_MenuInit 0 12
+ADDRGP4 s_controls
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 8796
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 Controls_Cache
+CALLV
+pop
+ADDRGP4 s_controls+4112
+ADDRGP4 Controls_MenuKey
+ASGNP4
+ADDRGP4 s_controls+4116
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+4120
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+4128
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_controls+4128+44
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_controls+4128+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+4128+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_controls+4128+60
+ADDRGP4 $667
+ASGNP4
+ADDRGP4 s_controls+4128+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_controls+4128+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+4200
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+4200+4
+ADDRGP4 $675
+ASGNP4
+ADDRGP4 s_controls+4200+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_controls+4200+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+4200+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_controls+4200+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_controls+4200+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_controls+4288
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+4288+4
+ADDRGP4 $689
+ASGNP4
+ADDRGP4 s_controls+4288+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_controls+4288+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_controls+4288+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_controls+4288+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_controls+4288+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_controls+4536
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+4536+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+4536+8
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_controls+4536+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+4536+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+4536+16
+CNSTI4 186
+ASGNI4
+ADDRGP4 s_controls+4536+60
+ADDRGP4 $713
+ASGNP4
+ADDRGP4 s_controls+4536+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4536+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_controls+4464
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+4464+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+4464+8
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_controls+4464+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+4464+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+4464+16
+CNSTI4 213
+ASGNI4
+ADDRGP4 s_controls+4464+60
+ADDRGP4 $731
+ASGNP4
+ADDRGP4 s_controls+4464+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4464+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_controls+4608
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+4608+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+4608+8
+CNSTI4 102
+ASGNI4
+ADDRGP4 s_controls+4608+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+4608+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+4608+16
+CNSTI4 240
+ASGNI4
+ADDRGP4 s_controls+4608+60
+ADDRGP4 $749
+ASGNP4
+ADDRGP4 s_controls+4608+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4608+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_controls+4680
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+4680+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+4680+8
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_controls+4680+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+4680+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+4680+16
+CNSTI4 267
+ASGNI4
+ADDRGP4 s_controls+4680+60
+ADDRGP4 $767
+ASGNP4
+ADDRGP4 s_controls+4680+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4680+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_controls+8636
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+8636+4
+ADDRGP4 $775
+ASGNP4
+ADDRGP4 s_controls+8636+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_controls+8636+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+8636+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_controls+8636+8
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_controls+8636+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+8636+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_controls+8636+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_controls+8636+60
+ADDRGP4 $792
+ASGNP4
+ADDRGP4 s_controls+4376
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+4376+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_controls+4376+56
+ADDRGP4 Controls_DrawPlayer
+ASGNP4
+ADDRGP4 s_controls+4376+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_controls+4376+16
+CNSTI4 -40
+ASGNI4
+ADDRGP4 s_controls+4376+76
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+4376+80
+CNSTI4 560
+ASGNI4
+ADDRGP4 s_controls+4752
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4752+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4752+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4752+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4752+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_controls+4812
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4812+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4812+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4812+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4812+8
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_controls+4872
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4872+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4872+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4872+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4872+8
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+4932
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4932+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4932+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4932+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4932+8
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+4992
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4992+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4992+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4992+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4992+8
+CNSTI4 7
+ASGNI4
+ADDRGP4 s_controls+5052
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5052+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5052+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5052+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5052+8
+CNSTI4 8
+ASGNI4
+ADDRGP4 s_controls+5112
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5112+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5112+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5112+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5112+8
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+5172
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5172+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5172+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5172+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5172+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_controls+5232
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5232+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5232+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5232+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5232+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_controls+5292
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5292+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5292+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5292+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5292+8
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5412
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5412+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5412+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5412+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5412+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_controls+5352
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5352+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5352+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5352+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5352+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_controls+5472
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5472+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5472+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5472+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5472+8
+CNSTI4 19
+ASGNI4
+ADDRGP4 s_controls+5532
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5532+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5532+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5532+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5532+8
+CNSTI4 20
+ASGNI4
+ADDRGP4 s_controls+5592
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5592+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5592+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5592+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5592+8
+CNSTI4 21
+ASGNI4
+ADDRGP4 s_controls+5652
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5652+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5652+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5652+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5652+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_controls+5712
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5712+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5712+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5712+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5712+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 s_controls+5772
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5772+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5772+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5772+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5772+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 s_controls+5832
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5832+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5832+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5832+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5832+8
+CNSTI4 25
+ASGNI4
+ADDRGP4 s_controls+5892
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5892+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5892+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5892+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5892+8
+CNSTI4 26
+ASGNI4
+ADDRGP4 s_controls+5952
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5952+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5952+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5952+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5952+8
+CNSTI4 27
+ASGNI4
+ADDRGP4 s_controls+6012
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+6012+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+6012+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+6012+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+6012+8
+CNSTI4 28
+ASGNI4
+ADDRGP4 s_controls+6072
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+6072+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+6072+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+6072+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+6072+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_controls+6132
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+6132+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+6132+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+6132+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+6132+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 s_controls+6192
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+6192+44
+CNSTU4 12420
+ASGNU4
+ADDRGP4 s_controls+6192+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+6192+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+6192+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+6252
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+6252+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+6252+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+6252+4
+ADDRGP4 $1038
+ASGNP4
+ADDRGP4 s_controls+6252+8
+CNSTI4 35
+ASGNI4
+ADDRGP4 s_controls+6252+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+6252+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+6316
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+6316+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+6316+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+6316+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+6316+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_controls+6376
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+6376+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+6376+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+6376+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+6376+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_controls+6888
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+6888+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+6888+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+6888+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+6888+8
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+6764
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+6764+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+6764+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+6764+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+6764+8
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+6496
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+6496+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+6496+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+6496+4
+ADDRGP4 $1088
+ASGNP4
+ADDRGP4 s_controls+6496+8
+CNSTI4 36
+ASGNI4
+ADDRGP4 s_controls+6496+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+6496+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+6636
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+6636+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+6636+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+6636+4
+ADDRGP4 $1102
+ASGNP4
+ADDRGP4 s_controls+6636+8
+CNSTI4 42
+ASGNI4
+ADDRGP4 s_controls+6636+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+6636+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+6700
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+6700+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+6700+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+6700+4
+ADDRGP4 $1116
+ASGNP4
+ADDRGP4 s_controls+6700+8
+CNSTI4 37
+ASGNI4
+ADDRGP4 s_controls+6700+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+6700+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+6824
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+6824+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+6824+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+6824+4
+ADDRGP4 $1130
+ASGNP4
+ADDRGP4 s_controls+6824+8
+CNSTI4 38
+ASGNI4
+ADDRGP4 s_controls+6824+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+6824+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+6560
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+6560+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+6560+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+6560+4
+ADDRGP4 $1144
+ASGNP4
+ADDRGP4 s_controls+6560+8
+CNSTI4 39
+ASGNI4
+ADDRGP4 s_controls+6560+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+6560+60
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 s_controls+6560+64
+CNSTF4 1106247680
+ASGNF4
+ADDRGP4 s_controls+6560+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+6436
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+6436+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+6436+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+6436+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+6436+8
+CNSTI4 29
+ASGNI4
+ADDRGP4 s_controls+8084
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+8084+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+8084+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+8084+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+8084+8
+CNSTI4 30
+ASGNI4
+ADDRGP4 s_controls+8144
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+8144+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+8144+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+8144+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+8144+8
+CNSTI4 31
+ASGNI4
+ADDRGP4 s_controls+8204
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+8204+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+8204+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+8204+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+8204+8
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_controls+8264
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+8264+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+8264+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+8264+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+8264+8
+CNSTI4 33
+ASGNI4
+ADDRGP4 s_controls+8324
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+8324+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+8324+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+8324+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+8324+8
+CNSTI4 34
+ASGNI4
+ADDRGP4 s_controls+8384
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+8384+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+8384+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+8384+4
+ADDRGP4 $1216
+ASGNP4
+ADDRGP4 s_controls+8384+8
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_controls+8384+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+8384+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+8448
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+8448+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+8448+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+8448+4
+ADDRGP4 $1230
+ASGNP4
+ADDRGP4 s_controls+8448+8
+CNSTI4 41
+ASGNI4
+ADDRGP4 s_controls+8448+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+8448+60
+CNSTF4 1028443341
+ASGNF4
+ADDRGP4 s_controls+8448+64
+CNSTF4 1061158912
+ASGNF4
+ADDRGP4 s_controls+8448+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+8724
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+8724+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_controls+8724+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+8724+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_controls+8724+60
+ADDRGP4 $654
+ASGNP4
+ADDRGP4 s_controls+8724+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+8724+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4128
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4200
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4376
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+8724
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4464
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4608
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6560
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6636
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6496
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6072
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6132
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6192
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6252
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6316
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6376
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+8384
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+8448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6700
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5292
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4752
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4812
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4872
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4932
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4992
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5052
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5112
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5172
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5232
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5892
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6012
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5952
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6824
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5412
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5352
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5472
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5532
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5592
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5652
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5712
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5772
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5832
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6764
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6888
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+6436
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+8084
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+8144
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+8204
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+8264
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+8324
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+8636
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $1307
+ARGP4
+ADDRGP4 s_controls+8724+60
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_controls+8724+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 Controls_InitCvars
+CALLV
+pop
+ADDRGP4 Controls_GetConfig
+CALLV
+pop
+ADDRGP4 Controls_InitModel
+CALLV
+pop
+ADDRGP4 Controls_InitWeapons
+CALLV
+pop
+ADDRGP4 s_controls+8524
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $653
+endproc Controls_MenuInit 0 12
+export Controls_Cache
+proc Controls_Cache 0 4
+ADDRGP4 $775
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $792
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $675
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $689
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1313
+endproc Controls_Cache 0 4
+export UI_ControlsMenu
+proc UI_ControlsMenu 0 4
+ADDRGP4 Controls_MenuInit
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1314
+endproc UI_ControlsMenu 0 4
+bss
+align 4
+LABELV s_controls
+skip 8796
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_DrawConsoleLinesOver
+import trap_OpenWolfcamDirectory
+import trap_OpenQuakeLiveDirectory
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import ScrollList_Init
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_doubleClickTime
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1307
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1230
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $1216
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1144
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1130
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1116
+byte 1 97
+byte 1 108
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1102
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1088
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1038
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $792
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $775
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $767
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 67
+byte 1 0
+align 1
+LABELV $749
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $731
+byte 1 77
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 0
+align 1
+LABELV $713
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 75
+byte 1 0
+align 1
+LABELV $689
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $675
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $667
+byte 1 67
+byte 1 79
+byte 1 78
+byte 1 84
+byte 1 82
+byte 1 79
+byte 1 76
+byte 1 83
+byte 1 0
+align 1
+LABELV $610
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 32
+byte 1 84
+byte 1 79
+byte 1 32
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 83
+byte 1 63
+byte 1 0
+align 1
+LABELV $586
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $585
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $570
+byte 1 0
+align 1
+LABELV $493
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $418
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $416
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $410
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $409
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $408
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 65
+byte 1 80
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $401
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $397
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $151
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $150
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $149
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $148
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $147
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $146
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $145
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $144
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $143
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $142
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $141
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $140
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $139
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $138
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $137
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $136
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $135
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $134
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $133
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $132
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $131
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $130
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $129
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $128
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $127
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $126
+byte 1 43
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $125
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $124
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 57
+byte 1 0
+align 1
+LABELV $123
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $122
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 56
+byte 1 0
+align 1
+LABELV $121
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $120
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 55
+byte 1 0
+align 1
+LABELV $119
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $118
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 54
+byte 1 0
+align 1
+LABELV $117
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $116
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 53
+byte 1 0
+align 1
+LABELV $115
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $114
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 52
+byte 1 0
+align 1
+LABELV $113
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $112
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $111
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $110
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 50
+byte 1 0
+align 1
+LABELV $109
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $108
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $107
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $106
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $105
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $104
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $103
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $102
+byte 1 43
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $101
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $100
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $99
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $98
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $97
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $96
+byte 1 43
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $95
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $94
+byte 1 43
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $93
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $92
+byte 1 43
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $91
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $90
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $89
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $88
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $87
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $86
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $85
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $84
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $83
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $82
+byte 1 43
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $81
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $80
+byte 1 43
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $79
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 0
+align 1
+LABELV $78
+byte 1 43
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $77
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $76
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $75
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $74
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
@@ -0,0 +1,4307 @@
+export UI_Alloc
+code
+proc UI_Alloc 12 0
+ADDRGP4 allocPoint
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 131072
+LEI4 $72
+ADDRGP4 outOfMemory
+CNSTI4 1
+ASGNI4
+CNSTP4 0
+RETP4
+ADDRGP4 $71
+JUMPV
+LABELV $72
+ADDRLP4 4
+ADDRGP4 allocPoint
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRGP4 memoryPool
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 31
+ADDI4
+CNSTI4 -32
+BANDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $71
+endproc UI_Alloc 12 0
+export UI_InitMemory
+proc UI_InitMemory 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 allocPoint
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 outOfMemory
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $74
+endproc UI_InitMemory 4 0
+export UI_ParseInfos
+proc UI_ParseInfos 2084 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+CNSTI4 0
+ASGNI4
+ADDRGP4 $77
+JUMPV
+LABELV $76
+ADDRFP4 0
+ARGP4
+ADDRLP4 2056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $79
+ADDRGP4 $78
+JUMPV
+LABELV $79
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 2060
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+EQI4 $81
+ADDRGP4 $84
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $78
+JUMPV
+LABELV $81
+ADDRLP4 2052
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $85
+ADDRGP4 $87
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $78
+JUMPV
+LABELV $85
+ADDRLP4 1028
+CNSTI1 0
+ASGNI1
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRFP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 2064
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $91
+ADDRGP4 $93
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $90
+JUMPV
+LABELV $91
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $94
+ADDRGP4 $90
+JUMPV
+LABELV $94
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 2072
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $97
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $97
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $89
+ADDRGP4 $88
+JUMPV
+LABELV $90
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2064
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 $100
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 $101
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2072
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2064
+INDIRU4
+ADDRLP4 2068
+INDIRU4
+ADDU4
+ADDRLP4 2076
+INDIRU4
+ADDU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 2080
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 2080
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $102
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 2052
+ADDRLP4 2052
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $102
+LABELV $77
+ADDRGP4 $76
+JUMPV
+LABELV $78
+ADDRLP4 2052
+INDIRI4
+RETI4
+LABELV $75
+endproc UI_ParseInfos 2084 12
+proc UI_LoadArenasFromFile 16408 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16392
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16392
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $105
+ADDRGP4 $107
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $104
+JUMPV
+LABELV $105
+ADDRLP4 0
+INDIRI4
+CNSTI4 16384
+LTI4 $108
+ADDRGP4 $110
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 16384
+ARGI4
+ADDRLP4 16396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $104
+JUMPV
+LABELV $108
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 16396
+ADDRGP4 ui_numArenas
+ASGNP4
+ADDRLP4 16400
+ADDRLP4 16396
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 16400
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 16400
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+ARGP4
+ADDRLP4 16404
+ADDRGP4 UI_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 16396
+INDIRP4
+ADDRLP4 16400
+INDIRI4
+ADDRLP4 16404
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $104
+endproc UI_LoadArenasFromFile 16408 16
+proc UI_LoadArenas 4576 16
+ADDRGP4 ui_numArenas
+CNSTI4 0
+ASGNI4
+ADDRLP4 168
+ARGP4
+ADDRGP4 $112
+ARGP4
+ADDRGP4 $113
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 168+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $114
+ADDRLP4 168+16
+ARGP4
+ADDRGP4 UI_LoadArenasFromFile
+CALLV
+pop
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRGP4 $118
+ARGP4
+ADDRGP4 UI_LoadArenasFromFile
+CALLV
+pop
+LABELV $115
+ADDRGP4 $119
+ARGP4
+ADDRGP4 $120
+ARGP4
+ADDRLP4 440
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 4536
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 4536
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 440
+ASGNP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $124
+JUMPV
+LABELV $121
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4540
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+ADDRLP4 4540
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 $125
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 UI_LoadArenasFromFile
+CALLV
+pop
+LABELV $122
+ADDRLP4 4540
+CNSTI4 1
+ASGNI4
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+ADDRLP4 4540
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 144
+INDIRI4
+ADDRLP4 4540
+INDIRI4
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $124
+ADDRLP4 140
+INDIRI4
+ADDRLP4 152
+INDIRI4
+LTI4 $121
+ADDRGP4 $126
+ARGP4
+ADDRGP4 ui_numArenas
+INDIRI4
+ARGI4
+ADDRLP4 4544
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4544
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 outOfMemory
+INDIRI4
+CNSTI4 0
+EQI4 $127
+ADDRGP4 $129
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $127
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $130
+ADDRGP4 $135
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4548
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 4548
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $131
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $133
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $130
+ADDRLP4 4548
+CNSTI4 0
+ASGNI4
+ADDRGP4 ui_numSinglePlayerArenas
+ADDRLP4 4548
+INDIRI4
+ASGNI4
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+ADDRLP4 4548
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4548
+INDIRI4
+ASGNI4
+ADDRGP4 $139
+JUMPV
+LABELV $136
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $140
+ARGP4
+ADDRLP4 4552
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4552
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $141
+ADDRGP4 $137
+JUMPV
+LABELV $141
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 4556
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 4556
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $143
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 4560
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 4560
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $147
+ADDRLP4 4564
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+ASGNP4
+ADDRLP4 4564
+INDIRP4
+ADDRLP4 4564
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $137
+JUMPV
+LABELV $147
+ADDRLP4 4564
+ADDRGP4 ui_numSinglePlayerArenas
+ASGNP4
+ADDRLP4 4564
+INDIRP4
+ADDRLP4 4564
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $143
+LABELV $137
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $139
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $136
+ADDRLP4 0
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+CNSTI4 4
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $149
+ADDRLP4 4552
+ADDRGP4 ui_numSinglePlayerArenas
+ASGNP4
+ADDRLP4 4552
+INDIRP4
+ADDRLP4 4552
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $151
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 4560
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4560
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $149
+ADDRLP4 4552
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+ADDRLP4 4552
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 160
+INDIRI4
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 164
+INDIRI4
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4552
+INDIRI4
+ASGNI4
+ADDRGP4 $155
+JUMPV
+LABELV $152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $140
+ARGP4
+ADDRLP4 4556
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4556
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $156
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 4560
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 4560
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $158
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 4564
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 4564
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $160
+ADDRGP4 $135
+ARGP4
+ADDRLP4 4568
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 4568
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4568
+INDIRI4
+ARGI4
+ADDRLP4 4572
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 4572
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $153
+JUMPV
+LABELV $160
+ADDRGP4 $135
+ARGP4
+ADDRLP4 4568
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 4568
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4568
+INDIRI4
+ARGI4
+ADDRLP4 4572
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 4572
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $153
+JUMPV
+LABELV $158
+LABELV $156
+ADDRGP4 $135
+ARGP4
+ADDRLP4 4560
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 4560
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4560
+INDIRI4
+ARGI4
+ADDRLP4 4564
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 4564
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $153
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $155
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $152
+LABELV $111
+endproc UI_LoadArenas 4576 16
+export UI_GetArenaInfoByNumber
+proc UI_GetArenaInfoByNumber 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $165
+ADDRFP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $163
+LABELV $165
+ADDRGP4 $166
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $162
+JUMPV
+LABELV $163
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $167
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $171
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $171
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $162
+JUMPV
+LABELV $171
+LABELV $168
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $170
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $167
+CNSTP4 0
+RETP4
+LABELV $162
+endproc UI_GetArenaInfoByNumber 24 8
+export UI_GetArenaInfoByMap
+proc UI_GetArenaInfoByMap 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $177
+JUMPV
+LABELV $174
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $180
+ARGP4
+ADDRLP4 4
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $178
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $173
+JUMPV
+LABELV $178
+LABELV $175
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $177
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $174
+CNSTP4 0
+RETP4
+LABELV $173
+endproc UI_GetArenaInfoByMap 12 8
+export UI_GetSpecialArenaInfo
+proc UI_GetSpecialArenaInfo 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $185
+JUMPV
+LABELV $182
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 4
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $186
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $181
+JUMPV
+LABELV $186
+LABELV $183
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $185
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $182
+CNSTP4 0
+RETP4
+LABELV $181
+endproc UI_GetSpecialArenaInfo 12 8
+proc UI_LoadBotsFromFile 16408 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16392
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16392
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $189
+ADDRGP4 $107
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $188
+JUMPV
+LABELV $189
+ADDRLP4 0
+INDIRI4
+CNSTI4 16384
+LTI4 $191
+ADDRGP4 $110
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 16384
+ARGI4
+ADDRLP4 16396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $188
+JUMPV
+LABELV $191
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 16396
+ADDRGP4 ui_numBots
+ASGNP4
+ADDRLP4 16400
+ADDRLP4 16396
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 16400
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 16400
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+ARGP4
+ADDRLP4 16404
+ADDRGP4 UI_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 16396
+INDIRP4
+ADDRLP4 16400
+INDIRI4
+ADDRLP4 16404
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 outOfMemory
+INDIRI4
+CNSTI4 0
+EQI4 $193
+ADDRGP4 $195
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $193
+LABELV $188
+endproc UI_LoadBotsFromFile 16408 16
+proc UI_LoadBots 1452 16
+ADDRGP4 ui_numBots
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRGP4 $113
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 144+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $198
+ADDRLP4 144+16
+ARGP4
+ADDRGP4 UI_LoadBotsFromFile
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRGP4 $202
+ARGP4
+ADDRGP4 UI_LoadBotsFromFile
+CALLV
+pop
+LABELV $199
+ADDRGP4 $119
+ARGP4
+ADDRGP4 $203
+ARGP4
+ADDRLP4 416
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1440
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1440
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 416
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $207
+JUMPV
+LABELV $204
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1444
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 136
+ADDRLP4 1444
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $125
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_LoadBotsFromFile
+CALLV
+pop
+LABELV $205
+ADDRLP4 1444
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+ADDRLP4 1444
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+ADDRLP4 1444
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $207
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $204
+ADDRGP4 $208
+ARGP4
+ADDRGP4 ui_numBots
+INDIRI4
+ARGI4
+ADDRLP4 1448
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1448
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $196
+endproc UI_LoadBots 1452 16
+export UI_GetBotInfoByNumber
+proc UI_GetBotInfoByNumber 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $212
+ADDRFP4 0
+INDIRI4
+ADDRGP4 ui_numBots
+INDIRI4
+LTI4 $210
+LABELV $212
+ADDRGP4 $213
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $209
+JUMPV
+LABELV $210
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+INDIRP4
+RETP4
+LABELV $209
+endproc UI_GetBotInfoByNumber 8 8
+export UI_GetBotInfoByName
+proc UI_GetBotInfoByName 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $218
+JUMPV
+LABELV $215
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 8
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $220
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $214
+JUMPV
+LABELV $220
+LABELV $216
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $218
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numBots
+INDIRI4
+LTI4 $215
+CNSTP4 0
+RETP4
+LABELV $214
+endproc UI_GetBotInfoByName 16 8
+export UI_GetBestScore
+proc UI_GetBestScore 1088 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+CNSTU4 0
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 1056
+INDIRU4
+EQU4 $225
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 1056
+INDIRU4
+NEU4 $223
+LABELV $225
+ADDRGP4 $222
+JUMPV
+LABELV $223
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $228
+ADDRFP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LEI4 $226
+LABELV $228
+ADDRGP4 $222
+JUMPV
+LABELV $226
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $229
+ADDRGP4 $233
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $234
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $237
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LEI4 $235
+LABELV $237
+ADDRGP4 $230
+JUMPV
+LABELV $235
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $240
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $238
+LABELV $240
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $238
+LABELV $230
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LEI4 $229
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+LABELV $222
+endproc UI_GetBestScore 1088 16
+export UI_SetBestScore
+proc UI_SetBestScore 1084 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $244
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+LEI4 $242
+LABELV $244
+ADDRGP4 $241
+JUMPV
+LABELV $242
+ADDRGP4 $245
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1052
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $248
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $246
+LABELV $248
+ADDRGP4 $241
+JUMPV
+LABELV $246
+ADDRGP4 $233
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $234
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $249
+ADDRLP4 1044
+INDIRI4
+ADDRFP4 4
+INDIRI4
+GTI4 $249
+ADDRGP4 $241
+JUMPV
+LABELV $249
+ADDRGP4 $135
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1076
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1076
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $233
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1080
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1080
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $241
+endproc UI_SetBestScore 1084 16
+export UI_LogAwardData
+proc UI_LogAwardData 1056 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $252
+ADDRGP4 $251
+JUMPV
+LABELV $252
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $254
+ADDRGP4 $256
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $254
+ADDRGP4 $257
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $258
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRGP4 $135
+ARGP4
+ADDRLP4 1040
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 1052
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $257
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $251
+endproc UI_LogAwardData 1056 16
+export UI_GetAwardLevel
+proc UI_GetAwardLevel 1048 16
+ADDRGP4 $257
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $258
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+RETI4
+LABELV $259
+endproc UI_GetAwardLevel 1048 16
+export UI_TierCompleted
+proc UI_TierCompleted 60 12
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 UI_GetNumSPTiers
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $261
+ADDRGP4 $263
+ARGP4
+ADDRLP4 32
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $264
+CNSTI4 0
+RETI4
+ADDRGP4 $260
+JUMPV
+LABELV $264
+ADDRGP4 $266
+ARGP4
+ADDRLP4 44
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $269
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $267
+LABELV $269
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+RETI4
+ADDRGP4 $260
+JUMPV
+LABELV $267
+CNSTI4 -1
+RETI4
+ADDRGP4 $260
+JUMPV
+LABELV $261
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $270
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $274
+CNSTI4 -1
+RETI4
+ADDRGP4 $260
+JUMPV
+LABELV $274
+LABELV $271
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $270
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+RETI4
+LABELV $260
+endproc UI_TierCompleted 60 12
+export UI_ShowTierVideo
+proc UI_ShowTierVideo 1052 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $277
+CNSTI4 0
+RETI4
+ADDRGP4 $276
+JUMPV
+LABELV $277
+ADDRGP4 $279
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $280
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $281
+CNSTI4 0
+RETI4
+ADDRGP4 $276
+JUMPV
+LABELV $281
+ADDRGP4 $135
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $279
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $276
+endproc UI_ShowTierVideo 1052 16
+export UI_CanShowTierVideo
+proc UI_CanShowTierVideo 1048 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $284
+CNSTI4 0
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $284
+ADDRGP4 uis+19676
+INDIRI4
+CNSTI4 0
+EQI4 $286
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+EQI4 $286
+CNSTI4 0
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $286
+ADDRGP4 $279
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $280
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $289
+CNSTI4 1
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $289
+CNSTI4 0
+RETI4
+LABELV $283
+endproc UI_CanShowTierVideo 1048 16
+export UI_GetCurrentGame
+proc UI_GetCurrentGame 32 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $263
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $292
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $296
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LEI4 $294
+LABELV $296
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $291
+JUMPV
+LABELV $294
+LABELV $292
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $300
+JUMPV
+LABELV $297
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $303
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+LEI4 $301
+LABELV $303
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $291
+JUMPV
+LABELV $301
+LABELV $298
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $300
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+LTI4 $297
+ADDRGP4 $266
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $304
+CNSTI4 -1
+RETI4
+ADDRGP4 $291
+JUMPV
+LABELV $304
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+LABELV $291
+endproc UI_GetCurrentGame 32 12
+export UI_NewGame
+proc UI_NewGame 0 8
+ADDRGP4 $307
+ARGP4
+ADDRGP4 $113
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $308
+ARGP4
+ADDRGP4 $113
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $309
+ARGP4
+ADDRGP4 $113
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $310
+ARGP4
+ADDRGP4 $113
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $311
+ARGP4
+ADDRGP4 $113
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $257
+ARGP4
+ADDRGP4 $113
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $279
+ARGP4
+ADDRGP4 $113
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $306
+endproc UI_NewGame 0 8
+export UI_GetNumArenas
+proc UI_GetNumArenas 0 0
+ADDRGP4 ui_numArenas
+INDIRI4
+RETI4
+LABELV $312
+endproc UI_GetNumArenas 0 0
+export UI_GetNumSPArenas
+proc UI_GetNumSPArenas 0 0
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+RETI4
+LABELV $313
+endproc UI_GetNumSPArenas 0 0
+export UI_GetNumSPTiers
+proc UI_GetNumSPTiers 0 0
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+CNSTI4 4
+DIVI4
+RETI4
+LABELV $314
+endproc UI_GetNumSPTiers 0 0
+export UI_GetNumBots
+proc UI_GetNumBots 0 0
+ADDRGP4 ui_numBots
+INDIRI4
+RETI4
+LABELV $315
+endproc UI_GetNumBots 0 0
+export UI_SPUnlock_f
+proc UI_SPUnlock_f 1048 16
+ADDRGP4 $307
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $320
+JUMPV
+LABELV $317
+ADDRLP4 8
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $234
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $318
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $320
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+INDIRI4
+ADDI4
+LTI4 $317
+ADDRGP4 $307
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $322
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ShowTierVideo
+CALLI4
+pop
+LABELV $323
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LEI4 $322
+ADDRGP4 $326
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu_ReInit
+CALLV
+pop
+LABELV $316
+endproc UI_SPUnlock_f 1048 16
+export UI_SPUnlockMedals_f
+proc UI_SPUnlockMedals_f 1044 16
+ADDRGP4 $257
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $328
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $258
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $332
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $329
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $328
+ADDRGP4 $257
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $333
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $327
+endproc UI_SPUnlockMedals_f 1044 16
+export UI_InitGameinfo
+proc UI_InitGameinfo 0 0
+ADDRGP4 UI_InitMemory
+CALLV
+pop
+ADDRGP4 UI_LoadArenas
+CALLV
+pop
+ADDRGP4 UI_LoadBots
+CALLV
+pop
+ADDRGP4 uis+19676
+CNSTI4 0
+ASGNI4
+LABELV $334
+endproc UI_InitGameinfo 0 0
+bss
+align 4
+LABELV outOfMemory
+skip 4
+align 4
+LABELV allocPoint
+skip 4
+align 1
+LABELV memoryPool
+skip 131072
+align 4
+LABELV ui_numSpecialSinglePlayerArenas
+skip 4
+align 4
+LABELV ui_numSinglePlayerArenas
+skip 4
+align 4
+LABELV ui_arenaInfos
+skip 4096
+align 4
+LABELV ui_numArenas
+skip 4
+align 4
+LABELV ui_botInfos
+skip 4096
+export ui_numBots
+align 4
+LABELV ui_numBots
+skip 4
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_DrawConsoleLinesOver
+import trap_OpenWolfcamDirectory
+import trap_OpenQuakeLiveDirectory
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import ScrollList_Init
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_doubleClickTime
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $333
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $332
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $326
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $321
+byte 1 49
+byte 1 0
+align 1
+LABELV $311
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 53
+byte 1 0
+align 1
+LABELV $310
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 52
+byte 1 0
+align 1
+LABELV $309
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 51
+byte 1 0
+align 1
+LABELV $308
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $307
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $280
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $279
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 86
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $266
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $263
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $258
+byte 1 97
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $257
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $256
+byte 1 94
+byte 1 49
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 76
+byte 1 111
+byte 1 103
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 68
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 10
+byte 1 0
+align 1
+LABELV $245
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $234
+byte 1 108
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $233
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $219
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $213
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $208
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $203
+byte 1 46
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $202
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $197
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $195
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $180
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $166
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $151
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $146
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $145
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $140
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $135
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $134
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $129
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $126
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $125
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $120
+byte 1 46
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $119
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $118
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $113
+byte 1 0
+align 1
+LABELV $112
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $110
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $107
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $101
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $100
+byte 1 92
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 92
+byte 1 0
+align 1
+LABELV $99
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
+align 1
+LABELV $96
+byte 1 125
+byte 1 0
+align 1
+LABELV $93
+byte 1 85
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $87
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $84
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 123
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $83
+byte 1 123
+byte 1 0
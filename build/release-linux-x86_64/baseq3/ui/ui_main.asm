@@ -0,0 +1,2048 @@
+export vmMain
+code
+proc vmMain 16 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $72
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+GTI4 $72
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $86
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $86
+address $74
+address $75
+address $76
+address $77
+address $78
+address $79
+address $80
+address $81
+address $82
+address $83
+address $84
+address $85
+code
+LABELV $74
+CNSTI4 4
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $75
+ADDRGP4 UI_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $76
+ADDRGP4 UI_Shutdown
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $77
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_KeyEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $78
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_MouseEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $79
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_Refresh
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $80
+ADDRLP4 4
+ADDRGP4 UI_IsFullscreen
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $81
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_SetActiveMenu
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $82
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $83
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawConnectScreen
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $84
+CNSTI4 1
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $85
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+CNSTF4 1132396544
+ASGNF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ARGF4
+ADDRGP4 Q_SetColorTable
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $72
+CNSTI4 -1
+RETI4
+LABELV $71
+endproc vmMain 16 20
+data
+align 4
+LABELV cvarTable
+address ui_ffa_fraglimit
+address $88
+address $89
+byte 4 1
+address ui_ffa_timelimit
+address $90
+address $91
+byte 4 1
+address ui_tourney_fraglimit
+address $92
+address $91
+byte 4 1
+address ui_tourney_timelimit
+address $93
+address $94
+byte 4 1
+address ui_team_fraglimit
+address $95
+address $91
+byte 4 1
+address ui_team_timelimit
+address $96
+address $89
+byte 4 1
+address ui_team_friendly
+address $97
+address $98
+byte 4 1
+address ui_ctf_capturelimit
+address $99
+address $100
+byte 4 1
+address ui_ctf_timelimit
+address $101
+address $102
+byte 4 1
+address ui_ctf_friendly
+address $103
+address $91
+byte 4 1
+address ui_arenasFile
+address $104
+address $105
+byte 4 80
+address ui_botsFile
+address $106
+address $105
+byte 4 80
+address ui_spScores1
+address $107
+address $105
+byte 4 1
+address ui_spScores2
+address $108
+address $105
+byte 4 1
+address ui_spScores3
+address $109
+address $105
+byte 4 1
+address ui_spScores4
+address $110
+address $105
+byte 4 1
+address ui_spScores5
+address $111
+address $105
+byte 4 1
+address ui_spAwards
+address $112
+address $105
+byte 4 1
+address ui_spVideos
+address $113
+address $105
+byte 4 1
+address ui_spSkill
+address $114
+address $115
+byte 4 33
+address ui_spSelection
+address $116
+address $105
+byte 4 64
+address ui_browserMaster
+address $117
+address $98
+byte 4 1
+address ui_browserGameType
+address $118
+address $91
+byte 4 1
+address ui_browserSortKey
+address $119
+address $120
+byte 4 1
+address ui_browserShowFull
+address $121
+address $98
+byte 4 1
+address ui_browserShowEmpty
+address $122
+address $98
+byte 4 1
+address ui_brassTime
+address $123
+address $124
+byte 4 1
+address ui_drawCrosshair
+address $125
+address $126
+byte 4 1
+address ui_drawCrosshairNames
+address $127
+address $98
+byte 4 1
+address ui_marks
+address $128
+address $98
+byte 4 1
+address ui_server1
+address $129
+address $105
+byte 4 1
+address ui_server2
+address $130
+address $105
+byte 4 1
+address ui_server3
+address $131
+address $105
+byte 4 1
+address ui_server4
+address $132
+address $105
+byte 4 1
+address ui_server5
+address $133
+address $105
+byte 4 1
+address ui_server6
+address $134
+address $105
+byte 4 1
+address ui_server7
+address $135
+address $105
+byte 4 1
+address ui_server8
+address $136
+address $105
+byte 4 1
+address ui_server9
+address $137
+address $105
+byte 4 1
+address ui_server10
+address $138
+address $105
+byte 4 1
+address ui_server11
+address $139
+address $105
+byte 4 1
+address ui_server12
+address $140
+address $105
+byte 4 1
+address ui_server13
+address $141
+address $105
+byte 4 1
+address ui_server14
+address $142
+address $105
+byte 4 1
+address ui_server15
+address $143
+address $105
+byte 4 1
+address ui_server16
+address $144
+address $105
+byte 4 1
+address ui_cdkeychecked
+address $145
+address $91
+byte 4 64
+address ui_ioq3
+address $146
+address $98
+byte 4 64
+byte 4 0
+address $147
+address $105
+byte 4 0
+address ui_doubleClickTime
+address $148
+address $149
+byte 4 1
+align 4
+LABELV cvarTableSize
+byte 4 50
+export UI_RegisterCvars
+code
+proc UI_RegisterCvars 12 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $154
+JUMPV
+LABELV $151
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $152
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $154
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $151
+LABELV $150
+endproc UI_RegisterCvars 12 16
+export UI_UpdateCvars
+proc UI_UpdateCvars 8 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $159
+JUMPV
+LABELV $156
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $160
+ADDRGP4 $157
+JUMPV
+LABELV $160
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $157
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $159
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $156
+LABELV $155
+endproc UI_UpdateCvars 8 4
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_DrawConsoleLinesOver
+import trap_OpenWolfcamDirectory
+import trap_OpenQuakeLiveDirectory
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import ScrollList_Init
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+bss
+export ui_doubleClickTime
+align 4
+LABELV ui_doubleClickTime
+skip 272
+export ui_ioq3
+align 4
+LABELV ui_ioq3
+skip 272
+export ui_cdkeychecked
+align 4
+LABELV ui_cdkeychecked
+skip 272
+import ui_cdkey
+export ui_server16
+align 4
+LABELV ui_server16
+skip 272
+export ui_server15
+align 4
+LABELV ui_server15
+skip 272
+export ui_server14
+align 4
+LABELV ui_server14
+skip 272
+export ui_server13
+align 4
+LABELV ui_server13
+skip 272
+export ui_server12
+align 4
+LABELV ui_server12
+skip 272
+export ui_server11
+align 4
+LABELV ui_server11
+skip 272
+export ui_server10
+align 4
+LABELV ui_server10
+skip 272
+export ui_server9
+align 4
+LABELV ui_server9
+skip 272
+export ui_server8
+align 4
+LABELV ui_server8
+skip 272
+export ui_server7
+align 4
+LABELV ui_server7
+skip 272
+export ui_server6
+align 4
+LABELV ui_server6
+skip 272
+export ui_server5
+align 4
+LABELV ui_server5
+skip 272
+export ui_server4
+align 4
+LABELV ui_server4
+skip 272
+export ui_server3
+align 4
+LABELV ui_server3
+skip 272
+export ui_server2
+align 4
+LABELV ui_server2
+skip 272
+export ui_server1
+align 4
+LABELV ui_server1
+skip 272
+export ui_marks
+align 4
+LABELV ui_marks
+skip 272
+export ui_drawCrosshairNames
+align 4
+LABELV ui_drawCrosshairNames
+skip 272
+export ui_drawCrosshair
+align 4
+LABELV ui_drawCrosshair
+skip 272
+export ui_brassTime
+align 4
+LABELV ui_brassTime
+skip 272
+export ui_browserShowEmpty
+align 4
+LABELV ui_browserShowEmpty
+skip 272
+export ui_browserShowFull
+align 4
+LABELV ui_browserShowFull
+skip 272
+export ui_browserSortKey
+align 4
+LABELV ui_browserSortKey
+skip 272
+export ui_browserGameType
+align 4
+LABELV ui_browserGameType
+skip 272
+export ui_browserMaster
+align 4
+LABELV ui_browserMaster
+skip 272
+export ui_spSelection
+align 4
+LABELV ui_spSelection
+skip 272
+export ui_spSkill
+align 4
+LABELV ui_spSkill
+skip 272
+export ui_spVideos
+align 4
+LABELV ui_spVideos
+skip 272
+export ui_spAwards
+align 4
+LABELV ui_spAwards
+skip 272
+export ui_spScores5
+align 4
+LABELV ui_spScores5
+skip 272
+export ui_spScores4
+align 4
+LABELV ui_spScores4
+skip 272
+export ui_spScores3
+align 4
+LABELV ui_spScores3
+skip 272
+export ui_spScores2
+align 4
+LABELV ui_spScores2
+skip 272
+export ui_spScores1
+align 4
+LABELV ui_spScores1
+skip 272
+export ui_botsFile
+align 4
+LABELV ui_botsFile
+skip 272
+export ui_arenasFile
+align 4
+LABELV ui_arenasFile
+skip 272
+export ui_ctf_friendly
+align 4
+LABELV ui_ctf_friendly
+skip 272
+export ui_ctf_timelimit
+align 4
+LABELV ui_ctf_timelimit
+skip 272
+export ui_ctf_capturelimit
+align 4
+LABELV ui_ctf_capturelimit
+skip 272
+export ui_team_friendly
+align 4
+LABELV ui_team_friendly
+skip 272
+export ui_team_timelimit
+align 4
+LABELV ui_team_timelimit
+skip 272
+export ui_team_fraglimit
+align 4
+LABELV ui_team_fraglimit
+skip 272
+export ui_tourney_timelimit
+align 4
+LABELV ui_tourney_timelimit
+skip 272
+export ui_tourney_fraglimit
+align 4
+LABELV ui_tourney_fraglimit
+skip 272
+export ui_ffa_timelimit
+align 4
+LABELV ui_ffa_timelimit
+skip 272
+export ui_ffa_fraglimit
+align 4
+LABELV ui_ffa_fraglimit
+skip 272
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $149
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $148
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $147
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $146
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 105
+byte 1 111
+byte 1 113
+byte 1 51
+byte 1 0
+align 1
+LABELV $145
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $144
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 54
+byte 1 0
+align 1
+LABELV $143
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $142
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $141
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $140
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $139
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $138
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $137
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 57
+byte 1 0
+align 1
+LABELV $136
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 56
+byte 1 0
+align 1
+LABELV $135
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 55
+byte 1 0
+align 1
+LABELV $134
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 54
+byte 1 0
+align 1
+LABELV $133
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 53
+byte 1 0
+align 1
+LABELV $132
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 52
+byte 1 0
+align 1
+LABELV $131
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 51
+byte 1 0
+align 1
+LABELV $130
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $129
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $128
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $127
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $126
+byte 1 53
+byte 1 0
+align 1
+LABELV $125
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $124
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $123
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $122
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $121
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $120
+byte 1 52
+byte 1 0
+align 1
+LABELV $119
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $118
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $117
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $116
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $115
+byte 1 50
+byte 1 0
+align 1
+LABELV $114
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $113
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 86
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $112
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $111
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 53
+byte 1 0
+align 1
+LABELV $110
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 52
+byte 1 0
+align 1
+LABELV $109
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 51
+byte 1 0
+align 1
+LABELV $108
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $107
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $106
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $105
+byte 1 0
+align 1
+LABELV $104
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $103
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $102
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $101
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $100
+byte 1 56
+byte 1 0
+align 1
+LABELV $99
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $98
+byte 1 49
+byte 1 0
+align 1
+LABELV $97
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $96
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $95
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $94
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $93
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $92
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $91
+byte 1 48
+byte 1 0
+align 1
+LABELV $90
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $89
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $88
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
@@ -0,0 +1,2362 @@
+export MField_Draw
+code
+proc MField_Draw 1060 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 1048
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GTI4 $72
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $73
+JUMPV
+LABELV $72
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRI4
+LEI4 $74
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $76
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $76
+LABELV $74
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $73
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRI4
+LEI4 $78
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $78
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $80
+ADDRGP4 $82
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $80
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+NEI4 $83
+ADDRGP4 $71
+JUMPV
+LABELV $83
+ADDRLP4 1052
+ADDRGP4 trap_Key_GetOverstrikeMode
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $85
+ADDRLP4 1040
+CNSTI4 11
+ASGNI4
+ADDRGP4 $86
+JUMPV
+LABELV $85
+ADDRLP4 1040
+CNSTI4 10
+ASGNI4
+LABELV $86
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $87
+ADDRLP4 1036
+CNSTI4 8
+ASGNI4
+ADDRGP4 $88
+JUMPV
+LABELV $87
+ADDRFP4 12
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $89
+ADDRLP4 1036
+CNSTI4 32
+ASGNI4
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRLP4 1036
+CNSTI4 16
+ASGNI4
+LABELV $90
+LABELV $88
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $91
+ADDRLP4 12
+ARGP4
+ADDRLP4 1056
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 1056
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $92
+JUMPV
+LABELV $91
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $93
+ADDRLP4 12
+ARGP4
+ADDRLP4 1056
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 1056
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+LABELV $93
+LABELV $92
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRLP4 1036
+INDIRI4
+MULI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -4
+BANDI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $71
+endproc MField_Draw 1060 20
+export MField_Paste
+proc MField_Paste 76 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_GetClipboardData
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 68
+ADDRLP4 72
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $99
+JUMPV
+LABELV $96
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRGP4 MField_CharEvent
+CALLV
+pop
+LABELV $97
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $99
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $96
+LABELV $95
+endproc MField_Paste 76 8
+export MField_KeyDownEvent
+proc MField_KeyDownEvent 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 139
+EQI4 $103
+ADDRFP4 4
+INDIRI4
+CNSTI4 170
+NEI4 $101
+LABELV $103
+CNSTI4 138
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $101
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MField_Paste
+CALLV
+pop
+ADDRGP4 $100
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 140
+EQI4 $106
+ADDRFP4 4
+INDIRI4
+CNSTI4 171
+NEI4 $104
+LABELV $106
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GEI4 $100
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $100
+JUMPV
+LABELV $104
+ADDRFP4 4
+INDIRI4
+CNSTI4 135
+EQI4 $111
+ADDRFP4 4
+INDIRI4
+CNSTI4 165
+NEI4 $109
+LABELV $111
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GEI4 $112
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $112
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+LTI4 $100
+ADDRLP4 28
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GTI4 $100
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $100
+JUMPV
+LABELV $109
+ADDRFP4 4
+INDIRI4
+CNSTI4 134
+EQI4 $118
+ADDRFP4 4
+INDIRI4
+CNSTI4 163
+NEI4 $116
+LABELV $118
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+LEI4 $119
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $119
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $100
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $100
+JUMPV
+LABELV $116
+ADDRFP4 4
+INDIRI4
+CNSTI4 143
+EQI4 $126
+ADDRFP4 4
+INDIRI4
+CNSTI4 160
+EQI4 $126
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 97
+NEI4 $123
+CNSTI4 137
+ARGI4
+ADDRLP4 36
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $123
+LABELV $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $100
+JUMPV
+LABELV $123
+ADDRFP4 4
+INDIRI4
+CNSTI4 144
+EQI4 $130
+ADDRFP4 4
+INDIRI4
+CNSTI4 166
+EQI4 $130
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 101
+NEI4 $127
+CNSTI4 137
+ARGI4
+ADDRLP4 48
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $127
+LABELV $130
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $100
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $100
+JUMPV
+LABELV $127
+ADDRFP4 4
+INDIRI4
+CNSTI4 139
+EQI4 $135
+ADDRFP4 4
+INDIRI4
+CNSTI4 170
+NEI4 $133
+LABELV $135
+ADDRLP4 60
+ADDRGP4 trap_Key_GetOverstrikeMode
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $137
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $138
+JUMPV
+LABELV $137
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $138
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 trap_Key_SetOverstrikeMode
+CALLV
+pop
+LABELV $133
+LABELV $100
+endproc MField_KeyDownEvent 64 12
+export MField_CharEvent
+proc MField_CharEvent 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 22
+NEI4 $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MField_Paste
+CALLV
+pop
+ADDRGP4 $139
+JUMPV
+LABELV $140
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $142
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 $139
+JUMPV
+LABELV $142
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $144
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+LEI4 $139
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 -1
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $139
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $139
+JUMPV
+LABELV $144
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $150
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $139
+JUMPV
+LABELV $150
+ADDRFP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $152
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $139
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $139
+JUMPV
+LABELV $152
+ADDRFP4 4
+INDIRI4
+CNSTI4 32
+GEI4 $156
+ADDRGP4 $139
+JUMPV
+LABELV $156
+ADDRLP4 8
+ADDRGP4 trap_Key_GetOverstrikeMode
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $158
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 255
+EQI4 $162
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $159
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $159
+LABELV $162
+ADDRGP4 $139
+JUMPV
+LABELV $158
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+EQI4 $165
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $163
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $163
+LABELV $165
+ADDRGP4 $139
+JUMPV
+LABELV $163
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $159
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $168
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $166
+LABELV $168
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $166
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $169
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $169
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+NEI4 $171
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $171
+LABELV $139
+endproc MField_CharEvent 36 12
+export MField_Clear
+proc MField_Clear 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $173
+endproc MField_Clear 0 0
+export MenuField_Init
+proc MenuField_Init 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 2
+BANDU4
+CNSTU4 0
+EQU4 $175
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $176
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $177
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 12
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $178
+JUMPV
+LABELV $177
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $178
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $174
+endproc MenuField_Init 32 4
+export MenuField_Draw
+proc MenuField_Draw 52 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 2
+BANDU4
+CNSTU4 0
+EQU4 $180
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+CNSTI4 16
+ASGNI4
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+CNSTI4 32
+ASGNI4
+LABELV $181
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+NEU4 $182
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $183
+JUMPV
+LABELV $182
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $184
+ADDRLP4 12
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $185
+JUMPV
+LABELV $184
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $186
+ADDRLP4 12
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRGP4 $187
+JUMPV
+LABELV $186
+ADDRLP4 12
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $187
+LABELV $185
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $188
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4097
+BORI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $190
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BORI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $190
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 MField_Draw
+CALLV
+pop
+LABELV $179
+endproc MenuField_Draw 52 20
+export MenuField_Key
+proc MenuField_Key 44 8
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 132
+EQI4 $194
+ADDRLP4 8
+CNSTI4 133
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $194
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GTI4 $206
+LABELV $205
+ADDRLP4 16
+CNSTI4 9
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $194
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $193
+LABELV $207
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $195
+ADDRGP4 $193
+JUMPV
+LABELV $206
+ADDRLP4 0
+INDIRI4
+CNSTI4 167
+EQI4 $194
+ADDRLP4 24
+CNSTI4 169
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $195
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $209
+LABELV $208
+ADDRLP4 0
+INDIRI4
+CNSTI4 161
+EQI4 $194
+ADDRGP4 $193
+JUMPV
+LABELV $209
+ADDRLP4 0
+INDIRI4
+CNSTI4 185
+LTI4 $193
+ADDRLP4 0
+INDIRI4
+CNSTI4 188
+GTI4 $193
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $210-740
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $210
+address $195
+address $195
+address $195
+address $195
+code
+LABELV $195
+ADDRFP4 4
+INDIRP4
+CNSTI4 9
+ASGNI4
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $197
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1025
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 524288
+BANDU4
+CNSTU4 0
+EQU4 $199
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Q_islower
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $199
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+ADDRGP4 $200
+JUMPV
+LABELV $199
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 262144
+BANDU4
+CNSTU4 0
+EQU4 $201
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 Q_isupper
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $201
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 -32
+SUBI4
+ASGNI4
+ADDRGP4 $202
+JUMPV
+LABELV $201
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 32
+BANDU4
+CNSTU4 0
+EQU4 $203
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 Q_isalpha
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $203
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $192
+JUMPV
+LABELV $203
+LABELV $202
+LABELV $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 MField_CharEvent
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 MField_KeyDownEvent
+CALLV
+pop
+LABELV $194
+CNSTI4 0
+RETI4
+LABELV $192
+endproc MenuField_Key 44 8
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_DrawConsoleLinesOver
+import trap_OpenWolfcamDirectory
+import trap_OpenQuakeLiveDirectory
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import ScrollList_Init
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_doubleClickTime
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $82
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 0
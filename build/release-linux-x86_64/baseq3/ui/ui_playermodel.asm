@@ -0,0 +1,3555 @@
+data
+align 4
+LABELV playermodel_artlist
+address $71
+address $72
+address $73
+address $74
+address $75
+address $76
+address $77
+address $78
+address $79
+address $80
+byte 4 0
+code
+proc PlayerModel_UpdateGrid 28 0
+ADDRLP4 4
+ADDRGP4 s_playermodel+41840
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $84
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_playermodel+9068
+INDIRI4
+GEI4 $88
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 s_playermodel+9072
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $89
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $85
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $84
+ADDRGP4 s_playermodel+41912
+INDIRI4
+CNSTI4 16
+DIVI4
+ADDRGP4 s_playermodel+41840
+INDIRI4
+NEI4 $106
+ADDRLP4 0
+ADDRGP4 s_playermodel+41912
+INDIRI4
+CNSTI4 16
+MODI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+LABELV $106
+ADDRGP4 s_playermodel+41844
+INDIRI4
+CNSTI4 1
+LEI4 $115
+ADDRGP4 s_playermodel+41840
+INDIRI4
+CNSTI4 0
+LEI4 $118
+ADDRLP4 12
+ADDRGP4 s_playermodel+7544+44
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $119
+JUMPV
+LABELV $118
+ADDRLP4 16
+ADDRGP4 s_playermodel+7544+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $119
+ADDRGP4 s_playermodel+41840
+INDIRI4
+ADDRGP4 s_playermodel+41844
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $125
+ADDRLP4 20
+ADDRGP4 s_playermodel+7632+44
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $116
+JUMPV
+LABELV $125
+ADDRLP4 24
+ADDRGP4 s_playermodel+7632+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 $116
+JUMPV
+LABELV $115
+ADDRLP4 12
+ADDRGP4 s_playermodel+7544+44
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 16
+ADDRGP4 s_playermodel+7632+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $116
+LABELV $82
+endproc PlayerModel_UpdateGrid 28 0
+proc PlayerModel_UpdateModel 32 28
+ADDRGP4 s_playermodel+7936
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1132
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+4
+CNSTF4 1125515264
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 s_playermodel+7936
+ARGP4
+ADDRGP4 s_playermodel+41848
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 s_playermodel+7936
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+LABELV $137
+endproc PlayerModel_UpdateModel 32 28
+proc PlayerModel_SaveChanges 0 8
+ADDRGP4 $147
+ARGP4
+ADDRGP4 s_playermodel+41848
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $149
+ARGP4
+ADDRGP4 s_playermodel+41848
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $151
+ARGP4
+ADDRGP4 s_playermodel+41848
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $153
+ARGP4
+ADDRGP4 s_playermodel+41848
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $146
+endproc PlayerModel_SaveChanges 0 8
+proc PlayerModel_MenuEvent 12 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $156
+ADDRGP4 $155
+JUMPV
+LABELV $156
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+EQI4 $161
+ADDRLP4 0
+INDIRI4
+CNSTI4 101
+EQI4 $166
+ADDRLP4 0
+INDIRI4
+CNSTI4 102
+EQI4 $172
+ADDRGP4 $158
+JUMPV
+LABELV $161
+ADDRGP4 s_playermodel+41840
+INDIRI4
+CNSTI4 0
+LEI4 $159
+ADDRLP4 8
+ADDRGP4 s_playermodel+41840
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 PlayerModel_UpdateGrid
+CALLV
+pop
+ADDRGP4 $159
+JUMPV
+LABELV $166
+ADDRGP4 s_playermodel+41840
+INDIRI4
+ADDRGP4 s_playermodel+41844
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $159
+ADDRLP4 8
+ADDRGP4 s_playermodel+41840
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 PlayerModel_UpdateGrid
+CALLV
+pop
+ADDRGP4 $159
+JUMPV
+LABELV $172
+ADDRGP4 PlayerModel_SaveChanges
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $158
+LABELV $159
+LABELV $155
+endproc PlayerModel_MenuEvent 12 0
+proc PlayerModel_MenuKey 52 8
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 134
+EQI4 $176
+ADDRLP4 12
+CNSTI4 135
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $185
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $199
+LABELV $198
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+EQI4 $197
+ADDRGP4 $174
+JUMPV
+LABELV $199
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 163
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $176
+ADDRLP4 16
+INDIRI4
+CNSTI4 165
+EQI4 $185
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $174
+LABELV $200
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $197
+ADDRGP4 $174
+JUMPV
+LABELV $176
+ADDRGP4 s_playermodel
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LTI4 $175
+ADDRLP4 28
+INDIRI4
+CNSTI4 15
+GTI4 $175
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $179
+ADDRLP4 32
+ADDRGP4 s_playermodel
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $173
+JUMPV
+LABELV $179
+ADDRGP4 s_playermodel+41840
+INDIRI4
+CNSTI4 0
+LEI4 $181
+ADDRLP4 32
+ADDRGP4 s_playermodel+41840
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 s_playermodel
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 PlayerModel_UpdateGrid
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $173
+JUMPV
+LABELV $181
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $173
+JUMPV
+LABELV $185
+ADDRGP4 s_playermodel
+ARGP4
+ADDRLP4 32
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $175
+ADDRLP4 36
+INDIRI4
+CNSTI4 15
+GTI4 $175
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 15
+GEI4 $188
+ADDRGP4 s_playermodel+41840
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+ADDRGP4 s_playermodel+9068
+INDIRI4
+GEI4 $188
+ADDRLP4 44
+ADDRGP4 s_playermodel
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $173
+JUMPV
+LABELV $188
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+NEI4 $192
+ADDRGP4 s_playermodel+41840
+INDIRI4
+ADDRGP4 s_playermodel+41844
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $192
+ADDRLP4 44
+ADDRGP4 s_playermodel+41840
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 s_playermodel
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 15
+SUBI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 PlayerModel_UpdateGrid
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $173
+JUMPV
+LABELV $192
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $173
+JUMPV
+LABELV $197
+ADDRGP4 PlayerModel_SaveChanges
+CALLV
+pop
+LABELV $174
+LABELV $175
+ADDRGP4 s_playermodel
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $173
+endproc PlayerModel_MenuKey 52 8
+proc PlayerModel_PicEvent 48 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $202
+ADDRGP4 $201
+JUMPV
+LABELV $202
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $204
+ADDRLP4 20
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+ADDRLP4 24
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+44
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $205
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $204
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 24
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+44
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 16
+ADDRGP4 s_playermodel+41840
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 28
+INDIRU4
+ADDRLP4 16
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 s_playermodel+9072
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 32
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $220
+ADDRGP4 s_playermodel+41848
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_playermodel+41848
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 5
+ADDP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+LEI4 $224
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+LABELV $224
+ADDRGP4 s_playermodel+7720+60
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_playermodel+7720+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 5
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 40
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+LEI4 $230
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+LABELV $230
+ADDRGP4 s_playermodel+7792+60
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 5
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_playermodel+7792+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 s_playermodel+41912
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 5242880
+LEI4 $237
+ADDRGP4 PlayerModel_UpdateModel
+CALLV
+pop
+LABELV $237
+LABELV $220
+LABELV $201
+endproc PlayerModel_PicEvent 48 12
+proc PlayerModel_DrawPlayer 12 24
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5242880
+GTI4 $240
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ARGI4
+ADDRGP4 $242
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $239
+JUMPV
+LABELV $240
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 s_playermodel+7936
+ARGP4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $239
+endproc PlayerModel_DrawPlayer 12 24
+proc PlayerModel_BuildList 4244 20
+ADDRGP4 $246
+ARGP4
+ADDRLP4 4196
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 4196
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_playermodel+41840
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_playermodel+9068
+CNSTI4 0
+ASGNI4
+ADDRGP4 $249
+ARGP4
+ADDRGP4 $250
+ARGP4
+ADDRLP4 2148
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 4200
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 2144
+ADDRLP4 4200
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 2148
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 $254
+JUMPV
+LABELV $251
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 4204
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 88
+ADDRLP4 4204
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $256
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 76
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $256
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 76
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $256
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 $260
+ARGP4
+ADDRLP4 4212
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4212
+INDIRI4
+CNSTI4 0
+EQI4 $262
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 4216
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4216
+INDIRI4
+CNSTI4 0
+NEI4 $258
+LABELV $262
+ADDRGP4 $252
+JUMPV
+LABELV $258
+ADDRGP4 $263
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 4220
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4220
+INDIRP4
+ARGP4
+ADDRGP4 $264
+ARGP4
+ADDRLP4 96
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 4224
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 4224
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 96
+ASGNP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $268
+JUMPV
+LABELV $265
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 4228
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 72
+ADDRLP4 4228
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $219
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 4232
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 4232
+INDIRI4
+CNSTI4 0
+NEI4 $270
+ADDRLP4 4240
+ADDRGP4 s_playermodel+9068
+ASGNP4
+ADDRLP4 4236
+ADDRLP4 4240
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4240
+INDIRP4
+ADDRLP4 4236
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4236
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 s_playermodel+9072
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $276
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $270
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $277
+ADDRGP4 $279
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4236
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4236
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $277
+LABELV $266
+ADDRLP4 4228
+CNSTI4 1
+ASGNI4
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+ADDRLP4 4228
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 72
+INDIRI4
+ADDRLP4 4228
+INDIRI4
+ADDI4
+ADDRLP4 64
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $268
+ADDRLP4 68
+INDIRI4
+ADDRLP4 80
+INDIRI4
+GEI4 $280
+ADDRGP4 s_playermodel+9068
+INDIRI4
+CNSTI4 256
+LTI4 $265
+LABELV $280
+LABELV $252
+ADDRLP4 4204
+CNSTI4 1
+ASGNI4
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+ADDRLP4 4204
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 88
+INDIRI4
+ADDRLP4 4204
+INDIRI4
+ADDI4
+ADDRLP4 76
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $254
+ADDRLP4 92
+INDIRI4
+ADDRLP4 2144
+INDIRI4
+GEI4 $281
+ADDRGP4 s_playermodel+9068
+INDIRI4
+CNSTI4 256
+LTI4 $251
+LABELV $281
+ADDRGP4 s_playermodel+41844
+ADDRGP4 s_playermodel+9068
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 s_playermodel+9068
+INDIRI4
+CNSTI4 16
+MODI4
+CNSTI4 0
+EQI4 $284
+ADDRLP4 4208
+ADDRGP4 s_playermodel+41844
+ASGNP4
+ADDRLP4 4208
+INDIRP4
+ADDRLP4 4208
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $284
+LABELV $245
+endproc PlayerModel_BuildList 4244 20
+proc PlayerModel_SetMenuItems 100 12
+ADDRGP4 $289
+ARGP4
+ADDRGP4 s_playermodel+7864+60
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_playermodel+7864+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 $147
+ARGP4
+ADDRGP4 s_playermodel+41848
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_playermodel+41848
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 80
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $295
+ADDRGP4 s_playermodel+41848
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $299
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $295
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $303
+JUMPV
+LABELV $300
+ADDRGP4 $218
+ARGP4
+ADDRLP4 84
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 84
+INDIRU4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 s_playermodel+9072
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 88
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $301
+ADDRLP4 16
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 5
+ADDP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $307
+ADDRGP4 s_playermodel+41848
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $308
+ADDRGP4 s_playermodel+41912
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_playermodel+41840
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+LEI4 $313
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+LABELV $313
+ADDRGP4 s_playermodel+7720+60
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_playermodel+7720+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 5
+ADDP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 96
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+LEI4 $319
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+LABELV $319
+ADDRGP4 s_playermodel+7792+60
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 5
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_playermodel+7792+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 $302
+JUMPV
+LABELV $308
+LABELV $301
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $303
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_playermodel+9068
+INDIRI4
+LTI4 $300
+LABELV $302
+LABELV $288
+endproc PlayerModel_SetMenuItems 100 12
+bss
+align 1
+LABELV $326
+skip 32
+align 1
+LABELV $327
+skip 32
+align 1
+LABELV $328
+skip 32
+code
+proc PlayerModel_MenuInit 28 12
+ADDRGP4 s_playermodel
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 41916
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 PlayerModel_Cache
+CALLV
+pop
+ADDRGP4 s_playermodel+4112
+ADDRGP4 PlayerModel_MenuKey
+ASGNP4
+ADDRGP4 s_playermodel+4116
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playermodel+4120
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playermodel+7208
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_playermodel+7208+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_playermodel+7208+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_playermodel+7208+60
+ADDRGP4 $339
+ASGNP4
+ADDRGP4 s_playermodel+7208+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_playermodel+7208+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playermodel+6944
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+6944+4
+ADDRGP4 $75
+ASGNP4
+ADDRGP4 s_playermodel+6944+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_playermodel+6944+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_playermodel+6944+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_playermodel+6944+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_playermodel+6944+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_playermodel+7032
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+7032+4
+ADDRGP4 $76
+ASGNP4
+ADDRGP4 s_playermodel+7032+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_playermodel+7032+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_playermodel+7032+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_playermodel+7032+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_playermodel+7032+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_playermodel+7120
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+7120+4
+ADDRGP4 $77
+ASGNP4
+ADDRGP4 s_playermodel+7120+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_playermodel+7120+12
+CNSTI4 50
+ASGNI4
+ADDRGP4 s_playermodel+7120+16
+CNSTI4 59
+ASGNI4
+ADDRGP4 s_playermodel+7120+76
+CNSTI4 274
+ASGNI4
+ADDRGP4 s_playermodel+7120+80
+CNSTI4 274
+ASGNI4
+ADDRLP4 8
+CNSTI4 59
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $386
+JUMPV
+LABELV $383
+ADDRLP4 4
+CNSTI4 50
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $387
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+44
+ADDP4
+CNSTU4 16388
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+76
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+80
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+60
+ADDP4
+ADDRGP4 $74
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+44
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+48
+ADDP4
+ADDRGP4 PlayerModel_PicEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+28
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+32
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+76
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+80
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+60
+ADDP4
+ADDRGP4 $73
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $388
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $387
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $384
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $386
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LTI4 $383
+ADDRGP4 s_playermodel+7864
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_playermodel+7864+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_playermodel+7864+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_playermodel+7864+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_playermodel+7864+60
+ADDRGP4 $326
+ASGNP4
+ADDRGP4 s_playermodel+7864+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playermodel+7864+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_playermodel+7720
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_playermodel+7720+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_playermodel+7720+12
+CNSTI4 497
+ASGNI4
+ADDRGP4 s_playermodel+7720+16
+CNSTI4 54
+ASGNI4
+ADDRGP4 s_playermodel+7720+60
+ADDRGP4 $327
+ASGNP4
+ADDRGP4 s_playermodel+7720+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playermodel+7720+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_playermodel+7792
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_playermodel+7792+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_playermodel+7792+12
+CNSTI4 497
+ASGNI4
+ADDRGP4 s_playermodel+7792+16
+CNSTI4 394
+ASGNI4
+ADDRGP4 s_playermodel+7792+60
+ADDRGP4 $328
+ASGNP4
+ADDRGP4 s_playermodel+7792+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playermodel+7792+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_playermodel+7368
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+7368+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_playermodel+7368+56
+ADDRGP4 PlayerModel_DrawPlayer
+ASGNP4
+ADDRGP4 s_playermodel+7368+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_playermodel+7368+16
+CNSTI4 -40
+ASGNI4
+ADDRGP4 s_playermodel+7368+76
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_playermodel+7368+80
+CNSTI4 560
+ASGNI4
+ADDRGP4 s_playermodel+7456
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+7456+4
+ADDRGP4 $78
+ASGNP4
+ADDRGP4 s_playermodel+7456+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_playermodel+7456+12
+CNSTI4 125
+ASGNI4
+ADDRGP4 s_playermodel+7456+16
+CNSTI4 340
+ASGNI4
+ADDRGP4 s_playermodel+7456+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_playermodel+7456+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_playermodel+7544
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+7544+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_playermodel+7544+48
+ADDRGP4 PlayerModel_MenuEvent
+ASGNP4
+ADDRGP4 s_playermodel+7544+8
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_playermodel+7544+12
+CNSTI4 125
+ASGNI4
+ADDRGP4 s_playermodel+7544+16
+CNSTI4 340
+ASGNI4
+ADDRGP4 s_playermodel+7544+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_playermodel+7544+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_playermodel+7544+60
+ADDRGP4 $79
+ASGNP4
+ADDRGP4 s_playermodel+7632
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+7632+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_playermodel+7632+48
+ADDRGP4 PlayerModel_MenuEvent
+ASGNP4
+ADDRGP4 s_playermodel+7632+8
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_playermodel+7632+12
+CNSTI4 186
+ASGNI4
+ADDRGP4 s_playermodel+7632+16
+CNSTI4 340
+ASGNI4
+ADDRGP4 s_playermodel+7632+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_playermodel+7632+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_playermodel+7632+60
+ADDRGP4 $80
+ASGNP4
+ADDRGP4 s_playermodel+7280
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+7280+4
+ADDRGP4 $71
+ASGNP4
+ADDRGP4 s_playermodel+7280+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_playermodel+7280+48
+ADDRGP4 PlayerModel_MenuEvent
+ASGNP4
+ADDRGP4 s_playermodel+7280+8
+CNSTI4 102
+ASGNI4
+ADDRGP4 s_playermodel+7280+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_playermodel+7280+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_playermodel+7280+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_playermodel+7280+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_playermodel+7280+60
+ADDRGP4 $72
+ASGNP4
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+7208
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+6944
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+7032
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+7120
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+7864
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+7720
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+7792
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $558
+ADDRGP4 s_playermodel
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+4128
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+5536
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $559
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+LTI4 $558
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+7368
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+7456
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+7544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+7632
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+7280
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 PlayerModel_SetMenuItems
+CALLV
+pop
+ADDRGP4 PlayerModel_UpdateGrid
+CALLV
+pop
+ADDRGP4 PlayerModel_UpdateModel
+CALLV
+pop
+LABELV $325
+endproc PlayerModel_MenuInit 28 12
+export PlayerModel_Cache
+proc PlayerModel_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $573
+JUMPV
+LABELV $570
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playermodel_artlist
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $571
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $573
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playermodel_artlist
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $570
+ADDRGP4 PlayerModel_BuildList
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $577
+JUMPV
+LABELV $574
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 s_playermodel+9072
+ADDP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $575
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $577
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_playermodel+9068
+INDIRI4
+LTI4 $574
+LABELV $569
+endproc PlayerModel_Cache 4 4
+export UI_PlayerModelMenu
+proc UI_PlayerModelMenu 0 8
+ADDRGP4 PlayerModel_MenuInit
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+CNSTI4 88
+ADDRGP4 s_playermodel+41912
+INDIRI4
+CNSTI4 16
+MODI4
+MULI4
+ADDRGP4 s_playermodel+4128
+ADDP4
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $580
+endproc UI_PlayerModelMenu 0 8
+bss
+align 4
+LABELV s_playermodel
+skip 41916
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_DrawConsoleLinesOver
+import trap_OpenWolfcamDirectory
+import trap_OpenQuakeLiveDirectory
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import ScrollList_Init
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_doubleClickTime
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $339
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 0
+align 1
+LABELV $299
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $289
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $279
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $276
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $264
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $263
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $261
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $260
+byte 1 46
+byte 1 0
+align 1
+LABELV $250
+byte 1 47
+byte 1 0
+align 1
+LABELV $249
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $246
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $242
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 32
+byte 1 77
+byte 1 69
+byte 1 77
+byte 1 79
+byte 1 82
+byte 1 89
+byte 1 0
+align 1
+LABELV $219
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 0
+align 1
+LABELV $218
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $153
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $151
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $149
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $147
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $80
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $79
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $78
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $77
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $76
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $75
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $74
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $73
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $72
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $71
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
@@ -0,0 +1,7234 @@
+code
+proc UI_PlayerInfo_SetWeapon 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $72
+ADDRFP4 0
+INDIRP4
+CNSTI4 1128
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 996
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $73
+ADDRGP4 $71
+JUMPV
+LABELV $73
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $78
+JUMPV
+LABELV $75
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $80
+ADDRGP4 $76
+JUMPV
+LABELV $80
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $82
+ADDRGP4 $77
+JUMPV
+LABELV $82
+LABELV $76
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $78
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $75
+LABELV $77
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $84
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 996
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $84
+ADDRFP4 0
+INDIRP4
+CNSTI4 996
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $86
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $88
+ADDRFP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $72
+JUMPV
+LABELV $88
+ADDRFP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $72
+JUMPV
+LABELV $86
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $93
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $93
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+NEI4 $90
+LABELV $93
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $90
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $95
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+LTI4 $96
+ADDRLP4 76
+INDIRI4
+CNSTI4 10
+GTI4 $96
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $109-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $109
+address $99
+address $100
+address $101
+address $102
+address $103
+address $104
+address $105
+address $106
+address $107
+address $108
+code
+LABELV $99
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $97
+JUMPV
+LABELV $100
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $97
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $97
+JUMPV
+LABELV $102
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $97
+JUMPV
+LABELV $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $97
+JUMPV
+LABELV $104
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $97
+JUMPV
+LABELV $105
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $97
+JUMPV
+LABELV $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $97
+JUMPV
+LABELV $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $97
+JUMPV
+LABELV $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $97
+LABELV $71
+endproc UI_PlayerInfo_SetWeapon 84 12
+proc UI_ForceLegsAnim 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 4
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 18
+NEI4 $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 1104
+ADDP4
+CNSTI4 1000
+ASGNI4
+LABELV $112
+LABELV $111
+endproc UI_ForceLegsAnim 8 0
+proc UI_SetLegsAnim 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $115
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $115
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+LABELV $114
+endproc UI_SetLegsAnim 4 8
+proc UI_ForceTorsoAnim 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 4
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+NEI4 $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+CNSTI4 2300
+ASGNI4
+LABELV $118
+ADDRFP4 4
+INDIRI4
+CNSTI4 7
+EQI4 $122
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $120
+LABELV $122
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+CNSTI4 500
+ASGNI4
+LABELV $120
+LABELV $117
+endproc UI_ForceTorsoAnim 12 0
+proc UI_SetTorsoAnim 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $124
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $124
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+LABELV $123
+endproc UI_SetTorsoAnim 4 8
+proc UI_TorsoSequencing 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+EQI4 $127
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+EQI4 $129
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+CNSTI4 300
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+LABELV $129
+LABELV $127
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $131
+ADDRGP4 $126
+JUMPV
+LABELV $131
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $133
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+ADDRGP4 $126
+JUMPV
+LABELV $133
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+EQI4 $137
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $135
+LABELV $137
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+ADDRGP4 $126
+JUMPV
+LABELV $135
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $138
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+CNSTI4 300
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+ADDRGP4 $126
+JUMPV
+LABELV $138
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+LABELV $140
+LABELV $126
+endproc UI_TorsoSequencing 16 8
+proc UI_LegsSequencing 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1104
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $143
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+NEI4 $142
+CNSTF4 1078530011
+CNSTI4 1000
+ADDRFP4 0
+INDIRP4
+CNSTI4 1104
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 jumpHeight
+CNSTF4 1113587712
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $142
+JUMPV
+LABELV $143
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+NEI4 $147
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 19
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1104
+ADDP4
+CNSTI4 130
+ASGNI4
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRGP4 $142
+JUMPV
+LABELV $147
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+NEI4 $149
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 22
+ARGI4
+ADDRGP4 UI_SetLegsAnim
+CALLV
+pop
+LABELV $149
+LABELV $142
+endproc UI_LegsSequencing 12 8
+proc UI_PositionEntityOnTag 84 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_CM_LerpTag
+CALLI4
+pop
+ADDRLP4 56
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $152
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $153
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $152
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 60
+CNSTI4 28
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 64
+CNSTI4 100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $151
+endproc UI_PositionEntityOnTag 84 24
+proc UI_PositionRotatedEntityOnTag 120 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_CM_LerpTag
+CALLI4
+pop
+ADDRLP4 92
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $158
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $159
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 52
+ARGP4
+ADDRLP4 96
+CNSTI4 28
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+LABELV $157
+endproc UI_PositionRotatedEntityOnTag 120 24
+proc UI_SetLerpFrameAnimation 12 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $166
+ADDRFP4 8
+INDIRI4
+CNSTI4 31
+LTI4 $164
+LABELV $166
+ADDRGP4 $167
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $164
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $163
+endproc UI_SetLerpFrameAnimation 12 8
+proc UI_RunLerpFrame 48 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $171
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $169
+LABELV $171
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_SetLerpFrameAnimation
+CALLV
+pop
+LABELV $169
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LTI4 $172
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $174
+ADDRGP4 $168
+JUMPV
+LABELV $174
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+GEI4 $176
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $177
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $178
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $178
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $180
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $182
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $183
+JUMPV
+LABELV $182
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $183
+LABELV $180
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $184
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $185
+JUMPV
+LABELV $184
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $186
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $186
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+MODI4
+SUBI4
+ASGNI4
+ADDRGP4 $187
+JUMPV
+LABELV $186
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $187
+LABELV $185
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LEI4 $188
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $188
+LABELV $172
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 dp_realtime
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $190
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $190
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 dp_realtime
+INDIRI4
+LEI4 $192
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $192
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $194
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $195
+JUMPV
+LABELV $194
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+LABELV $195
+LABELV $168
+endproc UI_RunLerpFrame 48 12
+proc UI_PlayerAnimation 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1104
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 uis
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1104
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 1104
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $197
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_LegsSequencing
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $199
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 22
+NEI4 $199
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRGP4 UI_RunLerpFrame
+CALLV
+pop
+ADDRGP4 $200
+JUMPV
+LABELV $199
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_RunLerpFrame
+CALLV
+pop
+LABELV $200
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 uis
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $201
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $201
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_TorsoSequencing
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_RunLerpFrame
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $196
+endproc UI_PlayerAnimation 16 12
+proc UI_SwingAngles 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $204
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GTF4 $208
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEGF4
+GEF4 $206
+LABELV $208
+ADDRFP4 20
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $206
+LABELV $204
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $209
+ADDRGP4 $203
+JUMPV
+LABELV $209
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+GEF4 $211
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+GEF4 $213
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+LABELV $214
+LABELV $212
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LTF4 $215
+ADDRLP4 8
+ADDRGP4 uis
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LTF4 $217
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $217
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $219
+ADDRLP4 8
+ADDRGP4 uis
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+NEGF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $221
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $221
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $219
+LABELV $216
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $223
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $224
+JUMPV
+LABELV $223
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $225
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $225
+LABELV $224
+LABELV $203
+endproc UI_SwingAngles 28 8
+proc UI_MovedirAdjustment 72 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1040
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1056
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1060
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1008981770
+GEF4 $230
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $230
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1008981770
+GEF4 $232
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+LABELV $232
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+NEF4 $236
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LEF4 $236
+CNSTF4 0
+RETF4
+ADDRGP4 $227
+JUMPV
+LABELV $236
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+GEF4 $239
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LEF4 $239
+CNSTF4 1102053376
+RETF4
+ADDRGP4 $227
+JUMPV
+LABELV $239
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+GEF4 $242
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $242
+CNSTF4 1110704128
+RETF4
+ADDRGP4 $227
+JUMPV
+LABELV $242
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+GEF4 $245
+ADDRLP4 0
+INDIRF4
+ADDRLP4 56
+INDIRF4
+GEF4 $245
+CNSTF4 3249537024
+RETF4
+ADDRGP4 $227
+JUMPV
+LABELV $245
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+NEF4 $248
+ADDRLP4 0
+INDIRF4
+ADDRLP4 60
+INDIRF4
+GEF4 $248
+CNSTF4 0
+RETF4
+ADDRGP4 $227
+JUMPV
+LABELV $248
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+LEF4 $251
+ADDRLP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+GEF4 $251
+CNSTF4 1102053376
+RETF4
+ADDRGP4 $227
+JUMPV
+LABELV $251
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+LEF4 $254
+ADDRLP4 0
+INDIRF4
+ADDRLP4 68
+INDIRF4
+NEF4 $254
+CNSTF4 3258187776
+RETF4
+ADDRGP4 $227
+JUMPV
+LABELV $254
+CNSTF4 3249537024
+RETF4
+LABELV $227
+endproc UI_MovedirAdjustment 72 16
+proc UI_PlayerAngles 88 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1040
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+4
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 -129
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 22
+NEI4 $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 11
+EQI4 $264
+LABELV $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 UI_MovedirAdjustment
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1050253722
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ARGP4
+ADDRGP4 UI_SwingAngles
+CALLV
+pop
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1050253722
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 UI_SwingAngles
+CALLV
+pop
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1127481344
+LEF4 $275
+ADDRLP4 40
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+CNSTF4 3283353600
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $276
+JUMPV
+LABELV $275
+ADDRLP4 40
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+LABELV $276
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1097859072
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ARGP4
+ADDRGP4 UI_SwingAngles
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 992
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $277
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $277
+ADDRFP4 0
+INDIRP4
+CNSTI4 988
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $279
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 84
+INDIRF4
+ASGNF4
+LABELV $279
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $257
+endproc UI_PlayerAngles 88 24
+proc UI_PlayerFloatSprite 172 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+112
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $284
+endproc UI_PlayerFloatSprite 172 12
+export UI_MachinegunSpinAngle
+proc UI_MachinegunSpinAngle 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1124
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $292
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1120
+ADDP4
+INDIRF4
+CNSTF4 1063675494
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $293
+JUMPV
+LABELV $292
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+LEI4 $294
+ADDRLP4 4
+CNSTI4 1000
+ASGNI4
+LABELV $294
+ADDRLP4 12
+CNSTF4 1056964608
+CNSTI4 1000
+ADDRLP4 4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+CNSTF4 1063675494
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1120
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $293
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $296
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+LABELV $296
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+EQI4 $301
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $302
+ADDRFP4 0
+INDIRP4
+CNSTI4 1116
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $298
+ADDRFP4 0
+INDIRP4
+CNSTI4 1124
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1120
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $304
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 1116
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $298
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $291
+endproc UI_MachinegunSpinAngle 32 4
+lit
+align 4
+LABELV $307
+byte 4 0
+skip 168
+align 4
+LABELV $308
+byte 4 0
+skip 168
+align 4
+LABELV $309
+byte 4 0
+skip 168
+align 4
+LABELV $310
+byte 4 0
+skip 168
+align 4
+LABELV $311
+byte 4 0
+skip 168
+align 4
+LABELV $312
+byte 4 0
+skip 168
+align 4
+LABELV $313
+byte 4 3246391296
+byte 4 3246391296
+byte 4 3250585600
+align 4
+LABELV $314
+byte 4 1098907648
+byte 4 1098907648
+byte 4 1107296256
+export UI_DrawPlayer
+code
+proc UI_DrawPlayer 1492 28
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $307
+INDIRB
+ASGNB 172
+ADDRLP4 172
+ADDRGP4 $308
+INDIRB
+ASGNB 172
+ADDRLP4 724
+ADDRGP4 $309
+INDIRB
+ASGNB 172
+ADDRLP4 896
+ADDRGP4 $310
+INDIRB
+ASGNB 172
+ADDRLP4 1072
+ADDRGP4 $311
+INDIRB
+ASGNB 172
+ADDRLP4 1268
+ADDRGP4 $312
+INDIRB
+ASGNB 172
+ADDRLP4 1244
+ADDRGP4 $313
+INDIRB
+ASGNB 12
+ADDRLP4 1256
+ADDRGP4 $314
+INDIRB
+ASGNB 12
+ADDRLP4 1452
+CNSTI4 0
+ASGNI4
+ADDRFP4 16
+INDIRP4
+INDIRI4
+ADDRLP4 1452
+INDIRI4
+EQI4 $319
+ADDRFP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ADDRLP4 1452
+INDIRI4
+EQI4 $319
+ADDRFP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ADDRLP4 1452
+INDIRI4
+EQI4 $319
+ADDRFP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ADDRLP4 1452
+INDIRI4
+NEI4 $315
+LABELV $319
+ADDRGP4 $306
+JUMPV
+LABELV $315
+ADDRGP4 dp_realtime
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1084
+ADDP4
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+EQI4 $320
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1088
+ADDP4
+INDIRI4
+LEI4 $320
+ADDRFP4 16
+INDIRP4
+CNSTI4 1076
+ADDP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1084
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1080
+ADDP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1084
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1084
+ADDP4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1088
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1076
+ADDP4
+INDIRI4
+EQI4 $322
+ADDRGP4 weaponChangeSound
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $322
+LABELV $320
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRGP4 jumpHeight
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 344
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 172
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 724
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 344+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 344+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 344
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 344+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 344+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 344+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 344+16
+CNSTF4 1119092736
+ADDRLP4 344+8
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19664
+INDIRF4
+DIVF4
+CNSTF4 1142947840
+DIVF4
+MULF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+CNSTF4 1078530011
+ADDRLP4 344+16
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 1460
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 1444
+ADDRLP4 344+8
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19664
+INDIRF4
+DIVF4
+ADDRLP4 1460
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 344+12
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+19668
+INDIRF4
+DIVF4
+ARGF4
+ADDRLP4 1444
+INDIRF4
+ARGF4
+ADDRLP4 1464
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 344+20
+ADDRLP4 1464
+INDIRF4
+ASGNF4
+ADDRLP4 344+20
+CNSTF4 1122316001
+ADDRLP4 344+20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1440
+CNSTF4 1060320051
+ADDRLP4 1256+8
+INDIRF4
+ADDRLP4 1244+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+CNSTF4 1056964608
+CNSTF4 1078530011
+ADDRLP4 344+16
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 1468
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 712
+ADDRLP4 1440
+INDIRF4
+ADDRLP4 1468
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 712+4
+CNSTF4 1056964608
+ADDRLP4 1244+4
+INDIRF4
+ADDRLP4 1256+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 712+8
+CNSTF4 3204448256
+ADDRLP4 1244+8
+INDIRF4
+ADDRLP4 1256+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 344+72
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 172+28
+ARGP4
+ADDRLP4 724+28
+ARGP4
+ADDRGP4 UI_PlayerAngles
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0+96
+ARGP4
+ADDRLP4 0+80
+ARGP4
+ADDRLP4 0+100
+ARGP4
+ADDRLP4 172+96
+ARGP4
+ADDRLP4 172+80
+ARGP4
+ADDRLP4 172+100
+ARGP4
+ADDRGP4 UI_PlayerAnimation
+CALLV
+pop
+ADDRLP4 1068
+CNSTI4 192
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 16
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+108
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRLP4 0+4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 0+84
+ADDRLP4 0+68
+INDIRB
+ASGNB 12
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $372
+ADDRGP4 $306
+JUMPV
+LABELV $372
+ADDRLP4 172+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172+8
+INDIRI4
+CNSTI4 0
+NEI4 $376
+ADDRGP4 $306
+JUMPV
+LABELV $376
+ADDRLP4 172+108
+ADDRFP4 16
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172+12
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRLP4 172
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $381
+ARGP4
+ADDRGP4 UI_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 172+4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 172+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 172+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 172+116+2
+CNSTU1 150
+ASGNU1
+ADDRLP4 172+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 172
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 724+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 724+8
+INDIRI4
+CNSTI4 0
+NEI4 $391
+ADDRGP4 $306
+JUMPV
+LABELV $391
+ADDRLP4 724+108
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 724+12
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRLP4 724
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $396
+ARGP4
+ADDRGP4 UI_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 724+4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 724
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $398
+ADDRLP4 896
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 896+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 996
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 896+12
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRLP4 896
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $402
+ARGP4
+ADDRGP4 UI_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 896+4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 896
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $398
+ADDRLP4 1472
+ADDRFP4 16
+INDIRP4
+CNSTI4 1128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1472
+INDIRI4
+CNSTI4 2
+EQI4 $407
+ADDRLP4 1472
+INDIRI4
+CNSTI4 1
+EQI4 $407
+ADDRLP4 1472
+INDIRI4
+CNSTI4 9
+NEI4 $404
+LABELV $407
+ADDRLP4 1072
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1072+12
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRLP4 1072+4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1072+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 1000
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1476+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 1476
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 1488
+ADDRGP4 UI_MachinegunSpinAngle
+CALLF4
+ASGNF4
+ADDRLP4 1476+8
+ADDRLP4 1488
+INDIRF4
+ASGNF4
+ADDRLP4 1476
+ARGP4
+ADDRLP4 1072+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 1072
+ARGP4
+ADDRLP4 896
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 996
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $414
+ARGP4
+ADDRGP4 UI_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 1072
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $404
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1020
+ADDP4
+INDIRI4
+GTI4 $415
+ADDRFP4 16
+INDIRP4
+CNSTI4 1004
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $417
+ADDRLP4 1268
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1268+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 1004
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1268+12
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRLP4 1268
+ARGP4
+ADDRLP4 896
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 996
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $421
+ARGP4
+ADDRGP4 UI_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 1268+4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1268
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $417
+ADDRLP4 1480
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1008
+ADDP4
+INDIRF4
+ADDRLP4 1480
+INDIRF4
+NEF4 $426
+ADDRFP4 16
+INDIRP4
+CNSTI4 1012
+ADDP4
+INDIRF4
+ADDRLP4 1480
+INDIRF4
+NEF4 $426
+ADDRFP4 16
+INDIRP4
+CNSTI4 1016
+ADDP4
+INDIRF4
+ADDRLP4 1480
+INDIRF4
+EQF4 $423
+LABELV $426
+ADDRLP4 1484
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1268+68
+ARGP4
+ADDRLP4 1484
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1008
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1012
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1016
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $423
+LABELV $415
+ADDRFP4 16
+INDIRP4
+CNSTI4 1108
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $428
+ADDRGP4 $430
+ARGP4
+ADDRLP4 1476
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 712
+ARGP4
+ADDRLP4 1476
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerFloatSprite
+CALLV
+pop
+LABELV $428
+ADDRLP4 1476
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 712
+ADDRLP4 712
+INDIRF4
+ADDRLP4 1476
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 712+4
+ADDRLP4 712+4
+INDIRF4
+ADDRLP4 1476
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 712
+ARGP4
+CNSTF4 1140457472
+ARGF4
+ADDRLP4 1480
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 1480
+INDIRF4
+ARGF4
+ADDRLP4 1480
+INDIRF4
+ARGF4
+ADDRLP4 1480
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRLP4 1484
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 712
+ADDRLP4 712
+INDIRF4
+ADDRLP4 1484
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 712+4
+ADDRLP4 712+4
+INDIRF4
+ADDRLP4 1484
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 712
+ARGP4
+CNSTF4 1140457472
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1488
+CNSTF4 0
+ASGNF4
+ADDRLP4 1488
+INDIRF4
+ARGF4
+ADDRLP4 1488
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRLP4 344
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $306
+endproc UI_DrawPlayer 1492 28
+proc UI_RegisterClientSkin 84 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $436
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $437
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $438
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $442
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $442
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $439
+LABELV $442
+CNSTI4 0
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $439
+CNSTI4 1
+RETI4
+LABELV $435
+endproc UI_RegisterClientSkin 84 20
+proc UI_ParseAnimationFile 20076 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 868
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 988
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 992
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20032
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20036
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 20036
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GTI4 $444
+CNSTI4 0
+RETI4
+ADDRGP4 $443
+JUMPV
+LABELV $444
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+CNSTU4 19999
+LTU4 $446
+ADDRGP4 $448
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $443
+JUMPV
+LABELV $446
+ADDRLP4 32
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 32
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20040
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20040
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $452
+ADDRGP4 $451
+JUMPV
+LABELV $452
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $456
+ARGP4
+ADDRLP4 20044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20044
+INDIRI4
+CNSTI4 0
+NEI4 $454
+ADDRLP4 12
+ARGP4
+ADDRLP4 20048
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20048
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $450
+ADDRGP4 $451
+JUMPV
+LABELV $454
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $461
+ARGP4
+ADDRLP4 20048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20048
+INDIRI4
+CNSTI4 0
+NEI4 $459
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $462
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $466
+ADDRGP4 $450
+JUMPV
+LABELV $466
+LABELV $463
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $462
+ADDRGP4 $450
+JUMPV
+LABELV $459
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $470
+ARGP4
+ADDRLP4 20052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20052
+INDIRI4
+CNSTI4 0
+NEI4 $468
+ADDRLP4 12
+ARGP4
+ADDRLP4 20056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $450
+ADDRGP4 $451
+JUMPV
+LABELV $468
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $475
+ARGP4
+ADDRLP4 20056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20056
+INDIRI4
+CNSTI4 0
+NEI4 $473
+ADDRFP4 4
+INDIRP4
+CNSTI4 988
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $450
+JUMPV
+LABELV $473
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $478
+ARGP4
+ADDRLP4 20060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20060
+INDIRI4
+CNSTI4 0
+NEI4 $476
+ADDRFP4 4
+INDIRP4
+CNSTI4 992
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $450
+JUMPV
+LABELV $476
+ADDRLP4 20064
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 48
+LTI4 $479
+ADDRLP4 20064
+INDIRI4
+CNSTI4 57
+GTI4 $479
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $451
+JUMPV
+LABELV $479
+ADDRGP4 $481
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $450
+ADDRGP4 $449
+JUMPV
+LABELV $451
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $482
+ADDRLP4 12
+ARGP4
+ADDRLP4 20040
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20040
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $486
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+LTI4 $484
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+GTI4 $484
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $486
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 20044
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $490
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $490
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+LTI4 $492
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $492
+ADDRLP4 20052
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20052
+INDIRP4
+ADDRLP4 20052
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $492
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $494
+ADDRGP4 $484
+JUMPV
+LABELV $494
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20056
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $496
+ADDRLP4 20060
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20060
+INDIRP4
+ADDRLP4 20060
+INDIRP4
+INDIRI4
+NEGI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $496
+ADDRLP4 12
+ARGP4
+ADDRLP4 20060
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20060
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $498
+ADDRGP4 $484
+JUMPV
+LABELV $498
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20064
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20064
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20068
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20068
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $500
+ADDRGP4 $484
+JUMPV
+LABELV $500
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20072
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20072
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $502
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $502
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $483
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+LTI4 $482
+LABELV $484
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+EQI4 $504
+ADDRGP4 $506
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $443
+JUMPV
+LABELV $504
+CNSTI4 1
+RETI4
+LABELV $443
+endproc UI_ParseAnimationFile 20076 12
+export UI_RegisterClientModelname
+proc UI_RegisterClientModelname 220 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $508
+CNSTI4 0
+RETI4
+ADDRGP4 $507
+JUMPV
+LABELV $508
+ADDRLP4 64
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 64
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 196
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 128
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $510
+ADDRLP4 132
+ARGP4
+ADDRGP4 $512
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRLP4 132
+ARGP4
+ADDRLP4 128
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 128
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $511
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $513
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $514
+ADDRGP4 $516
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $507
+JUMPV
+LABELV $514
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $517
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 204
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $518
+ADDRGP4 $516
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $507
+JUMPV
+LABELV $518
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $520
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $521
+ADDRGP4 $516
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $507
+JUMPV
+LABELV $521
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 $525
+ARGP4
+ADDRLP4 212
+ADDRGP4 UI_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $523
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 $512
+ARGP4
+ADDRLP4 216
+ADDRGP4 UI_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $526
+ADDRGP4 $528
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $507
+JUMPV
+LABELV $526
+LABELV $523
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $529
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 UI_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $530
+ADDRGP4 $532
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $507
+JUMPV
+LABELV $530
+CNSTI4 1
+RETI4
+LABELV $507
+endproc UI_RegisterClientModelname 220 16
+export UI_PlayerInfo_SetModel
+proc UI_PlayerInfo_SetModel 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1132
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_RegisterClientModelname
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1084
+ADDP4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1088
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1108
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+LABELV $533
+endproc UI_PlayerInfo_SetModel 12 12
+export UI_PlayerInfo_SetInfo
+proc UI_PlayerInfo_SetInfo 108 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1108
+ADDP4
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $535
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1028
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $538
+ADDRLP4 8
+INDIRI4
+CNSTI4 7
+LEI4 $536
+LABELV $538
+ADDRFP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1028
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $539
+ADDRFP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $539
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $541
+ADDRFP4 0
+INDIRP4
+CNSTI4 1028
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $541
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $543
+ADDRFP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $543
+LABELV $537
+ADDRLP4 36
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+LTF4 $546
+ADDRLP4 28
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRLP4 28
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $547
+ADDRFP4 0
+INDIRP4
+CNSTI4 1036
+ADDP4
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 52
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 1028
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+LTF4 $549
+ADDRLP4 44
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $550
+JUMPV
+LABELV $549
+ADDRLP4 44
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $550
+ADDRFP4 0
+INDIRP4
+CNSTI4 1037
+ADDP4
+ADDRLP4 44
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 68
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+LTF4 $552
+ADDRLP4 60
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $553
+JUMPV
+LABELV $552
+ADDRLP4 60
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $553
+ADDRFP4 0
+INDIRP4
+CNSTI4 1038
+ADDP4
+ADDRLP4 60
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 1039
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 1040
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+ADDRFP4 16
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $554
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+EQI4 $534
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1084
+ADDP4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1088
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+ADDRGP4 $534
+JUMPV
+LABELV $554
+ADDRFP4 20
+INDIRI4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+NEI4 $558
+ADDRFP4 0
+INDIRP4
+CNSTI4 1084
+ADDP4
+ADDRGP4 WP_NUM_WEAPONS
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1088
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $559
+JUMPV
+LABELV $558
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRFP4 0
+INDIRP4
+CNSTI4 1084
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1088
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+CNSTI4 250
+ADDI4
+ASGNI4
+LABELV $560
+LABELV $559
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $564
+ADDRFP4 4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $562
+LABELV $564
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+ADDRGP4 $534
+JUMPV
+LABELV $562
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 84
+CNSTI4 18
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+EQI4 $565
+ADDRLP4 0
+INDIRI4
+ADDRLP4 84
+INDIRI4
+EQI4 $567
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+NEI4 $565
+LABELV $567
+ADDRFP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $566
+JUMPV
+LABELV $565
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $568
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+LABELV $568
+LABELV $566
+ADDRFP4 8
+INDIRI4
+CNSTI4 11
+EQI4 $572
+ADDRFP4 8
+INDIRI4
+CNSTI4 12
+NEI4 $570
+LABELV $572
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $573
+LABELV $575
+ADDRFP4 8
+CNSTI4 12
+ASGNI4
+ADDRGP4 $574
+JUMPV
+LABELV $573
+ADDRFP4 8
+CNSTI4 11
+ASGNI4
+LABELV $574
+LABELV $570
+ADDRFP4 8
+INDIRI4
+CNSTI4 7
+EQI4 $578
+ADDRFP4 8
+INDIRI4
+CNSTI4 8
+NEI4 $576
+LABELV $578
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $581
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $579
+LABELV $581
+ADDRFP4 8
+CNSTI4 8
+ASGNI4
+ADDRGP4 $580
+JUMPV
+LABELV $579
+ADDRFP4 8
+CNSTI4 7
+ASGNI4
+LABELV $580
+ADDRFP4 0
+INDIRP4
+CNSTI4 1020
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $576
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+NEI4 $585
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $585
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $582
+LABELV $585
+ADDRFP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $583
+JUMPV
+LABELV $582
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+EQI4 $588
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $586
+LABELV $588
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $586
+ADDRFP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $589
+ADDRFP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+LABELV $589
+LABELV $587
+LABELV $583
+LABELV $534
+endproc UI_PlayerInfo_SetInfo 108 8
+bss
+align 4
+LABELV jumpHeight
+skip 4
+align 4
+LABELV dp_realtime
+skip 4
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_DrawConsoleLinesOver
+import trap_OpenWolfcamDirectory
+import trap_OpenQuakeLiveDirectory
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import ScrollList_Init
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_doubleClickTime
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $535
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $532
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $529
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $528
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $525
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $520
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $517
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $516
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $513
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $512
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $506
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $481
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $478
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $475
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $470
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $461
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $456
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $448
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $438
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $437
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $436
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $430
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $421
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $414
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $402
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $396
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $381
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $167
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $95
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $94
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
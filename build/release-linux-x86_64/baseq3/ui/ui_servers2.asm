@@ -0,0 +1,7133 @@
+data
+align 4
+LABELV master_items
+address $71
+address $72
+address $73
+address $74
+address $75
+address $76
+address $77
+address $78
+byte 4 0
+align 4
+LABELV servertype_items
+address $79
+address $80
+address $81
+address $82
+address $83
+byte 4 0
+align 4
+LABELV sortkey_items
+address $84
+address $85
+address $86
+address $87
+address $88
+byte 4 0
+align 4
+LABELV gamenames
+address $89
+address $90
+address $91
+address $92
+address $93
+address $94
+address $95
+address $96
+address $97
+address $98
+address $99
+address $100
+address $101
+byte 4 0
+align 4
+LABELV netnames
+address $101
+address $102
+address $103
+byte 4 0
+align 1
+LABELV quake3worldMessage
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 119
+byte 1 119
+byte 1 46
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 51
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+export punkbuster_items
+align 4
+LABELV punkbuster_items
+address $104
+address $105
+byte 4 0
+export punkbuster_msg
+align 4
+LABELV punkbuster_msg
+address $106
+address $107
+address $108
+address $109
+byte 4 0
+code
+proc ArenaServers_MaxPing 8 4
+ADDRGP4 $114
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+GEI4 $115
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+LABELV $115
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $113
+endproc ArenaServers_MaxPing 8 4
+proc ArenaServers_Compare 68 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 g_sortkey
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $118
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+GTI4 $118
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $141
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $141
+address $120
+address $121
+address $122
+address $131
+address $136
+code
+LABELV $120
+ADDRLP4 20
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $121
+ADDRLP4 28
+CNSTI4 89
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $122
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $123
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+LABELV $123
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $125
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+LABELV $125
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $127
+CNSTI4 1
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $127
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+NEF4 $129
+CNSTI4 0
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $129
+CNSTI4 -1
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $131
+ADDRLP4 44
+CNSTI4 120
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $132
+CNSTI4 -1
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $132
+ADDRLP4 48
+CNSTI4 120
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $134
+CNSTI4 0
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $134
+CNSTI4 1
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $136
+ADDRLP4 52
+CNSTI4 116
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $137
+CNSTI4 -1
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $137
+ADDRLP4 56
+CNSTI4 116
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $139
+CNSTI4 1
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $139
+ADDRLP4 60
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $118
+CNSTI4 0
+RETI4
+LABELV $117
+endproc ArenaServers_Compare 68 8
+export ArenaServers_SourceForLAN
+proc ArenaServers_SourceForLAN 4 0
+ADDRLP4 0
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $143
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $143
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $148
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $148
+address $145
+address $146
+address $146
+address $146
+address $146
+address $146
+address $146
+address $147
+code
+LABELV $143
+LABELV $145
+CNSTI4 0
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $146
+CNSTI4 2
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $147
+CNSTI4 3
+RETI4
+LABELV $142
+endproc ArenaServers_SourceForLAN 4 0
+proc ArenaServers_Go 8 8
+ADDRLP4 0
+CNSTI4 72
+ADDRGP4 g_arenaservers+4616+64
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+7912+68
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $154
+ADDRGP4 $156
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $154
+LABELV $149
+endproc ArenaServers_Go 8 8
+bss
+align 1
+LABELV $158
+skip 64
+code
+proc ArenaServers_UpdatePicture 4 16
+ADDRGP4 g_arenaservers+4616+68
+INDIRI4
+CNSTI4 0
+NEI4 $159
+ADDRGP4 g_arenaservers+4712+4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $160
+JUMPV
+LABELV $159
+ADDRLP4 0
+CNSTI4 72
+ADDRGP4 g_arenaservers+4616+64
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+7912+68
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $158
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 g_arenaservers+4712+4
+ADDRGP4 $158
+ASGNP4
+LABELV $160
+ADDRGP4 g_arenaservers+4712+68
+CNSTI4 0
+ASGNI4
+LABELV $157
+endproc ArenaServers_UpdatePicture 4 16
+proc ArenaServers_UpdateMenu 68 48
+ADDRGP4 g_arenaservers+17640
+INDIRI4
+CNSTI4 0
+LEI4 $175
+ADDRGP4 g_arenaservers+17656
+INDIRI4
+CNSTI4 0
+EQI4 $178
+ADDRGP4 g_arenaservers+17652
+INDIRI4
+ADDRGP4 g_arenaservers+17640
+INDIRI4
+GTI4 $178
+ADDRGP4 g_arenaservers+5064+60
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $185
+ARGP4
+ADDRGP4 g_arenaservers+17652
+INDIRI4
+ARGI4
+ADDRGP4 g_arenaservers+17640
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 g_arenaservers+5136+60
+ADDRGP4 $190
+ASGNP4
+ADDRGP4 g_arenaservers+17648
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 152
+ARGU4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 $176
+JUMPV
+LABELV $178
+ADDRLP4 28
+ADDRGP4 g_arenaservers+4296+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 g_arenaservers+4392+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 g_arenaservers+4552+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+4488+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+4616+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+5384+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+5648+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+18700+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+LTI4 $209
+ADDRLP4 60
+INDIRI4
+CNSTI4 6
+GTI4 $209
+ADDRGP4 g_arenaservers+5136+60
+ADDRGP4 quake3worldMessage
+ASGNP4
+ADDRGP4 $176
+JUMPV
+LABELV $209
+ADDRGP4 g_arenaservers+5136+60
+ADDRGP4 $215
+ASGNP4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRGP4 g_arenaservers+17656
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRGP4 g_arenaservers+5064+60
+INDIRP4
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 g_arenaservers+5136+60
+ADDRGP4 $190
+ASGNP4
+ADDRLP4 28
+ADDRGP4 g_arenaservers+4296+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 g_arenaservers+4392+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 g_arenaservers+4552+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+4488+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+4616+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+5384+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+5648+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+18700+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRGP4 g_arenaservers+17640
+INDIRI4
+CNSTI4 0
+GEI4 $240
+ADDRGP4 g_arenaservers+5064+60
+INDIRP4
+ARGP4
+ADDRGP4 $245
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $241
+JUMPV
+LABELV $240
+ADDRGP4 g_arenaservers+5064+60
+INDIRP4
+ARGP4
+ADDRGP4 $248
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $241
+ADDRLP4 28
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LTI4 $249
+ADDRLP4 28
+INDIRI4
+CNSTI4 6
+GTI4 $249
+ADDRGP4 g_arenaservers+5136+60
+ADDRGP4 quake3worldMessage
+ASGNP4
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRGP4 g_arenaservers+5136+60
+ADDRGP4 $215
+ASGNP4
+LABELV $250
+ADDRLP4 32
+ADDRGP4 g_arenaservers+4200+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 g_arenaservers+4296+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+4392+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+4552+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+4488+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+4616+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+5384+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+5648+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_arenaservers+18700+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $217
+ADDRGP4 g_arenaservers+4616+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+4616+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+4616+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+ADDRGP4 $174
+JUMPV
+LABELV $176
+ADDRLP4 0
+ADDRGP4 g_arenaservers+17648
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $284
+JUMPV
+LABELV $281
+ADDRLP4 4
+CNSTI4 72
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+7912
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_emptyservers
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $286
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $286
+ADDRGP4 $282
+JUMPV
+LABELV $286
+ADDRGP4 g_fullservers
+INDIRI4
+CNSTI4 0
+NEI4 $288
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+NEI4 $288
+ADDRGP4 $282
+JUMPV
+LABELV $288
+ADDRLP4 40
+ADDRGP4 g_gametype
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $290
+ADDRLP4 40
+INDIRI4
+CNSTI4 4
+GTI4 $290
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $305
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $305
+address $291
+address $293
+address $296
+address $299
+address $302
+code
+LABELV $293
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $291
+ADDRGP4 $282
+JUMPV
+LABELV $296
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $291
+ADDRGP4 $282
+JUMPV
+LABELV $299
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $291
+ADDRGP4 $282
+JUMPV
+LABELV $302
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $291
+ADDRGP4 $282
+JUMPV
+LABELV $290
+LABELV $291
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+GEI4 $306
+ADDRLP4 20
+ADDRGP4 $308
+ASGNP4
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $309
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $309
+ADDRLP4 20
+ADDRGP4 $308
+ASGNP4
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 200
+GEI4 $311
+ADDRLP4 20
+ADDRGP4 $313
+ASGNP4
+ADDRGP4 $312
+JUMPV
+LABELV $311
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 400
+GEI4 $314
+ADDRLP4 20
+ADDRGP4 $316
+ASGNP4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 20
+ADDRGP4 $317
+ASGNP4
+LABELV $315
+LABELV $312
+LABELV $310
+LABELV $307
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 68
+ARGI4
+ADDRGP4 $318
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netnames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $322
+ADDRLP4 56
+ADDRGP4 $319
+ASGNP4
+ADDRGP4 $323
+JUMPV
+LABELV $322
+ADDRLP4 56
+ADDRGP4 $320
+ASGNP4
+LABELV $323
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $282
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+LABELV $284
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $281
+ADDRGP4 g_arenaservers+4616+68
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+4616+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+4616+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+LABELV $174
+endproc ArenaServers_UpdateMenu 68 48
+proc ArenaServers_Remove 28 12
+ADDRGP4 g_arenaservers+4616+68
+INDIRI4
+CNSTI4 0
+NEI4 $331
+ADDRGP4 $330
+JUMPV
+LABELV $331
+ADDRLP4 8
+CNSTI4 72
+ADDRGP4 g_arenaservers+4616+64
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+7912
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $341
+JUMPV
+LABELV $338
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+17672
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $343
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+18696
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $346
+ADDRLP4 20
+CNSTI4 6
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 g_arenaservers+17672
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 g_arenaservers+17672+64
+ADDP4
+ARGP4
+ADDRGP4 g_arenaservers+18696
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+CNSTI4 64
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $346
+ADDRLP4 16
+ADDRGP4 g_arenaservers+18696
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 g_arenaservers+18696
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+17672
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $340
+JUMPV
+LABELV $343
+LABELV $339
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $341
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+18696
+INDIRI4
+LTI4 $338
+LABELV $340
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $356
+CNSTI4 152
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $360
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $362
+ADDRLP4 16
+CNSTI4 152
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_favoriteserverlist+152
+ADDP4
+ARGP4
+CNSTU4 152
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $362
+ADDRLP4 12
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+CNSTI4 152
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 152
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $358
+JUMPV
+LABELV $360
+LABELV $357
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $359
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $356
+LABELV $358
+ADDRGP4 g_arenaservers+17640
+ADDRGP4 g_arenaservers+18696
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+17652
+ADDRGP4 g_arenaservers+18696
+INDIRI4
+ASGNI4
+LABELV $330
+endproc ArenaServers_Remove 28 12
+proc ArenaServers_Insert 88 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $370
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 7
+EQI4 $370
+ADDRGP4 $369
+JUMPV
+LABELV $370
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+INDIRI4
+ADDRGP4 g_arenaservers+17664
+INDIRI4
+LTI4 $372
+ADDRLP4 0
+CNSTI4 152
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+17648
+INDIRP4
+ADDP4
+CNSTI4 -152
+ADDP4
+ASGNP4
+ADDRGP4 $373
+JUMPV
+LABELV $372
+ADDRLP4 0
+CNSTI4 152
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+17648
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $373
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 22
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $383
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $384
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $385
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $388
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LTI4 $391
+ADDRLP4 72
+INDIRI4
+CVIU4 4
+CNSTU4 3
+LTU4 $389
+LABELV $391
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $389
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRLP4 76
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $393
+ARGP4
+ADDRLP4 80
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $394
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 4
+INDIRI4
+CNSTI4 11
+LEI4 $396
+ADDRLP4 4
+CNSTI4 12
+ASGNI4
+LABELV $396
+LABELV $395
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $398
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gamenames
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $399
+LABELV $369
+endproc ArenaServers_Insert 88 12
+export ArenaServers_LoadFavorites
+proc ArenaServers_LoadFavorites 2528 12
+ADDRLP4 2508
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 g_favoriteserverlist
+ARGP4
+CNSTU4 2432
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 68
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ASGNI4
+ADDRGP4 g_favoriteserverlist
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2432
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 2512
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_numfavoriteservers
+ADDRLP4 2512
+INDIRI4
+ASGNI4
+ADDRLP4 2504
+ADDRLP4 2512
+INDIRI4
+ASGNI4
+LABELV $401
+ADDRGP4 $405
+ARGP4
+ADDRLP4 2504
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 2516
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2516
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $406
+ADDRGP4 $402
+JUMPV
+LABELV $406
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+17672
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $412
+JUMPV
+LABELV $409
+CNSTI4 152
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 72
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2520
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2520
+INDIRI4
+CNSTI4 0
+NEI4 $413
+ADDRGP4 $411
+JUMPV
+LABELV $413
+LABELV $410
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $412
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $409
+LABELV $411
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+GEI4 $415
+ADDRLP4 2524
+CNSTI4 152
+ASGNI4
+ADDRLP4 2524
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 2524
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 72
+ADDP4
+ARGP4
+CNSTU4 152
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 2508
+CNSTI4 1
+ASGNI4
+ADDRGP4 $416
+JUMPV
+LABELV $415
+CNSTI4 152
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2524
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+CNSTI4 152
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist+116
+ADDP4
+ADDRLP4 2524
+INDIRI4
+ASGNI4
+LABELV $416
+ADDRLP4 2524
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRLP4 2524
+INDIRP4
+ADDRLP4 2524
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $402
+ADDRLP4 2504
+ADDRLP4 2504
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2504
+INDIRI4
+CNSTI4 16
+LTI4 $401
+ADDRGP4 g_arenaservers+18696
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ASGNI4
+ADDRLP4 2508
+INDIRI4
+CNSTI4 0
+NEI4 $419
+ADDRGP4 g_numfavoriteservers
+CNSTI4 0
+ASGNI4
+LABELV $419
+LABELV $400
+endproc ArenaServers_LoadFavorites 2528 12
+proc ArenaServers_StopRefresh 0 16
+ADDRGP4 g_arenaservers+17656
+INDIRI4
+CNSTI4 0
+NEI4 $422
+ADDRGP4 $421
+JUMPV
+LABELV $422
+ADDRGP4 g_arenaservers+17656
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+17640
+INDIRI4
+CNSTI4 0
+LTI4 $426
+ADDRGP4 g_arenaservers+17652
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+17640
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $426
+ADDRGP4 g_arenaservers+17648
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 152
+ARGU4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $421
+endproc ArenaServers_StopRefresh 0 16
+proc ArenaServers_DoRefresh 1120 16
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+17668
+INDIRI4
+GEI4 $436
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 7
+EQI4 $437
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $442
+CNSTI4 0
+ARGI4
+ADDRLP4 1104
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRGP4 $435
+JUMPV
+LABELV $444
+LABELV $442
+ADDRLP4 1104
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+GEI4 $437
+ADDRGP4 $435
+JUMPV
+LABELV $436
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $448
+CNSTI4 0
+ARGI4
+ADDRLP4 1104
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $450
+CNSTI4 2
+ARGI4
+ADDRGP4 $452
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 g_arenaservers+17668
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 $435
+JUMPV
+LABELV $450
+LABELV $448
+LABELV $437
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+17660
+INDIRI4
+GEI4 $455
+ADDRGP4 $435
+JUMPV
+LABELV $455
+ADDRGP4 g_arenaservers+17660
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRLP4 1104
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRLP4 1100
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $461
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 trap_LAN_GetPing
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $465
+ADDRGP4 $462
+JUMPV
+LABELV $465
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $467
+ADDRLP4 4
+ARGP4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+5736
+ADDP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $471
+ADDRGP4 $469
+JUMPV
+LABELV $471
+LABELV $468
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $467
+LABELV $469
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $474
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $476
+ADDRLP4 72
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+5736+64
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+GEI4 $481
+ADDRGP4 $462
+JUMPV
+LABELV $481
+LABELV $476
+ADDRLP4 72
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+LEI4 $483
+ADDRLP4 76
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 7
+NEI4 $484
+ADDRLP4 76
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 76
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRGP4 $101
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $484
+JUMPV
+LABELV $483
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 76
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetPingInfo
+CALLV
+pop
+LABELV $484
+ADDRLP4 4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Insert
+CALLV
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+5736
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $474
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ClearPing
+CALLV
+pop
+LABELV $462
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+LTI4 $461
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 7
+NEI4 $488
+ADDRGP4 g_arenaservers+17640
+ADDRGP4 g_arenaservers+18696
+INDIRI4
+ASGNI4
+ADDRGP4 $489
+JUMPV
+LABELV $488
+ADDRLP4 1108
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+17640
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+LABELV $489
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $493
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetPingQueueCount
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 32
+LTI4 $499
+ADDRGP4 $495
+JUMPV
+LABELV $499
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $501
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+5736
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $505
+ADDRGP4 $503
+JUMPV
+LABELV $505
+LABELV $502
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $501
+LABELV $503
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $508
+ADDRGP4 $495
+JUMPV
+LABELV $508
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 7
+NEI4 $510
+ADDRLP4 4
+ARGP4
+ADDRGP4 g_arenaservers+17652
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+17672
+ADDP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRLP4 1112
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+ARGI4
+ADDRGP4 g_arenaservers+17652
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+LABELV $511
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+5736
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+5736+64
+ADDP4
+ADDRGP4 uis+4
+INDIRI4
+ASGNI4
+ADDRGP4 $519
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1116
+ADDRGP4 g_arenaservers+17652
+ASGNP4
+ADDRLP4 1116
+INDIRP4
+ADDRLP4 1116
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $494
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $496
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+GEI4 $521
+ADDRGP4 g_arenaservers+17652
+INDIRI4
+ADDRGP4 g_arenaservers+17640
+INDIRI4
+LTI4 $493
+LABELV $521
+LABELV $495
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetPingQueueCount
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $522
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 $435
+JUMPV
+LABELV $522
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $435
+endproc ArenaServers_DoRefresh 1120 16
+proc ArenaServers_StartRefresh 88 16
+ADDRGP4 g_arenaservers+17648
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 72
+ADDRGP4 g_arenaservers+17664
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $527
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+5736
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ClearPing
+CALLV
+pop
+LABELV $528
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $527
+ADDRGP4 g_arenaservers+17656
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+17652
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+17660
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+17640
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+17668
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $539
+CNSTI4 2
+ARGI4
+ADDRGP4 $452
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $524
+JUMPV
+LABELV $539
+ADDRLP4 68
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+LTI4 $541
+ADDRLP4 68
+INDIRI4
+CNSTI4 6
+GTI4 $541
+ADDRLP4 72
+ADDRGP4 g_arenaservers+4296+64
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LTI4 $543
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+GTI4 $543
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $556
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $556
+address $547
+address $548
+address $550
+address $552
+address $554
+code
+LABELV $543
+LABELV $547
+ADDRLP4 36
+CNSTI1 0
+ASGNI1
+ADDRGP4 $544
+JUMPV
+LABELV $548
+ADDRLP4 36
+ARGP4
+ADDRGP4 $549
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $544
+JUMPV
+LABELV $550
+ADDRLP4 36
+ARGP4
+ADDRGP4 $551
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $544
+JUMPV
+LABELV $552
+ADDRLP4 36
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $544
+JUMPV
+LABELV $554
+ADDRLP4 36
+ARGP4
+ADDRGP4 $555
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $544
+ADDRGP4 g_emptyservers
+INDIRI4
+CNSTI4 0
+EQI4 $557
+ADDRLP4 36
+ARGP4
+ADDRGP4 $559
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $557
+ADDRGP4 g_fullservers
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRLP4 36
+ARGP4
+ADDRGP4 $562
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $560
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $563
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 76
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 76
+INDIRU4
+CNSTU4 0
+EQU4 $564
+ADDRGP4 $566
+ARGP4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $565
+JUMPV
+LABELV $564
+ADDRGP4 $568
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $567
+ARGP4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $565
+LABELV $541
+LABELV $524
+endproc ArenaServers_StartRefresh 88 16
+export ArenaServers_SaveChanges
+proc ArenaServers_SaveChanges 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $573
+JUMPV
+LABELV $570
+ADDRGP4 $405
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+17672
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $571
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $573
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+18696
+INDIRI4
+LTI4 $570
+ADDRGP4 $579
+JUMPV
+LABELV $576
+ADDRGP4 $405
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $577
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $579
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $576
+LABELV $569
+endproc ArenaServers_SaveChanges 12 8
+export ArenaServers_Sort
+proc ArenaServers_Sort 0 16
+ADDRGP4 g_sortkey
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $581
+ADDRGP4 $580
+JUMPV
+LABELV $581
+ADDRGP4 g_sortkey
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+17648
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 152
+ARGU4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $580
+endproc ArenaServers_Sort 0 16
+export ArenaServers_SetType
+proc ArenaServers_SetType 36 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $586
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+GTI4 $586
+ADDRLP4 28
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $591
+ADDRFP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+CNSTU4 7
+BANDU4
+NEU4 $589
+LABELV $591
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $593
+JUMPV
+LABELV $589
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $593
+JUMPV
+LABELV $592
+ADDRLP4 6
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 $595
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 6
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $596
+ADDRGP4 $594
+JUMPV
+LABELV $596
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $593
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $598
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LEI4 $592
+LABELV $598
+LABELV $594
+LABELV $586
+ADDRGP4 g_servertype
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $599
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $599
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $621
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $621
+address $601
+address $607
+address $607
+address $607
+address $607
+address $607
+address $607
+address $615
+code
+LABELV $599
+LABELV $601
+ADDRLP4 8
+ADDRGP4 g_arenaservers+5208+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 g_arenaservers+17648
+ADDRGP4 g_localserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+17644
+ADDRGP4 g_numlocalservers
+ASGNP4
+ADDRGP4 g_arenaservers+17664
+CNSTI4 128
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $607
+ADDRLP4 12
+ADDRGP4 g_arenaservers+5208+44
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 g_arenaservers+17648
+CNSTI4 19456
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_globalserverlist-19456
+ADDP4
+ASGNP4
+ADDRGP4 g_arenaservers+17644
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_numglobalservers-4
+ADDP4
+ASGNP4
+ADDRGP4 g_arenaservers+17664
+CNSTI4 128
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $615
+ADDRLP4 16
+ADDRGP4 g_arenaservers+5208+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 g_arenaservers+17648
+ADDRGP4 g_favoriteserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+17644
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRGP4 g_arenaservers+17664
+CNSTI4 16
+ASGNI4
+LABELV $600
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $622
+ADDRGP4 ArenaServers_StartRefresh
+CALLV
+pop
+ADDRGP4 $623
+JUMPV
+LABELV $622
+ADDRGP4 g_arenaservers+17652
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+17640
+ADDRGP4 g_arenaservers+17644
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 g_arenaservers+5064+60
+INDIRP4
+ARGP4
+ADDRGP4 $631
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $623
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $585
+endproc ArenaServers_SetType 36 16
+proc Punkbuster_ConfirmEnable 8 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $633
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_SetPbClStatus
+CALLV
+pop
+LABELV $633
+ADDRGP4 $637
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_arenaservers+18700+64
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $632
+endproc Punkbuster_ConfirmEnable 8 12
+proc Punkbuster_ConfirmDisable 8 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $639
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_SetPbClStatus
+CALLV
+pop
+ADDRGP4 punkbuster_msg
+ARGP4
+ADDRGP4 UI_Message
+CALLV
+pop
+LABELV $639
+ADDRGP4 $637
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_arenaservers+18700+64
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $638
+endproc Punkbuster_ConfirmDisable 8 12
+proc ArenaServers_Event 12 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $644
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+EQI4 $644
+ADDRGP4 $643
+JUMPV
+LABELV $644
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $646
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+GTI4 $646
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $700-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $700
+address $648
+address $656
+address $662
+address $668
+address $674
+address $680
+address $683
+address $685
+address $687
+address $688
+address $689
+address $690
+address $691
+address $692
+address $693
+code
+LABELV $648
+ADDRGP4 g_arenaservers+4200+64
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 ArenaServers_SetType
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+4200+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $653
+ARGP4
+ADDRGP4 g_arenaservers+4200+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $656
+ADDRGP4 $657
+ARGP4
+ADDRGP4 g_arenaservers+4296+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_gametype
+ADDRGP4 g_arenaservers+4296+64
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $662
+ADDRGP4 $663
+ARGP4
+ADDRGP4 g_arenaservers+4392+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_arenaservers+4392+64
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Sort
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $668
+ADDRGP4 $669
+ARGP4
+ADDRGP4 g_arenaservers+4488+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_fullservers
+ADDRGP4 g_arenaservers+4488+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $674
+ADDRGP4 $675
+ARGP4
+ADDRGP4 g_arenaservers+4552+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_emptyservers
+ADDRGP4 g_arenaservers+4552+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $680
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $647
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $683
+ADDRGP4 g_arenaservers+4616
+ARGP4
+CNSTI4 132
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $685
+ADDRGP4 g_arenaservers+4616
+ARGP4
+CNSTI4 133
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $687
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 ArenaServers_SaveChanges
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $688
+ADDRGP4 ArenaServers_StartRefresh
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $689
+ADDRGP4 UI_SpecifyServerMenu
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $690
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerMenu
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $691
+ADDRGP4 ArenaServers_Go
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $692
+ADDRGP4 ArenaServers_Remove
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $693
+ADDRGP4 g_arenaservers+18700+64
+INDIRI4
+CNSTI4 0
+EQI4 $694
+ADDRGP4 $698
+ARGP4
+CNSTI4 8209
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Punkbuster_ConfirmEnable
+ARGP4
+ADDRGP4 UI_ConfirmMenu_Style
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $694
+ADDRGP4 $699
+ARGP4
+CNSTI4 8209
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Punkbuster_ConfirmDisable
+ARGP4
+ADDRGP4 UI_ConfirmMenu_Style
+CALLV
+pop
+LABELV $646
+LABELV $647
+LABELV $643
+endproc ArenaServers_Event 12 16
+proc ArenaServers_MenuDraw 0 4
+ADDRGP4 g_arenaservers+17656
+INDIRI4
+CNSTI4 0
+EQI4 $703
+ADDRGP4 ArenaServers_DoRefresh
+CALLV
+pop
+LABELV $703
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $702
+endproc ArenaServers_MenuDraw 0 4
+proc ArenaServers_MenuKey 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+NEI4 $707
+ADDRGP4 g_arenaservers+17656
+INDIRI4
+CNSTI4 0
+EQI4 $707
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $706
+JUMPV
+LABELV $707
+ADDRFP4 0
+INDIRI4
+CNSTI4 140
+EQI4 $713
+ADDRFP4 0
+INDIRI4
+CNSTI4 171
+NEI4 $710
+LABELV $713
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 7
+NEI4 $710
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRGP4 g_arenaservers+4616
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $710
+ADDRGP4 ArenaServers_Remove
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $706
+JUMPV
+LABELV $710
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $716
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $714
+LABELV $716
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 ArenaServers_SaveChanges
+CALLV
+pop
+LABELV $714
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $706
+endproc ArenaServers_MenuKey 16 8
+bss
+align 1
+LABELV $718
+skip 64
+code
+proc ArenaServers_MenuInit 48 16
+ADDRGP4 g_arenaservers
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 18884
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 ArenaServers_Cache
+CALLV
+pop
+ADDRGP4 g_arenaservers+4120
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+4116
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+4108
+ADDRGP4 ArenaServers_MenuDraw
+ASGNP4
+ADDRGP4 g_arenaservers+4112
+ADDRGP4 ArenaServers_MenuKey
+ASGNP4
+ADDRGP4 g_arenaservers+4128
+CNSTI4 10
+ASGNI4
+ADDRGP4 g_arenaservers+4128+44
+CNSTU4 8
+ASGNU4
+ADDRGP4 g_arenaservers+4128+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+4128+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+4128+60
+ADDRGP4 $732
+ASGNP4
+ADDRGP4 g_arenaservers+4128+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+4128+68
+ADDRGP4 color_white
+ASGNP4
+ADDRLP4 4
+CNSTI4 80
+ASGNI4
+ADDRGP4 g_arenaservers+4200
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+4200+4
+ADDRGP4 $740
+ASGNP4
+ADDRGP4 g_arenaservers+4200+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+4200+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+4200+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 g_arenaservers+4200+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+4200+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+4200+76
+ADDRGP4 master_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+4296
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+4296+4
+ADDRGP4 $756
+ASGNP4
+ADDRGP4 g_arenaservers+4296+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+4296+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+4296+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+4296+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+4296+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+4296+76
+ADDRGP4 servertype_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+4392
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+4392+4
+ADDRGP4 $772
+ASGNP4
+ADDRGP4 g_arenaservers+4392+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+4392+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+4392+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 g_arenaservers+4392+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+4392+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+4392+76
+ADDRGP4 sortkey_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+4488
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+4488+4
+ADDRGP4 $788
+ASGNP4
+ADDRGP4 g_arenaservers+4488+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+4488+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+4488+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 g_arenaservers+4488+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+4488+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+4552
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+4552+4
+ADDRGP4 $802
+ASGNP4
+ADDRGP4 g_arenaservers+4552+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+4552+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+4552+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 g_arenaservers+4552+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+4552+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 48
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+4616
+CNSTI4 8
+ASGNI4
+ADDRGP4 g_arenaservers+4616+44
+CNSTU4 128
+ASGNU4
+ADDRGP4 g_arenaservers+4616+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 g_arenaservers+4616+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+4616+12
+CNSTI4 72
+ASGNI4
+ADDRGP4 g_arenaservers+4616+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+4616+80
+CNSTI4 68
+ASGNI4
+ADDRGP4 g_arenaservers+4616+84
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+4616+76
+ADDRGP4 g_arenaservers+17128
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $831
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaservers+17128
+ADDP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+7912
+ADDP4
+ASGNP4
+LABELV $832
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $831
+ADDRGP4 g_arenaservers+4712
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+4712+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+4712+12
+CNSTI4 72
+ASGNI4
+ADDRGP4 g_arenaservers+4712+16
+CNSTI4 80
+ASGNI4
+ADDRGP4 g_arenaservers+4712+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+4712+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 g_arenaservers+4712+64
+ADDRGP4 $850
+ASGNP4
+ADDRGP4 g_arenaservers+4800
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+4800+4
+ADDRGP4 $854
+ASGNP4
+ADDRGP4 g_arenaservers+4800+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+4800+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+4800+12
+CNSTI4 560
+ASGNI4
+ADDRGP4 g_arenaservers+4800+16
+CNSTI4 192
+ASGNI4
+ADDRGP4 g_arenaservers+4800+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+4800+80
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+4888
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+4888+44
+CNSTU4 2308
+ASGNU4
+ADDRGP4 g_arenaservers+4888+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+4888+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+4888+12
+CNSTI4 560
+ASGNI4
+ADDRGP4 g_arenaservers+4888+16
+CNSTI4 192
+ASGNI4
+ADDRGP4 g_arenaservers+4888+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+4888+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+4888+60
+ADDRGP4 $884
+ASGNP4
+ADDRGP4 g_arenaservers+4976
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+4976+44
+CNSTU4 2308
+ASGNU4
+ADDRGP4 g_arenaservers+4976+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+4976+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+4976+12
+CNSTI4 560
+ASGNI4
+ADDRGP4 g_arenaservers+4976+16
+CNSTI4 256
+ASGNI4
+ADDRGP4 g_arenaservers+4976+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+4976+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+4976+60
+ADDRGP4 $902
+ASGNP4
+ADDRLP4 4
+CNSTI4 376
+ASGNI4
+ADDRGP4 g_arenaservers+5064
+CNSTI4 7
+ASGNI4
+ADDRGP4 g_arenaservers+5064+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+5064+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+5064+60
+ADDRGP4 $718
+ASGNP4
+ADDRGP4 g_arenaservers+5064+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+5064+68
+ADDRGP4 menu_text_color
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+5136
+CNSTI4 7
+ASGNI4
+ADDRGP4 g_arenaservers+5136+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+5136+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+5136+60
+ADDRGP4 $215
+ASGNP4
+ADDRGP4 g_arenaservers+5136+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+5136+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 g_arenaservers+5208
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+5208+4
+ADDRGP4 $928
+ASGNP4
+ADDRGP4 g_arenaservers+5208+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+5208+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+5208+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 g_arenaservers+5208+12
+CNSTI4 450
+ASGNI4
+ADDRGP4 g_arenaservers+5208+16
+CNSTI4 86
+ASGNI4
+ADDRGP4 g_arenaservers+5208+76
+CNSTI4 96
+ASGNI4
+ADDRGP4 g_arenaservers+5208+80
+CNSTI4 48
+ASGNI4
+ADDRGP4 g_arenaservers+5208+60
+ADDRGP4 $945
+ASGNP4
+ADDRGP4 g_arenaservers+5296
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+5296+4
+ADDRGP4 $949
+ASGNP4
+ADDRGP4 g_arenaservers+5296+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+5296+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+5296+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 g_arenaservers+5296+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+5296+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+5296+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+5296+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+5296+60
+ADDRGP4 $966
+ASGNP4
+ADDRGP4 g_arenaservers+5472
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+5472+4
+ADDRGP4 $970
+ASGNP4
+ADDRGP4 g_arenaservers+5472+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+5472+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+5472+8
+CNSTI4 20
+ASGNI4
+ADDRGP4 g_arenaservers+5472+12
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+5472+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+5472+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+5472+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+5472+60
+ADDRGP4 $987
+ASGNP4
+ADDRGP4 g_arenaservers+5384
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+5384+4
+ADDRGP4 $991
+ASGNP4
+ADDRGP4 g_arenaservers+5384+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+5384+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+5384+8
+CNSTI4 19
+ASGNI4
+ADDRGP4 g_arenaservers+5384+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 g_arenaservers+5384+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+5384+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+5384+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+5384+60
+ADDRGP4 $1008
+ASGNP4
+ADDRGP4 g_arenaservers+5560
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+5560+4
+ADDRGP4 $1012
+ASGNP4
+ADDRGP4 g_arenaservers+5560+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+5560+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+5560+8
+CNSTI4 21
+ASGNI4
+ADDRGP4 g_arenaservers+5560+12
+CNSTI4 384
+ASGNI4
+ADDRGP4 g_arenaservers+5560+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+5560+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+5560+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+5560+60
+ADDRGP4 $1029
+ASGNP4
+ADDRGP4 g_arenaservers+5648
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+5648+4
+ADDRGP4 $1033
+ASGNP4
+ADDRGP4 g_arenaservers+5648+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 g_arenaservers+5648+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+5648+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 g_arenaservers+5648+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 g_arenaservers+5648+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+5648+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+5648+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+5648+60
+ADDRGP4 $1050
+ASGNP4
+ADDRGP4 g_arenaservers+18700
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+18700+4
+ADDRGP4 $1054
+ASGNP4
+ADDRGP4 g_arenaservers+18700+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+18700+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+18700+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 g_arenaservers+18700+12
+CNSTI4 512
+ASGNI4
+ADDRGP4 g_arenaservers+18700+16
+CNSTI4 144
+ASGNI4
+ADDRGP4 g_arenaservers+18700+76
+ADDRGP4 punkbuster_items
+ASGNP4
+ADDRGP4 g_arenaservers+18796
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+18796+4
+ADDRGP4 $1070
+ASGNP4
+ADDRGP4 g_arenaservers+18796+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+18796+12
+CNSTI4 526
+ASGNI4
+ADDRGP4 g_arenaservers+18796+16
+CNSTI4 176
+ASGNI4
+ADDRGP4 g_arenaservers+18796+76
+CNSTI4 32
+ASGNI4
+ADDRGP4 g_arenaservers+18796+80
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+18796+64
+ADDRGP4 $850
+ASGNP4
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+4128
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+4200
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+4296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+4392
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+4488
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+4552
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+4712
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+5064
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+5136
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+4800
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+4888
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+4976
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+4616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+5208
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+5296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+5472
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+5384
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+5560
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+5648
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+18700
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+18796
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 ArenaServers_LoadFavorites
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1086324736
+ARGF4
+ADDRGP4 ui_browserMaster+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_servertype
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+4200+64
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 ui_browserGameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_gametype
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+4296+64
+ADDRGP4 g_gametype
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 ui_browserSortKey+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_sortkey
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+4392+64
+ADDRGP4 g_sortkey
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowFull+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_fullservers
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+4488+60
+ADDRGP4 g_fullservers
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowEmpty+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_emptyservers
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+4552+60
+ADDRGP4 g_emptyservers
+INDIRI4
+ASGNI4
+ADDRGP4 $637
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_arenaservers+18700+64
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 g_servertype
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 ArenaServers_SetType
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+4200+64
+ADDRLP4 44
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 $563
+ARGP4
+ADDRGP4 $215
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $717
+endproc ArenaServers_MenuInit 48 16
+export ArenaServers_Cache
+proc ArenaServers_Cache 0 4
+ADDRGP4 $949
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $966
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1012
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1029
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $970
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $987
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $991
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1008
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1033
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1050
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $854
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $884
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $902
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $850
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1070
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1123
+endproc ArenaServers_Cache 0 4
+export UI_ArenaServersMenu
+proc UI_ArenaServersMenu 0 4
+ADDRGP4 ArenaServers_MenuInit
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1124
+endproc UI_ArenaServersMenu 0 4
+bss
+align 4
+LABELV g_fullservers
+skip 4
+align 4
+LABELV g_emptyservers
+skip 4
+align 4
+LABELV g_sortkey
+skip 4
+align 4
+LABELV g_gametype
+skip 4
+align 4
+LABELV g_servertype
+skip 4
+align 4
+LABELV g_numfavoriteservers
+skip 4
+align 4
+LABELV g_favoriteserverlist
+skip 2432
+align 4
+LABELV g_numlocalservers
+skip 4
+align 4
+LABELV g_localserverlist
+skip 19456
+align 4
+LABELV g_numglobalservers
+skip 24
+align 4
+LABELV g_globalserverlist
+skip 116736
+align 4
+LABELV g_arenaservers
+skip 18884
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_DrawConsoleLinesOver
+import trap_OpenWolfcamDirectory
+import trap_OpenQuakeLiveDirectory
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import ScrollList_Init
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_doubleClickTime
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1070
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 112
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $1054
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1050
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1033
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1029
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1012
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1008
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $991
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $987
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $970
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $966
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $949
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $945
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $928
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $902
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $884
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $854
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $850
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $802
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $788
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $772
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $756
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $740
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $732
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $699
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 63
+byte 1 0
+align 1
+LABELV $698
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 63
+byte 1 0
+align 1
+LABELV $675
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $669
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $663
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $657
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $653
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $637
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $631
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $595
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $588
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $568
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $567
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $566
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $563
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $562
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $559
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $555
+byte 1 32
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $553
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $551
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $549
+byte 1 32
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $519
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $452
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $405
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $393
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $392
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $388
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $387
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $386
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $385
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $384
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $383
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $382
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $381
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $320
+byte 1 78
+byte 1 111
+byte 1 0
+align 1
+LABELV $319
+byte 1 89
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $318
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 50
+byte 1 46
+byte 1 49
+byte 1 50
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 56
+byte 1 46
+byte 1 56
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $317
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $316
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $313
+byte 1 94
+byte 1 50
+byte 1 0
+align 1
+LABELV $308
+byte 1 94
+byte 1 52
+byte 1 0
+align 1
+LABELV $248
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $245
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $221
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $215
+byte 1 0
+align 1
+LABELV $190
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $185
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $169
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $156
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $114
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $109
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $108
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 73
+byte 1 73
+byte 1 73
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $107
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $106
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 66
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 0
+align 1
+LABELV $105
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $104
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $103
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 54
+byte 1 0
+align 1
+LABELV $102
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 0
+align 1
+LABELV $101
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $100
+byte 1 79
+byte 1 83
+byte 1 80
+byte 1 0
+align 1
+LABELV $99
+byte 1 85
+byte 1 114
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $98
+byte 1 81
+byte 1 51
+byte 1 70
+byte 1 0
+align 1
+LABELV $97
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $96
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $95
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $94
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $93
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $92
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 77
+byte 1 0
+align 1
+LABELV $91
+byte 1 83
+byte 1 80
+byte 1 32
+byte 1 0
+align 1
+LABELV $90
+byte 1 49
+byte 1 118
+byte 1 49
+byte 1 0
+align 1
+LABELV $89
+byte 1 68
+byte 1 77
+byte 1 32
+byte 1 0
+align 1
+LABELV $88
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $87
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $86
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 112
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $85
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $84
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $83
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $82
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $81
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $80
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $79
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $78
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $77
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 53
+byte 1 0
+align 1
+LABELV $76
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 52
+byte 1 0
+align 1
+LABELV $75
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 51
+byte 1 0
+align 1
+LABELV $74
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $73
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $72
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $71
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
@@ -0,0 +1,1161 @@
+data
+align 4
+LABELV specifyserver_artlist
+address $71
+address $72
+address $73
+address $74
+address $75
+address $76
+byte 4 0
+code
+proc SpecifyServer_Event 272 16
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 102
+EQI4 $103
+ADDRLP4 256
+INDIRI4
+CNSTI4 103
+EQI4 $82
+ADDRGP4 $79
+JUMPV
+LABELV $82
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $83
+ADDRGP4 $80
+JUMPV
+LABELV $83
+ADDRGP4 s_specifyserver+4376+60+12
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $80
+ADDRLP4 0
+ARGP4
+ADDRGP4 s_specifyserver+4376+60+12
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 s_specifyserver+4708+60+12
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $93
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 264
+INDIRU4
+ADDRLP4 0
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $98
+ARGP4
+ADDRGP4 s_specifyserver+4708+60+12
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $93
+ADDRGP4 $102
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $80
+JUMPV
+LABELV $103
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $104
+ADDRGP4 $80
+JUMPV
+LABELV $104
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $79
+LABELV $80
+LABELV $78
+endproc SpecifyServer_Event 272 16
+export SpecifyServer_MenuInit
+proc SpecifyServer_MenuInit 0 16
+ADDRGP4 s_specifyserver
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5216
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 SpecifyServer_Cache
+CALLV
+pop
+ADDRGP4 s_specifyserver+4116
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_specifyserver+4120
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_specifyserver+4128
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_specifyserver+4128+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_specifyserver+4128+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_specifyserver+4128+60
+ADDRGP4 $116
+ASGNP4
+ADDRGP4 s_specifyserver+4128+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_specifyserver+4128+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_specifyserver+4200
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_specifyserver+4200+4
+ADDRGP4 $71
+ASGNP4
+ADDRGP4 s_specifyserver+4200+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_specifyserver+4200+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_specifyserver+4200+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_specifyserver+4200+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_specifyserver+4200+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_specifyserver+4288
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_specifyserver+4288+4
+ADDRGP4 $72
+ASGNP4
+ADDRGP4 s_specifyserver+4288+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_specifyserver+4288+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_specifyserver+4288+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_specifyserver+4288+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_specifyserver+4288+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_specifyserver+4376
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_specifyserver+4376+4
+ADDRGP4 $150
+ASGNP4
+ADDRGP4 s_specifyserver+4376+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_specifyserver+4376+12
+CNSTI4 206
+ASGNI4
+ADDRGP4 s_specifyserver+4376+16
+CNSTI4 220
+ASGNI4
+ADDRGP4 s_specifyserver+4376+60+8
+CNSTI4 38
+ASGNI4
+ADDRGP4 s_specifyserver+4376+60+268
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_specifyserver+4708
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_specifyserver+4708+4
+ADDRGP4 $166
+ASGNP4
+ADDRGP4 s_specifyserver+4708+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_specifyserver+4708+12
+CNSTI4 206
+ASGNI4
+ADDRGP4 s_specifyserver+4708+16
+CNSTI4 250
+ASGNI4
+ADDRGP4 s_specifyserver+4708+60+8
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_specifyserver+4708+60+268
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_specifyserver+5040
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_specifyserver+5040+4
+ADDRGP4 $75
+ASGNP4
+ADDRGP4 s_specifyserver+5040+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_specifyserver+5040+48
+ADDRGP4 SpecifyServer_Event
+ASGNP4
+ADDRGP4 s_specifyserver+5040+8
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_specifyserver+5040+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_specifyserver+5040+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_specifyserver+5040+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_specifyserver+5040+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_specifyserver+5040+60
+ADDRGP4 $76
+ASGNP4
+ADDRGP4 s_specifyserver+5128
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_specifyserver+5128+4
+ADDRGP4 $73
+ASGNP4
+ADDRGP4 s_specifyserver+5128+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_specifyserver+5128+48
+ADDRGP4 SpecifyServer_Event
+ASGNP4
+ADDRGP4 s_specifyserver+5128+8
+CNSTI4 102
+ASGNI4
+ADDRGP4 s_specifyserver+5128+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_specifyserver+5128+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_specifyserver+5128+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_specifyserver+5128+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_specifyserver+5128+60
+ADDRGP4 $74
+ASGNP4
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 s_specifyserver+4128
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 s_specifyserver+4200
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 s_specifyserver+4288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 s_specifyserver+4376
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 s_specifyserver+4708
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 s_specifyserver+5040
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 s_specifyserver+5128
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_specifyserver+4708+60+12
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRGP4 $227
+ARGP4
+CNSTI4 27960
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $106
+endproc SpecifyServer_MenuInit 0 16
+export SpecifyServer_Cache
+proc SpecifyServer_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $229
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 specifyserver_artlist
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $233
+ADDRGP4 $231
+JUMPV
+LABELV $233
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 specifyserver_artlist
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $230
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $231
+LABELV $228
+endproc SpecifyServer_Cache 4 4
+export UI_SpecifyServerMenu
+proc UI_SpecifyServerMenu 0 4
+ADDRGP4 SpecifyServer_MenuInit
+CALLV
+pop
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $235
+endproc UI_SpecifyServerMenu 0 4
+bss
+align 4
+LABELV s_specifyserver
+skip 5216
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_DrawConsoleLinesOver
+import trap_OpenWolfcamDirectory
+import trap_OpenQuakeLiveDirectory
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import ScrollList_Init
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_doubleClickTime
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $227
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $166
+byte 1 80
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $150
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $116
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 73
+byte 1 70
+byte 1 89
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $102
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $98
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $76
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $75
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $74
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $73
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $72
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $71
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
@@ -0,0 +1,9262 @@
+data
+align 4
+LABELV gametype_items
+address $72
+address $73
+address $74
+address $75
+byte 4 0
+align 4
+LABELV gametype_remap
+byte 4 0
+byte 4 3
+byte 4 1
+byte 4 5
+align 4
+LABELV gametype_remap2
+byte 4 0
+byte 4 2
+byte 4 0
+byte 4 1
+byte 4 3
+code
+proc GametypeBits 36 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $78
+JUMPV
+LABELV $77
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $80
+ADDRGP4 $79
+JUMPV
+LABELV $80
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $82
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $78
+JUMPV
+LABELV $82
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $87
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $85
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $78
+JUMPV
+LABELV $85
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $90
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $88
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRGP4 $78
+JUMPV
+LABELV $88
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $93
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $91
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $78
+JUMPV
+LABELV $91
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $94
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $94
+LABELV $78
+ADDRGP4 $77
+JUMPV
+LABELV $79
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $76
+endproc GametypeBits 36 8
+bss
+align 1
+LABELV $98
+skip 256
+code
+proc StartServer_Update 52 16
+ADDRLP4 20
+ADDRGP4 s_startserver+5788
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $100
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRGP4 s_startserver+5784
+INDIRI4
+LTI4 $104
+ADDRGP4 $123
+JUMPV
+LABELV $104
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+5796
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $98
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 36
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+44
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $98
+ADDP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+44
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 48
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+44
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+LABELV $101
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $100
+ADDRGP4 $123
+JUMPV
+LABELV $120
+ADDRLP4 28
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+4
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+44
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 36
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+44
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $121
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $123
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $120
+ADDRGP4 s_startserver+5784
+INDIRI4
+CNSTI4 0
+NEI4 $134
+ADDRLP4 28
+ADDRGP4 s_startserver+5528+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 s_startserver+5616+60
+INDIRP4
+ARGP4
+ADDRGP4 $141
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $135
+JUMPV
+LABELV $134
+ADDRLP4 28
+ADDRGP4 s_startserver+5528+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRLP4 0
+ADDRGP4 s_startserver+5780
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $145
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+GEI4 $145
+ADDRLP4 36
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+44
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 40
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+44
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+LABELV $145
+ADDRGP4 s_startserver+5780
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+5796
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 s_startserver+5616+60
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $135
+ADDRGP4 s_startserver+5616+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+LABELV $97
+endproc StartServer_Update 52 16
+proc StartServer_MapEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $158
+ADDRGP4 $157
+JUMPV
+LABELV $158
+ADDRGP4 s_startserver+5780
+ADDRGP4 s_startserver+5788
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 11
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+LABELV $157
+endproc StartServer_MapEvent 0 0
+proc StartServer_GametypeEvent 48 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $163
+ADDRGP4 $162
+JUMPV
+LABELV $163
+ADDRLP4 20
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+5784
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 28
+ADDRGP4 gametype_remap
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ADDRGP4 s_startserver+4376+64
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRGP4 s_startserver+4376+64
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $168
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+LABELV $168
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $175
+JUMPV
+LABELV $172
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 GametypeBits
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $177
+ADDRGP4 $173
+JUMPV
+LABELV $177
+ADDRGP4 s_startserver+5784
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+5796
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 s_startserver+5784
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $173
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $175
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $172
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_startserver+5792
+ADDRGP4 s_startserver+5784
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 32
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 s_startserver+5788
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+5780
+CNSTI4 0
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+LABELV $162
+endproc StartServer_GametypeEvent 48 8
+proc StartServer_MenuEvent 12 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $187
+ADDRGP4 $186
+JUMPV
+LABELV $187
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $189
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+GTI4 $189
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $209-60
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $209
+address $192
+address $197
+address $208
+address $203
+code
+LABELV $192
+ADDRGP4 s_startserver+5788
+INDIRI4
+CNSTI4 0
+LEI4 $190
+ADDRLP4 8
+ADDRGP4 s_startserver+5788
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+ADDRGP4 $190
+JUMPV
+LABELV $197
+ADDRGP4 s_startserver+5788
+INDIRI4
+ADDRGP4 s_startserver+5792
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $190
+ADDRLP4 8
+ADDRGP4 s_startserver+5788
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+ADDRGP4 $190
+JUMPV
+LABELV $203
+ADDRGP4 $204
+ARGP4
+ADDRGP4 s_startserver+4376+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_startserver+5776
+INDIRI4
+ARGI4
+ADDRGP4 UI_ServerOptionsMenu
+CALLV
+pop
+ADDRGP4 $190
+JUMPV
+LABELV $208
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $189
+LABELV $190
+LABELV $186
+endproc StartServer_MenuEvent 12 8
+proc StartServer_LevelshotDraw 80 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $212
+ADDRGP4 $211
+JUMPV
+LABELV $212
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $214
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $214
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $216
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $216
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $216
+LABELV $214
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $218
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $218
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+LABELV $218
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $220
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $220
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1105199104
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 64
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 s_startserver+5788
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 11
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LSHI4
+ADDRGP4 s_startserver+5796
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 28
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 64
+BANDU4
+CNSTU4 0
+EQU4 $224
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $224
+LABELV $211
+endproc StartServer_LevelshotDraw 80 20
+bss
+align 1
+LABELV $227
+skip 64
+code
+proc StartServer_MenuInit 32 12
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 9892
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 StartServer_Cache
+CALLV
+pop
+ADDRGP4 s_startserver+4116
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+4120
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+4128
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_startserver+4128+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_startserver+4128+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_startserver+4128+60
+ADDRGP4 $237
+ASGNP4
+ADDRGP4 s_startserver+4128+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_startserver+4128+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+4200
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+4200+4
+ADDRGP4 $245
+ASGNP4
+ADDRGP4 s_startserver+4200+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+4200+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+4200+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_startserver+4200+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_startserver+4200+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_startserver+4288
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+4288+4
+ADDRGP4 $259
+ASGNP4
+ADDRGP4 s_startserver+4288+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+4288+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_startserver+4288+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_startserver+4288+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_startserver+4288+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_startserver+4376
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_startserver+4376+4
+ADDRGP4 $273
+ASGNP4
+ADDRGP4 s_startserver+4376+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_startserver+4376+48
+ADDRGP4 StartServer_GametypeEvent
+ASGNP4
+ADDRGP4 s_startserver+4376+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_startserver+4376+12
+CNSTI4 296
+ASGNI4
+ADDRGP4 s_startserver+4376+16
+CNSTI4 368
+ASGNI4
+ADDRGP4 s_startserver+4376+76
+ADDRGP4 gametype_items
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $286
+ADDRLP4 12
+CNSTI4 136
+ASGNI4
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+MULI4
+CNSTI4 188
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+CNSTI4 96
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+44
+ADDP4
+CNSTU4 16388
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+76
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+80
+ADDP4
+CNSTI4 96
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+60
+ADDP4
+ADDRGP4 $305
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+64
+ADDP4
+ADDRGP4 $308
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472+56
+ADDP4
+ADDRGP4 StartServer_LevelshotDraw
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+44
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+48
+ADDP4
+ADDRGP4 StartServer_MapEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+76
+ADDP4
+CNSTI4 256
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+80
+ADDP4
+CNSTI4 248
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+28
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+32
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824+60
+ADDP4
+ADDRGP4 $336
+ASGNP4
+LABELV $287
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $286
+ADDRGP4 s_startserver+5176
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+5176+4
+ADDRGP4 $340
+ASGNP4
+ADDRGP4 s_startserver+5176+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+5176+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 s_startserver+5176+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+5176+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+5176+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+5264
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+5264+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+5264+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+5264+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_startserver+5264+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 s_startserver+5264+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+5264+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+5264+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+5264+60
+ADDRGP4 $368
+ASGNP4
+ADDRGP4 s_startserver+5352
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+5352+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+5352+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+5352+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_startserver+5352+12
+CNSTI4 321
+ASGNI4
+ADDRGP4 s_startserver+5352+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+5352+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+5352+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+5352+60
+ADDRGP4 $386
+ASGNP4
+ADDRGP4 s_startserver+5616
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_startserver+5616+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_startserver+5616+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_startserver+5616+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_startserver+5616+60
+ADDRGP4 $227
+ASGNP4
+ADDRGP4 s_startserver+5616+64
+CNSTI4 33
+ASGNI4
+ADDRGP4 s_startserver+5616+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_startserver+5440
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+5440+4
+ADDRGP4 $403
+ASGNP4
+ADDRGP4 s_startserver+5440+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+5440+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+5440+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_startserver+5440+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+5440+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_startserver+5440+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+5440+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+5440+60
+ADDRGP4 $420
+ASGNP4
+ADDRGP4 s_startserver+5528
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+5528+4
+ADDRGP4 $424
+ASGNP4
+ADDRGP4 s_startserver+5528+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_startserver+5528+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+5528+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_startserver+5528+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+5528+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_startserver+5528+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+5528+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+5528+60
+ADDRGP4 $441
+ASGNP4
+ADDRGP4 s_startserver+5688
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+5688+44
+CNSTU4 1050628
+ASGNU4
+ADDRGP4 s_startserver+5688+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+5688+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+5688+76
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+5688+80
+CNSTI4 480
+ASGNI4
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+4128
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+4200
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+4288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+4376
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $457
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4472
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+4824
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $458
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $457
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+5176
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+5264
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+5352
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+5440
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+5528
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+5616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+5688
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 StartServer_GametypeEvent
+CALLV
+pop
+LABELV $226
+endproc StartServer_MenuInit 32 12
+export StartServer_Cache
+proc StartServer_Cache 104 16
+ADDRGP4 $403
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $420
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $424
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $441
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $245
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $259
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $336
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $305
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $308
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $340
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $368
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $386
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $471
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 92
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $472
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $477
+JUMPV
+LABELV $474
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 68
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $475
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $477
+ADDRLP4 96
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $474
+LABELV $472
+LABELV $470
+endproc StartServer_Cache 104 16
+export UI_StartServerMenu
+proc UI_StartServerMenu 0 4
+ADDRGP4 StartServer_MenuInit
+CALLV
+pop
+ADDRGP4 s_startserver+5776
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $478
+endproc UI_StartServerMenu 0 4
+data
+align 4
+LABELV dedicated_list
+address $481
+address $482
+address $483
+byte 4 0
+align 4
+LABELV playerType_list
+address $484
+address $485
+address $486
+byte 4 0
+align 4
+LABELV playerTeam_list
+address $487
+address $488
+byte 4 0
+align 4
+LABELV botSkill_list
+address $489
+address $490
+address $491
+address $492
+address $493
+byte 4 0
+code
+proc BotAlreadySelected 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $495
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+64
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $499
+ADDRGP4 $496
+JUMPV
+LABELV $499
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+LTI4 $503
+ADDRLP4 4
+CNSTI4 96
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112+64
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_serveroptions+9764
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112+64
+ADDP4
+INDIRI4
+EQI4 $503
+ADDRGP4 $496
+JUMPV
+LABELV $503
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+9568
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $511
+CNSTI4 1
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $511
+LABELV $496
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $495
+CNSTI4 0
+RETI4
+LABELV $494
+endproc BotAlreadySelected 12 8
+proc ServerOptions_Start 168 24
+ADDRGP4 s_serveroptions+4472+60+12
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+4804+60+12
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5136+60+12
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRGP4 s_serveroptions+4376+64
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRGP4 s_serveroptions+5468+60
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 s_serveroptions+5864+60
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRGP4 s_serveroptions+5928+64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRGP4 $535
+JUMPV
+LABELV $532
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $536
+ADDRGP4 $533
+JUMPV
+LABELV $536
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $540
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+9568
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $540
+ADDRGP4 $533
+JUMPV
+LABELV $540
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $533
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $535
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $532
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 1
+NEI4 $545
+ADDRGP4 $548
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $549
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $546
+JUMPV
+LABELV $545
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+NEI4 $550
+ADDRGP4 $553
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $554
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $555
+ARGP4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 5
+NEI4 $556
+ADDRGP4 $559
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $560
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $561
+ARGP4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $557
+JUMPV
+LABELV $556
+ADDRGP4 $562
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $563
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $557
+LABELV $551
+LABELV $546
+CNSTF4 0
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 120
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $564
+ARGP4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 124
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $565
+ARGP4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 128
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 132
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $566
+ARGP4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 136
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $567
+ARGP4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 144
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $568
+ARGP4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $569
+ARGP4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $570
+ARGP4
+ADDRLP4 96
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $571
+ARGP4
+ADDRGP4 s_serveroptions+5532+60+12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $575
+ARGP4
+ADDRGP4 s_serveroptions+9784+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_startserver+5780
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+5796
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 100
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 156
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $580
+ARGP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $581
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $582
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+64
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $586
+ADDRGP4 $583
+JUMPV
+LABELV $586
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+9568
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $590
+ADDRGP4 $583
+JUMPV
+LABELV $590
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+9568
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $593
+ADDRGP4 $583
+JUMPV
+LABELV $593
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+LTI4 $596
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $599
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+9568
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112+64
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playerTeam_list
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $597
+JUMPV
+LABELV $596
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $603
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+9568
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $597
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $583
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $582
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $605
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+LTI4 $605
+ADDRGP4 $608
+ARGP4
+ADDRGP4 s_serveroptions+8112+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playerTeam_list
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $611
+ARGP4
+ADDRGP4 s_serveroptions+8112+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playerTeam_list
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $605
+LABELV $514
+endproc ServerOptions_Start 168 24
+proc ServerOptions_InitPlayerItems 12 12
+ADDRGP4 s_serveroptions+9528
+INDIRI4
+CNSTI4 0
+EQI4 $615
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $616
+JUMPV
+LABELV $615
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $616
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $618
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+64
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $619
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $618
+ADDRGP4 s_serveroptions+9528
+INDIRI4
+CNSTI4 0
+EQI4 $624
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+GEI4 $624
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+LABELV $628
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+64
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $629
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $628
+LABELV $624
+ADDRGP4 s_serveroptions+4376+64
+INDIRI4
+CNSTI4 0
+NEI4 $634
+ADDRLP4 8
+ADDRGP4 s_serveroptions+6096+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 s_serveroptions+6096+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $642
+ARGP4
+ADDRGP4 s_serveroptions+9568
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_serveroptions+9568
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+LABELV $634
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+LTI4 $646
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $649
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112+64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $650
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $649
+ADDRGP4 $658
+JUMPV
+LABELV $655
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112+64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $656
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $658
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $655
+ADDRGP4 $647
+JUMPV
+LABELV $646
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $661
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $662
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $661
+LABELV $647
+LABELV $614
+endproc ServerOptions_InitPlayerItems 12 12
+proc ServerOptions_SetPlayerItems 12 0
+ADDRGP4 s_serveroptions+4376+64
+INDIRI4
+CNSTI4 0
+NEI4 $668
+ADDRGP4 s_serveroptions+6024+60
+ADDRGP4 $674
+ASGNP4
+ADDRLP4 8
+ADDRGP4 s_serveroptions+7248+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294963199
+BANDU4
+ASGNU4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $669
+JUMPV
+LABELV $668
+ADDRGP4 s_serveroptions+6024+60
+ADDRGP4 $484
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $669
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $682
+JUMPV
+LABELV $679
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $683
+ADDRLP4 8
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 $684
+JUMPV
+LABELV $683
+ADDRLP4 8
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $684
+LABELV $680
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $682
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $679
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+GEI4 $691
+ADDRGP4 $667
+JUMPV
+LABELV $691
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $697
+JUMPV
+LABELV $694
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $698
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $699
+JUMPV
+LABELV $698
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $699
+LABELV $695
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $697
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $694
+LABELV $667
+endproc ServerOptions_SetPlayerItems 12 0
+proc ServerOptions_Event 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+LTI4 $707
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+GTI4 $707
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $723-72
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $723
+address $717
+address $707
+address $710
+address $713
+address $713
+address $714
+address $720
+code
+LABELV $710
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $711
+ADDRGP4 $708
+JUMPV
+LABELV $711
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 $708
+JUMPV
+LABELV $713
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 $708
+JUMPV
+LABELV $714
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $715
+ADDRGP4 $708
+JUMPV
+LABELV $715
+ADDRGP4 ServerOptions_Start
+CALLV
+pop
+ADDRGP4 $708
+JUMPV
+LABELV $717
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $708
+ADDRGP4 $708
+JUMPV
+LABELV $720
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $721
+ADDRGP4 $708
+JUMPV
+LABELV $721
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $707
+LABELV $708
+LABELV $706
+endproc ServerOptions_Event 8 0
+proc ServerOptions_PlayerNameEvent 4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $726
+ADDRGP4 $725
+JUMPV
+LABELV $726
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+9764
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+9568
+ADDP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu
+CALLV
+pop
+LABELV $725
+endproc ServerOptions_PlayerNameEvent 4 4
+proc ServerOptions_StatusBar 4 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $731
+JUMPV
+LABELV $731
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $734
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $732
+LABELV $730
+endproc ServerOptions_StatusBar 4 20
+proc ServerOptions_LevelshotDraw 20 20
+ADDRGP4 s_serveroptions+9760
+INDIRI4
+CNSTI4 0
+EQI4 $736
+ADDRGP4 s_serveroptions+9764
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+9568
+ADDP4
+ARGP4
+ADDRGP4 s_serveroptions+9768
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+9760
+CNSTI4 0
+ASGNI4
+LABELV $736
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bitmap_Draw
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 s_serveroptions+9536
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 gametype_remap2
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 gametype_items
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $735
+endproc ServerOptions_LevelshotDraw 20 20
+proc ServerOptions_InitBotNames 1072 12
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+LTI4 $746
+ADDRGP4 s_serveroptions+9568+16
+ARGP4
+ADDRGP4 $751
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+9568+32
+ARGP4
+ADDRGP4 $754
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+NEI4 $755
+ADDRGP4 s_serveroptions+9568+48
+ARGP4
+ADDRGP4 $760
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $756
+JUMPV
+LABELV $755
+ADDRGP4 s_serveroptions+6096+288+64
+CNSTI4 2
+ASGNI4
+LABELV $756
+ADDRGP4 s_serveroptions+6096+384+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+6096+480+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+9568+96
+ARGP4
+ADDRGP4 $772
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+9568+112
+ARGP4
+ADDRGP4 $751
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+9568+128
+ARGP4
+ADDRGP4 $754
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+NEI4 $777
+ADDRGP4 s_serveroptions+9568+144
+ARGP4
+ADDRGP4 $760
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $778
+JUMPV
+LABELV $777
+ADDRGP4 s_serveroptions+6096+864+64
+CNSTI4 2
+ASGNI4
+LABELV $778
+ADDRGP4 s_serveroptions+6096+960+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+6096+1056+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 $745
+JUMPV
+LABELV $746
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+9536
+ARGP4
+ADDRLP4 1048
+ADDRGP4 UI_GetArenaInfoByMap
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 $792
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20
+ASGNP4
+ADDRGP4 $794
+JUMPV
+LABELV $796
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $797
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $799
+ADDRLP4 1056
+INDIRI4
+CNSTI4 32
+EQI4 $796
+LABELV $799
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $800
+ADDRGP4 $795
+JUMPV
+LABELV $800
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $803
+JUMPV
+LABELV $802
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $803
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $805
+ADDRLP4 1060
+INDIRI4
+CNSTI4 32
+NEI4 $802
+LABELV $805
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $806
+ADDRLP4 1064
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1064
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $806
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 UI_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 1064
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $808
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+LABELV $808
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $642
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+9568
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $794
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $812
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+LTI4 $797
+LABELV $812
+LABELV $795
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $816
+JUMPV
+LABELV $813
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+9568
+ADDP4
+ARGP4
+ADDRGP4 $818
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $814
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $816
+ADDRLP4 16
+INDIRI4
+CNSTI4 12
+LTI4 $813
+ADDRGP4 $822
+JUMPV
+LABELV $819
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $820
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $822
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $819
+ADDRGP4 $828
+JUMPV
+LABELV $825
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $829
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+64
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $829
+LABELV $826
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $828
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+LTI4 $825
+LABELV $745
+endproc ServerOptions_InitBotNames 1072 12
+bss
+align 1
+LABELV $836
+skip 64
+code
+proc ServerOptions_SetMenuItems 44 16
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 1
+NEI4 $837
+ADDRGP4 $548
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+4804+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $843
+ARGP4
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $549
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+4472+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $843
+ARGP4
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $838
+JUMPV
+LABELV $837
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+NEI4 $847
+ADDRGP4 $553
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+4804+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $843
+ARGP4
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $554
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+4472+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $843
+ARGP4
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $555
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5468+60
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $848
+JUMPV
+LABELV $847
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 5
+NEI4 $858
+ADDRGP4 $559
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5136+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $843
+ARGP4
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $560
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+4472+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $843
+ARGP4
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $561
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5468+60
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $859
+JUMPV
+LABELV $858
+ADDRGP4 $562
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+4804+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $843
+ARGP4
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $563
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+4472+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $843
+ARGP4
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $859
+LABELV $848
+LABELV $838
+ADDRGP4 $571
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+5532+60+12
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $570
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5864+60
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_startserver+5780
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+5796
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 $836
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 s_serveroptions+4200+4
+ADDRGP4 $836
+ASGNP4
+ADDRGP4 s_serveroptions+9536
+ARGP4
+ADDRGP4 s_startserver+5616+60
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 s_serveroptions+9536
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 ServerOptions_InitPlayerItems
+CALLV
+pop
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 ServerOptions_InitBotNames
+CALLV
+pop
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+LABELV $835
+endproc ServerOptions_SetMenuItems 44 16
+proc PlayerName_Draw 52 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 16
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $893
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $894
+JUMPV
+LABELV $893
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $894
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $895
+ADDRLP4 4
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $896
+JUMPV
+LABELV $895
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $897
+ADDRLP4 4
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $898
+JUMPV
+LABELV $897
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 1
+BANDU4
+CNSTU4 0
+EQU4 $899
+ADDRLP4 4
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRGP4 $900
+JUMPV
+LABELV $899
+ADDRLP4 4
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $900
+LABELV $898
+LABELV $896
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $901
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $901
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+BORI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $891
+endproc PlayerName_Draw 52 20
+proc ServerOptions_MenuInit 52 12
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 9880
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 s_serveroptions+9528
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $906
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+9532
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $575
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+9784+64
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 ServerOptions_Cache
+CALLV
+pop
+ADDRGP4 s_serveroptions+4116
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+4120
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+4128
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_serveroptions+4128+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+4128+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_serveroptions+4128+60
+ADDRGP4 $237
+ASGNP4
+ADDRGP4 s_serveroptions+4128+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_serveroptions+4128+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+4200
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+4200+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_serveroptions+4200+12
+CNSTI4 352
+ASGNI4
+ADDRGP4 s_serveroptions+4200+16
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_serveroptions+4200+76
+CNSTI4 160
+ASGNI4
+ADDRGP4 s_serveroptions+4200+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 s_serveroptions+4200+64
+ADDRGP4 $308
+ASGNP4
+ADDRGP4 s_serveroptions+4200+56
+ADDRGP4 ServerOptions_LevelshotDraw
+ASGNP4
+ADDRGP4 s_serveroptions+4288
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+4288+44
+CNSTU4 16452
+ASGNU4
+ADDRGP4 s_serveroptions+4288+12
+CNSTI4 314
+ASGNI4
+ADDRGP4 s_serveroptions+4288+16
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_serveroptions+4288+76
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+4288+80
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+4288+60
+ADDRGP4 $336
+ASGNP4
+ADDRLP4 4
+CNSTI4 272
+ASGNI4
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 5
+EQI4 $950
+ADDRGP4 s_serveroptions+4804
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+4804+4
+ADDRGP4 $956
+ASGNP4
+ADDRGP4 s_serveroptions+4804+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+4804+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+4804+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+4804+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+4804+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+4804+60+268
+CNSTI4 3
+ASGNI4
+ADDRGP4 $951
+JUMPV
+LABELV $950
+ADDRGP4 s_serveroptions+5136
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+5136+4
+ADDRGP4 $974
+ASGNP4
+ADDRGP4 s_serveroptions+5136+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+5136+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+5136+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5136+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+5136+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+5136+60+268
+CNSTI4 3
+ASGNI4
+LABELV $951
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+4472
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+4472+4
+ADDRGP4 $992
+ASGNP4
+ADDRGP4 s_serveroptions+4472+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+4472+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+4472+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+4472+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+4472+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+4472+60+268
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+LTI4 $1007
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+5468
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+5468+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+5468+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+5468+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5468+4
+ADDRGP4 $1019
+ASGNP4
+LABELV $1007
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+5864
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+5864+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+5864+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+5864+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5864+4
+ADDRGP4 $1029
+ASGNP4
+ADDRGP4 s_serveroptions+9528
+INDIRI4
+CNSTI4 0
+EQI4 $1030
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+4376
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+4376+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_serveroptions+4376+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+4376+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+4376+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+4376+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+4376+4
+ADDRGP4 $1046
+ASGNP4
+ADDRGP4 s_serveroptions+4376+76
+ADDRGP4 dedicated_list
+ASGNP4
+LABELV $1030
+ADDRGP4 s_serveroptions+9528
+INDIRI4
+CNSTI4 0
+EQI4 $1049
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+5532
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+5532+4
+ADDRGP4 $1055
+ASGNP4
+ADDRGP4 s_serveroptions+5532+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_serveroptions+5532+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+5532+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5532+60+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_serveroptions+5532+60+268
+CNSTI4 64
+ASGNI4
+LABELV $1049
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+9784
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+9784+4
+ADDRGP4 $1071
+ASGNP4
+ADDRGP4 s_serveroptions+9784+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+9784+8
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_serveroptions+9784+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+9784+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+9784+76
+ADDRGP4 punkbuster_items
+ASGNP4
+ADDRLP4 4
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_serveroptions+5928
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+5928+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+5928+4
+ADDRGP4 $1087
+ASGNP4
+ADDRGP4 s_serveroptions+5928+4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 s_serveroptions+5928+12
+ADDRLP4 24
+INDIRU4
+CNSTU4 2
+ADDU4
+CNSTI4 3
+LSHU4
+CNSTU4 32
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+5928+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5928+76
+ADDRGP4 botSkill_list
+ASGNP4
+ADDRGP4 s_serveroptions+5928+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+6024
+CNSTI4 7
+ASGNI4
+ADDRGP4 s_serveroptions+6024+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_serveroptions+6024+12
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_serveroptions+6024+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+6024+68
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_serveroptions+6024+64
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1109
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096
+ADDP4
+CNSTI4 3
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+8
+ADDP4
+CNSTI4 20
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+48
+ADDP4
+ADDRGP4 ServerOptions_Event
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+12
+ADDP4
+CNSTI4 32
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096+76
+ADDP4
+ADDRGP4 playerType_list
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248
+ADDP4
+CNSTI4 7
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248+12
+ADDP4
+CNSTI4 96
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248+48
+ADDP4
+ADDRGP4 ServerOptions_PlayerNameEvent
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248+56
+ADDP4
+ADDRGP4 PlayerName_Draw
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248+64
+ADDP4
+CNSTI4 16
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+9568
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 s_serveroptions+7248+24
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 s_serveroptions+7248+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 s_serveroptions+7248+32
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 s_serveroptions+7248+16
+ADDP4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 s_serveroptions+7248+20
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 s_serveroptions+7248+12
+ADDP4
+INDIRI4
+CNSTI4 8
+SUBI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 s_serveroptions+7248+28
+ADDP4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 s_serveroptions+7248+12
+ADDP4
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112
+ADDP4
+CNSTI4 3
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112+12
+ADDP4
+CNSTI4 240
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112+76
+ADDP4
+ADDRGP4 playerTeam_list
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $1110
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $1109
+ADDRGP4 s_serveroptions+9440
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+9440+4
+ADDRGP4 $403
+ASGNP4
+ADDRGP4 s_serveroptions+9440+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_serveroptions+9440+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+9440+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 s_serveroptions+9440+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_serveroptions+9440+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_serveroptions+9440+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+9440+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+9440+60
+ADDRGP4 $420
+ASGNP4
+ADDRGP4 s_serveroptions+9352
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+9352+4
+ADDRGP4 $424
+ASGNP4
+ADDRGP4 s_serveroptions+9352+44
+CNSTU4 28944
+ASGNU4
+ADDRGP4 s_serveroptions+9352+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+9352+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_serveroptions+9352+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_serveroptions+9352+16
+CNSTI4 344
+ASGNI4
+ADDRGP4 s_serveroptions+9352+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+9352+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+9352+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+9352+60
+ADDRGP4 $441
+ASGNP4
+ADDRGP4 s_serveroptions+9264
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+9264+4
+ADDRGP4 $1214
+ASGNP4
+ADDRGP4 s_serveroptions+9264+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_serveroptions+9264+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+9264+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 s_serveroptions+9264+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_serveroptions+9264+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_serveroptions+9264+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+9264+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+9264+60
+ADDRGP4 $1231
+ASGNP4
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+4128
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+4200
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+4288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5928
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+6024
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1237
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1241
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6096
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1241
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7248
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+LTI4 $1245
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+8112
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1245
+LABELV $1238
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $1237
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 5
+EQI4 $1249
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+4804
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $1250
+JUMPV
+LABELV $1249
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5136
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1250
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+4472
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+9532
+INDIRI4
+CNSTI4 3
+LTI4 $1255
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5468
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1255
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5864
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+9528
+INDIRI4
+CNSTI4 0
+EQI4 $1260
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+4376
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1260
+ADDRGP4 s_serveroptions+9528
+INDIRI4
+CNSTI4 0
+EQI4 $1264
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5532
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1264
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+9440
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+9352
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+9264
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+9784
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 ServerOptions_SetMenuItems
+CALLV
+pop
+LABELV $903
+endproc ServerOptions_MenuInit 52 12
+export ServerOptions_Cache
+proc ServerOptions_Cache 0 4
+ADDRGP4 $403
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $420
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1214
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1231
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $336
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $308
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1272
+endproc ServerOptions_Cache 0 4
+proc UI_ServerOptionsMenu 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ServerOptions_MenuInit
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1273
+endproc UI_ServerOptionsMenu 0 4
+proc UI_BotSelectMenu_SortCompare 44 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $642
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $642
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+RETI4
+LABELV $1275
+endproc UI_BotSelectMenu_SortCompare 44 8
+proc UI_BotSelectMenu_BuildList 12 16
+ADDRGP4 botSelectInfo+8612
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+8608
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 botSelectInfo+8616
+ADDRGP4 botSelectInfo+8608
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 botSelectInfo+8608
+INDIRI4
+CNSTI4 16
+MODI4
+CNSTI4 0
+EQI4 $1281
+ADDRLP4 8
+ADDRGP4 botSelectInfo+8616
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1281
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1288
+JUMPV
+LABELV $1285
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+8624
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1286
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1288
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+8608
+INDIRI4
+LTI4 $1285
+ADDRGP4 botSelectInfo+8624
+ARGP4
+ADDRGP4 botSelectInfo+8608
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 4
+ARGU4
+ADDRGP4 UI_BotSelectMenu_SortCompare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $1276
+endproc UI_BotSelectMenu_BuildList 12 16
+proc ServerPlayerIcon 80 20
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1295
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1296
+JUMPV
+LABELV $1295
+ADDRLP4 0
+ADDRGP4 $1297
+ASGNP4
+LABELV $1296
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1298
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $1299
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1297
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $1299
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1301
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $1299
+LABELV $1294
+endproc ServerPlayerIcon 80 20
+proc UI_BotSelectMenu_UpdateGrid 36 12
+ADDRLP4 4
+ADDRGP4 botSelectInfo+8612
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1304
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+8608
+INDIRI4
+GEI4 $1308
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+8624
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1312
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+12720
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 ServerPlayerIcon
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $642
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+13744
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+13744
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+12720
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+13744
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 BotAlreadySelected
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1319
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+7016+68
+ADDP4
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 $1320
+JUMPV
+LABELV $1319
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+7016+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+LABELV $1320
+ADDRLP4 32
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+44
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $1309
+JUMPV
+LABELV $1308
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+13744
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1309
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $1305
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1304
+ADDRLP4 0
+ADDRGP4 botSelectInfo+8620
+INDIRI4
+CNSTI4 16
+MODI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 20
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRGP4 botSelectInfo+8616
+INDIRI4
+CNSTI4 1
+LEI4 $1344
+ADDRGP4 botSelectInfo+8612
+INDIRI4
+CNSTI4 0
+LEI4 $1347
+ADDRLP4 24
+ADDRGP4 botSelectInfo+8256+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $1348
+JUMPV
+LABELV $1347
+ADDRLP4 24
+ADDRGP4 botSelectInfo+8256+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $1348
+ADDRGP4 botSelectInfo+8612
+INDIRI4
+ADDRGP4 botSelectInfo+8616
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1354
+ADDRLP4 24
+ADDRGP4 botSelectInfo+8344+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $1345
+JUMPV
+LABELV $1354
+ADDRLP4 24
+ADDRGP4 botSelectInfo+8344+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 $1345
+JUMPV
+LABELV $1344
+ADDRLP4 24
+ADDRGP4 botSelectInfo+8256+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 28
+ADDRGP4 botSelectInfo+8344+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $1345
+LABELV $1302
+endproc UI_BotSelectMenu_UpdateGrid 36 12
+proc UI_BotSelectMenu_Default 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1370
+JUMPV
+LABELV $1367
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $642
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $1372
+ADDRGP4 $1369
+JUMPV
+LABELV $1372
+LABELV $1368
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1370
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+8608
+INDIRI4
+LTI4 $1367
+LABELV $1369
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+8608
+INDIRI4
+NEI4 $1374
+ADDRGP4 botSelectInfo+8620
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1366
+JUMPV
+LABELV $1374
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1381
+JUMPV
+LABELV $1378
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+8624
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1383
+ADDRGP4 $1380
+JUMPV
+LABELV $1383
+LABELV $1379
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1381
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+8608
+INDIRI4
+LTI4 $1378
+LABELV $1380
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+8608
+INDIRI4
+NEI4 $1386
+ADDRGP4 botSelectInfo+8620
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1366
+JUMPV
+LABELV $1386
+ADDRGP4 botSelectInfo+8620
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1366
+endproc UI_BotSelectMenu_Default 28 8
+proc UI_BotSelectMenu_LeftEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1392
+ADDRGP4 $1391
+JUMPV
+LABELV $1392
+ADDRGP4 botSelectInfo+8612
+INDIRI4
+CNSTI4 0
+LEI4 $1394
+ADDRLP4 0
+ADDRGP4 botSelectInfo+8612
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 botSelectInfo+8620
+ADDRGP4 botSelectInfo+8612
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1394
+LABELV $1391
+endproc UI_BotSelectMenu_LeftEvent 4 0
+proc UI_BotSelectMenu_RightEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1401
+ADDRGP4 $1400
+JUMPV
+LABELV $1401
+ADDRGP4 botSelectInfo+8612
+INDIRI4
+ADDRGP4 botSelectInfo+8616
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1403
+ADDRLP4 0
+ADDRGP4 botSelectInfo+8612
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 botSelectInfo+8620
+ADDRGP4 botSelectInfo+8612
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1403
+LABELV $1400
+endproc UI_BotSelectMenu_RightEvent 4 0
+proc UI_BotSelectMenu_BotEvent 12 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1411
+ADDRGP4 $1410
+JUMPV
+LABELV $1411
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1413
+ADDRLP4 4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $1414
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1413
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRGP4 botSelectInfo+8620
+ADDRGP4 botSelectInfo+8612
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1410
+endproc UI_BotSelectMenu_BotEvent 12 0
+proc UI_BotSelectMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1428
+ADDRGP4 $1427
+JUMPV
+LABELV $1428
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $1427
+endproc UI_BotSelectMenu_BackEvent 0 0
+proc UI_BotSelectMenu_SelectEvent 4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1431
+ADDRGP4 $1430
+JUMPV
+LABELV $1431
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 s_serveroptions+9760
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+9768
+ARGP4
+ADDRLP4 0
+CNSTI4 16
+ASGNI4
+ADDRGP4 botSelectInfo+8620
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+13744
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1430
+endproc UI_BotSelectMenu_SelectEvent 4 12
+export UI_BotSelectMenu_Cache
+proc UI_BotSelectMenu_Cache 0 4
+ADDRGP4 $403
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $420
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1438
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1439
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1440
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1441
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $340
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $368
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $386
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1437
+endproc UI_BotSelectMenu_Cache 0 4
+proc UI_BotSelectMenu_Init 36 12
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 14000
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 botSelectInfo+4116
+CNSTI4 1
+ASGNI4
+ADDRGP4 botSelectInfo+4120
+CNSTI4 1
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_Cache
+CALLV
+pop
+ADDRGP4 botSelectInfo+4128
+CNSTI4 10
+ASGNI4
+ADDRGP4 botSelectInfo+4128+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 botSelectInfo+4128+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 botSelectInfo+4128+60
+ADDRGP4 $1452
+ASGNP4
+ADDRGP4 botSelectInfo+4128+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 botSelectInfo+4128+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+CNSTI4 80
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $1460
+JUMPV
+LABELV $1457
+ADDRLP4 4
+CNSTI4 180
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1461
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+44
+ADDP4
+CNSTU4 16388
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+12720
+ADDP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+76
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+80
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+60
+ADDP4
+ADDRGP4 $1441
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+44
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+48
+ADDP4
+ADDRGP4 UI_BotSelectMenu_BotEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+28
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+32
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+76
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+80
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+60
+ADDP4
+ADDRGP4 $1440
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+7016
+ADDP4
+CNSTI4 7
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+7016+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+7016+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+7016+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+7016+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+13744
+ADDP4
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+7016+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+7016+64
+ADDP4
+CNSTI4 17
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $1462
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $1461
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 86
+ADDI4
+ASGNI4
+LABELV $1458
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1460
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LTI4 $1457
+ADDRGP4 botSelectInfo+8168
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+8168+4
+ADDRGP4 $340
+ASGNP4
+ADDRGP4 botSelectInfo+8168+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 botSelectInfo+8168+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 botSelectInfo+8168+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+8168+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+8168+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+8256
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+8256+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+8256+48
+ADDRGP4 UI_BotSelectMenu_LeftEvent
+ASGNP4
+ADDRGP4 botSelectInfo+8256+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 botSelectInfo+8256+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+8256+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+8256+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+8256+60
+ADDRGP4 $368
+ASGNP4
+ADDRGP4 botSelectInfo+8344
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+8344+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+8344+48
+ADDRGP4 UI_BotSelectMenu_RightEvent
+ASGNP4
+ADDRGP4 botSelectInfo+8344+12
+CNSTI4 321
+ASGNI4
+ADDRGP4 botSelectInfo+8344+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+8344+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+8344+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+8344+60
+ADDRGP4 $386
+ASGNP4
+ADDRGP4 botSelectInfo+8520
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+8520+4
+ADDRGP4 $403
+ASGNP4
+ADDRGP4 botSelectInfo+8520+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+8520+48
+ADDRGP4 UI_BotSelectMenu_BackEvent
+ASGNP4
+ADDRGP4 botSelectInfo+8520+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 botSelectInfo+8520+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 botSelectInfo+8520+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+8520+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+8520+60
+ADDRGP4 $420
+ASGNP4
+ADDRGP4 botSelectInfo+8432
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+8432+4
+ADDRGP4 $1438
+ASGNP4
+ADDRGP4 botSelectInfo+8432+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 botSelectInfo+8432+48
+ADDRGP4 UI_BotSelectMenu_SelectEvent
+ASGNP4
+ADDRGP4 botSelectInfo+8432+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 botSelectInfo+8432+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 botSelectInfo+8432+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+8432+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+8432+60
+ADDRGP4 $1439
+ASGNP4
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4128
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $1602
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+4200
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5608
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 72
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+7016
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1603
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+LTI4 $1602
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+8168
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+8256
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+8344
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+8520
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+8432
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 UI_BotSelectMenu_BuildList
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu_Default
+CALLV
+pop
+ADDRGP4 botSelectInfo+8612
+ADDRGP4 botSelectInfo+8620
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1442
+endproc UI_BotSelectMenu_Init 36 12
+export UI_BotSelectMenu
+proc UI_BotSelectMenu 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu_Init
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1616
+endproc UI_BotSelectMenu 0 4
+bss
+align 4
+LABELV botSelectInfo
+skip 14000
+align 4
+LABELV s_serveroptions
+skip 9880
+import punkbuster_items
+align 4
+LABELV s_startserver
+skip 9892
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_DrawConsoleLinesOver
+import trap_OpenWolfcamDirectory
+import trap_OpenQuakeLiveDirectory
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import ScrollList_Init
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_doubleClickTime
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1452
+byte 1 83
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 32
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $1441
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1440
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1439
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1438
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1312
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1301
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1298
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1297
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1231
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1214
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1087
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $1071
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1055
+byte 1 72
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $1046
+byte 1 68
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 0
+align 1
+LABELV $1029
+byte 1 80
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1019
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $992
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $974
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $956
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $906
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $843
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $818
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 0
+align 1
+LABELV $792
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $772
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $760
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $754
+byte 1 109
+byte 1 97
+byte 1 106
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $751
+byte 1 103
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $734
+byte 1 48
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 79
+byte 1 32
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $674
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $642
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $611
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $608
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 53
+byte 1 59
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $603
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $599
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $581
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $580
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $575
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $571
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $570
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $569
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $568
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $567
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $566
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $565
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $564
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $563
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $562
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $561
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $560
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $559
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $555
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $554
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $553
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $549
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $548
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $493
+byte 1 78
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $492
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $491
+byte 1 72
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $490
+byte 1 66
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 32
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $489
+byte 1 73
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $488
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $487
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $486
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 0
+align 1
+LABELV $485
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $484
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $483
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $482
+byte 1 76
+byte 1 65
+byte 1 78
+byte 1 0
+align 1
+LABELV $481
+byte 1 78
+byte 1 111
+byte 1 0
+align 1
+LABELV $471
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $441
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $424
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $420
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $403
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $386
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $368
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $340
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $336
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $308
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $305
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $273
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $259
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $245
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $237
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $204
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $176
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $141
+byte 1 78
+byte 1 79
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 83
+byte 1 32
+byte 1 70
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $109
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $108
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $96
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $93
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $90
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $87
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $84
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $75
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $74
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $73
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $72
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
@@ -0,0 +1,5269 @@
+data
+align 4
+LABELV driverinfo_artlist
+address $71
+address $72
+address $73
+address $74
+byte 4 0
+code
+proc DriverInfo_Event 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $77
+ADDRGP4 $76
+JUMPV
+LABELV $77
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+EQI4 $82
+ADDRGP4 $79
+JUMPV
+LABELV $82
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $79
+LABELV $80
+LABELV $76
+endproc DriverInfo_Event 4 0
+proc DriverInfo_MenuDraw 12 20
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 80
+ARGI4
+ADDRGP4 $84
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 152
+ARGI4
+ADDRGP4 $85
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 192
+ARGI4
+ADDRGP4 $86
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 96
+ARGI4
+ADDRGP4 uis+56+1024
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 112
+ARGI4
+ADDRGP4 uis+56+2048
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 128
+ARGI4
+ADDRGP4 uis+56
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $92
+ARGP4
+ADDRGP4 uis+56+19464
+INDIRI4
+ARGI4
+ADDRGP4 uis+56+19468
+INDIRI4
+ARGI4
+ADDRGP4 uis+56+19472
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 168
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 208
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $99
+CNSTI4 316
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+5488
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 324
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+5488+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $100
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $102
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_driverinfo+5744
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $99
+ADDRGP4 s_driverinfo+5744
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $107
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 s_driverinfo+5744
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+5488-4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $107
+LABELV $83
+endproc DriverInfo_MenuDraw 12 20
+export DriverInfo_Cache
+proc DriverInfo_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $114
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 driverinfo_artlist
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $118
+ADDRGP4 $116
+JUMPV
+LABELV $118
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 driverinfo_artlist
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $115
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $116
+LABELV $113
+endproc DriverInfo_Cache 4 4
+proc UI_DriverInfo_Menu 36 12
+ADDRGP4 s_driverinfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5748
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 DriverInfo_Cache
+CALLV
+pop
+ADDRGP4 s_driverinfo+4120
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_driverinfo+4108
+ADDRGP4 DriverInfo_MenuDraw
+ASGNP4
+ADDRGP4 s_driverinfo+4128
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_driverinfo+4128+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_driverinfo+4128+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_driverinfo+4128+60
+ADDRGP4 $130
+ASGNP4
+ADDRGP4 s_driverinfo+4128+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_driverinfo+4128+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_driverinfo+4288
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+4288+4
+ADDRGP4 $71
+ASGNP4
+ADDRGP4 s_driverinfo+4288+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_driverinfo+4288+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_driverinfo+4288+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_driverinfo+4288+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_driverinfo+4288+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_driverinfo+4376
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+4376+4
+ADDRGP4 $72
+ASGNP4
+ADDRGP4 s_driverinfo+4376+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_driverinfo+4376+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_driverinfo+4376+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_driverinfo+4376+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_driverinfo+4376+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_driverinfo+4200
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+4200+4
+ADDRGP4 $73
+ASGNP4
+ADDRGP4 s_driverinfo+4200+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_driverinfo+4200+48
+ADDRGP4 DriverInfo_Event
+ASGNP4
+ADDRGP4 s_driverinfo+4200+8
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_driverinfo+4200+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_driverinfo+4200+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_driverinfo+4200+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_driverinfo+4200+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_driverinfo+4200+60
+ADDRGP4 $74
+ASGNP4
+ADDRGP4 s_driverinfo+4464
+ARGP4
+ADDRGP4 uis+56+3072
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 s_driverinfo+4464
+ASGNP4
+ADDRGP4 $185
+JUMPV
+LABELV $188
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $189
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $191
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+EQI4 $188
+LABELV $191
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $197
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+EQI4 $197
+ADDRLP4 28
+ADDRGP4 s_driverinfo+5744
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+5488
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $197
+JUMPV
+LABELV $196
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $197
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $199
+ADDRLP4 32
+INDIRI4
+CNSTI4 32
+NEI4 $196
+LABELV $199
+LABELV $185
+ADDRGP4 s_driverinfo+5744
+INDIRI4
+CNSTI4 40
+GEI4 $200
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $189
+LABELV $200
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $204
+JUMPV
+LABELV $201
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+5488
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LEI4 $207
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+5488
+ADDP4
+INDIRP4
+ADDP4
+CNSTI1 62
+ASGNI1
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+5488
+ADDP4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $207
+LABELV $202
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $204
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_driverinfo+5744
+INDIRI4
+LTI4 $201
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+4128
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+4288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+4376
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+4200
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $120
+endproc UI_DriverInfo_Menu 36 12
+data
+align 4
+LABELV s_ivo_templates
+byte 4 6
+byte 4 1
+byte 4 3
+byte 4 0
+byte 4 2
+byte 4 2
+byte 4 1
+byte 4 0
+byte 4 1
+byte 4 4
+byte 4 1
+byte 4 2
+byte 4 0
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 1
+byte 4 3
+byte 4 1
+byte 4 2
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 3
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 1
+align 4
+LABELV builtinResolutions
+address $217
+address $218
+address $219
+address $220
+address $221
+address $222
+address $223
+address $224
+address $225
+address $226
+address $227
+address $228
+byte 4 0
+align 4
+LABELV knownRatios
+address $229
+address $230
+address $231
+address $232
+address $233
+address $234
+address $235
+address $236
+address $237
+address $238
+address $239
+address $240
+address $241
+address $242
+byte 4 0
+byte 4 0
+align 4
+LABELV resolutions
+address builtinResolutions
+align 4
+LABELV resolutionsDetected
+byte 4 0
+code
+proc GraphicsOptions_FindBuiltinResolution 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+NEI4 $244
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $243
+JUMPV
+LABELV $244
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $246
+CNSTI4 -1
+RETI4
+ADDRGP4 $243
+JUMPV
+LABELV $246
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $251
+JUMPV
+LABELV $248
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $252
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $243
+JUMPV
+LABELV $252
+LABELV $249
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $251
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $248
+CNSTI4 -1
+RETI4
+LABELV $243
+endproc GraphicsOptions_FindBuiltinResolution 12 8
+proc GraphicsOptions_FindDetectedResolution 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $254
+JUMPV
+LABELV $255
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $257
+CNSTI4 -1
+RETI4
+ADDRGP4 $254
+JUMPV
+LABELV $257
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $262
+JUMPV
+LABELV $259
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $263
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $254
+JUMPV
+LABELV $263
+LABELV $260
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $262
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $259
+CNSTI4 -1
+RETI4
+LABELV $254
+endproc GraphicsOptions_FindDetectedResolution 12 8
+proc GraphicsOptions_GetAspectRatios 48 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $269
+JUMPV
+LABELV $266
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 28
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 $270
+ARGP4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $274
+JUMPV
+LABELV $271
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $275
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $273
+JUMPV
+LABELV $275
+LABELV $272
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $274
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $271
+LABELV $273
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $281
+JUMPV
+LABELV $278
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $282
+ADDRGP4 $280
+JUMPV
+LABELV $282
+LABELV $279
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $281
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $278
+LABELV $280
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $284
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratioToRes
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $284
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratios
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $267
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $269
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $266
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratios
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $265
+endproc GraphicsOptions_GetAspectRatios 48 16
+proc GraphicsOptions_GetInitialVideo 0 0
+ADDRGP4 s_ivo+28
+ADDRGP4 s_graphicsoptions+4952+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+4
+ADDRGP4 s_graphicsoptions+5124+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+32
+ADDRGP4 s_graphicsoptions+5316+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+8
+ADDRGP4 s_graphicsoptions+5048+68
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_ivo+12
+ADDRGP4 s_graphicsoptions+5220+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+20
+ADDRGP4 s_graphicsoptions+5508+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+24
+ADDRGP4 s_graphicsoptions+5604+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+16
+ADDRGP4 s_graphicsoptions+5412+64
+INDIRI4
+ASGNI4
+LABELV $286
+endproc GraphicsOptions_GetInitialVideo 0 0
+proc GraphicsOptions_GetResolutions 24 12
+ADDRGP4 $314
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 resbuf
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 resbuf
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $315
+ADDRLP4 4
+ADDRGP4 resbuf
+ASGNP4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRGP4 $318
+JUMPV
+LABELV $317
+ADDRLP4 12
+ADDRLP4 8
+INDIRU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 16
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $320
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $320
+LABELV $318
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $322
+ADDRLP4 8
+INDIRU4
+CNSTU4 31
+LTU4 $317
+LABELV $322
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $323
+ADDRGP4 resolutions
+ADDRGP4 detectedResolutions
+ASGNP4
+ADDRGP4 resolutionsDetected
+CNSTI4 1
+ASGNI4
+LABELV $323
+LABELV $315
+LABELV $313
+endproc GraphicsOptions_GetResolutions 24 12
+proc GraphicsOptions_CheckConfig 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $329
+JUMPV
+LABELV $326
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+28
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+4952+64
+INDIRI4
+EQI4 $330
+ADDRGP4 $327
+JUMPV
+LABELV $330
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+EQI4 $335
+ADDRGP4 $327
+JUMPV
+LABELV $335
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+4
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+5124+64
+INDIRI4
+EQI4 $339
+ADDRGP4 $327
+JUMPV
+LABELV $339
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_graphicsoptions+5048+68
+INDIRF4
+EQF4 $344
+ADDRGP4 $327
+JUMPV
+LABELV $344
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+12
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+5220+64
+INDIRI4
+EQI4 $349
+ADDRGP4 $327
+JUMPV
+LABELV $349
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+20
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+5508+64
+INDIRI4
+EQI4 $354
+ADDRGP4 $327
+JUMPV
+LABELV $354
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+24
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+5604+64
+INDIRI4
+EQI4 $359
+ADDRGP4 $327
+JUMPV
+LABELV $359
+ADDRGP4 s_graphicsoptions+4664+64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $327
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $329
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 5
+LTU4 $326
+ADDRGP4 s_graphicsoptions+4664+64
+CNSTI4 5
+ASGNI4
+LABELV $325
+endproc GraphicsOptions_CheckConfig 8 4
+proc GraphicsOptions_UpdateMenuItems 8 0
+ADDRGP4 s_graphicsoptions+4952+64
+INDIRI4
+CNSTI4 1
+NEI4 $369
+ADDRGP4 s_graphicsoptions+5124+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+5124+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $370
+JUMPV
+LABELV $369
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+5124+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $370
+ADDRGP4 s_graphicsoptions+5316+64
+INDIRI4
+CNSTI4 0
+NEI4 $379
+ADDRGP4 s_graphicsoptions+5412+64
+INDIRI4
+CNSTI4 0
+NEI4 $383
+ADDRGP4 s_graphicsoptions+5412+64
+CNSTI4 1
+ASGNI4
+LABELV $383
+LABELV $379
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+5772+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 s_ivo
+INDIRI4
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+EQI4 $391
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+5772+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $391
+ADDRGP4 s_ivo+4
+INDIRI4
+ADDRGP4 s_graphicsoptions+5124+64
+INDIRI4
+EQI4 $397
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+5772+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $397
+ADDRGP4 s_ivo+32
+INDIRI4
+ADDRGP4 s_graphicsoptions+5316+64
+INDIRI4
+EQI4 $404
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+5772+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $404
+ADDRGP4 s_ivo+8
+INDIRI4
+CVIF4 4
+ADDRGP4 s_graphicsoptions+5048+68
+INDIRF4
+EQF4 $411
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+5772+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $411
+ADDRGP4 s_ivo+12
+INDIRI4
+ADDRGP4 s_graphicsoptions+5220+64
+INDIRI4
+EQI4 $418
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+5772+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $418
+ADDRGP4 s_ivo+28
+INDIRI4
+ADDRGP4 s_graphicsoptions+4952+64
+INDIRI4
+EQI4 $425
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+5772+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $425
+ADDRGP4 s_ivo+16
+INDIRI4
+ADDRGP4 s_graphicsoptions+5412+64
+INDIRI4
+EQI4 $432
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+5772+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $432
+ADDRGP4 s_ivo+20
+INDIRI4
+ADDRGP4 s_graphicsoptions+5508+64
+INDIRI4
+EQI4 $439
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+5772+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $439
+ADDRGP4 s_ivo+24
+INDIRI4
+ADDRGP4 s_graphicsoptions+5604+64
+INDIRI4
+EQI4 $446
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+5772+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $446
+ADDRGP4 GraphicsOptions_CheckConfig
+CALLV
+pop
+LABELV $368
+endproc GraphicsOptions_UpdateMenuItems 8 0
+proc GraphicsOptions_ApplyChanges 52 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $454
+ADDRGP4 $453
+JUMPV
+LABELV $454
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+5412+64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $460
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $462
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $463
+ADDRGP4 $456
+JUMPV
+LABELV $460
+ADDRGP4 $461
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $457
+JUMPV
+LABELV $462
+ADDRGP4 $461
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $457
+JUMPV
+LABELV $463
+ADDRGP4 $461
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $456
+LABELV $457
+ADDRGP4 $464
+ARGP4
+CNSTF4 1077936128
+ADDRGP4 s_graphicsoptions+5048+68
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $467
+ARGP4
+ADDRGP4 s_graphicsoptions+5316+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+EQI4 $470
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+CNSTI4 -1
+EQI4 $478
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+CVIU4 4
+CNSTU4 32
+LTU4 $472
+LABELV $478
+ADDRGP4 s_graphicsoptions+4856+64
+CNSTI4 0
+ASGNI4
+LABELV $472
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 GraphicsOptions_FindBuiltinResolution
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $483
+ADDRLP4 12
+ARGP4
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 44
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 48
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $489
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $490
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $483
+ADDRGP4 $491
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $471
+JUMPV
+LABELV $470
+ADDRGP4 $491
+ARGP4
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $471
+ADDRGP4 $494
+ARGP4
+ADDRGP4 s_graphicsoptions+5124+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $497
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $498
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $499
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $500
+ARGP4
+ADDRGP4 s_graphicsoptions+5220+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+5508+64
+INDIRI4
+CNSTI4 2
+NEI4 $503
+ADDRGP4 $507
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $508
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRGP4 s_graphicsoptions+5508+64
+INDIRI4
+CNSTI4 1
+NEI4 $509
+ADDRGP4 $507
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $508
+ARGP4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $510
+JUMPV
+LABELV $509
+ADDRGP4 $507
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $508
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $510
+LABELV $504
+ADDRGP4 s_graphicsoptions+5604+64
+INDIRI4
+CNSTI4 0
+EQI4 $513
+ADDRGP4 $517
+ARGP4
+ADDRGP4 $518
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRGP4 $517
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $514
+CNSTI4 2
+ARGI4
+ADDRGP4 $520
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $453
+endproc GraphicsOptions_ApplyChanges 52 12
+proc GraphicsOptions_Event 16 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $522
+ADDRGP4 $521
+JUMPV
+LABELV $522
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 101
+LTI4 $524
+ADDRLP4 4
+INDIRI4
+CNSTI4 110
+GTI4 $524
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $580-404
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $580
+address $575
+address $524
+address $553
+address $532
+address $574
+address $525
+address $577
+address $578
+address $579
+address $527
+code
+LABELV $527
+ADDRGP4 s_graphicsoptions+4856+64
+ADDRGP4 s_graphicsoptions+4760+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratioToRes
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $532
+ADDRGP4 s_graphicsoptions+4952+64
+INDIRI4
+CNSTI4 1
+NEI4 $533
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+CNSTI4 2
+GEI4 $537
+ADDRGP4 s_graphicsoptions+4856+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 $538
+JUMPV
+LABELV $537
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+CNSTI4 6
+LEI4 $543
+ADDRGP4 s_graphicsoptions+4856+64
+CNSTI4 6
+ASGNI4
+LABELV $543
+LABELV $538
+LABELV $533
+ADDRGP4 s_graphicsoptions+4760+64
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $525
+JUMPV
+LABELV $553
+ADDRLP4 0
+CNSTI4 36
+ADDRGP4 s_graphicsoptions+4664+64
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+4856+64
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+4760+64
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5048+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 s_graphicsoptions+5220+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5412+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5508+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5604+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5124+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $525
+JUMPV
+LABELV $574
+ADDRGP4 UI_DriverInfo_Menu
+CALLV
+pop
+ADDRGP4 $525
+JUMPV
+LABELV $575
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $525
+JUMPV
+LABELV $577
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_DisplayOptionsMenu
+CALLV
+pop
+ADDRGP4 $525
+JUMPV
+LABELV $578
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SoundOptionsMenu
+CALLV
+pop
+ADDRGP4 $525
+JUMPV
+LABELV $579
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_NetworkOptionsMenu
+CALLV
+pop
+LABELV $524
+LABELV $525
+LABELV $521
+endproc GraphicsOptions_Event 16 4
+proc GraphicsOptions_TQEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $583
+ADDRGP4 $582
+JUMPV
+LABELV $583
+ADDRGP4 s_graphicsoptions+5048+68
+ADDRGP4 s_graphicsoptions+5048+68
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $582
+endproc GraphicsOptions_TQEvent 0 0
+export GraphicsOptions_MenuDraw
+proc GraphicsOptions_MenuDraw 0 4
+ADDRGP4 GraphicsOptions_UpdateMenuItems
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $589
+endproc GraphicsOptions_MenuDraw 0 4
+proc GraphicsOptions_SetMenuItems 1056 12
+ADDRGP4 $491
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+4856+64
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+CNSTI4 0
+GEI4 $593
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+EQI4 $597
+ADDRGP4 $489
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1022
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRU4
+ADDRLP4 12
+ADDP4
+CNSTI1 120
+ASGNI1
+ADDRLP4 12
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 1044
+INDIRU4
+ADDRLP4 12
+ADDP4
+ARGP4
+CNSTU4 1024
+ADDRLP4 1048
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $602
+JUMPV
+LABELV $599
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $603
+ADDRGP4 s_graphicsoptions+4856+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $601
+JUMPV
+LABELV $603
+LABELV $600
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $602
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $599
+LABELV $601
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+CNSTI4 0
+GEI4 $598
+ADDRGP4 s_graphicsoptions+4856+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $598
+JUMPV
+LABELV $597
+ADDRGP4 s_graphicsoptions+4856+64
+CNSTI4 3
+ASGNI4
+LABELV $598
+LABELV $593
+ADDRGP4 s_graphicsoptions+4760+64
+ADDRGP4 s_graphicsoptions+4856+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+5124+64
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+5316+64
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $464
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+5048+68
+CNSTF4 1077936128
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+5048+68
+INDIRF4
+CNSTF4 0
+GEF4 $625
+ADDRGP4 s_graphicsoptions+5048+68
+CNSTF4 0
+ASGNF4
+ADDRGP4 $626
+JUMPV
+LABELV $625
+ADDRGP4 s_graphicsoptions+5048+68
+INDIRF4
+CNSTF4 1077936128
+LEF4 $631
+ADDRGP4 s_graphicsoptions+5048+68
+CNSTF4 1077936128
+ASGNF4
+LABELV $631
+LABELV $626
+ADDRGP4 $500
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 0
+EQF4 $640
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $641
+JUMPV
+LABELV $640
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $641
+ADDRGP4 s_graphicsoptions+5220+64
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $461
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+CNSTI4 16
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $648
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+GTI4 $655
+LABELV $654
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $645
+ADDRGP4 $642
+JUMPV
+LABELV $655
+ADDRLP4 28
+INDIRI4
+CNSTI4 32
+EQI4 $651
+ADDRGP4 $642
+JUMPV
+LABELV $642
+LABELV $645
+ADDRGP4 s_graphicsoptions+5412+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $643
+JUMPV
+LABELV $648
+ADDRGP4 s_graphicsoptions+5412+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $643
+JUMPV
+LABELV $651
+ADDRGP4 s_graphicsoptions+5412+64
+CNSTI4 2
+ASGNI4
+LABELV $643
+ADDRGP4 $517
+ARGP4
+ADDRLP4 44
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $656
+ADDRGP4 s_graphicsoptions+5604+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $657
+JUMPV
+LABELV $656
+ADDRGP4 s_graphicsoptions+5604+64
+CNSTI4 1
+ASGNI4
+LABELV $657
+ADDRGP4 $507
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+CNSTF4 0
+LEF4 $662
+ADDRGP4 $508
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1101004800
+LTF4 $664
+ADDRGP4 s_graphicsoptions+5508+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $663
+JUMPV
+LABELV $664
+ADDRGP4 s_graphicsoptions+5508+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $663
+JUMPV
+LABELV $662
+ADDRGP4 s_graphicsoptions+5508+64
+CNSTI4 2
+ASGNI4
+LABELV $663
+LABELV $590
+endproc GraphicsOptions_SetMenuItems 1056 12
+data
+align 4
+LABELV $673
+address $674
+address $675
+byte 4 0
+align 4
+LABELV $676
+address $674
+address $677
+address $678
+byte 4 0
+align 4
+LABELV $679
+address $680
+address $681
+address $682
+address $683
+address $684
+address $685
+byte 4 0
+align 4
+LABELV $686
+address $687
+address $688
+byte 4 0
+align 4
+LABELV $689
+address $690
+address $691
+byte 4 0
+align 4
+LABELV $692
+address $693
+address $694
+address $695
+byte 4 0
+align 4
+LABELV $696
+address $697
+address $698
+byte 4 0
+export GraphicsOptions_MenuInit
+code
+proc GraphicsOptions_MenuInit 12 12
+ADDRGP4 s_graphicsoptions
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5948
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 GraphicsOptions_GetResolutions
+CALLV
+pop
+ADDRGP4 GraphicsOptions_GetAspectRatios
+CALLV
+pop
+ADDRGP4 GraphicsOptions_Cache
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+4116
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+4120
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+4108
+ADDRGP4 GraphicsOptions_MenuDraw
+ASGNP4
+ADDRGP4 s_graphicsoptions+4128
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_graphicsoptions+4128+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_graphicsoptions+4128+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_graphicsoptions+4128+60
+ADDRGP4 $709
+ASGNP4
+ADDRGP4 s_graphicsoptions+4128+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_graphicsoptions+4128+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+4200
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+4200+4
+ADDRGP4 $71
+ASGNP4
+ADDRGP4 s_graphicsoptions+4200+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_graphicsoptions+4200+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_graphicsoptions+4200+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_graphicsoptions+4200+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_graphicsoptions+4200+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_graphicsoptions+4288
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+4288+4
+ADDRGP4 $72
+ASGNP4
+ADDRGP4 s_graphicsoptions+4288+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_graphicsoptions+4288+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_graphicsoptions+4288+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_graphicsoptions+4288+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_graphicsoptions+4288+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_graphicsoptions+4376
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+4376+44
+CNSTU4 16
+ASGNU4
+ADDRGP4 s_graphicsoptions+4376+8
+CNSTI4 106
+ASGNI4
+ADDRGP4 s_graphicsoptions+4376+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+4376+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+4376+16
+CNSTI4 186
+ASGNI4
+ADDRGP4 s_graphicsoptions+4376+60
+ADDRGP4 $753
+ASGNP4
+ADDRGP4 s_graphicsoptions+4376+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+4376+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+4448
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+4448+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+4448+8
+CNSTI4 107
+ASGNI4
+ADDRGP4 s_graphicsoptions+4448+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+4448+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+4448+16
+CNSTI4 213
+ASGNI4
+ADDRGP4 s_graphicsoptions+4448+60
+ADDRGP4 $771
+ASGNP4
+ADDRGP4 s_graphicsoptions+4448+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+4448+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+4520
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+4520+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+4520+8
+CNSTI4 108
+ASGNI4
+ADDRGP4 s_graphicsoptions+4520+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+4520+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+4520+16
+CNSTI4 240
+ASGNI4
+ADDRGP4 s_graphicsoptions+4520+60
+ADDRGP4 $789
+ASGNP4
+ADDRGP4 s_graphicsoptions+4520+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+4520+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+4592
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+4592+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+4592+8
+CNSTI4 109
+ASGNI4
+ADDRGP4 s_graphicsoptions+4592+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+4592+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+4592+16
+CNSTI4 267
+ASGNI4
+ADDRGP4 s_graphicsoptions+4592+60
+ADDRGP4 $807
+ASGNP4
+ADDRGP4 s_graphicsoptions+4592+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+4592+68
+ADDRGP4 color_red
+ASGNP4
+ADDRLP4 0
+CNSTI4 114
+ASGNI4
+ADDRGP4 s_graphicsoptions+4664
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+4664+4
+ADDRGP4 $815
+ASGNP4
+ADDRGP4 s_graphicsoptions+4664+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+4664+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+4664+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+4664+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+4664+8
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_graphicsoptions+4664+76
+ADDRGP4 $679
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 36
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+4952
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+4952+4
+ADDRGP4 $831
+ASGNP4
+ADDRGP4 s_graphicsoptions+4952+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+4952+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+4952+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+4952+76
+ADDRGP4 $673
+ASGNP4
+ADDRGP4 uis+56+19476
+INDIRI4
+CNSTI4 2
+NEI4 $845
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $846
+JUMPV
+LABELV $845
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $846
+ADDRGP4 s_graphicsoptions+4952+64
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5316
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+5316+4
+ADDRGP4 $850
+ASGNP4
+ADDRGP4 s_graphicsoptions+5316+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+5316+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+5316+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5316+76
+ADDRGP4 $696
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+4760
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+4760+4
+ADDRGP4 $862
+ASGNP4
+ADDRGP4 s_graphicsoptions+4760+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+4760+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+4760+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+4760+76
+ADDRGP4 ratios
+ASGNP4
+ADDRGP4 s_graphicsoptions+4760+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+4760+8
+CNSTI4 110
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+4856
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+4856+4
+ADDRGP4 $878
+ASGNP4
+ADDRGP4 s_graphicsoptions+4856+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+4856+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+4856+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+4856+76
+ADDRGP4 resolutions
+INDIRP4
+ASGNP4
+ADDRGP4 s_graphicsoptions+4856+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+4856+8
+CNSTI4 104
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5124
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+5124+4
+ADDRGP4 $894
+ASGNP4
+ADDRGP4 s_graphicsoptions+5124+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+5124+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+5124+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5124+76
+ADDRGP4 $696
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5220
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+5220+4
+ADDRGP4 $906
+ASGNP4
+ADDRGP4 s_graphicsoptions+5220+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+5220+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+5220+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5220+76
+ADDRGP4 $686
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5508
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+5508+4
+ADDRGP4 $918
+ASGNP4
+ADDRGP4 s_graphicsoptions+5508+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+5508+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+5508+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5508+76
+ADDRGP4 $692
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5048
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+5048+4
+ADDRGP4 $930
+ASGNP4
+ADDRGP4 s_graphicsoptions+5048+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+5048+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+5048+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5048+60
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_graphicsoptions+5048+64
+CNSTF4 1077936128
+ASGNF4
+ADDRGP4 s_graphicsoptions+5048+48
+ADDRGP4 GraphicsOptions_TQEvent
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5412
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+5412+4
+ADDRGP4 $946
+ASGNP4
+ADDRGP4 s_graphicsoptions+5412+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+5412+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+5412+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5412+76
+ADDRGP4 $676
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5604
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+5604+4
+ADDRGP4 $958
+ASGNP4
+ADDRGP4 s_graphicsoptions+5604+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+5604+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+5604+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5604+76
+ADDRGP4 $689
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5700
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+5700+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_graphicsoptions+5700+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+5700+8
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_graphicsoptions+5700+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_graphicsoptions+5700+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+5700+60
+ADDRGP4 $980
+ASGNP4
+ADDRGP4 s_graphicsoptions+5700+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_graphicsoptions+5700+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+5860
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+5860+4
+ADDRGP4 $73
+ASGNP4
+ADDRGP4 s_graphicsoptions+5860+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_graphicsoptions+5860+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+5860+8
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_graphicsoptions+5860+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_graphicsoptions+5860+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_graphicsoptions+5860+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_graphicsoptions+5860+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_graphicsoptions+5860+60
+ADDRGP4 $74
+ASGNP4
+ADDRGP4 s_graphicsoptions+5772
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+5772+4
+ADDRGP4 $1007
+ASGNP4
+ADDRGP4 s_graphicsoptions+5772+44
+CNSTU4 20752
+ASGNU4
+ADDRGP4 s_graphicsoptions+5772+48
+ADDRGP4 GraphicsOptions_ApplyChanges
+ASGNP4
+ADDRGP4 s_graphicsoptions+5772+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_graphicsoptions+5772+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_graphicsoptions+5772+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_graphicsoptions+5772+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_graphicsoptions+5772+60
+ADDRGP4 $1022
+ASGNP4
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+4128
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+4200
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+4288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+4376
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+4448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+4520
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+4592
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+4664
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+4952
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+5316
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+4760
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+4856
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+5124
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+5220
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+5508
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+5048
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+5412
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+5604
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+5700
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+5860
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+5772
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 GraphicsOptions_SetMenuItems
+CALLV
+pop
+ADDRGP4 GraphicsOptions_GetInitialVideo
+CALLV
+pop
+ADDRGP4 uis+56+19476
+INDIRI4
+CNSTI4 0
+NEI4 $1044
+ADDRGP4 uis+56+19480
+INDIRI4
+CNSTI4 1
+NEI4 $1044
+ADDRLP4 8
+ADDRGP4 s_graphicsoptions+4952+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $1044
+LABELV $672
+endproc GraphicsOptions_MenuInit 12 12
+export GraphicsOptions_Cache
+proc GraphicsOptions_Cache 0 4
+ADDRGP4 $71
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $72
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $73
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $74
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1007
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1022
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1052
+endproc GraphicsOptions_Cache 0 4
+export UI_GraphicsOptionsMenu
+proc UI_GraphicsOptionsMenu 0 8
+ADDRGP4 GraphicsOptions_MenuInit
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+4376
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $1053
+endproc UI_GraphicsOptionsMenu 0 8
+bss
+align 4
+LABELV detectedResolutions
+skip 128
+align 1
+LABELV resbuf
+skip 1024
+align 4
+LABELV resToRatio
+skip 128
+align 4
+LABELV ratioToRes
+skip 128
+align 1
+LABELV ratioBuf
+skip 256
+align 4
+LABELV ratios
+skip 128
+align 4
+LABELV s_graphicsoptions
+skip 5948
+align 4
+LABELV s_ivo
+skip 36
+align 4
+LABELV s_driverinfo
+skip 5748
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_DrawConsoleLinesOver
+import trap_OpenWolfcamDirectory
+import trap_OpenQuakeLiveDirectory
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import ScrollList_Init
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_doubleClickTime
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_ModToWeapon
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDeltaf
+import BG_EvaluateTrajectoryf
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItemsQldm91
+import bg_numItemsQldm73
+import bg_numItemsCpma
+import bg_numItemsQ3
+import bg_numItems
+import bg_itemlistQldm91
+import bg_itemlistQldm73
+import bg_itemlistCpma
+import bg_itemlistQ3
+import bg_itemlist
+import WP_NUM_WEAPONS
+import PW_NUM_POWERUPS
+import PW_FROZEN
+import PW_ARMORREGEN
+import PW_DOUBLER
+import PW_GUARD
+import PW_SCOUT
+import PW_INVULNERABILITY
+import PW_NEUTRALFLAG
+import PW_BLUEFLAG
+import PW_REDFLAG
+import PW_FLIGHT
+import PW_REGEN
+import PW_INVIS
+import PW_HASTE
+import PW_BATTLESUIT
+import PW_QUAD
+import PW_NONE
+import PERS_ATTACKEE_ARMOR
+import PERS_CAPTURES
+import PERS_GAUNTLET_FRAG_COUNT
+import PERS_ASSIST_COUNT
+import PERS_DEFEND_COUNT
+import PERS_EXCELLENT_COUNT
+import PERS_IMPRESSIVE_COUNT
+import PERS_KILLED
+import PERS_ATTACKER
+import PERS_PLAYEREVENTS
+import PERS_SPAWN_COUNT
+import PERS_TEAM
+import PERS_RANK
+import PERS_HITS
+import PERS_SCORE
+import STAT_MAP_KEYS
+import STAT_ARMOR_TIER
+import STAT_QUAD_KILL_COUNT
+import STAT_UNKNOWN_12
+import STAT_POWERUP_REMAINING
+import STAT_UNKNOWN_10
+import STAT_UNKNOWN_9
+import STAT_UNKNOWN_8
+import STAT_MAX_HEALTH
+import STAT_CLIENTS_READY
+import STAT_BATTLE_SUIT_KILL_COUNT
+import STAT_ARMOR
+import STAT_WEAPONS
+import STAT_PERSISTANT_POWERUP
+import STAT_HOLDABLE_ITEM
+import STAT_HEALTH
+import Pmove
+import PM_UpdateViewAngles
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1022
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1007
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $980
+byte 1 68
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $958
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $946
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $930
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $918
+byte 1 71
+byte 1 101
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $906
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 0
+align 1
+LABELV $894
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $878
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $862
+byte 1 65
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 58
+byte 1 0
+align 1
+LABELV $850
+byte 1 71
+byte 1 76
+byte 1 32
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $831
+byte 1 71
+byte 1 76
+byte 1 32
+byte 1 68
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $815
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $807
+byte 1 78
+byte 1 69
+byte 1 84
+byte 1 87
+byte 1 79
+byte 1 82
+byte 1 75
+byte 1 0
+align 1
+LABELV $789
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $771
+byte 1 68
+byte 1 73
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 0
+align 1
+LABELV $753
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 72
+byte 1 73
+byte 1 67
+byte 1 83
+byte 1 0
+align 1
+LABELV $709
+byte 1 83
+byte 1 89
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $698
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $697
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $695
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 0
+align 1
+LABELV $694
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $693
+byte 1 76
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $691
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $690
+byte 1 66
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $688
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $687
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $685
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $684
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $683
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $682
+byte 1 78
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $681
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $680
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $678
+byte 1 51
+byte 1 50
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $677
+byte 1 49
+byte 1 54
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $675
+byte 1 86
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 0
+align 1
+LABELV $674
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $520
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $519
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 0
+align 1
+LABELV $518
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $517
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $508
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $507
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 66
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $500
+byte 1 114
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $499
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $498
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $497
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $494
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $491
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $490
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $489
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $467
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $464
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 109
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $461
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $314
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $270
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $242
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $241
+byte 1 49
+byte 1 46
+byte 1 55
+byte 1 56
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $240
+byte 1 53
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $239
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 55
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $238
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $237
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $236
+byte 1 49
+byte 1 52
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $235
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $234
+byte 1 51
+byte 1 58
+byte 1 50
+byte 1 0
+align 1
+LABELV $233
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $232
+byte 1 52
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $231
+byte 1 49
+byte 1 46
+byte 1 51
+byte 1 51
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $230
+byte 1 53
+byte 1 58
+byte 1 52
+byte 1 0
+align 1
+LABELV $229
+byte 1 49
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $228
+byte 1 56
+byte 1 53
+byte 1 54
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $227
+byte 1 50
+byte 1 48
+byte 1 52
+byte 1 56
+byte 1 120
+byte 1 49
+byte 1 53
+byte 1 51
+byte 1 54
+byte 1 0
+align 1
+LABELV $226
+byte 1 49
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $225
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $224
+byte 1 49
+byte 1 49
+byte 1 53
+byte 1 50
+byte 1 120
+byte 1 56
+byte 1 54
+byte 1 52
+byte 1 0
+align 1
+LABELV $223
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 120
+byte 1 55
+byte 1 54
+byte 1 56
+byte 1 0
+align 1
+LABELV $222
+byte 1 57
+byte 1 54
+byte 1 48
+byte 1 120
+byte 1 55
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $221
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $220
+byte 1 54
+byte 1 52
+byte 1 48
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $219
+byte 1 53
+byte 1 49
+byte 1 50
+byte 1 120
+byte 1 51
+byte 1 56
+byte 1 52
+byte 1 0
+align 1
+LABELV $218
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $217
+byte 1 51
+byte 1 50
+byte 1 48
+byte 1 120
+byte 1 50
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $130
+byte 1 68
+byte 1 82
+byte 1 73
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 70
+byte 1 79
+byte 1 0
+align 1
+LABELV $92
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 90
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $86
+byte 1 69
+byte 1 88
+byte 1 84
+byte 1 69
+byte 1 78
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 83
+byte 1 0
+align 1
+LABELV $85
+byte 1 80
+byte 1 73
+byte 1 88
+byte 1 69
+byte 1 76
+byte 1 70
+byte 1 79
+byte 1 82
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 0
+align 1
+LABELV $84
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $74
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $73
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $72
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $71
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
@@ -0,0 +1,48901 @@
+data
+align 4
+LABELV ScriptBuffer
+byte 4 0
+align 4
+LABELV UseScriptBuffer
+byte 4 0
+align 4
+LABELV LastListSelected
+byte 4 0
+align 4
+LABELV captureFunc
+byte 4 0
+align 4
+LABELV captureData
+byte 4 0
+align 4
+LABELV itemCapture
+byte 4 0
+export DC
+align 4
+LABELV DC
+byte 4 0
+align 4
+LABELV g_waitingForKey
+byte 4 0
+align 4
+LABELV g_editingField
+byte 4 0
+align 4
+LABELV g_bindItem
+byte 4 0
+align 4
+LABELV g_editItem
+byte 4 0
+align 4
+LABELV LastFocusItem
+byte 4 0
+export menuCount
+align 4
+LABELV menuCount
+byte 4 0
+export openMenuCount
+align 4
+LABELV openMenuCount
+byte 4 0
+align 4
+LABELV debugMode
+byte 4 0
+align 4
+LABELV lastListBoxClickTime
+byte 4 0
+export UI_Alloc
+code
+proc UI_Alloc 12 16
+ADDRGP4 allocPoint
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 2097152
+LEI4 $43
+ADDRGP4 outOfMemory
+CNSTI4 1
+ASGNI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $45
+ADDRGP4 $47
+ARGP4
+ADDRGP4 allocPoint
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 2097152
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $45
+CNSTP4 0
+RETP4
+ADDRGP4 $42
+JUMPV
+LABELV $43
+ADDRLP4 4
+ADDRGP4 allocPoint
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRGP4 memoryPool
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 15
+ADDI4
+CNSTI4 -16
+BANDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $42
+endproc UI_Alloc 12 16
+export UI_InitMemory
+proc UI_InitMemory 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 allocPoint
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 outOfMemory
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $48
+endproc UI_InitMemory 4 0
+export UI_OutOfMemory
+proc UI_OutOfMemory 0 0
+ADDRGP4 outOfMemory
+INDIRI4
+RETI4
+LABELV $49
+endproc UI_OutOfMemory 0 0
+proc hashForString 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $52
+JUMPV
+LABELV $51
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CVIU4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 119
+ADDI4
+CVIU4 4
+MULU4
+ADDU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $52
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $51
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+CNSTU4 2047
+BANDU4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+RETU4
+LABELV $50
+endproc hashForString 20 4
+data
+align 4
+LABELV strPoolIndex
+byte 4 0
+align 4
+LABELV strHandleCount
+byte 4 0
+align 4
+LABELV $55
+address $56
+export String_Alloc
+code
+proc String_Alloc 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $57
+ADDRGP4 $59
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $54
+JUMPV
+LABELV $57
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $60
+ADDRGP4 $55
+INDIRP4
+RETP4
+ADDRGP4 $54
+JUMPV
+LABELV $60
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 hashForString
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 16
+INDIRU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 strHandle
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $63
+JUMPV
+LABELV $62
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $65
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $54
+JUMPV
+LABELV $65
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $63
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $62
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 20
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 strPoolIndex
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+CNSTI4 2097152
+GEI4 $67
+ADDRLP4 24
+ADDRGP4 strPoolIndex
+INDIRI4
+ASGNI4
+ADDRGP4 strPoolIndex
+INDIRI4
+ADDRGP4 strPool
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 28
+ADDRGP4 strPoolIndex
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 strHandle
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $69
+ADDRGP4 $72
+JUMPV
+LABELV $71
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $72
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $71
+LABELV $69
+CNSTI4 8
+ARGI4
+ADDRLP4 32
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $74
+CNSTP4 0
+RETP4
+ADDRGP4 $54
+JUMPV
+LABELV $74
+ADDRLP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 strPool
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $76
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $77
+JUMPV
+LABELV $76
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 strHandle
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $77
+ADDRLP4 24
+INDIRI4
+ADDRGP4 strPool
+ADDP4
+RETP4
+ADDRGP4 $54
+JUMPV
+LABELV $67
+ADDRGP4 $78
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 String_Report
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $54
+endproc String_Alloc 36 8
+export String_Report
+proc String_Report 12 16
+ADDRGP4 $80
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $81
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 strPoolIndex
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1241513984
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1120403456
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $82
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 2097152
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 allocPoint
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1241513984
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1120403456
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 2097152
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $79
+endproc String_Report 12 16
+export String_Init
+proc String_Init 16 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $85
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 strHandle
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $86
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2048
+LTI4 $85
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 strHandleCount
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 strPoolIndex
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 menuCount
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 openMenuCount
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 UI_InitMemory
+CALLV
+pop
+ADDRGP4 Item_SetupKeywordHash
+CALLV
+pop
+ADDRGP4 Menu_SetupKeywordHash
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTU4 0
+ASGNU4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $89
+ADDRLP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $89
+ADDRGP4 Controls_GetConfig
+CALLV
+pop
+LABELV $89
+LABELV $84
+endproc String_Init 16 0
+bss
+align 1
+LABELV $92
+skip 4096
+code
+proc PC_SourceWarning 136 16
+ADDRLP4 132
+ADDRFP4 4+4
+ASGNP4
+ADDRGP4 $92
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 132
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_PC_SourceFileAndLine
+CALLI4
+pop
+ADDRGP4 $94
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $92
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $91
+endproc PC_SourceWarning 136 16
+bss
+align 1
+LABELV $96
+skip 4096
+code
+proc PC_SourceError 136 16
+ADDRLP4 132
+ADDRFP4 4+4
+ASGNP4
+ADDRGP4 $96
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 132
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_PC_SourceFileAndLine
+CALLI4
+pop
+ADDRGP4 $98
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $96
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $95
+endproc PC_SourceError 136 16
+export MenuVar_Set
+proc MenuVar_Set 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $100
+ADDRLP4 4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 menuVars
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $106
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $104
+LABELV $106
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $107
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16
+INDIRU4
+CNSTU4 64
+LTU4 $109
+ADDRGP4 $111
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $109
+LABELV $107
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $104
+LABELV $101
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $100
+ADDRGP4 $112
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $99
+endproc MenuVar_Set 20 12
+export MenuVar_Get
+proc MenuVar_Get 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $114
+ADDRLP4 8
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 menuVars
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $118
+ADDRGP4 $120
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $116
+JUMPV
+LABELV $118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $121
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $116
+JUMPV
+LABELV $121
+LABELV $115
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $114
+LABELV $116
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $113
+endproc MenuVar_Get 16 8
+export LerpColor
+proc LerpColor 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $124
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $128
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $130
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $130
+LABELV $129
+LABELV $125
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $124
+LABELV $123
+endproc LerpColor 12 0
+export Float_Parse
+proc Float_Parse 32 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $133
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $133
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 64
+EQI4 $135
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+NEI4 $137
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 120
+EQI4 $139
+ADDRLP4 16
+INDIRI4
+CNSTI4 88
+NEI4 $137
+LABELV $139
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $136
+JUMPV
+LABELV $137
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 Q_isdigit
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $140
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 43
+EQI4 $140
+ADDRLP4 24
+INDIRI4
+CNSTI4 45
+EQI4 $140
+ADDRLP4 24
+INDIRI4
+CNSTI4 46
+EQI4 $140
+ADDRGP4 $142
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $140
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 MenuVar_Get
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $136
+CNSTI4 1
+RETI4
+ADDRGP4 $132
+JUMPV
+LABELV $133
+ADDRGP4 $143
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $132
+endproc Float_Parse 32 8
+export PC_Float_Parse
+proc PC_Float_Parse 2076 12
+ADDRGP4 UseScriptBuffer
+INDIRI4
+CNSTI4 0
+EQI4 $145
+ADDRGP4 ScriptBuffer
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 2068
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+RETI4
+ADDRGP4 $144
+JUMPV
+LABELV $145
+ADDRLP4 0
+ADDRLP4 1044
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2068
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $147
+ADDRGP4 $149
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $144
+JUMPV
+LABELV $147
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $150
+ADDRLP4 0
+INDIRP4
+CNSTI1 45
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $153
+ADDRGP4 $155
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $144
+JUMPV
+LABELV $153
+LABELV $150
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+16
+ARGP4
+CNSTI4 1023
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 1044
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Float_Parse
+CALLI4
+pop
+CNSTI4 1
+RETI4
+LABELV $144
+endproc PC_Float_Parse 2076 12
+export Color_Parse
+proc Color_Parse 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $158
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $162
+ADDRGP4 $164
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $157
+JUMPV
+LABELV $162
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $159
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $158
+CNSTI4 1
+RETI4
+LABELV $157
+endproc Color_Parse 12 8
+export PC_Color_Parse
+proc PC_Color_Parse 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 UseScriptBuffer
+INDIRI4
+CNSTI4 0
+EQI4 $166
+ADDRGP4 ScriptBuffer
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $165
+JUMPV
+LABELV $166
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $168
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $172
+ADDRGP4 $174
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $165
+JUMPV
+LABELV $172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $169
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $168
+CNSTI4 1
+RETI4
+LABELV $165
+endproc PC_Color_Parse 12 8
+export Int_Parse
+proc Int_Parse 32 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $176
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $176
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 64
+EQI4 $178
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+NEI4 $180
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 120
+EQI4 $182
+ADDRLP4 16
+INDIRI4
+CNSTI4 88
+NEI4 $180
+LABELV $182
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Com_HexStrToInt
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $180
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 Q_isdigit
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $183
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 43
+EQI4 $183
+ADDRLP4 24
+INDIRI4
+CNSTI4 45
+EQI4 $183
+ADDRGP4 $185
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $183
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 MenuVar_Get
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $179
+CNSTI4 1
+RETI4
+ADDRGP4 $175
+JUMPV
+LABELV $176
+ADDRGP4 $186
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $175
+endproc Int_Parse 32 8
+export PC_Int_Parse
+proc PC_Int_Parse 2076 12
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $188
+ADDRGP4 $190
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $187
+JUMPV
+LABELV $188
+ADDRGP4 UseScriptBuffer
+INDIRI4
+CNSTI4 0
+EQI4 $191
+ADDRGP4 ScriptBuffer
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 2068
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+RETI4
+ADDRGP4 $187
+JUMPV
+LABELV $191
+ADDRLP4 0
+ADDRLP4 1044
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2068
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $193
+ADDRGP4 $195
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $187
+JUMPV
+LABELV $193
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $196
+ADDRLP4 0
+INDIRP4
+CNSTI1 45
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $199
+ADDRGP4 $201
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $187
+JUMPV
+LABELV $199
+LABELV $196
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+16
+ARGP4
+CNSTI4 1023
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 1044
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Int_Parse
+CALLI4
+pop
+CNSTI4 1
+RETI4
+LABELV $187
+endproc PC_Int_Parse 2076 12
+export Rect_Parse
+proc Rect_Parse 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $204
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $206
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $210
+CNSTI4 1
+RETI4
+ADDRGP4 $203
+JUMPV
+LABELV $210
+LABELV $208
+LABELV $206
+LABELV $204
+ADDRGP4 $212
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $203
+endproc Rect_Parse 16 8
+export PC_Rect_Parse
+proc PC_Rect_Parse 16 8
+ADDRGP4 UseScriptBuffer
+INDIRI4
+CNSTI4 0
+EQI4 $214
+ADDRGP4 ScriptBuffer
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $213
+JUMPV
+LABELV $214
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $218
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $220
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $222
+CNSTI4 1
+RETI4
+ADDRGP4 $213
+JUMPV
+LABELV $222
+LABELV $220
+LABELV $218
+LABELV $216
+ADDRGP4 $224
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $213
+endproc PC_Rect_Parse 16 8
+export String_Parse
+proc String_Parse 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $226
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $226
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $228
+ADDRGP4 $230
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $225
+JUMPV
+LABELV $228
+CNSTI4 1
+RETI4
+ADDRGP4 $225
+JUMPV
+LABELV $226
+CNSTI4 0
+RETI4
+LABELV $225
+endproc String_Parse 16 8
+export PC_String_Parse
+proc PC_String_Parse 1048 8
+ADDRGP4 UseScriptBuffer
+INDIRI4
+CNSTI4 0
+EQI4 $232
+ADDRGP4 ScriptBuffer
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+RETI4
+ADDRGP4 $231
+JUMPV
+LABELV $232
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $234
+CNSTI4 0
+RETI4
+ADDRGP4 $231
+JUMPV
+LABELV $234
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1044
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $237
+ADDRGP4 $239
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $231
+JUMPV
+LABELV $237
+CNSTI4 1
+RETI4
+LABELV $231
+endproc PC_String_Parse 1048 8
+proc Script_ParseExt 1056 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $241
+ADDRFP4 8
+INDIRP4
+CNSTP4 0
+ASGNP4
+LABELV $241
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1032
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $243
+ADDRGP4 $245
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $240
+JUMPV
+LABELV $243
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $248
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $246
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $249
+ADDRGP4 $251
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $240
+JUMPV
+LABELV $249
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $240
+JUMPV
+LABELV $246
+ADDRLP4 1028
+CNSTI4 1
+ASGNI4
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRGP4 $257
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $240
+JUMPV
+LABELV $255
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $258
+ADDRGP4 $260
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $261
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $240
+JUMPV
+LABELV $258
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $264
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $262
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+GEI4 $265
+ADDRGP4 $267
+ARGP4
+ADDRLP4 1028
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $240
+JUMPV
+LABELV $265
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $263
+ADDRLP4 4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $270
+ADDRGP4 $272
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $240
+JUMPV
+LABELV $270
+CNSTI4 1
+RETI4
+ADDRGP4 $240
+JUMPV
+LABELV $262
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $248
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $273
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $273
+LABELV $263
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $275
+ADDRGP4 $277
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $276
+JUMPV
+LABELV $275
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $276
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $278
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $253
+ADDRGP4 $252
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $240
+endproc Script_ParseExt 1056 12
+export Script_Parse
+proc Script_Parse 4 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+ADDRGP4 Script_ParseExt
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $279
+endproc Script_Parse 4 12
+export PC_Script_ParseExt
+proc PC_Script_ParseExt 2092 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 UseScriptBuffer
+INDIRI4
+CNSTI4 0
+EQI4 $281
+ADDRGP4 ScriptBuffer
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 2068
+ADDRGP4 Script_ParseExt
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+RETI4
+ADDRGP4 $280
+JUMPV
+LABELV $281
+ADDRLP4 1040
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $283
+ADDRFP4 8
+INDIRP4
+CNSTP4 0
+ASGNP4
+LABELV $283
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 2068
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $285
+ADDRGP4 $287
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $280
+JUMPV
+LABELV $285
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $248
+ARGP4
+ADDRLP4 2072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+EQI4 $288
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $291
+ADDRGP4 $293
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $280
+JUMPV
+LABELV $291
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 2076
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 2076
+INDIRP4
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $280
+JUMPV
+LABELV $288
+ADDRLP4 2064
+CNSTI4 1
+ASGNI4
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 2076
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $299
+ADDRGP4 $301
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $280
+JUMPV
+LABELV $299
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $264
+ARGP4
+ADDRLP4 2080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2080
+INDIRI4
+CNSTI4 0
+NEI4 $302
+ADDRLP4 2064
+ADDRLP4 2064
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 2064
+INDIRI4
+CNSTI4 0
+GEI4 $305
+ADDRGP4 $307
+ARGP4
+ADDRLP4 2064
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $280
+JUMPV
+LABELV $305
+ADDRLP4 2064
+INDIRI4
+CNSTI4 0
+NEI4 $303
+ADDRLP4 1040
+ARGP4
+ADDRLP4 2084
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 2084
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $310
+ADDRGP4 $312
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $280
+JUMPV
+LABELV $310
+CNSTI4 1
+RETI4
+ADDRGP4 $280
+JUMPV
+LABELV $302
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $248
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $313
+ADDRLP4 2064
+ADDRLP4 2064
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $313
+LABELV $303
+ADDRLP4 0+16+1
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $316
+ADDRGP4 $277
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 2088
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2088
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $317
+JUMPV
+LABELV $316
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $317
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $278
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $297
+ADDRGP4 $296
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $280
+endproc PC_Script_ParseExt 2092 12
+export PC_Script_Parse
+proc PC_Script_Parse 4 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_ParseExt
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $322
+endproc PC_Script_Parse 4 12
+export Parenthesis_Parse
+proc Parenthesis_Parse 1056 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1032
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $324
+ADDRGP4 $326
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $324
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $327
+ADDRGP4 $330
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $327
+ADDRLP4 1028
+CNSTI4 1
+ASGNI4
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $334
+ADDRGP4 $336
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $334
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $339
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $337
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+GEI4 $340
+ADDRGP4 $342
+ARGP4
+ADDRLP4 1028
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $340
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $338
+ADDRLP4 4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $345
+ADDRGP4 $347
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $345
+CNSTI4 1
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $337
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $348
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $348
+LABELV $338
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $350
+ADDRGP4 $277
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $351
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $278
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $332
+ADDRGP4 $331
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $323
+endproc Parenthesis_Parse 1056 12
+export PC_Parenthesis_Parse
+proc PC_Parenthesis_Parse 2092 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 UseScriptBuffer
+INDIRI4
+CNSTI4 0
+EQI4 $353
+ADDRGP4 ScriptBuffer
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 2068
+ADDRGP4 Parenthesis_Parse
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+RETI4
+ADDRGP4 $352
+JUMPV
+LABELV $353
+ADDRLP4 1040
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 2068
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $355
+ADDRGP4 $357
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $352
+JUMPV
+LABELV $355
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 2072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+EQI4 $358
+ADDRGP4 $361
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $352
+JUMPV
+LABELV $358
+ADDRLP4 2064
+CNSTI4 1
+ASGNI4
+ADDRGP4 $364
+JUMPV
+LABELV $363
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 2076
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $366
+ADDRGP4 $368
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $352
+JUMPV
+LABELV $366
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $339
+ARGP4
+ADDRLP4 2080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2080
+INDIRI4
+CNSTI4 0
+NEI4 $369
+ADDRLP4 2064
+ADDRLP4 2064
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 2064
+INDIRI4
+CNSTI4 0
+GEI4 $372
+ADDRGP4 $374
+ARGP4
+ADDRLP4 2064
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $352
+JUMPV
+LABELV $372
+ADDRLP4 2064
+INDIRI4
+CNSTI4 0
+NEI4 $370
+ADDRLP4 1040
+ARGP4
+ADDRLP4 2084
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 2084
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $377
+ADDRGP4 $379
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $352
+JUMPV
+LABELV $377
+CNSTI4 1
+RETI4
+ADDRGP4 $352
+JUMPV
+LABELV $369
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $380
+ADDRLP4 2064
+ADDRLP4 2064
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $380
+LABELV $370
+ADDRLP4 0+16+1
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $383
+ADDRGP4 $277
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 2088
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2088
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $384
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $278
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $364
+ADDRGP4 $363
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $352
+endproc PC_Parenthesis_Parse 2092 12
+export Init_Display
+proc Init_Display 0 0
+ADDRGP4 DC
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $389
+endproc Init_Display 0 0
+proc GradientBar_Paint 28 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 5633936
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $390
+endproc GradientBar_Paint 28 28
+proc Window_Init 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 188
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $391
+endproc Window_Init 8 12
+proc Fade 8 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 96
+BANDI4
+CNSTI4 0
+EQI4 $393
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRP4
+INDIRI4
+LEI4 $395
+ADDRFP4 12
+INDIRP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $398
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 0
+GTF4 $398
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -37
+BANDI4
+ASGNI4
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LTF4 $401
+ADDRFP4 4
+INDIRP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $403
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+LABELV $403
+LABELV $401
+LABELV $398
+LABELV $395
+LABELV $393
+LABELV $392
+endproc Fade 8 0
+lit
+align 4
+LABELV $406
+byte 4 0
+skip 12
+code
+proc Window_Paint 96 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 $406
+INDIRB
+ASGNB 16
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $407
+ADDRGP4 $405
+JUMPV
+LABELV $407
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $409
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16+12
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 36
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $409
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $414
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $414
+ADDRGP4 $405
+JUMPV
+LABELV $414
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $416
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 0+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+ASGNF4
+LABELV $416
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 48
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $422
+JUMPV
+LABELV $423
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $422
+JUMPV
+LABELV $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $431
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44
+ARGP4
+ADDRGP4 GradientBar_Paint
+CALLV
+pop
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $435
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $440
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $441
+ADDRLP4 16
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $447
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $449
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44
+ARGP4
+ADDRLP4 64
+ADDRGP4 DC
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -2
+ASGNI4
+LABELV $454
+LABELV $449
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $456
+LABELV $447
+LABELV $441
+LABELV $434
+LABELV $432
+LABELV $422
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $463
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+LEF4 $465
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $466
+JUMPV
+LABELV $465
+ADDRLP4 16+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 44
+INDIRF4
+ASGNF4
+LABELV $466
+ADDRLP4 16+12
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $462
+JUMPV
+LABELV $463
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $462
+JUMPV
+LABELV $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $472
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $473
+JUMPV
+LABELV $472
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $476
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 60
+ARGP4
+ADDRGP4 GradientBar_Paint
+CALLV
+pop
+ADDRLP4 44+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 44
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 80
+ARGP4
+ADDRGP4 GradientBar_Paint
+CALLV
+pop
+LABELV $476
+LABELV $475
+LABELV $473
+LABELV $462
+LABELV $405
+endproc Window_Paint 96 32
+proc Item_SetScreenCoords 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $481
+ADDRGP4 $480
+JUMPV
+LABELV $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $483
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $483
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $480
+endproc Item_SetScreenCoords 16 0
+proc Item_UpdatePosition 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $488
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+NEU4 $486
+LABELV $488
+ADDRGP4 $485
+JUMPV
+LABELV $486
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $489
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_SetScreenCoords
+CALLV
+pop
+LABELV $485
+endproc Item_UpdatePosition 28 12
+proc Menu_UpdatePosition 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $492
+ADDRGP4 $491
+JUMPV
+LABELV $492
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $494
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $494
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $499
+JUMPV
+LABELV $496
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_SetScreenCoords
+CALLV
+pop
+LABELV $497
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $499
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $496
+LABELV $491
+endproc Menu_UpdatePosition 20 12
+proc Menu_PostParse 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $501
+ADDRGP4 $500
+JUMPV
+LABELV $501
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $503
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1142947840
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1139802112
+ASGNF4
+LABELV $503
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_UpdatePosition
+CALLV
+pop
+LABELV $500
+endproc Menu_PostParse 0 4
+proc Menu_ClearFocus 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $506
+CNSTP4 0
+RETP4
+ADDRGP4 $505
+JUMPV
+LABELV $506
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $511
+JUMPV
+LABELV $508
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $512
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $512
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $514
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $514
+LABELV $509
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $511
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $508
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $505
+endproc Menu_ClearFocus 20 8
+proc IsVisible 12 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $518
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 8
+INDIRI4
+NEI4 $518
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $519
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $516
+endproc IsVisible 12 0
+proc Rect_ContainsPoint 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $521
+ADDRLP4 0
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $523
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $523
+ADDRLP4 12
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $523
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $523
+CNSTI4 1
+RETI4
+ADDRGP4 $520
+JUMPV
+LABELV $523
+LABELV $521
+CNSTI4 0
+RETI4
+LABELV $520
+endproc Rect_ContainsPoint 20 0
+proc Rect_ContainsWidescreenPoint 56 12
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $526
+ADDRGP4 $528
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $525
+JUMPV
+LABELV $526
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 36
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 36
+INDIRP4
+CNSTI4 5653692
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 36
+INDIRP4
+CNSTI4 5653696
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1082130432
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CVIF4 4
+CNSTF4 1077936128
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1142947840
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRF4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $532
+ADDRLP4 20
+INDIRF4
+CNSTF4 1067450368
+LEF4 $532
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5653776
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $529
+LABELV $532
+ADDRGP4 $530
+JUMPV
+LABELV $529
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $533
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $534
+JUMPV
+LABELV $533
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $536
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRFP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $539
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $539
+LABELV $537
+LABELV $534
+LABELV $530
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+RETI4
+LABELV $525
+endproc Rect_ContainsWidescreenPoint 56 12
+proc CursorX_Widescreen 44 0
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 24
+INDIRP4
+CNSTI4 5653692
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 24
+INDIRP4
+CNSTI4 5653696
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1082130432
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CVIF4 4
+CNSTF4 1077936128
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1142947840
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 40
+INDIRF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRLP4 8
+INDIRF4
+CNSTF4 1067450368
+LEF4 $546
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5653776
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $543
+LABELV $546
+ADDRGP4 $544
+JUMPV
+LABELV $543
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $547
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $548
+JUMPV
+LABELV $547
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $549
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $550
+JUMPV
+LABELV $549
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $551
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+LABELV $551
+LABELV $550
+LABELV $548
+LABELV $544
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $553
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $554
+JUMPV
+LABELV $553
+ADDRLP4 0
+INDIRF4
+CNSTF4 1142947840
+LEF4 $555
+ADDRLP4 0
+CNSTF4 1142947840
+ASGNF4
+LABELV $555
+LABELV $554
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $542
+endproc CursorX_Widescreen 44 0
+proc Menu_ItemsMatchingGroup 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $561
+JUMPV
+LABELV $558
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $564
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $562
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $562
+LABELV $564
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $562
+LABELV $559
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $561
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $558
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $557
+endproc Menu_ItemsMatchingGroup 20 8
+proc Menu_GetMatchingItemByNumber 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $566
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $572
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $570
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $570
+LABELV $572
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $573
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $565
+JUMPV
+LABELV $573
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $570
+LABELV $567
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $569
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $566
+CNSTP4 0
+RETP4
+LABELV $565
+endproc Menu_GetMatchingItemByNumber 20 8
+proc Script_SetColor 36 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $576
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $580
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $578
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+CNSTI4 132
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 24
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 4194304
+BORI4
+ASGNI4
+ADDRGP4 $579
+JUMPV
+LABELV $578
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $583
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $581
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 28
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRGP4 $582
+JUMPV
+LABELV $581
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $586
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $584
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ASGNP4
+LABELV $584
+LABELV $582
+LABELV $579
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $587
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $589
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $593
+ADDRGP4 $575
+JUMPV
+LABELV $593
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $590
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $589
+LABELV $587
+LABELV $576
+LABELV $575
+endproc Script_SetColor 36 8
+proc Script_SetAsset 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $596
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $598
+LABELV $598
+LABELV $596
+LABELV $595
+endproc Script_SetAsset 8 8
+proc Script_SetBackground 20 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $601
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $603
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $603
+LABELV $601
+LABELV $600
+endproc Script_SetBackground 20 8
+proc Menu_FindItemByName 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $608
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $606
+LABELV $608
+CNSTP4 0
+RETP4
+ADDRGP4 $605
+JUMPV
+LABELV $606
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $612
+JUMPV
+LABELV $609
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $613
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $605
+JUMPV
+LABELV $613
+LABELV $610
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $612
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $609
+CNSTP4 0
+RETP4
+LABELV $605
+endproc Menu_FindItemByName 12 8
+proc Script_SetTeamColor 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $616
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $618
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $619
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $618
+LABELV $616
+LABELV $615
+endproc Script_SetTeamColor 24 4
+proc Script_SetItemColor 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 32
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $623
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 36
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 56
+ADDRGP4 Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $625
+ADDRGP4 $622
+JUMPV
+LABELV $625
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 $630
+JUMPV
+LABELV $627
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $631
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $580
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $633
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+CNSTI4 132
+ADDP4
+ASGNP4
+ADDRGP4 $634
+JUMPV
+LABELV $633
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $583
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $635
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 44
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRGP4 $636
+JUMPV
+LABELV $635
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $586
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $637
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+CNSTI4 148
+ADDP4
+ASGNP4
+LABELV $637
+LABELV $636
+LABELV $634
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $639
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $641
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $642
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $641
+LABELV $639
+LABELV $631
+LABELV $628
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $630
+ADDRLP4 40
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $627
+LABELV $623
+LABELV $622
+endproc Script_SetItemColor 80 12
+proc Menu_ShowItemByName 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $649
+JUMPV
+LABELV $646
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $650
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $652
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $653
+JUMPV
+LABELV $652
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $654
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $654
+LABELV $653
+LABELV $650
+LABELV $647
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $649
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $646
+LABELV $645
+endproc Menu_ShowItemByName 24 12
+proc Menu_FadeItemByName 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $660
+JUMPV
+LABELV $657
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $661
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $663
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 36
+BORI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+ADDRGP4 $664
+JUMPV
+LABELV $663
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 68
+BORI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+LABELV $664
+LABELV $661
+LABELV $658
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $660
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $657
+LABELV $656
+endproc Menu_FadeItemByName 28 12
+export Menus_FindByName
+proc Menus_FindByName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $669
+JUMPV
+LABELV $666
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $670
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+RETP4
+ADDRGP4 $665
+JUMPV
+LABELV $670
+LABELV $667
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $669
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $666
+CNSTP4 0
+RETP4
+LABELV $665
+endproc Menus_FindByName 8 8
+export Menus_ShowByName
+proc Menus_ShowByName 8 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $674
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_Activate
+CALLV
+pop
+LABELV $674
+LABELV $673
+endproc Menus_ShowByName 8 4
+export Menus_OpenByName
+proc Menus_OpenByName 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+LABELV $676
+endproc Menus_OpenByName 0 4
+proc Menu_RunCloseScript 588 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $678
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $678
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $678
+ADDRLP4 8+240
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $678
+LABELV $677
+endproc Menu_RunCloseScript 588 8
+export Menus_CloseByName
+proc Menus_CloseByName 12 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $682
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+LABELV $682
+LABELV $681
+endproc Menus_CloseByName 12 4
+export Menus_CloseAll
+proc Menus_CloseAll 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $688
+JUMPV
+LABELV $685
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+72
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+LABELV $686
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $688
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $685
+LABELV $684
+endproc Menus_CloseAll 8 4
+proc Script_Show 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $691
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_ShowItemByName
+CALLV
+pop
+LABELV $691
+LABELV $690
+endproc Script_Show 8 12
+proc Script_Hide 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $694
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_ShowItemByName
+CALLV
+pop
+LABELV $694
+LABELV $693
+endproc Script_Hide 8 12
+proc Script_FadeIn 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $697
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_FadeItemByName
+CALLV
+pop
+LABELV $697
+LABELV $696
+endproc Script_FadeIn 8 12
+proc Script_FadeOut 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $700
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_FadeItemByName
+CALLV
+pop
+LABELV $700
+LABELV $699
+endproc Script_FadeOut 8 12
+proc Script_Open 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $703
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+LABELV $703
+LABELV $702
+endproc Script_Open 8 8
+proc Script_ConditionalOpen 32 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $706
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $706
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $706
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+NEF4 $708
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+ADDRGP4 $709
+JUMPV
+LABELV $708
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+LABELV $709
+LABELV $706
+LABELV $705
+endproc Script_ConditionalOpen 32 8
+proc Script_Close 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $711
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+LABELV $711
+LABELV $710
+endproc Script_Close 8 8
+proc Menu_TransitionItemByName 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $717
+JUMPV
+LABELV $714
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $718
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 260
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 20
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 20
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 20
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 12
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 48
+INDIRF4
+ADDRFP4 20
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $718
+LABELV $715
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $717
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $714
+LABELV $713
+endproc Menu_TransitionItemByName 52 12
+proc Script_Transition 96 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $721
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $723
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 52
+ADDRGP4 Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $723
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 56
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $723
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 60
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $723
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRLP4 4
+INDIRB
+ASGNB 16
+ADDRLP4 64
+ARGP4
+ADDRLP4 80
+ADDRLP4 20
+INDIRB
+ASGNB 16
+ADDRLP4 80
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 Menu_TransitionItemByName
+CALLV
+pop
+LABELV $723
+LABELV $721
+LABELV $720
+endproc Script_Transition 96 24
+proc Menu_OrbitItemByName 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $729
+JUMPV
+LABELV $726
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $730
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 65540
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $730
+LABELV $727
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $729
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $726
+LABELV $725
+endproc Menu_OrbitItemByName 24 12
+proc Script_Orbit 48 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $733
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $735
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $735
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $735
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $735
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 44
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $735
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 Menu_OrbitItemByName
+CALLV
+pop
+LABELV $735
+LABELV $733
+LABELV $732
+endproc Script_Orbit 48 28
+proc Script_SetFocus 36 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $738
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_FindItemByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $740
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $740
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $740
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Menu_ClearFocus
+CALLP4
+pop
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $742
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $742
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5633996
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $744
+ADDRLP4 32
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 5633996
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $744
+LABELV $740
+LABELV $738
+LABELV $737
+endproc Script_SetFocus 36 8
+proc Script_SetPlayerModel 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $747
+ADDRGP4 $749
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $747
+LABELV $746
+endproc Script_SetPlayerModel 8 8
+proc Script_SetPlayerHead 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $751
+ADDRGP4 $753
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $751
+LABELV $750
+endproc Script_SetPlayerHead 8 8
+proc Script_SetCvar 16 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $755
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $755
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $755
+LABELV $754
+endproc Script_SetCvar 16 8
+proc Script_SetVar 24 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $758
+ADDRGP4 $760
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $757
+JUMPV
+LABELV $758
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Parenthesis_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $761
+ADDRGP4 $763
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $757
+JUMPV
+LABELV $761
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 Q_MathScript
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 MenuVar_Set
+CALLI4
+pop
+LABELV $757
+endproc Script_SetVar 24 12
+proc Script_Exec 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $765
+ADDRGP4 DC
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $767
+ADDRGP4 $769
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $767
+LABELV $765
+LABELV $764
+endproc Script_Exec 12 8
+proc Script_Play 20 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $771
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $773
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $773
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $771
+LABELV $770
+endproc Script_Play 20 8
+proc Script_playLooped 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $776
+ADDRGP4 DC
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $776
+LABELV $775
+endproc Script_playLooped 12 8
+data
+export commandList
+align 4
+LABELV commandList
+address $778
+address Script_FadeIn
+address $779
+address Script_FadeOut
+address $780
+address Script_Show
+address $781
+address Script_Hide
+address $782
+address Script_SetColor
+address $783
+address Script_Open
+address $784
+address Script_ConditionalOpen
+address $785
+address Script_Close
+address $786
+address Script_SetAsset
+address $787
+address Script_SetBackground
+address $788
+address Script_SetItemColor
+address $789
+address Script_SetTeamColor
+address $790
+address Script_SetFocus
+address $791
+address Script_SetPlayerModel
+address $792
+address Script_SetPlayerHead
+address $793
+address Script_Transition
+address $794
+address Script_SetCvar
+address $795
+address Script_SetVar
+address $796
+address Script_Exec
+address $797
+address Script_Play
+address $798
+address Script_playLooped
+address $799
+address Script_Orbit
+align 4
+LABELV scriptCommandCount
+byte 4 22
+code
+proc Item_RunScript 1064 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1036
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 1036
+INDIRU4
+EQU4 $801
+ADDRLP4 1040
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+ADDRLP4 1036
+INDIRU4
+EQU4 $801
+ADDRLP4 1040
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $801
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 12
+ASGNP4
+ADDRGP4 $804
+JUMPV
+LABELV $803
+ADDRLP4 8
+ARGP4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1048
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $806
+ADDRGP4 $800
+JUMPV
+LABELV $806
+ADDRLP4 1052
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $808
+ADDRLP4 1052
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $808
+ADDRGP4 $804
+JUMPV
+LABELV $808
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRGP4 $813
+JUMPV
+LABELV $810
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commandList
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $814
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commandList+4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $812
+JUMPV
+LABELV $814
+LABELV $811
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $813
+ADDRLP4 0
+INDIRI4
+ADDRGP4 scriptCommandCount
+INDIRI4
+LTI4 $810
+LABELV $812
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $817
+ADDRLP4 8
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $817
+LABELV $804
+ADDRGP4 $803
+JUMPV
+LABELV $801
+LABELV $800
+endproc Item_RunScript 1064 12
+proc Item_EnableShowViaCvar 2088 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1032
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 1032
+INDIRU4
+EQU4 $820
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+ADDRLP4 1032
+INDIRU4
+EQU4 $820
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRLP4 1036
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 1040
+INDIRI4
+EQI4 $820
+ADDRLP4 1044
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+CVPU4 4
+ADDRLP4 1032
+INDIRU4
+EQU4 $820
+ADDRLP4 1044
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 1040
+INDIRI4
+EQI4 $820
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $823
+JUMPV
+LABELV $822
+ADDRLP4 0
+ARGP4
+ADDRLP4 2072
+ARGP4
+ADDRLP4 2076
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $825
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $828
+ADDRLP4 2080
+CNSTI4 0
+ASGNI4
+ADDRGP4 $829
+JUMPV
+LABELV $828
+ADDRLP4 2080
+CNSTI4 1
+ASGNI4
+LABELV $829
+ADDRLP4 2080
+INDIRI4
+RETI4
+ADDRGP4 $819
+JUMPV
+LABELV $825
+ADDRLP4 2080
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 2080
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $830
+ADDRLP4 2080
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $830
+ADDRGP4 $823
+JUMPV
+LABELV $830
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $832
+ADDRLP4 1048
+ARGP4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $833
+CNSTI4 1
+RETI4
+ADDRGP4 $819
+JUMPV
+LABELV $832
+ADDRLP4 1048
+ARGP4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $836
+CNSTI4 0
+RETI4
+ADDRGP4 $819
+JUMPV
+LABELV $836
+LABELV $833
+LABELV $823
+ADDRGP4 $822
+JUMPV
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $839
+ADDRLP4 2072
+CNSTI4 0
+ASGNI4
+ADDRGP4 $840
+JUMPV
+LABELV $839
+ADDRLP4 2072
+CNSTI4 1
+ASGNI4
+LABELV $840
+ADDRLP4 2072
+INDIRI4
+RETI4
+ADDRGP4 $819
+JUMPV
+LABELV $820
+CNSTI4 1
+RETI4
+LABELV $819
+endproc Item_EnableShowViaCvar 2088 12
+proc Item_SetFocus 80 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5633996
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $842
+CNSTI4 0
+RETI4
+ADDRGP4 $841
+JUMPV
+LABELV $842
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $844
+CNSTI4 1
+RETI4
+ADDRGP4 $841
+JUMPV
+LABELV $844
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $850
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 28
+INDIRI4
+NEI4 $850
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 28
+INDIRI4
+NEI4 $850
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 28
+INDIRI4
+NEI4 $846
+LABELV $850
+CNSTI4 0
+RETI4
+ADDRGP4 $841
+JUMPV
+LABELV $846
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $851
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $851
+CNSTI4 0
+RETI4
+ADDRGP4 $841
+JUMPV
+LABELV $851
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $853
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 44
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $853
+CNSTI4 0
+RETI4
+ADDRGP4 $841
+JUMPV
+LABELV $853
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Menu_ClearFocus
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $855
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRB
+ASGNB 16
+ADDRLP4 52+4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 52+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $859
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $861
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+ASGNP4
+LABELV $861
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $859
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $856
+ADDRLP4 72
+ADDRLP4 16
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $856
+ADDRLP4 76
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRGP4 $856
+JUMPV
+LABELV $855
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $867
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $867
+ADDRFP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $869
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+ASGNP4
+LABELV $869
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $856
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $871
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $871
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $871
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $876
+JUMPV
+LABELV $873
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $877
+ADDRLP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $875
+JUMPV
+LABELV $877
+LABELV $874
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $876
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $873
+LABELV $875
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $879
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $879
+ADDRGP4 LastFocusItem
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $879
+CNSTI4 1
+RETI4
+LABELV $841
+endproc Item_SetFocus 80 16
+proc Item_ListBox_MaxScroll 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $882
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+SUBF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $883
+JUMPV
+LABELV $882
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+DIVF4
+SUBF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $883
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $884
+CNSTI4 0
+RETI4
+ADDRGP4 $881
+JUMPV
+LABELV $884
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $881
+endproc Item_ListBox_MaxScroll 16 4
+proc Item_ListBox_ThumbPosition 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $887
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $889
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $890
+JUMPV
+LABELV $889
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $890
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+CVFI4 4
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $887
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $891
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $892
+JUMPV
+LABELV $891
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $892
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+CVFI4 4
+RETI4
+LABELV $886
+endproc Item_ListBox_ThumbPosition 20 4
+proc Item_ListBox_ThumbDrawPosition 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 itemCapture
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $894
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $896
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1107296256
+SUBF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CursorX_Widescreen
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1090519040
+ADDF4
+LTF4 $898
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CursorX_Widescreen
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1090519040
+ADDF4
+GTF4 $898
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CursorX_Widescreen
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+CVFI4 4
+RETI4
+ADDRGP4 $893
+JUMPV
+LABELV $898
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $893
+JUMPV
+LABELV $896
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1107296256
+SUBF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+ADDF4
+LTF4 $900
+ADDRLP4 20
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+ADDF4
+GTF4 $900
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1090519040
+SUBF4
+CVFI4 4
+RETI4
+ADDRGP4 $893
+JUMPV
+LABELV $900
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $893
+JUMPV
+LABELV $894
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $893
+endproc Item_ListBox_ThumbDrawPosition 32 4
+proc Item_Slider_ThumbPosition 28 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $903
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $904
+JUMPV
+LABELV $903
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $904
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $907
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+NEU4 $905
+LABELV $907
+ADDRLP4 8
+INDIRF4
+RETF4
+ADDRGP4 $902
+JUMPV
+LABELV $905
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+GEF4 $908
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 $909
+JUMPV
+LABELV $908
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+LEF4 $910
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $910
+LABELV $909
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1119879168
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $902
+endproc Item_Slider_ThumbPosition 28 4
+proc Item_Slider_OverSlider 24 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $913
+ADDRGP4 $915
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $912
+JUMPV
+LABELV $913
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Item_Slider_ThumbPosition
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $919
+CNSTI4 8192
+RETI4
+ADDRGP4 $912
+JUMPV
+LABELV $919
+CNSTI4 0
+RETI4
+LABELV $912
+endproc Item_Slider_OverSlider 24 16
+proc Item_ListBox_OverLB 64 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $922
+ADDRGP4 $924
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $922
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $925
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $930
+CNSTI4 2048
+RETI4
+ADDRGP4 $921
+JUMPV
+LABELV $930
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $932
+CNSTI4 4096
+RETI4
+ADDRGP4 $921
+JUMPV
+LABELV $932
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $934
+CNSTI4 8192
+RETI4
+ADDRGP4 $921
+JUMPV
+LABELV $934
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $937
+CNSTI4 16384
+RETI4
+ADDRGP4 $921
+JUMPV
+LABELV $937
+ADDRLP4 52
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $926
+CNSTI4 32768
+RETI4
+ADDRGP4 $921
+JUMPV
+LABELV $925
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $945
+CNSTI4 2048
+RETI4
+ADDRGP4 $921
+JUMPV
+LABELV $945
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $948
+CNSTI4 4096
+RETI4
+ADDRGP4 $921
+JUMPV
+LABELV $948
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $951
+CNSTI4 8192
+RETI4
+ADDRGP4 $921
+JUMPV
+LABELV $951
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $956
+CNSTI4 16384
+RETI4
+ADDRGP4 $921
+JUMPV
+LABELV $956
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $960
+CNSTI4 32768
+RETI4
+ADDRGP4 $921
+JUMPV
+LABELV $960
+LABELV $926
+CNSTI4 0
+RETI4
+LABELV $921
+endproc Item_ListBox_OverLB 64 16
+proc Item_ListBox_MouseEnter 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -63489
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Item_ListBox_OverLB
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $963
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 63488
+BANDI4
+CNSTI4 0
+NEI4 $964
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $964
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $964
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $964
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $964
+JUMPV
+LABELV $963
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 63488
+BANDI4
+CNSTI4 0
+NEI4 $976
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 4+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $981
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LEI4 $984
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $984
+LABELV $981
+LABELV $976
+LABELV $964
+LABELV $962
+endproc Item_ListBox_MouseEnter 60 16
+proc Item_MouseEnter 44 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $987
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRB
+ASGNB 16
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $991
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $991
+ADDRGP4 $986
+JUMPV
+LABELV $991
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $993
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $993
+ADDRGP4 $986
+JUMPV
+LABELV $993
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $995
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+NEI4 $997
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $997
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $996
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $996
+JUMPV
+LABELV $995
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1001
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+LABELV $1001
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $1003
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $1003
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1005
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_ListBox_MouseEnter
+CALLV
+pop
+LABELV $1005
+LABELV $996
+LABELV $987
+LABELV $986
+endproc Item_MouseEnter 44 16
+proc Item_MouseLeave 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1008
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1010
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+LABELV $1010
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -6145
+BANDI4
+ASGNI4
+LABELV $1008
+LABELV $1007
+endproc Item_MouseLeave 8 8
+proc Item_SetMouseOver 4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1013
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1015
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $1016
+JUMPV
+LABELV $1015
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $1016
+LABELV $1013
+LABELV $1012
+endproc Item_SetMouseOver 4 0
+proc Item_OwnerDraw_HandleKey 12 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $1018
+ADDRGP4 DC
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $1018
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $1017
+JUMPV
+LABELV $1018
+CNSTI4 0
+RETI4
+LABELV $1017
+endproc Item_OwnerDraw_HandleKey 12 20
+proc Item_ListBox_HandleKey 76 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1023
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1021
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1021
+LABELV $1023
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1024
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 134
+EQI4 $1028
+ADDRFP4 4
+INDIRI4
+CNSTI4 163
+NEI4 $1026
+LABELV $1028
+ADDRLP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1029
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1031
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1031
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $1033
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1033
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $1035
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1035
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1030
+JUMPV
+LABELV $1029
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $1037
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1037
+LABELV $1030
+CNSTI4 1
+RETI4
+ADDRGP4 $1020
+JUMPV
+LABELV $1026
+ADDRFP4 4
+INDIRI4
+CNSTI4 135
+EQI4 $1041
+ADDRFP4 4
+INDIRI4
+CNSTI4 165
+NEI4 $1025
+LABELV $1041
+ADDRLP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1042
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $1044
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1044
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $1046
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1046
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $1048
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1043
+JUMPV
+LABELV $1042
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $1050
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1050
+LABELV $1043
+CNSTI4 1
+RETI4
+ADDRGP4 $1020
+JUMPV
+LABELV $1024
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+EQI4 $1055
+ADDRFP4 4
+INDIRI4
+CNSTI4 161
+EQI4 $1055
+ADDRFP4 4
+INDIRI4
+CNSTI4 184
+NEI4 $1052
+LABELV $1055
+ADDRLP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1056
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1058
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1058
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $1060
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1060
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $1062
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1062
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1057
+JUMPV
+LABELV $1056
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $1064
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1064
+LABELV $1057
+CNSTI4 1
+RETI4
+ADDRGP4 $1020
+JUMPV
+LABELV $1052
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+EQI4 $1069
+ADDRFP4 4
+INDIRI4
+CNSTI4 167
+EQI4 $1069
+ADDRFP4 4
+INDIRI4
+CNSTI4 183
+NEI4 $1066
+LABELV $1069
+ADDRLP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1070
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $1072
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1072
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $1074
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1074
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $1076
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1076
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1071
+JUMPV
+LABELV $1070
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $1078
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $1078
+LABELV $1071
+CNSTI4 1
+RETI4
+ADDRGP4 $1020
+JUMPV
+LABELV $1066
+LABELV $1025
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $1082
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+NEI4 $1080
+LABELV $1082
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1083
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $1084
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1084
+JUMPV
+LABELV $1083
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1087
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $1088
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $1088
+JUMPV
+LABELV $1087
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $1091
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $1092
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1092
+JUMPV
+LABELV $1091
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $1095
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $1096
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $1096
+JUMPV
+LABELV $1095
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1099
+ADDRGP4 $1100
+JUMPV
+LABELV $1099
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRGP4 lastListBoxClickTime
+INDIRI4
+GEI4 $1101
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1101
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $1101
+ADDRGP4 lastListBoxClickTime
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 300
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+EQI4 $1103
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 LastListSelected
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1103
+LABELV $1100
+LABELV $1096
+LABELV $1092
+LABELV $1088
+LABELV $1084
+CNSTI4 1
+RETI4
+ADDRGP4 $1020
+JUMPV
+LABELV $1080
+ADDRFP4 4
+INDIRI4
+CNSTI4 143
+EQI4 $1107
+ADDRFP4 4
+INDIRI4
+CNSTI4 160
+NEI4 $1105
+LABELV $1107
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1020
+JUMPV
+LABELV $1105
+ADDRFP4 4
+INDIRI4
+CNSTI4 144
+EQI4 $1110
+ADDRFP4 4
+INDIRI4
+CNSTI4 166
+NEI4 $1108
+LABELV $1110
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1020
+JUMPV
+LABELV $1108
+ADDRFP4 4
+INDIRI4
+CNSTI4 142
+EQI4 $1113
+ADDRFP4 4
+INDIRI4
+CNSTI4 162
+NEI4 $1111
+LABELV $1113
+ADDRLP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1114
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1116
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1116
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $1118
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1118
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $1120
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1120
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1115
+JUMPV
+LABELV $1114
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $1122
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1122
+LABELV $1115
+CNSTI4 1
+RETI4
+ADDRGP4 $1020
+JUMPV
+LABELV $1111
+ADDRFP4 4
+INDIRI4
+CNSTI4 141
+EQI4 $1126
+ADDRFP4 4
+INDIRI4
+CNSTI4 168
+NEI4 $1124
+LABELV $1126
+ADDRLP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1127
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $1129
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1129
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $1131
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1131
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $1133
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1133
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1128
+JUMPV
+LABELV $1127
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $1135
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $1135
+LABELV $1128
+CNSTI4 1
+RETI4
+ADDRGP4 $1020
+JUMPV
+LABELV $1124
+LABELV $1021
+CNSTI4 0
+RETI4
+LABELV $1020
+endproc Item_ListBox_HandleKey 76 16
+proc Item_YesNo_HandleKey 24 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1138
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $1143
+ADDRLP4 4
+INDIRI4
+CNSTI4 179
+EQI4 $1143
+ADDRLP4 4
+INDIRI4
+CNSTI4 180
+NEI4 $1140
+LABELV $1143
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1141
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1141
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1141
+JUMPV
+LABELV $1140
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1146
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1146
+LABELV $1141
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1148
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $1152
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1153
+JUMPV
+LABELV $1152
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1153
+ADDRGP4 $1150
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1137
+JUMPV
+LABELV $1148
+LABELV $1138
+CNSTI4 0
+RETI4
+LABELV $1137
+endproc Item_YesNo_HandleKey 24 16
+proc Item_Multi_CountSettings 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1155
+CNSTI4 0
+RETI4
+ADDRGP4 $1154
+JUMPV
+LABELV $1155
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+RETI4
+LABELV $1154
+endproc Item_Multi_CountSettings 4 0
+proc Item_Multi_FindCvarByValue 1040 12
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1158
+ADDRLP4 4
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1160
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1161
+JUMPV
+LABELV $1160
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+LABELV $1161
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1165
+JUMPV
+LABELV $1162
+ADDRLP4 4
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1166
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $1167
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1157
+JUMPV
+LABELV $1166
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEF4 $1170
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1157
+JUMPV
+LABELV $1170
+LABELV $1167
+LABELV $1163
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1165
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $1162
+LABELV $1158
+CNSTI4 0
+RETI4
+LABELV $1157
+endproc Item_Multi_FindCvarByValue 1040 12
+proc Item_Multi_Setting 1040 12
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1173
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1175
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1176
+JUMPV
+LABELV $1175
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+LABELV $1176
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1180
+JUMPV
+LABELV $1177
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1181
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $1182
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1172
+JUMPV
+LABELV $1181
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEF4 $1185
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1172
+JUMPV
+LABELV $1185
+LABELV $1182
+LABELV $1178
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1180
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $1177
+LABELV $1173
+ADDRGP4 $56
+RETP4
+LABELV $1172
+endproc Item_Multi_Setting 1040 12
+proc Item_Multi_HandleKey 40 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1188
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1190
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $1195
+ADDRLP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $1195
+ADDRLP4 8
+INDIRI4
+CNSTI4 180
+NEI4 $1192
+LABELV $1195
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $1193
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 24
+INDIRI4
+EQI4 $1193
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+NEI4 $1199
+ADDRLP4 28
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1200
+JUMPV
+LABELV $1199
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+LABELV $1200
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $1193
+JUMPV
+LABELV $1192
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $1193
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1201
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Item_Multi_FindCvarByValue
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Item_Multi_CountSettings
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $1203
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1204
+JUMPV
+LABELV $1203
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $1205
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1205
+LABELV $1204
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1207
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1208
+JUMPV
+LABELV $1207
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+NEF4 $1209
+ADDRGP4 $1150
+ARGP4
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1210
+JUMPV
+LABELV $1209
+ADDRGP4 $1211
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1210
+LABELV $1208
+CNSTI4 1
+RETI4
+ADDRGP4 $1187
+JUMPV
+LABELV $1201
+LABELV $1190
+LABELV $1188
+CNSTI4 0
+RETI4
+LABELV $1187
+endproc Item_Multi_HandleKey 40 16
+proc Item_TextField_HandleKey 1076 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1213
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1032
+ADDRLP4 1036
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1215
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+LEI4 $1215
+ADDRLP4 1032
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1215
+ADDRFP4 4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1217
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1025
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $1219
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1221
+ADDRLP4 1044
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 4-1
+ADDP4
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+GEI4 $1224
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1052
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1224
+LABELV $1221
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1219
+ADDRFP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $1228
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1226
+LABELV $1228
+CNSTI4 1
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1226
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $1229
+ADDRFP4 4
+INDIRI4
+CNSTI4 48
+LTI4 $1233
+ADDRFP4 4
+INDIRI4
+CNSTI4 57
+LEI4 $1231
+LABELV $1233
+CNSTI4 0
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1231
+LABELV $1229
+ADDRLP4 1044
+ADDRGP4 DC
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $1234
+ADDRLP4 1048
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 255
+EQI4 $1238
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $1236
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+LTI4 $1236
+LABELV $1238
+CNSTI4 1
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1236
+ADDRLP4 1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 4+1
+ADDP4
+ARGP4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 1056
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $1235
+JUMPV
+LABELV $1234
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $1240
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+LTI4 $1240
+CNSTI4 1
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1240
+LABELV $1235
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+GEI4 $1218
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $1218
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+LEI4 $1218
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1218
+JUMPV
+LABELV $1217
+ADDRFP4 4
+INDIRI4
+CNSTI4 140
+EQI4 $1248
+ADDRFP4 4
+INDIRI4
+CNSTI4 171
+NEI4 $1246
+LABELV $1248
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+GEI4 $1249
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 4+1
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1249
+CNSTI4 1
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1246
+ADDRFP4 4
+INDIRI4
+CNSTI4 135
+EQI4 $1254
+ADDRFP4 4
+INDIRI4
+CNSTI4 165
+NEI4 $1252
+LABELV $1254
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $1255
+ADDRLP4 1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+LTI4 $1255
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+GEI4 $1255
+ADDRLP4 1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1255
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+GEI4 $1257
+ADDRLP4 1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1257
+CNSTI4 1
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1252
+ADDRFP4 4
+INDIRI4
+CNSTI4 134
+EQI4 $1261
+ADDRFP4 4
+INDIRI4
+CNSTI4 163
+NEI4 $1259
+LABELV $1261
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1262
+ADDRLP4 1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1262
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+GEI4 $1264
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1264
+CNSTI4 1
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1259
+ADDRFP4 4
+INDIRI4
+CNSTI4 143
+EQI4 $1268
+ADDRFP4 4
+INDIRI4
+CNSTI4 160
+NEI4 $1266
+LABELV $1268
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1266
+ADDRFP4 4
+INDIRI4
+CNSTI4 144
+EQI4 $1271
+ADDRFP4 4
+INDIRI4
+CNSTI4 166
+NEI4 $1269
+LABELV $1271
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LEI4 $1272
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1272
+CNSTI4 1
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1269
+ADDRFP4 4
+INDIRI4
+CNSTI4 139
+EQI4 $1276
+ADDRFP4 4
+INDIRI4
+CNSTI4 170
+NEI4 $1274
+LABELV $1276
+ADDRLP4 1072
+ADDRGP4 DC
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $1278
+ADDRLP4 1068
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1278
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+LABELV $1279
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1274
+LABELV $1218
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $1283
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+EQI4 $1283
+ADDRFP4 4
+INDIRI4
+CNSTI4 167
+NEI4 $1280
+LABELV $1283
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Menu_SetNextCursorItem
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1284
+ADDRLP4 1056
+ADDRLP4 1028
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 4
+EQI4 $1286
+ADDRLP4 1056
+INDIRI4
+CNSTI4 9
+NEI4 $1284
+LABELV $1286
+ADDRGP4 g_editItem
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+LABELV $1284
+LABELV $1280
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+EQI4 $1289
+ADDRFP4 4
+INDIRI4
+CNSTI4 161
+NEI4 $1287
+LABELV $1289
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Menu_SetPrevCursorItem
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1290
+ADDRLP4 1060
+ADDRLP4 1028
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 4
+EQI4 $1292
+ADDRLP4 1060
+INDIRI4
+CNSTI4 9
+NEI4 $1290
+LABELV $1292
+ADDRGP4 g_editItem
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+LABELV $1290
+LABELV $1287
+ADDRFP4 4
+INDIRI4
+CNSTI4 13
+EQI4 $1296
+ADDRFP4 4
+INDIRI4
+CNSTI4 169
+EQI4 $1296
+ADDRFP4 4
+INDIRI4
+CNSTI4 27
+NEI4 $1293
+LABELV $1296
+CNSTI4 0
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1293
+CNSTI4 1
+RETI4
+ADDRGP4 $1212
+JUMPV
+LABELV $1213
+CNSTI4 0
+RETI4
+LABELV $1212
+endproc Item_TextField_HandleKey 1076 12
+proc Scroll_ListBox_AutoFunc 12 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+LEI4 $1298
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1298
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LEI4 $1300
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1302
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 40
+SUBI4
+ASGNI4
+LABELV $1302
+LABELV $1300
+LABELV $1297
+endproc Scroll_ListBox_AutoFunc 12 16
+proc Scroll_ListBox_ThumbFunc 68 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1305
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CursorX_Widescreen
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+NEF4 $1307
+ADDRGP4 $1304
+JUMPV
+LABELV $1307
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ADDRLP4 44
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 36
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CursorX_Widescreen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 56
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $1313
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1314
+JUMPV
+LABELV $1313
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $1315
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1315
+LABELV $1314
+ADDRLP4 28
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 CursorX_Widescreen
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRGP4 $1306
+JUMPV
+LABELV $1305
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+EQF4 $1317
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ADDRLP4 44
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 4+12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $1324
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1325
+JUMPV
+LABELV $1324
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $1326
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1326
+LABELV $1325
+ADDRLP4 28
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1317
+LABELV $1306
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+LEI4 $1328
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1328
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LEI4 $1330
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1332
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 40
+SUBI4
+ASGNI4
+LABELV $1332
+LABELV $1330
+LABELV $1304
+endproc Scroll_ListBox_ThumbFunc 68 16
+proc Scroll_Slider_ThumbFunc 32 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1335
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $1336
+JUMPV
+LABELV $1335
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $1336
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CursorX_Widescreen
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $1337
+ADDRLP4 12
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $1338
+JUMPV
+LABELV $1337
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1119879168
+ADDF4
+LEF4 $1339
+ADDRLP4 12
+ADDRLP4 8
+INDIRF4
+CNSTF4 1119879168
+ADDF4
+ASGNF4
+LABELV $1339
+LABELV $1338
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1119879168
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1211
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1334
+endproc Scroll_Slider_ThumbFunc 32 8
+proc Item_StartCapture 28 12
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $1342
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+GTI4 $1373
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1374-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1374
+address $1345
+address $1342
+address $1345
+address $1342
+address $1342
+address $1345
+address $1365
+code
+LABELV $1373
+ADDRLP4 4
+INDIRI4
+CNSTI4 14
+EQI4 $1363
+ADDRGP4 $1342
+JUMPV
+LABELV $1345
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Item_ListBox_OverLB
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6144
+BANDI4
+CNSTI4 0
+EQI4 $1346
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+ASGNP4
+ADDRGP4 scrollInfo
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRGP4 scrollInfo+4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+ADDRGP4 scrollInfo+8
+CNSTI4 500
+ASGNI4
+ADDRGP4 scrollInfo+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1353
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1354
+JUMPV
+LABELV $1353
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $1354
+ADDRGP4 scrollInfo+28
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 scrollInfo+24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 captureData
+ADDRGP4 scrollInfo
+ASGNP4
+ADDRGP4 captureFunc
+ADDRGP4 Scroll_ListBox_AutoFunc
+ASGNP4
+ADDRGP4 itemCapture
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1343
+JUMPV
+LABELV $1346
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1343
+ADDRGP4 scrollInfo+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 scrollInfo+24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 scrollInfo+24
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CursorX_Widescreen
+CALLF4
+ASGNF4
+ADDRGP4 scrollInfo+16
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 scrollInfo+20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 captureData
+ADDRGP4 scrollInfo
+ASGNP4
+ADDRGP4 captureFunc
+ADDRGP4 Scroll_ListBox_ThumbFunc
+ASGNP4
+ADDRGP4 itemCapture
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1343
+JUMPV
+LABELV $1363
+ADDRGP4 $1364
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Item_Slider_OverSlider
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1343
+ADDRGP4 scrollInfo+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 scrollInfo+24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 scrollInfo+24
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CursorX_Widescreen
+CALLF4
+ASGNF4
+ADDRGP4 scrollInfo+16
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 scrollInfo+20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 captureData
+ADDRGP4 scrollInfo
+ASGNP4
+ADDRGP4 captureFunc
+ADDRGP4 Scroll_Slider_ThumbFunc
+ASGNP4
+ADDRGP4 itemCapture
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1342
+LABELV $1343
+LABELV $1341
+endproc Item_StartCapture 28 12
+proc Item_StopCapture 0 0
+LABELV $1376
+endproc Item_StopCapture 0 0
+proc Item_Slider_HandleKey 76 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1378
+ADDRLP4 16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 178
+EQI4 $1383
+ADDRLP4 16
+INDIRI4
+CNSTI4 179
+EQI4 $1383
+ADDRLP4 16
+INDIRI4
+CNSTI4 180
+NEI4 $1380
+LABELV $1383
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1381
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $1381
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 36
+INDIRI4
+EQI4 $1381
+ADDRLP4 8
+CNSTF4 1119879168
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1386
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 56
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $1387
+JUMPV
+LABELV $1386
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $1387
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 40
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1086324736
+ASGNF4
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40+8
+CNSTF4 1120665600
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 56
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $1381
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 CursorX_Widescreen
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 64
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1211
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1377
+JUMPV
+LABELV $1380
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1391
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1393
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+SUBF4
+CNSTF4 1101004800
+DIVF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+GEF4 $1395
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1396
+JUMPV
+LABELV $1395
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+LEF4 $1397
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1397
+LABELV $1396
+ADDRGP4 $1211
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1377
+JUMPV
+LABELV $1393
+LABELV $1391
+LABELV $1381
+LABELV $1378
+CNSTI4 0
+RETI4
+LABELV $1377
+endproc Item_Slider_HandleKey 76 16
+proc Item_HandleKey 32 16
+ADDRGP4 itemCapture
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1400
+ADDRGP4 itemCapture
+INDIRP4
+ARGP4
+ADDRGP4 Item_StopCapture
+CALLV
+pop
+ADDRGP4 itemCapture
+CNSTP4 0
+ASGNP4
+ADDRGP4 captureFunc
+CNSTP4 0
+ASGNP4
+ADDRGP4 captureData
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1401
+JUMPV
+LABELV $1400
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1402
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 178
+EQI4 $1405
+ADDRLP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $1405
+ADDRLP4 0
+INDIRI4
+CNSTI4 180
+NEI4 $1402
+LABELV $1405
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Item_StartCapture
+CALLV
+pop
+LABELV $1402
+LABELV $1401
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1406
+CNSTI4 0
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1406
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $1408
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+GTI4 $1408
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1424-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1424
+address $1411
+address $1412
+address $1413
+address $1414
+address $1415
+address $1416
+address $1408
+address $1419
+address $1414
+address $1423
+address $1417
+address $1418
+address $1420
+address $1421
+code
+LABELV $1411
+CNSTI4 0
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1412
+CNSTI4 0
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1413
+CNSTI4 0
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1414
+CNSTI4 0
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1415
+CNSTI4 0
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1416
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1417
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Item_YesNo_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1418
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Item_Multi_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1419
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Item_OwnerDraw_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1420
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Item_Bind_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1421
+ADDRGP4 $1422
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1423
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Item_Slider_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1408
+CNSTI4 0
+RETI4
+LABELV $1399
+endproc Item_HandleKey 32 16
+proc Item_Action 4 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1427
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $1427
+LABELV $1426
+endproc Item_Action 4 8
+proc Menu_SetPrevCursorItem 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1433
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1433
+JUMPV
+LABELV $1432
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $1435
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $1435
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1435
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Item_SetFocus
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1437
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1429
+JUMPV
+LABELV $1437
+LABELV $1433
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 -1
+GTI4 $1432
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTP4 0
+RETP4
+LABELV $1429
+endproc Menu_SetPrevCursorItem 44 12
+proc Menu_SetNextCursorItem 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1443
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1443
+JUMPV
+LABELV $1442
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $1445
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1445
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1445
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Item_SetFocus
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1447
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1439
+JUMPV
+LABELV $1447
+LABELV $1443
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $1442
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTP4 0
+RETP4
+LABELV $1439
+endproc Menu_SetNextCursorItem 44 12
+proc Window_CloseCinematic 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1450
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1450
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1450
+LABELV $1449
+endproc Window_CloseCinematic 4 4
+proc Menu_CloseCinematics 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1453
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_CloseCinematic
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1458
+JUMPV
+LABELV $1455
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Window_CloseCinematic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1459
+CNSTI4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1459
+LABELV $1456
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1458
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $1455
+LABELV $1453
+LABELV $1452
+endproc Menu_CloseCinematics 4 4
+proc Display_CloseCinematics 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1465
+JUMPV
+LABELV $1462
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRGP4 Menu_CloseCinematics
+CALLV
+pop
+LABELV $1463
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1465
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $1462
+LABELV $1461
+endproc Display_CloseCinematics 4 4
+export Menus_Activate
+proc Menus_Activate 584 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 6
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1467
+ADDRLP4 4+240
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $1467
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1470
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1470
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1470
+ADDRGP4 Display_CloseCinematics
+CALLV
+pop
+LABELV $1466
+endproc Menus_Activate 584 8
+proc Display_VisibleMenuCount 12 0
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1476
+JUMPV
+LABELV $1473
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+72
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+EQI4 $1477
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1477
+LABELV $1474
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1476
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $1473
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $1472
+endproc Display_VisibleMenuCount 12 0
+proc Menus_HandleOOBClick 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1481
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1483
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1483
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+LABELV $1483
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1488
+JUMPV
+LABELV $1485
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Menu_OverActiveItem
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1489
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRGP4 Menus_Activate
+CALLV
+pop
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Menu_HandleKey
+CALLV
+pop
+LABELV $1489
+LABELV $1486
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1488
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $1485
+ADDRLP4 8
+ADDRGP4 Display_VisibleMenuCount
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1491
+ADDRGP4 DC
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1493
+CNSTI4 0
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1493
+LABELV $1491
+ADDRGP4 Display_CloseCinematics
+CALLV
+pop
+LABELV $1481
+LABELV $1480
+endproc Menus_HandleOOBClick 24 12
+bss
+align 4
+LABELV $1496
+skip 16
+code
+proc Item_CorrectedTextRect 4 12
+ADDRGP4 $1496
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 16
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1497
+ADDRGP4 $1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRB
+ASGNB 16
+ADDRGP4 $1496+8
+INDIRF4
+CNSTF4 0
+EQF4 $1499
+ADDRLP4 0
+ADDRGP4 $1496+4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 $1496+12
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1499
+LABELV $1497
+ADDRGP4 $1496
+RETP4
+LABELV $1495
+endproc Item_CorrectedTextRect 4 12
+export UI_SelectForKey
+proc UI_SelectForKey 32 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 163
+EQI4 $1508
+ADDRLP4 4
+CNSTI4 165
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1507
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $1510
+LABELV $1509
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 13
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1507
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1505
+LABELV $1511
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 134
+EQI4 $1508
+ADDRLP4 16
+INDIRI4
+CNSTI4 135
+EQI4 $1507
+ADDRGP4 $1505
+JUMPV
+LABELV $1510
+ADDRLP4 20
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 169
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $1507
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $1505
+LABELV $1512
+ADDRLP4 28
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 178
+LTI4 $1505
+ADDRLP4 28
+INDIRI4
+CNSTI4 188
+GTI4 $1505
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1513-712
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1513
+address $1507
+address $1508
+address $1507
+address $1505
+address $1505
+address $1505
+address $1505
+address $1507
+address $1507
+address $1507
+address $1507
+code
+LABELV $1507
+CNSTI4 1
+RETI4
+ADDRGP4 $1504
+JUMPV
+LABELV $1508
+CNSTI4 -1
+RETI4
+ADDRGP4 $1504
+JUMPV
+LABELV $1505
+CNSTI4 0
+RETI4
+LABELV $1504
+endproc UI_SelectForKey 32 0
+data
+align 4
+LABELV $1516
+byte 4 0
+align 4
+LABELV $1537
+byte 4 0
+export Menu_HandleKey
+code
+proc Menu_HandleKey 52 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1516
+INDIRI4
+CNSTI4 0
+EQI4 $1517
+ADDRGP4 $1515
+JUMPV
+LABELV $1517
+ADDRGP4 $1516
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_waitingForKey
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1519
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1519
+ADDRGP4 g_bindItem
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Item_Bind_HandleKey
+CALLI4
+pop
+ADDRGP4 $1516
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1515
+JUMPV
+LABELV $1519
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editingField
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1521
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1521
+ADDRGP4 g_editItem
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Item_TextField_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1523
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editingField
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 g_editItem
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1516
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $1515
+JUMPV
+LABELV $1523
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $1528
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+EQI4 $1528
+ADDRFP4 4
+INDIRI4
+CNSTI4 180
+NEI4 $1525
+LABELV $1528
+ADDRGP4 g_editingField
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editItem
+CNSTP4 0
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+ADDRGP4 $1526
+JUMPV
+LABELV $1525
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $1532
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+EQI4 $1532
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+NEI4 $1529
+LABELV $1532
+ADDRGP4 $1515
+JUMPV
+LABELV $1529
+LABELV $1526
+LABELV $1521
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1533
+ADDRGP4 $1516
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1515
+JUMPV
+LABELV $1533
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1535
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+ADDRLP4 12
+INDIRI4
+NEI4 $1535
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4364
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $1535
+ADDRGP4 $1537
+INDIRI4
+CNSTI4 0
+NEI4 $1538
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $1541
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+EQI4 $1541
+ADDRFP4 4
+INDIRI4
+CNSTI4 180
+NEI4 $1538
+LABELV $1541
+ADDRGP4 $1537
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Menus_HandleOOBClick
+CALLV
+pop
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1537
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $1516
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $1515
+JUMPV
+LABELV $1538
+LABELV $1535
+ADDRLP4 28
+ADDRGP4 LastFocusItem
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1542
+ADDRLP4 28
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1542
+ADDRLP4 0
+ADDRGP4 LastFocusItem
+INDIRP4
+ASGNP4
+LABELV $1542
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1544
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Item_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1546
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+ADDRGP4 $1516
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1515
+JUMPV
+LABELV $1546
+LABELV $1544
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1548
+ADDRGP4 $1516
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1515
+JUMPV
+LABELV $1548
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $1552
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+EQI4 $1552
+ADDRGP4 $1550
+JUMPV
+LABELV $1552
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1551
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1555
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $1551
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+ADDRGP4 $1551
+JUMPV
+LABELV $1555
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+EQI4 $1561
+ADDRLP4 36
+INDIRI4
+CNSTI4 9
+NEI4 $1559
+LABELV $1561
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $1551
+ADDRLP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editingField
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_editItem
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1551
+JUMPV
+LABELV $1559
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $1551
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+LABELV $1550
+LABELV $1551
+ADDRGP4 $1516
+CNSTI4 0
+ASGNI4
+LABELV $1515
+endproc Menu_HandleKey 52 16
+proc ToWindowCoords 8 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1567
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1567
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1566
+endproc ToWindowCoords 8 0
+proc Item_SetTextExtents 348 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1571
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $1572
+JUMPV
+LABELV $1571
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1572
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1573
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+INDIRB
+ASGNB 16
+LABELV $1573
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1575
+ADDRGP4 $1569
+JUMPV
+LABELV $1575
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 0
+EQF4 $1579
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1577
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1577
+LABELV $1579
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRLP4 4
+INDIRB
+ASGNB 16
+ADDRLP4 32
+ARGP4
+ADDRLP4 52
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1580
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+EQI4 $1582
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+NEI4 $1580
+LABELV $1582
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRLP4 4
+INDIRB
+ASGNB 16
+ADDRLP4 64
+ARGP4
+ADDRLP4 84
+ADDRGP4 DC
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1581
+JUMPV
+LABELV $1580
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1583
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1583
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1583
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 68
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRLP4 4
+INDIRB
+ASGNB 16
+ADDRLP4 324
+ARGP4
+ADDRLP4 344
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 344
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1583
+LABELV $1581
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRLP4 4
+INDIRB
+ASGNB 16
+ADDRLP4 68
+ARGP4
+ADDRLP4 88
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRLP4 4
+INDIRB
+ASGNB 16
+ADDRLP4 92
+ARGP4
+ADDRLP4 112
+ADDRGP4 DC
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1585
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $1586
+JUMPV
+LABELV $1585
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1587
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+LABELV $1587
+LABELV $1586
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ToWindowCoords
+CALLV
+pop
+LABELV $1577
+LABELV $1569
+endproc Item_SetTextExtents 348 24
+proc Item_TextColor 60 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1590
+ADDRLP4 28
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 36
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1591
+JUMPV
+LABELV $1590
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $1595
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 200
+DIVI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $1595
+ADDRLP4 32
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1596
+JUMPV
+LABELV $1595
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1596
+LABELV $1591
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTU4 0
+ASGNU4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+ADDRLP4 40
+INDIRU4
+EQU4 $1600
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+EQI4 $1600
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+ADDRLP4 40
+INDIRU4
+EQU4 $1600
+ADDRLP4 48
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+EQI4 $1600
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1602
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $1602
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1602
+LABELV $1600
+LABELV $1589
+endproc Item_TextColor 60 28
+proc Item_Text_AutoWrapped_Paint 2192 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1605
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+INDIRB
+ASGNB 16
+LABELV $1605
+ADDRLP4 1032
+CNSTF4 0
+ASGNF4
+ADDRLP4 1060
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1607
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1609
+ADDRGP4 $1604
+JUMPV
+LABELV $1609
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1072
+ADDRLP4 1096
+ASGNP4
+ADDRGP4 $1608
+JUMPV
+LABELV $1607
+ADDRLP4 1072
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1608
+ADDRLP4 1072
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1611
+ADDRGP4 $1604
+JUMPV
+LABELV $1611
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1076
+ARGP4
+ADDRGP4 Item_TextColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1092
+ARGP4
+ADDRLP4 1068
+ARGP4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRGP4 Item_SetTextExtents
+CALLV
+pop
+ADDRLP4 1064
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 2120
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 2120
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI1 0
+ASGNI1
+ADDRLP4 1036
+ADDRLP4 2120
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1072
+INDIRP4
+ASGNP4
+ADDRGP4 $1614
+JUMPV
+LABELV $1613
+ADDRLP4 2136
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2136
+INDIRI4
+CNSTI4 32
+EQI4 $1620
+ADDRLP4 2136
+INDIRI4
+CNSTI4 9
+EQI4 $1620
+ADDRLP4 2136
+INDIRI4
+CNSTI4 10
+EQI4 $1620
+ADDRLP4 2136
+INDIRI4
+CNSTI4 0
+NEI4 $1616
+LABELV $1620
+ADDRLP4 1036
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1056
+ADDRLP4 1032
+INDIRF4
+ASGNF4
+LABELV $1616
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2140
+ADDRLP4 1040
+INDIRB
+ASGNB 16
+ADDRLP4 2140
+ARGP4
+ADDRLP4 2160
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 2160
+INDIRF4
+ASGNF4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $1624
+ADDRLP4 1032
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GTF4 $1625
+LABELV $1624
+ADDRLP4 2164
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2164
+INDIRI4
+CNSTI4 10
+EQI4 $1625
+ADDRLP4 2164
+INDIRI4
+CNSTI4 0
+NEI4 $1621
+LABELV $1625
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1626
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1628
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1629
+JUMPV
+LABELV $1628
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1630
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ADDRLP4 1056
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $1631
+JUMPV
+LABELV $1630
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1632
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ADDRLP4 1056
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+LABELV $1632
+LABELV $1631
+LABELV $1629
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 1064
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ToWindowCoords
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1076
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2172
+ADDRLP4 1040
+INDIRB
+ASGNB 16
+ADDRLP4 2172
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1626
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1634
+ADDRGP4 $1615
+JUMPV
+LABELV $1634
+ADDRLP4 1064
+ADDRLP4 1064
+INDIRF4
+ADDRLP4 1068
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 2168
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 2168
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 2168
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1614
+JUMPV
+LABELV $1621
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2128
+ARGP4
+ADDRLP4 2132
+ARGP4
+ADDRGP4 Q_GetCpFromUtf8
+CALLI4
+pop
+ADDRLP4 2124
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1639
+JUMPV
+LABELV $1636
+ADDRLP4 4
+INDIRI4
+ADDRLP4 2124
+INDIRI4
+ADDI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 2124
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $1637
+ADDRLP4 2124
+ADDRLP4 2124
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1639
+ADDRLP4 2124
+INDIRI4
+ADDRLP4 2128
+INDIRI4
+LTI4 $1636
+ADDRLP4 2168
+ADDRLP4 2128
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 2168
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2168
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1614
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1613
+LABELV $1615
+LABELV $1604
+endproc Item_Text_AutoWrapped_Paint 2192 44
+proc Item_Text_Wrapped_Paint 2156 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1641
+ADDRLP4 1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+INDIRB
+ASGNB 16
+LABELV $1641
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1643
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1645
+ADDRGP4 $1640
+JUMPV
+LABELV $1645
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1084
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1076
+ADDRLP4 1084
+ASGNP4
+ADDRGP4 $1644
+JUMPV
+LABELV $1643
+ADDRLP4 1076
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1644
+ADDRLP4 1076
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1647
+ADDRGP4 $1640
+JUMPV
+LABELV $1647
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ARGP4
+ADDRGP4 Item_TextColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ARGP4
+ADDRLP4 1072
+ARGP4
+ADDRLP4 1076
+INDIRP4
+ARGP4
+ADDRGP4 Item_SetTextExtents
+CALLV
+pop
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1032
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 1076
+INDIRP4
+ASGNP4
+ADDRLP4 1076
+INDIRP4
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 2116
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2116
+INDIRP4
+ASGNP4
+ADDRGP4 $1650
+JUMPV
+LABELV $1649
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1036
+INDIRF4
+ARGF4
+ADDRLP4 1032
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2124
+ADDRLP4 1056
+INDIRB
+ASGNB 16
+ADDRLP4 2124
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRF4
+ADDRLP4 1072
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 2152
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2152
+INDIRP4
+ASGNP4
+LABELV $1650
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1652
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1649
+LABELV $1652
+ADDRLP4 1036
+INDIRF4
+ARGF4
+ADDRLP4 1032
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2124
+ADDRLP4 1056
+INDIRB
+ASGNB 16
+ADDRLP4 2124
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1640
+endproc Item_Text_Wrapped_Paint 2156 44
+proc Item_Text_Paint 1088 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1654
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+INDIRB
+ASGNB 16
+LABELV $1654
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+EQI4 $1656
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Wrapped_Paint
+CALLV
+pop
+ADDRGP4 $1653
+JUMPV
+LABELV $1656
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $1658
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_AutoWrapped_Paint
+CALLV
+pop
+ADDRGP4 $1653
+JUMPV
+LABELV $1658
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1660
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1662
+ADDRGP4 $1653
+JUMPV
+LABELV $1662
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 44
+ASGNP4
+ADDRGP4 $1661
+JUMPV
+LABELV $1660
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1661
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_SetTextExtents
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1664
+ADDRGP4 $1653
+JUMPV
+LABELV $1664
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Item_TextColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRLP4 20
+INDIRB
+ASGNB 16
+ADDRLP4 1068
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1653
+endproc Item_Text_Paint 1088 44
+proc Item_TextField_Paint 1136 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1667
+ADDRLP4 1068
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+INDIRB
+ASGNB 16
+LABELV $1667
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRLP4 8
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1669
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1669
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1671
+ADDRLP4 1084
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 1084
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1032+4
+ADDRLP4 1084
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1032+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1032+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 1092
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 1048
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 1092
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1672
+JUMPV
+LABELV $1671
+ADDRLP4 1048
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1672
+ADDRLP4 1088
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1677
+ADDRLP4 1088
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1677
+ADDRLP4 1084
+CNSTI4 8
+ASGNI4
+ADDRGP4 $1678
+JUMPV
+LABELV $1677
+ADDRLP4 1084
+CNSTI4 0
+ASGNI4
+LABELV $1678
+ADDRLP4 1064
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1092
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 1092
+INDIRI4
+EQI4 $1679
+ADDRGP4 g_editingField
+INDIRI4
+ADDRLP4 1092
+INDIRI4
+EQI4 $1679
+ADDRLP4 1104
+ADDRGP4 DC
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+EQI4 $1682
+ADDRLP4 1100
+CNSTI4 95
+ASGNI4
+ADDRGP4 $1683
+JUMPV
+LABELV $1682
+ADDRLP4 1100
+CNSTI4 124
+ASGNI4
+LABELV $1683
+ADDRLP4 1096
+ADDRLP4 1100
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1132
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+ADDRLP4 8
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 1132
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 1096
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1108
+ADDRLP4 1068
+INDIRB
+ASGNB 16
+ADDRLP4 1108
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1680
+JUMPV
+LABELV $1679
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 8
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1096
+ADDRLP4 1068
+INDIRB
+ASGNB 16
+ADDRLP4 1096
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1680
+LABELV $1666
+endproc Item_TextField_Paint 1136 48
+proc Item_YesNo_Paint 92 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1685
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+INDIRB
+ASGNB 16
+LABELV $1685
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1688
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRGP4 $1689
+JUMPV
+LABELV $1688
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+LABELV $1689
+ADDRLP4 36
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1690
+ADDRLP4 64
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 72
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1691
+JUMPV
+LABELV $1690
+ADDRLP4 20
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1691
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1695
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+EQF4 $1700
+ADDRLP4 64
+ADDRGP4 $1697
+ASGNP4
+ADDRGP4 $1701
+JUMPV
+LABELV $1700
+ADDRLP4 64
+ADDRGP4 $1698
+ASGNP4
+LABELV $1701
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRLP4 40
+INDIRB
+ASGNB 16
+ADDRLP4 68
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1696
+JUMPV
+LABELV $1695
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+EQF4 $1703
+ADDRLP4 64
+ADDRGP4 $1697
+ASGNP4
+ADDRGP4 $1704
+JUMPV
+LABELV $1703
+ADDRLP4 64
+ADDRGP4 $1698
+ASGNP4
+LABELV $1704
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRLP4 40
+INDIRB
+ASGNB 16
+ADDRLP4 68
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1696
+LABELV $1684
+endproc Item_YesNo_Paint 92 44
+proc Item_Multi_Paint 80 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $56
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1706
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+INDIRB
+ASGNB 16
+LABELV $1706
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1708
+ADDRLP4 56
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 8
+ADDRLP4 56
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 64
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 64
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1709
+JUMPV
+LABELV $1708
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1709
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 Item_Multi_Setting
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1713
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRLP4 40
+INDIRB
+ASGNB 16
+ADDRLP4 60
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1714
+JUMPV
+LABELV $1713
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRLP4 40
+INDIRB
+ASGNB 16
+ADDRLP4 60
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1714
+LABELV $1705
+endproc Item_Multi_Paint 80 44
+data
+align 4
+LABELV g_bindings
+address $1717
+byte 4 9
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1718
+byte 4 13
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1719
+byte 4 138
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1720
+byte 4 132
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1721
+byte 4 133
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1722
+byte 4 44
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1723
+byte 4 46
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1724
+byte 4 32
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1725
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1726
+byte 4 134
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1727
+byte 4 135
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1728
+byte 4 136
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1729
+byte 4 141
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1730
+byte 4 140
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1731
+byte 4 47
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1732
+byte 4 144
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1733
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1734
+byte 4 49
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1735
+byte 4 50
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1736
+byte 4 51
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1737
+byte 4 52
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1738
+byte 4 53
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1739
+byte 4 54
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1740
+byte 4 55
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1741
+byte 4 56
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1742
+byte 4 57
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1743
+byte 4 48
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1744
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1745
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1746
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1747
+byte 4 137
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1748
+byte 4 91
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1749
+byte 4 93
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1750
+byte 4 180
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1751
+byte 4 181
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1752
+byte 4 119
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1753
+byte 4 114
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1754
+byte 4 116
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1755
+byte 4 121
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1756
+byte 4 110
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1757
+byte 4 111
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1758
+byte 4 100
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1759
+byte 4 112
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1760
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1761
+byte 4 102
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1762
+byte 4 118
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1763
+byte 4 101
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1764
+byte 4 105
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1765
+byte 4 107
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1766
+byte 4 145
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1767
+byte 4 146
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1768
+byte 4 147
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1769
+byte 4 148
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1770
+byte 4 149
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1771
+byte 4 162
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1772
+byte 4 168
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1773
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1774
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1775
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1776
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+lit
+align 4
+LABELV g_bindCount
+byte 4 60
+code
+proc Controls_GetKeyAssignment 280 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+LABELV $1778
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1782
+ADDRGP4 $1779
+JUMPV
+LABELV $1782
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $1784
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+NEI4 $1786
+ADDRGP4 $1780
+JUMPV
+LABELV $1786
+LABELV $1784
+LABELV $1779
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $1778
+LABELV $1780
+LABELV $1777
+endproc Controls_GetKeyAssignment 280 12
+export Controls_GetConfig
+proc Controls_GetConfig 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1792
+JUMPV
+LABELV $1789
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Controls_GetKeyAssignment
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $1790
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1792
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1789
+LABELV $1788
+endproc Controls_GetConfig 12 8
+export Controls_SetConfig
+proc Controls_SetConfig 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1800
+JUMPV
+LABELV $1797
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1801
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1805
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1805
+LABELV $1801
+LABELV $1798
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1800
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1797
+CNSTI4 2
+ARGI4
+ADDRGP4 $1809
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1796
+endproc Controls_SetConfig 12 8
+export Controls_SetDefaults
+proc Controls_SetDefaults 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1814
+JUMPV
+LABELV $1811
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1812
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1814
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1811
+LABELV $1810
+endproc Controls_SetDefaults 12 0
+proc BindingIDFromName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1820
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1824
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1819
+JUMPV
+LABELV $1824
+LABELV $1821
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1823
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1820
+CNSTI4 -1
+RETI4
+LABELV $1819
+endproc BindingIDFromName 8 8
+proc BindingFromName 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1830
+JUMPV
+LABELV $1827
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1831
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $1834
+ADDRGP4 $1829
+JUMPV
+LABELV $1834
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 g_nameBind1
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $1826
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 g_nameBind2
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 g_nameBind2
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 $1839
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 g_nameBind2
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRGP4 $1826
+JUMPV
+LABELV $1831
+LABELV $1828
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1830
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1827
+LABELV $1829
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 $1840
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $1826
+endproc BindingFromName 16 12
+proc Item_Slider_Paint 112 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1842
+ADDRGP4 $1844
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1841
+JUMPV
+LABELV $1842
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1845
+ADDRGP4 $1847
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1841
+JUMPV
+LABELV $1845
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1848
+ADDRLP4 64
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 28
+ADDRLP4 64
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 1061997773
+ADDRLP4 4
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28+12
+CNSTF4 1061997773
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 72
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1849
+JUMPV
+LABELV $1848
+ADDRLP4 44
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1849
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1853
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $1854
+JUMPV
+LABELV $1853
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $1854
+ADDRLP4 44
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+CNSTF4 1119879168
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 84
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+CNSTI4 5633976
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRLP4 12
+INDIRB
+ASGNB 16
+ADDRLP4 68
+ARGP4
+ADDRLP4 84
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 Item_Slider_ThumbPosition
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ARGF4
+CNSTF4 1094713344
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 108
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+CNSTI4 5633980
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRLP4 12
+INDIRB
+ASGNB 16
+ADDRLP4 92
+ARGP4
+ADDRLP4 108
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1841
+endproc Item_Slider_Paint 112 28
+proc Item_Bind_Paint 80 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1856
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+INDIRB
+ASGNB 16
+LABELV $1856
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1858
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1858
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1860
+ADDRGP4 g_bindItem
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $1862
+ADDRLP4 0
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1061997773
+ASGNF4
+ADDRGP4 $1863
+JUMPV
+LABELV $1862
+ADDRLP4 60
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 64
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 60
+INDIRF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1061997773
+ADDRLP4 20
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1061997773
+ADDRLP4 20
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1863
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 60
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 60
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1861
+JUMPV
+LABELV $1860
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1861
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1870
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BindingFromName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 g_nameBind1
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRLP4 44
+INDIRB
+ASGNB 16
+ADDRLP4 60
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1871
+JUMPV
+LABELV $1870
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 $1872
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRLP4 44
+INDIRB
+ASGNB 16
+ADDRLP4 60
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1871
+LABELV $1855
+endproc Item_Bind_Paint 80 44
+export Display_KeyBindPending
+proc Display_KeyBindPending 0 0
+ADDRGP4 g_waitingForKey
+INDIRI4
+RETI4
+LABELV $1873
+endproc Display_KeyBindPending 0 0
+proc Item_Bind_HandleKey 24 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_waitingForKey
+INDIRI4
+CNSTI4 0
+NEI4 $1875
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1877
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+NEI4 $1880
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1885
+LABELV $1880
+ADDRFP4 4
+INDIRI4
+CNSTI4 13
+EQI4 $1885
+ADDRFP4 4
+INDIRI4
+CNSTI4 169
+EQI4 $1885
+ADDRFP4 4
+INDIRI4
+CNSTI4 185
+EQI4 $1885
+ADDRFP4 4
+INDIRI4
+CNSTI4 186
+EQI4 $1885
+ADDRFP4 4
+INDIRI4
+CNSTI4 187
+EQI4 $1885
+ADDRFP4 4
+INDIRI4
+CNSTI4 188
+NEI4 $1877
+LABELV $1885
+ADDRGP4 g_waitingForKey
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_bindItem
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1877
+CNSTI4 1
+RETI4
+ADDRGP4 $1874
+JUMPV
+LABELV $1875
+ADDRGP4 g_bindItem
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1886
+CNSTI4 1
+RETI4
+ADDRGP4 $1874
+JUMPV
+LABELV $1886
+ADDRFP4 4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1888
+CNSTI4 1
+RETI4
+ADDRGP4 $1874
+JUMPV
+LABELV $1888
+ADDRLP4 12
+CNSTI4 96
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1898
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $1900
+LABELV $1899
+ADDRFP4 4
+INDIRI4
+CNSTI4 27
+EQI4 $1892
+ADDRGP4 $1890
+JUMPV
+LABELV $1900
+ADDRFP4 4
+INDIRI4
+CNSTI4 127
+EQI4 $1893
+ADDRGP4 $1890
+JUMPV
+LABELV $1892
+ADDRGP4 g_waitingForKey
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1874
+JUMPV
+LABELV $1893
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BindingIDFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $1894
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+CNSTI4 -1
+ASGNI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1894
+CNSTI4 1
+ARGI4
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 g_waitingForKey
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_bindItem
+CNSTP4 0
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $1874
+JUMPV
+LABELV $1898
+CNSTI4 1
+RETI4
+ADDRGP4 $1874
+JUMPV
+LABELV $1890
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $1901
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1906
+JUMPV
+LABELV $1903
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1907
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1907
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1911
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+12
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1911
+LABELV $1904
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1906
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1903
+LABELV $1901
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BindingIDFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $1917
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $1919
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1921
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $56
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1921
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1920
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $56
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1920
+JUMPV
+LABELV $1919
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1931
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1932
+JUMPV
+LABELV $1931
+ADDRLP4 12
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $1935
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1935
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1936
+JUMPV
+LABELV $1935
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $56
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $56
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1936
+LABELV $1932
+LABELV $1920
+LABELV $1917
+CNSTI4 1
+ARGI4
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 g_waitingForKey
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $1874
+endproc Item_Bind_HandleKey 24 16
+proc AdjustFrom640 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1944
+endproc AdjustFrom640 16 0
+proc Item_Model_Paint 632 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 540
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 540
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1946
+ADDRGP4 $1945
+JUMPV
+LABELV $1946
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 612
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 600
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 612
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 604
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 612
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 616
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 556
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 616
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 560
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 616
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 600
+ARGP4
+ADDRLP4 604
+ARGP4
+ADDRLP4 556
+ARGP4
+ADDRLP4 560
+ARGP4
+ADDRGP4 AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 600
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 604
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 556
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRLP4 560
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 576
+ARGP4
+ADDRLP4 588
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 544+8
+CNSTF4 3204448256
+ADDRLP4 576+8
+INDIRF4
+ADDRLP4 588+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 544+4
+CNSTF4 1056964608
+ADDRLP4 576+4
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 620
+CNSTF4 1056964608
+ADDRLP4 588+8
+INDIRF4
+ADDRLP4 576+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 544
+ADDRLP4 620
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRGP4 $1960
+JUMPV
+LABELV $1959
+ADDRLP4 544
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1960
+ADDRLP4 540
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1965
+ADDRLP4 620
+ADDRLP4 540
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1966
+JUMPV
+LABELV $1965
+ADDRLP4 620
+ADDRLP4 556
+INDIRF4
+ASGNF4
+LABELV $1966
+ADDRLP4 0+16
+ADDRLP4 620
+INDIRF4
+ASGNF4
+ADDRLP4 540
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1969
+ADDRLP4 624
+ADDRLP4 540
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1970
+JUMPV
+LABELV $1969
+ADDRLP4 624
+ADDRLP4 560
+INDIRF4
+ASGNF4
+LABELV $1970
+ADDRLP4 0+20
+ADDRLP4 624
+INDIRF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0+72
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 368
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 540
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1972
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+LEI4 $1974
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 540
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 540
+INDIRP4
+ADDRLP4 540
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 360
+MODI4
+ASGNI4
+LABELV $1974
+LABELV $1972
+ADDRLP4 564
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+4
+ADDRLP4 540
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 564+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 564
+ARGP4
+ADDRLP4 368+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 368+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 368+68
+ADDRLP4 544
+INDIRB
+ASGNB 12
+ADDRLP4 368+12
+ADDRLP4 544
+INDIRB
+ASGNB 12
+ADDRLP4 368+4
+CNSTI4 192
+ASGNI4
+ADDRLP4 368+84
+ADDRLP4 368+68
+INDIRB
+ASGNB 12
+ADDRLP4 368
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1945
+endproc Item_Model_Paint 632 16
+export Item_ListBox_Paint
+proc Item_ListBox_Paint 228 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1986
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+INDIRB
+ASGNB 16
+LABELV $1986
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 DC
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1084227584
+EQF4 $1990
+ADDRLP4 60
+INDIRF4
+CNSTF4 1086324736
+NEF4 $1988
+LABELV $1990
+ADDRGP4 $1991
+ARGP4
+ADDRLP4 72
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 $1992
+ARGP4
+ADDRLP4 76
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+GEI4 $1993
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+LABELV $1993
+ADDRLP4 64
+INDIRF4
+CNSTF4 981668463
+LEF4 $1995
+ADDRLP4 12
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRGP4 $1989
+JUMPV
+LABELV $1995
+ADDRLP4 64
+INDIRF4
+CNSTF4 0
+GEF4 $1989
+ADDRLP4 48
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $1989
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $1989
+JUMPV
+LABELV $1988
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+CNSTF4 1093664768
+NEF4 $2001
+ADDRGP4 $2003
+ARGP4
+ADDRLP4 72
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 $2004
+ARGP4
+ADDRLP4 76
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+GEI4 $2005
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+LABELV $2005
+ADDRLP4 64
+INDIRF4
+CNSTF4 981668463
+LEF4 $2007
+ADDRLP4 12
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRGP4 $2008
+JUMPV
+LABELV $2007
+ADDRLP4 64
+INDIRF4
+CNSTF4 0
+GEF4 $2009
+ADDRLP4 48
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $2010
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+LABELV $2009
+LABELV $2010
+LABELV $2008
+LABELV $2001
+LABELV $1989
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2013
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 84
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CNSTI4 5633948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 64
+ARGP4
+ADDRLP4 88
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+ADDRLP4 112
+CNSTI4 8
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 116
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 5633956
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 92
+ARGP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 136
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 5633952
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 120
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 Item_ListBox_ThumbDrawPosition
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 144
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $2015
+ADDRLP4 52
+ADDRLP4 20
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $2015
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 164
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 164
+INDIRF4
+ARGF4
+ADDRLP4 164
+INDIRF4
+ARGF4
+ADDRLP4 168
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+CNSTI4 5633960
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 148
+ARGP4
+ADDRLP4 168
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2014
+ADDRLP4 180
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2022
+JUMPV
+LABELV $2019
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2023
+ADDRLP4 204
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 204
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 204
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 208
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 208
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 208
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 188
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2023
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+NEI4 $2025
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 204
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 188
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2025
+ADDRLP4 188
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 188
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 188
+INDIRP4
+INDIRF4
+GEF4 $2027
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2014
+JUMPV
+LABELV $2027
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2020
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2022
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $2019
+ADDRGP4 $2014
+JUMPV
+LABELV $2013
+ADDRLP4 84
+CNSTI4 8
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+CNSTI4 5633940
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 64
+ARGP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRLP4 120
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+CNSTI4 5633956
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 100
+ARGP4
+ADDRLP4 120
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 5633944
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 124
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 Item_ListBox_ThumbDrawPosition
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 148
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $2029
+ADDRLP4 52
+ADDRLP4 16
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $2029
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 168
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 172
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+CNSTI4 5633960
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 152
+ARGP4
+ADDRLP4 172
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2031
+ADDRLP4 180
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2036
+JUMPV
+LABELV $2033
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2037
+ADDRLP4 204
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 204
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 204
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 208
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 208
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 208
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 188
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2037
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+NEI4 $2039
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 204
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 188
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2039
+ADDRLP4 188
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $2041
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2032
+JUMPV
+LABELV $2041
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2034
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2036
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $2033
+ADDRGP4 $2032
+JUMPV
+LABELV $2031
+ADDRLP4 180
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2046
+JUMPV
+LABELV $2043
+ADDRGP4 LastListSelected
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+NEU4 $2047
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+NEI4 $2047
+ADDRLP4 208
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDF4
+CNSTF4 1082130432
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 192
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2048
+JUMPV
+LABELV $2047
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 1
+NEI4 $2049
+ADDRLP4 208
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDF4
+CNSTF4 1082130432
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 192
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2049
+LABELV $2048
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2051
+ADDRLP4 192
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2056
+JUMPV
+LABELV $2053
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 192
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 196
+ADDRGP4 DC
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRP4
+CALLP4
+ASGNP4
+ADDRLP4 184
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $2057
+ADDRLP4 216
+CNSTI4 12
+ADDRLP4 192
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ADDRLP4 216
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 220
+ADDRLP4 216
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 220
+INDIRF4
+ARGF4
+ADDRLP4 220
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 200
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2058
+JUMPV
+LABELV $2057
+ADDRLP4 184
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2059
+ADDRLP4 220
+CNSTI4 12
+ADDRLP4 192
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ADDRLP4 220
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 220
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 200
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2059
+LABELV $2058
+LABELV $2054
+ADDRLP4 192
+ADDRLP4 192
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2056
+ADDRLP4 192
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+LTI4 $2053
+ADDRGP4 $2052
+JUMPV
+LABELV $2051
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 192
+ADDRGP4 DC
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRP4
+CALLP4
+ASGNP4
+ADDRLP4 184
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $2061
+ADDRGP4 $2062
+JUMPV
+LABELV $2061
+ADDRLP4 184
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2063
+ADDRLP4 20
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 196
+ADDRLP4 28
+INDIRB
+ASGNB 16
+ADDRLP4 196
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2063
+LABELV $2062
+LABELV $2052
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $2065
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2045
+JUMPV
+LABELV $2065
+ADDRLP4 196
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2044
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2046
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $2043
+LABELV $2045
+LABELV $2032
+LABELV $2014
+LABELV $1985
+endproc Item_ListBox_Paint 228 44
+proc Item_OwnerDraw_Paint 96 76
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2068
+ADDRGP4 $2067
+JUMPV
+LABELV $2068
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2070
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2072
+ADDRGP4 $2074
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2073
+JUMPV
+LABELV $2072
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 4364
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+INDIRB
+ASGNB 16
+LABELV $2073
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2075
+ADDRGP4 DC
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2075
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 DC
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2080
+JUMPV
+LABELV $2077
+ADDRLP4 80
+CNSTI4 24
+ADDRLP4 64
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+LTF4 $2081
+ADDRLP4 68
+INDIRF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+GTF4 $2081
+ADDRLP4 8
+ARGP4
+CNSTI4 24
+ADDRLP4 64
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $2079
+JUMPV
+LABELV $2081
+LABELV $2078
+ADDRLP4 64
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2080
+ADDRLP4 64
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+LTI4 $2077
+LABELV $2079
+LABELV $2075
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2083
+ADDRLP4 64
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 24
+ADDRLP4 64
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1061997773
+ADDRLP4 4
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1061997773
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 72
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $2084
+JUMPV
+LABELV $2083
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $2088
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 200
+DIVI4
+ADDRLP4 64
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $2088
+ADDRLP4 68
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 24
+ADDRLP4 68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 76
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+LABELV $2088
+LABELV $2084
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $2093
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 72
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $2093
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 252
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $2093
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2095
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2097
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRLP4 40
+INDIRB
+ASGNB 16
+ADDRLP4 76
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2096
+JUMPV
+LABELV $2097
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRLP4 40
+INDIRB
+ASGNB 16
+ADDRLP4 76
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2096
+JUMPV
+LABELV $2095
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRLP4 40
+INDIRB
+ASGNB 16
+ADDRLP4 76
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2096
+LABELV $2070
+LABELV $2067
+endproc Item_OwnerDraw_Paint 96 76
+proc Item_Paint 132 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2103
+ADDRGP4 $2099
+JUMPV
+LABELV $2103
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2105
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+INDIRB
+ASGNB 16
+LABELV $2105
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2107
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunFrameScript
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $2107
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $2109
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+LEI4 $2111
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 84
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1029076816
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $2111
+LABELV $2109
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $2113
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+LEI4 $2115
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEF4 $2117
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2118
+JUMPV
+LABELV $2117
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+GEF4 $2119
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+LEF4 $2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2120
+JUMPV
+LABELV $2119
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+GEF4 $2123
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2123
+LABELV $2120
+LABELV $2118
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+NEF4 $2125
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2126
+JUMPV
+LABELV $2125
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+GEF4 $2127
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+LEF4 $2128
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2128
+JUMPV
+LABELV $2127
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+GEF4 $2131
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2131
+LABELV $2128
+LABELV $2126
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+NEF4 $2133
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2134
+JUMPV
+LABELV $2133
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+GEF4 $2135
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+LEF4 $2136
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2136
+JUMPV
+LABELV $2135
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+GEF4 $2139
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2139
+LABELV $2136
+LABELV $2134
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+NEF4 $2141
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2142
+JUMPV
+LABELV $2141
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+GEF4 $2143
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+LEF4 $2144
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2144
+JUMPV
+LABELV $2143
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+GEF4 $2147
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2147
+LABELV $2144
+LABELV $2142
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+ADDRLP4 48
+INDIRI4
+CNSTI4 4
+NEI4 $2149
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+LABELV $2149
+LABELV $2115
+LABELV $2113
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+NEI4 $2153
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $2151
+LABELV $2153
+ADDRGP4 DC
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2151
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 DC
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $2154
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $2155
+JUMPV
+LABELV $2154
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $2155
+LABELV $2151
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $2156
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 56
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $2158
+ADDRGP4 $2099
+JUMPV
+LABELV $2158
+LABELV $2156
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 8388608
+BANDI4
+CNSTI4 0
+EQI4 $2160
+LABELV $2160
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $2162
+ADDRGP4 $2099
+JUMPV
+LABELV $2162
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRLP4 20
+INDIRB
+ASGNB 16
+ADDRLP4 56
+ARGP4
+ADDRGP4 Window_Paint
+CALLV
+pop
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $2164
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 104
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 84+12
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 0
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 84
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRLP4 20
+INDIRB
+ASGNB 16
+ADDRLP4 112
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2164
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+LTI4 $2170
+ADDRLP4 80
+INDIRI4
+CNSTI4 14
+GTI4 $2170
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2186
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2186
+address $2173
+address $2173
+address $2170
+address $2170
+address $2176
+address $2170
+address $2178
+address $2179
+address $2172
+address $2176
+address $2185
+address $2180
+address $2181
+address $2182
+address $2183
+code
+LABELV $2172
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_OwnerDraw_Paint
+CALLV
+pop
+ADDRGP4 $2170
+JUMPV
+LABELV $2173
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRGP4 $2170
+JUMPV
+LABELV $2176
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_TextField_Paint
+CALLV
+pop
+ADDRGP4 $2170
+JUMPV
+LABELV $2178
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ListBox_Paint
+CALLV
+pop
+ADDRGP4 $2170
+JUMPV
+LABELV $2179
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Model_Paint
+CALLV
+pop
+ADDRGP4 $2170
+JUMPV
+LABELV $2180
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_YesNo_Paint
+CALLV
+pop
+ADDRGP4 $2170
+JUMPV
+LABELV $2181
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Multi_Paint
+CALLV
+pop
+ADDRGP4 $2170
+JUMPV
+LABELV $2182
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Bind_Paint
+CALLV
+pop
+ADDRGP4 $2170
+JUMPV
+LABELV $2183
+ADDRGP4 $2184
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2185
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Slider_Paint
+CALLV
+pop
+LABELV $2170
+LABELV $2099
+endproc Item_Paint 132 32
+export Menu_Init
+proc Menu_Init 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5634008
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5634000
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5634004
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4364
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_Init
+CALLV
+pop
+LABELV $2187
+endproc Menu_Init 0 12
+export Menu_GetFocused
+proc Menu_GetFocused 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2192
+JUMPV
+LABELV $2189
+ADDRLP4 4
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+72
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2193
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+72
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2193
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+RETP4
+ADDRGP4 $2188
+JUMPV
+LABELV $2193
+LABELV $2190
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2192
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $2189
+CNSTP4 0
+RETP4
+LABELV $2188
+endproc Menu_GetFocused 12 0
+export Menu_ScrollFeeder
+proc Menu_ScrollFeeder 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2198
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2203
+JUMPV
+LABELV $2200
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+NEF4 $2204
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2207
+ADDRLP4 4
+CNSTI4 133
+ASGNI4
+ADDRGP4 $2208
+JUMPV
+LABELV $2207
+ADDRLP4 4
+CNSTI4 132
+ASGNI4
+LABELV $2208
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+pop
+ADDRGP4 $2197
+JUMPV
+LABELV $2204
+LABELV $2201
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2203
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $2200
+LABELV $2198
+LABELV $2197
+endproc Menu_ScrollFeeder 12 16
+export Menu_SetFeederSelection
+proc Menu_SetFeederSelection 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2210
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2212
+ADDRLP4 0
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $2213
+JUMPV
+LABELV $2212
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $2213
+LABELV $2210
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2214
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2219
+JUMPV
+LABELV $2216
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+NEF4 $2220
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2222
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $2222
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 564
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2209
+JUMPV
+LABELV $2220
+LABELV $2217
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2219
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $2216
+LABELV $2214
+LABELV $2209
+endproc Menu_SetFeederSelection 8 8
+export Menus_AnyFullScreenVisible
+proc Menus_AnyFullScreenVisible 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2228
+JUMPV
+LABELV $2225
+ADDRLP4 4
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+72
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2229
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+192
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2229
+CNSTI4 1
+RETI4
+ADDRGP4 $2224
+JUMPV
+LABELV $2229
+LABELV $2226
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2228
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $2225
+CNSTI4 0
+RETI4
+LABELV $2224
+endproc Menus_AnyFullScreenVisible 12 0
+export Menus_ActivateByName
+proc Menus_ActivateByName 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2237
+JUMPV
+LABELV $2234
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2238
+ADDRLP4 4
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menus_Activate
+CALLV
+pop
+ADDRGP4 openMenuCount
+INDIRI4
+CNSTI4 256
+GEI4 $2241
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2241
+ADDRLP4 24
+ADDRGP4 openMenuCount
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 menuStack
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $2239
+JUMPV
+LABELV $2241
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2243
+ADDRGP4 $2245
+ARGP4
+ADDRGP4 $2246
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2239
+JUMPV
+LABELV $2243
+ADDRGP4 $2247
+ARGP4
+ADDRGP4 $2248
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2239
+JUMPV
+LABELV $2238
+ADDRLP4 20
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+72
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $2239
+LABELV $2235
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2237
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $2234
+ADDRGP4 Display_CloseCinematics
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $2233
+endproc Menus_ActivateByName 28 12
+export Item_Init
+proc Item_Init 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2251
+ADDRGP4 $2253
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2250
+JUMPV
+LABELV $2251
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 580
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+CNSTF4 1046562734
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_Init
+CALLV
+pop
+LABELV $2250
+endproc Item_Init 0 12
+export Menu_HandleMouseMove
+proc Menu_HandleMouseMove 56 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2255
+ADDRGP4 $2254
+JUMPV
+LABELV $2255
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+NEI4 $2257
+ADDRGP4 $2254
+JUMPV
+LABELV $2257
+ADDRGP4 itemCapture
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2259
+ADDRGP4 $2254
+JUMPV
+LABELV $2259
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_waitingForKey
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2263
+ADDRGP4 g_editingField
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2261
+LABELV $2263
+ADDRGP4 $2254
+JUMPV
+LABELV $2261
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2264
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2271
+JUMPV
+LABELV $2268
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+NEI4 $2272
+ADDRGP4 $2269
+JUMPV
+LABELV $2272
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $2274
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2274
+ADDRGP4 $2269
+JUMPV
+LABELV $2274
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $2276
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $2276
+ADDRGP4 $2269
+JUMPV
+LABELV $2276
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $2278
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $2279
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2282
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2282
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $2284
+ADDRGP4 $2269
+JUMPV
+LABELV $2284
+LABELV $2282
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 IsVisible
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $2279
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_MouseEnter
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2279
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Item_SetFocus
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $2279
+JUMPV
+LABELV $2278
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2290
+ADDRLP4 44
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2290
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_MouseLeave
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Item_SetMouseOver
+CALLV
+pop
+LABELV $2290
+LABELV $2279
+LABELV $2269
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2271
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $2268
+LABELV $2265
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LTI4 $2264
+LABELV $2254
+endproc Menu_HandleMouseMove 56 16
+export Menu_Paint
+proc Menu_Paint 88 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2293
+ADDRGP4 $2292
+JUMPV
+LABELV $2293
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2295
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2295
+ADDRGP4 $2292
+JUMPV
+LABELV $2295
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $2299
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $2297
+LABELV $2299
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2297
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRLP4 16
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2297
+ADDRGP4 $2292
+JUMPV
+LABELV $2297
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2300
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1048576
+BORI4
+ASGNI4
+LABELV $2300
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2302
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4364
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 28
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2303
+JUMPV
+LABELV $2302
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2304
+LABELV $2304
+LABELV $2303
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4364
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 28
+ARGP4
+ADDRGP4 Window_Paint
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2309
+JUMPV
+LABELV $2306
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Paint
+CALLV
+pop
+LABELV $2307
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2309
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $2306
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $2310
+ADDRLP4 64
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48+12
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 48+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 48+4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 48
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4364
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 68
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2310
+LABELV $2292
+endproc Menu_Paint 88 32
+proc Item_ValidateTypeData 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2316
+ADDRGP4 $2315
+JUMPV
+LABELV $2316
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2318
+CNSTI4 476
+ARGI4
+ADDRLP4 0
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 476
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $2319
+JUMPV
+LABELV $2318
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+EQI4 $2327
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+EQI4 $2327
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+EQI4 $2327
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $2327
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $2327
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+EQI4 $2327
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2320
+LABELV $2327
+CNSTI4 28
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 28
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2321
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2321
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 256
+ASGNI4
+ADDRGP4 $2321
+JUMPV
+LABELV $2320
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $2332
+CNSTI4 392
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $2333
+JUMPV
+LABELV $2332
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $2334
+CNSTI4 28
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $2334
+LABELV $2333
+LABELV $2321
+LABELV $2319
+LABELV $2315
+endproc Item_ValidateTypeData 8 12
+export KeywordHash_Key
+proc KeywordHash_Key 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2340
+JUMPV
+LABELV $2337
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 65
+LTI4 $2341
+ADDRLP4 12
+INDIRI4
+CNSTI4 90
+GTI4 $2341
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 119
+ADDI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $2342
+JUMPV
+LABELV $2341
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRI4
+CNSTI4 119
+ADDI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $2342
+LABELV $2338
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2340
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2337
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+RSHI4
+BXORI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+RSHI4
+BXORI4
+CNSTI4 511
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $2336
+endproc KeywordHash_Key 24 0
+proc KeywordHash_Add 8 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 KeywordHash_Key
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $2343
+endproc KeywordHash_Add 8 4
+proc KeywordHash_Find 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 KeywordHash_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2348
+JUMPV
+LABELV $2345
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2349
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $2344
+JUMPV
+LABELV $2349
+LABELV $2346
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2348
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2345
+CNSTP4 0
+RETP4
+LABELV $2344
+endproc KeywordHash_Find 16 8
+proc ItemParse_name 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2352
+CNSTI4 0
+RETI4
+ADDRGP4 $2351
+JUMPV
+LABELV $2352
+CNSTI4 1
+RETI4
+LABELV $2351
+endproc ItemParse_name 4 8
+proc ItemParse_focusSound 20 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2355
+CNSTI4 0
+RETI4
+ADDRGP4 $2354
+JUMPV
+LABELV $2355
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2357
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $2357
+CNSTI4 1
+RETI4
+LABELV $2354
+endproc ItemParse_focusSound 20 8
+proc ItemParse_text 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2360
+CNSTI4 0
+RETI4
+ADDRGP4 $2359
+JUMPV
+LABELV $2360
+CNSTI4 1
+RETI4
+LABELV $2359
+endproc ItemParse_text 4 8
+proc ItemParse_textExt 4164 12
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 4124
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4124
+INDIRI4
+CNSTI4 0
+NEI4 $2363
+CNSTI4 0
+RETI4
+ADDRGP4 $2362
+JUMPV
+LABELV $2363
+ADDRLP4 2072
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 2072
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2366
+JUMPV
+LABELV $2365
+ADDRLP4 12
+INDIRI4
+CNSTI4 1023
+LTI4 $2368
+ADDRGP4 $2370
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2362
+JUMPV
+LABELV $2368
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 37
+NEI4 $2371
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2373
+ADDRGP4 $2375
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2362
+JUMPV
+LABELV $2373
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 37
+NEI4 $2376
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $2377
+JUMPV
+LABELV $2376
+ADDRLP4 20
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRLP4 20
+ASGNP4
+ADDRLP4 4144
+CNSTI4 0
+ASGNI4
+ADDRLP4 4128
+ADDRLP4 4144
+INDIRI4
+ASGNI4
+ADDRLP4 4140
+ADDRLP4 4144
+INDIRI4
+ASGNI4
+ADDRLP4 4136
+ADDRLP4 4144
+INDIRI4
+ASGNI4
+ADDRGP4 $2379
+JUMPV
+LABELV $2378
+ADDRLP4 4128
+INDIRI4
+CNSTI4 1023
+LTI4 $2381
+ADDRGP4 $2383
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2362
+JUMPV
+LABELV $2381
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2384
+ADDRGP4 $2386
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2362
+JUMPV
+LABELV $2384
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $2387
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $2380
+JUMPV
+LABELV $2387
+ADDRLP4 4148
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4148
+INDIRI4
+CNSTI4 32
+EQI4 $2389
+ADDRLP4 4148
+INDIRI4
+CNSTI4 48
+LTI4 $2391
+ADDRLP4 4148
+INDIRI4
+CNSTI4 57
+LEI4 $2389
+LABELV $2391
+ADDRLP4 4152
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4152
+INDIRI4
+CNSTI4 46
+EQI4 $2389
+ADDRLP4 4152
+INDIRI4
+CNSTI4 102
+EQI4 $2389
+ADDRLP4 4152
+INDIRI4
+CNSTI4 100
+EQI4 $2389
+ADDRLP4 4152
+INDIRI4
+CNSTI4 120
+EQI4 $2389
+ADDRLP4 4152
+INDIRI4
+CNSTI4 37
+EQI4 $2389
+ADDRLP4 4152
+INDIRI4
+CNSTI4 115
+EQI4 $2389
+ADDRGP4 $2392
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2362
+JUMPV
+LABELV $2389
+ADDRLP4 4156
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4156
+INDIRI4
+CNSTI4 100
+EQI4 $2395
+ADDRLP4 4156
+INDIRI4
+CNSTI4 120
+NEI4 $2393
+LABELV $2395
+ADDRLP4 4140
+CNSTI4 1
+ASGNI4
+LABELV $2393
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 115
+NEI4 $2396
+ADDRLP4 4136
+CNSTI4 1
+ASGNI4
+LABELV $2396
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4160
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4160
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4160
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4128
+ADDRLP4 4128
+INDIRI4
+ADDRLP4 4160
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2379
+ADDRGP4 $2378
+JUMPV
+LABELV $2380
+ADDRLP4 20
+ARGP4
+ADDRLP4 4148
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4148
+INDIRU4
+CNSTU4 2
+GEU4 $2398
+ADDRGP4 $2400
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2362
+JUMPV
+LABELV $2398
+ADDRLP4 1048
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+ADDRLP4 1048
+ASGNP4
+ADDRLP4 4132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2402
+JUMPV
+LABELV $2401
+ADDRLP4 4132
+INDIRI4
+CNSTI4 1023
+LTI4 $2404
+ADDRGP4 $2406
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2362
+JUMPV
+LABELV $2404
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2407
+ADDRGP4 $2409
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2362
+JUMPV
+LABELV $2407
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2410
+ADDRLP4 16
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $2403
+JUMPV
+LABELV $2410
+ADDRLP4 16
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4152
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRP4
+ADDRLP4 4152
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4152
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4132
+ADDRLP4 4132
+INDIRI4
+ADDRLP4 4152
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2402
+ADDRGP4 $2401
+JUMPV
+LABELV $2403
+ADDRLP4 4136
+INDIRI4
+CNSTI4 0
+EQI4 $2412
+ADDRLP4 3096
+CNSTI1 0
+ASGNI1
+ADDRLP4 1048
+ARGP4
+ADDRLP4 3096
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 3096
+ASGNP4
+ADDRGP4 $2417
+JUMPV
+LABELV $2412
+ADDRLP4 1048
+ARGP4
+ADDRLP4 4152
+ADDRGP4 MenuVar_Get
+CALLF4
+ASGNF4
+ADDRLP4 4120
+ADDRLP4 4152
+INDIRF4
+ASGNF4
+ADDRLP4 4140
+INDIRI4
+CNSTI4 0
+EQI4 $2414
+ADDRLP4 4120
+INDIRF4
+ARGF4
+ADDRLP4 4156
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 4156
+INDIRI4
+ARGI4
+ADDRLP4 4160
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4160
+INDIRP4
+ASGNP4
+ADDRGP4 $2417
+JUMPV
+LABELV $2414
+ADDRLP4 20
+ARGP4
+ADDRLP4 4120
+INDIRF4
+ARGF4
+ADDRLP4 4156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4156
+INDIRP4
+ASGNP4
+ADDRGP4 $2417
+JUMPV
+LABELV $2416
+ADDRLP4 12
+INDIRI4
+CNSTI4 1023
+LTI4 $2419
+ADDRGP4 $2421
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2362
+JUMPV
+LABELV $2419
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4152
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4152
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4152
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4152
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2417
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2416
+LABELV $2377
+LABELV $2371
+ADDRLP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4128
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4128
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4128
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4128
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2366
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2365
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 2072
+ARGP4
+ADDRLP4 4128
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 4128
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $2362
+endproc ItemParse_textExt 4164 12
+proc ItemParse_textReset 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $2422
+endproc ItemParse_textReset 0 0
+proc ItemParse_group 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2424
+CNSTI4 0
+RETI4
+ADDRGP4 $2423
+JUMPV
+LABELV $2424
+CNSTI4 1
+RETI4
+LABELV $2423
+endproc ItemParse_group 4 8
+proc ItemParse_asset_model 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2427
+CNSTI4 0
+RETI4
+ADDRGP4 $2426
+JUMPV
+LABELV $2427
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2429
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 360
+MODI4
+ASGNI4
+LABELV $2429
+CNSTI4 1
+RETI4
+LABELV $2426
+endproc ItemParse_asset_model 28 8
+proc ItemParse_asset_shader 20 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2432
+CNSTI4 0
+RETI4
+ADDRGP4 $2431
+JUMPV
+LABELV $2432
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2434
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $2434
+CNSTI4 1
+RETI4
+LABELV $2431
+endproc ItemParse_asset_shader 20 8
+proc ItemParse_model_origin 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2437
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2439
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2441
+CNSTI4 1
+RETI4
+ADDRGP4 $2436
+JUMPV
+LABELV $2441
+LABELV $2439
+LABELV $2437
+CNSTI4 0
+RETI4
+LABELV $2436
+endproc ItemParse_model_origin 16 8
+proc ItemParse_model_fovx 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2444
+CNSTI4 0
+RETI4
+ADDRGP4 $2443
+JUMPV
+LABELV $2444
+CNSTI4 1
+RETI4
+LABELV $2443
+endproc ItemParse_model_fovx 8 8
+proc ItemParse_model_fovy 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2447
+CNSTI4 0
+RETI4
+ADDRGP4 $2446
+JUMPV
+LABELV $2447
+CNSTI4 1
+RETI4
+LABELV $2446
+endproc ItemParse_model_fovy 8 8
+proc ItemParse_model_rotation 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2450
+CNSTI4 0
+RETI4
+ADDRGP4 $2449
+JUMPV
+LABELV $2450
+CNSTI4 1
+RETI4
+LABELV $2449
+endproc ItemParse_model_rotation 8 8
+proc ItemParse_model_angle 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2453
+CNSTI4 0
+RETI4
+ADDRGP4 $2452
+JUMPV
+LABELV $2453
+CNSTI4 1
+RETI4
+LABELV $2452
+endproc ItemParse_model_angle 8 8
+proc ItemParse_rect 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2456
+CNSTI4 0
+RETI4
+ADDRGP4 $2455
+JUMPV
+LABELV $2456
+CNSTI4 1
+RETI4
+LABELV $2455
+endproc ItemParse_rect 4 8
+proc ItemParse_style 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2459
+CNSTI4 0
+RETI4
+ADDRGP4 $2458
+JUMPV
+LABELV $2459
+CNSTI4 1
+RETI4
+LABELV $2458
+endproc ItemParse_style 4 8
+proc ItemParse_decoration 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2461
+endproc ItemParse_decoration 4 0
+proc ItemParse_notselectable 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2463
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2463
+ADDRLP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2463
+CNSTI4 1
+RETI4
+LABELV $2462
+endproc ItemParse_notselectable 4 4
+proc ItemParse_wrapped 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 262144
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2465
+endproc ItemParse_wrapped 4 0
+proc ItemParse_autowrapped 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 524288
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2466
+endproc ItemParse_autowrapped 4 0
+proc ItemParse_horizontalscroll 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2467
+endproc ItemParse_horizontalscroll 4 0
+proc ItemParse_type 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2469
+CNSTI4 0
+RETI4
+ADDRGP4 $2468
+JUMPV
+LABELV $2469
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $2468
+endproc ItemParse_type 4 8
+proc ItemParse_elementwidth 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2472
+CNSTI4 0
+RETI4
+ADDRGP4 $2471
+JUMPV
+LABELV $2472
+CNSTI4 1
+RETI4
+LABELV $2471
+endproc ItemParse_elementwidth 8 8
+proc ItemParse_elementheight 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2475
+CNSTI4 0
+RETI4
+ADDRGP4 $2474
+JUMPV
+LABELV $2475
+CNSTI4 1
+RETI4
+LABELV $2474
+endproc ItemParse_elementheight 8 8
+proc ItemParse_elementColor 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2478
+CNSTI4 0
+RETI4
+ADDRGP4 $2477
+JUMPV
+LABELV $2478
+CNSTI4 1
+RETI4
+LABELV $2477
+endproc ItemParse_elementColor 8 8
+proc ItemParse_selectedColor 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2481
+CNSTI4 0
+RETI4
+ADDRGP4 $2480
+JUMPV
+LABELV $2481
+CNSTI4 1
+RETI4
+LABELV $2480
+endproc ItemParse_selectedColor 8 8
+proc ItemParse_altRowColor 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2484
+CNSTI4 0
+RETI4
+ADDRGP4 $2483
+JUMPV
+LABELV $2484
+CNSTI4 1
+RETI4
+LABELV $2483
+endproc ItemParse_altRowColor 8 8
+proc ItemParse_feeder 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2487
+CNSTI4 0
+RETI4
+ADDRGP4 $2486
+JUMPV
+LABELV $2487
+CNSTI4 1
+RETI4
+LABELV $2486
+endproc ItemParse_feeder 4 8
+proc ItemParse_elementtype 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2490
+CNSTI4 0
+RETI4
+ADDRGP4 $2489
+JUMPV
+LABELV $2490
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2492
+CNSTI4 0
+RETI4
+ADDRGP4 $2489
+JUMPV
+LABELV $2492
+CNSTI4 1
+RETI4
+LABELV $2489
+endproc ItemParse_elementtype 8 8
+proc ItemParse_columns 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2495
+CNSTI4 0
+RETI4
+ADDRGP4 $2494
+JUMPV
+LABELV $2495
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2497
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LEI4 $2499
+ADDRGP4 $2501
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 32
+ASGNI4
+LABELV $2499
+ADDRLP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2505
+JUMPV
+LABELV $2502
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2506
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2506
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2506
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $2507
+JUMPV
+LABELV $2506
+CNSTI4 0
+RETI4
+ADDRGP4 $2494
+JUMPV
+LABELV $2507
+LABELV $2503
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2505
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $2502
+ADDRGP4 $2498
+JUMPV
+LABELV $2497
+CNSTI4 0
+RETI4
+ADDRGP4 $2494
+JUMPV
+LABELV $2498
+CNSTI4 1
+RETI4
+LABELV $2494
+endproc ItemParse_columns 40 12
+proc ItemParse_border 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2509
+CNSTI4 0
+RETI4
+ADDRGP4 $2508
+JUMPV
+LABELV $2509
+CNSTI4 1
+RETI4
+LABELV $2508
+endproc ItemParse_border 4 8
+proc ItemParse_bordersize 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2512
+CNSTI4 0
+RETI4
+ADDRGP4 $2511
+JUMPV
+LABELV $2512
+CNSTI4 1
+RETI4
+LABELV $2511
+endproc ItemParse_bordersize 4 8
+proc ItemParse_visible 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2515
+CNSTI4 0
+RETI4
+ADDRGP4 $2514
+JUMPV
+LABELV $2515
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2517
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $2518
+JUMPV
+LABELV $2517
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+LABELV $2518
+CNSTI4 1
+RETI4
+LABELV $2514
+endproc ItemParse_visible 12 8
+proc ItemParse_ownerdraw 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2520
+CNSTI4 0
+RETI4
+ADDRGP4 $2519
+JUMPV
+LABELV $2520
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 8
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2519
+endproc ItemParse_ownerdraw 4 8
+proc ItemParse_align 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2523
+CNSTI4 0
+RETI4
+ADDRGP4 $2522
+JUMPV
+LABELV $2523
+CNSTI4 1
+RETI4
+LABELV $2522
+endproc ItemParse_align 4 8
+proc ItemParse_textalign 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2526
+CNSTI4 0
+RETI4
+ADDRGP4 $2525
+JUMPV
+LABELV $2526
+CNSTI4 1
+RETI4
+LABELV $2525
+endproc ItemParse_textalign 4 8
+proc ItemParse_textalignx 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2529
+CNSTI4 0
+RETI4
+ADDRGP4 $2528
+JUMPV
+LABELV $2529
+CNSTI4 1
+RETI4
+LABELV $2528
+endproc ItemParse_textalignx 4 8
+proc ItemParse_textaligny 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2532
+CNSTI4 0
+RETI4
+ADDRGP4 $2531
+JUMPV
+LABELV $2532
+CNSTI4 1
+RETI4
+LABELV $2531
+endproc ItemParse_textaligny 4 8
+proc ItemParse_textscale 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2535
+CNSTI4 0
+RETI4
+ADDRGP4 $2534
+JUMPV
+LABELV $2535
+CNSTI4 1
+RETI4
+LABELV $2534
+endproc ItemParse_textscale 4 8
+proc ItemParse_textstyle 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2538
+CNSTI4 0
+RETI4
+ADDRGP4 $2537
+JUMPV
+LABELV $2538
+CNSTI4 1
+RETI4
+LABELV $2537
+endproc ItemParse_textstyle 4 8
+proc ItemParse_backcolor 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2541
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2545
+CNSTI4 0
+RETI4
+ADDRGP4 $2540
+JUMPV
+LABELV $2545
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2542
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2541
+CNSTI4 1
+RETI4
+LABELV $2540
+endproc ItemParse_backcolor 12 8
+proc ItemParse_forecolor 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2548
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2552
+CNSTI4 0
+RETI4
+ADDRGP4 $2547
+JUMPV
+LABELV $2552
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $2549
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2548
+CNSTI4 1
+RETI4
+LABELV $2547
+endproc ItemParse_forecolor 16 8
+proc ItemParse_bordercolor 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2555
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2559
+CNSTI4 0
+RETI4
+ADDRGP4 $2554
+JUMPV
+LABELV $2559
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2556
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2555
+CNSTI4 1
+RETI4
+LABELV $2554
+endproc ItemParse_bordercolor 12 8
+proc ItemParse_outlinecolor 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2562
+CNSTI4 0
+RETI4
+ADDRGP4 $2561
+JUMPV
+LABELV $2562
+CNSTI4 1
+RETI4
+LABELV $2561
+endproc ItemParse_outlinecolor 4 8
+proc ItemParse_background 20 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2565
+CNSTI4 0
+RETI4
+ADDRGP4 $2564
+JUMPV
+LABELV $2565
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2567
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $2567
+CNSTI4 1
+RETI4
+LABELV $2564
+endproc ItemParse_background 20 8
+proc ItemParse_backgroundReset 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $2569
+endproc ItemParse_backgroundReset 0 0
+proc ItemParse_cinematic 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2571
+CNSTI4 0
+RETI4
+ADDRGP4 $2570
+JUMPV
+LABELV $2571
+CNSTI4 1
+RETI4
+LABELV $2570
+endproc ItemParse_cinematic 4 8
+proc ItemParse_doubleClick 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2574
+CNSTI4 0
+RETI4
+ADDRGP4 $2573
+JUMPV
+LABELV $2574
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2576
+CNSTI4 0
+RETI4
+ADDRGP4 $2573
+JUMPV
+LABELV $2576
+CNSTI4 1
+RETI4
+LABELV $2573
+endproc ItemParse_doubleClick 8 8
+proc ItemParse_onFocus 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2579
+CNSTI4 0
+RETI4
+ADDRGP4 $2578
+JUMPV
+LABELV $2579
+CNSTI4 1
+RETI4
+LABELV $2578
+endproc ItemParse_onFocus 4 8
+proc ItemParse_leaveFocus 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2582
+CNSTI4 0
+RETI4
+ADDRGP4 $2581
+JUMPV
+LABELV $2582
+CNSTI4 1
+RETI4
+LABELV $2581
+endproc ItemParse_leaveFocus 4 8
+proc ItemParse_mouseEnter 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2585
+CNSTI4 0
+RETI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2585
+CNSTI4 1
+RETI4
+LABELV $2584
+endproc ItemParse_mouseEnter 4 8
+proc ItemParse_mouseExit 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2588
+CNSTI4 0
+RETI4
+ADDRGP4 $2587
+JUMPV
+LABELV $2588
+CNSTI4 1
+RETI4
+LABELV $2587
+endproc ItemParse_mouseExit 4 8
+proc ItemParse_mouseEnterText 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2591
+CNSTI4 0
+RETI4
+ADDRGP4 $2590
+JUMPV
+LABELV $2591
+CNSTI4 1
+RETI4
+LABELV $2590
+endproc ItemParse_mouseEnterText 4 8
+proc ItemParse_mouseExitText 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2594
+CNSTI4 0
+RETI4
+ADDRGP4 $2593
+JUMPV
+LABELV $2594
+CNSTI4 1
+RETI4
+LABELV $2593
+endproc ItemParse_mouseExitText 4 8
+proc ItemParse_action 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2597
+CNSTI4 0
+RETI4
+ADDRGP4 $2596
+JUMPV
+LABELV $2597
+CNSTI4 1
+RETI4
+LABELV $2596
+endproc ItemParse_action 4 8
+proc ItemParse_special 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2600
+CNSTI4 0
+RETI4
+ADDRGP4 $2599
+JUMPV
+LABELV $2600
+CNSTI4 1
+RETI4
+LABELV $2599
+endproc ItemParse_special 4 8
+proc ItemParse_cvarTest 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2603
+CNSTI4 0
+RETI4
+ADDRGP4 $2602
+JUMPV
+LABELV $2603
+CNSTI4 1
+RETI4
+LABELV $2602
+endproc ItemParse_cvarTest 4 8
+proc ItemParse_cvar 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2606
+CNSTI4 0
+RETI4
+ADDRGP4 $2605
+JUMPV
+LABELV $2606
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2608
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+LABELV $2608
+CNSTI4 1
+RETI4
+LABELV $2605
+endproc ItemParse_cvar 8 8
+proc ItemParse_cvarSet 16 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2611
+CNSTI4 0
+RETI4
+ADDRGP4 $2610
+JUMPV
+LABELV $2611
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2613
+CNSTI4 0
+RETI4
+ADDRGP4 $2610
+JUMPV
+LABELV $2613
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $2610
+endproc ItemParse_cvarSet 16 8
+proc ItemParse_maxChars 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2616
+CNSTI4 0
+RETI4
+ADDRGP4 $2615
+JUMPV
+LABELV $2616
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2618
+CNSTI4 0
+RETI4
+ADDRGP4 $2615
+JUMPV
+LABELV $2618
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2615
+endproc ItemParse_maxChars 12 8
+proc ItemParse_maxPaintChars 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2621
+CNSTI4 0
+RETI4
+ADDRGP4 $2620
+JUMPV
+LABELV $2621
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2623
+CNSTI4 0
+RETI4
+ADDRGP4 $2620
+JUMPV
+LABELV $2623
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2620
+endproc ItemParse_maxPaintChars 12 8
+proc ItemParse_cvarFloat 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2626
+CNSTI4 0
+RETI4
+ADDRGP4 $2625
+JUMPV
+LABELV $2626
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2628
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2628
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2628
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2628
+CNSTI4 1
+RETI4
+ADDRGP4 $2625
+JUMPV
+LABELV $2628
+CNSTI4 0
+RETI4
+LABELV $2625
+endproc ItemParse_cvarFloat 20 8
+proc ItemParse_cvarInt 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2631
+ADDRGP4 $2633
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2630
+JUMPV
+LABELV $2631
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2634
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2634
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2634
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2634
+CNSTI4 1
+RETI4
+ADDRGP4 $2630
+JUMPV
+LABELV $2634
+CNSTI4 0
+RETI4
+LABELV $2630
+endproc ItemParse_cvarInt 20 8
+proc ItemParse_cvarStrList 1068 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2637
+CNSTI4 0
+RETI4
+ADDRGP4 $2636
+JUMPV
+LABELV $2637
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2639
+CNSTI4 0
+RETI4
+ADDRGP4 $2636
+JUMPV
+LABELV $2639
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2641
+CNSTI4 0
+RETI4
+ADDRGP4 $2636
+JUMPV
+LABELV $2641
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2645
+JUMPV
+LABELV $2644
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $2647
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2649
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2636
+JUMPV
+LABELV $2647
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2650
+CNSTI4 1
+RETI4
+ADDRGP4 $2636
+JUMPV
+LABELV $2650
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 44
+EQI4 $2657
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $2653
+LABELV $2657
+ADDRGP4 $2645
+JUMPV
+LABELV $2653
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2658
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1056
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1040
+INDIRP4
+ADDP4
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2659
+JUMPV
+LABELV $2658
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1056
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2662
+ADDRGP4 $2664
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2636
+JUMPV
+LABELV $2662
+LABELV $2659
+LABELV $2645
+ADDRGP4 $2644
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2636
+endproc ItemParse_cvarStrList 1068 8
+proc ItemParse_cvarFloatList 1072 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2666
+CNSTI4 0
+RETI4
+ADDRGP4 $2665
+JUMPV
+LABELV $2666
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2668
+CNSTI4 0
+RETI4
+ADDRGP4 $2665
+JUMPV
+LABELV $2668
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2674
+CNSTI4 0
+RETI4
+ADDRGP4 $2665
+JUMPV
+LABELV $2673
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2676
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2649
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2665
+JUMPV
+LABELV $2676
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2678
+CNSTI4 1
+RETI4
+ADDRGP4 $2665
+JUMPV
+LABELV $2678
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 44
+EQI4 $2685
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $2681
+LABELV $2685
+ADDRGP4 $2674
+JUMPV
+LABELV $2681
+ADDRLP4 4+16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $2687
+CNSTI4 0
+RETI4
+ADDRGP4 $2665
+JUMPV
+LABELV $2687
+ADDRLP4 1068
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ADDRLP4 1068
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2689
+ADDRGP4 $2691
+ARGP4
+ADDRGP4 $2692
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2665
+JUMPV
+LABELV $2689
+LABELV $2674
+ADDRGP4 $2673
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2665
+endproc ItemParse_cvarFloatList 1072 8
+proc ItemParse_addColorRange 44 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 24
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2694
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+ARGP4
+ADDRLP4 28
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2694
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2694
+ADDRFP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $2698
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 24
+ADDRLP4 36
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 320
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 24
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2699
+JUMPV
+LABELV $2698
+ADDRGP4 $2700
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2699
+CNSTI4 1
+RETI4
+ADDRGP4 $2693
+JUMPV
+LABELV $2694
+CNSTI4 0
+RETI4
+LABELV $2693
+endproc ItemParse_addColorRange 44 12
+proc ItemParse_ownerdrawFlag 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2702
+CNSTI4 0
+RETI4
+ADDRGP4 $2701
+JUMPV
+LABELV $2702
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2701
+endproc ItemParse_ownerdrawFlag 12 8
+proc ItemParse_ownerdrawFlag2 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2705
+CNSTI4 0
+RETI4
+ADDRGP4 $2704
+JUMPV
+LABELV $2705
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2704
+endproc ItemParse_ownerdrawFlag2 12 8
+proc ItemParse_enableCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2708
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2707
+JUMPV
+LABELV $2708
+CNSTI4 0
+RETI4
+LABELV $2707
+endproc ItemParse_enableCvar 4 8
+proc ItemParse_disableCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2711
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+CNSTI4 2
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2710
+JUMPV
+LABELV $2711
+CNSTI4 0
+RETI4
+LABELV $2710
+endproc ItemParse_disableCvar 4 8
+proc ItemParse_showCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2714
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+CNSTI4 4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2713
+JUMPV
+LABELV $2714
+CNSTI4 0
+RETI4
+LABELV $2713
+endproc ItemParse_showCvar 4 8
+proc ItemParse_hideCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2717
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+CNSTI4 8
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2716
+JUMPV
+LABELV $2717
+CNSTI4 0
+RETI4
+LABELV $2716
+endproc ItemParse_hideCvar 4 8
+proc ItemParse_defaultContent 20 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2720
+CNSTI4 0
+RETI4
+ADDRGP4 $2719
+JUMPV
+LABELV $2720
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2722
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $2722
+CNSTI4 1
+RETI4
+LABELV $2719
+endproc ItemParse_defaultContent 20 8
+proc ItemParse_cellId 8 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2725
+CNSTI4 0
+RETI4
+ADDRGP4 $2724
+JUMPV
+LABELV $2725
+CNSTI4 1
+RETI4
+LABELV $2724
+endproc ItemParse_cellId 8 8
+proc ItemParse_font 180 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 140
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $2728
+CNSTI4 0
+RETI4
+ADDRGP4 $2727
+JUMPV
+LABELV $2728
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+INDIRU4
+CNSTU4 1
+NEU4 $2730
+ADDRLP4 148
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 48
+EQI4 $2733
+ADDRLP4 148
+INDIRI4
+CNSTI4 49
+EQI4 $2733
+ADDRLP4 148
+INDIRI4
+CNSTI4 50
+NEI4 $2730
+LABELV $2733
+ADDRLP4 72
+CNSTI4 48
+ASGNI4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $2740
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+EQI4 $2736
+ADDRLP4 160
+INDIRI4
+CNSTI4 2
+EQI4 $2738
+ADDRGP4 $2734
+JUMPV
+LABELV $2736
+ADDRLP4 68
+ADDRGP4 $2737
+ASGNP4
+ADDRGP4 $2731
+JUMPV
+LABELV $2738
+ADDRLP4 68
+ADDRGP4 $2739
+ASGNP4
+ADDRGP4 $2731
+JUMPV
+LABELV $2734
+LABELV $2740
+ADDRLP4 68
+ADDRGP4 $2741
+ASGNP4
+ADDRGP4 $2731
+JUMPV
+LABELV $2730
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 152
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $2742
+CNSTI4 0
+RETI4
+ADDRGP4 $2727
+JUMPV
+LABELV $2742
+LABELV $2731
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 $2746
+ARGP4
+ADDRLP4 152
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $2744
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2727
+JUMPV
+LABELV $2744
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 $2749
+ARGP4
+ADDRLP4 156
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $2755
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 $2750
+ARGP4
+ADDRLP4 160
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $2755
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 $2751
+ARGP4
+ADDRLP4 164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $2755
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 $2752
+ARGP4
+ADDRLP4 168
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $2747
+LABELV $2755
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2748
+JUMPV
+LABELV $2747
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 172
+ADDRGP4 COM_SkipPath
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRGP4 $2756
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2748
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2760
+JUMPV
+LABELV $2757
+ADDRLP4 4
+ARGP4
+CNSTI4 21668
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 65252
+ADDP4
+ADDP4
+CNSTI4 21532
+ADDP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $2761
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2727
+JUMPV
+LABELV $2761
+LABELV $2758
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2760
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5633928
+ADDP4
+INDIRI4
+LEI4 $2757
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5633928
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 257
+LTI4 $2763
+ADDRGP4 $2765
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2727
+JUMPV
+LABELV $2763
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+CNSTI4 21668
+ADDRLP4 172
+INDIRP4
+CNSTI4 5633928
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 172
+INDIRP4
+CNSTI4 86920
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5633928
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 176
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5633928
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2727
+endproc ItemParse_font 180 12
+proc ItemParse_precision 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2767
+CNSTI4 0
+RETI4
+ADDRGP4 $2766
+JUMPV
+LABELV $2767
+CNSTI4 1
+RETI4
+LABELV $2766
+endproc ItemParse_precision 4 8
+proc Q_GetToken 36 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2770
+ADDRGP4 $2772
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $2769
+JUMPV
+LABELV $2770
+ADDRFP4 12
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2773
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+RETP4
+ADDRGP4 $2769
+JUMPV
+LABELV $2773
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2776
+JUMPV
+LABELV $2775
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2778
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2777
+JUMPV
+LABELV $2778
+ADDRLP4 12
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 9
+EQI4 $2780
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+LTI4 $2782
+ADDRLP4 12
+INDIRI4
+CNSTI4 126
+LEI4 $2780
+LABELV $2782
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2777
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRGP4 $2777
+JUMPV
+LABELV $2780
+ADDRLP4 16
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+EQI4 $2789
+ADDRLP4 16
+INDIRI4
+CNSTI4 9
+EQI4 $2789
+ADDRLP4 16
+INDIRI4
+CNSTI4 39
+EQI4 $2789
+ADDRLP4 16
+INDIRI4
+CNSTI4 34
+NEI4 $2785
+LABELV $2789
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2777
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $2776
+JUMPV
+LABELV $2785
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2792
+ADDRLP4 20
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 47
+EQI4 $2799
+ADDRLP4 20
+INDIRI4
+CNSTI4 45
+EQI4 $2799
+ADDRLP4 20
+INDIRI4
+CNSTI4 43
+EQI4 $2799
+ADDRLP4 20
+INDIRI4
+CNSTI4 42
+EQI4 $2799
+ADDRLP4 20
+INDIRI4
+CNSTI4 40
+EQI4 $2799
+ADDRLP4 20
+INDIRI4
+CNSTI4 41
+EQI4 $2799
+ADDRLP4 20
+INDIRI4
+CNSTI4 44
+NEI4 $2792
+LABELV $2799
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2800
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRGP4 $2777
+JUMPV
+LABELV $2800
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI1
+ASGNI1
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $2777
+JUMPV
+LABELV $2792
+ADDRLP4 24
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 33
+LTI4 $2804
+ADDRLP4 24
+INDIRI4
+CNSTI4 126
+LEI4 $2802
+LABELV $2804
+ADDRGP4 $2777
+JUMPV
+LABELV $2802
+ADDRLP4 28
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 123
+EQI4 $2807
+ADDRLP4 28
+INDIRI4
+CNSTI4 125
+NEI4 $2805
+LABELV $2807
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2808
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRGP4 $2777
+JUMPV
+LABELV $2808
+LABELV $2805
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI1
+ASGNI1
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $2776
+ADDRGP4 $2775
+JUMPV
+LABELV $2777
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $2769
+endproc Q_GetToken 36 4
+data
+align 4
+LABELV $2811
+byte 4 0
+export Q_MathScript
+code
+proc Q_MathScript 1484 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 1376
+ADDRGP4 $2811
+ASGNP4
+ADDRLP4 1376
+INDIRP4
+ADDRLP4 1376
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1380
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1372
+ADDRLP4 1380
+INDIRI4
+ASGNI4
+ADDRLP4 1384
+CNSTI4 0
+ASGNI4
+ADDRLP4 1368
+ADDRLP4 1384
+INDIRI4
+ASGNI4
+ADDRLP4 1364
+ADDRLP4 1384
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1384
+INDIRI4
+ASGNI4
+ADDRGP4 $2813
+JUMPV
+LABELV $2812
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1300
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1364
+ARGP4
+ADDRLP4 1388
+ADDRGP4 Q_GetToken
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 1388
+INDIRP4
+ASGNP4
+ADDRLP4 1368
+INDIRI4
+CNSTI4 0
+EQI4 $2815
+ADDRGP4 $2817
+ARGP4
+ADDRLP4 1300
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1364
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2815
+ADDRLP4 1392
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1392
+INDIRI4
+CNSTI4 0
+EQI4 $2820
+ADDRLP4 1392
+INDIRI4
+CNSTI4 123
+NEI4 $2818
+LABELV $2820
+ADDRGP4 $2814
+JUMPV
+LABELV $2818
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 40
+NEI4 $2821
+ADDRLP4 1396
+CNSTI4 1
+ASGNI4
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $2824
+JUMPV
+LABELV $2823
+ADDRLP4 1036
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 40
+NEI4 $2826
+ADDRLP4 1396
+ADDRLP4 1396
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2827
+JUMPV
+LABELV $2826
+ADDRLP4 1036
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 41
+NEI4 $2828
+ADDRLP4 1396
+ADDRLP4 1396
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2828
+LABELV $2827
+ADDRLP4 1036
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 9
+NEI4 $2830
+ADDRLP4 1036
+ADDRLP4 1036
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $2824
+JUMPV
+LABELV $2830
+ADDRLP4 1404
+CNSTI4 0
+ASGNI4
+ADDRLP4 1396
+INDIRI4
+ADDRLP4 1404
+INDIRI4
+EQI4 $2837
+ADDRLP4 1408
+ADDRLP4 1036
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 1404
+INDIRI4
+EQI4 $2837
+ADDRLP4 1408
+INDIRI4
+CNSTI4 10
+EQI4 $2837
+ADDRLP4 1408
+INDIRI4
+CNSTI4 32
+LTI4 $2837
+ADDRLP4 1408
+INDIRI4
+CNSTI4 126
+LEI4 $2832
+LABELV $2837
+ADDRLP4 1044
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 1044
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1400
+ARGP4
+ADDRLP4 1040
+ARGP4
+ADDRGP4 Q_MathScript
+CALLP4
+pop
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $2838
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 1416
+ADDRGP4 $2811
+ASGNP4
+ADDRLP4 1416
+INDIRP4
+ADDRLP4 1416
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $2810
+JUMPV
+LABELV $2838
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1400
+INDIRF4
+ASGNF4
+ADDRLP4 1416
+CNSTI4 1
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+ADDRLP4 1416
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 1036
+INDIRP4
+ADDRLP4 1416
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $2825
+JUMPV
+LABELV $2832
+ADDRLP4 1036
+ADDRLP4 1036
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $2824
+ADDRGP4 $2823
+JUMPV
+LABELV $2825
+LABELV $2821
+ADDRGP4 $2840
+JUMPV
+ADDRGP4 $2841
+JUMPV
+LABELV $2840
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $2842
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2844
+JUMPV
+LABELV $2842
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $2845
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2844
+JUMPV
+LABELV $2845
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $2847
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2844
+JUMPV
+LABELV $2847
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $2849
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2844
+JUMPV
+LABELV $2849
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 37
+NEI4 $2851
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2844
+JUMPV
+LABELV $2851
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 60
+NEI4 $2853
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2844
+JUMPV
+LABELV $2853
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 62
+NEI4 $2855
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1086324736
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2856
+JUMPV
+LABELV $2855
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 33
+NEI4 $2857
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1088421888
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2858
+JUMPV
+LABELV $2857
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 61
+NEI4 $2859
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2860
+JUMPV
+LABELV $2859
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 38
+NEI4 $2861
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1091567616
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2862
+JUMPV
+LABELV $2861
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 124
+NEI4 $2863
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2864
+JUMPV
+LABELV $2863
+ADDRLP4 1396
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1396
+INDIRI4
+CNSTI4 46
+EQI4 $2867
+ADDRLP4 1396
+INDIRI4
+CNSTI4 48
+LTI4 $2865
+ADDRLP4 1396
+INDIRI4
+CNSTI4 57
+GTI4 $2865
+LABELV $2867
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1300
+ARGP4
+ADDRLP4 1400
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1400
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2844
+JUMPV
+LABELV $2865
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2870
+ARGP4
+ADDRLP4 1400
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1400
+INDIRI4
+CNSTI4 0
+NEI4 $2868
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2869
+JUMPV
+LABELV $2868
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2873
+ARGP4
+ADDRLP4 1404
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1404
+INDIRI4
+CNSTI4 0
+NEI4 $2871
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2872
+JUMPV
+LABELV $2871
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2876
+ARGP4
+ADDRLP4 1408
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+CNSTI4 0
+NEI4 $2874
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2875
+JUMPV
+LABELV $2874
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2879
+ARGP4
+ADDRLP4 1412
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1412
+INDIRI4
+CNSTI4 0
+NEI4 $2877
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1099431936
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2878
+JUMPV
+LABELV $2877
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2882
+ARGP4
+ADDRLP4 1416
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1416
+INDIRI4
+CNSTI4 0
+NEI4 $2880
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1099956224
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2881
+JUMPV
+LABELV $2880
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2885
+ARGP4
+ADDRLP4 1420
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1420
+INDIRI4
+CNSTI4 0
+NEI4 $2883
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1100480512
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2884
+JUMPV
+LABELV $2883
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2888
+ARGP4
+ADDRLP4 1424
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1424
+INDIRI4
+CNSTI4 0
+NEI4 $2886
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2887
+JUMPV
+LABELV $2886
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2891
+ARGP4
+ADDRLP4 1428
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1428
+INDIRI4
+CNSTI4 0
+NEI4 $2889
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1101529088
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2890
+JUMPV
+LABELV $2889
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2894
+ARGP4
+ADDRLP4 1432
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1432
+INDIRI4
+CNSTI4 0
+NEI4 $2892
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1102053376
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2893
+JUMPV
+LABELV $2892
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2897
+ARGP4
+ADDRLP4 1436
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1436
+INDIRI4
+CNSTI4 0
+NEI4 $2895
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1102577664
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2896
+JUMPV
+LABELV $2895
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2900
+ARGP4
+ADDRLP4 1440
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1440
+INDIRI4
+CNSTI4 0
+NEI4 $2898
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2899
+JUMPV
+LABELV $2898
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2903
+ARGP4
+ADDRLP4 1444
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1444
+INDIRI4
+CNSTI4 0
+NEI4 $2901
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1103626240
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2902
+JUMPV
+LABELV $2901
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2906
+ARGP4
+ADDRLP4 1448
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1448
+INDIRI4
+CNSTI4 0
+NEI4 $2904
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1104150528
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2905
+JUMPV
+LABELV $2904
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2909
+ARGP4
+ADDRLP4 1452
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1452
+INDIRI4
+CNSTI4 0
+NEI4 $2907
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1078530011
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2908
+JUMPV
+LABELV $2907
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2912
+ARGP4
+ADDRLP4 1456
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1456
+INDIRI4
+CNSTI4 0
+NEI4 $2910
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1460
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1460
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2911
+JUMPV
+LABELV $2910
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2916
+ARGP4
+ADDRLP4 1460
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1460
+INDIRI4
+CNSTI4 0
+NEI4 $2914
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1464
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 1464
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2915
+JUMPV
+LABELV $2914
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2920
+ARGP4
+ADDRLP4 1464
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1464
+INDIRI4
+CNSTI4 0
+NEI4 $2918
+ADDRLP4 1468
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1468
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2919
+JUMPV
+LABELV $2918
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2924
+ARGP4
+ADDRLP4 1468
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1468
+INDIRI4
+CNSTI4 0
+NEI4 $2922
+ADDRLP4 1472
+ADDRGP4 DC
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1472
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2923
+JUMPV
+LABELV $2922
+ADDRLP4 1300
+ARGP4
+ADDRGP4 $2928
+ARGP4
+ADDRLP4 1472
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1472
+INDIRI4
+CNSTI4 0
+NEI4 $2926
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1104674816
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2927
+JUMPV
+LABELV $2926
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 64
+NEI4 $2929
+ADDRLP4 1300
+ARGP4
+ADDRLP4 1480
+ADDRGP4 MenuVar_Get
+CALLF4
+ASGNF4
+ADDRLP4 1476
+ADDRLP4 1480
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1476
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2930
+JUMPV
+LABELV $2929
+ADDRLP4 1300
+INDIRI1
+CVII4 1
+CNSTI4 40
+NEI4 $2932
+ADDRGP4 $2933
+JUMPV
+LABELV $2932
+ADDRLP4 1300
+ARGP4
+ADDRLP4 1476
+ADDRGP4 DC
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1476
+INDIRI4
+CNSTI4 0
+EQI4 $2934
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1300
+ARGP4
+ADDRLP4 1480
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1480
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRLP4 1368
+INDIRI4
+CNSTI4 0
+EQI4 $2935
+ADDRGP4 $2935
+JUMPV
+LABELV $2934
+ADDRGP4 $2939
+ARGP4
+ADDRLP4 1300
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1480
+ADDRGP4 $2811
+ASGNP4
+ADDRLP4 1480
+INDIRP4
+ADDRLP4 1480
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $2810
+JUMPV
+LABELV $2935
+LABELV $2933
+LABELV $2930
+LABELV $2927
+LABELV $2923
+LABELV $2919
+LABELV $2915
+LABELV $2911
+LABELV $2908
+LABELV $2905
+LABELV $2902
+LABELV $2899
+LABELV $2896
+LABELV $2893
+LABELV $2890
+LABELV $2887
+LABELV $2884
+LABELV $2881
+LABELV $2878
+LABELV $2875
+LABELV $2872
+LABELV $2869
+LABELV $2864
+LABELV $2862
+LABELV $2860
+LABELV $2858
+LABELV $2856
+LABELV $2841
+LABELV $2844
+ADDRLP4 1364
+INDIRI4
+CNSTI4 0
+EQI4 $2940
+ADDRGP4 $2814
+JUMPV
+LABELV $2940
+LABELV $2813
+ADDRGP4 $2812
+JUMPV
+LABELV $2814
+ADDRLP4 1388
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 1388
+INDIRF4
+CNSTF4 1065353216
+LTF4 $2942
+ADDRLP4 1388
+INDIRF4
+CNSTF4 1092616192
+GTF4 $2942
+ADDRLP4 1388
+INDIRF4
+CNSTF4 1073741824
+EQF4 $2942
+ADDRFP4 8
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2944
+ARGP4
+ADDRGP4 $2811
+INDIRI4
+ARGI4
+ADDRLP4 1372
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1392
+ADDRGP4 $2811
+ASGNP4
+ADDRLP4 1392
+INDIRP4
+ADDRLP4 1392
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $2810
+JUMPV
+LABELV $2942
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+LEI4 $2945
+ADDRLP4 1396
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1396
+INDIRI4
+ADDRLP4 4-8
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $2945
+ADDRLP4 1396
+INDIRI4
+ADDRLP4 4-8
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+GTF4 $2945
+ADDRFP4 8
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2949
+ARGP4
+ADDRGP4 $2811
+INDIRI4
+ARGI4
+ADDRLP4 1372
+INDIRI4
+ARGI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-8
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1400
+ADDRGP4 $2811
+ASGNP4
+ADDRLP4 1400
+INDIRP4
+ADDRLP4 1400
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $2810
+JUMPV
+LABELV $2945
+ADDRLP4 1032
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $2954
+JUMPV
+LABELV $2951
+ADDRLP4 1408
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1408
+INDIRF4
+CNSTF4 1096810496
+LTF4 $2957
+ADDRLP4 1408
+INDIRF4
+CNSTF4 1105199104
+LEF4 $2955
+LABELV $2957
+ADDRGP4 $2952
+JUMPV
+LABELV $2955
+ADDRLP4 1400
+CNSTF4 0
+ASGNF4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $2958
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+CNSTF4 1093664768
+EQF4 $2960
+ADDRFP4 8
+INDIRP4
+CNSTI4 6
+ASGNI4
+ADDRGP4 $2963
+ARGP4
+ADDRGP4 $2811
+INDIRI4
+ARGI4
+ADDRLP4 1372
+INDIRI4
+ARGI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1412
+ADDRGP4 $2811
+ASGNP4
+ADDRLP4 1412
+INDIRP4
+ADDRLP4 1412
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $2810
+JUMPV
+LABELV $2960
+ADDRLP4 1400
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $2958
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1096810496
+NEF4 $2966
+ADDRLP4 1400
+INDIRF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 1400
+ADDRLP4 1412
+INDIRF4
+ASGNF4
+ADDRGP4 $2967
+JUMPV
+LABELV $2966
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1097859072
+NEF4 $2968
+ADDRLP4 1400
+INDIRF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 ceil
+CALLF4
+ASGNF4
+ADDRLP4 1400
+ADDRLP4 1412
+INDIRF4
+ASGNF4
+ADDRGP4 $2969
+JUMPV
+LABELV $2968
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+NEF4 $2970
+ADDRLP4 1400
+INDIRF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 1400
+ADDRLP4 1412
+INDIRF4
+ASGNF4
+ADDRGP4 $2971
+JUMPV
+LABELV $2970
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1099431936
+NEF4 $2972
+CNSTF4 1078530011
+ADDRLP4 1400
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 1400
+ADDRLP4 1412
+INDIRF4
+ASGNF4
+ADDRGP4 $2973
+JUMPV
+LABELV $2972
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1099956224
+NEF4 $2974
+CNSTF4 1078530011
+ADDRLP4 1400
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 1400
+ADDRLP4 1412
+INDIRF4
+ASGNF4
+ADDRGP4 $2975
+JUMPV
+LABELV $2974
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1100480512
+NEF4 $2976
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 1400
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 1400
+ADDRLP4 1412
+INDIRF4
+ASGNF4
+ADDRGP4 $2977
+JUMPV
+LABELV $2976
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1101004800
+NEF4 $2978
+ADDRLP4 1400
+INDIRF4
+CNSTF4 0
+GEF4 $2980
+ADDRLP4 1400
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2979
+JUMPV
+LABELV $2980
+ADDRLP4 1400
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2979
+ADDRLP4 1400
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2979
+JUMPV
+LABELV $2978
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1101529088
+NEF4 $2984
+ADDRLP4 1400
+INDIRF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 acos
+CALLI4
+ASGNI4
+ADDRLP4 1400
+CNSTF4 1127481344
+ADDRLP4 1412
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $2985
+JUMPV
+LABELV $2984
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1102053376
+NEF4 $2986
+ADDRLP4 1400
+INDIRF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 acos
+CALLI4
+ASGNI4
+ADDRLP4 1400
+CNSTF4 1127481344
+CNSTF4 1070141403
+ADDRLP4 1412
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $2987
+JUMPV
+LABELV $2986
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1102577664
+NEF4 $2988
+ADDRLP4 1400
+INDIRF4
+ADDRLP4 1400
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRLP4 1416
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 1400
+INDIRF4
+ADDRLP4 1416
+INDIRF4
+DIVF4
+ARGF4
+ADDRLP4 1420
+ADDRGP4 acos
+CALLI4
+ASGNI4
+ADDRLP4 1400
+CNSTF4 1127481344
+CNSTF4 1070141403
+ADDRLP4 1420
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $2989
+JUMPV
+LABELV $2988
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1103101952
+NEF4 $2990
+ADDRLP4 1404
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1400
+INDIRF4
+ARGF4
+ADDRLP4 1404
+INDIRF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 1400
+CNSTF4 1127481344
+ADDRLP4 1412
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $2991
+JUMPV
+LABELV $2990
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1103626240
+NEF4 $2993
+CNSTF4 1078530011
+ADDRLP4 1400
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 1400
+ADDRLP4 1412
+INDIRF4
+ASGNF4
+ADDRGP4 $2994
+JUMPV
+LABELV $2993
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1104150528
+NEF4 $2995
+ADDRLP4 1404
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1400
+INDIRF4
+ARGF4
+ADDRLP4 1404
+INDIRF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 powf
+CALLI4
+ASGNI4
+ADDRLP4 1400
+ADDRLP4 1412
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $2996
+JUMPV
+LABELV $2995
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1104674816
+NEF4 $2998
+ADDRLP4 1400
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 1412
+ADDRGP4 DC
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 1400
+ADDRLP4 1412
+INDIRF4
+ASGNF4
+ADDRGP4 $2999
+JUMPV
+LABELV $2998
+ADDRGP4 $3000
+ARGP4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2999
+LABELV $2996
+LABELV $2994
+LABELV $2991
+LABELV $2989
+LABELV $2987
+LABELV $2985
+LABELV $2979
+LABELV $2977
+LABELV $2975
+LABELV $2973
+LABELV $2971
+LABELV $2969
+LABELV $2967
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1400
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3005
+JUMPV
+LABELV $3002
+ADDRLP4 1412
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1412
+INDIRI4
+ADDRLP4 4-8
+ADDP4
+ADDRLP4 1412
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3003
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3005
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3002
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $2952
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $2954
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+GEI4 $2951
+ADDRLP4 1032
+CNSTI4 2
+ASGNI4
+ADDRGP4 $3010
+JUMPV
+LABELV $3007
+ADDRLP4 1400
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1400
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3011
+ADDRLP4 1400
+INDIRF4
+CNSTF4 1092616192
+GTF4 $3011
+ADDRLP4 1404
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3013
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+GTF4 $3013
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+EQF4 $3017
+ADDRFP4 8
+INDIRP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $3020
+ARGP4
+ADDRGP4 $2811
+INDIRI4
+ARGI4
+ADDRLP4 1372
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1408
+ADDRGP4 $2811
+ASGNP4
+ADDRLP4 1408
+INDIRP4
+ADDRLP4 1408
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $2810
+JUMPV
+LABELV $3017
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $3013
+LABELV $3011
+LABELV $3008
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $3010
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3007
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3024
+JUMPV
+LABELV $3021
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $3025
+ADDRGP4 $3022
+JUMPV
+LABELV $3025
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+NEF4 $3027
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $3033
+ADDRLP4 1404
+CNSTI4 2
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1404
+INDIRI4
+LTI4 $3029
+ADDRLP4 1408
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1404
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4-8
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3029
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4-8
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+GTF4 $3029
+LABELV $3033
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1093664768
+ASGNF4
+ADDRLP4 1412
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1412
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 1412
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3039
+JUMPV
+LABELV $3036
+ADDRLP4 1416
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1416
+INDIRI4
+ADDRLP4 4-8
+ADDP4
+ADDRLP4 1416
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3037
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3039
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3036
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $3029
+LABELV $3027
+LABELV $3022
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $3024
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3021
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3044
+JUMPV
+LABELV $3041
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $3045
+ADDRGP4 $3042
+JUMPV
+LABELV $3045
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1077936128
+NEF4 $3047
+ADDRLP4 1400
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1404
+ADDRLP4 1400
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ASGNP4
+ADDRLP4 1404
+INDIRP4
+ADDRLP4 1404
+INDIRP4
+INDIRF4
+ADDRLP4 1400
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3054
+JUMPV
+LABELV $3051
+ADDRLP4 1408
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3052
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3054
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3051
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $3042
+JUMPV
+LABELV $3047
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+NEF4 $3056
+ADDRLP4 1400
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1404
+ADDRLP4 1400
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ASGNP4
+ADDRLP4 1404
+INDIRP4
+ADDRLP4 1404
+INDIRP4
+INDIRF4
+ADDRLP4 1400
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3063
+JUMPV
+LABELV $3060
+ADDRLP4 1408
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3061
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3063
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3060
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $3042
+JUMPV
+LABELV $3056
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1094713344
+NEF4 $3065
+ADDRLP4 1400
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1400
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1404
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1408
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRLP4 1400
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 1408
+INDIRI4
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3073
+JUMPV
+LABELV $3070
+ADDRLP4 1412
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1412
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1412
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3071
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3073
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3070
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $3065
+LABELV $3042
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $3044
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3041
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3078
+JUMPV
+LABELV $3075
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $3079
+ADDRGP4 $3076
+JUMPV
+LABELV $3079
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+NEF4 $3081
+ADDRLP4 1400
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1404
+ADDRLP4 1400
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ASGNP4
+ADDRLP4 1404
+INDIRP4
+ADDRLP4 1404
+INDIRP4
+INDIRF4
+ADDRLP4 1400
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3088
+JUMPV
+LABELV $3085
+ADDRLP4 1408
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3086
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3088
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3085
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $3076
+JUMPV
+LABELV $3081
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+NEF4 $3090
+ADDRLP4 1400
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1404
+ADDRLP4 1400
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ASGNP4
+ADDRLP4 1404
+INDIRP4
+ADDRLP4 1404
+INDIRP4
+INDIRF4
+ADDRLP4 1400
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3097
+JUMPV
+LABELV $3094
+ADDRLP4 1408
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3095
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3097
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3094
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $3090
+LABELV $3076
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $3078
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3075
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3102
+JUMPV
+LABELV $3099
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $3103
+ADDRGP4 $3100
+JUMPV
+LABELV $3103
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1084227584
+NEF4 $3105
+ADDRLP4 1404
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+GEF4 $3111
+ADDRLP4 1400
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3112
+JUMPV
+LABELV $3111
+ADDRLP4 1400
+CNSTI4 0
+ASGNI4
+LABELV $3112
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1400
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3116
+JUMPV
+LABELV $3113
+ADDRLP4 1408
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3114
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3116
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3113
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $3100
+JUMPV
+LABELV $3105
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1086324736
+NEF4 $3118
+ADDRLP4 1404
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+LEF4 $3124
+ADDRLP4 1400
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3125
+JUMPV
+LABELV $3124
+ADDRLP4 1400
+CNSTI4 0
+ASGNI4
+LABELV $3125
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1400
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3129
+JUMPV
+LABELV $3126
+ADDRLP4 1408
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3127
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3129
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3126
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $3100
+JUMPV
+LABELV $3118
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1088421888
+NEF4 $3131
+ADDRLP4 1404
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+EQF4 $3137
+ADDRLP4 1400
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3138
+JUMPV
+LABELV $3137
+ADDRLP4 1400
+CNSTI4 0
+ASGNI4
+LABELV $3138
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1400
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3142
+JUMPV
+LABELV $3139
+ADDRLP4 1408
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3140
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3142
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3139
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $3100
+JUMPV
+LABELV $3131
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1090519040
+NEF4 $3144
+ADDRLP4 1404
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+NEF4 $3150
+ADDRLP4 1400
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3151
+JUMPV
+LABELV $3150
+ADDRLP4 1400
+CNSTI4 0
+ASGNI4
+LABELV $3151
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1400
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3155
+JUMPV
+LABELV $3152
+ADDRLP4 1408
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3153
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3155
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3152
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $3144
+LABELV $3100
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $3102
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3099
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3160
+JUMPV
+LABELV $3157
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $3161
+ADDRGP4 $3158
+JUMPV
+LABELV $3161
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1091567616
+NEF4 $3163
+ADDRLP4 1404
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1408
+CNSTF4 0
+ASGNF4
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ADDRLP4 1408
+INDIRF4
+EQF4 $3169
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+ADDRLP4 1408
+INDIRF4
+EQF4 $3169
+ADDRLP4 1400
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3170
+JUMPV
+LABELV $3169
+ADDRLP4 1400
+CNSTI4 0
+ASGNI4
+LABELV $3170
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1400
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3174
+JUMPV
+LABELV $3171
+ADDRLP4 1412
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1412
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1412
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3172
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3174
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3171
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $3158
+JUMPV
+LABELV $3163
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+NEF4 $3176
+ADDRLP4 1404
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1408
+CNSTF4 0
+ASGNF4
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ADDRLP4 1408
+INDIRF4
+NEF4 $3184
+ADDRLP4 1404
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+INDIRF4
+ADDRLP4 1408
+INDIRF4
+EQF4 $3182
+LABELV $3184
+ADDRLP4 1400
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3183
+JUMPV
+LABELV $3182
+ADDRLP4 1400
+CNSTI4 0
+ASGNI4
+LABELV $3183
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+ADDRLP4 1400
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $3188
+JUMPV
+LABELV $3185
+ADDRLP4 1412
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1412
+INDIRI4
+ADDRLP4 4-16
+ADDP4
+ADDRLP4 1412
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $3186
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3188
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3185
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $3176
+LABELV $3158
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $3160
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $3157
+ADDRLP4 4
+INDIRF4
+CNSTF4 1093664768
+EQF4 $3190
+ADDRFP4 8
+INDIRP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $3192
+ARGP4
+ADDRGP4 $2811
+INDIRI4
+ARGI4
+ADDRLP4 1372
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1400
+ADDRGP4 $2811
+ASGNP4
+ADDRLP4 1400
+INDIRP4
+ADDRLP4 1400
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $2810
+JUMPV
+LABELV $3190
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4+4
+INDIRF4
+ASGNF4
+ADDRLP4 1368
+INDIRI4
+CNSTI4 0
+EQI4 $3194
+ADDRGP4 $3196
+ARGP4
+ADDRGP4 $2811
+INDIRI4
+ARGI4
+ADDRLP4 1372
+INDIRI4
+ARGI4
+ADDRLP4 1028
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3194
+ADDRLP4 1400
+ADDRGP4 $2811
+ASGNP4
+ADDRLP4 1400
+INDIRP4
+ADDRLP4 1400
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $2810
+endproc Q_MathScript 1484 20
+proc ItemParse_setVar 28 12
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $3198
+CNSTI4 0
+RETI4
+ADDRGP4 $3197
+JUMPV
+LABELV $3198
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 PC_Parenthesis_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $3200
+CNSTI4 0
+RETI4
+ADDRGP4 $3197
+JUMPV
+LABELV $3200
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 Q_MathScript
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 MenuVar_Set
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3202
+CNSTI4 0
+RETI4
+ADDRGP4 $3197
+JUMPV
+LABELV $3202
+CNSTI4 1
+RETI4
+LABELV $3197
+endproc ItemParse_setVar 28 12
+proc ItemParse_run 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $3205
+CNSTI4 1
+RETI4
+ADDRGP4 $3204
+JUMPV
+LABELV $3205
+CNSTI4 0
+RETI4
+LABELV $3204
+endproc ItemParse_run 4 8
+proc ItemParse_printVal 16 12
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Parenthesis_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3208
+CNSTI4 0
+RETI4
+ADDRGP4 $3207
+JUMPV
+LABELV $3208
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Q_MathScript
+CALLP4
+pop
+ADDRGP4 $3210
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $3207
+endproc ItemParse_printVal 16 12
+proc ItemParse_widescreen 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $3212
+CNSTI4 0
+RETI4
+ADDRGP4 $3211
+JUMPV
+LABELV $3212
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3216
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LEI4 $3214
+LABELV $3216
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $3217
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $3214
+CNSTI4 1
+RETI4
+LABELV $3211
+endproc ItemParse_widescreen 8 12
+data
+export itemParseKeywords
+align 4
+LABELV itemParseKeywords
+address $3218
+address ItemParse_name
+byte 4 0
+address $3219
+address ItemParse_text
+byte 4 0
+address $3220
+address ItemParse_textExt
+byte 4 0
+address $3221
+address ItemParse_textReset
+byte 4 0
+address $3222
+address ItemParse_group
+byte 4 0
+address $3223
+address ItemParse_asset_model
+byte 4 0
+address $3224
+address ItemParse_asset_shader
+byte 4 0
+address $3225
+address ItemParse_model_origin
+byte 4 0
+address $3226
+address ItemParse_model_fovx
+byte 4 0
+address $3227
+address ItemParse_model_fovy
+byte 4 0
+address $3228
+address ItemParse_model_rotation
+byte 4 0
+address $3229
+address ItemParse_model_angle
+byte 4 0
+address $3230
+address ItemParse_rect
+byte 4 0
+address $3231
+address ItemParse_style
+byte 4 0
+address $3232
+address ItemParse_decoration
+byte 4 0
+address $3233
+address ItemParse_notselectable
+byte 4 0
+address $3234
+address ItemParse_wrapped
+byte 4 0
+address $3235
+address ItemParse_autowrapped
+byte 4 0
+address $3236
+address ItemParse_horizontalscroll
+byte 4 0
+address $3237
+address ItemParse_type
+byte 4 0
+address $3238
+address ItemParse_elementwidth
+byte 4 0
+address $3239
+address ItemParse_elementheight
+byte 4 0
+address $3240
+address ItemParse_elementColor
+byte 4 0
+address $3241
+address ItemParse_selectedColor
+byte 4 0
+address $3242
+address ItemParse_altRowColor
+byte 4 0
+address $3243
+address ItemParse_feeder
+byte 4 0
+address $3244
+address ItemParse_elementtype
+byte 4 0
+address $3245
+address ItemParse_columns
+byte 4 0
+address $3246
+address ItemParse_border
+byte 4 0
+address $3247
+address ItemParse_bordersize
+byte 4 0
+address $3248
+address ItemParse_visible
+byte 4 0
+address $3249
+address ItemParse_ownerdraw
+byte 4 0
+address $3250
+address ItemParse_align
+byte 4 0
+address $3251
+address ItemParse_textalign
+byte 4 0
+address $3252
+address ItemParse_textalignx
+byte 4 0
+address $3253
+address ItemParse_textaligny
+byte 4 0
+address $3254
+address ItemParse_textscale
+byte 4 0
+address $3255
+address ItemParse_textstyle
+byte 4 0
+address $580
+address ItemParse_backcolor
+byte 4 0
+address $583
+address ItemParse_forecolor
+byte 4 0
+address $586
+address ItemParse_bordercolor
+byte 4 0
+address $3256
+address ItemParse_outlinecolor
+byte 4 0
+address $3257
+address ItemParse_background
+byte 4 0
+address $3258
+address ItemParse_backgroundReset
+byte 4 0
+address $3259
+address ItemParse_onFocus
+byte 4 0
+address $3260
+address ItemParse_leaveFocus
+byte 4 0
+address $3261
+address ItemParse_mouseEnter
+byte 4 0
+address $3262
+address ItemParse_mouseExit
+byte 4 0
+address $3263
+address ItemParse_mouseEnterText
+byte 4 0
+address $3264
+address ItemParse_mouseExitText
+byte 4 0
+address $3265
+address ItemParse_action
+byte 4 0
+address $3266
+address ItemParse_special
+byte 4 0
+address $3267
+address ItemParse_cvar
+byte 4 0
+address $3268
+address ItemParse_cvarSet
+byte 4 0
+address $3269
+address ItemParse_maxChars
+byte 4 0
+address $3270
+address ItemParse_maxPaintChars
+byte 4 0
+address $3271
+address ItemParse_focusSound
+byte 4 0
+address $3272
+address ItemParse_cvarFloat
+byte 4 0
+address $3273
+address ItemParse_cvarInt
+byte 4 0
+address $3274
+address ItemParse_cvarStrList
+byte 4 0
+address $3275
+address ItemParse_cvarFloatList
+byte 4 0
+address $3276
+address ItemParse_addColorRange
+byte 4 0
+address $3277
+address ItemParse_ownerdrawFlag
+byte 4 0
+address $3278
+address ItemParse_ownerdrawFlag2
+byte 4 0
+address $3279
+address ItemParse_enableCvar
+byte 4 0
+address $3280
+address ItemParse_cvarTest
+byte 4 0
+address $3281
+address ItemParse_disableCvar
+byte 4 0
+address $3282
+address ItemParse_showCvar
+byte 4 0
+address $3283
+address ItemParse_hideCvar
+byte 4 0
+address $3284
+address ItemParse_cinematic
+byte 4 0
+address $3285
+address ItemParse_doubleClick
+byte 4 0
+address $3286
+address ItemParse_defaultContent
+byte 4 0
+address $3287
+address ItemParse_cellId
+byte 4 0
+address $3288
+address ItemParse_font
+byte 4 0
+address $3289
+address ItemParse_precision
+byte 4 0
+address $795
+address ItemParse_setVar
+byte 4 0
+address $3290
+address ItemParse_run
+byte 4 0
+address $3291
+address ItemParse_printVal
+byte 4 0
+address $3292
+address ItemParse_widescreen
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+code
+proc Item_SetupKeywordHash 4 12
+ADDRGP4 itemParseKeywordHash
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3297
+JUMPV
+LABELV $3294
+ADDRGP4 itemParseKeywordHash
+ARGP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 itemParseKeywords
+ADDP4
+ARGP4
+ADDRGP4 KeywordHash_Add
+CALLV
+pop
+LABELV $3295
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3297
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 itemParseKeywords
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3294
+LABELV $3293
+endproc Item_SetupKeywordHash 4 12
+proc Item_RunFrameScript 1060 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3299
+ADDRGP4 $3301
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3298
+JUMPV
+LABELV $3299
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3302
+ADDRGP4 $3304
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3298
+JUMPV
+LABELV $3302
+ADDRLP4 16
+ADDRGP4 ScriptBuffer
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 UseScriptBuffer
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $3306
+JUMPV
+LABELV $3305
+LABELV $3308
+ADDRGP4 ScriptBuffer
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3312
+ADDRGP4 $3307
+JUMPV
+LABELV $3311
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 28
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1052
+ADDRGP4 ItemParse_if
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $3315
+ADDRGP4 ScriptBuffer
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 UseScriptBuffer
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $3298
+JUMPV
+LABELV $3315
+ADDRLP4 28
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3317
+ADDRGP4 $3308
+JUMPV
+LABELV $3317
+ADDRLP4 28
+ARGP4
+ADDRLP4 1056
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+LABELV $3312
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3314
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $3311
+ADDRGP4 itemParseKeywordHash
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 KeywordHash_Find
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3319
+ADDRGP4 $3321
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3306
+JUMPV
+LABELV $3319
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 36
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $3322
+ADDRGP4 $3324
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3307
+JUMPV
+LABELV $3322
+LABELV $3306
+ADDRGP4 $3305
+JUMPV
+LABELV $3307
+ADDRGP4 ScriptBuffer
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 UseScriptBuffer
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $3298
+endproc Item_RunFrameScript 1060 16
+proc ItemParse_if 68 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ADDRGP4 PC_Parenthesis_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $3326
+CNSTI4 0
+RETI4
+ADDRGP4 $3325
+JUMPV
+LABELV $3326
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3328
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 Q_MathScript
+CALLP4
+pop
+ADDRGP4 $3329
+JUMPV
+LABELV $3328
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+LABELV $3329
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $3330
+CNSTI4 0
+RETI4
+ADDRGP4 $3325
+JUMPV
+LABELV $3330
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+NEF4 $3332
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $3332
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $3334
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $3334
+ADDRLP4 20
+ADDRGP4 UseScriptBuffer
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 ScriptBuffer
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunFrameScript
+CALLV
+pop
+ADDRGP4 ScriptBuffer
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 UseScriptBuffer
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $3334
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $3336
+ADDRFP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+CNSTI4 1
+RETI4
+ADDRGP4 $3325
+JUMPV
+LABELV $3336
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $3338
+CNSTI4 1
+RETI4
+ADDRGP4 $3325
+JUMPV
+LABELV $3338
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3342
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $3340
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 52
+ADDRGP4 PC_Script_ParseExt
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $3343
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3314
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $3345
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $3347
+ADDRLP4 4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $3347
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 64
+ADDRGP4 ItemParse_if
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+RETI4
+ADDRGP4 $3325
+JUMPV
+LABELV $3347
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 64
+ADDRGP4 ItemParse_if
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+RETI4
+ADDRGP4 $3325
+JUMPV
+LABELV $3345
+CNSTI4 0
+RETI4
+ADDRGP4 $3325
+JUMPV
+LABELV $3343
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $3349
+ADDRLP4 4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $3349
+ADDRLP4 20
+ADDRGP4 UseScriptBuffer
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 ScriptBuffer
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunFrameScript
+CALLV
+pop
+ADDRGP4 ScriptBuffer
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 UseScriptBuffer
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $3349
+ADDRFP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+CNSTI4 1
+RETI4
+ADDRGP4 $3325
+JUMPV
+LABELV $3340
+CNSTI4 1
+RETI4
+LABELV $3325
+endproc ItemParse_if 68 16
+proc Item_ApplyHacks 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $3352
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3352
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $3354
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $3352
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 48
+GEI4 $3355
+ADDRGP4 $3357
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 48
+ASGNI4
+LABELV $3355
+LABELV $3352
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $3358
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3358
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $3360
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3362
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $3361
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3358
+LABELV $3362
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 32
+GEI4 $3363
+ADDRLP4 32
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LEI4 $3365
+ADDRLP4 36
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3365
+ADDRGP4 $3367
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 32
+ASGNI4
+LABELV $3363
+LABELV $3358
+LABELV $3351
+endproc Item_ApplyHacks 40 12
+proc Item_Parse 2080 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $3369
+CNSTI4 0
+RETI4
+ADDRGP4 $3368
+JUMPV
+LABELV $3369
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3371
+CNSTI4 0
+RETI4
+ADDRGP4 $3368
+JUMPV
+LABELV $3371
+ADDRGP4 UseScriptBuffer
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3375
+JUMPV
+LABELV $3374
+LABELV $3377
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $3382
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $3380
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $3368
+JUMPV
+LABELV $3381
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 2076
+ADDRGP4 ItemParse_if
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $3385
+CNSTI4 0
+RETI4
+ADDRGP4 $3368
+JUMPV
+LABELV $3385
+ADDRLP4 1052
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3387
+ADDRGP4 $3377
+JUMPV
+LABELV $3387
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1052
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $3382
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $3314
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $3381
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $3391
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_ApplyHacks
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $3368
+JUMPV
+LABELV $3391
+ADDRGP4 itemParseKeywordHash
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1056
+ADDRGP4 KeywordHash_Find
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3395
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $3397
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRGP4 $3375
+JUMPV
+LABELV $3395
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $3399
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $3401
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $3368
+JUMPV
+LABELV $3399
+LABELV $3375
+ADDRGP4 $3374
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3368
+endproc Item_Parse 2080 16
+proc Item_InitControls 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3404
+ADDRGP4 $3403
+JUMPV
+LABELV $3404
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $3406
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3408
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $3408
+LABELV $3406
+LABELV $3403
+endproc Item_InitControls 4 0
+proc MenuParse_font 12 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3411
+CNSTI4 0
+RETI4
+ADDRGP4 $3410
+JUMPV
+LABELV $3411
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5634040
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3413
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 48
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 248
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5634040
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $3413
+CNSTI4 1
+RETI4
+LABELV $3410
+endproc MenuParse_font 12 12
+proc MenuParse_name 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3416
+CNSTI4 0
+RETI4
+ADDRGP4 $3415
+JUMPV
+LABELV $3416
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $3420
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $3418
+LABELV $3418
+CNSTI4 1
+RETI4
+LABELV $3415
+endproc MenuParse_name 12 8
+proc MenuParse_fullscreen 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $3423
+CNSTI4 0
+RETI4
+ADDRGP4 $3421
+JUMPV
+LABELV $3423
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $3421
+endproc MenuParse_fullscreen 12 8
+proc MenuParse_rect 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3426
+CNSTI4 0
+RETI4
+ADDRGP4 $3425
+JUMPV
+LABELV $3426
+CNSTI4 1
+RETI4
+LABELV $3425
+endproc MenuParse_rect 8 8
+proc MenuParse_style 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3429
+CNSTI4 0
+RETI4
+ADDRGP4 $3428
+JUMPV
+LABELV $3429
+CNSTI4 1
+RETI4
+LABELV $3428
+endproc MenuParse_style 8 8
+proc MenuParse_visible 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $3432
+CNSTI4 0
+RETI4
+ADDRGP4 $3431
+JUMPV
+LABELV $3432
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $3434
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $3435
+JUMPV
+LABELV $3434
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+LABELV $3435
+CNSTI4 1
+RETI4
+LABELV $3431
+endproc MenuParse_visible 16 8
+proc MenuParse_onOpen 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3437
+CNSTI4 0
+RETI4
+ADDRGP4 $3436
+JUMPV
+LABELV $3437
+CNSTI4 1
+RETI4
+LABELV $3436
+endproc MenuParse_onOpen 8 8
+proc MenuParse_onClose 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3440
+CNSTI4 0
+RETI4
+ADDRGP4 $3439
+JUMPV
+LABELV $3440
+CNSTI4 1
+RETI4
+LABELV $3439
+endproc MenuParse_onClose 8 8
+proc MenuParse_onESC 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3443
+CNSTI4 0
+RETI4
+ADDRGP4 $3442
+JUMPV
+LABELV $3443
+CNSTI4 1
+RETI4
+LABELV $3442
+endproc MenuParse_onESC 8 8
+proc MenuParse_border 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3446
+CNSTI4 0
+RETI4
+ADDRGP4 $3445
+JUMPV
+LABELV $3446
+CNSTI4 1
+RETI4
+LABELV $3445
+endproc MenuParse_border 8 8
+proc MenuParse_borderSize 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3449
+CNSTI4 0
+RETI4
+ADDRGP4 $3448
+JUMPV
+LABELV $3449
+CNSTI4 1
+RETI4
+LABELV $3448
+endproc MenuParse_borderSize 8 8
+proc MenuParse_backcolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3452
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3456
+CNSTI4 0
+RETI4
+ADDRGP4 $3451
+JUMPV
+LABELV $3456
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $3453
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $3452
+CNSTI4 1
+RETI4
+LABELV $3451
+endproc MenuParse_backcolor 16 8
+proc MenuParse_forecolor 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3459
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3463
+CNSTI4 0
+RETI4
+ADDRGP4 $3458
+JUMPV
+LABELV $3463
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $3460
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $3459
+CNSTI4 1
+RETI4
+LABELV $3458
+endproc MenuParse_forecolor 20 8
+proc MenuParse_bordercolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3466
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3470
+CNSTI4 0
+RETI4
+ADDRGP4 $3465
+JUMPV
+LABELV $3470
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $3467
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $3466
+CNSTI4 1
+RETI4
+LABELV $3465
+endproc MenuParse_bordercolor 16 8
+proc MenuParse_focuscolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3473
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3477
+CNSTI4 0
+RETI4
+ADDRGP4 $3472
+JUMPV
+LABELV $3477
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $3474
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $3473
+CNSTI4 1
+RETI4
+LABELV $3472
+endproc MenuParse_focuscolor 16 8
+proc MenuParse_disablecolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3480
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3484
+CNSTI4 0
+RETI4
+ADDRGP4 $3479
+JUMPV
+LABELV $3484
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 252
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $3481
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $3480
+CNSTI4 1
+RETI4
+LABELV $3479
+endproc MenuParse_disablecolor 16 8
+proc MenuParse_outlinecolor 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3487
+CNSTI4 0
+RETI4
+ADDRGP4 $3486
+JUMPV
+LABELV $3487
+CNSTI4 1
+RETI4
+LABELV $3486
+endproc MenuParse_outlinecolor 8 8
+proc MenuParse_background 24 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $3490
+CNSTI4 0
+RETI4
+ADDRGP4 $3489
+JUMPV
+LABELV $3490
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $3492
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $3492
+CNSTI4 1
+RETI4
+LABELV $3489
+endproc MenuParse_background 24 8
+proc MenuParse_backgroundReset 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $3494
+endproc MenuParse_backgroundReset 4 0
+proc MenuParse_cinematic 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3496
+CNSTI4 0
+RETI4
+ADDRGP4 $3495
+JUMPV
+LABELV $3496
+CNSTI4 1
+RETI4
+LABELV $3495
+endproc MenuParse_cinematic 8 8
+proc MenuParse_ownerdrawFlag 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $3499
+CNSTI4 0
+RETI4
+ADDRGP4 $3498
+JUMPV
+LABELV $3499
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $3498
+endproc MenuParse_ownerdrawFlag 16 8
+proc MenuParse_ownerdrawFlag2 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $3502
+CNSTI4 0
+RETI4
+ADDRGP4 $3501
+JUMPV
+LABELV $3502
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $3501
+endproc MenuParse_ownerdrawFlag2 16 8
+proc MenuParse_ownerdraw 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3505
+CNSTI4 0
+RETI4
+ADDRGP4 $3504
+JUMPV
+LABELV $3505
+CNSTI4 1
+RETI4
+LABELV $3504
+endproc MenuParse_ownerdraw 8 8
+proc MenuParse_widescreen 12 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4364
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3508
+CNSTI4 0
+RETI4
+ADDRGP4 $3507
+JUMPV
+LABELV $3508
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4364
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $3512
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LEI4 $3510
+LABELV $3512
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $3513
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4364
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4364
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $3510
+CNSTI4 1
+RETI4
+LABELV $3507
+endproc MenuParse_widescreen 12 12
+proc MenuParse_popup 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2097152
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $3514
+endproc MenuParse_popup 8 0
+proc MenuParse_outOfBounds 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 131072
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $3515
+endproc MenuParse_outOfBounds 8 0
+proc MenuParse_soundLoop 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3517
+CNSTI4 0
+RETI4
+ADDRGP4 $3516
+JUMPV
+LABELV $3517
+CNSTI4 1
+RETI4
+LABELV $3516
+endproc MenuParse_soundLoop 8 8
+proc MenuParse_fadeClamp 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3520
+CNSTI4 0
+RETI4
+ADDRGP4 $3519
+JUMPV
+LABELV $3520
+CNSTI4 1
+RETI4
+LABELV $3519
+endproc MenuParse_fadeClamp 8 8
+proc MenuParse_fadeAmount 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3523
+CNSTI4 0
+RETI4
+ADDRGP4 $3522
+JUMPV
+LABELV $3523
+CNSTI4 1
+RETI4
+LABELV $3522
+endproc MenuParse_fadeAmount 8 8
+proc MenuParse_fadeCycle 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3526
+CNSTI4 0
+RETI4
+ADDRGP4 $3525
+JUMPV
+LABELV $3526
+CNSTI4 1
+RETI4
+LABELV $3525
+endproc MenuParse_fadeCycle 8 8
+proc MenuParse_itemDef 48 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 1024
+GEI4 $3529
+CNSTI4 580
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3531
+ADDRGP4 $3533
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $3528
+JUMPV
+LABELV $3531
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Init
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 576
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4364
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Item_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $3534
+CNSTI4 0
+RETI4
+ADDRGP4 $3528
+JUMPV
+LABELV $3534
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_InitControls
+CALLV
+pop
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 240
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $3530
+JUMPV
+LABELV $3529
+ADDRGP4 $3536
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3530
+CNSTI4 1
+RETI4
+LABELV $3528
+endproc MenuParse_itemDef 48 8
+data
+export menuParseKeywords
+align 4
+LABELV menuParseKeywords
+address $3288
+address MenuParse_font
+byte 4 0
+address $3218
+address MenuParse_name
+byte 4 0
+address $3537
+address MenuParse_fullscreen
+byte 4 0
+address $3230
+address MenuParse_rect
+byte 4 0
+address $3231
+address MenuParse_style
+byte 4 0
+address $3248
+address MenuParse_visible
+byte 4 0
+address $3538
+address MenuParse_onOpen
+byte 4 0
+address $3539
+address MenuParse_onClose
+byte 4 0
+address $3540
+address MenuParse_onESC
+byte 4 0
+address $3246
+address MenuParse_border
+byte 4 0
+address $3541
+address MenuParse_borderSize
+byte 4 0
+address $580
+address MenuParse_backcolor
+byte 4 0
+address $583
+address MenuParse_forecolor
+byte 4 0
+address $586
+address MenuParse_bordercolor
+byte 4 0
+address $3542
+address MenuParse_focuscolor
+byte 4 0
+address $3543
+address MenuParse_disablecolor
+byte 4 0
+address $3256
+address MenuParse_outlinecolor
+byte 4 0
+address $3257
+address MenuParse_background
+byte 4 0
+address $3258
+address MenuParse_backgroundReset
+byte 4 0
+address $3249
+address MenuParse_ownerdraw
+byte 4 0
+address $3277
+address MenuParse_ownerdrawFlag
+byte 4 0
+address $3278
+address MenuParse_ownerdrawFlag2
+byte 4 0
+address $3544
+address MenuParse_outOfBounds
+byte 4 0
+address $3545
+address MenuParse_soundLoop
+byte 4 0
+address $3546
+address MenuParse_itemDef
+byte 4 0
+address $3284
+address MenuParse_cinematic
+byte 4 0
+address $3547
+address MenuParse_popup
+byte 4 0
+address $3548
+address MenuParse_fadeClamp
+byte 4 0
+address $3549
+address MenuParse_fadeCycle
+byte 4 0
+address $3550
+address MenuParse_fadeAmount
+byte 4 0
+address $795
+address ItemParse_setVar
+byte 4 0
+address $3292
+address MenuParse_widescreen
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+code
+proc Menu_SetupKeywordHash 4 12
+ADDRGP4 menuParseKeywordHash
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3555
+JUMPV
+LABELV $3552
+ADDRGP4 menuParseKeywordHash
+ARGP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 menuParseKeywords
+ADDP4
+ARGP4
+ADDRGP4 KeywordHash_Add
+CALLV
+pop
+LABELV $3553
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3555
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 menuParseKeywords
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3552
+LABELV $3551
+endproc Menu_SetupKeywordHash 4 12
+proc Menu_Parse 1060 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $3557
+CNSTI4 0
+RETI4
+ADDRGP4 $3556
+JUMPV
+LABELV $3557
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3563
+CNSTI4 0
+RETI4
+ADDRGP4 $3556
+JUMPV
+LABELV $3562
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1040
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $3565
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $3567
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $3556
+JUMPV
+LABELV $3565
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $3568
+CNSTI4 1
+RETI4
+ADDRGP4 $3556
+JUMPV
+LABELV $3568
+ADDRGP4 menuParseKeywordHash
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 KeywordHash_Find
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3572
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $3574
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRGP4 $3563
+JUMPV
+LABELV $3572
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $3576
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $3578
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $3556
+JUMPV
+LABELV $3576
+LABELV $3563
+ADDRGP4 $3562
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3556
+endproc Menu_Parse 1060 12
+export Menu_New
+proc Menu_New 12 8
+ADDRLP4 0
+CNSTI4 4368
+ADDRGP4 menuCount
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ASGNP4
+ADDRGP4 menuCount
+INDIRI4
+CNSTI4 512
+GEI4 $3581
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_Init
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menu_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3582
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_PostParse
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 menuCount
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3582
+JUMPV
+LABELV $3581
+ADDRGP4 $3585
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3582
+LABELV $3580
+endproc Menu_New 12 8
+export Menu_Count
+proc Menu_Count 0 0
+ADDRGP4 menuCount
+INDIRI4
+RETI4
+LABELV $3586
+endproc Menu_Count 0 0
+export Menu_HandleCapture
+proc Menu_HandleCapture 0 4
+ADDRGP4 captureFunc
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3588
+ADDRGP4 captureData
+INDIRP4
+ARGP4
+ADDRGP4 captureFunc
+INDIRP4
+CALLV
+pop
+LABELV $3588
+LABELV $3587
+endproc Menu_HandleCapture 0 4
+lit
+align 4
+LABELV $3597
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export Menu_PaintAll
+code
+proc Menu_PaintAll 64 44
+ADDRGP4 Menu_HandleCapture
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3594
+JUMPV
+LABELV $3591
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+LABELV $3592
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3594
+ADDRLP4 4
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $3591
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $3595
+ADDRLP4 8
+ADDRGP4 $3597
+INDIRB
+ASGNB 16
+ADDRLP4 24
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 16
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $3598
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 5653772
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTF4 1084227584
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1056964608
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRLP4 24
+INDIRB
+ASGNB 16
+ADDRLP4 40
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $3595
+LABELV $3590
+endproc Menu_PaintAll 64 44
+export Menu_Reset
+proc Menu_Reset 0 4
+ADDRGP4 $3600
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 menuCount
+CNSTI4 0
+ASGNI4
+LABELV $3599
+endproc Menu_Reset 0 4
+export Display_GetContext
+proc Display_GetContext 0 0
+ADDRGP4 DC
+INDIRP4
+RETP4
+LABELV $3601
+endproc Display_GetContext 0 0
+export Display_CaptureItem
+proc Display_CaptureItem 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3606
+JUMPV
+LABELV $3603
+ADDRLP4 4
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+4364
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $3607
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+RETP4
+ADDRGP4 $3602
+JUMPV
+LABELV $3607
+LABELV $3604
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3606
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $3603
+CNSTP4 0
+RETP4
+LABELV $3602
+endproc Display_CaptureItem 12 16
+export Display_MouseMove
+proc Display_MouseMove 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3611
+ADDRLP4 8
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3613
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $3615
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $3610
+JUMPV
+LABELV $3615
+LABELV $3613
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3620
+JUMPV
+LABELV $3617
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+LABELV $3618
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3620
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $3617
+ADDRGP4 $3612
+JUMPV
+LABELV $3611
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menu_UpdatePosition
+CALLV
+pop
+LABELV $3612
+CNSTI4 1
+RETI4
+LABELV $3610
+endproc Display_MouseMove 16 12
+export Display_CursorType
+proc Display_CursorType 36 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3625
+JUMPV
+LABELV $3622
+ADDRLP4 20
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 Menus
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 Menus+4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1088421888
+ASGNF4
+ADDRLP4 4+12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+4364
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $3630
+CNSTI4 4
+RETI4
+ADDRGP4 $3621
+JUMPV
+LABELV $3630
+LABELV $3623
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3625
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $3622
+CNSTI4 2
+RETI4
+LABELV $3621
+endproc Display_CursorType 36 16
+export Display_HandleKey
+proc Display_HandleKey 12 12
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Display_CaptureItem
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3634
+ADDRLP4 8
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $3634
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3636
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Menu_HandleKey
+CALLV
+pop
+LABELV $3636
+LABELV $3633
+endproc Display_HandleKey 12 12
+proc Window_CacheContents 32 28
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3639
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3641
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ADDRGP4 DC
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $3641
+LABELV $3639
+LABELV $3638
+endproc Window_CacheContents 32 28
+proc Item_CacheContents 0 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3644
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_CacheContents
+CALLV
+pop
+LABELV $3644
+LABELV $3643
+endproc Item_CacheContents 0 4
+proc Menu_CacheContents 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3647
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_CacheContents
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3652
+JUMPV
+LABELV $3649
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_CacheContents
+CALLV
+pop
+LABELV $3650
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3652
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $3649
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3653
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3653
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRP4
+CALLI4
+pop
+LABELV $3653
+LABELV $3647
+LABELV $3646
+endproc Menu_CacheContents 8 8
+export Display_CacheAll
+proc Display_CacheAll 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3659
+JUMPV
+LABELV $3656
+CNSTI4 4368
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRGP4 Menu_CacheContents
+CALLV
+pop
+LABELV $3657
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3659
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $3656
+LABELV $3655
+endproc Display_CacheAll 4 4
+proc Menu_OverActiveItem 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3661
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+EQI4 $3661
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4364
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $3663
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3668
+JUMPV
+LABELV $3665
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+NEI4 $3669
+ADDRGP4 $3666
+JUMPV
+LABELV $3669
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $3671
+ADDRGP4 $3666
+JUMPV
+LABELV $3671
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3673
+ADDRLP4 24
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3675
+ADDRLP4 24
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3675
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 Rect_ContainsWidescreenPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $3666
+CNSTI4 1
+RETI4
+ADDRGP4 $3660
+JUMPV
+LABELV $3675
+CNSTI4 1
+RETI4
+ADDRGP4 $3660
+JUMPV
+LABELV $3673
+LABELV $3666
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3668
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+LTI4 $3665
+LABELV $3663
+LABELV $3661
+CNSTI4 0
+RETI4
+LABELV $3660
+endproc Menu_OverActiveItem 40 16
+import powf
+import acos
+import round
+bss
+export menuParseKeywordHash
+align 4
+LABELV menuParseKeywordHash
+skip 2048
+export itemParseKeywordHash
+align 4
+LABELV itemParseKeywordHash
+skip 2048
+export g_nameBind2
+align 1
+LABELV g_nameBind2
+skip 32
+export g_nameBind1
+align 1
+LABELV g_nameBind1
+skip 32
+align 4
+LABELV strHandle
+skip 8192
+align 1
+LABELV strPool
+skip 2097152
+align 4
+LABELV outOfMemory
+skip 4
+align 4
+LABELV allocPoint
+skip 4
+align 1
+LABELV memoryPool
+skip 2097152
+export menuStack
+align 4
+LABELV menuStack
+skip 1024
+export Menus
+align 4
+LABELV Menus
+skip 2236416
+align 4
+LABELV scrollInfo
+skip 32
+align 4
+LABELV menuVars
+skip 8704
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Display_ExpandMacros
+import Q_GetUtf8FromCp
+import Q_GetCpFromUtf8
+import Q_PrintSubString
+import VectorCheck
+import Crash
+import DayAbbrev
+import MonthAbbrev
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKeyExt
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_ParseClockTime
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isAnInteger
+import Q_isanumber
+import Q_isdigit
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_SetColorTable
+import Q_SetColors
+import Q_fmodf
+import Q_floatIsNan
+import VectorReflect
+import VectorStartEndDir
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import PointToPlane
+import ProjectPointOnPlane
+import ProjectPointOntoVector
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AngleAdd
+import AnglesSubtract
+import AngleSubtract
+import LerpAngleNear
+import LerpAngles
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import AngleBetweenVectors
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import VectorGetScale
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table_q3
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $3600
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3598
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $3585
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 78
+byte 1 85
+byte 1 83
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3578
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3574
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3567
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $3550
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 65
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3549
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3548
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $3547
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $3546
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $3545
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 76
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $3544
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 79
+byte 1 102
+byte 1 66
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $3543
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $3542
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $3541
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $3540
+byte 1 111
+byte 1 110
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 0
+align 1
+LABELV $3539
+byte 1 111
+byte 1 110
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $3538
+byte 1 111
+byte 1 110
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $3537
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $3536
+byte 1 94
+byte 1 49
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 45
+byte 1 62
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 78
+byte 1 85
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3533
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3513
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $3420
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3401
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3397
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3380
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $3367
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3361
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3360
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3357
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 118
+byte 1 54
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3354
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $3342
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $3324
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3321
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3314
+byte 1 105
+byte 1 102
+byte 1 0
+align 1
+LABELV $3304
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $3301
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $3292
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $3291
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $3290
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $3289
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $3288
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3287
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 73
+byte 1 100
+byte 1 0
+align 1
+LABELV $3286
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3285
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $3284
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $3283
+byte 1 104
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $3282
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $3281
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $3280
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3279
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $3278
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 0
+align 1
+LABELV $3277
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3276
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $3275
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3274
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $3273
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3272
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $3271
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $3270
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $3269
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $3268
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $3267
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $3266
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $3265
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $3264
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $3263
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $3262
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $3261
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3260
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $3259
+byte 1 111
+byte 1 110
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $3258
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $3257
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $3256
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $3255
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3254
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3253
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $3252
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 120
+byte 1 0
+align 1
+LABELV $3251
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $3250
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $3249
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $3248
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3247
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $3246
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3245
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $3244
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $3243
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3242
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $3241
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $3240
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $3239
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $3238
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $3237
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $3236
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 122
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $3235
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 119
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3234
+byte 1 119
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3233
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3232
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $3231
+byte 1 115
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3230
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $3229
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3228
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $3227
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 121
+byte 1 0
+align 1
+LABELV $3226
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 120
+byte 1 0
+align 1
+LABELV $3225
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3224
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3223
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $3222
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $3221
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $3220
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $3219
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $3218
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3217
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $3210
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3196
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 40
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 79
+byte 1 112
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3192
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $3020
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $3000
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2963
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2949
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2944
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2939
+byte 1 94
+byte 1 51
+byte 1 113
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 47
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $2928
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $2924
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2920
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2916
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2912
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2909
+byte 1 112
+byte 1 105
+byte 1 0
+align 1
+LABELV $2906
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $2903
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $2900
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $2897
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $2894
+byte 1 97
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2891
+byte 1 97
+byte 1 99
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $2888
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $2885
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $2882
+byte 1 99
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $2879
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2876
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2873
+byte 1 99
+byte 1 101
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $2870
+byte 1 115
+byte 1 113
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $2817
+byte 1 113
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 91
+byte 1 48
+byte 1 93
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2772
+byte 1 81
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $2765
+byte 1 94
+byte 1 51
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 78
+byte 1 84
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $2756
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2752
+byte 1 113
+byte 1 51
+byte 1 103
+byte 1 105
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2751
+byte 1 113
+byte 1 51
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 0
+align 1
+LABELV $2750
+byte 1 113
+byte 1 51
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $2749
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $2746
+byte 1 113
+byte 1 108
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2741
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 46
+byte 1 116
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $2739
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 105
+byte 1 100
+byte 1 115
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 46
+byte 1 116
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $2737
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 45
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $2700
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 67
+byte 1 79
+byte 1 76
+byte 1 79
+byte 1 82
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 78
+byte 1 71
+byte 1 69
+byte 1 83
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2692
+byte 1 99
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 58
+byte 1 54
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 0
+align 1
+LABELV $2691
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 77
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 73
+byte 1 95
+byte 1 67
+byte 1 86
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $2664
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 77
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 73
+byte 1 95
+byte 1 67
+byte 1 86
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $2649
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $2633
+byte 1 94
+byte 1 53
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 10
+byte 1 0
+align 1
+LABELV $2501
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 110
+byte 1 115
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 62
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 76
+byte 1 66
+byte 1 95
+byte 1 67
+byte 1 79
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 78
+byte 1 83
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $2421
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2409
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 39
+byte 1 125
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $2406
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2400
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $2392
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 99
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $2386
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2383
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2375
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $2370
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 10
+byte 1 0
+align 1
+LABELV $2253
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $2248
+byte 1 99
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 58
+byte 1 53
+byte 1 48
+byte 1 57
+byte 1 53
+byte 1 0
+align 1
+LABELV $2247
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 79
+byte 1 80
+byte 1 69
+byte 1 78
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 78
+byte 1 85
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $2246
+byte 1 99
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 58
+byte 1 53
+byte 1 48
+byte 1 57
+byte 1 51
+byte 1 0
+align 1
+LABELV $2245
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $2184
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 84
+byte 1 89
+byte 1 80
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 76
+byte 1 73
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 79
+byte 1 76
+byte 1 79
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $2074
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 79
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $2004
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $2003
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1992
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1991
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1872
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $1847
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 83
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 45
+byte 1 62
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1844
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 83
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1840
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $1839
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $1809
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1776
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $1775
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $1774
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $1773
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1772
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1771
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $1770
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1769
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1768
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1767
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1766
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1765
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1764
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 79
+byte 1 119
+byte 1 110
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1763
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 69
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $1762
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1761
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1760
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $1759
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 80
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $1758
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1757
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1756
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 121
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1755
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1754
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1753
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1752
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1751
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 52
+byte 1 0
+align 1
+LABELV $1750
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $1749
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $1748
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $1747
+byte 1 43
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1746
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $1745
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $1744
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $1743
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $1742
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 57
+byte 1 0
+align 1
+LABELV $1741
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 56
+byte 1 0
+align 1
+LABELV $1740
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 55
+byte 1 0
+align 1
+LABELV $1739
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 54
+byte 1 0
+align 1
+LABELV $1738
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 53
+byte 1 0
+align 1
+LABELV $1737
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 52
+byte 1 0
+align 1
+LABELV $1736
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $1735
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 50
+byte 1 0
+align 1
+LABELV $1734
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $1733
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1732
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $1731
+byte 1 43
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $1730
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1729
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1728
+byte 1 43
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $1727
+byte 1 43
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1726
+byte 1 43
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $1725
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1724
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1723
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1722
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $1721
+byte 1 43
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1720
+byte 1 43
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $1719
+byte 1 43
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1718
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $1717
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1698
+byte 1 78
+byte 1 111
+byte 1 0
+align 1
+LABELV $1697
+byte 1 89
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1422
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 72
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 32
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 84
+byte 1 89
+byte 1 80
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 76
+byte 1 73
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 79
+byte 1 76
+byte 1 79
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $1364
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 84
+byte 1 89
+byte 1 80
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 76
+byte 1 73
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 79
+byte 1 76
+byte 1 79
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $1211
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $1150
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $924
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 66
+byte 1 111
+byte 1 120
+byte 1 95
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 66
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $915
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 83
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $799
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $798
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $797
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $796
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $795
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $794
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $793
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $792
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $791
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $790
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $789
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $788
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $787
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $786
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $785
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $784
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $783
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $782
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $781
+byte 1 104
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $780
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $779
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $778
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $769
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 0
+align 1
+LABELV $763
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $760
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $753
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $749
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $586
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $583
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $580
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $528
+byte 1 94
+byte 1 49
+byte 1 82
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $379
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $374
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $368
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $361
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 39
+byte 1 40
+byte 1 39
+byte 1 32
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $357
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $347
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $342
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $339
+byte 1 41
+byte 1 0
+align 1
+LABELV $336
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $330
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 39
+byte 1 40
+byte 1 39
+byte 1 32
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $329
+byte 1 40
+byte 1 0
+align 1
+LABELV $326
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $312
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $307
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $301
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $293
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 39
+byte 1 123
+byte 1 39
+byte 1 32
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $287
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $278
+byte 1 32
+byte 1 0
+align 1
+LABELV $277
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $272
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $267
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $264
+byte 1 125
+byte 1 0
+align 1
+LABELV $261
+byte 1 112
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $260
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $257
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $251
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 39
+byte 1 123
+byte 1 39
+byte 1 32
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $248
+byte 1 123
+byte 1 0
+align 1
+LABELV $245
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $239
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $230
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $224
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $212
+byte 1 94
+byte 1 49
+byte 1 82
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $201
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $195
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $190
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 32
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $186
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $185
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $174
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $164
+byte 1 94
+byte 1 49
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $155
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $149
+byte 1 94
+byte 1 49
+byte 1 80
+byte 1 67
+byte 1 95
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $143
+byte 1 94
+byte 1 49
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $142
+byte 1 94
+byte 1 49
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $120
+byte 1 94
+byte 1 51
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $112
+byte 1 94
+byte 1 51
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 78
+byte 1 85
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $111
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $98
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $94
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $83
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $82
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $81
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $80
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 47
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 10
+byte 1 0
+align 1
+LABELV $78
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $59
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 112
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $56
+byte 1 0
+align 1
+LABELV $47
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 33
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 43
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
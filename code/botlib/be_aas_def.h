@@ -258,6 +258,9 @@ typedef struct aas_s
 	//cache list sorted on time
 	aas_routingcache_t *oldestcache;		// start of cache list sorted on time
 	aas_routingcache_t *newestcache;		// end of cache list sorted on time
+	//block with the routing cache read from or built for the route cache file
+	char *routecacheblock;
+	int routecacheblocksize;
 	//maximum travel time through portal areas
 	int *portalmaxtraveltimes;
 	//areas the reachabilities go through
@@ -58,6 +58,9 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 //maximum number of routing updates each frame
 #define MAX_FRAMEROUTINGUPDATES		10
 
+//maximum number of threads building the route cache
+#define MAX_ROUTECACHETHREADS		16
+
 
 /*
 
@@ -127,6 +130,20 @@ static ID_INLINE int AAS_ClusterAreaNum(int cluster, int areanum)
 	} //end else
 } //end of the function AAS_ClusterAreaNum
 //===========================================================================
+// returns true if the cache is stored in the route cache block, those
+// caches are never freed on their own
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static ID_INLINE qboolean AAS_RoutingCacheInBlock(aas_routingcache_t *cache)
+{
+	if (!aasworld.routecacheblock) return qfalse;
+	return (char *) cache >= aasworld.routecacheblock &&
+			(char *) cache < aasworld.routecacheblock + aasworld.routecacheblocksize;
+} //end of the function AAS_RoutingCacheInBlock
+//===========================================================================
 //
 // Parameter:			-
 // Returns:				-
@@ -235,6 +252,8 @@ void AAS_LinkCache(aas_routingcache_t *cache)
 void AAS_FreeRoutingCache(aas_routingcache_t *cache)
 {
 	AAS_UnlinkCache(cache);
+	//the route cache block is freed as a whole
+	if (AAS_RoutingCacheInBlock(cache)) return;
 	routingcachesize -= cache->size;
 	FreeMemory(cache);
 } //end of the function AAS_FreeRoutingCache
@@ -704,6 +723,10 @@ int AAS_FreeOldestCache(void)
 		if (cache->type == CACHETYPE_AREA && aasworld.areasettings[cache->areanum].cluster < 0) {
 			continue;
 		}
+		// freeing cache from the route cache block doesn't give back any memory
+		if (AAS_RoutingCacheInBlock(cache)) {
+			continue;
+		}
 		break;
 	}
 	if (cache) {
@@ -733,15 +756,25 @@ int AAS_FreeOldestCache(void)
 // Returns:				-
 // Changes Globals:		-
 //===========================================================================
+static int AAS_RoutingCacheSize(int numtraveltimes)
+{
+	return sizeof(aas_routingcache_t)
+				+ numtraveltimes * sizeof(unsigned short int)
+				+ numtraveltimes * sizeof(unsigned char);
+} //end of the function AAS_RoutingCacheSize
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
 aas_routingcache_t *AAS_AllocRoutingCache(int numtraveltimes)
 {
 	aas_routingcache_t *cache;
 	int size;
 
 	//
-	size = sizeof(aas_routingcache_t)
-						+ numtraveltimes * sizeof(unsigned short int)
-						+ numtraveltimes * sizeof(unsigned char);
+	size = AAS_RoutingCacheSize(numtraveltimes);
 	//
 	routingcachesize += size;
 	//
@@ -930,11 +963,27 @@ typedef struct routecacheheader_s
 } routecacheheader_t;
 
 #define RCID						(('C'<<24)+('R'<<16)+('E'<<8)+'M')
-#define RCVERSION					2
+#define RCVERSION					3
+//every cache in the dump starts at a multiple of this so the dump can be used in place
+#define RCALIGN						8
 
 //void AAS_DecompressVis(byte *in, int numareas, byte *decompressed);
 //int AAS_CompressVis(byte *vis, int numareas, byte *dest);
 
+static int AAS_WriteCache(aas_routingcache_t *cache, fileHandle_t fp)
+{
+	static const char padding[RCALIGN];
+	int size;
+
+	size = PAD(cache->size, RCALIGN);
+	botimport.FS_Write(cache, cache->size, fp);
+	if (size > cache->size)
+	{
+		botimport.FS_Write(padding, size - cache->size, fp);
+	} //end if
+	return size;
+} //end of the function AAS_WriteCache
+
 void AAS_WriteRouteCache(void)
 {
 	int i, j, numportalcache, numareacache, totalsize;
@@ -990,8 +1039,7 @@ void AAS_WriteRouteCache(void)
 	{
 		for (cache = aasworld.portalcache[i]; cache; cache = cache->next)
 		{
-			botimport.FS_Write(cache, cache->size, fp);
-			totalsize += cache->size;
+			totalsize += AAS_WriteCache(cache, fp);
 		} //end for
 	} //end for
 	for (i = 0; i < aasworld.numclusters; i++)
@@ -1001,8 +1049,7 @@ void AAS_WriteRouteCache(void)
 		{
 			for (cache = aasworld.clusterareacache[i][j]; cache; cache = cache->next)
 			{
-				botimport.FS_Write(cache, cache->size, fp);
-				totalsize += cache->size;
+				totalsize += AAS_WriteCache(cache, fp);
 			} //end for
 		} //end for
 	} //end for
@@ -1032,108 +1079,174 @@ void AAS_WriteRouteCache(void)
 // Returns:				-
 // Changes Globals:		-
 //===========================================================================
-aas_routingcache_t *AAS_ReadCache(fileHandle_t fp)
+static void AAS_AddAreaRoutingCache(aas_routingcache_t *cache)
 {
-	int size;
-	aas_routingcache_t *cache;
+	int clusterareanum;
 
-	botimport.FS_Read(&size, sizeof(size), fp);
-	cache = (aas_routingcache_t *) GetMemory(size);
-	cache->size = size;
-	botimport.FS_Read((unsigned char *)cache + sizeof(size), size - sizeof(size), fp);
-	cache->reachabilities = (unsigned char *) cache + sizeof(aas_routingcache_t) - sizeof(unsigned short) +
-		(size - sizeof(aas_routingcache_t) + sizeof(unsigned short)) / 3 * 2;
-	return cache;
-} //end of the function AAS_ReadCache
+	clusterareanum = AAS_ClusterAreaNum(cache->cluster, cache->areanum);
+	cache->prev = NULL;
+	cache->next = aasworld.clusterareacache[cache->cluster][clusterareanum];
+	if (cache->next) cache->next->prev = cache;
+	aasworld.clusterareacache[cache->cluster][clusterareanum] = cache;
+} //end of the function AAS_AddAreaRoutingCache
 //===========================================================================
 //
 // Parameter:			-
 // Returns:				-
 // Changes Globals:		-
 //===========================================================================
+static void AAS_AddPortalRoutingCache(aas_routingcache_t *cache)
+{
+	cache->prev = NULL;
+	cache->next = aasworld.portalcache[cache->areanum];
+	if (cache->next) cache->next->prev = cache;
+	aasworld.portalcache[cache->areanum] = cache;
+} //end of the function AAS_AddPortalRoutingCache
+//===========================================================================
+// returns the number of travel times stored in a cache from a route cache
+// dump or -1 if the cache doesn't fit the loaded map
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_CacheNumTravelTimes(aas_routingcache_t *cache)
+{
+	int areacluster;
+	aas_portal_t *portal;
+
+	if (cache->areanum <= 0 || cache->areanum >= aasworld.numareas) return -1;
+	if (cache->type == CACHETYPE_PORTAL) return aasworld.numportals;
+	if (cache->type != CACHETYPE_AREA) return -1;
+	if (cache->cluster <= 0 || cache->cluster >= aasworld.numclusters) return -1;
+	//the area has to be in the cluster or be one of its portals
+	areacluster = aasworld.areasettings[cache->areanum].cluster;
+	if (areacluster > 0)
+	{
+		if (areacluster != cache->cluster) return -1;
+	} //end if
+	else
+	{
+		portal = &aasworld.portals[-areacluster];
+		if (portal->frontcluster != cache->cluster && portal->backcluster != cache->cluster) return -1;
+	} //end else
+	if (AAS_ClusterAreaNum(cache->cluster, cache->areanum) >= aasworld.clusters[cache->cluster].numareas) return -1;
+	return aasworld.clusters[cache->cluster].numreachabilityareas;
+} //end of the function AAS_CacheNumTravelTimes
+//===========================================================================
+// links a cache stored in the route cache block
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_LinkBlockCache(aas_routingcache_t *cache, int numtraveltimes)
+{
+	cache->size = PAD(AAS_RoutingCacheSize(numtraveltimes), RCALIGN);
+	cache->reachabilities = (unsigned char *) cache + sizeof(aas_routingcache_t)
+								+ numtraveltimes * sizeof(unsigned short int);
+	cache->time = AAS_RoutingTime();
+	if (cache->type == CACHETYPE_PORTAL) AAS_AddPortalRoutingCache(cache);
+	else AAS_AddAreaRoutingCache(cache);
+	AAS_LinkCache(cache);
+} //end of the function AAS_LinkBlockCache
+//===========================================================================
+// the whole dump is read into a single block and the caches are used
+// where they are in that block
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
 int AAS_ReadRouteCache(void)
 {
-	int i, clusterareanum;//, size;
+	int i, length, size, offset, numcaches, numtraveltimes;
 	fileHandle_t fp;
 	char filename[MAX_QPATH];
 	routecacheheader_t routecacheheader;
 	aas_routingcache_t *cache;
+	char *block;
 
 	Com_sprintf(filename, MAX_QPATH, "maps/%s.rcd", aasworld.mapname);
-	botimport.FS_FOpenFile( filename, &fp, FS_READ );
+	length = botimport.FS_FOpenFile( filename, &fp, FS_READ );
 	if (!fp)
 	{
 		return qfalse;
 	} //end if
+	if (length < (int) sizeof(routecacheheader_t))
+	{
+		botimport.FS_FCloseFile(fp);
+		return qfalse;
+	} //end if
 	botimport.FS_Read(&routecacheheader, sizeof(routecacheheader_t), fp );
 	if (routecacheheader.ident != RCID)
 	{
+		botimport.FS_FCloseFile(fp);
 		AAS_Error("%s is not a route cache dump\n", filename);
 		return qfalse;
 	} //end if
 	if (routecacheheader.version != RCVERSION)
 	{
-		AAS_Error("route cache dump has wrong version %d, should be %d\n", routecacheheader.version, RCVERSION);
+		//not fatal, the dump is simply written again
+		botimport.FS_FCloseFile(fp);
+		botimport.Print(PRT_WARNING, "route cache dump has wrong version %d, should be %d\n", routecacheheader.version, RCVERSION);
 		return qfalse;
 	} //end if
-	if (routecacheheader.numareas != aasworld.numareas)
-	{
-		//AAS_Error("route cache dump has wrong number of areas\n");
+	if (routecacheheader.numareas != aasworld.numareas ||
+		routecacheheader.numclusters != aasworld.numclusters ||
+		routecacheheader.areacrc !=
+			CRC_ProcessString( (unsigned char *)aasworld.areas, sizeof(aas_area_t) * aasworld.numareas ) ||
+		routecacheheader.clustercrc !=
+			CRC_ProcessString( (unsigned char *)aasworld.clusters, sizeof(aas_cluster_t) * aasworld.numclusters ))
+	{
+		//the dump is for another version of the map
+		botimport.FS_FCloseFile(fp);
 		return qfalse;
 	} //end if
-	if (routecacheheader.numclusters != aasworld.numclusters)
+	numcaches = routecacheheader.numportalcache + routecacheheader.numareacache;
+	size = length - sizeof(routecacheheader_t);
+	if (numcaches <= 0 || size <= 0)
 	{
-		//AAS_Error("route cache dump has wrong number of clusters\n");
+		botimport.FS_FCloseFile(fp);
 		return qfalse;
 	} //end if
-	if (routecacheheader.areacrc !=
-		CRC_ProcessString( (unsigned char *)aasworld.areas, sizeof(aas_area_t) * aasworld.numareas ))
+	if (size > AvailableMemory() - 1024 * 1024)
 	{
-		//AAS_Error("route cache dump area CRC incorrect\n");
+		botimport.FS_FCloseFile(fp);
+		botimport.Print(PRT_WARNING, "not enough memory to read %s\n", filename);
 		return qfalse;
 	} //end if
-	if (routecacheheader.clustercrc !=
-		CRC_ProcessString( (unsigned char *)aasworld.clusters, sizeof(aas_cluster_t) * aasworld.numclusters ))
+	block = (char *) GetMemory(size);
+	botimport.FS_Read(block, size, fp);
+	botimport.FS_FCloseFile(fp);
+	//check all the cache before linking any of it
+	for (offset = 0, i = 0; i < numcaches; i++)
+	{
+		if (offset + (int) sizeof(aas_routingcache_t) > size) break;
+		cache = (aas_routingcache_t *) (block + offset);
+		//portal cache is stored first
+		if ((cache->type == CACHETYPE_PORTAL) != (i < routecacheheader.numportalcache)) break;
+		numtraveltimes = AAS_CacheNumTravelTimes(cache);
+		if (numtraveltimes < 0) break;
+		if (PAD(cache->size, RCALIGN) != PAD(AAS_RoutingCacheSize(numtraveltimes), RCALIGN)) break;
+		offset += PAD(cache->size, RCALIGN);
+		if (offset > size) break;
+	} //end for
+	if (i < numcaches)
 	{
-		//AAS_Error("route cache dump cluster CRC incorrect\n");
+		FreeMemory(block);
+		botimport.Print(PRT_WARNING, "%s is corrupt\n", filename);
 		return qfalse;
 	} //end if
-	//read all the portal cache
-	for (i = 0; i < routecacheheader.numportalcache; i++)
-	{
-		cache = AAS_ReadCache(fp);
-		cache->next = aasworld.portalcache[cache->areanum];
-		cache->prev = NULL;
-		if (aasworld.portalcache[cache->areanum])
-			aasworld.portalcache[cache->areanum]->prev = cache;
-		aasworld.portalcache[cache->areanum] = cache;
-	} //end for
-	//read all the cluster area cache
-	for (i = 0; i < routecacheheader.numareacache; i++)
+	aasworld.routecacheblock = block;
+	aasworld.routecacheblocksize = size;
+	for (offset = 0, i = 0; i < numcaches; i++)
 	{
-		cache = AAS_ReadCache(fp);
-		clusterareanum = AAS_ClusterAreaNum(cache->cluster, cache->areanum);
-		cache->next = aasworld.clusterareacache[cache->cluster][clusterareanum];
-		cache->prev = NULL;
-		if (aasworld.clusterareacache[cache->cluster][clusterareanum])
-			aasworld.clusterareacache[cache->cluster][clusterareanum]->prev = cache;
-		aasworld.clusterareacache[cache->cluster][clusterareanum] = cache;
+		cache = (aas_routingcache_t *) (block + offset);
+		AAS_LinkBlockCache(cache, AAS_CacheNumTravelTimes(cache));
+		offset += cache->size;
 	} //end for
-	// read the visareas
-	/*
-	aasworld.areavisibility = (byte **) GetClearedMemory(aasworld.numareas * sizeof(byte *));
-	aasworld.decompressedvis = (byte *) GetClearedMemory(aasworld.numareas * sizeof(byte));
-	for (i = 0; i < aasworld.numareas; i++)
-	{
-		botimport.FS_Read(&size, sizeof(size), fp );
-		if (size) {
-			aasworld.areavisibility[i] = (byte *) GetMemory(size);
-			botimport.FS_Read(aasworld.areavisibility[i], size, fp );
-		}
-	}
-	*/
-	//
-	botimport.FS_FCloseFile(fp);
+	botimport.Print(PRT_MESSAGE, "read %d bytes of routing cache from %s\n", size, filename);
 	return qtrue;
 } //end of the function AAS_ReadRouteCache
 //===========================================================================
@@ -1244,7 +1357,11 @@ void AAS_InitRouting(void)
 	routingcachesize = 0;
 	max_routingcachesize = 1024 * (int) LibVarValue("max_routingcache", "4096");
 	// read any routing cache if available
-	AAS_ReadRouteCache();
+	if (!AAS_ReadRouteCache())
+	{
+		// build all of it now instead of while the bots are running around
+		if ((int) LibVarValue("buildroutecache", "0")) AAS_BuildRouteCache();
+	} //end if
 } //end of the function AAS_InitRouting
 //===========================================================================
 //
@@ -1258,6 +1375,10 @@ void AAS_FreeRoutingCaches(void)
 	AAS_FreeAllClusterAreaCache();
 	// free all the existing portal cache
 	AAS_FreeAllPortalCache();
+	// free the route cache block after all the cache in it has been unlinked
+	if (aasworld.routecacheblock) FreeMemory(aasworld.routecacheblock);
+	aasworld.routecacheblock = NULL;
+	aasworld.routecacheblocksize = 0;
 	// free cached travel times within areas
 	if (aasworld.areatraveltimes) FreeMemory(aasworld.areatraveltimes);
 	aasworld.areatraveltimes = NULL;
@@ -1289,7 +1410,7 @@ void AAS_FreeRoutingCaches(void)
 // Returns:				-
 // Changes Globals:		-
 //===========================================================================
-void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
+static void AAS_UpdateAreaRoutingCacheList(aas_routingcache_t *areacache, aas_routingupdate_t *areaupdate)
 {
 	int i, nextareanum, cluster, badtravelflags, clusterareanum, linknum;
 	int numreachabilityareas;
@@ -1299,13 +1420,8 @@ void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
 	aas_reversedreachability_t *revreach;
 	aas_reversedlink_t *revlink;
 
-#ifdef ROUTING_DEBUG
-	numareacacheupdates++;
-#endif //ROUTING_DEBUG
 	//number of reachability areas within this cluster
 	numreachabilityareas = aasworld.clusters[areacache->cluster].numreachabilityareas;
-	//
-	aasworld.frameroutingupdates++;
 	//clear the routing update fields
 //	Com_Memset(aasworld.areaupdate, 0, aasworld.numareas * sizeof(aas_routingupdate_t));
 	//
@@ -1316,7 +1432,7 @@ void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
 	//
 	Com_Memset(startareatraveltimes, 0, sizeof(startareatraveltimes));
 	//
-	curupdate = &aasworld.areaupdate[clusterareanum];
+	curupdate = &areaupdate[clusterareanum];
 	curupdate->areanum = areacache->areanum;
 	//VectorCopy(areacache->origin, curupdate->start);
 	curupdate->areatraveltimes = startareatraveltimes;
@@ -1372,7 +1488,7 @@ void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
 			{
 				areacache->traveltimes[clusterareanum] = t;
 				areacache->reachabilities[clusterareanum] = linknum - aasworld.areasettings[nextareanum].firstreachablearea;
-				nextupdate = &aasworld.areaupdate[clusterareanum];
+				nextupdate = &areaupdate[clusterareanum];
 				nextupdate->areanum = nextareanum;
 				nextupdate->tmptraveltime = t;
 				//VectorCopy(reach->start, nextupdate->start);
@@ -1393,6 +1509,23 @@ void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
 			} //end if
 		} //end for
 	} //end while
+} //end of the function AAS_UpdateAreaRoutingCacheList
+//===========================================================================
+// update the given routing cache
+//
+// Parameter:			areacache		: routing cache to update
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
+{
+#ifdef ROUTING_DEBUG
+	numareacacheupdates++;
+#endif //ROUTING_DEBUG
+	//
+	aasworld.frameroutingupdates++;
+	//
+	AAS_UpdateAreaRoutingCacheList(areacache, aasworld.areaupdate);
 } //end of the function AAS_UpdateAreaRoutingCache
 //===========================================================================
 //
@@ -1581,6 +1714,189 @@ aas_routingcache_t *AAS_GetPortalRoutingCache(int clusternum, int areanum, int t
 	return cache;
 } //end of the function AAS_GetPortalRoutingCache
 //===========================================================================
+// area caches only read the AAS data and the update fields given to them,
+// so each thread building the route cache has its own update fields
+//===========================================================================
+typedef struct routecachethread_s
+{
+	aas_routingcache_t **caches;
+	int numcaches;
+	int first;									//first cache updated by this thread
+	int step;
+	aas_routingupdate_t *areaupdate;
+	void *thread;
+} routecachethread_t;
+
+static void AAS_RouteCacheThread(void *arg)
+{
+	routecachethread_t *rt;
+	int i;
+
+	rt = (routecachethread_t *) arg;
+	for (i = rt->first; i < rt->numcaches; i += rt->step)
+	{
+		AAS_UpdateAreaRoutingCacheList(rt->caches[i], rt->areaupdate);
+	} //end for
+} //end of the function AAS_RouteCacheThread
+//===========================================================================
+// builds the routing cache with the default travel flags for the complete
+// map into a single block and writes the route cache dump
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void AAS_BuildRouteCache(void)
+{
+	int i, side, cluster, size, offset, numareacache, numportalcache;
+	int numthreads, maxreachabilityareas, starttime;
+	int *cacheclusters, *cacheareas;
+	aas_routingcache_t *cache, **areacaches;
+	aas_portal_t *portal;
+	routecachethread_t threads[MAX_ROUTECACHETHREADS];
+
+	if (aasworld.routecacheblock) return;
+	//
+	starttime = Sys_MilliSeconds();
+	//every reachability area of a cluster gets an area cache, portals get
+	//one for both clusters they connect
+	cacheclusters = (int *) GetMemory(aasworld.numareas * 2 * sizeof(int));
+	cacheareas = (int *) GetMemory(aasworld.numareas * 2 * sizeof(int));
+	numareacache = 0;
+	size = 0;
+	for (i = 1; i < aasworld.numareas; i++)
+	{
+		cluster = aasworld.areasettings[i].cluster;
+		if (cluster > 0)
+		{
+			if (aasworld.areasettings[i].clusterareanum >= aasworld.clusters[cluster].numreachabilityareas) continue;
+			cacheclusters[numareacache] = cluster;
+			cacheareas[numareacache] = i;
+			numareacache++;
+			size += PAD(AAS_RoutingCacheSize(aasworld.clusters[cluster].numreachabilityareas), RCALIGN);
+			continue;
+		} //end if
+		portal = &aasworld.portals[-cluster];
+		for (side = 0; side < 2; side++)
+		{
+			cluster = side ? portal->backcluster : portal->frontcluster;
+			if (cluster <= 0) continue;
+			if (side && cluster == portal->frontcluster) continue;
+			if (portal->clusterareanum[side] >= aasworld.clusters[cluster].numreachabilityareas) continue;
+			cacheclusters[numareacache] = cluster;
+			cacheareas[numareacache] = i;
+			numareacache++;
+			size += PAD(AAS_RoutingCacheSize(aasworld.clusters[cluster].numreachabilityareas), RCALIGN);
+		} //end for
+	} //end for
+	//every area that can be a goal gets a portal cache
+	numportalcache = 0;
+	for (i = 1; i < aasworld.numareas; i++)
+	{
+		if (AAS_AreaReachability(i)) numportalcache++;
+	} //end for
+	size += numportalcache * PAD(AAS_RoutingCacheSize(aasworld.numportals), RCALIGN);
+	//
+	if (!numareacache || size > AvailableMemory() - 1024 * 1024)
+	{
+		if (numareacache)
+		{
+			botimport.Print(PRT_WARNING, "not enough memory to build the route cache, %d bytes needed\n", size);
+		} //end if
+		FreeMemory(cacheclusters);
+		FreeMemory(cacheareas);
+		return;
+	} //end if
+	aasworld.routecacheblock = (char *) GetClearedMemory(size);
+	aasworld.routecacheblocksize = size;
+	//
+	areacaches = (aas_routingcache_t **) GetMemory(numareacache * sizeof(aas_routingcache_t *));
+	offset = 0;
+	for (i = 0; i < numareacache; i++)
+	{
+		cache = (aas_routingcache_t *) (aasworld.routecacheblock + offset);
+		cache->type = CACHETYPE_AREA;
+		cache->cluster = cacheclusters[i];
+		cache->areanum = cacheareas[i];
+		VectorCopy(aasworld.areas[cache->areanum].center, cache->origin);
+		cache->starttraveltime = 1;
+		cache->travelflags = TFL_DEFAULT;
+		AAS_LinkBlockCache(cache, aasworld.clusters[cache->cluster].numreachabilityareas);
+		areacaches[i] = cache;
+		offset += cache->size;
+	} //end for
+	FreeMemory(cacheclusters);
+	FreeMemory(cacheareas);
+	//
+	maxreachabilityareas = 1;
+	for (i = 0; i < aasworld.numclusters; i++)
+	{
+		if (aasworld.clusters[i].numreachabilityareas > maxreachabilityareas)
+		{
+			maxreachabilityareas = aasworld.clusters[i].numreachabilityareas;
+		} //end if
+	} //end for
+	numthreads = 1;
+	if (botimport.ProcessorCount && botimport.CreateThread && botimport.JoinThread)
+	{
+		numthreads = botimport.ProcessorCount();
+	} //end if
+	if (numthreads < 1) numthreads = 1;
+	if (numthreads > MAX_ROUTECACHETHREADS) numthreads = MAX_ROUTECACHETHREADS;
+	if (numthreads > numareacache) numthreads = numareacache;
+	//the update fields are allocated here, the threads may not allocate memory
+	for (i = 0; i < numthreads; i++)
+	{
+		threads[i].caches = areacaches;
+		threads[i].numcaches = numareacache;
+		threads[i].first = i;
+		threads[i].step = numthreads;
+		threads[i].areaupdate = (aas_routingupdate_t *) GetClearedMemory(
+										maxreachabilityareas * sizeof(aas_routingupdate_t));
+		threads[i].thread = NULL;
+	} //end for
+	for (i = 1; i < numthreads; i++)
+	{
+		threads[i].thread = botimport.CreateThread(AAS_RouteCacheThread, &threads[i]);
+	} //end for
+	AAS_RouteCacheThread(&threads[0]);
+	for (i = 1; i < numthreads; i++)
+	{
+		//run the work of threads that couldn't be started here
+		if (threads[i].thread) botimport.JoinThread(threads[i].thread);
+		else AAS_RouteCacheThread(&threads[i]);
+	} //end for
+	for (i = 0; i < numthreads; i++)
+	{
+		FreeMemory(threads[i].areaupdate);
+	} //end for
+	FreeMemory(areacaches);
+#ifdef ROUTING_DEBUG
+	numareacacheupdates += numareacache;
+#endif //ROUTING_DEBUG
+	//the portal caches use the area caches and are updated one by one
+	for (i = 1; i < aasworld.numareas; i++)
+	{
+		if (!AAS_AreaReachability(i)) continue;
+		cache = (aas_routingcache_t *) (aasworld.routecacheblock + offset);
+		cluster = aasworld.areasettings[i].cluster;
+		//routing towards a portal uses the front cluster
+		if (cluster < 0) cluster = aasworld.portals[-cluster].frontcluster;
+		cache->type = CACHETYPE_PORTAL;
+		cache->cluster = cluster;
+		cache->areanum = i;
+		VectorCopy(aasworld.areas[i].center, cache->origin);
+		cache->starttraveltime = 1;
+		cache->travelflags = TFL_DEFAULT;
+		AAS_LinkBlockCache(cache, aasworld.numportals);
+		AAS_UpdatePortalRoutingCache(cache);
+		offset += cache->size;
+	} //end for
+	botimport.Print(PRT_MESSAGE, "built %d area and %d portal routing caches in %d msec with %d threads\n",
+						numareacache, numportalcache, Sys_MilliSeconds() - starttime, numthreads);
+	AAS_WriteRouteCache();
+} //end of the function AAS_BuildRouteCache
+//===========================================================================
 //
 // Parameter:			-
 // Returns:				-
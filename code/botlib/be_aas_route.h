@@ -39,6 +39,7 @@ unsigned short int AAS_AreaTravelTime(int areanum, vec3_t start, vec3_t end);
 //
 void AAS_CreateAllRoutingCache(void);
 void AAS_WriteRouteCache(void);
+void AAS_BuildRouteCache(void);
 //
 void AAS_RoutingInfo(void);
 #endif //AASINTERN
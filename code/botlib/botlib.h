@@ -203,6 +203,10 @@ typedef struct botlib_import_s
 	//
 	int			(*DebugPolygonCreate)(int color, int numPoints, vec3_t *points);
 	void		(*DebugPolygonDelete)(int id);
+	//threads, code running in a thread may not use any of the other imports
+	int			(*ProcessorCount)(void);
+	void		*(*CreateThread)(void (*func)(void *), void *arg);	// returns NULL on failure
+	void		(*JoinThread)(void *thread);
 } botlib_import_t;
 
 typedef struct aas_export_s
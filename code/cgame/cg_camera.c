@@ -3,6 +3,48 @@
 //#include "cg_q3mme_math.h"
 #include "cg_q3mme_camera.h"  // CAM_ORIGIN, CAM_ANGLES, CAM_FOV
 
+/*
+  The points carrying each of CAM_ORIGIN, CAM_ANGLES and CAM_FOV are kept in
+  time ordered arrays so the spline functions can binary search for their
+  control points instead of walking cg.cameraPointsPointer.  Every origin
+  segment also gets a table of the q3mme arc length stepping, finding the
+  position at a given distance is then a search instead of stepping from
+  the start of the segment.  Both are rebuilt lazily after points change.
+*/
+
+typedef struct {
+	int numPoints;
+	cameraPoint_t *points[MAX_CAMERAPOINTS];
+} cameraPathIndex_t;
+
+static cameraPathIndex_t CameraPathIndex[3];  // origin, angles, fov
+static const cameraPoint_t *CameraPathIndexHead;
+static qboolean CameraPathIndexValid = qfalse;
+static qboolean CameraPathIndexSorted = qfalse;
+
+#define MAX_CAMERA_ARC_SAMPLES (1024 * 256)
+
+typedef struct {
+	float len;  // distance along the segment
+	vec3_t origin;
+} cameraArcSample_t;
+
+typedef struct {
+	int start;  // in CameraArcSamples
+	int count;
+	int generation;
+
+	// what the table was built from
+	vec3_t control[4];
+	posInterpolate_t posType;
+	float smoothPos;
+} cameraArcTable_t;
+
+static cameraArcSample_t CameraArcSamples[MAX_CAMERA_ARC_SAMPLES];
+static int CameraArcSamplesUsed = 0;
+static int CameraArcGeneration = 1;
+static cameraArcTable_t CameraArcTables[MAX_CAMERAPOINTS];
+
 void CG_CameraResetInternalLengths (void)
 {
 	cameraPoint_t *p;
@@ -13,6 +55,54 @@ void CG_CameraResetInternalLengths (void)
 		p->len = -1;
 		p = p->next;
 	}
+
+	CG_CameraPathChanged();
+}
+
+// points were added, removed or relinked
+void CG_CameraPathChanged (void)
+{
+	CameraPathIndexValid = qfalse;
+}
+
+static void wolfcamCameraBuildPathIndex (void)
+{
+	cameraPoint_t *p;
+	cameraPathIndex_t *index;
+	double lastTime;
+	int count;
+	int i;
+
+	for (i = 0;  i < ARRAY_LEN(CameraPathIndex);  i++) {
+		CameraPathIndex[i].numPoints = 0;
+	}
+
+	CameraPathIndexHead = cg.cameraPointsPointer;
+	CameraPathIndexValid = qtrue;
+	CameraPathIndexSorted = qtrue;
+
+	lastTime = 0;
+	count = 0;
+	for (p = cg.cameraPointsPointer;  p;  p = p->next, count++) {
+		if (count >= MAX_CAMERAPOINTS) {
+			// broken list, keep walking it like before
+			CameraPathIndexSorted = qfalse;
+			return;
+		}
+		if (count > 0  &&  p->cgtime < lastTime) {
+			CameraPathIndexSorted = qfalse;
+			return;
+		}
+		lastTime = p->cgtime;
+
+		for (i = 0;  i < ARRAY_LEN(CameraPathIndex);  i++) {
+			if (p->flags & (CAM_ORIGIN << i)) {
+				index = &CameraPathIndex[i];
+				index->points[index->numPoints] = p;
+				index->numPoints++;
+			}
+		}
+	}
 }
 
 // from q3mme
@@ -87,7 +177,7 @@ static qboolean wolfcamCameraMatchOrigin (const cameraPoint_t *match[4], vec3_t
 }
 
 // from q3mme
-static void wolfcamCameraMatchAt (double ftime, int mask, const cameraPoint_t *match[4])
+static void wolfcamCameraMatchAtLinear (double ftime, int mask, const cameraPoint_t *match[4])
 {
 	const cameraPoint_t *p;
 
@@ -117,6 +207,161 @@ static void wolfcamCameraMatchAt (double ftime, int mask, const cameraPoint_t *m
 	match[3] = p;
 }
 
+static void wolfcamCameraMatchAt (double ftime, int mask, const cameraPoint_t *match[4])
+{
+	const cameraPathIndex_t *index;
+	int lo, hi, mid;
+	int tries;
+
+	if (mask == CAM_ORIGIN) {
+		index = &CameraPathIndex[0];
+	} else if (mask == CAM_ANGLES) {
+		index = &CameraPathIndex[1];
+	} else if (mask == CAM_FOV) {
+		index = &CameraPathIndex[2];
+	} else {
+		wolfcamCameraMatchAtLinear(ftime, mask, match);
+		return;
+	}
+
+	for (tries = 0;  tries < 2;  tries++) {
+		if (!CameraPathIndexValid  ||  CameraPathIndexHead != cg.cameraPointsPointer  ||  tries > 0) {
+			wolfcamCameraBuildPathIndex();
+		}
+		if (!CameraPathIndexSorted) {
+			break;
+		}
+
+		// first point later than ftime
+		lo = 0;
+		hi = index->numPoints;
+		while (lo < hi) {
+			mid = (lo + hi) / 2;
+			if (index->points[mid]->cgtime > ftime) {
+				hi = mid;
+			} else {
+				lo = mid + 1;
+			}
+		}
+
+		// points edited without resetting the lengths, rebuild
+		if (lo > 0  &&  (!(index->points[lo - 1]->flags & mask)  ||  index->points[lo - 1]->cgtime > ftime)) {
+			continue;
+		}
+		if (lo < index->numPoints  &&  (!(index->points[lo]->flags & mask)  ||  index->points[lo]->cgtime <= ftime)) {
+			continue;
+		}
+
+		match[0] = lo >= 2 ? index->points[lo - 2] : NULL;
+		match[1] = lo >= 1 ? index->points[lo - 1] : NULL;
+		match[2] = lo < index->numPoints ? index->points[lo] : NULL;
+		match[3] = lo + 1 < index->numPoints ? index->points[lo + 1] : NULL;
+		return;
+	}
+
+	wolfcamCameraMatchAtLinear(ftime, mask, match);
+}
+
+/*
+  Runs the same stepping as the search loop in CG_CameraSplineOriginAt()
+  over the whole segment and stores every step.  Returns the number of
+  samples or -1 if they don't fit.
+*/
+static int wolfcamCameraArcStep (posInterpolate_t posType, const vec3_t control[4], cameraArcSample_t *samples, int maxSamples)
+{
+	vec3_t origin, nextOrigin;
+	float len = 0, step = 0, addStep, distance = 0, deltaDist = 0.01f;
+	int count;
+	int i;
+
+	if (maxSamples < 1) {
+		return -1;
+	}
+
+	posGet(0, posType, control, origin);
+	samples[0].len = 0;
+	VectorCopy(origin, samples[0].origin);
+	count = 1;
+
+	if (cg_q3mmeCameraSmoothPos.value >= 1) {
+		deltaDist = 0.01f / cg_q3mmeCameraSmoothPos.value;
+	}
+
+	while (step < 1) {
+		addStep = 1 - step;
+		if (addStep > 0.01f)
+			addStep = 0.01f;
+		for (i = 0; i < 10; i++) {
+			posGet( step+addStep, posType, control, nextOrigin );
+			distance = VectorDistanceSquared( origin, nextOrigin);
+			if ( distance <= deltaDist)
+				break;
+			addStep *= 0.7f;
+		}
+		distance = sqrt( distance );
+
+		len += distance;
+		step += addStep;
+		VectorCopy( nextOrigin, origin );
+
+		if (count >= maxSamples) {
+			return -1;
+		}
+		samples[count].len = len;
+		VectorCopy(origin, samples[count].origin);
+		count++;
+	}
+
+	return count;
+}
+
+static const cameraArcTable_t *wolfcamCameraArcTable (const cameraPoint_t *point, posInterpolate_t posType, const vec3_t control[4])
+{
+	cameraArcTable_t *table;
+	int pointNum;
+	int count;
+	int i;
+
+	pointNum = point - cg.cameraPoints;
+	if (pointNum < 0  ||  pointNum >= MAX_CAMERAPOINTS) {
+		return NULL;
+	}
+
+	table = &CameraArcTables[pointNum];
+	if (table->generation == CameraArcGeneration  &&  table->posType == posType  &&  table->smoothPos == cg_q3mmeCameraSmoothPos.value  &&
+		VectorCompare(table->control[0], control[0])  &&  VectorCompare(table->control[1], control[1])  &&
+		VectorCompare(table->control[2], control[2])  &&  VectorCompare(table->control[3], control[3])) {
+		return table;
+	}
+
+	count = wolfcamCameraArcStep(posType, control, &CameraArcSamples[CameraArcSamplesUsed], MAX_CAMERA_ARC_SAMPLES - CameraArcSamplesUsed);
+	if (count < 0) {
+		if (CameraArcSamplesUsed == 0) {
+			return NULL;
+		}
+		// out of room, drop every table and start over
+		CameraArcSamplesUsed = 0;
+		CameraArcGeneration++;
+		count = wolfcamCameraArcStep(posType, control, &CameraArcSamples[0], MAX_CAMERA_ARC_SAMPLES);
+		if (count < 0) {
+			return NULL;
+		}
+	}
+
+	table->start = CameraArcSamplesUsed;
+	table->count = count;
+	table->generation = CameraArcGeneration;
+	for (i = 0;  i < 4;  i++) {
+		VectorCopy(control[i], table->control[i]);
+	}
+	table->posType = posType;
+	table->smoothPos = cg_q3mmeCameraSmoothPos.value;
+
+	CameraArcSamplesUsed += count;
+
+	return table;
+}
+
 // from q3mme
 static float wolfcamCameraPointLength (posInterpolate_t posType, cameraPoint_t *point)
 {
@@ -183,6 +428,7 @@ qboolean CG_CameraSplineOriginAt (double ftime, posInterpolate_t posType, vec3_t
 	vec3_t nextOrigin;
 	float len = 0, step = 0, addStep, distance, deltaDist = 0.01f;
 	int	i;
+	const cameraArcTable_t *table;
 
 	//int debugCount;
 	static float LastLen = 0;
@@ -243,6 +489,27 @@ qboolean CG_CameraSplineOriginAt (double ftime, posInterpolate_t posType, vec3_t
 		posType = posBezier;
 	}
 
+	// last sample not past searchLen, same place the stepping below stops
+	table = wolfcamCameraArcTable(match[1], posType, (const vec3_t *)control);
+	if (table) {
+		const cameraArcSample_t *samples;
+		int lo, hi, mid;
+
+		samples = &CameraArcSamples[table->start];
+		lo = 0;
+		hi = table->count - 1;
+		while (lo < hi) {
+			mid = (lo + hi + 1) / 2;
+			if (samples[mid].len > searchLen) {
+				hi = mid - 1;
+			} else {
+				lo = mid;
+			}
+		}
+		VectorCopy(samples[lo].origin, origin);
+		return qtrue;
+	}
+
 	//Com_Printf("calc: %f -> %f (%f)\n", match[1] != NULL ? match[1]->cgtime : -1.0f, ftime, match[1] != NULL ? ftime - match[1]->cgtime : -1.0f);
 	//debugCount = 0;
 
@@ -249,5 +249,6 @@ qboolean CG_CameraSplineFovAt (double ftime, float *fov);
 float CG_CameraAngleLongestDistanceNoRoll (const vec3_t a0, const vec3_t a1);
 float CG_CameraAngleLongestDistanceWithRoll (const vec3_t a0, const vec3_t a1);
 void CG_CameraResetInternalLengths (void);
+void CG_CameraPathChanged (void);
 
 #endif  // camera_h_included
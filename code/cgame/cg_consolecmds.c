@@ -14,6 +14,7 @@
 #include "cg_localents.h"
 #include "cg_main.h"
 #include "cg_marks.h"
+#include "cg_mem.h"
 #include "cg_newdraw.h"
 #include "cg_players.h"
 #include "cg_playerstate.h"
@@ -2098,6 +2099,7 @@ static void CG_ClearCameraPoints_f (void)
 	cg.numCameraPoints = 0;
 	cg.numSplinePoints = 0;
 	cg.cameraPointsPointer = NULL;
+	CG_CameraPathChanged();
 	cg.selectedCameraPointMin = 0;
 	cg.selectedCameraPointMax = 0;
 }
@@ -2818,6 +2820,7 @@ static void CG_UpdateCameraInfoExt (int startUpdatePoint)
 			cg.cameraPoints[0].next = NULL;
 			cg.cameraPoints[0].len = -1;
 		}
+		CG_CameraPathChanged();
 
 		return;
 	}
@@ -2848,6 +2851,7 @@ static void CG_UpdateCameraInfoExt (int startUpdatePoint)
 		cg.cameraPoints[i].len = -1;
 	}
 	cg.cameraPointsPointer = &cg.cameraPoints[0];
+	CG_CameraPathChanged();
 
 	// calculate spline points
 
@@ -8057,6 +8061,7 @@ static consoleCommand_t	commands[] = {
 	{ "echopopupclear", CG_EchoPopupClear_f },
 	{ "echopopupcvar", CG_EchoPopupCvar_f },
 	{ "listentities", CG_ListEntities_f },
+	{ "cgframearenainfo", CG_FrameArenaInfo_f },
 	{ "printentitystate", CG_PrintEntityState_f },
 	{ "printnextentitystate", CG_PrintNextEntityState_f },
 	{ "clearfragmessage", CG_ClearFragMessage_f },
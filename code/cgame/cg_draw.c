@@ -16,6 +16,7 @@
 #include "cg_players.h"  // color from string
 #include "cg_predict.h"
 #include "cg_q3mme_camera.h"
+#include "cg_scene.h"
 #include "cg_scoreboard.h"
 #include "cg_sound.h"
 #include "cg_syscalls.h"
@@ -10746,6 +10747,28 @@ static void CG_Draw2D( void ) {
 }
 
 
+/*
+=====================
+CG_RenderViewAxis
+
+The axis the scene will be rendered with.  CG_DrawActive() turns the view
+toward cg.viewEnt after the scene has been built.
+=====================
+*/
+void CG_RenderViewAxis (vec3_t axis[3])
+{
+	vec3_t dir;
+	vec3_t angles;
+
+	if (cg.viewEnt > -1  &&  !cg.freecam) {
+		VectorSubtract(cg_entities[cg.viewEnt].lerpOrigin, cg.refdef.vieworg, dir);
+		vectoangles(dir, angles);
+		AnglesToAxis(angles, axis);
+	} else {
+		AxisCopy(cg.refdef.viewaxis, axis);
+	}
+}
+
 /*
 =====================
 CG_DrawActive
@@ -10824,6 +10847,8 @@ void CG_DrawActive( stereoFrame_t stereoView ) {
 	if (0) {  //(cg.demoSeeking) {
 		trap_R_ClearScene();
 	} else {
+		// anything batched after local entities were added
+		CG_FlushSceneBatch();
 		trap_R_RenderScene( &cg.refdef );
 #if 0
 		if (Distance(lastOrigin, cg.refdef.vieworg)) {
@@ -71,6 +71,7 @@ void CG_CreateNewCrosshairs (void);
 void CG_Fade( int a, int time, int duration );
 void CG_DrawFlashFade( void );
 
+void CG_RenderViewAxis (vec3_t axis[3]);
 void CG_DrawActive( stereoFrame_t stereoView );
 
 const fontInfo_t *CG_ScaleFont (const fontInfo_t *font, float *scale, float	*useScale);
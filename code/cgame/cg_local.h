@@ -941,6 +941,22 @@ typedef struct {
 
 #define MAX_WHITELIST_AMBIENT_SOUNDS 128
 
+// snapshot that is either read in place from the client (hard linked
+// cgame) or copied into the snapshot_t given to CG_GetSnapshotRef().  Views
+// can be kept across frames while CG_SnapshotRefValid() says so.
+typedef struct {
+	int serverTime;
+	int messageNum;
+	int snapFlags;
+	const playerState_t *ps;
+	int numEntities;
+
+	const snapshot_t *snapshot;  // NULL if view is used
+#ifdef CGAME_HARD_LINKED
+	snapshotView_t view;
+#endif
+} snapshotRef_t;
+
 #if 0
 typedef struct {
 	char *fileName;
@@ -976,11 +992,13 @@ typedef struct {
 	snapshot_t	*prevSnap;
 	snapshot_t	*snap;				// cg.snap->serverTime <= cg.time
 	snapshot_t	*nextSnap;			// cg.nextSnap->serverTime > cg.time, or NULL
-	snapshot_t *nextNextSnap;
-	snapshot_t nnSnap;
+	snapshotRef_t nextNextSnap;  // use CG_NextNextSnapshot()
+	snapshot_t nnSnap;  // copy if nextNextSnap can't be viewed
 	qboolean nextNextSnapValid;
 	qboolean noMove;
 
+	snapshotRef_t smoothOldRef;
+	snapshotRef_t smoothNewRef;
 	snapshot_t smoothOldSnap;
 	snapshot_t smoothNewSnap;
 
@@ -1240,6 +1258,7 @@ typedef struct {
 
 	int numMirrorSurfaces;
 	vec3_t mirrorSurfaces[MAX_MIRROR_SURFACES];
+	qboolean portalSurfaceAdded;  // scene has mirror or portal views this frame
 
 	int				lastChatBeepTime;
 	int				lastTeamChatBeepTime;
@@ -3615,6 +3634,8 @@ extern vmCvar_t cg_specOffsetQL;
 
 extern vmCvar_t cg_drawKeyPress;
 extern vmCvar_t cg_useScoresUpdateTeam;
+extern vmCvar_t cg_sceneBatching;
+extern vmCvar_t cg_cullLocalEntities;
 
 // end cvar_t
 
@@ -6,11 +6,13 @@
 
 #include "cg_local.h"
 
+#include "cg_draw.h"  // CG_RenderViewAxis()
 #include "cg_effects.h"
 #include "cg_localents.h"
 #include "cg_main.h"
 #include "cg_marks.h"
 #include "cg_predict.h"
+#include "cg_scene.h"
 #include "cg_sound.h"
 #include "cg_syscalls.h"  // trap_S_RegisterSound
 
@@ -487,7 +489,7 @@ void CG_MakeLowPriorityEntity (localEntity_t *le)
 static void R_AddRefEntityPtrToScene (refEntity_t *ent)
 {
 	if (cg_fxq3mmeCompatibility.integer) {
-		trap_R_AddRefEntityToScene(ent);
+		CG_AddRefEntityToSceneBatch(ent);
 	} else {
 		trap_R_AddRefEntityPtrToScene(ent);
 	}
@@ -845,6 +847,440 @@ static void CG_ReflectVelocity( localEntity_t *le, const trace_t *trace ) {
 	}
 }
 
+#define MAX_BATCH_TRACES 1024
+
+static vec3_t batchTraceStarts[MAX_BATCH_TRACES];
+static vec3_t batchTraceEnds[MAX_BATCH_TRACES];
+static trace_t batchTraces[MAX_BATCH_TRACES];
+
+/*
+================
+CG_FX_EmittedMoveOrigin
+
+Where a moveGravity or moveBounce emitter moves to this frame, before it
+is traced.  Returns the gravity that was applied.
+================
+*/
+static float CG_FX_EmittedMoveOrigin (const localEntity_t *le, vec3_t newOrigin)
+{
+	double deltaTime;
+	float gravityValue;
+
+	deltaTime = (cg.ftime - le->trTimef) * 0.001;
+	VectorMA(le->pos.trBase, deltaTime, le->sv.velocity, newOrigin);
+
+	gravityValue = 0;
+	if (le->sv.hasMoveGravity) {
+		gravityValue = le->sv.moveGravity;
+	} else if (le->sv.hasMoveBounce) {
+		gravityValue = le->sv.moveBounce1;
+	}
+	//FIXME deltaTime maybe not the best check
+	if (gravityValue  &&  Q_fabs(deltaTime) > 0.0f) {
+		newOrigin[2] -= gravityValue * deltaTime * deltaTime;
+	}
+
+	return gravityValue;
+}
+
+/*
+================
+CG_TraceLocalEntities
+
+Traces all moving gibs, brass and moving fx emitters at once before the
+local entities are added.  CG_LocalEntityTrace() uses the result if the
+entity still moves along the same line, otherwise it traces by itself.
+================
+*/
+static void CG_TraceLocalEntities (void)
+{
+	localEntity_t *le;
+	int numTraces;
+
+	numTraces = 0;
+
+	for (le = cg_activeLocalEntities.prev;  le != &cg_activeLocalEntities;  le = le->prev) {
+		le->batchTrace = 0;
+
+		if (numTraces >= MAX_BATCH_TRACES) {
+			continue;
+		}
+
+		if (le->fxType == LEFX_EMIT) {
+			// same test as CG_Add_FX_Emitted()
+			if (le->sv.hasSink  &&  le->pos.trType == TR_STATIONARY) {
+				continue;
+			}
+			if (!le->sv.hasMoveBounce  &&  !le->sv.hasMoveGravity) {
+				continue;
+			}
+			VectorCopy(le->refEntity.origin, batchTraceStarts[numTraces]);
+			CG_FX_EmittedMoveOrigin(le, batchTraceEnds[numTraces]);
+		} else {
+			if (le->leType != LE_FRAGMENT  ||  le->fxType  ||  le->pos.trType == TR_STATIONARY) {
+				continue;
+			}
+			if (le->leFlags & (LEF_ALREADY_ADDED | LEF_ALREADY_ADDED_FX)) {
+				continue;
+			}
+			VectorCopy(le->refEntity.origin, batchTraceStarts[numTraces]);
+			BG_EvaluateTrajectoryf(&le->pos, cg.time, batchTraceEnds[numTraces], cg.foverf);
+		}
+
+		numTraces++;
+		le->batchTrace = numTraces;
+	}
+
+	if (numTraces > 0) {
+		CG_TraceBatch(batchTraces, (const vec3_t *)batchTraceStarts, NULL, NULL, (const vec3_t *)batchTraceEnds, numTraces, -1, CONTENTS_SOLID);
+	}
+}
+
+/*
+================
+CG_LocalEntityTrace
+
+Point trace from start to end, taken from this frame's batch if it was
+traced there.
+================
+*/
+static void CG_LocalEntityTrace (localEntity_t *le, trace_t *trace, const vec3_t start, const vec3_t end)
+{
+	if (le->batchTrace  &&  VectorCompare(start, batchTraceStarts[le->batchTrace - 1])  &&  VectorCompare(end, batchTraceEnds[le->batchTrace - 1])) {
+		*trace = batchTraces[le->batchTrace - 1];
+	} else {
+		CG_Trace(trace, start, NULL, NULL, end, -1, CONTENTS_SOLID);
+	}
+	le->batchTrace = 0;
+}
+
+/*
+  Smoke and blood puffs, sprite explosions, fragments and particles are
+  put in a uniform grid every frame.  Cells completely outside the view
+  frustum, or without any entity in the pvs of the view, drop all of their
+  entities at once.  Cells crossing a frustum plane test their entities
+  one at a time.  Culled fragments still move, bounce and bleed, they just
+  aren't drawn.
+
+  Fx script entities aren't culled: an emitter's script decides what it
+  draws and where (beams, rings, size, origin changes) only when it runs,
+  and it has to run anyway for the sounds and entities it spawns.  The
+  renderer culls what the script adds.
+*/
+
+#define LE_GRID_CELL_SIZE 512
+#define LE_GRID_HASH_SIZE 2048  // power of two
+#define MAX_LE_GRID_CELLS 1024
+
+typedef struct {
+	int coords[3];
+	vec3_t mins, maxs;  // of the entities in the cell
+	int firstEntity;  // in leGridEntities, -1 if none
+} leGridCell_t;
+
+typedef struct {
+	qboolean *culled;
+	vec3_t origin;
+	float radius;
+	int next;
+} leGridEntity_t;
+
+static leGridCell_t leGridCells[MAX_LE_GRID_CELLS];
+static int numLeGridCells;
+static int leGridHash[LE_GRID_HASH_SIZE];  // cell index + 1, 0 is empty
+static leGridEntity_t leGridEntities[MAX_LOCAL_ENTITIES];
+static int numLeGridEntities;
+static cplane_t leGridFrustum[4];
+static qboolean leGridUsePvs;
+
+/*
+================
+CG_LocalEntityCullSphere
+
+Bounding sphere of what the entity will add this frame, returns qfalse
+if it can't be culled.
+================
+*/
+static qboolean CG_LocalEntityCullSphere (const localEntity_t *le, vec3_t origin, float *radius)
+{
+	vec3_t end;
+	vec3_t mins, maxs;
+	float scale;
+	float c;
+
+	if (le->fxType  ||  (le->leFlags & (LEF_ALREADY_ADDED | LEF_ALREADY_ADDED_FX))) {
+		return qfalse;
+	}
+
+	switch (le->leType) {
+	case LE_MOVE_SCALE_FADE:
+		BG_EvaluateTrajectoryf(&le->pos, cg.time, origin, cg.foverf);
+		*radius = MAX(le->radius, le->refEntity.radius) + 8;
+		return qtrue;
+	case LE_SCALE_FADE:
+		VectorCopy(le->refEntity.origin, origin);
+		*radius = le->radius + 8;
+		return qtrue;
+	case LE_FALL_SCALE_FADE:
+		c = (le->endTime - cg.ftime) * le->lifeRate;
+		VectorCopy(le->refEntity.origin, origin);
+		origin[2] = le->pos.trBase[2] - (1.0 - c) * le->pos.trDelta[2];
+		*radius = le->radius + 16;
+		return qtrue;
+	case LE_SPRITE_EXPLOSION:
+		// the dlight can reach further than the sprite
+		VectorCopy(le->refEntity.origin, origin);
+		*radius = MAX(72, le->light);
+		return qtrue;
+	case LE_FRAGMENT:
+		// covers the whole move this frame and the sink at the end
+		if (le->refEntity.reType == RT_MODEL) {
+			trap_R_ModelBounds(le->refEntity.hModel, mins, maxs);
+			scale = 1.0;
+			if (le->refEntity.nonNormalizedAxes) {
+				scale = MAX(VectorLength(le->refEntity.axis[0]), MAX(VectorLength(le->refEntity.axis[1]), VectorLength(le->refEntity.axis[2])));
+			}
+			*radius = RadiusFromBounds(mins, maxs) * scale;
+		} else if (le->refEntity.reType == RT_SPRITE  ||  le->refEntity.reType == RT_SPRITE_FIXED) {
+			*radius = le->refEntity.radius;
+		} else {
+			return qfalse;
+		}
+		BG_EvaluateTrajectoryf(&le->pos, cg.time, end, cg.foverf);
+		VectorAdd(le->refEntity.origin, end, origin);
+		VectorScale(origin, 0.5, origin);
+		*radius += Distance(le->refEntity.origin, end) * 0.5 + 16;
+		return qtrue;
+	default:
+		return qfalse;
+	}
+}
+
+/*
+================
+CG_BeginCullGrid
+
+Sets up the view frustum and clears the grid.  Returns qfalse if nothing
+can be culled this frame.  Only the main view is checked, so nothing is
+culled when mirror or portal views are drawn from elsewhere.
+================
+*/
+qboolean CG_BeginCullGrid (void)
+{
+	vec3_t axis[3];
+	float xs, xc, ys, yc;
+	float pad;
+	int i;
+
+	if (!cg_cullLocalEntities.integer  ||  cg.portalSurfaceAdded) {
+		return qfalse;
+	}
+
+	// same planes the renderer uses
+	CG_RenderViewAxis(axis);
+
+	xs = sin(DEG2RAD(cg.refdef.fov_x * 0.5));
+	xc = cos(DEG2RAD(cg.refdef.fov_x * 0.5));
+	ys = sin(DEG2RAD(cg.refdef.fov_y * 0.5));
+	yc = cos(DEG2RAD(cg.refdef.fov_y * 0.5));
+
+	VectorScale(axis[0], xs, leGridFrustum[0].normal);
+	VectorMA(leGridFrustum[0].normal, xc, axis[1], leGridFrustum[0].normal);
+	VectorScale(axis[0], xs, leGridFrustum[1].normal);
+	VectorMA(leGridFrustum[1].normal, -xc, axis[1], leGridFrustum[1].normal);
+	VectorScale(axis[0], ys, leGridFrustum[2].normal);
+	VectorMA(leGridFrustum[2].normal, yc, axis[2], leGridFrustum[2].normal);
+	VectorScale(axis[0], ys, leGridFrustum[3].normal);
+	VectorMA(leGridFrustum[3].normal, -yc, axis[2], leGridFrustum[3].normal);
+
+	// stereo views are moved sideways after this, which can also put
+	// them in another cluster
+	pad = fabs(cg_stereoSeparation.value);
+	for (i = 0;  i < 4;  i++) {
+		leGridFrustum[i].dist = DotProduct(cg.refdef.vieworg, leGridFrustum[i].normal) - pad;
+	}
+	leGridUsePvs = (pad == 0.0f);
+
+	numLeGridCells = 0;
+	numLeGridEntities = 0;
+	memset(leGridHash, 0, sizeof(leGridHash));
+
+	return qtrue;
+}
+
+/*
+================
+CG_AddToCullGrid
+
+*culled is set by CG_CullGrid() if the sphere can't be seen.  The caller
+clears it.
+================
+*/
+void CG_AddToCullGrid (qboolean *culled, const vec3_t origin, float radius)
+{
+	leGridCell_t *cell;
+	leGridEntity_t *ent;
+	int coords[3];
+	unsigned int h;
+	int n;
+	int i;
+
+	if (numLeGridEntities >= MAX_LOCAL_ENTITIES) {
+		// not culled
+		return;
+	}
+
+	for (i = 0;  i < 3;  i++) {
+		coords[i] = (int)floor(origin[i] / LE_GRID_CELL_SIZE);
+	}
+
+	h = ((unsigned int)coords[0] * 73856093u ^ (unsigned int)coords[1] * 19349663u ^ (unsigned int)coords[2] * 83492791u) & (LE_GRID_HASH_SIZE - 1);
+	cell = NULL;
+	while (leGridHash[h]) {
+		n = leGridHash[h] - 1;
+		if (leGridCells[n].coords[0] == coords[0]  &&  leGridCells[n].coords[1] == coords[1]  &&  leGridCells[n].coords[2] == coords[2]) {
+			cell = &leGridCells[n];
+			break;
+		}
+		h = (h + 1) & (LE_GRID_HASH_SIZE - 1);
+	}
+
+	if (!cell) {
+		if (numLeGridCells >= MAX_LE_GRID_CELLS) {
+			// not culled
+			return;
+		}
+		n = numLeGridCells;
+		numLeGridCells++;
+		leGridHash[h] = n + 1;
+
+		cell = &leGridCells[n];
+		VectorCopy(coords, cell->coords);
+		ClearBounds(cell->mins, cell->maxs);
+		cell->firstEntity = -1;
+	}
+
+	ent = &leGridEntities[numLeGridEntities];
+	ent->culled = culled;
+	VectorCopy(origin, ent->origin);
+	ent->radius = radius;
+	ent->next = cell->firstEntity;
+	cell->firstEntity = numLeGridEntities;
+	numLeGridEntities++;
+
+	for (i = 0;  i < 3;  i++) {
+		if (origin[i] - radius < cell->mins[i]) {
+			cell->mins[i] = origin[i] - radius;
+		}
+		if (origin[i] + radius > cell->maxs[i]) {
+			cell->maxs[i] = origin[i] + radius;
+		}
+	}
+}
+
+/*
+================
+CG_CullGrid
+================
+*/
+void CG_CullGrid (void)
+{
+	const leGridCell_t *cell;
+	const leGridEntity_t *ent;
+	vec3_t corner;
+	qboolean clipped;
+	int i, j, k;
+
+	for (i = 0;  i < numLeGridCells;  i++) {
+		cell = &leGridCells[i];
+
+		clipped = qfalse;
+		for (j = 0;  j < 4;  j++) {
+			// box corner furthest along the plane normal
+			for (k = 0;  k < 3;  k++) {
+				corner[k] = leGridFrustum[j].normal[k] > 0 ? cell->maxs[k] : cell->mins[k];
+			}
+			if (DotProduct(corner, leGridFrustum[j].normal) < leGridFrustum[j].dist) {
+				break;
+			}
+
+			for (k = 0;  k < 3;  k++) {
+				corner[k] = leGridFrustum[j].normal[k] > 0 ? cell->mins[k] : cell->maxs[k];
+			}
+			if (DotProduct(corner, leGridFrustum[j].normal) < leGridFrustum[j].dist) {
+				clipped = qtrue;
+			}
+		}
+
+		if (j == 4  &&  leGridUsePvs) {
+			// one pvs test per cell, stopping at the first entity that
+			// can be seen
+			for (k = cell->firstEntity;  k >= 0;  k = leGridEntities[k].next) {
+				if (trap_R_inPVS(cg.refdef.vieworg, leGridEntities[k].origin)) {
+					break;
+				}
+			}
+			if (k < 0) {
+				j = 0;
+			}
+		}
+
+		if (j < 4) {
+			// whole cell is outside
+			for (k = cell->firstEntity;  k >= 0;  k = leGridEntities[k].next) {
+				*leGridEntities[k].culled = qtrue;
+			}
+			continue;
+		}
+
+		if (!clipped) {
+			continue;
+		}
+
+		for (k = cell->firstEntity;  k >= 0;  k = ent->next) {
+			ent = &leGridEntities[k];
+			for (j = 0;  j < 4;  j++) {
+				if (DotProduct(ent->origin, leGridFrustum[j].normal) - leGridFrustum[j].dist < -ent->radius) {
+					*ent->culled = qtrue;
+					break;
+				}
+			}
+		}
+	}
+}
+
+/*
+================
+CG_CullLocalEntities
+
+Marks the local entities that can't be seen this frame, before they are
+added.
+================
+*/
+static void CG_CullLocalEntities (void)
+{
+	localEntity_t *le;
+	vec3_t origin;
+	float radius;
+
+	for (le = cg_activeLocalEntities.next;  le != &cg_activeLocalEntities;  le = le->next) {
+		le->culled = qfalse;
+	}
+
+	if (!CG_BeginCullGrid()) {
+		return;
+	}
+
+	for (le = cg_activeLocalEntities.next;  le != &cg_activeLocalEntities;  le = le->next) {
+		if (!CG_LocalEntityCullSphere(le, origin, &radius)) {
+			continue;
+		}
+		CG_AddToCullGrid(&le->culled, origin, radius);
+	}
+
+	CG_CullGrid();
+}
+
 /*
 ================
 CG_AddFragment
@@ -874,12 +1310,16 @@ static void CG_AddFragment( localEntity_t *le ) {
 			oldZ = le->refEntity.origin[2];
 			le->refEntity.origin[2] -= 16 * ( 1.0 - (float)t / SINK_TIME );
 			newZ = le->refEntity.origin[2];
-			trap_R_AddRefEntityToScene( &le->refEntity );
+			if (!le->culled) {
+				CG_AddRefEntityToSceneBatch( &le->refEntity );
+			}
 			le->refEntity.origin[2] = oldZ;
 		} else {
 			oldZ = le->refEntity.origin[2];
 			newZ = le->refEntity.origin[2];
-			trap_R_AddRefEntityToScene( &le->refEntity );
+			if (!le->culled) {
+				CG_AddRefEntityToSceneBatch( &le->refEntity );
+			}
 		}
 
 		switch (re->reType) {
@@ -921,7 +1361,7 @@ static void CG_AddFragment( localEntity_t *le ) {
 	BG_EvaluateTrajectoryf( &le->pos, cg.time, newOrigin, cg.foverf );
 
 	// trace a line from previous position to new position
-	CG_Trace( &trace, le->refEntity.origin, NULL, NULL, newOrigin, -1, CONTENTS_SOLID );
+	CG_LocalEntityTrace( le, &trace, le->refEntity.origin, newOrigin );
 	//Com_Printf("trace.fraction %f\n", trace.fraction);
 	if ( trace.fraction == 1.0 ) {
 		// still in free fall
@@ -934,7 +1374,9 @@ static void CG_AddFragment( localEntity_t *le ) {
 			AnglesToAxis( angles, le->refEntity.axis );
 		}
 
-		trap_R_AddRefEntityToScene( &le->refEntity );
+		if (!le->culled) {
+			CG_AddRefEntityToSceneBatch( &le->refEntity );
+		}
 
 		//Com_Printf("bounce type %d  (%d)  mark type %d  (%d)\n", le->leBounceSoundType, le->leBounceSoundType == LEBS_BLOOD, le->leMarkType, le->leMarkType == LEMT_BLOOD);
 		// add a blood trail
@@ -983,7 +1425,9 @@ static void CG_AddFragment( localEntity_t *le ) {
 	// reflect the velocity on the trace plane
 	CG_ReflectVelocity( le, &trace );
 
-	trap_R_AddRefEntityToScene( &le->refEntity );
+	if (!le->culled) {
+		CG_AddRefEntityToSceneBatch( &le->refEntity );
+	}
 }
 
 /*
@@ -1021,7 +1465,7 @@ static void CG_AddFadeRGB( localEntity_t *le ) {
 	re->shaderRGBA[2] = le->color[2] * c;
 	re->shaderRGBA[3] = le->color[3] * c;
 
-	trap_R_AddRefEntityToScene( re );
+	CG_AddRefEntityToSceneBatch( re );
 }
 
 /*
@@ -1068,7 +1512,7 @@ static void CG_AddMoveScaleFade( localEntity_t *le ) {
 		return;
 	}
 
-	trap_R_AddRefEntityToScene( re );
+	CG_AddRefEntityToSceneBatch( re );
 }
 
 
@@ -1108,7 +1552,7 @@ static void CG_AddScaleFade( localEntity_t *le ) {
 		return;
 	}
 
-	trap_R_AddRefEntityToScene( re );
+	CG_AddRefEntityToSceneBatch( re );
 }
 
 
@@ -1158,7 +1602,7 @@ static void CG_AddFallScaleFade( localEntity_t *le ) {
 		return;
 	}
 
-	trap_R_AddRefEntityToScene( re );
+	CG_AddRefEntityToSceneBatch( re );
 }
 
 
@@ -1174,7 +1618,7 @@ static void CG_AddExplosion( const localEntity_t *ex ) {
 	ent = &ex->refEntity;
 
 	// add the entity
-	trap_R_AddRefEntityToScene(ent);
+	CG_AddRefEntityToSceneBatch(ent);
 
 	// add the dlight
 	if ( ex->light ) {
@@ -1215,7 +1659,7 @@ static void CG_AddSpriteExplosion( localEntity_t *le ) {
 	re.reType = RT_SPRITE;
 	re.radius = 42 * ( 1.0 - c ) + 30;
 
-	trap_R_AddRefEntityToScene( &re );
+	CG_AddRefEntityToSceneBatch( &re );
 
 	// add the dlight
 	if ( le->light ) {
@@ -1368,7 +1812,7 @@ CG_AddInvulnerabilityImpact
 ===================
 */
 static void CG_AddInvulnerabilityImpact( const localEntity_t *le ) {
-	trap_R_AddRefEntityToScene( &le->refEntity );
+	CG_AddRefEntityToSceneBatch( &le->refEntity );
 }
 
 /*
@@ -1402,7 +1846,7 @@ static void CG_AddInvulnerabilityJuiced( localEntity_t *le ) {
 		}
 	}
 	else {
-		trap_R_AddRefEntityToScene( &le->refEntity );
+		CG_AddRefEntityToSceneBatch( &le->refEntity );
 	}
 }
 
@@ -1428,7 +1872,7 @@ static void CG_AddLocalRefEntity( localEntity_t *le ) {
 		Unlock_EntList();
 		return;
 	}
-	trap_R_AddRefEntityToScene( &le->refEntity );
+	CG_AddRefEntityToSceneBatch( &le->refEntity );
 }
 
 #endif
@@ -1980,7 +2424,7 @@ static void CG_AddHeadShotPlum( localEntity_t *le ) {
 	re->customShader = cgs.media.headShotIcon;
 	VectorCopy(origin, re->origin);
 
-	trap_R_AddRefEntityToScene(re);
+	CG_AddRefEntityToSceneBatch(re);
 }
 
 void CG_RunFxAll (const char *name)
@@ -2298,21 +2742,13 @@ static void CG_Add_FX_Emitted (localEntity_t *le)
 		//deltaTime = (cg.ftime - le->startTime) * 0.001;
 		deltaTime = (cg.ftime - le->trTimef) * 0.001;
 		//lastDeltaTime = (le->lastRunTime - le->startTime) * 0.001;
-		VectorMA(le->pos.trBase, deltaTime, ScriptVars.velocity, newOrigin);  //ScriptVars.origin);
+		// ScriptVars still holds le->sv here
+		gravityValue = CG_FX_EmittedMoveOrigin(le, newOrigin);
 		//VectorMA(le->pos.trBase, lastDeltaTime, ScriptVars.velocity /*fuck me*/, lastOrigin);
 		VectorCopy(re->origin, lastOrigin);
-		gravityValue = 0;
-		if (ScriptVars.hasMoveGravity) {
-			gravityValue = ScriptVars.moveGravity;
-		} else if (ScriptVars.hasMoveBounce) {
-			gravityValue = ScriptVars.moveBounce1;
-		}
 		VectorCopy(ScriptVars.velocity, oldVelocity);
 		//FIXME deltaTime maybe not the best check
 		if (gravityValue  &&  Q_fabs(deltaTime) > 0.0f) {
-			//newOrigin[2] -= 0.5 * gravityValue * deltaTime * deltaTime;
-			//newOrigin[2] -= gravityValue * deltaTime * deltaTime;
-			newOrigin[2] -= gravityValue * deltaTime * deltaTime;
 			VectorSubtract(newOrigin, lastOrigin, ScriptVars.velocity);
 			//Com_Printf("%f\n", deltaTime);
 			VectorScale(ScriptVars.velocity, 1.0 / deltaTime, ScriptVars.velocity);
@@ -2337,7 +2773,7 @@ static void CG_Add_FX_Emitted (localEntity_t *le)
 
 #else
 
-		CG_Trace(&trace, re->origin, NULL, NULL, newOrigin, -1, CONTENTS_SOLID);
+		CG_LocalEntityTrace(le, &trace, re->origin, newOrigin);
 
 #endif
 
@@ -2955,6 +3391,11 @@ static void CG_AddLocalEntitiesExt (int threadNum)
 			break;
 		}
 
+		// culled fragments still move, see CG_AddFragment()
+		if (le->culled  &&  le->leType != LE_FRAGMENT) {
+			continue;
+		}
+
 		Lock_Global();
 
 		switch ( le->leType ) {
@@ -3069,6 +3510,9 @@ void CG_AddLocalEntities (void)
 		Increment_FrameCount();
 		Unlock_Count();
 
+		CG_TraceLocalEntities();
+		CG_CullLocalEntities();
+
 		//Com_Printf("about to wake threads %d\n", FrameCount);
 
 		// wake threads
@@ -3090,6 +3534,8 @@ void CG_AddLocalEntities (void)
 #endif
 	} else {
 		Increment_FrameCount();
+		CG_TraceLocalEntities();
+		CG_CullLocalEntities();
 		CG_AddLocalEntitiesExt(0);
 	}
 }
@@ -3100,6 +3546,8 @@ void CG_AddLocalEntities (void)
 {
 	Next[0] = cg_activeLocalEntities.prev;
 	Increment_FrameCount();
+	CG_TraceLocalEntities();
+	CG_CullLocalEntities();
 	CG_AddLocalEntitiesExt(0);
 }
 
@@ -3245,6 +3693,10 @@ void CG_AddRefEntity (const refEntity_t *re)
 	// renders newest to oldest
 	//memcpy(&le->refEntity, re, sizeof(le->refEntity));
 
+	if (re->reType == RT_PORTALSURFACE) {
+		cg.portalSurfaceAdded = qtrue;
+	}
+
 	trap_R_AddRefEntityToScene(re);
 }
 
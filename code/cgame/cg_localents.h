@@ -118,6 +118,9 @@ typedef struct localEntity_s {
 	// for threads
 	int frameCountHandled;
 
+	int batchTrace;  // 1 + index into this frame's batched traces, 0 if none
+	qboolean culled;  // outside the view this frame, not drawn
+
 } localEntity_t;
 
 typedef struct fxForce_s {
@@ -141,6 +144,9 @@ localEntity_t *CG_AllocLocalEntity( void );
 localEntity_t *CG_AllocLocalEntityRealTime( void );
 void CG_MakeLowPriorityEntity (localEntity_t *le);
 void CG_AddLocalEntities( void );
+qboolean CG_BeginCullGrid (void);
+void CG_AddToCullGrid (qboolean *culled, const vec3_t origin, float radius);
+void CG_CullGrid (void);
 void CG_ClearLocalFrameEntities (void);
 void CG_RemoveFXLocalEntities (qboolean all, float emitterId);
 void CG_ListLocalEntities (void);
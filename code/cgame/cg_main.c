@@ -1256,6 +1256,8 @@ vmCvar_t cg_specOffsetQL;
 
 vmCvar_t cg_drawKeyPress;
 vmCvar_t cg_useScoresUpdateTeam;
+vmCvar_t cg_sceneBatching;
+vmCvar_t cg_cullLocalEntities;
 
 // end cvar_t
 
@@ -2425,6 +2427,8 @@ static cvarTable_t cvarTable[] = { // bk001129
 
 	{ cvp(cg_drawKeyPress), "0", CVAR_ARCHIVE },
 	{ cvp(cg_useScoresUpdateTeam), "1", CVAR_ARCHIVE },
+	{ cvp(cg_sceneBatching), "1", CVAR_ARCHIVE },
+	{ cvp(cg_cullLocalEntities), "1", CVAR_ARCHIVE },
 
 };
 
@@ -4381,6 +4385,65 @@ void CG_BuildSpectatorString(void) {
 CG_RegisterClients
 ===================
 */
+/*
+===================
+CG_PrefetchPlayerModels
+
+Demo playback knows every player model up front.  Queues their files so
+they are read in the background while the map loads and
+CG_RegisterClients() only has to register them.  Images referenced by
+the skins are queued by the engine once the skins are read.
+===================
+*/
+static void CG_PrefetchPlayerModels (void)
+{
+	static const char *parts[] = { "lower", "upper", "head" };
+	static const char *folders[] = { "", "characters/" };
+	const char *skins[4];
+	char modelName[MAX_QPATH];
+	char *skin;
+	int numExtraPlayers;
+	int i, j, k, n;
+
+	numExtraPlayers = trap_GetNumPlayerInfos();
+
+	for (i = 0;  i < numExtraPlayers;  i++) {
+		trap_GetExtraPlayerInfo(i, modelName);
+
+		skin = strrchr(modelName, '/');
+		if (skin) {
+			*skin++ = '\0';
+		} else {
+			skin = "default";
+		}
+		if (!modelName[0]) {
+			continue;
+		}
+
+		skins[0] = skin;
+		skins[1] = "default";
+		skins[2] = "red";
+		skins[3] = "blue";
+
+		for (j = 0;  j < ARRAY_LEN(folders);  j++) {
+			for (k = 0;  k < ARRAY_LEN(parts);  k++) {
+				trap_FS_Prefetch(va("models/players/%s%s/%s.md3", folders[j], modelName, parts[k]));
+				trap_FS_Prefetch(va("models/players/%s%s/%s_1.md3", folders[j], modelName, parts[k]));
+				trap_FS_Prefetch(va("models/players/%s%s/%s_2.md3", folders[j], modelName, parts[k]));
+				for (n = 0;  n < ARRAY_LEN(skins);  n++) {
+					if (n > 0  &&  !Q_stricmp(skins[n], skin)) {
+						continue;
+					}
+					trap_FS_Prefetch(va("models/players/%s%s/%s_%s.skin", folders[j], modelName, parts[k], skins[n]));
+				}
+			}
+		}
+
+		trap_FS_Prefetch(va("models/players/heads/%s/%s.md3", modelName, modelName));
+		trap_FS_Prefetch(va("models/players/%s/icon_%s.tga", modelName, skin));
+	}
+}
+
 static void CG_RegisterClients( void ) {
 	int		i;
 	clientInfo_t tmpCi;
@@ -7906,6 +7969,10 @@ static void CG_Init (int serverMessageNum, int serverCommandSequence, int client
 		cg.warmupTimeStart = cgs.levelStartTime;
 	}
 
+	if (cg.demoPlayback) {
+		CG_PrefetchPlayerModels();
+	}
+
 	// load the new map
 	CG_LoadingString( "collision map" );
 
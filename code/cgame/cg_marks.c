@@ -8,6 +8,7 @@
 #include "cg_main.h"
 #include "cg_marks.h"
 #include "cg_predict.h"
+#include "cg_scene.h"
 #include "cg_syscalls.h"
 
 /*
@@ -198,7 +199,7 @@ void CG_ImpactMark( qhandle_t markShader, const vec3_t origin, const vec3_t dir,
 
 		// if it is a temporary (shadow) mark, add it immediately and forget about it
 		if ( temporary ) {
-			trap_R_AddPolyToScene( markShader, mf->numPoints, verts, qfalse );
+			CG_AddPolyToSceneBatch( markShader, mf->numPoints, verts );
 			continue;
 		}
 
@@ -298,7 +299,7 @@ void CG_AddMarks( void ) {
 			}
 		}
 
-		trap_R_AddPolyToScene( mp->markShader, mp->poly.numVerts, mp->verts, qfalse );
+		CG_AddPolyToSceneBatch( mp->markShader, mp->poly.numVerts, mp->verts );
 	}
 }
 
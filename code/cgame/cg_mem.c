@@ -6,6 +6,74 @@ typedef unsigned int uintptr_t;
 #endif
 
 
+// frame arena, a bump allocator that is reset at the start of every
+// CG_DrawActiveFrame()
+
+#define FRAME_ARENA_SIZE (1024 * 1024 * 2)
+#define FRAME_ARENA_ALIGN 8  // FrameArena is an array of doubles
+
+static double FrameArena[FRAME_ARENA_SIZE / sizeof(double)];
+static size_t FrameArenaUsed;
+
+static int FrameArenaAllocs;
+static int FrameArenaLastAllocs;
+static size_t FrameArenaLastPeak;
+static size_t FrameArenaPeak;
+static size_t FrameArenaMaxPeak;
+static int FrameArenaFailed;
+
+void *CG_FrameAlloc (size_t size)
+{
+    byte *p;
+
+    size = (size + FRAME_ARENA_ALIGN - 1) / FRAME_ARENA_ALIGN * FRAME_ARENA_ALIGN;
+    if (size > FRAME_ARENA_SIZE - FrameArenaUsed) {
+        FrameArenaFailed++;
+        return NULL;
+    }
+
+    p = (byte *)FrameArena + FrameArenaUsed;
+    FrameArenaUsed += size;
+    FrameArenaAllocs++;
+    if (FrameArenaUsed > FrameArenaPeak) {
+        FrameArenaPeak = FrameArenaUsed;
+    }
+
+    return p;
+}
+
+size_t CG_FrameArenaMark (void)
+{
+    return FrameArenaUsed;
+}
+
+void CG_FrameArenaRelease (size_t mark)
+{
+    if (mark < FrameArenaUsed) {
+        FrameArenaUsed = mark;
+    }
+}
+
+void CG_ResetFrameArena (void)
+{
+    FrameArenaLastAllocs = FrameArenaAllocs;
+    FrameArenaLastPeak = FrameArenaPeak;
+    if (FrameArenaPeak > FrameArenaMaxPeak) {
+        FrameArenaMaxPeak = FrameArenaPeak;
+    }
+
+    FrameArenaUsed = 0;
+    FrameArenaAllocs = 0;
+    FrameArenaPeak = 0;
+}
+
+void CG_FrameArenaInfo_f (void)
+{
+    Com_Printf("cgame frame arena: %d bytes\n", FRAME_ARENA_SIZE);
+    Com_Printf("  last frame: %d allocations  peak %d bytes\n", FrameArenaLastAllocs, (int)FrameArenaLastPeak);
+    Com_Printf("  max peak: %d bytes   failed allocations: %d\n", (int)FrameArenaMaxPeak, FrameArenaFailed);
+}
+
 #ifndef Q3_VM
 
 // native
@@ -7,4 +7,11 @@ void *CG_MallocMem (size_t size);
 void *CG_CallocMem (size_t size);
 void CG_FreeMem (void *ptr);
 
+// frame arena for scratch data, released when the next frame starts
+void *CG_FrameAlloc (size_t size);  // NOT 0 filled, NULL if the arena is full
+size_t CG_FrameArenaMark (void);
+void CG_FrameArenaRelease (size_t mark);  // frees everything after mark
+void CG_ResetFrameArena (void);
+void CG_FrameArenaInfo_f (void);
+
 #endif  // cg_mem_h_included
@@ -6,6 +6,7 @@
 #include "cg_localents.h"
 #include "cg_main.h"
 #include "cg_predict.h"
+#include "cg_scene.h"
 #include "cg_syscalls.h"
 
 //#define WOLF_PARTICLES
@@ -46,6 +47,8 @@ typedef struct particle_s
 	
 	qboolean	link;
 
+	qboolean	culled;  // outside the view this frame, see CG_CullParticles()
+
 	// Ridah
 	int			shaderAnim;
 	int			roll;
@@ -830,15 +833,60 @@ void CG_AddParticleToScene (cparticle_t *p, vec3_t org, float alpha)
 	}
 
 	if (p->type == P_WEATHER || p->type == P_WEATHER_TURBULENT || p->type == P_WEATHER_FLURRY)
-		trap_R_AddPolyToScene( p->pshader, 3, TRIverts, qfalse );
+		CG_AddPolyToSceneBatch( p->pshader, 3, TRIverts );
 	else
-		trap_R_AddPolyToScene( p->pshader, 4, verts, qfalse );
+		CG_AddPolyToSceneBatch( p->pshader, 4, verts );
 
 }
 
 // Ridah, made this static so it doesn't interfere with other files
 static float roll = 0.0;
 
+/*
+===============
+CG_CullParticles
+
+Weather and bubbles are left alone, CG_AddParticleToScene() moves them
+back to the top when they fall out of their volume.
+===============
+*/
+static void CG_CullParticles (void)
+{
+	cparticle_t *p;
+	vec3_t org;
+	float time, time2;
+	float radius;
+
+	for (p = active_particles;  p;  p = p->next) {
+		p->culled = qfalse;
+	}
+
+	if (!CG_BeginCullGrid()) {
+		return;
+	}
+
+	for (p = active_particles;  p;  p = p->next) {
+		if (p->type == P_WEATHER  ||  p->type == P_WEATHER_TURBULENT  ||  p->type == P_WEATHER_FLURRY
+			||  p->type == P_BUBBLE  ||  p->type == P_BUBBLE_TURBULENT) {
+			continue;
+		}
+
+		// same position CG_AddParticles() uses
+		time = (cg.time - p->time)*0.001;
+		time2 = time*time;
+		org[0] = p->org[0] + p->vel[0]*time + p->accel[0]*time2;
+		org[1] = p->org[1] + p->vel[1]*time + p->accel[1]*time2;
+		org[2] = p->org[2] + p->vel[2]*time + p->accel[2]*time2;
+
+		// quads can be rotated and scaled up to their end size
+		radius = (MAX(p->width, p->endwidth) + MAX(p->height, p->endheight)) * 1.5 + 8;
+
+		CG_AddToCullGrid(&p->culled, org, radius);
+	}
+
+	CG_CullGrid();
+}
+
 /*
 ===============
 CG_AddParticles
@@ -867,6 +915,8 @@ void CG_AddParticles (void)
 	
 	oldtime = cg.time;
 
+	CG_CullParticles();
+
 	active = NULL;
 	tail = NULL;
 
@@ -934,7 +984,9 @@ void CG_AddParticles (void)
 
 		if ((p->type == P_BAT || p->type == P_SPRITE) && p->endtime < 0) {
 			// temporary sprite
-			CG_AddParticleToScene (p, p->org, alpha);
+			if (!p->culled) {
+				CG_AddParticleToScene (p, p->org, alpha);
+			}
 			p->next = free_particles;
 			free_particles = p;
 			p->type = 0;
@@ -961,7 +1013,9 @@ void CG_AddParticles (void)
 		org[1] = p->org[1] + p->vel[1]*time + p->accel[1]*time2;
 		org[2] = p->org[2] + p->vel[2]*time + p->accel[2]*time2;
 
-		CG_AddParticleToScene (p, org, alpha);
+		if (!p->culled) {
+			CG_AddParticleToScene (p, org, alpha);
+		}
 	}
 
 	active_particles = active;
@@ -1664,10 +1718,12 @@ qboolean ValidBloodPool (vec3_t start)
 
 	vec3_t	angles;
 	vec3_t	right, up;
-	vec3_t	this_pos, x_pos, center_pos, end_pos;
+	vec3_t	x_pos, center_pos;
+	vec3_t	starts[4], ends[4];
+	trace_t	traces[4];
 	int	x, y;
 	int	fwidth, fheight;
-	trace_t	trace;
+	int	i, numTraces;
 	vec3_t	normal;
 
 	fwidth = 16;
@@ -1680,25 +1736,29 @@ qboolean ValidBloodPool (vec3_t start)
 
 	VectorMA (start, EXTRUDE_DIST, normal, center_pos);
 
+	// the four corners are traced in one batch
+	numTraces = 0;
 	for (x= -fwidth/2; x<fwidth; x+= fwidth)
 	{
 		VectorMA (center_pos, x, right, x_pos);
 
 		for (y= -fheight/2; y<fheight; y+= fheight)
 		{
-			VectorMA (x_pos, y, up, this_pos);
-			VectorMA (this_pos, -EXTRUDE_DIST*2, normal, end_pos);
-			
-			CG_Trace (&trace, this_pos, NULL, NULL, end_pos, -1, CONTENTS_SOLID);
+			VectorMA (x_pos, y, up, starts[numTraces]);
+			VectorMA (starts[numTraces], -EXTRUDE_DIST*2, normal, ends[numTraces]);
+			numTraces++;
+		}
+	}
 
-			
-			if (trace.entityNum < ENTITYNUM_WORLD) // may only land on world
-				return qfalse;
+	CG_TraceBatch (traces, (const vec3_t *)starts, NULL, NULL, (const vec3_t *)ends, numTraces, -1, CONTENTS_SOLID);
 
-			if (!(!trace.startsolid && trace.fraction < 1))
-				return qfalse;
-		
-		}
+	for (i = 0; i < numTraces; i++)
+	{
+		if (traces[i].entityNum < ENTITYNUM_WORLD) // may only land on world
+			return qfalse;
+
+		if (!(!traces[i].startsolid && traces[i].fraction < 1))
+			return qfalse;
 	}
 
 	return qtrue;
@@ -174,6 +174,26 @@ void	CG_Trace( trace_t *result, const vec3_t start, const vec3_t mins, const vec
 	*result = t;
 }
 
+/*
+================
+CG_TraceBatch
+
+CG_Trace() for numTraces traces, the world part goes to the engine in one
+call.  mins and maxs are NULL for points or hold one box per trace.
+================
+*/
+void CG_TraceBatch (trace_t *results, const vec3_t *starts, const vec3_t *mins, const vec3_t *maxs, const vec3_t *ends, int numTraces, int skipNumber, int mask)
+{
+	int i;
+
+	trap_CM_TraceBatch(results, starts, ends, mins, maxs, numTraces, 0, mask);
+
+	for (i = 0;  i < numTraces;  i++) {
+		results[i].entityNum = results[i].fraction != 1.0 ? ENTITYNUM_WORLD : ENTITYNUM_NONE;
+		CG_ClipMoveToEntities(starts[i], mins ? mins[i] : NULL, maxs ? maxs[i] : NULL, ends[i], skipNumber, mask, &results[i]);
+	}
+}
+
 /*
 ================
 CG_PointContents
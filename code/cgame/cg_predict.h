@@ -6,6 +6,7 @@ extern centity_t *cg_solidEntities[MAX_ENTITIES_IN_SNAPSHOT];
 
 void CG_BuildSolidList( void );
 void CG_Trace( trace_t *result, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int skipNumber, int mask );
+void CG_TraceBatch (trace_t *results, const vec3_t *starts, const vec3_t *mins, const vec3_t *maxs, const vec3_t *ends, int numTraces, int skipNumber, int mask);
 int	CG_PointContents( const vec3_t point, int passEntityNum );
 void CG_PredictPlayerState( void );
 
@@ -73,6 +73,41 @@ typedef struct {
 	int messageNum;
 } snapshot_t;
 
+#ifdef CGAME_HARD_LINKED
+// read-only view of a snapshot still held in the client's snapshot and
+// parse entity buffers, only available to the hard linked cgame since it
+// points into engine memory.  The view stays usable as long as
+// CL_SnapshotViewValid() returns qtrue, new snapshots can overwrite it.
+// Demo snapshots past the current one are peeked and only last until the
+// next peek.
+typedef struct {
+	int generation;
+	int pov;
+	int peek;  // peek sequence if read ahead, 0 otherwise
+	int parseEntitiesNum;
+
+	int snapFlags;
+	int ping;
+	int serverTime;
+	int serverCommandSequence;
+	int messageNum;
+	const byte *areamask;
+	const playerState_t *ps;
+
+	int numEntities;
+	const entityState_t *parseEntities;  // circular buffer, use SnapshotViewEntity()
+	int parseEntitiesMask;
+} snapshotView_t;
+
+static ID_INLINE const entityState_t *SnapshotViewEntity (const snapshotView_t *view, int n)
+{
+	return &view->parseEntities[(view->parseEntitiesNum + n) & view->parseEntitiesMask];
+}
+
+qboolean CL_GetSnapshotView (int snapshotNumber, snapshotView_t *view);
+qboolean CL_SnapshotViewValid (const snapshotView_t *view);
+#endif
+
 enum {
   CGAME_EVENT_NONE,
   CGAME_EVENT_TEAMMENU,
@@ -247,6 +282,14 @@ typedef enum {
 	CG_R_GETFONTINFO,
 	CG_GETROUNDSTARTTIMES,
 	CG_GETTEAMSWITCHTIME,
+	CG_PROFILE_BEGIN,
+	CG_PROFILE_END,
+	CG_R_ADDREFENTITIESTOSCENE,
+	CG_CM_TRACEBATCH,
+	CG_FS_PREFETCH,
+	CG_CM_CREATETRACECONTEXT,
+	CG_CM_FREETRACECONTEXT,
+	CG_CM_TRACEBATCHCONTEXT,
 
 } cgameImport_t;
 
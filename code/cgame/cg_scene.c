@@ -0,0 +1,210 @@
+// cg_scene.c -- batched submission of refEntities and polys to the renderer
+
+#include "cg_local.h"
+
+#include "cg_mem.h"
+#include "cg_scene.h"
+#include "cg_syscalls.h"
+
+#define MAX_SCENE_BATCH_ENTITIES 1024
+#define MAX_SCENE_BATCH_POLYS 4096
+#define MAX_SCENE_BATCH_POLYVERTS 16384
+#define MAX_SCENE_BATCH_GROUPS 256
+#define SCENE_BATCH_HASH_SIZE (MAX_SCENE_BATCH_GROUPS * 2)  // power of two
+
+typedef struct {
+	qhandle_t shader;
+	int numVerts;
+	int numPolys;
+	int firstVert;  // in the flush copy, only valid while flushing
+	int nextVert;
+} scenePolyGroup_t;
+
+typedef struct {
+	int group;
+	int firstVert;  // in scenePolyVerts
+} scenePoly_t;
+
+static refEntity_t sceneEntities[MAX_SCENE_BATCH_ENTITIES];
+static int numSceneEntities;
+
+static polyVert_t scenePolyVerts[MAX_SCENE_BATCH_POLYVERTS];
+static int numScenePolyVerts;
+static scenePoly_t scenePolys[MAX_SCENE_BATCH_POLYS];
+static int numScenePolys;
+
+// groups are kept in the order they were first seen
+static scenePolyGroup_t sceneGroups[MAX_SCENE_BATCH_GROUPS];
+static int numSceneGroups;
+static int sceneGroupHash[SCENE_BATCH_HASH_SIZE];  // group index + 1, 0 is empty
+
+
+static void CG_FlushSceneEntities (void)
+{
+	if (numSceneEntities > 0) {
+		trap_R_AddRefEntitiesToScene(sceneEntities, numSceneEntities);
+		numSceneEntities = 0;
+	}
+}
+
+/*
+==================
+CG_FlushScenePolys
+
+Copies each group's polys next to each other, keeping their submission
+order within the group, and hands every group to the renderer at once.
+The copies only live until the renderer has them, so they come from the
+frame arena.
+==================
+*/
+static void CG_FlushScenePolys (void)
+{
+	scenePolyGroup_t *g;
+	const scenePoly_t *p;
+	polyVert_t *sceneGroupVerts;
+	size_t mark;
+	int offset;
+	int i;
+
+	if (numScenePolys <= 0) {
+		return;
+	}
+
+	if (numSceneGroups == 1) {
+		// already contiguous
+		g = &sceneGroups[0];
+		trap_R_AddPolysToScene(g->shader, g->numVerts, scenePolyVerts, g->numPolys);
+	} else {
+		mark = CG_FrameArenaMark();
+		sceneGroupVerts = CG_FrameAlloc(numScenePolyVerts * sizeof(polyVert_t));
+		if (!sceneGroupVerts) {
+			// arena is full, one call per poly
+			for (i = 0;  i < numScenePolys;  i++) {
+				p = &scenePolys[i];
+				g = &sceneGroups[p->group];
+				trap_R_AddPolysToScene(g->shader, g->numVerts, &scenePolyVerts[p->firstVert], 1);
+			}
+		} else {
+			offset = 0;
+			for (i = 0;  i < numSceneGroups;  i++) {
+				g = &sceneGroups[i];
+				g->firstVert = offset;
+				g->nextVert = offset;
+				offset += g->numPolys * g->numVerts;
+			}
+
+			for (i = 0;  i < numScenePolys;  i++) {
+				p = &scenePolys[i];
+				g = &sceneGroups[p->group];
+				memcpy(&sceneGroupVerts[g->nextVert], &scenePolyVerts[p->firstVert], g->numVerts * sizeof(polyVert_t));
+				g->nextVert += g->numVerts;
+			}
+
+			for (i = 0;  i < numSceneGroups;  i++) {
+				g = &sceneGroups[i];
+				trap_R_AddPolysToScene(g->shader, g->numVerts, &sceneGroupVerts[g->firstVert], g->numPolys);
+			}
+		}
+		CG_FrameArenaRelease(mark);
+	}
+
+	numScenePolys = 0;
+	numScenePolyVerts = 0;
+	numSceneGroups = 0;
+	memset(sceneGroupHash, 0, sizeof(sceneGroupHash));
+}
+
+static int CG_ScenePolyGroup (qhandle_t hShader, int numVerts)
+{
+	scenePolyGroup_t *g;
+	unsigned int h;
+	int n;
+
+	h = ((unsigned int)hShader * 31 + (unsigned int)numVerts) & (SCENE_BATCH_HASH_SIZE - 1);
+	while (sceneGroupHash[h]) {
+		n = sceneGroupHash[h] - 1;
+		if (sceneGroups[n].shader == hShader  &&  sceneGroups[n].numVerts == numVerts) {
+			return n;
+		}
+		h = (h + 1) & (SCENE_BATCH_HASH_SIZE - 1);
+	}
+
+	if (numSceneGroups >= MAX_SCENE_BATCH_GROUPS) {
+		return -1;
+	}
+
+	n = numSceneGroups;
+	numSceneGroups++;
+	sceneGroupHash[h] = n + 1;
+
+	g = &sceneGroups[n];
+	g->shader = hShader;
+	g->numVerts = numVerts;
+	g->numPolys = 0;
+
+	return n;
+}
+
+void CG_AddRefEntityToSceneBatch (const refEntity_t *re)
+{
+	if (!cg_sceneBatching.integer) {
+		trap_R_AddRefEntityToScene(re);
+		return;
+	}
+
+	if (numSceneEntities >= MAX_SCENE_BATCH_ENTITIES) {
+		CG_FlushSceneEntities();
+	}
+
+	memcpy(&sceneEntities[numSceneEntities], re, sizeof(refEntity_t));
+	numSceneEntities++;
+}
+
+void CG_AddPolyToSceneBatch (qhandle_t hShader, int numVerts, const polyVert_t *verts)
+{
+	int group;
+
+	if (!cg_sceneBatching.integer  ||  numVerts > MAX_SCENE_BATCH_POLYVERTS) {
+		trap_R_AddPolyToScene(hShader, numVerts, verts, qfalse);
+		return;
+	}
+
+	if (!hShader  ||  numVerts <= 0) {
+		return;
+	}
+
+	if (numScenePolys >= MAX_SCENE_BATCH_POLYS  ||  numScenePolyVerts + numVerts > MAX_SCENE_BATCH_POLYVERTS) {
+		CG_FlushScenePolys();
+	}
+
+	group = CG_ScenePolyGroup(hShader, numVerts);
+	if (group < 0) {
+		CG_FlushScenePolys();
+		group = CG_ScenePolyGroup(hShader, numVerts);
+	}
+
+	memcpy(&scenePolyVerts[numScenePolyVerts], verts, numVerts * sizeof(polyVert_t));
+	scenePolys[numScenePolys].group = group;
+	scenePolys[numScenePolys].firstVert = numScenePolyVerts;
+	numScenePolys++;
+	numScenePolyVerts += numVerts;
+	sceneGroups[group].numPolys++;
+}
+
+void CG_FlushSceneBatch (void)
+{
+	CG_FlushSceneEntities();
+	CG_FlushScenePolys();
+}
+
+// drops anything pending, used when the renderer's scene is cleared
+void CG_ClearSceneBatch (void)
+{
+	numSceneEntities = 0;
+	if (numScenePolys > 0) {
+		numScenePolys = 0;
+		numScenePolyVerts = 0;
+		numSceneGroups = 0;
+		memset(sceneGroupHash, 0, sizeof(sceneGroupHash));
+	}
+}
@@ -0,0 +1,15 @@
+#ifndef cg_scene_h_included
+#define cg_scene_h_included
+
+// Batched scene submission.  Local entities, marks and particles are
+// gathered here and handed to the renderer in bulk instead of one
+// system call each.  Polys are grouped by shader and vertex count so each
+// group is a single trap_R_AddPolysToScene() call.  Batches are flushed
+// after local entities are added and before the scene is rendered.
+
+void CG_AddRefEntityToSceneBatch (const refEntity_t *re);
+void CG_AddPolyToSceneBatch (qhandle_t hShader, int numVerts, const polyVert_t *verts);
+void CG_FlushSceneBatch (void);
+void CG_ClearSceneBatch (void);
+
+#endif  // cg_scene_h_included
@@ -198,8 +198,7 @@ static void CG_TransitionSnapshot( void ) {
 #if 0
 		trap_GetCurrentSnapshotNumber(&n, &t);
 		//r = CG_PeekSnapshot(cgs.processedSnapshotNum + 2, &cg.nextNextSnap);
-		cg.nextNextSnap = &cg.nnSnap;
-		r = CG_PeekSnapshot(n + 1, cg.nextNextSnap);
+		r = CG_GetSnapshotRef(n + 1, &cg.nnSnap, &cg.nextNextSnap);
 		if (!r) {
 			Com_Printf("couldn't get nextNextSnap\n");
 			cg.nextNextSnapValid = qfalse;
@@ -459,8 +458,7 @@ static void CG_SetNextSnap( snapshot_t *snap ) {
 		if (cg.demoPlayback) {
 			trap_GetCurrentSnapshotNumber(&n, &t);
 			//r = CG_PeekSnapshot(cgs.processedSnapshotNum + 2, &cg.nextNextSnap);
-			cg.nextNextSnap = &cg.nnSnap;
-			r = CG_PeekSnapshot(n + 1, cg.nextNextSnap);
+			r = CG_GetSnapshotRef(n + 1, &cg.nnSnap, &cg.nextNextSnap);
 			if (!r) {
 				//Com_Printf("couldn't get nextNextSnap\n");
 				cg.nextNextSnapValid = qfalse;
@@ -579,6 +577,16 @@ static void CG_SetNextSnap( snapshot_t *snap ) {
 	CG_BuildSolidList();
 }
 
+static void CG_SetSnapshotRef (const snapshot_t *snapshot, snapshotRef_t *ref)
+{
+	ref->serverTime = snapshot->serverTime;
+	ref->messageNum = snapshot->messageNum;
+	ref->snapFlags = snapshot->snapFlags;
+	ref->ps = &snapshot->ps;
+	ref->numEntities = snapshot->numEntities;
+	ref->snapshot = snapshot;
+}
+
 void CG_ResetTimeChange (int serverTime, int ioverf)
 {
 	int i;
@@ -594,6 +602,7 @@ void CG_ResetTimeChange (int serverTime, int ioverf)
 	entityState_t *state;
 	int j;
 	snapshot_t *snap;
+	snapshot_t *nextNextSnap;
 	//qboolean rewinding;
 	int snapshotBackups;
 	int lastPickup;
@@ -654,7 +663,8 @@ void CG_ResetTimeChange (int serverTime, int ioverf)
 
 	cg.snap = NULL;
 	cg.nextSnap = NULL;
-	cg.nextNextSnap = NULL;
+	nextNextSnap = NULL;
+	cg.nextNextSnapValid = qfalse;
 
 	trap_S_ClearLoopingSounds(qtrue);
 	CG_ResetTimedItemPickupTimes();
@@ -1021,8 +1031,8 @@ void CG_ResetTimeChange (int serverTime, int ioverf)
 					cg.snap = &wcg.snaps[(wcg.curSnapshotNumber - 1) % MAX_SNAPSHOT_BACKUP];
 				} else if (!cg.nextSnap) {
 					cg.nextSnap = &wcg.snaps[(wcg.curSnapshotNumber - 1) % MAX_SNAPSHOT_BACKUP];
-				} else if (!cg.nextNextSnap) {
-					cg.nextNextSnap = &wcg.snaps[(wcg.curSnapshotNumber - 1) % MAX_SNAPSHOT_BACKUP];
+				} else if (!nextNextSnap) {
+					nextNextSnap = &wcg.snaps[(wcg.curSnapshotNumber - 1) % MAX_SNAPSHOT_BACKUP];
 					checkNoMove = qtrue;
 					cg.nextNextSnapValid = qtrue;
 				} else {
@@ -1030,11 +1040,12 @@ void CG_ResetTimeChange (int serverTime, int ioverf)
 					cg.nextNextSnapValid = qtrue;
 
 					cg.snap = cg.nextSnap;
-					cg.nextSnap = cg.nextNextSnap;
-					cg.nextNextSnap = &wcg.snaps[(wcg.curSnapshotNumber - 1) % MAX_SNAPSHOT_BACKUP];
+					cg.nextSnap = nextNextSnap;
+					nextNextSnap = &wcg.snaps[(wcg.curSnapshotNumber - 1) % MAX_SNAPSHOT_BACKUP];
 				}
 
 				if (checkNoMove) {
+					CG_SetSnapshotRef(nextNextSnap, &cg.nextNextSnap);
 
 					for (j = 0;  j < MAX_GENTITIES;  j++) {
 						cg_entities[j].inCurrentSnapshot = qfalse;
@@ -1792,6 +1803,26 @@ qboolean CG_GetSnapshot (int snapshotNumber, snapshot_t *snapshot)
 	qboolean r;
 	entityState_t *es;
 	int i;
+#ifdef CGAME_HARD_LINKED
+	snapshotView_t view;
+
+	// cg.snap and cg.nextSnap are modified and outlive the client's
+	// buffers, so they're still copies but read through a view
+	if (!cgs.ospEncrypt  &&  snapshotNumber <= cg.latestSnapshotNum  &&  trap_GetSnapshotView(snapshotNumber, &view)) {
+		snapshot->snapFlags = view.snapFlags;
+		snapshot->serverCommandSequence = view.serverCommandSequence;
+		snapshot->ping = view.ping;
+		snapshot->serverTime = view.serverTime;
+		snapshot->messageNum = view.messageNum;
+		memcpy(snapshot->areamask, view.areamask, sizeof(snapshot->areamask));
+		snapshot->ps = *view.ps;
+		snapshot->numEntities = view.numEntities;
+		for (i = 0;  i < view.numEntities;  i++) {
+			snapshot->entities[i] = *SnapshotViewEntity(&view, i);
+		}
+		return qtrue;
+	}
+#endif
 
 	r = trap_GetSnapshot(snapshotNumber, snapshot);
 	if (!r) {
@@ -1834,3 +1865,120 @@ qboolean CG_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot)
 
 	return r;
 }
+
+/*
+==================
+CG_GetSnapshotRef
+
+Avoids copying the snapshot when the hard linked cgame can read it in
+place, snapshots past the latest one are peeked by the client.  Otherwise
+it's copied into snapshot.  If this fails the snapshot's old contents are
+still referenced, same as using CG_GetSnapshot() and CG_PeekSnapshot()
+directly.
+==================
+*/
+qboolean CG_GetSnapshotRef (int snapshotNumber, snapshot_t *snapshot, snapshotRef_t *ref)
+{
+	qboolean r;
+
+#ifdef CGAME_HARD_LINKED
+	// ospEncrypt needs a modified copy of the entities
+	if (!cgs.ospEncrypt  &&  trap_GetSnapshotView(snapshotNumber, &ref->view)) {
+		ref->serverTime = ref->view.serverTime;
+		ref->messageNum = ref->view.messageNum;
+		ref->snapFlags = ref->view.snapFlags;
+		ref->ps = ref->view.ps;
+		ref->numEntities = ref->view.numEntities;
+		ref->snapshot = NULL;
+		return qtrue;
+	}
+#endif
+
+	if (snapshotNumber > cg.latestSnapshotNum) {
+		r = CG_PeekSnapshot(snapshotNumber, snapshot);
+	} else {
+		r = CG_GetSnapshot(snapshotNumber, snapshot);
+	}
+
+	CG_SetSnapshotRef(snapshot, ref);
+
+	return r;
+}
+
+/*
+==================
+CG_SnapshotRefValid
+
+qtrue if a view can still be read, copies aren't tracked and have to be
+read again
+==================
+*/
+qboolean CG_SnapshotRefValid (const snapshotRef_t *ref)
+{
+#ifdef CGAME_HARD_LINKED
+	if (!ref->snapshot  &&  ref->ps) {
+		return trap_SnapshotViewValid(&ref->view);
+	}
+#endif
+
+	return qfalse;
+}
+
+/*
+==================
+CG_UpdateSnapshotRef
+
+Same as CG_GetSnapshotRef() but keeps ref if it's still a valid view of
+snapshotNumber.
+==================
+*/
+qboolean CG_UpdateSnapshotRef (int snapshotNumber, snapshot_t *snapshot, snapshotRef_t *ref)
+{
+	if (ref->messageNum == snapshotNumber  &&  CG_SnapshotRefValid(ref)) {
+		return qtrue;
+	}
+
+	return CG_GetSnapshotRef(snapshotNumber, snapshot, ref);
+}
+
+/*
+==================
+CG_SnapshotRefEntity
+==================
+*/
+const entityState_t *CG_SnapshotRefEntity (const snapshotRef_t *ref, int n)
+{
+#ifdef CGAME_HARD_LINKED
+	if (!ref->snapshot) {
+		return SnapshotViewEntity(&ref->view, n);
+	}
+#endif
+
+	return &ref->snapshot->entities[n];
+}
+
+/*
+==================
+CG_NextNextSnapshot
+
+The snapshot after cg.nextSnap or NULL.  A peeked view only lasts until
+the next peek, it's read again if that happened.
+==================
+*/
+const snapshotRef_t *CG_NextNextSnapshot (void)
+{
+	if (!cg.nextNextSnapValid) {
+		return NULL;
+	}
+
+	if (cg.nextNextSnap.snapshot  ||  CG_SnapshotRefValid(&cg.nextNextSnap)) {
+		return &cg.nextNextSnap;
+	}
+
+	if (!CG_GetSnapshotRef(cg.nextNextSnap.messageNum, &cg.nnSnap, &cg.nextNextSnap)) {
+		cg.nextNextSnapValid = qfalse;
+		return NULL;
+	}
+
+	return &cg.nextNextSnap;
+}
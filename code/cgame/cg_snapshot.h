@@ -7,4 +7,10 @@ void CG_ProcessSnapshots( void );
 qboolean CG_GetSnapshot (int snapshotNumber, snapshot_t *snapshot);
 qboolean CG_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot);
 
+qboolean CG_GetSnapshotRef (int snapshotNumber, snapshot_t *snapshot, snapshotRef_t *ref);
+qboolean CG_SnapshotRefValid (const snapshotRef_t *ref);
+qboolean CG_UpdateSnapshotRef (int snapshotNumber, snapshot_t *snapshot, snapshotRef_t *ref);
+const entityState_t *CG_SnapshotRefEntity (const snapshotRef_t *ref, int n);
+const snapshotRef_t *CG_NextNextSnapshot (void);
+
 #endif  // cg_snapshot_h_included
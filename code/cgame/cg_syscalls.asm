@@ -149,3 +149,11 @@ equ trap_GetLastServerTime -152
 equ trap_R_GetFontInfo -153
 equ trap_GetRoundStartTimes -154
 equ trap_GetTeamSwitchTime -155
+equ trap_ProfileBegin -156
+equ trap_ProfileEnd -157
+equ trap_R_AddRefEntitiesToScene -158
+equ trap_CM_TraceBatch -159
+equ trap_FS_Prefetch -160
+equ trap_CM_CreateTraceContext -161
+equ trap_CM_FreeTraceContext -162
+equ trap_CM_TraceBatchContext -163
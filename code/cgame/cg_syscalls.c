@@ -100,6 +100,11 @@ int trap_FS_Seek( fileHandle_t f, long offset, int origin ) {
 	return syscall( CG_FS_SEEK, f, offset, origin );
 }
 
+void trap_FS_Prefetch (const char *qpath)
+{
+	syscall(CG_FS_PREFETCH, qpath);
+}
+
 void	trap_SendConsoleCommand( const char *text ) {
 	syscall( CG_SENDCONSOLECOMMAND, text );
 }
@@ -158,6 +163,27 @@ void	trap_CM_BoxTrace( trace_t *results, const vec3_t start, const vec3_t end,
 	syscall( CG_CM_BOXTRACE, results, start, end, mins, maxs, model, brushmask );
 }
 
+// mins and maxs are NULL for point traces or hold one box per trace
+void trap_CM_TraceBatch (trace_t *results, const vec3_t *starts, const vec3_t *ends, const vec3_t *mins, const vec3_t *maxs, int numTraces, clipHandle_t model, int brushmask)
+{
+	syscall(CG_CM_TRACEBATCH, results, starts, ends, mins, maxs, numTraces, model, brushmask);
+}
+
+int trap_CM_CreateTraceContext (void)
+{
+	return syscall(CG_CM_CREATETRACECONTEXT);
+}
+
+void trap_CM_FreeTraceContext (int traceContext)
+{
+	syscall(CG_CM_FREETRACECONTEXT, traceContext);
+}
+
+void trap_CM_TraceBatchContext (int traceContext, trace_t *results, const vec3_t *starts, const vec3_t *ends, const vec3_t *mins, const vec3_t *maxs, int numTraces, clipHandle_t model, int brushmask)
+{
+	syscall(CG_CM_TRACEBATCHCONTEXT, traceContext, results, starts, ends, mins, maxs, numTraces, model, brushmask);
+}
+
 void	trap_CM_CapsuleTrace( trace_t *results, const vec3_t start, const vec3_t end,
 						  const vec3_t mins, const vec3_t maxs,
 						  clipHandle_t model, int brushmask ) {
@@ -271,6 +297,11 @@ void trap_R_AddRefEntityPtrToScene (refEntity_t *re)
 	syscall(CG_R_ADDREFENTITYPTRTOSCENE, re);
 }
 
+void trap_R_AddRefEntitiesToScene (const refEntity_t *re, int numEnts)
+{
+	syscall(CG_R_ADDREFENTITIESTOSCENE, re, numEnts);
+}
+
 void	trap_R_AddPolyToScene( qhandle_t hShader , int numVerts, const polyVert_t *verts, int lightmap ) {
 	syscall( CG_R_ADDPOLYTOSCENE, hShader, numVerts, verts, lightmap );
 }
@@ -372,6 +403,19 @@ qboolean	trap_PeekSnapshot( int snapshotNumber, snapshot_t *snapshot ) {
 	return syscall( CG_PEEKSNAPSHOT, snapshotNumber, snapshot );
 }
 
+#ifdef CGAME_HARD_LINKED
+// not system calls, these return pointers into the client's buffers
+qboolean trap_GetSnapshotView (int snapshotNumber, snapshotView_t *view)
+{
+	return CL_GetSnapshotView(snapshotNumber, view);
+}
+
+qboolean trap_SnapshotViewValid (const snapshotView_t *view)
+{
+	return CL_SnapshotViewValid(view);
+}
+#endif
+
 qboolean	trap_GetServerCommand( int serverCommandNumber ) {
 	return syscall( CG_GETSERVERCOMMAND, serverCommandNumber );
 }
@@ -680,3 +724,13 @@ qboolean trap_GetTeamSwitchTime (int clientNum, int startTime, int *teamSwitchTi
 {
 	return syscall(CG_GETTEAMSWITCHTIME, clientNum, startTime, teamSwitchTime);
 }
+
+void trap_ProfileBegin (const char *name)
+{
+	syscall(CG_PROFILE_BEGIN, name);
+}
+
+void trap_ProfileEnd (void)
+{
+	syscall(CG_PROFILE_END);
+}
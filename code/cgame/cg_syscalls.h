@@ -39,6 +39,8 @@ void		trap_FS_Read( void *buffer, int len, fileHandle_t f );
 void		trap_FS_Write( const void *buffer, int len, fileHandle_t f );
 void		trap_FS_FCloseFile( fileHandle_t f );
 int			trap_FS_Seek( fileHandle_t f, long offset, int origin ); // fsOrigin_t
+// reads the file on a background thread so a later load doesn't hit the disk
+void trap_FS_Prefetch (const char *qpath);
 
 // add commands to the local console as if they were typed in
 // for map changing, etc.  The command is not executed immediately,
@@ -68,6 +70,12 @@ int			trap_CM_TransformedPointContents( const vec3_t p, clipHandle_t model, cons
 void		trap_CM_BoxTrace( trace_t *results, const vec3_t start, const vec3_t end,
 					  const vec3_t mins, const vec3_t maxs,
 					  clipHandle_t model, int brushmask );
+void trap_CM_TraceBatch (trace_t *results, const vec3_t *starts, const vec3_t *ends, const vec3_t *mins, const vec3_t *maxs, int numTraces, clipHandle_t model, int brushmask);
+// a thread that traces while the main thread does needs its own context,
+// created and freed on the main thread.  0 is the shared context.
+int trap_CM_CreateTraceContext (void);
+void trap_CM_FreeTraceContext (int traceContext);
+void trap_CM_TraceBatchContext (int traceContext, trace_t *results, const vec3_t *starts, const vec3_t *ends, const vec3_t *mins, const vec3_t *maxs, int numTraces, clipHandle_t model, int brushmask);
 void    trap_CM_CapsuleTrace( trace_t *results, const vec3_t start, const vec3_t end,
 							  const vec3_t mins, const vec3_t maxs,
 							  clipHandle_t model, int brushmask );
@@ -123,6 +131,7 @@ qhandle_t	trap_R_RegisterShaderNoMip( const char *name );			// returns all white
 void		trap_R_ClearScene( void );
 void		trap_R_AddRefEntityToScene( const refEntity_t *re );
 void trap_R_AddRefEntityPtrToScene (refEntity_t *re);
+void trap_R_AddRefEntitiesToScene (const refEntity_t *re, int numEnts);
 
 // polys are intended for simple wall marks, not really for doing
 // significant construction
@@ -161,6 +170,10 @@ void		trap_GetCurrentSnapshotNumber( int *snapshotNumber, int *serverTime );
 // old that it has fallen out of the client system queue
 qboolean	trap_GetSnapshot( int snapshotNumber, snapshot_t *snapshot );
 qboolean	trap_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot);
+#ifdef CGAME_HARD_LINKED
+qboolean trap_GetSnapshotView (int snapshotNumber, snapshotView_t *view);
+qboolean trap_SnapshotViewValid (const snapshotView_t *view);
+#endif
 
 // retrieve a text command from the server stream
 // the current snapshot will hold the number of the most recent command
@@ -248,4 +261,6 @@ qboolean trap_R_GetGlyphInfo (const fontInfo_t *fontInfo, int charValue, glyphIn
 qboolean trap_R_GetFontInfo (int fontId, fontInfo_t *font);
 void trap_GetRoundStartTimes (int *numRoundStarts, int *roundStarts);
 qboolean trap_GetTeamSwitchTime (int clientNum, int startTime, int *teamSwitchTime);
+void trap_ProfileBegin (const char *name);
+void trap_ProfileEnd (void);
 #endif  // cg_syscalls_h_included
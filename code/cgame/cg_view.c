@@ -13,9 +13,11 @@
 #include "cg_localents.h"
 #include "cg_main.h"
 #include "cg_marks.h"
+#include "cg_mem.h"
 #include "cg_players.h"  // CG_Q3ColorFromString()
 #include "cg_predict.h"
 #include "cg_q3mme_camera.h"
+#include "cg_scene.h"
 #include "cg_servercmds.h"  // CG_PlayBufferedVoiceChats()
 #include "cg_snapshot.h"
 #include "cg_sound.h"
@@ -986,12 +988,18 @@ static int CG_CalcViewValues( void ) {
 			static int oldCurrentNum = 0;
 			int nextNum;
 			qboolean r;
-			const snapshot_t *old;
-			const snapshot_t *new;
+			const snapshotRef_t *oldRef;
+			const snapshotRef_t *newRef;
+			const playerState_t *oldPs;
+			const playerState_t *newPs;
+			int oldServerTime;
+			int newServerTime;
 
 			if (cg_demoSmoothing.integer == 2) {
-				old = cg.snap;
-				new = cg.nextSnap;
+				oldPs = &cg.snap->ps;
+				oldServerTime = cg.snap->serverTime;
+				newPs = &cg.nextSnap->ps;
+				newServerTime = cg.nextSnap->serverTime;
 			} else {
 				int smoothNum;
 
@@ -1000,66 +1008,70 @@ static int CG_CalcViewValues( void ) {
 					smoothNum = PACKET_BACKUP - 1;
 				}
 
-				//FIXME store values and only get on snapshot transition
 				currentNum = cg.snap->messageNum - cg.snap->messageNum % (smoothNum -  1);
 				nextNum = currentNum + (smoothNum - 1);
 
 				//Com_Printf("current %d  next %d\n", currentNum, nextNum);
 
 				//FIXME check returns
-				r = CG_GetSnapshot(currentNum, &cg.smoothOldSnap);
+				// views are kept until the snapshots change
+				oldRef = &cg.smoothOldRef;
+				newRef = &cg.smoothNewRef;
+				r = CG_UpdateSnapshotRef(currentNum, &cg.smoothOldSnap, &cg.smoothOldRef);
 				if (!r) {
 					//Com_Printf("^3smooth couldn't get old snapshot %d\n", currentNum);
 				}
-				if (cg.smoothOldSnap.messageNum != currentNum) {
-					//Com_Printf("^3smooth got wrong old snap number %d != %d (want)\n", cg.smoothOldSnap.messageNum, currentNum);
+				if (oldRef->messageNum != currentNum) {
+					//Com_Printf("^3smooth got wrong old snap number %d != %d (want)\n", oldRef->messageNum, currentNum);
 				}
-				r = CG_PeekSnapshot(nextNum, &cg.smoothNewSnap);
+				r = CG_UpdateSnapshotRef(nextNum, &cg.smoothNewSnap, &cg.smoothNewRef);
 				if (!r) {
 					//Com_Printf("^3smooth couldn't get next snapshot %d\n", nextNum);
 				}
-				if (cg.smoothNewSnap.messageNum != nextNum) {
-					//Com_Printf("^1smooth got wrong next snap number %d != %d (want)\n", cg.smoothNewSnap.messageNum, nextNum);
+				if (newRef->messageNum != nextNum) {
+					//Com_Printf("^1smooth got wrong next snap number %d != %d (want)\n", newRef->messageNum, nextNum);
 				}
 
-				old = &cg.smoothOldSnap;
-				new = &cg.smoothNewSnap;
+				oldPs = oldRef->ps;
+				oldServerTime = oldRef->serverTime;
+				newPs = newRef->ps;
+				newServerTime = newRef->serverTime;
 
 				if (oldCurrentNum != currentNum) {
 				    //FIXME this is being done every drawn frame instead
 				    // of every snapshot transition frame
-				    //Com_Printf("^2transition yaw : (%d) %f -> (%d) %f\n", currentNum, old->ps.viewangles[YAW], nextNum, new->ps.viewangles[YAW]);
+				    //Com_Printf("^2transition yaw : (%d) %f -> (%d) %f\n", currentNum, oldPs->viewangles[YAW], nextNum, newPs->viewangles[YAW]);
 				}
 				oldCurrentNum = currentNum;
 			}
 
-			//Com_Printf("old %d  new %d\n", old->ps.eFlags & EF_TELEPORT_BIT, new->ps.eFlags & EF_TELEPORT_BIT);
+			//Com_Printf("old %d  new %d\n", oldPs->eFlags & EF_TELEPORT_BIT, newPs->eFlags & EF_TELEPORT_BIT);
 
 				if (cg_demoSmoothingTeleportCheck.integer && (
-				        old->ps.clientNum != new->ps.clientNum  ||  ((old->ps.eFlags ^ new->ps.eFlags) & EF_TELEPORT_BIT)
+				        oldPs->clientNum != newPs->clientNum  ||  ((oldPs->eFlags ^ newPs->eFlags) & EF_TELEPORT_BIT)
 					  ||
-				        old->ps.persistant[PERS_SPAWN_COUNT] != new->ps.persistant[PERS_SPAWN_COUNT])
+				        oldPs->persistant[PERS_SPAWN_COUNT] != newPs->persistant[PERS_SPAWN_COUNT])
 				) {
 				//Com_Printf("^3teleport %f\n", cg.ftime);
 				// don't interp
 				f = 0;
 			} else {
-				f = (cg.ftime - (double)old->serverTime) / (double)(new->serverTime - old->serverTime);
+				f = (cg.ftime - (double)oldServerTime) / (double)(newServerTime - oldServerTime);
 			}
 
-			//CG_Printf("cg.time %f  old %d  new %d\n", cg.ftime, old->serverTime, new->serverTime);
+			//CG_Printf("cg.time %f  old %d  new %d\n", cg.ftime, oldServerTime, newServerTime);
 			//CG_Printf("lll %d  f %f\n", cg.snap->serverTime, f);
 
-			origin[0] = old->ps.origin[0] + f * (new->ps.origin[0] - old->ps.origin[0]);
-			origin[1] = old->ps.origin[1] + f * (new->ps.origin[1] - old->ps.origin[1]);
-			origin[2] = old->ps.origin[2] + f * (new->ps.origin[2] - old->ps.origin[2]);
+			origin[0] = oldPs->origin[0] + f * (newPs->origin[0] - oldPs->origin[0]);
+			origin[1] = oldPs->origin[1] + f * (newPs->origin[1] - oldPs->origin[1]);
+			origin[2] = oldPs->origin[2] + f * (newPs->origin[2] - oldPs->origin[2]);
 
 			VectorCopy(origin, cg.refdef.vieworg);
 
 			if (cg_demoSmoothingAngles.integer) {
-				angles[0] = LerpAngleNear(old->ps.viewangles[0], new->ps.viewangles[0], f);
-				angles[1] = LerpAngleNear(old->ps.viewangles[1], new->ps.viewangles[1], f);
-				angles[2] = LerpAngleNear(old->ps.viewangles[2], new->ps.viewangles[2], f);
+				angles[0] = LerpAngleNear(oldPs->viewangles[0], newPs->viewangles[0], f);
+				angles[1] = LerpAngleNear(oldPs->viewangles[1], newPs->viewangles[1], f);
+				angles[2] = LerpAngleNear(oldPs->viewangles[2], newPs->viewangles[2], f);
 				VectorCopy(angles, cg.refdefViewAngles);
 			} else {
 				VectorCopy(ps->viewangles, cg.refdefViewAngles);
@@ -5223,6 +5235,8 @@ void CG_DrawActiveFrame (int serverTime, stereoFrame_t stereoView, qboolean demo
 	}
 #endif
 
+	CG_ResetFrameArena();
+
 	FxLoopSounds = FX_LOOP_SOUNDS_BASE;
 	CG_ClearLocalFrameEntities();
 	CG_CleanUpFieldNumber();
@@ -5379,12 +5393,16 @@ void CG_DrawActiveFrame (int serverTime, stereoFrame_t stereoView, qboolean demo
 	// clear all the render lists
 	if (draw) {  //(1)  {  //!paused) {
 		trap_R_ClearScene();
+		cg.portalSurfaceAdded = qfalse;
+		CG_ClearSceneBatch();
 		CG_DrawDecals();
 		//CG_ForceBModels();
 	}
 
 	// set up cg.snap and possibly cg.nextSnap
+	trap_ProfileBegin("CG_ProcessSnapshots");
 	CG_ProcessSnapshots();
+	trap_ProfileEnd();
 	oldClientNum = wcg.clientNum;
 	if (wolfcam_following) {  //  &&  !cg.fragForwarding) {
 		static int wolfcamLastClientNum = -1;
@@ -5579,7 +5597,9 @@ void CG_DrawActiveFrame (int serverTime, stereoFrame_t stereoView, qboolean demo
 
 	// build the render lists
 	if ( !cg.hyperspace  ||  wolfcam_following) {
+		trap_ProfileBegin("CG_AddPacketEntities");
 		CG_AddPacketEntities();			// alter calcViewValues, so predicted player state is correct
+		trap_ProfileEnd();
         //Wolfcam_MarkValidEntities();
 		//Com_Printf("cgs.gametype: %d\n", cgs.gametype);
 		// cg.snap->ps.persistant[PERS_HWEAPON_USE]
@@ -5860,7 +5880,10 @@ void CG_DrawActiveFrame (int serverTime, stereoFrame_t stereoView, qboolean demo
 	}
 
 	if (draw) {
+		trap_ProfileBegin("CG_AddLocalEntities");
 		CG_AddLocalEntities();
+		CG_FlushSceneBatch();
+		trap_ProfileEnd();
 	}
 	//FIXME force
 	//CG_UpdateFxExternalForces();
@@ -5884,7 +5907,9 @@ void CG_DrawActiveFrame (int serverTime, stereoFrame_t stereoView, qboolean demo
 
 	// actually issue the rendering calls
 	if (draw) {
+		trap_ProfileBegin("CG_DrawActive");
 		CG_DrawActive( stereoView );
+		trap_ProfileEnd();
 	}
 
 	if ( cg_stats.integer ) {
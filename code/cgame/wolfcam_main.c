@@ -1,6 +1,7 @@
 #include "cg_local.h"
 
 #include "cg_main.h"
+#include "cg_scene.h"
 #include "cg_syscalls.h"
 #include "sc.h"
 #include "wolfcam_main.h"
@@ -128,42 +129,42 @@ void Wolfcam_AddBox (const vec3_t origin, int x, int y, int z, int red, int gree
 	VectorCopy( corners[1], verts[1].xyz );
 	VectorCopy( corners[2], verts[2].xyz );
 	VectorCopy( corners[3], verts[3].xyz );
-	trap_R_AddPolyToScene( cgs.media.bboxShader, 4, verts, qfalse );
+	CG_AddPolyToSceneBatch( cgs.media.bboxShader, 4, verts );
 
 	// bottom
 	VectorCopy( corners[7], verts[0].xyz );
 	VectorCopy( corners[6], verts[1].xyz );
 	VectorCopy( corners[5], verts[2].xyz );
 	VectorCopy( corners[4], verts[3].xyz );
-	trap_R_AddPolyToScene( cgs.media.bboxShader, 4, verts, qfalse );
+	CG_AddPolyToSceneBatch( cgs.media.bboxShader, 4, verts );
 
 	// top side
 	VectorCopy( corners[3], verts[0].xyz );
 	VectorCopy( corners[2], verts[1].xyz );
 	VectorCopy( corners[6], verts[2].xyz );
 	VectorCopy( corners[7], verts[3].xyz );
-	trap_R_AddPolyToScene( cgs.media.bboxShader_nocull, 4, verts, qfalse );
+	CG_AddPolyToSceneBatch( cgs.media.bboxShader_nocull, 4, verts );
 
 	// left side
 	VectorCopy( corners[2], verts[0].xyz );
 	VectorCopy( corners[1], verts[1].xyz );
 	VectorCopy( corners[5], verts[2].xyz );
 	VectorCopy( corners[6], verts[3].xyz );
-	trap_R_AddPolyToScene( cgs.media.bboxShader_nocull, 4, verts, qfalse );
+	CG_AddPolyToSceneBatch( cgs.media.bboxShader_nocull, 4, verts );
 
 	// right side
 	VectorCopy( corners[0], verts[0].xyz );
 	VectorCopy( corners[3], verts[1].xyz );
 	VectorCopy( corners[7], verts[2].xyz );
 	VectorCopy( corners[4], verts[3].xyz );
-	trap_R_AddPolyToScene( cgs.media.bboxShader_nocull, 4, verts, qfalse );
+	CG_AddPolyToSceneBatch( cgs.media.bboxShader_nocull, 4, verts );
 
 	// bottom side
 	VectorCopy( corners[1], verts[0].xyz );
 	VectorCopy( corners[0], verts[1].xyz );
 	VectorCopy( corners[4], verts[2].xyz );
 	VectorCopy( corners[5], verts[3].xyz );
-	trap_R_AddPolyToScene( cgs.media.bboxShader_nocull, 4, verts, qfalse );
+	CG_AddPolyToSceneBatch( cgs.media.bboxShader_nocull, 4, verts );
 }
 
 /*
@@ -287,42 +288,42 @@ void Wolfcam_AddBoundingBox( const centity_t *cent ) {
 	VectorCopy( corners[1], verts[1].xyz );
 	VectorCopy( corners[2], verts[2].xyz );
 	VectorCopy( corners[3], verts[3].xyz );
-	trap_R_AddPolyToScene( cgs.media.bboxShader, 4, verts, qfalse );
+	CG_AddPolyToSceneBatch( cgs.media.bboxShader, 4, verts );
 
 	// bottom
 	VectorCopy( corners[7], verts[0].xyz );
 	VectorCopy( corners[6], verts[1].xyz );
 	VectorCopy( corners[5], verts[2].xyz );
 	VectorCopy( corners[4], verts[3].xyz );
-	trap_R_AddPolyToScene( cgs.media.bboxShader, 4, verts, qfalse );
+	CG_AddPolyToSceneBatch( cgs.media.bboxShader, 4, verts );
 
 	// top side
 	VectorCopy( corners[3], verts[0].xyz );
 	VectorCopy( corners[2], verts[1].xyz );
 	VectorCopy( corners[6], verts[2].xyz );
 	VectorCopy( corners[7], verts[3].xyz );
-	trap_R_AddPolyToScene( cgs.media.bboxShader_nocull, 4, verts, qfalse );
+	CG_AddPolyToSceneBatch( cgs.media.bboxShader_nocull, 4, verts );
 
 	// left side
 	VectorCopy( corners[2], verts[0].xyz );
 	VectorCopy( corners[1], verts[1].xyz );
 	VectorCopy( corners[5], verts[2].xyz );
 	VectorCopy( corners[6], verts[3].xyz );
-	trap_R_AddPolyToScene( cgs.media.bboxShader_nocull, 4, verts, qfalse );
+	CG_AddPolyToSceneBatch( cgs.media.bboxShader_nocull, 4, verts );
 
 	// right side
 	VectorCopy( corners[0], verts[0].xyz );
 	VectorCopy( corners[3], verts[1].xyz );
 	VectorCopy( corners[7], verts[2].xyz );
 	VectorCopy( corners[4], verts[3].xyz );
-	trap_R_AddPolyToScene( cgs.media.bboxShader_nocull, 4, verts, qfalse );
+	CG_AddPolyToSceneBatch( cgs.media.bboxShader_nocull, 4, verts );
 
 	// bottom side
 	VectorCopy( corners[1], verts[0].xyz );
 	VectorCopy( corners[0], verts[1].xyz );
 	VectorCopy( corners[4], verts[2].xyz );
 	VectorCopy( corners[5], verts[3].xyz );
-	trap_R_AddPolyToScene( cgs.media.bboxShader_nocull, 4, verts, qfalse );
+	CG_AddPolyToSceneBatch( cgs.media.bboxShader_nocull, 4, verts );
 }
 
 int Wolfcam_PlayerHealth (int clientNum)
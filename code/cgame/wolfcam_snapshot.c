@@ -3,6 +3,7 @@
 #include "cg_draw.h"  //  CG_lagometerMarkNoMove
 #include "cg_main.h"
 #include "cg_players.h"
+#include "cg_snapshot.h"
 #include "wolfcam_snapshot.h"
 
 #include "wolfcam_local.h"
@@ -21,6 +22,7 @@ void Wolfcam_CheckNoMove (void)
 	const entityState_t *es;
 	entityState_t *nes;
 	const entityState_t *nnes;
+	const snapshotRef_t *nextNextSnap;
 	qboolean inNextNextSnapshot;
 	qboolean nextNextReset;
 
@@ -38,7 +40,8 @@ void Wolfcam_CheckNoMove (void)
 	}
 
 #if 1
-	if (!cg.nextNextSnapValid) {
+	nextNextSnap = CG_NextNextSnapshot();
+	if (!nextNextSnap) {
 		//Com_Printf("FIXME Wolfcam_CheckNoMove() !cg.nextNextSnapValid\n");
 		//CG_Abort();
 		return;
@@ -49,7 +52,7 @@ void Wolfcam_CheckNoMove (void)
 		return;
 	}
 
-	if ((cg.nextSnap->snapFlags ^ cg.nextNextSnap->snapFlags) & SNAPFLAG_SERVERCOUNT) {
+	if ((cg.nextSnap->snapFlags ^ nextNextSnap->snapFlags) & SNAPFLAG_SERVERCOUNT) {
 		nextNextReset = qtrue;
 	} else {
 		nextNextReset = qfalse;
@@ -86,24 +89,24 @@ void Wolfcam_CheckNoMove (void)
 				cg.noMove = qtrue;
 				wclients[clientNum].noMoveCount++;
 
-				if (cg.snap->ps.clientNum != cg.nextNextSnap->ps.clientNum) {
+				if (cg.snap->ps.clientNum != nextNextSnap->ps->clientNum) {
 					continue;
 				}
-				if ((cg.nextSnap->ps.eFlags ^ cg.nextNextSnap->ps.eFlags) & EF_TELEPORT_BIT) {
+				if ((cg.nextSnap->ps.eFlags ^ nextNextSnap->ps->eFlags) & EF_TELEPORT_BIT) {
 					continue;
 				}
 				if (nextNextReset) {
 					continue;
 				}
 				if (cg_demoSmoothing.integer == 1) {
-					cg.nextSnap->ps.origin[0] = cg.snap->ps.origin[0] + (cg.nextNextSnap->ps.origin[0] - cg.snap->ps.origin[0]) / 2;
-					cg.nextSnap->ps.origin[1] = cg.snap->ps.origin[1] + (cg.nextNextSnap->ps.origin[1] - cg.snap->ps.origin[1]) / 2;
-					cg.nextSnap->ps.origin[2] = cg.snap->ps.origin[2] + (cg.nextNextSnap->ps.origin[2] - cg.snap->ps.origin[2]) / 2;
+					cg.nextSnap->ps.origin[0] = cg.snap->ps.origin[0] + (nextNextSnap->ps->origin[0] - cg.snap->ps.origin[0]) / 2;
+					cg.nextSnap->ps.origin[1] = cg.snap->ps.origin[1] + (nextNextSnap->ps->origin[1] - cg.snap->ps.origin[1]) / 2;
+					cg.nextSnap->ps.origin[2] = cg.snap->ps.origin[2] + (nextNextSnap->ps->origin[2] - cg.snap->ps.origin[2]) / 2;
 
 
-					cg.nextSnap->ps.viewangles[0] = LerpAngle(cg.snap->ps.viewangles[0], cg.nextNextSnap->ps.viewangles[0], 0.5);
-					cg.nextSnap->ps.viewangles[1] = LerpAngle(cg.snap->ps.viewangles[1], cg.nextNextSnap->ps.viewangles[1], 0.5);
-					cg.nextSnap->ps.viewangles[2] = LerpAngle(cg.snap->ps.viewangles[2], cg.nextNextSnap->ps.viewangles[2], 0.5);
+					cg.nextSnap->ps.viewangles[0] = LerpAngle(cg.snap->ps.viewangles[0], nextNextSnap->ps->viewangles[0], 0.5);
+					cg.nextSnap->ps.viewangles[1] = LerpAngle(cg.snap->ps.viewangles[1], nextNextSnap->ps->viewangles[1], 0.5);
+					cg.nextSnap->ps.viewangles[2] = LerpAngle(cg.snap->ps.viewangles[2], nextNextSnap->ps->viewangles[2], 0.5);
 				}
 			}
 		} else {
@@ -146,8 +149,8 @@ void Wolfcam_CheckNoMove (void)
 #endif
 
 			inNextNextSnapshot = qfalse;
-			for (i = 0;  i < cg.nextNextSnap->numEntities;  i++) {
-				nnes = &cg.nextNextSnap->entities[i];
+			for (i = 0;  i < nextNextSnap->numEntities;  i++) {
+				nnes = CG_SnapshotRefEntity(nextNextSnap, i);
 				if (nnes->number == clientNum) {
 					inNextNextSnapshot = qtrue;
 					break;
@@ -959,8 +959,9 @@ int Wolfcam_OffsetFirstPersonView (void)
 	//FIXME 1 0 ?
 	if (cg_demoSmoothing.integer > 2) {
 		float f;
-		const snapshot_t *old;
-		const snapshot_t *new;
+		const snapshotRef_t *old;
+		const snapshotRef_t *new;
+		const entityState_t *es;
 		const entityState_t *esNew;
 		const entityState_t *esOld;
 		int num;
@@ -979,35 +980,37 @@ int Wolfcam_OffsetFirstPersonView (void)
 		}
 		currentNum = cg.snap->messageNum - cg.snap->messageNum % (smoothNum - 1);
 		nextNum = currentNum + (smoothNum - 1);
-		//FIXME getting snapshots every frame instead of at snapshot transition
-		r = CG_GetSnapshot(currentNum, &cg.smoothOldSnap);
+		// views are kept until the snapshots change
+		old = &cg.smoothOldRef;
+		new = &cg.smoothNewRef;
+		r = CG_UpdateSnapshotRef(currentNum, &cg.smoothOldSnap, &cg.smoothOldRef);
 		if (!r) {
 			//Com_Printf("^3smooth couldn't get old snapshot %d\n", currentNum);
 			useSmoothing = qfalse;
 		}
-		r = CG_PeekSnapshot(nextNum, &cg.smoothNewSnap);
+		r = CG_UpdateSnapshotRef(nextNum, &cg.smoothNewSnap, &cg.smoothNewRef);
 		if (!r) {
 			//Com_Printf("^3smooth couldn't get next snapshot %d\n", nextNum);
 			useSmoothing = qfalse;
 		}
-		old = &cg.smoothOldSnap;
-		new = &cg.smoothNewSnap;
 
 		//esOld = &cg_entities[wcg.clientNum].currentState;
 		esOld = NULL;
 		esNew = NULL;
 
 		if (useSmoothing) {
-			for (num = 0;  num < new->numEntities;  num++) {
-				if (old->entities[num].number == wcg.clientNum) {
-					esOld = &old->entities[num];
+			for (num = 0;  num < old->numEntities;  num++) {
+				es = CG_SnapshotRefEntity(old, num);
+				if (es->number == wcg.clientNum) {
+					esOld = es;
 					break;
 				}
 			}
 
 			for (num = 0;  num < new->numEntities;  num++) {
-				if (new->entities[num].number == wcg.clientNum) {
-					esNew = &new->entities[num];
+				es = CG_SnapshotRefEntity(new, num);
+				if (es->number == wcg.clientNum) {
+					esNew = es;
 					break;
 				}
 			}
@@ -65,6 +65,338 @@ static byte buffer[ MAX_AVI_BUFFER ];
 static byte buffer2[8];
 static int  bufIndex = 0;
 
+/*
+=============================================================
+
+Streamed writes
+
+Appends to the avi file are copied into a few large buffers and a
+writer thread puts them on disk, so a slow disk only stalls capture
+once every buffer is waiting to be written.  The buffers are allocated
+when the file is opened.  Code that seeks around in the file to patch
+headers and write indexes pauses the stream first, which waits for the
+writer and goes back to writing through the FILE directly.
+
+=============================================================
+*/
+
+#define AVI_STREAM_BUFFERS 4
+#define MAX_AVI_STREAMS 8
+
+typedef struct aviStream_s {
+    fileHandle_t f;
+    FILE *file;
+
+    int64_t pos;  // end of the file once everything queued is written
+    qboolean paused;
+
+    int bufferSize;
+    byte *data[AVI_STREAM_BUFFERS];
+    int used[AVI_STREAM_BUFFERS];
+    int64_t offset[AVI_STREAM_BUFFERS];  // where the buffer goes in the file
+    qboolean busy[AVI_STREAM_BUFFERS];
+    int current;  // buffer being filled, -1 if none
+
+    // full buffers in the order they were filled, the head one is written
+    // by the thread
+    int queue[AVI_STREAM_BUFFERS];
+    int queueHead;
+    int queueCount;
+
+    qboolean failed;
+    qboolean quit;
+
+    sysThread_t *thread;
+    sysMutex_t *mutex;
+    sysCond_t *cond;  // buffer queued or quit
+    sysCond_t *doneCond;  // buffer written
+} aviStream_t;
+
+static aviStream_t *aviStreams[MAX_AVI_STREAMS];
+
+static void CL_AviStreamThread (void *arg)
+{
+    aviStream_t *s = (aviStream_t *)arg;
+    qboolean ok;
+    int b;
+
+    Sys_LockMutex(s->mutex);
+    while (1) {
+        while (!s->quit  &&  !s->queueCount) {
+            Sys_CondWait(s->cond, s->mutex);
+        }
+        if (!s->queueCount) {
+            break;
+        }
+
+        b = s->queue[s->queueHead];
+        Sys_UnlockMutex(s->mutex);
+
+        ok = !fseeko(s->file, s->offset[b], SEEK_SET)  &&  fwrite(s->data[b], 1, s->used[b], s->file) == (size_t)s->used[b];
+
+        Sys_LockMutex(s->mutex);
+        if (!ok) {
+            s->failed = qtrue;
+        }
+        s->used[b] = 0;
+        s->busy[b] = qfalse;
+        s->queueHead = (s->queueHead + 1) % AVI_STREAM_BUFFERS;
+        s->queueCount--;
+        Sys_CondBroadcast(s->doneCond);
+    }
+    Sys_UnlockMutex(s->mutex);
+}
+
+// returns the stream appends to f should go through, NULL to write directly
+static aviStream_t *CL_AviStreamForHandle (fileHandle_t f)
+{
+    int i;
+
+    for (i = 0;  i < MAX_AVI_STREAMS;  i++) {
+        if (aviStreams[i]  &&  aviStreams[i]->f == f) {
+            return aviStreams[i]->paused ? NULL : aviStreams[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void CL_AviStreamQueueCurrent (aviStream_t *s)
+{
+    Sys_LockMutex(s->mutex);
+    s->queue[(s->queueHead + s->queueCount) % AVI_STREAM_BUFFERS] = s->current;
+    s->queueCount++;
+    Sys_CondSignal(s->cond);
+    Sys_UnlockMutex(s->mutex);
+
+    s->current = -1;
+}
+
+static void CL_AviStreamWrite (aviStream_t *s, const byte *data, int len)
+{
+    qboolean failed;
+    int b;
+    int n;
+
+    while (len > 0) {
+        if (s->current < 0) {
+            Sys_LockMutex(s->mutex);
+            while (1) {
+                for (b = 0;  b < AVI_STREAM_BUFFERS;  b++) {
+                    if (!s->busy[b]) {
+                        break;
+                    }
+                }
+                if (b < AVI_STREAM_BUFFERS) {
+                    break;
+                }
+                Sys_CondWait(s->doneCond, s->mutex);
+            }
+            s->busy[b] = qtrue;
+            failed = s->failed;
+            Sys_UnlockMutex(s->mutex);
+
+            s->current = b;
+            s->used[b] = 0;
+            s->offset[b] = s->pos;
+
+            if (failed) {
+                Com_Error(ERR_DROP, "CL_AviStreamWrite()  failed to write to file  f:%d", s->f);
+            }
+        }
+
+        b = s->current;
+        n = s->bufferSize - s->used[b];
+        if (n > len) {
+            n = len;
+        }
+        Com_Memcpy(s->data[b] + s->used[b], data, n);
+        s->used[b] += n;
+        s->pos += n;
+        data += n;
+        len -= n;
+
+        if (s->used[b] == s->bufferSize) {
+            CL_AviStreamQueueCurrent(s);
+        }
+    }
+}
+
+/*
+===============
+CL_AviStreamPause
+
+Waits until everything is on disk, after this the file can be used
+directly.
+===============
+*/
+static void CL_AviStreamPause (aviFileData_t *afd)
+{
+    aviStream_t *s = afd->stream;
+
+    if (!s  ||  s->paused) {
+        return;
+    }
+
+    if (s->current >= 0) {
+        if (s->used[s->current] > 0) {
+            CL_AviStreamQueueCurrent(s);
+        } else {
+            s->busy[s->current] = qfalse;
+            s->current = -1;
+        }
+    }
+
+    Sys_LockMutex(s->mutex);
+    while (s->queueCount) {
+        Sys_CondWait(s->doneCond, s->mutex);
+    }
+    if (s->failed) {
+        Com_Printf("^1CL_AviStreamPause()  writing to '%s' failed\n", afd->fileName);
+        s->failed = qfalse;
+    }
+    Sys_UnlockMutex(s->mutex);
+
+    s->paused = qtrue;
+}
+
+static void CL_AviStreamResume (aviFileData_t *afd)
+{
+    aviStream_t *s = afd->stream;
+
+    if (!s  ||  !s->paused) {
+        return;
+    }
+
+    fseeko(s->file, 0, SEEK_END);
+    s->pos = ftello(s->file);
+    s->paused = qfalse;
+}
+
+static void CL_AviStreamClose (aviFileData_t *afd)
+{
+    aviStream_t *s = afd->stream;
+    int i;
+
+    if (!s) {
+        return;
+    }
+
+    CL_AviStreamPause(afd);
+
+    if (s->thread) {
+        Sys_LockMutex(s->mutex);
+        s->quit = qtrue;
+        Sys_CondSignal(s->cond);
+        Sys_UnlockMutex(s->mutex);
+        Sys_JoinThread(s->thread);
+    }
+
+    if (s->doneCond) {
+        Sys_DestroyCond(s->doneCond);
+    }
+    if (s->cond) {
+        Sys_DestroyCond(s->cond);
+    }
+    if (s->mutex) {
+        Sys_DestroyMutex(s->mutex);
+    }
+    for (i = 0;  i < AVI_STREAM_BUFFERS;  i++) {
+        free(s->data[i]);
+    }
+
+    for (i = 0;  i < MAX_AVI_STREAMS;  i++) {
+        if (aviStreams[i] == s) {
+            aviStreams[i] = NULL;
+        }
+    }
+
+    free(s);
+    afd->stream = NULL;
+}
+
+/*
+===============
+CL_AviStreamOpen
+
+Falls back to writing directly if anything can't be set up.
+===============
+*/
+static void CL_AviStreamOpen (aviFileData_t *afd)
+{
+    aviStream_t *s;
+    int slot;
+    int i;
+
+    afd->stream = NULL;
+
+    if (!cl_aviWriteThread->integer  ||  !afd->file) {
+        return;
+    }
+
+    for (slot = 0;  slot < MAX_AVI_STREAMS;  slot++) {
+        if (!aviStreams[slot]) {
+            break;
+        }
+    }
+    if (slot >= MAX_AVI_STREAMS) {
+        return;
+    }
+
+    s = calloc(1, sizeof(aviStream_t));
+    if (!s) {
+        return;
+    }
+    afd->stream = s;
+
+    s->f = afd->f;
+    s->file = afd->file;
+    s->current = -1;
+    s->paused = qtrue;  // until everything is set up
+    s->bufferSize = cl_aviWriteBufferSize->integer * 1024 * 1024 / AVI_STREAM_BUFFERS;
+    if (s->bufferSize < 1024 * 1024) {
+        s->bufferSize = 1024 * 1024;
+    }
+
+    for (i = 0;  i < AVI_STREAM_BUFFERS;  i++) {
+        s->data[i] = malloc(s->bufferSize);
+        if (!s->data[i]) {
+            Com_Printf("^3CL_AviStreamOpen()  couldn't allocate write buffers, writing directly\n");
+            CL_AviStreamClose(afd);
+            return;
+        }
+    }
+
+    s->mutex = Sys_CreateMutex();
+    s->cond = Sys_CreateCond();
+    s->doneCond = Sys_CreateCond();
+    if (!s->mutex  ||  !s->cond  ||  !s->doneCond) {
+        CL_AviStreamClose(afd);
+        return;
+    }
+
+    s->thread = Sys_CreateThread(CL_AviStreamThread, s);
+    if (!s->thread) {
+        Com_Printf("^3CL_AviStreamOpen()  couldn't start writer thread, writing directly\n");
+        CL_AviStreamClose(afd);
+        return;
+    }
+
+    aviStreams[slot] = s;
+    CL_AviStreamResume(afd);
+}
+
+// size the file will have once everything written so far is on disk
+static int64_t CL_AviFileSize (const aviFileData_t *afd)
+{
+    if (afd->stream  &&  !afd->stream->paused) {
+        return afd->stream->pos;
+    }
+
+    fseeko(afd->file, 0, SEEK_END);
+    return ftello(afd->file);
+}
+
 /*
 ===============
 SafeFS_Write
@@ -72,14 +404,19 @@ SafeFS_Write
 */
 static ID_INLINE void SafeFS_Write( const void *buffer, int len, fileHandle_t f )
 {
+    aviStream_t *s;
     int r;
 
+    s = CL_AviStreamForHandle(f);
+    if (s) {
+        CL_AviStreamWrite(s, buffer, len);
+        return;
+    }
+
     r = FS_Write(buffer, len, f);
     if (r < len) {
         Com_Error(ERR_DROP, "SafeFS_Write()  failed to write to file %d < %d  f:%d", r, len, f);
     }
-
-    FS_Flush(f);
 }
 
 /*
@@ -558,6 +895,194 @@ static void CL_InitIndexes (const aviFileData_t *afd)
 
 extern int sys_timeBase;
 
+// afdScaled[] frames are made from afdMain's frame with an area average
+// (box) filter, done as a vertical then a horizontal pass with fixed point
+// weights.  Smaller outputs are made from the smallest larger output
+// instead of the full size frame.
+
+#define AVI_SCALE_BITS 14
+
+typedef struct {
+    int first;  // first source pixel or row
+    int count;
+    int weights;  // index of the first weight
+} aviScaleTaps_t;
+
+typedef struct aviScaler_s {
+    const aviFileData_t *source;  // NULL if made from afdMain's frame
+    int srcWidth, srcHeight;
+    aviScaleTaps_t *xTaps, *yTaps;
+    unsigned short *xWeights, *yWeights;
+    unsigned int *row;  // vertical pass of one output row
+} aviScaler_t;
+
+// weights of each output pixel add up to 1 << AVI_SCALE_BITS
+static void CL_AviScaleTaps (int src, int dst, aviScaleTaps_t *taps, unsigned short *weights)
+{
+    int i, o, n;
+    int start, end, lo, hi;
+    int w, total;
+
+    n = 0;
+    for (o = 0;  o < dst;  o++) {
+        // output pixel o covers [start, end) in 1/dst source pixel units
+        start = o * src;
+        end = start + src;
+
+        taps[o].first = start / dst;
+        taps[o].weights = n;
+        total = 0;
+        for (i = taps[o].first;  i * dst < end;  i++) {
+            lo = i * dst > start ? i * dst : start;
+            hi = (i + 1) * dst < end ? (i + 1) * dst : end;
+            w = ((hi - lo) << AVI_SCALE_BITS) / src;
+            weights[n++] = w;
+            total += w;
+        }
+        taps[o].count = n - taps[o].weights;
+
+        // rounding error goes to the first tap
+        weights[taps[o].weights] += (1 << AVI_SCALE_BITS) - total;
+    }
+}
+
+static void CL_FreeAviScaler (aviScaler_t *s)
+{
+    free(s->xTaps);
+    free(s->yTaps);
+    free(s->xWeights);
+    free(s->yWeights);
+    free(s->row);
+    free(s);
+}
+
+static aviScaler_t *CL_NewAviScaler (const aviFileData_t *afd)
+{
+    aviScaler_t *s;
+    const aviFileData_t *src;
+    int i;
+
+    s = calloc(1, sizeof(aviScaler_t));
+    if (!s) {
+        Com_Error(ERR_DROP, "%s couldn't allocate scaler", __FUNCTION__);
+    }
+
+    // afdScaled[] are opened largest first
+    s->srcWidth = cls.glconfig.vidWidth;
+    s->srcHeight = cls.glconfig.vidHeight;
+    for (i = 0;  i < MAX_VIDEO_SCALES;  i++) {
+        src = &afdScaled[i];
+        if (src == afd  ||  !src->recording  ||  !src->scaler) {
+            continue;
+        }
+        if (src->width < afd->width  ||  src->height < afd->height) {
+            continue;
+        }
+        if (src->width * src->height < s->srcWidth * s->srcHeight) {
+            s->source = src;
+            s->srcWidth = src->width;
+            s->srcHeight = src->height;
+        }
+    }
+
+    s->xTaps = malloc(afd->width * sizeof(aviScaleTaps_t));
+    s->yTaps = malloc(afd->height * sizeof(aviScaleTaps_t));
+    s->xWeights = malloc((s->srcWidth + afd->width) * sizeof(unsigned short));
+    s->yWeights = malloc((s->srcHeight + afd->height) * sizeof(unsigned short));
+    s->row = malloc(s->srcWidth * 3 * sizeof(unsigned int));
+    if (!s->xTaps  ||  !s->yTaps  ||  !s->xWeights  ||  !s->yWeights  ||  !s->row) {
+        Com_Error(ERR_DROP, "%s couldn't allocate scaler", __FUNCTION__);
+    }
+
+    CL_AviScaleTaps(s->srcWidth, afd->width, s->xTaps, s->xWeights);
+    CL_AviScaleTaps(s->srcHeight, afd->height, s->yTaps, s->yWeights);
+
+    return s;
+}
+
+static void CL_AviScaleFrame (const aviScaler_t *s, const byte *src, byte *dst, int dstWidth, int dstHeight)
+{
+    const aviScaleTaps_t *t;
+    const byte *in;
+    const unsigned int *p;
+    unsigned int *row;
+    unsigned int w;
+    unsigned int c0, c1, c2;
+    int srcStride;
+    int x, y, i, k;
+
+    row = s->row;
+    srcStride = s->srcWidth * 3;
+
+    for (y = 0;  y < dstHeight;  y++) {
+        t = &s->yTaps[y];
+
+        // vertical, at most 255 << AVI_SCALE_BITS
+        in = src + t->first * srcStride;
+        w = s->yWeights[t->weights];
+        for (i = 0;  i < srcStride;  i++) {
+            row[i] = in[i] * w;
+        }
+        for (k = 1;  k < t->count;  k++) {
+            in += srcStride;
+            w = s->yWeights[t->weights + k];
+            for (i = 0;  i < srcStride;  i++) {
+                row[i] += in[i] * w;
+            }
+        }
+
+        // horizontal, keeping 8 bits of the vertical pass
+        for (x = 0;  x < dstWidth;  x++) {
+            t = &s->xTaps[x];
+            p = row + t->first * 3;
+            c0 = c1 = c2 = 1 << (AVI_SCALE_BITS + 7);
+            for (k = 0;  k < t->count;  k++, p += 3) {
+                w = s->xWeights[t->weights + k];
+                c0 += (p[0] >> (AVI_SCALE_BITS - 8)) * w;
+                c1 += (p[1] >> (AVI_SCALE_BITS - 8)) * w;
+                c2 += (p[2] >> (AVI_SCALE_BITS - 8)) * w;
+            }
+            dst[0] = c0 >> (AVI_SCALE_BITS + 8);
+            dst[1] = c1 >> (AVI_SCALE_BITS + 8);
+            dst[2] = c2 >> (AVI_SCALE_BITS + 8);
+            dst += 3;
+        }
+    }
+}
+
+// fills each afdScaled[] cBuffer from afdMain's frame
+static void CL_ScaleVideoFrames (const byte *imageBuffer)
+{
+    aviFileData_t *afd;
+    const aviScaler_t *s;
+    int i;
+
+    for (i = 0;  i < MAX_VIDEO_SCALES;  i++) {
+        afd = &afdScaled[i];
+        s = afd->scaler;
+        if (!afd->recording  ||  !s) {
+            continue;
+        }
+
+        CL_AviScaleFrame(s, s->source ? s->source->cBuffer : imageBuffer, afd->cBuffer, afd->width, afd->height);
+    }
+}
+
+static void CL_WriteScaledVideoFrames (void)
+{
+    aviFileData_t *afd;
+    int i;
+
+    for (i = 0;  i < MAX_VIDEO_SCALES;  i++) {
+        afd = &afdScaled[i];
+        if (!afd->recording  ||  !afd->scaler) {
+            continue;
+        }
+
+        CL_WriteAVIVideoFrame(afd, afd->cBuffer, afd->width * afd->height * 3);
+    }
+}
+
 /*
 ===============
 CL_OpenAVIForWriting
@@ -580,6 +1105,8 @@ qboolean CL_OpenAVIForWriting (aviFileData_t *afd, const char *fileName, qboolea
     char sbuf[MAX_QPATH];
     //int i;
     int startTime;
+    int scaledWidth, scaledHeight;
+    struct aviScaler_s *scaler;
 
     if (afd->recording) {
         Com_Printf("^1CL_OpenAVIForWriting() already recording\n");
@@ -603,12 +1130,19 @@ qboolean CL_OpenAVIForWriting (aviFileData_t *afd, const char *fileName, qboolea
   pcount = afd->picCount;
   startTime = afd->startTime;
   Q_strncpyz(sbuf, afd->givenFileName, MAX_QPATH);
+  scaledWidth = afd->scaledWidth;
+  scaledHeight = afd->scaledHeight;
+  scaler = afd->scaler;
 
   Com_Memset(afd, 0, sizeof(aviFileData_t));
 
+  afd->scaledWidth = scaledWidth;
+  afd->scaledHeight = scaledHeight;
+
   if (us) {
       afd->cBuffer = cBuffer;
       afd->eBuffer = eBuffer;
+      afd->scaler = scaler;
       afd->wavFile = wf;
       afd->vidFileCount = vcount + 1;
       afd->picCount = pcount;
@@ -661,6 +1195,9 @@ qboolean CL_OpenAVIForWriting (aviFileData_t *afd, const char *fileName, qboolea
               Q_strcat(afd->givenFileName, sizeof(afd->givenFileName), "-right");
           }
       }
+      if (afd->scaledWidth) {
+          Q_strcat(afd->givenFileName, sizeof(afd->givenFileName), va("-%dx%d", afd->scaledWidth, afd->scaledHeight));
+      }
       //Com_Printf("^3record: %s\n", afd->givenFileName);
   } else {
       //Q_strncpyz(afd->givenFileName, afd->fileName, MAX_QPATH);
@@ -702,8 +1239,13 @@ qboolean CL_OpenAVIForWriting (aviFileData_t *afd, const char *fileName, qboolea
   //Com_Printf("file %p  f:%d\n", afd->file, afd->f);
   afd->frameRate = cl_aviFrameRate->integer;
   afd->framePeriod = (int)( 1000000.0f / afd->frameRate );
-  afd->width = cls.glconfig.vidWidth;
-  afd->height = cls.glconfig.vidHeight;
+  if (afd->scaledWidth) {
+      afd->width = afd->scaledWidth;
+      afd->height = afd->scaledHeight;
+  } else {
+      afd->width = cls.glconfig.vidWidth;
+      afd->height = cls.glconfig.vidHeight;
+  }
 
   //if (cl_aviUseOpenDml->integer) {
   if (cl_aviAllowLargeFiles->integer) {
@@ -742,6 +1284,9 @@ qboolean CL_OpenAVIForWriting (aviFileData_t *afd, const char *fileName, qboolea
       if (!afd->eBuffer) {
           Com_Error(ERR_DROP, "%s couldn't allocate memory for eBuffer", __FUNCTION__);
       }
+      if (afd->scaledWidth) {
+          afd->scaler = CL_NewAviScaler(afd);
+      }
   }
 
   afd->a.rate = dma.speed;
@@ -823,6 +1368,10 @@ qboolean CL_OpenAVIForWriting (aviFileData_t *afd, const char *fileName, qboolea
 
   afd->riffCount = 1;
 
+  if (afd->avi) {
+      CL_AviStreamOpen(afd);
+  }
+
   // testing
 
   if (!us  &&  wav  &&  afd == &afdMain) {
@@ -871,8 +1420,7 @@ static qboolean CL_CheckRiffSize (aviFileData_t *afd, int bytesToAdd)
 
   if (afd->useOpenDml) {
       //newFileSize = afd->fileSize + bytesToAdd;
-      fseeko(afd->file, 0, SEEK_END);
-      newRiffSize = ftello(afd->file) - ((afd->riffCount - 1) * (int64_t)afd->newRiffOrCloseFileSize) + bytesToAdd;
+      newRiffSize = CL_AviFileSize(afd) - ((afd->riffCount - 1) * (int64_t)afd->newRiffOrCloseFileSize) + bytesToAdd;
   }
 
   // I assume all the operating systems
@@ -932,9 +1480,7 @@ static void CL_WriteAVIVideoFrameReal (aviFileData_t *afd, const byte *imageBuff
 
   chunkOffset = afd->riffSize - afd->moviOffset - 8;
 
-  fseeko(afd->file, 0, SEEK_END);
-
-  currentFileSize = ftello(afd->file);
+  currentFileSize = CL_AviFileSize(afd);
 
   bufIndex = 0;
   WRITE_STRING( "00dc" );
@@ -994,6 +1540,13 @@ void CL_WriteAVIVideoFrame (aviFileData_t *afd, const byte *imageBuffer, int siz
     AVFrame VlcFrame;
     int bufSize;
 
+    Com_ProfileBegin("CL_WriteAVIVideoFrame");
+
+    // before the huffyuv swap below changes imageBuffer
+    if (afd == &afdMain  &&  afd->codec != CODEC_MJPEG  &&  size == afd->width * afd->height * 3) {
+        CL_ScaleVideoFrames(imageBuffer);
+    }
+
     //FIXME
     bufSize = afd->width * afd->height * 4 * 2;
     if (!EncodeBuffer) {
@@ -1041,6 +1594,12 @@ void CL_WriteAVIVideoFrame (aviFileData_t *afd, const byte *imageBuffer, int siz
     }
 
     CL_WriteAVIVideoFrameReal(afd, newBuffer, newSize);
+
+    Com_ProfileEnd();
+
+    if (afd == &afdMain) {
+        CL_WriteScaledVideoFrames();
+    }
 }
 
 /*
@@ -1111,8 +1670,7 @@ void CL_WriteAVIAudioFrame (aviFileData_t *afd, const byte *pcmBuffer, int size)
     int64_t currentFileSize;
 
 
-    fseeko(afd->file, 0, SEEK_END);
-    currentFileSize = ftello(afd->file);
+    currentFileSize = CL_AviFileSize(afd);
 
     bufIndex = 0;
     WRITE_STRING( "01wb" );
@@ -1261,6 +1819,7 @@ static void CL_WriteIndexes (aviFileData_t *afd)
       idxVFileName = va("%s%s", afd->fileName, INDEX_VIDEO_FILENAME_EXT);
       if ((indexSize = FS_FOpenFileRead(idxVFileName, &afd->idxVF, qtrue)) <= 0) {
           Com_Printf("CL_WriteIndexes()  couldn't open video index file\n");
+          CL_AviStreamClose(afd);
           FS_FCloseFile(afd->f);
           afd->fileOpen = qfalse;
           afd->file = NULL;
@@ -1329,6 +1888,7 @@ static void CL_WriteIndexes (aviFileData_t *afd)
       idxAFileName = va("%s%s", afd->fileName, INDEX_AUDIO_FILENAME_EXT);
       if ((indexSize = FS_FOpenFileRead(idxAFileName, &afd->idxAF, qtrue)) <= 0) {
           Com_Printf("CL_WriteIndexes()  couldn't open audio index file\n");
+          CL_AviStreamClose(afd);
           FS_FCloseFile(afd->f);
           afd->fileOpen = qfalse;
           afd->file = NULL;
@@ -1397,6 +1957,7 @@ static void CL_WriteIndexes (aviFileData_t *afd)
                                           &afd->idxF, qtrue ) ) <= 0 )
           {
               Com_Printf("CL_WriteIndexes()  couldn't open standard index file '%s'  indexSize: %d\n", va("%s%s", afd->fileName, INDEX_FILENAME_EXT), indexSize);
+              CL_AviStreamClose(afd);
               FS_FCloseFile( afd->f );
               afd->fileOpen = qfalse;
               afd->file = NULL;
@@ -1502,6 +2063,11 @@ qboolean CL_CloseAVI (aviFileData_t *afd, qboolean us)
     int pos;
     //char sbuf[MAX_QPATH];
 
+    // the renderer can still be holding the last video frame
+    if (re.SyncRenderThread) {
+        re.SyncRenderThread();
+    }
+
 #if 0
     if( !afd->fileOpen ) {
         Com_Printf("^1CL_CloseAVI() file not open\n");
@@ -1516,6 +2082,9 @@ qboolean CL_CloseAVI (aviFileData_t *afd, qboolean us)
 
   //FIXME need to flush audio maybe
 
+  // indexes and header fields are written by seeking around
+  CL_AviStreamPause(afd);
+
   CL_WriteIndexes(afd);
   CL_CloseRiff(afd);
   //CL_WriteIndexes(afd);
@@ -1584,6 +2153,10 @@ qboolean CL_CloseAVI (aviFileData_t *afd, qboolean us)
   if (!us) {
       free(afd->cBuffer);
       free(afd->eBuffer);
+      if (afd->scaler) {
+          CL_FreeAviScaler(afd->scaler);
+          afd->scaler = NULL;
+      }
 
       if (afd->codec == CODEC_HUFFYUV) {
           huffyuv_encode_end(afd->AC);
@@ -1592,6 +2165,7 @@ qboolean CL_CloseAVI (aviFileData_t *afd, qboolean us)
       }
   }
 
+  CL_AviStreamClose(afd);
   FS_FCloseFile( afd->f );
   if (!afd->avi) {
       FS_HomeRemove(afd->fileName);
@@ -1636,6 +2210,45 @@ qboolean CL_CloseAVI (aviFileData_t *afd, qboolean us)
   return qtrue;
 }
 
+/*
+===============
+CL_OpenScaledAVIForWriting
+
+Records a downscaled copy of afdMain's video along with the same audio.
+Open these largest first and before afdMain.
+===============
+*/
+qboolean CL_OpenScaledAVIForWriting (aviFileData_t *afd, const char *fileName, int width, int height, qboolean noSoundAvi)
+{
+    if (afd->recording) {
+        Com_Printf("^1CL_OpenScaledAVIForWriting() already recording\n");
+        return qfalse;
+    }
+
+    afd->scaledWidth = width;
+    afd->scaledHeight = height;
+    afd->scaler = NULL;
+
+    if (!CL_OpenAVIForWriting(afd, fileName, qfalse, qtrue, noSoundAvi, qfalse, qfalse, qfalse, qfalse, qfalse, qfalse, qfalse)) {
+        if (afd->scaler) {
+            CL_FreeAviScaler(afd->scaler);
+            afd->scaler = NULL;
+        }
+        return qfalse;
+    }
+
+    return qtrue;
+}
+
+void CL_CloseScaledAVIs (void)
+{
+    int i;
+
+    for (i = 0;  i < MAX_VIDEO_SCALES;  i++) {
+        CL_CloseAVI(&afdScaled[i], qfalse);
+    }
+}
+
 static void CL_NewRiff (aviFileData_t *afd)
 {
   //int64_t pos;
@@ -1648,6 +2261,7 @@ static void CL_NewRiff (aviFileData_t *afd)
 
   //pos = ftello(afd->file);
 
+  CL_AviStreamPause(afd);
 
   CL_WriteIndexes(afd);
   CL_CloseRiff(afd);
@@ -1696,6 +2310,7 @@ static void CL_NewRiff (aviFileData_t *afd)
   if( ( afd->idxVF = FS_FOpenFileWrite(va("%s%s", afd->fileName, INDEX_VIDEO_FILENAME_EXT))) <= 0)
   {
       Com_Printf("CL_NewRiff() couldn't open video index file\n");
+      CL_AviStreamClose(afd);
       FS_FCloseFile( afd->f );
       afd->fileOpen = qfalse;
       afd->file = NULL;
@@ -1705,6 +2320,7 @@ static void CL_NewRiff (aviFileData_t *afd)
   if( ( afd->idxAF = FS_FOpenFileWrite(va("%s%s", afd->fileName, INDEX_AUDIO_FILENAME_EXT))) <= 0)
   {
       Com_Printf("CL_NewRiff() couldn't open audio index file\n");
+      CL_AviStreamClose(afd);
       FS_FCloseFile( afd->f );
       afd->fileOpen = qfalse;
       afd->file = NULL;
@@ -1712,6 +2328,8 @@ static void CL_NewRiff (aviFileData_t *afd)
   }
 
   CL_InitIndexes(afd);
+
+  CL_AviStreamResume(afd);
 }
 
 /*
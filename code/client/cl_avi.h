@@ -52,6 +52,7 @@ typedef struct aviFileData_s
   qboolean      fileOpen;
   fileHandle_t  f;
     FILE *file;
+    struct aviStream_s *stream;  // writer thread for f, NULL if writing directly
   char          fileName[ MAX_QPATH ];
     char givenFileName[MAX_QPATH];
 
@@ -125,6 +126,10 @@ typedef struct aviFileData_s
     byte pcmCaptureBuffer[PCM_BUFFER_SIZE];
 
     AVCodecContext *AC;
+
+    // downscaled copy of afdMain, set by CL_OpenScaledAVIForWriting()
+    int scaledWidth, scaledHeight;
+    struct aviScaler_s *scaler;
 } aviFileData_t;
 
 extern aviFileData_t afdMain;
@@ -135,6 +140,10 @@ extern aviFileData_t afdDepth;
 extern aviFileData_t afdDepthLeft;
 extern aviFileData_t afdDepthRight;
 
+#define MAX_VIDEO_SCALES 4
+
+extern aviFileData_t afdScaled[MAX_VIDEO_SCALES];
+
 qboolean CL_VideoRecording (const aviFileData_t *afd);
 
 #endif  // cl_avi_h_included
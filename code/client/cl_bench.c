@@ -0,0 +1,388 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// cl_bench.c  -- 'benchdemo' reproducible demo benchmark
+//
+// benchdemo <demo> [config] [video options]
+//
+// Plays the demo at a fixed timestep (timedemo, or cl_aviFrameRate when
+// video options are given) after executing the config, and records the
+// per frame stage times from the profiler.  When the demo completes a
+// csv with every frame and a json summary with percentiles are written to
+// benchmarks/.
+
+#include "client.h"
+
+#define BENCH_TOTAL PROFILE_NUM_STAGES
+#define BENCH_NUM_COLUMNS (PROFILE_NUM_STAGES + 1)
+
+typedef struct {
+	qboolean pending;  // waiting for the demo to start
+	qboolean running;
+
+	char demoName[MAX_QPATH];
+	char configName[MAX_QPATH];
+	char videoArgs[MAX_STRING_CHARS];
+	char outputName[MAX_QPATH];
+	char oldTimedemo[MAX_CVAR_VALUE_STRING];
+
+	int startTime;
+
+	// microseconds, BENCH_NUM_COLUMNS per frame
+	int64_t *samples;
+	int numFrames;
+	int maxFrames;
+} bench_t;
+
+static bench_t bench;
+
+/*
+==================
+CL_BenchColumnName
+==================
+*/
+static const char *CL_BenchColumnName (int column)
+{
+	if (column == BENCH_TOTAL) {
+		return "total";
+	}
+
+	return Com_ProfileStageName(column);
+}
+
+/*
+==================
+CL_BenchReset
+==================
+*/
+static void CL_BenchReset (void)
+{
+	if (bench.pending  ||  bench.running) {
+		Com_ProfileEnableStages(qfalse);
+		Cvar_Set("timedemo", bench.oldTimedemo);
+	}
+
+	free(bench.samples);
+	Com_Memset(&bench, 0, sizeof(bench));
+}
+
+/*
+==================
+CL_BenchDemo_f
+==================
+*/
+void CL_BenchDemo_f (void)
+{
+	char baseName[MAX_QPATH];
+	int i;
+
+	if (Cmd_Argc() < 2) {
+		Com_Printf("usage: benchdemo <demo> [config] [video options]\n");
+		return;
+	}
+
+	CL_BenchReset();
+
+	Q_strncpyz(bench.demoName, Cmd_Argv(1), sizeof(bench.demoName));
+	if (Cmd_Argc() > 2) {
+		Q_strncpyz(bench.configName, Cmd_Argv(2), sizeof(bench.configName));
+	}
+	for (i = 3;  i < Cmd_Argc();  i++) {
+		Q_strcat(bench.videoArgs, sizeof(bench.videoArgs), va("\"%s\" ", Cmd_Argv(i)));
+	}
+
+	COM_StripExtension(COM_SkipPath(bench.demoName), baseName, sizeof(baseName));
+	if (*bench.configName) {
+		char configBase[MAX_QPATH];
+
+		COM_StripExtension(COM_SkipPath(bench.configName), configBase, sizeof(configBase));
+		Com_sprintf(bench.outputName, sizeof(bench.outputName), "benchmarks/%s-%s", baseName, configBase);
+	} else {
+		Com_sprintf(bench.outputName, sizeof(bench.outputName), "benchmarks/%s", baseName);
+	}
+
+	// video recording already uses a fixed timestep of cl_aviFrameRate
+	Q_strncpyz(bench.oldTimedemo, Cvar_VariableString("timedemo"), sizeof(bench.oldTimedemo));
+	Cvar_Set("timedemo", *bench.videoArgs ? "0" : "1");
+
+	bench.pending = qtrue;
+
+	// the demo command loads cgame, so the config can also set up cameras
+	// and scripts
+	Cbuf_AddText(va("demo \"%s\"\n", bench.demoName));
+	if (*bench.configName) {
+		Cbuf_AddText(va("exec \"%s\"\n", bench.configName));
+	}
+	if (*bench.videoArgs) {
+		Cbuf_AddText(va("video %s\n", bench.videoArgs));
+	}
+}
+
+/*
+==================
+CL_BenchFrame
+
+Records the stage times of the previous frame, called at the start of
+CL_Frame().
+==================
+*/
+void CL_BenchFrame (void)
+{
+	int64_t stageTimes[PROFILE_NUM_STAGES];
+	int64_t *sample;
+	int64_t total;
+	int i;
+
+	if (!bench.pending  &&  !bench.running) {
+		return;
+	}
+
+	if (!clc.demoplaying  ||  clc.state != CA_ACTIVE) {
+		return;
+	}
+
+	if (bench.pending) {
+		// the loading frame isn't measured
+		bench.pending = qfalse;
+		bench.running = qtrue;
+		bench.startTime = Sys_Milliseconds();
+		Com_ProfileEnableStages(qtrue);
+		return;
+	}
+
+	if (!Com_ProfileLastFrame(stageTimes)) {
+		return;
+	}
+
+	if (bench.numFrames >= bench.maxFrames) {
+		int64_t *samples;
+		int maxFrames;
+
+		maxFrames = bench.maxFrames ? bench.maxFrames * 2 : 4096;
+		samples = realloc(bench.samples, maxFrames * BENCH_NUM_COLUMNS * sizeof(*samples));
+		if (!samples) {
+			Com_Printf("^1%s couldn't allocate memory for %d frames, benchmark stopped\n", __FUNCTION__, maxFrames);
+			CL_BenchReset();
+			return;
+		}
+		bench.samples = samples;
+		bench.maxFrames = maxFrames;
+	}
+
+	sample = &bench.samples[bench.numFrames * BENCH_NUM_COLUMNS];
+	total = 0;
+	for (i = 0;  i < PROFILE_NUM_STAGES;  i++) {
+		sample[i] = stageTimes[i];
+		total += stageTimes[i];
+	}
+	sample[BENCH_TOTAL] = total;
+	bench.numFrames++;
+}
+
+/*
+==================
+CL_BenchCompare
+==================
+*/
+static int CL_BenchCompare (const void *a, const void *b)
+{
+	int64_t ia, ib;
+
+	ia = *(const int64_t *)a;
+	ib = *(const int64_t *)b;
+
+	if (ia < ib) {
+		return -1;
+	} else if (ia > ib) {
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+==================
+CL_BenchPercentile
+
+values must be sorted, returns milliseconds
+==================
+*/
+static double CL_BenchPercentile (const int64_t *values, int count, double percentile)
+{
+	int n;
+
+	n = (int)(percentile / 100.0 * (count - 1) + 0.5);
+	if (n < 0) {
+		n = 0;
+	} else if (n >= count) {
+		n = count - 1;
+	}
+
+	return values[n] / 1000.0;
+}
+
+/*
+==================
+CL_BenchWriteResults
+==================
+*/
+static void CL_BenchWriteResults (void)
+{
+	fileHandle_t f;
+	char fileName[MAX_QPATH];
+	char escaped[MAX_STRING_CHARS];
+	int64_t *values;
+	int realTime;
+	int column;
+	int i;
+	qtime_t now;
+
+	realTime = Sys_Milliseconds() - bench.startTime;
+
+	// every frame
+	Com_sprintf(fileName, sizeof(fileName), "%s.csv", bench.outputName);
+	f = FS_FOpenFileWrite(fileName);
+	if (!f) {
+		Com_Printf("^1%s couldn't open %s\n", __FUNCTION__, fileName);
+		return;
+	}
+	FS_Printf(f, "frame");
+	for (column = 0;  column < BENCH_NUM_COLUMNS;  column++) {
+		FS_Printf(f, ",%s", CL_BenchColumnName(column));
+	}
+	FS_Printf(f, "\n");
+	for (i = 0;  i < bench.numFrames;  i++) {
+		FS_Printf(f, "%d", i);
+		for (column = 0;  column < BENCH_NUM_COLUMNS;  column++) {
+			FS_Printf(f, ",%.3f", bench.samples[i * BENCH_NUM_COLUMNS + column] / 1000.0);
+		}
+		FS_Printf(f, "\n");
+	}
+	FS_FCloseFile(f);
+
+	// summary
+	values = malloc(bench.numFrames * sizeof(*values));
+	if (!values) {
+		Com_Printf("^1%s couldn't allocate memory for summary\n", __FUNCTION__);
+		return;
+	}
+
+	Com_sprintf(fileName, sizeof(fileName), "%s.json", bench.outputName);
+	f = FS_FOpenFileWrite(fileName);
+	if (!f) {
+		Com_Printf("^1%s couldn't open %s\n", __FUNCTION__, fileName);
+		free(values);
+		return;
+	}
+
+	Com_RealTime(&now, qtrue, 0);
+	FS_Printf(f, "{\n");
+	FS_Printf(f, "  \"version\": \"%s\",\n", Com_EscapeJSON(escaped, sizeof(escaped), Q3_VERSION));
+	FS_Printf(f, "  \"date\": \"%04d-%02d-%02d %02d:%02d:%02d\",\n", 1900 + now.tm_year, now.tm_mon + 1, now.tm_mday, now.tm_hour, now.tm_min, now.tm_sec);
+	FS_Printf(f, "  \"demo\": \"%s\",\n", Com_EscapeJSON(escaped, sizeof(escaped), bench.demoName));
+	FS_Printf(f, "  \"config\": \"%s\",\n", Com_EscapeJSON(escaped, sizeof(escaped), bench.configName));
+	FS_Printf(f, "  \"renderer\": \"%s\",\n", Com_EscapeJSON(escaped, sizeof(escaped), Cvar_VariableString("cl_renderer")));
+	FS_Printf(f, "  \"width\": %d,\n", cls.glconfig.vidWidth);
+	FS_Printf(f, "  \"height\": %d,\n", cls.glconfig.vidHeight);
+	FS_Printf(f, "  \"capture\": %s,\n", *bench.videoArgs ? "true" : "false");
+	FS_Printf(f, "  \"aviFrameRate\": %d,\n", cl_aviFrameRate->integer);
+	FS_Printf(f, "  \"frames\": %d,\n", bench.numFrames);
+	FS_Printf(f, "  \"seconds\": %.3f,\n", realTime / 1000.0);
+	FS_Printf(f, "  \"fps\": %.2f,\n", realTime > 0 ? bench.numFrames * 1000.0 / realTime : 0.0);
+	FS_Printf(f, "  \"stages\": {\n");
+
+	Com_Printf("%-10s %9s %9s %9s %9s %9s\n", "stage ms", "mean", "p50", "p90", "p99", "max");
+	for (column = 0;  column < BENCH_NUM_COLUMNS;  column++) {
+		double mean;
+
+		mean = 0.0;
+		for (i = 0;  i < bench.numFrames;  i++) {
+			values[i] = bench.samples[i * BENCH_NUM_COLUMNS + column];
+			mean += values[i];
+		}
+		mean = mean / bench.numFrames / 1000.0;
+		qsort(values, bench.numFrames, sizeof(*values), CL_BenchCompare);
+
+		FS_Printf(f, "    \"%s\": { \"mean\": %.3f, \"min\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p95\": %.3f, \"p99\": %.3f, \"max\": %.3f }%s\n",
+				  Com_EscapeJSON(escaped, sizeof(escaped), CL_BenchColumnName(column)),
+				  mean,
+				  values[0] / 1000.0,
+				  CL_BenchPercentile(values, bench.numFrames, 50),
+				  CL_BenchPercentile(values, bench.numFrames, 90),
+				  CL_BenchPercentile(values, bench.numFrames, 95),
+				  CL_BenchPercentile(values, bench.numFrames, 99),
+				  values[bench.numFrames - 1] / 1000.0,
+				  column < BENCH_NUM_COLUMNS - 1 ? "," : "");
+
+		Com_Printf("%-10s %9.3f %9.3f %9.3f %9.3f %9.3f\n",
+				   CL_BenchColumnName(column),
+				   mean,
+				   CL_BenchPercentile(values, bench.numFrames, 50),
+				   CL_BenchPercentile(values, bench.numFrames, 90),
+				   CL_BenchPercentile(values, bench.numFrames, 99),
+				   values[bench.numFrames - 1] / 1000.0);
+	}
+
+	FS_Printf(f, "  }\n");
+	FS_Printf(f, "}\n");
+	FS_FCloseFile(f);
+	free(values);
+
+	Com_Printf("benchmark: %d frames in %.3f seconds, results written to %s.json and %s.csv\n", bench.numFrames, realTime / 1000.0, bench.outputName, bench.outputName);
+}
+
+/*
+==================
+CL_BenchDemoCompleted
+==================
+*/
+void CL_BenchDemoCompleted (void)
+{
+	if (!bench.running) {
+		return;
+	}
+
+	if (bench.numFrames > 0) {
+		CL_BenchWriteResults();
+	} else {
+		Com_Printf("^3benchmark: no frames recorded\n");
+	}
+
+	CL_BenchReset();
+}
+
+/*
+==================
+CL_BenchDisconnect
+
+A disconnect before the end of the demo aborts the benchmark.  The one
+done by the 'demo' command itself is ignored.
+==================
+*/
+void CL_BenchDisconnect (void)
+{
+	if (!bench.running) {
+		return;
+	}
+
+	Com_Printf("^3benchmark aborted\n");
+	CL_BenchReset();
+}
@@ -225,6 +225,10 @@ qboolean	CL_GetSnapshot( int snapshotNumber, snapshot_t *snapshot ) {
 			}
 
 			extraSnap = &cl.snapshots[j][snapshotNumber & PACKET_MASK];
+			if (!extraSnap->valid  ||  extraSnap->messageNum != snapshotNumber) {
+				// extra demo doesn't have a snapshot at this server time
+				continue;
+			}
 			//snapshot->numEntities += extraSnap->numEntities;
 			for (i = 0;  i < extraSnap->numEntities;  i++) {
 				entityState_t *es;
@@ -267,6 +271,166 @@ qboolean	CL_GetSnapshot( int snapshotNumber, snapshot_t *snapshot ) {
 	return qtrue;
 }
 
+static int snapshotViewGeneration;
+
+/*
+====================
+CL_InvalidateSnapshotViews
+
+cl.snapshots[] and cl.parseEntities[] were cleared or replaced (rewind)
+====================
+*/
+void CL_InvalidateSnapshotViews (void)
+{
+	snapshotViewGeneration++;
+}
+
+#ifdef CGAME_HARD_LINKED
+/*
+====================
+CL_SnapshotViewEntitiesNum
+
+Highest parse entity written so far, snapshots read ahead by
+CL_PeekSnapshot() go past cl.parseEntitiesNum.
+====================
+*/
+static int CL_SnapshotViewEntitiesNum (void)
+{
+	if (cl.peekParseEntitiesNum > cl.parseEntitiesNum) {
+		return cl.peekParseEntitiesNum;
+	}
+
+	return cl.parseEntitiesNum;
+}
+
+static void CL_SetSnapshotView (snapshotView_t *view, const clSnapshot_t *clSnap, int pov, int peek)
+{
+	view->generation = snapshotViewGeneration;
+	view->pov = pov;
+	view->peek = peek;
+	view->parseEntitiesNum = clSnap->parseEntitiesNum;
+
+	view->snapFlags = clSnap->snapFlags;
+	view->ping = clSnap->ping;
+	view->serverTime = clSnap->serverTime;
+	view->serverCommandSequence = clSnap->serverCommandNum;
+	view->messageNum = clSnap->messageNum;
+	view->areamask = clSnap->areamask;
+	view->ps = &clSnap->ps;
+
+	view->numEntities = clSnap->numEntities;
+	if (view->numEntities > MAX_ENTITIES_IN_SNAPSHOT) {
+		view->numEntities = MAX_ENTITIES_IN_SNAPSHOT;
+	}
+	view->parseEntities = cl.parseEntities;
+	view->parseEntitiesMask = MAX_PARSE_ENTITIES - 1;
+}
+
+/*
+====================
+CL_GetSnapshotView
+
+Same checks as CL_GetSnapshot() but nothing is copied.  Snapshots merged
+from extra demos with all_ents don't exist in the buffers and are
+refused, the caller has to fall back to CL_GetSnapshot().
+
+Demo snapshots past the current one are read ahead like
+CL_PeekSnapshot(), the last one peeked is reused if it's still there.
+====================
+*/
+qboolean CL_GetSnapshotView (int snapshotNumber, snapshotView_t *view)
+{
+	const clSnapshot_t *clSnap;
+	int pov;
+
+	if (clc.demoplaying) {
+		if (di.numDemoFiles > 1  &&  Cvar_VariableIntegerValue("all_ents")) {
+			return qfalse;
+		}
+		pov = di.pov;
+	} else {
+		pov = 0;
+	}
+
+	if (snapshotNumber > cl.snap.messageNum) {
+		// peeking only reads the main demo
+		if (!clc.demoplaying  ||  pov != 0) {
+			return qfalse;
+		}
+
+		clSnap = CL_PeekedSnapshot(snapshotNumber);
+		if (!clSnap  ||  clSnap->parseEntitiesNum < cl.parseEntitiesNum) {
+			if (!CL_PeekSnapshot(snapshotNumber, NULL)) {
+				return qfalse;
+			}
+			clSnap = CL_PeekedSnapshot(snapshotNumber);
+			if (!clSnap) {
+				return qfalse;
+			}
+		}
+
+		if (cl.peekParseEntitiesNum - clSnap->parseEntitiesNum >= MAX_PARSE_ENTITIES) {
+			return qfalse;
+		}
+
+		CL_SetSnapshotView(view, clSnap, pov, cl.peekSequence);
+		return qtrue;
+	}
+
+	if (cl.snap.messageNum - snapshotNumber >= PACKET_BACKUP) {
+		return qfalse;
+	}
+
+	clSnap = &cl.snapshots[pov][snapshotNumber & PACKET_MASK];
+	if (!clSnap->valid  ||  clSnap->messageNum != snapshotNumber) {
+		return qfalse;
+	}
+
+	if (CL_SnapshotViewEntitiesNum() - clSnap->parseEntitiesNum >= MAX_PARSE_ENTITIES) {
+		return qfalse;
+	}
+
+	CL_SetSnapshotView(view, clSnap, pov, 0);
+
+	return qtrue;
+}
+
+/*
+====================
+CL_SnapshotViewValid
+====================
+*/
+qboolean CL_SnapshotViewValid (const snapshotView_t *view)
+{
+	const clSnapshot_t *clSnap;
+
+	if (view->generation != snapshotViewGeneration) {
+		return qfalse;
+	}
+
+	if (clc.demoplaying  &&  view->pov != di.pov) {
+		return qfalse;
+	}
+
+	if (view->peek) {
+		// the next peek or the real snapshot reuses the parse entities
+		return view->peek == cl.peekSequence  &&  cl.parseEntitiesNum <= view->parseEntitiesNum;
+	}
+
+	clSnap = &cl.snapshots[view->pov][view->messageNum & PACKET_MASK];
+	if (!clSnap->valid  ||  clSnap->messageNum != view->messageNum) {
+		return qfalse;
+	}
+
+	// entities are appended, the oldest ones get overwritten first
+	if (CL_SnapshotViewEntitiesNum() - view->parseEntitiesNum > MAX_PARSE_ENTITIES - view->numEntities) {
+		return qfalse;
+	}
+
+	return qtrue;
+}
+#endif
+
 //static entityState_t   tmpParseEntities[MAX_PARSE_ENTITIES];
 
 
@@ -298,6 +462,9 @@ qboolean CL_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot)
 
 	if (snapshotNumber <= cl.snap.messageNum) {
 		//Com_Printf("FIXME CL_PeekSnapshot snapshotNumber <= cl.snap.messageNum  %d  %d\n", snapshotNumber, cl.snap.messageNum);
+		if (!snapshot) {
+			return qfalse;
+		}
 		success = CL_GetSnapshot(snapshotNumber, snapshot);
 		if (!success) {
 			Com_Printf("^3CL_PeekSnapshot snapshot number outside of backup buffer\n");
@@ -316,7 +483,7 @@ qboolean CL_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot)
 	lastPacketTimeOrig = clc.lastPacketTime;
 
 	// CL_ReadDemoMessage()
-	origPosition = FS_FTell(clc.demoReadFile);
+	origPosition = CL_DemoTell();
 
 	currentSnapNum = cl.snap.messageNum;
 
@@ -325,10 +492,10 @@ qboolean CL_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot)
 		snapshotInMessage = qfalse;
 		// get the sequence number
 		memset(buffer, 0, sizeof(buffer));
-		r = FS_Read( &buffer, 4, clc.demoReadFile);
+		r = CL_DemoRead(&buffer, 4);
 		if ( r != 4 ) {
 			Com_Printf("CL_PeekSnapshot couldn't read sequence number\n");
-			FS_Seek(clc.demoReadFile, origPosition, FS_SEEK_SET);
+			CL_DemoSeek(origPosition);
 			clc.lastPacketTime = lastPacketTimeOrig;
 			cl.parseEntitiesNum = parseEntitiesNumOrig;
 			return qfalse;
@@ -341,10 +508,10 @@ qboolean CL_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot)
 		MSG_Init(&buf, bufData, sizeof(bufData));
 
 		// get the length
-		r = FS_Read (&buf.cursize, 4, clc.demoReadFile);
+		r = CL_DemoRead(&buf.cursize, 4);
 		if ( r != 4 ) {
 			Com_Printf("CL_PeekSnapshot couldn't get length\n");
-			FS_Seek(clc.demoReadFile, origPosition, FS_SEEK_SET);
+			CL_DemoSeek(origPosition);
 			clc.lastPacketTime = lastPacketTimeOrig;
 			cl.parseEntitiesNum = parseEntitiesNumOrig;
 			return qfalse;
@@ -352,7 +519,7 @@ qboolean CL_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot)
 		buf.cursize = LittleLong( buf.cursize );
 		if ( buf.cursize == -1 ) {
 			//Com_Printf("CL_PeekSnapshot buf.cursize == -1\n");
-			FS_Seek(clc.demoReadFile, origPosition, FS_SEEK_SET);
+			CL_DemoSeek(origPosition);
 			clc.lastPacketTime = lastPacketTimeOrig;
 			cl.parseEntitiesNum = parseEntitiesNumOrig;
 			return qfalse;
@@ -360,10 +527,10 @@ qboolean CL_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot)
 		if ( buf.cursize > buf.maxsize ) {
 			Com_Error (ERR_DROP, "CL_PeekSnapshot: demoMsglen > MAX_MSGLEN");
 		}
-		r = FS_Read( buf.data, buf.cursize, clc.demoReadFile );
+		r = CL_DemoRead(buf.data, buf.cursize);
 		if ( r != buf.cursize ) {
 			Com_Printf("CL_PeekSnapshot Demo file was truncated.\n");
-			FS_Seek(clc.demoReadFile, origPosition, FS_SEEK_SET);
+			CL_DemoSeek(origPosition);
 			clc.lastPacketTime = lastPacketTimeOrig;
 			cl.parseEntitiesNum = parseEntitiesNumOrig;
 			return qfalse;
@@ -483,7 +650,7 @@ qboolean CL_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot)
 
 		if (!success) {
 			Com_Printf("^1CL_PeekSnapshot failed seq:%d  cmdCount:%d  loop:%d\n", serverMessageSequence, cmdCount, j);
-			FS_Seek(clc.demoReadFile, origPosition, FS_SEEK_SET);
+			CL_DemoSeek(origPosition);
 			clc.lastPacketTime = lastPacketTimeOrig;
 			cl.parseEntitiesNum = parseEntitiesNumOrig;
 			return qfalse;
@@ -495,13 +662,18 @@ qboolean CL_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot)
 		// circular buffer, we can't return it
 		if ( cl.parseEntitiesNum - clSnap->parseEntitiesNum >= MAX_PARSE_ENTITIES ) {
 			Com_Printf("%s cl.parseEntitiesNum - clSnap->parseEntitiesNum >= MAX_PARSE_ENTITIES", __FUNCTION__);
-			FS_Seek(clc.demoReadFile, origPosition, FS_SEEK_SET);
+			CL_DemoSeek(origPosition);
 			clc.lastPacketTime = lastPacketTimeOrig;
 			cl.parseEntitiesNum = parseEntitiesNumOrig;
 			//return qfalse;
 			return qtrue;  //FIXME if you fix other ents
 		}
 
+		// snapshot view only needs PeekSnapshots[]
+		if (!snapshot) {
+			continue;
+		}
+
 		// write the snapshot
 		snapshot->messageNum = serverMessageSequence;
 		//Com_Printf("peek got %d\n", snapshot->messageNum);
@@ -525,7 +697,7 @@ qboolean CL_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot)
 
 	}
 
-	FS_Seek(clc.demoReadFile, origPosition, FS_SEEK_SET);
+	CL_DemoSeek(origPosition);
 	clc.lastPacketTime = lastPacketTimeOrig;
 	cl.parseEntitiesNum = parseEntitiesNumOrig;
 	// FIXME: configstring changes and server commands!!!
@@ -751,6 +923,52 @@ void CL_CM_LoadMap( const char *mapname ) {
 	CM_LoadMap( mapname, qtrue, &checksum );
 }
 
+#define MAX_CGAME_TRACE_CONTEXTS 16
+
+static cmTraceContext_t *cgameTraceContexts[MAX_CGAME_TRACE_CONTEXTS];
+
+/*
+====================
+CL_CreateCGameTraceContext
+
+Handles start at 1, 0 is the shared context the other traces use and is
+also returned when all of them are taken.
+====================
+*/
+static int CL_CreateCGameTraceContext (void)
+{
+	int i;
+
+	for (i = 0;  i < MAX_CGAME_TRACE_CONTEXTS;  i++) {
+		if (!cgameTraceContexts[i]) {
+			cgameTraceContexts[i] = CM_CreateTraceContext();
+			return i + 1;
+		}
+	}
+
+	Com_Printf(S_COLOR_YELLOW "WARNING: cgame is out of trace contexts\n");
+	return 0;
+}
+
+static void CL_FreeCGameTraceContext (int handle)
+{
+	if (handle < 1  ||  handle > MAX_CGAME_TRACE_CONTEXTS  ||  !cgameTraceContexts[handle - 1]) {
+		return;
+	}
+
+	CM_FreeTraceContext(cgameTraceContexts[handle - 1]);
+	cgameTraceContexts[handle - 1] = NULL;
+}
+
+static void CL_FreeCGameTraceContexts (void)
+{
+	int i;
+
+	for (i = 1;  i <= MAX_CGAME_TRACE_CONTEXTS;  i++) {
+		CL_FreeCGameTraceContext(i);
+	}
+}
+
 /*
 ====================
 CL_ShutdonwCGame
@@ -776,6 +994,11 @@ void CL_ShutdownCGame( void ) {
 
 	VM_Call( cgvm, CG_SHUTDOWN );
 
+	// drop whatever the last demo prefetched and never loaded
+	FS_PrefetchFlush();
+
+	CL_FreeCGameTraceContexts();
+
 #if 0
 	if (force) {
 		VM_Forced_Unload_Start();  // could be called from loading screen
@@ -907,6 +1130,9 @@ intptr_t CL_CgameSystemCalls( intptr_t *args ) {
 		return 0;
 	case CG_FS_SEEK:
 		return FS_Seek( args[1], args[2], args[3] );
+	case CG_FS_PREFETCH:
+		FS_Prefetch( VMA(1) );
+		return 0;
 	case CG_SENDCONSOLECOMMAND:
 		Cbuf_AddText( VMA(1) );
 		return 0;
@@ -968,6 +1194,21 @@ intptr_t CL_CgameSystemCalls( intptr_t *args ) {
 	case CG_CM_BOXTRACE:
 		CM_BoxTrace( VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qfalse );
 		return 0;
+	case CG_CM_TRACEBATCH:
+		CM_TraceBatch( VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], args[8], /*int capsule*/ qfalse );
+		return 0;
+	case CG_CM_CREATETRACECONTEXT:
+		return CL_CreateCGameTraceContext();
+	case CG_CM_FREETRACECONTEXT:
+		CL_FreeCGameTraceContext( args[1] );
+		return 0;
+	case CG_CM_TRACEBATCHCONTEXT:
+		if ( args[1] >= 1  &&  args[1] <= MAX_CGAME_TRACE_CONTEXTS  &&  cgameTraceContexts[args[1] - 1] ) {
+			CM_TraceBatchContext( cgameTraceContexts[args[1] - 1], VMA(2), VMA(3), VMA(4), VMA(5), VMA(6), args[7], args[8], args[9], /*int capsule*/ qfalse );
+		} else {
+			CM_TraceBatch( VMA(2), VMA(3), VMA(4), VMA(5), VMA(6), args[7], args[8], args[9], /*int capsule*/ qfalse );
+		}
+		return 0;
 	case CG_CM_CAPSULETRACE:
 		CM_BoxTrace( VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qtrue );
 		return 0;
@@ -1065,6 +1306,11 @@ intptr_t CL_CgameSystemCalls( intptr_t *args ) {
 			re.AddRefEntityToScene( VMA(1) );
 		}
 		return 0;
+	case CG_R_ADDREFENTITIESTOSCENE:
+		if (cl.draw) {
+			re.AddRefEntitiesToScene( VMA(1), args[2] );
+		}
+		return 0;
 	case CG_R_ADDREFENTITYPTRTOSCENE:
 		if (cl.draw) {
 			re.AddRefEntityPtrToScene(VMA(1));
@@ -1075,13 +1321,11 @@ intptr_t CL_CgameSystemCalls( intptr_t *args ) {
 			re.AddPolyToScene( args[1], args[2], VMA(3), 1, args[4] );
 		}
 		return 0;
-#if 0
 	case CG_R_ADDPOLYSTOSCENE:
 		if (cl.draw) {
-			re.AddPolyToScene( args[1], args[2], VMA(3), args[4] );
+			re.AddPolyToScene( args[1], args[2], VMA(3), args[4], qfalse );
 		}
 		return 0;
-#endif
 	case CG_R_LIGHTFORPOINT:
 		return re.LightForPoint( VMA(1), VMA(2), VMA(3), VMA(4) );
 	case CG_R_ADDLIGHTTOSCENE:
@@ -1369,6 +1613,12 @@ intptr_t CL_CgameSystemCalls( intptr_t *args ) {
 
 		return qfalse;
 	}
+	case CG_PROFILE_BEGIN:
+		Com_ProfileBegin(VMA(1));
+		return 0;
+	case CG_PROFILE_END:
+		Com_ProfileEnd();
+		return 0;
 	case CG_GET_NUM_PLAYER_INFO: {
 		return di.numPlayerInfo;
 	}
@@ -1567,9 +1817,11 @@ CL_CGameRendering
 void CL_CGameRendering( stereoFrame_t stereo ) {
 	int startTime;
 
+	Com_ProfileBegin("CL_CGameRendering");
 	startTime = Sys_Milliseconds();
 	VM_Call(cgvm, CG_DRAW_ACTIVE_FRAME, cl.serverTime, stereo, clc.demoplaying, CL_VideoRecording(&afdMain), (int)(Overf * SUBTIME_RESOLUTION), qtrue);
 	clc.cgameTime += (Sys_Milliseconds() - startTime);
+	Com_ProfileEnd();
 	VM_Debug( 0 );
 	//cl.draw = qtrue;
 }
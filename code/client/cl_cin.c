@@ -71,9 +71,19 @@ static	long				ROQ_VG_tab[256];
 static	long				ROQ_VR_tab[256];
 static qboolean YUVTablesInitialized = qfalse;
 
-static	unsigned short		vq2[256*16*4];
-static	unsigned short		vq4[256*64*4];
-static	unsigned short		vq8[256*256*4];
+static	unsigned short		vq2Table[256*16*4];
+static	unsigned short		vq4Table[256*64*4];
+static	unsigned short		vq8Table[256*256*4];
+
+// CIN_ResampleCinematic() output, the renderer uploads it before returning
+static	int					cinResampleBuffer[256*256];
+
+// codebooks, decode threads point these at their own tables
+static Q_THREAD_LOCAL unsigned short *vq2 = vq2Table;
+static Q_THREAD_LOCAL unsigned short *vq4 = vq4Table;
+static Q_THREAD_LOCAL unsigned short *vq8 = vq8Table;
+
+static Q_THREAD_LOCAL qboolean cinDecodeThread = qfalse;
 
 
 #define MAX_FRAME_SIZE 65536
@@ -90,6 +100,87 @@ typedef struct {
 
 } cinematics_t;
 
+/*
+=============================================================
+
+Threaded decoding
+
+Cinematics that don't take over the screen can be decoded by a thread
+that keeps a few frames ahead of the clock.  The whole file is read
+into memory when the cinematic starts and the thread runs the regular
+decoder on a shadow slot (handle + MAX_VIDEO_HANDLES) that shares the
+handle's cinematics_t, so the visible slot only ever holds what's on
+screen.  Sound chunks are noted with each frame and played from the
+main thread when the frame is shown.
+
+The test parse done when the cinematic starts also notes the frames
+made only of codebook vectors.  They don't depend on earlier frames, so
+a seek can start decoding from the closest one instead of from the
+beginning of the file.
+
+=============================================================
+*/
+
+#define CIN_QUEUE_FRAMES 4
+#define MAX_CIN_FRAME_AUDIO 16
+
+typedef enum {
+	CIN_FRAME_FREE,
+	CIN_FRAME_DECODING,
+	CIN_FRAME_QUEUED,
+	CIN_FRAME_SHOWN
+} cinFrameState_t;
+
+typedef struct {
+	cinFrameState_t		state;
+	long				frameNum;  // numQuads once the frame is decoded
+	int					loop;
+	byte				*data;
+	int					numAudio;
+	int					audio[MAX_CIN_FRAME_AUDIO];  // file offsets of the sound chunks
+} cinFrame_t;
+
+typedef struct {
+	long				frameNum;  // numQuads before the frame is decoded
+	int					offset;  // codebook chunk right before the frame
+} cinKeyframe_t;
+
+typedef struct cinDecoder_s {
+	int					handle;  // shadow slot
+	byte				*fileData;
+	int					fileSize;
+
+	unsigned short		*vq2, *vq4, *vq8;
+
+	cinFrame_t			frames[CIN_QUEUE_FRAMES];
+	int					frameSize;
+
+	cinKeyframe_t		*keyframes;
+	int					numKeyframes;
+	int					maxKeyframes;
+
+	// decoder side, only touched by whoever runs the shadow slot
+	int					filePos;
+	int					readPos;  // where the last read started
+	int					codebookOffset;
+	int					codebookEnd;
+	int					loop;
+	int					numAudio;
+	int					audio[MAX_CIN_FRAME_AUDIO];
+
+	// guarded by mutex
+	qboolean			looping;
+	long				seekFrame;  // -1 if none
+	int					seekLoop;
+	qboolean			ended;
+	e_status			endStatus;
+	qboolean			quit;
+
+	sysThread_t			*thread;
+	sysMutex_t			*mutex;
+	sysCond_t			*cond;  // frame freed, seek or quit
+} cinDecoder_t;
+
 typedef struct {
 	char				fileName[MAX_OSPATH];
 	int					CIN_WIDTH, CIN_HEIGHT;
@@ -131,13 +222,19 @@ typedef struct {
 	int					playonwalls;
 	byte*				buf;
 	long				drawX, drawY;
+	cinDecoder_t		*decoder;  // NULL when decoded on the main thread
+	int					loop;  // loop of the frame on screen, threaded only
 } cin_cache;
 
 static cinematics_t		cin[MAX_VIDEO_HANDLES];
-static cin_cache		cinTable[MAX_VIDEO_HANDLES];
-static int				currentHandle = -1;
+// the second half are the shadow slots used by decode threads
+static cin_cache		cinTable[MAX_VIDEO_HANDLES * 2];
+static Q_THREAD_LOCAL int currentHandle = -1;
 static int				CL_handle = -1;
 
+// shadow slots use the cinematics_t of their handle
+#define CIN_CURRENT (cin[currentHandle % MAX_VIDEO_HANDLES])
+
 extern int				s_soundtime;		// sample PAIRS
 
 
@@ -181,8 +278,8 @@ static void RllSetupTable( void )
 	int z;
 
 	for (z=0;z<128;z++) {
-		cin[currentHandle].sqrTable[z] = (short)(z*z);
-		cin[currentHandle].sqrTable[z+128] = (short)(-cin[currentHandle].sqrTable[z]);
+		CIN_CURRENT.sqrTable[z] = (short)(z*z);
+		CIN_CURRENT.sqrTable[z+128] = (short)(-CIN_CURRENT.sqrTable[z]);
 	}
 }
 
@@ -213,7 +310,7 @@ static long RllDecodeMonoToMono (const unsigned char *from, short *to, unsigned
 		prev = flag;
 
 	for (z=0;z<size;z++) {
-		prev = to[z] = (short)(prev + cin[currentHandle].sqrTable[from[z]]); 
+		prev = to[z] = (short)(prev + CIN_CURRENT.sqrTable[from[z]]); 
 	}
 	return size;	//*sizeof(short));
 }
@@ -245,7 +342,7 @@ static long RllDecodeMonoToStereo (const unsigned char *from, short *to, unsigne
 		prev = flag;
 
 	for (z = 0; z < size; z++) {
-		prev = (short)(prev + cin[currentHandle].sqrTable[from[z]]);
+		prev = (short)(prev + CIN_CURRENT.sqrTable[from[z]]);
 		to[z*2+0] = to[z*2+1] = (short)(prev);
 	}
 	
@@ -281,8 +378,8 @@ static long RllDecodeStereoToStereo (const unsigned char *from,short *to,unsigne
 	}
 
 	for (z=0;z<size;z+=2) {
-                prevL = (short)(prevL + cin[currentHandle].sqrTable[*zz++]); 
-                prevR = (short)(prevR + cin[currentHandle].sqrTable[*zz++]);
+                prevL = (short)(prevL + CIN_CURRENT.sqrTable[*zz++]); 
+                prevR = (short)(prevR + CIN_CURRENT.sqrTable[*zz++]);
                 to[z+0] = (short)(prevL);
                 to[z+1] = (short)(prevR);
 	}
@@ -319,8 +416,8 @@ static long RllDecodeStereoToMono(const unsigned char *from,short *to,unsigned i
 	}
 
 	for (z=0;z<size;z+=1) {
-		prevL= prevL + cin[currentHandle].sqrTable[from[z*2]];
-		prevR = prevR + cin[currentHandle].sqrTable[from[z*2+1]];
+		prevL= prevL + CIN_CURRENT.sqrTable[from[z*2]];
+		prevR = prevR + CIN_CURRENT.sqrTable[from[z*2+1]];
 		to[z] = (short)((prevL + prevR)/2);
 	}
 
@@ -489,7 +586,7 @@ int		spl;
 							data++;
 							break;
 						case	0x4000:										// motion compensation
-							move4_32( status[index] + cin[currentHandle].mcomp[(*data)], status[index], spl );
+							move4_32( status[index] + CIN_CURRENT.mcomp[(*data)], status[index], spl );
 							data++;
 							break;
 					}
@@ -497,7 +594,7 @@ int		spl;
 				}
 				break;
 			case	0x4000:													// motion compensation
-				move8_32( status[index] + cin[currentHandle].mcomp[(*data)], status[index], spl );
+				move8_32( status[index] + CIN_CURRENT.mcomp[(*data)], status[index], spl );
 				data++;
 				index += 5;
 				break;
@@ -922,10 +1019,10 @@ static void recurseQuad( long startX, long startY, long quadSize, long xOff, lon
 
 	if ( (startX >= lowx) && (startX+quadSize) <= (bigx) && (startY+quadSize) <= (bigy) && (startY >= lowy) && quadSize <= MAXSIZE) {
 		useY = startY;
-		scroff = cin[currentHandle].linbuf + (useY+((cinTable[currentHandle].CIN_HEIGHT-bigy)>>1)+yOff)*(cinTable[currentHandle].samplesPerLine) + (((startX+xOff))*cinTable[currentHandle].samplesPerPixel);
+		scroff = CIN_CURRENT.linbuf + (useY+((cinTable[currentHandle].CIN_HEIGHT-bigy)>>1)+yOff)*(cinTable[currentHandle].samplesPerLine) + (((startX+xOff))*cinTable[currentHandle].samplesPerPixel);
 
-		cin[currentHandle].qStatus[0][cinTable[currentHandle].onQuad  ] = scroff;
-		cin[currentHandle].qStatus[1][cinTable[currentHandle].onQuad++] = scroff+offset;
+		CIN_CURRENT.qStatus[0][cinTable[currentHandle].onQuad  ] = scroff;
+		CIN_CURRENT.qStatus[1][cinTable[currentHandle].onQuad++] = scroff+offset;
 	}
 
 	if ( quadSize != MINSIZE ) {
@@ -951,14 +1048,14 @@ static void setupQuad( long xOff, long yOff )
 	long numQuadCels, i,x,y;
 	byte *temp;
 
-	if (xOff == cin[currentHandle].oldXOff && yOff == cin[currentHandle].oldYOff && cinTable[currentHandle].ysize == cin[currentHandle].oldysize && cinTable[currentHandle].xsize == cin[currentHandle].oldxsize) {
+	if (xOff == CIN_CURRENT.oldXOff && yOff == CIN_CURRENT.oldYOff && cinTable[currentHandle].ysize == CIN_CURRENT.oldysize && cinTable[currentHandle].xsize == CIN_CURRENT.oldxsize) {
 		return;
 	}
 
-	cin[currentHandle].oldXOff = xOff;
-	cin[currentHandle].oldYOff = yOff;
-	cin[currentHandle].oldysize = cinTable[currentHandle].ysize;
-	cin[currentHandle].oldxsize = cinTable[currentHandle].xsize;
+	CIN_CURRENT.oldXOff = xOff;
+	CIN_CURRENT.oldYOff = yOff;
+	CIN_CURRENT.oldysize = cinTable[currentHandle].ysize;
+	CIN_CURRENT.oldxsize = cinTable[currentHandle].xsize;
 
 	numQuadCels  = (cinTable[currentHandle].xsize*cinTable[currentHandle].ysize) / (16);
 	numQuadCels += numQuadCels/4;
@@ -973,8 +1070,8 @@ static void setupQuad( long xOff, long yOff )
 	temp = NULL;
 
 	for(i=(numQuadCels-64);i<numQuadCels;i++) {
-		cin[currentHandle].qStatus[0][i] = temp;			  // eoq
-		cin[currentHandle].qStatus[1][i] = temp;			  // eoq
+		CIN_CURRENT.qStatus[0][i] = temp;			  // eoq
+		CIN_CURRENT.qStatus[1][i] = temp;			  // eoq
 	}
 }
 
@@ -1021,7 +1118,7 @@ static void readQuadInfo( const byte *qData )
                 if (cinTable[currentHandle].drawY>256) {
                         cinTable[currentHandle].drawY = 256;
                 }
-		if (cinTable[currentHandle].CIN_WIDTH != 256 || cinTable[currentHandle].CIN_HEIGHT != 256) {
+		if ((cinTable[currentHandle].CIN_WIDTH != 256 || cinTable[currentHandle].CIN_HEIGHT != 256) && !cinDecodeThread) {
 			Com_Printf("HACK: approxmimating cinematic for Rage Pro or Voodoo\n");
 		}
 	}
@@ -1046,7 +1143,7 @@ static void RoQPrepMcomp( long xoff, long yoff )
 		temp2 = (y+yoff-8)*i;
 		for(x=0;x<16;x++) {
 			temp = (x+xoff-8)*j;
-			cin[currentHandle].mcomp[(x*16)+y] = cinTable[currentHandle].normalBuffer0-(temp2+temp);
+			CIN_CURRENT.mcomp[(x*16)+y] = cinTable[currentHandle].normalBuffer0-(temp2+temp);
 		}
 	}
 }
@@ -1093,14 +1190,160 @@ static byte* RoQFetchInterlaced( byte *source ) {
 	return cinTable[currentHandle].buf2;
 }
 */
+/******************************************************************************
+*
+* Function:		RoQRead
+*
+* Description:	reads from the file, or from memory for shadow slots
+*
+******************************************************************************/
+
+static int RoQRead( void *buffer, int len )
+{
+	cinDecoder_t *d;
+
+	d = cinTable[currentHandle].decoder;
+	if (!d) {
+		return FS_Read(buffer, len, cinTable[currentHandle].iFile);
+	}
+
+	d->readPos = d->filePos;
+	if (len > d->fileSize - d->filePos) {
+		len = d->fileSize - d->filePos;
+	}
+	if (len <= 0) {
+		return 0;
+	}
+	Com_Memcpy(buffer, d->fileData + d->filePos, len);
+	d->filePos += len;
+
+	return len;
+}
+
+// file offset of the header of the chunk framedata points to
+static int RoQChunkOffset( const byte *framedata )
+{
+	return cinTable[currentHandle].decoder->readPos + (int)(framedata - CIN_CURRENT.file) - 8;
+}
+
+/******************************************************************************
+*
+* Function:		RoQIntraFrame
+*
+* Description:	walks the cells like blitVQQuad32fs() and checks that none
+*				of them use motion compensation or are skipped
+*
+******************************************************************************/
+
+static qboolean RoQIntraFrame( const byte *data )
+{
+	byte			**status;
+	unsigned short	newd, celdata, code;
+	unsigned int	index, i;
+
+	status = CIN_CURRENT.qStatus[0];
+	if (!status[0]) {
+		return qfalse;
+	}
+
+	newd	= 0;
+	celdata = 0;
+	index	= 0;
+
+	do {
+		if (!newd) {
+			newd = 7;
+			celdata = data[0] + data[1]*256;
+			data += 2;
+		} else {
+			newd--;
+		}
+
+		code = (unsigned short)(celdata&0xc000);
+		celdata <<= 2;
+
+		switch (code) {
+			case	0x8000:
+				data++;
+				index += 5;
+				break;
+			case	0xc000:
+				index++;
+				for(i=0;i<4;i++) {
+					if (!newd) {
+						newd = 7;
+						celdata = data[0] + data[1]*256;
+						data += 2;
+					} else {
+						newd--;
+					}
+
+					code = (unsigned short)(celdata&0xc000); celdata <<= 2;
+
+					switch (code) {
+						case	0x8000:
+							data++;
+							break;
+						case	0xc000:
+							data += 4;
+							break;
+						default:
+							return qfalse;
+					}
+					index++;
+				}
+				break;
+			default:
+				return qfalse;
+		}
+	} while ( status[index] != NULL );
+
+	return qtrue;
+}
+
+static void RoQAddKeyframe( void )
+{
+	cinDecoder_t *d;
+	cinKeyframe_t *keyframes;
+
+	d = cinTable[currentHandle].decoder;
+	if (d->numKeyframes >= d->maxKeyframes) {
+		keyframes = realloc(d->keyframes, (d->maxKeyframes + 64) * sizeof(cinKeyframe_t));
+		if (!keyframes) {
+			return;
+		}
+		d->keyframes = keyframes;
+		d->maxKeyframes += 64;
+	}
+
+	d->keyframes[d->numKeyframes].frameNum = cinTable[currentHandle].numQuads;
+	d->keyframes[d->numKeyframes].offset = d->codebookOffset;
+	d->numKeyframes++;
+}
+
+static void RoQQueueAudio( int offset )
+{
+	cinDecoder_t *d;
+
+	d = cinTable[currentHandle].decoder;
+	if (cinTable[currentHandle].silent || d->numAudio >= MAX_CIN_FRAME_AUDIO) {
+		return;
+	}
+	d->audio[d->numAudio++] = offset;
+}
+
 static void RoQReset( void ) {
 	
 	if (currentHandle < 0) return;
 
-	FS_FCloseFile( cinTable[currentHandle].iFile );
-	FS_FOpenFileRead (cinTable[currentHandle].fileName, &cinTable[currentHandle].iFile, qtrue);
+	if (cinTable[currentHandle].decoder) {
+		cinTable[currentHandle].decoder->filePos = 0;
+	} else {
+		FS_FCloseFile( cinTable[currentHandle].iFile );
+		FS_FOpenFileRead (cinTable[currentHandle].fileName, &cinTable[currentHandle].iFile, qtrue);
+	}
 	// let the background thread start reading ahead
-	FS_Read (cin[currentHandle].file, 16, cinTable[currentHandle].iFile);
+	RoQRead (CIN_CURRENT.file, 16);
 	RoQ_init();
 	cinTable[currentHandle].status = FMV_LOOPED;
 }
@@ -1125,11 +1368,13 @@ static void RoQInterrupt(void)
 	// need additional check here since this could be set in RoQ_init()
 	//FIXME also check cinTable[currentHandle].RoQFRameSize == 0 ?
 	if (cinTable[currentHandle].RoQFrameSize > MAX_FRAME_SIZE) {
-		Com_Printf("^1%s: invalid RoQFrameSize: %d\n", __FUNCTION__, cinTable[currentHandle].RoQFrameSize);
+		if (!cinDecodeThread) {
+			Com_Printf("^1%s: invalid RoQFrameSize: %d\n", __FUNCTION__, cinTable[currentHandle].RoQFrameSize);
+		}
 		cinTable[currentHandle].status = FMV_EOF;
 	}
 
-	FS_Read( cin[currentHandle].file, cinTable[currentHandle].RoQFrameSize+8, cinTable[currentHandle].iFile );
+	RoQRead( CIN_CURRENT.file, cinTable[currentHandle].RoQFrameSize+8 );
 	if ( cinTable[currentHandle].RoQPlayed >= cinTable[currentHandle].ROQSize ) { 
 		if (cinTable[currentHandle].holdAtEnd==qfalse) {
 			if (cinTable[currentHandle].looping) {
@@ -1143,7 +1388,7 @@ static void RoQInterrupt(void)
 		return; 
 	}
 
-	framedata = cin[currentHandle].file;
+	framedata = CIN_CURRENT.file;
 	testParse = cinTable[currentHandle].testParse;
 //
 // new frame is ready
@@ -1153,6 +1398,9 @@ redump:
 	{
 		case	ROQ_QUAD_VQ:
 			if (testParse) {
+				if (cinTable[currentHandle].decoder && RoQChunkOffset(framedata) == cinTable[currentHandle].decoder->codebookEnd && RoQIntraFrame(framedata)) {
+					RoQAddKeyframe();
+				}
 				cinTable[currentHandle].numQuads++;
 				cinTable[currentHandle].totalQuads++;
 				cinTable[currentHandle].dirty = qtrue;
@@ -1162,16 +1410,16 @@ redump:
 			if ((cinTable[currentHandle].numQuads&1)) {
 				cinTable[currentHandle].normalBuffer0 = cinTable[currentHandle].t[1];
 				RoQPrepMcomp( cinTable[currentHandle].roqF0, cinTable[currentHandle].roqF1 );
-				cinTable[currentHandle].VQ1( (byte *)cin[currentHandle].qStatus[1], framedata);
-				cinTable[currentHandle].buf = 	cin[currentHandle].linbuf + cinTable[currentHandle].screenDelta;
+				cinTable[currentHandle].VQ1( (byte *)CIN_CURRENT.qStatus[1], framedata);
+				cinTable[currentHandle].buf = 	CIN_CURRENT.linbuf + cinTable[currentHandle].screenDelta;
 			} else {
 				cinTable[currentHandle].normalBuffer0 = cinTable[currentHandle].t[0];
 				RoQPrepMcomp( cinTable[currentHandle].roqF0, cinTable[currentHandle].roqF1 );
-				cinTable[currentHandle].VQ0( (byte *)cin[currentHandle].qStatus[0], framedata );
-				cinTable[currentHandle].buf = 	cin[currentHandle].linbuf;
+				cinTable[currentHandle].VQ0( (byte *)CIN_CURRENT.qStatus[0], framedata );
+				cinTable[currentHandle].buf = 	CIN_CURRENT.linbuf;
 			}
 			if (cinTable[currentHandle].numQuads == 0) {		// first frame
-				Com_Memcpy(cin[currentHandle].linbuf+cinTable[currentHandle].screenDelta, cin[currentHandle].linbuf, cinTable[currentHandle].samplesPerLine*cinTable[currentHandle].ysize);
+				Com_Memcpy(CIN_CURRENT.linbuf+cinTable[currentHandle].screenDelta, CIN_CURRENT.linbuf, cinTable[currentHandle].samplesPerLine*cinTable[currentHandle].ysize);
 			}
 
 			cinTable[currentHandle].numQuads++;
@@ -1179,6 +1427,10 @@ redump:
 			break;
 		case	ROQ_CODEBOOK:
 			if (testParse) {
+				if (cinTable[currentHandle].decoder) {
+					cinTable[currentHandle].decoder->codebookOffset = RoQChunkOffset(framedata);
+					cinTable[currentHandle].decoder->codebookEnd = RoQChunkOffset(framedata) + 8 + cinTable[currentHandle].RoQFrameSize;
+				}
 				break;
 			}
 
@@ -1189,7 +1441,10 @@ redump:
 				break;
 			}
 
-			if (!cinTable[currentHandle].silent) {
+			if (cinTable[currentHandle].decoder) {
+				// played when the frame is shown
+				RoQQueueAudio(RoQChunkOffset(framedata));
+			} else if (!cinTable[currentHandle].silent) {
 				if (cinTable[currentHandle].numQuads == -1) {
 					S_Update();
 					s_rawend[0] = s_soundtime;
@@ -1203,7 +1458,10 @@ redump:
 				break;
 			}
 
-			if (!cinTable[currentHandle].silent) {
+			if (cinTable[currentHandle].decoder) {
+				// played when the frame is shown
+				RoQQueueAudio(RoQChunkOffset(framedata));
+			} else if (!cinTable[currentHandle].silent) {
 				if (cinTable[currentHandle].numQuads == -1) {
 					S_Update();
 					s_rawend[0] = s_soundtime;
@@ -1216,7 +1474,9 @@ redump:
 			if (cinTable[currentHandle].numQuads == -1) {
 				readQuadInfo( framedata );
 				setupQuad( 0, 0 );
-				cinTable[currentHandle].startTime = cinTable[currentHandle].lastTime = CL_ScaledMilliseconds();
+				if (!cinDecodeThread) {
+					cinTable[currentHandle].startTime = cinTable[currentHandle].lastTime = CL_ScaledMilliseconds();
+				}
 			}
 			if (cinTable[currentHandle].numQuads != 1) cinTable[currentHandle].numQuads = 0;
 			break;
@@ -1258,7 +1518,9 @@ redump:
 
 	//FIXME also check if cinTable[currentHandle].RoQFrameSize == 0 ?
 	if (cinTable[currentHandle].RoQFrameSize > MAX_FRAME_SIZE || cinTable[currentHandle].roq_id==0x1084) {
-		Com_DPrintf("roq_size>%d||roq_id==0x1084\n", MAX_FRAME_SIZE);
+		if (!cinDecodeThread) {
+			Com_DPrintf("roq_size>%d||roq_id==0x1084\n", MAX_FRAME_SIZE);
+		}
 		cinTable[currentHandle].status = FMV_EOF;
 		if (cinTable[currentHandle].looping) {
 			RoQReset();
@@ -1270,7 +1532,7 @@ redump:
 // one more frame hits the dust
 //
 //	assert(cinTable[currentHandle].RoQFrameSize <= MAX_FRAME_SIZE);
-//	r = FS_Read( cin[currentHandle].file, cinTable[currentHandle].RoQFrameSize+8, cinTable[currentHandle].iFile );
+//	r = FS_Read( CIN_CURRENT.file, cinTable[currentHandle].RoQFrameSize+8, cinTable[currentHandle].iFile );
 	cinTable[currentHandle].RoQPlayed	+= cinTable[currentHandle].RoQFrameSize+8;
 }
 
@@ -1284,28 +1546,514 @@ redump:
 
 static void RoQ_init( void )
 {
-	cinTable[currentHandle].startTime = cinTable[currentHandle].lastTime = CL_ScaledMilliseconds();
+	if (!cinDecodeThread) {
+		cinTable[currentHandle].startTime = cinTable[currentHandle].lastTime = CL_ScaledMilliseconds();
+	}
 
 	cinTable[currentHandle].RoQPlayed = 24;
 
 /*	get frame rate */	
-	cinTable[currentHandle].roqFPS	 = cin[currentHandle].file[ 6] + cin[currentHandle].file[ 7]*256;
+	cinTable[currentHandle].roqFPS	 = CIN_CURRENT.file[ 6] + CIN_CURRENT.file[ 7]*256;
 	
 	if (!cinTable[currentHandle].roqFPS) cinTable[currentHandle].roqFPS = 30;
 
 	cinTable[currentHandle].numQuads = -1;
 
-	cinTable[currentHandle].roq_id		= cin[currentHandle].file[ 8] + cin[currentHandle].file[ 9]*256;
-	cinTable[currentHandle].RoQFrameSize	= cin[currentHandle].file[10] + cin[currentHandle].file[11]*256 + cin[currentHandle].file[12]*65536;
-	cinTable[currentHandle].roq_flags	= cin[currentHandle].file[14] + cin[currentHandle].file[15]*256;
+	cinTable[currentHandle].roq_id		= CIN_CURRENT.file[ 8] + CIN_CURRENT.file[ 9]*256;
+	cinTable[currentHandle].RoQFrameSize	= CIN_CURRENT.file[10] + CIN_CURRENT.file[11]*256 + CIN_CURRENT.file[12]*65536;
+	cinTable[currentHandle].roq_flags	= CIN_CURRENT.file[14] + CIN_CURRENT.file[15]*256;
 
-	if (cinTable[currentHandle].RoQFrameSize > MAX_FRAME_SIZE || !cinTable[currentHandle].RoQFrameSize) {
+	if ((cinTable[currentHandle].RoQFrameSize > MAX_FRAME_SIZE || !cinTable[currentHandle].RoQFrameSize) && !cinDecodeThread) {
 		Com_Printf("^3%s: invalid RoQFrameSize: %d\n", __FUNCTION__, cinTable[currentHandle].RoQFrameSize);
 		return;
 	}
 
 }
 
+/*
+==================
+RoQTestParse
+
+Runs through the file without decoding anything to count the frames
+==================
+*/
+static void RoQTestParse( void )
+{
+	qboolean loopingOrig;
+
+	loopingOrig = cinTable[currentHandle].looping;
+	cinTable[currentHandle].looping = qfalse;  // to allow FMV_EOF status
+	cinTable[currentHandle].testParse = qtrue;
+	cinTable[currentHandle].totalQuads = 0;
+
+	// video can end with FMV_EOF or FMV_IDLE (holdAtEnd option)
+	while (cinTable[currentHandle].status == FMV_PLAY) {
+		// this is incrementing totalQuads
+		RoQInterrupt();
+	}
+
+	RoQReset();
+	cinTable[currentHandle].testParse = qfalse;
+	cinTable[currentHandle].looping = loopingOrig;
+	cinTable[currentHandle].playCallStartTime = CL_ScaledMilliseconds();
+	cinTable[currentHandle].status = FMV_PLAY;
+}
+
+// decodes until the next frame is ready, qfalse at the end of the file
+static qboolean RoQDecodeFrame( cinDecoder_t *d )
+{
+	long numQuads;
+
+	numQuads = cinTable[currentHandle].numQuads;
+	while (cinTable[currentHandle].numQuads < 1  ||  cinTable[currentHandle].numQuads == numQuads) {
+		if (cinTable[currentHandle].status == FMV_LOOPED) {
+			cinTable[currentHandle].status = FMV_PLAY;
+			numQuads = -1;
+			d->loop++;
+		}
+		if (cinTable[currentHandle].status != FMV_PLAY) {
+			return qfalse;
+		}
+		RoQInterrupt();
+	}
+
+	return qtrue;
+}
+
+static void RoQJumpToKeyframe( const cinKeyframe_t *k )
+{
+	const byte *f;
+
+	cinTable[currentHandle].decoder->filePos = k->offset;
+	RoQRead(CIN_CURRENT.file, 8);
+
+	f = CIN_CURRENT.file;
+	cinTable[currentHandle].roq_id = f[0] + f[1]*256;
+	cinTable[currentHandle].RoQFrameSize = f[2] + f[3]*256 + f[4]*65536;
+	cinTable[currentHandle].roq_flags = f[6] + f[7]*256;
+	cinTable[currentHandle].roqF0 = (signed char)f[7];
+	cinTable[currentHandle].roqF1 = (signed char)f[6];
+	cinTable[currentHandle].RoQPlayed = k->offset + 16;
+	cinTable[currentHandle].inMemory = 0;
+	cinTable[currentHandle].numQuads = k->frameNum;
+	cinTable[currentHandle].status = FMV_PLAY;
+
+	// codebook and the frame itself
+	while (cinTable[currentHandle].numQuads == k->frameNum  &&  cinTable[currentHandle].status == FMV_PLAY) {
+		RoQInterrupt();
+	}
+
+	// the frame after it can refer back to either buffer, same as the
+	// first frame of the file
+	if (cinTable[currentHandle].buf == CIN_CURRENT.linbuf) {
+		Com_Memcpy(CIN_CURRENT.linbuf + cinTable[currentHandle].screenDelta, CIN_CURRENT.linbuf, cinTable[currentHandle].screenDelta);
+	} else if (cinTable[currentHandle].buf) {
+		Com_Memcpy(CIN_CURRENT.linbuf, CIN_CURRENT.linbuf + cinTable[currentHandle].screenDelta, cinTable[currentHandle].screenDelta);
+	}
+}
+
+// gets the shadow slot ready to decode frame next
+static void RoQSeekFrame( cinDecoder_t *d, long frame )
+{
+	const cinKeyframe_t *k;
+	int i;
+
+	k = NULL;
+	for (i = 0;  i < d->numKeyframes;  i++) {
+		if (d->keyframes[i].frameNum >= frame - 1) {
+			break;
+		}
+		k = &d->keyframes[i];
+	}
+
+	if (cinTable[currentHandle].status != FMV_PLAY  ||  cinTable[currentHandle].numQuads > frame - 1  ||  (k  &&  k->frameNum >= cinTable[currentHandle].numQuads)) {
+		if (k) {
+			RoQJumpToKeyframe(k);
+		} else {
+			RoQReset();
+			cinTable[currentHandle].status = FMV_PLAY;
+		}
+	}
+
+	while (cinTable[currentHandle].numQuads < frame - 1  &&  cinTable[currentHandle].status == FMV_PLAY) {
+		RoQInterrupt();
+	}
+}
+
+static void CIN_DecodeThread( void *arg )
+{
+	cinDecoder_t *d = (cinDecoder_t *)arg;
+	cinFrame_t *frame;
+	long seekFrame;
+	qboolean decoded;
+	int i;
+
+	currentHandle = d->handle;
+	cinDecodeThread = qtrue;
+	vq2 = d->vq2;
+	vq4 = d->vq4;
+	vq8 = d->vq8;
+
+	Sys_LockMutex(d->mutex);
+	while (!d->quit) {
+		if (d->seekFrame >= 0) {
+			seekFrame = d->seekFrame;
+			d->seekFrame = -1;
+			d->loop = d->seekLoop;
+			cinTable[currentHandle].looping = d->looping;
+			Sys_UnlockMutex(d->mutex);
+
+			RoQSeekFrame(d, seekFrame);
+
+			Sys_LockMutex(d->mutex);
+			continue;
+		}
+
+		frame = NULL;
+		if (!d->ended) {
+			for (i = 0;  i < CIN_QUEUE_FRAMES;  i++) {
+				if (d->frames[i].state == CIN_FRAME_FREE) {
+					frame = &d->frames[i];
+					break;
+				}
+			}
+		}
+		if (!frame) {
+			Sys_CondWait(d->cond, d->mutex);
+			continue;
+		}
+
+		frame->state = CIN_FRAME_DECODING;
+		cinTable[currentHandle].looping = d->looping;
+		Sys_UnlockMutex(d->mutex);
+
+		d->numAudio = 0;
+		decoded = RoQDecodeFrame(d);
+		if (decoded) {
+			Com_Memcpy(frame->data, cinTable[currentHandle].buf, d->frameSize);
+			frame->frameNum = cinTable[currentHandle].numQuads;
+			frame->loop = d->loop;
+			frame->numAudio = d->numAudio;
+			Com_Memcpy(frame->audio, d->audio, d->numAudio * sizeof(int));
+		}
+
+		Sys_LockMutex(d->mutex);
+		if (d->seekFrame >= 0) {
+			// stale, the seek starts over
+			frame->state = CIN_FRAME_FREE;
+		} else if (!decoded) {
+			frame->state = CIN_FRAME_FREE;
+			d->ended = qtrue;
+			d->endStatus = cinTable[currentHandle].status;
+		} else {
+			frame->state = CIN_FRAME_QUEUED;
+		}
+	}
+	Sys_UnlockMutex(d->mutex);
+}
+
+static void CIN_FreeDecoder( cinDecoder_t *d )
+{
+	int i;
+
+	for (i = 0;  i < CIN_QUEUE_FRAMES;  i++) {
+		free(d->frames[i].data);
+	}
+	free(d->keyframes);
+	free(d->vq2);
+	free(d->vq4);
+	free(d->vq8);
+	free(d->fileData);
+	if (d->cond) {
+		Sys_DestroyCond(d->cond);
+	}
+	if (d->mutex) {
+		Sys_DestroyMutex(d->mutex);
+	}
+	free(d);
+}
+
+/*
+==================
+CIN_StartDecoder
+
+Reads the file into memory, runs the test parse on the shadow slot to
+count frames and find keyframes, and starts the decode thread.  Returns
+qfalse if the cinematic has to be decoded on the main thread instead.
+==================
+*/
+static qboolean CIN_StartDecoder( void )
+{
+	cinDecoder_t *d;
+	int handle;
+	int shadow;
+	int i;
+
+	handle = currentHandle;
+	shadow = handle + MAX_VIDEO_HANDLES;
+
+	d = calloc(1, sizeof(cinDecoder_t));
+	if (!d) {
+		return qfalse;
+	}
+
+	d->handle = shadow;
+	d->fileSize = cinTable[handle].ROQSize;
+	d->fileData = malloc(d->fileSize);
+	d->vq2 = malloc(sizeof(vq2Table));
+	d->vq4 = malloc(sizeof(vq4Table));
+	d->vq8 = malloc(sizeof(vq8Table));
+	d->mutex = Sys_CreateMutex();
+	d->cond = Sys_CreateCond();
+	if (!d->fileData  ||  !d->vq2  ||  !d->vq4  ||  !d->vq8  ||  !d->mutex  ||  !d->cond) {
+		CIN_FreeDecoder(d);
+		return qfalse;
+	}
+
+	FS_Seek(cinTable[handle].iFile, 0, FS_SEEK_SET);
+	if (FS_Read(d->fileData, d->fileSize, cinTable[handle].iFile) != d->fileSize) {
+		FS_Seek(cinTable[handle].iFile, 16, FS_SEEK_SET);
+		CIN_FreeDecoder(d);
+		return qfalse;
+	}
+
+	// CIN_PlayCinematic() already read the header
+	cinTable[shadow] = cinTable[handle];
+	cinTable[shadow].decoder = d;
+	d->filePos = 16;
+	d->codebookEnd = -1;
+	d->seekFrame = -1;
+
+	currentHandle = shadow;
+	RoQTestParse();
+	currentHandle = handle;
+
+	d->frameSize = cinTable[shadow].samplesPerLine * cinTable[shadow].CIN_HEIGHT;
+	if (d->frameSize <= 0  ||  d->frameSize > (int)sizeof(cin[0].linbuf) / 2  ||  cinTable[shadow].totalQuads < 1) {
+		Com_DPrintf("CIN_StartDecoder: can't thread %s\n", cinTable[handle].fileName);
+		FS_Seek(cinTable[handle].iFile, 16, FS_SEEK_SET);
+		Com_Memset(&cinTable[shadow], 0, sizeof(cin_cache));
+		CIN_FreeDecoder(d);
+		return qfalse;
+	}
+
+	for (i = 0;  i < CIN_QUEUE_FRAMES;  i++) {
+		d->frames[i].data = malloc(d->frameSize);
+		if (!d->frames[i].data) {
+			break;
+		}
+	}
+
+	d->looping = cinTable[handle].looping;
+	if (i == CIN_QUEUE_FRAMES) {
+		d->thread = Sys_CreateThread(CIN_DecodeThread, d);
+	}
+	if (!d->thread) {
+		Com_Printf("^3CIN_StartDecoder: couldn't start decode thread for %s\n", cinTable[handle].fileName);
+		FS_Seek(cinTable[handle].iFile, 16, FS_SEEK_SET);
+		Com_Memset(&cinTable[shadow], 0, sizeof(cin_cache));
+		CIN_FreeDecoder(d);
+		return qfalse;
+	}
+
+	cinTable[handle].decoder = d;
+	cinTable[handle].loop = 0;
+	cinTable[handle].totalQuads = cinTable[shadow].totalQuads;
+	cinTable[handle].CIN_WIDTH = cinTable[shadow].CIN_WIDTH;
+	cinTable[handle].CIN_HEIGHT = cinTable[shadow].CIN_HEIGHT;
+	cinTable[handle].drawX = cinTable[shadow].drawX;
+	cinTable[handle].drawY = cinTable[shadow].drawY;
+	cinTable[handle].playCallStartTime = CL_ScaledMilliseconds();
+
+	FS_FCloseFile(cinTable[handle].iFile);
+	cinTable[handle].iFile = 0;
+
+	Com_DPrintf("CIN_StartDecoder: %s  %ld frames  %d keyframes\n", cinTable[handle].fileName, cinTable[handle].totalQuads, d->numKeyframes);
+
+	return qtrue;
+}
+
+static void CIN_StopDecoder( void )
+{
+	cinDecoder_t *d;
+
+	d = cinTable[currentHandle].decoder;
+	if (!d) {
+		return;
+	}
+
+	Sys_LockMutex(d->mutex);
+	d->quit = qtrue;
+	Sys_CondSignal(d->cond);
+	Sys_UnlockMutex(d->mutex);
+	Sys_JoinThread(d->thread);
+
+	CIN_FreeDecoder(d);
+	Com_Memset(&cinTable[currentHandle + MAX_VIDEO_HANDLES], 0, sizeof(cin_cache));
+	cinTable[currentHandle].decoder = NULL;
+	cinTable[currentHandle].buf = NULL;
+}
+
+static void CIN_SeekDecoder( long frame )
+{
+	cinDecoder_t *d;
+	int i;
+
+	d = cinTable[currentHandle].decoder;
+
+	Sys_LockMutex(d->mutex);
+	for (i = 0;  i < CIN_QUEUE_FRAMES;  i++) {
+		if (d->frames[i].state == CIN_FRAME_QUEUED) {
+			d->frames[i].state = CIN_FRAME_FREE;
+		}
+	}
+	d->seekFrame = frame;
+	d->seekLoop = cinTable[currentHandle].loop;
+	d->looping = cinTable[currentHandle].looping;
+	d->ended = qfalse;
+	Sys_CondSignal(d->cond);
+	Sys_UnlockMutex(d->mutex);
+
+	// what's on screen stays there until the new frame is decoded
+	cinTable[currentHandle].numQuads = frame;
+	cinTable[currentHandle].status = FMV_PLAY;
+}
+
+static void CIN_RestartDecoder( void )
+{
+	CIN_SeekDecoder(0);
+	cinTable[currentHandle].numQuads = -1;
+	cinTable[currentHandle].startTime = cinTable[currentHandle].lastTime = CL_ScaledMilliseconds();
+}
+
+static void CIN_PlayFrameAudio( const cinFrame_t *frame )
+{
+	const cinDecoder_t *d;
+	const byte *chunk;
+	short sbuf[32768];
+	int size;
+	int ssize;
+	int i;
+
+	if (cinTable[currentHandle].silent) {
+		return;
+	}
+
+	d = cinTable[currentHandle].decoder;
+	for (i = 0;  i < frame->numAudio;  i++) {
+		chunk = d->fileData + frame->audio[i];
+		size = chunk[2] + chunk[3]*256 + chunk[4]*65536;
+		if (frame->audio[i] + 8 + size > d->fileSize) {
+			continue;
+		}
+
+		if (cinTable[currentHandle].numQuads == -1) {
+			S_Update();
+			s_rawend[0] = s_soundtime;
+		}
+
+		if (chunk[0] + chunk[1]*256 == ZA_SOUND_MONO) {
+			if (size * 2 > (int)ARRAY_LEN(sbuf)) {
+				continue;
+			}
+			ssize = RllDecodeMonoToStereo(chunk + 8, sbuf, size, 0, (unsigned short)(chunk[6] + chunk[7]*256));
+			S_RawSamples(0, ssize, 22050, 2, 1, (byte *)sbuf, 1.0f, -1);
+		} else {
+			if (size > (int)ARRAY_LEN(sbuf)) {
+				continue;
+			}
+			ssize = RllDecodeStereoToStereo(chunk + 8, sbuf, size, 0, (unsigned short)(chunk[6] + chunk[7]*256));
+			S_RawSamples(0, ssize, 22050, 2, 2, (byte *)sbuf, 1.0f, -1);
+		}
+	}
+}
+
+/*
+==================
+CIN_ShowDecodedFrames
+
+Puts the latest decoded frame that's due on screen.  Frames it skips
+over still get their sound played, in order.
+==================
+*/
+static void CIN_ShowDecodedFrames( int thisTime )
+{
+	cinDecoder_t *d;
+	cinFrame_t *frame;
+	cinFrame_t *f;
+	qboolean queued;
+	int i;
+
+	d = cinTable[currentHandle].decoder;
+
+	Sys_LockMutex(d->mutex);
+
+	// once this loop is played out the next one starts over from the
+	// current time, same as RoQ_init() does for unthreaded cinematics
+	if (cinTable[currentHandle].tfps > cinTable[currentHandle].totalQuads) {
+		frame = NULL;
+		queued = qfalse;
+		for (i = 0;  i < CIN_QUEUE_FRAMES;  i++) {
+			f = &d->frames[i];
+			if (f->state != CIN_FRAME_QUEUED) {
+				continue;
+			}
+			if (f->loop == cinTable[currentHandle].loop) {
+				queued = qtrue;
+			} else {
+				frame = f;
+			}
+		}
+		if (frame  &&  !queued) {
+			cinTable[currentHandle].loop = frame->loop;
+			cinTable[currentHandle].numQuads = -1;
+			cinTable[currentHandle].startTime = cinTable[currentHandle].lastTime = thisTime;
+			cinTable[currentHandle].tfps = 0;
+		}
+	}
+
+	while (1) {
+		frame = NULL;
+		for (i = 0;  i < CIN_QUEUE_FRAMES;  i++) {
+			f = &d->frames[i];
+			if (f->state == CIN_FRAME_QUEUED  &&  f->loop == cinTable[currentHandle].loop  &&  f->frameNum <= cinTable[currentHandle].tfps) {
+				if (!frame  ||  f->frameNum < frame->frameNum) {
+					frame = f;
+				}
+			}
+		}
+		if (!frame) {
+			break;
+		}
+
+		CIN_PlayFrameAudio(frame);
+
+		for (i = 0;  i < CIN_QUEUE_FRAMES;  i++) {
+			if (d->frames[i].state == CIN_FRAME_SHOWN) {
+				d->frames[i].state = CIN_FRAME_FREE;
+			}
+		}
+		frame->state = CIN_FRAME_SHOWN;
+		cinTable[currentHandle].buf = frame->data;
+		cinTable[currentHandle].numQuads = frame->frameNum;
+		cinTable[currentHandle].dirty = qtrue;
+		Sys_CondSignal(d->cond);
+	}
+
+	if (d->ended  &&  cinTable[currentHandle].tfps > cinTable[currentHandle].numQuads) {
+		for (i = 0;  i < CIN_QUEUE_FRAMES;  i++) {
+			if (d->frames[i].state == CIN_FRAME_QUEUED) {
+				break;
+			}
+		}
+		if (i == CIN_QUEUE_FRAMES) {
+			cinTable[currentHandle].status = d->endStatus;
+		}
+	}
+
+	Sys_UnlockMutex(d->mutex);
+}
+
 /******************************************************************************
 *
 * Function:		
@@ -1317,7 +2065,8 @@ static void RoQ_init( void )
 static void RoQShutdown( void ) {
 	const char *s;
 
-	if (!cinTable[currentHandle].buf) {
+	// threaded ones might not have shown a frame yet
+	if (!cinTable[currentHandle].buf && !cinTable[currentHandle].decoder) {
 		return;
 	}
 
@@ -1327,6 +2076,8 @@ static void RoQShutdown( void ) {
 	Com_DPrintf("finished cinematic\n");
 	cinTable[currentHandle].status = FMV_IDLE;
 
+	CIN_StopDecoder();
+
 	if (cinTable[currentHandle].iFile) {
 		FS_FCloseFile( cinTable[currentHandle].iFile );
 		cinTable[currentHandle].iFile = 0;
@@ -1361,7 +2112,7 @@ e_status CIN_StopCinematic(int handle) {
 
 	Com_DPrintf("trFMV::stop(), closing %s\n", cinTable[currentHandle].fileName);
 
-	if (!cinTable[currentHandle].buf) {
+	if (!cinTable[currentHandle].buf && !cinTable[currentHandle].decoder) {
 		return FMV_EOF;
 	}
 
@@ -1436,13 +2187,17 @@ e_status CIN_RunCinematic (int handle)
 #endif
 
 	start = cinTable[currentHandle].startTime;
-	while(  (cinTable[currentHandle].tfps != cinTable[currentHandle].numQuads)
-		&& (cinTable[currentHandle].status == FMV_PLAY) )
-	{
-		RoQInterrupt();
-		if (start != cinTable[currentHandle].startTime) {
-		  cinTable[currentHandle].tfps = ((((thisTime) - cinTable[currentHandle].startTime)*3)/100);
-			start = cinTable[currentHandle].startTime;
+	if (cinTable[currentHandle].decoder) {
+		CIN_ShowDecodedFrames(thisTime);
+	} else {
+		while(  (cinTable[currentHandle].tfps != cinTable[currentHandle].numQuads)
+			&& (cinTable[currentHandle].status == FMV_PLAY) )
+		{
+			RoQInterrupt();
+			if (start != cinTable[currentHandle].startTime) {
+			  cinTable[currentHandle].tfps = ((((thisTime) - cinTable[currentHandle].startTime)*3)/100);
+				start = cinTable[currentHandle].startTime;
+			}
 		}
 	}
 
@@ -1454,7 +2209,11 @@ e_status CIN_RunCinematic (int handle)
 
 	if (cinTable[currentHandle].status == FMV_EOF) {
 	  if (cinTable[currentHandle].looping) {
-		RoQReset();
+		if (cinTable[currentHandle].decoder) {
+			CIN_RestartDecoder();
+		} else {
+			RoQReset();
+		}
 	  } else {
 		RoQShutdown();
 		return FMV_EOF;
@@ -1498,7 +2257,7 @@ int CIN_PlayCinematic( const char *arg, int x, int y, int w, int h, int systemBi
 		return -1;
 	}
 
-	Com_Memset(&cin[currentHandle], 0, sizeof(cinematics_t));
+	Com_Memset(&CIN_CURRENT, 0, sizeof(cinematics_t));
 
 	strcpy(cinTable[currentHandle].fileName, name);
 
@@ -1533,13 +2292,13 @@ int CIN_PlayCinematic( const char *arg, int x, int y, int w, int h, int systemBi
 
 	initRoQ();
 
-	FS_Read (cin[currentHandle].file, 16, cinTable[currentHandle].iFile);
+	FS_Read (CIN_CURRENT.file, 16, cinTable[currentHandle].iFile);
 
-	RoQID = (unsigned short)(cin[currentHandle].file[0]) + (unsigned short)(cin[currentHandle].file[1])*256;
+	RoQID = (unsigned short)(CIN_CURRENT.file[0]) + (unsigned short)(CIN_CURRENT.file[1])*256;
 	if (RoQID == 0x1084)
 	{
 		RoQ_init();
-//		FS_Read (cin[currentHandle].file, cinTable[currentHandle].RoQFrameSize+8, cinTable[currentHandle].iFile);
+//		FS_Read (CIN_CURRENT.file, cinTable[currentHandle].RoQFrameSize+8, cinTable[currentHandle].iFile);
 
 		cinTable[currentHandle].status = FMV_PLAY;
 		Com_DPrintf("trFMV::play(), playing %s\n", arg);
@@ -1556,29 +2315,14 @@ int CIN_PlayCinematic( const char *arg, int x, int y, int w, int h, int systemBi
 			s_rawend[0] = s_soundtime;
 		}
 
-		// test parse to get total quads
-		{
-			qboolean loopingOrig;
-
-			loopingOrig = cinTable[currentHandle].looping;
-			cinTable[currentHandle].looping = qfalse;  // to allow FMV_EOF status
-			cinTable[currentHandle].testParse = qtrue;
-			cinTable[currentHandle].totalQuads = 0;
-
-			// video can end with FMV_EOF or FMV_IDLE (holdAtEnd option)
-			while (cinTable[currentHandle].status == FMV_PLAY) {
-				// this is incrementing totalQuads
-				RoQInterrupt();
-			}
+		if (!cinTable[currentHandle].alterGameState && cl_cinematicThread->integer && CIN_StartDecoder()) {
+			return currentHandle;
+		}
 
-			RoQReset();
-			cinTable[currentHandle].testParse = qfalse;
-			cinTable[currentHandle].looping = loopingOrig;
-			cinTable[currentHandle].playCallStartTime = CL_ScaledMilliseconds();
-			cinTable[currentHandle].status = FMV_PLAY;
+		// test parse to get total quads
+		RoQTestParse();
+		//Com_Printf("^5cinematic total quads: %ld\n", cinTable[currentHandle].totalQuads);
 
-			//Com_Printf("^5cinematic total quads: %ld\n", cinTable[currentHandle].totalQuads);
-		}
 		return currentHandle;
 	}
 	Com_DPrintf("trFMV::play(), invalid RoQ ID\n");
@@ -1655,7 +2399,15 @@ void CIN_SeekCinematic (double offset)
 		// debugging
 		//startTimeOrig = cinTable[currentHandle].startTime;
 
-		if (wantQuadCount > currentQuads) {  // fast forward
+		if (cinTable[currentHandle].decoder) {
+			// the decode thread starts from the closest keyframe
+			if (wantQuadCount != currentQuads) {
+				if (Cvar_VariableIntegerValue("debug_seek")) {
+					Com_Printf("cinematic seek %ld -> %ld\n", cinTable[currentHandle].numQuads, wantQuadCount);
+				}
+				CIN_SeekDecoder(wantQuadCount);
+			}
+		} else if (wantQuadCount > currentQuads) {  // fast forward
 			if (Cvar_VariableIntegerValue("debug_seek")) {
 				Com_Printf("cinematic fast forward %ld -> %ld\n", cinTable[currentHandle].numQuads, wantQuadCount);
 			}
@@ -1709,6 +2461,12 @@ void CIN_SetExtents (int handle, int x, int y, int w, int h) {
 void CIN_SetLooping(int handle, qboolean loop) {
 	if (handle < 0 || handle>= MAX_VIDEO_HANDLES || cinTable[handle].status == FMV_EOF) return;
 	cinTable[handle].looping = loop;
+
+	if (cinTable[handle].decoder) {
+		Sys_LockMutex(cinTable[handle].decoder->mutex);
+		cinTable[handle].decoder->looping = loop;
+		Sys_UnlockMutex(cinTable[handle].decoder->mutex);
+	}
 }
 
 /*
@@ -1795,15 +2553,10 @@ void CIN_DrawCinematic (int handle) {
 	SCR_AdjustFrom640( &x, &y, &w, &h );
 
 	if (cinTable[handle].dirty && (cinTable[handle].CIN_WIDTH != cinTable[handle].drawX || cinTable[handle].CIN_HEIGHT != cinTable[handle].drawY)) {
-		int *buf2;
-
-		buf2 = Hunk_AllocateTempMemory( 256*256*4 );
+		CIN_ResampleCinematic(handle, cinResampleBuffer);
 
-		CIN_ResampleCinematic(handle, buf2);
-
-		re.DrawStretchRaw( x, y, w, h, 256, 256, (byte *)buf2, handle, qtrue);
+		re.DrawStretchRaw( x, y, w, h, 256, 256, (byte *)cinResampleBuffer, handle, qtrue);
 		cinTable[handle].dirty = qfalse;
-		Hunk_FreeTempMemory(buf2);
 		return;
 	}
 
@@ -1872,7 +2625,11 @@ void CL_RestartCinematic_f (void)
 		if (cinTable[i].fileName[0] != 0) {
 			currentHandle = i;
 			cinTable[currentHandle].playCallStartTime = CL_ScaledMilliseconds();
-			RoQReset();
+			if (cinTable[currentHandle].decoder) {
+				CIN_RestartDecoder();
+			} else {
+				RoQReset();
+			}
 		}
 	}
 
@@ -1932,15 +2689,10 @@ void CIN_UploadCinematic(int handle) {
 
 		// Resample the video if needed
 		if (cinTable[handle].dirty && (cinTable[handle].CIN_WIDTH != cinTable[handle].drawX || cinTable[handle].CIN_HEIGHT != cinTable[handle].drawY)) {
-			int *buf2;
-
-			buf2 = Hunk_AllocateTempMemory( 256*256*4 );
-
-			CIN_ResampleCinematic(handle, buf2);
+			CIN_ResampleCinematic(handle, cinResampleBuffer);
 
-			re.UploadCinematic( cinTable[handle].CIN_WIDTH, cinTable[handle].CIN_HEIGHT, 256, 256, (byte *)buf2, handle, qtrue);
+			re.UploadCinematic( cinTable[handle].CIN_WIDTH, cinTable[handle].CIN_HEIGHT, 256, 256, (byte *)cinResampleBuffer, handle, qtrue);
 			cinTable[handle].dirty = qfalse;
-			Hunk_FreeTempMemory(buf2);
 		} else {
 			// Upload video at normal resolution
 			re.UploadCinematic( cinTable[handle].CIN_WIDTH, cinTable[handle].CIN_HEIGHT, cinTable[handle].drawX, cinTable[handle].drawY,
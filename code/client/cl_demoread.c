@@ -0,0 +1,290 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// cl_demoread.c  -- reading the main demo file ahead of playback
+//
+// When the demo wasn't loaded in memory (cl_keepDemoFileInMemory) a thread
+// reads it in large blocks into a ring buffer ahead of the read position,
+// so reading a message doesn't wait on the disk.  Part of what was already
+// read is kept behind the read position: seeks that land in the buffered
+// range, like CL_PeekSnapshot() going back or a short rewind, only move the
+// read position.  Other seeks drop the buffer and the thread starts over at
+// the new position.
+//
+// Only the reading thread uses the FILE while it runs.  Without a thread
+// these go straight to the file system.
+
+#include "client.h"
+
+#define DEMO_READ_BLOCK_SIZE (256 * 1024)
+#define MAX_DEMO_READ_AHEAD_MB 256
+
+typedef struct {
+	fileHandle_t f;
+	FILE *file;
+	byte *buffer;
+	int size;
+	int keepBehind;  // bytes kept before pos for seeking back
+
+	// file offsets, [start, end) is buffered at buffer[offset % size]
+	int start;
+	int end;
+	int pos;  // only changed by the main thread
+	int generation;  // changed when the main thread drops the buffer
+	qboolean needSeek;  // the thread's FILE position isn't end
+	qboolean eof;
+	qboolean quit;
+
+	sysThread_t *thread;
+	sysMutex_t *mutex;
+	sysCond_t *cond;  // data read, data consumed, seek or quit
+} demoReader_t;
+
+static demoReader_t demoReader;
+
+static void CL_DemoReadThread (void *arg)
+{
+	demoReader_t *r;
+	int generation;
+	int offset;
+	int len;
+	int n;
+	qboolean seek;
+
+	r = (demoReader_t *)arg;
+
+	Sys_LockMutex(r->mutex);
+	while (!r->quit) {
+		if (r->pos - r->keepBehind > r->start) {
+			r->start = r->pos - r->keepBehind;
+		}
+
+		if (r->eof  ||  r->end - r->start >= r->size) {
+			Sys_CondWait(r->cond, r->mutex);
+			continue;
+		}
+
+		generation = r->generation;
+		seek = r->needSeek;
+		r->needSeek = qfalse;
+		offset = r->end;
+
+		// [end, start + size) isn't visible to the main thread, so it can
+		// be filled without holding the lock
+		len = r->size - (r->end - r->start);
+		if (len > r->size - offset % r->size) {
+			len = r->size - offset % r->size;
+		}
+		if (len > DEMO_READ_BLOCK_SIZE) {
+			len = DEMO_READ_BLOCK_SIZE;
+		}
+		Sys_UnlockMutex(r->mutex);
+
+		n = 0;
+		if (!seek  ||  fseek(r->file, offset, SEEK_SET) == 0) {
+			n = (int)fread(r->buffer + offset % r->size, 1, len, r->file);
+		}
+
+		Sys_LockMutex(r->mutex);
+		if (generation == r->generation) {
+			r->end += n;
+			if (n < len) {
+				r->eof = qtrue;
+			}
+			Sys_CondBroadcast(r->cond);
+		}
+		// else dropped, needSeek was set again
+	}
+	Sys_UnlockMutex(r->mutex);
+}
+
+/*
+==================
+CL_DemoReadStart
+
+Called with the main demo file just opened, before anything is read.
+==================
+*/
+void CL_DemoReadStart (fileHandle_t f)
+{
+	demoReader_t *r;
+	FILE *file;
+	int mb;
+
+	r = &demoReader;
+
+	CL_DemoReadStop();
+
+	mb = cl_demoReadAhead->integer;
+	if (mb <= 0) {
+		return;
+	}
+	if (mb > MAX_DEMO_READ_AHEAD_MB) {
+		mb = MAX_DEMO_READ_AHEAD_MB;
+	}
+
+	file = FS_StdioFileForHandle(f);
+	if (!file) {
+		return;
+	}
+
+	r->size = mb * 1024 * 1024;
+	r->buffer = (byte *)malloc(r->size);
+	if (!r->buffer) {
+		Com_Printf("^3%s couldn't allocate %d MB read ahead buffer\n", __FUNCTION__, mb);
+		Com_Memset(r, 0, sizeof(*r));
+		return;
+	}
+
+	r->f = f;
+	r->file = file;
+	r->keepBehind = r->size / 4;
+	r->start = r->end = r->pos = FS_FTell(f);
+	r->needSeek = qtrue;
+	r->mutex = Sys_CreateMutex();
+	r->cond = Sys_CreateCond();
+
+	r->thread = Sys_CreateThread(CL_DemoReadThread, r);
+	if (!r->thread) {
+		Sys_DestroyCond(r->cond);
+		Sys_DestroyMutex(r->mutex);
+		free(r->buffer);
+		Com_Memset(r, 0, sizeof(*r));
+	}
+}
+
+/*
+==================
+CL_DemoReadStop
+
+Leaves the file at the read position, must be called before the demo file
+is closed.
+==================
+*/
+void CL_DemoReadStop (void)
+{
+	demoReader_t *r;
+
+	r = &demoReader;
+
+	if (!r->thread) {
+		return;
+	}
+
+	Sys_LockMutex(r->mutex);
+	r->quit = qtrue;
+	Sys_CondBroadcast(r->cond);
+	Sys_UnlockMutex(r->mutex);
+
+	Sys_JoinThread(r->thread);
+	Sys_DestroyCond(r->cond);
+	Sys_DestroyMutex(r->mutex);
+
+	FS_Seek(r->f, r->pos, FS_SEEK_SET);
+
+	free(r->buffer);
+	Com_Memset(r, 0, sizeof(*r));
+}
+
+// FS_Read() on clc.demoReadFile
+int CL_DemoRead (void *buffer, int len)
+{
+	demoReader_t *r;
+	int done;
+	int avail;
+	int offset;
+	int n;
+
+	r = &demoReader;
+
+	if (!r->thread) {
+		return FS_Read(buffer, len, clc.demoReadFile);
+	}
+
+	done = 0;
+	Sys_LockMutex(r->mutex);
+	while (done < len) {
+		avail = r->end - r->pos;
+		if (avail <= 0) {
+			if (r->eof) {
+				break;
+			}
+			Sys_CondWait(r->cond, r->mutex);
+			continue;
+		}
+
+		n = len - done;
+		if (n > avail) {
+			n = avail;
+		}
+		offset = r->pos % r->size;
+		if (n > r->size - offset) {
+			n = r->size - offset;
+		}
+
+		Com_Memcpy((byte *)buffer + done, r->buffer + offset, n);
+		r->pos += n;
+		done += n;
+
+		if (r->end - r->start >= r->size) {
+			// the thread might be waiting for room
+			Sys_CondBroadcast(r->cond);
+		}
+	}
+	Sys_UnlockMutex(r->mutex);
+
+	return done;
+}
+
+// FS_FTell() on clc.demoReadFile
+int CL_DemoTell (void)
+{
+	if (!demoReader.thread) {
+		return FS_FTell(clc.demoReadFile);
+	}
+
+	return demoReader.pos;
+}
+
+// FS_Seek() from the start of clc.demoReadFile
+void CL_DemoSeek (int offset)
+{
+	demoReader_t *r;
+
+	r = &demoReader;
+
+	if (!r->thread) {
+		FS_Seek(clc.demoReadFile, offset, FS_SEEK_SET);
+		return;
+	}
+
+	Sys_LockMutex(r->mutex);
+	if (offset < r->start  ||  offset > r->end) {
+		r->start = offset;
+		r->end = offset;
+		r->generation++;
+		r->needSeek = qtrue;
+		r->eof = qfalse;
+	}
+	r->pos = offset;
+	Sys_CondBroadcast(r->cond);
+	Sys_UnlockMutex(r->mutex);
+}
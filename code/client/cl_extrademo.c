@@ -0,0 +1,967 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// cl_extrademo.c  -- decoding of the extra demo files given to 'demo'
+//
+// Each extra demo keeps its own delta state (snapshots, parse entities and
+// baselines) and is decoded ahead into a small queue of snapshots, on a
+// worker thread if cl_demoExtraThreads is set.  The main thread only merges
+// the queued snapshot matching the main demo's server time into
+// cl.snapshots[df->num][] and cl.parseEntities[].
+//
+// The worker thread doesn't go through the file system, it reads the
+// file's memory copy (cl_keepDemoFileInMemory) or its FILE.  Demos in pk3
+// files are decoded on the main thread.
+
+#include "client.h"
+
+// decoded snapshots kept ahead of the main demo
+#define EXTRA_DEMO_QUEUE_SIZE 8
+
+typedef struct {
+	clSnapshot_t snap;  // parseEntitiesNum isn't used, entities are below
+	entityState_t entities[MAX_SNAPSHOT_ENTITIES];
+	int serverMessageSequence;
+} extraDemoFrame_t;
+
+struct extraDemoStream_s {
+	fileHandle_t f;
+	int num;
+
+	// see CL_ExtraDemoRead(), only one of them is set
+	const byte *data;
+	int dataSize;
+	int dataPos;
+	FILE *file;
+
+	// decoder state, only used by the decoding thread or, if there isn't
+	// one running, the main thread
+	clSnapshot_t snapshots[PACKET_BACKUP];
+	entityState_t parseEntities[MAX_PARSE_ENTITIES];
+	int parseEntitiesNum;
+	entityState_t entityBaselines[MAX_GENTITIES];
+	int serverMessageSequence;
+	int lastMessageNum;
+	byte msgData[MAX_MSGLEN];
+
+	// queue, producer writes frames[(head + count) % size] without holding
+	// the lock and the consumer reads frames[head] the same way
+	extraDemoFrame_t frames[EXTRA_DEMO_QUEUE_SIZE];
+	int head;
+	int count;
+	qboolean done;
+	qboolean quit;
+	qboolean decoding;  // the thread is in CL_ExtraDemoReadMessage()
+	char message[MAX_STRING_CHARS];  // printed by the main thread
+
+	sysThread_t *thread;
+	sysMutex_t *mutex;
+	sysCond_t *cond;
+};
+
+static void CL_ExtraDemoSetMessage (extraDemoStream_t *s, const char *fmt, ...) __attribute__ ((format (printf, 2, 3)));
+
+static void CL_ExtraDemoSetMessage (extraDemoStream_t *s, const char *fmt, ...)
+{
+	va_list argptr;
+
+	va_start(argptr, fmt);
+	Q_vsnprintf(s->message, sizeof(s->message), fmt, argptr);
+	va_end(argptr);
+}
+
+static void CL_ExtraDemoSkipString (msg_t *msg, int maxLength)
+{
+	int l, c;
+
+	// same length handling as MSG_ReadString(), which uses a static buffer
+	l = 0;
+	do {
+		c = MSG_ReadByte(msg);
+		if (c == -1  ||  c == 0) {
+			break;
+		}
+		l++;
+	} while (l < maxLength - 1);
+}
+
+static void CL_ExtraDemoDeltaEntity (extraDemoStream_t *s, msg_t *msg, clSnapshot_t *frame, int newnum, entityState_t *old, qboolean unchanged)
+{
+	entityState_t *state;
+
+	state = &s->parseEntities[s->parseEntitiesNum & (MAX_PARSE_ENTITIES - 1)];
+
+	if (unchanged) {
+		*state = *old;
+	} else {
+		MSG_ReadDeltaEntity(msg, old, state, newnum);
+	}
+
+	if (state->number == (MAX_GENTITIES - 1)) {
+		return;  // entity was delta removed
+	}
+
+	s->parseEntitiesNum++;
+	frame->numEntities++;
+}
+
+static entityState_t *CL_ExtraDemoOldEntity (extraDemoStream_t *s, const clSnapshot_t *oldframe, int oldindex, int *oldnum)
+{
+	entityState_t *oldstate;
+
+	if (!oldframe  ||  oldindex >= oldframe->numEntities) {
+		*oldnum = 99999;
+		return NULL;
+	}
+
+	oldstate = &s->parseEntities[(oldframe->parseEntitiesNum + oldindex) & (MAX_PARSE_ENTITIES - 1)];
+	*oldnum = oldstate->number;
+
+	return oldstate;
+}
+
+// CL_ParsePacketEntities() using the stream's parse entities and baselines
+static qboolean CL_ExtraDemoParsePacketEntities (extraDemoStream_t *s, msg_t *msg, const clSnapshot_t *oldframe, clSnapshot_t *newframe)
+{
+	int newnum;
+	entityState_t *oldstate;
+	int oldindex, oldnum;
+
+	newframe->parseEntitiesNum = s->parseEntitiesNum;
+	newframe->numEntities = 0;
+
+	oldindex = 0;
+	oldstate = CL_ExtraDemoOldEntity(s, oldframe, oldindex, &oldnum);
+
+	while (1) {
+		newnum = MSG_ReadBits(msg, GENTITYNUM_BITS);
+
+		if (newnum == (MAX_GENTITIES - 1)) {
+			break;
+		}
+
+		if (msg->readcount > msg->cursize  ||  msg->overflowed) {
+			CL_ExtraDemoSetMessage(s, "^1demoFile %d packet entities: end of message: %d > %d  entity: %d\n", s->f, msg->readcount, msg->cursize, newnum);
+			return qfalse;
+		}
+
+		while (oldnum < newnum) {
+			// one or more entities from the old packet are unchanged
+			CL_ExtraDemoDeltaEntity(s, msg, newframe, oldnum, oldstate, qtrue);
+			oldindex++;
+			oldstate = CL_ExtraDemoOldEntity(s, oldframe, oldindex, &oldnum);
+		}
+
+		if (oldnum == newnum) {
+			// delta from previous state
+			CL_ExtraDemoDeltaEntity(s, msg, newframe, newnum, oldstate, qfalse);
+			oldindex++;
+			oldstate = CL_ExtraDemoOldEntity(s, oldframe, oldindex, &oldnum);
+			continue;
+		}
+
+		if (oldnum > newnum) {
+			// delta from baseline
+			CL_ExtraDemoDeltaEntity(s, msg, newframe, newnum, &s->entityBaselines[newnum], qfalse);
+			continue;
+		}
+	}
+
+	// any remaining entities in the old frame are copied over
+	while (oldnum != 99999) {
+		CL_ExtraDemoDeltaEntity(s, msg, newframe, oldnum, oldstate, qtrue);
+		oldindex++;
+		oldstate = CL_ExtraDemoOldEntity(s, oldframe, oldindex, &oldnum);
+	}
+
+	return !msg->overflowed;
+}
+
+/*
+==================
+CL_ExtraDemoParseSnapshot
+
+Parses into the free queue slot, returns qtrue if a valid snapshot was
+added to the stream's delta history and should be queued.
+==================
+*/
+static qboolean CL_ExtraDemoParseSnapshot (extraDemoStream_t *s, msg_t *msg, extraDemoFrame_t *frame)
+{
+	int len;
+	clSnapshot_t *old;
+	clSnapshot_t newSnap;
+	int deltaNum;
+	int oldMessageNum;
+	int i;
+
+	Com_Memset(&newSnap, 0, sizeof(newSnap));
+
+	newSnap.serverTime = MSG_ReadLong(msg);
+	newSnap.messageNum = s->serverMessageSequence;
+
+	deltaNum = MSG_ReadByte(msg);
+	if (!deltaNum) {
+		newSnap.deltaNum = -1;
+	} else {
+		newSnap.deltaNum = newSnap.messageNum - deltaNum;
+	}
+	newSnap.snapFlags = MSG_ReadByte(msg);
+
+	if (newSnap.deltaNum <= 0) {
+		newSnap.valid = qtrue;  // uncompressed frame
+		old = NULL;
+	} else {
+		old = &s->snapshots[newSnap.deltaNum & PACKET_MASK];
+		if (!old->valid) {
+			newSnap.valid = qfalse;
+		} else if (old->messageNum != newSnap.deltaNum) {
+			// delta frame is too old, could be a demo recorded with
+			// dropped packets
+			newSnap.valid = qfalse;
+		} else if (s->parseEntitiesNum - old->parseEntitiesNum > MAX_PARSE_ENTITIES - MAX_SNAPSHOT_ENTITIES) {
+			newSnap.valid = qfalse;
+		} else {
+			newSnap.valid = qtrue;
+		}
+	}
+
+	len = MSG_ReadByte(msg);
+	if (len > sizeof(newSnap.areamask)) {
+		CL_ExtraDemoSetMessage(s, "^1demoFile %d invalid size %d for areamask\n", s->f, len);
+		return qfalse;
+	}
+	MSG_ReadData(msg, &newSnap.areamask, len);
+
+	if (old) {
+		MSG_ReadDeltaPlayerstate(msg, &old->ps, &newSnap.ps);
+	} else {
+		MSG_ReadDeltaPlayerstate(msg, NULL, &newSnap.ps);
+	}
+
+	if (!CL_ExtraDemoParsePacketEntities(s, msg, old, &newSnap)) {
+		return qfalse;
+	}
+
+	if (!newSnap.valid) {
+		return qfalse;
+	}
+
+	// clear the valid flags of any snapshots between the last
+	// received and this one
+	oldMessageNum = s->lastMessageNum + 1;
+	if (newSnap.messageNum - oldMessageNum >= PACKET_BACKUP) {
+		oldMessageNum = newSnap.messageNum - (PACKET_BACKUP - 1);
+	}
+	for ( ;  oldMessageNum < newSnap.messageNum;  oldMessageNum++) {
+		s->snapshots[oldMessageNum & PACKET_MASK].valid = qfalse;
+	}
+
+	s->lastMessageNum = newSnap.messageNum;
+	s->snapshots[newSnap.messageNum & PACKET_MASK] = newSnap;
+
+	frame->snap = newSnap;
+	frame->serverMessageSequence = s->serverMessageSequence;
+	if (frame->snap.numEntities > MAX_SNAPSHOT_ENTITIES) {
+		frame->snap.numEntities = MAX_SNAPSHOT_ENTITIES;
+	}
+	for (i = 0;  i < frame->snap.numEntities;  i++) {
+		frame->entities[i] = s->parseEntities[(newSnap.parseEntitiesNum + i) & (MAX_PARSE_ENTITIES - 1)];
+	}
+
+	return qtrue;
+}
+
+static qboolean CL_ExtraDemoParseGamestate (extraDemoStream_t *s, msg_t *msg)
+{
+	int cmd;
+	int i;
+	int newnum;
+	entityState_t nullstate;
+
+	// server command sequence
+	MSG_ReadLong(msg);
+
+	Com_Memset(&nullstate, 0, sizeof(nullstate));
+	Com_Memset(s->entityBaselines, 0, sizeof(s->entityBaselines));
+
+	while (1) {
+		cmd = MSG_ReadByte(msg);
+
+		if (cmd == svc_EOF) {
+			break;
+		}
+
+		if (cmd == svc_configstring) {
+			i = MSG_ReadShort(msg);
+			if (i < 0  ||  i >= MAX_CONFIGSTRINGS) {
+				CL_ExtraDemoSetMessage(s, "^1demoFile %d gamestate configstring(%d) > MAX_CONFIGSTRINGS(%d)\n", s->f, i, MAX_CONFIGSTRINGS);
+				return qfalse;
+			}
+			CL_ExtraDemoSkipString(msg, BIG_INFO_STRING);
+		} else if (cmd == svc_baseline) {
+			newnum = MSG_ReadBits(msg, GENTITYNUM_BITS);
+			if (newnum < 0  ||  newnum >= MAX_GENTITIES) {
+				CL_ExtraDemoSetMessage(s, "^1demoFile %d gamestate baseline number out of range: %d\n", s->f, newnum);
+				return qfalse;
+			}
+			MSG_ReadDeltaEntity(msg, &nullstate, &s->entityBaselines[newnum], newnum);
+		} else {
+			CL_ExtraDemoSetMessage(s, "^1demoFile %d gamestate bad command byte %d\n", s->f, cmd);
+			return qfalse;
+		}
+
+		if (msg->overflowed) {
+			CL_ExtraDemoSetMessage(s, "^1demoFile %d gamestate read error\n", s->f);
+			return qfalse;
+		}
+	}
+
+	// client num and checksum feed
+	MSG_ReadLong(msg);
+	MSG_ReadLong(msg);
+
+	return qtrue;
+}
+
+/*
+==================
+CL_ExtraDemoParseMessage
+
+Returns qtrue if a snapshot was decoded into frame.
+==================
+*/
+static qboolean CL_ExtraDemoParseMessage (extraDemoStream_t *s, msg_t *msg, extraDemoFrame_t *frame)
+{
+	int cmd;
+	qboolean gotSnapshot;
+
+	gotSnapshot = qfalse;
+
+	MSG_Bitstream(msg);
+
+	// reliable sequence acknowledge
+	MSG_ReadLong(msg);
+
+	while (1) {
+		if (msg->readcount > msg->cursize) {
+			CL_ExtraDemoSetMessage(s, "^1demoFile %d read past end of server message\n", s->f);
+			break;
+		}
+
+		cmd = MSG_ReadByte(msg);
+
+		if ((cmd == svc_EOF)  &&  (MSG_LookaheadByte(msg) == svc_extension)) {
+			MSG_ReadByte(msg);  // throw the svc_extension byte away.
+			cmd = MSG_ReadByte(msg);
+			if (cmd == -1) {
+				cmd = svc_EOF;
+			}
+		}
+
+		if (cmd == svc_EOF) {
+			break;
+		}
+
+		switch (cmd) {
+		default:
+			CL_ExtraDemoSetMessage(s, "^1demoFile %d illegible server message %d\n", s->f, cmd);
+			return gotSnapshot;
+		case svc_nop:
+			break;
+		case svc_serverCommand:
+			MSG_ReadLong(msg);
+			CL_ExtraDemoSkipString(msg, MAX_STRING_CHARS);
+			break;
+		case svc_gamestate:
+			if (!CL_ExtraDemoParseGamestate(s, msg)) {
+				return gotSnapshot;
+			}
+			break;
+		case svc_snapshot:
+			gotSnapshot = CL_ExtraDemoParseSnapshot(s, msg, frame);
+			break;
+		case svc_download:
+		case svc_extension:
+		case svc_voip:
+			// not used, and the rest of the message can't be parsed
+			// without reading them
+			return gotSnapshot;
+		}
+	}
+
+	return gotSnapshot;
+}
+
+/*
+==================
+CL_ExtraDemoRead
+
+FS_Read() isn't thread safe.  Without data or file the demo is in a pk3
+and is only read on the main thread.
+==================
+*/
+static int CL_ExtraDemoRead (extraDemoStream_t *s, void *buffer, int len)
+{
+	if (s->data) {
+		if (len > s->dataSize - s->dataPos) {
+			len = s->dataSize - s->dataPos;
+		}
+		if (len <= 0) {
+			return 0;
+		}
+		Com_Memcpy(buffer, s->data + s->dataPos, len);
+		s->dataPos += len;
+		return len;
+	}
+
+	if (s->file) {
+		return (int)fread(buffer, 1, len, s->file);
+	}
+
+	return FS_Read(buffer, len, s->f);
+}
+
+// only with the decoding thread stopped
+static void CL_ExtraDemoSetPosition (extraDemoStream_t *s, int offset)
+{
+	if (s->data) {
+		s->dataPos = offset;
+	} else if (s->file) {
+		fseek(s->file, offset, SEEK_SET);
+	} else {
+		FS_Seek(s->f, offset, FS_SEEK_SET);
+	}
+}
+
+/*
+==================
+CL_ExtraDemoReadMessage
+
+Reads and decodes the next message of the demo file, returns qfalse when
+the demo is done.
+==================
+*/
+static qboolean CL_ExtraDemoReadMessage (extraDemoStream_t *s, extraDemoFrame_t *frame, qboolean *gotSnapshot)
+{
+	int r;
+	int seq;
+	msg_t buf;
+
+	*gotSnapshot = qfalse;
+
+	r = CL_ExtraDemoRead(s, &seq, 4);
+	if (r != 4) {
+		CL_ExtraDemoSetMessage(s, "demoFile %d ended\n", s->f);
+		return qfalse;
+	}
+	s->serverMessageSequence = LittleLong(seq);
+
+	MSG_Init(&buf, s->msgData, sizeof(s->msgData));
+	// read errors mark the message as overflowed instead of Com_Error()
+	buf.allowoverflow = qtrue;
+
+	r = CL_ExtraDemoRead(s, &buf.cursize, 4);
+	if (r != 4) {
+		CL_ExtraDemoSetMessage(s, "demoFile %d truncated\n", s->f);
+		return qfalse;
+	}
+	buf.cursize = LittleLong(buf.cursize);
+
+	if (buf.cursize == -1) {
+		CL_ExtraDemoSetMessage(s, "demoFile %d done\n", s->f);
+		return qfalse;
+	}
+
+	if (buf.cursize < 0  ||  buf.cursize > buf.maxsize) {
+		CL_ExtraDemoSetMessage(s, "^1demoFile %d demoMsglen (%d) > MAX_MSGLEN (%d)\n", s->f, buf.cursize, buf.maxsize);
+		return qfalse;
+	}
+
+	r = CL_ExtraDemoRead(s, buf.data, buf.cursize);
+	if (r != buf.cursize) {
+		CL_ExtraDemoSetMessage(s, "demo file %d was truncated(2)\n", s->f);
+		return qfalse;
+	}
+
+	buf.readcount = 0;
+	*gotSnapshot = CL_ExtraDemoParseMessage(s, &buf, frame);
+
+	return qtrue;
+}
+
+static void CL_ExtraDemoThread (void *arg)
+{
+	extraDemoStream_t *s;
+	extraDemoFrame_t *frame;
+	qboolean gotSnapshot;
+	qboolean more;
+
+	s = (extraDemoStream_t *)arg;
+
+	while (1) {
+		Sys_LockMutex(s->mutex);
+		while (s->count >= EXTRA_DEMO_QUEUE_SIZE  &&  !s->quit) {
+			Sys_CondWait(s->cond, s->mutex);
+		}
+		if (s->quit) {
+			Sys_UnlockMutex(s->mutex);
+			break;
+		}
+		frame = &s->frames[(s->head + s->count) % EXTRA_DEMO_QUEUE_SIZE];
+		s->decoding = qtrue;
+		Sys_UnlockMutex(s->mutex);
+
+		more = CL_ExtraDemoReadMessage(s, frame, &gotSnapshot);
+
+		Sys_LockMutex(s->mutex);
+		s->decoding = qfalse;
+		if (gotSnapshot) {
+			s->count++;
+		}
+		if (!more) {
+			s->done = qtrue;
+		}
+		Sys_CondBroadcast(s->cond);
+		Sys_UnlockMutex(s->mutex);
+
+		if (!more) {
+			break;
+		}
+	}
+}
+
+static void CL_ExtraDemoStopThread (extraDemoStream_t *s)
+{
+	if (!s->thread) {
+		return;
+	}
+
+	Sys_LockMutex(s->mutex);
+	s->quit = qtrue;
+	Sys_CondBroadcast(s->cond);
+	Sys_UnlockMutex(s->mutex);
+
+	Sys_JoinThread(s->thread);
+	s->thread = NULL;
+	s->quit = qfalse;
+}
+
+static void CL_ExtraDemoReset (extraDemoStream_t *s)
+{
+	Com_Memset(s->snapshots, 0, sizeof(s->snapshots));
+	s->parseEntitiesNum = 0;
+	s->serverMessageSequence = 0;
+	s->lastMessageNum = 0;
+	s->head = 0;
+	s->count = 0;
+	s->done = qfalse;
+	s->message[0] = '\0';
+}
+
+void CL_ExtraDemoOpen (demoFile_t *df)
+{
+	extraDemoStream_t *s;
+
+	s = (extraDemoStream_t *)calloc(1, sizeof(extraDemoStream_t));
+	if (!s) {
+		Com_Printf("^1%s couldn't allocate memory for demoFile %d\n", __FUNCTION__, df->f);
+		df->valid = qfalse;
+		return;
+	}
+
+	s->f = df->f;
+	s->num = df->num;
+	s->data = FS_FileMemoryData(df->f, &s->dataSize);
+	if (s->data) {
+		s->dataPos = FS_FTell(df->f);
+	} else {
+		s->file = FS_StdioFileForHandle(df->f);
+	}
+	s->mutex = Sys_CreateMutex();
+	s->cond = Sys_CreateCond();
+
+	df->stream = s;
+}
+
+void CL_ExtraDemoClose (demoFile_t *df)
+{
+	extraDemoStream_t *s;
+
+	s = df->stream;
+	if (!s) {
+		return;
+	}
+
+	CL_ExtraDemoStopThread(s);
+	Sys_DestroyCond(s->cond);
+	Sys_DestroyMutex(s->mutex);
+	free(s);
+
+	df->stream = NULL;
+}
+
+/*
+==================
+CL_ExtraDemoSeek
+
+Restarts decoding from the beginning, the merge skips ahead.  Used when a
+rewind backup doesn't have the stream's state.
+==================
+*/
+void CL_ExtraDemoSeek (demoFile_t *df)
+{
+	extraDemoStream_t *s;
+
+	s = df->stream;
+	if (!s) {
+		return;
+	}
+
+	CL_ExtraDemoStopThread(s);
+	CL_ExtraDemoReset(s);
+	CL_ExtraDemoSetPosition(s, 0);
+	df->serverTime = 0;
+}
+
+// CL_ExtraDemoSaveState() output
+static byte *extraDemoState;
+static int extraDemoStateSize;
+static int extraDemoStateUsed;
+
+static void CL_ExtraDemoStateWrite (const void *data, int size)
+{
+	if (extraDemoStateUsed + size > extraDemoStateSize) {
+		while (extraDemoStateUsed + size > extraDemoStateSize) {
+			extraDemoStateSize = extraDemoStateSize ? extraDemoStateSize * 2 : 512 * 1024;
+		}
+		extraDemoState = realloc(extraDemoState, extraDemoStateSize);
+		if (!extraDemoState) {
+			Com_Error(ERR_FATAL, "%s couldn't allocate %d bytes", __FUNCTION__, extraDemoStateSize);
+		}
+	}
+
+	Com_Memcpy(extraDemoState + extraDemoStateUsed, data, size);
+	extraDemoStateUsed += size;
+}
+
+static qboolean CL_ExtraDemoStateRead (const byte **data, const byte *end, void *out, int size)
+{
+	if (size < 0  ||  end - *data < size) {
+		return qfalse;
+	}
+
+	Com_Memcpy(out, *data, size);
+	*data += size;
+
+	return qtrue;
+}
+
+// where the decoder is in the file, only with the decoding thread stopped
+// or parked, see CL_ExtraDemoSaveState()
+static int CL_ExtraDemoPosition (extraDemoStream_t *s)
+{
+	if (s->data) {
+		return s->dataPos;
+	} else if (s->file) {
+		return (int)ftell(s->file);
+	}
+
+	return FS_FTell(s->f);
+}
+
+/*
+==================
+CL_ExtraDemoSaveState
+
+For rewind backups: where the stream is in the file, its delta state and
+the snapshots it has queued.  The decoding thread keeps running, the
+stream lock is held while the state is copied and the thread is waited
+for if it's in the middle of a message.  Returns a buffer that's valid
+until the next call.
+==================
+*/
+const void *CL_ExtraDemoSaveState (demoFile_t *df, int *size)
+{
+	extraDemoStream_t *s;
+	const extraDemoFrame_t *frame;
+	int position;
+	int first;
+	int i, n;
+
+	*size = 0;
+
+	s = df->stream;
+	if (!s) {
+		return NULL;
+	}
+
+	if (s->thread) {
+		// park the thread between two messages
+		Sys_LockMutex(s->mutex);
+		while (s->decoding) {
+			Sys_CondWait(s->cond, s->mutex);
+		}
+	}
+
+	extraDemoStateUsed = 0;
+
+	position = CL_ExtraDemoPosition(s);
+	CL_ExtraDemoStateWrite(&position, sizeof(position));
+	CL_ExtraDemoStateWrite(&s->done, sizeof(s->done));
+	CL_ExtraDemoStateWrite(&df->serverTime, sizeof(df->serverTime));
+	CL_ExtraDemoStateWrite(&df->serverMessageSequence, sizeof(df->serverMessageSequence));
+	CL_ExtraDemoStateWrite(&df->snap, sizeof(df->snap));
+
+	CL_ExtraDemoStateWrite(&s->serverMessageSequence, sizeof(s->serverMessageSequence));
+	CL_ExtraDemoStateWrite(&s->lastMessageNum, sizeof(s->lastMessageNum));
+	CL_ExtraDemoStateWrite(&s->parseEntitiesNum, sizeof(s->parseEntitiesNum));
+	CL_ExtraDemoStateWrite(s->snapshots, sizeof(s->snapshots));
+	CL_ExtraDemoStateWrite(s->entityBaselines, sizeof(s->entityBaselines));
+
+	// parse entities still used by a valid snapshot
+	first = s->parseEntitiesNum;
+	for (i = 0;  i < PACKET_BACKUP;  i++) {
+		if (s->snapshots[i].valid  &&  s->snapshots[i].parseEntitiesNum < first) {
+			first = s->snapshots[i].parseEntitiesNum;
+		}
+	}
+	if (first < s->parseEntitiesNum - MAX_PARSE_ENTITIES) {
+		first = s->parseEntitiesNum - MAX_PARSE_ENTITIES;
+	}
+	CL_ExtraDemoStateWrite(&first, sizeof(first));
+	for (i = first;  i < s->parseEntitiesNum;  i += n) {
+		n = MAX_PARSE_ENTITIES - (i & (MAX_PARSE_ENTITIES - 1));
+		if (n > s->parseEntitiesNum - i) {
+			n = s->parseEntitiesNum - i;
+		}
+		CL_ExtraDemoStateWrite(&s->parseEntities[i & (MAX_PARSE_ENTITIES - 1)], n * sizeof(entityState_t));
+	}
+
+	CL_ExtraDemoStateWrite(&s->count, sizeof(s->count));
+	for (i = 0;  i < s->count;  i++) {
+		frame = &s->frames[(s->head + i) % EXTRA_DEMO_QUEUE_SIZE];
+		CL_ExtraDemoStateWrite(&frame->snap, sizeof(frame->snap));
+		CL_ExtraDemoStateWrite(&frame->serverMessageSequence, sizeof(frame->serverMessageSequence));
+		CL_ExtraDemoStateWrite(frame->entities, frame->snap.numEntities * sizeof(entityState_t));
+	}
+
+	if (s->thread) {
+		Sys_UnlockMutex(s->mutex);
+	}
+
+	*size = extraDemoStateUsed;
+	return extraDemoState;
+}
+
+/*
+==================
+CL_ExtraDemoRestoreState
+
+Puts back what CL_ExtraDemoSaveState() saved.  If it can't be read the
+stream starts over from the beginning instead and qfalse is returned.
+==================
+*/
+qboolean CL_ExtraDemoRestoreState (demoFile_t *df, const void *data, int size)
+{
+	extraDemoStream_t *s;
+	extraDemoFrame_t *frame;
+	const byte *p, *end;
+	int position;
+	int first;
+	int i, n;
+
+	s = df->stream;
+	if (!s) {
+		return qfalse;
+	}
+
+	CL_ExtraDemoStopThread(s);
+	CL_ExtraDemoReset(s);
+
+	p = (const byte *)data;
+	end = p + size;
+
+	if (!CL_ExtraDemoStateRead(&p, end, &position, sizeof(position))
+		||  !CL_ExtraDemoStateRead(&p, end, &s->done, sizeof(s->done))
+		||  !CL_ExtraDemoStateRead(&p, end, &df->serverTime, sizeof(df->serverTime))
+		||  !CL_ExtraDemoStateRead(&p, end, &df->serverMessageSequence, sizeof(df->serverMessageSequence))
+		||  !CL_ExtraDemoStateRead(&p, end, &df->snap, sizeof(df->snap))
+		||  !CL_ExtraDemoStateRead(&p, end, &s->serverMessageSequence, sizeof(s->serverMessageSequence))
+		||  !CL_ExtraDemoStateRead(&p, end, &s->lastMessageNum, sizeof(s->lastMessageNum))
+		||  !CL_ExtraDemoStateRead(&p, end, &s->parseEntitiesNum, sizeof(s->parseEntitiesNum))
+		||  !CL_ExtraDemoStateRead(&p, end, s->snapshots, sizeof(s->snapshots))
+		||  !CL_ExtraDemoStateRead(&p, end, s->entityBaselines, sizeof(s->entityBaselines))
+		||  !CL_ExtraDemoStateRead(&p, end, &first, sizeof(first))) {
+		goto bad;
+	}
+
+	if (first > s->parseEntitiesNum  ||  first < s->parseEntitiesNum - MAX_PARSE_ENTITIES) {
+		goto bad;
+	}
+	for (i = first;  i < s->parseEntitiesNum;  i += n) {
+		n = MAX_PARSE_ENTITIES - (i & (MAX_PARSE_ENTITIES - 1));
+		if (n > s->parseEntitiesNum - i) {
+			n = s->parseEntitiesNum - i;
+		}
+		if (!CL_ExtraDemoStateRead(&p, end, &s->parseEntities[i & (MAX_PARSE_ENTITIES - 1)], n * sizeof(entityState_t))) {
+			goto bad;
+		}
+	}
+
+	if (!CL_ExtraDemoStateRead(&p, end, &n, sizeof(n))  ||  n < 0  ||  n > EXTRA_DEMO_QUEUE_SIZE) {
+		goto bad;
+	}
+	for (i = 0;  i < n;  i++) {
+		frame = &s->frames[i];
+		if (!CL_ExtraDemoStateRead(&p, end, &frame->snap, sizeof(frame->snap))
+			||  !CL_ExtraDemoStateRead(&p, end, &frame->serverMessageSequence, sizeof(frame->serverMessageSequence))
+			||  frame->snap.numEntities < 0  ||  frame->snap.numEntities > MAX_SNAPSHOT_ENTITIES
+			||  !CL_ExtraDemoStateRead(&p, end, frame->entities, frame->snap.numEntities * sizeof(entityState_t))) {
+			goto bad;
+		}
+	}
+	s->head = 0;
+	s->count = n;
+
+	CL_ExtraDemoSetPosition(s, position);
+
+	return qtrue;
+
+ bad:
+	CL_ExtraDemoSeek(df);
+	return qfalse;
+}
+
+/*
+==================
+CL_ExtraDemoWaitForFrame
+
+Returns the next queued frame or NULL if the demo is done.  Without a
+decoding thread messages are decoded here.
+==================
+*/
+static extraDemoFrame_t *CL_ExtraDemoWaitForFrame (extraDemoStream_t *s)
+{
+	extraDemoFrame_t *frame;
+	qboolean gotSnapshot;
+
+	if (!s->thread) {
+		while (s->count == 0  &&  !s->done) {
+			frame = &s->frames[(s->head + s->count) % EXTRA_DEMO_QUEUE_SIZE];
+			if (!CL_ExtraDemoReadMessage(s, frame, &gotSnapshot)) {
+				s->done = qtrue;
+			}
+			if (gotSnapshot) {
+				s->count++;
+			}
+		}
+
+		return s->count ? &s->frames[s->head] : NULL;
+	}
+
+	Sys_LockMutex(s->mutex);
+	while (s->count == 0  &&  !s->done) {
+		Sys_CondWait(s->cond, s->mutex);
+	}
+	frame = s->count ? &s->frames[s->head] : NULL;
+	Sys_UnlockMutex(s->mutex);
+
+	return frame;
+}
+
+static void CL_ExtraDemoPopFrame (extraDemoStream_t *s)
+{
+	if (s->thread) {
+		Sys_LockMutex(s->mutex);
+	}
+
+	s->head = (s->head + 1) % EXTRA_DEMO_QUEUE_SIZE;
+	s->count--;
+
+	if (s->thread) {
+		Sys_CondBroadcast(s->cond);
+		Sys_UnlockMutex(s->mutex);
+	}
+}
+
+/*
+==================
+CL_ExtraDemoMerge
+
+Called after the main demo parsed a snapshot.  Drops the extra demo's
+snapshots older than serverTime and, if it has one with the same server
+time, stores it in cl.snapshots[df->num][] under the main demo's message
+number with its entities appended to cl.parseEntities[].
+==================
+*/
+void CL_ExtraDemoMerge (demoFile_t *df, int serverTime, int messageNum)
+{
+	extraDemoStream_t *s;
+	extraDemoFrame_t *frame;
+	clSnapshot_t *snap;
+	int i;
+
+	s = df->stream;
+	if (!s) {
+		return;
+	}
+
+	snap = &cl.snapshots[df->num][messageNum & PACKET_MASK];
+	snap->valid = qfalse;
+
+	// shownet output from the message functions isn't thread safe
+	if (!s->thread  &&  !s->done  &&  (s->data  ||  s->file)  &&  cl_demoExtraThreads->integer  &&  !cl_shownet->integer) {
+		s->thread = Sys_CreateThread(CL_ExtraDemoThread, s);
+	}
+
+	while (1) {
+		frame = CL_ExtraDemoWaitForFrame(s);
+		if (!frame) {
+			break;
+		}
+
+		if (frame->snap.serverTime > serverTime) {
+			break;
+		}
+
+		if (frame->snap.serverTime == serverTime) {
+			*snap = frame->snap;
+			snap->messageNum = messageNum;
+			snap->parseEntitiesNum = cl.parseEntitiesNum;
+			for (i = 0;  i < frame->snap.numEntities;  i++) {
+				cl.parseEntities[cl.parseEntitiesNum & (MAX_PARSE_ENTITIES - 1)] = frame->entities[i];
+				cl.parseEntitiesNum++;
+			}
+			df->serverTime = frame->snap.serverTime;
+			df->serverMessageSequence = frame->serverMessageSequence;
+			CL_ExtraDemoPopFrame(s);
+			break;
+		}
+
+		df->serverTime = frame->snap.serverTime;
+		CL_ExtraDemoPopFrame(s);
+	}
+
+	if (s->done  &&  s->message[0]) {
+		Com_Printf("%s", s->message);
+		s->message[0] = '\0';
+	}
+}
@@ -91,6 +91,8 @@ cvar_t	*cl_aviCodec;
 cvar_t *cl_aviAllowLargeFiles;
 cvar_t *cl_aviFetchMode;
 cvar_t *cl_aviExtension;
+cvar_t *cl_aviWriteThread;
+cvar_t *cl_aviWriteBufferSize;
 cvar_t *cl_aviNoAudioHWOutput;
 cvar_t	*cl_forceavidemo;
 cvar_t *cl_freezeDemoPauseVideoRecording;
@@ -129,6 +131,7 @@ cvar_t	*cl_allowDownload;
 cvar_t	*cl_conXOffset;
 cvar_t	*cl_inGameVideo;
 cvar_t *cl_cinematicIgnoreSeek;
+cvar_t *cl_cinematicThread;
 
 cvar_t	*cl_serverStatusResendTime;
 
@@ -143,9 +146,11 @@ cvar_t	*cl_rate;
 cvar_t	*cl_useq3gibs;
 cvar_t	*cl_consoleAsChat;
 cvar_t *cl_numberPadInput;
-cvar_t *cl_maxRewindBackups;
+cvar_t *cl_rewindBackupMemory;
 cvar_t *cl_keepDemoFileInMemory;
 cvar_t *cl_demoFileCheckSystem;
+cvar_t *cl_demoExtraThreads;
+cvar_t *cl_demoReadAhead;
 cvar_t *cl_demoFile;
 cvar_t *cl_demoFileBaseName;
 cvar_t *cl_downloadWorkshops;
@@ -166,8 +171,6 @@ static void		*rendererLib = NULL;
 #endif
 
 demoInfo_t di;
-rewindBackups_t *rewindBackups;
-int maxRewindBackups;
 
 ping_t	cl_pinglist[MAX_PINGREQUESTS];
 
@@ -193,6 +196,8 @@ aviFileData_t afdDepth;
 aviFileData_t afdDepthLeft;
 aviFileData_t afdDepthRight;
 
+aviFileData_t afdScaled[MAX_VIDEO_SCALES];
+
 GLfloat *Video_DepthBuffer = NULL;
 byte *ExtraVideoBuffer = NULL;
 qboolean SplitVideo = qfalse;
@@ -213,7 +218,6 @@ static void CL_ShowIP_f(void);
 static void CL_ServerStatus_f(void);
 static void CL_ServerStatusResponse( netadr_t from, msg_t *msg );
 
-static void CL_ReadExtraDemoMessage (demoFile_t *df);
 static void CL_CheckWorkshopDownload (void);
 
 void CL_StopVideo_f (void);
@@ -990,6 +994,8 @@ void CL_DemoCompleted( void )
 		}
 	}
 
+	CL_BenchDemoCompleted();
+
 	CL_Disconnect( qtrue );
 	CL_NextDemo();
 }
@@ -1311,7 +1317,7 @@ void CL_ReadDemoMessage (qboolean seeking)
 	byte		bufData[ MAX_MSGLEN ];
 	int			s;
 	int i;
-	rewindBackups_t *rb;
+	int oldSnapMessageNum;
 	//double currentTime;
 
 	if (cl_freezeDemo->integer) {
@@ -1332,44 +1338,23 @@ void CL_ReadDemoMessage (qboolean seeking)
 	//Com_Printf("snaps in demo: %d\n", di.snapsInDemo);
 
 
-	if ( !di.testParse  &&  di.snapCount < maxRewindBackups  &&
+	if ( !di.testParse  &&
 		 ((!di.gotFirstSnap  &&  !(clc.state >= CA_CONNECTED && clc.state < CA_PRIMED))
       ||
-		  (di.gotFirstSnap  &&  di.numSnaps % (di.snapsInDemo / maxRewindBackups) == 0))) {
+		  (di.gotFirstSnap  &&  CL_RewindBackupWanted(CL_DemoTell(), seeking)))) {
 		if (!di.skipSnap) {
 			// first snap triggers loading screen when rewinding
 			di.skipSnap = qtrue;
 			goto keep_reading;
 		}
 		di.gotFirstSnap = qtrue;
-		rb = &rewindBackups[di.snapCount];
-		if (!rb->valid) {
-			//Com_Printf("setting rewind backup %d  numSnaps %d\n", di.snapCount, di.numSnaps);
-			//Com_Printf("active %d  conn %d  static %d\n", sizeof(cl), sizeof(clc), sizeof(cls));
-			rb->valid = qtrue;
-			rb->numSnaps = di.numSnaps;
-			rb->seekPoint = FS_FTell(clc.demoReadFile);
-			for (i = 1;  i < di.numDemoFiles;  i++) {
-				demoFile_t *df;
-
-				df = &di.demoFiles[i];
-				if (df->valid) {
-					rb->demoSeekPoints[i] = FS_FTell(df->f);
-				} else {
-					rb->demoSeekPoints[i] = -1;
-				}
-			}
-			memcpy(&rb->cl, &cl, sizeof(clientActive_t));
-			memcpy(&rb->clc, &clc, sizeof(clientConnection_t));
-			memcpy(&rb->cls, &cls, sizeof(clientStatic_t));
-		}
-		di.snapCount++;
+		CL_AddRewindBackup(CL_DemoTell(), di.numSnaps);
 	}
 
 keep_reading:
 
 	// get the sequence number
-	r = FS_Read( &s, 4, clc.demoReadFile);
+	r = CL_DemoRead(&s, 4);
 	if ( r != 4 ) {
 		CL_DemoCompleted ();
 		return;
@@ -1380,7 +1365,7 @@ keep_reading:
 	MSG_Init( &buf, bufData, sizeof( bufData ) );
 
 	// get the length
-	r = FS_Read (&buf.cursize, 4, clc.demoReadFile);
+	r = CL_DemoRead(&buf.cursize, 4);
 	if ( r != 4 ) {
 		CL_DemoCompleted ();
 		return;
@@ -1406,7 +1391,9 @@ keep_reading:
 	if ( buf.cursize > buf.maxsize ) {
 		Com_Error (ERR_DROP, "CL_ReadDemoMessage: demoMsglen (%d) > MAX_MSGLEN (%d)", buf.cursize, buf.maxsize);
 	}
-	r = FS_Read( buf.data, buf.cursize, clc.demoReadFile );
+	Com_ProfileBegin("demo read");
+	r = CL_DemoRead(buf.data, buf.cursize);
+	Com_ProfileEnd();
 	if ( r != buf.cursize ) {
 		Com_Printf( "Demo file was truncated.\n");
 		CL_DemoCompleted ();
@@ -1415,7 +1402,10 @@ keep_reading:
 
 	clc.lastPacketTime = cls.realtime;
 	buf.readcount = 0;
+	oldSnapMessageNum = cl.snap.messageNum;
+	Com_ProfileBegin("demo parse");
 	CL_ParseServerMessage( &buf );
+	Com_ProfileEnd();
 
 	if (!di.testParse  &&   clc.demorecording  &&  clc.demoplaying  &&  !seeking) {
 		if (cl.snap.deltaNum < di.firstNonDeltaMessageNumWritten  ||  di.firstNonDeltaMessageNumWritten == -1) {
@@ -1474,42 +1464,19 @@ keep_reading:
 #endif
 	}
 
-	if (!di.testParse  &&  clc.demoplaying) {
+	if (!di.testParse  &&  clc.demoplaying  &&  cl.snap.messageNum != oldSnapMessageNum) {
+		Com_ProfileBegin("extra demo merge");
 		for (i = 1;  i < di.numDemoFiles;  i++) {
 			demoFile_t *df;
-			int pos;
 
 			df = &di.demoFiles[i];
 			if (!df->valid) {
 				continue;
 			}
 
-			while (1) {
-				int oldServerTime;
-
-				oldServerTime = df->serverTime;
-				pos = FS_FTell(df->f);
-				//Com_Printf("pack %d\n", cl.parseEntitiesNum);
-				CL_ReadExtraDemoMessage(df);
-				//Com_Printf("pack %d\n", cl.parseEntitiesNum);
-
-				//Com_Printf("%d  (%d)demoFile %d  serverTime %d\n", cl.snap.serverTime, i, df->f, df->serverTime);
-
-				if (df->serverTime < cl.snap.serverTime) {
-					continue;
-				}
-
-				if (df->serverTime > cl.snap.serverTime) {
-					FS_Seek(df->f, pos, FS_SEEK_SET);
-					df->serverTime = oldServerTime;
-					break;
-				}
-
-				// got it
-				//Com_Printf("%d  demoFile %d  serverTime %d\n", cl.snap.serverTime, df->f, df->serverTime);
-				break;
-			}
+			CL_ExtraDemoMerge(df, cl.snap.serverTime, cl.snap.messageNum);
 		}
+		Com_ProfileEnd();
 	}
 }
 
@@ -1911,13 +1878,13 @@ static void parse_demo (void)
 		di.clientTeam[i] = TEAM_NUM_TEAMS;
 	}
 
-	FS_Seek(clc.demoReadFile, 0, FS_SEEK_SET);
+	CL_DemoSeek(0);
     clc.state = CA_CONNECTED;
     clc.demoplaying = qtrue;
 	di.testParse = qtrue;
 	Msg_TestParse = qtrue;
 
-	di.demoPos = FS_FTell(clc.demoReadFile);
+	di.demoPos = CL_DemoTell();
     // get gameState
     CL_ReadDemoMessage(qfalse);
 	//CL_SkipDemoMessage();
@@ -1953,7 +1920,7 @@ static void parse_demo (void)
         ///////////////////////////////
         //printf ("clc.state:%d\n", clc.state);
 
-		di.demoPos = FS_FTell(clc.demoReadFile);
+		di.demoPos = CL_DemoTell();
         CL_SetCGameTime();
 		if (Msg_Abort) {
 			//CL_Disconnect(qfalse);
@@ -2067,7 +2034,7 @@ static void parse_demo (void)
 	Com_Printf("%d item pickups in demo\n", di.numItemPickups);
 	Com_Printf("%d timeout spans in demo\n", di.numTimeouts);
 	Com_Printf("parse time %f seconds\n", (float)(Sys_Milliseconds() - tstart) / 1000.0);
-	FS_Seek(clc.demoReadFile, 0, FS_SEEK_SET);
+	CL_DemoSeek(0);
 	clc.demoplaying = qfalse;
 	di.testParse = qfalse;
 	// CL_Disconnect(qtrue);
@@ -2087,63 +2054,6 @@ static void parse_demo (void)
 	Cmd_RemoveCommand("voip");
 }
 
-static void CL_ReadExtraDemoMessage (demoFile_t *df)
-{
-	int			r;
-	msg_t		buf;
-	byte		bufData[ MAX_MSGLEN ];
-	int			s;
-
-	if ( !df  ||  !df->valid ) {
-		//CL_DemoCompleted ();
-		return;
-	}
-
-	// get the sequence number
-	r = FS_Read(&s, 4, df->f);
-	if ( r != 4 ) {
-		//CL_DemoCompleted ();
-		Com_Printf("demoFile %d ended\n", df->f);
-		return;
-	}
-	df->serverMessageSequence = LittleLong( s );
-	//Com_Printf("demoFile %d  sequence %d (%d)\n", df->f, df->serverMessageSequence, clc.serverMessageSequence);
-
-	// init the message
-	MSG_Init(&buf, bufData, sizeof(bufData));
-
-	// get the length
-	r = FS_Read (&buf.cursize, 4, df->f);
-	if ( r != 4 ) {
-		//CL_DemoCompleted ();
-		Com_Printf("demoFile %d truncated\n", df->f);
-		return;
-	}
-	buf.cursize = LittleLong( buf.cursize );
-
-	if ( buf.cursize == -1 ) {
-		//CL_DemoCompleted ();
-		Com_Printf("demoFile %d done\n", df->f);
-		return;
-	}
-
-	if ( buf.cursize > buf.maxsize ) {
-		//Com_Error (ERR_DROP, "CL_ReadDemoMessage: demoMsglen (%d) > MAX_MSGLEN (%d)", buf.cursize, buf.maxsize);
-		Com_Printf ("^1CL_ReadExtraDemoMessage: demoMsglen (%d) > MAX_MSGLEN (%d) for demoFile %d\n", buf.cursize, buf.maxsize, df->f);
-		return;
-	}
-	r = FS_Read( buf.data, buf.cursize, df->f );
-	if ( r != buf.cursize ) {
-		Com_Printf( "Demo file %d was truncated(2)\n", df->f);
-		//CL_DemoCompleted ();
-		return;
-	}
-
-	//clc.lastPacketTime = cls.realtime;
-	buf.readcount = 0;
-	CL_ParseExtraServerMessage(df, &buf);
-}
-
 static qhandle_t CL_OpenDemoFile (const char *arg)
 {
 	char name[MAX_OSPATH];
@@ -2355,6 +2265,7 @@ void CL_PlayDemo_f (void)
 		Com_Printf("^1CL_PlayDemo_f() couldn't open demo file '%s'\n", arg);
 		return;
 	}
+	CL_DemoReadStart(clc.demoReadFile);
 
 	//FIXME
 	memset(&di, 0, sizeof(di));
@@ -2391,6 +2302,11 @@ void CL_PlayDemo_f (void)
 		df = &di.demoFiles[di.numDemoFiles];
 		df->f = file;
 		df->valid = qtrue;
+		CL_ExtraDemoOpen(df);
+		if (!df->valid) {
+			FS_FCloseFile(file);
+			continue;
+		}
 		di.numDemoFiles++;
 	}
 
@@ -2602,6 +2518,7 @@ void CL_ClearState (void) {
 //	S_StopAllSounds();
 
 	Com_Memset( &cl, 0, sizeof( cl ) );
+	CL_InvalidateSnapshotViews();
 }
 
 /*
@@ -2654,6 +2571,8 @@ void CL_Disconnect( qboolean showMainMenu ) {
 		return;
 	}
 
+	CL_BenchDisconnect();
+
 	// Stop recording any video
 	if (CL_VideoRecording(&afdMain)) {
 		// Finish rendering current frame
@@ -2673,6 +2592,8 @@ void CL_Disconnect( qboolean showMainMenu ) {
 			free(ExtraVideoBuffer);
 			ExtraVideoBuffer = NULL;
 		}
+
+		CL_CloseScaledAVIs();
 	}
 
 	Com_Printf("disconnect\n");
@@ -2741,6 +2662,7 @@ void CL_Disconnect( qboolean showMainMenu ) {
 #endif
 
 	if ( clc.demoReadFile ) {
+		CL_DemoReadStop();
 		FS_FCloseFile( clc.demoReadFile );
 		clc.demoReadFile = 0;
 		//di.demoFiles[0].f = 0;
@@ -2754,12 +2676,11 @@ void CL_Disconnect( qboolean showMainMenu ) {
 				continue;
 			}
 
+			CL_ExtraDemoClose(df);
 			FS_FCloseFile(df->f);
 		}
 
-		for (i = 0;  i < maxRewindBackups;  i++) {
-			rewindBackups[i].valid = qfalse;
-		}
+		CL_ClearRewindBackups();
 
 		memset(&di, 0, sizeof(demoInfo_t));
 	}
@@ -3285,6 +3206,8 @@ void CL_Vid_Restart_f (void)
 			free(ExtraVideoBuffer);
 			ExtraVideoBuffer = NULL;
 		}
+
+		CL_CloseScaledAVIs();
 	}
 
 	if(clc.demorecording)
@@ -4569,6 +4492,8 @@ void CL_Frame ( int msec, double fmsec ) {
 
 	Sys_DisableScreenBlanking();
 
+	CL_BenchFrame();
+
 	blurFramesFactor = 1.0;
 	//Com_Printf("CL_Frame msec: %d  fmsec: %f  timescale: %f\n", msec, fmsec, com_timescale->value);
 
@@ -5019,6 +4944,9 @@ void CL_InitRef ( void ) {
 	ri.Sys_GLimpInit = Sys_GLimpInit;
 	ri.Sys_LowPhysicalMemory = Sys_LowPhysicalMemory;
 
+	ri.ProfileBegin = Com_ProfileBegin;
+	ri.ProfileEnd = Com_ProfileEnd;
+
 	// video recording stuff
 	ri.SplitVideo = &SplitVideo;
 
@@ -5104,6 +5032,11 @@ void CL_Video_f( void )
 {
   char  filename[ MAX_OSPATH ];
   int   i;  //, last;
+  int   j;
+  int   numScales;
+  int   scaleWidth[MAX_VIDEO_SCALES];
+  int   scaleHeight[MAX_VIDEO_SCALES];
+  int   w, h;
   qboolean avi;
   qboolean wav;
   qboolean tga;
@@ -5124,6 +5057,7 @@ void CL_Video_f( void )
   noSoundAvi = qfalse;
   filename[0] = '\0';
   SplitVideo = qfalse;
+  numScales = 0;
 
   for (i = 1;  i < Cmd_Argc();  i++) {
 	  if (!Q_stricmp(Cmd_Argv(i), "avi")) {
@@ -5142,6 +5076,29 @@ void CL_Video_f( void )
 		  png = qtrue;
 	  } else if (!Q_stricmp(Cmd_Argv(i), "split")) {
 		  SplitVideo = qtrue;
+	  } else if (!Q_stricmp(Cmd_Argv(i), "size")) {
+		  if (sscanf(Cmd_Argv(i + 1), "%dx%d", &w, &h) != 2  ||  w <= 0  ||  h <= 0) {
+			  Com_Printf("^1invalid video size '%s', use <width>x<height>\n", Cmd_Argv(i + 1));
+			  return;
+		  }
+		  if (w > cls.glconfig.vidWidth  ||  h > cls.glconfig.vidHeight) {
+			  Com_Printf("^1video size %dx%d is larger than the screen (%dx%d)\n", w, h, cls.glconfig.vidWidth, cls.glconfig.vidHeight);
+			  return;
+		  }
+		  if (numScales >= MAX_VIDEO_SCALES) {
+			  Com_Printf("^1too many video sizes, max is %d\n", MAX_VIDEO_SCALES);
+			  return;
+		  }
+
+		  // keep them sorted largest first
+		  for (j = numScales;  j > 0  &&  scaleWidth[j - 1] * scaleHeight[j - 1] < w * h;  j--) {
+			  scaleWidth[j] = scaleWidth[j - 1];
+			  scaleHeight[j] = scaleHeight[j - 1];
+		  }
+		  scaleWidth[j] = w;
+		  scaleHeight[j] = h;
+		  numScales++;
+		  i++;
 	  } else if (!Q_stricmp(Cmd_Argv(i), "name")) {
 		  if (!Q_stricmp(Cmd_Argv(i + 1), ":demoname")) {
 			  char dnameBuffer[MAX_OSPATH];
@@ -5164,6 +5121,17 @@ void CL_Video_f( void )
 	  return;
   }
 
+  if (numScales > 0) {
+	  if (!avi) {
+		  Com_Printf("^1extra video sizes can only be recorded with avi\n");
+		  return;
+	  }
+	  if (!Q_stricmp(cl_aviCodec->string, "mjpeg")) {
+		  Com_Printf("^1extra video sizes can't be recorded with 'cl_aviCodec mjpeg'\n");
+		  return;
+	  }
+  }
+
 #if 0
   if (Cmd_Argc() < 2) {
 	  avi = qtrue;
@@ -5207,11 +5175,17 @@ void CL_Video_f( void )
 	  CL_OpenAVIForWriting(&afdLeft, filename, qfalse, avi, avi ? qtrue : noSoundAvi, wav, tga, jpg, png, qfalse, qtrue, qtrue);
 	  CL_OpenAVIForWriting(&afdRight, filename, qfalse, avi, avi ? qtrue : noSoundAvi, wav, tga, jpg, png, qfalse, qtrue, qfalse);
   }
+  for (i = 0;  i < numScales;  i++) {
+	  CL_OpenScaledAVIForWriting(&afdScaled[i], filename, scaleWidth[i], scaleHeight[i], noSoundAvi);
+  }
+
   //Com_Printf("^2video cl_aviFrameRate %d\n", cl_aviFrameRate->integer);
   CL_OpenAVIForWriting(&afdMain, filename, qfalse, avi, noSoundAvi, wav, tga, jpg, png, qfalse, qfalse, qfalse);
 
   if (CL_VideoRecording(&afdMain)) {
 	  s_soundtime = s_paintedtime;
+  } else {
+	  CL_CloseScaledAVIs();
   }
 }
 
@@ -5237,13 +5211,57 @@ void CL_StopVideo_f( void )
 		ExtraVideoBuffer = NULL;
 	}
 
+	CL_CloseScaledAVIs();
 	CL_CloseAVI(&afdMain, qfalse);
 }
 
+// the caller fast forwards from here
+static void restore_demo_backup (rewindBackup_t *rb)
+{
+	int scaledtimeOrig;
+	clientConnection_t clcOrig;
+
+	//Com_Printf("seeking to %d %d   cl.serverTime:%d  cl.snap.serverTime:%d\n", rb->serverTime, rb->seekPoint, cl.serverTime, cl.snap.serverTime);
+	CL_DemoSeek(rb->seekPoint);
+	di.numSnaps = rb->numSnaps;
+
+	//FIXME check if demo has voip
+	memcpy(&clcOrig, &clc, sizeof(clientConnection_t));
+	scaledtimeOrig = cls.scaledtime;
+
+	CL_RestoreRewindBackup(rb);
+	CL_InvalidateSnapshotViews();
+
+#ifdef USE_VOIP
+	// voip stuff
+	//FIXME check if demo even has voip
+	clc.voipEnabled = clcOrig.voipEnabled;
+	clc.speexInitialized = clcOrig.speexInitialized;
+	clc.speexFrameSize = clcOrig.speexFrameSize;
+	clc.speexSampleRate = clcOrig.speexSampleRate;
+	clc.voipCodecInitialized = clcOrig.voipCodecInitialized;
+	memcpy(&clc.speexDecoderBits, &clcOrig.speexDecoderBits, sizeof(SpeexBits) * MAX_CLIENTS);
+	memcpy(&clc.speexDecoder, &clcOrig.speexDecoder, sizeof(void *) * MAX_CLIENTS);
+	memcpy(&clc.opusDecoder, &clcOrig.opusDecoder, sizeof(OpusDecoder *) * MAX_CLIENTS);
+	// incoming ... skip
+	memcpy(&clc.voipGain, &clcOrig.voipGain, sizeof(float) * MAX_CLIENTS);
+	memcpy(&clc.voipIgnore, &clcOrig.voipIgnore, sizeof(qboolean) * MAX_CLIENTS);
+	clc.voipMuteAll = clcOrig.voipMuteAll;
+#endif
+
+	cls.scaledtime = scaledtimeOrig;
+
+	Overf = 0;
+	//Com_Printf("%s clc.state %d\n", __FUNCTION__, clc.state);
+	//FIXME hack
+	clc.state = CA_ACTIVE;
+}
+
 static void fast_forward_demo (double wantedTime)
 {
 	int loopCount;
 	int stream;
+	rewindBackup_t *rb;
 
 	if ( clc.state < CA_CONNECTED ) {
 		return;
@@ -5278,6 +5296,12 @@ static void fast_forward_demo (double wantedTime)
 		return;
 	}
 
+	// skip ahead if there's a seek point past the current snapshot
+	rb = CL_FindRewindBackup(wantedTime - 1000.0);
+	if (rb  &&  rb->serverTime > cl.snap.serverTime) {
+		restore_demo_backup(rb);
+	}
+
 	if (Cvar_VariableIntegerValue("debug_seek")) {
 		Com_Printf("fastforwarding from %f to %f\n", (double)cl.serverTime + Overf, wantedTime);
 	}
@@ -5330,89 +5354,20 @@ static void fast_forward_demo (double wantedTime)
 
 static void rewind_demo (double wantedTime)
 {
-	int i;
-	rewindBackups_t *rb;
-	int j;
-	int scaledtimeOrig;
-	clientConnection_t clcOrig;
+	rewindBackup_t *rb;
 
 	if (wantedTime < (double)di.firstServerTime) {
 		wantedTime = di.firstServerTime;
 	}
 
-	if (!rewindBackups[0].valid  ||  di.snapCount == 0) {
-		//Com_Printf("wtf di.snapCount %d\n", di.snapCount);
+	// go back a second before wanted time in order to have snapshot backups available for screen matching
+	rb = CL_FindRewindBackup(wantedTime - 1000.0);
+	if (!rb) {
 		fast_forward_demo(wantedTime);
 		return;
 	}
 
-	rb = NULL;
-	for (i = di.snapCount - 1;  i >= 0;  i--) {
-		rb = &rewindBackups[i];
-		// go back a second before wanted time in order to have snapshot backups available for screen matching
-		//if (rb->cl.snap.serverTime < (currentTime - di.rewindRequestTime) - 1000) {
-		if ((double)rb->cl.snap.serverTime < wantedTime - 1000.0) {
-			//Com_Printf("snapCount index: %d  %d  from %f  want %f\n", i, rb->cl.snap.serverTime, currentTime, di.rewindRequestTime);
-			break;
-		}
-	}
-	if (rb == NULL  ||  i < 0) {
-		if (rb == NULL) {
-			Com_Printf("FIXME rewind couldn't find valid snap  rb:%p  i:%d  rb serverTime %d   wanted %f\n", rb, i, rewindBackups[0].cl.snap.serverTime, wantedTime);
-		}
-		rb = &rewindBackups[0];
-		i = 0;
-	}
-
-	//Com_Printf("seeking to index %d %d   cl.serverTime:%d  cl.snap.serverTime:%d, new clc.lastExecutedServercommand %d  clc.serverCommandSequence %d\n", i, rb->seekPoint, cl.serverTime, cl.snap.serverTime, rb->clc.lastExecutedServerCommand, rb->clc.serverCommandSequence);
-	FS_Seek(clc.demoReadFile, rb->seekPoint, FS_SEEK_SET);
-	for (j = 1;  j < di.numDemoFiles;  j++) {
-		demoFile_t *df;
-
-		df = &di.demoFiles[j];
-		if (!df->valid) {
-			continue;
-		}
-		if (rb->demoSeekPoints[j] < 0) {
-			continue;
-		}
-		FS_Seek(df->f, rb->demoSeekPoints[j], FS_SEEK_SET);
-		df->serverTime = 0;
-	}
-	di.numSnaps = rb->numSnaps;
-	di.snapCount = i + 1;  //FIXME hack
-
-	//FIXME check if demo has voip
-	memcpy(&clcOrig, &clc, sizeof(clientConnection_t));
-
-	memcpy(&cl, &rb->cl, sizeof(clientActive_t));
-	memcpy(&clc, &rb->clc, sizeof(clientConnection_t));
-
-#ifdef USE_VOIP
-	// voip stuff
-	//FIXME check if demo even has voip
-	clc.voipEnabled = clcOrig.voipEnabled;
-	clc.speexInitialized = clcOrig.speexInitialized;
-	clc.speexFrameSize = clcOrig.speexFrameSize;
-	clc.speexSampleRate = clcOrig.speexSampleRate;
-	clc.voipCodecInitialized = clcOrig.voipCodecInitialized;
-	memcpy(&clc.speexDecoderBits, &clcOrig.speexDecoderBits, sizeof(SpeexBits) * MAX_CLIENTS);
-	memcpy(&clc.speexDecoder, &clcOrig.speexDecoder, sizeof(void *) * MAX_CLIENTS);
-	memcpy(&clc.opusDecoder, &clcOrig.opusDecoder, sizeof(OpusDecoder *) * MAX_CLIENTS);
-	// incoming ... skip
-	memcpy(&clc.voipGain, &clcOrig.voipGain, sizeof(float) * MAX_CLIENTS);
-	memcpy(&clc.voipIgnore, &clcOrig.voipIgnore, sizeof(qboolean) * MAX_CLIENTS);
-	clc.voipMuteAll = clcOrig.voipMuteAll;
-#endif
-
-	scaledtimeOrig = cls.scaledtime;
-	memcpy(&cls, &rb->cls, sizeof(clientStatic_t));
-	cls.scaledtime = scaledtimeOrig;
-
-	Overf = 0;
-	//Com_Printf("%s clc.state %d\n", __FUNCTION__, clc.state);
-	//FIXME hack
-	clc.state = CA_ACTIVE;
+	restore_demo_backup(rb);
 	fast_forward_demo(wantedTime);
 }
 
@@ -5906,7 +5861,6 @@ CL_Init
 void CL_Init ( void ) {
 	Com_Printf( "----- Client Initialization -----\n" );
 
-	//Com_Printf("%f mb\n", (float)sizeof(rewindBackups_t) / 1024.0 / 1024.0);
 	//Com_Printf("%f mb\n", (float)sizeof(cl.entityBaselines) / 1024.0 / 1024.0);
 	Con_Init ();
 
@@ -5947,8 +5901,10 @@ void CL_Init ( void ) {
 	cl_aviFrameRateDivider = Cvar_Get("cl_aviFrameRateDivider", "1", CVAR_ARCHIVE);
 	cl_aviCodec = Cvar_Get ("cl_aviCodec", "uncompressed", CVAR_ARCHIVE);
 	cl_aviAllowLargeFiles = Cvar_Get("cl_aviAllowLargeFiles", "1", CVAR_ARCHIVE);
-	cl_aviFetchMode = Cvar_Get("cl_aviFetchMode", "GL_RGB", CVAR_ARCHIVE);
+	cl_aviFetchMode = Cvar_Get("cl_aviFetchMode", "auto", CVAR_ARCHIVE);
 	cl_aviExtension = Cvar_Get("cl_aviExtension", "avi", CVAR_ARCHIVE);
+	cl_aviWriteThread = Cvar_Get("cl_aviWriteThread", "1", CVAR_ARCHIVE);
+	cl_aviWriteBufferSize = Cvar_Get("cl_aviWriteBufferSize", "64", CVAR_ARCHIVE);
 	cl_aviNoAudioHWOutput = Cvar_Get("cl_aviNoAudioHWOutput", "1", CVAR_ARCHIVE);
 	cl_freezeDemoPauseVideoRecording = Cvar_Get("cl_freezeDemoPauseVideoRecording", "0", CVAR_ARCHIVE);
 	cl_freezeDemoPauseMusic = Cvar_Get("cl_freezeDemoPauseMusic", "1", CVAR_ARCHIVE);
@@ -5992,6 +5948,7 @@ void CL_Init ( void ) {
 #endif
 
 	cl_cinematicIgnoreSeek = Cvar_Get("cl_cinematicIgnoreSeek", "0", CVAR_ARCHIVE);
+	cl_cinematicThread = Cvar_Get("cl_cinematicThread", "1", CVAR_ARCHIVE);
 
 	cl_serverStatusResendTime = Cvar_Get ("cl_serverStatusResendTime", "750", 0);
 
@@ -6089,22 +6046,12 @@ void CL_Init ( void ) {
 	cl_consoleAsChat = Cvar_Get("cl_consoleAsChat", "0", CVAR_ARCHIVE);
 	cl_numberPadInput = Cvar_Get("cl_numberPadInput", "0", CVAR_ARCHIVE);
 
-	cl_maxRewindBackups = Cvar_Get("cl_maxRewindBackups", "12", CVAR_ARCHIVE | CVAR_LATCH);
-
-	maxRewindBackups = cl_maxRewindBackups->integer;
-	if (maxRewindBackups <= 0) {
-		maxRewindBackups = MAX_REWIND_BACKUPS;
-	}
-
-	rewindBackups = malloc(sizeof(rewindBackups_t) * maxRewindBackups);
-	if (!rewindBackups) {
-		Com_Printf("ERROR:  CL_Init couldn't allocate %.2f MB for rewind backups\n", (sizeof(rewindBackups_t) * maxRewindBackups) / 1024.0 / 1024.0);
-		exit(1);
-	}
-	Com_Printf("allocated %.2f MB for rewind backups\n", (sizeof(rewindBackups_t) * maxRewindBackups) / 1024.0 / 1024.0);
+	cl_rewindBackupMemory = Cvar_Get("cl_rewindBackupMemory", "64", CVAR_ARCHIVE);
 
 	cl_keepDemoFileInMemory = Cvar_Get("cl_keepDemoFileInMemory", "1", CVAR_ARCHIVE);
 	cl_demoFileCheckSystem = Cvar_Get("cl_demoFileCheckSystem", "2", CVAR_ARCHIVE);
+	cl_demoExtraThreads = Cvar_Get("cl_demoExtraThreads", "1", CVAR_ARCHIVE);
+	cl_demoReadAhead = Cvar_Get("cl_demoReadAhead", "8", CVAR_ARCHIVE);
 	cl_demoFile = Cvar_Get("cl_demoFile", "", CVAR_ROM);
 	cl_demoFileBaseName = Cvar_Get("cl_demoFileBaseName", "", CVAR_ROM);
 	cl_downloadWorkshops = Cvar_Get("cl_downloadWorkshops", "1", CVAR_ARCHIVE);
@@ -6139,6 +6086,7 @@ void CL_Init ( void ) {
 	//Cmd_AddCommand ("model", CL_SetModel_f );
 	//Cmd_AddCommand ("headmodel", CL_SetHeadModel_f );
 	Cmd_AddCommand ("video", CL_Video_f );
+	Cmd_AddCommand ("benchdemo", CL_BenchDemo_f );
 	Cmd_AddCommand ("stopvideo", CL_StopVideo_f );
 
 	if( !com_dedicated->integer ) {
@@ -6148,6 +6096,7 @@ void CL_Init ( void ) {
 
 	Cmd_AddCommand("rewind", CL_Rewind_f);
 	Cmd_AddCommand("fastforward", CL_FastForward_f);
+	Cmd_AddCommand("rewindBackupInfo", CL_RewindBackupInfo_f);
 	Cmd_AddCommand("seekservertime", CL_SeekServerTime_f);
 	Cmd_AddCommand("seek", CL_Seek_f);
 	Cmd_AddCommand("seekend", CL_SeekEnd_f);
@@ -6231,6 +6180,7 @@ void CL_Shutdown(char *finalmsg, qboolean disconnect, qboolean quit)
 	//Cmd_RemoveCommand ("model");
 	//Cmd_RemoveCommand ("headmodel");
 	Cmd_RemoveCommand ("video");
+	Cmd_RemoveCommand ("benchdemo");
 	Cmd_RemoveCommand ("stopvideo");
 	Cmd_RemoveCommand("stall");
 
@@ -6244,7 +6194,7 @@ void CL_Shutdown(char *finalmsg, qboolean disconnect, qboolean quit)
 	Com_Memset( &cls, 0, sizeof( cls ) );
 	Key_SetCatcher( 0 );
 
-	free(rewindBackups);
+	CL_ClearRewindBackups();
 	Com_Printf( "-----------------------\n" );
 }
 
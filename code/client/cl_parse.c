@@ -210,162 +210,6 @@ void CL_ParsePacketEntities( msg_t *msg, const clSnapshot_t *oldframe, clSnapsho
 	}
 }
 
-static void CL_ParseExtraSnapshot (demoFile_t *df, msg_t *msg, clSnapshot_t *sn, qboolean justPeek)
-{
-	int			len;
-	clSnapshot_t	*old;
-	clSnapshot_t	newSnap;
-	int			deltaNum;
-	int			oldMessageNum;
-	int			i, packetNum;
-
-	//Com_Printf("CL_ParseExtraSnapshot\n");
-
-	// read in the new snapshot to a temporary buffer
-	// we will only copy to cl.snap if it is valid
-	Com_Memset (&newSnap, 0, sizeof(newSnap));
-
-	// we will have read any new server commands in this
-	// message before we got to svc_snapshot
-
-	//FIXME
-	newSnap.serverCommandNum = clc.serverCommandSequence;
-
-	//Com_Printf("parse snap: %d\n", newSnap.serverCommandNum);
-
-	newSnap.serverTime = MSG_ReadLong( msg );
-	df->serverTime = newSnap.serverTime;
-
-	//FIXME
-	newSnap.messageNum = clc.serverMessageSequence;
-
-	deltaNum = MSG_ReadByte( msg );
-	if ( !deltaNum ) {
-		newSnap.deltaNum = -1;
-	} else {
-		newSnap.deltaNum = newSnap.messageNum - deltaNum;
-	}
-	newSnap.snapFlags = MSG_ReadByte( msg );
-
-	// If the frame is delta compressed from data that we
-	// no longer have available, we must suck up the rest of
-	// the frame, but not use it, then ask for a non-compressed
-	// message
-	if ( newSnap.deltaNum <= 0 ) {
-		newSnap.valid = qtrue;		// uncompressed frame
-		old = NULL;
-		//clc.demowaiting = qfalse;	// we can start recording now
-		//Com_Printf("%d newSnap.deltaNum <= 0\n", clc.serverMessageSequence);
-	} else {
-		//Com_Printf("deltaNum: %d (us %d)  newSnap servertime %d\n", newSnap.deltaNum, clc.serverMessageSequence, newSnap.serverTime);
-		old = &cl.snapshots[df->num][newSnap.deltaNum & PACKET_MASK];
-		if ( !old->valid ) {
-			// should never happen
-			if (1) {  //(!clc.demoplaying) {
-				//Com_Printf ("Delta from invalid frame (not supposed to happen!)  %d -> %d\n", newSnap.deltaNum, clc.serverMessageSequence);
-				newSnap.valid = qfalse;
-			} else {
-				newSnap.valid = qtrue;
-			}
-		} else if ( old->messageNum != newSnap.deltaNum ) {
-			// The frame that the server did the delta from
-			// is too old, so we can't reconstruct it properly.
-			if (!clc.demoplaying) {
-				Com_Printf ("Delta frame too old.\n");
-			} else {
-				// could be seeking in demo
-				newSnap.valid = qtrue;
-			}
-		} else if ( cl.parseEntitiesNum - old->parseEntitiesNum > MAX_PARSE_ENTITIES - MAX_SNAPSHOT_ENTITIES ) {
-			if (!clc.demoplaying) {
-				Com_Printf ("Delta parseEntitiesNum too old.\n");
-			} else {
-				newSnap.valid = qtrue;
-			}
-		} else {
-			newSnap.valid = qtrue;	// valid delta parse
-		}
-	}
-
-	// read areamask
-	len = MSG_ReadByte( msg );
-
-	if(len > sizeof(newSnap.areamask))
-	{
-		Com_Printf("^1CL_ParseExtraSnapshot: Invalid size %d for areamask for demoFile %d", len, df->f);
-		return;
-	}
-
-	MSG_ReadData( msg, &newSnap.areamask, len);
-
-	// read playerinfo
-	SHOWNET( msg, "playerstate" );
-	if ( old ) {
-		MSG_ReadDeltaPlayerstate( msg, &old->ps, &newSnap.ps );
-	} else {
-		MSG_ReadDeltaPlayerstate( msg, NULL, &newSnap.ps );
-	}
-
-	// read packet entities
-	SHOWNET( msg, "packet entities" );
-	CL_ParsePacketEntities( msg, old, &newSnap );
-
-	if (sn) {
-		*sn = newSnap;
-	}
-
-	//FIXME
-	//return;
-
-	if (justPeek) {
-		return;
-	}
-	// if not valid, dump the entire thing now that it has
-	// been properly read
-	if ( !newSnap.valid ) {
-		Com_Printf("%s invalid snap returning\n", __FUNCTION__);
-		return;
-	}
-
-	// clear the valid flags of any snapshots between the last
-	// received and this one, so if there was a dropped packet
-	// it won't look like something valid to delta from next
-	// time we wrap around in the buffer
-	oldMessageNum = cl.snap.messageNum + 1;
-
-	if ( newSnap.messageNum - oldMessageNum >= PACKET_BACKUP ) {
-		oldMessageNum = newSnap.messageNum - ( PACKET_BACKUP - 1 );
-	}
-	for ( ; oldMessageNum < newSnap.messageNum ; oldMessageNum++ ) {
-		cl.snapshots[df->num][oldMessageNum & PACKET_MASK].valid = qfalse;
-	}
-
-	// copy to the current good spot
-	cl.snap = newSnap;
-	cl.snap.ping = 999;
-	// calculate ping time
-	for ( i = 0 ; i < PACKET_BACKUP ; i++ ) {
-		packetNum = ( clc.netchan.outgoingSequence - 1 - i ) & PACKET_MASK;
-		if ( cl.snap.ps.commandTime >= cl.outPackets[ packetNum ].p_serverTime ) {
-			cl.snap.ping = cls.realtime - cl.outPackets[ packetNum ].p_realtime;
-			break;
-		}
-	}
-
-	// save the frame off in the backup array for later delta comparisons
-	cl.snapshots[df->num][cl.snap.messageNum & PACKET_MASK] = cl.snap;
-
-	if (cl_shownet->integer == 3) {
-		Com_Printf( "   snapshot:%i  delta:%i  ping:%i\n", cl.snap.messageNum,
-		cl.snap.deltaNum, cl.snap.ping );
-	}
-
-	//cl.newSnapshots = qtrue;
-
-
-	//Com_Printf("%s snap set\n", __FUNCTION__);
-}
-
 /*
 ================
 CL_ParseSnapshot
@@ -503,6 +347,14 @@ void CL_ParseSnapshot (msg_t *msg, clSnapshot_t *sn, int serverMessageSequence,
 			//cl.snapshots[0][cl.snap.messageNum & PACKET_MASK] = cl.snap;
 			PeekSnapshots[newSnap.messageNum & PACKET_MASK] = newSnap;
 		}
+
+		// CL_PeekSnapshot() rewinds cl.parseEntitiesNum, so the next peek
+		// or real snapshot overwrites these entities
+		cl.peekSequence++;
+		cl.peekMessageNum = newSnap.messageNum;
+		if (cl.parseEntitiesNum > cl.peekParseEntitiesNum) {
+			cl.peekParseEntitiesNum = cl.parseEntitiesNum;
+		}
 		return;
 	}
 	// if not valid, dump the entire thing now that it has
@@ -601,6 +453,29 @@ void CL_ParseSnapshot (msg_t *msg, clSnapshot_t *sn, int serverMessageSequence,
 	//Com_Printf("%s snap set\n", __FUNCTION__);
 }
 
+/*
+================
+CL_PeekedSnapshot
+
+NULL if messageNum wasn't the last snapshot read ahead by CL_PeekSnapshot()
+================
+*/
+const clSnapshot_t *CL_PeekedSnapshot (int messageNum)
+{
+	const clSnapshot_t *clSnap;
+
+	if (!cl.peekSequence  ||  cl.peekMessageNum != messageNum) {
+		return NULL;
+	}
+
+	clSnap = &PeekSnapshots[messageNum & PACKET_MASK];
+	if (!clSnap->valid  ||  clSnap->messageNum != messageNum) {
+		return NULL;
+	}
+
+	return clSnap;
+}
+
 
 //=====================================================================
 
@@ -732,100 +607,6 @@ static void CL_ParseServerInfo(void)
 		sizeof(clc.sv_dlURL));
 }
 
-static void CL_ParseExtraGamestate (demoFile_t *df, msg_t *msg)
-{
-	int				i;
-	entityState_t	*es;
-	int				newnum;
-	entityState_t	nullstate;
-	int				cmd;
-	//char			*s;
-	//int serverCommandSequence;
-	entityState_t tmpEntity;
-	//int clientNum;
-	//int checksumFeed;
-
-	//clc.connectPacketCount = 0;
-
-	// wipe local client state
-	//CL_ClearState();
-
-	// a gamestate always marks a server command sequence
-	//serverCommandSequence = MSG_ReadLong( msg );
-	MSG_ReadLong(msg);
-
-	// parse all the configstrings and baselines
-	//cl.gameState.dataCount = 1;	// leave a 0 at the beginning for uninitialized configstrings
-
-	//Com_Printf("parse gamestate...\n");
-
-	while ( 1 ) {
-		cmd = MSG_ReadByte( msg );
-
-		if ( cmd == svc_EOF ) {
-			break;
-		}
-
-		if ( cmd == svc_configstring ) {
-			//int		len;
-
-			//Com_Printf("config string...");
-
-			i = MSG_ReadShort( msg );
-			if ( i < 0 || i >= MAX_CONFIGSTRINGS ) {
-				//Parse_Error( ERR_DROP, "configstring > MAX_CONFIGSTRINGS" );
-				Com_Printf("^1CL_ParseExtraGamestate configstring(%d) > MAX_CONFIGSTRINGS(%d) demoFile %d\n", i, MAX_CONFIGSTRINGS, df->f);
-				return;
-			}
-			//s = MSG_ReadBigString( msg );
-			MSG_ReadBigString(msg);
-			//len = strlen( s );
-
-#if 0
-			if ( len + 1 + cl.gameState.dataCount > MAX_GAMESTATE_CHARS ) {
-				Parse_Error( ERR_DROP, "MAX_GAMESTATE_CHARS exceeded" );
-				return;
-			}
-#endif
-
-			//Com_Printf("cs %d '%s'\n", i, s);
-
-			// append it to the gameState string buffer
-			//cl.gameState.stringOffsets[ i ] = cl.gameState.dataCount;
-			//Com_Memcpy( cl.gameState.stringData + cl.gameState.dataCount, s, len + 1 );
-			//cl.gameState.dataCount += len + 1;
-		} else if ( cmd == svc_baseline ) {
-			newnum = MSG_ReadBits( msg, GENTITYNUM_BITS );
-			if ( newnum < 0 || newnum >= MAX_GENTITIES ) {
-				//Parse_Error( ERR_DROP, "Baseline number out of range: %i", newnum );
-				Com_Printf("^1CL_ParseExtraGamestate baseline number out of range: %d for demoFile %d\n", newnum, df->f);
-				return;
-			}
-			//Com_Memset (&nullstate, 0, sizeof(nullstate));
-			//es = &cl.entityBaselines[ newnum ];
-			es = &tmpEntity;
-			//MSG_ReadDeltaEntity( msg, &nullstate, es, newnum );
-			MSG_ReadDeltaEntity(msg, &nullstate, es, newnum);
-		} else {
-			//Parse_Error( ERR_DROP, "CL_ParseGamestate: bad command byte" );
-			Com_Printf("^1CL_ParseExtraGamestate bad command byte %d for demoFile %d\n", cmd, df->f);
-			return;
-		}
-	}
-
-	//clc.clientNum = MSG_ReadLong(msg);
-	//clientNum = MSG_ReadLong(msg);
-	MSG_ReadLong(msg);
-
-	// read the checksum feed
-	//clc.checksumFeed = MSG_ReadLong( msg );
-	//checksumFeed = MSG_ReadLong(msg);
-	MSG_ReadLong(msg);
-
-	// parse useful values out of CS_SERVERINFO
-	//CL_ParseServerInfo();
-}
-
 /*
 ==================
 CL_ParseGamestate
@@ -1067,11 +848,6 @@ void CL_ParseGamestate( msg_t *msg ) {
 
 //=====================================================================
 
-static void CL_ParseExtraDownload (demoFile_t *df, msg_t *msg)
-{
-	Com_Printf("FIXME CL_ParseExtraDownload\n");
-}
-
 /*
 =====================
 CL_ParseDownload
@@ -1259,11 +1035,6 @@ static void CL_PlayVoip(int sender, int samplecnt, const byte *data, int flags)
 	//Com_Printf("^3voip %d %f  direct:%d  spatial:%d  overall: %f\n", sender, clc.voipGain[sender], flags & VOIP_DIRECT, flags & VOIP_SPATIAL, cl_voipOverallGain->value);
 }
 
-static void CL_ParseExtraVoip (demoFile_t *df, msg_t *msg)
-{
-	Com_Printf("FIXME CL_ParseExtraVoip\n");
-}
-
 /*
   voip history:
 
@@ -1581,23 +1352,6 @@ void CL_ParseVoip ( msg_t *msg, qboolean ignoreData ) {
 #endif
 
 
-static void CL_ParseExtraCommandString (demoFile_t *df, msg_t *msg)
-{
-	char	*s;
-	int		seq;
-
-	seq = MSG_ReadLong( msg );
-	s = MSG_ReadString( msg );
-
-	//Com_Printf("^3extra cs(%d) '%s'\n", seq, s);
-
-	if (cl_shownet->integer == 3) {
-		Com_Printf("demoFile %d cs (%d) '%s'\n", df->f, seq, s);
-	}
-
-	//FIXME other stuff
-}
-
 /*
 =====================
 CL_ParseCommandString
@@ -1732,7 +1486,7 @@ void CL_ParseCommandString( msg_t *msg ) {
 						break;
 					}
 				}
-				if (!found) {
+				if (!found  &&  di.numPlayerInfo < MAX_PLAYER_INFO) {
 					Q_strncpyz(di.playerInfo[di.numPlayerInfo].modelName, model, MAX_QPATH);
 					di.numPlayerInfo++;
 				}
@@ -1753,7 +1507,7 @@ void CL_ParseCommandString( msg_t *msg ) {
 						break;
 					}
 				}
-				if (!found) {
+				if (!found  &&  di.numPlayerInfo < MAX_PLAYER_INFO) {
 					Q_strncpyz(di.playerInfo[di.numPlayerInfo].modelName, model, MAX_QPATH);
 					di.numPlayerInfo++;
 				}
@@ -2080,97 +1834,3 @@ void CL_ParseServerMessage( msg_t *msg ) {
 		}
 	}
 }
-
-void CL_ParseExtraServerMessage (demoFile_t *df, msg_t *msg)
-{
-	int			cmd;
-	//int reliableAcknowledge;
-
-	if ( cl_shownet->integer == 1 ) {
-		Com_Printf ("%i ",msg->cursize);
-	} else if ( cl_shownet->integer >= 2 ) {
-		Com_Printf ("------------------\n");
-	}
-
-	MSG_Bitstream(msg);
-
-	// get the reliable sequence acknowledge number
-	//reliableAcknowledge = MSG_ReadLong( msg );
-	MSG_ReadLong(msg);
-
-#if 0
-	//
-	if ( clc.reliableAcknowledge < clc.reliableSequence - MAX_RELIABLE_COMMANDS ) {
-		clc.reliableAcknowledge = clc.reliableSequence;
-	}
-#endif
-
-	//
-	// parse the message
-	//
-	while ( 1 ) {
-		if ( msg->readcount > msg->cursize ) {
-			//Parse_Error (ERR_DROP,"CL_ParseServerMessage: read past end of server message");
-			Com_Printf("^1CL_ParseExtraServerMessage() read past end of server message demoFile %d", df->f);
-			return;
-		}
-
-		cmd = MSG_ReadByte( msg );
-
-		// See if this is an extension command after the EOF, which means we
-		//  got data that a legacy client should ignore.
-		if ((cmd == svc_EOF) && (MSG_LookaheadByte( msg ) == svc_extension)) {
-			SHOWNET( msg, "EXTENSION" );
-			MSG_ReadByte( msg );  // throw the svc_extension byte away.
-			cmd = MSG_ReadByte( msg );  // something legacy clients can't do!
-			// sometimes you get a svc_extension at end of stream...dangling
-			//  bits in the huffman decoder giving a bogus value?
-			if (cmd == -1) {
-				cmd = svc_EOF;
-			}
-		}
-
-		if (cmd == svc_EOF) {
-			SHOWNET( msg, "END OF MESSAGE" );
-			break;
-		}
-
-		if ( cl_shownet->integer >= 2 ) {
-			if ( (cmd < 0) || (!svc_strings[cmd]) ) {
-				Com_Printf( "%3i:BAD CMD %i\n", msg->readcount-1, cmd );
-			} else {
-				SHOWNET( msg, svc_strings[cmd] );
-			}
-		}
-
-	// other commands
-		switch ( cmd ) {
-		default:
-			//Parse_Error (ERR_DROP, "CL_ParseServerMessage: Illegible server message %d", cmd);
-			Com_Printf("^1CL_ParseExtraServerMessage: Illegible server message %d for demoFile %d", cmd, df->f);
-			return;
-		case svc_nop:
-			break;
-		case svc_serverCommand:
-			CL_ParseExtraCommandString(df,  msg);
-			break;
-		case svc_gamestate:
-			CL_ParseExtraGamestate(df, msg);
-			break;
-		case svc_snapshot:
-			CL_ParseExtraSnapshot(df, msg, NULL, qfalse);
-			break;
-		case svc_download:
-			CL_ParseExtraDownload(df, msg);
-			break;
-		case svc_extension:  // libspeex voip protocol 70
-		case svc_voip:
-#ifdef USE_VOIP
-			CL_ParseExtraVoip(df, msg);
-#endif
-			break;
-		}
-	}
-}
-
-
@@ -0,0 +1,679 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// cl_rewind.c  -- demo seek points
+//
+// While a demo plays the client state is saved every few seconds so that
+// seeking only has to parse the demo from the closest earlier seek point.
+// Only the parts of cl, clc and cls that are in use are saved (valid
+// snapshots, the parse entities they refer to, the server command strings,
+// no server browser lists) and the result is deflated.  The extra demo
+// files given to 'demo' add where they are in their file and their own
+// delta state, so they don't have to be decoded again from the start.
+//
+// The seek points fit in cl_rewindBackupMemory.  'Coarse' ones are spread
+// evenly over the whole demo, as many as fit in half the budget, and are
+// also made while fast forwarding.  Normal playback adds more, every
+// REWIND_BACKUP_SPACING msec, and when over budget the least recently used
+// of those go first.
+
+#include "client.h"
+
+#ifdef USE_LOCAL_HEADERS
+#include "../zlib/zlib.h"
+#else
+#include <zlib.h>
+#endif
+
+#define MAX_REWIND_BACKUPS 4096
+#define REWIND_BACKUP_SPACING 2000  // msec between seek points near the playhead
+#define REWIND_BACKUP_SIZE_GUESS (256 * 1024)  // until some have been made
+
+static rewindBackup_t rewindBackups[MAX_REWIND_BACKUPS];  // sorted by seekPoint
+static int numRewindBackups;
+static int rewindBackupBytes;
+static int rewindBackupClock;  // for lastUsed
+
+// deflate output, the backup gets an exact size copy
+static byte *rewindBuffer;
+static int rewindBufferSize;
+
+static void CL_RewindDeflate (z_stream *zs, const void *data, int size, int flush)
+{
+	int used;
+	int r;
+
+	zs->next_in = (Bytef *)data;
+	zs->avail_in = size;
+
+	while (1) {
+		if (zs->avail_out == 0) {
+			used = rewindBufferSize;
+			rewindBufferSize *= 2;
+			rewindBuffer = realloc(rewindBuffer, rewindBufferSize);
+			if (!rewindBuffer) {
+				Com_Error(ERR_FATAL, "%s couldn't allocate %d bytes", __FUNCTION__, rewindBufferSize);
+			}
+			zs->next_out = rewindBuffer + used;
+			zs->avail_out = rewindBufferSize - used;
+		}
+
+		r = deflate(zs, flush);
+
+		if (flush == Z_FINISH) {
+			if (r == Z_STREAM_END) {
+				break;
+			}
+		} else if (zs->avail_in == 0) {
+			break;
+		}
+	}
+}
+
+static qboolean CL_RewindInflate (z_stream *zs, void *data, int size)
+{
+	int r;
+
+	zs->next_out = data;
+	zs->avail_out = size;
+
+	while (zs->avail_out > 0) {
+		r = inflate(zs, Z_SYNC_FLUSH);
+		if (r == Z_STREAM_END) {
+			break;
+		}
+		if (r != Z_OK) {
+			return qfalse;
+		}
+	}
+
+	return zs->avail_out == 0;
+}
+
+// first parse entity still used by a valid snapshot
+static int CL_FirstLiveParseEntity (void)
+{
+	const clSnapshot_t *snap;
+	int first;
+	int i;
+
+	first = cl.parseEntitiesNum;
+	snap = &cl.snapshots[0][0];
+	for (i = 0;  i < PACKET_BACKUP * MAX_DEMO_FILES;  i++, snap++) {
+		if (snap->valid  &&  snap->parseEntitiesNum < first) {
+			first = snap->parseEntitiesNum;
+		}
+	}
+
+	if (first < cl.parseEntitiesNum - MAX_PARSE_ENTITIES) {
+		first = cl.parseEntitiesNum - MAX_PARSE_ENTITIES;
+	}
+
+	return first;
+}
+
+/*
+==================
+CL_DeflateClientState
+
+Writes the live parts of cl, clc and cls to rewindBuffer, returns the
+compressed size.  CL_InflateClientState() reads them back in the same
+order.
+==================
+*/
+static int CL_DeflateClientState (void)
+{
+	z_stream zs;
+	const clSnapshot_t *snap;
+	const void *state;
+	short index;
+	short len;
+	int first, n;
+	int i;
+
+	if (!rewindBuffer) {
+		rewindBufferSize = 1024 * 1024;
+		rewindBuffer = malloc(rewindBufferSize);
+		if (!rewindBuffer) {
+			Com_Error(ERR_FATAL, "%s couldn't allocate %d bytes", __FUNCTION__, rewindBufferSize);
+		}
+	}
+
+	memset(&zs, 0, sizeof(zs));
+	if (deflateInit(&zs, Z_BEST_SPEED) != Z_OK) {
+		return 0;
+	}
+	zs.next_out = rewindBuffer;
+	zs.avail_out = rewindBufferSize;
+
+	// cl
+	CL_RewindDeflate(&zs, &cl, offsetof(clientActive_t, snapshots), Z_NO_FLUSH);
+
+	n = 0;
+	snap = &cl.snapshots[0][0];
+	for (i = 0;  i < PACKET_BACKUP * MAX_DEMO_FILES;  i++) {
+		if (snap[i].valid) {
+			n++;
+		}
+	}
+	CL_RewindDeflate(&zs, &n, sizeof(n), Z_NO_FLUSH);
+	for (i = 0;  i < PACKET_BACKUP * MAX_DEMO_FILES;  i++) {
+		if (snap[i].valid) {
+			index = i;
+			CL_RewindDeflate(&zs, &index, sizeof(index), Z_NO_FLUSH);
+			CL_RewindDeflate(&zs, &snap[i], sizeof(clSnapshot_t), Z_NO_FLUSH);
+		}
+	}
+
+	CL_RewindDeflate(&zs, cl.entityBaselines, sizeof(cl.entityBaselines), Z_NO_FLUSH);
+
+	first = CL_FirstLiveParseEntity();
+	CL_RewindDeflate(&zs, &first, sizeof(first), Z_NO_FLUSH);
+	for (i = first;  i < cl.parseEntitiesNum;  i += n) {
+		// up to the end of the ring at most
+		n = MAX_PARSE_ENTITIES - (i & (MAX_PARSE_ENTITIES - 1));
+		if (n > cl.parseEntitiesNum - i) {
+			n = cl.parseEntitiesNum - i;
+		}
+		CL_RewindDeflate(&zs, &cl.parseEntities[i & (MAX_PARSE_ENTITIES - 1)], n * sizeof(entityState_t), Z_NO_FLUSH);
+	}
+
+	n = offsetof(clientActive_t, parseEntities) + sizeof(cl.parseEntities);
+	CL_RewindDeflate(&zs, (byte *)&cl + n, sizeof(clientActive_t) - n, Z_NO_FLUSH);
+
+	// clc
+	CL_RewindDeflate(&zs, &clc, offsetof(clientConnection_t, serverCommands), Z_NO_FLUSH);
+
+	for (i = 0;  i < MAX_RELIABLE_COMMANDS;  i++) {
+		len = strlen(clc.serverCommands[i]);
+		CL_RewindDeflate(&zs, &len, sizeof(len), Z_NO_FLUSH);
+		CL_RewindDeflate(&zs, clc.serverCommands[i], len, Z_NO_FLUSH);
+	}
+
+	n = offsetof(clientConnection_t, serverCommands) + sizeof(clc.serverCommands);
+	CL_RewindDeflate(&zs, (byte *)&clc + n, sizeof(clientConnection_t) - n, Z_NO_FLUSH);
+
+	// cls, without the server browser lists
+	CL_RewindDeflate(&zs, &cls, offsetof(clientStatic_t, numlocalservers), Z_NO_FLUSH);
+	n = offsetof(clientStatic_t, pingUpdateSource);
+	CL_RewindDeflate(&zs, (byte *)&cls + n, sizeof(clientStatic_t) - n, Z_NO_FLUSH);
+
+	// extra demo files, 0 size if there's nothing to save
+	CL_RewindDeflate(&zs, &di.numDemoFiles, sizeof(di.numDemoFiles), Z_NO_FLUSH);
+	for (i = 1;  i < di.numDemoFiles;  i++) {
+		state = NULL;
+		n = 0;
+		if (di.demoFiles[i].valid) {
+			state = CL_ExtraDemoSaveState(&di.demoFiles[i], &n);
+		}
+		CL_RewindDeflate(&zs, &n, sizeof(n), Z_NO_FLUSH);
+		CL_RewindDeflate(&zs, state, n, Z_NO_FLUSH);
+	}
+
+	CL_RewindDeflate(&zs, NULL, 0, Z_FINISH);
+
+	n = zs.total_out;
+	deflateEnd(&zs);
+
+	return n;
+}
+
+static qboolean CL_InflateClientState (const rewindBackup_t *rb)
+{
+	z_stream zs;
+	clSnapshot_t *snap;
+	void *state;
+	short index;
+	short len;
+	int first, num;
+	int i, n;
+	qboolean ok;
+
+	memset(&zs, 0, sizeof(zs));
+	if (inflateInit(&zs) != Z_OK) {
+		return qfalse;
+	}
+	zs.next_in = rb->data;
+	zs.avail_in = rb->size;
+
+	ok = qfalse;
+
+	// cl
+	if (!CL_RewindInflate(&zs, &cl, offsetof(clientActive_t, snapshots))) {
+		goto done;
+	}
+
+	memset(cl.snapshots, 0, sizeof(cl.snapshots));
+	if (!CL_RewindInflate(&zs, &num, sizeof(num))) {
+		goto done;
+	}
+	snap = &cl.snapshots[0][0];
+	for (i = 0;  i < num;  i++) {
+		if (!CL_RewindInflate(&zs, &index, sizeof(index))) {
+			goto done;
+		}
+		if (index < 0  ||  index >= PACKET_BACKUP * MAX_DEMO_FILES) {
+			goto done;
+		}
+		if (!CL_RewindInflate(&zs, &snap[index], sizeof(clSnapshot_t))) {
+			goto done;
+		}
+	}
+
+	if (!CL_RewindInflate(&zs, cl.entityBaselines, sizeof(cl.entityBaselines))) {
+		goto done;
+	}
+
+	if (!CL_RewindInflate(&zs, &first, sizeof(first))) {
+		goto done;
+	}
+	for (i = first;  i < cl.parseEntitiesNum;  i += n) {
+		n = MAX_PARSE_ENTITIES - (i & (MAX_PARSE_ENTITIES - 1));
+		if (n > cl.parseEntitiesNum - i) {
+			n = cl.parseEntitiesNum - i;
+		}
+		if (!CL_RewindInflate(&zs, &cl.parseEntities[i & (MAX_PARSE_ENTITIES - 1)], n * sizeof(entityState_t))) {
+			goto done;
+		}
+	}
+
+	n = offsetof(clientActive_t, parseEntities) + sizeof(cl.parseEntities);
+	if (!CL_RewindInflate(&zs, (byte *)&cl + n, sizeof(clientActive_t) - n)) {
+		goto done;
+	}
+
+	// clc
+	if (!CL_RewindInflate(&zs, &clc, offsetof(clientConnection_t, serverCommands))) {
+		goto done;
+	}
+
+	for (i = 0;  i < MAX_RELIABLE_COMMANDS;  i++) {
+		if (!CL_RewindInflate(&zs, &len, sizeof(len))) {
+			goto done;
+		}
+		if (len < 0  ||  len >= MAX_STRING_CHARS) {
+			goto done;
+		}
+		if (!CL_RewindInflate(&zs, clc.serverCommands[i], len)) {
+			goto done;
+		}
+		clc.serverCommands[i][len] = '\0';
+	}
+
+	n = offsetof(clientConnection_t, serverCommands) + sizeof(clc.serverCommands);
+	if (!CL_RewindInflate(&zs, (byte *)&clc + n, sizeof(clientConnection_t) - n)) {
+		goto done;
+	}
+
+	// cls
+	if (!CL_RewindInflate(&zs, &cls, offsetof(clientStatic_t, numlocalservers))) {
+		goto done;
+	}
+	n = offsetof(clientStatic_t, pingUpdateSource);
+	if (!CL_RewindInflate(&zs, (byte *)&cls + n, sizeof(clientStatic_t) - n)) {
+		goto done;
+	}
+
+	// extra demo files, the ones without a saved state start over
+	if (!CL_RewindInflate(&zs, &num, sizeof(num))) {
+		goto done;
+	}
+	for (i = 1;  i < di.numDemoFiles;  i++) {
+		n = 0;
+		if (i < num) {
+			if (!CL_RewindInflate(&zs, &n, sizeof(n))  ||  n < 0) {
+				goto done;
+			}
+		}
+
+		if (n > 0) {
+			state = malloc(n);
+			if (!state) {
+				Com_Printf("^1%s couldn't allocate %d bytes\n", __FUNCTION__, n);
+				goto done;
+			}
+			if (!CL_RewindInflate(&zs, state, n)) {
+				free(state);
+				goto done;
+			}
+			if (di.demoFiles[i].valid) {
+				CL_ExtraDemoRestoreState(&di.demoFiles[i], state, n);
+			}
+			free(state);
+		} else if (di.demoFiles[i].valid) {
+			CL_ExtraDemoSeek(&di.demoFiles[i]);
+		}
+	}
+
+	ok = qtrue;
+
+ done:
+	inflateEnd(&zs);
+
+	return ok;
+}
+
+// index of the first backup with a seek point >= seekPoint
+static int CL_RewindBackupIndex (int seekPoint)
+{
+	int lo, hi, mid;
+
+	lo = 0;
+	hi = numRewindBackups;
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (rewindBackups[mid].seekPoint < seekPoint) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+// in bytes
+static int CL_RewindBackupBudget (void)
+{
+	int mb;
+
+	mb = cl_rewindBackupMemory->integer;
+	if (mb > 2047) {
+		mb = 2047;
+	}
+
+	return mb * 1024 * 1024;
+}
+
+// msec between coarse seek points so that they fit in half the budget
+static int CL_CoarseRewindBackupSpacing (void)
+{
+	int averageSize;
+	int count;
+	int spacing;
+
+	if (numRewindBackups > 0) {
+		averageSize = rewindBackupBytes / numRewindBackups;
+	} else {
+		averageSize = REWIND_BACKUP_SIZE_GUESS;
+	}
+
+	count = (CL_RewindBackupBudget() / 2) / (averageSize + 1);
+	if (count < 1) {
+		count = 1;
+	}
+	if (count > MAX_REWIND_BACKUPS / 2) {
+		count = MAX_REWIND_BACKUPS / 2;
+	}
+
+	spacing = (di.lastServerTime - di.firstServerTime) / count;
+	if (spacing < REWIND_BACKUP_SPACING) {
+		spacing = REWIND_BACKUP_SPACING;
+	}
+
+	return spacing;
+}
+
+// the closest coarse backup before index
+static const rewindBackup_t *CL_PrevCoarseRewindBackup (int index)
+{
+	int i;
+
+	for (i = index - 1;  i >= 0;  i--) {
+		if (rewindBackups[i].coarse) {
+			return &rewindBackups[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*
+==================
+CL_RewindBackupWanted
+
+Called before reading each demo message, seekPoint is where the message
+starts.  While fast forwarding only the coarse seek points are made.
+==================
+*/
+qboolean CL_RewindBackupWanted (int seekPoint, qboolean seeking)
+{
+	const rewindBackup_t *prev;
+	int index;
+
+	if (cl_rewindBackupMemory->integer <= 0) {
+		return qfalse;
+	}
+
+	index = CL_RewindBackupIndex(seekPoint);
+	if (index < numRewindBackups  &&  rewindBackups[index].seekPoint == seekPoint) {
+		return qfalse;
+	}
+
+	prev = CL_PrevCoarseRewindBackup(index);
+	if (!prev  ||  cl.snap.serverTime - prev->serverTime >= CL_CoarseRewindBackupSpacing()) {
+		return qtrue;
+	}
+
+	if (seeking) {
+		return qfalse;
+	}
+
+	if (index > 0  &&  cl.snap.serverTime - rewindBackups[index - 1].serverTime < REWIND_BACKUP_SPACING) {
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+static void CL_FreeRewindBackup (int index)
+{
+	rewindBackup_t *rb;
+
+	rb = &rewindBackups[index];
+	rewindBackupBytes -= rb->size;
+	free(rb->data);
+
+	memmove(rb, rb + 1, (numRewindBackups - index - 1) * sizeof(rewindBackup_t));
+	numRewindBackups--;
+}
+
+/*
+==================
+CL_EvictRewindBackup
+
+Drops the least recently used backup, coarse ones only if there's nothing
+else.  The first one, the start of the demo, and keep are never dropped.
+==================
+*/
+static qboolean CL_EvictRewindBackup (const rewindBackup_t *keep)
+{
+	const rewindBackup_t *rb;
+	int best, bestCoarse;
+	int i;
+
+	best = -1;
+	bestCoarse = -1;
+	for (i = 1;  i < numRewindBackups;  i++) {
+		rb = &rewindBackups[i];
+		if (rb == keep) {
+			continue;
+		}
+		if (rb->coarse) {
+			if (bestCoarse < 0  ||  rb->lastUsed < rewindBackups[bestCoarse].lastUsed) {
+				bestCoarse = i;
+			}
+		} else {
+			if (best < 0  ||  rb->lastUsed < rewindBackups[best].lastUsed) {
+				best = i;
+			}
+		}
+	}
+
+	if (best < 0) {
+		best = bestCoarse;
+	}
+	if (best < 0) {
+		return qfalse;
+	}
+
+	CL_FreeRewindBackup(best);
+	return qtrue;
+}
+
+/*
+==================
+CL_AddRewindBackup
+
+Saves the current client state as a seek point.  seekPoint is the demo
+file position of the next message.
+==================
+*/
+void CL_AddRewindBackup (int seekPoint, int numSnaps)
+{
+	rewindBackup_t *rb;
+	const rewindBackup_t *prev;
+	qboolean coarse;
+	int index;
+	int size;
+	byte *data;
+
+	index = CL_RewindBackupIndex(seekPoint);
+	if (index < numRewindBackups  &&  rewindBackups[index].seekPoint == seekPoint) {
+		rewindBackups[index].lastUsed = ++rewindBackupClock;
+		return;
+	}
+
+	prev = CL_PrevCoarseRewindBackup(index);
+	coarse = !prev  ||  cl.snap.serverTime - prev->serverTime >= CL_CoarseRewindBackupSpacing();
+
+	size = CL_DeflateClientState();
+	if (size <= 0) {
+		Com_Printf("^1couldn't compress rewind backup\n");
+		return;
+	}
+	data = malloc(size);
+	if (!data) {
+		Com_Printf("^1couldn't allocate %d bytes for rewind backup\n", size);
+		return;
+	}
+	memcpy(data, rewindBuffer, size);
+
+	if (numRewindBackups >= MAX_REWIND_BACKUPS) {
+		if (!CL_EvictRewindBackup(NULL)) {
+			free(data);
+			return;
+		}
+		index = CL_RewindBackupIndex(seekPoint);
+	}
+
+	rb = &rewindBackups[index];
+	memmove(rb + 1, rb, (numRewindBackups - index) * sizeof(rewindBackup_t));
+	numRewindBackups++;
+
+	rb->serverTime = cl.snap.serverTime;
+	rb->seekPoint = seekPoint;
+	rb->numSnaps = numSnaps;
+	rb->coarse = coarse;
+	rb->lastUsed = ++rewindBackupClock;
+	rb->size = size;
+	rb->data = data;
+	rewindBackupBytes += size;
+
+	while (rewindBackupBytes > CL_RewindBackupBudget()) {
+		// entries move around when one is dropped
+		index = CL_RewindBackupIndex(seekPoint);
+		if (!CL_EvictRewindBackup(&rewindBackups[index])) {
+			break;
+		}
+	}
+}
+
+/*
+==================
+CL_FindRewindBackup
+
+Returns the last backup from before serverTime, or the first one if there
+isn't any.  NULL if there are no backups.
+==================
+*/
+rewindBackup_t *CL_FindRewindBackup (double serverTime)
+{
+	int i;
+
+	if (numRewindBackups == 0) {
+		return NULL;
+	}
+
+	for (i = numRewindBackups - 1;  i > 0;  i--) {
+		if ((double)rewindBackups[i].serverTime < serverTime) {
+			break;
+		}
+	}
+
+	return &rewindBackups[i];
+}
+
+/*
+==================
+CL_RestoreRewindBackup
+
+Overwrites cl, clc and cls with the saved state and puts the extra demo
+files back where they were.  The caller seeks the main demo file.
+==================
+*/
+void CL_RestoreRewindBackup (rewindBackup_t *rb)
+{
+	rb->lastUsed = ++rewindBackupClock;
+
+	if (!CL_InflateClientState(rb)) {
+		Com_Error(ERR_DROP, "%s couldn't decompress rewind backup", __FUNCTION__);
+	}
+}
+
+void CL_ClearRewindBackups (void)
+{
+	int i;
+
+	for (i = 0;  i < numRewindBackups;  i++) {
+		free(rewindBackups[i].data);
+	}
+	numRewindBackups = 0;
+	rewindBackupBytes = 0;
+}
+
+void CL_RewindBackupInfo_f (void)
+{
+	int i;
+	int numCoarse;
+
+	numCoarse = 0;
+	for (i = 0;  i < numRewindBackups;  i++) {
+		if (rewindBackups[i].coarse) {
+			numCoarse++;
+		}
+	}
+
+	Com_Printf("%d rewind backups (%d coarse)  %.2f MB of %d MB\n", numRewindBackups, numCoarse, (float)rewindBackupBytes / 1024.0 / 1024.0, cl_rewindBackupMemory->integer);
+	if (numRewindBackups > 0) {
+		Com_Printf("average %d KB   coarse spacing %d msec\n", rewindBackupBytes / numRewindBackups / 1024, CL_CoarseRewindBackupSpacing());
+	}
+}
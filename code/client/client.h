@@ -117,6 +117,9 @@ typedef struct {
 	char		mapname[MAX_QPATH];	// extracted from CS_SERVERINFO
 
 	int			parseEntitiesNum;	// index (not anded off) into cl_parse_entities[]
+	int			peekSequence;		// bumped for every peeked snapshot, peeks parse past parseEntitiesNum
+	int			peekMessageNum;		// last peeked snapshot
+	int			peekParseEntitiesNum;	// highest parse entity written by a peek
 
 	int			mouseDx[2], mouseDy[2];	// added to by mouse events
 	int			mouseIndex;
@@ -387,6 +390,8 @@ extern	clientStatic_t		cls;
 extern char            cl_oldGame[MAX_QPATH];
 extern qboolean        cl_oldGameSet;
 
+typedef struct extraDemoStream_s extraDemoStream_t;
+
 typedef struct {
 	qboolean valid;
 	int num;
@@ -394,6 +399,7 @@ typedef struct {
 	int serverTime;
 	clSnapshot_t snap;
 	int serverMessageSequence;
+	extraDemoStream_t *stream;  // decoder for the extra demo files
 } demoFile_t;
 
 #define MAX_PLAYER_INFO 256
@@ -420,7 +426,6 @@ typedef struct {
 	int serverFrameTime;
 
 	double wantedTime;
-	int snapCount;
 
 	int demoPos;
 	int snapsInDemo;
@@ -489,20 +494,14 @@ typedef struct {
 extern demoInfo_t di;
 
 typedef struct {
-    qboolean valid;
-    int seekPoint;
-	int demoSeekPoints[MAX_DEMO_FILES];
-    clientActive_t cl;
-    clientConnection_t clc;
-    clientStatic_t cls;
-    int numSnaps;
-} rewindBackups_t;
-
-//FIXME can make dynamic to improve seek performance
-#define MAX_REWIND_BACKUPS 12   // 1000 ~ 175 megabytes, sizeof(rewindBackups_t) is 1.753348 mb
-
-extern rewindBackups_t *rewindBackups;
-extern int maxRewindBackups;
+	int serverTime;  // cl.snap.serverTime
+	int seekPoint;  // demo file position of the next message
+	int numSnaps;
+	qboolean coarse;  // part of the set spread over the whole demo
+	int lastUsed;
+	int size;
+	byte *data;  // deflated cl, clc and cls, see cl_rewind.c
+} rewindBackup_t;
 
 //=============================================================================
 
@@ -562,6 +561,8 @@ extern	cvar_t	*cl_aviCodec;
 extern cvar_t *cl_aviAllowLargeFiles;
 extern cvar_t *cl_aviFetchMode;
 extern cvar_t *cl_aviExtension;
+extern cvar_t *cl_aviWriteThread;
+extern cvar_t *cl_aviWriteBufferSize;
 extern cvar_t *cl_freezeDemoPauseVideoRecording;
 extern cvar_t *cl_freezeDemoPauseMusic;
 
@@ -572,6 +573,7 @@ extern  cvar_t  *cl_downloadMethod;
 extern	cvar_t	*cl_conXOffset;
 extern	cvar_t	*cl_inGameVideo;
 extern cvar_t *cl_cinematicIgnoreSeek;
+extern cvar_t *cl_cinematicThread;
 
 extern	cvar_t	*cl_lanForcePackets;
 extern	cvar_t	*cl_autoRecordDemo;
@@ -609,9 +611,11 @@ extern	cvar_t	*cl_voipOverallGain;
 extern cvar_t	*cl_useq3gibs;
 extern cvar_t	*cl_consoleAsChat;
 extern cvar_t *cl_numberPadInput;
-extern cvar_t *cl_maxRewindBackups;
+extern cvar_t *cl_rewindBackupMemory;
 extern cvar_t *cl_keepDemoFileInMemory;
 extern cvar_t *cl_demoFileCheckSystem;
+extern cvar_t *cl_demoExtraThreads;
+extern cvar_t *cl_demoReadAhead;
 extern cvar_t *cl_demoFile;
 extern cvar_t *cl_demoFileBaseName;
 extern cvar_t *cl_downloadWorkshops;
@@ -689,7 +693,43 @@ void CL_Voip_f( void );
 
 void CL_SystemInfoChanged( void );
 void CL_ParseServerMessage( msg_t *msg );
-void CL_ParseExtraServerMessage (demoFile_t *df, msg_t *msg);
+
+//
+// cl_extrademo.c
+//
+void CL_ExtraDemoOpen (demoFile_t *df);
+void CL_ExtraDemoClose (demoFile_t *df);
+void CL_ExtraDemoSeek (demoFile_t *df);
+const void *CL_ExtraDemoSaveState (demoFile_t *df, int *size);
+qboolean CL_ExtraDemoRestoreState (demoFile_t *df, const void *data, int size);
+void CL_ExtraDemoMerge (demoFile_t *df, int serverTime, int messageNum);
+
+//
+// cl_demoread.c
+//
+void CL_DemoReadStart (fileHandle_t f);
+void CL_DemoReadStop (void);
+int CL_DemoRead (void *buffer, int len);
+int CL_DemoTell (void);
+void CL_DemoSeek (int offset);
+
+//
+// cl_rewind.c
+//
+qboolean CL_RewindBackupWanted (int seekPoint, qboolean seeking);
+void CL_AddRewindBackup (int seekPoint, int numSnaps);
+rewindBackup_t *CL_FindRewindBackup (double serverTime);
+void CL_RestoreRewindBackup (rewindBackup_t *rb);
+void CL_ClearRewindBackups (void);
+void CL_RewindBackupInfo_f (void);
+
+//
+// cl_bench.c
+//
+void CL_BenchDemo_f (void);
+void CL_BenchFrame (void);
+void CL_BenchDemoCompleted (void);
+void CL_BenchDisconnect (void);
 
 //====================================================================
 
@@ -780,6 +820,7 @@ void CL_CGameRendering( stereoFrame_t stereo );
 void CL_SetCGameTime( void );
 void CL_FirstSnapshot( void );
 void CL_ShaderStateChanged(void);
+void CL_InvalidateSnapshotViews (void);
 
 //
 // cl_ui.c
@@ -806,6 +847,8 @@ void CL_TakeVideoFrame (aviFileData_t *afd);
 void CL_WriteAVIVideoFrame (aviFileData_t *afd, const byte *imageBuffer, int size);
 void CL_WriteAVIAudioFrame (aviFileData_t *afd, const byte *pcmBuffer, int size);
 qboolean CL_CloseAVI (aviFileData_t *afd, qboolean us);
+qboolean CL_OpenScaledAVIForWriting (aviFileData_t *afd, const char *fileName, int width, int height, qboolean noSoundAvi);
+void CL_CloseScaledAVIs (void);
 //qboolean CL_VideoRecording (aviFileData_t *afd);
 
 //
@@ -814,6 +857,7 @@ qboolean CL_CloseAVI (aviFileData_t *afd, qboolean us);
 void CL_WriteDemoMessage ( msg_t *msg, int headerBytes );
 
 void CL_ParseSnapshot( msg_t *msg, clSnapshot_t *sn, int serverMessageSequence, qboolean justPeek );
+const clSnapshot_t *CL_PeekedSnapshot (int messageNum);
 void CL_ParseVoipSpeex (msg_t *msg, qboolean checkForFlags, qboolean justPeek);
 void CL_ParseVoip (msg_t *msg, qboolean ignoreData);
 qboolean CL_PeekSnapshot (int snapshotNumber, snapshot_t *snapshot);
@@ -289,7 +289,9 @@ void S_Update( void )
 	}
 
 	if( si.Update ) {
+		Com_ProfileBegin("S_Update");
 		si.Update( );
+		Com_ProfileEnd();
 	}
 }
 
@@ -128,6 +128,7 @@ void S_TransferStereo16 (unsigned long *pbuf, int endtime)
 {
 	int		lpos;
 	int		ls_paintedtime;
+	int		i;
 
 	snd_p = (int *) paintbuffer;
 	ls_paintedtime = s_paintedtime;
@@ -159,6 +160,11 @@ void S_TransferStereo16 (unsigned long *pbuf, int endtime)
 
 		if (CL_VideoRecording(&afdMain)  &&  !(cl_freezeDemoPauseVideoRecording->integer  &&  cl_freezeDemo->integer)) {
 			CL_WriteAVIAudioFrame(&afdMain, (byte *)snd_out, snd_linear_count << 1);
+			for (i = 0;  i < MAX_VIDEO_SCALES;  i++) {
+				if (CL_VideoRecording(&afdScaled[i])) {
+					CL_WriteAVIAudioFrame(&afdScaled[i], (byte *)snd_out, snd_linear_count << 1);
+				}
+			}
 		}
 	}
 }
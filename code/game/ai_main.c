@@ -1644,6 +1644,9 @@ int BotInitLibrary(void) {
 	//
 	trap_Cvar_VariableStringBuffer("bot_saveroutingcache", buf, sizeof(buf));
 	if (strlen(buf)) trap_BotLibVarSet("saveroutingcache", buf);
+	//precompute the routing cache when the map is loaded
+	trap_Cvar_VariableStringBuffer("bot_buildroutecache", buf, sizeof(buf));
+	if (strlen(buf)) trap_BotLibVarSet("buildroutecache", buf);
 	//reload instead of cache bot character files
 	trap_Cvar_VariableStringBuffer("bot_reloadcharacters", buf, sizeof(buf));
 	if (!strlen(buf)) strcpy(buf, "0");
@@ -52,7 +52,7 @@ void SetPlaneSignbits (cplane_t *out) {
 
 
 clipMap_t	cm;
-int			c_pointcontents;
+Q_THREAD_LOCAL int	c_pointcontents;
 int			c_traces, c_brush_traces, c_patch_traces;
 
 
@@ -62,6 +62,7 @@ byte		*cmod_base;
 cvar_t		*cm_noAreas;
 cvar_t		*cm_noCurves;
 cvar_t		*cm_playerCurveClip;
+cvar_t		*cm_debugSurfaceUpdate;
 #endif
 
 cmodel_t	box_model;
@@ -595,6 +596,8 @@ void CM_LoadMap( const char *name, qboolean clientload, int *checksum ) {
 	cm_noAreas = Cvar_Get ("cm_noAreas", "0", CVAR_CHEAT);
 	cm_noCurves = Cvar_Get ("cm_noCurves", "0", CVAR_CHEAT);
 	cm_playerCurveClip = Cvar_Get ("cm_playerCurveClip", "1", CVAR_ARCHIVE|CVAR_CHEAT );
+	// registered here since traces can run off the main thread
+	cm_debugSurfaceUpdate = Cvar_Get( "r_debugSurfaceUpdate", "1", 0 );
 #endif
 	Com_DPrintf( "CM_LoadMap( %s, %i )\n", name, clientload );
 
@@ -693,6 +696,11 @@ void CM_LoadMap( const char *name, qboolean clientload, int *checksum ) {
 
 	CM_InitBoxHull ();
 
+	cm.context.numBrushes = cm.numBrushes + BOX_BRUSHES;
+	cm.context.brushMarks = Hunk_Alloc( cm.context.numBrushes * sizeof( *cm.context.brushMarks ), h_high );
+	cm.context.numSurfaces = cm.numSurfaces;
+	cm.context.surfaceMarks = Hunk_Alloc( cm.context.numSurfaces * sizeof( *cm.context.surfaceMarks ), h_high );
+
 	CM_FloodAreaConnections ();
 
 	// allow this to be cached if it is loaded by the server
@@ -62,12 +62,10 @@ typedef struct {
 	vec3_t		bounds[2];
 	int			numsides;
 	cbrushside_t	*sides;
-	int			checkcount;		// to avoid repeated testings
 } cbrush_t;
 
 
 typedef struct {
-	int			checkcount;				// to avoid repeated testings
 	int			surfaceFlags;
 	int			contents;
 	//int shaderNum;
@@ -80,6 +78,17 @@ typedef struct {
 	int			floodvalid;
 } cArea_t;
 
+// Brushes and patches can be reached from several leafs, so each query
+// marks what it already tested.  Marks hold the generation of the query
+// that set them, starting a new query only bumps the generation.
+struct cmTraceContext_s {
+	unsigned int	generation;
+	int				numBrushes;		// including the box brush
+	unsigned int	*brushMarks;
+	int				numSurfaces;
+	unsigned int	*surfaceMarks;
+};
+
 typedef struct {
 	char		name[MAX_QPATH];
 
@@ -126,7 +135,7 @@ typedef struct {
 	cPatch_t	**surfaces;			// non-patches will be NULL
 
 	int			floodvalid;
-	int			checkcount;					// incremented on each trace
+	cmTraceContext_t	context;	// used by the non reentrant queries
 } clipMap_t;
 
 
@@ -135,11 +144,40 @@ typedef struct {
 #define	SURFACE_CLIP_EPSILON	(0.125)
 
 extern	clipMap_t	cm;
-extern	int			c_pointcontents;
 extern	int			c_traces, c_brush_traces, c_patch_traces;
 extern	cvar_t		*cm_noAreas;
 extern	cvar_t		*cm_noCurves;
 extern	cvar_t		*cm_playerCurveClip;
+extern	cvar_t		*cm_debugSurfaceUpdate;
+
+// cm_trace.c
+
+void CM_BeginQuery( cmTraceContext_t *ctx );
+
+// returns qtrue if the brush or patch was already tested by this query.
+// Indices past the end belong to a context made for another map, those
+// are just tested again.
+static ID_INLINE qboolean CM_CheckBrushMark( cmTraceContext_t *ctx, int brushnum ) {
+	if ( (unsigned)brushnum >= (unsigned)ctx->numBrushes ) {
+		return qfalse;
+	}
+	if ( ctx->brushMarks[brushnum] == ctx->generation ) {
+		return qtrue;
+	}
+	ctx->brushMarks[brushnum] = ctx->generation;
+	return qfalse;
+}
+
+static ID_INLINE qboolean CM_CheckSurfaceMark( cmTraceContext_t *ctx, int surfnum ) {
+	if ( (unsigned)surfnum >= (unsigned)ctx->numSurfaces ) {
+		return qfalse;
+	}
+	if ( ctx->surfaceMarks[surfnum] == ctx->generation ) {
+		return qtrue;
+	}
+	ctx->surfaceMarks[surfnum] = ctx->generation;
+	return qfalse;
+}
 
 // cm_test.c
 
@@ -165,6 +203,8 @@ typedef struct {
 	qboolean	isPoint;	// optimized case
 	trace_t		trace;		// returned from trace call
 	sphere_t	sphere;		// sphere for oriendted capsule collision
+	cmTraceContext_t	*context;	// visit marks for this trace
+	const struct traceGroup_s	*group;	// world brushes shared by a batch, NULL walks the tree
 } traceWork_t;
 
 typedef struct leafList_s {
@@ -175,6 +215,7 @@ typedef struct leafList_s {
 	vec3_t	bounds[2];
 	int		lastLeaf;		// for overflows where each leaf can't be stored individually
 	void	(*storeLeafs)( struct leafList_s *ll, int nodenum );
+	cmTraceContext_t	*context;	// only used by CM_StoreBrushes
 } leafList_t;
 
 
@@ -22,6 +22,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "qfiles.h"
 
+// for com_showtrace, point tests also run on the server's snapshot threads
+// so each thread counts its own
+extern Q_THREAD_LOCAL int c_pointcontents;
+
 void		CM_LoadMap( const char *name, qboolean clientload, int *checksum);
 void		CM_ClearMap( void );
 clipHandle_t CM_InlineModel( int index );		// 0 = world, 1 + are bmodels
@@ -45,6 +49,33 @@ void		CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t
 						  clipHandle_t model, int brushmask,
 						  const vec3_t origin, const vec3_t angles, int capsule );
 
+// numTraces traces at once.  mins and maxs are NULL for points or hold one
+// box per trace.  World traces that are close together share the leaf and
+// brush gathering.
+void		CM_TraceBatch( trace_t *results, const vec3_t *starts, const vec3_t *ends,
+						  const vec3_t *mins, const vec3_t *maxs, int numTraces,
+						  clipHandle_t model, int brushmask, int capsule );
+
+// Reentrant traces.  Every thread that traces while others do needs its
+// own context, created and freed on the main thread.  A context made for
+// an earlier map still gives correct results, only slower.  The point
+// contents and leaf queries don't need one.  CM_TempBoxModel() handles
+// share global state and stay main thread only.
+typedef struct cmTraceContext_s cmTraceContext_t;
+
+cmTraceContext_t *CM_CreateTraceContext( void );
+void		CM_FreeTraceContext( cmTraceContext_t *ctx );
+void		CM_BoxTraceContext( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end,
+						  vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, int brushmask, int capsule );
+void		CM_TransformedBoxTraceContext( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end,
+						  vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, int brushmask,
+						  const vec3_t origin, const vec3_t angles, int capsule );
+void		CM_TraceBatchContext( cmTraceContext_t *ctx, trace_t *results, const vec3_t *starts, const vec3_t *ends,
+						  const vec3_t *mins, const vec3_t *maxs, int numTraces,
+						  clipHandle_t model, int brushmask, int capsule );
+
 byte		*CM_ClusterPVS (int cluster);
 
 int			CM_PointLeafnum( const vec3_t p );
@@ -102,11 +102,10 @@ void CM_StoreBrushes( leafList_t *ll, int nodenum ) {
 
 	for ( k = 0 ; k < leaf->numLeafBrushes ; k++ ) {
 		brushnum = cm.leafbrushes[leaf->firstLeafBrush+k];
-		b = &cm.brushes[brushnum];
-		if ( b->checkcount == cm.checkcount ) {
+		if ( CM_CheckBrushMark( ll->context, brushnum ) ) {
 			continue;	// already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		b = &cm.brushes[brushnum];
 		for ( i = 0 ; i < 3 ; i++ ) {
 			if ( b->bounds[0][i] >= ll->bounds[1][i] || b->bounds[1][i] <= ll->bounds[0][i] ) {
 				break;
@@ -175,7 +174,6 @@ int	CM_BoxLeafnums( const vec3_t mins, const vec3_t maxs, int *list, int listsiz
 	leafList_t	ll;
 
 	memset(&ll, 0, sizeof(ll));
-	cm.checkcount++;
 
 	VectorCopy( mins, ll.bounds[0] );
 	VectorCopy( maxs, ll.bounds[1] );
@@ -201,7 +199,7 @@ int CM_BoxBrushes( const vec3_t mins, const vec3_t maxs, cbrush_t **list, int li
 	leafList_t	ll;
 
 	memset(&ll, 0, sizeof(ll));
-	cm.checkcount++;
+	CM_BeginQuery( &cm.context );
 
 	VectorCopy( mins, ll.bounds[0] );
 	VectorCopy( maxs, ll.bounds[1] );
@@ -209,6 +207,7 @@ int CM_BoxBrushes( const vec3_t mins, const vec3_t maxs, cbrush_t **list, int li
 	ll.maxcount = listsize;
 	ll.list = (void *)list;
 	ll.storeLeafs = CM_StoreBrushes;
+	ll.context = &cm.context;
 	ll.lastLeaf = 0;
 	ll.overflowed = qfalse;
 	
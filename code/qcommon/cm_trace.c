@@ -231,17 +231,17 @@ CM_TestInLeaf
 void CM_TestInLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	int			k;
 	int			brushnum;
+	int			surfnum;
 	cbrush_t	*b;
 	cPatch_t	*patch;
 
 	// test box position against all brushes in the leaf
 	for (k=0 ; k<leaf->numLeafBrushes ; k++) {
 		brushnum = cm.leafbrushes[leaf->firstLeafBrush+k];
-		b = &cm.brushes[brushnum];
-		if (b->checkcount == cm.checkcount) {
+		if ( CM_CheckBrushMark( tw->context, brushnum ) ) {
 			continue;	// already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		b = &cm.brushes[brushnum];
 
 		if ( !(b->contents & tw->contents)) {
 			continue;
@@ -261,14 +261,14 @@ void CM_TestInLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	if ( !cm_noCurves->integer ) {
 #endif //BSPC
 		for ( k = 0 ; k < leaf->numLeafSurfaces ; k++ ) {
-			patch = cm.surfaces[ cm.leafsurfaces[ leaf->firstLeafSurface + k ] ];
+			surfnum = cm.leafsurfaces[ leaf->firstLeafSurface + k ];
+			patch = cm.surfaces[ surfnum ];
 			if ( !patch ) {
 				continue;
 			}
-			if ( patch->checkcount == cm.checkcount ) {
+			if ( CM_CheckSurfaceMark( tw->context, surfnum ) ) {
 				continue;	// already checked this brush in another leaf
 			}
-			patch->checkcount = cm.checkcount;
 
 			if ( !(patch->contents & tw->contents)) {
 				continue;
@@ -418,13 +418,12 @@ void CM_PositionTest( traceWork_t *tw ) {
 	ll.storeLeafs = CM_StoreLeafs;
 	ll.lastLeaf = 0;
 	ll.overflowed = qfalse;
-
-	cm.checkcount++;
+	ll.context = tw->context;
 
 	CM_BoxLeafnums_r( &ll, 0 );
 
 
-	cm.checkcount++;
+	CM_BeginQuery( tw->context );
 
 	// test the contents of the leafs
 	for (i=0 ; i < ll.count ; i++) {
@@ -453,7 +452,9 @@ CM_TraceThroughPatch
 void CM_TraceThroughPatch( traceWork_t *tw, cPatch_t *patch ) {
 	float		oldFrac;
 
-	c_patch_traces++;
+	if ( tw->context == &cm.context ) {
+		c_patch_traces++;
+	}
 
 	oldFrac = tw->trace.fraction;
 
@@ -494,7 +495,9 @@ void CM_TraceThroughBrush( traceWork_t *tw, cbrush_t *brush ) {
 		return;
 	}
 
-	c_brush_traces++;
+	if ( tw->context == &cm.context ) {
+		c_brush_traces++;
+	}
 
 	getout = qfalse;
 	startout = qfalse;
@@ -679,6 +682,7 @@ CM_TraceThroughLeaf
 void CM_TraceThroughLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	int			k;
 	int			brushnum;
+	int			surfnum;
 	cbrush_t	*b;
 	cPatch_t	*patch;
 
@@ -686,11 +690,10 @@ void CM_TraceThroughLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	for ( k = 0 ; k < leaf->numLeafBrushes ; k++ ) {
 		brushnum = cm.leafbrushes[leaf->firstLeafBrush+k];
 
-		b = &cm.brushes[brushnum];
-		if ( b->checkcount == cm.checkcount ) {
+		if ( CM_CheckBrushMark( tw->context, brushnum ) ) {
 			continue;	// already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		b = &cm.brushes[brushnum];
 
 		if ( !(b->contents & tw->contents) ) {
 			continue;
@@ -715,14 +718,14 @@ void CM_TraceThroughLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	if ( !cm_noCurves->integer ) {
 #endif
 		for ( k = 0 ; k < leaf->numLeafSurfaces ; k++ ) {
-			patch = cm.surfaces[ cm.leafsurfaces[ leaf->firstLeafSurface + k ] ];
+			surfnum = cm.leafsurfaces[ leaf->firstLeafSurface + k ];
+			patch = cm.surfaces[ surfnum ];
 			if ( !patch ) {
 				continue;
 			}
-			if ( patch->checkcount == cm.checkcount ) {
+			if ( CM_CheckSurfaceMark( tw->context, surfnum ) ) {
 				continue;	// already checked this patch in another leaf
 			}
-			patch->checkcount = cm.checkcount;
 
 			if ( !(patch->contents & tw->contents) ) {
 				continue;
@@ -1160,13 +1163,195 @@ void CM_TraceThroughTree( traceWork_t *tw, int num, float p1f, float p2f, vec3_t
 //======================================================================
 
 
+/*
+===============================================================================
+
+BATCHED TRACES
+
+Traces of a batch that are close together gather the world brushes and
+patches around all of them once.  Each trace then only tests that list
+instead of walking the bsp tree.
+
+===============================================================================
+*/
+
+#define	MAX_GROUP_TRACES	64
+#define	MAX_GROUP_SIZE		256		// largest edge of the box around a group
+#define	MAX_GROUP_BRUSHES	1024
+#define	MAX_GROUP_SURFACES	256
+
+typedef struct traceGroup_s {
+	leafList_t	ll;			// must be first, CM_StoreGroupLeaf gets this back
+	int			contents;
+	qboolean	overflowed;
+	int			numBrushes;
+	int			brushes[MAX_GROUP_BRUSHES];
+	int			numSurfaces;
+	int			surfaces[MAX_GROUP_SURFACES];
+} traceGroup_t;
+
+/*
+================
+CM_StoreGroupLeaf
+================
+*/
+static void CM_StoreGroupLeaf( leafList_t *ll, int nodenum ) {
+	traceGroup_t	*group;
+	cLeaf_t			*leaf;
+	cbrush_t		*b;
+	cPatch_t		*patch;
+	int				brushnum;
+	int				surfnum;
+	int				k;
+
+	group = (traceGroup_t *)ll;
+	if ( group->overflowed ) {
+		return;
+	}
+	leaf = &cm.leafs[-1 - nodenum];
+
+	for ( k = 0 ; k < leaf->numLeafBrushes ; k++ ) {
+		brushnum = cm.leafbrushes[leaf->firstLeafBrush + k];
+		if ( CM_CheckBrushMark( ll->context, brushnum ) ) {
+			continue;
+		}
+		b = &cm.brushes[brushnum];
+		if ( !(b->contents & group->contents) ) {
+			continue;
+		}
+		if ( !CM_BoundsIntersect( ll->bounds[0], ll->bounds[1], b->bounds[0], b->bounds[1] ) ) {
+			continue;
+		}
+		if ( group->numBrushes >= MAX_GROUP_BRUSHES ) {
+			group->overflowed = qtrue;
+			return;
+		}
+		group->brushes[group->numBrushes++] = brushnum;
+	}
+
+	for ( k = 0 ; k < leaf->numLeafSurfaces ; k++ ) {
+		surfnum = cm.leafsurfaces[leaf->firstLeafSurface + k];
+		patch = cm.surfaces[surfnum];
+		if ( !patch ) {
+			continue;
+		}
+		if ( CM_CheckSurfaceMark( ll->context, surfnum ) ) {
+			continue;
+		}
+		if ( !(patch->contents & group->contents) ) {
+			continue;
+		}
+		if ( group->numSurfaces >= MAX_GROUP_SURFACES ) {
+			group->overflowed = qtrue;
+			return;
+		}
+		group->surfaces[group->numSurfaces++] = surfnum;
+	}
+}
+
+/*
+================
+CM_TraceThroughGroup
+
+Same tests as CM_TraceThroughLeaf() for the brushes of every leaf the
+trace could touch
+================
+*/
+static void CM_TraceThroughGroup( traceWork_t *tw ) {
+	const traceGroup_t	*group;
+	cbrush_t	*b;
+	int			k;
+
+	group = tw->group;
+
+	for ( k = 0 ; k < group->numBrushes ; k++ ) {
+		b = &cm.brushes[group->brushes[k]];
+		if ( !(b->contents & tw->contents) ) {
+			continue;
+		}
+		if ( !CM_BoundsIntersect( tw->bounds[0], tw->bounds[1], b->bounds[0], b->bounds[1] ) ) {
+			continue;
+		}
+
+		CM_TraceThroughBrush( tw, b );
+		if ( !tw->trace.fraction ) {
+			return;
+		}
+	}
+
+#ifdef BSPC
+	if (1) {
+#else
+	if ( !cm_noCurves->integer ) {
+#endif
+		for ( k = 0 ; k < group->numSurfaces ; k++ ) {
+			if ( !(cm.surfaces[group->surfaces[k]]->contents & tw->contents) ) {
+				continue;
+			}
+
+			CM_TraceThroughPatch( tw, cm.surfaces[group->surfaces[k]] );
+			if ( !tw->trace.fraction ) {
+				return;
+			}
+		}
+	}
+}
+
+/*
+================
+CM_TestInGroup
+
+Position test version of CM_TraceThroughGroup()
+================
+*/
+static void CM_TestInGroup( traceWork_t *tw ) {
+	const traceGroup_t	*group;
+	cbrush_t	*b;
+	cPatch_t	*patch;
+	int			k;
+
+	group = tw->group;
+
+	for ( k = 0 ; k < group->numBrushes ; k++ ) {
+		b = &cm.brushes[group->brushes[k]];
+		if ( !(b->contents & tw->contents) ) {
+			continue;
+		}
+
+		CM_TestBoxInBrush( tw, b );
+		if ( tw->trace.allsolid ) {
+			return;
+		}
+	}
+
+#ifdef BSPC
+	if (1) {
+#else
+	if ( !cm_noCurves->integer ) {
+#endif
+		for ( k = 0 ; k < group->numSurfaces ; k++ ) {
+			patch = cm.surfaces[group->surfaces[k]];
+			if ( !(patch->contents & tw->contents) ) {
+				continue;
+			}
+
+			if ( CM_PositionTestInPatchCollide( tw, patch->pc ) ) {
+				tw->trace.startsolid = tw->trace.allsolid = qtrue;
+				tw->trace.fraction = 0;
+				tw->trace.contents = patch->contents;
+				return;
+			}
+		}
+	}
+}
+
 /*
 ==================
 CM_Trace
 ==================
 */
-void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mins, vec3_t maxs,
-						  clipHandle_t model, const vec3_t origin, int brushmask, int capsule, sphere_t *sphere ) {
+static void CM_Trace( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end, vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, const vec3_t origin, int brushmask, int capsule, sphere_t *sphere, const traceGroup_t *group ) {
 	int			i;
 	traceWork_t	tw;
 	vec3_t		offset;
@@ -1175,13 +1360,19 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mi
 	//Com_Printf("^3CM_Trace()\n");
 	cmod = CM_ClipHandleToModel( model );
 
-	cm.checkcount++;		// for multi-check avoidance
+	CM_BeginQuery( ctx );	// for multi-check avoidance
 
-	c_traces++;				// for statistics, may be zeroed
+	// for statistics, may be zeroed.  Only the main thread's traces
+	// count, the ones with their own context can run on other threads
+	if ( ctx == &cm.context ) {
+		c_traces++;
+	}
 
 	// fill in a default trace
 	Com_Memset( &tw, 0, sizeof(tw) );
 	tw.trace.fraction = 1;	// assume it goes the entire distance until shown otherwise
+	tw.context = ctx;
+	tw.group = group;
 	VectorCopy(origin, tw.modelOrigin);
 
 	if (!cm.numNodes) {
@@ -1312,6 +1503,8 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mi
 			else {
 				CM_TestInLeaf( &tw, &cmod->leaf );
 			}
+		} else if ( tw.group ) {
+			CM_TestInGroup( &tw );
 		} else {
 			CM_PositionTest( &tw );
 		}
@@ -1356,6 +1549,8 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mi
 			else {
 				CM_TraceThroughLeaf( &tw, &cmod->leaf );
 			}
+		} else if ( tw.group ) {
+			CM_TraceThroughGroup( &tw );
 		} else {
 			CM_TraceThroughTree( &tw, 0, 0, 1, tw.start, tw.end );
 		}
@@ -1379,6 +1574,17 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mi
 	*results = tw.trace;
 }
 
+/*
+==================
+CM_BoxTraceContext
+==================
+*/
+void CM_BoxTraceContext( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end,
+						  vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, int brushmask, int capsule ) {
+	CM_Trace( ctx, results, start, end, mins, maxs, model, vec3_origin, brushmask, capsule, NULL, NULL );
+}
+
 /*
 ==================
 CM_BoxTrace
@@ -1387,18 +1593,18 @@ CM_BoxTrace
 void CM_BoxTrace( trace_t *results, const vec3_t start, const vec3_t end,
 						  vec3_t mins, vec3_t maxs,
 						  clipHandle_t model, int brushmask, int capsule ) {
-	CM_Trace( results, start, end, mins, maxs, model, vec3_origin, brushmask, capsule, NULL );
+	CM_Trace( &cm.context, results, start, end, mins, maxs, model, vec3_origin, brushmask, capsule, NULL, NULL );
 }
 
 /*
 ==================
-CM_TransformedBoxTrace
+CM_TransformedBoxTraceContext
 
 Handles offseting and rotation of the end points for moving and
 rotating entities
 ==================
 */
-void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t end,
+void CM_TransformedBoxTraceContext( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end,
 						  vec3_t mins, vec3_t maxs,
 						  clipHandle_t model, int brushmask,
 						  const vec3_t origin, const vec3_t angles, int capsule ) {
@@ -1472,7 +1678,7 @@ void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t
 	}
 
 	// sweep the box through the model
-	CM_Trace( &trace, start_l, end_l, symetricSize[0], symetricSize[1], model, origin, brushmask, capsule, &sphere );
+	CM_Trace( ctx, &trace, start_l, end_l, symetricSize[0], symetricSize[1], model, origin, brushmask, capsule, &sphere, NULL );
 
 	// if the bmodel was rotated and there was a collision
 	if ( rotated && trace.fraction != 1.0 ) {
@@ -1489,3 +1695,183 @@ void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t
 
 	*results = trace;
 }
+
+/*
+==================
+CM_TransformedBoxTrace
+==================
+*/
+void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t end,
+						  vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, int brushmask,
+						  const vec3_t origin, const vec3_t angles, int capsule ) {
+	CM_TransformedBoxTraceContext( &cm.context, results, start, end, mins, maxs, model, brushmask, origin, angles, capsule );
+}
+
+/*
+==================
+CM_TraceBounds
+
+Box swept by one trace of a batch, the same as traceWork_t bounds
+==================
+*/
+static void CM_TraceBounds( const vec3_t start, const vec3_t end, const float *mins, const float *maxs, vec3_t bounds[2] ) {
+	int		i;
+
+	for ( i = 0 ; i < 3 ; i++ ) {
+		if ( start[i] < end[i] ) {
+			bounds[0][i] = start[i];
+			bounds[1][i] = end[i];
+		} else {
+			bounds[0][i] = end[i];
+			bounds[1][i] = start[i];
+		}
+		if ( mins ) {
+			bounds[0][i] += mins[i];
+			bounds[1][i] += maxs[i];
+		}
+	}
+}
+
+/*
+==================
+CM_TraceBatchContext
+==================
+*/
+void CM_TraceBatchContext( cmTraceContext_t *ctx, trace_t *results, const vec3_t *starts, const vec3_t *ends,
+						  const vec3_t *mins, const vec3_t *maxs, int numTraces,
+						  clipHandle_t model, int brushmask, int capsule ) {
+	traceGroup_t	group;
+	vec3_t		bounds[2], groupBounds[2];
+	int			first, count;
+	int			i, j;
+
+	if ( !mins  ||  !maxs ) {
+		mins = maxs = NULL;
+	}
+
+	first = 0;
+	while ( first < numTraces ) {
+		// inline models only have a single leaf, nothing to share
+		if ( model  ||  !cm.numNodes ) {
+			CM_Trace( ctx, &results[first], starts[first], ends[first], mins ? (float *)mins[first] : NULL, maxs ? (float *)maxs[first] : NULL, model, vec3_origin, brushmask, capsule, NULL, NULL );
+			first++;
+			continue;
+		}
+
+		// grow the group while it stays small
+		CM_TraceBounds( starts[first], ends[first], mins ? mins[first] : NULL, maxs ? maxs[first] : NULL, groupBounds );
+		for ( count = 1 ; first + count < numTraces  &&  count < MAX_GROUP_TRACES ; count++ ) {
+			CM_TraceBounds( starts[first + count], ends[first + count], mins ? mins[first + count] : NULL, maxs ? maxs[first + count] : NULL, bounds );
+			for ( j = 0 ; j < 3 ; j++ ) {
+				if ( ( bounds[1][j] > groupBounds[1][j] ? bounds[1][j] : groupBounds[1][j] )
+					- ( bounds[0][j] < groupBounds[0][j] ? bounds[0][j] : groupBounds[0][j] ) > MAX_GROUP_SIZE ) {
+					break;
+				}
+			}
+			if ( j != 3 ) {
+				break;
+			}
+			AddPointToBounds( bounds[0], groupBounds[0], groupBounds[1] );
+			AddPointToBounds( bounds[1], groupBounds[0], groupBounds[1] );
+		}
+
+		if ( count == 1 ) {
+			CM_Trace( ctx, &results[first], starts[first], ends[first], mins ? (float *)mins[first] : NULL, maxs ? (float *)maxs[first] : NULL, model, vec3_origin, brushmask, capsule, NULL, NULL );
+			first++;
+			continue;
+		}
+
+		// same margin as CM_PositionTest()
+		Com_Memset( &group.ll, 0, sizeof( group.ll ) );
+		for ( j = 0 ; j < 3 ; j++ ) {
+			group.ll.bounds[0][j] = groupBounds[0][j] - 1;
+			group.ll.bounds[1][j] = groupBounds[1][j] + 1;
+		}
+		group.ll.storeLeafs = CM_StoreGroupLeaf;
+		group.ll.context = ctx;
+		group.contents = brushmask;
+		group.overflowed = qfalse;
+		group.numBrushes = 0;
+		group.numSurfaces = 0;
+
+		CM_BeginQuery( ctx );
+		CM_BoxLeafnums_r( &group.ll, 0 );
+
+		for ( i = first ; i < first + count ; i++ ) {
+			CM_Trace( ctx, &results[i], starts[i], ends[i], mins ? (float *)mins[i] : NULL, maxs ? (float *)maxs[i] : NULL, model, vec3_origin, brushmask, capsule, NULL, group.overflowed ? NULL : &group );
+		}
+
+		first += count;
+	}
+}
+
+/*
+==================
+CM_TraceBatch
+==================
+*/
+void CM_TraceBatch( trace_t *results, const vec3_t *starts, const vec3_t *ends,
+						  const vec3_t *mins, const vec3_t *maxs, int numTraces,
+						  clipHandle_t model, int brushmask, int capsule ) {
+	CM_TraceBatchContext( &cm.context, results, starts, ends, mins, maxs, numTraces, model, brushmask, capsule );
+}
+
+//======================================================================
+
+/*
+==================
+CM_BeginQuery
+
+Starts a new set of brush and patch marks
+==================
+*/
+void CM_BeginQuery( cmTraceContext_t *ctx ) {
+	ctx->generation++;
+	if ( !ctx->generation ) {
+		// wrapped, old marks could match again
+		if ( ctx->brushMarks ) {
+			Com_Memset( ctx->brushMarks, 0, ctx->numBrushes * sizeof( *ctx->brushMarks ) );
+		}
+		if ( ctx->surfaceMarks ) {
+			Com_Memset( ctx->surfaceMarks, 0, ctx->numSurfaces * sizeof( *ctx->surfaceMarks ) );
+		}
+		ctx->generation = 1;
+	}
+}
+
+/*
+==================
+CM_CreateTraceContext
+
+Sized for the currently loaded map
+==================
+*/
+cmTraceContext_t *CM_CreateTraceContext( void ) {
+	cmTraceContext_t *ctx;
+	int numBrushes;
+	int numSurfaces;
+
+	numBrushes = cm.context.numBrushes;
+	numSurfaces = cm.context.numSurfaces;
+
+	ctx = Z_Malloc( sizeof( *ctx ) + ( numBrushes + numSurfaces ) * sizeof( unsigned int ) );
+	ctx->generation = 0;
+	ctx->numBrushes = numBrushes;
+	ctx->brushMarks = (unsigned int *)( ctx + 1 );
+	ctx->numSurfaces = numSurfaces;
+	ctx->surfaceMarks = ctx->brushMarks + numBrushes;
+
+	return ctx;
+}
+
+/*
+==================
+CM_FreeTraceContext
+==================
+*/
+void CM_FreeTraceContext( cmTraceContext_t *ctx ) {
+	if ( ctx ) {
+		Z_Free( ctx );
+	}
+}
@@ -840,6 +840,44 @@ int Com_FilterPath(char *filter, char *name, int casesensitive)
 	return Com_Filter(new_filter, new_name, casesensitive);
 }
 
+/*
+============
+Com_EscapeJSON
+
+Copies in as the contents of a JSON string, quotes, backslashes and
+control characters are escaped.  Cut short at a whole character if it
+doesn't fit.  Returns out.
+============
+*/
+char *Com_EscapeJSON (char *out, int outSize, const char *in)
+{
+	char escaped[8];
+	int len;
+	int n;
+
+	len = 0;
+	for ( ;  *in;  in++) {
+		if (*in == '"'  ||  *in == '\\') {
+			Com_sprintf(escaped, sizeof(escaped), "\\%c", *in);
+		} else if ((unsigned char)*in < ' ') {
+			Com_sprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned char)*in);
+		} else {
+			escaped[0] = *in;
+			escaped[1] = '\0';
+		}
+
+		n = strlen(escaped);
+		if (len + n >= outSize) {
+			break;
+		}
+		memcpy(out + len, escaped, n);
+		len += n;
+	}
+	out[len] = '\0';
+
+	return out;
+}
+
 /*
 ================
 Com_RealTime
@@ -2992,6 +3030,7 @@ void Com_Init( char *commandLine ) {
 	Cmd_AddCommand ("writeconfig", Com_WriteConfig_f );
 	Cmd_SetCommandCompletionFunc( "writeconfig", Cmd_CompleteCfgName );
 	Cmd_AddCommand("game_restart", Com_GameRestart_f);
+	Com_ProfileInit();
 
 	Com_ExecuteCfg();
 
@@ -3421,6 +3460,9 @@ void Com_Frame( void ) {
 		return;			// an ERR_DROP was thrown
 	}
 
+	Com_ProfileFrame();
+	FS_PrefetchFrame();
+
 	timeBeforeFirstEvents =0;
 	timeBeforeServer =0;
 	timeBeforeEvents =0;
@@ -3556,7 +3598,9 @@ void Com_Frame( void ) {
 		timeBeforeServer = Sys_Milliseconds ();
 	}
 
+	Com_ProfileBegin("SV_Frame");
 	SV_Frame( msec, fmsec );
+	Com_ProfileEnd();
 
 	// if "dedicated" has been modified, start up
 	// or shut down the client system.
@@ -3594,7 +3638,9 @@ void Com_Frame( void ) {
 		timeBeforeClient = Sys_Milliseconds ();
 	}
 
+	Com_ProfileBegin("CL_Frame");
 	CL_Frame( msec, fmsec );
+	Com_ProfileEnd();
 
 	if ( com_speeds->integer ) {
 		timeAfter = Sys_Milliseconds ();
@@ -3633,7 +3679,6 @@ void Com_Frame( void ) {
 	if ( com_showtrace->integer ) {
 
 		extern	int c_traces, c_brush_traces, c_patch_traces;
-		extern	int	c_pointcontents;
 
 		Com_Printf ("%4i traces  (%ib %ip) %4i points\n", c_traces,
 			c_brush_traces, c_patch_traces, c_pointcontents);
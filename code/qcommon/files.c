@@ -294,6 +294,7 @@ typedef struct {
 	int			zipFilePos;
 	int			zipFileLen;
 	qboolean	zipFile;
+	const char	*pakFilename;	// pak the zip file is in
 	char		name[MAX_ZPATH];
 	qboolean memoryMapped;
 	long mapPos;
@@ -426,6 +427,39 @@ FILE	*FS_FileForHandle( fileHandle_t f ) {
 	return fsh[f].handleFiles.file.o;
 }
 
+/*
+=================
+FS_StdioFileForHandle
+
+The FILE a file is read from, NULL if it's in a pk3 or was loaded with
+FS_FileLoadInMemory().
+=================
+*/
+FILE *FS_StdioFileForHandle( fileHandle_t f ) {
+	if ( f < 1 || f >= MAX_FILE_HANDLES || fsh[f].zipFile || fsh[f].memoryMapped ) {
+		return NULL;
+	}
+
+	return fsh[f].handleFiles.file.o;
+}
+
+/*
+=================
+FS_FileMemoryData
+
+The data of a file loaded with FS_FileLoadInMemory(), NULL otherwise.
+=================
+*/
+const byte *FS_FileMemoryData( fileHandle_t f, int *size ) {
+	if ( f < 1 || f >= MAX_FILE_HANDLES || !fsh[f].memoryMapped ) {
+		*size = 0;
+		return NULL;
+	}
+
+	*size = fsh[f].mapSize;
+	return (const byte *)fsh[f].mapData;
+}
+
 void	FS_ForceFlush( fileHandle_t f ) {
 	FILE *file;
 
@@ -1361,6 +1395,7 @@ long FS_FOpenFileReadDir(const char *filename, searchpath_t *search, fileHandle_
 
 					Q_strncpyz(fsh[*file].name, filename, sizeof(fsh[*file].name));
 					fsh[*file].zipFile = qtrue;
+					fsh[*file].pakFilename = pak->pakFilename;
 
 					// set the file position in the zip file (also sets the current file info)
 					unzSetOffset(fsh[*file].handleFiles.file.z, pakFile->pos);
@@ -1796,6 +1831,31 @@ void QDECL FS_Printf( fileHandle_t h, const char *fmt, ... ) {
 	FS_Write(msg, strlen(msg), h);
 }
 
+/*
+=================
+FS_PakFileDataPos
+
+Where the raw data of a pk3 file opened for reading starts, so it can be
+read without the pak's unzip handle.  Only valid before any reads.
+=================
+*/
+qboolean FS_PakFileDataPos( fileHandle_t f, const char **pakFilename, int *offset, int *compressedSize, int *method ) {
+	uLong pos, csize, size;
+
+	if ( f < 1 || f >= MAX_FILE_HANDLES || !fsh[f].zipFile || !fsh[f].pakFilename ) {
+		return qfalse;
+	}
+
+	if ( unzGetCurrentFileDataPos( fsh[f].handleFiles.file.z, &pos, &csize, &size, method ) != UNZ_OK ) {
+		return qfalse;
+	}
+
+	*pakFilename = fsh[f].pakFilename;
+	*offset = (int)pos;
+	*compressedSize = (int)csize;
+	return qtrue;
+}
+
 #define PK3_SEEK_BUFFER_SIZE 65536
 
 /*
@@ -2099,7 +2159,9 @@ long FS_ReadFileDir(const char *qpath, void *searchPath, qboolean unpure, void *
 	buf = Hunk_AllocateTempMemory(len+1);
 	*buffer = buf;
 
-	FS_Read (buf, len, h);
+	if (!FS_PrefetchRead(h, buf, len)) {
+		FS_Read (buf, len, h);
+	}
 
 	// guarantee that it will have a trailing 0 for string operations
 	buf[len] = 0;
@@ -3443,6 +3505,9 @@ void FS_Shutdown( qboolean closemfp ) {
 	searchpath_t	*p, *next;
 	int	i;
 
+	// the prefetch thread has pak names queued
+	FS_ShutdownPrefetch();
+
 	for(i = 0; i < MAX_FILE_HANDLES; i++) {
 		if (fsh[i].fileSize) {
 			FS_FCloseFile(i);
@@ -3594,6 +3659,7 @@ static void FS_Startup( const char *gameName )
 	fs_packFiles = 0;
 
 	fs_debug = Cvar_Get( "fs_debug", "0", 0 );
+	FS_InitPrefetch();
 	fs_basepath = Cvar_Get ("fs_basepath", Sys_DefaultInstallPath(), CVAR_INIT|CVAR_PROTECTED );
 	fs_basegame = Cvar_Get ("fs_basegame", "", CVAR_INIT );
 	fs_quakelivedir = Cvar_Get("fs_quakelivedir", "", CVAR_INIT);
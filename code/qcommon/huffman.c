@@ -29,14 +29,18 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 static int			bloc = 0;
 
+// like the read functions below, the offset versions of the write
+// functions don't touch the global bloc so messages can be encoded from
+// more than one thread
 void	Huff_putBit( int bit, byte *fout, int *offset) {
-	bloc = *offset;
-	if ((bloc&7) == 0) {
-		fout[(bloc>>3)] = 0;
+	int b;
+
+	b = *offset;
+	if ((b&7) == 0) {
+		fout[(b>>3)] = 0;
 	}
-	fout[(bloc>>3)] |= bit << (bloc&7);
-	bloc++;
-	*offset = bloc;
+	fout[(b>>3)] |= bit << (b&7);
+	*offset = b + 1;
 }
 
 int		Huff_getBloc(void)
@@ -49,12 +53,15 @@ void	Huff_setBloc(int _bloc)
 	bloc = _bloc;
 }
 
+// the read functions don't touch the global bloc so messages can be
+// decoded from more than one thread
 int		Huff_getBit( byte *fin, int *offset) {
 	int t;
-	bloc = *offset;
-	t = (fin[(bloc>>3)] >> (bloc&7)) & 0x1;
-	bloc++;
-	*offset = bloc;
+	int b;
+
+	b = *offset;
+	t = (fin[(b>>3)] >> (b&7)) & 0x1;
+	*offset = b + 1;
 	return t;
 }
 
@@ -280,18 +287,21 @@ int Huff_Receive (node_t *node, int *ch, byte *fin) {
 
 /* Get a symbol */
 void Huff_offsetReceive (node_t *node, int *ch, byte *fin, int *offset, int maxoffset) {
-	bloc = *offset;
+	int b;
+
+	b = *offset;
 	while (node && node->symbol == INTERNAL_NODE) {
-		if (bloc >= maxoffset) {
+		if (b >= maxoffset) {
 			*ch = 0;
 			*offset = maxoffset + 1;
 			return;
 		}
-		if (get_bit(fin)) {
+		if ((fin[(b>>3)] >> (b&7)) & 0x1) {
 			node = node->right;
 		} else {
 			node = node->left;
 		}
+		b++;
 	}
 	if (!node) {
 		*ch = 0;
@@ -299,7 +309,7 @@ void Huff_offsetReceive (node_t *node, int *ch, byte *fin, int *offset, int maxo
 //		Com_Error(ERR_DROP, "Illegal tree!");
 	}
 	*ch = node->symbol;
-	*offset = bloc;
+	*offset = b;
 }
 
 /* Send the prefix code for this node */
@@ -334,10 +344,31 @@ void Huff_transmit (huff_t *huff, int ch, byte *fout, int maxoffset) {
 	}
 }
 
+/* Send the prefix code for this node at *offset */
+static void offsetSend(node_t *node, node_t *child, byte *fout, int *offset, int maxoffset) {
+	int b;
+
+	if (node->parent) {
+		offsetSend(node->parent, node, fout, offset, maxoffset);
+	}
+	if (child) {
+		b = *offset;
+		if (b >= maxoffset) {
+			*offset = maxoffset + 1;
+			return;
+		}
+		if ((b&7) == 0) {
+			fout[(b>>3)] = 0;
+		}
+		if (node->right == child) {
+			fout[(b>>3)] |= 1 << (b&7);
+		}
+		*offset = b + 1;
+	}
+}
+
 void Huff_offsetTransmit (huff_t *huff, int ch, byte *fout, int *offset, int maxoffset) {
-	bloc = *offset;
-	send(huff->loc[ch], NULL, fout, maxoffset);
-	*offset = bloc;
+	offsetSend(huff->loc[ch], NULL, fout, offset, maxoffset);
 }
 
 void Huff_Decompress(msg_t *mbuf, int offset) {
@@ -392,8 +423,6 @@ void Huff_Decompress(msg_t *mbuf, int offset) {
 	Com_Memcpy(mbuf->data + offset, seq, cch);
 }
 
-extern 	int oldsize;
-
 void Huff_Compress(msg_t *mbuf, int offset) {
 	int			i, ch, size;
 	byte		seq[65536];
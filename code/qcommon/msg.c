@@ -48,6 +48,22 @@ static void MSG_Error (int code, const char *fmt, ...)
 	}
 }
 
+/*
+bad data in a message with allowoverflow set marks it as overflowed instead
+of dropping with Com_Error(), so it can be read from another thread
+*/
+static qboolean MSG_ReadOverflowed (msg_t *msg)
+{
+	if (!msg->allowoverflow) {
+		return qfalse;
+	}
+
+	msg->overflowed = qtrue;
+	msg->readcount = msg->cursize + 1;
+
+	return qtrue;
+}
+
 /*
 ==============================================================================
 
@@ -57,7 +73,8 @@ Handles byte ordering and avoids alignment errors
 ==============================================================================
 */
 
-int oldsize = 0;
+// bits written, snapshots are also written on the server's worker threads
+static Q_THREAD_LOCAL int oldsize = 0;
 
 void MSG_initHuffman( void );
 
@@ -441,7 +458,6 @@ int MSG_ReadByte( msg_t *msg ) {
 }
 
 int MSG_LookaheadByte( msg_t *msg ) {
-	const int bloc = Huff_getBloc();
 	const int readcount = msg->readcount;
 	const int bit = msg->bit;
 	int c;
@@ -453,7 +469,6 @@ int MSG_LookaheadByte( msg_t *msg ) {
 
 	c = MSG_ReadByte(msg);
 
-	Huff_setBloc(bloc);
 	msg->readcount = readcount;
 	msg->bit = bit;
 	return c;
@@ -1232,6 +1247,9 @@ void MSG_ReadDeltaEntity( msg_t *msg, entityState_t *from, entityState_t *to,
 	int			deltaFound;
 
 	if ( number < 0 || number >= MAX_GENTITIES) {
+		if (MSG_ReadOverflowed(msg)) {
+			return;
+		}
 		MSG_Error( ERR_DROP, "Bad delta entity number: %i", number );
 		return;
 	}
@@ -1276,6 +1294,9 @@ void MSG_ReadDeltaEntity( msg_t *msg, entityState_t *from, entityState_t *to,
 	lc = MSG_ReadByte(msg);
 
 	if (lc > numFields  ||  lc < 0) {
+		if (MSG_ReadOverflowed(msg)) {
+			return;
+		}
 		MSG_Error(ERR_DROP, "invalid entityState field count: %d, numFields %d", lc, numFields);
 		//Com_Printf("^3invalid entityState field count: %d, numFields %d", lc, numFields);
 		return;
@@ -1788,6 +1809,9 @@ void MSG_ReadDeltaPlayerstate (msg_t *msg, playerState_t *from, playerState_t *t
 	lc = MSG_ReadByte(msg);
 
 	if (lc > numFields  ||  lc < 0) {
+		if (MSG_ReadOverflowed(msg)) {
+			return;
+		}
 		Com_Printf("\n");
 		MSG_Error(ERR_DROP, "invalid playerState field count:  %d : %d", lc, numFields);
 		return;
@@ -0,0 +1,637 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// prefetch.c  -- background reads of pk3 files that will be loaded soon
+//
+// FS_Prefetch() looks a file up on the main thread and queues where its
+// data lives in the pk3.  A worker thread reads and inflates the data
+// with its own FILE handle and plain zlib, so the pak handles shared by
+// the rest of the file system are never touched off the main thread.
+// When FS_ReadFile() later opens the same pk3 entry the buffered data is
+// copied out instead of read from disk.  Skins that finish loading have
+// the images they reference queued as well.
+//
+// Only files inside pk3s are prefetched, loose files are read normally.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "q_shared.h"
+#include "qcommon.h"
+
+#ifdef USE_LOCAL_HEADERS
+  #include "../zlib/zlib.h"
+#else
+  #include <zlib.h>
+#endif
+
+#define MAX_PREFETCH_FILES 2048
+#define PREFETCH_HASH_SIZE 4096  // power of two
+#define MAX_PREFETCH_BYTES (128 * 1024 * 1024)
+#define MAX_PREFETCH_SKINS 64
+
+typedef enum {
+	PREFETCH_QUEUED,
+	PREFETCH_READING,
+	PREFETCH_DONE,
+	PREFETCH_FAILED,  // or cancelled
+	PREFETCH_USED,
+} prefetchState_t;
+
+typedef struct {
+	prefetchState_t state;
+	char name[MAX_QPATH];
+	char pakFilename[MAX_OSPATH];
+	int offset;  // of the raw data in the pk3
+	int compressedSize;
+	int size;
+	int method;
+	byte *data;  // malloc()'d, valid while PREFETCH_DONE
+	qboolean skinParsed;
+	int hashNext;  // index + 1, 0 ends the chain
+} prefetchFile_t;
+
+typedef struct {
+	sysThread_t *thread;
+	sysMutex_t *mutex;
+	sysCond_t *cond;  // work queued or quit
+	sysCond_t *doneCond;  // a read finished
+	qboolean quit;
+
+	prefetchFile_t files[MAX_PREFETCH_FILES];
+	int numFiles;  // only changed by the main thread while holding the mutex
+	int nextQueued;
+	int numReading;
+	int hash[PREFETCH_HASH_SIZE];  // index + 1
+
+	size_t bytes;  // reserved for buffered data
+
+	// stats
+	int hits;
+	int waits;
+	int misses;
+} prefetch_t;
+
+static prefetch_t pf;
+
+static cvar_t *fs_prefetch;
+
+static int FS_PrefetchHash (const char *pakFilename, int offset)
+{
+	unsigned int h;
+
+	h = (unsigned int)offset * 2654435761u;
+	while (*pakFilename) {
+		h = h * 31 + (byte)*pakFilename;
+		pakFilename++;
+	}
+
+	return (int)(h & (PREFETCH_HASH_SIZE - 1));
+}
+
+// mutex must be held
+static prefetchFile_t *FS_PrefetchFind (const char *pakFilename, int offset)
+{
+	prefetchFile_t *p;
+	int n;
+
+	n = pf.hash[FS_PrefetchHash(pakFilename, offset)];
+	while (n) {
+		p = &pf.files[n - 1];
+		if (p->offset == offset  &&  !strcmp(p->pakFilename, pakFilename)) {
+			return p;
+		}
+		n = p->hashNext;
+	}
+
+	return NULL;
+}
+
+/*
+================
+FS_PrefetchLoad
+
+Runs in the worker thread.  *fp and openPak cache the last pk3 opened.
+================
+*/
+static byte *FS_PrefetchLoad (FILE **fp, char *openPak, int openPakSize, const prefetchFile_t *p)
+{
+	byte *compressed;
+	byte *data;
+	z_stream zs;
+	int err;
+
+	if (!*fp  ||  strcmp(openPak, p->pakFilename)) {
+		if (*fp) {
+			fclose(*fp);
+		}
+		openPak[0] = '\0';
+		*fp = fopen(p->pakFilename, "rb");
+		if (!*fp) {
+			return NULL;
+		}
+		Q_strncpyz(openPak, p->pakFilename, openPakSize);
+	}
+
+	if (fseek(*fp, p->offset, SEEK_SET)) {
+		return NULL;
+	}
+
+	data = (byte *)malloc(p->size > 0 ? p->size : 1);
+	if (!data) {
+		return NULL;
+	}
+
+	if (p->method == 0) {
+		// stored
+		if (fread(data, 1, p->size, *fp) != (size_t)p->size) {
+			free(data);
+			return NULL;
+		}
+		return data;
+	}
+
+	compressed = (byte *)malloc(p->compressedSize > 0 ? p->compressedSize : 1);
+	if (!compressed) {
+		free(data);
+		return NULL;
+	}
+
+	if (fread(compressed, 1, p->compressedSize, *fp) != (size_t)p->compressedSize) {
+		free(compressed);
+		free(data);
+		return NULL;
+	}
+
+	memset(&zs, 0, sizeof(zs));
+	if (inflateInit2(&zs, -MAX_WBITS) != Z_OK) {
+		free(compressed);
+		free(data);
+		return NULL;
+	}
+
+	zs.next_in = compressed;
+	zs.avail_in = p->compressedSize;
+	zs.next_out = data;
+	zs.avail_out = p->size;
+
+	err = inflate(&zs, Z_FINISH);
+	inflateEnd(&zs);
+	free(compressed);
+
+	if (err != Z_STREAM_END  ||  zs.total_out != (uLong)p->size) {
+		free(data);
+		return NULL;
+	}
+
+	return data;
+}
+
+static void FS_PrefetchThread (void *arg)
+{
+	prefetchFile_t *p;
+	prefetchFile_t job;
+	FILE *fp;
+	char openPak[MAX_OSPATH];
+	byte *data;
+
+	fp = NULL;
+	openPak[0] = '\0';
+
+	Sys_LockMutex(pf.mutex);
+	while (1) {
+		while (!pf.quit  &&  pf.nextQueued >= pf.numFiles) {
+			Sys_CondWait(pf.cond, pf.mutex);
+		}
+		if (pf.quit) {
+			break;
+		}
+
+		p = &pf.files[pf.nextQueued];
+		pf.nextQueued++;
+		if (p->state != PREFETCH_QUEUED) {
+			// cancelled
+			continue;
+		}
+
+		if (pf.bytes + p->size > MAX_PREFETCH_BYTES) {
+			p->state = PREFETCH_FAILED;
+			continue;
+		}
+
+		p->state = PREFETCH_READING;
+		pf.bytes += p->size;
+		pf.numReading++;
+		job = *p;
+		Sys_UnlockMutex(pf.mutex);
+
+		data = FS_PrefetchLoad(&fp, openPak, sizeof(openPak), &job);
+
+		Sys_LockMutex(pf.mutex);
+		if (data) {
+			p->data = data;
+			p->state = PREFETCH_DONE;
+		} else {
+			pf.bytes -= p->size;
+			p->state = PREFETCH_FAILED;
+		}
+		pf.numReading--;
+		Sys_CondBroadcast(pf.doneCond);
+	}
+	Sys_UnlockMutex(pf.mutex);
+
+	if (fp) {
+		fclose(fp);
+	}
+}
+
+static qboolean FS_PrefetchStartThread (void)
+{
+	if (pf.thread) {
+		return qtrue;
+	}
+
+	if (!pf.mutex) {
+		pf.mutex = Sys_CreateMutex();
+		pf.cond = Sys_CreateCond();
+		pf.doneCond = Sys_CreateCond();
+	}
+	if (!pf.mutex  ||  !pf.cond  ||  !pf.doneCond) {
+		return qfalse;
+	}
+
+	pf.quit = qfalse;
+	pf.thread = Sys_CreateThread(FS_PrefetchThread, NULL);
+	if (!pf.thread) {
+		Com_DPrintf("FS_Prefetch: couldn't start thread\n");
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+// returns qfalse if the file doesn't exist
+static qboolean FS_PrefetchQueue (const char *qpath)
+{
+	prefetchFile_t *p;
+	fileHandle_t h;
+	const char *pakFilename;
+	char pak[MAX_OSPATH];
+	long len;
+	int offset, compressedSize, method;
+	qboolean inPak;
+	int hash;
+
+	len = FS_FOpenFileRead(qpath, &h, qfalse);
+	if (!h) {
+		return qfalse;
+	}
+	inPak = FS_PakFileDataPos(h, &pakFilename, &offset, &compressedSize, &method);
+	if (inPak) {
+		Q_strncpyz(pak, pakFilename, sizeof(pak));
+	}
+	FS_FCloseFile(h);
+
+	if (!inPak  ||  len <= 0  ||  len > MAX_PREFETCH_BYTES) {
+		return qtrue;
+	}
+	if (method != 0  &&  method != Z_DEFLATED) {
+		return qtrue;
+	}
+	if (method == 0  &&  compressedSize != len) {
+		return qtrue;
+	}
+
+	if (!FS_PrefetchStartThread()) {
+		return qtrue;
+	}
+
+	Sys_LockMutex(pf.mutex);
+
+	if (pf.numFiles >= MAX_PREFETCH_FILES  ||  FS_PrefetchFind(pak, offset)) {
+		Sys_UnlockMutex(pf.mutex);
+		return qtrue;
+	}
+
+	p = &pf.files[pf.numFiles];
+	memset(p, 0, sizeof(*p));
+	p->state = PREFETCH_QUEUED;
+	Q_strncpyz(p->name, qpath, sizeof(p->name));
+	Q_strncpyz(p->pakFilename, pak, sizeof(p->pakFilename));
+	p->offset = offset;
+	p->compressedSize = compressedSize;
+	p->size = len;
+	p->method = method;
+
+	hash = FS_PrefetchHash(pak, offset);
+	p->hashNext = pf.hash[hash];
+	pf.hash[hash] = pf.numFiles + 1;
+
+	pf.numFiles++;
+	Sys_CondSignal(pf.cond);
+
+	Sys_UnlockMutex(pf.mutex);
+
+	return qtrue;
+}
+
+/*
+================
+FS_Prefetch
+
+Queues a file that will be loaded with FS_ReadFile() soon.  Files that
+don't exist or aren't in a pk3 are ignored.
+================
+*/
+void FS_Prefetch (const char *qpath)
+{
+	if (!fs_prefetch  ||  !fs_prefetch->integer) {
+		return;
+	}
+	if (!qpath  ||  !qpath[0]  ||  pf.numFiles >= MAX_PREFETCH_FILES) {
+		return;
+	}
+
+	FS_PrefetchQueue(qpath);
+}
+
+// queues the first image the renderer is likely to pick for name
+static void FS_PrefetchImage (const char *name)
+{
+	static const char *exts[] = { "tga", "jpg", "png" };
+	char path[MAX_QPATH];
+	const char *ext;
+	int i;
+
+	if (FS_PrefetchQueue(name)) {
+		return;
+	}
+
+	ext = COM_GetExtension(name);
+	for (i = 0;  i < ARRAY_LEN(exts);  i++) {
+		if (!Q_stricmp(ext, exts[i])) {
+			continue;
+		}
+		COM_StripExtension(name, path, sizeof(path));
+		Q_strcat(path, sizeof(path), va(".%s", exts[i]));
+		if (FS_PrefetchQueue(path)) {
+			return;
+		}
+	}
+}
+
+/*
+================
+FS_PrefetchSkinImages
+
+Skin files are lines of "surface,image", tags have no image.
+================
+*/
+static void FS_PrefetchSkinImages (const char *text, int len)
+{
+	char image[MAX_QPATH];
+	const char *end;
+	const char *s;
+	int n;
+
+	end = text + len;
+	while (text < end) {
+		// find the comma on this line
+		while (text < end  &&  *text != ','  &&  *text != '\n') {
+			text++;
+		}
+		if (text >= end) {
+			break;
+		}
+		if (*text == '\n') {
+			text++;
+			continue;
+		}
+		text++;
+
+		// skip to the image name
+		while (text < end  &&  (*text == ' '  ||  *text == '\t'  ||  *text == '"')) {
+			text++;
+		}
+		s = text;
+		while (text < end  &&  *text != '\n'  &&  *text != '\r'  &&  *text != ' '  &&  *text != '\t'  &&  *text != '"') {
+			text++;
+		}
+
+		n = text - s;
+		if (n > 0  &&  n < sizeof(image)) {
+			memcpy(image, s, n);
+			image[n] = '\0';
+			FS_PrefetchImage(image);
+		}
+	}
+}
+
+/*
+================
+FS_PrefetchRead
+
+Called from FS_ReadFile() with a pk3 file that was just opened.  Copies
+the buffered data to buffer if it was prefetched and returns qtrue.
+================
+*/
+qboolean FS_PrefetchRead (fileHandle_t f, void *buffer, int len)
+{
+	prefetchFile_t *p;
+	const char *pakFilename;
+	int offset, compressedSize, method;
+	qboolean hit;
+	qboolean parseSkin;
+
+	if (!pf.numFiles) {
+		return qfalse;
+	}
+	if (!FS_PakFileDataPos(f, &pakFilename, &offset, &compressedSize, &method)) {
+		return qfalse;
+	}
+
+	hit = qfalse;
+	parseSkin = qfalse;
+
+	Sys_LockMutex(pf.mutex);
+
+	p = FS_PrefetchFind(pakFilename, offset);
+	if (!p  ||  p->size != len) {
+		Sys_UnlockMutex(pf.mutex);
+		return qfalse;
+	}
+
+	if (p->state == PREFETCH_QUEUED) {
+		// not started, cheaper to read it here than to wait
+		p->state = PREFETCH_FAILED;
+		pf.misses++;
+	} else if (p->state == PREFETCH_READING) {
+		pf.waits++;
+		while (p->state == PREFETCH_READING) {
+			Sys_CondWait(pf.doneCond, pf.mutex);
+		}
+	}
+
+	if (p->state == PREFETCH_DONE) {
+		memcpy(buffer, p->data, len);
+		free(p->data);
+		p->data = NULL;
+		p->state = PREFETCH_USED;
+		pf.bytes -= p->size;
+		pf.hits++;
+		hit = qtrue;
+		parseSkin = !p->skinParsed  &&  !Q_stricmp(COM_GetExtension(p->name), "skin");
+		p->skinParsed = qtrue;
+	}
+
+	Sys_UnlockMutex(pf.mutex);
+
+	if (parseSkin) {
+		FS_PrefetchSkinImages((const char *)buffer, len);
+	}
+
+	return hit;
+}
+
+/*
+================
+FS_PrefetchFrame
+
+Called every frame, queues the images of skins that finished loading.
+================
+*/
+void FS_PrefetchFrame (void)
+{
+	prefetchFile_t *skins[MAX_PREFETCH_SKINS];
+	prefetchFile_t *p;
+	int numSkins;
+	int i;
+
+	if (!pf.numFiles) {
+		return;
+	}
+
+	numSkins = 0;
+
+	Sys_LockMutex(pf.mutex);
+	for (i = 0;  i < pf.numFiles  &&  numSkins < MAX_PREFETCH_SKINS;  i++) {
+		p = &pf.files[i];
+		if (p->state == PREFETCH_DONE  &&  !p->skinParsed  &&  !Q_stricmp(COM_GetExtension(p->name), "skin")) {
+			p->skinParsed = qtrue;
+			skins[numSkins] = p;
+			numSkins++;
+		}
+	}
+	Sys_UnlockMutex(pf.mutex);
+
+	// data of finished files is only freed by the main thread
+	for (i = 0;  i < numSkins;  i++) {
+		FS_PrefetchSkinImages((const char *)skins[i]->data, skins[i]->size);
+	}
+}
+
+/*
+================
+FS_PrefetchFlush
+
+Cancels queued files and frees everything that wasn't used.
+================
+*/
+void FS_PrefetchFlush (void)
+{
+	prefetchFile_t *p;
+	int i;
+
+	if (!pf.mutex) {
+		return;
+	}
+
+	Sys_LockMutex(pf.mutex);
+
+	for (i = 0;  i < pf.numFiles;  i++) {
+		if (pf.files[i].state == PREFETCH_QUEUED) {
+			pf.files[i].state = PREFETCH_FAILED;
+		}
+	}
+	while (pf.numReading > 0) {
+		Sys_CondWait(pf.doneCond, pf.mutex);
+	}
+
+	for (i = 0;  i < pf.numFiles;  i++) {
+		p = &pf.files[i];
+		if (p->data) {
+			free(p->data);
+			p->data = NULL;
+		}
+	}
+
+	pf.numFiles = 0;
+	pf.nextQueued = 0;
+	pf.bytes = 0;
+	memset(pf.hash, 0, sizeof(pf.hash));
+
+	Sys_UnlockMutex(pf.mutex);
+}
+
+static void FS_PrefetchInfo_f (void)
+{
+	int counts[PREFETCH_USED + 1];
+	int i;
+
+	memset(counts, 0, sizeof(counts));
+
+	if (pf.mutex) {
+		Sys_LockMutex(pf.mutex);
+	}
+	for (i = 0;  i < pf.numFiles;  i++) {
+		counts[pf.files[i].state]++;
+	}
+	Com_Printf("%d files: %d queued  %d reading  %d buffered  %d used  %d failed\n", pf.numFiles, counts[PREFETCH_QUEUED], counts[PREFETCH_READING], counts[PREFETCH_DONE], counts[PREFETCH_USED], counts[PREFETCH_FAILED]);
+	Com_Printf("%d bytes buffered\n", (int)pf.bytes);
+	Com_Printf("hits: %d (%d waited)   not read in time: %d\n", pf.hits, pf.waits, pf.misses);
+	if (pf.mutex) {
+		Sys_UnlockMutex(pf.mutex);
+	}
+}
+
+void FS_InitPrefetch (void)
+{
+	fs_prefetch = Cvar_Get("fs_prefetch", "1", CVAR_ARCHIVE);
+
+	Cmd_AddCommand("prefetchInfo", FS_PrefetchInfo_f);
+}
+
+void FS_ShutdownPrefetch (void)
+{
+	FS_PrefetchFlush();
+
+	if (pf.thread) {
+		Sys_LockMutex(pf.mutex);
+		pf.quit = qtrue;
+		Sys_CondSignal(pf.cond);
+		Sys_UnlockMutex(pf.mutex);
+
+		Sys_JoinThread(pf.thread);
+		pf.thread = NULL;
+	}
+
+	Cmd_RemoveCommand("prefetchInfo");
+}
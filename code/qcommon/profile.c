@@ -0,0 +1,449 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// profile.c  -- hierarchical frame profiler
+//
+// Com_ProfileBegin() / Com_ProfileEnd() pairs record nested timing zones
+// into a ring buffer while 'profile_start' is active.  'profile_stop' writes
+// the buffered zones as a Chrome trace (chrome://tracing, ui.perfetto.dev).
+// Zones are only recorded from the main thread, and start and stop take
+// effect at the next frame boundary so zones are always balanced.
+//
+// Some zones also belong to a stage (demo, cgame, renderer, ...).  While
+// stage timing is enabled the exclusive time of each stage is summed for
+// every frame, a zone nested in a zone of another stage is only counted
+// for its own stage.
+
+#include "q_shared.h"
+#include "qcommon.h"
+
+#define PROFILE_MAX_DEPTH 32
+#define PROFILE_MAX_NAMES 1024
+#define PROFILE_NAME_HASH 2048
+
+typedef struct {
+	int name;
+	int depth;
+	int frame;
+	int64_t start;
+	int64_t duration;  // -1 while the zone is open
+} profileEvent_t;
+
+typedef struct {
+	int event;  // -1 if not traced
+	profileStage_t stage;
+	int64_t start;
+	int64_t otherStages;  // time of nested zones in other stages
+} profileZone_t;
+
+static const struct {
+	const char *name;
+	profileStage_t stage;
+} profileZoneStages[] = {
+	{ "demo read", PROFILE_STAGE_DEMO },
+	{ "demo parse", PROFILE_STAGE_DEMO },
+	{ "extra demo merge", PROFILE_STAGE_DEMO },
+	{ "CL_CGameRendering", PROFILE_STAGE_CGAME },
+	{ "R_RenderView", PROFILE_STAGE_FRONTEND },
+	{ "RB_ExecuteRenderCommands", PROFILE_STAGE_BACKEND },
+	{ "R_SyncRenderThread", PROFILE_STAGE_BACKEND },
+	{ "RB_TakeVideoFrameCmd", PROFILE_STAGE_CAPTURE },
+	{ "CL_WriteAVIVideoFrame", PROFILE_STAGE_ENCODE },
+	{ "S_Update", PROFILE_STAGE_SOUND },
+};
+
+static const char *profileStageNames[PROFILE_NUM_STAGES] = {
+	"other",
+	"demo",
+	"cgame",
+	"frontend",
+	"backend",
+	"capture",
+	"encode",
+	"sound",
+};
+
+static cvar_t *com_profileEvents;
+
+static profileEvent_t *profileEvents;
+static int profileMaxEvents;  // power of two
+static int profileNumEvents;  // total since profile_start, not wrapped
+static profileZone_t profileStack[PROFILE_MAX_DEPTH];
+static int profileDepth;
+static qboolean profileActive;
+static int profileFrame;
+static int64_t profileStartTime;
+
+static qboolean profileStagesActive;
+static int64_t profileStageTimes[PROFILE_NUM_STAGES];
+static int64_t profileLastStageTimes[PROFILE_NUM_STAGES];
+static qboolean profileLastStagesValid;
+static qboolean profileStagesFrame;  // stage timing covers the whole frame
+
+static qboolean profileStartPending;
+static qboolean profileStopPending;
+static char profileFileName[MAX_QPATH];
+
+static char *profileNames[PROFILE_MAX_NAMES];
+static profileStage_t profileNameStages[PROFILE_MAX_NAMES];
+static int profileNumNames;
+static int profileNameHash[PROFILE_NAME_HASH];  // name index + 1
+
+/*
+==================
+Com_ProfileNameIndex
+
+names are copied since cgame passes pointers into vm memory
+==================
+*/
+static int Com_ProfileNameIndex (const char *name)
+{
+	unsigned int hash;
+	const char *s;
+	int i;
+	int len;
+
+	hash = 0;
+	for (s = name;  *s;  s++) {
+		hash = hash * 31 + (unsigned char)*s;
+	}
+	hash &= PROFILE_NAME_HASH - 1;
+
+	while ((i = profileNameHash[hash]) != 0) {
+		if (!strcmp(profileNames[i - 1], name)) {
+			return i - 1;
+		}
+		hash = (hash + 1) & (PROFILE_NAME_HASH - 1);
+	}
+
+	if (profileNumNames >= PROFILE_MAX_NAMES) {
+		return -1;
+	}
+
+	len = strlen(name) + 1;
+	profileNames[profileNumNames] = malloc(len);
+	if (!profileNames[profileNumNames]) {
+		return -1;
+	}
+	memcpy(profileNames[profileNumNames], name, len);
+	profileNameHash[hash] = profileNumNames + 1;
+
+	profileNameStages[profileNumNames] = PROFILE_STAGE_NONE;
+	for (i = 0;  i < ARRAY_LEN(profileZoneStages);  i++) {
+		if (!strcmp(profileZoneStages[i].name, name)) {
+			profileNameStages[profileNumNames] = profileZoneStages[i].stage;
+			break;
+		}
+	}
+
+	return profileNumNames++;
+}
+
+/*
+==================
+Com_ProfileBegin
+==================
+*/
+void Com_ProfileBegin (const char *name)
+{
+	profileZone_t *zone;
+	profileEvent_t *ev;
+	int nameIndex;
+
+	if (!profileActive  &&  !profileStagesActive) {
+		return;
+	}
+
+	if (profileDepth >= PROFILE_MAX_DEPTH) {
+		// still counted so the matching end is ignored
+		profileDepth++;
+		return;
+	}
+
+	nameIndex = Com_ProfileNameIndex(name);
+
+	zone = &profileStack[profileDepth];
+	zone->stage = nameIndex >= 0 ? profileNameStages[nameIndex] : PROFILE_STAGE_NONE;
+	if (zone->stage == PROFILE_STAGE_NONE  &&  profileDepth > 0) {
+		zone->stage = profileStack[profileDepth - 1].stage;
+	}
+	zone->otherStages = 0;
+	zone->event = -1;
+	zone->start = Sys_Microseconds();
+
+	if (profileActive) {
+		zone->event = profileNumEvents++;
+		ev = &profileEvents[zone->event & (profileMaxEvents - 1)];
+		ev->name = nameIndex;
+		ev->depth = profileDepth;
+		ev->frame = profileFrame;
+		ev->duration = -1;
+		ev->start = zone->start;
+	}
+
+	profileDepth++;
+}
+
+/*
+==================
+Com_ProfileEnd
+==================
+*/
+void Com_ProfileEnd (void)
+{
+	profileZone_t *zone;
+	profileZone_t *parent;
+	int64_t duration;
+
+	if (profileDepth <= 0) {
+		return;
+	}
+
+	profileDepth--;
+	if (profileDepth >= PROFILE_MAX_DEPTH) {
+		return;
+	}
+
+	zone = &profileStack[profileDepth];
+	duration = Sys_Microseconds() - zone->start;
+
+	// the slot could have been reused by a later zone
+	if (zone->event >= 0  &&  profileNumEvents - zone->event <= profileMaxEvents) {
+		profileEvents[zone->event & (profileMaxEvents - 1)].duration = duration;
+	}
+
+	parent = profileDepth > 0 ? &profileStack[profileDepth - 1] : NULL;
+	if (!parent  ||  parent->stage != zone->stage) {
+		profileStageTimes[zone->stage] += duration - zone->otherStages;
+		if (parent) {
+			parent->otherStages += duration;
+		}
+	} else {
+		parent->otherStages += zone->otherStages;
+	}
+}
+
+/*
+==================
+Com_ProfileEnableStages
+
+Per frame stage times become available through Com_ProfileLastFrame()
+one frame after enabling.
+==================
+*/
+void Com_ProfileEnableStages (qboolean enable)
+{
+	profileStagesActive = enable;
+	profileStagesFrame = qfalse;
+	profileLastStagesValid = qfalse;
+}
+
+/*
+==================
+Com_ProfileLastFrame
+
+Fills in the exclusive time in microseconds of each stage during the last
+complete frame.  Returns qfalse if there isn't one.
+==================
+*/
+qboolean Com_ProfileLastFrame (int64_t *stageTimes)
+{
+	if (!profileLastStagesValid) {
+		return qfalse;
+	}
+
+	memcpy(stageTimes, profileLastStageTimes, sizeof(profileLastStageTimes));
+	return qtrue;
+}
+
+/*
+==================
+Com_ProfileStageName
+==================
+*/
+const char *Com_ProfileStageName (profileStage_t stage)
+{
+	if (stage < 0  ||  stage >= PROFILE_NUM_STAGES) {
+		return "";
+	}
+
+	return profileStageNames[stage];
+}
+
+/*
+==================
+Com_ProfileWriteTrace
+==================
+*/
+static void Com_ProfileWriteTrace (const char *fileName)
+{
+	fileHandle_t f;
+	const profileEvent_t *ev;
+	char name[MAX_STRING_CHARS];
+	int first;
+	int i;
+	int count;
+
+	f = FS_FOpenFileWrite(fileName);
+	if (!f) {
+		Com_Printf("^1%s couldn't open %s\n", __FUNCTION__, fileName);
+		return;
+	}
+
+	first = profileNumEvents - profileMaxEvents;
+	if (first < 0) {
+		first = 0;
+	}
+
+	FS_Printf(f, "{\"traceEvents\":[\n");
+	count = 0;
+	for (i = first;  i < profileNumEvents;  i++) {
+		ev = &profileEvents[i & (profileMaxEvents - 1)];
+		if (ev->duration < 0  ||  ev->name < 0) {
+			continue;
+		}
+		FS_Printf(f, "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":1,\"args\":{\"frame\":%d,\"depth\":%d}}", count ? ",\n" : "", Com_EscapeJSON(name, sizeof(name), profileNames[ev->name]), (long long)(ev->start - profileStartTime), (long long)ev->duration, ev->frame, ev->depth);
+		count++;
+	}
+	FS_Printf(f, "\n],\"displayTimeUnit\":\"ms\"}\n");
+	FS_FCloseFile(f);
+
+	Com_Printf("wrote %d profile zones (%d frames) to %s\n", count, profileFrame, fileName);
+	if (profileNumEvents > profileMaxEvents) {
+		Com_Printf("^3oldest %d zones were dropped, increase com_profileEvents to keep them\n", profileNumEvents - profileMaxEvents);
+	}
+}
+
+/*
+==================
+Com_ProfileFrame
+
+Called at the top of Com_Frame(), outside of any zone.  Closes zones left
+open by the previous frame (ERR_DROP longjmps out of them), applies pending
+start and stop requests and opens the zone for the new frame.
+==================
+*/
+void Com_ProfileFrame (void)
+{
+	while (profileDepth > 0) {
+		Com_ProfileEnd();
+	}
+
+	// only whole frames are reported
+	if (profileStagesFrame  &&  profileStagesActive) {
+		memcpy(profileLastStageTimes, profileStageTimes, sizeof(profileStageTimes));
+		profileLastStagesValid = qtrue;
+	}
+	memset(profileStageTimes, 0, sizeof(profileStageTimes));
+	profileStagesFrame = profileStagesActive;
+
+	if (profileStopPending) {
+		profileStopPending = qfalse;
+		if (profileActive) {
+			profileActive = qfalse;
+			Com_ProfileWriteTrace(profileFileName);
+		}
+	}
+
+	if (profileStartPending) {
+		int size;
+
+		profileStartPending = qfalse;
+
+		size = 1024;
+		while (size < com_profileEvents->integer  &&  size < (1 << 24)) {
+			size <<= 1;
+		}
+		if (size != profileMaxEvents) {
+			free(profileEvents);
+			profileEvents = malloc(size * sizeof(*profileEvents));
+			profileMaxEvents = profileEvents ? size : 0;
+		}
+
+		if (profileEvents) {
+			profileNumEvents = 0;
+			profileFrame = 0;
+			profileStartTime = Sys_Microseconds();
+			profileActive = qtrue;
+		} else {
+			Com_Printf("^1%s couldn't allocate %d profile events\n", __FUNCTION__, size);
+		}
+	}
+
+	if (profileActive) {
+		profileFrame++;
+	}
+	if (profileActive  ||  profileStagesActive) {
+		Com_ProfileBegin("frame");
+	}
+}
+
+/*
+==================
+Com_ProfileStart_f
+==================
+*/
+static void Com_ProfileStart_f (void)
+{
+	if (profileActive) {
+		Com_Printf("profiling already active\n");
+		return;
+	}
+
+	profileStartPending = qtrue;
+	profileStopPending = qfalse;
+}
+
+/*
+==================
+Com_ProfileStop_f
+==================
+*/
+static void Com_ProfileStop_f (void)
+{
+	if (!profileActive  &&  !profileStartPending) {
+		Com_Printf("profiling not active\n");
+		return;
+	}
+
+	if (Cmd_Argc() > 1) {
+		Q_strncpyz(profileFileName, Cmd_Argv(1), sizeof(profileFileName));
+	} else {
+		Q_strncpyz(profileFileName, "profile", sizeof(profileFileName));
+	}
+	COM_DefaultExtension(profileFileName, sizeof(profileFileName), ".json");
+
+	profileStartPending = qfalse;
+	profileStopPending = qtrue;
+}
+
+/*
+==================
+Com_ProfileInit
+==================
+*/
+void Com_ProfileInit (void)
+{
+	com_profileEvents = Cvar_Get("com_profileEvents", "262144", CVAR_ARCHIVE);
+
+	Cmd_AddCommand("profile_start", Com_ProfileStart_f);
+	Cmd_AddCommand("profile_stop", Com_ProfileStop_f);
+}
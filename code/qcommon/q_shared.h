@@ -250,6 +250,15 @@ typedef int		clipHandle_t;
 #define QALIGN(x)
 #endif
 
+// one copy of the variable per thread, qvms don't have threads
+#if defined(Q3_VM)
+#define Q_THREAD_LOCAL
+#elif defined(_MSC_VER)
+#define Q_THREAD_LOCAL __declspec(thread)
+#else
+#define Q_THREAD_LOCAL __thread
+#endif
+
 #ifndef NULL
 #define NULL ((void *)0)
 #endif
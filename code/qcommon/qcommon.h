@@ -663,6 +663,18 @@ qboolean FS_FileLoadInMemory (qhandle_t f);
 int		FS_FileIsInPAK(const char *filename, int *pChecksum );
 // returns 1 if a file is in the PAK file, otherwise -1
 
+qboolean FS_PakFileDataPos( fileHandle_t f, const char **pakFilename, int *offset, int *compressedSize, int *method );
+
+// prefetch.c
+void FS_InitPrefetch (void);
+void FS_ShutdownPrefetch (void);
+void FS_Prefetch (const char *qpath);
+// queues a pk3 file that will be loaded with FS_ReadFile() soon, it is
+// read on a background thread
+qboolean FS_PrefetchRead (fileHandle_t f, void *buffer, int len);
+void FS_PrefetchFrame (void);
+void FS_PrefetchFlush (void);
+
 int		FS_Write( const void *buffer, int len, fileHandle_t f );
 
 int		FS_Read( void *buffer, int len, fileHandle_t f );
@@ -708,6 +720,12 @@ int		FS_Seek( fileHandle_t f, long offset, int origin );
 
 FILE *FS_FileForHandle( fileHandle_t f );
 
+FILE *FS_StdioFileForHandle( fileHandle_t f );
+// NULL for files in pk3s or loaded in memory, doesn't error out
+
+const byte *FS_FileMemoryData( fileHandle_t f, int *size );
+// NULL if the file wasn't loaded with FS_FileLoadInMemory()
+
 qboolean FS_FilenameCompare( const char *s1, const char *s2 );
 
 const char *FS_LoadedPakNames( void );
@@ -861,6 +879,7 @@ unsigned	Com_BlockChecksum( const void *buffer, int length );
 char		*Com_MD5File(const char *filename, int length, const char *prefix, int prefix_len);
 int			Com_Filter(char *filter, char *name, int casesensitive);
 int			Com_FilterPath(char *filter, char *name, int casesensitive);
+char		*Com_EscapeJSON (char *out, int outSize, const char *in);
 int			Com_RealTime (qtime_t *qtime, qboolean now, int convertTime);
 qboolean	Com_SafeMode( void );
 void		Com_RunAndTimeServerPacket(netadr_t *evFrom, msg_t *buf);
@@ -998,6 +1017,29 @@ void Com_Init( char *commandLine );
 void Com_Frame( void );
 void Com_Shutdown( void );
 
+// profile.c, hierarchical zones written as a chrome trace by profile_stop,
+// main thread only
+typedef enum {
+	PROFILE_STAGE_NONE,
+	PROFILE_STAGE_DEMO,
+	PROFILE_STAGE_CGAME,
+	PROFILE_STAGE_FRONTEND,
+	PROFILE_STAGE_BACKEND,
+	PROFILE_STAGE_CAPTURE,
+	PROFILE_STAGE_ENCODE,
+	PROFILE_STAGE_SOUND,
+
+	PROFILE_NUM_STAGES
+} profileStage_t;
+
+void Com_ProfileInit( void );
+void Com_ProfileFrame( void );
+void Com_ProfileBegin( const char *name );
+void Com_ProfileEnd( void );
+void Com_ProfileEnableStages( qboolean enable );
+qboolean Com_ProfileLastFrame( int64_t *stageTimes );
+const char *Com_ProfileStageName( profileStage_t stage );
+
 
 /*
 ==============================================================
@@ -1126,6 +1168,8 @@ void	Sys_Print( const char *msg );
 // Sys_Milliseconds should only be used for profiling purposes,
 // any game related timing information should come from event timestamps
 int		Sys_Milliseconds (void);
+// high resolution timer for profiling, arbitrary origin
+int64_t	Sys_Microseconds (void);
 
 qboolean Sys_RandomBytes( byte *string, int len );
 
@@ -1197,6 +1241,32 @@ dialogResult_t Sys_Dialog( dialogType_t type, const char *message, const char *t
 void Sys_RemovePIDFile( const char *gamedir );
 void Sys_InitPIDFile( const char *gamedir );
 
+// threads
+// code running in a thread created with Sys_CreateThread() must not call
+// Com_Error(), Com_Printf(), Z_Malloc() or any cvar or command functions
+
+typedef struct sysThread_s sysThread_t;
+typedef struct sysMutex_s sysMutex_t;
+typedef struct sysCond_s sysCond_t;
+
+// returns NULL if the thread couldn't be started
+sysThread_t *Sys_CreateThread (void (*func)(void *), void *arg);
+void Sys_JoinThread (sysThread_t *thread);
+
+sysMutex_t *Sys_CreateMutex (void);
+void Sys_DestroyMutex (sysMutex_t *mutex);
+void Sys_LockMutex (sysMutex_t *mutex);
+void Sys_UnlockMutex (sysMutex_t *mutex);
+
+// waits can wake up spuriously, always check the condition in a loop
+sysCond_t *Sys_CreateCond (void);
+void Sys_DestroyCond (sysCond_t *cond);
+void Sys_CondWait (sysCond_t *cond, sysMutex_t *mutex);
+void Sys_CondSignal (sysCond_t *cond);
+void Sys_CondBroadcast (sysCond_t *cond);
+
+int Sys_ProcessorCount (void);
+
 /* This is based on the Adaptive Huffman algorithm described in Sayood's Data
  * Compression book.  The ranks are not actually stored, but implicitly defined
  * by the location of a node within a doubly-linked list */
@@ -1626,3 +1626,33 @@ extern int ZEXPORT unzSetOffset (file, pos)
     s->current_file_ok = (err == UNZ_OK);
     return err;
 }
+
+extern int ZEXPORT unzGetCurrentFileDataPos (file, offset, compressedSize,
+                                             uncompressedSize, method)
+        unzFile file;
+        uLong *offset;
+        uLong *compressedSize;
+        uLong *uncompressedSize;
+        int *method;
+{
+    unz_s* s;
+    file_in_zip_read_info_s* pfile_in_zip_read_info;
+
+    if (file==NULL)
+        return UNZ_PARAMERROR;
+    s=(unz_s*)file;
+    pfile_in_zip_read_info=s->pfile_in_zip_read;
+
+    if (pfile_in_zip_read_info==NULL)
+        return UNZ_PARAMERROR;
+
+    if ((s->cur_file_info.flag & 1) != 0)
+        return UNZ_PARAMERROR;
+
+    *offset = pfile_in_zip_read_info->pos_in_zipfile +
+              pfile_in_zip_read_info->byte_before_the_zipfile;
+    *compressedSize = s->cur_file_info.compressed_size;
+    *uncompressedSize = s->cur_file_info.uncompressed_size;
+    *method = (int)s->cur_file_info.compression_method;
+    return UNZ_OK;
+}
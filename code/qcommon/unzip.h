@@ -346,6 +346,15 @@ extern uLong ZEXPORT unzGetOffset (unzFile file);
 /* Set the current file offset */
 extern int ZEXPORT unzSetOffset (unzFile file, uLong pos);
 
+/* Get where the raw data of the file opened with unzOpenCurrentFile starts
+   in the zipfile, so it can be read without going through this handle.
+   Must be called before reading from the file.  Encrypted files are
+   rejected with UNZ_PARAMERROR. */
+extern int ZEXPORT unzGetCurrentFileDataPos (unzFile file, uLong *offset,
+                                             uLong *compressedSize,
+                                             uLong *uncompressedSize,
+                                             int *method);
+
 
 
 #ifdef __cplusplus
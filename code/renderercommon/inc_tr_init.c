@@ -47,6 +47,7 @@ const void *RB_TakeVideoFrameCmd (const void *data, shotData_t *shotData)
 	char finalName[MAX_QPATH];
 	qboolean fetchBufferHasAlpha = qfalse;
 	qboolean fetchBufferNeedsBGRswap = qfalse;
+	qboolean autoFetch = qfalse;
 	int glMode = GL_RGB;
 	char *sbuf;
 	//__m64 *outAlloc;
@@ -55,6 +56,7 @@ const void *RB_TakeVideoFrameCmd (const void *data, shotData_t *shotData)
 	int blurFrames;
 	int blurOverlap;
 	qboolean useBlur;
+	int gpuBlur;
 	int frameRateDivider;
 
 	cmd = (const videoFrameCommand_t *)data;
@@ -89,7 +91,20 @@ const void *RB_TakeVideoFrameCmd (const void *data, shotData_t *shotData)
 	} else {  //  not png
 		sbuf = finalName;
 		ri.Cvar_VariableStringBuffer("cl_aviFetchMode", sbuf, MAX_QPATH);
-		if (!Q_stricmp("gl_rgba", sbuf)) {
+		if (!Q_stricmp("auto", sbuf)) {
+			// have the driver hand back the channel order that gets
+			// written, jpeg wants rgb and tga and uncompressed avi want
+			// bgr, so nothing is swapped afterwards
+			autoFetch = qtrue;
+			fetchBufferHasAlpha = qfalse;
+			if (cmd->jpg  ||  (cmd->avi  &&  cmd->motionJpeg)) {
+				fetchBufferNeedsBGRswap = qtrue;
+				glMode = GL_RGB;
+			} else {
+				fetchBufferNeedsBGRswap = qfalse;
+				glMode = GL_BGR;
+			}
+		} else if (!Q_stricmp("gl_rgba", sbuf)) {
 			fetchBufferHasAlpha = qtrue;
 			fetchBufferNeedsBGRswap = qtrue;
 			glMode = GL_RGBA;
@@ -121,9 +136,15 @@ const void *RB_TakeVideoFrameCmd (const void *data, shotData_t *shotData)
 	}
 
 	if (useBlur) {
-		glMode = GL_RGBA;
 		fetchBufferHasAlpha = qtrue;
-		fetchBufferNeedsBGRswap = qtrue;
+		if (autoFetch  &&  glMode == GL_BGR) {
+			// blending doesn't care about channel order
+			glMode = GL_BGRA;
+			fetchBufferNeedsBGRswap = qfalse;
+		} else {
+			glMode = GL_RGBA;
+			fetchBufferNeedsBGRswap = qtrue;
+		}
 	}
 
 	if (cmd->jpg  ||  (cmd->avi  &&  cmd->motionJpeg)) {
@@ -146,7 +167,18 @@ const void *RB_TakeVideoFrameCmd (const void *data, shotData_t *shotData)
 			ri.Printf(PRINT_ALL, "shotData->allocFailed\n");
 		}
 
-		if (shotData->blurTotal && !shotData->allocFailed) {
+		gpuBlur = -1;
+#ifdef RENDERER_MME_GPU_BLUR
+		gpuBlur = RB_MME_GpuBlurFrame(shotData, cmd->width, cmd->height, glMode, fetchBuffer + 18);
+		if (gpuBlur == 0) {
+			goto dontwrite;
+		}
+		if (gpuBlur > 0  &&  ((cmd->picCount + 1) * blurFrames) % frameRateDivider != 0) {
+			goto dontwrite;
+		}
+#endif
+
+		if (gpuBlur < 0  &&  shotData->blurTotal  &&  !shotData->allocFailed) {
 			if ( shotData->overlapTotal ) {
 				int lapIndex = shotData->overlapIndex % shotData->overlapTotal;
 				shotData->overlapIndex++;
@@ -291,6 +291,20 @@ extern GLvoid (APIENTRYP qglBlitFramebufferEXT) (GLint srcX0, GLint srcY0, GLint
 	GLE(void, DeleteVertexArrays, GLsizei n, const GLuint *arrays) \
 	GLE(void, GenVertexArrays, GLsizei n, GLuint *arrays) \
 
+// GL_ARB_get_program_binary, built-in to OpenGL 4.1
+#define QGL_ARB_get_program_binary_PROCS \
+	GLE(void, GetProgramBinary, GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) \
+	GLE(void, ProgramBinary, GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) \
+	GLE(void, ProgramParameteri, GLuint program, GLenum pname, GLint value) \
+
+#ifndef GL_ARB_get_program_binary
+#define GL_ARB_get_program_binary
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT            0x8257
+#define GL_PROGRAM_BINARY_LENGTH                      0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS                 0x87FE
+#define GL_PROGRAM_BINARY_FORMATS                     0x87FF
+#endif
+
 #ifndef GL_ARB_texture_compression_rgtc
 #define GL_ARB_texture_compression_rgtc
 #define GL_COMPRESSED_RED_RGTC1                       0x8DBB
@@ -351,6 +365,7 @@ QGL_2_0_PROCS;
 QGL_3_0_PROCS;
 QGL_ARB_framebuffer_object_PROCS;
 QGL_ARB_vertex_array_object_PROCS;
+QGL_ARB_get_program_binary_PROCS;
 QGL_EXT_direct_state_access_PROCS;
 #undef GLE
 
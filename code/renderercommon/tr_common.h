@@ -179,5 +179,17 @@ void		GLimp_SetGamma( unsigned char red[256],
 		unsigned char green[256],
 		unsigned char blue[256] );
 
+// SMP
+qboolean	GLimp_SpawnRenderThread( void (*function)( void ) );
+void		GLimp_ShutdownRenderThread( void );
+void		*GLimp_RendererSleep( void );
+void		GLimp_FrontEndSleep( void );
+void		GLimp_WakeRenderer( void *data );
+
+// front end workers
+int			GLimp_SpawnFrontEndWorkers( int count );
+void		GLimp_ShutdownFrontEndWorkers( void );
+void		GLimp_RunFrontEndJobs( void (*job)( int index ), int numJobs );
+
 
 #endif
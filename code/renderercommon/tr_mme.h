@@ -26,7 +26,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "tr_common.h"
 #include <xmmintrin.h>
 
-typedef struct {
+typedef struct shotData_s {
 	int		pixelCount;
 	__m64	*accumAlign;
 	__m64	*overlapAlign;
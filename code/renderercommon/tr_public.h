@@ -32,7 +32,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
   #include <SDL_opengl.h>
 #endif
 
-#define	REF_API_VERSION		601  // wolfcam don't know the point of this, but bumping anyway
+#define	REF_API_VERSION		603  // wolfcam don't know the point of this, but bumping anyway
 
 //
 // these are the functions exported by the refresh module
@@ -73,6 +73,7 @@ typedef struct {
 	// Nothing is drawn until R_RenderScene is called.
 	void	(*ClearScene)( void );
 	void	(*AddRefEntityToScene)( const refEntity_t *re );
+	void	(*AddRefEntitiesToScene)( const refEntity_t *ents, int numEnts );
 	void	(*AddRefEntityPtrToScene)(refEntity_t *re);
 	void (*SetPathLines)(int *numCameraPoints, cameraPoint_t *cameraPoints, int *numSplinePoints, vec3_t *splinePoints, const vec4_t color);
 	void	(*AddPolyToScene)( qhandle_t hShader , int numVerts, const polyVert_t *verts, int num, int lightmap );
@@ -94,6 +95,10 @@ typedef struct {
 	// if the pointers are not NULL, timing info will be returned
 	void	(*EndFrame)( int *frontEndMsec, int *backEndMsec );
 
+	// waits for a render thread and writes the screenshots and video
+	// frames it left behind, call before closing a video
+	void	(*SyncRenderThread)( void );
+
 
 	int		(*MarkFragments)( int numPoints, const vec3_t *points, const vec3_t projection,
 				   int maxPoints, vec3_t pointBuffer, int maxFragments, markFragment_t *fragmentBuffer );
@@ -212,6 +217,10 @@ typedef struct {
 	void    (*Sys_GLimpInit)( void );
 	qboolean (*Sys_LowPhysicalMemory)( void );
 
+	// profiler zones, main thread only
+	void	(*ProfileBegin)( const char *name );
+	void	(*ProfileEnd)( void );
+
 	// video recording stuff
 	qboolean *SplitVideo;
 
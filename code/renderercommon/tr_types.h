@@ -292,7 +292,7 @@ typedef struct {
 	// used CDS.
 	qboolean				isFullscreen;
 	qboolean				stereoEnabled;
-	qboolean				smpActive;		// UNUSED
+	qboolean				smpActive;		// back end running on its own thread (r_smp)
 	qboolean qlGlsl;
 	qboolean fbo;  // framebuffer object
 	qboolean fboStencil;
@@ -19,9 +19,12 @@ along with Quake III Arena source code; if not, write to the Free Software
 Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 ===========================================================================
 */
+#include <setjmp.h>
+
 #include "tr_local.h"
 
 backEndData_t	*backEndData;
+backEndData_t	*smpBackEndData[SMP_FRAMES];
 backEndState_t	backEnd;
 
 
@@ -1222,6 +1225,7 @@ void RB_RenderDrawSurfList( drawSurf_t *drawSurfs, int numDrawSurfs ) {
 
 		if ( drawSurf->sort == oldSort ) {
 			// fast path, same as previous sort
+			backEnd.dlightBits = drawSurf->dlightBits;
 			rb_surfaceTable[ *drawSurf->surface ]( drawSurf->surface );
 			continue;
 		}
@@ -1399,6 +1403,7 @@ void RB_RenderDrawSurfList( drawSurf_t *drawSurfs, int numDrawSurfs ) {
 		}
 
 		// add the triangles for this surface
+		backEnd.dlightBits = drawSurf->dlightBits;
 		rb_surfaceTable[ *drawSurf->surface ]( drawSurf->surface );
 	}
 
@@ -1564,6 +1569,8 @@ void RE_StretchRaw (int x, int y, int w, int h, int cols, int rows, const byte *
 
 void RE_UploadCinematic (int w, int h, int cols, int rows, const byte *data, int client, qboolean dirty) {
 
+	R_SyncRenderThread();
+
 	GL_Bind( tr.scratchImage[client] );
 
 	// if the scratchImage isn't in the format we want, specify it as a new texture
@@ -2100,12 +2107,6 @@ static const void *RB_SkipRenderCommand (const void *raw_data)
 	return data;
 }
 
-/*
-====================
-RB_ExecuteRenderCommands
-====================
-*/
-
 #if 0
 	#ifdef _MSC_VER
 		#define dprintf(format, ...) ri.Printf(PRINT_ALL, format, __VA_ARGS__)
@@ -2116,6 +2117,42 @@ RB_ExecuteRenderCommands
 	#define dprintf(format, ...)
 #endif
 
+/*
+====================
+RB_ExecuteCaptureCommands
+
+Screenshots and video frames, after the frame has been drawn
+====================
+*/
+static void RB_ExecuteCaptureCommands( const void *data ) {
+	dprintf("render3 commands start -------------------------\n");
+	while ( 1 ) {
+		data = PADP(data, sizeof(void *));
+		switch (*(const int *)data) {
+		case RC_SCREENSHOT:
+			dprintf("r3 takescreenshot\n");
+			data = RB_TakeScreenshotCmd( data );
+			break;
+		case RC_VIDEOFRAME:
+			dprintf("r3 takevideoframe\n");
+			ri.ProfileBegin("RB_TakeVideoFrameCmd");
+			data = RB_TakeVideoFrameCmd(data, &shotDataMain);
+			ri.ProfileEnd();
+			break;
+		case RC_END_OF_LIST:
+			return;
+		default:
+			data = RB_SkipRenderCommand(data);
+			break;
+		}
+	}
+}
+
+/*
+====================
+RB_ExecuteRenderCommands
+====================
+*/
 void RB_ExecuteRenderCommands( const void *data ) {
 	int		t1, t2;
 	const void *dataOrig;
@@ -2124,18 +2161,31 @@ void RB_ExecuteRenderCommands( const void *data ) {
 	qboolean colorMaskSet;
 	GLboolean rgba[4];
 	qboolean videoCommand;
+	qboolean captureCommand;
 	const void *data2;
 
 	t1 = ri.RealMilliseconds();
 	dataOrig = data;
 
+	if ( smpBackEndData[1]  &&  data == smpBackEndData[1]->commands.cmds ) {
+		backEnd.smpFrame = 1;
+	} else {
+		backEnd.smpFrame = 0;
+	}
+
 	videoCommand = qfalse;
+	captureCommand = qfalse;
 	data = dataOrig;
 	while ( 1 ) {
 		data = PADP(data, sizeof(void *));
 		switch (*(const int *)data) {
 		case RC_VIDEOFRAME:
 			videoCommand = qtrue;
+			captureCommand = qtrue;
+			data = RB_SkipRenderCommand(data);
+			break;
+		case RC_SCREENSHOT:
+			captureCommand = qtrue;
 			data = RB_SkipRenderCommand(data);
 			break;
 		case RC_END_OF_LIST:
@@ -2237,7 +2287,9 @@ void RB_ExecuteRenderCommands( const void *data ) {
 				cmd.png = ri.afdLeft->png;
 				cmd.picCount = ri.afdMain->picCount - 1;
 				Q_strncpyz(cmd.givenFileName, ri.afdMain->givenFileName, MAX_QPATH);
+				ri.ProfileBegin("RB_TakeVideoFrameCmd");
 				RB_TakeVideoFrameCmd(&cmd, &shotDataLeft);
+				ri.ProfileEnd();
 			}
 			data = RB_ClearDepth(data);
 			//data = RB_SkipRenderCommand(data);
@@ -2457,30 +2509,18 @@ void RB_ExecuteRenderCommands( const void *data ) {
 
  secondpassdone:
 
-	data = dataOrig;
-	dprintf("render3 commands start -------------------------\n");
-	while ( 1 ) {
-		data = PADP(data, sizeof(void *));
-		switch (*(const int *)data) {
-		case RC_SCREENSHOT:
-			dprintf("r3 takescreenshot\n");
-			data = RB_TakeScreenshotCmd( data );
-			break;
-		case RC_VIDEOFRAME:
-			dprintf("r3 takevideoframe\n");
-			data = RB_TakeVideoFrameCmd(data, &shotDataMain);
-			break;
-		case RC_END_OF_LIST:
-			t2 = ri.RealMilliseconds();
-			backEnd.pc.msec = t2 - t1;
-			goto thirdpassdone;
-		default:
-			data = RB_SkipRenderCommand(data);
-			break;
+	// captures call back into the engine, the render thread leaves them for
+	// the main thread
+	if ( captureCommand ) {
+		if ( RB_OnRenderThread() ) {
+			backEnd.captureCommands = dataOrig;
+		} else {
+			RB_ExecuteCaptureCommands( dataOrig );
 		}
 	}
 
- thirdpassdone:
+	t2 = ri.RealMilliseconds();
+	backEnd.pc.msec = t2 - t1;
 
 #if 0
 	if (tr.usingMultiSample) {
@@ -2493,3 +2533,175 @@ void RB_ExecuteRenderCommands( const void *data ) {
 	//ri.Printf(PRINT_ALL, "done.\n");
 	return;
 }
+
+
+/*
+=============================================================
+
+RENDER THREAD MESSAGES
+
+ri.Error() longjmps into the main thread's stack and ri.Printf() goes
+through the console, neither can be used from the render thread.  While
+it runs they're replaced: on the render thread messages are latched in
+backEnd and an error abandons the rest of the frame, the front end
+prints them and raises the error at the next sync.
+
+=============================================================
+*/
+
+static Q_THREAD_LOCAL qboolean onRenderThread = qfalse;
+static jmp_buf renderThreadAbort;
+
+static void (QDECL *engineError)( int errorLevel, const char *fmt, ... ) __attribute__ ((noreturn, format (printf, 2, 3)));
+static void (QDECL *enginePrintf)( int printLevel, const char *fmt, ... ) __attribute__ ((format (printf, 2, 3)));
+
+static void QDECL RB_ThreadError( int errorLevel, const char *fmt, ... ) __attribute__ ((noreturn, format (printf, 2, 3)));
+static void QDECL RB_ThreadPrintf( int printLevel, const char *fmt, ... ) __attribute__ ((format (printf, 2, 3)));
+
+static void QDECL RB_ThreadError( int errorLevel, const char *fmt, ... ) {
+	va_list	argptr;
+	char	msg[MAX_PRINT_MSG];
+
+	va_start( argptr, fmt );
+	Q_vsnprintf( msg, sizeof( msg ), fmt, argptr );
+	va_end( argptr );
+
+	if ( !onRenderThread ) {
+		engineError( errorLevel, "%s", msg );
+	}
+
+	if ( !backEnd.threadError ) {
+		backEnd.threadError = qtrue;
+		backEnd.threadErrorLevel = errorLevel;
+		Q_strncpyz( backEnd.threadErrorMessage, msg, sizeof( backEnd.threadErrorMessage ) );
+	}
+
+	longjmp( renderThreadAbort, 1 );
+}
+
+static void QDECL RB_ThreadPrintf( int printLevel, const char *fmt, ... ) {
+	va_list	argptr;
+	char	msg[MAX_PRINT_MSG];
+
+	va_start( argptr, fmt );
+	Q_vsnprintf( msg, sizeof( msg ), fmt, argptr );
+	va_end( argptr );
+
+	if ( !onRenderThread ) {
+		enginePrintf( printLevel, "%s", msg );
+		return;
+	}
+
+	// developer prints are dropped, the cvar can't be checked here
+	if ( printLevel == PRINT_DEVELOPER ) {
+		return;
+	}
+
+	if ( printLevel == PRINT_WARNING ) {
+		Q_strcat( backEnd.threadPrints, sizeof( backEnd.threadPrints ), S_COLOR_YELLOW "WARNING: " );
+	}
+	Q_strcat( backEnd.threadPrints, sizeof( backEnd.threadPrints ), msg );
+}
+
+/*
+================
+RB_FlushThreadMessages
+
+Called by the front end with the render thread idle.
+================
+*/
+void RB_FlushThreadMessages( void ) {
+	if ( backEnd.threadPrints[0] ) {
+		enginePrintf( PRINT_ALL, "%s", backEnd.threadPrints );
+		backEnd.threadPrints[0] = '\0';
+	}
+
+	if ( backEnd.threadError ) {
+		backEnd.threadError = qfalse;
+		engineError( backEnd.threadErrorLevel, "%s", backEnd.threadErrorMessage );
+	}
+}
+
+/*
+================
+RB_FlushCaptureCommands
+
+Called by the front end with the render thread idle.  Writing a video
+frame can close the avi and sync again, so the pending list is cleared
+first.
+================
+*/
+void RB_FlushCaptureCommands( void ) {
+	const void *data;
+
+	data = backEnd.captureCommands;
+	if ( !data ) {
+		return;
+	}
+
+	backEnd.captureCommands = NULL;
+	RB_ExecuteCaptureCommands( data );
+}
+
+qboolean RB_OnRenderThread( void ) {
+	return onRenderThread;
+}
+
+void RB_InitThreadMessages( void ) {
+	engineError = ri.Error;
+	enginePrintf = ri.Printf;
+	ri.Error = RB_ThreadError;
+	ri.Printf = RB_ThreadPrintf;
+}
+
+void RB_ShutdownThreadMessages( void ) {
+	if ( !engineError ) {
+		return;
+	}
+
+	ri.Error = engineError;
+	ri.Printf = enginePrintf;
+	engineError = NULL;
+	enginePrintf = NULL;
+
+	// too late to raise it
+	if ( backEnd.threadPrints[0] ) {
+		ri.Printf( PRINT_ALL, "%s", backEnd.threadPrints );
+		backEnd.threadPrints[0] = '\0';
+	}
+	if ( backEnd.threadError ) {
+		ri.Printf( PRINT_WARNING, "render thread: %s\n", backEnd.threadErrorMessage );
+		backEnd.threadError = qfalse;
+	}
+}
+
+
+/*
+================
+RB_RenderThread
+
+Runs the back end on its own thread when r_smp is enabled
+================
+*/
+void RB_RenderThread( void ) {
+	const void	*data;
+
+	onRenderThread = qtrue;
+
+	// wait for either a rendering command or a quit command
+	while ( 1 ) {
+		// sleep until we have work to do
+		data = GLimp_RendererSleep();
+
+		if ( !data ) {
+			return;	// all done, renderer is shutting down
+		}
+
+		if ( setjmp( renderThreadAbort ) ) {
+			// ri.Error(), the rest of the frame is dropped
+			continue;
+		}
+
+		RB_ExecuteRenderCommands( data );
+	}
+}
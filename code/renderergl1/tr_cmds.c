@@ -71,13 +71,96 @@ void R_PerformanceCounters( void ) {
 }
 
 
+/*
+====================
+R_InitCommandBuffers
+====================
+*/
+void R_InitCommandBuffers( void ) {
+	glConfig.smpActive = qfalse;
+	if ( r_smp->integer  &&  smpBackEndData[1] ) {
+		ri.Printf( PRINT_ALL, "Trying SMP acceleration...\n" );
+		RB_InitThreadMessages();
+		if ( GLimp_SpawnRenderThread( RB_RenderThread ) ) {
+			ri.Printf( PRINT_ALL, "...succeeded.\n" );
+			glConfig.smpActive = qtrue;
+		} else {
+			RB_ShutdownThreadMessages();
+			ri.Printf( PRINT_ALL, "...failed.\n" );
+		}
+	}
+}
+
+/*
+====================
+R_ShutdownCommandBuffers
+====================
+*/
+void R_ShutdownCommandBuffers( void ) {
+	// kill the rendering thread
+	if ( glConfig.smpActive ) {
+		GLimp_FrontEndSleep();
+		RB_FlushCaptureCommands();
+		GLimp_WakeRenderer( NULL );
+		GLimp_ShutdownRenderThread();
+		RB_ShutdownThreadMessages();
+		glConfig.smpActive = qfalse;
+	}
+}
+
+/*
+====================
+R_SyncRenderThread
+
+Waits for the render thread to go idle and takes the gl context back.
+Anything in the front end that calls gl directly has to do this first.
+====================
+*/
+void R_SyncRenderThread( void ) {
+	if ( !glConfig.smpActive ) {
+		return;
+	}
+	GLimp_FrontEndSleep();
+
+	// screenshots and video frames from the last frame it drew
+	RB_FlushCaptureCommands();
+
+	// errors from the last frame it drew
+	RB_FlushThreadMessages();
+}
+
+/*
+====================
+R_RunVideoMaps
+
+The cinematic code belongs to the engine, so video maps drawn on the
+render thread are run and uploaded here before it's woken up.
+====================
+*/
+static void R_RunVideoMaps( unsigned int videoMaps ) {
+	int i;
+
+	for ( i = 0; i < 32; i++ ) {
+		if ( videoMaps & ( 1u << i ) ) {
+			ri.CIN_RunCinematic( i );
+			ri.CIN_UploadCinematic( i );
+		}
+	}
+}
+
 /*
 ====================
 R_IssueRenderCommands
+
+With the render thread running only the end of frame flip is executed
+in the background: the front end moves on to the other backEndData
+while this one is drawn.  Other calls run the commands here since the
+front end keeps adding to the same buffers afterwards.
 ====================
 */
 void R_IssueRenderCommands( qboolean runPerformanceCounters ) {
 	renderCommandList_t	*cmdList;
+	qboolean threaded;
 
 	cmdList = &backEndData->commands;
 	assert(cmdList);
@@ -87,14 +170,41 @@ void R_IssueRenderCommands( qboolean runPerformanceCounters ) {
 	// clear it out, in case this is a sync and not a buffer flip
 	cmdList->used = 0;
 
+	threaded = qfalse;
+	if ( glConfig.smpActive ) {
+		// sleep until the renderer has completed the last frame
+		ri.ProfileBegin("R_SyncRenderThread");
+		R_SyncRenderThread();
+		ri.ProfileEnd();
+
+		// screenshots and video frames are written at the next sync and
+		// video maps are run below, but split stereo capture and overdraw
+		// measurement call back into the engine while drawing,
+		// fullscreen toggling is done in GLimp_EndFrame()
+		threaded = runPerformanceCounters  &&  !r_measureOverdraw->integer  &&  !r_fullscreen->modified  &&  !( tr.recordingVideo  &&  r_anaglyphMode->integer == 19  &&  *ri.SplitVideo );
+
+		if ( threaded  &&  backEndData->videoMaps ) {
+			R_RunVideoMaps( backEndData->videoMaps );
+		}
+		backEndData->videoMaps = 0;
+	}
+
+	// at this point, the back end thread is idle, so it is ok
+	// to look at its performance counters
 	if ( runPerformanceCounters ) {
 		R_PerformanceCounters();
 	}
 
 	// actually start the commands going
 	if ( !r_skipBackEnd->integer ) {
-		// let it start on the new batch
-		RB_ExecuteRenderCommands( cmdList->cmds );
+		if ( threaded ) {
+			GLimp_WakeRenderer( cmdList->cmds );
+		} else {
+			// let it start on the new batch
+			ri.ProfileBegin("RB_ExecuteRenderCommands");
+			RB_ExecuteRenderCommands( cmdList->cmds );
+			ri.ProfileEnd();
+		}
 	}
 }
 
@@ -162,6 +272,27 @@ void *R_GetCommandBuffer( int bytes ) {
 }
 
 
+/*
+=============
+R_AddVideoMaps
+
+Marks the cinematics a shader draws for R_RunVideoMaps()
+=============
+*/
+static void R_AddVideoMaps( const shader_t *shader ) {
+	int i;
+
+	if ( !shader->hasVideoMap ) {
+		return;
+	}
+
+	for ( i = 0; i < MAX_SHADER_STAGES && shader->stages[i]; i++ ) {
+		if ( shader->stages[i]->bundle[0].isVideoMap ) {
+			backEndData->videoMaps |= 1u << ( shader->stages[i]->bundle[0].videoMapHandle & 31 );
+		}
+	}
+}
+
 /*
 =============
 R_AddDrawSurfCmd
@@ -177,11 +308,23 @@ void	R_AddDrawSurfCmd( drawSurf_t *drawSurfs, int numDrawSurfs ) {
 	}
 	cmd->commandId = RC_DRAW_SURFS;
 
+	if ( glConfig.smpActive ) {
+		int i;
+
+		for ( i = 0; i < numDrawSurfs; i++ ) {
+			R_AddVideoMaps( tr.sortedShaders[ ( drawSurfs[i].sort >> QSORT_SHADERNUM_SHIFT ) & (MAX_SHADERS-1) ] );
+		}
+	}
+
 	cmd->drawSurfs = drawSurfs;
 	cmd->numDrawSurfs = numDrawSurfs;
 
 	cmd->refdef = tr.refdef;
 	cmd->viewParms = tr.viewParms;
+
+	// the back end only sees the dlights kept for this view
+	cmd->refdef.num_dlights = cmd->viewParms.num_dlights;
+	cmd->refdef.dlights = cmd->viewParms.dlights;
 }
 
 
@@ -234,6 +377,9 @@ void RE_StretchPic ( float x, float y, float w, float h,
 	}
 	cmd->commandId = RC_STRETCH_PIC;
 	cmd->shader = R_GetShaderByHandle( hShader );
+	if ( glConfig.smpActive ) {
+		R_AddVideoMaps( cmd->shader );
+	}
 	cmd->x = x;
 	cmd->y = y;
 	cmd->w = w;
@@ -313,6 +459,10 @@ void RE_BeginFrame (stereoFrame_t stereoFrame, qboolean recordingVideo)
 
 	tr.frameCount++;
 	tr.frameSceneNum = 0;
+	if ( recordingVideo != tr.recordingVideo ) {
+		// the back end checks it for stereo capture
+		R_SyncRenderThread();
+	}
 	tr.recordingVideo = recordingVideo;
 
 	//
@@ -382,6 +532,7 @@ void RE_BeginFrame (stereoFrame_t stereoFrame, qboolean recordingVideo)
 			R_IssuePendingRenderCommands();
 		}
 
+		R_SyncRenderThread();
 		if ((err = qglGetError()) != GL_NO_ERROR)
 			ri.Error(ERR_FATAL, "RE_BeginFrame() - glGetError() failed (0x%x)!", err);
 	}
@@ -408,6 +559,7 @@ void RE_BeginFrame (stereoFrame_t stereoFrame, qboolean recordingVideo)
 			{
 				// clear both, front and backbuffer.
 
+				R_SyncRenderThread();
 				qglColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 				qglClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 
@@ -471,6 +623,7 @@ void RE_BeginFrame (stereoFrame_t stereoFrame, qboolean recordingVideo)
 
 			if(r_anaglyphMode->modified)
 			{
+				R_SyncRenderThread();
 				qglColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 				r_anaglyphMode->modified = qfalse;
 			}
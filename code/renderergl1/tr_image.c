@@ -24,6 +24,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 static byte			 s_intensitytable[256];
 static unsigned char s_gammatable[256];
+static qboolean s_gammaIdentity;  // s_gammatable doesn't change anything
 static byte			 s_lightmapintensitytable[256];
 static unsigned char s_lightmapgammatable[256];
 
@@ -43,6 +44,10 @@ void R_GammaCorrect( byte *buffer, int bufSize ) {
 		return;
 	}
 
+	if (s_gammaIdentity) {
+		return;
+	}
+
 	for ( i = 0; i < bufSize; i++ ) {
 		buffer[i] = s_gammatable[buffer[i]];
 	}
@@ -949,6 +954,8 @@ image_t *R_CreateImage( const char *name, byte *pic, int width, int height,
 		ri.Error( ERR_DROP, "R_CreateImage: MAX_DRAWIMAGES (%d) hit", MAX_DRAWIMAGES);
 	}
 
+	R_SyncRenderThread();
+
 	image = tr.images[tr.numImages] = ri.Hunk_Alloc( sizeof( image_t ), h_low );
 	// can't hardcode anymore since additional textures are being used
 	// with glGenTextures()
@@ -1639,6 +1646,14 @@ void R_SetColorMappings( void ) {
 		s_gammatable[i] = inf;
 	}
 
+	s_gammaIdentity = qtrue;
+	for (i = 0;  i < 256;  i++) {
+		if (s_gammatable[i] != i) {
+			s_gammaIdentity = qfalse;
+			break;
+		}
+	}
+
 	for (i=0 ; i<256 ; i++) {
 		j = i * r_intensity->value;
 		if (j > 255) {
@@ -60,6 +60,9 @@ cvar_t	*r_zproj;
 cvar_t	*r_stereoSeparation;
 
 cvar_t	*r_skipBackEnd;
+cvar_t	*r_smp;
+cvar_t	*r_simd;
+cvar_t	*r_worldThreads;
 
 cvar_t	*r_stereoEnabled;
 cvar_t	*r_anaglyphMode;
@@ -1290,6 +1293,8 @@ void R_LevelShot( void ) {
 
 	Com_sprintf(checkname, sizeof(checkname), "levelshots/%s.tga", tr.world->baseName);
 
+	R_SyncRenderThread();
+
 	source = ri.Hunk_AllocateTempMemory( glConfig.vidWidth * glConfig.vidHeight * 3 );
 
 	buffer = ri.Hunk_AllocateTempMemory( 128 * 128*3 + 18);
@@ -1779,6 +1784,9 @@ void R_Register( void )
 	r_ext_compressed_textures = ri.Cvar_Get( "r_ext_compressed_textures", "0", CVAR_ARCHIVE | CVAR_LATCH );
 	r_ext_multitexture = ri.Cvar_Get( "r_ext_multitexture", "1", CVAR_ARCHIVE | CVAR_LATCH );
 	r_ext_compiled_vertex_array = ri.Cvar_Get( "r_ext_compiled_vertex_array", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	r_smp = ri.Cvar_Get( "r_smp", "0", CVAR_ARCHIVE | CVAR_LATCH );
+	r_simd = ri.Cvar_Get( "r_simd", "1", CVAR_ARCHIVE );
+	r_worldThreads = ri.Cvar_Get( "r_worldThreads", "-1", CVAR_ARCHIVE | CVAR_LATCH );
 	r_ext_texture_env_add = ri.Cvar_Get( "r_ext_texture_env_add", "1", CVAR_ARCHIVE | CVAR_LATCH);
 
 	r_ext_texture_filter_anisotropic = ri.Cvar_Get( "r_ext_texture_filter_anisotropic",
@@ -1978,6 +1986,9 @@ void R_Register( void )
 	ri.Cmd_AddCommand( "minimize", GLimp_Minimize );
 	ri.Cmd_AddCommand( "createcolorskins", R_CreateColorSkins_f );
 	ri.Cmd_AddCommand( "printviewparms", R_PrintViewParms_f );
+#if idsse2
+	ri.Cmd_AddCommand( "comparesimd", R_CompareSimd_f );
+#endif
 	ri.Cmd_AddCommand( "remaplasttwoshaders", R_RemapLastTwoShaders_f );
 	ri.Cmd_AddCommand( "listremappedshaders", R_ListRemappedShaders_f );
 	ri.Cmd_AddCommand( "clearallremappedshaders", R_ClearAllRemappedShaders_f );
@@ -2057,10 +2068,19 @@ void R_Init( void ) {
 	if (max_polyverts < MAX_POLYVERTS)
 		max_polyverts = MAX_POLYVERTS;
 
-	ptr = ri.Hunk_Alloc( sizeof( *backEndData ) + sizeof(srfPoly_t) * max_polys + sizeof(polyVert_t) * max_polyverts, h_low);
-	backEndData = (backEndData_t *) ptr;
-	backEndData->polys = (srfPoly_t *) ((char *) ptr + sizeof( *backEndData ));
-	backEndData->polyVerts = (polyVert_t *) ((char *) ptr + sizeof( *backEndData ) + sizeof(srfPoly_t) * max_polys);
+	for ( i = 0; i < SMP_FRAMES; i++ ) {
+		// the second one is only needed by the render thread
+		if ( i > 0  &&  !r_smp->integer ) {
+			smpBackEndData[i] = NULL;
+			continue;
+		}
+		ptr = ri.Hunk_Alloc( sizeof( *backEndData ) + sizeof(srfPoly_t) * max_polys + sizeof(polyVert_t) * max_polyverts, h_low);
+		smpBackEndData[i] = (backEndData_t *) ptr;
+		smpBackEndData[i]->polys = (srfPoly_t *) ((char *) ptr + sizeof( *backEndData ));
+		smpBackEndData[i]->polyVerts = (polyVert_t *) ((char *) ptr + sizeof( *backEndData ) + sizeof(srfPoly_t) * max_polys);
+	}
+	tr.smpFrame = 0;
+	backEndData = smpBackEndData[0];
 	R_InitNextFrame();
 
 	InitOpenGL();
@@ -2084,6 +2104,15 @@ void R_Init( void ) {
 	// print info
 	GfxInfo_f();
 
+	R_InitCommandBuffers();
+	R_InitWorldWorkers();
+
+#if idsse2
+	if ( ri.Cvar_VariableIntegerValue( "developer" ) ) {
+		R_CheckSimd();
+	}
+#endif
+
 	ri.Printf( PRINT_ALL, "----- finished R_Init -----\n" );
 }
 
@@ -2109,11 +2138,17 @@ void RE_Shutdown( qboolean destroyWindow ) {
 	ri.Cmd_RemoveCommand( "minimize" );
 	ri.Cmd_RemoveCommand( "createcolorskins" );
 	ri.Cmd_RemoveCommand( "printviewparms" );
+#if idsse2
+	ri.Cmd_RemoveCommand( "comparesimd" );
+#endif
 	ri.Cmd_RemoveCommand( "remaplasttwoshaders" );
 	ri.Cmd_RemoveCommand( "listremappedshaders" );
 	ri.Cmd_RemoveCommand( "clearallremappedshaders" );
 
 
+	R_ShutdownCommandBuffers();
+	R_ShutdownWorldWorkers();
+
 	if ( tr.registered ) {
 		R_IssuePendingRenderCommands();
 		R_DeleteQLGlslShadersAndPrograms();
@@ -2192,6 +2227,7 @@ refexport_t *GetRefAPI ( int apiVersion, refimport_t *rimp ) {
 
 	re.BeginFrame = RE_BeginFrame;
 	re.EndFrame = RE_EndFrame;
+	re.SyncRenderThread = R_SyncRenderThread;
 
 	re.MarkFragments = R_MarkFragments;
 	re.LerpTag = R_LerpTag;
@@ -2199,6 +2235,7 @@ refexport_t *GetRefAPI ( int apiVersion, refimport_t *rimp ) {
 
 	re.ClearScene = RE_ClearScene;
 	re.AddRefEntityToScene = RE_AddRefEntityToScene;
+	re.AddRefEntitiesToScene = RE_AddRefEntitiesToScene;
 	re.AddRefEntityPtrToScene = RE_AddRefEntityPtrToScene;
 	re.SetPathLines = RE_SetPathLines;
 	re.AddPolyToScene = RE_AddPolyToScene;
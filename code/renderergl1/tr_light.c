@@ -62,14 +62,13 @@ void R_DlightBmodel( bmodel_t *bmodel ) {
 	int			i, j;
 	dlight_t	*dl;
 	int			mask;
-	msurface_t	*surf;
 
 	// transform all the lights
-	R_TransformDlights( tr.refdef.num_dlights, tr.refdef.dlights, &tr.or );
+	R_TransformDlights( tr.viewParms.num_dlights, tr.viewParms.dlights, &tr.or );
 
 	mask = 0;
-	for ( i=0 ; i<tr.refdef.num_dlights ; i++ ) {
-		dl = &tr.refdef.dlights[i];
+	for ( i=0 ; i<tr.viewParms.num_dlights ; i++ ) {
+		dl = &tr.viewParms.dlights[i];
 
 		// see if the point is close enough to the bounds to matter
 		for ( j = 0 ; j < 3 ; j++ ) {
@@ -89,19 +88,6 @@ void R_DlightBmodel( bmodel_t *bmodel ) {
 	}
 
 	tr.currentEntity->needDlights = (mask != 0);
-
-	// set the dlight bits in all the surfaces
-	for ( i = 0 ; i < bmodel->numSurfaces ; i++ ) {
-		surf = bmodel->firstSurface + i;
-
-		if ( *surf->data == SF_FACE ) {
-			((srfSurfaceFace_t *)surf->data)->dlightBits = mask;
-		} else if ( *surf->data == SF_GRID ) {
-			((srfGridMesh_t *)surf->data)->dlightBits = mask;
-		} else if ( *surf->data == SF_TRIANGLES ) {
-			((srfTriangles_t *)surf->data)->dlightBits = mask;
-		}
-	}
 }
 
 
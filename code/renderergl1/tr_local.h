@@ -38,6 +38,14 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "../renderercommon/qgl.h"
 #include "../renderercommon/iqm.h"
 
+// sse2 versions of the md3 lerp and vertex lighting, see r_simd
+#if (idx64 || (id386 && (defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))) && !defined(C_ONLY)
+#define idsse2 1
+#include <emmintrin.h>
+#else
+#define idsse2 0
+#endif
+
 #define fcheckgl() do { GLenum err; err = qglGetError(); if (err) ri.Error(ERR_FATAL, "^1opengl error 0x%x  file:'%s'  line:%d", err, __FILE__, __LINE__); } while (0);
 
 //#define fcheckgl() do { GLenum err; err = qglGetError(); if (err) ri.Printf(PRINT_ALL, "^1opengl error 0x%x  file:'%s'  line:%d\n", err, __FILE__, __LINE__); *(int *)0 = 0x666666; } while(0);
@@ -55,6 +63,9 @@ typedef unsigned int glIndex_t;
 #define	MAX_SKINS				1024
 
 
+// the front end fills one while the r_smp render thread draws the other
+#define	SMP_FRAMES		2
+
 #define	MAX_DRAWSURFS			0x10000
 #define	DRAWSURF_MASK			(MAX_DRAWSURFS-1)
 
@@ -409,6 +420,9 @@ typedef struct shader_s {
 
 	qboolean	isSky;
 	skyParms_t	sky;
+
+	qboolean	hasVideoMap;			// a stage plays a cinematic, see R_AddVideoMaps()
+
 	fogParms_t	fogParms;
 
 	float		portalRange;			// distance to fog out at
@@ -539,6 +553,10 @@ typedef struct {
 	vec3_t		visBounds[2];
 	float		zFar;
 	stereoFrame_t	stereoFrame;
+
+	// the scene's dlights this view uses, see R_CullDlights()
+	int			num_dlights;
+	dlight_t	dlights[MAX_DLIGHTS];
 } viewParms_t;
 
 
@@ -572,6 +590,7 @@ typedef struct drawSurf_s {
 	//unsigned			sort;			// bit combination for fast compares
 	uint64_t sort;
 	surfaceType_t		*surface;		// any of surface*_t
+	int					dlightBits;		// dlights touching the surface in its view
 } drawSurf_t;
 
 #define	MAX_FACE_POINTS		64
@@ -600,9 +619,6 @@ typedef struct srfFlare_s {
 typedef struct srfGridMesh_s {
 	surfaceType_t	surfaceType;
 
-	// dynamic lighting information
-	int				dlightBits;
-
 	// culling information
 	vec3_t			meshBounds[2];
 	vec3_t			localOrigin;
@@ -630,9 +646,6 @@ typedef struct {
 	surfaceType_t	surfaceType;
 	cplane_t	plane;
 
-	// dynamic lighting information
-	int			dlightBits;
-
 	// triangle definitions (no normals at points)
 	int			numPoints;
 	int			numIndices;
@@ -646,9 +659,6 @@ typedef struct {
 typedef struct {
 	surfaceType_t	surfaceType;
 
-	// dynamic lighting information
-	int				dlightBits;
-
 	// culling information (FIXME: use this!)
 	vec3_t			bounds[2];
 	vec3_t			localOrigin;
@@ -709,6 +719,12 @@ typedef struct srfIQModel_s {
 
 extern	void (*rb_surfaceTable[SF_NUM_SURFACE_TYPES])(void *);
 
+#if idsse2
+void R_CompareSimd_f( void );
+void R_CheckSimd( void );
+void RB_CompareSimdLighting( int *maxColor, int *maxAlpha );
+#endif
+
 /*
 ==============================================================================
 
@@ -754,6 +770,22 @@ typedef struct mnode_s {
 	int			nummarksurfaces;
 } mnode_t;
 
+// the parts of mnode_t the world walk reads for every node, packed
+// together so it doesn't pull the rest of the node into the cache
+typedef struct {
+	float		mins[4];		// [3] is padding
+	float		maxs[4];
+	int			children[2];	// node indexes
+	int			contents;
+	int			visframe;		// same as mnode_t visframe
+} worldCullNode_t;
+
+typedef struct {
+	int			node;
+	unsigned int	planeBits;
+	unsigned int	dlightBits;
+} worldCullStack_t;
+
 typedef struct {
 	vec3_t		bounds[2];		// for culling
 	msurface_t	*firstSurface;
@@ -778,6 +810,14 @@ typedef struct {
 	int			numDecisionNodes;
 	mnode_t		*nodes;
 
+	// front end culling data and per view scratch space, see tr_world.c
+	worldCullNode_t	*cullNodes;
+	worldCullStack_t	*cullStack;
+	int			*cullLeafs;			// leaf node, dlight bits pairs
+	msurface_t	**cullSurfaces;
+	int			*cullSurfaceDlights;
+	drawSurf_t	*cullDrawSurfs;
+
 	int			numsurfaces;
 	msurface_t	*surfaces;
 
@@ -958,6 +998,19 @@ typedef struct {
 	byte		color2D[4];
 	qboolean	vertexes2D;		// shader needs to be finished
 	trRefEntity_t	entity2D;	// currentEntity will point at this when doing 2D rendering
+
+	int		smpFrame;		// which smpBackEndData is being drawn
+	int		dlightBits;		// of the draw surface being tessellated
+
+	// latched on the render thread, see RB_FlushThreadMessages()
+	qboolean	threadError;
+	int			threadErrorLevel;
+	char		threadErrorMessage[MAX_STRING_CHARS];
+	char		threadPrints[MAX_STRING_CHARS * 4];
+
+	// screenshots and video frames left by the render thread, see
+	// RB_FlushCaptureCommands()
+	const void	*captureCommands;
 } backEndState_t;
 
 /*
@@ -1098,6 +1151,7 @@ typedef struct {
 	qboolean usingFboStencil;
 
 	qboolean recordingVideo;
+	int smpFrame;  // which smpBackEndData the front end is filling
 
 	char markSurfaceNames[2][MAX_QPATH];
 
@@ -1245,6 +1299,9 @@ extern	cvar_t	*r_portalOnly;
 extern	cvar_t	*r_subdivisions;
 extern	cvar_t	*r_lodCurveError;
 extern	cvar_t	*r_skipBackEnd;
+extern	cvar_t	*r_smp;
+extern	cvar_t	*r_simd;
+extern	cvar_t	*r_worldThreads;
 
 extern	cvar_t	*r_anaglyphMode;
 //extern cvar_t *r_anaglyphModeFullRgb;
@@ -1334,6 +1391,25 @@ void R_DecomposeSort( uint64_t sort, int *entityNum, shader_t **shader,
 
 void R_AddDrawSurf( surfaceType_t *surface, shader_t *shader, int fogIndex, int dlightMap );
 
+/*
+=================
+R_ComposeDrawSurf
+
+Fills in a draw surface for the current entity.  The sort key only
+records whether the surface is dlit, the dlights it needs are kept in
+dlightBits so every view has its own.
+=================
+*/
+static ID_INLINE void R_ComposeDrawSurf( drawSurf_t *ds, surfaceType_t *surface, shader_t *shader,
+										 int fogIndex, int dlightMap, int dlightBits ) {
+	// the sort data is packed into a single 64 bit value so it can be
+	// compared quickly during the qsorting process
+	ds->sort = ((uint64_t)shader->sortedIndex << QSORT_SHADERNUM_SHIFT)
+		| (uint64_t)(tr.shiftedEntityNum | ( fogIndex << QSORT_FOGNUM_SHIFT ) | dlightMap);
+	ds->surface = surface;
+	ds->dlightBits = dlightBits;
+}
+
 
 #define	CULL_IN		0		// completely unclipped
 #define	CULL_CLIP	1		// clipped by one or more planes
@@ -1558,6 +1634,9 @@ WORLD MAP
 
 void R_AddBrushModelSurfaces( trRefEntity_t *e );
 void R_AddWorldSurfaces( void );
+void R_InitWorldCull( world_t *world );
+void R_InitWorldWorkers( void );
+void R_ShutdownWorldWorkers( void );
 qboolean R_inPVS( const vec3_t p1, const vec3_t p2 );
 
 
@@ -1655,6 +1734,7 @@ void R_InitNextFrame( void );
 
 void RE_ClearScene( void );
 void RE_AddRefEntityToScene( const refEntity_t *ent );
+void RE_AddRefEntitiesToScene( const refEntity_t *ents, int numEnts );
 void RE_AddRefEntityPtrToScene (refEntity_t *ent);
 void RE_SetPathLines (int *numCameraPoints, cameraPoint_t *cameraPoints, int *numSplinePoints, vec3_t *splinePoints, const vec4_t color);
 void RE_AddPolyToScene( qhandle_t hShader , int numVerts, const polyVert_t *verts, int num, int lightmap );
@@ -1878,27 +1958,42 @@ typedef enum {
 #define	MAX_POLYS		600
 #define	MAX_POLYVERTS	3000
 
+// more lights than the surface bit flags allow can be added, each view
+// keeps the first MAX_DLIGHTS that are visible
+#define	MAX_SCENE_DLIGHTS	( MAX_DLIGHTS * 8 )
+
 // all of the information needed by the back end must be
 // contained in a backEndData_t
 typedef struct {
 	drawSurf_t	drawSurfs[MAX_DRAWSURFS];
-	dlight_t	dlights[MAX_DLIGHTS];
+	dlight_t	dlights[MAX_SCENE_DLIGHTS];
 	trRefEntity_t	entities[MAX_REFENTITIES];
 	srfPoly_t	*polys;//[MAX_POLYS];
 	polyVert_t	*polyVerts;//[MAX_POLYVERTS];
 	renderCommandList_t	commands;
+	unsigned int	videoMaps;		// bit per cinematic handle drawn, the cinematic code can't run on the render thread
 } backEndData_t;
 
 extern	int		max_polys;
 extern	int		max_polyverts;
 
-extern	backEndData_t	*backEndData;	// the second one may not be allocated
+extern	backEndData_t	*backEndData;	// the one the front end is filling
+extern	backEndData_t	*smpBackEndData[SMP_FRAMES];	// the second one may not be allocated
 
 
 void *R_GetCommandBuffer( int bytes );
 void RB_ExecuteRenderCommands( const void *data );
-
+void RB_RenderThread( void );
+void RB_InitThreadMessages( void );
+void RB_ShutdownThreadMessages( void );
+void RB_FlushThreadMessages( void );
+void RB_FlushCaptureCommands( void );
+qboolean RB_OnRenderThread( void );
+
+void R_InitCommandBuffers( void );
+void R_ShutdownCommandBuffers( void );
 void R_IssuePendingRenderCommands( void );
+void R_SyncRenderThread( void );
 
 void R_AddDrawSurfCmd( drawSurf_t *drawSurfs, int numDrawSurfs );
 
@@ -879,8 +879,12 @@ static qboolean SurfIsOffscreen( const drawSurf_t *drawSurf, vec4_t clipDest[128
 
 	R_RotateForViewer();
 
+	// tess belongs to the back end
+	R_SyncRenderThread();
+
 	R_DecomposeSort( drawSurf->sort, &entityNum, &shader, &fogNum, &dlighted );
 	RB_BeginSurface( shader, fogNum );
+	backEnd.dlightBits = drawSurf->dlightBits;
 	rb_surfaceTable[ *drawSurf->surface ]( drawSurf->surface );
 
 	assert( tess.numVertexes < 128 );
@@ -1133,12 +1137,8 @@ void R_AddDrawSurf( surfaceType_t *surface, shader_t *shader,
 	// instead of checking for overflow, we just mask the index
 	// so it wraps around
 	index = tr.refdef.numDrawSurfs & DRAWSURF_MASK;
-	// the sort data is packed into a single 32 bit value so it can be
-	// compared quickly during the qsorting process
-	tr.refdef.drawSurfs[index].sort = ((uint64_t)shader->sortedIndex << QSORT_SHADERNUM_SHIFT)
-		| (uint64_t)(tr.shiftedEntityNum | ( fogIndex << QSORT_FOGNUM_SHIFT ) | (int)dlightMap);
+	R_ComposeDrawSurf( &tr.refdef.drawSurfs[index], surface, shader, fogIndex, dlightMap, 0 );
 	//ri.Printf(PRINT_ALL, "%llu\n", tr.refdef.drawSurfs[index].sort);
-	tr.refdef.drawSurfs[index].surface = surface;
 	tr.refdef.numDrawSurfs++;
 }
 
@@ -1410,6 +1410,8 @@ void R_RenderView (viewParms_t *parms) {
 		return;
 	}
 
+	ri.ProfileBegin("R_RenderView");
+
 	tr.viewCount++;
 
 	tr.viewParms = *parms;
@@ -1439,6 +1441,8 @@ void R_RenderView (viewParms_t *parms) {
 
 	// draw main system development information (surface outlines, etc)
 	R_DebugGraphics();
+
+	ri.ProfileEnd();
 }
 
 
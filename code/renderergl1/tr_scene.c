@@ -43,6 +43,13 @@ R_InitNextFrame
 ====================
 */
 void R_InitNextFrame( void ) {
+	if ( glConfig.smpActive ) {
+		// use the other buffers next frame, because the render thread
+		// may still be drawing from the current ones
+		tr.smpFrame ^= 1;
+		backEndData = smpBackEndData[tr.smpFrame];
+	}
+
 	backEndData->commands.used = 0;
 
 	r_firstSceneDrawSurf = 0;
@@ -231,6 +238,31 @@ void RE_AddRefEntityToScene( const refEntity_t *ent ) {
 	r_numentities++;
 }
 
+/*
+=====================
+RE_AddRefEntitiesToScene
+
+Bulk version of RE_AddRefEntityToScene, lets the cgame hand over a whole
+batch of entities with a single call
+=====================
+*/
+void RE_AddRefEntitiesToScene( const refEntity_t *ents, int numEnts ) {
+	int		i;
+
+	if ( !tr.registered ) {
+		return;
+	}
+
+	if ( numEnts > MAX_REFENTITIES - r_numentities ) {
+		ri.Printf( PRINT_DEVELOPER, "RE_AddRefEntitiesToScene: Dropping %d refEntities, reached MAX_REFENTITIES\n", numEnts - (MAX_REFENTITIES - r_numentities) );
+		numEnts = MAX_REFENTITIES - r_numentities;
+	}
+
+	for ( i = 0; i < numEnts; i++ ) {
+		RE_AddRefEntityToScene( &ents[i] );
+	}
+}
+
 void RE_AddRefEntityPtrToScene (refEntity_t *ent)
 {
 	//RE_AddRefEntityToScene(ent);
@@ -284,7 +316,7 @@ void RE_AddDynamicLightToScene( const vec3_t org, float intensity, float r, floa
 	if ( !tr.registered ) {
 		return;
 	}
-	if ( r_numdlights >= MAX_DLIGHTS ) {
+	if ( r_numdlights >= MAX_SCENE_DLIGHTS ) {
 		return;
 	}
 	if ( intensity <= 0 ) {
@@ -221,6 +221,11 @@ static void R_BindAnimatedImage( textureBundle_t *bundle ) {
 	int64_t	index;
 
 	if ( bundle->isVideoMap ) {
+		if ( RB_OnRenderThread() ) {
+			// the front end already ran and uploaded it, see R_RunVideoMaps()
+			GL_Bind( tr.scratchImage[bundle->videoMapHandle] );
+			return;
+		}
 		ri.CIN_RunCinematic(bundle->videoMapHandle);
 		ri.CIN_UploadCinematic(bundle->videoMapHandle);
 		return;
@@ -1028,7 +1028,7 @@ void RB_CalcRotateTexCoords( float degsPerSecond, float *st )
 */
 vec3_t lightOrigin = { -960, 1980, 96 };		// FIXME: track dynamically
 
-void RB_CalcSpecularAlpha( unsigned char *alphas ) {
+static void RB_CalcSpecularAlpha_scalar( unsigned char *alphas, int firstVertex ) {
 	int			i;
 	float		*v, *normal;
 	vec3_t		viewer,  reflected;
@@ -1037,13 +1037,13 @@ void RB_CalcSpecularAlpha( unsigned char *alphas ) {
 	vec3_t		lightDir;
 	int			numVertexes;
 
-	v = tess.xyz[0];
-	normal = tess.normal[0];
+	v = tess.xyz[firstVertex];
+	normal = tess.normal[firstVertex];
 
-	alphas += 3;
+	alphas += firstVertex * 4 + 3;
 
 	numVertexes = tess.numVertexes;
-	for (i = 0 ; i < numVertexes ; i++, v += 4, normal += 4, alphas += 4) {
+	for (i = firstVertex ; i < numVertexes ; i++, v += 4, normal += 4, alphas += 4) {
 		float ilength;
 
 		VectorSubtract( lightOrigin, v, lightDir );
@@ -1080,6 +1080,92 @@ void RB_CalcSpecularAlpha( unsigned char *alphas ) {
 	}
 }
 
+#if idsse2
+// one Newton-Raphson step on rsqrtps, close to Q_rsqrt()
+static ID_INLINE __m128 RB_RSqrt_sse2( __m128 x )
+{
+	__m128 y;
+
+	y = _mm_rsqrt_ps( x );
+	return _mm_mul_ps( _mm_mul_ps( _mm_set1_ps( 0.5f ), y ), _mm_sub_ps( _mm_set1_ps( 3.0f ), _mm_mul_ps( x, _mm_mul_ps( y, y ) ) ) );
+}
+
+#define DOT_SSE2(ax, ay, az, bx, by, bz) _mm_add_ps( _mm_add_ps( _mm_mul_ps( (ax), (bx) ), _mm_mul_ps( (ay), (by) ) ), _mm_mul_ps( (az), (bz) ) )
+
+// loads four tess vec4_t and returns them as x, y, z rows
+#define LOAD_TRANSPOSED_SSE2(src, x, y, z) do { \
+	__m128 w_; \
+	(x) = _mm_load_ps( (src)[0] ); \
+	(y) = _mm_load_ps( (src)[1] ); \
+	(z) = _mm_load_ps( (src)[2] ); \
+	w_ = _mm_load_ps( (src)[3] ); \
+	_MM_TRANSPOSE4_PS( (x), (y), (z), w_ ); \
+} while (0)
+
+static void RB_CalcSpecularAlpha_sse2( unsigned char *alphas )
+{
+	int			i, j;
+	int			numVertexes;
+	int			b[4] QALIGN(16);
+	__m128		vx, vy, vz, nx, ny, nz;
+	__m128		lx, ly, lz, ex, ey, ez;
+	__m128		d, l, ilength;
+	__m128		zero, two, max;
+
+	zero = _mm_setzero_ps();
+	two = _mm_set1_ps( 2.0f );
+	max = _mm_set1_ps( 255.0f );
+
+	numVertexes = tess.numVertexes & ~3;
+	for (i = 0 ; i < numVertexes ; i += 4) {
+		LOAD_TRANSPOSED_SSE2( &tess.xyz[i], vx, vy, vz );
+		LOAD_TRANSPOSED_SSE2( &tess.normal[i], nx, ny, nz );
+
+		lx = _mm_sub_ps( _mm_set1_ps( lightOrigin[0] ), vx );
+		ly = _mm_sub_ps( _mm_set1_ps( lightOrigin[1] ), vy );
+		lz = _mm_sub_ps( _mm_set1_ps( lightOrigin[2] ), vz );
+		ilength = RB_RSqrt_sse2( DOT_SSE2( lx, ly, lz, lx, ly, lz ) );
+		lx = _mm_mul_ps( lx, ilength );
+		ly = _mm_mul_ps( ly, ilength );
+		lz = _mm_mul_ps( lz, ilength );
+
+		// reflected direction goes back into l
+		d = DOT_SSE2( nx, ny, nz, lx, ly, lz );
+		lx = _mm_sub_ps( _mm_mul_ps( _mm_mul_ps( nx, two ), d ), lx );
+		ly = _mm_sub_ps( _mm_mul_ps( _mm_mul_ps( ny, two ), d ), ly );
+		lz = _mm_sub_ps( _mm_mul_ps( _mm_mul_ps( nz, two ), d ), lz );
+
+		ex = _mm_sub_ps( _mm_set1_ps( backEnd.or.viewOrigin[0] ), vx );
+		ey = _mm_sub_ps( _mm_set1_ps( backEnd.or.viewOrigin[1] ), vy );
+		ez = _mm_sub_ps( _mm_set1_ps( backEnd.or.viewOrigin[2] ), vz );
+		ilength = RB_RSqrt_sse2( DOT_SSE2( ex, ey, ez, ex, ey, ez ) );
+
+		l = _mm_mul_ps( DOT_SSE2( lx, ly, lz, ex, ey, ez ), ilength );
+		l = _mm_max_ps( l, zero );
+		l = _mm_mul_ps( l, l );
+		l = _mm_mul_ps( l, l );
+		_mm_store_si128( (__m128i *)b, _mm_cvttps_epi32( _mm_min_ps( _mm_mul_ps( l, max ), max ) ) );
+
+		for (j = 0;  j < 4;  j++) {
+			alphas[(i + j) * 4 + 3] = b[j];
+		}
+	}
+
+	RB_CalcSpecularAlpha_scalar( alphas, numVertexes );
+}
+#endif
+
+void RB_CalcSpecularAlpha( unsigned char *alphas )
+{
+#if idsse2
+	if (r_simd->integer) {
+		RB_CalcSpecularAlpha_sse2( alphas );
+		return;
+	}
+#endif
+	RB_CalcSpecularAlpha_scalar( alphas, 0 );
+}
+
 /*
 ** RB_CalcDiffuseColor
 **
@@ -1156,7 +1242,7 @@ static void RB_CalcDiffuseColor_altivec( unsigned char *colors )
 }
 #endif
 
-static void RB_CalcDiffuseColor_scalar( unsigned char *colors )
+static void RB_CalcDiffuseColor_scalar( unsigned char *colors, int firstVertex )
 {
 	int				i, j;
 	float			*v, *normal;
@@ -1173,11 +1259,11 @@ static void RB_CalcDiffuseColor_scalar( unsigned char *colors )
 	VectorCopy( ent->directedLight, directedLight );
 	VectorCopy( ent->lightDir, lightDir );
 
-	v = tess.xyz[0];
-	normal = tess.normal[0];
+	v = tess.xyz[firstVertex];
+	normal = tess.normal[firstVertex];
 
 	numVertexes = tess.numVertexes;
-	for (i = 0 ; i < numVertexes ; i++, v += 4, normal += 4) {
+	for (i = firstVertex ; i < numVertexes ; i++, v += 4, normal += 4) {
 		incoming = DotProduct (normal, lightDir);
 		if ( incoming <= 0 ) {
 			*(int *)&colors[i*4] = ambientLightInt;
@@ -1205,8 +1291,62 @@ static void RB_CalcDiffuseColor_scalar( unsigned char *colors )
 	}
 }
 
+#if idsse2
+/*
+** Four vertexes at a time.  Clamping before the conversion gives the same
+** bytes as the scalar version, including the ambient only case.
+*/
+static void RB_CalcDiffuseColor_sse2( unsigned char *colors )
+{
+	int				i;
+	int				numVertexes;
+	trRefEntity_t	*ent;
+	__m128			lightDirX, lightDirY, lightDirZ;
+	__m128			ambientR, ambientG, ambientB;
+	__m128			directedR, directedG, directedB;
+	__m128			nx, ny, nz, incoming;
+	__m128			zero, max;
+	__m128i			r, g, b, alpha;
+
+	ent = backEnd.currentEntity;
+	lightDirX = _mm_set1_ps( ent->lightDir[0] );
+	lightDirY = _mm_set1_ps( ent->lightDir[1] );
+	lightDirZ = _mm_set1_ps( ent->lightDir[2] );
+	ambientR = _mm_set1_ps( ent->ambientLight[0] );
+	ambientG = _mm_set1_ps( ent->ambientLight[1] );
+	ambientB = _mm_set1_ps( ent->ambientLight[2] );
+	directedR = _mm_set1_ps( ent->directedLight[0] );
+	directedG = _mm_set1_ps( ent->directedLight[1] );
+	directedB = _mm_set1_ps( ent->directedLight[2] );
+	zero = _mm_setzero_ps();
+	max = _mm_set1_ps( 255.0f );
+	alpha = _mm_set1_epi32( (int)0xff000000 );
+
+	numVertexes = tess.numVertexes & ~3;
+	for (i = 0 ; i < numVertexes ; i += 4) {
+		LOAD_TRANSPOSED_SSE2( &tess.normal[i], nx, ny, nz );
+		incoming = _mm_max_ps( DOT_SSE2( nx, ny, nz, lightDirX, lightDirY, lightDirZ ), zero );
+
+		r = _mm_cvtps_epi32( _mm_min_ps( _mm_add_ps( ambientR, _mm_mul_ps( incoming, directedR ) ), max ) );
+		g = _mm_cvtps_epi32( _mm_min_ps( _mm_add_ps( ambientG, _mm_mul_ps( incoming, directedG ) ), max ) );
+		b = _mm_cvtps_epi32( _mm_min_ps( _mm_add_ps( ambientB, _mm_mul_ps( incoming, directedB ) ), max ) );
+
+		r = _mm_or_si128( _mm_or_si128( r, _mm_slli_epi32( g, 8 ) ), _mm_or_si128( _mm_slli_epi32( b, 16 ), alpha ) );
+		_mm_storeu_si128( (__m128i *)&colors[i*4], r );
+	}
+
+	RB_CalcDiffuseColor_scalar( colors, numVertexes );
+}
+#endif
+
 void RB_CalcDiffuseColor( unsigned char *colors )
 {
+#if idsse2
+	if (r_simd->integer) {
+		RB_CalcDiffuseColor_sse2( colors );
+		return;
+	}
+#endif
 #if idppc_altivec
 	if (com_altivec->integer) {
 		// must be in a separate function or G3 systems will crash.
@@ -1214,6 +1354,44 @@ void RB_CalcDiffuseColor( unsigned char *colors )
 		return;
 	}
 #endif
-	RB_CalcDiffuseColor_scalar( colors );
+	RB_CalcDiffuseColor_scalar( colors, 0 );
 }
 
+#if idsse2
+/*
+** RB_CompareSimdLighting
+**
+** Largest difference between the sse2 and scalar diffuse color and specular
+** alpha bytes for the vertexes in tess, see R_CheckSimd().
+*/
+void RB_CompareSimdLighting( int *maxColor, int *maxAlpha )
+{
+	unsigned char	*scalar, *simd;
+	int				size;
+	int				i, d;
+
+	size = tess.numVertexes * 4;
+	scalar = ri.Hunk_AllocateTempMemory( size );
+	simd = ri.Hunk_AllocateTempMemory( size );
+
+	RB_CalcDiffuseColor_scalar( scalar, 0 );
+	RB_CalcSpecularAlpha_scalar( scalar, 0 );
+	RB_CalcDiffuseColor_sse2( simd );
+	RB_CalcSpecularAlpha_sse2( simd );
+
+	for ( i = 0 ; i < size ; i++ ) {
+		d = abs( scalar[i] - simd[i] );
+		if ( ( i & 3 ) == 3 ) {
+			if ( d > *maxAlpha ) {
+				*maxAlpha = d;
+			}
+		} else if ( d > *maxColor ) {
+			*maxColor = d;
+		}
+	}
+
+	ri.Hunk_FreeTempMemory( simd );
+	ri.Hunk_FreeTempMemory( scalar );
+}
+#endif
+
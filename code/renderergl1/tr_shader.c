@@ -2123,6 +2123,9 @@ static void SortNewShader( void ) {
 	float	sort;
 	shader_t	*newShader;
 
+	// the render thread looks up shaders by sortedIndex
+	R_SyncRenderThread();
+
 	newShader = tr.shaders[ tr.numShaders - 1 ];
 	sort = newShader->sort;
 
@@ -2385,6 +2388,10 @@ static shader_t *FinishShader( void ) {
 			continue;
 		}
 
+		if ( pStage->bundle[0].isVideoMap ) {
+			shader.hasVideoMap = qtrue;
+		}
+
 		//
 		// ditch this stage if it's detail and detail textures are disabled
 		//
@@ -3606,9 +3613,7 @@ void RE_ReplaceShaderImage (qhandle_t h, const ubyte *data, int width, int heigh
 	//ri.Printf(PRINT_ALL, "image->texum %d  %s\n", image->texnum, image->imgName[0] != '\0' ? image->imgName : "");
 
 
-	//if (r_smp->integer) {
-	//	R_SyncRenderThread();
-	//}
+	R_SyncRenderThread();
 
 	//FIXME lightmaps?
 	GL_SelectTextureUnit(0);
@@ -3691,9 +3696,7 @@ qhandle_t RE_RegisterShaderFromData (const char *name, ubyte *data, int width, i
 	shader_t *shader;
 	int flags = 0;
 
-	//if (r_smp->integer) {
-	//	R_SyncRenderThread();
-	//}
+	R_SyncRenderThread();
 
 	if (mipmap) {
 		flags |= IMGFLAG_MIPMAP;
@@ -3738,9 +3741,7 @@ void RE_GetShaderImageData (qhandle_t h, ubyte *data)
 	//image = &shader->stages[0].bundle[0].image;
 	image = shader->stages[0]->bundle[0].image[0];
 
-	//if (r_smp->integer) {
-	//	R_SyncRenderThread();
-	//}
+	R_SyncRenderThread();
 
 	qglBindTexture(GL_TEXTURE_2D, image->texnum);
 	qglGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
@@ -24,6 +24,9 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #if idppc_altivec && !defined(__APPLE__)
 #include <altivec.h>
 #endif
+#if idsse2
+#include <float.h>
+#endif
 
 /*
 
@@ -340,7 +343,7 @@ static void RB_SurfaceTriangles( srfTriangles_t *srf ) {
 	int			dlightBits;
 	qboolean	needsNormal;
 
-	dlightBits = srf->dlightBits;
+	dlightBits = backEnd.dlightBits;
 	tess.dlightBits |= dlightBits;
 
 	RB_CHECKOVERFLOW( srf->numVerts, srf->numIndexes );
@@ -1207,8 +1210,150 @@ static void LerpMeshVertexes_scalar(md3Surface_t *surf, float backlerp)
    	}
 }
 
+#if idsse2
+/*
+** VectorArrayNormalize_sse2
+*
+* Same input range as VectorArrayNormalize(), four normals at a time.  The
+* rsqrtps estimate gets one Newton-Raphson step like Q_rsqrt().  Lerping
+* between opposite normals can still give zero length, rsqrtps returns
+* infinity for those so they're left at zero like the scalar version does.
+*/
+static void VectorArrayNormalize_sse2(vec4_t *normals, unsigned int count)
+{
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128 three = _mm_set1_ps(3.0f);
+	const __m128 minLengthSquared = _mm_set1_ps(FLT_MIN);
+	__m128 x, y, z, w;
+	__m128 lengthSquared, ilength;
+
+	while (count >= 4) {
+		x = _mm_load_ps(normals[0]);
+		y = _mm_load_ps(normals[1]);
+		z = _mm_load_ps(normals[2]);
+		w = _mm_load_ps(normals[3]);
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+
+		lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+		ilength = _mm_rsqrt_ps(lengthSquared);
+		ilength = _mm_mul_ps(_mm_mul_ps(half, ilength), _mm_sub_ps(three, _mm_mul_ps(lengthSquared, _mm_mul_ps(ilength, ilength))));
+		ilength = _mm_and_ps(ilength, _mm_cmpge_ps(lengthSquared, minLengthSquared));
+
+		x = _mm_mul_ps(x, ilength);
+		y = _mm_mul_ps(y, ilength);
+		z = _mm_mul_ps(z, ilength);
+
+		// w isn't touched, same as the scalar version
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		_mm_store_ps(normals[0], x);
+		_mm_store_ps(normals[1], y);
+		_mm_store_ps(normals[2], z);
+		_mm_store_ps(normals[3], w);
+
+		normals += 4;
+		count -= 4;
+	}
+
+	while (count--) {
+		VectorNormalizeFast(normals[0]);
+		normals++;
+	}
+}
+
+// x, y, z, normal shorts -> x, y, z, 0
+static ID_INLINE __m128 LoadMd3Xyz_sse2(const short *xyz, __m128 scale, __m128 mask)
+{
+	__m128i packed;
+
+	packed = _mm_loadl_epi64((const __m128i *)xyz);
+	packed = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+
+	return _mm_and_ps(_mm_mul_ps(_mm_cvtepi32_ps(packed), scale), mask);
+}
+
+// decode X as cos( lat ) * sin( long )
+// decode Y as sin( lat ) * sin( long )
+// decode Z as cos( long )
+static ID_INLINE __m128 DecodeMd3Normal_sse2(short packedNormal)
+{
+	unsigned lat, lng;
+
+	lat = ( ( packedNormal >> 8 ) & 0xff ) * (FUNCTABLE_SIZE/256);
+	lng = ( packedNormal & 0xff ) * (FUNCTABLE_SIZE/256);
+
+	return _mm_setr_ps(tr.sinTable[(lat+(FUNCTABLE_SIZE/4))&FUNCTABLE_MASK] * tr.sinTable[lng],
+					   tr.sinTable[lat] * tr.sinTable[lng],
+					   tr.sinTable[(lng+(FUNCTABLE_SIZE/4))&FUNCTABLE_MASK],
+					   0.0f);
+}
+
+static void LerpMeshVertexes_sse2(md3Surface_t *surf, float backlerp)
+{
+	short	*oldXyz, *newXyz, *oldNormals, *newNormals;
+	float	*outXyz, *outNormal;
+	__m128	oldXyzScale, newXyzScale;
+	__m128	oldNormalScale, newNormalScale;
+	__m128	xyzMask;
+	int		vertNum;
+	int		numVerts;
+
+	outXyz = tess.xyz[tess.numVertexes];
+	outNormal = tess.normal[tess.numVertexes];
+
+	newXyz = (short *)((byte *)surf + surf->ofsXyzNormals)
+		+ (backEnd.currentEntity->ePtr->frame * surf->numVerts * 4);
+	newNormals = newXyz + 3;
+
+	newXyzScale = _mm_set1_ps(MD3_XYZ_SCALE * (1.0 - backlerp));
+	newNormalScale = _mm_set1_ps(1.0 - backlerp);
+	xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+	numVerts = surf->numVerts;
+
+	if ( backlerp == 0 ) {
+		//
+		// just copy the vertexes
+		//
+		for (vertNum=0 ; vertNum < numVerts ; vertNum++,
+			newXyz += 4, newNormals += 4,
+			outXyz += 4, outNormal += 4)
+		{
+			_mm_store_ps(outXyz, LoadMd3Xyz_sse2(newXyz, newXyzScale, xyzMask));
+			_mm_store_ps(outNormal, DecodeMd3Normal_sse2(newNormals[0]));
+		}
+	} else {
+		//
+		// interpolate and copy the vertex and normal
+		//
+		oldXyz = (short *)((byte *)surf + surf->ofsXyzNormals)
+			+ (backEnd.currentEntity->ePtr->oldframe * surf->numVerts * 4);
+		oldNormals = oldXyz + 3;
+
+		oldXyzScale = _mm_set1_ps(MD3_XYZ_SCALE * backlerp);
+		oldNormalScale = _mm_set1_ps(backlerp);
+
+		for (vertNum=0 ; vertNum < numVerts ; vertNum++,
+			oldXyz += 4, newXyz += 4, oldNormals += 4, newNormals += 4,
+			outXyz += 4, outNormal += 4)
+		{
+			_mm_store_ps(outXyz, _mm_add_ps(LoadMd3Xyz_sse2(oldXyz, oldXyzScale, xyzMask), LoadMd3Xyz_sse2(newXyz, newXyzScale, xyzMask)));
+
+			// FIXME: interpolate lat/long instead?
+			_mm_store_ps(outNormal, _mm_add_ps(_mm_mul_ps(DecodeMd3Normal_sse2(oldNormals[0]), oldNormalScale), _mm_mul_ps(DecodeMd3Normal_sse2(newNormals[0]), newNormalScale)));
+		}
+		VectorArrayNormalize_sse2((vec4_t *)tess.normal[tess.numVertexes], numVerts);
+	}
+}
+#endif  // idsse2
+
 static void LerpMeshVertexes(md3Surface_t *surf, float backlerp)
 {
+#if idsse2
+	if (r_simd->integer) {
+		LerpMeshVertexes_sse2( surf, backlerp );
+		return;
+	}
+#endif
 #if idppc_altivec
 	if (com_altivec->integer) {
 		// must be in a separate function or G3 systems will crash.
@@ -1219,6 +1364,261 @@ static void LerpMeshVertexes(md3Surface_t *surf, float backlerp)
 	LerpMeshVertexes_scalar( surf, backlerp );
 }
 
+#if idsse2
+typedef struct {
+	float	xyz;
+	float	normal;
+	int		numNaNs;
+	int		color;		// diffuse bytes, only filled in by R_CheckSimd()
+	int		alpha;		// specular bytes
+} simdDiff_t;
+
+/*
+=============
+R_CompareLerp
+
+Lerps surf with both the scalar and sse2 code at each frame and halfway to
+the next one.  The scalar result is left in xyz and normal.
+=============
+*/
+static void R_CompareLerp( md3Surface_t *surf, float backlerp, vec4_t *xyz, vec4_t *normal, simdDiff_t *diff ) {
+	refEntity_t		*re;
+	float			d;
+	int				first;
+	int				frame, v, c;
+
+	re = backEnd.currentEntity->ePtr;
+	first = tess.numVertexes;
+
+	for ( frame = 0 ; frame < surf->numFrames ; frame++ ) {
+		re->frame = frame;
+		re->oldframe = backlerp ? ( frame + 1 ) % surf->numFrames : frame;
+
+		LerpMeshVertexes_scalar( surf, backlerp );
+		Com_Memcpy( xyz, tess.xyz[first], surf->numVerts * sizeof( *xyz ) );
+		Com_Memcpy( normal, tess.normal[first], surf->numVerts * sizeof( *normal ) );
+
+		LerpMeshVertexes_sse2( surf, backlerp );
+
+		for ( v = 0 ; v < surf->numVerts ; v++ ) {
+			for ( c = 0 ; c < 3 ; c++ ) {
+				if ( Q_floatIsNan( tess.xyz[first + v][c] )  ||  Q_floatIsNan( tess.normal[first + v][c] ) ) {
+					diff->numNaNs++;
+					continue;
+				}
+				d = fabs( tess.xyz[first + v][c] - xyz[v][c] );
+				if ( d > diff->xyz ) {
+					diff->xyz = d;
+				}
+				d = fabs( tess.normal[first + v][c] - normal[v][c] );
+				if ( d > diff->normal ) {
+					diff->normal = d;
+				}
+			}
+		}
+	}
+}
+
+/*
+=============
+R_CompareSimd_f
+
+Runs R_CompareLerp() on every surface of the loaded md3 models and prints
+the largest differences.  Checks that r_simd doesn't change what's drawn.
+=============
+*/
+void R_CompareSimd_f( void ) {
+	trRefEntity_t	*oldEntity;
+	trRefEntity_t	ent;
+	refEntity_t		re;
+	model_t			*mod;
+	md3Header_t		*md3;
+	md3Surface_t	*surf;
+	vec4_t			*xyz, *normal;
+	simdDiff_t		diff, modelDiff;
+	int				numSurfaces;
+	int				i, j, k;
+
+	if ( !r_simd->integer ) {
+		ri.Printf( PRINT_ALL, "r_simd is 0, the sse2 code isn't used\n" );
+	}
+
+	// the back end may be using tess
+	R_SyncRenderThread();
+
+	xyz = ri.Hunk_AllocateTempMemory( SHADER_MAX_VERTEXES * sizeof( *xyz ) );
+	normal = ri.Hunk_AllocateTempMemory( SHADER_MAX_VERTEXES * sizeof( *normal ) );
+
+	Com_Memset( &ent, 0, sizeof( ent ) );
+	Com_Memset( &re, 0, sizeof( re ) );
+	ent.ePtr = &re;
+	oldEntity = backEnd.currentEntity;
+	backEnd.currentEntity = &ent;
+
+	Com_Memset( &diff, 0, sizeof( diff ) );
+	numSurfaces = 0;
+
+	for ( i = 1 ; i < tr.numModels ; i++ ) {
+		mod = tr.models[i];
+		if ( mod->type != MOD_MESH ) {
+			continue;
+		}
+
+		Com_Memset( &modelDiff, 0, sizeof( modelDiff ) );
+		for ( j = 0 ; j < MD3_MAX_LODS ; j++ ) {
+			md3 = mod->md3[j];
+			if ( !md3  ||  ( j > 0  &&  md3 == mod->md3[j-1] ) ) {
+				continue;
+			}
+
+			surf = (md3Surface_t *)( (byte *)md3 + md3->ofsSurfaces );
+			for ( k = 0 ; k < md3->numSurfaces ; k++, surf = (md3Surface_t *)( (byte *)surf + surf->ofsEnd ) ) {
+				if ( tess.numVertexes + surf->numVerts > SHADER_MAX_VERTEXES ) {
+					continue;
+				}
+				numSurfaces++;
+
+				R_CompareLerp( surf, 0.0f, xyz, normal, &modelDiff );
+				R_CompareLerp( surf, 0.5f, xyz, normal, &modelDiff );
+			}
+		}
+
+		ri.Printf( PRINT_ALL, "%f %f %s\n", modelDiff.xyz, modelDiff.normal, mod->name );
+		if ( modelDiff.xyz > diff.xyz ) {
+			diff.xyz = modelDiff.xyz;
+		}
+		if ( modelDiff.normal > diff.normal ) {
+			diff.normal = modelDiff.normal;
+		}
+		diff.numNaNs += modelDiff.numNaNs;
+	}
+
+	backEnd.currentEntity = oldEntity;
+
+	ri.Hunk_FreeTempMemory( normal );
+	ri.Hunk_FreeTempMemory( xyz );
+
+	ri.Printf( PRINT_ALL, "%i surfaces, max difference xyz %f normal %f, %i nan\n", numSurfaces, diff.xyz, diff.normal, diff.numNaNs );
+}
+
+#define SIMD_CHECK_VERTS 1027		// not a multiple of four so the scalar tails run too
+
+/*
+=============
+R_CheckSimd
+
+Compares the sse2 and scalar md3 lerp, normalize and vertex lighting on
+made up input.  Run at startup with developer set.
+=============
+*/
+void R_CheckSimd( void ) {
+	trRefEntity_t	ent;
+	refEntity_t		re;
+	orientationr_t	oldOr;
+	md3Surface_t	*surf;
+	md3XyzNormal_t	*verts;
+	void			*xyzBuffer, *normalBuffer;
+	vec4_t			*xyz, *normal;
+	simdDiff_t		diff;
+	unsigned		seed;
+	int				lat, lng;
+	int				size;
+	int				i, c, lerp;
+
+	size = sizeof( *surf ) + 2 * SIMD_CHECK_VERTS * sizeof( *verts );
+	surf = ri.Hunk_AllocateTempMemory( size );
+	// aligned for the sse2 normalize
+	xyzBuffer = ri.Hunk_AllocateTempMemory( SIMD_CHECK_VERTS * sizeof( *xyz ) + 15 );
+	normalBuffer = ri.Hunk_AllocateTempMemory( SIMD_CHECK_VERTS * sizeof( *normal ) + 15 );
+	xyz = PADP( xyzBuffer, 16 );
+	normal = PADP( normalBuffer, 16 );
+
+	Com_Memset( surf, 0, size );
+	surf->numFrames = 2;
+	surf->numVerts = SIMD_CHECK_VERTS;
+	surf->ofsXyzNormals = sizeof( *surf );
+	surf->ofsEnd = size;
+	verts = (md3XyzNormal_t *)( surf + 1 );
+
+	// same numbers every time
+	seed = 1;
+	for ( i = 0 ; i < 2 * SIMD_CHECK_VERTS ; i++ ) {
+		for ( c = 0 ; c < 3 ; c++ ) {
+			seed = seed * 1103515245 + 12345;
+			verts[i].xyz[c] = (short)( seed >> 16 );
+		}
+		seed = seed * 1103515245 + 12345;
+		lat = ( seed >> 16 ) & 0xff;
+		lng = ( seed >> 24 ) & 0xff;
+		verts[i].normal = ( lat << 8 ) | lng;
+	}
+
+	Com_Memset( &ent, 0, sizeof( ent ) );
+	Com_Memset( &re, 0, sizeof( re ) );
+	ent.ePtr = &re;
+	VectorSet( ent.ambientLight, 40, 50, 60 );
+	VectorSet( ent.directedLight, 200, 180, 260 );
+	VectorSet( ent.lightDir, 0.36f, 0.48f, 0.8f );
+	for ( c = 0 ; c < 3 ; c++ ) {
+		( (byte *)&ent.ambientLightInt )[c] = ri.ftol( ent.ambientLight[c] );
+	}
+	( (byte *)&ent.ambientLightInt )[3] = 0xff;
+	backEnd.currentEntity = &ent;
+	oldOr = backEnd.or;
+	VectorSet( backEnd.or.viewOrigin, 300, -200, 100 );
+
+	Com_Memset( &diff, 0, sizeof( diff ) );
+	tess.numVertexes = 0;
+	for ( lerp = 0 ; lerp < 2 ; lerp++ ) {
+		R_CompareLerp( surf, lerp ? 0.5f : 0.0f, xyz, normal, &diff );
+
+		// light the scalar result with both versions
+		Com_Memcpy( tess.xyz, xyz, SIMD_CHECK_VERTS * sizeof( *xyz ) );
+		Com_Memcpy( tess.normal, normal, SIMD_CHECK_VERTS * sizeof( *normal ) );
+		tess.numVertexes = SIMD_CHECK_VERTS;
+		RB_CompareSimdLighting( &diff.color, &diff.alpha );
+		tess.numVertexes = 0;
+	}
+
+	// lerped normals that cancel out exactly are rare in models, so
+	// normalize some zero length ones directly
+	for ( i = 0 ; i < SIMD_CHECK_VERTS ; i++ ) {
+		for ( c = 0 ; c < 3 ; c++ ) {
+			seed = seed * 1103515245 + 12345;
+			xyz[i][c] = ( i % 5 ) ? (int)( ( seed >> 16 ) & 0xff ) / 128.0f - 1.0f : 0.0f;
+		}
+		xyz[i][3] = 0;
+	}
+	Com_Memcpy( normal, xyz, SIMD_CHECK_VERTS * sizeof( *xyz ) );
+	VectorArrayNormalize( xyz, SIMD_CHECK_VERTS );
+	VectorArrayNormalize_sse2( normal, SIMD_CHECK_VERTS );
+	for ( i = 0 ; i < SIMD_CHECK_VERTS ; i++ ) {
+		for ( c = 0 ; c < 3 ; c++ ) {
+			if ( Q_floatIsNan( normal[i][c] ) ) {
+				diff.numNaNs++;
+			} else if ( fabs( normal[i][c] - xyz[i][c] ) > diff.normal ) {
+				diff.normal = fabs( normal[i][c] - xyz[i][c] );
+			}
+		}
+	}
+
+	backEnd.or = oldOr;
+	backEnd.currentEntity = NULL;
+
+	ri.Hunk_FreeTempMemory( normalBuffer );
+	ri.Hunk_FreeTempMemory( xyzBuffer );
+	ri.Hunk_FreeTempMemory( surf );
+
+	// the two rsqrt estimates and float to byte rounding differ a little,
+	// the fourth power in the specular makes it a few steps
+	if ( diff.numNaNs  ||  diff.xyz > 0.001f  ||  diff.normal > 0.01f  ||  diff.color > 1  ||  diff.alpha > 4 ) {
+		ri.Printf( PRINT_WARNING, "sse2 and scalar code differ: xyz %f normal %f color %i alpha %i, %i nan\n", diff.xyz, diff.normal, diff.color, diff.alpha, diff.numNaNs );
+	} else {
+		ri.Printf( PRINT_DEVELOPER, "sse2 check: xyz %f normal %f color %i alpha %i\n", diff.xyz, diff.normal, diff.color, diff.alpha );
+	}
+}
+#endif
+
 
 /*
 =============
@@ -1285,7 +1685,7 @@ static void RB_SurfaceFace( srfSurfaceFace_t *surf ) {
 
 	RB_CHECKOVERFLOW( surf->numPoints, surf->numIndices );
 
-	dlightBits = surf->dlightBits;
+	dlightBits = backEnd.dlightBits;
 	tess.dlightBits |= dlightBits;
 
 	indices = ( unsigned * ) ( ( ( char  * ) surf ) + surf->ofsIndices );
@@ -1379,7 +1779,7 @@ static void RB_SurfaceGrid( srfGridMesh_t *cv ) {
 
 	//ri.Printf(PRINT_ALL, "RB_SurfaceGrid '%s'\n", tess.shader->name);
 
-	dlightBits = cv->dlightBits;
+	dlightBits = backEnd.dlightBits;
 	tess.dlightBits |= dlightBits;
 
 	// determine the allowable discrepance
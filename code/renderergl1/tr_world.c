@@ -50,7 +50,7 @@ Returns true if the grid is completely culled away.
 Also sets the clipped hint bit in tess
 =================
 */
-static qboolean	R_CullGrid( srfGridMesh_t *cv ) {
+static qboolean	R_CullGrid( srfGridMesh_t *cv, frontEndCounters_t *pc ) {
 	int 	boxCull;
 	int 	sphereCull;
 
@@ -67,33 +67,33 @@ static qboolean	R_CullGrid( srfGridMesh_t *cv ) {
 	// check for trivial reject
 	if ( sphereCull == CULL_OUT )
 	{
-		tr.pc.c_sphere_cull_patch_out++;
+		pc->c_sphere_cull_patch_out++;
 		return qtrue;
 	}
 	// check bounding box if necessary
 	else if ( sphereCull == CULL_CLIP )
 	{
-		tr.pc.c_sphere_cull_patch_clip++;
+		pc->c_sphere_cull_patch_clip++;
 
 		boxCull = R_CullLocalBox( cv->meshBounds );
 
 		if ( boxCull == CULL_OUT )
 		{
-			tr.pc.c_box_cull_patch_out++;
+			pc->c_box_cull_patch_out++;
 			return qtrue;
 		}
 		else if ( boxCull == CULL_IN )
 		{
-			tr.pc.c_box_cull_patch_in++;
+			pc->c_box_cull_patch_in++;
 		}
 		else
 		{
-			tr.pc.c_box_cull_patch_clip++;
+			pc->c_box_cull_patch_clip++;
 		}
 	}
 	else
 	{
-		tr.pc.c_sphere_cull_patch_in++;
+		pc->c_sphere_cull_patch_in++;
 	}
 
 	return qfalse;
@@ -110,7 +110,7 @@ added to the sorting list.
 This will also allow mirrors on both sides of a model without recursion.
 ================
 */
-static qboolean	R_CullSurface( surfaceType_t *surface, shader_t *shader ) {
+static qboolean	R_CullSurface( surfaceType_t *surface, shader_t *shader, frontEndCounters_t *pc ) {
 	srfSurfaceFace_t *sface;
 	float			d;
 
@@ -119,7 +119,7 @@ static qboolean	R_CullSurface( surfaceType_t *surface, shader_t *shader ) {
 	}
 
 	if ( *surface == SF_GRID ) {
-		return R_CullGrid( (srfGridMesh_t *)surface );
+		return R_CullGrid( (srfGridMesh_t *)surface, pc );
 	}
 
 	if ( *surface == SF_TRIANGLES ) {
@@ -159,21 +159,20 @@ static qboolean	R_CullSurface( surfaceType_t *surface, shader_t *shader ) {
 }
 
 
-static int R_DlightFace( srfSurfaceFace_t *face, int dlightBits ) {
+static int R_DlightFace( srfSurfaceFace_t *face, int dlightBits, frontEndCounters_t *pc ) {
 	float		d;
 	int			i;
 	dlight_t	*dl;
 
 	if (r_dynamiclight->integer > 2) {
-		face->dlightBits = dlightBits;
 		return dlightBits;
 	}
 
-	for ( i = 0 ; i < tr.refdef.num_dlights ; i++ ) {
+	for ( i = 0 ; i < tr.viewParms.num_dlights ; i++ ) {
 		if ( ! ( dlightBits & ( 1 << i ) ) ) {
 			continue;
 		}
-		dl = &tr.refdef.dlights[i];
+		dl = &tr.viewParms.dlights[i];
 		d = DotProduct( dl->origin, face->plane.normal ) - face->plane.dist;
 		if ( d < -dl->radius || d > dl->radius ) {
 			// dlight doesn't reach the plane
@@ -182,27 +181,25 @@ static int R_DlightFace( srfSurfaceFace_t *face, int dlightBits ) {
 	}
 
 	if ( !dlightBits ) {
-		tr.pc.c_dlightSurfacesCulled++;
+		pc->c_dlightSurfacesCulled++;
 	}
 
-	face->dlightBits = dlightBits;
 	return dlightBits;
 }
 
-static int R_DlightGrid( srfGridMesh_t *grid, int dlightBits ) {
+static int R_DlightGrid( srfGridMesh_t *grid, int dlightBits, frontEndCounters_t *pc ) {
 	int			i;
 	dlight_t	*dl;
 
 	if (r_dynamiclight->integer > 2) {
-		grid->dlightBits = dlightBits;
 		return dlightBits;
 	}
 
-	for ( i = 0 ; i < tr.refdef.num_dlights ; i++ ) {
+	for ( i = 0 ; i < tr.viewParms.num_dlights ; i++ ) {
 		if ( ! ( dlightBits & ( 1 << i ) ) ) {
 			continue;
 		}
-		dl = &tr.refdef.dlights[i];
+		dl = &tr.viewParms.dlights[i];
 		if ( dl->origin[0] - dl->radius > grid->meshBounds[1][0]
 			|| dl->origin[0] + dl->radius < grid->meshBounds[0][0]
 			|| dl->origin[1] - dl->radius > grid->meshBounds[1][1]
@@ -215,31 +212,25 @@ static int R_DlightGrid( srfGridMesh_t *grid, int dlightBits ) {
 	}
 
 	if ( !dlightBits ) {
-		tr.pc.c_dlightSurfacesCulled++;
+		pc->c_dlightSurfacesCulled++;
 	}
 
-	grid->dlightBits = dlightBits;
 	return dlightBits;
 }
 
 
 static int R_DlightTrisurf( srfTriangles_t *surf, int dlightBits ) {
 	// FIXME: more dlight culling to trisurfs...
-	if (r_dynamiclight->integer > 2) {
-		surf->dlightBits = dlightBits;
-		return dlightBits;
-	}
-	surf->dlightBits = dlightBits;
 	return dlightBits;
 #if 0
 	int			i;
 	dlight_t	*dl;
 
-	for ( i = 0 ; i < tr.refdef.num_dlights ; i++ ) {
+	for ( i = 0 ; i < tr.viewParms.num_dlights ; i++ ) {
 		if ( ! ( dlightBits & ( 1 << i ) ) ) {
 			continue;
 		}
-		dl = &tr.refdef.dlights[i];
+		dl = &tr.viewParms.dlights[i];
 		if ( dl->origin[0] - dl->radius > grid->meshBounds[1][0]
 			|| dl->origin[0] + dl->radius < grid->meshBounds[0][0]
 			|| dl->origin[1] - dl->radius > grid->meshBounds[1][1]
@@ -255,7 +246,6 @@ static int R_DlightTrisurf( srfTriangles_t *surf, int dlightBits ) {
 		tr.pc.c_dlightSurfacesCulled++;
 	}
 
-	grid->dlightBits = dlightBits;
 	return dlightBits;
 #endif
 }
@@ -269,11 +259,11 @@ that is touched by one or more dlights, so try to throw out
 more dlights if possible.
 ====================
 */
-static int R_DlightSurface( msurface_t *surf, int dlightBits ) {
+static int R_DlightSurface( msurface_t *surf, int dlightBits, frontEndCounters_t *pc ) {
 	if ( *surf->data == SF_FACE ) {
-		dlightBits = R_DlightFace( (srfSurfaceFace_t *)surf->data, dlightBits );
+		dlightBits = R_DlightFace( (srfSurfaceFace_t *)surf->data, dlightBits, pc );
 	} else if ( *surf->data == SF_GRID ) {
-		dlightBits = R_DlightGrid( (srfGridMesh_t *)surf->data, dlightBits );
+		dlightBits = R_DlightGrid( (srfGridMesh_t *)surf->data, dlightBits, pc );
 	} else if ( *surf->data == SF_TRIANGLES ) {
 		dlightBits = R_DlightTrisurf( (srfTriangles_t *)surf->data, dlightBits );
 	} else {
@@ -281,7 +271,7 @@ static int R_DlightSurface( msurface_t *surf, int dlightBits ) {
 	}
 
 	if ( dlightBits ) {
-		tr.pc.c_dlightSurfaces++;
+		pc->c_dlightSurfaces++;
 	}
 
 	return dlightBits;
@@ -289,36 +279,50 @@ static int R_DlightSurface( msurface_t *surf, int dlightBits ) {
 
 
 
+/*
+======================
+R_CullWorldSurface
+
+Returns qtrue if the surface can't be seen, otherwise narrows dlightBits
+to the dlights that reach it.  Only writes to pc, so the front end
+workers can call it for different surfaces at the same time.
+======================
+*/
+static qboolean R_CullWorldSurface( msurface_t *surf, int *dlightBits, frontEndCounters_t *pc ) {
+	// try to cull before dlighting or adding
+	if ( R_CullSurface( surf->data, surf->shader, pc ) ) {
+		return qtrue;
+	}
+
+	// check for dlighting
+	if ( *dlightBits ) {
+		*dlightBits = R_DlightSurface( surf, *dlightBits, pc );
+	}
+
+	return qfalse;
+}
+
 /*
 ======================
 R_AddWorldSurface
 ======================
 */
 static void R_AddWorldSurface( msurface_t *surf, int dlightBits ) {
-	shader_t *shader;
-
 	if ( surf->viewCount == tr.viewCount ) {
 		return;		// already in this view
 	}
 
 	surf->viewCount = tr.viewCount;
-	shader = surf->shader;
 
 	// FIXME: bmodel fog?
 
-	// try to cull before dlighting or adding
-
-	if ( R_CullSurface( surf->data, shader ) ) {
+	if ( R_CullWorldSurface( surf, &dlightBits, &tr.pc ) ) {
 		return;
 	}
 
-	// check for dlighting
-	if ( dlightBits ) {
-		dlightBits = R_DlightSurface( surf, dlightBits );
-		dlightBits = ( dlightBits != 0 );
-	}
-
-	R_AddDrawSurf( surf->data, shader, surf->fogIndex, dlightBits );
+	R_ComposeDrawSurf( &tr.refdef.drawSurfs[tr.refdef.numDrawSurfs & DRAWSURF_MASK],
+		surf->data, surf->shader, surf->fogIndex, dlightBits != 0, dlightBits );
+	tr.refdef.numDrawSurfs++;
 }
 
 /*
@@ -369,152 +373,399 @@ void R_AddBrushModelSurfaces ( trRefEntity_t *ent ) {
 
 /*
 ================
-R_RecursiveWorldNode
+R_InitWorldCull
+
+Builds the packed node array and the per view scratch space the world
+walk uses.  Called while the map is loading.
 ================
 */
-static void R_RecursiveWorldNode( mnode_t *node, unsigned int planeBits, unsigned int dlightBits ) {
+void R_InitWorldCull( world_t *world ) {
+	worldCullNode_t *cn;
+	mnode_t *node;
+	int i;
+
+	world->cullNodes = ri.Hunk_Alloc( world->numnodes * sizeof( *world->cullNodes ), h_low );
+	world->cullStack = ri.Hunk_Alloc( world->numnodes * sizeof( *world->cullStack ), h_low );
+	world->cullLeafs = ri.Hunk_Alloc( world->numnodes * 2 * sizeof( *world->cullLeafs ), h_low );
+	world->cullSurfaces = ri.Hunk_Alloc( world->numsurfaces * sizeof( *world->cullSurfaces ), h_low );
+	world->cullSurfaceDlights = ri.Hunk_Alloc( world->numsurfaces * sizeof( *world->cullSurfaceDlights ), h_low );
+	world->cullDrawSurfs = ri.Hunk_Alloc( world->numsurfaces * sizeof( *world->cullDrawSurfs ), h_low );
+
+	for ( i = 0, node = world->nodes, cn = world->cullNodes ; i < world->numnodes ; i++, node++, cn++ ) {
+		VectorCopy( node->mins, cn->mins );
+		cn->mins[3] = 0;
+		VectorCopy( node->maxs, cn->maxs );
+		cn->maxs[3] = 0;
+		cn->contents = node->contents;
+		cn->visframe = node->visframe;
+		if ( node->contents == -1 ) {
+			cn->children[0] = node->children[0] - world->nodes;
+			cn->children[1] = node->children[1] - world->nodes;
+		} else {
+			cn->children[0] = -1;
+			cn->children[1] = -1;
+		}
+	}
+}
+
+// frustum planes of the current view, one component per array
+static float worldFrustumX[4];
+static float worldFrustumY[4];
+static float worldFrustumZ[4];
+static float worldFrustumDist[4];
 
-	do {
-		unsigned int newDlights[2];
+static void R_SetupWorldFrustum( void ) {
+	int i;
 
-		// if the node wasn't marked as potentially visible, exit
-		if (node->visframe != tr.visCount) {
-			return;
+	for ( i = 0 ; i < 4 ; i++ ) {
+		worldFrustumX[i] = tr.viewParms.frustum[i].normal[0];
+		worldFrustumY[i] = tr.viewParms.frustum[i].normal[1];
+		worldFrustumZ[i] = tr.viewParms.frustum[i].normal[2];
+		worldFrustumDist[i] = tr.viewParms.frustum[i].dist;
+	}
+}
+
+/*
+================
+R_CullWorldNode
+
+Returns qtrue if the node is behind one of the frustum planes in
+planeBits, otherwise clears the bits of the planes it is completely in
+front of.  The sse2 version tests all four planes at once and gives the
+same results as BoxOnPlaneSide().
+================
+*/
+static qboolean R_CullWorldNode( const worldCullNode_t *cn, unsigned int *planeBits ) {
+	int i;
+	int r;
+
+#if idsse2
+	if ( r_simd->integer ) {
+		__m128 nx, ny, nz, a, b, dmin, dmax;
+		int back, front;
+
+		nx = _mm_loadu_ps( worldFrustumX );
+		ny = _mm_loadu_ps( worldFrustumY );
+		nz = _mm_loadu_ps( worldFrustumZ );
+
+		a = _mm_mul_ps( nx, _mm_set1_ps( cn->mins[0] ) );
+		b = _mm_mul_ps( nx, _mm_set1_ps( cn->maxs[0] ) );
+		dmin = _mm_min_ps( a, b );
+		dmax = _mm_max_ps( a, b );
+
+		a = _mm_mul_ps( ny, _mm_set1_ps( cn->mins[1] ) );
+		b = _mm_mul_ps( ny, _mm_set1_ps( cn->maxs[1] ) );
+		dmin = _mm_add_ps( dmin, _mm_min_ps( a, b ) );
+		dmax = _mm_add_ps( dmax, _mm_max_ps( a, b ) );
+
+		a = _mm_mul_ps( nz, _mm_set1_ps( cn->mins[2] ) );
+		b = _mm_mul_ps( nz, _mm_set1_ps( cn->maxs[2] ) );
+		dmin = _mm_add_ps( dmin, _mm_min_ps( a, b ) );
+		dmax = _mm_add_ps( dmax, _mm_max_ps( a, b ) );
+
+		a = _mm_loadu_ps( worldFrustumDist );
+		back = _mm_movemask_ps( _mm_cmplt_ps( dmax, a ) );
+		front = _mm_movemask_ps( _mm_cmpge_ps( dmin, a ) );
+
+		if ( back & *planeBits ) {
+			return qtrue;
 		}
+		*planeBits &= ~front;
+		return qfalse;
+	}
+#endif
 
-		// if the bounding volume is outside the frustum, nothing
-		// inside can be visible OPTIMIZE: don't do this all the way to leafs?
+	for ( i = 0 ; i < 4 ; i++ ) {
+		if ( !( *planeBits & ( 1 << i ) ) ) {
+			continue;
+		}
+		r = BoxOnPlaneSide( (float *)cn->mins, (float *)cn->maxs, &tr.viewParms.frustum[i] );
+		if ( r == 2 ) {
+			return qtrue;						// culled
+		}
+		if ( r == 1 ) {
+			*planeBits &= ~( 1 << i );			// all descendants will also be in front
+		}
+	}
 
-		if ( !r_nocull->integer ) {
-			int		r;
+	return qfalse;
+}
 
-			if ( planeBits & 1 ) {
-				r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[0]);
-				if (r == 2) {
-					return;						// culled
-				}
-				if ( r == 1 ) {
-					planeBits &= ~1;			// all descendants will also be in front
-				}
+/*
+================
+R_GatherWorldLeafs
+
+Walks the bsp front side first, like the old recursive walk, and lists
+the leafs that are in the pvs and frustum with the dlights that touch
+them.  Returns the number of leafs.
+================
+*/
+static int R_GatherWorldLeafs( unsigned int dlightBits ) {
+	const worldCullNode_t *cn;
+	worldCullStack_t *stack;
+	int *leafs;
+	int numLeafs;
+	int sp;
+	int n;
+	unsigned int planeBits;
+
+	stack = tr.world->cullStack;
+	leafs = tr.world->cullLeafs;
+	numLeafs = 0;
+
+	R_SetupWorldFrustum();
+
+	sp = 0;
+	stack[sp].node = 0;
+	stack[sp].planeBits = 15;
+	stack[sp].dlightBits = dlightBits;
+	sp++;
+
+	while ( sp > 0 ) {
+		sp--;
+		n = stack[sp].node;
+		planeBits = stack[sp].planeBits;
+		dlightBits = stack[sp].dlightBits;
+
+		while ( 1 ) {
+			unsigned int newDlights[2];
+
+			cn = &tr.world->cullNodes[n];
+
+			// if the node wasn't marked as potentially visible, exit
+			if ( cn->visframe != tr.visCount ) {
+				break;
 			}
 
-			if ( planeBits & 2 ) {
-				r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[1]);
-				if (r == 2) {
-					return;						// culled
-				}
-				if ( r == 1 ) {
-					planeBits &= ~2;			// all descendants will also be in front
+			// if the bounding volume is outside the frustum, nothing
+			// inside can be visible
+			if ( !r_nocull->integer  &&  planeBits ) {
+				if ( R_CullWorldNode( cn, &planeBits ) ) {
+					break;
 				}
 			}
 
-			if ( planeBits & 4 ) {
-				r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[2]);
-				if (r == 2) {
-					return;						// culled
-				}
-				if ( r == 1 ) {
-					planeBits &= ~4;			// all descendants will also be in front
-				}
+			if ( cn->contents != -1 ) {
+				leafs[numLeafs * 2] = n;
+				leafs[numLeafs * 2 + 1] = dlightBits;
+				numLeafs++;
+				break;
 			}
 
-			if ( planeBits & 8 ) {
-				r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[3]);
-				if (r == 2) {
-					return;						// culled
-				}
-				if ( r == 1 ) {
-					planeBits &= ~8;			// all descendants will also be in front
+			// node is just a decision point, so go down both sides
+			// since we don't care about sort orders, just go positive to negative
+
+			// determine which dlights are needed
+			newDlights[0] = 0;
+			newDlights[1] = 0;
+			if (r_dynamiclight->integer == 2  &&  dlightBits) {
+				const cplane_t *plane;
+				int	i;
+
+				plane = tr.world->nodes[n].plane;
+				for ( i = 0 ; i < tr.viewParms.num_dlights ; i++ ) {
+					dlight_t	*dl;
+					float		dist;
+
+					if ( dlightBits & ( 1 << i ) ) {
+						dl = &tr.viewParms.dlights[i];
+						dist = DotProduct( dl->origin, plane->normal ) - plane->dist;
+
+						//if ( dist < 0.0  &&  dist > -dl->radius ) {  ???
+						if ( dist > -dl->radius ) {
+							newDlights[0] |= ( 1 << i );
+						}
+						if ( dist < dl->radius ) {
+							newDlights[1] |= ( 1 << i );
+						}
+					}
 				}
+			} else if (r_dynamiclight->integer == 1  ||  r_dynamiclight->integer > 2) {
+				newDlights[0] = (1 << tr.viewParms.num_dlights) - 1;
+				newDlights[1] = (1 << tr.viewParms.num_dlights) - 1;
 			}
 
-		}
+			// the back side is walked after everything under the front side
+			stack[sp].node = cn->children[1];
+			stack[sp].planeBits = planeBits;
+			stack[sp].dlightBits = newDlights[1];
+			sp++;
 
-		if ( node->contents != -1 ) {
-			break;
+			n = cn->children[0];
+			dlightBits = newDlights[0];
 		}
+	}
 
-		// node is just a decision point, so go down both sides
-		// since we don't care about sort orders, just go positive to negative
+	return numLeafs;
+}
 
-		// determine which dlights are needed
-		newDlights[0] = 0;
-		newDlights[1] = 0;
-		if (r_dynamiclight->integer == 2  &&  dlightBits) {
-			int	i;
+/*
+================
+R_GatherWorldSurfaces
 
-			for ( i = 0 ; i < tr.refdef.num_dlights ; i++ ) {
-				dlight_t	*dl;
-				float		dist;
+Lists the surfaces of the visible leafs once each, in the order the old
+walk would have added them.  Returns the number of surfaces.
+================
+*/
+static int R_GatherWorldSurfaces( int numLeafs ) {
+	const mnode_t *leaf;
+	const int *leafs;
+	msurface_t *surf, **mark;
+	int numSurfaces;
+	int dlightBits;
+	int i, c;
 
-				if ( dlightBits & ( 1 << i ) ) {
-					dl = &tr.refdef.dlights[i];
-					dist = DotProduct( dl->origin, node->plane->normal ) - node->plane->dist;
+	leafs = tr.world->cullLeafs;
+	numSurfaces = 0;
 
-					//if ( dist < 0.0  &&  dist > -dl->radius ) {  ???
-					if ( dist > -dl->radius ) {
-						newDlights[0] |= ( 1 << i );
-					}
-					if ( dist < dl->radius ) {
-						newDlights[1] |= ( 1 << i );
-					}
-				}
+	for ( i = 0 ; i < numLeafs ; i++ ) {
+		leaf = &tr.world->nodes[leafs[i * 2]];
+		dlightBits = leafs[i * 2 + 1];
+
+		tr.pc.c_leafs++;
+
+		// add to z buffer bounds
+		AddPointToBounds( leaf->mins, tr.viewParms.visBounds[0], tr.viewParms.visBounds[1] );
+		AddPointToBounds( leaf->maxs, tr.viewParms.visBounds[0], tr.viewParms.visBounds[1] );
+
+		// add the individual surfaces
+		mark = leaf->firstmarksurface;
+		c = leaf->nummarksurfaces;
+
+		while ( c-- ) {
+			// the surface may have already been added if it
+			// spans multiple leafs
+			surf = *mark;
+			mark++;
+			if ( surf->viewCount == tr.viewCount ) {
+				continue;
 			}
-		} else if (r_dynamiclight->integer == 1  ||  r_dynamiclight->integer > 2) {
-			newDlights[0] = (1 << tr.refdef.num_dlights) - 1;
-			newDlights[1] = (1 << tr.refdef.num_dlights) - 1;
+			surf->viewCount = tr.viewCount;
+
+			tr.world->cullSurfaces[numSurfaces] = surf;
+			tr.world->cullSurfaceDlights[numSurfaces] = dlightBits;
+			numSurfaces++;
 		}
+	}
 
-		// recurse down the children, front side first
-		R_RecursiveWorldNode (node->children[0], planeBits, newDlights[0] );
+	return numSurfaces;
+}
 
-		// tail recurse
-		node = node->children[1];
-		dlightBits = newDlights[1];
-	} while ( 1 );
+// surfaces each job needs before it's worth waking the workers
+#define MIN_WORLD_JOB_SURFACES 256
+#define MAX_WORLD_JOBS 16
 
+static int numWorldWorkers;
 
-	{
-		// leaf node, so add mark surfaces
-		int			c;
-		msurface_t	*surf, **mark;
+static int worldJobSurfaces;
+static int numWorldJobs;
+static int worldJobDrawSurfs[MAX_WORLD_JOBS];
+static frontEndCounters_t worldJobCounters[MAX_WORLD_JOBS];
 
-		tr.pc.c_leafs++;
+/*
+================
+R_CullWorldSurfacesJob
 
-		// add to z buffer bounds
-		if ( node->mins[0] < tr.viewParms.visBounds[0][0] ) {
-			tr.viewParms.visBounds[0][0] = node->mins[0];
-		}
-		if ( node->mins[1] < tr.viewParms.visBounds[0][1] ) {
-			tr.viewParms.visBounds[0][1] = node->mins[1];
-		}
-		if ( node->mins[2] < tr.viewParms.visBounds[0][2] ) {
-			tr.viewParms.visBounds[0][2] = node->mins[2];
+Culls one slice of the gathered surfaces into the same slice of
+cullDrawSurfs.
+================
+*/
+static void R_CullWorldSurfacesJob( int job ) {
+	msurface_t *surf;
+	drawSurf_t *out;
+	frontEndCounters_t *pc;
+	int dlightBits;
+	int first, last;
+	int i;
+
+	first = worldJobSurfaces * job / numWorldJobs;
+	last = worldJobSurfaces * ( job + 1 ) / numWorldJobs;
+
+	out = &tr.world->cullDrawSurfs[first];
+	pc = &worldJobCounters[job];
+	Com_Memset( pc, 0, sizeof( *pc ) );
+
+	for ( i = first ; i < last ; i++ ) {
+		surf = tr.world->cullSurfaces[i];
+		dlightBits = tr.world->cullSurfaceDlights[i];
+
+		if ( R_CullWorldSurface( surf, &dlightBits, pc ) ) {
+			continue;
 		}
 
-		if ( node->maxs[0] > tr.viewParms.visBounds[1][0] ) {
-			tr.viewParms.visBounds[1][0] = node->maxs[0];
-		}
-		if ( node->maxs[1] > tr.viewParms.visBounds[1][1] ) {
-			tr.viewParms.visBounds[1][1] = node->maxs[1];
-		}
-		if ( node->maxs[2] > tr.viewParms.visBounds[1][2] ) {
-			tr.viewParms.visBounds[1][2] = node->maxs[2];
+		R_ComposeDrawSurf( out, surf->data, surf->shader, surf->fogIndex, dlightBits != 0, dlightBits );
+		out++;
+	}
+
+	worldJobDrawSurfs[job] = out - &tr.world->cullDrawSurfs[first];
+}
+
+/*
+================
+R_AddGatheredWorldSurfaces
+================
+*/
+static void R_AddGatheredWorldSurfaces( int numSurfaces ) {
+	const drawSurf_t *ds;
+	int job, i, j;
+
+	numWorldJobs = numSurfaces / MIN_WORLD_JOB_SURFACES;
+	if ( numWorldJobs > numWorldWorkers + 1 ) {
+		numWorldJobs = numWorldWorkers + 1;
+	}
+	if ( numWorldJobs > MAX_WORLD_JOBS ) {
+		numWorldJobs = MAX_WORLD_JOBS;
+	}
+
+	if ( numWorldJobs <= 1 ) {
+		for ( i = 0 ; i < numSurfaces ; i++ ) {
+			msurface_t *surf;
+			int dlightBits;
+
+			surf = tr.world->cullSurfaces[i];
+			dlightBits = tr.world->cullSurfaceDlights[i];
+			if ( !R_CullWorldSurface( surf, &dlightBits, &tr.pc ) ) {
+				R_ComposeDrawSurf( &tr.refdef.drawSurfs[tr.refdef.numDrawSurfs & DRAWSURF_MASK],
+					surf->data, surf->shader, surf->fogIndex, dlightBits != 0, dlightBits );
+				tr.refdef.numDrawSurfs++;
+			}
 		}
+		return;
+	}
 
-		// add the individual surfaces
-		mark = node->firstmarksurface;
-		c = node->nummarksurfaces;
+	worldJobSurfaces = numSurfaces;
+	GLimp_RunFrontEndJobs( R_CullWorldSurfacesJob, numWorldJobs );
 
-		while (c--) {
-			// the surface may have already been added if it
-			// spans multiple leafs
-			surf = *mark;
-			R_AddWorldSurface( surf, dlightBits );
-			mark++;
+	// append the slices in order, so the list matches the single threaded one
+	for ( job = 0 ; job < numWorldJobs ; job++ ) {
+		ds = &tr.world->cullDrawSurfs[numSurfaces * job / numWorldJobs];
+		for ( j = 0 ; j < worldJobDrawSurfs[job] ; j++, ds++ ) {
+			tr.refdef.drawSurfs[tr.refdef.numDrawSurfs & DRAWSURF_MASK] = *ds;
+			tr.refdef.numDrawSurfs++;
 		}
+
+		tr.pc.c_sphere_cull_patch_in += worldJobCounters[job].c_sphere_cull_patch_in;
+		tr.pc.c_sphere_cull_patch_clip += worldJobCounters[job].c_sphere_cull_patch_clip;
+		tr.pc.c_sphere_cull_patch_out += worldJobCounters[job].c_sphere_cull_patch_out;
+		tr.pc.c_box_cull_patch_in += worldJobCounters[job].c_box_cull_patch_in;
+		tr.pc.c_box_cull_patch_clip += worldJobCounters[job].c_box_cull_patch_clip;
+		tr.pc.c_box_cull_patch_out += worldJobCounters[job].c_box_cull_patch_out;
+		tr.pc.c_dlightSurfaces += worldJobCounters[job].c_dlightSurfaces;
+		tr.pc.c_dlightSurfacesCulled += worldJobCounters[job].c_dlightSurfacesCulled;
 	}
+}
+
+void R_InitWorldWorkers( void ) {
+	numWorldWorkers = 0;
+	if ( r_worldThreads->integer ) {
+		numWorldWorkers = GLimp_SpawnFrontEndWorkers( r_worldThreads->integer );
+		ri.Printf( PRINT_ALL, "world surface culling on %d extra threads\n", numWorldWorkers );
+	}
+}
 
+void R_ShutdownWorldWorkers( void ) {
+	GLimp_ShutdownFrontEndWorkers();
+	numWorldWorkers = 0;
 }
 
 
@@ -573,8 +824,15 @@ qboolean R_inPVS( const vec3_t p1, const vec3_t p2 ) {
 	byte	*vis;
 
 	leaf = R_PointInLeaf( p1 );
+	if ( leaf->cluster == -1 ) {
+		// in solid or outside the map, can't tell
+		return qtrue;
+	}
 	vis = ri.CM_ClusterPVS( leaf->cluster ); // why not R_ClusterPVS ??
 	leaf = R_PointInLeaf( p2 );
+	if ( leaf->cluster == -1 ) {
+		return qtrue;
+	}
 
 	if ( !(vis[leaf->cluster>>3] & (1<<(leaf->cluster&7))) ) {
 		return qfalse;
@@ -629,6 +887,7 @@ static void R_MarkLeaves (void) {
 		for (i=0 ; i<tr.world->numnodes ; i++) {
 			if (tr.world->nodes[i].contents != CONTENTS_SOLID) {
 				tr.world->nodes[i].visframe = tr.visCount;
+				tr.world->cullNodes[i].visframe = tr.visCount;
 			}
 		}
 		return;
@@ -657,23 +916,93 @@ static void R_MarkLeaves (void) {
 			if (parent->visframe == tr.visCount)
 				break;
 			parent->visframe = tr.visCount;
+			tr.world->cullNodes[parent - tr.world->nodes].visframe = tr.visCount;
 			parent = parent->parent;
 		} while (parent);
 	}
 }
 
 
+/*
+================
+R_DlightTouchesVisibleLeaf
+
+Walks the same nodes R_RecursiveWorldNode() would for the light, stopping
+at the first one that's in the PVS and areamask.
+================
+*/
+static qboolean R_DlightTouchesVisibleLeaf( const mnode_t *node, const dlight_t *dl ) {
+	float d;
+
+	while ( 1 ) {
+		if ( node->visframe != tr.visCount ) {
+			return qfalse;
+		}
+
+		if ( node->contents != -1 ) {
+			return qtrue;
+		}
+
+		d = DotProduct( dl->origin, node->plane->normal ) - node->plane->dist;
+		if ( d >= dl->radius ) {
+			node = node->children[0];
+		} else if ( d <= -dl->radius ) {
+			node = node->children[1];
+		} else {
+			if ( R_DlightTouchesVisibleLeaf( node->children[0], dl ) ) {
+				return qtrue;
+			}
+			node = node->children[1];
+		}
+	}
+}
+
+/*
+================
+R_CullDlights
+
+Fills in the dlights of the current view from the scene's.  When more
+lights than the surface bit flags can hold were added to the scene, the
+ones outside the view frustum or away from every visible leaf are dropped
+so the first MAX_DLIGHTS visible lights are kept instead of the first
+MAX_DLIGHTS added.  tr.refdef is left alone since mirror and portal views
+cull the same scene again.  Needs R_MarkLeaves() when cull is set.
+================
+*/
+static void R_CullDlights( qboolean cull ) {
+	dlight_t *dl;
+	int i;
+
+	tr.viewParms.num_dlights = 0;
+	for ( i = 0, dl = tr.refdef.dlights ; i < tr.refdef.num_dlights ; i++, dl++ ) {
+		if ( tr.viewParms.num_dlights == MAX_DLIGHTS ) {
+			break;
+		}
+
+		if ( cull  &&  tr.refdef.num_dlights > MAX_DLIGHTS ) {
+			if ( R_CullPointAndRadius( dl->origin, dl->radius ) == CULL_OUT ) {
+				continue;
+			}
+			if ( !R_DlightTouchesVisibleLeaf( tr.world->nodes, dl ) ) {
+				continue;
+			}
+		}
+
+		tr.viewParms.dlights[tr.viewParms.num_dlights++] = *dl;
+	}
+}
+
 /*
 =============
 R_AddWorldSurfaces
 =============
 */
 void R_AddWorldSurfaces (void) {
-	if ( !r_drawworld->integer ) {
-		return;
-	}
+	int numLeafs;
+	int numSurfaces;
 
-	if ( tr.refdef.rdflags & RDF_NOWORLDMODEL ) {
+	if ( !r_drawworld->integer  ||  ( tr.refdef.rdflags & RDF_NOWORLDMODEL ) ) {
+		R_CullDlights( qfalse );
 		return;
 	}
 
@@ -687,8 +1016,8 @@ void R_AddWorldSurfaces (void) {
 	ClearBounds( tr.viewParms.visBounds[0], tr.viewParms.visBounds[1] );
 
 	// perform frustum culling and add all the potentially visible surfaces
-	if ( tr.refdef.num_dlights > MAX_DLIGHTS ) {
-		tr.refdef.num_dlights = MAX_DLIGHTS ;
-	}
-	R_RecursiveWorldNode( tr.world->nodes, 15, ( 1ULL << tr.refdef.num_dlights ) - 1 );
+	R_CullDlights( qtrue );
+	numLeafs = R_GatherWorldLeafs( ( 1ULL << tr.viewParms.num_dlights ) - 1 );
+	numSurfaces = R_GatherWorldSurfaces( numLeafs );
+	R_AddGatheredWorldSurfaces( numSurfaces );
 }
@@ -3079,7 +3079,9 @@ void RB_ExecuteRenderCommands( const void *data ) {
 			data = RB_TakeScreenshotCmd( data );
 			break;
 		case RC_VIDEOFRAME:
+			ri.ProfileBegin("RB_TakeVideoFrameCmd");
 			data = RB_TakeVideoFrameCmd(data, &shotDataMain);
+			ri.ProfileEnd();
 			break;
 		case RC_COLORMASK:
 			data = RB_ColorMask(data);
@@ -3231,7 +3233,9 @@ void RB_ExecuteRenderCommands( const void *data ) {
 				cmd.png = ri.afdLeft->png;
 				cmd.picCount = ri.afdMain->picCount - 1;
 				Q_strncpyz(cmd.givenFileName, ri.afdMain->givenFileName, MAX_QPATH);
+				ri.ProfileBegin("RB_TakeVideoFrameCmd");
 				RB_TakeVideoFrameCmd(&cmd, &shotDataLeft);
+				ri.ProfileEnd();
 				//ri.Printf(PRINT_ALL, "^1recording ...\n");
 			}
 			data = RB_ClearDepth(data);
@@ -3514,7 +3518,9 @@ void RB_ExecuteRenderCommands( const void *data ) {
 		case RC_VIDEOFRAME:
 			dprintf("r3 takevideoframe\n");
 			//ri.Printf(PRINT_ALL, "r3 takevideoframe\n");
+			ri.ProfileBegin("RB_TakeVideoFrameCmd");
 			data = RB_TakeVideoFrameCmd(data, &shotDataMain);
+			ri.ProfileEnd();
 			break;
 		case RC_END_OF_LIST:
 			t2 = ri.RealMilliseconds();
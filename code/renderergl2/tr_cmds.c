@@ -100,7 +100,9 @@ void R_IssueRenderCommands( qboolean runPerformanceCounters ) {
 	// actually start the commands going
 	if ( !r_skipBackEnd->integer ) {
 		// let it start on the new batch
+		ri.ProfileBegin("RB_ExecuteRenderCommands");
 		RB_ExecuteRenderCommands( cmdList->cmds );
+		ri.ProfileEnd();
 	}
 }
 
@@ -571,6 +573,17 @@ void RE_EndFrame( int *frontEndMsec, int *backEndMsec ) {
 	backEnd.pc.msec = 0;
 }
 
+/*
+=============
+RE_SyncRenderThread
+
+The back end always runs on the main thread here, screenshots and
+video frames are written before RE_EndFrame() returns.
+=============
+*/
+void RE_SyncRenderThread( void ) {
+}
+
 /*
 =============
 RE_TakeVideoFrame
@@ -36,6 +36,7 @@ QGL_1_5_PROCS;
 QGL_2_0_PROCS;
 QGL_ARB_framebuffer_object_PROCS;
 QGL_ARB_vertex_array_object_PROCS;
+QGL_ARB_get_program_binary_PROCS;
 QGL_EXT_direct_state_access_PROCS;
 #undef GLE
 
@@ -166,6 +167,26 @@ void GLimp_InitExtraExtensions()
 		ri.Printf(PRINT_ALL, result[2], extension);
 	}
 
+	// OpenGL 4.1 - GL_ARB_get_program_binary
+	extension = "GL_ARB_get_program_binary";
+	glRefConfig.programBinary = qfalse;
+	if (QGL_VERSION_ATLEAST( 4, 1 ) || SDL_GL_ExtensionSupported(extension))
+	{
+		GLint numFormats = 0;
+
+		QGL_ARB_get_program_binary_PROCS;
+
+		// some drivers have the extension without any formats to save
+		qglGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+		glRefConfig.programBinary = r_glslCache->integer && numFormats > 0;
+
+		ri.Printf(PRINT_ALL, result[glRefConfig.programBinary], extension);
+	}
+	else
+	{
+		ri.Printf(PRINT_ALL, result[2], extension);
+	}
+
 	// Determine GLSL version
 	if (1)
 	{
@@ -427,6 +427,20 @@ void FBO_Init(void)
 		R_CheckFBO(tr.screenSsaoFbo);
 	}
 
+	if (tr.mmeBlurAccumImage)
+	{
+		tr.mmeBlurAccumFbo = FBO_Create("_mmeBlurAccum", tr.mmeBlurAccumImage->width, tr.mmeBlurAccumImage->height);
+		FBO_AttachImage(tr.mmeBlurAccumFbo, tr.mmeBlurAccumImage, GL_COLOR_ATTACHMENT0, 0);
+		R_CheckFBO(tr.mmeBlurAccumFbo);
+
+		for (i = 0; i < tr.numMmeBlurFrames; i++)
+		{
+			tr.mmeBlurFrameFbo[i] = FBO_Create(va("_mmeBlurFrame%d", i), tr.mmeBlurFrameImage[i]->width, tr.mmeBlurFrameImage[i]->height);
+			FBO_AttachImage(tr.mmeBlurFrameFbo[i], tr.mmeBlurFrameImage[i], GL_COLOR_ATTACHMENT0, 0);
+			R_CheckFBO(tr.mmeBlurFrameFbo[i]);
+		}
+	}
+
 	if (tr.renderCubeImage)
 	{
 		tr.renderCubeFbo = FBO_Create("_renderCubeFbo", tr.renderCubeImage->width, tr.renderCubeImage->height);
@@ -695,3 +709,117 @@ void FBO_FastBlit(FBO_t *src, ivec4_t srcBox, FBO_t *dst, ivec4_t dstBox, int bu
 	GL_BindFramebuffer(GL_FRAMEBUFFER, 0);
 	glState.currentFBO = NULL;
 }
+
+/*
+============
+RB_MME_AddBlurFrame
+============
+*/
+static void RB_MME_AddBlurFrame(FBO_t *src, const __m64 *multiply, qboolean first)
+{
+	vec4_t color;
+	float weight;
+
+	// same 8.8 fixed point weights the cpu path uses in tr_mme.c
+	weight = ((const short *)multiply)[0] / 256.0f;
+	VectorSet4(color, weight, weight, weight, weight);
+
+	FBO_Blit(src, NULL, NULL, tr.mmeBlurAccumFbo, NULL, &tr.textureColorShader, color, first ? 0 : GLS_SRCBLEND_ONE | GLS_DSTBLEND_ONE);
+}
+
+/*
+============
+RB_MME_GpuBlurFrame
+
+Adds what was just drawn to the mme blur accumulation buffer, following
+the cpu path in RB_TakeVideoFrameCmd() including the mme_blurOverlap
+ring, so only finished frames are read back.  Returns -1 if the frame
+has to be blended on the cpu, 0 if it was added and 1 if the blurred
+frame was finished and read into out.
+============
+*/
+int RB_MME_GpuBlurFrame(shotData_t *shotData, int width, int height, int format, byte *out)
+{
+	FBO_t *oldFbo = glState.currentFBO;
+	FBO_t *frameFbo;
+	GLint readFramebuffer, drawFramebuffer;
+	GLint viewport[4], scissor[4];
+	int lapIndex, index;
+	int result;
+	int i;
+
+	if (!tr.mmeBlurAccumFbo  ||  !shotData->blurTotal)
+		return -1;
+
+	// there's only one accumulation buffer, split video's left eye uses the cpu
+	if (shotData != &shotDataMain)
+		return -1;
+
+	if (width != tr.mmeBlurAccumFbo->width  ||  height != tr.mmeBlurAccumFbo->height)
+		return -1;
+
+	// ring is sized when the renderer starts
+	if (shotData->overlapTotal > tr.numMmeBlurFrames)
+		return -1;
+
+	// blending gamma corrected frames isn't the same as gamma correcting
+	// the blended one
+	if (!R_GammaCorrectSkipped())
+		return -1;
+
+	qglGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer);
+	qglGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+	qglGetIntegerv(GL_VIEWPORT, viewport);
+	qglGetIntegerv(GL_SCISSOR_BOX, scissor);
+
+	if (shotData->overlapTotal)
+	{
+		lapIndex = shotData->overlapIndex % shotData->overlapTotal;
+		shotData->overlapIndex++;
+
+		// first frame in a sequence, start with the last frames
+		if (shotData->blurIndex == 0)
+		{
+			index = lapIndex;
+			RB_MME_AddBlurFrame(tr.mmeBlurFrameFbo[index], shotData->blurMultiply + 0, qtrue);
+			for (i = 1; i < shotData->overlapTotal; i++)
+			{
+				index = (index + 1) % shotData->overlapTotal;
+				RB_MME_AddBlurFrame(tr.mmeBlurFrameFbo[index], shotData->blurMultiply + i, qfalse);
+			}
+			shotData->blurIndex = shotData->overlapTotal;
+		}
+
+		frameFbo = tr.mmeBlurFrameFbo[lapIndex];
+	}
+	else
+	{
+		frameFbo = tr.mmeBlurFrameFbo[0];
+	}
+
+	// the frame might not be in a texture, copy it first
+	GL_BindFramebuffer(GL_READ_FRAMEBUFFER, readFramebuffer);
+	GL_BindFramebuffer(GL_DRAW_FRAMEBUFFER, frameFbo->frameBuffer);
+	qglBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+	RB_MME_AddBlurFrame(frameFbo, shotData->blurMultiply + shotData->blurIndex, shotData->blurIndex == 0);
+	shotData->blurIndex++;
+
+	result = 0;
+	if (shotData->blurIndex >= shotData->blurTotal)
+	{
+		shotData->blurIndex = 0;
+
+		GL_BindFramebuffer(GL_READ_FRAMEBUFFER, tr.mmeBlurAccumFbo->frameBuffer);
+		qglReadPixels(0, 0, width, height, format, GL_UNSIGNED_BYTE, out);
+		result = 1;
+	}
+
+	FBO_Bind(oldFbo);
+	GL_BindFramebuffer(GL_READ_FRAMEBUFFER, readFramebuffer);
+	GL_BindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFramebuffer);
+	qglViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+	qglScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+
+	return result;
+}
@@ -499,8 +499,183 @@ static void GLSL_ShowProgramUniforms(GLuint program)
 	}
 }
 
+/*
+=============================================================
+
+Program binary cache
+
+Linked programs are saved under glslcache/ with
+GL_ARB_get_program_binary and loaded instead of compiling on the next
+start.  Files are named after a hash of the program's source (which
+includes its defines) and attributes, and also record a hash of the
+driver strings.  Anything that doesn't match is compiled normally and
+the file is written again.
+
+=============================================================
+*/
+
+#define GLSL_CACHE_IDENT (('B'<<24)+('S'<<16)+('L'<<8)+'G')
+#define GLSL_CACHE_VERSION 1
+
+typedef struct {
+	int ident;
+	int version;
+	uint64_t sourceKey;
+	uint64_t driverKey;
+	int binaryFormat;
+	int binaryLength;
+} glslCacheHeader_t;
+
+static int numCachedShaders;
+
+static uint64_t GLSL_HashString (uint64_t hash, const char *s)
+{
+	// FNV-1a, the terminating 0 is hashed so "ab" "c" differs from "a" "bc"
+	do {
+		hash ^= (byte)*s;
+		hash *= 0x100000001b3ULL;
+	} while (*s++);
+
+	return hash;
+}
+
+static uint64_t GLSL_DriverKey (void)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+
+	hash = GLSL_HashString(hash, (const char *)qglGetString(GL_VENDOR));
+	hash = GLSL_HashString(hash, (const char *)qglGetString(GL_RENDERER));
+	hash = GLSL_HashString(hash, (const char *)qglGetString(GL_VERSION));
+	hash = GLSL_HashString(hash, (const char *)qglGetString(GL_SHADING_LANGUAGE_VERSION));
+
+	return hash;
+}
+
+static uint64_t GLSL_SourceKey (int attribs, const char *vpCode, const char *fpCode)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+
+	hash = GLSL_HashString(hash, va("%d", attribs));
+	hash = GLSL_HashString(hash, vpCode);
+	hash = GLSL_HashString(hash, fpCode ? fpCode : "");
+
+	return hash;
+}
+
+static void GLSL_CacheFileName (char *dest, int size, const char *name, uint64_t sourceKey)
+{
+	Com_sprintf(dest, size, "glslcache/%s_%08x%08x.bin", name, (unsigned int)(sourceKey >> 32), (unsigned int)sourceKey);
+}
+
+static qboolean GLSL_BinaryFormatSupported (GLenum format)
+{
+	GLint numFormats;
+	GLint formats[64];
+	int i;
+
+	numFormats = 0;
+	qglGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+	if (numFormats <= 0  ||  numFormats > ARRAY_LEN(formats))
+	{
+		return qfalse;
+	}
+
+	qglGetIntegerv(GL_PROGRAM_BINARY_FORMATS, formats);
+	for (i = 0; i < numFormats; i++)
+	{
+		if ((GLenum)formats[i] == format)
+		{
+			return qtrue;
+		}
+	}
+
+	return qfalse;
+}
+
+static qboolean GLSL_LoadProgramBinary(shaderProgram_t *program, const char *filename, uint64_t sourceKey, uint64_t driverKey)
+{
+	glslCacheHeader_t *header;
+	void *buffer;
+	GLint linked;
+	long size;
+
+	size = ri.FS_ReadFile(filename, &buffer);
+	if (!buffer)
+	{
+		return qfalse;
+	}
+
+	header = (glslCacheHeader_t *)buffer;
+	if (size < sizeof(*header)  ||  header->ident != GLSL_CACHE_IDENT  ||  header->version != GLSL_CACHE_VERSION
+		||  header->sourceKey != sourceKey  ||  header->driverKey != driverKey
+		||  header->binaryLength <= 0  ||  size != sizeof(*header) + header->binaryLength
+		||  !GLSL_BinaryFormatSupported(header->binaryFormat))
+	{
+		ri.Printf(PRINT_DEVELOPER, "...'%s' is out of date\n", filename);
+		ri.FS_FreeFile(buffer);
+		return qfalse;
+	}
+
+	qglProgramBinary(program->program, header->binaryFormat, header + 1, header->binaryLength);
+	ri.FS_FreeFile(buffer);
+
+	linked = 0;
+	qglGetProgramiv(program->program, GL_LINK_STATUS, &linked);
+	if (!linked)
+	{
+		// the driver can reject a binary it wrote itself, just compile it
+		ri.Printf(PRINT_DEVELOPER, "...'%s' was rejected by the driver\n", filename);
+		while (qglGetError() != GL_NO_ERROR)
+			;
+		return qfalse;
+	}
+
+	ri.Printf(PRINT_DEVELOPER, "...loaded '%s'\n", filename);
+
+	return qtrue;
+}
+
+static void GLSL_SaveProgramBinary(const shaderProgram_t *program, const char *filename, uint64_t sourceKey, uint64_t driverKey)
+{
+	glslCacheHeader_t *header;
+	GLint length;
+	GLsizei written;
+	GLenum format;
+
+	length = 0;
+	qglGetProgramiv(program->program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+	{
+		return;
+	}
+
+	header = ri.Malloc(sizeof(*header) + length);
+
+	written = 0;
+	format = 0;
+	qglGetProgramBinary(program->program, length, &written, &format, header + 1);
+
+	if (written > 0)
+	{
+		header->ident = GLSL_CACHE_IDENT;
+		header->version = GLSL_CACHE_VERSION;
+		header->sourceKey = sourceKey;
+		header->driverKey = driverKey;
+		header->binaryFormat = format;
+		header->binaryLength = written;
+
+		ri.FS_WriteFile(filename, header, sizeof(*header) + written);
+	}
+
+	ri.Free(header);
+}
+
 static int GLSL_InitGPUShader2(shaderProgram_t * program, const char *name, int attribs, const char *vpCode, const char *fpCode)
 {
+	char cacheFileName[MAX_QPATH];
+	uint64_t sourceKey = 0;
+	uint64_t driverKey = 0;
+
 	ri.Printf(PRINT_DEVELOPER, "------- GPU shader -------\n");
 
 	if(strlen(name) >= MAX_QPATH)
@@ -513,6 +688,24 @@ static int GLSL_InitGPUShader2(shaderProgram_t * program, const char *name, int
 	program->program = qglCreateProgram();
 	program->attribs = attribs;
 
+	if (glRefConfig.programBinary)
+	{
+		sourceKey = GLSL_SourceKey(attribs, vpCode, fpCode);
+		driverKey = GLSL_DriverKey();
+		GLSL_CacheFileName(cacheFileName, sizeof(cacheFileName), name, sourceKey);
+
+		if (GLSL_LoadProgramBinary(program, cacheFileName, sourceKey, driverKey))
+		{
+			numCachedShaders++;
+			return 1;
+		}
+
+		// start over, the failed binary might have left something behind
+		qglDeleteProgram(program->program);
+		program->program = qglCreateProgram();
+		qglProgramParameteri(program->program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
 	if (!(GLSL_CompileGPUShader(program->program, &program->vertexShader, vpCode, strlen(vpCode), GL_VERTEX_SHADER)))
 	{
 		ri.Printf(PRINT_ALL, "GLSL_InitGPUShader2: Unable to load \"%s\" as GL_VERTEX_SHADER\n", name);
@@ -571,6 +764,11 @@ static int GLSL_InitGPUShader2(shaderProgram_t * program, const char *name, int
 
 	GLSL_LinkProgram(program->program);
 
+	if (glRefConfig.programBinary)
+	{
+		GLSL_SaveProgramBinary(program, cacheFileName, sourceKey, driverKey);
+	}
+
 	return 1;
 }
 
@@ -888,6 +1086,7 @@ void GLSL_InitGPUShaders(void)
 	R_IssuePendingRenderCommands();
 
 	startTime = ri.RealMilliseconds();
+	numCachedShaders = 0;
 
 	for (i = 0; i < GENERICDEF_COUNT; i++)
 	{	
@@ -1349,9 +1548,9 @@ void GLSL_InitGPUShaders(void)
 
 	endTime = ri.RealMilliseconds();
 
-	ri.Printf(PRINT_ALL, "loaded %i GLSL shaders (%i gen %i light %i etc) in %5.2f seconds\n", 
+	ri.Printf(PRINT_ALL, "loaded %i GLSL shaders (%i gen %i light %i etc, %i from cache) in %5.2f seconds\n", 
 		numGenShaders + numLightShaders + numEtcShaders, numGenShaders, numLightShaders, 
-		numEtcShaders, (endTime - startTime) / 1000.0);
+		numEtcShaders, numCachedShaders, (endTime - startTime) / 1000.0);
 }
 
 void GLSL_ShutdownGPUShaders(void)
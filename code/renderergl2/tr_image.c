@@ -26,6 +26,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 static byte			 s_intensitytable[256];
 static unsigned char s_gammatable[256];
+static qboolean s_gammaIdentity;  // s_gammatable doesn't change anything
 
 int		gl_filter_min = GL_LINEAR_MIPMAP_NEAREST;
 int		gl_filter_max = GL_LINEAR;
@@ -36,10 +37,19 @@ static	image_t*		hashTable[FILE_HASH_SIZE];
 /*
 ** R_GammaCorrect
 */
+qboolean R_GammaCorrectSkipped (void)
+{
+	if (r_enablePostProcess->integer  &&  r_enableColorCorrect->integer  &&  glConfig.qlGlsl) {
+		return qtrue;
+	}
+
+	return s_gammaIdentity;
+}
+
 void R_GammaCorrect( byte *buffer, int bufSize ) {
 	int i;
 
-	if (r_enablePostProcess->integer  &&  r_enableColorCorrect->integer  &&  glConfig.qlGlsl) {
+	if (R_GammaCorrectSkipped()) {
 		return;
 	}
 
@@ -3054,6 +3064,24 @@ void R_CreateBuiltinImages( void ) {
 			tr.quarterImage[x] = R_CreateImage(va("*quarter%d", x), NULL, width / 2, height / 2, IMGTYPE_COLORALPHA, IMGFLAG_NO_COMPRESSION | IMGFLAG_CLAMPTOEDGE, GL_RGBA8);
 		}
 
+		// 32 bit float so blending many frames doesn't lose precision
+		if (r_mmeGpuBlur->integer && glRefConfig.textureFloat)
+		{
+			tr.mmeBlurAccumImage = R_CreateImage("*mmeBlurAccum", NULL, width, height, IMGTYPE_COLORALPHA, IMGFLAG_NO_COMPRESSION | IMGFLAG_CLAMPTOEDGE, GL_RGBA32F_ARB);
+
+			// frames kept for mme_blurOverlap, at least one to copy into
+			tr.numMmeBlurFrames = ri.Cvar_VariableIntegerValue("mme_blurOverlap");
+			if (tr.numMmeBlurFrames < 1)
+				tr.numMmeBlurFrames = 1;
+			if (tr.numMmeBlurFrames > MAX_MME_BLUR_FRAMES)
+				tr.numMmeBlurFrames = MAX_MME_BLUR_FRAMES;
+
+			for (x = 0; x < tr.numMmeBlurFrames; x++)
+			{
+				tr.mmeBlurFrameImage[x] = R_CreateImage(va("*mmeBlurFrame%d", x), NULL, width, height, IMGTYPE_COLORALPHA, IMGFLAG_NO_COMPRESSION | IMGFLAG_CLAMPTOEDGE, GL_RGBA8);
+			}
+		}
+
 		if (r_ssao->integer)
 		{
 			tr.screenSsaoImage = R_CreateImage("*screenSsao", NULL, width / 2, height / 2, IMGTYPE_COLORALPHA, IMGFLAG_NO_COMPRESSION | IMGFLAG_CLAMPTOEDGE, GL_RGBA8);
@@ -3154,6 +3182,14 @@ void R_SetColorMappings( void ) {
 		s_gammatable[i] = inf;
 	}
 
+	s_gammaIdentity = qtrue;
+	for (i = 0;  i < 256;  i++) {
+		if (s_gammatable[i] != i) {
+			s_gammaIdentity = qfalse;
+			break;
+		}
+	}
+
 	for (i=0 ; i<256 ; i++) {
 		j = i * r_intensity->value;
 		if (j > 255) {
@@ -58,6 +58,7 @@ glslPrintLog_t;
 #define MAX_SHADERS		(1<<SHADERNUM_BITS)
 
 #define	MAX_FBOS      64
+#define MAX_MME_BLUR_FRAMES 8
 #define MAX_VISCOUNTS 5
 #define MAX_VAOS      4096
 
@@ -1400,6 +1401,8 @@ typedef struct {
 
 	qboolean vertexArrayObject;
 	qboolean directStateAccess;
+
+	qboolean programBinary;
 } glRefConfig_t;
 
 
@@ -1509,6 +1512,9 @@ typedef struct {
 	image_t                 *screenSsaoImage;
 	image_t					*hdrDepthImage;
 	image_t                 *renderCubeImage;
+	image_t					*mmeBlurAccumImage;
+	image_t					*mmeBlurFrameImage[MAX_MME_BLUR_FRAMES];
+	int						numMmeBlurFrames;
 	
 	image_t					*textureDepthImage;
 
@@ -1526,6 +1532,8 @@ typedef struct {
 	FBO_t					*sunShadowFbo[4];
 	FBO_t					*screenShadowFbo;
 	FBO_t					*screenSsaoFbo;
+	FBO_t					*mmeBlurAccumFbo;
+	FBO_t					*mmeBlurFrameFbo[MAX_MME_BLUR_FRAMES];
 	FBO_t					*hdrDepthFbo;
 	FBO_t                   *renderCubeFbo;
 
@@ -1801,6 +1809,7 @@ extern	cvar_t	*r_anaglyphMode;
 extern	cvar_t	*r_anaglyph2d;
 
 extern  cvar_t  *r_externalGLSL;
+extern  cvar_t  *r_glslCache;
 
 extern  cvar_t  *r_hdr;
 extern  cvar_t  *r_floatLightmap;
@@ -1850,6 +1859,7 @@ extern  cvar_t  *r_drawSunRays;
 extern  cvar_t  *r_sunShadows;
 extern  cvar_t  *r_shadowFilter;
 extern  cvar_t  *r_shadowBlur;
+extern  cvar_t  *r_mmeGpuBlur;
 extern  cvar_t  *r_shadowMapSize;
 extern  cvar_t  *r_shadowCascadeZNear;
 extern  cvar_t  *r_shadowCascadeZFar;
@@ -2051,6 +2061,7 @@ void		R_UpdateSubImage( image_t *image, byte *pic, int x, int y, int width, int
 
 void		R_SetColorMappings( void );
 void		R_GammaCorrect( byte *buffer, int bufSize );
+qboolean	R_GammaCorrectSkipped (void);
 
 void	R_ImageList_f( void );
 void	R_SkinList_f( void );
@@ -2341,6 +2352,7 @@ void R_InitNextFrame( void );
 
 void RE_ClearScene( void );
 void RE_AddRefEntityToScene( const refEntity_t *ent );
+void RE_AddRefEntitiesToScene( const refEntity_t *ents, int numEnts );
 void RE_AddPolyToScene( qhandle_t hShader , int numVerts, const polyVert_t *verts, int num, int lightmap );
 void RE_AddLightToScene( const vec3_t org, float intensity, float r, float g, float b );
 void RE_AddAdditiveLightToScene( const vec3_t org, float intensity, float r, float g, float b );
@@ -2591,6 +2603,7 @@ void RE_StretchPic ( float x, float y, float w, float h,
 					  float s1, float t1, float s2, float t2, qhandle_t hShader );
 void RE_BeginFrame( stereoFrame_t stereoFrame, qboolean recordingVideo );
 void RE_EndFrame( int *frontEndMsec, int *backEndMsec );
+void RE_SyncRenderThread( void );
 void RE_SaveJPG(char * filename, int quality, int image_width, int image_height,
                 unsigned char *image_buffer, int padding);
 size_t RE_SaveJPGToBuffer(byte *buffer, size_t bufSize, int quality,
@@ -1759,6 +1759,8 @@ void R_RenderView (viewParms_t *parms) {
 		return;
 	}
 
+	ri.ProfileBegin("R_RenderView");
+
 	tr.viewCount++;
 
 	tr.viewParms = *parms;
@@ -1788,6 +1790,8 @@ void R_RenderView (viewParms_t *parms) {
 
 	// draw main system development information (surface outlines, etc)
 	R_DebugGraphics();
+
+	ri.ProfileEnd();
 }
 
 
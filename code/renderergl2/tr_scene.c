@@ -234,6 +234,31 @@ void RE_AddRefEntityToScene( const refEntity_t *ent ) {
 }
 
 
+/*
+=====================
+RE_AddRefEntitiesToScene
+
+Bulk version of RE_AddRefEntityToScene, lets the cgame hand over a whole
+batch of entities with a single call
+=====================
+*/
+void RE_AddRefEntitiesToScene( const refEntity_t *ents, int numEnts ) {
+	int		i;
+
+	if ( !tr.registered ) {
+		return;
+	}
+
+	if ( numEnts > MAX_REFENTITIES - r_numentities ) {
+		ri.Printf( PRINT_DEVELOPER, "RE_AddRefEntitiesToScene: Dropping %d refEntities, reached MAX_REFENTITIES\n", numEnts - (MAX_REFENTITIES - r_numentities) );
+		numEnts = MAX_REFENTITIES - r_numentities;
+	}
+
+	for ( i = 0; i < numEnts; i++ ) {
+		RE_AddRefEntityToScene( &ents[i] );
+	}
+}
+
 /*
 =====================
 RE_AddDynamicLightToScene
@@ -638,8 +638,15 @@ qboolean R_inPVS( const vec3_t p1, const vec3_t p2 ) {
 	byte	*vis;
 
 	leaf = R_PointInLeaf( p1 );
+	if ( leaf->cluster == -1 ) {
+		// in solid or outside the map, can't tell
+		return qtrue;
+	}
 	vis = ri.CM_ClusterPVS( leaf->cluster ); // why not R_ClusterPVS ??
 	leaf = R_PointInLeaf( p2 );
+	if ( leaf->cluster == -1 ) {
+		return qtrue;
+	}
 
 	if ( !(vis[leaf->cluster>>3] & (1<<(leaf->cluster&7))) ) {
 		return qfalse;
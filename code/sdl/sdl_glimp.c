@@ -1312,3 +1312,387 @@ void GLimp_EndFrame( void )
 		r_fullscreen->modified = qfalse;
 	}
 }
+
+/*
+===========================================================
+
+SMP acceleration
+
+The back end can run on its own thread so the next frame can be built
+while the current one is drawn.  Only one thread has the gl context
+current at a time: the render thread while it is executing commands,
+the main thread otherwise.
+
+===========================================================
+*/
+
+static SDL_mutex *smpMutex = NULL;
+static SDL_cond *renderCommandsEvent = NULL;
+static SDL_cond *renderCompletedEvent = NULL;
+static SDL_Thread *renderThread = NULL;
+static void (*glimpRenderThread)( void ) = NULL;
+static void *smpData = NULL;
+static qboolean smpDataReady = qfalse;  // smpData posted, not picked up yet
+static qboolean smpDataTaken = qfalse;  // render thread is working on smpData
+static qboolean frontEndHasContext = qtrue;
+
+static int GLimp_RenderThreadWrapper( void *arg )
+{
+	glimpRenderThread();
+
+	// release the context so the main thread can take it back
+	SDL_GL_MakeCurrent( SDL_window, NULL );
+
+	return 0;
+}
+
+static void GLimp_DestroyRenderThreadObjects( void )
+{
+	if ( renderCommandsEvent ) {
+		SDL_DestroyCond( renderCommandsEvent );
+		renderCommandsEvent = NULL;
+	}
+	if ( renderCompletedEvent ) {
+		SDL_DestroyCond( renderCompletedEvent );
+		renderCompletedEvent = NULL;
+	}
+	if ( smpMutex ) {
+		SDL_DestroyMutex( smpMutex );
+		smpMutex = NULL;
+	}
+}
+
+/*
+===============
+GLimp_SpawnRenderThread
+===============
+*/
+qboolean GLimp_SpawnRenderThread( void (*function)( void ) )
+{
+	if ( renderThread ) {
+		ri.Printf( PRINT_WARNING, "GLimp_SpawnRenderThread: render thread already running\n" );
+		return qfalse;
+	}
+
+	smpMutex = SDL_CreateMutex();
+	renderCommandsEvent = SDL_CreateCond();
+	renderCompletedEvent = SDL_CreateCond();
+	if ( !smpMutex  ||  !renderCommandsEvent  ||  !renderCompletedEvent ) {
+		ri.Printf( PRINT_WARNING, "GLimp_SpawnRenderThread: couldn't create sync objects: %s\n", SDL_GetError() );
+		GLimp_DestroyRenderThreadObjects();
+		return qfalse;
+	}
+
+	smpData = NULL;
+	smpDataReady = qfalse;
+	smpDataTaken = qfalse;
+	frontEndHasContext = qtrue;
+	glimpRenderThread = function;
+
+	renderThread = SDL_CreateThread( GLimp_RenderThreadWrapper, "render thread", NULL );
+	if ( !renderThread ) {
+		ri.Printf( PRINT_WARNING, "GLimp_SpawnRenderThread: SDL_CreateThread() failed: %s\n", SDL_GetError() );
+		GLimp_DestroyRenderThreadObjects();
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+/*
+===============
+GLimp_ShutdownRenderThread
+
+The render thread must already have been told to exit with
+GLimp_WakeRenderer( NULL ).
+===============
+*/
+void GLimp_ShutdownRenderThread( void )
+{
+	if ( !renderThread ) {
+		return;
+	}
+
+	SDL_WaitThread( renderThread, NULL );
+	renderThread = NULL;
+	glimpRenderThread = NULL;
+
+	GLimp_DestroyRenderThreadObjects();
+
+	SDL_GL_MakeCurrent( SDL_window, SDL_glContext );
+	frontEndHasContext = qtrue;
+}
+
+/*
+===============
+GLimp_RendererSleep
+
+Called by the render thread, returns the next batch of commands or NULL
+when it should exit.
+===============
+*/
+void *GLimp_RendererSleep( void )
+{
+	void *data;
+
+	SDL_GL_MakeCurrent( SDL_window, NULL );
+
+	SDL_LockMutex( smpMutex );
+
+	if ( smpDataTaken ) {
+		// done with the last batch, after this the front end can exit
+		// GLimp_FrontEndSleep
+		smpData = NULL;
+		smpDataTaken = qfalse;
+		SDL_CondSignal( renderCompletedEvent );
+	}
+
+	while ( !smpDataReady ) {
+		SDL_CondWait( renderCommandsEvent, smpMutex );
+	}
+
+	data = smpData;
+	smpDataReady = qfalse;
+	smpDataTaken = qtrue;
+
+	SDL_UnlockMutex( smpMutex );
+
+	if ( data ) {
+		SDL_GL_MakeCurrent( SDL_window, SDL_glContext );
+	}
+
+	return data;
+}
+
+/*
+===============
+GLimp_FrontEndSleep
+
+Waits for the render thread to finish and makes the context current
+on the main thread again.
+===============
+*/
+void GLimp_FrontEndSleep( void )
+{
+	SDL_LockMutex( smpMutex );
+	while ( smpData ) {
+		SDL_CondWait( renderCompletedEvent, smpMutex );
+	}
+	SDL_UnlockMutex( smpMutex );
+
+	if ( !frontEndHasContext ) {
+		SDL_GL_MakeCurrent( SDL_window, SDL_glContext );
+		frontEndHasContext = qtrue;
+	}
+}
+
+/*
+===============
+GLimp_WakeRenderer
+
+Hands the context and a batch of commands to the render thread, NULL
+tells it to exit.  The render thread has to be idle.
+===============
+*/
+void GLimp_WakeRenderer( void *data )
+{
+	if ( frontEndHasContext ) {
+		SDL_GL_MakeCurrent( SDL_window, NULL );
+		frontEndHasContext = qfalse;
+	}
+
+	SDL_LockMutex( smpMutex );
+
+	smpData = data;
+	smpDataReady = qtrue;
+
+	// after this, the renderer can continue through GLimp_RendererSleep
+	SDL_CondSignal( renderCommandsEvent );
+
+	SDL_UnlockMutex( smpMutex );
+}
+
+/*
+===========================================================
+
+Front end workers
+
+A small pool of threads the front end can split independent work
+across.  Jobs must not call back into the engine or touch gl.
+
+===========================================================
+*/
+
+#define MAX_FRONTEND_WORKERS 15
+
+static SDL_mutex *workerMutex = NULL;
+static SDL_cond *workerWakeEvent = NULL;
+static SDL_cond *workerDoneEvent = NULL;
+static SDL_Thread *workerThreads[MAX_FRONTEND_WORKERS];
+static int numWorkerThreads = 0;
+static void (*workerJob)( int index ) = NULL;
+static int workerNumJobs = 0;
+static int workerNextJob = 0;
+static int workerJobsDone = 0;
+static qboolean workerQuit = qfalse;
+
+// takes jobs until there are none left, mutex must be held
+static void GLimp_RunWorkerJobs( void )
+{
+	void (*job)( int index );
+	int index;
+
+	while ( workerNextJob < workerNumJobs ) {
+		job = workerJob;
+		index = workerNextJob;
+		workerNextJob++;
+
+		SDL_UnlockMutex( workerMutex );
+		job( index );
+		SDL_LockMutex( workerMutex );
+
+		workerJobsDone++;
+		if ( workerJobsDone == workerNumJobs ) {
+			SDL_CondSignal( workerDoneEvent );
+		}
+	}
+}
+
+static int GLimp_WorkerThread( void *arg )
+{
+	SDL_LockMutex( workerMutex );
+	while ( 1 ) {
+		while ( !workerQuit  &&  workerNextJob >= workerNumJobs ) {
+			SDL_CondWait( workerWakeEvent, workerMutex );
+		}
+		if ( workerQuit ) {
+			break;
+		}
+		GLimp_RunWorkerJobs();
+	}
+	SDL_UnlockMutex( workerMutex );
+
+	return 0;
+}
+
+/*
+===============
+GLimp_SpawnFrontEndWorkers
+
+count < 0 picks one less than the number of cpus.  Returns the number of
+threads started.
+===============
+*/
+int GLimp_SpawnFrontEndWorkers( int count )
+{
+	GLimp_ShutdownFrontEndWorkers();
+
+	if ( count < 0 ) {
+		count = SDL_GetCPUCount() - 1;
+	}
+	if ( count > MAX_FRONTEND_WORKERS ) {
+		count = MAX_FRONTEND_WORKERS;
+	}
+	if ( count <= 0 ) {
+		return 0;
+	}
+
+	workerMutex = SDL_CreateMutex();
+	workerWakeEvent = SDL_CreateCond();
+	workerDoneEvent = SDL_CreateCond();
+	if ( !workerMutex  ||  !workerWakeEvent  ||  !workerDoneEvent ) {
+		ri.Printf( PRINT_WARNING, "GLimp_SpawnFrontEndWorkers: couldn't create sync objects: %s\n", SDL_GetError() );
+		GLimp_ShutdownFrontEndWorkers();
+		return 0;
+	}
+
+	workerQuit = qfalse;
+	workerJob = NULL;
+	workerNumJobs = 0;
+	workerNextJob = 0;
+	workerJobsDone = 0;
+
+	for ( numWorkerThreads = 0;  numWorkerThreads < count;  numWorkerThreads++ ) {
+		workerThreads[numWorkerThreads] = SDL_CreateThread( GLimp_WorkerThread, "front end worker", NULL );
+		if ( !workerThreads[numWorkerThreads] ) {
+			ri.Printf( PRINT_WARNING, "GLimp_SpawnFrontEndWorkers: SDL_CreateThread() failed: %s\n", SDL_GetError() );
+			break;
+		}
+	}
+
+	if ( !numWorkerThreads ) {
+		GLimp_ShutdownFrontEndWorkers();
+	}
+
+	return numWorkerThreads;
+}
+
+void GLimp_ShutdownFrontEndWorkers( void )
+{
+	int i;
+
+	if ( numWorkerThreads ) {
+		SDL_LockMutex( workerMutex );
+		workerQuit = qtrue;
+		SDL_CondBroadcast( workerWakeEvent );
+		SDL_UnlockMutex( workerMutex );
+
+		for ( i = 0;  i < numWorkerThreads;  i++ ) {
+			SDL_WaitThread( workerThreads[i], NULL );
+		}
+		numWorkerThreads = 0;
+	}
+
+	if ( workerWakeEvent ) {
+		SDL_DestroyCond( workerWakeEvent );
+		workerWakeEvent = NULL;
+	}
+	if ( workerDoneEvent ) {
+		SDL_DestroyCond( workerDoneEvent );
+		workerDoneEvent = NULL;
+	}
+	if ( workerMutex ) {
+		SDL_DestroyMutex( workerMutex );
+		workerMutex = NULL;
+	}
+}
+
+/*
+===============
+GLimp_RunFrontEndJobs
+
+Calls job( 0 ) .. job( numJobs - 1 ) spread over the workers and the
+calling thread, returns when all of them are done.
+===============
+*/
+void GLimp_RunFrontEndJobs( void (*job)( int index ), int numJobs )
+{
+	int i;
+
+	if ( !numWorkerThreads ) {
+		for ( i = 0;  i < numJobs;  i++ ) {
+			job( i );
+		}
+		return;
+	}
+
+	SDL_LockMutex( workerMutex );
+
+	workerJob = job;
+	workerNumJobs = numJobs;
+	workerNextJob = 0;
+	workerJobsDone = 0;
+	SDL_CondBroadcast( workerWakeEvent );
+
+	GLimp_RunWorkerJobs();
+
+	while ( workerJobsDone < workerNumJobs ) {
+		SDL_CondWait( workerDoneEvent, workerMutex );
+	}
+
+	workerJob = NULL;
+	workerNumJobs = 0;
+	workerNextJob = 0;
+
+	SDL_UnlockMutex( workerMutex );
+}
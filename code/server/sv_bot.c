@@ -311,6 +311,24 @@ static void *BotImport_HunkAlloc( int size ) {
 	return Hunk_Alloc( size, h_high );
 }
 
+/*
+=================
+BotImport_CreateThread
+=================
+*/
+static void *BotImport_CreateThread( void (*func)(void *), void *arg ) {
+	return Sys_CreateThread( func, arg );
+}
+
+/*
+=================
+BotImport_JoinThread
+=================
+*/
+static void BotImport_JoinThread( void *thread ) {
+	Sys_JoinThread( (sysThread_t *)thread );
+}
+
 /*
 ==================
 BotImport_DebugPolygonCreate
@@ -494,6 +512,7 @@ void SV_BotInitCvars(void) {
 	Cvar_Get("bot_forcewrite", "0", 0);					//force writing aas file
 	Cvar_Get("bot_aasoptimize", "0", 0);				//no aas file optimisation
 	Cvar_Get("bot_saveroutingcache", "0", 0);			//save routing cache
+	Cvar_Get("bot_buildroutecache", "0", 0);			//precompute and save the routing cache
 	Cvar_Get("bot_thinktime", "100", CVAR_CHEAT);		//msec the bots thinks
 	Cvar_Get("bot_reloadcharacters", "0", 0);			//reload the bot characters each time
 	Cvar_Get("bot_testichat", "0", 0);					//test ichats
@@ -557,6 +576,11 @@ void SV_BotInitBotLib(void) {
 	botlib_import.DebugPolygonCreate = BotImport_DebugPolygonCreate;
 	botlib_import.DebugPolygonDelete = BotImport_DebugPolygonDelete;
 
+	//threads
+	botlib_import.ProcessorCount = Sys_ProcessorCount;
+	botlib_import.CreateThread = BotImport_CreateThread;
+	botlib_import.JoinThread = BotImport_JoinThread;
+
 	botlib_export = (botlib_export_t *)GetBotLibAPI( BOTLIB_API_VERSION, &botlib_import );
 	assert(botlib_export); 	// somehow we end up with a zero import.
 }
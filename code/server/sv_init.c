@@ -693,6 +693,7 @@ void SV_Init (void)
 	sv_banFile = Cvar_Get("sv_banFile", "serverbans.dat", CVAR_ARCHIVE);
 	sv_broadcastAll = Cvar_Get("sv_broadcastAll", "0", CVAR_ARCHIVE);
 	sv_randomClientSlot = Cvar_Get("sv_randomClientSlot", "1", CVAR_ARCHIVE);
+	sv_snapshotThreads = Cvar_Get("sv_snapshotThreads", "-1", CVAR_ARCHIVE);
 
 	// initialize bot cvars so they are listed and can be set before loading the botlib
 	SV_BotInitCvars();
@@ -762,6 +763,10 @@ void SV_Shutdown( char *finalmsg ) {
 	SV_MasterShutdown();
 	SV_ShutdownGameProgs();
 
+	// started again with the next server
+	SV_ShutdownSnapshotWorkers();
+	sv_snapshotThreads->modified = qtrue;
+
 	// free current level
 	SV_ClearServer();
 
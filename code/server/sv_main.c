@@ -65,6 +65,7 @@ cvar_t	*sv_banFile;
 
 cvar_t *sv_broadcastAll;
 cvar_t *sv_randomClientSlot;
+cvar_t *sv_snapshotThreads;
 
 serverBan_t serverBans[SERVER_MAXBANS];
 int serverBansCount = 0;
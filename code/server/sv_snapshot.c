@@ -116,17 +116,15 @@ static void SV_EmitPacketEntities( clientSnapshot_t *from, clientSnapshot_t *to,
 
 /*
 ==================
-SV_WriteSnapshotToClient
+SV_SnapshotDeltaFrame
+
+Picks the previous frame to delta compress the new snapshot against, NULL
+for a full snapshot.
 ==================
 */
-static void SV_WriteSnapshotToClient( client_t *client, msg_t *msg ) {
-	clientSnapshot_t	*frame, *oldframe;
+static clientSnapshot_t *SV_SnapshotDeltaFrame( client_t *client, int *deltaFrame ) {
+	clientSnapshot_t	*oldframe;
 	int					lastframe;
-	int					i;
-	int					snapFlags;
-
-	// this is the snapshot we are creating
-	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
 
 	// try to use a previous frame as the source for delta compressing the snapshot
 	if ( client->deltaMessage <= 0 || client->state != CS_ACTIVE ) {
@@ -152,6 +150,26 @@ static void SV_WriteSnapshotToClient( client_t *client, msg_t *msg ) {
 		}
 	}
 
+	*deltaFrame = lastframe;
+	return oldframe;
+}
+
+/*
+==================
+SV_WriteSnapshot
+
+Doesn't print or touch anything shared, so snapshots for different clients
+can be written from different threads.
+==================
+*/
+static void SV_WriteSnapshot( client_t *client, msg_t *msg, clientSnapshot_t *oldframe, int lastframe ) {
+	clientSnapshot_t	*frame;
+	int					i;
+	int					snapFlags;
+
+	// this is the snapshot we are creating
+	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
+
 	MSG_WriteByte (msg, svc_snapshot);
 
 	// NOTE, MRE: now sent at the start of every message from server to client
@@ -207,6 +225,19 @@ static void SV_WriteSnapshotToClient( client_t *client, msg_t *msg ) {
 	}
 }
 
+/*
+==================
+SV_WriteSnapshotToClient
+==================
+*/
+static void SV_WriteSnapshotToClient( client_t *client, msg_t *msg ) {
+	clientSnapshot_t	*oldframe;
+	int					lastframe;
+
+	oldframe = SV_SnapshotDeltaFrame( client, &lastframe );
+	SV_WriteSnapshot( client, msg, oldframe, lastframe );
+}
+
 
 /*
 ==================
@@ -238,8 +269,12 @@ Build a client snapshot structure
 typedef struct {
 	int		numSnapshotEntities;
 	int		snapshotEntities[MAX_SNAPSHOT_ENTITIES];	
+	byte	added[MAX_GENTITIES / 8];	// used to prevent double adding from portal views
+	const char	*error;				// raised by the caller, snapshots can be built on other threads
 } snapshotEntityNumbers_t;
 
+#define SNAPSHOT_ENT_ADDED( eNums, num ) ( (eNums)->added[(num) >> 3] & (1 << ((num) & 7)) )
+
 /*
 =======================
 SV_QsortEntityNumbers
@@ -268,12 +303,12 @@ static int QDECL SV_QsortEntityNumbers( const void *a, const void *b ) {
 SV_AddEntToSnapshot
 ===============
 */
-static void SV_AddEntToSnapshot( svEntity_t *svEnt, sharedEntity_t *gEnt, snapshotEntityNumbers_t *eNums ) {
+static void SV_AddEntToSnapshot( sharedEntity_t *gEnt, snapshotEntityNumbers_t *eNums ) {
 	// if we have already added this entity to this snapshot, don't add again
-	if ( svEnt->snapshotCounter == sv.snapshotCounter ) {
+	if ( SNAPSHOT_ENT_ADDED( eNums, gEnt->s.number ) ) {
 		return;
 	}
-	svEnt->snapshotCounter = sv.snapshotCounter;
+	eNums->added[gEnt->s.number >> 3] |= 1 << (gEnt->s.number & 7);
 
 	// if we are full, silently discard entities
 	if ( eNums->numSnapshotEntities == MAX_SNAPSHOT_ENTITIES ) {
@@ -324,6 +359,8 @@ static void SV_AddEntitiesVisibleFromPoint( vec3_t origin, clientSnapshot_t *fra
 			continue;
 		}
 
+		// already done by SV_FixEntityNumbers() when building snapshots
+		// on worker threads
 		if (ent->s.number != e) {
 			Com_DPrintf ("FIXING ENT->S.NUMBER!!!\n");
 			ent->s.number = e;
@@ -348,8 +385,10 @@ static void SV_AddEntitiesVisibleFromPoint( vec3_t origin, clientSnapshot_t *fra
 		}
 		// entities can be flagged to be sent to a given mask of clients
 		if ( ent->r.svFlags & SVF_CLIENTMASK ) {
-			if (frame->ps.clientNum >= 32)
-				Com_Error( ERR_DROP, "SVF_CLIENTMASK: clientNum >= 32" );
+			if (frame->ps.clientNum >= 32) {
+				eNums->error = "SVF_CLIENTMASK: clientNum >= 32";
+				return;
+			}
 			if (~ent->r.singleClient & (1 << frame->ps.clientNum))
 				continue;
 		}
@@ -357,13 +396,13 @@ static void SV_AddEntitiesVisibleFromPoint( vec3_t origin, clientSnapshot_t *fra
 		svEnt = SV_SvEntityForGentity( ent );
 
 		// don't double add an entity through portals
-		if ( svEnt->snapshotCounter == sv.snapshotCounter ) {
+		if ( SNAPSHOT_ENT_ADDED( eNums, e ) ) {
 			continue;
 		}
 
 		// broadcast entities are always sent
 		if ( sv_broadcastAll->integer  ||  ent->r.svFlags & SVF_BROADCAST ) {
-			SV_AddEntToSnapshot( svEnt, ent, eNums );
+			SV_AddEntToSnapshot( ent, eNums );
 			continue;
 		}
 
@@ -409,7 +448,7 @@ static void SV_AddEntitiesVisibleFromPoint( vec3_t origin, clientSnapshot_t *fra
 		}
 
 		// add it
-		SV_AddEntToSnapshot( svEnt, ent, eNums );
+		SV_AddEntToSnapshot( ent, eNums );
 
 		// if it's a portal entity, add everything visible from its camera position
 		if ( ent->r.svFlags & SVF_PORTAL ) {
@@ -421,6 +460,9 @@ static void SV_AddEntitiesVisibleFromPoint( vec3_t origin, clientSnapshot_t *fra
 				}
 			}
 			SV_AddEntitiesVisibleFromPoint( ent->s.origin2, frame, eNums, qtrue );
+			if ( eNums->error ) {
+				return;
+			}
 		}
 
 	}
@@ -428,7 +470,7 @@ static void SV_AddEntitiesVisibleFromPoint( vec3_t origin, clientSnapshot_t *fra
 
 /*
 =============
-SV_BuildClientSnapshot
+SV_GatherClientSnapshot
 
 Decides which entities are going to be visible to the client, and
 copies off the playerstate and areabits.
@@ -437,28 +479,25 @@ This properly handles multiple recursive portals, but the render
 currently doesn't.
 
 For viewing through other player's eyes, clent can be something other than client->gentity
+
+Only reads shared state, so it can run for several clients at once.
 =============
 */
-static void SV_BuildClientSnapshot( client_t *client ) {
+static void SV_GatherClientSnapshot( client_t *client, snapshotEntityNumbers_t *entityNumbers ) {
 	vec3_t						org;
 	clientSnapshot_t			*frame;
-	snapshotEntityNumbers_t		entityNumbers;
 	int							i;
-	sharedEntity_t				*ent;
-	entityState_t				*state;
-	svEntity_t					*svEnt;
 	sharedEntity_t				*clent;
 	int							clientNum;
 	playerState_t				*ps;
 
-	// bump the counter used to prevent double adding
-	sv.snapshotCounter++;
-
 	// this is the frame we are creating
 	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
 
 	// clear everything in this snapshot
-	entityNumbers.numSnapshotEntities = 0;
+	entityNumbers->numSnapshotEntities = 0;
+	entityNumbers->error = NULL;
+	Com_Memset( entityNumbers->added, 0, sizeof( entityNumbers->added ) );
 	Com_Memset( frame->areabits, 0, sizeof( frame->areabits ) );
 
   // https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=62
@@ -477,11 +516,10 @@ static void SV_BuildClientSnapshot( client_t *client ) {
 	// be regenerated from the playerstate
 	clientNum = frame->ps.clientNum;
 	if ( clientNum < 0 || clientNum >= MAX_GENTITIES ) {
-		Com_Error( ERR_DROP, "SV_SvEntityForGentity: bad gEnt" );
+		entityNumbers->error = "SV_SvEntityForGentity: bad gEnt";
+		return;
 	}
-	svEnt = &sv.svEntities[ clientNum ];
-
-	svEnt->snapshotCounter = sv.snapshotCounter;
+	entityNumbers->added[clientNum >> 3] |= 1 << (clientNum & 7);
 
 	// find the client's viewpoint
 	VectorCopy( ps->origin, org );
@@ -489,35 +527,80 @@ static void SV_BuildClientSnapshot( client_t *client ) {
 
 	// add all the entities directly visible to the eye, which
 	// may include portal entities that merge other viewpoints
-	SV_AddEntitiesVisibleFromPoint( org, frame, &entityNumbers, qfalse );
+	SV_AddEntitiesVisibleFromPoint( org, frame, entityNumbers, qfalse );
+	if ( entityNumbers->error ) {
+		return;
+	}
 
 	// if there were portals visible, there may be out of order entities
 	// in the list which will need to be resorted for the delta compression
-	// to work correctly.  This also catches the error condition
-	// of an entity being included twice.
-	qsort( entityNumbers.snapshotEntities, entityNumbers.numSnapshotEntities, 
-		sizeof( entityNumbers.snapshotEntities[0] ), SV_QsortEntityNumbers );
+	// to work correctly.  Entities can't be added twice, so the compare
+	// never errors out.
+	qsort( entityNumbers->snapshotEntities, entityNumbers->numSnapshotEntities, 
+		sizeof( entityNumbers->snapshotEntities[0] ), SV_QsortEntityNumbers );
 
 	// now that all viewpoint's areabits have been OR'd together, invert
 	// all of them to make it a mask vector, which is what the renderer wants
 	for ( i = 0 ; i < MAX_MAP_AREA_BYTES/4 ; i++ ) {
 		((int *)frame->areabits)[i] = ((int *)frame->areabits)[i] ^ -1;
 	}
+}
+
+/*
+=============
+SV_AllocSnapshotEntities
+
+Reserves room in svs.snapshotEntities for the gathered entities.
+=============
+*/
+static void SV_AllocSnapshotEntities( client_t *client, const snapshotEntityNumbers_t *entityNumbers ) {
+	clientSnapshot_t			*frame;
+
+	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
 
-	// copy the entity states out
 	frame->num_entities = 0;
 	frame->first_entity = svs.nextSnapshotEntities;
-	for ( i = 0 ; i < entityNumbers.numSnapshotEntities ; i++ ) {
-		ent = SV_GentityNum(entityNumbers.snapshotEntities[i]);
-		state = &svs.snapshotEntities[svs.nextSnapshotEntities % svs.numSnapshotEntities];
-		*state = ent->s;
-		svs.nextSnapshotEntities++;
-		// this should never hit, map should always be restarted first in SV_Frame
-		if ( svs.nextSnapshotEntities >= 0x7FFFFFFE ) {
-			Com_Error(ERR_FATAL, "svs.nextSnapshotEntities wrapped");
-		}
-		frame->num_entities++;
+	if ( !client->gentity || client->state == CS_ZOMBIE ) {
+		return;
+	}
+
+	frame->num_entities = entityNumbers->numSnapshotEntities;
+	svs.nextSnapshotEntities += entityNumbers->numSnapshotEntities;
+	// this should never hit, map should always be restarted first in SV_Frame
+	if ( svs.nextSnapshotEntities >= 0x7FFFFFFE ) {
+		Com_Error(ERR_FATAL, "svs.nextSnapshotEntities wrapped");
+	}
+}
+
+// copy the entity states out
+static void SV_CopySnapshotEntities( client_t *client, const snapshotEntityNumbers_t *entityNumbers ) {
+	clientSnapshot_t			*frame;
+	sharedEntity_t				*ent;
+	int							i;
+
+	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
+
+	for ( i = 0 ; i < frame->num_entities ; i++ ) {
+		ent = SV_GentityNum(entityNumbers->snapshotEntities[i]);
+		svs.snapshotEntities[(frame->first_entity + i) % svs.numSnapshotEntities] = ent->s;
+	}
+}
+
+/*
+=============
+SV_BuildClientSnapshot
+=============
+*/
+static void SV_BuildClientSnapshot( client_t *client ) {
+	snapshotEntityNumbers_t		entityNumbers;
+
+	SV_GatherClientSnapshot( client, &entityNumbers );
+	if ( entityNumbers.error ) {
+		Com_Error( ERR_DROP, "%s", entityNumbers.error );
 	}
+
+	SV_AllocSnapshotEntities( client, &entityNumbers );
+	SV_CopySnapshotEntities( client, &entityNumbers );
 }
 
 #ifdef USE_VOIP
@@ -586,6 +669,27 @@ void SV_SendMessageToClient(msg_t *msg, client_t *client)
 }
 
 
+/*
+=======================
+SV_FinishClientSnapshot
+
+Appends what has to be written on the main thread and sends the message.
+=======================
+*/
+static void SV_FinishClientSnapshot( client_t *client, msg_t *msg ) {
+#ifdef USE_VOIP
+	SV_WriteVoipToClient( client, msg );
+#endif
+
+	// check for overflow
+	if ( msg->overflowed ) {
+		Com_Printf ("WARNING: msg overflowed for %s\n", client->name);
+		MSG_Clear (msg);
+	}
+
+	SV_SendMessageToClient( msg, client );
+}
+
 /*
 =======================
 SV_SendClientSnapshot
@@ -621,17 +725,294 @@ void SV_SendClientSnapshot( client_t *client ) {
 	// and the playerState_t
 	SV_WriteSnapshotToClient( client, &msg );
 
-#ifdef USE_VOIP
-	SV_WriteVoipToClient( client, &msg );
-#endif
+	SV_FinishClientSnapshot( client, &msg );
+}
 
-	// check for overflow
-	if ( msg.overflowed ) {
-		Com_Printf ("WARNING: msg overflowed for %s\n", client->name);
-		MSG_Clear (&msg);
+/*
+=============================================================================
+
+Snapshot workers
+
+With sv_snapshotThreads the snapshots of all the clients due in a frame
+are built and encoded by a pool of threads:
+
+  gather     in parallel, each client's visible entities, playerstate and
+             areabits, only reading the world and game entities
+  allocate   on the main thread, in client order, the range each snapshot
+             gets in svs.snapshotEntities and the frame to delta against
+  encode     in parallel, copy the entity states and write each message
+             into the client's own buffer
+  send       on the main thread, in client order
+
+Picking every delta frame after all the ranges are allocated keeps any
+client from deltaing against entities another client's snapshot
+overwrites in the same frame.
+
+=============================================================================
+*/
+
+#define MAX_SNAPSHOT_WORKERS 15
+
+typedef struct {
+	client_t				*client;
+	snapshotEntityNumbers_t	entityNumbers;
+	clientSnapshot_t		*oldframe;
+	int						lastframe;
+	msg_t					msg;
+	byte					msgBuf[MAX_MSGLEN];
+} snapshotJob_t;
+
+static snapshotJob_t snapshotJobs[MAX_CLIENTS];
+
+static sysMutex_t *snapshotWorkerMutex = NULL;
+static sysCond_t *snapshotWorkerWake = NULL;
+static sysCond_t *snapshotWorkerDone = NULL;
+static sysThread_t *snapshotWorkers[MAX_SNAPSHOT_WORKERS];
+static int numSnapshotWorkers = 0;
+static void (*snapshotWorkerJob)( int index ) = NULL;
+static int snapshotNumJobs = 0;
+static int snapshotNextJob = 0;
+static int snapshotJobsDone = 0;
+static qboolean snapshotWorkerQuit = qfalse;
+
+// takes jobs until there are none left, mutex must be held
+static void SV_RunSnapshotWorkerJobs( void )
+{
+	void (*job)( int index );
+	int index;
+
+	while ( snapshotNextJob < snapshotNumJobs ) {
+		job = snapshotWorkerJob;
+		index = snapshotNextJob;
+		snapshotNextJob++;
+
+		Sys_UnlockMutex( snapshotWorkerMutex );
+		job( index );
+		Sys_LockMutex( snapshotWorkerMutex );
+
+		snapshotJobsDone++;
+		if ( snapshotJobsDone == snapshotNumJobs ) {
+			Sys_CondSignal( snapshotWorkerDone );
+		}
 	}
+}
 
-	SV_SendMessageToClient( &msg, client );
+static void SV_SnapshotWorkerThread( void *arg )
+{
+	Sys_LockMutex( snapshotWorkerMutex );
+	while ( 1 ) {
+		while ( !snapshotWorkerQuit  &&  snapshotNextJob >= snapshotNumJobs ) {
+			Sys_CondWait( snapshotWorkerWake, snapshotWorkerMutex );
+		}
+		if ( snapshotWorkerQuit ) {
+			break;
+		}
+		SV_RunSnapshotWorkerJobs();
+	}
+	Sys_UnlockMutex( snapshotWorkerMutex );
+}
+
+/*
+=======================
+SV_ShutdownSnapshotWorkers
+=======================
+*/
+void SV_ShutdownSnapshotWorkers( void )
+{
+	int i;
+
+	if ( numSnapshotWorkers ) {
+		Sys_LockMutex( snapshotWorkerMutex );
+		snapshotWorkerQuit = qtrue;
+		Sys_CondBroadcast( snapshotWorkerWake );
+		Sys_UnlockMutex( snapshotWorkerMutex );
+
+		for ( i = 0;  i < numSnapshotWorkers;  i++ ) {
+			Sys_JoinThread( snapshotWorkers[i] );
+		}
+		numSnapshotWorkers = 0;
+	}
+
+	if ( snapshotWorkerWake ) {
+		Sys_DestroyCond( snapshotWorkerWake );
+		snapshotWorkerWake = NULL;
+	}
+	if ( snapshotWorkerDone ) {
+		Sys_DestroyCond( snapshotWorkerDone );
+		snapshotWorkerDone = NULL;
+	}
+	if ( snapshotWorkerMutex ) {
+		Sys_DestroyMutex( snapshotWorkerMutex );
+		snapshotWorkerMutex = NULL;
+	}
+}
+
+/*
+=======================
+SV_StartSnapshotWorkers
+
+count < 0 picks one less than the number of cpus.
+=======================
+*/
+static void SV_StartSnapshotWorkers( int count )
+{
+	SV_ShutdownSnapshotWorkers();
+
+	if ( count < 0 ) {
+		count = Sys_ProcessorCount() - 1;
+	}
+	if ( count > MAX_SNAPSHOT_WORKERS ) {
+		count = MAX_SNAPSHOT_WORKERS;
+	}
+	if ( count <= 0 ) {
+		return;
+	}
+
+	snapshotWorkerMutex = Sys_CreateMutex();
+	snapshotWorkerWake = Sys_CreateCond();
+	snapshotWorkerDone = Sys_CreateCond();
+	if ( !snapshotWorkerMutex  ||  !snapshotWorkerWake  ||  !snapshotWorkerDone ) {
+		Com_Printf( "^3SV_StartSnapshotWorkers: couldn't create sync objects\n" );
+		SV_ShutdownSnapshotWorkers();
+		return;
+	}
+
+	snapshotWorkerQuit = qfalse;
+	snapshotWorkerJob = NULL;
+	snapshotNumJobs = 0;
+	snapshotNextJob = 0;
+	snapshotJobsDone = 0;
+
+	for ( numSnapshotWorkers = 0;  numSnapshotWorkers < count;  numSnapshotWorkers++ ) {
+		snapshotWorkers[numSnapshotWorkers] = Sys_CreateThread( SV_SnapshotWorkerThread, NULL );
+		if ( !snapshotWorkers[numSnapshotWorkers] ) {
+			Com_Printf( "^3SV_StartSnapshotWorkers: couldn't start thread\n" );
+			break;
+		}
+	}
+
+	if ( !numSnapshotWorkers ) {
+		SV_ShutdownSnapshotWorkers();
+	}
+}
+
+/*
+=======================
+SV_RunSnapshotJobs
+
+Calls job( 0 ) .. job( numJobs - 1 ) spread over the workers and the
+calling thread, returns when all of them are done.
+=======================
+*/
+static void SV_RunSnapshotJobs( void (*job)( int index ), int numJobs )
+{
+	Sys_LockMutex( snapshotWorkerMutex );
+
+	snapshotWorkerJob = job;
+	snapshotNumJobs = numJobs;
+	snapshotNextJob = 0;
+	snapshotJobsDone = 0;
+	Sys_CondBroadcast( snapshotWorkerWake );
+
+	SV_RunSnapshotWorkerJobs();
+	while ( snapshotJobsDone < snapshotNumJobs ) {
+		Sys_CondWait( snapshotWorkerDone, snapshotWorkerMutex );
+	}
+
+	snapshotWorkerJob = NULL;
+	snapshotNumJobs = 0;
+	snapshotNextJob = 0;
+
+	Sys_UnlockMutex( snapshotWorkerMutex );
+}
+
+static void SV_GatherSnapshotJob( int index )
+{
+	snapshotJob_t *j = &snapshotJobs[index];
+
+	SV_GatherClientSnapshot( j->client, &j->entityNumbers );
+}
+
+static void SV_EncodeSnapshotJob( int index )
+{
+	snapshotJob_t *j = &snapshotJobs[index];
+	client_t *client = j->client;
+
+	SV_CopySnapshotEntities( client, &j->entityNumbers );
+
+	// bots need to have their snapshots build, but
+	// the query them directly without needing to be sent
+	if ( client->gentity && client->gentity->r.svFlags & SVF_BOT ) {
+		return;
+	}
+
+	MSG_Init( &j->msg, j->msgBuf, sizeof(j->msgBuf) );
+	j->msg.allowoverflow = qtrue;
+
+	// NOTE, MRE: all server->client messages now acknowledge
+	// let the client know which reliable clientCommands we have received
+	MSG_WriteLong( &j->msg, client->lastClientCommand );
+
+	// (re)send any reliable server commands
+	SV_UpdateServerCommandsToClient( client, &j->msg );
+
+	SV_WriteSnapshot( client, &j->msg, j->oldframe, j->lastframe );
+}
+
+// done once before gathering so the workers don't have to fix anything
+static void SV_FixEntityNumbers( void )
+{
+	sharedEntity_t *ent;
+	int e;
+
+	for ( e = 0 ; e < sv.num_entities ; e++ ) {
+		ent = SV_GentityNum(e);
+		if ( ent->r.linked  &&  ent->s.number != e ) {
+			Com_DPrintf ("FIXING ENT->S.NUMBER!!!\n");
+			ent->s.number = e;
+		}
+	}
+}
+
+/*
+=======================
+SV_SendSnapshotJobs
+
+Builds, encodes and sends the snapshots of snapshotJobs[0 .. numJobs - 1].
+=======================
+*/
+static void SV_SendSnapshotJobs( int numJobs )
+{
+	snapshotJob_t *j;
+	int i;
+
+	SV_FixEntityNumbers();
+
+	SV_RunSnapshotJobs( SV_GatherSnapshotJob, numJobs );
+
+	for ( i = 0;  i < numJobs;  i++ ) {
+		j = &snapshotJobs[i];
+		if ( j->entityNumbers.error ) {
+			Com_Error( ERR_DROP, "%s", j->entityNumbers.error );
+		}
+		SV_AllocSnapshotEntities( j->client, &j->entityNumbers );
+	}
+
+	for ( i = 0;  i < numJobs;  i++ ) {
+		j = &snapshotJobs[i];
+		j->oldframe = SV_SnapshotDeltaFrame( j->client, &j->lastframe );
+	}
+
+	SV_RunSnapshotJobs( SV_EncodeSnapshotJob, numJobs );
+
+	for ( i = 0;  i < numJobs;  i++ ) {
+		j = &snapshotJobs[i];
+		if ( !(j->client->gentity && j->client->gentity->r.svFlags & SVF_BOT) ) {
+			SV_FinishClientSnapshot( j->client, &j->msg );
+		}
+		j->client->lastSnapshotTime = svs.time;
+		j->client->rateDelayed = qfalse;
+	}
 }
 
 
@@ -644,6 +1025,14 @@ void SV_SendClientMessages(void)
 {
 	int			i;
 	client_t	*c;
+	int			numJobs;
+
+	if ( sv_snapshotThreads->modified ) {
+		SV_StartSnapshotWorkers( sv_snapshotThreads->integer );
+		sv_snapshotThreads->modified = qfalse;
+	}
+
+	numJobs = 0;
 
 	// send a message to each connected client
 	for(i=0; i < sv_maxclients->integer; i++)
@@ -678,10 +1067,28 @@ void SV_SendClientMessages(void)
 			}
 		}
 
+		if(numSnapshotWorkers)
+		{
+			snapshotJobs[numJobs].client = c;
+			numJobs++;
+			continue;
+		}
+
 		// generate and send a new message
 		SV_SendClientSnapshot(c);
 		c->lastSnapshotTime = svs.time;
 		c->rateDelayed = qfalse;
 	}
-}
 
+	if(numJobs == 1)
+	{
+		// not worth waking the workers
+		SV_SendClientSnapshot(snapshotJobs[0].client);
+		snapshotJobs[0].client->lastSnapshotTime = svs.time;
+		snapshotJobs[0].client->rateDelayed = qfalse;
+	}
+	else if(numJobs > 1)
+	{
+		SV_SendSnapshotJobs(numJobs);
+	}
+}
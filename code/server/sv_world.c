@@ -54,26 +54,53 @@ clipHandle_t SV_ClipHandleForEntity( const sharedEntity_t *ent ) {
 ENTITY CHECKING
 
 To avoid linearly searching through lists of entities during environment testing,
-the world is carved up with an evenly spaced, axially aligned bsp tree.  Entities
-are kept in chains either at the final leafs, or at the first node that splits
-them, which prevents having to deal with multiple fragments of a single entity.
+linked entities are kept in hashed uniform grids on the x and y axes.  There are
+a few grid levels with growing cell sizes and an entity goes into the first level
+whose cells are at least as wide as its bounds, in the cell its absmin is in.  So
+every entity is in exactly one chain and a query only has to look at the cells
+its bounds touch, extended by one cell towards the negative side.  Entities
+larger than the cells of every level are kept in a separate chain that every
+query checks.
+
+Cells are hashed into a fixed number of sectors per level, several cells can
+share a sector.  Entities remember their cell so they are only returned for
+the cell they're in.
 
 ===============================================================================
 */
 
 typedef struct worldSector_s {
-	int		axis;		// -1 = leaf node
-	float	dist;
-	struct worldSector_s	*children[2];
 	svEntity_t	*entities;
 } worldSector_t;
 
-#define	AREA_DEPTH	4
-#define	AREA_NODES	64
+#define	WORLD_GRID_LEVELS		3
+#define	WORLD_GRID_CELL_SHIFT	7		// 128 unit cells on the first level
+#define	WORLD_GRID_LEVEL_SHIFT	2		// every level has 4 times wider cells
+#define	WORLD_GRID_HASH_BITS	10		// 1024 sectors on the first level, a quarter on each next one
+
+#define	AREA_NODES	( 1024 + 256 + 64 + 1 )
+
+typedef struct {
+	int				cellSize;
+	int				numSectors;		// power of two
+	worldSector_t	*sectors;
+	int				numEntities;
+} worldGridLevel_t;
 
 worldSector_t	sv_worldSectors[AREA_NODES];
 int			sv_numworldSectors;
 
+static worldGridLevel_t	sv_worldGrid[WORLD_GRID_LEVELS];
+static worldSector_t	*sv_largeEntities = &sv_worldSectors[AREA_NODES - 1];	// too large for any grid level
+
+
+static ID_INLINE int SV_GridCoord( float v, const worldGridLevel_t *grid ) {
+	return (int)floor( v / grid->cellSize );
+}
+
+static ID_INLINE worldSector_t *SV_GridSector( const worldGridLevel_t *grid, int x, int y ) {
+	return &grid->sectors[ ( (unsigned int)x * 73856093u ^ (unsigned int)y * 19349663u ) & ( grid->numSectors - 1 ) ];
+}
 
 /*
 ===============
@@ -81,61 +108,33 @@ SV_SectorList_f
 ===============
 */
 void SV_SectorList_f( void ) {
-	int				i, c;
-	worldSector_t	*sec;
+	int				i, j, c, total, most;
+	worldGridLevel_t	*grid;
 	svEntity_t		*ent;
 
-	for ( i = 0 ; i < AREA_NODES ; i++ ) {
-		sec = &sv_worldSectors[i];
+	for ( i = 0 ; i < WORLD_GRID_LEVELS ; i++ ) {
+		grid = &sv_worldGrid[i];
 
-		c = 0;
-		for ( ent = sec->entities ; ent ; ent = ent->nextEntityInWorldSector ) {
-			c++;
+		total = 0;
+		most = 0;
+		for ( j = 0 ; j < grid->numSectors ; j++ ) {
+			c = 0;
+			for ( ent = grid->sectors[j].entities ; ent ; ent = ent->nextEntityInWorldSector ) {
+				c++;
+			}
+			total += c;
+			if ( c > most ) {
+				most = c;
+			}
 		}
-		Com_Printf( "sector %i: %i entities\n", i, c );
+		Com_Printf( "level %i: %i unit cells, %i sectors, %i entities, at most %i in a sector\n", i, grid->cellSize, grid->numSectors, total, most );
 	}
-}
 
-/*
-===============
-SV_CreateworldSector
-
-Builds a uniformly subdivided tree for the given world size
-===============
-*/
-static worldSector_t *SV_CreateworldSector( int depth, vec3_t mins, vec3_t maxs ) {
-	worldSector_t	*anode;
-	vec3_t		size;
-	vec3_t		mins1, maxs1, mins2, maxs2;
-
-	anode = &sv_worldSectors[sv_numworldSectors];
-	sv_numworldSectors++;
-
-	if (depth == AREA_DEPTH) {
-		anode->axis = -1;
-		anode->children[0] = anode->children[1] = NULL;
-		return anode;
+	c = 0;
+	for ( ent = sv_largeEntities->entities ; ent ; ent = ent->nextEntityInWorldSector ) {
+		c++;
 	}
-	
-	VectorSubtract (maxs, mins, size);
-	if (size[0] > size[1]) {
-		anode->axis = 0;
-	} else {
-		anode->axis = 1;
-	}
-
-	anode->dist = 0.5 * (maxs[anode->axis] + mins[anode->axis]);
-	VectorCopy (mins, mins1);	
-	VectorCopy (mins, mins2);	
-	VectorCopy (maxs, maxs1);	
-	VectorCopy (maxs, maxs2);	
-	
-	maxs1[anode->axis] = mins2[anode->axis] = anode->dist;
-	
-	anode->children[0] = SV_CreateworldSector (depth+1, mins2, maxs2);
-	anode->children[1] = SV_CreateworldSector (depth+1, mins1, maxs1);
-
-	return anode;
+	Com_Printf( "large: %i entities\n", c );
 }
 
 /*
@@ -145,16 +144,23 @@ SV_ClearWorld
 ===============
 */
 void SV_ClearWorld( void ) {
-	clipHandle_t	h;
-	vec3_t			mins, maxs;
+	worldGridLevel_t	*grid;
+	int				i;
 
 	Com_Memset( sv_worldSectors, 0, sizeof(sv_worldSectors) );
 	sv_numworldSectors = 0;
 
-	// get world map bounds
-	h = CM_InlineModel( 0 );
-	CM_ModelBounds( h, mins, maxs );
-	SV_CreateworldSector( 0, mins, maxs );
+	for ( i = 0 ; i < WORLD_GRID_LEVELS ; i++ ) {
+		grid = &sv_worldGrid[i];
+		grid->cellSize = 1 << ( WORLD_GRID_CELL_SHIFT + i * WORLD_GRID_LEVEL_SHIFT );
+		grid->numSectors = 1 << ( WORLD_GRID_HASH_BITS - i * WORLD_GRID_LEVEL_SHIFT );
+		grid->sectors = &sv_worldSectors[sv_numworldSectors];
+		grid->numEntities = 0;
+		sv_numworldSectors += grid->numSectors;
+	}
+
+	sv_largeEntities = &sv_worldSectors[sv_numworldSectors];
+	sv_numworldSectors++;
 }
 
 
@@ -179,6 +185,10 @@ void SV_UnlinkEntity( sharedEntity_t *gEnt ) {
 	}
 	ent->worldSector = NULL;
 
+	if ( ent->worldLevel >= 0 ) {
+		sv_worldGrid[ent->worldLevel].numEntities--;
+	}
+
 	if ( ws->entities == ent ) {
 		ws->entities = ent->nextEntityInWorldSector;
 		return;
@@ -204,6 +214,8 @@ SV_LinkEntity
 #define MAX_TOTAL_ENT_LEAFS		128
 void SV_LinkEntity( sharedEntity_t *gEnt ) {
 	worldSector_t	*node;
+	worldGridLevel_t	*grid;
+	float		size;
 	int			leafs[MAX_TOTAL_ENT_LEAFS];
 	int			cluster;
 	int			num_leafs;
@@ -332,20 +344,31 @@ void SV_LinkEntity( sharedEntity_t *gEnt ) {
 
 	gEnt->r.linkcount++;
 
-	// find the first world sector node that the ent's box crosses
-	node = sv_worldSectors;
-	while (1)
-	{
-		if (node->axis == -1)
+	// find the first grid level with cells as wide as the ent's box
+	size = gEnt->r.absmax[0] - gEnt->r.absmin[0];
+	if ( gEnt->r.absmax[1] - gEnt->r.absmin[1] > size ) {
+		size = gEnt->r.absmax[1] - gEnt->r.absmin[1];
+	}
+
+	for ( i = 0 ; i < WORLD_GRID_LEVELS ; i++ ) {
+		if ( size <= sv_worldGrid[i].cellSize ) {
 			break;
-		if ( gEnt->r.absmin[node->axis] > node->dist)
-			node = node->children[0];
-		else if ( gEnt->r.absmax[node->axis] < node->dist)
-			node = node->children[1];
-		else
-			break;		// crosses the node
-	}
-	
+		}
+	}
+
+	if ( i == WORLD_GRID_LEVELS ) {
+		node = sv_largeEntities;
+		ent->worldLevel = -1;
+		ent->worldCell[0] = ent->worldCell[1] = 0;
+	} else {
+		grid = &sv_worldGrid[i];
+		ent->worldLevel = i;
+		ent->worldCell[0] = SV_GridCoord( gEnt->r.absmin[0], grid );
+		ent->worldCell[1] = SV_GridCoord( gEnt->r.absmin[1], grid );
+		node = SV_GridSector( grid, ent->worldCell[0], ent->worldCell[1] );
+		grid->numEntities++;
+	}
+
 	// link it in
 	ent->worldSector = node;
 	ent->nextEntityInWorldSector = node->entities;
@@ -374,16 +397,22 @@ typedef struct {
 
 /*
 ====================
-SV_AreaEntities_r
+SV_AreaEntitiesInSector
 
+Adds the entities in the sector that are in the given range of cells
+and touch the bounds.  Returns qfalse when the list is full.
 ====================
 */
-static void SV_AreaEntities_r( worldSector_t *node, areaParms_t *ap ) {
-	svEntity_t	*check, *next;
+static qboolean SV_AreaEntitiesInSector( const worldSector_t *sector, int x0, int y0, int x1, int y1, areaParms_t *ap ) {
+	svEntity_t	*check;
 	sharedEntity_t *gcheck;
 
-	for ( check = node->entities  ; check ; check = next ) {
-		next = check->nextEntityInWorldSector;
+	for ( check = sector->entities  ; check ; check = check->nextEntityInWorldSector ) {
+		// other cells hashed to the same sector
+		if ( check->worldCell[0] < x0 || check->worldCell[0] > x1
+		|| check->worldCell[1] < y0 || check->worldCell[1] > y1 ) {
+			continue;
+		}
 
 		gcheck = SV_GEntityForSvEntity( check );
 
@@ -398,24 +427,14 @@ static void SV_AreaEntities_r( worldSector_t *node, areaParms_t *ap ) {
 
 		if ( ap->count == ap->maxcount ) {
 			Com_Printf ("SV_AreaEntities: MAXCOUNT\n");
-			return;
+			return qfalse;
 		}
 
 		ap->list[ap->count] = check - sv.svEntities;
 		ap->count++;
 	}
 
-	if (node->axis == -1) {
-		return;		// terminal node
-	}
-
-	// recurse down both sides
-	if ( ap->maxs[node->axis] > node->dist ) {
-		SV_AreaEntities_r ( node->children[0], ap );
-	}
-	if ( ap->mins[node->axis] < node->dist ) {
-		SV_AreaEntities_r ( node->children[1], ap );
-	}
+	return qtrue;
 }
 
 /*
@@ -425,6 +444,9 @@ SV_AreaEntities
 */
 int SV_AreaEntities( const vec3_t mins, const vec3_t maxs, int *entityList, int maxcount ) {
 	areaParms_t		ap;
+	const worldGridLevel_t	*grid;
+	int				i, j, x, y;
+	int				x0, y0, x1, y1;
 
 	ap.mins = mins;
 	ap.maxs = maxs;
@@ -432,7 +454,40 @@ int SV_AreaEntities( const vec3_t mins, const vec3_t maxs, int *entityList, int
 	ap.count = 0;
 	ap.maxcount = maxcount;
 
-	SV_AreaEntities_r( sv_worldSectors, &ap );
+	if ( !SV_AreaEntitiesInSector( sv_largeEntities, 0, 0, 0, 0, &ap ) ) {
+		return ap.count;
+	}
+
+	for ( i = 0 ; i < WORLD_GRID_LEVELS ; i++ ) {
+		grid = &sv_worldGrid[i];
+		if ( !grid->numEntities ) {
+			continue;
+		}
+
+		// entities are at most one cell wide and linked by their absmin
+		x0 = SV_GridCoord( mins[0] - grid->cellSize, grid );
+		y0 = SV_GridCoord( mins[1] - grid->cellSize, grid );
+		x1 = SV_GridCoord( maxs[0], grid );
+		y1 = SV_GridCoord( maxs[1], grid );
+
+		if ( (double)( x1 - x0 + 1 ) * ( y1 - y0 + 1 ) > grid->numSectors ) {
+			// more cells than sectors, check every sector once
+			for ( j = 0 ; j < grid->numSectors ; j++ ) {
+				if ( !SV_AreaEntitiesInSector( &grid->sectors[j], x0, y0, x1, y1, &ap ) ) {
+					return ap.count;
+				}
+			}
+			continue;
+		}
+
+		for ( y = y0 ; y <= y1 ; y++ ) {
+			for ( x = x0 ; x <= x1 ; x++ ) {
+				if ( !SV_AreaEntitiesInSector( SV_GridSector( grid, x, y ), x, y, x, y, &ap ) ) {
+					return ap.count;
+				}
+			}
+		}
+	}
 
 	return ap.count;
 }
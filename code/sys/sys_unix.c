@@ -40,11 +40,13 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include <unistd.h>
 #include <sys/mman.h>
 #include <sys/time.h>
+#include <time.h>
 #include <pwd.h>
 #include <libgen.h>
 #include <fcntl.h>
 #include <fenv.h>
 #include <execinfo.h>
+#include <pthread.h>
 
 //#define _GNU_SOURCE
 //#ifndef _GNU_SOURCE
@@ -256,6 +258,30 @@ int Sys_Milliseconds (void)
 	return curtime;
 }
 
+/*
+================
+Sys_Microseconds
+================
+*/
+int64_t Sys_Microseconds (void)
+{
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+
+	// durations shouldn't jump when the wall clock is changed
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+		return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+	}
+#endif
+	{
+		struct timeval tp;
+
+		gettimeofday(&tp, NULL);
+
+		return (int64_t)tp.tv_sec * 1000000 + tp.tv_usec;
+	}
+}
+
 /*
 ==================
 Sys_RandomBytes
@@ -1948,3 +1974,158 @@ void Sys_DisableScreenBlanking (void)
 {
 	// nothing
 }
+
+/*
+==============================================================
+
+Threads
+
+==============================================================
+*/
+
+struct sysThread_s {
+	pthread_t thread;
+	void (*func)(void *);
+	void *arg;
+};
+
+struct sysMutex_s {
+	pthread_mutex_t mutex;
+};
+
+struct sysCond_s {
+	pthread_cond_t cond;
+};
+
+static void *Sys_ThreadProc (void *data)
+{
+	sysThread_t *t;
+
+	t = (sysThread_t *)data;
+	t->func(t->arg);
+
+	return NULL;
+}
+
+sysThread_t *Sys_CreateThread (void (*func)(void *), void *arg)
+{
+	sysThread_t *t;
+	int r;
+
+	t = (sysThread_t *)malloc(sizeof(sysThread_t));
+	if (t == NULL) {
+		Com_Printf("^1%s couldn't allocate memory\n", __FUNCTION__);
+		return NULL;
+	}
+
+	t->func = func;
+	t->arg = arg;
+
+	r = pthread_create(&t->thread, NULL, Sys_ThreadProc, t);
+	if (r) {
+		Com_Printf("^1%s couldn't create thread  error: %d\n", __FUNCTION__, r);
+		free(t);
+		return NULL;
+	}
+
+	return t;
+}
+
+void Sys_JoinThread (sysThread_t *thread)
+{
+	int r;
+
+	if (thread == NULL) {
+		return;
+	}
+
+	r = pthread_join(thread->thread, NULL);
+	if (r) {
+		Com_Printf("^1%s failed  error: %d\n", __FUNCTION__, r);
+	}
+
+	free(thread);
+}
+
+sysMutex_t *Sys_CreateMutex (void)
+{
+	sysMutex_t *m;
+
+	m = (sysMutex_t *)malloc(sizeof(sysMutex_t));
+	if (m == NULL) {
+		Com_Error(ERR_FATAL, "%s couldn't allocate memory", __FUNCTION__);
+	}
+	pthread_mutex_init(&m->mutex, NULL);
+
+	return m;
+}
+
+void Sys_DestroyMutex (sysMutex_t *mutex)
+{
+	if (mutex == NULL) {
+		return;
+	}
+
+	pthread_mutex_destroy(&mutex->mutex);
+	free(mutex);
+}
+
+void Sys_LockMutex (sysMutex_t *mutex)
+{
+	pthread_mutex_lock(&mutex->mutex);
+}
+
+void Sys_UnlockMutex (sysMutex_t *mutex)
+{
+	pthread_mutex_unlock(&mutex->mutex);
+}
+
+sysCond_t *Sys_CreateCond (void)
+{
+	sysCond_t *c;
+
+	c = (sysCond_t *)malloc(sizeof(sysCond_t));
+	if (c == NULL) {
+		Com_Error(ERR_FATAL, "%s couldn't allocate memory", __FUNCTION__);
+	}
+	pthread_cond_init(&c->cond, NULL);
+
+	return c;
+}
+
+void Sys_DestroyCond (sysCond_t *cond)
+{
+	if (cond == NULL) {
+		return;
+	}
+
+	pthread_cond_destroy(&cond->cond);
+	free(cond);
+}
+
+void Sys_CondWait (sysCond_t *cond, sysMutex_t *mutex)
+{
+	pthread_cond_wait(&cond->cond, &mutex->mutex);
+}
+
+void Sys_CondSignal (sysCond_t *cond)
+{
+	pthread_cond_signal(&cond->cond);
+}
+
+void Sys_CondBroadcast (sysCond_t *cond)
+{
+	pthread_cond_broadcast(&cond->cond);
+}
+
+int Sys_ProcessorCount (void)
+{
+	long n;
+
+	n = sysconf(_SC_NPROCESSORS_ONLN);
+	if (n < 1) {
+		return 1;
+	}
+
+	return (int)n;
+}
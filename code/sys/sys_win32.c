@@ -372,6 +372,26 @@ int Sys_Milliseconds (void)
 	return sys_curtime;
 }
 
+/*
+================
+Sys_Microseconds
+================
+*/
+int64_t Sys_Microseconds (void)
+{
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER count;
+
+	if (!frequency.QuadPart) {
+		if (!QueryPerformanceFrequency(&frequency)) {
+			return (int64_t)Sys_Milliseconds() * 1000;
+		}
+	}
+	QueryPerformanceCounter(&count);
+
+	return (int64_t)(count.QuadPart / frequency.QuadPart) * 1000000 + (int64_t)((count.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart);
+}
+
 /*
 ================
 Sys_RandomBytes
@@ -1943,3 +1963,184 @@ void Sys_DisableScreenBlanking (void)
 		lastTime = currentTime;
 	}
 }
+
+/*
+==============================================================
+
+Threads
+
+==============================================================
+*/
+
+struct sysThread_s {
+	HANDLE handle;
+	void (*func)(void *);
+	void *arg;
+};
+
+struct sysMutex_s {
+	CRITICAL_SECTION cs;
+};
+
+// WINVER 0x501 doesn't have condition variables, emulate them with a
+// semaphore and a waiter count
+struct sysCond_s {
+	CRITICAL_SECTION lock;
+	HANDLE sem;
+	int waiters;
+};
+
+static unsigned int __stdcall Sys_ThreadProc (void *data)
+{
+	sysThread_t *t;
+
+	t = (sysThread_t *)data;
+	t->func(t->arg);
+
+	return 0;
+}
+
+sysThread_t *Sys_CreateThread (void (*func)(void *), void *arg)
+{
+	sysThread_t *t;
+
+	t = (sysThread_t *)malloc(sizeof(sysThread_t));
+	if (t == NULL) {
+		Com_Printf("^1%s couldn't allocate memory\n", __FUNCTION__);
+		return NULL;
+	}
+
+	t->func = func;
+	t->arg = arg;
+
+	t->handle = (HANDLE)_beginthreadex(NULL, 0, Sys_ThreadProc, t, 0, NULL);
+	if (!t->handle) {
+		Com_Printf("^1%s couldn't create thread  error: %d\n", __FUNCTION__, errno);
+		free(t);
+		return NULL;
+	}
+
+	return t;
+}
+
+void Sys_JoinThread (sysThread_t *thread)
+{
+	DWORD r;
+
+	if (thread == NULL) {
+		return;
+	}
+
+	r = WaitForSingleObject(thread->handle, INFINITE);
+	if (r) {
+		Com_Printf("^1%s failed (0x%x) error: %ld\n", __FUNCTION__, (unsigned int)r, GetLastError());
+	}
+
+	CloseHandle(thread->handle);
+	free(thread);
+}
+
+sysMutex_t *Sys_CreateMutex (void)
+{
+	sysMutex_t *m;
+
+	m = (sysMutex_t *)malloc(sizeof(sysMutex_t));
+	if (m == NULL) {
+		Com_Error(ERR_FATAL, "%s couldn't allocate memory", __FUNCTION__);
+	}
+	InitializeCriticalSection(&m->cs);
+
+	return m;
+}
+
+void Sys_DestroyMutex (sysMutex_t *mutex)
+{
+	if (mutex == NULL) {
+		return;
+	}
+
+	DeleteCriticalSection(&mutex->cs);
+	free(mutex);
+}
+
+void Sys_LockMutex (sysMutex_t *mutex)
+{
+	EnterCriticalSection(&mutex->cs);
+}
+
+void Sys_UnlockMutex (sysMutex_t *mutex)
+{
+	LeaveCriticalSection(&mutex->cs);
+}
+
+sysCond_t *Sys_CreateCond (void)
+{
+	sysCond_t *c;
+
+	c = (sysCond_t *)malloc(sizeof(sysCond_t));
+	if (c == NULL) {
+		Com_Error(ERR_FATAL, "%s couldn't allocate memory", __FUNCTION__);
+	}
+	InitializeCriticalSection(&c->lock);
+	c->sem = CreateSemaphore(NULL, 0, 0x7fffffff, NULL);
+	if (c->sem == NULL) {
+		Com_Error(ERR_FATAL, "%s couldn't create semaphore  error: %ld", __FUNCTION__, GetLastError());
+	}
+	c->waiters = 0;
+
+	return c;
+}
+
+void Sys_DestroyCond (sysCond_t *cond)
+{
+	if (cond == NULL) {
+		return;
+	}
+
+	CloseHandle(cond->sem);
+	DeleteCriticalSection(&cond->lock);
+	free(cond);
+}
+
+void Sys_CondWait (sysCond_t *cond, sysMutex_t *mutex)
+{
+	EnterCriticalSection(&cond->lock);
+	cond->waiters++;
+	LeaveCriticalSection(&cond->lock);
+
+	LeaveCriticalSection(&mutex->cs);
+	WaitForSingleObject(cond->sem, INFINITE);
+	EnterCriticalSection(&mutex->cs);
+}
+
+void Sys_CondSignal (sysCond_t *cond)
+{
+	EnterCriticalSection(&cond->lock);
+	if (cond->waiters > 0) {
+		cond->waiters--;
+		ReleaseSemaphore(cond->sem, 1, NULL);
+	}
+	LeaveCriticalSection(&cond->lock);
+}
+
+void Sys_CondBroadcast (sysCond_t *cond)
+{
+	EnterCriticalSection(&cond->lock);
+	if (cond->waiters > 0) {
+		ReleaseSemaphore(cond->sem, cond->waiters, NULL);
+		cond->waiters = 0;
+	}
+	LeaveCriticalSection(&cond->lock);
+}
+
+int Sys_ProcessorCount (void)
+{
+	SYSTEM_INFO si;
+
+	GetSystemInfo(&si);
+	if (si.dwNumberOfProcessors < 1) {
+		return 1;
+	}
+
+	return (int)si.dwNumberOfProcessors;
+}